@@ -0,0 +1,102 @@
+// Interrupt-driven blink and wink buttons.
+//
+// Each button pin (to ground, with pull-up) interrupts on both edges.  The
+// handler debounces with a lockout: an edge is only taken BUTTON_DEBOUNCE
+// micros after the last accepted one, and only if the pin level actually
+// differs from the last reported state.  Accepted edges go into a small
+// lock-free queue with their micros() timestamp; frame() drains it, so
+// presses between frames are never missed and blinks start at the real
+// press time.  An edge inside the lockout, or one that finds the queue
+// full, is not taken at all: the reported state keeps the old level and
+// the button is flagged.  buttonResync(), called by frame(), samples only
+// flagged pins again and queues whatever changed since, so a short release
+// is late by at most a frame but never lost, and frames without a rejected
+// edge don't touch the pins.  After light sleep, buttonRecheck() flags
+// every button.
+//
+// Button ids: 0 to NUM_EYES - 1 are the wink buttons of each eye,
+// BUTTON_BLINK the all-eyes blink button.
+//
+// Include after config.h.
+
+#pragma once
+
+#include <stdint.h>
+
+#define BUTTON_BLINK    NUM_EYES
+#define BUTTONS         (NUM_EYES + 1)
+#define BUTTON_QUEUE    16   // Events, power of 2
+#define BUTTON_DEBOUNCE 5000 // micros
+
+typedef struct {
+  uint32_t time;    // micros() at the edge
+  uint8_t  button;  // Button id
+  uint8_t  pressed; // 1 = pressed (pin low), 0 = released
+} buttonEvent_t;
+
+static buttonEvent_t buttonQueue[BUTTON_QUEUE];
+static uint32_t      buttonHead, buttonTail; // Written by ISR / frame() only
+static int8_t        buttonPin[BUTTONS];
+static uint8_t       buttonState[BUTTONS];   // ISR side: last reported state
+static uint32_t      buttonEdge[BUTTONS];    // ISR side: last accepted edge
+static uint16_t      buttonRejected;         // Bit per button: edge turned away
+
+static void ARDUINO_ISR_ATTR buttonISR(void *arg) {
+  uint8_t  b = (uint8_t)(uintptr_t)arg;
+  uint32_t t = micros();
+  uint8_t  pressed = (digitalRead(buttonPin[b]) == LOW);
+  if (pressed == buttonState[b]) return;
+  uint32_t head = buttonHead;
+  if ((t - buttonEdge[b] < BUTTON_DEBOUNCE) ||
+      (head - __atomic_load_n(&buttonTail, __ATOMIC_ACQUIRE) >= BUTTON_QUEUE)) {
+    __atomic_fetch_or(&buttonRejected, 1 << b, __ATOMIC_RELAXED); // Resync later
+    return;
+  }
+  buttonEdge[b]  = t;
+  buttonState[b] = pressed;
+  buttonQueue[head & (BUTTON_QUEUE - 1)] = { t, b, pressed };
+  __atomic_store_n(&buttonHead, head + 1, __ATOMIC_RELEASE);
+}
+
+// Set up button b on pin (ignored if pin < 0)
+static void buttonAttach(uint8_t b, int8_t pin) {
+  buttonPin[b] = pin;
+  if (pin < 0) return;
+  pinMode(pin, INPUT_PULLUP);
+  buttonState[b] = (digitalRead(pin) == LOW);
+  buttonEdge[b]  = micros() - BUTTON_DEBOUNCE;
+  attachInterruptArg(digitalPinToInterrupt(pin), buttonISR, (void *)(uintptr_t)b, CHANGE);
+}
+
+// Next queued event, false if none
+static inline bool buttonNext(buttonEvent_t *ev) {
+  uint32_t tail = buttonTail;
+  if (tail == __atomic_load_n(&buttonHead, __ATOMIC_ACQUIRE)) return false;
+  *ev = buttonQueue[tail & (BUTTON_QUEUE - 1)];
+  __atomic_store_n(&buttonTail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+// Any event queued
+static inline bool buttonPending(void) {
+  return buttonTail != __atomic_load_n(&buttonHead, __ATOMIC_ACQUIRE);
+}
+
+// Queue any change the interrupt turned away (inside the lockout or with
+// the queue full) on the buttons flagged since the last call; one still
+// too early is flagged again.  Call once per frame.
+static inline void buttonResync(void) {
+  uint16_t flagged = __atomic_exchange_n(&buttonRejected, 0, __ATOMIC_RELAXED);
+  for (uint8_t b = 0; flagged; b++, flagged >>= 1) {
+    if (!(flagged & 1) || (buttonPin[b] < 0)) continue;
+    noInterrupts();
+    buttonISR((void *)(uintptr_t)b);
+    interrupts();
+  }
+}
+
+// Have the next buttonResync() sample every button, e.g. after light sleep
+// (edges while asleep raise no interrupt)
+static inline void buttonRecheck(void) {
+  __atomic_store_n(&buttonRejected, (1 << BUTTONS) - 1, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,135 @@
+// Binary control protocol for driving the eyes from a PC or companion board
+// over the USB CDC serial port.
+//
+// Packet, little endian:
+//   CMD_MAGIC, cmd, len, seq (u16), host time (u32), payload[len], check
+// where check is the 8-bit sum of every byte after CMD_MAGIC.  seq lets the
+// sketch drop stale or repeated packets; host time is the sender's own
+// clock, echoed in the debug log so the host can measure round trips.
+//
+//   CMD_GAZE    x, y (i16, 0-1023), or -1, -1 to return to autonomous motion
+//   CMD_IRIS    scale (u16, IRIS_MIN-IRIS_MAX), or 0 for autonomous
+//   CMD_BLINK   eye mask (u8, bit per eye), duration (u16 ms, 0 = random)
+//   CMD_SELECT  animation (u8): ANIM_EYES, ANIM_DEMO_2 or ANIM_DEMO_3
+//   CMD_EXPR    expression (u8): index into tlExpressions[] (timeline.h),
+//               0 look aside and blink, 1 squint, 2 drowsy, 3 surprise
+//   CMD_MODE    render mode (u8): 0 RENDER_FULL, 1 RENDER_HALF_X,
+//               2 RENDER_HALF (see setRenderMode() in main.cpp)
+//
+// cmdParse() takes one byte at a time with no allocation, so it can be fed
+// from whatever is available on the port between frames.  Printable bytes
+// outside a packet are handed back for the single-character debug
+// commands, except within CMD_QUIET bytes of a packet with a bad length
+// or check byte or of any other binary byte: those are most likely the
+// rest of a damaged or misaligned packet, or line noise, and mustn't turn
+// into a 'T' or 'r'.  Whitespace (a terminal's line ends) is ignored.
+// tools/eyecmd uses cmdEncode() to build packets on the host.
+
+#pragma once
+
+#include <stdint.h>
+
+#define CMD_MAGIC   0xE7
+#define CMD_HEADER  8    // cmd, len, seq, host time
+#define CMD_PAYLOAD 8    // Longest payload
+#define CMD_QUIET   (CMD_HEADER + CMD_PAYLOAD + 2) // Longest packet
+
+#define CMD_GAZE    1
+#define CMD_IRIS    2
+#define CMD_BLINK   3
+#define CMD_SELECT  4
+#define CMD_EXPR    5
+#define CMD_MODE    6
+
+#define ANIM_EYES   0    // Rendered eyes (default)
+#define ANIM_DEMO_2 1    // Demo_2() sprite loop, both panels the same
+#define ANIM_DEMO_3 2    // Demo_3() sprite loop, A and B sets
+
+typedef struct {
+  uint8_t  cmd;
+  uint8_t  len;
+  uint16_t seq;
+  uint32_t hostTime;
+  uint8_t  payload[CMD_PAYLOAD];
+} cmdPacket_t;
+
+typedef struct {
+  uint8_t     pos;       // Bytes after CMD_MAGIC so far, 0 = idle
+  uint8_t     sum;
+  uint8_t     quiet;     // Bytes left that can't be debug commands
+  uint8_t     raw[CMD_HEADER + CMD_PAYLOAD];
+  cmdPacket_t pkt;       // Last complete packet
+} cmdParser_t;
+
+#define CMD_NONE    0    // Byte consumed, no packet yet
+#define CMD_READY   1    // parser->pkt holds a new packet
+#define CMD_OTHER   2    // Printable byte outside a packet: a debug command
+
+// Feed one received byte
+static inline uint8_t cmdParse(cmdParser_t *p, uint8_t c) {
+  if (!p->pos) {
+    if (c == CMD_MAGIC) {
+      p->pos = 1;
+      p->sum = 0;
+      return CMD_NONE;
+    }
+    if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n')) return CMD_NONE;
+    if ((c < ' ') || (c > '~')) { // Binary, not typed
+      p->quiet = CMD_QUIET;
+      return CMD_NONE;
+    }
+    if (p->quiet) {
+      p->quiet--;
+      return CMD_NONE;
+    }
+    return CMD_OTHER;
+  }
+  uint8_t i = p->pos - 1; // Index into raw[]
+  if ((i < CMD_HEADER) || (i < CMD_HEADER + p->raw[1])) {
+    if ((i == 1) && (c > CMD_PAYLOAD)) { // Bad length, resynchronise
+      p->pos   = 0;
+      p->quiet = CMD_QUIET;
+      return CMD_NONE;
+    }
+    p->raw[i] = c;
+    p->sum   += c;
+    p->pos++;
+    return CMD_NONE;
+  }
+  p->pos = 0;             // c is the check byte
+  if (c != p->sum) {
+    p->quiet = CMD_QUIET;
+    return CMD_NONE;
+  }
+  p->quiet        = 0;    // In step again
+  p->pkt.cmd      = p->raw[0];
+  p->pkt.len      = p->raw[1];
+  p->pkt.seq      = p->raw[2] | p->raw[3] << 8;
+  p->pkt.hostTime = p->raw[4] | p->raw[5] << 8 | (uint32_t)p->raw[6] << 16 |
+                    (uint32_t)p->raw[7] << 24;
+  for (i = 0; i < p->pkt.len; i++) p->pkt.payload[i] = p->raw[CMD_HEADER + i];
+  return CMD_READY;
+}
+
+// Little-endian payload fields
+static inline int16_t cmdI16(const cmdPacket_t *p, uint8_t offset) {
+  return (int16_t)(p->payload[offset] | p->payload[offset + 1] << 8);
+}
+
+// Build a packet into out (at least CMD_HEADER + CMD_PAYLOAD + 2 bytes),
+// returns its length
+static inline uint32_t cmdEncode(uint8_t *out, uint8_t cmd, uint16_t seq, uint32_t hostTime,
+                                 const uint8_t *payload, uint8_t len) {
+  uint32_t n = 0;
+  uint8_t  sum = 0;
+  out[n++] = CMD_MAGIC;
+  out[n++] = cmd;
+  out[n++] = len;
+  out[n++] = seq;
+  out[n++] = seq >> 8;
+  for (uint8_t i = 0; i < 4; i++) out[n++] = hostTime >> (8 * i);
+  for (uint8_t i = 0; i < len; i++) out[n++] = payload[i];
+  for (uint32_t i = 1; i < n; i++) sum += out[i];
+  out[n++] = sum;
+  return n;
+}
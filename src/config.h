@@ -24,38 +24,89 @@
 //#include "data/doeEye.h"        // Cartoon deer eye (DISABLE TRACKING)
 
 // DISPLAY HARDWARE SETTINGS (screen type & connections) -------------------
-#define TFT_COUNT 2        // Number of screens (1 or 2)
+#define TFT_COUNT NUM_EYES // Number of screens, one per eye
 #define TFT1_CS  2         // TFT 1 chip select pin (set to -1 to use TFT_eSPI setup)
 #define TFT2_CS  6       // TFT 2 chip select pin (set to -1 to use TFT_eSPI setup)
 #define TFT_1_ROT 1        // TFT 1 rotation
 #define TFT_2_ROT 3        // TFT 2 rotation
-#define EYE_1_XPOSITION  20 // x shift for eye 1 image on display
-#define EYE_2_XPOSITION  20 // x shift for eye 2 image on display
+#define EYE_SIZE      128  // Rendered eye size: 128, or 160 to fill the whole
+                           // 160x160 panel (eye artwork magnified 1.25x)
+#define EYE_WIDTH  EYE_SIZE
+#define EYE_HEIGHT EYE_SIZE
+#if (EYE_SIZE == 160)
+  #define EYE_1_XPOSITION  0 // x shift for eye 1 image on display
+  #define EYE_2_XPOSITION  0 // x shift for eye 2 image on display
+#else
+  #define EYE_1_XPOSITION  20 // x shift for eye 1 image on display
+  #define EYE_2_XPOSITION  20 // x shift for eye 2 image on display
+#endif
+//#define COLOR_12BIT        // Send 12-bit RGB444 pixels (2 per 3 bytes) instead
+                           // of RGB565, cuts SPI bytes per frame by 25%
+
+#define RENDER_MODE RENDER_FULL // Initial eye resolution: RENDER_FULL, or
+                           // RENDER_HALF_X / RENDER_HALF to compute 1/2 or
+                           // 1/4 of the pixels and upscale 2x (low power)
+
+//#define PROFILE            // Cycle counts per pipeline stage, send 'p' over
+                           // serial for a per-frame breakdown (profiler.h)
+#define FRAME_STATS          // Per-eye frame time histograms, send 'h' over
+                           // serial for p50/p99, 'r' to reset (frameStats.h)
+//#define LATENCY            // Input-to-photon latency per eye, send 'l' over
+                           // serial for p50/p99 (latency.h)
+#define LOG_LEVEL LOG_LEVEL_INFO // Binary log records kept: LOG_LEVEL_NONE,
+                           // _ERROR, _INFO or _DEBUG (log.h, tools/logdecode)
+//#define HUD                // FPS, frame-time p99 and SPI load drawn left of
+                           // the eye (hud.h), needs EYE_1_XPOSITION >= 20
+//#define AUTOTUNE           // Time push chunk sizes (and SPI clocks with
+                           // PANEL_IDF) at first boot, keep the fastest in
+                           // NVS, send 'T' to tune again (tuner.h)
+//#define GOVERNOR           // Slow frames down and rest the CPU while the eye
+                           // holds still, send 'g' over serial for active/
+                           // idle time and a current estimate (governor.h)
+//#define GOV_LIGHT_SLEEP    // With GOVERNOR: light sleep between slow frames
+                           // (USB serial drops out while asleep)
+//#define DEADLINE 30        // Frames/s per eye to hold: frames predicted to
+                           // miss it render at reduced resolution or are
+                           // skipped, send 'd' for counts (deadline.h)
+//#define CROSSFADE 400      // ms to cross-fade between eyes and sprite demos
+                           // when CMD_SELECT switches (crossfade.h)
 
 #define DISPLAY_BACKLIGHT  -1 // Pin for backlight control (-1 for none)
 #define BACKLIGHT_MAX    255
 
 // EYE LIST ----------------------------------------------------------------
-#define NUM_EYES 2 // Number of eyes to display (1 or 2)
+#define NUM_EYES 2 // Number of eyes to display (1 to 8, one panel each)
 
 #define BLINK_PIN   -1 // Pin for manual blink button (BOTH eyes)
 #define LH_WINK_PIN -1 // Left wink pin (set to -1 for no pin)
 #define RH_WINK_PIN -1 // Right wink pin (set to -1 for no pin)
 
 // This table contains ONE LINE PER EYE.  The table MUST be present with
-// this name and contain ONE OR MORE lines.  Each line contains THREE items:
+// this name and contain NUM_EYES lines.  Each line contains SIX items:
 // a pin number for the corresponding TFT/OLED display's SELECT line, a pin
 // pin number for that eye's "wink" button (or -1 if not used), a screen
-// rotation value (0-3) and x position offset for that eye.
+// rotation value (0-3), x position offset for that eye, whether its eyelids
+// are mirrored (true for a left eye) and a convergence offset added to its
+// gaze X (negative for a left eye, so a pair looks slightly crossed).
+// All panels share the SPI bus, each with its own SELECT line (at most 6
+// with PANEL_IDF, the C3's hardware chip selects).
 
-#if (NUM_EYES == 2)
+#if (NUM_EYES > 2)
+  // Multi-eyed props: pairs of left/right eyes, extend to NUM_EYES lines
+  eyeInfo_t eyeInfo[] = {
+    { TFT1_CS, -1, TFT_1_ROT, EYE_1_XPOSITION, true,  -4 }, // Pair 1 left
+    { TFT2_CS, -1, TFT_2_ROT, EYE_2_XPOSITION, false,  4 }, // Pair 1 right
+    { 7,       -1, TFT_1_ROT, EYE_1_XPOSITION, true,  -4 }, // Pair 2 left
+    { 10,      -1, TFT_2_ROT, EYE_2_XPOSITION, false,  4 }, // Pair 2 right
+  };
+#elif (NUM_EYES == 2)
   eyeInfo_t eyeInfo[] = {
-    { TFT1_CS, LH_WINK_PIN, TFT_1_ROT, EYE_1_XPOSITION }, // LEFT EYE chip select and wink pins, rotation and offset
-    { TFT2_CS, RH_WINK_PIN, TFT_2_ROT, EYE_2_XPOSITION }, // RIGHT EYE chip select and wink pins, rotation and offset
+    { TFT1_CS, LH_WINK_PIN, TFT_1_ROT, EYE_1_XPOSITION, true,  -4 }, // LEFT EYE chip select and wink pins, rotation, offset, mirror, convergence
+    { TFT2_CS, RH_WINK_PIN, TFT_2_ROT, EYE_2_XPOSITION, false,  4 }, // RIGHT EYE chip select and wink pins, rotation, offset, mirror, convergence
   };
 #else
   eyeInfo_t eyeInfo[] = {
-    { TFT1_CS, LH_WINK_PIN, TFT_1_ROT, EYE_1_XPOSITION }, // EYE chip select and wink pins, rotation and offset
+    { TFT1_CS, LH_WINK_PIN, TFT_1_ROT, EYE_1_XPOSITION, true, 0 }, // EYE chip select and wink pins, rotation, offset, mirror, convergence
   };
 #endif
 
@@ -0,0 +1,75 @@
+// RGB565 cross-fade, two pixels per 32-bit operation.
+//
+// A 32-bit word holds two 565 pixels.  Masking it two ways leaves three
+// fields in each half with at least 5 free bits above every field:
+//
+//   w        & 0x07E0F81F   B0 at 0, R0 at 11, G1 at 21
+//   (w >> 5) & 0x07C0F83F   G0 at 0, B1 at 11, R1 at 22
+//
+// so a*(32-alpha) + b*alpha can be summed for all three fields with one
+// multiply per source and no carries between fields.  A shift by 5 and the
+// same masks put the blended fields back.  alpha is 0-32, the weight of b.
+// That is about 15 instructions per pixel pair, plus the byte swaps for
+// sources in wire order, with no per-pixel branches or divides.
+//
+// The gImage_* sprites are in wire byte order.  The push buffer is too,
+// except in 12-bit mode with unswapped eye tables, where pack444() expects
+// native order (see PIXEL_OUT in pixelFormat.h).  xfade565<A_WIRE>() reads
+// a in wire order (A_WIRE) or buffer order, b always in wire order, and
+// writes dst in buffer order; dst may be a.  All three must be 4-byte
+// aligned and n even.
+//
+// Include after config.h.
+
+#pragma once
+
+#include <stdint.h>
+
+#define XF_SPRITE 160 // gImage_* sprites are XF_SPRITE x XF_SPRITE
+#define XF_ONE    32  // alpha for b only
+
+#if defined(COLOR_12BIT) && !defined(EYE_ASSET_SWAPPED)
+  #define XF_BUFFER_WIRE false
+#else
+  #define XF_BUFFER_WIRE true
+#endif
+
+// Swap the bytes of both pixels in w
+static inline uint32_t xfadeSwap(uint32_t w) {
+  return ((w >> 8) & 0x00FF00FF) | ((w & 0x00FF00FF) << 8);
+}
+
+template <bool A_WIRE>
+static inline void xfade565(uint16_t *dst, const uint16_t *a, const uint16_t *b,
+                            uint32_t n, uint32_t alpha) {
+  const uint32_t *pa = (const uint32_t *)a, *pb = (const uint32_t *)b;
+  uint32_t       *pd = (uint32_t *)dst;
+  const uint32_t  ia = XF_ONE - alpha;
+  for (n >>= 1; n; n--) {
+    uint32_t x = *pa++, y = xfadeSwap(*pb++);
+    if (A_WIRE || XF_BUFFER_WIRE) x = xfadeSwap(x);
+    uint32_t lo = ((x & 0x07E0F81F) * ia + (y & 0x07E0F81F) * alpha) >> 5;
+    uint32_t hi = (((x >> 5) & 0x07C0F83F) * ia + ((y >> 5) & 0x07C0F83F) * alpha) >> 5;
+    uint32_t p  = (lo & 0x07E0F81F) | (hi & 0x07C0F83F) << 5;
+    *pd++ = XF_BUFFER_WIRE ? xfadeSwap(p) : p;
+  }
+}
+
+// Transition between two CMD_SELECT animations.  For each panel, from and
+// to are the sprites shown before and after, nullptr for the rendered eye.
+typedef struct {
+  bool            active;
+  uint8_t         next;            // Animation faded to
+  uint32_t        start;           // micros()
+  const uint16_t *from[NUM_EYES];
+  const uint16_t *to[NUM_EYES];
+  uint8_t         eyeAlpha;        // Weight of eyeSprite[] in drawEye(), 0 = off
+  const uint16_t *eyeSprite[NUM_EYES];
+  uint32_t        frames;          // Drawn during this transition
+} xfade_t;
+
+// alpha at time t of a transition lasting us
+static inline uint32_t xfadeAlpha(const xfade_t *f, uint32_t t, uint32_t us) {
+  uint32_t dt = t - f->start;
+  return (dt >= us) ? XF_ONE : (uint64_t)dt * XF_ONE / us;
+}
@@ -0,0 +1,16 @@
+// Generated by tools/assetc -- the arrays are linked in from EYEA/*.bin by EYEA.S
+
+#pragma once
+
+extern const uint16_t gImage_A1[25600] asm("EYEA_gImage_A1");
+extern const uint16_t gImage_A2[25600] asm("EYEA_gImage_A2");
+extern const uint16_t gImage_A3[25600] asm("EYEA_gImage_A3");
+extern const uint16_t gImage_A4[25600] asm("EYEA_gImage_A4");
+extern const uint16_t gImage_A5[25600] asm("EYEA_gImage_A5");
+extern const uint16_t gImage_A6[25600] asm("EYEA_gImage_A6");
+extern const uint16_t gImage_A7[25600] asm("EYEA_gImage_A7");
+extern const uint16_t gImage_A8[25600] asm("EYEA_gImage_A8");
+extern const uint16_t gImage_A9[25600] asm("EYEA_gImage_A9");
+extern const uint16_t gImage_A10[25600] asm("EYEA_gImage_A10");
+extern const uint16_t gImage_A11[25600] asm("EYEA_gImage_A11");
+extern const uint16_t gImage_A12[25600] asm("EYEA_gImage_A12");
@@ -0,0 +1,16 @@
+// Generated by tools/assetc -- the arrays are linked in from EYEB/*.bin by EYEB.S
+
+#pragma once
+
+extern const uint16_t gImage_B1[25600] asm("EYEB_gImage_B1");
+extern const uint16_t gImage_B2[25600] asm("EYEB_gImage_B2");
+extern const uint16_t gImage_B3[25600] asm("EYEB_gImage_B3");
+extern const uint16_t gImage_B4[25600] asm("EYEB_gImage_B4");
+extern const uint16_t gImage_B5[25600] asm("EYEB_gImage_B5");
+extern const uint16_t gImage_B6[25600] asm("EYEB_gImage_B6");
+extern const uint16_t gImage_B7[25600] asm("EYEB_gImage_B7");
+extern const uint16_t gImage_B8[25600] asm("EYEB_gImage_B8");
+extern const uint16_t gImage_B9[25600] asm("EYEB_gImage_B9");
+extern const uint16_t gImage_B10[25600] asm("EYEB_gImage_B10");
+extern const uint16_t gImage_B11[25600] asm("EYEB_gImage_B11");
+extern const uint16_t gImage_B12[25600] asm("EYEB_gImage_B12");
@@ -1,13349 +1,27 @@
+// Generated by tools/assetc -- the tables are linked in from defaultEye/*.bin by defaultEye.S
+
 #define SCLERA_WIDTH  200
 #define SCLERA_HEIGHT 200
 
-const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] PROGMEM= {
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X6902, 0X6902, 0X7102,
-  0X7122, 0X7122, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7142,
-  0X7142, 0X7142, 0X7143, 0X7162, 0X7963, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7983, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7983, 0X7963, 0X7963, 0X7963, 0X7963, 0X7983,
-  0X7983, 0X7983, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7163, 0X7163, 0X7142, 0X7142, 0X7142,
-  0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7122, 0X7122,
-  0X7102, 0X6902, 0X6902, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X6902, 0X7102, 0X7122, 0X7122, 0X7122,
-  0X7122, 0X7142, 0X7142, 0X7142, 0X7142, 0X7163, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X7983,
-  0X7983, 0X7983, 0X7983, 0X79A3, 0X79A3, 0X79A3, 0X79A3, 0X7983,
-  0X7983, 0X7983, 0X79A3, 0X79A3, 0X79A3, 0X79A3, 0X7983, 0X7983,
-  0X79A3, 0X79A3, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983,
-  0X7983, 0X7983, 0X7983, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7163, 0X7142, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122,
-  0X7122, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X6902, 0X7102, 0X7102, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142,
-  0X7142, 0X7162, 0X7963, 0X7963, 0X7963, 0X7963, 0X7983, 0X7983,
-  0X7983, 0X7983, 0X79A3, 0X79A3, 0X79A3, 0X79A4, 0X79A4, 0X79A4,
-  0X79A4, 0X79C4, 0X79C4, 0X79C4, 0X79C4, 0X81C4, 0X79C4, 0X79A4,
-  0X81A4, 0X81A4, 0X81C4, 0X81C4, 0X81C4, 0X81C4, 0X81C4, 0X79C4,
-  0X81C4, 0X81C4, 0X81C4, 0X79A4, 0X79C4, 0X79A4, 0X79A4, 0X79A4,
-  0X79A4, 0X79A4, 0X79A3, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7142, 0X7142, 0X7142,
-  0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7122, 0X7122, 0X7102,
-  0X6902, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7102,
-  0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7142, 0X7143, 0X7963,
-  0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X79A4, 0X79A4, 0X79A4,
-  0X79A4, 0X79C4, 0X81C4, 0X81C4, 0X81C4, 0X81C4, 0X81C4, 0X81C4,
-  0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X81E5, 0X81E4, 0X81E4, 0X81E4,
-  0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4,
-  0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81C4,
-  0X81C4, 0X81C4, 0X81C4, 0X79C4, 0X79A4, 0X79A4, 0X79A4, 0X79A3,
-  0X79A3, 0X7983, 0X7983, 0X7983, 0X7963, 0X7963, 0X7963, 0X7142,
-  0X7142, 0X7142, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122,
-  0X7122, 0X7102, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X6902, 0X7102, 0X7102, 0X7102, 0X7122, 0X7122,
-  0X7122, 0X7142, 0X7142, 0X7163, 0X7963, 0X7963, 0X7963, 0X7983,
-  0X7983, 0X79A4, 0X79A4, 0X79A4, 0X79C4, 0X81C4, 0X81C4, 0X81E4,
-  0X81E4, 0X81E4, 0X81E5, 0X81E5, 0X81E5, 0X8205, 0X8205, 0X8205,
-  0X81E5, 0X8205, 0X8205, 0X8205, 0X8205, 0X8205, 0X8205, 0X8205,
-  0X8204, 0X8205, 0X8205, 0X8225, 0X8205, 0X8205, 0X8205, 0X8205,
-  0X8205, 0X8205, 0X8205, 0X81E4, 0X8205, 0X8205, 0X8205, 0X8205,
-  0X81E5, 0X81E5, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X81C4, 0X81C4,
-  0X81C4, 0X79A4, 0X79A3, 0X79A3, 0X79A3, 0X7983, 0X7983, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7163, 0X7162, 0X7142, 0X7142, 0X7142,
-  0X7122, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X6902, 0X7102, 0X7102, 0X7122, 0X7122, 0X7122, 0X7122, 0X7142,
-  0X7142, 0X7963, 0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X79A4,
-  0X79A4, 0X81C4, 0X81C4, 0X81E4, 0X81E4, 0X81E5, 0X81E5, 0X8205,
-  0X8205, 0X8205, 0X8205, 0X8A25, 0X8225, 0X8225, 0X8A25, 0X8A25,
-  0X8A25, 0X8A25, 0X8A46, 0X8A46, 0X8A46, 0X8A45, 0X8A25, 0X8A25,
-  0X8A25, 0X8A25, 0X8A45, 0X8A46, 0X8A46, 0X8A46, 0X8A46, 0X8A46,
-  0X8A46, 0X8A45, 0X8A25, 0X8A05, 0X8A25, 0X8A25, 0X8A25, 0X8A25,
-  0X8205, 0X8205, 0X8205, 0X8205, 0X8205, 0X8205, 0X81E4, 0X81E4,
-  0X81E4, 0X81E4, 0X81C4, 0X81C4, 0X81A4, 0X79A4, 0X79A3, 0X7983,
-  0X7983, 0X7983, 0X7983, 0X7963, 0X7963, 0X7963, 0X7962, 0X7142,
-  0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7142, 0X7142,
-  0X7963, 0X7963, 0X7983, 0X7984, 0X79A4, 0X79A4, 0X79C4, 0X81C4,
-  0X81E4, 0X81E5, 0X81E5, 0X8205, 0X8205, 0X8205, 0X8205, 0X8225,
-  0X8A25, 0X8A26, 0X8A46, 0X8A46, 0X8A46, 0X8A46, 0X8A46, 0X8A46,
-  0X8A46, 0X8A46, 0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A66,
-  0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A66,
-  0X8A66, 0X8A66, 0X8A66, 0X8A45, 0X8A45, 0X8A66, 0X8A66, 0X8A46,
-  0X8A45, 0X8A45, 0X8A46, 0X8A46, 0X8A25, 0X8225, 0X8205, 0X8205,
-  0X8205, 0X8205, 0X81E4, 0X81C4, 0X81C4, 0X81C4, 0X81C4, 0X81A4,
-  0X79A4, 0X79A4, 0X79A3, 0X7983, 0X7983, 0X7983, 0X7963, 0X7963,
-  0X7963, 0X7162, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7122,
-  0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7122, 0X7142, 0X7142, 0X7142, 0X7943, 0X7963, 0X7943, 0X7963,
-  0X7983, 0X79A3, 0X79A4, 0X81C4, 0X81C4, 0X81C4, 0X81E4, 0X8205,
-  0X8205, 0X8205, 0X8225, 0X8A25, 0X8A26, 0X8A46, 0X8A46, 0X8A46,
-  0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A87, 0X8A86, 0X8A86, 0X9287,
-  0X9287, 0X9286, 0X9286, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7,
-  0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7,
-  0X92A7, 0X92A7, 0X92A7, 0X8A66, 0X8A66, 0X9286, 0X9287, 0X9287,
-  0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A66, 0X8A46, 0X8A25, 0X8A25,
-  0X8A25, 0X8A25, 0X8205, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X81C4,
-  0X81E4, 0X81C4, 0X79A4, 0X79A4, 0X79A4, 0X7983, 0X7983, 0X7983,
-  0X7963, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122,
-  0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7122, 0X7142,
-  0X7142, 0X7163, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7984,
-  0X79C4, 0X81C4, 0X81E4, 0X81E5, 0X8205, 0X81E5, 0X8205, 0X8225,
-  0X8A25, 0X8A46, 0X8A46, 0X8A46, 0X8A66, 0X8A66, 0X8A66, 0X9287,
-  0X9287, 0X9287, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7,
-  0X92A7, 0X92C7, 0X92A7, 0X92C8, 0X92C8, 0X92C8, 0X92C8, 0X92C8,
-  0X92C8, 0X92C8, 0X92C8, 0X92E8, 0X92C8, 0X92C8, 0X92C8, 0X92C8,
-  0X92C8, 0X92C8, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X92A7,
-  0X92A7, 0X9287, 0X9287, 0X92A7, 0X8A87, 0X8A66, 0X8A66, 0X8A66,
-  0X8A66, 0X8A46, 0X8A25, 0X8A25, 0X8A05, 0X81E4, 0X81E5, 0X8205,
-  0X8205, 0X81E4, 0X81C4, 0X81C4, 0X81C4, 0X81A4, 0X79A4, 0X79A3,
-  0X7983, 0X7983, 0X7963, 0X7942, 0X7142, 0X7142, 0X7142, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7102, 0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7142,
-  0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X7963, 0X7983, 0X81C4,
-  0X81E4, 0X81E5, 0X8205, 0X8205, 0X8205, 0X8205, 0X8A26, 0X8A46,
-  0X8A46, 0X8A66, 0X8A66, 0X9287, 0X9287, 0X9287, 0X92A7, 0X92A7,
-  0X92A7, 0X92C7, 0X92C8, 0X92C8, 0X92C8, 0X9AE8, 0X92C7, 0X92C7,
-  0X9AE8, 0X9AE8, 0X9AE8, 0X9AE8, 0X9B08, 0X9B08, 0X9B09, 0X9B08,
-  0X9B08, 0X9B08, 0X9AE8, 0X9B08, 0X9B08, 0X9B08, 0X9B08, 0X9B08,
-  0X9B08, 0X9AE8, 0X9AE8, 0X9AE8, 0X92C7, 0X92C7, 0X9AE8, 0X92E8,
-  0X92C7, 0X92C7, 0X92C7, 0X92C7, 0X92A7, 0X92A7, 0X9287, 0X8A87,
-  0X8A87, 0X8A86, 0X8A66, 0X8A46, 0X8A25, 0X8A05, 0X8A05, 0X8A05,
-  0X8A05, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X81C4, 0X81C4,
-  0X81A4, 0X7983, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7163,
-  0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7102, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7963,
-  0X7983, 0X7983, 0X79A4, 0X79A4, 0X79A4, 0X7983, 0X81A3, 0X81E4,
-  0X8205, 0X8205, 0X8A25, 0X8A46, 0X8A46, 0X8A26, 0X8A66, 0X8A66,
-  0X9287, 0X9287, 0X92A7, 0X92A7, 0X92A7, 0X92C7, 0X92C8, 0X9AC8,
-  0X9AE8, 0X9AE8, 0X9AE8, 0X9B08, 0X9B08, 0X9B08, 0X9B08, 0X9B08,
-  0X9B09, 0X9B29, 0X9B09, 0X9B08, 0X9B29, 0X9B29, 0X9B49, 0X9B29,
-  0X9B29, 0X9B29, 0X9B29, 0X9B29, 0X9B29, 0X9B29, 0X9B29, 0X9B29,
-  0X9B28, 0X9B08, 0X9B08, 0X9B08, 0X9AE8, 0X9AE8, 0X9B08, 0X9B08,
-  0X9B08, 0X9AE8, 0X9AE8, 0X9AE8, 0X92E8, 0X92C7, 0X92C7, 0X92A7,
-  0X92A7, 0X92A7, 0X9286, 0X8A66, 0X9246, 0X8A25, 0X8A04, 0X8A04,
-  0X8A05, 0X8A25, 0X8A05, 0X8A05, 0X8205, 0X8204, 0X81E4, 0X81E4,
-  0X81A3, 0X7983, 0X79A3, 0X79A3, 0X7983, 0X7983, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122,
-  0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122,
-  0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7963, 0X7983, 0X7983,
-  0X79A4, 0X79C4, 0X81C4, 0X81E4, 0X81E4, 0X81A4, 0X8183, 0X8205,
-  0X8A25, 0X8A46, 0X8A46, 0X8A66, 0X8A66, 0X8A46, 0X9287, 0X92A7,
-  0X92A7, 0X92C7, 0X92C8, 0X92C8, 0X9AE8, 0X9AE8, 0X9AE8, 0X9B08,
-  0X9B09, 0X9B09, 0X9B29, 0X9B29, 0X9B29, 0X9B29, 0XA349, 0X9B29,
-  0X9B49, 0XA349, 0XA34A, 0X9B29, 0XA349, 0XA36A, 0XA36A, 0XA36A,
-  0XA36A, 0XA36A, 0XA36A, 0XA36A, 0XA36A, 0XA36A, 0XA36A, 0XA369,
-  0XA369, 0XA349, 0X9B29, 0XA349, 0X9B29, 0X9B08, 0X9B49, 0X9B49,
-  0X9B29, 0X9B08, 0X9B08, 0X9B08, 0X9B08, 0X9B08, 0X9AE8, 0X9AE8,
-  0X92E7, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X9265, 0X8A25, 0X8A25,
-  0X8A46, 0X8A46, 0X8A46, 0X8A25, 0X8A25, 0X8A25, 0X8205, 0X81E4,
-  0X81C4, 0X81C4, 0X81E4, 0X81C4, 0X81C4, 0X79A3, 0X7983, 0X7983,
-  0X7963, 0X7963, 0X7963, 0X7962, 0X7142, 0X7142, 0X7142, 0X7122,
-  0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7122,
-  0X7142, 0X7142, 0X7963, 0X7963, 0X7963, 0X7983, 0X79A4, 0X79A4,
-  0X81C4, 0X81E4, 0X81E5, 0X8205, 0X8205, 0X81E4, 0X81A4, 0X8A05,
-  0X8A66, 0X8A66, 0X9287, 0X9287, 0X9287, 0X9287, 0X92C8, 0X92C8,
-  0X9AE8, 0X9AE8, 0X9AE8, 0X9B08, 0X9B09, 0X9B29, 0X9B29, 0X9B29,
-  0X9B49, 0XA349, 0XA34A, 0XA349, 0XA369, 0XA36A, 0XA36A, 0XA36A,
-  0XA36A, 0XA36A, 0XA38A, 0XA36A, 0XA369, 0XA38A, 0XA3AB, 0XA3AA,
-  0XABAA, 0XA3AA, 0XA3AA, 0XA38A, 0XA38A, 0XA38A, 0XA38A, 0XA38A,
-  0XA38A, 0XA38A, 0XA369, 0XA369, 0XA349, 0XA329, 0XA369, 0XA36A,
-  0XA349, 0XA329, 0X9B29, 0X9B49, 0X9B49, 0X9B29, 0X9B29, 0X9B28,
-  0X9AE8, 0X9AE7, 0X92E8, 0X92C8, 0X92C7, 0X9286, 0X9266, 0X9266,
-  0X9287, 0X8A87, 0X8A66, 0X8A66, 0X8A46, 0X8A45, 0X8A25, 0X8A05,
-  0X8205, 0X8205, 0X8205, 0X81E4, 0X81E4, 0X81C4, 0X79A3, 0X7983,
-  0X7983, 0X7983, 0X7963, 0X7963, 0X7963, 0X7963, 0X7163, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7142, 0X7142,
-  0X7963, 0X7963, 0X7963, 0X7983, 0X79A3, 0X79A3, 0X79C4, 0X81E4,
-  0X81E4, 0X8205, 0X8205, 0X8A25, 0X8A46, 0X8A25, 0X89C4, 0X89E5,
-  0X9266, 0X92A7, 0X92A7, 0X92C7, 0X92A7, 0X92A7, 0X9AE8, 0X9B08,
-  0X9B09, 0X9B09, 0X9B29, 0X9B29, 0XA349, 0XA349, 0XA34A, 0XA36A,
-  0XA36A, 0XA36A, 0XA38A, 0XA38A, 0XA38A, 0XA3AB, 0XABAB, 0XABAB,
-  0XA38A, 0XABAB, 0XABCB, 0XABCB, 0XABAA, 0XABAA, 0XABCB, 0XABCB,
-  0XABCA, 0XABCB, 0XABCB, 0XABCB, 0XABCB, 0XABCB, 0XABCB, 0XABCB,
-  0XABCB, 0XABCB, 0XABAA, 0XABAA, 0XA38A, 0XA349, 0XA36A, 0XABAA,
-  0XA38A, 0XA36A, 0XA36A, 0XA36A, 0XA36A, 0XA369, 0XA349, 0XA349,
-  0X9B28, 0X9B08, 0X9B08, 0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X9286,
-  0X92A7, 0X92A7, 0X92A7, 0X9266, 0X8A66, 0X8A46, 0X8A25, 0X8A25,
-  0X8A45, 0X8A25, 0X8225, 0X8205, 0X8205, 0X81C4, 0X81A3, 0X81A3,
-  0X79A3, 0X79A3, 0X7983, 0X7963, 0X7983, 0X7983, 0X7963, 0X7963,
-  0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7163, 0X7963,
-  0X7963, 0X7983, 0X7983, 0X79A4, 0X79C4, 0X81C4, 0X81C4, 0X81E5,
-  0X8205, 0X8A25, 0X8A46, 0X8A46, 0X8A66, 0X8A66, 0X8A05, 0X89C4,
-  0X9266, 0X92C8, 0X92C8, 0X9AE8, 0X92C7, 0X9AC8, 0X9B29, 0X9B29,
-  0X9B29, 0XA349, 0XA349, 0XA36A, 0XA36A, 0XA36A, 0XA38A, 0XA38A,
-  0XABAB, 0XABAB, 0XABAB, 0XABAB, 0XABCB, 0XABCB, 0XABCB, 0XABEC,
-  0XABCB, 0XABCA, 0XABCA, 0XABCA, 0XABEB, 0XABCB, 0XABEB, 0XAC0C,
-  0XABEC, 0XAC0C, 0XABEC, 0XABEC, 0XB40C, 0XABEB, 0XABEB, 0XABEC,
-  0XAC0C, 0XABEB, 0XABCB, 0XABCB, 0XABCB, 0XAB8A, 0XAB8A, 0XABCB,
-  0XABCB, 0XAB8A, 0XA38A, 0XA3AB, 0XA38A, 0XA38A, 0XA38A, 0XA369,
-  0XA369, 0XA349, 0X9B29, 0X9B29, 0X9B08, 0X9B08, 0X9AE8, 0X92C7,
-  0X92A7, 0X92C7, 0X92C7, 0X9287, 0X9286, 0X9286, 0X9266, 0X8A66,
-  0X8A66, 0X8A46, 0X8A46, 0X8A25, 0X8A25, 0X8A05, 0X81C4, 0X81C4,
-  0X81C4, 0X81C4, 0X79A3, 0X7983, 0X79A3, 0X7983, 0X7983, 0X7963,
-  0X7963, 0X7163, 0X7142, 0X7142, 0X7122, 0X7122, 0X7102, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7102, 0X7122, 0X7122, 0X7142, 0X7143, 0X7963, 0X7963, 0X7963,
-  0X7983, 0X79A4, 0X79C4, 0X81C4, 0X81E4, 0X81E5, 0X81E4, 0X8205,
-  0X8A46, 0X8A46, 0X8A66, 0X8A87, 0X9286, 0X9286, 0X9286, 0X9205,
-  0X9245, 0X9AE8, 0X9B08, 0X9B09, 0X9AE8, 0X9B08, 0X9B49, 0XA349,
-  0XA36A, 0XA36A, 0XA38A, 0XA38A, 0XA3AA, 0XA3AB, 0XABAB, 0XABCB,
-  0XABCB, 0XABEC, 0XABEB, 0XABEC, 0XABEC, 0XAC0C, 0XB40C, 0XB40C,
-  0XB3EB, 0XABCA, 0XB3EB, 0XB3EB, 0XB40C, 0XB40C, 0XB40C, 0XB42C,
-  0XB42C, 0XB42C, 0XB42C, 0XB42D, 0XB42D, 0XB42C, 0XB42C, 0XB42D,
-  0XB42D, 0XB42C, 0XB40B, 0XB40C, 0XB40C, 0XABCB, 0XAB8A, 0XABCA,
-  0XABEB, 0XABCB, 0XABCB, 0XABEB, 0XABCB, 0XABCB, 0XA3AA, 0XA38A,
-  0XA38A, 0XA38A, 0XA36A, 0XA349, 0X9B49, 0X9B29, 0X9B28, 0X9B08,
-  0X9AE8, 0X9AE8, 0X9AE8, 0X9AC7, 0X92A7, 0X92A7, 0X92A7, 0X9287,
-  0X9286, 0X8A66, 0X8A66, 0X8A66, 0X8A45, 0X8A25, 0X8A05, 0X81E4,
-  0X81E4, 0X81E4, 0X81C4, 0X79A3, 0X79A4, 0X79A3, 0X79A3, 0X7983,
-  0X7983, 0X7963, 0X7963, 0X7143, 0X7142, 0X7142, 0X7122, 0X7122,
-  0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122,
-  0X7122, 0X7142, 0X7142, 0X7163, 0X7963, 0X7963, 0X7983, 0X79A3,
-  0X79A4, 0X81C4, 0X81E4, 0X81E5, 0X8205, 0X8225, 0X8A05, 0X8A26,
-  0X8A66, 0X8A86, 0X9287, 0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X9205,
-  0X9246, 0X9B08, 0X9B29, 0X9B49, 0X9AE8, 0XA329, 0XA36A, 0XA36A,
-  0XA38A, 0XA3AB, 0XABAB, 0XABCB, 0XABCB, 0XABEB, 0XABEC, 0XABEC,
-  0XAC0C, 0XAC0C, 0XB40C, 0XB42C, 0XB42D, 0XB42D, 0XB42D, 0XB44C,
-  0XB40B, 0XB42C, 0XB42D, 0XB44D, 0XB44D, 0XB44D, 0XB42C, 0XB46D,
-  0XBC6D, 0XBC6D, 0XBC6D, 0XBC6D, 0XBC6D, 0XB44D, 0XB44D, 0XB44D,
-  0XB46D, 0XB44D, 0XB44D, 0XB42D, 0XB44D, 0XB42D, 0XABCB, 0XB3EB,
-  0XB40B, 0XB40C, 0XAC0C, 0XAC0C, 0XAC0C, 0XABEB, 0XABCB, 0XABAA,
-  0XABCB, 0XABAB, 0XAB8A, 0XA38A, 0XA369, 0XA349, 0XA349, 0XA349,
-  0X9B29, 0X9B08, 0X9B08, 0X9AE8, 0X9AC7, 0X9AC8, 0X92C8, 0X92C7,
-  0X92A7, 0X92A7, 0X9287, 0X8A86, 0X8A66, 0X8A46, 0X8A25, 0X8A05,
-  0X81E4, 0X8205, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X81C4, 0X79A4,
-  0X79A3, 0X7983, 0X7983, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122,
-  0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7142, 0X7143, 0X7963, 0X7963, 0X7983, 0X79A3, 0X79A4, 0X79C4,
-  0X81E4, 0X81E5, 0X8205, 0X8205, 0X8A25, 0X8A46, 0X8A46, 0X8A46,
-  0X9287, 0X92A7, 0X92C8, 0X92C8, 0X9AE8, 0X9AC7, 0X9265, 0X9225,
-  0X9AC8, 0X9B29, 0XA349, 0XA349, 0XA329, 0XA36A, 0XA38A, 0XABAB,
-  0XABCB, 0XABCB, 0XABEC, 0XABEC, 0XAC0C, 0XAC0C, 0XB40C, 0XB42D,
-  0XB42D, 0XB42D, 0XB44D, 0XB44D, 0XB44D, 0XB44D, 0XB46D, 0XBC6D,
-  0XBC4C, 0XB42C, 0XBC6D, 0XBC6D, 0XBC6D, 0XBC6D, 0XBC6D, 0XBC8E,
-  0XBC8E, 0XBCAD, 0XBC8D, 0XBCAE, 0XBCAE, 0XBC8E, 0XBC8D, 0XBC8D,
-  0XBC8E, 0XBC8E, 0XBC8D, 0XB46D, 0XB46D, 0XBC6E, 0XB40C, 0XB42C,
-  0XB42C, 0XB42C, 0XB42C, 0XB42C, 0XB42C, 0XB40C, 0XB40B, 0XAC0B,
-  0XABEB, 0XABEB, 0XABEB, 0XABCB, 0XAB8A, 0XA38A, 0XA36A, 0XA36A,
-  0XA349, 0XA349, 0XA329, 0X9B08, 0X9B08, 0X9B08, 0X9AE8, 0X9AE8,
-  0X92C8, 0X92C7, 0X92A7, 0X92A7, 0X9287, 0X8A86, 0X8A46, 0X8A25,
-  0X8A05, 0X8A05, 0X8A05, 0X8A05, 0X8205, 0X81E4, 0X81E4, 0X81C4,
-  0X79C4, 0X79A4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7163, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7142,
-  0X7163, 0X7963, 0X7983, 0X7983, 0X79A4, 0X79A4, 0X81C4, 0X81E4,
-  0X8205, 0X8205, 0X8A25, 0X8A46, 0X8A46, 0X8A66, 0X9287, 0X8A66,
-  0X9287, 0X92E8, 0X9AE8, 0X9AE8, 0X9B08, 0X9AE7, 0X9225, 0X9A66,
-  0XA329, 0XA36A, 0XA38A, 0XA349, 0XA349, 0XABCB, 0XABCB, 0XABCB,
-  0XABEC, 0XAC0C, 0XAC0C, 0XB40C, 0XB42C, 0XB42D, 0XB44D, 0XB44D,
-  0XB44D, 0XB46D, 0XBC6D, 0XBC8E, 0XBC8E, 0XBC8E, 0XBC8E, 0XBC6D,
-  0XBC6D, 0XBC8E, 0XBCAE, 0XBCAE, 0XBCAE, 0XBC8D, 0XBC8E, 0XBCCF,
-  0XBCCF, 0XBCAE, 0XBCAD, 0XBCCF, 0XBCCF, 0XBCCE, 0XBCAE, 0XBCAE,
-  0XBCAE, 0XBCAF, 0XBCAE, 0XBCAE, 0XBCAE, 0XBCAF, 0XB44D, 0XB44C,
-  0XBC6D, 0XB44C, 0XB42C, 0XB44D, 0XB44C, 0XB44C, 0XB42C, 0XB42C,
-  0XAC0C, 0XAC0C, 0XAC0C, 0XABEC, 0XABCB, 0XABCB, 0XABAB, 0XAB8A,
-  0XA38A, 0XA36A, 0XA349, 0XA307, 0X9B29, 0X9B29, 0X9B29, 0X9B28,
-  0X9B08, 0X9B08, 0X92E8, 0X92C7, 0X92C7, 0X92A7, 0X9286, 0X9266,
-  0X9246, 0X8A25, 0X8A25, 0X8A25, 0X8A25, 0X8205, 0X8205, 0X81E5,
-  0X81E4, 0X81C4, 0X79C4, 0X79A4, 0X7983, 0X7983, 0X7963, 0X7163,
-  0X7142, 0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963,
-  0X7963, 0X7983, 0X7983, 0X79A4, 0X79C4, 0X81C4, 0X81E5, 0X8205,
-  0X8225, 0X8A26, 0X8A46, 0X8A66, 0X8A86, 0X9287, 0X92A7, 0X92A7,
-  0X92A7, 0X9AE8, 0X9B09, 0X9B29, 0X9B49, 0X9AE7, 0X9A25, 0X9AA7,
-  0XA38A, 0XAB8A, 0XABAB, 0XAB49, 0XAB8A, 0XABEC, 0XAC0C, 0XB40C,
-  0XB40C, 0XB42C, 0XB42C, 0XB44D, 0XB44D, 0XBC6E, 0XBC6E, 0XBC8E,
-  0XBC8E, 0XBC8E, 0XBCAE, 0XBCAE, 0XBCAE, 0XBCAE, 0XBCAE, 0XBCAE,
-  0XBCAF, 0XBCCF, 0XC4CF, 0XC4CF, 0XC4CF, 0XC4CF, 0XC4AE, 0XC4EF,
-  0XC4F0, 0XC4F0, 0XC4EF, 0XC4EF, 0XC4F0, 0XC4EF, 0XC4CF, 0XC4EF,
-  0XC4EF, 0XC4EF, 0XC4CF, 0XBCCF, 0XC4CF, 0XC4EF, 0XBC8E, 0XBC6D,
-  0XBCAE, 0XBCAE, 0XBC8D, 0XBC8D, 0XBC8D, 0XBC8D, 0XB44D, 0XB42D,
-  0XB42D, 0XB42D, 0XB42D, 0XB42C, 0XAC0C, 0XABEC, 0XABEB, 0XABCB,
-  0XABAB, 0XAB8A, 0XA369, 0XA348, 0XA369, 0XA349, 0X9B49, 0X9B49,
-  0X9B29, 0X9B29, 0X9B08, 0X9AE8, 0X92E8, 0X92C7, 0X92A7, 0X92A7,
-  0X9286, 0X9246, 0X9245, 0X8A45, 0X8A25, 0X8A05, 0X8A05, 0X8205,
-  0X81E5, 0X81E4, 0X81E4, 0X81C4, 0X79A4, 0X79A3, 0X7983, 0X7963,
-  0X7963, 0X7163, 0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7143, 0X7963, 0X7963,
-  0X7983, 0X79A4, 0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8205, 0X8A25,
-  0X8A46, 0X8A66, 0X8A86, 0X9287, 0X92A7, 0X92A7, 0X92C8, 0X9B08,
-  0X9AC8, 0X9AE8, 0X9B49, 0XA34A, 0XA36A, 0XA308, 0X9A25, 0XA2C8,
-  0XABAB, 0XABCB, 0XABCB, 0XAB6A, 0XABCB, 0XB42C, 0XB42D, 0XB44D,
-  0XB44D, 0XB44D, 0XB46D, 0XBC6D, 0XBC6E, 0XBC8E, 0XBCAE, 0XBCAE,
-  0XBCAE, 0XBCCF, 0XC4CF, 0XC4CF, 0XC4EF, 0XC4EF, 0XC4EF, 0XC4EF,
-  0XC510, 0XC510, 0XC510, 0XC510, 0XC4EF, 0XC50F, 0XC4EE, 0XC510,
-  0XC530, 0XC530, 0XC530, 0XC510, 0XC510, 0XC530, 0XC530, 0XC530,
-  0XC530, 0XC530, 0XC510, 0XC510, 0XC510, 0XC510, 0XC4CF, 0XBC8E,
-  0XC4AF, 0XC4EF, 0XBCCF, 0XBCCE, 0XBCCE, 0XBCAE, 0XBC8E, 0XBC6E,
-  0XBC6D, 0XB46D, 0XB44D, 0XB44D, 0XB42C, 0XB42C, 0XB40C, 0XB3EC,
-  0XABCB, 0XABAA, 0XAB8A, 0XAB8A, 0XA38A, 0XA36A, 0XA36A, 0XA36A,
-  0X9B6A, 0X9B49, 0X9B29, 0X9B08, 0X9B08, 0X9AE8, 0X92C7, 0X92A7,
-  0X92A7, 0X9286, 0X9286, 0X8A66, 0X8A46, 0X8A46, 0X8A25, 0X8A05,
-  0X8205, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X79C4, 0X79A4, 0X7983,
-  0X7963, 0X7963, 0X7163, 0X7142, 0X7142, 0X7122, 0X7102, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7102, 0X7122, 0X7142, 0X7142, 0X7163, 0X7963, 0X7983, 0X79A3,
-  0X79A4, 0X81C4, 0X81C4, 0X81E4, 0X8205, 0X8205, 0X8A26, 0X8A46,
-  0X8A66, 0X9287, 0X92A7, 0X92A7, 0X92C7, 0X92E8, 0X9B08, 0X9B29,
-  0X9B08, 0X9B08, 0XA34A, 0XA38A, 0XA38A, 0XA369, 0X9A25, 0XA2C8,
-  0XABEB, 0XAC0C, 0XABEB, 0XABAB, 0XB42C, 0XB42D, 0XB44D, 0XBC6E,
-  0XBC8E, 0XBC8E, 0XBC8E, 0XBCAF, 0XBCAE, 0XBCAE, 0XC4CF, 0XC4CF,
-  0XC4EF, 0XC4F0, 0XC4F0, 0XC510, 0XC510, 0XC510, 0XC530, 0XC510,
-  0XC530, 0XCD31, 0XCD31, 0XCD51, 0XC50F, 0XCD30, 0XCD0F, 0XCD30,
-  0XCD50, 0XCD50, 0XCD51, 0XCD51, 0XC550, 0XCD50, 0XCD51, 0XCD51,
-  0XCD51, 0XCD51, 0XCD51, 0XC530, 0XC531, 0XC531, 0XC510, 0XC4AF,
-  0XC4CF, 0XC510, 0XC510, 0XC4EF, 0XC4CF, 0XC4CF, 0XBCCF, 0XBCAF,
-  0XBCAE, 0XBC8E, 0XBC8E, 0XBC6D, 0XBC4D, 0XB44D, 0XB42D, 0XB42C,
-  0XB40C, 0XABEB, 0XABCB, 0XABCB, 0XABCB, 0XABAA, 0XAB8A, 0XA38A,
-  0XA38A, 0XA36A, 0X9B49, 0X9B29, 0X9B29, 0X9B08, 0X9AE8, 0X9A87,
-  0X92A7, 0X92A7, 0X92A7, 0X92A7, 0X9286, 0X8A66, 0X8A46, 0X8A46,
-  0X8A25, 0X8A05, 0X8205, 0X81E4, 0X81C4, 0X81C4, 0X81A4, 0X79A4,
-  0X7983, 0X7983, 0X7963, 0X7963, 0X7143, 0X7142, 0X7122, 0X7122,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7142, 0X7142, 0X7163, 0X7963, 0X7983, 0X79A3, 0X79C4,
-  0X81C4, 0X81E4, 0X81E4, 0X8205, 0X8A25, 0X8A25, 0X8A66, 0X8A87,
-  0X9287, 0X92A7, 0X92C7, 0X92C7, 0X9AE8, 0X9B08, 0X9B29, 0XA349,
-  0XA369, 0X9B29, 0XA349, 0XABAB, 0XABCB, 0XABAA, 0X9A66, 0XA2A7,
-  0XB40C, 0XB42C, 0XB3EB, 0XB40C, 0XBC6D, 0XB46D, 0XBC6D, 0XBC8E,
-  0XBCAE, 0XBCAE, 0XBCAF, 0XC4CF, 0XC4CF, 0XC4EF, 0XC4F0, 0XC510,
-  0XC510, 0XC510, 0XC531, 0XCD31, 0XCD31, 0XCD51, 0XCD51, 0XCD51,
-  0XCD51, 0XCD51, 0XCD72, 0XCD72, 0XCD51, 0XCD71, 0XCD50, 0XCD50,
-  0XCD71, 0XCD71, 0XCD72, 0XCD72, 0XCD72, 0XCD71, 0XCD71, 0XCD71,
-  0XCD71, 0XCD72, 0XCD71, 0XCD71, 0XCD71, 0XCD71, 0XC530, 0XC4CF,
-  0XC510, 0XC550, 0XC530, 0XC510, 0XC4EF, 0XC4CF, 0XC4F0, 0XC4EF,
-  0XBCCF, 0XBCCF, 0XBCCF, 0XBCAE, 0XBC8E, 0XBC8E, 0XBC6D, 0XB44D,
-  0XB42D, 0XB40C, 0XB3EB, 0XABEB, 0XABEB, 0XABCB, 0XABCB, 0XABAB,
-  0XA3AA, 0XA38A, 0XA36A, 0XA369, 0X9B49, 0X9B29, 0X9AC7, 0X9AA7,
-  0X9AC7, 0X92C7, 0X92C7, 0X92C8, 0X92C7, 0X92A7, 0X9286, 0X8A66,
-  0X8A46, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X81C4, 0X81C4,
-  0X79A4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7143, 0X7142, 0X7122,
-  0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122,
-  0X7142, 0X7142, 0X7163, 0X7963, 0X7983, 0X79A4, 0X79C4, 0X81C4,
-  0X81E4, 0X8205, 0X8205, 0X8A25, 0X8A46, 0X8A66, 0X8A86, 0X92A7,
-  0X92C7, 0X92E8, 0X9AE8, 0X9B08, 0X9B29, 0X9B49, 0XA349, 0XA36A,
-  0XA38A, 0XA38A, 0XA349, 0XABCB, 0XAC0C, 0XABEC, 0XAB08, 0XA287,
-  0XB3CB, 0XB40C, 0XB3CB, 0XBC0C, 0XBC8E, 0XBCAE, 0XBCAF, 0XBCAF,
-  0XBCCF, 0XC4CF, 0XC4EF, 0XC510, 0XC510, 0XC510, 0XC530, 0XC530,
-  0XC530, 0XCD51, 0XCD51, 0XCD52, 0XCD72, 0XCD71, 0XCD71, 0XCD71,
-  0XCD92, 0XCD92, 0XD592, 0XD593, 0XCD92, 0XCD91, 0XCD70, 0XD550,
-  0XD5B2, 0XD5B2, 0XD5B2, 0XD5B3, 0XD5B3, 0XD5B2, 0XCDB2, 0XCDB2,
-  0XCD91, 0XCD91, 0XCD92, 0XCD92, 0XD5B2, 0XCD92, 0XCD51, 0XCCF0,
-  0XCD31, 0XCD71, 0XCD51, 0XCD50, 0XC530, 0XC510, 0XC510, 0XC510,
-  0XC510, 0XC510, 0XC4EF, 0XC4CF, 0XBCAE, 0XBCCF, 0XBCAE, 0XBC6E,
-  0XBC4D, 0XB42C, 0XB42C, 0XB42C, 0XB40C, 0XB40C, 0XABEB, 0XABCB,
-  0XABCB, 0XA3AB, 0XA3AA, 0XA38A, 0XA36A, 0XA349, 0XA2C7, 0X9AE8,
-  0X9B08, 0X9AE8, 0X9AE8, 0X9AE8, 0X9AE8, 0X92C8, 0X92A7, 0X9287,
-  0X9266, 0X8A46, 0X8A25, 0X8A25, 0X8A25, 0X8205, 0X81C4, 0X81C4,
-  0X81C4, 0X79C4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7142, 0X7142,
-  0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X79A4, 0X79C4, 0X81E4, 0X81E5,
-  0X8205, 0X8225, 0X8A25, 0X8A46, 0X8A66, 0X9287, 0X92A7, 0X92C8,
-  0X9AE8, 0X9B08, 0X9B08, 0X9B29, 0XA349, 0XA36A, 0XA38A, 0XA38A,
-  0XABAB, 0XABCB, 0XA38A, 0XAB8A, 0XB40C, 0XB42C, 0XABEB, 0XAB08,
-  0XB309, 0XB3EC, 0XBC2D, 0XBC0C, 0XBC8E, 0XC4CF, 0XC4CF, 0XC4F0,
-  0XC510, 0XC50F, 0XC510, 0XC510, 0XC530, 0XCD51, 0XCD51, 0XCD50,
-  0XCD51, 0XCD71, 0XCD72, 0XD592, 0XD592, 0XD592, 0XCDB2, 0XD5B2,
-  0XD5B3, 0XD5B3, 0XD5D3, 0XD5D3, 0XD5D3, 0XD5B2, 0XD591, 0XD5B2,
-  0XD5D3, 0XD5D3, 0XD5D4, 0XD5D3, 0XD5D3, 0XD5D3, 0XD5D3, 0XD5D3,
-  0XD5D3, 0XD5D3, 0XD5B2, 0XCDB2, 0XD5D3, 0XD5B3, 0XCD92, 0XCD51,
-  0XCD51, 0XCD92, 0XCD71, 0XCD70, 0XCD71, 0XCD51, 0XCD30, 0XCD31,
-  0XCD51, 0XC530, 0XC510, 0XC510, 0XC4EF, 0XC4CF, 0XC4CF, 0XBCAE,
-  0XBC6D, 0XBC6D, 0XBC6D, 0XBC4D, 0XB44D, 0XB42C, 0XAC0C, 0XAC0C,
-  0XAC0C, 0XABEB, 0XABCB, 0XABAB, 0XA38A, 0XA349, 0XA2C8, 0XA308,
-  0X9B29, 0X9B29, 0X9B28, 0X9B08, 0X9B08, 0X9AE8, 0X9AE8, 0X92C7,
-  0X9287, 0X9266, 0X8A46, 0X8A46, 0X8A25, 0X8A25, 0X8205, 0X81E4,
-  0X81C4, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7942, 0X7142,
-  0X7122, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7143,
-  0X7963, 0X7983, 0X7983, 0X79A4, 0X79C4, 0X81E4, 0X8205, 0X8205,
-  0X8225, 0X8A46, 0X8A46, 0X8A66, 0X9286, 0X92A7, 0X92C8, 0X9AE8,
-  0X9B08, 0X9B29, 0X9B49, 0XA369, 0XA36A, 0XA38B, 0XABAB, 0XABCB,
-  0XABEB, 0XAC0C, 0XABCB, 0XB3AB, 0XB3EC, 0XB40C, 0XB44D, 0XB3AA,
-  0XAAA7, 0XBBCC, 0XBC4D, 0XBC0C, 0XC46D, 0XC4F0, 0XC510, 0XC510,
-  0XC531, 0XC530, 0XCD51, 0XCD51, 0XCD50, 0XCD50, 0XCD71, 0XCD91,
-  0XCD92, 0XD593, 0XD5B3, 0XD5B3, 0XD5D3, 0XD5D3, 0XD5D3, 0XD5D3,
-  0XD5D3, 0XD5F4, 0XD5F4, 0XD5F4, 0XD5F4, 0XD5F3, 0XDDF2, 0XDE14,
-  0XDE14, 0XDDF3, 0XDE14, 0XDE15, 0XDE14, 0XDE14, 0XDE14, 0XDE14,
-  0XD614, 0XD614, 0XD5F3, 0XD5D2, 0XD5D2, 0XD5D3, 0XD5D3, 0XCD92,
-  0XCD72, 0XD5B3, 0XD5B2, 0XCD91, 0XCD92, 0XCD92, 0XCD71, 0XCD51,
-  0XCD51, 0XCD51, 0XC551, 0XC531, 0XC530, 0XC4F0, 0XC4F0, 0XC4CF,
-  0XBC8E, 0XBC8E, 0XBC8E, 0XBC6D, 0XBC6D, 0XB44D, 0XB42C, 0XB42C,
-  0XB42C, 0XB40C, 0XABEB, 0XABCB, 0XABCB, 0XAB69, 0XAB08, 0XA349,
-  0XA349, 0X9B49, 0X9B49, 0X9B29, 0X9B09, 0X9B08, 0X9B08, 0X9AE8,
-  0X92C8, 0X92A7, 0X9287, 0X8A86, 0X8A66, 0X8A46, 0X8A25, 0X8A05,
-  0X81E4, 0X81C4, 0X81A4, 0X81A3, 0X7983, 0X7963, 0X7942, 0X7142,
-  0X7122, 0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7163, 0X7963,
-  0X7983, 0X79A3, 0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8225, 0X8A25,
-  0X8A46, 0X8A66, 0X8A66, 0X9287, 0X92A7, 0X92C8, 0X9B08, 0X9B09,
-  0X9B29, 0X9B49, 0XA36A, 0XA38A, 0XA38B, 0XABCB, 0XABEB, 0XABEC,
-  0XAC0C, 0XAC2C, 0XB40C, 0XB42C, 0XBC4D, 0XB42D, 0XB42C, 0XBC2C,
-  0XB349, 0XBB6A, 0XBB8A, 0XBB8A, 0XC40B, 0XC4CF, 0XCD51, 0XCD51,
-  0XCD51, 0XCD51, 0XCD72, 0XCD92, 0XCD92, 0XCD92, 0XCD92, 0XD5B2,
-  0XD5D3, 0XD5D3, 0XD5D4, 0XD5D4, 0XD5F4, 0XD5F4, 0XDDF4, 0XDE14,
-  0XD614, 0XDE14, 0XDE15, 0XDE35, 0XDE34, 0XDE14, 0XDE14, 0XDE14,
-  0XDE36, 0XDE34, 0XDE33, 0XDE35, 0XDE35, 0XDE35, 0XDE35, 0XDE35,
-  0XDE35, 0XDE34, 0XD614, 0XD614, 0XD5F3, 0XD5F3, 0XD614, 0XD5D3,
-  0XD5B3, 0XD5F3, 0XD5D2, 0XD5B1, 0XD5D3, 0XD5D3, 0XCDB3, 0XCD92,
-  0XCD92, 0XCD72, 0XCD72, 0XCD51, 0XCD51, 0XCD30, 0XC510, 0XC4EF,
-  0XC4AF, 0XBCAE, 0XBCAE, 0XBCAE, 0XBCAE, 0XBC8E, 0XB44D, 0XB44D,
-  0XB44D, 0XB44C, 0XB40C, 0XABEB, 0XABCB, 0XABAA, 0XAB69, 0XAB69,
-  0XA369, 0XA369, 0XA36A, 0XA36A, 0XA349, 0X9B29, 0X9B09, 0X9B08,
-  0X9AE8, 0X9AC7, 0X92A7, 0X92A7, 0X9286, 0X8A66, 0X8A46, 0X8A25,
-  0X8A05, 0X81E4, 0X81C4, 0X81A4, 0X8183, 0X7963, 0X7943, 0X7943,
-  0X7943, 0X7142, 0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7163, 0X7963, 0X7983,
-  0X79A4, 0X79C4, 0X81C4, 0X81E4, 0X8205, 0X8225, 0X8A46, 0X8A46,
-  0X8A66, 0X8A86, 0X92A7, 0X92A7, 0X92C7, 0X9B08, 0X9B29, 0X9B29,
-  0X9B49, 0XA36A, 0XA38A, 0XABAB, 0XABCB, 0XABEB, 0XAC0C, 0XB40C,
-  0XB42D, 0XB44D, 0XB42D, 0XB44D, 0XBC8E, 0XBCAF, 0XBC8E, 0XBC6D,
-  0XBC6D, 0XBBAA, 0XC40C, 0XC3EC, 0XBBCB, 0XC48E, 0XCD71, 0XCD72,
-  0XCD72, 0XD592, 0XD5B3, 0XD5B3, 0XD5D3, 0XD5D4, 0XD5D4, 0XD5D3,
-  0XD5F4, 0XD5F4, 0XDE14, 0XDE15, 0XDE15, 0XDE35, 0XDE35, 0XDE35,
-  0XDE35, 0XDE35, 0XDE56, 0XDE55, 0XDE34, 0XDE55, 0XDE55, 0XDE34,
-  0XE656, 0XE656, 0XDE54, 0XDE34, 0XDE55, 0XDE55, 0XDE56, 0XE656,
-  0XDE56, 0XDE55, 0XDE35, 0XDE35, 0XDE35, 0XDE13, 0XDE34, 0XD5F4,
-  0XD5D3, 0XDDD3, 0XD5D2, 0XD5D3, 0XD5F4, 0XD5F4, 0XD5D3, 0XD5D3,
-  0XD5D3, 0XD5B3, 0XD592, 0XCD72, 0XCD71, 0XCD71, 0XCD50, 0XC510,
-  0XC4EF, 0XC4EF, 0XC4CF, 0XC4AF, 0XBCAE, 0XBCAF, 0XBC8E, 0XBC6D,
-  0XBC4D, 0XB42C, 0XB42C, 0XB40C, 0XB40C, 0XABEB, 0XABAA, 0XABAA,
-  0XABAA, 0XABAA, 0XA3AA, 0XA38A, 0XA36A, 0XA36A, 0XA349, 0X9B29,
-  0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X92A7, 0X9287, 0X9266, 0X8A46,
-  0X8A25, 0X8A05, 0X8205, 0X81E4, 0X81C4, 0X8183, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7143, 0X7142, 0X7122, 0X7122, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7122, 0X7122, 0X7142, 0X7163, 0X7963, 0X7983, 0X79A3,
-  0X79C4, 0X81E4, 0X81E4, 0X8205, 0X8225, 0X8A46, 0X8A66, 0X8A66,
-  0X8A86, 0X92A7, 0X92C7, 0X9AE8, 0X9B08, 0X9B29, 0X9B49, 0XA36A,
-  0XA36A, 0XA38A, 0XABCB, 0XABEB, 0XABEC, 0XAC0C, 0XB42D, 0XB44D,
-  0XB46E, 0XB46E, 0XB46D, 0XBC8E, 0XBCCF, 0XC4CF, 0XC4F0, 0XC48E,
-  0XC4AE, 0XC4EF, 0XCD30, 0XC46D, 0XC3EB, 0XC48E, 0XCD10, 0XD5B3,
-  0XD5B3, 0XD5B3, 0XD5D3, 0XD5D3, 0XD5F4, 0XD5F4, 0XDE14, 0XDE14,
-  0XDE14, 0XDE35, 0XDE35, 0XDE35, 0XDE55, 0XDE55, 0XDE55, 0XE656,
-  0XDE56, 0XDE55, 0XDE76, 0XDE76, 0XDE56, 0XE676, 0XE676, 0XDE55,
-  0XE676, 0XE697, 0XE677, 0XDE76, 0XDE76, 0XDE56, 0XDE76, 0XE696,
-  0XE696, 0XDE76, 0XDE55, 0XE656, 0XDE56, 0XDE34, 0XDE34, 0XDDF4,
-  0XDDD3, 0XDDF3, 0XDE14, 0XDE14, 0XD615, 0XDE15, 0XD5F4, 0XD5D4,
-  0XD5F4, 0XD5D4, 0XD5D3, 0XD5B2, 0XD592, 0XCD92, 0XCD71, 0XCD30,
-  0XCD10, 0XC4F0, 0XC4F0, 0XC4CF, 0XC4CF, 0XC4CF, 0XBCAE, 0XBC8D,
-  0XBC6D, 0XB44C, 0XB44C, 0XB44D, 0XBC4D, 0XB42C, 0XB3EB, 0XABEB,
-  0XABEB, 0XABEB, 0XABCB, 0XABAB, 0XA3AB, 0XA38A, 0XA36A, 0XA34A,
-  0X9B49, 0X9B08, 0X9B08, 0X9AE8, 0X92C8, 0X92A7, 0X9287, 0X9266,
-  0X8A46, 0X8A25, 0X8A05, 0X8205, 0X81E4, 0X81C4, 0X8184, 0X7983,
-  0X7983, 0X7963, 0X7963, 0X7163, 0X7142, 0X7122, 0X7122, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7122, 0X7122, 0X7142, 0X7162, 0X7963, 0X7983, 0X79A3, 0X79C4,
-  0X81E4, 0X81E4, 0X8205, 0X8225, 0X8A46, 0X8A66, 0X8A86, 0X9287,
-  0X92A7, 0X92C8, 0X9AE8, 0X9B08, 0X9B28, 0X9B49, 0XA36A, 0XA38A,
-  0XA3AA, 0XABCB, 0XABEB, 0XAC0C, 0XB42C, 0XB42D, 0XB44D, 0XBC6E,
-  0XBC8E, 0XBC8E, 0XBC6D, 0XBCAF, 0XC4EF, 0XC510, 0XC530, 0XC4EF,
-  0XC4AE, 0XCD30, 0XCD72, 0XC4CE, 0XC42B, 0XD510, 0XCCEF, 0XD592,
-  0XD5F4, 0XD5F4, 0XD5F4, 0XD614, 0XDE15, 0XDE35, 0XDE35, 0XDE35,
-  0XDE55, 0XDE56, 0XDE56, 0XE656, 0XE676, 0XE676, 0XDE76, 0XE677,
-  0XE697, 0XE676, 0XE696, 0XE697, 0XE697, 0XE6B7, 0XE697, 0XE676,
-  0XE696, 0XE6B7, 0XE6B8, 0XE6B8, 0XE697, 0XE697, 0XE6B7, 0XE697,
-  0XE697, 0XE697, 0XE697, 0XE676, 0XE676, 0XDE13, 0XDDF3, 0XE636,
-  0XDDF3, 0XDE34, 0XDE56, 0XDE55, 0XDE35, 0XDE35, 0XDE35, 0XD614,
-  0XD615, 0XD614, 0XD5F4, 0XD5D3, 0XD5B3, 0XD5B3, 0XD5B2, 0XCD92,
-  0XCD51, 0XCD10, 0XCD10, 0XC4F0, 0XC4F0, 0XC4F0, 0XC4CF, 0XBC8D,
-  0XBC8D, 0XBC8E, 0XBC8D, 0XBC8E, 0XBC8E, 0XB44D, 0XB42C, 0XB42C,
-  0XAC0C, 0XABEC, 0XABEC, 0XABEB, 0XABCB, 0XABAB, 0XAB8A, 0XA36A,
-  0XA36A, 0XA349, 0X9B29, 0X9B08, 0X9AE8, 0X9AC8, 0X92A7, 0X9287,
-  0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8A05, 0X81E5, 0X81C4, 0X81A4,
-  0X79A4, 0X7983, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122, 0X7122,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7142, 0X7163, 0X7963, 0X7983, 0X79A4, 0X79C4, 0X81C4,
-  0X81E4, 0X8205, 0X8225, 0X8A46, 0X8A66, 0X8A86, 0X92A7, 0X92A7,
-  0X92C7, 0X9B08, 0X9B09, 0X9B29, 0X9B29, 0XA369, 0XA38A, 0XA3AB,
-  0XABCB, 0XABEC, 0XB40C, 0XB42D, 0XB44D, 0XBC6E, 0XBC8E, 0XBC8E,
-  0XBCAF, 0XBCAE, 0XBC8E, 0XC4F0, 0XC510, 0XC531, 0XC551, 0XCD50,
-  0XC4CE, 0XCD10, 0XD592, 0XCD50, 0XC40A, 0XD510, 0XD592, 0XCD30,
-  0XD5F3, 0XD634, 0XDE14, 0XDE34, 0XDE35, 0XDE56, 0XDE56, 0XDE56,
-  0XDE75, 0XE676, 0XE677, 0XE697, 0XE697, 0XE697, 0XE6B7, 0XE6B7,
-  0XE6B8, 0XE6B7, 0XE696, 0XE6B7, 0XEEB8, 0XEED8, 0XE6B8, 0XE697,
-  0XE6B7, 0XE6D7, 0XEED8, 0XEED8, 0XE6B8, 0XE6D7, 0XE6D8, 0XE6B7,
-  0XE6B7, 0XE697, 0XE697, 0XE697, 0XE6B7, 0XDE34, 0XDE33, 0XDE34,
-  0XDDF3, 0XE656, 0XE677, 0XDE76, 0XDE56, 0XDE56, 0XDE56, 0XDE35,
-  0XDE35, 0XDE35, 0XD614, 0XD5F4, 0XD5D3, 0XD5F3, 0XD5D3, 0XD5B3,
-  0XD571, 0XCD31, 0XCD51, 0XCD31, 0XCD30, 0XCD30, 0XC4F0, 0XBCAE,
-  0XBC8D, 0XBCAE, 0XBCAE, 0XBC8E, 0XBC6D, 0XBC4D, 0XB44D, 0XB44D,
-  0XB44D, 0XB42C, 0XAC0C, 0XAC0C, 0XABEC, 0XABEB, 0XABCB, 0XABAB,
-  0XA38A, 0XA36A, 0XA349, 0X9B29, 0X9B08, 0X9AE8, 0X9AC8, 0X92C7,
-  0X92A7, 0X9287, 0X9266, 0X8A45, 0X8A25, 0X8A05, 0X8205, 0X81E4,
-  0X81C4, 0X79A4, 0X79A4, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122,
-  0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122,
-  0X7142, 0X7143, 0X7963, 0X7983, 0X79A3, 0X79C4, 0X81E4, 0X81E4,
-  0X8205, 0X8225, 0X8A45, 0X8A66, 0X8A86, 0X92A7, 0X92C7, 0X92C7,
-  0X9AE8, 0X9B29, 0X9B49, 0X9B49, 0XA36A, 0XA36A, 0XA3AA, 0XABCB,
-  0XABEC, 0XAC2C, 0XB42D, 0XB44D, 0XBC6E, 0XBC8E, 0XBCAF, 0XBCCF,
-  0XBCCF, 0XC4CF, 0XC4AF, 0XC510, 0XC551, 0XCD51, 0XCD51, 0XCD71,
-  0XCD50, 0XCD10, 0XD5B2, 0XD5D2, 0XC4AC, 0XCC6D, 0XDDF4, 0XD571,
-  0XD570, 0XDE34, 0XDE35, 0XDE55, 0XDE56, 0XE676, 0XE677, 0XE697,
-  0XDE96, 0XE697, 0XE6B8, 0XE6B7, 0XE6B8, 0XEEB8, 0XE6D8, 0XE6D8,
-  0XEED8, 0XEED8, 0XE6B7, 0XE6D8, 0XEEF9, 0XEEF9, 0XE6D8, 0XE6D8,
-  0XE6B7, 0XE6B8, 0XEEF9, 0XEEF9, 0XEEF9, 0XEEF8, 0XEEF8, 0XEED8,
-  0XEEF9, 0XE6D8, 0XE6B8, 0XE6D8, 0XE6D8, 0XE696, 0XE675, 0XDE34,
-  0XDDD3, 0XDE34, 0XE6B7, 0XE697, 0XE677, 0XDE76, 0XE677, 0XDE76,
-  0XDE56, 0XDE56, 0XDE35, 0XDE35, 0XD614, 0XD5F4, 0XD5F4, 0XD5D3,
-  0XD592, 0XD552, 0XCD72, 0XCD72, 0XCD51, 0XCD31, 0XC510, 0XC4EF,
-  0XC4CF, 0XC4CF, 0XC4AE, 0XBCAE, 0XBCAE, 0XBC8E, 0XBC8E, 0XB46D,
-  0XB46D, 0XB44D, 0XB44D, 0XB42D, 0XB40C, 0XAC0C, 0XABEC, 0XABEB,
-  0XABCB, 0XA38A, 0XA369, 0XA349, 0X9B29, 0X9B29, 0X9B08, 0X9AE8,
-  0X9AC8, 0X92A7, 0X9266, 0X9266, 0X8A46, 0X8A25, 0X8A25, 0X8205,
-  0X81E5, 0X81C4, 0X79A4, 0X79A4, 0X7983, 0X7963, 0X7963, 0X7142,
-  0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142,
-  0X7142, 0X7963, 0X7983, 0X79A3, 0X79A4, 0X81C4, 0X81E4, 0X8205,
-  0X8225, 0X8A45, 0X8A66, 0X8A66, 0X92A7, 0X92A7, 0X92C8, 0X9AE8,
-  0X9B29, 0X9B49, 0X9B69, 0XA36A, 0XA38A, 0XA3AA, 0XABCB, 0XABEB,
-  0XAC0C, 0XB42D, 0XB44D, 0XBC6E, 0XBC8E, 0XBCAF, 0XC4CF, 0XC4EF,
-  0XC510, 0XC4EF, 0XC4EF, 0XC531, 0XCD71, 0XCD71, 0XCD71, 0XCD91,
-  0XD5B2, 0XCD30, 0XD592, 0XDE14, 0XCD2F, 0XCC4C, 0XDDF4, 0XDE35,
-  0XD571, 0XDDB2, 0XE676, 0XE677, 0XE696, 0XE697, 0XE697, 0XE6B8,
-  0XE6B8, 0XE6B6, 0XE6B7, 0XEED8, 0XEED8, 0XEED9, 0XEEF8, 0XEEF9,
-  0XEEF9, 0XEEF8, 0XE6D8, 0XEEF9, 0XEF19, 0XE6F8, 0XEEF9, 0XEEF9,
-  0XE6F8, 0XE6D8, 0XEEF9, 0XEF1A, 0XEF19, 0XE6F8, 0XEEF8, 0XEF19,
-  0XEEF9, 0XEEF9, 0XEEF9, 0XE6F8, 0XE6D8, 0XE6B8, 0XEED9, 0XE697,
-  0XE635, 0XDE35, 0XE697, 0XE6B8, 0XE6B7, 0XE697, 0XE697, 0XE697,
-  0XE697, 0XE676, 0XDE55, 0XDE55, 0XDE35, 0XDE14, 0XDE14, 0XD614,
-  0XD5B3, 0XD592, 0XD592, 0XD592, 0XCD72, 0XCD31, 0XCD30, 0XC510,
-  0XC510, 0XC4F0, 0XC4EF, 0XC4CF, 0XBCCF, 0XBCAF, 0XBCAE, 0XBCAE,
-  0XBC8E, 0XBC6E, 0XBC6E, 0XBC6D, 0XB44D, 0XB42C, 0XB40C, 0XAC0C,
-  0XABEB, 0XABCB, 0XA36A, 0XA34A, 0XA34A, 0XA349, 0X9B29, 0X9B08,
-  0X9AE8, 0X92A7, 0X9287, 0X9287, 0X9266, 0X8A66, 0X8A46, 0X8A25,
-  0X8205, 0X81E5, 0X81C4, 0X81A4, 0X79A4, 0X7983, 0X7963, 0X7163,
-  0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142,
-  0X7963, 0X7983, 0X7983, 0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8225,
-  0X8A45, 0X8A66, 0X8A86, 0X92A7, 0X92C7, 0X92E8, 0X9AE8, 0X9B08,
-  0X9B49, 0XA36A, 0XA38A, 0XA38A, 0XA3AA, 0XABCB, 0XABEB, 0XAC0C,
-  0XB42D, 0XB44D, 0XBC8E, 0XBCAF, 0XBCAF, 0XC4D0, 0XC4EF, 0XC510,
-  0XC530, 0XC510, 0XC510, 0XCD72, 0XCD92, 0XCD92, 0XCD92, 0XD5B2,
-  0XD5F3, 0XD592, 0XD571, 0XDE35, 0XD5B1, 0XCC6B, 0XDDD3, 0XE6B7,
-  0XDE55, 0XDDB2, 0XDE14, 0XE6B8, 0XE6B7, 0XE6B7, 0XE6B8, 0XEED8,
-  0XEED8, 0XE6D8, 0XE6D8, 0XEEF9, 0XEEF9, 0XEEF9, 0XEEF9, 0XEF19,
-  0XEF19, 0XEEF8, 0XEF19, 0XEF1A, 0XEF19, 0XEF19, 0XEF1A, 0XEF19,
-  0XEF19, 0XEEF9, 0XEF3A, 0XEF3A, 0XEF3A, 0XEF19, 0XEF19, 0XEF39,
-  0XEF39, 0XEF19, 0XEEF8, 0XEED8, 0XEEF9, 0XEEF9, 0XEF1A, 0XE6B7,
-  0XE697, 0XE697, 0XE697, 0XE6D8, 0XE6D8, 0XE6D8, 0XE6B8, 0XE6B8,
-  0XE697, 0XE697, 0XE676, 0XE656, 0XDE35, 0XDE35, 0XDE55, 0XDE35,
-  0XDDF4, 0XD593, 0XD592, 0XD592, 0XCD72, 0XCD51, 0XCD51, 0XCD31,
-  0XCD31, 0XC530, 0XC510, 0XC4EF, 0XBCCF, 0XBCCF, 0XBCCF, 0XBCCF,
-  0XBCAF, 0XBCAF, 0XBCAE, 0XBC8E, 0XBC6D, 0XB44D, 0XB42D, 0XB42C,
-  0XB3EC, 0XABCB, 0XABCB, 0XAB8A, 0XA36A, 0XA36A, 0XA349, 0X9B29,
-  0X9B08, 0X9AC7, 0X9AC7, 0X92A7, 0X92A7, 0X9287, 0X8A66, 0X8A46,
-  0X8A25, 0X8205, 0X81E5, 0X81E4, 0X79A4, 0X79A3, 0X7983, 0X7963,
-  0X7163, 0X7142, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7963,
-  0X7983, 0X7983, 0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8225, 0X8A45,
-  0X8A66, 0X8A86, 0X92A7, 0X92C7, 0X92E8, 0X9B08, 0X9B08, 0X9B29,
-  0XA369, 0XA38A, 0XABAB, 0XABCB, 0XABCB, 0XABEB, 0XAC0C, 0XB42D,
-  0XB46D, 0XBC8E, 0XBCAF, 0XC4CF, 0XC4EF, 0XC4F0, 0XC4F0, 0XC510,
-  0XC531, 0XC530, 0XCD30, 0XCD92, 0XD5B3, 0XD5D3, 0XD5D3, 0XD5D3,
-  0XD5F3, 0XD5F3, 0XD571, 0XDE14, 0XE655, 0XD4CE, 0XCC6C, 0XE634,
-  0XE6D8, 0XE655, 0XDDB2, 0XE676, 0XEEF8, 0XE6D8, 0XEED8, 0XEEF8,
-  0XEEF9, 0XEEF9, 0XEF19, 0XEF19, 0XEF1A, 0XEF1A, 0XEF3A, 0XEF19,
-  0XEEF8, 0XEF19, 0XEF3A, 0XEF3A, 0XEF3A, 0XEF5A, 0XEF3A, 0XEF3A,
-  0XEF3A, 0XEEF9, 0XEF3A, 0XEF5B, 0XF75B, 0XF75B, 0XF75B, 0XEF5A,
-  0XEF3A, 0XEF3A, 0XEF19, 0XEF1A, 0XEF1A, 0XEF1A, 0XEEF9, 0XEEB7,
-  0XEED8, 0XEED7, 0XE6B7, 0XEEF9, 0XEEF9, 0XEEF9, 0XEED9, 0XE6B8,
-  0XE6B8, 0XE6B7, 0XE6B7, 0XE697, 0XDE56, 0XDE55, 0XDE56, 0XDE56,
-  0XDDF4, 0XD593, 0XD593, 0XD593, 0XD593, 0XD593, 0XCD92, 0XCD72,
-  0XCD72, 0XCD51, 0XC531, 0XC510, 0XC510, 0XC4F0, 0XC4F0, 0XC4F0,
-  0XC4EF, 0XC4CF, 0XBCCF, 0XBCAE, 0XBCAE, 0XBC6E, 0XBC6D, 0XB42C,
-  0XABEB, 0XABEC, 0XABEC, 0XABCB, 0XABAB, 0XAB8A, 0XA36A, 0XA349,
-  0X9B08, 0X9AE8, 0X9AE8, 0X9AC8, 0X92C7, 0X92A7, 0X9287, 0X8A66,
-  0X8A46, 0X8A25, 0X8205, 0X81E5, 0X81C4, 0X79A4, 0X7983, 0X7983,
-  0X7963, 0X7163, 0X7142, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7163, 0X7963,
-  0X7983, 0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8225, 0X8A45, 0X8A66,
-  0X8A86, 0X92A7, 0X92C7, 0X92E8, 0X9B08, 0X9B29, 0X9B49, 0XA349,
-  0XA38A, 0XA3AB, 0XABCB, 0XABEB, 0XABEC, 0XAC0B, 0XB40C, 0XB44D,
-  0XBC8E, 0XBCAF, 0XC4CF, 0XC4F0, 0XC510, 0XC510, 0XC530, 0XCD51,
-  0XCD71, 0XCD30, 0XCD51, 0XD5D3, 0XD5D3, 0XD5F4, 0XD5F4, 0XDDF4,
-  0XDE14, 0XDE34, 0XD5D3, 0XDDD3, 0XE696, 0XDE35, 0XCD0F, 0XD4CC,
-  0XEE75, 0XEF18, 0XEE35, 0XE5D4, 0XEE97, 0XEF19, 0XEEF8, 0XEEF8,
-  0XEF19, 0XEF1A, 0XEF1A, 0XEF1A, 0XF73A, 0XEF3A, 0XEF5A, 0XEF19,
-  0XEF19, 0XF73A, 0XF75A, 0XEF5B, 0XEF5B, 0XF75B, 0XF75B, 0XEF5B,
-  0XF75B, 0XF73A, 0XEF1A, 0XF75B, 0XF77C, 0XF77B, 0XF77B, 0XF77B,
-  0XEF5B, 0XEF3A, 0XEF5A, 0XF75B, 0XEF3B, 0XEF3A, 0XEED8, 0XEEB8,
-  0XEF19, 0XEEF9, 0XE6B8, 0XE6D9, 0XEF3A, 0XEF1A, 0XEEF9, 0XEED9,
-  0XE6D8, 0XE6B8, 0XE6B7, 0XE6B7, 0XE676, 0XDE56, 0XE656, 0XE615,
-  0XDDD4, 0XD5D4, 0XD5F4, 0XD5D4, 0XD5D4, 0XD5D3, 0XD5B3, 0XD5B3,
-  0XCD92, 0XCD72, 0XCD51, 0XCD51, 0XCD51, 0XC530, 0XC530, 0XC530,
-  0XC510, 0XC4F0, 0XC4EF, 0XBCEF, 0XBCAE, 0XBC8E, 0XBC6D, 0XB42C,
-  0XB40C, 0XB42C, 0XB40C, 0XAC0C, 0XABEB, 0XABAB, 0XABAA, 0XA36A,
-  0XA329, 0X9B09, 0X9B08, 0X9B08, 0X9AE8, 0X92C8, 0X92A7, 0X9287,
-  0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A4, 0X7983,
-  0X7983, 0X7963, 0X7143, 0X7142, 0X7122, 0X7102, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7163, 0X7963, 0X7983,
-  0X79A3, 0X81C4, 0X81E4, 0X8205, 0X8225, 0X8A46, 0X8A66, 0X8A86,
-  0X92A7, 0X92C7, 0X92E8, 0X9B08, 0X9B28, 0X9B49, 0XA349, 0XA36A,
-  0XA3AB, 0XABCB, 0XABEC, 0XAC0C, 0XAC0C, 0XB42C, 0XB42C, 0XB46E,
-  0XBCAE, 0XBCCF, 0XC4F0, 0XC510, 0XC510, 0XC531, 0XCD51, 0XCD71,
-  0XCD92, 0XCD72, 0XCD71, 0XD5D3, 0XD5F4, 0XDE14, 0XDE14, 0XDE35,
-  0XDE34, 0XDE34, 0XDE54, 0XDDF3, 0XDE55, 0XE696, 0XE6D6, 0XDD50,
-  0XE50F, 0XEDF3, 0XE551, 0XE593, 0XEDD4, 0XEE97, 0XEF3A, 0XEF19,
-  0XEF3A, 0XEF3A, 0XF73A, 0XEF3A, 0XEF5A, 0XEF5A, 0XEF59, 0XEF39,
-  0XF75A, 0XF75B, 0XF75A, 0XEF5B, 0XF77C, 0XF77C, 0XF77C, 0XF77B,
-  0XF77B, 0XEF5B, 0XF77B, 0XF77C, 0XF77C, 0XF77C, 0XF77C, 0XF79C,
-  0XEF7B, 0XEF5B, 0XF77B, 0XF77B, 0XF75B, 0XEF1A, 0XEEF9, 0XEEF9,
-  0XEF1A, 0XEF3A, 0XEEB8, 0XEED8, 0XEF5B, 0XEF3A, 0XEF1A, 0XEF1A,
-  0XEEF9, 0XEED8, 0XE6B7, 0XE677, 0XE677, 0XE656, 0XE636, 0XDE15,
-  0XDE15, 0XDE15, 0XDE15, 0XDE35, 0XD615, 0XD5F4, 0XD5D4, 0XD5D3,
-  0XD593, 0XCD92, 0XCD72, 0XCD52, 0XCD72, 0XCD72, 0XCD72, 0XCD72,
-  0XC551, 0XC530, 0XC510, 0XC4EF, 0XC4CF, 0XBCAE, 0XBC6D, 0XBC2C,
-  0XBC4D, 0XBC4D, 0XB44D, 0XB42C, 0XB40C, 0XABEB, 0XABCB, 0XAB8A,
-  0XA349, 0XA349, 0XA349, 0X9B29, 0X9B08, 0X9AE8, 0X92C7, 0X92A7,
-  0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A4,
-  0X7983, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7102, 0X7122, 0X7142, 0X7163, 0X7963, 0X7983, 0X79A3,
-  0X79C4, 0X81E4, 0X8205, 0X8225, 0X8A45, 0X8A66, 0X8A86, 0X92A7,
-  0X92A7, 0X92E8, 0X9B08, 0X9B29, 0X9B49, 0XA369, 0XA369, 0XA3AA,
-  0XABCB, 0XABEC, 0XAC0C, 0XAC2D, 0XAC2C, 0XB42C, 0XB46D, 0XBC8E,
-  0XBCCF, 0XC510, 0XC530, 0XC530, 0XC531, 0XCD51, 0XCD72, 0XCDB2,
-  0XCDB2, 0XCD91, 0XD591, 0XD5D2, 0XD5F3, 0XDE34, 0XDE35, 0XDE55,
-  0XDE55, 0XDE54, 0XE696, 0XDE34, 0XE675, 0XE674, 0XE675, 0XEE55,
-  0XE5B2, 0XE551, 0XED92, 0XE531, 0XEDF5, 0XEE97, 0XEED8, 0XF75B,
-  0XEF5A, 0XF75A, 0XF77B, 0XEF5A, 0XEF59, 0XF77B, 0XF77B, 0XF75B,
-  0XF77B, 0XF77B, 0XF77B, 0XF77B, 0XF79C, 0XFF9C, 0XF79C, 0XF79C,
-  0XF77C, 0XEF7C, 0XF7BD, 0XF79D, 0XF79C, 0XF79C, 0XF79D, 0XF79D,
-  0XF79C, 0XF79C, 0XF77C, 0XF77C, 0XF75B, 0XF73A, 0XF73B, 0XEF1A,
-  0XEF3A, 0XEF3A, 0XEEF8, 0XEF1A, 0XEF5B, 0XEF5B, 0XEF3A, 0XEF1A,
-  0XEEF9, 0XEE98, 0XEE77, 0XEE98, 0XEE98, 0XE697, 0XE677, 0XDE56,
-  0XDE36, 0XDE36, 0XDE56, 0XDE56, 0XDE56, 0XDE35, 0XDDF4, 0XD5F4,
-  0XD5D4, 0XD5B3, 0XCD93, 0XCD93, 0XCDB3, 0XD5B3, 0XCDB3, 0XCD92,
-  0XCD72, 0XCD51, 0XCD51, 0XC530, 0XC4F0, 0XC4CF, 0XBC6E, 0XBC6D,
-  0XBC6D, 0XBC8E, 0XBC6D, 0XB44D, 0XB42D, 0XAC0C, 0XABEB, 0XABAA,
-  0XA38A, 0XA36A, 0XA36A, 0XA349, 0X9B29, 0X9B08, 0X9AE8, 0X92C7,
-  0X92A7, 0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4,
-  0X79A4, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122, 0X7122, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X7102, 0X7122, 0X7142, 0X7143, 0X7963, 0X7983, 0X79A3, 0X79C4,
-  0X81E4, 0X81E4, 0X8205, 0X8A45, 0X8A66, 0X8A86, 0X92A7, 0X92C7,
-  0X92E8, 0X9B08, 0X9B29, 0X9B49, 0XA369, 0XA38A, 0XA38A, 0XABCB,
-  0XABEC, 0XAC2C, 0XB42D, 0XB44D, 0XB44D, 0XB44C, 0XBC8D, 0XBCAF,
-  0XC4F0, 0XC530, 0XC531, 0XC551, 0XCD51, 0XCD72, 0XCD92, 0XD5B2,
-  0XD5B2, 0XD571, 0XD5B2, 0XD5F4, 0XD614, 0XDE13, 0XDE14, 0XDE76,
-  0XDE76, 0XDE76, 0XE6B6, 0XE695, 0XE673, 0XEEB6, 0XE697, 0XEE96,
-  0XF6D7, 0XF656, 0XF5D4, 0XE4D0, 0XEE36, 0XF739, 0XEE96, 0XF719,
-  0XF79C, 0XF77B, 0XF77C, 0XEF5B, 0XEF5A, 0XF79C, 0XF79C, 0XF79C,
-  0XF77B, 0XF79B, 0XF7BC, 0XF79C, 0XF7BC, 0XFFBD, 0XF79C, 0XF77C,
-  0XF77B, 0XF79C, 0XF7BD, 0XF7BD, 0XFFBD, 0XF7BD, 0XF7BD, 0XF7BD,
-  0XF7BD, 0XF79C, 0XF79C, 0XF79C, 0XF77C, 0XF75B, 0XF77C, 0XEF5B,
-  0XF75B, 0XEF39, 0XEF39, 0XEF5B, 0XF75B, 0XF77B, 0XEF5B, 0XEF3A,
-  0XEF1A, 0XEE98, 0XEE98, 0XEED9, 0XEEF9, 0XE6B8, 0XE698, 0XE6B8,
-  0XE677, 0XE677, 0XDE77, 0XE677, 0XE676, 0XDE56, 0XD614, 0XD5F4,
-  0XD615, 0XD5D4, 0XCDD3, 0XCDD4, 0XD5F4, 0XD5D4, 0XCDD3, 0XCDB2,
-  0XCDB2, 0XCD92, 0XCD71, 0XC551, 0XC530, 0XC4CF, 0XBCAF, 0XC4CF,
-  0XBCAE, 0XBCAE, 0XBC8E, 0XBC6D, 0XB44D, 0XB42D, 0XB40C, 0XABCB,
-  0XABAA, 0XAB8A, 0XA38A, 0XA36A, 0XA349, 0X9B29, 0X9B08, 0X9AE8,
-  0X92C7, 0X92A7, 0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4,
-  0X81C4, 0X79A3, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7102,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7983, 0X79A3, 0X79C4, 0X81E4,
-  0X81E4, 0X8205, 0X8A25, 0X8A46, 0X8A66, 0X9287, 0X92C7, 0X92E8,
-  0X9AE8, 0X9B28, 0X9B49, 0XA369, 0XA38A, 0XA3AA, 0XABCB, 0XABEC,
-  0XAC0C, 0XB42D, 0XB44D, 0XB48D, 0XB46D, 0XBC8D, 0XBCAE, 0XC4CF,
-  0XC510, 0XC551, 0XCD51, 0XCD71, 0XCD92, 0XCDB3, 0XD5D3, 0XD5F4,
-  0XD5F4, 0XD5D2, 0XD5F4, 0XDE35, 0XDE55, 0XDE14, 0XDE34, 0XE696,
-  0XE697, 0XE6B7, 0XE6D8, 0XE6B5, 0XEE54, 0XEEF9, 0XEF3A, 0XEED6,
-  0XE590, 0XECF1, 0XECF1, 0XEE15, 0XEEF8, 0XEF19, 0XF719, 0XF6B7,
-  0XF739, 0XF79B, 0XF79B, 0XF77A, 0XF75A, 0XF79C, 0XF79C, 0XF7BC,
-  0XF79C, 0XF79C, 0XF7BD, 0XF79C, 0XF79C, 0XF7BC, 0XF79C, 0XF77B,
-  0XF77B, 0XF79C, 0XF79D, 0XF79D, 0XFFDD, 0XF7BD, 0XF7BD, 0XF7BD,
-  0XF7BD, 0XF79D, 0XF79D, 0XFFDD, 0XF77C, 0XF75C, 0XF79D, 0XF75B,
-  0XF77B, 0XF75B, 0XEF19, 0XF75B, 0XF75C, 0XF75C, 0XF75B, 0XEF1A,
-  0XEEF9, 0XEEFA, 0XEED9, 0XEEFA, 0XEF1A, 0XEED9, 0XEEB9, 0XE6D9,
-  0XE6B8, 0XE698, 0XE698, 0XE698, 0XE697, 0XDE56, 0XD615, 0XD636,
-  0XD635, 0XD615, 0XD5F4, 0XD614, 0XD614, 0XD5F4, 0XCDF4, 0XCDD3,
-  0XCDD3, 0XCDB2, 0XCD92, 0XCD71, 0XCD51, 0XC4F0, 0XC4F0, 0XC510,
-  0XC4F0, 0XBCCF, 0XBCAE, 0XBC8E, 0XBC6E, 0XB44D, 0XB42C, 0XABCB,
-  0XABAB, 0XABAB, 0XABAB, 0XAB8A, 0XA36A, 0XA349, 0X9B29, 0X9B08,
-  0X9AE8, 0X92C7, 0X92A7, 0X9286, 0X8A66, 0X8A46, 0X8225, 0X8205,
-  0X81E4, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122,
-  0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7122,
-  0X7122, 0X7142, 0X7163, 0X7963, 0X79A3, 0X79C4, 0X81C4, 0X81E4,
-  0X8205, 0X8225, 0X8A45, 0X8A66, 0X9286, 0X92A7, 0X92E8, 0X9AE8,
-  0X9B08, 0X9B49, 0XA36A, 0XA38A, 0XA3AA, 0XABAA, 0XABEB, 0XAC0C,
-  0XB42D, 0XB44D, 0XB48D, 0XB48D, 0XB48D, 0XBC8D, 0XBCCF, 0XC510,
-  0XC551, 0XCD71, 0XCD72, 0XCD92, 0XCDB3, 0XD5D3, 0XD5F4, 0XDE14,
-  0XD614, 0XD5F3, 0XDE14, 0XDE55, 0XDE76, 0XDE76, 0XE655, 0XE6B6,
-  0XE6B7, 0XE6D7, 0XE6F8, 0XE6B6, 0XE655, 0XEEF9, 0XF75A, 0XE612,
-  0XE510, 0XEDD5, 0XEE77, 0XF73A, 0XF77A, 0XEF19, 0XF73A, 0XF73A,
-  0XEE97, 0XF719, 0XF77A, 0XF719, 0XF71A, 0XF77C, 0XFFDD, 0XF7BD,
-  0XF7BD, 0XF7BD, 0XF7BD, 0XF79D, 0XF79C, 0XF79D, 0XF7BD, 0XF77C,
-  0XF77C, 0XF7BE, 0XF7BD, 0XF7BD, 0XF7DE, 0XF7BD, 0XFFBD, 0XFFBD,
-  0XF7BD, 0XF7BD, 0XF7BD, 0XFFDE, 0XF79C, 0XF77C, 0XF79D, 0XF77C,
-  0XF75B, 0XF77C, 0XF6F9, 0XF73B, 0XF77C, 0XF75B, 0XF75C, 0XEF1A,
-  0XEEFA, 0XEF3B, 0XEEFA, 0XEEFA, 0XEF3B, 0XEF1A, 0XEEF9, 0XEEF9,
-  0XE6D9, 0XE6B8, 0XE6B9, 0XE6B8, 0XE6B7, 0XDE76, 0XDE36, 0XDE36,
-  0XD636, 0XD656, 0XD635, 0XD655, 0XD635, 0XD635, 0XD614, 0XD5F4,
-  0XD5F3, 0XD5D3, 0XCDB2, 0XCD92, 0XCD71, 0XC510, 0XC530, 0XC530,
-  0XC530, 0XC510, 0XBCCF, 0XBCAF, 0XBCAE, 0XBC6D, 0XB44D, 0XB40B,
-  0XABCB, 0XABEB, 0XABCB, 0XABAB, 0XA38A, 0XA36A, 0XA349, 0X9B29,
-  0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X9286, 0X8A66, 0X8A25, 0X8205,
-  0X8205, 0X81E4, 0X79A4, 0X7983, 0X7963, 0X7963, 0X7143, 0X7142,
-  0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122,
-  0X7142, 0X7163, 0X7963, 0X7983, 0X79A4, 0X81C4, 0X81E4, 0X8205,
-  0X8A25, 0X8A45, 0X8A66, 0X9286, 0X92A7, 0X92C7, 0X9AE8, 0X9B08,
-  0X9B28, 0X9B49, 0XA38A, 0XA3AA, 0XABCB, 0XABCB, 0XAC0C, 0XB42C,
-  0XB44D, 0XB48E, 0XB48D, 0XBCAD, 0XBC8D, 0XBCAE, 0XC510, 0XC551,
-  0XCD71, 0XCD92, 0XCD92, 0XCDB3, 0XCDF3, 0XD5F4, 0XD614, 0XD634,
-  0XD613, 0XDDF3, 0XDE35, 0XDE76, 0XE697, 0XDE97, 0XE696, 0XE6B7,
-  0XE6D8, 0XEEF8, 0XEF18, 0XEF17, 0XE696, 0XEEB8, 0XF759, 0XE591,
-  0XF637, 0XF77B, 0XF75A, 0XF73A, 0XF77A, 0XF759, 0XEF19, 0XF75B,
-  0XFF7B, 0XF6D8, 0XF719, 0XFF7C, 0XF73A, 0XEF39, 0XFF9C, 0XF77C,
-  0XFF9C, 0XF7BD, 0XFFDE, 0XFFFF, 0XFFDE, 0XFFDE, 0XFFDE, 0XF79D,
-  0XF79C, 0XF7DE, 0XF7DE, 0XF7DE, 0XF7DE, 0XFFDE, 0XF7BD, 0XF7BD,
-  0XFFDE, 0XF7DE, 0XFFDE, 0XFFBD, 0XF79D, 0XF7BD, 0XF7BD, 0XF79C,
-  0XF73B, 0XF77C, 0XF71A, 0XF73B, 0XF77C, 0XF79C, 0XF77C, 0XEF5C,
-  0XEF3B, 0XEF3B, 0XEF3B, 0XF75C, 0XEF5C, 0XEF1B, 0XEEFA, 0XEF1A,
-  0XEEFA, 0XE6DA, 0XE6D9, 0XE6D9, 0XE698, 0XDE77, 0XDE77, 0XD656,
-  0XD656, 0XD656, 0XD656, 0XD655, 0XD655, 0XD655, 0XD635, 0XD615,
-  0XD5F4, 0XD5F4, 0XD5D3, 0XD591, 0XCD30, 0XCD31, 0XCD72, 0XCD51,
-  0XC551, 0XC530, 0XC50F, 0XC4EF, 0XBCCF, 0XBC8E, 0XBC6E, 0XB42C,
-  0XB3CB, 0XB3EB, 0XABEB, 0XABCB, 0XABAB, 0XAB8A, 0XA36A, 0XA349,
-  0X9B29, 0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X8A66, 0X8A46, 0X8A25,
-  0X8205, 0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7963, 0X7142,
-  0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7142,
-  0X7163, 0X7963, 0X7983, 0X79A4, 0X79C4, 0X81E4, 0X8204, 0X8225,
-  0X8A45, 0X8A46, 0X8A66, 0X92A7, 0X92C8, 0X9AE8, 0X9B08, 0X9B29,
-  0XA369, 0XA369, 0XA38A, 0XABCB, 0XABEB, 0XABEB, 0XAC2C, 0XB44D,
-  0XB46D, 0XBCAE, 0XB48D, 0XBCCE, 0XBC8E, 0XBCAE, 0XCD51, 0XCD51,
-  0XCD92, 0XCDB2, 0XD5D3, 0XCDD3, 0XCDD3, 0XD5F4, 0XD614, 0XD614,
-  0XDE34, 0XDE14, 0XDE56, 0XE697, 0XE697, 0XE6B7, 0XE6D7, 0XE6B7,
-  0XEED7, 0XEED6, 0XEE94, 0XEEF7, 0XE6F8, 0XE6B7, 0XFF7A, 0XE5B1,
-  0XEDD4, 0XF77B, 0XF77B, 0XF75A, 0XF75A, 0XF77A, 0XF75A, 0XF75A,
-  0XFF9B, 0XF71A, 0XF6D8, 0XFF7B, 0XF79C, 0XF75A, 0XFF7C, 0XF77C,
-  0XF79C, 0XF7BC, 0XFFBD, 0XFFBD, 0XF77D, 0XFFBD, 0XFFDE, 0XF7BD,
-  0XF77C, 0XF79D, 0XF7DE, 0XF7DE, 0XF7DE, 0XFFDE, 0XF7BE, 0XF7BE,
-  0XFFDE, 0XF7DE, 0XFFDE, 0XF7BE, 0XF79D, 0XFFBE, 0XF7BE, 0XF79D,
-  0XF73B, 0XF71B, 0XF75B, 0XF79D, 0XF79D, 0XF7BD, 0XF7BD, 0XEF5C,
-  0XEF5C, 0XF75C, 0XF77C, 0XF77C, 0XF77C, 0XEF3B, 0XEEFA, 0XEF1A,
-  0XEF3A, 0XEF1A, 0XEEFA, 0XEEF9, 0XE6B8, 0XDE78, 0XDE77, 0XD677,
-  0XD656, 0XD656, 0XD697, 0XD676, 0XD655, 0XDE76, 0XDE56, 0XD636,
-  0XD614, 0XD5F3, 0XD5D2, 0XCD71, 0XCD71, 0XCD92, 0XD592, 0XCD92,
-  0XCD71, 0XCD30, 0XC530, 0XC510, 0XC4EF, 0XBCCF, 0XBC8E, 0XBC4C,
-  0XB40C, 0XB3EB, 0XABEB, 0XABCB, 0XABCB, 0XABAA, 0XA38A, 0XA36A,
-  0XA349, 0X9B29, 0X9B08, 0X9AE8, 0X92A7, 0X9287, 0X8A66, 0X8A46,
-  0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7143,
-  0X7142, 0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142,
-  0X7963, 0X7983, 0X79A3, 0X79C4, 0X81E4, 0X8204, 0X8205, 0X8A25,
-  0X8A45, 0X8A66, 0X9286, 0X92C7, 0X9AE8, 0X9B08, 0X9B29, 0XA349,
-  0XA36A, 0XA38A, 0XA3AA, 0XABEB, 0XABEB, 0XAC0C, 0XB44D, 0XB46E,
-  0XBC8E, 0XBCAE, 0XBCCE, 0XBCEF, 0XBCCE, 0XC4AE, 0XCD50, 0XCD72,
-  0XCD92, 0XCDB3, 0XD5D3, 0XCDD3, 0XCDD3, 0XD614, 0XDE35, 0XDE35,
-  0XDE76, 0XDE35, 0XDE56, 0XE6B7, 0XE6B7, 0XE6F8, 0XEF18, 0XE6F8,
-  0XEEF7, 0XEEB6, 0XE696, 0XEEF8, 0XEF59, 0XEE96, 0XFF5A, 0XEE95,
-  0XE531, 0XFF3B, 0XF79C, 0XF77B, 0XF77B, 0XF77B, 0XF77B, 0XF75A,
-  0XF79B, 0XF75B, 0XF6D9, 0XFF9C, 0XF79C, 0XF75B, 0XFF7C, 0XFFFE,
-  0XF7DE, 0XFFBE, 0XFFBD, 0XF79C, 0XFF7C, 0XFF7C, 0XF75B, 0XEF5B,
-  0XF77C, 0XF79D, 0XF7BE, 0XFFDE, 0XF7DE, 0XFFDF, 0XFFFF, 0XF7DE,
-  0XF7BE, 0XF7BE, 0XF7BE, 0XF77D, 0XF7BE, 0XFFBE, 0XF7BE, 0XF77D,
-  0XF77D, 0XF6FA, 0XF73B, 0XF7DE, 0XF7BD, 0XF7BD, 0XF79D, 0XEF5C,
-  0XF75C, 0XF79D, 0XF79C, 0XF77D, 0XF77C, 0XEF7C, 0XEF3B, 0XEF3B,
-  0XEF3B, 0XEF1A, 0XEF1A, 0XEEFA, 0XE6D9, 0XE6D9, 0XDE98, 0XDE77,
-  0XDE57, 0XD656, 0XD677, 0XD677, 0XD656, 0XDE76, 0XDE76, 0XDE55,
-  0XD5F4, 0XD5B3, 0XD5B3, 0XD5D4, 0XD5D3, 0XD5B2, 0XD5B2, 0XCD92,
-  0XCD71, 0XCD50, 0XCD30, 0XC530, 0XC510, 0XC4EF, 0XBCAE, 0XBC6D,
-  0XBC6D, 0XB42D, 0XB3EC, 0XB3EB, 0XABCB, 0XABAA, 0XAB8A, 0XA38A,
-  0XA36A, 0XA349, 0X9B28, 0X9B08, 0X92C8, 0X92A7, 0X9287, 0X8A66,
-  0X8A46, 0X8A25, 0X8205, 0X81C4, 0X79A4, 0X79A3, 0X7983, 0X7963,
-  0X7142, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7142, 0X7163,
-  0X7963, 0X7983, 0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A45,
-  0X8A66, 0X9286, 0X92A7, 0X9AC7, 0X9B08, 0X9B28, 0X9B49, 0XA369,
-  0XA3AA, 0XABAA, 0XABCA, 0XABEB, 0XAC0C, 0XB42C, 0XB46D, 0XBC8E,
-  0XBCCE, 0XBCCE, 0XBCEF, 0XBCEF, 0XC510, 0XC50F, 0XCD50, 0XCD91,
-  0XCDB2, 0XCDD3, 0XCDD3, 0XD5D3, 0XD5F4, 0XDE55, 0XDE56, 0XDE76,
-  0XE697, 0XDE55, 0XDE56, 0XDEB7, 0XE6D8, 0XEF19, 0XEF19, 0XEF19,
-  0XEEF8, 0XEED8, 0XF75A, 0XEF18, 0XEF38, 0XEEB7, 0XEEF9, 0XF739,
-  0XE4F0, 0XF6B8, 0XF7DD, 0XF79C, 0XF79C, 0XF7BD, 0XF77C, 0XF75B,
-  0XF77C, 0XF77B, 0XF6D9, 0XFF9C, 0XFFFE, 0XF77C, 0XF77B, 0XFFBD,
-  0XFFDD, 0XFFBC, 0XFF7C, 0XFFBD, 0XFFBE, 0XFF9D, 0XF77D, 0XF79D,
-  0XEF7C, 0XF77D, 0XEF7D, 0XF79D, 0XF7BE, 0XF7DF, 0XF7DF, 0XF7BE,
-  0XF7BE, 0XF7DE, 0XF79D, 0XEF7D, 0XFFDE, 0XF7BE, 0XF79D, 0XF77D,
-  0XF79D, 0XEF3B, 0XF73C, 0XF7BE, 0XF7BE, 0XF79D, 0XF77D, 0XF75D,
-  0XF77D, 0XF77D, 0XF79D, 0XF79D, 0XF77C, 0XEF5C, 0XEF5C, 0XEF5B,
-  0XEF3B, 0XEF1B, 0XEEFA, 0XEEFA, 0XEF1A, 0XE6FA, 0XE6B9, 0XDE77,
-  0XDE77, 0XDE77, 0XDE97, 0XDE97, 0XDE36, 0XDE56, 0XDE35, 0XDE14,
-  0XDE14, 0XD5F4, 0XD615, 0XD635, 0XD614, 0XD5D3, 0XD5D3, 0XCDD2,
-  0XCD92, 0XCD71, 0XCD30, 0XC530, 0XC530, 0XC4EF, 0XC4AE, 0XBC8D,
-  0XBC8E, 0XBC6E, 0XBC4D, 0XB42C, 0XB3EB, 0XABCB, 0XAB8A, 0XAB8A,
-  0XA38A, 0XA369, 0X9B49, 0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X9286,
-  0X8A66, 0X8A45, 0X8205, 0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7963,
-  0X7963, 0X7142, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7142, 0X7142, 0X7963,
-  0X7983, 0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A45, 0X8A66,
-  0X9286, 0X92A7, 0X92A7, 0X9AE8, 0X9B28, 0X9B49, 0XA369, 0XA38A,
-  0XABAA, 0XABCA, 0XABEB, 0XAC0C, 0XB42C, 0XB44D, 0XB46E, 0XBCAE,
-  0XBCCF, 0XBCEF, 0XC50F, 0XC50F, 0XC550, 0XC571, 0XC550, 0XCD51,
-  0XCD92, 0XCDD3, 0XD5F4, 0XD5F4, 0XD635, 0XDE76, 0XDE76, 0XE697,
-  0XE6B7, 0XE675, 0XDE75, 0XDEB7, 0XEF19, 0XEF3A, 0XEF3A, 0XEF3A,
-  0XEF18, 0XEF19, 0XF75A, 0XEF17, 0XF739, 0XF75A, 0XEEF9, 0XFF9A,
-  0XE551, 0XEDF5, 0XF7DD, 0XF7BD, 0XF7BD, 0XF7BD, 0XF79D, 0XF79C,
-  0XF77C, 0XF7BD, 0XF71B, 0XF6DA, 0XFFDD, 0XF7DE, 0XF79C, 0XF75B,
-  0XFF7C, 0XFF9C, 0XF77C, 0XFFBE, 0XFFFF, 0XFFDF, 0XF79E, 0XF7DF,
-  0XF79E, 0XE73C, 0XEF3C, 0XEF5D, 0XF79E, 0XF7DF, 0XF7DF, 0XF7BE,
-  0XF7DF, 0XFFFF, 0XF77D, 0XF79E, 0XF7BE, 0XF79E, 0XF79D, 0XF79E,
-  0XF7BD, 0XF75C, 0XF75C, 0XEF5D, 0XF77D, 0XF77E, 0XF77D, 0XF79D,
-  0XF79D, 0XF79D, 0XF79E, 0XF79D, 0XF77D, 0XEF5C, 0XEF5C, 0XEF5C,
-  0XEF3B, 0XEF3B, 0XEF1B, 0XEF1B, 0XEF3B, 0XEF1A, 0XE6D9, 0XDE98,
-  0XDE77, 0XDE77, 0XDEB7, 0XDE97, 0XDE56, 0XDE35, 0XD5F4, 0XD615,
-  0XDE56, 0XDE76, 0XDE56, 0XDE55, 0XDE55, 0XD614, 0XD5F3, 0XD5F3,
-  0XCDD2, 0XD5B2, 0XCD71, 0XCD2F, 0XCD30, 0XC4EF, 0XC4AE, 0XC4AF,
-  0XBCAF, 0XBCAE, 0XBC6E, 0XB44D, 0XB42C, 0XB40C, 0XABEB, 0XAB8A,
-  0XAB69, 0XA36A, 0XA369, 0X9B29, 0X9B08, 0X9AE8, 0X92C7, 0X92A7,
-  0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A4, 0X7983,
-  0X7963, 0X7163, 0X7142, 0X7122, 0X7102, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7963, 0X7983,
-  0X79A3, 0X79C4, 0X81E4, 0X8205, 0X8205, 0X8A45, 0X8A66, 0X9286,
-  0X92A7, 0X92C7, 0X9AC7, 0X9AE7, 0X9B28, 0XA369, 0XA38A, 0XABAA,
-  0XABCA, 0XABEB, 0XAC0C, 0XB42C, 0XB44D, 0XB46D, 0XBC8E, 0XBCCF,
-  0XBCEF, 0XC4EF, 0XC50F, 0XC530, 0XC551, 0XC571, 0XCD91, 0XCD51,
-  0XCD71, 0XD5D3, 0XD613, 0XD634, 0XDE56, 0XDE76, 0XE697, 0XE697,
-  0XE6B8, 0XE696, 0XE695, 0XEEF9, 0XEF3A, 0XEF3A, 0XEF5B, 0XF77B,
-  0XE719, 0XEF39, 0XF739, 0XF719, 0XEF5B, 0XF77C, 0XF739, 0XFF7A,
-  0XEDF4, 0XEDD4, 0XFFBD, 0XF7BD, 0XFFBE, 0XF7BE, 0XFFDE, 0XFFDE,
-  0XF7BD, 0XFFBD, 0XFFDE, 0XEEDA, 0XF73B, 0XFFDD, 0XF77D, 0XF77C,
-  0XF79D, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XF7DF, 0XF7BE,
-  0XF7BE, 0XEF7D, 0XEF7D, 0XF79E, 0XEF9E, 0XF7DF, 0XF7DF, 0XF7DF,
-  0XF7BE, 0XEF7D, 0XEF5D, 0XF7BE, 0XF7BE, 0XF7BE, 0XF79E, 0XEF7D,
-  0XF7BE, 0XEF5C, 0XEF3C, 0XEF3D, 0XEF5D, 0XF77E, 0XF79E, 0XF79D,
-  0XF79D, 0XF79E, 0XF79E, 0XF77D, 0XF77D, 0XEF7D, 0XEF5C, 0XEF5C,
-  0XEF7C, 0XEF5C, 0XEF5C, 0XEF3C, 0XEF3B, 0XEF3B, 0XE6F9, 0XDEB8,
-  0XDE98, 0XDEB8, 0XDED8, 0XDEB7, 0XDE55, 0XD5D3, 0XDE36, 0XDE77,
-  0XDE76, 0XDE96, 0XDE96, 0XDE76, 0XDE55, 0XDE35, 0XD614, 0XD613,
-  0XCDF3, 0XCDD3, 0XD5B2, 0XCD71, 0XCD2F, 0XC4AE, 0XC4CE, 0XC4EF,
-  0XC4CE, 0XBCAE, 0XBC8E, 0XBC6D, 0XB44D, 0XB42D, 0XB40C, 0XABEB,
-  0XABAA, 0XA349, 0XA369, 0XA369, 0X9B29, 0X9B08, 0X9AE8, 0X92A7,
-  0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X79C4, 0X79A4,
-  0X7983, 0X7963, 0X7142, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7122, 0X7142, 0X7163, 0X7963, 0X7983,
-  0X79A4, 0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A46, 0X8A86, 0X92A7,
-  0X92C7, 0X9AE7, 0X9B08, 0X9B28, 0XA348, 0XA369, 0XA3AA, 0XABCB,
-  0XABEB, 0XAC0B, 0XB42C, 0XB44D, 0XB46D, 0XBC8E, 0XBCAE, 0XBCEF,
-  0XC50F, 0XC4EF, 0XC530, 0XCD71, 0XCD72, 0XCD91, 0XCD91, 0XCD71,
-  0XCDB2, 0XD614, 0XD634, 0XDE55, 0XDE76, 0XE697, 0XE6B7, 0XE6B7,
-  0XE6D8, 0XE6D7, 0XE6B6, 0XEEF9, 0XEF3A, 0XEF5A, 0XF759, 0XF759,
-  0XF79A, 0XEF17, 0XF739, 0XF77B, 0XF77C, 0XF79C, 0XF73A, 0XFF5A,
-  0XEE77, 0XEDB4, 0XFFBD, 0XF7DD, 0XF7BE, 0XFFBE, 0XFFFF, 0XFFFF,
-  0XFFDE, 0XF7BE, 0XF7BE, 0XF7BE, 0XEEFB, 0XF71B, 0XF7BE, 0XF7BD,
-  0XF79D, 0XF7DF, 0XF7FF, 0XF7DE, 0XF7BE, 0XF7DF, 0XF7BE, 0XEFBE,
-  0XEF9E, 0XF79E, 0XEF5D, 0XF79E, 0XF7BF, 0XEF9E, 0XF79E, 0XEF5D,
-  0XEF3C, 0XE73C, 0XEF7E, 0XF7DF, 0XF7BE, 0XF7BE, 0XEF7E, 0XEF7E,
-  0XF7DF, 0XE71C, 0XEEDC, 0XEF5E, 0XF79E, 0XF79E, 0XF77E, 0XF79E,
-  0XEF9D, 0XEF9E, 0XEF9D, 0XEF5D, 0XEF7D, 0XEF7D, 0XEF5C, 0XEF7C,
-  0XEF7C, 0XEF7C, 0XEF5C, 0XEF5C, 0XEF3B, 0XEF3B, 0XE6FA, 0XDEB9,
-  0XDED8, 0XDEB7, 0XDE77, 0XDE77, 0XDE35, 0XDE34, 0XDE56, 0XDE97,
-  0XDE97, 0XDE96, 0XDE97, 0XDE96, 0XDE96, 0XDE55, 0XD614, 0XD614,
-  0XD634, 0XD613, 0XD5D3, 0XCDB2, 0XCD71, 0XCD30, 0XCD0F, 0XC50F,
-  0XC4EF, 0XBCCE, 0XBCAD, 0XBC6D, 0XBC4D, 0XB44D, 0XB42C, 0XAC0C,
-  0XABEB, 0XABAA, 0XA349, 0XA328, 0X9B08, 0X9B08, 0X9B08, 0X92C8,
-  0X92A7, 0X9286, 0X8A66, 0X8A45, 0X8A25, 0X8205, 0X81E4, 0X79A4,
-  0X7983, 0X7963, 0X7963, 0X7142, 0X7122, 0X7102, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7963, 0X7983, 0X79A3,
-  0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A45, 0X8A66, 0X9286, 0X92A7,
-  0X92C7, 0X9AE8, 0X9B28, 0XA349, 0XA369, 0XA389, 0XA3AA, 0XABEB,
-  0XAC0B, 0XAC0B, 0XB42C, 0XB46D, 0XBC8D, 0XBCAE, 0XBCAE, 0XC4CE,
-  0XC4EF, 0XC4EF, 0XCD51, 0XCD92, 0XCDB2, 0XCDB2, 0XCD71, 0XCD92,
-  0XD5F4, 0XDE55, 0XDE55, 0XDE76, 0XE697, 0XE6D7, 0XE6D8, 0XE6D7,
-  0XE6D8, 0XE6F7, 0XEED7, 0XEF19, 0XEF3A, 0XF77B, 0XEF59, 0XEEF6,
-  0XF6F6, 0XF718, 0XF75B, 0XF7BC, 0XF79C, 0XFFBC, 0XFF7C, 0XF77C,
-  0XF6F9, 0XE573, 0XFF1B, 0XF7FE, 0XF7DE, 0XFFDE, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XF7DF, 0XF7DE, 0XF7BD, 0XEE98, 0XF71B, 0XFFFF, 0XF7BE,
-  0XF7BE, 0XF79E, 0XF7DF, 0XF7DE, 0XF7BE, 0XF79E, 0XEF9E, 0XEF9E,
-  0XEFBE, 0XEFBE, 0XE77E, 0XEFBF, 0XF7DF, 0XEF9E, 0XEF5E, 0XEF3D,
-  0XEF9E, 0XEF5D, 0XEF7E, 0XF7BF, 0XF7BE, 0XF7BE, 0XEF7E, 0XEF7E,
-  0XEF9E, 0XE6DB, 0XEF3E, 0XEF5E, 0XF79E, 0XF7BF, 0XEF9E, 0XEF7E,
-  0XEF7E, 0XEF9E, 0XEF9E, 0XEF7D, 0XEF7D, 0XEF5C, 0XEF5C, 0XEF5C,
-  0XEF7D, 0XEF5C, 0XEF5C, 0XEF5C, 0XEF3C, 0XEF1B, 0XE6D9, 0XDE98,
-  0XDE77, 0XDE76, 0XDE98, 0XDEB8, 0XDE97, 0XDE76, 0XDE56, 0XDE96,
-  0XE6D7, 0XDE97, 0XDE96, 0XDE96, 0XDE96, 0XDE96, 0XDE55, 0XD635,
-  0XDE35, 0XD634, 0XD5F4, 0XCDD3, 0XCDB2, 0XCD71, 0XCD51, 0XCD51,
-  0XC530, 0XC510, 0XC4CF, 0XBC8E, 0XBC4D, 0XBC6D, 0XB44D, 0XB42C,
-  0XAC0C, 0XABEB, 0XAB8A, 0XA308, 0X9B08, 0X9B08, 0X9AE8, 0X9AE8,
-  0X92C7, 0X92A7, 0X8A86, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4,
-  0X79A4, 0X7983, 0X7963, 0X7143, 0X7142, 0X7122, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X7102, 0X7122, 0X7142, 0X7163, 0X7963, 0X7983, 0X79A4,
-  0X81E4, 0X8205, 0X8205, 0X8A45, 0X8A66, 0X9286, 0X92A7, 0X92C7,
-  0X9AE8, 0X9B08, 0X9B28, 0XA369, 0XA38A, 0XABAA, 0XABCA, 0XABEA,
-  0XAC0B, 0XB42C, 0XB46D, 0XBC8D, 0XBCAE, 0XBCCF, 0XBCCF, 0XC4EF,
-  0XC530, 0XC530, 0XCD71, 0XCD92, 0XCDB3, 0XCDD2, 0XCDB2, 0XD5B3,
-  0XDE35, 0XDE55, 0XDE76, 0XE6B7, 0XE6D8, 0XE6D8, 0XE6D8, 0XEEF9,
-  0XEEF9, 0XEEF7, 0XEEB6, 0XF719, 0XEF7B, 0XF79B, 0XEF39, 0XEEF7,
-  0XEEF7, 0XF75A, 0XF79C, 0XF7BD, 0XFFBD, 0XF79C, 0XF7BD, 0XF77C,
-  0XFF9C, 0XE573, 0XEDB6, 0XFFDE, 0XF7DE, 0XF7DE, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XF7FF, 0XF7DE, 0XF6FA, 0XEE58, 0XEEBA, 0XF79D, 0XF7FF,
-  0XF7DF, 0XF79E, 0XF79E, 0XF7BE, 0XF7BE, 0XF7BE, 0XF79E, 0XF79E,
-  0XEF9E, 0XEF7E, 0XE77E, 0XEFBF, 0XE73D, 0XE71C, 0XF79F, 0XEF9E,
-  0XEF9E, 0XEF5D, 0XEF7D, 0XEF7E, 0XE77E, 0XE77E, 0XE75E, 0XEF9F,
-  0XE73C, 0XE6FC, 0XF79F, 0XEF5D, 0XEF7E, 0XF79E, 0XEF9E, 0XEF7E,
-  0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF5D, 0XE71C, 0XEF3C, 0XEF3C,
-  0XEF5C, 0XEF5C, 0XEF7D, 0XEF7C, 0XEF5C, 0XE71B, 0XE6FA, 0XDEB9,
-  0XDE78, 0XDE98, 0XDEF9, 0XDF19, 0XE719, 0XDED9, 0XDEF8, 0XDEB7,
-  0XDEB7, 0XE6D8, 0XDEB7, 0XDE76, 0XDE76, 0XDE96, 0XDE55, 0XDE55,
-  0XD655, 0XD635, 0XD615, 0XD5F4, 0XD5D3, 0XCD92, 0XCD91, 0XCD71,
-  0XCD50, 0XC530, 0XC510, 0XC4CF, 0XBCAE, 0XBC8D, 0XBC4D, 0XB42C,
-  0XB42C, 0XABEC, 0XABCB, 0XA369, 0XA349, 0XA329, 0X9B08, 0X9AC7,
-  0X92A7, 0X9286, 0X9266, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4,
-  0X79C4, 0X79A3, 0X7983, 0X7963, 0X7142, 0X7122, 0X7102, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7122, 0X7142, 0X7142, 0X7963, 0X7983, 0X79A4, 0X81C4,
-  0X81E4, 0X8205, 0X8A25, 0X8A46, 0X8A66, 0X92A7, 0X92C7, 0X9AE8,
-  0X9B08, 0X9B28, 0XA348, 0XA369, 0XABAA, 0XABEB, 0XABEB, 0XAC0B,
-  0XB42B, 0XB46C, 0XBC8D, 0XBCAE, 0XBCCF, 0XC4EF, 0XBCEF, 0XC510,
-  0XC551, 0XC551, 0XCD71, 0XCDB2, 0XCDD3, 0XCDF3, 0XCDF3, 0XD5F3,
-  0XDE35, 0XDE76, 0XDE97, 0XE6D7, 0XE6F8, 0XE6D8, 0XEEF8, 0XEF19,
-  0XEF18, 0XEF18, 0XEEB7, 0XF6F8, 0XF77B, 0XF77B, 0XF77B, 0XF718,
-  0XF73A, 0XF79C, 0XF7BC, 0XF79D, 0XF79D, 0XFFDD, 0XFFBB, 0XFF7B,
-  0XFFFF, 0XE656, 0XDCD2, 0XFF3C, 0XF77D, 0XF79D, 0XF77D, 0XF79E,
-  0XF7BE, 0XF7BE, 0XF75C, 0XEF1C, 0XEF1C, 0XEEB9, 0XEEFA, 0XF77D,
-  0XF7DF, 0XF7DF, 0XEF9E, 0XEF5D, 0XF77D, 0XFFDF, 0XF7BE, 0XF79E,
-  0XEF9F, 0XEFDF, 0XE77D, 0XD6BA, 0XD65A, 0XDE9B, 0XEF3D, 0XEF7E,
-  0XE71C, 0XE71C, 0XE71D, 0XE75D, 0XE75D, 0XE73D, 0XEF5E, 0XE73C,
-  0XDEB9, 0XEF3D, 0XF79E, 0XEF5D, 0XEF5E, 0XEF7E, 0XEF7E, 0XEF7E,
-  0XEF7D, 0XEF5D, 0XEF5D, 0XEF7D, 0XEF3D, 0XE71C, 0XE73C, 0XEF7D,
-  0XEF5C, 0XEF5C, 0XEF5C, 0XEF7C, 0XEF3C, 0XE6FA, 0XE6D9, 0XDED9,
-  0XE6D9, 0XE6D9, 0XE71A, 0XE73A, 0XE73A, 0XE719, 0XDF18, 0XDEF8,
-  0XDED7, 0XE6D8, 0XE6D8, 0XE6B7, 0XE676, 0XE676, 0XDE76, 0XDE55,
-  0XDE55, 0XDE55, 0XDE35, 0XDE34, 0XD5F3, 0XD5B2, 0XD5B2, 0XCD92,
-  0XCD71, 0XCD51, 0XC530, 0XC4EF, 0XBCCF, 0XBCAE, 0XBC6D, 0XBC4C,
-  0XB42C, 0XB40C, 0XABEB, 0XAB8A, 0XA349, 0XA349, 0X9B29, 0X9B08,
-  0X92C7, 0X9287, 0X9266, 0X8A46, 0X8A45, 0X8A25, 0X8205, 0X81E5,
-  0X81C4, 0X79A4, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7102,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X7102, 0X7122, 0X7142, 0X7963, 0X7963, 0X79A3, 0X79C4, 0X81E4,
-  0X8204, 0X8225, 0X8A45, 0X8A66, 0X9286, 0X92A7, 0X9AE7, 0X9B08,
-  0X9B28, 0XA349, 0XA349, 0XA389, 0XABCA, 0XABEB, 0XB40B, 0XB42C,
-  0XB44D, 0XB46C, 0XBC8D, 0XBCCF, 0XBCEF, 0XC4EF, 0XC510, 0XC531,
-  0XCD71, 0XCD92, 0XC571, 0XCD92, 0XD5F4, 0XD5F4, 0XCDD3, 0XD5F4,
-  0XDE76, 0XDE97, 0XE6B7, 0XE6D8, 0XE6F8, 0XE6F8, 0XEF19, 0XEF39,
-  0XEF38, 0XF759, 0XEF19, 0XEEF9, 0XF759, 0XF75A, 0XF7BD, 0XF77B,
-  0XEED7, 0XF759, 0XF79C, 0XF7BD, 0XFFDD, 0XFF5A, 0XF656, 0XF657,
-  0XFF7B, 0XEDD5, 0XE4F4, 0XFF5D, 0XF77D, 0XF79E, 0XF79E, 0XF7BE,
-  0XEF9D, 0XEF5C, 0XF75D, 0XF7DF, 0XEF5D, 0XE6FB, 0XEF1C, 0XEEFB,
-  0XEF3C, 0XEF5D, 0XEF7D, 0XEF9E, 0XF79E, 0XEF9E, 0XEF7D, 0XEF9E,
-  0XEF9D, 0XE71B, 0XD69A, 0XD6BB, 0XDEFC, 0XDEDB, 0XDEBB, 0XDEFC,
-  0XDF1D, 0XE73D, 0XE71D, 0XE73D, 0XEF7E, 0XE73D, 0XE73D, 0XDEDB,
-  0XE6DB, 0XEF7F, 0XEF7E, 0XEF5E, 0XEF5D, 0XEF5D, 0XEF7E, 0XEF7E,
-  0XEF7E, 0XEF5D, 0XEF3D, 0XEF5D, 0XE73D, 0XE71C, 0XE73C, 0XEF7D,
-  0XEF7D, 0XE73C, 0XE73C, 0XEF5C, 0XE73C, 0XE6DA, 0XE6DA, 0XE6FA,
-  0XDED9, 0XDEF9, 0XE71A, 0XE73A, 0XE73A, 0XE73A, 0XDF19, 0XDEF8,
-  0XDED8, 0XE6D8, 0XE6F8, 0XE6D7, 0XE696, 0XE696, 0XDE76, 0XDE76,
-  0XDE55, 0XDE55, 0XDE55, 0XDE34, 0XD613, 0XD5F3, 0XD5D3, 0XCDB3,
-  0XCD92, 0XCD71, 0XCD51, 0XC530, 0XC4F0, 0XBCCF, 0XBCAE, 0XBC6D,
-  0XB44C, 0XB42C, 0XAC0C, 0XABAA, 0XA349, 0XA349, 0X9B49, 0X9B08,
-  0X9AE8, 0X9AC8, 0X92A7, 0X9266, 0X8A45, 0X8A25, 0X8A05, 0X8205,
-  0X81E4, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7142, 0X7122, 0X7122,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7983, 0X79A4, 0X81C4, 0X81E4,
-  0X8205, 0X8A25, 0X8A66, 0X9286, 0X92A7, 0X92C7, 0X9AE8, 0X9B08,
-  0X9B49, 0XA369, 0XA389, 0XAB89, 0XABAA, 0XABEB, 0XB42C, 0XB44D,
-  0XB46D, 0XBC8D, 0XBCAE, 0XBCCE, 0XBCEF, 0XBCEF, 0XC530, 0XC571,
-  0XCD92, 0XCDB3, 0XCDB3, 0XCD92, 0XD5B2, 0XD5B3, 0XD592, 0XDDD4,
-  0XE696, 0XE6B7, 0XE6B7, 0XE6D8, 0XE6D8, 0XE6F9, 0XEF3A, 0XEF39,
-  0XEF59, 0XF77A, 0XF77A, 0XF739, 0XF759, 0XF75A, 0XF77C, 0XF79C,
-  0XF759, 0XEEB6, 0XF75B, 0XFFFD, 0XF6D7, 0XED12, 0XE534, 0XDD33,
-  0XE4D1, 0XECD2, 0XF659, 0XF79E, 0XF77E, 0XF79E, 0XF7DF, 0XF7DF,
-  0XF7BE, 0XEF9E, 0XF7DF, 0XF79E, 0XEF7D, 0XEF5D, 0XEF7D, 0XEF5D,
-  0XE6FB, 0XE6BA, 0XEEDB, 0XEF5C, 0XEF7D, 0XEF3C, 0XE73C, 0XE71C,
-  0XE6DA, 0XDE9A, 0XD69B, 0XD6FC, 0XD6DB, 0XDEFD, 0XE71D, 0XD6BB,
-  0XDF1D, 0XE79E, 0XDF3D, 0XD6FC, 0XE73D, 0XDF1D, 0XDF1C, 0XDEBA,
-  0XE6FC, 0XE75E, 0XE75E, 0XE73D, 0XE73D, 0XE73D, 0XE73D, 0XEF5D,
-  0XEF7E, 0XE75D, 0XE73D, 0XE73D, 0XE71C, 0XE71C, 0XE75D, 0XE75D,
-  0XE75D, 0XE73C, 0XE71C, 0XE71C, 0XE6FB, 0XDEBA, 0XDEDA, 0XDEFA,
-  0XDED9, 0XDEF9, 0XE6FA, 0XE73A, 0XE75A, 0XE75A, 0XE73A, 0XDF19,
-  0XE6D8, 0XE719, 0XE6F8, 0XE6D7, 0XDEB7, 0XE6B7, 0XDE96, 0XDE96,
-  0XDE76, 0XDE55, 0XDE54, 0XDE35, 0XDE34, 0XD614, 0XD5F4, 0XD5D3,
-  0XD5B3, 0XCD72, 0XCD51, 0XC531, 0XC510, 0XC4EF, 0XBCCE, 0XBC8E,
-  0XBC6E, 0XB44C, 0XB42B, 0XABEB, 0XAB69, 0XA328, 0XA349, 0X9B28,
-  0X9AE8, 0X9AE8, 0X92C7, 0X9287, 0X8A66, 0X8A45, 0X8A25, 0X8205,
-  0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122,
-  0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7122, 0X7142, 0X7143, 0X7963, 0X7983, 0X79A4, 0X81E4, 0X8205,
-  0X8225, 0X8A45, 0X8A66, 0X9286, 0X92C7, 0X92E8, 0X9B08, 0X9B29,
-  0XA349, 0XA38A, 0XA3AA, 0XAB8A, 0XABCB, 0XB42C, 0XB44D, 0XB46D,
-  0XBC8E, 0XBCAF, 0XBCCF, 0XBCCE, 0XBCEF, 0XC50F, 0XC551, 0XCD71,
-  0XCD92, 0XCDB2, 0XD5D3, 0XCDB2, 0XCDB2, 0XD5F3, 0XD5D3, 0XDDF4,
-  0XE655, 0XE695, 0XE6B6, 0XE6B7, 0XE6B7, 0XE6F8, 0XEF38, 0XEF39,
-  0XEF5A, 0XEF7B, 0XF77B, 0XF759, 0XF77B, 0XF79C, 0XF77B, 0XF75B,
-  0XF79C, 0XF79C, 0XF77B, 0XF718, 0XE572, 0XF638, 0XFF3C, 0XEE79,
-  0XEE17, 0XF6BA, 0XF75C, 0XF75C, 0XF77D, 0XEF7D, 0XF7BF, 0XF7DF,
-  0XF7BE, 0XF79E, 0XF79E, 0XEF7E, 0XEF7E, 0XF79E, 0XF79E, 0XEF3D,
-  0XEF3C, 0XEF5D, 0XEF3C, 0XE6DA, 0XE6FB, 0XEF1C, 0XEF3D, 0XE71C,
-  0XDEFC, 0XE73D, 0XDF1D, 0XD6BB, 0XDEFD, 0XE75F, 0XDF5E, 0XD6BB,
-  0XD6DC, 0XE77F, 0XDF7E, 0XD71C, 0XD6DB, 0XD6FC, 0XD6BA, 0XD69A,
-  0XDEFD, 0XDF3D, 0XDF3D, 0XDF1D, 0XDF1D, 0XDF1D, 0XE6FD, 0XE73D,
-  0XE73D, 0XE71D, 0XE73D, 0XE73D, 0XE71C, 0XE6FB, 0XE71C, 0XE71C,
-  0XDEFC, 0XDEFB, 0XE6FB, 0XE6FB, 0XE6DB, 0XDEDA, 0XDEDA, 0XDED9,
-  0XDED9, 0XDEFA, 0XDEFA, 0XE71A, 0XE75A, 0XE75B, 0XE73A, 0XE739,
-  0XDF18, 0XE6F8, 0XE6F8, 0XE6F8, 0XE6D8, 0XE6F8, 0XE6D8, 0XDEB7,
-  0XDE76, 0XDE96, 0XE675, 0XDE55, 0XDE34, 0XDE35, 0XD615, 0XD5D4,
-  0XD5D3, 0XCD93, 0XCD72, 0XCD51, 0XC530, 0XC510, 0XC4D0, 0XBCAF,
-  0XBC8E, 0XB44D, 0XB42C, 0XABEB, 0XAB8A, 0XA328, 0XA308, 0X9B08,
-  0X9B08, 0X9AE8, 0X9AC7, 0X92A7, 0X9286, 0X8A66, 0X8A46, 0X8A05,
-  0X81E4, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7142, 0X7122,
-  0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7142, 0X7963, 0X7983, 0X79A4, 0X81C4, 0X81E4, 0X8205,
-  0X8A25, 0X8A46, 0X8A66, 0X92A7, 0X92C7, 0X9B08, 0X9B28, 0XA349,
-  0XA369, 0XA38A, 0XABCA, 0XABCB, 0XABEB, 0XB42C, 0XB44D, 0XBC6D,
-  0XBCAE, 0XBCCF, 0XBCEF, 0XC510, 0XC50F, 0XC50F, 0XC551, 0XCD92,
-  0XCDB2, 0XCDD3, 0XD5F4, 0XD5F3, 0XD5F3, 0XD5D3, 0XD614, 0XDE35,
-  0XDE34, 0XDE55, 0XDE55, 0XDE55, 0XE6D7, 0XEF39, 0XEF3A, 0XEF5A,
-  0XF77B, 0XEF7B, 0XF77B, 0XF739, 0XF75A, 0XF79C, 0XF77C, 0XF79C,
-  0XF7BD, 0XFFFD, 0XFF9B, 0XE593, 0XED75, 0XFFBE, 0XFFDE, 0XFF7D,
-  0XF73C, 0XEF3C, 0XF77D, 0XF75C, 0XF77E, 0XF77E, 0XEF9E, 0XEFBE,
-  0XF7BE, 0XF79E, 0XEF7E, 0XEF5D, 0XEF7E, 0XEF9E, 0XF79E, 0XF79E,
-  0XEF3D, 0XEF7D, 0XEF9D, 0XE73C, 0XEF7D, 0XEF5D, 0XE6FB, 0XE6FC,
-  0XDF1D, 0XDF5E, 0XD71C, 0XD6DC, 0XE75F, 0XE77F, 0XDF3E, 0XD6DC,
-  0XD6BB, 0XD71D, 0XD75E, 0XD71D, 0XD6DB, 0XDF1B, 0XD6B9, 0XD6BB,
-  0XDF1D, 0XDF1C, 0XDF3D, 0XDF1D, 0XDEFD, 0XDF1D, 0XE71D, 0XE71D,
-  0XDF1D, 0XDF1D, 0XDF1D, 0XE71D, 0XE71C, 0XE6FB, 0XDEDB, 0XDEBB,
-  0XDEBB, 0XDEBB, 0XDEDB, 0XDEDB, 0XDEDB, 0XDEDA, 0XDEBA, 0XDEB9,
-  0XDEB9, 0XDEDA, 0XDED9, 0XDED9, 0XE73A, 0XE75A, 0XE75A, 0XE73A,
-  0XE73A, 0XE739, 0XE6F9, 0XE6F9, 0XE719, 0XE718, 0XE6F8, 0XE6F8,
-  0XDED7, 0XE697, 0XE696, 0XE675, 0XDDF3, 0XD5F4, 0XD615, 0XD614,
-  0XD5D4, 0XCDB3, 0XCD92, 0XCD72, 0XCD51, 0XC531, 0XC4F0, 0XC4CF,
-  0XBCAE, 0XBC6E, 0XB42D, 0XABEB, 0XAB89, 0XA349, 0XA329, 0XA2C7,
-  0X9AC7, 0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X9286, 0X8A66, 0X8A25,
-  0X8205, 0X81E4, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7163, 0X7142,
-  0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7122,
-  0X7122, 0X7142, 0X7963, 0X7983, 0X79A4, 0X81E4, 0X8204, 0X8225,
-  0X8A45, 0X8A66, 0X9286, 0X92C7, 0X9AE7, 0X9B08, 0X9B28, 0XA349,
-  0XA389, 0XABCA, 0XABCB, 0XABEB, 0XB40C, 0XB44C, 0XB46D, 0XBC8E,
-  0XBCCE, 0XBCEF, 0XC510, 0XC530, 0XC550, 0XC530, 0XCD51, 0XCDB2,
-  0XCDD3, 0XD5D3, 0XD5F3, 0XD5F3, 0XD5F2, 0XD5F3, 0XDE35, 0XE676,
-  0XDE76, 0XDE77, 0XDE97, 0XE6B7, 0XEF19, 0XEF5B, 0XF77B, 0XF79B,
-  0XF79C, 0XF77C, 0XEF7B, 0XF75A, 0XF73B, 0XF77B, 0XF77B, 0XF79D,
-  0XF79D, 0XF77C, 0XF79C, 0XE5D4, 0XED33, 0XFF3C, 0XFFBE, 0XF77D,
-  0XEF5C, 0XEF1B, 0XF75C, 0XF79D, 0XF79E, 0XF79E, 0XF79E, 0XF79E,
-  0XF79E, 0XF79E, 0XEF5D, 0XEF1D, 0XEF7D, 0XF79E, 0XF79E, 0XF7BF,
-  0XEF7E, 0XEF5D, 0XE73D, 0XE71C, 0XE71C, 0XE73D, 0XDEDC, 0XD69A,
-  0XD67A, 0XCE9B, 0XC69B, 0XC67B, 0XCEDC, 0XD6DD, 0XCE9B, 0XCE9C,
-  0XC65A, 0XCE5A, 0XD6DD, 0XD6DC, 0XD6DB, 0XD6DB, 0XD69A, 0XDEFC,
-  0XDF1C, 0XDEFC, 0XDF1D, 0XDF1D, 0XDEDC, 0XDEFC, 0XDF1C, 0XDEDC,
-  0XDEDC, 0XDF1C, 0XDF1D, 0XDEFD, 0XDEDC, 0XDEFC, 0XDEDC, 0XDEBB,
-  0XDEBB, 0XDEDB, 0XDEDB, 0XDEDB, 0XDEDB, 0XDEBB, 0XDEBA, 0XDEB9,
-  0XDE99, 0XDEB9, 0XE6D9, 0XE6D9, 0XDED9, 0XE73A, 0XE75A, 0XE739,
-  0XEF3A, 0XE73A, 0XE719, 0XE719, 0XE739, 0XE719, 0XE719, 0XE6F9,
-  0XDEF9, 0XDEB7, 0XDE75, 0XE655, 0XDE35, 0XDE35, 0XDE35, 0XD614,
-  0XD5F3, 0XD5D3, 0XCDB2, 0XCD92, 0XCD72, 0XCD51, 0XC510, 0XC4F0,
-  0XBCAF, 0XBC6E, 0XB42D, 0XB3EC, 0XABAA, 0XA369, 0XA329, 0XA2E8,
-  0XA2E7, 0X9AE7, 0X9AE8, 0X9AC7, 0X92A7, 0X9287, 0X9266, 0X8A46,
-  0X8A25, 0X8205, 0X81E4, 0X81A4, 0X7983, 0X7983, 0X7963, 0X7142,
-  0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7122,
-  0X7122, 0X7142, 0X7963, 0X7983, 0X79C4, 0X81E4, 0X8205, 0X8A25,
-  0X8A45, 0X9286, 0X92A7, 0X92C7, 0X9B08, 0X9B28, 0XA349, 0XA369,
-  0XA38A, 0XABCA, 0XABEB, 0XB40B, 0XB42C, 0XB44D, 0XBC8D, 0XBCAE,
-  0XBCCF, 0XC4EF, 0XC510, 0XC550, 0XC571, 0XCD71, 0XCDB2, 0XCDB2,
-  0XD5D2, 0XD5D2, 0XD5F3, 0XCDB2, 0XD5D2, 0XDE55, 0XDE55, 0XDE96,
-  0XDE76, 0XDE97, 0XE6D8, 0XE718, 0XEF39, 0XEF5B, 0XF77B, 0XF79C,
-  0XF79C, 0XF7BC, 0XF7BC, 0XF77B, 0XF77B, 0XEF9C, 0XF79D, 0XF77D,
-  0XF77D, 0XF77D, 0XF75D, 0XEEB8, 0XD4D0, 0XF6BA, 0XF7DE, 0XF75C,
-  0XEF9D, 0XEF7D, 0XEF5C, 0XEF5C, 0XEF5D, 0XF77E, 0XF79E, 0XF7BF,
-  0XF7BF, 0XF7BF, 0XF7BF, 0XF79E, 0XEF5D, 0XEF3C, 0XEF5D, 0XE75D,
-  0XE75E, 0XDEFD, 0XD69B, 0XCE9B, 0XC65A, 0XC65A, 0XBE19, 0XB5B8,
-  0XB576, 0XAD36, 0XB5B8, 0XB5B8, 0XB5B8, 0XB5B8, 0XAD77, 0XADB8,
-  0XADD8, 0XAD97, 0XBDF8, 0XC69A, 0XCE7A, 0XCE5A, 0XD6BB, 0XDEDB,
-  0XE6FC, 0XE71C, 0XE71C, 0XE71C, 0XDEFB, 0XE6FC, 0XDEDC, 0XDEBB,
-  0XD6BB, 0XD6BC, 0XD6DC, 0XD6BB, 0XD69B, 0XD6BC, 0XDEDC, 0XDEBB,
-  0XDEDB, 0XDEFC, 0XDEDC, 0XDEBB, 0XDE9A, 0XE69A, 0XDEBA, 0XE699,
-  0XDEB9, 0XDEDA, 0XE6FA, 0XE73A, 0XDF1A, 0XDEF9, 0XE719, 0XE73A,
-  0XE75A, 0XE73A, 0XE71A, 0XE75A, 0XE75A, 0XE73A, 0XE719, 0XE719,
-  0XE719, 0XDEF8, 0XDE75, 0XDE55, 0XE697, 0XDE76, 0XDE56, 0XDE34,
-  0XD614, 0XD5F4, 0XD5D3, 0XCDB2, 0XCD72, 0XCD51, 0XC531, 0XC4F0,
-  0XC4CF, 0XBC8E, 0XB44D, 0XB40C, 0XABCB, 0XAB8A, 0XA369, 0XA349,
-  0XA328, 0X9B08, 0X9AE8, 0X9AE8, 0X92C7, 0X92A7, 0X9286, 0X8A66,
-  0X8A45, 0X8205, 0X8205, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7163,
-  0X7142, 0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122,
-  0X7142, 0X7963, 0X7963, 0X79A3, 0X81C4, 0X8204, 0X8A25, 0X8A45,
-  0X8A66, 0X9286, 0X92C7, 0X9AE7, 0X9B08, 0X9B49, 0XA369, 0XA38A,
-  0XA3CA, 0XABCB, 0XABEB, 0XB40B, 0XB42C, 0XBC6D, 0XBCAE, 0XBCCE,
-  0XC4EF, 0XC510, 0XC510, 0XC551, 0XCD71, 0XCD72, 0XCDD3, 0XD5F3,
-  0XD5F3, 0XD5D2, 0XD5D2, 0XCD91, 0XD592, 0XD5F5, 0XDE55, 0XDE76,
-  0XDE97, 0XE6D8, 0XE6F9, 0XEF19, 0XEF39, 0XEF5A, 0XF75B, 0XF77C,
-  0XF79C, 0XF7BC, 0XF7BC, 0XF77B, 0XF77C, 0XF7BD, 0XF7BE, 0XF79D,
-  0XEF9D, 0XF79D, 0XF73C, 0XF73B, 0XDD53, 0XE574, 0XEF1B, 0XEF5B,
-  0XF77D, 0XF79D, 0XEF7D, 0XEF7D, 0XF75D, 0XF77D, 0XEF5C, 0XF79E,
-  0XF7BE, 0XEF9E, 0XEF9E, 0XEF9E, 0XE73D, 0XDEBB, 0XD69A, 0XCEBB,
-  0XCEBB, 0XBE3A, 0XB5F9, 0XADD9, 0XA577, 0X9D76, 0X9D36, 0X8CD4,
-  0X8C93, 0X8C94, 0X94B4, 0X9CF5, 0X94D4, 0X8C94, 0X94B4, 0X94F6,
-  0X9D56, 0X9535, 0X9D15, 0XAD96, 0XB5F9, 0XBDF8, 0XC618, 0XCE7A,
-  0XD6DB, 0XDEFC, 0XE71C, 0XDF1C, 0XDF1C, 0XDEFC, 0XDEFC, 0XDEDB,
-  0XD69B, 0XD69B, 0XDEBC, 0XD69B, 0XD69A, 0XD6BB, 0XDEDC, 0XDEDC,
-  0XDEDB, 0XDEFC, 0XE6FC, 0XDE9A, 0XDE38, 0XE699, 0XE6BA, 0XE6BA,
-  0XE6FA, 0XE71B, 0XDF1A, 0XE71A, 0XDF1A, 0XE71A, 0XE73A, 0XE75A,
-  0XE75B, 0XE75B, 0XE75A, 0XE75A, 0XEF5A, 0XE73A, 0XE739, 0XE719,
-  0XE719, 0XE6F8, 0XDEB7, 0XDE97, 0XE6B7, 0XDE97, 0XDE76, 0XDE56,
-  0XDE35, 0XDE15, 0XD5D4, 0XD5D3, 0XD592, 0XCD72, 0XCD51, 0XC510,
-  0XC4F0, 0XBCAF, 0XBC6E, 0XB42C, 0XABEB, 0XABCB, 0XABAA, 0XA369,
-  0XA369, 0XA349, 0X9B08, 0X9AE8, 0X9AE8, 0X92C7, 0X92A7, 0X9266,
-  0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X7983, 0X7983, 0X7963,
-  0X7142, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7122,
-  0X7142, 0X7963, 0X7983, 0X79A4, 0X81E4, 0X8205, 0X8A25, 0X8A46,
-  0X9286, 0X92A7, 0X92C7, 0X9B08, 0X9B28, 0XA349, 0XA389, 0XA3AA,
-  0XABCB, 0XABEB, 0XB40C, 0XB40C, 0XB44D, 0XBC8E, 0XBCAE, 0XBCCE,
-  0XC50F, 0XC50F, 0XC530, 0XCD51, 0XCD71, 0XCD92, 0XD5D3, 0XD5D3,
-  0XD5F3, 0XD614, 0XCDD2, 0XCD91, 0XD5F4, 0XDE35, 0XDE97, 0XE6D8,
-  0XE6D8, 0XE73A, 0XEF5B, 0XEF3B, 0XEF5B, 0XEF5B, 0XEF5B, 0XEF7C,
-  0XF77C, 0XF79C, 0XF79C, 0XF75B, 0XF75C, 0XFFDE, 0XFFDE, 0XF7BE,
-  0XF7DE, 0XF79C, 0XEF1B, 0XEF3C, 0XE6BA, 0XE5F7, 0XE657, 0XE678,
-  0XEEFB, 0XEF5C, 0XF75C, 0XF79E, 0XF79E, 0XEF5D, 0XEF3D, 0XEF5D,
-  0XEF5D, 0XE73D, 0XDF1C, 0XD6DC, 0XCE9B, 0XBE3A, 0XB5D8, 0XADB8,
-  0XA598, 0X9D57, 0X94F5, 0X84B4, 0X7C73, 0X7C32, 0X7C52, 0X73F1,
-  0X6B8F, 0X7411, 0X6B8E, 0X6BCF, 0X73F1, 0X6BB0, 0X73D0, 0X7C11,
-  0X7C52, 0X8493, 0X7C52, 0X7C31, 0X9D36, 0X9D15, 0XA556, 0XB5F8,
-  0XBE39, 0XCE9B, 0XD6DB, 0XDF1C, 0XDEFB, 0XDEFB, 0XDEFB, 0XD6DB,
-  0XD6BB, 0XDEDB, 0XDEDB, 0XD6DB, 0XD6DB, 0XD6BB, 0XDEBB, 0XDEDB,
-  0XDEDC, 0XDEFC, 0XDEBB, 0XDE59, 0XDE79, 0XDEBA, 0XE6FB, 0XDEDA,
-  0XDEDA, 0XDEFA, 0XE6DA, 0XE6DA, 0XE73B, 0XE75B, 0XE75A, 0XE75B,
-  0XE77B, 0XE77B, 0XE77B, 0XEF7B, 0XE75A, 0XE75A, 0XE73A, 0XE739,
-  0XE718, 0XE6F8, 0XDEF8, 0XDED8, 0XE6B7, 0XDEB7, 0XDE96, 0XDE76,
-  0XDE56, 0XDE35, 0XDDF4, 0XD5D4, 0XD5B3, 0XCD92, 0XCD51, 0XC531,
-  0XBD10, 0XBCCF, 0XBC8E, 0XB46D, 0XB40C, 0XABEB, 0XABEB, 0XABAA,
-  0XA389, 0XA369, 0XA349, 0X9B08, 0X9AE7, 0X9AC7, 0X92A7, 0X9287,
-  0X8A66, 0X8A45, 0X8205, 0X81E4, 0X81C4, 0X79A3, 0X7983, 0X7963,
-  0X7963, 0X7142, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142,
-  0X7963, 0X7983, 0X79A3, 0X81C4, 0X81E4, 0X8205, 0X8A45, 0X8A66,
-  0X92A6, 0X92C7, 0X9AE7, 0X9B08, 0X9B48, 0XA369, 0XA38A, 0XABCA,
-  0XABEB, 0XAC0C, 0XB44C, 0XB42C, 0XBC4D, 0XBCAE, 0XBCCE, 0XC4EF,
-  0XC50F, 0XC50F, 0XCD71, 0XCD91, 0XD5B2, 0XD5B2, 0XD5B3, 0XD5F4,
-  0XD614, 0XD614, 0XD5F3, 0XD5F4, 0XD656, 0XE697, 0XE6B7, 0XE6F8,
-  0XE71A, 0XEF5A, 0XEF7B, 0XEF7C, 0XEF7C, 0XEF7C, 0XEF5C, 0XEF7C,
-  0XEF7C, 0XEF7C, 0XF77C, 0XF79D, 0XF75C, 0XF7BD, 0XFFDE, 0XFFDE,
-  0XFFDF, 0XF79D, 0XF77C, 0XEF5C, 0XE71C, 0XE71C, 0XE71C, 0XDE58,
-  0XE6BA, 0XE71C, 0XEF1C, 0XEF7D, 0XEF5D, 0XE73C, 0XE73D, 0XDF1C,
-  0XD6DC, 0XCE9B, 0XC69B, 0XB61A, 0XADB8, 0X9D36, 0X8CD4, 0X8CD5,
-  0X8CF5, 0X8473, 0X73F0, 0X6BD0, 0X6BAF, 0X638E, 0X6B8E, 0X636D,
-  0X530C, 0X632C, 0X5AEB, 0X5AEB, 0X632C, 0X632D, 0X5B2D, 0X632D,
-  0X6BAF, 0X6BCF, 0X6B6E, 0X734E, 0X83D0, 0X73D0, 0X8C93, 0X8CD3,
-  0X9555, 0XAE19, 0XB65B, 0XC6BB, 0XC69A, 0XCEBA, 0XD6DB, 0XD6DC,
-  0XD6DC, 0XD6FC, 0XD6FC, 0XDEFC, 0XDEFC, 0XDEFC, 0XE6FC, 0XE6FC,
-  0XE6FC, 0XDEBA, 0XDE9A, 0XDEDB, 0XDEDB, 0XDEDB, 0XDEBA, 0XDEBA,
-  0XDE99, 0XDE99, 0XE6FA, 0XE6FA, 0XE71B, 0XE75B, 0XE73A, 0XE75B,
-  0XE79C, 0XEF7B, 0XEF7B, 0XE77B, 0XE75A, 0XE75A, 0XE77A, 0XE739,
-  0XE719, 0XE6F8, 0XE6F8, 0XE6F8, 0XDED7, 0XDEB7, 0XDE97, 0XDE76,
-  0XDE56, 0XDE35, 0XDE15, 0XD5F4, 0XD5D3, 0XD5B3, 0XCD72, 0XCD51,
-  0XC510, 0XBCF0, 0XBCCF, 0XBC8E, 0XB44D, 0XB40C, 0XAC0B, 0XABCB,
-  0XABAA, 0XA38A, 0XA369, 0XA349, 0X9B08, 0X9AE7, 0X92C7, 0X92A7,
-  0X9286, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A3, 0X7983,
-  0X7963, 0X7142, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7142, 0X7142,
-  0X7963, 0X7983, 0X79A4, 0X81C4, 0X8204, 0X8A25, 0X8A45, 0X8A86,
-  0X92A7, 0X92E7, 0X9B08, 0X9B28, 0XA349, 0XA389, 0XABAA, 0XABCB,
-  0XABEB, 0XB42C, 0XB44C, 0XBC6D, 0XBC4D, 0XBCAE, 0XC4EF, 0XC50F,
-  0XC4EF, 0XCD30, 0XCD71, 0XCD92, 0XD5B2, 0XCDB2, 0XD5D3, 0XD614,
-  0XD635, 0XD614, 0XD5D3, 0XDE15, 0XDE15, 0XE697, 0XE6F9, 0XE6F8,
-  0XE719, 0XEF5A, 0XEF7C, 0XF79C, 0XF7BD, 0XEF9D, 0XF79D, 0XEF7C,
-  0XEF7D, 0XEF9D, 0XEF9E, 0XF7BE, 0XF77D, 0XEF5C, 0XF79E, 0XF7DE,
-  0XF7BE, 0XFF9D, 0XF79D, 0XEF5D, 0XE73D, 0XDF1D, 0XDEFD, 0XDEFC,
-  0XE71C, 0XE73D, 0XE73D, 0XE73D, 0XDEDB, 0XDEDC, 0XCEDC, 0XC67B,
-  0XBE3A, 0XB5F9, 0XA5B9, 0X9516, 0X8C94, 0X7C31, 0X6B8E, 0X73D0,
-  0X7431, 0X6BAF, 0X6BAF, 0X634D, 0X5B2C, 0X5B2D, 0X52AA, 0X4248,
-  0X3A07, 0X3A08, 0X39C7, 0X39C7, 0X39E7, 0X3A07, 0X3A07, 0X4207,
-  0X4249, 0X528A, 0X5AAA, 0X5269, 0X5A8A, 0X634D, 0X6BCE, 0X6BAF,
-  0X7411, 0X8CD4, 0X9D56, 0XA597, 0XADF8, 0XB679, 0XC6DB, 0XCE9B,
-  0XD6BB, 0XDEDC, 0XDEFC, 0XDF1C, 0XDF1C, 0XE71D, 0XE73D, 0XE6FC,
-  0XDEDB, 0XE6FB, 0XE71C, 0XE71D, 0XE71C, 0XE6DB, 0XDE9A, 0XDEDB,
-  0XE6DA, 0XDE99, 0XDEFB, 0XE6DA, 0XE6DA, 0XE73A, 0XE75A, 0XE77B,
-  0XEF7B, 0XEF5B, 0XEF7B, 0XE77B, 0XE77B, 0XE73A, 0XE739, 0XE73A,
-  0XE739, 0XE719, 0XE6F8, 0XE6F8, 0XDEF8, 0XDEB7, 0XDEB7, 0XDE97,
-  0XDE76, 0XDE55, 0XDE35, 0XDE15, 0XD5D4, 0XD5D3, 0XD592, 0XCD52,
-  0XC550, 0XC510, 0XBCEF, 0XBCAF, 0XB46D, 0XB42C, 0XB40C, 0XABEB,
-  0XABCB, 0XABAA, 0XA38A, 0XA369, 0X9B29, 0X9AE8, 0X9AC7, 0X92A7,
-  0X9287, 0X8A66, 0X8A45, 0X8A25, 0X81E5, 0X81C4, 0X79A4, 0X7983,
-  0X7963, 0X7163, 0X7142, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7943,
-  0X7963, 0X7983, 0X79A4, 0X81C4, 0X8205, 0X8A25, 0X8A66, 0X9286,
-  0X92A7, 0X9AE7, 0X9B08, 0X9B48, 0XA369, 0XA38A, 0XA3AA, 0XABEB,
-  0XAC0B, 0XB42C, 0XB46D, 0XBC8D, 0XBC8D, 0XBCAE, 0XC4CF, 0XC4CF,
-  0XC510, 0XCD71, 0XCD71, 0XCD92, 0XD5D3, 0XD5D2, 0XD5D3, 0XD614,
-  0XDE55, 0XD5F3, 0XDDD3, 0XDE35, 0XDE35, 0XE6B8, 0XE719, 0XE6F9,
-  0XEF19, 0XEF5A, 0XF79C, 0XF7BD, 0XF7BD, 0XF7BD, 0XF7BD, 0XEF9D,
-  0XF7BE, 0XF7BE, 0XEFBE, 0XEFBF, 0XEF7E, 0XEF5D, 0XF79E, 0XF7BE,
-  0XF79E, 0XF79E, 0XEF9E, 0XE77E, 0XE73E, 0XDF1D, 0XDEFD, 0XDF1D,
-  0XDF1D, 0XDF3D, 0XDF3D, 0XDF1C, 0XCEBB, 0XC639, 0XBE5A, 0XB63A,
-  0XA5B8, 0X9557, 0X7CB4, 0X6C11, 0X638F, 0X5B6E, 0X530C, 0X52CB,
-  0X5B0C, 0X630C, 0X4A89, 0X31C7, 0X31A6, 0X2965, 0X18C3, 0X1082,
-  0X0861, 0X0861, 0X0841, 0X0841, 0X0040, 0X0841, 0X0861, 0X0861,
-  0X1081, 0X10A2, 0X18E3, 0X2124, 0X2965, 0X3A07, 0X4269, 0X52AB,
-  0X634D, 0X6BAE, 0X7C10, 0X8472, 0X9CD4, 0X9D97, 0XAE59, 0XBE59,
-  0XC659, 0XD6DC, 0XDF1C, 0XDF1D, 0XDF3D, 0XE75D, 0XE75D, 0XE73C,
-  0XE73C, 0XE77D, 0XE75D, 0XE75D, 0XE73C, 0XE6FB, 0XE71C, 0XE73C,
-  0XDEDB, 0XDE79, 0XDE9A, 0XDEFA, 0XDF1A, 0XE73B, 0XE75B, 0XE77B,
-  0XE75B, 0XE75B, 0XE77B, 0XE77B, 0XEF7B, 0XE75B, 0XE719, 0XE73A,
-  0XEF5A, 0XE739, 0XE6F8, 0XE6F8, 0XE6F8, 0XE6D7, 0XE6B7, 0XDEB7,
-  0XDE97, 0XDE55, 0XDE34, 0XDE35, 0XD5F4, 0XD5D3, 0XD5B3, 0XD572,
-  0XCD51, 0XC52F, 0XC4CF, 0XBCCF, 0XBCAF, 0XB44D, 0XB42D, 0XB40C,
-  0XABEB, 0XABCB, 0XA38A, 0XA36A, 0XA349, 0X9B28, 0X9AE7, 0X92C7,
-  0X92A7, 0X9286, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A3,
-  0X7983, 0X7963, 0X7142, 0X7122, 0X7102, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7963,
-  0X7963, 0X7983, 0X81C4, 0X81C4, 0X81E4, 0X8A25, 0X8A66, 0X9286,
-  0X92C7, 0X92E7, 0X9B28, 0XA349, 0XA369, 0XA3AA, 0XABCA, 0XABEB,
-  0XB42C, 0XB44C, 0XB46D, 0XBCAE, 0XBCAE, 0XBC8E, 0XC48E, 0XC4EF,
-  0XCD51, 0XCD71, 0XCD91, 0XD592, 0XD5D3, 0XD5D2, 0XD5F2, 0XD613,
-  0XD5D2, 0XD571, 0XDDB3, 0XDE56, 0XDE76, 0XE6D8, 0XE719, 0XE6F9,
-  0XEF3A, 0XEF5B, 0XF79C, 0XF79C, 0XF7BC, 0XF7BC, 0XF79C, 0XF7BD,
-  0XF7DE, 0XF7DE, 0XF7DE, 0XEFBF, 0XEF9F, 0XE79E, 0XE77E, 0XE75E,
-  0XEF9E, 0XEFBF, 0XEFBF, 0XEFBF, 0XE77F, 0XE75E, 0XE75E, 0XDF3D,
-  0XDF1D, 0XD6FC, 0XCEBB, 0XC67A, 0XB639, 0XADB7, 0XA556, 0X94D5,
-  0X8D36, 0X7C92, 0X63AE, 0X5B6D, 0X530C, 0X52CA, 0X4A89, 0X39E7,
-  0X2985, 0X2124, 0X0861, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841, 0X10A2, 0X2124,
-  0X31C6, 0X4A88, 0X5B2C, 0X6B8E, 0X73D0, 0X8432, 0X94D3, 0XA5B6,
-  0XB639, 0XC6BB, 0XD71C, 0XDF1D, 0XDF3D, 0XE77D, 0XE75D, 0XE77D,
-  0XEF9E, 0XE77D, 0XE77D, 0XE77D, 0XE73C, 0XE71C, 0XE71C, 0XE71C,
-  0XDEBA, 0XDE59, 0XDE9A, 0XE6DA, 0XE73B, 0XE73B, 0XE75B, 0XE75B,
-  0XE75B, 0XE77B, 0XEF7B, 0XE77B, 0XE77B, 0XE75A, 0XE75A, 0XEF3A,
-  0XE75A, 0XE73A, 0XE6F8, 0XE6F8, 0XE6F8, 0XE6D7, 0XDEB7, 0XDEB7,
-  0XDE96, 0XDE55, 0XD634, 0XDE34, 0XDE14, 0XD5F4, 0XD5D3, 0XD593,
-  0XCD71, 0XCD2F, 0XC4EF, 0XBCF0, 0XBCCF, 0XBC8E, 0XBC4D, 0XB42C,
-  0XAC0C, 0XABEB, 0XABAB, 0XA38A, 0XA369, 0X9B29, 0X9B08, 0X92C7,
-  0X92A7, 0X9287, 0X8A66, 0X8A46, 0X8205, 0X81E4, 0X81C4, 0X79A4,
-  0X7983, 0X7963, 0X7143, 0X7142, 0X7122, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7963,
-  0X7963, 0X79A3, 0X81C4, 0X81E4, 0X81E4, 0X8A25, 0X8A66, 0X92A7,
-  0X92C7, 0X9AE8, 0X9B28, 0XA369, 0XA38A, 0XABCA, 0XABEB, 0XAC0B,
-  0XB42C, 0XB46D, 0XBC8D, 0XBCAE, 0XBCCE, 0XBCAE, 0XC4AE, 0XCD10,
-  0XCD51, 0XCD71, 0XCD71, 0XD592, 0XCD92, 0XD591, 0XDDB2, 0XD5B2,
-  0XD592, 0XD5D3, 0XDDF4, 0XDE15, 0XDE56, 0XE6D7, 0XEF3A, 0XEF3A,
-  0XE71A, 0XE73A, 0XEF5B, 0XEF5A, 0XEF5B, 0XEF7C, 0XEF9D, 0XF7DE,
-  0XF7DE, 0XEFBE, 0XEF9E, 0XEFBE, 0XE79E, 0XDF3D, 0XDF1D, 0XE77E,
-  0XE79F, 0XEFBF, 0XEFBF, 0XEFBF, 0XE79F, 0XE77E, 0XE77E, 0XDF5D,
-  0XD73D, 0XCEFC, 0XC69B, 0XB619, 0XA557, 0X9493, 0X7BF0, 0X7C11,
-  0X7C72, 0X6BAF, 0X5B4D, 0X52CB, 0X4227, 0X2944, 0X18C2, 0X0861,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0020, 0X10A2, 0X2165, 0X4248, 0X532C, 0X6B6E, 0X73EF, 0X7C92,
-  0X9535, 0XA5F7, 0XBE9A, 0XCF3C, 0XD75D, 0XDF3D, 0XE77D, 0XE79E,
-  0XE7BE, 0XE7BE, 0XE79D, 0XEF7D, 0XEF5D, 0XE73D, 0XE71C, 0XE6FB,
-  0XDE9A, 0XDE59, 0XE6BA, 0XDEDA, 0XE73B, 0XE73B, 0XE71B, 0XE73B,
-  0XE75B, 0XEF7B, 0XEF5B, 0XE77B, 0XE77B, 0XEF7B, 0XEF7B, 0XE77B,
-  0XE75A, 0XEF5A, 0XE739, 0XE6D8, 0XE6F8, 0XE718, 0XDED7, 0XDE75,
-  0XDE75, 0XDE76, 0XDE76, 0XDE55, 0XDE34, 0XDDF4, 0XD5D3, 0XD5B3,
-  0XCD92, 0XCD4F, 0XC510, 0XC4F0, 0XBCCF, 0XBC8E, 0XBC6D, 0XB44D,
-  0XAC0C, 0XABEB, 0XABCB, 0XA3AA, 0XA36A, 0XA349, 0X9B08, 0X9AE7,
-  0X92A7, 0X9286, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X79C4,
-  0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7142, 0X7963,
-  0X7963, 0X7983, 0X81C4, 0X81E4, 0X81E4, 0X8A25, 0X8A66, 0X92A7,
-  0X92C7, 0X9B08, 0X9B28, 0XA369, 0XA38A, 0XABCB, 0XABEB, 0XB42C,
-  0XB42C, 0XB46D, 0XBCAD, 0XBCCE, 0XC4EF, 0XC4EE, 0XBCAD, 0XC4EF,
-  0XCD10, 0XCD30, 0XCD51, 0XCD71, 0XCDB2, 0XD5D3, 0XDDB3, 0XDDD4,
-  0XD5F4, 0XDE56, 0XE677, 0XE657, 0XDE57, 0XE6D8, 0XEF19, 0XEF3A,
-  0XE6F9, 0XEF1A, 0XEF5B, 0XEF5B, 0XE71A, 0XEF3B, 0XEF9D, 0XF7BE,
-  0XF79E, 0XEF9D, 0XE77D, 0XE77D, 0XDEFC, 0XDEBC, 0XE75D, 0XEF7E,
-  0XE79E, 0XE79E, 0XE79F, 0XE79E, 0XE79E, 0XE79E, 0XDF7E, 0XD75D,
-  0XCF1C, 0XC6BB, 0XAE3A, 0X9DB9, 0X8D15, 0X73D0, 0X6B8F, 0X6BEF,
-  0X636D, 0X5B2C, 0X4228, 0X2124, 0X1081, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0861, 0X2124, 0X3A08, 0X5B6D, 0X7410,
-  0X7C31, 0X8492, 0XA5B6, 0XBE9A, 0XC71C, 0XD73D, 0XDF7D, 0XE7BE,
-  0XE7BE, 0XEFBE, 0XEFBE, 0XEF9E, 0XEF9E, 0XEF5D, 0XE71C, 0XE71B,
-  0XE6BB, 0XDE7A, 0XE6DA, 0XDEFB, 0XE71B, 0XE71B, 0XE71B, 0XDF3B,
-  0XDF5B, 0XE77B, 0XEF5B, 0XEF5B, 0XEF7C, 0XEF7C, 0XEF9C, 0XE79B,
-  0XEF5A, 0XEF5A, 0XEF5A, 0XE73A, 0XE6F8, 0XE6D6, 0XDEB6, 0XDE76,
-  0XDE96, 0XE697, 0XDE97, 0XDE56, 0XDE35, 0XDE14, 0XD5F3, 0XD5D2,
-  0XD5B1, 0XCD70, 0XC510, 0XC4F0, 0XC4CF, 0XBCAE, 0XBC8E, 0XB44D,
-  0XB42C, 0XAC0C, 0XABEB, 0XABAB, 0XA38A, 0XA349, 0X9B29, 0X9B08,
-  0X92C7, 0X9287, 0X9286, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4,
-  0X79A3, 0X7983, 0X7963, 0X7142, 0X7122, 0X7102, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963,
-  0X7983, 0X81A4, 0X81A4, 0X81E4, 0X8A05, 0X8A25, 0X9286, 0X92A7,
-  0X92C7, 0X9B08, 0X9B48, 0XA369, 0XA38A, 0XABCB, 0XAC0B, 0XB42C,
-  0XB44D, 0XB46D, 0XBC8D, 0XC4CE, 0XC4EE, 0XBCAE, 0XC48E, 0XCCCF,
-  0XCD10, 0XCD30, 0XCD51, 0XD592, 0XD5D3, 0XD5D3, 0XD5D4, 0XDE15,
-  0XDE56, 0XDE97, 0XE697, 0XE6B7, 0XE677, 0XE677, 0XE697, 0XEF19,
-  0XEF3A, 0XEF5B, 0XEF5C, 0XEF7C, 0XEF5B, 0XEF5B, 0XEF7D, 0XEF5D,
-  0XEF5D, 0XEF5D, 0XE77D, 0XDF1C, 0XDE9B, 0XE73D, 0XE77D, 0XE75D,
-  0XE75D, 0XE75E, 0XE77E, 0XE79E, 0XE77E, 0XDF3D, 0XD73D, 0XCF1D,
-  0XBE7B, 0XADF9, 0X9D57, 0X8CF5, 0X7452, 0X63EF, 0X6B8E, 0X52CA,
-  0X31C6, 0X2123, 0X1061, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0040, 0X2124, 0X4268,
-  0X636C, 0X7C2F, 0X8CB2, 0X9D56, 0XB6BB, 0XC71C, 0XD73C, 0XDF9D,
-  0XE7BE, 0XEFDF, 0XEFDF, 0XEFDE, 0XEFDE, 0XEF7D, 0XEF3D, 0XEF5D,
-  0XE71C, 0XDE7A, 0XE6DA, 0XE71B, 0XE6FB, 0XE71C, 0XE73C, 0XE75C,
-  0XDF5B, 0XE77B, 0XEF7C, 0XEF5C, 0XEF5B, 0XEF5B, 0XEF9C, 0XEF9C,
-  0XEF7B, 0XE77A, 0XE75A, 0XE73A, 0XE6F8, 0XDE96, 0XDEB7, 0XE6D8,
-  0XDEB7, 0XE697, 0XDE97, 0XDE76, 0XD655, 0XD635, 0XD614, 0XD5D3,
-  0XD591, 0XCD51, 0XC4EF, 0XC4CF, 0XC4CF, 0XC4CF, 0XBCAE, 0XB46D,
-  0XB44D, 0XAC0C, 0XABEB, 0XABCB, 0XA3AA, 0XA36A, 0XA349, 0X9B28,
-  0X9AE8, 0X92A7, 0X92A7, 0X8A66, 0X8A45, 0X8205, 0X8205, 0X81E4,
-  0X79A4, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7942, 0X7963,
-  0X79A4, 0X81C4, 0X81C4, 0X81E4, 0X8A05, 0X8A25, 0X9286, 0X92C7,
-  0X92E8, 0X9B08, 0X9B29, 0XA369, 0XA38A, 0XABCB, 0XB40B, 0XB42C,
-  0XBC6D, 0XBC8D, 0XBCAD, 0XBCCD, 0XBCAD, 0XBC8E, 0XC4EF, 0XCD10,
-  0XCD51, 0XCD72, 0XCD72, 0XD592, 0XD5B3, 0XD5B3, 0XDDF5, 0XDE76,
-  0XDE97, 0XDEB8, 0XE6D8, 0XE6D8, 0XE697, 0XE6D8, 0XDEB7, 0XE6D8,
-  0XE719, 0XEF3B, 0XEF3B, 0XE73B, 0XE73B, 0XE73C, 0XEF5C, 0XEF5C,
-  0XE73C, 0XE73D, 0XDF1C, 0XDE7B, 0XE71C, 0XE79D, 0XE75D, 0XE73C,
-  0XE75D, 0XE75E, 0XEF7E, 0XE77E, 0XDF5D, 0XD71C, 0XC6BB, 0XAE39,
-  0X9DD8, 0X9536, 0X8473, 0X7430, 0X638D, 0X5AEB, 0X4A48, 0X2944,
-  0X0861, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0840,
-  0X2144, 0X52AA, 0X73EF, 0X84D2, 0X9596, 0XB659, 0XCEFB, 0XD73C,
-  0XE77D, 0XEFFF, 0XE7FF, 0XEFDF, 0XEFDE, 0XEF9E, 0XEF9E, 0XEF9D,
-  0XEF7D, 0XE6BB, 0XE6FB, 0XE73C, 0XE73C, 0XE73C, 0XE75C, 0XE77C,
-  0XE77C, 0XE77C, 0XEF7C, 0XEF7C, 0XEF5B, 0XE75A, 0XE73A, 0XE73A,
-  0XEF5A, 0XEF7A, 0XE739, 0XE6F8, 0XE6D8, 0XE6F9, 0XE6F9, 0XE6F8,
-  0XE6B7, 0XDE97, 0XE697, 0XE676, 0XDE56, 0XD635, 0XD5F4, 0XD5B2,
-  0XCD92, 0XCD71, 0XC510, 0XC4CE, 0XBCCE, 0XBCCF, 0XBC8E, 0XB44D,
-  0XB42C, 0XB42C, 0XAC0C, 0XABCB, 0XABAA, 0XA36A, 0XA349, 0X9B29,
-  0X9AE8, 0X92C7, 0X92A7, 0X9286, 0X8A46, 0X8A25, 0X8205, 0X81E4,
-  0X79C4, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7102, 0X6901,
-  0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7142, 0X7942, 0X7963,
-  0X79A4, 0X81E4, 0X8205, 0X81E4, 0X81E4, 0X8A25, 0X9286, 0X92C7,
-  0X92E7, 0X9AE8, 0X9B28, 0XA369, 0XABAA, 0XABEB, 0XB40B, 0XB44C,
-  0XB46D, 0XBCAD, 0XBCCE, 0XBCAD, 0XBC8D, 0XC4EF, 0XC510, 0XC530,
-  0XCD92, 0XCDB3, 0XD5D3, 0XD5F4, 0XD5F4, 0XD5F4, 0XDE56, 0XDE96,
-  0XDE97, 0XDEB8, 0XE6D9, 0XE6D8, 0XE6D8, 0XE6F9, 0XE6F9, 0XE6D8,
-  0XE678, 0XEEFA, 0XE71B, 0XE71A, 0XE71B, 0XE71B, 0XE73C, 0XE73C,
-  0XE73C, 0XE73C, 0XD69A, 0XDEDC, 0XE75D, 0XDF3C, 0XDF1B, 0XE73C,
-  0XE73D, 0XE73D, 0XDF5D, 0XDF5D, 0XD71D, 0XCEBC, 0XB65A, 0X9597,
-  0X8D15, 0X7C31, 0X634D, 0X5B0B, 0X52EA, 0X31E6, 0X18C2, 0X0020,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X1082, 0X3A07, 0X6B6C, 0X8CB2, 0XA554, 0XADF7, 0XCEFC,
-  0XDF7D, 0XE7BE, 0XE7FF, 0XE7FF, 0XEFBE, 0XEFBE, 0XEFDE, 0XEFBE,
-  0XEF9E, 0XEF1C, 0XE6FC, 0XEF5D, 0XE75C, 0XE75C, 0XEF7C, 0XEF7D,
-  0XEF7C, 0XEF7C, 0XEF7C, 0XEF7B, 0XEF5B, 0XE73A, 0XE71A, 0XE6F9,
-  0XE73A, 0XEF19, 0XE6F9, 0XE719, 0XE73A, 0XE73A, 0XE719, 0XE6F8,
-  0XE6D8, 0XE6B7, 0XE697, 0XDE76, 0XDE76, 0XD655, 0XD5D3, 0XCDB2,
-  0XCDD3, 0XCD92, 0XCD51, 0XC4F0, 0XBCCE, 0XBCCF, 0XBCAE, 0XB46D,
-  0XB42C, 0XB42C, 0XAC0C, 0XABEB, 0XABCB, 0XA38A, 0XA36A, 0X9B29,
-  0X9B08, 0X92C7, 0X92A7, 0X9287, 0X8A66, 0X8A25, 0X8205, 0X81E4,
-  0X81C4, 0X79A4, 0X7983, 0X7963, 0X7142, 0X7122, 0X7122, 0X6902,
-  0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7942, 0X7963,
-  0X81C4, 0X81E5, 0X8205, 0X8205, 0X89E4, 0X8A04, 0X9246, 0X92A7,
-  0X92A7, 0X9AE8, 0X9B28, 0XA369, 0XABAA, 0XABEB, 0XAC0C, 0XB44C,
-  0XB48D, 0XBCAE, 0XBCCE, 0XBC6D, 0XC48E, 0XC4CE, 0XC4EF, 0XCD51,
-  0XCDB2, 0XD5D3, 0XD5F4, 0XD635, 0XDE35, 0XDE56, 0XDE76, 0XDE97,
-  0XDE97, 0XE6B8, 0XE6D9, 0XE6D8, 0XE6F9, 0XE6F9, 0XE71A, 0XEF1A,
-  0XE6B9, 0XE6D9, 0XE73B, 0XE75C, 0XE73C, 0XE71B, 0XDEB9, 0XDEBA,
-  0XE75C, 0XDE9A, 0XDEBB, 0XE75D, 0XE73C, 0XDEFB, 0XE6FC, 0XE71C,
-  0XE73C, 0XE75D, 0XDF5D, 0XD71C, 0XCEDC, 0XAE3A, 0X9DB7, 0X9535,
-  0X7C52, 0X6B6E, 0X5AC9, 0X4226, 0X3185, 0X0861, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0020, 0X2924, 0X636C, 0X7C70, 0X9534, 0XB6BA,
-  0XCEFB, 0XD77D, 0XDFFF, 0XE7DE, 0XE7DE, 0XEFFF, 0XEFDE, 0XEFDF,
-  0XEFDE, 0XEF3C, 0XE6FB, 0XEF3C, 0XE75C, 0XEF7D, 0XEF9D, 0XE79C,
-  0XE77C, 0XE77C, 0XEF7C, 0XE77B, 0XE75B, 0XE73B, 0XEF7B, 0XE75B,
-  0XE71A, 0XE6D8, 0XEF1A, 0XE77B, 0XE75A, 0XE73A, 0XE719, 0XE718,
-  0XE6F8, 0XE6D8, 0XDE97, 0XDE96, 0XDE75, 0XDE34, 0XD5D4, 0XCDF4,
-  0XCDD3, 0XCDB3, 0XC572, 0XC531, 0XC4EF, 0XBCCF, 0XBCCF, 0XBC8E,
-  0XB44D, 0XB42C, 0XAC0C, 0XABEB, 0XABCB, 0XABAA, 0XA36A, 0XA349,
-  0X9B08, 0X9AE8, 0X92A7, 0X9287, 0X8A66, 0X8A46, 0X8225, 0X8205,
-  0X81E4, 0X79A4, 0X7983, 0X7963, 0X7143, 0X7142, 0X7122, 0X6902,
-  0X6902, 0X7102, 0X7122, 0X7122, 0X7142, 0X7942, 0X7942, 0X7963,
-  0X81C4, 0X8205, 0X8A05, 0X8A25, 0X8A05, 0X8A04, 0X8A04, 0X9246,
-  0X92A7, 0X9AC7, 0XA308, 0XA36A, 0XABAA, 0XABEB, 0XB42C, 0XB44D,
-  0XBC8E, 0XBCAE, 0XBC6D, 0XBC4C, 0XC4AE, 0XC4CF, 0XC530, 0XCD91,
-  0XD5D2, 0XD5D3, 0XD5F4, 0XD614, 0XDE35, 0XDE56, 0XDE76, 0XDE77,
-  0XE677, 0XDE97, 0XE6B8, 0XE6D8, 0XE6F9, 0XE6F9, 0XE6D9, 0XE6D9,
-  0XDED9, 0XDED9, 0XE6FA, 0XE73B, 0XE73B, 0XE6FB, 0XDE59, 0XD5B6,
-  0XDDD6, 0XDE38, 0XE73C, 0XE73C, 0XE73C, 0XDEFB, 0XDEFB, 0XDEFC,
-  0XDF1C, 0XDF3D, 0XD6FB, 0XBE7A, 0XAE5A, 0X9E19, 0X9555, 0X7C31,
-  0X6B8E, 0X5B0B, 0X4A47, 0X2103, 0X0020, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X18E2, 0X4AA9, 0X84D2, 0X9DF6,
-  0XB618, 0XC6FB, 0XD77D, 0XE79E, 0XE7BE, 0XEFDE, 0XEFFE, 0XEFDF,
-  0XEFDF, 0XEF9D, 0XEF3C, 0XE73C, 0XEF5C, 0XEF7C, 0XE77C, 0XE79C,
-  0XE77C, 0XE77C, 0XE79C, 0XEF7C, 0XE75B, 0XE73B, 0XE75B, 0XE75B,
-  0XE71A, 0XE71A, 0XEF1A, 0XE73A, 0XE73A, 0XE71A, 0XE739, 0XE719,
-  0XE6F8, 0XE6B8, 0XE697, 0XDE97, 0XDE55, 0XDDF3, 0XD5F4, 0XD615,
-  0XD5F4, 0XCDD3, 0XC592, 0XC551, 0XC510, 0XBCCE, 0XBCAF, 0XBCAE,
-  0XB46E, 0XB44D, 0XB42C, 0XAC0B, 0XABCB, 0XABAA, 0XA38A, 0XA349,
-  0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X9286, 0X8A46, 0X8A25, 0X8205,
-  0X81E4, 0X79C4, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7102,
-  0X6902, 0X7122, 0X7122, 0X7122, 0X7142, 0X7942, 0X7942, 0X7963,
-  0X81C4, 0X8205, 0X8A25, 0X8A25, 0X8A25, 0X8A25, 0X89E4, 0X8A04,
-  0X9266, 0X9AA7, 0X9AE8, 0XA349, 0XAB8A, 0XABCB, 0XB40C, 0XB44D,
-  0XBC8D, 0XBC8C, 0XBC4C, 0XBC6D, 0XC4CF, 0XCD51, 0XCD91, 0XCD92,
-  0XD5B2, 0XD5D3, 0XD5F4, 0XD5F4, 0XD615, 0XDE35, 0XDE56, 0XDE56,
-  0XDE57, 0XDE57, 0XDE77, 0XE6B8, 0XE6D8, 0XDE98, 0XDE98, 0XDEB9,
-  0XDEB9, 0XDEDA, 0XDEDA, 0XDEB9, 0XE6B9, 0XE6DB, 0XE77D, 0XCD75,
-  0XCC11, 0XEEDB, 0XE77C, 0XE6DB, 0XDE9A, 0XE6FB, 0XE71C, 0XE73C,
-  0XDF3D, 0XD6DB, 0XCEBB, 0XB67B, 0X95B8, 0X8D36, 0X8493, 0X6BAF,
-  0X52EB, 0X4227, 0X18E3, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X10A2, 0X52EA, 0X8C71,
-  0X9D74, 0XAE17, 0XC6BA, 0XDF5D, 0XE79E, 0XE7DE, 0XEFFF, 0XEFFF,
-  0XF7DF, 0XF7FF, 0XEFBE, 0XEF3C, 0XEF5D, 0XE77C, 0XE77C, 0XEF9D,
-  0XEF7C, 0XE77C, 0XEF7C, 0XEF9D, 0XEF7C, 0XE73B, 0XE75B, 0XE73A,
-  0XDF3A, 0XEF5B, 0XEF5B, 0XE71A, 0XEF1A, 0XE71A, 0XE719, 0XE6F9,
-  0XE6D8, 0XE6B8, 0XDEB7, 0XDE55, 0XDE15, 0XDE35, 0XD5F4, 0XD5F4,
-  0XD5F4, 0XD5D3, 0XCDB2, 0XC571, 0XC531, 0XBCEF, 0XBCCF, 0XBCCF,
-  0XBCAE, 0XB46D, 0XB42D, 0XAC0C, 0XABEC, 0XABCB, 0XA38A, 0XA36A,
-  0X9B29, 0X9AE8, 0X9AE7, 0X92A7, 0X9286, 0X8A66, 0X8A25, 0X8205,
-  0X81E4, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7142, 0X7122, 0X7102,
-  0X6902, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7942, 0X7983,
-  0X81C4, 0X81E4, 0X8A25, 0X8A45, 0X8A46, 0X8A45, 0X8A05, 0X9205,
-  0X9245, 0X9AA7, 0X9B08, 0XA329, 0XAB8A, 0XABCB, 0XB40C, 0XB42C,
-  0XBC4C, 0XBC4B, 0XBC6C, 0XC4AE, 0XC510, 0XCD51, 0XCD71, 0XCD92,
-  0XD592, 0XD5B2, 0XD5F3, 0XD5D4, 0XDDF5, 0XDE35, 0XD615, 0XDE36,
-  0XDE36, 0XDE77, 0XDE97, 0XE6B8, 0XDE78, 0XDE78, 0XE6DA, 0XE6FA,
-  0XE71B, 0XE75C, 0XE73C, 0XE6BA, 0XE71C, 0XEF7D, 0XE79D, 0XDE38,
-  0XD493, 0XE6BB, 0XE71C, 0XE6BA, 0XE71C, 0XE75C, 0XE75C, 0XDF3C,
-  0XD6FC, 0XC6BB, 0XB67B, 0XA5F8, 0X9535, 0X7C51, 0X73CE, 0X6BAD,
-  0X4248, 0X18C2, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0881, 0X4247,
-  0X8470, 0X9D95, 0XAE79, 0XCF1B, 0XD71C, 0XDFBD, 0XEFFF, 0XEFFF,
-  0XEFFF, 0XEFFF, 0XF7BE, 0XEF5D, 0XEF5D, 0XEF5C, 0XE77C, 0XE77C,
-  0XE77C, 0XE77C, 0XE77B, 0XEF9C, 0XEF5B, 0XE73B, 0XE75B, 0XDF3A,
-  0XDF19, 0XE75B, 0XE77C, 0XE73B, 0XE71A, 0XE6D8, 0XE6B8, 0XE6D8,
-  0XE6F8, 0XE6D8, 0XDE96, 0XDE15, 0XDE15, 0XDE56, 0XD635, 0XD5F4,
-  0XD5D3, 0XD5D3, 0XCDB3, 0XCD72, 0XC531, 0XC510, 0XBCCF, 0XBCCF,
-  0XBCAF, 0XB48E, 0XB44D, 0XB42C, 0XAC0C, 0XABCB, 0XABAA, 0XA36A,
-  0X9B29, 0X9AE8, 0X9AC7, 0X92A7, 0X9287, 0X8A66, 0X8A46, 0X8A25,
-  0X8205, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7142, 0X7122, 0X7102,
-  0X7102, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7963, 0X7983,
-  0X81C4, 0X8205, 0X8A05, 0X8A45, 0X8A66, 0X8A25, 0X8A26, 0X9266,
-  0X9246, 0X9A86, 0XA308, 0XAB6A, 0XABAB, 0XB3EC, 0XB42C, 0XBC4D,
-  0XBC4D, 0XBC0B, 0XBC2B, 0XC4AE, 0XC510, 0XCD50, 0XCD71, 0XD592,
-  0XD5B2, 0XCDB2, 0XD5B2, 0XD5B3, 0XDDF5, 0XDE56, 0XDE36, 0XDE36,
-  0XDE36, 0XDE77, 0XDE98, 0XDE78, 0XDE98, 0XDEB9, 0XE71B, 0XDF1B,
-  0XE77C, 0XE77C, 0XE6FB, 0XE73B, 0XE71B, 0XE6DA, 0XEF9D, 0XE6DA,
-  0XDD76, 0XE63A, 0XE6FC, 0XE73C, 0XE73C, 0XE73C, 0XDF1C, 0XD6DB,
-  0XCEBA, 0XB639, 0XA5F8, 0X9576, 0X7C93, 0X636D, 0X5B2A, 0X4A88,
-  0X18E2, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0840,
-  0X4227, 0X8450, 0X95D7, 0XA679, 0XC6FA, 0XDF5C, 0XE7BE, 0XEFFE,
-  0XEFFE, 0XEFFF, 0XEFBE, 0XEF9D, 0XEF7D, 0XEF5C, 0XEF7D, 0XE75C,
-  0XE77C, 0XE77C, 0XE77B, 0XE73B, 0XEF3B, 0XEF5C, 0XE77C, 0XE77C,
-  0XE71A, 0XDF3A, 0XE75B, 0XE75A, 0XE6D8, 0XE697, 0XDE77, 0XE698,
-  0XE697, 0XDE76, 0XD615, 0XDE15, 0XDE36, 0XD636, 0XDE56, 0XD615,
-  0XD5D4, 0XCDD3, 0XCDB3, 0XCD92, 0XC551, 0XC530, 0XBCF0, 0XBCCF,
-  0XBCAE, 0XB46D, 0XB44D, 0XB42C, 0XAC0C, 0XABEB, 0XABAB, 0XA38A,
-  0XA349, 0X9B08, 0X9AC7, 0X92A7, 0X92A7, 0X9266, 0X8A46, 0X8A25,
-  0X8205, 0X81E4, 0X79A4, 0X7983, 0X7963, 0X7943, 0X7142, 0X7122,
-  0X7102, 0X7122, 0X7142, 0X7143, 0X7963, 0X7983, 0X7963, 0X7983,
-  0X81C4, 0X81E4, 0X8A05, 0X8A46, 0X9266, 0X8A25, 0X9246, 0X9AA7,
-  0X9AA7, 0X9AC7, 0XA308, 0XAB69, 0XABCB, 0XB40C, 0XB44C, 0XBC6D,
-  0XBC6D, 0XBC2C, 0XBC2C, 0XC4AE, 0XCD30, 0XCD51, 0XCD92, 0XD5D3,
-  0XD5F3, 0XD5B2, 0XD592, 0XD593, 0XD5B4, 0XDE15, 0XDE77, 0XDE77,
-  0XDE98, 0XDEB8, 0XDEB9, 0XDEB9, 0XE6FA, 0XE71A, 0XE71B, 0XE75C,
-  0XDF1B, 0XDE58, 0XE71A, 0XE73B, 0XE638, 0XDDD7, 0XDDB6, 0XDD76,
-  0XE619, 0XE71D, 0XE73D, 0XEF7D, 0XE73D, 0XE73D, 0XDEFC, 0XCEBA,
-  0XBE38, 0XADD7, 0X9555, 0X84B2, 0X6BCE, 0X5B4B, 0X3A27, 0X18C2,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0840, 0X4268, 0X7CB1, 0X9DB5, 0XC71B, 0XDF5C, 0XDF5C, 0XE7BE,
-  0XEFBE, 0XEF9D, 0XEFBE, 0XEFBE, 0XEFBE, 0XEF7D, 0XEF3C, 0XE73B,
-  0XE77C, 0XE77C, 0XE75B, 0XE71A, 0XE75B, 0XEFBD, 0XEF9C, 0XE79C,
-  0XE77B, 0XE71A, 0XE71A, 0XE719, 0XE719, 0XE6F9, 0XDE98, 0XDE77,
-  0XDE56, 0XDE15, 0XDE57, 0XE677, 0XDE56, 0XD636, 0XDE35, 0XDE35,
-  0XD5F4, 0XCDD3, 0XCDB2, 0XCDB3, 0XCD52, 0XC531, 0XC510, 0XBCCF,
-  0XBCAE, 0XB48E, 0XB46D, 0XB42C, 0XAC0C, 0XABCB, 0XABAB, 0XA36A,
-  0XA308, 0X9AE8, 0X9B08, 0X92C7, 0X9286, 0X9266, 0X8A45, 0X8A05,
-  0X81E4, 0X81E4, 0X81C4, 0X79A3, 0X7963, 0X7942, 0X7122, 0X7122,
-  0X7102, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X7983, 0X7983,
-  0X81C4, 0X81C4, 0X8A05, 0X8A46, 0X9266, 0X8A45, 0X9266, 0X9AA7,
-  0X9AC8, 0XA308, 0XA329, 0XAB69, 0XABAA, 0XB40C, 0XB44D, 0XBC8D,
-  0XBC2C, 0XBC2D, 0XBCAE, 0XC4AE, 0XC510, 0XCD51, 0XCD72, 0XCDB3,
-  0XD5D2, 0XD5B3, 0XD5F4, 0XD635, 0XD615, 0XD636, 0XDE77, 0XDE98,
-  0XDEB9, 0XDED9, 0XE6F9, 0XE71A, 0XE71A, 0XE73B, 0XE75C, 0XE75B,
-  0XDE38, 0XDD75, 0XDE17, 0XE659, 0XEEDC, 0XE71C, 0XDE18, 0XDD96,
-  0XEEDC, 0XEF9E, 0XE77E, 0XE77E, 0XE79E, 0XDF5D, 0XD6FB, 0XC6DB,
-  0XB65A, 0X9D56, 0X8451, 0X6BCE, 0X5B4B, 0X4AA9, 0X1903, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0861, 0X4A88, 0X8C90, 0XB678, 0XBEDA, 0XD6FB, 0XE77D,
-  0XE77D, 0XEF9D, 0XEFBE, 0XEFBE, 0XEFDE, 0XEF9D, 0XE6FA, 0XE73B,
-  0XEF7C, 0XE77C, 0XE73B, 0XE6FA, 0XE77C, 0XEFBC, 0XEFBC, 0XE79C,
-  0XE77C, 0XE77C, 0XE73B, 0XDF1A, 0XE73B, 0XE75B, 0XDEB8, 0XDE56,
-  0XDE57, 0XDE77, 0XE6B8, 0XDED8, 0XDEB7, 0XDE76, 0XD615, 0XD615,
-  0XD615, 0XCDD4, 0XCD92, 0XCD92, 0XCD92, 0XC531, 0XC510, 0XBCF0,
-  0XBCCF, 0XBCAE, 0XB46D, 0XB44D, 0XB40C, 0XABCB, 0XAB8A, 0XA349,
-  0XA2E8, 0X9AE8, 0X9AC7, 0X9266, 0X9245, 0X9245, 0X8A25, 0X89E4,
-  0X81C4, 0X81C4, 0X81A3, 0X7983, 0X7963, 0X7942, 0X7122, 0X7122,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7983, 0X7983, 0X7983, 0X81A3,
-  0X81C4, 0X81C4, 0X8A05, 0X8A66, 0X9266, 0X9246, 0X9287, 0X9AA7,
-  0X9AC8, 0XA329, 0XAB6A, 0XABAA, 0XAB8A, 0XB389, 0XB3CA, 0XB3EB,
-  0XBBAA, 0XBBEB, 0XBC8D, 0XC48E, 0XCCF0, 0XCD52, 0XCD93, 0XCD92,
-  0XCD72, 0XD5D4, 0XDE35, 0XDE56, 0XDE77, 0XDE77, 0XDE57, 0XDE77,
-  0XDEB8, 0XDED9, 0XE6FA, 0XE71A, 0XDF1A, 0XE73B, 0XE6FA, 0XE698,
-  0XE637, 0XE679, 0XDE9A, 0XDE9A, 0XEF5D, 0XEF7D, 0XE73C, 0XD67A,
-  0XE75D, 0XEF9E, 0XEF7D, 0XE79D, 0XDF7D, 0XDF1C, 0XCE9A, 0XB65A,
-  0X9DF9, 0X8514, 0X73EF, 0X636D, 0X52CA, 0X2144, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X10A1, 0X5B0B, 0X9553, 0XAE37, 0XC6BA, 0XD6FB,
-  0XDF5C, 0XE77D, 0XE79D, 0XE7BD, 0XEFBD, 0XEF5C, 0XEF3C, 0XE71B,
-  0XEF3B, 0XE73B, 0XE6FA, 0XE6FA, 0XE75B, 0XEF9C, 0XEF9C, 0XE77B,
-  0XE77C, 0XE77C, 0XE77C, 0XE75B, 0XE73A, 0XDF3A, 0XE6D9, 0XE697,
-  0XE6B8, 0XE6D8, 0XE6D8, 0XE6D8, 0XDEB7, 0XE676, 0XDE35, 0XD5F4,
-  0XD5F4, 0XD5D3, 0XCD92, 0XCD72, 0XCD92, 0XC551, 0XC510, 0XBD10,
-  0XBCEF, 0XBCCF, 0XB48E, 0XB46D, 0XB42C, 0XABEB, 0XAB8A, 0XA329,
-  0XA349, 0X9B29, 0X9AC7, 0X9A86, 0X9286, 0X9266, 0X8A46, 0X8A25,
-  0X8A05, 0X81C4, 0X81A4, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7983, 0X79A3, 0X81A3, 0X81A4,
-  0X81C4, 0X89E4, 0X8A05, 0X9266, 0X9266, 0X9246, 0X9AA7, 0X9AC7,
-  0X9AE8, 0XA308, 0XA308, 0XAB29, 0XAB29, 0XAB28, 0XAB28, 0XB3AA,
-  0XBBCB, 0XBBAB, 0XBBAA, 0XC40C, 0XC4AF, 0XCD31, 0XCD71, 0XCD51,
-  0XD592, 0XD5D4, 0XD615, 0XD656, 0XDE56, 0XD636, 0XDE56, 0XDE77,
-  0XDE98, 0XDEB8, 0XDEB9, 0XE6F9, 0XE6D9, 0XDE98, 0XDE16, 0XDDF7,
-  0XDE17, 0XE679, 0XE73C, 0XEF3C, 0XEF3C, 0XEF3C, 0XE679, 0XE69A,
-  0XE75D, 0XE75C, 0XE75C, 0XE71C, 0XD6FB, 0XD6BB, 0XC67B, 0XA5F8,
-  0X8D55, 0X7471, 0X636D, 0X5ACA, 0X31A5, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X2123, 0X63CC, 0X9D74, 0XB5F7, 0XBE79,
-  0XDF3C, 0XE79D, 0XE7BD, 0XE77C, 0XE75B, 0XEF7D, 0XEF7D, 0XE71B,
-  0XE6FB, 0XE6FA, 0XE71B, 0XE71B, 0XE73B, 0XE77C, 0XE77C, 0XE77B,
-  0XDF7B, 0XE77B, 0XEF7C, 0XE75B, 0XDF1A, 0XDEF9, 0XDEB8, 0XE6B8,
-  0XE6B7, 0XE697, 0XE697, 0XDE96, 0XDE76, 0XDE56, 0XDE15, 0XD5D3,
-  0XCD72, 0XCD72, 0XCD72, 0XCD72, 0XC510, 0XBCCF, 0XC4EF, 0XBCCF,
-  0XBCAE, 0XBCAE, 0XB46D, 0XB44C, 0XB40C, 0XABCB, 0XAB8A, 0XA329,
-  0XA328, 0XA328, 0X9AE7, 0X9AA7, 0X92A6, 0X9266, 0X9246, 0X8A25,
-  0X8A05, 0X8205, 0X81C4, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122,
-  0X7122, 0X7142, 0X7942, 0X7963, 0X7983, 0X79A4, 0X81A4, 0X81C4,
-  0X81C4, 0X89E4, 0X8A05, 0X9245, 0X9266, 0X9246, 0X9AA7, 0X9AA7,
-  0X9AE8, 0XA308, 0XA2E8, 0XA2C8, 0XA2C7, 0XAB29, 0XB369, 0XBBCB,
-  0XBC0C, 0XBB8A, 0XBB8A, 0XBBAA, 0XC42C, 0XC4AE, 0XCCCF, 0XCD10,
-  0XCD72, 0XD5D3, 0XD5F4, 0XD5F4, 0XD5F5, 0XD5F5, 0XD636, 0XDE56,
-  0XDE56, 0XDE77, 0XDE98, 0XE698, 0XE678, 0XE637, 0XDDB5, 0XE637,
-  0XE658, 0XE659, 0XE699, 0XE6BA, 0XEF3C, 0XE6DA, 0XE659, 0XEEFC,
-  0XE71C, 0XE75C, 0XE77C, 0XDF1C, 0XD6FB, 0XCEFB, 0XB639, 0X9D55,
-  0X8492, 0X6B8E, 0X530B, 0X3207, 0X0881, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0020, 0X31A4, 0X73ED, 0X9D75, 0XBE59,
-  0XCEDA, 0XDEFA, 0XE73B, 0XE73B, 0XEF5C, 0XEF7C, 0XE75C, 0XEF3C,
-  0XE6FB, 0XE6FA, 0XE73B, 0XE73B, 0XE73B, 0XE77C, 0XEF7C, 0XE77C,
-  0XE75B, 0XE75B, 0XE77C, 0XE77B, 0XDF1A, 0XDED8, 0XE6B8, 0XE6B7,
-  0XE6B7, 0XE6B8, 0XE697, 0XE698, 0XE6B8, 0XDE97, 0XDE56, 0XD635,
-  0XD5D4, 0XCD52, 0XC530, 0XC4CF, 0XBC6D, 0XBCAE, 0XBCCF, 0XBCAE,
-  0XBC8E, 0XB46D, 0XB42D, 0XB42C, 0XAC0B, 0XABCB, 0XABAA, 0XAB49,
-  0XA328, 0XA328, 0X9AC8, 0X9A86, 0X9286, 0X9266, 0X9225, 0X8A25,
-  0X8A05, 0X81E4, 0X81C4, 0X7983, 0X7963, 0X7963, 0X7942, 0X7142,
-  0X7122, 0X7142, 0X7942, 0X7963, 0X7983, 0X7983, 0X81A4, 0X81E4,
-  0X81E4, 0X8A05, 0X8A05, 0X9225, 0X9266, 0X9246, 0X9AA7, 0X9AC8,
-  0X9AE8, 0XA308, 0XA2E8, 0XA2C7, 0XA2C7, 0XAB28, 0XAB49, 0XB349,
-  0XBBAB, 0XBBAA, 0XBC0B, 0XBC0B, 0XC42C, 0XC48E, 0XC44E, 0XC46E,
-  0XCD10, 0XD593, 0XD5B3, 0XD5B3, 0XD5B4, 0XD5D5, 0XDE15, 0XDE36,
-  0XDE36, 0XD615, 0XD5F5, 0XDDF5, 0XE657, 0XDDD5, 0XDD75, 0XE658,
-  0XE658, 0XE699, 0XE71B, 0XE6FB, 0XE6FB, 0XDE58, 0XE6BA, 0XEF7D,
-  0XEF7C, 0XE73C, 0XDF1B, 0XDEFB, 0XD6FB, 0XC6BA, 0XA5D7, 0X94F3,
-  0X740F, 0X5B2B, 0X4227, 0X10C2, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0840, 0X4206, 0X7C30, 0X9D75,
-  0XB617, 0XC638, 0XDEFA, 0XE75C, 0XE73B, 0XE71B, 0XE75C, 0XEF9D,
-  0XEF5C, 0XE6FA, 0XE6FA, 0XE71A, 0XE73A, 0XEF5B, 0XEF5B, 0XEF5B,
-  0XEF5C, 0XE75C, 0XE77C, 0XE77C, 0XDF5A, 0XE6F9, 0XE6F9, 0XE6F9,
-  0XE6F9, 0XE71A, 0XDEF9, 0XDED8, 0XDED8, 0XDED8, 0XDEB7, 0XD677,
-  0XD656, 0XCD93, 0XC4D0, 0XC46E, 0XBC6E, 0XC510, 0XC531, 0XBCF0,
-  0XBCCF, 0XBCAF, 0XBC8E, 0XB44D, 0XB42D, 0XB40C, 0XABEB, 0XAB8A,
-  0XA36A, 0XA34A, 0XA329, 0X9AE8, 0X9AA7, 0X9287, 0X9266, 0X8A46,
-  0X8A05, 0X81E4, 0X81A3, 0X7963, 0X7963, 0X7963, 0X7942, 0X7142,
-  0X7122, 0X7142, 0X7942, 0X7962, 0X7963, 0X7983, 0X81C4, 0X81E5,
-  0X8205, 0X8A05, 0X9225, 0X9225, 0X9245, 0X9266, 0X9AA7, 0X9AE8,
-  0XA309, 0XA2E8, 0X9AC7, 0XA2C7, 0XAB29, 0XAB8A, 0XB3AB, 0XB38A,
-  0XB369, 0XBB8A, 0XBC2C, 0XC46D, 0XC42D, 0XC42D, 0XC44D, 0XCC8E,
-  0XCCAF, 0XD552, 0XD572, 0XD510, 0XD532, 0XD5B4, 0XD5B4, 0XD593,
-  0XD593, 0XD5B4, 0XD5B4, 0XD533, 0XDDD5, 0XDDB5, 0XDDB6, 0XE6B9,
-  0XE6DA, 0XE6FB, 0XE71B, 0XEF5C, 0XE6DA, 0XDE79, 0XEF1C, 0XEF5C,
-  0XEF5D, 0XE77D, 0XDF1B, 0XD6FB, 0XD6FB, 0XB659, 0X9DD6, 0X84B2,
-  0X6BAD, 0X632B, 0X2965, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X10A1, 0X4A69, 0X7BEF,
-  0XA595, 0XBE79, 0XD6DA, 0XDF1B, 0XDEFB, 0XE6FB, 0XE75C, 0XEF7C,
-  0XEF3B, 0XEEFA, 0XE6D9, 0XEF3B, 0XEF5B, 0XEF1A, 0XEF5B, 0XE75B,
-  0XE75B, 0XE77B, 0XE75B, 0XE75B, 0XE73A, 0XE73B, 0XE71B, 0XE6F9,
-  0XE719, 0XE75A, 0XDF3A, 0XDEF9, 0XDEF8, 0XDED8, 0XDEB7, 0XD697,
-  0XDE36, 0XCDB3, 0XC551, 0XCD12, 0XC4D0, 0XC511, 0XC551, 0XC531,
-  0XBCF0, 0XBCF0, 0XBCCF, 0XB48E, 0XB44D, 0XB42C, 0XABEC, 0XABAA,
-  0XA38A, 0XA36A, 0XA349, 0X9B08, 0X9AC7, 0X92A7, 0X9266, 0X8A46,
-  0X8A25, 0X89E5, 0X81A3, 0X8183, 0X7963, 0X7963, 0X7943, 0X7142,
-  0X7122, 0X7142, 0X7942, 0X7942, 0X7963, 0X81A3, 0X81E4, 0X81E5,
-  0X8A25, 0X8A05, 0X8A25, 0X9225, 0X9225, 0X9A87, 0X9AC8, 0X9B08,
-  0XA329, 0X9AE8, 0XA2E8, 0XAB49, 0XAB69, 0XB3AB, 0XB3EB, 0XB3EB,
-  0XBBEB, 0XBC2C, 0XBC6D, 0XC4AF, 0XC4CF, 0XC4CF, 0XCCEF, 0XD531,
-  0XCCCF, 0XCD11, 0XCD31, 0XCC6E, 0XCC90, 0XDDD5, 0XD593, 0XCCD1,
-  0XCCF1, 0XDDF5, 0XDE36, 0XD573, 0XDDB5, 0XDE38, 0XE678, 0XE699,
-  0XE6BA, 0XE6BA, 0XE6FB, 0XEF1B, 0XE69A, 0XE6DA, 0XEF5C, 0XE75D,
-  0XE75C, 0XE77D, 0XD73C, 0XD6FB, 0XC6B9, 0XADF7, 0X8D35, 0X740F,
-  0X736C, 0X4A68, 0X1081, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X2103, 0X5B0B,
-  0X94B2, 0XB5D7, 0XC657, 0XD699, 0XD6B9, 0XDEDA, 0XE71B, 0XE71A,
-  0XE71A, 0XE71A, 0XEF3B, 0XEF3A, 0XEF5B, 0XEF5C, 0XEF7C, 0XE77B,
-  0XE77B, 0XE77B, 0XE75B, 0XE73B, 0XE71B, 0XDEFA, 0XE71A, 0XDEF9,
-  0XDF19, 0XE75B, 0XE73A, 0XE719, 0XDEF9, 0XDED8, 0XDED8, 0XDE97,
-  0XD635, 0XD592, 0XCD72, 0XCDB4, 0XC511, 0XC4D0, 0XC551, 0XC551,
-  0XC510, 0XBCF0, 0XBCCF, 0XB4AE, 0XB46D, 0XB42D, 0XAC0C, 0XABCA,
-  0XA38A, 0XA36A, 0XA349, 0X9B08, 0X9AC7, 0X92A7, 0X9266, 0X9246,
-  0X8A25, 0X81E4, 0X81A3, 0X8183, 0X7963, 0X7963, 0X7963, 0X7142,
-  0X7122, 0X7142, 0X7942, 0X7942, 0X7963, 0X81A4, 0X81E4, 0X8A05,
-  0X8A25, 0X8A25, 0X8A05, 0X9225, 0X9225, 0X9287, 0X9AC8, 0X9AE8,
-  0XA2E8, 0XA2E8, 0XA329, 0XAB6A, 0XAB6A, 0XAB8A, 0XB3AA, 0XB3CA,
-  0XBC0B, 0XBC4C, 0XBC8E, 0XC4CF, 0XC510, 0XC551, 0XCD31, 0XCD51,
-  0XCD31, 0XCCCF, 0XCCD0, 0XD553, 0XCD32, 0XD552, 0XDD94, 0XDE16,
-  0XD636, 0XDDD4, 0XDD94, 0XE5F6, 0XE658, 0XDE58, 0XE6B9, 0XE6BA,
-  0XE69A, 0XE6BA, 0XE6DA, 0XE6BA, 0XE69A, 0XEF1B, 0XEF5C, 0XE75C,
-  0XE73C, 0XDF1B, 0XD6DB, 0XCEDA, 0XB659, 0X9D96, 0X84D3, 0X6BCD,
-  0X5B2A, 0X2944, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0840, 0X31C5,
-  0X738E, 0X9CF3, 0XB5B5, 0XC637, 0XCE58, 0XD6B8, 0XDED9, 0XDEDA,
-  0XE71A, 0XF77C, 0XF77C, 0XE6FA, 0XF75B, 0XF77C, 0XEF5B, 0XEF7C,
-  0XEF7C, 0XE75B, 0XE75C, 0XE77C, 0XE75B, 0XDEFA, 0XE6FA, 0XE719,
-  0XE6D9, 0XE71A, 0XE73A, 0XE719, 0XE719, 0XE6F8, 0XE6B8, 0XDE76,
-  0XD614, 0XCD52, 0XCD93, 0XD615, 0XCD72, 0XBCCF, 0XC531, 0XC551,
-  0XC530, 0XBCF0, 0XBCCF, 0XBCAE, 0XB46E, 0XB44D, 0XAC0C, 0XABCB,
-  0XABAB, 0XA36A, 0XA349, 0X9B09, 0X9AC7, 0X92A7, 0X92A7, 0X9246,
-  0X8A05, 0X89E4, 0X81A4, 0X8183, 0X7983, 0X7963, 0X7963, 0X7142,
-  0X7122, 0X7142, 0X7942, 0X7963, 0X7963, 0X81A4, 0X81E4, 0X8A05,
-  0X8A25, 0X8A25, 0X8A05, 0X9205, 0X9245, 0X9266, 0X9A67, 0X9AA7,
-  0X9AA7, 0XA2E8, 0XA308, 0XAB29, 0XAB49, 0XAB69, 0XB3AA, 0XB40B,
-  0XBC4C, 0XBC4D, 0XBC8E, 0XC4EF, 0XC510, 0XC530, 0XC510, 0XCD11,
-  0XCD73, 0XCD11, 0XCCF2, 0XD5F5, 0XD593, 0XCCD1, 0XD5D5, 0XDE77,
-  0XDE77, 0XDE36, 0XDD94, 0XE5D5, 0XE637, 0XDE99, 0XE6DA, 0XE6BA,
-  0XE6BA, 0XE6FB, 0XDEDB, 0XDE79, 0XE6BA, 0XEF3C, 0XEF5C, 0XE73C,
-  0XE73C, 0XDEFB, 0XCEBA, 0XBE79, 0XA5B7, 0X8CF4, 0X7C50, 0X73ED,
-  0X4267, 0X0881, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X18C2,
-  0X4A88, 0X8410, 0XA534, 0XBDB5, 0XC5F7, 0XCE17, 0XDE98, 0XDEDA,
-  0XE73B, 0XF77C, 0XEF5B, 0XEF5C, 0XEF1A, 0XF73A, 0XEF5B, 0XEF5C,
-  0XEF5B, 0XE75B, 0XE75B, 0XE75B, 0XE75C, 0XE71A, 0XE71A, 0XE71A,
-  0XE71A, 0XE71A, 0XE73A, 0XE719, 0XE719, 0XE719, 0XDE97, 0XD636,
-  0XD615, 0XCD93, 0XCD93, 0XD5F4, 0XCD93, 0XBCF0, 0XC4F0, 0XC531,
-  0XC530, 0XC510, 0XBCCF, 0XBCAF, 0XB46E, 0XB44D, 0XAC0C, 0XABCB,
-  0XABAB, 0XA38A, 0XA349, 0X9B29, 0X9AA7, 0X9266, 0X9287, 0X9225,
-  0X89E4, 0X89C4, 0X81A4, 0X8183, 0X7983, 0X7983, 0X7963, 0X7942,
-  0X7122, 0X7942, 0X7963, 0X7963, 0X8183, 0X81C4, 0X81E4, 0X8A05,
-  0X8A25, 0X8A45, 0X9245, 0X9225, 0X9225, 0X9225, 0X9A46, 0XA2A7,
-  0XA2C7, 0XA308, 0XAB49, 0XAB49, 0XAB6A, 0XB3CB, 0XB42C, 0XB44D,
-  0XBC6D, 0XBC6D, 0XBCAE, 0XBCEF, 0XC510, 0XBCCF, 0XBC8F, 0XCD11,
-  0XCD93, 0XD5F4, 0XD615, 0XD5F4, 0XD615, 0XD616, 0XDE78, 0XDEB9,
-  0XDEB8, 0XDEB8, 0XE698, 0XDE16, 0XDDD5, 0XE658, 0XE699, 0XDE99,
-  0XE699, 0XE6FB, 0XE6BA, 0XE679, 0XEF1B, 0XEF5C, 0XEF5C, 0XE75C,
-  0XE73C, 0XDF1B, 0XCEBA, 0XB659, 0X9D76, 0X7C31, 0X6BAE, 0X636C,
-  0X2984, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0861,
-  0X39C5, 0X7BAE, 0X9CB3, 0XAD75, 0XBDB6, 0XC575, 0XCE16, 0XDEB9,
-  0XE6B9, 0XE6FA, 0XEF3B, 0XEF3B, 0XEF1A, 0XEEFA, 0XEF1A, 0XEF7C,
-  0XE75C, 0XEF7C, 0XE75C, 0XE73B, 0XE73B, 0XE73A, 0XE73B, 0XE71A,
-  0XE71A, 0XE75B, 0XDF3A, 0XE71A, 0XE719, 0XDED8, 0XE6B7, 0XDE98,
-  0XD636, 0XD5D4, 0XCD93, 0XCD92, 0XCD72, 0XC531, 0XC511, 0XBCEF,
-  0XC510, 0XC510, 0XBCEF, 0XBCAF, 0XB46E, 0XB44D, 0XABEC, 0XABCB,
-  0XABCB, 0XA38A, 0XA369, 0X9B29, 0X9AA7, 0X9225, 0X9225, 0X8A05,
-  0X89E4, 0X89C4, 0X81A3, 0X8183, 0X8183, 0X7983, 0X7963, 0X7963,
-  0X7122, 0X7942, 0X7963, 0X7963, 0X7983, 0X81C4, 0X8A04, 0X8A05,
-  0X8A25, 0X9246, 0X9246, 0X9245, 0X9225, 0X9246, 0X9AA7, 0X9AA7,
-  0XA2E8, 0XAB6A, 0XABCB, 0XABEC, 0XABCB, 0XABCB, 0XB42C, 0XB46D,
-  0XBC6E, 0XBC6D, 0XBC8E, 0XBCCF, 0XC4F0, 0XBCAF, 0XC4D0, 0XCD72,
-  0XCDD4, 0XD615, 0XD615, 0XD615, 0XDE77, 0XDEB8, 0XDEB9, 0XDED9,
-  0XDEB8, 0XE6B9, 0XDEB9, 0XE6B9, 0XDE16, 0XDDF7, 0XE699, 0XDE79,
-  0XDE59, 0XE699, 0XE658, 0XEEBA, 0XEF5C, 0XEF5C, 0XEF7D, 0XE77D,
-  0XE73C, 0XDEFB, 0XCEBA, 0XB5F8, 0X8CD3, 0X6BCF, 0X634D, 0X4207,
-  0X0881, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X2123, 0X5AEA, 0X8430, 0XA555, 0XB575, 0XBD33, 0XCDD5, 0XD637,
-  0XDE57, 0XE6D9, 0XE6FA, 0XEF3B, 0XEF7C, 0XEF5C, 0XEF1B, 0XEF7C,
-  0XE77C, 0XE77C, 0XEF7D, 0XEF5C, 0XE75B, 0XDF1B, 0XE73B, 0XE73A,
-  0XDF1A, 0XE75B, 0XE73A, 0XE71A, 0XE6F9, 0XDEB7, 0XDEB7, 0XDED8,
-  0XD656, 0XD5D4, 0XCD71, 0XC530, 0XCD72, 0XCD93, 0XC552, 0XBCD0,
-  0XC4D0, 0XC4F0, 0XBCEF, 0XBCAF, 0XB46E, 0XB44D, 0XAC0C, 0XABCB,
-  0XABCB, 0XA38A, 0XA349, 0X9B08, 0X9A66, 0X9205, 0X91E5, 0X91E5,
-  0X89E5, 0X89C4, 0X81C4, 0X81A4, 0X81A4, 0X79A4, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7963, 0X7983, 0X81C4, 0X8A04, 0X8A04,
-  0X8A05, 0X9266, 0X9266, 0X9266, 0X9266, 0X9AA7, 0X9AC8, 0X9AA7,
-  0XA329, 0XABCB, 0XABEC, 0XAC0C, 0XB40C, 0XABCB, 0XABCB, 0XBC2D,
-  0XBC4D, 0XBC2C, 0XBC4D, 0XBC6E, 0XBC8E, 0XC4F0, 0XC531, 0XC552,
-  0XCDB4, 0XD636, 0XD615, 0XD636, 0XDE97, 0XDEB8, 0XDEB8, 0XDEB8,
-  0XDEB8, 0XE6D9, 0XE6D9, 0XDEB9, 0XDE37, 0XE638, 0XE699, 0XE6BA,
-  0XDE59, 0XE618, 0XE6BA, 0XEF3C, 0XEF5C, 0XEF3C, 0XEF5C, 0XE73C,
-  0XDF1B, 0XD6DB, 0XC679, 0XAD96, 0X8C72, 0X6B8E, 0X5B2B, 0X2964,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X1081, 0X31E6, 0X638E, 0X9D14, 0XBDB6, 0XBD54, 0XCDD5, 0XCDF6,
-  0XDE57, 0XE6B9, 0XE6FA, 0XEF1B, 0XEF3B, 0XEF5C, 0XEF5C, 0XEF7D,
-  0XE77C, 0XE73B, 0XE73B, 0XE75C, 0XE77C, 0XDF1B, 0XE71A, 0XE71A,
-  0XDEFA, 0XE73A, 0XE75A, 0XDF19, 0XDED8, 0XDED9, 0XDED8, 0XDEB7,
-  0XD615, 0XCDB3, 0XCD72, 0XCD93, 0XCDD4, 0XCDB3, 0XC572, 0XC510,
-  0XBCAF, 0XBCCF, 0XBCCF, 0XBCAE, 0XB48E, 0XB44D, 0XAC0C, 0XABCB,
-  0XABAB, 0XA349, 0XA2E7, 0XA2A7, 0X9A46, 0X9225, 0X9225, 0X9205,
-  0X8A05, 0X89E5, 0X89E4, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7963, 0X7983, 0X81C4, 0X8204, 0X8A04,
-  0X8A25, 0X8A46, 0X9287, 0X92A7, 0X92A7, 0X9AC8, 0XA2E8, 0X9AC8,
-  0XA36A, 0XABCB, 0XABEC, 0XAC0C, 0XB40C, 0XABEB, 0XB3CB, 0XB42D,
-  0XB40C, 0XB3EC, 0XBC0C, 0XBC0C, 0XBC4E, 0XBCAF, 0XC510, 0XCD72,
-  0XCDD4, 0XD615, 0XCDF5, 0XD636, 0XD677, 0XD677, 0XDE98, 0XDEB9,
-  0XDEB9, 0XDEB9, 0XE6DA, 0XE6FA, 0XDE78, 0XDE38, 0XE699, 0XE6BA,
-  0XE69A, 0XE659, 0XEF3C, 0XEF5C, 0XEF5D, 0XEF5D, 0XE75D, 0XE73C,
-  0XDEFB, 0XCEDB, 0XB659, 0X9D76, 0X8452, 0X638E, 0X3A48, 0X10A2,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0020, 0X2103, 0X52EB, 0X8CB3, 0XB5B6, 0XBD95, 0XBD94, 0XCDD5,
-  0XD637, 0XDE78, 0XE6DA, 0XE6DA, 0XE6DA, 0XEF1B, 0XEF5C, 0XEF5C,
-  0XEF5C, 0XE73B, 0XDEFA, 0XE71A, 0XE73B, 0XDEFA, 0XE6FA, 0XE71B,
-  0XDEFA, 0XE6D9, 0XE71A, 0XDEF8, 0XDED8, 0XDEF9, 0XDED8, 0XD697,
-  0XD615, 0XD5D4, 0XD5F5, 0XD5F5, 0XCDF4, 0XCDB3, 0XC572, 0XC551,
-  0XBCAF, 0XBC6E, 0XBCAE, 0XBCAE, 0XB46D, 0XB42C, 0XABAA, 0XAB69,
-  0XAB49, 0XAAE8, 0XA2C7, 0XA2C8, 0X9A66, 0X9A66, 0X9287, 0X9225,
-  0X8A05, 0X8A05, 0X89E4, 0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X8183, 0X81C4, 0X8A05, 0X8A04,
-  0X8A25, 0X9266, 0X92A7, 0X9AE8, 0X9AC7, 0X9AC8, 0XA2E8, 0XA329,
-  0XA36A, 0XABCB, 0XABEC, 0XAC0C, 0XB3EC, 0XB3EC, 0XB3EC, 0XB42D,
-  0XB40C, 0XB3AB, 0XBC0C, 0XBCAF, 0XC4D0, 0XC4D0, 0XC511, 0XCDB3,
-  0XCDF4, 0XCDF4, 0XD615, 0XD677, 0XDE97, 0XD677, 0XD678, 0XDEB9,
-  0XDED9, 0XDEB9, 0XE6D9, 0XE6D9, 0XDE58, 0XDE17, 0XE699, 0XEEFB,
-  0XEF3C, 0XE6BA, 0XEEFB, 0XF79D, 0XEF7D, 0XEF7D, 0XEF7D, 0XE77D,
-  0XD71C, 0XC6BA, 0XB659, 0X9555, 0X7C30, 0X534C, 0X2985, 0X0820,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X18C2, 0X4A88, 0X73EF, 0XA535, 0XBDB6, 0XBDB6, 0XCDD6,
-  0XD616, 0XDE78, 0XE699, 0XE6FA, 0XEF1B, 0XEEFA, 0XEF1B, 0XEF7C,
-  0XE73B, 0XE71B, 0XDF1A, 0XE6FA, 0XDEDA, 0XDE98, 0XDED9, 0XDEF9,
-  0XDEF9, 0XDEB8, 0XE6B9, 0XDEB8, 0XD697, 0XDED9, 0XDED9, 0XDE97,
-  0XD615, 0XD5F5, 0XCDF5, 0XCDF4, 0XCDF4, 0XCDB3, 0XC572, 0XC571,
-  0XC4F0, 0XBC4D, 0XB40C, 0XB40C, 0XB40C, 0XB3CA, 0XAB28, 0XAB28,
-  0XAB09, 0XA308, 0XA329, 0XA329, 0X9AA7, 0X9A87, 0X92A7, 0X9246,
-  0X8A05, 0X8A05, 0X8A05, 0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81A3, 0X81C4, 0X8A05, 0X8A05,
-  0X8A25, 0X9287, 0X92A7, 0X9AE8, 0X9AE8, 0X9AA7, 0X9AE7, 0XA349,
-  0XA38A, 0XABAB, 0XABEB, 0XABEC, 0XB40C, 0XABEC, 0XB3EC, 0XB3EC,
-  0XB3CB, 0XB3CB, 0XBC2D, 0XBCF0, 0XC510, 0XC531, 0XC572, 0XC593,
-  0XCDD4, 0XCDD4, 0XCE15, 0XD676, 0XD677, 0XD657, 0XD677, 0XD677,
-  0XD677, 0XDE98, 0XDEB8, 0XDE98, 0XDE79, 0XE679, 0XE6DB, 0XEF3C,
-  0XF77D, 0XEF1B, 0XDE59, 0XEF5D, 0XEF9E, 0XEF9D, 0XEF7D, 0XE77C,
-  0XDF5C, 0XC6BA, 0XADD7, 0X8CD3, 0X73F0, 0X52EA, 0X2103, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X10A2, 0X3A07, 0X6B6D, 0X9D14, 0XB5B6, 0XB555, 0XC595,
-  0XD637, 0XD658, 0XDE58, 0XE6DA, 0XEF3C, 0XE6FB, 0XE6FA, 0XEF3B,
-  0XE71A, 0XE71B, 0XE73B, 0XDEFA, 0XE6DA, 0XDEFA, 0XDED9, 0XDEF9,
-  0XDEFA, 0XDEFA, 0XDEB9, 0XDE98, 0XD697, 0XD697, 0XDEB8, 0XDEB8,
-  0XD635, 0XCDF5, 0XD5F5, 0XCDD3, 0XCDB3, 0XCD92, 0XC551, 0XC510,
-  0XBCAE, 0XBC4D, 0XBC0C, 0XB38A, 0XB36A, 0XB36A, 0XAB6A, 0XAB6A,
-  0XAB6A, 0XA36A, 0XA36A, 0XA328, 0X9A87, 0X9AA7, 0X9AA7, 0X9246,
-  0X9205, 0X8A25, 0X8A05, 0X81E4, 0X81E4, 0X81C4, 0X79A3, 0X7983,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81A3, 0X81C4, 0X8A05, 0X8A04,
-  0X8A25, 0X9287, 0X92A7, 0X9AC7, 0X9B08, 0X9AA7, 0X9AC7, 0XA329,
-  0XAB6A, 0XAB8B, 0XABAB, 0XABEB, 0XABEC, 0XABCB, 0XB40C, 0XB3EB,
-  0XB3CB, 0XB40D, 0XBCAF, 0XC4F0, 0XC531, 0XC572, 0XC573, 0XCDB4,
-  0XCDF4, 0XCE15, 0XD656, 0XD677, 0XD697, 0XD697, 0XD677, 0XD657,
-  0XD657, 0XD657, 0XD656, 0XDE78, 0XE6FB, 0XEF1B, 0XE6FB, 0XEF3C,
-  0XF77D, 0XEF5D, 0XDE9A, 0XDEBB, 0XF7BE, 0XF79D, 0XEF7D, 0XDF5C,
-  0XD73C, 0XC699, 0XA596, 0X84B4, 0X73D0, 0X4AA9, 0X10C2, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0861, 0X2985, 0X52EA, 0X8CB2, 0XAD55, 0XB513, 0XBDB5,
-  0XCDF6, 0XCDD6, 0XD5F7, 0XDE78, 0XE6FA, 0XE71A, 0XE6D9, 0XE6F9,
-  0XE71A, 0XE71B, 0XE73B, 0XDEFA, 0XE6FA, 0XE71B, 0XDEB9, 0XDE98,
-  0XDEFA, 0XDF1A, 0XDED9, 0XD697, 0XD636, 0XD656, 0XDEB8, 0XDE97,
-  0XD635, 0XCDB3, 0XCDD4, 0XCD92, 0XC571, 0XCD52, 0XC510, 0XBCAE,
-  0XBC6D, 0XB44D, 0XBC4D, 0XB42D, 0XB38B, 0XB3AA, 0XABEB, 0XABCB,
-  0XABCB, 0XA38A, 0XA36A, 0XA328, 0X9AA7, 0X9A66, 0X9A66, 0X9246,
-  0X9226, 0X8A25, 0X8A05, 0X8205, 0X81E4, 0X81C4, 0X79A4, 0X7983,
-  0X7142, 0X7942, 0X7963, 0X7983, 0X81A3, 0X81C4, 0X8A04, 0X8A04,
-  0X8A25, 0X9287, 0X92C7, 0X9AC7, 0X9AE8, 0X9AC7, 0X9AE8, 0XA349,
-  0XAB8A, 0XABAB, 0XABAB, 0XABCB, 0XABCB, 0XABCB, 0XB3CC, 0XB40C,
-  0XB40C, 0XB40C, 0XBCCF, 0XC510, 0XC531, 0XC572, 0XC5B3, 0XCDD3,
-  0XCDB2, 0XC592, 0XCDB3, 0XCDF4, 0XCE35, 0XD677, 0XD677, 0XD677,
-  0XD677, 0XDE98, 0XDE98, 0XE698, 0XEEDA, 0XEF1B, 0XEF1C, 0XEF3C,
-  0XEF5D, 0XF77D, 0XF7BE, 0XE71C, 0XEF5D, 0XF7DE, 0XE77D, 0XDF3C,
-  0XD71C, 0XBE59, 0X9D76, 0X8C93, 0X738E, 0X3A07, 0X0861, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X2144, 0X4288, 0X73AE, 0X9CB2, 0XAD33, 0XBDD5,
-  0XCE16, 0XD636, 0XDE37, 0XDE78, 0XE6DA, 0XE71B, 0XE6FA, 0XE6FA,
-  0XEEFB, 0XE6DA, 0XE6FB, 0XE73C, 0XDF1B, 0XE71B, 0XDEDA, 0XDE57,
-  0XDEB9, 0XDEFA, 0XDEF9, 0XDED9, 0XD657, 0XD657, 0XDE97, 0XDE76,
-  0XD5F4, 0XCD92, 0XCDD4, 0XCDB3, 0XC572, 0XCD72, 0XC551, 0XBC8E,
-  0XC4AF, 0XBCCF, 0XBC8E, 0XB44D, 0XB40C, 0XB3EC, 0XB3EC, 0XABEC,
-  0XABCB, 0XA38A, 0XA36A, 0XA349, 0X9AC7, 0X9A46, 0X9246, 0X9246,
-  0X9246, 0X8A25, 0X8A25, 0X8205, 0X81E4, 0X81A4, 0X79A4, 0X7983,
-  0X7122, 0X7942, 0X7963, 0X7983, 0X81A3, 0X81E4, 0X8A05, 0X8A04,
-  0X8A25, 0X9286, 0X92C7, 0X9B08, 0X9B08, 0X9AC7, 0X9AE8, 0XA349,
-  0XAB8A, 0XABCB, 0XABCB, 0XABAB, 0XABCB, 0XB3CB, 0XB3EC, 0XB44D,
-  0XB44D, 0XBC4D, 0XBCAF, 0XBD31, 0XC531, 0XC551, 0XC551, 0XC530,
-  0XCD52, 0XCD93, 0XCD72, 0XCD93, 0XCDB4, 0XCDD4, 0XD636, 0XD677,
-  0XDE98, 0XDEDA, 0XE73B, 0XE73B, 0XEF3B, 0XEF3C, 0XEF5D, 0XF77D,
-  0XEF7D, 0XF79D, 0XF7DE, 0XEF9D, 0XE6DB, 0XE6FC, 0XE77D, 0XDF1B,
-  0XCEDB, 0XB639, 0X9534, 0X7C10, 0X630C, 0X2965, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X2123, 0X4A68, 0X6B4D, 0X9CB2, 0XAD74, 0XB574,
-  0XC616, 0XCE56, 0XD677, 0XDEB9, 0XE71B, 0XEF5C, 0XE71B, 0XE6FA,
-  0XE6FA, 0XE6DA, 0XE6FA, 0XE73C, 0XDF1B, 0XE6FB, 0XE71B, 0XDE98,
-  0XDED9, 0XDF1A, 0XDEB9, 0XDED9, 0XDED9, 0XDE98, 0XD677, 0XD656,
-  0XD615, 0XCDB3, 0XD5F5, 0XD5F5, 0XCDD4, 0XCD92, 0XC572, 0XC4CF,
-  0XC48E, 0XC4CF, 0XBC6E, 0XB42C, 0XB42D, 0XB42D, 0XB40C, 0XAC0C,
-  0XABCB, 0XABAA, 0XA36A, 0XA349, 0X9AC8, 0X9A46, 0X9226, 0X9246,
-  0X9245, 0X8A25, 0X8A25, 0X8205, 0X81C4, 0X81C4, 0X79A4, 0X7983,
-  0X7142, 0X7142, 0X7962, 0X7983, 0X81A3, 0X81C4, 0X89E4, 0X89E4,
-  0X9225, 0X9286, 0X9AC7, 0X9B08, 0X9AE7, 0X9286, 0X9AC7, 0XA328,
-  0XA329, 0XAB8A, 0XABAB, 0XABAB, 0XABCB, 0XB40C, 0XB44D, 0XB44D,
-  0XB46D, 0XBCAF, 0XBCCF, 0XC510, 0XC531, 0XC510, 0XC531, 0XCD93,
-  0XCE15, 0XD656, 0XD677, 0XD656, 0XD697, 0XD6B9, 0XD6D9, 0XDEFA,
-  0XE71B, 0XDF5B, 0XE75C, 0XE75C, 0XEF7D, 0XEF7D, 0XEF9D, 0XF7BE,
-  0XF7BE, 0XEF9E, 0XF77D, 0XEF7D, 0XE6DA, 0XDE79, 0XDEBA, 0XD67A,
-  0XC639, 0XAE38, 0X8D55, 0X73EF, 0X4248, 0X18C3, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X18C2, 0X4207, 0X634C, 0X94F4, 0XAD95, 0XB595,
-  0XC616, 0XCE77, 0XD698, 0XDED9, 0XE71B, 0XE75C, 0XEF7C, 0XEF3C,
-  0XE6FB, 0XE699, 0XDE58, 0XDED9, 0XDEDA, 0XDE99, 0XE6FA, 0XE6DA,
-  0XDEB9, 0XE71A, 0XDED9, 0XD6B8, 0XD6B8, 0XD6B8, 0XD6B7, 0XD6B7,
-  0XD636, 0XCD93, 0XD5F5, 0XD615, 0XCDD3, 0XCD92, 0XCD72, 0XC551,
-  0XBCAE, 0XBC4D, 0XBC4D, 0XB46E, 0XB46E, 0XB44D, 0XB42C, 0XABEB,
-  0XABCB, 0XA38A, 0XA36A, 0XA349, 0X9AC7, 0X9A26, 0X9246, 0X9246,
-  0X9225, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A3, 0X7983,
-  0X7142, 0X7942, 0X7942, 0X7983, 0X81A4, 0X81C4, 0X81E4, 0X89E4,
-  0X9225, 0X9266, 0X9AC7, 0X9AC7, 0X9286, 0X92A7, 0XA308, 0XA369,
-  0XAB49, 0XA329, 0XAB8A, 0XB3EC, 0XB3EC, 0XB42C, 0XB42D, 0XB44D,
-  0XBC8E, 0XBCCF, 0XBCD0, 0XBCAF, 0XC510, 0XC552, 0XCDB3, 0XCDD4,
-  0XCDF4, 0XD636, 0XD656, 0XD656, 0XD677, 0XDED9, 0XD71A, 0XDF1A,
-  0XE73B, 0XE75C, 0XE77C, 0XEF9D, 0XEF9D, 0XEFBE, 0XEFBE, 0XEFBE,
-  0XF7BE, 0XF7DE, 0XF79D, 0XEF5D, 0XE71C, 0XDEFB, 0XD6BA, 0XCE79,
-  0XC618, 0XADB7, 0X8D34, 0X63AE, 0X39E7, 0X10C2, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X10A1, 0X3A27, 0X634C, 0X8CB3, 0XAD76, 0XB5D6,
-  0XC637, 0XD6B9, 0XDEDA, 0XDEB9, 0XDF1A, 0XE71B, 0XE73C, 0XEF3C,
-  0XE6FB, 0XE6DA, 0XE699, 0XDE58, 0XDE79, 0XDE99, 0XDE98, 0XDE98,
-  0XDE78, 0XE6D9, 0XDED9, 0XD6B8, 0XDEB8, 0XDED8, 0XDED8, 0XD6D8,
-  0XD697, 0XCDD4, 0XD5B4, 0XD5F5, 0XCD93, 0XCD92, 0XCD72, 0XC531,
-  0XBC8E, 0XB40C, 0XBC8E, 0XB48E, 0XB44D, 0XB44D, 0XB40C, 0XABEB,
-  0XABCB, 0XA38A, 0XA38A, 0XA349, 0X9A87, 0X9A26, 0X9A67, 0X9226,
-  0X9245, 0X8A66, 0X8A45, 0X8205, 0X81C4, 0X81C4, 0X7983, 0X7963,
-  0X7142, 0X7942, 0X7942, 0X7983, 0X81C4, 0X81C4, 0X81E4, 0X89E4,
-  0X89E4, 0X9225, 0X9245, 0X9266, 0X9AA7, 0X9B08, 0XA349, 0XA38A,
-  0XAB8A, 0XA349, 0XAB4A, 0XB38B, 0XABAB, 0XB3EC, 0XB40C, 0XBC6D,
-  0XBC6E, 0XBCAF, 0XBCD0, 0XBCAF, 0XC511, 0XC593, 0XCD93, 0XCDB3,
-  0XCDF4, 0XD636, 0XDE98, 0XDEB9, 0XD6B8, 0XDED9, 0XDF1A, 0XDF3B,
-  0XDF5C, 0XE77C, 0XE79D, 0XEFBD, 0XEFBE, 0XEFBE, 0XEFBE, 0XEFBE,
-  0XEF9D, 0XEF9D, 0XEF7D, 0XEF5D, 0XE75D, 0XDF1B, 0XD6BA, 0XC679,
-  0XBE38, 0XADB7, 0X94F4, 0X5B6D, 0X31E6, 0X10A2, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0861, 0X3A06, 0X530A, 0X7C72, 0XA596, 0XBDF7,
-  0XC658, 0XD6BA, 0XDEFB, 0XDEDA, 0XDEDA, 0XDF1B, 0XDF1B, 0XE71B,
-  0XE6BA, 0XE699, 0XE71B, 0XE699, 0XE6B9, 0XE6DA, 0XDEB9, 0XDE99,
-  0XDE57, 0XDE57, 0XDE56, 0XD697, 0XDEB9, 0XDED9, 0XDED9, 0XD6B8,
-  0XD697, 0XD615, 0XCD93, 0XCD73, 0XC531, 0XC551, 0XC4EF, 0XC4AE,
-  0XBC4D, 0XBC4D, 0XBC8F, 0XBCAE, 0XB46D, 0XB44D, 0XB42C, 0XAC0C,
-  0XABCB, 0XA3AA, 0XA38A, 0XA308, 0X9A66, 0X9A26, 0X9A46, 0X9226,
-  0X9246, 0X8A66, 0X8A25, 0X81C4, 0X81A3, 0X81A4, 0X79A3, 0X7983,
-  0X7142, 0X7963, 0X7942, 0X7963, 0X81C4, 0X81C4, 0X89E4, 0X89E4,
-  0X89C4, 0X89E4, 0X89E4, 0X9245, 0X9AC7, 0XA329, 0XA349, 0XABAA,
-  0XABCB, 0XAB8B, 0XAB6A, 0XAB8A, 0XAB8B, 0XB3EC, 0XB44D, 0XBCAF,
-  0XBC6E, 0XBC4D, 0XBCAF, 0XBCAF, 0XC531, 0XCD72, 0XC551, 0XCD93,
-  0XCE15, 0XD636, 0XD698, 0XDED9, 0XDF1A, 0XDF1A, 0XDF1A, 0XDF3B,
-  0XDF5C, 0XE79D, 0XEFBD, 0XEFBE, 0XEFBE, 0XEFDE, 0XEFDE, 0XEFBE,
-  0XEFBE, 0XE77D, 0XE75C, 0XE73C, 0XE75C, 0XDEFB, 0XD679, 0XCE79,
-  0XB5F7, 0X9D15, 0X8492, 0X5B0B, 0X2985, 0X0861, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0040, 0X2984, 0X4A88, 0X6BCF, 0X9D55, 0XBE17,
-  0XC678, 0XD6BA, 0XD6DA, 0XDEDA, 0XDEB9, 0XDEF9, 0XDEFA, 0XE71B,
-  0XE6FA, 0XE658, 0XE699, 0XDEB9, 0XDE98, 0XE6FA, 0XE6DA, 0XE6FA,
-  0XE6FA, 0XDE98, 0XD615, 0XD615, 0XD636, 0XD677, 0XDEB8, 0XDEB8,
-  0XD677, 0XD635, 0XCD72, 0XC532, 0XC4F0, 0XC44D, 0XBC0C, 0XBC4D,
-  0XBC8E, 0XBCAF, 0XBCAF, 0XBCAF, 0XB48E, 0XB44D, 0XB42D, 0XAC0C,
-  0XABCB, 0XABCB, 0XA36A, 0XA2A7, 0X9A66, 0X9A46, 0X9A46, 0X9246,
-  0X9266, 0X8A46, 0X8A05, 0X81E4, 0X81E4, 0X81C4, 0X79A4, 0X7983,
-  0X7142, 0X7942, 0X7962, 0X7963, 0X81A4, 0X81C4, 0X89E4, 0X8A05,
-  0X89E4, 0X81C3, 0X89E4, 0X9265, 0X9B08, 0XA329, 0XA349, 0XAB8A,
-  0XABCB, 0XABCB, 0XABAB, 0XA38A, 0XB3EB, 0XB3EC, 0XB44D, 0XBC8E,
-  0XBC8E, 0XBC8F, 0XBCCF, 0XBCAF, 0XC511, 0XC572, 0XCDB3, 0XCDF5,
-  0XD636, 0XD656, 0XD656, 0XDE98, 0XDEFA, 0XE73B, 0XE75C, 0XE75C,
-  0XDF7C, 0XDF9C, 0XE7BD, 0XEFBE, 0XEFDE, 0XEFDE, 0XEFDE, 0XEFBE,
-  0XEFBE, 0XEFBF, 0XE79D, 0XE75C, 0XDF3C, 0XDEDA, 0XCE58, 0XC638,
-  0XBE38, 0XA576, 0X7C50, 0X4AC9, 0X29A5, 0X0861, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X1903, 0X3A27, 0X638D, 0X9D55, 0XB5F7,
-  0XC658, 0XD6BA, 0XD6D9, 0XD6FA, 0XDF1A, 0XDEFA, 0XDED9, 0XDF1B,
-  0XE71B, 0XE678, 0XDE57, 0XE6D9, 0XE698, 0XE6B9, 0XE6DA, 0XE6FA,
-  0XE6FA, 0XE6FA, 0XDEB8, 0XD678, 0XD636, 0XD636, 0XD635, 0XD615,
-  0XD655, 0XCE14, 0XCD52, 0XCD72, 0XC531, 0XCCF0, 0XC44E, 0XBC6E,
-  0XBCF0, 0XBCF0, 0XBCCF, 0XBCAE, 0XBC8E, 0XB46D, 0XB42D, 0XABEC,
-  0XABEB, 0XABAB, 0XA2E8, 0XA2A7, 0X9AA7, 0X9A66, 0X9A66, 0X9246,
-  0X9225, 0X8A25, 0X8A25, 0X8A05, 0X81E5, 0X81C4, 0X79A4, 0X7983,
-  0X7142, 0X7943, 0X7963, 0X7963, 0X7983, 0X81C4, 0X89E4, 0X8A25,
-  0X9225, 0X89E4, 0X9225, 0X9A66, 0X9B08, 0XA349, 0XA349, 0XA38A,
-  0XABCB, 0XABEC, 0XB40C, 0XABCB, 0XB3EC, 0XB40C, 0XB40C, 0XB42D,
-  0XBC8E, 0XBCCF, 0XBCD0, 0XBD11, 0XC551, 0XC5B3, 0XCDF4, 0XCDF5,
-  0XD636, 0XD677, 0XDE97, 0XDE98, 0XDED9, 0XDF1A, 0XE75B, 0XE77C,
-  0XE77D, 0XDF9D, 0XE7BD, 0XEFBE, 0XEFBE, 0XEFDF, 0XEFDF, 0XEFBE,
-  0XE79D, 0XEFBE, 0XEF9E, 0XE77C, 0XE75C, 0XDF1B, 0XCE79, 0XC638,
-  0XB618, 0X9D95, 0X6BEF, 0X4288, 0X2985, 0X0861, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X10C2, 0X3207, 0X6BCE, 0X9D55, 0XB5D7,
-  0XBE59, 0XCEBA, 0XD6DA, 0XDF1B, 0XDEFA, 0XD6D9, 0XDEFA, 0XDF3B,
-  0XE73B, 0XE6D9, 0XE6B9, 0XE6FA, 0XE6B9, 0XE678, 0XE6FB, 0XE71A,
-  0XE6D9, 0XDEB9, 0XD6B8, 0XD6B8, 0XDED9, 0XDEB8, 0XD615, 0XD5F4,
-  0XD5B3, 0XCD52, 0XCD93, 0XCD72, 0XC551, 0XCD93, 0XC4D0, 0XBCCF,
-  0XBD10, 0XBCEF, 0XBCCF, 0XBC8E, 0XBC8E, 0XB44D, 0XB42D, 0XAC0C,
-  0XABCB, 0XAB29, 0XA2C8, 0XA309, 0X9AA7, 0X9A66, 0X9A66, 0X9225,
-  0X9245, 0X8A46, 0X8A46, 0X8205, 0X81E5, 0X81C4, 0X79A4, 0X7983,
-  0X7142, 0X7943, 0X7963, 0X7983, 0X7962, 0X81A3, 0X89E4, 0X8A25,
-  0X9266, 0X8A05, 0X9246, 0X9AA7, 0X9AE7, 0XA349, 0XA349, 0XAB8A,
-  0XABCA, 0XABEB, 0XB42C, 0XB42C, 0XB40C, 0XB3EC, 0XB3AB, 0XB44D,
-  0XBC6E, 0XBC8E, 0XBCD0, 0XBD31, 0XC572, 0XC5B3, 0XCDF4, 0XCE35,
-  0XD656, 0XDEB8, 0XE6FA, 0XE71A, 0XDF1A, 0XDF1A, 0XDF3B, 0XE75C,
-  0XE77D, 0XE7BD, 0XE7BE, 0XE7DE, 0XEFDE, 0XEFDF, 0XEFDF, 0XEFBE,
-  0XEF9D, 0XE79D, 0XE79D, 0XE77C, 0XDF3B, 0XD71B, 0XCEB9, 0XC638,
-  0XB5F7, 0X9575, 0X63AF, 0X4207, 0X2123, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X10A2, 0X3227, 0X63AF, 0X8CF3, 0XAE17,
-  0XC699, 0XCEB9, 0XD6DA, 0XD73B, 0XDF1B, 0XDEFA, 0XDF3B, 0XDF5B,
-  0XE77C, 0XE73B, 0XEF1B, 0XEF1B, 0XE6D9, 0XE698, 0XE6B9, 0XE6F9,
-  0XE6B9, 0XDE78, 0XDE98, 0XDED9, 0XDED9, 0XDEB8, 0XDE98, 0XDE77,
-  0XD5F5, 0XCD31, 0XCD52, 0XCD51, 0XCD51, 0XC551, 0XBCF0, 0XBCF0,
-  0XC4F0, 0XBCEF, 0XBCCF, 0XBC8E, 0XB46E, 0XB44D, 0XB42C, 0XABEC,
-  0XAB8A, 0XAB29, 0XA34A, 0XA329, 0X9AE8, 0X9AA7, 0X9A66, 0X9266,
-  0X9286, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X79A4, 0X7983,
-  0X7142, 0X7943, 0X7963, 0X81A3, 0X8183, 0X8183, 0X89E4, 0X8A25,
-  0X9266, 0X8A25, 0X9225, 0X9AC7, 0XA308, 0XA328, 0XA328, 0XA36A,
-  0XABCA, 0XABEB, 0XB42C, 0XB42C, 0XB3EC, 0XAB8B, 0XB3CB, 0XBC2C,
-  0XBC0C, 0XBC4E, 0XBCF0, 0XC532, 0XC573, 0XC5B3, 0XCDD4, 0XCDF4,
-  0XCE15, 0XDEB8, 0XE71A, 0XE73B, 0XE77C, 0XE77C, 0XE77C, 0XE79D,
-  0XE79D, 0XE7BD, 0XE7BE, 0XE7BE, 0XE7DE, 0XEFDF, 0XEFDF, 0XEFDE,
-  0XEFBE, 0XE79D, 0XE77D, 0XE77D, 0XDF5C, 0XD71B, 0XCEB9, 0XC658,
-  0XADF7, 0X9575, 0X6BAE, 0X29A6, 0X10E3, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0881, 0X29C6, 0X6BCE, 0X8D34, 0XADF7,
-  0XC658, 0XCE99, 0XD6FA, 0XDF3B, 0XDF5C, 0XDF3C, 0XDF5C, 0XE77C,
-  0XE79D, 0XE77C, 0XEF3B, 0XEF5C, 0XEF3B, 0XE698, 0XDE16, 0XE677,
-  0XE698, 0XDE98, 0XDE77, 0XDE77, 0XDEB8, 0XDEB8, 0XDEB8, 0XD697,
-  0XD656, 0XCD72, 0XCD11, 0XCD73, 0XCD72, 0XC531, 0XBCF0, 0XC531,
-  0XC511, 0XBCF0, 0XBCCF, 0XBCAE, 0XB46D, 0XB44D, 0XB42D, 0XABCB,
-  0XAB6A, 0XAB8A, 0XA38A, 0XA329, 0X9AE8, 0X9AE8, 0X9A87, 0X9286,
-  0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81C4, 0X79A4, 0X7963,
-  0X7142, 0X7943, 0X7963, 0X81A4, 0X81A3, 0X81A3, 0X89E4, 0X8A25,
-  0X9266, 0X9265, 0X8A05, 0X9AA7, 0XA329, 0XA328, 0X9B07, 0XA328,
-  0XABAA, 0XABCB, 0XAC2C, 0XB42C, 0XB3EB, 0XB3CC, 0XB3CB, 0XB3EB,
-  0XBC2D, 0XBC4D, 0XBCF0, 0XBD52, 0XC572, 0XC593, 0XCDF5, 0XCE15,
-  0XCE36, 0XDE77, 0XDEF9, 0XE75B, 0XEF7C, 0XEF7C, 0XEF9D, 0XE7BD,
-  0XE7BD, 0XEFBE, 0XE7DE, 0XE79E, 0XE7BE, 0XEFFE, 0XE7FE, 0XE7BD,
-  0XE79D, 0XE79D, 0XE77C, 0XDF7C, 0XDF5C, 0XD71B, 0XCEBA, 0XC678,
-  0XAE17, 0X8CD3, 0X636D, 0X3206, 0X1903, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X1081, 0X39C7, 0X7410, 0X9D96, 0XB5D6,
-  0XBE17, 0XC699, 0XD6DA, 0XD6FA, 0XDF3B, 0XDF3B, 0XDF3C, 0XE77D,
-  0XEF9E, 0XE73B, 0XE6F9, 0XF79D, 0XEF7C, 0XE6B8, 0XDDF6, 0XDE16,
-  0XDE56, 0XDE97, 0XDE77, 0XDE37, 0XDE98, 0XDED9, 0XDEB8, 0XD677,
-  0XD636, 0XCD52, 0XC511, 0XCDD4, 0XCDB4, 0XC531, 0XC511, 0XC552,
-  0XC531, 0XBD10, 0XBCCF, 0XBC8E, 0XB44D, 0XB44D, 0XB40C, 0XAB8A,
-  0XABAB, 0XABCB, 0XA38A, 0XA329, 0X9AE8, 0X9AE8, 0X9AC7, 0X9287,
-  0X9286, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81C4, 0X79A3, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X81A4, 0X81C4, 0X81A3, 0X89E5, 0X8A25,
-  0X9266, 0X9266, 0X9225, 0X9A86, 0XA329, 0XA329, 0XA308, 0XA328,
-  0XA36A, 0XABEB, 0XAC0C, 0XAC0C, 0XB42C, 0XB42C, 0XB42C, 0XB42D,
-  0XBC6D, 0XBC6D, 0XBCAE, 0XBD30, 0XC531, 0XC553, 0XCDF5, 0XD677,
-  0XD6B8, 0XDED9, 0XE71A, 0XEF5B, 0XEF7C, 0XEF7C, 0XEF9D, 0XEFBD,
-  0XE7BD, 0XEFBE, 0XE7DE, 0XE7DE, 0XE7DE, 0XE7DE, 0XEFBE, 0XEFBD,
-  0XE79D, 0XE77C, 0XE73B, 0XE75C, 0XDF3C, 0XD6FB, 0XCEBA, 0XBE79,
-  0XB5D7, 0X9514, 0X636E, 0X3A07, 0X1923, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X18C2, 0X4248, 0X6BEF, 0X9D75, 0XB5F7,
-  0XC617, 0XCE99, 0XD6FB, 0XDEFA, 0XDF1B, 0XE75C, 0XE75C, 0XDF3B,
-  0XE77D, 0XE73C, 0XE697, 0XEF3A, 0XEF7C, 0XE6DA, 0XE698, 0XE677,
-  0XDE15, 0XDE16, 0XDE57, 0XDE77, 0XDE98, 0XDEB8, 0XDEB8, 0XD656,
-  0XD615, 0XCDD4, 0XC531, 0XCD72, 0XCD93, 0XC511, 0XC531, 0XC572,
-  0XC531, 0XBD10, 0XBCF0, 0XBC8E, 0XB44D, 0XB42C, 0XABCB, 0XABAB,
-  0XABEB, 0XABCB, 0XA38A, 0XA329, 0X9B08, 0X9AE8, 0X9AC8, 0X92A7,
-  0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81C4, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X81A4, 0X81C4, 0X81C3, 0X89E4, 0X8A25,
-  0X9245, 0X9286, 0X9245, 0X9266, 0XA308, 0XA349, 0X9B08, 0XA329,
-  0XA369, 0XAC0B, 0XAC2C, 0XB42D, 0XB42C, 0XB44C, 0XB48D, 0XBCAE,
-  0XBCAE, 0XBC6C, 0XBC4C, 0XBC6E, 0XC4F1, 0XC5B3, 0XCE16, 0XD697,
-  0XD6B8, 0XDEF9, 0XDF3A, 0XE75B, 0XEF7C, 0XEF9C, 0XEF9D, 0XEFBD,
-  0XEFBD, 0XEFBD, 0XEFDE, 0XEFFE, 0XEFFF, 0XE7DE, 0XE79D, 0XEFBD,
-  0XE75C, 0XE73B, 0XE75C, 0XE75C, 0XDF3B, 0XD6FB, 0XD6BA, 0XBE38,
-  0XB5D7, 0X9554, 0X5B6C, 0X3207, 0X2144, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X10E2, 0X4288, 0X7C50, 0XA595, 0XB5F7,
-  0XBDD6, 0XCE37, 0XD6B9, 0XDEFA, 0XDF1B, 0XDF5C, 0XE75C, 0XE75C,
-  0XE77C, 0XE75D, 0XE6B9, 0XDE98, 0XEF5C, 0XE6FA, 0XE698, 0XDE56,
-  0XDE35, 0XDE16, 0XDE77, 0XDE98, 0XDE98, 0XDE77, 0XDE97, 0XD656,
-  0XD636, 0XD636, 0XCD73, 0XC511, 0XC572, 0XBD11, 0XC511, 0XC572,
-  0XBD30, 0XBD10, 0XBCCF, 0XBC8E, 0XB44D, 0XABCB, 0XABEB, 0XAC0C,
-  0XABEB, 0XABAB, 0XA36A, 0XA308, 0XA2E8, 0X9AE8, 0X9AE8, 0X92A7,
-  0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X81C4, 0X7963, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X81A3, 0X81C4, 0X81C4, 0X89E4, 0X8A25,
-  0X9245, 0X9266, 0X9265, 0X9245, 0X9AC7, 0XA349, 0X9AE7, 0XA349,
-  0XAB8A, 0XABAA, 0XB42C, 0XB44D, 0XB44D, 0XB44C, 0XBC8D, 0XBCCE,
-  0XBCEF, 0XBCCF, 0XBC2C, 0XBC6E, 0XC531, 0XCDF4, 0XCE36, 0XD697,
-  0XD698, 0XD6D8, 0XDF3A, 0XDF7B, 0XE77C, 0XE79D, 0XEF9D, 0XEFBD,
-  0XE7BD, 0XEFBD, 0XEFBE, 0XE7DF, 0XEFDF, 0XEFDE, 0XE7BD, 0XEFBD,
-  0XE77C, 0XE75C, 0XEF5B, 0XE73B, 0XE73B, 0XDF1B, 0XD6DA, 0XC678,
-  0XB5F7, 0X9514, 0X636D, 0X4267, 0X29A5, 0X0861, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X18E3, 0X52EA, 0X7C51, 0X9CF4, 0XB5D6,
-  0XC617, 0XCE37, 0XD699, 0XD6BA, 0XD6B8, 0XDEFA, 0XDF3C, 0XE77C,
-  0XE73B, 0XEF5C, 0XE71B, 0XE6D9, 0XEF3B, 0XE6FA, 0XDE78, 0XDE37,
-  0XDE57, 0XDE57, 0XDE77, 0XDE98, 0XDE98, 0XD677, 0XD677, 0XD677,
-  0XD656, 0XD635, 0XCD94, 0XC531, 0XCD52, 0XC531, 0XBCF0, 0XC551,
-  0XBD10, 0XBCF0, 0XBCAF, 0XBC6D, 0XB3EC, 0XB3CB, 0XB40C, 0XAC0C,
-  0XABEB, 0XABAB, 0XA369, 0XA2E8, 0XA2E8, 0X9B08, 0X9AC8, 0X92A7,
-  0X9287, 0X8A66, 0X8A46, 0X8225, 0X81E5, 0X8183, 0X7963, 0X7983,
-  0X7142, 0X7963, 0X7963, 0X8183, 0X81C4, 0X81E4, 0X89E4, 0X8A05,
-  0X9225, 0X9266, 0X9286, 0X9266, 0X9A87, 0XA308, 0X9AE7, 0XA349,
-  0XABAB, 0XAB8A, 0XB3EC, 0XB44C, 0XB42C, 0XB40B, 0XBC6D, 0XBCEE,
-  0XBCEF, 0XBCEF, 0XBCAE, 0XC4EF, 0XC572, 0XCDD3, 0XCE35, 0XD677,
-  0XD698, 0XD6B7, 0XDEB7, 0XDF3A, 0XE77C, 0XE79D, 0XE79D, 0XEFBD,
-  0XE7BD, 0XEF9D, 0XEFBE, 0XE7BE, 0XE7BD, 0XE79D, 0XE77C, 0XE75C,
-  0XE75C, 0XEF7D, 0XEF7C, 0XE73C, 0XE75C, 0XE73B, 0XD6DA, 0XC678,
-  0XB5F7, 0X9D55, 0X6BEF, 0X4AC9, 0X4246, 0X10A1, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0020, 0X1903, 0X5B2C, 0X8C93, 0XA555, 0XB5F6,
-  0XC658, 0XCE79, 0XD699, 0XDEBA, 0XDE78, 0XE6B8, 0XDEFA, 0XE71B,
-  0XE6B9, 0XE6FA, 0XEF5C, 0XE6FA, 0XE6F9, 0XDEFA, 0XDEB9, 0XDE97,
-  0XDE57, 0XDE16, 0XDE57, 0XDEB8, 0XDEB9, 0XD677, 0XD636, 0XD657,
-  0XD636, 0XCE15, 0XCDD4, 0XC511, 0XC511, 0XC552, 0XBCF0, 0XC511,
-  0XBCF0, 0XBCAF, 0XBC6E, 0XB40C, 0XB40C, 0XB42D, 0XAC0C, 0XAC0C,
-  0XABEB, 0XA3AB, 0XA349, 0XA2C7, 0X9B08, 0X9B08, 0X9AA7, 0X92A7,
-  0X9287, 0X8A66, 0X8A46, 0X8A25, 0X81A4, 0X8183, 0X79A4, 0X7983,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81C4, 0X81E4, 0X89C4, 0X8A04,
-  0X9245, 0X9286, 0X92A6, 0X9A86, 0X9AA7, 0XA2C7, 0X9AC7, 0XA328,
-  0XABAA, 0XAB8A, 0XABCB, 0XB44C, 0XB40C, 0XB40C, 0XBC6D, 0XBCAE,
-  0XBCEF, 0XBCEF, 0XBD30, 0XBD10, 0XC510, 0XC572, 0XCDD4, 0XD636,
-  0XD656, 0XD656, 0XD6B7, 0XDEF9, 0XE77C, 0XE79C, 0XE79D, 0XEFBD,
-  0XEFBD, 0XEFBD, 0XEFBD, 0XE79D, 0XE79D, 0XE77C, 0XE75C, 0XE75C,
-  0XE73C, 0XEF5D, 0XEF9E, 0XEF7D, 0XE75C, 0XE73C, 0XDEDA, 0XC657,
-  0XB5D6, 0XA576, 0X8451, 0X5B2A, 0X4287, 0X18E2, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0020, 0X2144, 0X5B8E, 0X8CD3, 0XA575, 0XBE38,
-  0XCE99, 0XCEFA, 0XD699, 0XDE38, 0XDE59, 0XE6FA, 0XE75B, 0XDED9,
-  0XDE77, 0XE6D9, 0XEF3B, 0XE6FA, 0XDEB8, 0XDED9, 0XE6D9, 0XDE97,
-  0XDE77, 0XDE57, 0XDE57, 0XDE98, 0XDEB8, 0XDE97, 0XD636, 0XCE16,
-  0XD616, 0XCDF4, 0XCDB3, 0XC4F0, 0XBCD0, 0XCD72, 0XBCF0, 0XBCCF,
-  0XBCD0, 0XB48E, 0XB44D, 0XB40C, 0XB44E, 0XB44D, 0XAC2C, 0XAC0C,
-  0XABCB, 0XA3AB, 0XA329, 0XA2E8, 0X9B29, 0X9B08, 0X92C7, 0X92A7,
-  0X9287, 0X8A66, 0X8A46, 0X81E5, 0X81A3, 0X81C4, 0X79A4, 0X7983,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81C4, 0X81E4, 0X81E4, 0X8A04,
-  0X8A45, 0X9286, 0X9AA6, 0X9266, 0X9A87, 0XA2C6, 0X9AA7, 0XA328,
-  0XAB89, 0XABAA, 0XABEB, 0XAC0C, 0XB46D, 0XB4AE, 0XBCAE, 0XBCAE,
-  0XBCEF, 0XBD30, 0XC530, 0XBD30, 0XC551, 0XC551, 0XCD72, 0XCDB3,
-  0XD5F4, 0XD615, 0XDED9, 0XDF1A, 0XDF1A, 0XDF5B, 0XE77C, 0XE77C,
-  0XE77C, 0XE77C, 0XEF9D, 0XEF9D, 0XE79D, 0XEF9E, 0XEFBE, 0XEF9D,
-  0XEF7C, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF5C, 0XE73B, 0XDED9, 0XCE57,
-  0XB5B5, 0XAD75, 0X8C93, 0X5B0B, 0X4247, 0X1903, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X2985, 0X6BEF, 0X8534, 0XA5B6, 0XBE18,
-  0XCEBA, 0XD71B, 0XDE79, 0XD5B5, 0XE657, 0XE698, 0XDED9, 0XE6DA,
-  0XE6B9, 0XE6DA, 0XEF3C, 0XE6FB, 0XDED9, 0XDED9, 0XDED9, 0XDE98,
-  0XDE98, 0XE6B9, 0XDE78, 0XDE77, 0XDE98, 0XDE77, 0XD636, 0XCDF5,
-  0XCDF5, 0XC573, 0XC551, 0XC511, 0XC4D0, 0XC532, 0XBD11, 0XBC8E,
-  0XBCAF, 0XB46E, 0XB42D, 0XB46E, 0XB46E, 0XB44D, 0XAC0C, 0XABEC,
-  0XABCB, 0XA3AA, 0XA308, 0XA308, 0X9B29, 0X9B08, 0X92C7, 0X92A7,
-  0X9287, 0X8A66, 0X8A25, 0X81C4, 0X81A3, 0X81A4, 0X79A3, 0X7983,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81C4, 0X81E4, 0X8204, 0X8A04,
-  0X8A25, 0X9266, 0X9AA6, 0X9286, 0X9A66, 0X9245, 0X9A86, 0XA369,
-  0XABA9, 0XABEB, 0XAC0B, 0XAC0B, 0XB48E, 0XB4CF, 0XBCCF, 0XBD10,
-  0XBD10, 0XC530, 0XC530, 0XBD2F, 0XC592, 0XCDD3, 0XCDD4, 0XCDF4,
-  0XD615, 0XCE35, 0XD677, 0XDED9, 0XDED9, 0XDF1A, 0XE75B, 0XE77C,
-  0XE75C, 0XDF3B, 0XE73B, 0XEF7C, 0XEF9C, 0XEF7C, 0XEF5C, 0XEF5C,
-  0XEF5C, 0XF79D, 0XEF9D, 0XEF7D, 0XEF5C, 0XE71A, 0XDED9, 0XCE17,
-  0XB574, 0XAD95, 0X94B2, 0X630B, 0X4A67, 0X2143, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0841, 0X4248, 0X7BCF, 0X84F3, 0XA617, 0XBE79,
-  0XCEB9, 0XDEDA, 0XDEBA, 0XDE98, 0XE6D9, 0XDEB9, 0XDEB9, 0XE71C,
-  0XEEFB, 0XEEFA, 0XEF3C, 0XEF1B, 0XE6DA, 0XDED9, 0XDEB9, 0XDEB8,
-  0XDEB9, 0XE6B9, 0XDE77, 0XDE57, 0XDE77, 0XD656, 0XD616, 0XCDD5,
-  0XCDB4, 0XCD93, 0XC573, 0XCD73, 0XC4F1, 0XC4F0, 0XBD10, 0XBC6E,
-  0XBCAF, 0XB40D, 0XB42D, 0XBC8E, 0XB44E, 0XB42D, 0XAC0C, 0XABEC,
-  0XABCB, 0XA38A, 0XA308, 0XA329, 0X9B29, 0X9AE8, 0X92C7, 0X92A7,
-  0X9287, 0X8A66, 0X8A05, 0X81A3, 0X81A3, 0X81A4, 0X7983, 0X7983,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81A3, 0X81E4, 0X8A05, 0X8A04,
-  0X8A25, 0X9265, 0X9286, 0X9AA6, 0X9A45, 0X91E4, 0X9A45, 0XAB49,
-  0XABAA, 0XABEA, 0XABEB, 0XAC0C, 0XB46D, 0XBCCF, 0XBCEF, 0XBD51,
-  0XBD51, 0XC551, 0XC550, 0XBD0F, 0XC510, 0XCD92, 0XCDF4, 0XCE56,
-  0XD677, 0XD676, 0XD697, 0XDEB8, 0XDE98, 0XDEB9, 0XE73B, 0XE73B,
-  0XE71B, 0XE77C, 0XE77B, 0XE73B, 0XE71A, 0XE75B, 0XEF7C, 0XEF7D,
-  0XEF5C, 0XEF5C, 0XF77D, 0XEF7D, 0XEF3C, 0XE71B, 0XDED9, 0XD657,
-  0XBDB5, 0XAD34, 0X9451, 0X632C, 0X4268, 0X2964, 0X0020, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X18E3, 0X630C, 0X8451, 0X9514, 0XB618, 0XCE9A,
-  0XD6B9, 0XD6B9, 0XDEB9, 0XDEFA, 0XE6FA, 0XDEB9, 0XE6DA, 0XEF1B,
-  0XEF1B, 0XEEFB, 0XEF1B, 0XEF3C, 0XE6FA, 0XE6B9, 0XDE78, 0XDE78,
-  0XE698, 0XDE77, 0XDE16, 0XD616, 0XD636, 0XD636, 0XCE36, 0XCDD4,
-  0XC572, 0XCD93, 0XCD73, 0XC593, 0XBD31, 0XBC6E, 0XBC2D, 0XBC8F,
-  0XB46E, 0XB3EC, 0XB44D, 0XB46E, 0XB44D, 0XAC2C, 0XAC0C, 0XABEC,
-  0XABCB, 0XA36A, 0XA308, 0XA349, 0X9B29, 0X9AE8, 0X92C7, 0X92A7,
-  0X9287, 0X8A25, 0X89E4, 0X81E4, 0X81C4, 0X81A4, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81A3, 0X81E4, 0X8A05, 0X8A04,
-  0X8A24, 0X9265, 0X9286, 0X9AC7, 0X9A66, 0X89E4, 0X9204, 0XA2C7,
-  0XAB8A, 0XB3EA, 0XABCA, 0XB42C, 0XB46D, 0XB4AE, 0XBCEF, 0XBD51,
-  0XBD72, 0XC571, 0XC592, 0XC550, 0XBCEE, 0XC50F, 0XC592, 0XCE15,
-  0XD676, 0XD696, 0XDEB8, 0XDED9, 0XDED9, 0XDED8, 0XDED9, 0XE6FA,
-  0XDED9, 0XE6FA, 0XEF7C, 0XE77C, 0XE75B, 0XE73B, 0XEF1B, 0XEF5B,
-  0XEF7C, 0XEF5C, 0XEF5C, 0XEF5B, 0XEF1B, 0XEEDA, 0XE6B9, 0XD698,
-  0XC5F6, 0XB534, 0X9D14, 0X73CE, 0X4268, 0X2985, 0X0841, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X2144, 0X6B6D, 0X8492, 0X9D13, 0XBE17, 0XC657,
-  0XCE37, 0XD678, 0XD637, 0XDEBA, 0XE6FA, 0XDE58, 0XE678, 0XEEFB,
-  0XEEFB, 0XEF1C, 0XEF3C, 0XEF3B, 0XEEFA, 0XE699, 0XDE78, 0XDE57,
-  0XDE77, 0XDE56, 0XDE16, 0XD5F5, 0XD616, 0XCE16, 0XCE16, 0XCDD5,
-  0XC552, 0XCD53, 0XC573, 0XC592, 0XC552, 0XBC4E, 0XBBCC, 0XBC4E,
-  0XB3EC, 0XB44D, 0XB46E, 0XB44D, 0XB44D, 0XAC0C, 0XABEC, 0XABCB,
-  0XABAB, 0XA349, 0XA308, 0XA349, 0X9B29, 0X9AE8, 0X92C7, 0X92A7,
-  0X9246, 0X89E5, 0X89E5, 0X8205, 0X81E4, 0X81A4, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81A3, 0X81E4, 0X8A04, 0X8A05,
-  0X8A04, 0X9245, 0X9266, 0X9A86, 0X9245, 0X9245, 0X9265, 0XA2E7,
-  0XAB68, 0XB3CA, 0XABAA, 0XAC0C, 0XB46D, 0XB48D, 0XBCCF, 0XBD30,
-  0XBD71, 0XC571, 0XC5B3, 0XC5B2, 0XBD50, 0XC530, 0XC550, 0XC551,
-  0XCDB2, 0XD635, 0XDE76, 0XDEB8, 0XDEF9, 0XDF19, 0XDED8, 0XDEF9,
-  0XE73A, 0XE71A, 0XE73B, 0XEF5B, 0XEF7B, 0XEF3B, 0XEF3B, 0XEF3B,
-  0XEF3A, 0XEF5B, 0XEF3B, 0XEF1B, 0XEF1B, 0XE6DA, 0XE6BA, 0XDE99,
-  0XC5D6, 0XB555, 0XB596, 0X94B2, 0X5AEB, 0X39C6, 0X10A2, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0020, 0X29A5, 0X636D, 0X8430, 0XA4F1, 0XBDD4, 0XCE16,
-  0XD637, 0XDE99, 0XDE79, 0XDE58, 0XE6D9, 0XDE99, 0XE699, 0XEEFB,
-  0XEF1B, 0XEF1C, 0XF75C, 0XEF5C, 0XE6FA, 0XE698, 0XE678, 0XDE36,
-  0XDE57, 0XD616, 0XD5D4, 0XD5D5, 0XD5F5, 0XCDD5, 0XCDF5, 0XCDB4,
-  0XC552, 0XCD72, 0XCD52, 0XCD32, 0XCD52, 0XBC8F, 0XB3CC, 0XB3CB,
-  0XBC2D, 0XB48E, 0XB46E, 0XB44E, 0XB44D, 0XAC0C, 0XABEC, 0XABCB,
-  0XA38A, 0XA2E8, 0XA328, 0XA349, 0X9B29, 0X9AC8, 0X92C7, 0X9286,
-  0X8A05, 0X8A05, 0X8A25, 0X8205, 0X81E4, 0X7983, 0X7963, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81A4, 0X81C4, 0X89E4, 0X8A05,
-  0X8A05, 0X9204, 0X9245, 0X9225, 0X9245, 0X9A86, 0X9AA7, 0XA328,
-  0XA349, 0XAB69, 0XABA9, 0XB40B, 0XB48D, 0XB48D, 0XB4AE, 0XBD10,
-  0XBD51, 0XBD51, 0XC5B3, 0XCDD3, 0XC5B3, 0XC592, 0XC571, 0XC551,
-  0XC530, 0XCD51, 0XCDD4, 0XDE97, 0XDF19, 0XE73A, 0XE73A, 0XE73A,
-  0XE75B, 0XEF5B, 0XEF3B, 0XEF5C, 0XEF7C, 0XEF7C, 0XEF5B, 0XEF1A,
-  0XEF1A, 0XEF1B, 0XEF3C, 0XEF7D, 0XEF3C, 0XEF3C, 0XEF1B, 0XE6DA,
-  0XD638, 0XBDD6, 0XBDD7, 0X9CF3, 0X6B6D, 0X4227, 0X18C2, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0840, 0X3A47, 0X73CF, 0X8C50, 0XA511, 0XBDB4, 0XC617,
-  0XCE16, 0XDEB9, 0XE6DA, 0XDE57, 0XDE98, 0XDEBA, 0XDE99, 0XE6DA,
-  0XE6FB, 0XEF1B, 0XEF1C, 0XEF3C, 0XEF1B, 0XE6DA, 0XE6B9, 0XDE16,
-  0XDE37, 0XDE16, 0XCD32, 0XCDB4, 0XCE16, 0XCD94, 0XC593, 0XC552,
-  0XC511, 0XC531, 0XC531, 0XC531, 0XC511, 0XBBEC, 0XB34A, 0XB3EC,
-  0XB48E, 0XB48E, 0XB46E, 0XB46E, 0XB44D, 0XAC0C, 0XABEC, 0XABEC,
-  0XA349, 0XA2E8, 0XA349, 0X9B49, 0X9B29, 0X9AC8, 0X9266, 0X9225,
-  0X9225, 0X8A25, 0X8A25, 0X8205, 0X81C4, 0X7983, 0X7983, 0X7963,
-  0X7142, 0X7963, 0X7963, 0X7983, 0X81A4, 0X81C4, 0X89E4, 0X8A04,
-  0X8A05, 0X9204, 0X9204, 0X9245, 0X9A66, 0X9A86, 0X9A86, 0XAB08,
-  0XAB8A, 0XA389, 0XAB48, 0XABEB, 0XB48E, 0XB4AE, 0XB48D, 0XBCEF,
-  0XBD52, 0XC572, 0XC592, 0XC5D3, 0XCDF4, 0XCDD4, 0XCDD4, 0XCDB3,
-  0XCDB3, 0XC592, 0XCD53, 0XD5F5, 0XDEF8, 0XDF1A, 0XE71A, 0XE75A,
-  0XE75A, 0XDF3A, 0XE73B, 0XE77C, 0XE79C, 0XEF9C, 0XEF5C, 0XEF9D,
-  0XEF7D, 0XF73C, 0XEF3C, 0XEF5C, 0XEF5C, 0XEF3B, 0XEF1B, 0XE6DA,
-  0XDE79, 0XC5F7, 0XBDD6, 0XAD56, 0X740F, 0X4A69, 0X18E3, 0X0020,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X10C2, 0X42A9, 0X73CE, 0X9C91, 0XAD53, 0XC5F6, 0XCE99,
-  0XCE57, 0XDE58, 0XE6DA, 0XDEB9, 0XDE57, 0XDE58, 0XD637, 0XDE99,
-  0XE6DA, 0XEEDA, 0XEEFB, 0XEF3B, 0XEF1B, 0XE6FA, 0XE6FA, 0XDE78,
-  0XDDB4, 0XD512, 0XCC91, 0XD533, 0XCDD4, 0XCDB4, 0XC552, 0XCD73,
-  0XC573, 0XC4D0, 0XCCD0, 0XCD52, 0XC4D0, 0XBB8B, 0XBB8B, 0XBC8F,
-  0XBCAF, 0XB46E, 0XB46E, 0XB46E, 0XB44D, 0XAC0C, 0XAC0C, 0XABCB,
-  0XA308, 0XA329, 0XA36A, 0X9B49, 0X9B08, 0X9AA7, 0X9225, 0X9205,
-  0X9225, 0X8A25, 0X8A05, 0X81E4, 0X81A3, 0X7983, 0X7983, 0X7963,
-  0X7122, 0X7963, 0X7963, 0X7983, 0X81A4, 0X81A4, 0X81C4, 0X89E4,
-  0X8A04, 0X8A04, 0X89E4, 0X9A45, 0X9A66, 0X9A86, 0X9A86, 0XA2E8,
-  0XAB8A, 0XA389, 0XA348, 0XAB89, 0XB46D, 0XB4AE, 0XB48D, 0XBCCE,
-  0XBD31, 0XC572, 0XC593, 0XC5F4, 0XCE14, 0XCDF3, 0XCE14, 0XD614,
-  0XD636, 0XD657, 0XD615, 0XD5B3, 0XD615, 0XDE98, 0XE6F9, 0XE6D8,
-  0XDED9, 0XE75B, 0XE79D, 0XE77C, 0XDF5A, 0XE77B, 0XEFBE, 0XF7DF,
-  0XEFBE, 0XEF5C, 0XEF1B, 0XEF1B, 0XF73C, 0XF75C, 0XEF3B, 0XEEFB,
-  0XDE78, 0XCDF6, 0XC5B6, 0XBDF7, 0X8CB3, 0X530B, 0X2164, 0X0861,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0020, 0X2184, 0X5B4D, 0X7C10, 0X9CD1, 0XB5B5, 0XC5F6, 0XD698,
-  0XDEB8, 0XD658, 0XDE99, 0XE6BA, 0XDE78, 0XD637, 0XD5D6, 0XD638,
-  0XE6BA, 0XE6DA, 0XEEFB, 0XEF1B, 0XEF1B, 0XE6FA, 0XE6B9, 0XDE98,
-  0XD5B4, 0XCD53, 0XCC90, 0XCBCE, 0XCC90, 0XCDB4, 0XC511, 0XC4AF,
-  0XCD52, 0XC46F, 0XC42E, 0XC42E, 0XC46E, 0XC44E, 0XBC2E, 0XBCCF,
-  0XBCAF, 0XB46E, 0XB46E, 0XB46D, 0XB42D, 0XAC0C, 0XAC0C, 0XA36A,
-  0XA2E8, 0XA36A, 0X9B6A, 0X9B29, 0X9AC8, 0X9246, 0X9205, 0X9225,
-  0X8A25, 0X8A05, 0X89E4, 0X81C4, 0X8183, 0X7983, 0X7983, 0X7963,
-  0X7122, 0X7942, 0X7963, 0X7963, 0X8183, 0X81A4, 0X81A3, 0X81C3,
-  0X89E4, 0X89C4, 0X89E4, 0X9225, 0X9A65, 0X9A86, 0XA2E7, 0X9AC7,
-  0XA349, 0XAB69, 0XAB48, 0XAB48, 0XB3EB, 0XB48D, 0XB48D, 0XBCAE,
-  0XBCEF, 0XC551, 0XC592, 0XC5D3, 0XCDD4, 0XCDD3, 0XCDF4, 0XD655,
-  0XDE97, 0XDE98, 0XD697, 0XD614, 0XD593, 0XD5D4, 0XD5D4, 0XD5F4,
-  0XCDB5, 0XE71B, 0XE79C, 0XE77C, 0XE79C, 0XEFBC, 0XEFDE, 0XF7DF,
-  0XEFBE, 0XEF9D, 0XF77C, 0XF73C, 0XF71B, 0XF75C, 0XF73C, 0XEEFB,
-  0XE6DA, 0XD658, 0XC595, 0XBD96, 0X9D14, 0X6BAE, 0X4227, 0X18C2,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0881, 0X3A48, 0X6BAE, 0X8C92, 0X9CF3, 0XBD54, 0XCE16, 0XD637,
-  0XD678, 0XDE78, 0XDE57, 0XDE58, 0XDEB9, 0XD679, 0XD5F7, 0XD5D7,
-  0XDE79, 0XE6DA, 0XEEBA, 0XEEDA, 0XEEFA, 0XEEFA, 0XE6B9, 0XDE37,
-  0XD5D5, 0XD5F5, 0XCD33, 0XCCB0, 0XCCF2, 0XCCF1, 0XCCD1, 0XC3ED,
-  0XC44E, 0XCD12, 0XCD32, 0XC4B0, 0XC4B0, 0XBC8F, 0XBC4E, 0XBCD0,
-  0XB48E, 0XAC0C, 0XB44D, 0XB46E, 0XB42D, 0XAC0C, 0XABCB, 0XA2E8,
-  0X9AA7, 0XA349, 0XA329, 0X9AA7, 0X9225, 0X9205, 0X9205, 0X9245,
-  0X8A25, 0X8A05, 0X89E4, 0X81C4, 0X8183, 0X7983, 0X7963, 0X7943,
-  0X7122, 0X7142, 0X7962, 0X7963, 0X7963, 0X8183, 0X8183, 0X81A3,
-  0X81C3, 0X89E4, 0X89E4, 0X9225, 0X9A86, 0X9AA7, 0XA308, 0XA308,
-  0XA308, 0XA328, 0XAB49, 0XAB89, 0XA388, 0XB42B, 0XB46C, 0XBCCE,
-  0XBCEF, 0XBD10, 0XC572, 0XCDB3, 0XCDF4, 0XCE14, 0XD615, 0XD656,
-  0XDE96, 0XDEB8, 0XDEF9, 0XDEB8, 0XD676, 0XDE36, 0XD616, 0XC573,
-  0XC511, 0XDEB8, 0XDF19, 0XD656, 0XEF5C, 0XF7FF, 0XEFFE, 0XEFDE,
-  0XEFBD, 0XEF7D, 0XEF7C, 0XF75C, 0XEF3B, 0XEF3C, 0XEF3B, 0XEEFB,
-  0XE6FA, 0XD637, 0XC595, 0XBDD6, 0XA554, 0X8C51, 0X6B2B, 0X2944,
-  0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X2103, 0X5AEB, 0X73CE, 0X94B2, 0XB555, 0XBD74, 0XCE99, 0XCE99,
-  0XD699, 0XDE99, 0XDE58, 0XDDF6, 0XD637, 0XD658, 0XD617, 0XD5D6,
-  0XDE17, 0XE69A, 0XE699, 0XEEDA, 0XEEFA, 0XEEDA, 0XE6B9, 0XDE57,
-  0XD5F6, 0XD5F5, 0XCD33, 0XD4F1, 0XCD93, 0XC46F, 0XCCD0, 0XCD73,
-  0XCD12, 0XCD93, 0XCD93, 0XCD93, 0XC511, 0XBC6E, 0XBC6E, 0XBCD0,
-  0XB48E, 0XAC0D, 0XB40C, 0XB42D, 0XAC0C, 0XABCB, 0XAB29, 0X9A66,
-  0XA2A7, 0XA2E8, 0X9A87, 0X9204, 0X9205, 0X9225, 0X9205, 0X9225,
-  0X8A05, 0X89E4, 0X81C4, 0X81A4, 0X8183, 0X7983, 0X7963, 0X7963,
-  0X7122, 0X7122, 0X7942, 0X7963, 0X7963, 0X8183, 0X81A3, 0X81C4,
-  0X89E4, 0X8A04, 0X9224, 0X9245, 0X9AA7, 0X9AE7, 0XA308, 0XAB49,
-  0XA328, 0XA349, 0XABCB, 0XABCB, 0XAB88, 0XAB88, 0XB3EB, 0XBCAE,
-  0XBD0F, 0XBD10, 0XC551, 0XC593, 0XCDF4, 0XCE35, 0XD635, 0XD676,
-  0XD696, 0XDE97, 0XDED8, 0XDF19, 0XD6B7, 0XDED9, 0XEF3B, 0XDE98,
-  0XCDD5, 0XDE98, 0XE6D9, 0XD5D5, 0XDE78, 0XEF9C, 0XEFBD, 0XEF9D,
-  0XEF5C, 0XF75C, 0XEF5C, 0XEF5C, 0XF77C, 0XF77D, 0XF75C, 0XEF3C,
-  0XEF3B, 0XE6B9, 0XCDF7, 0XC5F6, 0XAD54, 0X9CB3, 0X73AE, 0X39E6,
-  0X1061, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020,
-  0X39E7, 0X6B8D, 0X842F, 0X9D13, 0XB5B5, 0XC637, 0XCEB9, 0XD6BA,
-  0XE6DA, 0XDEBA, 0XDE99, 0XDE79, 0XD617, 0XD637, 0XCE37, 0XD5D6,
-  0XDDF7, 0XE69A, 0XE6BA, 0XE6B9, 0XEEFA, 0XE6FA, 0XE6B9, 0XDE58,
-  0XDE57, 0XD637, 0XD5B5, 0XD512, 0XD532, 0XCCD1, 0XCD12, 0XD5D4,
-  0XD5B4, 0XCD93, 0XCD93, 0XCD93, 0XC551, 0XBC4E, 0XBC6F, 0XBCD0,
-  0XB48E, 0XB42D, 0XB38B, 0XAB6A, 0XAB6A, 0XAB29, 0XA2A7, 0XA246,
-  0X9A46, 0X9A46, 0X9A25, 0X9A26, 0X9A66, 0X9246, 0X9266, 0X9246,
-  0X8A25, 0X8A05, 0X8205, 0X81C4, 0X8183, 0X7983, 0X7963, 0X7942,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X81A3, 0X81C4, 0X89E4,
-  0X8A04, 0X8A04, 0X9245, 0X9265, 0X9AA7, 0X9B08, 0XA328, 0XA349,
-  0XA349, 0XAB8A, 0XAC0B, 0XAC2C, 0XB3CB, 0XAB69, 0XB3CA, 0XBCAD,
-  0XBCEF, 0XBD10, 0XC551, 0XC592, 0XCDD3, 0XCE15, 0XCE55, 0XD655,
-  0XD676, 0XD676, 0XDEB7, 0XDED8, 0XDE96, 0XE6D8, 0XE73B, 0XE73A,
-  0XE6F9, 0XDE98, 0XDE77, 0XE6B9, 0XD657, 0XDEB9, 0XEF7C, 0XEF5C,
-  0XEF5B, 0XF73B, 0XEF5C, 0XF77C, 0XF77D, 0XF77C, 0XF77D, 0XF77D,
-  0XEF3C, 0XEF1B, 0XD678, 0XC5F7, 0XB5B5, 0XA533, 0X8430, 0X52CA,
-  0X2123, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X1903,
-  0X5B0C, 0X7BEF, 0X8C71, 0XB5B5, 0XBE17, 0XCE79, 0XD69A, 0XDEDA,
-  0XDEDA, 0XDEBA, 0XDEBA, 0XDE9A, 0XD617, 0XD5F7, 0XD617, 0XD5F7,
-  0XDE18, 0XE6BA, 0XE6DA, 0XE699, 0XEEFA, 0XEF1A, 0XE6B9, 0XDE58,
-  0XDE57, 0XD637, 0XD616, 0XCD73, 0XD573, 0XD594, 0XD573, 0XD573,
-  0XD552, 0XCD73, 0XCD93, 0XCDB3, 0XC511, 0XBBEC, 0XBBEC, 0XBC2D,
-  0XB40C, 0XAB8A, 0XAB09, 0XAB08, 0XA2C7, 0XA2A7, 0X9A46, 0X9A25,
-  0X9A25, 0X9A87, 0XA2E8, 0X9AA7, 0X9A87, 0X9266, 0X9286, 0X8A66,
-  0X8A25, 0X8A25, 0X8205, 0X81C4, 0X81A3, 0X79A3, 0X7963, 0X7942,
-  0X7122, 0X7122, 0X7942, 0X7963, 0X7983, 0X81A3, 0X81E4, 0X8A04,
-  0X8A05, 0X9225, 0X9265, 0X9286, 0X9AA7, 0X9B08, 0X9B49, 0XA369,
-  0XA369, 0XABAA, 0XABEB, 0XAC2C, 0XB44C, 0XB3EB, 0XB3CA, 0XB48D,
-  0XBCCE, 0XBD0F, 0XC551, 0XC592, 0XC5B2, 0XC5D3, 0XCE14, 0XCE34,
-  0XCE55, 0XD675, 0XD676, 0XDE55, 0XDE35, 0XDE76, 0XE6F9, 0XEF3A,
-  0XE719, 0XDEB7, 0XDE77, 0XE719, 0XE71A, 0XE6FA, 0XEF3B, 0XEF5B,
-  0XEF5B, 0XEF3B, 0XF73B, 0XF75C, 0XEF5C, 0XF77D, 0XF79D, 0XF79D,
-  0XEF5C, 0XE71A, 0XDE98, 0XCE17, 0XBDD6, 0XB595, 0XA514, 0X7BD0,
-  0X4247, 0X1081, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0861, 0X3A48,
-  0X6BAE, 0X8410, 0X9C92, 0XB595, 0XCE79, 0XCE79, 0XD699, 0XDEDA,
-  0XDE9A, 0XDE9A, 0XDEBA, 0XD679, 0XD618, 0XD618, 0XD618, 0XD5F7,
-  0XDE18, 0XDE99, 0XE6DA, 0XEE99, 0XEEDA, 0XEF1A, 0XE6B9, 0XDE37,
-  0XDE36, 0XD637, 0XD5F6, 0XCD94, 0XCD73, 0XD5D5, 0XD5B4, 0XD573,
-  0XCD31, 0XCD11, 0XCD11, 0XC4F0, 0XBC2C, 0XB38A, 0XB38A, 0XB38A,
-  0XB38A, 0XAB6A, 0XAB29, 0XB36A, 0XAB4A, 0X9A87, 0X9A26, 0X9A67,
-  0X9AC8, 0XA329, 0X9B09, 0X9A87, 0X9266, 0X9246, 0X9266, 0X8A46,
-  0X8A25, 0X8225, 0X81E4, 0X81A3, 0X79A4, 0X7983, 0X7963, 0X7942,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X81A3, 0X81E4, 0X8204,
-  0X8A25, 0X9245, 0X9266, 0X92A6, 0X9AC7, 0X9B08, 0X9B49, 0XA369,
-  0XA389, 0XABAA, 0XABCA, 0XABEB, 0XB40B, 0XB40B, 0XB3EB, 0XB44C,
-  0XB4CE, 0XBCEF, 0XBD30, 0XC571, 0XC572, 0XC592, 0XCDD3, 0XCE14,
-  0XD634, 0XD655, 0XD614, 0XDE56, 0XDE97, 0XDE96, 0XDE97, 0XE6D8,
-  0XE6F9, 0XDEF9, 0XDED8, 0XE6D8, 0XEF19, 0XE719, 0XE719, 0XEF5A,
-  0XEF5B, 0XEF5B, 0XF75C, 0XEF3B, 0XEF1B, 0XF75C, 0XF77D, 0XF79D,
-  0XEF7C, 0XEF1A, 0XDE78, 0XD5F7, 0XC595, 0XBDD6, 0XB5D7, 0X94B2,
-  0X634D, 0X2965, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X2144, 0X5B4C,
-  0X73CF, 0X94B2, 0XA4D2, 0XAD13, 0XCE78, 0XD6DA, 0XDEDA, 0XDEBA,
-  0XE6BA, 0XDEBA, 0XDE99, 0XDE59, 0XD617, 0XDE18, 0XDE79, 0XDE38,
-  0XD5D7, 0XDE58, 0XDEBA, 0XE6B9, 0XEEB9, 0XEEFA, 0XE6B9, 0XDE37,
-  0XDE16, 0XD616, 0XD5F6, 0XD5D5, 0XCD73, 0XD593, 0XD5B4, 0XD5B4,
-  0XD573, 0XCD32, 0XC4F0, 0XC44D, 0XBBCC, 0XBC0D, 0XB3CB, 0XB3AB,
-  0XB3CC, 0XB3EC, 0XABAB, 0XABAB, 0XAB4A, 0X9A46, 0X9A66, 0XA309,
-  0XA309, 0X9B08, 0X9B08, 0X9AA7, 0X9266, 0X9266, 0X9286, 0X8A46,
-  0X8A25, 0X8205, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7142,
-  0X7122, 0X7142, 0X7142, 0X7963, 0X7963, 0X7983, 0X81C4, 0X89E5,
-  0X8A25, 0X9245, 0X9266, 0X92A7, 0X9AC7, 0X9B08, 0X9B48, 0XA369,
-  0XA38A, 0XA3AA, 0XABCA, 0XABEA, 0XB3EB, 0XB3CB, 0XB3CB, 0XBC4C,
-  0XB48D, 0XBCAE, 0XBCEF, 0XC530, 0XC571, 0XC591, 0XCDB2, 0XCDD2,
-  0XD5D3, 0XD5F3, 0XD635, 0XD677, 0XDE96, 0XDE97, 0XDE97, 0XDEF9,
-  0XE719, 0XE719, 0XDEF8, 0XDEF9, 0XE6D7, 0XE6D7, 0XEED8, 0XEED8,
-  0XEEF9, 0XEF1A, 0XEF3B, 0XEF3B, 0XEF1A, 0XEF1B, 0XEF3B, 0XEF5C,
-  0XEF3B, 0XE6FA, 0XDE99, 0XD637, 0XCD95, 0XBD54, 0XBD55, 0XA513,
-  0X7C10, 0X52CC, 0X10C2, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0881, 0X4A89, 0X73CE,
-  0X8C71, 0X9D55, 0XB5B6, 0XBD95, 0XC5B5, 0XDE79, 0XE71B, 0XDEDA,
-  0XDEBA, 0XDEBA, 0XDE79, 0XDE17, 0XDDD7, 0XDE58, 0XE699, 0XDE59,
-  0XDDF7, 0XDDF7, 0XDE58, 0XE679, 0XE699, 0XE6D9, 0XE698, 0XDE16,
-  0XDDF6, 0XDE16, 0XD5D5, 0XCDD5, 0XD594, 0XCD52, 0XD573, 0XD5D4,
-  0XCD73, 0XCD52, 0XCD31, 0XBC4D, 0XBC2E, 0XBC4E, 0XB38A, 0XB38A,
-  0XB40D, 0XAC4D, 0XABCB, 0XAB8A, 0XA2C8, 0X9A25, 0XA2C8, 0XA329,
-  0XA309, 0X9B08, 0X9AC7, 0X9A87, 0X9266, 0X9266, 0X8A86, 0X8A46,
-  0X8A25, 0X81E5, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7142,
-  0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7983, 0X81C4, 0X89E4,
-  0X8A05, 0X9245, 0X9266, 0X92A6, 0X9AC7, 0X9B08, 0X9B28, 0XA349,
-  0XA389, 0XA3AA, 0XABAA, 0XABCA, 0XB3CA, 0XAB89, 0XB3AA, 0XBC0C,
-  0XBC4C, 0XBC6D, 0XBCAE, 0XBCEF, 0XC510, 0XC530, 0XCD71, 0XCD92,
-  0XD5D3, 0XD615, 0XD655, 0XD676, 0XDE96, 0XDE76, 0XDE96, 0XDEB7,
-  0XDED8, 0XDEF8, 0XDEF8, 0XE6F9, 0XE6F9, 0XE6F9, 0XEF3A, 0XEF3A,
-  0XEF3A, 0XEF5B, 0XEF3B, 0XEF3A, 0XEF1A, 0XEF1A, 0XEF1B, 0XEF3B,
-  0XEF3B, 0XE71A, 0XDEDA, 0XD657, 0XCDD6, 0XC555, 0XBD34, 0XB575,
-  0X9CF3, 0X7C11, 0X4228, 0X0840, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X31A5, 0X6B4C, 0X83EF,
-  0X9CD3, 0XADB6, 0XBE38, 0XCE38, 0XD638, 0XDDF8, 0XE6BA, 0XE6FB,
-  0XDEBA, 0XD618, 0XD5B6, 0XDDF7, 0XE658, 0XE679, 0XE699, 0XE659,
-  0XDDF7, 0XDDD6, 0XDE38, 0XDE17, 0XDE57, 0XE6B9, 0XE657, 0XDDF5,
-  0XD5B5, 0XD5D5, 0XD5D4, 0XCD94, 0XCD73, 0XCD53, 0XD572, 0XCD72,
-  0XCD72, 0XCD52, 0XC531, 0XBC2D, 0XBC2D, 0XB42D, 0XB3AB, 0XAB69,
-  0XB3CB, 0XB44D, 0XABAB, 0XAAE8, 0X9A87, 0X9A87, 0XA329, 0XA349,
-  0XA329, 0X9AE8, 0X9287, 0X9A86, 0X9246, 0X9266, 0X8A66, 0X8A46,
-  0X8A25, 0X81E4, 0X81C4, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7142,
-  0X7122, 0X7122, 0X7142, 0X7942, 0X7963, 0X7983, 0X81A3, 0X81E4,
-  0X8A04, 0X8A25, 0X9245, 0X9266, 0X9A86, 0X9AC7, 0X9B08, 0XA308,
-  0XA348, 0XAB69, 0XAB69, 0XAB89, 0XAB48, 0XAB49, 0XB3AA, 0XB38A,
-  0XB3AA, 0XBC0C, 0XBC2C, 0XBC6D, 0XBCCF, 0XC510, 0XCD71, 0XCDD3,
-  0XD614, 0XD655, 0XD655, 0XD635, 0XD656, 0XD676, 0XDE96, 0XDEB7,
-  0XDED8, 0XDED8, 0XDED8, 0XDED9, 0XE719, 0XE739, 0XE73A, 0XE75A,
-  0XEF7B, 0XEF7C, 0XEF5B, 0XEF3B, 0XEF5B, 0XEF5B, 0XEF3B, 0XEF5C,
-  0XEF5B, 0XEF1A, 0XE6DA, 0XDE79, 0XCE17, 0XC5B6, 0XBD75, 0XB5B7,
-  0XAD35, 0X9451, 0X738F, 0X31A6, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X2103, 0X5ACA, 0X73AE, 0X8451,
-  0XAD35, 0XBDF8, 0XC659, 0XCE79, 0XDEBA, 0XDEFB, 0XDE79, 0XE69A,
-  0XDE79, 0XD5F7, 0XDDB6, 0XE638, 0XE699, 0XE679, 0XE679, 0XE679,
-  0XE658, 0XDDF7, 0XDE17, 0XE658, 0XE616, 0XE637, 0XDE36, 0XDE16,
-  0XD5B4, 0XD553, 0XD5B4, 0XD573, 0XCD53, 0XCD73, 0XD594, 0XCD32,
-  0XCD52, 0XCD52, 0XC4D0, 0XBC4D, 0XBC8E, 0XB42D, 0XB38A, 0XAB29,
-  0XAB6A, 0XB3CC, 0XAB29, 0X9A66, 0X9A67, 0XA2E8, 0XA349, 0XA349,
-  0X9B29, 0X9AC8, 0X9287, 0X9286, 0X9246, 0X9246, 0X8A46, 0X8A25,
-  0X8205, 0X81C4, 0X81C4, 0X79C4, 0X79A3, 0X7963, 0X7963, 0X7122,
-  0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7983, 0X81A3, 0X81E4,
-  0X8A05, 0X8A25, 0X9245, 0X9266, 0X9A86, 0X9AC7, 0X9AE7, 0XA308,
-  0XA328, 0XA369, 0XAB89, 0XAB89, 0XAB49, 0XB38A, 0XB3AA, 0XAB49,
-  0XB38A, 0XBC0B, 0XB42C, 0XBC8D, 0XC510, 0XC551, 0XCD92, 0XCDD3,
-  0XCDF4, 0XD614, 0XD635, 0XD635, 0XD675, 0XD676, 0XD676, 0XDE97,
-  0XD697, 0XDED8, 0XDEF9, 0XDEF9, 0XDEF9, 0XE719, 0XE6F9, 0XE719,
-  0XE73A, 0XE75B, 0XE75B, 0XE75B, 0XEF7C, 0XEF7C, 0XEF3B, 0XEF1A,
-  0XEF1B, 0XE6DA, 0XE6FB, 0XE6DA, 0XD658, 0XCDF6, 0XBD95, 0XC5D6,
-  0XB596, 0X9C92, 0X8C32, 0X6B4D, 0X18E3, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X1081, 0X4A48, 0X6B8E, 0X7C50, 0X9D34,
-  0XB5D7, 0XC659, 0XD69A, 0XD6BA, 0XDE9A, 0XE6DB, 0XE6BA, 0XDE59,
-  0XDE39, 0XDE79, 0XDE79, 0XE659, 0XE679, 0XE679, 0XE679, 0XE6B9,
-  0XE69A, 0XDE38, 0XDE17, 0XE679, 0XDE58, 0XDE16, 0XDDD5, 0XDDF5,
-  0XD5F5, 0XD574, 0XD5B4, 0XD5D4, 0XD5B4, 0XD573, 0XCD73, 0XCD52,
-  0XC531, 0XC4F1, 0XBC6E, 0XBC4E, 0XBCF0, 0XB46E, 0XB36A, 0XB309,
-  0XAB6A, 0XAB8B, 0XA2E8, 0XA2C8, 0XA2A8, 0XA2E9, 0XA349, 0XA349,
-  0X9B29, 0X9AC8, 0X9287, 0X9286, 0X9266, 0X8A45, 0X8A25, 0X8A05,
-  0X81E4, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7162, 0X7122,
-  0X7122, 0X7122, 0X7142, 0X7142, 0X7962, 0X7963, 0X81A3, 0X81E4,
-  0X8A05, 0X8A25, 0X9266, 0X9286, 0X9286, 0X9AC7, 0X9B08, 0XA308,
-  0XA348, 0XA369, 0XABAA, 0XABCB, 0XB3CB, 0XB3CA, 0XB3AA, 0XB3CB,
-  0XB40B, 0XBC2C, 0XBC6D, 0XBCCF, 0XC510, 0XCD51, 0XCD92, 0XCDD3,
-  0XCDF4, 0XD614, 0XD635, 0XD635, 0XDE76, 0XDE96, 0XDE96, 0XDE97,
-  0XDE97, 0XDEB8, 0XDED8, 0XDEF9, 0XDF1A, 0XE75B, 0XE73B, 0XE719,
-  0XE71A, 0XE75B, 0XE77B, 0XE73B, 0XE75B, 0XE75C, 0XE73B, 0XE71B,
-  0XE6FB, 0XE6FB, 0XE6DA, 0XE6DA, 0XDEDA, 0XD658, 0XCDB6, 0XC5B6,
-  0XB595, 0XAD35, 0X9CF4, 0X8472, 0X52AA, 0X10A2, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0840, 0X39E6, 0X6B6D, 0X73CE, 0X94B3, 0XB5B7,
-  0XBDF8, 0XCE9A, 0XD6BA, 0XD69A, 0XDE9A, 0XDEBB, 0XE6FC, 0XE6BB,
-  0XDE39, 0XDE9A, 0XE6BA, 0XE679, 0XE659, 0XDE79, 0XDE79, 0XE6BA,
-  0XE6BA, 0XE6B9, 0XE679, 0XE698, 0XE678, 0XE637, 0XDE16, 0XD5F5,
-  0XD5F5, 0XD5D5, 0XD5D5, 0XD5D5, 0XD5D4, 0XD593, 0XCD31, 0XC511,
-  0XC4F1, 0XC4D0, 0XB40C, 0XBC2D, 0XBC6E, 0XBC6E, 0XB3EC, 0XB329,
-  0XB3AB, 0XAB6A, 0XAB09, 0XAB6A, 0XA2E8, 0XA2C8, 0XA34A, 0XA349,
-  0X9B08, 0X9AA7, 0X9287, 0X9286, 0X9266, 0X8A25, 0X8A05, 0X8A05,
-  0X81E4, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7142, 0X7122,
-  0X7122, 0X7122, 0X7142, 0X7142, 0X7942, 0X7963, 0X7983, 0X81C4,
-  0X8204, 0X8A25, 0X8A45, 0X9265, 0X9286, 0X9AC7, 0X9AE7, 0X9B08,
-  0XA349, 0XA369, 0XABAA, 0XABCB, 0XABEB, 0XABCA, 0XB3CB, 0XB42C,
-  0XB44D, 0XB46D, 0XBCAE, 0XBCCF, 0XC50F, 0XC550, 0XCD92, 0XCDD3,
-  0XCDF4, 0XD614, 0XD635, 0XD655, 0XDE76, 0XDE76, 0XDE96, 0XDE76,
-  0XDE97, 0XDEB7, 0XDEB8, 0XDED9, 0XDF3A, 0XE75B, 0XE75B, 0XE71A,
-  0XE73A, 0XEF7B, 0XE77B, 0XE75B, 0XE75C, 0XE73C, 0XE73C, 0XE75D,
-  0XEF5C, 0XEF1C, 0XE6FB, 0XDEDA, 0XE6DB, 0XDE79, 0XCE58, 0XCE38,
-  0XC5B6, 0XBDB7, 0XA576, 0X9D34, 0X7C30, 0X39E7, 0X0841, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X2985, 0X632C, 0X73AE, 0X8C71, 0XA555, 0XBDF9,
-  0XC639, 0XC617, 0XCE18, 0XD659, 0XD67A, 0XDEBB, 0XE6FC, 0XE67A,
-  0XDDF7, 0XDE38, 0XE679, 0XE658, 0XDE59, 0XD659, 0XDE58, 0XE699,
-  0XE6BA, 0XE6FA, 0XEEFA, 0XE6DA, 0XE6B9, 0XE657, 0XDE57, 0XDE36,
-  0XD615, 0XD5F5, 0XD5F5, 0XD5D4, 0XD5B4, 0XCD93, 0XC4F0, 0XC4F1,
-  0XC4F1, 0XBC2D, 0XB3CC, 0XBC4D, 0XBC2D, 0XBBEC, 0XB36A, 0XAB49,
-  0XB3AB, 0XAB29, 0XAB4A, 0XAB8B, 0XA309, 0XA2E8, 0XA349, 0XA329,
-  0X9AE8, 0X9286, 0X9286, 0X9286, 0X8A46, 0X8A05, 0X8A05, 0X8A05,
-  0X81E4, 0X81C4, 0X81A4, 0X79A3, 0X7983, 0X7963, 0X7142, 0X7122,
-  0X7102, 0X7122, 0X7142, 0X7142, 0X7962, 0X7963, 0X7983, 0X81C4,
-  0X8204, 0X8A25, 0X8A45, 0X9266, 0X92A7, 0X9AC7, 0X9AE7, 0X9B08,
-  0XA349, 0XA38A, 0XABAA, 0XABCB, 0XABEB, 0XABEB, 0XB40C, 0XB44C,
-  0XB46D, 0XBC8E, 0XBCAE, 0XBCEF, 0XC530, 0XC551, 0XC592, 0XCDB3,
-  0XD5F4, 0XD5F4, 0XD615, 0XD635, 0XD676, 0XD655, 0XDE35, 0XD655,
-  0XD676, 0XD697, 0XDED8, 0XDEF9, 0XDF1A, 0XE75B, 0XE73A, 0XDEF9,
-  0XE71A, 0XE75B, 0XE77C, 0XE77C, 0XE75C, 0XEF5C, 0XEF5D, 0XE75C,
-  0XE73C, 0XE71B, 0XE6FB, 0XDEDA, 0XDEDA, 0XDEB9, 0XCE58, 0XCDF7,
-  0XC5D7, 0XBDF7, 0XB5D7, 0XA575, 0X9492, 0X7BF0, 0X4208, 0X0841,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0020, 0X2123, 0X5ACB, 0X7BAF, 0X8430, 0X9CF4, 0XB5B7, 0XC639,
-  0XCE59, 0XC534, 0XCD55, 0XD638, 0XD659, 0XDE79, 0XDE59, 0XE639,
-  0XE659, 0XDE18, 0XDE18, 0XE679, 0XDE79, 0XD638, 0XDE58, 0XE699,
-  0XE6B9, 0XE6B9, 0XEEFA, 0XEF1B, 0XE6DA, 0XE698, 0XDE78, 0XDE57,
-  0XD616, 0XD5D5, 0XD5F5, 0XD5D4, 0XCD52, 0XC511, 0XC4D0, 0XC4B0,
-  0XC4D0, 0XBBCC, 0XBC0D, 0XBCAF, 0XBC8E, 0XBC2D, 0XB349, 0XAB29,
-  0XAB4A, 0XAB08, 0XB38B, 0XAB4A, 0XA2E9, 0X9AE8, 0XA309, 0X9AE8,
-  0X9AA7, 0X9266, 0X9266, 0X9266, 0X9246, 0X8A25, 0X8A25, 0X8A05,
-  0X81C4, 0X81A4, 0X79A4, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122,
-  0X7102, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7963, 0X81A4,
-  0X81E4, 0X8A05, 0X8A45, 0X8A66, 0X92A6, 0X92A7, 0X9AE7, 0X9B28,
-  0XA349, 0XA38A, 0XA3AA, 0XABCB, 0XABEB, 0XAC0B, 0XB42C, 0XB44D,
-  0XB46D, 0XBC8E, 0XBCAE, 0XBCCF, 0XC510, 0XC551, 0XC572, 0XCDB3,
-  0XCDD3, 0XCDF4, 0XCDF4, 0XD635, 0XD655, 0XD614, 0XD5D3, 0XD5D4,
-  0XD656, 0XD635, 0XD5B3, 0XDE98, 0XDF19, 0XE73A, 0XE73A, 0XE6FA,
-  0XE71A, 0XE77B, 0XE77B, 0XE77C, 0XE75C, 0XEF5C, 0XE75C, 0XE73C,
-  0XE71B, 0XE71B, 0XE71B, 0XE6DA, 0XD658, 0XDE17, 0XDE18, 0XD638,
-  0XCE59, 0XC618, 0XBDF7, 0XAD75, 0XA514, 0X9CD3, 0X73CF, 0X31C7,
-  0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X2124, 0X52CA, 0X738D, 0X7BCF, 0X9CD4, 0XA555, 0XB5D6, 0XCE79,
-  0XCE7A, 0XCDD8, 0XCDD8, 0XD679, 0XDE9A, 0XDE7A, 0XD5B7, 0XD576,
-  0XE6DB, 0XE69A, 0XDE59, 0XE699, 0XDE58, 0XDE58, 0XDE99, 0XE6BA,
-  0XE6B9, 0XE698, 0XE6B9, 0XEEFA, 0XEEFA, 0XE6D9, 0XDE98, 0XDE36,
-  0XD5D5, 0XD5D5, 0XD5B4, 0XD593, 0XCD32, 0XC4D0, 0XC4B0, 0XBC2D,
-  0XBC2D, 0XB3AC, 0XBC0D, 0XBC8F, 0XBC6E, 0XB44D, 0XB3CB, 0XB34A,
-  0XAB29, 0XAAE8, 0XAB6B, 0XA309, 0XA2C8, 0X9AC8, 0X9AC8, 0X9AA7,
-  0X9287, 0X9287, 0X9286, 0X9266, 0X8A46, 0X8A25, 0X8A25, 0X81E4,
-  0X81A4, 0X79A3, 0X79A3, 0X7983, 0X7963, 0X7142, 0X7122, 0X7122,
-  0X6902, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7963, 0X81A3,
-  0X81E4, 0X8204, 0X8A25, 0X8A66, 0X9286, 0X92A7, 0X9AE7, 0X9B08,
-  0X9B49, 0XA369, 0XA38A, 0XABCA, 0XABEB, 0XAC0C, 0XB42C, 0XB44D,
-  0XB46D, 0XB48D, 0XBCAF, 0XBCCF, 0XBCEF, 0XC531, 0XC571, 0XCD92,
-  0XCDD3, 0XCDF4, 0XCDF4, 0XCE14, 0XCDF4, 0XCDF4, 0XD615, 0XD5B3,
-  0XDE56, 0XD5F4, 0XCD51, 0XD615, 0XDED8, 0XDF19, 0XE73B, 0XE71A,
-  0XE6F9, 0XEF7B, 0XE77C, 0XEF5C, 0XEF5C, 0XE75B, 0XDF3B, 0XE71B,
-  0XE71B, 0XE6FB, 0XE71C, 0XE71C, 0XD679, 0XD638, 0XDE99, 0XD679,
-  0XD679, 0XCE59, 0XBDB6, 0XB596, 0XB595, 0XA4D3, 0X8C92, 0X6BCF,
-  0X31E7, 0X0041, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0040, 0X2944,
-  0X5AEA, 0X73AE, 0X8410, 0X94D3, 0XAD76, 0XBDF7, 0XC618, 0XCE59,
-  0XD67A, 0XD69B, 0XD6BB, 0XDEDB, 0XDEDB, 0XDEFB, 0XDE39, 0XD535,
-  0XD596, 0XDE59, 0XE69A, 0XDE79, 0XDE39, 0XDE9A, 0XE6BA, 0XDE99,
-  0XE6BA, 0XE699, 0XE699, 0XE6D9, 0XE6D9, 0XE6B9, 0XE6B8, 0XDE36,
-  0XD5B4, 0XD5B4, 0XD593, 0XCD52, 0XC511, 0XC4D0, 0XC48F, 0XBC0D,
-  0XB38B, 0XB36A, 0XB40D, 0XBC4E, 0XB44D, 0XB42D, 0XB3AB, 0XB36A,
-  0XAB09, 0XAB09, 0XA309, 0X9AA8, 0X9AC8, 0X9AA7, 0X9A66, 0X9266,
-  0X9287, 0X9287, 0X9266, 0X9266, 0X8A46, 0X8A25, 0X8A05, 0X81E4,
-  0X79A4, 0X7983, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122, 0X7122,
-  0X6902, 0X7102, 0X7122, 0X7142, 0X7142, 0X7963, 0X7963, 0X7983,
-  0X81C4, 0X81E4, 0X8A05, 0X8A46, 0X9286, 0X92A7, 0X92C7, 0X9AE8,
-  0X9B28, 0XA369, 0XA389, 0XA3AA, 0XABEB, 0XAC0C, 0XAC2C, 0XB44D,
-  0XB44D, 0XB46D, 0XBC8E, 0XBCCF, 0XBCEF, 0XC530, 0XC551, 0XCD72,
-  0XCDB2, 0XCDD3, 0XCDD3, 0XCDF3, 0XCDF2, 0XD614, 0XD635, 0XD593,
-  0XD592, 0XD572, 0XD592, 0XD614, 0XDEB8, 0XE719, 0XE719, 0XE6F8,
-  0XE6F9, 0XEF7C, 0XEF9C, 0XEF7B, 0XE77B, 0XDEFA, 0XDEDA, 0XE71B,
-  0XE71B, 0XE71B, 0XE71B, 0XE73C, 0XDEDB, 0XDEB9, 0XDEFA, 0XD5F7,
-  0XD658, 0XD678, 0XC5B6, 0XC5D6, 0XBDB6, 0XA4F3, 0X9493, 0X8C92,
-  0X73CF, 0X4249, 0X0861, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X2944, 0X4A89,
-  0X73AE, 0X8430, 0X9492, 0XA4D3, 0XBD95, 0XCE18, 0XCE59, 0XD67A,
-  0XD679, 0XD69A, 0XDEDC, 0XE6FC, 0XE71C, 0XE73C, 0XDEDB, 0XDE3A,
-  0XD596, 0XDDD6, 0XE69A, 0XDE59, 0XDE38, 0XDE39, 0XDE59, 0XDE38,
-  0XDE78, 0XE6B9, 0XE6B9, 0XE6D9, 0XE6B9, 0XE698, 0XE698, 0XDE57,
-  0XDDF5, 0XD573, 0XD552, 0XCD12, 0XC4D0, 0XC48F, 0XBC6F, 0XBC6F,
-  0XBC4E, 0XBC0D, 0XBC2D, 0XB42D, 0XB40C, 0XB3AB, 0XAB6A, 0XAB8B,
-  0XA2E8, 0XA2E8, 0XA2C8, 0X9AA8, 0X9AC8, 0X9A87, 0X9246, 0X9246,
-  0X9266, 0X9266, 0X9266, 0X9246, 0X8A46, 0X8A45, 0X8205, 0X81C4,
-  0X79A3, 0X7983, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7102,
-  0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983,
-  0X81A4, 0X81E4, 0X89E4, 0X8A25, 0X9266, 0X92A6, 0X92C7, 0X9AE7,
-  0X9B28, 0X9B49, 0XA369, 0XA389, 0XABCA, 0XABEB, 0XAC0C, 0XB42C,
-  0XB44C, 0XB46D, 0XBC8D, 0XBCAF, 0XBCEF, 0XC530, 0XC551, 0XC571,
-  0XCD92, 0XCDB2, 0XCDD3, 0XCDD3, 0XCDD2, 0XD614, 0XD634, 0XD5B3,
-  0XD551, 0XD5D3, 0XD5F4, 0XD5F4, 0XDEB7, 0XDEB7, 0XDEB8, 0XE719,
-  0XE71A, 0XEF5B, 0XE77B, 0XE75B, 0XE73B, 0XE71A, 0XE6FA, 0XE73B,
-  0XE73B, 0XE73B, 0XDEDA, 0XE6FA, 0XE6FB, 0XE6DA, 0XDEBA, 0XD5F7,
-  0XD638, 0XD658, 0XCE38, 0XCE38, 0XBE17, 0XB5B6, 0XAD75, 0X9CF3,
-  0X9471, 0X7BCF, 0X4249, 0X10A2, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0840, 0X2944, 0X5289, 0X6B4C,
-  0X7C10, 0X9CD3, 0XA4F4, 0XA472, 0XBD55, 0XCE59, 0XD6BB, 0XE6FC,
-  0XE6FC, 0XDEBA, 0XE6DC, 0XE71C, 0XEF3D, 0XEF3D, 0XE71C, 0XE6FC,
-  0XDE7A, 0XDDD7, 0XDDF7, 0XE67A, 0XDE39, 0XD5D7, 0XD618, 0XD617,
-  0XDE37, 0XE699, 0XE6D9, 0XEED9, 0XE6D9, 0XE6B8, 0XE677, 0XDE57,
-  0XDE36, 0XD5D4, 0XD552, 0XCD32, 0XCD32, 0XC4F1, 0XC4D0, 0XC4D0,
-  0XBCB0, 0XBC8F, 0XBC4E, 0XB3EC, 0XB3CB, 0XAB6B, 0XAB6B, 0XAB6A,
-  0XA2C8, 0X9A67, 0XA2A8, 0XA309, 0XA2E8, 0X9AA7, 0X9A87, 0X9A67,
-  0X9266, 0X9266, 0X9246, 0X8A46, 0X8A46, 0X8A25, 0X8205, 0X81C4,
-  0X79A3, 0X7983, 0X7983, 0X7963, 0X7143, 0X7142, 0X7122, 0X7102,
-  0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7942, 0X7963, 0X7963,
-  0X81A3, 0X81C4, 0X81C4, 0X8A04, 0X8A45, 0X9286, 0X92A7, 0X9AC7,
-  0X9B08, 0X9B29, 0XA369, 0XA389, 0XA3AA, 0XABCA, 0XABEB, 0XAC0B,
-  0XB42C, 0XB46D, 0XBC8D, 0XBCAE, 0XBCCF, 0XBD0F, 0XC530, 0XC551,
-  0XCD71, 0XCD92, 0XCDD2, 0XCDD2, 0XCDD3, 0XD634, 0XD655, 0XD614,
-  0XD614, 0XDE76, 0XDE96, 0XD5F4, 0XD5F4, 0XDE97, 0XDEF9, 0XDEF9,
-  0XDED9, 0XE73A, 0XE77B, 0XEF5B, 0XE73B, 0XE75B, 0XE75B, 0XE73B,
-  0XE71B, 0XE73B, 0XE6FA, 0XDEBA, 0XE71B, 0XE6DA, 0XDE38, 0XDE9A,
-  0XDEBA, 0XDE79, 0XD638, 0XCE18, 0XCE38, 0XC617, 0XBDF7, 0XAD75,
-  0X9CB3, 0X8C31, 0X740F, 0X52CB, 0X2104, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X1081, 0X39C6, 0X5AA9, 0X632C, 0X7BD0,
-  0X9452, 0XAD15, 0XB5B7, 0XBDD7, 0XC596, 0XCDF7, 0XDE9B, 0XE75E,
-  0XEF5E, 0XE71D, 0XE6FB, 0XE71C, 0XE6FC, 0XE6FC, 0XE6DB, 0XE6BB,
-  0XE69B, 0XE65A, 0XD534, 0XDD55, 0XDE19, 0XD5D8, 0XD5B6, 0XD5B6,
-  0XDE17, 0XDE78, 0XE6B9, 0XE6D9, 0XEEF9, 0XE6B8, 0XE677, 0XDE57,
-  0XDE16, 0XD5D5, 0XCD52, 0XCD11, 0XC531, 0XC4F0, 0XBCAE, 0XBCAF,
-  0XBCAF, 0XBCAF, 0XB48F, 0XBC2D, 0XB3CB, 0XAB6B, 0XAB6B, 0XAB4A,
-  0XA2E8, 0X9A67, 0X9A87, 0X9AE8, 0X9AE8, 0X9AA7, 0X9AA7, 0X9287,
-  0X9266, 0X9246, 0X8A25, 0X8A25, 0X8A25, 0X8A25, 0X8205, 0X81C4,
-  0X79A3, 0X7983, 0X7983, 0X7963, 0X7143, 0X7122, 0X7122, 0X6902,
-  0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7942, 0X7963, 0X7963,
-  0X7983, 0X81A4, 0X81C4, 0X89E4, 0X8A25, 0X9266, 0X92A7, 0X9AA7,
-  0X9AE7, 0X9B28, 0X9B49, 0XA389, 0XA3AA, 0XABCA, 0XABEA, 0XABCA,
-  0XAC0C, 0XB44D, 0XB46D, 0XBC8D, 0XBCAF, 0XBCEF, 0XBD0F, 0XC530,
-  0XC530, 0XCD71, 0XCD92, 0XCDB1, 0XCDD3, 0XD614, 0XD634, 0XD634,
-  0XD655, 0XDE76, 0XDE76, 0XD676, 0XD656, 0XDEB8, 0XDEF9, 0XDEF9,
-  0XE719, 0XDF39, 0XE77B, 0XE77B, 0XE73B, 0XE75B, 0XE75B, 0XE73B,
-  0XE73B, 0XE6FA, 0XE6DA, 0XE6FB, 0XE6FB, 0XE6BA, 0XDE79, 0XDEFB,
-  0XDEDA, 0XDE58, 0XDE38, 0XDE9A, 0XD69A, 0XCE59, 0XC618, 0XB5B6,
-  0XA554, 0X9CD3, 0X94D3, 0X8411, 0X632D, 0X31C6, 0X0861, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0020, 0X18E3, 0X39E7, 0X62EB, 0X738D, 0X7BF0, 0X9C93,
-  0XACF4, 0XBDD7, 0XC639, 0XCDF8, 0XCDB6, 0XD596, 0XD5B7, 0XDE7A,
-  0XE71D, 0XEF7E, 0XE71C, 0XE699, 0XE69B, 0XE6FC, 0XE6DB, 0XE69B,
-  0XDE7B, 0XDE7A, 0XDDF8, 0XCCD3, 0XD514, 0XDE19, 0XD5F8, 0XCD75,
-  0XD5B6, 0XDE58, 0XE6B9, 0XE6B9, 0XE6D9, 0XE6D9, 0XE697, 0XDE57,
-  0XDE15, 0XD5D4, 0XCD73, 0XC511, 0XC4AF, 0XBC8F, 0XBC6E, 0XBC4D,
-  0XBC6E, 0XBC8E, 0XB48E, 0XB46E, 0XB3EC, 0XAB6A, 0XAB4A, 0XA34A,
-  0XA329, 0X9AE8, 0X9287, 0X9267, 0X9246, 0X9266, 0X9A87, 0X9AA7,
-  0X9287, 0X9266, 0X8A46, 0X8A25, 0X8A05, 0X8205, 0X81E5, 0X81C4,
-  0X79A3, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122, 0X7102, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7962, 0X7963,
-  0X7983, 0X81A3, 0X81C3, 0X81C4, 0X8A25, 0X9266, 0X9286, 0X9286,
-  0X9AC7, 0X9B07, 0X9B28, 0XA369, 0XA38A, 0XABCA, 0XABEB, 0XABCA,
-  0XABEA, 0XB44C, 0XB46D, 0XBC8D, 0XBC8E, 0XBCCF, 0XC4EF, 0XC4EF,
-  0XC530, 0XC550, 0XC571, 0XCD91, 0XCDD2, 0XD5F3, 0XD5F3, 0XD614,
-  0XD655, 0XDE76, 0XDE76, 0XD677, 0XD6B8, 0XDED8, 0XE719, 0XE719,
-  0XE739, 0XE73A, 0XE75A, 0XE75B, 0XE75B, 0XE75B, 0XE75B, 0XE73B,
-  0XE73B, 0XE71B, 0XE6DA, 0XE6FB, 0XE6FB, 0XE699, 0XE679, 0XDEBA,
-  0XDEDB, 0XDE58, 0XDE39, 0XE71C, 0XDEFB, 0XDE9A, 0XCE59, 0XC618,
-  0XBDF7, 0XAD75, 0XA515, 0X9492, 0X8451, 0X6B8D, 0X4A29, 0X2104,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0861, 0X2964, 0X4A68, 0X6B0C, 0X738F, 0X8C31, 0X9CD3, 0XA555,
-  0XBDD7, 0XCE18, 0XCE17, 0XCDB6, 0XD5F8, 0XD639, 0XD618, 0XDE5A,
-  0XE6DC, 0XE6FC, 0XE69B, 0XDE39, 0XE6BA, 0XE73D, 0XE71C, 0XE71C,
-  0XDEFB, 0XDEDB, 0XDE9B, 0XDE19, 0XCCF2, 0XD513, 0XE69A, 0XDE38,
-  0XD5B5, 0XDE37, 0XE678, 0XDE98, 0XDE78, 0XE6B8, 0XDE77, 0XDE56,
-  0XD615, 0XD5D4, 0XCD93, 0XC532, 0XC4B0, 0XBC8F, 0XBCAF, 0XBC6E,
-  0XBC2D, 0XBC4D, 0XB42D, 0XB42D, 0XABEC, 0XABAB, 0XA329, 0XA309,
-  0XA309, 0X9AE8, 0X9AC8, 0X9287, 0X8A46, 0X8A05, 0X9246, 0X9287,
-  0X9287, 0X9287, 0X8A66, 0X8A25, 0X8A05, 0X8205, 0X81E4, 0X81C4,
-  0X7983, 0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7102, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7102, 0X7122, 0X7142, 0X7942, 0X7963,
-  0X7963, 0X81A3, 0X81A4, 0X81C4, 0X8A04, 0X8A45, 0X9266, 0X9286,
-  0X9286, 0X9AC6, 0X9AE7, 0X9B28, 0XA369, 0XA38A, 0XABCB, 0XABEB,
-  0XABEB, 0XB42C, 0XB46D, 0XBC8E, 0XBCAE, 0XBCCF, 0XC4EF, 0XC4EF,
-  0XC50F, 0XC52F, 0XC550, 0XCD71, 0XCD71, 0XCDD2, 0XD5F3, 0XD613,
-  0XD634, 0XD655, 0XDE76, 0XDE97, 0XDE97, 0XDED8, 0XDEF9, 0XE719,
-  0XE6F8, 0XE6F9, 0XE73A, 0XE73A, 0XE75B, 0XE75B, 0XE75B, 0XE73A,
-  0XE71A, 0XE71B, 0XE71B, 0XE71B, 0XE6BA, 0XE699, 0XDE9A, 0XE6BA,
-  0XE6BA, 0XDE5A, 0XDE9A, 0XDE9A, 0XDEBA, 0XD679, 0XD639, 0XD699,
-  0XCE7A, 0XBDF8, 0XB5B7, 0XA534, 0X8C71, 0X8410, 0X7BAE, 0X630B,
-  0X2986, 0X1082, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0840, 0X2103,
-  0X41E6, 0X5A89, 0X632C, 0X7BCF, 0X9472, 0XA4F4, 0XB597, 0XBDF9,
-  0XC5F8, 0XCDF7, 0XCDF7, 0XCDF7, 0XD67A, 0XDEFC, 0XE71C, 0XE6FC,
-  0XDEBB, 0XDE5A, 0XDE5B, 0XE6DC, 0XE6DB, 0XDEBA, 0XE6FC, 0XE6FC,
-  0XE6DB, 0XDEBA, 0XDE79, 0XDE7A, 0XDE18, 0XD512, 0XD532, 0XE638,
-  0XE678, 0XDDF6, 0XDDF6, 0XDE36, 0XDE57, 0XDE77, 0XDE57, 0XD636,
-  0XD5F5, 0XD5B4, 0XCDB3, 0XC552, 0XC511, 0XBCD0, 0XBCAF, 0XBC8E,
-  0XBC6E, 0XBC2D, 0XB3EC, 0XABCB, 0XABEC, 0XABCC, 0XA34A, 0X9B09,
-  0X9AE8, 0X9AC8, 0X92C7, 0X92A7, 0X9287, 0X8A25, 0X8A05, 0X8A25,
-  0X9266, 0X9266, 0X8A46, 0X8A25, 0X8205, 0X81E4, 0X81E4, 0X81C4,
-  0X7983, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7963,
-  0X7963, 0X7983, 0X81A3, 0X81A3, 0X89E4, 0X8A25, 0X9265, 0X9286,
-  0X9286, 0X92A6, 0X9AA6, 0X9AE7, 0XA329, 0XA369, 0XA3AA, 0XABCB,
-  0XABCA, 0XAC0C, 0XB42D, 0XBC6D, 0XBCAE, 0XBCCF, 0XBCEF, 0XBD0F,
-  0XC4EF, 0XC4EE, 0XC50F, 0XC530, 0XCD71, 0XCDB2, 0XCD91, 0XD5B2,
-  0XDE14, 0XDE56, 0XDE76, 0XDE76, 0XDE97, 0XDEB8, 0XDEB8, 0XDED8,
-  0XDED8, 0XDE98, 0XE6D9, 0XE71A, 0XE73A, 0XE73A, 0XE71A, 0XE6FA,
-  0XE6FA, 0XE6FA, 0XE71B, 0XE71B, 0XE6BA, 0XE6FB, 0XE71B, 0XE6BA,
-  0XE67A, 0XE6BB, 0XE6DB, 0XDE59, 0XDE38, 0XDE7A, 0XD659, 0XCE18,
-  0XD69A, 0XCE79, 0XBDF7, 0XAD55, 0XA4F4, 0XA514, 0X9491, 0X73CF,
-  0X6B6F, 0X52AB, 0X31A6, 0X1082, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0840, 0X2102, 0X39C5, 0X4A68,
-  0X630A, 0X736D, 0X7BEF, 0X9492, 0XA514, 0XADB7, 0XC639, 0XCE9B,
-  0XCE59, 0XD639, 0XDEBB, 0XDEDC, 0XDEDB, 0XDEFB, 0XE71C, 0XE71C,
-  0XDEBB, 0XDE7A, 0XE6DB, 0XE6FC, 0XE6FC, 0XDE79, 0XE6BA, 0XE71C,
-  0XE71C, 0XE6DB, 0XDE79, 0XDE59, 0XDE79, 0XDE78, 0XD573, 0XD4D0,
-  0XE616, 0XDE37, 0XDDF5, 0XD5F5, 0XDDF5, 0XDE57, 0XDE36, 0XD615,
-  0XD5F4, 0XCDB3, 0XCD93, 0XC552, 0XC511, 0XBCF0, 0XBCCF, 0XBC8E,
-  0XB46E, 0XB44D, 0XB3EC, 0XABCB, 0XABEC, 0XABCB, 0XA36A, 0XA329,
-  0X9B08, 0X9AC8, 0X92A7, 0X92A7, 0X9286, 0X8A46, 0X8A46, 0X8A25,
-  0X8A25, 0X8A25, 0X8A26, 0X8A25, 0X8205, 0X81E4, 0X81C4, 0X79A4,
-  0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7102, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X7102, 0X7102, 0X7122, 0X7142, 0X7142,
-  0X7963, 0X7983, 0X81A3, 0X81A3, 0X81C4, 0X8A05, 0X8A45, 0X9266,
-  0X9286, 0X92A6, 0X92A6, 0X9AE7, 0XA328, 0XA348, 0XA369, 0XA369,
-  0XABAA, 0XAC0C, 0XAC2C, 0XB44D, 0XB48E, 0XBCCE, 0XBCCF, 0XBCEF,
-  0XBCEF, 0XBCCE, 0XC4AD, 0XC50F, 0XCD51, 0XCD50, 0XCD71, 0XCDB2,
-  0XD5D3, 0XDE34, 0XDE55, 0XDE55, 0XD676, 0XDE76, 0XDEB7, 0XDED8,
-  0XDEB7, 0XDE76, 0XE6B7, 0XE6F8, 0XE71A, 0XDF1A, 0XDEF9, 0XE6FA,
-  0XE71B, 0XE71A, 0XE73B, 0XE6FB, 0XE6DA, 0XEF1C, 0XE71B, 0XEEFB,
-  0XE6BA, 0XE6DB, 0XE6FB, 0XE6BA, 0XDE18, 0XDE39, 0XDEDA, 0XD638,
-  0XD639, 0XCE38, 0XBD96, 0XBDF8, 0XBE19, 0XBDD8, 0XA535, 0X8451,
-  0X8410, 0X8411, 0X6B6E, 0X52AA, 0X3185, 0X2103, 0X0861, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0820, 0X1081, 0X2923, 0X41E6, 0X5268, 0X62CA, 0X6B4C,
-  0X7BAE, 0X8C71, 0X9CD3, 0XAD35, 0XBDB7, 0XC659, 0XCE7A, 0XD6BB,
-  0XDEDC, 0XDE9A, 0XE6DD, 0XE73E, 0XE71C, 0XDEDB, 0XE73C, 0XEF5D,
-  0XDEBB, 0XDE9A, 0XE71C, 0XE6FC, 0XE6DB, 0XE6BB, 0XDE99, 0XE6FB,
-  0XE73C, 0XE71B, 0XDE9A, 0XDE79, 0XDE78, 0XDE99, 0XE699, 0XD594,
-  0XD511, 0XDD74, 0XD573, 0XD573, 0XD5B4, 0XD5D5, 0XD5F5, 0XD5F5,
-  0XD5D4, 0XCDB3, 0XCD73, 0XC552, 0XC510, 0XBCF0, 0XBCAF, 0XB44E,
-  0XB44D, 0XB42D, 0XB40C, 0XB3EC, 0XABEC, 0XABEC, 0XA36A, 0X9AE8,
-  0X9AE8, 0X9AC7, 0X92A7, 0X9287, 0X9287, 0X8A66, 0X8A46, 0X8A46,
-  0X8A46, 0X8A05, 0X89E4, 0X8A05, 0X8205, 0X81C4, 0X81A4, 0X79A4,
-  0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7142,
-  0X7963, 0X7983, 0X7983, 0X7983, 0X81C4, 0X8A04, 0X8A25, 0X9266,
-  0X9286, 0X9286, 0X92A6, 0X9AE7, 0X9B28, 0XA348, 0XA328, 0XA328,
-  0XAB6A, 0XABEB, 0XAC2C, 0XAC4D, 0XB46D, 0XBCAE, 0XBCCF, 0XBCCF,
-  0XBCCE, 0XBCAD, 0XC4AE, 0XC4EE, 0XC4CD, 0XCCEF, 0XCD92, 0XD5D2,
-  0XD5B2, 0XD5D2, 0XDE34, 0XD676, 0XD655, 0XD675, 0XDE76, 0XDE96,
-  0XDE76, 0XDE56, 0XDE97, 0XE6D8, 0XE719, 0XE6D8, 0XDE98, 0XE71A,
-  0XE73A, 0XE6FA, 0XE71B, 0XE73B, 0XE6DA, 0XE6FB, 0XE71B, 0XEF1C,
-  0XE71C, 0XE6FB, 0XE6FB, 0XE6DB, 0XE6FB, 0XDE9A, 0XE6BA, 0XE6BA,
-  0XD5F7, 0XCE38, 0XCE59, 0XD67A, 0XCE5A, 0XC67A, 0XB5F8, 0X9CF3,
-  0X9451, 0X9452, 0X8C52, 0X7BCF, 0X6B0B, 0X62CA, 0X4207, 0X2944,
-  0X18A2, 0X0820, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X1060,
-  0X20C1, 0X3143, 0X41E5, 0X5A88, 0X62EB, 0X6B0B, 0X7B6E, 0X8410,
-  0X9492, 0XAD14, 0XB575, 0XBDB7, 0XCE39, 0XD67A, 0XD69B, 0XDEDC,
-  0XEF5D, 0XE6DC, 0XDEBB, 0XE73D, 0XE73D, 0XE6FC, 0XE6FB, 0XEF5D,
-  0XE6DB, 0XE6FB, 0XE71C, 0XE71C, 0XDEDB, 0XDEDB, 0XDEDA, 0XDE98,
-  0XE6B9, 0XE6DA, 0XE6BA, 0XE6BA, 0XDE99, 0XDE78, 0XDE99, 0XDEB9,
-  0XD594, 0XCC6E, 0XCCD0, 0XD553, 0XD593, 0XCD93, 0XCD73, 0XCD93,
-  0XCD93, 0XCD73, 0XCD73, 0XCD72, 0XC531, 0XBCCF, 0XBC8E, 0XB44E,
-  0XB44D, 0XB42D, 0XAC0C, 0XABEC, 0XABCB, 0XABCB, 0XA3AB, 0X9B08,
-  0X92A7, 0X9AA7, 0X9AA7, 0X9287, 0X9266, 0X8A46, 0X8A46, 0X8A46,
-  0X8A46, 0X8A25, 0X8A05, 0X81C4, 0X81C4, 0X81C4, 0X79A4, 0X7983,
-  0X7983, 0X7963, 0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7102, 0X7122, 0X7142,
-  0X7942, 0X7963, 0X7983, 0X7983, 0X81C4, 0X81E4, 0X8A25, 0X8A45,
-  0X9265, 0X9265, 0X9286, 0X9AE7, 0X9B08, 0XA328, 0XA328, 0XA328,
-  0XAB6A, 0XA3AA, 0XAC0C, 0XAC2C, 0XB46D, 0XB48E, 0XB4CF, 0XBCEF,
-  0XBCAD, 0XBC8D, 0XC4AD, 0XC4AD, 0XC4CE, 0XCD30, 0XCD71, 0XCD91,
-  0XD5D2, 0XD5D2, 0XD614, 0XD675, 0XDE75, 0XDE75, 0XD656, 0XDE76,
-  0XDE97, 0XDE76, 0XDE14, 0XDE75, 0XE6B7, 0XE6B7, 0XE6D8, 0XE6F9,
-  0XE6F9, 0XE6D9, 0XE71B, 0XE71A, 0XE6DA, 0XE6DB, 0XEF1B, 0XEF3C,
-  0XEF7D, 0XE6FB, 0XE6DB, 0XEF1C, 0XEF3C, 0XE73C, 0XE6DA, 0XDDB6,
-  0XDDD7, 0XD69A, 0XDEBB, 0XDEDC, 0XD69B, 0XC67A, 0XBE79, 0XB5D7,
-  0XAD34, 0XAD55, 0X9CD3, 0X8C51, 0X83CF, 0X838E, 0X7B8E, 0X632C,
-  0X528A, 0X41E8, 0X3185, 0X2103, 0X1081, 0X0841, 0X0020, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0020, 0X0840, 0X1081, 0X18C2, 0X2903, 0X3144, 0X41A5,
-  0X4A27, 0X5A89, 0X6B0B, 0X734D, 0X7BAE, 0X8C10, 0X9493, 0XA4F4,
-  0XAD35, 0XBDD7, 0XC619, 0XCE18, 0XD639, 0XD67B, 0XDEFC, 0XE75D,
-  0XE75D, 0XDEDB, 0XDE59, 0XE6FC, 0XE73D, 0XEF7D, 0XE71C, 0XE73C,
-  0XE6FC, 0XE73D, 0XEF5D, 0XE73D, 0XE73C, 0XE71B, 0XE71B, 0XE6DA,
-  0XE678, 0XE699, 0XE6FA, 0XE71A, 0XDED9, 0XDE58, 0XDE58, 0XDE78,
-  0XDE58, 0XD532, 0XC46E, 0XD552, 0XD573, 0XCD93, 0XCD73, 0XCD52,
-  0XCD52, 0XCD32, 0XCD52, 0XC551, 0XC511, 0XBCCF, 0XBC8E, 0XB48E,
-  0XB46E, 0XB42D, 0XAC0C, 0XABCB, 0XABAB, 0XA349, 0XA349, 0X9B08,
-  0X9AA7, 0X9AA7, 0X9287, 0X9266, 0X8A45, 0X8A25, 0X8A26, 0X8A25,
-  0X8A25, 0X8A46, 0X8A25, 0X81E4, 0X81A3, 0X7983, 0X79A3, 0X7983,
-  0X7963, 0X7163, 0X7142, 0X7122, 0X7102, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7142, 0X7962, 0X7983, 0X7983, 0X81A3, 0X81E4, 0X8204, 0X8A25,
-  0X9245, 0X9245, 0X9265, 0X92A6, 0X9B08, 0XA328, 0X9AE7, 0XA308,
-  0XA349, 0XA369, 0XABAB, 0XABEB, 0XABEB, 0XB44D, 0XB4AD, 0XBCAD,
-  0XBC4B, 0XBC2B, 0XBC6C, 0XC4CE, 0XCD51, 0XCD71, 0XCD71, 0XCD91,
-  0XCDD2, 0XCDB1, 0XD5F3, 0XD635, 0XDE35, 0XDE55, 0XD676, 0XDE76,
-  0XDE96, 0XDE76, 0XDE14, 0XD614, 0XDE76, 0XE6D9, 0XE71A, 0XE6FA,
-  0XE6D8, 0XE6D8, 0XE6D9, 0XE698, 0XE6DA, 0XE71B, 0XEEFB, 0XEF1C,
-  0XEEDA, 0XEEBA, 0XE6FC, 0XE71C, 0XEF3D, 0XEF1B, 0XE699, 0XDDB6,
-  0XE659, 0XDEFB, 0XDEDB, 0XDEDB, 0XD6DB, 0XCE9A, 0XCE9A, 0XC659,
-  0XBDD7, 0XBDB7, 0XB555, 0XAD76, 0X9CD3, 0X8C50, 0X8C51, 0X8C51,
-  0X8410, 0X7BEF, 0X736D, 0X6B0B, 0X5269, 0X4A28, 0X4207, 0X39A6,
-  0X3185, 0X2944, 0X2103, 0X20C3, 0X20E3, 0X2103, 0X2103, 0X2924,
-  0X3144, 0X3985, 0X41E6, 0X4A06, 0X5248, 0X5AA9, 0X6ACB, 0X72EC,
-  0X736D, 0X7BCF, 0X8411, 0X9472, 0X9CD4, 0XA514, 0XB596, 0XBDB7,
-  0XBDD7, 0XCE39, 0XD67A, 0XCE59, 0XD67A, 0XDEDC, 0XE73D, 0XE73D,
-  0XE73D, 0XE71C, 0XDE59, 0XDE7A, 0XE6FC, 0XE71C, 0XE75D, 0XE6FC,
-  0XDEBA, 0XEF5D, 0XEF7D, 0XEF5C, 0XEF5C, 0XE73C, 0XE6FB, 0XE71B,
-  0XE6D9, 0XE678, 0XE6DA, 0XE71A, 0XE6F9, 0XDE98, 0XDE57, 0XD636,
-  0XD637, 0XDE37, 0XCCAF, 0XCC4C, 0XD593, 0XCDB4, 0XCD93, 0XCD52,
-  0XCD31, 0XC531, 0XC531, 0XC510, 0XC4F0, 0XBCCF, 0XBC8E, 0XBC8E,
-  0XB46E, 0XB42D, 0XABEC, 0XABAB, 0XABCB, 0XA36A, 0XA329, 0X9AE8,
-  0X9AE8, 0X9AE8, 0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8A05, 0X8A05,
-  0X8A05, 0X8A05, 0X8205, 0X8205, 0X81C4, 0X7983, 0X7963, 0X7963,
-  0X7963, 0X7142, 0X7142, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122,
-  0X7122, 0X7942, 0X7963, 0X7963, 0X8183, 0X81C4, 0X8204, 0X8A04,
-  0X8A25, 0X9225, 0X9245, 0X9286, 0X9AC7, 0X9AE7, 0X9AE7, 0X9B07,
-  0XA348, 0XA348, 0XA349, 0XAB6A, 0XAB69, 0XABAA, 0XB3CA, 0XB3CA,
-  0XB3CA, 0XBC2C, 0XBCCE, 0XC530, 0XCD50, 0XCD71, 0XC571, 0XC592,
-  0XCDF3, 0XCDB2, 0XCDD2, 0XD614, 0XD614, 0XD634, 0XD655, 0XDE96,
-  0XD676, 0XDE76, 0XDE76, 0XDE56, 0XDEB8, 0XE6B9, 0XE6F9, 0XE6F9,
-  0XE6B8, 0XE6D8, 0XDEF9, 0XDE99, 0XE6B9, 0XE6DA, 0XE679, 0XE69A,
-  0XE6BA, 0XE6DB, 0XE6FC, 0XE6FC, 0XEEFB, 0XE679, 0XE69A, 0XEF1C,
-  0XE6BA, 0XE6BA, 0XDEBB, 0XDEBA, 0XDEDB, 0XD6BB, 0XD69A, 0XD6BB,
-  0XCE38, 0XBDB6, 0XC639, 0XC639, 0XBDF7, 0XAD75, 0XA534, 0XA555,
-  0XA535, 0XA4F4, 0X9CD3, 0X9472, 0X8C30, 0X842F, 0X83EF, 0X83AE,
-  0X7BAD, 0X736D, 0X6B2C, 0X6B0B, 0X62EB, 0X62CA, 0X62EB, 0X6B2C,
-  0X734C, 0X736D, 0X7B8E, 0X838E, 0X7BAE, 0X83F0, 0X8C10, 0X8C10,
-  0X9C72, 0XA514, 0XAD76, 0XB5D7, 0XBE18, 0XC619, 0XCE59, 0XD67A,
-  0XD67A, 0XD67A, 0XCDF9, 0XD5F9, 0XDEBB, 0XDEDC, 0XE71C, 0XE75D,
-  0XE75D, 0XEF7E, 0XE6FB, 0XDEB9, 0XE6DC, 0XE6DC, 0XE6FC, 0XDE9A,
-  0XDE99, 0XEF3C, 0XEF7D, 0XEF3C, 0XEF3C, 0XEF3C, 0XE71B, 0XE6FA,
-  0XE6FA, 0XE699, 0XE698, 0XE6DA, 0XE6D9, 0XDEB8, 0XDE57, 0XD616,
-  0XD616, 0XDE36, 0XD573, 0XC42C, 0XCCAF, 0XD5D4, 0XCDB3, 0XC552,
-  0XC510, 0XC531, 0XC511, 0XC4F0, 0XBCD0, 0XBCCF, 0XBCAF, 0XBC6E,
-  0XB44D, 0XB42D, 0XAC0C, 0XABCB, 0XABCB, 0XABAB, 0XA349, 0X9B08,
-  0X9AE8, 0X9AE8, 0X92A7, 0X92A7, 0X9287, 0X8A46, 0X8205, 0X81E4,
-  0X81E5, 0X81E5, 0X81E4, 0X81E4, 0X81C4, 0X79A4, 0X7963, 0X7942,
-  0X7143, 0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122,
-  0X7122, 0X7122, 0X7942, 0X7962, 0X7983, 0X81A3, 0X81C4, 0X89E4,
-  0X8A05, 0X8A04, 0X9225, 0X9245, 0X92A6, 0X9AC7, 0X9AA6, 0X9AE7,
-  0XA307, 0X9AE7, 0XA2E7, 0XA2E7, 0XA2E7, 0X9AC7, 0XA2E7, 0XAB8A,
-  0XB46D, 0XBCAE, 0XC510, 0XC550, 0XC550, 0XCD71, 0XCD91, 0XC592,
-  0XCDD4, 0XCDD2, 0XC570, 0XCDD2, 0XD5F3, 0XD5F3, 0XD613, 0XD635,
-  0XD635, 0XD656, 0XDE76, 0XDE56, 0XDE77, 0XE6B8, 0XE6D9, 0XE697,
-  0XE698, 0XE71B, 0XDEFA, 0XDE37, 0XDE17, 0XDE58, 0XE699, 0XE6D9,
-  0XE71B, 0XE73B, 0XE6FA, 0XE679, 0XE69A, 0XE6FB, 0XEF3C, 0XEF1C,
-  0XE6FB, 0XDE9A, 0XDE9A, 0XDEDB, 0XDEDB, 0XDEBB, 0XD679, 0XD69A,
-  0XD619, 0XCE19, 0XD69A, 0XCE7A, 0XC638, 0XC618, 0XC5F8, 0XC639,
-  0XC659, 0XC639, 0XBE18, 0XBDD7, 0XB575, 0XAD55, 0XAD34, 0XA513,
-  0X9CD3, 0X9CD2, 0X9491, 0X9491, 0X9471, 0X8410, 0X83EF, 0X8C10,
-  0X9CD3, 0X9CD3, 0XA4B2, 0XA4F3, 0XA575, 0XAD55, 0XAD14, 0XB555,
-  0XB555, 0XC5B7, 0XCEBB, 0XDF1C, 0XDF5D, 0XE75D, 0XE75D, 0XE73D,
-  0XE71C, 0XE6FC, 0XDE19, 0XD537, 0XDE7B, 0XDF1C, 0XE73D, 0XEF7E,
-  0XEF7E, 0XEF5E, 0XE73C, 0XDEB9, 0XE6FB, 0XE71C, 0XE6FB, 0XDE9A,
-  0XDEBA, 0XE6DB, 0XEF1C, 0XEF3C, 0XEF5C, 0XEF3C, 0XE6FB, 0XE6B9,
-  0XE6B9, 0XE6FA, 0XDE78, 0XDE78, 0XE6D9, 0XE6B8, 0XDE56, 0XD5F5,
-  0XD5F5, 0XDE16, 0XD5B4, 0XCD11, 0XC44E, 0XCCF0, 0XD5B3, 0XCD72,
-  0XC531, 0XC510, 0XC510, 0XC4F0, 0XBCAF, 0XBC8E, 0XBC8E, 0XBC6E,
-  0XB42D, 0XAC2D, 0XAC0C, 0XABEC, 0XABAB, 0XA36A, 0XA329, 0X9AE8,
-  0X9B08, 0X9AE8, 0X92C7, 0X92A7, 0X9287, 0X8A66, 0X8225, 0X81E5,
-  0X81E4, 0X81C4, 0X81C4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122,
-  0X7122, 0X7122, 0X7942, 0X7962, 0X7962, 0X7983, 0X81C3, 0X81E4,
-  0X8A04, 0X8A04, 0X8A04, 0X9245, 0X9286, 0X9AC7, 0X9285, 0X9285,
-  0X9285, 0X9A65, 0X9A45, 0X9224, 0X9A45, 0X9A87, 0XA329, 0XB40C,
-  0XB48E, 0XBCAF, 0XBCF0, 0XC530, 0XC550, 0XCD51, 0XCD71, 0XCD91,
-  0XCD71, 0XCD91, 0XCD91, 0XCDB2, 0XCDD2, 0XD5D3, 0XD5F3, 0XD5F4,
-  0XD5F4, 0XD614, 0XD655, 0XD636, 0XDE36, 0XDEB8, 0XE6B8, 0XE697,
-  0XE6D9, 0XDEB8, 0XDE36, 0XDE16, 0XDE98, 0XDED9, 0XE6FA, 0XE699,
-  0XE699, 0XEEB9, 0XE658, 0XE618, 0XEEFB, 0XEF5D, 0XEF3C, 0XE71C,
-  0XE6FC, 0XE6FB, 0XDE9A, 0XD679, 0XD679, 0XD679, 0XCDF7, 0XD618,
-  0XD67B, 0XDEBB, 0XDEBB, 0XD69A, 0XD69A, 0XD69A, 0XCE59, 0XD67A,
-  0XDF1C, 0XDF1D, 0XDF1C, 0XD6FB, 0XCEBA, 0XCE9A, 0XC659, 0XC638,
-  0XBE38, 0XBE18, 0XC5F8, 0XB576, 0XAD14, 0XA514, 0XA4D4, 0XAD55,
-  0XBDF7, 0XBDB7, 0XBD96, 0XBDB6, 0XCE38, 0XCE18, 0XCE7A, 0XDEFC,
-  0XDEBB, 0XD638, 0XDEDC, 0XEFFF, 0XF7FF, 0XEFDF, 0XEF7E, 0XEF7E,
-  0XEF5D, 0XE73D, 0XEEBC, 0XD515, 0XD5D8, 0XDEDB, 0XE73D, 0XEF9F,
-  0XE79E, 0XE75D, 0XE75D, 0XDEBA, 0XE6DB, 0XE75D, 0XE73C, 0XDEDB,
-  0XDEDA, 0XE71B, 0XE73B, 0XEF3C, 0XEF1B, 0XEF1B, 0XE6FA, 0XE6B9,
-  0XDEB9, 0XE6B8, 0XE698, 0XDE16, 0XE677, 0XE6B8, 0XDE97, 0XD5F5,
-  0XD5D5, 0XD615, 0XD5B4, 0XCD32, 0XCCF1, 0XC42D, 0XCCF0, 0XCD72,
-  0XC531, 0XC4F0, 0XC4CF, 0XBCAF, 0XBC8E, 0XBC6E, 0XB44D, 0XB44D,
-  0XB42C, 0XAC0C, 0XABEC, 0XABEC, 0XABAB, 0XA329, 0X9AC8, 0X9AC8,
-  0X9B08, 0X9AE8, 0X92C7, 0X9286, 0X8A46, 0X8A46, 0X8A25, 0X8205,
-  0X81E4, 0X81C4, 0X79A4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7142,
-  0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7102,
-  0X7122, 0X7122, 0X7922, 0X7942, 0X7962, 0X7962, 0X81A3, 0X81C4,
-  0X89E4, 0X89E4, 0X8A04, 0X9245, 0X9266, 0X9285, 0X9244, 0X9224,
-  0X9245, 0X9245, 0X9204, 0X9204, 0X9A45, 0XA2A7, 0XAB4A, 0XB40C,
-  0XB46D, 0XBCAF, 0XBCF0, 0XC550, 0XC550, 0XCD50, 0XCD51, 0XCD71,
-  0XC551, 0XCD51, 0XCDB2, 0XCDB1, 0XD5B2, 0XCDB2, 0XCDF3, 0XCE15,
-  0XD655, 0XD635, 0XD614, 0XD636, 0XD676, 0XDE97, 0XDE77, 0XDE77,
-  0XDE97, 0XDE35, 0XDE16, 0XDE99, 0XDEB9, 0XDEB9, 0XDE78, 0XE617,
-  0XDE58, 0XDE58, 0XDE38, 0XE67A, 0XE6DB, 0XE6FB, 0XE6FB, 0XE6DB,
-  0XDEDB, 0XDEFB, 0XDEDB, 0XD639, 0XD67A, 0XD6DB, 0XD65A, 0XD63A,
-  0XDEDC, 0XE71C, 0XE6FC, 0XDE9A, 0XDEBB, 0XDEFC, 0XDEFB, 0XDE9A,
-  0XDE59, 0XDEBA, 0XE71C, 0XE71C, 0XE71C, 0XDEFB, 0XDEDB, 0XDF1C,
-  0XDEDA, 0XD679, 0XDE9A, 0XCE18, 0XC5D7, 0XCDF7, 0XCE38, 0XD6BB,
-  0XDEDB, 0XD6BB, 0XDEDB, 0XDEBA, 0XD659, 0XD639, 0XE73D, 0XEFDF,
-  0XEFBE, 0XEF1C, 0XDE9B, 0XE73D, 0XF7BF, 0XF79E, 0XEF5D, 0XEF7D,
-  0XEF5D, 0XEF5E, 0XEF1D, 0XD515, 0XDD76, 0XEEBB, 0XE73C, 0XEF9E,
-  0XE79E, 0XE75D, 0XEF5D, 0XE71B, 0XDEBA, 0XEF3C, 0XE73C, 0XDEDA,
-  0XDE99, 0XE6FA, 0XEF1B, 0XEF5C, 0XE71A, 0XE6DA, 0XE6FA, 0XE6FA,
-  0XE6D9, 0XDE98, 0XDE77, 0XDE37, 0XDDF4, 0XDE15, 0XDE97, 0XDE56,
-  0XD5D4, 0XD5D4, 0XD593, 0XCD11, 0XD552, 0XCCF0, 0XC42C, 0XC4F0,
-  0XC531, 0XC511, 0XBCD0, 0XBC8E, 0XBC4D, 0XBC4E, 0XB42D, 0XB40C,
-  0XAC0C, 0XAC0C, 0XABEC, 0XABCB, 0XA3AB, 0XA34A, 0X9AA8, 0X9AA7,
-  0X9AC8, 0X92A7, 0X9287, 0X9246, 0X8A25, 0X8A25, 0X8A25, 0X8205,
-  0X81E4, 0X81C4, 0X7983, 0X7983, 0X7963, 0X7162, 0X7142, 0X7122,
-  0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7122, 0X7122, 0X7922, 0X7942, 0X7962, 0X8183, 0X81A3,
-  0X81C4, 0X89E4, 0X8A04, 0X9204, 0X9225, 0X9225, 0X9204, 0X9204,
-  0X9224, 0X9225, 0X9225, 0X9204, 0X9A66, 0XA2C7, 0X9AC8, 0XAB8B,
-  0XB42D, 0XB48E, 0XBCCF, 0XC530, 0XC530, 0XC550, 0XC550, 0XC571,
-  0XCD72, 0XCD91, 0XCD91, 0XCD51, 0XCD91, 0XCDD3, 0XCDF4, 0XCE14,
-  0XD635, 0XD656, 0XD636, 0XD656, 0XD697, 0XDE97, 0XDE97, 0XDEB8,
-  0XDE98, 0XDE98, 0XDE77, 0XDE17, 0XDE16, 0XDDF6, 0XDDD6, 0XDDF6,
-  0XDE58, 0XDE59, 0XDE9A, 0XDE9A, 0XDEBA, 0XDE9A, 0XDE9A, 0XDE9A,
-  0XDEBA, 0XE6FB, 0XDEBA, 0XDEBB, 0XDEFC, 0XDF1C, 0XE71C, 0XDE9A,
-  0XD659, 0XE6FC, 0XE73C, 0XDEBB, 0XDEBA, 0XDE9A, 0XD639, 0XE6DC,
-  0XE6DC, 0XDEBB, 0XE6DC, 0XE6BB, 0XE6FC, 0XE71C, 0XDEDB, 0XDE79,
-  0XDE79, 0XE6DB, 0XE73D, 0XDF1B, 0XDEDB, 0XDEFB, 0XE71C, 0XE73C,
-  0XE75D, 0XEF7E, 0XEF9E, 0XEF7E, 0XEF9E, 0XE75D, 0XE71C, 0XF7BF,
-  0XF7FF, 0XF7BF, 0XE71C, 0XDE59, 0XDE59, 0XDE9B, 0XDEBA, 0XDE9A,
-  0XE6BB, 0XF73E, 0XEEFC, 0XCC93, 0XD535, 0XE6DB, 0XE71C, 0XE75D,
-  0XEF9E, 0XEF9E, 0XEF5D, 0XEF5D, 0XE6FB, 0XEF1C, 0XE73C, 0XDE99,
-  0XE679, 0XE6DA, 0XE6FA, 0XE71B, 0XE71A, 0XE6FA, 0XE6DA, 0XE6D9,
-  0XE6B8, 0XE6B8, 0XE698, 0XDE77, 0XDE15, 0XD592, 0XDDF4, 0XDE15,
-  0XD5D3, 0XD5B3, 0XCD52, 0XCCF1, 0XD552, 0XD5B3, 0XC4CF, 0XC44D,
-  0XCCEF, 0XC4F0, 0XC4CF, 0XBC8E, 0XBC4D, 0XBC6D, 0XBC6E, 0XB40C,
-  0XABAA, 0XABEB, 0XABEC, 0XABCB, 0XA38A, 0X9B29, 0X9AE8, 0X9AA7,
-  0X9287, 0X9287, 0X9266, 0X8A46, 0X8A25, 0X8A25, 0X8A05, 0X81E4,
-  0X81E4, 0X79A4, 0X7983, 0X7963, 0X7943, 0X7142, 0X7142, 0X7122,
-  0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7122, 0X7122, 0X7122, 0X7122, 0X7942, 0X7962, 0X7963, 0X8183,
-  0X81C4, 0X8A04, 0X8A04, 0X89E4, 0X9204, 0X9225, 0X9204, 0X89C3,
-  0X89C3, 0X9A66, 0X9A45, 0X9204, 0X9AC7, 0XA308, 0X9AA6, 0XA349,
-  0XB40C, 0XB48E, 0XBCCF, 0XC510, 0XC510, 0XC530, 0XC550, 0XCD71,
-  0XCD92, 0XC592, 0XCDB2, 0XD5B2, 0XCDB2, 0XD5D4, 0XD5F5, 0XCDF4,
-  0XCE14, 0XCE35, 0XD656, 0XD677, 0XD6B7, 0XDE97, 0XDEB8, 0XDED9,
-  0XDED9, 0XE6B8, 0XDE97, 0XDE36, 0XDDF5, 0XDE17, 0XDE37, 0XDE37,
-  0XDE38, 0XD679, 0XDE99, 0XDE79, 0XD679, 0XD679, 0XD658, 0XDE59,
-  0XDE79, 0XDEBA, 0XDEBA, 0XE71C, 0XDF3D, 0XDF1C, 0XDF1D, 0XDEFC,
-  0XD618, 0XDE7A, 0XE75D, 0XE71C, 0XDEBA, 0XDE9B, 0XCDB7, 0XDE7A,
-  0XF7DF, 0XEFDF, 0XEFBF, 0XE75C, 0XEF3D, 0XEF9F, 0XE75D, 0XE71C,
-  0XE73D, 0XEF9E, 0XEFBE, 0XF7DE, 0XEFBE, 0XF79E, 0XF7BE, 0XEFBE,
-  0XEFBE, 0XF7BE, 0XF77E, 0XEF5D, 0XEF9E, 0XF7DF, 0XEF3C, 0XEF1C,
-  0XFFBF, 0XEF9E, 0XE71C, 0XDE9B, 0XE6DC, 0XE6FC, 0XE71C, 0XDEDB,
-  0XE6FC, 0XEF1D, 0XE619, 0XC3D0, 0XD576, 0XDEFB, 0XDEDB, 0XE699,
-  0XDE9A, 0XE6DB, 0XEEFB, 0XE6DB, 0XDE79, 0XE6DA, 0XEF1B, 0XE699,
-  0XE699, 0XE6FB, 0XE6DA, 0XE6DA, 0XE71A, 0XE71A, 0XE6FA, 0XE6B9,
-  0XE6B8, 0XE698, 0XDE97, 0XDE57, 0XDE16, 0XD5B4, 0XD593, 0XD592,
-  0XD572, 0XDDB4, 0XCD31, 0XCD11, 0XCD52, 0XCD72, 0XCD72, 0XBC8D,
-  0XBC4C, 0XC4AF, 0XBC8E, 0XBC4D, 0XB42D, 0XB42C, 0XB42D, 0XB40C,
-  0XABCB, 0XABAB, 0XA3AB, 0XA3AB, 0XA36A, 0X9B08, 0X9AC8, 0X9AC7,
-  0X92A7, 0X9266, 0X9266, 0X8A45, 0X8A25, 0X8A05, 0X81E5, 0X81C4,
-  0X81C4, 0X79A3, 0X7963, 0X7963, 0X7142, 0X7142, 0X7142, 0X7122,
-  0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7102, 0X7122, 0X7122, 0X7122, 0X7942, 0X7962, 0X7963, 0X8183,
-  0X81C4, 0X89E4, 0X89E4, 0X89E4, 0X8A04, 0X9205, 0X9204, 0X89E4,
-  0X91C4, 0X9A45, 0X9245, 0X9224, 0XA308, 0XAB29, 0X9AA6, 0X9B09,
-  0XABCB, 0XB44D, 0XBC8E, 0XBCEF, 0XBD0F, 0XC510, 0XCD50, 0XCD50,
-  0XC571, 0XC571, 0XCDB2, 0XD5F3, 0XD5D3, 0XD5B3, 0XD5D3, 0XD5F4,
-  0XCE15, 0XCE15, 0XD635, 0XD656, 0XD677, 0XD656, 0XD677, 0XDE98,
-  0XDE97, 0XE697, 0XDE97, 0XDE15, 0XDE15, 0XDE98, 0XDE79, 0XDE98,
-  0XDE98, 0XD679, 0XDE99, 0XD679, 0XD658, 0XD678, 0XD659, 0XDE7A,
-  0XE6DB, 0XDEBA, 0XDE99, 0XE6FC, 0XE73C, 0XDEFC, 0XE6FC, 0XE71C,
-  0XDE59, 0XD619, 0XEF1C, 0XE71B, 0XE6FC, 0XE75D, 0XD5B6, 0XDE39,
-  0XF7BF, 0XEFDF, 0XEFFF, 0XEF7D, 0XEEFB, 0XF79E, 0XF7FF, 0XF7DF,
-  0XF7FF, 0XF7FF, 0XF7BE, 0XF7DF, 0XF7FF, 0XF7DF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XF7DF, 0XEF3C, 0XEF1C, 0XEF9E, 0XEF5D, 0XE6BA,
-  0XEF3D, 0XFFDF, 0XEF5D, 0XE6DC, 0XEF5E, 0XEF7F, 0XEF7E, 0XEF5D,
-  0XEF5D, 0XEF7F, 0XD576, 0XCBD0, 0XDD97, 0XDE59, 0XDDF7, 0XDDD7,
-  0XD5F8, 0XDE59, 0XDE38, 0XE638, 0XDE37, 0XD5F7, 0XDE59, 0XE658,
-  0XE658, 0XE6DA, 0XE6FA, 0XE6FA, 0XE71A, 0XE6FA, 0XE6F9, 0XE6F9,
-  0XE6D9, 0XE6D8, 0XDE97, 0XDE36, 0XDDD5, 0XD5B4, 0XD5B4, 0XDDD4,
-  0XD553, 0XD552, 0XCD11, 0XCD31, 0XCD51, 0XCD31, 0XC551, 0XC510,
-  0XBC2C, 0XBC0C, 0XBC6E, 0XBC6E, 0XB42D, 0XB3EC, 0XB40C, 0XB40C,
-  0XAC0C, 0XABEB, 0XA3AB, 0XA36A, 0XA329, 0XA308, 0X9AC8, 0X92A7,
-  0X9AA7, 0X9287, 0X9266, 0X8A25, 0X8A05, 0X8A05, 0X81E4, 0X81A4,
-  0X79A3, 0X7983, 0X7963, 0X7142, 0X7142, 0X7142, 0X7142, 0X7122,
-  0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7122, 0X7122, 0X7122, 0X7942, 0X7963, 0X7983, 0X81A3,
-  0X81A4, 0X81C4, 0X89C4, 0X89E4, 0X8A05, 0X9245, 0X9225, 0X9205,
-  0X9225, 0X9225, 0X9225, 0X9225, 0XA2E8, 0XAB49, 0X9AE7, 0X9AE8,
-  0XAB49, 0XB3AA, 0XBC8E, 0XBCAE, 0XBCCF, 0XBCEF, 0XC50F, 0XC530,
-  0XC571, 0XCD71, 0XCD91, 0XCDD2, 0XD5D2, 0XD5B2, 0XD5B2, 0XCDD3,
-  0XD5F5, 0XD615, 0XD5F3, 0XD635, 0XD656, 0XD656, 0XD656, 0XD635,
-  0XD5F4, 0XDE15, 0XE697, 0XDE14, 0XDE15, 0XDE78, 0XDE78, 0XDEB9,
-  0XDEB9, 0XDEB9, 0XD699, 0XD699, 0XD699, 0XD699, 0XDEFB, 0XDF1C,
-  0XE73C, 0XDEFB, 0XDE99, 0XDEDB, 0XDEFB, 0XDEFB, 0XE73C, 0XE75C,
-  0XDEFA, 0XD659, 0XDE37, 0XE69A, 0XE6DB, 0XD5F6, 0XD515, 0XEEFD,
-  0XF7BF, 0XEFBF, 0XEFBE, 0XEF7D, 0XEF3C, 0XEF3C, 0XFFFF, 0XF7FF,
-  0XF7DF, 0XF7DF, 0XFFFF, 0XF7DF, 0XF79E, 0XF7DE, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XF7DE, 0XEF5C, 0XEF5D, 0XEF3D, 0XEF3D, 0XEF5D,
-  0XE71C, 0XEF3C, 0XEF3C, 0XEEFC, 0XF7BE, 0XF7DF, 0XF7BF, 0XF79E,
-  0XEF3D, 0XEF3D, 0XDD34, 0XDCD4, 0XE67A, 0XDE59, 0XDE59, 0XE6DB,
-  0XE6FC, 0XE71B, 0XE6DB, 0XDEBA, 0XE6FA, 0XDEB9, 0XDE78, 0XDE78,
-  0XE637, 0XE678, 0XEEDA, 0XE6FA, 0XEEFA, 0XE6FA, 0XE6D9, 0XE6D9,
-  0XE6D9, 0XE6B8, 0XDEB8, 0XDE36, 0XDDF5, 0XD5D4, 0XD593, 0XDDD4,
-  0XD5F4, 0XCD10, 0XCCCF, 0XCD31, 0XCD51, 0XC551, 0XC511, 0XC4F0,
-  0XC48E, 0XB3CB, 0XB3AB, 0XBC0C, 0XB44D, 0XB40C, 0XABEB, 0XAC0C,
-  0XABEC, 0XABCB, 0XA3AB, 0XA38A, 0XA329, 0X9AE8, 0X9AA7, 0X9266,
-  0X9287, 0X9287, 0X8A46, 0X8A25, 0X8A05, 0X81E4, 0X81A3, 0X7983,
-  0X7963, 0X7963, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7102, 0X7122, 0X7122, 0X7142, 0X7963, 0X7983, 0X81A3,
-  0X81A4, 0X81C4, 0X81C4, 0X89E4, 0X8A05, 0X9266, 0X9225, 0X9225,
-  0X9A86, 0X9225, 0X91E4, 0X9A66, 0XA308, 0XA348, 0XA348, 0X9AC7,
-  0XA2C7, 0XA2C7, 0XB3EC, 0XBC8E, 0XBCAE, 0XBCCF, 0XBCCE, 0XC50F,
-  0XC551, 0XCD51, 0XCD71, 0XD5D2, 0XD5D2, 0XCD91, 0XD550, 0XCD50,
-  0XCDD3, 0XCDD4, 0XC52F, 0XC4EF, 0XD615, 0XD635, 0XCDD3, 0XD614,
-  0XCD51, 0XD4F0, 0XDE16, 0XDE36, 0XDE97, 0XDE98, 0XDEB8, 0XDE98,
-  0XDEB9, 0XDEB9, 0XDE99, 0XDEBA, 0XD6D9, 0XD698, 0XDEDA, 0XE73C,
-  0XDF1B, 0XDE99, 0XDEDA, 0XE71C, 0XE71C, 0XE6FB, 0XE73C, 0XE73C,
-  0XE73C, 0XE71B, 0XDE78, 0XE5B6, 0XDD96, 0XDD97, 0XE6FD, 0XEFBF,
-  0XEFBE, 0XEFBE, 0XF7BE, 0XF7BE, 0XF7FF, 0XEF9D, 0XEF3C, 0XF7DE,
-  0XF7FF, 0XF7BE, 0XEFBE, 0XF7DF, 0XF7BE, 0XF7DF, 0XFFFF, 0XFFFF,
-  0XF7BE, 0XF79D, 0XF77C, 0XEF3B, 0XEF1C, 0XEF3D, 0XEF5E, 0XF79E,
-  0XF7DF, 0XE73C, 0XDE79, 0XEF1C, 0XF7DF, 0XF7DF, 0XEFFF, 0XF7DF,
-  0XEF7D, 0XEF3C, 0XDD15, 0XDD36, 0XEF1C, 0XE6FB, 0XE6DB, 0XE71C,
-  0XEF3C, 0XE6FB, 0XE6FB, 0XE73C, 0XE6FA, 0XDED9, 0XE6D9, 0XEF3C,
-  0XE6F9, 0XE657, 0XE637, 0XE698, 0XE6F9, 0XE6B8, 0XE6B8, 0XE6B8,
-  0XDE97, 0XDE77, 0XDE77, 0XDE36, 0XD5D4, 0XDDD5, 0XD572, 0XD571,
-  0XDDF4, 0XCD31, 0XC46D, 0XC4CF, 0XCD31, 0XC551, 0XC531, 0XC4F0,
-  0XBCAF, 0XBC8E, 0XB3EB, 0XB349, 0XB38A, 0XB3EC, 0XB3EB, 0XABAA,
-  0XABCB, 0XABCB, 0XA38A, 0XA36A, 0XA349, 0X9AE8, 0X9266, 0X9225,
-  0X9246, 0X9266, 0X8A46, 0X8A05, 0X81E5, 0X81A3, 0X7983, 0X7963,
-  0X7963, 0X7942, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7102,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7962, 0X7983, 0X79A3,
-  0X81A4, 0X81C4, 0X81E4, 0X89E4, 0X8A05, 0X9225, 0X9205, 0X9226,
-  0X9AA7, 0X9266, 0X91C4, 0X9A66, 0XA328, 0XA328, 0XAB69, 0XA2C7,
-  0X9A86, 0X9AC7, 0XA349, 0XB44D, 0XB48E, 0XB4AE, 0XB4AD, 0XBCCF,
-  0XC510, 0XCD30, 0XCD50, 0XCD91, 0XCDB2, 0XCD70, 0XCCAD, 0XCC2B,
-  0XCCCE, 0XCDD4, 0XC4AE, 0XBB48, 0XCD10, 0XCDD4, 0XCDB3, 0XD615,
-  0XCD30, 0XC44E, 0XDD94, 0XDE77, 0XDED9, 0XDEB8, 0XDEB8, 0XDEB9,
-  0XDED9, 0XDED9, 0XDEB9, 0XE6FA, 0XDEDA, 0XD6B9, 0XD6B9, 0XDEFB,
-  0XDF1B, 0XDE99, 0XDEBB, 0XDEFB, 0XE71B, 0XDEFB, 0XE6FB, 0XEF3C,
-  0XEF5C, 0XE71B, 0XE6DA, 0XDD95, 0XDCB3, 0XF71D, 0XF7FF, 0XF79E,
-  0XF7BE, 0XF7BE, 0XF7DF, 0XF7BE, 0XF7DF, 0XFFFF, 0XE6FA, 0XEF3B,
-  0XF7FF, 0XF7FF, 0XF7BE, 0XF7BD, 0XF7DE, 0XFFFF, 0XFFFF, 0XF7DE,
-  0XF7BD, 0XF77D, 0XF71B, 0XEEFB, 0XEF1C, 0XFFFF, 0XFFFF, 0XEF9E,
-  0XEFBF, 0XF7DE, 0XE6DA, 0XEF1C, 0XF7BF, 0XEFBF, 0XF7BE, 0XF7BE,
-  0XF79E, 0XEF7D, 0XE5D8, 0XDCD5, 0XE6BA, 0XDEFB, 0XEF3C, 0XEF3C,
-  0XE71C, 0XE71B, 0XE6DA, 0XE71B, 0XE71B, 0XE6DA, 0XDE98, 0XEF1B,
-  0XEF1A, 0XDEB8, 0XDE16, 0XDDF6, 0XE6B8, 0XDEB8, 0XDE98, 0XE698,
-  0XDE56, 0XDE56, 0XDE56, 0XD636, 0XD5D4, 0XDDD4, 0XD5D4, 0XCD31,
-  0XCCF0, 0XCCF0, 0XC4AF, 0XC4AF, 0XC511, 0XC551, 0XC510, 0XC4F0,
-  0XBCCF, 0XBC8E, 0XB46D, 0XB3CB, 0XAAE8, 0XAAE8, 0XAB6A, 0XAB8B,
-  0XAB8A, 0XABAA, 0XA369, 0XA329, 0X9B08, 0X9AA7, 0X9266, 0X8A25,
-  0X8A25, 0X8A25, 0X8A05, 0X81E4, 0X81A4, 0X7983, 0X7983, 0X7963,
-  0X7963, 0X7963, 0X7143, 0X7142, 0X7142, 0X7122, 0X7122, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7942, 0X7963, 0X7983,
-  0X81A3, 0X81C4, 0X81C4, 0X89E4, 0X8A05, 0X8A25, 0X8A05, 0X9225,
-  0X9A87, 0X9AA7, 0X9205, 0X9A66, 0XA308, 0XA328, 0XA369, 0XAB49,
-  0XAB28, 0XAB28, 0XA2E8, 0XABEC, 0XB46D, 0XB46D, 0XB46D, 0XBCAE,
-  0XC4EF, 0XC4EF, 0XCD30, 0XCD71, 0XCD91, 0XCD2F, 0XCC0A, 0XC389,
-  0XC3AA, 0XCD72, 0XC4CF, 0XBB48, 0XCC0B, 0XD593, 0XD615, 0XD5D4,
-  0XD551, 0XC4AF, 0XD594, 0XE697, 0XDEB8, 0XDE98, 0XDE98, 0XDEB9,
-  0XDED9, 0XDED9, 0XE6DA, 0XE6FA, 0XDEFA, 0XDEDA, 0XD699, 0XD699,
-  0XD698, 0XDEB9, 0XDEBA, 0XDF1B, 0XE75C, 0XE71B, 0XE71B, 0XEF3C,
-  0XEF5C, 0XE75C, 0XE6FB, 0XE6BA, 0XDD55, 0XDD76, 0XF77E, 0XF79E,
-  0XF7BE, 0XF7DF, 0XF7DF, 0XF7BE, 0XF7BE, 0XF7DE, 0XEF3C, 0XEF1B,
-  0XEF5C, 0XFFDF, 0XFFFF, 0XFFFF, 0XF77D, 0XF7DE, 0XFFFF, 0XF7DE,
-  0XFFFF, 0XFFFE, 0XF77C, 0XF79D, 0XF7DE, 0XF7FF, 0XFFFF, 0XFFFF,
-  0XEF7D, 0XEF1B, 0XEEDA, 0XE679, 0XEF7D, 0XF7FF, 0XF7BE, 0XF77D,
-  0XEF7D, 0XF7BE, 0XEEBA, 0XD4D3, 0XE639, 0XE71C, 0XE75C, 0XE77C,
-  0XE75C, 0XEF3C, 0XE71B, 0XE71A, 0XE71B, 0XE71A, 0XDE57, 0XDE77,
-  0XE6D9, 0XE6B8, 0XE6B9, 0XDE58, 0XDE16, 0XDE97, 0XDE77, 0XDE77,
-  0XDE76, 0XDE36, 0XDE56, 0XDE56, 0XD615, 0XD5D4, 0XD5D4, 0XD572,
-  0XC44D, 0XCC8F, 0XCD10, 0XCCEF, 0XC510, 0XC510, 0XC4EF, 0XBCCF,
-  0XBCAE, 0XBC6D, 0XB44D, 0XB44D, 0XB3CB, 0XA2C8, 0XA287, 0XAB4A,
-  0XAB6A, 0XA349, 0XA349, 0X9B08, 0X9AC7, 0X9A87, 0X9266, 0X8A45,
-  0X8A25, 0X8A05, 0X81C4, 0X81A3, 0X81A3, 0X7983, 0X7983, 0X7983,
-  0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X7122, 0X7102, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7102, 0X7122, 0X7142, 0X7962, 0X7963,
-  0X7983, 0X81A4, 0X81C4, 0X81E4, 0X8A05, 0X8A25, 0X9225, 0X9246,
-  0X9286, 0X9AC7, 0X9A86, 0X9A66, 0X9AE8, 0XA328, 0XA349, 0XA38A,
-  0XAB69, 0XAB69, 0XA308, 0XAB6A, 0XB44C, 0XB44D, 0XB44D, 0XBC8E,
-  0XBCAE, 0XBC8D, 0XC4CE, 0XCD50, 0XD571, 0XCCAD, 0XC3CA, 0XCC6D,
-  0XBB68, 0XCCAE, 0XC510, 0XC3CA, 0XCBCB, 0XCD31, 0XD5F4, 0XCCEF,
-  0XCCAE, 0XCCCF, 0XD5B3, 0XDE57, 0XDE98, 0XDE98, 0XDE98, 0XDE98,
-  0XE6D9, 0XE6D9, 0XE6D9, 0XE6D9, 0XDEB9, 0XDE98, 0XDEFA, 0XDF1A,
-  0XDEB9, 0XDED9, 0XE71B, 0XE75C, 0XE75C, 0XE75C, 0XEF5C, 0XE75C,
-  0XEF9E, 0XEF9D, 0XEF3B, 0XE71B, 0XEF3C, 0XD554, 0XE576, 0XF75D,
-  0XF7DF, 0XF7DF, 0XF7FF, 0XEF9C, 0XEF7C, 0XEF9D, 0XF79D, 0XF77D,
-  0XEF1B, 0XEF5D, 0XFFFF, 0XFFFF, 0XF7BD, 0XF77D, 0XFFDE, 0XFFFF,
-  0XFFFF, 0XF7DD, 0XF79D, 0XF7DE, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7DE,
-  0XEF7D, 0XEF3C, 0XEF1C, 0XE6FA, 0XE6DB, 0XF79E, 0XF7FF, 0XF7BE,
-  0XEF7D, 0XEF9E, 0XEE9A, 0XDCD3, 0XEE38, 0XEF1C, 0XEF3C, 0XEF7C,
-  0XEF5C, 0XEF5C, 0XEF5C, 0XEF5C, 0XE71A, 0XE6F9, 0XDE77, 0XDE35,
-  0XE6B9, 0XEEFA, 0XE71A, 0XE6FA, 0XDE57, 0XD5D5, 0XDE16, 0XDE77,
-  0XDE76, 0XDE56, 0XD635, 0XDE56, 0XD615, 0XD5D4, 0XD593, 0XD593,
-  0XC4AE, 0XCC6E, 0XCCEF, 0XC4EF, 0XC510, 0XC4EF, 0XBCAE, 0XBC8D,
-  0XBC6D, 0XB42C, 0XB42C, 0XB42C, 0XAC0C, 0XB3AB, 0XA2A7, 0X9245,
-  0XA2E8, 0XA329, 0XA329, 0X9B08, 0X9AE8, 0X9AA7, 0X9225, 0X8A05,
-  0X8A05, 0X81C4, 0X81A3, 0X81C4, 0X81A4, 0X7983, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7942, 0X7963,
-  0X7983, 0X8183, 0X81C4, 0X81E4, 0X89E4, 0X8A05, 0X8A05, 0X9246,
-  0X92A7, 0X92C7, 0X9AC7, 0X9AA7, 0X9AE8, 0X9B28, 0XA328, 0XA349,
-  0XA369, 0XAB8A, 0XAB89, 0XA2E8, 0XB3AB, 0XAC2C, 0XB44D, 0XB48E,
-  0XBC4C, 0XBBAA, 0XBBAA, 0XC46C, 0XCD71, 0XC46C, 0XC40C, 0XCD10,
-  0XBBAA, 0XC3EC, 0XCCEF, 0XC3EB, 0XC389, 0XCCD0, 0XD592, 0XC48D,
-  0XC4AE, 0XCCF0, 0XD593, 0XD635, 0XDE98, 0XDE98, 0XDE98, 0XDEB8,
-  0XE6D9, 0XE6D9, 0XE6D9, 0XE6D9, 0XE6D9, 0XDEB8, 0XE71A, 0XE73A,
-  0XE71A, 0XE73B, 0XE77C, 0XE75B, 0XE73B, 0XEF7C, 0XEF7C, 0XE75C,
-  0XEF7D, 0XEF5C, 0XE6FB, 0XEF3C, 0XEFBE, 0XEF5C, 0XDD95, 0XDD75,
-  0XEF1C, 0XFFDF, 0XF7FE, 0XEF5B, 0XEEFB, 0XEF5C, 0XFFFF, 0XF7DE,
-  0XF7BD, 0XEF9D, 0XE77D, 0XFFFF, 0XFFFF, 0XF7BD, 0XF77C, 0XFFFF,
-  0XFFFF, 0XFFDE, 0XF7BD, 0XEF7D, 0XFFFF, 0XFFFF, 0XF7BD, 0XF7BE,
-  0XF7FF, 0XF7FF, 0XEF9D, 0XEF7D, 0XE6FB, 0XE6DB, 0XF7BE, 0XF79E,
-  0XEF7D, 0XF79E, 0XEE59, 0XD471, 0XE5F7, 0XEF1C, 0XEF5C, 0XEF7C,
-  0XEF5C, 0XE73B, 0XEF5B, 0XEF7C, 0XEF3B, 0XE6F9, 0XE6F9, 0XDE36,
-  0XE677, 0XEF1A, 0XE6D9, 0XE6F9, 0XE6D9, 0XD5F5, 0XD5B4, 0XDE56,
-  0XDE77, 0XDE56, 0XD615, 0XD5F4, 0XD5F4, 0XD5D4, 0XCD93, 0XCD52,
-  0XCD10, 0XC46D, 0XC4AE, 0XC4CF, 0XC4F0, 0XC4EF, 0XBCAF, 0XBC6D,
-  0XB44D, 0XB42C, 0XB40C, 0XABEC, 0XABEC, 0XABEC, 0XAB6A, 0X9A45,
-  0X9205, 0X9A87, 0X9AA7, 0X9AA7, 0X9AA7, 0X9225, 0X81A3, 0X89A3,
-  0X81A4, 0X81A3, 0X81C4, 0X81C4, 0X81A3, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7942, 0X7142, 0X7122, 0X7122, 0X7102, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7942,
-  0X7963, 0X7983, 0X81A4, 0X81C4, 0X81E4, 0X8A05, 0X8A05, 0X8A46,
-  0X9286, 0X92A7, 0X92C7, 0X92E7, 0X9AE8, 0X9B08, 0X9B28, 0X9B28,
-  0XA329, 0XA369, 0XABAA, 0XA2C7, 0XA308, 0XB40C, 0XAC0C, 0XB44D,
-  0XBC0B, 0XBB49, 0XBB69, 0XBBAA, 0XCCAE, 0XC48D, 0XC42B, 0XCD51,
-  0XBC0A, 0XC389, 0XCC2C, 0XC38A, 0XBB8A, 0XC48F, 0XD592, 0XCCCF,
-  0XCD52, 0XD552, 0XD5D3, 0XD656, 0XDE77, 0XDE98, 0XE6B8, 0XE6B9,
-  0XE6D9, 0XE6F9, 0XE6D9, 0XE6FA, 0XE71A, 0XE71A, 0XE719, 0XDF3A,
-  0XE73A, 0XE75B, 0XEF7C, 0XE75B, 0XE73B, 0XEF7C, 0XE75B, 0XE75B,
-  0XEF5B, 0XEF3B, 0XE73B, 0XEF7D, 0XEFBE, 0XEFBD, 0XEF7C, 0XE638,
-  0XE596, 0XF69B, 0XF7BD, 0XEF19, 0XF73B, 0XF79D, 0XF7DE, 0XFFFF,
-  0XF7BD, 0XF7BD, 0XEF3B, 0XF77D, 0XFFFF, 0XFFFF, 0XF77C, 0XF7BE,
-  0XFFFF, 0XFFFE, 0XFFFE, 0XF77D, 0XF77D, 0XF7BE, 0XF7BE, 0XFFFF,
-  0XF7FF, 0XFFFF, 0XF7FF, 0XEF7C, 0XEF9D, 0XE6DA, 0XEEFB, 0XEF5C,
-  0XF77D, 0XFFBE, 0XDDB5, 0XD471, 0XEE58, 0XEEFA, 0XEF3C, 0XEF5B,
-  0XE75B, 0XEF3B, 0XE73B, 0XEF5B, 0XEF5B, 0XEF3A, 0XE71A, 0XE6B8,
-  0XDE36, 0XE698, 0XDE97, 0XDE57, 0XE677, 0XDE36, 0XD593, 0XD5B4,
-  0XDE76, 0XDE76, 0XD635, 0XD5D4, 0XD5B3, 0XD5B3, 0XCD72, 0XCD31,
-  0XCD31, 0XC48D, 0XBC4C, 0XC4AF, 0XC4AF, 0XBCCF, 0XBCCF, 0XBC8E,
-  0XB44D, 0XB42D, 0XB40C, 0XABEB, 0XABCB, 0XAB8A, 0XAB29, 0X9A66,
-  0X91E4, 0X89C4, 0X91E4, 0X89E4, 0X89C4, 0X89A3, 0X8183, 0X8183,
-  0X8183, 0X8183, 0X81A3, 0X81A4, 0X8183, 0X7963, 0X7963, 0X7942,
-  0X7142, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142,
-  0X7963, 0X7963, 0X7983, 0X81C4, 0X81E4, 0X8205, 0X8A05, 0X8A45,
-  0X8A66, 0X9286, 0X92A7, 0X92C7, 0X9AE7, 0X9B08, 0X9B08, 0X9AE7,
-  0X9B08, 0XA349, 0XABAA, 0XA308, 0X9A65, 0XAB6A, 0XB3EB, 0XB40B,
-  0XBC0B, 0XBB69, 0XC42C, 0XBC0C, 0XBBCB, 0XC46C, 0XBBEB, 0XCCF0,
-  0XC48C, 0XBB67, 0XC328, 0XC3AB, 0XC44D, 0XBC0C, 0XD50F, 0XCCAF,
-  0XCD32, 0XD5B3, 0XDE14, 0XD656, 0XDE77, 0XE6B8, 0XE6B8, 0XE6B8,
-  0XE6B8, 0XE6D9, 0XE6F9, 0XE71A, 0XE71A, 0XDF19, 0XE73A, 0XE75B,
-  0XE73A, 0XE73A, 0XE73B, 0XE71A, 0XEF5B, 0XEF7B, 0XE73A, 0XE73A,
-  0XEF3B, 0XEF7C, 0XEF7C, 0XEF5C, 0XEF9D, 0XEF9D, 0XEF7C, 0XEEFA,
-  0XDD33, 0XE596, 0XF6DA, 0XEEFB, 0XF79D, 0XFFFE, 0XF7DE, 0XF7DE,
-  0XF7BE, 0XF7DE, 0XFFBE, 0XF73C, 0XFFFF, 0XFFFF, 0XF79D, 0XF73C,
-  0XFFBE, 0XF7BD, 0XFFFF, 0XFFFF, 0XEF5C, 0XEF5D, 0XFFFF, 0XFFDE,
-  0XF79C, 0XF7BC, 0XEF9C, 0XEF3B, 0XEF1B, 0XEF1B, 0XEEB9, 0XEEFB,
-  0XF79D, 0XF73B, 0XD4B2, 0XE555, 0XF6FB, 0XEEFA, 0XEF1A, 0XEF5C,
-  0XEF7C, 0XEF9C, 0XEF5B, 0XE71A, 0XE71A, 0XE73A, 0XE6F9, 0XE6D8,
-  0XDE36, 0XDE36, 0XE656, 0XDE16, 0XDE56, 0XDE57, 0XDE15, 0XD573,
-  0XD5B4, 0XDE36, 0XD635, 0XD5F4, 0XD5B3, 0XCD72, 0XCD52, 0XCD31,
-  0XCCF0, 0XC46D, 0XBC2C, 0XC48E, 0XBCAF, 0XBC8E, 0XBC6E, 0XBC6D,
-  0XB42D, 0XB42C, 0XAC0C, 0XABCB, 0XAB29, 0XA2C7, 0X9A86, 0X9225,
-  0X9266, 0X9A87, 0X9266, 0X9225, 0X89E4, 0X89E4, 0X89E5, 0X81E4,
-  0X81E4, 0X81C4, 0X7983, 0X7983, 0X7963, 0X7963, 0X7962, 0X7942,
-  0X7142, 0X7122, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7102, 0X7122, 0X7122,
-  0X7942, 0X7963, 0X7983, 0X81A3, 0X81C4, 0X81E4, 0X8A05, 0X8A25,
-  0X8A46, 0X9266, 0X92A7, 0X92C7, 0X92C7, 0X9AE8, 0X9B08, 0X9AE7,
-  0X9B08, 0XA349, 0XA38A, 0XA348, 0X9245, 0X9A86, 0XB369, 0XB3CA,
-  0XB40B, 0XB369, 0XBC0C, 0XBCAD, 0XB38A, 0XC3CB, 0XBBAB, 0XC46D,
-  0XC4CE, 0XBBA8, 0XC348, 0XC44D, 0XCCF0, 0XBC2C, 0XBBCA, 0XC46D,
-  0XD530, 0XD5D3, 0XDE35, 0XDE56, 0XDE77, 0XDE97, 0XE6B8, 0XE6B8,
-  0XE6B8, 0XE6D9, 0XE6F9, 0XE6F9, 0XE6F9, 0XE71A, 0XE77A, 0XE75A,
-  0XE71A, 0XE719, 0XE6F9, 0XE6D9, 0XEF5B, 0XEF5C, 0XEF3B, 0XE71A,
-  0XE73B, 0XEF7C, 0XE73B, 0XE71A, 0XEF7C, 0XEF7D, 0XEF9D, 0XE676,
-  0XD490, 0XF679, 0XF6DA, 0XF71C, 0XF7DE, 0XFFFF, 0XF7FF, 0XF7DE,
-  0XF7BD, 0XFFDE, 0XFFFF, 0XF79C, 0XF77C, 0XFFFF, 0XFF9D, 0XF71B,
-  0XF75C, 0XF7BD, 0XFFFE, 0XFFFF, 0XF7BD, 0XF77C, 0XEF5B, 0XEF3B,
-  0XF77C, 0XEF7B, 0XEF7C, 0XEF5B, 0XEEFA, 0XEF3C, 0XEEDA, 0XEEB9,
-  0XF77C, 0XE657, 0XD471, 0XE638, 0XEF3B, 0XEF1A, 0XE6F9, 0XE6FA,
-  0XEF5B, 0XEF7C, 0XEF9B, 0XE73A, 0XDEF9, 0XDED8, 0XE698, 0XE697,
-  0XE676, 0XDE15, 0XE636, 0XDE35, 0XDE56, 0XDE76, 0XDE56, 0XDE14,
-  0XCD52, 0XD593, 0XD615, 0XD5F4, 0XD5B3, 0XCD93, 0XCD52, 0XCD31,
-  0XC4AF, 0XC46E, 0XC44D, 0XBC6D, 0XBCCF, 0XBCAE, 0XBC6D, 0XB44D,
-  0XB42C, 0XAC0C, 0XABCB, 0XA329, 0XA2E8, 0XA2E8, 0XA2E8, 0X9A86,
-  0X9AA7, 0X9AE8, 0X9AC8, 0X9AA7, 0X9225, 0X8A05, 0X8A05, 0X8A05,
-  0X8A05, 0X81E5, 0X81C4, 0X7983, 0X7963, 0X7963, 0X7963, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7102, 0X7122,
-  0X7142, 0X7962, 0X7983, 0X7983, 0X81A3, 0X81E4, 0X8205, 0X8A25,
-  0X8A45, 0X8A66, 0X9286, 0X92A7, 0X92C7, 0X92E7, 0X9AE8, 0X9B08,
-  0X9B08, 0X9B29, 0XA349, 0XA348, 0XA2E7, 0X9225, 0XA265, 0XAB28,
-  0XB3EB, 0XB349, 0XB36A, 0XBCCE, 0XB40B, 0XBB29, 0XBB49, 0XC46D,
-  0XC4EF, 0XC42B, 0XC3CA, 0XC48E, 0XC510, 0XCCCE, 0XC42C, 0XC46D,
-  0XD571, 0XD5F4, 0XD615, 0XDE56, 0XDE76, 0XDE77, 0XDE97, 0XDE97,
-  0XE6B8, 0XE6D9, 0XE6D9, 0XE6F9, 0XE6D9, 0XE73A, 0XE73A, 0XE719,
-  0XE75A, 0XE73A, 0XE71A, 0XE6F9, 0XEF5B, 0XEF7C, 0XEF5B, 0XE6F8,
-  0XE719, 0XEF9C, 0XE73A, 0XE71A, 0XEF5B, 0XEF7C, 0XEF9C, 0XEF5A,
-  0XDD94, 0XDCB2, 0XEE59, 0XF79D, 0XFFBD, 0XF7DE, 0XF7FE, 0XFFFF,
-  0XF79D, 0XF79D, 0XF7DD, 0XF7DD, 0XF75C, 0XF73B, 0XFFBD, 0XF77D,
-  0XF77C, 0XEF7C, 0XFFBD, 0XFFFE, 0XFFDD, 0XF79C, 0XEF5C, 0XF7BD,
-  0XFFFF, 0XFFDE, 0XF7DE, 0XF7DE, 0XEF5B, 0XEF3B, 0XEF3B, 0XE678,
-  0XEF1B, 0XE677, 0XCC4F, 0XEE17, 0XEF5B, 0XEF3A, 0XEF1B, 0XE6D9,
-  0XE6D9, 0XEF3A, 0XEF7A, 0XEF7A, 0XE739, 0XDEB8, 0XDE56, 0XDE36,
-  0XE677, 0XDDF4, 0XDDD3, 0XDE55, 0XDE15, 0XD615, 0XDE35, 0XDE35,
-  0XD5B3, 0XCD31, 0XCDB2, 0XCDF3, 0XCDB3, 0XCD93, 0XCD72, 0XCD31,
-  0XC4AF, 0XBC4D, 0XBC6E, 0XBC4D, 0XBC6D, 0XBC8E, 0XBC6E, 0XB44D,
-  0XB42C, 0XABAB, 0XA308, 0XA309, 0XA329, 0XA349, 0XA349, 0X9AE8,
-  0X9A86, 0X9AA7, 0X92A7, 0X9266, 0X8A25, 0X8A05, 0X8A05, 0X89E4,
-  0X81E4, 0X81E4, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7142,
-  0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122,
-  0X7122, 0X7942, 0X7963, 0X7983, 0X79A3, 0X81C4, 0X81E4, 0X8205,
-  0X8A25, 0X8A45, 0X8A66, 0X9286, 0X92A7, 0X92C7, 0X92E7, 0X9B08,
-  0X9B08, 0X9B08, 0X9B28, 0XA349, 0XA349, 0X9AC6, 0X9203, 0X9A44,
-  0XB369, 0XB349, 0XAB08, 0XBC6D, 0XBC8D, 0XB349, 0XB329, 0XC48E,
-  0XC50F, 0XC48D, 0XC44C, 0XCCEF, 0XCD51, 0XCD30, 0XCD0F, 0XCD10,
-  0XD593, 0XD5F4, 0XD5F4, 0XD615, 0XDE36, 0XDE76, 0XDE77, 0XDE77,
-  0XDE97, 0XE6B8, 0XE6D9, 0XE6F9, 0XE6F8, 0XE6F9, 0XE6F9, 0XE73A,
-  0XE77A, 0XE73A, 0XE6F9, 0XE6F9, 0XEF3A, 0XE718, 0XE6B7, 0XE6B7,
-  0XEED9, 0XEF1A, 0XE6F9, 0XE71A, 0XEF5B, 0XEF3A, 0XF79C, 0XF7BD,
-  0XEF1A, 0XD4F2, 0XD514, 0XF75C, 0XF7BD, 0XF7DD, 0XF7FE, 0XFFFE,
-  0XEF7C, 0XEF9C, 0XF7DD, 0XFFDE, 0XFFFF, 0XEF7C, 0XF75B, 0XF75C,
-  0XF79D, 0XF79C, 0XF79D, 0XF7DD, 0XF77B, 0XF77C, 0XF7DD, 0XFFDE,
-  0XF7DE, 0XF7DE, 0XF7BE, 0XFFDE, 0XEF7C, 0XEF5B, 0XEF5B, 0XE698,
-  0XE678, 0XEF1B, 0XD490, 0XDC4F, 0XEEDA, 0XF73B, 0XF6FA, 0XEF1A,
-  0XE6F9, 0XE6B8, 0XE6D8, 0XE719, 0XE6D8, 0XDE77, 0XDE76, 0XDE77,
-  0XDE15, 0XDDD3, 0XD5D3, 0XD5F3, 0XDE14, 0XDDF4, 0XDDF4, 0XD615,
-  0XD5D4, 0XD572, 0XCD10, 0XCD72, 0XCD92, 0XCD72, 0XCD51, 0XC510,
-  0XC48E, 0XBC0C, 0XBC6D, 0XBC8E, 0XB42C, 0XB42C, 0XB44D, 0XB42C,
-  0XABEC, 0XAB29, 0XA308, 0XAB6A, 0XA36A, 0XA349, 0X9B49, 0X9B29,
-  0X9286, 0X9266, 0X9287, 0X9266, 0X8A25, 0X8A05, 0X8A05, 0X81E4,
-  0X81E4, 0X81C4, 0X81C4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7142,
-  0X7122, 0X7102, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7102,
-  0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X81A4, 0X81C4, 0X81E4,
-  0X8205, 0X8A25, 0X8A45, 0X8A66, 0X9286, 0X92A7, 0X92C7, 0X92E7,
-  0X9AE7, 0X9B08, 0X9B28, 0X9B49, 0XA369, 0XA348, 0X9AC6, 0XA265,
-  0XA286, 0XA286, 0XA2A7, 0XBC0B, 0XB46C, 0XB40B, 0XBC0B, 0XBC8D,
-  0XC4AE, 0XC4CE, 0XC4AE, 0XCCF0, 0XCD51, 0XCD71, 0XCD51, 0XCD72,
-  0XD5B3, 0XD5D4, 0XD5F4, 0XD5F4, 0XD635, 0XD655, 0XD656, 0XDE56,
-  0XDE56, 0XE677, 0XE6B8, 0XE6B7, 0XDE97, 0XDEB7, 0XE6F9, 0XE71A,
-  0XE73A, 0XDF19, 0XE6B8, 0XE6B8, 0XE6B7, 0XE676, 0XEEB8, 0XEEF9,
-  0XE677, 0XE697, 0XE6D8, 0XE71A, 0XEF5B, 0XEF5B, 0XEFBC, 0XEFDC,
-  0XF79C, 0XE6DA, 0XD5B6, 0XEE9A, 0XF77C, 0XF79C, 0XF73A, 0XEEF9,
-  0XF77C, 0XFFDE, 0XFFDE, 0XFFFF, 0XFFFF, 0XF7DD, 0XEEFA, 0XF73B,
-  0XF79C, 0XF79C, 0XF79C, 0XFFDD, 0XF79B, 0XEF7B, 0XF79C, 0XFFDD,
-  0XF7BD, 0XF7BD, 0XF7BD, 0XF79C, 0XEF5A, 0XEF7B, 0XEF5B, 0XEEF9,
-  0XE657, 0XEEDA, 0XE698, 0XD4B0, 0XDC70, 0XDCB1, 0XDCB1, 0XDD93,
-  0XE6B8, 0XE698, 0XDE77, 0XE6B7, 0XDE97, 0XDE76, 0XDE97, 0XDE97,
-  0XD614, 0XD5F3, 0XDE14, 0XDDD3, 0XD5B3, 0XD593, 0XD5B3, 0XD5F4,
-  0XD5D3, 0XD592, 0XCD11, 0XC4D0, 0XCD31, 0XCD71, 0XC531, 0XC4F0,
-  0XBC6E, 0XBC0C, 0XBC4D, 0XBC8E, 0XB44C, 0XB40B, 0XB40C, 0XAC0C,
-  0XAB6A, 0XA2E8, 0XA36A, 0XA38A, 0XA349, 0X9B29, 0X9B29, 0X9B08,
-  0X92A7, 0X9245, 0X9246, 0X8A25, 0X8A05, 0X8A05, 0X8A05, 0X8205,
-  0X81E4, 0X81C4, 0X79A3, 0X7983, 0X7983, 0X7963, 0X7142, 0X7142,
-  0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7983, 0X79A3, 0X81C4, 0X81E4,
-  0X8204, 0X8A25, 0X8A25, 0X8A46, 0X8A86, 0X9286, 0X92A7, 0X92C7,
-  0X92C7, 0X9AC7, 0X9B08, 0X9B49, 0XA369, 0XA369, 0XA328, 0XAB27,
-  0XA2C7, 0X9A04, 0XA2A6, 0XB3CA, 0XB42C, 0XBC6D, 0XBC6D, 0XBC8D,
-  0XC4AE, 0XC4EE, 0XC4CF, 0XC4CF, 0XCD31, 0XCD51, 0XCD51, 0XCD92,
-  0XCDB3, 0XD5D3, 0XD5F3, 0XD5F3, 0XD5F4, 0XD615, 0XD615, 0XD615,
-  0XDE36, 0XDE56, 0XDE56, 0XDE56, 0XDE97, 0XDED8, 0XDEF8, 0XE6F9,
-  0XE719, 0XE719, 0XE6F8, 0XDE76, 0XDE56, 0XE6B9, 0XEED9, 0XE6D8,
-  0XDEB7, 0XE6D8, 0XE6F9, 0XEF3A, 0XEF7B, 0XEF9C, 0XEF7C, 0XEFBC,
-  0XEFDC, 0XEFBC, 0XE6B9, 0XE659, 0XEEDA, 0XF73A, 0XF73B, 0XEED8,
-  0XEED9, 0XFF9D, 0XFFFE, 0XF7BC, 0XF77A, 0XF77B, 0XEE77, 0XEE77,
-  0XF73B, 0XF77B, 0XF79C, 0XF7DD, 0XF7DC, 0XEF9B, 0XEF5B, 0XF75B,
-  0XF79C, 0XF7BC, 0XF79C, 0XEF5A, 0XEF5B, 0XEF9B, 0XEF7B, 0XEF5B,
-  0XDE77, 0XDE57, 0XEF3B, 0XE6B9, 0XDD53, 0XDD12, 0XDD33, 0XD470,
-  0XDD12, 0XE656, 0XDEB7, 0XDE97, 0XDE97, 0XDE76, 0XDE56, 0XDE35,
-  0XD5D3, 0XD614, 0XDE35, 0XDE14, 0XD5B3, 0XD572, 0XCD51, 0XCD51,
-  0XD572, 0XCD72, 0XCD72, 0XC4F0, 0XC4CF, 0XCD31, 0XC531, 0XC4CF,
-  0XBC4D, 0XBC0C, 0XB42D, 0XB46D, 0XB44D, 0XB3EB, 0XABEB, 0XABAB,
-  0XA308, 0XA329, 0XA38A, 0XA36A, 0XA349, 0X9B28, 0X9B08, 0X9AE8,
-  0X92A7, 0X8A25, 0X9225, 0X8A05, 0X8A05, 0X8205, 0X81E5, 0X81E4,
-  0X81C4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122,
-  0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X7102, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X79A3, 0X81C4,
-  0X81E4, 0X8205, 0X8A25, 0X8A45, 0X8A66, 0X9286, 0X92A7, 0X92C7,
-  0X92C7, 0X9AC7, 0X9AE8, 0X9B28, 0X9B49, 0XA349, 0XA328, 0XA348,
-  0XAB28, 0XA2C7, 0XAB07, 0XB3CA, 0XB42C, 0XB44D, 0XBC6D, 0XBCAE,
-  0XC4AE, 0XBCCE, 0XC4EF, 0XC4EF, 0XC530, 0XCD51, 0XC531, 0XCD72,
-  0XCD92, 0XCDB3, 0XCDD2, 0XCDB3, 0XCDD3, 0XCDD4, 0XCDD4, 0XD5F5,
-  0XD615, 0XD615, 0XD614, 0XDE36, 0XE6D8, 0XE6F8, 0XE6F8, 0XE719,
-  0XE739, 0XE73A, 0XDEB7, 0XDDF4, 0XE677, 0XEEF9, 0XE6F8, 0XDE97,
-  0XE6D8, 0XE71A, 0XE6F9, 0XEF1A, 0XEF7B, 0XEF9B, 0XEF9B, 0XEF7B,
-  0XEF9B, 0XEF7B, 0XE71A, 0XDE78, 0XE618, 0XEEDA, 0XF7DD, 0XF75B,
-  0XEE98, 0XF6FA, 0XEEF8, 0XEEF8, 0XEF5B, 0XF77C, 0XEEF9, 0XE5F5,
-  0XEE98, 0XF73A, 0XEF5A, 0XF79B, 0XF79C, 0XEF7B, 0XEF19, 0XE698,
-  0XEF3A, 0XF7BC, 0XF79B, 0XEF5B, 0XEF7B, 0XEF9B, 0XEF7B, 0XEF5A,
-  0XE6F9, 0XDE16, 0XE6B8, 0XE6F9, 0XEED8, 0XEED9, 0XEEF9, 0XDDD5,
-  0XCC4F, 0XE5B4, 0XE6B7, 0XDE97, 0XDE76, 0XDE76, 0XDE15, 0XDE15,
-  0XDE14, 0XD5F4, 0XD614, 0XD5F4, 0XD5D4, 0XD5B3, 0XD572, 0XCD51,
-  0XCD30, 0XCD31, 0XCD51, 0XCD31, 0XBC8E, 0XBCAE, 0XC4F0, 0XBCAF,
-  0XBC0C, 0XB3EC, 0XB40C, 0XB42D, 0XB44D, 0XB40C, 0XAB69, 0XA2E8,
-  0XA329, 0XA38A, 0XA36A, 0XA349, 0X9B29, 0X9B08, 0X9AE7, 0X9AC7,
-  0X9266, 0X8A05, 0X8A05, 0X8A25, 0X8A05, 0X81E4, 0X81E4, 0X81C4,
-  0X81C4, 0X79A3, 0X7963, 0X7963, 0X7142, 0X7142, 0X7142, 0X7122,
-  0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X79C4,
-  0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A46, 0X8A66, 0X9286, 0X92A7,
-  0X92C7, 0X92C7, 0X9AE7, 0X9B08, 0X9B28, 0X9B07, 0X9B07, 0XA348,
-  0XA328, 0XA308, 0XAB28, 0XABCB, 0XAC2C, 0XB42C, 0XB44D, 0XBC8D,
-  0XBCAE, 0XBCCF, 0XBCEF, 0XC4CF, 0XC50F, 0XC530, 0XC531, 0XC551,
-  0XCD72, 0XCD92, 0XCD92, 0XCD92, 0XCD93, 0XCDB3, 0XD5D3, 0XD5F4,
-  0XD614, 0XD615, 0XD614, 0XDE56, 0XE6D8, 0XE6D8, 0XE6F8, 0XDEF8,
-  0XE719, 0XE719, 0XE696, 0XDE35, 0XE697, 0XE6D8, 0XDED7, 0XE6D7,
-  0XE6D8, 0XE719, 0XE6F9, 0XEF1A, 0XEF5B, 0XEF7B, 0XE75A, 0XE71A,
-  0XEF3A, 0XEF3A, 0XEF3A, 0XEED9, 0XD555, 0XE638, 0XF79C, 0XF73A,
-  0XF73B, 0XEF5B, 0XE657, 0XEE98, 0XEF5B, 0XEF7C, 0XF77B, 0XEE77,
-  0XEE36, 0XEED8, 0XF73A, 0XEF3A, 0XEF5A, 0XEF19, 0XEEF9, 0XEE98,
-  0XE6B8, 0XEF7A, 0XEF7B, 0XEF5A, 0XE6F9, 0XEF19, 0XF77B, 0XEF5A,
-  0XE719, 0XDE36, 0XDE36, 0XE6F9, 0XE6B8, 0XE6B8, 0XE6D9, 0XE615,
-  0XCC4E, 0XDD12, 0XE656, 0XE6B7, 0XDE96, 0XDE56, 0XDE35, 0XD635,
-  0XD614, 0XD5F4, 0XD5F4, 0XD5D3, 0XD5B3, 0XD5B3, 0XCD92, 0XCD72,
-  0XCD51, 0XC4EF, 0XC4F0, 0XC511, 0XC4AF, 0XBC2D, 0XBC8E, 0XBC8E,
-  0XB3EC, 0XB3AB, 0XB3EC, 0XB42C, 0XB40C, 0XAB49, 0XA266, 0XAAE8,
-  0XAB8A, 0XA38A, 0XA349, 0X9B29, 0X9B08, 0X9AC7, 0X92C7, 0X9287,
-  0X9245, 0X8A05, 0X89E4, 0X8A05, 0X8A05, 0X81E4, 0X81C4, 0X81A4,
-  0X79A3, 0X7983, 0X7963, 0X7142, 0X7142, 0X7142, 0X7122, 0X7102,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X79A3,
-  0X79C4, 0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A46, 0X8A66, 0X9287,
-  0X92A7, 0X92A7, 0X92C7, 0X9AE8, 0X9AE8, 0X9AC6, 0X9AC6, 0XA308,
-  0XA349, 0XA348, 0XAB69, 0XABCB, 0XABEB, 0XAC0C, 0XB44D, 0XB46D,
-  0XBC8E, 0XBCAE, 0XBCCF, 0XBCCF, 0XC4EF, 0XC510, 0XC530, 0XC551,
-  0XCD71, 0XC571, 0XCD72, 0XCD71, 0XCD72, 0XCD92, 0XD5D3, 0XD5F4,
-  0XD635, 0XD635, 0XDE35, 0XDE55, 0XDE96, 0XDE97, 0XDEB7, 0XDED7,
-  0XE718, 0XE6F8, 0XDE54, 0XDE76, 0XE6B7, 0XDEB7, 0XDE97, 0XE6B7,
-  0XE6D7, 0XE6D8, 0XE6D8, 0XE719, 0XEF5B, 0XEF7B, 0XE73A, 0XE6F9,
-  0XEF5B, 0XEF5B, 0XEF3A, 0XEF19, 0XD553, 0XDD15, 0XF6DA, 0XEEF9,
-  0XEF1A, 0XF75A, 0XEEF9, 0XE6D9, 0XE6F9, 0XEEFA, 0XEF19, 0XE677,
-  0XEE36, 0XEE56, 0XEEF9, 0XEF7A, 0XEF7A, 0XEEF9, 0XEF19, 0XEF5A,
-  0XE6F9, 0XE6D8, 0XE719, 0XEF19, 0XEEF9, 0XE6F9, 0XE6F8, 0XE6F8,
-  0XE6B7, 0XDE35, 0XDDF5, 0XE6B8, 0XE6D9, 0XE6B8, 0XE6D8, 0XDD93,
-  0XCC0D, 0XDD32, 0XDDF4, 0XDE35, 0XDE76, 0XDE55, 0XD635, 0XD614,
-  0XD5F4, 0XD5D3, 0XD5D3, 0XD5D3, 0XCD92, 0XCD72, 0XCD51, 0XC531,
-  0XC510, 0XC4CF, 0XC48E, 0XBCAE, 0XC4CF, 0XBC4E, 0XB40C, 0XBC0C,
-  0XB36A, 0XAB09, 0XAB29, 0XAB4A, 0XAB08, 0XA2E8, 0XA308, 0XAB29,
-  0XA369, 0X9B49, 0X9B29, 0X9B08, 0X9AE8, 0X9AC7, 0X92A7, 0X9266,
-  0X8A25, 0X8A25, 0X89E4, 0X81C4, 0X81E4, 0X81E4, 0X81C4, 0X81A4,
-  0X7983, 0X7963, 0X7942, 0X7142, 0X7142, 0X7122, 0X7102, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7122, 0X7142, 0X7942, 0X7963, 0X7983,
-  0X79A3, 0X81C4, 0X81E4, 0X8205, 0X8205, 0X8A25, 0X8A46, 0X8A66,
-  0X9287, 0X92A6, 0X92A7, 0X92C7, 0X92C7, 0X9AA6, 0X9AE7, 0X9B28,
-  0XA349, 0XA369, 0XA369, 0XA3AA, 0XABEB, 0XAC0B, 0XAC2C, 0XB44D,
-  0XB46E, 0XBC8E, 0XBCAE, 0XBCCE, 0XBCEF, 0XC4F0, 0XC510, 0XC551,
-  0XCD51, 0XC531, 0XC551, 0XC551, 0XCD51, 0XCD92, 0XD5B2, 0XD5F3,
-  0XDE35, 0XDE35, 0XDE34, 0XDE34, 0XDE35, 0XDE76, 0XDE96, 0XDE96,
-  0XE6D7, 0XDEB6, 0XDE13, 0XDE55, 0XDE76, 0XE6B7, 0XE6D7, 0XDE75,
-  0XDE35, 0XE698, 0XE6B8, 0XE6F9, 0XE73A, 0XEF7B, 0XEF5A, 0XE719,
-  0XE73A, 0XE75A, 0XEF1A, 0XE6B7, 0XDDD3, 0XDD14, 0XE5F7, 0XE698,
-  0XE6D9, 0XEED9, 0XEEB8, 0XEEF9, 0XEF3A, 0XE71A, 0XEF1A, 0XE677,
-  0XE697, 0XE677, 0XE697, 0XF75A, 0XF77B, 0XE719, 0XEF19, 0XEF5A,
-  0XEF5A, 0XE6F8, 0XDE76, 0XE697, 0XEF19, 0XEEF8, 0XDE76, 0XDE35,
-  0XE676, 0XDE35, 0XD5B3, 0XDE56, 0XE6D9, 0XDEB7, 0XE697, 0XD531,
-  0XCC0D, 0XDD93, 0XDDD4, 0XDDF4, 0XD615, 0XD614, 0XD5F4, 0XD5D3,
-  0XD5D3, 0XD5B2, 0XD5B2, 0XCD92, 0XCD71, 0XCD71, 0XCD51, 0XC4F0,
-  0XC4F0, 0XC4F0, 0XC4AE, 0XBC6D, 0XBC6E, 0XBC4D, 0XB3EC, 0XB38B,
-  0XB36A, 0XAAE9, 0XAB09, 0XAB29, 0XAB4A, 0XABAB, 0XABAA, 0XA349,
-  0XA349, 0X9B49, 0X9B08, 0X9AE8, 0X9AC7, 0X9286, 0X9246, 0X8A25,
-  0X8A25, 0X8A25, 0X8A05, 0X81C4, 0X81A3, 0X81C4, 0X81C4, 0X79A4,
-  0X7983, 0X7963, 0X7142, 0X7142, 0X7122, 0X7122, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963,
-  0X7983, 0X79A3, 0X81C4, 0X81E4, 0X8205, 0X8225, 0X8A45, 0X8A46,
-  0X8A66, 0X8A86, 0X9286, 0X92A6, 0X92A6, 0X9AC7, 0X9AE7, 0X9B28,
-  0X9B28, 0XA349, 0XA369, 0XA38A, 0XA3CA, 0XABEB, 0XAC0C, 0XB42C,
-  0XB44D, 0XB46E, 0XBC8E, 0XBCAE, 0XBCCF, 0XBCCF, 0XC4F0, 0XC510,
-  0XC530, 0XC510, 0XC510, 0XC530, 0XCD51, 0XCD91, 0XD5D2, 0XD5F3,
-  0XD614, 0XDE34, 0XD614, 0XDE14, 0XDE14, 0XDE56, 0XDE96, 0XDE76,
-  0XDE75, 0XDE13, 0XDE55, 0XDE76, 0XDE35, 0XDE76, 0XDEB7, 0XE696,
-  0XE656, 0XDE56, 0XE6B8, 0XE6F8, 0XE6F8, 0XE719, 0XE6F9, 0XDEB8,
-  0XE6D8, 0XE6D8, 0XE6D7, 0XDE56, 0XDDB3, 0XDD32, 0XE5B5, 0XDE57,
-  0XE6D8, 0XE6D9, 0XE697, 0XE697, 0XEF1A, 0XEF5A, 0XEF5B, 0XEEF9,
-  0XE697, 0XE656, 0XE636, 0XE6D9, 0XEF1A, 0XE6F9, 0XE6B8, 0XEEF9,
-  0XE719, 0XE6D8, 0XE6B7, 0XDE56, 0XE697, 0XE6B7, 0XDE56, 0XDE56,
-  0XDE56, 0XE636, 0XDDD4, 0XD5D4, 0XE697, 0XE697, 0XDE35, 0XCC4D,
-  0XCC4E, 0XDDB4, 0XD5F4, 0XD615, 0XD614, 0XD5D3, 0XD592, 0XCD92,
-  0XCD92, 0XCD92, 0XD571, 0XCD31, 0XC510, 0XCD30, 0XCD10, 0XC4CF,
-  0XC4CF, 0XC4F0, 0XBCCF, 0XBC8E, 0XBC6E, 0XB42D, 0XB3CB, 0XB3EC,
-  0XB3EC, 0XAB4A, 0XAB4A, 0XAB8A, 0XAB8A, 0XAB8A, 0XA38A, 0XA349,
-  0X9B29, 0X9B29, 0X9B08, 0X9AE8, 0X92A7, 0X9246, 0X8A25, 0X8A25,
-  0X8A25, 0X8A05, 0X8A05, 0X81E4, 0X81A3, 0X7983, 0X7983, 0X7983,
-  0X7963, 0X7142, 0X7142, 0X7122, 0X7122, 0X7102, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7122, 0X7122, 0X7142, 0X7963,
-  0X7963, 0X7983, 0X79A3, 0X81C4, 0X81E4, 0X8205, 0X8A05, 0X8A25,
-  0X8A66, 0X8A66, 0X9245, 0X9266, 0X92C7, 0X92C7, 0X92E7, 0X9B08,
-  0X9B28, 0X9B49, 0X9B49, 0XA369, 0XA38A, 0XABCA, 0XABEB, 0XAC0C,
-  0XB42C, 0XB44D, 0XB46D, 0XBC8E, 0XBCAE, 0XBCCF, 0XBCCF, 0XC4CF,
-  0XC4EF, 0XC4EF, 0XC4EF, 0XC4EF, 0XC530, 0XCD71, 0XD5B2, 0XD5D3,
-  0XD5D3, 0XD614, 0XD5F3, 0XD5F3, 0XDDF4, 0XD635, 0XDE75, 0XDE96,
-  0XD613, 0XD5D2, 0XDE76, 0XDE76, 0XDE35, 0XDE76, 0XDEB7, 0XDE75,
-  0XE696, 0XDE56, 0XDE77, 0XE6D8, 0XE6B8, 0XE6B8, 0XDED8, 0XDEB7,
-  0XDE97, 0XDE76, 0XDE76, 0XDE35, 0XD511, 0XD44F, 0XE595, 0XE636,
-  0XE6D8, 0XE6D8, 0XE6B8, 0XE677, 0XE698, 0XE6F9, 0XEF19, 0XEF19,
-  0XE677, 0XE635, 0XDDF4, 0XE676, 0XE6F8, 0XDEB7, 0XDE97, 0XE6D8,
-  0XE6D8, 0XE696, 0XE676, 0XDE56, 0XDE56, 0XE6B7, 0XE697, 0XDE97,
-  0XDE77, 0XDE77, 0XDE56, 0XD593, 0XDDF5, 0XE656, 0XCCF0, 0XC3AB,
-  0XD4D0, 0XDD93, 0XD5D3, 0XD614, 0XD614, 0XD5D3, 0XCD92, 0XCD51,
-  0XCD72, 0XCD92, 0XCD30, 0XCD30, 0XC510, 0XC4CF, 0XC4CF, 0XC4CF,
-  0XC4CF, 0XBCCF, 0XBC8E, 0XBC6E, 0XBC6D, 0XB42D, 0XB3AB, 0XB3EC,
-  0XABEC, 0XAB6A, 0XAB4A, 0XAB8A, 0XA36A, 0XA369, 0XA369, 0X9B29,
-  0X9B08, 0X9AE7, 0X9AA7, 0X9287, 0X9266, 0X9246, 0X9246, 0X8A25,
-  0X8A05, 0X8205, 0X8205, 0X81E4, 0X81C4, 0X7983, 0X7963, 0X7962,
-  0X7142, 0X7142, 0X7122, 0X7122, 0X7102, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142,
-  0X7963, 0X7963, 0X7983, 0X79A3, 0X81C4, 0X81E4, 0X8205, 0X8205,
-  0X8A25, 0X8A45, 0X8A25, 0X8A66, 0X92A7, 0X92A7, 0X92C7, 0X9308,
-  0X9B08, 0X9B28, 0X9B49, 0X9B49, 0XA369, 0XA38A, 0XABCB, 0XABEB,
-  0XAC0B, 0XB42C, 0XB44D, 0XBC6D, 0XBC8E, 0XBCAE, 0XBCAE, 0XBCAE,
-  0XBCAE, 0XBCCE, 0XBCCE, 0XC4CF, 0XC4EF, 0XCD30, 0XCD71, 0XCD91,
-  0XD5B2, 0XD5D3, 0XD5D2, 0XD5D2, 0XD5D3, 0XD614, 0XD635, 0XD655,
-  0XD5D3, 0XDE14, 0XDE55, 0XDE35, 0XDE35, 0XDE76, 0XE6B7, 0XDE75,
-  0XE655, 0XDE35, 0XE656, 0XDE97, 0XDEB7, 0XDED7, 0XDED8, 0XE6D8,
-  0XDEB7, 0XDE56, 0XDE35, 0XD5D3, 0XD593, 0XCC90, 0XD4D2, 0XDDD5,
-  0XE677, 0XE6B7, 0XE697, 0XE6B8, 0XE697, 0XE697, 0XE677, 0XEEB7,
-  0XE655, 0XDDF4, 0XE5F4, 0XDDF5, 0XDE76, 0XDE97, 0XE6B7, 0XE6D8,
-  0XEEF9, 0XE6B7, 0XE676, 0XDE35, 0XDE35, 0XE677, 0XDE97, 0XDE97,
-  0XDE76, 0XDE56, 0XDE56, 0XD573, 0XDD93, 0XDDB3, 0XC40D, 0XC46F,
-  0XD573, 0XD572, 0XD572, 0XD5D3, 0XD5D3, 0XD592, 0XCD72, 0XCD51,
-  0XC4EF, 0XCD10, 0XCD51, 0XC4EF, 0XC4EF, 0XC4CF, 0XC4EF, 0XC50F,
-  0XBCEF, 0XBCAF, 0XBC6E, 0XBC4D, 0XB42C, 0XB3EB, 0XABAB, 0XB3EB,
-  0XABAB, 0XAB49, 0XAB6A, 0XA38A, 0XA369, 0XA329, 0X9B08, 0X9B08,
-  0X9B08, 0X9AA7, 0X9286, 0X9287, 0X9266, 0X8A46, 0X8A25, 0X8A05,
-  0X8205, 0X8205, 0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7963, 0X7942,
-  0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X7102, 0X7122, 0X7122,
-  0X7142, 0X7962, 0X7963, 0X7983, 0X79A3, 0X81C4, 0X81E4, 0X81E4,
-  0X8204, 0X8A05, 0X8A05, 0X8A45, 0X8A86, 0X92A7, 0X92A6, 0X92C7,
-  0X92E8, 0X9B08, 0X9B28, 0X9B29, 0X9B49, 0XA36A, 0XA3AA, 0XABCB,
-  0XABCB, 0XAC0C, 0XB42C, 0XB44D, 0XB44D, 0XBC6D, 0XBC6D, 0XBC8E,
-  0XBCAE, 0XBC8E, 0XBCAE, 0XBCCE, 0XC4EF, 0XCD30, 0XCD50, 0XCD71,
-  0XCD91, 0XD591, 0XCD71, 0XCD50, 0XD592, 0XD5F3, 0XD614, 0XD5D2,
-  0XD5D2, 0XD615, 0XDE34, 0XD5F3, 0XD614, 0XDE55, 0XDE76, 0XDE75,
-  0XDDF3, 0XD5B3, 0XDE55, 0XDE96, 0XDE96, 0XDE96, 0XDE96, 0XDE96,
-  0XDE97, 0XDEB7, 0XDE75, 0XD5B3, 0XDE35, 0XD5F4, 0XCC90, 0XD4B1,
-  0XDDD5, 0XDE56, 0XDE97, 0XE6B8, 0XE6B7, 0XE6B7, 0XDE76, 0XDE36,
-  0XDE14, 0XDD72, 0XDDB3, 0XDDF4, 0XDDF5, 0XE677, 0XE6B7, 0XE697,
-  0XE697, 0XE697, 0XE6B7, 0XDE56, 0XDE35, 0XDE76, 0XDE96, 0XDE76,
-  0XDE56, 0XDE55, 0XDE35, 0XD552, 0XD552, 0XD511, 0XCBCD, 0XD511,
-  0XD5B3, 0XCD72, 0XCD72, 0XD592, 0XCD92, 0XCD71, 0XCD71, 0XCD50,
-  0XC4CF, 0XC4CF, 0XC4EF, 0XC4AE, 0XC4AE, 0XBCCF, 0XBCEF, 0XBCEF,
-  0XBCCF, 0XBCAE, 0XB46D, 0XB42D, 0XB42C, 0XABCB, 0XAB8A, 0XABCB,
-  0XAB8A, 0XA329, 0XA349, 0XA36A, 0XA349, 0X9B29, 0X9B08, 0X9AA7,
-  0X9A86, 0X9287, 0X92A7, 0X9287, 0X8A66, 0X8A45, 0X8A05, 0X8205,
-  0X8205, 0X81E4, 0X81E4, 0X79C4, 0X79A3, 0X7983, 0X7963, 0X7143,
-  0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122,
-  0X7142, 0X7142, 0X7962, 0X7963, 0X7983, 0X79A3, 0X81C4, 0X81E4,
-  0X81E4, 0X81E4, 0X8A04, 0X8A25, 0X8A45, 0X8A86, 0X9286, 0X92A7,
-  0X92C7, 0X92E8, 0X9B08, 0X9B28, 0X9B29, 0X9B49, 0XA369, 0XA38A,
-  0XA3AB, 0XABCB, 0XABEC, 0XB42C, 0XB42C, 0XB44C, 0XB44D, 0XB46D,
-  0XB46D, 0XBC6D, 0XBC8E, 0XBCAD, 0XC4AE, 0XC4EE, 0XC50F, 0XCD50,
-  0XCD71, 0XD591, 0XCD71, 0XCD30, 0XCD51, 0XD5D3, 0XD5B2, 0XD570,
-  0XD591, 0XD614, 0XD614, 0XD5F3, 0XD5F3, 0XD634, 0XDE34, 0XD634,
-  0XD5D3, 0XD5B3, 0XD635, 0XDE55, 0XDE76, 0XDE76, 0XDE55, 0XDE76,
-  0XDE97, 0XDE96, 0XDE14, 0XD592, 0XD615, 0XDDF4, 0XCC6E, 0XCBEE,
-  0XDD74, 0XDE56, 0XDE76, 0XDE97, 0XE6B7, 0XDEB7, 0XDE76, 0XDE76,
-  0XE696, 0XD5B3, 0XD572, 0XE635, 0XE615, 0XDE36, 0XE677, 0XDE96,
-  0XDE76, 0XDE55, 0XE676, 0XDE56, 0XDE14, 0XDE34, 0XDE35, 0XDE35,
-  0XD635, 0XD614, 0XD5D3, 0XD572, 0XD511, 0XD4D0, 0XC3CC, 0XD4D0,
-  0XD592, 0XCD92, 0XCD51, 0XCD31, 0XCD51, 0XCD51, 0XCD51, 0XC531,
-  0XCD31, 0XC510, 0XBCCF, 0XBCAE, 0XC46D, 0XC48E, 0XBCAE, 0XBCAE,
-  0XBC8E, 0XBC6D, 0XB42C, 0XB42C, 0XB42C, 0XABCB, 0XAB6A, 0XAB8A,
-  0XA38A, 0XA329, 0XA308, 0XA349, 0X9B29, 0X9B08, 0X9AA7, 0X9266,
-  0X9286, 0X92A7, 0X9286, 0X8A66, 0X8A46, 0X8A25, 0X8205, 0X8205,
-  0X81E4, 0X81E4, 0X79C4, 0X79A3, 0X7983, 0X7963, 0X7163, 0X7142,
-  0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X79A3, 0X81C4,
-  0X81C4, 0X81C4, 0X81E4, 0X8A05, 0X8A25, 0X8A45, 0X8A66, 0X9286,
-  0X92A7, 0X92C7, 0X92E7, 0X9B08, 0X9B28, 0X9B28, 0X9B08, 0XA349,
-  0XA38A, 0XA3AA, 0XABCB, 0XABEC, 0XAC0C, 0XAC0B, 0XB42C, 0XB42C,
-  0XB44C, 0XB44C, 0XBC4D, 0XBC8D, 0XBC8E, 0XC4AE, 0XC4CE, 0XC4EF,
-  0XC50F, 0XCD30, 0XCD50, 0XCD30, 0XCD30, 0XCD30, 0XD551, 0XCD51,
-  0XD591, 0XD5B2, 0XD5D3, 0XD5D3, 0XD5D3, 0XD5F4, 0XD614, 0XD614,
-  0XD5D3, 0XD5D3, 0XD635, 0XD635, 0XDE55, 0XDE55, 0XD635, 0XDE55,
-  0XDE76, 0XDE35, 0XD5D3, 0XCD71, 0XD510, 0XC40D, 0XC3ED, 0XCCD1,
-  0XD594, 0XDE15, 0XDE56, 0XDE56, 0XDE55, 0XDE55, 0XDE75, 0XDE75,
-  0XDE76, 0XDE55, 0XD572, 0XDDB3, 0XDE14, 0XDDF4, 0XDDF5, 0XDE56,
-  0XE676, 0XE655, 0XDE14, 0XDDF4, 0XD5B3, 0XD5B3, 0XD5F4, 0XD615,
-  0XD5F4, 0XD592, 0XD572, 0XD5B3, 0XCCF0, 0XCCAF, 0XC38B, 0XC40E,
-  0XCD52, 0XD572, 0XCD72, 0XCD51, 0XCD11, 0XCD10, 0XC530, 0XC510,
-  0XC510, 0XC510, 0XC4CF, 0XBC8E, 0XBC2C, 0XBC4D, 0XBC8E, 0XBC6D,
-  0XB44D, 0XB42C, 0XB40C, 0XAC0C, 0XABEC, 0XABCB, 0XAB6A, 0XAB8A,
-  0XA36A, 0XA349, 0X9B08, 0X9B08, 0X9AE8, 0X9AA7, 0X9A86, 0X9286,
-  0X9287, 0X9286, 0X8A66, 0X8A45, 0X8A25, 0X8225, 0X8205, 0X81E4,
-  0X81C4, 0X79C4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122,
-  0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7102, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X79A3,
-  0X81A3, 0X81A3, 0X81C4, 0X8204, 0X8A05, 0X8A25, 0X8A45, 0X8A66,
-  0X9286, 0X92A7, 0X92C7, 0X92E8, 0X9B08, 0X9B08, 0X9AE7, 0X9B08,
-  0XA349, 0XA38A, 0XA3AA, 0XABCB, 0XABCB, 0XABCB, 0XABEB, 0XAC0C,
-  0XB40C, 0XB40C, 0XBC2C, 0XBC8D, 0XBCCE, 0XC4CE, 0XC4EE, 0XC4EF,
-  0XC4EF, 0XC4EF, 0XC50F, 0XC50F, 0XC4EF, 0XCCCF, 0XD531, 0XCD50,
-  0XCD71, 0XCD92, 0XD5B2, 0XD5B2, 0XD592, 0XD592, 0XD5D3, 0XD5F4,
-  0XD592, 0XD5B3, 0XD614, 0XD614, 0XD614, 0XD614, 0XD614, 0XD614,
-  0XD5F4, 0XD614, 0XCDB3, 0XCD51, 0XC42D, 0XCC0F, 0XD573, 0XD5D4,
-  0XD593, 0XD5D4, 0XDE35, 0XD615, 0XD5F4, 0XDE35, 0XDE14, 0XDE14,
-  0XDE34, 0XDE34, 0XD5B3, 0XD552, 0XDDB3, 0XDDD4, 0XD552, 0XDDD4,
-  0XE656, 0XDE35, 0XDDF4, 0XD5F4, 0XD5B3, 0XD572, 0XD5D3, 0XD5F4,
-  0XD5D3, 0XCD71, 0XCD51, 0XD593, 0XCD10, 0XC48E, 0XBBCC, 0XBB4A,
-  0XCCAF, 0XCCD0, 0XCCAF, 0XCC8F, 0XC42D, 0XC40C, 0XC44D, 0XC4AE,
-  0XBCCF, 0XBCCF, 0XBCAE, 0XBC6D, 0XB44D, 0XB44D, 0XB44D, 0XB44D,
-  0XB42C, 0XB40C, 0XABEC, 0XABEC, 0XABCB, 0XAB8A, 0XA349, 0XA36A,
-  0XA369, 0XA349, 0X9AE8, 0X9AA7, 0X9AA7, 0X9287, 0X92A7, 0X92A7,
-  0X8A86, 0X8A46, 0X8A45, 0X8A25, 0X8205, 0X8205, 0X81E4, 0X81C4,
-  0X79A4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122, 0X7122,
-  0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X7102, 0X7102, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X79A3,
-  0X79A3, 0X7983, 0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A25, 0X8A45,
-  0X8A66, 0X9286, 0X92A7, 0X92C7, 0X92E7, 0X92E8, 0X9AE8, 0X9AC7,
-  0X9B08, 0XA349, 0XA369, 0XA38A, 0XAB8A, 0XABAA, 0XABCB, 0XABEB,
-  0XABEB, 0XB3EB, 0XB42C, 0XBC6C, 0XBC8D, 0XBCAD, 0XBCCE, 0XC4EF,
-  0XC4EF, 0XCCF0, 0XCD30, 0XC550, 0XC4EF, 0XCCAF, 0XCCEF, 0XCD30,
-  0XCD71, 0XCD91, 0XCD92, 0XCDB2, 0XCDB1, 0XCD71, 0XCD51, 0XD551,
-  0XCD51, 0XD5B3, 0XD5F3, 0XD5F4, 0XD5F4, 0XD5F4, 0XD614, 0XD5D3,
-  0XCDB3, 0XD5F3, 0XCDB2, 0XCD51, 0XC44E, 0XCC70, 0XD594, 0XD5B4,
-  0XCD73, 0XCD72, 0XD5B3, 0XD5B3, 0XD5B4, 0XD5F4, 0XD5D4, 0XD5D4,
-  0XD5D4, 0XD5B3, 0XD5B2, 0XD551, 0XD4F0, 0XDD72, 0XD552, 0XD572,
-  0XDE15, 0XD5F4, 0XD5D3, 0XD5F4, 0XD5D3, 0XD572, 0XD572, 0XD5D3,
-  0XD5B3, 0XCD72, 0XCD31, 0XCD51, 0XCD10, 0XC44D, 0XC44D, 0XBB6A,
-  0XBB29, 0XBB6A, 0XBB4A, 0XBB4A, 0XBB4A, 0XBB4A, 0XBB6A, 0XBC0C,
-  0XBC4D, 0XBC6E, 0XBC8E, 0XBC6D, 0XB42D, 0XB42D, 0XB42C, 0XB42C,
-  0XB42C, 0XABEC, 0XABEB, 0XABEB, 0XABAB, 0XA36A, 0XA329, 0XA329,
-  0XA329, 0X9B28, 0X9AC7, 0X9A67, 0X9287, 0X92A7, 0X9287, 0X9286,
-  0X8A66, 0X8A45, 0X8A25, 0X8205, 0X8205, 0X81E4, 0X81E4, 0X79C4,
-  0X79A3, 0X7983, 0X7963, 0X7963, 0X7142, 0X7122, 0X7122, 0X7102,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7142, 0X7963, 0X7983,
-  0X7983, 0X7983, 0X81A3, 0X81E4, 0X8204, 0X8204, 0X8A05, 0X8A25,
-  0X8A25, 0X8A66, 0X8A86, 0X9286, 0X92C7, 0X92C7, 0X9AC8, 0X9AC7,
-  0X9AC7, 0X9B08, 0X9B29, 0XA349, 0XA369, 0XAB8A, 0XAB8A, 0XAB8A,
-  0XABAA, 0XB3EB, 0XB42C, 0XB44C, 0XB44C, 0XBC6D, 0XBC8D, 0XBCAE,
-  0XC4CE, 0XC4CF, 0XC4EF, 0XC50F, 0XC4CD, 0XC48D, 0XC48D, 0XC4CE,
-  0XCD30, 0XCD30, 0XCD50, 0XCD50, 0XCD91, 0XCD91, 0XCD51, 0XCCF0,
-  0XCD30, 0XD5B3, 0XCDB3, 0XCDD3, 0XCDD3, 0XD5F3, 0XD5F3, 0XD5D3,
-  0XCDB3, 0XCDB3, 0XCD92, 0XCD51, 0XC48F, 0XC40D, 0XD532, 0XD5B3,
-  0XCD52, 0XCD52, 0XCD93, 0XCDB3, 0XD5D4, 0XD5F4, 0XD614, 0XD614,
-  0XD5F4, 0XD5D4, 0XD572, 0XD592, 0XCD52, 0XCCF0, 0XCCEF, 0XCCAF,
-  0XCCAF, 0XD552, 0XD5D3, 0XD5D3, 0XD5D3, 0XCD72, 0XCD31, 0XCD72,
-  0XCD92, 0XCD72, 0XC510, 0XC4CF, 0XC4CF, 0XBC2D, 0XC48E, 0XC46E,
-  0XBBAB, 0XBBAB, 0XBBEC, 0XBBCC, 0XBC0D, 0XBBCC, 0XB2E9, 0XB36A,
-  0XBC0C, 0XB40C, 0XBC4D, 0XB46D, 0XB42C, 0XB40C, 0XB40C, 0XAC0C,
-  0XABEC, 0XABCB, 0XABCB, 0XABCB, 0XAB8A, 0XA349, 0XA308, 0X9B08,
-  0X9B08, 0X9AC7, 0X9A87, 0X92A7, 0X92A7, 0X9286, 0X9286, 0X8A66,
-  0X8A46, 0X8A25, 0X8205, 0X8205, 0X81E4, 0X81C4, 0X79C4, 0X79A4,
-  0X7983, 0X7963, 0X7163, 0X7142, 0X7122, 0X7122, 0X7102, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7142, 0X7963,
-  0X7963, 0X7963, 0X79A3, 0X79C4, 0X81E4, 0X81E4, 0X81E4, 0X8205,
-  0X8A05, 0X8A45, 0X8A66, 0X8A86, 0X9286, 0X92A7, 0X92C7, 0X92C7,
-  0X9AA7, 0X9AE8, 0X9B08, 0X9B28, 0XA349, 0XA369, 0XA369, 0XAB48,
-  0XAB8A, 0XABEB, 0XB40B, 0XB42C, 0XB44C, 0XBC6D, 0XBC8D, 0XBC8D,
-  0XBC8D, 0XBCAD, 0XBCAD, 0XC48D, 0XBC8C, 0XBC2B, 0XBBCB, 0XC44C,
-  0XC4AE, 0XC50F, 0XC530, 0XCD51, 0XCD50, 0XCD71, 0XCD51, 0XC510,
-  0XCD10, 0XCD92, 0XCD92, 0XCD92, 0XCD91, 0XCD92, 0XCDB2, 0XCD92,
-  0XCD93, 0XCD72, 0XCD31, 0XCD51, 0XCD31, 0XC40D, 0XC42D, 0XCD11,
-  0XCD32, 0XC531, 0XCD93, 0XCDB3, 0XCDD3, 0XD5F4, 0XD5F4, 0XD5F4,
-  0XD5F4, 0XD5F4, 0XCDB3, 0XCDB3, 0XD5F4, 0XCD71, 0XC46E, 0XC3CC,
-  0XC40D, 0XCCAF, 0XCD51, 0XD5B3, 0XD592, 0XCD72, 0XC510, 0XC510,
-  0XCD31, 0XCD10, 0XC4EF, 0XC4CF, 0XC4CF, 0XBC2C, 0XBC4D, 0XC4CF,
-  0XBC8E, 0XC46E, 0XBC4D, 0XBC2D, 0XC44D, 0XBBAB, 0XAAA8, 0XB34A,
-  0XBC0C, 0XB40C, 0XB40C, 0XB40C, 0XB42C, 0XABEB, 0XABEB, 0XABEB,
-  0XABAA, 0XAB8A, 0XAB8A, 0XA38A, 0XA36A, 0XA309, 0X9AE8, 0X9AE8,
-  0X9AE8, 0X9A87, 0X9287, 0X92A7, 0X9286, 0X8A66, 0X8A66, 0X8A46,
-  0X8A25, 0X8205, 0X8205, 0X81E4, 0X81C4, 0X79A4, 0X79A3, 0X7983,
-  0X7963, 0X7163, 0X7142, 0X7122, 0X7122, 0X7102, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7142, 0X7142,
-  0X7962, 0X7962, 0X7983, 0X79A3, 0X79C4, 0X81C4, 0X81E4, 0X81E4,
-  0X8205, 0X8A25, 0X8A45, 0X8A66, 0X8A86, 0X9266, 0X92A6, 0X92C7,
-  0X9AC7, 0X9AE8, 0X9AE8, 0X9B08, 0X9B49, 0XA349, 0XA348, 0XA369,
-  0XAB8A, 0XABAA, 0XABEB, 0XB40B, 0XB42C, 0XB44C, 0XBC6D, 0XBC6D,
-  0XB46C, 0XBC4C, 0XBC6D, 0XBC6D, 0XBC8D, 0XBC4C, 0XBBEB, 0XBC6D,
-  0XC4AE, 0XC4EF, 0XC510, 0XC530, 0XC530, 0XC52F, 0XC50F, 0XC4EF,
-  0XC4CF, 0XCD31, 0XCD71, 0XCD51, 0XC530, 0XCD51, 0XCD71, 0XCD92,
-  0XCD92, 0XCD51, 0XC4EF, 0XCD31, 0XCD72, 0XC4EF, 0XBBCB, 0XBB8C,
-  0XC44F, 0XC4B0, 0XC552, 0XCD92, 0XCD92, 0XCDB3, 0XCD92, 0XCD51,
-  0XCD72, 0XCD92, 0XCD72, 0XCD92, 0XCD92, 0XC572, 0XC551, 0XC4AF,
-  0XC46E, 0XCCAF, 0XCCAF, 0XCD30, 0XCD51, 0XCD10, 0XC48F, 0XC48F,
-  0XC4AF, 0XC4CF, 0XC4CF, 0XC4CF, 0XC48E, 0XBC0C, 0XBC0D, 0XBCAE,
-  0XBC6D, 0XBC0C, 0XBC2D, 0XBC6E, 0XBC2D, 0XAAE9, 0XAA88, 0XB38B,
-  0XB42C, 0XB42C, 0XAC0C, 0XABCB, 0XABCB, 0XABCB, 0XABAB, 0XABAB,
-  0XAB8A, 0XA349, 0XA36A, 0XA349, 0X9B29, 0X9AE8, 0X9AC8, 0X9AE8,
-  0X92A7, 0X9246, 0X9266, 0X9287, 0X8A66, 0X8A46, 0X8A25, 0X8225,
-  0X8204, 0X81E4, 0X81E4, 0X81C4, 0X79A4, 0X79A3, 0X7983, 0X7963,
-  0X7163, 0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7142, 0X7942, 0X7963, 0X7983, 0X79A3, 0X79C4, 0X81C4, 0X81C4,
-  0X81E4, 0X8205, 0X8A05, 0X8A25, 0X8A45, 0X8A66, 0X9286, 0X92A7,
-  0X92C7, 0X9AC7, 0X9AE8, 0X9AE8, 0X9B28, 0XA308, 0XA307, 0XA369,
-  0XA369, 0XA369, 0XABCA, 0XABEB, 0XAC0B, 0XB42C, 0XB42C, 0XB42C,
-  0XB44C, 0XB42C, 0XBC6D, 0XBC4C, 0XBC2B, 0XBC4C, 0XBC4C, 0XBC2D,
-  0XBC4D, 0XC48E, 0XC4EF, 0XC50F, 0XC510, 0XC530, 0XC4EF, 0XC4CE,
-  0XC4AD, 0XC4AE, 0XC510, 0XC530, 0XC530, 0XCD51, 0XC571, 0XCD51,
-  0XCD71, 0XCD30, 0XC4AE, 0XC4F0, 0XCD51, 0XC510, 0XC4AF, 0XBC0D,
-  0XBB6A, 0XBBAC, 0XC48F, 0XCD51, 0XCD71, 0XC531, 0XC530, 0XC4F0,
-  0XC4F0, 0XC510, 0XC510, 0XC510, 0XCD51, 0XCD51, 0XC551, 0XC551,
-  0XC4CF, 0XC46E, 0XC46E, 0XC46E, 0XC46E, 0XBC2D, 0XC46E, 0XBC2D,
-  0XBC4D, 0XC4AF, 0XBCAE, 0XC4CF, 0XBC8E, 0XBBEC, 0XBBEC, 0XBC4D,
-  0XBC2D, 0XBC2D, 0XBC0C, 0XBBCC, 0XB329, 0XA246, 0XAAC8, 0XB3AB,
-  0XAC0B, 0XAC0C, 0XABEB, 0XABCB, 0XABAA, 0XAB8A, 0XA36A, 0XA36A,
-  0XA349, 0XA349, 0XA329, 0X9B08, 0X9B08, 0X9AC7, 0X92A7, 0X92A7,
-  0X9246, 0X9246, 0X9266, 0X8A66, 0X8A45, 0X8A25, 0X8A25, 0X8205,
-  0X81E4, 0X81C4, 0X81C4, 0X79A4, 0X79A3, 0X7983, 0X7963, 0X7163,
-  0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122,
-  0X7122, 0X7142, 0X7943, 0X7963, 0X7983, 0X7983, 0X79A3, 0X81A4,
-  0X81C4, 0X81E4, 0X8205, 0X8A05, 0X8A25, 0X8A45, 0X8A66, 0X9286,
-  0X92A7, 0X92C7, 0X92C7, 0X9AE7, 0X9B08, 0X9AE7, 0X9AE7, 0XA349,
-  0XA349, 0XA369, 0XAB8A, 0XABAA, 0XABCB, 0XABEB, 0XABEB, 0XB40B,
-  0XB42C, 0XB44C, 0XB44C, 0XB3EA, 0XBC2C, 0XBC4C, 0XBC4C, 0XBC4D,
-  0XB40C, 0XBC4D, 0XBCAE, 0XBCEF, 0XC4EF, 0XC4EF, 0XC4EF, 0XC4EF,
-  0XC4AE, 0XC44C, 0XC48E, 0XC4F0, 0XC510, 0XC530, 0XC530, 0XC530,
-  0XC530, 0XC50F, 0XC4AE, 0XC4AE, 0XCCF0, 0XC4CF, 0XBCD0, 0XBCCF,
-  0XBC0C, 0XB32A, 0XBBCC, 0XC4F0, 0XC4F0, 0XC4CF, 0XC511, 0XC531,
-  0XC510, 0XC510, 0XC530, 0XC4F0, 0XBCCF, 0XC4F0, 0XC510, 0XC510,
-  0XC4F0, 0XBC4D, 0XBBEC, 0XBBEC, 0XB38B, 0XBC0D, 0XC4AF, 0XBC4D,
-  0XBC2D, 0XBC6E, 0XBC8E, 0XC4AF, 0XBC8E, 0XB40C, 0XB3AB, 0XBBEC,
-  0XBBCC, 0XB34A, 0XAAA8, 0XA267, 0X9A26, 0XA267, 0XAB08, 0XB3AB,
-  0XABEB, 0XABEB, 0XABCB, 0XABAB, 0XABAA, 0XA36A, 0XA36A, 0XA349,
-  0XA329, 0X9B29, 0X9B08, 0X9B08, 0X9AA7, 0X9A66, 0X9287, 0X9287,
-  0X9225, 0X9245, 0X8A46, 0X8A25, 0X8A25, 0X8A05, 0X8205, 0X81E4,
-  0X81E4, 0X81A3, 0X79A3, 0X7983, 0X7983, 0X7963, 0X7163, 0X7142,
-  0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X7983, 0X79A3,
-  0X79A3, 0X81C4, 0X81E4, 0X81E4, 0X8A05, 0X8A25, 0X8A45, 0X8A66,
-  0X9286, 0X9286, 0X92A7, 0X92C7, 0X9AE7, 0X9AC7, 0X9AC7, 0X9B28,
-  0XA348, 0XA349, 0XA349, 0XAB8A, 0XABAA, 0XABAA, 0XABCA, 0XABCB,
-  0XB40B, 0XB42C, 0XB40A, 0XB3CA, 0XB40C, 0XB40B, 0XB42C, 0XBC4D,
-  0XB40C, 0XB42C, 0XBC4D, 0XBC8E, 0XBCAE, 0XBCAE, 0XBCCE, 0XBCCF,
-  0XC4AE, 0XBC6D, 0XBC2C, 0XC48E, 0XC4EF, 0XC50F, 0XC4F0, 0XC4EF,
-  0XC4F0, 0XBCEF, 0XBCAE, 0XC48E, 0XC4AE, 0XBCCF, 0XBCAE, 0XBC6D,
-  0XBC2D, 0XB36A, 0XB32A, 0XBC4E, 0XBC6E, 0XBC6E, 0XBCAF, 0XC4D0,
-  0XC4EF, 0XBCCF, 0XC510, 0XC510, 0XBCAF, 0XB48E, 0XBCAF, 0XC4AF,
-  0XBC8D, 0XBC4D, 0XBC4D, 0XB40C, 0XB3AB, 0XB3CC, 0XBC2D, 0XBC2D,
-  0XBC4D, 0XBC4D, 0XBC4D, 0XBC4D, 0XBC4D, 0XBC2D, 0XB3AB, 0XB36B,
-  0XAAC9, 0XAA67, 0XA288, 0XA2A7, 0XAAE8, 0XAB09, 0XAB29, 0XAB8A,
-  0XABAA, 0XABAA, 0XABAA, 0XA38A, 0XA38A, 0XA36A, 0XA349, 0X9B49,
-  0X9B08, 0X9AE8, 0X9AE8, 0X9AC7, 0X9287, 0X9246, 0X9266, 0X9286,
-  0X8A25, 0X89E4, 0X8A05, 0X8A05, 0X8205, 0X81E4, 0X81E4, 0X81C4,
-  0X79C4, 0X79A3, 0X7983, 0X7963, 0X7963, 0X7163, 0X7142, 0X7122,
-  0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7963, 0X7983,
-  0X7983, 0X79A3, 0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X8A04, 0X8A25,
-  0X8A66, 0X8A66, 0X9286, 0X92A6, 0X92A7, 0X9286, 0X9AC7, 0X9B08,
-  0X9B08, 0X9B28, 0XA349, 0XA369, 0XA389, 0XA389, 0XA38A, 0XABCA,
-  0XABEB, 0XABEB, 0XABCA, 0XABCA, 0XB3EB, 0XB3EB, 0XB40C, 0XB42C,
-  0XB42B, 0XB40B, 0XB40C, 0XBC2D, 0XBC8D, 0XBC8D, 0XBCAE, 0XBC8D,
-  0XBC8D, 0XBC8D, 0XBC0C, 0XBC0C, 0XBC8E, 0XBCAE, 0XBCCF, 0XBCEF,
-  0XBCEF, 0XBCCE, 0XBC8E, 0XBC8D, 0XBC6D, 0XBC8E, 0XBC8E, 0XBC2D,
-  0XBC0C, 0XB36A, 0XAB09, 0XB3AC, 0XBC2D, 0XBC4E, 0XBC8E, 0XBC8F,
-  0XBCAF, 0XBCCF, 0XBCCF, 0XBCCF, 0XBCAF, 0XBCAF, 0XBCAF, 0XBC8E,
-  0XB42C, 0XBC2C, 0XBC8E, 0XBC8E, 0XBC6D, 0XB40C, 0XAB6A, 0XAB4A,
-  0XB3CC, 0XB3CC, 0XB38B, 0XB36A, 0XB36B, 0XB38B, 0XB36A, 0XAAC9,
-  0XA247, 0XAAC9, 0XAB08, 0XB329, 0XB36A, 0XAB4A, 0XAB49, 0XA369,
-  0XA369, 0XAB8A, 0XA36A, 0XA369, 0XA349, 0X9B29, 0X9B29, 0X9B08,
-  0X9AE8, 0X9AC7, 0X92A7, 0X9287, 0X9266, 0X9246, 0X9246, 0X8A46,
-  0X8A25, 0X8A05, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X79A4,
-  0X79A3, 0X7983, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X7122,
-  0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X7102, 0X7102, 0X7122, 0X7142, 0X7142, 0X7962, 0X7963,
-  0X7963, 0X7983, 0X79A3, 0X81C4, 0X81C4, 0X81C4, 0X81E4, 0X8A04,
-  0X8A25, 0X8A46, 0X8A66, 0X9286, 0X9286, 0X9266, 0X92A7, 0X9AE8,
-  0X9AE8, 0X9AE7, 0X9B08, 0X9B28, 0XA349, 0XA369, 0XA369, 0XA38A,
-  0XABCA, 0XABAA, 0XAB89, 0XABAA, 0XABAA, 0XABCB, 0XB40B, 0XB40B,
-  0XB40B, 0XB3EB, 0XB3CB, 0XB3EC, 0XBC2C, 0XBC6D, 0XBC6D, 0XBC6D,
-  0XBC6D, 0XBC6D, 0XB42C, 0XB3EC, 0XBC4D, 0XB46D, 0XBC8E, 0XBCAE,
-  0XBCAE, 0XBC6D, 0XBC6D, 0XBC4D, 0XB44D, 0XB44D, 0XBC2C, 0XBBEC,
-  0XBBAB, 0XAB2A, 0XA32A, 0XB3CC, 0XBC4E, 0XBC8E, 0XBC8E, 0XBC8E,
-  0XBC8E, 0XBC8E, 0XBC8E, 0XBC8E, 0XBC8E, 0XBCAE, 0XBCAE, 0XBCAE,
-  0XB48E, 0XB40C, 0XB42C, 0XB46D, 0XB44C, 0XB44C, 0XB3CB, 0XAB09,
-  0XAAC8, 0XAB09, 0XB34B, 0XB38B, 0XB38B, 0XAB4A, 0XA2A8, 0X9A46,
-  0X9A26, 0XAAC8, 0XAB08, 0XAB08, 0XAB29, 0XAB49, 0XA349, 0XA369,
-  0XA349, 0XA349, 0XA349, 0X9B29, 0X9B29, 0X9B08, 0X9AE8, 0X9AE8,
-  0X9AC7, 0X92A7, 0X92A7, 0X9287, 0X9266, 0X8A05, 0X8A25, 0X8A25,
-  0X8A05, 0X8A05, 0X81E4, 0X81A4, 0X81A4, 0X81A4, 0X79A3, 0X79A3,
-  0X7983, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X7122, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6902, 0X7102, 0X7102, 0X7122, 0X7142, 0X7142, 0X7963,
-  0X7963, 0X7963, 0X7983, 0X79A3, 0X81A3, 0X81C4, 0X81E4, 0X81E4,
-  0X8A04, 0X8A25, 0X8A25, 0X8A45, 0X8A66, 0X9225, 0X9286, 0X92C7,
-  0X92C7, 0X9AC7, 0X9AE8, 0X9B08, 0X9B28, 0XA349, 0XA349, 0XA349,
-  0XA38A, 0XA389, 0XA368, 0XAB69, 0XAB89, 0XABAA, 0XABEB, 0XABEB,
-  0XABEB, 0XABCB, 0XABAA, 0XB3CB, 0XB3CB, 0XB40C, 0XB42C, 0XB42D,
-  0XB44D, 0XB44D, 0XBC2C, 0XB3EB, 0XB40C, 0XB46D, 0XB46D, 0XBC6D,
-  0XB44C, 0XB40B, 0XBC2C, 0XB42D, 0XB42D, 0XB44D, 0XB3EC, 0XB36A,
-  0XAB09, 0XA2E9, 0XAB0A, 0XB3CC, 0XBC4D, 0XB46E, 0XB44D, 0XB46D,
-  0XB48E, 0XB46D, 0XB44D, 0XB42C, 0XB46D, 0XB46D, 0XB46D, 0XB46E,
-  0XB46E, 0XB42C, 0XB3CB, 0XB3EB, 0XB42C, 0XB44D, 0XB42C, 0XABEC,
-  0XA309, 0XA2A8, 0XAAE9, 0XAB4A, 0XAB29, 0XA2C8, 0X9A67, 0X9206,
-  0X9205, 0X9A67, 0XAB08, 0XA2E8, 0XA308, 0XA329, 0XA349, 0XA349,
-  0X9B29, 0X9B28, 0X9B08, 0X9B08, 0X9B08, 0X9AE8, 0X9AC8, 0X92C7,
-  0X92A7, 0X92A7, 0X9287, 0X9266, 0X8A25, 0X89E4, 0X89E5, 0X8A05,
-  0X81E4, 0X81C4, 0X81C4, 0X81A4, 0X81A4, 0X7983, 0X7983, 0X7963,
-  0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X7102, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X7102, 0X7102, 0X7122, 0X7122, 0X7142,
-  0X7962, 0X7963, 0X7963, 0X7963, 0X7963, 0X7983, 0X81C4, 0X81E4,
-  0X81E4, 0X81E4, 0X89E4, 0X8A05, 0X8A05, 0X8A04, 0X9245, 0X9286,
-  0X9286, 0X92A7, 0X92C7, 0X9AE8, 0X9B08, 0X9B08, 0X9B28, 0X9B28,
-  0XA349, 0XA369, 0XA349, 0XA348, 0XA349, 0XAB8A, 0XABAA, 0XABAA,
-  0XABCA, 0XABCB, 0XABAA, 0XAB69, 0XABAA, 0XABCB, 0XB3EB, 0XB40C,
-  0XB40C, 0XB40C, 0XB40C, 0XB3CB, 0XB3CB, 0XB42C, 0XB42C, 0XB42C,
-  0XB40C, 0XB3CB, 0XB3EC, 0XB42D, 0XB42D, 0XB40C, 0XB3CB, 0XAB4A,
-  0X9A87, 0XA2A8, 0XAB0A, 0XAB6B, 0XB40C, 0XB42D, 0XB42D, 0XB44D,
-  0XB44D, 0XB44D, 0XB44D, 0XB42C, 0XB42C, 0XB44D, 0XB44D, 0XB42D,
-  0XB42D, 0XAC0C, 0XAB69, 0XAB8A, 0XABEC, 0XAC0C, 0XABEB, 0XABEB,
-  0XAB6A, 0XA309, 0XA329, 0XA2E9, 0XA2C8, 0X9A87, 0X9A46, 0X9226,
-  0X91E5, 0X9206, 0XA2A8, 0XA2E8, 0XA2C7, 0XA2E8, 0X9B08, 0X9B29,
-  0X9B28, 0X9B08, 0X9AE8, 0X92C7, 0X92C7, 0X92C7, 0X92A7, 0X92A7,
-  0X9287, 0X9286, 0X8A66, 0X8A45, 0X8A05, 0X89E4, 0X81E4, 0X81C4,
-  0X81A4, 0X8183, 0X81A4, 0X79A4, 0X7983, 0X7983, 0X7963, 0X7942,
-  0X7142, 0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7142, 0X7142, 0X7942, 0X7942, 0X7963, 0X7983, 0X79A3, 0X81A4,
-  0X81C4, 0X81E4, 0X81E4, 0X8204, 0X89E4, 0X89E4, 0X8A25, 0X8A46,
-  0X9266, 0X9286, 0X92A7, 0X92A7, 0X92C7, 0X9AE7, 0X9AE8, 0X9B08,
-  0X9B08, 0XA349, 0XA328, 0XA307, 0XA349, 0XA369, 0XA369, 0XA38A,
-  0XAB8A, 0XABAA, 0XAB69, 0XAB29, 0XAB09, 0XAB49, 0XABAA, 0XABCB,
-  0XABEB, 0XABEB, 0XB3EB, 0XABCB, 0XAB8A, 0XB3CB, 0XABEB, 0XAC0C,
-  0XB40C, 0XB3EB, 0XB3EC, 0XB40C, 0XAC0C, 0XABCB, 0XAB8A, 0XA2E8,
-  0X9A46, 0XA2C8, 0XAB09, 0XAB09, 0XABAB, 0XAC0C, 0XAC0C, 0XAC0C,
-  0XAC2C, 0XAC2C, 0XB42D, 0XAC0C, 0XABEC, 0XAC0C, 0XAC0C, 0XAC0C,
-  0XAC0C, 0XABAA, 0XAB49, 0XABCB, 0XABEB, 0XABCB, 0XABCB, 0XA3AB,
-  0XA308, 0XA2C8, 0XA349, 0XAB49, 0XA329, 0X9B08, 0X9246, 0X9205,
-  0X9206, 0X91E5, 0X91E5, 0X9A66, 0X9AA7, 0X9AA7, 0X9AC8, 0X9B08,
-  0X9AE8, 0X9AE8, 0X92C7, 0X92A7, 0X92A7, 0X92A7, 0X9287, 0X9286,
-  0X8A66, 0X8A66, 0X8A45, 0X8A05, 0X81E5, 0X81C4, 0X81C4, 0X81A4,
-  0X8183, 0X7983, 0X79A4, 0X7983, 0X7983, 0X7963, 0X7942, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122,
-  0X7122, 0X7122, 0X7142, 0X7942, 0X7963, 0X7983, 0X7983, 0X7983,
-  0X81A4, 0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X8A25, 0X8A25,
-  0X8A45, 0X8A66, 0X9266, 0X9286, 0X9287, 0X92A7, 0X92C7, 0X9AC7,
-  0X9AE7, 0X9AC7, 0X9A86, 0X9A86, 0X9B08, 0XA349, 0XA349, 0XA349,
-  0XA369, 0XA369, 0XA349, 0XA329, 0XA287, 0XA286, 0XAB49, 0XAB8A,
-  0XAB8A, 0XABAA, 0XABCB, 0XABCB, 0XAB6A, 0XAB6A, 0XABCB, 0XABEB,
-  0XABEB, 0XABCA, 0XABEB, 0XABEB, 0XABEB, 0XABCB, 0XAB29, 0XA287,
-  0X9A67, 0XAAE9, 0XAB29, 0XAB29, 0XAB8A, 0XABAB, 0XABCB, 0XABCB,
-  0XABEC, 0XAC0C, 0XAC0C, 0XABEC, 0XABEB, 0XABCB, 0XABCB, 0XABEB,
-  0XABEB, 0XA349, 0XA2E8, 0XAB8A, 0XABCB, 0XA3AB, 0XA3AA, 0XA36A,
-  0XA2E8, 0X9AA7, 0XA309, 0XA329, 0XA308, 0XA309, 0X9266, 0X9205,
-  0X9226, 0X9226, 0X91E5, 0X91E5, 0X9266, 0X9A66, 0X9A86, 0X9AC7,
-  0X92C7, 0X92C7, 0X92A7, 0X9286, 0X9286, 0X9287, 0X8A66, 0X8A46,
-  0X8A45, 0X8A25, 0X8A25, 0X81E4, 0X81C4, 0X81C4, 0X81A4, 0X7983,
-  0X7963, 0X7983, 0X7983, 0X7963, 0X7963, 0X7163, 0X7142, 0X7122,
-  0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902,
-  0X7102, 0X7122, 0X7122, 0X7142, 0X7942, 0X7963, 0X7963, 0X7983,
-  0X7983, 0X79A4, 0X81C4, 0X81C4, 0X81C4, 0X81E4, 0X8205, 0X8205,
-  0X8A25, 0X8A25, 0X8A46, 0X8A66, 0X9286, 0X9286, 0X92A7, 0X92A7,
-  0X9286, 0X9265, 0X9266, 0X9AA7, 0X9AC7, 0X9B08, 0X9B28, 0X9B28,
-  0XA349, 0XA329, 0XA329, 0XA329, 0XA2C8, 0XA2A7, 0XA309, 0XA329,
-  0XA349, 0XA349, 0XAB69, 0XAB69, 0XAB29, 0XAB49, 0XAB8A, 0XABCB,
-  0XABAA, 0XAB89, 0XABAA, 0XABCB, 0XABEB, 0XAB8A, 0XA2E8, 0X9A87,
-  0X9A66, 0XA2C8, 0XAB29, 0XA329, 0XAB8A, 0XABAB, 0XABCB, 0XABAA,
-  0XABAA, 0XABCB, 0XABCB, 0XABCB, 0XA3CB, 0XA3AA, 0XA38A, 0XA3AA,
-  0XABAA, 0XA328, 0X9AA6, 0XA329, 0XA38A, 0XA36A, 0XA369, 0XA329,
-  0X9AC7, 0X9AE8, 0XA329, 0X9B08, 0X9AC7, 0X9AE8, 0X9A87, 0X9205,
-  0X9226, 0X9246, 0X9225, 0X89C4, 0X89E5, 0X9246, 0X9246, 0X9266,
-  0X92A7, 0X9287, 0X9286, 0X8A66, 0X8A46, 0X8A46, 0X8A45, 0X8A25,
-  0X8A25, 0X8205, 0X8205, 0X81C4, 0X81A4, 0X81A4, 0X7983, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7142, 0X7142, 0X7122, 0X7122,
-  0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7963,
-  0X7983, 0X7983, 0X79A3, 0X79A3, 0X81A3, 0X81C4, 0X81E4, 0X8204,
-  0X8204, 0X8A05, 0X8A25, 0X8A45, 0X8A46, 0X8A66, 0X9286, 0X9286,
-  0X9245, 0X9225, 0X9266, 0X9AA7, 0X9AC7, 0X9AA6, 0X9AC7, 0X9AE7,
-  0X9B08, 0X9AE8, 0X9AC7, 0X9AA7, 0X9AC7, 0XA308, 0XA328, 0XA308,
-  0XA329, 0XA329, 0XA308, 0XAB08, 0XA2C7, 0XA2E8, 0XAB6A, 0XA36A,
-  0XAB49, 0XA349, 0XAB8A, 0XABAA, 0XA3AA, 0XA349, 0XA2E8, 0X9A87,
-  0XA267, 0XA287, 0XA2E8, 0XA308, 0XA36A, 0XA38A, 0XA38A, 0XA36A,
-  0XA36A, 0XA38A, 0XA38A, 0XA38A, 0XA36A, 0XA38A, 0XA36A, 0XA369,
-  0XA36A, 0XA329, 0X9AA7, 0X9AC7, 0XA308, 0XA308, 0XA349, 0X9B08,
-  0X9AA7, 0X9AE8, 0X9B29, 0X9AE8, 0X9AC7, 0X9AC8, 0X9287, 0X89E4,
-  0X8A05, 0X9226, 0X8A25, 0X89E4, 0X81A4, 0X89E4, 0X9205, 0X9225,
-  0X9245, 0X8A46, 0X8A46, 0X8A45, 0X8A25, 0X8A05, 0X89E4, 0X8205,
-  0X8205, 0X81E4, 0X81E4, 0X81A4, 0X81A4, 0X79A3, 0X7983, 0X7942,
-  0X7943, 0X7963, 0X7943, 0X7142, 0X7142, 0X7122, 0X7122, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963,
-  0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X79A3, 0X81C4, 0X81C4,
-  0X81C4, 0X81E4, 0X8205, 0X8A25, 0X8A25, 0X8A45, 0X8A66, 0X8A45,
-  0X8A04, 0X8A25, 0X9266, 0X9286, 0X92A7, 0X92A6, 0X9286, 0X9AA6,
-  0X9A86, 0X9A86, 0X9A86, 0X9A66, 0X9AA6, 0X9B08, 0X9B28, 0X9B28,
-  0X9B08, 0XA2E8, 0XA2C7, 0XA308, 0XA2C7, 0X9A66, 0XA308, 0XA349,
-  0XA308, 0XA329, 0XA369, 0XA369, 0XA369, 0XA328, 0XA2C8, 0X9A67,
-  0X9A66, 0X9A66, 0X9AA7, 0XA2E8, 0XA349, 0XA36A, 0XA349, 0XA329,
-  0XA349, 0XA36A, 0XA36A, 0XA369, 0XA369, 0XA369, 0XA349, 0XA329,
-  0XA349, 0X9B08, 0X9AA7, 0X9AC7, 0X9AA7, 0X9AA7, 0X9AC8, 0X9AC7,
-  0X9AA7, 0X9AC8, 0X9B08, 0X9AE8, 0X9AC7, 0X92A7, 0X9286, 0X8A05,
-  0X81C4, 0X8A05, 0X8A05, 0X8A05, 0X81A4, 0X8184, 0X89E4, 0X8A05,
-  0X8A25, 0X8A25, 0X8A05, 0X8A04, 0X8A05, 0X8205, 0X81E4, 0X81E4,
-  0X81E4, 0X81C4, 0X79A4, 0X7983, 0X7983, 0X7983, 0X7963, 0X7942,
-  0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7102, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7142,
-  0X7142, 0X7963, 0X7963, 0X7963, 0X7963, 0X7983, 0X7983, 0X79A3,
-  0X81A4, 0X81C4, 0X81E4, 0X8204, 0X8205, 0X8A25, 0X8A25, 0X8A04,
-  0X8A04, 0X8A46, 0X8A66, 0X9286, 0X9286, 0X9287, 0X92A7, 0X9265,
-  0X9225, 0X9246, 0X9266, 0X9266, 0X9AA6, 0X9AC7, 0X9AE8, 0X9B08,
-  0X9B08, 0X9AE7, 0X9A87, 0X9AA7, 0X9A87, 0X9A46, 0X9AA7, 0XA2C7,
-  0XA2A7, 0XA308, 0X9B29, 0X9B29, 0XA329, 0XA2E8, 0XA2C7, 0X9AA7,
-  0X9226, 0X9246, 0X9A86, 0X9AC8, 0XA329, 0XA349, 0XA308, 0XA2E8,
-  0X9B29, 0X9B49, 0XA349, 0X9B49, 0X9B49, 0X9B29, 0X9B28, 0X9B08,
-  0X9AE8, 0X9AA7, 0X9AC7, 0X9AC8, 0X9287, 0X9266, 0X9287, 0X92A7,
-  0X9AA7, 0X9AA7, 0X92E8, 0X92C7, 0X92A7, 0X92A7, 0X9266, 0X8A25,
-  0X81C4, 0X89E4, 0X8A05, 0X89E4, 0X81A4, 0X8184, 0X81C4, 0X89E4,
-  0X8A05, 0X8A05, 0X8205, 0X81C4, 0X81C4, 0X81E4, 0X81C4, 0X81C4,
-  0X81C4, 0X79A4, 0X7983, 0X7963, 0X7963, 0X7943, 0X7142, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X7122, 0X6902, 0X6902, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7122, 0X7142, 0X7162, 0X7142, 0X7962, 0X7963, 0X7963, 0X7983,
-  0X7983, 0X81A3, 0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81C4,
-  0X8A05, 0X8A25, 0X8A45, 0X8A46, 0X8A66, 0X8A66, 0X9286, 0X9266,
-  0X9225, 0X9266, 0X9286, 0X92A7, 0X92A7, 0X9AA6, 0X9AA7, 0X9AC7,
-  0X9AE8, 0X9AE8, 0X9AA7, 0X9A46, 0X9A46, 0X9AA7, 0X9A87, 0X9A66,
-  0X9A66, 0X9AC7, 0X9B08, 0X9B08, 0X9B08, 0X9AE8, 0XA2E8, 0X9AC7,
-  0X9225, 0X9226, 0X9A46, 0X9A87, 0X9B08, 0X9B08, 0X9AE8, 0XA2C8,
-  0X9AE8, 0X9B28, 0X9B29, 0X9B08, 0X9B08, 0X9B28, 0X9B08, 0X9AE8,
-  0X9AA7, 0X9266, 0X9AA7, 0X9287, 0X9287, 0X9287, 0X9266, 0X9287,
-  0X9287, 0X9287, 0X92A7, 0X92A7, 0X9286, 0X9266, 0X8A46, 0X8A05,
-  0X81C4, 0X81C4, 0X81E4, 0X81C4, 0X81A4, 0X8183, 0X81A4, 0X81C4,
-  0X81C4, 0X81E4, 0X81C4, 0X81C4, 0X81A4, 0X81A4, 0X7983, 0X7983,
-  0X7983, 0X7983, 0X7963, 0X7963, 0X7942, 0X7122, 0X7122, 0X7122,
-  0X7122, 0X7122, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7983, 0X79A3, 0X79A3, 0X81C4, 0X81C4, 0X8183, 0X81C4,
-  0X8205, 0X8205, 0X8A25, 0X8A25, 0X8A45, 0X8A45, 0X8A46, 0X8A46,
-  0X8A25, 0X9225, 0X9266, 0X9286, 0X92A7, 0X92A7, 0X9286, 0X92A6,
-  0X92A7, 0X92C7, 0X92A7, 0X9266, 0X9266, 0X9AA7, 0X9A86, 0X9245,
-  0X9225, 0X9A67, 0X9AA7, 0X9AC7, 0X9AE8, 0X9AE8, 0X9AC8, 0X9AA7,
-  0X9245, 0X9205, 0X9226, 0X9246, 0X9AC8, 0X9AE8, 0X9AC8, 0X9AC7,
-  0X9AC7, 0X9AC7, 0X9AC7, 0X92A7, 0X9AA7, 0X9AE8, 0X9AE8, 0X9AC7,
-  0X9266, 0X9246, 0X9286, 0X9286, 0X92A7, 0X92A7, 0X9286, 0X8A66,
-  0X8A66, 0X8A66, 0X9266, 0X8A66, 0X8A46, 0X8A25, 0X8A25, 0X8A05,
-  0X81C4, 0X81A3, 0X81A4, 0X81A4, 0X8183, 0X7963, 0X8183, 0X81A3,
-  0X81A4, 0X81C4, 0X81C4, 0X81A4, 0X79A4, 0X79A4, 0X7983, 0X7963,
-  0X7963, 0X7963, 0X7942, 0X7142, 0X7122, 0X7122, 0X7122, 0X7122,
-  0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7102, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7162,
-  0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X7983, 0X81A3, 0X81C4,
-  0X81E4, 0X81E4, 0X8204, 0X8205, 0X8205, 0X8A25, 0X8A25, 0X8A25,
-  0X8A05, 0X8A05, 0X8A46, 0X8A66, 0X9266, 0X9266, 0X9286, 0X9286,
-  0X9286, 0X9266, 0X9245, 0X9266, 0X9266, 0X9266, 0X9286, 0X9246,
-  0X9205, 0X9226, 0X9A67, 0X9AA7, 0X9AA7, 0X9A87, 0X9A66, 0X9A66,
-  0X9245, 0X9205, 0X9226, 0X9226, 0X9287, 0X9AC7, 0X92A7, 0X9287,
-  0X92C7, 0X9287, 0X9266, 0X9287, 0X92A7, 0X9266, 0X9286, 0X9287,
-  0X9246, 0X9225, 0X9266, 0X9266, 0X9286, 0X9286, 0X9266, 0X8A66,
-  0X8A45, 0X8A25, 0X8A46, 0X8A25, 0X8A25, 0X8A25, 0X8A05, 0X8A05,
-  0X81C4, 0X8183, 0X8183, 0X8183, 0X7983, 0X7963, 0X7983, 0X7983,
-  0X7983, 0X79A3, 0X79A4, 0X7983, 0X7983, 0X7983, 0X7963, 0X7963,
-  0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7102, 0X7102, 0X7102,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X7102, 0X7102, 0X7122, 0X7122, 0X7122, 0X7142,
-  0X7142, 0X7142, 0X7942, 0X7942, 0X7962, 0X7983, 0X79A3, 0X79A4,
-  0X81C4, 0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X8204, 0X8205, 0X8205,
-  0X8A05, 0X8A05, 0X8A05, 0X8A25, 0X8A46, 0X8A46, 0X8A46, 0X8A66,
-  0X8A66, 0X9246, 0X9245, 0X9265, 0X9225, 0X9245, 0X9266, 0X9245,
-  0X9225, 0X9225, 0X9226, 0X9246, 0X9286, 0X9266, 0X9246, 0X9246,
-  0X9225, 0X89E5, 0X9225, 0X8A05, 0X9246, 0X9287, 0X9286, 0X9266,
-  0X9266, 0X9266, 0X9286, 0X9287, 0X92A7, 0X9266, 0X9246, 0X9286,
-  0X9246, 0X89E4, 0X8A05, 0X8A46, 0X8A66, 0X8A66, 0X8A46, 0X8A46,
-  0X8A25, 0X8A05, 0X8A25, 0X8A25, 0X8205, 0X8205, 0X8205, 0X81E4,
-  0X81A4, 0X7963, 0X7963, 0X7963, 0X7963, 0X7943, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7983, 0X7963, 0X7963, 0X7963, 0X7963, 0X7943,
-  0X7142, 0X7122, 0X7122, 0X7122, 0X7102, 0X6902, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7122, 0X7122, 0X7122, 0X7142, 0X7963, 0X7963, 0X7983, 0X7983,
-  0X79A3, 0X79A3, 0X79A4, 0X81C4, 0X81C4, 0X81E4, 0X81E4, 0X81E4,
-  0X81E4, 0X81E4, 0X81E4, 0X8A05, 0X8A25, 0X8A25, 0X8A25, 0X8A25,
-  0X8A25, 0X8A46, 0X8A66, 0X8A46, 0X8A25, 0X8A05, 0X8A25, 0X8A25,
-  0X9245, 0X9246, 0X9246, 0X9225, 0X9225, 0X9266, 0X9246, 0X9225,
-  0X8A05, 0X89C4, 0X8A05, 0X8A05, 0X8A05, 0X9266, 0X9246, 0X9245,
-  0X9245, 0X9246, 0X9266, 0X8A66, 0X8A46, 0X8A46, 0X8A25, 0X9245,
-  0X8A04, 0X89E4, 0X8A05, 0X8A25, 0X8A46, 0X8A46, 0X8A45, 0X8A25,
-  0X8A05, 0X81E4, 0X81E5, 0X8205, 0X8205, 0X81E4, 0X81E4, 0X81C4,
-  0X7983, 0X7963, 0X7963, 0X7963, 0X7963, 0X7943, 0X7942, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7943, 0X7143, 0X7142, 0X7142,
-  0X7122, 0X7122, 0X7102, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102,
-  0X7102, 0X7122, 0X7122, 0X7142, 0X7142, 0X7962, 0X7963, 0X7963,
-  0X7983, 0X7983, 0X79A3, 0X79A3, 0X79A4, 0X79C4, 0X81C4, 0X81C4,
-  0X81C4, 0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X8205, 0X8205, 0X8205,
-  0X8A05, 0X8A25, 0X8A25, 0X8A25, 0X8A25, 0X8A05, 0X8A05, 0X8A05,
-  0X8A05, 0X8A25, 0X8A05, 0X8A25, 0X8A05, 0X8A05, 0X8A25, 0X8A25,
-  0X8A05, 0X81C4, 0X89E5, 0X8A05, 0X89E4, 0X89E4, 0X8A05, 0X8A25,
-  0X8A46, 0X8A46, 0X8A25, 0X8A45, 0X8A05, 0X81E4, 0X81C4, 0X89E4,
-  0X81E4, 0X8204, 0X8A05, 0X8A05, 0X8A25, 0X8225, 0X8225, 0X8205,
-  0X81E4, 0X81C4, 0X81C4, 0X81E4, 0X81E4, 0X81C4, 0X81C4, 0X79A4,
-  0X7983, 0X7963, 0X7963, 0X7942, 0X7942, 0X7142, 0X7122, 0X7142,
-  0X7942, 0X7942, 0X7142, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122,
-  0X7122, 0X7102, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X7102, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7163,
-  0X7963, 0X7963, 0X7963, 0X7983, 0X7983, 0X79A3, 0X79A3, 0X79A3,
-  0X79A3, 0X81C4, 0X81C4, 0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X81E4,
-  0X8204, 0X8204, 0X8205, 0X8205, 0X8A05, 0X89E4, 0X89E4, 0X81E4,
-  0X89E5, 0X8A05, 0X8A05, 0X8A05, 0X8A05, 0X8A05, 0X89E5, 0X8A05,
-  0X8A05, 0X81C4, 0X81A4, 0X89E5, 0X89E4, 0X81A3, 0X81C4, 0X89E4,
-  0X8A05, 0X89E4, 0X89E4, 0X81C4, 0X81A3, 0X81A3, 0X81C4, 0X81C4,
-  0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X8205, 0X8205, 0X81E5, 0X81E4,
-  0X81C4, 0X81C4, 0X81A4, 0X81C4, 0X81C4, 0X79A4, 0X79A3, 0X7983,
-  0X7983, 0X7963, 0X7942, 0X7942, 0X7142, 0X7142, 0X7122, 0X7122,
-  0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7122, 0X7102, 0X7102,
-  0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122, 0X7122, 0X7142,
-  0X7142, 0X7142, 0X7163, 0X7963, 0X7963, 0X7963, 0X7983, 0X7963,
-  0X7963, 0X7983, 0X79A3, 0X79A4, 0X79A4, 0X81C4, 0X81C4, 0X81C4,
-  0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X81C4,
-  0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81E4, 0X81C4, 0X81C4,
-  0X81C4, 0X81A4, 0X81A4, 0X81C4, 0X81C4, 0X81A3, 0X8183, 0X8183,
-  0X81A3, 0X81A3, 0X81A3, 0X81C4, 0X81E4, 0X81E4, 0X81E4, 0X81C4,
-  0X81A4, 0X81A4, 0X81C4, 0X81C4, 0X81E4, 0X81E4, 0X81C4, 0X81C4,
-  0X81C4, 0X79A3, 0X7983, 0X7983, 0X79A4, 0X7983, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122,
-  0X7122, 0X7122, 0X7122, 0X7102, 0X7102, 0X6902, 0X6902, 0X6902,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X7102, 0X7122, 0X7122,
-  0X7122, 0X7142, 0X7142, 0X7142, 0X7162, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X79A3, 0X79A3, 0X79A4,
-  0X79A4, 0X79C4, 0X79C4, 0X81C4, 0X81C4, 0X81C4, 0X81A4, 0X81A4,
-  0X81A4, 0X81C4, 0X81C4, 0X81C4, 0X81C4, 0X81C4, 0X81A4, 0X81A4,
-  0X81A4, 0X81A3, 0X8183, 0X8183, 0X81A3, 0X8183, 0X8163, 0X81A3,
-  0X81A4, 0X81C4, 0X81C4, 0X81E4, 0X81C4, 0X81C4, 0X81C4, 0X81A4,
-  0X79A3, 0X7983, 0X81A4, 0X79A4, 0X81A4, 0X81A4, 0X79A4, 0X79A3,
-  0X79A3, 0X7983, 0X7963, 0X7963, 0X7963, 0X7983, 0X7963, 0X7942,
-  0X7943, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7122, 0X7122,
-  0X7102, 0X7102, 0X7102, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6902, 0X6902,
-  0X7102, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7142, 0X7142,
-  0X7142, 0X7942, 0X7963, 0X7963, 0X7963, 0X7983, 0X7983, 0X7983,
-  0X7983, 0X7983, 0X79A3, 0X79A3, 0X79A3, 0X79A3, 0X7983, 0X7983,
-  0X8183, 0X81A4, 0X81A4, 0X81A4, 0X81A4, 0X81A4, 0X81A4, 0X8183,
-  0X7983, 0X8183, 0X7963, 0X7963, 0X7983, 0X7963, 0X7962, 0X7963,
-  0X8183, 0X81A3, 0X81A4, 0X81A4, 0X81A3, 0X81A3, 0X79A3, 0X79A3,
-  0X7983, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983,
-  0X7963, 0X7963, 0X7963, 0X7942, 0X7963, 0X7963, 0X7142, 0X7142,
-  0X7142, 0X7122, 0X7122, 0X7122, 0X7122, 0X7122, 0X7102, 0X7102,
-  0X6902, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6902, 0X6902, 0X7102, 0X7102, 0X7122, 0X7122, 0X7122, 0X7122,
-  0X7142, 0X7142, 0X7142, 0X7143, 0X7163, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7983, 0X7983, 0X7983, 0X7963,
-  0X7963, 0X7983, 0X7983, 0X7983, 0X79A3, 0X79A3, 0X7983, 0X7983,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963,
-  0X7983, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983, 0X7983,
-  0X7963, 0X7963, 0X7983, 0X7983, 0X7963, 0X7963, 0X7963, 0X7963,
-  0X7942, 0X7942, 0X7142, 0X7142, 0X7142, 0X7122, 0X7122, 0X7122,
-  0X7122, 0X7122, 0X7122, 0X7102, 0X7102, 0X7102, 0X6902, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6902, 0X6902, 0X6902, 0X7102, 0X7122,
-  0X7122, 0X7122, 0X7122, 0X7122, 0X7142, 0X7142, 0X7142, 0X7142,
-  0X7163, 0X7163, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7942,
-  0X7962, 0X7963, 0X7983, 0X7983, 0X7983, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7943, 0X7963, 0X7963, 0X7962,
-  0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963, 0X7963,
-  0X7963, 0X7963, 0X7963, 0X7942, 0X7942, 0X7942, 0X7142, 0X7142,
-  0X7142, 0X7142, 0X7122, 0X7122, 0X7122, 0X7122, 0X7122, 0X7122,
-  0X7122, 0X7102, 0X6902, 0X6902, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901,
-  0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901, 0X6901 };
+extern const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] asm("defaultEye_sclera");
 
 #define IRIS_MAP_WIDTH  256
 #define IRIS_MAP_HEIGHT 64
 
-const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] PROGMEM= {
-//uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] = {
-
-  0X2165, 0X29C6, 0X29A5, 0X2185, 0X2185, 0X2185, 0X1964, 0X1124,
-  0X1944, 0X1924, 0X1103, 0X2124, 0X1985, 0X1924, 0X1944, 0X1924,
-  0X10E3, 0X1103, 0X1924, 0X2164, 0X2164, 0X1923, 0X2124, 0X1924,
-  0X1924, 0X1943, 0X2986, 0X29A5, 0X29A5, 0X2985, 0X2985, 0X29A5,
-  0X2165, 0X2165, 0X29A6, 0X2165, 0X2985, 0X2986, 0X29C6, 0X2945,
-  0X2185, 0X29E6, 0X29A6, 0X2965, 0X2986, 0X29C6, 0X2165, 0X2985,
-  0X2185, 0X21A6, 0X2186, 0X2986, 0X2986, 0X2985, 0X2966, 0X29A6,
-  0X29C7, 0X29A6, 0X2986, 0X2985, 0X2185, 0X2186, 0X2186, 0X2165,
-  0X2965, 0X2145, 0X29A6, 0X2165, 0X2145, 0X2165, 0X2165, 0X2165,
-  0X2165, 0X2124, 0X2186, 0X1925, 0X2145, 0X21A6, 0X2165, 0X2145,
-  0X2145, 0X2144, 0X2145, 0X2165, 0X2985, 0X2986, 0X2185, 0X2965,
-  0X2985, 0X2185, 0X2165, 0X2144, 0X2185, 0X29C6, 0X2186, 0X2185,
-  0X1965, 0X1124, 0X1924, 0X1944, 0X1903, 0X1903, 0X1924, 0X2144,
-  0X2144, 0X2965, 0X1943, 0X2164, 0X2165, 0X1944, 0X1944, 0X1944,
-  0X18C3, 0X2165, 0X1901, 0X2984, 0X2983, 0X2163, 0X2164, 0X29C4,
-  0X29E5, 0X29A5, 0X2985, 0X29C6, 0X2986, 0X08E2, 0X1903, 0X1923,
-  0X2144, 0X2985, 0X2164, 0X2184, 0X2164, 0X1903, 0X1924, 0X2144,
-  0X2163, 0X2143, 0X2123, 0X2163, 0X2163, 0X1923, 0X2185, 0X1965,
-  0X1945, 0X1965, 0X1104, 0X1145, 0X1945, 0X1965, 0X2165, 0X2185,
-  0X2164, 0X1944, 0X1903, 0X1944, 0X1944, 0X2164, 0X1944, 0X1944,
-  0X2144, 0X1964, 0X1924, 0X1924, 0X1924, 0X1103, 0X1903, 0X1944,
-  0X2123, 0X2984, 0X29A4, 0X31C4, 0X2964, 0X2164, 0X2164, 0X2164,
-  0X2164, 0X2164, 0X2143, 0X1923, 0X1923, 0X1903, 0X1943, 0X2164,
-  0X2143, 0X1924, 0X2164, 0X2164, 0X2164, 0X2984, 0X2163, 0X2144,
-  0X2144, 0X2143, 0X1923, 0X1923, 0X1944, 0X1924, 0X18E3, 0X18E3,
-  0X1944, 0X1903, 0X2145, 0X2123, 0X2164, 0X1923, 0X2124, 0X2124,
-  0X2123, 0X2123, 0X18E3, 0X1923, 0X2124, 0X2124, 0X1923, 0X2122,
-  0X2163, 0X2963, 0X2143, 0X2143, 0X1903, 0X1903, 0X1903, 0X2124,
-  0X1924, 0X2164, 0X2163, 0X2985, 0X2144, 0X2165, 0X1904, 0X1944,
-  0X2144, 0X2124, 0X2143, 0X2144, 0X2144, 0X2165, 0X2144, 0X1924,
-  0X2144, 0X2144, 0X1924, 0X1924, 0X2144, 0X1924, 0X1924, 0X1924,
-  0X2144, 0X2144, 0X2144, 0X1104, 0X1924, 0X1924, 0X2164, 0X2164,
-  0X31E6, 0X31E7, 0X3207, 0X29A6, 0X31E7, 0X29E6, 0X21C6, 0X1965,
-  0X21A5, 0X2165, 0X2164, 0X29A6, 0X21A5, 0X2145, 0X29C6, 0X2144,
-  0X1944, 0X1924, 0X2185, 0X2185, 0X3206, 0X2165, 0X2185, 0X2144,
-  0X2164, 0X21A5, 0X31E6, 0X2985, 0X3206, 0X31E6, 0X29E5, 0X31E6,
-  0X29A5, 0X29C6, 0X31E6, 0X31E7, 0X31E7, 0X31C6, 0X3227, 0X31C6,
-  0X31C6, 0X3247, 0X3207, 0X31E7, 0X31E7, 0X31C6, 0X31E6, 0X31E6,
-  0X31E6, 0X2A07, 0X31C6, 0X31C7, 0X31C6, 0X29C6, 0X31C6, 0X3207,
-  0X31E7, 0X3208, 0X3207, 0X31C6, 0X29C6, 0X31E7, 0X31E7, 0X29A6,
-  0X31E8, 0X39E8, 0X29A6, 0X29A6, 0X29C6, 0X29C7, 0X29A6, 0X29C6,
-  0X29C6, 0X2985, 0X29C6, 0X29A7, 0X29A6, 0X29E7, 0X29C6, 0X29A6,
-  0X2985, 0X2185, 0X2986, 0X2186, 0X29C6, 0X29C6, 0X29E6, 0X2986,
-  0X21A5, 0X29E7, 0X29A6, 0X2985, 0X21A5, 0X3207, 0X29C6, 0X29A6,
-  0X21C6, 0X1964, 0X2165, 0X2185, 0X2165, 0X2165, 0X2144, 0X29C6,
-  0X29A5, 0X31E6, 0X2985, 0X29A6, 0X29C6, 0X21A5, 0X2185, 0X29A5,
-  0X2185, 0X2185, 0X2184, 0X29A5, 0X29E4, 0X29A4, 0X29A4, 0X3225,
-  0X3A46, 0X3226, 0X31E6, 0X3247, 0X3207, 0X08A2, 0X2144, 0X2144,
-  0X2985, 0X31E6, 0X3206, 0X29C5, 0X2185, 0X2164, 0X2165, 0X29A5,
-  0X29C5, 0X29A4, 0X29A4, 0X29C5, 0X21A3, 0X29A4, 0X29C6, 0X29E7,
-  0X1965, 0X21C6, 0X1985, 0X21C6, 0X21E7, 0X29C6, 0X29A6, 0X29E6,
-  0X29A5, 0X29A6, 0X2165, 0X29C6, 0X21A6, 0X29C6, 0X21A5, 0X2164,
-  0X2185, 0X31C6, 0X2186, 0X21A6, 0X2165, 0X1944, 0X2144, 0X2185,
-  0X29A4, 0X3205, 0X3A26, 0X3A05, 0X31E5, 0X29C6, 0X31C6, 0X29C5,
-  0X29E5, 0X31E7, 0X29A4, 0X29A4, 0X2985, 0X1943, 0X2184, 0X31E6,
-  0X29A5, 0X2985, 0X29A5, 0X31E5, 0X3206, 0X29A6, 0X31C6, 0X31C6,
-  0X29A6, 0X29A5, 0X2985, 0X2165, 0X2165, 0X2145, 0X2144, 0X2165,
-  0X2185, 0X2124, 0X2144, 0X2184, 0X2144, 0X2164, 0X2165, 0X2165,
-  0X29A5, 0X2123, 0X2144, 0X2164, 0X2965, 0X2164, 0X2984, 0X2984,
-  0X31A4, 0X31C4, 0X31C4, 0X29A3, 0X2943, 0X2144, 0X2144, 0X2965,
-  0X2965, 0X2985, 0X29C5, 0X29C5, 0X2985, 0X29A5, 0X2965, 0X2986,
-  0X29A6, 0X29A5, 0X29A5, 0X29A5, 0X2164, 0X31C6, 0X2985, 0X2185,
-  0X2985, 0X2985, 0X2165, 0X2164, 0X2985, 0X2985, 0X2165, 0X2185,
-  0X2985, 0X2985, 0X2985, 0X2165, 0X2985, 0X2185, 0X2985, 0X29A5,
-  0X3228, 0X3A48, 0X3A28, 0X3A48, 0X3227, 0X3227, 0X2A07, 0X2186,
-  0X31E7, 0X29C6, 0X29C6, 0X29E6, 0X29E7, 0X29C6, 0X3207, 0X29C6,
-  0X2164, 0X1985, 0X29E7, 0X3207, 0X3268, 0X29C6, 0X31C6, 0X29A6,
-  0X29C6, 0X3206, 0X3A68, 0X3A27, 0X4288, 0X3A68, 0X3A47, 0X3A27,
-  0X31C6, 0X31E7, 0X3A27, 0X3A48, 0X3A27, 0X3A28, 0X3A28, 0X3A27,
-  0X3A48, 0X3A48, 0X3248, 0X3A48, 0X3A28, 0X3A07, 0X3A07, 0X3A07,
-  0X4248, 0X3A07, 0X31E6, 0X3A48, 0X3A28, 0X3A08, 0X3A07, 0X3A07,
-  0X3A48, 0X3A48, 0X3A48, 0X3A28, 0X3A28, 0X3A28, 0X3A48, 0X3A28,
-  0X4269, 0X3A28, 0X3207, 0X3A48, 0X3A08, 0X3A49, 0X3A28, 0X3A28,
-  0X3207, 0X31E7, 0X3A28, 0X3228, 0X31E7, 0X3207, 0X3207, 0X31E6,
-  0X29C6, 0X29E7, 0X31E7, 0X29E7, 0X3207, 0X3206, 0X3A48, 0X31C5,
-  0X29E6, 0X3268, 0X3207, 0X31E7, 0X31E6, 0X3AC9, 0X29C7, 0X3208,
-  0X2A48, 0X29E6, 0X2185, 0X29C6, 0X29C6, 0X2986, 0X29C7, 0X2A88,
-  0X3227, 0X3226, 0X3207, 0X3A07, 0X3228, 0X29E6, 0X3207, 0X31E6,
-  0X29C6, 0X29C6, 0X29E5, 0X2A06, 0X3A67, 0X3205, 0X3205, 0X3AC7,
-  0X42A7, 0X4268, 0X3A48, 0X42CA, 0X3A89, 0X21A6, 0X2985, 0X2185,
-  0X3207, 0X3A68, 0X3205, 0X3226, 0X3207, 0X29C6, 0X31E6, 0X3A07,
-  0X3A88, 0X3206, 0X3226, 0X3246, 0X3A45, 0X3227, 0X3228, 0X3A49,
-  0X21E7, 0X21E7, 0X29E7, 0X3228, 0X32A9, 0X3208, 0X3228, 0X3228,
-  0X3228, 0X29E7, 0X29C7, 0X3228, 0X2A07, 0X2A07, 0X2A07, 0X31E7,
-  0X29E7, 0X3228, 0X2A07, 0X3247, 0X29C5, 0X29C6, 0X29E6, 0X3207,
-  0X3A47, 0X3A67, 0X4AA9, 0X4A87, 0X3A46, 0X3227, 0X31E7, 0X31E6,
-  0X3A88, 0X3A48, 0X3207, 0X3A06, 0X29C6, 0X29C5, 0X29A5, 0X3207,
-  0X31E7, 0X31C6, 0X3207, 0X3248, 0X3A89, 0X29C6, 0X3A48, 0X4269,
-  0X3207, 0X31C6, 0X31E6, 0X29E7, 0X29A6, 0X21A5, 0X2985, 0X2986,
-  0X2965, 0X2145, 0X2165, 0X2165, 0X2185, 0X2185, 0X29C6, 0X29C6,
-  0X31C6, 0X2165, 0X2185, 0X29C6, 0X29C5, 0X31E6, 0X3206, 0X3A06,
-  0X29E5, 0X3A25, 0X4245, 0X3A26, 0X31A5, 0X29C5, 0X29A6, 0X31C6,
-  0X31C6, 0X3206, 0X4267, 0X3A87, 0X31E7, 0X3207, 0X31C7, 0X29E7,
-  0X29E6, 0X3207, 0X3A27, 0X3A07, 0X29E6, 0X3A27, 0X3207, 0X29A6,
-  0X21A5, 0X3207, 0X29A6, 0X31C6, 0X31E6, 0X31E6, 0X31E6, 0X3207,
-  0X3207, 0X31E6, 0X31E6, 0X31E7, 0X3207, 0X3206, 0X3A27, 0X3207,
-  0X42A9, 0X4268, 0X4289, 0X4248, 0X3A89, 0X4AAA, 0X3A68, 0X3228,
-  0X31E6, 0X2A27, 0X3A48, 0X3227, 0X3A68, 0X3227, 0X3227, 0X3227,
-  0X29E7, 0X21E7, 0X3247, 0X3A89, 0X3A89, 0X3A47, 0X3228, 0X3A27,
-  0X3A47, 0X3A67, 0X4B0A, 0X4289, 0X4AE9, 0X42C9, 0X4289, 0X4288,
-  0X39E7, 0X3A07, 0X4289, 0X4268, 0X4268, 0X4288, 0X42A9, 0X3A48,
-  0X4AA9, 0X42A9, 0X3A48, 0X4228, 0X4289, 0X4268, 0X4268, 0X4247,
-  0X42A9, 0X4248, 0X4269, 0X4269, 0X4289, 0X4248, 0X4268, 0X4268,
-  0X4289, 0X4269, 0X4289, 0X4269, 0X4289, 0X4289, 0X4269, 0X4269,
-  0X4289, 0X4248, 0X4248, 0X3A68, 0X3A69, 0X4289, 0X4269, 0X3A68,
-  0X3A48, 0X3A27, 0X3A69, 0X4289, 0X3A68, 0X3A68, 0X3A67, 0X3A47,
-  0X3227, 0X3248, 0X3A27, 0X3A28, 0X3A28, 0X4289, 0X3A68, 0X3A27,
-  0X3207, 0X3A28, 0X3227, 0X3A28, 0X3206, 0X3B0B, 0X29E8, 0X3248,
-  0X3AC9, 0X3227, 0X29E6, 0X3227, 0X29E6, 0X31C6, 0X3228, 0X3AEA,
-  0X3A88, 0X4309, 0X3A68, 0X3A27, 0X42EA, 0X3207, 0X42CA, 0X3A68,
-  0X3248, 0X3247, 0X3227, 0X3247, 0X4B4B, 0X3A46, 0X2A26, 0X4308,
-  0X536A, 0X4AE9, 0X42A9, 0X536D, 0X4B0B, 0X3A6A, 0X3207, 0X31E8,
-  0X3A6A, 0X42CA, 0X42A9, 0X42A8, 0X3A47, 0X3227, 0X3A27, 0X4268,
-  0X4AE9, 0X42A8, 0X42A7, 0X42A8, 0X42A6, 0X3A88, 0X3AAA, 0X3A8A,
-  0X3249, 0X3249, 0X3269, 0X3A69, 0X32AA, 0X3A49, 0X3A89, 0X42AA,
-  0X3A6A, 0X3248, 0X3208, 0X3A69, 0X3A49, 0X3269, 0X3A89, 0X3A48,
-  0X3228, 0X3A69, 0X3248, 0X3289, 0X3248, 0X3207, 0X3248, 0X3A89,
-  0X42C9, 0X4B0A, 0X5B6C, 0X530B, 0X42A8, 0X3A68, 0X31C7, 0X4289,
-  0X532B, 0X4AEA, 0X3A88, 0X3A48, 0X31C6, 0X21A5, 0X3A27, 0X3A89,
-  0X42AA, 0X3A27, 0X3A28, 0X4289, 0X42A9, 0X2A27, 0X42AA, 0X4B0B,
-  0X3A48, 0X3A07, 0X39E8, 0X3A28, 0X3A07, 0X29C6, 0X29A6, 0X31E7,
-  0X3207, 0X29A5, 0X3A09, 0X29C6, 0X29C6, 0X29E7, 0X3227, 0X3A07,
-  0X3207, 0X3207, 0X29C6, 0X3227, 0X3A27, 0X3A47, 0X4A68, 0X4267,
-  0X4267, 0X4266, 0X4AA7, 0X4266, 0X39E6, 0X3A47, 0X3206, 0X3A48,
-  0X3A27, 0X4268, 0X530B, 0X4B2A, 0X3A48, 0X4249, 0X3207, 0X3A28,
-  0X3A48, 0X3A48, 0X42A9, 0X42CA, 0X4289, 0X3A68, 0X3A27, 0X3A48,
-  0X31E6, 0X3A48, 0X3A27, 0X3A47, 0X4268, 0X3A27, 0X3A47, 0X4289,
-  0X4289, 0X3A48, 0X3A48, 0X4AC9, 0X4289, 0X3A48, 0X4268, 0X4288,
-  0X42EA, 0X42C9, 0X4AAA, 0X4AA9, 0X42EA, 0X4AEA, 0X42C9, 0X3A89,
-  0X3A47, 0X3248, 0X4289, 0X4289, 0X42A9, 0X3A68, 0X4288, 0X3A68,
-  0X3248, 0X3248, 0X4289, 0X4B2B, 0X4ACA, 0X4268, 0X42AA, 0X52EA,
-  0X42C9, 0X4AA8, 0X4B0B, 0X538C, 0X538C, 0X4B2A, 0X4AEA, 0X4AC9,
-  0X4A07, 0X4289, 0X4AEA, 0X4AC9, 0X4AE9, 0X4AC9, 0X52EA, 0X42A8,
-  0X4AC9, 0X52EA, 0X4289, 0X4AA9, 0X4AEA, 0X4AA9, 0X4AA9, 0X4A89,
-  0X4AC9, 0X42A9, 0X4AA9, 0X4ACA, 0X4AA9, 0X4AA9, 0X42A9, 0X42A9,
-  0X42A9, 0X4289, 0X42AA, 0X4AAA, 0X4AA9, 0X52EB, 0X4269, 0X4AAA,
-  0X4AA9, 0X4AA9, 0X42A9, 0X42A9, 0X42A9, 0X42AA, 0X4AC9, 0X42A9,
-  0X4288, 0X3A68, 0X42CA, 0X4AEA, 0X42CA, 0X4ACA, 0X42A9, 0X3A88,
-  0X3A89, 0X3A68, 0X3A48, 0X4249, 0X3A48, 0X42A9, 0X3A28, 0X4269,
-  0X3A48, 0X3A28, 0X3A68, 0X3A68, 0X3205, 0X536B, 0X31E9, 0X3A68,
-  0X432B, 0X3A68, 0X3207, 0X3267, 0X3206, 0X3207, 0X3A68, 0X42A9,
-  0X4B09, 0X536D, 0X4288, 0X3AA8, 0X4B2B, 0X42A9, 0X42C9, 0X4289,
-  0X3A68, 0X3A88, 0X3A88, 0X3A88, 0X42E9, 0X3A87, 0X3A87, 0X538A,
-  0X5BAB, 0X5B6C, 0X430A, 0X5BEE, 0X42CA, 0X42CA, 0X3227, 0X3A69,
-  0X428A, 0X534C, 0X532B, 0X432A, 0X3A68, 0X3A68, 0X42A9, 0X4ACA,
-  0X5B4B, 0X532A, 0X532A, 0X4AE9, 0X4309, 0X4AEA, 0X42EB, 0X3AA9,
-  0X3AAA, 0X3AAA, 0X328A, 0X42CB, 0X3269, 0X42AB, 0X428A, 0X4B0C,
-  0X42CB, 0X3289, 0X3A8A, 0X42EB, 0X3AAA, 0X32C9, 0X42AA, 0X428A,
-  0X3249, 0X4AEC, 0X42CA, 0X432B, 0X3A89, 0X3A68, 0X3AA9, 0X42EA,
-  0X532B, 0X536D, 0X63ED, 0X5B8C, 0X5B4C, 0X42E9, 0X3A48, 0X4AEA,
-  0X638C, 0X63CC, 0X42CA, 0X4288, 0X3207, 0X3A07, 0X3A88, 0X4AAA,
-  0X530B, 0X42A9, 0X4289, 0X42A9, 0X4269, 0X42C9, 0X4B0B, 0X4B2A,
-  0X4268, 0X3A47, 0X3A27, 0X3A68, 0X4289, 0X3207, 0X31C6, 0X3A47,
-  0X3A08, 0X31C7, 0X3A08, 0X31E6, 0X3248, 0X3248, 0X3A69, 0X4289,
-  0X3A69, 0X4249, 0X2A07, 0X3A68, 0X4248, 0X4287, 0X52A8, 0X4AC8,
-  0X4AC9, 0X42A7, 0X52A7, 0X52C8, 0X4247, 0X3A88, 0X42A8, 0X4AAA,
-  0X39E7, 0X4268, 0X53AB, 0X5B8D, 0X4ACA, 0X4289, 0X3A49, 0X42CA,
-  0X4289, 0X4AEA, 0X52EA, 0X4B2B, 0X42CA, 0X4AAA, 0X4A89, 0X4269,
-  0X3A68, 0X42C9, 0X4287, 0X4288, 0X4288, 0X4287, 0X4288, 0X42A9,
-  0X4288, 0X4288, 0X4289, 0X4AE9, 0X530A, 0X4268, 0X530A, 0X4B0A,
-  0X532B, 0X42EA, 0X4289, 0X4B0A, 0X534B, 0X4B2A, 0X4B0A, 0X4AEA,
-  0X42A9, 0X3AA8, 0X4AE9, 0X4ACA, 0X42EA, 0X42C9, 0X42C9, 0X42EA,
-  0X42A9, 0X3AA9, 0X530B, 0X53AD, 0X52EC, 0X4B0B, 0X534C, 0X5B8D,
-  0X5B6B, 0X5B2B, 0X5B4B, 0X642E, 0X5BCD, 0X5B6C, 0X536B, 0X530B,
-  0X5208, 0X530A, 0X534B, 0X52E9, 0X5B4B, 0X530A, 0X4B09, 0X4AC9,
-  0X530A, 0X4AEA, 0X42C9, 0X4ACA, 0X530A, 0X4AE9, 0X52EA, 0X52EA,
-  0X4AC9, 0X4AEA, 0X4AA9, 0X4ACA, 0X4ACA, 0X4ACA, 0X52EA, 0X4AA9,
-  0X4AA8, 0X4ACA, 0X4AEA, 0X52EA, 0X52EA, 0X52EA, 0X4AA9, 0X4AEA,
-  0X530B, 0X530B, 0X4AEB, 0X4AEB, 0X4AEA, 0X4B0A, 0X5B4B, 0X4AEA,
-  0X4AC9, 0X3A68, 0X4AEA, 0X534C, 0X4AEA, 0X4B0B, 0X4B0A, 0X42C9,
-  0X4AEA, 0X42EA, 0X4249, 0X42A9, 0X4289, 0X42A9, 0X4ACA, 0X42AA,
-  0X532C, 0X42AA, 0X42CA, 0X3AA9, 0X4248, 0X5BAC, 0X3ACA, 0X3A88,
-  0X530B, 0X3AA8, 0X3A47, 0X3226, 0X3227, 0X3A68, 0X2A27, 0X4B0A,
-  0X4B2A, 0X63ED, 0X3A66, 0X42E9, 0X53AC, 0X4B0B, 0X42C8, 0X42C9,
-  0X42C9, 0X4AC9, 0X4AA9, 0X3A45, 0X532A, 0X42C9, 0X42E8, 0X5BCB,
-  0X6C2D, 0X640D, 0X4B0A, 0X74B1, 0X4ACA, 0X42CA, 0X3A69, 0X428A,
-  0X4ACB, 0X5BAD, 0X5BCE, 0X53CE, 0X4289, 0X4289, 0X4B0B, 0X5B2B,
-  0X63CD, 0X5BAC, 0X5BAD, 0X536A, 0X534A, 0X4B4B, 0X432B, 0X430B,
-  0X428A, 0X430B, 0X42CA, 0X4AEB, 0X42CA, 0X4B4D, 0X5B2D, 0X534D,
-  0X534D, 0X3B0B, 0X3269, 0X4B0C, 0X4B4D, 0X434C, 0X42CB, 0X42AB,
-  0X32EB, 0X63AD, 0X4B0B, 0X3AAB, 0X4B2B, 0X42CA, 0X4B0B, 0X4B4A,
-  0X5BCE, 0X642E, 0X6C0E, 0X5B4C, 0X532B, 0X4B2A, 0X4B0A, 0X5B8B,
-  0X7410, 0X640D, 0X4B2A, 0X4AA9, 0X3A28, 0X4268, 0X4289, 0X530A,
-  0X5B2B, 0X530A, 0X4AEA, 0X530B, 0X4AEA, 0X42EA, 0X534B, 0X5BCD,
-  0X42A9, 0X4247, 0X4267, 0X42A8, 0X4ACA, 0X3A48, 0X3207, 0X3A47,
-  0X4248, 0X4289, 0X3A68, 0X4268, 0X42AA, 0X3A89, 0X42AA, 0X42CA,
-  0X4249, 0X3A48, 0X3207, 0X4ACA, 0X4B09, 0X52A7, 0X4B08, 0X534A,
-  0X4B09, 0X4266, 0X5308, 0X5B09, 0X4AC8, 0X42C6, 0X4AE8, 0X530A,
-  0X4248, 0X4AE9, 0X536B, 0X63AD, 0X530B, 0X4B0B, 0X428A, 0X4B0A,
-  0X4AEA, 0X532B, 0X5B8D, 0X534C, 0X532B, 0X426A, 0X530B, 0X4AEA,
-  0X42A9, 0X4AE9, 0X4AC9, 0X4AA8, 0X5309, 0X5308, 0X52E8, 0X4AC8,
-  0X4AE9, 0X4AE9, 0X4B09, 0X530A, 0X534A, 0X532A, 0X5B6C, 0X538B,
-  0X534C, 0X4B0A, 0X4AEA, 0X4B4B, 0X532C, 0X5BAC, 0X534B, 0X534B,
-  0X4ACA, 0X42EA, 0X532A, 0X532B, 0X4B09, 0X4B0A, 0X4B2B, 0X532B,
-  0X4B0B, 0X4ACA, 0X4B0C, 0X5BAD, 0X5B8C, 0X5B8C, 0X5C4E, 0X63EE,
-  0X744E, 0X63ED, 0X6BAE, 0X7CD1, 0X6C4D, 0X63AE, 0X640E, 0X5B6B,
-  0X530B, 0X5B8D, 0X5BAD, 0X534B, 0X5B8C, 0X5B6C, 0X5329, 0X532A,
-  0X5B4B, 0X5B6B, 0X52EA, 0X52EA, 0X532A, 0X5309, 0X532A, 0X530A,
-  0X530A, 0X4AA9, 0X52EA, 0X530B, 0X530A, 0X52EA, 0X530A, 0X4AC9,
-  0X4AE9, 0X4AEA, 0X4AEA, 0X530B, 0X4AEA, 0X52EB, 0X530A, 0X4ACA,
-  0X52EA, 0X530B, 0X52EB, 0X52EB, 0X52CA, 0X530B, 0X5B6B, 0X530A,
-  0X532A, 0X4288, 0X532B, 0X5B4C, 0X4B2B, 0X532B, 0X5B4B, 0X534B,
-  0X4B0B, 0X5B4C, 0X4ACB, 0X4AEA, 0X4ACA, 0X4ACA, 0X4AEB, 0X4AEB,
-  0X5B4C, 0X52EB, 0X42EA, 0X4B29, 0X4228, 0X6C2F, 0X42EA, 0X42CA,
-  0X4AEA, 0X42E7, 0X42A8, 0X2A46, 0X3AA8, 0X42CA, 0X42A9, 0X4B49,
-  0X5349, 0X740F, 0X42E5, 0X4268, 0X5BED, 0X534B, 0X4B09, 0X4AE9,
-  0X4B2A, 0X4B2A, 0X4AC9, 0X4AA8, 0X532A, 0X5BAD, 0X5BAC, 0X6C4E,
-  0X7470, 0X6C70, 0X63CE, 0X7490, 0X534B, 0X4AEB, 0X4289, 0X4AAB,
-  0X532C, 0X6BEE, 0X6CD1, 0X53AE, 0X42AA, 0X42AA, 0X538C, 0X5B6C,
-  0X6C0F, 0X5BCD, 0X742F, 0X63CC, 0X5B8B, 0X538C, 0X4B4C, 0X4B6C,
-  0X4B2B, 0X430B, 0X4AEA, 0X534C, 0X42EA, 0X53EE, 0X7471, 0X63EE,
-  0X6BAF, 0X53CE, 0X52EA, 0X5BAF, 0X538D, 0X4B8D, 0X4B0C, 0X42EB,
-  0X534D, 0X5B8D, 0X530C, 0X4B2B, 0X4B6C, 0X4B2B, 0X532B, 0X536B,
-  0X640D, 0X7490, 0X742D, 0X63AC, 0X5B4C, 0X42CA, 0X536B, 0X63CC,
-  0X7CB0, 0X63ED, 0X538B, 0X4B0A, 0X4289, 0X42A9, 0X4AC9, 0X5B8B,
-  0X5B6B, 0X5B8B, 0X5329, 0X536A, 0X5B6C, 0X4B0A, 0X5BAC, 0X5BED,
-  0X4AEA, 0X4288, 0X4AC8, 0X4AA8, 0X532B, 0X42A9, 0X3A48, 0X4268,
-  0X4ACA, 0X4AA9, 0X42A9, 0X4B0B, 0X4AEA, 0X4AEB, 0X4269, 0X42CA,
-  0X430A, 0X3ACA, 0X3A27, 0X4AE9, 0X5B28, 0X52C7, 0X5348, 0X5BAB,
-  0X5B4A, 0X4AA8, 0X5AE8, 0X5B49, 0X5308, 0X5349, 0X532A, 0X5B4A,
-  0X530A, 0X52E9, 0X5B8B, 0X7C4F, 0X5B4B, 0X5B6C, 0X530B, 0X4B2C,
-  0X430B, 0X5BAD, 0X5B8C, 0X5B6D, 0X4B0B, 0X52CB, 0X5BAC, 0X534B,
-  0X52EA, 0X52E9, 0X534A, 0X532A, 0X5B6A, 0X5B6A, 0X6349, 0X5B6A,
-  0X4288, 0X5B6A, 0X5B6A, 0X532B, 0X5B8B, 0X5BAC, 0X63CD, 0X5BED,
-  0X5B8C, 0X4B0A, 0X4B2B, 0X5BAD, 0X532C, 0X640D, 0X536D, 0X5B6D,
-  0X536C, 0X3AC9, 0X530B, 0X534B, 0X534B, 0X434B, 0X536C, 0X5B4C,
-  0X536B, 0X532B, 0X5B6E, 0X63EE, 0X5BED, 0X63EE, 0X644E, 0X642E,
-  0X746F, 0X6C4E, 0X6C4E, 0X84AF, 0X74EE, 0X73EF, 0X6C6F, 0X5BCB,
-  0X5B8C, 0X6431, 0X5BCC, 0X640D, 0X63AD, 0X5B8C, 0X536A, 0X5B8B,
-  0X5B8C, 0X5B6A, 0X4AE9, 0X532B, 0X5B8B, 0X5B6A, 0X5B2B, 0X5B0A,
-  0X532B, 0X4ACA, 0X530A, 0X52EA, 0X530B, 0X530B, 0X532A, 0X532A,
-  0X530A, 0X52EA, 0X530B, 0X530B, 0X530B, 0X52EA, 0X4AE9, 0X4AE9,
-  0X532A, 0X52EA, 0X530B, 0X52EB, 0X5B0B, 0X5B4B, 0X5B6C, 0X5B4C,
-  0X5B4C, 0X4AEA, 0X4B4B, 0X5B8C, 0X5B6C, 0X5B6D, 0X5B6D, 0X5B8C,
-  0X5B6D, 0X5B4C, 0X532C, 0X52EA, 0X530B, 0X4B0A, 0X532C, 0X532B,
-  0X5B6C, 0X5B4B, 0X4B2B, 0X4B08, 0X42A7, 0X5BCD, 0X534B, 0X430A,
-  0X538B, 0X4B49, 0X42E8, 0X42C9, 0X42C9, 0X4AC9, 0X4AEA, 0X4B49,
-  0X5B89, 0X9591, 0X4AA3, 0X3A47, 0X642E, 0X4B2B, 0X530A, 0X538B,
-  0X534A, 0X4B09, 0X4B0A, 0X530A, 0X532A, 0X5B6C, 0X6470, 0X7D32,
-  0X7D12, 0X6C91, 0X7490, 0X7D12, 0X430A, 0X42EA, 0X3A68, 0X4AAA,
-  0X532C, 0X742F, 0X7D51, 0X5BCE, 0X4AEB, 0X42CA, 0X5BAD, 0X63AD,
-  0X6BEE, 0X6BEE, 0X744F, 0X742E, 0X5B6C, 0X53AD, 0X53CE, 0X4B8D,
-  0X534C, 0X4B4C, 0X534B, 0X4B2B, 0X5BAD, 0X74B1, 0X7C92, 0X6490,
-  0X6B8F, 0X5C30, 0X63CF, 0X5BEE, 0X5BCE, 0X5C0F, 0X534C, 0X534C,
-  0X5B8D, 0X644E, 0X4B2B, 0X534C, 0X5BAD, 0X5B8D, 0X5309, 0X5BEC,
-  0X6BEE, 0X6C6E, 0X7C8F, 0X6C2D, 0X5B6B, 0X532B, 0X5B8B, 0X6BED,
-  0X7CF0, 0X7C90, 0X5B2B, 0X5B8D, 0X52EA, 0X4ACA, 0X532A, 0X63AB,
-  0X6BCD, 0X6BEC, 0X5B8B, 0X63CC, 0X6C0B, 0X4B2C, 0X63CC, 0X63ED,
-  0X534A, 0X538A, 0X4B09, 0X532A, 0X5B6C, 0X4B09, 0X3A48, 0X4A88,
-  0X5329, 0X52E9, 0X4B2A, 0X532B, 0X4AEB, 0X530B, 0X4ACA, 0X4B2B,
-  0X4B4B, 0X4ACA, 0X4268, 0X638A, 0X6349, 0X5B08, 0X6BA9, 0X63CB,
-  0X5B6A, 0X5309, 0X5B08, 0X6388, 0X5B48, 0X5B8A, 0X534A, 0X5BAB,
-  0X530A, 0X5B4B, 0X744C, 0X742D, 0X63AC, 0X636C, 0X638D, 0X534C,
-  0X4B0B, 0X5B8D, 0X5BAD, 0X5B8D, 0X4AEB, 0X5B0C, 0X746E, 0X5B8C,
-  0X5B0B, 0X5B8B, 0X5B8B, 0X538A, 0X5B8A, 0X63EC, 0X6BAB, 0X63CB,
-  0X534B, 0X5BAB, 0X63AB, 0X5B4C, 0X63AC, 0X6BEC, 0X742F, 0X642E,
-  0X63CE, 0X534C, 0X534B, 0X53AE, 0X536D, 0X642F, 0X5BAE, 0X5B0C,
-  0X64B0, 0X4AEA, 0X536C, 0X6C4F, 0X640E, 0X5BAC, 0X638D, 0X5B8D,
-  0X5BED, 0X5B8C, 0X63AE, 0X6C4F, 0X6C4F, 0X63ED, 0X6C2D, 0X642D,
-  0X74AF, 0X6C4D, 0X748E, 0X7CCF, 0X7CEF, 0X6BEE, 0X74B0, 0X6C0C,
-  0X63AB, 0X6470, 0X5C0E, 0X6C8F, 0X744F, 0X640E, 0X5BAD, 0X63EC,
-  0X642D, 0X5B6B, 0X4269, 0X638C, 0X63AC, 0X6BCC, 0X5B8B, 0X5B2B,
-  0X5B4B, 0X532A, 0X530A, 0X5B2B, 0X530A, 0X532A, 0X5B8B, 0X5B6A,
-  0X5B4A, 0X52EA, 0X5B2B, 0X52EA, 0X52EA, 0X52E9, 0X530A, 0X530A,
-  0X532A, 0X532A, 0X4AEA, 0X530A, 0X5B2B, 0X5B4C, 0X5B4C, 0X5B4C,
-  0X532C, 0X532B, 0X536C, 0X5B2B, 0X636D, 0X5B8D, 0X5B6C, 0X638D,
-  0X7430, 0X5B2B, 0X5B2C, 0X530B, 0X534A, 0X530A, 0X5B8C, 0X536B,
-  0X5BAC, 0X63EC, 0X5B6B, 0X4B08, 0X4AE8, 0X53AC, 0X5BAD, 0X536C,
-  0X53CB, 0X5B8B, 0X42C8, 0X534B, 0X4B2A, 0X4AAA, 0X4B2A, 0X5B4B,
-  0X53CB, 0X95D1, 0X39C3, 0X432A, 0X640E, 0X536C, 0X4AEA, 0X5BAC,
-  0X5B6B, 0X534A, 0X534B, 0X5B6B, 0X532B, 0X5BCD, 0X74F2, 0X8593,
-  0X8574, 0X7D32, 0X8532, 0X95B4, 0X63ED, 0X532B, 0X4B2B, 0X534B,
-  0X5BAD, 0X84B2, 0X8DF4, 0X6451, 0X4ACA, 0X4B0B, 0X5BAD, 0X6BAD,
-  0X740E, 0X6C2E, 0X6C4E, 0X6C4E, 0X638D, 0X5BAD, 0X53AD, 0X53CE,
-  0X5B8D, 0X534C, 0X5B8C, 0X5B8C, 0X6C2F, 0X84D2, 0X7D13, 0X74F3,
-  0X7450, 0X6BF0, 0X642F, 0X63CE, 0X63AD, 0X5C4F, 0X5BAC, 0X536B,
-  0X63ED, 0X642E, 0X638D, 0X63CD, 0X5BAD, 0X5BCD, 0X5344, 0X63EC,
-  0X6C2D, 0X7CEF, 0X84CF, 0X746D, 0X5B8B, 0X4B0A, 0X5BAD, 0X6C2E,
-  0X8551, 0X7D0F, 0X742F, 0X6BCE, 0X532A, 0X52EA, 0X530A, 0X63ED,
-  0X6C0C, 0X846F, 0X5BAB, 0X63CD, 0X640E, 0X5BAD, 0X6C6E, 0X6C2D,
-  0X6C2D, 0X53AA, 0X5B6B, 0X5B4A, 0X5B8B, 0X5B8B, 0X4289, 0X3A65,
-  0X5B8A, 0X5349, 0X532A, 0X532B, 0X4ACA, 0X63CD, 0X534B, 0X5B8C,
-  0X4AAA, 0X532A, 0X4288, 0X638A, 0X5B69, 0X6B69, 0X740A, 0X63AB,
-  0X638B, 0X5AC9, 0X5B8A, 0X63AA, 0X6388, 0X5B6A, 0X63CC, 0X6C0C,
-  0X5AEA, 0X63AC, 0X84AE, 0X746D, 0X6C6D, 0X5B2C, 0X636D, 0X5B8D,
-  0X532B, 0X5B8D, 0X63EE, 0X5BAC, 0X534C, 0X63CD, 0X746F, 0X63CD,
-  0X638C, 0X6BCC, 0X6C0D, 0X6C0D, 0X63CB, 0X63CA, 0X6BCC, 0X640C,
-  0X63CD, 0X6C2D, 0X746E, 0X63AD, 0X6C0D, 0X740E, 0X7C70, 0X7470,
-  0X63EF, 0X5B6C, 0X534C, 0X538D, 0X3A8C, 0X644E, 0X53EF, 0X63AD,
-  0X5BEE, 0X5BAD, 0X5BCD, 0X646F, 0X6C0F, 0X63EE, 0X534B, 0X63ED,
-  0X642E, 0X63EE, 0X6C2F, 0X6C6F, 0X74F1, 0X6C2E, 0X7C8E, 0X748E,
-  0X6C6E, 0X748D, 0X74AD, 0X7CAD, 0X84CE, 0X6C8D, 0X6C0D, 0X744D,
-  0X6BEC, 0X6C4E, 0X5C2F, 0X74AF, 0X746F, 0X6C2E, 0X5C0D, 0X6C4E,
-  0X746E, 0X5B6B, 0X5B4B, 0X640D, 0X6C0D, 0X63AC, 0X6C0D, 0X638C,
-  0X5B6B, 0X5B4B, 0X5B4B, 0X5B4B, 0X534B, 0X530A, 0X5349, 0X5B2B,
-  0X530A, 0X530B, 0X532B, 0X532B, 0X52EA, 0X52EA, 0X530A, 0X532B,
-  0X5B2A, 0X532A, 0X530A, 0X52EB, 0X5B0C, 0X5B2C, 0X5B4C, 0X5B6C,
-  0X532B, 0X5B2C, 0X5B6D, 0X5B8C, 0X63CD, 0X63AD, 0X63EE, 0X5B8C,
-  0X6BEE, 0X636C, 0X538C, 0X532A, 0X4B0A, 0X5B4B, 0X5BAC, 0X5B8C,
-  0X5B8B, 0X74AE, 0X636A, 0X4AE7, 0X42C8, 0X53AD, 0X5BCD, 0X536C,
-  0X5BAC, 0X5BCB, 0X42A9, 0X536B, 0X4B2A, 0X52EA, 0X534B, 0X5309,
-  0X5BEC, 0X8531, 0X5367, 0X5BAD, 0X642E, 0X5BAD, 0X536C, 0X644F,
-  0X63CD, 0X532B, 0X536C, 0X5B4C, 0X63CD, 0X642F, 0X8533, 0X8DF5,
-  0X8D53, 0X8572, 0X9593, 0XA616, 0X642E, 0X530C, 0X4B4B, 0X4B0B,
-  0X536C, 0X7CF3, 0X8593, 0X6491, 0X52AA, 0X534C, 0X5BED, 0X63AC,
-  0X6C0E, 0X742E, 0X6C4E, 0X6C2E, 0X534C, 0X5B8D, 0X5BCE, 0X5BCE,
-  0X4B0B, 0X6410, 0X5BED, 0X63CD, 0X7CF2, 0X7D13, 0X8533, 0X7CB3,
-  0X74B0, 0X6C0E, 0X646F, 0X63EE, 0X638D, 0X642E, 0X5BCD, 0X5BAC,
-  0X742E, 0X744D, 0X640D, 0X536C, 0X63AE, 0X640E, 0X3AA2, 0X63CA,
-  0X6C4D, 0X852F, 0X8D30, 0X7C6D, 0X63ED, 0X4B4A, 0X63CD, 0X6C0E,
-  0X8550, 0X8D30, 0X74AE, 0X638D, 0X5B4B, 0X4B09, 0X4B08, 0X63AC,
-  0X746D, 0X7C6F, 0X6C0D, 0X5B6C, 0X6C0E, 0X63EE, 0X6C2F, 0X6CAF,
-  0X746F, 0X5BCD, 0X63CD, 0X52CA, 0X644D, 0X640E, 0X4288, 0X42C6,
-  0X638B, 0X5B2A, 0X5349, 0X5B4A, 0X5B6B, 0X640E, 0X5B8C, 0X5B2A,
-  0X532B, 0X532B, 0X52E9, 0X5BAB, 0X6BCA, 0X6BEA, 0X6C0B, 0X742C,
-  0X638C, 0X5309, 0X5B6A, 0X63EB, 0X63A9, 0X6BCC, 0X640C, 0X740E,
-  0X6B2A, 0X6C4C, 0X7C6D, 0X74AE, 0X742D, 0X538D, 0X5B4C, 0X5C0E,
-  0X5B8C, 0X5BAD, 0X63AD, 0X63ED, 0X534C, 0X6C4E, 0X6B2C, 0X6BEE,
-  0X6BEE, 0X746D, 0X6C2D, 0X742E, 0X640C, 0X6C0D, 0X6BEC, 0X6C0D,
-  0X6C0E, 0X63CC, 0X6C2F, 0X5BED, 0X6C4F, 0X7C4F, 0X84F2, 0X7490,
-  0X63F0, 0X536C, 0X4B2B, 0X536D, 0X4B0D, 0X6CEF, 0X642F, 0X7491,
-  0X5BAD, 0X4ACA, 0X5C2D, 0X6C4F, 0X6C0F, 0X63EE, 0X5BEC, 0X6BEE,
-  0X644E, 0X63CD, 0X5C2E, 0X744F, 0X74D0, 0X746E, 0X7CAE, 0X6C6D,
-  0X6C6E, 0X746D, 0X74AD, 0X7CAD, 0X74CE, 0X7CAE, 0X744D, 0X744D,
-  0X6C2D, 0X6C2D, 0X6C0E, 0X7CCF, 0X746E, 0X6C2D, 0X5BCC, 0X6C4D,
-  0X746E, 0X63CD, 0X5B2C, 0X6C4D, 0X6C0D, 0X63AC, 0X742E, 0X63CD,
-  0X63AD, 0X5B6C, 0X5B8B, 0X5B8B, 0X532B, 0X532A, 0X532B, 0X52E9,
-  0X52EB, 0X5B2B, 0X530A, 0X5B2B, 0X52EA, 0X530A, 0X530A, 0X530A,
-  0X5B2B, 0X5B0A, 0X530B, 0X52EB, 0X5B4C, 0X5B6C, 0X5B8D, 0X5B6C,
-  0X5B4D, 0X5B2C, 0X5B8C, 0X5BAD, 0X63AD, 0X63CD, 0X5BCD, 0X5B6B,
-  0X636C, 0X640E, 0X532B, 0X5B2B, 0X530A, 0X538B, 0X63EE, 0X5B8C,
-  0X4AC8, 0X6C0B, 0X5B6A, 0X52E8, 0X4B4B, 0X5B8C, 0X7451, 0X538C,
-  0X5BAD, 0X5B8B, 0X4B0A, 0X536B, 0X534A, 0X3B08, 0X4B2A, 0X4B2A,
-  0X7C6F, 0X95B4, 0X63C9, 0X63AD, 0X640E, 0X5BAE, 0X5BAD, 0X640E,
-  0X642E, 0X6BCE, 0X4B4B, 0X63AD, 0X5BCD, 0X53EE, 0X7510, 0X8DF5,
-  0X8512, 0X8D94, 0X95D3, 0XA615, 0X6C6F, 0X536C, 0X4B2A, 0X4B0B,
-  0X5BCD, 0X7CB1, 0X95B4, 0X7CD2, 0X5AEB, 0X5B6D, 0X63EE, 0X6BED,
-  0X6C2E, 0X746E, 0X746E, 0X6C0E, 0X5BAD, 0X5BEE, 0X640F, 0X5BCE,
-  0X640F, 0X6430, 0X5C0E, 0X644E, 0X7D33, 0X8594, 0X74F2, 0X8D55,
-  0X7490, 0X5BEC, 0X6C4F, 0X63ED, 0X6C2E, 0X742F, 0X642E, 0X63ED,
-  0X7C2E, 0X6C8E, 0X744E, 0X6BCC, 0X640E, 0X640D, 0X5369, 0X5BA9,
-  0X746D, 0X8D70, 0X95D2, 0X742C, 0X640D, 0X538C, 0X5BAD, 0X6C2F,
-  0X8DB2, 0X9D72, 0X742F, 0X63AD, 0X5B2A, 0X5329, 0X4AE8, 0X5BAC,
-  0X7D30, 0X7CAF, 0X744E, 0X63CD, 0X6C4F, 0X642E, 0X6BEE, 0X74CF,
-  0X6C6E, 0X6C4E, 0X53CC, 0X4B4B, 0X74EF, 0X746F, 0X42E9, 0X4AE8,
-  0X5B8A, 0X63AB, 0X5B89, 0X5B49, 0X5B6B, 0X640D, 0X63CC, 0X5B8C,
-  0X63AC, 0X5269, 0X5B8A, 0X63CB, 0X742C, 0X6C0B, 0X7C6E, 0X744D,
-  0X638C, 0X536A, 0X536A, 0X640B, 0X6BAB, 0X6C0C, 0X6C0C, 0X742D,
-  0X6B8C, 0X744C, 0X84EF, 0X7C8E, 0X6BED, 0X4B4C, 0X42C9, 0X640E,
-  0X5BAD, 0X6BEE, 0X63CC, 0X5BAC, 0X640D, 0X6C4F, 0X6B8D, 0X6BAE,
-  0X7470, 0X6C4E, 0X6C2D, 0X6BED, 0X6C2E, 0X7490, 0X744F, 0X744E,
-  0X6C0E, 0X644E, 0X7490, 0X5BEE, 0X7D12, 0X7C70, 0X9595, 0X7C91,
-  0X6C10, 0X4B2B, 0X4B4B, 0X53AD, 0X5BAD, 0X754F, 0X5BEE, 0X64B0,
-  0X532B, 0X4AA9, 0X53AB, 0X6CAF, 0X744F, 0X6C2E, 0X640E, 0X748F,
-  0X5BAD, 0X6BEE, 0X642E, 0X7C50, 0X74B0, 0X746F, 0X748D, 0X748E,
-  0X6C6D, 0X746D, 0X7CAE, 0X7CCF, 0X74AC, 0X84CF, 0X746D, 0X6C2D,
-  0X6C2C, 0X6C4D, 0X5BCC, 0X84EF, 0X744D, 0X6C6D, 0X5BAB, 0X742D,
-  0X6C4C, 0X744D, 0X63CC, 0X6C0C, 0X6C0C, 0X63EC, 0X6BED, 0X638B,
-  0X6BED, 0X5B4C, 0X638C, 0X63EC, 0X532A, 0X534B, 0X5B4C, 0X5B4B,
-  0X5B4B, 0X532C, 0X52EB, 0X532B, 0X532B, 0X4B09, 0X532A, 0X5309,
-  0X5B8C, 0X5B2B, 0X4288, 0X4ACA, 0X5B4C, 0X5B2C, 0X638D, 0X63AE,
-  0X5B6C, 0X5B6C, 0X63EE, 0X640E, 0X5BAC, 0X63ED, 0X5B6C, 0X5B6C,
-  0X4B4A, 0X5B8C, 0X636B, 0X5B8C, 0X536B, 0X5BAC, 0X640E, 0X5B6B,
-  0X5B6B, 0X63CC, 0X5BCB, 0X5B6C, 0X4B4A, 0X6BAE, 0X7CD1, 0X5BED,
-  0X5BCD, 0X5B6C, 0X532A, 0X536B, 0X53AB, 0X1B06, 0X5B6B, 0X3B29,
-  0X8532, 0X8D54, 0X744C, 0X63CC, 0X63EE, 0X5BED, 0X640E, 0X6BEE,
-  0X6C90, 0X534B, 0X4B6B, 0X5B6C, 0X5BCD, 0X642F, 0X7D31, 0X8572,
-  0X8551, 0X8D93, 0X9DD4, 0XAE76, 0X7D10, 0X5BCD, 0X5B8C, 0X52CA,
-  0X6C4E, 0X742F, 0XA5D6, 0X7D12, 0X52CA, 0X63CD, 0X6BEE, 0X5B8B,
-  0X744F, 0X748F, 0X748E, 0X640D, 0X63AD, 0X5BCE, 0X5C0F, 0X5BCF,
-  0X742F, 0X6430, 0X642F, 0X6CB0, 0X8574, 0X8594, 0X7D33, 0X7D13,
-  0X7C6F, 0X6C6E, 0X640E, 0X63ED, 0X6C6F, 0X742E, 0X748E, 0X640D,
-  0X7C4E, 0X7CF0, 0X7C8F, 0X6C6D, 0X6C6E, 0X5B8B, 0X63EB, 0X640C,
-  0X748E, 0X95B2, 0X9E34, 0X7CEE, 0X6C0E, 0X538B, 0X5BCD, 0X744F,
-  0X8CF2, 0X9594, 0X84D1, 0X742E, 0X638B, 0X4AE8, 0X4228, 0X63AC,
-  0X7D31, 0X84F1, 0X744F, 0X6BED, 0X742F, 0X6BCE, 0X6C0E, 0X7490,
-  0X7C90, 0X7490, 0X538A, 0X5BAD, 0X744F, 0X744F, 0X4AE9, 0X52C8,
-  0X6C4C, 0X63AC, 0X63AB, 0X5B29, 0X63EC, 0X642C, 0X640D, 0X63CD,
-  0X636B, 0X5329, 0X4B29, 0X5B6B, 0X7C6E, 0X740E, 0X7C8F, 0X7C6E,
-  0X5BAB, 0X532A, 0X4329, 0X6C0D, 0X740E, 0X63CC, 0X740E, 0X748E,
-  0X640C, 0X7C8D, 0X8573, 0X84B0, 0X63ED, 0X530A, 0X536C, 0X6BCD,
-  0X63AD, 0X640D, 0X636C, 0X5B8C, 0X63ED, 0X7450, 0X6BAD, 0X6C0E,
-  0X7CB0, 0X7450, 0X6C0E, 0X6C2F, 0X746F, 0X74F1, 0X744F, 0X7490,
-  0X63CD, 0X6C2E, 0X7CB0, 0X5BAE, 0X7491, 0X7490, 0X9574, 0X7470,
-  0X63CE, 0X532B, 0X538C, 0X5BAD, 0X5BEE, 0X5C8B, 0X5BEE, 0X6CD0,
-  0X536C, 0X4AA9, 0X4B2A, 0X6C8E, 0X746F, 0X6C4E, 0X6C0E, 0X646E,
-  0X638D, 0X742F, 0X640E, 0X8512, 0X7C90, 0X74AF, 0X748E, 0X7CAF,
-  0X7C8F, 0X748D, 0X7CEF, 0X8570, 0X7C8B, 0X84EE, 0X6C2C, 0X6C4D,
-  0X6C2C, 0X746D, 0X6C0B, 0X748D, 0X744C, 0X744D, 0X6C0C, 0X746D,
-  0X6C2C, 0X6C8D, 0X6BCC, 0X6BEC, 0X6BEC, 0X63CB, 0X6C2D, 0X63AC,
-  0X6BCC, 0X63AC, 0X63AC, 0X63AD, 0X5B4B, 0X532A, 0X638D, 0X5B4C,
-  0X534C, 0X430B, 0X532C, 0X5B4C, 0X534B, 0X530B, 0X4B2A, 0X4B2A,
-  0X63AC, 0X5B4B, 0X52AA, 0X4AAA, 0X5B4C, 0X63AD, 0X638D, 0X5B6C,
-  0X5B6B, 0X530B, 0X6C2E, 0X6C2E, 0X63CD, 0X5BCC, 0X538B, 0X536A,
-  0X52A9, 0X6B8D, 0X5B4C, 0X5BAD, 0X530B, 0X536C, 0X642E, 0X530A,
-  0X5B4B, 0X5BAC, 0X5BAC, 0X5BCD, 0X4AEA, 0X73EF, 0X6D72, 0X53CC,
-  0X638C, 0X5B6C, 0X4AC7, 0X4B2A, 0X538B, 0X42E9, 0X5BEB, 0X534A,
-  0X6C2E, 0X8D91, 0X7CCE, 0X5BAC, 0X744F, 0X53AD, 0X640E, 0X6C0E,
-  0X6C4F, 0X534B, 0X534B, 0X5BAD, 0X4287, 0X648F, 0X7510, 0X8571,
-  0X8D72, 0X95B3, 0X9DB3, 0XA694, 0X8531, 0X642D, 0X63ED, 0X636D,
-  0X744F, 0X84F2, 0X9574, 0X7CD1, 0X63AD, 0X640E, 0X6BEE, 0X63AC,
-  0X746F, 0X748F, 0X6C6E, 0X640E, 0X63AD, 0X5BAE, 0X5C0F, 0X53CE,
-  0X63CF, 0X5C0F, 0X5C2F, 0X74B0, 0X8D96, 0X8573, 0X7D54, 0X7CD3,
-  0X6C0F, 0X6C2E, 0X640E, 0X5BAD, 0X63AD, 0X6C2E, 0X742E, 0X744E,
-  0X6C8D, 0X9592, 0X8530, 0X7D0F, 0X6C8F, 0X5BAC, 0X5BCC, 0X6C4D,
-  0X7CCE, 0XA5D4, 0X9E14, 0X8572, 0X746F, 0X534B, 0X5BCC, 0X63CE,
-  0X8D33, 0X9594, 0X8D53, 0X6C0E, 0X5B8A, 0X4B08, 0X4AA8, 0X536A,
-  0X8530, 0X7CD1, 0X7490, 0X6BEE, 0X6430, 0X63CD, 0X538B, 0X74D1,
-  0X84D1, 0X6C4F, 0X5BCC, 0X6C4D, 0X642D, 0X640D, 0X536B, 0X4AC9,
-  0X642D, 0X63ED, 0X63CB, 0X63AA, 0X5C0C, 0X640D, 0X744E, 0X6BEC,
-  0X63EB, 0X5B6A, 0X42C9, 0X636C, 0X9532, 0X6C0D, 0X742E, 0X6C0D,
-  0X5BAC, 0X4B0A, 0X4AEA, 0X640E, 0X6C4F, 0X638C, 0X742D, 0X7CB0,
-  0X4B69, 0X9510, 0X8DB4, 0X7C50, 0X6C2F, 0X530B, 0X538B, 0X63CD,
-  0X63CD, 0X642D, 0X5B8B, 0X536B, 0X640D, 0X7D31, 0X740E, 0X7470,
-  0X7D32, 0X8532, 0X63EE, 0X6C0E, 0X84F2, 0X74F0, 0X740F, 0X746F,
-  0X6C0E, 0X742F, 0X6C4E, 0X5B8E, 0X6C50, 0X7CB1, 0X9DB5, 0X7450,
-  0X5BCE, 0X4B0A, 0X534B, 0X536B, 0X53CD, 0X756D, 0X5C0E, 0X6CB0,
-  0X5BAC, 0X530A, 0X530B, 0X6CAD, 0X7CB1, 0X6CAE, 0X7C70, 0X646F,
-  0X636C, 0X7C8F, 0X7511, 0X7D12, 0X7C91, 0X748F, 0X7CD0, 0X7CD0,
-  0X7CD0, 0X7CCF, 0X84EF, 0X7D0E, 0X744C, 0X7CCD, 0X746D, 0X5BCA,
-  0X6C2C, 0X744C, 0X6C2B, 0X640C, 0X746D, 0X742D, 0X744D, 0X746D,
-  0X744D, 0X6C2C, 0X742D, 0X6C0C, 0X6C0C, 0X63EC, 0X6C4D, 0X63EC,
-  0X63CC, 0X6BCD, 0X63AC, 0X638C, 0X5B6C, 0X5B6C, 0X6BCE, 0X6BAD,
-  0X5BAC, 0X4B0C, 0X5BAD, 0X63AD, 0X532B, 0X5B2B, 0X4B0A, 0X4AEA,
-  0X534B, 0X5B6B, 0X5B4B, 0X5B8C, 0X5B6B, 0X5B6C, 0X5B8C, 0X5B4C,
-  0X5B4B, 0X5B0A, 0X6C2E, 0X5BAC, 0X63EC, 0X6C0C, 0X5B6A, 0X532A,
-  0X5B6C, 0X63EF, 0X5B4C, 0X534C, 0X4AAA, 0X5BCD, 0X73EE, 0X5B8C,
-  0X5B4B, 0X5B8D, 0X5BAC, 0X644F, 0X5B8C, 0X6CB2, 0X6D52, 0X536B,
-  0X6BEE, 0X5B4B, 0X4AE8, 0X4B09, 0X536B, 0X4B6A, 0X5C2B, 0X5369,
-  0X6C4D, 0X7CEF, 0X7C8E, 0X636B, 0X74CF, 0X63ED, 0X6BEE, 0X6C4E,
-  0X6C2E, 0X534B, 0X536C, 0X63ED, 0X5B8C, 0X6CB0, 0X7D11, 0X7D50,
-  0X8D92, 0X9592, 0XA5F5, 0X9E55, 0X8D51, 0X6C4D, 0X642E, 0X636C,
-  0X7490, 0X8D95, 0X8D73, 0X7490, 0X63CE, 0X6C0F, 0X744F, 0X73ED,
-  0X7490, 0X74B0, 0X74B0, 0X6C2F, 0X5BAD, 0X5BAE, 0X5C0F, 0X5BEF,
-  0X63EF, 0X6C10, 0X5C2F, 0X6C0F, 0X8575, 0X7D74, 0X7D33, 0X74B2,
-  0X6C2F, 0X744F, 0X63ED, 0X4B8C, 0X5BAD, 0X63CD, 0X744F, 0X748E,
-  0X7CD0, 0X9593, 0X8530, 0X7CCF, 0X6C8E, 0X63CC, 0X63CC, 0X644D,
-  0X7CCE, 0X95B3, 0X9E13, 0X7D52, 0X6C6F, 0X5B4B, 0X5BCD, 0X640E,
-  0X7CF2, 0X95D4, 0X95B5, 0X742F, 0X63AC, 0X5309, 0X4A48, 0X53CC,
-  0X7CD0, 0X7490, 0X8470, 0X6BCD, 0X7C10, 0X642E, 0X4B0A, 0X8D12,
-  0X84B0, 0X746F, 0X63CD, 0X744F, 0X5BEB, 0X640D, 0X5B6C, 0X532B,
-  0X640D, 0X6C4E, 0X6BEC, 0X63AC, 0X63AB, 0X6C4D, 0X7CB0, 0X6C4C,
-  0X6BEC, 0X538B, 0X532A, 0X5B2B, 0X748E, 0X63EC, 0X6C6E, 0X6BED,
-  0X5B6C, 0X4B0A, 0X4ACA, 0X5BAD, 0X6C6F, 0X634C, 0X73ED, 0X6C4E,
-  0X7CAE, 0X8D12, 0X9DB5, 0X84B1, 0X744F, 0X538C, 0X5BAC, 0X640E,
-  0X6C4F, 0X6C2D, 0X63CD, 0X5B4C, 0X63CD, 0X7CCF, 0X7C2F, 0X7CB0,
-  0X84F1, 0X7CF1, 0X6C2E, 0X5B8C, 0X7CB1, 0X7490, 0X746F, 0X6C4F,
-  0X6B8D, 0X7490, 0X63EE, 0X63EE, 0X7450, 0X8D34, 0X9595, 0X6C50,
-  0X53CD, 0X534B, 0X536C, 0X5B8C, 0X5C0D, 0X74CD, 0X7490, 0X7CB1,
-  0X5BCD, 0X52EA, 0X52EB, 0X750E, 0X7CB0, 0X6C8D, 0X7CB1, 0X536B,
-  0X5B4D, 0X7CAF, 0X74D3, 0X7D12, 0X8532, 0X7C50, 0X7D11, 0X84F0,
-  0X7D11, 0X7CAF, 0X84F0, 0X84EF, 0X6C6D, 0X7C6C, 0X740D, 0X638B,
-  0X6C4D, 0X742D, 0X746D, 0X7CCF, 0X6C4D, 0X744E, 0X742D, 0X744D,
-  0X6C2C, 0X742C, 0X748D, 0X6C0C, 0X6BEC, 0X63CB, 0X6C4D, 0X6C2D,
-  0X63CD, 0X6BED, 0X63CD, 0X638C, 0X636C, 0X63AD, 0X6BCD, 0X6BCE,
-  0X5BCD, 0X4AEA, 0X536D, 0X5B4C, 0X52EA, 0X5B4B, 0X4AE9, 0X4AC9,
-  0X5308, 0X5B4B, 0X5B8D, 0X534B, 0X534B, 0X536C, 0X5B8C, 0X638C,
-  0X5B8B, 0X52C9, 0X63ED, 0X6C4D, 0X63CB, 0X7C0D, 0X536B, 0X63AC,
-  0X63CD, 0X6BEE, 0X6C0F, 0X4B2B, 0X52C9, 0X63CD, 0X6BAC, 0X5B8C,
-  0X5B6B, 0X636C, 0X5BAD, 0X63ED, 0X530B, 0X6D52, 0X7CF2, 0X5B8C,
-  0X63AC, 0X5B6B, 0X5B4B, 0X4B0A, 0X5B8B, 0X53AA, 0X5C0B, 0X5BCA,
-  0X6C2B, 0X7CEF, 0X7C8E, 0X6BCB, 0X74CE, 0X63EB, 0X63EC, 0X6C8D,
-  0X6C4D, 0X5BCC, 0X5B4C, 0X63ED, 0X6C8F, 0X6CD0, 0X7CF1, 0X8D71,
-  0X9DF3, 0XA634, 0XA615, 0X9E34, 0X8D52, 0X746F, 0X6CAF, 0X6C6E,
-  0X7CF1, 0X8D74, 0X8512, 0X7CD1, 0X5BAE, 0X6C2F, 0X7490, 0X7C70,
-  0X7CD2, 0X7470, 0X6CD1, 0X6471, 0X5BAD, 0X5BCE, 0X6450, 0X6C30,
-  0X640F, 0X6C30, 0X53CF, 0X6C31, 0X8D95, 0X8615, 0X7D32, 0X6C71,
-  0X6BEE, 0X640F, 0X6BEF, 0X53ED, 0X5C0D, 0X63CD, 0X744F, 0X7CAF,
-  0X8D71, 0X8D93, 0X8570, 0X7CAE, 0X6C6D, 0X640C, 0X5BCA, 0X640C,
-  0X74AE, 0X9D93, 0XAE97, 0X95F4, 0X74B0, 0X532B, 0X63CD, 0X5B6C,
-  0X7D32, 0X8DB3, 0X8D74, 0X6C0E, 0X63AC, 0X5B4B, 0X4227, 0X640C,
-  0X7CB0, 0X84D0, 0X7CB1, 0X63CD, 0X742F, 0X6BCD, 0X3A25, 0X7CD1,
-  0X84D1, 0X7450, 0X6C2E, 0X7C8E, 0X640C, 0X6C2E, 0X63AD, 0X5B0B,
-  0X6C0E, 0X6C0E, 0X6BED, 0X63ED, 0X5B4A, 0X6C6D, 0X8D51, 0X746E,
-  0X63EC, 0X5B6A, 0X5B8C, 0X5B8B, 0X640C, 0X7C8E, 0X748E, 0X63EE,
-  0X5B8C, 0X4B2B, 0X52EB, 0X5B8D, 0X6C2E, 0X634C, 0X73ED, 0X7C4F,
-  0X74AE, 0X8511, 0X8DB4, 0X84B1, 0X6C0F, 0X4BAC, 0X5BAD, 0X63CE,
-  0X6C90, 0X742E, 0X63CD, 0X5BAC, 0X6BED, 0X7C4F, 0X8470, 0X84F1,
-  0X8CF2, 0X84D1, 0X7C6F, 0X6C0D, 0X7CD0, 0X74B0, 0X746F, 0X6C2E,
-  0X638C, 0X6C4F, 0X7C4F, 0X52EB, 0X7491, 0X9594, 0X95F6, 0X6C2F,
-  0X540E, 0X534B, 0X640D, 0X5B6C, 0X642D, 0X752F, 0X8533, 0X84B1,
-  0X5BCD, 0X532B, 0X538C, 0X750F, 0X7C90, 0X7CCF, 0X7CF0, 0X53AD,
-  0X5B2B, 0X74F1, 0X6491, 0X8593, 0X7D32, 0X84D1, 0X8D52, 0X8531,
-  0X7D11, 0X84F1, 0X8510, 0X84CF, 0X646C, 0X744C, 0X744D, 0X5BAB,
-  0X744E, 0X6C4D, 0X74CE, 0X7CEF, 0X746D, 0X6C6E, 0X744E, 0X744D,
-  0X6BED, 0X744D, 0X74AD, 0X6C2D, 0X6BEC, 0X63EC, 0X6C2D, 0X74AF,
-  0X6BEE, 0X6C0E, 0X6C0E, 0X63EE, 0X532B, 0X63AC, 0X6BEC, 0X6BED,
-  0X63ED, 0X534C, 0X532B, 0X5B4B, 0X5B4B, 0X5B6B, 0X52C9, 0X530A,
-  0X5328, 0X636B, 0X5B4B, 0X5B6B, 0X5BAC, 0X4B4A, 0X5B8C, 0X744F,
-  0X63CC, 0X42E9, 0X644E, 0X6CEE, 0X63CB, 0X7C4E, 0X536C, 0X6BCD,
-  0X6BEE, 0X63CD, 0X7450, 0X534C, 0X532A, 0X5B8D, 0X5BCB, 0X5B8C,
-  0X63AD, 0X5B8C, 0X63ED, 0X6C0E, 0X5309, 0X7510, 0X7D73, 0X5B69,
-  0X5B4B, 0X5B6B, 0X638C, 0X532B, 0X5BCC, 0X5BEB, 0X5BCB, 0X5C0B,
-  0X6C0B, 0X84AF, 0X84CF, 0X744D, 0X748D, 0X6C4B, 0X6C2D, 0X74CE,
-  0X744D, 0X6C4D, 0X6BCD, 0X642E, 0X6C8F, 0X74F0, 0X8512, 0X9593,
-  0X95D3, 0XA656, 0XA634, 0X9613, 0X8511, 0X74D0, 0X6CD0, 0X7530,
-  0X8D73, 0X8DB3, 0X8D74, 0X74F1, 0X63EE, 0X6C2F, 0X8532, 0X7CD2,
-  0X7CF2, 0X742F, 0X6CB1, 0X6451, 0X536C, 0X5BEF, 0X7471, 0X6C30,
-  0X6450, 0X6C70, 0X4B6F, 0X7492, 0X84F3, 0X8E36, 0X6CD1, 0X644F,
-  0X6C0F, 0X6C91, 0X7430, 0X642F, 0X644E, 0X63ED, 0X7490, 0X6C2C,
-  0X8D91, 0X8DB2, 0X8D92, 0X8531, 0X746D, 0X5BAA, 0X53A8, 0X63C6,
-  0X6C4C, 0X9DD4, 0XCEFA, 0X9614, 0X6CB0, 0X5BCD, 0X63AC, 0X5BEC,
-  0X8D52, 0X9593, 0X8512, 0X6BAC, 0X6C0D, 0X5BAB, 0X4B0A, 0X640D,
-  0X7CCF, 0X7CB0, 0X7CB0, 0X6C4F, 0X5BCC, 0X638C, 0X4B4A, 0X8D73,
-  0X7C90, 0X7430, 0X6C2E, 0X742E, 0X744F, 0X8490, 0X740E, 0X5BAC,
-  0X6C8E, 0X6C0E, 0X6C2F, 0X5B8C, 0X63AC, 0X74CF, 0X84D1, 0X84EF,
-  0X6BCB, 0X5BAB, 0X5B8B, 0X636C, 0X748E, 0X9591, 0X746E, 0X5BCC,
-  0X63AD, 0X530B, 0X4ACA, 0X63CD, 0X73CE, 0X638D, 0X740D, 0X84D0,
-  0X7C8E, 0X6C8C, 0X8D33, 0X7CB0, 0X6C0E, 0X63AD, 0X63AD, 0X6C6F,
-  0X7CB1, 0X746F, 0X5B6B, 0X5BAD, 0X5B8C, 0X742F, 0X848F, 0X8490,
-  0X84F1, 0X8CF1, 0X7C8F, 0X744E, 0X6C6D, 0X7CB0, 0X748E, 0X6C2E,
-  0X63CD, 0X640E, 0X746F, 0X638E, 0X7CD1, 0XAE16, 0XA637, 0X6C30,
-  0X644F, 0X538C, 0X5BED, 0X63CC, 0X6C4D, 0X7CEF, 0X7D12, 0X8532,
-  0X5BCD, 0X5B4C, 0X5B6C, 0X74CF, 0X7C90, 0X7CCF, 0X7D91, 0X538D,
-  0X536B, 0X7D32, 0X7D11, 0X8E35, 0X7CF1, 0X84F1, 0X8D92, 0X7D11,
-  0X8571, 0X8531, 0X8572, 0X7CAF, 0X746D, 0X640D, 0X746D, 0X6C0D,
-  0X746E, 0X6C4D, 0X74F0, 0X7D50, 0X746E, 0X746E, 0X74AE, 0X744E,
-  0X6C2E, 0X7C90, 0X7CF0, 0X6C4D, 0X6BEC, 0X6BEC, 0X6C4D, 0X7CD0,
-  0X640E, 0X746F, 0X7C8F, 0X63EE, 0X5B4B, 0X63ED, 0X5BEC, 0X746F,
-  0X74CE, 0X430A, 0X536B, 0X5B6B, 0X5B8B, 0X5B4A, 0X5B4A, 0X5B2A,
-  0X5B29, 0X63AB, 0X638C, 0X532A, 0X5B8C, 0X534B, 0X5B8C, 0X6BEC,
-  0X6BEC, 0X742E, 0X6C6E, 0X748E, 0X7CAD, 0X7CCE, 0X6BCD, 0X63AC,
-  0X63AD, 0X640D, 0X6CD1, 0X63CE, 0X5B6B, 0X5B8C, 0X5329, 0X5B6A,
-  0X63ED, 0X5B6C, 0X6C2D, 0X5BCB, 0X5BCA, 0X74EE, 0X7511, 0X6BCB,
-  0X63AB, 0X5B8B, 0X63AD, 0X5B6B, 0X5BCC, 0X5BCB, 0X5BCB, 0X5C2B,
-  0X6BEC, 0X84AE, 0X84AE, 0X7CCF, 0X7CEE, 0X6C0B, 0X746D, 0X6C6D,
-  0X748E, 0X646E, 0X6C0D, 0X6C6F, 0X74D0, 0X6CF1, 0X7D12, 0X95B4,
-  0X9DF4, 0X9E56, 0XA655, 0X95F4, 0X8511, 0X7CD1, 0X7532, 0X7592,
-  0X8DD5, 0X8DB3, 0X8533, 0X74D1, 0X640F, 0X7470, 0X8D94, 0X8533,
-  0X8533, 0X7410, 0X6CD2, 0X6D13, 0X534D, 0X6410, 0X7451, 0X7471,
-  0X6430, 0X7471, 0X53CF, 0X7471, 0X7CB3, 0X8E77, 0X6CF0, 0X6C6F,
-  0X6C50, 0X6C30, 0X6C50, 0X7490, 0X646F, 0X63CD, 0X74D1, 0X7CCF,
-  0X9592, 0X8DB1, 0X95D2, 0X9D52, 0X748E, 0X5B4A, 0X5BC6, 0X5B25,
-  0X5C05, 0X9574, 0XBEB7, 0X9DF4, 0X74D1, 0X5C0E, 0X63ED, 0X4AEA,
-  0X8D52, 0X9DF4, 0X9594, 0X740D, 0X6BED, 0X63AA, 0X5BAA, 0X742D,
-  0X7C8F, 0X8511, 0X746F, 0X746E, 0X6BEC, 0X5BAB, 0X432A, 0X8532,
-  0X84F2, 0X6C50, 0X5BCD, 0X742F, 0X7CB1, 0X9574, 0X7C90, 0X53ED,
-  0X6C0E, 0X6BEE, 0X7430, 0X5BCE, 0X5BEC, 0X74D0, 0X8D31, 0X8CF0,
-  0X63EC, 0X63AB, 0X638B, 0X6BEC, 0X740C, 0X9DF2, 0X7CCF, 0X6C0C,
-  0X6BED, 0X530A, 0X4B2B, 0X63CE, 0X6B8D, 0X6BEC, 0X7C2D, 0X8CCE,
-  0X7C8E, 0X74AE, 0X8D51, 0X8511, 0X63CD, 0X638C, 0X636C, 0X6C6F,
-  0X7C90, 0X748F, 0X5BAD, 0X5B6C, 0X638C, 0X6C0F, 0X8510, 0X7C90,
-  0X84AF, 0X8CF1, 0X84D0, 0X742E, 0X744D, 0X7CAF, 0X8D30, 0X740E,
-  0X63CD, 0X6C8F, 0X744F, 0X740F, 0X8512, 0XB616, 0XAE98, 0X74B1,
-  0X5C4E, 0X5BCC, 0X5BED, 0X63CC, 0X6C6E, 0X84D1, 0X8D72, 0X95B4,
-  0X642E, 0X636C, 0X63AC, 0X74B0, 0X7CAF, 0X84B0, 0X8570, 0X5B8D,
-  0X4B49, 0X74F0, 0X8D73, 0X95D5, 0X7CF1, 0X8511, 0X8D92, 0X8530,
-  0X8531, 0X7CCF, 0X7D30, 0X7CD0, 0X744E, 0X746F, 0X748E, 0X744F,
-  0X6C6E, 0X7CB0, 0X84F1, 0X7D70, 0X7C90, 0X744F, 0X7CF0, 0X7CAF,
-  0X6C6D, 0X8531, 0X95D3, 0X748E, 0X5BEB, 0X742D, 0X6C4D, 0X74AF,
-  0X6C2E, 0X6C0E, 0X74AF, 0X642D, 0X636C, 0X6BEE, 0X63EC, 0X84B1,
-  0X746E, 0X63AC, 0X63AC, 0X52EA, 0X638B, 0X636A, 0X5B69, 0X5B29,
-  0X5B6A, 0X6BEB, 0X6BCC, 0X636B, 0X638C, 0X63AC, 0X63AB, 0X6BED,
-  0X6BCC, 0X6C4E, 0X6CAE, 0X84EF, 0X748D, 0X7C8E, 0X740D, 0X4AE9,
-  0X6BED, 0X6CAF, 0X7D32, 0X6BED, 0X640E, 0X5B4B, 0X636C, 0X5B8A,
-  0X63AC, 0X5349, 0X748E, 0X63CA, 0X742C, 0X752F, 0X84EE, 0X6C6D,
-  0X5BAB, 0X5B8A, 0X5B6B, 0X536B, 0X5BAC, 0X642C, 0X63ED, 0X6C2D,
-  0X6B8C, 0X84CF, 0X748F, 0X7CCF, 0X7D2F, 0X748D, 0X7CAD, 0X7CCE,
-  0X7CCF, 0X6C6F, 0X6C2E, 0X748F, 0X74D1, 0X7511, 0X8D93, 0X8DB4,
-  0X8D93, 0X9E98, 0XAE36, 0X8D93, 0X84D1, 0X6C50, 0X7D94, 0X7DF3,
-  0X8E36, 0X8DD2, 0X7CF3, 0X74D2, 0X6C30, 0X6C71, 0X95F6, 0X8D53,
-  0X8D74, 0X7C91, 0X7492, 0X6C92, 0X4B4C, 0X5C50, 0X84D3, 0X6C51,
-  0X7472, 0X6410, 0X5BEF, 0X6430, 0X8472, 0X96B9, 0X5CAD, 0X642F,
-  0X642F, 0X6C50, 0X6C71, 0X73CE, 0X642E, 0X5C2D, 0X74F0, 0X8532,
-  0X9DD3, 0XA633, 0X9DF3, 0X8D50, 0X748E, 0X6349, 0X5B84, 0X6367,
-  0X5323, 0X9DD4, 0XAE56, 0X9DF5, 0X6490, 0X6C0F, 0X6BED, 0X6BEE,
-  0X8D32, 0XA613, 0X95F2, 0X7C8E, 0X73ED, 0X634A, 0X63AB, 0X7C4E,
-  0X84AF, 0X84D0, 0X84B0, 0X744E, 0X7C2D, 0X6C0C, 0X63AC, 0X7C91,
-  0X8491, 0X5C10, 0X6BAE, 0X7BAD, 0X7491, 0XAE39, 0X84F3, 0X5BCE,
-  0X63AD, 0X6C0E, 0X8511, 0X7450, 0X6C2E, 0X84D1, 0X9553, 0X8531,
-  0X748E, 0X63AB, 0X63CB, 0X742C, 0X7CAE, 0X9E13, 0X8D4F, 0X5B8A,
-  0X6BED, 0X5B6B, 0X532B, 0X740D, 0X6BEC, 0X742D, 0X7C0C, 0X84AE,
-  0X744C, 0X8550, 0X95B2, 0X7CAF, 0X742D, 0X6BAD, 0X6B8D, 0X7C50,
-  0X7C90, 0X744F, 0X5BED, 0X5B8C, 0X5B6C, 0X640C, 0X7D50, 0X8D31,
-  0X8CF0, 0X8CD1, 0X84D1, 0X7C4E, 0X74AE, 0X84D0, 0X7CCF, 0X742F,
-  0X6C2D, 0X6C2E, 0X7CB0, 0X7C90, 0X8D14, 0XA5F5, 0XA677, 0X74F1,
-  0X646F, 0X5BCD, 0X642E, 0X63CC, 0X6C8E, 0X84B1, 0X8551, 0XA616,
-  0X542D, 0X5B6C, 0X63CD, 0X748F, 0X7CEF, 0X8CD0, 0X8550, 0X53AD,
-  0X53AB, 0X74D0, 0X8572, 0X95F4, 0X8531, 0X7D10, 0X8D31, 0X7CCD,
-  0X7D0F, 0X7CAF, 0X84F0, 0X7D10, 0X746E, 0X7CCE, 0X74CE, 0X7CAF,
-  0X640C, 0X748E, 0X9552, 0X8D52, 0X84D0, 0X8470, 0X84B0, 0X7CCF,
-  0X7C4E, 0X8D71, 0X85B2, 0X7CEE, 0X63EB, 0X6C4C, 0X746D, 0X6C6D,
-  0X6C6D, 0X746E, 0X7C8E, 0X642C, 0X642C, 0X7C6E, 0X6BEC, 0X7CCF,
-  0X8510, 0X7C4D, 0X5B8A, 0X5B4A, 0X638B, 0X6B8A, 0X5B49, 0X5B49,
-  0X638A, 0X6C0B, 0X6C2D, 0X63ED, 0X6C0E, 0X6C2D, 0X63AC, 0X742D,
-  0X6BEB, 0X74CE, 0X74AE, 0X8D50, 0X7CAF, 0X746C, 0X63AB, 0X5B6A,
-  0X63CC, 0X6C4F, 0X74D0, 0X642E, 0X6C0E, 0X532B, 0X5B6B, 0X6B8B,
-  0X5BAA, 0X5369, 0X640C, 0X6C0B, 0X6B8B, 0X7D0F, 0X8570, 0X74AE,
-  0X63EB, 0X63CB, 0X534A, 0X5BAC, 0X63EC, 0X5B8A, 0X6C0E, 0X6C0D,
-  0X6C2E, 0X7CAF, 0X7C8F, 0X74D0, 0X8550, 0X850F, 0X8D2F, 0X850F,
-  0X84F0, 0X7CF1, 0X6C6E, 0X74B0, 0X7CF1, 0X8532, 0X95F3, 0X8552,
-  0X9593, 0X9EDA, 0XADD4, 0X8573, 0X7CB0, 0X6BCE, 0X7D12, 0X8573,
-  0X85F4, 0X95B2, 0X8533, 0X6CB1, 0X6C50, 0X644F, 0X9637, 0X9DB6,
-  0X9595, 0X7CD0, 0X7CB2, 0X6C50, 0X640F, 0X6450, 0X7CD2, 0X7492,
-  0X7451, 0X63F0, 0X5C0F, 0X6C92, 0X9DB7, 0X9657, 0X6CAF, 0X6C10,
-  0X640F, 0X6C30, 0X74B1, 0X7C4F, 0X5C0E, 0X5C4F, 0X7CF1, 0X8572,
-  0X9553, 0XAE35, 0XB636, 0X7D70, 0X744F, 0X63CB, 0X6BE7, 0X63E8,
-  0X5B06, 0X95F2, 0XAE55, 0X95D4, 0X74F1, 0X6C2E, 0X63ED, 0X63EF,
-  0X9DD4, 0X9E14, 0X8D50, 0X848E, 0X6C2C, 0X63CB, 0X6BCC, 0X7C8F,
-  0X8511, 0X74B0, 0X8D30, 0X6C0D, 0X740D, 0X746E, 0X63ED, 0X7D73,
-  0X7C71, 0X6C10, 0X5BEE, 0X640E, 0X7471, 0X8D97, 0X84D2, 0X5B4C,
-  0X5BAC, 0X6C0E, 0X8CF3, 0X8552, 0X742F, 0X7C90, 0X9DB4, 0X9592,
-  0X84D0, 0X636A, 0X640B, 0X7CCF, 0X73EB, 0XAE53, 0X8D50, 0X6C0A,
-  0X63EB, 0X5B8B, 0X638A, 0X740D, 0X742C, 0X744D, 0X846C, 0X7C8E,
-  0X5306, 0X856E, 0X9E14, 0X84CF, 0X7C6E, 0X6BED, 0X6BCD, 0X8470,
-  0X7C8F, 0X744E, 0X640D, 0X5BAC, 0X4BCC, 0X742D, 0X8571, 0X9DD2,
-  0X9512, 0X8CD0, 0X7C6F, 0X742D, 0X7CAE, 0X84F1, 0X84F0, 0X7C50,
-  0X7CB0, 0X748F, 0X7CD0, 0X742F, 0X9514, 0X8D72, 0XA656, 0X8D93,
-  0X646F, 0X5BAC, 0X644F, 0X63CB, 0X746E, 0X8470, 0X8E13, 0X9DD3,
-  0X644E, 0X5BED, 0X73EE, 0X7CF0, 0X8510, 0X84D0, 0X852F, 0X640D,
-  0X638C, 0X7CF1, 0X8D72, 0X8E13, 0X84CE, 0X8550, 0X9551, 0X84CE,
-  0X74AE, 0X746D, 0X7C8E, 0X7CAE, 0X748F, 0X742C, 0X7D0F, 0X746C,
-  0X742C, 0X8510, 0X9552, 0X8511, 0X8550, 0X848F, 0X84B1, 0X84B0,
-  0X744E, 0X8D91, 0X8D70, 0X7D4E, 0X748D, 0X6C4C, 0X6C4D, 0X748D,
-  0X6C4B, 0X748E, 0X746D, 0X6C4D, 0X640B, 0X746D, 0X642C, 0X9D71,
-  0X746D, 0X6C4C, 0X6BCC, 0X5B8A, 0X636A, 0X6B8A, 0X6369, 0X4AC7,
-  0X5B49, 0X6BEC, 0X746E, 0X640E, 0X6C6E, 0X748D, 0X6C0C, 0X6C0C,
-  0X6BEB, 0X738C, 0X8510, 0X852F, 0X7CCE, 0X7CED, 0X6C2C, 0X5B4B,
-  0X63AC, 0X6C4E, 0X6CCF, 0X748F, 0X6C2E, 0X42E9, 0X5ACA, 0X636B,
-  0X53CA, 0X5BAB, 0X6C2B, 0X6C2B, 0X63A8, 0X7CEE, 0X7D31, 0X6C4D,
-  0X6C2C, 0X63EB, 0X534A, 0X5BAC, 0X5BCC, 0X5B8A, 0X742E, 0X7490,
-  0X744E, 0X7D11, 0X7C4D, 0X7531, 0X8D71, 0X8530, 0X8D30, 0X9572,
-  0X9532, 0X84F1, 0X748F, 0X6C6E, 0X7CF1, 0X8511, 0X8DD3, 0X7511,
-  0X8D54, 0X9EFA, 0XB5F5, 0X8573, 0X742E, 0X6C4F, 0X74D0, 0X8D72,
-  0X8615, 0X95D3, 0X8512, 0X74F1, 0X6C2F, 0X7CD1, 0X95B5, 0XAE17,
-  0X9594, 0X74B1, 0X74B0, 0X6C70, 0X6C4F, 0X7491, 0X74B2, 0X7491,
-  0X7450, 0X6C11, 0X6C70, 0X74F2, 0X9DF8, 0XA638, 0X642E, 0X63CE,
-  0X640F, 0X7470, 0X6C90, 0X532C, 0X6C0F, 0X5C4F, 0X7470, 0X8552,
-  0X95B4, 0XBE57, 0X9E14, 0X7D72, 0X742F, 0X4B4A, 0X6C29, 0X6C6A,
-  0X63EA, 0X9DF4, 0XAE75, 0X95F4, 0X7D11, 0X63ED, 0X6C0E, 0X6470,
-  0XB6D8, 0X95B3, 0X8571, 0X84CF, 0X740D, 0X6C2C, 0X6C0C, 0X7C8F,
-  0X94F1, 0X84F0, 0X850F, 0X73EB, 0X7C2D, 0X73CC, 0X746E, 0X74F2,
-  0X7C51, 0X636C, 0X744F, 0X744F, 0X7C70, 0X9D55, 0X7C10, 0X638C,
-  0X5BAD, 0X63EE, 0X74F2, 0X7C90, 0X6C0F, 0X7C6F, 0X9533, 0X9DD3,
-  0X9D31, 0X638A, 0X6CAF, 0X74AE, 0X846D, 0XB674, 0X9571, 0X742B,
-  0X740C, 0X5BAB, 0X63AB, 0X746D, 0X84CF, 0X7C8C, 0X7CAE, 0X7CCF,
-  0X742B, 0X7D8C, 0X9592, 0X7CAE, 0X748E, 0X63EC, 0X6BCD, 0X84F1,
-  0X84B0, 0X746F, 0X642E, 0X63CC, 0X53EC, 0X744E, 0X9552, 0X9E33,
-  0X9532, 0X84B0, 0X7C6F, 0X744E, 0X7CAF, 0X8D11, 0X84D0, 0X84F2,
-  0X8512, 0X7CD0, 0X84D0, 0X7C0F, 0X8CF2, 0X9594, 0X9E36, 0X9595,
-  0X6C8F, 0X63ED, 0X6C8F, 0X5348, 0X742D, 0X84B0, 0X95F3, 0XA5B3,
-  0X7490, 0X640D, 0X6BAD, 0X8531, 0X8530, 0X84F0, 0X8D70, 0X640D,
-  0X7C2E, 0X8510, 0X8D31, 0X9E15, 0X84CF, 0X8570, 0X95B0, 0X84EE,
-  0X74AD, 0X744D, 0X746D, 0X84AE, 0X74AE, 0X7C6E, 0X7CCF, 0X7CAD,
-  0X7CAE, 0X850F, 0X9571, 0X8510, 0X8530, 0X84F0, 0X8D52, 0X8D11,
-  0X8510, 0X9571, 0X8D51, 0X7CEE, 0X6CAC, 0X6C8B, 0X6C2C, 0X6C6C,
-  0X6C4B, 0X6C4B, 0X6C2C, 0X7CAE, 0X6C0C, 0X7C8E, 0X640C, 0X9D91,
-  0X8CED, 0X7C8D, 0X740D, 0X63CB, 0X638A, 0X6BCA, 0X5B47, 0X5B48,
-  0X63AB, 0X746E, 0X74CE, 0X6BCD, 0X6C4E, 0X746D, 0X6C4D, 0X740D,
-  0X740C, 0X7B8D, 0X844D, 0X850E, 0X850F, 0X7C8E, 0X6C2D, 0X52A8,
-  0X63AC, 0X640D, 0X6CAF, 0X7D31, 0X6C2D, 0X5309, 0X52AA, 0X63AB,
-  0X53AA, 0X63AB, 0X7C2E, 0X7D2E, 0X746B, 0X8572, 0X8531, 0X742D,
-  0X746D, 0X63EB, 0X5B6B, 0X5BAC, 0X5BCC, 0X6C2E, 0X742E, 0X6CF0,
-  0X8CF1, 0X7D31, 0X648F, 0X8DB3, 0X95D3, 0X8D72, 0X8D71, 0X9D93,
-  0X9D74, 0X7CF1, 0X7C90, 0X7C2E, 0X95B3, 0X9553, 0X8572, 0X74B1,
-  0X84F2, 0X9658, 0XB677, 0X8DB3, 0X7C8F, 0X6C4F, 0X74B0, 0X8D73,
-  0X8DB3, 0X9DF3, 0X8552, 0X7490, 0X6C4F, 0X74B1, 0X95B5, 0XAE36,
-  0X9DB4, 0X7CD1, 0X7CF1, 0X746F, 0X7490, 0X7CF2, 0X7CF2, 0X7470,
-  0X6C51, 0X6C30, 0X6C70, 0X7512, 0X95F7, 0X9E38, 0X74B0, 0X642D,
-  0X63AE, 0X6C2F, 0X5C4F, 0X432B, 0X7430, 0X6C70, 0X74B2, 0X84D2,
-  0X9E15, 0XB699, 0X9E57, 0X7CB1, 0X748F, 0X5BAB, 0X6C2D, 0X6C4A,
-  0X748E, 0XA615, 0XAE75, 0X95D3, 0X7D31, 0X63AC, 0X644E, 0X74D0,
-  0XB697, 0X9DF4, 0X8D71, 0X7CCF, 0X7C2D, 0X6BEC, 0X740D, 0X84AF,
-  0X9532, 0X8D30, 0X84AE, 0X7CAE, 0X84AF, 0X7BEE, 0X84D1, 0X74B0,
-  0X8D34, 0X4AC7, 0X6B8C, 0X94D2, 0X7CB0, 0X8D74, 0X7490, 0X4B0A,
-  0X6C0D, 0X63AC, 0X8491, 0X7CB1, 0X6C2F, 0X742F, 0XA5B5, 0X9DD3,
-  0X8D11, 0X42C9, 0X74D0, 0X84CE, 0X746E, 0XB6B4, 0X9E11, 0X638A,
-  0X6C0C, 0X63CB, 0X6C2C, 0X7CCE, 0X7CEE, 0X8CAE, 0X7CCE, 0X8510,
-  0X7D2E, 0X856F, 0X9572, 0X84EF, 0X7CAE, 0X5BED, 0X73ED, 0X8D52,
-  0X84D1, 0X6C4E, 0X6C0E, 0X63AD, 0X63ED, 0X744F, 0XADF6, 0XA635,
-  0X9D73, 0X8CD1, 0X7C8F, 0X6C0E, 0X84F1, 0X9573, 0X8D11, 0X8D53,
-  0X8D73, 0X8491, 0X8CF2, 0X6B8E, 0X8D34, 0X95D5, 0X9DF6, 0X9594,
-  0X7D11, 0X5BCC, 0X6C0D, 0X63EA, 0X7C8F, 0X8D10, 0X9E96, 0XA5B4,
-  0X74D0, 0X63ED, 0X7C2F, 0X8510, 0X7CF0, 0X8D10, 0X8D91, 0X742E,
-  0X7C8F, 0X8550, 0X8D32, 0XA675, 0X8530, 0X8D50, 0X8DD0, 0X84CE,
-  0X6C4C, 0X6C2C, 0X742D, 0X84AE, 0X7CAE, 0X642B, 0X84CF, 0X7CAC,
-  0X852E, 0X9571, 0X9DF3, 0X84CF, 0X8510, 0X9532, 0X8D93, 0X8D32,
-  0X8510, 0X9DD2, 0X8D50, 0X748D, 0X6CAC, 0X648C, 0X6C8C, 0X6C8C,
-  0X640A, 0X640A, 0X640A, 0X74AD, 0X646B, 0X8D30, 0X748E, 0X95B1,
-  0XAE73, 0X7CCB, 0X7C6D, 0X6C2B, 0X638A, 0X6BEB, 0X5B28, 0X3A84,
-  0X6C2D, 0X74AE, 0X74CF, 0X73CE, 0X742E, 0X742D, 0X84D0, 0X740D,
-  0X7B6B, 0X840D, 0X8CCF, 0X84EF, 0X746E, 0X742E, 0X63EC, 0X5B2A,
-  0X636B, 0X634C, 0X74D1, 0X7530, 0X6C0D, 0X63CC, 0X4AEA, 0X5B8B,
-  0X5C0B, 0X636B, 0X744D, 0X8D10, 0X84F1, 0X7DB4, 0X8D73, 0X748F,
-  0X84CE, 0X6C2C, 0X63CC, 0X63AC, 0X6C6F, 0X6C2E, 0X748F, 0X74B0,
-  0X84F2, 0X8D52, 0X8D73, 0XAE56, 0X9DF4, 0X95B4, 0X95B3, 0XA615,
-  0X9DD5, 0X8CD1, 0X8511, 0X84AF, 0X9593, 0X8D53, 0X7CF0, 0X744F,
-  0X7CF1, 0XA657, 0XB6B9, 0X8D93, 0X6BAD, 0X744E, 0X748F, 0X9573,
-  0X95D2, 0X9DD3, 0X8572, 0X74B0, 0X7490, 0X74F1, 0X9DD5, 0XBEB8,
-  0X9554, 0X7CF1, 0X7490, 0X746F, 0X7C70, 0X7CF2, 0X7CD2, 0X6C50,
-  0X6C30, 0X6C0F, 0X6BEF, 0X8553, 0X9DF7, 0X9615, 0X8510, 0X6C4E,
-  0X636E, 0X5BAE, 0X5C2F, 0X53AB, 0X6430, 0X6C50, 0X74B1, 0X8CF2,
-  0XAE37, 0XB6FA, 0XB679, 0X7CF2, 0X6C6F, 0X53CA, 0X640C, 0X644C,
-  0X84D0, 0XB657, 0XC6D7, 0X8D92, 0X8552, 0X7CF0, 0X6C4F, 0X7CF0,
-  0XAEB7, 0XA614, 0X9573, 0X7CCF, 0X7C8E, 0X744D, 0X740D, 0X8CCF,
-  0XA593, 0X8D31, 0X7CCF, 0X8D71, 0X8510, 0X84AF, 0X8D72, 0X7490,
-  0X7C32, 0X630A, 0X5B0B, 0X84F2, 0X8D52, 0X95D6, 0X7450, 0X636C,
-  0X6C0D, 0X5BCB, 0X7CB1, 0X8512, 0X744F, 0X7C90, 0X9573, 0XA5F4,
-  0X8D31, 0X742D, 0X848E, 0X7CAF, 0X9DB2, 0XC714, 0XA5F2, 0X5BAB,
-  0X6C0C, 0X6BCB, 0X6C6C, 0X7D2E, 0X84EF, 0X84EF, 0X748E, 0X8530,
-  0X7D70, 0X9DB2, 0XA5D2, 0X84CF, 0X7CAE, 0X63ED, 0X742E, 0X9D73,
-  0X84F0, 0X742E, 0X6C0D, 0X63CD, 0X63ED, 0X7C8F, 0XAE15, 0XB677,
-  0X9D53, 0X8D32, 0X748F, 0X744E, 0X8D32, 0X8D73, 0X9572, 0X8D74,
-  0X9594, 0X84F2, 0X9D54, 0X5B2D, 0X8D74, 0X9DF6, 0X9E16, 0X9594,
-  0X7D11, 0X6C2E, 0X6C2E, 0X6C2B, 0X7CCF, 0X7CF0, 0X96B5, 0XB656,
-  0X6C90, 0X63EE, 0X6C0D, 0X8D31, 0X8510, 0X8D31, 0X8D71, 0X7C90,
-  0X6C8F, 0X8571, 0X9593, 0X95D2, 0X8D52, 0X8D50, 0X8D70, 0X7CCD,
-  0X742C, 0X742C, 0X740D, 0X84CE, 0X8D0F, 0X4BEA, 0X8CEF, 0X7CCD,
-  0X8D4F, 0XA612, 0XADF4, 0X850F, 0X8510, 0X9552, 0X9DD3, 0X8D72,
-  0X8550, 0XA652, 0X9590, 0X850D, 0X74ED, 0X6C8B, 0X648B, 0X6C6C,
-  0X644A, 0X640B, 0X6C2C, 0X746C, 0X6C6C, 0X854F, 0X7CEE, 0X9590,
-  0XB675, 0X7CCD, 0X7C8D, 0X6C0B, 0X63CA, 0X6BEB, 0X5B28, 0X5B69,
-  0X746D, 0X748E, 0X74CE, 0X7CAF, 0X6C4F, 0X7C6F, 0X7CAF, 0X7C6E,
-  0X7C2D, 0X7CAF, 0X84AF, 0X84CF, 0X746E, 0X748E, 0X6C2D, 0X5B8B,
-  0X636C, 0X632D, 0X6C8F, 0X7CF0, 0X744E, 0X6C6E, 0X4AE8, 0X5B6B,
-  0X74CE, 0X634B, 0X74AE, 0X94F2, 0X7553, 0X8E15, 0X9DF6, 0X84CF,
-  0X8D0F, 0X6C4C, 0X744E, 0X63ED, 0X6C6F, 0X63CC, 0X74AF, 0X8511,
-  0X8552, 0X9553, 0X8552, 0XA636, 0XAE56, 0X9DD4, 0XA635, 0XAE76,
-  0XA656, 0X9511, 0X8531, 0X74D0, 0X8D32, 0X8DD5, 0X74EF, 0X6BCE,
-  0X74B0, 0XA637, 0XA6D8, 0X9DF4, 0X7C6F, 0X5BEC, 0X646F, 0X9573,
-  0X9DD3, 0XA614, 0X8D73, 0X7CB0, 0X6C4F, 0X7CF1, 0XADF6, 0XB6B7,
-  0X8D34, 0X8532, 0X7C90, 0X7C8F, 0X7C90, 0X84F3, 0X7CD1, 0X74B1,
-  0X6C2F, 0X7450, 0X7C50, 0X8D33, 0XA617, 0X9635, 0X7CCF, 0X6BED,
-  0X4ACA, 0X4B2C, 0X5C4E, 0X4BAE, 0X5BCD, 0X6C70, 0X74B0, 0X84F2,
-  0XAE16, 0XC6FA, 0XB698, 0X6CF1, 0X644F, 0X5BAB, 0X63EC, 0X6C8D,
-  0X8CF1, 0XB677, 0XCEB8, 0X8552, 0X9593, 0X6C4E, 0X748F, 0X7CF0,
-  0XAE76, 0XAE76, 0X9592, 0X84AF, 0X8CCF, 0X744E, 0X740D, 0X84CF,
-  0XADD4, 0X9572, 0X84D0, 0X9531, 0X8D32, 0X84D0, 0X8DD4, 0X6BEE,
-  0X63CE, 0X6C2E, 0X42EA, 0X94B1, 0XA594, 0X9DD5, 0X8470, 0X5B0B,
-  0X8552, 0X5B2A, 0X8552, 0X8574, 0X742E, 0X7C90, 0X9D93, 0XA5F4,
-  0X8D11, 0X84B0, 0X8CF0, 0X6C2F, 0X956F, 0XCEF6, 0XAE34, 0X5329,
-  0X746C, 0X6BEB, 0X6C8D, 0X8570, 0X9572, 0X8D0F, 0X8D12, 0X8D71,
-  0X9590, 0X9DF3, 0XAE54, 0X7CCF, 0X7C6E, 0X6BCC, 0X6C2E, 0X9D73,
-  0X9512, 0X7C8F, 0X740E, 0X63CD, 0X6BAD, 0X8D12, 0XB657, 0XADF6,
-  0X9D74, 0X8D73, 0X7490, 0X744E, 0X8D52, 0X95D4, 0X9574, 0X9594,
-  0X8D53, 0X84D2, 0X9533, 0X52CA, 0X8533, 0XA616, 0X9E16, 0X9593,
-  0X7D10, 0X746F, 0X6C4E, 0X6C6E, 0X74D0, 0X8510, 0X9655, 0XB677,
-  0X6C50, 0X640E, 0X7C8F, 0X8D31, 0X8D30, 0X8D10, 0X8D71, 0X7CB0,
-  0X6CD0, 0X8D52, 0X9DF5, 0X9D92, 0X9572, 0X9571, 0X8D50, 0X7CCE,
-  0X744D, 0X742C, 0X744D, 0X7CCD, 0X8D4F, 0X748C, 0X84EE, 0X8D30,
-  0X8D70, 0X9E52, 0XB634, 0X8D50, 0X8D30, 0X9572, 0XA635, 0X9593,
-  0X8D90, 0XA672, 0X95B0, 0X852E, 0X6CAC, 0X74CD, 0X648B, 0X6C6C,
-  0X5BC9, 0X640A, 0X6C2B, 0X6C4C, 0X6C6C, 0X8D0F, 0X854E, 0X9630,
-  0XB6B5, 0X74AB, 0X7C8D, 0X6C4C, 0X6BEB, 0X740B, 0X5B89, 0X5327,
-  0X746D, 0X74AD, 0X7D0E, 0X7CEF, 0X84CF, 0X84CF, 0X7C6E, 0X7C8F,
-  0X84F1, 0X8D32, 0X8CF0, 0X7CEF, 0X74AF, 0X7CAF, 0X6BED, 0X6C0D,
-  0X638B, 0X6BCD, 0X8D32, 0X7CF0, 0X74AE, 0X7CB0, 0X4B09, 0X5AEA,
-  0X7D11, 0X63AB, 0X742F, 0X8D32, 0X8DD4, 0XA6B7, 0X95F4, 0X8D11,
-  0X84F0, 0X7CAE, 0X7CAE, 0X6C2D, 0X6CAF, 0X63AB, 0X7C8F, 0X7CAF,
-  0X8DB3, 0X9DB4, 0X9DF5, 0XA636, 0XA615, 0XA5F4, 0XA635, 0XB696,
-  0XA693, 0X9D73, 0X8D52, 0X8D72, 0X9D93, 0X9636, 0X6C6D, 0X73EE,
-  0X6C6E, 0XA657, 0XAEF8, 0X9E14, 0X7C70, 0X638B, 0X7490, 0X8D72,
-  0X9DD3, 0X9DD3, 0X8D93, 0X84F1, 0X748F, 0X8532, 0XB616, 0XBED8,
-  0X9554, 0X8D53, 0X7C8F, 0X7CB0, 0X7CB0, 0X84F2, 0X7CF1, 0X7470,
-  0X6C2F, 0X6C0F, 0X7450, 0X9DB5, 0XAE35, 0X9DF4, 0X7D0F, 0X744E,
-  0X2206, 0X530A, 0X6C6F, 0X53CE, 0X6C4F, 0X7CF1, 0X746F, 0X8533,
-  0XA636, 0XC6B9, 0XBEB8, 0X8511, 0X5C2E, 0X6BCD, 0X638B, 0X7C6E,
-  0X8D32, 0XBEB9, 0XCED8, 0X9DB4, 0X8592, 0X74B0, 0X748F, 0X644E,
-  0XB6B7, 0XC6F8, 0X9D92, 0X84AC, 0X8CCE, 0X7C4F, 0X7C4E, 0X7C8F,
-  0XA5B5, 0XADF5, 0X8CF0, 0X9572, 0XA594, 0X84F0, 0X9DD3, 0X744F,
-  0X530A, 0X640C, 0X5B49, 0X9CF1, 0X9D95, 0X95B5, 0X8493, 0X62EC,
-  0X6CD0, 0X6B8B, 0X8554, 0X8D74, 0X7C90, 0X8470, 0XADD4, 0XAE15,
-  0X9511, 0X9552, 0X9531, 0X94CF, 0X95B1, 0XD739, 0XADF5, 0X6C6D,
-  0X6C6D, 0X6C2D, 0X74CE, 0X9DD3, 0XA5F3, 0X9551, 0X9572, 0X8D91,
-  0X9DB2, 0XA633, 0XC6B8, 0X7C8F, 0X7C4E, 0X6BCC, 0X746E, 0XA594,
-  0X9D73, 0X7CCF, 0X7C2F, 0X63EE, 0X5B6C, 0X9532, 0XBE58, 0XB616,
-  0XA616, 0XA615, 0X7C71, 0X7C8F, 0X9593, 0X9DD5, 0X9D94, 0X9DB5,
-  0X9573, 0X8CB1, 0X8CF2, 0X5B4A, 0X95F6, 0XA616, 0XA615, 0X9DB3,
-  0X8511, 0X7C6F, 0X744E, 0X74AF, 0X7CB0, 0X8D52, 0X8E35, 0X9DB5,
-  0X7450, 0X640E, 0X746E, 0X9572, 0X8D31, 0X9511, 0X95D4, 0X8D31,
-  0X6CAF, 0X8D93, 0X9DF4, 0X9D52, 0X9571, 0X9DB2, 0X8D31, 0X7CCE,
-  0X6C0B, 0X742C, 0X744C, 0X84CE, 0X8D2F, 0X84CC, 0X7D0E, 0X9530,
-  0X8D6F, 0X9E72, 0XB654, 0X9571, 0X8D51, 0X9D93, 0XA614, 0XA5F5,
-  0X9550, 0XA632, 0X9E32, 0X8D6F, 0X74ED, 0X74CD, 0X6CAC, 0X7CCD,
-  0X5BE9, 0X640A, 0X746C, 0X748C, 0X6C8B, 0X7CCD, 0X854F, 0X9E52,
-  0X9EB2, 0X84CC, 0X84AE, 0X744C, 0X6C2B, 0X7C6D, 0X5347, 0X5B27,
-  0X742C, 0X84AE, 0X84EE, 0X7C6D, 0X8CAF, 0X8CF0, 0X848E, 0X8510,
-  0X9592, 0XAE14, 0X856F, 0X7D0E, 0X7CCF, 0X746E, 0X6C2D, 0X848E,
-  0X638B, 0X73ED, 0X85D4, 0X6D2E, 0X7CCE, 0X84D0, 0X4AEA, 0X5AA9,
-  0X7C8F, 0X638D, 0X746F, 0X8D32, 0X9DD3, 0XB6D8, 0X95F4, 0X84CF,
-  0X84F0, 0X7CAE, 0X744D, 0X6C2D, 0X748F, 0X63EB, 0X848F, 0X84CE,
-  0X8D72, 0XA5F5, 0XAE35, 0XA655, 0XA5F3, 0XA615, 0XAE35, 0XBE96,
-  0XAEB4, 0X9DD3, 0X9593, 0X9DB4, 0X9D93, 0X9635, 0X748E, 0X73AE,
-  0X7CD0, 0X8DD3, 0XBEF8, 0X9E53, 0X7C0F, 0X742E, 0X7CF0, 0X8D72,
-  0XA5F4, 0XA5F3, 0X9593, 0X7D11, 0X6C4F, 0X8D52, 0XB5F6, 0XC6F9,
-  0X9594, 0X8552, 0X7CD0, 0X7CB0, 0X9553, 0X8D53, 0X8532, 0X6C50,
-  0X6C4F, 0X7450, 0X7470, 0XA594, 0XB656, 0X9DF4, 0X8550, 0X5C0C,
-  0X4AE7, 0X5B2B, 0X642E, 0X646E, 0X6C6F, 0X7CB0, 0X74D1, 0X8552,
-  0XA676, 0XBEB8, 0XB677, 0X8CF0, 0X6C4D, 0X6C2E, 0X636D, 0X748F,
-  0X84F1, 0XC6B9, 0XD73A, 0XAE16, 0X8D73, 0X748F, 0X7C90, 0X542D,
-  0XB676, 0XC6F9, 0XAE15, 0X8C90, 0X8CD0, 0X7C6F, 0X7CAF, 0X7490,
-  0X9594, 0XAE78, 0X9532, 0X9DB3, 0XA5B3, 0X9D72, 0X9552, 0X7C70,
-  0X4287, 0X536A, 0X63CB, 0X844F, 0X8DD6, 0X8594, 0X7CB2, 0X5B0B,
-  0X7510, 0X7C4F, 0X8512, 0X8D34, 0X9512, 0X8490, 0XAE36, 0XA614,
-  0X84D1, 0X9DD3, 0X9D72, 0X9D2E, 0XB675, 0XD759, 0X9DD3, 0X746E,
-  0X7C8F, 0X740D, 0X7CCF, 0X9DF4, 0XA633, 0X9551, 0X9591, 0X9D91,
-  0XA5F3, 0XB6B4, 0XB617, 0X740C, 0X742D, 0X742E, 0X84D0, 0XB615,
-  0X9D93, 0X8511, 0X746F, 0X6C2E, 0X6C2E, 0X9511, 0XADF7, 0XB616,
-  0X9DD4, 0X9DB3, 0X8511, 0X8511, 0X9553, 0X9D73, 0XA5D5, 0XA5D5,
-  0X9D73, 0X8CF1, 0X8490, 0X63CB, 0X9E15, 0XA615, 0XA615, 0X9DB3,
-  0X8D52, 0X84B0, 0X7C6F, 0X748F, 0X84D0, 0X9572, 0XAF3A, 0XA5B7,
-  0X7CB1, 0X642D, 0X742E, 0X8D72, 0X8D72, 0X9531, 0X95D5, 0X8D52,
-  0X7D31, 0X9DD3, 0XA615, 0X9D93, 0X9550, 0X9572, 0X8D71, 0X84EF,
-  0X744C, 0X740C, 0X744C, 0X84ED, 0X8D6F, 0X8D0E, 0X854E, 0X852E,
-  0X95B1, 0X9E52, 0XAE73, 0XA5D2, 0X9D92, 0X9DB3, 0XA5D3, 0XAE76,
-  0X9591, 0XA633, 0XA653, 0X95B0, 0X6D0D, 0X7CEF, 0X74CD, 0X7CED,
-  0X6C8B, 0X642A, 0X748C, 0X7CAD, 0X7CAD, 0X850E, 0X8D0E, 0XA672,
-  0X96B2, 0X8DAF, 0X7C8C, 0X742B, 0X742C, 0X7C6D, 0X5347, 0X6368,
-  0X740C, 0X7CAD, 0X852F, 0X7CAE, 0X84CE, 0X84EF, 0X7CAD, 0X850E,
-  0X8DB0, 0XAE33, 0X95D1, 0X8D71, 0X6C6D, 0X7CAD, 0X742C, 0X6BEC,
-  0X638B, 0X5B09, 0X8E15, 0X750E, 0X7CCD, 0X7CCE, 0X634B, 0X638B,
-  0X746E, 0X6BED, 0X744E, 0X8CF0, 0X9D90, 0XB697, 0X9DD1, 0X8D10,
-  0X8D31, 0X7CAE, 0X63EC, 0X63EC, 0X744E, 0X644C, 0X742E, 0X850E,
-  0X9572, 0XADD4, 0XAE56, 0XA655, 0XAE15, 0XAE35, 0XAE74, 0XC6F7,
-  0XB695, 0XA614, 0X9DD4, 0XA5B4, 0XA5F5, 0X8D91, 0X6C0D, 0X6BED,
-  0X74D0, 0X9DD3, 0XC6F6, 0X9E53, 0X740F, 0X740F, 0X7CD0, 0X9572,
-  0X9DB3, 0X9DD4, 0XA5B4, 0X8552, 0X74AF, 0X9552, 0XBE57, 0XBED8,
-  0X9DD5, 0X8532, 0X8512, 0X6C30, 0X9574, 0X9D94, 0X8553, 0X7430,
-  0X7490, 0X7C90, 0X84D1, 0XA5F5, 0XC6B8, 0X9D72, 0X8591, 0X740D,
-  0X4B2A, 0X4ACA, 0X636C, 0X644D, 0X84D2, 0X7C91, 0X7470, 0X7D12,
-  0XAE56, 0XBED8, 0XB657, 0X8D0F, 0X5B6A, 0X6C4E, 0X534B, 0X74AF,
-  0X8D72, 0XBEF9, 0XD71A, 0XAE76, 0X9574, 0X7490, 0X84F1, 0X5CB0,
-  0XBE97, 0XBED7, 0XB676, 0X9491, 0X94F2, 0X8D11, 0X7CD0, 0X84D0,
-  0X9572, 0XB656, 0X9572, 0XA5D3, 0XB615, 0X9D72, 0X9D52, 0X742E,
-  0X3A46, 0X5369, 0X7CB0, 0X7C6F, 0X9595, 0X95B5, 0X7470, 0X6B8D,
-  0X6C6E, 0X6C4E, 0X84F2, 0X8D53, 0X9574, 0X8CB1, 0XADF5, 0XA5F4,
-  0X84D1, 0XA5D4, 0XB634, 0X8C8D, 0XBF19, 0XC6F8, 0XA5D3, 0X8D31,
-  0X7C8F, 0X7C2E, 0X7CCF, 0XA614, 0XA5F4, 0X9D91, 0X9D91, 0XA5F4,
-  0XA614, 0XBF16, 0XB5D6, 0X746D, 0X73ED, 0X846F, 0X9531, 0XADD5,
-  0X9DB4, 0X8D32, 0X7490, 0X73AD, 0X744C, 0XA574, 0XADF7, 0XADD6,
-  0X9D75, 0XAE33, 0X9592, 0X8511, 0X9D93, 0X9D72, 0XAE15, 0XA5F5,
-  0X9572, 0X8510, 0X8C70, 0X84F0, 0XA615, 0XA614, 0XAE15, 0X9DB4,
-  0X8D11, 0X8CF0, 0X744E, 0X746F, 0X84D0, 0X8D72, 0XA6F8, 0XADD6,
-  0X7C91, 0X63ED, 0X7C8E, 0X9634, 0X9D73, 0X9D73, 0X9E15, 0X95D4,
-  0X8D31, 0X9E15, 0XA635, 0X9D93, 0X9D93, 0XA5B3, 0X95B1, 0X8D10,
-  0X6C2C, 0X740B, 0X744C, 0X84ED, 0X958F, 0X8D2F, 0X852D, 0X8D90,
-  0X95D1, 0XB654, 0XA632, 0X9DD1, 0X9DB2, 0XA5F4, 0X9D92, 0XA614,
-  0X9DB2, 0XAE33, 0XAE74, 0X8DB0, 0X84EF, 0X7D0E, 0X854F, 0X852F,
-  0X7CCD, 0X5C09, 0X74AC, 0X850E, 0X84ED, 0X8D2E, 0X8CEE, 0XA651,
-  0XAEF3, 0X9630, 0X7CCC, 0X7C8D, 0X7C4C, 0X8CCF, 0X5327, 0X6BCA,
-  0X73EC, 0X84AE, 0X84CE, 0X84CD, 0X84CD, 0X8CEF, 0X7C8C, 0X8CEE,
-  0X95B1, 0X9DB1, 0X9DF2, 0X8D90, 0X7CEE, 0X7C8D, 0X6C2C, 0X63EB,
-  0X63AA, 0X5BAB, 0X8531, 0X8CCF, 0X7CED, 0X7C8E, 0X6BCC, 0X6BEC,
-  0X6BEC, 0X63CC, 0X746D, 0X94CE, 0XA5D2, 0XB677, 0XAE33, 0X9551,
-  0X8D10, 0X7CCE, 0X6C2C, 0X63AB, 0X746D, 0X5BEB, 0X9511, 0X9570,
-  0XA592, 0XADF5, 0XBE97, 0XAE56, 0XB676, 0XAE75, 0XAE94, 0XCF38,
-  0XB675, 0XAE54, 0XA5F5, 0XAE15, 0XAE75, 0X9530, 0X738C, 0X742E,
-  0X7CF0, 0XA5F4, 0XBED6, 0XAE96, 0X742F, 0X7C6F, 0X7CF0, 0X9DB3,
-  0XA614, 0XAE35, 0XA5B4, 0X8531, 0X7CF0, 0X9532, 0XC6DA, 0XB6B7,
-  0X9D94, 0X84D2, 0X84F2, 0X8D12, 0XA594, 0XA5B4, 0X7533, 0X7C70,
-  0X7CB1, 0X84D1, 0X84B1, 0XB678, 0XCEF9, 0X9D92, 0X9DB2, 0X6C8E,
-  0X6BCC, 0X538C, 0X3A06, 0X6C2E, 0X7CD2, 0X7470, 0X8D12, 0X84D1,
-  0XBE76, 0XCEF9, 0XB697, 0X9D11, 0X744D, 0X6C0D, 0X5BCB, 0X7C4F,
-  0X7D30, 0XC719, 0XD75A, 0XB5F5, 0X84D2, 0X6C4F, 0X7CD0, 0X8511,
-  0XAE35, 0XBEB7, 0XB635, 0X84CF, 0X846E, 0X94F0, 0X748F, 0X7CF0,
-  0X9DB2, 0X9572, 0XADF4, 0XAE15, 0XBE36, 0X9D51, 0X9511, 0X846F,
-  0X4286, 0X4308, 0X84D2, 0X84D0, 0XADB5, 0X9D95, 0X7C0F, 0X6B8C,
-  0X740D, 0X7C6F, 0X84D1, 0X84F2, 0X9513, 0X8C71, 0XAD95, 0X9593,
-  0X94D1, 0XA5F3, 0XAE15, 0X9D10, 0XBF19, 0XC6B8, 0XA593, 0X8CF0,
-  0X84AF, 0X6C0D, 0X7CCD, 0XA5D4, 0XA615, 0XA5D3, 0XA5D1, 0XA614,
-  0XAE55, 0XC6D8, 0X8D93, 0X8CD0, 0X7BCC, 0X848F, 0X9510, 0XA5F5,
-  0XA5D4, 0X8D32, 0X7470, 0X7C0D, 0X848F, 0X9D93, 0XBE37, 0XA594,
-  0XAD95, 0XB633, 0XA5F3, 0X9D71, 0X9D73, 0XA5D4, 0XAE35, 0XB615,
-  0X9572, 0X9572, 0X8C90, 0X8D31, 0XA614, 0XAE35, 0XAE55, 0XA615,
-  0X8D31, 0X8CF0, 0X742F, 0X7C6F, 0X8511, 0X9DF4, 0XA6F9, 0XA553,
-  0X7470, 0X6C2D, 0X742D, 0X9614, 0X9D73, 0XA5F4, 0XA615, 0X9DD5,
-  0X9552, 0X9DD4, 0XB657, 0X9552, 0X9DD3, 0X9DB2, 0X9D72, 0X9551,
-  0X746D, 0X740C, 0X742C, 0X84EE, 0X9DD0, 0XA5B2, 0X7D2D, 0X8D8F,
-  0X95D1, 0XB654, 0XAE53, 0X9DF1, 0X9DB2, 0XA5F3, 0X9572, 0X9DB2,
-  0XA5F3, 0XA612, 0XBEB6, 0X8DB0, 0X8D70, 0X8D50, 0X8D70, 0X9570,
-  0X84CD, 0X640A, 0X7CAC, 0X850D, 0X850D, 0X8D4F, 0X9DB0, 0XB673,
-  0XAEB3, 0XA610, 0X952F, 0X84AD, 0X7C6C, 0X8D0F, 0X5326, 0X6BCA,
-  0X7C6D, 0X7CAD, 0X7CEE, 0X848C, 0X7C8C, 0X9D50, 0X7CAC, 0X850D,
-  0X9E11, 0XA612, 0XB634, 0X9590, 0X8D0E, 0X84CE, 0X744C, 0X73EB,
-  0X6B8A, 0X5B69, 0X94D1, 0X8CEF, 0X7C8E, 0X7C8E, 0X748E, 0X6C0B,
-  0X740C, 0X6C2B, 0X7C6C, 0X8CEF, 0XA5B2, 0XB654, 0XAE34, 0X9591,
-  0X84CF, 0X84EF, 0X744C, 0X63CA, 0X7C4D, 0X742C, 0X9590, 0X9DB1,
-  0XA592, 0XAE15, 0XBEB7, 0XB676, 0XB696, 0XAE75, 0XB695, 0XCF38,
-  0XB634, 0XA634, 0XAE15, 0XAE15, 0XB696, 0X952F, 0X73CD, 0X740D,
-  0X8571, 0XA592, 0XC717, 0XBEB7, 0X63CD, 0X6C4E, 0X8D51, 0XA5D4,
-  0XAE34, 0XAE57, 0XAE15, 0X8551, 0X8D52, 0X9553, 0XC6D9, 0XAE36,
-  0X9553, 0X8D12, 0X8D52, 0X9533, 0XA5B5, 0X9DB4, 0X8D93, 0X7C8F,
-  0X8553, 0X8D13, 0X9DB4, 0XB699, 0XC73A, 0XAE14, 0X9572, 0X7C8E,
-  0X638C, 0X6C4E, 0X4226, 0X7C91, 0X8D33, 0X8D13, 0X9532, 0XB590,
-  0XC694, 0XC6B9, 0XC6D9, 0X9D52, 0X8CEF, 0X740D, 0X740D, 0X84AF,
-  0X8D32, 0XBED8, 0XCF5A, 0XAE76, 0X8CD1, 0X7C70, 0X7CF0, 0X9592,
-  0XAE35, 0XBEB7, 0XBE75, 0X8CEF, 0X7C4D, 0X846E, 0X638B, 0X846E,
-  0XADF2, 0X6D0D, 0XB676, 0XA635, 0XBE56, 0XADD4, 0X8D10, 0X8CAF,
-  0X5B4A, 0X4AA8, 0X848F, 0X8CEF, 0X9D72, 0X9D93, 0X84AF, 0X536A,
-  0X6BEC, 0X848E, 0X9D33, 0X9553, 0X8D12, 0X84B2, 0X9533, 0X8D51,
-  0X9DB2, 0XA5D3, 0X9CEC, 0XB5F2, 0XC739, 0XD6F9, 0X9D92, 0X8CF0,
-  0X8510, 0X7C6E, 0X7C8D, 0XADB4, 0XB656, 0X9DD3, 0XADF4, 0XB655,
-  0XB635, 0XB6B6, 0X9DB4, 0X8C8F, 0X842D, 0X844E, 0X9510, 0XA5F5,
-  0XADF4, 0X8D31, 0X748F, 0X7BAD, 0X8CD0, 0X9D93, 0XBE76, 0XB5F5,
-  0XB5F5, 0XBE54, 0XB613, 0XADD3, 0X9D73, 0XB637, 0XAE35, 0XA5B4,
-  0X8D30, 0X9DB3, 0X9531, 0X8D52, 0XAE34, 0XAE55, 0XB676, 0XB655,
-  0X8D11, 0X9531, 0X7C70, 0X6C0E, 0X8511, 0XAE14, 0XA6D9, 0XA5B4,
-  0X744E, 0X6C0D, 0X7C6E, 0X9DD3, 0XAE15, 0X9D93, 0XADF4, 0XA616,
-  0X9551, 0XA5D4, 0XB6B6, 0XA5B4, 0XA5D4, 0XA5B3, 0XA593, 0X9591,
-  0X7C8D, 0X6BEB, 0X742C, 0X8D0F, 0X9DD1, 0X9D91, 0X754D, 0X8D8F,
-  0XA5F3, 0XB654, 0XAE33, 0XA632, 0X9DD2, 0X9DD3, 0X9571, 0X9D91,
-  0XAE13, 0XAE33, 0XBEB5, 0X9E12, 0X95B1, 0X8D70, 0X9570, 0X8D4F,
-  0X84ED, 0X744B, 0X7CCC, 0X8D4E, 0X852D, 0X9D90, 0XADF2, 0XB694,
-  0XB6D5, 0XAE12, 0X952E, 0X748C, 0X84CE, 0X84ED, 0X63A9, 0X6BAA,
-  0X848D, 0X8D6F, 0X8D2F, 0X950F, 0X8CEE, 0XA592, 0X7C6B, 0X850D,
-  0XBE74, 0XAE32, 0XAE33, 0XA5D1, 0X8D4F, 0X94EE, 0X6C0B, 0X6389,
-  0X73CA, 0X6B6A, 0X8C8F, 0X94F0, 0X8CEF, 0X852F, 0X8D10, 0X742B,
-  0X73EB, 0X744B, 0X7C8D, 0X8CCE, 0X9D90, 0XBE35, 0XA653, 0X9590,
-  0X8CCF, 0X84AE, 0X740C, 0X63AA, 0X84AE, 0X7C6C, 0X8D2F, 0XA592,
-  0XADD2, 0XA633, 0XBE97, 0XBEB6, 0XB696, 0XB695, 0XBE96, 0XD739,
-  0XAE13, 0XAE75, 0XADF5, 0XB655, 0XCED9, 0X74EC, 0X742E, 0X6BEC,
-  0X8531, 0XA592, 0XC6F6, 0XBEB6, 0X640D, 0X6C4E, 0X8D92, 0XA593,
-  0XAE14, 0XA655, 0XA5B3, 0X9592, 0X9572, 0X8D93, 0XC6B8, 0XADD5,
-  0X9D52, 0X84D1, 0X8D52, 0X9573, 0XB5F6, 0X9D93, 0X95B4, 0X84F0,
-  0X8512, 0X9533, 0XA5D5, 0XC6D9, 0XD75B, 0XAE55, 0X9D73, 0X8CEF,
-  0X632C, 0X636C, 0X4B4B, 0X63AE, 0X9534, 0X8D33, 0X9D53, 0XB58C,
-  0XCE52, 0XC697, 0XBE96, 0X7CCE, 0X8D4F, 0X6BEA, 0X7C0D, 0X84AF,
-  0X9D32, 0XBE97, 0XCF1A, 0XB655, 0X8D10, 0X84B0, 0X7C4F, 0X9592,
-  0X9E14, 0XBE96, 0XB614, 0X952F, 0X7C6D, 0X740C, 0X638A, 0X7C0C,
-  0XA5D1, 0X8D6F, 0XAE14, 0XB676, 0XBE56, 0XC677, 0X7C8C, 0X9531,
-  0X4266, 0X4AC7, 0X8CD0, 0X8CF0, 0X9D72, 0XAE14, 0X848F, 0X6C2C,
-  0X740C, 0X7C6D, 0X9D93, 0X9D93, 0X8D52, 0X7D51, 0X9572, 0X9571,
-  0XADD4, 0XB5B1, 0XBD22, 0XAE31, 0XCF18, 0XBEB7, 0X9D91, 0X8D10,
-  0X8CF0, 0X7C6E, 0X94B0, 0XADD3, 0XBE97, 0XADF4, 0XADF4, 0XBE36,
-  0XB696, 0XB6B5, 0XAD52, 0X846E, 0X842C, 0X8C6D, 0X9530, 0XADF4,
-  0XADD4, 0X8D11, 0X7C6E, 0X734C, 0X84F0, 0XADD3, 0XB635, 0XB5D4,
-  0XBE36, 0XBE54, 0XBE14, 0XADD3, 0X9DB4, 0XBE97, 0XAE35, 0XA594,
-  0X8550, 0X9D92, 0X9D52, 0X95B3, 0XAE55, 0XB655, 0XBEB8, 0XB635,
-  0X9DB3, 0X8CF0, 0X84B0, 0X744F, 0X744F, 0XB676, 0XAE57, 0X9D72,
-  0X6C2C, 0X7C4E, 0X7C4D, 0X9D72, 0XB636, 0XA5B3, 0XB635, 0XA635,
-  0XA592, 0XA5B4, 0XB6B5, 0XADF4, 0XA5F4, 0XADD3, 0XA5D3, 0X9D71,
-  0X8CCF, 0X6BEC, 0X742C, 0X850E, 0X9DB1, 0XA5D2, 0X8D2F, 0X95B0,
-  0XAE33, 0XBE55, 0XAE53, 0XAE53, 0X9DD1, 0X9DB2, 0X8D10, 0X9D91,
-  0XA612, 0XAE74, 0XB694, 0XA5F2, 0X9DD2, 0X95B0, 0X9D90, 0X8D4E,
-  0X84ED, 0X744B, 0X850D, 0X956E, 0X850B, 0XB653, 0XA5F1, 0XBED4,
-  0XBF36, 0XB6D4, 0X8D4F, 0X852F, 0X852F, 0X7D0D, 0X63E8, 0X6BEA,
-  0X7CAD, 0X9590, 0X950F, 0X9D50, 0X954F, 0XADB2, 0X84CC, 0X954E,
-  0XAE32, 0XAE72, 0XAE33, 0XBE54, 0X9D4F, 0X950F, 0X744C, 0X6BAA,
-  0X6B69, 0X634A, 0X7C2C, 0X8CCF, 0X8D0F, 0X9571, 0X9D32, 0X846D,
-  0X742C, 0X6C0B, 0X7C6D, 0X9D71, 0XA5B2, 0XB655, 0X9E11, 0X8D0F,
-  0X84AE, 0X848E, 0X6BEA, 0X5BAA, 0X7C8D, 0X6C4C, 0XA571, 0XA5B1,
-  0XADF2, 0XB654, 0XBE96, 0XBED6, 0XBEB6, 0XBEB5, 0XC6D7, 0XCF18,
-  0XAE54, 0XAE55, 0XB655, 0XBE76, 0XD6F9, 0X85AF, 0X7CAD, 0X740D,
-  0X748F, 0X9D11, 0XBED6, 0XC6B7, 0X94EF, 0X8CD0, 0X9E96, 0XB5F5,
-  0XAE13, 0XBEF9, 0XA5F4, 0XA5D3, 0XA5F3, 0X95D3, 0XC6D7, 0XA593,
-  0X9D12, 0X8511, 0X9552, 0X9DB4, 0XA5D4, 0XA5B3, 0X9D92, 0X8CEF,
-  0X9D53, 0X9574, 0XA5D4, 0XCED9, 0XC75A, 0XAE12, 0X9D71, 0X6CAF,
-  0X63CC, 0X5B0B, 0X5B8C, 0X6C4F, 0X84D1, 0X8D52, 0X9D93, 0XAD4F,
-  0XCE10, 0XD6B4, 0XC6B5, 0X8CEC, 0X9D51, 0X7CCE, 0X8C8E, 0X8C8E,
-  0XADD4, 0XBE77, 0XCF19, 0XAE55, 0X9531, 0X8CF0, 0X84AF, 0X94B0,
-  0XA592, 0XBEB6, 0XBE55, 0X9D30, 0X848D, 0X742C, 0X6BEB, 0X7B8B,
-  0X9CF0, 0XA572, 0XAE15, 0XB676, 0XBE56, 0XA5B4, 0X748D, 0X94CF,
-  0X6B6A, 0X6B2A, 0X946F, 0X9510, 0XA591, 0XADD2, 0X950F, 0X7C4C,
-  0X7C0C, 0X846D, 0XB574, 0X9D93, 0X84D2, 0X8D52, 0X9551, 0X9D70,
-  0XB613, 0XBDD0, 0XBDC7, 0XC676, 0XCF18, 0XBED6, 0X9D72, 0X94F0,
-  0X9511, 0X846F, 0X94EF, 0XAE13, 0XC696, 0XA5D3, 0XBDF5, 0XBE95,
-  0XBED6, 0XBE35, 0XB635, 0X848C, 0X8C8D, 0X848D, 0X850F, 0XC657,
-  0XADB3, 0X84D0, 0X7C4D, 0X7BCD, 0X84F0, 0XA5D2, 0XB655, 0XBDF5,
-  0XBE55, 0XC675, 0XBE34, 0XB636, 0XAE15, 0XB635, 0XADD4, 0XA532,
-  0X9D51, 0X9D92, 0X9510, 0XA613, 0XB655, 0XAE35, 0XC6B8, 0XB635,
-  0XA5D3, 0X9D10, 0X8CF0, 0X7C4F, 0X746E, 0XBEB7, 0XB656, 0X9D10,
-  0X746D, 0X73ED, 0X844D, 0X9D91, 0XB636, 0XAE36, 0XB635, 0XA5F4,
-  0XA593, 0XADF4, 0XB695, 0XAE35, 0XA5D3, 0XA5D3, 0XA5D2, 0X9D71,
-  0X9530, 0X63AB, 0X744D, 0X84EE, 0X9570, 0XB634, 0XA5F2, 0X8D90,
-  0XBE54, 0XBE74, 0XBE75, 0XBE95, 0XA612, 0X9D91, 0X8D70, 0X9590,
-  0XAE33, 0XB674, 0XBEB5, 0XAE74, 0XA5D2, 0X9DD1, 0X9DB1, 0X958F,
-  0X84AC, 0X7C6B, 0X8D0D, 0X956F, 0X9D8F, 0XAE51, 0XAE52, 0XBEF4,
-  0XBEF5, 0XB6B3, 0X9DD1, 0X8D0F, 0X8D4F, 0X8D50, 0X6C2A, 0X740B,
-  0X744C, 0X9D70, 0XA571, 0X9D70, 0X9D6F, 0X9D8F, 0X8D0A, 0X9D8E,
-  0XAE10, 0XB672, 0XB653, 0XBE34, 0XA591, 0X8D0F, 0X84AE, 0X740C,
-  0X6C0A, 0X6369, 0X73EB, 0X8CCF, 0X950F, 0XA572, 0XA572, 0X7C8D,
-  0X8C8D, 0X742C, 0X846D, 0X9D50, 0XA5D2, 0XB6B5, 0XA5D2, 0X8CCE,
-  0X84AE, 0X7BEC, 0X740B, 0X5B89, 0X84CE, 0X746B, 0X9D50, 0XADF2,
-  0XAE11, 0XB673, 0XB694, 0XC6B7, 0XBEB6, 0XBEB5, 0XC6D6, 0XC6F7,
-  0XB675, 0XB655, 0XAE54, 0XBE56, 0XCEF7, 0X958F, 0X7D0C, 0X7C6D,
-  0X742F, 0X9D72, 0XBEB6, 0XC6F8, 0XB5B2, 0XAD53, 0X9ED5, 0XB615,
-  0XAE13, 0XBE97, 0XAE14, 0XADF3, 0XAE35, 0XBE55, 0XBEB7, 0XA592,
-  0X8CF1, 0X8CF0, 0X9571, 0XA5F4, 0XA5D4, 0XADD4, 0X9D51, 0X8D10,
-  0X8CF1, 0X9D54, 0XA5F5, 0XC697, 0XCF3A, 0XC635, 0X9510, 0X5C8E,
-  0X6C0C, 0X5AEA, 0X5B6C, 0X6C2F, 0X7C8E, 0X9533, 0XA5D4, 0XB5B5,
-  0XB612, 0XD692, 0XBDC7, 0X8D0C, 0XADD3, 0X94B0, 0X8CAE, 0X94EF,
-  0XA5F3, 0XBE75, 0XCEB7, 0XAE35, 0X9DB3, 0X8CF0, 0X9510, 0X8C8E,
-  0XAD92, 0XCEB7, 0XC695, 0X9D0F, 0X84AD, 0X84AE, 0X7369, 0X7C0A,
-  0XA4EF, 0X9D30, 0XAE35, 0XC698, 0XBE56, 0XADD5, 0X846E, 0X7C2D,
-  0X7BCC, 0X6B8B, 0X94B0, 0XA551, 0XADD2, 0XADD2, 0X9D11, 0X7C0D,
-  0X73ED, 0X8CAF, 0X9DD2, 0XADD5, 0X9531, 0X8D51, 0X9551, 0X9D51,
-  0XB5F3, 0XCE33, 0XC632, 0XC6B6, 0XCF18, 0XC6D7, 0X9D12, 0XA511,
-  0X9CD0, 0X8CCE, 0XA530, 0XB632, 0XC696, 0XB635, 0XBE54, 0XCED6,
-  0XCED7, 0XBE75, 0XBEB5, 0X838C, 0X8CAE, 0X7C6D, 0X94F0, 0XBE15,
-  0XA5D2, 0X94F0, 0X844E, 0X7C4E, 0X844E, 0XA5F3, 0XB654, 0XC615,
-  0XBE75, 0XBE74, 0XBE55, 0XBE78, 0XAE14, 0XB634, 0XB5D4, 0XB594,
-  0X9D51, 0XADD4, 0XAD72, 0XA5F3, 0XBE55, 0XADF4, 0XB655, 0XB635,
-  0XADF3, 0XAD31, 0X9511, 0X848F, 0X6C2C, 0XBE96, 0XC6B8, 0X9510,
-  0X94CF, 0X73AC, 0X8C6D, 0X9D70, 0XBE36, 0XC6B7, 0XB655, 0XAE15,
-  0X9DB3, 0XB5B4, 0XAE55, 0XAE55, 0XB615, 0XADF3, 0XA592, 0X9590,
-  0X8CEF, 0X740C, 0X7C4D, 0X84EE, 0X9D90, 0XB5D3, 0XAE13, 0XADF2,
-  0XC676, 0XC6B6, 0XC6B6, 0XBE75, 0XB613, 0X9DB1, 0X954F, 0X9DB1,
-  0XAE33, 0XB694, 0XBEB5, 0XB694, 0XAE12, 0XB613, 0X9DB0, 0X8D4F,
-  0X8D2D, 0X8D0D, 0X8D4D, 0X9D8F, 0X9DD0, 0XA5D1, 0XB693, 0XBED4,
-  0XC6F4, 0XB6B3, 0XA632, 0X950E, 0X950E, 0X9D90, 0X744A, 0X7C6B,
-  0X8CCE, 0X9D0F, 0XA550, 0X9DB0, 0X956F, 0XA5D1, 0XA58F, 0XADD1,
-  0XBE34, 0XCE96, 0XC674, 0XB653, 0XA5D1, 0X8D2F, 0X8CCE, 0X7C2C,
-  0X846D, 0X73CB, 0X5AC8, 0X9CCF, 0X9530, 0XA5B2, 0X9D51, 0X8C8E,
-  0X7C6C, 0X742B, 0X84AE, 0XA5D2, 0XAE13, 0XBE74, 0XADD2, 0X8D0F,
-  0X84AE, 0X7C0C, 0X740B, 0X63CA, 0X848D, 0X8CCE, 0XA5D1, 0X9DD0,
-  0XAE11, 0XAE72, 0XAE72, 0XBE95, 0XCEF8, 0XBE95, 0XCF17, 0XC6D7,
-  0XAE74, 0XAE54, 0XAE33, 0XBE36, 0XBED5, 0XA590, 0X8D0C, 0X7C6D,
-  0X742E, 0XA571, 0XBE97, 0XCF7B, 0XB552, 0XB615, 0XA6F6, 0XB615,
-  0XB5F3, 0XBE96, 0XB654, 0XA5F2, 0XB654, 0XB635, 0XB675, 0XA551,
-  0X7CAF, 0X84F0, 0X9573, 0XA635, 0X9DB4, 0XA5B4, 0X9DB3, 0X9DB3,
-  0X9D72, 0X84F1, 0XA5D4, 0XC697, 0XD73A, 0XB5B4, 0X9D10, 0X748D,
-  0X63CB, 0X5287, 0X634A, 0X6C0E, 0X64B0, 0X7C70, 0XB656, 0XADB4,
-  0XBE34, 0XCE53, 0XBD89, 0XAD2D, 0XBEB5, 0X9CF0, 0X94F0, 0X9D51,
-  0XB614, 0XBE95, 0XBE55, 0XA5B3, 0X9552, 0X9D52, 0XA531, 0X840C,
-  0X9DD1, 0XC696, 0XC675, 0X9CEF, 0X8C8E, 0X7CAD, 0X6BAA, 0X73EA,
-  0X94EE, 0X9CEE, 0XAE35, 0XC6D9, 0XC635, 0XC637, 0XA510, 0X8C2D,
-  0X944E, 0X83EC, 0X94D0, 0XA552, 0XAE13, 0XA5D1, 0X9550, 0X8C4D,
-  0X7BCC, 0X846D, 0X9D92, 0XAE16, 0X8D10, 0X9551, 0X9531, 0X9D31,
-  0XBE34, 0XC675, 0XC694, 0XD6F8, 0XD6F8, 0XCED7, 0XA591, 0X9D30,
-  0X9CEF, 0X9CCF, 0X94EF, 0XADB1, 0XC676, 0XBE75, 0XB6B3, 0XCEF7,
-  0XCEF7, 0XBE95, 0XB634, 0X94AE, 0X8CAE, 0X7C2E, 0X8CEF, 0XB5F3,
-  0XADF3, 0X94F0, 0X8C4E, 0X846E, 0X9510, 0XADF3, 0XC695, 0XC677,
-  0XC6B6, 0XBE76, 0XBE34, 0XBE36, 0XB5F4, 0XB5F4, 0XB5F4, 0XB5B3,
-  0XA592, 0XADB3, 0XADD3, 0XAE13, 0XB614, 0XA592, 0XB614, 0XBE35,
-  0XADF3, 0XB5B3, 0X9DB3, 0X7CAF, 0X852F, 0XDEF9, 0XC6B7, 0X742C,
-  0X94CF, 0X6C4D, 0X8CAE, 0X9D90, 0XC697, 0XCED8, 0XAE75, 0XAE14,
-  0XADD3, 0XB5B3, 0XB615, 0XB675, 0XB615, 0XAE14, 0XA5B1, 0X9570,
-  0X9530, 0X740C, 0X7BEC, 0X84CE, 0X9D90, 0XADF3, 0XB613, 0XADD2,
-  0XCEB7, 0XC696, 0XCEF7, 0XC696, 0XB614, 0XADB2, 0X9570, 0XA5F2,
-  0XA5D1, 0XB674, 0XBEB5, 0XBE95, 0XBE94, 0XB654, 0X9DD1, 0X956F,
-  0XA5B0, 0X8D2D, 0X9DCF, 0X9D8F, 0X9DF0, 0XB633, 0XB673, 0XC6D4,
-  0XBED4, 0XBEB4, 0XAE32, 0XA590, 0XA58F, 0X9D6F, 0X7C6B, 0X848C,
-  0X8CCD, 0X950E, 0XA590, 0X95B0, 0X8D8F, 0XDF5B, 0X9DB0, 0XAE12,
-  0XBE74, 0XBE93, 0XBE73, 0XB633, 0XB5F3, 0XA530, 0X84CD, 0X7C2C,
-  0X8D0E, 0X7BEC, 0X736B, 0X952F, 0X9570, 0XA591, 0X9D70, 0X848D,
-  0X848D, 0X848D, 0X8CEE, 0XA5F3, 0XCEB7, 0XBE34, 0XADF2, 0X9D50,
-  0X84AE, 0X844D, 0X744B, 0X744B, 0X848D, 0X8CED, 0XA5B0, 0XA5D1,
-  0XB653, 0XBE93, 0XBE52, 0XBEB5, 0XC6D6, 0XBEB6, 0XC6F6, 0XC6D6,
-  0XB674, 0XAE34, 0XBE75, 0XBE56, 0XB6B5, 0X9D70, 0X8CCB, 0X8CCF,
-  0X7C2E, 0X9D51, 0XCE97, 0XCF5A, 0XD697, 0XBE97, 0XBF38, 0XB5D4,
-  0XBE14, 0XBE95, 0XBEB5, 0XBE15, 0XBE75, 0XBE55, 0XB634, 0XA550,
-  0X84CF, 0X7CAE, 0XA5B5, 0XAE55, 0X9DD3, 0XADD4, 0X9DD3, 0X95F4,
-  0X9572, 0X8CD1, 0XA5B3, 0XC676, 0XD73A, 0XBE56, 0XA531, 0X8C8E,
-  0X6B4A, 0X4A89, 0X6B4B, 0X6BCD, 0X7D32, 0X7CB1, 0XB615, 0X9E14,
-  0XBE97, 0XC6B6, 0XC696, 0XBDF3, 0XBE77, 0XADD2, 0X94CF, 0XAD92,
-  0XBE33, 0XC695, 0XB5F3, 0XA552, 0X84D0, 0X9D51, 0X9D51, 0XB531,
-  0X9570, 0XC6D6, 0XC674, 0X8CAD, 0X840C, 0X7C0D, 0X7BEC, 0X63A9,
-  0X950F, 0X8CCD, 0XA5B3, 0XCE77, 0XC636, 0XBE16, 0XB552, 0X8BEC,
-  0XA4B0, 0X8C6E, 0XA4F0, 0XAE14, 0XB674, 0X9D6F, 0XA552, 0X846E,
-  0X7BED, 0X844D, 0X9531, 0XADD5, 0X9511, 0X9531, 0X9551, 0X9D91,
-  0XB632, 0XC6B6, 0XD6B7, 0XD6F7, 0XD718, 0XCE76, 0XA5B2, 0XA550,
-  0X9D0F, 0X9CEE, 0X9D0E, 0XB590, 0XB654, 0XB694, 0XCED7, 0XD718,
-  0XCEF7, 0XC6B6, 0XBE13, 0X9D50, 0X8C8E, 0X842D, 0X9D0F, 0XADF1,
-  0XB5F3, 0X9CAF, 0X944D, 0X8D10, 0X9D72, 0XADD3, 0XC636, 0XCE77,
-  0XCEB7, 0XBE76, 0XBE55, 0XB634, 0XB5F4, 0XAD72, 0XB5F3, 0XBE55,
-  0XAD93, 0XB5B3, 0XBE14, 0XB613, 0XADD2, 0XA531, 0XADB3, 0XB614,
-  0XB613, 0XB615, 0XA634, 0X84AF, 0X8D71, 0XDF18, 0XBE57, 0X84CE,
-  0X84AF, 0X7C6D, 0X8CEF, 0XA5F2, 0XC696, 0XD6F9, 0XBE76, 0XB635,
-  0XADD3, 0XBE14, 0XBDB5, 0XBED6, 0XB635, 0XB615, 0XA5B2, 0X954F,
-  0X84CE, 0X7C2C, 0X7C2C, 0X84AE, 0X9D70, 0XAE54, 0XB613, 0XB5F3,
-  0XCEB7, 0XD6D8, 0XCED7, 0XBEB5, 0XB634, 0XADD2, 0XA591, 0X9DB1,
-  0XA5F1, 0XB653, 0XBE94, 0XAE53, 0XCEB6, 0XBE74, 0XA5F1, 0X9590,
-  0XADD1, 0X8D2D, 0X9DAF, 0XA5D0, 0X9DCF, 0XC695, 0XB652, 0XC6F5,
-  0XBED4, 0XBE93, 0XB632, 0XADD1, 0XA5B0, 0X954E, 0X8CEC, 0X848C,
-  0X952E, 0X9DB0, 0XA5F1, 0XA5F1, 0X9DD0, 0XCE76, 0X9DB0, 0XAE11,
-  0XC6B5, 0XC695, 0XC675, 0XBDF3, 0XADF2, 0X9D0F, 0X950F, 0X7C6C,
-  0X7C4C, 0X7C2C, 0X7C2C, 0X8D0F, 0X9D71, 0XA5B2, 0X9570, 0X94EE,
-  0X8CCE, 0X8CED, 0X8D0F, 0XC6B6, 0XB634, 0XB613, 0XB633, 0XA5B1,
-  0X94EE, 0X7C4C, 0X744C, 0X7C4C, 0X8C8D, 0X9D6F, 0XA5B0, 0XADF2,
-  0XB613, 0XBE94, 0XBE72, 0XBEB4, 0XCED7, 0XC6F6, 0XC6F7, 0XC6D6,
-  0XBE74, 0XB634, 0XC655, 0XC6D7, 0XBEB6, 0XAE32, 0X9D2E, 0X7C4E,
-  0X8CD0, 0XA572, 0XCE97, 0XDF9B, 0XC695, 0XBE35, 0XBF39, 0XADF3,
-  0XBDF4, 0XBE95, 0XBEB5, 0XC696, 0XBE74, 0XB634, 0XADF2, 0X9D2F,
-  0X8CF0, 0X84CF, 0X9D93, 0XAE35, 0XADF4, 0X9DF3, 0XA614, 0X9D94,
-  0X9D32, 0X8CAF, 0XA5B3, 0XC656, 0XCF18, 0XC6B7, 0XB591, 0X944F,
-  0X4B08, 0X632A, 0X6B4B, 0X6B6D, 0X84F0, 0X7D12, 0XAD94, 0XB635,
-  0XC6B8, 0XBE96, 0XC6B6, 0XB633, 0XB615, 0XA5F2, 0X9D50, 0XAD72,
-  0XBE14, 0XBE74, 0XADD1, 0X9D10, 0X8C8F, 0X9D31, 0XA531, 0XA4F0,
-  0X9CED, 0XCED5, 0XC674, 0X9C8D, 0X83EB, 0X7C6C, 0X73EA, 0X6389,
-  0X8C2B, 0XA4EE, 0XAD92, 0XCE36, 0XC615, 0XB5D4, 0XAD72, 0X73AB,
-  0X9D10, 0X8CAE, 0XA5B2, 0XB614, 0XC655, 0XB5B2, 0XA531, 0X746E,
-  0X84B0, 0X8C8F, 0XA5B2, 0X9592, 0X9510, 0X8CF0, 0X9550, 0X9D8F,
-  0XBDF1, 0XD6D8, 0XD6D7, 0XD6D7, 0XCED7, 0XCE76, 0XC5D2, 0XAD90,
-  0X950E, 0X94AD, 0X94AC, 0XAD4F, 0XB652, 0XBE93, 0XCEB6, 0XCF17,
-  0XD6F7, 0XC695, 0XB5F2, 0X9D4F, 0X9CF0, 0X8C8D, 0XAD2F, 0XADD1,
-  0XA571, 0XAD31, 0X946E, 0X9510, 0XA592, 0XB5D4, 0XC656, 0XCE97,
-  0XD6D8, 0XC697, 0XBE55, 0XB613, 0XB5F4, 0XAD92, 0XADB2, 0XB614,
-  0XAD93, 0XB5B3, 0XB674, 0XB613, 0XADB2, 0X9D11, 0X9571, 0X9D92,
-  0XBDF2, 0XC677, 0XA676, 0XA512, 0XB654, 0XCF17, 0XCE98, 0X7CEF,
-  0X7C4D, 0X7C8D, 0X8CEF, 0XA5D1, 0XCEB7, 0XCEF8, 0XC676, 0XBE55,
-  0XBDD4, 0XBE35, 0XC635, 0XBE54, 0XBE55, 0XB615, 0XADB2, 0X952F,
-  0X8CCD, 0X84AE, 0X844C, 0X8CAD, 0XA590, 0XB5F2, 0XB633, 0XBE74,
-  0XCF17, 0XD6D7, 0XCEF7, 0XC695, 0XAE53, 0XA5D2, 0XA571, 0X9D70,
-  0XA5D1, 0XAE33, 0XBE94, 0XBEB5, 0XCEF7, 0XBE74, 0XB653, 0X9DB0,
-  0X9D90, 0X8D2D, 0X956E, 0X9DAF, 0XADF0, 0XB652, 0XB671, 0XBED3,
-  0XC6F5, 0XBEB3, 0XB672, 0XADF0, 0XADD0, 0X954D, 0X8CEC, 0X8CAC,
-  0X952E, 0XB612, 0XADD0, 0XB612, 0XADD1, 0XB633, 0XA5D0, 0XB652,
-  0XC6D5, 0XC6B5, 0XC694, 0XBE53, 0XADF1, 0XA591, 0X952F, 0X8CCE,
-  0X94EE, 0X846D, 0X8C6D, 0X9510, 0XA591, 0XBDF4, 0XAD91, 0X94AE,
-  0X8CCD, 0X8D2F, 0X9551, 0XBEB5, 0XBE95, 0XB673, 0XBE73, 0XADF1,
-  0X952E, 0X84AD, 0X7C4B, 0X848C, 0X848C, 0X9D8F, 0XA590, 0XB5F2,
-  0XB633, 0XCEB6, 0XBEB3, 0XC6D6, 0XCEF7, 0XCF17, 0XCEF7, 0XCEF6,
-  0XBE74, 0XB633, 0XBE34, 0XBED6, 0XB6B6, 0XAE52, 0X9D2E, 0X7C4D,
-  0X8CEF, 0XA571, 0XD6D8, 0XD759, 0XC675, 0XB614, 0XB654, 0XADD3,
-  0XB614, 0XBE74, 0XC6B7, 0XCE97, 0XBE74, 0XB614, 0XA570, 0X94EE,
-  0X842E, 0X84AF, 0X95B3, 0XAE15, 0XB614, 0XA634, 0XA5F3, 0X95B3,
-  0X9CD1, 0X94CF, 0XADF3, 0XBE15, 0XCE97, 0XC716, 0XBD8F, 0X93CE,
-  0X6B09, 0X6B29, 0X6B6B, 0X6BAC, 0X9510, 0X7CB0, 0X9DD3, 0XC656,
-  0XC697, 0XC696, 0XB695, 0XB633, 0XB614, 0XBE56, 0XADD2, 0XB5B3,
-  0XBE14, 0XBE54, 0XA5B0, 0X9D50, 0X9D10, 0X9D10, 0XA552, 0XA510,
-  0XA550, 0XCEB6, 0XBE53, 0XA54F, 0X742A, 0X73EB, 0X73A9, 0X4B26,
-  0X848D, 0X950E, 0X9D4F, 0XC5F4, 0XC614, 0XB5B3, 0XAD72, 0X8C6E,
-  0X9CCF, 0X9D10, 0XADD4, 0XB634, 0XC676, 0XBDF4, 0XA551, 0X8CCF,
-  0X8CAF, 0X94AE, 0X9551, 0X8DB2, 0X9531, 0X94EF, 0XA510, 0XAD31,
-  0XD654, 0XD6B7, 0XDF19, 0XD6F8, 0XCEB6, 0XCE75, 0XC612, 0XADB0,
-  0X8CCC, 0X8C8C, 0X8C8C, 0X9D2D, 0XB631, 0XC694, 0XD6F7, 0XD717,
-  0XD737, 0XCE95, 0XBE34, 0X9D2E, 0X9CEE, 0XA4CE, 0XA54F, 0XAD90,
-  0XAD92, 0XA4F0, 0X94AE, 0XA510, 0XA592, 0XC5F4, 0XCE77, 0XCEB7,
-  0XCEB7, 0XBE56, 0XB613, 0XB5F4, 0XB5F4, 0X9D30, 0X9551, 0XB5B3,
-  0XB5D1, 0XBE15, 0XB674, 0XB613, 0XA572, 0X9D10, 0X9D50, 0XADB1,
-  0XC613, 0XC697, 0XC6F8, 0XB5D4, 0XCED7, 0XD737, 0XC676, 0X84CE,
-  0X7C6D, 0X7C8E, 0X84AD, 0XB5F3, 0XCED8, 0XCED7, 0XC696, 0XBE14,
-  0XB5F4, 0XBE34, 0XCED7, 0XB592, 0XBE55, 0XBE55, 0XAD91, 0X9D2F,
-  0X8CAD, 0X846C, 0X846C, 0X8CCD, 0XA5B0, 0XB5F2, 0XB633, 0XC694,
-  0XCF17, 0XCF17, 0XCEF7, 0XB632, 0XB633, 0X9DD1, 0X9D90, 0X952F,
-  0XA5B1, 0XBE33, 0XBEB5, 0XC6D6, 0XC6D5, 0XBE73, 0XB652, 0XA5F1,
-  0XA5D0, 0X956F, 0X958D, 0X9DAE, 0XB632, 0XAE31, 0XB672, 0XBED3,
-  0XC6F4, 0XC6D4, 0XC694, 0XB611, 0XADF0, 0XA56E, 0X9D2D, 0X950D,
-  0X9D4E, 0XA58F, 0XB5F1, 0XCED6, 0XB611, 0XB5F2, 0XAD8F, 0XC674,
-  0XC6F5, 0XCED6, 0XC6B5, 0XC6D5, 0XB633, 0XADF2, 0XA590, 0X8CEE,
-  0X8CAE, 0X8C6D, 0X9D0F, 0X9D30, 0XA550, 0XADB2, 0XB5D2, 0X950E,
-  0X8D0F, 0X8D4F, 0XA591, 0XBED6, 0XCEF6, 0XC6B4, 0XB653, 0XA5D0,
-  0X8D2D, 0X848C, 0X7C2B, 0X8CAD, 0X950D, 0X9D8F, 0XA570, 0XADB1,
-  0XBE73, 0XCEB6, 0XBE93, 0XCED6, 0XCF17, 0XD717, 0XCEF6, 0XCEF6,
-  0XBE94, 0XB654, 0XBE14, 0XB6D5, 0XC675, 0XA630, 0X94AD, 0X848E,
-  0X84AF, 0X9510, 0XD738, 0XCF17, 0XBE54, 0XAE13, 0XB5F3, 0XADF3,
-  0XB655, 0XC695, 0XC6B6, 0XC696, 0XC654, 0XB613, 0XA52F, 0X94EE,
-  0X63AB, 0X84F1, 0XA613, 0XC635, 0XA5D2, 0XAE14, 0XBDF4, 0X9D31,
-  0X94D0, 0X9C8F, 0XB593, 0XC676, 0XC676, 0XC693, 0XC5AF, 0X946C,
-  0X732A, 0X5B09, 0X5AE8, 0X73ED, 0X94EF, 0X94B0, 0X9571, 0XAE13,
-  0XCE77, 0XD6B7, 0XB6B5, 0XB694, 0XBDD3, 0XB614, 0XB593, 0XADD3,
-  0XB5D3, 0XBE33, 0XA530, 0X9D51, 0X9D2F, 0X94ED, 0X950F, 0XAD91,
-  0XA54E, 0XD695, 0XCE54, 0X9D2F, 0X7C6B, 0X740B, 0X73AA, 0X4B27,
-  0X746D, 0X7CAD, 0X954E, 0XC695, 0XB614, 0X9571, 0X9D71, 0X94CF,
-  0X9CCF, 0XA571, 0XC695, 0XB654, 0XBE54, 0XBE14, 0XAD72, 0XA530,
-  0XAD30, 0X9510, 0X9D52, 0XA5B2, 0X9CAF, 0X9C8F, 0X9CCF, 0XA570,
-  0XCE95, 0XD6F9, 0XD6F9, 0XD6D8, 0XD6B6, 0XCE54, 0XD695, 0XBDD1,
-  0X94AC, 0X7C0A, 0X7C2A, 0X952C, 0XADB0, 0XC672, 0XD737, 0XD717,
-  0XDF17, 0XD6B6, 0XBDF2, 0X9D4F, 0XAD0E, 0XA4EE, 0XA58F, 0XB5B1,
-  0XAD92, 0XA4F0, 0X9CEF, 0XA531, 0XB5B3, 0XC5F5, 0XD698, 0XCEB6,
-  0XCEB7, 0XC697, 0XB614, 0XB5F3, 0XADF3, 0X9D50, 0X9551, 0XAD72,
-  0XB5D2, 0XBE54, 0XBE75, 0XBE13, 0XA571, 0X9D2F, 0X952E, 0XAD90,
-  0XBDF2, 0XCE97, 0XCF18, 0XC676, 0XD719, 0XDF59, 0XC676, 0X8D0F,
-  0X848D, 0X848E, 0X8CCE, 0XC613, 0XCE96, 0XCEF7, 0XCE96, 0XC615,
-  0XBE14, 0XBE14, 0XC655, 0XC655, 0XBE75, 0XBE74, 0XA570, 0X9D4F,
-  0X8CED, 0X848C, 0X846C, 0X8CCD, 0X9D6F, 0XB5F1, 0XBE33, 0XBEB4,
-  0XD718, 0XD758, 0XCED6, 0XB653, 0XAE12, 0X9D8F, 0X956F, 0X954F,
-  0XA5B0, 0XB632, 0XBEB4, 0XC6D5, 0XB693, 0XBE93, 0XB672, 0XA5F0,
-  0XB632, 0X958F, 0X958D, 0X9DCE, 0XAE31, 0XAE30, 0XBE93, 0XC6D5,
-  0XC6F4, 0XC6D4, 0XBE93, 0XA5AF, 0XB5F0, 0XADD0, 0XA54E, 0X9D0D,
-  0XA56F, 0XA56E, 0XADD0, 0XB611, 0XB5F1, 0XCE75, 0XADF0, 0XBE94,
-  0XCEF6, 0XCEF7, 0XCEF6, 0XCEF7, 0XBE54, 0XB5F2, 0XA591, 0X950E,
-  0X8C4C, 0XA550, 0XA530, 0X9CF0, 0XAD51, 0XAD91, 0XADB1, 0X954F,
-  0X9570, 0XA550, 0XADD2, 0XC695, 0XCF17, 0XD6D7, 0XB672, 0XA610,
-  0X9D4E, 0X8CCD, 0X848C, 0X84EC, 0X9D6E, 0XA570, 0XADB0, 0XBE12,
-  0XBE94, 0XC694, 0XCED5, 0XD6F6, 0XCEF6, 0XDF17, 0XCEF6, 0XCEF6,
-  0XC6B6, 0XBE74, 0XBE34, 0XB653, 0XCE34, 0XADEF, 0X948E, 0X846E,
-  0X7C6E, 0X9551, 0XD738, 0XCED6, 0XBE54, 0XADF2, 0XB5F2, 0XADB2,
-  0XB635, 0XBE75, 0XC675, 0XBE54, 0XBE33, 0XB5B1, 0X9D2F, 0X8CCE,
-  0X844D, 0X9551, 0XADB3, 0XBDF4, 0XA590, 0XADF3, 0XADB3, 0X9C90,
-  0X94CF, 0X9C6F, 0XB572, 0XBE55, 0XBE33, 0XC632, 0XC5CF, 0XA4EA,
-  0X83CB, 0X634A, 0X6329, 0X7BCC, 0X84F0, 0X948E, 0X950F, 0XA5D2,
-  0XCE77, 0XD6D8, 0XBE95, 0XBEB5, 0XBDF3, 0XB5B2, 0XAD91, 0XADB3,
-  0XB5B2, 0XBE33, 0X950F, 0X9CCF, 0XAD72, 0X950E, 0X8CCD, 0XA5D0,
-  0XAD30, 0XC633, 0XCE53, 0XAD4E, 0X948C, 0X8C2B, 0X7389, 0X5B08,
-  0X7BCC, 0X9CAF, 0XA570, 0XB632, 0XC6D7, 0XA5B3, 0XB572, 0X63EB,
-  0X9CEF, 0XA571, 0XB613, 0XBE34, 0XBE13, 0XBE34, 0XADB1, 0XA5D2,
-  0X9D91, 0XA551, 0XA571, 0XADD3, 0X9D50, 0X842B, 0X9CEE, 0XC5B3,
-  0XD697, 0XD6F9, 0XD6D9, 0XD6D7, 0XCEB5, 0XCE53, 0XCE54, 0XBDB1,
-  0X9D0D, 0X7C0A, 0X7C09, 0X94CC, 0XAD6E, 0XBE72, 0XD6F6, 0XD717,
-  0XDF37, 0XD694, 0XBDB0, 0XAD0F, 0XB590, 0XAD4D, 0XBDAF, 0XBD92,
-  0XAD30, 0X9CCF, 0X9CF0, 0XAD71, 0XBDD3, 0XC615, 0XCEB7, 0XCEB6,
-  0XCED7, 0XCEB6, 0XBE33, 0XB5F2, 0XA5B2, 0XA571, 0X9D50, 0XAD91,
-  0XB5F4, 0XBE34, 0XBE74, 0XBE13, 0XAD91, 0X9D0E, 0X94EF, 0XB591,
-  0XB5F2, 0XC654, 0XCEF7, 0XD6F8, 0XDF5B, 0XDF7A, 0XCED8, 0XA550,
-  0X8C2C, 0X8C8E, 0X94EF, 0XBE54, 0XD6D8, 0XCED7, 0XCE96, 0XC655,
-  0XBE14, 0XC655, 0XC696, 0XBE35, 0XC675, 0XC694, 0XADD0, 0X9D4E,
-  0X9D2E, 0X846C, 0X846C, 0X8CCD, 0X9D4F, 0XADF1, 0XBE32, 0XC6B5,
-  0XCF37, 0XCF37, 0XCEF6, 0XBE73, 0XA611, 0X9D8F, 0X954E, 0X952E,
-  0XA58F, 0XB632, 0XC6B4, 0XC6D4, 0XC6F5, 0XBE93, 0XB651, 0XAE11,
-  0XB611, 0XADD0, 0X9DAE, 0X9DCF, 0XAE11, 0XB672, 0XBE93, 0XC6B4,
-  0XCEF5, 0XC6D4, 0XBE93, 0XAE51, 0XB651, 0XAE11, 0X9DAF, 0XA5AF,
-  0XA58F, 0XADF0, 0XADF0, 0XB611, 0XB612, 0XC634, 0XB611, 0XC674,
-  0XCEF6, 0XCEF6, 0XD717, 0XCEF6, 0XC695, 0XB5F2, 0XADB1, 0XA52F,
-  0X94ED, 0XA54F, 0XAD31, 0XA4F0, 0XA531, 0XB5B2, 0XADB1, 0X950F,
-  0XA550, 0XAD91, 0XB5D2, 0XC6B5, 0XD6F8, 0XCEF6, 0XC674, 0XB632,
-  0X9D6E, 0X94EE, 0X94ED, 0X9D4E, 0XA56F, 0XA590, 0XADB0, 0XBE12,
-  0XC694, 0XCEB6, 0XCED6, 0XD6D6, 0XD6F7, 0XD6F6, 0XCED5, 0XC6D4,
-  0XCED7, 0XCEB5, 0XC654, 0XBE12, 0XB5B2, 0X9D8E, 0X94EF, 0X846E,
-  0X8CAF, 0XA592, 0XD737, 0XCEB6, 0XB634, 0XADD1, 0XB5D2, 0X9D30,
-  0XBE77, 0XC676, 0XC655, 0XC614, 0XB5F2, 0XB570, 0XA52F, 0X8CED,
-  0X8C6E, 0X9510, 0XADD4, 0XB5D3, 0XADB1, 0XB5F3, 0XA572, 0X94AF,
-  0X94CF, 0XA511, 0XB592, 0XC654, 0XC652, 0XBE32, 0XC611, 0XB58E,
-  0X946C, 0X7B6C, 0X5B29, 0X83AB, 0X8C8E, 0X9CEF, 0XA4CE, 0XADD0,
-  0XBE55, 0XCED8, 0XCED7, 0XC695, 0XBE14, 0XB571, 0XA570, 0XA570,
-  0XB5F2, 0XC675, 0X7BCA, 0X8CEE, 0XAD51, 0X9CCE, 0X8CAD, 0XB5B1,
-  0XA56F, 0XBE33, 0XC612, 0XA52E, 0X948C, 0X8C4A, 0X6B69, 0X62E9,
-  0X7B8A, 0X946E, 0XAD10, 0XB5F2, 0XCED6, 0XBE14, 0XB551, 0X83CE,
-  0X83EC, 0XA570, 0XBE53, 0XBE13, 0XBE12, 0XB613, 0XB5F2, 0XADD2,
-  0XAD91, 0XAD6F, 0XC5D2, 0XBDB2, 0X9CCF, 0X942D, 0X9CAE, 0XC613,
-  0XCEF7, 0XCF18, 0XD6F8, 0XCEB6, 0XCE74, 0XCE13, 0XC632, 0XCE12,
-  0XA58F, 0X846C, 0X8C8B, 0X9CCD, 0X9D2E, 0XC693, 0XD6F6, 0XD6D5,
-  0XDF17, 0XC671, 0XAD90, 0XB54F, 0XC5F1, 0XAD8E, 0XC58F, 0XAD0F,
-  0XAD0F, 0X9CEF, 0XAD30, 0XADB1, 0XBD91, 0XCE95, 0XD719, 0XD6D7,
-  0XD6F7, 0XCEB5, 0XBE54, 0XADD0, 0XADD2, 0XA550, 0X8C8D, 0XA591,
-  0XB5D3, 0XBE54, 0XBE55, 0XBDF3, 0XA570, 0X9CEE, 0X950E, 0XBD91,
-  0XA590, 0XCE96, 0XCEB7, 0XD6B7, 0XDF39, 0XDF79, 0XDF19, 0XA551,
-  0X9C6D, 0X7BEB, 0XAD51, 0XBE95, 0XCEB7, 0XD6D8, 0XD6B7, 0XC634,
-  0XC614, 0XCE75, 0XCEB7, 0XCEB7, 0XCEB6, 0XCE95, 0XADF0, 0XAD6F,
-  0X9D2E, 0X8CED, 0X844C, 0X8CCD, 0X9D6F, 0XADB1, 0XC654, 0XCED5,
-  0XD717, 0XCF17, 0XC6F5, 0XBE93, 0XAE11, 0X9DAF, 0X9D4E, 0X8C8C,
-  0X956E, 0XAE31, 0XBE93, 0XC6D5, 0XCED5, 0XBE93, 0XB651, 0XAE10,
-  0XB5F0, 0XADD0, 0X9DAE, 0X9DAE, 0XA5EF, 0XAE30, 0XBE72, 0XBEB2,
-  0XCEF5, 0XC6D3, 0XBEB2, 0XB670, 0XA60E, 0XBE51, 0XADF0, 0XB5F0,
-  0XADAF, 0XB611, 0XAD90, 0XC633, 0XBE12, 0XBE12, 0XBE12, 0XC673,
-  0XC6F5, 0XD737, 0XD737, 0XCEF6, 0XC694, 0XB571, 0XBDF2, 0XA54F,
-  0X9D2E, 0XA590, 0XBDB3, 0XADD2, 0XADB2, 0XBDD2, 0XB5B1, 0XA570,
-  0XAD70, 0X9D4F, 0XB633, 0XCEF6, 0XDF39, 0XD718, 0XCEB5, 0XBE53,
-  0XB5B1, 0XA52F, 0X94ED, 0XA56F, 0X9D8F, 0XA58F, 0XA56F, 0XBE32,
-  0XC674, 0XD695, 0XD6D5, 0XD6D6, 0XD6D6, 0XCED5, 0XCED5, 0XCED5,
-  0XCEB5, 0XCEB5, 0XCE75, 0XBDB2, 0XB551, 0XA5D0, 0X94AE, 0X844E,
-  0X94F0, 0XA5B2, 0XCEF6, 0XCEB6, 0XB634, 0XB5D1, 0XB5B1, 0XB5B2,
-  0XBE34, 0XBE75, 0XC655, 0XBDD2, 0XB5B1, 0XB590, 0XA52E, 0X8CED,
-  0X9C6F, 0XA551, 0XB5B3, 0XB5D3, 0XB5D2, 0XB5D3, 0X9D31, 0X94CE,
-  0X8CCF, 0XA530, 0XBD71, 0XC655, 0XBE73, 0XB653, 0XCE73, 0XC5CF,
-  0X9CAB, 0X7B4A, 0X52C8, 0X4B29, 0X83EC, 0XA4EF, 0XACCF, 0XB611,
-  0XBE33, 0XC6D6, 0XCE96, 0XC655, 0XB5F2, 0XB551, 0X9D50, 0XA550,
-  0XBDF2, 0XBE33, 0X8C2C, 0X84AD, 0X8D0E, 0X94EE, 0XACEE, 0XB530,
-  0XB590, 0XBE12, 0XC652, 0XAD4F, 0X948C, 0X844B, 0X6BA9, 0X6B28,
-  0X7BA9, 0XA4AE, 0XA510, 0XB572, 0XCE35, 0XC5D4, 0XA4CF, 0X83CB,
-  0X7B2A, 0X9CCE, 0X9D71, 0XB5D3, 0XB5D1, 0XC634, 0XC634, 0XB5F3,
-  0XBD92, 0XBDB2, 0XC5F4, 0XBD72, 0X9C8F, 0X944D, 0X9D0E, 0XAE12,
-  0XC6B6, 0XD719, 0XCED7, 0XD696, 0XCE53, 0XCE32, 0XD653, 0XCE73,
-  0XADB0, 0X8C6B, 0X94AC, 0X94AC, 0XA56E, 0XC632, 0XCED5, 0XCEB4,
-  0XD6D4, 0XD6B4, 0XC5F3, 0XC5B0, 0XB5CF, 0XB5AF, 0XBD6F, 0XAD2E,
-  0XAD0F, 0XA50F, 0XA4CD, 0XB5D1, 0XCE34, 0XDEB6, 0XD6D8, 0XDEF7,
-  0XD6F6, 0XCEF5, 0XCEB5, 0XBE32, 0XB5F2, 0XADB1, 0XA4CD, 0XAD91,
-  0XBE14, 0XBE74, 0XC654, 0XB5B1, 0XAD70, 0XA52F, 0XA530, 0XAD50,
-  0XADB1, 0XC675, 0XC676, 0XD696, 0XDF39, 0XE77B, 0XCEB7, 0X9D31,
-  0X9C4D, 0X8C4D, 0XAD51, 0XAE33, 0XC6D6, 0XD6D7, 0XDEB7, 0XCE75,
-  0XBDF3, 0XCE75, 0XD6D7, 0XDF3A, 0XD696, 0XC634, 0X9DCF, 0XA56F,
-  0X9D4E, 0XA56F, 0X842B, 0X8CAC, 0X9D4E, 0XB5D1, 0XBE12, 0XCED5,
-  0XDF38, 0XD717, 0XD6D6, 0XB652, 0XAE11, 0XA590, 0X9D2E, 0X94EC,
-  0XA56E, 0XB632, 0XC6B4, 0XCEF5, 0XCEF5, 0XC693, 0XB631, 0XAE10,
-  0XADF0, 0XA5AF, 0XA5AF, 0XADD0, 0XA5EF, 0XAE0E, 0XC672, 0XBE91,
-  0XC6D4, 0XC6D3, 0XB691, 0XBE91, 0XB630, 0XBE11, 0XB5F0, 0XADCF,
-  0XA5CF, 0XB611, 0XBDF2, 0XBE11, 0XBE12, 0XB5F1, 0XBDF1, 0XC674,
-  0XCEF5, 0XD737, 0XDF38, 0XD6F6, 0XD6B5, 0XBE12, 0XB5D1, 0X9D4F,
-  0XA56F, 0XADB1, 0XB653, 0XB5B2, 0XB571, 0XBDD3, 0XB5B1, 0XA54F,
-  0XB571, 0XA590, 0XC6B5, 0XCED6, 0XDF38, 0XDF39, 0XD6D6, 0XCED6,
-  0XC654, 0XAD90, 0XAD70, 0XA590, 0XADB0, 0XB5D0, 0XB5D0, 0XBEB4,
-  0XCE95, 0XCE94, 0XD6D6, 0XD6B5, 0XD6B5, 0XC693, 0XCED5, 0XC673,
-  0XC693, 0XCEB5, 0XCE54, 0XBD92, 0XB4F0, 0XA56F, 0X94AE, 0X73AB,
-  0X9D31, 0XAE34, 0XCEB6, 0XCEB6, 0XB634, 0XBDF3, 0XBDB2, 0XB592,
-  0XBDF3, 0XAE54, 0XB612, 0XBDB1, 0XA570, 0XB550, 0XAD90, 0X9D0E,
-  0XA4CF, 0XA592, 0XAD92, 0XBDD2, 0XB612, 0XA5B0, 0X952D, 0X9C8D,
-  0X846E, 0XA530, 0XB571, 0XBE12, 0XBE53, 0XBE12, 0XC611, 0XC5CE,
-  0X9CCB, 0X8369, 0X4A08, 0X4B69, 0X7BCB, 0X946C, 0XAD31, 0XBDF2,
-  0XBE32, 0XC695, 0XBE73, 0XBE54, 0XA5B0, 0XB570, 0XAD70, 0XA510,
-  0XBDF2, 0XBDD1, 0X8C49, 0X952E, 0X8D0D, 0X9CED, 0X94ED, 0XAD4F,
-  0XBDB1, 0XC612, 0XCE32, 0XAD4F, 0X948C, 0X842B, 0X6B69, 0X6369,
-  0X6BC9, 0X8CCD, 0X9CCF, 0XACF0, 0XCDF4, 0XC5D4, 0XAD31, 0X73EB,
-  0X7BCB, 0X948E, 0X9D30, 0XAD50, 0XA52F, 0XBDF2, 0XC634, 0XBDF2,
-  0XB5B1, 0XB5D2, 0XAD72, 0X9C8F, 0X944E, 0X942D, 0X9CEF, 0XB5F4,
-  0XCE76, 0XD6B7, 0XD6B6, 0XD695, 0XC611, 0XCDF2, 0XCE73, 0XCE94,
-  0XBDF1, 0XA50E, 0X8CCC, 0X950C, 0XB56D, 0XBDF0, 0XC694, 0XC694,
-  0XCED4, 0XD6B5, 0XBDB0, 0XCE11, 0XAD8E, 0XC5AF, 0XBDB1, 0XAD2E,
-  0X9CCD, 0X9CCD, 0XAD0F, 0XBDD1, 0XCE54, 0XC695, 0XD6B6, 0XD6F7,
-  0XDF17, 0XCF15, 0XCEB5, 0XCE53, 0XBDF2, 0XAD70, 0XA4ED, 0XBDB1,
-  0XBE33, 0XC6B4, 0XBE13, 0XAD70, 0XB5D1, 0XAD2F, 0XA52E, 0XA50E,
-  0XADD1, 0XCE54, 0XC655, 0XD6B6, 0XDF19, 0XE77B, 0XCF17, 0X8C8E,
-  0X940D, 0X8C6D, 0XAD51, 0XB633, 0XC6D6, 0XD6D8, 0XDEB8, 0XCE54,
-  0XCE54, 0XE6F8, 0XDEF7, 0XDEF9, 0XD6B6, 0XC653, 0XADAF, 0XAD6F,
-  0XA54E, 0X9D2E, 0X8C8C, 0X846A, 0XA52E, 0XADF0, 0XC632, 0XCEB5,
-  0XD717, 0XD6F6, 0XD6F6, 0XBE73, 0XB632, 0XADD0, 0X9D4E, 0X9CED,
-  0X9D4E, 0XB632, 0XCED6, 0XCED5, 0XCED5, 0XC6B4, 0XB631, 0XA5AF,
-  0XA58E, 0X9D4D, 0X9D6D, 0X9D6D, 0XADF0, 0XADEF, 0XB650, 0XCED5,
-  0XC6D2, 0XCEF4, 0XCED3, 0XBE91, 0XBE50, 0XAE0F, 0XBE10, 0XADCF,
-  0XB5F0, 0XB5F0, 0XBE11, 0XADAF, 0XBE32, 0XBE12, 0XBE11, 0XBE52,
-  0XCED4, 0XD716, 0XDF17, 0XD6F6, 0XC694, 0XBE12, 0XB5B1, 0XAD90,
-  0XAD91, 0XADB1, 0XB5B1, 0XAD50, 0XAD70, 0XB5B1, 0XAD91, 0X9D2F,
-  0XA570, 0XADD1, 0XC674, 0XD6F7, 0XDF39, 0XDF18, 0XD6B6, 0XD6B6,
-  0XC695, 0XB613, 0XAD91, 0XADD1, 0XB5D1, 0XBDF1, 0XBE11, 0XB673,
-  0XCEB5, 0XD6D5, 0XD6D5, 0XD6B4, 0XD694, 0XBE31, 0XBE51, 0XC632,
-  0XBE31, 0XCE95, 0XC633, 0XB551, 0XAD10, 0XA4EF, 0X94AE, 0X948E,
-  0XA551, 0X9DF3, 0XCE54, 0XCE95, 0XB634, 0XBDF3, 0XAD2F, 0XB592,
-  0XBDD3, 0XB694, 0XB612, 0XB570, 0XA52F, 0XA4EE, 0XAD0F, 0X9D2D,
-  0XAD0F, 0XA551, 0XA591, 0XC5F3, 0XB5F2, 0XA5B0, 0X8C8B, 0X946D,
-  0X842E, 0XAD91, 0XB592, 0XBE32, 0XBE53, 0XC60F, 0XC58D, 0XBD6D,
-  0X8C4B, 0X8368, 0X6B0A, 0X632A, 0X73CB, 0X8C6A, 0XA550, 0XBDF2,
-  0XCE75, 0XC653, 0XC654, 0XBE53, 0XA5F0, 0XA58F, 0XB510, 0X9C6E,
-  0XAD4F, 0XA54E, 0X9CAC, 0X952D, 0XAD6F, 0X950C, 0X94EC, 0XAD90,
-  0XAD6F, 0XC5F1, 0XC611, 0XB54F, 0X948C, 0X8C0B, 0X7BA9, 0X7328,
-  0X7369, 0X846C, 0X8CAC, 0XB510, 0XCE34, 0XCEB6, 0XBD91, 0XA4CE,
-  0X8C0C, 0X7BCA, 0X9CAE, 0XAD10, 0X948C, 0XC633, 0XCE33, 0XBDD2,
-  0XBDB2, 0XBD90, 0XA4F0, 0X836B, 0X8BEB, 0X8BAC, 0X94CE, 0XADD3,
-  0XCE75, 0XD6B5, 0XD695, 0XD654, 0XCE12, 0XCE31, 0XCEB4, 0XCE93,
-  0XBDF1, 0X950D, 0X8CCA, 0XA54C, 0XAD4D, 0XBE10, 0XC672, 0XC673,
-  0XCE93, 0XC652, 0XBE11, 0XBE11, 0XB5AF, 0XB56F, 0XB5D0, 0XA52E,
-  0XA4CD, 0X9CAC, 0XA50E, 0XBDF1, 0XCE53, 0XCE75, 0XDEF7, 0XDF17,
-  0XDF38, 0XD717, 0XD694, 0XCE54, 0XC611, 0XB56F, 0XB58F, 0XBDB1,
-  0XC654, 0XCEB3, 0XC614, 0XAD4F, 0XA52F, 0XAD2F, 0XA52E, 0XAD2F,
-  0XB5B0, 0XC634, 0XCE75, 0XD6B6, 0XDF18, 0XDF59, 0XD77A, 0X9CCF,
-  0X9C6F, 0XA48E, 0XA530, 0XB5D2, 0XBE34, 0XCE76, 0XD697, 0XD695,
-  0XBE53, 0XD6B7, 0XDED6, 0XD6D7, 0XCEB6, 0XADF0, 0XB5AF, 0XA54E,
-  0XAD4E, 0XA52E, 0X9CCD, 0X848B, 0X946B, 0XB611, 0XC632, 0XCE94,
-  0XD717, 0XD716, 0XD6F5, 0XC6B4, 0XB611, 0XADB0, 0XA58F, 0XA50E,
-  0XAD8F, 0XB611, 0XCED5, 0XC6D4, 0XCED4, 0XC6B4, 0XBE52, 0XB5F0,
-  0XA58E, 0X9D2D, 0X9D2D, 0XA58E, 0XB610, 0XBE10, 0XC672, 0XCED4,
-  0XCEF4, 0XD736, 0XD715, 0XC692, 0XBE50, 0XB60F, 0XADCE, 0XADAE,
-  0XB5AF, 0XB5F0, 0XB5F0, 0XB611, 0XC632, 0XCE53, 0XC611, 0XC652,
-  0XCEB3, 0XCEF3, 0XCEF3, 0XDF17, 0XC672, 0XBDB1, 0XBDD2, 0XB5B1,
-  0XBD91, 0XB591, 0XBDF2, 0XAD90, 0XAD70, 0XB5D2, 0X9D71, 0XA5B0,
-  0XAD4F, 0XB5B1, 0XBE33, 0XD6F7, 0XE739, 0XDF18, 0XD6D7, 0XD6B7,
-  0XCE95, 0XC654, 0XB5D1, 0XB5D1, 0XBDD1, 0XB5D0, 0XBE12, 0XC675,
-  0XD6B5, 0XD6D5, 0XD6D4, 0XD694, 0XC653, 0XBDF1, 0XC652, 0XBDF1,
-  0XBDF1, 0XCE33, 0XC612, 0XB550, 0X94CF, 0XA4CF, 0X9CCF, 0X7BAB,
-  0XA4CF, 0XA571, 0XCE12, 0XC695, 0XBE14, 0XBDD2, 0XB550, 0XB591,
-  0XCDD2, 0XB672, 0XAD90, 0XA4CE, 0XA4EE, 0XA4AD, 0XA4CD, 0XAD4E,
-  0XB4CE, 0X94CE, 0XA5B0, 0XC5F4, 0XC633, 0XA54F, 0X8C0D, 0X8C4D,
-  0X9CAF, 0XAD92, 0XBDF2, 0XC654, 0XBE93, 0XBDCE, 0XCD4D, 0XBD2C,
-  0X8BE9, 0X734C, 0X6328, 0X6309, 0X7C4D, 0XAD4E, 0XA56F, 0XBE33,
-  0XC633, 0XC5F2, 0XC612, 0XBE12, 0XAE51, 0XA610, 0XA4CF, 0X8BCC,
-  0XACCD, 0X9C8C, 0X946C, 0XA54D, 0XAD8F, 0XB5B0, 0X94EC, 0XB571,
-  0XADD2, 0XBDB0, 0XC5F1, 0XAD2E, 0X9CAC, 0X7C09, 0X7BE9, 0X6B48,
-  0X7BA9, 0X844B, 0X946C, 0XC654, 0XCE53, 0XDF18, 0XC613, 0XA4AF,
-  0X944D, 0X83AC, 0X8C4D, 0XAD2F, 0XAD0D, 0XC632, 0XC654, 0XBE32,
-  0XC652, 0XAD70, 0X8CCE, 0X7BAB, 0X83CA, 0X8C0B, 0X94CD, 0XBDB2,
-  0XCE53, 0XCE94, 0XD654, 0XD653, 0XD633, 0XCE32, 0XD6D5, 0XCE74,
-  0XB5D1, 0X8CCC, 0X9CCA, 0XAD6D, 0XA54D, 0XBDEF, 0XBE52, 0XC672,
-  0XCE94, 0XC630, 0XBDF1, 0XB5CF, 0XBD8F, 0XA54D, 0X9D6E, 0XA4CC,
-  0X9C8C, 0X9CAC, 0XA50D, 0XBDB0, 0XCE73, 0XD6B5, 0XD6D6, 0XD716,
-  0XDF16, 0XDF17, 0XDEB7, 0XD675, 0XC610, 0XB52E, 0XB56E, 0XB54E,
-  0XCE72, 0XCED3, 0XC5F3, 0XAD6C, 0XAD6E, 0XACEE, 0XA50E, 0XA52E,
-  0XBDB1, 0XC633, 0XCE75, 0XD6D7, 0XDF18, 0XDF38, 0XE7BC, 0XAD51,
-  0X9C6F, 0X9C4D, 0XAD50, 0XBDD2, 0XB5F2, 0XC634, 0XCE75, 0XCE75,
-  0XBE32, 0XD695, 0XD696, 0XD676, 0XCE75, 0XB5F1, 0X9D2C, 0XAD4D,
-  0XA52E, 0XAD2E, 0XA4ED, 0X94CC, 0X9D0D, 0XB5B0, 0XBE32, 0XD6B4,
-  0XD6D5, 0XD6F6, 0XD6F5, 0XC6B3, 0XBE31, 0XADF0, 0XADB0, 0X950D,
-  0XB590, 0XBDF1, 0XBE72, 0XCED4, 0XCED4, 0XC6B3, 0XBE71, 0XB5EF,
-  0XADAE, 0X9D2B, 0XA56C, 0XA58E, 0XADCF, 0XC631, 0XBE50, 0XD6D4,
-  0XD6F5, 0XD715, 0XD715, 0XCEB3, 0XBE51, 0XADCE, 0XA5AE, 0XA58D,
-  0XAD8E, 0XB5D0, 0XBE11, 0XBDF0, 0XC631, 0XC632, 0XB630, 0XBE51,
-  0XC691, 0XC6D1, 0XD6F4, 0XD6F6, 0XD6B5, 0XC633, 0XC613, 0XB590,
-  0XB570, 0XAD50, 0XB590, 0XAD70, 0XB5D1, 0XADB1, 0XADB1, 0XAD91,
-  0XB590, 0XBDF2, 0XBE33, 0XD6B5, 0XDF17, 0XDEF7, 0XD6D7, 0XD6B6,
-  0XCE74, 0XCE54, 0XC613, 0XBDF2, 0XBDF1, 0XB5B0, 0XBE73, 0XC694,
-  0XD6D5, 0XD6D5, 0XCEB4, 0XD654, 0XBE12, 0XB5B0, 0XBDF2, 0XBDB1,
-  0XBDD1, 0XC633, 0XB5D1, 0XAD2F, 0X94CF, 0X9CAE, 0X9CAE, 0X8C2C,
-  0X944E, 0X9CEF, 0XCE12, 0XCE74, 0XB592, 0XAD51, 0XB52F, 0XB570,
-  0XB54F, 0XADF0, 0XA50F, 0X9CAD, 0XA4AD, 0X9CAD, 0X9CAD, 0XA4ED,
-  0XA50D, 0X9C8E, 0XADD0, 0XBDF4, 0XCDD2, 0X94EE, 0X83AC, 0X846D,
-  0X9CCF, 0XA571, 0XCE34, 0XCE54, 0XC694, 0XC5D0, 0XC56D, 0XC50D,
-  0X9C6A, 0X7B6A, 0X6B29, 0X6B49, 0X844D, 0XBD90, 0XB5F1, 0XC632,
-  0XC632, 0XC5F1, 0XBDD0, 0XBDF1, 0XC5D1, 0XAD6F, 0X9CCD, 0X8BCA,
-  0X9C2C, 0X9C4C, 0X944A, 0XA4ED, 0XB5AF, 0XB5D0, 0XAD2E, 0XA50F,
-  0XAD30, 0XB570, 0XC5D1, 0XB54F, 0XA4AC, 0X944A, 0X842A, 0X5B27,
-  0X6B68, 0X6C49, 0X6C8A, 0XADD1, 0XD674, 0XD694, 0XCE33, 0XB590,
-  0XA4ED, 0X942C, 0X9C8D, 0XBDCF, 0XCDEF, 0XCE51, 0XCE93, 0XCEB4,
-  0XC652, 0XA5B2, 0X8CAE, 0X7B4A, 0X83CB, 0X8BEB, 0XAD2E, 0XCDF2,
-  0XC652, 0XC632, 0XD633, 0XCE12, 0XCDF1, 0XD693, 0XCE94, 0XCE54,
-  0XBDD1, 0XA4ED, 0XB56D, 0XB56D, 0XB5AE, 0XB5CF, 0XCE31, 0XC693,
-  0XD694, 0XC631, 0XB5AF, 0XBDF0, 0XB5AF, 0XAD6E, 0XAD2D, 0XA4ED,
-  0X9CAC, 0X9C8C, 0XA4ED, 0XBDB0, 0XC612, 0XCE94, 0XCEB4, 0XDF16,
-  0XDF16, 0XDEF7, 0XDEB7, 0XD654, 0XBDF0, 0XB52D, 0XB56E, 0XC5B0,
-  0XCE91, 0XD6B3, 0XCE14, 0XA52B, 0XA52D, 0XAD0E, 0XA50E, 0XA50E,
-  0XC5F2, 0XCE94, 0XCE95, 0XD6D6, 0XDF18, 0XDF39, 0XDF5A, 0XBDF4,
-  0XA510, 0X9C2E, 0XA550, 0XBDD2, 0XC5F3, 0XB5D2, 0XCDD2, 0XCE74,
-  0XCE75, 0XD675, 0XD675, 0XCE13, 0XCE54, 0XC5D0, 0XAD0D, 0XA52C,
-  0XA52D, 0XA50D, 0XA50E, 0XA4ED, 0X94CD, 0XB5CF, 0XCE12, 0XD693,
-  0XDED5, 0XD6F4, 0XCEF4, 0XC6B3, 0XC652, 0XB5F0, 0XA58E, 0X9D4E,
-  0XA56E, 0XB5F0, 0XBE51, 0XCED4, 0XCEF4, 0XC6B2, 0XB630, 0XADCE,
-  0XAD8D, 0XAD8C, 0XA56C, 0XADAE, 0XB610, 0XBE30, 0XC672, 0XD6F4,
-  0XDF16, 0XDF35, 0XDF36, 0XCEB2, 0XC671, 0XBDEF, 0XB5CE, 0XAD8E,
-  0XA56E, 0XB5D0, 0XBE11, 0XBE31, 0XBE31, 0XC651, 0XC650, 0XCEB3,
-  0XD6D4, 0XD6F4, 0XDEF6, 0XDEF6, 0XD6D5, 0XD6B4, 0XC632, 0XB570,
-  0XA4EE, 0XA4EF, 0XAD50, 0XAD70, 0XC633, 0XB5F1, 0XB570, 0XAD90,
-  0XB5B1, 0XBDB1, 0XC633, 0XD6B5, 0XDF17, 0XD6D6, 0XD6D6, 0XCE95,
-  0XCE74, 0XCE53, 0XC5F2, 0XBDF2, 0XBDF1, 0XB5D0, 0XBE12, 0XCE53,
-  0XD6B4, 0XD6D4, 0XCE73, 0XC5F2, 0XBDF1, 0XBD90, 0XAD6F, 0XCE11,
-  0XC611, 0XC612, 0XAD70, 0XA4CE, 0X940D, 0X8C2D, 0X942D, 0X8BEC,
-  0X8C2C, 0XA50F, 0XCE12, 0XCE52, 0XAD30, 0XAD10, 0XB54F, 0XB570,
-  0XAD4F, 0XA54F, 0XAD0F, 0X9CAD, 0X946D, 0X9C8C, 0X946C, 0XA4ED,
-  0X9CCC, 0X948D, 0XA5AF, 0XBE54, 0XC56F, 0X8CAD, 0X83CC, 0X844C,
-  0XA4AF, 0X9D10, 0XC5F4, 0XCE33, 0XCE54, 0XBDAF, 0XBD6E, 0XC54F,
-  0X9CAD, 0X7389, 0X6B29, 0X7BCA, 0X948C, 0XB570, 0XBDF1, 0XB5D0,
-  0XD652, 0XBDF0, 0XBDCF, 0XBDAF, 0XB56F, 0XC5B2, 0X83C9, 0X8BC9,
-  0X8BEA, 0XA42C, 0X942A, 0X9C6B, 0XBD6F, 0XCE11, 0XB58F, 0X9D0D,
-  0XAD0E, 0XAD2E, 0XBD90, 0XBD4F, 0XACAD, 0XA46B, 0X7B89, 0X6AE6,
-  0X7B88, 0X7C08, 0X7C6A, 0XAD8F, 0XDEB5, 0XDED4, 0XCE53, 0XAD91,
-  0XA52E, 0X9CCE, 0XACEE, 0XCE31, 0XBDCE, 0XCE92, 0XCED2, 0XCEB2,
-  0XC652, 0XBD71, 0X8C2B, 0X83EA, 0X83AA, 0X83EA, 0XB54F, 0XC612,
-  0XBE32, 0XBDF0, 0XCDF1, 0XCDB1, 0XCDD0, 0XCE12, 0XCE94, 0XCE32,
-  0XBD90, 0XB54E, 0XAD4D, 0XC5F0, 0XBDF0, 0XBDAE, 0XC610, 0XC672,
-  0XCEB4, 0XC612, 0XA52D, 0XB58F, 0XB58F, 0XB56E, 0XB54F, 0XACEE,
-  0XA4AC, 0X9CAC, 0X9C8C, 0XB54F, 0XB5D0, 0XBE52, 0XCEB3, 0XDEF5,
-  0XDEF6, 0XDED6, 0XDEB6, 0XCE52, 0XADCF, 0XB56E, 0XB56E, 0XC5CF,
-  0XCE71, 0XCE50, 0XBD6E, 0X9469, 0X9CAB, 0XACED, 0XB52E, 0XB54F,
-  0XB54F, 0XCE33, 0XD696, 0XDEF7, 0XDF19, 0XE719, 0XCEB5, 0XBE35,
-  0XBE14, 0X93CD, 0XB570, 0XBDB1, 0XBD71, 0XA590, 0XC5B2, 0XC613,
-  0XCE55, 0XD654, 0XCDF4, 0XC5B1, 0XC5F1, 0XC5F1, 0XACEE, 0XA4CC,
-  0X9CAC, 0XA4ED, 0XB56F, 0XB58F, 0X9D0D, 0XB5AF, 0XC5F1, 0XD672,
-  0XDED4, 0XDED4, 0XCED3, 0XCED3, 0XCE92, 0XC631, 0XADAF, 0X9D6D,
-  0XA5AE, 0XADAF, 0XBE30, 0XD6F5, 0XD6B3, 0XD6B4, 0XAE0E, 0XADAE,
-  0XA56D, 0XAD6C, 0XAD8C, 0XADAD, 0XBE10, 0XC652, 0XC672, 0XD6B3,
-  0XDF17, 0XDF15, 0XDF16, 0XD6D3, 0XC671, 0XBE0F, 0XBDCE, 0XBDCE,
-  0XB5CF, 0XBDF0, 0XC611, 0XC651, 0XC671, 0XC670, 0XC671, 0XCEB3,
-  0XCEB3, 0XD715, 0XD6F5, 0XD6F5, 0XD6D5, 0XD6B4, 0XBE11, 0XAD4E,
-  0X9CCD, 0XA4CE, 0XA4EE, 0XB590, 0XCE32, 0XC612, 0XB570, 0XB570,
-  0XBD91, 0XC5D2, 0XC5D2, 0XCE94, 0XD716, 0XD6B4, 0XCEB5, 0XCE95,
-  0XD694, 0XCE33, 0XC5F2, 0XBDD1, 0XBDB1, 0XBDB0, 0XBDD1, 0XC612,
-  0XCE93, 0XD6B4, 0XCE32, 0XBDD1, 0XBDD1, 0XB52E, 0XACEE, 0XCDF0,
-  0XD652, 0XC612, 0XAD0F, 0X9C8D, 0X940C, 0X8C0C, 0X8C0B, 0X83AB,
-  0X8BEC, 0XA4EE, 0XBDD1, 0XC5F1, 0XAD10, 0XA4EF, 0XAD2F, 0XAD4E,
-  0XB56F, 0XA4CE, 0XA4EE, 0XA4AD, 0X9C8D, 0X9C6C, 0X9CCD, 0X9C8D,
-  0X7BA9, 0XA4CE, 0XA54E, 0XBE72, 0XBD50, 0X9CCE, 0X8C0C, 0X8C6D,
-  0X8C4D, 0X9CEF, 0XAD71, 0XCE33, 0XC5F2, 0XBD2D, 0XBD4E, 0XB54E,
-  0X944C, 0X83CA, 0X6B09, 0X83A9, 0XA4ED, 0XBDB2, 0XBDB0, 0XB5AE,
-  0XC610, 0XBDB0, 0XAD2D, 0XAD6D, 0XA58E, 0XA54E, 0X942C, 0X8BC9,
-  0X944A, 0XA4AE, 0X9C4C, 0X9409, 0XB54E, 0XCE32, 0XC5B0, 0XA4EF,
-  0XA4ED, 0XA4ED, 0XBDAF, 0XB56E, 0XA4CC, 0X942B, 0X7B49, 0X7B48,
-  0X8389, 0X9409, 0X948C, 0XB570, 0XDED4, 0XDEF6, 0XC5F3, 0XAD0F,
-  0XA50C, 0XAD2E, 0XB590, 0XCE31, 0XBEB1, 0XCEB2, 0XCED3, 0XCE93,
-  0XD5D3, 0XA4EE, 0X7BE9, 0X73A8, 0X840A, 0X946B, 0XADB0, 0XBE32,
-  0XBE11, 0XB58E, 0XC5AF, 0XCDB1, 0XC590, 0XC611, 0XD652, 0XCDF1,
-  0XB56F, 0XB56F, 0XAD6E, 0XBE10, 0XBD4F, 0XB58F, 0XBDCF, 0XCE52,
-  0XCE73, 0XC5F1, 0XAD4E, 0XA54D, 0XB56E, 0XB54E, 0XACEE, 0XA4AD,
-  0XA4AC, 0X9CAB, 0XACEE, 0XACAD, 0XB5B1, 0XC631, 0XCE92, 0XDEF4,
-  0XD6F5, 0XD6B5, 0XCE54, 0XBDD0, 0XAD4E, 0XA50D, 0XAD0C, 0XB56D,
-  0XC62F, 0XC5CE, 0XA4EA, 0X9429, 0X944A, 0XA4AC, 0XAD0D, 0XAD2F,
-  0X9CAB, 0XCDD1, 0XD655, 0XDED7, 0XDF39, 0XDEF9, 0XBE12, 0XB5F2,
-  0XA5B1, 0X9C0D, 0XAD2F, 0XB5F1, 0XC592, 0XAD91, 0XCDD2, 0XC613,
-  0XC634, 0XD654, 0XC5B1, 0XBD6E, 0XB54D, 0XCE51, 0XACED, 0XA4AC,
-  0X9C4B, 0XA4EC, 0XC5F1, 0XAD8E, 0XAD6E, 0XBD6E, 0XCE32, 0XD652,
-  0XDED3, 0XDEF4, 0XD6D3, 0XD6D3, 0XD6B2, 0XBE0F, 0XB58E, 0XA54E,
-  0XA56E, 0XADAE, 0XBE10, 0XCEB2, 0XD693, 0XD693, 0XB5EF, 0XB5CE,
-  0XAD6D, 0XAD8C, 0XB5AD, 0XB5AE, 0XBE10, 0XD6B3, 0XC651, 0XC691,
-  0XD6F4, 0XDF36, 0XDF36, 0XD6D3, 0XCE91, 0XC630, 0XBDEE, 0XB5AE,
-  0XBDEE, 0XC610, 0XBDF0, 0XCE72, 0XC650, 0XC650, 0XCE71, 0XCE92,
-  0XC691, 0XCED3, 0XD6F4, 0XD6F5, 0XD6D5, 0XCE93, 0XB5D0, 0XA50D,
-  0X9CCC, 0X9CAD, 0XA4AD, 0XB56F, 0XCE32, 0XC5D1, 0XB550, 0XB550,
-  0XBDB1, 0XBD91, 0XBDF1, 0XD694, 0XD6F5, 0XCED4, 0XCEB4, 0XD694,
-  0XD673, 0XCE33, 0XC612, 0XC5B1, 0XBDB0, 0XBD90, 0XBDB0, 0XC611,
-  0XCE93, 0XD693, 0XCE32, 0XADAF, 0XBD70, 0XB50E, 0XAD0E, 0XCDEF,
-  0XCE11, 0XC5F1, 0XAD0F, 0X9CAD, 0X8C2C, 0X8C0C, 0X8C4B, 0X83CB,
-  0X83CB, 0X9CAC, 0XBD90, 0XBD90, 0XA4AF, 0XACEF, 0XAD2F, 0XA4ED,
-  0XBD6F, 0XA4AE, 0X9CAD, 0X9C8D, 0X9C6D, 0X946D, 0X9C8C, 0X8BEB,
-  0X93CB, 0X9CAD, 0XA4CD, 0XA4ED, 0XB4CF, 0X9C6C, 0X7BAA, 0X9C8E,
-  0X94CE, 0X9CEF, 0XA550, 0XC633, 0XBDB1, 0XAD0D, 0XB4EC, 0XACED,
-  0X9C2C, 0X83AA, 0X6B49, 0X7B6A, 0XACCE, 0XAD0E, 0XBD50, 0XB54E,
-  0XC5F0, 0XB58F, 0XA50D, 0XB4ED, 0X9CED, 0X950D, 0X9CAC, 0X942B,
-  0X942B, 0XA4CB, 0XB52E, 0X8BC9, 0XB52D, 0XCE31, 0XC5D0, 0XA4AD,
-  0XACAE, 0XACEE, 0XBD90, 0XB54F, 0X948B, 0X842A, 0X7BA9, 0X7347,
-  0X944B, 0X9CAC, 0X9CCB, 0XBD90, 0XD6B3, 0XCE32, 0XBD70, 0XB52F,
-  0X9CAC, 0XB52F, 0XBDB0, 0XCE2F, 0XC671, 0XCE92, 0XC672, 0XC632,
-  0XBDB2, 0XAD0E, 0X8C29, 0X8C49, 0X8C4A, 0X8CCC, 0XB5D0, 0XBE11,
-  0XBDD0, 0XB54E, 0XBD6D, 0XCD90, 0XCDD1, 0XCDF1, 0XC611, 0XBDD0,
-  0XB54F, 0XB54F, 0XBDAF, 0XC5AF, 0XBD91, 0XB58F, 0XBDD0, 0XD672,
-  0XD652, 0XBDD0, 0XAD4D, 0XA52D, 0XB50E, 0XB52E, 0XA4AE, 0X9C4C,
-  0XA4AD, 0XA48C, 0XACEF, 0XB50E, 0XB5F1, 0XC611, 0XD6B2, 0XDEF3,
-  0XD716, 0XD6B5, 0XC5F3, 0XBDB1, 0XAD0E, 0XA4CC, 0XAD2D, 0XB52D,
-  0XBD6D, 0XC54B, 0X9C8B, 0X8C2A, 0X8C2A, 0XB50E, 0XB52E, 0XAD0E,
-  0XA4AC, 0XB530, 0XCE13, 0XD6B6, 0XDF18, 0XCE55, 0XC5D1, 0X9D4F,
-  0X948C, 0XA44D, 0XAD2F, 0XBE11, 0XBD51, 0XB551, 0XC612, 0XCE14,
-  0XCE54, 0XCDF3, 0XC5B1, 0XBD6F, 0XB50D, 0XBDAE, 0XB52E, 0X9C8B,
-  0X944B, 0X9CCC, 0XAD4C, 0XAD2D, 0XB5AF, 0XAD4E, 0XC5F0, 0XD632,
-  0XDEB3, 0XDEF4, 0XD6B3, 0XD6D3, 0XCE71, 0XC5EF, 0XB58E, 0XB5AE,
-  0XAD4D, 0XB58E, 0XADCE, 0XC651, 0XD6B3, 0XDE93, 0XC60F, 0XADAC,
-  0XA54B, 0XB56B, 0XBDAC, 0XBDEE, 0XC610, 0XD651, 0XCE50, 0XC671,
-  0XCEB2, 0XDF15, 0XDF15, 0XD6F3, 0XCE91, 0XC650, 0XC60F, 0XBDEE,
-  0XBDEE, 0XC5EF, 0XC610, 0XC630, 0XC630, 0XD692, 0XCE70, 0XC650,
-  0XCE72, 0XD6F4, 0XD6D4, 0XD6F5, 0XD6F5, 0XD693, 0XBDD0, 0XA50D,
-  0X948B, 0X942B, 0X9C6C, 0XAD2E, 0XCE12, 0XC5D1, 0XBD71, 0XC591,
-  0XC5D2, 0XB570, 0XBD90, 0XCE32, 0XD6F5, 0XCED4, 0XCE73, 0XCE32,
-  0XCE12, 0XCE53, 0XC5D1, 0XB570, 0XBD71, 0XBD70, 0XBD70, 0XC5D0,
-  0XD672, 0XD673, 0XC5F0, 0XB56F, 0XB50E, 0XACED, 0XB52E, 0XCDCE,
-  0XCE10, 0XC5B1, 0XAD2F, 0X9CAD, 0X942C, 0X8C0B, 0X8C0B, 0X83AB,
-  0X8BEB, 0XA4CD, 0XBD70, 0XB52F, 0XA4AE, 0XA4AF, 0XACCF, 0XACED,
-  0XACEE, 0X9CAD, 0X9C4C, 0X9CAD, 0X9C6E, 0X948D, 0X9C6C, 0X8BEC,
-  0X93CB, 0XA4CE, 0XAD0D, 0XAC6C, 0X93ED, 0X944C, 0X840B, 0X942D,
-  0X948E, 0X9CAE, 0XAD50, 0XC612, 0XB54F, 0XA4AC, 0XA40A, 0XACCB,
-  0X9C0B, 0X83AA, 0X7389, 0X6B09, 0XAC8D, 0XB4AE, 0XB50E, 0XAD0E,
-  0XBD8F, 0XB54E, 0X94AC, 0X940A, 0X834A, 0X9CAC, 0X944A, 0X942B,
-  0X946C, 0XA48C, 0XA4AB, 0X9429, 0XAD0D, 0XCE10, 0XC5AF, 0XACCD,
-  0XAC8D, 0XACCD, 0XB52F, 0XB50E, 0X940B, 0X83A9, 0X8BE9, 0X83A8,
-  0XA4AC, 0XB52E, 0XB54E, 0XC570, 0XD5F2, 0XCDB1, 0XC570, 0XB4EE,
-  0XB4CE, 0XA4AE, 0XBD90, 0XC5B0, 0XB5F0, 0XCE31, 0XC630, 0XBDF0,
-  0XC5D0, 0XA4ED, 0X8C0A, 0X942A, 0X940A, 0XA4AC, 0XBDB0, 0XC611,
-  0XBD6F, 0XB52D, 0XC54E, 0XC56F, 0XC56F, 0XBDB0, 0XBDD0, 0XBD90,
-  0XB52F, 0XB52E, 0XB54E, 0XBD8F, 0XBDB0, 0XBDAE, 0XC5CF, 0XD672,
-  0XD652, 0XB58F, 0XAD4D, 0XA50D, 0XB50E, 0XBD71, 0XA42C, 0X942A,
-  0XA4AD, 0XA4AD, 0XACEE, 0XB50E, 0XAD4F, 0XC5F1, 0XD691, 0XD6F2,
-  0XD6F5, 0XD6B3, 0XC5F2, 0XB590, 0XA50E, 0XAD0D, 0XA50D, 0XACAD,
-  0XA4CB, 0XACAB, 0X942A, 0X7C09, 0X83C9, 0XA48C, 0XACED, 0XA4AC,
-  0XA48C, 0XAD0E, 0XCE13, 0XCE74, 0XD6B4, 0XBE14, 0XA50E, 0X9CED,
-  0X9C6D, 0XA48D, 0XB52E, 0XB5B0, 0XACCF, 0XAC90, 0XC611, 0XCDB2,
-  0XCE34, 0XBD30, 0XBD90, 0XC550, 0XACEB, 0XB50D, 0XBD8E, 0X9C8B,
-  0X9C8B, 0X9CAB, 0XA50C, 0XB54E, 0XAD6E, 0XB5AE, 0XBD8F, 0XD630,
-  0XDE93, 0XE715, 0XD6D2, 0XDEF4, 0XCE50, 0XBDAC, 0XBDAD, 0XB5CE,
-  0XB56D, 0XB5AE, 0XB5EE, 0XCE50, 0XD692, 0XD693, 0XC60F, 0XB5AC,
-  0XAD6B, 0XB58B, 0XBDAB, 0XB5AC, 0XC5EE, 0XCE10, 0XCE4F, 0XCE71,
-  0XD6B2, 0XDEF3, 0XDF14, 0XD6D2, 0XCE91, 0XC650, 0XC630, 0XC60F,
-  0XC5EE, 0XC5EF, 0XCE10, 0XCE30, 0XC5EF, 0XC62F, 0XC630, 0XBE10,
-  0XC671, 0XD692, 0XD6B3, 0XD6F5, 0XD6F4, 0XD693, 0XBDAF, 0XA4EC,
-  0X8C4A, 0X83EA, 0X8C0A, 0XACED, 0XCDF1, 0XCDF1, 0XBD70, 0XBD91,
-  0XBDD1, 0XBD91, 0XBD50, 0XBD70, 0XD652, 0XD6B3, 0XD652, 0XC5B0,
-  0XC591, 0XCDD2, 0XBDB0, 0XBD70, 0XBD50, 0XBD50, 0XBD70, 0XC5AF,
-  0XD651, 0XD652, 0XC5D0, 0XB52F, 0XACEE, 0XA48D, 0XBD4E, 0XCDAE,
-  0XCDCF, 0XC570, 0XACEE, 0X9C8C, 0X83EB, 0X83EA, 0X83AA, 0X838A,
-  0X8C0B, 0XA4CD, 0XBD6F, 0XACCE, 0XA44E, 0XA4AE, 0XA48E, 0XACCD,
-  0XA46D, 0XA4CE, 0X9C6C, 0X8C2B, 0X946E, 0X946D, 0X940B, 0X836B,
-  0X9C4D, 0XAD0E, 0XB54E, 0XA4AD, 0X8BAB, 0X948E, 0X840C, 0X8C0C,
-  0X8C8D, 0XA4EF, 0XB570, 0XC5F1, 0XAD0E, 0X944B, 0X9C09, 0X9C4C,
-  0X9C4A, 0X8BEA, 0X7BCA, 0X73A9, 0X93EB, 0XA46C, 0XA46C, 0XACED,
-  0XC58F, 0XB50D, 0XA48B, 0X8BEA, 0X8389, 0X940B, 0X8BC9, 0X946B,
-  0XA4CE, 0X9C6A, 0X9C2A, 0X9C4A, 0XB4ED, 0XCE11, 0XC5AF, 0XA48D,
-  0XA4AD, 0XA4AC, 0XB4ED, 0XA4AC, 0X8BEA, 0X83A9, 0X8BA9, 0X8388,
-  0XA46B, 0XBD4F, 0XC56F, 0XC54F, 0XCD71, 0XC52F, 0XBD2F, 0XA4CC,
-  0XACCC, 0X8C2A, 0XB52E, 0XC591, 0XBDB0, 0XCDF0, 0XC5F0, 0XCE10,
-  0XB58F, 0XA50E, 0X944B, 0XA46C, 0X9C2B, 0XACAC, 0XBDB0, 0XBDD0,
-  0XBD4E, 0XB4CC, 0XCD4F, 0XC54F, 0XBD2E, 0XC5B0, 0XBDB0, 0XB52E,
-  0XBD4F, 0XB54E, 0XB54E, 0XBD6E, 0XC5AE, 0XCDAE, 0XC5CF, 0XD671,
-  0XCE51, 0XB54E, 0XA4EC, 0X94AB, 0X9CAC, 0XB4CF, 0XAC8C, 0X9C8A,
-  0XA4AD, 0XA48D, 0XACCE, 0XACEE, 0XBD90, 0XCDD0, 0XDE90, 0XDF54,
-  0XD6B1, 0XD672, 0XCDF1, 0XAD6F, 0XA52E, 0XAD0D, 0X9D0D, 0X9C6B,
-  0X942A, 0XA46A, 0X942A, 0X7409, 0X83C9, 0XA46B, 0XA4AC, 0XACCD,
-  0XACCD, 0XBD50, 0XCE33, 0XCE74, 0XCE53, 0XBDD2, 0XB52F, 0XA4AD,
-  0X9C4D, 0X940B, 0XACED, 0XA4CD, 0XA4AE, 0XAC4E, 0XBDB0, 0XC590,
-  0XC5D1, 0XCDF2, 0XC590, 0XBD70, 0XACCC, 0XB50C, 0XBD4D, 0XA4EB,
-  0X9C8A, 0X9CAC, 0XA50C, 0XAD0D, 0XB54E, 0XB58E, 0XC5AF, 0XD610,
-  0XDE51, 0XE6D4, 0XDED2, 0XDED2, 0XD670, 0XC5AD, 0XBD8D, 0XB5CE,
-  0XB58D, 0XB5AD, 0XB5CE, 0XC650, 0XD671, 0XD6D3, 0XC60F, 0XAD8C,
-  0XAD4B, 0XB56B, 0XB56B, 0XB5AB, 0XBDCD, 0XC5EE, 0XD64F, 0XD691,
-  0XD6B2, 0XDEF3, 0XE714, 0XDED2, 0XCE70, 0XC62E, 0XCE2F, 0XC5EE,
-  0XBDCE, 0XC5CE, 0XC5EF, 0XC5EF, 0XBDCE, 0XC60F, 0XC5EF, 0XB5CF,
-  0XC651, 0XC650, 0XCE70, 0XCE92, 0XD6D4, 0XD672, 0XBDAF, 0XA50C,
-  0X8C4A, 0X83C9, 0X83EA, 0XACCD, 0XCDD1, 0XCDD1, 0XAD4F, 0XBD91,
-  0XBD90, 0XBD70, 0XB52F, 0XBD50, 0XCE11, 0XD693, 0XD653, 0XB56F,
-  0XAD0F, 0XBD90, 0XBD70, 0XB50F, 0XACEE, 0XA48C, 0XAD2E, 0XC58F,
-  0XD650, 0XD631, 0XBD90, 0XB50E, 0XB54F, 0XACEE, 0XBD2E, 0XCD8E,
-  0XCD6F, 0XBD4F, 0XACCD, 0X944C, 0X7BAA, 0X83CA, 0X83AA, 0X83AA,
-  0X944B, 0XAD0E, 0XBD6F, 0XACEE, 0X9C4D, 0XA48E, 0XA46E, 0XA4CD,
-  0XA46C, 0X9C8D, 0X9C4C, 0X93CC, 0X942D, 0X946E, 0X944B, 0X8B8B,
-  0XA48D, 0XB54F, 0XBDAF, 0XACEE, 0X940A, 0X94AF, 0X8C6D, 0X9CAE,
-  0X948E, 0X9CCE, 0XBD50, 0XBD70, 0XACED, 0X942B, 0X8C09, 0X9C2B,
-  0XA46C, 0XA46C, 0X93EB, 0X8C0B, 0X942B, 0X93AB, 0XA44B, 0XACED,
-  0XBD6E, 0XB50D, 0X9C6B, 0X940A, 0X8BAA, 0X9C0B, 0X93AA, 0X942A,
-  0X9C8B, 0X8C09, 0X8BA7, 0X9C4A, 0XBD6F, 0XCDD0, 0XC58F, 0XA4AD,
-  0X9C6C, 0X9C6B, 0XACAC, 0X9C0B, 0X8BC8, 0X93C9, 0X8BA7, 0X7B66,
-  0X946A, 0XC590, 0XC590, 0XCDB1, 0XC54E, 0XBD0E, 0XC52F, 0XAC8D,
-  0X9C2C, 0X9C2B, 0XAC8D, 0XBCEE, 0XCD91, 0XC570, 0XC56F, 0XCDB0,
-  0XB52F, 0XB50E, 0X9C8C, 0XA46D, 0XA44C, 0XACED, 0XC5D0, 0XBDD0,
-  0XBD2E, 0XB4CC, 0XCDB1, 0XC52F, 0XB4AC, 0XC590, 0XC5D0, 0XB54F,
-  0XBD2E, 0XB4ED, 0XBD8E, 0XBD8E, 0XC56D, 0XCD8D, 0XCE0F, 0XD651,
-  0XCE10, 0XB56E, 0XA4ED, 0X9C6B, 0XA3EB, 0XACCC, 0XA48B, 0X8C2A,
-  0XA4AD, 0XACCF, 0XACAE, 0XA4CE, 0XBD6F, 0XCDF0, 0XDF13, 0XD6D2,
-  0XCDEE, 0XC5AD, 0XBDAD, 0XB54E, 0XAD2E, 0XA4CC, 0X94CC, 0X9C4B,
-  0X83A8, 0X942A, 0X946C, 0X7C2A, 0X8C0A, 0X9C0B, 0XA48B, 0XACCD,
-  0XACCD, 0XBD70, 0XCE52, 0XCE53, 0XCDF1, 0XBD90, 0XB54F, 0X9C0A,
-  0X93CC, 0XA44D, 0XA4CD, 0X9C8C, 0XA46D, 0XAC6E, 0XBD30, 0XBD4F,
-  0XC5B1, 0XCDD2, 0XC570, 0XBD4F, 0XB4CE, 0XACAC, 0XACEC, 0XACCB,
-  0XA4AB, 0XA4CC, 0X9CAB, 0XA48B, 0XB50D, 0XBD6E, 0XBD6D, 0XCDAF,
-  0XDE50, 0XDEB2, 0XDED2, 0XD6D1, 0XCE0E, 0XBD6C, 0XBD6D, 0XB56D,
-  0XB56D, 0XBD6D, 0XCE0F, 0XC650, 0XCE70, 0XD671, 0XC5CE, 0XAD6C,
-  0X9D0A, 0XB56B, 0XBD6B, 0XB56B, 0XBD6C, 0XCDED, 0XD62F, 0XCE70,
-  0XD691, 0XDEF2, 0XDEF3, 0XDEB1, 0XCE2F, 0XBDCC, 0XBDAC, 0XB5AC,
-  0XB56C, 0XB56D, 0XBD8E, 0XBD6D, 0XB56D, 0XBDAE, 0XBD8E, 0XB5AE,
-  0XBDCE, 0XC5CF, 0XCE30, 0XD671, 0XD6B3, 0XCE71, 0XB58E, 0X9CAC,
-  0X8C0A, 0X83A9, 0X7B68, 0X9C6C, 0XBD70, 0XBD90, 0XB52F, 0XB52F,
-  0XB54F, 0XB56F, 0XB52F, 0XBCEF, 0XCE12, 0XD632, 0XC590, 0XBD70,
-  0XB4EE, 0XBD50, 0XB4EE, 0X9C6C, 0X8BEA, 0X8C4B, 0XA4AB, 0XC56D,
-  0XD60F, 0XD631, 0XBD4F, 0XACCD, 0XACEE, 0XACEE, 0XC52D, 0XCD6D,
-  0XB4EC, 0XACCD, 0XA46D, 0X942B, 0X940B, 0X83A9, 0X7B48, 0X8389,
-  0XA48C, 0XBD4F, 0XBD6F, 0XACCD, 0X942B, 0X9C4D, 0X8BAB, 0X9CCC,
-  0X8B8B, 0X844C, 0X9C2D, 0X8BCB, 0X93EC, 0X948E, 0X8C0B, 0X940C,
-  0XACAE, 0XC58F, 0XC5AF, 0XAD0D, 0X9C2B, 0X840C, 0X8C2C, 0X948E,
-  0X9CAE, 0X9CCE, 0XB52F, 0XBD4F, 0XA4CD, 0X944B, 0X9C0B, 0X9C2B,
-  0XA44C, 0X9C2B, 0X9C0B, 0X93EB, 0X8C0A, 0X8BCA, 0XA44B, 0XB4ED,
-  0XBD2E, 0XACED, 0X9C4A, 0X8C09, 0X93EA, 0X940B, 0X93EA, 0X8BE9,
-  0X9409, 0X8BC8, 0X6B45, 0X942A, 0XCD8F, 0XCDB0, 0XC56F, 0XA4CD,
-  0X8C6B, 0X942A, 0XA44B, 0X9BEA, 0X8BC8, 0X93E8, 0X8B87, 0X8B46,
-  0X8BC8, 0XB50D, 0XC56F, 0XCD6E, 0XC52E, 0XC50E, 0XB4CD, 0X942A,
-  0X9C4A, 0X9C2A, 0X93E8, 0XB4CD, 0XC50F, 0XACAE, 0XB50E, 0XB54E,
-  0XB52E, 0XB52E, 0XB4CD, 0XAC8C, 0XA46C, 0XB4ED, 0XCDF1, 0XC5D0,
-  0XBD2D, 0XBD0D, 0XCD2E, 0XBCEC, 0XB4ED, 0XC5B0, 0XCDF1, 0XC52F,
-  0XACAD, 0XB4CD, 0XB54C, 0XB54C, 0XBD2B, 0XC56C, 0XD5F0, 0XD631,
-  0XCE10, 0XBD4E, 0X8C6B, 0X942B, 0X940A, 0XAC6B, 0XA48B, 0X9C8B,
-  0XA48D, 0XACAE, 0XACCE, 0XB50E, 0XBD6F, 0XD630, 0XD6F3, 0XCDF0,
-  0XBCAD, 0XB4A9, 0XBCED, 0XAD0D, 0XACCD, 0X9CAC, 0X8C6C, 0X940A,
-  0X93EA, 0X8387, 0X8C4B, 0X840B, 0X8BC9, 0X940B, 0XA46B, 0XA4AD,
-  0XB4AD, 0XC590, 0XCE32, 0XCE33, 0XC5D0, 0XB56F, 0XA4AD, 0XA40A,
-  0X9C2B, 0X9C0C, 0X9C4C, 0XACCE, 0X9C6C, 0XB4CE, 0XACAE, 0XB50E,
-  0XC550, 0XC5B1, 0XBD8F, 0XC52F, 0XB4CE, 0XB4AD, 0XB4CC, 0XAC8B,
-  0X9C4A, 0X9429, 0X9CAB, 0XA4AB, 0XACEC, 0XB50C, 0XB54C, 0XCD8E,
-  0XDE31, 0XDE92, 0XDEB2, 0XD670, 0XC5CD, 0XBD6C, 0XBD2B, 0XB52C,
-  0XBD6C, 0XBD4C, 0XC5CE, 0XCE2F, 0XCE50, 0XD692, 0XCE0F, 0XB56C,
-  0XA4EB, 0XB54B, 0XB56B, 0XB58C, 0XC5CE, 0XC5AD, 0XCDCD, 0XCE2F,
-  0XD690, 0XDED1, 0XDEF2, 0XD691, 0XC5EE, 0XBD8C, 0XB54C, 0XAD2B,
-  0XAD0B, 0XACEB, 0XAD0C, 0XAD0C, 0XB52D, 0XB56E, 0XAD2D, 0XAD0D,
-  0XAD2C, 0XB56D, 0XC5AF, 0XCE10, 0XD692, 0XCE51, 0XBD8E, 0X9C6A,
-  0X8BE9, 0X6B68, 0X7328, 0X9C2B, 0XB52E, 0XBD4F, 0XACCE, 0XB4EE,
-  0XA4CD, 0XB50F, 0XB50E, 0XC590, 0XCE11, 0XCE11, 0XC5B0, 0XB50F,
-  0XACAE, 0XA46D, 0X942B, 0X8C0A, 0X7BC9, 0X8C0A, 0XA48A, 0XBD4C,
-  0XCDAE, 0XCDD0, 0XB50E, 0X9C6C, 0XA4CD, 0XB4EE, 0XC54C, 0XC54C,
-  0XACAC, 0X9C4C, 0X942C, 0X942B, 0X8BEA, 0X8369, 0X7B28, 0X8BCA,
-  0XACCD, 0XC56F, 0XBD2E, 0XA48D, 0X9C2C, 0X940B, 0X838B, 0X948B,
-  0X940C, 0X8C4D, 0X8BAB, 0X8BAB, 0X8BEB, 0X8C0C, 0X83EA, 0X7B69,
-  0XA44C, 0XD610, 0XC5AE, 0XB50D, 0X9C4B, 0X8BEC, 0X93EC, 0X9CAE,
-  0X9C8E, 0X9CAD, 0XA4CD, 0XB50E, 0XACCD, 0X9C4B, 0X9BCB, 0XAC4C,
-  0X9BEA, 0X940A, 0X9C0B, 0X93EB, 0X8BCA, 0X940B, 0XAC8C, 0XBD0D,
-  0XBD2E, 0XACCC, 0X942A, 0X93EA, 0X8BC9, 0X93EC, 0X9C0A, 0X83A8,
-  0X8BC8, 0X8B87, 0X8BA8, 0X9C4A, 0XC58F, 0XC5B0, 0XC56F, 0XACAC,
-  0X942A, 0X8BEA, 0X9C0A, 0X93EA, 0X8BC9, 0X8BA8, 0X8367, 0X8346,
-  0X83A8, 0XB4CC, 0XC52E, 0XBCED, 0XBD0C, 0XB4CC, 0XA46B, 0X83A8,
-  0X93C9, 0X9BE9, 0X8387, 0XB48C, 0XC4EE, 0XACEB, 0XAD0B, 0XACEB,
-  0XB4ED, 0XC54E, 0XB4ED, 0XA48C, 0X9C4B, 0XB4ED, 0XCDF0, 0XC5CF,
-  0XB4ED, 0XBCEC, 0XC4EC, 0XB4CB, 0XB4EC, 0XBD6F, 0XCDB0, 0XBD0E,
-  0XA46B, 0XACAC, 0XB4CC, 0XACEB, 0XA46A, 0XBD0D, 0XCDD0, 0XCE10,
-  0XC58F, 0XACEC, 0X9C2B, 0X8BA9, 0X7B89, 0X8BC9, 0X944A, 0XA46B,
-  0XA44C, 0X9C6B, 0X9C8D, 0XB50E, 0XCDAF, 0XCE30, 0XD690, 0XC54E,
-  0XBCCD, 0XA42B, 0XB4CB, 0XA4AC, 0XA42C, 0XA46C, 0X9C2B, 0X9C2B,
-  0X9BCA, 0X940A, 0X8C0A, 0X840A, 0X8BCA, 0X940B, 0XA48D, 0XA48C,
-  0XA44C, 0XB52E, 0XC5F1, 0XC5F2, 0XBD70, 0XACEE, 0XACCE, 0X9C0C,
-  0XA42C, 0X93CB, 0X93EB, 0X9C2B, 0XA48D, 0X9C4C, 0XA44C, 0XA48D,
-  0XBCEE, 0XC570, 0XB56E, 0XBD0E, 0XB4CD, 0XB4AD, 0XAC8C, 0XAC8B,
-  0X9C2A, 0X9C0A, 0X9C6B, 0XA48B, 0XACAB, 0XB4EB, 0XBD4C, 0XCDAE,
-  0XD610, 0XDE73, 0XD691, 0XCE2F, 0XC5AC, 0XB54C, 0XB4EB, 0XB50B,
-  0XB50B, 0XB52C, 0XBD8D, 0XC5CE, 0XC5EE, 0XCE10, 0XC5CF, 0XAD0C,
-  0X9C6A, 0X9C89, 0XB54C, 0XBD6C, 0XBD8D, 0XC58E, 0XC5AD, 0XC5CE,
-  0XCE0E, 0XD690, 0XDEB1, 0XD62F, 0XBD6D, 0XB50B, 0XACEB, 0XB50C,
-  0XA4CB, 0X9C8B, 0X9C6B, 0XA4AC, 0XB50D, 0XB52E, 0XACED, 0XA4AC,
-  0XA4AB, 0XA4CC, 0XB52D, 0XCDF0, 0XCDF0, 0XC5D0, 0XAD0C, 0X8C6A,
-  0X83C9, 0X7B68, 0X7328, 0X93EA, 0XACCD, 0XB52E, 0XA4AD, 0XA46C,
-  0X9C4C, 0XA46D, 0XB50F, 0XC5B0, 0XCE11, 0XCDF1, 0XBD4F, 0XACAD,
-  0XA44D, 0X9C0C, 0X8BCA, 0X8389, 0X7BA9, 0X8BCA, 0XA46A, 0XBD2C,
-  0XC5AE, 0XC590, 0XB50E, 0XA4AD, 0XA48D, 0XB4ED, 0XBD0C, 0XBD0B,
-  0X9C8B, 0X9C2B, 0X940B, 0X93EB, 0X838A, 0X7B28, 0X7B48, 0X8BCA,
-  0XACAD, 0XBD6F, 0XB50E, 0X9C6C, 0X83AA, 0X8BAA, 0X7B49, 0X8C2C,
-  0X83AB, 0X8C2C, 0X8BCB, 0X8BAA, 0X8BEA, 0X83CA, 0X93CA, 0X93AA,
-  0XACAC, 0XCDCF, 0XC56D, 0XAC8B, 0X8BCB, 0X8B6A, 0X8BAB, 0X940C,
-  0X838B, 0X944C, 0X9C6C, 0XACEE, 0XACED, 0X8C4B, 0X8BCA, 0X9BEB,
-  0X93CA, 0X7B48, 0X93AB, 0X8BAA, 0X8B69, 0X8BEA, 0XACAD, 0XBD2E,
-  0XBD2E, 0XACAC, 0X940A, 0X8BEA, 0X8C0A, 0X940B, 0X93CA, 0X8368,
-  0X7B48, 0X7B47, 0X8BA8, 0XA44B, 0XC54E, 0XC58F, 0XBD4E, 0XACAC,
-  0X7B67, 0X8B88, 0X8BA9, 0X93EA, 0X8BE9, 0X93C9, 0X8387, 0X8387,
-  0X8387, 0X9C4B, 0XB4ED, 0XACCC, 0X9CAB, 0X9C6B, 0X9C0A, 0X9369,
-  0X9328, 0X9347, 0X8BC9, 0X9C4A, 0XA48B, 0X9C0A, 0X946A, 0X944A,
-  0XA46B, 0XACAC, 0XAC6C, 0XA44B, 0X9C4A, 0XB50D, 0XC5AF, 0XC58F,
-  0XB4EC, 0XBD0C, 0XBD0C, 0XBCED, 0XB4ED, 0XC54E, 0XC58F, 0XB4ED,
-  0XA46B, 0XA46B, 0XA46B, 0XA42A, 0XA44B, 0XB4ED, 0XCDD0, 0XC5D0,
-  0XBD6E, 0XA48C, 0X93AA, 0X8349, 0X6B28, 0X7346, 0X8BE9, 0XAC6C,
-  0X9C6A, 0X944B, 0X940B, 0XB4EE, 0XC5CF, 0XCE10, 0XCE0F, 0XB4ED,
-  0XA4AA, 0XAC8B, 0XACAB, 0XA4AC, 0XA42B, 0X9C4C, 0XA48D, 0XAC8C,
-  0X9C2B, 0X940A, 0XA40B, 0X940A, 0X8B89, 0X8BA8, 0X9C4C, 0XA44B,
-  0XA42C, 0XACEE, 0XBD90, 0XBD70, 0XBD30, 0XB4CE, 0XACAE, 0X9BCC,
-  0X93CA, 0X8B89, 0X938A, 0X8BCA, 0X9C0B, 0X93CA, 0X9BCB, 0XA4AD,
-  0XACAD, 0XBCEE, 0XBD4E, 0XBD4F, 0XC52E, 0XB4CD, 0XAC6C, 0XAC6B,
-  0X9C2B, 0X8BC9, 0X93EA, 0X9C2A, 0X944A, 0XA46A, 0XB4A9, 0XCD4B,
-  0XD5EE, 0XD651, 0XD650, 0XCE0E, 0XBD8C, 0XAD0B, 0X9429, 0X9409,
-  0XA48A, 0XB52C, 0XB54D, 0XB54D, 0XBD6E, 0XC58E, 0XC56E, 0XA48C,
-  0X83C9, 0X9429, 0XA48A, 0XACCA, 0XACEA, 0XB4EA, 0XB4EA, 0XB50C,
-  0XBD2D, 0XCDEE, 0XD62F, 0XCDCE, 0XB50C, 0XACCB, 0XA4AB, 0XA4AB,
-  0X942A, 0X940B, 0X93EB, 0X9C4C, 0XACCE, 0XB50E, 0XACCD, 0X9C4B,
-  0X8BEA, 0X942A, 0XA48B, 0XBD6E, 0XBD8F, 0XB54E, 0XA4AC, 0X942A,
-  0X8BC9, 0X7B68, 0X7348, 0X83A9, 0XA48C, 0XB50E, 0XACAD, 0X9C0B,
-  0X940B, 0X944C, 0XA4ED, 0XBD2F, 0XBD6F, 0XC56F, 0XBD2F, 0X9C0B,
-  0X93CA, 0X8BCA, 0X8369, 0X7329, 0X7328, 0X83A9, 0XA44A, 0XBCEC,
-  0XBD4E, 0XB50E, 0XA46C, 0X9C2B, 0X9C4C, 0XACAC, 0XB4AC, 0XACAB,
-  0X9C2A, 0X8BCA, 0X8BCA, 0X8BAB, 0X8B49, 0X7B29, 0X7B49, 0X8B89,
-  0XA46C, 0XBD2E, 0XB4ED, 0X9C4B, 0X83A9, 0X7B4A, 0X7B6A, 0X83CB,
-  0X836A, 0X7BCA, 0X834A, 0X8389, 0X93EA, 0X8BCA, 0X8369, 0X93CA,
-  0XACAC, 0XBD4D, 0XB4EC, 0X9C2B, 0X838A, 0X8369, 0X834A, 0X838A,
-  0X8BCB, 0X8BCA, 0X940B, 0XACAD, 0XA4AC, 0X8C0A, 0X83C9, 0X8B8A,
-  0X93AA, 0X8369, 0X8369, 0X7B69, 0X7B48, 0X93AA, 0XAC8C, 0XBD2E,
-  0XBD2E, 0XA46C, 0X93CA, 0X8BCA, 0X93EA, 0X93CB, 0X8BCB, 0X8369,
-  0X8349, 0X8348, 0X8347, 0X93C9, 0XB4ED, 0XC56E, 0XBD2E, 0XA46B,
-  0X93C9, 0X8368, 0X8B68, 0X8BA9, 0X8BC9, 0X8BA9, 0X8368, 0X7B26,
-  0X8347, 0X8BA9, 0XA46C, 0XB4AD, 0XAC8C, 0X9C0A, 0X8B88, 0X8348,
-  0X8308, 0X8327, 0X7B88, 0X7BC9, 0X8388, 0X93CA, 0X9C0A, 0X8B88,
-  0XA40B, 0XB46C, 0XAC2B, 0X9C2A, 0X9C2A, 0XB4ED, 0XC56F, 0XBD4E,
-  0XACCC, 0XB4AB, 0XB4AC, 0XB4CD, 0XB4CC, 0XB50D, 0XBD2E, 0XACAD,
-  0XA44B, 0X9C0A, 0X9C2A, 0X93E9, 0X9C0A, 0XACCC, 0XBD8F, 0XBD8F,
-  0XB50D, 0X9C2C, 0X8B69, 0X7B2A, 0X62C5, 0X7305, 0X8BA7, 0X93E7,
-  0X944A, 0X944A, 0X9C2B, 0XACAC, 0XC58E, 0XCE0F, 0XC54E, 0XACAD,
-  0XAC8B, 0XAC4B, 0XA44A, 0X9C2C, 0X9C0B, 0X9C4C, 0XACAD, 0XB4CD,
-  0XA46C, 0X942A, 0X93E9, 0X83C8, 0X8B89, 0X9BCA, 0X940B, 0X9C0B,
-  0X93CB, 0XA48D, 0XB54F, 0XB52F, 0XACCE, 0X9C4C, 0X93CC, 0X93CC,
-  0X83AA, 0X8389, 0X8328, 0X8349, 0X8B89, 0X7B28, 0X93AA, 0X93CA,
-  0XAC8D, 0XBCED, 0XBD6E, 0XB52E, 0XBD0E, 0XACCD, 0XA44B, 0X9C2B,
-  0X9C0A, 0X8BC9, 0X8BE9, 0X93C9, 0X8BC8, 0X9C09, 0XAC28, 0XC4EB,
-  0XC56D, 0XCDCF, 0XCDEF, 0XC5CE, 0XB50C, 0XA48A, 0X9408, 0X7B08,
-  0X9BC9, 0XB4AB, 0XACEB, 0XAD0B, 0XB52D, 0XBD6E, 0XB4ED, 0X944A,
-  0X83A8, 0X8BA9, 0X9409, 0X9C49, 0XA469, 0XA469, 0XA469, 0XACAB,
-  0XB4EC, 0XC5AE, 0XCDEE, 0XBD6D, 0XA4AB, 0X944A, 0X8C2A, 0X8BE9,
-  0X8BC9, 0X8BAA, 0X8BAA, 0X93EB, 0XA48C, 0XACCD, 0XA46C, 0X940A,
-  0X8BC9, 0X83C9, 0X9C4B, 0XACCD, 0XB52E, 0XACCD, 0XA48B, 0X942A,
-  0X8BCA, 0X7B68, 0X7B28, 0X7B28, 0X940B, 0XA48D, 0XA48D, 0X9C2C,
-  0X940B, 0X940B, 0X942B, 0XA48C, 0XACCD, 0XB4EE, 0XBCEE, 0X9C2B,
-  0X8BCA, 0X8BA9, 0X7B49, 0X7B49, 0X7B48, 0X8BA9, 0XA42A, 0XB4CB,
-  0XB4ED, 0XACAD, 0X940C, 0X8BAB, 0X9C2B, 0XA46C, 0XAC6C, 0X9C4B,
-  0X93CA, 0X83AA, 0X8369, 0X7B69, 0X72E8, 0X72E7, 0X7308, 0X7B49,
-  0X9C0B, 0XB4CC, 0XB4EC, 0XA44A, 0X8369, 0X7B4A, 0X7B29, 0X83AA,
-  0X8B4A, 0X83A9, 0X834A, 0X8369, 0X8BA9, 0X8389, 0X7AE8, 0X8BCA,
-  0XAC8C, 0XACAC, 0X9C2B, 0X838A, 0X7B4A, 0X7B29, 0X7AE9, 0X8329,
-  0X8BAB, 0X8BC9, 0X93EB, 0XA44C, 0X9C6C, 0X942A, 0X7BA9, 0X7B49,
-  0X8B2A, 0X8329, 0X7B08, 0X6AE7, 0X7328, 0X8BA9, 0X9C4B, 0XACAD,
-  0XACCD, 0XA44B, 0X8BA9, 0X8B8A, 0X8BA9, 0X8BAB, 0X8369, 0X7B28,
-  0X72E7, 0X7307, 0X7AC7, 0X93AA, 0XB4AD, 0XBD4E, 0XBCEE, 0XA42B,
-  0X8B69, 0X72E7, 0X7306, 0X8388, 0X8348, 0X8348, 0X7B48, 0X6AE6,
-  0X6AE6, 0X7347, 0X93EA, 0XACAC, 0XB4CD, 0X9C2A, 0X8348, 0X7AE6,
-  0X7B07, 0X7306, 0X7B26, 0X7B26, 0X8306, 0X8B68, 0X93A9, 0X93E9,
-  0X940A, 0XA44B, 0X9C0A, 0X93C9, 0X9C0A, 0XAC8C, 0XBD4E, 0XB50D,
-  0XA46B, 0XA42A, 0XA44A, 0XAC6B, 0XACAD, 0XB4EE, 0XACCD, 0XACCD,
-  0XA46B, 0X93E9, 0X93E9, 0X8B88, 0X93E9, 0XACAC, 0XB54E, 0XB54E,
-  0XACCD, 0X9C4C, 0X7B4A, 0X6AA6, 0X6AC4, 0X8345, 0X9BA7, 0X93A7,
-  0X93E8, 0X8C09, 0X940B, 0XA44B, 0XBD0D, 0XC5AE, 0XBD2D, 0XA42B,
-  0X93C9, 0X93A9, 0X93CA, 0X9BCB, 0X9BCB, 0X9C0B, 0XB4AD, 0XB4AD,
-  0XA46B, 0X9C2A, 0X8BC9, 0X8BA8, 0X8B69, 0X93C9, 0X8BCA, 0X8B8A,
-  0X7B48, 0X9C4B, 0XACEE, 0XACEE, 0XA48D, 0X93CB, 0X8BCC, 0X8B6B,
-  0X8369, 0X7328, 0X72E7, 0X72E7, 0X7B08, 0X8328, 0X8B69, 0X93CA,
-  0XA46C, 0XB4CD, 0XBCED, 0XB4ED, 0XACAD, 0XA46C, 0X9C2B, 0X93EA,
-  0X93EA, 0X93CA, 0X8BEA, 0X8BA9, 0X93A8, 0X9BA8, 0XA3E8, 0XB429,
-  0XBCCB, 0XBD4E, 0XBD6E, 0XBD8E, 0XACAC, 0XA46A, 0X93E8, 0X8328,
-  0X7AC8, 0X9BEA, 0XAC8B, 0XACEB, 0XB52C, 0XBD2E, 0XA44B, 0X8BEA,
-  0X83C9, 0X83C9, 0X8BC8, 0X9409, 0X9C29, 0X93E8, 0X9C09, 0X9429,
-  0XA4AB, 0XBD2D, 0XC58D, 0XB50D, 0X9C4B, 0X8BE9, 0X83A9, 0X7B68,
-  0X7B48, 0X7B28, 0X8369, 0X8B8A, 0X940B, 0X9C4C, 0X93CB, 0X8BAA,
-  0X8389, 0X8BA9, 0X940A, 0XACAC, 0XB50E, 0XAC8D, 0X9C2B, 0X8BCA,
-  0X8BA9, 0X7B68, 0X7308, 0X7308, 0X8BAA, 0X9C2B, 0X9C2B, 0X8BEB,
-  0X8BAA, 0X8BAA, 0X8B8A, 0X93EB, 0X9C2B, 0XA46C, 0XA46C, 0X9C2B,
-  0X8BAA, 0X836A, 0X7B49, 0X7B49, 0X7B49, 0X8389, 0X9C0A, 0XAC8B,
-  0XAC8C, 0X9C2B, 0X8BCA, 0X8BAA, 0X8C0B, 0X9C0B, 0X8BCA, 0X93CA,
-  0X8B49, 0X7B68, 0X8368, 0X7B49, 0X7B49, 0X7308, 0X6AE8, 0X7B08,
-  0X8BAA, 0XA44B, 0XB4AB, 0XA42A, 0X8389, 0X7309, 0X7309, 0X7309,
-  0X7329, 0X7B29, 0X7328, 0X5AA6, 0X7B27, 0X8348, 0X72E7, 0X8B89,
-  0XA44B, 0X9C2B, 0X8BAA, 0X7B29, 0X7309, 0X7308, 0X7AC8, 0X72C8,
-  0X83AA, 0X83A9, 0X8BCA, 0X9C0B, 0X9C2C, 0X8BCA, 0X7B49, 0X7308,
-  0X7AE8, 0X7AE9, 0X72C7, 0X6266, 0X6AC7, 0X7B48, 0X8BC9, 0XA44C,
-  0XA46C, 0XA40B, 0X8B89, 0X7B48, 0X8349, 0X8389, 0X7B29, 0X7B08,
-  0X72C7, 0X6A86, 0X8308, 0X93AA, 0XA44C, 0XB4CD, 0XB48C, 0X9BEA,
-  0X8348, 0X6A86, 0X7B07, 0X7B48, 0X7B48, 0X7327, 0X7306, 0X7306,
-  0X6AE6, 0X6AE5, 0X8389, 0XA46C, 0XB4ED, 0XA44B, 0X7B28, 0X6AC6,
-  0X72E7, 0X6AC5, 0X7306, 0X6AE5, 0X7B06, 0X62A3, 0X8B68, 0X9C0A,
-  0X9BCA, 0X9BEA, 0X93C9, 0X9388, 0X9C0A, 0XAC6C, 0XB4ED, 0XACCD,
-  0X9C0A, 0X8389, 0X8388, 0XA42B, 0X9C4C, 0XACAD, 0XA46D, 0XA44C,
-  0X9C2B, 0X93C9, 0X8B68, 0X8B68, 0X8B88, 0X9C4B, 0XACED, 0XB52E,
-  0XA48D, 0X8BAB, 0X7B08, 0X72A5, 0X6AC5, 0X7B25, 0X8B26, 0X7B06,
-  0X7B26, 0X7B67, 0X83A8, 0X93E9, 0XBCCC, 0XBD4D, 0XB4EC, 0XA42A,
-  0X8B88, 0X8B67, 0X938A, 0X9B8B, 0X93AA, 0X93CA, 0XAC6C, 0XA46C,
-  0X940A, 0X8BC9, 0X8B88, 0X8368, 0X8348, 0X8BA8, 0X8BA9, 0X8348,
-  0X8368, 0X83EA, 0X9C8C, 0X9C8D, 0X8C2B, 0X838A, 0X5287, 0X72E7,
-  0X6AE7, 0X6AE7, 0X72C7, 0X72C6, 0X72E7, 0X7AE8, 0X7B28, 0X8369,
-  0X8BEA, 0XAC6C, 0XAC8D, 0XB4AD, 0XA46C, 0X9C0A, 0X83A9, 0X7B88,
-  0X8BA9, 0X8BA9, 0X8389, 0X7B68, 0X8348, 0X9B88, 0XA3C8, 0XA3C9,
-  0XB48C, 0XB4CD, 0XB52E, 0XACED, 0XA46B, 0X93E9, 0X8B88, 0X7B27,
-  0X72C7, 0X8348, 0X9C0A, 0XA46B, 0XAC6C, 0XA44A, 0X9C0A, 0X8348,
-  0X7B48, 0X8368, 0X8388, 0X8BA8, 0X8BC8, 0X8BA8, 0X8368, 0X8348,
-  0X940A, 0XB4CB, 0XB50C, 0XAC8B, 0X8BC9, 0X8368, 0X7B48, 0X7327,
-  0X6AE6, 0X6AA6, 0X7B08, 0X7B48, 0X8369, 0X8369, 0X8348, 0X7B27,
-  0X7B47, 0X8369, 0X8BCA, 0XA44C, 0XACAD, 0XA46C, 0X8BCA, 0X93CA,
-  0X83A9, 0X7B48, 0X7307, 0X7307, 0X7328, 0X8369, 0X8369, 0X8369,
-  0X8369, 0X836A, 0X7B29, 0X8369, 0X8B8A, 0X93EB, 0X93EB, 0X8BCA,
-  0X838A, 0X7B69, 0X7B69, 0X7B49, 0X7B29, 0X8368, 0X93A8, 0XAC6A,
-  0X9C0A, 0X8389, 0X7B49, 0X7B49, 0X8B8A, 0X838A, 0X83AA, 0X8349,
-  0X7B28, 0X8348, 0X7B28, 0X7328, 0X7308, 0X6AC7, 0X6AA7, 0X6AA7,
-  0X6AE8, 0X8369, 0X93E9, 0X8BC9, 0X8369, 0X72E8, 0X6AC8, 0X72E9,
-  0X62A7, 0X6267, 0X62A6, 0X6A85, 0X72E7, 0X72E7, 0X6AE6, 0X8349,
-  0X93EA, 0X93EA, 0X8B8A, 0X7308, 0X7308, 0X7308, 0X72E8, 0X6AE8,
-  0X7328, 0X7B69, 0X8389, 0X93EA, 0X93EA, 0X836A, 0X7309, 0X62C8,
-  0X72C9, 0X6A87, 0X6266, 0X6266, 0X6266, 0X72E7, 0X7B28, 0X93CA,
-  0X9C0B, 0X93CA, 0X8328, 0X7B07, 0X7308, 0X7B48, 0X6B08, 0X72E8,
-  0X72A7, 0X6246, 0X7AE7, 0X8B69, 0X9C0B, 0XAC8C, 0X9C0B, 0X8368,
-  0X7B08, 0X72E6, 0X7B27, 0X7B27, 0X7B27, 0X7306, 0X6AE6, 0X7306,
-  0X6AC5, 0X6AE5, 0X7B48, 0X940B, 0XA46C, 0X93EB, 0X72E8, 0X6286,
-  0X6A86, 0X6A86, 0X72C6, 0X6AC6, 0X72E6, 0X6AA5, 0X8327, 0X9389,
-  0X9389, 0X8B68, 0X9388, 0X9388, 0X8BA9, 0X9C2B, 0XA48C, 0X9C4B,
-  0X8BC9, 0X7B27, 0X8BA9, 0X9C0B, 0X9C2B, 0X9C2B, 0X9C0B, 0XA44C,
-  0X9BEB, 0X8B49, 0X8308, 0X8328, 0X8368, 0X93EA, 0XA4AC, 0XACAD,
-  0X940B, 0X7B49, 0X72C7, 0X6285, 0X6243, 0X6284, 0X6264, 0X6284,
-  0X6AC5, 0X6B07, 0X6B27, 0X8B89, 0XA44B, 0XB50C, 0XACAB, 0X9BE9,
-  0X8347, 0X8368, 0X8B88, 0X8B8A, 0X8329, 0X8B8A, 0X9C2B, 0X9C2B,
-  0X93EA, 0X8368, 0X8347, 0X7306, 0X7B07, 0X7B27, 0X7B27, 0X8348,
-  0X7B28, 0X8369, 0X8C0B, 0X942B, 0X8BEB, 0X8389, 0X6AA7, 0X6AA6,
-  0X62C7, 0X6AC7, 0X6AA7, 0X6AC6, 0X7AE7, 0X6286, 0X72C7, 0X7B07,
-  0X8B8A, 0X9C0B, 0XA42C, 0XA44C, 0X9C2B, 0X8BAA, 0X8349, 0X7328,
-  0X8369, 0X8389, 0X8368, 0X7B28, 0X8328, 0X9347, 0X9B68, 0X9B88,
-  0XA40A, 0XAC8C, 0XACCC, 0XA48C, 0X9C2A, 0X83A8, 0X8348, 0X7B07,
-  0X72C5, 0X9BCA, 0X7B68, 0X93EA, 0X8B89, 0X93C9, 0X8B88, 0X7B27,
-  0X6AC7, 0X8328, 0X7B28, 0X8348, 0X8367, 0X8368, 0X7B27, 0X7B48,
-  0X8BA9, 0XA44A, 0XACAB, 0X9C4B, 0X83A9, 0X7328, 0X62C7, 0X6AC7,
-  0X6286, 0X6AC6, 0X7307, 0X7307, 0X7307, 0X7307, 0X6AE5, 0X6AE5,
-  0X6B06, 0X7327, 0X8368, 0X93EA, 0X9C2B, 0X93EB, 0X8BAA, 0X8389,
-  0X8369, 0X7B28, 0X72E8, 0X6AC7, 0X72E7, 0X7307, 0X6B07, 0X7308,
-  0X7B28, 0X7B49, 0X7B08, 0X7328, 0X7328, 0X7B28, 0X7B28, 0X8389,
-  0X7B48, 0X7B28, 0X7B28, 0X7308, 0X7B49, 0X8368, 0X93C8, 0X9C09,
-  0X9BEA, 0X7B68, 0X72E8, 0X72E8, 0X7309, 0X7309, 0X8BAB, 0X7B29,
-  0X6AE7, 0X7AE7, 0X72E7, 0X6AA6, 0X6AC7, 0X6286, 0X6266, 0X6287,
-  0X6287, 0X6AC7, 0X7308, 0X7B28, 0X7B08, 0X6AC8, 0X72E8, 0X72C8,
-  0X6267, 0X5A66, 0X5265, 0X6265, 0X6AA6, 0X62A6, 0X6AA6, 0X7B28,
-  0X8B89, 0X8BCA, 0X8369, 0X7B08, 0X72C7, 0X7307, 0X6AE7, 0X62A7,
-  0X6AE7, 0X7328, 0X7B49, 0X8BA9, 0X93CA, 0X8389, 0X72E8, 0X6A87,
-  0X6A87, 0X6A87, 0X5A46, 0X5225, 0X6246, 0X5A66, 0X72E7, 0X8389,
-  0X8BCA, 0X8369, 0X72E7, 0X6A66, 0X6AA7, 0X6AA7, 0X62A7, 0X62A6,
-  0X6266, 0X5A46, 0X5A65, 0X7B28, 0X93CA, 0XA42B, 0X8BCA, 0X7B28,
-  0X72C7, 0X72E7, 0X62C6, 0X7B47, 0X6AE6, 0X6AC5, 0X6AC6, 0X6AA5,
-  0X6AC5, 0X62A5, 0X7307, 0X8BA9, 0X93CA, 0X938A, 0X6266, 0X6266,
-  0X6246, 0X6265, 0X6A86, 0X6A85, 0X6265, 0X6284, 0X72E6, 0X8368,
-  0X8389, 0X7B48, 0X8368, 0X8B89, 0X8BA9, 0X8B89, 0X8B89, 0X8369,
-  0X7B08, 0X6AE8, 0X7308, 0X8B8A, 0X9C2B, 0X93EA, 0X93AA, 0X93AA,
-  0X9BAB, 0X8308, 0X8307, 0X7B07, 0X7327, 0X83A9, 0XA44C, 0X9C6C,
-  0X8BAA, 0X72E8, 0X6285, 0X6244, 0X6203, 0X5223, 0X4A03, 0X5A23,
-  0X5A24, 0X6AC7, 0X6AE7, 0X7B28, 0X93CA, 0XA46B, 0X9C2A, 0X8388,
-  0X7B07, 0X7326, 0X7B27, 0X7B07, 0X72E7, 0X7B28, 0X93AA, 0X93CA,
-  0X8B88, 0X8348, 0X7B07, 0X6AA6, 0X6A66, 0X72A7, 0X6AA7, 0X72C7,
-  0X6AA7, 0X7B28, 0X8389, 0X83CA, 0X8389, 0X7B07, 0X62A7, 0X6A67,
-  0X6AA6, 0X6A87, 0X6A86, 0X6A86, 0X6AA5, 0X6285, 0X62A7, 0X72C7,
-  0X7B28, 0X8B89, 0X93CA, 0X93CA, 0X8BAA, 0X8349, 0X7AE8, 0X7B08,
-  0X7B28, 0X7B28, 0X7307, 0X72E7, 0X72E6, 0X8327, 0X8B27, 0X8B48,
-  0X9BC9, 0X9C2B, 0XA46B, 0X9C4B, 0X9409, 0X8367, 0X7B07, 0X72E6,
-  0X6AC6, 0X7B27, 0X7B67, 0X8BA9, 0X8348, 0X8B69, 0X6285, 0X6A85,
-  0X72E7, 0X8328, 0X7B28, 0X7B07, 0X7B27, 0X7B27, 0X7B27, 0X6B07,
-  0X8388, 0X9409, 0XA44B, 0X9C2B, 0X8BA9, 0X7307, 0X62A6, 0X6286,
-  0X6265, 0X6286, 0X6AC6, 0X6AC7, 0X6AC7, 0X72E7, 0X62A5, 0X6285,
-  0X6AC6, 0X6AC6, 0X72C7, 0X8348, 0X8B89, 0X8389, 0X7B48, 0X7B48,
-  0X7B48, 0X72E7, 0X6AC7, 0X6286, 0X6AC7, 0X72E7, 0X6AE7, 0X6AC7,
-  0X7308, 0X7308, 0X72E8, 0X72E8, 0X6AE7, 0X6AE7, 0X6B08, 0X7B49,
-  0X6AE6, 0X72E7, 0X7B08, 0X6AE7, 0X7308, 0X7B48, 0X8388, 0X8B88,
-  0X8348, 0X7B28, 0X72C8, 0X6AA7, 0X6AA7, 0X6AE8, 0X72E8, 0X6AA7,
-  0X6286, 0X6286, 0X6286, 0X5A45, 0X6246, 0X5A26, 0X5A25, 0X5A25,
-  0X5A45, 0X6266, 0X6286, 0X72C7, 0X72E8, 0X7AE8, 0X6AC7, 0X6AC7,
-  0X6286, 0X5A66, 0X5A65, 0X6286, 0X6A86, 0X6285, 0X6A86, 0X72E7,
-  0X8B89, 0X8B8A, 0X8349, 0X72C7, 0X6AA6, 0X6AA6, 0X6286, 0X5A46,
-  0X6266, 0X6B08, 0X7B28, 0X8389, 0X8389, 0X8369, 0X7B08, 0X6266,
-  0X5A26, 0X6247, 0X5A06, 0X4205, 0X5246, 0X6266, 0X6AC7, 0X8349,
-  0X8389, 0X7B28, 0X6AA7, 0X6A86, 0X6266, 0X6266, 0X6246, 0X5A25,
-  0X5A45, 0X5204, 0X5224, 0X72E7, 0X8B89, 0X9C0A, 0X8B69, 0X7AE8,
-  0X6A66, 0X5A25, 0X6246, 0X6286, 0X6AA6, 0X6285, 0X5284, 0X5A64,
-  0X5A64, 0X6285, 0X72E7, 0X7B48, 0X8349, 0X7AE8, 0X5A25, 0X51C5,
-  0X51E5, 0X4A04, 0X6AC6, 0X62C5, 0X5A64, 0X5A44, 0X6265, 0X7B29,
-  0X7B49, 0X7B08, 0X72E7, 0X7B28, 0X7B28, 0X72E7, 0X6AC7, 0X6AC7,
-  0X6AC7, 0X6286, 0X72E7, 0X8349, 0X8BAA, 0X8BAA, 0X8B69, 0X8328,
-  0X8307, 0X7AE7, 0X72C7, 0X6AC7, 0X6AC7, 0X8369, 0X940B, 0X940B,
-  0X8369, 0X6A86, 0X51E4, 0X5A25, 0X5223, 0X49E2, 0X5203, 0X49E3,
-  0X41C3, 0X5266, 0X5265, 0X6AC7, 0X8389, 0X9C0A, 0X8BEA, 0X7348,
-  0X6AC6, 0X5A84, 0X6A86, 0X6AC6, 0X6AC6, 0X72C7, 0X7B28, 0X7B28,
-  0X72E7, 0X7306, 0X6A85, 0X6A85, 0X6A47, 0X6A46, 0X6246, 0X6246,
-  0X5A46, 0X6286, 0X7308, 0X7B49, 0X7308, 0X6AC7, 0X6266, 0X5A05,
-  0X6246, 0X6286, 0X6266, 0X6286, 0X6265, 0X5A44, 0X5245, 0X5245,
-  0X6A86, 0X72E8, 0X7B28, 0X8369, 0X8349, 0X72E7, 0X6A86, 0X72C7,
-  0X6AE7, 0X6AC7, 0X72A7, 0X6AC6, 0X72C6, 0X72E6, 0X72C6, 0X7AE7,
-  0X7B27, 0X93C9, 0X940A, 0X940A, 0X8BC9, 0X7B47, 0X72E6, 0X6AC6,
-  0X6AC6, 0X72E6, 0X7B47, 0X7B67, 0X7B47, 0X72E7, 0X6A85, 0X6A86,
-  0X6265, 0X72C7, 0X6AA6, 0X6AA6, 0X72C6, 0X6AA6, 0X6285, 0X6AC6,
-  0X7B28, 0X8B88, 0X93C9, 0X93E9, 0X8348, 0X6AC6, 0X6265, 0X5A45,
-  0X5A45, 0X5A65, 0X5A65, 0X62A6, 0X6286, 0X62A6, 0X6286, 0X6266,
-  0X6A86, 0X62A6, 0X62A6, 0X6AC6, 0X7307, 0X7307, 0X6AE7, 0X6AE7,
-  0X7B28, 0X6AC7, 0X6286, 0X6286, 0X6AA7, 0X6286, 0X6286, 0X6AA7,
-  0X6AC7, 0X6AC7, 0X6AC7, 0X62C7, 0X62A6, 0X62A6, 0X72E7, 0X6AC6,
-  0X6A85, 0X6AA6, 0X62A7, 0X6AC7, 0X6AC7, 0X6287, 0X6AC7, 0X72C7,
-  0X6A87, 0X6287, 0X6267, 0X6266, 0X5A45, 0X5A44, 0X5224, 0X5224,
-  0X49E3, 0X5204, 0X5224, 0X49E3, 0X49E3, 0X51E4, 0X5205, 0X5205,
-  0X5205, 0X5204, 0X5A44, 0X6286, 0X6AA7, 0X72C7, 0X6AA6, 0X6AA7,
-  0X6AA7, 0X6266, 0X5A46, 0X6266, 0X6266, 0X6246, 0X6A87, 0X72C8,
-  0X7B49, 0X8B49, 0X7B08, 0X72A7, 0X6A66, 0X5A46, 0X5A25, 0X5225,
-  0X5245, 0X5A66, 0X6AC7, 0X7308, 0X72E7, 0X72C7, 0X72C8, 0X6266,
-  0X5A26, 0X6246, 0X5A05, 0X4184, 0X49E5, 0X4A25, 0X6266, 0X72E7,
-  0X7B48, 0X7308, 0X6266, 0X6246, 0X5A25, 0X5A25, 0X5205, 0X51E5,
-  0X49A3, 0X51C3, 0X5A04, 0X72A7, 0X8349, 0X8B89, 0X8348, 0X72C7,
-  0X6245, 0X51E4, 0X5A25, 0X5A45, 0X5A25, 0X5A45, 0X5A24, 0X5A24,
-  0X5204, 0X5204, 0X5A65, 0X6AA6, 0X6A86, 0X6A67, 0X51E5, 0X49A4,
-  0X59E5, 0X51E5, 0X6266, 0X5A45, 0X5204, 0X51E4, 0X5A24, 0X6A86,
-  0X7308, 0X72E7, 0X6AE7, 0X6B07, 0X7328, 0X62C6, 0X6286, 0X6246,
-  0X5A45, 0X5204, 0X6AA7, 0X7B28, 0X8369, 0X836A, 0X7B08, 0X72E7,
-  0X6AA6, 0X6AA7, 0X6AC8, 0X6286, 0X6A87, 0X7328, 0X8BAA, 0X8BAA,
-  0X7328, 0X5A45, 0X49C3, 0X49E3, 0X4A03, 0X4A03, 0X5204, 0X49A3,
-  0X3942, 0X4A24, 0X5A45, 0X6266, 0X7B28, 0X83A9, 0X8369, 0X6B07,
-  0X5264, 0X5223, 0X5A04, 0X5A44, 0X5224, 0X5225, 0X6266, 0X5265,
-  0X5204, 0X5A64, 0X5A43, 0X5A45, 0X5A05, 0X5A05, 0X5A05, 0X5A05,
-  0X49A4, 0X5205, 0X6287, 0X62C7, 0X62A7, 0X6266, 0X5A26, 0X51C4,
-  0X5A04, 0X5A44, 0X5A65, 0X5A46, 0X5A46, 0X51C3, 0X49C4, 0X49E5,
-  0X5A25, 0X6287, 0X72E8, 0X7B08, 0X72E7, 0X6286, 0X5A66, 0X6226,
-  0X6A66, 0X6A86, 0X6A66, 0X6266, 0X6286, 0X6A86, 0X6A86, 0X6A86,
-  0X6AA6, 0X7B47, 0X8388, 0X8388, 0X8348, 0X7307, 0X6AC5, 0X62C5,
-  0X6285, 0X6285, 0X6AA6, 0X6AE6, 0X6AC6, 0X62A6, 0X6286, 0X6265,
-  0X6286, 0X5A45, 0X5225, 0X6285, 0X6266, 0X5225, 0X5A45, 0X5A45,
-  0X6286, 0X7307, 0X7B27, 0X7B08, 0X72E7, 0X6265, 0X5204, 0X49C3,
-  0X51E4, 0X5224, 0X5A45, 0X5A66, 0X5A65, 0X5A66, 0X6286, 0X5A86,
-  0X5A86, 0X5AA6, 0X5A85, 0X6266, 0X6AA6, 0X6AA6, 0X6266, 0X62A6,
-  0X62A7, 0X6266, 0X6246, 0X5A46, 0X6266, 0X6266, 0X5225, 0X5A66,
-  0X62A7, 0X5285, 0X62C6, 0X5265, 0X5245, 0X5A45, 0X6A86, 0X5A65,
-  0X5245, 0X5A65, 0X6266, 0X6286, 0X6286, 0X5A46, 0X5205, 0X51E5,
-  0X5A05, 0X5204, 0X5204, 0X5A25, 0X49E3, 0X41C2, 0X41C2, 0X41C2,
-  0X49C3, 0X49C3, 0X49C2, 0X4181, 0X49A4, 0X41C3, 0X49C2, 0X41A3,
-  0X49C4, 0X49E4, 0X51E3, 0X5224, 0X5A45, 0X6266, 0X6246, 0X6266,
-  0X6A66, 0X5A06, 0X51E5, 0X5A05, 0X6226, 0X6246, 0X6267, 0X6A87,
-  0X6A87, 0X72A7, 0X6A87, 0X6246, 0X5205, 0X5205, 0X6225, 0X5204,
-  0X49E4, 0X49C4, 0X5225, 0X5A46, 0X5A25, 0X6226, 0X6226, 0X5A46,
-  0X51E5, 0X51E5, 0X49A4, 0X4183, 0X3963, 0X41A3, 0X49E4, 0X5A65,
-  0X6286, 0X6266, 0X5205, 0X49C4, 0X51C4, 0X49C4, 0X41A3, 0X4183,
-  0X3983, 0X49A3, 0X51C3, 0X6245, 0X72C7, 0X8309, 0X7AE8, 0X6266,
-  0X49E4, 0X49A3, 0X49C3, 0X51E4, 0X51E4, 0X51E4, 0X51E4, 0X51E4,
-  0X49C3, 0X41A2, 0X49E3, 0X49C4, 0X51E4, 0X51E4, 0X51C4, 0X49A3,
-  0X51E4, 0X49C4, 0X51E4, 0X49C4, 0X49C4, 0X41C2, 0X49C3, 0X5204,
-  0X6266, 0X6265, 0X6286, 0X6A86, 0X6266, 0X5A25, 0X5A24, 0X5204,
-  0X6245, 0X5205, 0X5A66, 0X6AC7, 0X72E8, 0X72E8, 0X6AA8, 0X5A66,
-  0X6245, 0X5A45, 0X5A45, 0X5A65, 0X6286, 0X6AC7, 0X7B48, 0X7B68,
-  0X6AC7, 0X49C4, 0X4162, 0X41A2, 0X41A2, 0X49C3, 0X4163, 0X3922,
-  0X4183, 0X41C3, 0X49C4, 0X5A25, 0X62A6, 0X6AE7, 0X72E7, 0X6286,
-  0X49E3, 0X41C2, 0X49E2, 0X49E3, 0X4162, 0X4183, 0X41C3, 0X3982,
-  0X4182, 0X49C2, 0X5203, 0X51A4, 0X51C5, 0X51C4, 0X4983, 0X4984,
-  0X49A4, 0X41C4, 0X5205, 0X5A46, 0X5225, 0X51E4, 0X41A2, 0X3963,
-  0X49A3, 0X5A04, 0X4A24, 0X5225, 0X41C4, 0X3921, 0X3941, 0X49C4,
-  0X51E4, 0X5A45, 0X6AA7, 0X6AA6, 0X6266, 0X5A25, 0X4A05, 0X5205,
-  0X5A25, 0X5225, 0X5205, 0X5A45, 0X5A45, 0X5A25, 0X5A45, 0X5A04,
-  0X5224, 0X6285, 0X72E6, 0X7307, 0X72E6, 0X6AC6, 0X6285, 0X5A84,
-  0X5244, 0X5A44, 0X6265, 0X6285, 0X5A45, 0X5A25, 0X5A25, 0X5A25,
-  0X5A25, 0X6245, 0X5224, 0X5204, 0X51E3, 0X51E4, 0X49C2, 0X4A04,
-  0X5224, 0X6286, 0X6286, 0X6265, 0X5A65, 0X5A25, 0X49E4, 0X49A3,
-  0X49A4, 0X51E4, 0X5205, 0X5225, 0X5245, 0X5265, 0X5265, 0X5265,
-  0X5A86, 0X5245, 0X5A45, 0X6245, 0X6245, 0X6245, 0X5204, 0X5A45,
-  0X6266, 0X5A25, 0X5A25, 0X5205, 0X5A05, 0X5225, 0X5205, 0X5246,
-  0X5245, 0X5245, 0X4A04, 0X51E4, 0X49A3, 0X49C3, 0X5204, 0X5245,
-  0X5204, 0X5205, 0X5245, 0X5A66, 0X5205, 0X49E4, 0X49A3, 0X4983,
-  0X49A3, 0X4182, 0X4162, 0X4982, 0X49A2, 0X3940, 0X3981, 0X3981,
-  0X41C2, 0X41A1, 0X41A2, 0X31A1, 0X49C3, 0X4182, 0X4163, 0X3942,
-  0X4163, 0X49A4, 0X51E5, 0X49C5, 0X51E5, 0X5A26, 0X5A05, 0X6246,
-  0X5205, 0X5205, 0X49C4, 0X49E4, 0X5A25, 0X5A46, 0X5A26, 0X5A26,
-  0X5A26, 0X6226, 0X5A25, 0X49C4, 0X51E4, 0X5204, 0X49E4, 0X41C4,
-  0X39A3, 0X41A4, 0X41C4, 0X41A4, 0X4184, 0X49A4, 0X59E5, 0X51E5,
-  0X49A5, 0X3983, 0X3963, 0X3943, 0X2901, 0X3942, 0X3962, 0X41A3,
-  0X41C3, 0X49E4, 0X4183, 0X3142, 0X3142, 0X3963, 0X3942, 0X3942,
-  0X3963, 0X3141, 0X3962, 0X49C3, 0X6246, 0X6A66, 0X6246, 0X51E5,
-  0X4183, 0X4162, 0X4983, 0X49A3, 0X4983, 0X4184, 0X4163, 0X4163,
-  0X3942, 0X4182, 0X3962, 0X3962, 0X3962, 0X3962, 0X4182, 0X3962,
-  0X3982, 0X3962, 0X49A3, 0X4183, 0X4183, 0X4181, 0X49A3, 0X51C4,
-  0X51C4, 0X49C4, 0X5A05, 0X5A05, 0X5A05, 0X49C4, 0X41C3, 0X51E4,
-  0X51E5, 0X49E4, 0X5205, 0X6AA7, 0X5A66, 0X62A7, 0X5A67, 0X5205,
-  0X5205, 0X4A05, 0X5225, 0X5225, 0X5204, 0X6286, 0X6AE7, 0X6AC7,
-  0X5A45, 0X39A3, 0X3982, 0X3982, 0X4182, 0X4182, 0X3942, 0X2901,
-  0X3942, 0X3962, 0X3942, 0X4183, 0X49E4, 0X5225, 0X5225, 0X5204,
-  0X3982, 0X3982, 0X3981, 0X3962, 0X3922, 0X3962, 0X3962, 0X3122,
-  0X3921, 0X3961, 0X49C3, 0X4984, 0X4984, 0X49A4, 0X4983, 0X4163,
-  0X3923, 0X3942, 0X4163, 0X4183, 0X3963, 0X3142, 0X28E1, 0X28E1,
-  0X3901, 0X4142, 0X41C3, 0X41E4, 0X3963, 0X3942, 0X3942, 0X4163,
-  0X41A3, 0X49C4, 0X51E4, 0X4A04, 0X41A3, 0X41A3, 0X4183, 0X41A4,
-  0X41C4, 0X41A3, 0X39A3, 0X49C3, 0X49C3, 0X49E3, 0X49C3, 0X49A3,
-  0X49C3, 0X51E3, 0X5A24, 0X5A44, 0X5A64, 0X5244, 0X4A02, 0X41C2,
-  0X49C3, 0X49E3, 0X5204, 0X51E4, 0X49E4, 0X51E4, 0X49C3, 0X49C4,
-  0X49E4, 0X49E4, 0X49E4, 0X41C3, 0X49C3, 0X41A3, 0X41A2, 0X41A3,
-  0X49C3, 0X49E4, 0X4A04, 0X4A24, 0X49E4, 0X41C3, 0X3982, 0X4163,
-  0X3922, 0X4983, 0X49C4, 0X49C4, 0X49E4, 0X49E4, 0X49E4, 0X41C3,
-  0X41C3, 0X41A3, 0X49E3, 0X5203, 0X49E3, 0X49E3, 0X41C3, 0X41C4,
-  0X39A3, 0X41C4, 0X49C4, 0X49C4, 0X41A3, 0X41A3, 0X49A3, 0X41A3,
-  0X49C3, 0X49C3, 0X4182, 0X4183, 0X3943, 0X3182, 0X3982, 0X4183,
-  0X3943, 0X4164, 0X41C4, 0X3983, 0X4183, 0X3943, 0X20A1, 0X28E1,
-  0X2900, 0X3120, 0X3941, 0X3921, 0X3121, 0X28E0, 0X3101, 0X3121,
-  0X3941, 0X3141, 0X3963, 0X3162, 0X3962, 0X3121, 0X3122, 0X28E1,
-  0X3943, 0X3964, 0X41A5, 0X4184, 0X4184, 0X49C4, 0X41A4, 0X41A4,
-  0X49C3, 0X49E4, 0X4182, 0X3962, 0X4183, 0X49C5, 0X49C5, 0X49C5,
-  0X51E5, 0X49E5, 0X41A3, 0X3962, 0X51E4, 0X51E4, 0X4183, 0X3963,
-  0X3163, 0X3143, 0X3123, 0X3122, 0X3122, 0X3963, 0X4183, 0X4183,
-  0X3943, 0X2922, 0X3122, 0X28E1, 0X28C1, 0X28E1, 0X28C1, 0X28C1,
-  0X20E1, 0X2901, 0X3101, 0X28E1, 0X20A1, 0X20E1, 0X2901, 0X2901,
-  0X3101, 0X3101, 0X3122, 0X3122, 0X3983, 0X41C4, 0X41A4, 0X3942,
-  0X3921, 0X3921, 0X3942, 0X3942, 0X3922, 0X3102, 0X3102, 0X3102,
-  0X30E1, 0X28E1, 0X2901, 0X3121, 0X3121, 0X3121, 0X3962, 0X3962,
-  0X3121, 0X3121, 0X3942, 0X3122, 0X3942, 0X3962, 0X3983, 0X4183,
-  0X4183, 0X4183, 0X4183, 0X41A3, 0X4184, 0X4183, 0X3963, 0X4183,
-  0X4183, 0X41A4, 0X49C4, 0X51E5, 0X49E5, 0X51E5, 0X49C4, 0X49C4,
-  0X49A4, 0X41A3, 0X49C4, 0X49C4, 0X49C4, 0X5205, 0X5A25, 0X5205,
-  0X41A3, 0X2101, 0X2101, 0X2901, 0X3122, 0X3902, 0X30E1, 0X28E1,
-  0X28C1, 0X28E1, 0X28C1, 0X28E1, 0X3122, 0X3122, 0X3122, 0X2921,
-  0X2901, 0X2100, 0X2921, 0X3121, 0X2921, 0X3121, 0X3122, 0X30E1,
-  0X28E0, 0X28E1, 0X4162, 0X3923, 0X4142, 0X3922, 0X3902, 0X3902,
-  0X28A1, 0X28A1, 0X28C1, 0X20C1, 0X28E1, 0X20A0, 0X0840, 0X1880,
-  0X2081, 0X2881, 0X3101, 0X3983, 0X28E2, 0X2080, 0X28C1, 0X28E1,
-  0X28E2, 0X2902, 0X2901, 0X2921, 0X20C1, 0X28E1, 0X3101, 0X3142,
-  0X3143, 0X2922, 0X3121, 0X3962, 0X3962, 0X3942, 0X3122, 0X3102,
-  0X3121, 0X3121, 0X4161, 0X4181, 0X4182, 0X41A2, 0X3962, 0X3121,
-  0X3942, 0X3941, 0X3962, 0X3982, 0X3962, 0X3122, 0X3122, 0X3942,
-  0X41A3, 0X3983, 0X3962, 0X3122, 0X3122, 0X3122, 0X3122, 0X3101,
-  0X3962, 0X3962, 0X3963, 0X3963, 0X3122, 0X3122, 0X3922, 0X28E1,
-  0X28E1, 0X3142, 0X3942, 0X3963, 0X3942, 0X3142, 0X3142, 0X3142,
-  0X3141, 0X3121, 0X3121, 0X3141, 0X2921, 0X2922, 0X2902, 0X2902,
-  0X28E1, 0X3102, 0X3942, 0X3121, 0X30E1, 0X30E1, 0X30E1, 0X2900,
-  0X3101, 0X3121, 0X30E1, 0X28A1, 0X2080, 0X28C1, 0X28E1, 0X28E2,
-  0X30E2, 0X2902, 0X2901, 0X20E1, 0X20C1, 0X1881, 0X1860, 0X1860,
-  0X2080, 0X28C0, 0X20C0, 0X20E0, 0X20C0, 0X1880, 0X2060, 0X2060,
-  0X2080, 0X20C0, 0X28E0, 0X3121, 0X2900, 0X28E0, 0X1880, 0X20A0,
-  0X28C1, 0X3102, 0X3123, 0X3102, 0X3102, 0X3102, 0X3102, 0X3102,
-  0X3922, 0X3102, 0X28E1, 0X28C1, 0X3102, 0X3122, 0X3943, 0X3923,
-  0X3922, 0X3922, 0X3101, 0X30E1, 0X3101, 0X3142, 0X3101, 0X3121,
-  0X28E1, 0X28C1, 0X20C1, 0X20C1, 0X20A0, 0X28C1, 0X28E1, 0X2901,
-  0X28E1, 0X20E1, 0X20A0, 0X1880, 0X1860, 0X1860, 0X1840, 0X1840,
-  0X1860, 0X1860, 0X20A0, 0X1860, 0X1040, 0X1040, 0X2081, 0X2080,
-  0X20A0, 0X20A1, 0X2080, 0X20A0, 0X20A1, 0X28E2, 0X2902, 0X20E1,
-  0X28E1, 0X28E1, 0X28C1, 0X20C0, 0X20C1, 0X28C0, 0X28C1, 0X20C1,
-  0X1880, 0X20A1, 0X1880, 0X20A0, 0X20C1, 0X20C1, 0X20C0, 0X1880,
-  0X28C1, 0X28C1, 0X20A1, 0X20C1, 0X28E1, 0X3122, 0X2922, 0X2922,
-  0X3122, 0X2902, 0X3122, 0X3102, 0X3122, 0X3122, 0X2901, 0X2901,
-  0X3121, 0X3122, 0X3943, 0X3943, 0X3923, 0X3943, 0X3122, 0X3102,
-  0X3122, 0X3922, 0X3943, 0X3142, 0X3963, 0X3963, 0X4163, 0X3942,
-  0X20E1, 0X20C0, 0X18A0, 0X2080, 0X2080, 0X2080, 0X20A0, 0X1880,
-  0X1880, 0X2080, 0X20A0, 0X1860, 0X2080, 0X1880, 0X20A0, 0X20A0,
-  0X18A0, 0X1880, 0X20A0, 0X20C0, 0X20C1, 0X20A1, 0X20C1, 0X1880,
-  0X20A0, 0X2080, 0X20A0, 0X20A0, 0X20A0, 0X20A0, 0X20A0, 0X2881,
-  0X0820, 0X0820, 0X1020, 0X0820, 0X0840, 0X0820, 0X0820, 0X0820,
-  0X0800, 0X1020, 0X1860, 0X1060, 0X1040, 0X0820, 0X1020, 0X0840,
-  0X1040, 0X0820, 0X0840, 0X1040, 0X1040, 0X1040, 0X1860, 0X2080,
-  0X1860, 0X1060, 0X1060, 0X1880, 0X1860, 0X1861, 0X1860, 0X1840,
-  0X1860, 0X1880, 0X1880, 0X2080, 0X18A0, 0X20A0, 0X1880, 0X1880,
-  0X1860, 0X1880, 0X1880, 0X20C0, 0X18A0, 0X1880, 0X1860, 0X1860,
-  0X20A0, 0X1880, 0X1880, 0X1860, 0X1880, 0X1860, 0X1860, 0X1860,
-  0X1860, 0X1881, 0X1860, 0X1880, 0X1880, 0X1880, 0X1860, 0X1040,
-  0X1040, 0X1040, 0X1060, 0X1880, 0X2081, 0X1880, 0X1860, 0X1060,
-  0X1880, 0X1060, 0X1060, 0X1060, 0X1060, 0X1860, 0X1060, 0X1040,
-  0X1040, 0X1040, 0X1860, 0X1840, 0X1840, 0X1040, 0X0840, 0X1040,
-  0X1040, 0X1040, 0X0820, 0X1020, 0X0820, 0X1040, 0X1040, 0X1060,
-  0X1060, 0X0840, 0X0820, 0X0840, 0X0020, 0X0820, 0X0020, 0X0000,
-  0X0820, 0X0840, 0X0820, 0X1040, 0X1020, 0X1020, 0X0800, 0X1020,
-  0X1020, 0X0840, 0X1860, 0X1060, 0X1060, 0X1040, 0X0000, 0X0000,
-  0X1020, 0X1860, 0X1880, 0X1880, 0X1060, 0X1060, 0X1040, 0X1040,
-  0X1860, 0X1860, 0X1860, 0X1060, 0X1060, 0X1860, 0X2081, 0X2060,
-  0X1860, 0X1860, 0X1040, 0X0840, 0X1860, 0X1860, 0X1860, 0X1860,
-  0X1060, 0X1040, 0X1060, 0X1040, 0X1060, 0X1860, 0X1860, 0X1040,
-  0X1060, 0X1040, 0X0820, 0X0820, 0X1020, 0X0820, 0X0820, 0X0820,
-  0X0820, 0X0820, 0X0820, 0X0820, 0X0800, 0X0820, 0X0820, 0X0820,
-  0X0820, 0X1040, 0X0820, 0X0820, 0X0820, 0X1040, 0X1860, 0X1040,
-  0X1040, 0X0820, 0X1040, 0X0820, 0X1040, 0X1060, 0X1040, 0X1040,
-  0X0820, 0X0840, 0X0820, 0X0840, 0X1040, 0X1040, 0X1860, 0X1040,
-  0X1040, 0X1040, 0X0820, 0X0820, 0X1040, 0X1060, 0X1860, 0X1060,
-  0X1060, 0X1060, 0X1860, 0X1880, 0X1880, 0X1880, 0X1880, 0X1040,
-  0X1040, 0X1860, 0X20A1, 0X1881, 0X1881, 0X1881, 0X1860, 0X1060,
-  0X1860, 0X1860, 0X2080, 0X1881, 0X2081, 0X20A1, 0X20A1, 0X1880,
-  0X0820, 0X0820, 0X1020, 0X0820, 0X0820, 0X0820, 0X0840, 0X0820,
-  0X1040, 0X0820, 0X1040, 0X0820, 0X0800, 0X0820, 0X1040, 0X1860,
-  0X0820, 0X0820, 0X0820, 0X0820, 0X0820, 0X1040, 0X1040, 0X0820,
-  0X0820, 0X0820, 0X1040, 0X1040, 0X0840, 0X0820, 0X0820, 0X1020 };
+extern const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] asm("defaultEye_iris");
 
 #define SCREEN_WIDTH  128
 #define SCREEN_HEIGHT 128
 
 #ifdef SYMMETRICAL_EYELID
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X02, 0X02, 0X02, 0X03,
-  0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X02, 0X02, 0X02,
-  0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X02, 0X03,
-  0X03, 0X04, 0X04, 0X04, 0X05, 0X05, 0X05, 0X05, 0X05, 0X06, 0X06, 0X06,
-  0X06, 0X06, 0X06, 0X05, 0X05, 0X05, 0X05, 0X05, 0X04, 0X04, 0X04, 0X03,
-  0X03, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X02, 0X02, 0X03, 0X04, 0X04, 0X05, 0X05, 0X06, 0X06, 0X07, 0X07,
-  0X07, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
-  0X08, 0X08, 0X08, 0X07, 0X07, 0X07, 0X06, 0X06, 0X05, 0X05, 0X04, 0X04,
-  0X03, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X03, 0X04, 0X04, 0X05, 0X06,
-  0X07, 0X07, 0X08, 0X08, 0X09, 0X09, 0X0A, 0X0A, 0X0A, 0X0A, 0X0B, 0X0B,
-  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0A, 0X0A,
-  0X0A, 0X0A, 0X09, 0X09, 0X08, 0X08, 0X07, 0X07, 0X06, 0X05, 0X04, 0X04,
-  0X03, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02,
-  0X03, 0X04, 0X05, 0X06, 0X07, 0X07, 0X08, 0X09, 0X09, 0X0A, 0X0B, 0X0B,
-  0X0C, 0X0C, 0X0C, 0X0D, 0X0D, 0X0D, 0X0D, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
-  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0D, 0X0D, 0X0D, 0X0D, 0X0C, 0X0C, 0X0C,
-  0X0B, 0X0B, 0X0A, 0X09, 0X09, 0X08, 0X07, 0X07, 0X06, 0X05, 0X04, 0X03,
-  0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X05, 0X06, 0X07, 0X08, 0X09,
-  0X09, 0X0A, 0X0B, 0X0C, 0X0C, 0X0D, 0X0D, 0X0E, 0X0E, 0X0F, 0X0F, 0X0F,
-  0X10, 0X10, 0X10, 0X10, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11,
-  0X10, 0X10, 0X10, 0X10, 0X0F, 0X0F, 0X0F, 0X0E, 0X0E, 0X0D, 0X0D, 0X0C,
-  0X0C, 0X0B, 0X0A, 0X09, 0X09, 0X08, 0X07, 0X06, 0X05, 0X04, 0X02, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X05, 0X07, 0X08, 0X09, 0X0A, 0X0B, 0X0C, 0X0C, 0X0D, 0X0E, 0X0F,
-  0X0F, 0X10, 0X10, 0X11, 0X11, 0X12, 0X12, 0X12, 0X13, 0X13, 0X13, 0X13,
-  0X13, 0X13, 0X13, 0X14, 0X14, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
-  0X12, 0X12, 0X12, 0X11, 0X11, 0X10, 0X10, 0X0F, 0X0F, 0X0E, 0X0D, 0X0C,
-  0X0C, 0X0B, 0X0A, 0X09, 0X08, 0X07, 0X05, 0X04, 0X03, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X04, 0X06, 0X07, 0X08, 0X0A, 0X0B,
-  0X0C, 0X0D, 0X0E, 0X0E, 0X0F, 0X10, 0X11, 0X11, 0X12, 0X13, 0X13, 0X14,
-  0X14, 0X14, 0X15, 0X15, 0X15, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
-  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X15, 0X15, 0X15, 0X14, 0X14,
-  0X14, 0X13, 0X13, 0X12, 0X11, 0X11, 0X10, 0X0F, 0X0E, 0X0E, 0X0D, 0X0C,
-  0X0B, 0X0A, 0X08, 0X07, 0X06, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X06, 0X07, 0X09, 0X0A, 0X0B, 0X0D, 0X0E, 0X0F, 0X10, 0X11, 0X11,
-  0X12, 0X13, 0X14, 0X14, 0X15, 0X15, 0X16, 0X16, 0X17, 0X17, 0X18, 0X18,
-  0X18, 0X18, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19,
-  0X19, 0X19, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X16, 0X16, 0X15, 0X15,
-  0X14, 0X14, 0X13, 0X12, 0X11, 0X11, 0X10, 0X0F, 0X0E, 0X0D, 0X0B, 0X0A,
-  0X09, 0X07, 0X06, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04, 0X06, 0X08, 0X09, 0X0B, 0X0C,
-  0X0D, 0X0E, 0X10, 0X11, 0X12, 0X13, 0X13, 0X14, 0X15, 0X16, 0X16, 0X17,
-  0X18, 0X18, 0X19, 0X19, 0X1A, 0X1A, 0X1A, 0X1B, 0X1B, 0X1B, 0X1B, 0X1C,
-  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1B, 0X1B, 0X1B,
-  0X1B, 0X1A, 0X1A, 0X1A, 0X19, 0X19, 0X18, 0X18, 0X17, 0X16, 0X16, 0X15,
-  0X14, 0X13, 0X13, 0X12, 0X11, 0X10, 0X0E, 0X0D, 0X0C, 0X0B, 0X09, 0X08,
-  0X06, 0X04, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X04, 0X06, 0X07, 0X09, 0X0B, 0X0C, 0X0E, 0X0F, 0X10, 0X11, 0X13, 0X14,
-  0X15, 0X16, 0X16, 0X17, 0X18, 0X19, 0X19, 0X1A, 0X1B, 0X1B, 0X1C, 0X1C,
-  0X1C, 0X1D, 0X1D, 0X1D, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1F, 0X1F,
-  0X1F, 0X1F, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1D, 0X1D, 0X1D, 0X1C,
-  0X1C, 0X1C, 0X1B, 0X1B, 0X1A, 0X19, 0X19, 0X18, 0X17, 0X16, 0X16, 0X15,
-  0X14, 0X13, 0X11, 0X10, 0X0F, 0X0E, 0X0C, 0X0B, 0X09, 0X07, 0X06, 0X04,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X05, 0X07, 0X09, 0X0B, 0X0C,
-  0X0E, 0X0F, 0X11, 0X12, 0X13, 0X14, 0X16, 0X17, 0X18, 0X19, 0X19, 0X1A,
-  0X1B, 0X1C, 0X1C, 0X1D, 0X1D, 0X1E, 0X1E, 0X1F, 0X1F, 0X20, 0X20, 0X20,
-  0X20, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
-  0X21, 0X21, 0X21, 0X20, 0X20, 0X20, 0X20, 0X1F, 0X1F, 0X1E, 0X1E, 0X1D,
-  0X1D, 0X1C, 0X1C, 0X1B, 0X1A, 0X19, 0X19, 0X18, 0X17, 0X16, 0X14, 0X13,
-  0X12, 0X11, 0X0F, 0X0E, 0X0C, 0X0B, 0X09, 0X07, 0X05, 0X03, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X04, 0X06, 0X08, 0X0A, 0X0C, 0X0E, 0X0F, 0X11, 0X13, 0X14, 0X15,
-  0X16, 0X17, 0X19, 0X1A, 0X1B, 0X1B, 0X1C, 0X1D, 0X1E, 0X1E, 0X1F, 0X20,
-  0X20, 0X21, 0X21, 0X22, 0X22, 0X22, 0X23, 0X23, 0X23, 0X24, 0X24, 0X24,
-  0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X23,
-  0X23, 0X23, 0X22, 0X22, 0X22, 0X21, 0X21, 0X20, 0X20, 0X1F, 0X1E, 0X1E,
-  0X1D, 0X1C, 0X1B, 0X1B, 0X1A, 0X19, 0X17, 0X16, 0X15, 0X14, 0X13, 0X11,
-  0X0F, 0X0E, 0X0C, 0X0A, 0X08, 0X06, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X07, 0X09, 0X0C,
-  0X0E, 0X0F, 0X11, 0X13, 0X14, 0X16, 0X17, 0X18, 0X19, 0X1B, 0X1C, 0X1D,
-  0X1D, 0X1E, 0X1F, 0X20, 0X21, 0X21, 0X22, 0X23, 0X23, 0X24, 0X24, 0X24,
-  0X25, 0X25, 0X26, 0X26, 0X26, 0X26, 0X26, 0X27, 0X27, 0X27, 0X27, 0X27,
-  0X27, 0X27, 0X27, 0X27, 0X27, 0X26, 0X26, 0X26, 0X26, 0X26, 0X25, 0X25,
-  0X24, 0X24, 0X24, 0X23, 0X23, 0X22, 0X21, 0X21, 0X20, 0X1F, 0X1E, 0X1D,
-  0X1D, 0X1C, 0X1B, 0X19, 0X18, 0X17, 0X16, 0X14, 0X13, 0X11, 0X0F, 0X0E,
-  0X0C, 0X09, 0X07, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X06, 0X08, 0X0B, 0X0D, 0X0F, 0X11, 0X13, 0X14, 0X16,
-  0X17, 0X19, 0X1A, 0X1B, 0X1C, 0X1E, 0X1F, 0X20, 0X20, 0X21, 0X22, 0X23,
-  0X24, 0X24, 0X25, 0X25, 0X26, 0X26, 0X27, 0X27, 0X28, 0X28, 0X28, 0X29,
-  0X29, 0X29, 0X29, 0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2A, 0X2A, 0X2A, 0X29,
-  0X29, 0X29, 0X29, 0X29, 0X29, 0X28, 0X28, 0X28, 0X27, 0X27, 0X26, 0X26,
-  0X25, 0X25, 0X24, 0X24, 0X23, 0X22, 0X21, 0X20, 0X20, 0X1F, 0X1E, 0X1C,
-  0X1B, 0X1A, 0X19, 0X17, 0X16, 0X14, 0X13, 0X11, 0X0F, 0X0D, 0X0B, 0X08,
-  0X06, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X07, 0X09,
-  0X0C, 0X0E, 0X10, 0X12, 0X14, 0X16, 0X18, 0X19, 0X1B, 0X1C, 0X1D, 0X1E,
-  0X20, 0X21, 0X22, 0X23, 0X23, 0X24, 0X25, 0X26, 0X26, 0X27, 0X28, 0X28,
-  0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2B, 0X2B, 0X2B, 0X2C, 0X2C, 0X2C, 0X2C,
-  0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C,
-  0X2B, 0X2B, 0X2B, 0X2A, 0X2A, 0X2A, 0X29, 0X29, 0X28, 0X28, 0X27, 0X26,
-  0X26, 0X25, 0X24, 0X23, 0X23, 0X22, 0X21, 0X20, 0X1E, 0X1D, 0X1C, 0X1B,
-  0X19, 0X18, 0X16, 0X14, 0X12, 0X10, 0X0E, 0X0C, 0X09, 0X07, 0X04, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X05, 0X08, 0X0A, 0X0D, 0X0F, 0X12, 0X14, 0X16,
-  0X17, 0X19, 0X1B, 0X1C, 0X1E, 0X1F, 0X20, 0X21, 0X23, 0X24, 0X25, 0X26,
-  0X26, 0X27, 0X28, 0X29, 0X29, 0X2A, 0X2B, 0X2B, 0X2C, 0X2C, 0X2D, 0X2D,
-  0X2D, 0X2E, 0X2E, 0X2E, 0X2E, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F,
-  0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2E, 0X2E, 0X2E, 0X2E, 0X2D,
-  0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2B, 0X2A, 0X29, 0X29, 0X28, 0X27, 0X26,
-  0X26, 0X25, 0X24, 0X23, 0X21, 0X20, 0X1F, 0X1E, 0X1C, 0X1B, 0X19, 0X17,
-  0X16, 0X14, 0X12, 0X0F, 0X0D, 0X0A, 0X08, 0X05, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05,
-  0X08, 0X0B, 0X0E, 0X10, 0X13, 0X15, 0X17, 0X19, 0X1B, 0X1C, 0X1E, 0X1F,
-  0X21, 0X22, 0X23, 0X25, 0X26, 0X27, 0X28, 0X29, 0X29, 0X2A, 0X2B, 0X2C,
-  0X2C, 0X2D, 0X2D, 0X2E, 0X2E, 0X2F, 0X2F, 0X30, 0X30, 0X30, 0X31, 0X31,
-  0X31, 0X31, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32,
-  0X32, 0X32, 0X31, 0X31, 0X31, 0X31, 0X30, 0X30, 0X30, 0X2F, 0X2F, 0X2E,
-  0X2E, 0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X29, 0X28, 0X27, 0X26,
-  0X25, 0X23, 0X22, 0X21, 0X1F, 0X1E, 0X1C, 0X1B, 0X19, 0X17, 0X15, 0X13,
-  0X10, 0X0E, 0X0B, 0X08, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X09, 0X0C, 0X0F, 0X12, 0X14,
-  0X16, 0X18, 0X1A, 0X1C, 0X1E, 0X20, 0X21, 0X23, 0X24, 0X25, 0X26, 0X28,
-  0X29, 0X2A, 0X2B, 0X2B, 0X2C, 0X2D, 0X2E, 0X2F, 0X2F, 0X30, 0X30, 0X31,
-  0X31, 0X32, 0X32, 0X33, 0X33, 0X33, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34,
-  0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X34, 0X34, 0X34, 0X34,
-  0X34, 0X34, 0X33, 0X33, 0X33, 0X32, 0X32, 0X31, 0X31, 0X30, 0X30, 0X2F,
-  0X2F, 0X2E, 0X2D, 0X2C, 0X2B, 0X2B, 0X2A, 0X29, 0X28, 0X26, 0X25, 0X24,
-  0X23, 0X21, 0X20, 0X1E, 0X1C, 0X1A, 0X18, 0X16, 0X14, 0X12, 0X0F, 0X0C,
-  0X09, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X06, 0X09, 0X0D, 0X10, 0X13, 0X15, 0X18, 0X1A, 0X1C, 0X1E, 0X20,
-  0X21, 0X23, 0X24, 0X26, 0X27, 0X28, 0X2A, 0X2B, 0X2C, 0X2D, 0X2E, 0X2E,
-  0X2F, 0X30, 0X31, 0X31, 0X32, 0X33, 0X33, 0X34, 0X34, 0X35, 0X35, 0X35,
-  0X36, 0X36, 0X36, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37,
-  0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X36, 0X36, 0X36,
-  0X35, 0X35, 0X35, 0X34, 0X34, 0X33, 0X33, 0X32, 0X31, 0X31, 0X30, 0X2F,
-  0X2E, 0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X28, 0X27, 0X26, 0X24, 0X23, 0X21,
-  0X20, 0X1E, 0X1C, 0X1A, 0X18, 0X15, 0X13, 0X10, 0X0D, 0X09, 0X06, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0A, 0X0D, 0X10,
-  0X13, 0X16, 0X19, 0X1B, 0X1D, 0X1F, 0X21, 0X23, 0X25, 0X26, 0X28, 0X29,
-  0X2A, 0X2C, 0X2D, 0X2E, 0X2F, 0X30, 0X31, 0X31, 0X32, 0X33, 0X34, 0X34,
-  0X35, 0X36, 0X36, 0X37, 0X37, 0X37, 0X38, 0X38, 0X39, 0X39, 0X39, 0X39,
-  0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A,
-  0X3A, 0X3A, 0X3A, 0X3A, 0X39, 0X39, 0X39, 0X39, 0X38, 0X38, 0X37, 0X37,
-  0X37, 0X36, 0X36, 0X35, 0X34, 0X34, 0X33, 0X32, 0X31, 0X31, 0X30, 0X2F,
-  0X2E, 0X2D, 0X2C, 0X2A, 0X29, 0X28, 0X26, 0X25, 0X23, 0X21, 0X1F, 0X1D,
-  0X1B, 0X19, 0X16, 0X13, 0X10, 0X0D, 0X0A, 0X06, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X05, 0X0A, 0X0E, 0X11, 0X14, 0X17, 0X1A, 0X1C, 0X1F,
-  0X21, 0X23, 0X25, 0X26, 0X28, 0X29, 0X2B, 0X2C, 0X2D, 0X2F, 0X30, 0X31,
-  0X32, 0X33, 0X34, 0X34, 0X35, 0X36, 0X37, 0X37, 0X38, 0X38, 0X39, 0X39,
-  0X3A, 0X3A, 0X3B, 0X3B, 0X3B, 0X3C, 0X3C, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3C,
-  0X3C, 0X3C, 0X3C, 0X3B, 0X3B, 0X3B, 0X3A, 0X3A, 0X39, 0X39, 0X38, 0X38,
-  0X37, 0X37, 0X36, 0X35, 0X34, 0X34, 0X33, 0X32, 0X31, 0X30, 0X2F, 0X2D,
-  0X2C, 0X2B, 0X29, 0X28, 0X26, 0X25, 0X23, 0X21, 0X1F, 0X1C, 0X1A, 0X17,
-  0X14, 0X11, 0X0E, 0X0A, 0X05, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0A,
-  0X0E, 0X12, 0X15, 0X18, 0X1B, 0X1D, 0X20, 0X22, 0X24, 0X26, 0X28, 0X2A,
-  0X2B, 0X2D, 0X2E, 0X2F, 0X31, 0X32, 0X33, 0X34, 0X35, 0X36, 0X37, 0X37,
-  0X38, 0X39, 0X3A, 0X3A, 0X3B, 0X3B, 0X3C, 0X3C, 0X3D, 0X3D, 0X3E, 0X3E,
-  0X3E, 0X3E, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X40, 0X40, 0X40, 0X40, 0X40,
-  0X40, 0X40, 0X40, 0X40, 0X40, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3E, 0X3E,
-  0X3E, 0X3E, 0X3D, 0X3D, 0X3C, 0X3C, 0X3B, 0X3B, 0X3A, 0X3A, 0X39, 0X38,
-  0X37, 0X37, 0X36, 0X35, 0X34, 0X33, 0X32, 0X31, 0X2F, 0X2E, 0X2D, 0X2B,
-  0X2A, 0X28, 0X26, 0X24, 0X22, 0X20, 0X1D, 0X1B, 0X18, 0X15, 0X12, 0X0E,
-  0X0A, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0E, 0X12, 0X16, 0X19, 0X1C,
-  0X1F, 0X21, 0X24, 0X26, 0X28, 0X2A, 0X2B, 0X2D, 0X2F, 0X30, 0X31, 0X33,
-  0X34, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A, 0X3A, 0X3B, 0X3C, 0X3C, 0X3D,
-  0X3E, 0X3E, 0X3F, 0X3F, 0X40, 0X40, 0X40, 0X41, 0X41, 0X41, 0X42, 0X42,
-  0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X43, 0X43, 0X42, 0X42, 0X42,
-  0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X41, 0X41, 0X41, 0X40, 0X40, 0X40,
-  0X3F, 0X3F, 0X3E, 0X3E, 0X3D, 0X3C, 0X3C, 0X3B, 0X3A, 0X3A, 0X39, 0X38,
-  0X37, 0X36, 0X35, 0X34, 0X33, 0X31, 0X30, 0X2F, 0X2D, 0X2B, 0X2A, 0X28,
-  0X26, 0X24, 0X21, 0X1F, 0X1C, 0X19, 0X16, 0X12, 0X0E, 0X09, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X09, 0X0E, 0X12, 0X16, 0X1A, 0X1D, 0X20, 0X22, 0X25, 0X27, 0X29,
-  0X2B, 0X2D, 0X2F, 0X30, 0X32, 0X33, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A,
-  0X3B, 0X3C, 0X3D, 0X3D, 0X3E, 0X3F, 0X3F, 0X40, 0X41, 0X41, 0X42, 0X42,
-  0X42, 0X43, 0X43, 0X43, 0X44, 0X44, 0X44, 0X44, 0X45, 0X45, 0X45, 0X45,
-  0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45,
-  0X44, 0X44, 0X44, 0X44, 0X43, 0X43, 0X43, 0X42, 0X42, 0X42, 0X41, 0X41,
-  0X40, 0X3F, 0X3F, 0X3E, 0X3D, 0X3D, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37,
-  0X36, 0X35, 0X33, 0X32, 0X30, 0X2F, 0X2D, 0X2B, 0X29, 0X27, 0X25, 0X22,
-  0X20, 0X1D, 0X1A, 0X16, 0X12, 0X0E, 0X09, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X08, 0X0D, 0X12, 0X16,
-  0X1A, 0X1D, 0X21, 0X23, 0X26, 0X28, 0X2B, 0X2D, 0X2F, 0X30, 0X32, 0X34,
-  0X35, 0X37, 0X38, 0X39, 0X3A, 0X3B, 0X3C, 0X3D, 0X3E, 0X3F, 0X40, 0X40,
-  0X41, 0X42, 0X42, 0X43, 0X43, 0X44, 0X44, 0X45, 0X45, 0X46, 0X46, 0X46,
-  0X47, 0X47, 0X47, 0X47, 0X47, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48,
-  0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X47, 0X47, 0X47, 0X47, 0X47,
-  0X46, 0X46, 0X46, 0X45, 0X45, 0X44, 0X44, 0X43, 0X43, 0X42, 0X42, 0X41,
-  0X40, 0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X35,
-  0X34, 0X32, 0X30, 0X2F, 0X2D, 0X2B, 0X28, 0X26, 0X23, 0X21, 0X1D, 0X1A,
-  0X16, 0X12, 0X0D, 0X08, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X07, 0X0D, 0X12, 0X16, 0X1A, 0X1E, 0X21, 0X25, 0X27,
-  0X2A, 0X2C, 0X2E, 0X30, 0X32, 0X34, 0X36, 0X37, 0X38, 0X3A, 0X3B, 0X3C,
-  0X3D, 0X3E, 0X3F, 0X40, 0X41, 0X42, 0X43, 0X43, 0X44, 0X45, 0X45, 0X46,
-  0X46, 0X47, 0X47, 0X48, 0X48, 0X48, 0X49, 0X49, 0X49, 0X4A, 0X4A, 0X4A,
-  0X4A, 0X4A, 0X4A, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B,
-  0X4B, 0X4A, 0X4A, 0X4A, 0X4A, 0X4A, 0X4A, 0X49, 0X49, 0X49, 0X48, 0X48,
-  0X48, 0X47, 0X47, 0X46, 0X46, 0X45, 0X45, 0X44, 0X43, 0X43, 0X42, 0X41,
-  0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B, 0X3A, 0X38, 0X37, 0X36, 0X34, 0X32,
-  0X30, 0X2E, 0X2C, 0X2A, 0X27, 0X25, 0X21, 0X1E, 0X1A, 0X16, 0X12, 0X0D,
-  0X07, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0C,
-  0X11, 0X16, 0X1B, 0X1F, 0X22, 0X25, 0X28, 0X2B, 0X2E, 0X30, 0X32, 0X34,
-  0X36, 0X37, 0X39, 0X3A, 0X3C, 0X3D, 0X3E, 0X3F, 0X40, 0X41, 0X42, 0X43,
-  0X44, 0X45, 0X46, 0X46, 0X47, 0X48, 0X48, 0X49, 0X49, 0X4A, 0X4A, 0X4A,
-  0X4B, 0X4B, 0X4C, 0X4C, 0X4C, 0X4C, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D,
-  0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D,
-  0X4D, 0X4D, 0X4C, 0X4C, 0X4C, 0X4C, 0X4B, 0X4B, 0X4A, 0X4A, 0X4A, 0X49,
-  0X49, 0X48, 0X48, 0X47, 0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40,
-  0X3F, 0X3E, 0X3D, 0X3C, 0X3A, 0X39, 0X37, 0X36, 0X34, 0X32, 0X30, 0X2E,
-  0X2B, 0X28, 0X25, 0X22, 0X1F, 0X1B, 0X16, 0X11, 0X0C, 0X05, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0A, 0X10, 0X16, 0X1B, 0X1F, 0X23,
-  0X26, 0X29, 0X2C, 0X2F, 0X31, 0X33, 0X36, 0X37, 0X39, 0X3B, 0X3C, 0X3E,
-  0X3F, 0X40, 0X42, 0X43, 0X44, 0X45, 0X46, 0X46, 0X47, 0X48, 0X49, 0X49,
-  0X4A, 0X4A, 0X4B, 0X4C, 0X4C, 0X4D, 0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4F,
-  0X4F, 0X4F, 0X4F, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50,
-  0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X4F, 0X4F, 0X4F,
-  0X4F, 0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A, 0X4A,
-  0X49, 0X49, 0X48, 0X47, 0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X40, 0X3F,
-  0X3E, 0X3C, 0X3B, 0X39, 0X37, 0X36, 0X33, 0X31, 0X2F, 0X2C, 0X29, 0X26,
-  0X23, 0X1F, 0X1B, 0X16, 0X10, 0X0A, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X08, 0X0F, 0X15, 0X1A, 0X1F, 0X23, 0X27, 0X2A, 0X2D, 0X30, 0X33,
-  0X35, 0X37, 0X39, 0X3B, 0X3D, 0X3E, 0X40, 0X41, 0X42, 0X44, 0X45, 0X46,
-  0X47, 0X48, 0X49, 0X49, 0X4A, 0X4B, 0X4C, 0X4C, 0X4D, 0X4D, 0X4E, 0X4F,
-  0X4F, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X51, 0X52, 0X52, 0X52, 0X52, 0X52,
-  0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53,
-  0X53, 0X53, 0X53, 0X53, 0X52, 0X52, 0X52, 0X52, 0X52, 0X51, 0X51, 0X51,
-  0X50, 0X50, 0X4F, 0X4F, 0X4F, 0X4E, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A,
-  0X49, 0X49, 0X48, 0X47, 0X46, 0X45, 0X44, 0X42, 0X41, 0X40, 0X3E, 0X3D,
-  0X3B, 0X39, 0X37, 0X35, 0X33, 0X30, 0X2D, 0X2A, 0X27, 0X23, 0X1F, 0X1A,
-  0X15, 0X0F, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0D, 0X14, 0X1A,
-  0X1F, 0X24, 0X28, 0X2B, 0X2E, 0X31, 0X34, 0X36, 0X39, 0X3B, 0X3D, 0X3E,
-  0X40, 0X42, 0X43, 0X44, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4B, 0X4C, 0X4C,
-  0X4D, 0X4E, 0X4F, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X52, 0X52, 0X53, 0X53,
-  0X53, 0X54, 0X54, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55, 0X56, 0X56, 0X56,
-  0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X55,
-  0X55, 0X55, 0X55, 0X55, 0X54, 0X54, 0X54, 0X53, 0X53, 0X53, 0X52, 0X52,
-  0X51, 0X51, 0X50, 0X50, 0X4F, 0X4F, 0X4E, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A,
-  0X49, 0X48, 0X47, 0X46, 0X44, 0X43, 0X42, 0X40, 0X3E, 0X3D, 0X3B, 0X39,
-  0X36, 0X34, 0X31, 0X2E, 0X2B, 0X28, 0X24, 0X1F, 0X1A, 0X14, 0X0D, 0X05,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X0B, 0X13, 0X19, 0X1F, 0X24, 0X28, 0X2C, 0X2F,
-  0X33, 0X35, 0X38, 0X3A, 0X3C, 0X3E, 0X40, 0X42, 0X44, 0X45, 0X46, 0X48,
-  0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F, 0X50, 0X50, 0X51, 0X52, 0X52,
-  0X53, 0X53, 0X54, 0X54, 0X55, 0X55, 0X56, 0X56, 0X56, 0X57, 0X57, 0X57,
-  0X57, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X59, 0X59, 0X59,
-  0X59, 0X59, 0X59, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X57,
-  0X57, 0X57, 0X57, 0X56, 0X56, 0X56, 0X55, 0X55, 0X54, 0X54, 0X53, 0X53,
-  0X52, 0X52, 0X51, 0X50, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49,
-  0X48, 0X46, 0X45, 0X44, 0X42, 0X40, 0X3E, 0X3C, 0X3A, 0X38, 0X35, 0X33,
-  0X2F, 0X2C, 0X28, 0X24, 0X1F, 0X19, 0X13, 0X0B, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08,
-  0X10, 0X18, 0X1E, 0X23, 0X28, 0X2C, 0X30, 0X34, 0X37, 0X39, 0X3C, 0X3E,
-  0X40, 0X42, 0X44, 0X46, 0X47, 0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F,
-  0X50, 0X51, 0X52, 0X53, 0X53, 0X54, 0X55, 0X55, 0X56, 0X56, 0X57, 0X57,
-  0X58, 0X58, 0X58, 0X59, 0X59, 0X59, 0X5A, 0X5A, 0X5A, 0X5A, 0X5B, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X59, 0X59,
-  0X59, 0X58, 0X58, 0X58, 0X57, 0X57, 0X56, 0X56, 0X55, 0X55, 0X54, 0X53,
-  0X53, 0X52, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49, 0X47,
-  0X46, 0X44, 0X42, 0X40, 0X3E, 0X3C, 0X39, 0X37, 0X34, 0X30, 0X2C, 0X28,
-  0X23, 0X1E, 0X18, 0X10, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0D, 0X16, 0X1D, 0X23, 0X28,
-  0X2D, 0X31, 0X35, 0X38, 0X3B, 0X3D, 0X40, 0X42, 0X44, 0X46, 0X48, 0X49,
-  0X4B, 0X4C, 0X4D, 0X4E, 0X50, 0X51, 0X52, 0X52, 0X53, 0X54, 0X55, 0X56,
-  0X56, 0X57, 0X58, 0X58, 0X59, 0X59, 0X5A, 0X5A, 0X5B, 0X5B, 0X5B, 0X5C,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C, 0X5C, 0X5B, 0X5B, 0X5B,
-  0X5A, 0X5A, 0X59, 0X59, 0X58, 0X58, 0X57, 0X56, 0X56, 0X55, 0X54, 0X53,
-  0X52, 0X52, 0X51, 0X50, 0X4E, 0X4D, 0X4C, 0X4B, 0X49, 0X48, 0X46, 0X44,
-  0X42, 0X40, 0X3D, 0X3B, 0X38, 0X35, 0X31, 0X2D, 0X28, 0X23, 0X1D, 0X16,
-  0X0D, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X09, 0X13, 0X1B, 0X22, 0X28, 0X2D, 0X31, 0X35, 0X39, 0X3C,
-  0X3F, 0X41, 0X44, 0X46, 0X48, 0X49, 0X4B, 0X4D, 0X4E, 0X4F, 0X51, 0X52,
-  0X53, 0X54, 0X55, 0X56, 0X57, 0X57, 0X58, 0X59, 0X59, 0X5A, 0X5B, 0X5B,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5F, 0X5F, 0X5F, 0X5F, 0X60,
-  0X60, 0X60, 0X60, 0X60, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61,
-  0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X60,
-  0X60, 0X5F, 0X5F, 0X5F, 0X5F, 0X5E, 0X5E, 0X5E, 0X5D, 0X5D, 0X5C, 0X5C,
-  0X5B, 0X5B, 0X5A, 0X59, 0X59, 0X58, 0X57, 0X57, 0X56, 0X55, 0X54, 0X53,
-  0X52, 0X51, 0X4F, 0X4E, 0X4D, 0X4B, 0X49, 0X48, 0X46, 0X44, 0X41, 0X3F,
-  0X3C, 0X39, 0X35, 0X31, 0X2D, 0X28, 0X22, 0X1B, 0X13, 0X09, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F, 0X19,
-  0X21, 0X27, 0X2D, 0X32, 0X36, 0X3A, 0X3D, 0X40, 0X43, 0X45, 0X47, 0X49,
-  0X4B, 0X4D, 0X4F, 0X50, 0X51, 0X53, 0X54, 0X55, 0X56, 0X57, 0X58, 0X59,
-  0X5A, 0X5B, 0X5B, 0X5C, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F, 0X5F, 0X60, 0X60,
-  0X60, 0X61, 0X61, 0X61, 0X62, 0X62, 0X62, 0X62, 0X63, 0X63, 0X63, 0X63,
-  0X63, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64,
-  0X64, 0X63, 0X63, 0X63, 0X63, 0X63, 0X63, 0X63, 0X62, 0X62, 0X62, 0X62,
-  0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X5F, 0X5F, 0X5E, 0X5E, 0X5D, 0X5C,
-  0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58, 0X57, 0X56, 0X55, 0X54, 0X53, 0X51,
-  0X50, 0X4F, 0X4D, 0X4B, 0X49, 0X47, 0X45, 0X43, 0X40, 0X3D, 0X3A, 0X36,
-  0X32, 0X2D, 0X27, 0X21, 0X19, 0X0F, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X15, 0X1F, 0X26, 0X2C, 0X32, 0X36,
-  0X3B, 0X3E, 0X41, 0X44, 0X47, 0X49, 0X4B, 0X4D, 0X4F, 0X51, 0X52, 0X54,
-  0X55, 0X56, 0X57, 0X59, 0X59, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F,
-  0X60, 0X60, 0X61, 0X61, 0X62, 0X62, 0X63, 0X63, 0X63, 0X64, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66,
-  0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66,
-  0X66, 0X66, 0X66, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64, 0X64, 0X63,
-  0X63, 0X63, 0X62, 0X62, 0X61, 0X61, 0X60, 0X60, 0X5F, 0X5E, 0X5E, 0X5D,
-  0X5C, 0X5B, 0X5A, 0X59, 0X59, 0X57, 0X56, 0X55, 0X54, 0X52, 0X51, 0X4F,
-  0X4D, 0X4B, 0X49, 0X47, 0X44, 0X41, 0X3E, 0X3B, 0X36, 0X32, 0X2C, 0X26,
-  0X1F, 0X15, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X10, 0X1B, 0X24, 0X2C, 0X32, 0X37, 0X3B, 0X3F, 0X43, 0X46, 0X48,
-  0X4B, 0X4D, 0X4F, 0X51, 0X53, 0X54, 0X56, 0X57, 0X58, 0X5A, 0X5B, 0X5C,
-  0X5D, 0X5E, 0X5E, 0X5F, 0X60, 0X61, 0X61, 0X62, 0X63, 0X63, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X66, 0X66, 0X67, 0X67, 0X67, 0X67, 0X68, 0X68, 0X68,
-  0X68, 0X68, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69,
-  0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X68, 0X68,
-  0X68, 0X68, 0X68, 0X67, 0X67, 0X67, 0X67, 0X66, 0X66, 0X65, 0X65, 0X65,
-  0X64, 0X64, 0X63, 0X63, 0X62, 0X61, 0X61, 0X60, 0X5F, 0X5E, 0X5E, 0X5D,
-  0X5C, 0X5B, 0X5A, 0X58, 0X57, 0X56, 0X54, 0X53, 0X51, 0X4F, 0X4D, 0X4B,
-  0X48, 0X46, 0X43, 0X3F, 0X3B, 0X37, 0X32, 0X2C, 0X24, 0X1B, 0X10, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X17, 0X21, 0X2A,
-  0X31, 0X37, 0X3C, 0X40, 0X44, 0X47, 0X4A, 0X4D, 0X4F, 0X51, 0X53, 0X55,
-  0X57, 0X58, 0X59, 0X5B, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X62,
-  0X63, 0X64, 0X65, 0X65, 0X66, 0X66, 0X67, 0X67, 0X68, 0X68, 0X68, 0X69,
-  0X69, 0X69, 0X6A, 0X6A, 0X6A, 0X6A, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A,
-  0X6A, 0X6A, 0X69, 0X69, 0X69, 0X68, 0X68, 0X68, 0X67, 0X67, 0X66, 0X66,
-  0X65, 0X65, 0X64, 0X63, 0X62, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5C,
-  0X5B, 0X59, 0X58, 0X57, 0X55, 0X53, 0X51, 0X4F, 0X4D, 0X4A, 0X47, 0X44,
-  0X40, 0X3C, 0X37, 0X31, 0X2A, 0X21, 0X17, 0X08, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X10, 0X1D, 0X28, 0X30, 0X36, 0X3C, 0X41, 0X45,
-  0X48, 0X4B, 0X4E, 0X51, 0X53, 0X55, 0X57, 0X59, 0X5A, 0X5C, 0X5D, 0X5E,
-  0X5F, 0X60, 0X62, 0X63, 0X63, 0X64, 0X65, 0X66, 0X66, 0X67, 0X68, 0X68,
-  0X69, 0X69, 0X6A, 0X6A, 0X6B, 0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6D, 0X6D,
-  0X6D, 0X6D, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F,
-  0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6E,
-  0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X69, 0X68, 0X68, 0X67, 0X66,
-  0X66, 0X65, 0X64, 0X63, 0X63, 0X62, 0X60, 0X5F, 0X5E, 0X5D, 0X5C, 0X5A,
-  0X59, 0X57, 0X55, 0X53, 0X51, 0X4E, 0X4B, 0X48, 0X45, 0X41, 0X3C, 0X36,
-  0X30, 0X28, 0X1D, 0X10, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05,
-  0X17, 0X24, 0X2E, 0X36, 0X3C, 0X41, 0X46, 0X49, 0X4D, 0X50, 0X53, 0X55,
-  0X57, 0X59, 0X5B, 0X5C, 0X5E, 0X5F, 0X61, 0X62, 0X63, 0X64, 0X65, 0X66,
-  0X67, 0X67, 0X68, 0X69, 0X6A, 0X6A, 0X6B, 0X6B, 0X6C, 0X6C, 0X6D, 0X6D,
-  0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F, 0X6F, 0X70, 0X70, 0X70, 0X70, 0X71,
-  0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X72, 0X72,
-  0X72, 0X72, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71,
-  0X71, 0X70, 0X70, 0X70, 0X70, 0X6F, 0X6F, 0X6F, 0X6F, 0X6E, 0X6E, 0X6E,
-  0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X68, 0X67, 0X67,
-  0X66, 0X65, 0X64, 0X63, 0X62, 0X61, 0X5F, 0X5E, 0X5C, 0X5B, 0X59, 0X57,
-  0X55, 0X53, 0X50, 0X4D, 0X49, 0X46, 0X41, 0X3C, 0X36, 0X2E, 0X24, 0X17,
-  0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0D, 0X1E, 0X2B, 0X34, 0X3B,
-  0X41, 0X46, 0X4B, 0X4E, 0X51, 0X54, 0X57, 0X59, 0X5B, 0X5D, 0X5F, 0X60,
-  0X62, 0X63, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A, 0X6B, 0X6B, 0X6C,
-  0X6D, 0X6D, 0X6E, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X71, 0X71, 0X71, 0X72,
-  0X72, 0X72, 0X72, 0X73, 0X73, 0X73, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74,
-  0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74,
-  0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X73, 0X73,
-  0X73, 0X72, 0X72, 0X72, 0X72, 0X71, 0X71, 0X71, 0X70, 0X70, 0X6F, 0X6F,
-  0X6E, 0X6E, 0X6D, 0X6D, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X66,
-  0X65, 0X64, 0X63, 0X62, 0X60, 0X5F, 0X5D, 0X5B, 0X59, 0X57, 0X54, 0X51,
-  0X4E, 0X4B, 0X46, 0X41, 0X3B, 0X34, 0X2B, 0X1E, 0X0D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X15, 0X26, 0X31, 0X3A, 0X41, 0X47, 0X4B, 0X4F, 0X53,
-  0X56, 0X59, 0X5B, 0X5D, 0X5F, 0X61, 0X63, 0X64, 0X65, 0X67, 0X68, 0X69,
-  0X6A, 0X6B, 0X6C, 0X6D, 0X6D, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X71, 0X71,
-  0X72, 0X72, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X75, 0X75,
-  0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X77, 0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X75, 0X75, 0X75, 0X75,
-  0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X72, 0X72, 0X71, 0X71, 0X70, 0X70,
-  0X6F, 0X6F, 0X6E, 0X6D, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X65,
-  0X64, 0X63, 0X61, 0X5F, 0X5D, 0X5B, 0X59, 0X56, 0X53, 0X4F, 0X4B, 0X47,
-  0X41, 0X3A, 0X31, 0X26, 0X15, 0X01, 0X00, 0X00, 0X00, 0X00, 0X05, 0X1D,
-  0X2D, 0X38, 0X40, 0X47, 0X4C, 0X51, 0X54, 0X58, 0X5B, 0X5D, 0X5F, 0X61,
-  0X63, 0X65, 0X67, 0X68, 0X69, 0X6A, 0X6B, 0X6C, 0X6D, 0X6E, 0X6F, 0X70,
-  0X71, 0X71, 0X72, 0X72, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X76, 0X76,
-  0X76, 0X77, 0X77, 0X77, 0X78, 0X78, 0X78, 0X78, 0X78, 0X79, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X79, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A,
-  0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X78, 0X78, 0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X76,
-  0X76, 0X76, 0X75, 0X75, 0X74, 0X74, 0X74, 0X73, 0X72, 0X72, 0X71, 0X71,
-  0X70, 0X6F, 0X6E, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X65, 0X63,
-  0X61, 0X5F, 0X5D, 0X5B, 0X58, 0X54, 0X51, 0X4C, 0X47, 0X40, 0X38, 0X2D,
-  0X1D, 0X05, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X26, 0X34, 0X3E, 0X46, 0X4C,
-  0X51, 0X56, 0X59, 0X5C, 0X5F, 0X62, 0X64, 0X66, 0X67, 0X69, 0X6A, 0X6C,
-  0X6D, 0X6E, 0X6F, 0X70, 0X71, 0X72, 0X72, 0X73, 0X74, 0X75, 0X75, 0X76,
-  0X76, 0X77, 0X77, 0X78, 0X78, 0X78, 0X79, 0X79, 0X79, 0X7A, 0X7A, 0X7A,
-  0X7B, 0X7B, 0X7B, 0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7B,
-  0X7B, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X78, 0X78,
-  0X78, 0X77, 0X77, 0X76, 0X76, 0X75, 0X75, 0X74, 0X73, 0X72, 0X72, 0X71,
-  0X70, 0X6F, 0X6E, 0X6D, 0X6C, 0X6A, 0X69, 0X67, 0X66, 0X64, 0X62, 0X5F,
-  0X5C, 0X59, 0X56, 0X51, 0X4C, 0X46, 0X3E, 0X34, 0X26, 0X0F, 0X00, 0X00,
-  0X00, 0X01, 0X19, 0X2E, 0X3B, 0X45, 0X4C, 0X52, 0X57, 0X5B, 0X5E, 0X61,
-  0X64, 0X66, 0X68, 0X6A, 0X6B, 0X6D, 0X6E, 0X6F, 0X71, 0X72, 0X73, 0X74,
-  0X74, 0X75, 0X76, 0X77, 0X77, 0X78, 0X78, 0X79, 0X79, 0X7A, 0X7A, 0X7B,
-  0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7E, 0X7E, 0X7E,
-  0X7E, 0X7E, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7E, 0X7E, 0X7D,
-  0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X79,
-  0X79, 0X78, 0X78, 0X77, 0X77, 0X76, 0X75, 0X74, 0X74, 0X73, 0X72, 0X71,
-  0X6F, 0X6E, 0X6D, 0X6B, 0X6A, 0X68, 0X66, 0X64, 0X61, 0X5E, 0X5B, 0X57,
-  0X52, 0X4C, 0X45, 0X3B, 0X2E, 0X19, 0X01, 0X00, 0X00, 0X02, 0X22, 0X36,
-  0X43, 0X4C, 0X52, 0X58, 0X5C, 0X60, 0X63, 0X66, 0X68, 0X6A, 0X6C, 0X6E,
-  0X6F, 0X71, 0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X79, 0X7A,
-  0X7B, 0X7B, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7E, 0X7E, 0X7E, 0X7F, 0X7F,
-  0X7F, 0X80, 0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X80, 0X80, 0X80, 0X80, 0X7F,
-  0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7B, 0X7B,
-  0X7A, 0X79, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X73, 0X72, 0X71, 0X6F,
-  0X6E, 0X6C, 0X6A, 0X68, 0X66, 0X63, 0X60, 0X5C, 0X58, 0X52, 0X4C, 0X43,
-  0X36, 0X22, 0X02, 0X00, 0X00, 0X09, 0X2C, 0X3E, 0X4A, 0X52, 0X59, 0X5E,
-  0X62, 0X65, 0X68, 0X6A, 0X6D, 0X6F, 0X71, 0X72, 0X74, 0X75, 0X76, 0X77,
-  0X78, 0X79, 0X7A, 0X7B, 0X7B, 0X7C, 0X7D, 0X7D, 0X7E, 0X7E, 0X7F, 0X7F,
-  0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X83,
-  0X83, 0X83, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84,
-  0X84, 0X84, 0X83, 0X83, 0X83, 0X83, 0X83, 0X82, 0X82, 0X82, 0X81, 0X81,
-  0X81, 0X80, 0X80, 0X80, 0X7F, 0X7F, 0X7E, 0X7E, 0X7D, 0X7D, 0X7C, 0X7B,
-  0X7B, 0X7A, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X72, 0X71, 0X6F, 0X6D,
-  0X6A, 0X68, 0X65, 0X62, 0X5E, 0X59, 0X52, 0X4A, 0X3E, 0X2C, 0X09, 0X00,
-  0X00, 0X16, 0X35, 0X46, 0X51, 0X59, 0X5F, 0X63, 0X67, 0X6A, 0X6D, 0X6F,
-  0X71, 0X73, 0X75, 0X76, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7D, 0X7D, 0X7E,
-  0X7F, 0X7F, 0X80, 0X81, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X84, 0X84,
-  0X84, 0X85, 0X85, 0X85, 0X85, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86,
-  0X86, 0X86, 0X86, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X83, 0X83,
-  0X82, 0X82, 0X82, 0X81, 0X81, 0X80, 0X7F, 0X7F, 0X7E, 0X7D, 0X7D, 0X7C,
-  0X7B, 0X7A, 0X79, 0X78, 0X76, 0X75, 0X73, 0X71, 0X6F, 0X6D, 0X6A, 0X67,
-  0X63, 0X5F, 0X59, 0X51, 0X46, 0X35, 0X16, 0X00, 0X00, 0X22, 0X3F, 0X4E,
-  0X58, 0X5F, 0X65, 0X69, 0X6D, 0X6F, 0X72, 0X74, 0X76, 0X78, 0X79, 0X7A,
-  0X7C, 0X7D, 0X7E, 0X7F, 0X80, 0X80, 0X81, 0X82, 0X82, 0X83, 0X83, 0X84,
-  0X84, 0X85, 0X85, 0X86, 0X86, 0X86, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86, 0X85, 0X85, 0X84,
-  0X84, 0X83, 0X83, 0X82, 0X82, 0X81, 0X80, 0X80, 0X7F, 0X7E, 0X7D, 0X7C,
-  0X7A, 0X79, 0X78, 0X76, 0X74, 0X72, 0X6F, 0X6D, 0X69, 0X65, 0X5F, 0X58,
-  0X4E, 0X3F, 0X22, 0X00, 0X01, 0X2E, 0X49, 0X57, 0X60, 0X66, 0X6B, 0X6F,
-  0X72, 0X74, 0X77, 0X79, 0X7A, 0X7C, 0X7D, 0X7F, 0X80, 0X81, 0X82, 0X83,
-  0X83, 0X84, 0X85, 0X85, 0X86, 0X86, 0X87, 0X87, 0X88, 0X88, 0X88, 0X89,
-  0X89, 0X8A, 0X8A, 0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X88, 0X88, 0X88, 0X87, 0X87, 0X86, 0X86,
-  0X85, 0X85, 0X84, 0X83, 0X83, 0X82, 0X81, 0X80, 0X7F, 0X7D, 0X7C, 0X7A,
-  0X79, 0X77, 0X74, 0X72, 0X6F, 0X6B, 0X66, 0X60, 0X57, 0X49, 0X2E, 0X01,
-  0X02, 0X3A, 0X52, 0X5F, 0X67, 0X6C, 0X71, 0X74, 0X77, 0X7A, 0X7C, 0X7D,
-  0X7F, 0X80, 0X82, 0X83, 0X84, 0X85, 0X86, 0X86, 0X87, 0X88, 0X88, 0X89,
-  0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F,
-  0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F,
-  0X8F, 0X8F, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C,
-  0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X89, 0X88, 0X88, 0X87,
-  0X86, 0X86, 0X85, 0X84, 0X83, 0X82, 0X80, 0X7F, 0X7D, 0X7C, 0X7A, 0X77,
-  0X74, 0X71, 0X6C, 0X67, 0X5F, 0X52, 0X3A, 0X02, 0X05, 0X47, 0X5C, 0X67,
-  0X6E, 0X73, 0X77, 0X7A, 0X7D, 0X7F, 0X81, 0X82, 0X84, 0X85, 0X86, 0X87,
-  0X88, 0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8D, 0X8D, 0X8E, 0X8E,
-  0X8E, 0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8E,
-  0X8E, 0X8E, 0X8D, 0X8D, 0X8C, 0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X88,
-  0X87, 0X86, 0X85, 0X84, 0X82, 0X81, 0X7F, 0X7D, 0X7A, 0X77, 0X73, 0X6E,
-  0X67, 0X5C, 0X47, 0X05, 0X16, 0X53, 0X65, 0X6F, 0X75, 0X7A, 0X7D, 0X80,
-  0X82, 0X84, 0X86, 0X87, 0X88, 0X89, 0X8A, 0X8B, 0X8C, 0X8D, 0X8D, 0X8E,
-  0X8E, 0X8F, 0X8F, 0X90, 0X90, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92, 0X92,
-  0X93, 0X93, 0X93, 0X93, 0X93, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94,
-  0X94, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X90,
-  0X90, 0X8F, 0X8F, 0X8E, 0X8E, 0X8D, 0X8D, 0X8C, 0X8B, 0X8A, 0X89, 0X88,
-  0X87, 0X86, 0X84, 0X82, 0X80, 0X7D, 0X7A, 0X75, 0X6F, 0X65, 0X53, 0X17,
-  0X2B, 0X5F, 0X6F, 0X77, 0X7C, 0X80, 0X83, 0X85, 0X87, 0X89, 0X8A, 0X8C,
-  0X8D, 0X8E, 0X8F, 0X8F, 0X90, 0X91, 0X91, 0X92, 0X92, 0X93, 0X93, 0X93,
-  0X94, 0X94, 0X94, 0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X97, 0X97,
-  0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X95, 0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X93, 0X93, 0X93, 0X92,
-  0X92, 0X91, 0X91, 0X90, 0X8F, 0X8F, 0X8E, 0X8D, 0X8C, 0X8A, 0X89, 0X87,
-  0X85, 0X83, 0X80, 0X7C, 0X77, 0X6F, 0X5F, 0X2B, 0X40, 0X6B, 0X78, 0X7F,
-  0X83, 0X86, 0X89, 0X8B, 0X8D, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X93, 0X94,
-  0X94, 0X95, 0X95, 0X96, 0X96, 0X96, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98,
-  0X98, 0X98, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X98, 0X98,
-  0X98, 0X98, 0X97, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X95, 0X95, 0X94,
-  0X94, 0X93, 0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8B, 0X89, 0X86, 0X83,
-  0X7F, 0X78, 0X6B, 0X40, 0X55, 0X77, 0X81, 0X86, 0X8A, 0X8D, 0X8F, 0X91,
-  0X92, 0X93, 0X94, 0X95, 0X96, 0X97, 0X97, 0X98, 0X98, 0X99, 0X99, 0X99,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X98, 0X98, 0X97, 0X97, 0X96,
-  0X95, 0X94, 0X93, 0X92, 0X91, 0X8F, 0X8D, 0X8A, 0X86, 0X81, 0X77, 0X55,
-  0X69, 0X82, 0X8A, 0X8E, 0X91, 0X93, 0X95, 0X96, 0X97, 0X98, 0X99, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA1, 0XA1, 0XA1,
-  0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9C, 0X9C, 0X9B, 0X9B, 0X9A, 0X9A, 0X99, 0X98, 0X97,
-  0X96, 0X95, 0X93, 0X91, 0X8E, 0X8A, 0X82, 0X69, 0X7D, 0X8E, 0X93, 0X96,
-  0X98, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0XA0, 0XA0,
-  0XA0, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA0,
-  0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9D, 0X9C, 0X9B, 0X9A, 0X98,
-  0X96, 0X93, 0X8E, 0X7D, 0X90, 0X99, 0X9C, 0X9E, 0XA0, 0XA0, 0XA1, 0XA2,
-  0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA1, 0XA0, 0XA0, 0X9E, 0X9C, 0X99, 0X90,
-  0XA1, 0XA4, 0XA5, 0XA6, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA7,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA6, 0XA5, 0XA4, 0XA1, 0XB1, 0XAF, 0XAF, 0XAE,
-  0XAE, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAE,
-  0XAE, 0XAF, 0XAF, 0XB1, 0XC0, 0XBA, 0XB8, 0XB6, 0XB5, 0XB4, 0XB4, 0XB3,
-  0XB3, 0XB2, 0XB2, 0XB2, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB2, 0XB2, 0XB2, 0XB3, 0XB3, 0XB4, 0XB4, 0XB5, 0XB6, 0XB8, 0XBA, 0XC0,
-  0XCD, 0XC5, 0XC0, 0XBE, 0XBC, 0XBB, 0XB9, 0XB9, 0XB8, 0XB7, 0XB7, 0XB6,
-  0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB3,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB7, 0XB7, 0XB8,
-  0XB9, 0XB9, 0XBB, 0XBC, 0XBE, 0XC0, 0XC5, 0XCD, 0XDB, 0XCF, 0XC9, 0XC6,
-  0XC3, 0XC1, 0XBF, 0XBE, 0XBD, 0XBC, 0XBC, 0XBB, 0XBB, 0XBA, 0XBA, 0XB9,
-  0XB9, 0XB8, 0XB8, 0XB8, 0XB8, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB9,
-  0XB9, 0XBA, 0XBA, 0XBB, 0XBB, 0XBC, 0XBC, 0XBD, 0XBE, 0XBF, 0XC1, 0XC3,
-  0XC6, 0XC9, 0XCF, 0XDB, 0XE8, 0XDA, 0XD2, 0XCE, 0XCA, 0XC8, 0XC6, 0XC4,
-  0XC3, 0XC2, 0XC0, 0XC0, 0XBF, 0XBE, 0XBE, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBA, 0XBA, 0XBA, 0XBA, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XB9, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE, 0XBE, 0XBF,
-  0XC0, 0XC0, 0XC2, 0XC3, 0XC4, 0XC6, 0XC8, 0XCA, 0XCE, 0XD2, 0XDA, 0XE8,
-  0XF6, 0XE4, 0XDB, 0XD5, 0XD1, 0XCE, 0XCC, 0XCA, 0XC8, 0XC7, 0XC5, 0XC4,
-  0XC4, 0XC3, 0XC2, 0XC1, 0XC1, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE,
-  0XBE, 0XBD, 0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBB,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF,
-  0XBF, 0XC0, 0XC0, 0XC1, 0XC1, 0XC2, 0XC3, 0XC4, 0XC4, 0XC5, 0XC7, 0XC8,
-  0XCA, 0XCC, 0XCE, 0XD1, 0XD5, 0XDB, 0XE4, 0XF6, 0XFF, 0XEE, 0XE4, 0XDD,
-  0XD8, 0XD4, 0XD2, 0XCF, 0XCD, 0XCC, 0XCA, 0XC9, 0XC8, 0XC7, 0XC6, 0XC6,
-  0XC5, 0XC4, 0XC4, 0XC3, 0XC3, 0XC2, 0XC2, 0XC1, 0XC1, 0XC1, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3, 0XC4, 0XC4, 0XC5,
-  0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XCC, 0XCD, 0XCF, 0XD2, 0XD4, 0XD8,
-  0XDD, 0XE4, 0XEE, 0XFF, 0XFF, 0XF9, 0XEC, 0XE5, 0XDF, 0XDB, 0XD8, 0XD5,
-  0XD3, 0XD1, 0XCF, 0XCE, 0XCD, 0XCC, 0XCB, 0XCA, 0XC9, 0XC8, 0XC8, 0XC7,
-  0XC7, 0XC6, 0XC5, 0XC5, 0XC5, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC5,
-  0XC5, 0XC5, 0XC6, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCD,
-  0XCE, 0XCF, 0XD1, 0XD3, 0XD5, 0XD8, 0XDB, 0XDF, 0XE5, 0XEC, 0XF9, 0XFF,
-  0XFF, 0XFF, 0XF5, 0XEC, 0XE6, 0XE1, 0XDE, 0XDB, 0XD8, 0XD6, 0XD4, 0XD3,
-  0XD1, 0XD0, 0XCF, 0XCE, 0XCD, 0XCC, 0XCB, 0XCB, 0XCA, 0XCA, 0XC9, 0XC9,
-  0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC6, 0XC6, 0XC6, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XC9, 0XCA, 0XCA,
-  0XCB, 0XCB, 0XCC, 0XCD, 0XCE, 0XCF, 0XD0, 0XD1, 0XD3, 0XD4, 0XD6, 0XD8,
-  0XDB, 0XDE, 0XE1, 0XE6, 0XEC, 0XF5, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XF4,
-  0XED, 0XE8, 0XE4, 0XE0, 0XDE, 0XDB, 0XD9, 0XD7, 0XD6, 0XD4, 0XD3, 0XD2,
-  0XD1, 0XD0, 0XCF, 0XCF, 0XCE, 0XCD, 0XCD, 0XCC, 0XCC, 0XCB, 0XCB, 0XCA,
-  0XCA, 0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC9, 0XC9, 0XC9, 0XCA,
-  0XCA, 0XCB, 0XCB, 0XCC, 0XCC, 0XCD, 0XCD, 0XCE, 0XCF, 0XCF, 0XD0, 0XD1,
-  0XD2, 0XD3, 0XD4, 0XD6, 0XD7, 0XD9, 0XDB, 0XDE, 0XE0, 0XE4, 0XE8, 0XED,
-  0XF4, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF4, 0XEE, 0XEA, 0XE6,
-  0XE3, 0XE0, 0XDE, 0XDC, 0XDA, 0XD9, 0XD7, 0XD6, 0XD5, 0XD4, 0XD3, 0XD2,
-  0XD2, 0XD1, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCE, 0XCD, 0XCD, 0XCC, 0XCC,
-  0XCC, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XC9, 0XC9, 0XC9,
-  0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCE, 0XCE, 0XCF, 0XCF,
-  0XD0, 0XD0, 0XD1, 0XD2, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD7, 0XD9, 0XDA,
-  0XDC, 0XDE, 0XE0, 0XE3, 0XE6, 0XEA, 0XEE, 0XF4, 0XFC, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XF4, 0XF0, 0XEB, 0XE8, 0XE5, 0XE3, 0XE1,
-  0XDF, 0XDD, 0XDC, 0XDB, 0XD9, 0XD8, 0XD7, 0XD6, 0XD5, 0XD5, 0XD4, 0XD3,
-  0XD3, 0XD2, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCD, 0XCD, 0XCD, 0XCD, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC,
-  0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCD, 0XCD, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF,
-  0XCF, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD2, 0XD3, 0XD3, 0XD4, 0XD5, 0XD5,
-  0XD6, 0XD7, 0XD8, 0XD9, 0XDB, 0XDC, 0XDD, 0XDF, 0XE1, 0XE3, 0XE5, 0XE8,
-  0XEB, 0XF0, 0XF4, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFB, 0XF5, 0XF1, 0XED, 0XEA, 0XE8, 0XE6, 0XE4, 0XE2, 0XE0, 0XDF,
-  0XDD, 0XDC, 0XDB, 0XDA, 0XD9, 0XD8, 0XD7, 0XD7, 0XD6, 0XD5, 0XD5, 0XD4,
-  0XD4, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF,
-  0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD5, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD9, 0XDA, 0XDB, 0XDC, 0XDD,
-  0XDF, 0XE0, 0XE2, 0XE4, 0XE6, 0XE8, 0XEA, 0XED, 0XF1, 0XF5, 0XFB, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XF7,
-  0XF3, 0XF0, 0XED, 0XEA, 0XE8, 0XE6, 0XE4, 0XE3, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDD, 0XDC, 0XDB, 0XDA, 0XDA, 0XD9, 0XD8, 0XD8, 0XD7, 0XD7, 0XD6, 0XD6,
-  0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD2,
-  0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD4, 0XD5, 0XD5, 0XD6, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XDA,
-  0XDA, 0XDB, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1, 0XE3, 0XE4, 0XE6, 0XE8,
-  0XEA, 0XED, 0XF0, 0XF3, 0XF7, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF8, 0XF5, 0XF2, 0XEF,
-  0XED, 0XEA, 0XE9, 0XE7, 0XE6, 0XE4, 0XE3, 0XE2, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDD, 0XDC, 0XDC, 0XDB, 0XDA, 0XDA, 0XD9, 0XD9, 0XD8, 0XD8, 0XD7, 0XD7,
-  0XD7, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8,
-  0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1,
-  0XE2, 0XE3, 0XE4, 0XE6, 0XE7, 0XE9, 0XEA, 0XED, 0XEF, 0XF2, 0XF5, 0XF8,
-  0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFA, 0XF6, 0XF4, 0XF1, 0XEF, 0XED, 0XEB,
-  0XEA, 0XE8, 0XE7, 0XE5, 0XE4, 0XE3, 0XE2, 0XE1, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDE, 0XDD, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD9, 0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE,
-  0XDE, 0XDF, 0XE0, 0XE1, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE7, 0XE8, 0XEA,
-  0XEB, 0XED, 0XEF, 0XF1, 0XF4, 0XF6, 0XFA, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFB, 0XF8, 0XF6, 0XF3, 0XF1, 0XEF, 0XEE, 0XEC, 0XEB, 0XE9,
-  0XE8, 0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF,
-  0XDF, 0XDE, 0XDE, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDA,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDD,
-  0XDD, 0XDE, 0XDE, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1, 0XE2, 0XE2, 0XE3, 0XE4,
-  0XE5, 0XE6, 0XE7, 0XE8, 0XE9, 0XEB, 0XEC, 0XEE, 0XEF, 0XF1, 0XF3, 0XF6,
-  0XF8, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD,
-  0XFA, 0XF8, 0XF5, 0XF4, 0XF2, 0XF0, 0XEE, 0XED, 0XEC, 0XEB, 0XE9, 0XE8,
-  0XE7, 0XE7, 0XE6, 0XE5, 0XE4, 0XE4, 0XE3, 0XE2, 0XE2, 0XE1, 0XE1, 0XE0,
-  0XE0, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD, 0XDD, 0XDD, 0XDC,
-  0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDD, 0XDD, 0XDD,
-  0XDD, 0XDE, 0XDE, 0XDE, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1, 0XE1, 0XE2,
-  0XE2, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE7, 0XE7, 0XE8, 0XE9, 0XEB, 0XEC,
-  0XED, 0XEE, 0XF0, 0XF2, 0XF4, 0XF5, 0XF8, 0XFA, 0XFD, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8,
-  0XF6, 0XF4, 0XF2, 0XF1, 0XF0, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE8,
-  0XE8, 0XE7, 0XE6, 0XE6, 0XE5, 0XE4, 0XE4, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2,
-  0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE0, 0XE0, 0XE1, 0XE1, 0XE1,
-  0XE2, 0XE2, 0XE2, 0XE3, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE6, 0XE7, 0XE8,
-  0XE8, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XEE, 0XF0, 0XF1, 0XF2, 0XF4, 0XF6,
-  0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF6, 0XF5,
-  0XF3, 0XF2, 0XF1, 0XEF, 0XEE, 0XED, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE9,
-  0XE8, 0XE7, 0XE7, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3,
-  0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1,
-  0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE2, 0XE2, 0XE2,
-  0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE6,
-  0XE6, 0XE7, 0XE7, 0XE8, 0XE9, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XED, 0XEE,
-  0XEF, 0XF1, 0XF2, 0XF3, 0XF5, 0XF6, 0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF7, 0XF6, 0XF4, 0XF3,
-  0XF2, 0XF1, 0XF0, 0XEF, 0XEE, 0XED, 0XED, 0XEC, 0XEB, 0XEB, 0XEA, 0XEA,
-  0XE9, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5,
-  0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE5, 0XE6, 0XE6,
-  0XE6, 0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEB, 0XEB,
-  0XEC, 0XED, 0XED, 0XEE, 0XEF, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF6, 0XF7,
-  0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFC, 0XFB, 0XF9, 0XF8, 0XF7, 0XF5, 0XF4, 0XF3, 0XF2,
-  0XF1, 0XF1, 0XF0, 0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC, 0XEB, 0XEB,
-  0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE8, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA,
-  0XEB, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XF0, 0XF1, 0XF1,
-  0XF2, 0XF3, 0XF4, 0XF5, 0XF7, 0XF8, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFD, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF5, 0XF4, 0XF3, 0XF2,
-  0XF2, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC,
-  0XEC, 0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9,
-  0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9,
-  0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA, 0XEA, 0XEA, 0XEB,
-  0XEB, 0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XEF,
-  0XF0, 0XF0, 0XF1, 0XF2, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF8, 0XF9,
-  0XFA, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFC, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF6, 0XF5, 0XF4, 0XF3, 0XF3,
-  0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XED, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC,
-  0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XEC,
-  0XEC, 0XEC, 0XEC, 0XEC, 0XED, 0XED, 0XED, 0XED, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3, 0XF4, 0XF5,
-  0XF6, 0XF6, 0XF7, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD, 0XFC,
-  0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF4,
-  0XF3, 0XF3, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XF0, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEF, 0XF0, 0XF0, 0XF0, 0XF0, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3,
-  0XF4, 0XF4, 0XF5, 0XF5, 0XF6, 0XF6, 0XF7, 0XF8, 0XF9, 0XFA, 0XFA, 0XFB,
-  0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC,
-  0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5,
-  0XF4, 0XF4, 0XF4, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF3, 0XF3,
-  0XF3, 0XF4, 0XF4, 0XF4, 0XF5, 0XF5, 0XF6, 0XF6, 0XF7, 0XF7, 0XF8, 0XF8,
-  0XF9, 0XFA, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD, 0XFD, 0XFC,
-  0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF6,
-  0XF6, 0XF6, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF6, 0XF6, 0XF6, 0XF7, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFD, 0XFD, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC,
-  0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8,
-  0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6,
-  0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF8, 0XF8,
-  0XF8, 0XF8, 0XF8, 0XF9, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFC,
-  0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD,
-  0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XFA,
-  0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9,
-  0XF9, 0XF9, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB, 0XFC,
-  0XFC, 0XFC, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC,
-  0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF8, 0XC7, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XC7, 0X91, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0X91,
-  0X5C, 0XF4, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF4, 0X5C, 0X27, 0XD3, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XD3, 0X27, 0X04, 0XB2, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF2, 0XB2, 0X04,
-  0X02, 0X91, 0XD7, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XD7, 0X91, 0X02, 0X01, 0X70, 0XBD, 0XE8,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XE8, 0XBD, 0X71, 0X01, 0X00, 0X4F, 0XA3, 0XD1, 0XEF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XD1, 0XA3, 0X4F, 0X00,
-  0X00, 0X2E, 0X89, 0XBA, 0XDA, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XF2, 0XDA, 0XBA, 0X89, 0X2E, 0X00, 0X00, 0X0D, 0X6E, 0XA3,
-  0XC6, 0XDF, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF2, 0XDF, 0XC6,
-  0XA3, 0X6E, 0X0D, 0X00, 0X00, 0X01, 0X54, 0X8D, 0XB2, 0XCD, 0XE1, 0XF2,
-  0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XF2, 0XE1, 0XCD, 0XB2, 0X8D, 0X54, 0X01, 0X00,
-  0X00, 0X01, 0X3A, 0X76, 0X9E, 0XBA, 0XD0, 0XE2, 0XEF, 0XFB, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XEF,
-  0XE2, 0XD0, 0XBA, 0X9E, 0X76, 0X3A, 0X01, 0X00, 0X00, 0X00, 0X1F, 0X60,
-  0X8A, 0XA8, 0XBF, 0XD1, 0XE0, 0XED, 0XF8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF8, 0XED, 0XE0, 0XD1, 0XBF, 0XA8, 0X8A,
-  0X60, 0X1F, 0X00, 0X00, 0X00, 0X00, 0X06, 0X49, 0X75, 0X95, 0XAE, 0XC1,
-  0XD1, 0XDE, 0XEA, 0XF3, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC,
-  0XF3, 0XEA, 0XDE, 0XD1, 0XC1, 0XAE, 0X95, 0X75, 0X49, 0X06, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X32, 0X61, 0X83, 0X9D, 0XB1, 0XC2, 0XD0, 0XDC, 0XE6,
-  0XEF, 0XF7, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF7, 0XEF, 0XE6, 0XDC, 0XD0, 0XC2,
-  0XB1, 0X9D, 0X83, 0X61, 0X32, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1C,
-  0X4D, 0X70, 0X8B, 0XA1, 0XB2, 0XC1, 0XCE, 0XD9, 0XE2, 0XEB, 0XF2, 0XF9,
-  0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XF9, 0XF2, 0XEB, 0XE2, 0XD9, 0XCE, 0XC1, 0XB2, 0XA1, 0X8B, 0X70, 0X4D,
-  0X1C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X39, 0X5E, 0X7A, 0X91,
-  0XA3, 0XB3, 0XC0, 0XCB, 0XD5, 0XDE, 0XE6, 0XED, 0XF3, 0XF9, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF9, 0XF3, 0XED, 0XE6, 0XDE, 0XD5,
-  0XCB, 0XC0, 0XB3, 0XA3, 0X91, 0X7A, 0X5E, 0X39, 0X05, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X24, 0X4B, 0X69, 0X81, 0X94, 0XA4, 0XB2, 0XBE,
-  0XC8, 0XD2, 0XDA, 0XE1, 0XE8, 0XEE, 0XF4, 0XF9, 0XFD, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD,
-  0XF9, 0XF4, 0XEE, 0XE8, 0XE1, 0XDA, 0XD2, 0XC8, 0XBE, 0XB2, 0XA4, 0X94,
-  0X81, 0X69, 0X4B, 0X24, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X10, 0X39, 0X58, 0X71, 0X85, 0X96, 0XA4, 0XB0, 0XBB, 0XC5, 0XCE, 0XD5,
-  0XDC, 0XE3, 0XE9, 0XEE, 0XF3, 0XF7, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFB, 0XF7, 0XF3, 0XEE, 0XE9, 0XE3, 0XDC,
-  0XD5, 0XCE, 0XC5, 0XBB, 0XB0, 0XA4, 0X96, 0X84, 0X71, 0X58, 0X39, 0X10,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X26, 0X47, 0X61,
-  0X75, 0X87, 0X96, 0XA3, 0XAF, 0XB8, 0XC2, 0XCA, 0XD1, 0XD7, 0XDD, 0XE3,
-  0XE8, 0XED, 0XF1, 0XF5, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XF9,
-  0XF5, 0XF1, 0XED, 0XE8, 0XE3, 0XDD, 0XD7, 0XD1, 0XCA, 0XC2, 0XB8, 0XAF,
-  0XA3, 0X96, 0X87, 0X75, 0X61, 0X47, 0X26, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X35, 0X50, 0X66, 0X78, 0X88, 0X96,
-  0XA2, 0XAC, 0XB5, 0XBE, 0XC5, 0XCC, 0XD3, 0XD8, 0XDD, 0XE2, 0XE7, 0XEB,
-  0XEF, 0XF2, 0XF6, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFC, 0XF9, 0XF6, 0XF2, 0XEF, 0XEB, 0XE7, 0XE2, 0XDD,
-  0XD8, 0XD3, 0XCC, 0XC5, 0XBE, 0XB5, 0XAC, 0XA2, 0X96, 0X88, 0X78, 0X66,
-  0X50, 0X35, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X24, 0X40, 0X57, 0X6A, 0X7A, 0X88, 0X95, 0X9F, 0XA9, 0XB2,
-  0XBA, 0XC1, 0XC8, 0XCD, 0XD3, 0XD8, 0XDD, 0XE1, 0XE5, 0XE9, 0XEC, 0XF0,
-  0XF3, 0XF5, 0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFB, 0XF8, 0XF5, 0XF3,
-  0XF0, 0XEC, 0XE9, 0XE5, 0XE1, 0XDD, 0XD8, 0XD3, 0XCD, 0XC8, 0XC1, 0XBA,
-  0XB2, 0XA9, 0X9F, 0X95, 0X88, 0X7A, 0X6A, 0X57, 0X40, 0X24, 0X03, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X30,
-  0X47, 0X5B, 0X6C, 0X7B, 0X88, 0X93, 0X9D, 0XA6, 0XAE, 0XB6, 0XBD, 0XC3,
-  0XC8, 0XCE, 0XD2, 0XD7, 0XDB, 0XDF, 0XE3, 0XE6, 0XE9, 0XEC, 0XEF, 0XF1,
-  0XF4, 0XF7, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC,
-  0XFB, 0XF9, 0XF7, 0XF4, 0XF1, 0XEF, 0XEC, 0XE9, 0XE6, 0XE3, 0XDF, 0XDB,
-  0XD7, 0XD2, 0XCE, 0XC8, 0XC3, 0XBD, 0XB6, 0XAE, 0XA6, 0X9D, 0X93, 0X88,
-  0X7B, 0X6C, 0X5B, 0X47, 0X30, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X20, 0X38, 0X4D, 0X5E, 0X6D,
-  0X7B, 0X86, 0X91, 0X9A, 0XA3, 0XAA, 0XB2, 0XB8, 0XBE, 0XC3, 0XC8, 0XCD,
-  0XD1, 0XD5, 0XD9, 0XDD, 0XE0, 0XE3, 0XE6, 0XE8, 0XEB, 0XEE, 0XF0, 0XF2,
-  0XF4, 0XF6, 0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFD, 0XFC, 0XFB, 0XF9, 0XF8, 0XF6, 0XF4, 0XF2, 0XF0, 0XEE, 0XEB,
-  0XE8, 0XE6, 0XE3, 0XE0, 0XDD, 0XD9, 0XD5, 0XD1, 0XCD, 0XC8, 0XC3, 0XBE,
-  0XB8, 0XB2, 0XAA, 0XA3, 0X9A, 0X91, 0X86, 0X7B, 0X6D, 0X5E, 0X4D, 0X38,
-  0X20, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X10, 0X29, 0X3E, 0X50, 0X60, 0X6E, 0X7A, 0X85, 0X8E,
-  0X97, 0X9F, 0XA7, 0XAD, 0XB3, 0XB9, 0XBE, 0XC3, 0XC7, 0XCC, 0XCF, 0XD3,
-  0XD6, 0XDA, 0XDC, 0XDF, 0XE2, 0XE5, 0XE7, 0XE9, 0XEB, 0XED, 0XEF, 0XF1,
-  0XF2, 0XF4, 0XF5, 0XF7, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFD, 0XFC, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF5, 0XF4, 0XF2,
-  0XF1, 0XEF, 0XED, 0XEB, 0XE9, 0XE7, 0XE5, 0XE2, 0XDF, 0XDC, 0XDA, 0XD6,
-  0XD3, 0XCF, 0XCC, 0XC7, 0XC3, 0XBE, 0XB9, 0XB3, 0XAD, 0XA7, 0X9F, 0X97,
-  0X8E, 0X85, 0X7A, 0X6E, 0X60, 0X50, 0X3E, 0X29, 0X10, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X19, 0X2F, 0X42, 0X52, 0X61, 0X6D, 0X79, 0X82, 0X8C, 0X94, 0X9B, 0XA2,
-  0XA9, 0XAE, 0XB4, 0XB9, 0XBD, 0XC2, 0XC6, 0XCA, 0XCD, 0XD0, 0XD4, 0XD6,
-  0XD9, 0XDC, 0XDE, 0XE0, 0XE2, 0XE4, 0XE7, 0XE8, 0XEA, 0XEB, 0XED, 0XEE,
-  0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF7, 0XF8, 0XF8, 0XF9,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF5, 0XF4,
-  0XF3, 0XF2, 0XF1, 0XF0, 0XEE, 0XED, 0XEB, 0XEA, 0XE8, 0XE7, 0XE4, 0XE2,
-  0XE0, 0XDE, 0XDC, 0XD9, 0XD6, 0XD4, 0XD0, 0XCD, 0XCA, 0XC6, 0XC2, 0XBD,
-  0XB9, 0XB4, 0XAE, 0XA9, 0XA2, 0X9B, 0X94, 0X8C, 0X82, 0X79, 0X6D, 0X61,
-  0X52, 0X42, 0X2F, 0X19, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X21, 0X34, 0X45,
-  0X54, 0X61, 0X6C, 0X77, 0X80, 0X89, 0X90, 0X97, 0X9E, 0XA4, 0XAA, 0XAF,
-  0XB3, 0XB8, 0XBC, 0XC0, 0XC4, 0XC7, 0XCA, 0XCD, 0XD0, 0XD3, 0XD5, 0XD7,
-  0XDA, 0XDC, 0XDE, 0XE0, 0XE1, 0XE3, 0XE5, 0XE6, 0XE8, 0XE9, 0XEA, 0XEB,
-  0XEC, 0XED, 0XEE, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE8,
-  0XE6, 0XE5, 0XE3, 0XE1, 0XE0, 0XDE, 0XDC, 0XDA, 0XD7, 0XD5, 0XD3, 0XD0,
-  0XCD, 0XCA, 0XC7, 0XC4, 0XC0, 0XBC, 0XB8, 0XB3, 0XAF, 0XAA, 0XA4, 0X9E,
-  0X97, 0X90, 0X89, 0X80, 0X77, 0X6C, 0X61, 0X54, 0X45, 0X34, 0X21, 0X0A,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X26, 0X37, 0X47, 0X54, 0X60, 0X6B,
-  0X75, 0X7D, 0X85, 0X8D, 0X93, 0X9A, 0X9F, 0XA5, 0XAA, 0XAE, 0XB3, 0XB7,
-  0XBA, 0XBE, 0XC1, 0XC4, 0XC7, 0XCA, 0XCC, 0XCF, 0XD1, 0XD3, 0XD5, 0XD7,
-  0XD9, 0XDB, 0XDC, 0XDE, 0XDF, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE6, 0XE7,
-  0XE7, 0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEA, 0XEA, 0XEB, 0XEB, 0XEB, 0XEB,
-  0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE8, 0XE8, 0XE7,
-  0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE2, 0XE1, 0XDF, 0XDE, 0XDC, 0XDB, 0XD9,
-  0XD7, 0XD5, 0XD3, 0XD1, 0XCF, 0XCC, 0XCA, 0XC7, 0XC4, 0XC1, 0XBE, 0XBA,
-  0XB7, 0XB3, 0XAE, 0XAA, 0XA5, 0X9F, 0X9A, 0X93, 0X8D, 0X85, 0X7D, 0X75,
-  0X6B, 0X60, 0X54, 0X47, 0X38, 0X26, 0X12, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X18, 0X2A, 0X3A, 0X47, 0X54, 0X5F, 0X69, 0X72, 0X7A, 0X82,
-  0X89, 0X8F, 0X95, 0X9B, 0XA0, 0XA5, 0XA9, 0XAD, 0XB1, 0XB5, 0XB8, 0XBB,
-  0XBE, 0XC1, 0XC4, 0XC6, 0XC9, 0XCB, 0XCD, 0XCF, 0XD0, 0XD2, 0XD4, 0XD5,
-  0XD7, 0XD8, 0XD9, 0XDA, 0XDC, 0XDD, 0XDE, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1,
-  0XE2, 0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE2, 0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF, 0XDF, 0XDE, 0XDD, 0XDC,
-  0XDA, 0XD9, 0XD8, 0XD7, 0XD5, 0XD4, 0XD2, 0XD0, 0XCF, 0XCD, 0XCB, 0XC9,
-  0XC6, 0XC4, 0XC1, 0XBE, 0XBB, 0XB8, 0XB5, 0XB1, 0XAD, 0XA9, 0XA5, 0XA0,
-  0X9B, 0X95, 0X8F, 0X89, 0X82, 0X7A, 0X72, 0X69, 0X5F, 0X54, 0X47, 0X3A,
-  0X2A, 0X18, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X1D,
-  0X2D, 0X3B, 0X48, 0X53, 0X5E, 0X67, 0X6F, 0X77, 0X7E, 0X85, 0X8B, 0X91,
-  0X96, 0X9B, 0X9F, 0XA4, 0XA7, 0XAB, 0XAF, 0XB2, 0XB5, 0XB8, 0XBB, 0XBD,
-  0XC0, 0XC2, 0XC4, 0XC6, 0XC8, 0XCA, 0XCB, 0XCD, 0XCF, 0XD0, 0XD1, 0XD2,
-  0XD3, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XDA, 0XDA, 0XDA, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA,
-  0XD9, 0XD8, 0XD8, 0XD7, 0XD7, 0XD6, 0XD5, 0XD3, 0XD2, 0XD1, 0XD0, 0XCF,
-  0XCD, 0XCB, 0XCA, 0XC8, 0XC6, 0XC4, 0XC2, 0XC0, 0XBD, 0XBB, 0XB8, 0XB5,
-  0XB2, 0XAF, 0XAB, 0XA7, 0XA4, 0X9F, 0X9B, 0X96, 0X91, 0X8B, 0X85, 0X7E,
-  0X77, 0X6F, 0X67, 0X5E, 0X53, 0X48, 0X3B, 0X2D, 0X1D, 0X0A, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0F, 0X20, 0X2E, 0X3C, 0X47,
-  0X52, 0X5B, 0X64, 0X6C, 0X74, 0X7A, 0X81, 0X87, 0X8C, 0X91, 0X96, 0X9A,
-  0X9E, 0XA2, 0XA6, 0XA9, 0XAC, 0XAF, 0XB2, 0XB5, 0XB7, 0XBA, 0XBC, 0XBE,
-  0XC0, 0XC2, 0XC3, 0XC5, 0XC7, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCE, 0XCE,
-  0XCF, 0XD0, 0XD0, 0XD1, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD1, 0XD0, 0XD0, 0XCF,
-  0XCE, 0XCE, 0XCC, 0XCB, 0XCA, 0XC9, 0XC8, 0XC7, 0XC5, 0XC3, 0XC2, 0XC0,
-  0XBE, 0XBC, 0XBA, 0XB7, 0XB5, 0XB2, 0XAF, 0XAC, 0XA9, 0XA6, 0XA2, 0X9E,
-  0X9A, 0X96, 0X91, 0X8C, 0X87, 0X81, 0X7A, 0X74, 0X6C, 0X64, 0X5B, 0X52,
-  0X47, 0X3C, 0X2E, 0X20, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X13, 0X22, 0X2F, 0X3B, 0X46, 0X50, 0X59, 0X61,
-  0X69, 0X70, 0X77, 0X7C, 0X82, 0X87, 0X8C, 0X91, 0X95, 0X99, 0X9C, 0XA0,
-  0XA3, 0XA6, 0XA9, 0XAC, 0XAE, 0XB1, 0XB3, 0XB5, 0XB7, 0XB9, 0XBB, 0XBD,
-  0XBE, 0XC0, 0XC1, 0XC2, 0XC3, 0XC5, 0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XC9,
-  0XCA, 0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCA, 0XCA, 0XC9, 0XC9, 0XC8, 0XC7, 0XC6, 0XC6, 0XC5, 0XC3,
-  0XC2, 0XC1, 0XC0, 0XBE, 0XBD, 0XBB, 0XB9, 0XB7, 0XB5, 0XB3, 0XB1, 0XAE,
-  0XAC, 0XA9, 0XA6, 0XA3, 0XA0, 0X9C, 0X99, 0X95, 0X91, 0X8C, 0X87, 0X82,
-  0X7C, 0X77, 0X70, 0X69, 0X61, 0X59, 0X50, 0X46, 0X3B, 0X2F, 0X22, 0X13,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X06, 0X15, 0X23, 0X2F, 0X3B, 0X45, 0X4E, 0X56, 0X5E, 0X66, 0X6C, 0X72,
-  0X78, 0X7D, 0X82, 0X87, 0X8B, 0X8F, 0X93, 0X97, 0X9A, 0X9D, 0XA0, 0XA3,
-  0XA6, 0XA8, 0XAB, 0XAD, 0XAF, 0XB1, 0XB3, 0XB4, 0XB6, 0XB7, 0XB9, 0XBA,
-  0XBB, 0XBC, 0XBE, 0XBE, 0XBF, 0XC0, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3,
-  0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC2, 0XC2,
-  0XC1, 0XC1, 0XC0, 0XBF, 0XBE, 0XBE, 0XBC, 0XBB, 0XBA, 0XB9, 0XB7, 0XB6,
-  0XB4, 0XB3, 0XB1, 0XAF, 0XAD, 0XAB, 0XA8, 0XA6, 0XA3, 0XA0, 0X9D, 0X9A,
-  0X97, 0X93, 0X8F, 0X8B, 0X87, 0X82, 0X7D, 0X78, 0X72, 0X6C, 0X66, 0X5E,
-  0X56, 0X4E, 0X45, 0X3B, 0X2F, 0X23, 0X15, 0X06, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X17, 0X23,
-  0X2F, 0X3A, 0X43, 0X4C, 0X54, 0X5B, 0X62, 0X68, 0X6E, 0X74, 0X79, 0X7D,
-  0X82, 0X86, 0X8A, 0X8E, 0X91, 0X94, 0X97, 0X9A, 0X9D, 0XA0, 0XA2, 0XA4,
-  0XA6, 0XA8, 0XAA, 0XAC, 0XAE, 0XAF, 0XB1, 0XB2, 0XB3, 0XB4, 0XB5, 0XB6,
-  0XB7, 0XB8, 0XB9, 0XB9, 0XBA, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBB, 0XBB, 0XBB, 0XBA, 0XB9, 0XB9, 0XB8, 0XB7,
-  0XB6, 0XB5, 0XB4, 0XB3, 0XB2, 0XB1, 0XAF, 0XAE, 0XAC, 0XAA, 0XA8, 0XA6,
-  0XA4, 0XA2, 0XA0, 0X9D, 0X9A, 0X97, 0X94, 0X91, 0X8E, 0X8A, 0X86, 0X82,
-  0X7D, 0X79, 0X74, 0X6E, 0X68, 0X62, 0X5B, 0X54, 0X4C, 0X43, 0X3A, 0X2F,
-  0X23, 0X17, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X18, 0X24, 0X2E, 0X38, 0X41,
-  0X49, 0X51, 0X58, 0X5E, 0X64, 0X6A, 0X6F, 0X74, 0X79, 0X7D, 0X81, 0X85,
-  0X88, 0X8C, 0X8F, 0X92, 0X94, 0X97, 0X9A, 0X9C, 0X9E, 0XA0, 0XA2, 0XA4,
-  0XA5, 0XA7, 0XA8, 0XAA, 0XAB, 0XAC, 0XAD, 0XAE, 0XAF, 0XB0, 0XB1, 0XB1,
-  0XB2, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB3, 0XB3, 0XB3, 0XB2, 0XB1, 0XB1, 0XB0, 0XAF, 0XAE, 0XAD, 0XAC, 0XAB,
-  0XAA, 0XA8, 0XA7, 0XA5, 0XA4, 0XA2, 0XA0, 0X9E, 0X9C, 0X9A, 0X97, 0X94,
-  0X92, 0X8F, 0X8C, 0X88, 0X85, 0X81, 0X7D, 0X79, 0X74, 0X6F, 0X6A, 0X64,
-  0X5E, 0X58, 0X51, 0X49, 0X41, 0X38, 0X2E, 0X24, 0X18, 0X0B, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X0C, 0X18, 0X23, 0X2D, 0X36, 0X3F, 0X46, 0X4E, 0X54,
-  0X5A, 0X60, 0X65, 0X6A, 0X6F, 0X74, 0X78, 0X7B, 0X7F, 0X83, 0X86, 0X89,
-  0X8C, 0X8E, 0X91, 0X93, 0X95, 0X98, 0X9A, 0X9B, 0X9D, 0X9F, 0XA0, 0XA2,
-  0XA3, 0XA4, 0XA5, 0XA6, 0XA7, 0XA8, 0XA9, 0XAA, 0XAA, 0XAB, 0XAB, 0XAB,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAB, 0XAB, 0XAB, 0XAA,
-  0XAA, 0XA9, 0XA8, 0XA7, 0XA6, 0XA5, 0XA4, 0XA3, 0XA2, 0XA0, 0X9F, 0X9D,
-  0X9B, 0X9A, 0X98, 0X95, 0X93, 0X91, 0X8E, 0X8C, 0X89, 0X86, 0X83, 0X7F,
-  0X7B, 0X78, 0X74, 0X6F, 0X6A, 0X65, 0X60, 0X5A, 0X54, 0X4E, 0X46, 0X3F,
-  0X36, 0X2D, 0X23, 0X18, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0C, 0X18, 0X22, 0X2B, 0X34, 0X3C, 0X43, 0X4A, 0X50, 0X56, 0X5C, 0X61,
-  0X66, 0X6A, 0X6F, 0X72, 0X76, 0X7A, 0X7D, 0X80, 0X83, 0X86, 0X88, 0X8B,
-  0X8D, 0X8F, 0X91, 0X93, 0X95, 0X97, 0X98, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E,
-  0X9F, 0XA0, 0XA1, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA4, 0XA4, 0XA4, 0XA4, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA1, 0XA0, 0X9F,
-  0X9E, 0X9D, 0X9C, 0X9B, 0X9A, 0X98, 0X97, 0X95, 0X93, 0X91, 0X8F, 0X8D,
-  0X8B, 0X88, 0X86, 0X83, 0X80, 0X7D, 0X7A, 0X76, 0X72, 0X6F, 0X6A, 0X66,
-  0X61, 0X5C, 0X56, 0X50, 0X4A, 0X43, 0X3C, 0X34, 0X2B, 0X22, 0X18, 0X0C,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X17, 0X20,
-  0X29, 0X31, 0X39, 0X40, 0X47, 0X4D, 0X52, 0X58, 0X5C, 0X61, 0X65, 0X69,
-  0X6D, 0X71, 0X74, 0X77, 0X7A, 0X7D, 0X80, 0X82, 0X85, 0X87, 0X89, 0X8B,
-  0X8D, 0X8E, 0X90, 0X91, 0X93, 0X94, 0X95, 0X96, 0X97, 0X98, 0X99, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9B, 0X9B, 0X9A, 0X9A, 0X99, 0X98, 0X97, 0X96, 0X95, 0X94, 0X93,
-  0X91, 0X90, 0X8E, 0X8D, 0X8B, 0X89, 0X87, 0X85, 0X82, 0X80, 0X7D, 0X7A,
-  0X77, 0X74, 0X71, 0X6D, 0X69, 0X65, 0X61, 0X5C, 0X58, 0X52, 0X4D, 0X47,
-  0X40, 0X39, 0X31, 0X29, 0X20, 0X17, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X16, 0X1F, 0X27, 0X2F, 0X36,
-  0X3D, 0X43, 0X49, 0X4E, 0X53, 0X58, 0X5C, 0X60, 0X64, 0X68, 0X6B, 0X6F,
-  0X72, 0X74, 0X77, 0X7A, 0X7C, 0X7E, 0X80, 0X82, 0X84, 0X86, 0X88, 0X89,
-  0X8B, 0X8C, 0X8D, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X92, 0X93, 0X93, 0X94,
-  0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93, 0X93, 0X92,
-  0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8C, 0X8B, 0X89, 0X88, 0X86, 0X84,
-  0X82, 0X80, 0X7E, 0X7C, 0X7A, 0X77, 0X74, 0X72, 0X6F, 0X6B, 0X68, 0X64,
-  0X60, 0X5C, 0X58, 0X53, 0X4E, 0X49, 0X43, 0X3D, 0X36, 0X2F, 0X27, 0X1F,
-  0X16, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X0B, 0X14, 0X1D, 0X25, 0X2C, 0X33, 0X39, 0X3F, 0X44,
-  0X49, 0X4E, 0X53, 0X57, 0X5B, 0X5F, 0X62, 0X66, 0X69, 0X6C, 0X6F, 0X71,
-  0X74, 0X76, 0X78, 0X7A, 0X7C, 0X7E, 0X7F, 0X81, 0X82, 0X84, 0X85, 0X86,
-  0X87, 0X88, 0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X88, 0X87,
-  0X86, 0X85, 0X84, 0X82, 0X81, 0X7F, 0X7E, 0X7C, 0X7A, 0X78, 0X76, 0X74,
-  0X71, 0X6F, 0X6C, 0X69, 0X66, 0X62, 0X5F, 0X5B, 0X57, 0X53, 0X4E, 0X49,
-  0X44, 0X3F, 0X39, 0X33, 0X2C, 0X25, 0X1D, 0X14, 0X0B, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0A, 0X12, 0X1A, 0X22, 0X29, 0X2F, 0X35, 0X3B, 0X40, 0X45, 0X4A, 0X4E,
-  0X52, 0X56, 0X5A, 0X5D, 0X60, 0X63, 0X66, 0X69, 0X6B, 0X6E, 0X70, 0X72,
-  0X74, 0X76, 0X77, 0X79, 0X7A, 0X7C, 0X7D, 0X7E, 0X7F, 0X80, 0X81, 0X82,
-  0X82, 0X83, 0X83, 0X84, 0X84, 0X84, 0X84, 0X85, 0X85, 0X84, 0X84, 0X84,
-  0X84, 0X83, 0X83, 0X82, 0X82, 0X81, 0X80, 0X7F, 0X7E, 0X7D, 0X7C, 0X7A,
-  0X79, 0X77, 0X76, 0X74, 0X72, 0X70, 0X6E, 0X6B, 0X69, 0X66, 0X63, 0X60,
-  0X5D, 0X5A, 0X56, 0X52, 0X4E, 0X4A, 0X45, 0X40, 0X3B, 0X35, 0X2F, 0X29,
-  0X22, 0X1A, 0X12, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X08, 0X10, 0X18,
-  0X1F, 0X26, 0X2C, 0X31, 0X37, 0X3C, 0X41, 0X45, 0X49, 0X4D, 0X51, 0X54,
-  0X58, 0X5B, 0X5E, 0X60, 0X63, 0X65, 0X67, 0X69, 0X6C, 0X6D, 0X6F, 0X71,
-  0X72, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X7A, 0X7B, 0X7B, 0X7C,
-  0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7A,
-  0X7A, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X72, 0X71, 0X6F, 0X6D, 0X6C,
-  0X69, 0X67, 0X65, 0X63, 0X60, 0X5E, 0X5B, 0X58, 0X54, 0X51, 0X4D, 0X49,
-  0X45, 0X41, 0X3C, 0X37, 0X31, 0X2C, 0X26, 0X1F, 0X18, 0X10, 0X08, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0E, 0X15, 0X1C, 0X22, 0X28,
-  0X2D, 0X32, 0X37, 0X3C, 0X40, 0X44, 0X48, 0X4B, 0X4F, 0X52, 0X55, 0X58,
-  0X5A, 0X5D, 0X5F, 0X61, 0X63, 0X65, 0X67, 0X69, 0X6A, 0X6B, 0X6D, 0X6E,
-  0X6F, 0X70, 0X71, 0X72, 0X72, 0X73, 0X74, 0X74, 0X74, 0X74, 0X75, 0X75,
-  0X75, 0X75, 0X74, 0X74, 0X74, 0X74, 0X73, 0X72, 0X72, 0X71, 0X70, 0X6F,
-  0X6E, 0X6D, 0X6B, 0X6A, 0X69, 0X67, 0X65, 0X63, 0X61, 0X5F, 0X5D, 0X5A,
-  0X58, 0X55, 0X52, 0X4F, 0X4B, 0X48, 0X44, 0X40, 0X3C, 0X37, 0X32, 0X2D,
-  0X28, 0X22, 0X1C, 0X15, 0X0E, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X0B, 0X12, 0X18, 0X1E, 0X24, 0X29, 0X2E, 0X33,
-  0X37, 0X3B, 0X3F, 0X43, 0X46, 0X49, 0X4C, 0X4F, 0X52, 0X54, 0X57, 0X59,
-  0X5B, 0X5D, 0X5F, 0X60, 0X62, 0X63, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A,
-  0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C,
-  0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X66, 0X65, 0X63, 0X62,
-  0X60, 0X5F, 0X5D, 0X5B, 0X59, 0X57, 0X54, 0X52, 0X4F, 0X4C, 0X49, 0X46,
-  0X43, 0X3F, 0X3B, 0X37, 0X33, 0X2E, 0X29, 0X24, 0X1E, 0X18, 0X12, 0X0B,
-  0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X08, 0X0F, 0X15, 0X1B, 0X20, 0X25, 0X2A, 0X2E, 0X32, 0X36, 0X3A,
-  0X3D, 0X41, 0X44, 0X47, 0X49, 0X4C, 0X4E, 0X51, 0X53, 0X55, 0X56, 0X58,
-  0X5A, 0X5B, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63, 0X63, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64, 0X63, 0X63,
-  0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5B, 0X5A, 0X58, 0X56, 0X55, 0X53,
-  0X51, 0X4E, 0X4C, 0X49, 0X47, 0X44, 0X41, 0X3D, 0X3A, 0X36, 0X32, 0X2E,
-  0X2A, 0X25, 0X20, 0X1B, 0X15, 0X0F, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0B,
-  0X11, 0X17, 0X1C, 0X20, 0X25, 0X29, 0X2D, 0X31, 0X35, 0X38, 0X3B, 0X3E,
-  0X41, 0X44, 0X46, 0X48, 0X4A, 0X4C, 0X4E, 0X50, 0X52, 0X53, 0X55, 0X56,
-  0X57, 0X58, 0X59, 0X5A, 0X5B, 0X5B, 0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D,
-  0X5D, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58, 0X57,
-  0X56, 0X55, 0X53, 0X52, 0X50, 0X4E, 0X4C, 0X4A, 0X48, 0X46, 0X44, 0X41,
-  0X3E, 0X3B, 0X38, 0X35, 0X31, 0X2D, 0X29, 0X25, 0X20, 0X1C, 0X17, 0X11,
-  0X0B, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X08, 0X0D, 0X13, 0X17,
-  0X1C, 0X21, 0X25, 0X28, 0X2C, 0X2F, 0X33, 0X36, 0X38, 0X3B, 0X3E, 0X40,
-  0X42, 0X44, 0X46, 0X48, 0X4A, 0X4B, 0X4D, 0X4E, 0X4F, 0X50, 0X51, 0X52,
-  0X53, 0X53, 0X54, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55,
-  0X54, 0X54, 0X53, 0X53, 0X52, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4B, 0X4A,
-  0X48, 0X46, 0X44, 0X42, 0X40, 0X3E, 0X3B, 0X38, 0X36, 0X33, 0X2F, 0X2C,
-  0X28, 0X25, 0X21, 0X1C, 0X17, 0X13, 0X0D, 0X08, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0E, 0X13, 0X18, 0X1C, 0X20,
-  0X23, 0X27, 0X2A, 0X2D, 0X30, 0X33, 0X35, 0X38, 0X3A, 0X3C, 0X3E, 0X40,
-  0X41, 0X43, 0X44, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4B, 0X4B, 0X4C, 0X4C,
-  0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4B,
-  0X4A, 0X49, 0X48, 0X47, 0X46, 0X44, 0X43, 0X41, 0X40, 0X3E, 0X3C, 0X3A,
-  0X38, 0X35, 0X33, 0X30, 0X2D, 0X2A, 0X27, 0X23, 0X20, 0X1C, 0X18, 0X13,
-  0X0E, 0X09, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X05, 0X0A, 0X0F, 0X13, 0X17, 0X1B, 0X1E, 0X22, 0X25,
-  0X28, 0X2A, 0X2D, 0X2F, 0X32, 0X34, 0X36, 0X38, 0X39, 0X3B, 0X3C, 0X3E,
-  0X3F, 0X40, 0X41, 0X42, 0X43, 0X44, 0X44, 0X45, 0X45, 0X45, 0X45, 0X45,
-  0X45, 0X45, 0X45, 0X45, 0X45, 0X44, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3F,
-  0X3E, 0X3C, 0X3B, 0X39, 0X38, 0X36, 0X34, 0X32, 0X2F, 0X2D, 0X2A, 0X28,
-  0X25, 0X22, 0X1E, 0X1B, 0X17, 0X13, 0X0F, 0X0A, 0X05, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X06, 0X0A, 0X0E, 0X12, 0X15, 0X19, 0X1C, 0X1F, 0X22, 0X25, 0X27,
-  0X29, 0X2B, 0X2E, 0X2F, 0X31, 0X33, 0X34, 0X36, 0X37, 0X38, 0X39, 0X3A,
-  0X3B, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3C, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X36, 0X34, 0X33, 0X31,
-  0X2F, 0X2E, 0X2B, 0X29, 0X27, 0X25, 0X22, 0X1F, 0X1C, 0X19, 0X15, 0X12,
-  0X0E, 0X0A, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05,
-  0X09, 0X0D, 0X10, 0X14, 0X17, 0X1A, 0X1C, 0X1F, 0X21, 0X23, 0X25, 0X27,
-  0X29, 0X2B, 0X2C, 0X2E, 0X2F, 0X30, 0X31, 0X32, 0X33, 0X34, 0X34, 0X35,
-  0X35, 0X35, 0X35, 0X36, 0X36, 0X35, 0X35, 0X35, 0X35, 0X34, 0X34, 0X33,
-  0X32, 0X31, 0X30, 0X2F, 0X2E, 0X2C, 0X2B, 0X29, 0X27, 0X25, 0X23, 0X21,
-  0X1F, 0X1C, 0X1A, 0X17, 0X14, 0X10, 0X0D, 0X09, 0X05, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X08, 0X0B,
-  0X0E, 0X11, 0X14, 0X16, 0X19, 0X1B, 0X1D, 0X1F, 0X21, 0X23, 0X24, 0X26,
-  0X27, 0X28, 0X29, 0X2A, 0X2B, 0X2C, 0X2C, 0X2D, 0X2D, 0X2D, 0X2E, 0X2E,
-  0X2E, 0X2E, 0X2D, 0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X28, 0X27,
-  0X26, 0X24, 0X23, 0X21, 0X1F, 0X1D, 0X1B, 0X19, 0X16, 0X14, 0X11, 0X0E,
-  0X0B, 0X08, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X09, 0X0B, 0X0E,
-  0X11, 0X13, 0X15, 0X17, 0X19, 0X1A, 0X1C, 0X1E, 0X1F, 0X20, 0X21, 0X22,
-  0X23, 0X24, 0X24, 0X25, 0X25, 0X25, 0X26, 0X26, 0X26, 0X26, 0X25, 0X25,
-  0X25, 0X24, 0X24, 0X23, 0X22, 0X21, 0X20, 0X1F, 0X1E, 0X1C, 0X1A, 0X19,
-  0X17, 0X15, 0X13, 0X11, 0X0E, 0X0B, 0X09, 0X06, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X06, 0X08, 0X0B, 0X0D, 0X0F,
-  0X11, 0X12, 0X14, 0X16, 0X17, 0X18, 0X19, 0X1A, 0X1B, 0X1C, 0X1C, 0X1D,
-  0X1D, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1D, 0X1D, 0X1C, 0X1C, 0X1B,
-  0X1A, 0X19, 0X18, 0X17, 0X16, 0X14, 0X12, 0X11, 0X0F, 0X0D, 0X0B, 0X08,
-  0X06, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X05, 0X07, 0X09, 0X0A, 0X0C, 0X0D,
-  0X0F, 0X10, 0X11, 0X12, 0X13, 0X14, 0X14, 0X15, 0X15, 0X16, 0X16, 0X16,
-  0X16, 0X16, 0X16, 0X15, 0X15, 0X14, 0X14, 0X13, 0X12, 0X11, 0X10, 0X0F,
-  0X0D, 0X0C, 0X0A, 0X09, 0X07, 0X05, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X05, 0X07, 0X08, 0X09, 0X0A,
-  0X0B, 0X0C, 0X0D, 0X0D, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
-  0X0D, 0X0D, 0X0C, 0X0B, 0X0A, 0X09, 0X08, 0X07, 0X05, 0X04, 0X02, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X03, 0X04, 0X05, 0X05,
-  0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X05, 0X05, 0X04, 0X03,
-  0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00 };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("defaultEye_upper_sym");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("defaultEye_lower_sym");
 #else
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-//uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] = {
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X01, 0X01, 0X01, 0X02, 0X01,
-  0X01, 0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X03, 0X04,
-  0X05, 0X05, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X05,
-  0X05, 0X04, 0X04, 0X03, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X02, 0X03, 0X05, 0X06, 0X07, 0X08, 0X09, 0X09, 0X0A, 0X0B, 0X0B, 0X0B,
-  0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0B, 0X0B, 0X0B, 0X0A, 0X0A, 0X09, 0X08,
-  0X07, 0X06, 0X05, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X06, 0X07, 0X09, 0X0A, 0X0B,
-  0X0C, 0X0D, 0X0D, 0X0E, 0X0F, 0X0F, 0X0F, 0X10, 0X10, 0X10, 0X10, 0X10,
-  0X10, 0X10, 0X10, 0X0F, 0X0F, 0X0E, 0X0E, 0X0D, 0X0C, 0X0C, 0X0A, 0X09,
-  0X08, 0X07, 0X05, 0X04, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04,
-  0X06, 0X08, 0X09, 0X0B, 0X0C, 0X0E, 0X0F, 0X10, 0X11, 0X11, 0X12, 0X13,
-  0X13, 0X13, 0X14, 0X14, 0X14, 0X14, 0X14, 0X14, 0X14, 0X14, 0X14, 0X14,
-  0X13, 0X13, 0X12, 0X12, 0X11, 0X10, 0X0F, 0X0F, 0X0D, 0X0C, 0X0A, 0X09,
-  0X07, 0X05, 0X04, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X05, 0X07, 0X09, 0X0B, 0X0D, 0X0E, 0X10,
-  0X11, 0X12, 0X13, 0X14, 0X15, 0X16, 0X16, 0X17, 0X17, 0X18, 0X18, 0X18,
-  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X16,
-  0X15, 0X15, 0X14, 0X13, 0X12, 0X11, 0X10, 0X0E, 0X0D, 0X0B, 0X0A, 0X07,
-  0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X05,
-  0X08, 0X0A, 0X0D, 0X0F, 0X10, 0X11, 0X13, 0X14, 0X15, 0X16, 0X17, 0X18,
-  0X19, 0X1A, 0X1A, 0X1B, 0X1B, 0X1C, 0X1C, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
-  0X1D, 0X1D, 0X1C, 0X1C, 0X1C, 0X1B, 0X1B, 0X1A, 0X1A, 0X19, 0X18, 0X17,
-  0X16, 0X15, 0X14, 0X13, 0X12, 0X10, 0X0F, 0X0D, 0X0B, 0X09, 0X06, 0X04,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X09, 0X0B, 0X0D, 0X0F, 0X11, 0X13,
-  0X14, 0X16, 0X17, 0X18, 0X1A, 0X1B, 0X1B, 0X1C, 0X1D, 0X1E, 0X1E, 0X1F,
-  0X1F, 0X20, 0X20, 0X20, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X20, 0X20,
-  0X20, 0X1F, 0X1F, 0X1E, 0X1E, 0X1D, 0X1C, 0X1C, 0X1B, 0X1A, 0X19, 0X17,
-  0X16, 0X15, 0X13, 0X12, 0X10, 0X0E, 0X0D, 0X0A, 0X07, 0X04, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X06,
-  0X09, 0X0C, 0X0E, 0X10, 0X12, 0X14, 0X16, 0X17, 0X19, 0X1A, 0X1C, 0X1D,
-  0X1E, 0X1F, 0X20, 0X20, 0X21, 0X22, 0X23, 0X23, 0X23, 0X24, 0X24, 0X24,
-  0X25, 0X25, 0X25, 0X25, 0X25, 0X25, 0X24, 0X24, 0X24, 0X23, 0X23, 0X23,
-  0X22, 0X22, 0X21, 0X20, 0X1F, 0X1E, 0X1D, 0X1C, 0X1B, 0X1A, 0X19, 0X17,
-  0X15, 0X14, 0X12, 0X0F, 0X0D, 0X0B, 0X08, 0X04, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X08, 0X0C, 0X0E, 0X11, 0X13, 0X15,
-  0X17, 0X18, 0X1A, 0X1C, 0X1D, 0X1E, 0X20, 0X21, 0X22, 0X23, 0X23, 0X24,
-  0X25, 0X26, 0X27, 0X27, 0X28, 0X28, 0X28, 0X29, 0X29, 0X29, 0X29, 0X29,
-  0X29, 0X29, 0X29, 0X28, 0X28, 0X28, 0X27, 0X27, 0X26, 0X26, 0X25, 0X24,
-  0X23, 0X22, 0X21, 0X20, 0X1F, 0X1E, 0X1D, 0X1B, 0X1A, 0X18, 0X17, 0X15,
-  0X13, 0X10, 0X0E, 0X0B, 0X08, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03,
-  0X07, 0X0A, 0X0D, 0X10, 0X12, 0X15, 0X17, 0X19, 0X1B, 0X1C, 0X1E, 0X20,
-  0X21, 0X22, 0X23, 0X24, 0X26, 0X27, 0X27, 0X28, 0X29, 0X29, 0X2A, 0X2A,
-  0X2B, 0X2B, 0X2B, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2B,
-  0X2B, 0X2B, 0X2B, 0X2A, 0X2A, 0X29, 0X29, 0X28, 0X27, 0X26, 0X25, 0X24,
-  0X23, 0X22, 0X21, 0X20, 0X1E, 0X1C, 0X1B, 0X19, 0X17, 0X15, 0X13, 0X11,
-  0X0E, 0X0B, 0X07, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X06, 0X09, 0X0D, 0X10, 0X12, 0X15,
-  0X17, 0X1A, 0X1C, 0X1D, 0X1F, 0X21, 0X23, 0X24, 0X25, 0X27, 0X28, 0X29,
-  0X2A, 0X2B, 0X2B, 0X2C, 0X2C, 0X2D, 0X2E, 0X2E, 0X2F, 0X2F, 0X30, 0X30,
-  0X30, 0X30, 0X30, 0X30, 0X30, 0X30, 0X30, 0X30, 0X2F, 0X2F, 0X2F, 0X2E,
-  0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X2A, 0X29, 0X28, 0X27, 0X25, 0X24,
-  0X23, 0X21, 0X20, 0X1E, 0X1C, 0X1A, 0X18, 0X16, 0X14, 0X11, 0X0E, 0X0B,
-  0X06, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X04, 0X08, 0X0C, 0X0F, 0X12, 0X15, 0X17, 0X1A, 0X1C, 0X1E, 0X20, 0X22,
-  0X23, 0X25, 0X27, 0X28, 0X29, 0X2A, 0X2B, 0X2C, 0X2D, 0X2E, 0X2F, 0X30,
-  0X31, 0X31, 0X32, 0X32, 0X33, 0X33, 0X33, 0X33, 0X33, 0X34, 0X34, 0X34,
-  0X34, 0X34, 0X33, 0X33, 0X33, 0X33, 0X32, 0X32, 0X32, 0X31, 0X31, 0X30,
-  0X2F, 0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X2A, 0X28, 0X27, 0X26, 0X24, 0X23,
-  0X21, 0X1F, 0X1D, 0X1B, 0X19, 0X17, 0X14, 0X11, 0X0E, 0X0A, 0X05, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X07, 0X0A, 0X0E, 0X11, 0X14,
-  0X17, 0X19, 0X1C, 0X1E, 0X20, 0X23, 0X25, 0X26, 0X28, 0X2A, 0X2B, 0X2C,
-  0X2D, 0X2F, 0X30, 0X31, 0X32, 0X32, 0X33, 0X34, 0X34, 0X35, 0X35, 0X36,
-  0X36, 0X36, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37,
-  0X37, 0X36, 0X36, 0X36, 0X35, 0X35, 0X34, 0X34, 0X33, 0X33, 0X32, 0X31,
-  0X30, 0X2F, 0X2E, 0X2D, 0X2C, 0X2A, 0X29, 0X28, 0X26, 0X24, 0X23, 0X20,
-  0X1E, 0X1C, 0X1A, 0X17, 0X14, 0X11, 0X0D, 0X08, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X09, 0X0D, 0X10, 0X13, 0X16, 0X19, 0X1C, 0X1E, 0X21, 0X23,
-  0X25, 0X27, 0X29, 0X2A, 0X2C, 0X2D, 0X2F, 0X30, 0X31, 0X32, 0X33, 0X34,
-  0X35, 0X36, 0X36, 0X37, 0X38, 0X39, 0X39, 0X3A, 0X3A, 0X3B, 0X3B, 0X3B,
-  0X3B, 0X3B, 0X3B, 0X3B, 0X3B, 0X3B, 0X3B, 0X3B, 0X3B, 0X3B, 0X3A, 0X3A,
-  0X39, 0X39, 0X38, 0X37, 0X36, 0X36, 0X35, 0X34, 0X34, 0X33, 0X32, 0X31,
-  0X30, 0X2F, 0X2D, 0X2C, 0X2A, 0X29, 0X28, 0X25, 0X24, 0X22, 0X1F, 0X1D,
-  0X1A, 0X17, 0X14, 0X10, 0X0B, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0B, 0X0F, 0X12,
-  0X15, 0X18, 0X1B, 0X1E, 0X20, 0X23, 0X25, 0X28, 0X2A, 0X2B, 0X2D, 0X2E,
-  0X30, 0X32, 0X33, 0X34, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A, 0X3B, 0X3C,
-  0X3C, 0X3D, 0X3D, 0X3E, 0X3E, 0X3E, 0X3E, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
-  0X3F, 0X3F, 0X3F, 0X3F, 0X3E, 0X3E, 0X3E, 0X3E, 0X3D, 0X3D, 0X3C, 0X3C,
-  0X3B, 0X3A, 0X3A, 0X39, 0X38, 0X37, 0X36, 0X35, 0X34, 0X33, 0X32, 0X30,
-  0X2F, 0X2D, 0X2C, 0X2A, 0X29, 0X27, 0X25, 0X22, 0X20, 0X1D, 0X1A, 0X17,
-  0X13, 0X0F, 0X09, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X08, 0X0D, 0X11, 0X14, 0X18, 0X1B, 0X1D, 0X20, 0X23,
-  0X25, 0X28, 0X2A, 0X2B, 0X2D, 0X30, 0X31, 0X32, 0X34, 0X35, 0X36, 0X38,
-  0X39, 0X3A, 0X3B, 0X3C, 0X3D, 0X3E, 0X3E, 0X3F, 0X3F, 0X40, 0X40, 0X41,
-  0X41, 0X41, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42,
-  0X42, 0X41, 0X41, 0X41, 0X40, 0X40, 0X40, 0X3F, 0X3F, 0X3E, 0X3D, 0X3D,
-  0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X36, 0X34, 0X33, 0X32, 0X31, 0X2F,
-  0X2D, 0X2C, 0X2A, 0X28, 0X26, 0X23, 0X20, 0X1D, 0X19, 0X15, 0X11, 0X0C,
-  0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0E,
-  0X12, 0X16, 0X1A, 0X1D, 0X1F, 0X23, 0X25, 0X28, 0X2A, 0X2C, 0X2E, 0X30,
-  0X32, 0X34, 0X35, 0X36, 0X38, 0X3A, 0X3B, 0X3C, 0X3D, 0X3E, 0X3F, 0X40,
-  0X41, 0X41, 0X42, 0X43, 0X43, 0X44, 0X44, 0X44, 0X45, 0X45, 0X45, 0X45,
-  0X46, 0X46, 0X46, 0X46, 0X46, 0X46, 0X46, 0X45, 0X45, 0X45, 0X45, 0X45,
-  0X44, 0X44, 0X43, 0X43, 0X42, 0X42, 0X41, 0X41, 0X40, 0X3F, 0X3E, 0X3E,
-  0X3D, 0X3C, 0X3A, 0X39, 0X38, 0X36, 0X35, 0X34, 0X33, 0X31, 0X2F, 0X2D,
-  0X2B, 0X29, 0X26, 0X23, 0X20, 0X1C, 0X18, 0X14, 0X0F, 0X09, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X05, 0X0A, 0X10, 0X14, 0X18, 0X1C, 0X1F, 0X22,
-  0X25, 0X28, 0X2A, 0X2C, 0X2E, 0X31, 0X32, 0X34, 0X36, 0X38, 0X3A, 0X3B,
-  0X3C, 0X3D, 0X3F, 0X40, 0X41, 0X42, 0X42, 0X43, 0X44, 0X45, 0X45, 0X46,
-  0X46, 0X47, 0X47, 0X48, 0X48, 0X49, 0X49, 0X49, 0X49, 0X4A, 0X4A, 0X4A,
-  0X4A, 0X4A, 0X49, 0X49, 0X49, 0X49, 0X49, 0X48, 0X48, 0X47, 0X47, 0X46,
-  0X46, 0X45, 0X44, 0X44, 0X43, 0X42, 0X42, 0X41, 0X40, 0X3F, 0X3E, 0X3D,
-  0X3C, 0X3B, 0X3A, 0X38, 0X37, 0X35, 0X34, 0X32, 0X30, 0X2E, 0X2C, 0X29,
-  0X26, 0X23, 0X1F, 0X1B, 0X17, 0X12, 0X0B, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X0C, 0X11, 0X15, 0X19, 0X1D, 0X21, 0X24, 0X27, 0X2A, 0X2C, 0X2E, 0X31,
-  0X33, 0X35, 0X37, 0X39, 0X3A, 0X3C, 0X3E, 0X3F, 0X40, 0X41, 0X43, 0X44,
-  0X45, 0X45, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4A, 0X4B, 0X4B, 0X4C, 0X4C,
-  0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4D,
-  0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4C, 0X4B, 0X4B, 0X4A, 0X49, 0X49, 0X48,
-  0X47, 0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3F, 0X3E, 0X3D,
-  0X3C, 0X3B, 0X39, 0X37, 0X35, 0X34, 0X31, 0X2F, 0X2C, 0X29, 0X26, 0X22,
-  0X1F, 0X1A, 0X14, 0X0E, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0D, 0X12, 0X17, 0X1B, 0X1F,
-  0X23, 0X26, 0X29, 0X2C, 0X2E, 0X31, 0X33, 0X35, 0X37, 0X39, 0X3B, 0X3D,
-  0X3E, 0X40, 0X41, 0X42, 0X44, 0X45, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4B,
-  0X4C, 0X4D, 0X4D, 0X4E, 0X4E, 0X4F, 0X4F, 0X4F, 0X50, 0X50, 0X50, 0X50,
-  0X51, 0X51, 0X51, 0X51, 0X51, 0X51, 0X51, 0X50, 0X50, 0X50, 0X50, 0X50,
-  0X4F, 0X4F, 0X4F, 0X4E, 0X4E, 0X4D, 0X4D, 0X4C, 0X4B, 0X4B, 0X4A, 0X49,
-  0X48, 0X47, 0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3F, 0X3E, 0X3C,
-  0X3B, 0X39, 0X37, 0X34, 0X32, 0X2F, 0X2C, 0X29, 0X25, 0X21, 0X1C, 0X16,
-  0X10, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X05, 0X0D, 0X13, 0X18, 0X1C, 0X20, 0X24, 0X28, 0X2A, 0X2D, 0X30,
-  0X32, 0X35, 0X37, 0X39, 0X3B, 0X3D, 0X3F, 0X40, 0X42, 0X43, 0X45, 0X46,
-  0X47, 0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E, 0X4E, 0X4F, 0X50, 0X50, 0X51,
-  0X51, 0X52, 0X52, 0X53, 0X53, 0X53, 0X53, 0X54, 0X54, 0X54, 0X54, 0X54,
-  0X54, 0X54, 0X54, 0X54, 0X53, 0X53, 0X53, 0X53, 0X52, 0X52, 0X52, 0X51,
-  0X51, 0X50, 0X50, 0X4F, 0X4F, 0X4E, 0X4D, 0X4D, 0X4C, 0X4B, 0X4A, 0X49,
-  0X48, 0X47, 0X46, 0X45, 0X44, 0X43, 0X42, 0X40, 0X3F, 0X3E, 0X3C, 0X3A,
-  0X37, 0X35, 0X32, 0X2F, 0X2C, 0X28, 0X23, 0X1E, 0X18, 0X11, 0X08, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0D, 0X13, 0X19,
-  0X1D, 0X22, 0X26, 0X29, 0X2D, 0X2F, 0X32, 0X35, 0X37, 0X39, 0X3C, 0X3E,
-  0X40, 0X41, 0X43, 0X45, 0X46, 0X48, 0X49, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F,
-  0X50, 0X51, 0X52, 0X52, 0X53, 0X53, 0X54, 0X55, 0X55, 0X56, 0X56, 0X56,
-  0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57,
-  0X57, 0X57, 0X57, 0X56, 0X56, 0X56, 0X55, 0X55, 0X55, 0X54, 0X54, 0X53,
-  0X53, 0X52, 0X51, 0X51, 0X50, 0X4F, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A,
-  0X48, 0X47, 0X46, 0X45, 0X44, 0X42, 0X41, 0X3F, 0X3D, 0X3A, 0X38, 0X35,
-  0X32, 0X2F, 0X2B, 0X26, 0X20, 0X1A, 0X13, 0X0A, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X0E, 0X14, 0X1A, 0X1F, 0X23, 0X28, 0X2B, 0X2E,
-  0X32, 0X34, 0X37, 0X3A, 0X3C, 0X3E, 0X40, 0X42, 0X43, 0X45, 0X47, 0X49,
-  0X4A, 0X4C, 0X4D, 0X4E, 0X4F, 0X50, 0X51, 0X52, 0X53, 0X54, 0X55, 0X56,
-  0X56, 0X57, 0X57, 0X58, 0X58, 0X59, 0X59, 0X59, 0X5A, 0X5A, 0X5A, 0X5A,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X5A,
-  0X59, 0X59, 0X59, 0X58, 0X58, 0X58, 0X57, 0X56, 0X56, 0X55, 0X55, 0X54,
-  0X53, 0X53, 0X52, 0X51, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A,
-  0X48, 0X47, 0X45, 0X44, 0X42, 0X40, 0X3E, 0X3C, 0X38, 0X35, 0X32, 0X2D,
-  0X28, 0X23, 0X1C, 0X14, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0E,
-  0X15, 0X1A, 0X20, 0X24, 0X29, 0X2C, 0X30, 0X34, 0X37, 0X39, 0X3C, 0X3E,
-  0X40, 0X42, 0X44, 0X46, 0X48, 0X4A, 0X4C, 0X4D, 0X4F, 0X50, 0X51, 0X52,
-  0X53, 0X54, 0X55, 0X56, 0X57, 0X58, 0X59, 0X59, 0X5A, 0X5B, 0X5B, 0X5C,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C,
-  0X5C, 0X5B, 0X5B, 0X5A, 0X5A, 0X59, 0X59, 0X58, 0X58, 0X57, 0X56, 0X55,
-  0X55, 0X54, 0X53, 0X52, 0X51, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4B, 0X49,
-  0X47, 0X45, 0X43, 0X41, 0X3E, 0X3C, 0X38, 0X35, 0X30, 0X2B, 0X25, 0X1E,
-  0X16, 0X0B, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0C, 0X14, 0X1B, 0X20, 0X26, 0X2A,
-  0X2E, 0X32, 0X35, 0X39, 0X3C, 0X3E, 0X40, 0X43, 0X44, 0X47, 0X49, 0X4B,
-  0X4C, 0X4E, 0X4F, 0X51, 0X52, 0X54, 0X55, 0X56, 0X57, 0X58, 0X59, 0X5A,
-  0X5B, 0X5B, 0X5C, 0X5D, 0X5D, 0X5E, 0X5E, 0X5F, 0X5F, 0X60, 0X60, 0X60,
-  0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61,
-  0X61, 0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X5F, 0X5F, 0X5F, 0X5E, 0X5E,
-  0X5D, 0X5D, 0X5C, 0X5B, 0X5B, 0X5A, 0X5A, 0X59, 0X58, 0X57, 0X57, 0X56,
-  0X55, 0X55, 0X54, 0X53, 0X52, 0X51, 0X50, 0X4E, 0X4D, 0X4B, 0X49, 0X47,
-  0X44, 0X42, 0X3F, 0X3B, 0X37, 0X33, 0X2D, 0X27, 0X20, 0X16, 0X0C, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X0B, 0X14, 0X1B, 0X21, 0X27, 0X2B, 0X30, 0X34, 0X37, 0X3B, 0X3E,
-  0X41, 0X43, 0X45, 0X47, 0X49, 0X4C, 0X4D, 0X4F, 0X51, 0X52, 0X54, 0X55,
-  0X56, 0X58, 0X59, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F, 0X60, 0X60,
-  0X61, 0X62, 0X62, 0X63, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X65, 0X65,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64,
-  0X64, 0X64, 0X63, 0X63, 0X63, 0X62, 0X62, 0X61, 0X61, 0X61, 0X60, 0X5F,
-  0X5F, 0X5E, 0X5E, 0X5D, 0X5C, 0X5C, 0X5B, 0X5A, 0X59, 0X59, 0X58, 0X57,
-  0X56, 0X56, 0X54, 0X53, 0X52, 0X50, 0X4E, 0X4D, 0X4A, 0X48, 0X45, 0X42,
-  0X3F, 0X3A, 0X36, 0X30, 0X29, 0X21, 0X18, 0X0B, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X13, 0X1B, 0X22,
-  0X28, 0X2C, 0X31, 0X35, 0X39, 0X3D, 0X40, 0X42, 0X45, 0X47, 0X4A, 0X4C,
-  0X4E, 0X50, 0X51, 0X53, 0X55, 0X56, 0X57, 0X59, 0X5A, 0X5B, 0X5C, 0X5D,
-  0X5E, 0X5F, 0X60, 0X61, 0X62, 0X62, 0X63, 0X64, 0X64, 0X65, 0X65, 0X66,
-  0X66, 0X67, 0X67, 0X67, 0X67, 0X68, 0X68, 0X68, 0X68, 0X68, 0X68, 0X68,
-  0X68, 0X68, 0X68, 0X68, 0X68, 0X68, 0X68, 0X67, 0X67, 0X67, 0X67, 0X66,
-  0X66, 0X66, 0X65, 0X65, 0X64, 0X64, 0X63, 0X63, 0X62, 0X62, 0X61, 0X61,
-  0X60, 0X5F, 0X5F, 0X5E, 0X5D, 0X5D, 0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58,
-  0X57, 0X55, 0X54, 0X52, 0X50, 0X4E, 0X4C, 0X48, 0X45, 0X41, 0X3D, 0X38,
-  0X32, 0X2B, 0X23, 0X17, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X11, 0X1A, 0X22, 0X28, 0X2E, 0X32, 0X37, 0X3B,
-  0X3F, 0X42, 0X45, 0X47, 0X4A, 0X4D, 0X4F, 0X51, 0X52, 0X54, 0X56, 0X57,
-  0X59, 0X5A, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63, 0X64, 0X65,
-  0X66, 0X66, 0X67, 0X68, 0X68, 0X69, 0X69, 0X6A, 0X6A, 0X6A, 0X6B, 0X6B,
-  0X6B, 0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A, 0X6A, 0X69, 0X69, 0X69,
-  0X68, 0X68, 0X67, 0X67, 0X66, 0X66, 0X65, 0X65, 0X64, 0X63, 0X63, 0X62,
-  0X62, 0X61, 0X60, 0X60, 0X5F, 0X5E, 0X5E, 0X5D, 0X5B, 0X5A, 0X59, 0X57,
-  0X55, 0X53, 0X51, 0X4F, 0X4C, 0X48, 0X44, 0X40, 0X3B, 0X34, 0X2D, 0X23,
-  0X16, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F,
-  0X18, 0X21, 0X29, 0X2E, 0X34, 0X38, 0X3D, 0X40, 0X44, 0X46, 0X4A, 0X4D,
-  0X4F, 0X51, 0X53, 0X55, 0X57, 0X58, 0X5A, 0X5B, 0X5D, 0X5E, 0X5F, 0X61,
-  0X62, 0X63, 0X64, 0X65, 0X66, 0X67, 0X68, 0X68, 0X69, 0X6A, 0X6A, 0X6B,
-  0X6B, 0X6C, 0X6C, 0X6D, 0X6D, 0X6E, 0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F,
-  0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6E, 0X6E,
-  0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B, 0X6B, 0X6A,
-  0X6A, 0X69, 0X69, 0X68, 0X68, 0X67, 0X67, 0X66, 0X65, 0X65, 0X64, 0X64,
-  0X63, 0X63, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5B, 0X59, 0X57, 0X55,
-  0X53, 0X4F, 0X4C, 0X48, 0X43, 0X3D, 0X37, 0X2E, 0X23, 0X14, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0B, 0X17, 0X20, 0X28, 0X2F, 0X34,
-  0X3A, 0X3E, 0X42, 0X45, 0X49, 0X4C, 0X4F, 0X51, 0X54, 0X56, 0X58, 0X5A,
-  0X5B, 0X5D, 0X5E, 0X60, 0X61, 0X62, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69,
-  0X6A, 0X6B, 0X6C, 0X6C, 0X6D, 0X6E, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X70,
-  0X71, 0X71, 0X71, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X73, 0X73, 0X73,
-  0X73, 0X73, 0X73, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X71, 0X71, 0X71,
-  0X71, 0X70, 0X70, 0X70, 0X6F, 0X6F, 0X6F, 0X6E, 0X6E, 0X6D, 0X6D, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X69, 0X68, 0X68, 0X67, 0X66, 0X66,
-  0X65, 0X64, 0X63, 0X61, 0X60, 0X5E, 0X5D, 0X5B, 0X58, 0X56, 0X53, 0X4F,
-  0X4B, 0X46, 0X40, 0X38, 0X2F, 0X22, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X07, 0X14, 0X1E, 0X27, 0X2F, 0X35, 0X3B, 0X40, 0X43, 0X47, 0X4B,
-  0X4E, 0X51, 0X54, 0X56, 0X58, 0X5A, 0X5C, 0X5E, 0X5F, 0X61, 0X62, 0X64,
-  0X65, 0X66, 0X67, 0X69, 0X6A, 0X6B, 0X6C, 0X6C, 0X6D, 0X6E, 0X6F, 0X70,
-  0X70, 0X71, 0X71, 0X72, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75,
-  0X75, 0X75, 0X75, 0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X76,
-  0X76, 0X75, 0X75, 0X75, 0X75, 0X75, 0X74, 0X74, 0X74, 0X74, 0X73, 0X73,
-  0X73, 0X72, 0X72, 0X71, 0X71, 0X71, 0X70, 0X70, 0X6F, 0X6F, 0X6E, 0X6E,
-  0X6D, 0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X69, 0X68, 0X67,
-  0X66, 0X64, 0X63, 0X61, 0X5F, 0X5C, 0X5A, 0X56, 0X52, 0X4E, 0X48, 0X42,
-  0X3A, 0X2E, 0X1F, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0F, 0X1C, 0X25,
-  0X2D, 0X35, 0X3B, 0X40, 0X44, 0X48, 0X4D, 0X50, 0X53, 0X55, 0X58, 0X5A,
-  0X5C, 0X5E, 0X60, 0X62, 0X63, 0X65, 0X66, 0X67, 0X69, 0X6A, 0X6B, 0X6C,
-  0X6D, 0X6E, 0X6F, 0X70, 0X71, 0X71, 0X72, 0X73, 0X74, 0X74, 0X75, 0X75,
-  0X76, 0X76, 0X77, 0X77, 0X77, 0X78, 0X78, 0X78, 0X78, 0X78, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X79, 0X79, 0X79, 0X79, 0X79, 0X79, 0X79, 0X78, 0X78,
-  0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X76, 0X76, 0X76, 0X75, 0X75, 0X75,
-  0X74, 0X74, 0X74, 0X73, 0X73, 0X72, 0X72, 0X71, 0X71, 0X71, 0X70, 0X70,
-  0X70, 0X6F, 0X6F, 0X6E, 0X6E, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X66,
-  0X64, 0X62, 0X5F, 0X5C, 0X59, 0X55, 0X51, 0X4B, 0X43, 0X39, 0X2C, 0X18,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X0C, 0X19, 0X24, 0X2D, 0X34, 0X3B, 0X41, 0X46,
-  0X4A, 0X4E, 0X52, 0X55, 0X58, 0X5A, 0X5D, 0X5F, 0X61, 0X63, 0X65, 0X66,
-  0X68, 0X69, 0X6A, 0X6C, 0X6D, 0X6E, 0X6F, 0X70, 0X71, 0X72, 0X73, 0X74,
-  0X75, 0X75, 0X76, 0X77, 0X78, 0X78, 0X79, 0X79, 0X7A, 0X7A, 0X7A, 0X7B,
-  0X7B, 0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7B,
-  0X7B, 0X7A, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X78, 0X78, 0X78, 0X77,
-  0X77, 0X76, 0X76, 0X76, 0X75, 0X75, 0X74, 0X74, 0X74, 0X74, 0X73, 0X73,
-  0X72, 0X72, 0X71, 0X70, 0X6F, 0X6E, 0X6D, 0X6B, 0X6A, 0X68, 0X66, 0X63,
-  0X60, 0X5D, 0X59, 0X54, 0X4D, 0X44, 0X39, 0X28, 0X0E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07,
-  0X15, 0X21, 0X2B, 0X34, 0X3B, 0X42, 0X47, 0X4C, 0X50, 0X54, 0X57, 0X5A,
-  0X5D, 0X5F, 0X61, 0X64, 0X66, 0X67, 0X69, 0X6A, 0X6C, 0X6D, 0X6E, 0X70,
-  0X71, 0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X77, 0X78, 0X79, 0X7A, 0X7A,
-  0X7B, 0X7B, 0X7C, 0X7C, 0X7D, 0X7D, 0X7E, 0X7E, 0X7E, 0X7F, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7E, 0X7D, 0X7D,
-  0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X7A, 0X79,
-  0X79, 0X79, 0X78, 0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X76, 0X76, 0X75,
-  0X74, 0X73, 0X72, 0X71, 0X70, 0X6E, 0X6C, 0X6A, 0X67, 0X64, 0X60, 0X5C,
-  0X56, 0X4F, 0X45, 0X37, 0X21, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X11, 0X1E, 0X29, 0X33, 0X3B,
-  0X42, 0X48, 0X4D, 0X51, 0X55, 0X59, 0X5C, 0X5F, 0X62, 0X64, 0X66, 0X68,
-  0X6A, 0X6C, 0X6E, 0X6F, 0X70, 0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78,
-  0X79, 0X7A, 0X7B, 0X7C, 0X7C, 0X7D, 0X7E, 0X7E, 0X7F, 0X7F, 0X80, 0X80,
-  0X81, 0X81, 0X81, 0X81, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X83,
-  0X83, 0X83, 0X83, 0X83, 0X83, 0X83, 0X83, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X82, 0X82, 0X82, 0X82, 0X81, 0X81, 0X81, 0X81, 0X81, 0X80, 0X80, 0X80,
-  0X80, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7D, 0X7D, 0X7D, 0X7D, 0X7C,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7A, 0X7A, 0X79, 0X78, 0X77, 0X76,
-  0X75, 0X74, 0X72, 0X70, 0X6E, 0X6B, 0X68, 0X64, 0X5F, 0X59, 0X51, 0X44,
-  0X32, 0X12, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X0D, 0X1B, 0X27, 0X31, 0X3A, 0X41, 0X48, 0X4F, 0X53, 0X57,
-  0X5B, 0X5E, 0X62, 0X64, 0X67, 0X69, 0X6B, 0X6D, 0X6F, 0X70, 0X72, 0X73,
-  0X74, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7D, 0X7E, 0X7E, 0X7F,
-  0X80, 0X80, 0X81, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X83, 0X84, 0X84,
-  0X84, 0X84, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84,
-  0X84, 0X84, 0X83, 0X83, 0X83, 0X83, 0X83, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80,
-  0X80, 0X7F, 0X7F, 0X7F, 0X7E, 0X7D, 0X7D, 0X7C, 0X7B, 0X7A, 0X78, 0X77,
-  0X74, 0X72, 0X6F, 0X6C, 0X68, 0X62, 0X5B, 0X51, 0X42, 0X27, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X17, 0X24,
-  0X2F, 0X39, 0X41, 0X48, 0X4F, 0X54, 0X59, 0X5D, 0X60, 0X63, 0X66, 0X69,
-  0X6B, 0X6E, 0X70, 0X72, 0X73, 0X75, 0X77, 0X78, 0X79, 0X7A, 0X7B, 0X7C,
-  0X7D, 0X7E, 0X7F, 0X80, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X84, 0X85,
-  0X85, 0X86, 0X86, 0X86, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88, 0X88, 0X89,
-  0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89,
-  0X89, 0X89, 0X89, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X87, 0X87, 0X87,
-  0X87, 0X87, 0X86, 0X86, 0X86, 0X86, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84,
-  0X84, 0X84, 0X84, 0X83, 0X83, 0X83, 0X83, 0X83, 0X83, 0X83, 0X83, 0X83,
-  0X82, 0X82, 0X82, 0X81, 0X80, 0X7F, 0X7E, 0X7D, 0X7B, 0X79, 0X77, 0X74,
-  0X70, 0X6C, 0X65, 0X5D, 0X50, 0X3B, 0X10, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X06, 0X15, 0X21, 0X2D, 0X37, 0X40, 0X48, 0X4F,
-  0X55, 0X5A, 0X5F, 0X63, 0X66, 0X69, 0X6C, 0X6E, 0X71, 0X73, 0X75, 0X76,
-  0X78, 0X79, 0X7B, 0X7C, 0X7D, 0X7E, 0X7F, 0X81, 0X81, 0X82, 0X82, 0X83,
-  0X84, 0X85, 0X85, 0X86, 0X86, 0X87, 0X88, 0X88, 0X89, 0X89, 0X89, 0X8A,
-  0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C,
-  0X8C, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X89,
-  0X89, 0X89, 0X89, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X87, 0X87, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X86, 0X86, 0X85,
-  0X85, 0X84, 0X83, 0X82, 0X81, 0X80, 0X7E, 0X7C, 0X79, 0X75, 0X6F, 0X68,
-  0X5D, 0X4C, 0X28, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03,
-  0X11, 0X1F, 0X2B, 0X35, 0X3F, 0X48, 0X50, 0X56, 0X5B, 0X60, 0X64, 0X68,
-  0X6B, 0X6E, 0X71, 0X73, 0X75, 0X77, 0X79, 0X7B, 0X7D, 0X7E, 0X80, 0X80,
-  0X81, 0X82, 0X83, 0X84, 0X85, 0X86, 0X86, 0X87, 0X88, 0X89, 0X89, 0X8A,
-  0X8B, 0X8B, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D, 0X8E, 0X8E, 0X8E, 0X8E, 0X8F,
-  0X8F, 0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F,
-  0X8F, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X89, 0X88,
-  0X87, 0X86, 0X84, 0X83, 0X80, 0X7D, 0X79, 0X73, 0X6A, 0X5C, 0X40, 0X0A,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0E, 0X1C, 0X29, 0X33, 0X3E,
-  0X47, 0X4F, 0X56, 0X5D, 0X62, 0X66, 0X6A, 0X6E, 0X71, 0X74, 0X76, 0X78,
-  0X7B, 0X7C, 0X7E, 0X80, 0X81, 0X82, 0X83, 0X84, 0X85, 0X86, 0X87, 0X88,
-  0X89, 0X8A, 0X8A, 0X8B, 0X8C, 0X8C, 0X8D, 0X8D, 0X8E, 0X8F, 0X8F, 0X8F,
-  0X90, 0X90, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92, 0X92, 0X92, 0X93, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X91, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F,
-  0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8E, 0X8D, 0X8C, 0X8B, 0X89,
-  0X87, 0X85, 0X82, 0X7E, 0X76, 0X6B, 0X55, 0X1B, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X0B, 0X1A, 0X27, 0X32, 0X3C, 0X46, 0X4F, 0X56, 0X5D, 0X63,
-  0X68, 0X6C, 0X70, 0X73, 0X76, 0X79, 0X7B, 0X7D, 0X7F, 0X81, 0X83, 0X84,
-  0X85, 0X86, 0X88, 0X89, 0X89, 0X8B, 0X8B, 0X8C, 0X8D, 0X8E, 0X8E, 0X8F,
-  0X90, 0X90, 0X91, 0X92, 0X92, 0X93, 0X93, 0X93, 0X94, 0X94, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X94,
-  0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93, 0X93, 0X93, 0X93, 0X94,
-  0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X94, 0X94, 0X94, 0X93, 0X93, 0X92, 0X92, 0X91, 0X8F, 0X8D, 0X8A, 0X86,
-  0X81, 0X79, 0X68, 0X35, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X17, 0X25,
-  0X31, 0X3C, 0X45, 0X4E, 0X56, 0X5D, 0X63, 0X69, 0X6E, 0X72, 0X76, 0X79,
-  0X7C, 0X7E, 0X81, 0X82, 0X84, 0X85, 0X87, 0X88, 0X8A, 0X8B, 0X8C, 0X8D,
-  0X8E, 0X8F, 0X8F, 0X90, 0X91, 0X92, 0X92, 0X93, 0X94, 0X94, 0X95, 0X95,
-  0X95, 0X96, 0X96, 0X96, 0X97, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99,
-  0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97,
-  0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X97, 0X97, 0X97, 0X97, 0X97,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99,
-  0X98, 0X98, 0X97, 0X97, 0X96, 0X95, 0X93, 0X90, 0X8C, 0X85, 0X79, 0X54,
-  0X00, 0X00, 0X00, 0X00, 0X06, 0X15, 0X22, 0X2E, 0X39, 0X44, 0X4D, 0X55,
-  0X5D, 0X63, 0X6A, 0X6F, 0X74, 0X78, 0X7B, 0X7E, 0X81, 0X82, 0X84, 0X86,
-  0X88, 0X8A, 0X8B, 0X8C, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X93, 0X93, 0X94,
-  0X95, 0X95, 0X96, 0X96, 0X96, 0X97, 0X97, 0X98, 0X98, 0X99, 0X99, 0X99,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9C, 0X9C, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X99,
-  0X99, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D, 0X9D, 0X9D,
-  0X9C, 0X9B, 0X9A, 0X98, 0X95, 0X91, 0X88, 0X6E, 0X00, 0X00, 0X00, 0X05,
-  0X14, 0X21, 0X2D, 0X38, 0X43, 0X4D, 0X55, 0X5D, 0X64, 0X6B, 0X70, 0X75,
-  0X7A, 0X7D, 0X80, 0X83, 0X85, 0X87, 0X89, 0X8B, 0X8D, 0X8E, 0X90, 0X91,
-  0X93, 0X94, 0X94, 0X95, 0X96, 0X96, 0X97, 0X98, 0X98, 0X99, 0X99, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9E, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9F, 0X9F, 0X9F, 0XA0, 0XA0, 0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA1,
-  0X9F, 0X9C, 0X96, 0X86, 0X00, 0X00, 0X03, 0X13, 0X20, 0X2C, 0X37, 0X42,
-  0X4C, 0X55, 0X5D, 0X64, 0X6B, 0X72, 0X77, 0X7C, 0X80, 0X83, 0X86, 0X89,
-  0X8B, 0X8D, 0X8F, 0X91, 0X92, 0X94, 0X95, 0X95, 0X96, 0X97, 0X98, 0X99,
-  0X9A, 0X9A, 0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F,
-  0XA0, 0XA0, 0XA0, 0XA1, 0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1,
-  0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3,
-  0XA4, 0XA4, 0XA4, 0XA4, 0XA5, 0XA5, 0XA6, 0XA6, 0XA6, 0XA7, 0XA7, 0XA8,
-  0XA8, 0XA8, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA8, 0XA7, 0XA4, 0X9B,
-  0X00, 0X01, 0X10, 0X20, 0X2C, 0X37, 0X42, 0X4C, 0X55, 0X5D, 0X65, 0X6C,
-  0X73, 0X79, 0X7E, 0X82, 0X85, 0X89, 0X8B, 0X8E, 0X90, 0X92, 0X94, 0X95,
-  0X97, 0X98, 0X99, 0X9A, 0X9B, 0X9C, 0X9D, 0X9D, 0X9E, 0X9F, 0X9F, 0XA0,
-  0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA4, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA4,
-  0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA4, 0XA5, 0XA5, 0XA5, 0XA5, 0XA6, 0XA6, 0XA7, 0XA7, 0XA8, 0XA8, 0XA9,
-  0XA9, 0XAA, 0XAA, 0XAB, 0XAB, 0XAC, 0XAC, 0XAD, 0XAD, 0XAE, 0XAE, 0XAF,
-  0XAF, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1, 0XB1, 0XAE, 0X00, 0X08, 0X1E, 0X2C,
-  0X37, 0X42, 0X4C, 0X55, 0X5E, 0X66, 0X6D, 0X74, 0X7A, 0X80, 0X84, 0X88,
-  0X8B, 0X8F, 0X91, 0X94, 0X95, 0X97, 0X99, 0X9A, 0X9B, 0X9C, 0X9E, 0X9F,
-  0XA0, 0XA0, 0XA1, 0XA2, 0XA2, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA5, 0XA5,
-  0XA5, 0XA6, 0XA6, 0XA6, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8, 0XA8, 0XA9,
-  0XA9, 0XA9, 0XAA, 0XAB, 0XAB, 0XAC, 0XAC, 0XAD, 0XAE, 0XAE, 0XAF, 0XAF,
-  0XB0, 0XB0, 0XB1, 0XB1, 0XB2, 0XB3, 0XB4, 0XB5, 0XB5, 0XB6, 0XB7, 0XB8,
-  0XB9, 0XBB, 0XBC, 0XBE, 0X02, 0X17, 0X2B, 0X38, 0X42, 0X4C, 0X55, 0X5E,
-  0X67, 0X6E, 0X75, 0X7B, 0X81, 0X86, 0X8A, 0X8E, 0X91, 0X94, 0X97, 0X98,
-  0X9A, 0X9C, 0X9D, 0X9F, 0XA0, 0XA1, 0XA2, 0XA3, 0XA4, 0XA4, 0XA5, 0XA6,
-  0XA6, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9, 0XA9, 0XAA, 0XAA, 0XAA,
-  0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAB, 0XAB, 0XAB,
-  0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB,
-  0XAB, 0XAB, 0XAB, 0XAC, 0XAC, 0XAC, 0XAC, 0XAD, 0XAD, 0XAE, 0XAE, 0XAF,
-  0XAF, 0XB0, 0XB0, 0XB1, 0XB1, 0XB2, 0XB3, 0XB3, 0XB4, 0XB5, 0XB6, 0XB6,
-  0XB7, 0XB8, 0XB9, 0XBA, 0XBB, 0XBD, 0XBE, 0XC0, 0XC2, 0XC4, 0XC7, 0XCD,
-  0X09, 0X25, 0X37, 0X43, 0X4D, 0X56, 0X5F, 0X67, 0X6F, 0X77, 0X7D, 0X82,
-  0X87, 0X8C, 0X91, 0X94, 0X97, 0X9A, 0X9C, 0X9E, 0XA0, 0XA2, 0XA3, 0XA3,
-  0XA5, 0XA5, 0XA6, 0XA7, 0XA8, 0XA9, 0XA9, 0XAA, 0XAA, 0XAB, 0XAB, 0XAC,
-  0XAC, 0XAC, 0XAD, 0XAD, 0XAD, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAE, 0XAE, 0XAE, 0XAE,
-  0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1, 0XB2, 0XB2, 0XB3, 0XB4, 0XB4,
-  0XB5, 0XB6, 0XB7, 0XB8, 0XB9, 0XBA, 0XBA, 0XBB, 0XBC, 0XBD, 0XBE, 0XC0,
-  0XC1, 0XC3, 0XC4, 0XC7, 0XC9, 0XCD, 0XD1, 0XDA, 0X16, 0X32, 0X43, 0X4F,
-  0X58, 0X60, 0X69, 0X70, 0X78, 0X7F, 0X84, 0X8A, 0X8F, 0X93, 0X97, 0X9A,
-  0X9D, 0X9F, 0XA2, 0XA4, 0XA5, 0XA6, 0XA7, 0XA8, 0XA9, 0XAA, 0XAB, 0XAC,
-  0XAD, 0XAD, 0XAE, 0XAE, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB2, 0XB2, 0XB2, 0XB2, 0XB3, 0XB3, 0XB3,
-  0XB4, 0XB5, 0XB5, 0XB6, 0XB7, 0XB7, 0XB8, 0XB9, 0XBA, 0XBA, 0XBB, 0XBC,
-  0XBD, 0XBD, 0XBF, 0XC0, 0XC1, 0XC2, 0XC4, 0XC5, 0XC7, 0XC9, 0XCB, 0XCD,
-  0XD1, 0XD5, 0XDB, 0XE6, 0X25, 0X3F, 0X4E, 0X59, 0X62, 0X6A, 0X72, 0X79,
-  0X80, 0X86, 0X8C, 0X91, 0X96, 0X99, 0X9D, 0XA0, 0XA3, 0XA5, 0XA7, 0XA9,
-  0XAA, 0XAB, 0XAD, 0XAE, 0XAF, 0XAF, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1, 0XB2,
-  0XB2, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB7, 0XB7, 0XB8, 0XB8, 0XB9, 0XBA,
-  0XBA, 0XBB, 0XBB, 0XBC, 0XBD, 0XBE, 0XBF, 0XC0, 0XC1, 0XC2, 0XC4, 0XC4,
-  0XC6, 0XC7, 0XC9, 0XCB, 0XCC, 0XCE, 0XD1, 0XD4, 0XD7, 0XDD, 0XE4, 0XF1,
-  0X34, 0X4B, 0X5A, 0X64, 0X6C, 0X74, 0X7B, 0X82, 0X88, 0X8E, 0X93, 0X98,
-  0X9C, 0XA0, 0XA3, 0XA6, 0XA8, 0XAB, 0XAC, 0XAE, 0XAF, 0XB0, 0XB1, 0XB2,
-  0XB2, 0XB3, 0XB4, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB7, 0XB7, 0XB7, 0XB8,
-  0XB8, 0XB8, 0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBB, 0XBB, 0XBC, 0XBC, 0XBD, 0XBE, 0XBF, 0XBF, 0XC0,
-  0XC1, 0XC2, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC9, 0XCA, 0XCC, 0XCE, 0XD0,
-  0XD1, 0XD4, 0XD6, 0XDA, 0XDE, 0XE4, 0XEC, 0XFA, 0X42, 0X57, 0X65, 0X6E,
-  0X76, 0X7E, 0X84, 0X8A, 0X91, 0X96, 0X9B, 0X9F, 0XA3, 0XA6, 0XA9, 0XAC,
-  0XAF, 0XB0, 0XB2, 0XB3, 0XB4, 0XB5, 0XB6, 0XB7, 0XB8, 0XB8, 0XB9, 0XB9,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE,
-  0XBE, 0XBF, 0XC0, 0XC1, 0XC1, 0XC2, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC8,
-  0XC9, 0XCB, 0XCC, 0XCD, 0XCF, 0XD0, 0XD2, 0XD5, 0XD6, 0XD9, 0XDD, 0XE0,
-  0XE5, 0XEB, 0XF4, 0XFE, 0X4E, 0X62, 0X6F, 0X78, 0X7F, 0X86, 0X8C, 0X93,
-  0X98, 0X9D, 0XA1, 0XA5, 0XA9, 0XAD, 0XAF, 0XB1, 0XB3, 0XB5, 0XB7, 0XB8,
-  0XB9, 0XBA, 0XBA, 0XBB, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBE, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE,
-  0XBE, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC1, 0XC1, 0XC2, 0XC3, 0XC3, 0XC4,
-  0XC5, 0XC5, 0XC6, 0XC7, 0XC8, 0XC9, 0XCB, 0XCC, 0XCD, 0XCE, 0XD0, 0XD1,
-  0XD3, 0XD5, 0XD6, 0XD9, 0XDB, 0XDE, 0XE1, 0XE6, 0XEA, 0XF1, 0XFB, 0XFF,
-  0X5B, 0X6E, 0X7A, 0X82, 0X89, 0X8F, 0X95, 0X9B, 0XA1, 0XA5, 0XA9, 0XAD,
-  0XB0, 0XB3, 0XB5, 0XB8, 0XB9, 0XBB, 0XBC, 0XBD, 0XBD, 0XBE, 0XBF, 0XC0,
-  0XC0, 0XC1, 0XC1, 0XC1, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC1, 0XC1,
-  0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1,
-  0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3,
-  0XC4, 0XC4, 0XC4, 0XC5, 0XC5, 0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XCB,
-  0XCD, 0XCD, 0XCE, 0XCF, 0XD1, 0XD2, 0XD4, 0XD6, 0XD7, 0XD9, 0XDB, 0XDE,
-  0XE0, 0XE3, 0XE7, 0XEB, 0XF0, 0XF8, 0XFF, 0XFF, 0X68, 0X7A, 0X84, 0X8C,
-  0X93, 0X98, 0X9E, 0XA3, 0XA8, 0XAC, 0XB0, 0XB3, 0XB7, 0XBA, 0XBB, 0XBD,
-  0XBF, 0XC0, 0XC1, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC5, 0XC5, 0XC5, 0XC6,
-  0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6,
-  0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6,
-  0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4,
-  0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4,
-  0XC4, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC6, 0XC6, 0XC6, 0XC7, 0XC7, 0XC8,
-  0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCD, 0XCE, 0XCF, 0XD0, 0XD1, 0XD2, 0XD4,
-  0XD5, 0XD6, 0XD8, 0XDA, 0XDC, 0XDE, 0XDF, 0XE2, 0XE5, 0XE8, 0XEC, 0XF1,
-  0XF7, 0XFD, 0XFF, 0XFF, 0X75, 0X85, 0X8F, 0X96, 0X9D, 0XA2, 0XA7, 0XAC,
-  0XB0, 0XB4, 0XB7, 0XBB, 0XBD, 0XC0, 0XC2, 0XC3, 0XC5, 0XC6, 0XC7, 0XC7,
-  0XC8, 0XC8, 0XC9, 0XC9, 0XC9, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9,
-  0XC9, 0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC9, 0XC9, 0XCA, 0XCA, 0XCB, 0XCB, 0XCC, 0XCD, 0XCD, 0XCE, 0XCF,
-  0XCF, 0XD0, 0XD1, 0XD3, 0XD4, 0XD5, 0XD6, 0XD7, 0XD9, 0XDB, 0XDC, 0XDE,
-  0XE0, 0XE2, 0XE4, 0XE7, 0XE9, 0XED, 0XF1, 0XF6, 0XFC, 0XFF, 0XFF, 0XFF,
-  0X82, 0X91, 0X9A, 0XA1, 0XA6, 0XAB, 0XB0, 0XB4, 0XB8, 0XBB, 0XBE, 0XC1,
-  0XC4, 0XC6, 0XC7, 0XC9, 0XCA, 0XCB, 0XCC, 0XCD, 0XCD, 0XCD, 0XCD, 0XCE,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC,
-  0XCC, 0XCC, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCD, 0XCD,
-  0XCD, 0XCE, 0XCE, 0XCF, 0XCF, 0XD0, 0XD1, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6,
-  0XD7, 0XD8, 0XDA, 0XDB, 0XDD, 0XDE, 0XE0, 0XE2, 0XE4, 0XE6, 0XE8, 0XEC,
-  0XEE, 0XF2, 0XF6, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0X8F, 0X9C, 0XA4, 0XAA,
-  0XB0, 0XB4, 0XB8, 0XBC, 0XC0, 0XC3, 0XC6, 0XC8, 0XCB, 0XCC, 0XCE, 0XCF,
-  0XD0, 0XD0, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2,
-  0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCE, 0XCE,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCE, 0XCE, 0XCF, 0XCF, 0XCF, 0XD0, 0XD0, 0XD0, 0XD1, 0XD2, 0XD2,
-  0XD3, 0XD4, 0XD5, 0XD6, 0XD6, 0XD7, 0XD8, 0XDA, 0XDB, 0XDC, 0XDE, 0XDF,
-  0XE1, 0XE2, 0XE4, 0XE6, 0XE8, 0XEB, 0XED, 0XF0, 0XF3, 0XF7, 0XFB, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0X9B, 0XA7, 0XAF, 0XB4, 0XB9, 0XBD, 0XC1, 0XC4,
-  0XC8, 0XCB, 0XCD, 0XCF, 0XD1, 0XD2, 0XD4, 0XD5, 0XD5, 0XD6, 0XD6, 0XD7,
-  0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7,
-  0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1, 0XD1, 0XD2,
-  0XD2, 0XD2, 0XD3, 0XD3, 0XD4, 0XD4, 0XD5, 0XD6, 0XD6, 0XD7, 0XD8, 0XD9,
-  0XDA, 0XDB, 0XDC, 0XDD, 0XDF, 0XE0, 0XE1, 0XE3, 0XE5, 0XE6, 0XE8, 0XEA,
-  0XEC, 0XEF, 0XF1, 0XF4, 0XF7, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XA8, 0XB2, 0XB9, 0XBE, 0XC2, 0XC6, 0XC9, 0XCD, 0XD0, 0XD2, 0XD4, 0XD6,
-  0XD7, 0XD9, 0XDA, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC,
-  0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA,
-  0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7,
-  0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD4, 0XD4, 0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD7,
-  0XD7, 0XD8, 0XD8, 0XD9, 0XDA, 0XDB, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1,
-  0XE2, 0XE4, 0XE5, 0XE6, 0XE8, 0XEA, 0XEC, 0XEE, 0XF0, 0XF3, 0XF5, 0XF8,
-  0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XB5, 0XBE, 0XC3, 0XC8,
-  0XCB, 0XCF, 0XD2, 0XD4, 0XD7, 0XD9, 0XDB, 0XDD, 0XDE, 0XDF, 0XE0, 0XE0,
-  0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0,
-  0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD,
-  0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA,
-  0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7,
-  0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD7, 0XD7,
-  0XD7, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDC, 0XDC,
-  0XDD, 0XDE, 0XDF, 0XE0, 0XE0, 0XE2, 0XE3, 0XE4, 0XE6, 0XE7, 0XE8, 0XEA,
-  0XEC, 0XEE, 0XF0, 0XF2, 0XF4, 0XF7, 0XF9, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XC1, 0XC8, 0XCD, 0XD0, 0XD4, 0XD7, 0XD9, 0XDC,
-  0XDE, 0XE0, 0XE1, 0XE3, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE6, 0XE6, 0XE5,
-  0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3,
-  0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF,
-  0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC,
-  0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA,
-  0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9,
-  0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XDA, 0XDA, 0XDA, 0XDA, 0XDB, 0XDB,
-  0XDB, 0XDC, 0XDC, 0XDD, 0XDD, 0XDE, 0XDF, 0XDF, 0XE0, 0XE1, 0XE2, 0XE3,
-  0XE4, 0XE5, 0XE6, 0XE7, 0XE9, 0XEA, 0XEC, 0XEE, 0XEF, 0XF1, 0XF3, 0XF5,
-  0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XCE, 0XD3, 0XD7, 0XDA, 0XDD, 0XE0, 0XE2, 0XE4, 0XE6, 0XE7, 0XE8, 0XE9,
-  0XEA, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XE9,
-  0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6,
-  0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE1,
-  0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD,
-  0XDD, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDD, 0XDD,
-  0XDD, 0XDD, 0XDD, 0XDD, 0XDE, 0XDE, 0XDE, 0XDE, 0XDF, 0XDF, 0XE0, 0XE0,
-  0XE0, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE5, 0XE6, 0XE7, 0XE9, 0XEA, 0XEB,
-  0XED, 0XEE, 0XEF, 0XF1, 0XF3, 0XF5, 0XF7, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDA, 0XDE, 0XE1, 0XE4,
-  0XE6, 0XE8, 0XEA, 0XEC, 0XED, 0XEE, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF1,
-  0XF1, 0XF0, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XED,
-  0XED, 0XEC, 0XEC, 0XEB, 0XEB, 0XEA, 0XEA, 0XE9, 0XE9, 0XE8, 0XE8, 0XE7,
-  0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4,
-  0XE3, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF,
-  0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XE1, 0XE1, 0XE2, 0XE2, 0XE3, 0XE3, 0XE4, 0XE5, 0XE5, 0XE6,
-  0XE6, 0XE7, 0XE8, 0XEA, 0XEB, 0XEC, 0XED, 0XEE, 0XF0, 0XF1, 0XF3, 0XF5,
-  0XF6, 0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XE8, 0XE9, 0XEC, 0XED, 0XEF, 0XF1, 0XF3, 0XF4,
-  0XF5, 0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF6, 0XF5,
-  0XF5, 0XF4, 0XF4, 0XF3, 0XF3, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF,
-  0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEB, 0XEB, 0XEA, 0XEA,
-  0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6,
-  0XE6, 0XE5, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2,
-  0XE2, 0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE4, 0XE4, 0XE4, 0XE5,
-  0XE5, 0XE6, 0XE6, 0XE6, 0XE7, 0XE8, 0XE8, 0XE9, 0XEA, 0XEB, 0XEC, 0XED,
-  0XEE, 0XEF, 0XF1, 0XF2, 0XF4, 0XF5, 0XF7, 0XF8, 0XFA, 0XFC, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF5, 0XF5, 0XF5, 0XF7, 0XF8, 0XF9, 0XFB, 0XFB, 0XFC, 0XFC, 0XFD, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8,
-  0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF4, 0XF3, 0XF3, 0XF2, 0XF2, 0XF1,
-  0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XEC, 0XEC,
-  0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE7,
-  0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5,
-  0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE9, 0XE9,
-  0XEA, 0XEB, 0XEC, 0XED, 0XED, 0XEE, 0XEF, 0XF0, 0XF1, 0XF3, 0XF4, 0XF5,
-  0XF7, 0XF8, 0XFA, 0XFC, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFC, 0XFB, 0XFA, 0XFA,
-  0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF3,
-  0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE,
-  0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA,
-  0XEA, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8,
-  0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE9, 0XE9, 0XE9, 0XE9,
-  0XEA, 0XEA, 0XEB, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XF0,
-  0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC, 0XFC, 0XFB,
-  0XFB, 0XFA, 0XF9, 0XF9, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4,
-  0XF4, 0XF4, 0XF3, 0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF,
-  0XEF, 0XEE, 0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XED, 0XED, 0XEC, 0XEC,
-  0XEC, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB,
-  0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XED, 0XED, 0XED, 0XED, 0XEE,
-  0XEE, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7,
-  0XF8, 0XFA, 0XFB, 0XFC, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD,
-  0XFC, 0XFC, 0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6,
-  0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF1,
-  0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF4,
-  0XF4, 0XF5, 0XF5, 0XF6, 0XF7, 0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE,
-  0XFD, 0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF7,
-  0XF6, 0XF6, 0XF6, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF3, 0XF3,
-  0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2, 0XF3,
-  0XF3, 0XF3, 0XF4, 0XF4, 0XF5, 0XF5, 0XF5, 0XF6, 0XF7, 0XF7, 0XF8, 0XF9,
-  0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFE, 0XFE, 0XFD, 0XFD, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9,
-  0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF6, 0XF5, 0XF5,
-  0XF5, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF4, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF6, 0XF6, 0XF6, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF9, 0XFA, 0XFA, 0XFB, 0XFC, 0XFD, 0XFD, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB,
-  0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8, 0XF8, 0XF7, 0XF7,
-  0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF8, 0XF8, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFC,
-  0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC,
-  0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB,
-  0XFC, 0XFC, 0XFC, 0XFD, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFE,
-  0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-//uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] = {
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFA, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XF0, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XCB, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XEE, 0XB7, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XDE, 0XA4,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF0, 0XCC, 0X90, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF9, 0XE0, 0XBB, 0X7C, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XEB, 0XD0, 0XA9, 0X68,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XF2, 0XDC, 0XC0, 0X97, 0X53, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF5, 0XE4,
-  0XCE, 0XB0, 0X86, 0X3D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XE8, 0XD6, 0XBE, 0XA0, 0X74, 0X2A,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XF7, 0XEA, 0XDA, 0XC7, 0XAF, 0X8F, 0X62, 0X1A, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF6, 0XEA, 0XDD, 0XCD, 0XB9,
-  0XA0, 0X7F, 0X4F, 0X0D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFD, 0XF5, 0XEB, 0XDF, 0XD1, 0XC0, 0XAC, 0X92, 0X70, 0X3E, 0X05,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF7,
-  0XF6, 0XF6, 0XF7, 0XF8, 0XFA, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFB, 0XF2, 0XEA, 0XDF,
-  0XD2, 0XC4, 0XB3, 0X9D, 0X82, 0X5F, 0X2A, 0X00, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XF9, 0XF4, 0XEE, 0XE9, 0XE6, 0XE4, 0XE4, 0XE4, 0XE5, 0XE7, 0XEA,
-  0XEC, 0XEF, 0XF2, 0XF6, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFD, 0XF7, 0XEF, 0XE6, 0XDE, 0XD3, 0XC5, 0XB7, 0XA5, 0X8E,
-  0X73, 0X4E, 0X17, 0X00, 0XFF, 0XFD, 0XF8, 0XF0, 0XE7, 0XE0, 0XDA, 0XD5,
-  0XD2, 0XD0, 0XD0, 0XD1, 0XD3, 0XD5, 0XD8, 0XDB, 0XDF, 0XE3, 0XE6, 0XEA,
-  0XED, 0XF0, 0XF4, 0XF7, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFA, 0XF3, 0XEC,
-  0XE4, 0XDB, 0XD2, 0XC6, 0XB9, 0XA9, 0X97, 0X80, 0X64, 0X3C, 0X09, 0X00,
-  0XF1, 0XE5, 0XDA, 0XD1, 0XCA, 0XC4, 0XBF, 0XBB, 0XBA, 0XBA, 0XBB, 0XBE,
-  0XC1, 0XC5, 0XC9, 0XCE, 0XD2, 0XD6, 0XDA, 0XDE, 0XE2, 0XE5, 0XE9, 0XEC,
-  0XEF, 0XF2, 0XF5, 0XF8, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFB, 0XF5, 0XEF, 0XE8, 0XE0, 0XD8, 0XCF, 0XC5, 0XB9,
-  0XAB, 0X9C, 0X88, 0X71, 0X54, 0X2A, 0X01, 0X00, 0XCB, 0XC2, 0XBA, 0XB3,
-  0XAD, 0XA8, 0XA5, 0XA3, 0XA3, 0XA5, 0XA8, 0XAC, 0XB1, 0XB6, 0XBB, 0XC0,
-  0XC5, 0XCA, 0XCE, 0XD3, 0XD7, 0XDA, 0XDE, 0XE2, 0XE5, 0XE8, 0XEC, 0XEE,
-  0XF1, 0XF4, 0XF7, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFA, 0XF6, 0XF0,
-  0XEA, 0XE4, 0XDD, 0XD5, 0XCD, 0XC3, 0XB9, 0XAD, 0X9F, 0X8E, 0X7B, 0X62,
-  0X43, 0X17, 0X00, 0X00, 0XA1, 0X9D, 0X98, 0X93, 0X8F, 0X8B, 0X8A, 0X8A,
-  0X8D, 0X91, 0X95, 0X9B, 0XA0, 0XA6, 0XAC, 0XB2, 0XB7, 0XBD, 0XC2, 0XC7,
-  0XCB, 0XCF, 0XD3, 0XD7, 0XDB, 0XDE, 0XE2, 0XE4, 0XE8, 0XEB, 0XED, 0XF0,
-  0XF2, 0XF5, 0XF7, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFC, 0XF9, 0XF4, 0XF0, 0XEB, 0XE5, 0XDF, 0XD8, 0XD1, 0XC9,
-  0XC0, 0XB6, 0XAC, 0XA0, 0X91, 0X80, 0X6C, 0X53, 0X32, 0X09, 0X00, 0X00,
-  0X74, 0X76, 0X75, 0X73, 0X70, 0X6F, 0X6F, 0X72, 0X77, 0X7C, 0X82, 0X89,
-  0X90, 0X97, 0X9E, 0XA5, 0XAB, 0XB1, 0XB6, 0XBB, 0XC0, 0XC4, 0XC9, 0XCD,
-  0XD1, 0XD4, 0XD7, 0XDB, 0XDE, 0XE1, 0XE4, 0XE7, 0XE9, 0XEC, 0XEE, 0XF1,
-  0XF2, 0XF5, 0XF7, 0XF9, 0XFB, 0XFC, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XF9, 0XF6, 0XF2, 0XEE,
-  0XEA, 0XE5, 0XE0, 0XDA, 0XD4, 0XCD, 0XC6, 0XBD, 0XB4, 0XAA, 0XA0, 0X93,
-  0X84, 0X73, 0X5E, 0X43, 0X20, 0X01, 0X00, 0X00, 0X3F, 0X4B, 0X4F, 0X51,
-  0X51, 0X51, 0X54, 0X59, 0X60, 0X68, 0X70, 0X78, 0X80, 0X88, 0X90, 0X97,
-  0X9E, 0XA4, 0XAA, 0XB0, 0XB5, 0XB9, 0XBE, 0XC2, 0XC6, 0XCA, 0XCD, 0XD1,
-  0XD4, 0XD7, 0XDB, 0XDD, 0XE0, 0XE3, 0XE5, 0XE7, 0XEA, 0XEC, 0XEE, 0XF0,
-  0XF2, 0XF4, 0XF6, 0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD,
-  0XFB, 0XF9, 0XF6, 0XF3, 0XEF, 0XEB, 0XE7, 0XE3, 0XDF, 0XD9, 0XD4, 0XCF,
-  0XC8, 0XC1, 0XBA, 0XB1, 0XA8, 0X9E, 0X93, 0X86, 0X77, 0X65, 0X4F, 0X33,
-  0X0E, 0X00, 0X00, 0X00, 0X09, 0X1A, 0X26, 0X2C, 0X2F, 0X33, 0X39, 0X41,
-  0X4B, 0X54, 0X5E, 0X67, 0X71, 0X7A, 0X82, 0X8A, 0X91, 0X98, 0X9E, 0XA4,
-  0XA9, 0XAE, 0XB3, 0XB8, 0XBC, 0XC0, 0XC4, 0XC7, 0XCB, 0XCE, 0XD1, 0XD4,
-  0XD6, 0XD9, 0XDC, 0XDE, 0XE1, 0XE3, 0XE5, 0XE7, 0XEA, 0XEB, 0XED, 0XEF,
-  0XF1, 0XF2, 0XF4, 0XF6, 0XF7, 0XF9, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFE, 0XFD, 0XFB, 0XF9, 0XF7, 0XF4, 0XF2, 0XEF, 0XEB, 0XE8,
-  0XE4, 0XE0, 0XDC, 0XD8, 0XD4, 0XCF, 0XC9, 0XC3, 0XBD, 0XB6, 0XAE, 0XA6,
-  0X9C, 0X92, 0X86, 0X79, 0X69, 0X57, 0X3F, 0X22, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X06, 0X0B, 0X12, 0X1C, 0X28, 0X35, 0X41, 0X4C, 0X57,
-  0X61, 0X6B, 0X74, 0X7D, 0X84, 0X8B, 0X92, 0X98, 0X9E, 0XA3, 0XA8, 0XAD,
-  0XB1, 0XB5, 0XB9, 0XBD, 0XC1, 0XC4, 0XC7, 0XCB, 0XCD, 0XD0, 0XD3, 0XD5,
-  0XD7, 0XDA, 0XDC, 0XDF, 0XE0, 0XE3, 0XE4, 0XE6, 0XE8, 0XEA, 0XEC, 0XED,
-  0XEF, 0XF0, 0XF2, 0XF3, 0XF4, 0XF6, 0XF6, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC,
-  0XFC, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFC, 0XFB, 0XFA, 0XF9, 0XF7, 0XF5, 0XF3,
-  0XF1, 0XEF, 0XEC, 0XEA, 0XE7, 0XE4, 0XE1, 0XDD, 0XDA, 0XD6, 0XD1, 0XCD,
-  0XC8, 0XC3, 0XBE, 0XB8, 0XB1, 0XAA, 0XA2, 0X99, 0X90, 0X85, 0X7A, 0X6C,
-  0X5C, 0X48, 0X30, 0X10, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X04, 0X10, 0X20, 0X2F, 0X3B, 0X48, 0X54, 0X5E, 0X68, 0X71,
-  0X79, 0X81, 0X87, 0X8E, 0X94, 0X99, 0X9E, 0XA3, 0XA8, 0XAC, 0XB0, 0XB4,
-  0XB8, 0XBB, 0XBE, 0XC2, 0XC4, 0XC7, 0XCA, 0XCD, 0XCF, 0XD2, 0XD4, 0XD6,
-  0XD8, 0XDB, 0XDD, 0XDF, 0XE0, 0XE2, 0XE4, 0XE6, 0XE7, 0XE9, 0XEA, 0XEB,
-  0XED, 0XEE, 0XEF, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF7,
-  0XF8, 0XF9, 0XF9, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFC, 0XFC, 0XFC,
-  0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF7, 0XF6,
-  0XF5, 0XF4, 0XF3, 0XF1, 0XF0, 0XEE, 0XEC, 0XEA, 0XE8, 0XE6, 0XE4, 0XE1,
-  0XDE, 0XDB, 0XD7, 0XD4, 0XD0, 0XCC, 0XC7, 0XC3, 0XBE, 0XB9, 0XB4, 0XAE,
-  0XA7, 0X9F, 0X97, 0X8E, 0X84, 0X79, 0X6E, 0X5F, 0X4F, 0X3A, 0X20, 0X04,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0A, 0X1B, 0X29, 0X37, 0X44, 0X50, 0X5A, 0X63, 0X6C, 0X74, 0X7C, 0X82,
-  0X88, 0X8E, 0X93, 0X98, 0X9D, 0XA2, 0XA6, 0XAA, 0XAE, 0XB1, 0XB5, 0XB8,
-  0XBB, 0XBE, 0XC1, 0XC4, 0XC6, 0XC9, 0XCB, 0XCE, 0XD0, 0XD2, 0XD4, 0XD6,
-  0XD8, 0XDA, 0XDB, 0XDD, 0XDF, 0XE0, 0XE2, 0XE3, 0XE5, 0XE6, 0XE7, 0XE8,
-  0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XEE, 0XEF, 0XEF, 0XF0, 0XF1, 0XF1, 0XF1,
-  0XF2, 0XF2, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF2,
-  0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XEF, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE8,
-  0XE6, 0XE5, 0XE3, 0XE0, 0XDE, 0XDC, 0XD9, 0XD6, 0XD3, 0XD0, 0XCD, 0XC9,
-  0XC5, 0XC1, 0XBC, 0XB8, 0XB3, 0XAE, 0XA8, 0XA2, 0X9B, 0X94, 0X8B, 0X82,
-  0X78, 0X6D, 0X61, 0X52, 0X40, 0X2A, 0X0F, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X17, 0X27,
-  0X35, 0X41, 0X4C, 0X56, 0X5F, 0X67, 0X6F, 0X76, 0X7D, 0X82, 0X88, 0X8D,
-  0X92, 0X97, 0X9C, 0XA0, 0XA3, 0XA7, 0XAB, 0XAE, 0XB1, 0XB4, 0XB7, 0XBA,
-  0XBD, 0XC0, 0XC2, 0XC4, 0XC6, 0XC9, 0XCB, 0XCD, 0XCF, 0XD1, 0XD3, 0XD4,
-  0XD6, 0XD7, 0XD9, 0XDA, 0XDC, 0XDD, 0XDE, 0XE0, 0XE1, 0XE2, 0XE3, 0XE4,
-  0XE4, 0XE5, 0XE6, 0XE7, 0XE7, 0XE8, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA, 0XEA,
-  0XEA, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE8, 0XE7,
-  0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE1, 0XE0, 0XDE, 0XDD, 0XDB, 0XD9, 0XD6,
-  0XD4, 0XD2, 0XCF, 0XCC, 0XC9, 0XC5, 0XC2, 0XBE, 0XBA, 0XB5, 0XB1, 0XAC,
-  0XA8, 0XA2, 0X9C, 0X96, 0X8F, 0X87, 0X7F, 0X76, 0X6B, 0X5F, 0X53, 0X43,
-  0X31, 0X1A, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X15, 0X25, 0X32, 0X3E, 0X49,
-  0X52, 0X5B, 0X63, 0X6A, 0X71, 0X77, 0X7D, 0X82, 0X88, 0X8C, 0X91, 0X95,
-  0X99, 0X9D, 0XA1, 0XA4, 0XA7, 0XAB, 0XAE, 0XB1, 0XB3, 0XB6, 0XB9, 0XBB,
-  0XBE, 0XC0, 0XC2, 0XC4, 0XC6, 0XC8, 0XCA, 0XCC, 0XCD, 0XCF, 0XD1, 0XD2,
-  0XD3, 0XD5, 0XD6, 0XD7, 0XD8, 0XDA, 0XDA, 0XDB, 0XDC, 0XDD, 0XDE, 0XDF,
-  0XDF, 0XE0, 0XE0, 0XE1, 0XE1, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2,
-  0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE0, 0XDF, 0XDF, 0XDE, 0XDD, 0XDC, 0XDB,
-  0XDA, 0XD8, 0XD6, 0XD5, 0XD3, 0XD1, 0XCF, 0XCD, 0XCA, 0XC8, 0XC4, 0XC1,
-  0XBE, 0XBA, 0XB7, 0XB3, 0XAF, 0XAA, 0XA6, 0XA1, 0X9C, 0X97, 0X91, 0X8A,
-  0X83, 0X7C, 0X73, 0X69, 0X5E, 0X52, 0X45, 0X35, 0X21, 0X09, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X14, 0X23, 0X2F, 0X3B, 0X45, 0X4E, 0X56, 0X5E,
-  0X65, 0X6B, 0X72, 0X77, 0X7D, 0X81, 0X86, 0X8B, 0X8F, 0X93, 0X97, 0X9A,
-  0X9E, 0XA1, 0XA4, 0XA7, 0XAA, 0XAD, 0XAF, 0XB2, 0XB4, 0XB7, 0XB9, 0XBB,
-  0XBD, 0XBF, 0XC1, 0XC3, 0XC5, 0XC6, 0XC8, 0XC9, 0XCB, 0XCC, 0XCD, 0XCF,
-  0XD0, 0XD1, 0XD2, 0XD3, 0XD4, 0XD5, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8,
-  0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8, 0XD8,
-  0XD7, 0XD7, 0XD6, 0XD5, 0XD4, 0XD4, 0XD3, 0XD1, 0XD0, 0XCE, 0XCC, 0XCB,
-  0XC9, 0XC7, 0XC5, 0XC2, 0XC0, 0XBD, 0XBA, 0XB7, 0XB3, 0XB0, 0XAC, 0XA8,
-  0XA3, 0X9F, 0X9A, 0X96, 0X91, 0X8B, 0X84, 0X7E, 0X77, 0X6F, 0X66, 0X5C,
-  0X51, 0X44, 0X37, 0X26, 0X10, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X13, 0X20, 0X2D, 0X37, 0X41, 0X4A, 0X52, 0X59, 0X5F, 0X66, 0X6C,
-  0X72, 0X77, 0X7C, 0X80, 0X84, 0X89, 0X8D, 0X91, 0X94, 0X97, 0X9A, 0X9E,
-  0XA1, 0XA3, 0XA6, 0XA9, 0XAB, 0XAE, 0XB0, 0XB2, 0XB4, 0XB6, 0XB8, 0XBA,
-  0XBC, 0XBE, 0XBF, 0XC1, 0XC2, 0XC4, 0XC5, 0XC6, 0XC7, 0XC9, 0XC9, 0XCA,
-  0XCB, 0XCC, 0XCD, 0XCE, 0XCE, 0XCF, 0XCF, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCD, 0XCD,
-  0XCB, 0XCA, 0XC9, 0XC8, 0XC6, 0XC4, 0XC3, 0XC1, 0XBF, 0XBD, 0XBA, 0XB8,
-  0XB5, 0XB2, 0XAF, 0XAC, 0XA8, 0XA5, 0XA1, 0X9C, 0X98, 0X94, 0X8F, 0X8A,
-  0X84, 0X7F, 0X79, 0X72, 0X6B, 0X63, 0X5A, 0X4F, 0X44, 0X36, 0X28, 0X15,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X11, 0X1E,
-  0X2A, 0X34, 0X3D, 0X45, 0X4D, 0X54, 0X5A, 0X60, 0X67, 0X6C, 0X71, 0X76,
-  0X7A, 0X7F, 0X82, 0X86, 0X8A, 0X8D, 0X91, 0X94, 0X97, 0X9A, 0X9C, 0XA0,
-  0XA2, 0XA4, 0XA7, 0XA9, 0XAB, 0XAD, 0XAF, 0XB1, 0XB3, 0XB5, 0XB7, 0XB8,
-  0XBA, 0XBB, 0XBC, 0XBD, 0XBE, 0XC0, 0XC1, 0XC2, 0XC3, 0XC4, 0XC4, 0XC5,
-  0XC6, 0XC6, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC7, 0XC7, 0XC7, 0XC6, 0XC5, 0XC5, 0XC4, 0XC3, 0XC2, 0XC1, 0XC0, 0XBE,
-  0XBC, 0XBB, 0XB9, 0XB7, 0XB5, 0XB2, 0XB0, 0XAE, 0XAB, 0XA8, 0XA4, 0XA1,
-  0X9D, 0X99, 0X95, 0X91, 0X8D, 0X87, 0X82, 0X7E, 0X79, 0X73, 0X6C, 0X66,
-  0X5E, 0X56, 0X4D, 0X42, 0X36, 0X27, 0X18, 0X05, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0E, 0X1B, 0X26, 0X30, 0X39,
-  0X41, 0X47, 0X4F, 0X55, 0X5B, 0X60, 0X66, 0X6B, 0X70, 0X74, 0X78, 0X7C,
-  0X80, 0X83, 0X86, 0X8A, 0X8D, 0X90, 0X93, 0X96, 0X98, 0X9B, 0X9D, 0XA0,
-  0XA2, 0XA4, 0XA6, 0XA8, 0XAA, 0XAC, 0XAE, 0XAF, 0XB1, 0XB2, 0XB3, 0XB5,
-  0XB6, 0XB7, 0XB8, 0XB9, 0XBA, 0XBB, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE, 0XBE,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE, 0XBD,
-  0XBC, 0XBC, 0XBA, 0XBA, 0XB8, 0XB7, 0XB6, 0XB4, 0XB3, 0XB1, 0XAF, 0XAD,
-  0XAB, 0XA8, 0XA6, 0XA3, 0XA0, 0X9D, 0X9A, 0X96, 0X92, 0X8E, 0X8A, 0X85,
-  0X81, 0X7C, 0X77, 0X72, 0X6D, 0X67, 0X60, 0X59, 0X52, 0X49, 0X3F, 0X34,
-  0X27, 0X18, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X0B, 0X17, 0X22, 0X2B, 0X34, 0X3B, 0X42, 0X49,
-  0X50, 0X55, 0X5B, 0X60, 0X65, 0X69, 0X6D, 0X72, 0X75, 0X79, 0X7D, 0X80,
-  0X83, 0X86, 0X89, 0X8C, 0X8F, 0X92, 0X94, 0X96, 0X99, 0X9B, 0X9D, 0X9F,
-  0XA1, 0XA3, 0XA5, 0XA6, 0XA8, 0XA9, 0XAB, 0XAC, 0XAD, 0XAE, 0XAF, 0XB0,
-  0XB1, 0XB2, 0XB3, 0XB3, 0XB4, 0XB4, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB5, 0XB5, 0XB4, 0XB4, 0XB3, 0XB2, 0XB1, 0XB0,
-  0XAF, 0XAE, 0XAD, 0XAB, 0XA9, 0XA7, 0XA5, 0XA2, 0XA1, 0X9E, 0X9B, 0X98,
-  0X95, 0X92, 0X8F, 0X8B, 0X87, 0X83, 0X7F, 0X7A, 0X75, 0X70, 0X6B, 0X66,
-  0X60, 0X5A, 0X54, 0X4C, 0X44, 0X3B, 0X31, 0X25, 0X18, 0X07, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X08, 0X13, 0X1D, 0X27, 0X2E, 0X36, 0X3D, 0X43, 0X49, 0X50, 0X55,
-  0X5A, 0X5E, 0X63, 0X67, 0X6B, 0X6F, 0X72, 0X76, 0X79, 0X7D, 0X80, 0X83,
-  0X85, 0X88, 0X8A, 0X8D, 0X90, 0X92, 0X94, 0X96, 0X98, 0X9A, 0X9C, 0X9D,
-  0X9F, 0XA0, 0XA2, 0XA3, 0XA4, 0XA6, 0XA7, 0XA8, 0XA8, 0XA9, 0XAA, 0XAB,
-  0XAC, 0XAC, 0XAC, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD,
-  0XAC, 0XAC, 0XAB, 0XAB, 0XAA, 0XA9, 0XA8, 0XA7, 0XA5, 0XA4, 0XA3, 0XA1,
-  0X9F, 0X9D, 0X9B, 0X98, 0X96, 0X94, 0X91, 0X8E, 0X8B, 0X87, 0X83, 0X80,
-  0X7C, 0X78, 0X73, 0X6E, 0X69, 0X64, 0X5F, 0X59, 0X54, 0X4E, 0X47, 0X3F,
-  0X37, 0X2D, 0X23, 0X16, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0E,
-  0X18, 0X21, 0X29, 0X30, 0X37, 0X3E, 0X44, 0X48, 0X4F, 0X53, 0X58, 0X5C,
-  0X60, 0X64, 0X68, 0X6B, 0X6F, 0X72, 0X75, 0X79, 0X7C, 0X7F, 0X81, 0X83,
-  0X86, 0X88, 0X8A, 0X8D, 0X8F, 0X91, 0X93, 0X94, 0X96, 0X97, 0X99, 0X9A,
-  0X9B, 0X9D, 0X9E, 0X9F, 0XA0, 0XA1, 0XA1, 0XA2, 0XA3, 0XA3, 0XA4, 0XA4,
-  0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA3, 0XA3, 0XA2, 0XA1,
-  0XA1, 0XA0, 0X9E, 0X9D, 0X9B, 0X9A, 0X99, 0X97, 0X95, 0X93, 0X91, 0X8E,
-  0X8C, 0X89, 0X85, 0X82, 0X7F, 0X7C, 0X78, 0X74, 0X70, 0X6C, 0X67, 0X62,
-  0X5D, 0X58, 0X52, 0X4D, 0X47, 0X40, 0X3A, 0X32, 0X29, 0X1E, 0X13, 0X05,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0A, 0X13, 0X1C, 0X24,
-  0X2C, 0X32, 0X39, 0X3E, 0X44, 0X48, 0X4E, 0X52, 0X56, 0X5A, 0X5E, 0X62,
-  0X65, 0X69, 0X6C, 0X6F, 0X72, 0X76, 0X78, 0X7B, 0X7D, 0X80, 0X82, 0X84,
-  0X86, 0X88, 0X8A, 0X8C, 0X8E, 0X8F, 0X91, 0X92, 0X93, 0X95, 0X96, 0X97,
-  0X97, 0X98, 0X99, 0X9A, 0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9C, 0X9B, 0X9B, 0X9B, 0X9A, 0X99, 0X99, 0X97, 0X97, 0X95, 0X94,
-  0X93, 0X91, 0X90, 0X8E, 0X8C, 0X89, 0X87, 0X84, 0X82, 0X7F, 0X7C, 0X79,
-  0X76, 0X72, 0X6E, 0X6A, 0X65, 0X61, 0X5C, 0X57, 0X52, 0X4D, 0X46, 0X41,
-  0X3B, 0X34, 0X2D, 0X25, 0X1B, 0X10, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0E, 0X16, 0X1E, 0X25, 0X2C, 0X32,
-  0X38, 0X3D, 0X42, 0X47, 0X4B, 0X50, 0X54, 0X57, 0X5B, 0X5F, 0X62, 0X65,
-  0X68, 0X6B, 0X6E, 0X71, 0X74, 0X76, 0X79, 0X7B, 0X7D, 0X7F, 0X81, 0X83,
-  0X84, 0X86, 0X87, 0X89, 0X8A, 0X8B, 0X8D, 0X8E, 0X8F, 0X90, 0X90, 0X91,
-  0X92, 0X92, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X92,
-  0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8C, 0X8A, 0X89, 0X87, 0X85, 0X83,
-  0X81, 0X7F, 0X7D, 0X7A, 0X77, 0X74, 0X71, 0X6E, 0X6A, 0X67, 0X62, 0X5E,
-  0X5A, 0X55, 0X50, 0X4B, 0X45, 0X40, 0X39, 0X34, 0X2D, 0X26, 0X1F, 0X16,
-  0X0B, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X07, 0X10, 0X18, 0X1F, 0X25, 0X2C, 0X31, 0X36, 0X3B,
-  0X40, 0X44, 0X48, 0X4D, 0X50, 0X54, 0X57, 0X5B, 0X5E, 0X61, 0X64, 0X67,
-  0X6A, 0X6C, 0X6F, 0X71, 0X73, 0X75, 0X78, 0X79, 0X7B, 0X7D, 0X7E, 0X80,
-  0X81, 0X82, 0X83, 0X84, 0X85, 0X86, 0X87, 0X88, 0X88, 0X89, 0X89, 0X89,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X89, 0X88, 0X88, 0X87, 0X86, 0X85,
-  0X84, 0X83, 0X82, 0X80, 0X7F, 0X7D, 0X7C, 0X79, 0X77, 0X75, 0X72, 0X6F,
-  0X6C, 0X69, 0X66, 0X62, 0X5F, 0X5B, 0X57, 0X52, 0X4E, 0X49, 0X43, 0X3E,
-  0X38, 0X32, 0X2C, 0X26, 0X1F, 0X17, 0X0F, 0X05, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X09, 0X11, 0X18, 0X1F, 0X24, 0X2A, 0X2F, 0X34, 0X39, 0X3D, 0X41,
-  0X45, 0X49, 0X4D, 0X51, 0X54, 0X57, 0X5A, 0X5D, 0X60, 0X62, 0X65, 0X67,
-  0X6A, 0X6C, 0X6E, 0X70, 0X72, 0X73, 0X75, 0X77, 0X78, 0X79, 0X7A, 0X7C,
-  0X7D, 0X7E, 0X7E, 0X7F, 0X7F, 0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X80,
-  0X80, 0X80, 0X80, 0X7F, 0X7E, 0X7E, 0X7D, 0X7C, 0X7B, 0X7A, 0X78, 0X77,
-  0X75, 0X73, 0X71, 0X6F, 0X6C, 0X6A, 0X67, 0X64, 0X61, 0X5E, 0X5A, 0X57,
-  0X53, 0X4F, 0X4A, 0X46, 0X41, 0X3C, 0X36, 0X31, 0X2A, 0X24, 0X1D, 0X17,
-  0X0F, 0X07, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0A,
-  0X11, 0X17, 0X1D, 0X23, 0X28, 0X2D, 0X31, 0X36, 0X3A, 0X3E, 0X42, 0X45,
-  0X49, 0X4D, 0X50, 0X52, 0X55, 0X58, 0X5B, 0X5D, 0X60, 0X62, 0X64, 0X66,
-  0X68, 0X6A, 0X6B, 0X6D, 0X6E, 0X70, 0X71, 0X72, 0X73, 0X74, 0X75, 0X75,
-  0X76, 0X76, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X76, 0X76, 0X75,
-  0X75, 0X74, 0X73, 0X72, 0X71, 0X6F, 0X6E, 0X6C, 0X6A, 0X69, 0X66, 0X64,
-  0X62, 0X5F, 0X5C, 0X59, 0X56, 0X52, 0X4F, 0X4B, 0X47, 0X42, 0X3E, 0X39,
-  0X34, 0X2F, 0X29, 0X22, 0X1C, 0X15, 0X0E, 0X06, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X09, 0X10, 0X16,
-  0X1B, 0X20, 0X25, 0X2A, 0X2E, 0X33, 0X37, 0X3B, 0X3E, 0X42, 0X45, 0X48,
-  0X4B, 0X4E, 0X51, 0X53, 0X56, 0X58, 0X5A, 0X5C, 0X5F, 0X60, 0X62, 0X63,
-  0X65, 0X66, 0X67, 0X69, 0X6A, 0X6B, 0X6B, 0X6C, 0X6D, 0X6D, 0X6D, 0X6E,
-  0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6A, 0X69, 0X68,
-  0X67, 0X65, 0X64, 0X62, 0X60, 0X5E, 0X5C, 0X59, 0X57, 0X54, 0X51, 0X4E,
-  0X4A, 0X46, 0X43, 0X3F, 0X3A, 0X36, 0X31, 0X2C, 0X26, 0X20, 0X1A, 0X14,
-  0X0C, 0X05, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X07, 0X0D, 0X13, 0X18, 0X1E,
-  0X22, 0X27, 0X2B, 0X2F, 0X33, 0X37, 0X3A, 0X3D, 0X40, 0X43, 0X46, 0X49,
-  0X4C, 0X4E, 0X50, 0X53, 0X55, 0X56, 0X58, 0X5A, 0X5B, 0X5D, 0X5E, 0X5F,
-  0X60, 0X61, 0X62, 0X62, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64,
-  0X64, 0X63, 0X62, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5C, 0X5B, 0X59, 0X57,
-  0X55, 0X53, 0X51, 0X4E, 0X4C, 0X48, 0X45, 0X42, 0X3E, 0X3A, 0X36, 0X31,
-  0X2E, 0X28, 0X23, 0X1E, 0X18, 0X12, 0X0B, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X0A, 0X10, 0X15, 0X1A, 0X1F, 0X23,
-  0X27, 0X2B, 0X2F, 0X32, 0X35, 0X39, 0X3C, 0X3F, 0X41, 0X44, 0X46, 0X48,
-  0X4B, 0X4D, 0X4E, 0X50, 0X52, 0X53, 0X54, 0X56, 0X57, 0X57, 0X58, 0X59,
-  0X59, 0X5A, 0X5A, 0X5A, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X59, 0X59, 0X58,
-  0X57, 0X56, 0X55, 0X54, 0X52, 0X51, 0X4F, 0X4D, 0X4A, 0X48, 0X45, 0X43,
-  0X40, 0X3D, 0X39, 0X36, 0X32, 0X2E, 0X29, 0X25, 0X20, 0X1B, 0X15, 0X0F,
-  0X08, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X07, 0X0D, 0X12, 0X16, 0X1B, 0X1F, 0X23, 0X26,
-  0X2A, 0X2D, 0X30, 0X34, 0X36, 0X39, 0X3C, 0X3E, 0X40, 0X42, 0X44, 0X46,
-  0X47, 0X49, 0X4A, 0X4C, 0X4D, 0X4E, 0X4F, 0X4F, 0X50, 0X50, 0X50, 0X51,
-  0X51, 0X51, 0X51, 0X50, 0X50, 0X4F, 0X4F, 0X4E, 0X4D, 0X4C, 0X4A, 0X49,
-  0X47, 0X45, 0X43, 0X41, 0X3F, 0X3D, 0X3A, 0X37, 0X34, 0X30, 0X2D, 0X29,
-  0X25, 0X20, 0X1C, 0X16, 0X12, 0X0C, 0X05, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X04, 0X09, 0X0E, 0X12, 0X16, 0X1A, 0X1E, 0X22, 0X25, 0X28,
-  0X2C, 0X2E, 0X31, 0X33, 0X36, 0X38, 0X3A, 0X3C, 0X3D, 0X3F, 0X40, 0X41,
-  0X42, 0X43, 0X44, 0X45, 0X46, 0X46, 0X46, 0X47, 0X47, 0X47, 0X46, 0X46,
-  0X45, 0X45, 0X44, 0X43, 0X42, 0X41, 0X3F, 0X3E, 0X3C, 0X3B, 0X38, 0X36,
-  0X33, 0X31, 0X2E, 0X2B, 0X28, 0X24, 0X20, 0X1C, 0X17, 0X12, 0X0D, 0X07,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X04, 0X09, 0X0D, 0X11, 0X15, 0X19, 0X1C, 0X20, 0X23, 0X26, 0X28,
-  0X2B, 0X2D, 0X2F, 0X31, 0X33, 0X34, 0X36, 0X37, 0X38, 0X39, 0X3A, 0X3B,
-  0X3B, 0X3C, 0X3C, 0X3C, 0X3C, 0X3C, 0X3C, 0X3B, 0X3B, 0X3A, 0X39, 0X38,
-  0X37, 0X36, 0X34, 0X33, 0X31, 0X2F, 0X2C, 0X2A, 0X27, 0X25, 0X21, 0X1E,
-  0X1A, 0X16, 0X12, 0X0D, 0X08, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X05, 0X09, 0X0D, 0X11, 0X15, 0X18, 0X1B, 0X1E, 0X20, 0X23, 0X25, 0X27,
-  0X29, 0X2B, 0X2C, 0X2E, 0X2E, 0X30, 0X30, 0X31, 0X32, 0X32, 0X32, 0X32,
-  0X32, 0X32, 0X32, 0X32, 0X31, 0X30, 0X2F, 0X2E, 0X2D, 0X2C, 0X2A, 0X28,
-  0X26, 0X24, 0X21, 0X1F, 0X1C, 0X19, 0X16, 0X12, 0X0E, 0X09, 0X04, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04,
-  0X07, 0X0B, 0X0E, 0X12, 0X15, 0X17, 0X19, 0X1C, 0X1E, 0X1F, 0X21, 0X22,
-  0X24, 0X25, 0X26, 0X26, 0X27, 0X27, 0X28, 0X28, 0X28, 0X27, 0X27, 0X27,
-  0X26, 0X25, 0X24, 0X23, 0X21, 0X20, 0X1E, 0X1C, 0X19, 0X17, 0X14, 0X12,
-  0X0E, 0X0B, 0X07, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04,
-  0X07, 0X0A, 0X0D, 0X10, 0X11, 0X13, 0X15, 0X17, 0X18, 0X19, 0X1A, 0X1B,
-  0X1B, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1B, 0X1B, 0X1A, 0X19, 0X18, 0X17,
-  0X15, 0X13, 0X11, 0X0F, 0X0C, 0X0A, 0X06, 0X03, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X06, 0X08, 0X0A, 0X0C, 0X0D, 0X0E, 0X0F, 0X10, 0X10, 0X10, 0X10,
-  0X10, 0X10, 0X0F, 0X0E, 0X0D, 0X0C, 0X0B, 0X09, 0X07, 0X05, 0X04, 0X02,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X01, 0X02, 0X02, 0X03, 0X03, 0X03, 0X03, 0X02, 0X02, 0X01,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00 };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("defaultEye_upper");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("defaultEye_lower");
 #endif // SYMMETRICAL_EYELID
 
 #define IRIS_WIDTH  80
 #define IRIS_HEIGHT 80
 
-const uint16_t polar[80 * 80] PROGMEM= {
-//uint16_t polar[80 * 80] = {
-
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X3A00, 0X3B00, 0X3C01, 0X3D01, 0X3E01, 0X3F01,
-  0X4081, 0X4181, 0X4281, 0X4381, 0X4480, 0X4580, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X3500, 0X3601, 0X3701,
-  0X3802, 0X3903, 0X3A03, 0X3B03, 0X3C04, 0X3D04, 0X3E04, 0X3F04,
-  0X4084, 0X4184, 0X4284, 0X4384, 0X4483, 0X4583, 0X4683, 0X4782,
-  0X4881, 0X4981, 0X4A80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X3180, 0X3281, 0X3382, 0X3483, 0X3584, 0X3684,
-  0X3785, 0X3906, 0X3A06, 0X3B07, 0X3C07, 0X3D07, 0X3E07, 0X3F07,
-  0X4087, 0X4187, 0X4287, 0X4387, 0X4487, 0X4586, 0X4686, 0X4805,
-  0X4904, 0X4A04, 0X4B03, 0X4C02, 0X4D01, 0X4E00, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X2F81, 0X3082, 0X3183, 0X3284, 0X3385, 0X3486, 0X3587, 0X3688,
-  0X3788, 0X3889, 0X3989, 0X3B0A, 0X3C0A, 0X3D0A, 0X3E0B, 0X3F0B,
-  0X408B, 0X418B, 0X428A, 0X438A, 0X448A, 0X4609, 0X4709, 0X4808,
-  0X4908, 0X4A07, 0X4B06, 0X4C05, 0X4D04, 0X4E03, 0X4F02, 0X5001,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2D01, 0X2E02,
-  0X2F04, 0X3005, 0X3106, 0X3207, 0X3308, 0X3409, 0X350A, 0X360B,
-  0X378B, 0X388C, 0X398D, 0X3A8D, 0X3B8D, 0X3D0E, 0X3E0E, 0X3F0E,
-  0X408E, 0X418E, 0X428E, 0X440D, 0X450D, 0X460D, 0X470C, 0X480B,
-  0X498B, 0X4A8A, 0X4B89, 0X4C88, 0X4D87, 0X4E86, 0X4F85, 0X5084,
-  0X5182, 0X5281, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X2B01, 0X2B82, 0X2C84, 0X2D85,
-  0X2E86, 0X2F88, 0X3089, 0X318A, 0X328B, 0X338C, 0X350D, 0X360E,
-  0X370F, 0X380F, 0X3990, 0X3A90, 0X3B91, 0X3D11, 0X3E11, 0X3F11,
-  0X4091, 0X4191, 0X4291, 0X4411, 0X4510, 0X4610, 0X478F, 0X488F,
-  0X498E, 0X4A8D, 0X4C0C, 0X4D0B, 0X4E0A, 0X4F09, 0X5008, 0X5106,
-  0X5205, 0X5304, 0X5402, 0X5481, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X2880, 0X2982, 0X2A83, 0X2B05, 0X2C07, 0X2D08,
-  0X2E09, 0X2F0B, 0X300C, 0X310D, 0X328E, 0X338F, 0X3490, 0X3591,
-  0X3712, 0X3812, 0X3913, 0X3A93, 0X3B94, 0X3C94, 0X3E14, 0X3F14,
-  0X4094, 0X4194, 0X4314, 0X4414, 0X4513, 0X4693, 0X4792, 0X4892,
-  0X4A11, 0X4B10, 0X4C0F, 0X4D0E, 0X4E8D, 0X4F8C, 0X508B, 0X5189,
-  0X5288, 0X5387, 0X5485, 0X5503, 0X5602, 0X5700, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X2701, 0X2803, 0X2905, 0X2986, 0X2A88, 0X2B89, 0X2C8B,
-  0X2D8C, 0X2E8E, 0X2F8F, 0X3110, 0X3211, 0X3312, 0X3413, 0X3594,
-  0X3695, 0X3795, 0X3916, 0X3A17, 0X3B97, 0X3C97, 0X3E17, 0X3F17,
-  0X4097, 0X4197, 0X4317, 0X4417, 0X4597, 0X4696, 0X4815, 0X4915,
-  0X4A14, 0X4B93, 0X4C92, 0X4D91, 0X4E90, 0X500F, 0X510E, 0X520C,
-  0X530B, 0X5409, 0X5508, 0X5606, 0X5685, 0X5783, 0X5881, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2500,
-  0X2582, 0X2684, 0X2785, 0X2807, 0X2909, 0X2A0B, 0X2B0C, 0X2C0E,
-  0X2D0F, 0X2E11, 0X2F92, 0X3093, 0X3194, 0X3295, 0X3416, 0X3517,
-  0X3618, 0X3799, 0X3899, 0X3A1A, 0X3B1A, 0X3C9A, 0X3E1B, 0X3F1B,
-  0X409B, 0X419B, 0X431A, 0X449A, 0X459A, 0X4719, 0X4819, 0X4998,
-  0X4A97, 0X4B96, 0X4D15, 0X4E14, 0X4F13, 0X5012, 0X5191, 0X528F,
-  0X538E, 0X548C, 0X558B, 0X5689, 0X5787, 0X5805, 0X5904, 0X5A02,
-  0X5A80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2380, 0X2402,
-  0X2504, 0X2606, 0X2688, 0X278A, 0X288C, 0X298D, 0X2A8F, 0X2B91,
-  0X2C92, 0X2D93, 0X2F15, 0X3016, 0X3117, 0X3218, 0X3399, 0X349A,
-  0X361B, 0X371C, 0X389C, 0X3A1D, 0X3B1D, 0X3C9E, 0X3D9E, 0X3F1E,
-  0X409E, 0X421E, 0X431E, 0X449D, 0X459D, 0X471C, 0X489C, 0X499B,
-  0X4B1A, 0X4C19, 0X4D98, 0X4E97, 0X4F96, 0X5095, 0X5213, 0X5312,
-  0X5411, 0X550F, 0X560D, 0X570C, 0X580A, 0X5908, 0X5986, 0X5A84,
-  0X5B82, 0X5C00, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2201, 0X2283, 0X2385,
-  0X2487, 0X2509, 0X260B, 0X270D, 0X280E, 0X2910, 0X2A12, 0X2B13,
-  0X2C15, 0X2D16, 0X2E98, 0X2F99, 0X309A, 0X321B, 0X331C, 0X349D,
-  0X359E, 0X371F, 0X381F, 0X39A0, 0X3B20, 0X3CA1, 0X3DA1, 0X3F21,
-  0X40A1, 0X4221, 0X4321, 0X44A0, 0X4620, 0X479F, 0X489F, 0X4A1E,
-  0X4B1D, 0X4C9C, 0X4D9B, 0X4F1A, 0X5019, 0X5118, 0X5296, 0X5395,
-  0X5493, 0X5592, 0X5690, 0X578E, 0X588D, 0X598B, 0X5A89, 0X5B07,
-  0X5C05, 0X5D03, 0X5D81, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X2081, 0X2103, 0X2205, 0X2307,
-  0X2389, 0X248B, 0X258D, 0X268F, 0X2791, 0X2893, 0X2994, 0X2A96,
-  0X2B98, 0X2C99, 0X2D9B, 0X2F1C, 0X301D, 0X319E, 0X329F, 0X3420,
-  0X35A1, 0X36A2, 0X3823, 0X39A3, 0X3B24, 0X3C24, 0X3DA4, 0X3F24,
-  0X40A4, 0X4224, 0X43A4, 0X44A4, 0X4623, 0X47A3, 0X4922, 0X4A21,
-  0X4BA0, 0X4D1F, 0X4E1E, 0X4F9D, 0X509C, 0X521B, 0X5319, 0X5418,
-  0X5516, 0X5614, 0X5713, 0X5811, 0X590F, 0X5A0D, 0X5B0B, 0X5C09,
-  0X5C87, 0X5D85, 0X5E83, 0X5F01, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X1F01, 0X2003, 0X2085, 0X2187, 0X220A,
-  0X230C, 0X240E, 0X2490, 0X2592, 0X2694, 0X2795, 0X2897, 0X2999,
-  0X2B1A, 0X2C1C, 0X2D1D, 0X2E9F, 0X2FA0, 0X3121, 0X3222, 0X33A3,
-  0X3524, 0X36A5, 0X37A6, 0X3926, 0X3AA7, 0X3C27, 0X3DA7, 0X3F27,
-  0X40A7, 0X4227, 0X43A7, 0X4527, 0X46A6, 0X4826, 0X4925, 0X4AA4,
-  0X4C23, 0X4DA2, 0X4EA1, 0X5020, 0X511F, 0X529D, 0X539C, 0X549A,
-  0X5619, 0X5717, 0X5815, 0X5914, 0X5A12, 0X5B10, 0X5B8E, 0X5C8C,
-  0X5D8A, 0X5E07, 0X5F05, 0X6003, 0X6081, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X1D81, 0X1E83, 0X1F05, 0X2008, 0X208A, 0X218C,
-  0X220E, 0X2310, 0X2412, 0X2514, 0X2616, 0X2718, 0X281A, 0X291C,
-  0X2A1D, 0X2B9F, 0X2CA0, 0X2E22, 0X2F23, 0X30A4, 0X31A5, 0X3326,
-  0X34A7, 0X3628, 0X37A9, 0X3929, 0X3AAA, 0X3C2A, 0X3DAB, 0X3F2B,
-  0X40AB, 0X422B, 0X43AA, 0X452A, 0X46A9, 0X4829, 0X49A8, 0X4B27,
-  0X4CA6, 0X4E25, 0X4F24, 0X50A3, 0X51A2, 0X5320, 0X541F, 0X559D,
-  0X569C, 0X579A, 0X5898, 0X5996, 0X5A94, 0X5B92, 0X5C90, 0X5D8E,
-  0X5E0C, 0X5F0A, 0X6008, 0X6085, 0X6103, 0X6201, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X1C00, 0X1D03, 0X1D85, 0X1E07, 0X1F0A, 0X200C, 0X208E,
-  0X2191, 0X2293, 0X2315, 0X2417, 0X2519, 0X261B, 0X271D, 0X289E,
-  0X29A0, 0X2AA2, 0X2C23, 0X2D25, 0X2EA6, 0X3027, 0X3128, 0X32A9,
-  0X342A, 0X35AB, 0X372C, 0X38AD, 0X3A2D, 0X3C2E, 0X3DAE, 0X3F2E,
-  0X40AE, 0X422E, 0X43AE, 0X45AD, 0X472D, 0X48AC, 0X4A2B, 0X4BAA,
-  0X4D29, 0X4EA8, 0X4FA7, 0X5126, 0X52A5, 0X53A3, 0X5522, 0X5620,
-  0X571E, 0X589D, 0X599B, 0X5A99, 0X5B97, 0X5C95, 0X5D13, 0X5E11,
-  0X5F0E, 0X600C, 0X608A, 0X6187, 0X6205, 0X6283, 0X6380, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X1A80, 0X1B82, 0X1C05, 0X1C87, 0X1D8A, 0X1E0C, 0X1F0E, 0X2011,
-  0X2093, 0X2195, 0X2297, 0X2399, 0X249B, 0X259D, 0X269F, 0X27A1,
-  0X2923, 0X2A24, 0X2B26, 0X2CA7, 0X2E29, 0X2FAA, 0X30AB, 0X322D,
-  0X33AE, 0X352E, 0X372F, 0X38B0, 0X3A30, 0X3BB1, 0X3DB1, 0X3F31,
-  0X40B1, 0X4231, 0X4431, 0X45B0, 0X4730, 0X48AF, 0X4AAE, 0X4C2E,
-  0X4DAD, 0X4F2B, 0X502A, 0X51A9, 0X5327, 0X54A6, 0X55A4, 0X56A3,
-  0X5821, 0X591F, 0X5A1D, 0X5B1B, 0X5C19, 0X5D17, 0X5E15, 0X5F13,
-  0X6011, 0X608E, 0X618C, 0X620A, 0X6307, 0X6385, 0X6402, 0X6500,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X1A02, 0X1A84, 0X1B07, 0X1C09, 0X1C8C, 0X1D8E, 0X1E11, 0X1F13,
-  0X2015, 0X2097, 0X219A, 0X229C, 0X239E, 0X24A0, 0X25A2, 0X2724,
-  0X2825, 0X2927, 0X2AA9, 0X2C2A, 0X2D2C, 0X2EAD, 0X302E, 0X31B0,
-  0X3331, 0X3531, 0X36B2, 0X3833, 0X39B3, 0X3BB4, 0X3D34, 0X3F34,
-  0X40B4, 0X42B4, 0X4434, 0X4633, 0X47B3, 0X4932, 0X4AB1, 0X4CB1,
-  0X4E30, 0X4FAE, 0X512D, 0X52AC, 0X53AA, 0X5529, 0X56A7, 0X57A5,
-  0X58A4, 0X5A22, 0X5B20, 0X5C1E, 0X5D1C, 0X5E1A, 0X5F17, 0X6015,
-  0X6093, 0X6191, 0X620E, 0X630C, 0X6389, 0X6487, 0X6504, 0X6582,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1881,
-  0X1904, 0X1986, 0X1A89, 0X1B0B, 0X1B8E, 0X1C90, 0X1D13, 0X1E15,
-  0X1F17, 0X201A, 0X209C, 0X219E, 0X22A0, 0X23A2, 0X2524, 0X2626,
-  0X2728, 0X28AA, 0X29AC, 0X2B2D, 0X2CAF, 0X2E30, 0X2FB1, 0X3133,
-  0X32B4, 0X34B5, 0X3635, 0X37B6, 0X39B7, 0X3B37, 0X3D37, 0X3F37,
-  0X40B7, 0X42B7, 0X44B7, 0X4637, 0X4836, 0X49B5, 0X4B35, 0X4D34,
-  0X4EB3, 0X5031, 0X51B0, 0X532F, 0X54AD, 0X562C, 0X572A, 0X58A8,
-  0X59A6, 0X5AA4, 0X5C22, 0X5D20, 0X5E1E, 0X5F1C, 0X601A, 0X6097,
-  0X6195, 0X6293, 0X6310, 0X640E, 0X648B, 0X6509, 0X6606, 0X6684,
-  0X6701, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1700, 0X1783,
-  0X1805, 0X1908, 0X198B, 0X1A0D, 0X1B10, 0X1B92, 0X1C95, 0X1D17,
-  0X1E1A, 0X1F1C, 0X201E, 0X20A0, 0X21A3, 0X2325, 0X2427, 0X2529,
-  0X26AB, 0X27AD, 0X292E, 0X2AB0, 0X2BB1, 0X2D33, 0X2F34, 0X30B6,
-  0X3237, 0X3438, 0X35B8, 0X37B9, 0X393A, 0X3B3A, 0X3D3B, 0X3F3B,
-  0X40BB, 0X42BB, 0X44BA, 0X46BA, 0X4839, 0X4A38, 0X4BB8, 0X4DB7,
-  0X4F36, 0X50B4, 0X52B3, 0X5431, 0X5530, 0X56AE, 0X582D, 0X592B,
-  0X5AA9, 0X5BA7, 0X5CA5, 0X5E23, 0X5F20, 0X601E, 0X609C, 0X619A,
-  0X6297, 0X6315, 0X6412, 0X6490, 0X658D, 0X660B, 0X6688, 0X6785,
-  0X6803, 0X6880, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1602, 0X1685,
-  0X1787, 0X180A, 0X188D, 0X190F, 0X1A12, 0X1A94, 0X1B97, 0X1C19,
-  0X1D1C, 0X1E1E, 0X1F20, 0X2023, 0X2125, 0X2227, 0X2329, 0X242B,
-  0X25AD, 0X26AF, 0X2831, 0X29B3, 0X2B34, 0X2CB6, 0X2E37, 0X2FB8,
-  0X31BA, 0X333B, 0X353C, 0X373C, 0X393D, 0X3B3D, 0X3D3E, 0X3F3E,
-  0X40BE, 0X42BE, 0X44BD, 0X46BD, 0X48BC, 0X4ABC, 0X4CBB, 0X4E3A,
-  0X5038, 0X51B7, 0X5336, 0X54B4, 0X5633, 0X57B1, 0X592F, 0X5A2D,
-  0X5BAB, 0X5CA9, 0X5DA7, 0X5EA5, 0X6023, 0X60A0, 0X619E, 0X629C,
-  0X6399, 0X6417, 0X6514, 0X6592, 0X668F, 0X670D, 0X678A, 0X6807,
-  0X6905, 0X6982, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1481, 0X1503, 0X1606,
-  0X1689, 0X170C, 0X178E, 0X1811, 0X1914, 0X1996, 0X1A99, 0X1B1B,
-  0X1C1E, 0X1D20, 0X1E23, 0X1EA5, 0X2027, 0X2129, 0X222C, 0X232E,
-  0X24B0, 0X25B2, 0X2734, 0X28B5, 0X2A37, 0X2BB9, 0X2DBA, 0X2F3B,
-  0X313D, 0X32BE, 0X34BF, 0X36BF, 0X38C0, 0X3AC1, 0X3CC1, 0X3EC1,
-  0X4141, 0X4341, 0X4541, 0X4740, 0X493F, 0X4B3F, 0X4D3E, 0X4EBD,
-  0X50BB, 0X523A, 0X5439, 0X55B7, 0X5735, 0X58B4, 0X5A32, 0X5B30,
-  0X5CAE, 0X5DAC, 0X5EA9, 0X6027, 0X6125, 0X61A3, 0X62A0, 0X639E,
-  0X649B, 0X6519, 0X6616, 0X6694, 0X6791, 0X680E, 0X688C, 0X6909,
-  0X6986, 0X6A83, 0X6B01, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1402, 0X1485, 0X1508,
-  0X158B, 0X160D, 0X1690, 0X1713, 0X1815, 0X1898, 0X199B, 0X1A1D,
-  0X1B20, 0X1C22, 0X1CA5, 0X1DA7, 0X1EA9, 0X202C, 0X212E, 0X2230,
-  0X23B2, 0X24B4, 0X2636, 0X27B8, 0X293A, 0X2ABB, 0X2CBD, 0X2E3E,
-  0X3040, 0X3241, 0X3442, 0X3643, 0X3843, 0X3AC4, 0X3CC4, 0X3EC4,
-  0X4144, 0X4344, 0X4544, 0X47C3, 0X49C3, 0X4BC2, 0X4DC1, 0X4FC0,
-  0X51BE, 0X533D, 0X553B, 0X56BA, 0X5838, 0X59B6, 0X5B34, 0X5C32,
-  0X5DB0, 0X5EAE, 0X602C, 0X6129, 0X6227, 0X6325, 0X63A2, 0X64A0,
-  0X659D, 0X661B, 0X6718, 0X6795, 0X6893, 0X6910, 0X698D, 0X6A0B,
-  0X6A88, 0X6B05, 0X6B82, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X1281, 0X1304, 0X1387, 0X1409,
-  0X148C, 0X150F, 0X1592, 0X1614, 0X1717, 0X179A, 0X189D, 0X191F,
-  0X1A22, 0X1AA4, 0X1BA7, 0X1CA9, 0X1DAC, 0X1EAE, 0X2030, 0X2133,
-  0X2235, 0X23B7, 0X2539, 0X26BB, 0X283C, 0X29BE, 0X2BC0, 0X2DC1,
-  0X2FC3, 0X31C4, 0X33C5, 0X35C6, 0X37C6, 0X3A47, 0X3CC7, 0X3EC7,
-  0X4147, 0X4347, 0X45C7, 0X4846, 0X4A46, 0X4C45, 0X4E44, 0X5043,
-  0X5241, 0X5440, 0X563E, 0X57BC, 0X593B, 0X5AB9, 0X5C37, 0X5DB5,
-  0X5EB3, 0X6030, 0X612E, 0X622C, 0X6329, 0X6427, 0X6524, 0X65A2,
-  0X669F, 0X671D, 0X681A, 0X6897, 0X6994, 0X6A12, 0X6A8F, 0X6B0C,
-  0X6B89, 0X6C07, 0X6C84, 0X6D01, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X1182, 0X1205, 0X1288, 0X130B,
-  0X138E, 0X1411, 0X1493, 0X1516, 0X1619, 0X169C, 0X171E, 0X1821,
-  0X18A4, 0X19A6, 0X1AA9, 0X1BAB, 0X1CAE, 0X1DB0, 0X1EB3, 0X2035,
-  0X2137, 0X22B9, 0X243B, 0X25BD, 0X273F, 0X28C1, 0X2AC3, 0X2CC4,
-  0X2EC6, 0X30C7, 0X32C8, 0X3549, 0X374A, 0X39CA, 0X3C4A, 0X3ECB,
-  0X414B, 0X43CA, 0X464A, 0X48CA, 0X4AC9, 0X4D48, 0X4F47, 0X5146,
-  0X5344, 0X5543, 0X5741, 0X58BF, 0X5A3D, 0X5BBB, 0X5D39, 0X5EB7,
-  0X6035, 0X6133, 0X6230, 0X632E, 0X642B, 0X6529, 0X6626, 0X6724,
-  0X67A1, 0X689E, 0X691C, 0X6999, 0X6A96, 0X6B13, 0X6B91, 0X6C0E,
-  0X6C8B, 0X6D08, 0X6D85, 0X6E02, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X1001, 0X1084, 0X1106, 0X1189, 0X120C,
-  0X128F, 0X1312, 0X1395, 0X1418, 0X149A, 0X159D, 0X1620, 0X16A3,
-  0X17A5, 0X18A8, 0X192B, 0X1A2D, 0X1B30, 0X1C32, 0X1DB5, 0X1EB7,
-  0X2039, 0X213C, 0X22BE, 0X2440, 0X25C2, 0X27C4, 0X29C5, 0X2BC7,
-  0X2DC8, 0X2FCA, 0X324B, 0X344C, 0X36CD, 0X394D, 0X3C4E, 0X3ECE,
-  0X414E, 0X43CE, 0X46CD, 0X494D, 0X4BCC, 0X4DCB, 0X504A, 0X5248,
-  0X5447, 0X5645, 0X5844, 0X5A42, 0X5BC0, 0X5D3E, 0X5EBC, 0X6039,
-  0X6137, 0X6235, 0X63B2, 0X64B0, 0X65AD, 0X66AB, 0X6728, 0X6825,
-  0X6923, 0X69A0, 0X6A1D, 0X6B1A, 0X6B98, 0X6C15, 0X6C92, 0X6D0F,
-  0X6D8C, 0X6E09, 0X6E86, 0X6F04, 0X6F81, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X0F02, 0X0F85, 0X1008, 0X108B, 0X110E,
-  0X1191, 0X1213, 0X1296, 0X1319, 0X139C, 0X141F, 0X1522, 0X15A4,
-  0X16A7, 0X172A, 0X182D, 0X192F, 0X1A32, 0X1B34, 0X1C37, 0X1D39,
-  0X1EBC, 0X203E, 0X2140, 0X2342, 0X24C4, 0X2646, 0X2848, 0X2A4A,
-  0X2CCB, 0X2ECD, 0X314E, 0X33CF, 0X3650, 0X3950, 0X3BD1, 0X3ED1,
-  0X4151, 0X4451, 0X46D0, 0X49D0, 0X4C4F, 0X4ECE, 0X514D, 0X534B,
-  0X55CA, 0X57C8, 0X59C6, 0X5B44, 0X5CC2, 0X5EC0, 0X603E, 0X613C,
-  0X62B9, 0X63B7, 0X64B4, 0X65B2, 0X66AF, 0X67AD, 0X68AA, 0X6927,
-  0X6A24, 0X6AA2, 0X6B9F, 0X6C1C, 0X6C99, 0X6D16, 0X6D93, 0X6E11,
-  0X6E8E, 0X6F0B, 0X6F88, 0X7005, 0X7082, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0E00, 0X0E03, 0X0E86, 0X0F09, 0X0F8C, 0X100F,
-  0X1012, 0X1095, 0X1118, 0X121B, 0X129D, 0X1320, 0X13A3, 0X14A6,
-  0X1529, 0X162C, 0X16AE, 0X17B1, 0X18B4, 0X19B6, 0X1AB9, 0X1BBB,
-  0X1D3E, 0X1EC0, 0X2042, 0X21C5, 0X2347, 0X2549, 0X274B, 0X294C,
-  0X2B4E, 0X2DD0, 0X3051, 0X32D2, 0X35D3, 0X38D4, 0X3B54, 0X3E54,
-  0X41D4, 0X44D4, 0X4754, 0X4A53, 0X4D52, 0X4FD1, 0X5250, 0X54CE,
-  0X56CC, 0X58CB, 0X5AC9, 0X5CC7, 0X5E45, 0X6042, 0X6140, 0X62BE,
-  0X643B, 0X6539, 0X6636, 0X6734, 0X6831, 0X692E, 0X69AC, 0X6AA9,
-  0X6B26, 0X6C23, 0X6CA0, 0X6D1D, 0X6D9B, 0X6E98, 0X6F15, 0X6F92,
-  0X6F8F, 0X700C, 0X7089, 0X7106, 0X7183, 0X7180, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0D01, 0X0D04, 0X0D87, 0X0E0A, 0X0E8D, 0X0E90,
-  0X0F13, 0X0F96, 0X1019, 0X109C, 0X111F, 0X11A2, 0X12A5, 0X1327,
-  0X13AA, 0X14AD, 0X1530, 0X1633, 0X1735, 0X1838, 0X193B, 0X1A3D,
-  0X1BC0, 0X1CC2, 0X1E45, 0X2047, 0X21C9, 0X23CB, 0X25CD, 0X27CF,
-  0X29D1, 0X2C52, 0X2F54, 0X31D5, 0X34D6, 0X37D7, 0X3B57, 0X3E57,
-  0X41D7, 0X44D7, 0X4857, 0X4B56, 0X4E55, 0X50D4, 0X53D2, 0X5651,
-  0X584F, 0X5A4D, 0X5C4B, 0X5E49, 0X6047, 0X61C5, 0X6342, 0X6440,
-  0X65BD, 0X66BB, 0X67B8, 0X68B5, 0X69B3, 0X6AB0, 0X6B2D, 0X6C2A,
-  0X6CA7, 0X6D25, 0X6E22, 0X6E9F, 0X6F1C, 0X6F99, 0X7016, 0X7093,
-  0X7110, 0X710D, 0X718A, 0X7207, 0X7284, 0X7281, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0C02, 0X0C05, 0X0C88, 0X0D0B, 0X0D0E, 0X0D91,
-  0X0E14, 0X0E97, 0X0F1A, 0X0F9D, 0X1020, 0X10A3, 0X1126, 0X11A9,
-  0X12AC, 0X132F, 0X1431, 0X14B4, 0X15B7, 0X16BA, 0X17BC, 0X18BF,
-  0X1A42, 0X1B44, 0X1CC7, 0X1E49, 0X204B, 0X21CE, 0X23D0, 0X2652,
-  0X2854, 0X2B55, 0X2DD7, 0X30D8, 0X33D9, 0X375A, 0X3ADA, 0X3E5B,
-  0X41DB, 0X455A, 0X48DA, 0X4C59, 0X4F58, 0X5257, 0X54D5, 0X57D4,
-  0X59D2, 0X5C50, 0X5E4E, 0X604B, 0X61C9, 0X6347, 0X64C4, 0X65C2,
-  0X673F, 0X683C, 0X693A, 0X6A37, 0X6B34, 0X6BB1, 0X6CAF, 0X6D2C,
-  0X6E29, 0X6EA6, 0X6F23, 0X6FA0, 0X701D, 0X709A, 0X7117, 0X7194,
-  0X7211, 0X728E, 0X728B, 0X7308, 0X7385, 0X7382, 0X007F, 0X007F,
-  0X007F, 0X0A80, 0X0B03, 0X0B06, 0X0B89, 0X0C0C, 0X0C0F, 0X0C92,
-  0X0D15, 0X0D98, 0X0D9B, 0X0E1E, 0X0EA1, 0X0F24, 0X0FA7, 0X102A,
-  0X112D, 0X11B0, 0X12B3, 0X1336, 0X1439, 0X153B, 0X163E, 0X1741,
-  0X1844, 0X19C6, 0X1AC9, 0X1C4B, 0X1E4E, 0X2050, 0X2252, 0X2454,
-  0X26D6, 0X2958, 0X2C5A, 0X2FDB, 0X32DC, 0X365D, 0X3A5E, 0X3E5E,
-  0X41DE, 0X45DE, 0X49DD, 0X4D5C, 0X505B, 0X53DA, 0X56D8, 0X5956,
-  0X5BD4, 0X5DD2, 0X6050, 0X61CE, 0X63CB, 0X6549, 0X6646, 0X67C4,
-  0X68C1, 0X69BE, 0X6ABB, 0X6BB9, 0X6CB6, 0X6D33, 0X6E30, 0X6EAD,
-  0X6FAA, 0X7027, 0X70A4, 0X7121, 0X719E, 0X721B, 0X7218, 0X7295,
-  0X7312, 0X738F, 0X738C, 0X7409, 0X7486, 0X7483, 0X7500, 0X007F,
-  0X007F, 0X0981, 0X0A04, 0X0A07, 0X0A8A, 0X0A8D, 0X0B10, 0X0B93,
-  0X0B96, 0X0C19, 0X0C9C, 0X0D1F, 0X0DA2, 0X0E25, 0X0EA8, 0X0F2B,
-  0X0FAE, 0X1031, 0X10B4, 0X11B7, 0X123A, 0X133D, 0X1440, 0X1543,
-  0X1645, 0X17C8, 0X18CB, 0X1A4D, 0X1C50, 0X1DD2, 0X2055, 0X2257,
-  0X24D9, 0X27DB, 0X2ADC, 0X2DDE, 0X31DF, 0X35E0, 0X39E1, 0X3DE1,
-  0X4261, 0X4661, 0X4A60, 0X4E5F, 0X525E, 0X555C, 0X585B, 0X5B59,
-  0X5DD7, 0X6055, 0X6252, 0X63D0, 0X65CD, 0X674B, 0X6848, 0X69C5,
-  0X6AC3, 0X6BC0, 0X6CBD, 0X6DBA, 0X6E37, 0X6F34, 0X6FB1, 0X702E,
-  0X70AB, 0X7128, 0X71A5, 0X7222, 0X729F, 0X731C, 0X7399, 0X7416,
-  0X7413, 0X7490, 0X750D, 0X750A, 0X7587, 0X7584, 0X7601, 0X007F,
-  0X007F, 0X0881, 0X0904, 0X0908, 0X098B, 0X098E, 0X0A11, 0X0A14,
-  0X0A97, 0X0B1A, 0X0B1D, 0X0BA0, 0X0C23, 0X0CA6, 0X0D29, 0X0DAD,
-  0X0E30, 0X0EB3, 0X0F36, 0X1038, 0X10BB, 0X11BE, 0X1241, 0X1344,
-  0X1447, 0X15CA, 0X16CC, 0X184F, 0X19D2, 0X1BD4, 0X1DD7, 0X2059,
-  0X22DB, 0X255D, 0X28DF, 0X2C61, 0X3062, 0X3463, 0X38E4, 0X3DE4,
-  0X4264, 0X4764, 0X4BE3, 0X4FE2, 0X53E1, 0X575F, 0X5ADD, 0X5D5B,
-  0X6059, 0X6257, 0X6454, 0X6652, 0X67CF, 0X694C, 0X6A4A, 0X6BC7,
-  0X6CC4, 0X6DC1, 0X6E3E, 0X6F3B, 0X6FB8, 0X70B6, 0X7133, 0X71B0,
-  0X722D, 0X72A9, 0X7326, 0X73A3, 0X7420, 0X749D, 0X749A, 0X7517,
-  0X7594, 0X7591, 0X760E, 0X760B, 0X7688, 0X7684, 0X7701, 0X007F,
-  0X007F, 0X0782, 0X0805, 0X0808, 0X080B, 0X088F, 0X0892, 0X0915,
-  0X0998, 0X099B, 0X0A1E, 0X0A21, 0X0AA4, 0X0B27, 0X0BAA, 0X0C2E,
-  0X0CB1, 0X0D34, 0X0DB7, 0X0E3A, 0X0EBD, 0X0FC0, 0X1043, 0X1146,
-  0X1248, 0X134B, 0X14CE, 0X1651, 0X17D4, 0X1956, 0X1B59, 0X1D5B,
-  0X205E, 0X22E0, 0X2662, 0X29E4, 0X2E65, 0X32E6, 0X37E7, 0X3D67,
-  0X42E7, 0X4867, 0X4D66, 0X51E5, 0X5664, 0X59E2, 0X5D60, 0X605E,
-  0X62DB, 0X64D9, 0X66D6, 0X6854, 0X69D1, 0X6B4E, 0X6CCB, 0X6DC8,
-  0X6EC6, 0X6FC3, 0X7040, 0X713D, 0X71BA, 0X7237, 0X72B4, 0X7331,
-  0X73AE, 0X742A, 0X74A7, 0X7524, 0X75A1, 0X759E, 0X761B, 0X7618,
-  0X7695, 0X7712, 0X770F, 0X778B, 0X7788, 0X7785, 0X7802, 0X007F,
-  0X007F, 0X0683, 0X0686, 0X0709, 0X070C, 0X078F, 0X0792, 0X0815,
-  0X0819, 0X089C, 0X089F, 0X0922, 0X0925, 0X09A8, 0X0A2B, 0X0AAE,
-  0X0AB1, 0X0B35, 0X0BB8, 0X0CBB, 0X0D3E, 0X0DC1, 0X0E44, 0X0F47,
-  0X104A, 0X114D, 0X1250, 0X13D2, 0X14D5, 0X16D8, 0X185B, 0X1ADD,
-  0X1D60, 0X2062, 0X2364, 0X2766, 0X2BE8, 0X3169, 0X36EA, 0X3CEB,
-  0X436B, 0X496A, 0X4EE9, 0X5468, 0X58E6, 0X5CE4, 0X6062, 0X62E0,
-  0X655D, 0X67DB, 0X6958, 0X6B55, 0X6C52, 0X6DD0, 0X6ECD, 0X6FCA,
-  0X70C7, 0X71C4, 0X7241, 0X72BE, 0X733B, 0X7438, 0X74B5, 0X7531,
-  0X752E, 0X75AB, 0X7628, 0X76A5, 0X76A2, 0X771F, 0X771C, 0X7799,
-  0X7795, 0X7812, 0X780F, 0X788C, 0X7889, 0X7906, 0X7903, 0X007F,
-  0X0580, 0X0583, 0X0586, 0X0609, 0X060D, 0X0610, 0X0693, 0X0696,
-  0X0719, 0X071C, 0X079F, 0X07A3, 0X0826, 0X0829, 0X08AC, 0X08AF,
-  0X0932, 0X09B5, 0X0A38, 0X0ABC, 0X0B3F, 0X0BC2, 0X0C45, 0X0D48,
-  0X0DCB, 0X0ECE, 0X0FD1, 0X10D4, 0X1257, 0X13DA, 0X155C, 0X175F,
-  0X19E2, 0X1CE4, 0X2067, 0X2469, 0X28EB, 0X2EEC, 0X356D, 0X3C6E,
-  0X43EE, 0X4AED, 0X516C, 0X576B, 0X5BE9, 0X6067, 0X6364, 0X6662,
-  0X68DF, 0X6ADC, 0X6C5A, 0X6DD7, 0X6F54, 0X7051, 0X714E, 0X724B,
-  0X72C8, 0X73C5, 0X7442, 0X74BF, 0X753C, 0X75B8, 0X7635, 0X76B2,
-  0X772F, 0X772C, 0X77A9, 0X77A6, 0X7823, 0X781F, 0X789C, 0X7899,
-  0X7916, 0X7913, 0X7990, 0X798D, 0X7989, 0X7A06, 0X7A03, 0X7A00,
-  0X0480, 0X0483, 0X0487, 0X048A, 0X050D, 0X0510, 0X0513, 0X0597,
-  0X059A, 0X059D, 0X0620, 0X0623, 0X06A6, 0X06A9, 0X072D, 0X0730,
-  0X07B3, 0X0836, 0X0839, 0X08BC, 0X093F, 0X09C3, 0X0A46, 0X0AC9,
-  0X0BCC, 0X0C4F, 0X0D52, 0X0E55, 0X0F58, 0X105B, 0X125E, 0X13E1,
-  0X1664, 0X18E6, 0X1BE9, 0X206B, 0X256D, 0X2B6F, 0X32F0, 0X3B71,
-  0X44F1, 0X4D70, 0X54EF, 0X5AED, 0X606B, 0X6469, 0X6766, 0X69E4,
-  0X6C61, 0X6DDE, 0X6FDB, 0X70D8, 0X71D5, 0X72D2, 0X73CF, 0X744C,
-  0X7549, 0X75C6, 0X7643, 0X76BF, 0X773C, 0X77B9, 0X77B6, 0X7833,
-  0X78B0, 0X78AD, 0X7929, 0X7926, 0X79A3, 0X79A0, 0X7A1D, 0X7A1A,
-  0X7A17, 0X7A93, 0X7A90, 0X7A8D, 0X7B0A, 0X7B07, 0X7B03, 0X7B00,
-  0X0381, 0X0384, 0X0387, 0X038A, 0X040D, 0X0411, 0X0414, 0X0417,
-  0X049A, 0X049D, 0X04A0, 0X04A4, 0X0527, 0X052A, 0X05AD, 0X05B0,
-  0X0633, 0X0637, 0X06BA, 0X06BD, 0X0740, 0X07C3, 0X0846, 0X08CA,
-  0X094D, 0X09D0, 0X0A53, 0X0B56, 0X0C59, 0X0D5C, 0X0E5F, 0X0FE2,
-  0X11E5, 0X1468, 0X176B, 0X1AED, 0X2070, 0X26F2, 0X2FF3, 0X3A74,
-  0X45F4, 0X5073, 0X5972, 0X6070, 0X656D, 0X68EB, 0X6BE8, 0X6E65,
-  0X7062, 0X71DF, 0X72DC, 0X73D9, 0X74D6, 0X75D3, 0X7650, 0X76CD,
-  0X774A, 0X77C6, 0X7843, 0X78C0, 0X793D, 0X793A, 0X79B7, 0X79B3,
-  0X7A30, 0X7A2D, 0X7AAA, 0X7AA7, 0X7B24, 0X7B20, 0X7B1D, 0X7B1A,
-  0X7B97, 0X7B94, 0X7B91, 0X7B8D, 0X7C0A, 0X7C07, 0X7C04, 0X7C01,
-  0X0281, 0X0284, 0X0287, 0X028A, 0X028E, 0X0291, 0X0314, 0X0317,
-  0X031A, 0X031E, 0X0321, 0X03A4, 0X03A7, 0X03AA, 0X03AE, 0X0431,
-  0X0434, 0X04B7, 0X04BA, 0X04BD, 0X0541, 0X0544, 0X05C7, 0X064A,
-  0X06CD, 0X06D0, 0X0754, 0X0857, 0X08DA, 0X09DD, 0X0A60, 0X0BE3,
-  0X0D66, 0X0EE9, 0X116C, 0X14EF, 0X1972, 0X2074, 0X29F6, 0X37F7,
-  0X4877, 0X5676, 0X6074, 0X66F2, 0X6B6F, 0X6EEC, 0X7169, 0X72E6,
-  0X7463, 0X75E0, 0X765D, 0X775A, 0X77D7, 0X78D4, 0X7950, 0X794D,
-  0X79CA, 0X7A47, 0X7AC4, 0X7AC1, 0X7B3D, 0X7B3A, 0X7B37, 0X7BB4,
-  0X7BB1, 0X7C2E, 0X7C2A, 0X7C27, 0X7C24, 0X7CA1, 0X7C9E, 0X7C9A,
-  0X7C97, 0X7C94, 0X7D11, 0X7D0E, 0X7D0A, 0X7D07, 0X7D04, 0X7D01,
-  0X0181, 0X0184, 0X0187, 0X018B, 0X018E, 0X0191, 0X0194, 0X0197,
-  0X019B, 0X021E, 0X0221, 0X0224, 0X0227, 0X022B, 0X022E, 0X0231,
-  0X02B4, 0X02B7, 0X02BB, 0X02BE, 0X0341, 0X0344, 0X0347, 0X03CA,
-  0X03CE, 0X0451, 0X04D4, 0X04D7, 0X055A, 0X05DE, 0X0661, 0X0764,
-  0X0867, 0X096A, 0X0AED, 0X0D70, 0X1073, 0X1676, 0X2079, 0X32FA,
-  0X4D7A, 0X6079, 0X69F6, 0X6FF3, 0X72F0, 0X756D, 0X76EA, 0X77E7,
-  0X78E4, 0X79E1, 0X7A5E, 0X7ADA, 0X7B57, 0X7B54, 0X7BD1, 0X7C4E,
-  0X7C4A, 0X7CC7, 0X7CC4, 0X7CC1, 0X7D3E, 0X7D3B, 0X7D37, 0X7D34,
-  0X7DB1, 0X7DAE, 0X7DAB, 0X7DA7, 0X7DA4, 0X7DA1, 0X7D9E, 0X7E1B,
-  0X7E17, 0X7E14, 0X7E11, 0X7E0E, 0X7E0B, 0X7E07, 0X7E04, 0X7E01,
-  0X0081, 0X0084, 0X0087, 0X008B, 0X008E, 0X0091, 0X0094, 0X0097,
-  0X009B, 0X009E, 0X00A1, 0X00A4, 0X00A7, 0X00AB, 0X00AE, 0X00B1,
-  0X00B4, 0X00B7, 0X00BB, 0X00BE, 0X0141, 0X0144, 0X0147, 0X014B,
-  0X014E, 0X0151, 0X01D4, 0X01D7, 0X01DB, 0X01DE, 0X0261, 0X0264,
-  0X02E7, 0X036B, 0X03EE, 0X04F1, 0X05F4, 0X0877, 0X0D7A, 0X207D,
-  0X607D, 0X72FA, 0X77F7, 0X7A74, 0X7B71, 0X7C6E, 0X7CEB, 0X7D67,
-  0X7DE4, 0X7DE1, 0X7E5E, 0X7E5B, 0X7E57, 0X7E54, 0X7ED1, 0X7ECE,
-  0X7ECB, 0X7EC7, 0X7EC4, 0X7EC1, 0X7F3E, 0X7F3B, 0X7F37, 0X7F34,
-  0X7F31, 0X7F2E, 0X7F2B, 0X7F27, 0X7F24, 0X7F21, 0X7F1E, 0X7F1B,
-  0X7F17, 0X7F14, 0X7F11, 0X7F0E, 0X7F0B, 0X7F07, 0X7F04, 0X7F01,
-  0XFF01, 0XFF04, 0XFF07, 0XFF0B, 0XFF0E, 0XFF11, 0XFF14, 0XFF17,
-  0XFF1B, 0XFF1E, 0XFF21, 0XFF24, 0XFF27, 0XFF2B, 0XFF2E, 0XFF31,
-  0XFF34, 0XFF37, 0XFF3B, 0XFF3E, 0XFEC1, 0XFEC4, 0XFEC7, 0XFECB,
-  0XFECE, 0XFED1, 0XFE54, 0XFE57, 0XFE5B, 0XFE5E, 0XFDE1, 0XFDE4,
-  0XFD67, 0XFCEB, 0XFC6E, 0XFB71, 0XFA74, 0XF7F7, 0XF2FA, 0XE07D,
-  0XA07D, 0X8D7A, 0X8877, 0X85F4, 0X84F1, 0X83EE, 0X836B, 0X82E7,
-  0X8264, 0X8261, 0X81DE, 0X81DB, 0X81D7, 0X81D4, 0X8151, 0X814E,
-  0X814B, 0X8147, 0X8144, 0X8141, 0X80BE, 0X80BB, 0X80B7, 0X80B4,
-  0X80B1, 0X80AE, 0X80AB, 0X80A7, 0X80A4, 0X80A1, 0X809E, 0X809B,
-  0X8097, 0X8094, 0X8091, 0X808E, 0X808B, 0X8087, 0X8084, 0X8081,
-  0XFE01, 0XFE04, 0XFE07, 0XFE0B, 0XFE0E, 0XFE11, 0XFE14, 0XFE17,
-  0XFE1B, 0XFD9E, 0XFDA1, 0XFDA4, 0XFDA7, 0XFDAB, 0XFDAE, 0XFDB1,
-  0XFD34, 0XFD37, 0XFD3B, 0XFD3E, 0XFCC1, 0XFCC4, 0XFCC7, 0XFC4A,
-  0XFC4E, 0XFBD1, 0XFB54, 0XFB57, 0XFADA, 0XFA5E, 0XF9E1, 0XF8E4,
-  0XF7E7, 0XF6EA, 0XF56D, 0XF2F0, 0XEFF3, 0XE9F6, 0XE079, 0XCD7A,
-  0XB2FA, 0XA079, 0X9676, 0X9073, 0X8D70, 0X8AED, 0X896A, 0X8867,
-  0X8764, 0X8661, 0X85DE, 0X855A, 0X84D7, 0X84D4, 0X8451, 0X83CE,
-  0X83CA, 0X8347, 0X8344, 0X8341, 0X82BE, 0X82BB, 0X82B7, 0X82B4,
-  0X8231, 0X822E, 0X822B, 0X8227, 0X8224, 0X8221, 0X821E, 0X819B,
-  0X8197, 0X8194, 0X8191, 0X818E, 0X818B, 0X8187, 0X8184, 0X8181,
-  0XFD01, 0XFD04, 0XFD07, 0XFD0A, 0XFD0E, 0XFD11, 0XFC94, 0XFC97,
-  0XFC9A, 0XFC9E, 0XFCA1, 0XFC24, 0XFC27, 0XFC2A, 0XFC2E, 0XFBB1,
-  0XFBB4, 0XFB37, 0XFB3A, 0XFB3D, 0XFAC1, 0XFAC4, 0XFA47, 0XF9CA,
-  0XF94D, 0XF950, 0XF8D4, 0XF7D7, 0XF75A, 0XF65D, 0XF5E0, 0XF463,
-  0XF2E6, 0XF169, 0XEEEC, 0XEB6F, 0XE6F2, 0XE074, 0XD676, 0XC877,
-  0XB7F7, 0XA9F6, 0XA074, 0X9972, 0X94EF, 0X916C, 0X8EE9, 0X8D66,
-  0X8BE3, 0X8A60, 0X89DD, 0X88DA, 0X8857, 0X8754, 0X86D0, 0X86CD,
-  0X864A, 0X85C7, 0X8544, 0X8541, 0X84BD, 0X84BA, 0X84B7, 0X8434,
-  0X8431, 0X83AE, 0X83AA, 0X83A7, 0X83A4, 0X8321, 0X831E, 0X831A,
-  0X8317, 0X8314, 0X8291, 0X828E, 0X828A, 0X8287, 0X8284, 0X8281,
-  0XFC01, 0XFC04, 0XFC07, 0XFC0A, 0XFB8D, 0XFB91, 0XFB94, 0XFB97,
-  0XFB1A, 0XFB1D, 0XFB20, 0XFB24, 0XFAA7, 0XFAAA, 0XFA2D, 0XFA30,
-  0XF9B3, 0XF9B7, 0XF93A, 0XF93D, 0XF8C0, 0XF843, 0XF7C6, 0XF74A,
-  0XF6CD, 0XF650, 0XF5D3, 0XF4D6, 0XF3D9, 0XF2DC, 0XF1DF, 0XF062,
-  0XEE65, 0XEBE8, 0XE8EB, 0XE56D, 0XE070, 0XD972, 0XD073, 0XC5F4,
-  0XBA74, 0XAFF3, 0XA6F2, 0XA070, 0X9AED, 0X976B, 0X9468, 0X91E5,
-  0X8FE2, 0X8E5F, 0X8D5C, 0X8C59, 0X8B56, 0X8A53, 0X89D0, 0X894D,
-  0X88CA, 0X8846, 0X87C3, 0X8740, 0X86BD, 0X86BA, 0X8637, 0X8633,
-  0X85B0, 0X85AD, 0X852A, 0X8527, 0X84A4, 0X84A0, 0X849D, 0X849A,
-  0X8417, 0X8414, 0X8411, 0X840D, 0X838A, 0X8387, 0X8384, 0X8381,
-  0XFB00, 0XFB03, 0XFB07, 0XFB0A, 0XFA8D, 0XFA90, 0XFA93, 0XFA17,
-  0XFA1A, 0XFA1D, 0XF9A0, 0XF9A3, 0XF926, 0XF929, 0XF8AD, 0XF8B0,
-  0XF833, 0XF7B6, 0XF7B9, 0XF73C, 0XF6BF, 0XF643, 0XF5C6, 0XF549,
-  0XF44C, 0XF3CF, 0XF2D2, 0XF1D5, 0XF0D8, 0XEFDB, 0XEDDE, 0XEC61,
-  0XE9E4, 0XE766, 0XE469, 0XE06B, 0XDAED, 0XD4EF, 0XCD70, 0XC4F1,
-  0XBB71, 0XB2F0, 0XAB6F, 0XA56D, 0XA06B, 0X9BE9, 0X98E6, 0X9664,
-  0X93E1, 0X925E, 0X905B, 0X8F58, 0X8E55, 0X8D52, 0X8C4F, 0X8BCC,
-  0X8AC9, 0X8A46, 0X89C3, 0X893F, 0X88BC, 0X8839, 0X8836, 0X87B3,
-  0X8730, 0X872D, 0X86A9, 0X86A6, 0X8623, 0X8620, 0X859D, 0X859A,
-  0X8597, 0X8513, 0X8510, 0X850D, 0X848A, 0X8487, 0X8483, 0X8480,
-  0XFA00, 0XFA03, 0XFA06, 0XF989, 0XF98D, 0XF990, 0XF913, 0XF916,
-  0XF899, 0XF89C, 0XF81F, 0XF823, 0XF7A6, 0XF7A9, 0XF72C, 0XF72F,
-  0XF6B2, 0XF635, 0XF5B8, 0XF53C, 0XF4BF, 0XF442, 0XF3C5, 0XF2C8,
-  0XF24B, 0XF14E, 0XF051, 0XEF54, 0XEDD7, 0XEC5A, 0XEADC, 0XE8DF,
-  0XE662, 0XE364, 0XE067, 0XDBE9, 0XD76B, 0XD16C, 0XCAED, 0XC3EE,
-  0XBC6E, 0XB56D, 0XAEEC, 0XA8EB, 0XA469, 0XA067, 0X9CE4, 0X99E2,
-  0X975F, 0X955C, 0X93DA, 0X9257, 0X90D4, 0X8FD1, 0X8ECE, 0X8DCB,
-  0X8D48, 0X8C45, 0X8BC2, 0X8B3F, 0X8ABC, 0X8A38, 0X89B5, 0X8932,
-  0X88AF, 0X88AC, 0X8829, 0X8826, 0X87A3, 0X879F, 0X871C, 0X8719,
-  0X8696, 0X8693, 0X8610, 0X860D, 0X8609, 0X8586, 0X8583, 0X8580,
-  0X007F, 0XF903, 0XF906, 0XF889, 0XF88C, 0XF80F, 0XF812, 0XF795,
-  0XF799, 0XF71C, 0XF71F, 0XF6A2, 0XF6A5, 0XF628, 0XF5AB, 0XF52E,
-  0XF531, 0XF4B5, 0XF438, 0XF33B, 0XF2BE, 0XF241, 0XF1C4, 0XF0C7,
-  0XEFCA, 0XEECD, 0XEDD0, 0XEC52, 0XEB55, 0XE958, 0XE7DB, 0XE55D,
-  0XE2E0, 0XE062, 0XDCE4, 0XD8E6, 0XD468, 0XCEE9, 0XC96A, 0XC36B,
-  0XBCEB, 0XB6EA, 0XB169, 0XABE8, 0XA766, 0XA364, 0XA062, 0X9D60,
-  0X9ADD, 0X985B, 0X96D8, 0X94D5, 0X93D2, 0X9250, 0X914D, 0X904A,
-  0X8F47, 0X8E44, 0X8DC1, 0X8D3E, 0X8CBB, 0X8BB8, 0X8B35, 0X8AB1,
-  0X8AAE, 0X8A2B, 0X89A8, 0X8925, 0X8922, 0X889F, 0X889C, 0X8819,
-  0X8815, 0X8792, 0X878F, 0X870C, 0X8709, 0X8686, 0X8683, 0X007F,
-  0X007F, 0XF802, 0XF785, 0XF788, 0XF78B, 0XF70F, 0XF712, 0XF695,
-  0XF618, 0XF61B, 0XF59E, 0XF5A1, 0XF524, 0XF4A7, 0XF42A, 0XF3AE,
-  0XF331, 0XF2B4, 0XF237, 0XF1BA, 0XF13D, 0XF040, 0XEFC3, 0XEEC6,
-  0XEDC8, 0XECCB, 0XEB4E, 0XE9D1, 0XE854, 0XE6D6, 0XE4D9, 0XE2DB,
-  0XE05E, 0XDD60, 0XD9E2, 0XD664, 0XD1E5, 0XCD66, 0XC867, 0XC2E7,
-  0XBD67, 0XB7E7, 0XB2E6, 0XAE65, 0XA9E4, 0XA662, 0XA2E0, 0XA05E,
-  0X9D5B, 0X9B59, 0X9956, 0X97D4, 0X9651, 0X94CE, 0X934B, 0X9248,
-  0X9146, 0X9043, 0X8FC0, 0X8EBD, 0X8E3A, 0X8DB7, 0X8D34, 0X8CB1,
-  0X8C2E, 0X8BAA, 0X8B27, 0X8AA4, 0X8A21, 0X8A1E, 0X899B, 0X8998,
-  0X8915, 0X8892, 0X888F, 0X880B, 0X8808, 0X8805, 0X8782, 0X007F,
-  0X007F, 0XF701, 0XF684, 0XF688, 0XF60B, 0XF60E, 0XF591, 0XF594,
-  0XF517, 0XF49A, 0XF49D, 0XF420, 0XF3A3, 0XF326, 0XF2A9, 0XF22D,
-  0XF1B0, 0XF133, 0XF0B6, 0XEFB8, 0XEF3B, 0XEE3E, 0XEDC1, 0XECC4,
-  0XEBC7, 0XEA4A, 0XE94C, 0XE7CF, 0XE652, 0XE454, 0XE257, 0XE059,
-  0XDD5B, 0XDADD, 0XD75F, 0XD3E1, 0XCFE2, 0XCBE3, 0XC764, 0XC264,
-  0XBDE4, 0XB8E4, 0XB463, 0XB062, 0XAC61, 0XA8DF, 0XA55D, 0XA2DB,
-  0XA059, 0X9DD7, 0X9BD4, 0X99D2, 0X984F, 0X96CC, 0X95CA, 0X9447,
-  0X9344, 0X9241, 0X91BE, 0X90BB, 0X9038, 0X8F36, 0X8EB3, 0X8E30,
-  0X8DAD, 0X8D29, 0X8CA6, 0X8C23, 0X8BA0, 0X8B1D, 0X8B1A, 0X8A97,
-  0X8A14, 0X8A11, 0X898E, 0X898B, 0X8908, 0X8904, 0X8881, 0X007F,
-  0X007F, 0XF601, 0XF584, 0XF587, 0XF50A, 0XF50D, 0XF490, 0XF413,
-  0XF416, 0XF399, 0XF31C, 0XF29F, 0XF222, 0XF1A5, 0XF128, 0XF0AB,
-  0XF02E, 0XEFB1, 0XEF34, 0XEE37, 0XEDBA, 0XECBD, 0XEBC0, 0XEAC3,
-  0XE9C5, 0XE848, 0XE74B, 0XE5CD, 0XE3D0, 0XE252, 0XE055, 0XDDD7,
-  0XDB59, 0XD85B, 0XD55C, 0XD25E, 0XCE5F, 0XCA60, 0XC661, 0XC261,
-  0XBDE1, 0XB9E1, 0XB5E0, 0XB1DF, 0XADDE, 0XAADC, 0XA7DB, 0XA4D9,
-  0XA257, 0XA055, 0X9DD2, 0X9C50, 0X9A4D, 0X98CB, 0X97C8, 0X9645,
-  0X9543, 0X9440, 0X933D, 0X923A, 0X91B7, 0X90B4, 0X9031, 0X8FAE,
-  0X8F2B, 0X8EA8, 0X8E25, 0X8DA2, 0X8D1F, 0X8C9C, 0X8C19, 0X8B96,
-  0X8B93, 0X8B10, 0X8A8D, 0X8A8A, 0X8A07, 0X8A04, 0X8981, 0X007F,
-  0X007F, 0XF500, 0XF483, 0XF486, 0XF409, 0XF38C, 0XF38F, 0XF312,
-  0XF295, 0XF218, 0XF21B, 0XF19E, 0XF121, 0XF0A4, 0XF027, 0XEFAA,
-  0XEEAD, 0XEE30, 0XED33, 0XECB6, 0XEBB9, 0XEABB, 0XE9BE, 0XE8C1,
-  0XE7C4, 0XE646, 0XE549, 0XE3CB, 0XE1CE, 0XE050, 0XDDD2, 0XDBD4,
-  0XD956, 0XD6D8, 0XD3DA, 0XD05B, 0XCD5C, 0XC9DD, 0XC5DE, 0XC1DE,
-  0XBE5E, 0XBA5E, 0XB65D, 0XB2DC, 0XAFDB, 0XAC5A, 0XA958, 0XA6D6,
-  0XA454, 0XA252, 0XA050, 0X9E4E, 0X9C4B, 0X9AC9, 0X99C6, 0X9844,
-  0X9741, 0X963E, 0X953B, 0X9439, 0X9336, 0X92B3, 0X91B0, 0X912D,
-  0X902A, 0X8FA7, 0X8F24, 0X8EA1, 0X8E1E, 0X8D9B, 0X8D98, 0X8D15,
-  0X8C92, 0X8C0F, 0X8C0C, 0X8B89, 0X8B06, 0X8B03, 0X8A80, 0X007F,
-  0X007F, 0X007F, 0XF382, 0XF385, 0XF308, 0XF28B, 0XF28E, 0XF211,
-  0XF194, 0XF117, 0XF09A, 0XF01D, 0XEFA0, 0XEF23, 0XEEA6, 0XEE29,
-  0XED2C, 0XECAF, 0XEBB1, 0XEB34, 0XEA37, 0XE93A, 0XE83C, 0XE73F,
-  0XE5C2, 0XE4C4, 0XE347, 0XE1C9, 0XE04B, 0XDE4E, 0XDC50, 0XD9D2,
-  0XD7D4, 0XD4D5, 0XD257, 0XCF58, 0XCC59, 0XC8DA, 0XC55A, 0XC1DB,
-  0XBE5B, 0XBADA, 0XB75A, 0XB3D9, 0XB0D8, 0XADD7, 0XAB55, 0XA854,
-  0XA652, 0XA3D0, 0XA1CE, 0XA04B, 0X9E49, 0X9CC7, 0X9B44, 0X9A42,
-  0X98BF, 0X97BC, 0X96BA, 0X95B7, 0X94B4, 0X9431, 0X932F, 0X92AC,
-  0X91A9, 0X9126, 0X90A3, 0X9020, 0X8F9D, 0X8F1A, 0X8E97, 0X8E14,
-  0X8D91, 0X8D0E, 0X8D0B, 0X8C88, 0X8C05, 0X8C02, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XF281, 0XF284, 0XF207, 0XF18A, 0XF10D, 0XF110,
-  0XF093, 0XF016, 0XEF99, 0XEF1C, 0XEE9F, 0XEE22, 0XED25, 0XECA7,
-  0XEC2A, 0XEB2D, 0XEAB0, 0XE9B3, 0XE8B5, 0XE7B8, 0XE6BB, 0XE5BD,
-  0XE440, 0XE342, 0XE1C5, 0XE047, 0XDE49, 0XDC4B, 0XDA4D, 0XD84F,
-  0XD651, 0XD3D2, 0XD0D4, 0XCE55, 0XCB56, 0XC857, 0XC4D7, 0XC1D7,
-  0XBE57, 0XBB57, 0XB7D7, 0XB4D6, 0XB1D5, 0XAF54, 0XAC52, 0XA9D1,
-  0XA7CF, 0XA5CD, 0XA3CB, 0XA1C9, 0XA047, 0X9E45, 0X9CC2, 0X9BC0,
-  0X9A3D, 0X993B, 0X9838, 0X9735, 0X9633, 0X9530, 0X94AD, 0X93AA,
-  0X9327, 0X92A5, 0X91A2, 0X911F, 0X909C, 0X9019, 0X8F96, 0X8F13,
-  0X8E90, 0X8E8D, 0X8E0A, 0X8D87, 0X8D04, 0X8D01, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XF180, 0XF183, 0XF106, 0XF089, 0XF00C, 0XEF8F,
-  0XEF92, 0XEF15, 0XEE98, 0XED9B, 0XED1D, 0XECA0, 0XEC23, 0XEB26,
-  0XEAA9, 0XE9AC, 0XE92E, 0XE831, 0XE734, 0XE636, 0XE539, 0XE43B,
-  0XE2BE, 0XE140, 0XE042, 0XDE45, 0XDCC7, 0XDAC9, 0XD8CB, 0XD6CC,
-  0XD4CE, 0XD250, 0XCFD1, 0XCD52, 0XCA53, 0XC754, 0XC4D4, 0XC1D4,
-  0XBE54, 0XBB54, 0XB8D4, 0XB5D3, 0XB2D2, 0XB051, 0XADD0, 0XAB4E,
-  0XA94C, 0XA74B, 0XA549, 0XA347, 0XA1C5, 0XA042, 0X9EC0, 0X9D3E,
-  0X9BBB, 0X9AB9, 0X99B6, 0X98B4, 0X97B1, 0X96AE, 0X962C, 0X9529,
-  0X94A6, 0X93A3, 0X9320, 0X929D, 0X921B, 0X9118, 0X9095, 0X9012,
-  0X900F, 0X8F8C, 0X8F09, 0X8E86, 0X8E03, 0X8E00, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XF082, 0XF005, 0XEF88, 0XEF0B, 0XEE8E,
-  0XEE11, 0XED93, 0XED16, 0XEC99, 0XEC1C, 0XEB9F, 0XEAA2, 0XEA24,
-  0XE927, 0XE8AA, 0XE7AD, 0XE6AF, 0XE5B2, 0XE4B4, 0XE3B7, 0XE2B9,
-  0XE13C, 0XE03E, 0XDEC0, 0XDCC2, 0XDB44, 0XD9C6, 0XD7C8, 0XD5CA,
-  0XD34B, 0XD14D, 0XCECE, 0XCC4F, 0XC9D0, 0XC6D0, 0XC451, 0XC151,
-  0XBED1, 0XBBD1, 0XB950, 0XB650, 0XB3CF, 0XB14E, 0XAECD, 0XACCB,
-  0XAA4A, 0XA848, 0XA646, 0XA4C4, 0XA342, 0XA140, 0XA03E, 0X9EBC,
-  0X9D39, 0X9C37, 0X9B34, 0X9A32, 0X992F, 0X982D, 0X972A, 0X96A7,
-  0X95A4, 0X9522, 0X941F, 0X939C, 0X9319, 0X9296, 0X9213, 0X9191,
-  0X910E, 0X908B, 0X9008, 0X8F85, 0X8F02, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XEF81, 0XEF04, 0XEE86, 0XEE09, 0XED8C,
-  0XED0F, 0XEC92, 0XEC15, 0XEB98, 0XEB1A, 0XEA1D, 0XE9A0, 0XE923,
-  0XE825, 0XE728, 0XE6AB, 0XE5AD, 0XE4B0, 0XE3B2, 0XE235, 0XE137,
-  0XE039, 0XDEBC, 0XDD3E, 0XDBC0, 0XDA42, 0XD844, 0XD645, 0XD447,
-  0XD248, 0XD04A, 0XCDCB, 0XCBCC, 0XC94D, 0XC6CD, 0XC3CE, 0XC14E,
-  0XBECE, 0XBC4E, 0XB94D, 0XB6CD, 0XB44C, 0XB24B, 0XAFCA, 0XADC8,
-  0XABC7, 0XA9C5, 0XA7C4, 0XA5C2, 0XA440, 0XA2BE, 0XA13C, 0XA039,
-  0X9EB7, 0X9DB5, 0X9C32, 0X9B30, 0X9A2D, 0X992B, 0X98A8, 0X97A5,
-  0X96A3, 0X9620, 0X959D, 0X949A, 0X9418, 0X9395, 0X9312, 0X928F,
-  0X920C, 0X9189, 0X9106, 0X9084, 0X9001, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XEE02, 0XED85, 0XED08, 0XEC8B,
-  0XEC0E, 0XEB91, 0XEB13, 0XEA96, 0XE999, 0XE91C, 0XE89E, 0XE7A1,
-  0XE724, 0XE626, 0XE529, 0XE42B, 0XE32E, 0XE230, 0XE133, 0XE035,
-  0XDEB7, 0XDD39, 0XDBBB, 0XDA3D, 0XD8BF, 0XD741, 0XD543, 0XD344,
-  0XD146, 0XCF47, 0XCD48, 0XCAC9, 0XC8CA, 0XC64A, 0XC3CA, 0XC14B,
-  0XBECB, 0XBC4A, 0XB9CA, 0XB74A, 0XB549, 0XB2C8, 0XB0C7, 0XAEC6,
-  0XACC4, 0XAAC3, 0XA8C1, 0XA73F, 0XA5BD, 0XA43B, 0XA2B9, 0XA137,
-  0XA035, 0X9EB3, 0X9DB0, 0X9CAE, 0X9BAB, 0X9AA9, 0X99A6, 0X98A4,
-  0X9821, 0X971E, 0X969C, 0X9619, 0X9516, 0X9493, 0X9411, 0X938E,
-  0X930B, 0X9288, 0X9205, 0X9182, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XED01, 0XEC84, 0XEC07, 0XEB89,
-  0XEB0C, 0XEA8F, 0XEA12, 0XE994, 0XE897, 0XE81A, 0XE71D, 0XE69F,
-  0XE5A2, 0XE524, 0XE427, 0XE329, 0XE22C, 0XE12E, 0XE030, 0XDEB3,
-  0XDDB5, 0XDC37, 0XDAB9, 0XD93B, 0XD7BC, 0XD63E, 0XD440, 0XD241,
-  0XD043, 0XCE44, 0XCC45, 0XCA46, 0XC846, 0XC5C7, 0XC347, 0XC147,
-  0XBEC7, 0XBCC7, 0XBA47, 0XB7C6, 0XB5C6, 0XB3C5, 0XB1C4, 0XAFC3,
-  0XADC1, 0XABC0, 0XA9BE, 0XA83C, 0XA6BB, 0XA539, 0XA3B7, 0XA235,
-  0XA133, 0XA030, 0X9EAE, 0X9DAC, 0X9CA9, 0X9BA7, 0X9AA4, 0X9A22,
-  0X991F, 0X989D, 0X979A, 0X9717, 0X9614, 0X9592, 0X950F, 0X948C,
-  0X9409, 0X9387, 0X9304, 0X9281, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEB82, 0XEB05, 0XEA88,
-  0XEA0B, 0XE98D, 0XE910, 0XE893, 0XE795, 0XE718, 0XE61B, 0XE59D,
-  0XE4A0, 0XE3A2, 0XE325, 0XE227, 0XE129, 0XE02C, 0XDEAE, 0XDDB0,
-  0XDC32, 0XDB34, 0XD9B6, 0XD838, 0XD6BA, 0XD53B, 0XD33D, 0XD1BE,
-  0XCFC0, 0XCDC1, 0XCBC2, 0XC9C3, 0XC7C3, 0XC544, 0XC344, 0XC144,
-  0XBEC4, 0XBCC4, 0XBAC4, 0XB843, 0XB643, 0XB442, 0XB241, 0XB040,
-  0XAE3E, 0XACBD, 0XAABB, 0XA93A, 0XA7B8, 0XA636, 0XA4B4, 0XA3B2,
-  0XA230, 0XA12E, 0XA02C, 0X9EA9, 0X9DA7, 0X9CA5, 0X9C22, 0X9B20,
-  0X9A1D, 0X999B, 0X9898, 0X9815, 0X9713, 0X9690, 0X960D, 0X958B,
-  0X9508, 0X9485, 0X9402, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEB01, 0XEA83, 0XE986,
-  0XE909, 0XE88C, 0XE80E, 0XE791, 0XE694, 0XE616, 0XE519, 0XE49B,
-  0XE39E, 0XE2A0, 0XE1A3, 0XE125, 0XE027, 0XDEA9, 0XDDAC, 0XDCAE,
-  0XDB30, 0XDA32, 0XD8B4, 0XD735, 0XD5B7, 0XD439, 0XD23A, 0XD0BB,
-  0XCEBD, 0XCD3E, 0XCB3F, 0XC93F, 0XC740, 0XC541, 0XC341, 0XC141,
-  0XBEC1, 0XBCC1, 0XBAC1, 0XB8C0, 0XB6BF, 0XB4BF, 0XB2BE, 0XB13D,
-  0XAF3B, 0XADBA, 0XABB9, 0XAA37, 0XA8B5, 0XA734, 0XA5B2, 0XA4B0,
-  0XA32E, 0XA22C, 0XA129, 0XA027, 0X9EA5, 0X9E23, 0X9D20, 0X9C1E,
-  0X9B1B, 0X9A99, 0X9996, 0X9914, 0X9811, 0X978E, 0X970C, 0X9689,
-  0X9606, 0X9503, 0X9481, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE982, 0XE905,
-  0XE807, 0XE78A, 0XE70D, 0XE68F, 0XE592, 0XE514, 0XE417, 0XE399,
-  0XE29C, 0XE19E, 0XE0A0, 0XE023, 0XDEA5, 0XDDA7, 0XDCA9, 0XDBAB,
-  0XDA2D, 0XD92F, 0XD7B1, 0XD633, 0XD4B4, 0XD336, 0XD1B7, 0XD038,
-  0XCE3A, 0XCCBB, 0XCABC, 0XC8BC, 0XC6BD, 0XC4BD, 0XC2BE, 0XC0BE,
-  0XBF3E, 0XBD3E, 0XBB3D, 0XB93D, 0XB73C, 0XB53C, 0XB33B, 0XB1BA,
-  0XAFB8, 0XAE37, 0XACB6, 0XAB34, 0XA9B3, 0XA831, 0XA6AF, 0XA5AD,
-  0XA42B, 0XA329, 0XA227, 0XA125, 0XA023, 0X9F20, 0X9E1E, 0X9D1C,
-  0X9C19, 0X9B97, 0X9A94, 0X9A12, 0X990F, 0X988D, 0X980A, 0X9787,
-  0X9685, 0X9602, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE880, 0XE803,
-  0XE785, 0XE688, 0XE60B, 0XE58D, 0XE490, 0XE412, 0XE315, 0XE297,
-  0XE19A, 0XE09C, 0XE01E, 0XDF20, 0XDE23, 0XDCA5, 0XDBA7, 0XDAA9,
-  0XD92B, 0XD82D, 0XD6AE, 0XD530, 0XD431, 0XD2B3, 0XD0B4, 0XCF36,
-  0XCDB7, 0XCBB8, 0XCA38, 0XC839, 0XC6BA, 0XC4BA, 0XC2BB, 0XC0BB,
-  0XBF3B, 0XBD3B, 0XBB3A, 0XB93A, 0XB7B9, 0XB5B8, 0XB438, 0XB237,
-  0XB0B6, 0XAF34, 0XAD33, 0XABB1, 0XAAB0, 0XA92E, 0XA7AD, 0XA6AB,
-  0XA529, 0XA427, 0XA325, 0XA1A3, 0XA0A0, 0XA01E, 0X9F1C, 0X9E1A,
-  0X9D17, 0X9C95, 0X9B92, 0X9B10, 0X9A0D, 0X998B, 0X9908, 0X9805,
-  0X9783, 0X9700, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE701,
-  0XE684, 0XE606, 0XE509, 0XE48B, 0XE40E, 0XE310, 0XE293, 0XE195,
-  0XE097, 0XE01A, 0XDF1C, 0XDE1E, 0XDD20, 0XDC22, 0XDAA4, 0XD9A6,
-  0XD8A8, 0XD72A, 0XD62C, 0XD4AD, 0XD32F, 0XD1B0, 0XD031, 0XCEB3,
-  0XCD34, 0XCB35, 0XC9B5, 0XC836, 0XC637, 0XC4B7, 0XC2B7, 0XC0B7,
-  0XBF37, 0XBD37, 0XBB37, 0XB9B7, 0XB7B6, 0XB635, 0XB4B5, 0XB2B4,
-  0XB133, 0XAFB1, 0XAE30, 0XACAF, 0XAB2D, 0XA9AC, 0XA8AA, 0XA728,
-  0XA626, 0XA524, 0XA3A2, 0XA2A0, 0XA19E, 0XA09C, 0XA01A, 0X9F17,
-  0X9E15, 0X9D13, 0X9C90, 0X9B8E, 0X9B0B, 0X9A89, 0X9986, 0X9904,
-  0X9881, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XE582, 0XE504, 0XE487, 0XE389, 0XE30C, 0XE20E, 0XE191, 0XE093,
-  0XE015, 0XDF17, 0XDE1A, 0XDD1C, 0XDC1E, 0XDB20, 0XDA22, 0XD8A4,
-  0XD7A5, 0XD6A7, 0XD529, 0XD3AA, 0XD2AC, 0XD12D, 0XCFAE, 0XCE30,
-  0XCCB1, 0XCAB1, 0XC932, 0XC7B3, 0XC633, 0XC434, 0XC2B4, 0XC0B4,
-  0XBF34, 0XBD34, 0XBBB4, 0XB9B3, 0XB833, 0XB6B2, 0XB531, 0XB331,
-  0XB1B0, 0XB02E, 0XAEAD, 0XAD2C, 0XAC2A, 0XAAA9, 0XA927, 0XA825,
-  0XA724, 0XA5A2, 0XA4A0, 0XA39E, 0XA29C, 0XA19A, 0XA097, 0XA015,
-  0X9F13, 0X9E11, 0X9D8E, 0X9C8C, 0X9C09, 0X9B07, 0X9A84, 0X9A02,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XE500, 0XE402, 0XE385, 0XE307, 0XE20A, 0XE18C, 0XE08E, 0XE011,
-  0XDF13, 0XDE15, 0XDD17, 0XDC19, 0XDB1B, 0XDA1D, 0XD91F, 0XD821,
-  0XD6A3, 0XD5A4, 0XD4A6, 0XD327, 0XD1A9, 0XD02A, 0XCF2B, 0XCDAD,
-  0XCC2E, 0XCAAE, 0XC8AF, 0XC730, 0XC5B0, 0XC431, 0XC231, 0XC0B1,
-  0XBF31, 0XBDB1, 0XBBB1, 0XBA30, 0XB8B0, 0XB72F, 0XB52E, 0XB3AE,
-  0XB22D, 0XB0AB, 0XAFAA, 0XAE29, 0XACA7, 0XAB26, 0XAA24, 0XA923,
-  0XA7A1, 0XA69F, 0XA59D, 0XA49B, 0XA399, 0XA297, 0XA195, 0XA093,
-  0XA011, 0X9F0E, 0X9E0C, 0X9D8A, 0X9C87, 0X9C05, 0X9B82, 0X9A80,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XE380, 0XE283, 0XE205, 0XE187, 0XE08A, 0XE00C, 0XDF0E,
-  0XDE11, 0XDD13, 0XDC95, 0XDB97, 0XDA99, 0XD99B, 0XD89D, 0XD71E,
-  0XD620, 0XD522, 0XD3A3, 0XD2A5, 0XD126, 0XCFA7, 0XCEA8, 0XCD29,
-  0XCBAA, 0XCA2B, 0XC8AC, 0XC72D, 0XC5AD, 0XC3AE, 0XC22E, 0XC0AE,
-  0XBF2E, 0XBDAE, 0XBC2E, 0XBA2D, 0XB8AD, 0XB72C, 0XB5AB, 0XB42A,
-  0XB2A9, 0XB128, 0XB027, 0XAEA6, 0XAD25, 0XAC23, 0XAAA2, 0XA9A0,
-  0XA89E, 0XA71D, 0XA61B, 0XA519, 0XA417, 0XA315, 0XA293, 0XA191,
-  0XA08E, 0XA00C, 0X9F0A, 0X9E07, 0X9D85, 0X9D03, 0X9C00, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XE201, 0XE103, 0XE085, 0XE008, 0XDF0A, 0XDE0C,
-  0XDD8E, 0XDC90, 0XDB92, 0XDA94, 0XD996, 0XD898, 0XD79A, 0XD69C,
-  0XD59D, 0XD41F, 0XD320, 0XD1A2, 0XD0A3, 0XCF24, 0XCE25, 0XCCA6,
-  0XCB27, 0XC9A8, 0XC829, 0XC6A9, 0XC52A, 0XC3AA, 0XC22B, 0XC0AB,
-  0XBF2B, 0XBDAB, 0XBC2A, 0XBAAA, 0XB929, 0XB7A9, 0XB628, 0XB4A7,
-  0XB326, 0XB1A5, 0XB0A4, 0XAF23, 0XAE22, 0XACA0, 0XAB9F, 0XAA1D,
-  0XA91C, 0XA81A, 0XA718, 0XA616, 0XA514, 0XA412, 0XA310, 0XA20E,
-  0XA18C, 0XA08A, 0XA008, 0X9F05, 0X9E83, 0X9D81, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XE081, 0XE003, 0XDF05, 0XDE07, 0XDD8A,
-  0XDC8C, 0XDB8E, 0XDB10, 0XDA12, 0XD914, 0XD815, 0XD717, 0XD619,
-  0XD49A, 0XD39C, 0XD29D, 0XD11F, 0XD020, 0XCEA1, 0XCDA2, 0XCC23,
-  0XCAA4, 0XC925, 0XC826, 0XC6A6, 0XC527, 0XC3A7, 0XC227, 0XC0A7,
-  0XBF27, 0XBDA7, 0XBC27, 0XBAA7, 0XB926, 0XB7A6, 0XB6A5, 0XB524,
-  0XB3A3, 0XB222, 0XB121, 0XAFA0, 0XAE9F, 0XAD1D, 0XAC1C, 0XAB1A,
-  0XA999, 0XA897, 0XA795, 0XA694, 0XA592, 0XA490, 0XA40E, 0XA30C,
-  0XA20A, 0XA187, 0XA085, 0XA003, 0X9F01, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XDF01, 0XDE83, 0XDD85, 0XDC87,
-  0XDC09, 0XDB0B, 0XDA0D, 0XD90F, 0XD811, 0XD713, 0XD614, 0XD516,
-  0XD418, 0XD319, 0XD21B, 0XD09C, 0XCF9D, 0XCE1E, 0XCD1F, 0XCBA0,
-  0XCA21, 0XC922, 0XC7A3, 0XC623, 0XC4A4, 0XC3A4, 0XC224, 0XC0A4,
-  0XBF24, 0XBDA4, 0XBC24, 0XBB24, 0XB9A3, 0XB823, 0XB6A2, 0XB5A1,
-  0XB420, 0XB29F, 0XB19E, 0XB01D, 0XAF1C, 0XAD9B, 0XAC99, 0XAB98,
-  0XAA96, 0XA994, 0XA893, 0XA791, 0XA68F, 0XA58D, 0XA48B, 0XA389,
-  0XA307, 0XA205, 0XA103, 0XA081, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDD81, 0XDD03, 0XDC05,
-  0XDB07, 0XDA89, 0XD98B, 0XD88D, 0XD78E, 0XD690, 0XD592, 0XD493,
-  0XD395, 0XD296, 0XD118, 0XD019, 0XCF1A, 0XCD9B, 0XCC9C, 0XCB1D,
-  0XCA1E, 0XC89F, 0XC79F, 0XC620, 0XC4A0, 0XC321, 0XC221, 0XC0A1,
-  0XBF21, 0XBDA1, 0XBCA1, 0XBB20, 0XB9A0, 0XB81F, 0XB71F, 0XB59E,
-  0XB49D, 0XB31C, 0XB21B, 0XB09A, 0XAF99, 0XAE98, 0XAD16, 0XAC15,
-  0XAB13, 0XAA12, 0XA910, 0XA80E, 0XA70D, 0XA60B, 0XA509, 0XA487,
-  0XA385, 0XA283, 0XA201, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDC00, 0XDB82,
-  0XDA84, 0XD986, 0XD908, 0XD80A, 0XD70C, 0XD60D, 0XD50F, 0XD411,
-  0XD312, 0XD213, 0XD095, 0XCF96, 0XCE97, 0XCD98, 0XCC19, 0XCB1A,
-  0XC99B, 0XC89C, 0XC71C, 0XC59D, 0XC49D, 0XC31E, 0XC21E, 0XC09E,
-  0XBF1E, 0XBD9E, 0XBC9E, 0XBB1D, 0XBA1D, 0XB89C, 0XB71C, 0XB61B,
-  0XB49A, 0XB399, 0XB218, 0XB117, 0XB016, 0XAF15, 0XAD93, 0XAC92,
-  0XAB91, 0XAA8F, 0XA98D, 0XA88C, 0XA78A, 0XA688, 0XA606, 0XA504,
-  0XA402, 0XA380, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDA80,
-  0XDA02, 0XD904, 0XD805, 0XD787, 0XD689, 0XD58B, 0XD48C, 0XD38E,
-  0XD28F, 0XD191, 0XD012, 0XCF13, 0XCE14, 0XCD15, 0XCB96, 0XCA97,
-  0XC998, 0XC819, 0XC719, 0XC59A, 0XC49A, 0XC31A, 0XC19B, 0XC09B,
-  0XBF1B, 0XBE1B, 0XBC9A, 0XBB1A, 0XBA1A, 0XB899, 0XB799, 0XB618,
-  0XB517, 0XB416, 0XB295, 0XB194, 0XB093, 0XAF92, 0XAE11, 0XAD0F,
-  0XAC0E, 0XAB0C, 0XAA0B, 0XA909, 0XA807, 0XA785, 0XA684, 0XA582,
-  0XA500, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XD881, 0XD783, 0XD685, 0XD606, 0XD508, 0XD409, 0XD30B,
-  0XD20C, 0XD10E, 0XD00F, 0XCE90, 0XCD91, 0XCC92, 0XCB93, 0XCA14,
-  0XC915, 0XC815, 0XC696, 0XC597, 0XC417, 0XC317, 0XC197, 0XC097,
-  0XBF17, 0XBE17, 0XBC97, 0XBB97, 0XBA17, 0XB916, 0XB795, 0XB695,
-  0XB594, 0XB413, 0XB312, 0XB211, 0XB110, 0XAF8F, 0XAE8E, 0XAD8C,
-  0XAC8B, 0XAB89, 0XAA88, 0XA986, 0XA905, 0XA803, 0XA701, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XD700, 0XD602, 0XD503, 0XD485, 0XD387, 0XD288,
-  0XD189, 0XD08B, 0XCF8C, 0XCE8D, 0XCD0E, 0XCC0F, 0XCB10, 0XCA11,
-  0XC892, 0XC792, 0XC693, 0XC513, 0XC414, 0XC314, 0XC194, 0XC094,
-  0XBF14, 0XBE14, 0XBC94, 0XBB94, 0XBA93, 0XB913, 0XB812, 0XB712,
-  0XB591, 0XB490, 0XB38F, 0XB28E, 0XB10D, 0XB00C, 0XAF0B, 0XAE09,
-  0XAD08, 0XAC07, 0XAB05, 0XAA83, 0XA982, 0XA880, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XD481, 0XD402, 0XD304, 0XD205,
-  0XD106, 0XD008, 0XCF09, 0XCE0A, 0XCD0B, 0XCC0C, 0XCA8D, 0XC98E,
-  0XC88F, 0XC78F, 0XC610, 0XC510, 0XC411, 0XC291, 0XC191, 0XC091,
-  0XBF11, 0XBE11, 0XBD11, 0XBB91, 0XBA90, 0XB990, 0XB80F, 0XB70F,
-  0XB60E, 0XB50D, 0XB38C, 0XB28B, 0XB18A, 0XB089, 0XAF88, 0XAE86,
-  0XAD85, 0XAC84, 0XAB82, 0XAB01, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XD281, 0XD182,
-  0XD084, 0XCF85, 0XCE86, 0XCD87, 0XCC88, 0XCB89, 0XCA8A, 0XC98B,
-  0XC80B, 0XC70C, 0XC60D, 0XC50D, 0XC40D, 0XC28E, 0XC18E, 0XC08E,
-  0XBF0E, 0XBE0E, 0XBD0E, 0XBB8D, 0XBA8D, 0XB98D, 0XB88C, 0XB78B,
-  0XB60B, 0XB50A, 0XB409, 0XB308, 0XB207, 0XB106, 0XB005, 0XAF04,
-  0XAE02, 0XAD01, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XD001, 0XCF02, 0XCE03, 0XCD04, 0XCC05, 0XCB06, 0XCA07, 0XC908,
-  0XC808, 0XC709, 0XC609, 0XC48A, 0XC38A, 0XC28A, 0XC18B, 0XC08B,
-  0XBF0B, 0XBE0B, 0XBD0A, 0XBC0A, 0XBB0A, 0XB989, 0XB889, 0XB788,
-  0XB688, 0XB587, 0XB486, 0XB385, 0XB284, 0XB183, 0XB082, 0XAF81,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XCE00, 0XCD01, 0XCC02, 0XCB03, 0XCA04, 0XC904,
-  0XC805, 0XC686, 0XC586, 0XC487, 0XC387, 0XC287, 0XC187, 0XC087,
-  0XBF07, 0XBE07, 0XBD07, 0XBC07, 0XBB07, 0XBA06, 0XB906, 0XB785,
-  0XB684, 0XB584, 0XB483, 0XB382, 0XB281, 0XB180, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XCA80, 0XC981, 0XC881,
-  0XC782, 0XC683, 0XC583, 0XC483, 0XC384, 0XC284, 0XC184, 0XC084,
-  0XBF04, 0XBE04, 0XBD04, 0XBC04, 0XBB03, 0XBA03, 0XB903, 0XB802,
-  0XB701, 0XB601, 0XB500, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XC580, 0XC480, 0XC381, 0XC281, 0XC181, 0XC081,
-  0XBF01, 0XBE01, 0XBD01, 0XBC01, 0XBB00, 0XBA00, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F };
+extern const uint16_t polar[IRIS_WIDTH * IRIS_HEIGHT] asm("defaultEye_polar");
@@ -1,12807 +1,27 @@
+// Generated by tools/assetc -- the tables are linked in from goatEye/*.bin by goatEye.S
+
 #define SCLERA_WIDTH  128
 #define SCLERA_HEIGHT 128
 
-const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] PROGMEM= {
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000 };
+extern const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] asm("goatEye_sclera");
 
 #define IRIS_MAP_WIDTH  402
 #define IRIS_MAP_HEIGHT 64
 
-const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] PROGMEM= {
-  0X2165, 0X2986, 0X31C7, 0X31C7, 0X2966, 0X2966, 0X2966, 0X2166,
-  0X2966, 0X2125, 0X2124, 0X1904, 0X1924, 0X2124, 0X18E4, 0X18E3,
-  0X18E3, 0X1924, 0X2145, 0X2145, 0X2124, 0X2125, 0X2124, 0X2145,
-  0X1924, 0X18E3, 0X10C3, 0X18E3, 0X1904, 0X1924, 0X2125, 0X2125,
-  0X2145, 0X1924, 0X1924, 0X2125, 0X1924, 0X1904, 0X2124, 0X1924,
-  0X2145, 0X2986, 0X2986, 0X2986, 0X29A7, 0X29A7, 0X2986, 0X2986,
-  0X2986, 0X31A7, 0X2166, 0X2145, 0X2145, 0X2145, 0X29A7, 0X2165,
-  0X29A7, 0X2966, 0X31A7, 0X2966, 0X29A7, 0X2966, 0X2966, 0X2966,
-  0X31A7, 0X31A7, 0X29A7, 0X2986, 0X2966, 0X2986, 0X2986, 0X29A7,
-  0X2986, 0X2166, 0X2986, 0X2986, 0X2166, 0X2966, 0X2966, 0X2986,
-  0X2986, 0X2986, 0X2986, 0X2966, 0X2986, 0X2966, 0X31E8, 0X29A7,
-  0X31C7, 0X2986, 0X29A7, 0X29A7, 0X2986, 0X2966, 0X2966, 0X2966,
-  0X2966, 0X2966, 0X2966, 0X2166, 0X2966, 0X2966, 0X2966, 0X2165,
-  0X29A7, 0X2966, 0X2165, 0X2145, 0X2145, 0X2166, 0X2165, 0X2166,
-  0X2145, 0X2145, 0X2145, 0X2125, 0X2166, 0X2986, 0X2125, 0X2145,
-  0X2165, 0X2986, 0X2145, 0X2145, 0X2145, 0X2125, 0X2145, 0X2145,
-  0X2145, 0X2125, 0X2145, 0X2986, 0X2966, 0X2986, 0X2986, 0X2966,
-  0X2966, 0X2966, 0X2966, 0X2986, 0X2966, 0X2966, 0X2966, 0X2165,
-  0X2165, 0X2166, 0X2986, 0X2966, 0X2966, 0X2166, 0X2166, 0X2145,
-  0X18E4, 0X2124, 0X1904, 0X2124, 0X1924, 0X18E3, 0X2125, 0X18E4,
-  0X18E4, 0X2145, 0X2125, 0X1904, 0X2145, 0X2966, 0X29A7, 0X1904,
-  0X2966, 0X2165, 0X2165, 0X2125, 0X2124, 0X2125, 0X2125, 0X2125,
-  0X10C3, 0X2125, 0X2125, 0X18C3, 0X2124, 0X2966, 0X2165, 0X2165,
-  0X2125, 0X2145, 0X2166, 0X2986, 0X31C7, 0X31C7, 0X2986, 0X2986,
-  0X2986, 0X29A7, 0X29A7, 0X2986, 0X1924, 0X18E4, 0X18E4, 0X1904,
-  0X1904, 0X2125, 0X2165, 0X2986, 0X2986, 0X2165, 0X2165, 0X2145,
-  0X2125, 0X18E4, 0X1924, 0X1924, 0X2125, 0X2145, 0X2145, 0X2125,
-  0X2145, 0X1924, 0X2145, 0X2125, 0X2145, 0X2145, 0X1904, 0X2145,
-  0X2145, 0X2125, 0X2125, 0X1924, 0X2125, 0X18E3, 0X1904, 0X1904,
-  0X2125, 0X1904, 0X2125, 0X2145, 0X2145, 0X2145, 0X2125, 0X2145,
-  0X2125, 0X1904, 0X1904, 0X2125, 0X2125, 0X2125, 0X2125, 0X2145,
-  0X2125, 0X2125, 0X2124, 0X2145, 0X2124, 0X2125, 0X1904, 0X2124,
-  0X2124, 0X1924, 0X1924, 0X18E4, 0X18C3, 0X18E4, 0X2125, 0X2125,
-  0X2125, 0X2966, 0X2966, 0X2986, 0X2986, 0X29A7, 0X2966, 0X2145,
-  0X2166, 0X2166, 0X2145, 0X2145, 0X2966, 0X2145, 0X2165, 0X2145,
-  0X2125, 0X1924, 0X2124, 0X2125, 0X1904, 0X18E3, 0X2124, 0X2166,
-  0X2125, 0X2125, 0X2125, 0X2125, 0X2145, 0X2165, 0X2145, 0X2145,
-  0X2145, 0X2966, 0X2125, 0X2145, 0X2145, 0X2165, 0X2125, 0X2125,
-  0X2125, 0X1904, 0X18E3, 0X2125, 0X2125, 0X1924, 0X1924, 0X18E4,
-  0X18E4, 0X18E4, 0X1904, 0X18E4, 0X1904, 0X2125, 0X2125, 0X1924,
-  0X2125, 0X2145, 0X1904, 0X2125, 0X2125, 0X2125, 0X1904, 0X1904,
-  0X2124, 0X2124, 0X18E4, 0X18E4, 0X2124, 0X2125, 0X2124, 0X2125,
-  0X2124, 0X2165, 0X18E3, 0X2125, 0X2145, 0X2145, 0X2145, 0X1904,
-  0X2125, 0X1904, 0X1904, 0X1904, 0X18E4, 0X1904, 0X2125, 0X2124,
-  0X1924, 0X2125, 0X2125, 0X2125, 0X2966, 0X2986, 0X2165, 0X2145,
-  0X2165, 0X2145, 0X1904, 0X2125, 0X2125, 0X2125, 0X2124, 0X2145,
-  0X2145, 0X2145, 0X2145, 0X2145, 0X2145, 0X2166, 0X2125, 0X2125,
-  0X2124, 0X2125, 0X2125, 0X2125, 0X1924, 0X1924, 0X1924, 0X2125,
-  0X2125, 0X1904, 0X1904, 0X2125, 0X2124, 0X2124, 0X2125, 0X2125,
-  0X2125, 0X2125, 0X2124, 0X1904, 0X1904, 0X1904, 0X2125, 0X2145,
-  0X2165, 0X2145, 0X31E8, 0X31E8, 0X31E8, 0X3A08, 0X31C7, 0X29A7,
-  0X31C7, 0X31A7, 0X31C7, 0X2986, 0X2966, 0X2125, 0X2166, 0X2986,
-  0X2125, 0X2966, 0X2165, 0X2986, 0X2986, 0X2966, 0X2145, 0X2966,
-  0X31A7, 0X2986, 0X2145, 0X2125, 0X1904, 0X1904, 0X2145, 0X2966,
-  0X2966, 0X29A7, 0X31C7, 0X2145, 0X2145, 0X2986, 0X2165, 0X2125,
-  0X2145, 0X2966, 0X2986, 0X31E8, 0X31E8, 0X29A7, 0X31E8, 0X31E8,
-  0X31E8, 0X31C7, 0X31C7, 0X31E8, 0X2966, 0X2986, 0X29A7, 0X29A7,
-  0X31E8, 0X31E8, 0X31E8, 0X31E8, 0X31E8, 0X31C7, 0X31E8, 0X31E8,
-  0X31E8, 0X31C7, 0X3A09, 0X3A08, 0X3A08, 0X31C7, 0X31E8, 0X31E8,
-  0X31E8, 0X31C7, 0X3A09, 0X31C7, 0X31C7, 0X31E8, 0X31C7, 0X31C7,
-  0X31E8, 0X31C7, 0X31E8, 0X31C7, 0X31C7, 0X31C7, 0X29A7, 0X31C7,
-  0X31E8, 0X3A08, 0X31E8, 0X31E8, 0X3A08, 0X31E8, 0X31E8, 0X31C7,
-  0X31C7, 0X31C7, 0X31C7, 0X31E8, 0X31C7, 0X31C7, 0X29A7, 0X3A29,
-  0X3A49, 0X29A7, 0X29A7, 0X29A7, 0X29A7, 0X31C7, 0X3A08, 0X31C7,
-  0X31A7, 0X31C7, 0X31C7, 0X29A7, 0X29A7, 0X2986, 0X29A7, 0X31E8,
-  0X31A7, 0X2986, 0X29A7, 0X31C7, 0X31E8, 0X29A7, 0X2986, 0X2966,
-  0X2986, 0X2986, 0X2966, 0X2986, 0X2966, 0X2986, 0X29A7, 0X29A7,
-  0X31A7, 0X31C7, 0X31C7, 0X29A7, 0X2966, 0X31A7, 0X31C7, 0X31C7,
-  0X29A7, 0X2986, 0X2986, 0X2966, 0X31C7, 0X29A7, 0X29A7, 0X29A7,
-  0X29A7, 0X29A7, 0X2145, 0X2145, 0X2145, 0X2145, 0X2165, 0X2145,
-  0X2165, 0X2145, 0X2125, 0X2986, 0X29A7, 0X2966, 0X29A7, 0X31C7,
-  0X3A08, 0X2966, 0X2966, 0X31A7, 0X29A7, 0X2966, 0X2966, 0X2166,
-  0X29A7, 0X2986, 0X2966, 0X2966, 0X2966, 0X2966, 0X2986, 0X2986,
-  0X2986, 0X29A7, 0X2986, 0X2166, 0X29A7, 0X31E8, 0X3A08, 0X3A29,
-  0X3A08, 0X3A08, 0X31E8, 0X3A08, 0X3A29, 0X3A08, 0X2145, 0X1904,
-  0X2145, 0X2125, 0X2145, 0X2966, 0X31C7, 0X31E8, 0X3A08, 0X31C7,
-  0X31A7, 0X31C7, 0X2145, 0X2166, 0X2165, 0X2966, 0X29A7, 0X31A7,
-  0X31C7, 0X29A7, 0X29A7, 0X2986, 0X29A7, 0X29A7, 0X2966, 0X31A7,
-  0X2986, 0X29A7, 0X2986, 0X31E8, 0X2165, 0X2125, 0X2966, 0X2125,
-  0X2986, 0X2986, 0X2986, 0X29A7, 0X29A7, 0X31C7, 0X2986, 0X29A7,
-  0X29A7, 0X2986, 0X2986, 0X2986, 0X2165, 0X29A7, 0X31A7, 0X2986,
-  0X2966, 0X29A7, 0X2966, 0X2966, 0X2166, 0X2966, 0X2966, 0X31E8,
-  0X2966, 0X29A7, 0X2986, 0X2165, 0X2145, 0X2145, 0X1904, 0X2125,
-  0X2166, 0X2966, 0X2986, 0X31C7, 0X31E8, 0X3A09, 0X3A08, 0X31E8,
-  0X31C7, 0X29A7, 0X31C7, 0X31C7, 0X2986, 0X31A7, 0X31A7, 0X31C7,
-  0X31E8, 0X31A7, 0X2986, 0X2986, 0X2165, 0X2986, 0X2966, 0X1904,
-  0X2966, 0X31A7, 0X31E8, 0X29A7, 0X2986, 0X29A7, 0X2986, 0X31C7,
-  0X31C7, 0X31C7, 0X31C7, 0X29A7, 0X31C7, 0X31C7, 0X31C7, 0X31C7,
-  0X29A7, 0X2986, 0X2986, 0X2986, 0X2125, 0X2986, 0X2165, 0X2145,
-  0X2145, 0X2145, 0X2125, 0X2166, 0X2166, 0X2125, 0X2125, 0X2125,
-  0X2145, 0X2966, 0X2125, 0X2145, 0X2166, 0X2966, 0X2166, 0X2966,
-  0X2966, 0X2986, 0X2125, 0X2125, 0X2125, 0X2145, 0X2966, 0X2966,
-  0X2986, 0X2966, 0X2966, 0X29A7, 0X2966, 0X2966, 0X2986, 0X29A7,
-  0X2986, 0X2986, 0X2986, 0X2165, 0X2125, 0X2125, 0X2145, 0X2145,
-  0X2166, 0X2166, 0X2966, 0X2966, 0X29A7, 0X29A7, 0X31A7, 0X31A7,
-  0X29A7, 0X2986, 0X29A7, 0X2986, 0X2966, 0X2986, 0X2986, 0X2986,
-  0X29A7, 0X31C7, 0X31A7, 0X29A7, 0X29A7, 0X2966, 0X31A7, 0X31E8,
-  0X2986, 0X18E3, 0X2986, 0X2966, 0X2966, 0X2966, 0X2145, 0X2145,
-  0X2145, 0X2986, 0X2986, 0X2966, 0X2966, 0X2966, 0X2966, 0X2986,
-  0X2986, 0X2986, 0X2986, 0X2966, 0X2166, 0X2966, 0X2986, 0X2966,
-  0X2986, 0X2986, 0X29A7, 0X31C7, 0X3A09, 0X3A29, 0X3A29, 0X424A,
-  0X3A09, 0X3A49, 0X3A08, 0X3A08, 0X3A08, 0X3A49, 0X31C7, 0X2986,
-  0X31A7, 0X31E8, 0X29A7, 0X29A7, 0X31C7, 0X31C7, 0X31C7, 0X31C7,
-  0X29A7, 0X31C7, 0X31C7, 0X31E8, 0X29A7, 0X2966, 0X2166, 0X2125,
-  0X29A7, 0X31C7, 0X31E8, 0X3A08, 0X3A29, 0X31A7, 0X31C7, 0X31C7,
-  0X31C7, 0X29A7, 0X31C7, 0X31E8, 0X3A08, 0X3A49, 0X424A, 0X3A29,
-  0X426A, 0X426A, 0X424A, 0X3A49, 0X4249, 0X3A09, 0X31C7, 0X31C7,
-  0X31C7, 0X3A08, 0X3A49, 0X4249, 0X3A49, 0X3A29, 0X3A29, 0X3A29,
-  0X3A29, 0X3A29, 0X3A29, 0X4249, 0X426A, 0X424A, 0X3A29, 0X3A49,
-  0X3A49, 0X3A29, 0X3A49, 0X3A08, 0X3A49, 0X3A08, 0X3A09, 0X424A,
-  0X4249, 0X3A29, 0X3A08, 0X3A08, 0X3A49, 0X3A29, 0X3A49, 0X3A29,
-  0X3A09, 0X3A08, 0X3A29, 0X3A49, 0X424A, 0X3A49, 0X4249, 0X3A49,
-  0X3A49, 0X3A29, 0X3A08, 0X424A, 0X3A49, 0X3A49, 0X3A29, 0X3A29,
-  0X3A29, 0X426A, 0X424A, 0X3A09, 0X3A08, 0X3A09, 0X3A29, 0X3A09,
-  0X4A8B, 0X3A49, 0X3A29, 0X3A29, 0X3A29, 0X3A08, 0X31E8, 0X31E8,
-  0X3A08, 0X424A, 0X3A09, 0X31E8, 0X31E8, 0X31E8, 0X3A29, 0X31E8,
-  0X31E8, 0X31C7, 0X31C7, 0X31E8, 0X31E8, 0X31E8, 0X31C7, 0X31C7,
-  0X31E8, 0X31E8, 0X3A08, 0X3A09, 0X4249, 0X31C7, 0X31C7, 0X31E8,
-  0X3A29, 0X3A08, 0X31E8, 0X31C7, 0X31A7, 0X31E8, 0X3A29, 0X31E8,
-  0X31C7, 0X31E8, 0X3A08, 0X3A08, 0X29A7, 0X31E8, 0X2986, 0X2166,
-  0X2986, 0X31A7, 0X31C7, 0X2986, 0X29A7, 0X31A7, 0X3A09, 0X31E8,
-  0X3A29, 0X3A08, 0X4AAB, 0X31A7, 0X29A7, 0X424A, 0X3A08, 0X31C7,
-  0X31C7, 0X3A08, 0X3A08, 0X31E8, 0X2986, 0X29A7, 0X31C7, 0X31C7,
-  0X31C7, 0X31E8, 0X3A09, 0X3A08, 0X31E8, 0X31C7, 0X3A08, 0X426A,
-  0X426A, 0X4A8B, 0X428A, 0X4249, 0X3A29, 0X428B, 0X4ACB, 0X426A,
-  0X3A08, 0X2966, 0X2966, 0X2966, 0X2986, 0X31C7, 0X3A29, 0X424A,
-  0X3A49, 0X31E8, 0X3A08, 0X3A29, 0X31C7, 0X29A7, 0X31C7, 0X31C7,
-  0X3A09, 0X3A29, 0X424A, 0X31E8, 0X3A29, 0X3A08, 0X3A49, 0X3A09,
-  0X3A08, 0X3A08, 0X3A08, 0X3A08, 0X3A08, 0X424A, 0X2986, 0X29A7,
-  0X29A7, 0X29A7, 0X31C7, 0X3A08, 0X3A49, 0X3A49, 0X3A09, 0X3A08,
-  0X3A29, 0X3A29, 0X3A08, 0X3A08, 0X31E8, 0X31E8, 0X31E8, 0X31E8,
-  0X3A08, 0X31C7, 0X31C7, 0X31E8, 0X31C7, 0X31E8, 0X31E8, 0X29A7,
-  0X31C7, 0X3A08, 0X31E8, 0X31E8, 0X3A08, 0X31C7, 0X29A7, 0X29A7,
-  0X29A7, 0X29A7, 0X31C7, 0X31E8, 0X3A29, 0X3A29, 0X426A, 0X4ACB,
-  0X4AAB, 0X426A, 0X424A, 0X31E8, 0X3A29, 0X3A08, 0X3A29, 0X31E8,
-  0X3A09, 0X426A, 0X4249, 0X3A29, 0X31E8, 0X31E8, 0X31C7, 0X29A7,
-  0X3A08, 0X2166, 0X29A7, 0X31C7, 0X3A29, 0X31E8, 0X31C7, 0X31E8,
-  0X31E8, 0X3A09, 0X3A29, 0X4249, 0X3A29, 0X29A7, 0X3A29, 0X424A,
-  0X426A, 0X3A49, 0X31E8, 0X31C7, 0X31E8, 0X31E8, 0X31A7, 0X31E8,
-  0X29A7, 0X2986, 0X2966, 0X29A7, 0X2125, 0X29A7, 0X2986, 0X2966,
-  0X2145, 0X2125, 0X2966, 0X2166, 0X2145, 0X2986, 0X2966, 0X2986,
-  0X31C7, 0X31C7, 0X31C7, 0X31E8, 0X2166, 0X31C7, 0X2966, 0X2986,
-  0X29A7, 0X31C7, 0X31C7, 0X31E8, 0X3A08, 0X3A08, 0X3A08, 0X29A7,
-  0X31E8, 0X3A08, 0X3A29, 0X3A09, 0X3A29, 0X29A7, 0X31A7, 0X31C7,
-  0X31C7, 0X29A7, 0X31C7, 0X31C7, 0X31C7, 0X31E8, 0X3A29, 0X426A,
-  0X426A, 0X426A, 0X3A08, 0X3A08, 0X3A08, 0X31E8, 0X31C7, 0X31C7,
-  0X31A7, 0X31E8, 0X31E8, 0X3A09, 0X3A29, 0X3A09, 0X3A29, 0X31C7,
-  0X3A08, 0X3A29, 0X3A08, 0X31C7, 0X31A7, 0X29A7, 0X31C7, 0X31E8,
-  0X29A7, 0X31A7, 0X31C7, 0X31E8, 0X31E8, 0X31E8, 0X31E8, 0X31E8,
-  0X31E8, 0X3A08, 0X31E8, 0X31E8, 0X31E8, 0X31E8, 0X31E8, 0X31E8,
-  0X31E8, 0X31E8, 0X31E8, 0X3A29, 0X3A08, 0X3A08, 0X4AAB, 0X426A,
-  0X426A, 0X4A8B, 0X426A, 0X424A, 0X4249, 0X426A, 0X4AAB, 0X428A,
-  0X31E8, 0X31C7, 0X3A29, 0X31C7, 0X3A29, 0X31C7, 0X424A, 0X3A29,
-  0X3A09, 0X3A49, 0X3A29, 0X3A29, 0X31E8, 0X424A, 0X31E8, 0X31E8,
-  0X31C7, 0X2986, 0X31E8, 0X4249, 0X426A, 0X424A, 0X426A, 0X3A49,
-  0X3A08, 0X3A29, 0X3A29, 0X3A49, 0X3A49, 0X424A, 0X3A49, 0X4ACC,
-  0X5B2D, 0X4AAB, 0X52EC, 0X4ACC, 0X4AAB, 0X4AAB, 0X4AAB, 0X426A,
-  0X3A29, 0X3A08, 0X3A08, 0X4AAB, 0X4AAB, 0X426A, 0X426A, 0X426A,
-  0X4AAB, 0X428A, 0X4AAB, 0X3A49, 0X4A8B, 0X4ACC, 0X428B, 0X4AAB,
-  0X424A, 0X426A, 0X426A, 0X428A, 0X4AAB, 0X426A, 0X426A, 0X426A,
-  0X424A, 0X4AAB, 0X4A8B, 0X426A, 0X426A, 0X426A, 0X428B, 0X426A,
-  0X4A8B, 0X426A, 0X3A29, 0X426A, 0X428A, 0X426A, 0X428B, 0X426A,
-  0X426A, 0X428B, 0X4A8B, 0X428A, 0X426A, 0X4A8B, 0X4AAB, 0X428A,
-  0X4A8B, 0X426A, 0X4AAB, 0X426A, 0X424A, 0X426A, 0X426A, 0X424A,
-  0X424A, 0X424A, 0X426A, 0X428A, 0X426A, 0X426A, 0X4249, 0X424A,
-  0X3A29, 0X3A29, 0X3A29, 0X4AAB, 0X428A, 0X3A49, 0X424A, 0X424A,
-  0X424A, 0X3A49, 0X3A49, 0X3A29, 0X3A08, 0X3A09, 0X3A09, 0X3A29,
-  0X3A29, 0X3A29, 0X3A29, 0X3A49, 0X4A8B, 0X424A, 0X426A, 0X3A29,
-  0X3A08, 0X31E8, 0X3A29, 0X3A29, 0X3A08, 0X3A29, 0X3A29, 0X31E8,
-  0X426A, 0X31E8, 0X3A08, 0X31E8, 0X426A, 0X426A, 0X31E8, 0X424A,
-  0X31E8, 0X31C7, 0X3A08, 0X31C7, 0X31C7, 0X31C7, 0X31E8, 0X3A08,
-  0X428A, 0X3A49, 0X428A, 0X4AAB, 0X4ACC, 0X3A09, 0X31C7, 0X4ACB,
-  0X4AAB, 0X3A49, 0X31E8, 0X4AAB, 0X4AAB, 0X3A08, 0X3A09, 0X3A29,
-  0X3A08, 0X3A08, 0X3A08, 0X3A29, 0X4ACC, 0X426A, 0X3A29, 0X3A29,
-  0X3A29, 0X4ACB, 0X530C, 0X5B4E, 0X530C, 0X4AAB, 0X428B, 0X530D,
-  0X5B6E, 0X52EC, 0X4AAB, 0X3A09, 0X31E8, 0X31C7, 0X3A09, 0X426A,
-  0X4ACC, 0X4ACB, 0X4AAB, 0X4A8B, 0X428A, 0X3A49, 0X3A09, 0X3A09,
-  0X3A09, 0X3A29, 0X426A, 0X428B, 0X4ACC, 0X4ACB, 0X4AAB, 0X426A,
-  0X426A, 0X4A8B, 0X426A, 0X428A, 0X426A, 0X428A, 0X426A, 0X424A,
-  0X31E8, 0X3A29, 0X3A08, 0X3A29, 0X3A29, 0X3A49, 0X426A, 0X424A,
-  0X426A, 0X31E8, 0X426A, 0X4AAB, 0X426A, 0X426A, 0X424A, 0X3A29,
-  0X3A29, 0X4249, 0X4249, 0X3A29, 0X3A29, 0X3A49, 0X4AAB, 0X3A49,
-  0X3A49, 0X3A29, 0X3A49, 0X4249, 0X3A49, 0X3A29, 0X3A49, 0X3A29,
-  0X3A08, 0X3A08, 0X31E8, 0X3A09, 0X3A29, 0X426A, 0X4AAB, 0X52EC,
-  0X532D, 0X5B6E, 0X5B4E, 0X5B2D, 0X530D, 0X31E8, 0X426A, 0X3A29,
-  0X424A, 0X428A, 0X428B, 0X5B4E, 0X530D, 0X426A, 0X4249, 0X3A49,
-  0X3A08, 0X31C7, 0X31E8, 0X2166, 0X3A09, 0X4249, 0X4A8B, 0X4A8B,
-  0X426A, 0X3A49, 0X3A29, 0X426A, 0X4A8B, 0X426A, 0X4A8B, 0X31E8,
-  0X426A, 0X4AAB, 0X52EC, 0X426A, 0X3A49, 0X3A08, 0X3A49, 0X3A08,
-  0X3A08, 0X426A, 0X3A29, 0X29A7, 0X31A7, 0X31C7, 0X29A7, 0X31E8,
-  0X3A08, 0X2966, 0X2966, 0X2986, 0X3A08, 0X31C7, 0X29A7, 0X31C7,
-  0X31C7, 0X31C7, 0X3A09, 0X3A29, 0X3A08, 0X3A09, 0X3A08, 0X31E8,
-  0X31C7, 0X3A08, 0X3A08, 0X3A29, 0X3A09, 0X426A, 0X4AAB, 0X424A,
-  0X426A, 0X426A, 0X426A, 0X424A, 0X428A, 0X426A, 0X426A, 0X31C7,
-  0X3A49, 0X3A29, 0X3A09, 0X3A08, 0X3A29, 0X3A29, 0X3A29, 0X3A49,
-  0X428B, 0X530D, 0X5B4E, 0X52EC, 0X426A, 0X424A, 0X426A, 0X3A29,
-  0X3A08, 0X3A29, 0X3A09, 0X426A, 0X3A29, 0X4A8B, 0X4AAB, 0X4AAB,
-  0X4A8B, 0X426A, 0X426A, 0X3A49, 0X3A29, 0X426A, 0X3A08, 0X31C7,
-  0X424A, 0X3A29, 0X3A29, 0X3A29, 0X3A49, 0X426A, 0X426A, 0X3A29,
-  0X3A29, 0X3A49, 0X426A, 0X426A, 0X428A, 0X424A, 0X3A29, 0X3A29,
-  0X426A, 0X4ACC, 0X4A8B, 0X3A49, 0X424A, 0X426A, 0X426A, 0X428A,
-  0X4ACB, 0X4ACB, 0X4AAB, 0X4ACC, 0X426A, 0X4AAB, 0X4ACC, 0X4ACC,
-  0X52EC, 0X52EC, 0X428A, 0X424A, 0X424A, 0X3A49, 0X424A, 0X4249,
-  0X428B, 0X426A, 0X4AAB, 0X4AAB, 0X426A, 0X426A, 0X424A, 0X4AAB,
-  0X3A49, 0X3A29, 0X31E8, 0X3A08, 0X3A49, 0X4A8B, 0X52EC, 0X530D,
-  0X4AAB, 0X426A, 0X4249, 0X4ACB, 0X52EC, 0X52EC, 0X4AAB, 0X4AAB,
-  0X426A, 0X52EC, 0X5B4E, 0X5B4E, 0X5B6E, 0X530D, 0X530C, 0X52EC,
-  0X52EC, 0X4ACB, 0X3A09, 0X4A8B, 0X4AAB, 0X530D, 0X52EC, 0X4ACC,
-  0X4ACC, 0X52EC, 0X52EC, 0X4ACB, 0X530C, 0X4AAB, 0X4ACB, 0X4ACC,
-  0X52EC, 0X52EC, 0X428B, 0X428A, 0X4AAB, 0X4AAB, 0X52EC, 0X4AAB,
-  0X4AAB, 0X4ACC, 0X4ACB, 0X4ACB, 0X4ACB, 0X428B, 0X4AAB, 0X4AAB,
-  0X4ACB, 0X4ACB, 0X4AAB, 0X4AAB, 0X4A8B, 0X4AAB, 0X4AAB, 0X4AAB,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4ACC,
-  0X530C, 0X4AAB, 0X4A8B, 0X4ACB, 0X4ACB, 0X4AAB, 0X4AAB, 0X4AAB,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4A8B, 0X4ACC, 0X52EC, 0X4AAB,
-  0X4A8B, 0X4AAB, 0X426A, 0X426A, 0X426A, 0X52EC, 0X52EC, 0X4AAB,
-  0X4AAB, 0X4AAB, 0X4ACB, 0X428A, 0X426A, 0X426A, 0X426A, 0X424A,
-  0X426A, 0X4249, 0X424A, 0X426A, 0X424A, 0X426A, 0X4AAB, 0X3A49,
-  0X424A, 0X426A, 0X424A, 0X3A29, 0X3A49, 0X424A, 0X424A, 0X4249,
-  0X31E8, 0X31E8, 0X52EC, 0X4ACC, 0X3A09, 0X3A49, 0X426A, 0X52EC,
-  0X428A, 0X3A49, 0X3A09, 0X31E8, 0X4249, 0X31E8, 0X3A29, 0X31E8,
-  0X3A08, 0X426A, 0X428B, 0X4AAB, 0X52EC, 0X5B2D, 0X532D, 0X4249,
-  0X31E8, 0X52EC, 0X530D, 0X4AAB, 0X428A, 0X4AAB, 0X4AAB, 0X426A,
-  0X3A49, 0X424A, 0X424A, 0X426A, 0X3A49, 0X426A, 0X4AAB, 0X4A8B,
-  0X426A, 0X29A7, 0X4AAB, 0X5B4E, 0X638F, 0X638F, 0X638F, 0X532D,
-  0X4ACB, 0X638F, 0X63AF, 0X4AAB, 0X4ACB, 0X426A, 0X3A08, 0X3A29,
-  0X426A, 0X428B, 0X52EC, 0X5B4E, 0X5B2D, 0X530D, 0X4ACC, 0X4AAB,
-  0X3A29, 0X3A49, 0X426A, 0X4AAB, 0X52EC, 0X4ACC, 0X5B4E, 0X5B2D,
-  0X5B4E, 0X530D, 0X52EC, 0X4AAB, 0X4ACB, 0X52EC, 0X52EC, 0X4ACB,
-  0X4ACB, 0X4249, 0X426A, 0X426A, 0X426A, 0X424A, 0X424A, 0X4ACB,
-  0X426A, 0X428A, 0X4AAB, 0X4AAB, 0X4ACC, 0X532D, 0X4ACC, 0X4ACB,
-  0X4A8B, 0X4249, 0X424A, 0X4A8B, 0X4ACB, 0X426A, 0X428A, 0X3A49,
-  0X4AAB, 0X4AAB, 0X428A, 0X3A29, 0X426A, 0X530D, 0X4AAB, 0X4AAB,
-  0X4ACC, 0X426A, 0X3A49, 0X3A49, 0X424A, 0X426A, 0X4AAB, 0X4ACC,
-  0X530D, 0X5B4E, 0X5B4E, 0X6BF1, 0X638F, 0X63AF, 0X6BD0, 0X4ACB,
-  0X4ACB, 0X428A, 0X428B, 0X52EC, 0X5B4E, 0X6BD0, 0X6BD0, 0X4ACC,
-  0X4AAB, 0X426A, 0X4249, 0X3A08, 0X3A29, 0X3A08, 0X426A, 0X52EC,
-  0X4A8B, 0X532D, 0X52EC, 0X4A8B, 0X428A, 0X4AAB, 0X4AAB, 0X426A,
-  0X4A8B, 0X4AAB, 0X4ACC, 0X52EC, 0X530C, 0X4AAB, 0X426A, 0X424A,
-  0X3A49, 0X3A08, 0X3A29, 0X4A8B, 0X4AAB, 0X3A08, 0X31E8, 0X31C7,
-  0X31E8, 0X3A49, 0X3A29, 0X3A08, 0X31C7, 0X31C7, 0X3A49, 0X31E8,
-  0X3A29, 0X3A29, 0X3A09, 0X3A49, 0X424A, 0X428B, 0X426A, 0X424A,
-  0X426A, 0X3A29, 0X31C7, 0X3A49, 0X31E8, 0X3A49, 0X426A, 0X428A,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X52EC, 0X4AAB, 0X426A, 0X428A, 0X428A,
-  0X4ACB, 0X4A8B, 0X426A, 0X424A, 0X4AAB, 0X4A8B, 0X4AAB, 0X428B,
-  0X3A29, 0X426A, 0X4AAB, 0X5B4E, 0X6BD0, 0X5B6E, 0X52EC, 0X4AAB,
-  0X4AAB, 0X424A, 0X426A, 0X4AAB, 0X426A, 0X4AAB, 0X52EC, 0X4ACC,
-  0X530C, 0X530D, 0X52EC, 0X4AAB, 0X4AAB, 0X4ACB, 0X4AAB, 0X4A8B,
-  0X424A, 0X424A, 0X4AAB, 0X4AAB, 0X4AAB, 0X424A, 0X428A, 0X428A,
-  0X4A8B, 0X426A, 0X426A, 0X426A, 0X4AAB, 0X4A8B, 0X4AAB, 0X4A8B,
-  0X4A8B, 0X428B, 0X4ACB, 0X52EC, 0X532D, 0X428B, 0X4AAB, 0X5B2D,
-  0X52EC, 0X52EC, 0X532D, 0X52EC, 0X4ACC, 0X428A, 0X52EC, 0X52EC,
-  0X5B2D, 0X532D, 0X530C, 0X532D, 0X530D, 0X52EC, 0X4AAB, 0X4AAB,
-  0X424A, 0X4A8B, 0X4ACC, 0X52EC, 0X4ACC, 0X4ACB, 0X4AAB, 0X4AAB,
-  0X4AAB, 0X4ACC, 0X4ACB, 0X4AAB, 0X4249, 0X426A, 0X4AAB, 0X532D,
-  0X5B6E, 0X63AF, 0X530C, 0X530D, 0X52EC, 0X5B4E, 0X638F, 0X5B6E,
-  0X5B6E, 0X5B6E, 0X530D, 0X5B4E, 0X6BD0, 0X6BF0, 0X63B0, 0X638F,
-  0X636E, 0X5B6E, 0X5B4E, 0X530D, 0X4AAB, 0X4AAB, 0X530C, 0X5B2D,
-  0X532D, 0X530D, 0X530D, 0X5B6E, 0X5B4E, 0X52EC, 0X530C, 0X4ACB,
-  0X52EC, 0X532D, 0X530D, 0X52EC, 0X4ACB, 0X4AAB, 0X4ACC, 0X52EC,
-  0X530D, 0X52EC, 0X4ACC, 0X530D, 0X530C, 0X52EC, 0X4ACC, 0X52EC,
-  0X4ACB, 0X4ACC, 0X4ACC, 0X52EC, 0X4ACC, 0X4ACC, 0X52EC, 0X52EC,
-  0X52EC, 0X4ACB, 0X4ACB, 0X52EC, 0X52EC, 0X52EC, 0X52EC, 0X52EC,
-  0X52EC, 0X532D, 0X52EC, 0X52EC, 0X4ACB, 0X52EC, 0X530C, 0X532D,
-  0X532D, 0X530C, 0X52EC, 0X52EC, 0X52EC, 0X52EC, 0X530C, 0X530D,
-  0X5B4E, 0X530D, 0X530C, 0X52EC, 0X428A, 0X424A, 0X4ACB, 0X52EC,
-  0X5B4E, 0X52EC, 0X52EC, 0X52EC, 0X530C, 0X52EC, 0X4ACB, 0X4AAB,
-  0X4ACC, 0X4ACB, 0X4ACB, 0X428A, 0X4A8B, 0X4AAB, 0X4A8B, 0X428A,
-  0X4AAB, 0X52EC, 0X428A, 0X4AAB, 0X5B2D, 0X4AAB, 0X4AAB, 0X4AAB,
-  0X4ACB, 0X428B, 0X3A29, 0X426A, 0X532D, 0X5B2D, 0X426A, 0X4249,
-  0X426A, 0X532D, 0X4ACC, 0X4249, 0X424A, 0X31E8, 0X3A29, 0X3A08,
-  0X4249, 0X424A, 0X3A08, 0X426A, 0X52EC, 0X4ACB, 0X532D, 0X63AF,
-  0X4A8B, 0X3A29, 0X3A49, 0X5B6E, 0X5B6E, 0X530D, 0X4ACB, 0X4A8B,
-  0X4ACC, 0X428B, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X428B, 0X3A29,
-  0X4ACC, 0X52EC, 0X4ACB, 0X2145, 0X5B4E, 0X63AF, 0X7411, 0X6C11,
-  0X6BF0, 0X638F, 0X532D, 0X7C73, 0X6BF0, 0X4ACC, 0X52EC, 0X4AAB,
-  0X424A, 0X3A29, 0X4AAB, 0X4ACC, 0X5B2D, 0X638F, 0X63B0, 0X5B2D,
-  0X638F, 0X530D, 0X3A49, 0X426A, 0X4ACC, 0X52EC, 0X5B2D, 0X638F,
-  0X6BD0, 0X638F, 0X638F, 0X63AF, 0X5B6E, 0X532D, 0X5B2D, 0X638F,
-  0X530D, 0X52EC, 0X4ACC, 0X4ACB, 0X428B, 0X428B, 0X4AAB, 0X4AAB,
-  0X428A, 0X4ACC, 0X52EC, 0X4ACB, 0X52EC, 0X6BD0, 0X638F, 0X63AF,
-  0X532D, 0X5B4E, 0X5B2D, 0X426A, 0X3A49, 0X4ACC, 0X530D, 0X532D,
-  0X5B4E, 0X4ACB, 0X4ACC, 0X4AAB, 0X4AAB, 0X426A, 0X52EC, 0X6BF0,
-  0X52EC, 0X52EC, 0X428B, 0X5B4E, 0X52EC, 0X4AAB, 0X4ACC, 0X52EC,
-  0X530D, 0X5B4E, 0X63AF, 0X6BD0, 0X6BF1, 0X7431, 0X6BD0, 0X5B6E,
-  0X5B4E, 0X530D, 0X530D, 0X530D, 0X52EC, 0X638F, 0X63AF, 0X7411,
-  0X6BF0, 0X5B4E, 0X530C, 0X4ACB, 0X424A, 0X3A29, 0X424A, 0X426A,
-  0X4AAB, 0X52EC, 0X532D, 0X5B4E, 0X5B2D, 0X52EC, 0X52EC, 0X4ACC,
-  0X530D, 0X530D, 0X4AAB, 0X4ACB, 0X532D, 0X5B4E, 0X638F, 0X530D,
-  0X4AAB, 0X4249, 0X426A, 0X424A, 0X4249, 0X4ACB, 0X52EC, 0X426A,
-  0X3A49, 0X3A08, 0X31E8, 0X424A, 0X426A, 0X426A, 0X428A, 0X426A,
-  0X426A, 0X426A, 0X428B, 0X426A, 0X424A, 0X426A, 0X4A8B, 0X4AAB,
-  0X428B, 0X426A, 0X426A, 0X31C7, 0X31E8, 0X428B, 0X4AAB, 0X52EC,
-  0X4AAB, 0X428A, 0X4AAB, 0X52EC, 0X5B2D, 0X530D, 0X4AAB, 0X4249,
-  0X52EC, 0X4ACC, 0X52EC, 0X4AAB, 0X4AAB, 0X426A, 0X4AAB, 0X52EC,
-  0X530D, 0X5B2D, 0X426A, 0X52EC, 0X530C, 0X5B4E, 0X7411, 0X638F,
-  0X532D, 0X530D, 0X530D, 0X428A, 0X4ACB, 0X52EC, 0X4ACB, 0X52EC,
-  0X5B2D, 0X530C, 0X638F, 0X5B4E, 0X5B2D, 0X532D, 0X4ACB, 0X52EC,
-  0X530D, 0X5B2D, 0X4ACB, 0X4AAB, 0X4AAB, 0X52EC, 0X52EC, 0X4AAB,
-  0X4AAB, 0X52EC, 0X52EC, 0X52EC, 0X4AAB, 0X4ACC, 0X4AAB, 0X52EC,
-  0X52EC, 0X52EC, 0X5B2D, 0X530C, 0X530C, 0X530D, 0X5B2D, 0X530D,
-  0X5B4E, 0X638F, 0X636E, 0X5B4E, 0X5B6E, 0X530C, 0X52EC, 0X4ACC,
-  0X4ACB, 0X532D, 0X5B6E, 0X532D, 0X638F, 0X5B4E, 0X5B4E, 0X5B4E,
-  0X5B4E, 0X4AAB, 0X52EC, 0X4ACC, 0X5B2D, 0X5B4E, 0X530D, 0X52EC,
-  0X4ACC, 0X52EC, 0X530C, 0X5B2D, 0X530D, 0X530C, 0X4ACB, 0X4ACC,
-  0X52EC, 0X5B4E, 0X638F, 0X6BD0, 0X636E, 0X63AF, 0X63AF, 0X6BF0,
-  0X6BD0, 0X7431, 0X7452, 0X6BF0, 0X638F, 0X6BD0, 0X8493, 0X8493,
-  0X7452, 0X6BD0, 0X6BD0, 0X6BF0, 0X6BD0, 0X5B6E, 0X530C, 0X5B4E,
-  0X636E, 0X6BD0, 0X636E, 0X5B4E, 0X5B4E, 0X63AF, 0X5B4E, 0X6BD0,
-  0X530C, 0X52EC, 0X5B2D, 0X5B4E, 0X638F, 0X5B2D, 0X52EC, 0X52EC,
-  0X52EC, 0X532D, 0X5B4E, 0X530D, 0X5B2D, 0X5B2D, 0X532D, 0X530D,
-  0X530D, 0X4ACB, 0X4ACC, 0X52EC, 0X52EC, 0X532D, 0X530D, 0X530C,
-  0X530D, 0X530D, 0X52EC, 0X4ACC, 0X4ACC, 0X52EC, 0X52EC, 0X4ACC,
-  0X530C, 0X530D, 0X530D, 0X52EC, 0X530D, 0X530D, 0X530C, 0X52EC,
-  0X52EC, 0X530D, 0X532D, 0X4ACC, 0X530D, 0X5B2D, 0X530D, 0X52EC,
-  0X5B2D, 0X5B2D, 0X5B6E, 0X5B4E, 0X5B2D, 0X5B4E, 0X4AAB, 0X4AAB,
-  0X530C, 0X532D, 0X5B4E, 0X532D, 0X530D, 0X532D, 0X5B2D, 0X5B4E,
-  0X532D, 0X5B4E, 0X530C, 0X5B4E, 0X5B4E, 0X52EC, 0X52EC, 0X52EC,
-  0X4ACC, 0X4ACC, 0X4ACC, 0X52EC, 0X4ACC, 0X52EC, 0X5B4E, 0X5B6E,
-  0X530C, 0X52EC, 0X4ACC, 0X52EC, 0X31E8, 0X426A, 0X5B4E, 0X5B4E,
-  0X4AAB, 0X426A, 0X4ACC, 0X52EC, 0X4ACB, 0X428B, 0X4A8B, 0X3A29,
-  0X3A49, 0X426A, 0X428B, 0X4AAB, 0X4A8B, 0X4ACC, 0X530D, 0X52EC,
-  0X5B4E, 0X7411, 0X4ACB, 0X424A, 0X3A09, 0X530C, 0X6BD0, 0X5B4E,
-  0X530C, 0X52EC, 0X530D, 0X426A, 0X52EC, 0X5B4E, 0X52EC, 0X4ACB,
-  0X4ACC, 0X4AAB, 0X52EC, 0X5B2D, 0X638F, 0X3A49, 0X6BF0, 0X7431,
-  0X8493, 0X7C52, 0X8493, 0X63AF, 0X6BF0, 0X8493, 0X6BD0, 0X5B4E,
-  0X530D, 0X4ACB, 0X428B, 0X428A, 0X52EC, 0X5B2D, 0X5B6E, 0X7411,
-  0X7C72, 0X638F, 0X5B6E, 0X532D, 0X426A, 0X4A8B, 0X530D, 0X5B4E,
-  0X638F, 0X63AF, 0X7411, 0X63B0, 0X6BD0, 0X7C52, 0X6C11, 0X63AF,
-  0X636E, 0X5B6E, 0X5B4E, 0X532D, 0X530D, 0X532D, 0X530D, 0X52EC,
-  0X52EC, 0X52EC, 0X4ACC, 0X5B4E, 0X52EC, 0X52EC, 0X5B6E, 0X7452,
-  0X8493, 0X7C52, 0X638F, 0X7411, 0X6BD0, 0X5B4E, 0X530D, 0X5B4E,
-  0X63B0, 0X5B2D, 0X63AF, 0X530D, 0X530D, 0X530D, 0X52EC, 0X532D,
-  0X6BF0, 0X63B0, 0X4ACC, 0X5B2D, 0X530D, 0X638F, 0X5B2D, 0X530D,
-  0X532D, 0X5B2D, 0X5B4E, 0X5B6E, 0X6BD0, 0X7411, 0X8493, 0X7432,
-  0X7411, 0X638F, 0X638F, 0X530D, 0X4AAB, 0X5B2D, 0X5B2D, 0X6BF0,
-  0X6C11, 0X8493, 0X7411, 0X6BD0, 0X5B4E, 0X530D, 0X52EC, 0X428B,
-  0X4A8B, 0X4AAB, 0X4ACB, 0X5B4E, 0X638F, 0X638F, 0X638F, 0X636E,
-  0X5B2D, 0X530D, 0X5B4E, 0X6BD0, 0X4ACC, 0X52EC, 0X638F, 0X638F,
-  0X638F, 0X5B4E, 0X4ACB, 0X3A49, 0X4ACB, 0X4AAB, 0X4AAB, 0X4AAB,
-  0X532D, 0X4ACB, 0X4AAB, 0X426A, 0X3A29, 0X4AAB, 0X52EC, 0X4AAB,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X52EC, 0X530D, 0X4AAB, 0X4ACC, 0X52EC,
-  0X4249, 0X4AAB, 0X4A8B, 0X4ACC, 0X4AAB, 0X4AAB, 0X3A49, 0X4ACB,
-  0X4AAB, 0X52EC, 0X4ACC, 0X4AAB, 0X52EC, 0X4ACC, 0X63AF, 0X5B4E,
-  0X530D, 0X4ACB, 0X4ACC, 0X4ACC, 0X5B4E, 0X52EC, 0X52EC, 0X5B2D,
-  0X52EC, 0X5B2D, 0X5B4E, 0X5B2D, 0X532D, 0X52EC, 0X52EC, 0X5B4E,
-  0X7411, 0X7C72, 0X638F, 0X636E, 0X636E, 0X4AAB, 0X5B4E, 0X530D,
-  0X4AAB, 0X5B2D, 0X63AF, 0X5B6E, 0X638F, 0X638F, 0X5B2D, 0X530D,
-  0X530D, 0X5B4E, 0X63AF, 0X5B4E, 0X5B2D, 0X52EC, 0X532D, 0X4ACC,
-  0X5B4E, 0X530D, 0X5B2D, 0X638F, 0X5B2D, 0X5B4E, 0X530D, 0X530C,
-  0X5B4E, 0X5B2D, 0X4ACC, 0X5B4E, 0X638F, 0X5B6E, 0X5B4E, 0X5B6E,
-  0X638F, 0X63AF, 0X6BD0, 0X6BF0, 0X6BD0, 0X63AF, 0X638F, 0X532D,
-  0X52EC, 0X530D, 0X52EC, 0X638F, 0X5B6E, 0X530D, 0X6BD0, 0X6BD0,
-  0X5B6E, 0X638F, 0X5B4E, 0X5B2D, 0X532D, 0X4AAB, 0X532D, 0X5B2D,
-  0X5B4E, 0X5B4E, 0X52EC, 0X532D, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B2D,
-  0X5B4E, 0X530D, 0X5B4E, 0X63B0, 0X6BD0, 0X7C72, 0X638F, 0X6BD0,
-  0X6C11, 0X6C11, 0X6BF0, 0X7432, 0X7C52, 0X7C52, 0X6C11, 0X7431,
-  0X8493, 0X84B3, 0X84B3, 0X6C11, 0X7431, 0X7431, 0X6C11, 0X63AF,
-  0X5B6E, 0X6BD0, 0X7411, 0X63AF, 0X6BD0, 0X6BD0, 0X63AF, 0X6BD0,
-  0X636E, 0X636E, 0X5B2D, 0X5B4E, 0X638F, 0X5B6E, 0X6BD0, 0X532D,
-  0X52EC, 0X5B2D, 0X5B2D, 0X636E, 0X638F, 0X5B4E, 0X5B6E, 0X5B2D,
-  0X5B2D, 0X5B4E, 0X5B2D, 0X4ACC, 0X52EC, 0X532D, 0X530C, 0X5B2D,
-  0X530D, 0X530D, 0X5B2D, 0X5B2D, 0X52EC, 0X532D, 0X532D, 0X52EC,
-  0X530D, 0X532D, 0X532D, 0X5B2D, 0X5B2D, 0X530D, 0X52EC, 0X52EC,
-  0X530D, 0X52EC, 0X52EC, 0X5B2D, 0X530D, 0X530D, 0X530D, 0X530D,
-  0X530D, 0X5B2D, 0X5B2D, 0X5B6E, 0X638F, 0X638F, 0X636E, 0X5B6E,
-  0X530D, 0X530C, 0X52EC, 0X636E, 0X636E, 0X5B6E, 0X638F, 0X638F,
-  0X636E, 0X638F, 0X638F, 0X7431, 0X636E, 0X5B4E, 0X5B4E, 0X5B2D,
-  0X52EC, 0X532D, 0X5B2D, 0X52EC, 0X530D, 0X530D, 0X5B2D, 0X532D,
-  0X5B4E, 0X6BD0, 0X5B4E, 0X5B2D, 0X532D, 0X52EC, 0X3A49, 0X428A,
-  0X532D, 0X63AF, 0X530D, 0X4ACB, 0X52EC, 0X5B4E, 0X5B4E, 0X530C,
-  0X4ACB, 0X4AAB, 0X4A8B, 0X4AAB, 0X4AAB, 0X4ACB, 0X52EC, 0X4ACC,
-  0X530C, 0X532D, 0X638F, 0X8CD4, 0X6C11, 0X2966, 0X31E8, 0X5B4E,
-  0X7411, 0X532D, 0X530C, 0X530D, 0X638F, 0X530D, 0X5B2D, 0X5B2D,
-  0X52EC, 0X52EC, 0X530C, 0X530D, 0X52EC, 0X5B4E, 0X5B6E, 0X5B2D,
-  0X7C72, 0X84B3, 0X8CD4, 0X84B3, 0X84B3, 0X7432, 0X8493, 0X9515,
-  0X6C11, 0X4AAB, 0X52EC, 0X4ACB, 0X426A, 0X428A, 0X52EC, 0X532D,
-  0X52EC, 0X8493, 0X8CD4, 0X7452, 0X63AF, 0X5B2D, 0X4ACC, 0X4ACB,
-  0X532D, 0X63AF, 0X6BD0, 0X6BD0, 0X7431, 0X7411, 0X6C11, 0X7C52,
-  0X7432, 0X6BF0, 0X638F, 0X638F, 0X636E, 0X5B6E, 0X5B6E, 0X532D,
-  0X5B2D, 0X532D, 0X530D, 0X532D, 0X5B2D, 0X532D, 0X5B2D, 0X6BD0,
-  0X7432, 0X8CF4, 0X8CD4, 0X8493, 0X7C52, 0X6C11, 0X7452, 0X6BD0,
-  0X6BD0, 0X6BD0, 0X63B0, 0X63AF, 0X6BF0, 0X63AF, 0X5B2D, 0X5B2D,
-  0X5B4E, 0X5B6E, 0X6BD0, 0X7411, 0X5B4E, 0X532D, 0X5B2D, 0X63B0,
-  0X638F, 0X5B6E, 0X5B6E, 0X52EC, 0X638F, 0X6BF0, 0X6C11, 0X6BD0,
-  0X7C72, 0X8493, 0X7C72, 0X7411, 0X638F, 0X5B4E, 0X532D, 0X5B4E,
-  0X638F, 0X6C11, 0X7C72, 0X8CB3, 0X84B3, 0X7411, 0X5B2D, 0X638F,
-  0X5B6E, 0X52EC, 0X4ACB, 0X4ACC, 0X532D, 0X638F, 0X638F, 0X6BF0,
-  0X6C11, 0X6BF0, 0X63AF, 0X636E, 0X6BD0, 0X6BF0, 0X5B2D, 0X530C,
-  0X6BD0, 0X6BD0, 0X6BD0, 0X63AF, 0X532D, 0X52EC, 0X638F, 0X4ACC,
-  0X530D, 0X5B2D, 0X5B6E, 0X5B2D, 0X52EC, 0X426A, 0X3A09, 0X4ACC,
-  0X5B2D, 0X4ACB, 0X52EC, 0X52EC, 0X532D, 0X532D, 0X52EC, 0X4ACC,
-  0X532D, 0X5B2D, 0X4AAB, 0X530C, 0X4ACC, 0X530D, 0X52EC, 0X4ACB,
-  0X426A, 0X532D, 0X5B4E, 0X5B2D, 0X532D, 0X52EC, 0X5B2D, 0X636E,
-  0X63AF, 0X5B6E, 0X5B2D, 0X52EC, 0X4AAB, 0X532D, 0X5B4E, 0X530D,
-  0X532D, 0X5B4E, 0X5B4E, 0X5B4E, 0X63AF, 0X5B4E, 0X530D, 0X5B4E,
-  0X5B2D, 0X6BF0, 0X7452, 0X7431, 0X63AF, 0X638F, 0X638F, 0X638F,
-  0X63AF, 0X5B4E, 0X52EC, 0X5B2D, 0X636E, 0X63AF, 0X63AF, 0X63AF,
-  0X5B4E, 0X52EC, 0X5B2D, 0X7411, 0X7C72, 0X7411, 0X5B4E, 0X5B2D,
-  0X636E, 0X638F, 0X5B6E, 0X5B6E, 0X638F, 0X63B0, 0X532D, 0X6BF0,
-  0X63AF, 0X63AF, 0X63AF, 0X63AF, 0X5B4E, 0X638F, 0X6BD0, 0X63AF,
-  0X638F, 0X636E, 0X63B0, 0X6BD0, 0X7411, 0X7432, 0X7431, 0X6BF0,
-  0X6BF0, 0X5B6E, 0X5B2D, 0X532D, 0X5B2D, 0X638F, 0X5B6E, 0X636E,
-  0X6BF0, 0X638F, 0X6BD0, 0X63AF, 0X638F, 0X7452, 0X5B2D, 0X52EC,
-  0X5B4E, 0X6BF1, 0X7432, 0X6BF0, 0X638F, 0X63AF, 0X638F, 0X6BD0,
-  0X638F, 0X638F, 0X638F, 0X5B6E, 0X63B0, 0X63AF, 0X7411, 0X7C72,
-  0X7411, 0X6BF0, 0X6BF0, 0X7431, 0X63B0, 0X7C72, 0X8493, 0X7C52,
-  0X7432, 0X7C52, 0X84B3, 0X84B3, 0X84B3, 0X8CB3, 0X7432, 0X8493,
-  0X7431, 0X6BF0, 0X6BD0, 0X6BF0, 0X7431, 0X7411, 0X6BD0, 0X7432,
-  0X7C52, 0X7C52, 0X7411, 0X6BD0, 0X638F, 0X638F, 0X6BF0, 0X7411,
-  0X6BF0, 0X5B6E, 0X4AAB, 0X530D, 0X63AF, 0X6BD0, 0X6BD0, 0X6BF0,
-  0X63AF, 0X638F, 0X5B4E, 0X5B2D, 0X5B6E, 0X52EC, 0X5B2D, 0X5B2D,
-  0X5B4E, 0X5B4E, 0X532D, 0X5B2D, 0X5B4E, 0X638F, 0X532D, 0X5B6E,
-  0X5B4E, 0X4ACB, 0X532D, 0X5B2D, 0X5B4E, 0X530D, 0X52EC, 0X530D,
-  0X52EC, 0X532D, 0X530D, 0X530D, 0X532D, 0X532D, 0X532D, 0X530D,
-  0X52EC, 0X530C, 0X5B2D, 0X5B4E, 0X5B4E, 0X636E, 0X638F, 0X638F,
-  0X638F, 0X5B2D, 0X532D, 0X5B2D, 0X52EC, 0X6C11, 0X5B2D, 0X638F,
-  0X63AF, 0X638F, 0X63AF, 0X5B4E, 0X5B6E, 0X6BD0, 0X7C72, 0X5B4E,
-  0X5B4E, 0X5B4E, 0X52EC, 0X5B2D, 0X5B4E, 0X52EC, 0X5B6E, 0X638F,
-  0X5B4E, 0X5B2D, 0X5B4E, 0X7411, 0X6BF0, 0X5B4E, 0X63AF, 0X530D,
-  0X426A, 0X52EC, 0X5B2D, 0X6BF0, 0X636E, 0X530D, 0X5B4E, 0X638F,
-  0X63AF, 0X5B4E, 0X426A, 0X52EC, 0X530D, 0X530C, 0X52EC, 0X4ACC,
-  0X530C, 0X52EC, 0X5B4E, 0X5B4E, 0X63B0, 0X8CF4, 0X8493, 0X18E3,
-  0X4ACC, 0X5B4E, 0X6BF1, 0X5B6E, 0X530D, 0X4ACC, 0X63AF, 0X5B4E,
-  0X5B6E, 0X638F, 0X532D, 0X532D, 0X5B2D, 0X5B6E, 0X5B2D, 0X5B6E,
-  0X63AF, 0X7432, 0X8CD4, 0X9514, 0X9D35, 0X8CF4, 0X8CD4, 0X8CD4,
-  0X8CF4, 0XA576, 0X8CD4, 0X6BD0, 0X5B6E, 0X5B4E, 0X530D, 0X530C,
-  0X5B2D, 0X638F, 0X63AF, 0X8CF4, 0X9515, 0X9515, 0X6C11, 0X638F,
-  0X428B, 0X52EC, 0X5B6E, 0X638F, 0X6BD0, 0X6BF0, 0X7431, 0X7431,
-  0X7432, 0X7431, 0X7C52, 0X7411, 0X63AF, 0X636E, 0X5B6E, 0X5B4E,
-  0X638F, 0X638F, 0X638F, 0X5B4E, 0X5B2D, 0X636E, 0X5B6E, 0X638F,
-  0X6BD0, 0X7432, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X84B3, 0X7C72,
-  0X7C52, 0X7411, 0X6BF0, 0X7432, 0X63AF, 0X63AF, 0X6BF0, 0X6BD0,
-  0X6BD0, 0X5B2D, 0X5B4E, 0X636E, 0X7452, 0X7411, 0X638F, 0X638F,
-  0X63AF, 0X7411, 0X63AF, 0X63B0, 0X63AF, 0X424A, 0X638F, 0X7411,
-  0X7432, 0X7C72, 0X8CD4, 0X8493, 0X8493, 0X7432, 0X63AF, 0X5B6E,
-  0X52EC, 0X5B2D, 0X63AF, 0X7432, 0X84B3, 0X8CD4, 0X8CD4, 0X7C72,
-  0X7432, 0X7431, 0X6BF0, 0X532D, 0X52EC, 0X52EC, 0X530C, 0X638F,
-  0X7411, 0X7431, 0X7411, 0X7C72, 0X6BD0, 0X6BD0, 0X6BD0, 0X6BF0,
-  0X6BD0, 0X638F, 0X6BD0, 0X7C52, 0X7431, 0X6BF1, 0X7411, 0X4ACB,
-  0X6BD0, 0X636E, 0X532D, 0X63AF, 0X63AF, 0X5B2D, 0X63AF, 0X4A8B,
-  0X424A, 0X426A, 0X5B4E, 0X530D, 0X5B2D, 0X530C, 0X5B4E, 0X5B4E,
-  0X428B, 0X532D, 0X63AF, 0X5B4E, 0X5B4E, 0X5B4E, 0X638F, 0X52EC,
-  0X5B2D, 0X532D, 0X426A, 0X63AF, 0X636E, 0X5B2D, 0X5B4E, 0X5B4E,
-  0X638F, 0X6BF0, 0X638F, 0X63AF, 0X5B4E, 0X52EC, 0X5B2D, 0X638F,
-  0X638F, 0X5B2D, 0X5B2D, 0X5B6E, 0X5B4E, 0X6BD0, 0X6BF1, 0X63B0,
-  0X530D, 0X63AF, 0X6BF0, 0X7C72, 0X8493, 0X7C52, 0X7431, 0X6C11,
-  0X5B2D, 0X6BF0, 0X636E, 0X638F, 0X530D, 0X5B2D, 0X5B4E, 0X6BD0,
-  0X6BD0, 0X63B0, 0X638F, 0X5B4E, 0X63AF, 0X7432, 0X7C72, 0X7411,
-  0X63AF, 0X63AF, 0X638F, 0X7411, 0X7411, 0X7411, 0X7411, 0X63AF,
-  0X6BD0, 0X63AF, 0X63B0, 0X6BD0, 0X6BF1, 0X6BD0, 0X6BD0, 0X6C11,
-  0X7411, 0X7C52, 0X6BD0, 0X63B0, 0X6C11, 0X7432, 0X7432, 0X8493,
-  0X7C72, 0X7C52, 0X7411, 0X6BD0, 0X5B4E, 0X5B2D, 0X5B2D, 0X5B6E,
-  0X52EC, 0X636E, 0X6BF0, 0X63B0, 0X63AF, 0X63AF, 0X636E, 0X63B0,
-  0X6BD0, 0X5B4E, 0X638F, 0X6BF0, 0X7432, 0X7411, 0X7411, 0X6BD0,
-  0X530D, 0X6BD0, 0X6BD0, 0X6BD0, 0X6BF0, 0X6BF0, 0X6C11, 0X6C11,
-  0X7432, 0X7C72, 0X8493, 0X7411, 0X7432, 0X7C73, 0X7C52, 0X7C72,
-  0X7C72, 0X7C72, 0X7C72, 0X7C73, 0X8493, 0X8493, 0X8493, 0X84B3,
-  0X7C52, 0X7432, 0X7411, 0X7432, 0X7431, 0X6BF0, 0X7411, 0X6BF0,
-  0X6BD0, 0X8493, 0X8493, 0X7C72, 0X7432, 0X7411, 0X63AF, 0X6BF0,
-  0X7C72, 0X7C72, 0X7431, 0X638F, 0X638F, 0X4ACC, 0X7411, 0X7411,
-  0X6BD0, 0X63B0, 0X6C11, 0X6BF0, 0X63AF, 0X638F, 0X638F, 0X5B4E,
-  0X5B6E, 0X5B6E, 0X636E, 0X532D, 0X5B4E, 0X532D, 0X5B2D, 0X5B2D,
-  0X532D, 0X5B2D, 0X5B2D, 0X532D, 0X5B2D, 0X5B2D, 0X5B4E, 0X5B4E,
-  0X5B2D, 0X530C, 0X52EC, 0X5B2D, 0X532D, 0X5B4E, 0X5B2D, 0X5B4E,
-  0X5B2D, 0X530D, 0X530D, 0X52EC, 0X530C, 0X5B2D, 0X530D, 0X636E,
-  0X636E, 0X638F, 0X638F, 0X5B6E, 0X532D, 0X5B4E, 0X5B6E, 0X63AF,
-  0X638F, 0X63AF, 0X63B0, 0X63B0, 0X6BD0, 0X63B0, 0X5B6E, 0X638F,
-  0X7411, 0X5B4E, 0X638F, 0X5B6E, 0X532D, 0X5B2D, 0X530D, 0X532D,
-  0X636E, 0X638F, 0X636E, 0X638F, 0X638F, 0X63B0, 0X8493, 0X530D,
-  0X638F, 0X52EC, 0X1904, 0X52EC, 0X638F, 0X6BF0, 0X63AF, 0X5B2D,
-  0X5B4E, 0X638F, 0X6BF1, 0X530D, 0X426A, 0X530D, 0X5B4E, 0X532D,
-  0X530C, 0X52EC, 0X532D, 0X5B4E, 0X530D, 0X638F, 0X7411, 0X8CD4,
-  0X9535, 0X3A29, 0X63AF, 0X6BD0, 0X6BF0, 0X63AF, 0X638F, 0X5B4E,
-  0X6BF0, 0X6BD0, 0X63AF, 0X63B0, 0X530D, 0X532D, 0X638F, 0X636E,
-  0X63AF, 0X6BD0, 0X6BF0, 0X8CB3, 0X9515, 0X9D55, 0X9D35, 0X8CF4,
-  0X8CF4, 0X9515, 0X9D35, 0XB5F8, 0X9515, 0X6BF0, 0X5B2D, 0X5B2D,
-  0X5B2D, 0X4AAB, 0X532D, 0X5B4E, 0X6C11, 0X8CD4, 0X9515, 0X94F4,
-  0X7432, 0X5B4E, 0X52EC, 0X5B2D, 0X638F, 0X6BD0, 0X63AF, 0X7411,
-  0X7411, 0X7432, 0X7432, 0X7C52, 0X7452, 0X6C11, 0X5B6E, 0X5B6E,
-  0X638F, 0X638F, 0X63AF, 0X63AF, 0X6BD0, 0X4ACB, 0X6C11, 0X6BF0,
-  0X63B0, 0X63B0, 0X7431, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X8CD4,
-  0X8493, 0X7C72, 0X7C52, 0X7411, 0X7431, 0X6BF1, 0X6BD0, 0X63AF,
-  0X6BF0, 0X6BD0, 0X6BD0, 0X63AF, 0X63AF, 0X7411, 0X7432, 0X7432,
-  0X7452, 0X638F, 0X5B2D, 0X7411, 0X6BD0, 0X6BD0, 0X636E, 0X31C7,
-  0X5B4E, 0X6BD0, 0X7431, 0X8493, 0X9515, 0X9514, 0X84B3, 0X7432,
-  0X6BD0, 0X63AF, 0X530C, 0X532D, 0X7411, 0X6BF1, 0X84B3, 0X9515,
-  0X9515, 0X8CD4, 0X7C72, 0X7431, 0X638F, 0X5B4E, 0X4ACC, 0X530C,
-  0X4ACC, 0X5B4E, 0X6C11, 0X7C52, 0X7C72, 0X8493, 0X7452, 0X6BF1,
-  0X638F, 0X6BF0, 0X6BF0, 0X6BF0, 0X6BD0, 0X7C52, 0X7C72, 0X7C52,
-  0X7C72, 0X6BD0, 0X6BD0, 0X6BD0, 0X52EC, 0X5B2D, 0X7431, 0X6C11,
-  0X6BD0, 0X4AAB, 0X4249, 0X4AAB, 0X5B4E, 0X638F, 0X5B2D, 0X5B4E,
-  0X5B4E, 0X5B4E, 0X532D, 0X638F, 0X6BD0, 0X63AF, 0X638F, 0X5B2D,
-  0X5B4E, 0X5B2D, 0X5B2D, 0X530C, 0X52EC, 0X63AF, 0X6BD0, 0X6BD0,
-  0X63AF, 0X638F, 0X638F, 0X7C52, 0X6BF1, 0X6BD0, 0X638F, 0X52EC,
-  0X52EC, 0X63AF, 0X6BD0, 0X638F, 0X5B6E, 0X6BF0, 0X63B0, 0X6BF0,
-  0X7411, 0X7452, 0X5B4E, 0X6BF0, 0X7431, 0X7C52, 0X8CB3, 0X7C72,
-  0X7432, 0X6BF0, 0X5B4E, 0X638F, 0X5B6E, 0X6BD0, 0X5B4E, 0X6C11,
-  0X638F, 0X6BD0, 0X638F, 0X6BD0, 0X6BD0, 0X5B4E, 0X6BD0, 0X7C72,
-  0X638F, 0X7411, 0X6BF1, 0X6BF1, 0X6BD0, 0X8493, 0X7431, 0X7452,
-  0X7432, 0X6BD0, 0X7411, 0X7411, 0X7411, 0X63B0, 0X7411, 0X6BF0,
-  0X7411, 0X6BF0, 0X7431, 0X7431, 0X6BF0, 0X6BD0, 0X7432, 0X6BF0,
-  0X84B3, 0X8CD4, 0X84B3, 0X7C72, 0X6C11, 0X6BD0, 0X5B4E, 0X530D,
-  0X52EC, 0X5B2D, 0X530D, 0X6BD0, 0X7C72, 0X6BD0, 0X6BF1, 0X7C52,
-  0X63AF, 0X638F, 0X5B4E, 0X4ACC, 0X6BD0, 0X7411, 0X7432, 0X7411,
-  0X6BF0, 0X6BF0, 0X63AF, 0X6BD0, 0X6BF1, 0X6BF1, 0X7432, 0X6BD0,
-  0X7411, 0X6BF0, 0X7C52, 0X8493, 0X8493, 0X7C73, 0X7C72, 0X8493,
-  0X7432, 0X7C52, 0X7C52, 0X7C72, 0X7452, 0X7C52, 0X8493, 0X7432,
-  0X7C72, 0X8CD4, 0X7C73, 0X7C72, 0X7411, 0X7C52, 0X7C52, 0X7411,
-  0X7411, 0X7431, 0X6BF1, 0X8493, 0X8493, 0X7C52, 0X7431, 0X6BF1,
-  0X638F, 0X6C11, 0X7432, 0X7C72, 0X7432, 0X63AF, 0X5B6E, 0X63AF,
-  0X7C52, 0X7431, 0X6BF0, 0X63AF, 0X7C72, 0X7411, 0X6BD0, 0X6BD0,
-  0X6BF0, 0X638F, 0X638F, 0X638F, 0X63AF, 0X5B6E, 0X5B2D, 0X5B2D,
-  0X5B2D, 0X532D, 0X5B4E, 0X532D, 0X5B4E, 0X5B4E, 0X5B4E, 0X532D,
-  0X5B2D, 0X5B4E, 0X5B4E, 0X52EC, 0X5B2D, 0X530D, 0X532D, 0X532D,
-  0X532D, 0X5B4E, 0X5B2D, 0X532D, 0X530D, 0X426A, 0X5B2D, 0X5B6E,
-  0X5B6E, 0X638F, 0X638F, 0X5B4E, 0X63AF, 0X638F, 0X5B2D, 0X5B6E,
-  0X5B6E, 0X6BD0, 0X638F, 0X638F, 0X63B0, 0X63AF, 0X6BD0, 0X63AF,
-  0X63AF, 0X5B6E, 0X63AF, 0X638F, 0X638F, 0X532D, 0X6BD0, 0X530D,
-  0X530D, 0X5B6E, 0X5B2D, 0X63AF, 0X6C11, 0X638F, 0X4ACB, 0X5B6E,
-  0X6BF0, 0X638F, 0X6BD0, 0X5B2D, 0X4AAB, 0X532D, 0X5B6E, 0X6BF0,
-  0X8493, 0X4ACC, 0X638F, 0X638F, 0X63AF, 0X5B4E, 0X4ACB, 0X532D,
-  0X5B4E, 0X5B2D, 0X530D, 0X4AAB, 0X530C, 0X5B2D, 0X530C, 0X5B2D,
-  0X8493, 0X9515, 0XAD97, 0X4AAB, 0X638F, 0X6BF0, 0X6BF1, 0X6BD0,
-  0X638F, 0X63AF, 0X6BF0, 0X6BF0, 0X7411, 0X6C11, 0X5B4E, 0X4ACC,
-  0X638F, 0X63AF, 0X63B0, 0X63AF, 0X638F, 0X8CB3, 0X84B3, 0X9D35,
-  0X9515, 0X8CF4, 0X9D35, 0X9515, 0XA576, 0XB5F8, 0X9D35, 0X7C52,
-  0X638F, 0X5B4E, 0X530C, 0X532D, 0X530D, 0X638F, 0X6BD0, 0X84B3,
-  0X9D56, 0X9D35, 0X84B3, 0X63B0, 0X52EC, 0X5B6E, 0X63AF, 0X6BF0,
-  0X6BF0, 0X7431, 0X7432, 0X7452, 0X7C73, 0X7C72, 0X7432, 0X6BF0,
-  0X63AF, 0X638F, 0X63AF, 0X63B0, 0X63B0, 0X638F, 0X8493, 0X63AF,
-  0X7411, 0X6BF0, 0X6BD0, 0X6BF1, 0X7C52, 0X94F4, 0X9515, 0X8CD4,
-  0X8493, 0X9514, 0X84B3, 0X8493, 0X7411, 0X6BF0, 0X7432, 0X6BD0,
-  0X6BD0, 0X6C11, 0X7C72, 0X7432, 0X6C11, 0X6C11, 0X6BF0, 0X7431,
-  0X8493, 0X7C52, 0X7C72, 0X7431, 0X6BD0, 0X7452, 0X7411, 0X7431,
-  0X63AF, 0X5B2D, 0X530C, 0X63AF, 0X7C52, 0X8CB3, 0X9D35, 0XA576,
-  0X8CF4, 0X638F, 0X6BD0, 0X6BD0, 0X5B4E, 0X5B2D, 0X6BF0, 0X7431,
-  0X8CD4, 0X9D56, 0X9D56, 0X9515, 0X7431, 0X7432, 0X6BD0, 0X5B2D,
-  0X5B2D, 0X52EC, 0X4ACC, 0X532D, 0X6C11, 0X8CF4, 0X8493, 0X84B3,
-  0X7C73, 0X7431, 0X6BF0, 0X7C52, 0X7431, 0X7411, 0X63AF, 0X7411,
-  0X8493, 0X7C72, 0X7431, 0X7432, 0X6BF1, 0X638F, 0X4AAB, 0X6BD0,
-  0X84B3, 0X7C73, 0X7431, 0X4ACC, 0X426A, 0X52EC, 0X5B4E, 0X63AF,
-  0X63AF, 0X5B4E, 0X5B4E, 0X5B2D, 0X5B2D, 0X63AF, 0X6BF1, 0X6BF1,
-  0X6BD0, 0X5B4E, 0X6BD0, 0X63AF, 0X4A8B, 0X7411, 0X5B6E, 0X63AF,
-  0X7432, 0X7432, 0X63B0, 0X6BF0, 0X7452, 0X7C72, 0X7C52, 0X6BD0,
-  0X638F, 0X5B4E, 0X530C, 0X638F, 0X6BF0, 0X63AF, 0X638F, 0X7411,
-  0X6BD0, 0X6BF1, 0X7432, 0X7431, 0X6BD0, 0X6BF0, 0X7452, 0X84B3,
-  0X8CD4, 0X7C72, 0X7411, 0X63AF, 0X532D, 0X63AF, 0X426A, 0X6BD0,
-  0X638F, 0X6BD0, 0X6BF1, 0X6BF0, 0X63AF, 0X638F, 0X6BD0, 0X6BF0,
-  0X6BF0, 0X7C73, 0X6BF0, 0X7411, 0X6BD0, 0X7432, 0X6BF0, 0X7C73,
-  0X7431, 0X7432, 0X6BD0, 0X7411, 0X7C52, 0X7C72, 0X7C72, 0X7C52,
-  0X7C52, 0X7411, 0X7411, 0X7411, 0X7C73, 0X7C72, 0X6BF0, 0X6C11,
-  0X8CB3, 0X63B0, 0X8CF4, 0X9D35, 0X8CD4, 0X7C72, 0X7411, 0X6BD0,
-  0X530D, 0X530C, 0X530D, 0X5B6E, 0X6BD0, 0X6BF0, 0X84B3, 0X6BF1,
-  0X63B0, 0X7431, 0X63AF, 0X532D, 0X52EC, 0X4ACC, 0X5B6E, 0X7C52,
-  0X7C72, 0X7C52, 0X7431, 0X7431, 0X6BD0, 0X7452, 0X7452, 0X63AF,
-  0X7431, 0X6BF0, 0X7411, 0X7432, 0X7C72, 0X8CD4, 0X8493, 0X8493,
-  0X7C72, 0X7C52, 0X7C52, 0X7C72, 0X7C52, 0X7C72, 0X7C52, 0X8493,
-  0X84B3, 0X7C72, 0X7C52, 0X8493, 0X8CB3, 0X7C72, 0X7431, 0X7431,
-  0X7432, 0X7411, 0X7431, 0X7C52, 0X636E, 0X8CF4, 0X8493, 0X7411,
-  0X7452, 0X7411, 0X638F, 0X7411, 0X7431, 0X7411, 0X7C72, 0X7411,
-  0X6BD0, 0X6BF0, 0X7411, 0X6BF1, 0X6BF0, 0X6BF0, 0X7C52, 0X6BD0,
-  0X63AF, 0X6BD0, 0X7411, 0X638F, 0X636E, 0X6BD0, 0X6BF0, 0X5B6E,
-  0X532D, 0X5B6E, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B4E,
-  0X5B2D, 0X52EC, 0X5B2D, 0X5B2D, 0X5B2D, 0X5B2D, 0X52EC, 0X4ACC,
-  0X5B4E, 0X52EC, 0X5B4E, 0X5B6E, 0X5B4E, 0X5B2D, 0X4A8B, 0X52EC,
-  0X530D, 0X5B6E, 0X5B6E, 0X638F, 0X63AF, 0X636E, 0X6C11, 0X638F,
-  0X638F, 0X638F, 0X6BD0, 0X6BD0, 0X6BF0, 0X63AF, 0X63AF, 0X6BD0,
-  0X63AF, 0X638F, 0X638F, 0X5B6E, 0X52EC, 0X638F, 0X5B4E, 0X638F,
-  0X63AF, 0X5B4E, 0X5B4E, 0X636E, 0X638F, 0X6BD0, 0X6BD0, 0X5B4E,
-  0X5B6E, 0X636E, 0X6BD0, 0X6BD0, 0X63AF, 0X636E, 0X532D, 0X530C,
-  0X638F, 0X84B3, 0X8493, 0X636E, 0X6BD0, 0X63AF, 0X638F, 0X5B4E,
-  0X5B2D, 0X5B2D, 0X5B4E, 0X636E, 0X532D, 0X3A29, 0X5B2D, 0X5B6E,
-  0X4AAB, 0X4ACC, 0X8CD4, 0X9514, 0XADB7, 0X5B4E, 0X5B2D, 0X7452,
-  0X63B0, 0X63AF, 0X63AF, 0X6BF0, 0X7411, 0X6BF0, 0X7C52, 0X6BD0,
-  0X530D, 0X52EC, 0X5B6E, 0X638F, 0X6BD0, 0X63AF, 0X6BF1, 0X8493,
-  0X8CD4, 0X8CF4, 0X9515, 0X8CF4, 0X9D35, 0X9D56, 0XA576, 0XB5F8,
-  0XA596, 0X8CD4, 0X6C11, 0X638F, 0X638F, 0X5B2D, 0X5B4E, 0X6C11,
-  0X6BD0, 0X7C52, 0XA596, 0XA597, 0X8CD4, 0X6BF0, 0X4AAB, 0X6BD0,
-  0X6BF0, 0X6C11, 0X532D, 0X7431, 0X7452, 0X7C52, 0X8CD4, 0X7C72,
-  0X7411, 0X6BD0, 0X6BD0, 0X638F, 0X63B0, 0X63AF, 0X63B0, 0X638F,
-  0X6BD0, 0X7432, 0X7411, 0X6BF0, 0X7411, 0X7432, 0X8CB3, 0X9515,
-  0X9515, 0X94F4, 0X8CD4, 0X84B3, 0X8493, 0X7C73, 0X7C52, 0X7452,
-  0X7411, 0X6BF0, 0X6BD0, 0X7411, 0X7C72, 0X7411, 0X7411, 0X8493,
-  0X6BF0, 0X7411, 0X8493, 0X84B3, 0X8493, 0X8493, 0X7432, 0X84B3,
-  0X7432, 0X6BD0, 0X63AF, 0X6BD0, 0X63B0, 0X7431, 0X7C72, 0X9515,
-  0XA576, 0XA576, 0X9D55, 0X8493, 0X7431, 0X6BD0, 0X5B4E, 0X636E,
-  0X6BF0, 0X7452, 0X8CD4, 0X9D35, 0X9D56, 0X9515, 0X84B3, 0X7C73,
-  0X6BF0, 0X638F, 0X530D, 0X428B, 0X424A, 0X4ACC, 0X7452, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X7C72, 0X7C72, 0X7411, 0X7431, 0X7432, 0X6BF1,
-  0X5B2D, 0X7432, 0X8493, 0X8493, 0X8493, 0X7411, 0X7432, 0X5B2D,
-  0X52EC, 0X7C52, 0X7C52, 0X7432, 0X7432, 0X52EC, 0X4ACB, 0X4ACB,
-  0X63AF, 0X6BF1, 0X63B0, 0X5B4E, 0X636E, 0X532D, 0X63B0, 0X6BF0,
-  0X6C11, 0X6BF0, 0X6BD0, 0X638F, 0X7411, 0X636E, 0X52EC, 0X5B4E,
-  0X52EC, 0X5B4E, 0X6BF1, 0X7C72, 0X6BF1, 0X7432, 0X7C72, 0X8493,
-  0X7C72, 0X6BD0, 0X638F, 0X5B2D, 0X4AAB, 0X532D, 0X6C11, 0X7431,
-  0X7411, 0X6C11, 0X63AF, 0X7431, 0X7C52, 0X7C72, 0X6BF0, 0X6BF1,
-  0X8493, 0X94F4, 0X94F4, 0X8493, 0X6BF0, 0X638F, 0X530C, 0X5B4E,
-  0X5B6E, 0X6BF1, 0X6BF0, 0X63AF, 0X6BF0, 0X6BF0, 0X5B4E, 0X5B6E,
-  0X63B0, 0X6BF1, 0X7432, 0X7432, 0X6BF0, 0X7431, 0X7432, 0X8493,
-  0X7411, 0X8493, 0X6BF0, 0X7431, 0X7432, 0X7C52, 0X8493, 0X84B3,
-  0X8493, 0X6BF0, 0X8493, 0X7432, 0X6BD0, 0X7431, 0X7C52, 0X7C72,
-  0X63AF, 0X6BF0, 0X8493, 0X8493, 0X8493, 0X9D35, 0X94F4, 0X6BF1,
-  0X6BF0, 0X5B6E, 0X532D, 0X5B4E, 0X5B4E, 0X63AF, 0X6BF1, 0X63AF,
-  0X6BF0, 0X6BF1, 0X6BD0, 0X7C52, 0X6BD0, 0X5B2D, 0X530C, 0X4AAB,
-  0X532D, 0X6BF1, 0X8493, 0X7C72, 0X7C52, 0X7432, 0X6BF1, 0X7C52,
-  0X6BF0, 0X63AF, 0X7411, 0X7432, 0X7C52, 0X7432, 0X8CD4, 0X84B3,
-  0X8493, 0X8493, 0X7C52, 0X7C73, 0X8493, 0X84B3, 0X8493, 0X7C73,
-  0X7431, 0X84B3, 0X8CD4, 0X8493, 0X7431, 0X7C72, 0X84B3, 0X7432,
-  0X7411, 0X7432, 0X7432, 0X7411, 0X7452, 0X7C72, 0X63AF, 0X8493,
-  0X7432, 0X7431, 0X7C72, 0X7411, 0X7411, 0X7C52, 0X7411, 0X7431,
-  0X7452, 0X6C11, 0X6BD0, 0X6BF1, 0X6BF0, 0X6BF0, 0X6BF1, 0X6BD0,
-  0X7C72, 0X6C11, 0X6BD0, 0X6BF0, 0X6BD0, 0X63B0, 0X63AF, 0X63AF,
-  0X6BF0, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B4E, 0X63AF, 0X532D, 0X5B6E,
-  0X5B2D, 0X5B6E, 0X428A, 0X530D, 0X5B2D, 0X5B4E, 0X5B6E, 0X530D,
-  0X5B2D, 0X52EC, 0X532D, 0X530C, 0X5B4E, 0X5B6E, 0X5B4E, 0X636E,
-  0X52EC, 0X52EC, 0X5B4E, 0X636E, 0X636E, 0X6BD0, 0X63B0, 0X5B6E,
-  0X636E, 0X5B6E, 0X5B4E, 0X5B2D, 0X6BF0, 0X6BF1, 0X7411, 0X6BD0,
-  0X6BD0, 0X63AF, 0X638F, 0X5B4E, 0X5B4E, 0X5B2D, 0X4ACB, 0X6C11,
-  0X638F, 0X5B4E, 0X63AF, 0X5B4E, 0X530C, 0X5B2D, 0X638F, 0X6BF0,
-  0X63AF, 0X5B2D, 0X5B4E, 0X5B4E, 0X63AF, 0X63AF, 0X63AF, 0X638F,
-  0X4ACB, 0X530D, 0X7411, 0X8CD4, 0X84B3, 0X638F, 0X638F, 0X63AF,
-  0X63AF, 0X5B2D, 0X4AAB, 0X4AAB, 0X530D, 0X5B6E, 0X5B2D, 0X4ACB,
-  0X638F, 0X63AF, 0X532D, 0X63AF, 0X7411, 0X8CD4, 0X9D55, 0X7431,
-  0X532D, 0X7452, 0X7452, 0X5B2D, 0X6BD0, 0X6BF0, 0X7431, 0X6BD0,
-  0X7432, 0X6BF0, 0X532D, 0X530D, 0X5B4E, 0X6BD0, 0X6BD0, 0X5B2D,
-  0X7431, 0X8493, 0X8CD4, 0X94F4, 0X9514, 0X9515, 0X9D55, 0X9D56,
-  0XA576, 0XADB7, 0XADB7, 0X8CF4, 0X7452, 0X6BF0, 0X6BF0, 0X6BD0,
-  0X6BD0, 0X7431, 0X8493, 0X8CD4, 0X9D55, 0X9514, 0X8493, 0X6BF1,
-  0X638F, 0X6BD0, 0X7411, 0X7411, 0X638F, 0X7452, 0X7C72, 0X7C52,
-  0X8CD4, 0X7C52, 0X6BF1, 0X6BD0, 0X6BD0, 0X638F, 0X63AF, 0X63B0,
-  0X6BD0, 0X638F, 0X6BF0, 0X6BD0, 0X6BD0, 0X6BD0, 0X6BF0, 0X7C72,
-  0X9514, 0X9515, 0X94F4, 0X8CF4, 0X8CD4, 0X84B3, 0X7452, 0X7411,
-  0X7411, 0X7431, 0X6BF0, 0X5B6E, 0X63B0, 0X6BD0, 0X6BF0, 0X7411,
-  0X7C52, 0X7432, 0X7432, 0X6C11, 0X84B3, 0X9D35, 0X8CF4, 0X8CD4,
-  0X8CB3, 0X8493, 0X7C52, 0X6BD0, 0X638F, 0X63B0, 0X7431, 0X7C52,
-  0X8493, 0X9515, 0XADB7, 0XA576, 0XA576, 0X8CD4, 0X7C72, 0X7432,
-  0X5B2D, 0X636E, 0X63AF, 0X6BD0, 0X8493, 0X9D35, 0X9D56, 0XADB7,
-  0X8CF4, 0X7452, 0X6BD0, 0X636E, 0X5B4E, 0X4AAB, 0X4AAB, 0X4AAB,
-  0X6BF0, 0X8CD4, 0X8CD4, 0X84B3, 0X8493, 0X7C73, 0X7411, 0X6BF0,
-  0X6BF0, 0X6BD0, 0X52EC, 0X6BD0, 0X8493, 0X8493, 0X8CD4, 0X7411,
-  0X7431, 0X638F, 0X63B0, 0X8493, 0X7411, 0X6BF0, 0X6BD0, 0X5B4E,
-  0X5B2D, 0X4ACC, 0X638F, 0X6C11, 0X6BF0, 0X63B0, 0X638F, 0X638F,
-  0X638F, 0X6BF0, 0X6BF0, 0X7432, 0X7C72, 0X6BD0, 0X7411, 0X638F,
-  0X5B4E, 0X5B2D, 0X4AAB, 0X532D, 0X6BD0, 0X9514, 0X6BF0, 0X7411,
-  0X6C11, 0X7432, 0X7431, 0X6BD0, 0X5B6E, 0X530C, 0X4AAB, 0X5B2D,
-  0X6BD0, 0X7432, 0X7411, 0X6BF1, 0X5B6E, 0X7452, 0X7C73, 0X84B3,
-  0X52EC, 0X8CD4, 0X9515, 0X9D35, 0X9535, 0X7C72, 0X7431, 0X63B0,
-  0X530D, 0X5B4E, 0X636E, 0X6BD0, 0X6C11, 0X5B4E, 0X6C11, 0X6BF0,
-  0X636E, 0X5B6E, 0X5B4E, 0X6C11, 0X84B3, 0X7C52, 0X7432, 0X7411,
-  0X7C73, 0X8CB3, 0X84B3, 0X8CF4, 0X63AF, 0X7411, 0X7431, 0X8493,
-  0X9515, 0X8493, 0X7C52, 0X7C52, 0X7C72, 0X7452, 0X7411, 0X7432,
-  0X7C73, 0X7431, 0X6BD0, 0X63AF, 0X7452, 0X8493, 0X94F4, 0XA596,
-  0X8CD4, 0X7411, 0X6BD0, 0X5B4E, 0X52EC, 0X5B2D, 0X5B2D, 0X5B4E,
-  0X5B6E, 0X638F, 0X8493, 0X7431, 0X6BD0, 0X7411, 0X6BD0, 0X636E,
-  0X5B4E, 0X4ACB, 0X530D, 0X6BD0, 0X84B3, 0X84B3, 0X8493, 0X7C52,
-  0X8493, 0X7C72, 0X6BF0, 0X5B4E, 0X6BF1, 0X8493, 0X7C72, 0X8493,
-  0X84B3, 0X8CB3, 0X84B3, 0X8493, 0X8493, 0X84B3, 0X84B3, 0X84B3,
-  0X8CB3, 0X84B3, 0X8493, 0X8CD4, 0X84B3, 0X8493, 0X7432, 0X7411,
-  0X8493, 0X7C73, 0X636E, 0X638F, 0X6C11, 0X7432, 0X7431, 0X7C72,
-  0X6BD0, 0X7432, 0X63B0, 0X7C52, 0X7432, 0X7431, 0X7452, 0X7C52,
-  0X7431, 0X7452, 0X7411, 0X6C11, 0X7431, 0X63AF, 0X6BF1, 0X6BF0,
-  0X6BF0, 0X6BF0, 0X7C73, 0X6BF1, 0X6BD0, 0X6BF0, 0X6BD0, 0X6BF0,
-  0X6BF0, 0X63AF, 0X63B0, 0X636E, 0X636E, 0X5B4E, 0X63AF, 0X6BF0,
-  0X638F, 0X6BD0, 0X638F, 0X636E, 0X4ACC, 0X5B2D, 0X638F, 0X6BD0,
-  0X5B4E, 0X532D, 0X5B4E, 0X530D, 0X52EC, 0X52EC, 0X4ACC, 0X5B6E,
-  0X638F, 0X638F, 0X5B6E, 0X5B4E, 0X636E, 0X5B4E, 0X5B4E, 0X636E,
-  0X638F, 0X636E, 0X5B6E, 0X5B4E, 0X5B6E, 0X530D, 0X638F, 0X8493,
-  0X63AF, 0X63AF, 0X7411, 0X7411, 0X636E, 0X5B4E, 0X532D, 0X52EC,
-  0X636E, 0X6BF0, 0X63B0, 0X5B4E, 0X5B6E, 0X532D, 0X4ACB, 0X5B2D,
-  0X63B0, 0X6BD0, 0X7C52, 0X638F, 0X636E, 0X5B4E, 0X638F, 0X6BD0,
-  0X638F, 0X6BF0, 0X4ACC, 0X638F, 0X7411, 0X84B3, 0X8493, 0X5B4E,
-  0X638F, 0X7411, 0X63AF, 0X532D, 0X4ACC, 0X4AAB, 0X530D, 0X5B2D,
-  0X638F, 0X5B2D, 0X63B0, 0X63AF, 0X532D, 0X5B4E, 0X7432, 0X8493,
-  0X8CF4, 0X7431, 0X5B4E, 0X7C52, 0X7C72, 0X6BF0, 0X6BF0, 0X6BF1,
-  0X7432, 0X7411, 0X7411, 0X63B0, 0X530D, 0X5B2D, 0X5B6E, 0X6BF0,
-  0X6BD0, 0X6BF0, 0X7C52, 0X8493, 0X8CD4, 0X8CF4, 0X9515, 0X9D35,
-  0X9D35, 0XA576, 0XADB7, 0XAD97, 0XADB7, 0X9515, 0X7C73, 0X7431,
-  0X6BF1, 0X6BF0, 0X63AF, 0X7452, 0X8CF4, 0X9535, 0X9D35, 0X8CD4,
-  0X7C72, 0X7411, 0X63AF, 0X6C11, 0X7C52, 0X7C72, 0X6C11, 0X7C52,
-  0X7C72, 0X7C72, 0X8493, 0X7C72, 0X7452, 0X6BD0, 0X63AF, 0X5B4E,
-  0X63AF, 0X6BD0, 0X7411, 0X6BD0, 0X6BF0, 0X6C11, 0X7411, 0X6BD0,
-  0X6BF0, 0X7411, 0X84B3, 0X9514, 0X8CF4, 0X8CF4, 0X8CD4, 0X8493,
-  0X7431, 0X7411, 0X63AF, 0X7431, 0X6BD0, 0X428A, 0X638F, 0X63B0,
-  0X638F, 0X6BD0, 0X7C72, 0X7C52, 0X7C72, 0X7C52, 0X9515, 0X9D55,
-  0X9514, 0X8CD4, 0X84B3, 0X7C72, 0X7C52, 0X6BF0, 0X6BD0, 0X6BD0,
-  0X6BF1, 0X7452, 0X8493, 0X9514, 0XA576, 0XA597, 0X9D56, 0X84B3,
-  0X7C72, 0X6BD0, 0X5B4E, 0X638F, 0X6BD0, 0X6BD0, 0X7C72, 0X94F4,
-  0X9D55, 0XAD97, 0X9D35, 0X7C72, 0X6BF0, 0X63AF, 0X5B6E, 0X4ACC,
-  0X426A, 0X4ACB, 0X7411, 0X8493, 0X8CD4, 0X8493, 0X84B3, 0X7C72,
-  0X6BF0, 0X63AF, 0X7411, 0X6C11, 0X638F, 0X5B2D, 0X84B3, 0X8CD4,
-  0X8CB3, 0X7C52, 0X7452, 0X6BD0, 0X6BD0, 0X84B3, 0X6BD0, 0X63AF,
-  0X7431, 0X638F, 0X5B4E, 0X5B2D, 0X6BD0, 0X7411, 0X7432, 0X7431,
-  0X6BF1, 0X6BD0, 0X63AF, 0X63AF, 0X7431, 0X8493, 0X8493, 0X7411,
-  0X7432, 0X6BD0, 0X638F, 0X5B2D, 0X5B2D, 0X5B4E, 0X63AF, 0X7C52,
-  0X7431, 0X6BF0, 0X7432, 0X7C52, 0X6BF1, 0X638F, 0X5B4E, 0X52EC,
-  0X4AAB, 0X530C, 0X638F, 0X7411, 0X7431, 0X636E, 0X63B0, 0X7431,
-  0X7432, 0X8493, 0X8493, 0X84B3, 0X9D35, 0XA576, 0X9515, 0X8493,
-  0X7C72, 0X7411, 0X5B2D, 0X5B4E, 0X6BD0, 0X6BF0, 0X7C52, 0X6BF0,
-  0X6BF1, 0X7431, 0X63AF, 0X5B6E, 0X5B4E, 0X6BF1, 0X8493, 0X7C73,
-  0X7C72, 0X7C52, 0X84B3, 0X8CD4, 0X8CD4, 0X84B3, 0X6BF0, 0X638F,
-  0X63AF, 0X8493, 0X84B3, 0X7C73, 0X7C73, 0X7C52, 0X7452, 0X6BD0,
-  0X638F, 0X7411, 0X7C52, 0X6BF0, 0X6BF0, 0X63B0, 0X7C52, 0X8CF4,
-  0X9D35, 0X9D56, 0X8CD4, 0X6BF0, 0X6BD0, 0X5B2D, 0X532D, 0X5B2D,
-  0X638F, 0X638F, 0X63AF, 0X6BD0, 0X7C72, 0X8493, 0X7C72, 0X8493,
-  0X63AF, 0X638F, 0X5B4E, 0X52EC, 0X530C, 0X7432, 0X8CB3, 0X84B3,
-  0X7C72, 0X6BF1, 0X8493, 0X84B3, 0X5B4E, 0X5B4E, 0X63B0, 0X84B3,
-  0X8CD4, 0X7452, 0X8493, 0X9D35, 0X8CD4, 0X8493, 0X7C72, 0X8CD4,
-  0X8CD4, 0X84B3, 0X8CD4, 0X8CD4, 0X7C52, 0X8CD4, 0X8CB3, 0X8493,
-  0X7432, 0X7C52, 0X7C72, 0X8493, 0X638F, 0X63AF, 0X7411, 0X7432,
-  0X7432, 0X7C52, 0X7C52, 0X84B3, 0X7452, 0X7C52, 0X7C52, 0X7432,
-  0X7432, 0X7432, 0X7452, 0X7431, 0X6BD0, 0X7432, 0X7C52, 0X7411,
-  0X6BF1, 0X6BF1, 0X6BF0, 0X6BD0, 0X7C52, 0X7411, 0X7411, 0X6BD0,
-  0X6BD0, 0X6BF0, 0X6BF0, 0X6BD0, 0X63B0, 0X63AF, 0X638F, 0X638F,
-  0X6BF0, 0X6BF0, 0X6BF0, 0X6BF1, 0X63B0, 0X63AF, 0X4AAB, 0X530D,
-  0X5B4E, 0X638F, 0X638F, 0X4ACC, 0X5B4E, 0X530D, 0X530D, 0X52EC,
-  0X424A, 0X5B4E, 0X63AF, 0X638F, 0X638F, 0X5B4E, 0X532D, 0X5B2D,
-  0X5B2D, 0X5B6E, 0X5B6E, 0X638F, 0X6BD0, 0X5B4E, 0X5B4E, 0X530D,
-  0X63AF, 0X7452, 0X7431, 0X6BF0, 0X6BD0, 0X7432, 0X6BD0, 0X5B4E,
-  0X638F, 0X5B2D, 0X6BD0, 0X6BF0, 0X6BF0, 0X7411, 0X636E, 0X4ACC,
-  0X4ACC, 0X638F, 0X63AF, 0X532D, 0X7C72, 0X638F, 0X638F, 0X5B6E,
-  0X638F, 0X6BF0, 0X636E, 0X6BD0, 0X5B4E, 0X5B4E, 0X7C52, 0X8CF4,
-  0X8493, 0X6BD0, 0X5B6E, 0X63B0, 0X63AF, 0X5B4E, 0X638F, 0X530D,
-  0X530D, 0X5B4E, 0X63B0, 0X5B4E, 0X638F, 0X63AF, 0X638F, 0X530D,
-  0X6BF0, 0X7C72, 0X8493, 0X7C72, 0X6BD0, 0X7432, 0X7C72, 0X6BF0,
-  0X63AF, 0X6BD0, 0X7432, 0X7C72, 0X7C52, 0X636E, 0X638F, 0X5B4E,
-  0X638F, 0X6BF0, 0X7431, 0X7C72, 0X7C72, 0X8493, 0X8CD4, 0X9515,
-  0X9D35, 0XA596, 0X9D56, 0XB5F8, 0XADB7, 0XADD7, 0XA576, 0X9515,
-  0X8493, 0X7452, 0X7C52, 0X7431, 0X7C52, 0X84B3, 0X9535, 0X9515,
-  0X94F4, 0X84B3, 0X84B3, 0X7411, 0X638F, 0X7411, 0X7C72, 0X8493,
-  0X8493, 0X8493, 0X84B3, 0X8493, 0X7C72, 0X7C72, 0X7C52, 0X6BF0,
-  0X638F, 0X5B4E, 0X63B0, 0X7411, 0X7432, 0X7411, 0X6BF0, 0X7431,
-  0X7431, 0X532D, 0X7411, 0X7C52, 0X8493, 0X9D35, 0X9D35, 0X9D55,
-  0X84B3, 0X7C52, 0X6BD0, 0X6BF1, 0X63AF, 0X6BF1, 0X6C11, 0X638F,
-  0X638F, 0X63AF, 0X63B0, 0X6BD0, 0X7C52, 0X7C52, 0X8493, 0X8CD4,
-  0XA597, 0X9D35, 0X9515, 0X8CF4, 0X84B3, 0X8493, 0X7452, 0X6BF0,
-  0X63AF, 0X638F, 0X6BD0, 0X7411, 0X7C73, 0X8CF4, 0XA596, 0XBE39,
-  0XADB7, 0X9D35, 0X8CD4, 0X638F, 0X532D, 0X63AF, 0X6BD0, 0X5B4E,
-  0X8493, 0X9514, 0X9D35, 0X9515, 0X9515, 0X7432, 0X6BD0, 0X6BD0,
-  0X638F, 0X532D, 0X424A, 0X52EC, 0X8493, 0X84B3, 0X84B3, 0X84B3,
-  0X8CB3, 0X7C72, 0X63AF, 0X638F, 0X6BD0, 0X6BF1, 0X5B2D, 0X4A8B,
-  0X8493, 0X84B3, 0X8CD4, 0X7452, 0X7C73, 0X6BF1, 0X7411, 0X84B3,
-  0X6BF0, 0X6BF0, 0X7C72, 0X6BF0, 0X638F, 0X5B4E, 0X6BF0, 0X6C11,
-  0X6BF1, 0X7411, 0X7411, 0X6BF0, 0X52EC, 0X638F, 0X7432, 0X8493,
-  0X9535, 0X7C72, 0X7452, 0X63AF, 0X5B4E, 0X5B4E, 0X638F, 0X63AF,
-  0X5B4E, 0X63B0, 0X8493, 0X7C52, 0X7432, 0X7C52, 0X6BF0, 0X638F,
-  0X5B6E, 0X530D, 0X4ACC, 0X532D, 0X5B6E, 0X7411, 0X6BF1, 0X636E,
-  0X6BD0, 0X7431, 0X7C52, 0X7C73, 0X8493, 0X8493, 0X8CD4, 0X9535,
-  0X9515, 0X8493, 0X7432, 0X6BD0, 0X5B2D, 0X638F, 0X638F, 0X6BD0,
-  0X8493, 0X7C52, 0X7432, 0X7411, 0X63B0, 0X63AF, 0X5B4E, 0X6BF1,
-  0X7C52, 0X8493, 0X84B3, 0X7C73, 0X8CD4, 0X8CF4, 0X8CF4, 0X84B3,
-  0X8493, 0X7452, 0X6C11, 0X8493, 0X84B3, 0X8493, 0X8493, 0X7452,
-  0X7411, 0X7432, 0X63AF, 0X6BF1, 0X7411, 0X7C52, 0X5B6E, 0X5B4E,
-  0X7C72, 0X9D35, 0X9D56, 0XA576, 0X8CD4, 0X6BD0, 0X6BF0, 0X5B2D,
-  0X5B2D, 0X5B6E, 0X8493, 0X636E, 0X63AF, 0X7C52, 0X84B3, 0X8CD4,
-  0X9515, 0X9514, 0X7411, 0X638F, 0X5B4E, 0X532D, 0X5B6E, 0X7C52,
-  0X84B3, 0X8493, 0X8493, 0X84B3, 0X8CD4, 0X7C73, 0X5B4E, 0X532D,
-  0X6BF0, 0X8493, 0X8CD4, 0X8493, 0X8CF4, 0X9535, 0X8CB3, 0X8CB3,
-  0X8CD4, 0X9515, 0X84B3, 0X8CD4, 0X8CD4, 0X8CF4, 0X84B3, 0X8CD4,
-  0X8CD4, 0X8493, 0X7431, 0X7C52, 0X7452, 0X7C72, 0X6C11, 0X638F,
-  0X7C72, 0X7431, 0X7432, 0X84B3, 0X7C52, 0X8CD4, 0X7C72, 0X7C52,
-  0X7C52, 0X6C11, 0X7C52, 0X7C52, 0X7C52, 0X7431, 0X6BD0, 0X7C52,
-  0X7C72, 0X7C52, 0X7431, 0X7411, 0X6BF0, 0X6BF0, 0X7411, 0X7431,
-  0X7C72, 0X7431, 0X6BF0, 0X7411, 0X7431, 0X7431, 0X6BF0, 0X6C11,
-  0X5B4E, 0X63AF, 0X63AF, 0X6BF0, 0X7431, 0X7431, 0X7411, 0X63AF,
-  0X532D, 0X532D, 0X530C, 0X5B6E, 0X638F, 0X5B4E, 0X636E, 0X5B2D,
-  0X530C, 0X5B4E, 0X52EC, 0X5B4E, 0X63AF, 0X638F, 0X5B6E, 0X5B6E,
-  0X638F, 0X63AF, 0X636E, 0X530C, 0X5B6E, 0X6BD0, 0X8493, 0X6BD0,
-  0X5B4E, 0X4ACB, 0X63AF, 0X7C52, 0X8493, 0X6C11, 0X6BF0, 0X7C72,
-  0X6BD0, 0X5B4E, 0X63AF, 0X6BD0, 0X6BF1, 0X7431, 0X6BD0, 0X7C52,
-  0X6BD0, 0X532D, 0X530D, 0X5B4E, 0X63AF, 0X5B2D, 0X7431, 0X638F,
-  0X6BD0, 0X5B6E, 0X638F, 0X7432, 0X636E, 0X6BF0, 0X63B0, 0X5B4E,
-  0X8493, 0X8CD4, 0X8CD4, 0X52EC, 0X5B2D, 0X5B6E, 0X638F, 0X638F,
-  0X63B0, 0X636E, 0X530D, 0X638F, 0X6BF0, 0X63AF, 0X63AF, 0X6BD0,
-  0X6BD0, 0X63AF, 0X6BF0, 0X7C73, 0X84B3, 0X84B3, 0X7452, 0X7C52,
-  0X7C72, 0X7C52, 0X6BD0, 0X7431, 0X7C73, 0X7C52, 0X7C52, 0X7431,
-  0X7411, 0X6BF0, 0X63AF, 0X7411, 0X7452, 0X8493, 0X8493, 0X8493,
-  0X94F4, 0X9D35, 0XA596, 0X9D35, 0XADB7, 0XB5D7, 0XADB7, 0XA576,
-  0X9D56, 0X8CD4, 0X84B3, 0X7C72, 0X7C72, 0X8493, 0X84B3, 0X8CF4,
-  0XA576, 0X9515, 0X94F4, 0X8CF4, 0X8493, 0X6BF1, 0X6BD0, 0X7431,
-  0X84B3, 0X8CF4, 0X8CB3, 0X8CB3, 0X8CB3, 0X7C52, 0X7452, 0X7C52,
-  0X7432, 0X6BF0, 0X5B6E, 0X638F, 0X6BF1, 0X7C72, 0X7432, 0X7432,
-  0X6BF0, 0X7432, 0X7432, 0X638F, 0X63B0, 0X8493, 0X84B3, 0X9515,
-  0XA596, 0X8CD4, 0X7C73, 0X7432, 0X7411, 0X6C11, 0X7452, 0X7411,
-  0X7452, 0X7C52, 0X6BF0, 0X6BD0, 0X7411, 0X6BD0, 0X84B3, 0X7411,
-  0X6C11, 0X8CD4, 0XA596, 0X9D35, 0X9515, 0X9D56, 0X9515, 0X84B3,
-  0X7452, 0X63B0, 0X5B4E, 0X5B4E, 0X636E, 0X532D, 0X7411, 0X94F4,
-  0XADB7, 0XCEBB, 0XC659, 0X9535, 0X8493, 0X7411, 0X63B0, 0X63B0,
-  0X6BD0, 0X638F, 0X8493, 0X9515, 0X9D35, 0X9D56, 0X8CD4, 0X7411,
-  0X6BF1, 0X7411, 0X6BD0, 0X636E, 0X530D, 0X5B2D, 0X7C73, 0X84B3,
-  0X84B3, 0X8CD4, 0X8CD4, 0X7431, 0X7431, 0X63AF, 0X7431, 0X6BD0,
-  0X5B4E, 0X636E, 0X8CD4, 0X8CD4, 0X8493, 0X7C72, 0X7C72, 0X7411,
-  0X6BF0, 0X8493, 0X7C72, 0X84B3, 0X8493, 0X7C52, 0X6BD0, 0X6BD0,
-  0X7C52, 0X7411, 0X7431, 0X7411, 0X7431, 0X63AF, 0X532D, 0X6BF1,
-  0X8493, 0X84B3, 0X8CB3, 0X8CB3, 0X7C72, 0X63AF, 0X63AF, 0X5B6E,
-  0X638F, 0X63AF, 0X5B6E, 0X7432, 0X94F4, 0X8CF4, 0X7C72, 0X7431,
-  0X63AF, 0X63AF, 0X638F, 0X532D, 0X532D, 0X4ACB, 0X63AF, 0X7431,
-  0X6BF0, 0X638F, 0X7411, 0X7432, 0X8493, 0X84B3, 0X8493, 0X7C72,
-  0X8493, 0X94F4, 0X9515, 0X8493, 0X7452, 0X6BD0, 0X63AF, 0X6BD0,
-  0X63AF, 0X7431, 0X84B3, 0X8493, 0X8493, 0X6BF0, 0X636E, 0X63AF,
-  0X5B6E, 0X638F, 0X7431, 0X7C72, 0X84B3, 0X8CD4, 0X8CB3, 0X8CD4,
-  0X9514, 0X8CD4, 0X8493, 0X8493, 0X7452, 0X7C52, 0X7432, 0X8493,
-  0X84B3, 0X7C72, 0X7431, 0X7411, 0X6BD0, 0X6BF0, 0X7431, 0X7C72,
-  0X7431, 0X63AF, 0X84B3, 0XA597, 0XB5F8, 0XADD7, 0X8CD4, 0X6BF0,
-  0X7C52, 0X638F, 0X5B6E, 0X638F, 0X6BF0, 0X6BD0, 0X6BF0, 0X7C52,
-  0X84B3, 0X8493, 0X9515, 0X9D35, 0X7431, 0X63AF, 0X5B6E, 0X532D,
-  0X5B6E, 0X7C52, 0X8493, 0X8493, 0X84B3, 0X8493, 0X94F4, 0X8493,
-  0X5B2D, 0X52EC, 0X6BF1, 0X8CD4, 0X8CF4, 0X8CD4, 0X9D56, 0X8493,
-  0X8CB3, 0X8CD4, 0X8CF4, 0X9D35, 0X8CD4, 0X8CD4, 0X8CF4, 0X94F4,
-  0X8CD4, 0X9514, 0X8CD4, 0X8493, 0X7C52, 0X7C52, 0X6BF1, 0X7C72,
-  0X7431, 0X7411, 0X8493, 0X6C11, 0X7411, 0X8CD4, 0X7C72, 0X8CF4,
-  0X8493, 0X7C72, 0X7C72, 0X8493, 0X8493, 0X7C72, 0X7C72, 0X7432,
-  0X7C52, 0X8493, 0X84B3, 0X7C72, 0X7432, 0X7411, 0X6BD0, 0X6BF1,
-  0X7411, 0X7432, 0X8493, 0X7411, 0X6BF1, 0X7452, 0X8493, 0X7C72,
-  0X6BF1, 0X63AF, 0X638F, 0X6BF0, 0X6BF1, 0X6BD0, 0X7452, 0X8493,
-  0X8493, 0X63B0, 0X4AAB, 0X5B4E, 0X5B2D, 0X638F, 0X63AF, 0X5B6E,
-  0X5B4E, 0X5B2D, 0X5B2D, 0X532D, 0X5B2D, 0X532D, 0X638F, 0X63AF,
-  0X63AF, 0X5B4E, 0X5B4E, 0X638F, 0X63AF, 0X5B2D, 0X5B6E, 0X63AF,
-  0X7411, 0X7431, 0X6BD0, 0X7432, 0X6BF0, 0X8CB3, 0X7C73, 0X7C52,
-  0X8493, 0X8493, 0X7431, 0X6BF1, 0X6BD0, 0X6BD0, 0X63AF, 0X7411,
-  0X6C11, 0X7C72, 0X7411, 0X638F, 0X5B4E, 0X636E, 0X638F, 0X530D,
-  0X5B4E, 0X5B6E, 0X6BD0, 0X6BD0, 0X638F, 0X6BF1, 0X7411, 0X63B0,
-  0X6BF1, 0X63AF, 0X8493, 0X7C73, 0X8CB3, 0X6BD0, 0X63AF, 0X63AF,
-  0X638F, 0X638F, 0X63AF, 0X63AF, 0X5B4E, 0X638F, 0X6BF0, 0X638F,
-  0X638F, 0X6BD0, 0X6BF0, 0X6BF0, 0X6BF0, 0X7C72, 0X84B3, 0X8493,
-  0X84B3, 0X8493, 0X84B3, 0X7C52, 0X638F, 0X7C52, 0X7C52, 0X7C72,
-  0X7C73, 0X7C52, 0X6BF1, 0X6BF1, 0X7431, 0X7432, 0X7C52, 0X8493,
-  0X7C72, 0X84B3, 0X8CD4, 0X9D55, 0XA576, 0XA576, 0XADB7, 0XADD7,
-  0XADB7, 0XA576, 0X9D35, 0X8CD4, 0X84B3, 0X7C72, 0X84B3, 0X8CD4,
-  0X8CF4, 0X9535, 0X9D35, 0X9D35, 0X8CD4, 0X8CD4, 0X8493, 0X7432,
-  0X6BF0, 0X7452, 0X84B3, 0XA576, 0X8CF4, 0X9514, 0X8CD4, 0X7C52,
-  0X7C72, 0X7C73, 0X8493, 0X7432, 0X5B6E, 0X63AF, 0X6C11, 0X7C52,
-  0X8493, 0X7C52, 0X7411, 0X7432, 0X7C72, 0X6BD0, 0X638F, 0X7C52,
-  0X8493, 0X94F4, 0XA597, 0X94F4, 0X7C73, 0X7C52, 0X7452, 0X7432,
-  0X7411, 0X6C11, 0X7431, 0X8CD4, 0X7432, 0X6BF1, 0X7432, 0X63AF,
-  0X8493, 0X8493, 0X84B3, 0X9535, 0X9D35, 0X9D35, 0X9D56, 0X9D56,
-  0X9D35, 0X8CB3, 0X7C52, 0X63AF, 0X5B4E, 0X52EC, 0X52EC, 0X424A,
-  0X52EC, 0X8493, 0XA596, 0XBE39, 0XBE19, 0X9D56, 0X8CD4, 0X7411,
-  0X6BD0, 0X6BF0, 0X6BF0, 0X4AAB, 0X8493, 0X9515, 0XA576, 0XA576,
-  0X9D35, 0X7C72, 0X7431, 0X7411, 0X63B0, 0X636E, 0X638F, 0X6BD0,
-  0X7C72, 0X7C72, 0X8CD4, 0X8CD4, 0X8493, 0X7C72, 0X7C52, 0X6BD0,
-  0X6BF1, 0X638F, 0X6BD0, 0X5B6E, 0X8CF4, 0X8493, 0X94F4, 0X84B3,
-  0X7431, 0X638F, 0X6BD0, 0X8493, 0X84B3, 0X9515, 0X9D35, 0X8493,
-  0X7C52, 0X638F, 0X6BF0, 0X63AF, 0X6C11, 0X7431, 0X7C72, 0X63B0,
-  0X530C, 0X7411, 0X8493, 0X8CD4, 0X8CF4, 0X84B3, 0X8CD4, 0X63AF,
-  0X63AF, 0X5B4E, 0X638F, 0X6BD0, 0X6BF1, 0X6BF1, 0X9515, 0X9D55,
-  0X8CB3, 0X8493, 0X6BF0, 0X6BD0, 0X6BD0, 0X532D, 0X5B2D, 0X52EC,
-  0X6BD0, 0X7411, 0X63AF, 0X6BF0, 0X6BF0, 0X7C52, 0X8493, 0X8493,
-  0X7C73, 0X8493, 0X9514, 0X9515, 0X8CD4, 0X84B3, 0X6BF0, 0X6BD0,
-  0X63B0, 0X6BF0, 0X638F, 0X7452, 0X8493, 0X8493, 0X8493, 0X7431,
-  0X63AF, 0X5B4E, 0X63AF, 0X63B0, 0X7411, 0X7C72, 0X8CD4, 0X84B3,
-  0X84B3, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X84B3, 0X7432, 0X7411,
-  0X8493, 0X8493, 0X8CF4, 0X8CB3, 0X7431, 0X7431, 0X636E, 0X6BD0,
-  0X7C52, 0X7C72, 0X7C72, 0X7C52, 0X8CD4, 0XA596, 0XB618, 0XB5F8,
-  0X9515, 0X7C72, 0X7411, 0X638F, 0X638F, 0X63B0, 0X63AF, 0X6BD0,
-  0X6BF1, 0X7431, 0X8CD4, 0X84B3, 0X9D35, 0X9D56, 0X7C72, 0X6BF0,
-  0X638F, 0X638F, 0X63AF, 0X7C52, 0X8493, 0X8493, 0X8493, 0X8CB3,
-  0X94F4, 0X8CD4, 0X5B4E, 0X4ACC, 0X6BF0, 0X8493, 0X9D35, 0X9D56,
-  0X9D56, 0X8493, 0X8CD4, 0X8CD4, 0X8CF4, 0X9D35, 0X8CF4, 0X8CD4,
-  0X8CD4, 0X84B3, 0X8493, 0X8CD4, 0X84B3, 0X8493, 0X7C72, 0X7C52,
-  0X7C72, 0X8493, 0X7C73, 0X7C52, 0X8493, 0X6BF0, 0X7C52, 0X8CF4,
-  0X8CD4, 0X9515, 0X8493, 0X8493, 0X7452, 0X84B3, 0X8CD4, 0X84B3,
-  0X7C73, 0X7431, 0X8CD4, 0X8CF4, 0X9D35, 0X8CD4, 0X7C72, 0X6BF0,
-  0X7411, 0X7452, 0X7432, 0X7452, 0X7C72, 0X7432, 0X7411, 0X6BF1,
-  0X8493, 0X7C72, 0X7411, 0X6BD0, 0X6BD0, 0X7432, 0X6BD0, 0X6BD0,
-  0X84B3, 0X84B3, 0X7C72, 0X7431, 0X63AF, 0X5B6E, 0X638F, 0X530C,
-  0X636E, 0X63AF, 0X638F, 0X5B2D, 0X5B4E, 0X5B2D, 0X530D, 0X5B6E,
-  0X6BD0, 0X6BF0, 0X6BD0, 0X638F, 0X638F, 0X63AF, 0X6BD0, 0X63B0,
-  0X63AF, 0X6BD0, 0X7411, 0X6BF1, 0X6BF0, 0X7C52, 0X7432, 0X8493,
-  0X8CB3, 0X7C52, 0X7432, 0X7C73, 0X7C72, 0X6BF0, 0X530D, 0X5B4E,
-  0X7411, 0X8493, 0X7C72, 0X8CD4, 0X7431, 0X6BF0, 0X7411, 0X6BD0,
-  0X5B4E, 0X5B4E, 0X6BD0, 0X636E, 0X63AF, 0X638F, 0X532D, 0X6BF0,
-  0X6BF0, 0X638F, 0X5B6E, 0X7431, 0X7C73, 0X8493, 0X84B3, 0X8493,
-  0X6BD0, 0X638F, 0X5B6E, 0X638F, 0X638F, 0X5B2D, 0X5B6E, 0X638F,
-  0X7411, 0X6BF0, 0X63B0, 0X7411, 0X7432, 0X7452, 0X6BF0, 0X8493,
-  0X84B3, 0X7C73, 0X8493, 0X8CB3, 0X8CD4, 0X8493, 0X7431, 0X7C72,
-  0X84B3, 0X8493, 0X84B3, 0X8493, 0X7431, 0X7411, 0X7C52, 0X7C72,
-  0X7C73, 0X84B3, 0X84B3, 0X8CF4, 0X9D35, 0X9D35, 0X9515, 0X9D35,
-  0XADB7, 0XB618, 0XADB7, 0X9D35, 0X9515, 0X8CB3, 0X7C72, 0X7C72,
-  0X8CF4, 0X9515, 0X9515, 0X9D56, 0XA576, 0X9535, 0X8CF4, 0X84B3,
-  0X84B3, 0X7431, 0X7431, 0X7C52, 0X8CF4, 0XA596, 0X9515, 0X9515,
-  0X9515, 0X84B3, 0X7C72, 0X7C72, 0X7C72, 0X7431, 0X5B4E, 0X7411,
-  0X7411, 0X84B3, 0X8CD4, 0X7432, 0X8493, 0X7C73, 0X6C11, 0X638F,
-  0X7431, 0X7411, 0X7411, 0X9D56, 0XB5F8, 0X8CD4, 0X7411, 0X7431,
-  0X7411, 0X7411, 0X7411, 0X7C52, 0X7C72, 0X8493, 0X6BF0, 0X7411,
-  0X6BF0, 0X6BF0, 0X7C52, 0X8CD4, 0X94F4, 0X9D55, 0XA576, 0XADB7,
-  0XA596, 0XA576, 0X9515, 0X84B3, 0X7C52, 0X63AF, 0X5B2D, 0X4AAB,
-  0X532D, 0X428A, 0X4249, 0X7432, 0XBE18, 0XB5F8, 0XADD7, 0X9D56,
-  0X7C52, 0X7411, 0X7411, 0X6BF1, 0X6BF0, 0X6BF1, 0X84B3, 0X9D35,
-  0XA596, 0X9D56, 0X9D56, 0X84B3, 0X7C52, 0X6C11, 0X63AF, 0X5B4E,
-  0X63AF, 0X6BF1, 0X7C73, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X7C52,
-  0X7C72, 0X7C52, 0X7432, 0X7411, 0X6BF0, 0X6C11, 0X84B3, 0X7C73,
-  0X8CD4, 0X7C72, 0X63AF, 0X6BF0, 0X638F, 0X8493, 0X7C73, 0XA596,
-  0XA576, 0X8CF4, 0X7452, 0X63AF, 0X6BD0, 0X5B4E, 0X7411, 0X8CB3,
-  0X8CD4, 0X7C72, 0X63B0, 0X7452, 0X84B3, 0X8CD4, 0X9D56, 0X94F4,
-  0X8CD4, 0X7C52, 0X6BD0, 0X63AF, 0X63B0, 0X6BF0, 0X6BF0, 0X7C72,
-  0X8CD4, 0XA596, 0X9535, 0X8493, 0X5B2D, 0X6BF0, 0X6BF0, 0X5B6E,
-  0X5B2D, 0X5B4E, 0X6C11, 0X7432, 0X6BF0, 0X7C52, 0X6BF0, 0X7411,
-  0X7C72, 0X7C72, 0X7431, 0X84B3, 0X9515, 0X9D35, 0X94F4, 0X7C72,
-  0X7411, 0X7432, 0X6BD0, 0X6BF0, 0X6BF0, 0X8493, 0X84B3, 0X7C72,
-  0X7C72, 0X7411, 0X63AF, 0X636E, 0X638F, 0X638F, 0X6BF1, 0X7C72,
-  0X8CD4, 0X9515, 0X8CF4, 0X8CF4, 0X8CD4, 0X8CD4, 0X9514, 0X84B3,
-  0X7452, 0X7432, 0X8CD4, 0X8CB3, 0X8CB3, 0X7C73, 0X7432, 0X7C72,
-  0X6BD0, 0X6BD0, 0X7C73, 0X84B3, 0X8CB3, 0X7C72, 0X9515, 0XA596,
-  0XB5D7, 0XB5F8, 0X9515, 0X8493, 0X7C72, 0X638F, 0X63AF, 0X6BD0,
-  0X6BF0, 0X6BD0, 0X6BD0, 0X7C52, 0X84B3, 0X8CD4, 0X9D55, 0XADD7,
-  0X94F4, 0X5B4E, 0X6BD0, 0X638F, 0X6BF0, 0X7C72, 0X8493, 0X84B3,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8CD4, 0X5B2D, 0X52EC, 0X7452, 0X8493,
-  0X9D55, 0X9D56, 0XA576, 0X8CF4, 0X8CD4, 0X8CB3, 0X8CD4, 0X9515,
-  0X8CD4, 0X7C72, 0X8CB3, 0X8493, 0X8493, 0X8CD4, 0X8CB3, 0X8493,
-  0X7C72, 0X7C52, 0X8493, 0X8493, 0X7C73, 0X8493, 0X84B3, 0X638F,
-  0X7452, 0X8CF4, 0X9D35, 0X9515, 0X8CD4, 0X8CB3, 0X84B3, 0X84B3,
-  0X8CB3, 0X8CB3, 0X8493, 0X7431, 0X9515, 0X9515, 0X9515, 0X8CD4,
-  0X8493, 0X6C11, 0X6BF0, 0X7431, 0X7432, 0X7C52, 0X7432, 0X7452,
-  0X7C52, 0X7C72, 0X7C73, 0X7C72, 0X7411, 0X63AF, 0X7411, 0X7C52,
-  0X7411, 0X6BF1, 0X8493, 0X84B3, 0X8CD4, 0X6BF1, 0X7C52, 0X63AF,
-  0X5B6E, 0X5B2D, 0X5B4E, 0X63AF, 0X638F, 0X5B4E, 0X52EC, 0X530D,
-  0X5B6E, 0X638F, 0X6BD0, 0X7431, 0X7411, 0X6BD0, 0X6BD0, 0X6C11,
-  0X7432, 0X6C11, 0X6BD0, 0X63AF, 0X7C72, 0X6BF1, 0X6BF0, 0X8493,
-  0X7C73, 0X84B3, 0X9515, 0X84B3, 0X7C72, 0X7432, 0X7C52, 0X63AF,
-  0X636E, 0X530C, 0X6BD0, 0X7C72, 0X7432, 0X8493, 0X63AF, 0X7431,
-  0X7432, 0X638F, 0X5B2D, 0X5B4E, 0X638F, 0X638F, 0X638F, 0X5B4E,
-  0X5B2D, 0X63AF, 0X6BD0, 0X6BD0, 0X63AF, 0X63B0, 0X8493, 0X84B3,
-  0X8CF4, 0X8CD4, 0X7431, 0X6BD0, 0X63B0, 0X63AF, 0X5B4E, 0X5B2D,
-  0X63AF, 0X63AF, 0X7432, 0X638F, 0X7411, 0X7411, 0X7411, 0X7452,
-  0X7C52, 0X8493, 0X8CB3, 0X7C72, 0X7C52, 0X8CD4, 0X8CD4, 0X8CF4,
-  0X8CB3, 0X8CD4, 0X8CD4, 0X8493, 0X8CD4, 0X8CF4, 0X84B3, 0X7C52,
-  0X6BF1, 0X7C73, 0X8493, 0X84B3, 0X8CD4, 0X9515, 0X9D35, 0X8CF4,
-  0X8CD4, 0XA576, 0XADD7, 0XBE18, 0XA576, 0X8CF4, 0X9515, 0X84B3,
-  0X7452, 0X7432, 0X8CD4, 0X8CD4, 0X9514, 0X9515, 0XADB7, 0X9535,
-  0X8CF4, 0X84B3, 0X7C72, 0X7432, 0X7452, 0X7432, 0X8493, 0XADB7,
-  0XADB7, 0X9D56, 0X9D35, 0X8CB3, 0X8493, 0X8493, 0X7C52, 0X6BF1,
-  0X6BF0, 0X7411, 0X7C52, 0X8CD4, 0X8CB3, 0X7C72, 0X7C52, 0X7C52,
-  0X6BF0, 0X6BF0, 0X6BD0, 0X7C52, 0X9515, 0XADB7, 0XADD7, 0X8CD4,
-  0X7C52, 0X7432, 0X6BF0, 0X6BF0, 0X7411, 0X7C52, 0X8493, 0X8CD4,
-  0X7C52, 0X7411, 0X6BF0, 0X6BD0, 0X8493, 0X8CD4, 0X9514, 0X9535,
-  0X9D35, 0XB5D7, 0XB5F8, 0XADB7, 0X94F4, 0X84B3, 0X7431, 0X638F,
-  0X63B0, 0X5B4E, 0X5B6E, 0X530D, 0X4A8B, 0X7C72, 0XADB7, 0XB5F8,
-  0XA596, 0X9D35, 0X8CD4, 0X7452, 0X6C11, 0X6BF0, 0X63B0, 0X6BF0,
-  0X8CD4, 0XA576, 0XA596, 0X9D35, 0X8CF4, 0X8CD4, 0X7C72, 0X6C11,
-  0X6BF0, 0X63AF, 0X6BD0, 0X7C52, 0X8CD4, 0X8CD4, 0X8CD4, 0X8493,
-  0X9515, 0X7C72, 0X7411, 0X7C52, 0X63AF, 0X7C52, 0X7431, 0X7411,
-  0X8CD4, 0X8493, 0X8493, 0X7411, 0X7431, 0X63AF, 0X63AF, 0X7C52,
-  0X7C72, 0X9D35, 0X9515, 0X9515, 0X6BF0, 0X638F, 0X63AF, 0X5B2D,
-  0X7411, 0X8493, 0X8CD4, 0X8CF4, 0X7C73, 0X7C52, 0X8493, 0X9515,
-  0XA596, 0X9D35, 0X9D35, 0X8493, 0X5B6E, 0X6BF0, 0X6BD0, 0X7431,
-  0X7C52, 0X6BD0, 0X84B3, 0XADB7, 0X9D35, 0X84B3, 0X63B0, 0X6BD0,
-  0X6BD0, 0X638F, 0X5B4E, 0X638F, 0X7411, 0X7C52, 0X7411, 0X7432,
-  0X7431, 0X7432, 0X8493, 0X7C73, 0X426A, 0X8CD4, 0X94F4, 0XA576,
-  0X9514, 0X8493, 0X7C73, 0X7C52, 0X6BF0, 0X63AF, 0X7432, 0X84B3,
-  0X8CB3, 0X7C72, 0X7C52, 0X7431, 0X63B0, 0X63AF, 0X5B6E, 0X5B6E,
-  0X6BF0, 0X8493, 0X9514, 0XA576, 0X9D56, 0X9515, 0X8CF4, 0X8CD4,
-  0X84B3, 0X7C72, 0X7432, 0X7C52, 0X84B3, 0X8CD4, 0X8CD4, 0X84B3,
-  0X7C72, 0X84B3, 0X8493, 0X7C73, 0X7C72, 0X8CB3, 0X84B3, 0X7C52,
-  0X9515, 0XA576, 0X9D35, 0XADD7, 0XAD97, 0X8CD4, 0X7C72, 0X5B6E,
-  0X63AF, 0X6BF1, 0X7411, 0X63AF, 0X6BD0, 0X8493, 0X84B3, 0X84B3,
-  0XADB7, 0XADD7, 0X8CF4, 0X6BD0, 0X7411, 0X63AF, 0X7431, 0X8493,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X84B3, 0X63AF, 0X5B4E,
-  0X7C72, 0X84B3, 0X9515, 0X9D35, 0X9D56, 0X8CF4, 0X8493, 0X8CD4,
-  0X94F4, 0X9515, 0X8CD4, 0X8493, 0X7C73, 0X7C72, 0X7C72, 0X7C73,
-  0X8493, 0X7C73, 0X7C72, 0X7432, 0X7432, 0X84B3, 0X84B3, 0X7432,
-  0X7C72, 0X7C52, 0X8CD4, 0X9515, 0X9D35, 0X9514, 0X8CD4, 0X8CF4,
-  0X7C72, 0X8CD4, 0X8CD4, 0X8CD4, 0X84B3, 0X7452, 0X8CD4, 0X9D35,
-  0X9515, 0X94F4, 0X8493, 0X7411, 0X7452, 0X7411, 0X6BF0, 0X7C52,
-  0X7C52, 0X6BF0, 0X7452, 0X7C72, 0X7C72, 0X7C52, 0X7C72, 0X638F,
-  0X6BF0, 0X8493, 0X7411, 0X6C11, 0X84B3, 0X9D35, 0X84B3, 0X6BD0,
-  0X7432, 0X7431, 0X63B0, 0X5B4E, 0X5B6E, 0X638F, 0X638F, 0X636E,
-  0X530D, 0X31E8, 0X6BF0, 0X5B4E, 0X6BD0, 0X7411, 0X7C52, 0X6C11,
-  0X6BD0, 0X7411, 0X8493, 0X7452, 0X7411, 0X6BF1, 0X7431, 0X6C11,
-  0X63AF, 0X6BD0, 0X8493, 0X8CD4, 0X8CF4, 0X84B3, 0X8493, 0X8493,
-  0X7C52, 0X6BD0, 0X636E, 0X5B6E, 0X6BD0, 0X7432, 0X7411, 0X7C52,
-  0X7C72, 0X7C73, 0X7C72, 0X636E, 0X426A, 0X4ACB, 0X638F, 0X638F,
-  0X638F, 0X636E, 0X638F, 0X6BD0, 0X6C11, 0X6BF1, 0X7411, 0X636E,
-  0X8493, 0X8CB3, 0X8CD4, 0X7C72, 0X7411, 0X7411, 0X6BD0, 0X63AF,
-  0X5B2D, 0X5B4E, 0X638F, 0X638F, 0X6BD0, 0X638F, 0X7C52, 0X7C72,
-  0X7C72, 0X7411, 0X7C72, 0X8CB3, 0X8CD4, 0X7411, 0X8493, 0X9515,
-  0X94F4, 0X8CF4, 0X8CD4, 0X8CF4, 0X9D35, 0X9515, 0X9515, 0X9515,
-  0X84B3, 0X7C73, 0X7432, 0X7C52, 0X8CD4, 0X8CD4, 0X8CD4, 0X9D35,
-  0X9515, 0X84B3, 0X8CD4, 0X9D56, 0XB5F8, 0XBE18, 0XADB7, 0X8CF4,
-  0X9515, 0X7C52, 0X7452, 0X7452, 0X8493, 0X8CD4, 0X9515, 0X9D35,
-  0X9D56, 0X9D56, 0X9514, 0X8493, 0X8493, 0X7431, 0X7431, 0X8493,
-  0X8CF4, 0XA576, 0XB618, 0XA576, 0X9D35, 0X8CB3, 0X7C73, 0X7C73,
-  0X7C52, 0X7431, 0X7411, 0X7452, 0X8493, 0X84B3, 0X8493, 0X7C72,
-  0X7452, 0X7C52, 0X7432, 0X7431, 0X7C72, 0X7C72, 0X9D35, 0XAD97,
-  0XB5F8, 0X9515, 0X6BF1, 0X6BF0, 0X63B0, 0X6BD0, 0X6BF1, 0X7C72,
-  0X7C52, 0X7C52, 0X530D, 0X7411, 0X7431, 0X6BF0, 0X6BF1, 0X8CD4,
-  0X9515, 0X9D35, 0XA596, 0XBE39, 0XB5F8, 0X9515, 0X8CD4, 0X84B3,
-  0X7431, 0X5B4E, 0X638F, 0X63AF, 0X7411, 0X636E, 0X5B6E, 0X9514,
-  0XADB7, 0XB5F8, 0XADB7, 0X9D55, 0X8CD4, 0X8493, 0X6BD0, 0X6BF0,
-  0X6BF0, 0X7411, 0X9D35, 0XBE18, 0XA596, 0X94F4, 0X9515, 0X8CD4,
-  0X8493, 0X7431, 0X6BD0, 0X7411, 0X6BF0, 0X7C52, 0X84B3, 0X94F4,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8493, 0X6BF0, 0X7C52, 0X6BD0, 0X6BF0,
-  0X7C52, 0X7C73, 0X84B3, 0X8493, 0X7C72, 0X7411, 0X63AF, 0X7C52,
-  0X7452, 0X7C73, 0X7C52, 0X9D56, 0X94F4, 0X7C73, 0X6BF0, 0X63B0,
-  0X63AF, 0X63AF, 0X6BF0, 0X6BF0, 0X8CD4, 0X8493, 0X8493, 0X6BF0,
-  0X7C52, 0X9515, 0X9515, 0XA576, 0XADB7, 0X8CD4, 0X5B2D, 0X7432,
-  0X7C52, 0X7C52, 0X7C73, 0X7C52, 0X9515, 0XB5D8, 0X9D56, 0X8CD4,
-  0X6BD0, 0X7411, 0X6BF1, 0X63AF, 0X638F, 0X63AF, 0X7432, 0X7C72,
-  0X8CB3, 0X7C73, 0X7411, 0X8493, 0X8CB3, 0X8493, 0X6BD0, 0X84B3,
-  0X9515, 0X9D55, 0X8CF4, 0X7C73, 0X7C73, 0X7431, 0X6BF0, 0X5B6E,
-  0X7C52, 0X8CD4, 0X9514, 0X7C73, 0X7C52, 0X7C52, 0X6BF0, 0X6BD0,
-  0X63AF, 0X638F, 0X7431, 0X84B3, 0X9535, 0XA576, 0XADB7, 0X9D55,
-  0X8CD4, 0X84B3, 0X8493, 0X7C72, 0X7452, 0X7C73, 0X8CD4, 0X8CF4,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X8CD4, 0X84B3, 0X8493, 0X8CD4,
-  0X8CD4, 0X7C72, 0X8CF4, 0X9D35, 0X9D56, 0XAD97, 0XB5F8, 0X8CD4,
-  0X7C72, 0X6C11, 0X6BD0, 0X7C52, 0X7411, 0X530D, 0X6BF0, 0X7C72,
-  0X8CB3, 0X8CD4, 0XADB7, 0XADB7, 0X8CD4, 0X7C52, 0X6BD0, 0X63AF,
-  0X6BF0, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CD4, 0X9515, 0X8CD4,
-  0X6BF0, 0X7411, 0X8493, 0X8CD4, 0X9515, 0X9515, 0XA576, 0X9514,
-  0X84B3, 0X94F4, 0X8CF4, 0X9D35, 0X8CD4, 0X8493, 0X7C72, 0X7432,
-  0X7C72, 0X7C52, 0X7C72, 0X84B3, 0X8493, 0X7C72, 0X7C72, 0X84B3,
-  0X8493, 0X7C73, 0X7C52, 0X84B3, 0X8CD4, 0X9D55, 0X9515, 0X8CD4,
-  0X8CD4, 0X8CF4, 0X8493, 0X9515, 0X9515, 0X9515, 0X8CD4, 0X8CD4,
-  0X94F4, 0X9D35, 0X9515, 0X8CD4, 0X8493, 0X7C52, 0X7C52, 0X7411,
-  0X7411, 0X7411, 0X7431, 0X7431, 0X6BF1, 0X6BF1, 0X6C11, 0X7431,
-  0X84B3, 0X6BF0, 0X6C11, 0X84B3, 0X6BF0, 0X6BD0, 0X84B3, 0X9D35,
-  0X8CD4, 0X7C72, 0X7C52, 0X7431, 0X6C11, 0X63B0, 0X5B6E, 0X638F,
-  0X63AF, 0X638F, 0X4AAB, 0X52EC, 0X638F, 0X63AF, 0X7432, 0X7C73,
-  0X8493, 0X7C52, 0X6BF0, 0X7432, 0X84B3, 0X7452, 0X7C52, 0X7411,
-  0X7431, 0X7452, 0X6BD0, 0X7431, 0X7432, 0X8493, 0X8CB3, 0X84B3,
-  0X84B3, 0X8493, 0X7C52, 0X6BF0, 0X530D, 0X5B2D, 0X6BF0, 0X6BF0,
-  0X6BD0, 0X7C52, 0X8493, 0X8CD4, 0X7411, 0X6BD0, 0X426A, 0X4ACC,
-  0X530D, 0X63AF, 0X638F, 0X638F, 0X638F, 0X6BF1, 0X7452, 0X8493,
-  0X7C72, 0X7432, 0X8CF4, 0X8CD4, 0X8CD4, 0X8493, 0X7411, 0X7C52,
-  0X6BF0, 0X6BD0, 0X5B4E, 0X638F, 0X63AF, 0X638F, 0X6BF0, 0X7431,
-  0X7432, 0X84B3, 0X7C72, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X6BF0,
-  0X8CB3, 0XA596, 0X9D56, 0X9D35, 0X9515, 0X9515, 0X9D56, 0X9D56,
-  0XA576, 0X9514, 0X8CD4, 0X8493, 0X8493, 0X7C72, 0X94F4, 0X9515,
-  0X9515, 0X9D56, 0X8CD4, 0X8493, 0X7431, 0X9515, 0XA576, 0XBE19,
-  0XB5F8, 0X9514, 0XADB7, 0X8493, 0X7452, 0X7432, 0X7C72, 0X8CD4,
-  0X9535, 0X9D35, 0X9D55, 0XA576, 0X9515, 0X8493, 0X7C72, 0X7C73,
-  0X7411, 0X7C72, 0X8CF4, 0XA597, 0XB5F8, 0XADB7, 0X9D56, 0X8CD4,
-  0X7C72, 0X8CD4, 0X7C73, 0X7432, 0X7C72, 0X7C72, 0X8CD4, 0X8CD4,
-  0X7C72, 0X7C52, 0X7C52, 0X7C52, 0X7432, 0X7432, 0X7C52, 0X8493,
-  0X9535, 0XB5F8, 0XB5F8, 0X9D35, 0X7C72, 0X7411, 0X63AF, 0X6BD0,
-  0X6BD0, 0X7431, 0X6BF0, 0X6BD0, 0X4ACB, 0X7411, 0X7C52, 0X7431,
-  0X7431, 0X8CD4, 0X8CD4, 0X9D55, 0XB5D7, 0XBE39, 0XB5F8, 0X9D35,
-  0X8493, 0X8CD4, 0X7452, 0X638F, 0X6BD0, 0X7411, 0X7431, 0X63AF,
-  0X7431, 0X9D35, 0XB5F8, 0XBE18, 0XA597, 0X9D55, 0X9515, 0X6C11,
-  0X63B0, 0X7411, 0X63AF, 0X7C52, 0XA596, 0XBE39, 0XADB7, 0X9D35,
-  0X9515, 0X8CB3, 0X8493, 0X7431, 0X7411, 0X6BF0, 0X7432, 0X7C72,
-  0X8CF4, 0X9D35, 0X9514, 0X8CD4, 0X8493, 0X84B3, 0X8493, 0X84B3,
-  0X7C52, 0X7431, 0X8CB3, 0X8CD4, 0X84B3, 0X7C72, 0X9D35, 0X6BD0,
-  0X3A09, 0X6BD0, 0X9D35, 0X8493, 0X8493, 0X9D55, 0X8CD4, 0X8493,
-  0X6BF0, 0X5B2D, 0X6BD0, 0X7432, 0X63AF, 0X7411, 0X84B3, 0X8493,
-  0X8493, 0X6C11, 0X7431, 0X9515, 0XA596, 0XA576, 0XA576, 0X8CD4,
-  0X4AAB, 0X6BF0, 0X8493, 0X8493, 0X8493, 0X7C52, 0X9D55, 0XB5F8,
-  0XAD97, 0X8CD4, 0X5B2D, 0X7411, 0X6BF0, 0X6BD0, 0X6BD0, 0X7432,
-  0X8493, 0X84B3, 0X84B3, 0X8493, 0X7C72, 0X84B3, 0X94F4, 0X8493,
-  0X8CB3, 0X9515, 0X9514, 0X9D35, 0X8CD4, 0X84B3, 0X8493, 0X7432,
-  0X63AF, 0X6BD0, 0X8493, 0X9515, 0X9514, 0X84B3, 0X7411, 0X7C52,
-  0X6BF0, 0X6BD0, 0X63AF, 0X6BD0, 0X7432, 0X9514, 0XADB7, 0XADB7,
-  0XADB7, 0X9D56, 0X9515, 0X8CD4, 0X8493, 0X7C72, 0X6BF1, 0X7C73,
-  0X9D35, 0X9D35, 0X8CD4, 0X8CF4, 0X94F4, 0X9D35, 0X9515, 0X8CB3,
-  0X84B3, 0X8CD4, 0X7432, 0X7431, 0X9515, 0X9D35, 0XA576, 0XA596,
-  0XA576, 0X9D35, 0X8CD4, 0X7431, 0X6BD0, 0X7411, 0X6BD0, 0X63B0,
-  0X7452, 0X84B3, 0X8CD4, 0X8CD4, 0XB5D8, 0XADB7, 0X9515, 0X7C72,
-  0X6BD0, 0X5B2D, 0X7452, 0X8CD4, 0X8CD4, 0X84B3, 0X8CD4, 0X8CD4,
-  0X9D35, 0X8CF4, 0X6BF0, 0X6BF0, 0X8493, 0X8CF4, 0X9535, 0X9515,
-  0XADB7, 0X9D35, 0X8CD4, 0X8CF4, 0X9514, 0X9D35, 0X84B3, 0X7C73,
-  0X7431, 0X6BF1, 0X7432, 0X7431, 0X7C52, 0X8CD4, 0X8493, 0X6BF0,
-  0X7411, 0X8CD4, 0X8493, 0X7C52, 0X8493, 0X8CD4, 0X9515, 0XA596,
-  0XA576, 0X84B3, 0X84B3, 0X8CD4, 0X8CF4, 0X9D56, 0X9D35, 0X9515,
-  0X94F4, 0X8CD4, 0X8CF4, 0X9D35, 0X8CF4, 0X9514, 0X7432, 0X7411,
-  0X7C52, 0X7431, 0X7431, 0X7432, 0X7432, 0X7431, 0X638F, 0X63AF,
-  0X6BD0, 0X6BD0, 0X7C72, 0X7411, 0X7411, 0X84B3, 0X7C52, 0X7C72,
-  0X7C52, 0XA576, 0XADB7, 0X7C72, 0X7452, 0X7C72, 0X7431, 0X6C11,
-  0X52EC, 0X6BF0, 0X6BF0, 0X638F, 0X4AAB, 0X2166, 0X6BF0, 0X7411,
-  0X7C52, 0X8493, 0X8493, 0X7C52, 0X7431, 0X7C72, 0X7C72, 0X7C52,
-  0X8CB3, 0X7C72, 0X7411, 0X6BD0, 0X6BF0, 0X7432, 0X8493, 0X8CB3,
-  0X8CD4, 0X8493, 0X7411, 0X7C52, 0X7432, 0X6BD0, 0X5B6E, 0X5B2D,
-  0X638F, 0X63B0, 0X6BD0, 0X8493, 0X84B3, 0X8493, 0X6BD0, 0X8493,
-  0X52EC, 0X4ACC, 0X532D, 0X63AF, 0X6BD0, 0X638F, 0X638F, 0X63AF,
-  0X7C73, 0X8CD4, 0X8CB3, 0X8CD4, 0X94F4, 0X9D35, 0X9515, 0X84B3,
-  0X7C72, 0X8493, 0X7452, 0X6BF0, 0X6BD0, 0X6BD0, 0X63B0, 0X7432,
-  0X7452, 0X7411, 0X7432, 0X8CD4, 0X8493, 0X8493, 0X8CD4, 0X8CF4,
-  0XA576, 0X8CF4, 0XA576, 0XB5F8, 0XA576, 0X9D55, 0X9D56, 0X9D35,
-  0XA596, 0XB5D8, 0XAD97, 0X9515, 0X8CD4, 0X8CD4, 0X84B3, 0X84B3,
-  0X9515, 0X9515, 0X9515, 0X8CD4, 0X8493, 0X7C52, 0X7432, 0X9514,
-  0XA576, 0XBE39, 0XBE39, 0X9D56, 0X9515, 0X6BD0, 0X7411, 0X7431,
-  0X7C52, 0X8CF4, 0X9D56, 0XA576, 0X9D56, 0XA576, 0X9535, 0X8493,
-  0X7C72, 0X84B3, 0X7C52, 0X7C73, 0X9D35, 0XA597, 0XCE7A, 0XAD97,
-  0X9D35, 0X8CD4, 0X8493, 0X8493, 0X7C72, 0X7C52, 0X7C73, 0X84B3,
-  0X8CD4, 0X8CB3, 0X7C72, 0X7431, 0X6BF0, 0X7432, 0X7411, 0X6C11,
-  0X7432, 0X8CD4, 0XA576, 0XADB7, 0XA597, 0X9515, 0X8CD4, 0X7C73,
-  0X7411, 0X63AF, 0X5B6E, 0X6BD0, 0X6BF0, 0X6BD0, 0X5B6E, 0X6BF0,
-  0X7C52, 0X7411, 0X8493, 0X7C72, 0X8CF4, 0XA596, 0XBE18, 0XC659,
-  0XC659, 0XADB7, 0X8CD4, 0X7C52, 0X7431, 0X63AF, 0X63B0, 0X6BD0,
-  0X7431, 0X7411, 0X84B3, 0XAD97, 0XBE19, 0XCEBA, 0XADD7, 0X8CF4,
-  0X9D35, 0X8493, 0X84B3, 0X7432, 0X7411, 0X84B3, 0XA596, 0XBE18,
-  0XB5D7, 0XA576, 0X9D35, 0X8CD4, 0X8493, 0X7C72, 0X7431, 0X7432,
-  0X7411, 0X7C72, 0X9515, 0XA576, 0X9D56, 0X9515, 0X84B3, 0X94F4,
-  0X9515, 0X8CD4, 0X8493, 0X84B3, 0X8CD4, 0X9515, 0X84B3, 0X63B0,
-  0X8CF4, 0X7431, 0X4AAB, 0X5B4E, 0X8CD4, 0X84B3, 0X9514, 0XA596,
-  0X9515, 0X8493, 0X6BD0, 0X638F, 0X6BD0, 0X7432, 0X638F, 0X6BF0,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X7452, 0X8493, 0X8CD4, 0X9D56, 0XADB7,
-  0XA576, 0X94F4, 0X7431, 0X8493, 0X7C73, 0X84B3, 0X7C72, 0X9535,
-  0XADB7, 0XBE39, 0XADD7, 0X8CD4, 0X5B4E, 0X6BF0, 0X6BF0, 0X6BD0,
-  0X7431, 0X7C52, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CD4, 0X8493, 0X8493,
-  0X9515, 0X94F4, 0X8CD4, 0X9515, 0X9D56, 0XA576, 0X8493, 0X84B3,
-  0X84B3, 0X7C52, 0X6BD0, 0X6BF1, 0X84B3, 0X9D55, 0X9515, 0X8CB3,
-  0X7431, 0X7C72, 0X6C11, 0X6BD0, 0X5B4E, 0X6C11, 0X7C72, 0X9514,
-  0XB5D8, 0XBE18, 0XB5D8, 0X9D56, 0X9535, 0X9514, 0X8493, 0X7452,
-  0X7C52, 0X84B3, 0X9D56, 0X9515, 0X9514, 0X9D35, 0X9535, 0X9535,
-  0X9515, 0X8CD4, 0X8CF4, 0X9535, 0X7411, 0X6BF0, 0X9515, 0XA596,
-  0XA576, 0XAD97, 0XAD97, 0X9515, 0X8CD4, 0X7C72, 0X7432, 0X7431,
-  0X7411, 0X6BF1, 0X8493, 0X8CD4, 0X8CD4, 0X7C52, 0XB5F8, 0XBE19,
-  0X9D35, 0X7411, 0X6BF1, 0X638F, 0X7411, 0X8CD4, 0X9514, 0X8CD4,
-  0X8CF4, 0X94F4, 0X9515, 0X9515, 0X7431, 0X6BF0, 0X84B3, 0X9515,
-  0X9515, 0X9D56, 0X9D56, 0X9515, 0X9515, 0X8CF4, 0X9515, 0X94F4,
-  0X8493, 0X7C52, 0X7411, 0X7411, 0X7431, 0X7431, 0X7C52, 0X8CB3,
-  0X8CD4, 0X7C72, 0X63B0, 0X84B3, 0X8493, 0X7C72, 0X8CD4, 0X9515,
-  0XA576, 0XB5D8, 0XA576, 0X8CD4, 0X8CD4, 0X8CF4, 0X9535, 0X9D56,
-  0XA576, 0X9D35, 0X9515, 0X8CF4, 0X9535, 0X9D35, 0X8CF4, 0X9515,
-  0X7C52, 0X6BF0, 0X7C73, 0X6C11, 0X7432, 0X7431, 0X7432, 0X7432,
-  0X638F, 0X6BD0, 0X6BD0, 0X7411, 0X7452, 0X7431, 0X7431, 0X8493,
-  0X84B3, 0X8493, 0X7C72, 0XA596, 0XBE18, 0X8CD4, 0X8493, 0X8493,
-  0X7432, 0X6BD0, 0X5B4E, 0X6BF0, 0X63B0, 0X638F, 0X4AAB, 0X52EC,
-  0X7432, 0X7C52, 0X7C72, 0X8493, 0X8493, 0X84B3, 0X8493, 0X7C52,
-  0X8493, 0X8493, 0X84B3, 0X7C72, 0X7C72, 0X7C72, 0X7452, 0X84B3,
-  0X84B3, 0X8CD4, 0X8CB3, 0X8493, 0X7C72, 0X7C73, 0X7452, 0X7431,
-  0X6BD0, 0X638F, 0X63AF, 0X63AF, 0X6BF0, 0X7452, 0X84B3, 0X8493,
-  0X7432, 0X8493, 0X6BF0, 0X4AAB, 0X530D, 0X638F, 0X7C73, 0X6BD0,
-  0X5B6E, 0X6BF0, 0X84B3, 0X9514, 0X8CB3, 0X8CD4, 0X9D35, 0XA576,
-  0XADB7, 0X8CF4, 0X84B3, 0X8CD4, 0X7452, 0X7431, 0X7C52, 0X7431,
-  0X6BF1, 0X7431, 0X7C52, 0X63B0, 0X6BF1, 0X9515, 0X8CD4, 0X8493,
-  0X9514, 0X9515, 0XA576, 0X8CD4, 0XA596, 0XB5D7, 0XB5F8, 0XA576,
-  0XA576, 0XADB7, 0XB5F8, 0XB618, 0XB5F8, 0X9D35, 0X9515, 0X8CF4,
-  0X8CF4, 0X84B3, 0X9515, 0X9514, 0X9D35, 0X9515, 0X7C72, 0X7411,
-  0X6BF1, 0X84B3, 0XA596, 0XBE39, 0XB5F8, 0XAD97, 0X9D56, 0X7C72,
-  0X6BF0, 0X6BF0, 0X7411, 0X8CD4, 0X9D56, 0XA576, 0XA576, 0XAD97,
-  0X9D35, 0X8CD4, 0X8493, 0X84B3, 0X7411, 0X8493, 0X9D56, 0XB5D7,
-  0XC67A, 0XAD97, 0X9D35, 0X9515, 0X84B3, 0X8493, 0X8493, 0X8493,
-  0X8493, 0X8CD4, 0X8CD4, 0X84B3, 0X7C73, 0X8493, 0X7452, 0X7432,
-  0X7C52, 0X7C72, 0X8493, 0X8CF4, 0XADB7, 0XB5F8, 0XADB7, 0X9515,
-  0X84B3, 0X7C52, 0X6BF0, 0X52EC, 0X52EC, 0X5B4E, 0X6BF0, 0X63B0,
-  0X5B4E, 0X638F, 0X7431, 0X7C52, 0X84B3, 0X7C52, 0X8CD4, 0XADB7,
-  0XB5F8, 0XCE9A, 0XC67A, 0XBE18, 0X8CD4, 0X8493, 0X7411, 0X6BD0,
-  0X6BD0, 0X6BF0, 0X6BF0, 0X7C72, 0X8CD4, 0XA596, 0XC67A, 0XD6BB,
-  0XB5F8, 0X8493, 0X9D55, 0X8CD4, 0X7432, 0X7452, 0X8493, 0X84B3,
-  0XA576, 0XBE18, 0XB618, 0XADB7, 0X9D35, 0X8493, 0X84B3, 0X84B3,
-  0X7C52, 0X7452, 0X7411, 0X7C72, 0X9514, 0XADB7, 0X9D35, 0X9D55,
-  0X94F4, 0X7432, 0X9515, 0X9515, 0X8CD4, 0X8CD4, 0X8CF4, 0X9D35,
-  0X7C52, 0X6BD0, 0X6BD0, 0X8493, 0X5B2D, 0X4ACB, 0X7C52, 0X9D55,
-  0XA576, 0XA576, 0XA576, 0X84B3, 0X7431, 0X636E, 0X8493, 0X7411,
-  0X5B4E, 0X7C73, 0X9D35, 0X9515, 0X8CD4, 0X7411, 0X8493, 0X8CF4,
-  0XA576, 0XADB7, 0XA576, 0X94F4, 0X8CB3, 0X8CD4, 0X8CD4, 0X84B3,
-  0X8493, 0X8CD4, 0XC67A, 0XC67A, 0XBE39, 0X8CB3, 0X4ACC, 0X7411,
-  0X7432, 0X6BD0, 0X6C11, 0X8493, 0X8CD4, 0X9535, 0X9515, 0X8CD4,
-  0X8CD4, 0X9515, 0X9535, 0X8CD4, 0X9515, 0X9D56, 0XA576, 0XADB7,
-  0X8493, 0X84B3, 0X8493, 0X7C72, 0X6BD0, 0X7431, 0X7C52, 0X9D55,
-  0XA576, 0X84B3, 0X84B3, 0X7C73, 0X7411, 0X6BF0, 0X5B4E, 0X6BF1,
-  0X8CD4, 0X9D56, 0XB618, 0XB5D8, 0XADB7, 0XA576, 0X9D35, 0X9515,
-  0X84B3, 0X6C11, 0X7C72, 0X8CD4, 0X9D55, 0X9D56, 0X9D35, 0X9D35,
-  0X9D35, 0X9D56, 0X9515, 0X8CD4, 0X8CD4, 0X9515, 0X6BD0, 0X6BD0,
-  0X9514, 0XAD97, 0XADB7, 0XADB7, 0XA576, 0X9D35, 0X8CD4, 0X84B3,
-  0X7C72, 0X7C52, 0X7431, 0X7C52, 0X7C72, 0X8CB3, 0X8CD4, 0X8CD4,
-  0XB5F8, 0XBE39, 0XADB7, 0X6BF0, 0X6BF1, 0X6C11, 0X8493, 0X94F4,
-  0X94F4, 0X8CF4, 0X8CD4, 0X8CF4, 0X8CF4, 0X9D56, 0X7C72, 0X7431,
-  0X8CB3, 0X9515, 0X9D35, 0XA576, 0X9D55, 0X9D55, 0X9D35, 0X9D35,
-  0X9514, 0X9514, 0X8CB3, 0X7C72, 0X7432, 0X7431, 0X7411, 0X7432,
-  0X7C52, 0X84B3, 0X8CD4, 0X8CD4, 0X7C52, 0X8493, 0X8493, 0X8CD4,
-  0X8CF4, 0X9535, 0XA596, 0XB5F8, 0XAD97, 0X9514, 0X8CF4, 0X9514,
-  0X9D35, 0X9D56, 0XADB7, 0XA596, 0X9514, 0X9514, 0XA576, 0XADB7,
-  0X9D55, 0X8CD4, 0X84B3, 0X7452, 0X7C72, 0X7C72, 0X7C52, 0X6BF1,
-  0X7431, 0X6C11, 0X52EC, 0X63AF, 0X6BD0, 0X7411, 0X7411, 0X7431,
-  0X7432, 0X7C72, 0X8CD4, 0X8CD4, 0X8CD4, 0XAD97, 0XBE18, 0X9D35,
-  0X6BF0, 0X7432, 0X8493, 0X6BF0, 0X6BD0, 0X6BD0, 0X6BF1, 0X638F,
-  0X5B4E, 0X426A, 0X6BF0, 0X7C52, 0X7C72, 0X8493, 0X84B3, 0X8CD4,
-  0X8CB3, 0X8CB3, 0X8CD4, 0X84B3, 0X8493, 0X8493, 0X84B3, 0X8CD4,
-  0X8CD4, 0X94F4, 0X8CD4, 0X8CF4, 0X8CB3, 0X84B3, 0X7C72, 0X84B3,
-  0X7411, 0X7431, 0X7431, 0X63B0, 0X63AF, 0X6BD0, 0X7C73, 0X94F4,
-  0X84B3, 0X84B3, 0X7C72, 0X8CB3, 0X7452, 0X52EC, 0X52EC, 0X5B4E,
-  0X8CD4, 0X7431, 0X63AF, 0X6BD0, 0X84B3, 0X9514, 0X9535, 0X9D56,
-  0XB5F8, 0XB5F8, 0X9D55, 0X9515, 0X8CD4, 0X8CD4, 0X84B3, 0X7C73,
-  0X8493, 0X7C52, 0X7411, 0X7C72, 0X7411, 0X63AF, 0X6C11, 0X8CD4,
-  0X84B3, 0X8CF4, 0X9D35, 0X9D56, 0XA576, 0XA597, 0XADB7, 0XADD7,
-  0XADB7, 0XA597, 0XAD97, 0XADB7, 0XB5F8, 0XBE18, 0XB618, 0X9515,
-  0X9515, 0X9514, 0X94F4, 0X9535, 0X9D35, 0X9D56, 0XA596, 0X8CD4,
-  0X6C11, 0X7431, 0X7C52, 0X7431, 0XAD97, 0XBE39, 0XBE39, 0XADD7,
-  0X9D35, 0X8493, 0X6C11, 0X6BD0, 0X7C52, 0X8CD4, 0X9D35, 0XA576,
-  0XA576, 0XA576, 0XA576, 0X94F4, 0X8CD4, 0X84B3, 0X7C52, 0X8CD4,
-  0XA597, 0XB5F8, 0XD6BB, 0XADB7, 0X9D35, 0X9515, 0X8CF4, 0X8493,
-  0X84B3, 0X8493, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X8493, 0X7C52,
-  0X7432, 0X6C11, 0X7431, 0X7C52, 0X8493, 0X9D56, 0XB5F8, 0XADB7,
-  0XADB7, 0X8CD4, 0X84B3, 0X7C72, 0X6BF0, 0X31C7, 0X4AAB, 0X638F,
-  0X7431, 0X7C73, 0X5B4E, 0X7431, 0X8493, 0X8493, 0X7C72, 0X7C52,
-  0X9514, 0XA597, 0XB5F8, 0XC67A, 0XC67A, 0XC67A, 0X9D35, 0X8493,
-  0X6BF0, 0X6BF0, 0X6BF0, 0X638F, 0X6BF0, 0X8493, 0X8CD4, 0XB5F8,
-  0XCE9A, 0XCE9A, 0XBE19, 0X9D56, 0X9514, 0X9514, 0X8493, 0X7C72,
-  0X84B3, 0X6BF0, 0XA576, 0XBE39, 0XC67A, 0XB5F8, 0X9535, 0X7432,
-  0X7C73, 0X84B3, 0X7452, 0X8493, 0X7C72, 0X7C72, 0X8CD4, 0XA576,
-  0XADB7, 0XAD97, 0X9D35, 0X63AF, 0X9D35, 0X9D56, 0X9D35, 0X8CD4,
-  0X9D35, 0XA576, 0X84B3, 0X532D, 0X532D, 0X6C11, 0X63AF, 0X5B2D,
-  0X84B3, 0X9515, 0X9D56, 0XA597, 0X9535, 0X94F4, 0X6BF1, 0X638F,
-  0X7432, 0X6BF1, 0X63AF, 0X7452, 0XA576, 0X9D35, 0X9D56, 0X7C52,
-  0X8493, 0X9D35, 0XAD97, 0XB5F8, 0XA576, 0X9514, 0X9515, 0X9515,
-  0X9515, 0X8CD4, 0X94F4, 0X9535, 0XC659, 0XCEBB, 0XBE18, 0X8CF4,
-  0X7C52, 0X7C72, 0X7C52, 0X7432, 0X7C72, 0X8493, 0X9D56, 0XA596,
-  0XADB7, 0X9535, 0X94F4, 0X9D35, 0X9D35, 0X9515, 0X9D56, 0XA576,
-  0XB5F8, 0XC659, 0X8493, 0X8493, 0X7C52, 0X7432, 0X6BD0, 0X6C11,
-  0X8CD4, 0XA576, 0XADD7, 0X8CB3, 0X84B3, 0X84B3, 0X7432, 0X6BF0,
-  0X6BD0, 0X63AF, 0X94F4, 0XADB7, 0XBE39, 0XB5D8, 0XB5D7, 0XADB7,
-  0XA576, 0XADB7, 0X8CD4, 0X7431, 0X84B3, 0X9515, 0X9D56, 0XA596,
-  0X9D56, 0X9D56, 0XA576, 0XA576, 0X9515, 0X8CD4, 0X94F4, 0X8CD4,
-  0X6C11, 0X6C11, 0XA576, 0XA597, 0XAD97, 0XA597, 0XAD97, 0X9D35,
-  0X9D35, 0X7C72, 0X8493, 0X7C73, 0X7432, 0X7C72, 0X8493, 0X84B3,
-  0X9514, 0X8CD4, 0XA596, 0XA596, 0X9D55, 0X7411, 0X6BF1, 0X6BD0,
-  0X7C52, 0X9D56, 0X9515, 0X94F4, 0X9515, 0X94F4, 0X9D35, 0XADB7,
-  0X8CD4, 0X7432, 0X8CD4, 0X9535, 0XA576, 0XA576, 0X9D55, 0X9D35,
-  0X9D35, 0XA576, 0X9515, 0X9514, 0X8CD4, 0X7432, 0X6BF1, 0X7411,
-  0X7411, 0X7411, 0X7452, 0X84B3, 0X8CD4, 0X8CD4, 0X7C73, 0X84B3,
-  0X8493, 0X8CF4, 0X8CF4, 0X9515, 0XA597, 0XB5F8, 0XADB7, 0X9D35,
-  0X94F4, 0X9515, 0X9D56, 0XA576, 0XADB7, 0XADB7, 0X9D56, 0X9514,
-  0X9D56, 0XADB7, 0XADB7, 0X9515, 0X8CD4, 0X7C72, 0X8493, 0X7C73,
-  0X7C72, 0X7452, 0X7C73, 0X7431, 0X532D, 0X63B0, 0X6BD0, 0X7432,
-  0X7C52, 0X7432, 0X7411, 0X7C72, 0X84B3, 0X8CD4, 0X8CD4, 0XADB7,
-  0XADD7, 0X94F4, 0X7C52, 0X7C52, 0X8493, 0X7411, 0X6BD0, 0X7411,
-  0X7C52, 0X6BD0, 0X426A, 0X4A8B, 0X6BD0, 0X7432, 0X7C73, 0X8493,
-  0X84B3, 0X8493, 0X7C52, 0X84B3, 0X8CD4, 0X8CD4, 0X8493, 0X7C73,
-  0X8CF4, 0X9D35, 0XA576, 0XADB7, 0X9515, 0X8CD4, 0X8CB3, 0X8493,
-  0X8CB3, 0X8493, 0X7432, 0X7431, 0X7C72, 0X63B0, 0X638F, 0X6BD0,
-  0X8CD4, 0X9D35, 0X8493, 0X8493, 0X8493, 0X8CD4, 0X84B3, 0X428B,
-  0X5B4E, 0X5B2D, 0X7C72, 0X7431, 0X63B0, 0X6C11, 0X8493, 0X94F4,
-  0X8CD4, 0XA597, 0XBE39, 0XBE39, 0X9D56, 0X8CD4, 0X8CB3, 0X8CD4,
-  0X84B3, 0X8493, 0X7C52, 0X7432, 0X7431, 0X8493, 0X6BF1, 0X63B0,
-  0X7411, 0X8CD4, 0X8493, 0X8CD4, 0X9D35, 0XAD97, 0XBE39, 0XADB7,
-  0XB5D8, 0XADD7, 0XA596, 0XADB7, 0XADB7, 0XB5D7, 0XBE18, 0XC67A,
-  0XB618, 0XA576, 0XA576, 0X9D56, 0XA576, 0XA576, 0X9D56, 0XA597,
-  0XA596, 0X8493, 0X7452, 0X7411, 0X7452, 0X8CD4, 0X8CF4, 0XBE18,
-  0XC659, 0XB5F8, 0X9535, 0X7C52, 0X6BF0, 0X7C52, 0X84B3, 0X8CF4,
-  0X9D35, 0XA576, 0XA576, 0XAD97, 0X9D56, 0X8CF4, 0X8CD4, 0X8493,
-  0X7432, 0X9514, 0XAD97, 0XB5F8, 0XD6DB, 0XB5D8, 0X9D35, 0X9515,
-  0X8CB3, 0X84B3, 0X8CB3, 0X84B3, 0X9515, 0X9515, 0X9515, 0X9515,
-  0X8493, 0X7432, 0X7C52, 0X7432, 0X7C52, 0X8493, 0X7C52, 0X9D56,
-  0XB5F8, 0XB5D7, 0XADD7, 0X8CD4, 0X8CF4, 0X7432, 0X63AF, 0X4AAB,
-  0X638F, 0X52EC, 0X6BD0, 0X8CD4, 0X6BD0, 0X7411, 0X7C73, 0X8493,
-  0X8493, 0X8493, 0X8CF4, 0XA597, 0XB5F8, 0XC659, 0XC659, 0XADB7,
-  0X9515, 0X84B3, 0X7411, 0X6C11, 0X7431, 0X63AF, 0X7432, 0X8493,
-  0X8CD4, 0XB5F8, 0XCEBA, 0XDEFC, 0XCE7A, 0XA597, 0X9535, 0X94F4,
-  0X7C52, 0X7431, 0X9514, 0X638F, 0X9D35, 0XBE39, 0XCE7A, 0XB5F8,
-  0XADD7, 0X9535, 0X84B3, 0X8CD4, 0X8493, 0X8493, 0X8493, 0X7C73,
-  0X8493, 0X9D55, 0XA597, 0XB5F8, 0XA576, 0X7452, 0XA576, 0XADB7,
-  0X9D56, 0X9D35, 0X9D35, 0XA576, 0X8CF4, 0X63B0, 0X3A08, 0X530C,
-  0X638F, 0X6BD0, 0X7C52, 0X84B3, 0X9D56, 0X9D56, 0X8CF4, 0X8CD4,
-  0X7411, 0X5B6E, 0X7C52, 0X7C52, 0X7C72, 0X84B3, 0X9514, 0X9515,
-  0X9D55, 0X8CF4, 0X8493, 0X9D35, 0XBE18, 0XB5F8, 0X9D35, 0X8CD4,
-  0X9D56, 0XA576, 0X9D56, 0X8CF4, 0X9D35, 0XB5D8, 0XCE9A, 0XCEBB,
-  0XADD7, 0X8CF4, 0X7C72, 0X7C72, 0X7C72, 0X7431, 0X7C52, 0X8CD4,
-  0XA576, 0XADB7, 0XA597, 0X9D35, 0X9515, 0X9D35, 0X9D35, 0X9515,
-  0XA596, 0XADB7, 0XBE39, 0XB618, 0X7C52, 0X7411, 0X7431, 0X7C52,
-  0X7C52, 0X8493, 0X9514, 0XB5D7, 0XADB7, 0X9D35, 0X8CF4, 0X84B3,
-  0X7432, 0X7431, 0X63B0, 0X7452, 0X8CD4, 0XA576, 0XB5D8, 0XBE18,
-  0XADB7, 0XA576, 0XA576, 0X9D56, 0X9535, 0X7C73, 0X9514, 0X9D35,
-  0X9515, 0X9D55, 0XA576, 0XA597, 0XAD97, 0XA576, 0X9D35, 0X8CF4,
-  0X9D56, 0X84B3, 0X7432, 0X7C72, 0XADB7, 0XB5F8, 0XADB7, 0XADB7,
-  0XADB7, 0XA576, 0X9535, 0X8CD4, 0X84B3, 0X8493, 0X7C52, 0X7C73,
-  0X84B3, 0X8CD4, 0X9D35, 0X9D56, 0XC659, 0XADD7, 0X9D35, 0X8493,
-  0X6BD0, 0X6BD0, 0X7432, 0X9515, 0X9515, 0X9D35, 0X9535, 0X9515,
-  0X9D35, 0XADB7, 0X8CF4, 0X84B3, 0X8CD4, 0XA576, 0XB618, 0XA596,
-  0XA576, 0X9D35, 0X9515, 0X9D56, 0X9D35, 0X9515, 0X8CD4, 0X7C72,
-  0X7431, 0X7411, 0X7411, 0X7411, 0X7C52, 0X84B3, 0X8CF4, 0X8CB3,
-  0X84B3, 0X8CB3, 0X8493, 0X8CD4, 0X9515, 0X9D56, 0XA596, 0XBE18,
-  0XA576, 0X9D56, 0XA576, 0X9D35, 0X9D56, 0XA596, 0XA596, 0XB5F8,
-  0XADB7, 0X9515, 0XA576, 0XADB7, 0XADB7, 0X9D56, 0X9515, 0X7C72,
-  0X8CB3, 0X84B3, 0X8493, 0X7C52, 0X7C72, 0X7C52, 0X6C11, 0X6BF0,
-  0X63AF, 0X7C72, 0X7C72, 0X84B3, 0X7C52, 0X7C72, 0X8CD4, 0X84B3,
-  0X8CF4, 0XB5F8, 0XB5F8, 0XADB7, 0X8CD4, 0X7411, 0X7C52, 0X6C11,
-  0X6BD0, 0X7C52, 0X7C52, 0X638F, 0X428A, 0X52EC, 0X6BD0, 0X7432,
-  0X8493, 0X84B3, 0X8CD4, 0X8493, 0X8493, 0X8493, 0X8CD4, 0X84B3,
-  0X7C72, 0X7C73, 0X8CD4, 0X9D35, 0X9535, 0XADB7, 0X9D56, 0X9D35,
-  0X9515, 0X7C72, 0X7C72, 0X8493, 0X7452, 0X7411, 0X6BF0, 0X63AF,
-  0X638F, 0X530D, 0X7C52, 0XA576, 0X8493, 0X84B3, 0X7C73, 0X8493,
-  0X7C72, 0X5B4E, 0X638F, 0X63AF, 0X7431, 0X8493, 0X6C11, 0X6BF0,
-  0X7C73, 0X8CD4, 0X8493, 0X9D56, 0XB618, 0XB618, 0X9D35, 0X9514,
-  0X8CD4, 0X94F4, 0X8CB3, 0X7C73, 0X6BD0, 0X6BF0, 0X6BF0, 0X7C72,
-  0X7411, 0X7411, 0X6BF1, 0X9535, 0X84B3, 0X9515, 0X9D35, 0XA596,
-  0XBE18, 0XB5F8, 0XB5D8, 0XADB7, 0XB5D8, 0XB5F8, 0XADD7, 0XB5F8,
-  0XC659, 0XC67A, 0XBE19, 0XADB7, 0XADB7, 0XA596, 0XA596, 0XA596,
-  0XA597, 0XAD97, 0X9D35, 0X7C73, 0X6BD0, 0X6BF0, 0X7C52, 0X84B3,
-  0X9D35, 0XB5F8, 0XC67A, 0XBE19, 0X94F4, 0X7432, 0X6BD0, 0X7C72,
-  0X8493, 0X94F4, 0X9D55, 0XA576, 0X9D56, 0XA596, 0XA576, 0X9D35,
-  0X8CF4, 0X8CD4, 0X7C73, 0X9515, 0XA597, 0XC67A, 0XCE9A, 0XADD7,
-  0XA576, 0X9515, 0X8CD4, 0X8CF4, 0X8CD4, 0X8CD4, 0X9D35, 0XADB7,
-  0X9D56, 0X9515, 0X84B3, 0X7C52, 0X7C73, 0X7C73, 0X8493, 0X84B3,
-  0X8CD4, 0XADB7, 0XBE39, 0XC67A, 0XA576, 0X94F4, 0X9514, 0X7C52,
-  0X6BD0, 0X532D, 0X5B4E, 0X428A, 0X5B4E, 0X6BF0, 0X7432, 0X84B3,
-  0X8493, 0X8493, 0X8493, 0X8493, 0X8CD4, 0XA597, 0XC659, 0XC67A,
-  0XC67A, 0XB5D8, 0X9515, 0X7432, 0X638F, 0X7431, 0X6BF0, 0X5B4E,
-  0X7C72, 0X8CB3, 0X9515, 0XB5F8, 0XD6BB, 0XD6DB, 0XD6BB, 0XADB7,
-  0X9D56, 0X8CF4, 0X7C72, 0X8493, 0X8CD4, 0X7431, 0X8CD4, 0XC659,
-  0XC67A, 0XCE9A, 0XB5F8, 0X9515, 0X8CD4, 0X9515, 0X8CD4, 0X8CD4,
-  0X84B3, 0X8493, 0X8CD4, 0X9D35, 0X9D56, 0XB618, 0XA576, 0X84B3,
-  0XA596, 0XADB7, 0XAD97, 0X9D35, 0X9514, 0X9535, 0X8493, 0X638F,
-  0X29A7, 0X426A, 0X7411, 0X84B3, 0X8493, 0X7C72, 0X9D56, 0XA597,
-  0X9515, 0X7C72, 0X7C52, 0X63B0, 0X6BF0, 0X84B3, 0X7452, 0X8CB3,
-  0X8CD4, 0X9515, 0X9D56, 0X9515, 0X8493, 0XA576, 0XB5F8, 0XADB7,
-  0X9535, 0X8CB3, 0X9D35, 0XB5F8, 0XB5F8, 0X8CB3, 0X9515, 0XC659,
-  0XD6BB, 0XC67A, 0XADD7, 0X94F4, 0X9514, 0X8493, 0X7C73, 0X7C52,
-  0X7C73, 0X84B3, 0XA596, 0XADB7, 0XADB7, 0X9D56, 0X9515, 0X9D56,
-  0XA596, 0XA596, 0XADB7, 0XB5F8, 0XCEBB, 0XBE18, 0X7411, 0X7C52,
-  0X7431, 0X7432, 0X8493, 0X8CD4, 0X9D35, 0XADB7, 0XADB7, 0X9D35,
-  0X9515, 0X84B3, 0X6C11, 0X6BD0, 0X7C52, 0X7452, 0X9515, 0XADD7,
-  0XB5D7, 0XB5F8, 0XA576, 0X9D56, 0XA596, 0XADB7, 0X9D56, 0X8CD4,
-  0X94F4, 0XA576, 0X9D55, 0X9D55, 0XA596, 0XB5D8, 0XADB7, 0XA596,
-  0X9515, 0X8CD4, 0XA576, 0X84B3, 0X8CD4, 0X9535, 0XADB7, 0XADD7,
-  0XADB7, 0XADD7, 0XADB7, 0X9D56, 0X8CD4, 0X8CD4, 0X8CD4, 0X7C73,
-  0X7431, 0X7C72, 0X8493, 0X8CD4, 0X9515, 0XA576, 0XBE39, 0XB5F8,
-  0X94F4, 0X8493, 0X63AF, 0X6C11, 0X7C72, 0XA576, 0XA596, 0X9D55,
-  0XA576, 0X9535, 0XA596, 0XB5F8, 0X9515, 0X8CD4, 0X9D35, 0XAD97,
-  0XB5D7, 0XADB7, 0XA576, 0XA576, 0X9D56, 0XA576, 0X9D56, 0X9D35,
-  0X9D35, 0X7C73, 0X7411, 0X6BF1, 0X6BF1, 0X7431, 0X7C72, 0X84B3,
-  0X9514, 0X9514, 0X8CD4, 0X8493, 0X84B3, 0X9515, 0X9515, 0XA596,
-  0XB5D8, 0XADB7, 0XA576, 0X9D55, 0XA576, 0X9D55, 0XA596, 0XADB7,
-  0X9D56, 0XAD97, 0XADB7, 0X9D56, 0XA596, 0XB5D7, 0XB5F8, 0XA576,
-  0X9515, 0X8CD4, 0X8CD4, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CD4,
-  0X7432, 0X638F, 0X63AF, 0X7C72, 0X8493, 0X8CD4, 0X8493, 0X8493,
-  0X8CD4, 0X84B3, 0X9D35, 0XADD7, 0XB5F8, 0XADB7, 0X9D35, 0X7C73,
-  0X7C72, 0X7C52, 0X7411, 0X7C72, 0X8CB3, 0X63AF, 0X4249, 0X638F,
-  0X7411, 0X7411, 0X7C72, 0X84B3, 0X8493, 0X8493, 0X7C72, 0X8493,
-  0X8493, 0X8493, 0X7411, 0X7C72, 0X8CD4, 0X9535, 0X9D35, 0X9D35,
-  0X9D56, 0XA576, 0X9515, 0X8CD4, 0X8493, 0X7C72, 0X7C52, 0X6C11,
-  0X6BF0, 0X63AF, 0X638F, 0X5B2D, 0X7C52, 0X8CF4, 0X7C72, 0X8CD4,
-  0X84B3, 0X7C72, 0X7C72, 0X6BF0, 0X6BF0, 0X6BF0, 0X6BD0, 0X6BF1,
-  0X63B0, 0X7432, 0X7C52, 0X84B3, 0X8CB3, 0XAD97, 0XB618, 0XB5F8,
-  0XADB7, 0X9D35, 0X9515, 0X8CD4, 0X84B3, 0X8493, 0X7411, 0X6BD0,
-  0X6BD0, 0X7C52, 0X7411, 0X6BD0, 0X84B3, 0X9515, 0X9514, 0X9D35,
-  0XA576, 0XADB7, 0XC67A, 0XBE39, 0XB5F8, 0XB5F8, 0XBE18, 0XBE18,
-  0XB5F8, 0XB5F8, 0XCE9A, 0XC67A, 0XBE18, 0XADB7, 0XADD7, 0XADB7,
-  0XADB7, 0XADD7, 0XB5F8, 0XAD97, 0X8CF4, 0X7C72, 0X6BD0, 0X7432,
-  0X84B3, 0X84B3, 0X9D56, 0XB618, 0XBE39, 0XCEBA, 0X8CD4, 0X7452,
-  0X7C52, 0X8493, 0X8493, 0X9515, 0XA576, 0XAD97, 0XA576, 0XB5D8,
-  0XA597, 0X9D35, 0X8CF4, 0X84B3, 0X8CD4, 0X9515, 0XADB7, 0XDEFC,
-  0XC659, 0XB5D7, 0X9D56, 0X8CF4, 0X8CD4, 0X8CD4, 0X94F4, 0X9515,
-  0XA576, 0XA576, 0XA576, 0X94F4, 0X8CB3, 0X8493, 0X8493, 0X84B3,
-  0X8CD4, 0X8CD4, 0X8CD4, 0XBE18, 0XD6BB, 0XCE7A, 0XA576, 0X9D35,
-  0X9D55, 0X8493, 0X7411, 0X6BF0, 0X638F, 0X5B2D, 0X3A29, 0X5B6E,
-  0X7C52, 0X8CD4, 0X7C72, 0X8493, 0X8CF4, 0X8CD4, 0X8CD4, 0XADB7,
-  0XC659, 0XCEBA, 0XD6BB, 0XB5F8, 0X9D35, 0X7C52, 0X7452, 0X7432,
-  0X5B6E, 0X63AF, 0X8CD4, 0X7C72, 0X84B3, 0XB5F8, 0XD6DB, 0XDEFB,
-  0XD6DB, 0XA597, 0X8CD4, 0X8CD4, 0X7432, 0X8493, 0X84B3, 0X8CD4,
-  0XA576, 0XBE18, 0XC659, 0XC659, 0XADB7, 0X84B3, 0X7411, 0X8493,
-  0X8CD4, 0X8CD4, 0X7C52, 0X8493, 0X8CF4, 0XA576, 0X9515, 0X9D56,
-  0XADB7, 0XADB7, 0XB5D7, 0XB5F8, 0XADB7, 0X9535, 0X94F4, 0X9515,
-  0X8CD4, 0X5B2D, 0X3A49, 0X31C7, 0X7411, 0X8CD4, 0X8493, 0X9515,
-  0XA597, 0XADB7, 0X9D56, 0X8493, 0X6C11, 0X638F, 0X6BD0, 0X7C73,
-  0X8493, 0X84B3, 0X8CF4, 0X8CD4, 0XA576, 0X8CF4, 0X84B3, 0X9D56,
-  0XADB7, 0XA597, 0X8CD4, 0X9514, 0X9535, 0XBE39, 0XB5D8, 0X9515,
-  0XA596, 0XC67A, 0XC67A, 0XC659, 0XADB7, 0X9514, 0X8CD4, 0X8CF4,
-  0X7C72, 0X7411, 0X7411, 0X8CD4, 0XA596, 0XADB7, 0XADD7, 0XA597,
-  0X9D35, 0X9D56, 0XADB7, 0XADB7, 0XB5F8, 0XBE39, 0XC659, 0XA576,
-  0X8CD4, 0X84B3, 0X6BF0, 0X7C52, 0X8493, 0X8CF4, 0X9515, 0XAD97,
-  0XADB7, 0X9D56, 0X9515, 0X8CD4, 0X7432, 0X7411, 0X84B3, 0X8CB3,
-  0X9D35, 0XADB7, 0XBE39, 0XADB7, 0XA576, 0XA597, 0XA596, 0XADB7,
-  0XADB7, 0X9D35, 0X9D35, 0XA596, 0X9D35, 0XAD97, 0XADD7, 0XADB7,
-  0XB5F8, 0XA596, 0X84B3, 0X8CD4, 0X9D56, 0X84B3, 0X8CD4, 0X9D56,
-  0XADB7, 0XB5F8, 0XB5D7, 0XB5F8, 0XB5F8, 0XADB7, 0X9515, 0X8CF4,
-  0X8CD4, 0X8493, 0X7411, 0X8493, 0X8493, 0X9515, 0XA596, 0XADB7,
-  0XB618, 0XA576, 0X8CD4, 0X7C52, 0X7431, 0X7411, 0X7452, 0X9D56,
-  0XA597, 0X9D56, 0XA576, 0XADB7, 0XADB7, 0XADD7, 0XA576, 0X9D35,
-  0X9515, 0XA596, 0XB5F8, 0XB5F8, 0X9D55, 0XADB7, 0XA576, 0X9D56,
-  0X9D35, 0X9D55, 0X9D56, 0X8CD4, 0X7452, 0X6BF0, 0X6BF1, 0X7411,
-  0X7C72, 0X8CB3, 0X9535, 0X9D35, 0X9D55, 0X8CF4, 0X84B3, 0X94F4,
-  0X9515, 0XA576, 0XB5D7, 0XADB7, 0XADB7, 0XA576, 0X9D56, 0X9D56,
-  0XADB7, 0XA576, 0X9D35, 0X9D55, 0XA576, 0XA596, 0XA596, 0XADB7,
-  0XBE18, 0XA596, 0X9515, 0X9515, 0X94F4, 0X94F4, 0X9515, 0X9514,
-  0X9515, 0X8CB3, 0X7C72, 0X6BF0, 0X638F, 0X7C72, 0X84B3, 0X7C73,
-  0X84B3, 0X8CD4, 0X8CF4, 0X9535, 0XADB7, 0XB5F8, 0XB5D8, 0XADB7,
-  0X9515, 0X8CD4, 0X84B3, 0X7C73, 0X63AF, 0X8CD4, 0X8CD4, 0X5B4E,
-  0X4AAB, 0X638F, 0X6C11, 0X7C52, 0X7C72, 0X8CD4, 0X8493, 0X84B3,
-  0X7C72, 0X7C52, 0X8CD4, 0X8CF4, 0X7C72, 0X7452, 0X8CD4, 0XA576,
-  0X9D56, 0XA576, 0XB5D7, 0XA576, 0X9515, 0X8CF4, 0X84B3, 0X84B3,
-  0X7C52, 0X7411, 0X6BD0, 0X638F, 0X638F, 0X5B4E, 0X6BF0, 0X8CF4,
-  0X8CD4, 0X8CD4, 0X8493, 0X7C72, 0X7C72, 0X8493, 0X7432, 0X6BD0,
-  0X6BF0, 0X638F, 0X6C11, 0X7411, 0X7C72, 0X84B3, 0X8CD4, 0XA576,
-  0XB5F8, 0XB5F8, 0XADD7, 0XA576, 0X8CF4, 0X84B3, 0X8CB3, 0X84B3,
-  0X7452, 0X63B0, 0X63B0, 0X7432, 0X8493, 0X7431, 0X8CD4, 0X9515,
-  0X9D55, 0X9D56, 0X9D56, 0XADB7, 0XC659, 0XC659, 0XBE18, 0XBE19,
-  0XBE39, 0XB618, 0XB5F8, 0XBE18, 0XCEBA, 0XCE9A, 0XB5D7, 0XADB7,
-  0XADD7, 0XADD7, 0XAD97, 0XB5F8, 0XC659, 0XADB7, 0X8CF4, 0X8493,
-  0X6BD0, 0X6C11, 0X8CD4, 0X9515, 0X9D56, 0XADB7, 0XCE7A, 0XDF1C,
-  0X84B3, 0X6BD0, 0X6C11, 0X8493, 0X9514, 0XA576, 0XADB7, 0XADB7,
-  0XADB7, 0XB5F8, 0XADB7, 0XA597, 0X9514, 0X8CD4, 0X9D35, 0X9D55,
-  0XB5F8, 0XCE9A, 0XBE39, 0X9D55, 0X9D35, 0X9515, 0X8CF4, 0X9515,
-  0X9D35, 0X9D35, 0XA576, 0X9515, 0XA576, 0X9D35, 0X8CF4, 0X7C73,
-  0X8CD4, 0X9515, 0X9515, 0X9535, 0XADD7, 0XBE39, 0XCE9A, 0XCE9A,
-  0XB5F8, 0XA596, 0X9D35, 0X8CB3, 0X6BF0, 0X6BD0, 0X6BF0, 0X6BF0,
-  0X424A, 0X5B6E, 0X9514, 0X9515, 0X9514, 0X9515, 0X8CD4, 0X9D55,
-  0X9535, 0XADB7, 0XBE39, 0XC67A, 0XDF1C, 0XB5F8, 0X9D55, 0X7C52,
-  0X84B3, 0X7411, 0X63B0, 0X7431, 0X8493, 0X7C73, 0X8CD4, 0XB5F8,
-  0XCE9A, 0XD6BB, 0XD6DB, 0XADB7, 0X8CF4, 0X8CD4, 0X8493, 0X84B3,
-  0X9514, 0X9D35, 0XA576, 0XB5F8, 0XC659, 0XCE7A, 0XB5D7, 0X7C72,
-  0X7452, 0X7C52, 0X7C72, 0X7431, 0X638F, 0X7452, 0X7C72, 0XADB7,
-  0X8CD4, 0X8CD4, 0XB5F8, 0XADD7, 0XB5D7, 0XBE39, 0XB618, 0XADB7,
-  0X8CF4, 0X94F4, 0X8CD4, 0X6BD0, 0X5B2D, 0X52EC, 0X532D, 0X8493,
-  0X84B3, 0X8CF4, 0X9535, 0XA596, 0X9D56, 0X8CD4, 0X7432, 0X636E,
-  0X6BF0, 0X7C52, 0X8493, 0X9514, 0X9D35, 0X9D35, 0X9D56, 0X84B3,
-  0X84B3, 0X9515, 0X9D35, 0X9535, 0X9515, 0X9D56, 0X9D56, 0XB5F8,
-  0X7C73, 0X9515, 0XADB7, 0XCE9A, 0XC659, 0XCE7A, 0XA596, 0X8CD4,
-  0X8CD4, 0X8CF4, 0X84B3, 0X7C72, 0X63AF, 0X8CF4, 0XA596, 0XB5D7,
-  0XBE18, 0XADB7, 0X9D56, 0XADB7, 0XB5D7, 0XB5D8, 0XB5D8, 0XBE39,
-  0XC659, 0XADB7, 0X7C73, 0X8493, 0X7C52, 0X7C52, 0X7C72, 0X8CD4,
-  0X9515, 0XADB7, 0XB5D8, 0X9D56, 0X9515, 0X8CD4, 0X7C52, 0X6BF0,
-  0X7C72, 0X8CD4, 0X9D35, 0XB5D7, 0XBE39, 0XB5D7, 0XADB7, 0XADB7,
-  0XADD7, 0XB5D8, 0XADB7, 0XA596, 0XA576, 0XA576, 0X9D35, 0XB618,
-  0XB5F8, 0XADD7, 0XA596, 0X9D56, 0X8CD4, 0X9535, 0XA576, 0X8CD4,
-  0X7432, 0XA596, 0XADD7, 0XB5D8, 0XB5F8, 0XBE18, 0XBE39, 0XB5F8,
-  0X9514, 0X9514, 0X9515, 0X8CD4, 0X7452, 0X7431, 0X8CD4, 0X9D35,
-  0XADB7, 0XB5F8, 0XBE19, 0XADB7, 0X8CF4, 0X7431, 0X6BF1, 0X7431,
-  0X7C72, 0X9535, 0XAD97, 0XB5D7, 0XA576, 0XA597, 0XADB7, 0XADB7,
-  0XAD97, 0X9515, 0X9D56, 0XAD97, 0XB618, 0XBE18, 0XAD97, 0XADB7,
-  0XA596, 0XA576, 0XA576, 0X9D56, 0X9D35, 0X9515, 0X7C52, 0X6BF1,
-  0X63AF, 0X7411, 0X7C72, 0X8CD4, 0X9D35, 0X9D35, 0X9D35, 0X8CD4,
-  0X7432, 0X9515, 0X9D35, 0XAD97, 0XB5D7, 0XADB7, 0XAD97, 0XA576,
-  0XA596, 0XA576, 0XA596, 0X9D56, 0X9535, 0X9515, 0XA576, 0XADB7,
-  0XADB7, 0XADB7, 0XB618, 0XA597, 0XA576, 0X9D35, 0X9515, 0X9514,
-  0X9515, 0X94F4, 0X8CF4, 0X84B3, 0X8493, 0X7431, 0X7411, 0X7C73,
-  0X8CD4, 0X8493, 0X8493, 0X8CD4, 0X9D35, 0XA596, 0XADD7, 0XBE18,
-  0XBE39, 0XADB7, 0XA596, 0X94F4, 0X84B3, 0X7432, 0X7C72, 0X8493,
-  0X8493, 0X6BF0, 0X5B2D, 0X5B4E, 0X7431, 0X7C72, 0X8CD4, 0X9515,
-  0X8CD4, 0X8CD4, 0X8493, 0X84B3, 0X8CD4, 0X9D35, 0X7C52, 0X7411,
-  0X8CD4, 0XA596, 0XBE19, 0XA597, 0XADB7, 0XA596, 0X9D56, 0X9515,
-  0X8CD4, 0X8CB3, 0X7C72, 0X6BF0, 0X638F, 0X532D, 0X6BD0, 0X5B2D,
-  0X6BD0, 0X8493, 0X9535, 0X84B3, 0X8CD4, 0X8CD4, 0X8CF4, 0X9535,
-  0X7C72, 0X6BF1, 0X6BF0, 0X63B0, 0X7411, 0X7431, 0X7C72, 0X84B3,
-  0X8CD4, 0X9D56, 0XB5F8, 0XB5D8, 0XADB7, 0X9D55, 0X8CD4, 0X84B3,
-  0X84B3, 0X7C72, 0X7411, 0X63AF, 0X63B0, 0X8493, 0X7C72, 0X7C52,
-  0X84B3, 0X9515, 0X9D56, 0XA576, 0XA596, 0XADB7, 0XBE39, 0XC659,
-  0XC659, 0XC659, 0XBE18, 0XBE39, 0XBE18, 0XBE39, 0XCE9A, 0XD6DB,
-  0XA597, 0XB5D7, 0XB5F8, 0XB5D7, 0XB5D8, 0XBE18, 0XCE9A, 0XB5F8,
-  0X7C72, 0X9515, 0X6BF0, 0X6BF0, 0X8CD4, 0X94F4, 0X9D56, 0XADB7,
-  0XCE7A, 0XCEBB, 0XA576, 0X6BF0, 0X6BD0, 0X7C73, 0X9515, 0XA576,
-  0XA576, 0XADB7, 0XB5F8, 0XB5D7, 0XADB7, 0XA576, 0X9D56, 0X9D55,
-  0X9D35, 0X9535, 0XBE18, 0XCE7A, 0XB618, 0X9D35, 0X9D55, 0X94F4,
-  0X8CB3, 0X9515, 0X9D35, 0XA576, 0XADD7, 0X84B3, 0XA596, 0XA576,
-  0X9515, 0X8CD4, 0X94F4, 0X9514, 0X9535, 0XA576, 0XB5F8, 0XCE7A,
-  0XD6DB, 0XDEFC, 0XB5F8, 0XADB7, 0X9D35, 0X8CF4, 0X7C72, 0X638F,
-  0X638F, 0X638F, 0X5B2D, 0X638F, 0X7411, 0X9535, 0X9D35, 0X9515,
-  0X9515, 0X9D55, 0X8CD4, 0X9D55, 0XADD7, 0XC659, 0XCE9A, 0XB5D8,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X7411, 0X6BF0, 0X7431, 0X8493, 0X7452,
-  0X8CD4, 0XBE19, 0XC659, 0XCEBA, 0XCEBB, 0XB5D7, 0X9515, 0X8CD4,
-  0X84B3, 0X8493, 0X8CD4, 0X9D35, 0XA576, 0XADD7, 0XBE18, 0XBE39,
-  0XA597, 0X9515, 0X8493, 0X7C52, 0X7411, 0X6BD0, 0X638F, 0X6BF0,
-  0X7411, 0XA576, 0X9514, 0X9515, 0XADB7, 0XADD7, 0XBE18, 0XBE39,
-  0XB5F8, 0XBE39, 0X7C52, 0X7C72, 0X8CF4, 0X6C11, 0X31C7, 0X530D,
-  0X52EC, 0X8CD4, 0X8CD4, 0X9515, 0X9D55, 0X9D56, 0XB5F8, 0X8CB3,
-  0X7432, 0X6BF1, 0X6BF1, 0X7432, 0X7C72, 0X9515, 0XA576, 0XA576,
-  0X9D56, 0X8CF4, 0X8CD4, 0X9D35, 0X9D35, 0X9D35, 0X9D56, 0XA597,
-  0XA576, 0X8CF4, 0X6BD0, 0X8493, 0XADB7, 0XCE7A, 0XCEBB, 0XBE39,
-  0XA576, 0X8CD4, 0X94F4, 0X8CF4, 0X8CB3, 0X7C73, 0X7432, 0X9535,
-  0XA596, 0XB5F8, 0XBE18, 0XADD7, 0XA576, 0XADB7, 0XB5F8, 0XBE18,
-  0XBE39, 0XBE39, 0XBE39, 0XA596, 0X8CB3, 0X7C72, 0X7432, 0X7431,
-  0X7C72, 0X8CB3, 0X9535, 0XADB7, 0XADD7, 0XA576, 0X8CF4, 0X8CD4,
-  0X7411, 0X63AF, 0X7431, 0X8CF4, 0XA576, 0XB5D7, 0XB5F8, 0XB618,
-  0XAD97, 0XB5F8, 0XB618, 0XB5D8, 0XADD7, 0XAD97, 0XA596, 0XA596,
-  0XA597, 0XC659, 0XB5F8, 0XADB7, 0XA596, 0X9D55, 0X9514, 0X9D55,
-  0XAD97, 0X9514, 0X7C72, 0XADB7, 0XB5F8, 0XBE18, 0XB5F8, 0XC659,
-  0XBE39, 0XB5F8, 0XA576, 0X9535, 0X8CD4, 0X8CD4, 0X8493, 0X7C52,
-  0X7431, 0X9514, 0XB5F8, 0XB5F8, 0XB5F8, 0XA576, 0X8CD4, 0X6BF0,
-  0X8493, 0X7432, 0X7452, 0X8CD4, 0XA597, 0XB5F8, 0XADB7, 0XA596,
-  0XB5D8, 0XB5F8, 0XADB7, 0X9D56, 0XA576, 0XA597, 0XB5F8, 0XBE18,
-  0XADD7, 0XADD7, 0XA576, 0X9D56, 0XA576, 0XA596, 0XA576, 0X8CF4,
-  0X84B3, 0X7431, 0X6BD0, 0X7411, 0X7C52, 0X8CD4, 0X9D35, 0X9D56,
-  0XA576, 0X9D35, 0X8493, 0X9D35, 0XA596, 0XADB7, 0XB5F8, 0XADB7,
-  0XADB7, 0XADD7, 0XA576, 0X9D55, 0X9D55, 0XA576, 0X8CD4, 0X9515,
-  0X9D55, 0XA576, 0XB5D7, 0XB5F8, 0XB5F8, 0XB618, 0X9D56, 0X9D56,
-  0X9D35, 0X9D35, 0X9D35, 0X9515, 0X8CD4, 0X8CB3, 0X7C72, 0X7411,
-  0X7431, 0X8CD4, 0X8CF4, 0X8CD4, 0X7C72, 0X9515, 0XA597, 0X9D55,
-  0XB5D8, 0XC67A, 0XCE9A, 0XBE39, 0XB618, 0X8CD4, 0X8CF4, 0X8CD4,
-  0X8CB3, 0X8CD4, 0X84B3, 0X7432, 0X4ACC, 0X638F, 0X7411, 0X8493,
-  0X8CD4, 0XA576, 0X8CD4, 0X8CF4, 0X8CF4, 0X8CF4, 0X9515, 0X9D56,
-  0X8493, 0X7C52, 0X8CF4, 0XA576, 0XADB7, 0XADB7, 0XADB7, 0XADB7,
-  0XB5F8, 0X9D35, 0X9515, 0X8CD4, 0X7432, 0X7432, 0X6BD0, 0X5B4E,
-  0X5B4E, 0X5B4E, 0X638F, 0X7411, 0X8CB3, 0X84B3, 0X8CD4, 0X94F4,
-  0X9535, 0XA576, 0X8493, 0X7C52, 0X7411, 0X6BF0, 0X6BD0, 0X7411,
-  0X7C72, 0X8CF4, 0X9515, 0XA576, 0XB5F8, 0XB5D8, 0XA576, 0X8CF4,
-  0X8493, 0X8493, 0X8CD4, 0X7432, 0X6BD0, 0X5B6E, 0X63AF, 0X7C52,
-  0X7C52, 0X7432, 0X94F4, 0X9D35, 0X9D35, 0X9D35, 0XADB7, 0XB5D7,
-  0XB5F8, 0XBE39, 0XC659, 0XC659, 0XC659, 0XBE19, 0XBE39, 0XC659,
-  0XD6BB, 0XC659, 0XB5F8, 0XB5F8, 0XB5F8, 0XB5F8, 0XBE18, 0XBE19,
-  0XC67A, 0XBE39, 0X9515, 0X9515, 0X7431, 0X7411, 0X7C73, 0X8493,
-  0X8CD4, 0X9D56, 0XCE9A, 0XCE7A, 0XBE19, 0X8CD4, 0X7452, 0X9515,
-  0XB5F8, 0XADB7, 0XA597, 0XA596, 0XC659, 0XCE7A, 0XB5D7, 0XA576,
-  0XA596, 0X9D56, 0XADB7, 0XA596, 0XB5F8, 0XC659, 0XA597, 0X9D35,
-  0X9515, 0X8CF4, 0X8CF4, 0X9535, 0XA576, 0XAD97, 0XADB7, 0X94F4,
-  0XAD97, 0XA576, 0X9D35, 0X84B3, 0X94F4, 0XA576, 0X9D56, 0XA576,
-  0XB5F8, 0XCE9A, 0XD6DB, 0XD6DB, 0XA576, 0XADB7, 0X9515, 0X8493,
-  0X7C52, 0X6BF0, 0X638F, 0X5B6E, 0X63AF, 0X6C11, 0X7C72, 0X84B3,
-  0X9514, 0X9D35, 0XA576, 0X9D35, 0X8CF4, 0X9515, 0XADB7, 0XB618,
-  0XB618, 0XA597, 0X8493, 0X8CD4, 0X9515, 0X84B3, 0X7C52, 0X8493,
-  0X84B3, 0X8493, 0XA576, 0XBE39, 0XBE39, 0XCE9A, 0XCE9A, 0XADD7,
-  0X9D35, 0X8CD4, 0X8CD4, 0X84B3, 0X8CD4, 0X84B3, 0X9514, 0XA576,
-  0XB618, 0XC659, 0XB5D7, 0X9D35, 0X84B3, 0X7C72, 0X7432, 0X7411,
-  0X6BD0, 0X63AF, 0X6BF0, 0X8CF4, 0X8CF4, 0X9D35, 0XADB7, 0XB5F8,
-  0XBE39, 0XBE39, 0XB5F8, 0XA596, 0X9515, 0X7C52, 0X84B3, 0X7C52,
-  0X5B2D, 0X636E, 0X63AF, 0X84B3, 0X8CD4, 0X9515, 0X9D56, 0X9535,
-  0X9D55, 0X8CD4, 0X8CB3, 0X6BD0, 0X6BD0, 0X7C72, 0X7C72, 0X9515,
-  0XADB7, 0XA576, 0X9D56, 0X84B3, 0X8CF4, 0X9515, 0X9515, 0X9514,
-  0X9D56, 0XADB7, 0X9D56, 0X9535, 0X7C52, 0X84B3, 0XBE39, 0XCEBA,
-  0XCE7A, 0XBE19, 0XA576, 0X8CD4, 0X8CF4, 0X8CD4, 0X8CF4, 0X8493,
-  0X7C72, 0X9515, 0XA596, 0XB5F8, 0XBE18, 0XA576, 0XADB7, 0XADB7,
-  0XB5F8, 0XC659, 0XC659, 0XBE19, 0XB5F8, 0XB5F8, 0X8CF4, 0X7C52,
-  0X7C73, 0X7432, 0X7C72, 0X8CB3, 0X9515, 0XBE19, 0XB5F8, 0X9515,
-  0X8CD4, 0X7C73, 0X7C52, 0X7431, 0X7C52, 0X8CF4, 0X9D55, 0XA596,
-  0XB5F8, 0XC67A, 0XADB7, 0XB5F8, 0XB618, 0XBE18, 0XB5F8, 0XB5F8,
-  0XB5F8, 0XB5D7, 0XADD7, 0XB5F8, 0XADB7, 0XA596, 0X9D35, 0X9D55,
-  0X9515, 0X9D35, 0XA576, 0X8CD4, 0X9515, 0XB5F8, 0XB5F8, 0XADB7,
-  0XB5F8, 0XC659, 0XBE39, 0XADD7, 0XAD97, 0X9D35, 0X94F4, 0X8CF4,
-  0X84B3, 0X7C73, 0X7432, 0X9D35, 0XBE39, 0XC67A, 0XB5F8, 0X9D35,
-  0X8CD4, 0X7C52, 0X8493, 0X6BD0, 0X7432, 0X84B3, 0XA596, 0XB5F8,
-  0XB618, 0XB5F8, 0XADB7, 0XB5F8, 0XADB7, 0XA576, 0X9D56, 0XADB7,
-  0XB5F8, 0XBE19, 0XB5F8, 0XADB7, 0XA576, 0XA576, 0XA576, 0XA576,
-  0X9D35, 0X94F4, 0X8CF4, 0X6BF1, 0X6BD0, 0X7452, 0X7C52, 0X8CD4,
-  0X9514, 0XA576, 0XADD7, 0XAD97, 0X9515, 0X9515, 0XB5D7, 0XADD7,
-  0XB5D8, 0XB5F8, 0XB618, 0XBE18, 0XADB7, 0XA596, 0X9D35, 0X9D55,
-  0X9514, 0X94F4, 0X9D55, 0XADB7, 0XB5D8, 0XB5F8, 0XBE18, 0XBE39,
-  0XADD7, 0XA596, 0X9D55, 0X9D56, 0X9D55, 0X9535, 0X9515, 0X8493,
-  0X7C52, 0X6BF0, 0X7C72, 0X84B3, 0X8CD4, 0X9515, 0X9515, 0X9D35,
-  0XA576, 0XAD97, 0XB5F8, 0XBE39, 0XBE39, 0XBE39, 0XB5D8, 0XA576,
-  0X94F4, 0X8CD4, 0X8CF4, 0X94F4, 0X94F4, 0X7C73, 0X638F, 0X6BD0,
-  0X7411, 0X7C52, 0X9514, 0X9515, 0X9515, 0X8CF4, 0X94F4, 0X94F4,
-  0X8CF4, 0X8CF4, 0X8493, 0X7C72, 0X9515, 0X9D56, 0XA576, 0XADB7,
-  0XB5D8, 0XADB7, 0XB5D8, 0XA576, 0X9515, 0X8CD4, 0X7C72, 0X7C73,
-  0X7432, 0X63AF, 0X6BD0, 0X638F, 0X5B6E, 0X6BD0, 0X8493, 0X8CB3,
-  0X8CD4, 0X9515, 0X9D56, 0X9D56, 0X8CD4, 0X7C52, 0X7C72, 0X7411,
-  0X7411, 0X7432, 0X7C73, 0X8CF4, 0X9D35, 0XA596, 0XB5F8, 0XB5F8,
-  0X9D56, 0X8493, 0X8493, 0X8493, 0X6BF0, 0X7431, 0X6BF1, 0X638F,
-  0X5B4E, 0X7C72, 0X7C73, 0X7432, 0X8CD4, 0X9D35, 0XA576, 0X9D56,
-  0XA597, 0XB5D7, 0XB5F8, 0XB618, 0XC659, 0XC659, 0XC659, 0XB5F8,
-  0XC659, 0XC659, 0XCE9A, 0XBE39, 0XBE18, 0XB5F8, 0XB5F8, 0XB5D7,
-  0XBE18, 0XBE19, 0XBE39, 0XB5D8, 0X9515, 0X8CF4, 0X7452, 0X7C52,
-  0X7C52, 0X7C72, 0X94F4, 0XADB7, 0XC67A, 0XD6DB, 0XB5F8, 0X9D56,
-  0X9D35, 0XA596, 0XB5F8, 0XB5F8, 0XADB7, 0XA596, 0XB618, 0XBE39,
-  0XB5F8, 0XA596, 0XADB7, 0XADB7, 0XB5F8, 0XB618, 0XBE39, 0XBE39,
-  0XA576, 0X9514, 0X8CF4, 0X8CD4, 0X9515, 0X9D35, 0XA596, 0XADB7,
-  0XAD97, 0XA576, 0XADB7, 0X9D56, 0X9515, 0X8CF4, 0X9515, 0X8CF4,
-  0X9D56, 0XA576, 0XB5F8, 0XC659, 0XD6BB, 0XD6BB, 0XBE18, 0XA576,
-  0X84B3, 0X7432, 0X7452, 0X7411, 0X5B6E, 0X5B2D, 0X636E, 0X7411,
-  0X7C52, 0X7C72, 0X8CD4, 0X9D35, 0XA596, 0XADB7, 0XADB7, 0X9D56,
-  0XB5D8, 0XB5F8, 0X8CD4, 0X7411, 0X7452, 0X9515, 0XA576, 0X94F4,
-  0X7C72, 0X84B3, 0X8CB3, 0X9514, 0XA596, 0XB5F8, 0XBE18, 0XC659,
-  0XC659, 0XB5D7, 0XADB7, 0X9515, 0X8CF4, 0X8CD4, 0X8CD4, 0X8493,
-  0X9515, 0XA597, 0XBE39, 0XC67A, 0XB5F8, 0X94F4, 0X8CD4, 0X7C72,
-  0X7C73, 0X7C72, 0X63AF, 0X5B6E, 0X6C11, 0X84B3, 0X9515, 0X9515,
-  0XADB7, 0XB5F8, 0XC659, 0XC659, 0XB5D7, 0XADB7, 0X9D55, 0X7C52,
-  0X7C52, 0X7C52, 0X6BF0, 0X5B4E, 0X7411, 0X8CD4, 0X8CF4, 0X9D56,
-  0XA576, 0X9D55, 0X9D35, 0X9515, 0X8493, 0X7411, 0X6BF0, 0X7C72,
-  0X84B3, 0X9515, 0XAD97, 0XADB7, 0X9D56, 0X94F4, 0X9515, 0X9515,
-  0X9535, 0X9D35, 0X9515, 0XAD97, 0XADB7, 0XB5F8, 0XA597, 0XB5F8,
-  0XC67A, 0XCEBA, 0XC67A, 0XBE39, 0X9D56, 0X8CB3, 0X9515, 0X8CD4,
-  0X8CD4, 0X84B3, 0X8CD4, 0X9515, 0XA576, 0XB618, 0XBE18, 0XB5F8,
-  0XADB7, 0XB5D8, 0XBE19, 0XC659, 0XC67A, 0XBE39, 0XB5F8, 0XBE18,
-  0X9D35, 0X6BF0, 0X84B3, 0X7C72, 0X7C72, 0X8CD4, 0X9515, 0XB5D7,
-  0XADB7, 0X9535, 0X94F4, 0X84B3, 0X7C52, 0X7C52, 0X84B3, 0X8493,
-  0X9D55, 0XA576, 0XB5D8, 0XC659, 0XB5F8, 0XB5F8, 0XB5F8, 0XB5F8,
-  0XB5F8, 0XB618, 0XC659, 0XB5F8, 0XADB7, 0XADD7, 0XADB7, 0XAD97,
-  0XA597, 0X9D55, 0X9535, 0XA576, 0XA596, 0X9D56, 0XA576, 0XADD7,
-  0XB5F8, 0XADB7, 0XADB7, 0XB5F8, 0XBE18, 0XB5F8, 0XB5D7, 0X9D56,
-  0X9535, 0X9515, 0X8CF4, 0X84B3, 0X7432, 0X9515, 0XBE18, 0XDF1C,
-  0XBE39, 0X9D35, 0X8CD4, 0X8CD4, 0X7C72, 0X6BD0, 0X7C72, 0X8CD4,
-  0X9D55, 0XB5F8, 0XC67A, 0XC659, 0XB5F8, 0XB5F8, 0XADB7, 0XA576,
-  0XA576, 0XA597, 0XADB7, 0XB618, 0XB5F8, 0XB618, 0XADB7, 0XADB7,
-  0XA576, 0X9D56, 0X9D35, 0X8CF4, 0X8CB3, 0X7C52, 0X6BD0, 0X7432,
-  0X7C72, 0X8CD4, 0X9515, 0X9D56, 0XA596, 0XADB7, 0XA596, 0XA576,
-  0XC659, 0XBE39, 0XBE39, 0XC659, 0XBE39, 0XB5F8, 0XB5F8, 0XAD97,
-  0X9D56, 0X9515, 0X9514, 0X9515, 0X9D55, 0XADB7, 0XB5D7, 0XB5F8,
-  0XBE18, 0XBE18, 0XB5F8, 0XADB7, 0XAD97, 0XADB7, 0X9D55, 0X9515,
-  0X8CD4, 0X8CD4, 0X84B3, 0X8493, 0X84B3, 0X8CD4, 0X8CF4, 0X9D56,
-  0X9D35, 0X9D56, 0XA597, 0XB5F8, 0XB5D8, 0XBE39, 0XBE39, 0XB5F8,
-  0XB5F8, 0XADD7, 0X9D35, 0X8CB3, 0X7C72, 0X9515, 0X9D35, 0X7C73,
-  0X63AF, 0X7431, 0X7C52, 0X8493, 0X8CD4, 0X8CB3, 0X9515, 0X9535,
-  0X9D35, 0X94F4, 0X9515, 0X9D56, 0X9515, 0X9515, 0XA576, 0XADB7,
-  0XBE18, 0XBE39, 0XB5F8, 0XADD7, 0XADB7, 0XA576, 0X9D35, 0X8CF4,
-  0X84B3, 0X8493, 0X7432, 0X6C11, 0X7C52, 0X6BF0, 0X6BD0, 0X530C,
-  0X8493, 0X8CD4, 0X9514, 0X9D35, 0X9D55, 0X9D35, 0X8CF4, 0X8493,
-  0X7C52, 0X6BF0, 0X6BF1, 0X7432, 0X8CB3, 0X9D56, 0XA596, 0XADB7,
-  0XB5F8, 0XB5D7, 0X9D56, 0X8CF4, 0X84B3, 0X8493, 0X7431, 0X6BF0,
-  0X6BF0, 0X63B0, 0X6BD0, 0X7C52, 0X8493, 0X8493, 0X9515, 0X9D56,
-  0X9D35, 0X9D56, 0XA596, 0XADB7, 0XADB7, 0XADB7, 0XB5F8, 0XCE9A,
-  0XCE7A, 0XB618, 0XBE39, 0XCE9A, 0XCE9A, 0XC659, 0XB5F8, 0XB5F8,
-  0XB5D8, 0XADB7, 0XBE18, 0XBE18, 0XC659, 0XADB7, 0X9535, 0X8CD4,
-  0X7C72, 0X7C52, 0X7C72, 0X7C52, 0X9515, 0XA597, 0XC659, 0XDEFB,
-  0XD6BB, 0X9D56, 0XA597, 0XBE18, 0XBE39, 0XB5F8, 0XADB7, 0XA597,
-  0XBE18, 0XBE18, 0XB5F8, 0XADB7, 0XA576, 0XADB7, 0XB5F8, 0XB5F8,
-  0XBE18, 0XB5D8, 0X9D35, 0X8CF4, 0X8493, 0X84B3, 0X8CD4, 0X9D55,
-  0XADB7, 0XB5D7, 0XA597, 0X8CF4, 0XA596, 0XA576, 0XA576, 0XA576,
-  0X9D35, 0X9D35, 0X8CF4, 0X9D35, 0XADD7, 0XBE39, 0XCEBB, 0XD6DB,
-  0XADB7, 0XA576, 0X8CD4, 0X7C72, 0X7C52, 0X6BD0, 0X5B2D, 0X4AAB,
-  0X5B4E, 0X6BD0, 0X7C52, 0X8493, 0X7C52, 0X84B3, 0XBE39, 0XADD7,
-  0XA597, 0XADB7, 0XB5F8, 0XB5D8, 0X9535, 0X7432, 0X8493, 0X9D35,
-  0XB5F8, 0X9535, 0X8CB3, 0X8CD4, 0X8CF4, 0X9D56, 0XADB7, 0XB5F8,
-  0XBE39, 0XBE18, 0XADB7, 0XA576, 0X9D35, 0X9535, 0X9D35, 0X9535,
-  0X8CF4, 0X6BF1, 0X9515, 0XADB7, 0XBE39, 0XCE9A, 0XB5F8, 0X8CF4,
-  0X8493, 0X8493, 0X7432, 0X7C72, 0X63AF, 0X638F, 0X63AF, 0X8CB3,
-  0X84B3, 0X8CD4, 0XAD97, 0XBE39, 0XCE7A, 0XBE39, 0XB5D7, 0XBE18,
-  0X9D56, 0X8493, 0X7411, 0X8CB3, 0X7C52, 0X5B4E, 0X8493, 0X8CD4,
-  0X9515, 0X9D56, 0XADB7, 0X9D35, 0XA576, 0X9515, 0X8CD4, 0X7C52,
-  0X6BF0, 0X7C72, 0X7C72, 0X9515, 0XADB7, 0XB5F8, 0X9D56, 0X8CD4,
-  0X9535, 0X9515, 0X9514, 0X8CF4, 0X9D56, 0XADD7, 0XB5F8, 0XBE18,
-  0XB5F8, 0XBE39, 0XCEBA, 0XCE9A, 0XCE7A, 0XBE39, 0XA576, 0X9515,
-  0X9514, 0X8CD4, 0X8CD4, 0X8CB3, 0X8CD4, 0X8CB3, 0X9535, 0XADD7,
-  0XBE18, 0XB5F8, 0XB5F8, 0XB5F8, 0XC659, 0XC67A, 0XC67A, 0XBE39,
-  0XB5F8, 0XADD7, 0X9535, 0X8493, 0X8493, 0X7C52, 0X7452, 0X8CB3,
-  0X94F4, 0XA596, 0XADB7, 0X9D56, 0X8CF4, 0X8CB3, 0X7431, 0X7C52,
-  0X8CD4, 0X94F4, 0XA576, 0XADB7, 0XBE18, 0XBE39, 0XBE39, 0XBE39,
-  0XBE39, 0XBE18, 0XADB7, 0XB5F8, 0XB5F8, 0XADB7, 0XADB7, 0XADB7,
-  0XADB7, 0XADB7, 0XA596, 0X9D56, 0X9D56, 0XA576, 0XA597, 0XA596,
-  0XAD97, 0XB5D7, 0XADB7, 0X9515, 0XA576, 0XADB7, 0XB5F8, 0XB5F8,
-  0XADB7, 0XA596, 0XA597, 0XADB7, 0X9515, 0X84B3, 0X7C72, 0X9D56,
-  0XCEBA, 0XDEFC, 0XB5F8, 0X8493, 0X7C72, 0X8CD4, 0X7C52, 0X7432,
-  0X8493, 0X8CD4, 0XA576, 0XBE19, 0XD6BB, 0XC659, 0XB5F8, 0XB5F8,
-  0XB5D7, 0XADB7, 0XA576, 0XA596, 0XA597, 0XB5F8, 0XBE18, 0XBE18,
-  0XB5D8, 0XB5D7, 0XADB7, 0X9D35, 0X9515, 0X9514, 0X8CF4, 0X7C72,
-  0X6BD0, 0X6BF0, 0X7C72, 0X84B3, 0X9514, 0X9D56, 0XA597, 0XADB7,
-  0XADB7, 0XA576, 0XC659, 0XC67A, 0XBE39, 0XC67A, 0XC659, 0XBE39,
-  0XB5F8, 0XADB7, 0XA576, 0X9535, 0X9515, 0XA576, 0X9D56, 0X9D56,
-  0XADB7, 0XB618, 0XBE19, 0XBE18, 0XBE18, 0XB5F8, 0XB5F8, 0XB5D7,
-  0XAD97, 0X9535, 0X9515, 0X9D35, 0X8CF4, 0X84B3, 0X8CF4, 0X9515,
-  0X94F4, 0X9D55, 0X9D35, 0XA597, 0XADB7, 0XADD7, 0XB5F8, 0XBE18,
-  0XBE18, 0XBE18, 0XB5F8, 0XADD7, 0X9D55, 0X9515, 0X8CF4, 0X9515,
-  0X94F4, 0X7C52, 0X7411, 0X7452, 0X7C72, 0X8493, 0X8CB3, 0X8CD4,
-  0X9D35, 0X9D35, 0XA576, 0X9515, 0XA576, 0XDEFC, 0X9D35, 0X9D55,
-  0XA596, 0XADB7, 0XBE18, 0XB5D8, 0XADB7, 0XB5F8, 0XADB7, 0XADB7,
-  0X9D56, 0X9515, 0X8CD4, 0X7C72, 0X7431, 0X63B0, 0X8CD4, 0X7C52,
-  0X6BD0, 0X63AF, 0X8CB3, 0X8CF4, 0X9514, 0X9D35, 0X9D35, 0X9515,
-  0X8CF4, 0X7C72, 0X7C72, 0X7452, 0X7C72, 0X8493, 0X84B3, 0X9D56,
-  0XB5F8, 0XBE39, 0XA596, 0XADB7, 0XA576, 0X9515, 0X8CD4, 0X8493,
-  0X7C72, 0X7431, 0X7411, 0X7431, 0X6C11, 0X7C52, 0X7C72, 0X8493,
-  0X9514, 0X9D55, 0X9D56, 0XA576, 0XB5D7, 0XB5F8, 0XADB7, 0XADB7,
-  0XB5F8, 0XC659, 0XC659, 0XBE19, 0XC659, 0XC659, 0XC659, 0XC659,
-  0XB5F8, 0XB5D7, 0XADB7, 0XB5F8, 0XC659, 0XB618, 0XB618, 0XB5D8,
-  0X9515, 0X7C73, 0X7C72, 0X8CD4, 0X7432, 0X84B3, 0X9515, 0X9D56,
-  0XCE9A, 0XDEFC, 0XD6DB, 0XC659, 0XADD7, 0XBE39, 0XCE9A, 0XB618,
-  0XA596, 0XA597, 0XB5F8, 0XBE19, 0XB5F8, 0XBE39, 0XB5D7, 0XB5F8,
-  0XBE18, 0XB5F8, 0XB5F8, 0XADB7, 0X9535, 0X8CD4, 0X84B3, 0X7C73,
-  0X94F4, 0XA597, 0XB5D8, 0XB5F8, 0XA596, 0X9D55, 0XADB7, 0XA596,
-  0XADB7, 0X9D56, 0X9D56, 0X8CD4, 0X8CF4, 0XA576, 0XAD97, 0XBE39,
-  0XCEBA, 0XDEFB, 0XC659, 0XA576, 0X8CF4, 0X8493, 0X8493, 0X5B6E,
-  0X530C, 0X52EC, 0X5B6E, 0X638F, 0X7411, 0X8CB3, 0X8CB3, 0X84B3,
-  0XB618, 0XADB7, 0XADB7, 0XB618, 0XC659, 0XBE39, 0XBE39, 0XB5F8,
-  0XADB7, 0XADB7, 0XB618, 0XA576, 0X8CD4, 0X84B3, 0X9D56, 0XA576,
-  0XADB7, 0XB618, 0XB618, 0XADB7, 0X9D35, 0X9D35, 0X8CD4, 0X9514,
-  0X9515, 0X9515, 0X9515, 0X9D56, 0X7C72, 0X9D56, 0XBE39, 0XC659,
-  0XADD7, 0X8CD4, 0X7411, 0X7431, 0X6C11, 0X7452, 0X6BF1, 0X638F,
-  0X636E, 0X84B3, 0X8CD4, 0X8CB3, 0X9D35, 0XBE18, 0XC659, 0XBE19,
-  0XB5F8, 0XB5F8, 0XADB7, 0X9515, 0X7432, 0X84B3, 0X8CD4, 0X7C73,
-  0X8493, 0X9515, 0XA597, 0XADD7, 0XB5F8, 0X9515, 0X9D35, 0X9D55,
-  0X8CD4, 0X7C72, 0X7431, 0X8493, 0X7C52, 0X8CB3, 0XA576, 0XADB7,
-  0X9515, 0X94F4, 0X9514, 0X9514, 0X9535, 0X9D35, 0X9D55, 0XA597,
-  0XB5F8, 0XC659, 0XC659, 0XC67A, 0XCE9A, 0XCE9A, 0XC67A, 0XB5F8,
-  0XA596, 0X9D35, 0X9515, 0X9514, 0X8493, 0X84B3, 0X84B3, 0X8CB3,
-  0X9515, 0XA576, 0XB5F8, 0XB5F8, 0XB5F8, 0XC67A, 0XCEBB, 0XC67A,
-  0XC67A, 0XCE9A, 0XB5F8, 0XADB7, 0X9D35, 0X8CF4, 0X8493, 0X7C72,
-  0X7C52, 0X8CB3, 0X9515, 0X9D56, 0XADB7, 0X9D56, 0X8CD4, 0X8493,
-  0X8493, 0X8CD4, 0X9514, 0X9D56, 0XA576, 0XA597, 0XB5F8, 0XBE39,
-  0XC659, 0XC659, 0XBE39, 0XBE19, 0XB5F8, 0XB5F8, 0XB5D7, 0XADB7,
-  0XA597, 0X9D56, 0XA576, 0XADB7, 0XC659, 0X9515, 0XA576, 0XA576,
-  0XADB7, 0XADD7, 0XADB7, 0XADB7, 0XA576, 0X9D55, 0X8CF4, 0X9D56,
-  0XADB7, 0XADB7, 0XADB7, 0XAD97, 0XB5F8, 0XB5F8, 0XA596, 0X84B3,
-  0X8493, 0XADB7, 0XCE9A, 0XCE9A, 0XB5D7, 0X8CD4, 0X84B3, 0X84B3,
-  0X8493, 0X7C72, 0X8CB3, 0X9535, 0XADB7, 0XBE19, 0XD6BB, 0XC67A,
-  0XBE39, 0XB5F8, 0XB5D8, 0XADB7, 0XADB7, 0XADB7, 0XADB7, 0XB5F8,
-  0XBE39, 0XBE19, 0XB5F8, 0XB5D7, 0XA597, 0X9D55, 0X9515, 0X8CD4,
-  0X8493, 0X7C52, 0X6BD0, 0X7411, 0X7C52, 0X84B3, 0X9514, 0X9D56,
-  0XADB7, 0XA596, 0XADB7, 0XA597, 0XBE39, 0XC67A, 0XCE7A, 0XCE9A,
-  0XC659, 0XBE39, 0XB5F8, 0XADB7, 0XA576, 0X9D56, 0X9D35, 0X9D35,
-  0X9D55, 0X9D56, 0XADB7, 0XADB7, 0XB5F8, 0XC659, 0XB5D7, 0XC659,
-  0XBE18, 0XB5F8, 0XADB7, 0X9D35, 0X9515, 0XA576, 0X9515, 0X84B3,
-  0X84B3, 0X9515, 0X9D35, 0X9D35, 0X9515, 0XADB7, 0XADB7, 0XA596,
-  0XBE18, 0XBE39, 0XBE19, 0XB5F8, 0XADB7, 0XADB7, 0XA576, 0X9D55,
-  0X9D35, 0X9515, 0X8CD4, 0X8493, 0X7C52, 0X7C52, 0X7C72, 0X8CD4,
-  0X9515, 0X9535, 0X9D56, 0X9D55, 0X9D56, 0X9D35, 0XADB7, 0XB5F8,
-  0X9D55, 0X9D35, 0XA576, 0XB5F8, 0XC659, 0XBE18, 0XB5F8, 0XBE18,
-  0XADB7, 0XA597, 0X9D56, 0X8CF4, 0X8CD4, 0X84B3, 0X7C52, 0X6BF0,
-  0X7432, 0X7432, 0X7431, 0X7431, 0X8493, 0X8CF4, 0X9515, 0X9D56,
-  0X9D56, 0X9515, 0X8CD4, 0X84B3, 0X8493, 0X7C52, 0X8493, 0X9515,
-  0X8CD4, 0XB5F8, 0XBE19, 0XAD97, 0X9D56, 0XADB7, 0XADB7, 0XA576,
-  0X9515, 0X84B3, 0X7C52, 0X7411, 0X7411, 0X7431, 0X7431, 0X7452,
-  0X8493, 0X8CF4, 0X9515, 0X9D35, 0XA576, 0X9515, 0XB5F8, 0XB618,
-  0XADD7, 0XADB7, 0XB618, 0XC659, 0XC67A, 0XC659, 0XC659, 0XC67A,
-  0XC659, 0XBE19, 0XB5F8, 0XB5D7, 0XADB7, 0XB5F8, 0XBE39, 0XC67A,
-  0XBE39, 0XB618, 0XADB7, 0X94F4, 0X7C73, 0X7452, 0X7C52, 0X9515,
-  0X9D35, 0XA596, 0XCE9A, 0XEF7D, 0XCE7A, 0XB5F8, 0XB5D8, 0XBE18,
-  0XCE9A, 0XADD7, 0XAD97, 0XADB7, 0XB5F8, 0XBE18, 0XBE18, 0XBE39,
-  0XBE39, 0XB618, 0XB5F8, 0XB5D8, 0XAD97, 0XA596, 0X8CF4, 0X8CD4,
-  0X8CB3, 0X8493, 0X8CF4, 0XA576, 0XADB7, 0XB5D7, 0XADB7, 0XADB7,
-  0XA597, 0XADB7, 0XADB7, 0X9D56, 0X9D35, 0X8CF4, 0X84B3, 0X9D35,
-  0XADB7, 0XB618, 0XC67A, 0XD6BB, 0XCE9A, 0XA596, 0X9515, 0X84B3,
-  0X7432, 0X4ACC, 0X532D, 0X5B4E, 0X638F, 0X636E, 0X6C11, 0X84B3,
-  0X94F4, 0X8CD4, 0XA576, 0XADB7, 0XB5F8, 0XBE39, 0XCE7A, 0XBE39,
-  0XBE39, 0XB618, 0XADB7, 0XB5D7, 0XADD7, 0XA597, 0XAD97, 0X94F4,
-  0XA596, 0XA576, 0XADB7, 0XB5F8, 0XB5F8, 0XA576, 0X9515, 0X8CD4,
-  0X8493, 0X8CD4, 0X9514, 0X9515, 0X9D35, 0X8CF4, 0X8CD4, 0X94F4,
-  0XB5F8, 0XC67A, 0XADB7, 0X8CF4, 0X7431, 0X6BF0, 0X6BF0, 0X7C72,
-  0X6BD0, 0X530D, 0X63AF, 0X7431, 0X7432, 0X94F4, 0X9D35, 0XA597,
-  0XBE18, 0XADD7, 0XADB7, 0XAD97, 0XA596, 0X9515, 0X6C11, 0X8493,
-  0X8CD4, 0X84B3, 0X8CD4, 0X9D56, 0XADB7, 0XADB7, 0XB5F8, 0XAD97,
-  0XADB7, 0X9515, 0X8CF4, 0X7C72, 0X8493, 0X84B3, 0X8493, 0X7C52,
-  0XADB7, 0X9D56, 0X8CD4, 0X94F4, 0X8CD4, 0X8CF4, 0X9515, 0X8CF4,
-  0X9515, 0XA596, 0XBE39, 0XD6DB, 0XCE7A, 0XC67A, 0XC67A, 0XC67A,
-  0XC659, 0XB5F8, 0XADB7, 0X9D56, 0X9515, 0X8CD4, 0X8493, 0X7C72,
-  0X7C72, 0X7C73, 0X8CD4, 0XA576, 0XADB7, 0XB5F8, 0XB5F8, 0XC659,
-  0XCE7A, 0XCE9A, 0XCE7A, 0XC67A, 0XB5F8, 0XA596, 0X9535, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X7C73, 0X8CD4, 0X9D35, 0X9D56, 0X9515, 0XA576,
-  0X9D35, 0X8CD4, 0X8493, 0X8CD4, 0X9514, 0X9D56, 0XA596, 0XA596,
-  0XBE39, 0XBE39, 0XC67A, 0XCE7A, 0XC659, 0XC659, 0XB618, 0XADB7,
-  0XADB7, 0XADB7, 0XAD97, 0X9D56, 0X9D35, 0XA597, 0XB5F8, 0X9D35,
-  0XA576, 0XA596, 0XADD7, 0XB5D8, 0XADB7, 0XAD97, 0XA576, 0X9535,
-  0X8CF4, 0X9515, 0X9D35, 0X9D56, 0XA576, 0XADD7, 0XBE39, 0XBE18,
-  0XAD97, 0X9515, 0X9515, 0XC659, 0XCE9A, 0XCEBB, 0XBE18, 0X94F4,
-  0X8493, 0X7452, 0X7452, 0X7C73, 0X8CD4, 0X9D35, 0XA596, 0XC659,
-  0XD6BB, 0XC67A, 0XBE19, 0XBE18, 0XB5F8, 0XADB7, 0XADB7, 0XB5D8,
-  0XB618, 0XB5F8, 0XB5D8, 0XBE19, 0XB5F8, 0XB5F8, 0XAD97, 0X9D56,
-  0X9515, 0X84B3, 0X8493, 0X84B3, 0X7452, 0X7432, 0X7C52, 0X84B3,
-  0X9515, 0X9D56, 0XA576, 0XAD97, 0XADB7, 0XB5F8, 0XC659, 0XCE9A,
-  0XCE7A, 0XD6BB, 0XC659, 0XBE39, 0XADB7, 0XADB7, 0XA596, 0X9D35,
-  0X9515, 0X9515, 0X9D35, 0X9D55, 0XA576, 0XADB7, 0XB5F8, 0XBE39,
-  0XBE18, 0XC659, 0XBE39, 0XB5F8, 0XADB7, 0XADB7, 0X9515, 0X9515,
-  0X94F4, 0X8CB3, 0X84B3, 0X8CD4, 0X8CF4, 0X9D35, 0X9D56, 0XA576,
-  0XADB7, 0XA597, 0XB5F8, 0XB618, 0XBE19, 0XBE18, 0XADD7, 0XADB7,
-  0X9D56, 0X9D35, 0X9D56, 0X9515, 0X84B3, 0X7C72, 0X7C72, 0X7C52,
-  0X7C72, 0X8CD4, 0XA576, 0X9535, 0X9D35, 0X9D56, 0XA576, 0X9D56,
-  0XA576, 0XA597, 0X9515, 0XA576, 0XADB7, 0XBE18, 0XBE39, 0XBE18,
-  0XB5F8, 0XB5F8, 0XADD7, 0XA596, 0X9D35, 0X9D35, 0X9515, 0X8CD4,
-  0X8493, 0X7C72, 0X8CD4, 0X8493, 0X7C52, 0X7C52, 0X8CB3, 0X8CF4,
-  0X9515, 0XA596, 0XADB7, 0XA576, 0X8CD4, 0X7C73, 0X7C72, 0X84B3,
-  0X8CD4, 0X8CF4, 0X9D56, 0XB618, 0XC67A, 0XB618, 0XB5D7, 0XB5D8,
-  0XB5D7, 0XA576, 0X9515, 0X8CB3, 0X8493, 0X7C52, 0X7411, 0X7452,
-  0X7C52, 0X7432, 0X84B3, 0X8CF4, 0X9514, 0X9D35, 0XA596, 0X9D56,
-  0XB5F8, 0XBE39, 0XBE39, 0XB5F8, 0XBE39, 0XC67A, 0XCE7A, 0XC67A,
-  0XCE7A, 0XC67A, 0XC67A, 0XC659, 0XB5D8, 0XADD7, 0XADB7, 0XADB7,
-  0XB5F8, 0XBE39, 0XBE39, 0XB5F8, 0XA597, 0X8CF4, 0X7C72, 0X7432,
-  0X84B3, 0X8CD4, 0X9515, 0XADB7, 0XCE9A, 0XDF1C, 0XCE9A, 0XB5F8,
-  0XADD7, 0XB5F8, 0XB5F8, 0XADB7, 0XADB7, 0XADB7, 0XB5F8, 0XB5F8,
-  0XC659, 0XC659, 0XC659, 0XBE18, 0XB5F8, 0XADB7, 0XA576, 0X8CF4,
-  0X84B3, 0X8493, 0X7C72, 0X7C72, 0X9514, 0X9D56, 0XADB7, 0XB5F8,
-  0XADD7, 0XADB7, 0XADB7, 0XADB7, 0XADB7, 0X9D56, 0X9515, 0X8CF4,
-  0X84B3, 0X9D35, 0XB5F8, 0XADD7, 0XB618, 0XC67A, 0XCE9A, 0XA596,
-  0X9515, 0X8493, 0X7411, 0X5B2D, 0X52EC, 0X5B4E, 0X638F, 0X638F,
-  0X6C11, 0X84B3, 0X9D35, 0X7C52, 0X9515, 0XB5F8, 0XB618, 0XBE19,
-  0XCE9A, 0XBE39, 0XBE18, 0XB5F8, 0XADB7, 0XC67A, 0XADB7, 0XB5F8,
-  0XADB7, 0XA576, 0XA596, 0XA576, 0XADB7, 0XADD7, 0XB5D8, 0X9D35,
-  0X9D35, 0X8CD4, 0X8CD4, 0X9515, 0X8CD4, 0X9515, 0X9515, 0X9515,
-  0X8493, 0X9D35, 0XB5F8, 0XBE18, 0XADB7, 0X9515, 0X7C52, 0X6BD0,
-  0X6BF0, 0X63B0, 0X638F, 0X4AAB, 0X530D, 0X7452, 0X84B3, 0X8CD4,
-  0X8CD4, 0X9D56, 0XADD7, 0XB5F8, 0XA596, 0XA576, 0X9D35, 0X9D35,
-  0X84B3, 0X84B3, 0X8CD4, 0X8CD4, 0X9535, 0XADB7, 0XADD7, 0XADB7,
-  0XBE19, 0XB5F8, 0XA597, 0X9D35, 0X8CF4, 0X8493, 0X8493, 0X8CF4,
-  0X84B3, 0X84B3, 0XA576, 0X9D56, 0X94F4, 0X9514, 0X8CD4, 0X8CB3,
-  0X9515, 0X8CF4, 0XA597, 0XBE18, 0XBE39, 0XCE9A, 0XD6BB, 0XCE9A,
-  0XCE7A, 0XC659, 0XBE39, 0XB5F8, 0XADB7, 0XA576, 0X9515, 0X8493,
-  0X7C52, 0X7C52, 0X7432, 0X7C52, 0X8493, 0X9515, 0XA596, 0XB5D8,
-  0XBE18, 0XC67A, 0XCE9A, 0XCE7A, 0XCE9A, 0XCE7A, 0XB5F8, 0XB5D7,
-  0X9515, 0X8CB3, 0X84B3, 0X84B3, 0X8CD4, 0X8CD4, 0X9515, 0X9515,
-  0X9D56, 0X9D35, 0X94F4, 0X84B3, 0X84B3, 0X8CF4, 0X9515, 0X9D56,
-  0XADB7, 0XB5F8, 0XBE39, 0XC659, 0XC659, 0XC659, 0XC659, 0XBE18,
-  0XADB7, 0XA596, 0XADB7, 0XADB7, 0XA576, 0X9514, 0X8CD4, 0X9D56,
-  0XA596, 0X9D56, 0XA576, 0XADD7, 0XB5D8, 0XB5F8, 0XADB7, 0XA596,
-  0X9D35, 0X8CF4, 0X8CF4, 0X9515, 0X9D35, 0X9D55, 0XADB7, 0XB5D7,
-  0XC659, 0XD6BB, 0XB618, 0XADB7, 0XADB7, 0XCE9A, 0XCE9A, 0XCE9A,
-  0XB5F8, 0X8CF4, 0X7C52, 0X7C52, 0X7C72, 0X8493, 0X7C72, 0X9D56,
-  0XADB7, 0XCE9A, 0XC67A, 0XC659, 0XC659, 0XB5F8, 0XADB7, 0XADB7,
-  0XADB7, 0XB5D7, 0XBE18, 0XBE18, 0XA576, 0XC659, 0XB5F8, 0XB5F8,
-  0XAD97, 0X9D35, 0X9514, 0X84B3, 0X7C72, 0X7C72, 0X7411, 0X7432,
-  0X7C72, 0X84B3, 0X9515, 0XA576, 0XA576, 0XADB7, 0XADB7, 0XB5F8,
-  0XC659, 0XCE9A, 0XCE9A, 0XC659, 0XC67A, 0XADD7, 0XADB7, 0XADB7,
-  0X9D56, 0X9535, 0X9515, 0X9514, 0X8493, 0X9D35, 0XA596, 0XADD7,
-  0XB5F8, 0XBE39, 0XBE39, 0XBE19, 0XB5F8, 0XB5D8, 0XB5D8, 0XA576,
-  0X9D56, 0X9D56, 0X9515, 0X8CF4, 0X8CD4, 0X8CD4, 0X8CD4, 0X9D35,
-  0XA596, 0XA576, 0XA596, 0XADB7, 0XB5D8, 0XB5F8, 0XBE18, 0XBE39,
-  0XB618, 0XB5F8, 0XADB7, 0XA576, 0X9D56, 0X9535, 0X8CD4, 0X84B3,
-  0X84B3, 0X84B3, 0X8493, 0X8CD4, 0X9515, 0X84B3, 0X9D55, 0XA596,
-  0XBE18, 0XA576, 0XA576, 0X9D56, 0X9515, 0XA576, 0XB5F8, 0XBE39,
-  0XC659, 0XC659, 0XBE18, 0XBE19, 0XBE39, 0XB5F8, 0XA597, 0XA596,
-  0X9D56, 0X9515, 0X8CB3, 0X7C52, 0X8493, 0X7C52, 0X8493, 0X8CD4,
-  0X9515, 0X8CD4, 0X9514, 0X9515, 0XA576, 0XA576, 0X9D55, 0X84B3,
-  0X8493, 0X8CD4, 0X8CF4, 0X8CF4, 0XA576, 0XBE18, 0XC67A, 0XC659,
-  0XB618, 0XB5F8, 0XADB7, 0XAD97, 0X8CD4, 0X84B3, 0X8493, 0X7452,
-  0X6BD0, 0X7C52, 0X8493, 0X8493, 0X8CD4, 0X9515, 0X9515, 0X9515,
-  0X9D55, 0XA596, 0XBE18, 0XBE39, 0XB5F8, 0XB5F8, 0XBE39, 0XC659,
-  0XCE7A, 0XCE9A, 0XC67A, 0XC659, 0XC659, 0XC659, 0XB5F8, 0XB5F8,
-  0XADB7, 0XADB7, 0XB5D8, 0XBE39, 0XBE39, 0XB5D8, 0XA576, 0X8493,
-  0X7C73, 0X8493, 0X8493, 0X84B3, 0X84B3, 0XB5F8, 0XD6BB, 0XCE9A,
-  0XCE7A, 0XADD7, 0XADB7, 0XAD97, 0XA597, 0XA596, 0XADB7, 0XB5D7,
-  0XB5F8, 0XBE18, 0XBE39, 0XC659, 0XBE19, 0XC659, 0XA596, 0XADB7,
-  0X9D55, 0X8CD4, 0X84B3, 0X7432, 0X6BF0, 0X8CD4, 0X9515, 0XADB7,
-  0XADB7, 0XB5D8, 0XA576, 0XA597, 0XB5D7, 0XB5D7, 0XA576, 0X9515,
-  0X8CD4, 0X8CD4, 0X84B3, 0X9515, 0XADB7, 0XBE18, 0XBE19, 0XBE39,
-  0XBE18, 0XA576, 0X9535, 0X84B3, 0X7411, 0X63AF, 0X5B2D, 0X532D,
-  0X52EC, 0X638F, 0X7C52, 0X8CD4, 0X8CB3, 0X8CD4, 0X84B3, 0XA596,
-  0XADB7, 0XB618, 0XCE7A, 0XC67A, 0XBE39, 0XBE18, 0XB5F8, 0XB5F8,
-  0XADB7, 0XB5F8, 0XA576, 0XA576, 0XA596, 0XA576, 0XA576, 0XADB7,
-  0XADB7, 0X9D35, 0X9515, 0X9515, 0X8CD4, 0X8CF4, 0X8493, 0X84B3,
-  0X8CF4, 0X9D56, 0X8CF4, 0X9514, 0XB5D8, 0XBE39, 0XADB7, 0X9535,
-  0X8493, 0X7431, 0X6BF1, 0X6BD0, 0X63AF, 0X52EC, 0X530D, 0X7411,
-  0X8493, 0X8493, 0X84B3, 0XA576, 0XBE18, 0XB5F8, 0XB5F8, 0X9D35,
-  0XA576, 0X9515, 0X8CD4, 0X84B3, 0X8CD4, 0X8CF4, 0XA576, 0XBE39,
-  0XB5F8, 0XB5D7, 0XADD7, 0XB5F8, 0XAD97, 0X9D35, 0X9D35, 0X94F4,
-  0X9514, 0X9515, 0X8CD4, 0X8CD4, 0X9D35, 0X9D56, 0X9515, 0X8493,
-  0X8CB3, 0X8493, 0X8CD4, 0X8CD4, 0XA596, 0XBE39, 0XCE9A, 0XD6DB,
-  0XCEBB, 0XD6DB, 0XC67A, 0XC659, 0XB618, 0XADB7, 0XB5D8, 0XADD7,
-  0X9D35, 0X7432, 0X7432, 0X6BD0, 0X638F, 0X7431, 0X8493, 0X8CD4,
-  0X9D35, 0XA596, 0XBE39, 0XCE9A, 0XCE7A, 0XCE7A, 0XCE9A, 0XC67A,
-  0XBE39, 0XAD97, 0X8CD4, 0X8CF4, 0X8CD4, 0X84B3, 0X8CD4, 0X8CD4,
-  0X9D35, 0X9D35, 0XA576, 0X9515, 0X94F4, 0X8CD4, 0X8CD4, 0X8CF4,
-  0X9D35, 0XA576, 0XADB7, 0XBE18, 0XC659, 0XBE19, 0XC659, 0XC659,
-  0XCE9A, 0XBE39, 0XADD7, 0XA596, 0XA597, 0XAD97, 0XA576, 0X9515,
-  0X94F4, 0X9D35, 0X9D35, 0XA576, 0XA596, 0XADD7, 0XBE18, 0XB5F8,
-  0XADB7, 0XA576, 0X9515, 0X8CB3, 0X8CD4, 0X8CD4, 0X9514, 0X9515,
-  0XA596, 0XADB7, 0XC659, 0XD6DB, 0XC659, 0XBE39, 0XC67A, 0XD6DB,
-  0XDEFB, 0XD6DB, 0XB5F8, 0X9515, 0X84B3, 0X7C72, 0X7C52, 0X8493,
-  0X8493, 0X9D56, 0XB5D7, 0XBE39, 0XC67A, 0XC67A, 0XC659, 0XB5F8,
-  0XB5D7, 0XADD7, 0XADD7, 0XADB7, 0XB5F8, 0XB5F8, 0XB5F8, 0XBE18,
-  0XB5F8, 0XB5F8, 0XADB7, 0X8CD4, 0X9514, 0X84B3, 0X8493, 0X7C73,
-  0X7432, 0X7432, 0X7C72, 0X84B3, 0X8CD4, 0X9D56, 0XA576, 0XADB7,
-  0XB5D7, 0XB5F8, 0XCE7A, 0XD6BB, 0XD6BB, 0XC67A, 0XBE39, 0XB5F8,
-  0XAD97, 0XA576, 0X9515, 0X9515, 0X8CF4, 0X8CD4, 0X8CF4, 0X9515,
-  0X9D55, 0XADB7, 0XB5F8, 0XBE39, 0XBE39, 0XB5F8, 0XB5F8, 0XB5D8,
-  0XADB7, 0XA596, 0X9D35, 0XADB7, 0X9D56, 0X94F4, 0X8CD4, 0X8CD4,
-  0X94F4, 0X9535, 0XA576, 0XA576, 0XA597, 0XADD7, 0XB5F8, 0XBE18,
-  0XBE18, 0XBE18, 0XB618, 0XB5F8, 0X9D55, 0X9515, 0X9D56, 0X9D56,
-  0X9D35, 0X8CF4, 0X8CD4, 0X84B3, 0X84B3, 0X8CF4, 0X8CF4, 0X84B3,
-  0X9D35, 0X9D56, 0XA576, 0X9D56, 0XADB7, 0XB5F8, 0X9D56, 0XADB7,
-  0XB5F8, 0XBE39, 0XC67A, 0XC67A, 0XBE39, 0XCE9A, 0XCE7A, 0XBE39,
-  0XADB7, 0XA596, 0X9D55, 0X9515, 0X8CD4, 0X7C52, 0X7432, 0X84B3,
-  0X9515, 0X8CF4, 0X8CD4, 0X8CF4, 0X9D35, 0X9515, 0X9D35, 0XA576,
-  0X9535, 0X8CD4, 0X8CF4, 0X9514, 0X9514, 0X8CF4, 0XA576, 0XB5F8,
-  0XC659, 0XC67A, 0XC659, 0XBE39, 0XAD97, 0X9D56, 0X9535, 0X8CD4,
-  0X8493, 0X7C52, 0X7452, 0X7C72, 0X8493, 0X8CD4, 0X8CF4, 0X9515,
-  0X9535, 0X9535, 0XA596, 0XB5D8, 0XB5F8, 0XB5F8, 0XC659, 0XBE39,
-  0XC659, 0XC659, 0XC67A, 0XD6BB, 0XC67A, 0XC659, 0XC659, 0XC659,
-  0XBE39, 0XBE18, 0XB5D8, 0XADD7, 0XB5D7, 0XADB7, 0XB5D7, 0XADB7,
-  0X9535, 0X84B3, 0X7C73, 0X7C73, 0X7C73, 0X7C72, 0X7C72, 0XBE39,
-  0XD6BB, 0XC67A, 0XBE39, 0XB5D8, 0XA596, 0XA596, 0XA576, 0XA596,
-  0XA576, 0XADD7, 0XBE18, 0XB5F8, 0XB5F8, 0XBE18, 0XB5D7, 0XADD7,
-  0XA596, 0X9D56, 0X9515, 0X84B3, 0X8493, 0X7C72, 0X7C72, 0X8CF4,
-  0X9515, 0XA576, 0XADB7, 0XA576, 0X9535, 0XAD97, 0XADB7, 0XADB7,
-  0X9515, 0X8CD4, 0X7C72, 0X8CD4, 0X8CB3, 0X94F4, 0XA597, 0XB5F8,
-  0XB5D8, 0XADB7, 0XAD97, 0XA576, 0X9D35, 0X84B3, 0X7C73, 0X6BD0,
-  0X52EC, 0X5B4E, 0X5B2D, 0X5B6E, 0X7411, 0X8CD4, 0X84B3, 0X8493,
-  0X8CD4, 0X8CD4, 0XA576, 0XBE18, 0XCE7A, 0XCE7A, 0XC67A, 0XB5F8,
-  0XBE39, 0XB5F8, 0XA597, 0XA576, 0X94F4, 0X9D56, 0XA597, 0X9D56,
-  0XA576, 0XADD7, 0XAD97, 0X9515, 0X8493, 0X8CD4, 0XA576, 0X8CF4,
-  0X84B3, 0X7C73, 0X9515, 0X9D35, 0X9515, 0X9D35, 0XA596, 0XB5F8,
-  0XADB7, 0X9515, 0X8493, 0X7C52, 0X7432, 0X6BF0, 0X636E, 0X530D,
-  0X4ACC, 0X63AF, 0X8493, 0X84B3, 0X8CD4, 0XA576, 0XAD97, 0XBE39,
-  0XBE39, 0XA596, 0X9D56, 0X9D35, 0X6C11, 0X7C72, 0X8CD4, 0X9515,
-  0X9D56, 0XADB7, 0XB5F8, 0XADB7, 0XADB7, 0XADD7, 0XADB7, 0X9D55,
-  0X9D35, 0X9D56, 0X9D35, 0X9515, 0X9515, 0X8CF4, 0XA576, 0XA596,
-  0XA576, 0X8CD4, 0X7432, 0X7432, 0X8CD4, 0XA576, 0XB5D8, 0XC67A,
-  0XCEBB, 0XCEBB, 0XCEBA, 0XCE9A, 0XC659, 0XBE39, 0XA576, 0XADD7,
-  0XB5D7, 0XB5F8, 0X9D35, 0X8CF4, 0X7431, 0X6BD0, 0X6BF0, 0X638F,
-  0X7C72, 0X8493, 0X94F4, 0XA576, 0XBE18, 0XC67A, 0XCE7A, 0XCE7A,
-  0XCE9A, 0XC659, 0XBE18, 0XA576, 0X84B3, 0X94F4, 0X94F4, 0X9514,
-  0X84B3, 0X8CF4, 0X9D56, 0XA576, 0X9D56, 0X94F4, 0X8CD4, 0X8CD4,
-  0X8CF4, 0X9515, 0X9D56, 0XAD97, 0XB5D7, 0XB5F8, 0XC659, 0XC659,
-  0XC659, 0XC67A, 0XC67A, 0XBE39, 0XADD7, 0XA596, 0XA576, 0XA576,
-  0X9D35, 0X9515, 0X8CF4, 0X9D35, 0X9D35, 0XA576, 0XADB7, 0XADD7,
-  0XB5F8, 0XB5F8, 0XADB7, 0XA576, 0X9535, 0X84B3, 0X8CD4, 0X84B3,
-  0X9515, 0X9D35, 0X9D56, 0XA597, 0XB5F8, 0XC67A, 0XCE7A, 0XCE9A,
-  0XDEFB, 0XDF1C, 0XDF1C, 0XD6DB, 0XB618, 0X9514, 0X8CD4, 0X7411,
-  0X7C73, 0X84B3, 0X8CD4, 0XA576, 0XBE19, 0XCE7A, 0XCE9A, 0XC67A,
-  0XC659, 0XB618, 0XB5F8, 0XADB7, 0XADB7, 0XB5F8, 0XBE39, 0XBE18,
-  0XB5F8, 0XC659, 0XB5F8, 0XB5F8, 0XADB7, 0X9535, 0X8CD4, 0X8CB3,
-  0X8CB3, 0X8493, 0X6BF1, 0X7C52, 0X7C73, 0X8493, 0X8CD4, 0X9D56,
-  0X9D56, 0XA576, 0XADD7, 0XBE19, 0XCE7A, 0XCE9A, 0XCE9A, 0XCE9A,
-  0XC659, 0XB5F8, 0XA596, 0X9D56, 0X9535, 0X8CD4, 0X8CD4, 0X84B3,
-  0X8CD4, 0X9514, 0X9D35, 0XADB7, 0XB5F8, 0XC67A, 0XBE18, 0XBE39,
-  0XBE18, 0XB5D8, 0XAD97, 0XA576, 0XA576, 0XA576, 0X9D56, 0X9D35,
-  0X9515, 0X94F4, 0X9515, 0X9515, 0X9D56, 0XA576, 0XADB7, 0XB5D8,
-  0XB5D8, 0XBE18, 0XBE39, 0XBE39, 0XBE18, 0XB5D8, 0XADB7, 0XA576,
-  0XADB7, 0XA576, 0XA576, 0X9515, 0X94F4, 0X9515, 0X8CD4, 0X9515,
-  0X9D35, 0X9D55, 0X9D35, 0X9D56, 0XA576, 0XA576, 0XAD97, 0XADB7,
-  0XA576, 0XA597, 0XB5F8, 0XBE39, 0XC659, 0XC659, 0XCE9A, 0XCE7A,
-  0XC659, 0XBE39, 0XB5F8, 0XA596, 0X9D35, 0X9D35, 0X8CF4, 0X8CD4,
-  0X8493, 0X8CF4, 0X9514, 0X9515, 0X8CD4, 0X9514, 0X9514, 0X9D56,
-  0XA576, 0X9D35, 0X9D35, 0X8CD4, 0X8CF4, 0X9515, 0X9D35, 0X9D35,
-  0XA596, 0XBE18, 0XC659, 0XCE9A, 0XCE7A, 0XBE39, 0XB5D7, 0XA596,
-  0X9D56, 0X8CD4, 0X84B3, 0X8493, 0X8493, 0X8CB3, 0X8CD4, 0X8CD4,
-  0X9D35, 0X9515, 0X9515, 0X9D35, 0XA596, 0XB5D8, 0XB5F8, 0XBE39,
-  0XBE39, 0XC659, 0XC659, 0XC659, 0XC67A, 0XC659, 0XBE39, 0XBE39,
-  0XB618, 0XBE39, 0XCE7A, 0XBE18, 0XB5F8, 0XB5F8, 0XADB7, 0XA596,
-  0XA576, 0X9D55, 0X8CF4, 0X8CF4, 0X8493, 0X7C72, 0X84B3, 0X8CB3,
-  0X9515, 0XBE18, 0XCE7A, 0XC67A, 0XBE18, 0XADB7, 0XA576, 0XA576,
-  0XA576, 0X9D35, 0X9D56, 0XB618, 0XB618, 0XBE19, 0XB5F8, 0XB5F8,
-  0XADD7, 0XADB7, 0X9D56, 0X9515, 0X8CF4, 0X8CF4, 0X8493, 0X8493,
-  0X84B3, 0X8CD4, 0X9D35, 0XA597, 0XA596, 0X9D56, 0X9D55, 0XA596,
-  0XA597, 0XA576, 0X9515, 0X8493, 0X7C73, 0X8CD4, 0X9515, 0X9D35,
-  0XA596, 0XB5F8, 0XADB7, 0XADB7, 0XAD97, 0XAD97, 0XA576, 0X9535,
-  0X84B3, 0X7432, 0X6BF0, 0X63AF, 0X5B2D, 0X5B4E, 0X7431, 0X7C72,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8CB3, 0X9D35, 0XADB7, 0XBE39, 0XCE7A,
-  0XCE7A, 0XBE39, 0XBE19, 0XB5F8, 0XADB7, 0XA576, 0X9D55, 0X9515,
-  0X8CF4, 0X9535, 0XA576, 0XB5F8, 0XB5D8, 0X6C11, 0X6BD0, 0X84B3,
-  0X9D35, 0X8CF4, 0X84B3, 0X7C52, 0X8CD4, 0X9D55, 0X9535, 0X9D35,
-  0XA596, 0XADD7, 0XA576, 0X9514, 0X8493, 0X7C52, 0X7411, 0X6BF0,
-  0X5B4E, 0X5B2D, 0X52EC, 0X5B4E, 0X7C52, 0X8493, 0X8CF4, 0X9515,
-  0XA597, 0XBE39, 0XC659, 0XADB7, 0X9D56, 0X9515, 0X7C72, 0X638F,
-  0X7C52, 0X8CD4, 0X9D56, 0XADD7, 0XADB7, 0XA576, 0XA596, 0XADB7,
-  0XA597, 0XA596, 0XA576, 0XA576, 0X9D56, 0X9D55, 0X94F4, 0X9D56,
-  0XADB7, 0XA576, 0X8CF4, 0X84B3, 0X7C72, 0X7C73, 0X8CD4, 0XA597,
-  0XB618, 0XCE9A, 0XCEBB, 0XCE9A, 0XCE9A, 0XC67A, 0XBE39, 0XB618,
-  0XA576, 0XAD97, 0XA597, 0XADB7, 0XADB7, 0X94F4, 0X8CD4, 0X7432,
-  0X7452, 0X7411, 0X8493, 0X84B3, 0X8CD4, 0XAD97, 0XBE39, 0XC67A,
-  0XBE39, 0XBE19, 0XC67A, 0XBE39, 0XADB7, 0X9D56, 0X9514, 0X9515,
-  0X9D56, 0X9D35, 0X8CD4, 0X9D35, 0X9535, 0X8CF4, 0X9515, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X9515, 0X9D35, 0X9D56, 0XA576, 0XB618, 0XC659,
-  0XCEBB, 0XC67A, 0XC67A, 0XC67A, 0XC659, 0XB618, 0XB5D7, 0XADB7,
-  0X9535, 0X9D56, 0XA576, 0X9515, 0X7C72, 0X84B3, 0X9535, 0X9D56,
-  0XAD97, 0XB5D7, 0XB618, 0XB5F8, 0XADB7, 0X9D56, 0X9515, 0X8493,
-  0X8CD4, 0X8CB3, 0X9515, 0X9D56, 0X9515, 0XAD97, 0XBE39, 0XBE39,
-  0XCEBA, 0XC659, 0XD6DB, 0XDEFB, 0XDEFC, 0XDEFC, 0XC659, 0X9D35,
-  0X8CD4, 0X7C72, 0X7431, 0X7C52, 0X9515, 0XB5D7, 0XBE18, 0XC659,
-  0XC67A, 0XCE9A, 0XC659, 0XBE19, 0XADB7, 0XADB7, 0XADB7, 0XB618,
-  0XBE39, 0XC659, 0XC67A, 0XC659, 0XBE39, 0XBE18, 0XB5D8, 0X9D35,
-  0X9D35, 0X8CD4, 0X8CB3, 0X8CD4, 0X7432, 0X7432, 0X7C52, 0X8493,
-  0X8CD4, 0X9515, 0X9D56, 0XAD97, 0XB5F8, 0XBE19, 0XC67A, 0XCE7A,
-  0XC67A, 0XC67A, 0XBE39, 0XB5F8, 0XA596, 0X9D56, 0X9535, 0X94F4,
-  0X8CD4, 0X7C52, 0X8493, 0X8CD4, 0X9D35, 0XADB7, 0XADD7, 0XC659,
-  0XBE18, 0XBE19, 0XBE18, 0XB5F8, 0XADB7, 0XA576, 0X9D56, 0X9D56,
-  0X9D55, 0X9D35, 0X9515, 0X8CF4, 0X8CD4, 0X9535, 0X9535, 0X9D56,
-  0XA576, 0XADB7, 0XA576, 0XB5F8, 0XBE39, 0XBE39, 0XB5F8, 0XADD7,
-  0XA597, 0XA576, 0X9D35, 0X9515, 0XA596, 0X9D56, 0X9D35, 0X9D56,
-  0X9515, 0X9535, 0X9D56, 0X9D55, 0X9515, 0XA576, 0XADB7, 0XA596,
-  0XA576, 0XA576, 0XA576, 0XA597, 0XB5F8, 0XBE39, 0XC67A, 0XCEBA,
-  0XD6BB, 0XC659, 0XC659, 0XBE39, 0XB5D8, 0X9D56, 0X9D56, 0X9D56,
-  0X94F4, 0X84B3, 0X8CD4, 0X9515, 0X9515, 0XA576, 0XA596, 0XA576,
-  0X9D56, 0XA576, 0XA596, 0X9D55, 0X9D55, 0X9515, 0X9515, 0X9515,
-  0X8CF4, 0XA576, 0XADD7, 0XC659, 0XCE7A, 0XD6DB, 0XCEBB, 0XC67A,
-  0XBE18, 0XB5D8, 0XADB7, 0X9D56, 0X8CF4, 0X8CD4, 0X7C72, 0X8CD4,
-  0X9515, 0X94F4, 0X9D56, 0X9515, 0X94F4, 0X84B3, 0XA597, 0XADD7,
-  0XB5F8, 0XBE18, 0XBE19, 0XBE39, 0XBE39, 0XC659, 0XC659, 0XBE39,
-  0XBE18, 0XBE19, 0XBE18, 0XBE39, 0XBE19, 0XB618, 0XB5F8, 0XB5F8,
-  0XADB7, 0XA576, 0X9D55, 0X9515, 0X9D35, 0X84B3, 0X8493, 0X7C72,
-  0X8493, 0X8CF4, 0X9515, 0XB5F8, 0XC67A, 0XC659, 0XBE39, 0XADB7,
-  0XA596, 0X9D56, 0X9D56, 0X9D56, 0XA576, 0XADB7, 0XB5D7, 0XB618,
-  0XB618, 0XADB7, 0XA576, 0XA576, 0X9515, 0X9D35, 0X9515, 0X84B3,
-  0X8493, 0X8493, 0X8CD4, 0X9515, 0X9D35, 0XA576, 0XA597, 0XA576,
-  0XA576, 0XA576, 0XA576, 0X9D35, 0X8CD4, 0X84B3, 0X8493, 0X8CD4,
-  0X9515, 0X9535, 0XA576, 0XB5F8, 0XB5F8, 0XADB7, 0XADB7, 0XADD7,
-  0XADB7, 0XA576, 0X8CF4, 0X7C52, 0X6BD0, 0X5B4E, 0X4ACB, 0X5B2D,
-  0X530D, 0X6C11, 0X7C52, 0X9514, 0X8CD4, 0X9514, 0XA576, 0XA597,
-  0XB5F8, 0XBE39, 0XBE39, 0XBE19, 0XB5F8, 0XA597, 0XA596, 0X9D56,
-  0X9515, 0X9515, 0X8CF4, 0X9515, 0XA576, 0XB5F8, 0XA576, 0X7C52,
-  0X7431, 0X7C72, 0X84B3, 0X84B3, 0X8493, 0X8493, 0X8493, 0X9515,
-  0X9D55, 0X9D35, 0XA576, 0XADB7, 0XA597, 0X9515, 0X8493, 0X7C52,
-  0X6BF0, 0X6BF0, 0X5B4E, 0X5B2D, 0X532D, 0X638F, 0X7411, 0X84B3,
-  0X8CD4, 0X9515, 0X9D56, 0XADB7, 0XC67A, 0XADD7, 0X9D56, 0X8CD4,
-  0X7C52, 0X4ACB, 0X6BF1, 0X8493, 0X8CF4, 0X9D35, 0XADD7, 0X9D35,
-  0X9D35, 0XA597, 0XBE18, 0XB5D7, 0XADB7, 0XA596, 0XA576, 0XA576,
-  0XA576, 0XA576, 0XADB7, 0XA576, 0X84B3, 0X84B3, 0X7C72, 0X7C52,
-  0X8CF4, 0X9D56, 0XB5F8, 0XBE39, 0XD6BB, 0XC67A, 0XC659, 0XC659,
-  0XBE18, 0XB5D7, 0XA596, 0XADB7, 0XADB7, 0XB5F8, 0XB5D7, 0X9515,
-  0X94F4, 0X7431, 0X7432, 0X7C72, 0X7C72, 0X8493, 0X8CF4, 0XA576,
-  0XB5F8, 0XBE19, 0XBE18, 0XBE18, 0XBE18, 0XBE18, 0XB5F8, 0XADB7,
-  0X9D56, 0X9D56, 0X9D35, 0X9514, 0X9515, 0X9535, 0X9515, 0X8CD4,
-  0X8CD4, 0X8CF4, 0X8CD4, 0X8493, 0X8CF4, 0X9D35, 0XA576, 0XB5F8,
-  0XBE39, 0XC659, 0XCE9A, 0XC67A, 0XCE9A, 0XCE7A, 0XC659, 0XBE39,
-  0XBE39, 0XB5F8, 0XA596, 0XA596, 0X9D56, 0X9D55, 0X8CD4, 0X9515,
-  0X9515, 0XA576, 0XB5D7, 0XB5F8, 0XB5F8, 0XB5D7, 0XA576, 0X9535,
-  0X9515, 0X9514, 0X8CF4, 0X8CF4, 0X94F4, 0X9515, 0X8CF4, 0XADB7,
-  0XBE18, 0XBE18, 0XC659, 0XBE39, 0XCEBA, 0XDEFC, 0XE73C, 0XDF1C,
-  0XBE18, 0X9D35, 0X84B3, 0X7C73, 0X7C72, 0X8493, 0X9535, 0XA576,
-  0XB5D8, 0XC659, 0XC659, 0XCE7A, 0XC67A, 0XC659, 0XB5F8, 0XADB7,
-  0XADB7, 0XBE18, 0XC67A, 0XCE9A, 0XD6DB, 0XC67A, 0XBE18, 0XB5D7,
-  0XADB7, 0X8CF4, 0X9515, 0X8CD4, 0X8CD4, 0X9D35, 0X7C73, 0X7411,
-  0X7411, 0X7C72, 0X8CB3, 0X9535, 0X9D55, 0XA576, 0XB5D7, 0XBE19,
-  0XC659, 0XCEBA, 0XCE7A, 0XC659, 0XC659, 0XADD7, 0XA596, 0X9D56,
-  0X9515, 0X9515, 0X8CD4, 0X7C73, 0X7C73, 0X8CD4, 0X9D35, 0XADB7,
-  0XB5F8, 0XBE39, 0XBE39, 0XBE39, 0XBE18, 0XB5F8, 0XAD97, 0X9D56,
-  0X9D35, 0X9D35, 0X9D35, 0X9515, 0X9514, 0X9535, 0X9D35, 0X9515,
-  0X9515, 0X9515, 0X9D35, 0XADB7, 0XADB7, 0XADB7, 0XB5F8, 0XBE18,
-  0XB5D7, 0XA596, 0XADB7, 0XAD97, 0XA576, 0X9D55, 0X9D56, 0X9D35,
-  0X9D55, 0X9515, 0X9515, 0X9515, 0X9D35, 0XA596, 0XA576, 0XA576,
-  0XA576, 0XA576, 0XA576, 0X9D56, 0XA576, 0XA597, 0XB5F8, 0XBE19,
-  0XC659, 0XCEBA, 0XD6DB, 0XC67A, 0XC659, 0XC659, 0XB5F8, 0XA596,
-  0XA576, 0X9D35, 0X9514, 0X8CD4, 0X9515, 0X9D35, 0X9D55, 0XADB7,
-  0XA576, 0X9D56, 0X9D55, 0XA576, 0XA576, 0X9D56, 0X9515, 0X8CD4,
-  0X94F4, 0XA576, 0X9515, 0XADB7, 0XB618, 0XBE39, 0XCE9A, 0XD6DB,
-  0XD6DB, 0XCE7A, 0XC659, 0XC659, 0XBE18, 0XADD7, 0X9D56, 0X9515,
-  0X9535, 0X9515, 0X9515, 0X9515, 0X9D55, 0X9D35, 0X9D55, 0X94F4,
-  0XB5F8, 0XBE18, 0XBE18, 0XB618, 0XB618, 0XC659, 0XBE39, 0XBE39,
-  0XBE19, 0XADD7, 0XB5F8, 0XBE19, 0XB5F8, 0XADD7, 0XADB7, 0XB5F8,
-  0XB618, 0XB5F8, 0XADB7, 0XA576, 0X9D35, 0X9515, 0X9514, 0X8493,
-  0X7C73, 0X6BD0, 0X7C72, 0X9D35, 0XA596, 0XBE18, 0XC659, 0XC659,
-  0XBE39, 0XADB7, 0XA597, 0XA597, 0XA576, 0X9D56, 0XA576, 0XA597,
-  0XADB7, 0XB5D7, 0XB5D8, 0X9D56, 0X9D56, 0X9D35, 0X9514, 0X9515,
-  0X9515, 0X9514, 0X8CD4, 0X8493, 0X8CD4, 0X9D35, 0XA576, 0X9D56,
-  0XA576, 0XA576, 0XA576, 0XA576, 0X9515, 0X8CD4, 0X7431, 0X84B3,
-  0X7C52, 0X8CD4, 0X9514, 0X9D35, 0X9D56, 0XA596, 0XADD7, 0XADB7,
-  0XA597, 0X9D56, 0XA576, 0X9D55, 0X8CD4, 0X7C72, 0X6BD0, 0X6BD0,
-  0X4AAB, 0X424A, 0X636E, 0X6BF0, 0X6BF0, 0X7C72, 0X9515, 0X9D55,
-  0XA597, 0XA576, 0XB5F8, 0XBE19, 0XB5F8, 0XB5F8, 0XB5F8, 0XA596,
-  0X9D35, 0X9515, 0X9535, 0X9515, 0X9515, 0X94F4, 0XA576, 0XADB7,
-  0X9D35, 0X7431, 0X7411, 0X8CD4, 0X8493, 0X8493, 0X8493, 0X8493,
-  0X8493, 0X94F4, 0XA576, 0X9D56, 0XA576, 0XA596, 0XAD97, 0X9515,
-  0X84B3, 0X7452, 0X6BF0, 0X6BF0, 0X5B4E, 0X5B4E, 0X532D, 0X638F,
-  0X6BF0, 0X84B3, 0X8CB3, 0X8CF4, 0X9515, 0XADB7, 0XC659, 0XB5D8,
-  0XA576, 0X9515, 0X7432, 0X5B4E, 0X6BF0, 0X84B3, 0X7C73, 0X9514,
-  0X9535, 0X9515, 0X8CD4, 0X9535, 0XA596, 0XB5D7, 0XADB7, 0XA596,
-  0XA576, 0X9D35, 0XA576, 0X9D56, 0X9515, 0X8CD4, 0X8493, 0X7C72,
-  0X7432, 0X84B3, 0X8CD4, 0XA576, 0XB5F8, 0XBE39, 0XC659, 0XC659,
-  0XC659, 0XBE39, 0XB5F8, 0XA596, 0XA576, 0XA597, 0XADB7, 0XB5F8,
-  0XB5F8, 0XA596, 0X9535, 0X8CD4, 0X7C52, 0X8493, 0X7C73, 0X8493,
-  0X94F4, 0X9515, 0XADB7, 0XB5F8, 0XB5D8, 0XB5F8, 0XB5F8, 0XBE39,
-  0XB5F8, 0X9D56, 0XA576, 0XA576, 0X84B3, 0X9515, 0X9D35, 0XA576,
-  0X9D35, 0X8CD4, 0X8493, 0X8493, 0X8493, 0X8493, 0X9D35, 0XA576,
-  0X9D56, 0XB5F8, 0XB5F8, 0XBE39, 0XC659, 0XC659, 0XCE7A, 0XCE9A,
-  0XC659, 0XC659, 0XBE18, 0XB5F8, 0XADB7, 0XA597, 0X9D55, 0X9515,
-  0X8CD4, 0X9515, 0X9D35, 0XA597, 0XADB7, 0XB5F8, 0XB618, 0XAD97,
-  0X9D35, 0X9515, 0X9D55, 0X9515, 0X8CF4, 0X8CD4, 0X8493, 0X8CD4,
-  0X9515, 0XADB7, 0XB5F8, 0XB5F8, 0XBE19, 0XC659, 0XCEBA, 0XD6DB,
-  0XE73C, 0XDEFC, 0XC659, 0X9515, 0X7C52, 0X7C72, 0X7C52, 0X84B3,
-  0X9515, 0XA596, 0XADD7, 0XBE39, 0XCE7A, 0XC67A, 0XCE9A, 0XC659,
-  0XB5D8, 0XB5D7, 0XADB7, 0XD6BB, 0XCEBA, 0XCE7A, 0XD6BB, 0XCE9A,
-  0XBE18, 0XB5F8, 0X9D55, 0X9514, 0X9515, 0X8CD4, 0X8CD4, 0X8CB3,
-  0X84B3, 0X7C72, 0X6BF1, 0X7C52, 0X84B3, 0X9D56, 0X9D56, 0XA596,
-  0XB5F8, 0XBE18, 0XBE39, 0XCE9A, 0XC67A, 0XC659, 0XC659, 0XB5F8,
-  0XADB7, 0XA576, 0X9515, 0X9D55, 0X8CD4, 0X84B3, 0X8493, 0X84B3,
-  0X9D35, 0XADB7, 0XBE19, 0XBE39, 0XBE19, 0XBE39, 0XBE18, 0XB5F8,
-  0XADB7, 0X9D35, 0X9515, 0X8CF4, 0X8CD4, 0X8CB3, 0X8CB3, 0X8CD4,
-  0X84B3, 0X9D35, 0X9D35, 0X9515, 0X9D56, 0XA576, 0XADB7, 0XBE18,
-  0XB5F8, 0XB618, 0XBE18, 0XB5F8, 0XB5F8, 0XA597, 0XA576, 0XA576,
-  0X9D35, 0X9D55, 0X9D55, 0X9515, 0X9D35, 0X9D35, 0X9D35, 0X9D35,
-  0XA576, 0X9D56, 0XA576, 0XA597, 0XADB7, 0XA596, 0XA596, 0X9D56,
-  0XADB7, 0XB5F8, 0XBE39, 0XC67A, 0XC67A, 0XCEBA, 0XC659, 0XBE19,
-  0XB5D8, 0XAD97, 0XA576, 0X9D35, 0X9D35, 0X9515, 0X9D35, 0X9515,
-  0X9D56, 0X9D56, 0X9D35, 0X9514, 0X9535, 0X9D35, 0X9D56, 0XA576,
-  0X8CD4, 0X8CD4, 0X9515, 0X94F4, 0X9D55, 0XADB7, 0XBE18, 0XC67A,
-  0XD6DB, 0XD6DB, 0XD6BB, 0XC67A, 0XC659, 0XC659, 0XBE39, 0XB618,
-  0XB5D7, 0XA576, 0X9D35, 0X9D35, 0X9D55, 0X9D56, 0X9D56, 0X9D56,
-  0X9D56, 0XA576, 0XADB7, 0XB5F8, 0XBE39, 0XBE39, 0XBE39, 0XBE39,
-  0XB5F8, 0XBE19, 0XB5F8, 0XA596, 0XA576, 0XA576, 0XA596, 0XA596,
-  0X9D56, 0XADD7, 0XB5F8, 0XADD7, 0X9D56, 0X9D35, 0X9515, 0X94F4,
-  0X8CD4, 0X8CD4, 0X8493, 0X8493, 0X9515, 0X9515, 0XA596, 0XA597,
-  0XB5F8, 0XBE18, 0XBE18, 0XADD7, 0XADB7, 0XA597, 0X94F4, 0X9515,
-  0XA576, 0XA596, 0XAD97, 0XB5F8, 0XBE39, 0X9D55, 0X9515, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X8CF4, 0X8CD4, 0X8493, 0X8CF4, 0X8CF4, 0X9514,
-  0X9D35, 0X9D35, 0XA597, 0XADB7, 0XA596, 0XADB7, 0X8CF4, 0X7452,
-  0X7431, 0X7C73, 0X6C11, 0X8CF4, 0X9D35, 0X9D35, 0XA576, 0XA597,
-  0XAD97, 0XADB7, 0XA576, 0X8CF4, 0X9515, 0X9515, 0X84B3, 0X7431,
-  0X6BF0, 0X638F, 0X5B4E, 0X530D, 0X5B6E, 0X6BD0, 0X6C11, 0X6BF1,
-  0X8CF4, 0X9D35, 0XA576, 0XADD7, 0XBE39, 0XADB7, 0XADB7, 0XB5D8,
-  0XADB7, 0XA576, 0X9D35, 0X9535, 0X9D35, 0X9515, 0X8CF4, 0X84B3,
-  0X94F4, 0X9535, 0X8493, 0X8493, 0X7C72, 0X84B3, 0X9515, 0X8CD4,
-  0X8493, 0X8493, 0X8CB3, 0X9515, 0X9D56, 0X9515, 0X9D56, 0XA597,
-  0XA576, 0X9515, 0X8493, 0X7C52, 0X6BF0, 0X6BF1, 0X638F, 0X5B4E,
-  0X5B2D, 0X5B2D, 0X6BF0, 0X7C52, 0X7C72, 0X7C72, 0X9535, 0XA596,
-  0XB5F8, 0XC659, 0XADB7, 0X9515, 0X8CB3, 0X8493, 0X7431, 0X6C11,
-  0X6BF0, 0X84B3, 0X9514, 0X94F4, 0X7C72, 0X8CD4, 0XA597, 0XADD7,
-  0XADB7, 0XA596, 0XA576, 0X9515, 0X9D35, 0X9515, 0X84B3, 0X6BF0,
-  0X6BD0, 0X7431, 0X6BF0, 0X7C72, 0X8CD4, 0X9D56, 0XB5D7, 0XB5F8,
-  0XBE18, 0XBE18, 0XBE18, 0XB5F8, 0XB5F8, 0XADB7, 0XA596, 0XA597,
-  0XB5F8, 0XBE18, 0XB5D8, 0XB5D7, 0X9515, 0X84B3, 0X7C73, 0X6C11,
-  0X8493, 0X84B3, 0X8CD4, 0X9D35, 0XA596, 0XADB7, 0XADB7, 0XB5D8,
-  0XB5D8, 0XADB7, 0XADB7, 0XA576, 0X9D56, 0XA576, 0X9515, 0X9515,
-  0X9515, 0X9D56, 0X9515, 0X8CD4, 0X84B3, 0X8493, 0X8493, 0X8493,
-  0X8CD4, 0X9D35, 0XADB7, 0XB5D7, 0XB5F8, 0XC659, 0XCE7A, 0XC67A,
-  0XCE9A, 0XCEBA, 0XCE9A, 0XC67A, 0XBE18, 0XB5F8, 0XB5F8, 0XA597,
-  0X9D55, 0X9515, 0X9514, 0X9515, 0X9D56, 0XA597, 0XB5D7, 0XB5F8,
-  0XB5F8, 0XADB7, 0X9515, 0X8CF4, 0X8CD4, 0X94F4, 0X8CF4, 0X8CD4,
-  0X84B3, 0X9515, 0X9515, 0XA596, 0XB5D8, 0XB5F8, 0XB5F8, 0XC659,
-  0XCEBA, 0XCE9A, 0XD6DB, 0XDF1C, 0XCE9A, 0X9535, 0X84B3, 0X8CD4,
-  0X8CB3, 0X8CD4, 0X9515, 0X9D35, 0XA596, 0XADB7, 0XB5F8, 0XC659,
-  0XCE9A, 0XB618, 0XBE19, 0XB5D7, 0XADB7, 0XC67A, 0XCE7A, 0XC67A,
-  0XC67A, 0XCE9A, 0XBE18, 0XA576, 0X9515, 0X9514, 0X8CD4, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X84B3, 0X8493, 0X7452, 0X7C52, 0X7431, 0X8CD4,
-  0XA576, 0XA596, 0XADB7, 0XB5F8, 0XBE39, 0XC67A, 0XC659, 0XC67A,
-  0XBE39, 0XBE18, 0XADB7, 0X9D56, 0X94F4, 0X9D56, 0X9514, 0X84B3,
-  0X8493, 0X94F4, 0X9515, 0XA597, 0XB5F8, 0XBE39, 0XB5F8, 0XBE18,
-  0XB618, 0XB5F8, 0XADB7, 0XA576, 0X9D35, 0X9515, 0X8CD4, 0X84B3,
-  0X8493, 0X84B3, 0X8CD4, 0X9514, 0X9D55, 0X9D35, 0X9D56, 0XADB7,
-  0XADB7, 0XBE18, 0XBE19, 0XBE39, 0XC67A, 0XBE39, 0XBE18, 0XADB7,
-  0XA596, 0X9D56, 0X9D35, 0X9515, 0X9514, 0X8CF4, 0X94F4, 0X9515,
-  0X9D35, 0X9D35, 0X9D55, 0XA576, 0XA576, 0XA596, 0XA597, 0XADB7,
-  0XA576, 0XA597, 0XAD97, 0XB5F8, 0XB5F8, 0XBE18, 0XB5F8, 0XBE18,
-  0XCE7A, 0XBE39, 0XA597, 0XA576, 0XA576, 0X9D56, 0X9D35, 0X9D35,
-  0X9D56, 0X9D35, 0X9D35, 0XA576, 0X9535, 0X9535, 0X9515, 0X9515,
-  0XA576, 0X9D35, 0X9514, 0X9515, 0X8CF4, 0X9D55, 0X9D56, 0X9D35,
-  0XB5F8, 0XC659, 0XDEFC, 0XD6DB, 0XCE9A, 0XCE7A, 0XC659, 0XC67A,
-  0XBE39, 0XBE19, 0XB5F8, 0XADB7, 0X9D56, 0X9D35, 0X9D56, 0X9D56,
-  0X9D55, 0X9D55, 0XA576, 0XADB7, 0XBE18, 0XBE18, 0XBE39, 0XBE39,
-  0XBE39, 0XBE18, 0XB5F8, 0XB5F8, 0XADB7, 0XA576, 0XA576, 0XA596,
-  0XA576, 0X9D56, 0X9D56, 0XA576, 0XADB7, 0XADB7, 0X9D56, 0X9515,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X84B3, 0X7411, 0X7C52, 0X9514,
-  0X9515, 0X9D56, 0XADB7, 0XB5F8, 0XBE39, 0XADB7, 0XA596, 0X9D56,
-  0X9535, 0X9515, 0X9D55, 0XA576, 0XA596, 0XADB7, 0XA576, 0X9515,
-  0X8CD4, 0X8CD4, 0X84B3, 0X8493, 0X8493, 0X84B3, 0X8CD4, 0X9515,
-  0X8CD4, 0X8493, 0X9514, 0X9515, 0XA596, 0XADB7, 0XADB7, 0X9D35,
-  0X8CB3, 0X7452, 0X7C52, 0X7C72, 0X84B3, 0X94F4, 0X9D56, 0X9D56,
-  0XADB7, 0XB5D7, 0XADB7, 0XB5F8, 0X9D56, 0X8493, 0X9515, 0X94F4,
-  0X8493, 0X6BD0, 0X6BD0, 0X6BD0, 0X5B2D, 0X428B, 0X5B6E, 0X7431,
-  0X8CB3, 0X8CD4, 0X8CF4, 0X9514, 0XADB7, 0XB5D7, 0XADB7, 0XA576,
-  0XA576, 0XADB7, 0XA596, 0XA576, 0XA576, 0XA596, 0X9515, 0X8CD4,
-  0X7C73, 0X7432, 0X84B3, 0X84B3, 0X7C72, 0X7C72, 0X7C72, 0X8CD4,
-  0X9515, 0X9514, 0X9515, 0X84B3, 0X8493, 0X9535, 0XA576, 0X9D35,
-  0X9515, 0XA576, 0X9D56, 0X94F4, 0X84B3, 0X7C73, 0X6BD0, 0X63AF,
-  0X63AF, 0X636E, 0X52EC, 0X636E, 0X6BF0, 0X7411, 0X7431, 0X84B3,
-  0XADD7, 0X9D35, 0XBE39, 0XCEBA, 0XADB7, 0XA596, 0X9514, 0X8CB3,
-  0X7C52, 0X7411, 0X6BD0, 0X7C72, 0X9514, 0X8CD4, 0X84B3, 0X9515,
-  0XA597, 0XB5F8, 0XA596, 0XADB7, 0XADB7, 0X9D56, 0X9515, 0X8CD4,
-  0X7C52, 0X6BF0, 0X63AF, 0X6BF0, 0X7411, 0X7411, 0X8CD4, 0XA576,
-  0XADB7, 0XADD7, 0XB5D7, 0XB5F8, 0XB5F8, 0XB5F8, 0XB5D7, 0XB5D8,
-  0XADB7, 0XADB7, 0XB618, 0XB618, 0XADD7, 0XA597, 0X9515, 0X7C72,
-  0X7411, 0X7C73, 0X8493, 0X8CD4, 0X8CB3, 0X9515, 0XA576, 0XA596,
-  0XAD97, 0XADB7, 0XB5F8, 0XADB7, 0XA576, 0X9D56, 0X9D35, 0X9515,
-  0X9D55, 0X8CF4, 0X8CB3, 0X8CD4, 0X8CB3, 0X8493, 0X7C72, 0X7C72,
-  0X7C72, 0X8493, 0X8CD4, 0X9515, 0XA576, 0XB5D8, 0XBE18, 0XBE39,
-  0XC659, 0XC659, 0XCE7A, 0XC67A, 0XC67A, 0XC67A, 0XC67A, 0XC659,
-  0XB618, 0XA576, 0X9D35, 0X8CF4, 0X8CD4, 0X8CF4, 0X8CD4, 0XA576,
-  0XADB7, 0XB5F8, 0XBE39, 0XA596, 0X8CB3, 0X8CB3, 0X8CD4, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X8493, 0X8CF4, 0X9D35, 0XA576, 0XADB7, 0XB5F8,
-  0XBE39, 0XC67A, 0XCE9A, 0XCEBB, 0XD6BB, 0XDEFC, 0XDEFC, 0XA576,
-  0X8CD4, 0X8CB3, 0X8CD4, 0X84B3, 0X9515, 0XA576, 0XA597, 0XA596,
-  0XA596, 0XB5F8, 0XBE18, 0XB5F8, 0XB618, 0XADB7, 0XADD7, 0XBE39,
-  0XC659, 0XBE39, 0XBE39, 0XBE39, 0XB5F8, 0XADB7, 0X9515, 0X7C52,
-  0X8CD4, 0X8CB3, 0X8CB3, 0X84B3, 0X8CD4, 0X84B3, 0X7C73, 0X7C73,
-  0X8493, 0X84B3, 0X9535, 0XA576, 0XADD7, 0XB5F8, 0XBE39, 0XBE39,
-  0XC659, 0XC67A, 0XBE39, 0XB5F8, 0XADB7, 0XA576, 0X9D35, 0X9D35,
-  0X9515, 0X8493, 0X8CD4, 0X9515, 0X9515, 0XA576, 0XA596, 0XB5D8,
-  0XBE18, 0XBE19, 0XBE39, 0XB5F8, 0XADB7, 0XA596, 0X9D35, 0X9515,
-  0X8CD4, 0X8493, 0X7C72, 0X84B3, 0X8CD4, 0X8CF4, 0X9515, 0X9D56,
-  0X9D56, 0X9D56, 0XADD7, 0XBE39, 0XC659, 0XBE19, 0XC67A, 0XC67A,
-  0XBE19, 0XB5D8, 0XA596, 0XA576, 0X9514, 0X8CF4, 0X8CD4, 0X8CD4,
-  0X8CD4, 0X9514, 0X9535, 0X9D55, 0XA576, 0XA576, 0X9D56, 0XA576,
-  0XA596, 0XA576, 0X9D56, 0XA576, 0XA597, 0XADB7, 0XA576, 0XADB7,
-  0XBE18, 0XBE39, 0XC659, 0XBE39, 0XBE18, 0XADB7, 0XADB7, 0XA596,
-  0X9D55, 0X9535, 0X9515, 0X9514, 0X9515, 0X9535, 0X9515, 0X9515,
-  0X9D55, 0X9D35, 0X9D35, 0X9535, 0X9D35, 0X9D35, 0X9D35, 0X8CD4,
-  0XA576, 0XA576, 0XB5D7, 0XBE19, 0XC67A, 0XCE7A, 0XC67A, 0XC67A,
-  0XC659, 0XC659, 0XBE19, 0XB5F8, 0XB5F8, 0XADB7, 0XADB7, 0XA576,
-  0XA576, 0X9D56, 0X9D56, 0X9D35, 0XADB7, 0XB5D7, 0XB5F8, 0XB5F8,
-  0XBE39, 0XBE39, 0XBE39, 0XB5F8, 0XB5F8, 0XADD7, 0XA576, 0X9515,
-  0X9D35, 0XA576, 0XA596, 0X9D35, 0X9D55, 0XA576, 0XADB7, 0XA576,
-  0X9535, 0X8CF4, 0X8CB3, 0X84B3, 0X84B3, 0X8CF4, 0X8493, 0X7C52,
-  0X7432, 0X8493, 0X84B3, 0X9D55, 0XADB7, 0XB5F8, 0XADD7, 0X9D56,
-  0X9535, 0X9D35, 0X9515, 0X9515, 0X9515, 0X9515, 0X9515, 0X9D56,
-  0X94F4, 0X8CD4, 0X8493, 0X8493, 0X8493, 0X8493, 0X8493, 0X8493,
-  0X84B3, 0X84B3, 0X84B3, 0X84B3, 0X8CD4, 0X9D35, 0XA596, 0XADB7,
-  0XADB7, 0X8CD4, 0X8493, 0X7432, 0X7432, 0X7C52, 0X84B3, 0X8CF4,
-  0X9D35, 0XADD7, 0XADB7, 0XB5D8, 0XB5F8, 0XB5F8, 0XA576, 0X8CF4,
-  0X9514, 0X94F4, 0X8CD4, 0X7452, 0X6BD0, 0X638F, 0X5B2D, 0X636E,
-  0X5B4E, 0X7411, 0X94F4, 0X9535, 0X9D35, 0XA596, 0XA597, 0XAD97,
-  0XADB7, 0XA576, 0X9D56, 0X9D35, 0X9D56, 0X9D56, 0XA576, 0X9D35,
-  0X8CD4, 0X8493, 0X638F, 0X7411, 0X7C52, 0X8493, 0X7C72, 0X6BF0,
-  0X7C73, 0X84B3, 0X8CF4, 0X9D35, 0X9D35, 0X9515, 0X84B3, 0X8CD4,
-  0X9514, 0X9515, 0X9515, 0X9D55, 0XA576, 0X9515, 0X8CD4, 0X7C73,
-  0X7411, 0X7411, 0X6BD0, 0X5B2D, 0X4A8B, 0X52EC, 0X638F, 0X63B0,
-  0X6BD0, 0X7C72, 0X9D56, 0XADB7, 0XB618, 0XB618, 0XB618, 0XADB7,
-  0X9D55, 0X8CD4, 0X8493, 0X7C72, 0X7C72, 0X8493, 0X9514, 0X9D35,
-  0X9D56, 0XA576, 0XA576, 0XADD7, 0XB5D8, 0XB5F8, 0XADB7, 0XA576,
-  0X9D56, 0X8493, 0X7C52, 0X6BD0, 0X6BF0, 0X7411, 0X6BF1, 0X7C52,
-  0X9515, 0XA576, 0XADB7, 0XADB7, 0XADB7, 0XA576, 0XADD7, 0XB5D7,
-  0XADB7, 0XA596, 0XADB7, 0XB5F8, 0XB5F8, 0XB5F8, 0XB5D8, 0XA576,
-  0X9535, 0X84B3, 0X8493, 0X9514, 0X8CD4, 0X8CD4, 0X9515, 0X9515,
-  0X9535, 0XA596, 0XADB7, 0XB5F8, 0XB5F8, 0XADB7, 0X9D55, 0X9515,
-  0XA596, 0X9D35, 0X9515, 0X94F4, 0X8CD4, 0X8CD4, 0X84B3, 0X84B3,
-  0X7C73, 0X7C72, 0X7C72, 0X8493, 0X8CD4, 0X9D35, 0XA576, 0XADB7,
-  0XB5F8, 0XADB7, 0XB5F8, 0XBE19, 0XC67A, 0XC659, 0XC67A, 0XC67A,
-  0XC67A, 0XC67A, 0XB5F8, 0X9D56, 0X9515, 0X8CD4, 0X8CD4, 0X9515,
-  0X9D35, 0X9D56, 0XADB7, 0XB5F8, 0XBE39, 0XADB7, 0X84B3, 0X8493,
-  0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X8493, 0X8CD4, 0XA597, 0XA597,
-  0XB618, 0XBE18, 0XBE19, 0XC659, 0XCE9A, 0XCEBB, 0XD6DB, 0XCEBB,
-  0XCEBB, 0XB5D7, 0X9D56, 0X8CF4, 0X84B3, 0X8CD4, 0X9514, 0X9535,
-  0XAD97, 0XADB7, 0XA576, 0XA596, 0XA597, 0XADB7, 0XB5F8, 0XB618,
-  0XB5F8, 0XBE18, 0XBE39, 0XB618, 0XADB7, 0XA576, 0XB5F8, 0XAD97,
-  0X9515, 0X8493, 0X84B3, 0X8493, 0X84B3, 0X84B3, 0X8CB3, 0X8CB3,
-  0X8493, 0X84B3, 0X8493, 0X8493, 0X9535, 0XA576, 0XADB7, 0XB5F8,
-  0XBE18, 0XBE19, 0XBE19, 0XBE18, 0XB618, 0XB5F8, 0XADB7, 0XAD97,
-  0X9D35, 0X9D35, 0X8CF4, 0X8CD4, 0X8CD4, 0X8CD4, 0X9D35, 0X9D56,
-  0XA576, 0XB5F8, 0XBE19, 0XBE39, 0XBE18, 0XADD7, 0XA576, 0X9D55,
-  0X9515, 0X8CD4, 0X8CD4, 0X8CB3, 0X84B3, 0X8493, 0X8CD4, 0X9514,
-  0X9D56, 0XA576, 0XA576, 0XAD97, 0XB5F8, 0XBE19, 0XC659, 0XC67A,
-  0XC659, 0XCEBA, 0XBE39, 0XADD7, 0XADB7, 0XA576, 0X9D35, 0X9515,
-  0X94F4, 0X8CD4, 0X8CD4, 0X8CF4, 0X9515, 0X9D55, 0XA576, 0XA576,
-  0XA596, 0XA576, 0XA576, 0XA576, 0XA576, 0XADB7, 0XB5F8, 0XB5F8,
-  0XBE19, 0XBE39, 0XBE39, 0XC659, 0XC659, 0XBE39, 0XBE39, 0XBE18,
-  0XADD7, 0XA596, 0X9D35, 0X8CF4, 0X8CD4, 0X8CB3, 0X8CF4, 0X9515,
-  0X9515, 0X9515, 0XA597, 0XADB7, 0X9D56, 0X9535, 0X9515, 0X9D35,
-  0X9D35, 0X9D35, 0X9D56, 0XA576, 0XB5F8, 0XBE39, 0XC659, 0XC67A,
-  0XBE39, 0XBE39, 0XC659, 0XBE39, 0XB5F8, 0XB5F8, 0XB5D8, 0XADD7,
-  0XA597, 0XA576, 0XA576, 0X9D56, 0X9535, 0X9D35, 0X9D56, 0XA596,
-  0XADB7, 0XB5F8, 0XBE18, 0XBE18, 0XB5F8, 0XADB7, 0XA596, 0XA576,
-  0X9D55, 0X9D35, 0X9D35, 0X9515, 0X9D56, 0XAD97, 0XA576, 0XA596,
-  0XA596, 0X9D35, 0X8CF4, 0X84B3, 0X7C72, 0X7C72, 0X7C52, 0X7C72,
-  0X7C52, 0X7411, 0X7431, 0X7C72, 0X8CD4, 0X9D35, 0XAD97, 0XADB7,
-  0XA597, 0X9515, 0X8CD4, 0X9515, 0X9515, 0X9515, 0X9515, 0X9515,
-  0X8CD4, 0X8CF4, 0X8CF4, 0X8CD4, 0X8493, 0X8493, 0X7C72, 0X7C52,
-  0X7411, 0X8493, 0X84B3, 0X8493, 0X8493, 0X7C72, 0X8CF4, 0X9514,
-  0XADB7, 0XADB7, 0X9D55, 0X7431, 0X7C73, 0X7432, 0X7411, 0X7C52,
-  0X84B3, 0X8CF4, 0X94F4, 0XA596, 0XB5F8, 0XADD7, 0XB5D7, 0XADB7,
-  0X9D56, 0X8CF4, 0X9515, 0X9535, 0X9535, 0X7C73, 0X638F, 0X532D,
-  0X5B2D, 0X638F, 0X63AF, 0X7431, 0X8CD4, 0X9D35, 0X9D55, 0X9D56,
-  0X9535, 0XADB7, 0XADB7, 0X9D56, 0X9515, 0X9515, 0X9D35, 0X9D35,
-  0X9515, 0XA576, 0X8CF4, 0X63B0, 0X5B4E, 0X63B0, 0X6BF0, 0X8493,
-  0X7C72, 0X7411, 0X7452, 0X7C72, 0X8CF4, 0XA576, 0XA596, 0X9D55,
-  0X8CD4, 0X84B3, 0X8CD4, 0X84B3, 0X8CD4, 0X9D35, 0X9D56, 0X9D35,
-  0X94F4, 0X8CB3, 0X8493, 0X7452, 0X63AF, 0X5B4E, 0X424A, 0X638F,
-  0X638F, 0X638F, 0X6BD0, 0X8493, 0X9515, 0XB5D7, 0XBE39, 0XBE18,
-  0XB618, 0XADB7, 0X9D56, 0X8CD4, 0X8CB3, 0X84B3, 0X84B3, 0X8CD4,
-  0X9D56, 0XADB7, 0X9515, 0XAD97, 0XB5D7, 0XADD7, 0XB5F8, 0XADD7,
-  0XADB7, 0X9D56, 0X9D35, 0X7432, 0X6BF0, 0X6BD0, 0X63AF, 0X63AF,
-  0X63AF, 0X7C52, 0X9D55, 0XA596, 0XADB7, 0XA596, 0X9D56, 0X9D55,
-  0XA576, 0XA576, 0XA596, 0XA576, 0XAD97, 0XADB7, 0XB5F8, 0XB5F8,
-  0XADB7, 0X9D56, 0X9535, 0X8CD4, 0X84B3, 0X8CD4, 0X9D56, 0X9D35,
-  0X9D56, 0X94F4, 0X9D35, 0X9D56, 0XA596, 0XB5D8, 0XB5F8, 0XADD7,
-  0X9535, 0X84B3, 0X94F4, 0X9515, 0X9514, 0X94F4, 0X8CF4, 0X9535,
-  0X8CF4, 0X8CB3, 0X84B3, 0X7C72, 0X7C72, 0X8493, 0X8493, 0X8CF4,
-  0X9D56, 0X9D35, 0XA576, 0XADB7, 0XB5F8, 0XBE39, 0XC659, 0XC659,
-  0XCE7A, 0XC659, 0XC67A, 0XBE18, 0XADB7, 0X9D35, 0X8CF4, 0X8CD4,
-  0X8CF4, 0X9514, 0X9D55, 0X9D55, 0XA596, 0XA596, 0X9D56, 0X8CF4,
-  0X7C52, 0X7411, 0X7C72, 0X84B3, 0X8CD4, 0X8CF4, 0X8CD4, 0X9515,
-  0X9D55, 0X9515, 0XADD7, 0XBE39, 0XC659, 0XC67A, 0XCEBA, 0XD6DB,
-  0XD6DB, 0XC67A, 0XB618, 0XB5D8, 0XB5F8, 0XADB7, 0X8493, 0X7C72,
-  0X9535, 0X9D35, 0XA576, 0X9D35, 0X9535, 0X9D55, 0XA596, 0XA597,
-  0XADB7, 0XB5F8, 0XADD7, 0XB5F8, 0XB5F8, 0XADB7, 0XA576, 0X9D56,
-  0XA596, 0XADB7, 0X9515, 0X8CD4, 0X8493, 0X7C72, 0X7C72, 0X84B3,
-  0X84B3, 0X9515, 0X8CF4, 0X8CF4, 0X8493, 0X8CD4, 0X9515, 0X9D56,
-  0XA596, 0XB5D8, 0XBE19, 0XBE19, 0XBE18, 0XB5F8, 0XB5F8, 0XB5F8,
-  0XB5D7, 0XADB7, 0XA597, 0X9D35, 0X9514, 0X8CD4, 0X8CD4, 0X8CF4,
-  0X9514, 0X9515, 0X9D55, 0XADB7, 0XBE39, 0XB5F8, 0XB5F8, 0XB5F8,
-  0X9D35, 0X9515, 0X8CF4, 0X8CD4, 0X8CD4, 0X84B3, 0X84B3, 0X8CB3,
-  0X8CB3, 0X9515, 0X9D56, 0XA576, 0XADB7, 0XADB7, 0XB5D8, 0XB5F8,
-  0XC659, 0XC659, 0XC659, 0XC67A, 0XBE39, 0XB5F8, 0XADB7, 0XA596,
-  0X9D35, 0X9515, 0X94F4, 0X9515, 0X9515, 0X9515, 0X9D35, 0X9D56,
-  0XA576, 0XA576, 0XADB7, 0XA596, 0XA576, 0XA576, 0XA596, 0XADB7,
-  0XB5F8, 0XADB7, 0XBE19, 0XC659, 0XBE39, 0XC659, 0XC659, 0XBE39,
-  0XBE39, 0XB618, 0XB5D8, 0X9D56, 0X94F4, 0X84B3, 0X8493, 0X8493,
-  0X8CB3, 0X8CD4, 0X94F4, 0X9D35, 0XADB7, 0XADB7, 0XA576, 0X9D35,
-  0X9D35, 0X9535, 0X9D35, 0X9D56, 0XA576, 0XA576, 0XADB7, 0XB5F8,
-  0XBE39, 0XC659, 0XBE18, 0XB5F8, 0XBE19, 0XB5F8, 0XB5F8, 0XB5F8,
-  0XB5D8, 0XAD97, 0XA596, 0X9D56, 0X9D56, 0X9D56, 0X9D35, 0X9D55,
-  0X9D56, 0XA576, 0XA596, 0XADD7, 0XB5F8, 0XB5F8, 0XB5F8, 0XAD97,
-  0X9D56, 0XA576, 0X9D55, 0X8CF4, 0X8CD4, 0X8CD4, 0X9D56, 0XA576,
-  0XADB7, 0XAD97, 0XA576, 0X9515, 0X8CD4, 0X7C73, 0X7C52, 0X7431,
-  0X7431, 0X7432, 0X6BF1, 0X6BF0, 0X7411, 0X7431, 0X8CD4, 0X9514,
-  0XA576, 0XA596, 0X9D55, 0X9515, 0X8CD4, 0X8CD4, 0X94F4, 0X8CD4,
-  0X8CD4, 0X94F4, 0X8CD4, 0X84B3, 0X8CD4, 0X84B3, 0X8493, 0X8493,
-  0X8493, 0X7C72, 0X7C73, 0X8493, 0X8493, 0X7431, 0X6BD0, 0X8493,
-  0X8CD4, 0X8CD4, 0X9D55, 0XA596, 0X9D35, 0X8CD4, 0X7C73, 0X7C52,
-  0X7C52, 0X7C72, 0X7C72, 0X8493, 0X8CD4, 0X9514, 0XA576, 0XADD7,
-  0XADB7, 0XA576, 0X8CF4, 0X8CD4, 0X9515, 0X9514, 0X8CD4, 0X7C72,
-  0X6BF0, 0X63AF, 0X5B4E, 0X5B4E, 0X6BF0, 0X8493, 0X9515, 0XA576,
-  0X9D35, 0X9D35, 0X94F4, 0X9D35, 0XA576, 0X9D35, 0X8CD4, 0X8493,
-  0X84B3, 0X9515, 0X8CD4, 0X8CD4, 0X8493, 0X7C52, 0X7432, 0X638F,
-  0X6BF0, 0X84B3, 0X8CD4, 0X8493, 0X7C52, 0X6BD0, 0X84B3, 0X9D56,
-  0XADB7, 0XA576, 0X9D35, 0X8CD4, 0X84B3, 0X8493, 0X8493, 0X9514,
-  0X9D35, 0X9515, 0X8CD4, 0X8493, 0X7C72, 0X7411, 0X636E, 0X5B4E,
-  0X5B6E, 0X63AF, 0X6BD0, 0X6BD0, 0X6BF0, 0X8CD4, 0X9D35, 0XADB7,
-  0XBE39, 0XC67A, 0XB5F8, 0XA596, 0X9515, 0X84B3, 0X8493, 0X8CD4,
-  0X8CF4, 0X9D35, 0XA576, 0XAD97, 0XADB7, 0XB5F8, 0XADB7, 0XB5F8,
-  0XB618, 0XB5D7, 0XB5D7, 0XADB7, 0X84B3, 0X63B0, 0X63AF, 0X5B4E,
-  0X5B4E, 0X6C11, 0X7411, 0X84B3, 0X9D35, 0XA576, 0XA596, 0XA576,
-  0X9515, 0X8CD4, 0X9D35, 0XA576, 0XA576, 0X9D56, 0XA596, 0XA596,
-  0XADB7, 0XADD7, 0XA596, 0X9D35, 0X9515, 0X9515, 0X9514, 0X8CD4,
-  0X9D56, 0X9535, 0X9515, 0X9515, 0X9515, 0X9D35, 0XA596, 0XADD7,
-  0XADD7, 0XA596, 0X9D35, 0X8CD4, 0X84B3, 0X8CD4, 0X8CD4, 0X8CF4,
-  0X9515, 0X94F4, 0X84B3, 0X8493, 0X8493, 0X7C72, 0X7C52, 0X84B3,
-  0X8CB3, 0X84B3, 0X8CF4, 0X9D35, 0X9D56, 0XA596, 0XADB7, 0XBE19,
-  0XBE18, 0XBE39, 0XBE39, 0XBE18, 0XB5F8, 0XADB7, 0X9D35, 0X9514,
-  0X8CD4, 0X84B3, 0X84B3, 0X8493, 0X8CD4, 0X9514, 0X9D56, 0X9D35,
-  0X8CF4, 0X7452, 0X63B0, 0X6BF1, 0X7431, 0X7C72, 0X8493, 0X84B3,
-  0X8CB3, 0X9515, 0X84B3, 0X7C72, 0XA596, 0XB5D8, 0XBE39, 0XC659,
-  0XCEBA, 0XDF1C, 0XD6DB, 0XB5F8, 0XA596, 0XA576, 0XA576, 0X9D55,
-  0X8493, 0X8493, 0X94F4, 0X9535, 0XADB7, 0XADB7, 0X9D56, 0X9D55,
-  0XADB7, 0XA576, 0XB5D7, 0XB5F8, 0XA597, 0XB618, 0XADB7, 0X9D56,
-  0X9515, 0X9515, 0X8CD4, 0X9D55, 0X9535, 0X8CD4, 0X8493, 0X7C72,
-  0X7C52, 0X7C72, 0X8493, 0XA596, 0X9515, 0X8CD4, 0X8CD4, 0X9515,
-  0X9515, 0XA596, 0XADB7, 0XB5D7, 0XB5F8, 0XBE18, 0XBE18, 0XB5F8,
-  0XB5F8, 0XB5F8, 0XB5D7, 0XB5D7, 0X9D56, 0X9515, 0X94F4, 0X8CD4,
-  0X84B3, 0X8CD4, 0X8CF4, 0X9514, 0X9D35, 0XADD7, 0XB5D7, 0XB5F8,
-  0XBE18, 0XADD7, 0X9D56, 0X9514, 0X94F4, 0X8CD4, 0X84B3, 0X84B3,
-  0X8CB3, 0X8CD4, 0X8CD4, 0X9535, 0X9D56, 0XADB7, 0XB5F8, 0XA576,
-  0XA597, 0XADD7, 0XB618, 0XBE39, 0XC67A, 0XC67A, 0XBE39, 0XB5F8,
-  0XADB7, 0XA596, 0X9D56, 0X9535, 0X9514, 0X8CF4, 0X94F4, 0X9515,
-  0X9D35, 0XA576, 0X9D56, 0XA597, 0XAD97, 0XA576, 0XA576, 0XA576,
-  0XA597, 0XADB7, 0XADB7, 0XA597, 0XADB7, 0XB5F8, 0XBE18, 0XBE39,
-  0XBE39, 0XBE19, 0XBE18, 0XB5F8, 0XADD7, 0X94F4, 0X8493, 0X8493,
-  0X8493, 0X8493, 0X8493, 0X84B3, 0X8CD4, 0X9D35, 0XAD97, 0XADB7,
-  0X9D56, 0X9515, 0X9D35, 0X9D35, 0X9D56, 0X9D56, 0X9D56, 0X9D56,
-  0XA576, 0XB5D7, 0XBE39, 0XC659, 0XBE39, 0XB5F8, 0XB5F8, 0XB5F8,
-  0XB618, 0XB5D8, 0XADB7, 0XADB7, 0XA576, 0XA576, 0X9D56, 0X9D56,
-  0X9D55, 0X9D35, 0X9D56, 0X9D56, 0XA576, 0XADB7, 0XB5F8, 0XB5F8,
-  0XB5D7, 0XA576, 0X9515, 0X9D56, 0X9D35, 0X8CD4, 0X8CD4, 0X8CD4,
-  0X9515, 0XA576, 0XA596, 0XA597, 0XA576, 0X9515, 0X84B3, 0X7C73,
-  0X7C72, 0X7411, 0X7411, 0X7432, 0X7411, 0X6BF1, 0X6C11, 0X6BF0,
-  0X7411, 0X8CF4, 0X9D35, 0X9D35, 0X9515, 0X8CD4, 0X8CD4, 0X9515,
-  0X94F4, 0X8CD4, 0X84B3, 0X94F4, 0X8CD4, 0X84B3, 0X8493, 0X8493,
-  0X8493, 0X8493, 0X8493, 0X7C72, 0X8493, 0X7C52, 0X7411, 0X7432,
-  0X7432, 0X7C73, 0X84B3, 0X84B3, 0X84B3, 0X8493, 0X8CF4, 0X8CD4,
-  0X7C52, 0X6BF0, 0X6BF0, 0X8CB3, 0X84B3, 0X84B3, 0X8CD4, 0X8CD4,
-  0X9D56, 0XADB7, 0XADB7, 0X9535, 0X8CB3, 0X84B3, 0X8CD4, 0X8CD4,
-  0X8493, 0X7C73, 0X7431, 0X638F, 0X5B2D, 0X426A, 0X7432, 0X8CF4,
-  0X8CD4, 0X8CD4, 0X9D56, 0X9515, 0X8CF4, 0X9535, 0X9D56, 0X9515,
-  0X84B3, 0X84B3, 0X8CB3, 0X8CD4, 0X8493, 0X7C72, 0X84B3, 0X7C72,
-  0X7452, 0X7411, 0X7432, 0X7C72, 0X8493, 0X8CF4, 0X8493, 0X63AF,
-  0X8493, 0X9D55, 0XA597, 0XA576, 0X9535, 0X84B3, 0X8CD4, 0X8CD4,
-  0X8CB3, 0X8CF4, 0X9D56, 0X9D35, 0X84B3, 0X7432, 0X6C11, 0X6BD0,
-  0X638F, 0X532D, 0X5B4E, 0X7411, 0X8493, 0X7C72, 0X7431, 0X9515,
-  0X9D56, 0XADB7, 0XB5F8, 0XADD7, 0X8CD4, 0X9D55, 0X9515, 0X8CD4,
-  0X7C72, 0X8CD4, 0X9515, 0X9D35, 0X9D56, 0X9D55, 0XA576, 0XADB7,
-  0XB5D7, 0XADB7, 0XADB7, 0XA597, 0XA576, 0XADB7, 0X8CB3, 0X6BF0,
-  0X6BD0, 0X6BD0, 0X6BD0, 0X7411, 0X7C52, 0X8CD4, 0X9D56, 0XA576,
-  0XA576, 0X9D35, 0X9514, 0X8CD4, 0X8CD4, 0X9D55, 0XA576, 0XA596,
-  0XA596, 0XA596, 0XA576, 0XA576, 0X9D35, 0X9514, 0X94F4, 0X9515,
-  0X9D35, 0X9D35, 0X9D35, 0X9D55, 0X9D56, 0X9515, 0X9514, 0X9D55,
-  0XA597, 0XB5D8, 0XADB7, 0XA576, 0X9515, 0X8CB3, 0X8493, 0X84B3,
-  0X8CD4, 0X8CF4, 0X8CF4, 0X9514, 0X8493, 0X7C72, 0X8493, 0X8493,
-  0X7C73, 0X8CD4, 0X8CD4, 0X8CD4, 0X94F4, 0XA576, 0XA576, 0XA596,
-  0XADB7, 0XB5D7, 0XB618, 0XC659, 0XC67A, 0XB5F8, 0XADB7, 0XA576,
-  0X9D35, 0X94F4, 0X84B3, 0X8493, 0X84B3, 0X8CB3, 0X84B3, 0X8CF4,
-  0X8CD4, 0X8CD4, 0X8493, 0X7C52, 0X6BF1, 0X6BF1, 0X6BF1, 0X8493,
-  0X9515, 0X8CF4, 0X8CD4, 0X8CD4, 0X84B3, 0X84B3, 0X9D35, 0XA597,
-  0XB5F8, 0XBE39, 0XC67A, 0XCEBA, 0XBE19, 0XA576, 0X9D56, 0X9515,
-  0X84B3, 0X7C72, 0X7C72, 0X8CB3, 0X8CF4, 0X9D35, 0XA596, 0X9D35,
-  0X9D35, 0XA576, 0XA596, 0XA597, 0XB5F8, 0XB5F8, 0XADB7, 0XADB7,
-  0XA596, 0X9D55, 0X9515, 0X9535, 0X84B3, 0X8CD4, 0X8CF4, 0X8CF4,
-  0X8493, 0X7432, 0X7452, 0X7C72, 0X8493, 0X84B3, 0X84B3, 0X8CB3,
-  0X94F4, 0X9D35, 0X8CD4, 0X9D35, 0XA596, 0XADB7, 0XB5F8, 0XBE18,
-  0XBE18, 0XB618, 0XB5D8, 0XB5F8, 0XADB7, 0XA596, 0X9D35, 0X9515,
-  0X8CF4, 0X94F4, 0X8CB3, 0X8CD4, 0X84B3, 0X9514, 0X9515, 0X9D56,
-  0XA597, 0XB5D7, 0XB5F8, 0XB5F8, 0XA576, 0X9515, 0X8CD4, 0X8493,
-  0X8493, 0X84B3, 0X84B3, 0X8CD4, 0X8CF4, 0X9D35, 0X9D56, 0XA596,
-  0XA597, 0XA576, 0XA596, 0XAD97, 0XB5D7, 0XBE18, 0XC659, 0XC659,
-  0XBE39, 0XB5F8, 0XADB7, 0XA597, 0XA576, 0X9D55, 0X9D35, 0X9515,
-  0X9515, 0X9515, 0X9535, 0XADB7, 0X9D55, 0X9D35, 0X9D56, 0X9D56,
-  0XA576, 0XADB7, 0XA576, 0XA576, 0XA576, 0XA597, 0XADB7, 0XBE19,
-  0XBE39, 0XBE18, 0XBE39, 0XBE39, 0XBE19, 0XB5F8, 0XA596, 0X9515,
-  0X84B3, 0X7C72, 0X7C52, 0X7432, 0X7C52, 0X7C72, 0X84B3, 0X9515,
-  0XA596, 0XADB7, 0X9D56, 0X9D55, 0X9D56, 0XA576, 0XA576, 0XA596,
-  0X9535, 0X9D35, 0X9D35, 0XA596, 0XB5F8, 0XBE39, 0XBE39, 0XB5F8,
-  0XADD7, 0XADB7, 0XAD97, 0XADB7, 0XADB7, 0XADB7, 0XA576, 0X9D35,
-  0X9D35, 0X9D56, 0X9D55, 0X9D55, 0X9D55, 0X9D35, 0X9D56, 0XAD97,
-  0XB5D7, 0XB5D7, 0XADB7, 0X9D55, 0X9515, 0X8CD4, 0X8CD4, 0X8CD4,
-  0X84B3, 0X8CD4, 0X9515, 0X9D56, 0XA576, 0XAD97, 0X9D56, 0X9515,
-  0X84B3, 0X8493, 0X7C72, 0X7432, 0X7432, 0X7431, 0X6BF0, 0X6BF0,
-  0X6BF1, 0X6BF1, 0X7C72, 0X94F4, 0X9D56, 0X9D35, 0X8CD4, 0X8CD4,
-  0X8CB3, 0X8CD4, 0X8CF4, 0X84B3, 0X8CB3, 0X8CD4, 0X84B3, 0X7C73,
-  0X7C73, 0X7C52, 0X8493, 0X8493, 0X8493, 0X8493, 0X8493, 0X7C72,
-  0X7411, 0X7C52, 0X7432, 0X7C73, 0X8CD4, 0X84B3, 0X84B3, 0X7432,
-  0X7C52, 0X84B3, 0X7411, 0X6BD0, 0X7452, 0X7C72, 0X7C73, 0X8493,
-  0X84B3, 0X8CD4, 0X9D56, 0XAD97, 0X9D56, 0X8CD4, 0X8493, 0X7C72,
-  0X7C52, 0X8493, 0X7C72, 0X7452, 0X6BF1, 0X63B0, 0X5B6E, 0X4ACB,
-  0X638F, 0X84B3, 0X8CD4, 0X8CD4, 0X9515, 0X8CD4, 0X8CD4, 0X9515,
-  0X9D35, 0X8CF4, 0X8493, 0X7C52, 0X7411, 0X7C72, 0X6BF0, 0X7C72,
-  0X7C52, 0X7411, 0X7411, 0X7C52, 0X7C72, 0X8493, 0X7C73, 0X7C72,
-  0X7452, 0X6BF0, 0X7C72, 0X9D35, 0XA576, 0X9D56, 0X9515, 0X8CB3,
-  0X8CB3, 0X8CB3, 0X8CD4, 0X8CD4, 0X9515, 0X9515, 0X84B3, 0X7431,
-  0X63AF, 0X6BD0, 0X6BF0, 0X5B6E, 0X6BD0, 0X7C72, 0X84B3, 0X8CF4,
-  0X94F4, 0X9515, 0X9D56, 0XADB7, 0XAD97, 0XAD97, 0X9D35, 0X9535,
-  0X8CD4, 0X8CD4, 0X8CF4, 0X8CD4, 0X8CD4, 0X9D35, 0X9D35, 0XA576,
-  0X9D55, 0XA576, 0XA596, 0X9D56, 0XA576, 0X9D55, 0X9D56, 0X9D35,
-  0X84B3, 0X7432, 0X6BF1, 0X7411, 0X7411, 0X7431, 0X7C72, 0X8CF4,
-  0X9D56, 0XA576, 0X9D56, 0X9515, 0X8CF4, 0X8CD4, 0X9515, 0X9D35,
-  0X9D35, 0X9D55, 0X9D56, 0X9D55, 0X9D56, 0X9D56, 0X9D35, 0X9515,
-  0X9515, 0X8CF4, 0X94F4, 0X8CD4, 0X9514, 0X9D35, 0X9D55, 0X9515,
-  0X9515, 0X9D35, 0XAD97, 0XADB7, 0XADB7, 0X9D35, 0X8CD4, 0X8CD4,
-  0X84B3, 0X8CB3, 0X8CD4, 0X9535, 0X9D56, 0X8CB3, 0X7431, 0X7411,
-  0X8493, 0X84B3, 0X8493, 0X8CB3, 0X8CD4, 0X8CD4, 0X9514, 0X9514,
-  0X9D56, 0XA576, 0XADB7, 0XB5F8, 0XB618, 0XBE39, 0XBE19, 0XB5D7,
-  0XADB7, 0XA576, 0X9515, 0X8CD4, 0X8493, 0X8CB3, 0X84B3, 0X8493,
-  0X84B3, 0X84B3, 0X8493, 0X7C73, 0X7C72, 0X7411, 0X63AF, 0X638F,
-  0X63B0, 0X7C72, 0X8493, 0X8CD4, 0X8493, 0X84B3, 0X8493, 0X8493,
-  0X8CF4, 0XA576, 0XB5F8, 0XB5F8, 0XB5F8, 0XBE18, 0XADB7, 0X9D35,
-  0X8CD4, 0X8CD4, 0X8493, 0X7C72, 0X8493, 0X84B3, 0X94F4, 0X9515,
-  0X9D35, 0X8CF4, 0X8CD4, 0X9D35, 0XAD97, 0X9D56, 0XADB7, 0XB5F8,
-  0XADB7, 0X9D35, 0X9D35, 0X9D55, 0X9D55, 0X9515, 0X7C72, 0X8CB3,
-  0X8CD4, 0X9515, 0X8493, 0X7431, 0X7C52, 0X7C72, 0X7C72, 0X8493,
-  0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X9514, 0X9515, 0X9D56, 0XA596,
-  0XB5D8, 0XB618, 0XBE39, 0XB5F8, 0XB5D7, 0XB618, 0XB5F8, 0X9D56,
-  0X8CF4, 0X8CD4, 0X8CF4, 0X9515, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4,
-  0X9514, 0X9D35, 0XA576, 0XADB7, 0XADD7, 0XB5D7, 0XA596, 0X9515,
-  0X8CD4, 0X8493, 0X84B3, 0X84B3, 0X8493, 0X84B3, 0X8CB3, 0X94F4,
-  0X9515, 0X9D56, 0X9D56, 0XA576, 0XA576, 0XA596, 0XADB7, 0XB5D8,
-  0XBE18, 0XBE39, 0XBE18, 0XB5D7, 0XADB7, 0XA596, 0XA576, 0X9D56,
-  0X9D55, 0X9D35, 0X9515, 0X9515, 0X9D35, 0X9D55, 0XA576, 0X9D56,
-  0X9D56, 0X9D35, 0X9D55, 0X9D56, 0X9D56, 0X9D56, 0X9D35, 0XA596,
-  0XADB7, 0XADB7, 0XB5D8, 0XB5D8, 0XBE19, 0XBE39, 0XBE18, 0XB5D8,
-  0XA597, 0X9514, 0X8493, 0X7C52, 0X6BF1, 0X6BF0, 0X63AF, 0X6C11,
-  0X7C72, 0X8CF4, 0XA576, 0XA597, 0XA576, 0X9D35, 0X9535, 0X9D56,
-  0X9D56, 0X9D56, 0X9D56, 0X9D55, 0X9515, 0X9535, 0XA576, 0XADD7,
-  0XB5F8, 0XADD7, 0XADB7, 0XA596, 0X9D35, 0X9D56, 0XA596, 0XADB7,
-  0X9D55, 0X9D35, 0X9D35, 0X9D56, 0X9515, 0X9535, 0X9515, 0X9D56,
-  0X9D55, 0XAD97, 0XADB7, 0XADD7, 0XA596, 0X9D35, 0X9514, 0X9515,
-  0X8CD4, 0X8493, 0X84B3, 0X94F4, 0X9D35, 0X9D55, 0X9D56, 0X9D56,
-  0X9D35, 0X8CD4, 0X84B3, 0X7C72, 0X7431, 0X6BF0, 0X6BD0, 0X6BD0,
-  0X63B0, 0X6BD0, 0X6BF0, 0X7432, 0X8493, 0X8CF4, 0X9D35, 0X9515,
-  0X8493, 0X84B3, 0X8CD4, 0X8CD4, 0X84B3, 0X8493, 0X8CD4, 0X8CD4,
-  0X84B3, 0X84B3, 0X8493, 0X7C52, 0X7431, 0X7C72, 0X8493, 0X7C72,
-  0X7C72, 0X6BD0, 0X63AF, 0X7452, 0X8493, 0X8CB3, 0X9514, 0X8CF4,
-  0X8CD4, 0X6BF0, 0X6BF0, 0X7C73, 0X8493, 0X7452, 0X7C72, 0X7411,
-  0X6BF1, 0X84B3, 0X8CD4, 0X9515, 0X9D56, 0XA596, 0X9515, 0X84B3,
-  0X7C72, 0X6BF0, 0X7431, 0X7C52, 0X7C52, 0X7452, 0X7431, 0X6C11,
-  0X6BD0, 0X638F, 0X638F, 0X7411, 0X7C72, 0X8493, 0X8493, 0X8493,
-  0X84B3, 0X9535, 0X9D35, 0X8CD4, 0X8493, 0X7C72, 0X7411, 0X6BF1,
-  0X6BD0, 0X7432, 0X7432, 0X6BD0, 0X7411, 0X7C72, 0X84B3, 0X8493,
-  0X7411, 0X7431, 0X7431, 0X7C72, 0X84B3, 0X9D35, 0XA596, 0XA576,
-  0X9515, 0X8493, 0X7C73, 0X8493, 0X8493, 0X84B3, 0X8CD4, 0X8CB3,
-  0X7C52, 0X6BF0, 0X638F, 0X6BD0, 0X6BD0, 0X63AF, 0X638F, 0X7C52,
-  0X8CD4, 0X9D35, 0X9D55, 0X9D56, 0X9D55, 0XA597, 0X9D56, 0X9D35,
-  0X9D35, 0X9514, 0X8CB3, 0X8493, 0X84B3, 0X7431, 0X7432, 0X8CF4,
-  0X9D56, 0X9D56, 0X9D35, 0X9D56, 0XA576, 0X9D35, 0XA576, 0XA576,
-  0X9D35, 0X94F4, 0X8CB3, 0X7C72, 0X7C52, 0X8493, 0X8493, 0X7C52,
-  0X8493, 0X8CF4, 0X9D56, 0X9D56, 0X9535, 0X9515, 0X84B3, 0X94F4,
-  0X9D56, 0X9D35, 0X9D35, 0X9514, 0X9D35, 0XA576, 0X9D56, 0X9535,
-  0X8CD4, 0X94F4, 0X9515, 0X94F4, 0X8CF4, 0X8CF4, 0X9515, 0X9515,
-  0X9535, 0X9D56, 0X9515, 0X9D35, 0XA596, 0XADB7, 0XAD97, 0X9D35,
-  0X8CD4, 0X8493, 0X7411, 0X7C52, 0X8493, 0X7C72, 0X9515, 0X8CD4,
-  0X7C72, 0X7C52, 0X8493, 0X8493, 0X8493, 0X8CD4, 0X8CD4, 0X8CD4,
-  0X8CF4, 0X9D55, 0X9D56, 0X9D55, 0XA596, 0XADD7, 0XBE39, 0XADB7,
-  0XADB7, 0XB5D8, 0XA597, 0X9D35, 0X8CF4, 0X8CD4, 0X84B3, 0X8CB3,
-  0X84B3, 0X8493, 0X7C72, 0X7C52, 0X7431, 0X7C52, 0X7432, 0X6C11,
-  0X638F, 0X638F, 0X638F, 0X7432, 0X8493, 0X8493, 0X84B3, 0X8CB3,
-  0X8CD4, 0X8CD4, 0X9D55, 0XADB7, 0XB5D7, 0XB5F8, 0XB5F8, 0XAD97,
-  0XA576, 0X9515, 0X94F4, 0X84B3, 0X8493, 0X8493, 0X7C72, 0X7452,
-  0X84B3, 0X8CD4, 0X8493, 0X8CD4, 0X8CD4, 0X9515, 0X9D55, 0X9D35,
-  0X9D56, 0XA576, 0XA597, 0XAD97, 0XA576, 0X9D56, 0X9D35, 0X9514,
-  0X8493, 0X84B3, 0X8CB3, 0X8CD4, 0X8493, 0X7C72, 0X7432, 0X7452,
-  0X8493, 0X8493, 0X84B3, 0X8CB3, 0X8CD4, 0X8CD4, 0X8CF4, 0X9515,
-  0X9D35, 0XA597, 0XAD97, 0XB5F8, 0XBE18, 0XB5F8, 0XB5D7, 0XADD7,
-  0XADD7, 0XA576, 0X8CF4, 0X94F4, 0X8CD4, 0X94F4, 0X9515, 0X8CD4,
-  0X8CF4, 0X8CD4, 0X8CF4, 0X9D56, 0XA576, 0XADB7, 0XADB7, 0XB5F8,
-  0XA576, 0X9514, 0X84B3, 0X7C72, 0X8493, 0X84B3, 0X8493, 0X84B3,
-  0X84B3, 0X8CD4, 0X8CF4, 0X9514, 0X9535, 0XA576, 0XA596, 0XADB7,
-  0XADB7, 0XB5D8, 0XBE19, 0XBE39, 0XB5F8, 0XADD7, 0XADB7, 0X9D56,
-  0X9535, 0X9D55, 0X9D35, 0X9515, 0X9515, 0X9515, 0X9515, 0X9D35,
-  0X9D55, 0X9D35, 0X9D35, 0X9515, 0X9D35, 0X9D55, 0X9D35, 0X9535,
-  0X9515, 0X9D56, 0XA596, 0XA576, 0XA576, 0XA596, 0XADB7, 0XB5F8,
-  0XB5F8, 0XADB7, 0XA576, 0X94F4, 0X8493, 0X7C52, 0X6BF0, 0X638F,
-  0X638F, 0X6BD0, 0X7C52, 0X8CD4, 0XA576, 0XA597, 0XA576, 0X9515,
-  0X8CF4, 0X9D55, 0X9D35, 0X9D56, 0X9D35, 0X9535, 0X8CF4, 0X9515,
-  0X9D56, 0XAD97, 0XB5D8, 0XADD7, 0XB5F8, 0X9D56, 0X8CF4, 0X8CF4,
-  0X9D35, 0X9D56, 0X9D35, 0X9D35, 0X9515, 0X8CF4, 0X8493, 0X8493,
-  0X8CD4, 0X9515, 0X9D35, 0XA576, 0XADB7, 0XA597, 0XA576, 0X9535,
-  0X9514, 0X9514, 0X9514, 0X8CD4, 0X8CD4, 0X94F4, 0X9D35, 0X9D35,
-  0X9D35, 0X9D35, 0X9515, 0X8CD4, 0X8493, 0X7C52, 0X6BD0, 0X63AF,
-  0X63AF, 0X63B0, 0X6BD0, 0X6BD0, 0X6BF1, 0X7C52, 0X8CD4, 0X9515,
-  0X9515, 0X8CD4, 0X84B3, 0X8493, 0X8493, 0X84B3, 0X84B3, 0X84B3,
-  0X84B3, 0X84B3, 0X8493, 0X7C72, 0X7C52, 0X7C72, 0X7452, 0X7C72,
-  0X7C72, 0X7C73, 0X7C73, 0X7432, 0X7411, 0X7431, 0X84B3, 0X8CF4,
-  0XA576, 0X9515, 0X94F4, 0X84B3, 0X7432, 0X7C72, 0X84B3, 0X7C52,
-  0X84B3, 0X8493, 0X7C72, 0X8493, 0X8CB3, 0X9514, 0X9D55, 0X9D55,
-  0X94F4, 0X8CB3, 0X7C72, 0X63AF, 0X6BF0, 0X7452, 0X8493, 0X8493,
-  0X7C52, 0X7C72, 0X7432, 0X6BF0, 0X7431, 0X7432, 0X7452, 0X7432,
-  0X7C72, 0X8493, 0X8CD4, 0X8CF4, 0X94F4, 0X8CD4, 0X8493, 0X7C52,
-  0X7411, 0X6BF0, 0X6BF0, 0X7432, 0X7432, 0X7411, 0X6C11, 0X7431,
-  0X7C52, 0X7432, 0X63B0, 0X5B4E, 0X6C11, 0X7C52, 0X8CF4, 0X9D56,
-  0XA576, 0X9D56, 0X9515, 0X84B3, 0X7C72, 0X7C72, 0X7C72, 0X8493,
-  0X84B3, 0X7C72, 0X6BF0, 0X63AF, 0X7411, 0X63B0, 0X638F, 0X5B2D,
-  0X5B2D, 0X6BF0, 0X8CD4, 0X9D56, 0X9D56, 0XA576, 0XA596, 0X9D56,
-  0X8CF4, 0X9515, 0X9535, 0X9515, 0X8CD4, 0X8493, 0X7C72, 0X7C52,
-  0X7C72, 0X84B3, 0X9514, 0X9515, 0XAD97, 0XA576, 0X9D56, 0X9D35,
-  0XA576, 0XA576, 0X9535, 0X9535, 0X8CF4, 0X8493, 0X7C72, 0X8493,
-  0X8493, 0X8493, 0X8CB3, 0X9515, 0XA576, 0X9D56, 0X9515, 0X9514,
-  0X8CD4, 0X8493, 0XA596, 0X9D35, 0X9D35, 0X8CB3, 0X9D35, 0XA576,
-  0XA576, 0X9D35, 0X94F4, 0X94F4, 0X8CF4, 0X8CD4, 0X8CD4, 0X94F4,
-  0X94F4, 0X9515, 0X8CF4, 0X9515, 0X9D35, 0XA576, 0XA596, 0XADB7,
-  0XA576, 0X9D35, 0X8CD4, 0X8493, 0X7C72, 0X7C52, 0X7C72, 0X7C72,
-  0X84B3, 0X84B3, 0X7411, 0X6BF0, 0X8493, 0X84B3, 0X94F4, 0X8CD4,
-  0X8CB3, 0X84B3, 0X8CF4, 0X9D35, 0X9D56, 0XAD97, 0XB5F8, 0XB5F8,
-  0XADB7, 0X9D35, 0X8CD4, 0X9515, 0X94F4, 0X8CF4, 0X8CF4, 0X8CD4,
-  0X8CB3, 0X8493, 0X7C72, 0X7C52, 0X7C52, 0X6BF1, 0X638F, 0X6BF0,
-  0X7411, 0X7C52, 0X6C11, 0X6BD0, 0X6BF0, 0X6BF0, 0X7C72, 0X7C72,
-  0X8493, 0X8CD4, 0X84B3, 0X94F4, 0XA576, 0XADB7, 0XB5D7, 0XB5D7,
-  0XADB7, 0XA576, 0X9D35, 0X9535, 0X8CF4, 0X7C72, 0X7C52, 0X7432,
-  0X7C72, 0X84B3, 0X8493, 0X8493, 0X7C52, 0X8493, 0X84B3, 0X9515,
-  0X9D35, 0X9D35, 0X9D35, 0XA576, 0XA597, 0XA597, 0X9D56, 0XA576,
-  0X9D55, 0X8CD4, 0X8CF4, 0X84B3, 0X84B3, 0X84B3, 0X7C72, 0X7C72,
-  0X7C52, 0X7C72, 0X8493, 0X7C72, 0X7C52, 0X8493, 0X8CD4, 0X8CD4,
-  0X94F4, 0X8CD4, 0X9515, 0X9D56, 0XA596, 0XADB7, 0XB5F8, 0XB5F8,
-  0XADB7, 0XADB7, 0XA597, 0X9515, 0X8CD4, 0X8CF4, 0X8CD4, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X9515, 0X9D35, 0X9D56, 0X9D56, 0XA576,
-  0XAD97, 0XAD97, 0X9D56, 0X8CF4, 0X8CB3, 0X7C52, 0X7C52, 0X8493,
-  0X84B3, 0X84B3, 0X84B3, 0X8493, 0X8CD4, 0X9515, 0X9535, 0XA576,
-  0XA576, 0XA596, 0XAD97, 0XADB7, 0XB5F8, 0XB5F8, 0XB5F8, 0XADB7,
-  0XA596, 0X9535, 0X8CF4, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CB3,
-  0X8CD4, 0X9514, 0X94F4, 0X8CF4, 0X8CF4, 0X8CD4, 0X9514, 0X9514,
-  0X94F4, 0X94F4, 0X8CF4, 0X9515, 0X9515, 0X9515, 0X9D55, 0XADB7,
-  0XADB7, 0XB5D8, 0XB5D8, 0XADB7, 0X9D56, 0X8CD4, 0X8493, 0X7C52,
-  0X6BF0, 0X638F, 0X636E, 0X5B6E, 0X6BD0, 0X84B3, 0X9D35, 0X9D56,
-  0X9D35, 0X9515, 0X9515, 0X9515, 0X9514, 0X9535, 0X9515, 0X9515,
-  0X8CD4, 0X9515, 0XA596, 0XADB7, 0XADB7, 0XAD97, 0X9D56, 0X9515,
-  0X9515, 0X8CF4, 0X9D35, 0X9D35, 0X94F4, 0X84B3, 0X7C73, 0X7431,
-  0X63AF, 0X7411, 0X7432, 0X8493, 0X9514, 0X9D56, 0XA576, 0XA596,
-  0X9D56, 0X9514, 0X8CD4, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X94F4,
-  0X9515, 0X9515, 0X8CD4, 0X84B3, 0X84B3, 0X8493, 0X7C52, 0X7432,
-  0X7432, 0X6BF0, 0X63AF, 0X638F, 0X5B6E, 0X63AF, 0X7431, 0X84B3,
-  0X9514, 0X9D35, 0X9D35, 0X8CD4, 0X8493, 0X7452, 0X7C72, 0X7C73,
-  0X7431, 0X8493, 0X7C72, 0X7452, 0X7411, 0X7431, 0X7C73, 0X7C52,
-  0X7432, 0X7411, 0X7C72, 0X8493, 0X7C72, 0X6BF0, 0X7C52, 0X7C72,
-  0X8CD4, 0X9D35, 0XA576, 0X9D35, 0X9514, 0X84B3, 0X7C52, 0X7431,
-  0X7431, 0X7432, 0X7C72, 0X7C73, 0X8493, 0X84B3, 0X84B3, 0X8CD4,
-  0X9515, 0X9D35, 0X8CD4, 0X8493, 0X7C72, 0X7431, 0X7C52, 0X7C52,
-  0X7C73, 0X8493, 0X84B3, 0X7432, 0X7452, 0X7431, 0X7432, 0X7411,
-  0X6BD0, 0X7411, 0X7C72, 0X8493, 0X8CD4, 0X9515, 0X8CF4, 0X8CD4,
-  0X7C72, 0X7431, 0X6BF0, 0X6C11, 0X7431, 0X7432, 0X7411, 0X7411,
-  0X6C11, 0X6BF1, 0X6C11, 0X7411, 0X5B4E, 0X424A, 0X638F, 0X7432,
-  0X9D35, 0X9D56, 0X9D56, 0X9D56, 0X9515, 0X84B3, 0X7431, 0X7431,
-  0X7432, 0X7431, 0X8493, 0X7C52, 0X7411, 0X63AF, 0X7452, 0X63AF,
-  0X638F, 0X638F, 0X5B4E, 0X638F, 0X7C52, 0X8CF4, 0X9515, 0X9D35,
-  0X9D35, 0X9515, 0X9514, 0X9514, 0X9514, 0X8493, 0X7411, 0X7432,
-  0X7452, 0X7431, 0X6BF0, 0X6BD0, 0X8493, 0X9515, 0X9535, 0X9515,
-  0X84B3, 0X8CD4, 0X8CF4, 0X8CF4, 0X8CD4, 0X8CD4, 0X8CF4, 0X8CD4,
-  0X8CD4, 0X84B3, 0X7C52, 0X8493, 0X8CD4, 0X9515, 0XA596, 0XA576,
-  0X9D35, 0X8CF4, 0X8CF4, 0X8CF4, 0X9535, 0X9515, 0X8CD4, 0X8CD4,
-  0X9515, 0X9D56, 0XA576, 0X9D56, 0X9515, 0X8CD4, 0X84B3, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X84B3, 0X84B3, 0X84B3, 0X8CD4, 0X9D35, 0XA576,
-  0XA597, 0XA596, 0XA576, 0X9535, 0X8CD4, 0X7432, 0X7431, 0X7432,
-  0X7431, 0X6C11, 0X8CB3, 0X8493, 0X7C52, 0X7C72, 0X8493, 0X84B3,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X8CF4, 0X9D35, 0XA576, 0XADB7,
-  0XB5F8, 0XADB7, 0X9D56, 0X8CF4, 0X7C72, 0X7C72, 0X8CD4, 0X8CD4,
-  0X8CD4, 0X8493, 0X84B3, 0X7C73, 0X7C52, 0X7452, 0X7432, 0X6BF0,
-  0X6BF0, 0X638F, 0X6BD0, 0X7431, 0X7411, 0X6BF0, 0X6BD0, 0X6BD0,
-  0X7C52, 0X7C72, 0X7C73, 0X84B3, 0X8CB3, 0X8CF4, 0XA576, 0XADB7,
-  0XADB7, 0XADD7, 0XADB7, 0X9D55, 0X9515, 0X8CF4, 0X7C72, 0X7431,
-  0X7C52, 0X7C52, 0X7C72, 0X7C72, 0X7C72, 0X84B3, 0X8CD4, 0X7C72,
-  0X8CD4, 0X8CF4, 0X8CB3, 0X8CD4, 0X8CF4, 0X9D35, 0X9D56, 0X9D56,
-  0X9535, 0X9D35, 0X9D35, 0X9515, 0X8CD4, 0X8CD4, 0X8CB3, 0X84B3,
-  0X84B3, 0X7C52, 0X7432, 0X7411, 0X7431, 0X7C52, 0X7C72, 0X8493,
-  0X8493, 0X8493, 0X8CD4, 0X8CD4, 0X8CF4, 0X9D35, 0XA597, 0XADB7,
-  0XB5D7, 0XADB7, 0XADD7, 0XA596, 0X9D35, 0X8CF4, 0X8CD4, 0X8CD4,
-  0X84B3, 0X84B3, 0X8CF4, 0X8CD4, 0X84B3, 0X8CF4, 0X9515, 0XA576,
-  0X9D55, 0X9D35, 0XA597, 0XADB7, 0XA596, 0X9515, 0X8CB3, 0X7C73,
-  0X7C52, 0X8493, 0X84B3, 0X8493, 0X84B3, 0X8CD4, 0X9515, 0X9515,
-  0X9515, 0X9515, 0X9D35, 0X9D56, 0XA576, 0XA597, 0XADD7, 0XB5D8,
-  0XB5D7, 0XAD97, 0X9D35, 0X9514, 0X8CD4, 0X8CB3, 0X84B3, 0X8493,
-  0X8493, 0X8493, 0X7C72, 0X8493, 0X8493, 0X8493, 0X84B3, 0X8CD4,
-  0X8CF4, 0X8CD4, 0X8CD4, 0X84B3, 0X84B3, 0X84B3, 0X8CD4, 0X8CF4,
-  0X9515, 0X9D35, 0XA576, 0XADB7, 0XADB7, 0XA597, 0X9D55, 0X8CF4,
-  0X7C72, 0X7411, 0X6BD0, 0X5B4E, 0X5B4E, 0X5B4E, 0X6BD0, 0X8493,
-  0X8CF4, 0X9515, 0X9515, 0X8CD4, 0X8CD4, 0X8CD4, 0X8493, 0X8CD4,
-  0X8CF4, 0X8CF4, 0X9514, 0X9D56, 0XADB7, 0XA596, 0XA596, 0XA596,
-  0X9D35, 0X9515, 0X8CF4, 0X8CD4, 0X8CD4, 0X84B3, 0X7C52, 0X6BF1,
-  0X7411, 0X638F, 0X6BF0, 0X6BF1, 0X7452, 0X8493, 0X8CD4, 0X9515,
-  0X9D56, 0XA576, 0X9535, 0X8CD4, 0X8493, 0X7C72, 0X8CB3, 0X8CF4,
-  0X8CD4, 0X8CF4, 0X94F4, 0X8CD4, 0X84B3, 0X7C52, 0X7C72, 0X7C72,
-  0X7C52, 0X7432, 0X7432, 0X6BF0, 0X638F, 0X5B4E, 0X638F, 0X6BD0,
-  0X7C72, 0X8CD4, 0X9D35, 0X9D35, 0X94F4, 0X84B3, 0X8493, 0X7C52,
-  0X7C52, 0X7411, 0X6BF0, 0X7431, 0X7C52, 0X7C72, 0X7C72, 0X7452,
-  0X6BF1, 0X7431, 0X7431, 0X7411, 0X7411, 0X7452, 0X6BF0, 0X6BF0,
-  0X5B4E, 0X7411, 0X84B3, 0XA576, 0X9D56, 0X9535, 0X8CF4, 0X8493,
-  0X7C52, 0X7C72, 0X7431, 0X7C52, 0X7C72, 0X8493, 0X8493, 0X8493,
-  0X7C73, 0X8493, 0X84B3, 0X8CF4, 0X8CD4, 0X84B3, 0X7C52, 0X7C72,
-  0X7C72, 0X8493, 0X7C52, 0X7C52, 0X7C52, 0X7432, 0X7C52, 0X7452,
-  0X7C52, 0X7411, 0X6C11, 0X7C52, 0X8493, 0X84B3, 0X8CD4, 0X9515,
-  0X94F4, 0X84B3, 0X7C52, 0X7411, 0X6C11, 0X6BF0, 0X6BF1, 0X7431,
-  0X7C52, 0X7432, 0X63AF, 0X638F, 0X63B0, 0X638F, 0X638F, 0X63AF,
-  0X6BD0, 0X7C52, 0X9515, 0XA576, 0X9D56, 0X9D35, 0X9515, 0X84B3,
-  0X7452, 0X6C11, 0X6BF0, 0X7431, 0X7C52, 0X7431, 0X6BF1, 0X6BD0,
-  0X6BF0, 0X63AF, 0X5B6E, 0X5B2D, 0X5B6E, 0X5B4E, 0X7411, 0X8CD4,
-  0X9515, 0X9515, 0X8CD4, 0X8CF4, 0X8CD4, 0X8CB3, 0X94F4, 0X7452,
-  0X63B0, 0X63AF, 0X7411, 0X7452, 0X6BD0, 0X5B4E, 0X7432, 0X9535,
-  0X9D35, 0X8493, 0X7C73, 0X7C73, 0X7C72, 0X8493, 0X84B3, 0X8CD4,
-  0X9515, 0X9514, 0X8CD4, 0X8493, 0X6BF0, 0X7C72, 0X84B3, 0X9515,
-  0XA576, 0X9D56, 0X9515, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X84B3,
-  0X8493, 0X84B3, 0X8CD4, 0X9D35, 0X9D56, 0X9D35, 0X8CF4, 0X8493,
-  0X8493, 0X84B3, 0X8CD4, 0X8CB3, 0X8493, 0X7432, 0X7C72, 0X8CD4,
-  0X9515, 0XA576, 0XA576, 0XA576, 0X9D35, 0X8CD4, 0X84B3, 0X7C72,
-  0X7431, 0X63B0, 0X638F, 0X5B6E, 0X6BF0, 0X7411, 0X7C72, 0X8493,
-  0X7C72, 0X8493, 0X7C72, 0X7C72, 0X84B3, 0X8CD4, 0X94F4, 0X9D55,
-  0XA576, 0XA596, 0XA596, 0X9D56, 0X94F4, 0X8CD4, 0X84B3, 0X7C52,
-  0X7C73, 0X8493, 0X7C72, 0X7C72, 0X84B3, 0X8493, 0X7C52, 0X7C72,
-  0X7C52, 0X7411, 0X7431, 0X7411, 0X6BF0, 0X7411, 0X6C11, 0X6BF0,
-  0X6BF0, 0X6BF1, 0X7C52, 0X8493, 0X8493, 0X8493, 0X8493, 0X84B3,
-  0X9515, 0XA576, 0XA597, 0XA596, 0X9D56, 0X9515, 0X8CD4, 0X8CD4,
-  0X8CD4, 0X8493, 0X7C72, 0X8493, 0X7C52, 0X7431, 0X7432, 0X7432,
-  0X7C72, 0X8CB3, 0X7C72, 0X8493, 0X84B3, 0X7C72, 0X84B3, 0X8CD4,
-  0X94F4, 0X9D55, 0X9514, 0X9514, 0X9514, 0X9515, 0X8CD4, 0X8CD4,
-  0X84B3, 0X84B3, 0X84B3, 0X7C52, 0X7431, 0X7431, 0X7C52, 0X7C52,
-  0X7C72, 0X7C72, 0X8493, 0X84B3, 0X84B3, 0X8CD4, 0X9514, 0X9D35,
-  0XA576, 0XADB7, 0XB5F8, 0XB5D7, 0XAD97, 0X9D56, 0X9515, 0X8CD4,
-  0X8CB3, 0X84B3, 0X8493, 0X8493, 0X8CD4, 0X8493, 0X84B3, 0X8CD4,
-  0X8CF4, 0X84B3, 0X9515, 0X9514, 0X9D55, 0XA576, 0XA576, 0X9515,
-  0X84B3, 0X7C52, 0X7431, 0X7411, 0X8493, 0X84B3, 0X8CD4, 0X8CD4,
-  0X94F4, 0X9515, 0X8CF4, 0X9515, 0X9535, 0X9515, 0X9D35, 0X9D55,
-  0XAD97, 0XADB7, 0XADB7, 0XA576, 0X9515, 0X8CD4, 0X84B3, 0X8493,
-  0X8493, 0X84B3, 0X84B3, 0X7C72, 0X7C52, 0X7C72, 0X7452, 0X7C72,
-  0X8493, 0X8CD4, 0X9514, 0X8CF4, 0X8CB3, 0X8493, 0X7C73, 0X7C72,
-  0X7C73, 0X8493, 0X84B3, 0X8CF4, 0XA576, 0XA576, 0XA576, 0X9D56,
-  0X8CD4, 0X8493, 0X7432, 0X6BF0, 0X6BD0, 0X636E, 0X5B2D, 0X5B2D,
-  0X63B0, 0X7452, 0X84B3, 0X8CF4, 0X8CF4, 0X8CB3, 0X7C52, 0X8493,
-  0X7C72, 0X8493, 0X84B3, 0X8CD4, 0X9515, 0X9D56, 0XA596, 0XA596,
-  0XA576, 0X9D56, 0X9515, 0X8CF4, 0X84B3, 0X8493, 0X7C73, 0X7432,
-  0X7411, 0X63B0, 0X63AF, 0X63AF, 0X63B0, 0X6C11, 0X7432, 0X7C73,
-  0X8CD4, 0X9515, 0X9D35, 0X9D56, 0X9515, 0X8CD4, 0X84B3, 0X8493,
-  0X8493, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X8493, 0X7C52, 0X7C52,
-  0X7C52, 0X7C52, 0X7452, 0X7431, 0X6BF1, 0X63AF, 0X5B6E, 0X5B4E,
-  0X636E, 0X6BF0, 0X7C72, 0X8CD4, 0X9515, 0X9515, 0X8CD4, 0X8493,
-  0X7452, 0X6BD0, 0X63AF, 0X7411, 0X638F, 0X638F, 0X7431, 0X6C11,
-  0X7411, 0X7432, 0X7431, 0X7411, 0X6BF0, 0X6BF1, 0X7411, 0X6BF0,
-  0X6BD0, 0X7432, 0X6BF1, 0X7C52, 0X84B3, 0X9D35, 0X9D35, 0X9514,
-  0X8CB3, 0X7C72, 0X7431, 0X6BF1, 0X6BF1, 0X7411, 0X7431, 0X7C52,
-  0X7411, 0X6BF0, 0X7C52, 0X7C72, 0X8493, 0X8CD4, 0X8CF4, 0X8CB3,
-  0X7431, 0X6BF0, 0X6BF0, 0X7452, 0X7431, 0X7411, 0X63B0, 0X63AF,
-  0X7411, 0X7411, 0X6BF0, 0X6BD0, 0X63B0, 0X7431, 0X8493, 0X8CD4,
-  0X9514, 0X9515, 0X94F4, 0X84B3, 0X7C52, 0X7431, 0X7411, 0X7411,
-  0X7411, 0X7431, 0X7431, 0X7432, 0X6BD0, 0X638F, 0X636E, 0X5B6E,
-  0X5B2D, 0X63AF, 0X6BF1, 0X7C72, 0X94F4, 0X9535, 0X9D35, 0X9515,
-  0X8CF4, 0X84B3, 0X7411, 0X5B2D, 0X638F, 0X63AF, 0X6BD0, 0X7411,
-  0X6BF1, 0X6BD0, 0X6BF1, 0X6BD0, 0X638F, 0X636E, 0X5B4E, 0X5B4E,
-  0X6BD0, 0X7C72, 0X8CD4, 0X8CD4, 0X84B3, 0X7C73, 0X7C52, 0X7C52,
-  0X7452, 0X6BF1, 0X6BD0, 0X6BF0, 0X6BD0, 0X6BD0, 0X638F, 0X6BD0,
-  0X7411, 0X7C52, 0X7C73, 0X7C52, 0X7432, 0X6BF0, 0X7C52, 0X6C11,
-  0X7431, 0X8CD4, 0X84B3, 0X8493, 0X84B3, 0X7C73, 0X7411, 0X7C72,
-  0X8CB3, 0X9515, 0X9D56, 0X9D35, 0X8CF4, 0X84B3, 0X8CB3, 0X8CB3,
-  0X8CB3, 0X8CF4, 0X8CD4, 0X8CD4, 0X94F4, 0X9535, 0X9D35, 0X9535,
-  0X8CD4, 0X84B3, 0X7C52, 0X7C72, 0X7C72, 0X7C72, 0X7C52, 0X7C52,
-  0X7C72, 0X8CD4, 0X9515, 0XA576, 0XA576, 0X9D55, 0X9515, 0X8CD4,
-  0X7C72, 0X7432, 0X6BF0, 0X638F, 0X532D, 0X52EC, 0X532D, 0X638F,
-  0X7411, 0X8493, 0X7C52, 0X7432, 0X7432, 0X7C52, 0X7C52, 0X8CD4,
-  0X9515, 0X9D55, 0XA576, 0XA576, 0X9D56, 0X9515, 0X8493, 0X7C72,
-  0X8493, 0X7C72, 0X7C72, 0X8493, 0X8493, 0X8493, 0X7C72, 0X7C52,
-  0X8493, 0X84B3, 0X84B3, 0X7C72, 0X7C52, 0X7431, 0X6BD0, 0X7C52,
-  0X7431, 0X6BF0, 0X6BD0, 0X63AF, 0X6BD0, 0X7C52, 0X7C73, 0X7C73,
-  0X7C52, 0X84B3, 0X8CD4, 0X9515, 0X9D35, 0X9D35, 0X9D35, 0X9515,
-  0X8CD4, 0X8CF4, 0X84B3, 0X7C72, 0X7431, 0X7432, 0X6BF0, 0X6BD0,
-  0X7411, 0X6C11, 0X7431, 0X7C52, 0X7432, 0X7432, 0X7432, 0X7C72,
-  0X84B3, 0X84B3, 0X8CD4, 0X94F4, 0X8CF4, 0X94F4, 0X9515, 0X9515,
-  0X9515, 0X8CD4, 0X84B3, 0X84B3, 0X8493, 0X7C73, 0X7452, 0X6BD0,
-  0X6C11, 0X7432, 0X7452, 0X7432, 0X7411, 0X7432, 0X7C52, 0X7C72,
-  0X84B3, 0X8CF4, 0X9D35, 0XA576, 0XADB7, 0XADB7, 0XA576, 0X9D35,
-  0X9515, 0X8CD4, 0X8493, 0X7C52, 0X6BF1, 0X6BF1, 0X7411, 0X7452,
-  0X8493, 0X8CB3, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X8CF4, 0X9535,
-  0X9515, 0X94F4, 0X8493, 0X6BF0, 0X638F, 0X6BF0, 0X7431, 0X7C52,
-  0X7C52, 0X7C72, 0X7C73, 0X8493, 0X8493, 0X8493, 0X84B3, 0X8CB3,
-  0X8CD4, 0X9515, 0X9D55, 0X9D56, 0X9D56, 0X9D35, 0X8CF4, 0X8493,
-  0X8493, 0X7C73, 0X7C52, 0X7C73, 0X7C72, 0X7411, 0X7432, 0X7432,
-  0X7432, 0X7C72, 0X8493, 0X8CD4, 0X8CF4, 0X94F4, 0X8CD4, 0X8493,
-  0X7C52, 0X7411, 0X7411, 0X7411, 0X7431, 0X8CB3, 0X9515, 0X9515,
-  0X9D35, 0X9514, 0X8CD4, 0X7C72, 0X7431, 0X6C11, 0X6BD0, 0X5B2D,
-  0X5B4E, 0X5B4E, 0X638F, 0X6BF0, 0X7C73, 0X8CD4, 0X8CD4, 0X8CD4,
-  0X8493, 0X7C52, 0X7C52, 0X7C52, 0X7C52, 0X8493, 0X8CD4, 0X9514,
-  0X9D35, 0X9D35, 0X9D55, 0X9D35, 0X9515, 0X8493, 0X7411, 0X7411,
-  0X7411, 0X6BD0, 0X63AF, 0X638F, 0X5B4E, 0X5B2D, 0X5B6E, 0X63AF,
-  0X7411, 0X7C72, 0X8CB3, 0X94F4, 0X9515, 0X94F4, 0X84B3, 0X7C72,
-  0X7C52, 0X7C52, 0X7C73, 0X8493, 0X8493, 0X84B3, 0X84B3, 0X7C72,
-  0X7452, 0X7431, 0X6BF1, 0X6BF0, 0X6BF0, 0X7411, 0X6BF1, 0X63AF,
-  0X638F, 0X5B4E, 0X638F, 0X6BD0, 0X7452, 0X84B3, 0X8CD4, 0X8CF4,
-  0X8CB3, 0X7C72, 0X7411, 0X63AF, 0X638F, 0X63B0, 0X63B0, 0X638F,
-  0X6BF1, 0X6BD0, 0X5B4E, 0X6BD0, 0X6BD0, 0X6BD0, 0X63AF, 0X6BF0,
-  0X7411, 0X6C11, 0X6BD0, 0X63AF, 0X6BF1, 0X7C72, 0X8CB3, 0X8CF4,
-  0X8CF4, 0X84B3, 0X7C72, 0X7411, 0X6BF0, 0X6BD0, 0X6BD0, 0X6BF0,
-  0X63AF, 0X6BD0, 0X7431, 0X7432, 0X7411, 0X7411, 0X7C52, 0X84B3,
-  0X8CB3, 0X8493, 0X7411, 0X63AF, 0X6BD0, 0X6BD0, 0X6BD0, 0X7431,
-  0X6BD0, 0X6BD0, 0X63AF, 0X638F, 0X5B6E, 0X5B4E, 0X63AF, 0X7431,
-  0X7C72, 0X8CD4, 0X8CF4, 0X9515, 0X8CD4, 0X8493, 0X7452, 0X7411,
-  0X6BF1, 0X6C11, 0X7411, 0X7411, 0X7411, 0X7411, 0X6BD0, 0X63AF,
-  0X63AF, 0X5B2D, 0X63AF, 0X5B6E, 0X638F, 0X7431, 0X84B3, 0X9514,
-  0X9515, 0X9515, 0X8CF4, 0X8493, 0X7432, 0X63AF, 0X636E, 0X63AF,
-  0X63AF, 0X6BD0, 0X6BD0, 0X6BD0, 0X6BD0, 0X63AF, 0X638F, 0X5B2D,
-  0X530C, 0X5B4E, 0X638F, 0X6BF0, 0X7C72, 0X84B3, 0X8CD4, 0X84B3,
-  0X7C72, 0X7432, 0X6C11, 0X638F, 0X636E, 0X636E, 0X638F, 0X5B6E,
-  0X5B2D, 0X5B6E, 0X638F, 0X638F, 0X638F, 0X6C11, 0X7411, 0X7431,
-  0X7431, 0X6BD0, 0X7432, 0X8CD4, 0X8493, 0X7431, 0X7C73, 0X7452,
-  0X7432, 0X7C52, 0X84B3, 0X9515, 0X9515, 0X9515, 0X8CD4, 0X8493,
-  0X8493, 0X8493, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X8CF4, 0X8CF4,
-  0X9514, 0X8CD4, 0X84B3, 0X8493, 0X7411, 0X7411, 0X7C52, 0X7431,
-  0X6BF0, 0X7411, 0X7C52, 0X8493, 0X8CD4, 0X9D35, 0X9D35, 0X9515,
-  0X8CD4, 0X8493, 0X7C52, 0X6BF1, 0X638F, 0X638F, 0X4ACB, 0X426A,
-  0X4ACC, 0X638F, 0X638F, 0X63B0, 0X6BF1, 0X7431, 0X7431, 0X7432,
-  0X7C72, 0X8493, 0X94F4, 0X9535, 0X9D56, 0X9D56, 0X9515, 0X8CD4,
-  0X84B3, 0X8493, 0X84B3, 0X7C52, 0X7C52, 0X7C72, 0X7C72, 0X7C52,
-  0X7C72, 0X7C72, 0X8493, 0X8CD4, 0X8CD4, 0X84B3, 0X7C72, 0X7431,
-  0X7411, 0X6BF1, 0X6BD0, 0X63AF, 0X6BD0, 0X7411, 0X7432, 0X7432,
-  0X7432, 0X7C52, 0X6C11, 0X7C72, 0X8493, 0X8CF4, 0X9515, 0X9515,
-  0X9515, 0X8CB3, 0X8493, 0X7C72, 0X7431, 0X7431, 0X7411, 0X6BD0,
-  0X6BD0, 0X638F, 0X638F, 0X638F, 0X63AF, 0X6BF0, 0X638F, 0X638F,
-  0X6BF1, 0X7411, 0X7432, 0X8493, 0X8CB3, 0X8CF4, 0X9515, 0X9514,
-  0X8CF4, 0X8CF4, 0X8CF4, 0X8CD4, 0X8493, 0X7C72, 0X7C72, 0X7452,
-  0X7432, 0X7411, 0X6BD0, 0X6BF0, 0X6BF0, 0X6BF0, 0X63AF, 0X6BD0,
-  0X7431, 0X7432, 0X8493, 0X8CD4, 0X8CF4, 0X9515, 0X9D35, 0X9D55,
-  0X9D35, 0X9535, 0X8CF4, 0X84B3, 0X7C72, 0X7411, 0X6BD0, 0X5B6E,
-  0X6BD0, 0X7411, 0X7C72, 0X84B3, 0X8493, 0X7C72, 0X8493, 0X84B3,
-  0X8CF4, 0X9515, 0X8CF4, 0X84B3, 0X7431, 0X63AF, 0X638F, 0X6BD0,
-  0X6BD0, 0X7411, 0X7411, 0X7411, 0X7432, 0X7432, 0X7431, 0X7452,
-  0X7C72, 0X7C72, 0X84B3, 0X94F4, 0X9515, 0X9D35, 0X9535, 0X8CF4,
-  0X84B3, 0X7C52, 0X7432, 0X6C11, 0X7411, 0X6BD0, 0X6BD0, 0X6BD0,
-  0X6BF0, 0X6BD0, 0X6BF1, 0X7431, 0X7C52, 0X8493, 0X84B3, 0X8CD4,
-  0X84B3, 0X7C52, 0X7411, 0X6BD0, 0X6BD0, 0X6BD0, 0X7411, 0X8493,
-  0X8CB3, 0X8CD4, 0X94F4, 0X8CD4, 0X8493, 0X7C72, 0X7452, 0X7431,
-  0X6BD0, 0X638F, 0X5B6E, 0X5B4E, 0X530C, 0X63AF, 0X7411, 0X8493,
-  0X84B3, 0X84B3, 0X8493, 0X7C72, 0X7C52, 0X7431, 0X7432, 0X7432,
-  0X7C72, 0X8493, 0X84B3, 0X8CD4, 0X8CD4, 0X8CD4, 0X9514, 0X8493,
-  0X7432, 0X7411, 0X6BF1, 0X63B0, 0X636E, 0X638F, 0X638F, 0X5B6E,
-  0X638F, 0X6BF0, 0X7431, 0X7C52, 0X84B3, 0X8CD4, 0X8CD4, 0X84B3,
-  0X8493, 0X7432, 0X7411, 0X7431, 0X7C52, 0X8493, 0X8493, 0X8493,
-  0X7C52, 0X7452, 0X7411, 0X6BF1, 0X63B0, 0X638F, 0X638F, 0X63AF,
-  0X5B6E, 0X5B4E, 0X532D, 0X532D, 0X5B2D, 0X636E, 0X6BF0, 0X7C72,
-  0X8CB3, 0X8CD4, 0X84B3, 0X7C72, 0X7411, 0X63AF, 0X6BD0, 0X638F,
-  0X638F, 0X638F, 0X6BF0, 0X6BF1, 0X63B0, 0X63AF, 0X63AF, 0X63AF,
-  0X638F, 0X6BD0, 0X6BD0, 0X6BD0, 0X5B2D, 0X636E, 0X6BD0, 0X7C52,
-  0X8493, 0X84B3, 0X8493, 0X7452, 0X6C11, 0X63AF, 0X63AF, 0X638F,
-  0X638F, 0X638F, 0X638F, 0X63B0, 0X7411, 0X6C11, 0X6BD0, 0X6C11,
-  0X7C52, 0X8493, 0X8493, 0X7C72, 0X7432, 0X6BF0, 0X638F, 0X638F,
-  0X63AF, 0X6BF0, 0X63AF, 0X63AF, 0X638F, 0X5B2D, 0X52EC, 0X530D,
-  0X5B6E, 0X6BD0, 0X7431, 0X8493, 0X8CB3, 0X8CD4, 0X8CB3, 0X8493,
-  0X7411, 0X6BD0, 0X6BF0, 0X6BD0, 0X6BD0, 0X6BF1, 0X6BF0, 0X63B0,
-  0X638F, 0X5B4E, 0X5B2D, 0X532D, 0X532D, 0X532D, 0X638F, 0X7432,
-  0X8493, 0X8CF4, 0X9515, 0X8CF4, 0X8CD4, 0X7C72, 0X6BF0, 0X638F,
-  0X5B2D, 0X5B4E, 0X530D, 0X638F, 0X638F, 0X5B6E, 0X5B4E, 0X638F,
-  0X5B6E, 0X52EC, 0X4ACC, 0X4ACC, 0X52EC, 0X5B2D, 0X6BD0, 0X7C52,
-  0X84B3, 0X8CD4, 0X84B3, 0X7432, 0X6BF0, 0X5B4E, 0X530C, 0X5B2D,
-  0X5B2D, 0X52EC, 0X530D, 0X5B2D, 0X5B4E, 0X532D, 0X5B2D, 0X638F,
-  0X638F, 0X6BF0, 0X6BF0, 0X6BF0, 0X6C11, 0X7432, 0X7C52, 0X7C52,
-  0X7431, 0X7411, 0X7411, 0X7C52, 0X8493, 0X8CF4, 0X9515, 0X94F4,
-  0X8CD4, 0X7C73, 0X7C72, 0X7C52, 0X7C52, 0X8493, 0X8493, 0X84B3,
-  0X8CB3, 0X8CD4, 0X8CD4, 0X8CB3, 0X8CB3, 0X8493, 0X7452, 0X6BF0,
-  0X6C11, 0X6BF0, 0X6BD0, 0X6BD0, 0X7431, 0X7C73, 0X8CD4, 0X94F4,
-  0X9514, 0X8CD4, 0X84B3, 0X8493, 0X7C52, 0X63B0, 0X532D, 0X4ACB,
-  0X426A, 0X4ACC, 0X5B2D, 0X638F, 0X6BD0, 0X63AF, 0X6BF0, 0X63AF,
-  0X6BF0, 0X6BF0, 0X7432, 0X7C52, 0X84B3, 0X94F4, 0X9515, 0X9515,
-  0X8CF4, 0X84B3, 0X7C52, 0X7411, 0X6BF1, 0X6BF0, 0X7411, 0X7C52,
-  0X7C52, 0X7C52, 0X7C72, 0X7C72, 0X84B3, 0X8CD4, 0X8CD4, 0X84B3,
-  0X7C72, 0X7C52, 0X7431, 0X6BD0, 0X6BD0, 0X63AF, 0X6BD0, 0X6BD0,
-  0X7411, 0X6C11, 0X7411, 0X6BD0, 0X636E, 0X63B0, 0X7C72, 0X84B3,
-  0X8CD4, 0X8CD4, 0X8CD4, 0X8493, 0X7452, 0X7411, 0X7431, 0X6BF1,
-  0X6BD0, 0X638F, 0X636E, 0X5B4E, 0X532D, 0X530D, 0X532D, 0X5B4E,
-  0X5B6E, 0X63AF, 0X63AF, 0X6BD0, 0X7431, 0X7C72, 0X84B3, 0X8CD4,
-  0X8CF4, 0X8CD4, 0X8CD4, 0X8CD4, 0X84B3, 0X8493, 0X7C72, 0X7432,
-  0X7431, 0X7411, 0X7411, 0X7411, 0X7411, 0X7411, 0X6BD0, 0X6BD0,
-  0X6BD0, 0X6BF0, 0X6C11, 0X7432, 0X7452, 0X7C72, 0X8493, 0X8CD4,
-  0X94F4, 0X9515, 0X9514, 0X94F4, 0X8CD4, 0X8493, 0X7C52, 0X7432,
-  0X6BF0, 0X638F, 0X5B6E, 0X5B4E, 0X6BD0, 0X7432, 0X7C73, 0X8493,
-  0X8493, 0X8493, 0X9514, 0X94F4, 0X8493, 0X7C52, 0X7411, 0X6BD0,
-  0X638F, 0X63AF, 0X638F, 0X63AF, 0X6BF0, 0X7411, 0X7411, 0X6BF1,
-  0X6BF0, 0X7431, 0X6C11, 0X7411, 0X7C72, 0X8CB3, 0X8CF4, 0X9514,
-  0X94F4, 0X8CD4, 0X8493, 0X7431, 0X6BD0, 0X6BD0, 0X63AF, 0X5B6E,
-  0X5B6E, 0X5B6E, 0X636E, 0X5B6E, 0X63AF, 0X6BF0, 0X7411, 0X7452,
-  0X7C52, 0X7C72, 0X7432, 0X6BF1, 0X6BF0, 0X6BD0, 0X6BD0, 0X6BD0,
-  0X7411, 0X7C52, 0X8493, 0X8CD4, 0X8CD4, 0X84B3, 0X8493, 0X7452,
-  0X7411, 0X6C11, 0X6BD0, 0X638F, 0X5B6E, 0X5B2D, 0X530D, 0X5B4E,
-  0X6BD0, 0X7432, 0X7C52, 0X7C52, 0X7C52, 0X7411, 0X6BF1, 0X6BD0,
-  0X7411, 0X6BF0, 0X6BF1, 0X7411, 0X7C52, 0X7C72, 0X8493, 0X8493,
-  0X8493, 0X8493, 0X7431, 0X6BF0, 0X6BD0, 0X63AF, 0X638F, 0X5B6E,
-  0X636E, 0X63AF, 0X638F, 0X6BD0, 0X7411, 0X7C52, 0X8493, 0X8493,
-  0X8493, 0X7C72, 0X7431, 0X6BF1, 0X6BF1, 0X7411, 0X7411, 0X8493,
-  0X7432, 0X7411, 0X7411, 0X7411, 0X63B0, 0X638F, 0X636E, 0X638F,
-  0X638F, 0X638F, 0X638F, 0X5B4E, 0X5B4E, 0X5B2D, 0X532D, 0X5B4E,
-  0X6BD0, 0X7411, 0X7C52, 0X8493, 0X84B3, 0X7C72, 0X7431, 0X63B0,
-  0X5B6E, 0X5B2D, 0X5B6E, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B6E, 0X5B6E,
-  0X5B4E, 0X5B2D, 0X4A8B, 0X530D, 0X638F, 0X63AF, 0X530C, 0X5B2D,
-  0X63AF, 0X7431, 0X7C72, 0X7C72, 0X7431, 0X6BF0, 0X63AF, 0X638F,
-  0X5B6E, 0X5B4E, 0X5B2D, 0X5B4E, 0X5B4E, 0X5B4E, 0X63AF, 0X6C11,
-  0X63B0, 0X6BD0, 0X7411, 0X7C52, 0X7C72, 0X7C72, 0X7411, 0X6BD0,
-  0X638F, 0X638F, 0X5B2D, 0X5B4E, 0X638F, 0X636E, 0X532D, 0X530C,
-  0X4AAB, 0X52EC, 0X530D, 0X5B6E, 0X63B0, 0X7431, 0X7C73, 0X8493,
-  0X8493, 0X7C72, 0X7411, 0X63AF, 0X638F, 0X5B4E, 0X63AF, 0X6BD0,
-  0X63AF, 0X638F, 0X5B4E, 0X5B2D, 0X5B2D, 0X52EC, 0X4AAB, 0X5B4E,
-  0X63AF, 0X7411, 0X7C72, 0X84B3, 0X8CD4, 0X84B3, 0X8CB3, 0X7C52,
-  0X63AF, 0X638F, 0X530D, 0X532D, 0X5B4E, 0X638F, 0X5B6E, 0X5B4E,
-  0X5B2D, 0X530C, 0X52EC, 0X5B2D, 0X4ACC, 0X4ACC, 0X4AAB, 0X4ACC,
-  0X5B6E, 0X6C11, 0X8493, 0X8CD4, 0X8CB3, 0X7C72, 0X6BF0, 0X5B2D,
-  0X52EC, 0X52EC, 0X530D, 0X4ACC, 0X4AAB, 0X52EC, 0X4ACC, 0X4AAB,
-  0X530D, 0X4AAB, 0X4AAB, 0X638F, 0X7411, 0X7432, 0X7431, 0X7432,
-  0X7432, 0X7431, 0X6C11, 0X6BF0, 0X6BF1, 0X7C52, 0X8493, 0X8CD4,
-  0X8CD4, 0X8CD4, 0X8493, 0X7431, 0X6BD0, 0X63AF, 0X5B6E, 0X7C72,
-  0X7C72, 0X7C72, 0X84B3, 0X84B3, 0X8493, 0X7C73, 0X8493, 0X7C73,
-  0X7432, 0X6BF0, 0X63AF, 0X6BD0, 0X63B0, 0X638F, 0X6BD0, 0X7432,
-  0X8493, 0X8CD4, 0X8CF4, 0X8CD4, 0X84B3, 0X7C52, 0X6BF0, 0X638F,
-  0X532D, 0X4AAB, 0X426A, 0X52EC, 0X530C, 0X5B2D, 0X5B4E, 0X532D,
-  0X532D, 0X5B2D, 0X5B2D, 0X5B6E, 0X63AF, 0X6BD0, 0X7C72, 0X8CD4,
-  0X8CF4, 0X8CD4, 0X8CD4, 0X7C72, 0X7411, 0X6BD0, 0X63AF, 0X638F,
-  0X6BF0, 0X7431, 0X7C52, 0X7431, 0X7411, 0X7431, 0X8493, 0X84B3,
-  0X8493, 0X7C52, 0X7411, 0X6BF0, 0X6BD0, 0X6BD0, 0X638F, 0X5B6E,
-  0X638F, 0X638F, 0X63AF, 0X63AF, 0X6BD0, 0X5B6E, 0X638F, 0X638F,
-  0X6BD0, 0X7C72, 0X8493, 0X8493, 0X7C52, 0X7432, 0X6BD0, 0X5B4E,
-  0X4AAB, 0X5B2D, 0X530D, 0X530D, 0X530D, 0X530C, 0X530D, 0X52EC,
-  0X52EC, 0X532D, 0X5B4E, 0X5B4E, 0X5B6E, 0X638F, 0X6BD0, 0X6BF0,
-  0X7C52, 0X84B3, 0X8CB3, 0X8CD4, 0X8CD4, 0X8CB3, 0X7C73, 0X7C52,
-  0X6BF0, 0X63AF, 0X63AF, 0X636E, 0X6BD0, 0X6BD0, 0X6BD0, 0X63AF,
-  0X638F, 0X638F, 0X638F, 0X63AF, 0X6BF0, 0X7411, 0X7431, 0X7432,
-  0X8493, 0X84B3, 0X8CD4, 0X8CD4, 0X8CF4, 0X8CD4, 0X8493, 0X7C72,
-  0X7431, 0X6BD0, 0X63AF, 0X5B6E, 0X532D, 0X530D, 0X5B6E, 0X6BD0,
-  0X7432, 0X7C73, 0X7C72, 0X8493, 0X8493, 0X7C52, 0X7452, 0X6BF1,
-  0X638F, 0X638F, 0X5B4E, 0X638F, 0X638F, 0X638F, 0X63AF, 0X6BF0,
-  0X6BD0, 0X63B0, 0X6BD0, 0X63AF, 0X638F, 0X638F, 0X6BF0, 0X7C72,
-  0X84B3, 0X8CB3, 0X84B3, 0X8493, 0X7432, 0X638F, 0X638F, 0X5B6E,
-  0X5B2D, 0X530D, 0X530C, 0X4ACC, 0X4ACB, 0X530D, 0X5B4E, 0X5B6E,
-  0X63AF, 0X6BD0, 0X6BD0, 0X63AF, 0X638F, 0X5B4E, 0X5B2D, 0X5B4E,
-  0X5B6E, 0X63AF, 0X6BF0, 0X7411, 0X7C72, 0X84B3, 0X8CB3, 0X8493,
-  0X7C52, 0X6BF0, 0X6C11, 0X6BF0, 0X63B0, 0X636E, 0X5B4E, 0X5B2D,
-  0X5B2D, 0X530D, 0X5B4E, 0X638F, 0X6BD0, 0X63B0, 0X638F, 0X638F,
-  0X63AF, 0X6BD0, 0X6BD0, 0X63AF, 0X638F, 0X63AF, 0X6BD0, 0X6BF0,
-  0X7431, 0X7432, 0X7431, 0X7431, 0X6BF0, 0X6BD0, 0X63AF, 0X638F,
-  0X638F, 0X638F, 0X638F, 0X638F, 0X63AF, 0X638F, 0X63AF, 0X7411,
-  0X7C72, 0X7C52, 0X7431, 0X6BD0, 0X638F, 0X638F, 0X63AF, 0X6BD0,
-  0X6BF1, 0X6BD0, 0X6BD0, 0X63B0, 0X63AF, 0X638F, 0X5B4E, 0X5B4E,
-  0X638F, 0X5B4E, 0X5B4E, 0X5B2D, 0X5B4E, 0X532D, 0X530C, 0X52EC,
-  0X52EC, 0X530C, 0X52EC, 0X5B4E, 0X638F, 0X6BF0, 0X7411, 0X6BF0,
-  0X6BD0, 0X63AF, 0X5B6E, 0X530D, 0X532D, 0X5B6E, 0X5B4E, 0X52EC,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB, 0X4AAB, 0X52EC, 0X530D, 0X5B2D,
-  0X52EC, 0X52EC, 0X636E, 0X6BF0, 0X7431, 0X7431, 0X6C11, 0X6BD0,
-  0X636E, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B4E, 0X5B2D, 0X5B2D, 0X5B2D,
-  0X532D, 0X636E, 0X638F, 0X63AF, 0X6BD0, 0X7411, 0X7432, 0X7431,
-  0X6BD0, 0X638F, 0X5B4E, 0X530D, 0X532D, 0X5B4E, 0X530C, 0X4ACC,
-  0X4AAB, 0X4ACB, 0X4AAB, 0X4AAB, 0X52EC, 0X532D, 0X5B2D, 0X63AF,
-  0X7411, 0X7452, 0X7C52, 0X7411, 0X6BD0, 0X5B4E, 0X5B4E, 0X5B4E,
-  0X5B4E, 0X5B4E, 0X5B2D, 0X532D, 0X5B2D, 0X5B4E, 0X532D, 0X4ACC,
-  0X426A, 0X532D, 0X636E, 0X6BF0, 0X7C52, 0X8493, 0X84B3, 0X7C72,
-  0X7431, 0X63AF, 0X5B4E, 0X5B2D, 0X530D, 0X532D, 0X5B4E, 0X5B6E,
-  0X5B2D, 0X5B2D, 0X530D, 0X52EC, 0X4ACC, 0X52EC, 0X52EC, 0X4AAB,
-  0X4AAB, 0X4ACC, 0X5B4E, 0X6BD0, 0X7452, 0X8493, 0X7C73, 0X7452,
-  0X63AF, 0X52EC, 0X4ACB, 0X52EC, 0X4ACB, 0X4ACB, 0X52EC, 0X52EC,
-  0X52EC, 0X4ACC, 0X52EC, 0X4AAB, 0X4ACB, 0X5B4E, 0X6BD0, 0X6BF0,
-  0X6C11, 0X63AF, 0X63AF, 0X6BD0, 0X6BF0, 0X6BD0, 0X638F, 0X7411,
-  0X7C52, 0X7C73, 0X8493, 0X7C73, 0X7452, 0X6BD0, 0X5B4E, 0X5B4E,
-  0X6BD0, 0X7431, 0X7C52, 0X7C52, 0X7C72, 0X7C72, 0X7C52, 0X7C72,
-  0X8493, 0X7C72, 0X7411, 0X63B0, 0X638F, 0X636E, 0X636E, 0X5B6E,
-  0X638F, 0X6BD0, 0X7C72, 0X8493, 0X84B3, 0X8493, 0X7C52, 0X6BF0,
-  0X5B4E, 0X532D, 0X52EC, 0X426A, 0X3A49, 0X426A, 0X424A, 0X4249,
-  0X424A, 0X426A, 0X428B, 0X4ACB, 0X530C, 0X52EC, 0X530C, 0X638F,
-  0X7411, 0X7C73, 0X84B3, 0X84B3, 0X8493, 0X7432, 0X63B0, 0X5B6E,
-  0X638F, 0X638F, 0X63AF, 0X6BF0, 0X6BF0, 0X6BD0, 0X638F, 0X6BF0,
-  0X7432, 0X7C72, 0X7C72, 0X7432, 0X6BF0, 0X638F, 0X5B4E, 0X636E,
-  0X5B2D, 0X530D, 0X5B4E, 0X5B2D, 0X5B4E, 0X5B2D, 0X5B6E, 0X636E,
-  0X638F, 0X5B4E, 0X63AF, 0X6C11, 0X7452, 0X7432, 0X7411, 0X7431,
-  0X6BD0, 0X5B2D, 0X52EC, 0X4ACC, 0X4ACC, 0X4ACC, 0X4ACC, 0X52EC,
-  0X52EC, 0X4ACB, 0X52EC, 0X5B2D, 0X530D, 0X4A8B, 0X532D, 0X5B2D,
-  0X5B6E, 0X6BD0, 0X7431, 0X7C52, 0X7C72, 0X8493, 0X8493, 0X7C72,
-  0X7C52, 0X7411, 0X63B0, 0X638F, 0X5B4E, 0X5B6E, 0X63AF, 0X6BD0,
-  0X63AF, 0X638F, 0X5B4E, 0X636E, 0X638F, 0X638F, 0X63AF, 0X6BD0,
-  0X6BF0, 0X6BF0, 0X7411, 0X7C72, 0X8493, 0X84B3, 0X84B3, 0X8493,
-  0X7C72, 0X7432, 0X6BD0, 0X5B4E, 0X638F, 0X5B6E, 0X530D, 0X4ACC,
-  0X5B4E, 0X7411, 0X638F, 0X6BD0, 0X7432, 0X7431, 0X6BD0, 0X6C11,
-  0X6BF1, 0X638F, 0X5B4E, 0X530D, 0X52EC, 0X638F, 0X638F, 0X5B6E,
-  0X636E, 0X638F, 0X636E, 0X636E, 0X5B4E, 0X5B4E, 0X638F, 0X638F,
-  0X6BD0, 0X7411, 0X7C52, 0X8493, 0X8493, 0X7C52, 0X6BF1, 0X638F,
-  0X5B2D, 0X52EC, 0X52EC, 0X52EC, 0X4ACB, 0X4A8B, 0X4ACB, 0X52EC,
-  0X532D, 0X532D, 0X532D, 0X532D, 0X5B2D, 0X530D, 0X4AAB, 0X428B,
-  0X4ACB, 0X52EC, 0X52EC, 0X5B4E, 0X5B6E, 0X6BD0, 0X7411, 0X7C52,
-  0X7C72, 0X7452, 0X6BF1, 0X6BD0, 0X63AF, 0X63AF, 0X638F, 0X636E,
-  0X5B4E, 0X5B2D, 0X52EC, 0X530C, 0X532D, 0X5B2D, 0X532D, 0X530D,
-  0X530D, 0X5B2D, 0X5B4E, 0X5B4E, 0X638F, 0X638F, 0X5B4E, 0X5B4E,
-  0X5B6E, 0X5B4E, 0X5B4E, 0X636E, 0X5B4E, 0X638F, 0X638F, 0X5B4E,
-  0X5B4E, 0X5B6E, 0X5B6E, 0X5B2D, 0X532D, 0X5B6E, 0X638F, 0X638F,
-  0X6BD0, 0X6BF0, 0X7411, 0X7411, 0X7411, 0X638F, 0X5B4E, 0X5B2D,
-  0X5B4E, 0X5B6E, 0X5B6E, 0X5B2D, 0X638F, 0X6C11, 0X63AF, 0X5B4E,
-  0X530D, 0X532D, 0X5B2D, 0X532D, 0X52EC, 0X52EC, 0X52EC, 0X52EC,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB, 0X4ACB, 0X4ACB, 0X52EC, 0X532D,
-  0X5B4E, 0X5B6E, 0X636E, 0X5B4E, 0X5B2D, 0X530D, 0X5B2D, 0X5B2D,
-  0X532D, 0X4ACB, 0X428A, 0X428A, 0X426A, 0X426A, 0X428B, 0X4AAB,
-  0X4ACB, 0X4AAB, 0X4AAB, 0X4ACC, 0X5B4E, 0X63AF, 0X6BD0, 0X6BF0,
-  0X6BF0, 0X63B0, 0X638F, 0X5B4E, 0X5B2D, 0X532D, 0X532D, 0X530D,
-  0X52EC, 0X4ACC, 0X52EC, 0X530D, 0X5B4E, 0X5B6E, 0X63AF, 0X6BF0,
-  0X7411, 0X7411, 0X6BD0, 0X638F, 0X5B2D, 0X530C, 0X4ACC, 0X52EC,
-  0X530C, 0X52EC, 0X4AAB, 0X4249, 0X426A, 0X428B, 0X428B, 0X4A8B,
-  0X52EC, 0X5B6E, 0X63B0, 0X6BF0, 0X6C11, 0X6BD0, 0X5B4E, 0X530C,
-  0X4ACB, 0X52EC, 0X52EC, 0X530C, 0X52EC, 0X4ACB, 0X4AAB, 0X4ACB,
-  0X4AAB, 0X428A, 0X428A, 0X424A, 0X4ACC, 0X638F, 0X7411, 0X7432,
-  0X7C72, 0X7432, 0X6BD0, 0X638F, 0X5B2D, 0X532D, 0X5B2D, 0X4ACB,
-  0X4AAB, 0X5B2D, 0X5B2D, 0X52EC, 0X4AAB, 0X4ACB, 0X52EC, 0X4ACB,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X530C, 0X636E, 0X6BF0, 0X7411,
-  0X6C11, 0X7411, 0X5B2D, 0X4AAB, 0X4AAB, 0X4ACB, 0X4AAB, 0X428A,
-  0X4AAB, 0X4ACC, 0X4ACC, 0X426A, 0X428B, 0X4A8B, 0X426A, 0X4ACC,
-  0X636E, 0X636E, 0X638F, 0X638F, 0X5B4E, 0X6BD0, 0X638F, 0X6BD0,
-  0X6BF0, 0X6BF0, 0X6BD0, 0X6BD0, 0X6BD0, 0X6BD0, 0X638F, 0X5B4E,
-  0X5B2D, 0X52EC, 0X5B4E, 0X63AF, 0X6BF0, 0X7C52, 0X7C52, 0X7432,
-  0X7431, 0X6BF1, 0X7431, 0X7C73, 0X6BF0, 0X638F, 0X5B2D, 0X638F,
-  0X5B6E, 0X530D, 0X532D, 0X638F, 0X7431, 0X7C73, 0X7C72, 0X7C52,
-  0X6BF0, 0X636E, 0X52EC, 0X4A8B, 0X428B, 0X426A, 0X3A29, 0X3A29,
-  0X31E8, 0X31E8, 0X31E8, 0X3A08, 0X3A08, 0X424A, 0X52EC, 0X530D,
-  0X530C, 0X5B4E, 0X63AF, 0X7431, 0X7C72, 0X7C72, 0X7432, 0X6BD0,
-  0X5B4E, 0X5B2D, 0X532D, 0X52EC, 0X5B4E, 0X636E, 0X5B4E, 0X532D,
-  0X52EC, 0X5B4E, 0X6BF0, 0X6C11, 0X6C11, 0X6BF0, 0X638F, 0X5B6E,
-  0X5B6E, 0X5B4E, 0X52EC, 0X4ACB, 0X52EC, 0X530D, 0X532D, 0X530C,
-  0X52EC, 0X5B2D, 0X52EC, 0X530D, 0X5B6E, 0X63AF, 0X6BF0, 0X6BF0,
-  0X6BD0, 0X63AF, 0X5B2D, 0X52EC, 0X4ACB, 0X4ACC, 0X4ACB, 0X52EC,
-  0X4ACC, 0X52EC, 0X4ACC, 0X4AAB, 0X4AAB, 0X4AAB, 0X428B, 0X426A,
-  0X4AAB, 0X52EC, 0X5B2D, 0X636E, 0X638F, 0X6BD0, 0X6C11, 0X7411,
-  0X7411, 0X7411, 0X6BF0, 0X63AF, 0X5B4E, 0X5B4E, 0X5B4E, 0X636E,
-  0X5B6E, 0X5B6E, 0X636E, 0X5B2D, 0X530D, 0X532D, 0X530D, 0X5B4E,
-  0X5B6E, 0X636E, 0X63AF, 0X63AF, 0X6BF0, 0X7431, 0X7C52, 0X7C72,
-  0X7C72, 0X7C52, 0X7432, 0X6BF0, 0X638F, 0X530D, 0X5B2D, 0X5B2D,
-  0X530C, 0X52EC, 0X4AAB, 0X5B4E, 0X5B4E, 0X638F, 0X6BD0, 0X63AF,
-  0X638F, 0X6BF0, 0X5B2D, 0X424A, 0X4AAB, 0X4AAB, 0X5B6E, 0X63AF,
-  0X5B4E, 0X5B6E, 0X5B4E, 0X530D, 0X5B2D, 0X5B4E, 0X5B4E, 0X5B4E,
-  0X52EC, 0X530D, 0X638F, 0X6BD0, 0X7411, 0X7C52, 0X7C52, 0X7C52,
-  0X7411, 0X638F, 0X532D, 0X4ACC, 0X4A8B, 0X4AAB, 0X4AAB, 0X428A,
-  0X4AAB, 0X4AAB, 0X52EC, 0X52EC, 0X52EC, 0X52EC, 0X530D, 0X530C,
-  0X4AAB, 0X428A, 0X428B, 0X52EC, 0X4AAB, 0X4ACC, 0X52EC, 0X5B2D,
-  0X636E, 0X63B0, 0X6BF0, 0X6BD0, 0X638F, 0X5B4E, 0X5B4E, 0X638F,
-  0X636E, 0X532D, 0X530D, 0X52EC, 0X4A8B, 0X4ACB, 0X52EC, 0X530D,
-  0X530D, 0X530D, 0X52EC, 0X52EC, 0X5B2D, 0X5B4E, 0X5B4E, 0X5B4E,
-  0X5B2D, 0X5B2D, 0X532D, 0X52EC, 0X52EC, 0X530D, 0X530D, 0X5B6E,
-  0X5B6E, 0X52EC, 0X52EC, 0X5B4E, 0X5B4E, 0X5B2D, 0X532D, 0X5B4E,
-  0X5B4E, 0X638F, 0X638F, 0X63B0, 0X63B0, 0X638F, 0X638F, 0X636E,
-  0X5B4E, 0X530D, 0X530D, 0X52EC, 0X52EC, 0X532D, 0X5B2D, 0X5B2D,
-  0X52EC, 0X52EC, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X426A, 0X424A,
-  0X426A, 0X428B, 0X426A, 0X424A, 0X426A, 0X426A, 0X426A, 0X424A,
-  0X428A, 0X4AAB, 0X4ACB, 0X530C, 0X5B2D, 0X5B4E, 0X5B4E, 0X5B2D,
-  0X530C, 0X530C, 0X52EC, 0X4ACB, 0X4AAB, 0X428B, 0X424A, 0X428A,
-  0X4AAB, 0X4ACC, 0X4A8B, 0X4A8B, 0X4AAB, 0X52EC, 0X530D, 0X638F,
-  0X6BF0, 0X6BF0, 0X6BF0, 0X63AF, 0X5B4E, 0X532D, 0X52EC, 0X4ACC,
-  0X4ACB, 0X4ACB, 0X4AAB, 0X428A, 0X4AAB, 0X4ACB, 0X530D, 0X5B4E,
-  0X638F, 0X63B0, 0X6BD0, 0X6BD0, 0X63B0, 0X5B6E, 0X5B6E, 0X52EC,
-  0X4A8B, 0X426A, 0X4AAB, 0X4AAB, 0X428A, 0X3A29, 0X3A08, 0X4249,
-  0X4A8B, 0X4A8B, 0X4ACB, 0X5B2D, 0X63AF, 0X6BD0, 0X6BD0, 0X638F,
-  0X532D, 0X52EC, 0X52EC, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4A8B,
-  0X426A, 0X428B, 0X426A, 0X31E8, 0X3A49, 0X3A29, 0X426A, 0X5B2D,
-  0X63AF, 0X6C11, 0X7432, 0X6BF0, 0X63AF, 0X5B4E, 0X530C, 0X4AAB,
-  0X426A, 0X424A, 0X4A8B, 0X4AAB, 0X4ACB, 0X4ACB, 0X428A, 0X426A,
-  0X3A49, 0X3A49, 0X4249, 0X3A49, 0X426A, 0X4A8B, 0X52EC, 0X5B4E,
-  0X638F, 0X638F, 0X63AF, 0X5B4E, 0X4ACC, 0X426A, 0X3A49, 0X3A08,
-  0X424A, 0X31C7, 0X4249, 0X4ACB, 0X4AAB, 0X426A, 0X3A49, 0X3A49,
-  0X3A49, 0X426A, 0X530D, 0X5B6E, 0X638F, 0X638F, 0X5B6E, 0X5B6E,
-  0X5B2D, 0X5B4E, 0X5B6E, 0X5B4E, 0X5B2D, 0X5B2D, 0X52EC, 0X52EC,
-  0X530C, 0X52EC, 0X4ACB, 0X4AAB, 0X532D, 0X638F, 0X6BD0, 0X6BF0,
-  0X7411, 0X6BF0, 0X6BF0, 0X6BD0, 0X638F, 0X638F, 0X5B4E, 0X5B4E,
-  0X5B2D, 0X530C, 0X52EC, 0X4ACC, 0X52EC, 0X636E, 0X6BF0, 0X7432,
-  0X7432, 0X7431, 0X63AF, 0X532D, 0X4AAB, 0X3A29, 0X3A49, 0X3A49,
-  0X3A08, 0X3A08, 0X29A7, 0X3A08, 0X31E8, 0X31E8, 0X31C7, 0X31C7,
-  0X424A, 0X4249, 0X426A, 0X4ACC, 0X5B4E, 0X6BD0, 0X7411, 0X7431,
-  0X6BF0, 0X638F, 0X532D, 0X4ACB, 0X426A, 0X3A29, 0X4AAB, 0X52EC,
-  0X52EC, 0X52EC, 0X52EC, 0X530D, 0X5B2D, 0X5B4E, 0X5B4E, 0X5B2D,
-  0X530D, 0X530C, 0X4ACC, 0X4A8B, 0X4AAB, 0X4ACB, 0X52EC, 0X4ACB,
-  0X52EC, 0X4ACB, 0X4AAB, 0X4AAB, 0X428A, 0X4A8B, 0X4ACB, 0X530D,
-  0X638F, 0X636E, 0X5B4E, 0X532D, 0X530C, 0X52EC, 0X4AAB, 0X426A,
-  0X426A, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4A8B,
-  0X426A, 0X4249, 0X3A29, 0X3A49, 0X3A49, 0X4AAB, 0X532D, 0X5B2D,
-  0X5B4E, 0X638F, 0X63AF, 0X63AF, 0X638F, 0X5B4E, 0X52EC, 0X4ACB,
-  0X530D, 0X5B2D, 0X530D, 0X52EC, 0X532D, 0X530D, 0X4ACC, 0X52EC,
-  0X52EC, 0X52EC, 0X530D, 0X530C, 0X5B2D, 0X5B4E, 0X530D, 0X638F,
-  0X6BF0, 0X7411, 0X7431, 0X7411, 0X6C11, 0X6BD0, 0X636E, 0X532D,
-  0X52EC, 0X4ACC, 0X4AAB, 0X4ACB, 0X52EC, 0X530D, 0X5B2D, 0X532D,
-  0X5B2D, 0X5B2D, 0X5B2D, 0X530D, 0X52EC, 0X4AAB, 0X4ACB, 0X424A,
-  0X4ACB, 0X532D, 0X52EC, 0X52EC, 0X4ACC, 0X52EC, 0X530C, 0X52EC,
-  0X4ACB, 0X4AAB, 0X4AAB, 0X530C, 0X5B4E, 0X638F, 0X63B0, 0X6BF0,
-  0X6C11, 0X6C11, 0X63AF, 0X5B4E, 0X52EC, 0X4AAB, 0X426A, 0X424A,
-  0X424A, 0X426A, 0X428A, 0X428A, 0X426A, 0X4ACC, 0X4ACB, 0X4ACB,
-  0X4ACC, 0X4ACB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB, 0X4AAB,
-  0X4AAB, 0X4AAB, 0X4ACC, 0X530D, 0X532D, 0X532D, 0X52EC, 0X52EC,
-  0X52EC, 0X5B2D, 0X5B6E, 0X52EC, 0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB,
-  0X52EC, 0X52EC, 0X4ACC, 0X52EC, 0X4AAB, 0X4ACC, 0X52EC, 0X52EC,
-  0X52EC, 0X532D, 0X52EC, 0X4ACB, 0X4AAB, 0X4AAB, 0X4AAB, 0X52EC,
-  0X530D, 0X52EC, 0X4ACB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB, 0X52EC,
-  0X530C, 0X530D, 0X52EC, 0X4ACC, 0X52EC, 0X532D, 0X530D, 0X530C,
-  0X52EC, 0X4ACC, 0X4ACB, 0X4ACB, 0X4AAB, 0X428B, 0X426A, 0X4249,
-  0X3A49, 0X3A29, 0X3A09, 0X3A08, 0X31E8, 0X31E8, 0X3A49, 0X3A29,
-  0X31E8, 0X31C7, 0X31E8, 0X3A08, 0X3A09, 0X3A29, 0X3A49, 0X3A49,
-  0X3A29, 0X3A29, 0X3A49, 0X3A29, 0X424A, 0X4A8B, 0X4ACC, 0X52EC,
-  0X532D, 0X530C, 0X4ACB, 0X52EC, 0X530C, 0X530C, 0X4ACC, 0X4AAB,
-  0X428B, 0X4A8B, 0X4AAB, 0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB, 0X530C,
-  0X532D, 0X5B2D, 0X638F, 0X6BD0, 0X63AF, 0X5B6E, 0X5B2D, 0X530D,
-  0X4ACC, 0X426A, 0X428A, 0X426A, 0X424A, 0X3A49, 0X424A, 0X424A,
-  0X426A, 0X4ACC, 0X52EC, 0X5B2D, 0X5B2D, 0X530D, 0X530D, 0X5B2D,
-  0X5B2D, 0X4ACC, 0X4AAB, 0X426A, 0X4AAB, 0X4A8B, 0X426A, 0X3A08,
-  0X31C7, 0X31E8, 0X3A08, 0X3A49, 0X424A, 0X4ACC, 0X5B2D, 0X5B6E,
-  0X638F, 0X5B2D, 0X52EC, 0X4AAB, 0X4AAB, 0X428A, 0X426A, 0X426A,
-  0X426A, 0X3A29, 0X3A49, 0X31E8, 0X29A7, 0X31C7, 0X3A08, 0X3A49,
-  0X4AAB, 0X530D, 0X638F, 0X63AF, 0X6BD0, 0X63AF, 0X5B4E, 0X530D,
-  0X4AAB, 0X426A, 0X3A29, 0X424A, 0X426A, 0X424A, 0X424A, 0X424A,
-  0X426A, 0X3A49, 0X3A49, 0X3A49, 0X3A29, 0X3A08, 0X3A09, 0X3A08,
-  0X4249, 0X4ACC, 0X4ACC, 0X4ACC, 0X52EC, 0X4ACC, 0X426A, 0X3A29,
-  0X31E8, 0X31E8, 0X426A, 0X3A49, 0X424A, 0X4AAB, 0X4AAB, 0X4249,
-  0X3A29, 0X3A29, 0X31E8, 0X3A29, 0X4AAB, 0X4ACB, 0X530D, 0X532D,
-  0X530D, 0X532D, 0X530C, 0X530D, 0X5B2D, 0X5B2D, 0X4ACC, 0X4AAB,
-  0X4A8B, 0X4AAB, 0X428A, 0X426A, 0X3A29, 0X424A, 0X4ACC, 0X5B2D,
-  0X638F, 0X63AF, 0X6BD0, 0X63B0, 0X638F, 0X5B4E, 0X5B2D, 0X530C,
-  0X4ACC, 0X530C, 0X532D, 0X52EC, 0X428B, 0X4AAB, 0X52EC, 0X5B2D,
-  0X638F, 0X6BF0, 0X6BF0, 0X63B0, 0X5B2D, 0X4AAB, 0X3A29, 0X31E8,
-  0X31E8, 0X31C7, 0X31C7, 0X31C7, 0X31E8, 0X3A29, 0X31E8, 0X31E8,
-  0X2166, 0X2986, 0X31E8, 0X3A49, 0X424A, 0X428B, 0X52EC, 0X5B4E,
-  0X63AF, 0X6BD0, 0X63AF, 0X5B4E, 0X4ACC, 0X3A29, 0X31E8, 0X31E8,
-  0X3A49, 0X3A49, 0X3A29, 0X3A49, 0X3A29, 0X3A29, 0X426A, 0X4AAB,
-  0X4249, 0X3A09, 0X3A08, 0X3A49, 0X424A, 0X3A09, 0X4249, 0X428A,
-  0X426A, 0X424A, 0X426A, 0X424A, 0X426A, 0X424A, 0X3A08, 0X31E8,
-  0X3A49, 0X4AAB, 0X52EC, 0X52EC, 0X4ACC, 0X4AAB, 0X4ACB, 0X4ACB,
-  0X426A, 0X3A29, 0X3A09, 0X426A, 0X426A, 0X426A, 0X426A, 0X426A,
-  0X426A, 0X426A, 0X3A49, 0X31E8, 0X31E8, 0X31E8, 0X3A29, 0X4249,
-  0X4A8B, 0X4ACC, 0X532D, 0X5B4E, 0X5B4E, 0X5B4E, 0X530D, 0X4ACB,
-  0X426A, 0X426A, 0X4A8B, 0X4AAB, 0X4AAB, 0X4ACB, 0X4ACB, 0X4AAB,
-  0X4AAB, 0X4A8B, 0X4AAB, 0X428A, 0X4ACC, 0X52EC, 0X4AAB, 0X4ACB,
-  0X4ACB, 0X530D, 0X5B4E, 0X638F, 0X638F, 0X638F, 0X638F, 0X5B6E,
-  0X5B2D, 0X52EC, 0X4A8B, 0X428A, 0X4A8B, 0X428A, 0X426A, 0X4AAB,
-  0X4AAB, 0X52EC, 0X4ACC, 0X4ACB, 0X4AAB, 0X4AAB, 0X52EC, 0X4AAB,
-  0X428B, 0X426A, 0X4AAB, 0X4A8B, 0X3A29, 0X424A, 0X426A, 0X4AAB,
-  0X4AAB, 0X3A49, 0X424A, 0X426A, 0X424A, 0X426A, 0X4AAB, 0X52EC,
-  0X532D, 0X5B2D, 0X5B4E, 0X5B4E, 0X5B2D, 0X52EC, 0X4A8B, 0X3A49,
-  0X31E8, 0X31C7, 0X31E8, 0X3A08, 0X3A29, 0X3A49, 0X426A, 0X4A8B,
-  0X426A, 0X426A, 0X426A, 0X426A, 0X4AAB, 0X4AAB, 0X4AAB, 0X428B,
-  0X426A, 0X426A, 0X426A, 0X426A, 0X428B, 0X4ACC, 0X52EC, 0X52EC,
-  0X4AAB, 0X428B, 0X4AAB, 0X4ACB, 0X4ACB, 0X4AAB, 0X4AAB, 0X4A8B,
-  0X4A8B, 0X428A, 0X4AAB, 0X4AAB, 0X4AAB, 0X426A, 0X3A08, 0X4A8B,
-  0X4ACB, 0X4ACB, 0X4249, 0X4AAB, 0X428B, 0X424A, 0X426A, 0X424A,
-  0X424A, 0X428B, 0X4ACB, 0X4AAB, 0X424A, 0X4249, 0X424A, 0X428A,
-  0X4AAB, 0X4AAB, 0X4AAB, 0X4ACB, 0X4AAB, 0X4A8B, 0X426A, 0X3A49,
-  0X3A49, 0X4249, 0X3A49, 0X3A29, 0X3A08, 0X3A08, 0X4249, 0X426A,
-  0X31C7, 0X2986, 0X2986, 0X2966, 0X2986, 0X29A7, 0X31C7, 0X31E8,
-  0X31C7, 0X31C7, 0X2165, 0X2966, 0X31C7, 0X31C7, 0X31A7, 0X29A7,
-  0X31A7, 0X29A7, 0X31C7, 0X31E8, 0X3A08, 0X3A08, 0X31E8, 0X3A29,
-  0X3A49, 0X426A, 0X4AAB, 0X4AAB, 0X4A8B, 0X4AAB, 0X4AAB, 0X4ACB,
-  0X4AAB, 0X426A, 0X3A49, 0X3A49, 0X426A, 0X4A8B, 0X4AAB, 0X4AAB,
-  0X4AAB, 0X4ACC, 0X52EC, 0X52EC, 0X52EC, 0X532D, 0X530D, 0X52EC,
-  0X4AAB, 0X428A, 0X424A, 0X3A49, 0X4249, 0X426A, 0X3A49, 0X31E8,
-  0X31E8, 0X31E8, 0X31E8, 0X3A08, 0X424A, 0X426A, 0X426A, 0X426A,
-  0X428B, 0X4AAB, 0X4AAB, 0X4A8B, 0X428A, 0X424A, 0X3A49, 0X3A09,
-  0X31E8, 0X29A7, 0X31A7, 0X2986, 0X29A7, 0X31C7, 0X31C7, 0X3A08,
-  0X426A, 0X4AAB, 0X4ACB, 0X4AAB, 0X426A, 0X3A09, 0X31E8, 0X31E8,
-  0X3A08, 0X3A08, 0X31E8, 0X31A7, 0X29A7, 0X29A7, 0X29A7, 0X29A7,
-  0X31C7, 0X31E8, 0X3A29, 0X428B, 0X530C, 0X5B4E, 0X638F, 0X5B4E,
-  0X530C, 0X4AAB, 0X3A49, 0X31E8, 0X31E8, 0X31E8, 0X31E8, 0X31E8,
-  0X3A08, 0X31E8, 0X3A08, 0X3A09, 0X3A29, 0X3A08, 0X3A08, 0X31E8,
-  0X31A7, 0X29A7, 0X31C7, 0X3A08, 0X31E8, 0X3A08, 0X3A08, 0X3A29,
-  0X3A29, 0X3A08, 0X31C7, 0X31C7, 0X424A, 0X3A08, 0X31E8, 0X3A08,
-  0X31E8, 0X31E8, 0X31E8, 0X31C7, 0X29A7, 0X31C7, 0X3A29, 0X3A29,
-  0X428A, 0X4AAB, 0X428A, 0X4AAB, 0X4AAB, 0X4ACB, 0X4ACB, 0X4AAB,
-  0X426A, 0X3A29, 0X3A49, 0X3A49, 0X3A49, 0X428B, 0X4249, 0X3A29,
-  0X4A8B, 0X4ACC, 0X530D, 0X5B2D, 0X5B2D, 0X532D, 0X530C, 0X4ACC,
-  0X426A, 0X428B, 0X426A, 0X424A, 0X4249, 0X428B, 0X428A, 0X428A,
-  0X4A8B, 0X4ACC, 0X5B2D, 0X638F, 0X638F, 0X5B2D, 0X4ACC, 0X424A,
-  0X29A7, 0X2966, 0X29A7, 0X2986, 0X2966, 0X29A7, 0X31C7, 0X31A7,
-  0X2986, 0X2966, 0X2986, 0X2986, 0X29A7, 0X31C7, 0X3A08, 0X3A49,
-  0X428A, 0X4ACB, 0X52EC, 0X532D, 0X530D, 0X4ACC, 0X424A, 0X31C7,
-  0X2986, 0X29A7, 0X29A7, 0X31C7, 0X31E8, 0X31C7, 0X2145, 0X29A7,
-  0X31C7, 0X29A7, 0X2966, 0X2966, 0X2966, 0X2986, 0X31C7, 0X3A08,
-  0X3A08, 0X3A08, 0X3A29, 0X3A29, 0X3A08, 0X31C7, 0X31C7, 0X31C7,
-  0X3A08, 0X31E8, 0X31C7, 0X3A49, 0X424A, 0X426A, 0X426A, 0X3A49,
-  0X3A08, 0X29A7, 0X2166, 0X2165, 0X29A7, 0X31E8, 0X3A29, 0X3A09,
-  0X31E8, 0X3A29, 0X3A29, 0X31C7, 0X2966, 0X2125, 0X2145, 0X29A7,
-  0X31E8, 0X3A08, 0X3A49, 0X426A, 0X4ACB, 0X52EC, 0X4ACC, 0X4AAB,
-  0X426A, 0X424A, 0X3A29, 0X3A08, 0X3A29, 0X3A49, 0X424A, 0X4249,
-  0X3A49, 0X3A29, 0X3A49, 0X426A, 0X424A, 0X3A29, 0X424A, 0X426A,
-  0X426A, 0X3A49, 0X3A29, 0X3A49, 0X4A8B, 0X52EC, 0X530C, 0X52EC,
-  0X52EC, 0X52EC, 0X4ACC, 0X4AAB, 0X426A, 0X426A, 0X3A49, 0X3A09,
-  0X3A49, 0X424A, 0X426A, 0X52EC, 0X4A8B, 0X424A, 0X424A, 0X424A,
-  0X426A, 0X424A, 0X424A, 0X4249, 0X424A, 0X4AAB, 0X3A49, 0X3A29,
-  0X3A08, 0X3A29, 0X31E8, 0X31E8, 0X31E8, 0X29A7, 0X31E8, 0X31E8,
-  0X3A09, 0X428B, 0X4A8B, 0X4AAB, 0X4AAB, 0X428A, 0X428B, 0X426A,
-  0X3A49, 0X3A29, 0X31E8, 0X31C7, 0X31C7, 0X31E8, 0X3A09, 0X3A09,
-  0X3A29, 0X3A49, 0X4249, 0X3A49, 0X3A49, 0X3A49, 0X3A49, 0X3A29,
-  0X424A, 0X426A, 0X424A, 0X3A49, 0X424A, 0X426A, 0X426A, 0X4A8B,
-  0X426A, 0X4A8B, 0X424A, 0X3A08, 0X3A49, 0X426A, 0X4A8B, 0X426A,
-  0X424A, 0X426A, 0X426A, 0X3A29, 0X4249, 0X4249, 0X4249, 0X3A49,
-  0X3A29, 0X426A, 0X424A, 0X3A29, 0X3A29, 0X3A08, 0X3A09, 0X3A29,
-  0X31E8, 0X31C7, 0X31C7, 0X31E8, 0X3A08, 0X3A49, 0X3A29, 0X3A09,
-  0X3A29, 0X3A49, 0X424A, 0X424A, 0X426A, 0X3A49, 0X3A29, 0X3A08,
-  0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X2986, 0X2986, 0X2966,
-  0X2986, 0X31C7, 0X29A7, 0X2125, 0X1904, 0X2125, 0X2125, 0X2966,
-  0X2986, 0X2145, 0X2966, 0X29A7, 0X2966, 0X2125, 0X29A7, 0X31C7,
-  0X2986, 0X2986, 0X29A7, 0X2966, 0X2986, 0X31C7, 0X31E8, 0X3A29,
-  0X424A, 0X3A29, 0X31E8, 0X3A29, 0X426A, 0X426A, 0X424A, 0X428A,
-  0X428B, 0X424A, 0X3A29, 0X3A29, 0X3A09, 0X31E8, 0X3A08, 0X3A29,
-  0X426A, 0X428A, 0X4A8B, 0X428B, 0X4A8B, 0X4A8B, 0X4AAB, 0X4AAB,
-  0X4AAB, 0X424A, 0X3A08, 0X31E8, 0X3A29, 0X3A29, 0X3A08, 0X31E8,
-  0X31E8, 0X31A7, 0X29A7, 0X29A7, 0X31C7, 0X31E8, 0X31C7, 0X31C7,
-  0X31C7, 0X31C7, 0X31E8, 0X3A29, 0X426A, 0X3A49, 0X3A08, 0X3A08,
-  0X31C7, 0X2986, 0X2966, 0X2986, 0X2166, 0X1904, 0X2125, 0X2166,
-  0X2145, 0X2966, 0X2986, 0X31A7, 0X31E8, 0X3A08, 0X31C7, 0X2966,
-  0X2145, 0X2165, 0X2145, 0X2145, 0X2966, 0X2966, 0X2125, 0X2986,
-  0X2986, 0X1924, 0X2125, 0X2145, 0X2986, 0X31C7, 0X4A8B, 0X4ACB,
-  0X52EC, 0X4ACB, 0X426A, 0X3A49, 0X31E8, 0X2986, 0X2986, 0X29A7,
-  0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X31A7, 0X29A7,
-  0X29A7, 0X2966, 0X2966, 0X29A7, 0X2166, 0X2145, 0X2966, 0X2986,
-  0X2966, 0X2966, 0X2966, 0X2986, 0X2165, 0X2145, 0X2986, 0X2986,
-  0X2986, 0X31C7, 0X31C7, 0X29A7, 0X29A7, 0X2966, 0X2966, 0X31C7,
-  0X31E8, 0X3A08, 0X3A08, 0X31E8, 0X31E8, 0X3A29, 0X424A, 0X426A,
-  0X3A49, 0X4249, 0X3A08, 0X31C7, 0X31C7, 0X31E8, 0X3A49, 0X3A29,
-  0X3A09, 0X31E8, 0X3A29, 0X4AAB, 0X52EC, 0X4AAB, 0X4ACC, 0X4AAB,
-  0X4AAB, 0X4AAB, 0X3A49, 0X3A29, 0X3A29, 0X3A08, 0X3A29, 0X424A,
-  0X3A49, 0X3A29, 0X3A29, 0X426A, 0X4ACC, 0X52EC, 0X530C, 0X4ACB,
-  0X424A, 0X31C7, 0X2966, 0X2145, 0X2165, 0X2966, 0X2966, 0X2986,
-  0X29A7, 0X29A7, 0X2145, 0X1904, 0X2145, 0X2165, 0X2166, 0X2966,
-  0X2986, 0X29A7, 0X31C7, 0X3A08, 0X3A29, 0X3A49, 0X3A29, 0X3A08,
-  0X31E8, 0X2966, 0X2966, 0X2166, 0X2125, 0X2145, 0X2966, 0X2145,
-  0X2145, 0X2165, 0X2166, 0X2145, 0X2145, 0X1904, 0X2125, 0X2125,
-  0X29A7, 0X31C7, 0X31E8, 0X31E8, 0X31E8, 0X31C7, 0X31E8, 0X31C7,
-  0X31A7, 0X31C7, 0X2986, 0X2966, 0X2966, 0X29A7, 0X29A7, 0X29A7,
-  0X29A7, 0X2966, 0X2145, 0X18E4, 0X10C3, 0X18E3, 0X1924, 0X2125,
-  0X2966, 0X2986, 0X31A7, 0X31C7, 0X31A7, 0X29A7, 0X2966, 0X2165,
-  0X2166, 0X2966, 0X29A7, 0X31A7, 0X31C7, 0X31C7, 0X3A08, 0X3A09,
-  0X3A08, 0X31E8, 0X31A7, 0X29A7, 0X31A7, 0X29A7, 0X31C7, 0X31C7,
-  0X31E8, 0X31C7, 0X29A7, 0X2986, 0X31C7, 0X31C7, 0X31C7, 0X31E8,
-  0X31E8, 0X31E8, 0X31C7, 0X31A7, 0X31C7, 0X31C7, 0X31E8, 0X3A29,
-  0X3A49, 0X3A29, 0X4249, 0X4249, 0X3A29, 0X31E8, 0X29A7, 0X2966,
-  0X29A7, 0X31C7, 0X31C7, 0X31C7, 0X3A08, 0X3A08, 0X3A08, 0X31E8,
-  0X3A09, 0X3A08, 0X31C7, 0X31C7, 0X31E8, 0X31E8, 0X3A08, 0X3A08,
-  0X3A08, 0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X29A7, 0X2986,
-  0X2986, 0X2986, 0X31C7, 0X31E8, 0X31E8, 0X3A08, 0X3A08, 0X3A08,
-  0X31C7, 0X31C7, 0X31C7, 0X2986, 0X2986, 0X29A7, 0X2966, 0X2966,
-  0X31A7, 0X31E8, 0X3A08, 0X3A08, 0X31E8, 0X3A08, 0X31E8, 0X31E8,
-  0X31E8, 0X31C7, 0X31A7, 0X31A7, 0X31A7, 0X31A7, 0X31C7, 0X31E8,
-  0X31E8, 0X31E8, 0X31E8, 0X31C7, 0X31C7, 0X29A7, 0X31A7, 0X31C7,
-  0X2986, 0X31C7, 0X31E8, 0X3A08, 0X3A08, 0X31C7, 0X29A7, 0X29A7,
-  0X29A7, 0X31C7, 0X31C7, 0X31A7, 0X31C7, 0X31C7, 0X31C7, 0X29A7,
-  0X2986, 0X29A7, 0X2986, 0X2966, 0X2165, 0X2145, 0X2966, 0X29A7,
-  0X31A7, 0X29A7, 0X29A7, 0X31A7, 0X31C7, 0X31A7, 0X29A7, 0X29A7,
-  0X2986, 0X2165, 0X1904, 0X10C3, 0X18E4, 0X18E3, 0X18C3, 0X18E4,
-  0X1924, 0X2125, 0X2125, 0X2124, 0X1904, 0X18C3, 0X18C3, 0X18E4,
-  0X1924, 0X2125, 0X2145, 0X1904, 0X2125, 0X2986, 0X2165, 0X2145,
-  0X2166, 0X2165, 0X2124, 0X2165, 0X2125, 0X18E3, 0X2125, 0X29A7,
-  0X2986, 0X31E8, 0X31E8, 0X31C7, 0X29A7, 0X31C7, 0X31E8, 0X3A08,
-  0X31C7, 0X31A7, 0X31C7, 0X31C7, 0X31C7, 0X31E8, 0X31C7, 0X2166,
-  0X2986, 0X29A7, 0X31C7, 0X3A08, 0X3A08, 0X3A09, 0X3A29, 0X3A09,
-  0X3A29, 0X3A49, 0X3A08, 0X31C7, 0X2966, 0X2966, 0X31E8, 0X424A,
-  0X3A08, 0X31C7, 0X2986, 0X2966, 0X2145, 0X2165, 0X2165, 0X2145,
-  0X2145, 0X2145, 0X2125, 0X2145, 0X2986, 0X29A7, 0X31C7, 0X31C7,
-  0X29A7, 0X2966, 0X2145, 0X2124, 0X2125, 0X1904, 0X18E3, 0X10C3,
-  0X18E3, 0X18E4, 0X18E3, 0X18E3, 0X18E3, 0X18E3, 0X18E3, 0X18E4,
-  0X1904, 0X1904, 0X1904, 0X18C3, 0X10A3, 0X10C3, 0X18E3, 0X1904,
-  0X18E4, 0X1924, 0X1924, 0X1904, 0X2124, 0X2124, 0X2125, 0X2145,
-  0X2986, 0X29A7, 0X31C7, 0X31C7, 0X31C7, 0X2966, 0X2145, 0X2125,
-  0X2125, 0X2145, 0X2966, 0X2966, 0X2966, 0X2166, 0X2145, 0X2125,
-  0X2124, 0X2125, 0X2145, 0X2124, 0X18E4, 0X1904, 0X1904, 0X1904,
-  0X1924, 0X2124, 0X2125, 0X2124, 0X2145, 0X2986, 0X2986, 0X2145,
-  0X2125, 0X1924, 0X2125, 0X2165, 0X2145, 0X2125, 0X2166, 0X2966,
-  0X2966, 0X2986, 0X29A7, 0X29A7, 0X29A7, 0X2986, 0X31C7, 0X31E8,
-  0X31C7, 0X31C7, 0X31C7, 0X31C7, 0X29A7, 0X2986, 0X2986, 0X2986,
-  0X31A7, 0X29A7, 0X31C7, 0X31E8, 0X31E8, 0X3A29, 0X3A29, 0X3A29,
-  0X3A09, 0X3A29, 0X3A09, 0X3A08, 0X31E8, 0X31E8, 0X31C7, 0X31C7,
-  0X31C7, 0X31E8, 0X31E8, 0X31C7, 0X31E8, 0X3A09, 0X3A49, 0X426A,
-  0X424A, 0X3A08, 0X29A7, 0X2125, 0X10C3, 0X10C3, 0X18C3, 0X1904,
-  0X2125, 0X2125, 0X2145, 0X2145, 0X1904, 0X18E4, 0X18E3, 0X18E4,
-  0X18E4, 0X1904, 0X18E4, 0X18E4, 0X1904, 0X2125, 0X2145, 0X2145,
-  0X2125, 0X18E4, 0X18E4, 0X18E4, 0X10C3, 0X10C3, 0X18E4, 0X1924,
-  0X2125, 0X1904, 0X1904, 0X1904, 0X2125, 0X2145, 0X1924, 0X18E4,
-  0X18C3, 0X18E3, 0X2125, 0X2966, 0X2966, 0X2986, 0X2986, 0X2166,
-  0X2145, 0X2145, 0X2125, 0X2966, 0X18C3, 0X18C3, 0X18E3, 0X18E3,
-  0X18C3, 0X18E3, 0X18E3, 0X18E4, 0X10A3, 0X0882, 0X0841, 0X0862,
-  0X10C3, 0X10C3, 0X18E3, 0X1904, 0X1924, 0X2165, 0X29A7, 0X1924,
-  0X10C3, 0X10C3, 0X18E4, 0X18E4, 0X18E4, 0X1904, 0X2124, 0X1904,
-  0X18E4, 0X1904, 0X1904, 0X18E3, 0X10C3, 0X18E3, 0X1904, 0X2124,
-  0X2145, 0X2166, 0X2145, 0X1904, 0X18E3, 0X1904, 0X2145, 0X2145,
-  0X2165, 0X2966, 0X2166, 0X2145, 0X2125, 0X2125, 0X2125, 0X1924,
-  0X1904, 0X2125, 0X2166, 0X2966, 0X2966, 0X2966, 0X2986, 0X29A7,
-  0X2145, 0X1924, 0X2125, 0X2145, 0X2125, 0X2145, 0X2145, 0X2145,
-  0X2166, 0X2966, 0X2165, 0X2145, 0X2125, 0X2125, 0X2145, 0X29A7,
-  0X31C7, 0X2986, 0X2966, 0X2145, 0X2145, 0X2145, 0X2145, 0X2145,
-  0X2125, 0X2125, 0X1904, 0X2125, 0X2166, 0X2966, 0X2166, 0X2966,
-  0X2986, 0X2986, 0X2145, 0X2124, 0X2125, 0X2165, 0X2125, 0X1904,
-  0X18E3, 0X18E4, 0X2125, 0X2145, 0X2145, 0X2966, 0X2966, 0X2166,
-  0X2145, 0X2125, 0X2125, 0X2145, 0X2125, 0X2124, 0X1924, 0X1904,
-  0X1904, 0X1904, 0X1924, 0X1904, 0X1924, 0X1924, 0X1924, 0X1904,
-  0X1904, 0X18E4, 0X18E4, 0X1904, 0X2145, 0X2165, 0X2125, 0X2124,
-  0X1924, 0X18E4, 0X2125, 0X1904, 0X18E4, 0X18E3, 0X18E3, 0X1904,
-  0X2125, 0X2124, 0X1904, 0X18E4, 0X10A3, 0X10C3, 0X18C3, 0X18E3,
-  0X1904, 0X1924, 0X1924, 0X2125, 0X2124, 0X1904, 0X18E4, 0X18E3,
-  0X18C3, 0X10C3, 0X10A2, 0X10A2, 0X1082, 0X1082, 0X0882, 0X0882,
-  0X10A2, 0X10C3, 0X10A3, 0X10C3, 0X10C3, 0X10A3, 0X1082, 0X0882,
-  0X0882, 0X1082, 0X10A3, 0X1082, 0X10A2, 0X10A3, 0X10C3, 0X10C3,
-  0X1904, 0X1904, 0X18E3, 0X18E3, 0X10C3, 0X1082, 0X1082, 0X10A2,
-  0X10C3, 0X18E4, 0X2124, 0X2125, 0X2145, 0X2145, 0X2125, 0X2124,
-  0X2125, 0X2145, 0X2125, 0X2124, 0X2125, 0X2145, 0X2165, 0X2145,
-  0X1924, 0X18E4, 0X18E3, 0X1924, 0X2145, 0X2145, 0X2165, 0X2986,
-  0X2966, 0X2166, 0X2966, 0X2166, 0X2145, 0X1924, 0X1904, 0X18E4,
-  0X1904, 0X2145, 0X2125, 0X2124, 0X1924, 0X1904, 0X1904, 0X18E4,
-  0X18E3, 0X10C3, 0X10C3, 0X10A3, 0X10C3, 0X10C3, 0X18C3, 0X18E4,
-  0X1904, 0X1904, 0X18E4, 0X18E3, 0X18E3, 0X10C3, 0X10A3, 0X10A2,
-  0X10A2, 0X1082, 0X1082, 0X1082, 0X0882, 0X0882, 0X0882, 0X0882,
-  0X0882, 0X0882, 0X1082, 0X10A2, 0X1082, 0X0861, 0X0841, 0X0841,
-  0X1082, 0X10C3, 0X10A3, 0X10A2, 0X10A2, 0X10C3, 0X10C3, 0X10A3,
-  0X10A2, 0X10A2, 0X10A3, 0X18C3, 0X1924, 0X2124, 0X1924, 0X18C3,
-  0X18E3, 0X18E3, 0X18E3, 0X18C3, 0X18C3, 0X10C3, 0X10C3, 0X10C3,
-  0X10C3, 0X18C3, 0X18C3, 0X18C3, 0X10C3, 0X1082, 0X10A3, 0X10A2,
-  0X1082, 0X10A2, 0X10C3, 0X10C3, 0X18C3, 0X18C3, 0X10C3, 0X1082,
-  0X0882, 0X10A3, 0X18E3, 0X18C3, 0X10C3, 0X10C3, 0X10C3, 0X18C3,
-  0X18C3, 0X2125, 0X2145, 0X1924, 0X1904, 0X2124, 0X2125, 0X2124,
-  0X1924, 0X2125, 0X2125, 0X2125, 0X2145, 0X2145, 0X2145, 0X1924,
-  0X1904, 0X1904, 0X1904, 0X1924, 0X2125, 0X2966, 0X2986, 0X2986,
-  0X2986, 0X2966, 0X2966, 0X2966, 0X2166, 0X2145, 0X2125, 0X2125,
-  0X2145, 0X2165, 0X2966, 0X2966, 0X2165, 0X2145, 0X29A7, 0X2986,
-  0X2986, 0X29A7, 0X2966, 0X2124, 0X10C3, 0X10A2, 0X10A2, 0X10A2,
-  0X10A2, 0X10A2, 0X10C3, 0X10C3, 0X10A2, 0X10A2, 0X10A2, 0X10A2,
-  0X1082, 0X10A2, 0X10A2, 0X10A2, 0X10A2, 0X1082, 0X0882, 0X10A2,
-  0X10A2, 0X1082, 0X10A2, 0X10A2, 0X1082, 0X1082, 0X10A2, 0X1082,
-  0X10A2, 0X10A2, 0X10A3, 0X10C3, 0X10A3, 0X10C3, 0X18E3, 0X10A2,
-  0X1082, 0X10A2, 0X10A2, 0X1082, 0X1082, 0X10A2, 0X10A3, 0X10A2,
-  0X10A2, 0X1082, 0X10C3, 0X10C3, 0X18C3, 0X18E3, 0X0841, 0X0041,
-  0X0841, 0X0841, 0X0841, 0X0841, 0X0041, 0X0841, 0X0841, 0X0041,
-  0X0020, 0X0041, 0X0020, 0X0020, 0X0841, 0X0882, 0X1082, 0X0862,
-  0X0862, 0X0841, 0X0020, 0X0041, 0X0841, 0X0841, 0X0841, 0X0841,
-  0X0841, 0X0041, 0X0020, 0X0841, 0X0841, 0X0841, 0X0841, 0X0861,
-  0X0862, 0X1082, 0X10A2, 0X10A2, 0X0882, 0X0862, 0X0841, 0X0862,
-  0X1082, 0X1082, 0X1082, 0X10A2, 0X1082, 0X1082, 0X1082, 0X1082,
-  0X0882, 0X0882, 0X1082, 0X1082, 0X1082, 0X1082, 0X0882, 0X10A2,
-  0X10A2, 0X10A2, 0X1082, 0X1082, 0X10A2, 0X0882, 0X0862, 0X0882,
-  0X0882, 0X1082, 0X10A3, 0X10A2, 0X1082, 0X0882, 0X0882, 0X0861,
-  0X0862, 0X10C3, 0X10A2, 0X10A2, 0X1082, 0X1082, 0X0882, 0X0882,
-  0X0882, 0X0882, 0X0882, 0X0882, 0X10A2, 0X0882, 0X0882, 0X10A2,
-  0X10A2, 0X1082, 0X1082, 0X10A2, 0X10A2, 0X10A2, 0X1082, 0X10A2,
-  0X0882, 0X0882, 0X0861, 0X0841, 0X0861, 0X1082, 0X0882, 0X10A2,
-  0X10A2, 0X10A2, 0X10A2, 0X10A2, 0X0882, 0X0862, 0X0862, 0X0862,
-  0X0862, 0X0861, 0X0861, 0X0862, 0X0861, 0X0861, 0X0861, 0X0882,
-  0X0861, 0X0861, 0X0841, 0X0841, 0X0841, 0X0841, 0X0862, 0X0862,
-  0X0862, 0X0882, 0X0862, 0X0861, 0X0841, 0X0841, 0X0841, 0X0841,
-  0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0041,
-  0X0841, 0X0841, 0X0841, 0X0841, 0X0862, 0X0861, 0X0841, 0X0841,
-  0X0041, 0X0841, 0X0041, 0X0020, 0X0020, 0X0020, 0X0020, 0X0000,
-  0X0000, 0X0020, 0X0841, 0X0841, 0X0041, 0X0841, 0X0841, 0X0841,
-  0X0841, 0X0841, 0X0041, 0X0041, 0X0841, 0X0861, 0X0841, 0X0841,
-  0X0841, 0X0861, 0X0861, 0X0841, 0X0861, 0X0861, 0X0841, 0X0041,
-  0X0000, 0X0000, 0X0020, 0X0841, 0X0882, 0X10A2, 0X1082, 0X1082,
-  0X0882, 0X0882, 0X0862, 0X0861, 0X0841, 0X0861, 0X0861, 0X0882,
-  0X1082, 0X1082, 0X0882, 0X0861, 0X0841, 0X0861, 0X0862, 0X1082,
-  0X10C3, 0X18C3, 0X10A3, 0X0882, 0X1082, 0X0882, 0X0882, 0X0841,
-  0X0041, 0X0841, 0X0862, 0X0882, 0X0882, 0X1082, 0X1082, 0X0882,
-  0X0862, 0X0861, 0X0861, 0X0861, 0X0861, 0X0841, 0X0841, 0X0861,
-  0X0882, 0X0882, 0X0862, 0X0861, 0X0861, 0X0861, 0X0862, 0X0841,
-  0X0841, 0X0041, 0X0020, 0X0841, 0X0841, 0X0841, 0X0041, 0X0020,
-  0X0020, 0X0041, 0X0041, 0X0041, 0X0841, 0X0041, 0X0020, 0X0020,
-  0X0020, 0X0020, 0X0020, 0X0020, 0X0041, 0X0041, 0X0841, 0X0841,
-  0X0841, 0X0041, 0X0041, 0X0020, 0X0020, 0X0841, 0X0882, 0X1082,
-  0X0882, 0X0862, 0X0861, 0X0841, 0X0041, 0X0841, 0X0841, 0X0841,
-  0X0841, 0X0841, 0X0861, 0X0862, 0X0862, 0X0861, 0X0841, 0X0841,
-  0X0041, 0X0041, 0X0841, 0X0841, 0X0041, 0X0841, 0X0841, 0X0861,
-  0X1082, 0X0862, 0X0841, 0X0861, 0X0862, 0X0841, 0X0841, 0X0841,
-  0X0041, 0X0841, 0X0841, 0X0861, 0X0862, 0X0882, 0X0882, 0X0882,
-  0X0882, 0X0882, 0X0882, 0X0882, 0X0882, 0X1082, 0X0882, 0X1082,
-  0X10A2, 0X1082, 0X0882, 0X0862, 0X0841, 0X0841, 0X0882, 0X10A3,
-  0X10C3, 0X10A3, 0X10A3, 0X10A3, 0X10A2, 0X10A2, 0X1082, 0X0882,
-  0X0861, 0X0861, 0X0882, 0X1082, 0X10A2, 0X10C3, 0X10A2, 0X10A2,
-  0X10A3, 0X10C3, 0X10C3, 0X10A3, 0X1082, 0X0862, 0X0020, 0X0041,
-  0X0841, 0X0841, 0X0841, 0X0041, 0X0041, 0X0841, 0X0841, 0X0841,
-  0X0841, 0X0041, 0X0841, 0X0841, 0X0020, 0X0841, 0X0841, 0X0841,
-  0X0020, 0X0020, 0X0000, 0X0020, 0X0841, 0X0841, 0X0861, 0X0841,
-  0X0041, 0X0020, 0X0020, 0X0041, 0X0041, 0X0041, 0X0041, 0X0861,
-  0X0841, 0X0841, 0X0020, 0X0020, 0X0020, 0X0020, 0X0841, 0X0841,
-  0X0841, 0X0841, 0X0041, 0X0841, 0X0841, 0X0041, 0X0841, 0X0841 };
+extern const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] asm("goatEye_iris");
 
 #define SCREEN_WIDTH  128
 #define SCREEN_HEIGHT 128
 
 #ifdef SYMMETRICAL_EYELID
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X02, 0X02, 0X02, 0X03,
-  0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X02, 0X02, 0X02,
-  0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X02, 0X03,
-  0X03, 0X04, 0X04, 0X04, 0X05, 0X05, 0X05, 0X05, 0X05, 0X06, 0X06, 0X06,
-  0X06, 0X06, 0X06, 0X05, 0X05, 0X05, 0X05, 0X05, 0X04, 0X04, 0X04, 0X03,
-  0X03, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X02, 0X02, 0X03, 0X04, 0X04, 0X05, 0X05, 0X06, 0X06, 0X07, 0X07,
-  0X07, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
-  0X08, 0X08, 0X08, 0X07, 0X07, 0X07, 0X06, 0X06, 0X05, 0X05, 0X04, 0X04,
-  0X03, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X03, 0X04, 0X04, 0X05, 0X06,
-  0X07, 0X07, 0X08, 0X08, 0X09, 0X09, 0X0A, 0X0A, 0X0A, 0X0A, 0X0B, 0X0B,
-  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0A, 0X0A,
-  0X0A, 0X0A, 0X09, 0X09, 0X08, 0X08, 0X07, 0X07, 0X06, 0X05, 0X04, 0X04,
-  0X03, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02,
-  0X03, 0X04, 0X05, 0X06, 0X07, 0X07, 0X08, 0X09, 0X09, 0X0A, 0X0B, 0X0B,
-  0X0C, 0X0C, 0X0C, 0X0D, 0X0D, 0X0D, 0X0D, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
-  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0D, 0X0D, 0X0D, 0X0D, 0X0C, 0X0C, 0X0C,
-  0X0B, 0X0B, 0X0A, 0X09, 0X09, 0X08, 0X07, 0X07, 0X06, 0X05, 0X04, 0X03,
-  0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X05, 0X06, 0X07, 0X08, 0X09,
-  0X09, 0X0A, 0X0B, 0X0C, 0X0C, 0X0D, 0X0D, 0X0E, 0X0E, 0X0F, 0X0F, 0X0F,
-  0X10, 0X10, 0X10, 0X10, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11,
-  0X10, 0X10, 0X10, 0X10, 0X0F, 0X0F, 0X0F, 0X0E, 0X0E, 0X0D, 0X0D, 0X0C,
-  0X0C, 0X0B, 0X0A, 0X09, 0X09, 0X08, 0X07, 0X06, 0X05, 0X04, 0X02, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X05, 0X07, 0X08, 0X09, 0X0A, 0X0B, 0X0C, 0X0C, 0X0D, 0X0E, 0X0F,
-  0X0F, 0X10, 0X10, 0X11, 0X11, 0X12, 0X12, 0X12, 0X13, 0X13, 0X13, 0X13,
-  0X13, 0X13, 0X13, 0X14, 0X14, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
-  0X12, 0X12, 0X12, 0X11, 0X11, 0X10, 0X10, 0X0F, 0X0F, 0X0E, 0X0D, 0X0C,
-  0X0C, 0X0B, 0X0A, 0X09, 0X08, 0X07, 0X05, 0X04, 0X03, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X04, 0X06, 0X07, 0X08, 0X0A, 0X0B,
-  0X0C, 0X0D, 0X0E, 0X0E, 0X0F, 0X10, 0X11, 0X11, 0X12, 0X13, 0X13, 0X14,
-  0X14, 0X14, 0X15, 0X15, 0X15, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
-  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X15, 0X15, 0X15, 0X14, 0X14,
-  0X14, 0X13, 0X13, 0X12, 0X11, 0X11, 0X10, 0X0F, 0X0E, 0X0E, 0X0D, 0X0C,
-  0X0B, 0X0A, 0X08, 0X07, 0X06, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X06, 0X07, 0X09, 0X0A, 0X0B, 0X0D, 0X0E, 0X0F, 0X10, 0X11, 0X11,
-  0X12, 0X13, 0X14, 0X14, 0X15, 0X15, 0X16, 0X16, 0X17, 0X17, 0X18, 0X18,
-  0X18, 0X18, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19,
-  0X19, 0X19, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X16, 0X16, 0X15, 0X15,
-  0X14, 0X14, 0X13, 0X12, 0X11, 0X11, 0X10, 0X0F, 0X0E, 0X0D, 0X0B, 0X0A,
-  0X09, 0X07, 0X06, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04, 0X06, 0X08, 0X09, 0X0B, 0X0C,
-  0X0D, 0X0E, 0X10, 0X11, 0X12, 0X13, 0X13, 0X14, 0X15, 0X16, 0X16, 0X17,
-  0X18, 0X18, 0X19, 0X19, 0X1A, 0X1A, 0X1A, 0X1B, 0X1B, 0X1B, 0X1B, 0X1C,
-  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1B, 0X1B, 0X1B,
-  0X1B, 0X1A, 0X1A, 0X1A, 0X19, 0X19, 0X18, 0X18, 0X17, 0X16, 0X16, 0X15,
-  0X14, 0X13, 0X13, 0X12, 0X11, 0X10, 0X0E, 0X0D, 0X0C, 0X0B, 0X09, 0X08,
-  0X06, 0X04, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X04, 0X06, 0X07, 0X09, 0X0B, 0X0C, 0X0E, 0X0F, 0X10, 0X11, 0X13, 0X14,
-  0X15, 0X16, 0X16, 0X17, 0X18, 0X19, 0X19, 0X1A, 0X1B, 0X1B, 0X1C, 0X1C,
-  0X1C, 0X1D, 0X1D, 0X1D, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1F, 0X1F,
-  0X1F, 0X1F, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1D, 0X1D, 0X1D, 0X1C,
-  0X1C, 0X1C, 0X1B, 0X1B, 0X1A, 0X19, 0X19, 0X18, 0X17, 0X16, 0X16, 0X15,
-  0X14, 0X13, 0X11, 0X10, 0X0F, 0X0E, 0X0C, 0X0B, 0X09, 0X07, 0X06, 0X04,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X05, 0X07, 0X09, 0X0B, 0X0C,
-  0X0E, 0X0F, 0X11, 0X12, 0X13, 0X14, 0X16, 0X17, 0X18, 0X19, 0X19, 0X1A,
-  0X1B, 0X1C, 0X1C, 0X1D, 0X1D, 0X1E, 0X1E, 0X1F, 0X1F, 0X20, 0X20, 0X20,
-  0X20, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
-  0X21, 0X21, 0X21, 0X20, 0X20, 0X20, 0X20, 0X1F, 0X1F, 0X1E, 0X1E, 0X1D,
-  0X1D, 0X1C, 0X1C, 0X1B, 0X1A, 0X19, 0X19, 0X18, 0X17, 0X16, 0X14, 0X13,
-  0X12, 0X11, 0X0F, 0X0E, 0X0C, 0X0B, 0X09, 0X07, 0X05, 0X03, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X04, 0X06, 0X08, 0X0A, 0X0C, 0X0E, 0X0F, 0X11, 0X13, 0X14, 0X15,
-  0X16, 0X17, 0X19, 0X1A, 0X1B, 0X1B, 0X1C, 0X1D, 0X1E, 0X1E, 0X1F, 0X20,
-  0X20, 0X21, 0X21, 0X22, 0X22, 0X22, 0X23, 0X23, 0X23, 0X24, 0X24, 0X24,
-  0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X23,
-  0X23, 0X23, 0X22, 0X22, 0X22, 0X21, 0X21, 0X20, 0X20, 0X1F, 0X1E, 0X1E,
-  0X1D, 0X1C, 0X1B, 0X1B, 0X1A, 0X19, 0X17, 0X16, 0X15, 0X14, 0X13, 0X11,
-  0X0F, 0X0E, 0X0C, 0X0A, 0X08, 0X06, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X07, 0X09, 0X0C,
-  0X0E, 0X0F, 0X11, 0X13, 0X14, 0X16, 0X17, 0X18, 0X19, 0X1B, 0X1C, 0X1D,
-  0X1D, 0X1E, 0X1F, 0X20, 0X21, 0X21, 0X22, 0X23, 0X23, 0X24, 0X24, 0X24,
-  0X25, 0X25, 0X26, 0X26, 0X26, 0X26, 0X26, 0X27, 0X27, 0X27, 0X27, 0X27,
-  0X27, 0X27, 0X27, 0X27, 0X27, 0X26, 0X26, 0X26, 0X26, 0X26, 0X25, 0X25,
-  0X24, 0X24, 0X24, 0X23, 0X23, 0X22, 0X21, 0X21, 0X20, 0X1F, 0X1E, 0X1D,
-  0X1D, 0X1C, 0X1B, 0X19, 0X18, 0X17, 0X16, 0X14, 0X13, 0X11, 0X0F, 0X0E,
-  0X0C, 0X09, 0X07, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X06, 0X08, 0X0B, 0X0D, 0X0F, 0X11, 0X13, 0X14, 0X16,
-  0X17, 0X19, 0X1A, 0X1B, 0X1C, 0X1E, 0X1F, 0X20, 0X20, 0X21, 0X22, 0X23,
-  0X24, 0X24, 0X25, 0X25, 0X26, 0X26, 0X27, 0X27, 0X28, 0X28, 0X28, 0X29,
-  0X29, 0X29, 0X29, 0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2A, 0X2A, 0X2A, 0X29,
-  0X29, 0X29, 0X29, 0X29, 0X29, 0X28, 0X28, 0X28, 0X27, 0X27, 0X26, 0X26,
-  0X25, 0X25, 0X24, 0X24, 0X23, 0X22, 0X21, 0X20, 0X20, 0X1F, 0X1E, 0X1C,
-  0X1B, 0X1A, 0X19, 0X17, 0X16, 0X14, 0X13, 0X11, 0X0F, 0X0D, 0X0B, 0X08,
-  0X06, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X07, 0X09,
-  0X0C, 0X0E, 0X10, 0X12, 0X14, 0X16, 0X18, 0X19, 0X1B, 0X1C, 0X1D, 0X1E,
-  0X20, 0X21, 0X22, 0X23, 0X23, 0X24, 0X25, 0X26, 0X26, 0X27, 0X28, 0X28,
-  0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2B, 0X2B, 0X2B, 0X2C, 0X2C, 0X2C, 0X2C,
-  0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C,
-  0X2B, 0X2B, 0X2B, 0X2A, 0X2A, 0X2A, 0X29, 0X29, 0X28, 0X28, 0X27, 0X26,
-  0X26, 0X25, 0X24, 0X23, 0X23, 0X22, 0X21, 0X20, 0X1E, 0X1D, 0X1C, 0X1B,
-  0X19, 0X18, 0X16, 0X14, 0X12, 0X10, 0X0E, 0X0C, 0X09, 0X07, 0X04, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X05, 0X08, 0X0A, 0X0D, 0X0F, 0X12, 0X14, 0X16,
-  0X17, 0X19, 0X1B, 0X1C, 0X1E, 0X1F, 0X20, 0X21, 0X23, 0X24, 0X25, 0X26,
-  0X26, 0X27, 0X28, 0X29, 0X29, 0X2A, 0X2B, 0X2B, 0X2C, 0X2C, 0X2D, 0X2D,
-  0X2D, 0X2E, 0X2E, 0X2E, 0X2E, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F,
-  0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2E, 0X2E, 0X2E, 0X2E, 0X2D,
-  0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2B, 0X2A, 0X29, 0X29, 0X28, 0X27, 0X26,
-  0X26, 0X25, 0X24, 0X23, 0X21, 0X20, 0X1F, 0X1E, 0X1C, 0X1B, 0X19, 0X17,
-  0X16, 0X14, 0X12, 0X0F, 0X0D, 0X0A, 0X08, 0X05, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05,
-  0X08, 0X0B, 0X0E, 0X10, 0X13, 0X15, 0X17, 0X19, 0X1B, 0X1C, 0X1E, 0X1F,
-  0X21, 0X22, 0X23, 0X25, 0X26, 0X27, 0X28, 0X29, 0X29, 0X2A, 0X2B, 0X2C,
-  0X2C, 0X2D, 0X2D, 0X2E, 0X2E, 0X2F, 0X2F, 0X30, 0X30, 0X30, 0X31, 0X31,
-  0X31, 0X31, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32,
-  0X32, 0X32, 0X31, 0X31, 0X31, 0X31, 0X30, 0X30, 0X30, 0X2F, 0X2F, 0X2E,
-  0X2E, 0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X29, 0X28, 0X27, 0X26,
-  0X25, 0X23, 0X22, 0X21, 0X1F, 0X1E, 0X1C, 0X1B, 0X19, 0X17, 0X15, 0X13,
-  0X10, 0X0E, 0X0B, 0X08, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X09, 0X0C, 0X0F, 0X12, 0X14,
-  0X16, 0X18, 0X1A, 0X1C, 0X1E, 0X20, 0X21, 0X23, 0X24, 0X25, 0X26, 0X28,
-  0X29, 0X2A, 0X2B, 0X2B, 0X2C, 0X2D, 0X2E, 0X2F, 0X2F, 0X30, 0X30, 0X31,
-  0X31, 0X32, 0X32, 0X33, 0X33, 0X33, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34,
-  0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X34, 0X34, 0X34, 0X34,
-  0X34, 0X34, 0X33, 0X33, 0X33, 0X32, 0X32, 0X31, 0X31, 0X30, 0X30, 0X2F,
-  0X2F, 0X2E, 0X2D, 0X2C, 0X2B, 0X2B, 0X2A, 0X29, 0X28, 0X26, 0X25, 0X24,
-  0X23, 0X21, 0X20, 0X1E, 0X1C, 0X1A, 0X18, 0X16, 0X14, 0X12, 0X0F, 0X0C,
-  0X09, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X06, 0X09, 0X0D, 0X10, 0X13, 0X15, 0X18, 0X1A, 0X1C, 0X1E, 0X20,
-  0X21, 0X23, 0X24, 0X26, 0X27, 0X28, 0X2A, 0X2B, 0X2C, 0X2D, 0X2E, 0X2E,
-  0X2F, 0X30, 0X31, 0X31, 0X32, 0X33, 0X33, 0X34, 0X34, 0X35, 0X35, 0X35,
-  0X36, 0X36, 0X36, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37,
-  0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X36, 0X36, 0X36,
-  0X35, 0X35, 0X35, 0X34, 0X34, 0X33, 0X33, 0X32, 0X31, 0X31, 0X30, 0X2F,
-  0X2E, 0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X28, 0X27, 0X26, 0X24, 0X23, 0X21,
-  0X20, 0X1E, 0X1C, 0X1A, 0X18, 0X15, 0X13, 0X10, 0X0D, 0X09, 0X06, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0A, 0X0D, 0X10,
-  0X13, 0X16, 0X19, 0X1B, 0X1D, 0X1F, 0X21, 0X23, 0X25, 0X26, 0X28, 0X29,
-  0X2A, 0X2C, 0X2D, 0X2E, 0X2F, 0X30, 0X31, 0X31, 0X32, 0X33, 0X34, 0X34,
-  0X35, 0X36, 0X36, 0X37, 0X37, 0X37, 0X38, 0X38, 0X39, 0X39, 0X39, 0X39,
-  0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A,
-  0X3A, 0X3A, 0X3A, 0X3A, 0X39, 0X39, 0X39, 0X39, 0X38, 0X38, 0X37, 0X37,
-  0X37, 0X36, 0X36, 0X35, 0X34, 0X34, 0X33, 0X32, 0X31, 0X31, 0X30, 0X2F,
-  0X2E, 0X2D, 0X2C, 0X2A, 0X29, 0X28, 0X26, 0X25, 0X23, 0X21, 0X1F, 0X1D,
-  0X1B, 0X19, 0X16, 0X13, 0X10, 0X0D, 0X0A, 0X06, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X05, 0X0A, 0X0E, 0X11, 0X14, 0X17, 0X1A, 0X1C, 0X1F,
-  0X21, 0X23, 0X25, 0X26, 0X28, 0X29, 0X2B, 0X2C, 0X2D, 0X2F, 0X30, 0X31,
-  0X32, 0X33, 0X34, 0X34, 0X35, 0X36, 0X37, 0X37, 0X38, 0X38, 0X39, 0X39,
-  0X3A, 0X3A, 0X3B, 0X3B, 0X3B, 0X3C, 0X3C, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3C,
-  0X3C, 0X3C, 0X3C, 0X3B, 0X3B, 0X3B, 0X3A, 0X3A, 0X39, 0X39, 0X38, 0X38,
-  0X37, 0X37, 0X36, 0X35, 0X34, 0X34, 0X33, 0X32, 0X31, 0X30, 0X2F, 0X2D,
-  0X2C, 0X2B, 0X29, 0X28, 0X26, 0X25, 0X23, 0X21, 0X1F, 0X1C, 0X1A, 0X17,
-  0X14, 0X11, 0X0E, 0X0A, 0X05, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0A,
-  0X0E, 0X12, 0X15, 0X18, 0X1B, 0X1D, 0X20, 0X22, 0X24, 0X26, 0X28, 0X2A,
-  0X2B, 0X2D, 0X2E, 0X2F, 0X31, 0X32, 0X33, 0X34, 0X35, 0X36, 0X37, 0X37,
-  0X38, 0X39, 0X3A, 0X3A, 0X3B, 0X3B, 0X3C, 0X3C, 0X3D, 0X3D, 0X3E, 0X3E,
-  0X3E, 0X3E, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X40, 0X40, 0X40, 0X40, 0X40,
-  0X40, 0X40, 0X40, 0X40, 0X40, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3E, 0X3E,
-  0X3E, 0X3E, 0X3D, 0X3D, 0X3C, 0X3C, 0X3B, 0X3B, 0X3A, 0X3A, 0X39, 0X38,
-  0X37, 0X37, 0X36, 0X35, 0X34, 0X33, 0X32, 0X31, 0X2F, 0X2E, 0X2D, 0X2B,
-  0X2A, 0X28, 0X26, 0X24, 0X22, 0X20, 0X1D, 0X1B, 0X18, 0X15, 0X12, 0X0E,
-  0X0A, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0E, 0X12, 0X16, 0X19, 0X1C,
-  0X1F, 0X21, 0X24, 0X26, 0X28, 0X2A, 0X2B, 0X2D, 0X2F, 0X30, 0X31, 0X33,
-  0X34, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A, 0X3A, 0X3B, 0X3C, 0X3C, 0X3D,
-  0X3E, 0X3E, 0X3F, 0X3F, 0X40, 0X40, 0X40, 0X41, 0X41, 0X41, 0X42, 0X42,
-  0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X43, 0X43, 0X42, 0X42, 0X42,
-  0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X41, 0X41, 0X41, 0X40, 0X40, 0X40,
-  0X3F, 0X3F, 0X3E, 0X3E, 0X3D, 0X3C, 0X3C, 0X3B, 0X3A, 0X3A, 0X39, 0X38,
-  0X37, 0X36, 0X35, 0X34, 0X33, 0X31, 0X30, 0X2F, 0X2D, 0X2B, 0X2A, 0X28,
-  0X26, 0X24, 0X21, 0X1F, 0X1C, 0X19, 0X16, 0X12, 0X0E, 0X09, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X09, 0X0E, 0X12, 0X16, 0X1A, 0X1D, 0X20, 0X22, 0X25, 0X27, 0X29,
-  0X2B, 0X2D, 0X2F, 0X30, 0X32, 0X33, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A,
-  0X3B, 0X3C, 0X3D, 0X3D, 0X3E, 0X3F, 0X3F, 0X40, 0X41, 0X41, 0X42, 0X42,
-  0X42, 0X43, 0X43, 0X43, 0X44, 0X44, 0X44, 0X44, 0X45, 0X45, 0X45, 0X45,
-  0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45,
-  0X44, 0X44, 0X44, 0X44, 0X43, 0X43, 0X43, 0X42, 0X42, 0X42, 0X41, 0X41,
-  0X40, 0X3F, 0X3F, 0X3E, 0X3D, 0X3D, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37,
-  0X36, 0X35, 0X33, 0X32, 0X30, 0X2F, 0X2D, 0X2B, 0X29, 0X27, 0X25, 0X22,
-  0X20, 0X1D, 0X1A, 0X16, 0X12, 0X0E, 0X09, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X08, 0X0D, 0X12, 0X16,
-  0X1A, 0X1D, 0X21, 0X23, 0X26, 0X28, 0X2B, 0X2D, 0X2F, 0X30, 0X32, 0X34,
-  0X35, 0X37, 0X38, 0X39, 0X3A, 0X3B, 0X3C, 0X3D, 0X3E, 0X3F, 0X40, 0X40,
-  0X41, 0X42, 0X42, 0X43, 0X43, 0X44, 0X44, 0X45, 0X45, 0X46, 0X46, 0X46,
-  0X47, 0X47, 0X47, 0X47, 0X47, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48,
-  0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X47, 0X47, 0X47, 0X47, 0X47,
-  0X46, 0X46, 0X46, 0X45, 0X45, 0X44, 0X44, 0X43, 0X43, 0X42, 0X42, 0X41,
-  0X40, 0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X35,
-  0X34, 0X32, 0X30, 0X2F, 0X2D, 0X2B, 0X28, 0X26, 0X23, 0X21, 0X1D, 0X1A,
-  0X16, 0X12, 0X0D, 0X08, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X07, 0X0D, 0X12, 0X16, 0X1A, 0X1E, 0X21, 0X25, 0X27,
-  0X2A, 0X2C, 0X2E, 0X30, 0X32, 0X34, 0X36, 0X37, 0X38, 0X3A, 0X3B, 0X3C,
-  0X3D, 0X3E, 0X3F, 0X40, 0X41, 0X42, 0X43, 0X43, 0X44, 0X45, 0X45, 0X46,
-  0X46, 0X47, 0X47, 0X48, 0X48, 0X48, 0X49, 0X49, 0X49, 0X4A, 0X4A, 0X4A,
-  0X4A, 0X4A, 0X4A, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B,
-  0X4B, 0X4A, 0X4A, 0X4A, 0X4A, 0X4A, 0X4A, 0X49, 0X49, 0X49, 0X48, 0X48,
-  0X48, 0X47, 0X47, 0X46, 0X46, 0X45, 0X45, 0X44, 0X43, 0X43, 0X42, 0X41,
-  0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B, 0X3A, 0X38, 0X37, 0X36, 0X34, 0X32,
-  0X30, 0X2E, 0X2C, 0X2A, 0X27, 0X25, 0X21, 0X1E, 0X1A, 0X16, 0X12, 0X0D,
-  0X07, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0C,
-  0X11, 0X16, 0X1B, 0X1F, 0X22, 0X25, 0X28, 0X2B, 0X2E, 0X30, 0X32, 0X34,
-  0X36, 0X37, 0X39, 0X3A, 0X3C, 0X3D, 0X3E, 0X3F, 0X40, 0X41, 0X42, 0X43,
-  0X44, 0X45, 0X46, 0X46, 0X47, 0X48, 0X48, 0X49, 0X49, 0X4A, 0X4A, 0X4A,
-  0X4B, 0X4B, 0X4C, 0X4C, 0X4C, 0X4C, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D,
-  0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D,
-  0X4D, 0X4D, 0X4C, 0X4C, 0X4C, 0X4C, 0X4B, 0X4B, 0X4A, 0X4A, 0X4A, 0X49,
-  0X49, 0X48, 0X48, 0X47, 0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40,
-  0X3F, 0X3E, 0X3D, 0X3C, 0X3A, 0X39, 0X37, 0X36, 0X34, 0X32, 0X30, 0X2E,
-  0X2B, 0X28, 0X25, 0X22, 0X1F, 0X1B, 0X16, 0X11, 0X0C, 0X05, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0A, 0X10, 0X16, 0X1B, 0X1F, 0X23,
-  0X26, 0X29, 0X2C, 0X2F, 0X31, 0X33, 0X36, 0X37, 0X39, 0X3B, 0X3C, 0X3E,
-  0X3F, 0X40, 0X42, 0X43, 0X44, 0X45, 0X46, 0X46, 0X47, 0X48, 0X49, 0X49,
-  0X4A, 0X4A, 0X4B, 0X4C, 0X4C, 0X4D, 0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4F,
-  0X4F, 0X4F, 0X4F, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50,
-  0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X4F, 0X4F, 0X4F,
-  0X4F, 0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A, 0X4A,
-  0X49, 0X49, 0X48, 0X47, 0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X40, 0X3F,
-  0X3E, 0X3C, 0X3B, 0X39, 0X37, 0X36, 0X33, 0X31, 0X2F, 0X2C, 0X29, 0X26,
-  0X23, 0X1F, 0X1B, 0X16, 0X10, 0X0A, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X08, 0X0F, 0X15, 0X1A, 0X1F, 0X23, 0X27, 0X2A, 0X2D, 0X30, 0X33,
-  0X35, 0X37, 0X39, 0X3B, 0X3D, 0X3E, 0X40, 0X41, 0X42, 0X44, 0X45, 0X46,
-  0X47, 0X48, 0X49, 0X49, 0X4A, 0X4B, 0X4C, 0X4C, 0X4D, 0X4D, 0X4E, 0X4F,
-  0X4F, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X51, 0X52, 0X52, 0X52, 0X52, 0X52,
-  0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53,
-  0X53, 0X53, 0X53, 0X53, 0X52, 0X52, 0X52, 0X52, 0X52, 0X51, 0X51, 0X51,
-  0X50, 0X50, 0X4F, 0X4F, 0X4F, 0X4E, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A,
-  0X49, 0X49, 0X48, 0X47, 0X46, 0X45, 0X44, 0X42, 0X41, 0X40, 0X3E, 0X3D,
-  0X3B, 0X39, 0X37, 0X35, 0X33, 0X30, 0X2D, 0X2A, 0X27, 0X23, 0X1F, 0X1A,
-  0X15, 0X0F, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0D, 0X14, 0X1A,
-  0X1F, 0X24, 0X28, 0X2B, 0X2E, 0X31, 0X34, 0X36, 0X39, 0X3B, 0X3D, 0X3E,
-  0X40, 0X42, 0X43, 0X44, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4B, 0X4C, 0X4C,
-  0X4D, 0X4E, 0X4F, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X52, 0X52, 0X53, 0X53,
-  0X53, 0X54, 0X54, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55, 0X56, 0X56, 0X56,
-  0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X55,
-  0X55, 0X55, 0X55, 0X55, 0X54, 0X54, 0X54, 0X53, 0X53, 0X53, 0X52, 0X52,
-  0X51, 0X51, 0X50, 0X50, 0X4F, 0X4F, 0X4E, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A,
-  0X49, 0X48, 0X47, 0X46, 0X44, 0X43, 0X42, 0X40, 0X3E, 0X3D, 0X3B, 0X39,
-  0X36, 0X34, 0X31, 0X2E, 0X2B, 0X28, 0X24, 0X1F, 0X1A, 0X14, 0X0D, 0X05,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X0B, 0X13, 0X19, 0X1F, 0X24, 0X28, 0X2C, 0X2F,
-  0X33, 0X35, 0X38, 0X3A, 0X3C, 0X3E, 0X40, 0X42, 0X44, 0X45, 0X46, 0X48,
-  0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F, 0X50, 0X50, 0X51, 0X52, 0X52,
-  0X53, 0X53, 0X54, 0X54, 0X55, 0X55, 0X56, 0X56, 0X56, 0X57, 0X57, 0X57,
-  0X57, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X59, 0X59, 0X59,
-  0X59, 0X59, 0X59, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X57,
-  0X57, 0X57, 0X57, 0X56, 0X56, 0X56, 0X55, 0X55, 0X54, 0X54, 0X53, 0X53,
-  0X52, 0X52, 0X51, 0X50, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49,
-  0X48, 0X46, 0X45, 0X44, 0X42, 0X40, 0X3E, 0X3C, 0X3A, 0X38, 0X35, 0X33,
-  0X2F, 0X2C, 0X28, 0X24, 0X1F, 0X19, 0X13, 0X0B, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08,
-  0X10, 0X18, 0X1E, 0X23, 0X28, 0X2C, 0X30, 0X34, 0X37, 0X39, 0X3C, 0X3E,
-  0X40, 0X42, 0X44, 0X46, 0X47, 0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F,
-  0X50, 0X51, 0X52, 0X53, 0X53, 0X54, 0X55, 0X55, 0X56, 0X56, 0X57, 0X57,
-  0X58, 0X58, 0X58, 0X59, 0X59, 0X59, 0X5A, 0X5A, 0X5A, 0X5A, 0X5B, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X59, 0X59,
-  0X59, 0X58, 0X58, 0X58, 0X57, 0X57, 0X56, 0X56, 0X55, 0X55, 0X54, 0X53,
-  0X53, 0X52, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49, 0X47,
-  0X46, 0X44, 0X42, 0X40, 0X3E, 0X3C, 0X39, 0X37, 0X34, 0X30, 0X2C, 0X28,
-  0X23, 0X1E, 0X18, 0X10, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0D, 0X16, 0X1D, 0X23, 0X28,
-  0X2D, 0X31, 0X35, 0X38, 0X3B, 0X3D, 0X40, 0X42, 0X44, 0X46, 0X48, 0X49,
-  0X4B, 0X4C, 0X4D, 0X4E, 0X50, 0X51, 0X52, 0X52, 0X53, 0X54, 0X55, 0X56,
-  0X56, 0X57, 0X58, 0X58, 0X59, 0X59, 0X5A, 0X5A, 0X5B, 0X5B, 0X5B, 0X5C,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C, 0X5C, 0X5B, 0X5B, 0X5B,
-  0X5A, 0X5A, 0X59, 0X59, 0X58, 0X58, 0X57, 0X56, 0X56, 0X55, 0X54, 0X53,
-  0X52, 0X52, 0X51, 0X50, 0X4E, 0X4D, 0X4C, 0X4B, 0X49, 0X48, 0X46, 0X44,
-  0X42, 0X40, 0X3D, 0X3B, 0X38, 0X35, 0X31, 0X2D, 0X28, 0X23, 0X1D, 0X16,
-  0X0D, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X09, 0X13, 0X1B, 0X22, 0X28, 0X2D, 0X31, 0X35, 0X39, 0X3C,
-  0X3F, 0X41, 0X44, 0X46, 0X48, 0X49, 0X4B, 0X4D, 0X4E, 0X4F, 0X51, 0X52,
-  0X53, 0X54, 0X55, 0X56, 0X57, 0X57, 0X58, 0X59, 0X59, 0X5A, 0X5B, 0X5B,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5F, 0X5F, 0X5F, 0X5F, 0X60,
-  0X60, 0X60, 0X60, 0X60, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61,
-  0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X60,
-  0X60, 0X5F, 0X5F, 0X5F, 0X5F, 0X5E, 0X5E, 0X5E, 0X5D, 0X5D, 0X5C, 0X5C,
-  0X5B, 0X5B, 0X5A, 0X59, 0X59, 0X58, 0X57, 0X57, 0X56, 0X55, 0X54, 0X53,
-  0X52, 0X51, 0X4F, 0X4E, 0X4D, 0X4B, 0X49, 0X48, 0X46, 0X44, 0X41, 0X3F,
-  0X3C, 0X39, 0X35, 0X31, 0X2D, 0X28, 0X22, 0X1B, 0X13, 0X09, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F, 0X19,
-  0X21, 0X27, 0X2D, 0X32, 0X36, 0X3A, 0X3D, 0X40, 0X43, 0X45, 0X47, 0X49,
-  0X4B, 0X4D, 0X4F, 0X50, 0X51, 0X53, 0X54, 0X55, 0X56, 0X57, 0X58, 0X59,
-  0X5A, 0X5B, 0X5B, 0X5C, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F, 0X5F, 0X60, 0X60,
-  0X60, 0X61, 0X61, 0X61, 0X62, 0X62, 0X62, 0X62, 0X63, 0X63, 0X63, 0X63,
-  0X63, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64,
-  0X64, 0X63, 0X63, 0X63, 0X63, 0X63, 0X63, 0X63, 0X62, 0X62, 0X62, 0X62,
-  0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X5F, 0X5F, 0X5E, 0X5E, 0X5D, 0X5C,
-  0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58, 0X57, 0X56, 0X55, 0X54, 0X53, 0X51,
-  0X50, 0X4F, 0X4D, 0X4B, 0X49, 0X47, 0X45, 0X43, 0X40, 0X3D, 0X3A, 0X36,
-  0X32, 0X2D, 0X27, 0X21, 0X19, 0X0F, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X15, 0X1F, 0X26, 0X2C, 0X32, 0X36,
-  0X3B, 0X3E, 0X41, 0X44, 0X47, 0X49, 0X4B, 0X4D, 0X4F, 0X51, 0X52, 0X54,
-  0X55, 0X56, 0X57, 0X59, 0X59, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F,
-  0X60, 0X60, 0X61, 0X61, 0X62, 0X62, 0X63, 0X63, 0X63, 0X64, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66,
-  0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66,
-  0X66, 0X66, 0X66, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64, 0X64, 0X63,
-  0X63, 0X63, 0X62, 0X62, 0X61, 0X61, 0X60, 0X60, 0X5F, 0X5E, 0X5E, 0X5D,
-  0X5C, 0X5B, 0X5A, 0X59, 0X59, 0X57, 0X56, 0X55, 0X54, 0X52, 0X51, 0X4F,
-  0X4D, 0X4B, 0X49, 0X47, 0X44, 0X41, 0X3E, 0X3B, 0X36, 0X32, 0X2C, 0X26,
-  0X1F, 0X15, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X10, 0X1B, 0X24, 0X2C, 0X32, 0X37, 0X3B, 0X3F, 0X43, 0X46, 0X48,
-  0X4B, 0X4D, 0X4F, 0X51, 0X53, 0X54, 0X56, 0X57, 0X58, 0X5A, 0X5B, 0X5C,
-  0X5D, 0X5E, 0X5E, 0X5F, 0X60, 0X61, 0X61, 0X62, 0X63, 0X63, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X66, 0X66, 0X67, 0X67, 0X67, 0X67, 0X68, 0X68, 0X68,
-  0X68, 0X68, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69,
-  0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X68, 0X68,
-  0X68, 0X68, 0X68, 0X67, 0X67, 0X67, 0X67, 0X66, 0X66, 0X65, 0X65, 0X65,
-  0X64, 0X64, 0X63, 0X63, 0X62, 0X61, 0X61, 0X60, 0X5F, 0X5E, 0X5E, 0X5D,
-  0X5C, 0X5B, 0X5A, 0X58, 0X57, 0X56, 0X54, 0X53, 0X51, 0X4F, 0X4D, 0X4B,
-  0X48, 0X46, 0X43, 0X3F, 0X3B, 0X37, 0X32, 0X2C, 0X24, 0X1B, 0X10, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X17, 0X21, 0X2A,
-  0X31, 0X37, 0X3C, 0X40, 0X44, 0X47, 0X4A, 0X4D, 0X4F, 0X51, 0X53, 0X55,
-  0X57, 0X58, 0X59, 0X5B, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X62,
-  0X63, 0X64, 0X65, 0X65, 0X66, 0X66, 0X67, 0X67, 0X68, 0X68, 0X68, 0X69,
-  0X69, 0X69, 0X6A, 0X6A, 0X6A, 0X6A, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A,
-  0X6A, 0X6A, 0X69, 0X69, 0X69, 0X68, 0X68, 0X68, 0X67, 0X67, 0X66, 0X66,
-  0X65, 0X65, 0X64, 0X63, 0X62, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5C,
-  0X5B, 0X59, 0X58, 0X57, 0X55, 0X53, 0X51, 0X4F, 0X4D, 0X4A, 0X47, 0X44,
-  0X40, 0X3C, 0X37, 0X31, 0X2A, 0X21, 0X17, 0X08, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X10, 0X1D, 0X28, 0X30, 0X36, 0X3C, 0X41, 0X45,
-  0X48, 0X4B, 0X4E, 0X51, 0X53, 0X55, 0X57, 0X59, 0X5A, 0X5C, 0X5D, 0X5E,
-  0X5F, 0X60, 0X62, 0X63, 0X63, 0X64, 0X65, 0X66, 0X66, 0X67, 0X68, 0X68,
-  0X69, 0X69, 0X6A, 0X6A, 0X6B, 0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6D, 0X6D,
-  0X6D, 0X6D, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F,
-  0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6E,
-  0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X69, 0X68, 0X68, 0X67, 0X66,
-  0X66, 0X65, 0X64, 0X63, 0X63, 0X62, 0X60, 0X5F, 0X5E, 0X5D, 0X5C, 0X5A,
-  0X59, 0X57, 0X55, 0X53, 0X51, 0X4E, 0X4B, 0X48, 0X45, 0X41, 0X3C, 0X36,
-  0X30, 0X28, 0X1D, 0X10, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05,
-  0X17, 0X24, 0X2E, 0X36, 0X3C, 0X41, 0X46, 0X49, 0X4D, 0X50, 0X53, 0X55,
-  0X57, 0X59, 0X5B, 0X5C, 0X5E, 0X5F, 0X61, 0X62, 0X63, 0X64, 0X65, 0X66,
-  0X67, 0X67, 0X68, 0X69, 0X6A, 0X6A, 0X6B, 0X6B, 0X6C, 0X6C, 0X6D, 0X6D,
-  0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F, 0X6F, 0X70, 0X70, 0X70, 0X70, 0X71,
-  0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X72, 0X72,
-  0X72, 0X72, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71,
-  0X71, 0X70, 0X70, 0X70, 0X70, 0X6F, 0X6F, 0X6F, 0X6F, 0X6E, 0X6E, 0X6E,
-  0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X68, 0X67, 0X67,
-  0X66, 0X65, 0X64, 0X63, 0X62, 0X61, 0X5F, 0X5E, 0X5C, 0X5B, 0X59, 0X57,
-  0X55, 0X53, 0X50, 0X4D, 0X49, 0X46, 0X41, 0X3C, 0X36, 0X2E, 0X24, 0X17,
-  0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0D, 0X1E, 0X2B, 0X34, 0X3B,
-  0X41, 0X46, 0X4B, 0X4E, 0X51, 0X54, 0X57, 0X59, 0X5B, 0X5D, 0X5F, 0X60,
-  0X62, 0X63, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A, 0X6B, 0X6B, 0X6C,
-  0X6D, 0X6D, 0X6E, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X71, 0X71, 0X71, 0X72,
-  0X72, 0X72, 0X72, 0X73, 0X73, 0X73, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74,
-  0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74,
-  0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X73, 0X73,
-  0X73, 0X72, 0X72, 0X72, 0X72, 0X71, 0X71, 0X71, 0X70, 0X70, 0X6F, 0X6F,
-  0X6E, 0X6E, 0X6D, 0X6D, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X66,
-  0X65, 0X64, 0X63, 0X62, 0X60, 0X5F, 0X5D, 0X5B, 0X59, 0X57, 0X54, 0X51,
-  0X4E, 0X4B, 0X46, 0X41, 0X3B, 0X34, 0X2B, 0X1E, 0X0D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X15, 0X26, 0X31, 0X3A, 0X41, 0X47, 0X4B, 0X4F, 0X53,
-  0X56, 0X59, 0X5B, 0X5D, 0X5F, 0X61, 0X63, 0X64, 0X65, 0X67, 0X68, 0X69,
-  0X6A, 0X6B, 0X6C, 0X6D, 0X6D, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X71, 0X71,
-  0X72, 0X72, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X75, 0X75,
-  0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X77, 0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X75, 0X75, 0X75, 0X75,
-  0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X72, 0X72, 0X71, 0X71, 0X70, 0X70,
-  0X6F, 0X6F, 0X6E, 0X6D, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X65,
-  0X64, 0X63, 0X61, 0X5F, 0X5D, 0X5B, 0X59, 0X56, 0X53, 0X4F, 0X4B, 0X47,
-  0X41, 0X3A, 0X31, 0X26, 0X15, 0X01, 0X00, 0X00, 0X00, 0X00, 0X05, 0X1D,
-  0X2D, 0X38, 0X40, 0X47, 0X4C, 0X51, 0X54, 0X58, 0X5B, 0X5D, 0X5F, 0X61,
-  0X63, 0X65, 0X67, 0X68, 0X69, 0X6A, 0X6B, 0X6C, 0X6D, 0X6E, 0X6F, 0X70,
-  0X71, 0X71, 0X72, 0X72, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X76, 0X76,
-  0X76, 0X77, 0X77, 0X77, 0X78, 0X78, 0X78, 0X78, 0X78, 0X79, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X79, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A,
-  0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X78, 0X78, 0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X76,
-  0X76, 0X76, 0X75, 0X75, 0X74, 0X74, 0X74, 0X73, 0X72, 0X72, 0X71, 0X71,
-  0X70, 0X6F, 0X6E, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X65, 0X63,
-  0X61, 0X5F, 0X5D, 0X5B, 0X58, 0X54, 0X51, 0X4C, 0X47, 0X40, 0X38, 0X2D,
-  0X1D, 0X05, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X26, 0X34, 0X3E, 0X46, 0X4C,
-  0X51, 0X56, 0X59, 0X5C, 0X5F, 0X62, 0X64, 0X66, 0X67, 0X69, 0X6A, 0X6C,
-  0X6D, 0X6E, 0X6F, 0X70, 0X71, 0X72, 0X72, 0X73, 0X74, 0X75, 0X75, 0X76,
-  0X76, 0X77, 0X77, 0X78, 0X78, 0X78, 0X79, 0X79, 0X79, 0X7A, 0X7A, 0X7A,
-  0X7B, 0X7B, 0X7B, 0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7B,
-  0X7B, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X78, 0X78,
-  0X78, 0X77, 0X77, 0X76, 0X76, 0X75, 0X75, 0X74, 0X73, 0X72, 0X72, 0X71,
-  0X70, 0X6F, 0X6E, 0X6D, 0X6C, 0X6A, 0X69, 0X67, 0X66, 0X64, 0X62, 0X5F,
-  0X5C, 0X59, 0X56, 0X51, 0X4C, 0X46, 0X3E, 0X34, 0X26, 0X0F, 0X00, 0X00,
-  0X00, 0X01, 0X19, 0X2E, 0X3B, 0X45, 0X4C, 0X52, 0X57, 0X5B, 0X5E, 0X61,
-  0X64, 0X66, 0X68, 0X6A, 0X6B, 0X6D, 0X6E, 0X6F, 0X71, 0X72, 0X73, 0X74,
-  0X74, 0X75, 0X76, 0X77, 0X77, 0X78, 0X78, 0X79, 0X79, 0X7A, 0X7A, 0X7B,
-  0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7E, 0X7E, 0X7E,
-  0X7E, 0X7E, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7E, 0X7E, 0X7D,
-  0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X79,
-  0X79, 0X78, 0X78, 0X77, 0X77, 0X76, 0X75, 0X74, 0X74, 0X73, 0X72, 0X71,
-  0X6F, 0X6E, 0X6D, 0X6B, 0X6A, 0X68, 0X66, 0X64, 0X61, 0X5E, 0X5B, 0X57,
-  0X52, 0X4C, 0X45, 0X3B, 0X2E, 0X19, 0X01, 0X00, 0X00, 0X02, 0X22, 0X36,
-  0X43, 0X4C, 0X52, 0X58, 0X5C, 0X60, 0X63, 0X66, 0X68, 0X6A, 0X6C, 0X6E,
-  0X6F, 0X71, 0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X79, 0X7A,
-  0X7B, 0X7B, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7E, 0X7E, 0X7E, 0X7F, 0X7F,
-  0X7F, 0X80, 0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X80, 0X80, 0X80, 0X80, 0X7F,
-  0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7B, 0X7B,
-  0X7A, 0X79, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X73, 0X72, 0X71, 0X6F,
-  0X6E, 0X6C, 0X6A, 0X68, 0X66, 0X63, 0X60, 0X5C, 0X58, 0X52, 0X4C, 0X43,
-  0X36, 0X22, 0X02, 0X00, 0X00, 0X09, 0X2C, 0X3E, 0X4A, 0X52, 0X59, 0X5E,
-  0X62, 0X65, 0X68, 0X6A, 0X6D, 0X6F, 0X71, 0X72, 0X74, 0X75, 0X76, 0X77,
-  0X78, 0X79, 0X7A, 0X7B, 0X7B, 0X7C, 0X7D, 0X7D, 0X7E, 0X7E, 0X7F, 0X7F,
-  0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X83,
-  0X83, 0X83, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84,
-  0X84, 0X84, 0X83, 0X83, 0X83, 0X83, 0X83, 0X82, 0X82, 0X82, 0X81, 0X81,
-  0X81, 0X80, 0X80, 0X80, 0X7F, 0X7F, 0X7E, 0X7E, 0X7D, 0X7D, 0X7C, 0X7B,
-  0X7B, 0X7A, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X72, 0X71, 0X6F, 0X6D,
-  0X6A, 0X68, 0X65, 0X62, 0X5E, 0X59, 0X52, 0X4A, 0X3E, 0X2C, 0X09, 0X00,
-  0X00, 0X16, 0X35, 0X46, 0X51, 0X59, 0X5F, 0X63, 0X67, 0X6A, 0X6D, 0X6F,
-  0X71, 0X73, 0X75, 0X76, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7D, 0X7D, 0X7E,
-  0X7F, 0X7F, 0X80, 0X81, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X84, 0X84,
-  0X84, 0X85, 0X85, 0X85, 0X85, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86,
-  0X86, 0X86, 0X86, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X83, 0X83,
-  0X82, 0X82, 0X82, 0X81, 0X81, 0X80, 0X7F, 0X7F, 0X7E, 0X7D, 0X7D, 0X7C,
-  0X7B, 0X7A, 0X79, 0X78, 0X76, 0X75, 0X73, 0X71, 0X6F, 0X6D, 0X6A, 0X67,
-  0X63, 0X5F, 0X59, 0X51, 0X46, 0X35, 0X16, 0X00, 0X00, 0X22, 0X3F, 0X4E,
-  0X58, 0X5F, 0X65, 0X69, 0X6D, 0X6F, 0X72, 0X74, 0X76, 0X78, 0X79, 0X7A,
-  0X7C, 0X7D, 0X7E, 0X7F, 0X80, 0X80, 0X81, 0X82, 0X82, 0X83, 0X83, 0X84,
-  0X84, 0X85, 0X85, 0X86, 0X86, 0X86, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86, 0X85, 0X85, 0X84,
-  0X84, 0X83, 0X83, 0X82, 0X82, 0X81, 0X80, 0X80, 0X7F, 0X7E, 0X7D, 0X7C,
-  0X7A, 0X79, 0X78, 0X76, 0X74, 0X72, 0X6F, 0X6D, 0X69, 0X65, 0X5F, 0X58,
-  0X4E, 0X3F, 0X22, 0X00, 0X01, 0X2E, 0X49, 0X57, 0X60, 0X66, 0X6B, 0X6F,
-  0X72, 0X74, 0X77, 0X79, 0X7A, 0X7C, 0X7D, 0X7F, 0X80, 0X81, 0X82, 0X83,
-  0X83, 0X84, 0X85, 0X85, 0X86, 0X86, 0X87, 0X87, 0X88, 0X88, 0X88, 0X89,
-  0X89, 0X8A, 0X8A, 0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X88, 0X88, 0X88, 0X87, 0X87, 0X86, 0X86,
-  0X85, 0X85, 0X84, 0X83, 0X83, 0X82, 0X81, 0X80, 0X7F, 0X7D, 0X7C, 0X7A,
-  0X79, 0X77, 0X74, 0X72, 0X6F, 0X6B, 0X66, 0X60, 0X57, 0X49, 0X2E, 0X01,
-  0X02, 0X3A, 0X52, 0X5F, 0X67, 0X6C, 0X71, 0X74, 0X77, 0X7A, 0X7C, 0X7D,
-  0X7F, 0X80, 0X82, 0X83, 0X84, 0X85, 0X86, 0X86, 0X87, 0X88, 0X88, 0X89,
-  0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F,
-  0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F,
-  0X8F, 0X8F, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C,
-  0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X89, 0X88, 0X88, 0X87,
-  0X86, 0X86, 0X85, 0X84, 0X83, 0X82, 0X80, 0X7F, 0X7D, 0X7C, 0X7A, 0X77,
-  0X74, 0X71, 0X6C, 0X67, 0X5F, 0X52, 0X3A, 0X02, 0X05, 0X47, 0X5C, 0X67,
-  0X6E, 0X73, 0X77, 0X7A, 0X7D, 0X7F, 0X81, 0X82, 0X84, 0X85, 0X86, 0X87,
-  0X88, 0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8D, 0X8D, 0X8E, 0X8E,
-  0X8E, 0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8E,
-  0X8E, 0X8E, 0X8D, 0X8D, 0X8C, 0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X88,
-  0X87, 0X86, 0X85, 0X84, 0X82, 0X81, 0X7F, 0X7D, 0X7A, 0X77, 0X73, 0X6E,
-  0X67, 0X5C, 0X47, 0X05, 0X16, 0X53, 0X65, 0X6F, 0X75, 0X7A, 0X7D, 0X80,
-  0X82, 0X84, 0X86, 0X87, 0X88, 0X89, 0X8A, 0X8B, 0X8C, 0X8D, 0X8D, 0X8E,
-  0X8E, 0X8F, 0X8F, 0X90, 0X90, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92, 0X92,
-  0X93, 0X93, 0X93, 0X93, 0X93, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94,
-  0X94, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X90,
-  0X90, 0X8F, 0X8F, 0X8E, 0X8E, 0X8D, 0X8D, 0X8C, 0X8B, 0X8A, 0X89, 0X88,
-  0X87, 0X86, 0X84, 0X82, 0X80, 0X7D, 0X7A, 0X75, 0X6F, 0X65, 0X53, 0X17,
-  0X2B, 0X5F, 0X6F, 0X77, 0X7C, 0X80, 0X83, 0X85, 0X87, 0X89, 0X8A, 0X8C,
-  0X8D, 0X8E, 0X8F, 0X8F, 0X90, 0X91, 0X91, 0X92, 0X92, 0X93, 0X93, 0X93,
-  0X94, 0X94, 0X94, 0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X97, 0X97,
-  0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X95, 0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X93, 0X93, 0X93, 0X92,
-  0X92, 0X91, 0X91, 0X90, 0X8F, 0X8F, 0X8E, 0X8D, 0X8C, 0X8A, 0X89, 0X87,
-  0X85, 0X83, 0X80, 0X7C, 0X77, 0X6F, 0X5F, 0X2B, 0X40, 0X6B, 0X78, 0X7F,
-  0X83, 0X86, 0X89, 0X8B, 0X8D, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X93, 0X94,
-  0X94, 0X95, 0X95, 0X96, 0X96, 0X96, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98,
-  0X98, 0X98, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X98, 0X98,
-  0X98, 0X98, 0X97, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X95, 0X95, 0X94,
-  0X94, 0X93, 0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8B, 0X89, 0X86, 0X83,
-  0X7F, 0X78, 0X6B, 0X40, 0X55, 0X77, 0X81, 0X86, 0X8A, 0X8D, 0X8F, 0X91,
-  0X92, 0X93, 0X94, 0X95, 0X96, 0X97, 0X97, 0X98, 0X98, 0X99, 0X99, 0X99,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X98, 0X98, 0X97, 0X97, 0X96,
-  0X95, 0X94, 0X93, 0X92, 0X91, 0X8F, 0X8D, 0X8A, 0X86, 0X81, 0X77, 0X55,
-  0X69, 0X82, 0X8A, 0X8E, 0X91, 0X93, 0X95, 0X96, 0X97, 0X98, 0X99, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA1, 0XA1, 0XA1,
-  0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9C, 0X9C, 0X9B, 0X9B, 0X9A, 0X9A, 0X99, 0X98, 0X97,
-  0X96, 0X95, 0X93, 0X91, 0X8E, 0X8A, 0X82, 0X69, 0X7D, 0X8E, 0X93, 0X96,
-  0X98, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0XA0, 0XA0,
-  0XA0, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA0,
-  0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9D, 0X9C, 0X9B, 0X9A, 0X98,
-  0X96, 0X93, 0X8E, 0X7D, 0X90, 0X99, 0X9C, 0X9E, 0XA0, 0XA0, 0XA1, 0XA2,
-  0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA1, 0XA0, 0XA0, 0X9E, 0X9C, 0X99, 0X90,
-  0XA1, 0XA4, 0XA5, 0XA6, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA7,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA6, 0XA5, 0XA4, 0XA1, 0XB1, 0XAF, 0XAF, 0XAE,
-  0XAE, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAE,
-  0XAE, 0XAF, 0XAF, 0XB1, 0XC0, 0XBA, 0XB8, 0XB6, 0XB5, 0XB4, 0XB4, 0XB3,
-  0XB3, 0XB2, 0XB2, 0XB2, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB2, 0XB2, 0XB2, 0XB3, 0XB3, 0XB4, 0XB4, 0XB5, 0XB6, 0XB8, 0XBA, 0XC0,
-  0XCD, 0XC5, 0XC0, 0XBE, 0XBC, 0XBB, 0XB9, 0XB9, 0XB8, 0XB7, 0XB7, 0XB6,
-  0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB3,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB7, 0XB7, 0XB8,
-  0XB9, 0XB9, 0XBB, 0XBC, 0XBE, 0XC0, 0XC5, 0XCD, 0XDB, 0XCF, 0XC9, 0XC6,
-  0XC3, 0XC1, 0XBF, 0XBE, 0XBD, 0XBC, 0XBC, 0XBB, 0XBB, 0XBA, 0XBA, 0XB9,
-  0XB9, 0XB8, 0XB8, 0XB8, 0XB8, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB9,
-  0XB9, 0XBA, 0XBA, 0XBB, 0XBB, 0XBC, 0XBC, 0XBD, 0XBE, 0XBF, 0XC1, 0XC3,
-  0XC6, 0XC9, 0XCF, 0XDB, 0XE8, 0XDA, 0XD2, 0XCE, 0XCA, 0XC8, 0XC6, 0XC4,
-  0XC3, 0XC2, 0XC0, 0XC0, 0XBF, 0XBE, 0XBE, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBA, 0XBA, 0XBA, 0XBA, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XB9, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE, 0XBE, 0XBF,
-  0XC0, 0XC0, 0XC2, 0XC3, 0XC4, 0XC6, 0XC8, 0XCA, 0XCE, 0XD2, 0XDA, 0XE8,
-  0XF6, 0XE4, 0XDB, 0XD5, 0XD1, 0XCE, 0XCC, 0XCA, 0XC8, 0XC7, 0XC5, 0XC4,
-  0XC4, 0XC3, 0XC2, 0XC1, 0XC1, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE,
-  0XBE, 0XBD, 0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBB,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF,
-  0XBF, 0XC0, 0XC0, 0XC1, 0XC1, 0XC2, 0XC3, 0XC4, 0XC4, 0XC5, 0XC7, 0XC8,
-  0XCA, 0XCC, 0XCE, 0XD1, 0XD5, 0XDB, 0XE4, 0XF6, 0XFF, 0XEE, 0XE4, 0XDD,
-  0XD8, 0XD4, 0XD2, 0XCF, 0XCD, 0XCC, 0XCA, 0XC9, 0XC8, 0XC7, 0XC6, 0XC6,
-  0XC5, 0XC4, 0XC4, 0XC3, 0XC3, 0XC2, 0XC2, 0XC1, 0XC1, 0XC1, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3, 0XC4, 0XC4, 0XC5,
-  0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XCC, 0XCD, 0XCF, 0XD2, 0XD4, 0XD8,
-  0XDD, 0XE4, 0XEE, 0XFF, 0XFF, 0XF9, 0XEC, 0XE5, 0XDF, 0XDB, 0XD8, 0XD5,
-  0XD3, 0XD1, 0XCF, 0XCE, 0XCD, 0XCC, 0XCB, 0XCA, 0XC9, 0XC8, 0XC8, 0XC7,
-  0XC7, 0XC6, 0XC5, 0XC5, 0XC5, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC5,
-  0XC5, 0XC5, 0XC6, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCD,
-  0XCE, 0XCF, 0XD1, 0XD3, 0XD5, 0XD8, 0XDB, 0XDF, 0XE5, 0XEC, 0XF9, 0XFF,
-  0XFF, 0XFF, 0XF5, 0XEC, 0XE6, 0XE1, 0XDE, 0XDB, 0XD8, 0XD6, 0XD4, 0XD3,
-  0XD1, 0XD0, 0XCF, 0XCE, 0XCD, 0XCC, 0XCB, 0XCB, 0XCA, 0XCA, 0XC9, 0XC9,
-  0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC6, 0XC6, 0XC6, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XC9, 0XCA, 0XCA,
-  0XCB, 0XCB, 0XCC, 0XCD, 0XCE, 0XCF, 0XD0, 0XD1, 0XD3, 0XD4, 0XD6, 0XD8,
-  0XDB, 0XDE, 0XE1, 0XE6, 0XEC, 0XF5, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XF4,
-  0XED, 0XE8, 0XE4, 0XE0, 0XDE, 0XDB, 0XD9, 0XD7, 0XD6, 0XD4, 0XD3, 0XD2,
-  0XD1, 0XD0, 0XCF, 0XCF, 0XCE, 0XCD, 0XCD, 0XCC, 0XCC, 0XCB, 0XCB, 0XCA,
-  0XCA, 0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC9, 0XC9, 0XC9, 0XCA,
-  0XCA, 0XCB, 0XCB, 0XCC, 0XCC, 0XCD, 0XCD, 0XCE, 0XCF, 0XCF, 0XD0, 0XD1,
-  0XD2, 0XD3, 0XD4, 0XD6, 0XD7, 0XD9, 0XDB, 0XDE, 0XE0, 0XE4, 0XE8, 0XED,
-  0XF4, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF4, 0XEE, 0XEA, 0XE6,
-  0XE3, 0XE0, 0XDE, 0XDC, 0XDA, 0XD9, 0XD7, 0XD6, 0XD5, 0XD4, 0XD3, 0XD2,
-  0XD2, 0XD1, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCE, 0XCD, 0XCD, 0XCC, 0XCC,
-  0XCC, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XC9, 0XC9, 0XC9,
-  0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCE, 0XCE, 0XCF, 0XCF,
-  0XD0, 0XD0, 0XD1, 0XD2, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD7, 0XD9, 0XDA,
-  0XDC, 0XDE, 0XE0, 0XE3, 0XE6, 0XEA, 0XEE, 0XF4, 0XFC, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XF4, 0XF0, 0XEB, 0XE8, 0XE5, 0XE3, 0XE1,
-  0XDF, 0XDD, 0XDC, 0XDB, 0XD9, 0XD8, 0XD7, 0XD6, 0XD5, 0XD5, 0XD4, 0XD3,
-  0XD3, 0XD2, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCD, 0XCD, 0XCD, 0XCD, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC,
-  0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCD, 0XCD, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF,
-  0XCF, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD2, 0XD3, 0XD3, 0XD4, 0XD5, 0XD5,
-  0XD6, 0XD7, 0XD8, 0XD9, 0XDB, 0XDC, 0XDD, 0XDF, 0XE1, 0XE3, 0XE5, 0XE8,
-  0XEB, 0XF0, 0XF4, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFB, 0XF5, 0XF1, 0XED, 0XEA, 0XE8, 0XE6, 0XE4, 0XE2, 0XE0, 0XDF,
-  0XDD, 0XDC, 0XDB, 0XDA, 0XD9, 0XD8, 0XD7, 0XD7, 0XD6, 0XD5, 0XD5, 0XD4,
-  0XD4, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF,
-  0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD5, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD9, 0XDA, 0XDB, 0XDC, 0XDD,
-  0XDF, 0XE0, 0XE2, 0XE4, 0XE6, 0XE8, 0XEA, 0XED, 0XF1, 0XF5, 0XFB, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XF7,
-  0XF3, 0XF0, 0XED, 0XEA, 0XE8, 0XE6, 0XE4, 0XE3, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDD, 0XDC, 0XDB, 0XDA, 0XDA, 0XD9, 0XD8, 0XD8, 0XD7, 0XD7, 0XD6, 0XD6,
-  0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD2,
-  0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD4, 0XD5, 0XD5, 0XD6, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XDA,
-  0XDA, 0XDB, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1, 0XE3, 0XE4, 0XE6, 0XE8,
-  0XEA, 0XED, 0XF0, 0XF3, 0XF7, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF8, 0XF5, 0XF2, 0XEF,
-  0XED, 0XEA, 0XE9, 0XE7, 0XE6, 0XE4, 0XE3, 0XE2, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDD, 0XDC, 0XDC, 0XDB, 0XDA, 0XDA, 0XD9, 0XD9, 0XD8, 0XD8, 0XD7, 0XD7,
-  0XD7, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8,
-  0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1,
-  0XE2, 0XE3, 0XE4, 0XE6, 0XE7, 0XE9, 0XEA, 0XED, 0XEF, 0XF2, 0XF5, 0XF8,
-  0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFA, 0XF6, 0XF4, 0XF1, 0XEF, 0XED, 0XEB,
-  0XEA, 0XE8, 0XE7, 0XE5, 0XE4, 0XE3, 0XE2, 0XE1, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDE, 0XDD, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD9, 0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE,
-  0XDE, 0XDF, 0XE0, 0XE1, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE7, 0XE8, 0XEA,
-  0XEB, 0XED, 0XEF, 0XF1, 0XF4, 0XF6, 0XFA, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFB, 0XF8, 0XF6, 0XF3, 0XF1, 0XEF, 0XEE, 0XEC, 0XEB, 0XE9,
-  0XE8, 0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF,
-  0XDF, 0XDE, 0XDE, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDA,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDD,
-  0XDD, 0XDE, 0XDE, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1, 0XE2, 0XE2, 0XE3, 0XE4,
-  0XE5, 0XE6, 0XE7, 0XE8, 0XE9, 0XEB, 0XEC, 0XEE, 0XEF, 0XF1, 0XF3, 0XF6,
-  0XF8, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD,
-  0XFA, 0XF8, 0XF5, 0XF4, 0XF2, 0XF0, 0XEE, 0XED, 0XEC, 0XEB, 0XE9, 0XE8,
-  0XE7, 0XE7, 0XE6, 0XE5, 0XE4, 0XE4, 0XE3, 0XE2, 0XE2, 0XE1, 0XE1, 0XE0,
-  0XE0, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD, 0XDD, 0XDD, 0XDC,
-  0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDD, 0XDD, 0XDD,
-  0XDD, 0XDE, 0XDE, 0XDE, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1, 0XE1, 0XE2,
-  0XE2, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE7, 0XE7, 0XE8, 0XE9, 0XEB, 0XEC,
-  0XED, 0XEE, 0XF0, 0XF2, 0XF4, 0XF5, 0XF8, 0XFA, 0XFD, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8,
-  0XF6, 0XF4, 0XF2, 0XF1, 0XF0, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE8,
-  0XE8, 0XE7, 0XE6, 0XE6, 0XE5, 0XE4, 0XE4, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2,
-  0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE0, 0XE0, 0XE1, 0XE1, 0XE1,
-  0XE2, 0XE2, 0XE2, 0XE3, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE6, 0XE7, 0XE8,
-  0XE8, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XEE, 0XF0, 0XF1, 0XF2, 0XF4, 0XF6,
-  0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF6, 0XF5,
-  0XF3, 0XF2, 0XF1, 0XEF, 0XEE, 0XED, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE9,
-  0XE8, 0XE7, 0XE7, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3,
-  0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1,
-  0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE2, 0XE2, 0XE2,
-  0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE6,
-  0XE6, 0XE7, 0XE7, 0XE8, 0XE9, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XED, 0XEE,
-  0XEF, 0XF1, 0XF2, 0XF3, 0XF5, 0XF6, 0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF7, 0XF6, 0XF4, 0XF3,
-  0XF2, 0XF1, 0XF0, 0XEF, 0XEE, 0XED, 0XED, 0XEC, 0XEB, 0XEB, 0XEA, 0XEA,
-  0XE9, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5,
-  0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE5, 0XE6, 0XE6,
-  0XE6, 0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEB, 0XEB,
-  0XEC, 0XED, 0XED, 0XEE, 0XEF, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF6, 0XF7,
-  0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFC, 0XFB, 0XF9, 0XF8, 0XF7, 0XF5, 0XF4, 0XF3, 0XF2,
-  0XF1, 0XF1, 0XF0, 0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC, 0XEB, 0XEB,
-  0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE8, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA,
-  0XEB, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XF0, 0XF1, 0XF1,
-  0XF2, 0XF3, 0XF4, 0XF5, 0XF7, 0XF8, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFD, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF5, 0XF4, 0XF3, 0XF2,
-  0XF2, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC,
-  0XEC, 0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9,
-  0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9,
-  0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA, 0XEA, 0XEA, 0XEB,
-  0XEB, 0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XEF,
-  0XF0, 0XF0, 0XF1, 0XF2, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF8, 0XF9,
-  0XFA, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFC, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF6, 0XF5, 0XF4, 0XF3, 0XF3,
-  0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XED, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC,
-  0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XEC,
-  0XEC, 0XEC, 0XEC, 0XEC, 0XED, 0XED, 0XED, 0XED, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3, 0XF4, 0XF5,
-  0XF6, 0XF6, 0XF7, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD, 0XFC,
-  0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF4,
-  0XF3, 0XF3, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XF0, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEF, 0XF0, 0XF0, 0XF0, 0XF0, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3,
-  0XF4, 0XF4, 0XF5, 0XF5, 0XF6, 0XF6, 0XF7, 0XF8, 0XF9, 0XFA, 0XFA, 0XFB,
-  0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC,
-  0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5,
-  0XF4, 0XF4, 0XF4, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF3, 0XF3,
-  0XF3, 0XF4, 0XF4, 0XF4, 0XF5, 0XF5, 0XF6, 0XF6, 0XF7, 0XF7, 0XF8, 0XF8,
-  0XF9, 0XFA, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD, 0XFD, 0XFC,
-  0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF6,
-  0XF6, 0XF6, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF6, 0XF6, 0XF6, 0XF7, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFD, 0XFD, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC,
-  0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8,
-  0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6,
-  0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF8, 0XF8,
-  0XF8, 0XF8, 0XF8, 0XF9, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFC,
-  0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD,
-  0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XFA,
-  0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9,
-  0XF9, 0XF9, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB, 0XFC,
-  0XFC, 0XFC, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC,
-  0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF8, 0XC7, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XC7, 0X91, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0X91,
-  0X5C, 0XF4, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF4, 0X5C, 0X27, 0XD3, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XD3, 0X27, 0X04, 0XB2, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF2, 0XB2, 0X04,
-  0X02, 0X91, 0XD7, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XD7, 0X91, 0X02, 0X01, 0X70, 0XBD, 0XE8,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XE8, 0XBD, 0X71, 0X01, 0X00, 0X4F, 0XA3, 0XD1, 0XEF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XD1, 0XA3, 0X4F, 0X00,
-  0X00, 0X2E, 0X89, 0XBA, 0XDA, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XF2, 0XDA, 0XBA, 0X89, 0X2E, 0X00, 0X00, 0X0D, 0X6E, 0XA3,
-  0XC6, 0XDF, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF2, 0XDF, 0XC6,
-  0XA3, 0X6E, 0X0D, 0X00, 0X00, 0X01, 0X54, 0X8D, 0XB2, 0XCD, 0XE1, 0XF2,
-  0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XF2, 0XE1, 0XCD, 0XB2, 0X8D, 0X54, 0X01, 0X00,
-  0X00, 0X01, 0X3A, 0X76, 0X9E, 0XBA, 0XD0, 0XE2, 0XEF, 0XFB, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XEF,
-  0XE2, 0XD0, 0XBA, 0X9E, 0X76, 0X3A, 0X01, 0X00, 0X00, 0X00, 0X1F, 0X60,
-  0X8A, 0XA8, 0XBF, 0XD1, 0XE0, 0XED, 0XF8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF8, 0XED, 0XE0, 0XD1, 0XBF, 0XA8, 0X8A,
-  0X60, 0X1F, 0X00, 0X00, 0X00, 0X00, 0X06, 0X49, 0X75, 0X95, 0XAE, 0XC1,
-  0XD1, 0XDE, 0XEA, 0XF3, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC,
-  0XF3, 0XEA, 0XDE, 0XD1, 0XC1, 0XAE, 0X95, 0X75, 0X49, 0X06, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X32, 0X61, 0X83, 0X9D, 0XB1, 0XC2, 0XD0, 0XDC, 0XE6,
-  0XEF, 0XF7, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF7, 0XEF, 0XE6, 0XDC, 0XD0, 0XC2,
-  0XB1, 0X9D, 0X83, 0X61, 0X32, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1C,
-  0X4D, 0X70, 0X8B, 0XA1, 0XB2, 0XC1, 0XCE, 0XD9, 0XE2, 0XEB, 0XF2, 0XF9,
-  0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XF9, 0XF2, 0XEB, 0XE2, 0XD9, 0XCE, 0XC1, 0XB2, 0XA1, 0X8B, 0X70, 0X4D,
-  0X1C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X39, 0X5E, 0X7A, 0X91,
-  0XA3, 0XB3, 0XC0, 0XCB, 0XD5, 0XDE, 0XE6, 0XED, 0XF3, 0XF9, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF9, 0XF3, 0XED, 0XE6, 0XDE, 0XD5,
-  0XCB, 0XC0, 0XB3, 0XA3, 0X91, 0X7A, 0X5E, 0X39, 0X05, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X24, 0X4B, 0X69, 0X81, 0X94, 0XA4, 0XB2, 0XBE,
-  0XC8, 0XD2, 0XDA, 0XE1, 0XE8, 0XEE, 0XF4, 0XF9, 0XFD, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD,
-  0XF9, 0XF4, 0XEE, 0XE8, 0XE1, 0XDA, 0XD2, 0XC8, 0XBE, 0XB2, 0XA4, 0X94,
-  0X81, 0X69, 0X4B, 0X24, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X10, 0X39, 0X58, 0X71, 0X85, 0X96, 0XA4, 0XB0, 0XBB, 0XC5, 0XCE, 0XD5,
-  0XDC, 0XE3, 0XE9, 0XEE, 0XF3, 0XF7, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFB, 0XF7, 0XF3, 0XEE, 0XE9, 0XE3, 0XDC,
-  0XD5, 0XCE, 0XC5, 0XBB, 0XB0, 0XA4, 0X96, 0X84, 0X71, 0X58, 0X39, 0X10,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X26, 0X47, 0X61,
-  0X75, 0X87, 0X96, 0XA3, 0XAF, 0XB8, 0XC2, 0XCA, 0XD1, 0XD7, 0XDD, 0XE3,
-  0XE8, 0XED, 0XF1, 0XF5, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XF9,
-  0XF5, 0XF1, 0XED, 0XE8, 0XE3, 0XDD, 0XD7, 0XD1, 0XCA, 0XC2, 0XB8, 0XAF,
-  0XA3, 0X96, 0X87, 0X75, 0X61, 0X47, 0X26, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X35, 0X50, 0X66, 0X78, 0X88, 0X96,
-  0XA2, 0XAC, 0XB5, 0XBE, 0XC5, 0XCC, 0XD3, 0XD8, 0XDD, 0XE2, 0XE7, 0XEB,
-  0XEF, 0XF2, 0XF6, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFC, 0XF9, 0XF6, 0XF2, 0XEF, 0XEB, 0XE7, 0XE2, 0XDD,
-  0XD8, 0XD3, 0XCC, 0XC5, 0XBE, 0XB5, 0XAC, 0XA2, 0X96, 0X88, 0X78, 0X66,
-  0X50, 0X35, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X24, 0X40, 0X57, 0X6A, 0X7A, 0X88, 0X95, 0X9F, 0XA9, 0XB2,
-  0XBA, 0XC1, 0XC8, 0XCD, 0XD3, 0XD8, 0XDD, 0XE1, 0XE5, 0XE9, 0XEC, 0XF0,
-  0XF3, 0XF5, 0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFB, 0XF8, 0XF5, 0XF3,
-  0XF0, 0XEC, 0XE9, 0XE5, 0XE1, 0XDD, 0XD8, 0XD3, 0XCD, 0XC8, 0XC1, 0XBA,
-  0XB2, 0XA9, 0X9F, 0X95, 0X88, 0X7A, 0X6A, 0X57, 0X40, 0X24, 0X03, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X30,
-  0X47, 0X5B, 0X6C, 0X7B, 0X88, 0X93, 0X9D, 0XA6, 0XAE, 0XB6, 0XBD, 0XC3,
-  0XC8, 0XCE, 0XD2, 0XD7, 0XDB, 0XDF, 0XE3, 0XE6, 0XE9, 0XEC, 0XEF, 0XF1,
-  0XF4, 0XF7, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC,
-  0XFB, 0XF9, 0XF7, 0XF4, 0XF1, 0XEF, 0XEC, 0XE9, 0XE6, 0XE3, 0XDF, 0XDB,
-  0XD7, 0XD2, 0XCE, 0XC8, 0XC3, 0XBD, 0XB6, 0XAE, 0XA6, 0X9D, 0X93, 0X88,
-  0X7B, 0X6C, 0X5B, 0X47, 0X30, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X20, 0X38, 0X4D, 0X5E, 0X6D,
-  0X7B, 0X86, 0X91, 0X9A, 0XA3, 0XAA, 0XB2, 0XB8, 0XBE, 0XC3, 0XC8, 0XCD,
-  0XD1, 0XD5, 0XD9, 0XDD, 0XE0, 0XE3, 0XE6, 0XE8, 0XEB, 0XEE, 0XF0, 0XF2,
-  0XF4, 0XF6, 0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFD, 0XFC, 0XFB, 0XF9, 0XF8, 0XF6, 0XF4, 0XF2, 0XF0, 0XEE, 0XEB,
-  0XE8, 0XE6, 0XE3, 0XE0, 0XDD, 0XD9, 0XD5, 0XD1, 0XCD, 0XC8, 0XC3, 0XBE,
-  0XB8, 0XB2, 0XAA, 0XA3, 0X9A, 0X91, 0X86, 0X7B, 0X6D, 0X5E, 0X4D, 0X38,
-  0X20, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X10, 0X29, 0X3E, 0X50, 0X60, 0X6E, 0X7A, 0X85, 0X8E,
-  0X97, 0X9F, 0XA7, 0XAD, 0XB3, 0XB9, 0XBE, 0XC3, 0XC7, 0XCC, 0XCF, 0XD3,
-  0XD6, 0XDA, 0XDC, 0XDF, 0XE2, 0XE5, 0XE7, 0XE9, 0XEB, 0XED, 0XEF, 0XF1,
-  0XF2, 0XF4, 0XF5, 0XF7, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFD, 0XFC, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF5, 0XF4, 0XF2,
-  0XF1, 0XEF, 0XED, 0XEB, 0XE9, 0XE7, 0XE5, 0XE2, 0XDF, 0XDC, 0XDA, 0XD6,
-  0XD3, 0XCF, 0XCC, 0XC7, 0XC3, 0XBE, 0XB9, 0XB3, 0XAD, 0XA7, 0X9F, 0X97,
-  0X8E, 0X85, 0X7A, 0X6E, 0X60, 0X50, 0X3E, 0X29, 0X10, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X19, 0X2F, 0X42, 0X52, 0X61, 0X6D, 0X79, 0X82, 0X8C, 0X94, 0X9B, 0XA2,
-  0XA9, 0XAE, 0XB4, 0XB9, 0XBD, 0XC2, 0XC6, 0XCA, 0XCD, 0XD0, 0XD4, 0XD6,
-  0XD9, 0XDC, 0XDE, 0XE0, 0XE2, 0XE4, 0XE7, 0XE8, 0XEA, 0XEB, 0XED, 0XEE,
-  0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF7, 0XF8, 0XF8, 0XF9,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF5, 0XF4,
-  0XF3, 0XF2, 0XF1, 0XF0, 0XEE, 0XED, 0XEB, 0XEA, 0XE8, 0XE7, 0XE4, 0XE2,
-  0XE0, 0XDE, 0XDC, 0XD9, 0XD6, 0XD4, 0XD0, 0XCD, 0XCA, 0XC6, 0XC2, 0XBD,
-  0XB9, 0XB4, 0XAE, 0XA9, 0XA2, 0X9B, 0X94, 0X8C, 0X82, 0X79, 0X6D, 0X61,
-  0X52, 0X42, 0X2F, 0X19, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X21, 0X34, 0X45,
-  0X54, 0X61, 0X6C, 0X77, 0X80, 0X89, 0X90, 0X97, 0X9E, 0XA4, 0XAA, 0XAF,
-  0XB3, 0XB8, 0XBC, 0XC0, 0XC4, 0XC7, 0XCA, 0XCD, 0XD0, 0XD3, 0XD5, 0XD7,
-  0XDA, 0XDC, 0XDE, 0XE0, 0XE1, 0XE3, 0XE5, 0XE6, 0XE8, 0XE9, 0XEA, 0XEB,
-  0XEC, 0XED, 0XEE, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE8,
-  0XE6, 0XE5, 0XE3, 0XE1, 0XE0, 0XDE, 0XDC, 0XDA, 0XD7, 0XD5, 0XD3, 0XD0,
-  0XCD, 0XCA, 0XC7, 0XC4, 0XC0, 0XBC, 0XB8, 0XB3, 0XAF, 0XAA, 0XA4, 0X9E,
-  0X97, 0X90, 0X89, 0X80, 0X77, 0X6C, 0X61, 0X54, 0X45, 0X34, 0X21, 0X0A,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X26, 0X37, 0X47, 0X54, 0X60, 0X6B,
-  0X75, 0X7D, 0X85, 0X8D, 0X93, 0X9A, 0X9F, 0XA5, 0XAA, 0XAE, 0XB3, 0XB7,
-  0XBA, 0XBE, 0XC1, 0XC4, 0XC7, 0XCA, 0XCC, 0XCF, 0XD1, 0XD3, 0XD5, 0XD7,
-  0XD9, 0XDB, 0XDC, 0XDE, 0XDF, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE6, 0XE7,
-  0XE7, 0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEA, 0XEA, 0XEB, 0XEB, 0XEB, 0XEB,
-  0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE8, 0XE8, 0XE7,
-  0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE2, 0XE1, 0XDF, 0XDE, 0XDC, 0XDB, 0XD9,
-  0XD7, 0XD5, 0XD3, 0XD1, 0XCF, 0XCC, 0XCA, 0XC7, 0XC4, 0XC1, 0XBE, 0XBA,
-  0XB7, 0XB3, 0XAE, 0XAA, 0XA5, 0X9F, 0X9A, 0X93, 0X8D, 0X85, 0X7D, 0X75,
-  0X6B, 0X60, 0X54, 0X47, 0X38, 0X26, 0X12, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X18, 0X2A, 0X3A, 0X47, 0X54, 0X5F, 0X69, 0X72, 0X7A, 0X82,
-  0X89, 0X8F, 0X95, 0X9B, 0XA0, 0XA5, 0XA9, 0XAD, 0XB1, 0XB5, 0XB8, 0XBB,
-  0XBE, 0XC1, 0XC4, 0XC6, 0XC9, 0XCB, 0XCD, 0XCF, 0XD0, 0XD2, 0XD4, 0XD5,
-  0XD7, 0XD8, 0XD9, 0XDA, 0XDC, 0XDD, 0XDE, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1,
-  0XE2, 0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE2, 0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF, 0XDF, 0XDE, 0XDD, 0XDC,
-  0XDA, 0XD9, 0XD8, 0XD7, 0XD5, 0XD4, 0XD2, 0XD0, 0XCF, 0XCD, 0XCB, 0XC9,
-  0XC6, 0XC4, 0XC1, 0XBE, 0XBB, 0XB8, 0XB5, 0XB1, 0XAD, 0XA9, 0XA5, 0XA0,
-  0X9B, 0X95, 0X8F, 0X89, 0X82, 0X7A, 0X72, 0X69, 0X5F, 0X54, 0X47, 0X3A,
-  0X2A, 0X18, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X1D,
-  0X2D, 0X3B, 0X48, 0X53, 0X5E, 0X67, 0X6F, 0X77, 0X7E, 0X85, 0X8B, 0X91,
-  0X96, 0X9B, 0X9F, 0XA4, 0XA7, 0XAB, 0XAF, 0XB2, 0XB5, 0XB8, 0XBB, 0XBD,
-  0XC0, 0XC2, 0XC4, 0XC6, 0XC8, 0XCA, 0XCB, 0XCD, 0XCF, 0XD0, 0XD1, 0XD2,
-  0XD3, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XDA, 0XDA, 0XDA, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA,
-  0XD9, 0XD8, 0XD8, 0XD7, 0XD7, 0XD6, 0XD5, 0XD3, 0XD2, 0XD1, 0XD0, 0XCF,
-  0XCD, 0XCB, 0XCA, 0XC8, 0XC6, 0XC4, 0XC2, 0XC0, 0XBD, 0XBB, 0XB8, 0XB5,
-  0XB2, 0XAF, 0XAB, 0XA7, 0XA4, 0X9F, 0X9B, 0X96, 0X91, 0X8B, 0X85, 0X7E,
-  0X77, 0X6F, 0X67, 0X5E, 0X53, 0X48, 0X3B, 0X2D, 0X1D, 0X0A, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0F, 0X20, 0X2E, 0X3C, 0X47,
-  0X52, 0X5B, 0X64, 0X6C, 0X74, 0X7A, 0X81, 0X87, 0X8C, 0X91, 0X96, 0X9A,
-  0X9E, 0XA2, 0XA6, 0XA9, 0XAC, 0XAF, 0XB2, 0XB5, 0XB7, 0XBA, 0XBC, 0XBE,
-  0XC0, 0XC2, 0XC3, 0XC5, 0XC7, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCE, 0XCE,
-  0XCF, 0XD0, 0XD0, 0XD1, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD1, 0XD0, 0XD0, 0XCF,
-  0XCE, 0XCE, 0XCC, 0XCB, 0XCA, 0XC9, 0XC8, 0XC7, 0XC5, 0XC3, 0XC2, 0XC0,
-  0XBE, 0XBC, 0XBA, 0XB7, 0XB5, 0XB2, 0XAF, 0XAC, 0XA9, 0XA6, 0XA2, 0X9E,
-  0X9A, 0X96, 0X91, 0X8C, 0X87, 0X81, 0X7A, 0X74, 0X6C, 0X64, 0X5B, 0X52,
-  0X47, 0X3C, 0X2E, 0X20, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X13, 0X22, 0X2F, 0X3B, 0X46, 0X50, 0X59, 0X61,
-  0X69, 0X70, 0X77, 0X7C, 0X82, 0X87, 0X8C, 0X91, 0X95, 0X99, 0X9C, 0XA0,
-  0XA3, 0XA6, 0XA9, 0XAC, 0XAE, 0XB1, 0XB3, 0XB5, 0XB7, 0XB9, 0XBB, 0XBD,
-  0XBE, 0XC0, 0XC1, 0XC2, 0XC3, 0XC5, 0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XC9,
-  0XCA, 0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCA, 0XCA, 0XC9, 0XC9, 0XC8, 0XC7, 0XC6, 0XC6, 0XC5, 0XC3,
-  0XC2, 0XC1, 0XC0, 0XBE, 0XBD, 0XBB, 0XB9, 0XB7, 0XB5, 0XB3, 0XB1, 0XAE,
-  0XAC, 0XA9, 0XA6, 0XA3, 0XA0, 0X9C, 0X99, 0X95, 0X91, 0X8C, 0X87, 0X82,
-  0X7C, 0X77, 0X70, 0X69, 0X61, 0X59, 0X50, 0X46, 0X3B, 0X2F, 0X22, 0X13,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X06, 0X15, 0X23, 0X2F, 0X3B, 0X45, 0X4E, 0X56, 0X5E, 0X66, 0X6C, 0X72,
-  0X78, 0X7D, 0X82, 0X87, 0X8B, 0X8F, 0X93, 0X97, 0X9A, 0X9D, 0XA0, 0XA3,
-  0XA6, 0XA8, 0XAB, 0XAD, 0XAF, 0XB1, 0XB3, 0XB4, 0XB6, 0XB7, 0XB9, 0XBA,
-  0XBB, 0XBC, 0XBE, 0XBE, 0XBF, 0XC0, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3,
-  0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC2, 0XC2,
-  0XC1, 0XC1, 0XC0, 0XBF, 0XBE, 0XBE, 0XBC, 0XBB, 0XBA, 0XB9, 0XB7, 0XB6,
-  0XB4, 0XB3, 0XB1, 0XAF, 0XAD, 0XAB, 0XA8, 0XA6, 0XA3, 0XA0, 0X9D, 0X9A,
-  0X97, 0X93, 0X8F, 0X8B, 0X87, 0X82, 0X7D, 0X78, 0X72, 0X6C, 0X66, 0X5E,
-  0X56, 0X4E, 0X45, 0X3B, 0X2F, 0X23, 0X15, 0X06, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X17, 0X23,
-  0X2F, 0X3A, 0X43, 0X4C, 0X54, 0X5B, 0X62, 0X68, 0X6E, 0X74, 0X79, 0X7D,
-  0X82, 0X86, 0X8A, 0X8E, 0X91, 0X94, 0X97, 0X9A, 0X9D, 0XA0, 0XA2, 0XA4,
-  0XA6, 0XA8, 0XAA, 0XAC, 0XAE, 0XAF, 0XB1, 0XB2, 0XB3, 0XB4, 0XB5, 0XB6,
-  0XB7, 0XB8, 0XB9, 0XB9, 0XBA, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBB, 0XBB, 0XBB, 0XBA, 0XB9, 0XB9, 0XB8, 0XB7,
-  0XB6, 0XB5, 0XB4, 0XB3, 0XB2, 0XB1, 0XAF, 0XAE, 0XAC, 0XAA, 0XA8, 0XA6,
-  0XA4, 0XA2, 0XA0, 0X9D, 0X9A, 0X97, 0X94, 0X91, 0X8E, 0X8A, 0X86, 0X82,
-  0X7D, 0X79, 0X74, 0X6E, 0X68, 0X62, 0X5B, 0X54, 0X4C, 0X43, 0X3A, 0X2F,
-  0X23, 0X17, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X18, 0X24, 0X2E, 0X38, 0X41,
-  0X49, 0X51, 0X58, 0X5E, 0X64, 0X6A, 0X6F, 0X74, 0X79, 0X7D, 0X81, 0X85,
-  0X88, 0X8C, 0X8F, 0X92, 0X94, 0X97, 0X9A, 0X9C, 0X9E, 0XA0, 0XA2, 0XA4,
-  0XA5, 0XA7, 0XA8, 0XAA, 0XAB, 0XAC, 0XAD, 0XAE, 0XAF, 0XB0, 0XB1, 0XB1,
-  0XB2, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB3, 0XB3, 0XB3, 0XB2, 0XB1, 0XB1, 0XB0, 0XAF, 0XAE, 0XAD, 0XAC, 0XAB,
-  0XAA, 0XA8, 0XA7, 0XA5, 0XA4, 0XA2, 0XA0, 0X9E, 0X9C, 0X9A, 0X97, 0X94,
-  0X92, 0X8F, 0X8C, 0X88, 0X85, 0X81, 0X7D, 0X79, 0X74, 0X6F, 0X6A, 0X64,
-  0X5E, 0X58, 0X51, 0X49, 0X41, 0X38, 0X2E, 0X24, 0X18, 0X0B, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X0C, 0X18, 0X23, 0X2D, 0X36, 0X3F, 0X46, 0X4E, 0X54,
-  0X5A, 0X60, 0X65, 0X6A, 0X6F, 0X74, 0X78, 0X7B, 0X7F, 0X83, 0X86, 0X89,
-  0X8C, 0X8E, 0X91, 0X93, 0X95, 0X98, 0X9A, 0X9B, 0X9D, 0X9F, 0XA0, 0XA2,
-  0XA3, 0XA4, 0XA5, 0XA6, 0XA7, 0XA8, 0XA9, 0XAA, 0XAA, 0XAB, 0XAB, 0XAB,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAB, 0XAB, 0XAB, 0XAA,
-  0XAA, 0XA9, 0XA8, 0XA7, 0XA6, 0XA5, 0XA4, 0XA3, 0XA2, 0XA0, 0X9F, 0X9D,
-  0X9B, 0X9A, 0X98, 0X95, 0X93, 0X91, 0X8E, 0X8C, 0X89, 0X86, 0X83, 0X7F,
-  0X7B, 0X78, 0X74, 0X6F, 0X6A, 0X65, 0X60, 0X5A, 0X54, 0X4E, 0X46, 0X3F,
-  0X36, 0X2D, 0X23, 0X18, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0C, 0X18, 0X22, 0X2B, 0X34, 0X3C, 0X43, 0X4A, 0X50, 0X56, 0X5C, 0X61,
-  0X66, 0X6A, 0X6F, 0X72, 0X76, 0X7A, 0X7D, 0X80, 0X83, 0X86, 0X88, 0X8B,
-  0X8D, 0X8F, 0X91, 0X93, 0X95, 0X97, 0X98, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E,
-  0X9F, 0XA0, 0XA1, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA4, 0XA4, 0XA4, 0XA4, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA1, 0XA0, 0X9F,
-  0X9E, 0X9D, 0X9C, 0X9B, 0X9A, 0X98, 0X97, 0X95, 0X93, 0X91, 0X8F, 0X8D,
-  0X8B, 0X88, 0X86, 0X83, 0X80, 0X7D, 0X7A, 0X76, 0X72, 0X6F, 0X6A, 0X66,
-  0X61, 0X5C, 0X56, 0X50, 0X4A, 0X43, 0X3C, 0X34, 0X2B, 0X22, 0X18, 0X0C,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X17, 0X20,
-  0X29, 0X31, 0X39, 0X40, 0X47, 0X4D, 0X52, 0X58, 0X5C, 0X61, 0X65, 0X69,
-  0X6D, 0X71, 0X74, 0X77, 0X7A, 0X7D, 0X80, 0X82, 0X85, 0X87, 0X89, 0X8B,
-  0X8D, 0X8E, 0X90, 0X91, 0X93, 0X94, 0X95, 0X96, 0X97, 0X98, 0X99, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9B, 0X9B, 0X9A, 0X9A, 0X99, 0X98, 0X97, 0X96, 0X95, 0X94, 0X93,
-  0X91, 0X90, 0X8E, 0X8D, 0X8B, 0X89, 0X87, 0X85, 0X82, 0X80, 0X7D, 0X7A,
-  0X77, 0X74, 0X71, 0X6D, 0X69, 0X65, 0X61, 0X5C, 0X58, 0X52, 0X4D, 0X47,
-  0X40, 0X39, 0X31, 0X29, 0X20, 0X17, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X16, 0X1F, 0X27, 0X2F, 0X36,
-  0X3D, 0X43, 0X49, 0X4E, 0X53, 0X58, 0X5C, 0X60, 0X64, 0X68, 0X6B, 0X6F,
-  0X72, 0X74, 0X77, 0X7A, 0X7C, 0X7E, 0X80, 0X82, 0X84, 0X86, 0X88, 0X89,
-  0X8B, 0X8C, 0X8D, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X92, 0X93, 0X93, 0X94,
-  0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93, 0X93, 0X92,
-  0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8C, 0X8B, 0X89, 0X88, 0X86, 0X84,
-  0X82, 0X80, 0X7E, 0X7C, 0X7A, 0X77, 0X74, 0X72, 0X6F, 0X6B, 0X68, 0X64,
-  0X60, 0X5C, 0X58, 0X53, 0X4E, 0X49, 0X43, 0X3D, 0X36, 0X2F, 0X27, 0X1F,
-  0X16, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X0B, 0X14, 0X1D, 0X25, 0X2C, 0X33, 0X39, 0X3F, 0X44,
-  0X49, 0X4E, 0X53, 0X57, 0X5B, 0X5F, 0X62, 0X66, 0X69, 0X6C, 0X6F, 0X71,
-  0X74, 0X76, 0X78, 0X7A, 0X7C, 0X7E, 0X7F, 0X81, 0X82, 0X84, 0X85, 0X86,
-  0X87, 0X88, 0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X88, 0X87,
-  0X86, 0X85, 0X84, 0X82, 0X81, 0X7F, 0X7E, 0X7C, 0X7A, 0X78, 0X76, 0X74,
-  0X71, 0X6F, 0X6C, 0X69, 0X66, 0X62, 0X5F, 0X5B, 0X57, 0X53, 0X4E, 0X49,
-  0X44, 0X3F, 0X39, 0X33, 0X2C, 0X25, 0X1D, 0X14, 0X0B, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0A, 0X12, 0X1A, 0X22, 0X29, 0X2F, 0X35, 0X3B, 0X40, 0X45, 0X4A, 0X4E,
-  0X52, 0X56, 0X5A, 0X5D, 0X60, 0X63, 0X66, 0X69, 0X6B, 0X6E, 0X70, 0X72,
-  0X74, 0X76, 0X77, 0X79, 0X7A, 0X7C, 0X7D, 0X7E, 0X7F, 0X80, 0X81, 0X82,
-  0X82, 0X83, 0X83, 0X84, 0X84, 0X84, 0X84, 0X85, 0X85, 0X84, 0X84, 0X84,
-  0X84, 0X83, 0X83, 0X82, 0X82, 0X81, 0X80, 0X7F, 0X7E, 0X7D, 0X7C, 0X7A,
-  0X79, 0X77, 0X76, 0X74, 0X72, 0X70, 0X6E, 0X6B, 0X69, 0X66, 0X63, 0X60,
-  0X5D, 0X5A, 0X56, 0X52, 0X4E, 0X4A, 0X45, 0X40, 0X3B, 0X35, 0X2F, 0X29,
-  0X22, 0X1A, 0X12, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X08, 0X10, 0X18,
-  0X1F, 0X26, 0X2C, 0X31, 0X37, 0X3C, 0X41, 0X45, 0X49, 0X4D, 0X51, 0X54,
-  0X58, 0X5B, 0X5E, 0X60, 0X63, 0X65, 0X67, 0X69, 0X6C, 0X6D, 0X6F, 0X71,
-  0X72, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X7A, 0X7B, 0X7B, 0X7C,
-  0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7A,
-  0X7A, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X72, 0X71, 0X6F, 0X6D, 0X6C,
-  0X69, 0X67, 0X65, 0X63, 0X60, 0X5E, 0X5B, 0X58, 0X54, 0X51, 0X4D, 0X49,
-  0X45, 0X41, 0X3C, 0X37, 0X31, 0X2C, 0X26, 0X1F, 0X18, 0X10, 0X08, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0E, 0X15, 0X1C, 0X22, 0X28,
-  0X2D, 0X32, 0X37, 0X3C, 0X40, 0X44, 0X48, 0X4B, 0X4F, 0X52, 0X55, 0X58,
-  0X5A, 0X5D, 0X5F, 0X61, 0X63, 0X65, 0X67, 0X69, 0X6A, 0X6B, 0X6D, 0X6E,
-  0X6F, 0X70, 0X71, 0X72, 0X72, 0X73, 0X74, 0X74, 0X74, 0X74, 0X75, 0X75,
-  0X75, 0X75, 0X74, 0X74, 0X74, 0X74, 0X73, 0X72, 0X72, 0X71, 0X70, 0X6F,
-  0X6E, 0X6D, 0X6B, 0X6A, 0X69, 0X67, 0X65, 0X63, 0X61, 0X5F, 0X5D, 0X5A,
-  0X58, 0X55, 0X52, 0X4F, 0X4B, 0X48, 0X44, 0X40, 0X3C, 0X37, 0X32, 0X2D,
-  0X28, 0X22, 0X1C, 0X15, 0X0E, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X0B, 0X12, 0X18, 0X1E, 0X24, 0X29, 0X2E, 0X33,
-  0X37, 0X3B, 0X3F, 0X43, 0X46, 0X49, 0X4C, 0X4F, 0X52, 0X54, 0X57, 0X59,
-  0X5B, 0X5D, 0X5F, 0X60, 0X62, 0X63, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A,
-  0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C,
-  0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X66, 0X65, 0X63, 0X62,
-  0X60, 0X5F, 0X5D, 0X5B, 0X59, 0X57, 0X54, 0X52, 0X4F, 0X4C, 0X49, 0X46,
-  0X43, 0X3F, 0X3B, 0X37, 0X33, 0X2E, 0X29, 0X24, 0X1E, 0X18, 0X12, 0X0B,
-  0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X08, 0X0F, 0X15, 0X1B, 0X20, 0X25, 0X2A, 0X2E, 0X32, 0X36, 0X3A,
-  0X3D, 0X41, 0X44, 0X47, 0X49, 0X4C, 0X4E, 0X51, 0X53, 0X55, 0X56, 0X58,
-  0X5A, 0X5B, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63, 0X63, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64, 0X63, 0X63,
-  0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5B, 0X5A, 0X58, 0X56, 0X55, 0X53,
-  0X51, 0X4E, 0X4C, 0X49, 0X47, 0X44, 0X41, 0X3D, 0X3A, 0X36, 0X32, 0X2E,
-  0X2A, 0X25, 0X20, 0X1B, 0X15, 0X0F, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0B,
-  0X11, 0X17, 0X1C, 0X20, 0X25, 0X29, 0X2D, 0X31, 0X35, 0X38, 0X3B, 0X3E,
-  0X41, 0X44, 0X46, 0X48, 0X4A, 0X4C, 0X4E, 0X50, 0X52, 0X53, 0X55, 0X56,
-  0X57, 0X58, 0X59, 0X5A, 0X5B, 0X5B, 0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D,
-  0X5D, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58, 0X57,
-  0X56, 0X55, 0X53, 0X52, 0X50, 0X4E, 0X4C, 0X4A, 0X48, 0X46, 0X44, 0X41,
-  0X3E, 0X3B, 0X38, 0X35, 0X31, 0X2D, 0X29, 0X25, 0X20, 0X1C, 0X17, 0X11,
-  0X0B, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X08, 0X0D, 0X13, 0X17,
-  0X1C, 0X21, 0X25, 0X28, 0X2C, 0X2F, 0X33, 0X36, 0X38, 0X3B, 0X3E, 0X40,
-  0X42, 0X44, 0X46, 0X48, 0X4A, 0X4B, 0X4D, 0X4E, 0X4F, 0X50, 0X51, 0X52,
-  0X53, 0X53, 0X54, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55,
-  0X54, 0X54, 0X53, 0X53, 0X52, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4B, 0X4A,
-  0X48, 0X46, 0X44, 0X42, 0X40, 0X3E, 0X3B, 0X38, 0X36, 0X33, 0X2F, 0X2C,
-  0X28, 0X25, 0X21, 0X1C, 0X17, 0X13, 0X0D, 0X08, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0E, 0X13, 0X18, 0X1C, 0X20,
-  0X23, 0X27, 0X2A, 0X2D, 0X30, 0X33, 0X35, 0X38, 0X3A, 0X3C, 0X3E, 0X40,
-  0X41, 0X43, 0X44, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4B, 0X4B, 0X4C, 0X4C,
-  0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4B,
-  0X4A, 0X49, 0X48, 0X47, 0X46, 0X44, 0X43, 0X41, 0X40, 0X3E, 0X3C, 0X3A,
-  0X38, 0X35, 0X33, 0X30, 0X2D, 0X2A, 0X27, 0X23, 0X20, 0X1C, 0X18, 0X13,
-  0X0E, 0X09, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X05, 0X0A, 0X0F, 0X13, 0X17, 0X1B, 0X1E, 0X22, 0X25,
-  0X28, 0X2A, 0X2D, 0X2F, 0X32, 0X34, 0X36, 0X38, 0X39, 0X3B, 0X3C, 0X3E,
-  0X3F, 0X40, 0X41, 0X42, 0X43, 0X44, 0X44, 0X45, 0X45, 0X45, 0X45, 0X45,
-  0X45, 0X45, 0X45, 0X45, 0X45, 0X44, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3F,
-  0X3E, 0X3C, 0X3B, 0X39, 0X38, 0X36, 0X34, 0X32, 0X2F, 0X2D, 0X2A, 0X28,
-  0X25, 0X22, 0X1E, 0X1B, 0X17, 0X13, 0X0F, 0X0A, 0X05, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X06, 0X0A, 0X0E, 0X12, 0X15, 0X19, 0X1C, 0X1F, 0X22, 0X25, 0X27,
-  0X29, 0X2B, 0X2E, 0X2F, 0X31, 0X33, 0X34, 0X36, 0X37, 0X38, 0X39, 0X3A,
-  0X3B, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3C, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X36, 0X34, 0X33, 0X31,
-  0X2F, 0X2E, 0X2B, 0X29, 0X27, 0X25, 0X22, 0X1F, 0X1C, 0X19, 0X15, 0X12,
-  0X0E, 0X0A, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05,
-  0X09, 0X0D, 0X10, 0X14, 0X17, 0X1A, 0X1C, 0X1F, 0X21, 0X23, 0X25, 0X27,
-  0X29, 0X2B, 0X2C, 0X2E, 0X2F, 0X30, 0X31, 0X32, 0X33, 0X34, 0X34, 0X35,
-  0X35, 0X35, 0X35, 0X36, 0X36, 0X35, 0X35, 0X35, 0X35, 0X34, 0X34, 0X33,
-  0X32, 0X31, 0X30, 0X2F, 0X2E, 0X2C, 0X2B, 0X29, 0X27, 0X25, 0X23, 0X21,
-  0X1F, 0X1C, 0X1A, 0X17, 0X14, 0X10, 0X0D, 0X09, 0X05, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X08, 0X0B,
-  0X0E, 0X11, 0X14, 0X16, 0X19, 0X1B, 0X1D, 0X1F, 0X21, 0X23, 0X24, 0X26,
-  0X27, 0X28, 0X29, 0X2A, 0X2B, 0X2C, 0X2C, 0X2D, 0X2D, 0X2D, 0X2E, 0X2E,
-  0X2E, 0X2E, 0X2D, 0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X28, 0X27,
-  0X26, 0X24, 0X23, 0X21, 0X1F, 0X1D, 0X1B, 0X19, 0X16, 0X14, 0X11, 0X0E,
-  0X0B, 0X08, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X09, 0X0B, 0X0E,
-  0X11, 0X13, 0X15, 0X17, 0X19, 0X1A, 0X1C, 0X1E, 0X1F, 0X20, 0X21, 0X22,
-  0X23, 0X24, 0X24, 0X25, 0X25, 0X25, 0X26, 0X26, 0X26, 0X26, 0X25, 0X25,
-  0X25, 0X24, 0X24, 0X23, 0X22, 0X21, 0X20, 0X1F, 0X1E, 0X1C, 0X1A, 0X19,
-  0X17, 0X15, 0X13, 0X11, 0X0E, 0X0B, 0X09, 0X06, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X06, 0X08, 0X0B, 0X0D, 0X0F,
-  0X11, 0X12, 0X14, 0X16, 0X17, 0X18, 0X19, 0X1A, 0X1B, 0X1C, 0X1C, 0X1D,
-  0X1D, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1D, 0X1D, 0X1C, 0X1C, 0X1B,
-  0X1A, 0X19, 0X18, 0X17, 0X16, 0X14, 0X12, 0X11, 0X0F, 0X0D, 0X0B, 0X08,
-  0X06, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X05, 0X07, 0X09, 0X0A, 0X0C, 0X0D,
-  0X0F, 0X10, 0X11, 0X12, 0X13, 0X14, 0X14, 0X15, 0X15, 0X16, 0X16, 0X16,
-  0X16, 0X16, 0X16, 0X15, 0X15, 0X14, 0X14, 0X13, 0X12, 0X11, 0X10, 0X0F,
-  0X0D, 0X0C, 0X0A, 0X09, 0X07, 0X05, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X05, 0X07, 0X08, 0X09, 0X0A,
-  0X0B, 0X0C, 0X0D, 0X0D, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
-  0X0D, 0X0D, 0X0C, 0X0B, 0X0A, 0X09, 0X08, 0X07, 0X05, 0X04, 0X02, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X03, 0X04, 0X05, 0X05,
-  0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X05, 0X05, 0X04, 0X03,
-  0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00 };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("goatEye_upper_sym");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("goatEye_lower_sym");
 #else
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04, 0X05, 0X07, 0X08,
-  0X0A, 0X0B, 0X0B, 0X0C, 0X0D, 0X0E, 0X0E, 0X0E, 0X0F, 0X0F, 0X10, 0X10,
-  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X0F, 0X0F, 0X0E, 0X0E,
-  0X0E, 0X0D, 0X0D, 0X0C, 0X0B, 0X0B, 0X0A, 0X09, 0X07, 0X06, 0X05, 0X03,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X03, 0X05, 0X07, 0X09, 0X0A, 0X0B, 0X0C, 0X0D, 0X0E, 0X0F, 0X10,
-  0X11, 0X11, 0X12, 0X12, 0X13, 0X13, 0X14, 0X14, 0X14, 0X14, 0X14, 0X14,
-  0X14, 0X14, 0X14, 0X14, 0X13, 0X13, 0X13, 0X12, 0X12, 0X11, 0X11, 0X10,
-  0X0F, 0X0E, 0X0E, 0X0D, 0X0C, 0X0B, 0X0A, 0X09, 0X07, 0X05, 0X04, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04, 0X06, 0X08, 0X0B, 0X0C,
-  0X0D, 0X0F, 0X10, 0X11, 0X12, 0X13, 0X14, 0X14, 0X15, 0X15, 0X16, 0X16,
-  0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17,
-  0X17, 0X17, 0X17, 0X16, 0X16, 0X15, 0X15, 0X14, 0X13, 0X13, 0X12, 0X11,
-  0X10, 0X0F, 0X0E, 0X0D, 0X0C, 0X0B, 0X09, 0X08, 0X06, 0X04, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X04, 0X07, 0X0A, 0X0B, 0X0D, 0X0F, 0X10, 0X12, 0X13, 0X14, 0X15,
-  0X16, 0X17, 0X17, 0X18, 0X19, 0X19, 0X19, 0X1A, 0X1A, 0X1B, 0X1B, 0X1B,
-  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1B, 0X1B, 0X1B, 0X1B, 0X1A, 0X1A,
-  0X19, 0X19, 0X18, 0X18, 0X17, 0X17, 0X16, 0X15, 0X14, 0X13, 0X13, 0X12,
-  0X10, 0X0F, 0X0E, 0X0D, 0X0B, 0X0A, 0X07, 0X05, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X07, 0X0A, 0X0C, 0X0E,
-  0X10, 0X12, 0X13, 0X14, 0X16, 0X17, 0X18, 0X19, 0X1A, 0X1B, 0X1B, 0X1C,
-  0X1D, 0X1D, 0X1D, 0X1E, 0X1E, 0X1F, 0X1F, 0X1F, 0X1F, 0X1F, 0X1F, 0X1F,
-  0X1F, 0X1F, 0X1F, 0X1F, 0X1F, 0X1F, 0X1E, 0X1E, 0X1D, 0X1D, 0X1D, 0X1C,
-  0X1B, 0X1B, 0X1A, 0X19, 0X19, 0X18, 0X17, 0X16, 0X15, 0X14, 0X12, 0X11,
-  0X10, 0X0E, 0X0D, 0X0B, 0X09, 0X06, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X07, 0X0A, 0X0C, 0X0E, 0X10, 0X13, 0X14, 0X16, 0X17, 0X18,
-  0X19, 0X1B, 0X1C, 0X1C, 0X1D, 0X1E, 0X1F, 0X20, 0X20, 0X21, 0X21, 0X21,
-  0X22, 0X22, 0X22, 0X22, 0X22, 0X22, 0X22, 0X22, 0X22, 0X22, 0X22, 0X22,
-  0X22, 0X22, 0X22, 0X21, 0X21, 0X21, 0X20, 0X20, 0X1F, 0X1F, 0X1E, 0X1D,
-  0X1C, 0X1B, 0X1B, 0X19, 0X18, 0X18, 0X17, 0X15, 0X14, 0X13, 0X11, 0X0F,
-  0X0E, 0X0C, 0X0A, 0X07, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X09, 0X0C, 0X0E,
-  0X11, 0X13, 0X15, 0X16, 0X18, 0X1A, 0X1B, 0X1C, 0X1D, 0X1E, 0X20, 0X20,
-  0X21, 0X22, 0X23, 0X23, 0X24, 0X24, 0X25, 0X25, 0X25, 0X26, 0X26, 0X26,
-  0X26, 0X26, 0X26, 0X26, 0X26, 0X26, 0X26, 0X26, 0X26, 0X25, 0X25, 0X25,
-  0X25, 0X24, 0X24, 0X23, 0X23, 0X22, 0X22, 0X21, 0X20, 0X1F, 0X1F, 0X1E,
-  0X1D, 0X1C, 0X1A, 0X19, 0X18, 0X17, 0X16, 0X14, 0X12, 0X10, 0X0E, 0X0C,
-  0X0A, 0X07, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X05, 0X09, 0X0B, 0X0E, 0X10, 0X13, 0X15, 0X17, 0X18, 0X1B,
-  0X1C, 0X1D, 0X1F, 0X20, 0X21, 0X22, 0X23, 0X24, 0X25, 0X25, 0X26, 0X27,
-  0X27, 0X27, 0X28, 0X28, 0X28, 0X29, 0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2A,
-  0X2A, 0X2A, 0X2A, 0X29, 0X29, 0X29, 0X28, 0X28, 0X28, 0X27, 0X27, 0X27,
-  0X26, 0X26, 0X25, 0X25, 0X24, 0X23, 0X22, 0X21, 0X20, 0X20, 0X1F, 0X1D,
-  0X1C, 0X1B, 0X19, 0X18, 0X17, 0X15, 0X13, 0X11, 0X0F, 0X0D, 0X0A, 0X06,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X08, 0X0B, 0X0E,
-  0X10, 0X13, 0X15, 0X17, 0X19, 0X1B, 0X1D, 0X1E, 0X20, 0X21, 0X23, 0X24,
-  0X25, 0X26, 0X26, 0X27, 0X28, 0X29, 0X2A, 0X2A, 0X2B, 0X2B, 0X2B, 0X2C,
-  0X2C, 0X2C, 0X2C, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
-  0X2C, 0X2C, 0X2C, 0X2C, 0X2B, 0X2B, 0X2B, 0X2A, 0X2A, 0X29, 0X29, 0X28,
-  0X27, 0X26, 0X26, 0X25, 0X24, 0X23, 0X22, 0X21, 0X20, 0X1F, 0X1E, 0X1C,
-  0X1B, 0X19, 0X17, 0X16, 0X14, 0X11, 0X0F, 0X0C, 0X09, 0X04, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X07, 0X0B, 0X0D, 0X10, 0X12, 0X14, 0X17, 0X19, 0X1B,
-  0X1D, 0X1F, 0X20, 0X22, 0X24, 0X25, 0X26, 0X27, 0X28, 0X29, 0X2A, 0X2B,
-  0X2C, 0X2C, 0X2D, 0X2D, 0X2E, 0X2E, 0X2F, 0X2F, 0X30, 0X30, 0X30, 0X31,
-  0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X30, 0X30, 0X30, 0X2F,
-  0X2F, 0X2E, 0X2E, 0X2D, 0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X28,
-  0X27, 0X27, 0X26, 0X25, 0X24, 0X23, 0X21, 0X20, 0X1F, 0X1D, 0X1B, 0X1A,
-  0X18, 0X16, 0X13, 0X11, 0X0E, 0X0B, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X09, 0X0C,
-  0X0F, 0X12, 0X14, 0X16, 0X18, 0X1B, 0X1C, 0X1F, 0X20, 0X22, 0X24, 0X26,
-  0X27, 0X28, 0X29, 0X2A, 0X2C, 0X2C, 0X2D, 0X2E, 0X2F, 0X2F, 0X30, 0X31,
-  0X31, 0X32, 0X32, 0X32, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
-  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X32, 0X32, 0X32, 0X31, 0X31,
-  0X31, 0X30, 0X2F, 0X2E, 0X2E, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X28,
-  0X27, 0X26, 0X25, 0X24, 0X22, 0X21, 0X1F, 0X1E, 0X1C, 0X1A, 0X17, 0X16,
-  0X13, 0X10, 0X0C, 0X07, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X03, 0X07, 0X0B, 0X0E, 0X11, 0X14, 0X16, 0X19, 0X1A,
-  0X1D, 0X1F, 0X20, 0X23, 0X24, 0X26, 0X27, 0X29, 0X2B, 0X2C, 0X2D, 0X2E,
-  0X2F, 0X30, 0X31, 0X31, 0X32, 0X33, 0X33, 0X34, 0X34, 0X34, 0X35, 0X36,
-  0X36, 0X36, 0X36, 0X36, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X36, 0X36,
-  0X36, 0X36, 0X36, 0X36, 0X35, 0X35, 0X34, 0X34, 0X33, 0X33, 0X33, 0X32,
-  0X31, 0X31, 0X30, 0X2F, 0X2F, 0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X29, 0X27,
-  0X26, 0X25, 0X23, 0X22, 0X20, 0X1E, 0X1C, 0X1A, 0X17, 0X15, 0X11, 0X0D,
-  0X08, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X0A,
-  0X0D, 0X10, 0X13, 0X15, 0X18, 0X1A, 0X1D, 0X1F, 0X20, 0X22, 0X24, 0X26,
-  0X28, 0X2A, 0X2B, 0X2D, 0X2E, 0X2F, 0X30, 0X31, 0X32, 0X33, 0X34, 0X35,
-  0X35, 0X36, 0X36, 0X37, 0X38, 0X38, 0X39, 0X39, 0X39, 0X3A, 0X3A, 0X3A,
-  0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X39, 0X39,
-  0X39, 0X38, 0X38, 0X38, 0X37, 0X36, 0X36, 0X35, 0X35, 0X34, 0X33, 0X33,
-  0X32, 0X31, 0X30, 0X30, 0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X28, 0X27, 0X26,
-  0X24, 0X22, 0X20, 0X1F, 0X1C, 0X19, 0X16, 0X13, 0X0E, 0X08, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X07, 0X0B, 0X0F, 0X12, 0X15, 0X18, 0X1A,
-  0X1D, 0X1F, 0X21, 0X23, 0X25, 0X26, 0X28, 0X2A, 0X2C, 0X2D, 0X2F, 0X30,
-  0X31, 0X33, 0X33, 0X34, 0X35, 0X36, 0X37, 0X38, 0X39, 0X39, 0X3A, 0X3A,
-  0X3B, 0X3B, 0X3C, 0X3C, 0X3C, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3D, 0X3D, 0X3D, 0X3C, 0X3C, 0X3C, 0X3C, 0X3C, 0X3B, 0X3B, 0X3B,
-  0X3A, 0X3A, 0X39, 0X39, 0X38, 0X38, 0X37, 0X36, 0X35, 0X34, 0X34, 0X33,
-  0X32, 0X31, 0X30, 0X2F, 0X2E, 0X2C, 0X2B, 0X29, 0X28, 0X26, 0X25, 0X23,
-  0X20, 0X1E, 0X1B, 0X17, 0X13, 0X0F, 0X09, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05,
-  0X0A, 0X0D, 0X11, 0X14, 0X17, 0X19, 0X1C, 0X1E, 0X21, 0X23, 0X25, 0X26,
-  0X28, 0X2A, 0X2C, 0X2D, 0X2F, 0X31, 0X32, 0X34, 0X35, 0X36, 0X37, 0X38,
-  0X39, 0X3A, 0X3B, 0X3B, 0X3C, 0X3D, 0X3D, 0X3D, 0X3E, 0X3E, 0X3F, 0X3F,
-  0X3F, 0X3F, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40,
-  0X40, 0X3F, 0X3F, 0X3F, 0X3F, 0X3E, 0X3E, 0X3E, 0X3D, 0X3D, 0X3C, 0X3C,
-  0X3B, 0X3B, 0X3A, 0X3A, 0X39, 0X38, 0X37, 0X36, 0X35, 0X34, 0X33, 0X32,
-  0X31, 0X30, 0X2F, 0X2D, 0X2C, 0X2A, 0X28, 0X26, 0X24, 0X22, 0X1F, 0X1C,
-  0X19, 0X14, 0X0F, 0X0A, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0B, 0X0F, 0X12, 0X16, 0X18,
-  0X1B, 0X1E, 0X20, 0X23, 0X25, 0X26, 0X29, 0X2B, 0X2C, 0X2E, 0X30, 0X31,
-  0X33, 0X34, 0X36, 0X37, 0X38, 0X3A, 0X3A, 0X3B, 0X3C, 0X3D, 0X3E, 0X3F,
-  0X3F, 0X40, 0X41, 0X41, 0X42, 0X42, 0X42, 0X43, 0X43, 0X43, 0X43, 0X43,
-  0X43, 0X44, 0X44, 0X44, 0X44, 0X44, 0X43, 0X43, 0X43, 0X43, 0X43, 0X43,
-  0X42, 0X42, 0X42, 0X41, 0X41, 0X40, 0X40, 0X3F, 0X3F, 0X3E, 0X3D, 0X3D,
-  0X3C, 0X3B, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X36, 0X35, 0X33, 0X32, 0X31,
-  0X30, 0X2E, 0X2C, 0X2B, 0X29, 0X26, 0X24, 0X21, 0X1D, 0X19, 0X15, 0X10,
-  0X0A, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X08, 0X0D, 0X11, 0X14, 0X17, 0X1A, 0X1D, 0X20, 0X22, 0X24, 0X26,
-  0X29, 0X2A, 0X2C, 0X2E, 0X30, 0X32, 0X33, 0X35, 0X36, 0X38, 0X39, 0X3B,
-  0X3C, 0X3D, 0X3E, 0X3E, 0X3F, 0X40, 0X41, 0X42, 0X43, 0X43, 0X44, 0X44,
-  0X45, 0X45, 0X45, 0X46, 0X46, 0X46, 0X46, 0X46, 0X46, 0X47, 0X47, 0X47,
-  0X47, 0X47, 0X46, 0X46, 0X46, 0X46, 0X46, 0X46, 0X45, 0X45, 0X45, 0X45,
-  0X44, 0X44, 0X43, 0X43, 0X42, 0X42, 0X41, 0X40, 0X3F, 0X3E, 0X3E, 0X3D,
-  0X3C, 0X3B, 0X3B, 0X3A, 0X38, 0X37, 0X36, 0X34, 0X33, 0X32, 0X30, 0X2F,
-  0X2C, 0X2B, 0X28, 0X25, 0X22, 0X1F, 0X1A, 0X16, 0X10, 0X09, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X09, 0X0E, 0X12, 0X15,
-  0X19, 0X1C, 0X1F, 0X21, 0X24, 0X26, 0X29, 0X2B, 0X2D, 0X2F, 0X31, 0X32,
-  0X33, 0X35, 0X37, 0X39, 0X3A, 0X3B, 0X3C, 0X3E, 0X3F, 0X40, 0X41, 0X42,
-  0X43, 0X44, 0X44, 0X45, 0X46, 0X46, 0X47, 0X47, 0X47, 0X48, 0X48, 0X48,
-  0X49, 0X49, 0X49, 0X49, 0X49, 0X49, 0X49, 0X49, 0X49, 0X49, 0X49, 0X49,
-  0X49, 0X49, 0X49, 0X48, 0X48, 0X48, 0X48, 0X47, 0X47, 0X47, 0X46, 0X46,
-  0X45, 0X45, 0X44, 0X44, 0X43, 0X42, 0X42, 0X41, 0X40, 0X3F, 0X3E, 0X3D,
-  0X3C, 0X3B, 0X3A, 0X39, 0X37, 0X36, 0X34, 0X33, 0X31, 0X2F, 0X2C, 0X2A,
-  0X27, 0X23, 0X1F, 0X1B, 0X16, 0X10, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X09, 0X0F, 0X13, 0X17, 0X1A, 0X1E, 0X20, 0X23, 0X25,
-  0X28, 0X2A, 0X2C, 0X2E, 0X31, 0X32, 0X34, 0X35, 0X37, 0X39, 0X3A, 0X3C,
-  0X3D, 0X3E, 0X40, 0X41, 0X43, 0X44, 0X44, 0X45, 0X46, 0X47, 0X47, 0X48,
-  0X49, 0X49, 0X4A, 0X4A, 0X4A, 0X4B, 0X4B, 0X4B, 0X4C, 0X4C, 0X4C, 0X4C,
-  0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4B,
-  0X4B, 0X4B, 0X4B, 0X4A, 0X4A, 0X4A, 0X49, 0X49, 0X48, 0X48, 0X47, 0X47,
-  0X46, 0X45, 0X45, 0X44, 0X43, 0X43, 0X41, 0X41, 0X3F, 0X3E, 0X3D, 0X3C,
-  0X3B, 0X3A, 0X38, 0X36, 0X34, 0X33, 0X31, 0X2E, 0X2B, 0X28, 0X25, 0X21,
-  0X1C, 0X16, 0X10, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0A, 0X0F,
-  0X14, 0X18, 0X1C, 0X1F, 0X22, 0X25, 0X28, 0X2A, 0X2C, 0X2E, 0X31, 0X32,
-  0X34, 0X36, 0X38, 0X3A, 0X3B, 0X3C, 0X3E, 0X3F, 0X41, 0X42, 0X43, 0X45,
-  0X46, 0X47, 0X47, 0X48, 0X49, 0X4A, 0X4A, 0X4B, 0X4B, 0X4C, 0X4C, 0X4D,
-  0X4E, 0X4E, 0X4E, 0X4F, 0X4F, 0X4F, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50,
-  0X50, 0X50, 0X50, 0X50, 0X50, 0X4F, 0X4F, 0X4F, 0X4E, 0X4E, 0X4E, 0X4D,
-  0X4D, 0X4C, 0X4C, 0X4C, 0X4B, 0X4B, 0X4A, 0X4A, 0X49, 0X48, 0X48, 0X47,
-  0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3E, 0X3D, 0X3C, 0X3A,
-  0X39, 0X37, 0X34, 0X32, 0X30, 0X2D, 0X29, 0X26, 0X21, 0X1C, 0X16, 0X0F,
-  0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X09, 0X10, 0X15, 0X19, 0X1D, 0X20, 0X24,
-  0X26, 0X29, 0X2B, 0X2E, 0X30, 0X32, 0X34, 0X36, 0X38, 0X3A, 0X3B, 0X3D,
-  0X3E, 0X40, 0X41, 0X43, 0X44, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4A, 0X4B,
-  0X4C, 0X4D, 0X4D, 0X4E, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X52, 0X52, 0X52,
-  0X52, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53,
-  0X53, 0X53, 0X52, 0X52, 0X52, 0X52, 0X51, 0X51, 0X51, 0X50, 0X50, 0X4F,
-  0X4E, 0X4E, 0X4D, 0X4D, 0X4C, 0X4B, 0X4B, 0X4A, 0X49, 0X49, 0X48, 0X47,
-  0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X3F, 0X3E, 0X3C, 0X3B, 0X39, 0X36,
-  0X34, 0X31, 0X2E, 0X2B, 0X26, 0X22, 0X1C, 0X15, 0X0E, 0X04, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X08, 0X0F, 0X14, 0X19, 0X1D, 0X21, 0X25, 0X27, 0X2A, 0X2C, 0X30, 0X32,
-  0X34, 0X36, 0X38, 0X3A, 0X3B, 0X3D, 0X3E, 0X40, 0X42, 0X43, 0X45, 0X46,
-  0X47, 0X48, 0X49, 0X4B, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F, 0X50, 0X51, 0X52,
-  0X52, 0X53, 0X53, 0X54, 0X54, 0X54, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55,
-  0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X55, 0X55, 0X55, 0X55, 0X55,
-  0X55, 0X54, 0X54, 0X54, 0X53, 0X53, 0X53, 0X52, 0X52, 0X51, 0X51, 0X50,
-  0X4F, 0X4E, 0X4E, 0X4D, 0X4C, 0X4B, 0X4B, 0X4A, 0X49, 0X48, 0X47, 0X46,
-  0X45, 0X44, 0X43, 0X41, 0X40, 0X3E, 0X3C, 0X3A, 0X38, 0X35, 0X32, 0X2F,
-  0X2B, 0X27, 0X21, 0X1C, 0X14, 0X0B, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0E, 0X14, 0X19, 0X1E,
-  0X22, 0X26, 0X29, 0X2C, 0X2F, 0X31, 0X33, 0X36, 0X38, 0X3A, 0X3C, 0X3D,
-  0X3F, 0X41, 0X43, 0X44, 0X45, 0X47, 0X48, 0X49, 0X4A, 0X4B, 0X4C, 0X4E,
-  0X4F, 0X50, 0X51, 0X52, 0X53, 0X53, 0X54, 0X54, 0X55, 0X55, 0X56, 0X56,
-  0X57, 0X57, 0X57, 0X57, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58,
-  0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X57, 0X57, 0X57, 0X57,
-  0X56, 0X56, 0X55, 0X55, 0X55, 0X54, 0X54, 0X53, 0X53, 0X52, 0X52, 0X51,
-  0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49, 0X48, 0X47, 0X46, 0X45,
-  0X44, 0X42, 0X40, 0X3E, 0X3C, 0X3A, 0X36, 0X34, 0X30, 0X2B, 0X27, 0X21,
-  0X1B, 0X13, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X04, 0X0D, 0X14, 0X1A, 0X1E, 0X23, 0X26, 0X2A, 0X2D, 0X30,
-  0X33, 0X35, 0X38, 0X3A, 0X3C, 0X3D, 0X3F, 0X41, 0X43, 0X44, 0X46, 0X47,
-  0X48, 0X4A, 0X4B, 0X4C, 0X4D, 0X4F, 0X50, 0X52, 0X52, 0X53, 0X54, 0X55,
-  0X56, 0X56, 0X57, 0X57, 0X58, 0X58, 0X59, 0X59, 0X5A, 0X5A, 0X5A, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X59, 0X59, 0X58, 0X58,
-  0X58, 0X57, 0X57, 0X56, 0X56, 0X55, 0X55, 0X54, 0X53, 0X53, 0X52, 0X51,
-  0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X49, 0X48, 0X47, 0X46, 0X44, 0X42,
-  0X40, 0X3D, 0X3B, 0X38, 0X35, 0X31, 0X2C, 0X27, 0X22, 0X1A, 0X12, 0X06,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0B, 0X13,
-  0X19, 0X1E, 0X23, 0X28, 0X2B, 0X2F, 0X32, 0X34, 0X37, 0X3A, 0X3C, 0X3D,
-  0X40, 0X42, 0X44, 0X45, 0X47, 0X48, 0X49, 0X4B, 0X4C, 0X4D, 0X4F, 0X50,
-  0X51, 0X53, 0X54, 0X55, 0X55, 0X56, 0X57, 0X58, 0X59, 0X59, 0X5A, 0X5A,
-  0X5B, 0X5B, 0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5D,
-  0X5D, 0X5D, 0X5D, 0X5C, 0X5C, 0X5C, 0X5B, 0X5B, 0X5B, 0X5A, 0X5A, 0X59,
-  0X59, 0X58, 0X58, 0X57, 0X56, 0X56, 0X55, 0X54, 0X53, 0X53, 0X52, 0X51,
-  0X50, 0X4F, 0X4D, 0X4C, 0X4A, 0X49, 0X48, 0X46, 0X44, 0X42, 0X3F, 0X3D,
-  0X3A, 0X36, 0X32, 0X2C, 0X27, 0X21, 0X19, 0X10, 0X04, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X11, 0X18, 0X1E, 0X24, 0X28, 0X2C,
-  0X30, 0X33, 0X36, 0X39, 0X3B, 0X3D, 0X40, 0X42, 0X44, 0X45, 0X47, 0X48,
-  0X4A, 0X4B, 0X4D, 0X4E, 0X50, 0X51, 0X52, 0X54, 0X55, 0X56, 0X57, 0X58,
-  0X59, 0X59, 0X5A, 0X5B, 0X5C, 0X5C, 0X5D, 0X5D, 0X5E, 0X5E, 0X5F, 0X5F,
-  0X60, 0X60, 0X60, 0X60, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61,
-  0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X60, 0X5F,
-  0X5F, 0X5F, 0X5E, 0X5E, 0X5E, 0X5D, 0X5D, 0X5C, 0X5C, 0X5B, 0X5B, 0X5A,
-  0X59, 0X59, 0X58, 0X57, 0X57, 0X56, 0X55, 0X54, 0X53, 0X52, 0X51, 0X50,
-  0X4E, 0X4C, 0X4B, 0X4A, 0X48, 0X46, 0X44, 0X41, 0X3E, 0X3B, 0X37, 0X32,
-  0X2D, 0X27, 0X20, 0X17, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X05, 0X0F, 0X17, 0X1D, 0X23, 0X28, 0X2D, 0X31, 0X34, 0X37, 0X3A, 0X3D,
-  0X3F, 0X41, 0X44, 0X45, 0X47, 0X49, 0X4A, 0X4C, 0X4D, 0X4F, 0X51, 0X52,
-  0X53, 0X54, 0X55, 0X57, 0X58, 0X59, 0X5A, 0X5B, 0X5C, 0X5C, 0X5D, 0X5E,
-  0X5F, 0X5F, 0X60, 0X60, 0X61, 0X61, 0X62, 0X62, 0X62, 0X63, 0X63, 0X63,
-  0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64,
-  0X64, 0X63, 0X63, 0X63, 0X63, 0X63, 0X62, 0X62, 0X62, 0X62, 0X61, 0X61,
-  0X60, 0X60, 0X60, 0X5F, 0X5F, 0X5E, 0X5E, 0X5D, 0X5C, 0X5C, 0X5B, 0X5A,
-  0X5A, 0X59, 0X58, 0X57, 0X56, 0X55, 0X54, 0X53, 0X52, 0X51, 0X4F, 0X4E,
-  0X4C, 0X4A, 0X48, 0X46, 0X43, 0X3F, 0X3C, 0X37, 0X32, 0X2D, 0X26, 0X1F,
-  0X15, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0B, 0X15, 0X1C, 0X23,
-  0X28, 0X2D, 0X31, 0X35, 0X39, 0X3B, 0X3E, 0X41, 0X43, 0X45, 0X47, 0X49,
-  0X4B, 0X4C, 0X4E, 0X50, 0X52, 0X53, 0X54, 0X55, 0X56, 0X58, 0X59, 0X5A,
-  0X5B, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X60, 0X61, 0X62, 0X62, 0X63, 0X63,
-  0X64, 0X64, 0X65, 0X65, 0X65, 0X66, 0X66, 0X66, 0X66, 0X67, 0X67, 0X67,
-  0X67, 0X67, 0X67, 0X67, 0X67, 0X67, 0X67, 0X67, 0X67, 0X66, 0X66, 0X66,
-  0X66, 0X66, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64, 0X63, 0X63, 0X63, 0X62,
-  0X62, 0X61, 0X61, 0X60, 0X60, 0X5F, 0X5E, 0X5D, 0X5D, 0X5C, 0X5B, 0X5A,
-  0X59, 0X59, 0X58, 0X57, 0X55, 0X54, 0X53, 0X52, 0X50, 0X4E, 0X4B, 0X49,
-  0X47, 0X44, 0X41, 0X3D, 0X38, 0X33, 0X2C, 0X26, 0X1D, 0X12, 0X05, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X06, 0X12, 0X1A, 0X21, 0X27, 0X2D, 0X32, 0X36, 0X3A,
-  0X3D, 0X40, 0X43, 0X45, 0X47, 0X49, 0X4B, 0X4D, 0X4F, 0X51, 0X52, 0X54,
-  0X55, 0X56, 0X58, 0X59, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61,
-  0X62, 0X63, 0X63, 0X64, 0X65, 0X65, 0X66, 0X66, 0X67, 0X67, 0X67, 0X68,
-  0X68, 0X68, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X6A, 0X6A, 0X6A, 0X6A,
-  0X6A, 0X6A, 0X6A, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X68, 0X68, 0X68,
-  0X68, 0X67, 0X67, 0X67, 0X66, 0X66, 0X65, 0X65, 0X65, 0X64, 0X64, 0X63,
-  0X62, 0X62, 0X61, 0X61, 0X60, 0X5F, 0X5E, 0X5E, 0X5D, 0X5C, 0X5B, 0X5A,
-  0X59, 0X58, 0X57, 0X55, 0X54, 0X52, 0X50, 0X4E, 0X4B, 0X48, 0X46, 0X42,
-  0X3D, 0X38, 0X33, 0X2C, 0X24, 0X1B, 0X0F, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0D,
-  0X18, 0X20, 0X26, 0X2C, 0X32, 0X36, 0X3A, 0X3E, 0X41, 0X44, 0X46, 0X49,
-  0X4B, 0X4C, 0X4F, 0X51, 0X53, 0X54, 0X56, 0X57, 0X58, 0X59, 0X5B, 0X5C,
-  0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63, 0X64, 0X65, 0X66, 0X66, 0X67,
-  0X68, 0X68, 0X69, 0X69, 0X6A, 0X6A, 0X6B, 0X6B, 0X6B, 0X6B, 0X6C, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6B, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A, 0X6A,
-  0X69, 0X69, 0X69, 0X68, 0X68, 0X67, 0X67, 0X66, 0X66, 0X65, 0X64, 0X64,
-  0X63, 0X62, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5C, 0X5B, 0X5A, 0X59,
-  0X57, 0X56, 0X54, 0X52, 0X50, 0X4D, 0X4A, 0X47, 0X43, 0X3E, 0X39, 0X33,
-  0X2B, 0X22, 0X18, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X07, 0X14, 0X1D, 0X25, 0X2B, 0X31,
-  0X36, 0X3B, 0X3F, 0X42, 0X45, 0X48, 0X4A, 0X4D, 0X4F, 0X51, 0X53, 0X55,
-  0X56, 0X58, 0X59, 0X5B, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63,
-  0X64, 0X65, 0X66, 0X67, 0X68, 0X69, 0X69, 0X6A, 0X6B, 0X6B, 0X6C, 0X6C,
-  0X6D, 0X6D, 0X6D, 0X6E, 0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F,
-  0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F,
-  0X6E, 0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B,
-  0X6A, 0X6A, 0X6A, 0X69, 0X69, 0X68, 0X67, 0X67, 0X66, 0X65, 0X65, 0X64,
-  0X63, 0X62, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5B, 0X5A, 0X58, 0X56,
-  0X54, 0X52, 0X4E, 0X4B, 0X48, 0X43, 0X3E, 0X39, 0X32, 0X2A, 0X21, 0X14,
-  0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X0F, 0X19, 0X23, 0X2A, 0X30, 0X36, 0X3B, 0X3F, 0X43, 0X46,
-  0X49, 0X4C, 0X4E, 0X51, 0X53, 0X55, 0X57, 0X58, 0X5A, 0X5B, 0X5D, 0X5E,
-  0X5F, 0X60, 0X62, 0X63, 0X64, 0X65, 0X66, 0X67, 0X67, 0X68, 0X69, 0X6A,
-  0X6B, 0X6C, 0X6C, 0X6D, 0X6E, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X70, 0X71,
-  0X71, 0X71, 0X71, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72,
-  0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X72, 0X71, 0X71, 0X71, 0X71,
-  0X70, 0X70, 0X70, 0X70, 0X6F, 0X6F, 0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X69, 0X68, 0X67, 0X66, 0X66, 0X65, 0X64,
-  0X63, 0X62, 0X61, 0X60, 0X5F, 0X5D, 0X5C, 0X5A, 0X58, 0X56, 0X54, 0X50,
-  0X4C, 0X49, 0X44, 0X3F, 0X38, 0X31, 0X29, 0X1D, 0X0E, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X14, 0X1F,
-  0X27, 0X2F, 0X34, 0X3A, 0X3F, 0X43, 0X47, 0X4A, 0X4D, 0X50, 0X52, 0X54,
-  0X56, 0X58, 0X5A, 0X5B, 0X5D, 0X5E, 0X60, 0X61, 0X62, 0X63, 0X65, 0X66,
-  0X67, 0X68, 0X69, 0X6A, 0X6A, 0X6B, 0X6C, 0X6D, 0X6E, 0X6F, 0X6F, 0X70,
-  0X70, 0X71, 0X71, 0X72, 0X72, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74, 0X74,
-  0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X75,
-  0X75, 0X75, 0X74, 0X74, 0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X73, 0X72,
-  0X72, 0X72, 0X71, 0X71, 0X70, 0X70, 0X6F, 0X6F, 0X6E, 0X6E, 0X6D, 0X6D,
-  0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X69, 0X68, 0X67, 0X66, 0X65, 0X64, 0X63,
-  0X62, 0X61, 0X5F, 0X5E, 0X5C, 0X5A, 0X57, 0X55, 0X52, 0X4D, 0X49, 0X44,
-  0X3E, 0X37, 0X2F, 0X25, 0X18, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X0E, 0X1A, 0X24, 0X2C, 0X33, 0X39, 0X3F,
-  0X44, 0X47, 0X4B, 0X4E, 0X51, 0X54, 0X56, 0X59, 0X5A, 0X5C, 0X5E, 0X5F,
-  0X61, 0X62, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A, 0X6B, 0X6C, 0X6D,
-  0X6E, 0X6E, 0X6F, 0X70, 0X71, 0X72, 0X72, 0X73, 0X73, 0X74, 0X74, 0X75,
-  0X75, 0X76, 0X76, 0X76, 0X76, 0X77, 0X77, 0X77, 0X77, 0X77, 0X78, 0X78,
-  0X78, 0X78, 0X78, 0X78, 0X78, 0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X77, 0X76, 0X76, 0X76, 0X76, 0X75, 0X75, 0X75, 0X74, 0X74, 0X74,
-  0X73, 0X73, 0X72, 0X72, 0X71, 0X71, 0X70, 0X70, 0X6F, 0X6F, 0X6E, 0X6D,
-  0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X69, 0X68, 0X67, 0X66, 0X65, 0X63, 0X62,
-  0X60, 0X5E, 0X5C, 0X59, 0X56, 0X53, 0X4E, 0X49, 0X44, 0X3E, 0X37, 0X2D,
-  0X21, 0X11, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X06, 0X15, 0X20, 0X29, 0X31, 0X38, 0X3E, 0X43, 0X48, 0X4B, 0X4F, 0X53,
-  0X55, 0X58, 0X5A, 0X5C, 0X5E, 0X5F, 0X61, 0X63, 0X64, 0X65, 0X67, 0X68,
-  0X69, 0X6A, 0X6B, 0X6C, 0X6D, 0X6E, 0X6F, 0X70, 0X71, 0X72, 0X72, 0X73,
-  0X74, 0X75, 0X75, 0X76, 0X76, 0X77, 0X77, 0X78, 0X78, 0X79, 0X79, 0X79,
-  0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7B, 0X7B, 0X7B, 0X7B, 0X7B, 0X7B,
-  0X7B, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X79, 0X79,
-  0X79, 0X79, 0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X76, 0X76, 0X75, 0X75,
-  0X74, 0X74, 0X73, 0X73, 0X72, 0X72, 0X71, 0X70, 0X70, 0X6F, 0X6E, 0X6E,
-  0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X65, 0X64, 0X62, 0X60, 0X5D,
-  0X5B, 0X58, 0X54, 0X4F, 0X4A, 0X44, 0X3D, 0X35, 0X2A, 0X1C, 0X07, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0E, 0X1B, 0X25, 0X2E,
-  0X36, 0X3D, 0X43, 0X48, 0X4C, 0X50, 0X54, 0X57, 0X59, 0X5C, 0X5E, 0X60,
-  0X62, 0X63, 0X65, 0X67, 0X68, 0X69, 0X6B, 0X6C, 0X6D, 0X6E, 0X6F, 0X70,
-  0X71, 0X72, 0X72, 0X73, 0X74, 0X75, 0X76, 0X76, 0X77, 0X78, 0X78, 0X79,
-  0X79, 0X7A, 0X7A, 0X7B, 0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D,
-  0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D,
-  0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7B,
-  0X7B, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X78, 0X78, 0X77, 0X77, 0X76, 0X76,
-  0X75, 0X75, 0X74, 0X74, 0X73, 0X72, 0X72, 0X71, 0X70, 0X70, 0X6F, 0X6E,
-  0X6D, 0X6C, 0X6B, 0X69, 0X68, 0X66, 0X64, 0X62, 0X60, 0X5C, 0X59, 0X55,
-  0X50, 0X4A, 0X44, 0X3C, 0X32, 0X26, 0X14, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X05, 0X15, 0X21, 0X2B, 0X34, 0X3B, 0X42, 0X47, 0X4C,
-  0X51, 0X54, 0X58, 0X5B, 0X5D, 0X60, 0X62, 0X64, 0X65, 0X67, 0X69, 0X6A,
-  0X6B, 0X6C, 0X6E, 0X6F, 0X70, 0X71, 0X72, 0X73, 0X74, 0X75, 0X76, 0X76,
-  0X77, 0X78, 0X79, 0X79, 0X7A, 0X7B, 0X7B, 0X7C, 0X7C, 0X7D, 0X7D, 0X7E,
-  0X7E, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X80, 0X80, 0X80, 0X80, 0X80,
-  0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7D, 0X7D, 0X7D,
-  0X7C, 0X7C, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X79, 0X79, 0X78, 0X77, 0X77,
-  0X76, 0X76, 0X75, 0X74, 0X73, 0X73, 0X72, 0X71, 0X70, 0X6F, 0X6E, 0X6D,
-  0X6C, 0X6A, 0X68, 0X66, 0X64, 0X61, 0X5E, 0X5A, 0X56, 0X51, 0X4B, 0X44,
-  0X3A, 0X2F, 0X1F, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0D,
-  0X1B, 0X26, 0X30, 0X38, 0X40, 0X47, 0X4B, 0X51, 0X55, 0X59, 0X5C, 0X5F,
-  0X61, 0X64, 0X66, 0X68, 0X69, 0X6B, 0X6D, 0X6E, 0X6F, 0X70, 0X72, 0X73,
-  0X74, 0X75, 0X76, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X7A, 0X7B, 0X7C, 0X7D,
-  0X7D, 0X7E, 0X7E, 0X7F, 0X7F, 0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X81,
-  0X81, 0X81, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X81, 0X81, 0X81, 0X81, 0X81,
-  0X81, 0X81, 0X80, 0X80, 0X80, 0X80, 0X80, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E,
-  0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7B, 0X7B, 0X7A, 0X79, 0X79, 0X78, 0X78,
-  0X77, 0X76, 0X76, 0X75, 0X74, 0X73, 0X72, 0X71, 0X70, 0X6E, 0X6D, 0X6B,
-  0X68, 0X66, 0X63, 0X5F, 0X5B, 0X56, 0X52, 0X4A, 0X42, 0X37, 0X29, 0X14,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X14, 0X21, 0X2C, 0X35, 0X3E,
-  0X45, 0X4B, 0X50, 0X55, 0X59, 0X5D, 0X60, 0X63, 0X65, 0X67, 0X69, 0X6B,
-  0X6D, 0X6E, 0X70, 0X71, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X7A,
-  0X7A, 0X7B, 0X7C, 0X7D, 0X7E, 0X7E, 0X7F, 0X7F, 0X80, 0X80, 0X81, 0X81,
-  0X82, 0X82, 0X82, 0X83, 0X83, 0X83, 0X84, 0X84, 0X84, 0X84, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X84, 0X84, 0X83, 0X83, 0X83,
-  0X82, 0X82, 0X82, 0X82, 0X81, 0X81, 0X80, 0X80, 0X80, 0X80, 0X7F, 0X7F,
-  0X7F, 0X7E, 0X7E, 0X7D, 0X7D, 0X7C, 0X7B, 0X7B, 0X7A, 0X7A, 0X79, 0X78,
-  0X77, 0X77, 0X76, 0X75, 0X74, 0X72, 0X71, 0X6F, 0X6D, 0X6A, 0X68, 0X64,
-  0X61, 0X5C, 0X58, 0X51, 0X49, 0X40, 0X33, 0X21, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X0B, 0X1A, 0X27, 0X31, 0X3A, 0X43, 0X4A, 0X50, 0X55, 0X59,
-  0X5D, 0X61, 0X64, 0X67, 0X69, 0X6B, 0X6D, 0X6F, 0X71, 0X72, 0X74, 0X75,
-  0X76, 0X77, 0X79, 0X7A, 0X7B, 0X7B, 0X7C, 0X7D, 0X7E, 0X7F, 0X7F, 0X80,
-  0X80, 0X81, 0X81, 0X82, 0X82, 0X83, 0X84, 0X84, 0X85, 0X85, 0X85, 0X86,
-  0X86, 0X86, 0X87, 0X87, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X87, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86, 0X86, 0X85, 0X85, 0X85, 0X84,
-  0X84, 0X84, 0X83, 0X83, 0X83, 0X82, 0X82, 0X81, 0X81, 0X81, 0X80, 0X80,
-  0X80, 0X7F, 0X7F, 0X7E, 0X7E, 0X7D, 0X7D, 0X7C, 0X7B, 0X7B, 0X7A, 0X79,
-  0X78, 0X76, 0X75, 0X73, 0X71, 0X6F, 0X6D, 0X69, 0X66, 0X62, 0X5D, 0X58,
-  0X51, 0X48, 0X3C, 0X2C, 0X13, 0X00, 0X00, 0X00, 0X00, 0X03, 0X12, 0X21,
-  0X2D, 0X37, 0X40, 0X47, 0X4E, 0X54, 0X59, 0X5E, 0X62, 0X65, 0X68, 0X6B,
-  0X6D, 0X6F, 0X71, 0X73, 0X74, 0X76, 0X77, 0X78, 0X7A, 0X7B, 0X7C, 0X7D,
-  0X7E, 0X7F, 0X7F, 0X80, 0X80, 0X81, 0X82, 0X82, 0X83, 0X84, 0X84, 0X85,
-  0X86, 0X86, 0X87, 0X87, 0X88, 0X88, 0X88, 0X89, 0X89, 0X89, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B,
-  0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X89, 0X89, 0X89, 0X89, 0X88, 0X88, 0X88, 0X87, 0X87, 0X87, 0X86, 0X86,
-  0X86, 0X85, 0X85, 0X84, 0X84, 0X83, 0X83, 0X83, 0X82, 0X82, 0X81, 0X81,
-  0X80, 0X80, 0X7F, 0X7F, 0X7F, 0X7E, 0X7D, 0X7C, 0X7B, 0X7A, 0X79, 0X77,
-  0X76, 0X74, 0X71, 0X6F, 0X6B, 0X68, 0X64, 0X5F, 0X58, 0X50, 0X45, 0X37,
-  0X21, 0X04, 0X00, 0X00, 0X00, 0X09, 0X1A, 0X27, 0X32, 0X3C, 0X45, 0X4C,
-  0X53, 0X59, 0X5E, 0X62, 0X66, 0X69, 0X6C, 0X6F, 0X71, 0X73, 0X75, 0X77,
-  0X79, 0X7A, 0X7B, 0X7C, 0X7E, 0X7F, 0X7F, 0X80, 0X81, 0X81, 0X82, 0X83,
-  0X84, 0X84, 0X85, 0X86, 0X86, 0X87, 0X88, 0X88, 0X89, 0X89, 0X8A, 0X8A,
-  0X8B, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B,
-  0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X89, 0X88, 0X88, 0X87,
-  0X87, 0X87, 0X86, 0X86, 0X85, 0X85, 0X84, 0X84, 0X83, 0X83, 0X82, 0X82,
-  0X81, 0X81, 0X81, 0X80, 0X7F, 0X7E, 0X7D, 0X7C, 0X7A, 0X78, 0X76, 0X73,
-  0X70, 0X6D, 0X69, 0X65, 0X5F, 0X58, 0X4E, 0X41, 0X2E, 0X0E, 0X00, 0X00,
-  0X02, 0X12, 0X21, 0X2D, 0X38, 0X42, 0X4A, 0X52, 0X58, 0X5D, 0X62, 0X66,
-  0X6A, 0X6D, 0X70, 0X73, 0X75, 0X77, 0X79, 0X7B, 0X7C, 0X7D, 0X7F, 0X7F,
-  0X80, 0X81, 0X82, 0X83, 0X84, 0X85, 0X85, 0X86, 0X87, 0X88, 0X88, 0X89,
-  0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8D, 0X8D, 0X8E, 0X8E, 0X8E, 0X8F,
-  0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8F, 0X8E, 0X8E, 0X8E, 0X8E, 0X8D,
-  0X8D, 0X8D, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X89,
-  0X88, 0X88, 0X88, 0X87, 0X87, 0X86, 0X86, 0X85, 0X85, 0X84, 0X84, 0X83,
-  0X82, 0X81, 0X80, 0X80, 0X7F, 0X7D, 0X7B, 0X78, 0X76, 0X73, 0X6F, 0X6B,
-  0X65, 0X5E, 0X56, 0X4A, 0X39, 0X1D, 0X00, 0X00, 0X09, 0X18, 0X27, 0X32,
-  0X3D, 0X46, 0X4F, 0X56, 0X5C, 0X61, 0X66, 0X6A, 0X6E, 0X71, 0X74, 0X76,
-  0X79, 0X7B, 0X7C, 0X7E, 0X7F, 0X80, 0X81, 0X82, 0X83, 0X84, 0X85, 0X86,
-  0X87, 0X88, 0X89, 0X89, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8D, 0X8E, 0X8E,
-  0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X91, 0X91, 0X91, 0X91, 0X91, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X91, 0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F,
-  0X8E, 0X8E, 0X8E, 0X8D, 0X8D, 0X8D, 0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8A,
-  0X8A, 0X89, 0X89, 0X88, 0X88, 0X87, 0X87, 0X86, 0X86, 0X85, 0X84, 0X83,
-  0X81, 0X80, 0X7F, 0X7D, 0X7B, 0X78, 0X74, 0X70, 0X6B, 0X65, 0X5D, 0X52,
-  0X43, 0X2A, 0X05, 0X00, 0X11, 0X1F, 0X2D, 0X38, 0X42, 0X4B, 0X54, 0X5B,
-  0X61, 0X66, 0X6A, 0X6F, 0X72, 0X76, 0X78, 0X7B, 0X7D, 0X7F, 0X80, 0X81,
-  0X83, 0X84, 0X85, 0X86, 0X87, 0X88, 0X89, 0X8A, 0X8B, 0X8B, 0X8C, 0X8D,
-  0X8D, 0X8E, 0X8F, 0X8F, 0X90, 0X90, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92,
-  0X93, 0X93, 0X93, 0X93, 0X94, 0X94, 0X94, 0X94, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93, 0X93, 0X93,
-  0X93, 0X92, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X91, 0X91, 0X90,
-  0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8E, 0X8E, 0X8E, 0X8D, 0X8D, 0X8C, 0X8C,
-  0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X88, 0X87, 0X86, 0X84, 0X83, 0X81,
-  0X7F, 0X7D, 0X7A, 0X76, 0X72, 0X6C, 0X65, 0X5B, 0X4E, 0X38, 0X10, 0X00,
-  0X19, 0X26, 0X33, 0X3E, 0X48, 0X51, 0X59, 0X5F, 0X66, 0X6A, 0X6F, 0X73,
-  0X76, 0X7A, 0X7C, 0X7F, 0X80, 0X82, 0X83, 0X85, 0X86, 0X87, 0X89, 0X8A,
-  0X8B, 0X8B, 0X8C, 0X8D, 0X8E, 0X8F, 0X8F, 0X90, 0X90, 0X91, 0X91, 0X92,
-  0X92, 0X93, 0X93, 0X94, 0X94, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X97,
-  0X97, 0X97, 0X97, 0X97, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X97,
-  0X97, 0X97, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X96, 0X95, 0X95, 0X95,
-  0X95, 0X94, 0X94, 0X94, 0X94, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X91,
-  0X91, 0X91, 0X91, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8E, 0X8E,
-  0X8D, 0X8D, 0X8C, 0X8B, 0X8A, 0X89, 0X87, 0X86, 0X84, 0X81, 0X7F, 0X7C,
-  0X78, 0X73, 0X6C, 0X64, 0X58, 0X45, 0X20, 0X00, 0X20, 0X2E, 0X39, 0X44,
-  0X4D, 0X56, 0X5D, 0X64, 0X6A, 0X6F, 0X73, 0X77, 0X7B, 0X7E, 0X80, 0X82,
-  0X84, 0X86, 0X87, 0X89, 0X8A, 0X8B, 0X8D, 0X8E, 0X8F, 0X8F, 0X90, 0X91,
-  0X91, 0X92, 0X92, 0X93, 0X93, 0X94, 0X94, 0X95, 0X95, 0X96, 0X96, 0X97,
-  0X97, 0X98, 0X98, 0X98, 0X99, 0X99, 0X99, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X99,
-  0X99, 0X99, 0X99, 0X99, 0X98, 0X98, 0X98, 0X98, 0X98, 0X97, 0X97, 0X97,
-  0X96, 0X96, 0X96, 0X96, 0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X93, 0X93,
-  0X93, 0X93, 0X92, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X90, 0X8F,
-  0X8F, 0X8D, 0X8C, 0X8A, 0X88, 0X86, 0X84, 0X81, 0X7E, 0X7A, 0X74, 0X6C,
-  0X61, 0X51, 0X32, 0X04, 0X28, 0X34, 0X3F, 0X4A, 0X53, 0X5B, 0X62, 0X69,
-  0X6F, 0X73, 0X78, 0X7B, 0X7F, 0X81, 0X84, 0X86, 0X88, 0X8A, 0X8B, 0X8D,
-  0X8E, 0X8F, 0X90, 0X91, 0X91, 0X92, 0X93, 0X93, 0X94, 0X95, 0X95, 0X96,
-  0X96, 0X97, 0X98, 0X98, 0X99, 0X99, 0X99, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9B, 0X9B, 0X9B, 0X9B, 0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99,
-  0X98, 0X98, 0X98, 0X98, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X96, 0X95,
-  0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X93, 0X92, 0X92, 0X91, 0X90, 0X8F,
-  0X8E, 0X8C, 0X8A, 0X87, 0X84, 0X80, 0X7B, 0X74, 0X6B, 0X5C, 0X42, 0X0D,
-  0X2F, 0X3A, 0X45, 0X4F, 0X58, 0X60, 0X67, 0X6D, 0X73, 0X78, 0X7C, 0X80,
-  0X82, 0X86, 0X88, 0X8A, 0X8C, 0X8E, 0X8F, 0X91, 0X91, 0X92, 0X93, 0X94,
-  0X95, 0X96, 0X97, 0X97, 0X98, 0X98, 0X99, 0X9A, 0X9A, 0X9B, 0X9B, 0X9C,
-  0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9F,
-  0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9B, 0X9B, 0X9B,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X98,
-  0X98, 0X98, 0X97, 0X97, 0X96, 0X95, 0X94, 0X93, 0X92, 0X91, 0X8F, 0X8D,
-  0X8A, 0X86, 0X82, 0X7C, 0X74, 0X67, 0X51, 0X1A, 0X35, 0X40, 0X4B, 0X55,
-  0X5E, 0X65, 0X6C, 0X72, 0X78, 0X7D, 0X80, 0X83, 0X87, 0X8A, 0X8C, 0X8E,
-  0X90, 0X91, 0X92, 0X94, 0X95, 0X96, 0X97, 0X98, 0X98, 0X99, 0X9A, 0X9A,
-  0X9B, 0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F,
-  0XA0, 0XA0, 0XA0, 0XA1, 0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA1, 0XA1,
-  0XA1, 0XA1, 0XA1, 0XA1, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9B, 0X9B, 0X9B,
-  0X9A, 0X99, 0X99, 0X98, 0X97, 0X95, 0X94, 0X92, 0X90, 0X8D, 0X89, 0X83,
-  0X7D, 0X72, 0X5E, 0X2B, 0X3C, 0X47, 0X52, 0X5A, 0X63, 0X6A, 0X71, 0X77,
-  0X7D, 0X81, 0X84, 0X88, 0X8B, 0X8E, 0X90, 0X92, 0X93, 0X95, 0X96, 0X98,
-  0X99, 0X9A, 0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F,
-  0XA0, 0XA0, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4,
-  0XA4, 0XA4, 0XA4, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA6, 0XA6, 0XA6, 0XA6, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA1, 0XA1, 0XA1,
-  0XA1, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D, 0X9D, 0X9C,
-  0X9B, 0X9A, 0X99, 0X97, 0X95, 0X93, 0X8F, 0X8B, 0X85, 0X7C, 0X6C, 0X40,
-  0X42, 0X4D, 0X58, 0X60, 0X68, 0X6F, 0X76, 0X7C, 0X81, 0X85, 0X89, 0X8C,
-  0X8F, 0X92, 0X93, 0X96, 0X97, 0X99, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E, 0X9E,
-  0X9F, 0X9F, 0XA0, 0XA1, 0XA1, 0XA2, 0XA2, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4,
-  0XA5, 0XA5, 0XA5, 0XA6, 0XA6, 0XA6, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7,
-  0XA7, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA7, 0XA7, 0XA7,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA1, 0XA1, 0XA1, 0XA0, 0X9F, 0X9E, 0X9D, 0X9C,
-  0X9B, 0X99, 0X96, 0X92, 0X8D, 0X85, 0X78, 0X55, 0X49, 0X54, 0X5D, 0X65,
-  0X6D, 0X74, 0X7B, 0X80, 0X85, 0X8A, 0X8D, 0X91, 0X93, 0X96, 0X98, 0X9A,
-  0X9B, 0X9D, 0X9E, 0X9F, 0XA0, 0XA0, 0XA1, 0XA2, 0XA3, 0XA3, 0XA4, 0XA5,
-  0XA5, 0XA6, 0XA6, 0XA6, 0XA7, 0XA7, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8, 0XA8,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA,
-  0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA,
-  0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA5, 0XA5, 0XA5, 0XA4, 0XA3, 0XA2, 0XA1, 0XA0, 0X9E, 0X9C, 0X9A,
-  0X95, 0X8F, 0X84, 0X69, 0X4F, 0X5A, 0X63, 0X6B, 0X73, 0X7A, 0X80, 0X85,
-  0X8A, 0X8E, 0X91, 0X94, 0X97, 0X9A, 0X9C, 0X9D, 0X9F, 0XA0, 0XA1, 0XA2,
-  0XA3, 0XA4, 0XA5, 0XA6, 0XA6, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XAA, 0XAA, 0XAA, 0XAB, 0XAB, 0XAB, 0XAB, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAB, 0XAB,
-  0XAB, 0XAB, 0XAB, 0XAB, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8,
-  0XA8, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA8,
-  0XA8, 0XA8, 0XA7, 0XA7, 0XA6, 0XA4, 0XA2, 0XA0, 0X9D, 0X98, 0X8F, 0X7A,
-  0X55, 0X5F, 0X68, 0X70, 0X78, 0X7E, 0X84, 0X89, 0X8E, 0X92, 0X95, 0X99,
-  0X9B, 0X9D, 0X9F, 0XA1, 0XA2, 0XA4, 0XA5, 0XA6, 0XA7, 0XA7, 0XA8, 0XA8,
-  0XA9, 0XA9, 0XAA, 0XAA, 0XAB, 0XAB, 0XAB, 0XAC, 0XAC, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAE, 0XAE, 0XAE, 0XAE, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAD, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAD, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAB,
-  0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAB, 0XAB,
-  0XAA, 0XA9, 0XA8, 0XA6, 0XA4, 0XA0, 0X99, 0X89, 0X5B, 0X65, 0X6E, 0X76,
-  0X7D, 0X83, 0X89, 0X8E, 0X92, 0X96, 0X9A, 0X9D, 0X9F, 0XA1, 0XA3, 0XA5,
-  0XA7, 0XA8, 0XA8, 0XA9, 0XAA, 0XAB, 0XAC, 0XAC, 0XAD, 0XAD, 0XAE, 0XAE,
-  0XAF, 0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB1, 0XB1, 0XB1, 0XB1, 0XB0, 0XB0, 0XB0, 0XAF, 0XAF, 0XAE, 0XAD,
-  0XAB, 0XA9, 0XA4, 0X99, 0X61, 0X6C, 0X74, 0X7C, 0X82, 0X88, 0X8E, 0X92,
-  0X97, 0X9B, 0X9E, 0XA1, 0XA3, 0XA6, 0XA7, 0XA9, 0XAA, 0XAB, 0XAC, 0XAD,
-  0XAE, 0XAE, 0XAF, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3,
-  0XB3, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB3, 0XB2, 0XB1, 0XAE, 0XA8,
-  0X67, 0X72, 0X7A, 0X81, 0X87, 0X8D, 0X93, 0X97, 0X9C, 0X9F, 0XA2, 0XA5,
-  0XA7, 0XA9, 0XAB, 0XAD, 0XAE, 0XAF, 0XB0, 0XB1, 0XB1, 0XB2, 0XB2, 0XB3,
-  0XB3, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB8, 0XB8, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6,
-  0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XBA, 0XBA, 0XBA, 0XB9, 0XBA, 0XB9, 0XB8, 0XB5, 0X6D, 0X78, 0X80, 0X87,
-  0X8D, 0X92, 0X98, 0X9C, 0XA0, 0XA4, 0XA7, 0XA9, 0XAB, 0XAD, 0XAF, 0XB1,
-  0XB1, 0XB2, 0XB3, 0XB4, 0XB5, 0XB5, 0XB6, 0XB6, 0XB7, 0XB7, 0XB8, 0XB8,
-  0XB8, 0XB8, 0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XB9,
-  0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB8, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XBA,
-  0XBB, 0XBB, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE, 0XBE, 0XBF, 0XBF, 0XBF, 0XC0,
-  0XC0, 0XC1, 0XC1, 0XC2, 0X74, 0X7E, 0X85, 0X8C, 0X92, 0X97, 0X9D, 0XA1,
-  0XA5, 0XA8, 0XAB, 0XAE, 0XB0, 0XB1, 0XB3, 0XB4, 0XB5, 0XB7, 0XB7, 0XB8,
-  0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XBA, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBB,
-  0XBB, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE, 0XBE, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0,
-  0XC1, 0XC1, 0XC2, 0XC3, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC9, 0XCB, 0XCF,
-  0X7A, 0X84, 0X8C, 0X92, 0X98, 0X9C, 0XA2, 0XA6, 0XA9, 0XAD, 0XAF, 0XB1,
-  0XB3, 0XB6, 0XB7, 0XB8, 0XB9, 0XBA, 0XBA, 0XBB, 0XBC, 0XBC, 0XBD, 0XBD,
-  0XBD, 0XBE, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF, 0XC0,
-  0XC0, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC7,
-  0XC8, 0XC9, 0XCA, 0XCC, 0XCD, 0XD0, 0XD3, 0XDB, 0X7F, 0X8A, 0X91, 0X97,
-  0X9D, 0XA2, 0XA7, 0XAA, 0XAE, 0XB1, 0XB3, 0XB6, 0XB8, 0XB9, 0XBB, 0XBC,
-  0XBD, 0XBE, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC1, 0XC1,
-  0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC4, 0XC4, 0XC5, 0XC5,
-  0XC6, 0XC7, 0XC7, 0XC8, 0XC9, 0XCA, 0XCA, 0XCB, 0XCD, 0XCE, 0XD0, 0XD1,
-  0XD4, 0XD7, 0XDC, 0XE6, 0X86, 0X90, 0X97, 0X9D, 0XA3, 0XA7, 0XAB, 0XAF,
-  0XB2, 0XB6, 0XB8, 0XBA, 0XBC, 0XBE, 0XBF, 0XC0, 0XC1, 0XC1, 0XC2, 0XC2,
-  0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3,
-  0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC4,
-  0XC4, 0XC5, 0XC6, 0XC6, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC,
-  0XCD, 0XCE, 0XCF, 0XD0, 0XD1, 0XD3, 0XD4, 0XD7, 0XDA, 0XDE, 0XE4, 0XF0,
-  0X8B, 0X96, 0X9D, 0XA3, 0XA8, 0XAC, 0XB0, 0XB4, 0XB7, 0XBA, 0XBC, 0XBE,
-  0XC0, 0XC1, 0XC2, 0XC4, 0XC5, 0XC5, 0XC6, 0XC6, 0XC7, 0XC7, 0XC7, 0XC8,
-  0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6,
-  0XC6, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC6, 0XC6, 0XC6, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XC9,
-  0XCA, 0XCB, 0XCB, 0XCC, 0XCD, 0XCE, 0XCF, 0XCF, 0XD1, 0XD2, 0XD3, 0XD4,
-  0XD6, 0XD7, 0XDA, 0XDC, 0XE0, 0XE5, 0XEC, 0XF9, 0X92, 0X9C, 0XA3, 0XA8,
-  0XAD, 0XB1, 0XB6, 0XB9, 0XBC, 0XBF, 0XC0, 0XC2, 0XC4, 0XC6, 0XC7, 0XC7,
-  0XC8, 0XC9, 0XC9, 0XC9, 0XCA, 0XCA, 0XCA, 0XCA, 0XCB, 0XCB, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9,
-  0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC9, 0XC9, 0XC9, 0XCA, 0XCA, 0XCB, 0XCC, 0XCC, 0XCD, 0XCE, 0XCF, 0XCF,
-  0XD0, 0XD1, 0XD2, 0XD3, 0XD4, 0XD5, 0XD7, 0XD9, 0XDA, 0XDC, 0XDF, 0XE2,
-  0XE6, 0XEB, 0XF4, 0XFE, 0X97, 0XA2, 0XA9, 0XAE, 0XB2, 0XB6, 0XBA, 0XBD,
-  0XC0, 0XC2, 0XC4, 0XC7, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCC, 0XCD, 0XCD,
-  0XCD, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCC, 0XCC,
-  0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCD,
-  0XCD, 0XCE, 0XCF, 0XCF, 0XD0, 0XD0, 0XD1, 0XD2, 0XD4, 0XD4, 0XD5, 0XD6,
-  0XD8, 0XD9, 0XDA, 0XDC, 0XDE, 0XE1, 0XE3, 0XE7, 0XEB, 0XF1, 0XFB, 0XFF,
-  0X9E, 0XA8, 0XAE, 0XB3, 0XB7, 0XBB, 0XBF, 0XC2, 0XC5, 0XC7, 0XC9, 0XCA,
-  0XCC, 0XCD, 0XCE, 0XCF, 0XCF, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC,
-  0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF, 0XCF, 0XD0, 0XD0, 0XD1, 0XD2, 0XD3,
-  0XD4, 0XD4, 0XD5, 0XD6, 0XD7, 0XD8, 0XD9, 0XDA, 0XDC, 0XDD, 0XDF, 0XE1,
-  0XE3, 0XE5, 0XE8, 0XEC, 0XF1, 0XF8, 0XFF, 0XFF, 0XA4, 0XAE, 0XB5, 0XB9,
-  0XBD, 0XC1, 0XC4, 0XC7, 0XC9, 0XCC, 0XCD, 0XCF, 0XD0, 0XD1, 0XD2, 0XD3,
-  0XD3, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4,
-  0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2,
-  0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XD0, 0XD0, 0XD0, 0XD1,
-  0XD1, 0XD2, 0XD2, 0XD3, 0XD3, 0XD4, 0XD5, 0XD5, 0XD6, 0XD7, 0XD8, 0XD9,
-  0XDA, 0XDB, 0XDC, 0XDE, 0XE0, 0XE1, 0XE2, 0XE5, 0XE7, 0XEA, 0XED, 0XF1,
-  0XF7, 0XFD, 0XFF, 0XFF, 0XAB, 0XB4, 0XBB, 0XBF, 0XC2, 0XC6, 0XC9, 0XCB,
-  0XCE, 0XD0, 0XD1, 0XD3, 0XD4, 0XD5, 0XD6, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7,
-  0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2,
-  0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD2,
-  0XD2, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD4, 0XD4, 0XD5, 0XD5, 0XD6,
-  0XD6, 0XD7, 0XD8, 0XD9, 0XDA, 0XDB, 0XDB, 0XDC, 0XDE, 0XDF, 0XE0, 0XE1,
-  0XE3, 0XE5, 0XE7, 0XE9, 0XEB, 0XEF, 0XF2, 0XF6, 0XFC, 0XFF, 0XFF, 0XFF,
-  0XB1, 0XBB, 0XC1, 0XC4, 0XC8, 0XCB, 0XCE, 0XD0, 0XD3, 0XD4, 0XD6, 0XD7,
-  0XD8, 0XD9, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA,
-  0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD8, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4,
-  0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD5, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD6, 0XD6, 0XD7, 0XD7, 0XD8, 0XD9, 0XD9, 0XDA, 0XDB, 0XDB,
-  0XDC, 0XDD, 0XDF, 0XE0, 0XE1, 0XE2, 0XE4, 0XE5, 0XE7, 0XE8, 0XEB, 0XED,
-  0XF0, 0XF3, 0XF6, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XB8, 0XC1, 0XC6, 0XCA,
-  0XCD, 0XD0, 0XD3, 0XD5, 0XD7, 0XD9, 0XDA, 0XDC, 0XDD, 0XDD, 0XDE, 0XDE,
-  0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDC,
-  0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA, 0XDA,
-  0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD8, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XD9, 0XDA,
-  0XDA, 0XDA, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1, 0XE2, 0XE3,
-  0XE4, 0XE6, 0XE7, 0XE8, 0XEB, 0XED, 0XEE, 0XF1, 0XF4, 0XF7, 0XFB, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XBF, 0XC7, 0XCD, 0XD0, 0XD3, 0XD6, 0XD8, 0XDA,
-  0XDC, 0XDE, 0XDF, 0XE0, 0XE0, 0XE1, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2,
-  0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0,
-  0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE,
-  0XDE, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9,
-  0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XDA, 0XDA,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE, 0XDE,
-  0XDF, 0XE0, 0XE1, 0XE2, 0XE2, 0XE4, 0XE5, 0XE6, 0XE7, 0XE9, 0XEB, 0XEC,
-  0XEE, 0XF0, 0XF2, 0XF5, 0XF8, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XC6, 0XCE, 0XD3, 0XD6, 0XD9, 0XDB, 0XDD, 0XDF, 0XE1, 0XE2, 0XE3, 0XE4,
-  0XE5, 0XE5, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6,
-  0XE6, 0XE5, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDD,
-  0XDD, 0XDD, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC,
-  0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDD, 0XDD,
-  0XDD, 0XDE, 0XDE, 0XDF, 0XE0, 0XE0, 0XE1, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5,
-  0XE6, 0XE7, 0XE8, 0XE9, 0XEB, 0XED, 0XEE, 0XF0, 0XF2, 0XF4, 0XF6, 0XF9,
-  0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XCE, 0XD5, 0XD9, 0XDC,
-  0XDF, 0XE0, 0XE2, 0XE4, 0XE6, 0XE6, 0XE7, 0XE8, 0XE9, 0XE9, 0XEA, 0XEA,
-  0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8,
-  0XE7, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5,
-  0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1,
-  0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0,
-  0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDE, 0XDE, 0XDF, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE0, 0XE1, 0XE1, 0XE1,
-  0XE2, 0XE3, 0XE3, 0XE4, 0XE5, 0XE6, 0XE7, 0XE8, 0XE9, 0XEA, 0XEC, 0XED,
-  0XEE, 0XF0, 0XF1, 0XF3, 0XF5, 0XF7, 0XFA, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XD5, 0XDB, 0XDF, 0XE1, 0XE3, 0XE6, 0XE7, 0XE9,
-  0XEA, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED,
-  0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XE9,
-  0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6,
-  0XE6, 0XE6, 0XE5, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1,
-  0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE1, 0XE1, 0XE1, 0XE1,
-  0XE1, 0XE1, 0XE2, 0XE2, 0XE2, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE6, 0XE7,
-  0XE7, 0XE8, 0XE9, 0XEB, 0XEC, 0XED, 0XEE, 0XEF, 0XF1, 0XF2, 0XF4, 0XF6,
-  0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XDD, 0XE2, 0XE5, 0XE7, 0XE9, 0XEB, 0XED, 0XEE, 0XEF, 0XEF, 0XF0, 0XF1,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0,
-  0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC,
-  0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8,
-  0XE7, 0XE7, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5,
-  0XE5, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2,
-  0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5,
-  0XE6, 0XE6, 0XE6, 0XE7, 0XE8, 0XE8, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XEE,
-  0XEF, 0XF0, 0XF2, 0XF3, 0XF4, 0XF6, 0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XE5, 0XE9, 0XEC, 0XEE,
-  0XEF, 0XF0, 0XF2, 0XF3, 0XF4, 0XF4, 0XF5, 0XF5, 0XF5, 0XF6, 0XF6, 0XF5,
-  0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF1,
-  0XF1, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED,
-  0XED, 0XEC, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9,
-  0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE7, 0XE7, 0XE7,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5,
-  0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE6, 0XE6, 0XE6,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE9, 0XEA,
-  0XEA, 0XEB, 0XEC, 0XED, 0XED, 0XEE, 0XEF, 0XF1, 0XF2, 0XF3, 0XF4, 0XF6,
-  0XF7, 0XF9, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XEE, 0XF0, 0XF2, 0XF4, 0XF5, 0XF6, 0XF7, 0XF8,
-  0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8,
-  0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF4, 0XF3, 0XF3,
-  0XF3, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE,
-  0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB,
-  0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8,
-  0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE8, 0XE9, 0XE9,
-  0XE9, 0XEA, 0XEA, 0XEB, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEF, 0XF0,
-  0XF1, 0XF2, 0XF3, 0XF3, 0XF5, 0XF6, 0XF8, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF7, 0XF8, 0XF9, 0XF9, 0XFB, 0XFB, 0XFC, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE,
-  0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA,
-  0XF9, 0XF8, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4,
-  0XF4, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF1, 0XF0, 0XF0,
-  0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XED, 0XED, 0XEC,
-  0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB,
-  0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA,
-  0XEA, 0XEA, 0XEB, 0XEB, 0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XEC, 0XED, 0XED,
-  0XED, 0XEE, 0XEE, 0XEF, 0XF0, 0XF1, 0XF1, 0XF2, 0XF3, 0XF4, 0XF6, 0XF6,
-  0XF8, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFC, 0XFC, 0XFB,
-  0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6,
-  0XF5, 0XF5, 0XF4, 0XF4, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2, 0XF1,
-  0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED,
-  0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED, 0XED,
-  0XED, 0XEE, 0XEE, 0XEE, 0XEE, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF2,
-  0XF3, 0XF3, 0XF4, 0XF6, 0XF6, 0XF7, 0XF8, 0XFA, 0XFB, 0XFC, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFD, 0XFC, 0XFC,
-  0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7,
-  0XF6, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF3, 0XF3, 0XF3, 0XF2,
-  0XF2, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0,
-  0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XF0, 0XF0, 0XF0, 0XF0, 0XF1, 0XF1,
-  0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3, 0XF4, 0XF5, 0XF6, 0XF6, 0XF7, 0XF8,
-  0XF9, 0XFA, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFD,
-  0XFD, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8,
-  0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4,
-  0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF2, 0XF2, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF2,
-  0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF3, 0XF3, 0XF3, 0XF3, 0XF4, 0XF5, 0XF5,
-  0XF6, 0XF6, 0XF7, 0XF8, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE,
-  0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9,
-  0XF8, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF6, 0XF6,
-  0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF5, 0XF5,
-  0XF5, 0XF5, 0XF6, 0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF8, 0XF9, 0XF9, 0XFA,
-  0XFB, 0XFC, 0XFC, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFA,
-  0XFA, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7,
-  0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF6, 0XF6, 0XF6, 0XF6,
-  0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF8, 0XF8, 0XF8,
-  0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFC, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFC, 0XFB,
-  0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF9,
-  0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8, 0XF8, 0XF8, 0XF8, 0XF9, 0XF9, 0XF9,
-  0XF9, 0XF9, 0XF9, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFC, 0XFC, 0XFD,
-  0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFC,
-  0XFC, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB,
-  0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFC, 0XFC,
-  0XFC, 0XFC, 0XFD, 0XFD, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE,
-  0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XF4, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XE7,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XD8, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XF3, 0XC8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XE7, 0XBA,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF4, 0XD9, 0XA9, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFB, 0XE9, 0XCC, 0X99, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XF1, 0XDD, 0XBE, 0X88,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XF6, 0XE7, 0XD1, 0XAF, 0X76, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF8, 0XEC,
-  0XDC, 0XC4, 0XA1, 0X64, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFA, 0XEF, 0XE2, 0XD1, 0XB8, 0X92, 0X52,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFA, 0XF1, 0XE6, 0XD8, 0XC6, 0XAB, 0X83, 0X3D, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF9, 0XF2, 0XE9, 0XDD, 0XCE,
-  0XBA, 0X9D, 0X74, 0X2A, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XF9, 0XF3, 0XEA, 0XE1, 0XD4, 0XC5, 0XB0, 0X91, 0X65, 0X1B,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD, 0XFB, 0XFA, 0XF8,
-  0XF8, 0XF8, 0XF9, 0XFA, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF7, 0XF2, 0XEB,
-  0XE2, 0XD8, 0XCB, 0XBA, 0XA4, 0X84, 0X54, 0X0E, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFA, 0XF4, 0XEF, 0XEB, 0XE9, 0XE8, 0XE8, 0XEA, 0XEB, 0XED, 0XF0,
-  0XF2, 0XF4, 0XF7, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFA, 0XF6, 0XF0, 0XEA, 0XE3, 0XDA, 0XCF, 0XC1, 0XAF,
-  0X97, 0X76, 0X43, 0X05, 0XFF, 0XFD, 0XF8, 0XF1, 0XE9, 0XE2, 0XDD, 0XD9,
-  0XD6, 0XD6, 0XD7, 0XD9, 0XDC, 0XDF, 0XE3, 0XE6, 0XE9, 0XEC, 0XEF, 0XF1,
-  0XF4, 0XF6, 0XF8, 0XFA, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XF8, 0XF4,
-  0XEF, 0XE9, 0XE3, 0XDB, 0XD1, 0XC5, 0XB7, 0XA4, 0X8B, 0X67, 0X30, 0X00,
-  0XF2, 0XE6, 0XDD, 0XD5, 0XCE, 0XC8, 0XC4, 0XC2, 0XC2, 0XC4, 0XC7, 0XCB,
-  0XCF, 0XD4, 0XD8, 0XDC, 0XE0, 0XE4, 0XE7, 0XEA, 0XED, 0XEF, 0XF1, 0XF4,
-  0XF6, 0XF8, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFD, 0XF9, 0XF6, 0XF1, 0XED, 0XE7, 0XE1, 0XDB, 0XD2,
-  0XC9, 0XBC, 0XAD, 0X99, 0X7E, 0X58, 0X1C, 0X00, 0XCE, 0XC6, 0XBE, 0XB8,
-  0XB2, 0XAD, 0XAB, 0XAB, 0XAE, 0XB2, 0XB7, 0XBD, 0XC3, 0XC9, 0XCE, 0XD3,
-  0XD7, 0XDB, 0XDF, 0XE3, 0XE6, 0XE8, 0XEB, 0XED, 0XF0, 0XF2, 0XF4, 0XF5,
-  0XF7, 0XF9, 0XFA, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF6,
-  0XF3, 0XEF, 0XEB, 0XE6, 0XE0, 0XDA, 0XD3, 0XCA, 0XC0, 0XB3, 0XA3, 0X8D,
-  0X71, 0X48, 0X0D, 0X00, 0XA7, 0XA3, 0X9E, 0X9A, 0X95, 0X92, 0X92, 0X95,
-  0X9A, 0XA1, 0XA8, 0XB0, 0XB7, 0XBE, 0XC4, 0XCA, 0XCF, 0XD4, 0XD7, 0XDB,
-  0XDF, 0XE2, 0XE5, 0XE7, 0XEA, 0XEC, 0XEE, 0XF0, 0XF2, 0XF3, 0XF5, 0XF7,
-  0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFC, 0XF9, 0XF6, 0XF3, 0XF0, 0XED, 0XE8, 0XE4, 0XDF,
-  0XD9, 0XD2, 0XCB, 0XC2, 0XB7, 0XA9, 0X98, 0X81, 0X64, 0X37, 0X03, 0X00,
-  0X7B, 0X7D, 0X7C, 0X7A, 0X78, 0X77, 0X79, 0X7F, 0X87, 0X91, 0X9A, 0XA3,
-  0XAC, 0XB4, 0XBB, 0XC1, 0XC7, 0XCC, 0XD1, 0XD4, 0XD8, 0XDB, 0XDE, 0XE1,
-  0XE4, 0XE6, 0XE8, 0XEA, 0XEC, 0XEE, 0XF0, 0XF1, 0XF3, 0XF4, 0XF6, 0XF7,
-  0XF8, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFC, 0XFA, 0XF8, 0XF6,
-  0XF3, 0XF0, 0XED, 0XEA, 0XE6, 0XE2, 0XDD, 0XD8, 0XD2, 0XCB, 0XC3, 0XB9,
-  0XAE, 0XA0, 0X8D, 0X76, 0X56, 0X25, 0X00, 0X00, 0X46, 0X53, 0X57, 0X58,
-  0X58, 0X5A, 0X60, 0X69, 0X75, 0X81, 0X8C, 0X98, 0XA1, 0XAA, 0XB2, 0XB9,
-  0XBF, 0XC5, 0XC9, 0XCE, 0XD1, 0XD5, 0XD8, 0XDB, 0XDE, 0XE0, 0XE3, 0XE5,
-  0XE7, 0XE9, 0XEB, 0XEC, 0XEE, 0XEF, 0XF0, 0XF2, 0XF3, 0XF5, 0XF6, 0XF7,
-  0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFD, 0XFC, 0XFA, 0XF8, 0XF6, 0XF4, 0XF2, 0XEF, 0XED, 0XEA, 0XE7, 0XE3,
-  0XDF, 0XDB, 0XD6, 0XD0, 0XCA, 0XC3, 0XBB, 0XB1, 0XA4, 0X95, 0X82, 0X69,
-  0X47, 0X14, 0X00, 0X00, 0X0B, 0X1F, 0X2C, 0X33, 0X36, 0X3B, 0X46, 0X54,
-  0X64, 0X73, 0X80, 0X8D, 0X97, 0XA1, 0XAA, 0XB1, 0XB7, 0XBD, 0XC2, 0XC7,
-  0XCB, 0XCE, 0XD2, 0XD5, 0XD8, 0XDA, 0XDD, 0XDF, 0XE1, 0XE3, 0XE5, 0XE7,
-  0XE9, 0XEA, 0XEC, 0XED, 0XEE, 0XF0, 0XF1, 0XF2, 0XF3, 0XF5, 0XF6, 0XF7,
-  0XF7, 0XF8, 0XF9, 0XFA, 0XFB, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFE, 0XFE, 0XFD, 0XFC, 0XFA, 0XF9, 0XF8, 0XF6, 0XF4, 0XF2,
-  0XF0, 0XEE, 0XEC, 0XE9, 0XE7, 0XE4, 0XE1, 0XDD, 0XD9, 0XD4, 0XCF, 0XCA,
-  0XC3, 0XBB, 0XB3, 0XA8, 0X9B, 0X8B, 0X77, 0X5D, 0X37, 0X08, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X08, 0X0E, 0X18, 0X2B, 0X3F, 0X53, 0X65, 0X74, 0X82,
-  0X8E, 0X98, 0XA1, 0XA9, 0XB0, 0XB6, 0XBB, 0XC0, 0XC4, 0XC8, 0XCC, 0XCF,
-  0XD2, 0XD5, 0XD7, 0XDA, 0XDC, 0XDE, 0XE0, 0XE2, 0XE3, 0XE5, 0XE7, 0XE8,
-  0XEA, 0XEB, 0XEC, 0XED, 0XEF, 0XEF, 0XF1, 0XF2, 0XF3, 0XF4, 0XF4, 0XF5,
-  0XF6, 0XF7, 0XF8, 0XF8, 0XF9, 0XFA, 0XFB, 0XFB, 0XFC, 0XFC, 0XFC, 0XFD,
-  0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFC, 0XFC, 0XFB, 0XFA, 0XF9,
-  0XF7, 0XF6, 0XF5, 0XF4, 0XF2, 0XF0, 0XEE, 0XED, 0XEA, 0XE8, 0XE6, 0XE3,
-  0XE0, 0XDE, 0XDA, 0XD6, 0XD2, 0XCD, 0XC8, 0XC2, 0XBB, 0XB3, 0XAA, 0X9F,
-  0X92, 0X81, 0X6B, 0X4F, 0X26, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X10, 0X2C, 0X44, 0X59, 0X6A, 0X78, 0X85, 0X90, 0X9A, 0XA2,
-  0XA9, 0XAF, 0XB5, 0XBA, 0XBF, 0XC2, 0XC6, 0XCA, 0XCD, 0XCF, 0XD2, 0XD5,
-  0XD7, 0XD9, 0XDB, 0XDD, 0XDF, 0XE0, 0XE2, 0XE4, 0XE5, 0XE7, 0XE8, 0XE9,
-  0XEA, 0XEB, 0XEC, 0XED, 0XEF, 0XEF, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF4,
-  0XF5, 0XF6, 0XF7, 0XF7, 0XF8, 0XF8, 0XF8, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB,
-  0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFA,
-  0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF6, 0XF5, 0XF4, 0XF3, 0XF1, 0XF0, 0XEE,
-  0XED, 0XEB, 0XE9, 0XE7, 0XE5, 0XE3, 0XE0, 0XDE, 0XDB, 0XD8, 0XD4, 0XD0,
-  0XCC, 0XC7, 0XC2, 0XBB, 0XB4, 0XAC, 0XA3, 0X97, 0X88, 0X77, 0X61, 0X42,
-  0X16, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X16,
-  0X35, 0X4D, 0X5F, 0X6F, 0X7C, 0X88, 0X92, 0X9A, 0XA2, 0XA8, 0XAE, 0XB4,
-  0XB8, 0XBC, 0XC0, 0XC3, 0XC7, 0XCA, 0XCC, 0XCF, 0XD1, 0XD4, 0XD6, 0XD8,
-  0XDA, 0XDB, 0XDD, 0XDF, 0XE0, 0XE2, 0XE3, 0XE5, 0XE5, 0XE7, 0XE8, 0XE9,
-  0XEA, 0XEB, 0XEC, 0XED, 0XEE, 0XEE, 0XEF, 0XF0, 0XF1, 0XF2, 0XF2, 0XF2,
-  0XF3, 0XF4, 0XF4, 0XF5, 0XF5, 0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF8, 0XF8, 0XF8, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8, 0XF8,
-  0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF3, 0XF2,
-  0XF1, 0XF0, 0XEF, 0XEE, 0XED, 0XEC, 0XEA, 0XE9, 0XE7, 0XE5, 0XE3, 0XE1,
-  0XDF, 0XDD, 0XDA, 0XD7, 0XD5, 0XD1, 0XCE, 0XCA, 0XC5, 0XC0, 0XBB, 0XB4,
-  0XAD, 0XA4, 0X9A, 0X8E, 0X7F, 0X6D, 0X54, 0X34, 0X08, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X25, 0X41, 0X54, 0X65,
-  0X74, 0X80, 0X8A, 0X93, 0X9A, 0XA1, 0XA8, 0XAD, 0XB2, 0XB6, 0XBA, 0XBE,
-  0XC1, 0XC4, 0XC7, 0XCA, 0XCC, 0XCE, 0XD1, 0XD3, 0XD4, 0XD6, 0XD8, 0XD9,
-  0XDB, 0XDD, 0XDE, 0XDF, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE6, 0XE7, 0XE8,
-  0XE9, 0XEA, 0XEB, 0XEB, 0XEC, 0XED, 0XED, 0XEE, 0XEF, 0XEF, 0XEF, 0XF0,
-  0XF0, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3, 0XF3, 0XF3, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2,
-  0XF2, 0XF1, 0XF1, 0XF0, 0XEF, 0XEF, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE9,
-  0XE8, 0XE6, 0XE5, 0XE3, 0XE1, 0XE0, 0XDD, 0XDB, 0XD9, 0XD7, 0XD4, 0XD1,
-  0XCE, 0XCB, 0XC7, 0XC3, 0XBF, 0XB9, 0XB3, 0XAD, 0XA4, 0X9B, 0X91, 0X84,
-  0X75, 0X61, 0X47, 0X23, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X16, 0X35, 0X4A, 0X5C, 0X6B, 0X78, 0X82, 0X8C,
-  0X94, 0X9B, 0XA1, 0XA7, 0XAB, 0XB0, 0XB4, 0XB7, 0XBB, 0XBE, 0XC1, 0XC4,
-  0XC7, 0XC9, 0XCB, 0XCD, 0XCF, 0XD1, 0XD3, 0XD5, 0XD6, 0XD8, 0XD9, 0XDB,
-  0XDC, 0XDD, 0XDE, 0XE0, 0XE0, 0XE1, 0XE3, 0XE4, 0XE5, 0XE5, 0XE6, 0XE7,
-  0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEA, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XEE,
-  0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC, 0XEB,
-  0XEA, 0XEA, 0XE9, 0XE8, 0XE7, 0XE6, 0XE5, 0XE3, 0XE2, 0XE1, 0XDF, 0XDD,
-  0XDC, 0XDA, 0XD8, 0XD5, 0XD3, 0XD1, 0XCE, 0XCB, 0XC8, 0XC5, 0XC1, 0XBC,
-  0XB8, 0XB2, 0XAC, 0XA5, 0X9D, 0X93, 0X88, 0X7B, 0X6B, 0X55, 0X3A, 0X13,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0A, 0X2A, 0X40, 0X53, 0X63, 0X70, 0X7B, 0X84, 0X8C, 0X94, 0X9A, 0XA0,
-  0XA5, 0XA9, 0XAE, 0XB2, 0XB5, 0XB8, 0XBC, 0XBE, 0XC1, 0XC3, 0XC6, 0XC8,
-  0XCA, 0XCC, 0XCE, 0XCF, 0XD1, 0XD3, 0XD4, 0XD6, 0XD7, 0XD8, 0XD9, 0XDA,
-  0XDC, 0XDD, 0XDD, 0XDE, 0XE0, 0XE1, 0XE2, 0XE2, 0XE3, 0XE3, 0XE4, 0XE5,
-  0XE6, 0XE6, 0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA,
-  0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA,
-  0XE9, 0XE9, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE2,
-  0XE1, 0XE0, 0XDF, 0XDE, 0XDC, 0XDB, 0XD9, 0XD8, 0XD6, 0XD4, 0XD2, 0XD0,
-  0XCD, 0XCB, 0XC7, 0XC5, 0XC1, 0XBE, 0XBA, 0XB6, 0XB1, 0XAB, 0XA4, 0X9D,
-  0X95, 0X8A, 0X7F, 0X71, 0X60, 0X49, 0X2B, 0X06, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X1F, 0X37, 0X4A,
-  0X5B, 0X68, 0X74, 0X7D, 0X86, 0X8D, 0X94, 0X9A, 0X9F, 0XA3, 0XA7, 0XAC,
-  0XAF, 0XB3, 0XB6, 0XB9, 0XBC, 0XBE, 0XC1, 0XC3, 0XC5, 0XC7, 0XC9, 0XCB,
-  0XCC, 0XCE, 0XCF, 0XD1, 0XD2, 0XD4, 0XD5, 0XD6, 0XD7, 0XD8, 0XD9, 0XDA,
-  0XDB, 0XDB, 0XDD, 0XDD, 0XDE, 0XDF, 0XE0, 0XE0, 0XE0, 0XE1, 0XE2, 0XE2,
-  0XE3, 0XE3, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5,
-  0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3,
-  0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF, 0XDE, 0XDD, 0XDC, 0XDB, 0XDA, 0XD8,
-  0XD7, 0XD5, 0XD4, 0XD2, 0XD0, 0XCE, 0XCC, 0XC9, 0XC7, 0XC4, 0XC1, 0XBE,
-  0XBB, 0XB7, 0XB3, 0XAF, 0XAA, 0XA4, 0X9D, 0X95, 0X8C, 0X82, 0X76, 0X68,
-  0X55, 0X3D, 0X1B, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X2D, 0X42, 0X53, 0X61, 0X6C, 0X76,
-  0X7E, 0X86, 0X8D, 0X93, 0X98, 0X9D, 0XA2, 0XA6, 0XAA, 0XAD, 0XB0, 0XB3,
-  0XB6, 0XB9, 0XBB, 0XBD, 0XBF, 0XC2, 0XC3, 0XC5, 0XC7, 0XC9, 0XCA, 0XCC,
-  0XCD, 0XCE, 0XD0, 0XD1, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD7, 0XD8, 0XD8,
-  0XD9, 0XDA, 0XDB, 0XDC, 0XDC, 0XDD, 0XDD, 0XDD, 0XDE, 0XDE, 0XDF, 0XDF,
-  0XDF, 0XE0, 0XE0, 0XE0, 0XE0, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1,
-  0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDE, 0XDE, 0XDD, 0XDD, 0XDC, 0XDB,
-  0XDB, 0XDA, 0XD9, 0XD8, 0XD7, 0XD5, 0XD4, 0XD2, 0XD1, 0XD0, 0XCE, 0XCC,
-  0XCA, 0XC8, 0XC6, 0XC3, 0XC0, 0XBE, 0XBB, 0XB8, 0XB4, 0XB1, 0XAC, 0XA8,
-  0XA2, 0X9C, 0X95, 0X8D, 0X84, 0X79, 0X6D, 0X5D, 0X49, 0X2F, 0X0B, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X08, 0X23, 0X3A, 0X4B, 0X59, 0X65, 0X6F, 0X78, 0X80, 0X87, 0X8D,
-  0X92, 0X97, 0X9C, 0XA0, 0XA4, 0XA7, 0XAA, 0XAE, 0XB1, 0XB3, 0XB6, 0XB8,
-  0XBA, 0XBC, 0XBE, 0XC0, 0XC2, 0XC4, 0XC5, 0XC7, 0XC8, 0XCA, 0XCB, 0XCC,
-  0XCD, 0XCE, 0XD0, 0XD1, 0XD1, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD6, 0XD6,
-  0XD7, 0XD8, 0XD8, 0XD9, 0XDA, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDA, 0XDA, 0XD9, 0XD9, 0XD8, 0XD7, 0XD7, 0XD6, 0XD5, 0XD4, 0XD3, 0XD2,
-  0XD1, 0XD0, 0XCF, 0XCD, 0XCC, 0XCA, 0XC8, 0XC6, 0XC4, 0XC2, 0XC0, 0XBD,
-  0XBA, 0XB8, 0XB4, 0XB2, 0XAE, 0XAA, 0XA6, 0XA1, 0X9B, 0X95, 0X8D, 0X85,
-  0X7B, 0X70, 0X63, 0X52, 0X3D, 0X21, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X19, 0X30,
-  0X43, 0X51, 0X5D, 0X68, 0X71, 0X79, 0X7F, 0X86, 0X8C, 0X90, 0X96, 0X9A,
-  0X9E, 0XA2, 0XA5, 0XA8, 0XAB, 0XAE, 0XB0, 0XB3, 0XB5, 0XB7, 0XB9, 0XBB,
-  0XBD, 0XBF, 0XC0, 0XC2, 0XC3, 0XC5, 0XC6, 0XC7, 0XC9, 0XC9, 0XCB, 0XCC,
-  0XCD, 0XCE, 0XCE, 0XCF, 0XD0, 0XD1, 0XD1, 0XD2, 0XD3, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7,
-  0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD4, 0XD3,
-  0XD3, 0XD2, 0XD2, 0XD1, 0XD0, 0XCF, 0XCE, 0XCD, 0XCC, 0XCA, 0XC9, 0XC7,
-  0XC6, 0XC4, 0XC2, 0XC0, 0XBE, 0XBC, 0XB9, 0XB7, 0XB4, 0XB1, 0XAE, 0XAB,
-  0XA7, 0XA3, 0X9F, 0X99, 0X94, 0X8D, 0X86, 0X7D, 0X73, 0X66, 0X59, 0X47,
-  0X30, 0X11, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0E, 0X28, 0X3A, 0X49, 0X56, 0X61,
-  0X6A, 0X72, 0X79, 0X80, 0X86, 0X8B, 0X8F, 0X94, 0X98, 0X9C, 0X9F, 0XA2,
-  0XA5, 0XA8, 0XAB, 0XAD, 0XB0, 0XB2, 0XB4, 0XB6, 0XB8, 0XB9, 0XBB, 0XBD,
-  0XBE, 0XC0, 0XC1, 0XC2, 0XC4, 0XC5, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XCB,
-  0XCC, 0XCC, 0XCC, 0XCD, 0XCE, 0XCF, 0XCF, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCD, 0XCC, 0XCC,
-  0XCB, 0XCA, 0XC9, 0XC7, 0XC6, 0XC5, 0XC3, 0XC2, 0XC0, 0XBE, 0XBC, 0XBA,
-  0XB8, 0XB6, 0XB3, 0XB1, 0XAE, 0XAB, 0XA7, 0XA4, 0XA1, 0X9C, 0X98, 0X93,
-  0X8C, 0X86, 0X7E, 0X75, 0X6A, 0X5D, 0X4F, 0X3C, 0X23, 0X05, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X05, 0X1F, 0X32, 0X41, 0X4E, 0X59, 0X63, 0X6B, 0X73, 0X7A,
-  0X7F, 0X84, 0X89, 0X8E, 0X92, 0X96, 0X99, 0X9D, 0XA0, 0XA3, 0XA6, 0XA8,
-  0XAA, 0XAC, 0XAF, 0XB1, 0XB2, 0XB5, 0XB6, 0XB8, 0XB9, 0XBB, 0XBC, 0XBD,
-  0XBF, 0XC0, 0XC1, 0XC2, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC7, 0XC8, 0XC9,
-  0XC9, 0XC9, 0XCA, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCC, 0XCC, 0XCB,
-  0XCB, 0XCA, 0XCA, 0XC9, 0XC9, 0XC8, 0XC7, 0XC6, 0XC5, 0XC4, 0XC3, 0XC2,
-  0XC0, 0XBF, 0XBE, 0XBC, 0XBA, 0XB8, 0XB6, 0XB4, 0XB2, 0XB0, 0XAD, 0XAA,
-  0XA7, 0XA4, 0XA1, 0X9D, 0X99, 0X96, 0X91, 0X8B, 0X85, 0X7E, 0X76, 0X6C,
-  0X61, 0X53, 0X44, 0X30, 0X14, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X16,
-  0X2B, 0X3B, 0X47, 0X53, 0X5D, 0X65, 0X6D, 0X73, 0X7A, 0X7E, 0X84, 0X88,
-  0X8D, 0X90, 0X94, 0X97, 0X9B, 0X9E, 0XA0, 0XA3, 0XA5, 0XA8, 0XAA, 0XAC,
-  0XAE, 0XB0, 0XB1, 0XB3, 0XB5, 0XB6, 0XB7, 0XB9, 0XBA, 0XBC, 0XBD, 0XBD,
-  0XBE, 0XBF, 0XC1, 0XC1, 0XC2, 0XC3, 0XC3, 0XC4, 0XC5, 0XC5, 0XC6, 0XC6,
-  0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9,
-  0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC7, 0XC7, 0XC6, 0XC6, 0XC5, 0XC4,
-  0XC4, 0XC3, 0XC2, 0XC1, 0XC0, 0XBF, 0XBE, 0XBD, 0XBB, 0XBA, 0XB8, 0XB6,
-  0XB5, 0XB3, 0XB1, 0XAF, 0XAC, 0XAA, 0XA7, 0XA4, 0XA2, 0X9E, 0X9A, 0X97,
-  0X93, 0X8F, 0X8A, 0X84, 0X7E, 0X77, 0X6E, 0X64, 0X58, 0X4A, 0X3A, 0X24,
-  0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X22, 0X33, 0X40, 0X4C,
-  0X55, 0X5F, 0X66, 0X6D, 0X73, 0X78, 0X7D, 0X82, 0X87, 0X8A, 0X8E, 0X92,
-  0X95, 0X98, 0X9B, 0X9E, 0XA0, 0XA2, 0XA4, 0XA6, 0XA9, 0XAB, 0XAC, 0XAE,
-  0XB0, 0XB1, 0XB3, 0XB4, 0XB5, 0XB6, 0XB8, 0XB9, 0XB9, 0XBA, 0XBB, 0XBC,
-  0XBD, 0XBE, 0XBF, 0XC0, 0XC0, 0XC0, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3,
-  0XC3, 0XC2, 0XC2, 0XC2, 0XC1, 0XC0, 0XC0, 0XBF, 0XBE, 0XBE, 0XBD, 0XBC,
-  0XBB, 0XB9, 0XB8, 0XB7, 0XB6, 0XB4, 0XB2, 0XB1, 0XAF, 0XAD, 0XAB, 0XA9,
-  0XA6, 0XA4, 0XA1, 0X9E, 0X9B, 0X98, 0X94, 0X91, 0X8C, 0X88, 0X83, 0X7D,
-  0X77, 0X6F, 0X66, 0X5B, 0X4F, 0X3F, 0X2E, 0X15, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X19, 0X2B, 0X38, 0X44, 0X4E, 0X57, 0X5F, 0X66,
-  0X6D, 0X72, 0X78, 0X7C, 0X80, 0X85, 0X89, 0X8C, 0X8F, 0X92, 0X96, 0X98,
-  0X9A, 0X9D, 0X9F, 0XA1, 0XA3, 0XA5, 0XA7, 0XA9, 0XAA, 0XAC, 0XAE, 0XAF,
-  0XB0, 0XB1, 0XB3, 0XB4, 0XB5, 0XB6, 0XB6, 0XB7, 0XB8, 0XB9, 0XBA, 0XBB,
-  0XBB, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBE, 0XBE, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE, 0XBE, 0XBE, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBC, 0XBB, 0XBB, 0XBA, 0XB9, 0XB8, 0XB7, 0XB6, 0XB5, 0XB4, 0XB3, 0XB1,
-  0XB0, 0XAE, 0XAD, 0XAB, 0XA9, 0XA7, 0XA5, 0XA3, 0XA0, 0X9E, 0X9A, 0X98,
-  0X94, 0X91, 0X8D, 0X89, 0X85, 0X81, 0X7B, 0X76, 0X6F, 0X67, 0X5D, 0X52,
-  0X45, 0X34, 0X22, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0F, 0X22, 0X31, 0X3D, 0X47, 0X50, 0X58, 0X60, 0X66, 0X6C, 0X71, 0X76,
-  0X7A, 0X7E, 0X82, 0X86, 0X8A, 0X8D, 0X90, 0X92, 0X95, 0X97, 0X99, 0X9C,
-  0X9E, 0XA0, 0XA2, 0XA3, 0XA5, 0XA7, 0XA9, 0XAA, 0XAB, 0XAC, 0XAE, 0XAF,
-  0XB0, 0XB1, 0XB2, 0XB3, 0XB3, 0XB4, 0XB5, 0XB5, 0XB6, 0XB7, 0XB7, 0XB8,
-  0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB8, 0XB8, 0XB7, 0XB6, 0XB6, 0XB5, 0XB4,
-  0XB3, 0XB3, 0XB2, 0XB1, 0XB0, 0XAE, 0XAD, 0XAB, 0XAA, 0XA8, 0XA7, 0XA5,
-  0XA3, 0XA1, 0X9F, 0X9D, 0X9A, 0X97, 0X94, 0X91, 0X8E, 0X8A, 0X86, 0X83,
-  0X7E, 0X7A, 0X75, 0X6E, 0X67, 0X5E, 0X54, 0X48, 0X3B, 0X29, 0X14, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X19, 0X28, 0X35,
-  0X40, 0X49, 0X51, 0X59, 0X60, 0X65, 0X6B, 0X70, 0X74, 0X79, 0X7C, 0X80,
-  0X84, 0X87, 0X8A, 0X8D, 0X8F, 0X92, 0X94, 0X96, 0X98, 0X9B, 0X9D, 0X9F,
-  0XA0, 0XA2, 0XA3, 0XA5, 0XA6, 0XA8, 0XA8, 0XA9, 0XAB, 0XAC, 0XAD, 0XAE,
-  0XAF, 0XB0, 0XB0, 0XB0, 0XB1, 0XB2, 0XB2, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4,
-  0XB4, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB3, 0XB3, 0XB2, 0XB2, 0XB1, 0XB0, 0XB0, 0XAF, 0XAE, 0XAD, 0XAC, 0XAB,
-  0XAA, 0XA9, 0XA7, 0XA6, 0XA4, 0XA2, 0XA1, 0X9F, 0X9D, 0X9B, 0X98, 0X96,
-  0X93, 0X90, 0X8D, 0X8A, 0X87, 0X83, 0X7F, 0X7C, 0X77, 0X72, 0X6D, 0X66,
-  0X5F, 0X55, 0X4B, 0X3F, 0X30, 0X1C, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X20, 0X2D, 0X38, 0X42, 0X4A, 0X52,
-  0X59, 0X5F, 0X65, 0X69, 0X6E, 0X73, 0X77, 0X7A, 0X7D, 0X81, 0X84, 0X87,
-  0X8A, 0X8C, 0X8E, 0X91, 0X93, 0X95, 0X97, 0X99, 0X9B, 0X9D, 0X9E, 0XA0,
-  0XA1, 0XA2, 0XA3, 0XA4, 0XA6, 0XA7, 0XA8, 0XA9, 0XAA, 0XAA, 0XAB, 0XAB,
-  0XAC, 0XAC, 0XAD, 0XAE, 0XAE, 0XAE, 0XAF, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XAF, 0XAF, 0XAF, 0XAF, 0XAE, 0XAE, 0XAE, 0XAD, 0XAC,
-  0XAC, 0XAB, 0XAA, 0XAA, 0XA9, 0XA8, 0XA7, 0XA6, 0XA4, 0XA3, 0XA2, 0XA0,
-  0X9F, 0X9D, 0X9B, 0X99, 0X97, 0X95, 0X92, 0X90, 0X8D, 0X8A, 0X87, 0X84,
-  0X80, 0X7C, 0X79, 0X75, 0X70, 0X6B, 0X65, 0X5E, 0X56, 0X4D, 0X42, 0X34,
-  0X24, 0X0E, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X17, 0X25, 0X30, 0X3A, 0X43, 0X4B, 0X52, 0X58, 0X5E, 0X63,
-  0X68, 0X6C, 0X71, 0X75, 0X78, 0X7B, 0X7E, 0X81, 0X84, 0X87, 0X8A, 0X8B,
-  0X8E, 0X90, 0X92, 0X94, 0X96, 0X97, 0X99, 0X9A, 0X9C, 0X9D, 0X9F, 0XA0,
-  0XA0, 0XA1, 0XA3, 0XA3, 0XA4, 0XA5, 0XA6, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8,
-  0XA9, 0XA9, 0XA9, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA,
-  0XAA, 0XAA, 0XA9, 0XA9, 0XA8, 0XA8, 0XA8, 0XA7, 0XA7, 0XA6, 0XA5, 0XA4,
-  0XA3, 0XA2, 0XA1, 0XA0, 0X9F, 0X9D, 0X9C, 0X9A, 0X98, 0X97, 0X95, 0X93,
-  0X90, 0X8E, 0X8C, 0X89, 0X86, 0X83, 0X80, 0X7D, 0X79, 0X76, 0X71, 0X6D,
-  0X68, 0X63, 0X5D, 0X56, 0X4D, 0X43, 0X38, 0X2A, 0X17, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0C, 0X1C,
-  0X28, 0X33, 0X3C, 0X44, 0X4B, 0X51, 0X57, 0X5D, 0X62, 0X66, 0X6A, 0X6E,
-  0X72, 0X76, 0X79, 0X7C, 0X7E, 0X81, 0X83, 0X86, 0X88, 0X8B, 0X8D, 0X8E,
-  0X90, 0X92, 0X94, 0X95, 0X97, 0X98, 0X99, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E,
-  0X9F, 0XA0, 0XA1, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA4, 0XA4, 0XA4,
-  0XA3, 0XA3, 0XA2, 0XA2, 0XA1, 0XA0, 0X9F, 0X9F, 0X9D, 0X9C, 0X9B, 0X9A,
-  0X99, 0X97, 0X96, 0X94, 0X93, 0X91, 0X8E, 0X8C, 0X8A, 0X88, 0X86, 0X83,
-  0X80, 0X7D, 0X79, 0X76, 0X73, 0X6F, 0X6A, 0X66, 0X61, 0X5B, 0X55, 0X4D,
-  0X45, 0X3A, 0X2E, 0X1E, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X12, 0X20, 0X2B, 0X34, 0X3D,
-  0X44, 0X4A, 0X50, 0X55, 0X5B, 0X60, 0X64, 0X68, 0X6C, 0X70, 0X73, 0X76,
-  0X79, 0X7B, 0X7E, 0X80, 0X83, 0X85, 0X87, 0X8A, 0X8B, 0X8D, 0X8E, 0X90,
-  0X92, 0X93, 0X94, 0X96, 0X96, 0X97, 0X98, 0X99, 0X9A, 0X9B, 0X9C, 0X9C,
-  0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9D, 0X9C,
-  0X9B, 0X9B, 0X99, 0X99, 0X98, 0X97, 0X96, 0X94, 0X93, 0X91, 0X90, 0X8E,
-  0X8C, 0X8A, 0X88, 0X86, 0X84, 0X82, 0X7F, 0X7C, 0X79, 0X76, 0X73, 0X6F,
-  0X6B, 0X67, 0X62, 0X5E, 0X59, 0X53, 0X4C, 0X45, 0X3B, 0X30, 0X23, 0X11,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X08, 0X17, 0X23, 0X2C, 0X35, 0X3D, 0X43, 0X4A, 0X4F,
-  0X54, 0X59, 0X5E, 0X62, 0X66, 0X69, 0X6D, 0X70, 0X73, 0X76, 0X78, 0X7B,
-  0X7D, 0X7F, 0X81, 0X84, 0X85, 0X88, 0X89, 0X8B, 0X8C, 0X8E, 0X8E, 0X90,
-  0X91, 0X92, 0X93, 0X94, 0X95, 0X96, 0X96, 0X97, 0X98, 0X99, 0X99, 0X99,
-  0X99, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X99, 0X99, 0X99, 0X99, 0X98, 0X97, 0X97, 0X96, 0X95, 0X94, 0X93,
-  0X92, 0X91, 0X90, 0X8E, 0X8D, 0X8B, 0X8A, 0X88, 0X86, 0X84, 0X82, 0X80,
-  0X7D, 0X7B, 0X79, 0X76, 0X73, 0X6F, 0X6C, 0X68, 0X64, 0X60, 0X5B, 0X56,
-  0X51, 0X4B, 0X44, 0X3C, 0X32, 0X26, 0X17, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X0C, 0X1A, 0X24, 0X2D, 0X35, 0X3C, 0X43, 0X48, 0X4E, 0X52, 0X57, 0X5C,
-  0X60, 0X63, 0X67, 0X6A, 0X6D, 0X70, 0X73, 0X76, 0X78, 0X7A, 0X7C, 0X7E,
-  0X80, 0X82, 0X84, 0X85, 0X87, 0X88, 0X8A, 0X8B, 0X8C, 0X8D, 0X8E, 0X8F,
-  0X90, 0X91, 0X91, 0X92, 0X93, 0X93, 0X94, 0X94, 0X95, 0X95, 0X95, 0X96,
-  0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X95, 0X95, 0X95, 0X94, 0X94,
-  0X93, 0X93, 0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8C, 0X8B, 0X8A, 0X89,
-  0X87, 0X85, 0X84, 0X82, 0X80, 0X7E, 0X7C, 0X7A, 0X77, 0X75, 0X72, 0X6F,
-  0X6C, 0X68, 0X64, 0X61, 0X5D, 0X58, 0X53, 0X4E, 0X49, 0X43, 0X3B, 0X32,
-  0X28, 0X1A, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X11, 0X1D, 0X26,
-  0X2E, 0X35, 0X3C, 0X42, 0X47, 0X4D, 0X51, 0X55, 0X5A, 0X5E, 0X61, 0X65,
-  0X68, 0X6B, 0X6D, 0X70, 0X73, 0X75, 0X77, 0X7A, 0X7B, 0X7D, 0X7F, 0X80,
-  0X82, 0X83, 0X85, 0X86, 0X87, 0X88, 0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8D,
-  0X8E, 0X8E, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X91, 0X91, 0X91, 0X91,
-  0X91, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8E, 0X8E, 0X8D, 0X8C, 0X8C,
-  0X8B, 0X8A, 0X89, 0X88, 0X87, 0X86, 0X85, 0X83, 0X81, 0X80, 0X7E, 0X7C,
-  0X7A, 0X79, 0X76, 0X74, 0X71, 0X6F, 0X6C, 0X69, 0X65, 0X62, 0X5E, 0X5A,
-  0X56, 0X51, 0X4C, 0X47, 0X41, 0X3B, 0X33, 0X29, 0X1E, 0X0F, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X13, 0X1E, 0X26, 0X2D, 0X34, 0X3B,
-  0X41, 0X46, 0X4B, 0X4F, 0X53, 0X58, 0X5B, 0X5F, 0X61, 0X65, 0X67, 0X6A,
-  0X6D, 0X6F, 0X71, 0X74, 0X76, 0X78, 0X79, 0X7B, 0X7D, 0X7D, 0X7F, 0X80,
-  0X81, 0X82, 0X84, 0X84, 0X85, 0X86, 0X87, 0X88, 0X88, 0X89, 0X8A, 0X8A,
-  0X8A, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B,
-  0X8A, 0X8A, 0X8A, 0X89, 0X88, 0X88, 0X87, 0X86, 0X85, 0X84, 0X83, 0X82,
-  0X81, 0X80, 0X7E, 0X7D, 0X7B, 0X7A, 0X78, 0X76, 0X74, 0X72, 0X70, 0X6D,
-  0X6B, 0X68, 0X65, 0X62, 0X5E, 0X5B, 0X56, 0X52, 0X4E, 0X49, 0X44, 0X3F,
-  0X39, 0X32, 0X2A, 0X1F, 0X12, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X08, 0X14, 0X1E, 0X26, 0X2D, 0X33, 0X39, 0X3F, 0X44, 0X48,
-  0X4D, 0X51, 0X54, 0X58, 0X5C, 0X5F, 0X62, 0X65, 0X67, 0X6A, 0X6C, 0X6E,
-  0X70, 0X72, 0X74, 0X76, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7D, 0X7E, 0X7F,
-  0X80, 0X81, 0X82, 0X82, 0X83, 0X84, 0X84, 0X85, 0X85, 0X85, 0X86, 0X86,
-  0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X85, 0X85, 0X84, 0X84, 0X83,
-  0X83, 0X82, 0X81, 0X80, 0X7F, 0X7E, 0X7D, 0X7C, 0X7B, 0X7A, 0X79, 0X77,
-  0X76, 0X74, 0X72, 0X70, 0X6E, 0X6B, 0X69, 0X66, 0X64, 0X61, 0X5E, 0X5B,
-  0X57, 0X53, 0X4F, 0X4B, 0X46, 0X41, 0X3C, 0X36, 0X2F, 0X28, 0X1F, 0X14,
-  0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0A,
-  0X15, 0X1D, 0X25, 0X2C, 0X32, 0X38, 0X3D, 0X42, 0X46, 0X4A, 0X4E, 0X51,
-  0X55, 0X59, 0X5B, 0X5E, 0X61, 0X63, 0X66, 0X68, 0X6A, 0X6C, 0X6E, 0X70,
-  0X71, 0X73, 0X74, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7C, 0X7D,
-  0X7D, 0X7E, 0X7E, 0X7F, 0X7F, 0X7F, 0X80, 0X80, 0X80, 0X80, 0X80, 0X80,
-  0X80, 0X80, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7D, 0X7D, 0X7C, 0X7B, 0X7B,
-  0X7A, 0X79, 0X78, 0X77, 0X75, 0X74, 0X73, 0X71, 0X6F, 0X6D, 0X6C, 0X69,
-  0X67, 0X65, 0X63, 0X60, 0X5D, 0X5A, 0X56, 0X53, 0X4F, 0X4C, 0X47, 0X43,
-  0X3E, 0X39, 0X33, 0X2D, 0X26, 0X1E, 0X14, 0X07, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0A, 0X14, 0X1C, 0X24,
-  0X2A, 0X30, 0X36, 0X3B, 0X3F, 0X44, 0X48, 0X4C, 0X4F, 0X52, 0X55, 0X58,
-  0X5B, 0X5E, 0X60, 0X63, 0X65, 0X67, 0X69, 0X6A, 0X6C, 0X6D, 0X6F, 0X70,
-  0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X77, 0X78, 0X79, 0X79, 0X7A, 0X7A,
-  0X7A, 0X7A, 0X7A, 0X7A, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A,
-  0X7A, 0X79, 0X79, 0X78, 0X78, 0X77, 0X76, 0X75, 0X74, 0X73, 0X72, 0X71,
-  0X6F, 0X6E, 0X6C, 0X6A, 0X69, 0X67, 0X65, 0X63, 0X60, 0X5E, 0X5C, 0X59,
-  0X56, 0X52, 0X4F, 0X4C, 0X48, 0X44, 0X40, 0X3B, 0X36, 0X30, 0X2A, 0X24,
-  0X1C, 0X13, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X0A, 0X14, 0X1C, 0X23, 0X29, 0X2F, 0X34,
-  0X39, 0X3D, 0X41, 0X45, 0X48, 0X4C, 0X4F, 0X52, 0X55, 0X58, 0X5A, 0X5D,
-  0X5F, 0X61, 0X63, 0X64, 0X66, 0X67, 0X69, 0X6A, 0X6C, 0X6D, 0X6E, 0X6F,
-  0X70, 0X71, 0X71, 0X72, 0X73, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X75,
-  0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X75, 0X74, 0X74, 0X73, 0X73, 0X72,
-  0X71, 0X71, 0X70, 0X6F, 0X6E, 0X6D, 0X6B, 0X6A, 0X69, 0X67, 0X66, 0X64,
-  0X63, 0X60, 0X5F, 0X5C, 0X5A, 0X57, 0X54, 0X51, 0X4F, 0X4C, 0X48, 0X44,
-  0X40, 0X3C, 0X37, 0X32, 0X2D, 0X27, 0X20, 0X1A, 0X11, 0X06, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X09, 0X12, 0X1A, 0X21, 0X27, 0X2C, 0X31, 0X36, 0X3A, 0X3E,
-  0X42, 0X45, 0X48, 0X4C, 0X4F, 0X51, 0X54, 0X56, 0X59, 0X5B, 0X5D, 0X5F,
-  0X61, 0X62, 0X64, 0X65, 0X66, 0X67, 0X69, 0X69, 0X6A, 0X6B, 0X6C, 0X6D,
-  0X6D, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70,
-  0X6F, 0X6F, 0X6F, 0X6F, 0X6E, 0X6E, 0X6D, 0X6C, 0X6C, 0X6B, 0X6A, 0X69,
-  0X68, 0X67, 0X65, 0X64, 0X63, 0X61, 0X60, 0X5E, 0X5C, 0X5A, 0X57, 0X55,
-  0X52, 0X50, 0X4D, 0X4A, 0X47, 0X44, 0X40, 0X3D, 0X38, 0X34, 0X2F, 0X29,
-  0X24, 0X1D, 0X16, 0X0E, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08,
-  0X11, 0X18, 0X1F, 0X25, 0X2A, 0X2F, 0X33, 0X37, 0X3B, 0X3F, 0X42, 0X45,
-  0X48, 0X4B, 0X4E, 0X50, 0X52, 0X55, 0X57, 0X59, 0X5B, 0X5C, 0X5E, 0X5F,
-  0X60, 0X61, 0X62, 0X63, 0X64, 0X65, 0X66, 0X67, 0X67, 0X68, 0X68, 0X69,
-  0X69, 0X69, 0X69, 0X6A, 0X6A, 0X6A, 0X6A, 0X6A, 0X69, 0X69, 0X69, 0X68,
-  0X68, 0X67, 0X67, 0X66, 0X65, 0X65, 0X64, 0X63, 0X61, 0X60, 0X5F, 0X5E,
-  0X5C, 0X5B, 0X59, 0X57, 0X55, 0X53, 0X51, 0X4E, 0X4C, 0X49, 0X46, 0X43,
-  0X40, 0X3C, 0X38, 0X34, 0X30, 0X2B, 0X26, 0X20, 0X1A, 0X13, 0X0A, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0F, 0X16, 0X1D,
-  0X22, 0X27, 0X2C, 0X30, 0X34, 0X38, 0X3B, 0X3E, 0X42, 0X45, 0X47, 0X4A,
-  0X4D, 0X4F, 0X51, 0X52, 0X54, 0X56, 0X58, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E,
-  0X5F, 0X60, 0X61, 0X61, 0X62, 0X62, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64,
-  0X64, 0X64, 0X64, 0X64, 0X64, 0X63, 0X63, 0X63, 0X62, 0X62, 0X61, 0X60,
-  0X5F, 0X5F, 0X5E, 0X5D, 0X5B, 0X5A, 0X59, 0X57, 0X55, 0X54, 0X52, 0X50,
-  0X4E, 0X4C, 0X4A, 0X47, 0X44, 0X42, 0X3F, 0X3B, 0X38, 0X34, 0X30, 0X2C,
-  0X27, 0X22, 0X1C, 0X16, 0X0F, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0C, 0X14, 0X1A, 0X1F, 0X24, 0X29,
-  0X2D, 0X31, 0X34, 0X38, 0X3B, 0X3E, 0X41, 0X43, 0X46, 0X49, 0X4B, 0X4C,
-  0X4E, 0X50, 0X51, 0X52, 0X54, 0X56, 0X57, 0X58, 0X59, 0X5A, 0X5A, 0X5B,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5D, 0X5D, 0X5D, 0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58, 0X57, 0X56,
-  0X55, 0X53, 0X52, 0X50, 0X4F, 0X4D, 0X4C, 0X49, 0X47, 0X45, 0X43, 0X40,
-  0X3D, 0X3A, 0X37, 0X33, 0X30, 0X2C, 0X28, 0X24, 0X1E, 0X19, 0X12, 0X0A,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X09, 0X11, 0X17, 0X1C, 0X21, 0X25, 0X29, 0X2D, 0X31,
-  0X34, 0X37, 0X3B, 0X3D, 0X40, 0X42, 0X44, 0X46, 0X48, 0X4A, 0X4C, 0X4D,
-  0X4F, 0X50, 0X51, 0X52, 0X53, 0X53, 0X54, 0X55, 0X55, 0X56, 0X57, 0X57,
-  0X57, 0X57, 0X58, 0X58, 0X58, 0X58, 0X58, 0X57, 0X57, 0X57, 0X56, 0X56,
-  0X55, 0X55, 0X54, 0X53, 0X52, 0X52, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4A,
-  0X48, 0X46, 0X44, 0X42, 0X40, 0X3E, 0X3B, 0X38, 0X35, 0X32, 0X2F, 0X2B,
-  0X28, 0X24, 0X1F, 0X1A, 0X14, 0X0E, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X07, 0X0E, 0X14, 0X1A, 0X1E, 0X23, 0X26, 0X2A, 0X2E, 0X31, 0X34, 0X37,
-  0X3A, 0X3C, 0X3E, 0X41, 0X43, 0X44, 0X46, 0X47, 0X49, 0X4A, 0X4C, 0X4C,
-  0X4D, 0X4E, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X52, 0X52, 0X52, 0X52, 0X52,
-  0X52, 0X52, 0X52, 0X52, 0X52, 0X51, 0X51, 0X50, 0X50, 0X4F, 0X4F, 0X4E,
-  0X4D, 0X4C, 0X4B, 0X49, 0X48, 0X47, 0X45, 0X44, 0X42, 0X40, 0X3E, 0X3C,
-  0X3A, 0X37, 0X34, 0X31, 0X2E, 0X2B, 0X28, 0X23, 0X20, 0X1B, 0X16, 0X11,
-  0X0A, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0A, 0X11,
-  0X16, 0X1A, 0X1F, 0X23, 0X27, 0X2A, 0X2D, 0X31, 0X33, 0X36, 0X38, 0X3A,
-  0X3C, 0X3E, 0X40, 0X41, 0X42, 0X43, 0X45, 0X46, 0X47, 0X48, 0X49, 0X4A,
-  0X4A, 0X4B, 0X4B, 0X4B, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C,
-  0X4C, 0X4B, 0X4B, 0X4A, 0X4A, 0X49, 0X48, 0X47, 0X46, 0X45, 0X44, 0X43,
-  0X41, 0X40, 0X3E, 0X3D, 0X3B, 0X39, 0X37, 0X34, 0X32, 0X2F, 0X2C, 0X2A,
-  0X26, 0X23, 0X1F, 0X1B, 0X16, 0X11, 0X0B, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0C, 0X12, 0X17, 0X1B,
-  0X1F, 0X23, 0X26, 0X29, 0X2C, 0X2F, 0X31, 0X33, 0X35, 0X37, 0X39, 0X3B,
-  0X3C, 0X3D, 0X3E, 0X40, 0X41, 0X42, 0X42, 0X43, 0X44, 0X44, 0X45, 0X45,
-  0X45, 0X46, 0X46, 0X46, 0X46, 0X46, 0X45, 0X45, 0X45, 0X45, 0X44, 0X44,
-  0X43, 0X42, 0X42, 0X41, 0X40, 0X3E, 0X3D, 0X3C, 0X3A, 0X39, 0X37, 0X35,
-  0X33, 0X31, 0X2F, 0X2C, 0X2A, 0X27, 0X24, 0X21, 0X1D, 0X19, 0X15, 0X10,
-  0X0C, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X02, 0X07, 0X0D, 0X12, 0X17, 0X1B, 0X1F, 0X22,
-  0X25, 0X28, 0X2A, 0X2C, 0X2F, 0X30, 0X32, 0X34, 0X36, 0X37, 0X38, 0X39,
-  0X3A, 0X3C, 0X3C, 0X3D, 0X3D, 0X3E, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
-  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3E, 0X3E, 0X3D, 0X3D, 0X3C, 0X3B, 0X3A,
-  0X38, 0X38, 0X36, 0X35, 0X33, 0X32, 0X30, 0X2E, 0X2C, 0X2A, 0X27, 0X25,
-  0X22, 0X1F, 0X1C, 0X18, 0X14, 0X0F, 0X0A, 0X05, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X08, 0X0E, 0X12, 0X16, 0X1A, 0X1D, 0X20, 0X23, 0X25,
-  0X27, 0X29, 0X2B, 0X2D, 0X2F, 0X30, 0X31, 0X33, 0X34, 0X34, 0X35, 0X36,
-  0X36, 0X37, 0X37, 0X38, 0X39, 0X39, 0X39, 0X39, 0X39, 0X39, 0X39, 0X38,
-  0X37, 0X37, 0X37, 0X36, 0X35, 0X34, 0X34, 0X32, 0X31, 0X30, 0X2F, 0X2D,
-  0X2B, 0X2A, 0X28, 0X26, 0X24, 0X22, 0X1F, 0X1C, 0X19, 0X16, 0X12, 0X0E,
-  0X09, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X08, 0X0D, 0X12, 0X15, 0X18, 0X1B, 0X1D, 0X20, 0X22, 0X24, 0X26,
-  0X27, 0X29, 0X2B, 0X2C, 0X2D, 0X2D, 0X2F, 0X30, 0X30, 0X31, 0X31, 0X31,
-  0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X31, 0X31, 0X31, 0X30, 0X30, 0X2F,
-  0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X29, 0X27, 0X26, 0X24, 0X22, 0X20, 0X1E,
-  0X1B, 0X19, 0X16, 0X13, 0X0F, 0X0B, 0X07, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X07,
-  0X0C, 0X10, 0X13, 0X15, 0X18, 0X1A, 0X1C, 0X1E, 0X20, 0X21, 0X23, 0X24,
-  0X25, 0X26, 0X28, 0X28, 0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2A, 0X2B, 0X2B,
-  0X2B, 0X2A, 0X2A, 0X2A, 0X2A, 0X29, 0X29, 0X28, 0X26, 0X26, 0X25, 0X24,
-  0X22, 0X21, 0X1F, 0X1D, 0X1C, 0X1A, 0X17, 0X15, 0X12, 0X0F, 0X0C, 0X08,
-  0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X09, 0X0C,
-  0X0F, 0X12, 0X14, 0X16, 0X18, 0X1A, 0X1B, 0X1C, 0X1E, 0X1F, 0X20, 0X21,
-  0X22, 0X22, 0X23, 0X23, 0X23, 0X23, 0X23, 0X23, 0X23, 0X23, 0X23, 0X23,
-  0X22, 0X22, 0X21, 0X20, 0X1F, 0X1E, 0X1C, 0X1C, 0X1A, 0X18, 0X17, 0X15,
-  0X13, 0X10, 0X0E, 0X0A, 0X07, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04, 0X08, 0X0A, 0X0D,
-  0X0F, 0X11, 0X13, 0X15, 0X16, 0X17, 0X17, 0X19, 0X19, 0X1A, 0X1A, 0X1B,
-  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1B, 0X1A, 0X1A, 0X19, 0X19, 0X17,
-  0X16, 0X15, 0X14, 0X13, 0X11, 0X0F, 0X0D, 0X0B, 0X08, 0X05, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X05, 0X07, 0X09, 0X0B,
-  0X0C, 0X0E, 0X0F, 0X10, 0X11, 0X12, 0X12, 0X12, 0X13, 0X13, 0X14, 0X13,
-  0X13, 0X12, 0X12, 0X12, 0X11, 0X11, 0X0F, 0X0F, 0X0D, 0X0B, 0X0A, 0X08,
-  0X06, 0X04, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00 };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("goatEye_upper");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("goatEye_lower");
 #endif // SYMMETRICAL_EYELID
 
 #define IRIS_WIDTH  128
 #define IRIS_HEIGHT 128
 
-const uint16_t polar[128 * 128] PROGMEM= {
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X3B00, 0X3B80, 0X3C00, 0X3D01, 0X3D81, 0X3E01, 0X3F01, 0X3F81,
-  0X4001, 0X4081, 0X4181, 0X4201, 0X4280, 0X4380, 0X4400, 0X4480,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X3700, 0X3780, 0X3881, 0X3901, 0X3981, 0X3A02,
-  0X3B02, 0X3B82, 0X3C02, 0X3D02, 0X3D82, 0X3E02, 0X3F02, 0X3F82,
-  0X4002, 0X4082, 0X4182, 0X4202, 0X4282, 0X4382, 0X4402, 0X4482,
-  0X4581, 0X4601, 0X4681, 0X4701, 0X4800, 0X4880, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X3480, 0X3501,
-  0X3581, 0X3681, 0X3702, 0X3782, 0X3803, 0X3903, 0X3983, 0X3A04,
-  0X3B04, 0X3B84, 0X3C04, 0X3D04, 0X3D84, 0X3E04, 0X3F04, 0X3F84,
-  0X4004, 0X4084, 0X4184, 0X4204, 0X4284, 0X4384, 0X4404, 0X4484,
-  0X4583, 0X4603, 0X4683, 0X4782, 0X4802, 0X4882, 0X4901, 0X4A01,
-  0X4A80, 0X4B00, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X3280, 0X3301, 0X3381, 0X3482, 0X3502,
-  0X3583, 0X3604, 0X3704, 0X3784, 0X3805, 0X3885, 0X3985, 0X3A06,
-  0X3A86, 0X3B86, 0X3C06, 0X3C86, 0X3D86, 0X3E07, 0X3E87, 0X3F87,
-  0X4007, 0X4106, 0X4186, 0X4206, 0X4306, 0X4386, 0X4406, 0X4506,
-  0X4585, 0X4605, 0X4705, 0X4784, 0X4804, 0X4884, 0X4983, 0X4A03,
-  0X4A82, 0X4B02, 0X4C01, 0X4C80, 0X4D00, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X3080, 0X3101, 0X3181, 0X3202, 0X3303, 0X3383, 0X3404, 0X3485,
-  0X3585, 0X3606, 0X3686, 0X3786, 0X3807, 0X3887, 0X3987, 0X3A08,
-  0X3A88, 0X3B88, 0X3C08, 0X3C88, 0X3D88, 0X3E08, 0X3E88, 0X3F88,
-  0X4008, 0X4108, 0X4188, 0X4208, 0X4308, 0X4388, 0X4408, 0X4507,
-  0X4587, 0X4607, 0X4707, 0X4786, 0X4806, 0X4905, 0X4985, 0X4A04,
-  0X4B04, 0X4B83, 0X4C03, 0X4C82, 0X4D82, 0X4E01, 0X4E81, 0X4F00,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2F00, 0X2F81,
-  0X3002, 0X3103, 0X3184, 0X3204, 0X3285, 0X3386, 0X3406, 0X3487,
-  0X3507, 0X3608, 0X3688, 0X3709, 0X3809, 0X3889, 0X3909, 0X3A0A,
-  0X3A8A, 0X3B0A, 0X3C0A, 0X3C8A, 0X3D8A, 0X3E0A, 0X3E8A, 0X3F8A,
-  0X400A, 0X410A, 0X418A, 0X420A, 0X430A, 0X438A, 0X4489, 0X4509,
-  0X4589, 0X4689, 0X4709, 0X4788, 0X4888, 0X4907, 0X4987, 0X4A86,
-  0X4B06, 0X4B85, 0X4C05, 0X4D04, 0X4D84, 0X4E03, 0X4E82, 0X4F82,
-  0X5001, 0X5080, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X2D81, 0X2E01, 0X2E83, 0X2F83,
-  0X3004, 0X3085, 0X3106, 0X3206, 0X3287, 0X3308, 0X3388, 0X3489,
-  0X3509, 0X358A, 0X368A, 0X370B, 0X378B, 0X388B, 0X390B, 0X3A0C,
-  0X3A8C, 0X3B0C, 0X3C0C, 0X3C8C, 0X3D8C, 0X3E0C, 0X3E8C, 0X3F8C,
-  0X400C, 0X410C, 0X418C, 0X420C, 0X430C, 0X438C, 0X448C, 0X450B,
-  0X458B, 0X468B, 0X470A, 0X480A, 0X488A, 0X4909, 0X4A09, 0X4A88,
-  0X4B08, 0X4C07, 0X4C87, 0X4D06, 0X4D86, 0X4E85, 0X4F04, 0X4F83,
-  0X5003, 0X5102, 0X5181, 0X5200, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X2C01, 0X2C82, 0X2D83, 0X2E04, 0X2E84, 0X2F05,
-  0X2F86, 0X3087, 0X3108, 0X3189, 0X3209, 0X330A, 0X338A, 0X340B,
-  0X350B, 0X358C, 0X360C, 0X370D, 0X378D, 0X388D, 0X390E, 0X398E,
-  0X3A8E, 0X3B0E, 0X3C0E, 0X3C8E, 0X3D0F, 0X3E0F, 0X3E8F, 0X3F8F,
-  0X400F, 0X410E, 0X418E, 0X428E, 0X430E, 0X438E, 0X448E, 0X450D,
-  0X460D, 0X468D, 0X470C, 0X480C, 0X488C, 0X498B, 0X4A0B, 0X4A8A,
-  0X4B8A, 0X4C09, 0X4C89, 0X4D88, 0X4E07, 0X4E87, 0X4F06, 0X5005,
-  0X5084, 0X5104, 0X5183, 0X5202, 0X5301, 0X5380, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X2A81, 0X2B81, 0X2C03, 0X2C84, 0X2D05, 0X2D86, 0X2E07, 0X2F08,
-  0X2F88, 0X3009, 0X308A, 0X318B, 0X320B, 0X328C, 0X338C, 0X340D,
-  0X348D, 0X358E, 0X360E, 0X368F, 0X378F, 0X380F, 0X3910, 0X3990,
-  0X3A90, 0X3B10, 0X3B90, 0X3C90, 0X3D10, 0X3E10, 0X3E90, 0X3F90,
-  0X4010, 0X4110, 0X4190, 0X4290, 0X4310, 0X4410, 0X448F, 0X450F,
-  0X460F, 0X468F, 0X478E, 0X480E, 0X490E, 0X498D, 0X4A0D, 0X4B0C,
-  0X4B8C, 0X4C0B, 0X4D0A, 0X4D8A, 0X4E09, 0X4F09, 0X4F88, 0X5007,
-  0X5086, 0X5186, 0X5205, 0X5284, 0X5303, 0X5382, 0X5401, 0X5500,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2980, 0X2A01,
-  0X2A82, 0X2B04, 0X2B85, 0X2C06, 0X2C87, 0X2D88, 0X2E09, 0X2E8A,
-  0X2F0B, 0X300B, 0X308C, 0X310D, 0X320D, 0X328E, 0X330F, 0X340F,
-  0X348F, 0X3510, 0X3610, 0X3691, 0X3791, 0X3812, 0X3892, 0X3992,
-  0X3A12, 0X3B12, 0X3B92, 0X3C92, 0X3D12, 0X3E12, 0X3E92, 0X3F92,
-  0X4012, 0X4112, 0X4192, 0X4292, 0X4312, 0X4412, 0X4492, 0X4591,
-  0X4611, 0X4711, 0X4790, 0X4810, 0X490F, 0X498F, 0X4A8F, 0X4B0E,
-  0X4B8E, 0X4C8D, 0X4D0C, 0X4D8C, 0X4E8B, 0X4F0B, 0X4F8A, 0X5089,
-  0X5108, 0X5187, 0X5207, 0X5306, 0X5385, 0X5404, 0X5483, 0X5502,
-  0X5581, 0X5600, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2881, 0X2902, 0X2983,
-  0X2A04, 0X2A86, 0X2B07, 0X2C08, 0X2C89, 0X2D0A, 0X2D8B, 0X2E8C,
-  0X2F0C, 0X2F8D, 0X300E, 0X310F, 0X318F, 0X3210, 0X3310, 0X3391,
-  0X3492, 0X3512, 0X3592, 0X3693, 0X3713, 0X3813, 0X3894, 0X3994,
-  0X3A14, 0X3B14, 0X3B94, 0X3C94, 0X3D14, 0X3E14, 0X3E94, 0X3F94,
-  0X4014, 0X4114, 0X4194, 0X4294, 0X4314, 0X4413, 0X4493, 0X4593,
-  0X4613, 0X4712, 0X4792, 0X4892, 0X4911, 0X4A11, 0X4A90, 0X4B10,
-  0X4C0F, 0X4C8F, 0X4D8E, 0X4E0E, 0X4E8D, 0X4F8C, 0X500C, 0X508B,
-  0X510A, 0X5209, 0X5288, 0X5307, 0X5387, 0X5486, 0X5505, 0X5584,
-  0X5603, 0X5681, 0X5700, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X2700, 0X2781, 0X2803, 0X2884, 0X2905,
-  0X2986, 0X2A88, 0X2B09, 0X2B8A, 0X2C0B, 0X2C8C, 0X2D8D, 0X2E0E,
-  0X2E8F, 0X2F8F, 0X3010, 0X3091, 0X3191, 0X3212, 0X3292, 0X3393,
-  0X3414, 0X3514, 0X3594, 0X3615, 0X3715, 0X3795, 0X3895, 0X3916,
-  0X3A16, 0X3A96, 0X3B96, 0X3C96, 0X3D16, 0X3E16, 0X3E96, 0X3F96,
-  0X4016, 0X4116, 0X4196, 0X4296, 0X4316, 0X4415, 0X4515, 0X4595,
-  0X4695, 0X4714, 0X4814, 0X4893, 0X4993, 0X4A13, 0X4A92, 0X4B92,
-  0X4C11, 0X4D11, 0X4D90, 0X4E0F, 0X4F0F, 0X4F8E, 0X500D, 0X510D,
-  0X518C, 0X520B, 0X530A, 0X5389, 0X5408, 0X5487, 0X5506, 0X5605,
-  0X5684, 0X5703, 0X5782, 0X5801, 0X5880, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X2601, 0X2682, 0X2704, 0X2785, 0X2886, 0X2907,
-  0X2989, 0X2A0A, 0X2A8B, 0X2B0C, 0X2C0D, 0X2C8E, 0X2D0F, 0X2D90,
-  0X2E91, 0X2F12, 0X2F92, 0X3093, 0X3113, 0X3194, 0X3295, 0X3315,
-  0X3415, 0X3496, 0X3596, 0X3617, 0X3717, 0X3797, 0X3898, 0X3918,
-  0X3A18, 0X3A98, 0X3B98, 0X3C18, 0X3D18, 0X3E18, 0X3E98, 0X3F98,
-  0X4018, 0X4118, 0X4198, 0X4298, 0X4398, 0X4417, 0X4517, 0X4597,
-  0X4697, 0X4716, 0X4816, 0X4895, 0X4995, 0X4A15, 0X4B14, 0X4B94,
-  0X4C93, 0X4D12, 0X4E12, 0X4E91, 0X4F11, 0X5010, 0X508F, 0X510F,
-  0X520E, 0X528D, 0X530C, 0X538B, 0X548A, 0X5509, 0X5588, 0X5607,
-  0X5686, 0X5705, 0X5804, 0X5883, 0X5902, 0X5980, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X2501, 0X2583, 0X2684, 0X2705, 0X2787, 0X2808, 0X288A,
-  0X290B, 0X298C, 0X2A0D, 0X2B0E, 0X2B8F, 0X2C10, 0X2C91, 0X2D92,
-  0X2E13, 0X2E94, 0X2F94, 0X3015, 0X3096, 0X3196, 0X3217, 0X3317,
-  0X3398, 0X3498, 0X3518, 0X3619, 0X3699, 0X3799, 0X381A, 0X391A,
-  0X399A, 0X3A9A, 0X3B9A, 0X3C1A, 0X3D1A, 0X3D9A, 0X3E9A, 0X3F9A,
-  0X401A, 0X411A, 0X421A, 0X429A, 0X4399, 0X4419, 0X4519, 0X4619,
-  0X4698, 0X4798, 0X4818, 0X4917, 0X4997, 0X4A96, 0X4B16, 0X4C15,
-  0X4C95, 0X4D94, 0X4E14, 0X4F13, 0X4F92, 0X5012, 0X5111, 0X5190,
-  0X520F, 0X530F, 0X538E, 0X540D, 0X548C, 0X558B, 0X560A, 0X5689,
-  0X5708, 0X5787, 0X5806, 0X5884, 0X5903, 0X5A02, 0X5A81, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2400,
-  0X2482, 0X2503, 0X2585, 0X2606, 0X2688, 0X2709, 0X278A, 0X280C,
-  0X288D, 0X298E, 0X2A0F, 0X2A90, 0X2B12, 0X2B92, 0X2C93, 0X2D14,
-  0X2D95, 0X2E96, 0X2F16, 0X3017, 0X3098, 0X3118, 0X3219, 0X3299,
-  0X339A, 0X341A, 0X351B, 0X359B, 0X369B, 0X371B, 0X381C, 0X391C,
-  0X399C, 0X3A9C, 0X3B1C, 0X3C1C, 0X3D1C, 0X3D9C, 0X3E9C, 0X3F9C,
-  0X401C, 0X411C, 0X421C, 0X429C, 0X439B, 0X449B, 0X451B, 0X461B,
-  0X469A, 0X479A, 0X489A, 0X4919, 0X4A19, 0X4A98, 0X4B98, 0X4C17,
-  0X4D17, 0X4D96, 0X4E96, 0X4F15, 0X4F95, 0X5094, 0X5113, 0X5212,
-  0X5292, 0X5311, 0X5410, 0X548F, 0X550E, 0X558D, 0X560C, 0X570B,
-  0X578A, 0X5809, 0X5888, 0X5906, 0X5985, 0X5A04, 0X5A83, 0X5B01,
-  0X5B80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2300, 0X2382,
-  0X2404, 0X2485, 0X2507, 0X2588, 0X260A, 0X268B, 0X270D, 0X278E,
-  0X288F, 0X2910, 0X2991, 0X2A12, 0X2A94, 0X2B94, 0X2C15, 0X2C96,
-  0X2D97, 0X2E18, 0X2E99, 0X2F99, 0X301A, 0X311A, 0X319B, 0X329B,
-  0X331C, 0X341C, 0X349D, 0X359D, 0X369D, 0X371E, 0X381E, 0X389E,
-  0X399E, 0X3A9E, 0X3B1E, 0X3C1E, 0X3D1E, 0X3D9E, 0X3E9E, 0X3F9E,
-  0X401E, 0X411E, 0X421E, 0X429E, 0X439D, 0X449D, 0X451D, 0X461D,
-  0X471C, 0X479C, 0X489C, 0X491B, 0X4A1B, 0X4B1A, 0X4B9A, 0X4C99,
-  0X4D19, 0X4E18, 0X4E98, 0X4F97, 0X5016, 0X5116, 0X5195, 0X5214,
-  0X5313, 0X5392, 0X5412, 0X5511, 0X5590, 0X560F, 0X568E, 0X570D,
-  0X580C, 0X588A, 0X5909, 0X5988, 0X5A07, 0X5A86, 0X5B04, 0X5B83,
-  0X5C01, 0X5C80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2201, 0X2282, 0X2304,
-  0X2386, 0X2407, 0X2489, 0X250A, 0X258C, 0X260D, 0X268F, 0X2790,
-  0X2811, 0X2892, 0X2914, 0X2995, 0X2A96, 0X2B17, 0X2B98, 0X2C98,
-  0X2D19, 0X2D9A, 0X2E9B, 0X2F1B, 0X301C, 0X309C, 0X319D, 0X321E,
-  0X331E, 0X339E, 0X349F, 0X359F, 0X361F, 0X371F, 0X37A0, 0X38A0,
-  0X39A0, 0X3A20, 0X3B20, 0X3C20, 0X3D20, 0X3DA0, 0X3EA0, 0X3FA0,
-  0X4020, 0X4120, 0X4220, 0X429F, 0X439F, 0X449F, 0X459F, 0X461F,
-  0X471E, 0X481E, 0X489E, 0X499D, 0X4A1D, 0X4B1C, 0X4C1C, 0X4C9B,
-  0X4D9B, 0X4E1A, 0X4F1A, 0X4F99, 0X5098, 0X5118, 0X5217, 0X5296,
-  0X5315, 0X5415, 0X5494, 0X5513, 0X5612, 0X5691, 0X5710, 0X578F,
-  0X580E, 0X590C, 0X598B, 0X5A0A, 0X5A89, 0X5B07, 0X5B86, 0X5C05,
-  0X5C83, 0X5D02, 0X5D80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X2101, 0X2183, 0X2204, 0X2286,
-  0X2308, 0X2389, 0X240B, 0X248C, 0X250E, 0X258F, 0X2691, 0X2712,
-  0X2793, 0X2814, 0X2896, 0X2997, 0X2A18, 0X2A99, 0X2B9A, 0X2C1A,
-  0X2C9B, 0X2D9C, 0X2E1D, 0X2F1E, 0X2F9E, 0X309F, 0X311F, 0X3220,
-  0X32A0, 0X33A0, 0X3421, 0X3521, 0X3621, 0X36A2, 0X37A2, 0X38A2,
-  0X3922, 0X3A22, 0X3B22, 0X3C22, 0X3CA2, 0X3DA2, 0X3EA2, 0X3FA2,
-  0X4022, 0X4122, 0X4222, 0X4322, 0X43A1, 0X44A1, 0X45A1, 0X46A0,
-  0X4720, 0X4820, 0X491F, 0X499F, 0X4A9F, 0X4B9E, 0X4C1E, 0X4D1D,
-  0X4D9D, 0X4E9C, 0X4F1B, 0X501B, 0X509A, 0X5199, 0X5219, 0X5318,
-  0X5397, 0X5416, 0X5515, 0X5595, 0X5613, 0X5712, 0X5791, 0X5810,
-  0X588F, 0X590E, 0X5A0D, 0X5A8C, 0X5B0A, 0X5B89, 0X5C08, 0X5C86,
-  0X5D05, 0X5D83, 0X5E02, 0X5E81, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X2001, 0X2083, 0X2105, 0X2186, 0X2208,
-  0X228A, 0X230C, 0X238D, 0X240F, 0X2510, 0X2592, 0X2613, 0X2694,
-  0X2715, 0X2797, 0X2898, 0X2919, 0X299A, 0X2A9B, 0X2B1C, 0X2B9D,
-  0X2C9E, 0X2D1E, 0X2E1F, 0X2E9F, 0X2FA0, 0X3021, 0X3121, 0X31A2,
-  0X32A2, 0X3323, 0X3423, 0X3523, 0X35A3, 0X36A4, 0X37A4, 0X3824,
-  0X3924, 0X3A24, 0X3B24, 0X3BA4, 0X3CA4, 0X3DA4, 0X3EA4, 0X3FA4,
-  0X4024, 0X4124, 0X4224, 0X4323, 0X4423, 0X44A3, 0X45A3, 0X46A3,
-  0X47A2, 0X4822, 0X4922, 0X4A21, 0X4AA1, 0X4BA0, 0X4CA0, 0X4D1F,
-  0X4E1F, 0X4E9E, 0X4F9D, 0X501D, 0X511C, 0X519B, 0X529B, 0X531A,
-  0X5419, 0X5498, 0X5517, 0X5616, 0X5695, 0X5714, 0X5813, 0X5892,
-  0X5911, 0X5990, 0X5A0F, 0X5A8E, 0X5B8C, 0X5C0B, 0X5C8A, 0X5D08,
-  0X5D87, 0X5E05, 0X5E84, 0X5F02, 0X5F81, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X1F81, 0X2003, 0X2005, 0X2086, 0X2108, 0X218A,
-  0X220C, 0X228D, 0X230F, 0X2411, 0X2492, 0X2514, 0X2595, 0X2616,
-  0X2698, 0X2799, 0X281A, 0X289B, 0X291C, 0X2A1D, 0X2A9E, 0X2B1F,
-  0X2C20, 0X2CA0, 0X2DA1, 0X2E22, 0X2F22, 0X2FA3, 0X30A3, 0X31A4,
-  0X3224, 0X3325, 0X33A5, 0X34A5, 0X35A6, 0X36A6, 0X3726, 0X3826,
-  0X3926, 0X3A26, 0X3AA6, 0X3BA6, 0X3CA6, 0X3DA6, 0X3EA6, 0X3FA6,
-  0X4026, 0X4126, 0X4226, 0X4326, 0X4425, 0X4525, 0X45A5, 0X46A4,
-  0X47A4, 0X48A4, 0X4923, 0X4A23, 0X4B23, 0X4C22, 0X4CA2, 0X4DA1,
-  0X4E20, 0X4F20, 0X501F, 0X509F, 0X519E, 0X521D, 0X531C, 0X539C,
-  0X549B, 0X551A, 0X5599, 0X5698, 0X5717, 0X5796, 0X5815, 0X5914,
-  0X5993, 0X5A12, 0X5A91, 0X5B0F, 0X5B8E, 0X5C8D, 0X5D0B, 0X5D8A,
-  0X5E08, 0X5E87, 0X5F05, 0X5F84, 0X6002, 0X6001, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X1E81, 0X1F03, 0X1F85, 0X2007, 0X2009, 0X208A, 0X210C,
-  0X218E, 0X2210, 0X2311, 0X2393, 0X2414, 0X2496, 0X2517, 0X2598,
-  0X261A, 0X271B, 0X279C, 0X281D, 0X291E, 0X299F, 0X2A20, 0X2B21,
-  0X2BA2, 0X2CA3, 0X2D23, 0X2E24, 0X2EA4, 0X2FA5, 0X3026, 0X3126,
-  0X3226, 0X32A7, 0X33A7, 0X34A7, 0X3527, 0X3628, 0X3728, 0X3828,
-  0X3928, 0X39A8, 0X3AA8, 0X3BA8, 0X3CA8, 0X3DA8, 0X3EA8, 0X3FA8,
-  0X4028, 0X4128, 0X4228, 0X4327, 0X4427, 0X4527, 0X4627, 0X46A7,
-  0X47A6, 0X48A6, 0X49A5, 0X4AA5, 0X4B25, 0X4C24, 0X4D23, 0X4DA3,
-  0X4EA3, 0X4FA2, 0X5021, 0X5120, 0X51A0, 0X529F, 0X531E, 0X541E,
-  0X549D, 0X559C, 0X561B, 0X569A, 0X5799, 0X5818, 0X5897, 0X5996,
-  0X5A15, 0X5A94, 0X5B12, 0X5B91, 0X5C10, 0X5C8F, 0X5D8D, 0X5E0C,
-  0X5E8A, 0X5F09, 0X5F87, 0X6006, 0X6004, 0X6082, 0X6101, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X1D81, 0X1E03, 0X1E85, 0X1F07, 0X1F89, 0X200A, 0X200C, 0X208E,
-  0X2110, 0X2212, 0X2293, 0X2315, 0X2396, 0X2418, 0X2499, 0X251B,
-  0X261C, 0X269D, 0X271E, 0X279F, 0X28A0, 0X2921, 0X29A2, 0X2AA3,
-  0X2B24, 0X2C24, 0X2CA5, 0X2DA6, 0X2E26, 0X2F27, 0X3027, 0X30A8,
-  0X31A8, 0X32A9, 0X3329, 0X3429, 0X352A, 0X362A, 0X372A, 0X37AA,
-  0X38AA, 0X39AA, 0X3AAA, 0X3BAA, 0X3CAA, 0X3DAA, 0X3EAA, 0X3FAA,
-  0X402A, 0X412A, 0X422A, 0X4329, 0X4429, 0X4529, 0X4628, 0X4728,
-  0X4828, 0X48A7, 0X49A7, 0X4AA7, 0X4BA6, 0X4CA6, 0X4D25, 0X4E25,
-  0X4F24, 0X4FA3, 0X50A3, 0X51A2, 0X5222, 0X5321, 0X53A0, 0X549F,
-  0X551F, 0X561E, 0X569D, 0X571C, 0X581B, 0X589A, 0X5919, 0X5998,
-  0X5A97, 0X5B15, 0X5B94, 0X5C13, 0X5C92, 0X5D10, 0X5D8F, 0X5E8D,
-  0X5F0C, 0X5F8A, 0X6009, 0X6007, 0X6085, 0X6104, 0X6182, 0X6200,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1C80,
-  0X1D03, 0X1D84, 0X1E06, 0X1E88, 0X1F0A, 0X1F8C, 0X200E, 0X2010,
-  0X2112, 0X2193, 0X2215, 0X2297, 0X2318, 0X239A, 0X241B, 0X249D,
-  0X259E, 0X261F, 0X26A0, 0X2721, 0X2822, 0X28A3, 0X29A4, 0X2A25,
-  0X2B26, 0X2BA7, 0X2CA7, 0X2D28, 0X2E28, 0X2EA9, 0X2FAA, 0X30AA,
-  0X312A, 0X322B, 0X332B, 0X342B, 0X34AB, 0X35AC, 0X36AC, 0X37AC,
-  0X38AC, 0X39AC, 0X3AAC, 0X3BAC, 0X3CAC, 0X3DAC, 0X3EAC, 0X3FAC,
-  0X402C, 0X412C, 0X422B, 0X432B, 0X442B, 0X452B, 0X462B, 0X472A,
-  0X482A, 0X4929, 0X4A29, 0X4B29, 0X4BA8, 0X4CA8, 0X4DA7, 0X4EA7,
-  0X4F26, 0X5025, 0X5125, 0X51A4, 0X52A3, 0X5323, 0X5422, 0X54A1,
-  0X55A0, 0X561F, 0X571F, 0X579E, 0X589D, 0X591C, 0X599B, 0X5A19,
-  0X5B18, 0X5B97, 0X5C16, 0X5C95, 0X5D13, 0X5D92, 0X5E11, 0X5E8F,
-  0X5F8E, 0X600C, 0X600A, 0X6089, 0X6107, 0X6185, 0X6204, 0X6282,
-  0X6300, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1B80, 0X1C02,
-  0X1C84, 0X1D06, 0X1D88, 0X1E0A, 0X1E8C, 0X1F0E, 0X1F90, 0X2012,
-  0X2094, 0X2115, 0X2197, 0X2219, 0X229A, 0X231C, 0X239D, 0X241F,
-  0X2520, 0X25A1, 0X2623, 0X2723, 0X27A5, 0X2826, 0X2927, 0X29A7,
-  0X2AA8, 0X2B29, 0X2C2A, 0X2CAA, 0X2DAB, 0X2EAB, 0X2F2C, 0X302C,
-  0X312C, 0X31AD, 0X32AD, 0X33AD, 0X34AE, 0X35AE, 0X36AE, 0X37AE,
-  0X38AE, 0X39AE, 0X3AAE, 0X3B2E, 0X3C2E, 0X3D2E, 0X3E2E, 0X3F2E,
-  0X40AE, 0X41AE, 0X42AE, 0X43AD, 0X44AD, 0X452D, 0X462C, 0X472C,
-  0X482C, 0X492B, 0X4A2B, 0X4B2B, 0X4C2A, 0X4D2A, 0X4E29, 0X4EA9,
-  0X4FA8, 0X50A7, 0X5127, 0X5226, 0X5326, 0X53A5, 0X54A4, 0X5523,
-  0X5622, 0X56A2, 0X57A1, 0X581F, 0X589F, 0X599E, 0X5A1C, 0X5A9B,
-  0X5B9A, 0X5C19, 0X5C98, 0X5D16, 0X5D95, 0X5E14, 0X5E92, 0X5F11,
-  0X600F, 0X600E, 0X608C, 0X610B, 0X6189, 0X6207, 0X6285, 0X6303,
-  0X6382, 0X6400, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1B02, 0X1B84,
-  0X1C06, 0X1C88, 0X1D0A, 0X1D8C, 0X1E0E, 0X1E90, 0X1E92, 0X1F14,
-  0X2015, 0X2097, 0X2119, 0X219B, 0X221C, 0X229E, 0X231F, 0X23A1,
-  0X24A2, 0X2523, 0X25A5, 0X26A6, 0X2727, 0X27A8, 0X28A9, 0X2929,
-  0X2A2A, 0X2AAB, 0X2BAC, 0X2C2C, 0X2D2D, 0X2E2D, 0X2F2E, 0X2FAE,
-  0X30AF, 0X31AF, 0X32AF, 0X33B0, 0X3430, 0X3530, 0X3630, 0X3730,
-  0X3830, 0X3930, 0X3A30, 0X3B30, 0X3C30, 0X3D30, 0X3E30, 0X3F30,
-  0X40B0, 0X41B0, 0X42B0, 0X43AF, 0X44AF, 0X45AF, 0X46AE, 0X47AE,
-  0X48AE, 0X49AD, 0X4AAD, 0X4BAC, 0X4C2C, 0X4D2C, 0X4E2B, 0X4F2B,
-  0X502A, 0X50A9, 0X51A9, 0X52A8, 0X53A7, 0X5427, 0X5526, 0X55A5,
-  0X56A4, 0X5723, 0X5822, 0X58A2, 0X5920, 0X5A1F, 0X5A9E, 0X5B1D,
-  0X5C1C, 0X5C9B, 0X5D1A, 0X5D98, 0X5E17, 0X5E95, 0X5F14, 0X6012,
-  0X6091, 0X610F, 0X610E, 0X618C, 0X620A, 0X6289, 0X6307, 0X6385,
-  0X6403, 0X6481, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1A82, 0X1A84, 0X1B06,
-  0X1B88, 0X1C0A, 0X1C8C, 0X1D0E, 0X1D90, 0X1D92, 0X1E14, 0X1E96,
-  0X1F18, 0X2019, 0X209B, 0X211D, 0X219F, 0X2220, 0X22A2, 0X2323,
-  0X2424, 0X24A5, 0X2527, 0X2628, 0X26A9, 0X272A, 0X282B, 0X28AC,
-  0X29AC, 0X2A2D, 0X2B2E, 0X2C2E, 0X2CAF, 0X2DB0, 0X2EB0, 0X2FB1,
-  0X3031, 0X3131, 0X3231, 0X3331, 0X3432, 0X3532, 0X3632, 0X3732,
-  0X3832, 0X3932, 0X3A32, 0X3B32, 0X3C32, 0X3D32, 0X3E32, 0X3F32,
-  0X40B2, 0X41B2, 0X42B1, 0X43B1, 0X44B1, 0X45B1, 0X46B1, 0X47B0,
-  0X48B0, 0X49B0, 0X4AAF, 0X4BAF, 0X4CAE, 0X4DAE, 0X4EAD, 0X4FAC,
-  0X502C, 0X512B, 0X522B, 0X532A, 0X53A9, 0X54A9, 0X55A8, 0X5627,
-  0X5726, 0X57A5, 0X58A4, 0X5923, 0X59A2, 0X5AA1, 0X5B20, 0X5B9F,
-  0X5C9E, 0X5D1D, 0X5D9B, 0X5E1A, 0X5E99, 0X5F17, 0X6016, 0X6094,
-  0X6113, 0X6191, 0X620F, 0X620E, 0X628C, 0X630A, 0X6388, 0X6407,
-  0X6485, 0X6503, 0X6501, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X1981, 0X1A03, 0X1A05, 0X1A87,
-  0X1B0A, 0X1B8C, 0X1C0E, 0X1C90, 0X1C92, 0X1D14, 0X1D96, 0X1E18,
-  0X1E99, 0X1F1B, 0X201D, 0X209F, 0X2120, 0X21A2, 0X2224, 0X22A5,
-  0X23A6, 0X2427, 0X24A9, 0X25AA, 0X262B, 0X26AC, 0X27AD, 0X282E,
-  0X292F, 0X29AF, 0X2AB0, 0X2BB1, 0X2C31, 0X2D32, 0X2E32, 0X2F32,
-  0X3033, 0X30B3, 0X31B3, 0X32B4, 0X33B4, 0X34B4, 0X35B4, 0X36B4,
-  0X37B4, 0X3934, 0X3A34, 0X3B34, 0X3C34, 0X3D34, 0X3E34, 0X3F34,
-  0X40B4, 0X41B4, 0X42B3, 0X43B3, 0X44B3, 0X45B3, 0X46B2, 0X4832,
-  0X4932, 0X4A31, 0X4B31, 0X4C31, 0X4D30, 0X4E30, 0X4F2F, 0X4FAE,
-  0X50AE, 0X51AD, 0X52AC, 0X53AC, 0X542B, 0X552B, 0X562A, 0X56A9,
-  0X57A8, 0X5827, 0X5926, 0X59A5, 0X5A24, 0X5B23, 0X5BA2, 0X5C21,
-  0X5D20, 0X5D9E, 0X5E1D, 0X5E9C, 0X5F1B, 0X6019, 0X6098, 0X6116,
-  0X6195, 0X6213, 0X6291, 0X6310, 0X630E, 0X638C, 0X640A, 0X6488,
-  0X6506, 0X6584, 0X6582, 0X6600, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X1880, 0X1903, 0X1905, 0X1987, 0X1A09,
-  0X1A8B, 0X1B0E, 0X1B90, 0X1B92, 0X1C14, 0X1C96, 0X1D18, 0X1D9A,
-  0X1E1C, 0X1E9D, 0X1F1F, 0X2021, 0X20A3, 0X2124, 0X21A6, 0X2227,
-  0X22A8, 0X23AA, 0X242B, 0X24AC, 0X25AD, 0X262E, 0X272F, 0X27B0,
-  0X28B1, 0X2931, 0X2A32, 0X2B33, 0X2C33, 0X2CB4, 0X2DB4, 0X2EB5,
-  0X2FB5, 0X30B5, 0X31B6, 0X32B6, 0X33B6, 0X34B6, 0X35B6, 0X36B7,
-  0X37B7, 0X38B7, 0X39B7, 0X3B37, 0X3C37, 0X3D37, 0X3E36, 0X3F36,
-  0X40B6, 0X41B6, 0X42B6, 0X43B6, 0X44B5, 0X4635, 0X4735, 0X4834,
-  0X4934, 0X4A33, 0X4B33, 0X4C32, 0X4D32, 0X4E31, 0X4F31, 0X5031,
-  0X5130, 0X522F, 0X532F, 0X53AE, 0X54AD, 0X55AC, 0X56AC, 0X572B,
-  0X582A, 0X58A9, 0X59A8, 0X5A27, 0X5B26, 0X5BA5, 0X5C24, 0X5D23,
-  0X5DA2, 0X5E20, 0X5E9F, 0X5F1E, 0X601C, 0X609B, 0X6119, 0X6198,
-  0X6216, 0X6294, 0X6313, 0X6391, 0X640F, 0X640E, 0X648C, 0X650A,
-  0X6588, 0X6606, 0X6684, 0X6682, 0X6700, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X1802, 0X1884, 0X1886, 0X1909, 0X198B,
-  0X1A0D, 0X1A8F, 0X1A92, 0X1B14, 0X1B96, 0X1C18, 0X1C9A, 0X1D1B,
-  0X1D9D, 0X1E1F, 0X1EA1, 0X1F23, 0X2025, 0X20A6, 0X2128, 0X21A9,
-  0X222B, 0X232C, 0X23AD, 0X242E, 0X2530, 0X25B0, 0X26B1, 0X2732,
-  0X2833, 0X28B4, 0X29B4, 0X2AB5, 0X2BB6, 0X2C36, 0X2D36, 0X2E37,
-  0X2F37, 0X3037, 0X3138, 0X3238, 0X3338, 0X3438, 0X3538, 0X3638,
-  0X37B8, 0X38B8, 0X39B8, 0X3AB8, 0X3BB8, 0X3D38, 0X3E38, 0X3F38,
-  0X40B8, 0X41B8, 0X42B7, 0X4437, 0X4537, 0X4637, 0X4737, 0X4836,
-  0X49B6, 0X4AB5, 0X4BB5, 0X4CB5, 0X4DB4, 0X4EB3, 0X4FB3, 0X50B2,
-  0X51B2, 0X52B1, 0X53B1, 0X5430, 0X552F, 0X562E, 0X572D, 0X57AD,
-  0X58AC, 0X592B, 0X5A2A, 0X5AA9, 0X5BA8, 0X5C27, 0X5CA6, 0X5DA5,
-  0X5E23, 0X5EA2, 0X5F21, 0X601F, 0X609E, 0X611D, 0X619B, 0X6219,
-  0X6298, 0X6316, 0X6395, 0X6413, 0X6491, 0X650F, 0X650D, 0X658B,
-  0X6609, 0X6687, 0X6705, 0X6703, 0X6781, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X1701, 0X1783, 0X1806, 0X1808, 0X188A, 0X190D,
-  0X198F, 0X1A11, 0X1A13, 0X1A95, 0X1B18, 0X1B99, 0X1C1C, 0X1C9E,
-  0X1D1F, 0X1DA1, 0X1E23, 0X1EA5, 0X1F27, 0X2028, 0X20AA, 0X212C,
-  0X21AD, 0X22AE, 0X2330, 0X23B1, 0X24B2, 0X2533, 0X2634, 0X26B4,
-  0X27B5, 0X2836, 0X2937, 0X2A37, 0X2B37, 0X2BB8, 0X2CB8, 0X2DB9,
-  0X2EB9, 0X2FBA, 0X30BA, 0X31BA, 0X32BA, 0X33BA, 0X353B, 0X363B,
-  0X373B, 0X383B, 0X39BB, 0X3ABB, 0X3BBB, 0X3D3B, 0X3E3A, 0X3F3A,
-  0X40BA, 0X41BA, 0X42BA, 0X4439, 0X4539, 0X4639, 0X47B8, 0X48B8,
-  0X49B8, 0X4AB7, 0X4C37, 0X4D37, 0X4E36, 0X4F36, 0X5035, 0X5134,
-  0X5234, 0X5333, 0X5432, 0X54B2, 0X55B1, 0X56B1, 0X57B0, 0X582F,
-  0X592E, 0X59AD, 0X5AAC, 0X5B2B, 0X5C2A, 0X5CA9, 0X5D28, 0X5E27,
-  0X5EA6, 0X5F24, 0X6023, 0X60A1, 0X6120, 0X619E, 0X621D, 0X629B,
-  0X631A, 0X6398, 0X6416, 0X6495, 0X6513, 0X6591, 0X658F, 0X660D,
-  0X668B, 0X6709, 0X6787, 0X6785, 0X6803, 0X6881, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X1601, 0X1682, 0X1705, 0X1707, 0X178A, 0X180C, 0X188E,
-  0X1911, 0X1913, 0X1995, 0X1A17, 0X1A99, 0X1B1B, 0X1B9D, 0X1C1F,
-  0X1CA1, 0X1D23, 0X1DA5, 0X1E27, 0X1EA9, 0X1F2B, 0X202C, 0X20AE,
-  0X212F, 0X21B0, 0X22B2, 0X2333, 0X23B4, 0X24B5, 0X2536, 0X2637,
-  0X2737, 0X27B8, 0X28B9, 0X29B9, 0X2ABA, 0X2B3A, 0X2C3B, 0X2D3B,
-  0X2E3B, 0X2F3C, 0X303C, 0X313C, 0X32BC, 0X33BD, 0X34BD, 0X35BD,
-  0X373D, 0X383D, 0X393D, 0X3ABD, 0X3BBD, 0X3CBD, 0X3E3C, 0X3F3C,
-  0X40BC, 0X41BC, 0X433C, 0X443B, 0X453B, 0X46BB, 0X47BA, 0X48BA,
-  0X4A3A, 0X4B39, 0X4C39, 0X4D38, 0X4EB8, 0X4FB7, 0X50B7, 0X51B6,
-  0X52B6, 0X53B5, 0X54B5, 0X5534, 0X5633, 0X5732, 0X5831, 0X58B1,
-  0X59B0, 0X5AAF, 0X5B2E, 0X5C2D, 0X5CAC, 0X5D2B, 0X5E2A, 0X5EA8,
-  0X5F27, 0X6026, 0X60A5, 0X6123, 0X61A2, 0X6220, 0X629F, 0X631D,
-  0X639B, 0X6419, 0X6498, 0X6516, 0X6594, 0X6612, 0X6690, 0X668E,
-  0X670C, 0X678A, 0X6808, 0X6886, 0X6884, 0X6902, 0X6980, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X1582, 0X1604, 0X1687, 0X1689, 0X170B, 0X178E, 0X1810,
-  0X1812, 0X1895, 0X1917, 0X1999, 0X1A1B, 0X1A9D, 0X1B1F, 0X1BA1,
-  0X1C23, 0X1CA5, 0X1D27, 0X1DA9, 0X1E2B, 0X1EAC, 0X1F2E, 0X2030,
-  0X20B1, 0X2132, 0X21B4, 0X22B5, 0X2336, 0X2437, 0X24B8, 0X25B9,
-  0X263A, 0X273A, 0X283B, 0X293C, 0X29BC, 0X2ABD, 0X2BBD, 0X2CBD,
-  0X2DBE, 0X2EBE, 0X2FBE, 0X313F, 0X323F, 0X333F, 0X343F, 0X35BF,
-  0X36BF, 0X37BF, 0X393F, 0X3A3F, 0X3BBF, 0X3CBF, 0X3E3F, 0X3F3F,
-  0X40BE, 0X41BE, 0X433E, 0X443E, 0X45BD, 0X46BD, 0X483D, 0X493C,
-  0X4A3C, 0X4BBB, 0X4CBB, 0X4DBB, 0X4EBA, 0X5039, 0X5139, 0X5238,
-  0X5338, 0X5437, 0X5537, 0X5636, 0X56B5, 0X57B4, 0X58B3, 0X59B3,
-  0X5A32, 0X5B31, 0X5BB0, 0X5CAF, 0X5D2E, 0X5E2D, 0X5EAB, 0X5F2A,
-  0X6029, 0X60A8, 0X6127, 0X61A5, 0X6224, 0X62A2, 0X6320, 0X639F,
-  0X641D, 0X649B, 0X651A, 0X6598, 0X6616, 0X6694, 0X6712, 0X6790,
-  0X678E, 0X680C, 0X688A, 0X6908, 0X6905, 0X6983, 0X6A01, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X1501, 0X1503, 0X1585, 0X1608, 0X160A, 0X168D, 0X170F, 0X1711,
-  0X1794, 0X1816, 0X1898, 0X191B, 0X199D, 0X199F, 0X1A21, 0X1AA3,
-  0X1B25, 0X1BA7, 0X1C29, 0X1D2B, 0X1DAD, 0X1E2F, 0X1EB0, 0X1F32,
-  0X2033, 0X20B4, 0X2136, 0X2237, 0X22B8, 0X23B9, 0X243A, 0X253B,
-  0X25BC, 0X26BC, 0X27BD, 0X283E, 0X293E, 0X2A3F, 0X2B3F, 0X2C3F,
-  0X2D40, 0X2E40, 0X2FC0, 0X30C0, 0X31C0, 0X32C0, 0X3441, 0X3541,
-  0X3641, 0X37C1, 0X38C1, 0X3A41, 0X3B40, 0X3CC0, 0X3E40, 0X3F40,
-  0X40C0, 0X41C0, 0X4340, 0X44BF, 0X45BF, 0X473F, 0X483F, 0X49BE,
-  0X4ABE, 0X4BBD, 0X4D3D, 0X4E3C, 0X4F3C, 0X503B, 0X51BB, 0X52BA,
-  0X53BA, 0X54B9, 0X55B8, 0X56B7, 0X57B7, 0X5836, 0X5935, 0X5A35,
-  0X5AB4, 0X5BB3, 0X5C32, 0X5D31, 0X5DB0, 0X5EAF, 0X5F2D, 0X602C,
-  0X60AB, 0X612A, 0X61A8, 0X6227, 0X62A5, 0X63A4, 0X6422, 0X64A0,
-  0X651F, 0X659D, 0X661B, 0X6619, 0X6697, 0X6715, 0X6793, 0X6811,
-  0X688F, 0X688D, 0X690B, 0X6989, 0X6987, 0X6A04, 0X6A82, 0X6A80,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X1402, 0X1485, 0X1507, 0X1509, 0X158C, 0X160E, 0X1611, 0X1693,
-  0X1715, 0X1798, 0X181A, 0X181C, 0X189F, 0X1921, 0X19A3, 0X1A25,
-  0X1AA7, 0X1B29, 0X1BAB, 0X1C2D, 0X1CAF, 0X1D31, 0X1E32, 0X1EB4,
-  0X1F35, 0X2037, 0X20B8, 0X2139, 0X223A, 0X22BB, 0X23BC, 0X243D,
-  0X253E, 0X263F, 0X26BF, 0X27C0, 0X28C0, 0X29C1, 0X2AC1, 0X2BC1,
-  0X2CC2, 0X2DC2, 0X2F42, 0X3042, 0X3142, 0X3243, 0X33C3, 0X34C3,
-  0X3643, 0X3743, 0X38C3, 0X3A43, 0X3B43, 0X3CC2, 0X3DC2, 0X3F42,
-  0X40C2, 0X4242, 0X4341, 0X44C1, 0X45C1, 0X4741, 0X48C0, 0X49C0,
-  0X4B40, 0X4C3F, 0X4DBF, 0X4EBF, 0X4FBE, 0X50BD, 0X523D, 0X533C,
-  0X543C, 0X553B, 0X563A, 0X5739, 0X5839, 0X5938, 0X59B7, 0X5AB7,
-  0X5BB6, 0X5C35, 0X5D34, 0X5DB2, 0X5EB1, 0X5F30, 0X602F, 0X60AE,
-  0X612D, 0X61AB, 0X62AA, 0X6328, 0X63A7, 0X6425, 0X64A4, 0X6522,
-  0X65A0, 0X661F, 0X669C, 0X671B, 0X6799, 0X6797, 0X6815, 0X6893,
-  0X6911, 0X698F, 0X698C, 0X6A0A, 0X6A88, 0X6A86, 0X6B04, 0X6B82,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1381,
-  0X1383, 0X1406, 0X1488, 0X148B, 0X150D, 0X1590, 0X1592, 0X1615,
-  0X1697, 0X1719, 0X171C, 0X179E, 0X1820, 0X18A2, 0X1925, 0X19A7,
-  0X1A29, 0X1AAB, 0X1B2D, 0X1BAF, 0X1C31, 0X1CB3, 0X1D34, 0X1E36,
-  0X1EB7, 0X1F39, 0X203A, 0X20BB, 0X213D, 0X223E, 0X22BF, 0X23BF,
-  0X24C0, 0X2541, 0X2641, 0X2742, 0X2842, 0X2943, 0X2A43, 0X2B44,
-  0X2C44, 0X2D44, 0X2EC4, 0X2FC5, 0X30C5, 0X3245, 0X3345, 0X34C5,
-  0X35C5, 0X3745, 0X3845, 0X39C5, 0X3B45, 0X3CC5, 0X3DC5, 0X3F44,
-  0X40C4, 0X4244, 0X4344, 0X44C3, 0X4643, 0X47C3, 0X48C2, 0X4A42,
-  0X4B42, 0X4CC1, 0X4DC1, 0X4F40, 0X5040, 0X513F, 0X52BF, 0X53BE,
-  0X54BE, 0X55BD, 0X56BC, 0X57BC, 0X58BB, 0X59BA, 0X5AB9, 0X5B38,
-  0X5C37, 0X5D37, 0X5DB6, 0X5EB5, 0X5F33, 0X6032, 0X60B1, 0X6130,
-  0X61AF, 0X62AD, 0X632C, 0X63AA, 0X6429, 0X64A7, 0X6526, 0X65A4,
-  0X6622, 0X66A0, 0X671E, 0X679C, 0X681A, 0X6898, 0X6896, 0X6914,
-  0X6992, 0X6A10, 0X6A0E, 0X6A8C, 0X6B09, 0X6B07, 0X6B85, 0X6C03,
-  0X6C01, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1302,
-  0X1305, 0X1387, 0X138A, 0X140C, 0X148F, 0X1491, 0X1514, 0X1596,
-  0X1618, 0X161B, 0X169D, 0X1720, 0X17A2, 0X1824, 0X18A6, 0X18A9,
-  0X192B, 0X19AD, 0X1A2F, 0X1B31, 0X1BB3, 0X1C35, 0X1CB6, 0X1D38,
-  0X1DB9, 0X1EBB, 0X1F3D, 0X203E, 0X20BF, 0X2140, 0X2241, 0X2341,
-  0X23C2, 0X24C3, 0X25C4, 0X26C4, 0X27C5, 0X28C5, 0X29C5, 0X2AC6,
-  0X2BC6, 0X2CC6, 0X2DC7, 0X2F47, 0X3047, 0X31C7, 0X32C7, 0X3447,
-  0X35C7, 0X36C7, 0X3847, 0X39C7, 0X3B47, 0X3C47, 0X3DC7, 0X3F46,
-  0X40C6, 0X4246, 0X43C6, 0X44C5, 0X4645, 0X47C5, 0X4944, 0X4A44,
-  0X4BC4, 0X4D43, 0X4E43, 0X4FC2, 0X50C2, 0X5241, 0X5341, 0X5440,
-  0X5540, 0X563F, 0X573E, 0X583E, 0X593D, 0X5A3C, 0X5B3B, 0X5C3A,
-  0X5CB9, 0X5DB8, 0X5EB7, 0X5F37, 0X6035, 0X60B4, 0X6133, 0X6232,
-  0X62B1, 0X632F, 0X63AE, 0X642C, 0X64AB, 0X65A9, 0X6627, 0X66A6,
-  0X6724, 0X6722, 0X67A0, 0X681E, 0X689C, 0X691A, 0X6998, 0X6996,
-  0X6A13, 0X6A91, 0X6B0F, 0X6B0D, 0X6B8A, 0X6C08, 0X6C06, 0X6C84,
-  0X6C81, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1201, 0X1203,
-  0X1286, 0X1309, 0X130B, 0X138D, 0X1390, 0X1413, 0X1495, 0X1518,
-  0X151A, 0X159D, 0X161F, 0X16A1, 0X16A4, 0X1726, 0X17A8, 0X182B,
-  0X18AD, 0X192F, 0X19B1, 0X1A33, 0X1AB5, 0X1B37, 0X1C38, 0X1CBA,
-  0X1D3C, 0X1DBD, 0X1EBF, 0X1F40, 0X2041, 0X20C2, 0X21C3, 0X2244,
-  0X2345, 0X2445, 0X24C6, 0X25C6, 0X26C7, 0X27C7, 0X28C8, 0X29C8,
-  0X2B48, 0X2C49, 0X2D49, 0X2EC9, 0X2FC9, 0X3149, 0X3249, 0X33C9,
-  0X3549, 0X36C9, 0X37C9, 0X3949, 0X3AC9, 0X3C49, 0X3DC9, 0X3F49,
-  0X40C8, 0X4248, 0X43C8, 0X4548, 0X46C7, 0X4847, 0X4947, 0X4AC6,
-  0X4C46, 0X4DC5, 0X4EC5, 0X5044, 0X5144, 0X52C3, 0X53C3, 0X54C2,
-  0X5642, 0X5741, 0X5840, 0X5940, 0X5A3F, 0X5B3E, 0X5BBD, 0X5CBD,
-  0X5DBC, 0X5E3B, 0X5F39, 0X6038, 0X60B7, 0X6136, 0X6235, 0X62B4,
-  0X6332, 0X63B1, 0X64B0, 0X652E, 0X65AC, 0X662B, 0X66A9, 0X6727,
-  0X67A6, 0X6823, 0X68A2, 0X6920, 0X691E, 0X699B, 0X6A19, 0X6A97,
-  0X6A95, 0X6B13, 0X6B90, 0X6C0E, 0X6C0C, 0X6C89, 0X6C87, 0X6D05,
-  0X6D83, 0X6D80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1182, 0X1185,
-  0X1207, 0X120A, 0X128C, 0X130F, 0X1312, 0X1394, 0X1417, 0X1419,
-  0X149C, 0X151E, 0X1521, 0X15A3, 0X1626, 0X16A8, 0X172A, 0X17AC,
-  0X182F, 0X18B1, 0X1933, 0X19B5, 0X1A37, 0X1AB9, 0X1B3B, 0X1BBC,
-  0X1C3E, 0X1D3F, 0X1DC1, 0X1EC2, 0X1F43, 0X2044, 0X20C5, 0X21C6,
-  0X2247, 0X2348, 0X2448, 0X2549, 0X2649, 0X274A, 0X284A, 0X294A,
-  0X2A4B, 0X2BCB, 0X2CCB, 0X2E4B, 0X2F4B, 0X30CB, 0X31CB, 0X334B,
-  0X34CB, 0X364B, 0X37CB, 0X394B, 0X3ACB, 0X3C4B, 0X3DCB, 0X3F4B,
-  0X40CA, 0X424A, 0X43CA, 0X454A, 0X46C9, 0X4849, 0X49C9, 0X4B48,
-  0X4CC8, 0X4E47, 0X4F47, 0X50C6, 0X51C6, 0X5345, 0X5445, 0X55C4,
-  0X56C4, 0X57C3, 0X58C2, 0X59C1, 0X5AC1, 0X5BC0, 0X5CBF, 0X5DBF,
-  0X5E3E, 0X5F3D, 0X603C, 0X60BA, 0X6139, 0X6238, 0X62B7, 0X63B6,
-  0X6434, 0X64B3, 0X6531, 0X65B0, 0X662E, 0X66AC, 0X672B, 0X67A9,
-  0X6827, 0X68A5, 0X6923, 0X69A1, 0X6A1F, 0X6A9D, 0X6A9B, 0X6B19,
-  0X6B96, 0X6B94, 0X6C12, 0X6C90, 0X6C8D, 0X6D0B, 0X6D89, 0X6D86,
-  0X6E04, 0X6E02, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1081, 0X1103, 0X1106,
-  0X1189, 0X118B, 0X120E, 0X1210, 0X1293, 0X1316, 0X1318, 0X139B,
-  0X141D, 0X1420, 0X14A2, 0X1525, 0X15A7, 0X162A, 0X162C, 0X16AE,
-  0X1731, 0X17B3, 0X1835, 0X18B7, 0X1939, 0X19BB, 0X1ABD, 0X1B3F,
-  0X1BC0, 0X1C41, 0X1D43, 0X1DC4, 0X1E46, 0X1F47, 0X2048, 0X20C8,
-  0X21C9, 0X22CA, 0X234B, 0X244B, 0X254C, 0X264C, 0X274C, 0X28CD,
-  0X29CD, 0X2ACD, 0X2C4D, 0X2D4E, 0X2ECE, 0X304E, 0X314E, 0X32CE,
-  0X344E, 0X35CE, 0X374E, 0X38CE, 0X3A4D, 0X3C4D, 0X3DCD, 0X3F4D,
-  0X40CD, 0X424C, 0X43CC, 0X45CC, 0X474C, 0X48CB, 0X4A4B, 0X4BCB,
-  0X4D4A, 0X4ECA, 0X4FC9, 0X5149, 0X52C8, 0X53C8, 0X5547, 0X5646,
-  0X5746, 0X58C5, 0X59C4, 0X5AC4, 0X5BC3, 0X5CC2, 0X5D41, 0X5E40,
-  0X5F3F, 0X603F, 0X60BE, 0X61BD, 0X623B, 0X62BA, 0X63B9, 0X6437,
-  0X64B6, 0X6535, 0X6633, 0X66B2, 0X6730, 0X67AE, 0X682C, 0X68AB,
-  0X6929, 0X69A7, 0X69A5, 0X6A23, 0X6AA1, 0X6B1F, 0X6B9C, 0X6B9A,
-  0X6C18, 0X6C95, 0X6C93, 0X6D11, 0X6D8E, 0X6D8C, 0X6E0A, 0X6E07,
-  0X6E85, 0X6E83, 0X6F00, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1002, 0X1004, 0X1087,
-  0X108A, 0X110D, 0X110F, 0X1192, 0X1214, 0X1217, 0X129A, 0X131C,
-  0X131F, 0X13A1, 0X1424, 0X14A6, 0X14A9, 0X152B, 0X15AD, 0X1630,
-  0X16B2, 0X1735, 0X17B7, 0X1839, 0X18BB, 0X193D, 0X19BF, 0X1A41,
-  0X1AC2, 0X1BC4, 0X1C45, 0X1CC7, 0X1DC8, 0X1E49, 0X1F4A, 0X204B,
-  0X20CC, 0X21CC, 0X22CD, 0X23CD, 0X24CE, 0X25CE, 0X26CF, 0X27CF,
-  0X294F, 0X2A4F, 0X2B4F, 0X2CD0, 0X2E50, 0X2FD0, 0X30D0, 0X3250,
-  0X33D0, 0X3550, 0X3750, 0X38D0, 0X3A4F, 0X3BCF, 0X3DCF, 0X3F4F,
-  0X40CF, 0X424F, 0X444E, 0X45CE, 0X474E, 0X48CD, 0X4ACD, 0X4C4D,
-  0X4DCC, 0X4F4C, 0X504B, 0X51CB, 0X534A, 0X54CA, 0X55C9, 0X56C8,
-  0X5848, 0X5947, 0X5A46, 0X5B46, 0X5C45, 0X5D44, 0X5E43, 0X5F42,
-  0X6041, 0X60C0, 0X61BF, 0X623F, 0X633D, 0X63BC, 0X643B, 0X6539,
-  0X65B8, 0X6637, 0X66B5, 0X6733, 0X67B2, 0X6830, 0X68AE, 0X692C,
-  0X69AA, 0X6A28, 0X6AA6, 0X6B24, 0X6B22, 0X6BA0, 0X6C1E, 0X6C9B,
-  0X6C99, 0X6D17, 0X6D94, 0X6D92, 0X6E10, 0X6E8D, 0X6E8B, 0X6F09,
-  0X6F06, 0X6F84, 0X6F81, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X0F00, 0X0F83, 0X0F86, 0X1008,
-  0X100B, 0X108E, 0X1090, 0X1113, 0X1116, 0X1198, 0X121B, 0X121D,
-  0X12A0, 0X1323, 0X1326, 0X13A8, 0X142B, 0X14AD, 0X14AF, 0X1532,
-  0X15B4, 0X1636, 0X16B9, 0X173B, 0X17BD, 0X183F, 0X18C1, 0X19C3,
-  0X1A44, 0X1AC6, 0X1B48, 0X1C49, 0X1CCA, 0X1DCB, 0X1E4C, 0X1F4D,
-  0X204E, 0X20CF, 0X21CF, 0X22D0, 0X23D0, 0X24D1, 0X25D1, 0X2751,
-  0X2851, 0X2952, 0X2AD2, 0X2C52, 0X2D52, 0X2ED2, 0X3052, 0X31D2,
-  0X3352, 0X3552, 0X36D2, 0X3852, 0X39D2, 0X3BD2, 0X3D51, 0X3F51,
-  0X40D1, 0X42D1, 0X4450, 0X4650, 0X47D0, 0X494F, 0X4ACF, 0X4CCF,
-  0X4E4E, 0X4FCE, 0X514D, 0X52CD, 0X53CC, 0X554C, 0X56CB, 0X57CB,
-  0X58CA, 0X5A49, 0X5B49, 0X5C48, 0X5D47, 0X5E46, 0X5F45, 0X6045,
-  0X60C3, 0X61C3, 0X6241, 0X6340, 0X63BF, 0X64BE, 0X653D, 0X65BB,
-  0X663A, 0X6738, 0X67B7, 0X6836, 0X68B4, 0X6932, 0X69B0, 0X6A2E,
-  0X6AAC, 0X6B2A, 0X6B28, 0X6BA6, 0X6C24, 0X6CA2, 0X6C9F, 0X6D1D,
-  0X6D9A, 0X6D98, 0X6E16, 0X6E93, 0X6E91, 0X6F0F, 0X6F0C, 0X6F8A,
-  0X6F87, 0X7005, 0X7002, 0X7080, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X0E81, 0X0E84, 0X0F07, 0X0F09,
-  0X0F8C, 0X0F8F, 0X1011, 0X1014, 0X1097, 0X111A, 0X111C, 0X119F,
-  0X1222, 0X1224, 0X12A7, 0X1329, 0X132C, 0X13AE, 0X1431, 0X14B3,
-  0X1536, 0X15B8, 0X163A, 0X16BD, 0X173F, 0X17C1, 0X1843, 0X18C5,
-  0X1946, 0X19C8, 0X1ACA, 0X1B4B, 0X1BCC, 0X1CCE, 0X1D4F, 0X1E4F,
-  0X1F50, 0X2051, 0X20D1, 0X21D2, 0X22D2, 0X23D3, 0X2553, 0X2653,
-  0X2754, 0X28D4, 0X29D4, 0X2B54, 0X2CD4, 0X2E54, 0X2FD4, 0X3154,
-  0X32D4, 0X34D4, 0X3654, 0X37D4, 0X39D4, 0X3B54, 0X3D53, 0X3F53,
-  0X40D3, 0X42D3, 0X44D2, 0X4652, 0X4852, 0X49D2, 0X4B51, 0X4D51,
-  0X4ED0, 0X5050, 0X51CF, 0X534F, 0X54CE, 0X564E, 0X574D, 0X58CD,
-  0X59CC, 0X5ACB, 0X5C4B, 0X5D4A, 0X5E49, 0X5F48, 0X6047, 0X60C7,
-  0X61C6, 0X62C5, 0X6343, 0X6442, 0X64C1, 0X6540, 0X663F, 0X66BD,
-  0X673C, 0X67BA, 0X6839, 0X68B7, 0X6936, 0X69B4, 0X6A32, 0X6AB0,
-  0X6B2E, 0X6BAC, 0X6C29, 0X6CA7, 0X6CA5, 0X6D23, 0X6DA0, 0X6D9E,
-  0X6E1C, 0X6E99, 0X6E97, 0X6F15, 0X6F92, 0X6F90, 0X700D, 0X700B,
-  0X7088, 0X7086, 0X7103, 0X7101, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X0E02, 0X0E05, 0X0E88, 0X0E8B,
-  0X0F0D, 0X0F10, 0X0F93, 0X0F95, 0X1018, 0X101B, 0X109E, 0X1120,
-  0X1123, 0X11A6, 0X11A8, 0X122B, 0X12AE, 0X1330, 0X1332, 0X13B5,
-  0X1438, 0X14BA, 0X153C, 0X15BF, 0X1641, 0X16C3, 0X1745, 0X17C7,
-  0X1849, 0X194A, 0X19CC, 0X1A4D, 0X1B4F, 0X1BD0, 0X1CD1, 0X1D52,
-  0X1E53, 0X1F53, 0X2054, 0X20D4, 0X21D5, 0X2355, 0X2455, 0X2556,
-  0X26D6, 0X27D6, 0X2956, 0X2AD6, 0X2BD6, 0X2D56, 0X2F56, 0X30D6,
-  0X3256, 0X3456, 0X35D6, 0X37D6, 0X3956, 0X3B56, 0X3D56, 0X3F55,
-  0X40D5, 0X42D5, 0X44D5, 0X46D4, 0X4854, 0X4A54, 0X4BD3, 0X4DD3,
-  0X4F52, 0X50D2, 0X52D2, 0X5451, 0X5551, 0X56D0, 0X584F, 0X594F,
-  0X5ACE, 0X5BCE, 0X5CCD, 0X5E4C, 0X5F4B, 0X604B, 0X60CA, 0X61C9,
-  0X62C8, 0X6347, 0X6446, 0X64C4, 0X65C3, 0X6642, 0X66C0, 0X67BF,
-  0X683E, 0X68BD, 0X693B, 0X69B9, 0X6A37, 0X6AB6, 0X6B33, 0X6BB1,
-  0X6C2F, 0X6CAD, 0X6CAB, 0X6D29, 0X6DA7, 0X6E24, 0X6E22, 0X6E9F,
-  0X6E9D, 0X6F1B, 0X6F98, 0X6F96, 0X7013, 0X7011, 0X708F, 0X708C,
-  0X7109, 0X7107, 0X7184, 0X7182, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X0D01, 0X0D83, 0X0D86, 0X0D89, 0X0E0C,
-  0X0E0E, 0X0E91, 0X0E94, 0X0F16, 0X0F19, 0X0F9C, 0X0F9F, 0X1021,
-  0X10A4, 0X10A7, 0X112A, 0X11AC, 0X11AF, 0X1231, 0X12B4, 0X1337,
-  0X13B9, 0X13BC, 0X143E, 0X14C0, 0X1543, 0X15C5, 0X1647, 0X16C9,
-  0X17CB, 0X184C, 0X18CE, 0X1950, 0X1A51, 0X1AD2, 0X1BD3, 0X1C54,
-  0X1D55, 0X1E55, 0X1F56, 0X2056, 0X2157, 0X2257, 0X2358, 0X2458,
-  0X25D8, 0X26D8, 0X2859, 0X29D9, 0X2B59, 0X2CD9, 0X2E59, 0X2FD9,
-  0X31D9, 0X3359, 0X3559, 0X3758, 0X3958, 0X3B58, 0X3D58, 0X3F57,
-  0X40D7, 0X42D7, 0X44D7, 0X46D6, 0X48D6, 0X4AD6, 0X4CD5, 0X4E55,
-  0X5054, 0X51D4, 0X5354, 0X54D3, 0X5653, 0X57D2, 0X5951, 0X5A51,
-  0X5BD0, 0X5CCF, 0X5DCF, 0X5ECE, 0X604D, 0X60CC, 0X61CB, 0X62CB,
-  0X63CA, 0X6449, 0X6547, 0X65C6, 0X66C5, 0X6744, 0X67C2, 0X6841,
-  0X6940, 0X69BE, 0X6A3D, 0X6ABB, 0X6B39, 0X6BB7, 0X6C35, 0X6C33,
-  0X6CB1, 0X6D2E, 0X6DAC, 0X6E2A, 0X6E28, 0X6EA6, 0X6F23, 0X6F21,
-  0X6F9E, 0X701C, 0X7019, 0X7097, 0X7094, 0X7112, 0X710F, 0X718D,
-  0X718A, 0X7208, 0X7205, 0X7203, 0X7280, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X0C81, 0X0C84, 0X0D07, 0X0D0A, 0X0D8D,
-  0X0D8F, 0X0D92, 0X0E15, 0X0E17, 0X0E9A, 0X0F1D, 0X0F20, 0X0FA3,
-  0X0FA6, 0X1028, 0X102B, 0X10AE, 0X1130, 0X11B3, 0X11B6, 0X1238,
-  0X12BB, 0X133E, 0X13C0, 0X13C2, 0X1445, 0X14C7, 0X1549, 0X164B,
-  0X16CD, 0X174F, 0X17D0, 0X1852, 0X1953, 0X19D4, 0X1AD5, 0X1B56,
-  0X1C57, 0X1D58, 0X1E58, 0X1ED9, 0X2059, 0X215A, 0X225A, 0X235A,
-  0X24DA, 0X25DB, 0X275B, 0X28DB, 0X2A5B, 0X2BDB, 0X2DDB, 0X2F5B,
-  0X315B, 0X32DB, 0X34DB, 0X36DB, 0X38DA, 0X3ADA, 0X3CDA, 0X3EDA,
-  0X415A, 0X4359, 0X4559, 0X4759, 0X4958, 0X4B58, 0X4D57, 0X4ED7,
-  0X50D6, 0X5256, 0X5456, 0X55D5, 0X5755, 0X58D4, 0X5A53, 0X5B53,
-  0X5CD2, 0X5DD1, 0X5ED1, 0X6050, 0X614F, 0X61CE, 0X62CE, 0X63CD,
-  0X64CC, 0X654B, 0X664A, 0X66C8, 0X67C7, 0X6846, 0X68C4, 0X6943,
-  0X69C1, 0X6AC0, 0X6B3E, 0X6BBD, 0X6C3B, 0X6C38, 0X6CB7, 0X6D34,
-  0X6DB2, 0X6E30, 0X6E2E, 0X6EAC, 0X6F29, 0X6FA7, 0X6FA4, 0X7022,
-  0X701F, 0X709D, 0X709A, 0X7118, 0X7195, 0X7193, 0X7210, 0X720E,
-  0X720B, 0X7289, 0X7286, 0X7303, 0X7301, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X0C02, 0X0C05, 0X0C08, 0X0C8B, 0X0C8E,
-  0X0D10, 0X0D13, 0X0D96, 0X0D99, 0X0E1C, 0X0E1E, 0X0EA1, 0X0EA4,
-  0X0F27, 0X0F29, 0X0FAC, 0X102F, 0X1032, 0X10B5, 0X1137, 0X113A,
-  0X11BC, 0X123F, 0X12C1, 0X1344, 0X13C7, 0X1449, 0X14CB, 0X154D,
-  0X15CF, 0X1651, 0X16D3, 0X1754, 0X1855, 0X18D7, 0X19D8, 0X1A59,
-  0X1B5A, 0X1C5A, 0X1CDB, 0X1DDB, 0X1EDC, 0X205C, 0X215C, 0X225D,
-  0X23DD, 0X24DD, 0X265D, 0X27DD, 0X295D, 0X2ADD, 0X2CDD, 0X2E5D,
-  0X305D, 0X325D, 0X345D, 0X365D, 0X385D, 0X3ADC, 0X3CDC, 0X3EDC,
-  0X415C, 0X435C, 0X455B, 0X47DB, 0X49DB, 0X4BDA, 0X4DDA, 0X4FD9,
-  0X51D9, 0X5359, 0X5558, 0X56D7, 0X5857, 0X59D6, 0X5B56, 0X5C55,
-  0X5DD4, 0X5ED4, 0X6053, 0X6152, 0X6251, 0X6351, 0X63D0, 0X64CF,
-  0X65CE, 0X664D, 0X674C, 0X67CB, 0X68C9, 0X6948, 0X69C6, 0X6A45,
-  0X6AC4, 0X6B42, 0X6BC0, 0X6C3E, 0X6CBD, 0X6D3A, 0X6DB8, 0X6E36,
-  0X6EB4, 0X6EB1, 0X6F2F, 0X6FAD, 0X6FAB, 0X7028, 0X70A6, 0X70A3,
-  0X7120, 0X711E, 0X719C, 0X7199, 0X7216, 0X7214, 0X7292, 0X728F,
-  0X730C, 0X730A, 0X7387, 0X7384, 0X7382, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0B00, 0X0B03, 0X0B86, 0X0B89, 0X0C0C, 0X0C0F,
-  0X0C11, 0X0C94, 0X0C97, 0X0D1A, 0X0D1C, 0X0D9F, 0X0DA2, 0X0E25,
-  0X0E28, 0X0EAB, 0X0EAE, 0X0F30, 0X0FB3, 0X0FB6, 0X1038, 0X10BB,
-  0X10BE, 0X1141, 0X11C3, 0X1246, 0X12C8, 0X134B, 0X13CD, 0X144F,
-  0X14D1, 0X1553, 0X15D5, 0X1656, 0X1758, 0X17D9, 0X18DA, 0X195B,
-  0X1A5C, 0X1ADC, 0X1BDD, 0X1CDD, 0X1DDE, 0X1EDE, 0X205E, 0X215E,
-  0X225F, 0X23DF, 0X255F, 0X26DF, 0X285F, 0X29DF, 0X2BDF, 0X2DDF,
-  0X2FDF, 0X31DF, 0X33DF, 0X35DF, 0X37DE, 0X3A5E, 0X3CDE, 0X3EDE,
-  0X415E, 0X435E, 0X45DD, 0X485D, 0X4A5D, 0X4C5C, 0X4E5C, 0X505C,
-  0X525B, 0X545B, 0X565A, 0X57DA, 0X5959, 0X5AD9, 0X5C58, 0X5DD7,
-  0X5ED6, 0X6056, 0X6155, 0X6254, 0X6353, 0X6453, 0X6552, 0X65D1,
-  0X66D0, 0X674F, 0X684E, 0X68CD, 0X69CB, 0X6A4A, 0X6AC8, 0X6B47,
-  0X6BC5, 0X6C44, 0X6CC2, 0X6D40, 0X6DBE, 0X6E3C, 0X6EBA, 0X6F38,
-  0X6F35, 0X6FB3, 0X7031, 0X702F, 0X70AC, 0X712A, 0X7127, 0X71A4,
-  0X71A2, 0X721F, 0X721D, 0X729A, 0X7297, 0X7315, 0X7312, 0X7390,
-  0X738D, 0X738A, 0X7408, 0X7405, 0X7482, 0X7480, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0A81, 0X0A84, 0X0B07, 0X0B0A, 0X0B0D, 0X0B90,
-  0X0B92, 0X0B95, 0X0C18, 0X0C1B, 0X0C9E, 0X0CA0, 0X0D23, 0X0D26,
-  0X0DA9, 0X0DAC, 0X0E2F, 0X0E32, 0X0EB5, 0X0F37, 0X0F3A, 0X0FBD,
-  0X1040, 0X1042, 0X10C5, 0X1148, 0X11CA, 0X124D, 0X12CF, 0X1352,
-  0X13D3, 0X1455, 0X14D7, 0X1559, 0X165A, 0X16DC, 0X175D, 0X185D,
-  0X18DE, 0X19DF, 0X1ADF, 0X1BDF, 0X1CDF, 0X1DDF, 0X1EDF, 0X205F,
-  0X2160, 0X22E0, 0X2460, 0X25E0, 0X2760, 0X28E0, 0X2AE0, 0X2CE0,
-  0X2EE0, 0X30E0, 0X32E0, 0X3560, 0X375F, 0X39DF, 0X3C5F, 0X3EDF,
-  0X415F, 0X43DF, 0X465F, 0X48DF, 0X4ADF, 0X4D5E, 0X4F5E, 0X515E,
-  0X535D, 0X555D, 0X575C, 0X58DC, 0X5A5B, 0X5BDB, 0X5D5A, 0X5EDA,
-  0X6059, 0X6158, 0X6257, 0X6356, 0X6456, 0X6555, 0X6654, 0X6753,
-  0X67D2, 0X68D1, 0X6950, 0X69CF, 0X6ACD, 0X6B4C, 0X6BCB, 0X6C49,
-  0X6CC8, 0X6D46, 0X6DC4, 0X6E42, 0X6EC0, 0X6F3E, 0X6FBC, 0X6FB9,
-  0X7037, 0X70B4, 0X70B2, 0X7130, 0X71AD, 0X71AB, 0X7228, 0X7226,
-  0X72A3, 0X72A0, 0X731E, 0X731B, 0X7399, 0X7396, 0X7413, 0X7411,
-  0X740E, 0X748B, 0X7489, 0X7486, 0X7503, 0X7501, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0A02, 0X0A05, 0X0A08, 0X0A8A, 0X0A8D, 0X0A90,
-  0X0B13, 0X0B16, 0X0B19, 0X0B9C, 0X0B9F, 0X0C21, 0X0C24, 0X0CA7,
-  0X0CAA, 0X0D2D, 0X0D30, 0X0DB3, 0X0DB6, 0X0E39, 0X0EBB, 0X0EBF,
-  0X0F41, 0X0FC4, 0X0FC7, 0X104A, 0X10CC, 0X114F, 0X11D1, 0X1253,
-  0X12D5, 0X1358, 0X13DA, 0X145B, 0X14DD, 0X15DE, 0X165F, 0X16DF,
-  0X17DF, 0X18E0, 0X1960, 0X1A61, 0X1B61, 0X1C61, 0X1DE1, 0X1EE2,
-  0X2062, 0X2162, 0X22E2, 0X2462, 0X25E2, 0X27E2, 0X29E2, 0X2BE2,
-  0X2DE2, 0X2FE2, 0X3262, 0X3462, 0X36E1, 0X3961, 0X3C61, 0X3EE1,
-  0X4161, 0X43E1, 0X46E0, 0X4960, 0X4BE0, 0X4DE0, 0X505F, 0X525F,
-  0X545F, 0X565F, 0X585E, 0X5A5E, 0X5BDD, 0X5D5D, 0X5EDC, 0X605C,
-  0X615B, 0X625A, 0X63DA, 0X64D9, 0X65D8, 0X66D7, 0X6756, 0X6855,
-  0X6954, 0X69D3, 0X6A52, 0X6B51, 0X6BCF, 0X6C4E, 0X6CCC, 0X6D4B,
-  0X6DC9, 0X6E48, 0X6EC6, 0X6F43, 0X6FC1, 0X703F, 0X703D, 0X70BB,
-  0X7138, 0X7136, 0X71B3, 0X7231, 0X722E, 0X72AC, 0X72A9, 0X7327,
-  0X7324, 0X73A2, 0X739F, 0X741C, 0X7419, 0X7497, 0X7494, 0X7492,
-  0X750F, 0X750C, 0X7509, 0X7587, 0X7584, 0X7581, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0903, 0X0985, 0X0988, 0X098B, 0X0A0E, 0X0A11,
-  0X0A14, 0X0A97, 0X0A9A, 0X0A9D, 0X0B20, 0X0B22, 0X0BA5, 0X0BA8,
-  0X0C2B, 0X0C2E, 0X0CB1, 0X0CB4, 0X0D37, 0X0D3A, 0X0DBD, 0X0E40,
-  0X0E42, 0X0EC5, 0X0F48, 0X0F4B, 0X0FCE, 0X1051, 0X10D3, 0X1156,
-  0X11D8, 0X125A, 0X12DC, 0X135D, 0X13DF, 0X145F, 0X1560, 0X15E1,
-  0X16E2, 0X1762, 0X1862, 0X1963, 0X1A63, 0X1B63, 0X1C63, 0X1D64,
-  0X1EE4, 0X2064, 0X2164, 0X2364, 0X24E4, 0X2664, 0X2864, 0X2A64,
-  0X2CE3, 0X2EE3, 0X3163, 0X33E3, 0X3663, 0X3963, 0X3BE2, 0X3EE2,
-  0X4162, 0X4462, 0X46E2, 0X49E2, 0X4C62, 0X4EE2, 0X5161, 0X5361,
-  0X55E1, 0X57E0, 0X59E0, 0X5B5F, 0X5CDF, 0X5EDF, 0X605E, 0X615E,
-  0X62DD, 0X63DD, 0X64DC, 0X65DB, 0X66DA, 0X67DA, 0X68D8, 0X6957,
-  0X6A56, 0X6AD5, 0X6BD4, 0X6C53, 0X6CD1, 0X6D50, 0X6DCF, 0X6E4D,
-  0X6ECB, 0X6F4A, 0X6FC8, 0X7045, 0X70C3, 0X70C1, 0X713F, 0X71BC,
-  0X71BA, 0X7237, 0X72B5, 0X72B2, 0X7330, 0X732D, 0X73AB, 0X73A8,
-  0X7425, 0X7423, 0X74A0, 0X749D, 0X751A, 0X7518, 0X7515, 0X7592,
-  0X7590, 0X758D, 0X760A, 0X7607, 0X7605, 0X7682, 0X007F, 0X007F,
-  0X007F, 0X0880, 0X0883, 0X0886, 0X0909, 0X090C, 0X090F, 0X0992,
-  0X0995, 0X0998, 0X0A1A, 0X0A1D, 0X0A20, 0X0AA3, 0X0AA6, 0X0B29,
-  0X0B2C, 0X0BAF, 0X0BB2, 0X0C35, 0X0C38, 0X0CBB, 0X0CBE, 0X0D41,
-  0X0D44, 0X0DC7, 0X0E4A, 0X0E4D, 0X0ECF, 0X0F52, 0X0FD5, 0X1058,
-  0X105A, 0X10DC, 0X115E, 0X1260, 0X12E1, 0X1362, 0X13E3, 0X14E3,
-  0X1564, 0X1665, 0X16E5, 0X17E5, 0X18E5, 0X19E6, 0X1AE6, 0X1BE6,
-  0X1D66, 0X1EE6, 0X2066, 0X21E6, 0X2366, 0X2566, 0X2766, 0X2966,
-  0X2B66, 0X2DE6, 0X3065, 0X32E5, 0X35E5, 0X38E5, 0X3B65, 0X3E64,
-  0X41E4, 0X44E4, 0X4763, 0X4A63, 0X4D63, 0X4FE2, 0X5262, 0X54E2,
-  0X56E2, 0X58E2, 0X5AE2, 0X5CE1, 0X5E61, 0X6061, 0X6160, 0X62E0,
-  0X645F, 0X655E, 0X665E, 0X675D, 0X685C, 0X695C, 0X69DB, 0X6ADA,
-  0X6B59, 0X6C57, 0X6CD6, 0X6D55, 0X6DD3, 0X6ED2, 0X6F50, 0X6FCF,
-  0X6FCD, 0X704B, 0X70C9, 0X7147, 0X71C5, 0X71C2, 0X7240, 0X72BE,
-  0X72BB, 0X7338, 0X7336, 0X73B4, 0X73B1, 0X742E, 0X742C, 0X74A9,
-  0X74A6, 0X7523, 0X7521, 0X759E, 0X759B, 0X7598, 0X7616, 0X7613,
-  0X7610, 0X768E, 0X768B, 0X7688, 0X7705, 0X7703, 0X7700, 0X007F,
-  0X007F, 0X0801, 0X0804, 0X0807, 0X080A, 0X088D, 0X0890, 0X0893,
-  0X0915, 0X0918, 0X091B, 0X099E, 0X09A1, 0X09A4, 0X0A27, 0X0A2A,
-  0X0A2D, 0X0AB0, 0X0AB3, 0X0B36, 0X0B39, 0X0BBC, 0X0BBF, 0X0C42,
-  0X0C45, 0X0CC8, 0X0D4B, 0X0D4E, 0X0DD1, 0X0E54, 0X0ED7, 0X0EDA,
-  0X0F5C, 0X0FDE, 0X1060, 0X10E2, 0X1163, 0X11E4, 0X12E5, 0X1366,
-  0X13E7, 0X14E7, 0X1568, 0X1668, 0X1768, 0X1868, 0X1968, 0X1A69,
-  0X1BE9, 0X1CE9, 0X1E69, 0X2069, 0X21E9, 0X23E9, 0X25E8, 0X27E8,
-  0X29E8, 0X2C68, 0X2F68, 0X31E8, 0X34E7, 0X37E7, 0X3B67, 0X3E67,
-  0X41E6, 0X44E6, 0X4866, 0X4B66, 0X4E65, 0X50E5, 0X53E4, 0X5664,
-  0X5863, 0X5A63, 0X5C63, 0X5E62, 0X6062, 0X61E2, 0X6362, 0X6462,
-  0X65E1, 0X66E1, 0X67E0, 0X68DF, 0X69DE, 0X6ADE, 0X6B5D, 0X6C5C,
-  0X6CDB, 0X6D5A, 0X6E59, 0X6ED7, 0X6F56, 0X6FD4, 0X7053, 0X70D1,
-  0X714F, 0X714D, 0X71CB, 0X7249, 0X72C7, 0X72C4, 0X7342, 0X73BF,
-  0X73BD, 0X743A, 0X7437, 0X74B5, 0X74B2, 0X7530, 0X752D, 0X75AA,
-  0X75A7, 0X75A4, 0X7622, 0X761F, 0X761C, 0X7699, 0X7697, 0X7694,
-  0X7711, 0X770E, 0X770C, 0X7789, 0X7786, 0X7783, 0X7781, 0X007F,
-  0X007F, 0X0701, 0X0784, 0X0787, 0X078A, 0X078D, 0X0810, 0X0813,
-  0X0816, 0X0819, 0X089C, 0X089F, 0X08A2, 0X0925, 0X0928, 0X092B,
-  0X09AE, 0X09B1, 0X0A34, 0X0A37, 0X0ABA, 0X0ABD, 0X0B40, 0X0B43,
-  0X0BC6, 0X0BCA, 0X0C4D, 0X0C50, 0X0CD3, 0X0D56, 0X0D59, 0X0DDB,
-  0X0E5E, 0X0EDF, 0X0F62, 0X0FE4, 0X1066, 0X10E7, 0X1168, 0X11E9,
-  0X12E9, 0X136A, 0X146A, 0X14EA, 0X15EB, 0X16EB, 0X17EB, 0X18EB,
-  0X1A6B, 0X1B6B, 0X1CEB, 0X1E6B, 0X206B, 0X21EB, 0X23EB, 0X266B,
-  0X286A, 0X2B6A, 0X2DEA, 0X30EA, 0X33EA, 0X3769, 0X3AE9, 0X3E69,
-  0X41E9, 0X4568, 0X48E8, 0X4C68, 0X4F67, 0X5267, 0X54E6, 0X57E6,
-  0X59E6, 0X5C65, 0X5E65, 0X6064, 0X61E4, 0X6363, 0X64E3, 0X65E2,
-  0X6762, 0X6862, 0X6962, 0X6A61, 0X6B60, 0X6BE0, 0X6CDF, 0X6D5E,
-  0X6E5D, 0X6EDC, 0X6F5B, 0X6FD9, 0X7058, 0X70D6, 0X7154, 0X71D3,
-  0X7251, 0X72CF, 0X72CD, 0X734A, 0X73C8, 0X73C6, 0X7443, 0X7440,
-  0X74BE, 0X74BB, 0X7538, 0X7536, 0X75B3, 0X75B1, 0X762E, 0X762B,
-  0X76A8, 0X76A5, 0X76A2, 0X7720, 0X771D, 0X771A, 0X7797, 0X7795,
-  0X7792, 0X778F, 0X780C, 0X7809, 0X7807, 0X7804, 0X7881, 0X007F,
-  0X007F, 0X0682, 0X0685, 0X0708, 0X070B, 0X070E, 0X0711, 0X0714,
-  0X0797, 0X079A, 0X079C, 0X081F, 0X0823, 0X0826, 0X08A9, 0X08AC,
-  0X08AF, 0X0932, 0X0935, 0X0938, 0X09BB, 0X09BE, 0X0A41, 0X0A44,
-  0X0AC8, 0X0ACB, 0X0B4E, 0X0B51, 0X0BD4, 0X0C57, 0X0C5A, 0X0CDD,
-  0X0D5F, 0X0DE1, 0X0DE4, 0X0E67, 0X0EE9, 0X0F6A, 0X0FEB, 0X106B,
-  0X116C, 0X11EC, 0X12ED, 0X136D, 0X146D, 0X156D, 0X166D, 0X176D,
-  0X186D, 0X19ED, 0X1AED, 0X1C6D, 0X1E6D, 0X206D, 0X226D, 0X246D,
-  0X26ED, 0X296D, 0X2C6D, 0X2FEC, 0X32EC, 0X366C, 0X3A6C, 0X3E6B,
-  0X41EB, 0X45EB, 0X49EA, 0X4D6A, 0X506A, 0X53E9, 0X56E9, 0X5969,
-  0X5BE8, 0X5DE8, 0X6067, 0X61E7, 0X63E6, 0X6566, 0X6665, 0X67E5,
-  0X68E4, 0X69E3, 0X6AE3, 0X6BE2, 0X6CE2, 0X6D62, 0X6E61, 0X6EE0,
-  0X6FDF, 0X705E, 0X70DD, 0X715C, 0X71DA, 0X7259, 0X7257, 0X72D5,
-  0X7353, 0X73D1, 0X73CF, 0X744C, 0X74CA, 0X74C7, 0X7545, 0X7542,
-  0X75BF, 0X75BC, 0X763A, 0X7637, 0X76B4, 0X76B2, 0X76AF, 0X772C,
-  0X7729, 0X7726, 0X77A3, 0X77A1, 0X779E, 0X781B, 0X7818, 0X7815,
-  0X7892, 0X7890, 0X788D, 0X788A, 0X7887, 0X7904, 0X7901, 0X007F,
-  0X007F, 0X0602, 0X0605, 0X0608, 0X060B, 0X068E, 0X0691, 0X0694,
-  0X0697, 0X071A, 0X071D, 0X0720, 0X0723, 0X07A6, 0X07A9, 0X07AC,
-  0X0830, 0X0833, 0X0836, 0X08B9, 0X08BC, 0X08BF, 0X0942, 0X0945,
-  0X09C9, 0X09CC, 0X0A4F, 0X0A52, 0X0AD5, 0X0AD9, 0X0B5C, 0X0BDE,
-  0X0BE0, 0X0C63, 0X0CE6, 0X0D69, 0X0DEB, 0X0E6C, 0X0EED, 0X0F6E,
-  0X0FEE, 0X106F, 0X10EF, 0X11EF, 0X1270, 0X1370, 0X1470, 0X1570,
-  0X1670, 0X17F0, 0X18F0, 0X1A70, 0X1C70, 0X1DF0, 0X2070, 0X226F,
-  0X24EF, 0X27EF, 0X2AEF, 0X2DEF, 0X31EE, 0X35EE, 0X39EE, 0X3DEE,
-  0X426D, 0X466D, 0X4A6D, 0X4E6C, 0X526C, 0X556C, 0X586B, 0X5B6B,
-  0X5DEA, 0X606A, 0X6269, 0X63E9, 0X65E8, 0X6768, 0X6867, 0X69E7,
-  0X6AE6, 0X6BE5, 0X6CE5, 0X6DE4, 0X6E63, 0X6F62, 0X6FE2, 0X7062,
-  0X70E1, 0X7160, 0X71DF, 0X725D, 0X72DC, 0X735B, 0X73D9, 0X7457,
-  0X7455, 0X74D2, 0X7550, 0X754E, 0X75CB, 0X75C8, 0X7646, 0X7643,
-  0X76C0, 0X76BE, 0X773B, 0X7738, 0X7735, 0X77B2, 0X77B0, 0X77AD,
-  0X782A, 0X7827, 0X7824, 0X78A1, 0X789E, 0X789B, 0X7899, 0X7916,
-  0X7913, 0X7910, 0X790D, 0X798A, 0X7988, 0X7985, 0X7982, 0X007F,
-  0X007F, 0X0583, 0X0586, 0X0589, 0X058C, 0X058F, 0X0592, 0X0615,
-  0X0618, 0X061B, 0X061E, 0X06A1, 0X06A4, 0X06A7, 0X06AA, 0X072D,
-  0X0730, 0X0733, 0X07B6, 0X07BA, 0X07BD, 0X0840, 0X0843, 0X0846,
-  0X08CA, 0X08CD, 0X0950, 0X0953, 0X09D6, 0X09DA, 0X0A5D, 0X0A5F,
-  0X0AE2, 0X0B65, 0X0B68, 0X0BEB, 0X0C6E, 0X0CEF, 0X0D70, 0X0DF1,
-  0X0E71, 0X0EF2, 0X0F72, 0X1072, 0X10F2, 0X11F2, 0X1272, 0X1373,
-  0X1473, 0X15F3, 0X16F2, 0X1872, 0X19F2, 0X1BF2, 0X1DF2, 0X2072,
-  0X22F2, 0X2572, 0X28F1, 0X2C71, 0X3071, 0X3471, 0X38F0, 0X3DF0,
-  0X4270, 0X476F, 0X4BEF, 0X4FEF, 0X53EE, 0X576E, 0X5AEE, 0X5D6D,
-  0X606D, 0X626C, 0X646C, 0X666B, 0X67EB, 0X696A, 0X6A6A, 0X6BE9,
-  0X6CE8, 0X6DE8, 0X6E67, 0X6F66, 0X6FE6, 0X70E5, 0X7164, 0X71E3,
-  0X7262, 0X72E2, 0X7361, 0X73E0, 0X745E, 0X74DC, 0X74DB, 0X7559,
-  0X75D6, 0X75D4, 0X7652, 0X764F, 0X76CD, 0X76CA, 0X7747, 0X7744,
-  0X77C1, 0X77BF, 0X77BC, 0X7839, 0X7836, 0X7833, 0X78B0, 0X78AD,
-  0X78AB, 0X7928, 0X7925, 0X7922, 0X791F, 0X799C, 0X7999, 0X7996,
-  0X7994, 0X7A11, 0X7A0E, 0X7A0B, 0X7A08, 0X7A05, 0X7A02, 0X007F,
-  0X0480, 0X0483, 0X0486, 0X0509, 0X050C, 0X050F, 0X0512, 0X0515,
-  0X0518, 0X059B, 0X059E, 0X05A1, 0X05A4, 0X0627, 0X062A, 0X062E,
-  0X0631, 0X06B4, 0X06B7, 0X06BA, 0X06BE, 0X0740, 0X0744, 0X0747,
-  0X07CA, 0X07CE, 0X0851, 0X0854, 0X0858, 0X08DB, 0X08DE, 0X0960,
-  0X09E3, 0X09E7, 0X0A6A, 0X0A6D, 0X0AF0, 0X0B72, 0X0BF3, 0X0C73,
-  0X0CF4, 0X0D74, 0X0DF4, 0X0E74, 0X0EF4, 0X0FF5, 0X1075, 0X1175,
-  0X1275, 0X1375, 0X14F5, 0X1675, 0X17F5, 0X1975, 0X1B75, 0X1D75,
-  0X2075, 0X22F4, 0X2674, 0X29F4, 0X2E74, 0X32F3, 0X37F3, 0X3D73,
-  0X42F2, 0X4872, 0X4D72, 0X51F1, 0X5671, 0X59F0, 0X5D70, 0X6070,
-  0X62EF, 0X64EF, 0X66EE, 0X686E, 0X69ED, 0X6B6D, 0X6CEC, 0X6DEC,
-  0X6EEB, 0X6FEA, 0X706A, 0X7169, 0X71E8, 0X7267, 0X72E6, 0X7365,
-  0X73E4, 0X7463, 0X74E2, 0X7562, 0X75E0, 0X75DE, 0X765D, 0X765B,
-  0X76D8, 0X7756, 0X7753, 0X77D1, 0X77CE, 0X77CB, 0X7848, 0X7845,
-  0X78C3, 0X78C0, 0X78BD, 0X793A, 0X7937, 0X7934, 0X7931, 0X79AE,
-  0X79AB, 0X79A8, 0X79A5, 0X7A22, 0X7A1F, 0X7A1C, 0X7A1A, 0X7A97,
-  0X7A94, 0X7A91, 0X7A8E, 0X7A8B, 0X7A88, 0X7B05, 0X7B03, 0X7B00,
-  0X0401, 0X0404, 0X0406, 0X0409, 0X040C, 0X048F, 0X0492, 0X0496,
-  0X0498, 0X049C, 0X049E, 0X0521, 0X0525, 0X0528, 0X052B, 0X052E,
-  0X05B1, 0X05B4, 0X05B8, 0X05BB, 0X063E, 0X0641, 0X0644, 0X0648,
-  0X06CB, 0X06CE, 0X06D2, 0X0755, 0X0759, 0X07DC, 0X07DE, 0X0861,
-  0X0864, 0X08E8, 0X08EC, 0X096F, 0X0973, 0X09F5, 0X0A75, 0X0AF6,
-  0X0AF6, 0X0B76, 0X0BF7, 0X0CF7, 0X0D77, 0X0DF7, 0X0E78, 0X0F78,
-  0X1079, 0X1179, 0X1279, 0X13F9, 0X14F9, 0X16F9, 0X1879, 0X1AF8,
-  0X1D78, 0X2077, 0X2377, 0X2777, 0X2BF7, 0X3176, 0X36F6, 0X3CF6,
-  0X4375, 0X4975, 0X4EF5, 0X5474, 0X58F4, 0X5CF3, 0X6073, 0X62F2,
-  0X6572, 0X67F1, 0X6971, 0X6B70, 0X6C70, 0X6DEF, 0X6EEF, 0X6FEE,
-  0X70ED, 0X71ED, 0X726C, 0X72EB, 0X736A, 0X746A, 0X74E9, 0X7568,
-  0X7567, 0X75E6, 0X7664, 0X76E3, 0X76E2, 0X7761, 0X775E, 0X77DC,
-  0X77DA, 0X7858, 0X7855, 0X78D2, 0X78CF, 0X794C, 0X794A, 0X7946,
-  0X79C4, 0X79C0, 0X79BE, 0X79BB, 0X7A38, 0X7A35, 0X7A32, 0X7A2F,
-  0X7AAC, 0X7AA9, 0X7AA6, 0X7AA3, 0X7AA0, 0X7B1D, 0X7B1A, 0X7B17,
-  0X7B14, 0X7B11, 0X7B0F, 0X7B8C, 0X7B89, 0X7B86, 0X7B83, 0X7B80,
-  0X0381, 0X0384, 0X0387, 0X038A, 0X038D, 0X0390, 0X0393, 0X0396,
-  0X0419, 0X041C, 0X041F, 0X0422, 0X0425, 0X0428, 0X04AB, 0X04AE,
-  0X04B2, 0X04B5, 0X04B8, 0X053B, 0X053F, 0X0541, 0X0545, 0X0548,
-  0X05CC, 0X05CF, 0X05D2, 0X0656, 0X065A, 0X065D, 0X06DF, 0X06E2,
-  0X0766, 0X0769, 0X07ED, 0X07F1, 0X0875, 0X0878, 0X08F8, 0X08F9,
-  0X097A, 0X09FB, 0X0A7C, 0X0AFD, 0X0B7E, 0X0BFE, 0X0C7E, 0X0D7E,
-  0X0DFE, 0X0EFE, 0X0FFE, 0X10FE, 0X127E, 0X13FE, 0X157E, 0X177E,
-  0X19FE, 0X1CFE, 0X207E, 0X247D, 0X28FD, 0X2EFC, 0X357B, 0X3C7A,
-  0X43F8, 0X4AF8, 0X5177, 0X5777, 0X5BF6, 0X6076, 0X6376, 0X6675,
-  0X68F5, 0X6AF4, 0X6C74, 0X6DF3, 0X6F72, 0X7072, 0X7171, 0X7270,
-  0X72F0, 0X73EF, 0X746F, 0X74EE, 0X756D, 0X75EC, 0X766B, 0X76EA,
-  0X7769, 0X7768, 0X77E7, 0X77E6, 0X7864, 0X7862, 0X78E1, 0X78DE,
-  0X795C, 0X7959, 0X79D6, 0X79D3, 0X79D1, 0X7A4E, 0X7A4B, 0X7A48,
-  0X7AC5, 0X7AC1, 0X7ABF, 0X7ABC, 0X7AB9, 0X7B36, 0X7B33, 0X7B30,
-  0X7B2C, 0X7B2A, 0X7BA6, 0X7BA3, 0X7BA0, 0X7B9E, 0X7B9B, 0X7B98,
-  0X7C15, 0X7C12, 0X7C0F, 0X7C0C, 0X7C09, 0X7C06, 0X7C03, 0X7C01,
-  0X0281, 0X0284, 0X0287, 0X030A, 0X030D, 0X0310, 0X0313, 0X0316,
-  0X0319, 0X031C, 0X031F, 0X0322, 0X03A5, 0X03A8, 0X03AC, 0X03AF,
-  0X03B2, 0X03B5, 0X0438, 0X043C, 0X043F, 0X0442, 0X0445, 0X04C9,
-  0X04CC, 0X04CF, 0X04D3, 0X04D6, 0X055A, 0X055D, 0X055F, 0X05E3,
-  0X05E6, 0X05EA, 0X066E, 0X0672, 0X06F7, 0X06FB, 0X077D, 0X077E,
-  0X07FE, 0X087F, 0X087F, 0X08FF, 0X097F, 0X09FF, 0X0A7F, 0X0AFF,
-  0X0BFF, 0X0C7F, 0X0D7F, 0X0E7F, 0X0F7F, 0X107F, 0X127F, 0X13FF,
-  0X167F, 0X18FF, 0X1BFF, 0X207E, 0X257E, 0X2B7E, 0X32FE, 0X3B7E,
-  0X44FE, 0X4D7E, 0X54FD, 0X5AFC, 0X607B, 0X647A, 0X6779, 0X69F8,
-  0X6C77, 0X6DF7, 0X6FF6, 0X70F6, 0X71F5, 0X72F4, 0X73F4, 0X7473,
-  0X7572, 0X75F2, 0X7671, 0X76F0, 0X7770, 0X77EF, 0X77EE, 0X786D,
-  0X78EC, 0X78EB, 0X7969, 0X7968, 0X79E6, 0X79E4, 0X7A62, 0X7A60,
-  0X7A5E, 0X7ADB, 0X7AD8, 0X7AD5, 0X7B52, 0X7B4F, 0X7B4C, 0X7B49,
-  0X7B45, 0X7BC2, 0X7BBF, 0X7BBD, 0X7BB9, 0X7BB6, 0X7C33, 0X7C30,
-  0X7C2D, 0X7C2A, 0X7C27, 0X7C24, 0X7CA1, 0X7C9E, 0X7C9B, 0X7C98,
-  0X7C95, 0X7C92, 0X7C8F, 0X7C8C, 0X7C89, 0X7D06, 0X7D03, 0X7D01,
-  0X0201, 0X0204, 0X0207, 0X020A, 0X020D, 0X0210, 0X0213, 0X0296,
-  0X0299, 0X029C, 0X029F, 0X02A2, 0X02A5, 0X02A8, 0X02AC, 0X02AF,
-  0X02B2, 0X0335, 0X0338, 0X033C, 0X033F, 0X0342, 0X0345, 0X03C9,
-  0X03CC, 0X03D0, 0X03D3, 0X03D7, 0X045A, 0X045E, 0X0460, 0X0463,
-  0X04E7, 0X04EB, 0X04EF, 0X04F3, 0X0578, 0X057E, 0X05FF, 0X05FF,
-  0X067F, 0X067F, 0X06FF, 0X06FF, 0X077F, 0X07FF, 0X087F, 0X08FF,
-  0X097F, 0X09FF, 0X0A7F, 0X0B7F, 0X0C7F, 0X0D7F, 0X0E7F, 0X0FFF,
-  0X11FF, 0X147F, 0X177F, 0X1AFF, 0X207F, 0X26FF, 0X2FFF, 0X3A7F,
-  0X45FF, 0X507F, 0X597F, 0X607F, 0X657E, 0X68FE, 0X6BFE, 0X6E7D,
-  0X707C, 0X71FA, 0X72F9, 0X73F8, 0X74F8, 0X75F7, 0X7676, 0X76F5,
-  0X7775, 0X77F4, 0X7873, 0X78F3, 0X7972, 0X7971, 0X79F0, 0X79EF,
-  0X7A6E, 0X7A6D, 0X7AEC, 0X7AEA, 0X7B69, 0X7B67, 0X7B64, 0X7B62,
-  0X7BDF, 0X7BDC, 0X7BD9, 0X7BD6, 0X7C53, 0X7C50, 0X7C4D, 0X7C49,
-  0X7C46, 0X7CC3, 0X7CC0, 0X7CBD, 0X7CBA, 0X7CB7, 0X7CB4, 0X7D31,
-  0X7D2D, 0X7D2A, 0X7D27, 0X7D24, 0X7D21, 0X7D1E, 0X7D1B, 0X7D18,
-  0X7D15, 0X7D92, 0X7D8F, 0X7D8C, 0X7D8A, 0X7D86, 0X7D84, 0X7D81,
-  0X0181, 0X0184, 0X0187, 0X018A, 0X018D, 0X0190, 0X0193, 0X0196,
-  0X0199, 0X019C, 0X019F, 0X01A2, 0X01A6, 0X0229, 0X022C, 0X022F,
-  0X0232, 0X0235, 0X0239, 0X023C, 0X023F, 0X0242, 0X0245, 0X02C9,
-  0X02CC, 0X02D0, 0X02D3, 0X02D7, 0X02DA, 0X02DE, 0X0360, 0X0363,
-  0X0367, 0X036B, 0X036F, 0X03F3, 0X03F8, 0X03FD, 0X03FE, 0X047E,
-  0X047D, 0X04FD, 0X04FD, 0X04FD, 0X057D, 0X057D, 0X05FD, 0X067D,
-  0X06FD, 0X06FD, 0X077D, 0X087D, 0X08FD, 0X09FE, 0X0A7E, 0X0BFE,
-  0X0D7E, 0X0EFE, 0X117E, 0X14FE, 0X197F, 0X207F, 0X29FF, 0X37FF,
-  0X487F, 0X567F, 0X607F, 0X66FF, 0X6B7F, 0X6EFF, 0X717F, 0X72FF,
-  0X747F, 0X75FE, 0X767E, 0X777D, 0X77FC, 0X78FA, 0X7979, 0X7978,
-  0X79F8, 0X7A77, 0X7AF6, 0X7AF5, 0X7B74, 0X7B74, 0X7B73, 0X7BF2,
-  0X7BF1, 0X7C70, 0X7C6E, 0X7C6D, 0X7C6B, 0X7CE9, 0X7CE5, 0X7CE2,
-  0X7CE1, 0X7CDD, 0X7D5A, 0X7D57, 0X7D54, 0X7D51, 0X7D4D, 0X7D4A,
-  0X7D47, 0X7DC4, 0X7DC0, 0X7DBE, 0X7DBA, 0X7DB7, 0X7DB4, 0X7DB1,
-  0X7DAE, 0X7DAB, 0X7DA7, 0X7E24, 0X7E21, 0X7E1E, 0X7E1C, 0X7E19,
-  0X7E16, 0X7E13, 0X7E10, 0X7E0D, 0X7E0A, 0X7E07, 0X7E04, 0X7E01,
-  0X0081, 0X0084, 0X0087, 0X010A, 0X010D, 0X0110, 0X0113, 0X0116,
-  0X0119, 0X011C, 0X011F, 0X0122, 0X0126, 0X0129, 0X012C, 0X012F,
-  0X0132, 0X0135, 0X0139, 0X013C, 0X013F, 0X0142, 0X0145, 0X01C9,
-  0X01CC, 0X01D0, 0X01D3, 0X01D7, 0X01DA, 0X01DE, 0X01E0, 0X01E3,
-  0X01E7, 0X026B, 0X026F, 0X0273, 0X0277, 0X0279, 0X0278, 0X0278,
-  0X02F8, 0X02F8, 0X02F8, 0X02F8, 0X0378, 0X0378, 0X0378, 0X03F8,
-  0X03F8, 0X0478, 0X04F8, 0X04F8, 0X0578, 0X05F8, 0X0679, 0X0779,
-  0X0879, 0X0979, 0X0AFA, 0X0D7A, 0X107B, 0X167C, 0X207C, 0X32FD,
-  0X4D7D, 0X607E, 0X69FE, 0X6FFE, 0X72FF, 0X757F, 0X76FF, 0X77FF,
-  0X78FF, 0X79FF, 0X7A7F, 0X7AFF, 0X7B7F, 0X7B7F, 0X7BFE, 0X7C7D,
-  0X7C7B, 0X7CFA, 0X7CF9, 0X7CF8, 0X7D77, 0X7D76, 0X7D75, 0X7D74,
-  0X7DF3, 0X7DF2, 0X7DF1, 0X7DEF, 0X7DED, 0X7DEA, 0X7DE7, 0X7E64,
-  0X7E61, 0X7E5F, 0X7E5B, 0X7E58, 0X7E55, 0X7E51, 0X7E4E, 0X7E4B,
-  0X7E47, 0X7EC4, 0X7EC1, 0X7EBE, 0X7EBB, 0X7EB7, 0X7EB4, 0X7EB1,
-  0X7EAE, 0X7EAB, 0X7EA8, 0X7EA5, 0X7EA2, 0X7E9F, 0X7E9C, 0X7E99,
-  0X7E96, 0X7E93, 0X7E90, 0X7E8D, 0X7E8A, 0X7F07, 0X7F04, 0X7F01,
-  0X0001, 0X0004, 0X0007, 0X000A, 0X000D, 0X0010, 0X0013, 0X0016,
-  0X0019, 0X001C, 0X001F, 0X0022, 0X0026, 0X0029, 0X002C, 0X002F,
-  0X0032, 0X0035, 0X0038, 0X003C, 0X003F, 0X0042, 0X0045, 0X00C9,
-  0X00CC, 0X00D0, 0X00D3, 0X00D6, 0X00DA, 0X00DD, 0X00DF, 0X00E3,
-  0X00E6, 0X00EA, 0X00EE, 0X00F1, 0X00F4, 0X00F4, 0X00F3, 0X00F3,
-  0X00F3, 0X00F4, 0X00F4, 0X00F4, 0X0174, 0X0174, 0X0174, 0X0174,
-  0X0174, 0X0175, 0X01F5, 0X01F5, 0X01F5, 0X01F5, 0X0275, 0X0276,
-  0X02F6, 0X0376, 0X03F6, 0X04F7, 0X05F7, 0X0877, 0X0D77, 0X2078,
-  0X6078, 0X72F9, 0X77F9, 0X7A7A, 0X7B7B, 0X7C7C, 0X7CFD, 0X7D7D,
-  0X7DFE, 0X7DFE, 0X7E7F, 0X7E7F, 0X7E7F, 0X7E7F, 0X7EFF, 0X7EFF,
-  0X7EFF, 0X7EFE, 0X7EFD, 0X7EFB, 0X7F7A, 0X7F79, 0X7F78, 0X7F77,
-  0X7F76, 0X7F75, 0X7F73, 0X7F72, 0X7F6F, 0X7F6C, 0X7F68, 0X7F65,
-  0X7F62, 0X7F60, 0X7F5C, 0X7F59, 0X7F55, 0X7F52, 0X7F4F, 0X7F4B,
-  0X7F48, 0X7FC4, 0X7FC1, 0X7FBE, 0X7FBB, 0X7FB8, 0X7FB5, 0X7FB1,
-  0X7FAE, 0X7FAB, 0X7FA8, 0X7FA5, 0X7FA2, 0X7F9F, 0X7F9C, 0X7F99,
-  0X7F96, 0X7F93, 0X7F90, 0X7F8D, 0X7F8A, 0X7F87, 0X7F84, 0X7F81,
-  0XFF81, 0XFF84, 0XFF87, 0XFF8A, 0XFF8D, 0XFF90, 0XFF93, 0XFF96,
-  0XFF99, 0XFF9C, 0XFF9F, 0XFFA2, 0XFFA6, 0XFFA9, 0XFFAC, 0XFFAF,
-  0XFFB2, 0XFFB5, 0XFFB8, 0XFFBC, 0XFFBF, 0XFFC2, 0XFFC5, 0XFF49,
-  0XFF4C, 0XFF4F, 0XFF53, 0XFF56, 0XFF5A, 0XFF5D, 0XFF5F, 0XFF62,
-  0XFF65, 0XFF69, 0XFF6C, 0XFF6F, 0XFF70, 0XFF6F, 0XFF6F, 0XFF70,
-  0XFF70, 0XFF70, 0XFF70, 0XFF70, 0XFEF1, 0XFEF1, 0XFEF1, 0XFEF1,
-  0XFEF1, 0XFEF2, 0XFE72, 0XFE72, 0XFE72, 0XFE73, 0XFDF3, 0XFDF3,
-  0XFD73, 0XFCF4, 0XFC74, 0XFB74, 0XFA74, 0XF7F5, 0XF2F5, 0XE075,
-  0XA075, 0X8D76, 0X8876, 0X85F6, 0X84F7, 0X83F7, 0X8378, 0X82F8,
-  0X8279, 0X827A, 0X81FB, 0X81FC, 0X81FD, 0X81FE, 0X817F, 0X817F,
-  0X817F, 0X817F, 0X817F, 0X817F, 0X80FE, 0X80FD, 0X80FB, 0X80FA,
-  0X80F9, 0X80F8, 0X80F6, 0X80F4, 0X80F1, 0X80ED, 0X80E9, 0X80E6,
-  0X80E2, 0X80E0, 0X80DD, 0X80D9, 0X80D6, 0X80D2, 0X80CF, 0X80CB,
-  0X80C8, 0X8045, 0X8041, 0X803E, 0X803B, 0X8038, 0X8035, 0X8031,
-  0X802E, 0X802B, 0X8028, 0X8025, 0X8022, 0X801F, 0X801C, 0X8019,
-  0X8016, 0X8013, 0X8010, 0X800D, 0X800A, 0X8007, 0X8004, 0X8001,
-  0XFF01, 0XFF04, 0XFF07, 0XFE8A, 0XFE8D, 0XFE90, 0XFE93, 0XFE96,
-  0XFE99, 0XFE9C, 0XFE9F, 0XFEA2, 0XFEA5, 0XFEA8, 0XFEAC, 0XFEAF,
-  0XFEB2, 0XFEB5, 0XFEB8, 0XFEBC, 0XFEBF, 0XFEC2, 0XFEC5, 0XFE48,
-  0XFE4C, 0XFE4F, 0XFE52, 0XFE55, 0XFE59, 0XFE5C, 0XFE5F, 0XFE61,
-  0XFE64, 0XFDE7, 0XFDEA, 0XFDEC, 0XFDEC, 0XFDEC, 0XFDED, 0XFDED,
-  0XFD6D, 0XFD6D, 0XFD6E, 0XFD6E, 0XFCEE, 0XFCEE, 0XFCEE, 0XFC6F,
-  0XFC6F, 0XFBEF, 0XFB6F, 0XFB70, 0XFAF0, 0XFA70, 0XF9F0, 0XF8F1,
-  0XF7F1, 0XF6F1, 0XF572, 0XF2F2, 0XEFF2, 0XE9F2, 0XE073, 0XCD73,
-  0XB2F3, 0XA074, 0X9674, 0X9074, 0X8D74, 0X8AF5, 0X8975, 0X8876,
-  0X8776, 0X8677, 0X85F7, 0X8578, 0X84F9, 0X84FA, 0X847B, 0X83FC,
-  0X83FD, 0X837E, 0X837F, 0X837F, 0X82FF, 0X82FF, 0X82FF, 0X82FE,
-  0X827C, 0X827B, 0X8279, 0X8276, 0X8272, 0X826E, 0X826A, 0X81E6,
-  0X81E3, 0X81E0, 0X81DD, 0X81DA, 0X81D6, 0X81D2, 0X81CF, 0X81CC,
-  0X81C8, 0X8145, 0X8141, 0X813F, 0X813B, 0X8138, 0X8135, 0X8131,
-  0X812E, 0X812B, 0X8128, 0X8125, 0X8122, 0X811F, 0X811C, 0X8119,
-  0X8116, 0X8113, 0X8110, 0X810D, 0X810A, 0X8087, 0X8084, 0X8081,
-  0XFE01, 0XFE04, 0XFE07, 0XFE0A, 0XFE0D, 0XFE10, 0XFE13, 0XFE16,
-  0XFE19, 0XFE1C, 0XFE1F, 0XFE22, 0XFE25, 0XFDA8, 0XFDAB, 0XFDAF,
-  0XFDB2, 0XFDB5, 0XFDB8, 0XFDBB, 0XFDBE, 0XFDC1, 0XFDC4, 0XFD48,
-  0XFD4B, 0XFD4E, 0XFD51, 0XFD54, 0XFD58, 0XFD5B, 0XFCDE, 0XFCE0,
-  0XFCE2, 0XFCE5, 0XFCE8, 0XFC68, 0XFC69, 0XFC69, 0XFC6A, 0XFBEA,
-  0XFBEA, 0XFB6A, 0XFB6B, 0XFB6B, 0XFAEB, 0XFAEB, 0XFA6C, 0XF9EC,
-  0XF96C, 0XF96C, 0XF8ED, 0XF7ED, 0XF76D, 0XF66D, 0XF5EE, 0XF46E,
-  0XF2EE, 0XF16E, 0XEEEF, 0XEB6F, 0XE6EF, 0XE070, 0XD670, 0XC870,
-  0XB7F1, 0XA9F1, 0XA071, 0X9972, 0X94F2, 0X9172, 0X8EF3, 0X8D73,
-  0X8BF3, 0X8A74, 0X89F4, 0X88F5, 0X8875, 0X8776, 0X86F7, 0X86F8,
-  0X8678, 0X85F9, 0X857B, 0X857C, 0X84FD, 0X84FE, 0X84FF, 0X847F,
-  0X847F, 0X83FF, 0X83FC, 0X83F7, 0X83F3, 0X836E, 0X836A, 0X8366,
-  0X8363, 0X8360, 0X82DD, 0X82DA, 0X82D6, 0X82D2, 0X82CF, 0X82CC,
-  0X82C8, 0X8245, 0X8241, 0X823F, 0X823B, 0X8238, 0X8235, 0X8231,
-  0X822E, 0X822B, 0X8228, 0X81A5, 0X81A2, 0X819F, 0X819C, 0X8199,
-  0X8196, 0X8193, 0X8190, 0X818D, 0X818A, 0X8187, 0X8184, 0X8181,
-  0XFD81, 0XFD84, 0XFD87, 0XFD8A, 0XFD8D, 0XFD90, 0XFD93, 0XFD16,
-  0XFD19, 0XFD1C, 0XFD1F, 0XFD22, 0XFD25, 0XFD28, 0XFD2B, 0XFD2E,
-  0XFD31, 0XFCB4, 0XFCB8, 0XFCBB, 0XFCBE, 0XFCC1, 0XFCC4, 0XFC47,
-  0XFC4A, 0XFC4D, 0XFC50, 0XFC53, 0XFBD6, 0XFBDA, 0XFBDC, 0XFBDF,
-  0XFB61, 0XFB63, 0XFB65, 0XFB65, 0XFAE6, 0XFAE6, 0XFA66, 0XFA67,
-  0XF9E7, 0XF9E8, 0XF968, 0XF968, 0XF8E8, 0XF869, 0XF7E9, 0XF769,
-  0XF6EA, 0XF66A, 0XF5EA, 0XF4EA, 0XF3EB, 0XF2EB, 0XF1EB, 0XF06C,
-  0XEE6C, 0XEBEC, 0XE8EC, 0XE56D, 0XE06D, 0XD96D, 0XD06D, 0XC5EE,
-  0XBA6E, 0XAFEE, 0XA6EF, 0XA06F, 0X9AEF, 0X9770, 0X9470, 0X91F0,
-  0X8FF1, 0X8E71, 0X8D72, 0X8C72, 0X8B72, 0X8A73, 0X89F3, 0X8974,
-  0X88F5, 0X8876, 0X87F7, 0X8778, 0X86F8, 0X86F9, 0X867B, 0X867C,
-  0X85FE, 0X85FF, 0X857D, 0X8577, 0X84F3, 0X84EE, 0X84EA, 0X84E6,
-  0X8463, 0X8460, 0X845D, 0X845A, 0X83D6, 0X83D2, 0X83CF, 0X83CB,
-  0X83C8, 0X8345, 0X8341, 0X833E, 0X833B, 0X8338, 0X8335, 0X82B1,
-  0X82AE, 0X82AB, 0X82A8, 0X82A5, 0X82A2, 0X829F, 0X829C, 0X8299,
-  0X8296, 0X8213, 0X8210, 0X820D, 0X820A, 0X8207, 0X8204, 0X8201,
-  0XFD01, 0XFD04, 0XFD07, 0XFC8A, 0XFC8D, 0XFC90, 0XFC93, 0XFC96,
-  0XFC99, 0XFC9C, 0XFC9E, 0XFCA2, 0XFC25, 0XFC27, 0XFC2B, 0XFC2E,
-  0XFC31, 0XFC34, 0XFBB7, 0XFBBA, 0XFBBD, 0XFBC0, 0XFBC3, 0XFB46,
-  0XFB49, 0XFB4C, 0XFB4F, 0XFB52, 0XFAD5, 0XFAD8, 0XFADB, 0XFA5D,
-  0XFA5F, 0XFA61, 0XF9E2, 0XF9E2, 0XF963, 0XF963, 0XF8E4, 0XF8E4,
-  0XF865, 0XF7E5, 0XF7E5, 0XF766, 0XF6E6, 0XF666, 0XF5E6, 0XF567,
-  0XF467, 0XF3E7, 0XF2E8, 0XF1E8, 0XF0E8, 0XEFE8, 0XEDE9, 0XEC69,
-  0XE9E9, 0XE769, 0XE46A, 0XE06A, 0XDAEA, 0XD4EB, 0XCD6B, 0XC4EB,
-  0XBB6B, 0XB2EC, 0XAB6C, 0XA56C, 0XA06D, 0X9BED, 0X98ED, 0X966E,
-  0X93EE, 0X926E, 0X906F, 0X8F6F, 0X8E6F, 0X8D70, 0X8C70, 0X8BF1,
-  0X8AF1, 0X8A72, 0X89F2, 0X8973, 0X88F4, 0X8875, 0X8876, 0X87F7,
-  0X8779, 0X877A, 0X86FA, 0X86F6, 0X8672, 0X866E, 0X85EA, 0X85E6,
-  0X85E2, 0X8560, 0X855D, 0X8559, 0X84D6, 0X84D2, 0X84CF, 0X84CB,
-  0X84C8, 0X8444, 0X8441, 0X843E, 0X843B, 0X8438, 0X83B4, 0X83B1,
-  0X83AE, 0X83AB, 0X83A8, 0X83A5, 0X8321, 0X831E, 0X831C, 0X8318,
-  0X8315, 0X8312, 0X830F, 0X830C, 0X8309, 0X8286, 0X8284, 0X8281,
-  0XFC01, 0XFC04, 0XFC07, 0XFC0A, 0XFC0D, 0XFC10, 0XFC12, 0XFC15,
-  0XFB98, 0XFB9B, 0XFB9E, 0XFBA1, 0XFBA4, 0XFBA7, 0XFB2A, 0XFB2D,
-  0XFB30, 0XFB33, 0XFB36, 0XFAB9, 0XFABD, 0XFABF, 0XFAC2, 0XFAC5,
-  0XFA48, 0XFA4B, 0XFA4E, 0XF9D1, 0XF9D3, 0XF9D6, 0XF959, 0XF95B,
-  0XF8DD, 0XF8DE, 0XF85F, 0XF860, 0XF7E0, 0XF7E1, 0XF761, 0XF762,
-  0XF6E2, 0XF662, 0XF5E3, 0XF563, 0XF4E3, 0XF464, 0XF3E4, 0XF2E4,
-  0XF265, 0XF165, 0XF065, 0XEF66, 0XEDE6, 0XEC66, 0XEAE6, 0XE8E7,
-  0XE667, 0XE367, 0XE067, 0XDBE8, 0XD768, 0XD168, 0XCAE9, 0XC3E9,
-  0XBC69, 0XB569, 0XAEEA, 0XA8EA, 0XA46A, 0XA06B, 0X9CEB, 0X99EB,
-  0X976C, 0X956C, 0X93EC, 0X926C, 0X90ED, 0X8FED, 0X8EEE, 0X8DEE,
-  0X8D6E, 0X8C6F, 0X8BEF, 0X8B70, 0X8AF0, 0X8A71, 0X89F2, 0X8973,
-  0X88F4, 0X88F5, 0X8876, 0X8874, 0X87F0, 0X87EC, 0X8769, 0X8765,
-  0X86E2, 0X86E0, 0X865C, 0X8659, 0X8655, 0X85D2, 0X85CE, 0X85CB,
-  0X8548, 0X8544, 0X8541, 0X853E, 0X853B, 0X84B7, 0X84B4, 0X84B1,
-  0X84AE, 0X84AB, 0X8427, 0X8424, 0X8421, 0X841E, 0X841B, 0X8418,
-  0X8395, 0X8392, 0X838F, 0X838C, 0X8389, 0X8386, 0X8383, 0X8381,
-  0XFB81, 0XFB84, 0XFB86, 0XFB89, 0XFB8C, 0XFB0F, 0XFB12, 0XFB15,
-  0XFB18, 0XFB1B, 0XFB1E, 0XFAA1, 0XFAA4, 0XFAA7, 0XFAAA, 0XFAAD,
-  0XFA30, 0XFA33, 0XFA36, 0XFA38, 0XF9BC, 0XF9BE, 0XF9C1, 0XF9C4,
-  0XF947, 0XF94A, 0XF94D, 0XF8CF, 0XF8D2, 0XF854, 0XF857, 0XF7D9,
-  0XF7DA, 0XF75C, 0XF75D, 0XF6DD, 0XF6DE, 0XF65F, 0XF5DF, 0XF55F,
-  0XF560, 0XF4E0, 0XF460, 0XF361, 0XF2E1, 0XF261, 0XF1E2, 0XF0E2,
-  0XEFE2, 0XEEE2, 0XEDE3, 0XEC63, 0XEB63, 0XE964, 0XE7E4, 0XE564,
-  0XE2E5, 0XE065, 0XDCE5, 0XD8E5, 0XD466, 0XCEE6, 0XC966, 0XC366,
-  0XBCE7, 0XB6E7, 0XB167, 0XABE7, 0XA768, 0XA368, 0XA068, 0X9D69,
-  0X9AE9, 0X9869, 0X96E9, 0X94EA, 0X93EA, 0X926B, 0X916B, 0X906B,
-  0X8F6C, 0X8E6C, 0X8DEC, 0X8D6D, 0X8CED, 0X8BEE, 0X8B6E, 0X8AEF,
-  0X8AF0, 0X8A71, 0X89F2, 0X8971, 0X896E, 0X88EB, 0X88E7, 0X8864,
-  0X8861, 0X87DF, 0X87DB, 0X8758, 0X8754, 0X86D1, 0X86CE, 0X86CA,
-  0X8647, 0X8644, 0X8640, 0X863E, 0X85BA, 0X85B7, 0X85B4, 0X85B1,
-  0X852D, 0X852A, 0X8527, 0X8524, 0X8521, 0X849E, 0X849B, 0X8498,
-  0X8495, 0X8492, 0X848F, 0X840C, 0X8409, 0X8406, 0X8403, 0X8400,
-  0XFB00, 0XFB03, 0XFB06, 0XFA89, 0XFA8C, 0XFA8F, 0XFA92, 0XFA95,
-  0XFA98, 0XFA1B, 0XFA1D, 0XFA20, 0XFA23, 0XF9A6, 0XF9A9, 0XF9AC,
-  0XF9AF, 0XF932, 0XF935, 0XF938, 0XF93B, 0XF8BD, 0XF8C0, 0XF8C3,
-  0XF846, 0XF849, 0XF7CB, 0XF7CE, 0XF7D0, 0XF753, 0XF755, 0XF6D6,
-  0XF658, 0XF659, 0XF5DA, 0XF5DB, 0XF55C, 0XF4DD, 0XF45D, 0XF3DE,
-  0XF35E, 0XF2DF, 0XF25F, 0XF1DF, 0XF15F, 0XF05F, 0XEFE0, 0XEEE0,
-  0XEDE1, 0XECE1, 0XEB61, 0XE9E1, 0XE861, 0XE6E2, 0XE4E2, 0XE2E2,
-  0XE062, 0XDD62, 0XD9E3, 0XD663, 0XD1E3, 0XCD64, 0XC864, 0XC2E4,
-  0XBD64, 0XB7E5, 0XB2E5, 0XAE65, 0XA9E6, 0XA666, 0XA2E6, 0XA066,
-  0X9D66, 0X9B67, 0X9967, 0X97E7, 0X9668, 0X94E8, 0X9368, 0X9269,
-  0X9169, 0X9069, 0X8FEA, 0X8EEA, 0X8E6B, 0X8DEB, 0X8D6B, 0X8CEC,
-  0X8C6C, 0X8BED, 0X8B6E, 0X8AEE, 0X8A6C, 0X8A69, 0X89E5, 0X89E2,
-  0X8961, 0X88DD, 0X88DA, 0X8857, 0X8854, 0X8850, 0X87CD, 0X87CA,
-  0X8746, 0X8743, 0X8740, 0X86BD, 0X86BA, 0X86B6, 0X86B3, 0X8630,
-  0X862D, 0X862A, 0X8627, 0X85A4, 0X85A0, 0X859D, 0X859B, 0X8518,
-  0X8515, 0X8512, 0X850F, 0X850C, 0X8509, 0X8486, 0X8483, 0X8480,
-  0X007F, 0XFA03, 0XFA06, 0XFA09, 0XFA0B, 0XFA0E, 0XFA11, 0XF994,
-  0XF997, 0XF99A, 0XF99D, 0XF91F, 0XF922, 0XF925, 0XF928, 0XF8AB,
-  0XF8AE, 0XF8B1, 0XF834, 0XF837, 0XF83A, 0XF7BC, 0XF7BF, 0XF7C2,
-  0XF744, 0XF747, 0XF6CA, 0XF6CC, 0XF64E, 0XF651, 0XF5D2, 0XF5D4,
-  0XF555, 0XF4D6, 0XF4D8, 0XF459, 0XF3DA, 0XF35A, 0XF2DB, 0XF25C,
-  0XF1DC, 0XF15D, 0XF0DD, 0XEFDE, 0XEF5E, 0XEE5E, 0XEDDF, 0XECDF,
-  0XEBDF, 0XEA5F, 0XE95F, 0XE7DF, 0XE660, 0XE460, 0XE260, 0XE061,
-  0XDD61, 0XDAE1, 0XD761, 0XD3E1, 0XCFE1, 0XCBE2, 0XC762, 0XC262,
-  0XBDE2, 0XB8E2, 0XB462, 0XB063, 0XAC63, 0XA8E3, 0XA564, 0XA2E4,
-  0XA064, 0X9DE4, 0X9BE5, 0X99E5, 0X9865, 0X96E5, 0X95E6, 0X9466,
-  0X9366, 0X9267, 0X91E7, 0X90E7, 0X9068, 0X8F68, 0X8EE8, 0X8E68,
-  0X8DE9, 0X8D6A, 0X8CEA, 0X8C6A, 0X8BE9, 0X8B66, 0X8B63, 0X8AE1,
-  0X8A5F, 0X8A5C, 0X89D9, 0X89D5, 0X8952, 0X894F, 0X88CC, 0X88C9,
-  0X8845, 0X8842, 0X883F, 0X87BC, 0X87B9, 0X87B6, 0X8732, 0X8730,
-  0X872C, 0X86A9, 0X86A6, 0X86A3, 0X86A0, 0X861D, 0X861A, 0X8617,
-  0X8614, 0X8591, 0X858E, 0X858B, 0X8588, 0X8585, 0X8582, 0X007F,
-  0X007F, 0XF982, 0XF985, 0XF988, 0XF98B, 0XF90E, 0XF911, 0XF914,
-  0XF917, 0XF899, 0XF89C, 0XF89F, 0XF8A2, 0XF825, 0XF828, 0XF82A,
-  0XF7AD, 0XF7B0, 0XF7B3, 0XF736, 0XF738, 0XF73B, 0XF6BE, 0XF6C0,
-  0XF643, 0XF646, 0XF5C8, 0XF5CA, 0XF54D, 0XF54F, 0XF4D0, 0XF452,
-  0XF453, 0XF3D4, 0XF355, 0XF2D6, 0XF257, 0XF1D8, 0XF159, 0XF0D9,
-  0XF05A, 0XEFDB, 0XEF5B, 0XEE5C, 0XEDDC, 0XECDC, 0XEBDD, 0XEADD,
-  0XE9DE, 0XE85E, 0XE75E, 0XE5DF, 0XE3DF, 0XE25F, 0XE05F, 0XDDDF,
-  0XDB5F, 0XD85F, 0XD560, 0XD260, 0XCE60, 0XCA61, 0XC661, 0XC261,
-  0XBDE1, 0XB9E1, 0XB5E1, 0XB1E1, 0XADE1, 0XAAE1, 0XA7E2, 0XA4E2,
-  0XA262, 0XA062, 0X9DE2, 0X9C62, 0X9A63, 0X98E3, 0X97E3, 0X9663,
-  0X9564, 0X9464, 0X9364, 0X9265, 0X91E5, 0X90E5, 0X9065, 0X8FE6,
-  0X8F66, 0X8EE6, 0X8E66, 0X8DE7, 0X8D66, 0X8CE4, 0X8C62, 0X8BE0,
-  0X8BDD, 0X8B5A, 0X8AD7, 0X8AD4, 0X8A51, 0X8A4E, 0X89CB, 0X89C8,
-  0X8945, 0X8941, 0X88BE, 0X88BB, 0X88B8, 0X8835, 0X8832, 0X882F,
-  0X87AC, 0X87A9, 0X87A6, 0X8723, 0X871F, 0X871C, 0X871A, 0X8697,
-  0X8694, 0X8691, 0X868E, 0X860B, 0X8608, 0X8605, 0X8602, 0X007F,
-  0X007F, 0XF902, 0XF905, 0XF888, 0XF88B, 0XF88D, 0XF890, 0XF893,
-  0XF816, 0XF819, 0XF81B, 0XF79E, 0XF7A1, 0XF7A4, 0XF727, 0XF72A,
-  0XF72C, 0XF6AF, 0XF6B2, 0XF6B5, 0XF637, 0XF63A, 0XF5BC, 0XF5BF,
-  0XF541, 0XF544, 0XF4C6, 0XF4C9, 0XF44B, 0XF3CD, 0XF3CE, 0XF350,
-  0XF2D1, 0XF252, 0XF253, 0XF1D4, 0XF155, 0XF0D5, 0XF056, 0XEFD7,
-  0XEED8, 0XEE58, 0XED59, 0XECDA, 0XEBDA, 0XEADA, 0XE9DB, 0XE8DB,
-  0XE7DC, 0XE65C, 0XE55C, 0XE3DD, 0XE1DD, 0XE05D, 0XDDDE, 0XDBDE,
-  0XD95E, 0XD6DE, 0XD3DF, 0XD05F, 0XCD5F, 0XC9DF, 0XC5DF, 0XC1DF,
-  0XBE5F, 0XBA60, 0XB660, 0XB2E0, 0XAFE0, 0XAC61, 0XA961, 0XA6E1,
-  0XA461, 0XA261, 0XA061, 0X9E61, 0X9C61, 0X9AE1, 0X99E1, 0X9862,
-  0X9762, 0X9662, 0X9562, 0X9462, 0X9362, 0X92E2, 0X91E3, 0X9163,
-  0X9063, 0X8FE4, 0X8F64, 0X8EE4, 0X8E63, 0X8DE2, 0X8DE0, 0X8D5E,
-  0X8CDC, 0X8C59, 0X8C56, 0X8BD3, 0X8B50, 0X8B4D, 0X8ACA, 0X8AC7,
-  0X8A44, 0X8A40, 0X89BE, 0X89BB, 0X8937, 0X8934, 0X8931, 0X88AE,
-  0X88AB, 0X88A8, 0X8825, 0X8822, 0X881F, 0X879C, 0X8799, 0X8796,
-  0X8713, 0X8710, 0X870D, 0X870A, 0X8707, 0X8684, 0X8682, 0X007F,
-  0X007F, 0XF881, 0XF804, 0XF807, 0XF80A, 0XF80D, 0XF790, 0XF792,
-  0XF795, 0XF798, 0XF71B, 0XF71D, 0XF720, 0XF6A3, 0XF6A6, 0XF6A8,
-  0XF62B, 0XF62E, 0XF5B1, 0XF5B3, 0XF536, 0XF539, 0XF4BB, 0XF4BE,
-  0XF440, 0XF442, 0XF3C5, 0XF3C7, 0XF349, 0XF2CB, 0XF2CC, 0XF24D,
-  0XF1CF, 0XF150, 0XF0D1, 0XF052, 0XEFD2, 0XEF53, 0XEED4, 0XEE55,
-  0XED55, 0XECD6, 0XEBD6, 0XEB57, 0XEA58, 0XE958, 0XE859, 0XE759,
-  0XE5D9, 0XE4DA, 0XE35A, 0XE1DB, 0XE05B, 0XDE5B, 0XDC5C, 0XD9DC,
-  0XD7DC, 0XD4DC, 0XD25D, 0XCF5D, 0XCC5D, 0XC8DD, 0XC55E, 0XC1DE,
-  0XBE5E, 0XBADE, 0XB75E, 0XB3DE, 0XB0DF, 0XADDF, 0XAB5F, 0XA85F,
-  0XA65F, 0XA3DF, 0XA1E0, 0XA060, 0X9E60, 0X9CE0, 0X9B60, 0X9A60,
-  0X98E1, 0X97E1, 0X96E1, 0X95E1, 0X94E1, 0X9461, 0X9361, 0X92E1,
-  0X91E1, 0X9161, 0X90E1, 0X9061, 0X8FE0, 0X8F5F, 0X8EDD, 0X8E5B,
-  0X8DD9, 0X8D57, 0X8D54, 0X8CD1, 0X8C4E, 0X8C4B, 0X8BC9, 0X8BC5,
-  0X8B42, 0X8B3F, 0X8ABC, 0X8AB9, 0X8A36, 0X8A33, 0X89B0, 0X89AD,
-  0X892A, 0X8927, 0X8924, 0X88A1, 0X889E, 0X889B, 0X8818, 0X8815,
-  0X8813, 0X8810, 0X878D, 0X878A, 0X8787, 0X8784, 0X8701, 0X007F,
-  0X007F, 0XF781, 0XF784, 0XF787, 0XF789, 0XF70C, 0XF70F, 0XF712,
-  0XF695, 0XF697, 0XF69A, 0XF61D, 0XF61F, 0XF622, 0XF5A5, 0XF5A8,
-  0XF5AB, 0XF52D, 0XF530, 0XF4B2, 0XF4B5, 0XF437, 0XF439, 0XF3BC,
-  0XF3BF, 0XF341, 0XF2C3, 0XF2C5, 0XF247, 0XF1C9, 0XF14A, 0XF14B,
-  0XF0CC, 0XF04D, 0XEFCF, 0XEF4F, 0XEED0, 0XEE51, 0XED52, 0XECD2,
-  0XEC53, 0XEB54, 0XEAD4, 0XE9D5, 0XE8D5, 0XE7D6, 0XE6D6, 0XE5D7,
-  0XE457, 0XE357, 0XE1D8, 0XE058, 0XDE59, 0XDC59, 0XDA5A, 0XD85A,
-  0XD65A, 0XD3DA, 0XD0DB, 0XCE5B, 0XCB5B, 0XC85B, 0XC4DC, 0XC1DC,
-  0XBE5C, 0XBB5C, 0XB7DC, 0XB4DD, 0XB1DD, 0XAF5D, 0XAC5D, 0XA9DD,
-  0XA7DE, 0XA5DE, 0XA3DE, 0XA1DE, 0XA05E, 0X9E5E, 0X9CDE, 0X9BDE,
-  0X9A5E, 0X995E, 0X985F, 0X975F, 0X965F, 0X955F, 0X94DF, 0X93DF,
-  0X935E, 0X92DE, 0X91DE, 0X915E, 0X90DD, 0X905C, 0X8FDB, 0X8F59,
-  0X8ED7, 0X8ED5, 0X8E52, 0X8DCF, 0X8D4D, 0X8D4A, 0X8CC7, 0X8C44,
-  0X8C41, 0X8BBE, 0X8BBB, 0X8B38, 0X8B36, 0X8AB2, 0X8AB0, 0X8A2C,
-  0X8A2A, 0X8A27, 0X89A3, 0X89A1, 0X899E, 0X891B, 0X8918, 0X8915,
-  0X8892, 0X888F, 0X888C, 0X8809, 0X8806, 0X8803, 0X8801, 0X007F,
-  0X007F, 0XF701, 0XF703, 0XF706, 0XF689, 0XF68C, 0XF68E, 0XF611,
-  0XF614, 0XF617, 0XF599, 0XF59C, 0XF59F, 0XF521, 0XF524, 0XF4A7,
-  0XF4A9, 0XF42C, 0XF42F, 0XF3B1, 0XF3B4, 0XF336, 0XF338, 0XF2BB,
-  0XF2BD, 0XF23F, 0XF1C1, 0XF1C3, 0XF145, 0XF0C6, 0XF048, 0XEFC9,
-  0XEFCA, 0XEF4B, 0XEECC, 0XEDCD, 0XED4E, 0XECCF, 0XEC50, 0XEB50,
-  0XEAD1, 0XE9D1, 0XE952, 0XE852, 0XE753, 0XE653, 0XE554, 0XE454,
-  0XE2D5, 0XE155, 0XE056, 0XDE56, 0XDCD6, 0XDAD7, 0XD8D7, 0XD6D7,
-  0XD4D8, 0XD258, 0XCFD8, 0XCD59, 0XCA59, 0XC759, 0XC4DA, 0XC1DA,
-  0XBE5A, 0XBB5A, 0XB8DA, 0XB5DB, 0XB2DB, 0XB05B, 0XADDB, 0XAB5B,
-  0XA95B, 0XA75B, 0XA55C, 0XA35C, 0XA1DC, 0XA05C, 0X9EDC, 0X9D5C,
-  0X9BDC, 0X9ADC, 0X99DC, 0X98DC, 0X97DC, 0X96DC, 0X965C, 0X955C,
-  0X94DC, 0X93DC, 0X935C, 0X92DB, 0X925B, 0X915A, 0X90D8, 0X9056,
-  0X9055, 0X8FD2, 0X8F50, 0X8ECD, 0X8E4B, 0X8E48, 0X8DC5, 0X8D42,
-  0X8D40, 0X8CBD, 0X8CBA, 0X8C37, 0X8C34, 0X8BB1, 0X8BAE, 0X8B2B,
-  0X8B28, 0X8AA6, 0X8AA3, 0X8A20, 0X8A1D, 0X8A1A, 0X8997, 0X8994,
-  0X8991, 0X890E, 0X890B, 0X8908, 0X8886, 0X8883, 0X8880, 0X007F,
-  0X007F, 0X007F, 0XF683, 0XF605, 0XF608, 0XF60B, 0XF58E, 0XF590,
-  0XF593, 0XF516, 0XF518, 0XF51B, 0XF49E, 0XF4A0, 0XF423, 0XF425,
-  0XF3A8, 0XF3AB, 0XF32D, 0XF330, 0XF2B2, 0XF2B5, 0XF237, 0XF1B9,
-  0XF1BB, 0XF13E, 0XF0BF, 0XF0C1, 0XF043, 0XEFC4, 0XEF46, 0XEEC7,
-  0XEE48, 0XEDC9, 0XED4A, 0XECCB, 0XEC4C, 0XEBCD, 0XEACD, 0XEA4E,
-  0XE94F, 0XE8CF, 0XE7D0, 0XE6D0, 0XE5D1, 0XE4D1, 0XE3D2, 0XE2D2,
-  0XE153, 0XE053, 0XDED4, 0XDCD4, 0XDB54, 0XD9D5, 0XD7D5, 0XD5D5,
-  0XD355, 0XD156, 0XCED6, 0XCC56, 0XC9D7, 0XC6D7, 0XC457, 0XC157,
-  0XBED8, 0XBBD8, 0XB958, 0XB658, 0XB3D9, 0XB159, 0XAED9, 0XACD9,
-  0XAA59, 0XA859, 0XA65A, 0XA4DA, 0XA35A, 0XA15A, 0XA05A, 0X9EDA,
-  0X9D5A, 0X9C5A, 0X9B5A, 0X9A5A, 0X995A, 0X985A, 0X975A, 0X96DA,
-  0X95D9, 0X9559, 0X9459, 0X93D8, 0X9358, 0X92D7, 0X9255, 0X91D4,
-  0X9152, 0X90D0, 0X904E, 0X8FCC, 0X8F49, 0X8F46, 0X8EC4, 0X8E41,
-  0X8E3E, 0X8DBB, 0X8D38, 0X8D36, 0X8CB3, 0X8CB0, 0X8C2D, 0X8C2B,
-  0X8BA7, 0X8BA5, 0X8B22, 0X8B1F, 0X8A9C, 0X8A99, 0X8A96, 0X8A13,
-  0X8A11, 0X8A0E, 0X898B, 0X8988, 0X8985, 0X8902, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XF582, 0XF585, 0XF587, 0XF50A, 0XF50D, 0XF50F,
-  0XF492, 0XF495, 0XF497, 0XF41A, 0XF41C, 0XF39F, 0XF3A2, 0XF324,
-  0XF327, 0XF2A9, 0XF2AC, 0XF22E, 0XF231, 0XF1B3, 0XF135, 0XF137,
-  0XF0B9, 0XF03C, 0XF03E, 0XEFBF, 0XEF41, 0XEEC2, 0XEE43, 0XEDC5,
-  0XED46, 0XECC7, 0XEC48, 0XEBC9, 0XEB4A, 0XEA4A, 0XE9CB, 0XE94C,
-  0XE84D, 0XE74D, 0XE6CE, 0XE5CE, 0XE4CF, 0XE3CF, 0XE250, 0XE150,
-  0XE051, 0XDED1, 0XDD51, 0XDBD2, 0XDA52, 0XD852, 0XD653, 0XD453,
-  0XD253, 0XD054, 0XCDD4, 0XCBD4, 0XC954, 0XC6D5, 0XC3D5, 0XC155,
-  0XBED5, 0XBC55, 0XB956, 0XB6D6, 0XB456, 0XB256, 0XAFD6, 0XADD6,
-  0XABD7, 0XA9D7, 0XA7D7, 0XA5D7, 0XA457, 0XA2D7, 0XA157, 0XA057,
-  0X9ED7, 0X9DD7, 0X9C57, 0X9B57, 0X9A57, 0X9957, 0X98D7, 0X97D7,
-  0X96D7, 0X9656, 0X95D6, 0X94D6, 0X9455, 0X93D4, 0X9353, 0X92D2,
-  0X9250, 0X91CE, 0X914C, 0X90CA, 0X9047, 0X8FC4, 0X8FC2, 0X8F3F,
-  0X8EBD, 0X8EBA, 0X8E37, 0X8DB5, 0X8DB2, 0X8D2F, 0X8D2C, 0X8CA9,
-  0X8CA6, 0X8C23, 0X8C21, 0X8B9E, 0X8B9B, 0X8B18, 0X8B15, 0X8B13,
-  0X8A90, 0X8A8D, 0X8A8A, 0X8A07, 0X8A04, 0X8A01, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XF501, 0XF504, 0XF487, 0XF489, 0XF48C, 0XF40F,
-  0XF411, 0XF414, 0XF396, 0XF399, 0XF31C, 0XF31E, 0XF2A1, 0XF2A3,
-  0XF226, 0XF228, 0XF1AB, 0XF1AD, 0XF130, 0XF0B1, 0XF0B4, 0XF036,
-  0XEFB8, 0XEFBA, 0XEF3C, 0XEEBD, 0XEE3F, 0XEDC0, 0XED41, 0XECC3,
-  0XEC44, 0XEBC5, 0XEB46, 0XEAC7, 0XE9C8, 0XE948, 0XE8C9, 0XE7CA,
-  0XE74B, 0XE64B, 0XE54C, 0XE44C, 0XE34D, 0XE24D, 0XE14E, 0XE04E,
-  0XDECF, 0XDD4F, 0XDBCF, 0XDA50, 0XD8D0, 0XD750, 0XD551, 0XD351,
-  0XD151, 0XCF52, 0XCD52, 0XCAD2, 0XC8D2, 0XC653, 0XC3D3, 0XC153,
-  0XBED3, 0XBC53, 0XB9D4, 0XB754, 0XB554, 0XB2D4, 0XB0D4, 0XAED4,
-  0XACD5, 0XAAD5, 0XA8D5, 0XA755, 0XA5D5, 0XA455, 0XA2D5, 0XA155,
-  0XA055, 0X9ED5, 0X9DD5, 0X9CD5, 0X9BD5, 0X9AD5, 0X99D4, 0X98D4,
-  0X9854, 0X9754, 0X96D3, 0X9653, 0X9552, 0X94D1, 0X9450, 0X93CF,
-  0X934E, 0X92CC, 0X924A, 0X91C8, 0X9145, 0X90C3, 0X9040, 0X903E,
-  0X8FBB, 0X8F38, 0X8F36, 0X8EB3, 0X8E31, 0X8E2E, 0X8DAB, 0X8DA8,
-  0X8D25, 0X8D23, 0X8CA0, 0X8C9D, 0X8C1A, 0X8C17, 0X8B95, 0X8B92,
-  0X8B8F, 0X8B0C, 0X8B09, 0X8B06, 0X8A84, 0X8A81, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XF480, 0XF483, 0XF406, 0XF408, 0XF38B, 0XF38E,
-  0XF390, 0XF313, 0XF315, 0XF298, 0XF29B, 0XF21D, 0XF21F, 0XF1A2,
-  0XF1A4, 0XF127, 0XF129, 0XF0AC, 0XF02E, 0XF030, 0XEFB2, 0XEF34,
-  0XEF36, 0XEEB8, 0XEE3A, 0XEDBB, 0XED3D, 0XECBE, 0XEC3F, 0XEBC0,
-  0XEB41, 0XEAC3, 0XEA44, 0XE9C4, 0XE8C5, 0XE846, 0XE747, 0XE6C8,
-  0XE5C8, 0XE549, 0XE44A, 0XE34A, 0XE24B, 0XE14B, 0XE04C, 0XDECC,
-  0XDDCC, 0XDC4D, 0XDACD, 0XD94E, 0XD7CE, 0XD64E, 0XD44F, 0XD24F,
-  0XD04F, 0XCE50, 0XCC50, 0XCA50, 0XC850, 0XC5D1, 0XC351, 0XC151,
-  0XBED1, 0XBCD1, 0XBA52, 0XB7D2, 0XB5D2, 0XB3D2, 0XB1D2, 0XAFD2,
-  0XADD2, 0XABD2, 0XA9D2, 0XA853, 0XA6D3, 0XA553, 0XA3D3, 0XA253,
-  0XA153, 0XA053, 0X9ED3, 0X9DD2, 0X9CD2, 0X9BD2, 0X9AD2, 0X9A52,
-  0X9952, 0X98D1, 0X97D1, 0X9750, 0X9650, 0X95CF, 0X954E, 0X94CD,
-  0X944B, 0X93C9, 0X9347, 0X92C5, 0X9243, 0X91C1, 0X913F, 0X90BC,
-  0X90B9, 0X9037, 0X8FB4, 0X8FB2, 0X8F2F, 0X8EAC, 0X8EAA, 0X8E27,
-  0X8E24, 0X8DA1, 0X8D9E, 0X8D1C, 0X8D19, 0X8C96, 0X8C94, 0X8C11,
-  0X8C0E, 0X8C0B, 0X8B88, 0X8B85, 0X8B03, 0X8B00, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XF382, 0XF385, 0XF388, 0XF30A, 0XF30D,
-  0XF28F, 0XF292, 0XF214, 0XF217, 0XF199, 0XF19C, 0XF11E, 0XF120,
-  0XF0A3, 0XF0A5, 0XF028, 0XEFAA, 0XEFAC, 0XEF2E, 0XEEB0, 0XEEB2,
-  0XEE34, 0XEDB6, 0XED38, 0XECB9, 0XEC3B, 0XEBBC, 0XEB3E, 0XEABF,
-  0XEA40, 0XE9C0, 0XE942, 0XE8C2, 0XE7C3, 0XE744, 0XE645, 0XE5C6,
-  0XE4C6, 0XE3C7, 0XE348, 0XE248, 0XE149, 0XE049, 0XDECA, 0XDDCA,
-  0XDC4A, 0XDB4B, 0XD9CB, 0XD84C, 0XD6CC, 0XD54C, 0XD34D, 0XD1CD,
-  0XCFCD, 0XCDCE, 0XCBCE, 0XC9CE, 0XC7CE, 0XC54F, 0XC34F, 0XC14F,
-  0XBECF, 0XBCCF, 0XBAD0, 0XB850, 0XB650, 0XB450, 0XB250, 0XB050,
-  0XAE50, 0XACD0, 0XAAD0, 0XA950, 0XA7D0, 0XA651, 0XA4D1, 0XA3D0,
-  0XA250, 0XA150, 0XA050, 0X9ED0, 0X9DD0, 0X9CD0, 0X9C50, 0X9B4F,
-  0X9A4F, 0X99CF, 0X98CE, 0X984E, 0X974D, 0X96CC, 0X964B, 0X95CA,
-  0X9549, 0X94C7, 0X9445, 0X93C3, 0X9341, 0X92BF, 0X923D, 0X91BA,
-  0X9138, 0X9135, 0X90B3, 0X9031, 0X902E, 0X8FAB, 0X8F28, 0X8F26,
-  0X8EA3, 0X8EA0, 0X8E1D, 0X8E1B, 0X8D98, 0X8D95, 0X8D13, 0X8D10,
-  0X8C8D, 0X8C8A, 0X8C08, 0X8C05, 0X8C02, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XF301, 0XF304, 0XF287, 0XF289, 0XF20C,
-  0XF20E, 0XF211, 0XF193, 0XF196, 0XF118, 0XF09B, 0XF09D, 0XF01F,
-  0XF022, 0XEFA4, 0XEFA6, 0XEF28, 0XEEAB, 0XEE2D, 0XEE2F, 0XEDB1,
-  0XED32, 0XECB4, 0XEC36, 0XEC37, 0XEBB9, 0XEB3A, 0XEABB, 0XE9BD,
-  0XE93E, 0XE8BF, 0XE83F, 0XE7C0, 0XE6C1, 0XE642, 0XE543, 0XE4C3,
-  0XE3C4, 0XE2C5, 0XE1C5, 0XE146, 0XE046, 0XDEC7, 0XDDC7, 0XDCC8,
-  0XDB48, 0XDA49, 0XD8C9, 0XD74A, 0XD5CA, 0XD44A, 0XD24B, 0XD0CB,
-  0XCECB, 0XCD4B, 0XCB4C, 0XC94C, 0XC74C, 0XC54C, 0XC34D, 0XC14D,
-  0XBECD, 0XBCCD, 0XBACD, 0XB8CE, 0XB6CE, 0XB4CE, 0XB2CE, 0XB14E,
-  0XAF4E, 0XADCE, 0XABCE, 0XAA4E, 0XA8CE, 0XA74E, 0XA5CE, 0XA4CE,
-  0XA34E, 0XA24E, 0XA14E, 0XA04E, 0X9ECE, 0X9E4E, 0X9D4D, 0X9C4D,
-  0X9B4D, 0X9ACC, 0X99CC, 0X994B, 0X984B, 0X97CA, 0X9749, 0X96C8,
-  0X9646, 0X9545, 0X94C3, 0X9441, 0X93BF, 0X93BD, 0X933B, 0X92B8,
-  0X9236, 0X91B3, 0X91B1, 0X912F, 0X90AC, 0X902A, 0X9027, 0X8FA4,
-  0X8FA2, 0X8F1F, 0X8F1C, 0X8E9A, 0X8E17, 0X8E14, 0X8D92, 0X8D8F,
-  0X8D8C, 0X8D09, 0X8D07, 0X8C84, 0X8C81, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XF281, 0XF203, 0XF206, 0XF208, 0XF18B,
-  0XF18D, 0XF110, 0XF112, 0XF095, 0XF097, 0XF019, 0XF01C, 0XEF9E,
-  0XEF20, 0XEF23, 0XEEA5, 0XEE27, 0XEE29, 0XEDAB, 0XED2D, 0XECAF,
-  0XEC31, 0XEC32, 0XEBB4, 0XEB36, 0XEAB7, 0XEA38, 0XE9B9, 0XE93B,
-  0XE83C, 0XE7BD, 0XE73E, 0XE6BF, 0XE5BF, 0XE540, 0XE441, 0XE3C1,
-  0XE2C2, 0XE1C3, 0XE0C3, 0XE044, 0XDEC4, 0XDDC5, 0XDCC5, 0XDBC6,
-  0XDA46, 0XD947, 0XD7C7, 0XD648, 0XD4C8, 0XD348, 0XD1C9, 0XD049,
-  0XCE49, 0XCCCA, 0XCACA, 0XC8CA, 0XC6CA, 0XC4CB, 0XC2CB, 0XC0CB,
-  0XBF4B, 0XBD4B, 0XBB4B, 0XB94C, 0XB74C, 0XB54C, 0XB34C, 0XB1CC,
-  0XAFCC, 0XAE4C, 0XACCC, 0XAB4C, 0XA9CC, 0XA84C, 0XA6CC, 0XA5CC,
-  0XA44C, 0XA34C, 0XA24C, 0XA14C, 0XA04C, 0X9F4B, 0X9E4B, 0X9D4B,
-  0X9C4A, 0X9BCA, 0X9AC9, 0X9A49, 0X9948, 0X98C7, 0X9846, 0X97C5,
-  0X96C4, 0X9642, 0X95C1, 0X953F, 0X94BD, 0X943B, 0X93B9, 0X93B7,
-  0X9335, 0X92B2, 0X9230, 0X91AD, 0X91AB, 0X9128, 0X90A6, 0X90A3,
-  0X9020, 0X8F9E, 0X8F9B, 0X8F18, 0X8F16, 0X8E93, 0X8E91, 0X8E0E,
-  0X8E0B, 0X8D88, 0X8D86, 0X8D83, 0X8D00, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XF182, 0XF185, 0XF107, 0XF10A,
-  0XF08C, 0XF08F, 0XF011, 0XF013, 0XEF96, 0XEF98, 0XEF1B, 0XEE9D,
-  0XEE9F, 0XEE21, 0XEE24, 0XEDA6, 0XED28, 0XECAA, 0XECAB, 0XEC2D,
-  0XEBAF, 0XEB31, 0XEAB2, 0XEA34, 0XE9B5, 0XE937, 0XE8B8, 0XE839,
-  0XE7BA, 0XE6BB, 0XE63C, 0XE5BD, 0XE4BE, 0XE43E, 0XE33F, 0XE2C0,
-  0XE1C0, 0XE0C1, 0XE042, 0XDF42, 0XDE43, 0XDCC3, 0XDBC4, 0XDAC4,
-  0XD945, 0XD845, 0XD6C5, 0XD546, 0XD446, 0XD2C7, 0XD0C7, 0XCF47,
-  0XCDC7, 0XCBC8, 0XCA48, 0XC848, 0XC6C9, 0XC4C9, 0XC2C9, 0XC0C9,
-  0XBF49, 0XBD49, 0XBB4A, 0XB94A, 0XB7CA, 0XB5CA, 0XB44A, 0XB24A,
-  0XB0CA, 0XAF4A, 0XAD4A, 0XABCA, 0XAACA, 0XA94A, 0XA7CA, 0XA6CA,
-  0XA54A, 0XA44A, 0XA34A, 0XA1CA, 0XA0CA, 0XA049, 0X9F49, 0X9E49,
-  0X9D48, 0X9CC8, 0X9BC7, 0X9B47, 0X9A46, 0X99C5, 0X9944, 0X9843,
-  0X97C2, 0X9740, 0X96BF, 0X963D, 0X95BB, 0X9539, 0X94B7, 0X9435,
-  0X93B3, 0X9330, 0X932E, 0X92AC, 0X9229, 0X91A7, 0X91A4, 0X9122,
-  0X911F, 0X909C, 0X901A, 0X9017, 0X8F95, 0X8F92, 0X8F0F, 0X8F0D,
-  0X8E8A, 0X8E87, 0X8E05, 0X8E02, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XF101, 0XF104, 0XF086, 0XF089,
-  0XF00B, 0XF00E, 0XEF90, 0XEF92, 0XEF15, 0XEE97, 0XEE99, 0XEE1C,
-  0XED9E, 0XEDA0, 0XED22, 0XECA4, 0XECA6, 0XEC28, 0XEBAA, 0XEB2C,
-  0XEAAD, 0XEA2F, 0XE9B1, 0XE932, 0XE8B3, 0XE835, 0XE7B6, 0XE737,
-  0XE6B8, 0XE639, 0XE53A, 0XE4BB, 0XE43C, 0XE33C, 0XE2BD, 0XE1BE,
-  0XE0BF, 0XE03F, 0XDF40, 0XDE40, 0XDD40, 0XDC41, 0XDAC2, 0XD9C2,
-  0XD8C2, 0XD743, 0XD643, 0XD4C4, 0XD344, 0XD1C4, 0XD045, 0XCEC5,
-  0XCD45, 0XCB46, 0XC9C6, 0XC846, 0XC646, 0XC4C7, 0XC2C7, 0XC0C7,
-  0XBF47, 0XBD47, 0XBB47, 0XB9C8, 0XB7C8, 0XB648, 0XB4C8, 0XB2C8,
-  0XB148, 0XAFC8, 0XAE48, 0XACC8, 0XAB48, 0XA9C8, 0XA8C8, 0XA748,
-  0XA648, 0XA548, 0XA3C8, 0XA2C7, 0XA1C7, 0XA0C7, 0XA047, 0X9F46,
-  0X9E46, 0X9D45, 0X9CC5, 0X9BC4, 0X9B44, 0X9AC3, 0X99C2, 0X9941,
-  0X98C0, 0X983E, 0X97BD, 0X973B, 0X96B9, 0X9637, 0X95B5, 0X9533,
-  0X94B1, 0X942F, 0X93AC, 0X932A, 0X9328, 0X92A5, 0X9223, 0X9220,
-  0X919E, 0X911B, 0X9118, 0X9096, 0X9013, 0X9011, 0X8F8E, 0X8F8C,
-  0X8F09, 0X8F06, 0X8E84, 0X8E81, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XF080, 0XF003, 0XF005, 0XEF88,
-  0XEF8A, 0XEF0D, 0XEF0F, 0XEE91, 0XEE94, 0XEE16, 0XED98, 0XED9A,
-  0XED1C, 0XEC9F, 0XECA1, 0XEC23, 0XEBA5, 0XEB26, 0XEB28, 0XEAAA,
-  0XEA2C, 0XE9AD, 0XE92F, 0XE8B0, 0XE831, 0XE7B3, 0XE734, 0XE635,
-  0XE5B6, 0XE537, 0XE4B8, 0XE3B9, 0XE33A, 0XE23A, 0XE1BB, 0XE0BC,
-  0XE03D, 0XDF3D, 0XDE3E, 0XDD3F, 0XDC3F, 0XDB3F, 0XDA40, 0XD8C0,
-  0XD7C1, 0XD6C1, 0XD541, 0XD3C2, 0XD2C2, 0XD143, 0XCFC3, 0XCE43,
-  0XCCC3, 0XCAC4, 0XC944, 0XC7C4, 0XC644, 0XC445, 0XC2C5, 0XC0C5,
-  0XBF45, 0XBD45, 0XBBC6, 0XB9C6, 0XB846, 0XB6C6, 0XB546, 0XB346,
-  0XB1C6, 0XB046, 0XAEC6, 0XAD46, 0XAC46, 0XAAC6, 0XA946, 0XA846,
-  0XA746, 0XA5C6, 0XA4C5, 0XA3C5, 0XA2C5, 0XA1C5, 0XA0C4, 0XA044,
-  0X9F44, 0X9E43, 0X9DC2, 0X9CC2, 0X9C41, 0X9B40, 0X9AC0, 0X9A3F,
-  0X99BE, 0X98BC, 0X983B, 0X97B9, 0X9737, 0X96B5, 0X9633, 0X95B1,
-  0X952F, 0X94AD, 0X94AB, 0X9429, 0X93A6, 0X9324, 0X9321, 0X929F,
-  0X921C, 0X921A, 0X9197, 0X9115, 0X9112, 0X908F, 0X908D, 0X900A,
-  0X9008, 0X8F85, 0X8F83, 0X8F00, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEF82, 0XEF84, 0XEF07,
-  0XEF09, 0XEE8B, 0XEE8E, 0XEE10, 0XED92, 0XED95, 0XED17, 0XEC99,
-  0XEC9B, 0XEC1D, 0XEB9F, 0XEB21, 0XEB23, 0XEAA5, 0XEA27, 0XE9A8,
-  0XE92A, 0XE8AB, 0XE82D, 0XE7AE, 0XE730, 0XE6B1, 0XE632, 0XE5B3,
-  0XE534, 0XE435, 0XE3B6, 0XE337, 0XE237, 0XE1B8, 0XE0B9, 0XE03A,
-  0XDF3B, 0XDE3B, 0XDD3C, 0XDC3C, 0XDB3D, 0XDA3E, 0XD93E, 0XD83F,
-  0XD6BF, 0XD5BF, 0XD4BF, 0XD340, 0XD1C0, 0XD040, 0XCF41, 0XCDC1,
-  0XCC41, 0XCAC2, 0XC8C2, 0XC742, 0XC5C2, 0XC443, 0XC243, 0XC0C3,
-  0XBF43, 0XBDC3, 0XBBC3, 0XBA44, 0XB8C4, 0XB744, 0XB544, 0XB3C4,
-  0XB244, 0XB0C4, 0XAFC4, 0XAE44, 0XACC4, 0XAB44, 0XAA44, 0XA944,
-  0XA7C4, 0XA6C3, 0XA5C3, 0XA4C3, 0XA3C3, 0XA2C2, 0XA1C2, 0XA0C2,
-  0XA041, 0X9F41, 0X9E40, 0X9DC0, 0X9CBF, 0X9C3E, 0X9BBD, 0X9ABC,
-  0X9A3B, 0X99BA, 0X9938, 0X98B7, 0X9835, 0X97B3, 0X9731, 0X96AF,
-  0X962D, 0X95AB, 0X9529, 0X94A7, 0X94A4, 0X9422, 0X93A0, 0X931D,
-  0X931B, 0X9298, 0X9216, 0X9213, 0X9191, 0X910E, 0X910C, 0X9089,
-  0X9087, 0X9004, 0X9001, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEF01, 0XEE83, 0XEE86,
-  0XEE08, 0XEE0A, 0XED8C, 0XED8F, 0XED11, 0XEC93, 0XEC95, 0XEC17,
-  0XEB9A, 0XEB9C, 0XEB1E, 0XEAA0, 0XEA22, 0XE9A3, 0XE9A5, 0XE927,
-  0XE8A8, 0XE82A, 0XE7AB, 0XE72C, 0XE6AE, 0XE62F, 0XE530, 0XE4B1,
-  0XE432, 0XE3B3, 0XE2B4, 0XE235, 0XE1B6, 0XE0B7, 0XE037, 0XDF38,
-  0XDE39, 0XDD39, 0XDCBA, 0XDBBA, 0XDABB, 0XD9BC, 0XD8BC, 0XD73D,
-  0XD63D, 0XD53E, 0XD3BE, 0XD2BE, 0XD13F, 0XCFBF, 0XCEBF, 0XCD3F,
-  0XCBC0, 0XCA40, 0XC8C0, 0XC740, 0XC5C1, 0XC3C1, 0XC241, 0XC0C1,
-  0XBF41, 0XBDC1, 0XBC42, 0XBA42, 0XB8C2, 0XB742, 0XB5C2, 0XB442,
-  0XB2C2, 0XB142, 0XB042, 0XAEC2, 0XAD42, 0XAC42, 0XAAC2, 0XA9C2,
-  0XA8C1, 0XA741, 0XA641, 0XA541, 0XA441, 0XA340, 0XA2C0, 0XA1C0,
-  0XA0BF, 0XA03F, 0X9F3E, 0X9E3E, 0X9DBD, 0X9D3C, 0X9C3B, 0X9BBA,
-  0X9B39, 0X9AB8, 0X99B6, 0X9935, 0X98B3, 0X9831, 0X97B0, 0X972D,
-  0X96AB, 0X9629, 0X9627, 0X95A5, 0X9523, 0X94A1, 0X941E, 0X941C,
-  0X9399, 0X9317, 0X9315, 0X9292, 0X9210, 0X920D, 0X918B, 0X9188,
-  0X9106, 0X9103, 0X9081, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEE02, 0XEE04,
-  0XED87, 0XED89, 0XED0B, 0XEC8D, 0XEC90, 0XEC12, 0XEB94, 0XEB96,
-  0XEB18, 0XEA9A, 0XEA9C, 0XEA1E, 0XE9A0, 0XE922, 0XE8A3, 0XE825,
-  0XE7A7, 0XE728, 0XE6A9, 0XE62B, 0XE5AC, 0XE52D, 0XE4AE, 0XE430,
-  0XE3B0, 0XE2B1, 0XE232, 0XE133, 0XE0B4, 0XE035, 0XDF36, 0XDE36,
-  0XDDB7, 0XDCB7, 0XDBB8, 0XDAB8, 0XD9B9, 0XD8BA, 0XD7BA, 0XD6BB,
-  0XD5BB, 0XD43B, 0XD33C, 0XD1BC, 0XD0BD, 0XCF3D, 0XCE3D, 0XCCBE,
-  0XCB3E, 0XC9BE, 0XC83E, 0XC6BF, 0XC53F, 0XC3BF, 0XC23F, 0XC0BF,
-  0XBF3F, 0XBDBF, 0XBC40, 0XBAC0, 0XB940, 0XB7C0, 0XB640, 0XB4C0,
-  0XB340, 0XB1C0, 0XB0C0, 0XAF40, 0XAE40, 0XACC0, 0XABC0, 0XAA40,
-  0XA93F, 0XA83F, 0XA73F, 0XA63F, 0XA53F, 0XA43E, 0XA33E, 0XA23E,
-  0XA1BD, 0XA0BD, 0XA03C, 0X9F3B, 0X9EBA, 0X9DBA, 0X9D39, 0X9C38,
-  0X9BB7, 0X9B35, 0X9AB4, 0X9A32, 0X99B1, 0X992F, 0X98AD, 0X982B,
-  0X97AA, 0X9727, 0X96A5, 0X9623, 0X95A1, 0X951F, 0X951D, 0X949A,
-  0X9418, 0X9415, 0X9393, 0X9311, 0X930E, 0X928C, 0X9209, 0X9207,
-  0X9184, 0X9182, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XED81, 0XED83,
-  0XED05, 0XEC88, 0XEC8A, 0XEC0C, 0XEC0E, 0XEB90, 0XEB13, 0XEA95,
-  0XEA97, 0XEA19, 0XE99B, 0XE91C, 0XE91E, 0XE8A0, 0XE822, 0XE7A3,
-  0XE725, 0XE6A6, 0XE627, 0XE5A9, 0XE52A, 0XE4AB, 0XE3AC, 0XE32E,
-  0XE2AF, 0XE230, 0XE131, 0XE0B1, 0XE032, 0XDF33, 0XDE34, 0XDDB4,
-  0XDCB5, 0XDBB6, 0XDB36, 0XDA37, 0XD937, 0XD838, 0XD738, 0XD639,
-  0XD4B9, 0XD3BA, 0XD2BA, 0XD13A, 0XD03B, 0XCEBB, 0XCDBB, 0XCC3C,
-  0XCABC, 0XC93C, 0XC83D, 0XC6BD, 0XC53D, 0XC3BD, 0XC23D, 0XC0BE,
-  0XBF3E, 0XBDBE, 0XBC3E, 0XBABE, 0XB93E, 0XB7BE, 0XB6BE, 0XB53E,
-  0XB3BE, 0XB23E, 0XB13E, 0XAFBE, 0XAEBE, 0XAD3E, 0XAC3E, 0XAB3E,
-  0XA9BE, 0XA8BD, 0XA7BD, 0XA6BD, 0XA5BD, 0XA4BC, 0XA43C, 0XA33B,
-  0XA23B, 0XA1BA, 0XA0BA, 0XA039, 0X9F38, 0X9EB7, 0X9DB7, 0X9D36,
-  0X9CB5, 0X9C33, 0X9B32, 0X9AB1, 0X9A2F, 0X99AD, 0X992B, 0X98AA,
-  0X9828, 0X97A6, 0X9724, 0X96A2, 0X969F, 0X961D, 0X959B, 0X9519,
-  0X9516, 0X9494, 0X9412, 0X938F, 0X938D, 0X930A, 0X9308, 0X9286,
-  0X9203, 0X9201, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEC82,
-  0XEC84, 0XEC07, 0XEC09, 0XEB8B, 0XEB0D, 0XEB0F, 0XEA91, 0XEA13,
-  0XE995, 0XE997, 0XE919, 0XE89B, 0XE81D, 0XE79E, 0XE720, 0XE722,
-  0XE6A3, 0XE624, 0XE5A6, 0XE4A7, 0XE428, 0XE3AA, 0XE32B, 0XE2AC,
-  0XE22C, 0XE12E, 0XE0AF, 0XE02F, 0XDF30, 0XDEB1, 0XDDB2, 0XDCB2,
-  0XDC33, 0XDB34, 0XDA34, 0XD935, 0XD835, 0XD736, 0XD636, 0XD537,
-  0XD437, 0XD337, 0XD238, 0XD0B8, 0XCFB9, 0XCE39, 0XCD39, 0XCBBA,
-  0XCA3A, 0XC93A, 0XC7BA, 0XC63B, 0XC4BB, 0XC3BB, 0XC23B, 0XC0BB,
-  0XBF3C, 0XBDBC, 0XBC3C, 0XBB3C, 0XB9BC, 0XB83C, 0XB6BC, 0XB5BC,
-  0XB43C, 0XB2BC, 0XB1BC, 0XB03C, 0XAF3C, 0XADBC, 0XACBC, 0XABBC,
-  0XAABB, 0XA9BB, 0XA8BB, 0XA7BB, 0XA6BA, 0XA5BA, 0XA4BA, 0XA3B9,
-  0XA339, 0XA238, 0XA137, 0XA0B7, 0XA036, 0X9F35, 0X9EB4, 0X9DB3,
-  0X9D32, 0X9CB1, 0X9C30, 0X9BAE, 0X9B2D, 0X9A2B, 0X99A9, 0X9927,
-  0X98A6, 0X98A4, 0X9822, 0X97A0, 0X971E, 0X969C, 0X9619, 0X9617,
-  0X9595, 0X9513, 0X9490, 0X948E, 0X940B, 0X9389, 0X9387, 0X9304,
-  0X9302, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEC01,
-  0XEC03, 0XEB85, 0XEB07, 0XEB09, 0XEA8C, 0XEA0E, 0XEA10, 0XE992,
-  0XE914, 0XE896, 0XE898, 0XE819, 0XE79B, 0XE71D, 0XE69E, 0XE620,
-  0XE5A1, 0XE523, 0XE4A4, 0XE426, 0XE3A7, 0XE328, 0XE2A9, 0XE1AA,
-  0XE12B, 0XE0AC, 0XE02D, 0XDF2D, 0XDEAE, 0XDDAF, 0XDD30, 0XDC31,
-  0XDB31, 0XDAB2, 0XD9B2, 0XD8B3, 0XD7B4, 0XD6B4, 0XD5B5, 0XD4B5,
-  0XD3B6, 0XD2B6, 0XD136, 0XD037, 0XCF37, 0XCDB7, 0XCCB7, 0XCB38,
-  0XCA38, 0XC8B8, 0XC7B9, 0XC639, 0XC4B9, 0XC339, 0XC239, 0XC0BA,
-  0XBF3A, 0XBDBA, 0XBCBA, 0XBB3A, 0XB9BA, 0XB83A, 0XB73A, 0XB5BA,
-  0XB4BA, 0XB33A, 0XB23A, 0XB0BA, 0XAFBA, 0XAEBA, 0XAD3A, 0XAC3A,
-  0XAB39, 0XAA39, 0XA939, 0XA839, 0XA738, 0XA638, 0XA537, 0XA4B7,
-  0XA3B7, 0XA2B6, 0XA236, 0XA135, 0XA0B4, 0XA033, 0X9F32, 0X9EB1,
-  0X9E30, 0X9D2F, 0X9CAE, 0X9C2C, 0X9BAB, 0X9B29, 0X9AA8, 0X9A26,
-  0X99A4, 0X9922, 0X98A0, 0X981E, 0X979C, 0X971A, 0X9718, 0X9696,
-  0X9613, 0X9591, 0X958F, 0X950C, 0X948A, 0X9488, 0X9406, 0X9383,
-  0X9381, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XEB82, 0XEB04, 0XEA86, 0XEA88, 0XEA0A, 0XE98C, 0XE98E, 0XE910,
-  0XE892, 0XE814, 0XE796, 0XE798, 0XE719, 0XE69B, 0XE61C, 0XE59E,
-  0XE51F, 0XE4A1, 0XE422, 0XE3A3, 0XE325, 0XE2A6, 0XE1A7, 0XE128,
-  0XE0A9, 0XE02A, 0XDF2B, 0XDEAC, 0XDDAC, 0XDD2D, 0XDC2E, 0XDBAF,
-  0XDAB0, 0XD9B0, 0XD931, 0XD831, 0XD731, 0XD632, 0XD533, 0XD433,
-  0XD334, 0XD234, 0XD0B4, 0XCFB5, 0XCEB5, 0XCDB6, 0XCC36, 0XCB36,
-  0XC9B6, 0XC8B7, 0XC737, 0XC5B7, 0XC4B7, 0XC337, 0XC237, 0XC0B8,
-  0XBF38, 0XBDB8, 0XBCB8, 0XBB38, 0XBA38, 0XB8B8, 0XB738, 0XB638,
-  0XB4B8, 0XB3B8, 0XB238, 0XB138, 0XB038, 0XAF38, 0XADB8, 0XACB7,
-  0XABB7, 0XAAB7, 0XA9B7, 0XA8B7, 0XA7B6, 0XA6B6, 0XA636, 0XA535,
-  0XA435, 0XA3B4, 0XA2B3, 0XA233, 0XA132, 0XA0B1, 0XA030, 0X9F2F,
-  0X9EAE, 0X9E2D, 0X9D2C, 0X9CAA, 0X9C29, 0X9BA7, 0X9B26, 0X9AA4,
-  0X9A22, 0X99A0, 0X991E, 0X989C, 0X981A, 0X9818, 0X9796, 0X9714,
-  0X9692, 0X960F, 0X960D, 0X958B, 0X9509, 0X9506, 0X9484, 0X9402,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XEA81, 0XEA83, 0XEA05, 0XE987, 0XE989, 0XE90B, 0XE88D, 0XE88F,
-  0XE811, 0XE793, 0XE715, 0XE696, 0XE618, 0XE619, 0XE59B, 0XE51C,
-  0XE49E, 0XE41F, 0XE3A1, 0XE2A2, 0XE223, 0XE1A4, 0XE125, 0XE0A6,
-  0XE027, 0XDF28, 0XDEA9, 0XDDAA, 0XDD2B, 0XDC2B, 0XDBAC, 0XDAAD,
-  0XDA2E, 0XD92E, 0XD82F, 0XD7B0, 0XD6B0, 0XD5B1, 0XD4B1, 0XD3B1,
-  0XD2B2, 0XD1B2, 0XD033, 0XCF33, 0XCE33, 0XCD34, 0XCBB4, 0XCAB4,
-  0XC9B5, 0XC835, 0XC735, 0XC5B5, 0XC4B6, 0XC336, 0XC1B6, 0XC0B6,
-  0XBF36, 0XBE36, 0XBCB6, 0XBB36, 0XBA36, 0XB8B7, 0XB7B7, 0XB637,
-  0XB537, 0XB437, 0XB2B6, 0XB1B6, 0XB0B6, 0XAFB6, 0XAE36, 0XAD36,
-  0XAC36, 0XAB35, 0XAA35, 0XA935, 0XA834, 0XA7B4, 0XA6B3, 0XA5B3,
-  0XA532, 0XA432, 0XA3B1, 0XA2B1, 0XA230, 0XA12F, 0XA0AE, 0XA02D,
-  0X9F2C, 0X9EAB, 0X9E2A, 0X9DA8, 0X9D27, 0X9C25, 0X9BA4, 0X9B22,
-  0X9AA0, 0X9A1E, 0X999C, 0X999B, 0X9919, 0X9897, 0X9815, 0X9792,
-  0X9710, 0X970E, 0X968C, 0X9609, 0X9607, 0X9585, 0X9503, 0X9501,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XEA02, 0XE984, 0XE906, 0XE908, 0XE88A, 0XE80C, 0XE78E,
-  0XE78F, 0XE711, 0XE693, 0XE615, 0XE597, 0XE518, 0XE49A, 0XE41B,
-  0XE39C, 0XE31E, 0XE29F, 0XE220, 0XE1A2, 0XE123, 0XE0A4, 0XE025,
-  0XDF26, 0XDEA7, 0XDE27, 0XDD28, 0XDCA9, 0XDBAA, 0XDB2B, 0XDA2B,
-  0XD9AC, 0XD8AC, 0XD7AD, 0XD6AE, 0XD62E, 0XD52F, 0XD42F, 0XD330,
-  0XD230, 0XD131, 0XD031, 0XCEB1, 0XCDB2, 0XCCB2, 0XCBB2, 0XCA33,
-  0XC933, 0XC833, 0XC6B3, 0XC5B4, 0XC434, 0XC334, 0XC1B4, 0XC0B4,
-  0XBF34, 0XBE35, 0XBCB5, 0XBBB5, 0XBA35, 0XB935, 0XB7B5, 0XB6B5,
-  0XB5B5, 0XB435, 0XB335, 0XB235, 0XB135, 0XAFB4, 0XAEB4, 0XADB4,
-  0XACB4, 0XABB3, 0XAAB3, 0XA9B3, 0XA932, 0XA832, 0XA732, 0XA631,
-  0XA5B1, 0XA4B0, 0XA430, 0XA32F, 0XA2AE, 0XA1AD, 0XA12C, 0XA0AB,
-  0XA02A, 0X9F29, 0X9EA8, 0X9E27, 0X9DA5, 0X9D23, 0X9CA2, 0X9C20,
-  0X9B9F, 0X9B1D, 0X9A9B, 0X9A19, 0X9997, 0X9915, 0X9893, 0X9811,
-  0X980F, 0X978D, 0X970A, 0X9688, 0X9686, 0X9604, 0X9582, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XE981, 0XE902, 0XE884, 0XE886, 0XE808, 0XE78A, 0XE70C,
-  0XE68E, 0XE690, 0XE612, 0XE593, 0XE515, 0XE496, 0XE418, 0XE399,
-  0XE31B, 0XE29C, 0XE21D, 0XE19F, 0XE120, 0XE0A1, 0XE022, 0XDF23,
-  0XDEA4, 0XDE25, 0XDD26, 0XDCA7, 0XDC27, 0XDB28, 0XDAA9, 0XD9A9,
-  0XD8AA, 0XD82B, 0XD72B, 0XD62C, 0XD52C, 0XD4AD, 0XD3AD, 0XD2AE,
-  0XD1AE, 0XD0AF, 0XCFAF, 0XCEB0, 0XCD30, 0XCC30, 0XCB31, 0XCA31,
-  0XC8B1, 0XC7B1, 0XC6B1, 0XC532, 0XC432, 0XC332, 0XC1B2, 0XC0B2,
-  0XBF32, 0XBE33, 0XBCB3, 0XBBB3, 0XBAB3, 0XB933, 0XB833, 0XB733,
-  0XB5B3, 0XB4B3, 0XB3B3, 0XB2B3, 0XB132, 0XB032, 0XAF32, 0XAE32,
-  0XAD32, 0XAC31, 0XAB31, 0XAAB1, 0XA9B1, 0XA8B0, 0XA7B0, 0XA72F,
-  0XA62F, 0XA52E, 0XA4AD, 0XA3AC, 0XA32C, 0XA2AB, 0XA1AA, 0XA129,
-  0XA0A8, 0XA027, 0X9F26, 0X9EA4, 0X9E23, 0X9DA2, 0X9D20, 0X9C9E,
-  0X9C1D, 0X9B9B, 0X9B19, 0X9A97, 0X9A15, 0X9993, 0X9911, 0X990F,
-  0X988D, 0X980B, 0X9789, 0X9707, 0X9704, 0X9682, 0X9600, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XE881, 0XE803, 0XE785, 0XE787, 0XE709, 0XE68B,
-  0XE60C, 0XE58E, 0XE590, 0XE512, 0XE493, 0XE415, 0XE396, 0XE318,
-  0XE299, 0XE21B, 0XE19C, 0XE11D, 0XE09E, 0XE01F, 0XDF20, 0XDEA1,
-  0XDE22, 0XDD23, 0XDCA4, 0XDC25, 0XDB26, 0XDAA6, 0XD9A7, 0XD928,
-  0XD828, 0XD7A9, 0XD6AA, 0XD5AA, 0XD4AB, 0XD42B, 0XD32C, 0XD22C,
-  0XD12D, 0XD02D, 0XCF2D, 0XCE2E, 0XCD2E, 0XCC2F, 0XCAAF, 0XC9AF,
-  0XC8AF, 0XC7B0, 0XC630, 0XC530, 0XC430, 0XC2B0, 0XC1B1, 0XC0B1,
-  0XBF31, 0XBE31, 0XBD31, 0XBBB1, 0XBAB1, 0XB9B1, 0XB831, 0XB731,
-  0XB631, 0XB531, 0XB3B1, 0XB2B1, 0XB1B1, 0XB0B1, 0XAFB0, 0XAEB0,
-  0XADB0, 0XACB0, 0XABAF, 0XAB2F, 0XAA2F, 0XA92E, 0XA82E, 0XA7AD,
-  0XA6AC, 0XA62C, 0XA52B, 0XA4AB, 0XA3AA, 0XA329, 0XA2A8, 0XA1A7,
-  0XA126, 0XA0A5, 0XA024, 0X9F23, 0X9EA1, 0X9E20, 0X9D9E, 0X9D1C,
-  0X9C9B, 0X9C19, 0X9B97, 0X9B16, 0X9A94, 0X9A12, 0X9A10, 0X998E,
-  0X990C, 0X9889, 0X9807, 0X9805, 0X9783, 0X9701, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XE782, 0XE704, 0XE706, 0XE687, 0XE609,
-  0XE58B, 0XE50D, 0XE50F, 0XE490, 0XE412, 0XE393, 0XE315, 0XE296,
-  0XE217, 0XE199, 0XE11A, 0XE09B, 0XE01C, 0XDF1D, 0XDE9F, 0XDE1F,
-  0XDDA0, 0XDCA1, 0XDC22, 0XDBA3, 0XDAA4, 0XDA24, 0XD925, 0XD8A6,
-  0XD7A7, 0XD727, 0XD628, 0XD528, 0XD429, 0XD3A9, 0XD2AA, 0XD1AB,
-  0XD0AB, 0XCFAB, 0XCEAB, 0XCDAC, 0XCCAC, 0XCBAD, 0XCAAD, 0XC9AD,
-  0XC82D, 0XC72E, 0XC62E, 0XC52E, 0XC42E, 0XC2AF, 0XC1AF, 0XC0AF,
-  0XBF2F, 0XBE2F, 0XBD2F, 0XBBAF, 0XBAAF, 0XB9AF, 0XB8AF, 0XB7AF,
-  0XB62F, 0XB52F, 0XB42F, 0XB32F, 0XB22F, 0XB12F, 0XB02E, 0XAF2E,
-  0XAE2E, 0XAD2E, 0XAC2D, 0XABAD, 0XAAAC, 0XA9AC, 0XA8AC, 0XA82B,
-  0XA72B, 0XA6AA, 0XA5A9, 0XA529, 0XA428, 0XA3A7, 0XA326, 0XA225,
-  0XA1A4, 0XA123, 0XA0A2, 0XA020, 0X9F1F, 0X9E9E, 0X9E1C, 0X9D9B,
-  0X9D19, 0X9C97, 0X9C15, 0X9B94, 0X9B12, 0X9A90, 0X9A8E, 0X9A0C,
-  0X998A, 0X9908, 0X9886, 0X9884, 0X9802, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XE700, 0XE682, 0XE684, 0XE606, 0XE588,
-  0XE509, 0XE48B, 0XE40D, 0XE40F, 0XE390, 0XE312, 0XE293, 0XE214,
-  0XE196, 0XE117, 0XE098, 0XE01A, 0XDF1B, 0XDE9C, 0XDE1D, 0XDD9E,
-  0XDD1F, 0XDC20, 0XDBA1, 0XDB21, 0XDA22, 0XD9A3, 0XD8A4, 0XD824,
-  0XD725, 0XD6A6, 0XD5A6, 0XD4A7, 0XD3A7, 0XD328, 0XD228, 0XD129,
-  0XD029, 0XCF2A, 0XCE2A, 0XCD2A, 0XCC2B, 0XCB2B, 0XCA2B, 0XC92B,
-  0XC82C, 0XC72C, 0XC62C, 0XC4AC, 0XC3AD, 0XC2AD, 0XC1AD, 0XC0AD,
-  0XBF2D, 0XBE2D, 0XBD2D, 0XBC2D, 0XBB2D, 0XB9AD, 0XB8AD, 0XB7AD,
-  0XB6AD, 0XB5AD, 0XB4AD, 0XB3AD, 0XB2AD, 0XB1AD, 0XB0AC, 0XAFAC,
-  0XAEAC, 0XADAC, 0XACAB, 0XAC2B, 0XAB2B, 0XAA2A, 0XA92A, 0XA8A9,
-  0XA7A9, 0XA728, 0XA627, 0XA5A7, 0XA4A6, 0XA425, 0XA3A4, 0XA2A3,
-  0XA222, 0XA1A1, 0XA120, 0XA09F, 0XA01D, 0X9F1C, 0X9E9A, 0X9E19,
-  0X9D97, 0X9D15, 0X9C94, 0X9C12, 0X9B90, 0X9B8E, 0X9B0C, 0X9A8B,
-  0X9A08, 0X9986, 0X9904, 0X9902, 0X9880, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XE601, 0XE583, 0XE585, 0XE506,
-  0XE488, 0XE40A, 0XE38C, 0XE30D, 0XE30F, 0XE290, 0XE211, 0XE193,
-  0XE114, 0XE095, 0XE017, 0XDF18, 0XDE99, 0XDE1A, 0XDD9B, 0XDD1C,
-  0XDC1D, 0XDB9E, 0XDB1F, 0XDA1F, 0XD9A0, 0XD921, 0XD822, 0XD7A3,
-  0XD6A3, 0XD624, 0XD524, 0XD425, 0XD3A5, 0XD2A6, 0XD1A6, 0XD0A7,
-  0XCFA7, 0XCF28, 0XCE28, 0XCD28, 0XCC29, 0XCB29, 0XCA29, 0XC92A,
-  0XC82A, 0XC6AA, 0XC5AB, 0XC4AB, 0XC3AB, 0XC2AB, 0XC1AB, 0XC0AB,
-  0XBF2B, 0XBE2B, 0XBD2B, 0XBC2B, 0XBB2B, 0XBA2B, 0XB92B, 0XB7AB,
-  0XB6AB, 0XB5AB, 0XB4AB, 0XB3AB, 0XB2AB, 0XB1AB, 0XB0AB, 0XB02A,
-  0XAF2A, 0XAE2A, 0XAD29, 0XAC29, 0XABA9, 0XAAA8, 0XA9A8, 0XA927,
-  0XA827, 0XA7A6, 0XA6A5, 0XA625, 0XA5A4, 0XA4A3, 0XA422, 0XA3A1,
-  0XA2A0, 0XA21F, 0XA19E, 0XA11C, 0XA09B, 0XA01A, 0X9F18, 0X9E97,
-  0X9E15, 0X9D94, 0X9D12, 0X9C90, 0X9C8E, 0X9C0D, 0X9B8B, 0X9B09,
-  0X9A87, 0X9A05, 0X9A03, 0X9981, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE501, 0XE503, 0XE485,
-  0XE407, 0XE388, 0XE30A, 0XE28B, 0XE20D, 0XE20E, 0XE190, 0XE111,
-  0XE092, 0XE014, 0XDF15, 0XDE96, 0XDE17, 0XDD98, 0XDD19, 0XDC9B,
-  0XDB9B, 0XDB1C, 0XDA9D, 0XD99E, 0XD91F, 0XD89F, 0XD7A0, 0XD721,
-  0XD622, 0XD5A2, 0XD4A3, 0XD3A3, 0XD324, 0XD224, 0XD125, 0XD025,
-  0XCFA6, 0XCEA6, 0XCDA7, 0XCCA7, 0XCBA7, 0XCAA7, 0XC9A8, 0XC8A8,
-  0XC7A8, 0XC6A8, 0XC5A9, 0XC4A9, 0XC3A9, 0XC2A9, 0XC1AA, 0XC0AA,
-  0XBF2A, 0XBE2A, 0XBD2A, 0XBC2A, 0XBB2A, 0XBA2A, 0XB92A, 0XB82A,
-  0XB72A, 0XB62A, 0XB52A, 0XB429, 0XB329, 0XB229, 0XB129, 0XB028,
-  0XAFA8, 0XAEA8, 0XADA7, 0XACA7, 0XAC27, 0XAB27, 0XAA26, 0XA9A5,
-  0XA8A5, 0XA824, 0XA723, 0XA6A3, 0XA622, 0XA521, 0XA4A0, 0XA41F,
-  0XA31E, 0XA29D, 0XA21C, 0XA19B, 0XA119, 0XA098, 0XA017, 0X9F15,
-  0X9E93, 0X9E12, 0X9D90, 0X9D8F, 0X9D0D, 0X9C8B, 0X9C09, 0X9B87,
-  0X9B05, 0X9A83, 0X9A81, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE482, 0XE403,
-  0XE385, 0XE307, 0XE288, 0XE20A, 0XE18C, 0XE10D, 0XE10E, 0XE08F,
-  0XE011, 0XDF12, 0XDE93, 0XDE15, 0XDD96, 0XDD17, 0XDC98, 0XDC19,
-  0XDB1A, 0XDA9B, 0XDA1B, 0XD91C, 0XD89D, 0XD81E, 0XD71E, 0XD69F,
-  0XD5A0, 0XD520, 0XD421, 0XD3A2, 0XD2A2, 0XD1A3, 0XD0A3, 0XD023,
-  0XCF24, 0XCE24, 0XCD25, 0XCC25, 0XCBA5, 0XCAA6, 0XC9A6, 0XC8A6,
-  0XC7A7, 0XC6A7, 0XC5A7, 0XC4A7, 0XC3A7, 0XC2A7, 0XC1A7, 0XC0A8,
-  0XBF28, 0XBE28, 0XBD28, 0XBC28, 0XBB28, 0XBA28, 0XB928, 0XB828,
-  0XB728, 0XB628, 0XB527, 0XB427, 0XB3A7, 0XB2A7, 0XB1A7, 0XB0A7,
-  0XAFA6, 0XAF26, 0XAE26, 0XAD25, 0XAC25, 0XABA4, 0XAAA4, 0XAA23,
-  0XA923, 0XA8A2, 0XA7A1, 0XA721, 0XA6A0, 0XA59F, 0XA51E, 0XA49D,
-  0XA39C, 0XA31B, 0XA29A, 0XA219, 0XA197, 0XA116, 0XA095, 0XA013,
-  0X9F12, 0X9E90, 0X9E8E, 0X9E0D, 0X9D8B, 0X9D09, 0X9C87, 0X9C05,
-  0X9B83, 0X9B02, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE400, 0XE382,
-  0XE304, 0XE285, 0XE207, 0XE188, 0XE10A, 0XE08B, 0XE00D, 0XE00E,
-  0XDF0F, 0XDE91, 0XDE12, 0XDD93, 0XDD14, 0XDC95, 0XDC16, 0XDB97,
-  0XDA98, 0XDA19, 0XD99A, 0XD89B, 0XD81B, 0XD79C, 0XD69D, 0XD61E,
-  0XD51E, 0XD49F, 0XD39F, 0XD320, 0XD220, 0XD121, 0XD0A1, 0XCFA2,
-  0XCEA2, 0XCE23, 0XCD23, 0XCC23, 0XCB24, 0XCA24, 0XC924, 0XC825,
-  0XC725, 0XC625, 0XC525, 0XC4A6, 0XC3A6, 0XC2A6, 0XC1A6, 0XC0A6,
-  0XBF26, 0XBE26, 0XBD26, 0XBC26, 0XBB26, 0XBAA6, 0XB9A6, 0XB8A6,
-  0XB7A6, 0XB6A6, 0XB5A6, 0XB4A6, 0XB3A6, 0XB2A5, 0XB1A5, 0XB125,
-  0XB025, 0XAF24, 0XAEA4, 0XADA3, 0XACA3, 0XAC23, 0XAB22, 0XAAA2,
-  0XA9A1, 0XA920, 0XA81F, 0XA79F, 0XA71E, 0XA61D, 0XA59C, 0XA51B,
-  0XA41A, 0XA399, 0XA318, 0XA297, 0XA216, 0XA194, 0XA113, 0XA091,
-  0XA010, 0X9F8E, 0X9F0D, 0X9E8B, 0X9E09, 0X9D88, 0X9D06, 0X9C84,
-  0X9C02, 0X9B80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE301,
-  0XE282, 0XE204, 0XE185, 0XE107, 0XE088, 0XE00A, 0XE00B, 0XDF8C,
-  0XDE8E, 0XDE0F, 0XDD90, 0XDD11, 0XDC92, 0XDC13, 0XDB95, 0XDB15,
-  0XDA16, 0XD997, 0XD918, 0XD899, 0XD79A, 0XD71A, 0XD61B, 0XD59C,
-  0XD49C, 0XD41D, 0XD31E, 0XD29E, 0XD19F, 0XD11F, 0XD01F, 0XCF20,
-  0XCEA0, 0XCDA1, 0XCCA1, 0XCBA2, 0XCB22, 0XCA22, 0XC923, 0XC823,
-  0XC723, 0XC623, 0XC523, 0XC424, 0XC324, 0XC224, 0XC124, 0XC024,
-  0XBFA4, 0XBEA4, 0XBDA4, 0XBCA4, 0XBBA4, 0XBAA4, 0XB9A4, 0XB8A4,
-  0XB7A4, 0XB6A4, 0XB5A4, 0XB4A4, 0XB424, 0XB323, 0XB223, 0XB123,
-  0XB0A3, 0XAFA2, 0XAEA2, 0XAE22, 0XAD21, 0XACA1, 0XABA0, 0XAB20,
-  0XAA1F, 0XA99E, 0XA89E, 0XA81D, 0XA71C, 0XA69B, 0XA61A, 0XA599,
-  0XA498, 0XA417, 0XA396, 0XA315, 0XA294, 0XA212, 0XA191, 0XA10F,
-  0XA00E, 0XA00C, 0X9F8B, 0X9F09, 0X9E87, 0X9E06, 0X9D84, 0X9D02,
-  0X9C80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XE201, 0XE182, 0XE104, 0XE085, 0XE007, 0XE008, 0XDF89, 0XDF0B,
-  0XDE8C, 0XDD8D, 0XDD0F, 0XDC90, 0XDC11, 0XDB92, 0XDB13, 0XDA94,
-  0XD995, 0XD915, 0XD897, 0XD817, 0XD718, 0XD699, 0XD61A, 0XD51A,
-  0XD49B, 0XD39B, 0XD31C, 0XD21C, 0XD19D, 0XD09E, 0XCF9E, 0XCF1F,
-  0XCE1F, 0XCD1F, 0XCCA0, 0XCBA0, 0XCAA0, 0XC9A1, 0XC8A1, 0XC821,
-  0XC722, 0XC622, 0XC522, 0XC422, 0XC322, 0XC222, 0XC123, 0XC023,
-  0XBFA3, 0XBEA3, 0XBDA3, 0XBCA3, 0XBBA3, 0XBAA3, 0XB9A3, 0XB8A3,
-  0XB7A3, 0XB723, 0XB622, 0XB522, 0XB422, 0XB322, 0XB2A2, 0XB1A1,
-  0XB0A1, 0XB021, 0XAF20, 0XAE20, 0XAD9F, 0XAC9F, 0XAC1E, 0XAB1E,
-  0XAA9D, 0XA99C, 0XA91C, 0XA89B, 0XA79A, 0XA719, 0XA698, 0XA618,
-  0XA517, 0XA495, 0XA414, 0XA393, 0XA312, 0XA291, 0XA20F, 0XA10E,
-  0XA08C, 0XA00B, 0XA009, 0X9F88, 0X9F06, 0X9E84, 0X9E02, 0X9D81,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XE101, 0XE083, 0XE004, 0XE006, 0XDF87, 0XDF08, 0XDE89,
-  0XDE0B, 0XDD8C, 0XDC8D, 0XDC0E, 0XDB8F, 0XDB11, 0XDA91, 0XDA12,
-  0XD993, 0XD894, 0XD815, 0XD796, 0XD697, 0XD617, 0XD598, 0XD499,
-  0XD419, 0XD31A, 0XD29B, 0XD19B, 0XD11B, 0XD01C, 0XCF9C, 0XCE9D,
-  0XCD9D, 0XCD1E, 0XCC1E, 0XCB1F, 0XCA9F, 0XC99F, 0XC89F, 0XC7A0,
-  0XC6A0, 0XC620, 0XC520, 0XC421, 0XC321, 0XC221, 0XC121, 0XC021,
-  0XBFA1, 0XBEA1, 0XBDA1, 0XBCA1, 0XBBA1, 0XBAA1, 0XB9A1, 0XB921,
-  0XB821, 0XB721, 0XB621, 0XB521, 0XB4A0, 0XB3A0, 0XB2A0, 0XB21F,
-  0XB11F, 0XB01F, 0XAF9F, 0XAE9E, 0XAE1E, 0XAD1D, 0XAC9D, 0XAB9C,
-  0XAB1B, 0XAA1B, 0XA99A, 0XA919, 0XA818, 0XA798, 0XA717, 0XA616,
-  0XA595, 0XA514, 0XA493, 0XA411, 0XA390, 0XA30F, 0XA20E, 0XA18C,
-  0XA10B, 0XA089, 0XA007, 0XA006, 0X9F84, 0X9F03, 0X9E81, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XE001, 0XE002, 0XDF84, 0XDF05, 0XDE87, 0XDE08,
-  0XDD89, 0XDD0A, 0XDC8C, 0XDB8C, 0XDB0E, 0XDA8F, 0XDA10, 0XD991,
-  0XD912, 0XD812, 0XD793, 0XD714, 0XD695, 0XD595, 0XD516, 0XD497,
-  0XD398, 0XD318, 0XD219, 0XD199, 0XD09A, 0XD01A, 0XCF1B, 0XCE1B,
-  0XCD9C, 0XCC9C, 0XCC1C, 0XCB1D, 0XCA1D, 0XC91D, 0XC89E, 0XC79E,
-  0XC69E, 0XC59E, 0XC51F, 0XC41F, 0XC31F, 0XC21F, 0XC11F, 0XC01F,
-  0XBF9F, 0XBE9F, 0XBD9F, 0XBC9F, 0XBB9F, 0XBA9F, 0XBA1F, 0XB91F,
-  0XB81F, 0XB71F, 0XB69F, 0XB59F, 0XB49F, 0XB39E, 0XB31E, 0XB21E,
-  0XB19D, 0XB09D, 0XAF9D, 0XAF1C, 0XAE1C, 0XAD9B, 0XAC9B, 0XAC1A,
-  0XAB1A, 0XAA99, 0XAA18, 0XA917, 0XA897, 0XA816, 0XA795, 0XA694,
-  0XA613, 0XA592, 0XA511, 0XA48F, 0XA40E, 0XA30D, 0XA28C, 0XA20A,
-  0XA189, 0XA107, 0XA086, 0XA004, 0XA003, 0X9F81, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XDF81, 0XDF03, 0XDE84, 0XDE05, 0XDD86,
-  0XDD08, 0XDC89, 0XDC0A, 0XDB8B, 0XDA8C, 0XDA0D, 0XD98E, 0XD90F,
-  0XD890, 0XD811, 0XD712, 0XD692, 0XD613, 0XD514, 0XD495, 0XD415,
-  0XD316, 0XD297, 0XD197, 0XD118, 0XD018, 0XCF99, 0XCE99, 0XCE1A,
-  0XCD1A, 0XCC9B, 0XCB9B, 0XCA9B, 0XCA1B, 0XC91C, 0XC81C, 0XC79C,
-  0XC69D, 0XC59D, 0XC49D, 0XC41D, 0XC31D, 0XC21E, 0XC11E, 0XC01E,
-  0XBF9E, 0XBE9E, 0XBD9E, 0XBC9E, 0XBB9E, 0XBB1E, 0XBA1E, 0XB91E,
-  0XB81E, 0XB79D, 0XB69D, 0XB59D, 0XB51D, 0XB41D, 0XB31C, 0XB29C,
-  0XB19C, 0XB11B, 0XB01B, 0XAF9B, 0XAE9A, 0XAE1A, 0XAD19, 0XAC98,
-  0XAB98, 0XAB17, 0XAA96, 0XA996, 0XA915, 0XA894, 0XA793, 0XA712,
-  0XA691, 0XA610, 0XA58F, 0XA50E, 0XA40C, 0XA38B, 0XA30A, 0XA288,
-  0XA207, 0XA186, 0XA104, 0XA083, 0XA001, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XDE81, 0XDE02, 0XDD84, 0XDD05,
-  0XDC86, 0XDC07, 0XDB88, 0XDB09, 0XDA8A, 0XDA0C, 0XD90C, 0XD88E,
-  0XD80E, 0XD78F, 0XD710, 0XD611, 0XD592, 0XD512, 0XD413, 0XD394,
-  0XD314, 0XD215, 0XD195, 0XD096, 0XD016, 0XCF17, 0XCE97, 0XCD98,
-  0XCD18, 0XCC19, 0XCB99, 0XCA99, 0XC99A, 0XC91A, 0XC81A, 0XC71B,
-  0XC69B, 0XC59B, 0XC49B, 0XC39B, 0XC31C, 0XC21C, 0XC11C, 0XC01C,
-  0XBF9C, 0XBE9C, 0XBD9C, 0XBC9C, 0XBC1C, 0XBB1C, 0XBA1C, 0XB91C,
-  0XB89C, 0XB79B, 0XB69B, 0XB61B, 0XB51B, 0XB41B, 0XB39B, 0XB29A,
-  0XB21A, 0XB119, 0XB099, 0XAF98, 0XAF18, 0XAE18, 0XAD97, 0XAC97,
-  0XAC16, 0XAB95, 0XAA95, 0XAA14, 0XA993, 0XA892, 0XA811, 0XA790,
-  0XA70F, 0XA68E, 0XA58D, 0XA50C, 0XA48B, 0XA409, 0XA388, 0XA307,
-  0XA285, 0XA204, 0XA182, 0XA101, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDD81, 0XDD02, 0XDC83,
-  0XDC04, 0XDB86, 0XDB07, 0XDA88, 0XDA09, 0XD98A, 0XD90B, 0XD80C,
-  0XD78D, 0XD70E, 0XD68F, 0XD60F, 0XD510, 0XD491, 0XD412, 0XD312,
-  0XD293, 0XD213, 0XD114, 0XD095, 0XCF95, 0XCF15, 0XCE16, 0XCD96,
-  0XCC97, 0XCC17, 0XCB18, 0XCA18, 0XC998, 0XC898, 0XC819, 0XC719,
-  0XC619, 0XC599, 0XC49A, 0XC39A, 0XC29A, 0XC21A, 0XC11A, 0XC01A,
-  0XBF9A, 0XBE9B, 0XBD9B, 0XBD1B, 0XBC1A, 0XBB1A, 0XBA1A, 0XB99A,
-  0XB89A, 0XB79A, 0XB71A, 0XB61A, 0XB599, 0XB499, 0XB399, 0XB318,
-  0XB218, 0XB198, 0XB097, 0XB017, 0XAF16, 0XAE96, 0XAD95, 0XAD15,
-  0XAC94, 0XAB94, 0XAB13, 0XAA92, 0XA991, 0XA910, 0XA88F, 0XA80F,
-  0XA78E, 0XA68C, 0XA60B, 0XA58A, 0XA509, 0XA488, 0XA406, 0XA385,
-  0XA303, 0XA282, 0XA201, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDC81, 0XDC02,
-  0XDB83, 0XDB04, 0XDA85, 0XDA06, 0XD987, 0XD908, 0XD889, 0XD80A,
-  0XD70B, 0XD68C, 0XD60D, 0XD58E, 0XD50E, 0XD40F, 0XD390, 0XD310,
-  0XD211, 0XD192, 0XD112, 0XD013, 0XCF93, 0XCE94, 0XCE14, 0XCD15,
-  0XCC95, 0XCB95, 0XCB16, 0XCA16, 0XC917, 0XC897, 0XC797, 0XC717,
-  0XC618, 0XC518, 0XC498, 0XC398, 0XC298, 0XC218, 0XC118, 0XC018,
-  0XBF98, 0XBE98, 0XBD98, 0XBD18, 0XBC18, 0XBB18, 0XBA98, 0XB998,
-  0XB898, 0XB818, 0XB718, 0XB698, 0XB598, 0XB497, 0XB417, 0XB317,
-  0XB296, 0XB196, 0XB115, 0XB015, 0XAF95, 0XAE94, 0XAE14, 0XAD93,
-  0XAC92, 0XAC12, 0XAB91, 0XAA90, 0XAA0F, 0XA98F, 0XA90E, 0XA88C,
-  0XA78C, 0XA70A, 0XA689, 0XA608, 0XA587, 0XA506, 0XA484, 0XA403,
-  0XA382, 0XA300, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDB80,
-  0XDB01, 0XDA83, 0XDA04, 0XD985, 0XD906, 0XD887, 0XD808, 0XD789,
-  0XD70A, 0XD60A, 0XD58B, 0XD50C, 0XD48D, 0XD40E, 0XD30E, 0XD28F,
-  0XD210, 0XD110, 0XD091, 0XCF91, 0XCF12, 0XCE92, 0XCD93, 0XCD13,
-  0XCC14, 0XCB94, 0XCA94, 0XCA15, 0XC915, 0XC895, 0XC795, 0XC696,
-  0XC616, 0XC516, 0XC496, 0XC397, 0XC297, 0XC217, 0XC117, 0XC017,
-  0XBF97, 0XBE97, 0XBD97, 0XBD17, 0XBC17, 0XBB17, 0XBA97, 0XB997,
-  0XB917, 0XB817, 0XB716, 0XB696, 0XB596, 0XB516, 0XB415, 0XB395,
-  0XB295, 0XB214, 0XB114, 0XB093, 0XB013, 0XAF12, 0XAE92, 0XAD91,
-  0XAD11, 0XAC90, 0XAB8F, 0XAB0E, 0XAA8E, 0XAA0D, 0XA98C, 0XA88B,
-  0XA80A, 0XA789, 0XA708, 0XA686, 0XA605, 0XA584, 0XA503, 0XA481,
-  0XA400, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XDA81, 0XDA02, 0XD903, 0XD884, 0XD805, 0XD786, 0XD707,
-  0XD688, 0XD609, 0XD58A, 0XD48A, 0XD40B, 0XD38C, 0XD30C, 0XD20D,
-  0XD18E, 0XD10E, 0XD00F, 0XCF8F, 0XCF10, 0XCE11, 0XCD91, 0XCC92,
-  0XCC12, 0XCB12, 0XCA92, 0XC993, 0XC913, 0XC814, 0XC794, 0XC694,
-  0XC614, 0XC515, 0XC415, 0XC395, 0XC295, 0XC215, 0XC115, 0XC015,
-  0XBF95, 0XBE95, 0XBD95, 0XBD15, 0XBC15, 0XBB95, 0XBA95, 0XB995,
-  0XB915, 0XB815, 0XB795, 0XB694, 0XB614, 0XB514, 0XB494, 0XB393,
-  0XB313, 0XB212, 0XB192, 0XB092, 0XB011, 0XAF91, 0XAE90, 0XAE0F,
-  0XAD8F, 0XAC8E, 0XAC0D, 0XAB8C, 0XAB0C, 0XAA0B, 0XA98A, 0XA909,
-  0XA888, 0XA807, 0XA786, 0XA705, 0XA684, 0XA582, 0XA501, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XD981, 0XD902, 0XD883, 0XD804, 0XD705, 0XD686,
-  0XD606, 0XD587, 0XD508, 0XD489, 0XD38A, 0XD30A, 0XD28B, 0XD20C,
-  0XD10C, 0XD08D, 0XD00E, 0XCF0E, 0XCE8F, 0XCE0F, 0XCD0F, 0XCC90,
-  0XCB90, 0XCB11, 0XCA11, 0XC992, 0XC892, 0XC812, 0XC712, 0XC692,
-  0XC593, 0XC513, 0XC413, 0XC393, 0XC294, 0XC194, 0XC114, 0XC014,
-  0XBF94, 0XBE94, 0XBE14, 0XBD14, 0XBC14, 0XBB94, 0XBA94, 0XBA13,
-  0XB913, 0XB893, 0XB793, 0XB713, 0XB612, 0XB592, 0XB492, 0XB412,
-  0XB311, 0XB291, 0XB190, 0XB110, 0XB08F, 0XAF8F, 0XAF0E, 0XAE8E,
-  0XAD8D, 0XAD0C, 0XAC8C, 0XAC0B, 0XAB0A, 0XAA89, 0XAA08, 0XA987,
-  0XA906, 0XA885, 0XA784, 0XA703, 0XA682, 0XA601, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XD880, 0XD801, 0XD782, 0XD703, 0XD684,
-  0XD605, 0XD506, 0XD486, 0XD407, 0XD388, 0XD309, 0XD209, 0XD18A,
-  0XD10B, 0XD00B, 0XCF8C, 0XCF0C, 0XCE0D, 0XCD8D, 0XCD0E, 0XCC0E,
-  0XCB8F, 0XCA8F, 0XCA0F, 0XC990, 0XC890, 0XC810, 0XC711, 0XC691,
-  0XC591, 0XC511, 0XC411, 0XC312, 0XC292, 0XC192, 0XC112, 0XC012,
-  0XBF92, 0XBE92, 0XBE12, 0XBD12, 0XBC92, 0XBB92, 0XBA92, 0XBA12,
-  0XB912, 0XB891, 0XB791, 0XB711, 0XB611, 0XB590, 0XB510, 0XB410,
-  0XB38F, 0XB28F, 0XB20F, 0XB18E, 0XB08E, 0XB00D, 0XAF8C, 0XAE8C,
-  0XAE0B, 0XAD8B, 0XAC8A, 0XAC09, 0XAB88, 0XAB07, 0XAA86, 0XA985,
-  0XA904, 0XA883, 0XA802, 0XA781, 0XA700, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XD701, 0XD682, 0XD603,
-  0XD583, 0XD504, 0XD485, 0XD386, 0XD307, 0XD287, 0XD208, 0XD109,
-  0XD089, 0XD00A, 0XCF8A, 0XCE8B, 0XCE0B, 0XCD8C, 0XCC8C, 0XCC0D,
-  0XCB0D, 0XCA8E, 0XCA0E, 0XC90E, 0XC88F, 0XC78F, 0XC70F, 0XC60F,
-  0XC58F, 0XC490, 0XC410, 0XC310, 0XC290, 0XC190, 0XC110, 0XC010,
-  0XBF91, 0XBE91, 0XBE11, 0XBD10, 0XBC90, 0XBB90, 0XBB10, 0XBA10,
-  0XB990, 0XB890, 0XB810, 0XB70F, 0XB68F, 0XB58F, 0XB50F, 0XB48E,
-  0XB38E, 0XB30D, 0XB20D, 0XB18C, 0XB10C, 0XB00B, 0XAF8B, 0XAF0A,
-  0XAE89, 0XAD89, 0XAD08, 0XAC87, 0XAC06, 0XAB06, 0XAA85, 0XAA04,
-  0XA983, 0XA902, 0XA881, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XD600, 0XD581,
-  0XD502, 0XD483, 0XD404, 0XD384, 0XD305, 0XD206, 0XD187, 0XD107,
-  0XD088, 0XCF88, 0XCF09, 0XCE89, 0XCD8A, 0XCD0B, 0XCC8B, 0XCB8B,
-  0XCB0C, 0XCA8C, 0XC98C, 0XC90D, 0XC80D, 0XC78D, 0XC70E, 0XC60E,
-  0XC58E, 0XC48E, 0XC40F, 0XC30F, 0XC28F, 0XC18F, 0XC10F, 0XC00F,
-  0XBF8F, 0XBE8F, 0XBE0F, 0XBD0F, 0XBC8F, 0XBB8F, 0XBB0F, 0XBA0F,
-  0XB98F, 0XB88E, 0XB80E, 0XB78E, 0XB68E, 0XB60D, 0XB50D, 0XB48C,
-  0XB40C, 0XB30C, 0XB28B, 0XB20B, 0XB10A, 0XB08A, 0XB009, 0XAF09,
-  0XAE88, 0XAE07, 0XAD86, 0XAC86, 0XAC05, 0XAB84, 0XAB03, 0XAA82,
-  0XAA01, 0XA980, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XD501, 0XD401, 0XD382, 0XD303, 0XD284, 0XD204, 0XD185, 0XD086,
-  0XD006, 0XCF87, 0XCF07, 0XCE08, 0XCD88, 0XCD09, 0XCC09, 0XCB8A,
-  0XCB0A, 0XCA0A, 0XC98B, 0XC90B, 0XC80B, 0XC78C, 0XC68C, 0XC60C,
-  0XC50C, 0XC48C, 0XC40D, 0XC30D, 0XC28D, 0XC18D, 0XC10D, 0XC00D,
-  0XBF8D, 0XBE8D, 0XBE0D, 0XBD0D, 0XBC8D, 0XBB8D, 0XBB0D, 0XBA8D,
-  0XB98D, 0XB90C, 0XB80C, 0XB78C, 0XB68C, 0XB60C, 0XB58B, 0XB48B,
-  0XB40A, 0XB38A, 0XB289, 0XB209, 0XB189, 0XB088, 0XB007, 0XAF87,
-  0XAF06, 0XAE06, 0XAD85, 0XAD04, 0XAC83, 0XAC02, 0XAB81, 0XAA80,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XD381, 0XD301, 0XD202, 0XD183, 0XD104, 0XD084,
-  0XD005, 0XCF05, 0XCE86, 0XCE06, 0XCD87, 0XCC87, 0XCC08, 0XCB88,
-  0XCA89, 0XCA09, 0XC989, 0XC88A, 0XC80A, 0XC70A, 0XC68B, 0XC60B,
-  0XC50B, 0XC48B, 0XC38B, 0XC30B, 0XC28C, 0XC18C, 0XC10C, 0XC00C,
-  0XBF8C, 0XBE8C, 0XBE0C, 0XBD0C, 0XBC8C, 0XBC0C, 0XBB0C, 0XBA8B,
-  0XB98B, 0XB90B, 0XB88B, 0XB78B, 0XB70A, 0XB60A, 0XB589, 0XB509,
-  0XB409, 0XB388, 0XB308, 0XB207, 0XB187, 0XB106, 0XB086, 0XAF85,
-  0XAF04, 0XAE84, 0XAE03, 0XAD82, 0XAC81, 0XAC01, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XD201, 0XD181, 0XD102, 0XD002,
-  0XCF83, 0XCF04, 0XCE84, 0XCD85, 0XCD05, 0XCC86, 0XCC06, 0XCB07,
-  0XCA87, 0XCA07, 0XC908, 0XC888, 0XC808, 0XC709, 0XC689, 0XC589,
-  0XC509, 0XC489, 0XC389, 0XC30A, 0XC20A, 0XC18A, 0XC10A, 0XC00A,
-  0XBF8A, 0XBE8A, 0XBE0A, 0XBD8A, 0XBC8A, 0XBC0A, 0XBB0A, 0XBA89,
-  0XBA09, 0XB909, 0XB889, 0XB789, 0XB709, 0XB688, 0XB588, 0XB507,
-  0XB487, 0XB387, 0XB306, 0XB286, 0XB205, 0XB105, 0XB084, 0XB003,
-  0XAF83, 0XAE82, 0XAE01, 0XAD81, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XD081, 0XD001,
-  0XCF82, 0XCE82, 0XCE03, 0XCD83, 0XCD04, 0XCC04, 0XCB85, 0XCB05,
-  0XCA86, 0XC986, 0XC906, 0XC887, 0XC787, 0XC707, 0XC687, 0XC588,
-  0XC508, 0XC488, 0XC388, 0XC308, 0XC208, 0XC188, 0XC109, 0XC009,
-  0XBF89, 0XBE89, 0XBE09, 0XBD89, 0XBC88, 0XBC08, 0XBB08, 0XBA88,
-  0XBA08, 0XB908, 0XB887, 0XB807, 0XB707, 0XB687, 0XB606, 0XB506,
-  0XB486, 0XB405, 0XB385, 0XB284, 0XB204, 0XB183, 0XB102, 0XB002,
-  0XAF81, 0XAF01, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XCF00, 0XCE81, 0XCE01, 0XCD82, 0XCC82, 0XCC03, 0XCB83, 0XCB04,
-  0XCA04, 0XC984, 0XC904, 0XC805, 0XC785, 0XC706, 0XC606, 0XC586,
-  0XC506, 0XC406, 0XC386, 0XC307, 0XC207, 0XC187, 0XC107, 0XC007,
-  0XBF87, 0XBE87, 0XBE07, 0XBD87, 0XBC87, 0XBC07, 0XBB86, 0XBA86,
-  0XBA06, 0XB986, 0XB886, 0XB806, 0XB785, 0XB685, 0XB604, 0XB584,
-  0XB484, 0XB403, 0XB383, 0XB302, 0XB202, 0XB181, 0XB101, 0XB080,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XCD00, 0XCC81, 0XCC01, 0XCB02, 0XCA82,
-  0XCA02, 0XC983, 0XC883, 0XC804, 0XC784, 0XC704, 0XC604, 0XC584,
-  0XC505, 0XC405, 0XC385, 0XC305, 0XC205, 0XC185, 0XC105, 0XC005,
-  0XBF85, 0XBE85, 0XBE05, 0XBD85, 0XBC85, 0XBC05, 0XBB85, 0XBA85,
-  0XBA05, 0XB984, 0XB884, 0XB804, 0XB784, 0XB703, 0XB603, 0XB583,
-  0XB502, 0XB482, 0XB381, 0XB301, 0XB280, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XCB00, 0XCA81,
-  0XCA01, 0XC901, 0XC881, 0XC802, 0XC782, 0XC682, 0XC603, 0XC583,
-  0XC483, 0XC403, 0XC383, 0XC284, 0XC204, 0XC184, 0XC084, 0XC004,
-  0XBF84, 0XBF04, 0XBE04, 0XBD84, 0XBD04, 0XBC03, 0XBB83, 0XBB03,
-  0XBA03, 0XB983, 0XB903, 0XB802, 0XB782, 0XB702, 0XB681, 0XB581,
-  0XB501, 0XB480, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XC880, 0XC801, 0XC701, 0XC681, 0XC601, 0XC581,
-  0XC482, 0XC402, 0XC382, 0XC282, 0XC202, 0XC182, 0XC082, 0XC002,
-  0XBF82, 0XBF02, 0XBE02, 0XBD82, 0XBD02, 0XBC02, 0XBB82, 0XBB02,
-  0XBA01, 0XB981, 0XB901, 0XB881, 0XB781, 0XB700, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XC480, 0XC400, 0XC380, 0XC281, 0XC201, 0XC181, 0XC081, 0XC001,
-  0XBF81, 0XBF01, 0XBE01, 0XBD81, 0XBD01, 0XBC00, 0XBB80, 0XBB00,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F };
+extern const uint16_t polar[IRIS_WIDTH * IRIS_HEIGHT] asm("goatEye_polar");
@@ -1,13346 +1,30 @@
-#define IRIS_MIN 180 // Override default iris size limits in sketch
+// Generated by tools/assetc -- the tables are linked in from newtEye/*.bin by newtEye.S
+
+#define IRIS_MIN 180
 #define IRIS_MAX 750
 
 #define SCLERA_WIDTH  200
 #define SCLERA_HEIGHT 200
 
-const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] PROGMEM= {
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X96FD, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X8EBC, 0X8E9D, 0X869C, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X867C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X867C, 0X869C, 0X869C, 0X869C, 0X869C, 0X867C,
-  0X867C, 0X867C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X8E9C, 0X8E9C, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FD, 0X96FD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8E9C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X867C,
-  0X867C, 0X867C, 0X867C, 0X865C, 0X865C, 0X865C, 0X865C, 0X867C,
-  0X867C, 0X867C, 0X865C, 0X865C, 0X865C, 0X865C, 0X867C, 0X867C,
-  0X865C, 0X865C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C,
-  0X867C, 0X867C, 0X867C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X96FD, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8E9D, 0X869C, 0X869C, 0X869C, 0X869C, 0X867C, 0X867C,
-  0X867C, 0X867C, 0X865C, 0X865C, 0X865C, 0X865B, 0X865B, 0X865B,
-  0X865B, 0X863B, 0X863B, 0X863B, 0X863B, 0X7E3B, 0X863B, 0X865B,
-  0X7E5B, 0X7E5B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B, 0X863B,
-  0X7E3B, 0X7E3B, 0X7E3B, 0X865B, 0X863B, 0X865B, 0X865B, 0X865B,
-  0X865B, 0X865B, 0X865C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD,
-  0X96FD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBC, 0X869C,
-  0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X865B, 0X865B, 0X865B,
-  0X865B, 0X863B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1A, 0X7E1B, 0X7E1B, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X7E3B, 0X7E3B, 0X7E3B, 0X863B, 0X865B, 0X865B, 0X865B, 0X865C,
-  0X865C, 0X867C, 0X867C, 0X867C, 0X869C, 0X869C, 0X869C, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EFD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X96FD, 0X8EFD, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X8EBD, 0X8E9C, 0X869C, 0X869C, 0X869C, 0X867C,
-  0X867C, 0X865B, 0X865B, 0X865B, 0X863B, 0X7E3B, 0X7E3B, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X7E1A, 0X7E1A, 0X7E1A, 0X7DFA, 0X7DFA, 0X7DFA,
-  0X7E1A, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA,
-  0X7DFB, 0X7DFA, 0X7DFA, 0X7DDA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA,
-  0X7DFA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA,
-  0X7E1A, 0X7E1A, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X865B, 0X865C, 0X865C, 0X865C, 0X867C, 0X867C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X8E9C, 0X8E9D, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X96FD, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X8EBD, 0X869C, 0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X865B,
-  0X865B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1A, 0X7E1A, 0X7DFA,
-  0X7DFA, 0X7DFA, 0X7DFA, 0X75DA, 0X7DDA, 0X7DDA, 0X75DA, 0X75DA,
-  0X75DA, 0X75DA, 0X75B9, 0X75B9, 0X75B9, 0X75BA, 0X75DA, 0X75DA,
-  0X75DA, 0X75DA, 0X75BA, 0X75B9, 0X75B9, 0X75B9, 0X75B9, 0X75B9,
-  0X75B9, 0X75BA, 0X75DA, 0X75FA, 0X75DA, 0X75DA, 0X75DA, 0X75DA,
-  0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E5B, 0X865B, 0X865C, 0X867C,
-  0X867C, 0X867C, 0X867C, 0X869C, 0X869C, 0X869C, 0X869D, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X869C, 0X869C, 0X867C, 0X867B, 0X865B, 0X865B, 0X863B, 0X7E3B,
-  0X7E1B, 0X7E1A, 0X7E1A, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DDA,
-  0X75DA, 0X75D9, 0X75B9, 0X75B9, 0X75B9, 0X75B9, 0X75B9, 0X75B9,
-  0X75B9, 0X75B9, 0X7599, 0X7599, 0X7599, 0X7599, 0X7599, 0X7599,
-  0X7599, 0X7599, 0X7599, 0X7599, 0X7599, 0X7599, 0X7599, 0X7599,
-  0X7599, 0X7599, 0X7599, 0X75BA, 0X75BA, 0X7599, 0X7599, 0X75B9,
-  0X75BA, 0X75BA, 0X75B9, 0X75B9, 0X75DA, 0X7DDA, 0X7DFA, 0X7DFA,
-  0X7DFA, 0X7DFA, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E5B,
-  0X865B, 0X865B, 0X865C, 0X867C, 0X867C, 0X867C, 0X869C, 0X869C,
-  0X869C, 0X8E9D, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD, 0X86BC, 0X869C, 0X86BC, 0X869C,
-  0X867C, 0X865C, 0X865B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7DFA,
-  0X7DFA, 0X7DFA, 0X7DDA, 0X75DA, 0X75D9, 0X75B9, 0X75B9, 0X75B9,
-  0X7599, 0X7599, 0X7599, 0X7599, 0X7578, 0X7579, 0X7579, 0X6D78,
-  0X6D78, 0X6D79, 0X6D79, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58,
-  0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58,
-  0X6D58, 0X6D58, 0X6D58, 0X7599, 0X7599, 0X6D79, 0X6D78, 0X6D78,
-  0X7599, 0X7599, 0X7599, 0X7599, 0X7599, 0X75B9, 0X75DA, 0X75DA,
-  0X75DA, 0X75DA, 0X7DFA, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B,
-  0X7E1B, 0X7E3B, 0X865B, 0X865B, 0X865B, 0X867C, 0X867C, 0X867C,
-  0X869C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X8EBD, 0X8E9C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X867B,
-  0X863B, 0X7E3B, 0X7E1B, 0X7E1A, 0X7DFA, 0X7E1A, 0X7DFA, 0X7DDA,
-  0X75DA, 0X75B9, 0X75B9, 0X75B9, 0X7599, 0X7599, 0X7599, 0X6D78,
-  0X6D78, 0X6D78, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58,
-  0X6D58, 0X6D38, 0X6D58, 0X6D37, 0X6D37, 0X6D37, 0X6D37, 0X6D37,
-  0X6D37, 0X6D37, 0X6D37, 0X6D17, 0X6D37, 0X6D37, 0X6D37, 0X6D37,
-  0X6D37, 0X6D37, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D58,
-  0X6D58, 0X6D78, 0X6D78, 0X6D58, 0X7578, 0X7599, 0X7599, 0X7599,
-  0X7599, 0X75B9, 0X75DA, 0X75DA, 0X75FA, 0X7E1B, 0X7E1A, 0X7DFA,
-  0X7DFA, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E5B, 0X865B, 0X865C,
-  0X867C, 0X867C, 0X869C, 0X86BD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X869C, 0X867C, 0X7E3B,
-  0X7E1B, 0X7E1A, 0X7DFA, 0X7DFA, 0X7DFA, 0X7DFA, 0X75D9, 0X75B9,
-  0X75B9, 0X7599, 0X7599, 0X6D78, 0X6D78, 0X6D78, 0X6D58, 0X6D58,
-  0X6D58, 0X6D38, 0X6D37, 0X6D37, 0X6D37, 0X6517, 0X6D38, 0X6D38,
-  0X6517, 0X6517, 0X6517, 0X6517, 0X64F7, 0X64F7, 0X64F6, 0X64F7,
-  0X64F7, 0X64F7, 0X6517, 0X64F7, 0X64F7, 0X64F7, 0X64F7, 0X64F7,
-  0X64F7, 0X6517, 0X6517, 0X6517, 0X6D38, 0X6D38, 0X6517, 0X6D17,
-  0X6D38, 0X6D38, 0X6D38, 0X6D38, 0X6D58, 0X6D58, 0X6D78, 0X7578,
-  0X7578, 0X7579, 0X7599, 0X75B9, 0X75DA, 0X75FA, 0X75FA, 0X75FA,
-  0X75FA, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E3B,
-  0X7E5B, 0X867C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X8E9C,
-  0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C,
-  0X867C, 0X867C, 0X865B, 0X865B, 0X865B, 0X867C, 0X7E5C, 0X7E1B,
-  0X7DFA, 0X7DFA, 0X75DA, 0X75B9, 0X75B9, 0X75D9, 0X7599, 0X7599,
-  0X6D78, 0X6D78, 0X6D58, 0X6D58, 0X6D58, 0X6D38, 0X6D37, 0X6537,
-  0X6517, 0X6517, 0X6517, 0X64F7, 0X64F7, 0X64F7, 0X64F7, 0X64F7,
-  0X64F6, 0X64D6, 0X64F6, 0X64F7, 0X64D6, 0X64D6, 0X64B6, 0X64D6,
-  0X64D6, 0X64D6, 0X64D6, 0X64D6, 0X64D6, 0X64D6, 0X64D6, 0X64D6,
-  0X64D7, 0X64F7, 0X64F7, 0X64F7, 0X6517, 0X6517, 0X64F7, 0X64F7,
-  0X64F7, 0X6517, 0X6517, 0X6517, 0X6D17, 0X6D38, 0X6D38, 0X6D58,
-  0X6D58, 0X6D58, 0X6D79, 0X7599, 0X6DB9, 0X75DA, 0X75FB, 0X75FB,
-  0X75FA, 0X75DA, 0X75FA, 0X75FA, 0X7DFA, 0X7DFB, 0X7E1B, 0X7E1B,
-  0X7E5C, 0X867C, 0X865C, 0X865C, 0X867C, 0X867C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X867C,
-  0X865B, 0X863B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E5B, 0X7E7C, 0X7DFA,
-  0X75DA, 0X75B9, 0X75B9, 0X7599, 0X7599, 0X75B9, 0X6D78, 0X6D58,
-  0X6D58, 0X6D38, 0X6D37, 0X6D37, 0X6517, 0X6517, 0X6517, 0X64F7,
-  0X64F6, 0X64F6, 0X64D6, 0X64D6, 0X64D6, 0X64D6, 0X5CB6, 0X64D6,
-  0X64B6, 0X5CB6, 0X5CB5, 0X64D6, 0X5CB6, 0X5C95, 0X5C95, 0X5C95,
-  0X5C95, 0X5C95, 0X5C95, 0X5C95, 0X5C95, 0X5C95, 0X5C95, 0X5C96,
-  0X5C96, 0X5CB6, 0X64D6, 0X5CB6, 0X64D6, 0X64F7, 0X64B6, 0X64B6,
-  0X64D6, 0X64F7, 0X64F7, 0X64F7, 0X64F7, 0X64F7, 0X6517, 0X6517,
-  0X6D18, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D9A, 0X75DA, 0X75DA,
-  0X75B9, 0X75B9, 0X75B9, 0X75DA, 0X75DA, 0X75DA, 0X7DFA, 0X7E1B,
-  0X7E3B, 0X7E3B, 0X7E1B, 0X7E3B, 0X7E3B, 0X865C, 0X867C, 0X867C,
-  0X869C, 0X869C, 0X869C, 0X869D, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X8EBD, 0X869C, 0X869C, 0X869C, 0X867C, 0X865B, 0X865B,
-  0X7E3B, 0X7E1B, 0X7E1A, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E5B, 0X75FA,
-  0X7599, 0X7599, 0X6D78, 0X6D78, 0X6D78, 0X6D78, 0X6D37, 0X6D37,
-  0X6517, 0X6517, 0X6517, 0X64F7, 0X64F6, 0X64D6, 0X64D6, 0X64D6,
-  0X64B6, 0X5CB6, 0X5CB5, 0X5CB6, 0X5C96, 0X5C95, 0X5C95, 0X5C95,
-  0X5C95, 0X5C95, 0X5C75, 0X5C95, 0X5C96, 0X5C75, 0X5C54, 0X5C55,
-  0X5455, 0X5C55, 0X5C55, 0X5C75, 0X5C75, 0X5C75, 0X5C75, 0X5C75,
-  0X5C75, 0X5C75, 0X5C96, 0X5C96, 0X5CB6, 0X5CD6, 0X5C96, 0X5C95,
-  0X5CB6, 0X5CD6, 0X64D6, 0X64B6, 0X64B6, 0X64D6, 0X64D6, 0X64D7,
-  0X6517, 0X6518, 0X6D17, 0X6D37, 0X6D38, 0X6D79, 0X6D99, 0X6D99,
-  0X6D78, 0X7578, 0X7599, 0X7599, 0X75B9, 0X75BA, 0X75DA, 0X75FA,
-  0X7DFA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E1B, 0X7E3B, 0X865C, 0X867C,
-  0X867C, 0X867C, 0X869C, 0X869C, 0X869C, 0X869C, 0X8E9C, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD,
-  0X869C, 0X869C, 0X869C, 0X867C, 0X865C, 0X865C, 0X863B, 0X7E1B,
-  0X7E1B, 0X7DFA, 0X7DFA, 0X75DA, 0X75B9, 0X75DA, 0X763B, 0X761A,
-  0X6D99, 0X6D58, 0X6D58, 0X6D38, 0X6D58, 0X6D58, 0X6517, 0X64F7,
-  0X64F6, 0X64F6, 0X64D6, 0X64D6, 0X5CB6, 0X5CB6, 0X5CB5, 0X5C95,
-  0X5C95, 0X5C95, 0X5C75, 0X5C75, 0X5C75, 0X5C54, 0X5454, 0X5454,
-  0X5C75, 0X5454, 0X5434, 0X5434, 0X5455, 0X5455, 0X5434, 0X5434,
-  0X5435, 0X5434, 0X5434, 0X5434, 0X5434, 0X5434, 0X5434, 0X5434,
-  0X5434, 0X5434, 0X5455, 0X5455, 0X5C75, 0X5CB6, 0X5C95, 0X5455,
-  0X5C75, 0X5C95, 0X5C95, 0X5C95, 0X5C95, 0X5C96, 0X5CB6, 0X5CB6,
-  0X64D7, 0X64F7, 0X64F7, 0X64F7, 0X6517, 0X6D38, 0X6D58, 0X6D79,
-  0X6D58, 0X6D58, 0X6D58, 0X6D99, 0X7599, 0X75B9, 0X75DA, 0X75DA,
-  0X75BA, 0X75DA, 0X7DDA, 0X7DFA, 0X7DFA, 0X7E3B, 0X7E5C, 0X7E5C,
-  0X865C, 0X865C, 0X867C, 0X869C, 0X867C, 0X867C, 0X869C, 0X869C,
-  0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8E9C, 0X869C,
-  0X869C, 0X867C, 0X867C, 0X865B, 0X863B, 0X7E3B, 0X7E3B, 0X7E1A,
-  0X7DFA, 0X75DA, 0X75B9, 0X75B9, 0X7599, 0X7599, 0X75FA, 0X763B,
-  0X6D99, 0X6D37, 0X6D37, 0X6517, 0X6D38, 0X6537, 0X64D6, 0X64D6,
-  0X64D6, 0X5CB6, 0X5CB6, 0X5C95, 0X5C95, 0X5C95, 0X5C75, 0X5C75,
-  0X5454, 0X5454, 0X5454, 0X5454, 0X5434, 0X5434, 0X5434, 0X5413,
-  0X5434, 0X5435, 0X5435, 0X5435, 0X5414, 0X5434, 0X5414, 0X53F3,
-  0X5413, 0X53F3, 0X5413, 0X5413, 0X4BF3, 0X5414, 0X5414, 0X5413,
-  0X53F3, 0X5414, 0X5434, 0X5434, 0X5434, 0X5475, 0X5475, 0X5434,
-  0X5434, 0X5475, 0X5C75, 0X5C54, 0X5C75, 0X5C75, 0X5C75, 0X5C96,
-  0X5C96, 0X5CB6, 0X64D6, 0X64D6, 0X64F7, 0X64F7, 0X6517, 0X6D38,
-  0X6D58, 0X6D38, 0X6D38, 0X6D78, 0X6D79, 0X6D79, 0X6D99, 0X7599,
-  0X7599, 0X75B9, 0X75B9, 0X75DA, 0X75DA, 0X75FA, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X7E3B, 0X865C, 0X867C, 0X865C, 0X867C, 0X867C, 0X869C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBC, 0X869C, 0X869C, 0X869C,
-  0X867C, 0X865B, 0X863B, 0X7E3B, 0X7E1B, 0X7E1A, 0X7E1B, 0X7DFA,
-  0X75B9, 0X75B9, 0X7599, 0X7578, 0X6D79, 0X6D79, 0X6D79, 0X6DFA,
-  0X6DBA, 0X6517, 0X64F7, 0X64F6, 0X6517, 0X64F7, 0X64B6, 0X5CB6,
-  0X5C95, 0X5C95, 0X5C75, 0X5C75, 0X5C55, 0X5C54, 0X5454, 0X5434,
-  0X5434, 0X5413, 0X5414, 0X5413, 0X5413, 0X53F3, 0X4BF3, 0X4BF3,
-  0X4C14, 0X5435, 0X4C14, 0X4C14, 0X4BF3, 0X4BF3, 0X4BF3, 0X4BD3,
-  0X4BD3, 0X4BD3, 0X4BD3, 0X4BD2, 0X4BD2, 0X4BD3, 0X4BD3, 0X4BD2,
-  0X4BD2, 0X4BD3, 0X4BF4, 0X4BF3, 0X4BF3, 0X5434, 0X5475, 0X5435,
-  0X5414, 0X5434, 0X5434, 0X5414, 0X5434, 0X5434, 0X5C55, 0X5C75,
-  0X5C75, 0X5C75, 0X5C95, 0X5CB6, 0X64B6, 0X64D6, 0X64D7, 0X64F7,
-  0X6517, 0X6517, 0X6517, 0X6538, 0X6D58, 0X6D58, 0X6D58, 0X6D78,
-  0X6D79, 0X7599, 0X7599, 0X7599, 0X75BA, 0X75DA, 0X75FA, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X7E3B, 0X865C, 0X865B, 0X865C, 0X865C, 0X867C,
-  0X867C, 0X869C, 0X869C, 0X8EBC, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X8EBD, 0X8E9C, 0X869C, 0X869C, 0X867C, 0X865C,
-  0X865B, 0X7E3B, 0X7E1B, 0X7E1A, 0X7DFA, 0X7DDA, 0X75FA, 0X75D9,
-  0X7599, 0X7579, 0X6D78, 0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6DFA,
-  0X6DB9, 0X64F7, 0X64D6, 0X64B6, 0X6517, 0X5CD6, 0X5C95, 0X5C95,
-  0X5C75, 0X5C54, 0X5454, 0X5434, 0X5434, 0X5414, 0X5413, 0X5413,
-  0X53F3, 0X53F3, 0X4BF3, 0X4BD3, 0X4BD2, 0X4BD2, 0X4BD2, 0X4BB3,
-  0X4BF4, 0X4BD3, 0X4BD2, 0X4BB2, 0X4BB2, 0X4BB2, 0X4BD3, 0X4B92,
-  0X4392, 0X4392, 0X4392, 0X4392, 0X4392, 0X4BB2, 0X4BB2, 0X4BB2,
-  0X4B92, 0X4BB2, 0X4BB2, 0X4BD2, 0X4BB2, 0X4BD2, 0X5434, 0X4C14,
-  0X4BF4, 0X4BF3, 0X53F3, 0X53F3, 0X53F3, 0X5414, 0X5434, 0X5455,
-  0X5434, 0X5454, 0X5475, 0X5C75, 0X5C96, 0X5CB6, 0X5CB6, 0X5CB6,
-  0X64D6, 0X64F7, 0X64F7, 0X6517, 0X6538, 0X6537, 0X6D37, 0X6D38,
-  0X6D58, 0X6D58, 0X6D78, 0X7579, 0X7599, 0X75B9, 0X75DA, 0X75FA,
-  0X7E1B, 0X7DFA, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B, 0X865B,
-  0X865C, 0X867C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X8EBC, 0X869C, 0X869C, 0X867C, 0X865C, 0X865B, 0X863B,
-  0X7E1B, 0X7E1A, 0X7DFA, 0X7DFA, 0X75DA, 0X75B9, 0X75B9, 0X75B9,
-  0X6D78, 0X6D58, 0X6D37, 0X6D37, 0X6517, 0X6538, 0X6D9A, 0X6DDA,
-  0X6537, 0X64D6, 0X5CB6, 0X5CB6, 0X5CD6, 0X5C95, 0X5C75, 0X5454,
-  0X5434, 0X5434, 0X5413, 0X5413, 0X53F3, 0X53F3, 0X4BF3, 0X4BD2,
-  0X4BD2, 0X4BD2, 0X4BB2, 0X4BB2, 0X4BB2, 0X4BB2, 0X4B92, 0X4392,
-  0X43B3, 0X4BD3, 0X4392, 0X4392, 0X4392, 0X4392, 0X4392, 0X4371,
-  0X4371, 0X4352, 0X4372, 0X4351, 0X4351, 0X4371, 0X4372, 0X4372,
-  0X4371, 0X4371, 0X4372, 0X4B92, 0X4B92, 0X4391, 0X4BF3, 0X4BD3,
-  0X4BD3, 0X4BD3, 0X4BD3, 0X4BD3, 0X4BD3, 0X4BF3, 0X4BF4, 0X53F4,
-  0X5414, 0X5414, 0X5414, 0X5434, 0X5475, 0X5C75, 0X5C95, 0X5C95,
-  0X5CB6, 0X5CB6, 0X5CD6, 0X64F7, 0X64F7, 0X64F7, 0X6517, 0X6517,
-  0X6D37, 0X6D38, 0X6D58, 0X6D58, 0X6D78, 0X7579, 0X75B9, 0X75DA,
-  0X75FA, 0X75FA, 0X75FA, 0X75FA, 0X7DFA, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X863B, 0X865B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8E9C, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD,
-  0X8E9C, 0X869C, 0X867C, 0X867C, 0X865B, 0X865B, 0X7E3B, 0X7E1B,
-  0X7DFA, 0X7DFA, 0X75DA, 0X75B9, 0X75B9, 0X7599, 0X6D78, 0X7599,
-  0X6D78, 0X6D17, 0X6517, 0X6517, 0X64F7, 0X6518, 0X6DDA, 0X6599,
-  0X5CD6, 0X5C95, 0X5C75, 0X5CB6, 0X5CB6, 0X5434, 0X5434, 0X5434,
-  0X5413, 0X53F3, 0X53F3, 0X4BF3, 0X4BD3, 0X4BD2, 0X4BB2, 0X4BB2,
-  0X4BB2, 0X4B92, 0X4392, 0X4371, 0X4371, 0X4371, 0X4371, 0X4392,
-  0X4392, 0X4371, 0X4351, 0X4351, 0X4351, 0X4372, 0X4371, 0X4330,
-  0X4330, 0X4351, 0X4352, 0X4330, 0X4330, 0X4331, 0X4351, 0X4351,
-  0X4351, 0X4350, 0X4351, 0X4351, 0X4351, 0X4350, 0X4BB2, 0X4BB3,
-  0X4392, 0X4BB3, 0X4BD3, 0X4BB2, 0X4BB3, 0X4BB3, 0X4BD3, 0X4BD3,
-  0X53F3, 0X53F3, 0X53F3, 0X5413, 0X5434, 0X5434, 0X5454, 0X5475,
-  0X5C75, 0X5C95, 0X5CB6, 0X5CF8, 0X64D6, 0X64D6, 0X64D6, 0X64D7,
-  0X64F7, 0X64F7, 0X6D17, 0X6D38, 0X6D38, 0X6D58, 0X6D79, 0X6D99,
-  0X6DB9, 0X75DA, 0X75DA, 0X75DA, 0X75DA, 0X7DFA, 0X7DFA, 0X7E1A,
-  0X7E1B, 0X7E3B, 0X863B, 0X865B, 0X867C, 0X867C, 0X869C, 0X8E9C,
-  0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C,
-  0X869C, 0X867C, 0X867C, 0X865B, 0X863B, 0X7E3B, 0X7E1A, 0X7DFA,
-  0X7DDA, 0X75D9, 0X75B9, 0X7599, 0X7579, 0X6D78, 0X6D58, 0X6D58,
-  0X6D58, 0X6517, 0X64F6, 0X64D6, 0X64B6, 0X6518, 0X65DA, 0X6558,
-  0X5C75, 0X5475, 0X5454, 0X54B6, 0X5475, 0X5413, 0X53F3, 0X4BF3,
-  0X4BF3, 0X4BD3, 0X4BD3, 0X4BB2, 0X4BB2, 0X4391, 0X4391, 0X4371,
-  0X4371, 0X4371, 0X4351, 0X4351, 0X4351, 0X4351, 0X4351, 0X4351,
-  0X4350, 0X4330, 0X3B30, 0X3B30, 0X3B30, 0X3B30, 0X3B51, 0X3B10,
-  0X3B0F, 0X3B0F, 0X3B10, 0X3B10, 0X3B0F, 0X3B10, 0X3B30, 0X3B10,
-  0X3B10, 0X3B10, 0X3B30, 0X4330, 0X3B30, 0X3B10, 0X4371, 0X4392,
-  0X4351, 0X4351, 0X4372, 0X4372, 0X4372, 0X4372, 0X4BB2, 0X4BD2,
-  0X4BD2, 0X4BD2, 0X4BD2, 0X4BD3, 0X53F3, 0X5413, 0X5414, 0X5434,
-  0X5454, 0X5475, 0X5C96, 0X5CB7, 0X5C96, 0X5CB6, 0X64B6, 0X64B6,
-  0X64D6, 0X64D6, 0X64F7, 0X6517, 0X6D17, 0X6D38, 0X6D58, 0X6D58,
-  0X6D79, 0X6DB9, 0X6DBA, 0X75BA, 0X75DA, 0X75FA, 0X75FA, 0X7DFA,
-  0X7E1A, 0X7E1B, 0X7E1B, 0X7E3B, 0X865B, 0X865C, 0X867C, 0X869C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBC, 0X869C, 0X869C,
-  0X867C, 0X865B, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DFA, 0X75DA,
-  0X75B9, 0X7599, 0X7579, 0X6D78, 0X6D58, 0X6D58, 0X6D37, 0X64F7,
-  0X6537, 0X6517, 0X64B6, 0X5CB5, 0X5C95, 0X5CF7, 0X65DA, 0X5D37,
-  0X5454, 0X5434, 0X5434, 0X5495, 0X5434, 0X4BD3, 0X4BD2, 0X4BB2,
-  0X4BB2, 0X4BB2, 0X4B92, 0X4392, 0X4391, 0X4371, 0X4351, 0X4351,
-  0X4351, 0X4330, 0X3B30, 0X3B30, 0X3B10, 0X3B10, 0X3B10, 0X3B10,
-  0X3AEF, 0X3AEF, 0X3AEF, 0X3AEF, 0X3B10, 0X3AF0, 0X3B11, 0X3AEF,
-  0X3ACF, 0X3ACF, 0X3ACF, 0X3AEF, 0X3AEF, 0X3ACF, 0X3ACF, 0X3ACF,
-  0X3ACF, 0X3ACF, 0X3AEF, 0X3AEF, 0X3AEF, 0X3AEF, 0X3B30, 0X4371,
-  0X3B50, 0X3B10, 0X4330, 0X4331, 0X4331, 0X4351, 0X4371, 0X4391,
-  0X4392, 0X4B92, 0X4BB2, 0X4BB2, 0X4BD3, 0X4BD3, 0X4BF3, 0X4C13,
-  0X5434, 0X5455, 0X5475, 0X5475, 0X5C75, 0X5C95, 0X5C95, 0X5C95,
-  0X6495, 0X64B6, 0X64D6, 0X64F7, 0X64F7, 0X6517, 0X6D38, 0X6D58,
-  0X6D58, 0X6D79, 0X6D79, 0X7599, 0X75B9, 0X75B9, 0X75DA, 0X75FA,
-  0X7DFA, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X863B, 0X865B, 0X867C,
-  0X869C, 0X869C, 0X8E9C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865C,
-  0X865B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DFA, 0X75D9, 0X75B9,
-  0X7599, 0X6D78, 0X6D58, 0X6D58, 0X6D38, 0X6D17, 0X64F7, 0X64D6,
-  0X64F7, 0X64F7, 0X5CB5, 0X5C75, 0X5C75, 0X5C96, 0X65DA, 0X5D37,
-  0X5414, 0X53F3, 0X5414, 0X5454, 0X4BD3, 0X4BD2, 0X4BB2, 0X4391,
-  0X4371, 0X4371, 0X4371, 0X4350, 0X4351, 0X4351, 0X3B30, 0X3B30,
-  0X3B10, 0X3B0F, 0X3B0F, 0X3AEF, 0X3AEF, 0X3AEF, 0X3ACF, 0X3AEF,
-  0X3ACF, 0X32CE, 0X32CE, 0X32AE, 0X3AF0, 0X32CF, 0X32F0, 0X32CF,
-  0X32AF, 0X32AF, 0X32AE, 0X32AE, 0X3AAF, 0X32AF, 0X32AE, 0X32AE,
-  0X32AE, 0X32AE, 0X32AE, 0X3ACF, 0X3ACE, 0X3ACE, 0X3AEF, 0X3B50,
-  0X3B30, 0X3AEF, 0X3AEF, 0X3B10, 0X3B30, 0X3B30, 0X4330, 0X4350,
-  0X4351, 0X4371, 0X4371, 0X4392, 0X43B2, 0X4BB2, 0X4BD2, 0X4BD3,
-  0X4BF3, 0X5414, 0X5434, 0X5434, 0X5434, 0X5455, 0X5475, 0X5C75,
-  0X5C75, 0X5C95, 0X64B6, 0X64D6, 0X64D6, 0X64F7, 0X6517, 0X6578,
-  0X6D58, 0X6D58, 0X6D58, 0X6D58, 0X6D79, 0X7599, 0X75B9, 0X75B9,
-  0X75DA, 0X75FA, 0X7DFA, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E5B, 0X865B,
-  0X867C, 0X867C, 0X869C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EBD, 0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865C, 0X863B,
-  0X7E3B, 0X7E1B, 0X7E1B, 0X7DFA, 0X75DA, 0X75DA, 0X7599, 0X7578,
-  0X6D78, 0X6D58, 0X6D38, 0X6D38, 0X6517, 0X64F7, 0X64D6, 0X5CB6,
-  0X5C96, 0X64D6, 0X5CB6, 0X5454, 0X5434, 0X5455, 0X6599, 0X5D58,
-  0X4BF3, 0X4BD3, 0X4C14, 0X4BF3, 0X4392, 0X4B92, 0X4392, 0X4371,
-  0X4351, 0X4351, 0X4350, 0X3B30, 0X3B30, 0X3B10, 0X3B0F, 0X3AEF,
-  0X3AEF, 0X3AEF, 0X3ACE, 0X32CE, 0X32CE, 0X32AE, 0X32AE, 0X32AE,
-  0X32AE, 0X32AE, 0X328D, 0X328D, 0X32AE, 0X328E, 0X32AF, 0X32AF,
-  0X328E, 0X328E, 0X328D, 0X328D, 0X328D, 0X328E, 0X328E, 0X328E,
-  0X328E, 0X328D, 0X328E, 0X328E, 0X328E, 0X328E, 0X3ACF, 0X3B30,
-  0X3AEF, 0X3AAF, 0X3ACF, 0X3AEF, 0X3B10, 0X3B30, 0X3B0F, 0X3B10,
-  0X4330, 0X4330, 0X4330, 0X4351, 0X4371, 0X4371, 0X4392, 0X4BB2,
-  0X4BD2, 0X4BF3, 0X4C14, 0X5414, 0X5414, 0X5434, 0X5434, 0X5454,
-  0X5C55, 0X5C75, 0X5C95, 0X5C96, 0X64B6, 0X64D6, 0X6538, 0X6558,
-  0X6538, 0X6D38, 0X6D38, 0X6D37, 0X6D38, 0X6D58, 0X6D79, 0X7599,
-  0X75B9, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E3B,
-  0X865B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EBD, 0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865B, 0X863B, 0X7E3B,
-  0X7E1B, 0X7DFA, 0X7DFA, 0X75DA, 0X75B9, 0X7599, 0X7579, 0X6D58,
-  0X6D38, 0X6D17, 0X6517, 0X64F7, 0X64D6, 0X64B6, 0X5CB6, 0X5C95,
-  0X5C75, 0X5C75, 0X5CB6, 0X5434, 0X53F3, 0X5413, 0X54F7, 0X5D78,
-  0X4C34, 0X4BF3, 0X4C34, 0X43F3, 0X4371, 0X4351, 0X4350, 0X4350,
-  0X4330, 0X3B30, 0X3B10, 0X3AEF, 0X3AEF, 0X3AEF, 0X3ACF, 0X3ACF,
-  0X3ACF, 0X32AE, 0X32AE, 0X32AD, 0X328D, 0X328E, 0X328E, 0X328E,
-  0X326D, 0X326D, 0X2A6D, 0X2A6C, 0X326D, 0X326E, 0X328F, 0X2AAF,
-  0X2A4D, 0X2A4D, 0X2A4D, 0X2A4C, 0X2A4C, 0X2A4D, 0X324D, 0X324D,
-  0X326E, 0X326E, 0X326D, 0X326D, 0X2A4D, 0X326D, 0X32AE, 0X330F,
-  0X32CE, 0X328E, 0X32AE, 0X32AF, 0X3ACF, 0X3AEF, 0X3AEF, 0X3AEF,
-  0X3AEF, 0X3AEF, 0X3B10, 0X3B30, 0X4351, 0X4330, 0X4351, 0X4391,
-  0X43B2, 0X4BD3, 0X4BD3, 0X4BD3, 0X4BF3, 0X4BF3, 0X5414, 0X5434,
-  0X5434, 0X5C54, 0X5C55, 0X5C75, 0X5C95, 0X5CB6, 0X5D38, 0X6517,
-  0X64F7, 0X6517, 0X6517, 0X6517, 0X6517, 0X6D37, 0X6D58, 0X6D78,
-  0X6D99, 0X75B9, 0X75DA, 0X75DA, 0X75DA, 0X7DFA, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X863B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X865B, 0X863B, 0X7E1B, 0X7E1A,
-  0X7DFA, 0X7DDA, 0X75DA, 0X75B9, 0X7599, 0X6D78, 0X6D58, 0X6D37,
-  0X6517, 0X64F7, 0X64F7, 0X64D6, 0X5CB6, 0X5C95, 0X5C75, 0X5C75,
-  0X5454, 0X5434, 0X5C75, 0X5475, 0X4BF3, 0X4BD3, 0X5414, 0X54F7,
-  0X4CF6, 0X4C13, 0X43D2, 0X43F3, 0X4371, 0X3B30, 0X3B30, 0X3B0F,
-  0X3AEF, 0X3AF0, 0X3AEF, 0X3AEF, 0X3ACF, 0X32AE, 0X32AE, 0X32AF,
-  0X32AE, 0X328E, 0X328D, 0X2A6D, 0X2A6D, 0X2A6D, 0X324D, 0X2A4D,
-  0X2A4C, 0X2A4C, 0X2A2C, 0X2A2C, 0X2A2C, 0X2A4D, 0X2A6E, 0X2A4D,
-  0X2A2C, 0X2A2C, 0X2A2B, 0X2A2C, 0X2A2C, 0X2A2C, 0X2A2C, 0X2A2C,
-  0X2A2C, 0X2A2C, 0X2A4D, 0X324D, 0X2A2C, 0X2A4C, 0X326D, 0X32AE,
-  0X32AE, 0X326D, 0X328E, 0X328F, 0X328E, 0X32AE, 0X32CF, 0X32CE,
-  0X32AE, 0X3ACF, 0X3AEF, 0X3AEF, 0X3B10, 0X3B30, 0X3B30, 0X4351,
-  0X4392, 0X4392, 0X4392, 0X43B2, 0X4BB2, 0X4BD3, 0X53F3, 0X53F3,
-  0X53F3, 0X5414, 0X5434, 0X5454, 0X5C75, 0X5CB6, 0X5D37, 0X5CF7,
-  0X64D6, 0X64D6, 0X64D7, 0X64F7, 0X64F7, 0X6517, 0X6517, 0X6D38,
-  0X6D78, 0X6D99, 0X75B9, 0X75B9, 0X75DA, 0X75DA, 0X7DFA, 0X7E1B,
-  0X7E3B, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X86BD, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBC,
-  0X869C, 0X867C, 0X867C, 0X865B, 0X863B, 0X7E1B, 0X7DFA, 0X7DFA,
-  0X7DDA, 0X75B9, 0X75B9, 0X7599, 0X6D79, 0X6D58, 0X6D37, 0X6517,
-  0X64F7, 0X64D6, 0X64B6, 0X5C96, 0X5C95, 0X5C74, 0X5454, 0X5434,
-  0X5414, 0X53F3, 0X5434, 0X4C54, 0X4C13, 0X4BF3, 0X4BB2, 0X4C55,
-  0X5558, 0X4433, 0X43B2, 0X43F3, 0X3B92, 0X3B0F, 0X3AEF, 0X3AEF,
-  0X3ACE, 0X3ACF, 0X32AE, 0X32AE, 0X32AF, 0X32AF, 0X328E, 0X326E,
-  0X326D, 0X2A6C, 0X2A4C, 0X2A4C, 0X2A2C, 0X2A2C, 0X2A2C, 0X2A2C,
-  0X2A2C, 0X2A0B, 0X2A0B, 0X2A0B, 0X2A0B, 0X2A0C, 0X220D, 0X21EB,
-  0X21EB, 0X220C, 0X21EB, 0X21EA, 0X21EB, 0X21EB, 0X21EB, 0X21EB,
-  0X29EB, 0X29EB, 0X2A0C, 0X2A2D, 0X2A2D, 0X2A2C, 0X2A2C, 0X326D,
-  0X328D, 0X2A4C, 0X2A4D, 0X326E, 0X326D, 0X326D, 0X328E, 0X32AE,
-  0X32AE, 0X32AE, 0X3AAE, 0X3ACE, 0X3ACF, 0X3B0F, 0X3B0F, 0X3B30,
-  0X4371, 0X4371, 0X4371, 0X4392, 0X4392, 0X4BB2, 0X4BD3, 0X4BD3,
-  0X4BD3, 0X4BF3, 0X5414, 0X5434, 0X5434, 0X5496, 0X54F7, 0X5CB6,
-  0X5CB6, 0X64B6, 0X64B6, 0X64D6, 0X64F6, 0X64F7, 0X64F7, 0X6517,
-  0X6D37, 0X6D58, 0X6D78, 0X7579, 0X7599, 0X75B9, 0X75DA, 0X75FA,
-  0X7E1B, 0X7E3B, 0X7E5B, 0X7E5C, 0X867C, 0X869C, 0X86BD, 0X8EBD,
-  0X8EDD, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C,
-  0X867C, 0X865C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75DA,
-  0X75B9, 0X7599, 0X7599, 0X6D78, 0X6D58, 0X6D37, 0X64F7, 0X64F6,
-  0X64D6, 0X64B6, 0X5C95, 0X5C75, 0X5C74, 0X5434, 0X5414, 0X5413,
-  0X53F3, 0X53D3, 0X4BF3, 0X4BD3, 0X43B2, 0X4BD2, 0X4BD3, 0X43D3,
-  0X4CB6, 0X4495, 0X4475, 0X4475, 0X3BF4, 0X3B30, 0X32AE, 0X32AE,
-  0X32AE, 0X32AE, 0X328D, 0X326D, 0X326D, 0X326D, 0X326D, 0X2A4D,
-  0X2A2C, 0X2A2C, 0X2A2B, 0X2A2B, 0X2A0B, 0X2A0B, 0X220B, 0X21EB,
-  0X29EB, 0X21EB, 0X21EA, 0X21CA, 0X21CB, 0X21EB, 0X21EB, 0X21EB,
-  0X21C9, 0X21CB, 0X21CC, 0X21CA, 0X21CA, 0X21CA, 0X21CA, 0X21CA,
-  0X21CA, 0X21CB, 0X29EB, 0X29EB, 0X2A0C, 0X2A0C, 0X29EB, 0X2A2C,
-  0X2A4C, 0X2A0C, 0X2A2D, 0X2A4E, 0X2A2C, 0X2A2C, 0X324C, 0X326D,
-  0X326D, 0X328D, 0X328D, 0X32AE, 0X32AE, 0X32CF, 0X3AEF, 0X3B10,
-  0X3B50, 0X4351, 0X4351, 0X4351, 0X4351, 0X4371, 0X4BB2, 0X4BB2,
-  0X4BB2, 0X4BB3, 0X4BF3, 0X5414, 0X5434, 0X5455, 0X5496, 0X5496,
-  0X5C96, 0X5C96, 0X5C95, 0X5C95, 0X5CB6, 0X64D6, 0X64F6, 0X64F7,
-  0X6517, 0X6538, 0X6D58, 0X6D58, 0X6D79, 0X7599, 0X75B9, 0X75DA,
-  0X75FA, 0X7E1B, 0X7E3B, 0X7E5B, 0X7E7C, 0X869C, 0X86BC, 0X86BC,
-  0X86BC, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X867C,
-  0X865B, 0X863B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75B9, 0X75B9,
-  0X7599, 0X7579, 0X6D58, 0X6D58, 0X6D38, 0X64F7, 0X64D6, 0X64D6,
-  0X64B6, 0X5C95, 0X5C75, 0X5454, 0X5434, 0X5414, 0X53F3, 0X4BF3,
-  0X4BD2, 0X4BB2, 0X4BD2, 0X4BB2, 0X4371, 0X4350, 0X4371, 0X4392,
-  0X4392, 0X4455, 0X3BF3, 0X3C13, 0X4434, 0X3B71, 0X328E, 0X328D,
-  0X328D, 0X2A6D, 0X2A4C, 0X2A4C, 0X2A2C, 0X2A2B, 0X2A2B, 0X2A2C,
-  0X2A0B, 0X2A0B, 0X21EB, 0X21EA, 0X21EA, 0X21CA, 0X21CA, 0X21CA,
-  0X21CA, 0X21CA, 0X21A9, 0X21AA, 0X21CB, 0X21AA, 0X21AA, 0X21CB,
-  0X19A9, 0X19A9, 0X21AB, 0X21CB, 0X21AA, 0X21AA, 0X21A9, 0X19A9,
-  0X21A9, 0X21AA, 0X21CA, 0X21CA, 0X21CA, 0X21EC, 0X21CB, 0X2A0B,
-  0X2A2C, 0X222C, 0X2A2D, 0X2A2C, 0X2A0B, 0X2A0B, 0X2A2C, 0X2A2C,
-  0X2A2C, 0X2A4C, 0X2A6D, 0X328D, 0X328E, 0X328E, 0X32AF, 0X3AEF,
-  0X3B10, 0X3B10, 0X3B30, 0X3B50, 0X4351, 0X4350, 0X4371, 0X4392,
-  0X43B2, 0X4BD3, 0X4BD3, 0X4BF3, 0X4BF3, 0X5414, 0X5455, 0X5455,
-  0X5455, 0X5455, 0X5C55, 0X5C75, 0X5C95, 0X5C95, 0X5CB6, 0X64D6,
-  0X64F7, 0X6517, 0X6D38, 0X6D58, 0X6D58, 0X6D78, 0X6D99, 0X75B9,
-  0X75DA, 0X75FA, 0X7DFA, 0X7E1B, 0X7E3B, 0X7E7C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865C,
-  0X863B, 0X7E1B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75B9, 0X7599, 0X7599,
-  0X7579, 0X6D58, 0X6D38, 0X6517, 0X64F7, 0X64D6, 0X64B6, 0X5C95,
-  0X5C95, 0X5C75, 0X5434, 0X5414, 0X5413, 0X53F3, 0X4BD2, 0X4BB2,
-  0X4B91, 0X4B91, 0X4B92, 0X4371, 0X4330, 0X3B30, 0X3B0F, 0X3B71,
-  0X3B51, 0X3B10, 0X32CF, 0X3B92, 0X3C14, 0X3B71, 0X32EF, 0X2A4C,
-  0X2A4C, 0X2A4C, 0X2A2C, 0X2A2C, 0X2A0B, 0X2A0B, 0X21EB, 0X21EB,
-  0X21EB, 0X21CA, 0X21CA, 0X21CA, 0X21AA, 0X21AA, 0X21AA, 0X19A9,
-  0X21A9, 0X21AA, 0X2189, 0X2189, 0X21A9, 0X1989, 0X1989, 0X21AA,
-  0X1989, 0X1968, 0X1988, 0X2189, 0X2189, 0X21A9, 0X2189, 0X1969,
-  0X1969, 0X2189, 0X21AA, 0X19A9, 0X21A9, 0X21CB, 0X21CB, 0X220B,
-  0X222C, 0X220C, 0X21EB, 0X21EB, 0X29EA, 0X21EA, 0X2A0B, 0X2A2B,
-  0X2A0B, 0X2A2B, 0X2A2C, 0X2A4D, 0X2A6D, 0X326D, 0X328E, 0X32CF,
-  0X32EF, 0X3B0F, 0X3B0F, 0X3B30, 0X3B30, 0X3B30, 0X4351, 0X4372,
-  0X4392, 0X4BB3, 0X4BB3, 0X4BB2, 0X43B2, 0X4BD3, 0X4C14, 0X5414,
-  0X5414, 0X5414, 0X5434, 0X5454, 0X5C54, 0X5C75, 0X5C95, 0X5CB5,
-  0X64B6, 0X64F7, 0X64F7, 0X6517, 0X6D37, 0X6D58, 0X6D78, 0X6D99,
-  0X75B9, 0X75DA, 0X75FA, 0X7DFA, 0X7E1B, 0X7E3B, 0X7E7B, 0X867C,
-  0X867C, 0X869C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X8E9D, 0X869C, 0X867C, 0X865C, 0X863B,
-  0X7E1B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75B9, 0X7599, 0X7579, 0X6D78,
-  0X6D58, 0X6D37, 0X6517, 0X64F7, 0X64D7, 0X64B6, 0X5C95, 0X5C75,
-  0X5C55, 0X5434, 0X5414, 0X53F3, 0X4BD3, 0X4BD2, 0X4BB2, 0X4391,
-  0X4371, 0X4371, 0X4392, 0X4350, 0X3B10, 0X3AEF, 0X3ACF, 0X3B10,
-  0X3B51, 0X32CF, 0X328D, 0X3B31, 0X3BD4, 0X2AEF, 0X3310, 0X2A6D,
-  0X2A0B, 0X2A0B, 0X2A0B, 0X29EB, 0X21EA, 0X21CA, 0X21CA, 0X21CA,
-  0X21AA, 0X21A9, 0X21A9, 0X19A9, 0X1989, 0X1989, 0X2189, 0X1988,
-  0X1968, 0X1989, 0X1969, 0X1968, 0X1968, 0X1948, 0X1968, 0X1989,
-  0X1969, 0X1948, 0X1947, 0X1947, 0X1968, 0X1968, 0X1948, 0X1968,
-  0X1968, 0X1968, 0X1968, 0X1989, 0X1989, 0X21EC, 0X220C, 0X19C9,
-  0X220C, 0X21CB, 0X21A9, 0X21AA, 0X21CA, 0X21CA, 0X21CA, 0X29EB,
-  0X29EA, 0X29EB, 0X2A0B, 0X2A2C, 0X2A4C, 0X2A4C, 0X2A4D, 0X326D,
-  0X32AE, 0X32EF, 0X32EF, 0X3B0F, 0X3B0F, 0X3B0F, 0X3B30, 0X4372,
-  0X4372, 0X4371, 0X4372, 0X4371, 0X4371, 0X4BB2, 0X4BD3, 0X4BD3,
-  0X53F3, 0X5413, 0X5413, 0X5414, 0X5434, 0X5454, 0X5475, 0X5C95,
-  0X5C95, 0X5CB6, 0X64D6, 0X64F7, 0X6517, 0X6537, 0X6D58, 0X6D78,
-  0X6D78, 0X7599, 0X75B9, 0X75DA, 0X75FA, 0X7E1A, 0X7E3B, 0X7E5B,
-  0X865B, 0X867C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865B, 0X863B, 0X7E3B,
-  0X7E1B, 0X7DFA, 0X7DDA, 0X75B9, 0X7599, 0X7579, 0X6D58, 0X6D58,
-  0X6D38, 0X64F7, 0X64F6, 0X64D6, 0X64D6, 0X5C96, 0X5C75, 0X5C54,
-  0X5434, 0X5413, 0X4BF3, 0X4BD2, 0X4BB2, 0X4391, 0X4371, 0X4371,
-  0X4350, 0X4351, 0X4371, 0X3B0F, 0X3AEF, 0X3ACE, 0X3AAE, 0X32AF,
-  0X3B31, 0X32EF, 0X2A6D, 0X32AF, 0X3BF5, 0X2AEF, 0X2A6D, 0X32CF,
-  0X2A0C, 0X29CB, 0X21EB, 0X21CB, 0X21CA, 0X21A9, 0X21A9, 0X21A9,
-  0X218A, 0X1989, 0X1988, 0X1968, 0X1968, 0X1968, 0X1948, 0X1948,
-  0X1947, 0X1948, 0X1969, 0X1948, 0X1147, 0X1127, 0X1947, 0X1968,
-  0X1948, 0X1928, 0X1127, 0X1127, 0X1947, 0X1928, 0X1927, 0X1948,
-  0X1948, 0X1968, 0X1968, 0X1968, 0X1948, 0X21CB, 0X21CC, 0X21CB,
-  0X220C, 0X19A9, 0X1988, 0X2189, 0X21A9, 0X21A9, 0X21A9, 0X21CA,
-  0X21CA, 0X21CA, 0X29EB, 0X2A0B, 0X2A2C, 0X2A0C, 0X2A2C, 0X2A4C,
-  0X2A8E, 0X32CE, 0X32AE, 0X32CE, 0X32CF, 0X32CF, 0X3B0F, 0X4351,
-  0X4372, 0X4351, 0X4351, 0X4371, 0X4392, 0X43B2, 0X4BB2, 0X4BB2,
-  0X4BB2, 0X4BD3, 0X53F3, 0X53F3, 0X5413, 0X5414, 0X5434, 0X5454,
-  0X5C75, 0X5C95, 0X5CB6, 0X64D6, 0X64F7, 0X6517, 0X6537, 0X6D38,
-  0X6D58, 0X6D78, 0X6D99, 0X75BA, 0X75DA, 0X75FA, 0X7DFA, 0X7E1B,
-  0X7E3B, 0X865B, 0X865B, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EBD, 0X8EBC, 0X869C, 0X867C, 0X865C, 0X863B, 0X7E1B, 0X7E1B,
-  0X7DFA, 0X7DDA, 0X75BA, 0X7599, 0X7579, 0X6D58, 0X6D38, 0X6D38,
-  0X6517, 0X64D6, 0X64B6, 0X64B6, 0X5C95, 0X5C95, 0X5C55, 0X5434,
-  0X5413, 0X53D3, 0X4BD2, 0X4BB2, 0X4391, 0X4371, 0X4350, 0X4330,
-  0X4330, 0X3B30, 0X3B50, 0X3AEF, 0X3AAE, 0X32AE, 0X32AE, 0X328E,
-  0X32AF, 0X32EF, 0X2A4D, 0X2A2D, 0X3B53, 0X3392, 0X220B, 0X2A8E,
-  0X2A8F, 0X21CB, 0X21CA, 0X21AA, 0X21A9, 0X1989, 0X1988, 0X1968,
-  0X2169, 0X1968, 0X1947, 0X1948, 0X1947, 0X1147, 0X1927, 0X1927,
-  0X1127, 0X1127, 0X1948, 0X1927, 0X1106, 0X1106, 0X1927, 0X1927,
-  0X1948, 0X1947, 0X1106, 0X1106, 0X1106, 0X1107, 0X1107, 0X1127,
-  0X1106, 0X1927, 0X1947, 0X1927, 0X1927, 0X1969, 0X198A, 0X21CB,
-  0X222C, 0X21CB, 0X1948, 0X1968, 0X1988, 0X2189, 0X1988, 0X2189,
-  0X21A9, 0X21A9, 0X21CA, 0X21CA, 0X29EB, 0X2A0B, 0X2A0B, 0X2A2C,
-  0X2A6D, 0X2AAD, 0X328D, 0X328D, 0X32AE, 0X32CE, 0X3AEF, 0X3B10,
-  0X3B30, 0X3B30, 0X3B51, 0X4351, 0X4351, 0X4371, 0X4371, 0X4B92,
-  0X4B92, 0X4BB2, 0X4BB2, 0X4BD2, 0X4BF3, 0X53F3, 0X5413, 0X5414,
-  0X5434, 0X5C75, 0X5C96, 0X5CB6, 0X64D6, 0X64D6, 0X64F7, 0X6517,
-  0X6537, 0X6D58, 0X6D99, 0X6D99, 0X75B9, 0X75DA, 0X75DA, 0X7DFA,
-  0X7E1A, 0X7E3B, 0X865B, 0X865B, 0X867C, 0X869C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD,
-  0X8EBD, 0X869C, 0X867C, 0X865C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA,
-  0X7DDA, 0X75BA, 0X7599, 0X7599, 0X6D58, 0X6D58, 0X6D37, 0X6517,
-  0X64D6, 0X64B6, 0X6496, 0X5C95, 0X5C75, 0X5C55, 0X5434, 0X5414,
-  0X53F3, 0X4BD2, 0X4BB2, 0X4391, 0X4371, 0X4350, 0X3B30, 0X3B10,
-  0X3AEF, 0X3B10, 0X3B10, 0X3ACE, 0X328E, 0X328E, 0X328E, 0X326E,
-  0X2A4D, 0X32CF, 0X2A6D, 0X21EB, 0X32D0, 0X33B3, 0X220B, 0X21CA,
-  0X2A8E, 0X224D, 0X1989, 0X1988, 0X1969, 0X1968, 0X1968, 0X1947,
-  0X1947, 0X1949, 0X1948, 0X1127, 0X1127, 0X1126, 0X1107, 0X1106,
-  0X1106, 0X1107, 0X1927, 0X1106, 0X10E6, 0X1907, 0X1106, 0X1106,
-  0X1907, 0X1927, 0X1106, 0X10E5, 0X10E6, 0X1907, 0X1107, 0X10E6,
-  0X1106, 0X1106, 0X1106, 0X1907, 0X1927, 0X1947, 0X1126, 0X1968,
-  0X19CA, 0X21CA, 0X1968, 0X1947, 0X1948, 0X1968, 0X1968, 0X1968,
-  0X1968, 0X1989, 0X21AA, 0X21AA, 0X21CA, 0X21EB, 0X21EB, 0X29EB,
-  0X2A4C, 0X2A6D, 0X2A6D, 0X2A6D, 0X328D, 0X32CE, 0X32CF, 0X3AEF,
-  0X3AEF, 0X3B0F, 0X3B10, 0X3B30, 0X4330, 0X4350, 0X4351, 0X4351,
-  0X4371, 0X4391, 0X4391, 0X4392, 0X4BB2, 0X4BD3, 0X4BF3, 0X53F3,
-  0X5414, 0X5434, 0X5C95, 0X5CB5, 0X5CB5, 0X5CB6, 0X64D6, 0X64F7,
-  0X6517, 0X6D58, 0X6D78, 0X6D78, 0X6D99, 0X7599, 0X75B9, 0X75DA,
-  0X7DFA, 0X7E1A, 0X7E3B, 0X7E5B, 0X865B, 0X867C, 0X869C, 0X8E9C,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X869C, 0X867C, 0X867C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DDA,
-  0X75BA, 0X7599, 0X7579, 0X6D58, 0X6D38, 0X6D17, 0X6517, 0X64F7,
-  0X64B6, 0X5C95, 0X5C75, 0X5C75, 0X5C55, 0X5434, 0X5414, 0X53F3,
-  0X4BD2, 0X4BB2, 0X4371, 0X4350, 0X4350, 0X3B2F, 0X3B10, 0X3AEF,
-  0X3ACF, 0X3AEF, 0X3AEF, 0X328D, 0X326D, 0X326D, 0X326D, 0X2A4D,
-  0X2A0C, 0X2A6D, 0X2A8E, 0X21CA, 0X2A4E, 0X3394, 0X222C, 0X1948,
-  0X21AA, 0X224D, 0X21EB, 0X1947, 0X1948, 0X1948, 0X1947, 0X1127,
-  0X1127, 0X1927, 0X1927, 0X1106, 0X1106, 0X1106, 0X1106, 0X10E6,
-  0X10E6, 0X1107, 0X10E6, 0X10E5, 0X10E6, 0X10E6, 0X10E5, 0X10E6,
-  0X10E6, 0X1106, 0X10C5, 0X10C5, 0X10C5, 0X10E6, 0X10E6, 0X10C6,
-  0X10C6, 0X10E6, 0X1107, 0X1127, 0X1106, 0X1106, 0X10E5, 0X1948,
-  0X1968, 0X1968, 0X1968, 0X1927, 0X1927, 0X1927, 0X1947, 0X1947,
-  0X1968, 0X1968, 0X1989, 0X19A9, 0X21CA, 0X21CA, 0X21AA, 0X21CA,
-  0X220B, 0X2A6C, 0X2A6D, 0X2A6D, 0X328D, 0X32AE, 0X32AE, 0X32CE,
-  0X32CE, 0X3ACF, 0X3AEF, 0X3B10, 0X4330, 0X4330, 0X4330, 0X4330,
-  0X4350, 0X4350, 0X4351, 0X4371, 0X4392, 0X4BB2, 0X4BD2, 0X4BD3,
-  0X4C13, 0X5434, 0X5434, 0X5475, 0X5C95, 0X5C95, 0X5CB6, 0X64D6,
-  0X64F7, 0X6538, 0X6538, 0X6D58, 0X6D58, 0X6D78, 0X7599, 0X75B9,
-  0X75DA, 0X7DFA, 0X7E1A, 0X7E1B, 0X865B, 0X865C, 0X867C, 0X869C,
-  0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C,
-  0X867C, 0X867C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75BA,
-  0X7599, 0X7579, 0X6D58, 0X6D38, 0X6D17, 0X64F7, 0X64F7, 0X64D6,
-  0X5C96, 0X5C75, 0X5454, 0X5434, 0X5434, 0X5414, 0X53F3, 0X4BD2,
-  0X4B92, 0X4371, 0X4350, 0X3B30, 0X3B10, 0X3B0F, 0X3B0F, 0X3AEF,
-  0X3ACE, 0X3ACF, 0X32CF, 0X326D, 0X2A4C, 0X2A2C, 0X2A2C, 0X2A2C,
-  0X2A0C, 0X2A0C, 0X2A8E, 0X21EB, 0X19AA, 0X2B31, 0X3393, 0X19CB,
-  0X1927, 0X19AA, 0X224D, 0X1989, 0X1107, 0X1927, 0X1127, 0X1107,
-  0X1106, 0X1106, 0X10E6, 0X10E6, 0X10E5, 0X10E5, 0X10C5, 0X10E6,
-  0X1107, 0X10E6, 0X10C5, 0X10C5, 0X10C5, 0X10A5, 0X10C5, 0X10C5,
-  0X10C5, 0X1106, 0X10C5, 0X10A4, 0X08A4, 0X08A4, 0X08A4, 0X10A5,
-  0X10C5, 0X10C5, 0X10E6, 0X10E5, 0X10E5, 0X10E5, 0X1106, 0X1148,
-  0X1127, 0X1128, 0X1948, 0X1106, 0X1106, 0X1106, 0X1126, 0X1947,
-  0X1947, 0X1948, 0X1948, 0X1968, 0X21A9, 0X21AA, 0X21A9, 0X21A9,
-  0X220B, 0X2A6C, 0X2A6C, 0X2A6C, 0X2A6C, 0X2A6C, 0X326D, 0X328D,
-  0X328D, 0X32AE, 0X3ACE, 0X3AEF, 0X3AEF, 0X3B0F, 0X3B0F, 0X3B0F,
-  0X3B10, 0X3B30, 0X4330, 0X4351, 0X4351, 0X4391, 0X4392, 0X4BD3,
-  0X5414, 0X5413, 0X5413, 0X5434, 0X5454, 0X5475, 0X5C95, 0X5CB6,
-  0X64F7, 0X6517, 0X6517, 0X6537, 0X6D38, 0X6D58, 0X6D78, 0X7599,
-  0X75B9, 0X75DA, 0X7DFA, 0X7E1A, 0X7E3B, 0X865B, 0X867C, 0X867C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C,
-  0X867C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75BA, 0X7599,
-  0X7579, 0X6D58, 0X6D38, 0X6D17, 0X64F7, 0X64D6, 0X64B6, 0X5CB6,
-  0X5C75, 0X5C54, 0X5434, 0X5414, 0X5413, 0X53F4, 0X4BF3, 0X4BB2,
-  0X4371, 0X4350, 0X3B30, 0X3B0F, 0X3AEF, 0X3AEF, 0X3ACF, 0X32AE,
-  0X328E, 0X32CF, 0X32AE, 0X2A2C, 0X2A2C, 0X2A0B, 0X2A0B, 0X220B,
-  0X21EB, 0X21CB, 0X2A2C, 0X222C, 0X1969, 0X21CA, 0X32F0, 0X2B33,
-  0X118A, 0X10E7, 0X11CA, 0X1A2B, 0X1168, 0X10E6, 0X1107, 0X1107,
-  0X10E6, 0X10E5, 0X10E5, 0X10E5, 0X08C5, 0X10C5, 0X10A5, 0X10E6,
-  0X10E6, 0X08C5, 0X08A5, 0X10A4, 0X10A4, 0X08A4, 0X08A4, 0X10A4,
-  0X08A4, 0X08C5, 0X10E5, 0X08A4, 0X0883, 0X0884, 0X0884, 0X0884,
-  0X10A4, 0X10C5, 0X10A5, 0X08A4, 0X10C4, 0X10C5, 0X1127, 0X1147,
-  0X10E6, 0X1106, 0X1947, 0X1926, 0X10C5, 0X10E5, 0X1106, 0X1126,
-  0X1927, 0X1947, 0X1948, 0X1948, 0X1989, 0X21A9, 0X19A9, 0X19EA,
-  0X222B, 0X2A2B, 0X2A0B, 0X2A2B, 0X2A2B, 0X2A2C, 0X2A4C, 0X2A4C,
-  0X326D, 0X328D, 0X32AE, 0X32AE, 0X32AE, 0X3ACF, 0X3ACF, 0X3ACF,
-  0X3AEF, 0X3B0F, 0X3B10, 0X4310, 0X4351, 0X4371, 0X4392, 0X4BD3,
-  0X4BF3, 0X4BD3, 0X4BF3, 0X53F3, 0X5414, 0X5454, 0X5455, 0X5C95,
-  0X5CD6, 0X64F6, 0X64F7, 0X64F7, 0X6517, 0X6D37, 0X6D58, 0X6D78,
-  0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X867C,
-  0X867C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X867C,
-  0X865C, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75B9, 0X7599, 0X7579,
-  0X6D58, 0X6D38, 0X6D17, 0X64F7, 0X64D7, 0X64B6, 0X5CB6, 0X5C95,
-  0X5C54, 0X5434, 0X5413, 0X53F3, 0X53F3, 0X4BD3, 0X4BD3, 0X4B91,
-  0X4351, 0X4330, 0X3B0F, 0X3AEF, 0X3AEF, 0X3ACE, 0X32AE, 0X328E,
-  0X326D, 0X328D, 0X328E, 0X2A2C, 0X2A0B, 0X21EB, 0X21EB, 0X21CA,
-  0X21CB, 0X21CB, 0X21AB, 0X220C, 0X21AA, 0X1969, 0X1929, 0X22AF,
-  0X1AF0, 0X120C, 0X1AAE, 0X1A6C, 0X122B, 0X1168, 0X10C5, 0X10E6,
-  0X10C5, 0X10C5, 0X08C5, 0X10C5, 0X10A5, 0X10A5, 0X10A6, 0X10C6,
-  0X08A5, 0X08A4, 0X08A5, 0X10A4, 0X0883, 0X0883, 0X0883, 0X0884,
-  0X0884, 0X10A4, 0X0884, 0X0883, 0X0883, 0X0883, 0X0883, 0X0863,
-  0X1084, 0X10A4, 0X0884, 0X0884, 0X08A4, 0X10E5, 0X1106, 0X1106,
-  0X10E5, 0X10C5, 0X1147, 0X1127, 0X10A4, 0X10C5, 0X10E5, 0X10E5,
-  0X1106, 0X1127, 0X1948, 0X1988, 0X1988, 0X19A9, 0X19C9, 0X21EA,
-  0X21EA, 0X21EA, 0X21EA, 0X21CA, 0X29EA, 0X2A0B, 0X2A2B, 0X2A2C,
-  0X2A6C, 0X326D, 0X328D, 0X32AD, 0X328D, 0X328D, 0X328D, 0X328D,
-  0X3AAE, 0X3ACF, 0X3AEF, 0X3B10, 0X3B30, 0X4351, 0X4392, 0X43D3,
-  0X43B2, 0X43B2, 0X4BB2, 0X4BD3, 0X4BF3, 0X5414, 0X5434, 0X5475,
-  0X5CB6, 0X5CB6, 0X5CB6, 0X64D6, 0X64F7, 0X6517, 0X6D38, 0X6D58,
-  0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B,
-  0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865C,
-  0X863B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75BA, 0X7599, 0X7579, 0X6D58,
-  0X6D58, 0X6D17, 0X64F7, 0X64D6, 0X64B6, 0X5C96, 0X5C96, 0X5C55,
-  0X5434, 0X5413, 0X53F3, 0X53D2, 0X53D3, 0X4BD3, 0X4B92, 0X4371,
-  0X4330, 0X3AEF, 0X3ACF, 0X3ACF, 0X3ACE, 0X32AE, 0X328D, 0X324D,
-  0X324D, 0X326E, 0X2A6E, 0X2A2D, 0X2A0C, 0X21CB, 0X21CA, 0X21AA,
-  0X21AA, 0X21AB, 0X1969, 0X21CB, 0X198A, 0X198B, 0X198A, 0X11AA,
-  0X1A4D, 0X1AAE, 0X126D, 0X1ACE, 0X120A, 0X1168, 0X1127, 0X08A4,
-  0X10A5, 0X08A5, 0X0884, 0X10A5, 0X10A6, 0X0884, 0X0884, 0X08A4,
-  0X0884, 0X0884, 0X0884, 0X0884, 0X0863, 0X0063, 0X0863, 0X0863,
-  0X0883, 0X1083, 0X0842, 0X0862, 0X0863, 0X0863, 0X0862, 0X0862,
-  0X0863, 0X0863, 0X0883, 0X0883, 0X08A4, 0X08C5, 0X08C4, 0X10E5,
-  0X10C5, 0X10C5, 0X1107, 0X10E5, 0X10A4, 0X10A4, 0X10C5, 0X10E5,
-  0X1106, 0X1167, 0X1188, 0X1167, 0X1167, 0X1968, 0X1988, 0X21A9,
-  0X21C9, 0X21C9, 0X21A9, 0X21A9, 0X21A9, 0X21CA, 0X220B, 0X2A0B,
-  0X2A2B, 0X2A4C, 0X326C, 0X326C, 0X324C, 0X2A4C, 0X324C, 0X326D,
-  0X328D, 0X32AE, 0X32AE, 0X3ACF, 0X3B0F, 0X3B30, 0X4391, 0X4392,
-  0X4392, 0X4371, 0X4392, 0X4BB2, 0X4BD2, 0X53F3, 0X5414, 0X5455,
-  0X5C75, 0X5C95, 0X5C95, 0X5CB6, 0X64D6, 0X64F7, 0X6517, 0X6D38,
-  0X6D58, 0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B,
-  0X865B, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X8EFD, 0X8EDD, 0X8EBD, 0X8EBC, 0X869C, 0X867C, 0X865C, 0X863B,
-  0X7E1B, 0X7E1B, 0X7DFA, 0X75BA, 0X7599, 0X7579, 0X6D58, 0X6D38,
-  0X6D17, 0X64F7, 0X64D6, 0X64B6, 0X5C96, 0X5C75, 0X5C75, 0X5434,
-  0X5413, 0X53D3, 0X4BD2, 0X4BB2, 0X4BB2, 0X4BB3, 0X4372, 0X4350,
-  0X3B0F, 0X3ACF, 0X3ACE, 0X3AAE, 0X32AE, 0X328D, 0X326D, 0X2A4D,
-  0X2A4D, 0X2A8E, 0X2A4D, 0X2A0B, 0X29EB, 0X21EC, 0X21EB, 0X2189,
-  0X2189, 0X2189, 0X1949, 0X196A, 0X198C, 0X1149, 0X1968, 0X1169,
-  0X0928, 0X09A9, 0X0A2B, 0X1B2F, 0X11C9, 0X08C6, 0X1169, 0X08E6,
-  0X0863, 0X0884, 0X0883, 0X10A4, 0X10A5, 0X0863, 0X0863, 0X0863,
-  0X0884, 0X0864, 0X0843, 0X0863, 0X0843, 0X0042, 0X0863, 0X0883,
-  0X0884, 0X0863, 0X0842, 0X0842, 0X0042, 0X0842, 0X0842, 0X0842,
-  0X0842, 0X0863, 0X0863, 0X0863, 0X0883, 0X08A4, 0X0883, 0X10A4,
-  0X08A4, 0X10C6, 0X10C6, 0X10A4, 0X08A4, 0X0884, 0X10A4, 0X10C5,
-  0X10E5, 0X1167, 0X1167, 0X1126, 0X1106, 0X1947, 0X1967, 0X1947,
-  0X1988, 0X1988, 0X2188, 0X1988, 0X1989, 0X21A9, 0X29EB, 0X2A0B,
-  0X29EA, 0X2A2B, 0X322C, 0X322B, 0X2A0B, 0X2A2B, 0X322C, 0X324D,
-  0X324D, 0X326D, 0X328E, 0X3AAE, 0X3ACF, 0X3B30, 0X4350, 0X3B30,
-  0X4351, 0X4351, 0X4371, 0X4392, 0X4BB2, 0X4BD2, 0X4BF3, 0X5434,
-  0X5455, 0X5475, 0X5C75, 0X5C95, 0X5CB6, 0X64D6, 0X64F7, 0X6517,
-  0X6D38, 0X6D58, 0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B,
-  0X7E3B, 0X865C, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X865C, 0X863B, 0X7E1B,
-  0X7E1B, 0X7DFA, 0X75DA, 0X75B9, 0X7599, 0X6D78, 0X6D38, 0X6D17,
-  0X6517, 0X64D7, 0X64B6, 0X5C96, 0X5C75, 0X5C55, 0X5434, 0X5413,
-  0X53F3, 0X4BD2, 0X4BB2, 0X4B72, 0X4B92, 0X4372, 0X4351, 0X3B30,
-  0X3AEF, 0X3AAE, 0X32AE, 0X328E, 0X326D, 0X324C, 0X2A2C, 0X2A0B,
-  0X2A0B, 0X2A2D, 0X2A0B, 0X21CA, 0X21AA, 0X21EB, 0X21CB, 0X1969,
-  0X1968, 0X1948, 0X1927, 0X194A, 0X11AB, 0X1106, 0X10C5, 0X1129,
-  0X1A6F, 0X130E, 0X130E, 0X11EA, 0X1107, 0X10E6, 0X08E6, 0X0948,
-  0X08C6, 0X0864, 0X0864, 0X0885, 0X08A5, 0X0863, 0X0863, 0X0843,
-  0X0863, 0X0863, 0X0842, 0X0863, 0X0863, 0X0843, 0X0863, 0X0884,
-  0X0884, 0X0863, 0X0862, 0X0862, 0X0022, 0X0842, 0X0842, 0X0842,
-  0X0842, 0X0862, 0X0862, 0X0022, 0X0883, 0X08A3, 0X0862, 0X08A4,
-  0X0884, 0X08A4, 0X10E6, 0X08A4, 0X08A3, 0X08A3, 0X08A4, 0X10E5,
-  0X1106, 0X1105, 0X1126, 0X1105, 0X10E5, 0X1126, 0X1146, 0X1926,
-  0X1947, 0X1967, 0X1967, 0X1967, 0X1968, 0X21A9, 0X29EA, 0X29C9,
-  0X29CA, 0X29EA, 0X2A0B, 0X29EB, 0X29EB, 0X2A0B, 0X320B, 0X322C,
-  0X322C, 0X324D, 0X326D, 0X328E, 0X32AE, 0X3B0F, 0X3B0F, 0X3AEF,
-  0X3B0F, 0X4330, 0X4351, 0X4371, 0X4391, 0X4BB2, 0X4BD3, 0X5434,
-  0X5454, 0X5454, 0X5454, 0X5475, 0X5C95, 0X5CB6, 0X64D6, 0X64F7,
-  0X6517, 0X6D38, 0X6D58, 0X6D79, 0X7599, 0X75B9, 0X7DDA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD,
-  0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X865C, 0X863B, 0X7E3B, 0X7E1B,
-  0X7DFA, 0X7DDA, 0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6D17, 0X6517,
-  0X64F7, 0X64B6, 0X5C95, 0X5C75, 0X5C55, 0X5455, 0X5414, 0X53F3,
-  0X4BD2, 0X4BB2, 0X4B72, 0X4B72, 0X4B72, 0X4372, 0X4330, 0X3AEF,
-  0X3AAE, 0X328E, 0X328D, 0X326D, 0X324C, 0X2A2C, 0X2A0B, 0X21EB,
-  0X29EB, 0X2A0C, 0X21EB, 0X21AA, 0X2189, 0X2189, 0X19AA, 0X1949,
-  0X1948, 0X1928, 0X1907, 0X1949, 0X19AA, 0X1106, 0X08A5, 0X19ED,
-  0X1AEF, 0X122A, 0X1188, 0X08C5, 0X0885, 0X10E6, 0X08C5, 0X08C5,
-  0X1168, 0X08E6, 0X0885, 0X08E6, 0X08E5, 0X0883, 0X0022, 0X0842,
-  0X0842, 0X0842, 0X0842, 0X0862, 0X0863, 0X0862, 0X0842, 0X0883,
-  0X0883, 0X0841, 0X0842, 0X0842, 0X0821, 0X0842, 0X0042, 0X0042,
-  0X0842, 0X0842, 0X0842, 0X0021, 0X0863, 0X0883, 0X0862, 0X0883,
-  0X08A4, 0X0883, 0X0906, 0X08C4, 0X0883, 0X08A4, 0X08A3, 0X10E5,
-  0X1105, 0X10C4, 0X1105, 0X1105, 0X10C4, 0X10E5, 0X1106, 0X1106,
-  0X1926, 0X1947, 0X1946, 0X1947, 0X1948, 0X2189, 0X21C9, 0X21C9,
-  0X29C9, 0X29A9, 0X29CA, 0X29AA, 0X29CA, 0X29CA, 0X29EB, 0X2A0B,
-  0X2A0C, 0X2A2C, 0X324D, 0X326D, 0X328E, 0X3AEF, 0X3ACF, 0X3ACF,
-  0X3ACF, 0X3AEF, 0X4330, 0X4350, 0X4351, 0X4392, 0X4BB2, 0X4BF4,
-  0X5434, 0X5414, 0X5434, 0X5454, 0X5C75, 0X5C95, 0X5CB6, 0X64D6,
-  0X64F7, 0X6517, 0X6D38, 0X6D58, 0X6D79, 0X7599, 0X75DA, 0X7DFA,
-  0X7DFA, 0X7E1B, 0X865B, 0X867C, 0X869C, 0X869C, 0X8EBC, 0X8EBD,
-  0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD,
-  0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA,
-  0X75DA, 0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6D38, 0X6517, 0X64F7,
-  0X64D7, 0X64B6, 0X5C75, 0X5C55, 0X5434, 0X5434, 0X53F3, 0X4BD3,
-  0X4BB2, 0X4B71, 0X4B72, 0X4352, 0X4372, 0X4351, 0X3AEF, 0X3AAE,
-  0X328E, 0X326D, 0X326D, 0X324C, 0X320C, 0X2A0B, 0X29EB, 0X29CB,
-  0X29EC, 0X220C, 0X21CA, 0X2189, 0X1968, 0X2168, 0X1969, 0X1948,
-  0X1927, 0X1107, 0X10E7, 0X10E8, 0X1969, 0X1147, 0X08A6, 0X1A6E,
-  0X09C8, 0X0884, 0X08A5, 0X08C5, 0X0885, 0X08A6, 0X10E6, 0X08A4,
-  0X0084, 0X0927, 0X08E6, 0X0083, 0X08C5, 0X10C6, 0X0063, 0X0883,
-  0X0063, 0X0842, 0X0021, 0X0000, 0X0021, 0X0021, 0X0021, 0X0862,
-  0X0863, 0X0821, 0X0821, 0X0821, 0X0821, 0X0021, 0X0842, 0X0842,
-  0X0021, 0X0821, 0X0021, 0X0042, 0X0862, 0X0842, 0X0842, 0X0863,
-  0X08C4, 0X0883, 0X08E5, 0X08C4, 0X0883, 0X0863, 0X0883, 0X10A3,
-  0X10C4, 0X10C4, 0X10C4, 0X08A3, 0X10A3, 0X10E4, 0X1105, 0X10E5,
-  0X1105, 0X1925, 0X1926, 0X1926, 0X1967, 0X2188, 0X2188, 0X29A9,
-  0X29A9, 0X29A9, 0X29A9, 0X29AA, 0X29AA, 0X29AA, 0X29CA, 0X29EA,
-  0X2A0B, 0X2A0B, 0X2A2C, 0X2A6E, 0X32CF, 0X32CE, 0X328D, 0X32AE,
-  0X3AAE, 0X3ACF, 0X3AF0, 0X3B10, 0X4330, 0X4371, 0X4391, 0X4BD3,
-  0X4C34, 0X4C14, 0X5414, 0X5434, 0X5454, 0X5475, 0X5C95, 0X5CB6,
-  0X64D6, 0X64F7, 0X6517, 0X6D38, 0X6D58, 0X7599, 0X75B9, 0X75DA,
-  0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EBD,
-  0X8E9C, 0X869C, 0X867C, 0X865B, 0X863B, 0X7E1B, 0X7DFB, 0X7DDA,
-  0X75BA, 0X75B9, 0X7599, 0X6D58, 0X6D37, 0X6517, 0X64F7, 0X64D6,
-  0X5C96, 0X5C96, 0X5C75, 0X5434, 0X5414, 0X5414, 0X53D3, 0X4BB2,
-  0X4B92, 0X4351, 0X4B72, 0X4331, 0X4371, 0X4351, 0X32AE, 0X32AE,
-  0X326D, 0X324D, 0X2A2C, 0X322C, 0X322C, 0X2A0B, 0X29EB, 0X29EB,
-  0X21CB, 0X21EB, 0X21A9, 0X1968, 0X1968, 0X1948, 0X1928, 0X1948,
-  0X1128, 0X1129, 0X116B, 0X1108, 0X1907, 0X1948, 0X0085, 0X1A4E,
-  0X122B, 0X0884, 0X0884, 0X08A5, 0X08A5, 0X0885, 0X08A5, 0X08A5,
-  0X0064, 0X08E5, 0X0927, 0X0084, 0X0863, 0X08A5, 0X0083, 0X0883,
-  0X0863, 0X0843, 0X0042, 0X0042, 0X0882, 0X0042, 0X0021, 0X0842,
-  0X0883, 0X0862, 0X0821, 0X0821, 0X0821, 0X0021, 0X0841, 0X0841,
-  0X0021, 0X0821, 0X0021, 0X0841, 0X0862, 0X0041, 0X0841, 0X0862,
-  0X08C4, 0X08E4, 0X08A4, 0X0862, 0X0862, 0X0842, 0X0842, 0X10A3,
-  0X10A3, 0X08A3, 0X0883, 0X0883, 0X0883, 0X10C4, 0X1105, 0X10E5,
-  0X10C5, 0X10E5, 0X1105, 0X1106, 0X1947, 0X2187, 0X2188, 0X2988,
-  0X29A9, 0X29A9, 0X2968, 0X2989, 0X29AA, 0X2189, 0X21A9, 0X29C9,
-  0X29EB, 0X2A0C, 0X2A2D, 0X328E, 0X328E, 0X326D, 0X2A6D, 0X326D,
-  0X328E, 0X32CF, 0X3ACF, 0X3AEF, 0X3B10, 0X4330, 0X4371, 0X43B3,
-  0X4BF3, 0X4C14, 0X5414, 0X5434, 0X5434, 0X5455, 0X5C75, 0X5C95,
-  0X5CB6, 0X64D6, 0X64F7, 0X6517, 0X6D58, 0X6D78, 0X7599, 0X75B9,
-  0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBC,
-  0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X869C, 0X867C, 0X865C, 0X863B, 0X7E1B, 0X7DFB, 0X7DFA, 0X75DA,
-  0X75BA, 0X7599, 0X6D79, 0X6D38, 0X6517, 0X64F7, 0X64D6, 0X5CB6,
-  0X5C95, 0X5C75, 0X5C55, 0X5414, 0X5414, 0X53F3, 0X4BB2, 0X4B91,
-  0X4371, 0X4351, 0X4331, 0X4310, 0X4331, 0X3B51, 0X32AF, 0X328D,
-  0X326D, 0X324C, 0X2A2C, 0X322C, 0X322C, 0X29EB, 0X21CA, 0X21CA,
-  0X2189, 0X21CA, 0X21A9, 0X1948, 0X1948, 0X1907, 0X10E7, 0X1907,
-  0X1108, 0X1149, 0X1969, 0X1107, 0X10A6, 0X1169, 0X00A5, 0X116A,
-  0X1ACE, 0X00C4, 0X0863, 0X0884, 0X0884, 0X0884, 0X0884, 0X08A5,
-  0X0864, 0X08A4, 0X0926, 0X0063, 0X0863, 0X08A4, 0X0083, 0X0001,
-  0X0821, 0X0041, 0X0042, 0X0863, 0X0083, 0X0083, 0X08A4, 0X10A4,
-  0X0883, 0X0862, 0X0841, 0X0021, 0X0821, 0X0020, 0X0000, 0X0821,
-  0X0841, 0X0841, 0X0841, 0X0882, 0X0841, 0X0041, 0X0841, 0X0882,
-  0X0882, 0X0905, 0X08C4, 0X0821, 0X0842, 0X0842, 0X0862, 0X10A3,
-  0X08A3, 0X0862, 0X0863, 0X0882, 0X0883, 0X1083, 0X10C4, 0X10C4,
-  0X10C4, 0X10E5, 0X10E5, 0X1105, 0X1926, 0X1926, 0X2167, 0X2188,
-  0X21A8, 0X29A9, 0X2988, 0X2988, 0X29A9, 0X2189, 0X2189, 0X21AA,
-  0X2A0B, 0X2A4C, 0X2A4C, 0X2A2B, 0X2A2C, 0X2A4D, 0X2A4D, 0X326D,
-  0X328E, 0X32AF, 0X32CF, 0X3ACF, 0X3AEF, 0X3B10, 0X4351, 0X4392,
-  0X4392, 0X4BD2, 0X4C13, 0X4C14, 0X5434, 0X5455, 0X5475, 0X5C75,
-  0X5C95, 0X5CB6, 0X64D7, 0X64F7, 0X6D37, 0X6D58, 0X6D78, 0X7599,
-  0X75B9, 0X75DA, 0X7DFA, 0X7E3B, 0X865B, 0X865C, 0X867C, 0X869C,
-  0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EBD, 0X8E9C,
-  0X869C, 0X867C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75BA,
-  0X7599, 0X6D79, 0X6D58, 0X6538, 0X64F7, 0X64D7, 0X64B6, 0X5C96,
-  0X5C55, 0X5455, 0X5435, 0X5414, 0X53F3, 0X4BD3, 0X4B92, 0X4371,
-  0X4331, 0X4331, 0X4310, 0X4310, 0X3AEF, 0X3AF0, 0X32AF, 0X326E,
-  0X324D, 0X322C, 0X322C, 0X2A2C, 0X2A0B, 0X21AA, 0X21A9, 0X2189,
-  0X1968, 0X21AA, 0X21A9, 0X2148, 0X1927, 0X10E6, 0X10E6, 0X10E6,
-  0X1107, 0X1127, 0X08A5, 0X10E7, 0X10C7, 0X1148, 0X1106, 0X08C6,
-  0X1B0F, 0X0947, 0X0822, 0X0863, 0X0863, 0X0842, 0X0883, 0X08A4,
-  0X0883, 0X0884, 0X0926, 0X0063, 0X0001, 0X0883, 0X0884, 0X0042,
-  0X0022, 0X0043, 0X0083, 0X0042, 0X0041, 0X0062, 0X0882, 0X0862,
-  0X1083, 0X0882, 0X1082, 0X0862, 0X0841, 0X0820, 0X0820, 0X0841,
-  0X0841, 0X0821, 0X0862, 0X1082, 0X0021, 0X0841, 0X0862, 0X0882,
-  0X0862, 0X10C4, 0X08C3, 0X0841, 0X0841, 0X0862, 0X0882, 0X08A2,
-  0X0882, 0X0882, 0X0862, 0X0862, 0X0883, 0X10A3, 0X10A3, 0X10A4,
-  0X10C4, 0X10E4, 0X1105, 0X1105, 0X10E5, 0X1905, 0X1946, 0X2188,
-  0X2188, 0X2188, 0X2168, 0X2168, 0X21C9, 0X21A9, 0X21CA, 0X21EB,
-  0X21EB, 0X2A0B, 0X29EA, 0X29CA, 0X29EB, 0X2A2C, 0X2A2C, 0X322D,
-  0X326D, 0X328E, 0X32CF, 0X3ACF, 0X3ACF, 0X3B10, 0X3B51, 0X4372,
-  0X4371, 0X4391, 0X43B2, 0X4BD3, 0X4C14, 0X5434, 0X5475, 0X5475,
-  0X5C75, 0X5C96, 0X64B6, 0X64F7, 0X6517, 0X6D38, 0X6D58, 0X6D79,
-  0X7599, 0X75BA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X869C,
-  0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C,
-  0X867C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75BA, 0X7599,
-  0X6D79, 0X6D58, 0X6D58, 0X6517, 0X64D7, 0X64B6, 0X5C96, 0X5C75,
-  0X5455, 0X5435, 0X5414, 0X53F3, 0X4BD3, 0X4BB2, 0X4B91, 0X4351,
-  0X4330, 0X4310, 0X3AF0, 0X3AF0, 0X3AAF, 0X3A8E, 0X3AAF, 0X32AE,
-  0X326D, 0X322C, 0X2A0B, 0X2A0B, 0X29CA, 0X2189, 0X2189, 0X1968,
-  0X1948, 0X198A, 0X218A, 0X2148, 0X10E6, 0X10C5, 0X10C5, 0X10C5,
-  0X10E7, 0X10E6, 0X08A5, 0X10E8, 0X08C6, 0X08A5, 0X1106, 0X0065,
-  0X1AAE, 0X120A, 0X0822, 0X0842, 0X0842, 0X0842, 0X0862, 0X0863,
-  0X0883, 0X0842, 0X08E4, 0X0925, 0X0022, 0X0821, 0X0863, 0X08A4,
-  0X0083, 0X0063, 0X0883, 0X0041, 0X0000, 0X0020, 0X0861, 0X0820,
-  0X0861, 0X18C3, 0X10C3, 0X10A2, 0X0861, 0X0820, 0X0820, 0X0841,
-  0X0820, 0X0000, 0X0882, 0X0861, 0X0841, 0X0861, 0X0862, 0X0861,
-  0X0842, 0X08A3, 0X08A3, 0X10A2, 0X0882, 0X0881, 0X0882, 0X0862,
-  0X0862, 0X0862, 0X0861, 0X0862, 0X0882, 0X10A3, 0X10A3, 0X10A3,
-  0X10C4, 0X10C4, 0X10E4, 0X10E4, 0X10C4, 0X10E5, 0X1926, 0X2167,
-  0X2188, 0X2188, 0X2148, 0X2168, 0X21A9, 0X21CA, 0X2A0B, 0X29EA,
-  0X21A9, 0X2189, 0X21A9, 0X21AA, 0X21AA, 0X29EB, 0X2A0C, 0X2A0C,
-  0X322D, 0X2A4D, 0X328E, 0X32D0, 0X32CF, 0X3B10, 0X3B51, 0X3B50,
-  0X4350, 0X4351, 0X4391, 0X4BB2, 0X4BD3, 0X4BF3, 0X5414, 0X5475,
-  0X5496, 0X5C95, 0X5C96, 0X64D6, 0X64F7, 0X6517, 0X6D38, 0X6D58,
-  0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X867C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X869C, 0X867C,
-  0X865C, 0X863B, 0X7E1B, 0X7DFA, 0X7DFA, 0X75BA, 0X7599, 0X6D79,
-  0X6D58, 0X6D38, 0X6538, 0X6518, 0X64D7, 0X5C96, 0X5C75, 0X5455,
-  0X5435, 0X5414, 0X53F3, 0X4BD3, 0X4BB2, 0X4B92, 0X4371, 0X4330,
-  0X4310, 0X3B10, 0X3AF0, 0X3ACF, 0X3AAE, 0X3A8E, 0X326E, 0X32AE,
-  0X328E, 0X2A2C, 0X29EC, 0X29CB, 0X21A9, 0X2189, 0X1968, 0X1968,
-  0X1947, 0X1969, 0X196A, 0X1106, 0X10C5, 0X10C5, 0X10A4, 0X0884,
-  0X18E6, 0X10C6, 0X08C6, 0X08E6, 0X10A4, 0X0883, 0X08C6, 0X0085,
-  0X120B, 0X122B, 0X0042, 0X0842, 0X0041, 0X0841, 0X0021, 0X0021,
-  0X0842, 0X0042, 0X0021, 0X1125, 0X08C4, 0X0022, 0X0882, 0X0883,
-  0X0862, 0X0020, 0X0020, 0X0020, 0X0000, 0X0000, 0X0820, 0X0841,
-  0X0841, 0X1082, 0X1082, 0X0861, 0X1061, 0X0820, 0X0820, 0X0820,
-  0X0841, 0X1082, 0X10A2, 0X0841, 0X0841, 0X0841, 0X0861, 0X1082,
-  0X0841, 0X10A3, 0X10C3, 0X10C2, 0X10A2, 0X0881, 0X0861, 0X0862,
-  0X0862, 0X0861, 0X0861, 0X0882, 0X0882, 0X1082, 0X10A3, 0X10A3,
-  0X1083, 0X10A3, 0X10A3, 0X10C3, 0X10C4, 0X10C4, 0X1906, 0X2147,
-  0X2167, 0X2147, 0X2127, 0X2148, 0X21AA, 0X2A2C, 0X21C9, 0X2188,
-  0X2189, 0X2169, 0X2169, 0X2189, 0X21AA, 0X21CA, 0X29EB, 0X29EC,
-  0X320C, 0X322C, 0X2A4D, 0X328E, 0X32D0, 0X3B51, 0X3B31, 0X3B10,
-  0X3B31, 0X4351, 0X4371, 0X4392, 0X4BB2, 0X4BD2, 0X4BF3, 0X5414,
-  0X5455, 0X5CB6, 0X5C96, 0X5C96, 0X64D6, 0X64F7, 0X6517, 0X6D58,
-  0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X863B, 0X865B,
-  0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X867C,
-  0X865B, 0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75B9, 0X7579, 0X6D58,
-  0X6D38, 0X6518, 0X64F7, 0X64D7, 0X5CB7, 0X5C96, 0X5C55, 0X5434,
-  0X5414, 0X53F4, 0X4BD3, 0X4BB2, 0X4B92, 0X4371, 0X4351, 0X4310,
-  0X3AF0, 0X3B10, 0X3ACF, 0X328E, 0X328D, 0X326E, 0X326E, 0X328E,
-  0X324D, 0X29EB, 0X29CB, 0X21AA, 0X2189, 0X1968, 0X1948, 0X1948,
-  0X1927, 0X1928, 0X1949, 0X1106, 0X10C5, 0X10A5, 0X08A6, 0X08A6,
-  0X0865, 0X10E8, 0X08C6, 0X0884, 0X0883, 0X0863, 0X08C5, 0X00A5,
-  0X1188, 0X124B, 0X0042, 0X0822, 0X0841, 0X0041, 0X0000, 0X0000,
-  0X0021, 0X0841, 0X0841, 0X0841, 0X1104, 0X08E4, 0X0841, 0X0842,
-  0X0862, 0X0820, 0X0800, 0X0821, 0X0841, 0X0820, 0X0841, 0X1041,
-  0X1061, 0X0861, 0X10A2, 0X0861, 0X0840, 0X1061, 0X0861, 0X10A2,
-  0X10C3, 0X18C3, 0X1081, 0X0820, 0X0841, 0X0841, 0X1081, 0X1081,
-  0X0820, 0X18E3, 0X1123, 0X10A1, 0X0861, 0X0861, 0X0881, 0X0861,
-  0X1062, 0X1061, 0X1062, 0X10A2, 0X1082, 0X1082, 0X10A3, 0X1083,
-  0X1083, 0X1083, 0X10A3, 0X10A3, 0X10C4, 0X10C4, 0X1905, 0X2146,
-  0X2127, 0X2148, 0X2188, 0X2188, 0X21CA, 0X21CB, 0X21A9, 0X2168,
-  0X2168, 0X2169, 0X2168, 0X2169, 0X2169, 0X21AA, 0X29EB, 0X29EB,
-  0X29CB, 0X29EC, 0X2A2C, 0X324D, 0X328E, 0X32CF, 0X32F0, 0X3AF0,
-  0X3B10, 0X4331, 0X4352, 0X4392, 0X43B2, 0X4BB2, 0X4BD3, 0X53F3,
-  0X5414, 0X5455, 0X5CB6, 0X5CD7, 0X64F7, 0X64F7, 0X64F7, 0X6D37,
-  0X6D58, 0X6D79, 0X7599, 0X75BA, 0X75DA, 0X7DFA, 0X7E1B, 0X865B,
-  0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X865C,
-  0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75BA, 0X7599, 0X6D79, 0X6D58,
-  0X6D38, 0X6517, 0X64D7, 0X5CB6, 0X5C96, 0X5C76, 0X5C55, 0X5414,
-  0X53F4, 0X53F4, 0X4BD3, 0X4B92, 0X4372, 0X4351, 0X4351, 0X3B31,
-  0X3B10, 0X3B10, 0X32AE, 0X326D, 0X324D, 0X324D, 0X328E, 0X326D,
-  0X2A0B, 0X21AA, 0X21AA, 0X2189, 0X1968, 0X1928, 0X1927, 0X1928,
-  0X1927, 0X1908, 0X1128, 0X10E6, 0X10C5, 0X0884, 0X10A6, 0X1109,
-  0X0909, 0X08E7, 0X08A4, 0X0843, 0X0863, 0X0043, 0X0083, 0X0883,
-  0X0906, 0X1A8C, 0X00E4, 0X0801, 0X0821, 0X0021, 0X0000, 0X0000,
-  0X0000, 0X0820, 0X0821, 0X0842, 0X1167, 0X08E4, 0X0000, 0X0841,
-  0X0841, 0X0861, 0X0820, 0X0821, 0X0841, 0X0861, 0X1061, 0X1061,
-  0X1041, 0X1041, 0X1881, 0X1040, 0X0820, 0X1061, 0X10A1, 0X10C2,
-  0X1061, 0X10A2, 0X1081, 0X0840, 0X0841, 0X0841, 0X1081, 0X1081,
-  0X1061, 0X1924, 0X10C1, 0X10A1, 0X0861, 0X0840, 0X1061, 0X1081,
-  0X1081, 0X1061, 0X1061, 0X1082, 0X1082, 0X10A3, 0X10A3, 0X10A3,
-  0X1082, 0X10A3, 0X10A3, 0X10A3, 0X10C3, 0X10E4, 0X1926, 0X2167,
-  0X2188, 0X2189, 0X2167, 0X2147, 0X2168, 0X2189, 0X21A9, 0X2169,
-  0X1928, 0X2168, 0X2169, 0X2169, 0X2169, 0X2169, 0X21AA, 0X29CA,
-  0X21CA, 0X29CB, 0X2A0B, 0X322C, 0X324D, 0X328E, 0X32AE, 0X32AE,
-  0X3ACF, 0X3AEF, 0X3B30, 0X4371, 0X43B2, 0X4392, 0X4BB2, 0X4BD3,
-  0X53F3, 0X5414, 0X5475, 0X5CF7, 0X64F7, 0X64F7, 0X6517, 0X6517,
-  0X6D38, 0X6D58, 0X7579, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B,
-  0X865B, 0X867C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X8EFD, 0X8EDD, 0X8EBD, 0X8E9C, 0X869C, 0X867C, 0X865B,
-  0X7E1B, 0X7DFA, 0X7DFA, 0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6D38,
-  0X6517, 0X64F7, 0X64D7, 0X5C96, 0X5C75, 0X5455, 0X5435, 0X5415,
-  0X53F4, 0X4BD3, 0X4B92, 0X4372, 0X4351, 0X4330, 0X4330, 0X3B10,
-  0X3ACF, 0X3ACF, 0X328E, 0X326D, 0X324C, 0X322D, 0X324D, 0X2A4C,
-  0X21CA, 0X21AA, 0X2189, 0X1948, 0X1927, 0X1927, 0X1927, 0X1106,
-  0X1106, 0X1108, 0X1149, 0X08E6, 0X1084, 0X0864, 0X10C6, 0X1108,
-  0X1108, 0X08A5, 0X0863, 0X0842, 0X0042, 0X0863, 0X0842, 0X0883,
-  0X0063, 0X1A8C, 0X1249, 0X0021, 0X0821, 0X0821, 0X0000, 0X0000,
-  0X0000, 0X0800, 0X0821, 0X0905, 0X11A7, 0X1145, 0X0862, 0X0800,
-  0X0820, 0X0861, 0X0861, 0X0841, 0X0841, 0X0841, 0X0861, 0X0861,
-  0X1061, 0X1081, 0X1881, 0X1040, 0X18C2, 0X18E3, 0X0860, 0X1061,
-  0X1061, 0X10A2, 0X1082, 0X1081, 0X1881, 0X1881, 0X18A1, 0X1060,
-  0X18C3, 0X1903, 0X0860, 0X10A2, 0X1081, 0X0861, 0X1061, 0X1081,
-  0X1082, 0X1082, 0X1082, 0X1082, 0X10A2, 0X18E3, 0X10C3, 0X10C3,
-  0X10A3, 0X10A3, 0X1082, 0X1083, 0X10A3, 0X18E4, 0X1905, 0X2146,
-  0X2187, 0X2167, 0X2106, 0X20E6, 0X18E6, 0X2126, 0X2107, 0X2148,
-  0X2148, 0X1927, 0X2148, 0X2189, 0X2189, 0X2169, 0X21AA, 0X21AA,
-  0X29AA, 0X29CA, 0X29EA, 0X2A0B, 0X2A2C, 0X326D, 0X326E, 0X328E,
-  0X32AF, 0X3ACF, 0X3AEF, 0X3B30, 0X4351, 0X4372, 0X43B2, 0X4BD3,
-  0X4BD3, 0X5413, 0X5434, 0X5C96, 0X5CB6, 0X5CD6, 0X64F7, 0X6538,
-  0X6D58, 0X6D79, 0X6D99, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B,
-  0X863B, 0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X867C, 0X865B, 0X7E3B,
-  0X7E1B, 0X7DFA, 0X75DA, 0X75B9, 0X7599, 0X6D58, 0X6D38, 0X6517,
-  0X64F7, 0X64D7, 0X5CB7, 0X5C96, 0X5455, 0X5414, 0X5414, 0X53F4,
-  0X4BD4, 0X4B93, 0X4372, 0X4351, 0X4330, 0X3B10, 0X4310, 0X3AEF,
-  0X3AAE, 0X3AAE, 0X328E, 0X324D, 0X322C, 0X320C, 0X320C, 0X2A0C,
-  0X21CA, 0X2189, 0X2168, 0X1928, 0X1907, 0X1927, 0X1107, 0X10E6,
-  0X10E7, 0X10E7, 0X1148, 0X0907, 0X0884, 0X0884, 0X0884, 0X08E7,
-  0X08C5, 0X0863, 0X0843, 0X0862, 0X0862, 0X0022, 0X0044, 0X0084,
-  0X0000, 0X19A9, 0X232D, 0X00C3, 0X0882, 0X0862, 0X0882, 0X0861,
-  0X0841, 0X0841, 0X08A3, 0X10E3, 0X10E3, 0X1146, 0X1105, 0X0882,
-  0X0820, 0X0820, 0X1061, 0X10A2, 0X0882, 0X0020, 0X0841, 0X0861,
-  0X1060, 0X1020, 0X1882, 0X2945, 0X29A5, 0X2164, 0X10C2, 0X1081,
-  0X18E3, 0X18E3, 0X18E2, 0X18A2, 0X18A2, 0X18C2, 0X10A1, 0X18C3,
-  0X2146, 0X10C2, 0X0861, 0X10A2, 0X10A1, 0X1081, 0X1081, 0X1081,
-  0X1082, 0X10A2, 0X10A2, 0X1082, 0X10C2, 0X18E3, 0X18C3, 0X1082,
-  0X10A3, 0X10A3, 0X10A3, 0X1083, 0X10C3, 0X1905, 0X1926, 0X2126,
-  0X1926, 0X1926, 0X18E5, 0X18C5, 0X18C5, 0X18E6, 0X20E7, 0X2107,
-  0X2128, 0X1927, 0X1927, 0X1948, 0X1989, 0X1989, 0X2189, 0X21AA,
-  0X21AA, 0X21AA, 0X21CA, 0X21CB, 0X2A0C, 0X2A4D, 0X2A4D, 0X326D,
-  0X328E, 0X32AE, 0X3ACF, 0X3B10, 0X4330, 0X4351, 0X4392, 0X43B3,
-  0X4BD3, 0X4BF3, 0X5414, 0X5475, 0X5CB6, 0X5CB6, 0X64D6, 0X64F7,
-  0X6D38, 0X6D78, 0X6D99, 0X75B9, 0X75BA, 0X75DA, 0X7DFA, 0X7E1A,
-  0X7E3B, 0X865B, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X8EFD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X865C, 0X863B, 0X7E1B,
-  0X7DFB, 0X7DDA, 0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6518, 0X64F7,
-  0X64D7, 0X5CB6, 0X5CB6, 0X5C76, 0X5435, 0X5414, 0X4BF4, 0X4BD3,
-  0X4BB2, 0X4B93, 0X4372, 0X4330, 0X4310, 0X3B10, 0X3AEF, 0X3ACE,
-  0X328E, 0X326D, 0X3A8E, 0X326D, 0X2A0B, 0X2A0B, 0X322C, 0X2A0B,
-  0X2189, 0X2168, 0X1948, 0X1927, 0X1907, 0X1907, 0X10E6, 0X10C6,
-  0X10C7, 0X08A6, 0X10E6, 0X1106, 0X08A6, 0X08A5, 0X0842, 0X0884,
-  0X1128, 0X08A6, 0X0863, 0X0842, 0X0022, 0X00A5, 0X09A9, 0X09A8,
-  0X0084, 0X122A, 0X1B0B, 0X00A2, 0X0882, 0X0861, 0X0861, 0X0841,
-  0X1062, 0X10A3, 0X08A2, 0X0820, 0X10A2, 0X1904, 0X10E3, 0X1104,
-  0X10C3, 0X10A2, 0X1082, 0X1061, 0X0861, 0X1061, 0X1082, 0X1061,
-  0X1062, 0X18E4, 0X2965, 0X2944, 0X2103, 0X2124, 0X2144, 0X2103,
-  0X20E2, 0X18C2, 0X18E2, 0X18C2, 0X1081, 0X18C2, 0X18C2, 0X2124,
-  0X1924, 0X1080, 0X1081, 0X10A1, 0X10A2, 0X10A2, 0X1081, 0X1081,
-  0X1081, 0X10A2, 0X10C2, 0X10A2, 0X18C2, 0X18E3, 0X18C3, 0X1082,
-  0X1082, 0X18C3, 0X18C3, 0X10A3, 0X18C3, 0X1925, 0X1925, 0X1905,
-  0X2126, 0X2106, 0X18E5, 0X18C5, 0X18C5, 0X18C5, 0X20E6, 0X2107,
-  0X2127, 0X1927, 0X1907, 0X1928, 0X1969, 0X1969, 0X2189, 0X2189,
-  0X21AA, 0X21AA, 0X21AA, 0X21CB, 0X29EC, 0X2A0C, 0X2A2C, 0X324C,
-  0X326D, 0X328E, 0X32AE, 0X3ACF, 0X3B0F, 0X4330, 0X4351, 0X4392,
-  0X4BB3, 0X4BD3, 0X53F3, 0X5455, 0X5CB6, 0X5CB6, 0X64B6, 0X64F7,
-  0X6517, 0X6537, 0X6D58, 0X6D99, 0X75BA, 0X75DA, 0X75FA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X865B, 0X7E3B, 0X7E1B,
-  0X7DFA, 0X75DA, 0X7599, 0X6D79, 0X6D58, 0X6D38, 0X6517, 0X64F7,
-  0X64B6, 0X5C96, 0X5C76, 0X5476, 0X5455, 0X5414, 0X4BD3, 0X4BB2,
-  0X4B92, 0X4372, 0X4351, 0X4331, 0X4310, 0X4310, 0X3ACF, 0X3A8E,
-  0X326D, 0X324C, 0X324C, 0X326D, 0X2A4D, 0X2A4C, 0X2A6D, 0X222B,
-  0X1969, 0X1948, 0X1948, 0X1927, 0X1927, 0X1906, 0X10C5, 0X10C6,
-  0X10A6, 0X0885, 0X0885, 0X08C6, 0X08A6, 0X08A5, 0X0883, 0X0863,
-  0X08A6, 0X1149, 0X08A4, 0X0002, 0X0928, 0X12ED, 0X1ACB, 0X22CC,
-  0X1B2E, 0X132D, 0X09A6, 0X0861, 0X0881, 0X0861, 0X0820, 0X0820,
-  0X0841, 0X1061, 0X0820, 0X0861, 0X1082, 0X10A2, 0X1082, 0X10A2,
-  0X1904, 0X1945, 0X1124, 0X10A3, 0X1082, 0X10C3, 0X18C3, 0X18E3,
-  0X1925, 0X2165, 0X2964, 0X2903, 0X2924, 0X2102, 0X18E2, 0X2944,
-  0X20E2, 0X1861, 0X20C2, 0X2903, 0X18C2, 0X20E2, 0X20E3, 0X2145,
-  0X1903, 0X18A1, 0X18A1, 0X18C2, 0X18C2, 0X18C2, 0X18C2, 0X10A2,
-  0X1081, 0X18A2, 0X18C2, 0X18C2, 0X18E3, 0X18E3, 0X18A2, 0X18A2,
-  0X18A2, 0X18C3, 0X18E3, 0X18E3, 0X1904, 0X2145, 0X2125, 0X2105,
-  0X2126, 0X2106, 0X1905, 0X18C5, 0X18A5, 0X18A5, 0X18C5, 0X20E6,
-  0X1927, 0X18E6, 0X1907, 0X1928, 0X2148, 0X1948, 0X2169, 0X2169,
-  0X2189, 0X21AA, 0X21AB, 0X21CA, 0X21CB, 0X29EB, 0X2A0B, 0X2A2C,
-  0X2A4C, 0X328D, 0X32AE, 0X3ACE, 0X3AEF, 0X3B10, 0X4331, 0X4371,
-  0X4391, 0X4BB3, 0X4BD4, 0X5414, 0X5496, 0X5CD7, 0X5CB6, 0X64D7,
-  0X6517, 0X6517, 0X6D38, 0X6D78, 0X7599, 0X75BA, 0X75DA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EDD, 0X8EBD, 0X8EBC, 0X869C, 0X867C, 0X865B, 0X7E1B, 0X7DFA,
-  0X7DDA, 0X75BA, 0X7599, 0X6D79, 0X6D38, 0X6D17, 0X64F7, 0X64D6,
-  0X5CB6, 0X5C75, 0X5C55, 0X5475, 0X5434, 0X4BD3, 0X4BB2, 0X4B92,
-  0X4371, 0X4350, 0X4330, 0X4331, 0X4310, 0X3AF0, 0X3AAE, 0X328E,
-  0X326D, 0X324D, 0X2A2C, 0X324D, 0X324D, 0X2A0C, 0X2A2C, 0X220B,
-  0X19AA, 0X196A, 0X1949, 0X1948, 0X1948, 0X1907, 0X10C7, 0X10C6,
-  0X10A5, 0X1084, 0X0884, 0X08A6, 0X0884, 0X0863, 0X0884, 0X08A4,
-  0X0863, 0X0863, 0X0884, 0X08E7, 0X1A8D, 0X09C7, 0X00C3, 0X1186,
-  0X11E8, 0X0945, 0X08A3, 0X08A3, 0X0882, 0X1082, 0X0840, 0X0820,
-  0X0841, 0X0861, 0X0861, 0X1081, 0X1081, 0X0861, 0X0861, 0X10C2,
-  0X10C3, 0X10A2, 0X10C3, 0X1925, 0X1904, 0X10E3, 0X10C2, 0X18E3,
-  0X2103, 0X18C2, 0X20E2, 0X2944, 0X2102, 0X18A0, 0X20A1, 0X2944,
-  0X2923, 0X1880, 0X2081, 0X28E3, 0X2924, 0X2903, 0X2945, 0X2965,
-  0X2102, 0X20C2, 0X20C2, 0X20E2, 0X20E2, 0X20E2, 0X1902, 0X18C2,
-  0X18C2, 0X18E2, 0X18C2, 0X18C2, 0X18E3, 0X1904, 0X18E3, 0X18E3,
-  0X2103, 0X2104, 0X1904, 0X1904, 0X1924, 0X2125, 0X2125, 0X2126,
-  0X2126, 0X2105, 0X2105, 0X18E5, 0X18A5, 0X18A4, 0X18C5, 0X18C6,
-  0X20E7, 0X1907, 0X1907, 0X1907, 0X1927, 0X1907, 0X1927, 0X2148,
-  0X2189, 0X2169, 0X198A, 0X21AA, 0X21CB, 0X21CA, 0X29EA, 0X2A2B,
-  0X2A2C, 0X326C, 0X328D, 0X32AE, 0X3ACF, 0X3AEF, 0X3B2F, 0X4350,
-  0X4371, 0X4BB2, 0X4BD3, 0X5414, 0X5475, 0X5CD7, 0X5CF7, 0X64F7,
-  0X64F7, 0X6517, 0X6538, 0X6D58, 0X6D79, 0X7599, 0X75B9, 0X75FA,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X865B, 0X7E3B, 0X7E1B, 0X7DFA,
-  0X75DA, 0X75B9, 0X7599, 0X6D58, 0X6D38, 0X64F7, 0X64D7, 0X5CB6,
-  0X5C96, 0X5C75, 0X5435, 0X5434, 0X5414, 0X4BD3, 0X4BB2, 0X4392,
-  0X4351, 0X4330, 0X4310, 0X3AEF, 0X3AF0, 0X3AF0, 0X3AAE, 0X326D,
-  0X324D, 0X322C, 0X2A0B, 0X2A0C, 0X2A0C, 0X2A2C, 0X29EB, 0X21CA,
-  0X21CB, 0X21AA, 0X21AA, 0X21AA, 0X1928, 0X10C6, 0X10C5, 0X10A5,
-  0X0884, 0X1084, 0X0884, 0X08C6, 0X08A5, 0X0863, 0X0883, 0X0863,
-  0X0842, 0X0002, 0X0064, 0X1A6C, 0X128A, 0X0041, 0X0021, 0X0082,
-  0X08C3, 0X10C3, 0X0882, 0X08A3, 0X0881, 0X0881, 0X1061, 0X1041,
-  0X0841, 0X0861, 0X1081, 0X10A2, 0X1081, 0X1061, 0X0861, 0X0861,
-  0X10C2, 0X1082, 0X1062, 0X18C3, 0X1082, 0X10A2, 0X1904, 0X1903,
-  0X20E2, 0X20A1, 0X28E3, 0X2923, 0X18A0, 0X1880, 0X20C1, 0X2923,
-  0X2944, 0X28E2, 0X28A1, 0X28E2, 0X2924, 0X20E4, 0X2946, 0X2944,
-  0X20E2, 0X20E3, 0X20C2, 0X20E2, 0X2102, 0X20E2, 0X18E2, 0X18E2,
-  0X20E2, 0X20E2, 0X20E2, 0X18E2, 0X18E3, 0X1904, 0X2124, 0X2144,
-  0X2144, 0X2144, 0X2124, 0X2124, 0X2124, 0X2125, 0X2145, 0X2146,
-  0X2146, 0X2125, 0X2126, 0X2126, 0X18C5, 0X18A5, 0X18A5, 0X18C5,
-  0X18C5, 0X18C6, 0X1906, 0X1906, 0X18E6, 0X18E7, 0X1907, 0X1907,
-  0X2128, 0X1968, 0X1969, 0X198A, 0X220C, 0X2A0B, 0X29EA, 0X29EB,
-  0X2A2B, 0X324C, 0X326D, 0X328D, 0X32AE, 0X3ACE, 0X3B0F, 0X3B30,
-  0X4351, 0X4391, 0X4BD2, 0X5414, 0X5476, 0X5CB6, 0X5CD6, 0X5D38,
-  0X6538, 0X64F7, 0X6517, 0X6D38, 0X6D58, 0X6D79, 0X7599, 0X75DA,
-  0X7DFA, 0X7E1B, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X8E9C, 0X8EBD,
-  0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X865B, 0X7E1B, 0X7DFB, 0X7DDA,
-  0X75BA, 0X7599, 0X6D79, 0X6D38, 0X6518, 0X64F7, 0X64D7, 0X5CB6,
-  0X5C76, 0X5435, 0X5434, 0X5414, 0X4BF3, 0X4BB3, 0X4B92, 0X4371,
-  0X4331, 0X4310, 0X3AEF, 0X3ACF, 0X3AAF, 0X3ACF, 0X32AE, 0X324D,
-  0X322C, 0X2A2C, 0X2A0C, 0X2A0C, 0X2A0D, 0X2A0C, 0X21CA, 0X1989,
-  0X2189, 0X2188, 0X2168, 0X1948, 0X10E6, 0X10A4, 0X0884, 0X0864,
-  0X0863, 0X0883, 0X1084, 0X08A5, 0X08C4, 0X0884, 0X0884, 0X0862,
-  0X0862, 0X0883, 0X0863, 0X1A2B, 0X12CC, 0X00C3, 0X0041, 0X0882,
-  0X10A3, 0X10E4, 0X08A3, 0X0862, 0X0861, 0X0861, 0X0861, 0X0861,
-  0X0861, 0X0861, 0X10A2, 0X10E2, 0X1082, 0X0861, 0X0861, 0X0840,
-  0X1081, 0X10A2, 0X18C2, 0X18E3, 0X18E3, 0X18C2, 0X2123, 0X2965,
-  0X2985, 0X3164, 0X3964, 0X3984, 0X3123, 0X2922, 0X3164, 0X3163,
-  0X39A5, 0X31A5, 0X2922, 0X2923, 0X2924, 0X2924, 0X2965, 0X2103,
-  0X20E3, 0X2103, 0X20E2, 0X20E2, 0X2123, 0X2103, 0X20E3, 0X2123,
-  0X2123, 0X20E3, 0X20E2, 0X2102, 0X2123, 0X2103, 0X2123, 0X2144,
-  0X2144, 0X2124, 0X2124, 0X2124, 0X2124, 0X2144, 0X2145, 0X2146,
-  0X2166, 0X2146, 0X1926, 0X1926, 0X2126, 0X18C5, 0X18A5, 0X18C6,
-  0X10C5, 0X18C5, 0X18E6, 0X18E6, 0X18C6, 0X18E6, 0X18E6, 0X1906,
-  0X2106, 0X2148, 0X218A, 0X19AA, 0X21CA, 0X21CA, 0X21CA, 0X29EB,
-  0X2A0C, 0X2A2C, 0X324D, 0X326D, 0X328D, 0X32AE, 0X3AEF, 0X3B0F,
-  0X4350, 0X4391, 0X4BD2, 0X4C13, 0X5455, 0X5C96, 0X5CD6, 0X5D17,
-  0X5D18, 0X6518, 0X6517, 0X6538, 0X6D58, 0X6D78, 0X6D99, 0X75B9,
-  0X75DA, 0X7DFA, 0X7E1B, 0X7E5B, 0X867C, 0X867C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X863B, 0X7E1B, 0X7DFA, 0X75DA,
-  0X75BA, 0X6D79, 0X6D58, 0X6D38, 0X64F7, 0X64D7, 0X5CB6, 0X5C96,
-  0X5C75, 0X5435, 0X5414, 0X4BF4, 0X4BD3, 0X4BB2, 0X4372, 0X4351,
-  0X4330, 0X3B10, 0X3AEF, 0X3AAF, 0X3A8E, 0X328E, 0X324D, 0X324D,
-  0X2A2D, 0X2A2D, 0X2A0C, 0X324D, 0X2A2D, 0X21AA, 0X21AA, 0X2169,
-  0X2189, 0X2168, 0X1927, 0X18E7, 0X10C6, 0X10A4, 0X0884, 0X0863,
-  0X0863, 0X0843, 0X0843, 0X0884, 0X0884, 0X1063, 0X0862, 0X0882,
-  0X0882, 0X0882, 0X08A2, 0X1147, 0X2B2F, 0X0945, 0X0821, 0X08A3,
-  0X1062, 0X1082, 0X10A3, 0X10A3, 0X10A2, 0X0881, 0X0861, 0X0840,
-  0X0840, 0X0840, 0X0840, 0X0861, 0X10A2, 0X10C3, 0X10A2, 0X18A2,
-  0X18A1, 0X2102, 0X2964, 0X3164, 0X39A5, 0X39A5, 0X41E6, 0X4A47,
-  0X4A89, 0X52C9, 0X4A47, 0X4A47, 0X4A47, 0X4A47, 0X5288, 0X5247,
-  0X5227, 0X5268, 0X4207, 0X3965, 0X3185, 0X31A5, 0X2944, 0X2124,
-  0X1903, 0X18E3, 0X18E3, 0X18E3, 0X2104, 0X1903, 0X2123, 0X2144,
-  0X2944, 0X2943, 0X2923, 0X2944, 0X2964, 0X2943, 0X2123, 0X2144,
-  0X2124, 0X2103, 0X2123, 0X2144, 0X2165, 0X1965, 0X2145, 0X1966,
-  0X2146, 0X2125, 0X1905, 0X18C5, 0X20E5, 0X2106, 0X18E6, 0X18C5,
-  0X18A5, 0X18C5, 0X18E5, 0X18A5, 0X18A5, 0X18C5, 0X18E6, 0X18E6,
-  0X18E6, 0X2107, 0X218A, 0X21AA, 0X1968, 0X2189, 0X21A9, 0X21CB,
-  0X29EB, 0X2A0B, 0X2A2C, 0X324D, 0X328D, 0X32AE, 0X3ACE, 0X3B0F,
-  0X3B30, 0X4371, 0X4BB2, 0X4BF3, 0X5434, 0X5475, 0X5C96, 0X5CB6,
-  0X5CD7, 0X64F7, 0X6517, 0X6517, 0X6D38, 0X6D58, 0X6D79, 0X7599,
-  0X75BA, 0X7DFA, 0X7DFA, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X8E9C,
-  0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X869C, 0X869C, 0X865C, 0X7E3B, 0X7DFB, 0X75DA, 0X75BA,
-  0X7599, 0X6D79, 0X6D38, 0X6518, 0X64F7, 0X64B6, 0X5C96, 0X5C75,
-  0X5C35, 0X5434, 0X5414, 0X4BF4, 0X4BD3, 0X4392, 0X4351, 0X4331,
-  0X3B10, 0X3AEF, 0X3AEF, 0X3AAE, 0X328E, 0X328D, 0X322C, 0X2A0C,
-  0X2A0C, 0X2A2D, 0X2A2D, 0X326E, 0X2A6D, 0X2A0A, 0X21AA, 0X2189,
-  0X2168, 0X1927, 0X1906, 0X10E6, 0X10C6, 0X10A5, 0X08A4, 0X0883,
-  0X0863, 0X0843, 0X0843, 0X0884, 0X0883, 0X0842, 0X0841, 0X0862,
-  0X1062, 0X0862, 0X08C3, 0X08C4, 0X22AC, 0X1A8B, 0X10E4, 0X10A4,
-  0X0882, 0X0862, 0X1082, 0X1082, 0X08A2, 0X0882, 0X10A3, 0X0861,
-  0X0841, 0X1061, 0X1061, 0X1061, 0X18C2, 0X2144, 0X2965, 0X3144,
-  0X3144, 0X41C5, 0X4A06, 0X5226, 0X5A88, 0X6289, 0X62C9, 0X732B,
-  0X736C, 0X736B, 0X6B4B, 0X630A, 0X6B2B, 0X736B, 0X6B4B, 0X6B09,
-  0X62A9, 0X6ACA, 0X62EA, 0X5269, 0X4A06, 0X4207, 0X39E7, 0X3185,
-  0X2924, 0X2103, 0X18E3, 0X20E3, 0X20E3, 0X2103, 0X2103, 0X2124,
-  0X2964, 0X2964, 0X2143, 0X2964, 0X2965, 0X2944, 0X2123, 0X2123,
-  0X2124, 0X2103, 0X1903, 0X2165, 0X21C7, 0X1966, 0X1945, 0X1945,
-  0X1905, 0X18E4, 0X20E5, 0X18E5, 0X20E5, 0X18E5, 0X18C5, 0X18A5,
-  0X18A4, 0X18A4, 0X18A5, 0X18A5, 0X10A5, 0X18C5, 0X18C6, 0X18E6,
-  0X18E6, 0X1907, 0X2148, 0X2168, 0X1948, 0X2168, 0X2189, 0X21A9,
-  0X21CA, 0X21EA, 0X2A2B, 0X2A2C, 0X2A6D, 0X328D, 0X32AE, 0X3AEF,
-  0X3B0F, 0X4350, 0X4391, 0X4BD3, 0X5414, 0X5434, 0X5455, 0X5C96,
-  0X5C96, 0X5CB6, 0X64F7, 0X6517, 0X6517, 0X6D38, 0X6D58, 0X6D99,
-  0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X867C, 0X867C, 0X869C,
-  0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X869C, 0X867C, 0X865B, 0X7E1B, 0X7DFA, 0X75DA, 0X75B9,
-  0X6D79, 0X6D58, 0X6D38, 0X64F7, 0X64D7, 0X5CB6, 0X5C76, 0X5C55,
-  0X5434, 0X5414, 0X4BF3, 0X4BF3, 0X4BB2, 0X4371, 0X4351, 0X4331,
-  0X3AF0, 0X3AF0, 0X3ACF, 0X32AE, 0X328E, 0X326D, 0X2A2C, 0X2A2C,
-  0X2A0C, 0X29EB, 0X322D, 0X326E, 0X2A0B, 0X21CA, 0X2168, 0X1927,
-  0X1927, 0X18C5, 0X10A4, 0X10C4, 0X10A4, 0X10A4, 0X10A4, 0X1083,
-  0X0883, 0X0863, 0X0863, 0X08A4, 0X08A3, 0X0021, 0X0021, 0X0841,
-  0X0821, 0X0863, 0X10E4, 0X10C3, 0X1945, 0X1A08, 0X19A8, 0X1987,
-  0X1104, 0X10A3, 0X08A3, 0X0861, 0X0861, 0X10A2, 0X10C2, 0X10A2,
-  0X10A2, 0X18C2, 0X20E3, 0X2923, 0X3164, 0X41C5, 0X4A27, 0X5247,
-  0X5A67, 0X62A8, 0X6B0A, 0X7B4B, 0X838C, 0X83CD, 0X83AD, 0X8C0E,
-  0X9470, 0X8BEE, 0X9471, 0X9430, 0X8C0E, 0X944F, 0X8C2F, 0X83EE,
-  0X83AD, 0X7B6C, 0X83AD, 0X83CE, 0X62C9, 0X62EA, 0X5AA9, 0X4A07,
-  0X41C6, 0X3164, 0X2924, 0X20E3, 0X2104, 0X2104, 0X2104, 0X2924,
-  0X2944, 0X2124, 0X2124, 0X2924, 0X2924, 0X2944, 0X2144, 0X2124,
-  0X2123, 0X2103, 0X2144, 0X21A6, 0X2186, 0X2145, 0X1904, 0X2125,
-  0X2125, 0X2105, 0X1925, 0X1925, 0X18C4, 0X18A4, 0X18A5, 0X18A4,
-  0X1884, 0X1884, 0X1884, 0X1084, 0X18A5, 0X18A5, 0X18C5, 0X18C6,
-  0X18E7, 0X1907, 0X2107, 0X2127, 0X1948, 0X2148, 0X2169, 0X2189,
-  0X21A9, 0X21CA, 0X220B, 0X2A2B, 0X2A4C, 0X326D, 0X32AE, 0X3ACE,
-  0X42EF, 0X4330, 0X4371, 0X4B92, 0X4BF3, 0X5414, 0X5414, 0X5455,
-  0X5C76, 0X5C96, 0X5CB6, 0X64F7, 0X6518, 0X6538, 0X6D58, 0X6D78,
-  0X7599, 0X75BA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865C, 0X867C, 0X869C,
-  0X869C, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E1B, 0X7DFA, 0X75BA, 0X7599,
-  0X6D59, 0X6D38, 0X6518, 0X64F7, 0X64B7, 0X5C96, 0X5C75, 0X5435,
-  0X5414, 0X53F3, 0X4BB3, 0X4BD3, 0X43B2, 0X4351, 0X4331, 0X3B10,
-  0X3AF0, 0X3AF0, 0X328E, 0X326E, 0X2A4D, 0X2A4D, 0X2A4C, 0X2A0B,
-  0X29EB, 0X29EB, 0X2A0C, 0X2A0B, 0X29A9, 0X1968, 0X1948, 0X1907,
-  0X18E5, 0X10A5, 0X1084, 0X1083, 0X1083, 0X1083, 0X10A3, 0X1083,
-  0X1083, 0X1083, 0X0883, 0X0862, 0X08A3, 0X0842, 0X0021, 0X0021,
-  0X0020, 0X0862, 0X0883, 0X10A3, 0X18E3, 0X18E3, 0X18E3, 0X21A7,
-  0X1945, 0X18E3, 0X10E3, 0X1082, 0X10A2, 0X18C3, 0X18C2, 0X20E3,
-  0X2923, 0X3164, 0X3964, 0X49E5, 0X5247, 0X62C9, 0X732B, 0X732A,
-  0X730A, 0X7B8C, 0X8C0F, 0X942F, 0X9450, 0X9C71, 0X9471, 0X9C92,
-  0XACF3, 0X9CD3, 0XA514, 0XA514, 0X9CD3, 0X9CD2, 0XA4D2, 0X9CD2,
-  0X9450, 0X9430, 0X9491, 0X8CB1, 0X7C2F, 0X8C2F, 0X736C, 0X732C,
-  0X6AAA, 0X51E6, 0X49A4, 0X3944, 0X3965, 0X3145, 0X2924, 0X2923,
-  0X2923, 0X2903, 0X2903, 0X2103, 0X2103, 0X2103, 0X1903, 0X1903,
-  0X1903, 0X2145, 0X2165, 0X2124, 0X2124, 0X2124, 0X2145, 0X2145,
-  0X2166, 0X2166, 0X1905, 0X1905, 0X18E4, 0X18A4, 0X18C5, 0X18A4,
-  0X1863, 0X1084, 0X1084, 0X1884, 0X18A5, 0X18A5, 0X1885, 0X18C6,
-  0X18E6, 0X1907, 0X1907, 0X1907, 0X2128, 0X2148, 0X2168, 0X2189,
-  0X21A9, 0X21CA, 0X21EA, 0X2A0B, 0X2A2C, 0X2A4C, 0X328D, 0X32AE,
-  0X3AEF, 0X430F, 0X4330, 0X4371, 0X4BB2, 0X4BF3, 0X53F4, 0X5434,
-  0X5455, 0X5C75, 0X5C96, 0X5CB6, 0X64F7, 0X6518, 0X6D38, 0X6D58,
-  0X6D79, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865C, 0X867C,
-  0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD,
-  0X869C, 0X867C, 0X865B, 0X7E3B, 0X7DFB, 0X75DA, 0X75BA, 0X7579,
-  0X6D58, 0X6D18, 0X64F7, 0X64D7, 0X5CB6, 0X5C76, 0X5455, 0X5434,
-  0X5414, 0X4BD3, 0X4BB3, 0X4392, 0X43B2, 0X4351, 0X3B10, 0X3AF0,
-  0X3B10, 0X32CF, 0X328E, 0X326D, 0X2A4D, 0X324D, 0X2A2C, 0X29EB,
-  0X29CA, 0X29EB, 0X2A2C, 0X21EA, 0X21EA, 0X1968, 0X1906, 0X1907,
-  0X18E6, 0X10A5, 0X1083, 0X0863, 0X0842, 0X1062, 0X0862, 0X1083,
-  0X1082, 0X1062, 0X1061, 0X0841, 0X0882, 0X10A3, 0X0861, 0X0821,
-  0X0841, 0X0062, 0X0862, 0X10A2, 0X18C2, 0X20E2, 0X2102, 0X2103,
-  0X18E3, 0X18C2, 0X18C2, 0X18C2, 0X2124, 0X2123, 0X3123, 0X3984,
-  0X41C5, 0X4A06, 0X5A46, 0X6AE9, 0X736B, 0X83CE, 0X9471, 0X8C2F,
-  0X8BCE, 0X9450, 0X9450, 0X9CB2, 0XA4D3, 0XA4D2, 0XAD55, 0XBDB7,
-  0XC5F8, 0XC5F7, 0XC638, 0XC638, 0XC618, 0XC5F8, 0XC5F8, 0XBDF8,
-  0XBDB6, 0XAD75, 0XA555, 0XAD96, 0XA575, 0X9CB2, 0X9431, 0X9450,
-  0X8BEE, 0X732B, 0X62A9, 0X5A68, 0X5207, 0X4986, 0X3924, 0X3164,
-  0X2944, 0X2123, 0X2103, 0X20E3, 0X20E3, 0X18E2, 0X18C2, 0X1903,
-  0X2124, 0X1904, 0X18E3, 0X18E2, 0X18E3, 0X1924, 0X2165, 0X2124,
-  0X1925, 0X2166, 0X2104, 0X1925, 0X1925, 0X18C5, 0X18A5, 0X1884,
-  0X1084, 0X10A4, 0X1084, 0X1884, 0X1884, 0X18C5, 0X18C6, 0X18C5,
-  0X18C6, 0X18E6, 0X1907, 0X1907, 0X2107, 0X2148, 0X2148, 0X2168,
-  0X2189, 0X21AA, 0X21CA, 0X21EA, 0X2A2B, 0X2A2C, 0X2A6D, 0X32AD,
-  0X3AAF, 0X3AEF, 0X4310, 0X4350, 0X4B92, 0X4BD3, 0X4BF3, 0X5414,
-  0X5434, 0X5455, 0X5C75, 0X5C96, 0X64D6, 0X6517, 0X6538, 0X6D58,
-  0X6D78, 0X7599, 0X75BA, 0X75DA, 0X7E1A, 0X7E3B, 0X865B, 0X867C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X86BC,
-  0X869C, 0X867C, 0X865B, 0X7E3B, 0X7DFA, 0X75DA, 0X7599, 0X6D79,
-  0X6D58, 0X6518, 0X64F7, 0X64B7, 0X5C96, 0X5C75, 0X5C55, 0X5414,
-  0X53F4, 0X4BD3, 0X4B92, 0X4372, 0X4372, 0X4351, 0X3B30, 0X3B30,
-  0X3AEF, 0X328E, 0X328E, 0X326D, 0X2A2C, 0X2A2D, 0X2A2C, 0X29EB,
-  0X21AA, 0X2A0C, 0X222C, 0X21CA, 0X21CA, 0X1947, 0X18E6, 0X1906,
-  0X10E6, 0X10A5, 0X0863, 0X0842, 0X0842, 0X0842, 0X0842, 0X1062,
-  0X0841, 0X0841, 0X1041, 0X1040, 0X1081, 0X10A2, 0X0861, 0X0841,
-  0X0861, 0X0861, 0X1061, 0X1881, 0X18C1, 0X20E2, 0X2102, 0X20E2,
-  0X20E2, 0X20C2, 0X20C2, 0X20E3, 0X3144, 0X39C6, 0X41A5, 0X49C5,
-  0X5A47, 0X6AA8, 0X834B, 0X93EE, 0X9C70, 0XA491, 0XACF3, 0XAD34,
-  0XA4F3, 0X9CF3, 0XB576, 0XCE38, 0XCE59, 0XD69A, 0XE73C, 0XEF7D,
-  0XF79E, 0XF79E, 0XF7BE, 0XF7BE, 0XFFBF, 0XF7BE, 0XF79E, 0XF79E,
-  0XEF7E, 0XEF5D, 0XE71C, 0XDEDB, 0XD69A, 0XC5F8, 0XBD96, 0XAD54,
-  0X9CB2, 0X9451, 0X83EF, 0X7B8D, 0X632B, 0X6268, 0X51A6, 0X41A6,
-  0X39A6, 0X2923, 0X20E3, 0X20E2, 0X20C2, 0X18A2, 0X18A2, 0X18C3,
-  0X18C3, 0X1882, 0X18A2, 0X18A2, 0X18C3, 0X1904, 0X18E3, 0X18C3,
-  0X2124, 0X2186, 0X2165, 0X2105, 0X20E5, 0X18C4, 0X18A4, 0X1884,
-  0X18A4, 0X18A4, 0X1884, 0X1884, 0X1084, 0X18A4, 0X18E6, 0X18C5,
-  0X10A5, 0X18C6, 0X1907, 0X1907, 0X1907, 0X1928, 0X1948, 0X2148,
-  0X2168, 0X21AA, 0X21CB, 0X21CA, 0X2A0B, 0X2A2C, 0X2A4C, 0X2A8D,
-  0X32AE, 0X3AD0, 0X3B30, 0X4330, 0X4350, 0X4BB2, 0X4BD2, 0X4BF3,
-  0X5414, 0X5434, 0X5C75, 0X5C95, 0X5CB6, 0X64D7, 0X6518, 0X6D38,
-  0X6D58, 0X6D79, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865C,
-  0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C,
-  0X869C, 0X867C, 0X7E3B, 0X7E3B, 0X7E1B, 0X75DA, 0X7599, 0X6D79,
-  0X6D38, 0X6D18, 0X64D7, 0X5CB6, 0X5C96, 0X5C55, 0X5435, 0X5414,
-  0X4BD3, 0X4BB3, 0X4B92, 0X4351, 0X4351, 0X4371, 0X3B71, 0X3B10,
-  0X32AE, 0X328E, 0X326E, 0X2A6D, 0X2A2C, 0X2A2D, 0X2A0D, 0X29EC,
-  0X2A2D, 0X2A8E, 0X224C, 0X21A9, 0X2189, 0X1927, 0X18E6, 0X1906,
-  0X10C5, 0X10A4, 0X0863, 0X0863, 0X0843, 0X0843, 0X0863, 0X0842,
-  0X0821, 0X0821, 0X0821, 0X1040, 0X1060, 0X1861, 0X1881, 0X18A1,
-  0X1061, 0X1040, 0X1040, 0X1040, 0X1880, 0X18A1, 0X18A1, 0X20C2,
-  0X20E2, 0X2903, 0X3144, 0X3985, 0X49C6, 0X5248, 0X5AA9, 0X6B2A,
-  0X72C9, 0X836D, 0X9C51, 0XA492, 0XACF3, 0XAD35, 0XB576, 0XC618,
-  0XD67A, 0XDEDB, 0XF79E, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF5D, 0XDEDB,
-  0XCE39, 0XB577, 0XA4D3, 0X9471, 0X8C2F, 0X7BCD, 0X6B2C, 0X5A49,
-  0X49C6, 0X3944, 0X28E3, 0X20E2, 0X20C2, 0X1882, 0X18A2, 0X1882,
-  0X1061, 0X1882, 0X1882, 0X1882, 0X18C3, 0X18E3, 0X18E3, 0X18E3,
-  0X2145, 0X21A6, 0X2165, 0X1925, 0X18C4, 0X18C4, 0X18A4, 0X18A4,
-  0X18A4, 0X1884, 0X1084, 0X1884, 0X1884, 0X18A5, 0X18A5, 0X10C5,
-  0X18A5, 0X18C5, 0X1907, 0X1907, 0X1907, 0X1928, 0X2148, 0X2148,
-  0X2169, 0X21AA, 0X29CB, 0X21CB, 0X21EB, 0X2A0B, 0X2A2C, 0X2A6C,
-  0X328E, 0X32D0, 0X3B10, 0X430F, 0X4330, 0X4371, 0X43B2, 0X4BD3,
-  0X53F3, 0X5414, 0X5454, 0X5C75, 0X5C96, 0X64D6, 0X64F7, 0X6D38,
-  0X6D58, 0X6D78, 0X7599, 0X75B9, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B,
-  0X867C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C,
-  0X869C, 0X865C, 0X7E3B, 0X7E1B, 0X7E1B, 0X75DA, 0X7599, 0X6D58,
-  0X6D38, 0X6517, 0X64D7, 0X5C96, 0X5C75, 0X5435, 0X5414, 0X53F4,
-  0X4BD3, 0X4B92, 0X4372, 0X4351, 0X4331, 0X4351, 0X3B51, 0X32EF,
-  0X32AE, 0X328E, 0X328E, 0X2A6D, 0X326D, 0X2A6E, 0X224D, 0X2A4D,
-  0X2A6D, 0X2A2C, 0X220B, 0X21EA, 0X21A9, 0X1928, 0X10C5, 0X10C5,
-  0X18E5, 0X18C5, 0X10A4, 0X10A5, 0X10A4, 0X1083, 0X1062, 0X0821,
-  0X0821, 0X1041, 0X1061, 0X1041, 0X1861, 0X20C2, 0X20E2, 0X1881,
-  0X1860, 0X1040, 0X1040, 0X1040, 0X1860, 0X1881, 0X1881, 0X20A2,
-  0X28C2, 0X3103, 0X3964, 0X49E6, 0X5AA8, 0X6B6C, 0X840F, 0X83EE,
-  0X838D, 0X9450, 0XA4B2, 0XAD34, 0XBDD8, 0XD6BB, 0XE73D, 0XF79E,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XEF5D, 0XDE9A, 0XBDB7, 0XACD3, 0X9491, 0X8C10, 0X836D,
-  0X6ACA, 0X5A08, 0X4165, 0X30C3, 0X28A2, 0X20C2, 0X1882, 0X1861,
-  0X1841, 0X1841, 0X1862, 0X1082, 0X10A2, 0X18C2, 0X18E3, 0X1904,
-  0X2165, 0X21A6, 0X1945, 0X2125, 0X18C4, 0X18C4, 0X18E4, 0X18C4,
-  0X18A4, 0X1084, 0X10A4, 0X1884, 0X1884, 0X1084, 0X1084, 0X1884,
-  0X18A5, 0X10A5, 0X18C6, 0X1927, 0X1907, 0X18E7, 0X2128, 0X218A,
-  0X218A, 0X2189, 0X2189, 0X21AA, 0X21CB, 0X220B, 0X2A2C, 0X2A4C,
-  0X326D, 0X32B0, 0X3AEF, 0X3B0F, 0X4330, 0X4371, 0X4392, 0X4BB2,
-  0X53F3, 0X5414, 0X5434, 0X5C55, 0X5C95, 0X5CB6, 0X64F7, 0X6518,
-  0X6D58, 0X6D79, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X863B,
-  0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C,
-  0X869C, 0X867C, 0X7E3B, 0X7E1B, 0X7E1B, 0X75DA, 0X7599, 0X6D58,
-  0X6D38, 0X64F7, 0X64D7, 0X5C96, 0X5C75, 0X5434, 0X5414, 0X4BD3,
-  0X4BD3, 0X4B92, 0X4352, 0X4331, 0X3B10, 0X3B11, 0X4352, 0X3B10,
-  0X32EF, 0X32CF, 0X32AE, 0X328E, 0X324D, 0X2A2C, 0X224C, 0X222B,
-  0X2A0B, 0X21A9, 0X1988, 0X19A8, 0X21A8, 0X1927, 0X10E6, 0X10C5,
-  0X1906, 0X10E5, 0X10A4, 0X10A4, 0X18E5, 0X10C4, 0X1062, 0X0841,
-  0X0861, 0X1062, 0X1882, 0X1882, 0X2103, 0X2143, 0X18A2, 0X1081,
-  0X1861, 0X1861, 0X1860, 0X1861, 0X1861, 0X1861, 0X2081, 0X28A2,
-  0X30E3, 0X3944, 0X51C5, 0X6246, 0X72EA, 0X8C2F, 0X9470, 0X9410,
-  0X9C92, 0XA4D3, 0XBDD7, 0XDEDB, 0XEF7E, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XF79E, 0XDEDB, 0XC5F7, 0XA492, 0X8BEF,
-  0X83CE, 0X7B6D, 0X5A49, 0X4165, 0X38E3, 0X28C2, 0X2082, 0X1841,
-  0X1841, 0X1041, 0X1041, 0X1061, 0X1061, 0X10A2, 0X18E3, 0X18E4,
-  0X1944, 0X2185, 0X1925, 0X2104, 0X18E4, 0X18E4, 0X18E4, 0X20C4,
-  0X20A4, 0X1884, 0X10A4, 0X10A4, 0X1083, 0X1083, 0X1063, 0X1864,
-  0X10A5, 0X10A5, 0X10A5, 0X18C5, 0X1907, 0X1929, 0X2149, 0X2189,
-  0X2169, 0X1968, 0X2168, 0X21A9, 0X21CA, 0X21EB, 0X2A0C, 0X2A2D,
-  0X2A4E, 0X328F, 0X3AEF, 0X3B0F, 0X3B30, 0X4351, 0X4371, 0X4BB2,
-  0X4BD3, 0X53F3, 0X5414, 0X5454, 0X5C75, 0X5CB6, 0X64D6, 0X64F7,
-  0X6D38, 0X6D78, 0X6D79, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B,
-  0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C,
-  0X867C, 0X7E5B, 0X7E5B, 0X7E1B, 0X75FA, 0X75DA, 0X6D79, 0X6D58,
-  0X6D38, 0X64F7, 0X64B7, 0X5C96, 0X5C75, 0X5434, 0X53F4, 0X4BD3,
-  0X4BB2, 0X4B92, 0X4372, 0X3B31, 0X3B11, 0X4351, 0X3B71, 0X3330,
-  0X32EF, 0X32CF, 0X32AE, 0X2A6D, 0X2A2C, 0X2A2C, 0X2A2B, 0X21EA,
-  0X21A9, 0X2168, 0X1968, 0X1948, 0X1988, 0X1988, 0X1968, 0X10E6,
-  0X10C5, 0X10A4, 0X10A3, 0X1083, 0X10A4, 0X10A4, 0X1082, 0X10A2,
-  0X10A2, 0X10A2, 0X1882, 0X20E3, 0X2164, 0X18C2, 0X1882, 0X18A2,
-  0X18A2, 0X18A1, 0X1881, 0X1861, 0X1881, 0X20C2, 0X28C2, 0X30E2,
-  0X4184, 0X5206, 0X62A8, 0X730A, 0X8BAD, 0X9C10, 0X9471, 0XAD35,
-  0XCE39, 0XDEDC, 0XEF9E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFBF, 0XDEDB, 0XBD97,
-  0X9C93, 0X83D0, 0X734D, 0X62A9, 0X4944, 0X38E3, 0X28C3, 0X2062,
-  0X1841, 0X1020, 0X1020, 0X1021, 0X1021, 0X1082, 0X10C2, 0X10A2,
-  0X18E3, 0X2185, 0X1925, 0X18E4, 0X1904, 0X18E3, 0X18C3, 0X18A3,
-  0X20A4, 0X1884, 0X1083, 0X10A3, 0X10A4, 0X10A4, 0X1063, 0X1063,
-  0X1084, 0X1885, 0X18A5, 0X18C5, 0X1907, 0X2169, 0X2148, 0X1927,
-  0X2148, 0X1968, 0X2168, 0X2189, 0X29AA, 0X29CA, 0X29EB, 0X2A2C,
-  0X2A6E, 0X32AE, 0X3B10, 0X3B30, 0X3B30, 0X3B30, 0X4351, 0X4B92,
-  0X4BB2, 0X53F3, 0X5414, 0X5434, 0X5C55, 0X5C95, 0X5CB6, 0X64D7,
-  0X6517, 0X6D58, 0X6D58, 0X7599, 0X75BA, 0X7DFA, 0X7DFA, 0X7E1B,
-  0X865B, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C,
-  0X865B, 0X7E3B, 0X7E3B, 0X7E1B, 0X75FA, 0X75DA, 0X6D79, 0X6D38,
-  0X6D17, 0X64F7, 0X64D6, 0X5C96, 0X5C75, 0X5434, 0X4BF4, 0X4BD3,
-  0X4392, 0X4372, 0X4352, 0X4332, 0X4352, 0X4371, 0X3B10, 0X32EF,
-  0X32AE, 0X328D, 0X328D, 0X2A6D, 0X2A4C, 0X2A4C, 0X220A, 0X2189,
-  0X2168, 0X2147, 0X1927, 0X1927, 0X1968, 0X1927, 0X2148, 0X1927,
-  0X18E6, 0X10C4, 0X10C4, 0X18C4, 0X18C4, 0X18C3, 0X10A3, 0X10A3,
-  0X18C3, 0X18C2, 0X20E3, 0X2184, 0X18E3, 0X1862, 0X18A2, 0X18C3,
-  0X18A2, 0X18A1, 0X1081, 0X1881, 0X20A2, 0X28E3, 0X3944, 0X51C6,
-  0X6227, 0X6AC9, 0X7B8C, 0X8BCF, 0X9C72, 0XA514, 0XB5B7, 0XD6BB,
-  0XF79E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7BF,
-  0XDEBB, 0XAD55, 0X8C10, 0X7B2D, 0X6A69, 0X49A6, 0X3104, 0X28C3,
-  0X1882, 0X1000, 0X1800, 0X1020, 0X1021, 0X1061, 0X1061, 0X1062,
-  0X1082, 0X1944, 0X1904, 0X18C3, 0X18C3, 0X18C3, 0X18A3, 0X1883,
-  0X1883, 0X1883, 0X1083, 0X1083, 0X10A4, 0X18A5, 0X18C5, 0X18C5,
-  0X10A5, 0X1085, 0X18C6, 0X1907, 0X1927, 0X1906, 0X1906, 0X1907,
-  0X1948, 0X2168, 0X1968, 0X1989, 0X21A9, 0X29CA, 0X2A0B, 0X2A4D,
-  0X326D, 0X328E, 0X3AEF, 0X3B31, 0X4331, 0X4330, 0X4371, 0X4BB2,
-  0X4BD3, 0X4BD3, 0X53F3, 0X5434, 0X5455, 0X5C95, 0X5CB6, 0X64D6,
-  0X6517, 0X6D38, 0X6D58, 0X6D79, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B,
-  0X863B, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE,
-  0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X86BD, 0X869C,
-  0X865B, 0X7E1B, 0X7DFA, 0X7E1B, 0X7E1B, 0X75DA, 0X6D79, 0X6D38,
-  0X6D18, 0X6517, 0X64D7, 0X5C96, 0X5455, 0X5414, 0X4BF4, 0X4BB3,
-  0X4B92, 0X4352, 0X4331, 0X4352, 0X4372, 0X3B10, 0X3AEF, 0X3ACF,
-  0X326D, 0X324C, 0X2A2C, 0X2A0B, 0X2A0B, 0X2A0B, 0X21A9, 0X2169,
-  0X2168, 0X2147, 0X1926, 0X1927, 0X1927, 0X1906, 0X1906, 0X1927,
-  0X1987, 0X1105, 0X18E4, 0X18E5, 0X18E4, 0X18E4, 0X18C3, 0X18C3,
-  0X18C3, 0X18C3, 0X2965, 0X2123, 0X18A2, 0X20C3, 0X20E4, 0X18C3,
-  0X18C2, 0X18C2, 0X20A2, 0X20A2, 0X28E2, 0X3143, 0X49A5, 0X6A68,
-  0X72EA, 0X83CE, 0X9CB2, 0XA4F4, 0XAD15, 0XCE19, 0XE73D, 0XFFDF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XEF7D, 0XC5F8, 0X9493, 0X734D, 0X5AAB, 0X5208, 0X3103,
-  0X2082, 0X1841, 0X1800, 0X1800, 0X1041, 0X1041, 0X1021, 0X1041,
-  0X1061, 0X10E3, 0X1903, 0X10A2, 0X18A3, 0X18A3, 0X1083, 0X1082,
-  0X1083, 0X1083, 0X1083, 0X1084, 0X10A4, 0X18C5, 0X18E5, 0X1906,
-  0X18C5, 0X10E6, 0X1906, 0X18E6, 0X18C5, 0X18C5, 0X18E6, 0X1907,
-  0X1927, 0X1948, 0X1968, 0X2189, 0X2189, 0X29AA, 0X2A2C, 0X324D,
-  0X322C, 0X326D, 0X32AE, 0X3B0F, 0X4331, 0X4330, 0X4351, 0X4B92,
-  0X4BD3, 0X4BD3, 0X53F3, 0X5414, 0X5434, 0X5C75, 0X5C95, 0X64D6,
-  0X64F7, 0X6D38, 0X6D58, 0X6D78, 0X7599, 0X75DA, 0X7DFA, 0X7E1B,
-  0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD,
-  0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X86BD, 0X869C,
-  0X7E3B, 0X7E1A, 0X7DFA, 0X7DFA, 0X761B, 0X75FB, 0X6DB9, 0X6D58,
-  0X6D58, 0X6517, 0X64D7, 0X5C96, 0X5455, 0X5414, 0X53F3, 0X4BB3,
-  0X4B72, 0X4351, 0X4331, 0X4392, 0X3B71, 0X3B31, 0X3B10, 0X32AE,
-  0X324D, 0X2A2C, 0X2A0B, 0X29CA, 0X21CA, 0X21A9, 0X2189, 0X2168,
-  0X2168, 0X1947, 0X1926, 0X1927, 0X1906, 0X1906, 0X18E5, 0X10E5,
-  0X1946, 0X1926, 0X18C4, 0X18A3, 0X18C3, 0X18E4, 0X2146, 0X2145,
-  0X18A3, 0X2165, 0X2144, 0X18A2, 0X18C3, 0X2104, 0X1903, 0X18E3,
-  0X18C3, 0X18A2, 0X20A2, 0X28E3, 0X3123, 0X51C5, 0X6248, 0X6ACA,
-  0X83AD, 0X9491, 0XA536, 0XBDD9, 0XCE7A, 0XF79E, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XD6DB, 0X9C93, 0X838F, 0X6ACB, 0X4945,
-  0X3104, 0X2882, 0X2000, 0X1821, 0X1821, 0X1000, 0X1021, 0X1020,
-  0X1021, 0X10C3, 0X1904, 0X10C3, 0X18A3, 0X1082, 0X1062, 0X1863,
-  0X1883, 0X1883, 0X1083, 0X1884, 0X18A4, 0X18C4, 0X1084, 0X18A4,
-  0X18E5, 0X1927, 0X10E5, 0X1884, 0X18A5, 0X18C5, 0X18E6, 0X18E7,
-  0X1907, 0X1927, 0X2168, 0X2169, 0X218A, 0X21CB, 0X2A2B, 0X320B,
-  0X322C, 0X324C, 0X3A8D, 0X3ACE, 0X3B10, 0X4330, 0X4330, 0X4371,
-  0X4BB2, 0X4BD3, 0X53F3, 0X5414, 0X5434, 0X5455, 0X5C95, 0X5CB6,
-  0X64F7, 0X6517, 0X6D58, 0X6D78, 0X7599, 0X75B9, 0X7DDA, 0X7DFA,
-  0X7E1B, 0X865B, 0X867C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD, 0X96FD,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X86BD, 0X86BD, 0X869C,
-  0X7E3B, 0X7DFA, 0X75FA, 0X75DA, 0X75FA, 0X75FB, 0X75FB, 0X6DB9,
-  0X6D58, 0X6538, 0X5CF7, 0X5C95, 0X5455, 0X5414, 0X4BD3, 0X4BB2,
-  0X4371, 0X4351, 0X4392, 0X43B3, 0X3B51, 0X3B30, 0X3ACF, 0X326E,
-  0X2A2D, 0X2A2C, 0X2A0B, 0X29EB, 0X21CA, 0X21A9, 0X2189, 0X2188,
-  0X1988, 0X2168, 0X1947, 0X1927, 0X1906, 0X1906, 0X1926, 0X1926,
-  0X2126, 0X2126, 0X1905, 0X18C4, 0X18C4, 0X1904, 0X21A6, 0X2A49,
-  0X2229, 0X21C7, 0X18C3, 0X18C3, 0X18C3, 0X2104, 0X2104, 0X2103,
-  0X20E3, 0X20C2, 0X2904, 0X4185, 0X51A5, 0X61E6, 0X6AAA, 0X83CE,
-  0X9471, 0XA4F4, 0XB5B8, 0XDEFC, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XE71D, 0XB556, 0X7B2D, 0X6209,
-  0X49E7, 0X3904, 0X2882, 0X1861, 0X1841, 0X1021, 0X1001, 0X1020,
-  0X1020, 0X1062, 0X10C3, 0X18C3, 0X10A3, 0X1083, 0X1883, 0X1863,
-  0X1883, 0X1883, 0X1863, 0X1083, 0X18A4, 0X18C4, 0X18A4, 0X18A4,
-  0X18E5, 0X18E5, 0X10E5, 0X18C5, 0X18C5, 0X18E5, 0X18C6, 0X18E6,
-  0X1907, 0X1947, 0X1968, 0X2168, 0X21AA, 0X220C, 0X2A0B, 0X29EA,
-  0X2A0B, 0X322C, 0X3A6D, 0X3AAE, 0X3AEF, 0X4331, 0X4350, 0X4351,
-  0X4B91, 0X4BB2, 0X4BD3, 0X53F4, 0X5434, 0X5455, 0X5C75, 0X5CB6,
-  0X64F7, 0X6517, 0X6D38, 0X6D58, 0X6D79, 0X75B9, 0X75DA, 0X7DFA,
-  0X7E1B, 0X863B, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X96FD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X86BD, 0X86BD, 0X869C,
-  0X7E3B, 0X7DFA, 0X75DA, 0X75DA, 0X75DA, 0X75DA, 0X761B, 0X75FB,
-  0X6D99, 0X6558, 0X6517, 0X5CB6, 0X5475, 0X5434, 0X4BF3, 0X4BB2,
-  0X4372, 0X4373, 0X43B3, 0X4392, 0X3B30, 0X32AE, 0X326E, 0X326D,
-  0X2A4D, 0X2A2C, 0X2A0B, 0X2A0B, 0X29EA, 0X21CA, 0X21A9, 0X21A9,
-  0X21A8, 0X21A8, 0X2188, 0X1947, 0X1927, 0X2167, 0X2167, 0X2146,
-  0X2146, 0X2125, 0X2125, 0X2146, 0X1946, 0X1924, 0X1882, 0X328A,
-  0X33EE, 0X1124, 0X1883, 0X1924, 0X2165, 0X1904, 0X18E3, 0X18C3,
-  0X20C2, 0X2924, 0X3144, 0X4984, 0X6A47, 0X72C9, 0X7B6C, 0X9450,
-  0XAD14, 0XBDD8, 0XE71C, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XF7BE, 0XF7BE,
-  0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE,
-  0XF7BE, 0XF7BE, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XEF5D, 0XAD15, 0X738E,
-  0X628B, 0X51E8, 0X3945, 0X20A2, 0X1861, 0X1821, 0X1000, 0X1000,
-  0X0820, 0X0800, 0X1041, 0X10C3, 0X10A2, 0X1883, 0X1883, 0X1062,
-  0X1083, 0X1883, 0X1083, 0X1062, 0X1083, 0X18C4, 0X18A4, 0X18C5,
-  0X20C5, 0X10A4, 0X10A4, 0X18E5, 0X10E5, 0X18E5, 0X18E6, 0X1906,
-  0X1927, 0X1947, 0X2148, 0X21AA, 0X21EA, 0X21CA, 0X2A0B, 0X2A0B,
-  0X2A0B, 0X2A2C, 0X324D, 0X3A8E, 0X3ACE, 0X4310, 0X4330, 0X4330,
-  0X4351, 0X4B92, 0X4BD2, 0X53F3, 0X5413, 0X5434, 0X5C75, 0X5C95,
-  0X64D6, 0X6517, 0X6518, 0X6D58, 0X6D79, 0X7599, 0X75DA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X86BD, 0X867C,
-  0X7E3B, 0X7E1B, 0X75DA, 0X75BA, 0X75B9, 0X75BA, 0X75FA, 0X6DFA,
-  0X6DBA, 0X6558, 0X64F7, 0X5CD6, 0X5475, 0X5434, 0X4BF3, 0X4BD3,
-  0X43B3, 0X43B4, 0X4393, 0X3B51, 0X3AEF, 0X32AE, 0X328E, 0X326D,
-  0X2A6D, 0X2A4D, 0X2A0C, 0X2A2B, 0X220A, 0X21CA, 0X29EA, 0X21C9,
-  0X21C9, 0X2188, 0X2168, 0X1947, 0X2187, 0X2187, 0X1925, 0X1905,
-  0X18E4, 0X18A3, 0X18C3, 0X1945, 0X18E3, 0X1082, 0X1862, 0X21C7,
-  0X2B6C, 0X1944, 0X18E3, 0X1945, 0X18E3, 0X18A3, 0X18A3, 0X20C3,
-  0X2903, 0X3944, 0X4984, 0X5A07, 0X6ACA, 0X83AE, 0X8C31, 0X9452,
-  0XBDB7, 0XE73D, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XF7BE, 0XF7BE, 0XF7BE, 0XF79E, 0XF79E, 0XF79E,
-  0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D,
-  0XEF7D, 0XF79E, 0XF79E, 0XF79E, 0XF7BE, 0XF7BE, 0XF7BE, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF77E, 0XBDB8,
-  0X7B8F, 0X626A, 0X5186, 0X30E4, 0X28E3, 0X2042, 0X1000, 0X1000,
-  0X1000, 0X1000, 0X0841, 0X10A2, 0X10A2, 0X10A3, 0X1883, 0X1883,
-  0X1883, 0X1883, 0X1884, 0X1063, 0X10A4, 0X18C4, 0X18A4, 0X20C5,
-  0X20E6, 0X18A4, 0X1883, 0X18C4, 0X18E5, 0X1927, 0X1947, 0X1927,
-  0X1907, 0X1927, 0X2169, 0X21EA, 0X21EA, 0X21A9, 0X29CA, 0X2A0B,
-  0X2A2C, 0X2A2C, 0X324C, 0X328D, 0X3ACE, 0X3AEF, 0X4330, 0X4330,
-  0X4350, 0X4B71, 0X4BB2, 0X4BD3, 0X53F3, 0X5434, 0X5455, 0X5C95,
-  0X64D6, 0X6517, 0X6538, 0X6D58, 0X6D78, 0X7599, 0X75B9, 0X75DA,
-  0X7DFA, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X869C, 0X867C,
-  0X7E3B, 0X7DFA, 0X75FA, 0X75BA, 0X7599, 0X75DA, 0X75D9, 0X6D99,
-  0X6DB9, 0X6579, 0X5CF7, 0X5495, 0X5454, 0X4C13, 0X4BD3, 0X43B2,
-  0X43B2, 0X43F4, 0X43D4, 0X3B51, 0X3AEF, 0X32AF, 0X328E, 0X2A6D,
-  0X2A4D, 0X324D, 0X2A4D, 0X2A4C, 0X220A, 0X21A9, 0X21C9, 0X21C9,
-  0X21C9, 0X2188, 0X2167, 0X2187, 0X2167, 0X2146, 0X18E4, 0X20E4,
-  0X1883, 0X1883, 0X1904, 0X18C4, 0X18E4, 0X1925, 0X1062, 0X1925,
-  0X2289, 0X19C5, 0X1903, 0X18C3, 0X18C3, 0X18C3, 0X20E3, 0X2924,
-  0X3145, 0X49C6, 0X5A07, 0X6A89, 0X836C, 0X9C92, 0XA4D5, 0XB577,
-  0XE71D, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XFFDF, 0XF7BE,
-  0XF7BE, 0XF79E, 0XF79E, 0XEF7D, 0XEF7D, 0XEF5D, 0XE73C, 0XE73C,
-  0XE73C, 0XE71C, 0XE71C, 0XE71C, 0XE71C, 0XE71C, 0XE71C, 0XE71C,
-  0XE73C, 0XE73C, 0XE73C, 0XEF5D, 0XEF7D, 0XEF7D, 0XF79E, 0XF79E,
-  0XF7BE, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7BF,
-  0XBDD8, 0X7BAF, 0X6A28, 0X5986, 0X3905, 0X20A3, 0X1841, 0X1001,
-  0X1001, 0X1000, 0X1041, 0X1062, 0X1082, 0X10A3, 0X1082, 0X18A3,
-  0X1883, 0X1883, 0X1884, 0X18C4, 0X10C4, 0X10A3, 0X1883, 0X1883,
-  0X18E5, 0X20C5, 0X18A4, 0X18A5, 0X1927, 0X1968, 0X2188, 0X1967,
-  0X1968, 0X2189, 0X29EA, 0X21EA, 0X21C9, 0X29C9, 0X21A9, 0X29EA,
-  0X2A2B, 0X322C, 0X324C, 0X326D, 0X3AAE, 0X3ACF, 0X430F, 0X4330,
-  0X4351, 0X4B92, 0X4BB2, 0X4BD3, 0X53F3, 0X5414, 0X5454, 0X5C75,
-  0X5CB6, 0X64F7, 0X6538, 0X6D58, 0X6D58, 0X6D99, 0X75B9, 0X75DA,
-  0X7DFA, 0X7E1B, 0X865B, 0X867C, 0X869C, 0X86BC, 0X8EBD, 0X8EDD,
-  0X8EFD, 0X8EDD, 0X8EBD, 0X8EBC, 0X869C, 0X867C, 0X869C, 0X867C,
-  0X7E3B, 0X7E1B, 0X75FA, 0X75B9, 0X6D99, 0X75DA, 0X6DB9, 0X6558,
-  0X6558, 0X6538, 0X5CF7, 0X5496, 0X5434, 0X4BF3, 0X4BB3, 0X4392,
-  0X4392, 0X43D3, 0X43D3, 0X3B51, 0X32CF, 0X32AE, 0X326D, 0X2A2C,
-  0X2A0C, 0X2A4D, 0X2A6D, 0X2A6C, 0X2A4B, 0X21EA, 0X2188, 0X2188,
-  0X2167, 0X2147, 0X2146, 0X2146, 0X1905, 0X18E5, 0X18E4, 0X18A3,
-  0X20E4, 0X21A7, 0X18E5, 0X18C4, 0X19C7, 0X2228, 0X2249, 0X2289,
-  0X19E6, 0X18E2, 0X18C2, 0X1082, 0X18C2, 0X18C2, 0X2103, 0X3145,
-  0X41C7, 0X5228, 0X6AAA, 0X7B4D, 0X9431, 0XA4B4, 0XC5D8, 0XE73D,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XFFDF, 0XF7BE, 0XF79E, 0XF79E,
-  0XEF7D, 0XEF5D, 0XE73C, 0XE71C, 0XE71C, 0XDEFB, 0XDEDB, 0XD6BA,
-  0XD6BA, 0XD6BA, 0XD69A, 0XD69A, 0XD69A, 0XD69A, 0XD69A, 0XD6BA,
-  0XD6BA, 0XD6BA, 0XDEDB, 0XDEFB, 0XE71C, 0XE71C, 0XE73C, 0XEF5D,
-  0XEF7D, 0XF79E, 0XF79E, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XF7BF, 0XBD97, 0X834E, 0X624A, 0X38E4, 0X20A3, 0X20A3, 0X1841,
-  0X1041, 0X1062, 0X1041, 0X1041, 0X1041, 0X1082, 0X10C3, 0X18C4,
-  0X1883, 0X1883, 0X18A4, 0X18E5, 0X18A4, 0X1042, 0X1063, 0X1863,
-  0X1884, 0X18E5, 0X18E5, 0X18E6, 0X18E6, 0X1906, 0X2167, 0X2188,
-  0X21A9, 0X21EA, 0X21A8, 0X1988, 0X21A9, 0X29C9, 0X21CA, 0X21CA,
-  0X2A0B, 0X322C, 0X324D, 0X324C, 0X32AD, 0X3ACE, 0X3AEF, 0X4330,
-  0X4351, 0X4B71, 0X4B92, 0X4BD3, 0X53F3, 0X5434, 0X5454, 0X5C95,
-  0X5CF7, 0X6517, 0X64F7, 0X6D38, 0X6D79, 0X6D99, 0X75BA, 0X75FA,
-  0X7E1B, 0X7E1B, 0X7E3B, 0X865C, 0X869C, 0X86BD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X867C, 0X867C,
-  0X7E3B, 0X7E3B, 0X75FA, 0X75B9, 0X6D99, 0X75BA, 0X6D99, 0X6558,
-  0X6537, 0X5CF7, 0X5CD6, 0X5496, 0X5455, 0X4BF3, 0X4BB2, 0X4372,
-  0X43D3, 0X43D2, 0X4351, 0X3B51, 0X3AEF, 0X32AE, 0X328D, 0X324C,
-  0X2A2D, 0X2A4C, 0X2A0B, 0X29CA, 0X29EA, 0X29C9, 0X2188, 0X2167,
-  0X2146, 0X2126, 0X1906, 0X18E5, 0X18E5, 0X18C4, 0X18A3, 0X18A4,
-  0X21C7, 0X228A, 0X21E8, 0X19A6, 0X1123, 0X18E3, 0X21E7, 0X2269,
-  0X1123, 0X1061, 0X1881, 0X1881, 0X1861, 0X20A2, 0X2904, 0X3924,
-  0X49A5, 0X62A9, 0X7BAE, 0X9431, 0XA4B4, 0XB556, 0XE6FC, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XFFDF, 0XF7BE, 0XF79E, 0XF79E, 0XEF7D, 0XE73C,
-  0XE71C, 0XDEFB, 0XDEDB, 0XD6BA, 0XD69A, 0XCE79, 0XCE59, 0XC638,
-  0XC618, 0XC618, 0XC618, 0XBDF7, 0XBDF7, 0XBDF7, 0XC618, 0XC618,
-  0XC618, 0XC638, 0XCE59, 0XCE79, 0XD69A, 0XD6BA, 0XDEDB, 0XDEFB,
-  0XE71C, 0XE73C, 0XEF7D, 0XF79E, 0XF79E, 0XF7BE, 0XFFDF, 0XFFDF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XF79E, 0XB577, 0X736F, 0X4987, 0X4125, 0X2904, 0X1882,
-  0X1882, 0X1062, 0X1041, 0X1041, 0X1021, 0X1062, 0X1905, 0X18C4,
-  0X1083, 0X1883, 0X18C4, 0X1905, 0X1883, 0X1043, 0X1043, 0X1863,
-  0X1883, 0X1883, 0X18C4, 0X20E5, 0X18C4, 0X18A4, 0X2147, 0X21A9,
-  0X21A8, 0X2188, 0X1947, 0X2127, 0X2148, 0X2189, 0X29EA, 0X29EA,
-  0X29EA, 0X322B, 0X326D, 0X326D, 0X326D, 0X3ACE, 0X3AEF, 0X430F,
-  0X4330, 0X4351, 0X4B92, 0X4BB2, 0X4BF3, 0X5434, 0X5475, 0X5CB6,
-  0X5D17, 0X6517, 0X6538, 0X6D99, 0X6DBA, 0X6DBA, 0X75DA, 0X761B,
-  0X7E3B, 0X7E3B, 0X7E5C, 0X867C, 0X869C, 0X86BD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X867C, 0X867C, 0X7E5C,
-  0X7E3B, 0X7E3B, 0X75FA, 0X7599, 0X6D99, 0X6DB9, 0X6D78, 0X6558,
-  0X6537, 0X5CD6, 0X5495, 0X5455, 0X5475, 0X4C76, 0X4C35, 0X4C14,
-  0X4455, 0X4414, 0X4372, 0X3B71, 0X330F, 0X32AD, 0X326C, 0X326D,
-  0X328D, 0X2A2B, 0X21CA, 0X21A9, 0X2188, 0X2188, 0X21A8, 0X2188,
-  0X2147, 0X2126, 0X1905, 0X18E5, 0X20E5, 0X18C4, 0X1905, 0X1967,
-  0X19C8, 0X1986, 0X2165, 0X2165, 0X10A2, 0X1082, 0X18C3, 0X2985,
-  0X18A2, 0X1061, 0X1082, 0X1862, 0X2082, 0X20E3, 0X3165, 0X49A5,
-  0X6206, 0X7AEB, 0X8C10, 0X9C92, 0XAD35, 0XDEBB, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XFFDF, 0XF7BE, 0XF7BE, 0XF79E, 0XEF7D, 0XE73C, 0XE71C, 0XDEFB,
-  0XD6BA, 0XD69A, 0XCE59, 0XC618, 0XBDF7, 0XBDD7, 0XB5B6, 0XB596,
-  0XAD75, 0XAD55, 0XAD55, 0XA534, 0XA534, 0XA534, 0XAD55, 0XAD55,
-  0XAD75, 0XB596, 0XB5B6, 0XBDD7, 0XBDF7, 0XC618, 0XCE59, 0XD69A,
-  0XD6BA, 0XDEFB, 0XE71C, 0XE73C, 0XEF7D, 0XF79E, 0XF7BE, 0XF7BE,
-  0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XEF5E, 0XA4F4, 0X6AAC, 0X51C8, 0X3945, 0X2904,
-  0X20A3, 0X1882, 0X1862, 0X1842, 0X1042, 0X10A3, 0X10C3, 0X18E4,
-  0X10C4, 0X18C4, 0X1905, 0X1905, 0X18A4, 0X1063, 0X1063, 0X1884,
-  0X1883, 0X1883, 0X1883, 0X18A4, 0X18C5, 0X20C5, 0X1926, 0X1968,
-  0X1947, 0X1927, 0X1927, 0X1927, 0X2148, 0X1989, 0X21CA, 0X2A0B,
-  0X2A0B, 0X2A2C, 0X326D, 0X328D, 0X326D, 0X3AAE, 0X3AEF, 0X42EF,
-  0X4310, 0X4330, 0X4B71, 0X4B92, 0X4BD3, 0X5414, 0X5475, 0X5CD6,
-  0X5CB6, 0X64D6, 0X6538, 0X6579, 0X6D79, 0X6D99, 0X75B9, 0X75DA,
-  0X75FA, 0X7E3B, 0X7E5B, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X865C, 0X7E5C, 0X7E5B,
-  0X7E3B, 0X761B, 0X75FA, 0X6D99, 0X6D99, 0X6DB9, 0X6558, 0X6538,
-  0X6517, 0X5CF7, 0X5CF7, 0X54D6, 0X54D6, 0X54D7, 0X54D7, 0X4C55,
-  0X4434, 0X4454, 0X4455, 0X3BF3, 0X3B50, 0X32CE, 0X328E, 0X32AE,
-  0X2A6D, 0X2A2B, 0X29EA, 0X29A9, 0X21A9, 0X29C9, 0X21A9, 0X2188,
-  0X2167, 0X2147, 0X2146, 0X1906, 0X1926, 0X2167, 0X21E9, 0X2208,
-  0X21E8, 0X1986, 0X18C3, 0X10C3, 0X10C3, 0X10C3, 0X1986, 0X1965,
-  0X18A2, 0X18A3, 0X18A3, 0X18E3, 0X2904, 0X2944, 0X3984, 0X5A07,
-  0X72AA, 0X8B8E, 0X9C92, 0XA535, 0XCE5A, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF,
-  0XF7BE, 0XF79E, 0XEF7D, 0XE73C, 0XE71C, 0XDEDB, 0XD6BA, 0XCE79,
-  0XC638, 0XBDF7, 0XB5B6, 0XAD75, 0XAD55, 0XA514, 0X9CF3, 0X9CD3,
-  0X94B2, 0X9492, 0X8C71, 0X8C71, 0X8C71, 0X8C71, 0X8C71, 0X9492,
-  0X94B2, 0X9CD3, 0X9CF3, 0XA514, 0XAD55, 0XAD75, 0XB5B6, 0XBDF7,
-  0XC638, 0XCE79, 0XD6BA, 0XDEDB, 0XE71C, 0XE73C, 0XEF7D, 0XF79E,
-  0XF7BE, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XDEDC, 0X9C33, 0X628B, 0X4A08, 0X4186,
-  0X20C3, 0X1862, 0X1842, 0X1883, 0X18A4, 0X1082, 0X1082, 0X18E4,
-  0X1904, 0X1905, 0X18E4, 0X18E4, 0X18C4, 0X1883, 0X1883, 0X1884,
-  0X2084, 0X1884, 0X1083, 0X18A4, 0X20E5, 0X2106, 0X2147, 0X1947,
-  0X1948, 0X1968, 0X1968, 0X2169, 0X2189, 0X21A9, 0X21EA, 0X2A2C,
-  0X328D, 0X328D, 0X328D, 0X328D, 0X3AEF, 0X4330, 0X3B10, 0X4330,
-  0X4351, 0X4351, 0X4B92, 0X4BB3, 0X4BF3, 0X5434, 0X5475, 0X5CD6,
-  0X5CD7, 0X5CD7, 0X6518, 0X6558, 0X6D59, 0X6D99, 0X6DB9, 0X75DA,
-  0X75FA, 0X7DFA, 0X7E3B, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X867C, 0X865B, 0X7E5B, 0X7E3B,
-  0X7E3B, 0X761B, 0X75FA, 0X6DBA, 0X6D99, 0X6DB9, 0X6558, 0X6558,
-  0X6517, 0X5CF7, 0X5D17, 0X5D37, 0X5D38, 0X54D6, 0X4C96, 0X4434,
-  0X43F3, 0X4475, 0X4475, 0X4455, 0X3BD3, 0X3B51, 0X3330, 0X32EF,
-  0X328D, 0X2A2C, 0X2A0B, 0X2A0B, 0X2A0A, 0X2A0A, 0X29C9, 0X21A9,
-  0X21A9, 0X2188, 0X2167, 0X1967, 0X1987, 0X19C8, 0X224A, 0X19C8,
-  0X19A7, 0X19A6, 0X1966, 0X1945, 0X10C3, 0X1925, 0X19A6, 0X1103,
-  0X18E3, 0X18A3, 0X1883, 0X20E3, 0X2904, 0X3104, 0X49C6, 0X62AA,
-  0X7B6D, 0X9471, 0XACF4, 0XCDF8, 0XF77E, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XF7BE,
-  0XF79E, 0XEF5D, 0XE73C, 0XDEFB, 0XD6BA, 0XCE79, 0XC618, 0XBDD7,
-  0XB596, 0XA534, 0X9CF3, 0X94B2, 0X8C71, 0X8C51, 0X8410, 0X7BEF,
-  0X7BCF, 0X73AE, 0X73AE, 0X738E, 0X738E, 0X738E, 0X73AE, 0X73AE,
-  0X7BCF, 0X7BEF, 0X8410, 0X8C51, 0X8C71, 0X94B2, 0X9CF3, 0XA534,
-  0XB596, 0XBDD7, 0XC618, 0XCE79, 0XD6BA, 0XDEFB, 0XE73C, 0XEF5D,
-  0XF79E, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XCE5B, 0X8C12, 0X628A, 0X41A6,
-  0X3125, 0X2105, 0X18C4, 0X18C4, 0X10A3, 0X1083, 0X18A3, 0X10C3,
-  0X1904, 0X1905, 0X18C4, 0X18C4, 0X18C4, 0X1883, 0X1083, 0X1883,
-  0X18A4, 0X18A4, 0X1883, 0X1884, 0X20E5, 0X2127, 0X1947, 0X1948,
-  0X1948, 0X1947, 0X1968, 0X1967, 0X1947, 0X2168, 0X21A9, 0X29CA,
-  0X2A2B, 0X32AD, 0X3ACF, 0X3B30, 0X4392, 0X4351, 0X4330, 0X4351,
-  0X4371, 0X4B92, 0X4BD2, 0X4BD3, 0X53F4, 0X5434, 0X5455, 0X54B6,
-  0X5CD7, 0X5CD7, 0X6537, 0X6579, 0X6D79, 0X6D99, 0X6DDA, 0X75DA,
-  0X75FA, 0X7E1B, 0X7E3B, 0X867C, 0X869C, 0X869C, 0X86BD, 0X8EBD,
-  0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X867C, 0X867C, 0X7E5B, 0X7E1B,
-  0X7E1B, 0X75FA, 0X75FA, 0X6DDA, 0X6D99, 0X6DB9, 0X6558, 0X6537,
-  0X6517, 0X5CF7, 0X5D17, 0X5D38, 0X5D38, 0X54D7, 0X54B6, 0X4CB6,
-  0X4454, 0X4455, 0X43F4, 0X43F4, 0X3BD3, 0X3B71, 0X3BB1, 0X3B91,
-  0X32EF, 0X2A6C, 0X2A4C, 0X2A4C, 0X2A4B, 0X2A2A, 0X21EA, 0X21C9,
-  0X21C9, 0X29EA, 0X2A0A, 0X220A, 0X19A8, 0X222A, 0X228A, 0X19A7,
-  0X19A7, 0X1966, 0X18E4, 0X1904, 0X1904, 0X21A7, 0X1945, 0X1082,
-  0X1083, 0X18C3, 0X20E4, 0X2104, 0X2904, 0X3945, 0X5A28, 0X6B0C,
-  0X8BF0, 0XA4D4, 0XBDD8, 0XEF3D, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF7BE, 0XEF7D,
-  0XEF5D, 0XE71C, 0XDEDB, 0XD69A, 0XC638, 0XBDD7, 0XAD75, 0XA534,
-  0X9CD3, 0X9492, 0X8430, 0X7BEF, 0X73AE, 0X6B6D, 0X6B4D, 0X630C,
-  0X5AEB, 0X5AEB, 0X5ACB, 0X5ACB, 0X5ACB, 0X5ACB, 0X5ACB, 0X5AEB,
-  0X5AEB, 0X630C, 0X6B4D, 0X6B6D, 0X73AE, 0X7BEF, 0X8430, 0X9492,
-  0X9CD3, 0XA534, 0XAD75, 0XBDD7, 0XC638, 0XD69A, 0XDEDB, 0XE71C,
-  0XEF5D, 0XEF7D, 0XF7BE, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7BF, 0XBDF9, 0X83CF, 0X628A,
-  0X49E8, 0X39C7, 0X2105, 0X18A3, 0X18C4, 0X18E4, 0X18A3, 0X1062,
-  0X10A3, 0X1905, 0X1905, 0X18E5, 0X18C5, 0X10A4, 0X10A4, 0X10A4,
-  0X10A3, 0X18A3, 0X1883, 0X1883, 0X20A5, 0X1906, 0X1906, 0X1906,
-  0X1906, 0X18E5, 0X2106, 0X2127, 0X2127, 0X2127, 0X2148, 0X2988,
-  0X29A9, 0X326C, 0X3B2F, 0X3B91, 0X4391, 0X3AEF, 0X3ACE, 0X430F,
-  0X4330, 0X4350, 0X4371, 0X4BB2, 0X4BD2, 0X4BF3, 0X5414, 0X5475,
-  0X5C95, 0X5CB5, 0X5CD6, 0X6517, 0X6558, 0X6D78, 0X6D99, 0X75B9,
-  0X75FA, 0X7E1B, 0X7E5C, 0X869C, 0X869C, 0X869C, 0X86BD, 0X8EBD,
-  0X8EDD, 0X8EBD, 0X86BD, 0X869D, 0X869C, 0X867C, 0X7E3B, 0X7E1A,
-  0X7DFA, 0X75FA, 0X6DDA, 0X6DDA, 0X6DBA, 0X6D99, 0X6558, 0X6517,
-  0X5CF6, 0X5D17, 0X6538, 0X5D38, 0X54D6, 0X5475, 0X4C54, 0X4C75,
-  0X4C96, 0X4475, 0X43D3, 0X3B92, 0X3BD2, 0X3BD2, 0X3BB2, 0X3371,
-  0X3350, 0X2AAD, 0X2A8D, 0X2AEF, 0X2ACD, 0X2A4B, 0X2A4B, 0X2A6C,
-  0X2A6C, 0X2A4B, 0X2A4B, 0X2ACC, 0X222A, 0X224A, 0X2249, 0X1946,
-  0X1925, 0X1904, 0X18E4, 0X10A3, 0X1925, 0X2186, 0X10E3, 0X10A3,
-  0X10A2, 0X1882, 0X20E4, 0X2904, 0X2904, 0X49A6, 0X6229, 0X7B4D,
-  0X9452, 0X9CD4, 0XD69A, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XEF7D, 0XE73C,
-  0XDEFB, 0XD6BA, 0XCE59, 0XC618, 0XB596, 0XA534, 0X9CD3, 0X8C71,
-  0X8410, 0X73AE, 0X6B6D, 0X632C, 0X5ACB, 0X52AA, 0X4A69, 0X4A49,
-  0X4228, 0X4208, 0X4208, 0X39E7, 0X39E7, 0X39E7, 0X4208, 0X4208,
-  0X4228, 0X4A49, 0X4A69, 0X52AA, 0X5ACB, 0X632C, 0X6B6D, 0X73AE,
-  0X8410, 0X8C71, 0X9CD3, 0XA534, 0XB596, 0XC618, 0XCE59, 0XD6BA,
-  0XDEFB, 0XE73C, 0XEF7D, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XEF5E, 0XB596, 0X8410,
-  0X5A6A, 0X4186, 0X2925, 0X20E4, 0X2104, 0X1904, 0X18A3, 0X1083,
-  0X10C4, 0X1105, 0X1926, 0X10C4, 0X10A4, 0X10E5, 0X10A4, 0X18A4,
-  0X18A4, 0X1884, 0X18A4, 0X18A4, 0X18C5, 0X18C4, 0X18E4, 0X1906,
-  0X18E6, 0X18A5, 0X20C5, 0X2106, 0X2107, 0X2127, 0X2148, 0X2968,
-  0X21C9, 0X324C, 0X3AAE, 0X32ED, 0X3B2F, 0X3AEE, 0X3AAE, 0X3ACE,
-  0X430F, 0X430F, 0X4330, 0X4B71, 0X4BB2, 0X4BD3, 0X5413, 0X5455,
-  0X5C75, 0X5C95, 0X5CB6, 0X64F7, 0X6538, 0X6D58, 0X6D99, 0X75B9,
-  0X75DA, 0X761A, 0X7E5C, 0X7E7C, 0X869C, 0X869C, 0X86BC, 0X8EBD,
-  0X8EDD, 0X8EBD, 0X86BD, 0X86BD, 0X869C, 0X7E5C, 0X7E1B, 0X7E1A,
-  0X75DA, 0X75FA, 0X75DA, 0X6DDA, 0X6DDA, 0X6578, 0X6537, 0X64F7,
-  0X5CD6, 0X6517, 0X5D17, 0X54B6, 0X5496, 0X4C54, 0X4C14, 0X4C14,
-  0X4414, 0X43D3, 0X4392, 0X3B50, 0X3B30, 0X3B30, 0X3310, 0X2ACE,
-  0X3330, 0X32EE, 0X32CE, 0X3391, 0X336F, 0X222A, 0X2A6C, 0X332E,
-  0X330E, 0X220A, 0X21C9, 0X2A8C, 0X224A, 0X21C7, 0X1987, 0X1966,
-  0X1945, 0X1945, 0X1904, 0X10E4, 0X1965, 0X1925, 0X10A3, 0X18A2,
-  0X18A3, 0X1882, 0X28C3, 0X2904, 0X3946, 0X5208, 0X72CA, 0X8BF0,
-  0X8C93, 0XB597, 0XEF7E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XEF7D, 0XE73C, 0XDEFB,
-  0XD69A, 0XCE59, 0XBDD7, 0XAD75, 0X9CF3, 0X9492, 0X8410, 0X73AE,
-  0X6B4D, 0X5AEB, 0X52AA, 0X4A69, 0X4228, 0X39E7, 0X39C7, 0X31A6,
-  0X3186, 0X2965, 0X2965, 0X2945, 0X2945, 0X2945, 0X2965, 0X2965,
-  0X3186, 0X31A6, 0X39C7, 0X39E7, 0X4228, 0X4A69, 0X52AA, 0X5AEB,
-  0X6B4D, 0X73AE, 0X8410, 0X9492, 0X9CF3, 0XAD75, 0XBDD7, 0XCE59,
-  0XD69A, 0XDEFB, 0XE73C, 0XEF7D, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XDEFC, 0XA4F4,
-  0X6B4D, 0X4A28, 0X39A8, 0X2966, 0X2946, 0X2125, 0X18E4, 0X18E5,
-  0X18E5, 0X18E5, 0X10C4, 0X10C5, 0X10A4, 0X10A3, 0X1083, 0X1884,
-  0X1884, 0X1884, 0X18A4, 0X18C4, 0X18E4, 0X2105, 0X18E5, 0X2106,
-  0X20E6, 0X18A4, 0X18C5, 0X18E6, 0X2106, 0X2127, 0X2127, 0X2168,
-  0X29CA, 0X2A6D, 0X328D, 0X324B, 0X3AEE, 0X3B2F, 0X3AAE, 0X3AAE,
-  0X3AEF, 0X430F, 0X4330, 0X4B51, 0X4B92, 0X4BD2, 0X53F3, 0X5435,
-  0X5C75, 0X5C95, 0X5CB6, 0X64F7, 0X6538, 0X6D58, 0X6D99, 0X6DB9,
-  0X75DA, 0X7E1B, 0X7E5C, 0X7E7C, 0X869C, 0X869C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EBD, 0X86BD, 0X86BD, 0X869C, 0X7E5B, 0X7E1B, 0X75FA,
-  0X75DA, 0X75DA, 0X75FA, 0X6DDA, 0X6DDA, 0X6D78, 0X6537, 0X6517,
-  0X5D17, 0X5D17, 0X5CD6, 0X5495, 0X5495, 0X5475, 0X4C55, 0X4C35,
-  0X43F4, 0X43B3, 0X4371, 0X3B30, 0X3AEF, 0X3AAE, 0X32CE, 0X32AE,
-  0X32CE, 0X3330, 0X332F, 0X2AAC, 0X32CD, 0X2AAD, 0X226B, 0X21E9,
-  0X29C9, 0X222B, 0X226B, 0X1A09, 0X19A7, 0X21A7, 0X1946, 0X1945,
-  0X1965, 0X1945, 0X1925, 0X1945, 0X1965, 0X10E4, 0X10A3, 0X18A3,
-  0X18C3, 0X20E4, 0X2924, 0X3125, 0X49A6, 0X6269, 0X7B2C, 0X9432,
-  0XA4D5, 0XD6BB, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE73C, 0XDEFB, 0XD69A,
-  0XC638, 0XBDD7, 0XAD55, 0X9CD3, 0X8C51, 0X7BCF, 0X6B4D, 0X5AEB,
-  0X528A, 0X4228, 0X39E7, 0X31A6, 0X2965, 0X2945, 0X2124, 0X2104,
-  0X18E3, 0X18E3, 0X18E3, 0X18C3, 0X18C3, 0X18C3, 0X18E3, 0X18E3,
-  0X18E3, 0X2104, 0X2124, 0X2945, 0X2965, 0X31A6, 0X39E7, 0X4228,
-  0X528A, 0X5AEB, 0X6B4D, 0X7BCF, 0X8C51, 0X9CD3, 0XAD55, 0XBDD7,
-  0XC638, 0XD69A, 0XDEFB, 0XE73C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFDF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7BF, 0XCE3A,
-  0X8C71, 0X630C, 0X4A4A, 0X39C8, 0X31A7, 0X2947, 0X2126, 0X2125,
-  0X18E5, 0X0883, 0X0883, 0X1905, 0X08A4, 0X0883, 0X10A4, 0X1083,
-  0X1083, 0X18A4, 0X18A3, 0X1883, 0X18A4, 0X2105, 0X1905, 0X18E6,
-  0X1926, 0X18E5, 0X18C5, 0X18E6, 0X18E6, 0X1907, 0X1947, 0X2189,
-  0X29EB, 0X32AD, 0X326C, 0X29EA, 0X328D, 0X4330, 0X3ACE, 0X3AAE,
-  0X3ACF, 0X430F, 0X4330, 0X4351, 0X4B91, 0X4BB2, 0X53F3, 0X5434,
-  0X5454, 0X5C95, 0X5CB6, 0X64F6, 0X6538, 0X6D58, 0X6D58, 0X6DB9,
-  0X75FA, 0X761B, 0X7E5B, 0X7E7C, 0X867C, 0X869C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X869C, 0X7E5B, 0X7E1B, 0X75FA,
-  0X75DA, 0X75DA, 0X75FA, 0X6DFA, 0X6DBA, 0X6D99, 0X6598, 0X6558,
-  0X6558, 0X5D17, 0X5CF7, 0X54D6, 0X54B6, 0X5496, 0X4C55, 0X4BF4,
-  0X43B3, 0X43B2, 0X4371, 0X3B10, 0X3AEF, 0X3ACF, 0X3AEF, 0X32EE,
-  0X328C, 0X32EE, 0X330D, 0X2A0A, 0X2A6C, 0X332E, 0X2A2A, 0X2188,
-  0X2188, 0X21C9, 0X226B, 0X1A2A, 0X19C8, 0X2166, 0X1925, 0X1945,
-  0X1945, 0X1904, 0X2124, 0X2186, 0X1945, 0X10C3, 0X10A3, 0X18C3,
-  0X18C3, 0X2104, 0X3145, 0X4186, 0X5A48, 0X730B, 0X83AF, 0X8C12,
-  0XBD98, 0XF77E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE73C, 0XDEFB, 0XD69A, 0XC638,
-  0XB5B6, 0XA534, 0X94B2, 0X8430, 0X73AE, 0X632C, 0X52AA, 0X4A49,
-  0X39E7, 0X31A6, 0X2965, 0X2124, 0X18E3, 0X18C3, 0X18C3, 0X10A2,
-  0X1082, 0X1082, 0X1082, 0X0861, 0X0861, 0X0861, 0X1082, 0X1082,
-  0X1082, 0X10A2, 0X18C3, 0X18C3, 0X18E3, 0X2124, 0X2965, 0X31A6,
-  0X39E7, 0X4A49, 0X52AA, 0X632C, 0X73AE, 0X8430, 0X94B2, 0XA534,
-  0XB5B6, 0XC638, 0XD69A, 0XDEFB, 0XE73C, 0XEF7D, 0XF7BE, 0XFFDF,
-  0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XE73D,
-  0XB577, 0X7BEF, 0X5ACB, 0X424A, 0X3A08, 0X31E8, 0X2167, 0X2125,
-  0X18C4, 0X0883, 0X10A4, 0X10A3, 0X10E5, 0X08C5, 0X10A4, 0X10A3,
-  0X10A4, 0X18A4, 0X18A4, 0X18A4, 0X18A3, 0X18E5, 0X18E5, 0X18E5,
-  0X18E5, 0X18E5, 0X18C5, 0X18E6, 0X18E6, 0X18E6, 0X2168, 0X29C9,
-  0X29EA, 0X326C, 0X326C, 0X2A0B, 0X326C, 0X430F, 0X3B0F, 0X3ACE,
-  0X3ACF, 0X3AEF, 0X4330, 0X4350, 0X4B91, 0X4BB2, 0X53F3, 0X5434,
-  0X5454, 0X5C75, 0X5CB6, 0X64D6, 0X6558, 0X6D99, 0X6D78, 0X6DDA,
-  0X761B, 0X763B, 0X7E5B, 0X7E7C, 0X867C, 0X867C, 0X869C, 0X86BD,
-  0X8EDD, 0X86BD, 0X869C, 0X869C, 0X7E7C, 0X7E3B, 0X7E1B, 0X75FA,
-  0X75DA, 0X75BA, 0X6DBA, 0X6DDA, 0X6DDA, 0X6DDA, 0X65B9, 0X5D58,
-  0X5D38, 0X5CF7, 0X54B6, 0X54B6, 0X5495, 0X4C34, 0X4BD3, 0X4BB2,
-  0X4392, 0X4392, 0X4351, 0X4310, 0X3AEF, 0X4330, 0X4370, 0X32EE,
-  0X326C, 0X2A0B, 0X29EA, 0X2A0B, 0X29EA, 0X29E9, 0X2187, 0X2146,
-  0X2147, 0X2147, 0X1967, 0X21E9, 0X222A, 0X19A7, 0X1966, 0X2166,
-  0X1966, 0X1904, 0X1945, 0X1986, 0X10E4, 0X10A3, 0X10A3, 0X18A3,
-  0X18C3, 0X20E4, 0X3145, 0X49A6, 0X6289, 0X83CE, 0X9451, 0X9C93,
-  0XD67B, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XF7BE, 0XF79E, 0XEF5D, 0XDEFB, 0XD69A, 0XC638, 0XB5B6,
-  0XA534, 0X9492, 0X8410, 0X6B6D, 0X5AEB, 0X4A69, 0X4208, 0X31A6,
-  0X2965, 0X2124, 0X18E3, 0X18C3, 0X1082, 0X1082, 0X0861, 0X0841,
-  0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841,
-  0X0841, 0X0841, 0X0861, 0X1082, 0X1082, 0X18C3, 0X18E3, 0X2124,
-  0X2965, 0X31A6, 0X4208, 0X4A69, 0X5AEB, 0X6B6D, 0X8410, 0X9492,
-  0XA534, 0XB5B6, 0XC638, 0XD69A, 0XDEFB, 0XEF5D, 0XF79E, 0XF7BE,
-  0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF79E,
-  0XC63A, 0X8451, 0X634C, 0X528A, 0X4249, 0X3A8A, 0X31E9, 0X2146,
-  0X1946, 0X1905, 0X10C4, 0X10C4, 0X10E5, 0X1105, 0X10E5, 0X1083,
-  0X18A3, 0X1083, 0X18A3, 0X18C4, 0X18C4, 0X18C5, 0X18C4, 0X18E5,
-  0X18E5, 0X18A4, 0X20C5, 0X18E5, 0X18E6, 0X2127, 0X1948, 0X2167,
-  0X29C9, 0X2A2B, 0X326C, 0X326D, 0X328D, 0X3ACE, 0X3AEE, 0X4310,
-  0X3AEF, 0X3AEF, 0X4310, 0X4350, 0X4B91, 0X4BB2, 0X5413, 0X5434,
-  0X5434, 0X5C75, 0X5C96, 0X64D6, 0X6558, 0X6DDA, 0X6DDA, 0X75FA,
-  0X761B, 0X763B, 0X7E5C, 0X7E7C, 0X7E7C, 0X867C, 0X869C, 0X869C,
-  0X8EDD, 0X86BD, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X75FB, 0X75FA,
-  0X75DA, 0X6DB9, 0X6DB9, 0X6DBA, 0X6DDA, 0X6DB9, 0X6558, 0X6558,
-  0X5D17, 0X5495, 0X5434, 0X5413, 0X5434, 0X5434, 0X4BD3, 0X4B92,
-  0X4391, 0X4392, 0X4371, 0X4330, 0X3B0F, 0X4350, 0X3B2F, 0X328D,
-  0X322B, 0X29EA, 0X29EA, 0X29EA, 0X2188, 0X2147, 0X2146, 0X2126,
-  0X2147, 0X1946, 0X2146, 0X1946, 0X21E9, 0X2208, 0X1966, 0X2186,
-  0X21A6, 0X1966, 0X19A7, 0X1145, 0X10A3, 0X10A3, 0X1082, 0X1882,
-  0X18C3, 0X2104, 0X3145, 0X4A07, 0X732C, 0X9430, 0X9CB2, 0XBDF8,
-  0XF77E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XF7BE, 0XF79E, 0XEF5D, 0XE71C, 0XD6BA, 0XCE59, 0XBDD7, 0XA534,
-  0X9492, 0X8410, 0X6B6D, 0X5ACB, 0X4A49, 0X39E7, 0X2965, 0X2124,
-  0X18E3, 0X10A2, 0X1082, 0X0861, 0X0841, 0X0841, 0X0020, 0X0020,
-  0X0020, 0X0020, 0X0020, 0X0020, 0X0000, 0X0020, 0X0020, 0X0020,
-  0X0020, 0X0020, 0X0020, 0X0841, 0X0841, 0X0861, 0X1082, 0X10A2,
-  0X18E3, 0X2124, 0X2965, 0X39E7, 0X4A49, 0X5ACB, 0X6B6D, 0X8410,
-  0X9492, 0XA534, 0XBDD7, 0XCE59, 0XD6BA, 0XE71C, 0XEF5D, 0XF79E,
-  0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XDEDC, 0XA515, 0X7BCF, 0X5AAA, 0X4A8A, 0X42CC, 0X322A, 0X29C8,
-  0X21A8, 0X1926, 0X1905, 0X10C4, 0X1083, 0X10A3, 0X10E4, 0X1083,
-  0X1883, 0X1883, 0X1082, 0X10A3, 0X18A4, 0X20E4, 0X18C4, 0X18C5,
-  0X20E5, 0X18A4, 0X18C5, 0X18E5, 0X1906, 0X2148, 0X2148, 0X2127,
-  0X29A9, 0X2A2B, 0X328E, 0X3ACF, 0X328D, 0X326C, 0X3AAD, 0X432F,
-  0X3B2F, 0X3B0F, 0X4310, 0X4350, 0X4B91, 0X4BB2, 0X53F3, 0X5434,
-  0X5434, 0X5C75, 0X5CB6, 0X64F7, 0X6599, 0X6DFA, 0X6E1A, 0X6E1A,
-  0X761A, 0X763B, 0X7E3B, 0X7E5B, 0X7E5B, 0X865B, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X75FB, 0X75FB,
-  0X75FA, 0X6D99, 0X6D99, 0X6D99, 0X6D99, 0X6558, 0X6537, 0X6558,
-  0X5CD6, 0X5434, 0X5413, 0X53F3, 0X4BF3, 0X5434, 0X5434, 0X43D2,
-  0X43B2, 0X43D3, 0X43B2, 0X4391, 0X4371, 0X3B0F, 0X3ACE, 0X3AAD,
-  0X324B, 0X29C9, 0X29EA, 0X29C9, 0X2168, 0X2147, 0X2147, 0X2147,
-  0X2147, 0X1926, 0X1926, 0X2146, 0X21C8, 0X19C7, 0X1966, 0X1945,
-  0X21A6, 0X19E7, 0X1945, 0X10C3, 0X10A3, 0X10C3, 0X10A3, 0X18C3,
-  0X20E4, 0X2924, 0X3986, 0X5269, 0X738D, 0X9471, 0XA4D4, 0XD69B,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XF7BE, 0XEF7D, 0XE73C, 0XDEDB, 0XCE59, 0XBDD7, 0XAD55, 0X94B2,
-  0X8410, 0X6B6D, 0X5ACB, 0X4A49, 0X39C7, 0X2965, 0X2104, 0X18C3,
-  0X1082, 0X0861, 0X0841, 0X0841, 0X0020, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0020, 0X0020, 0X0841, 0X0841, 0X0861,
-  0X1082, 0X18C3, 0X2104, 0X2965, 0X39C7, 0X4A49, 0X5ACB, 0X6B6D,
-  0X8410, 0X94B2, 0XAD55, 0XBDD7, 0XCE59, 0XDEDB, 0XE73C, 0XEF7D,
-  0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XEF7E, 0XCE19, 0X9C71, 0X62EB, 0X4249, 0X42AB, 0X322A, 0X3209,
-  0X21A8, 0X1946, 0X1905, 0X10E4, 0X10C4, 0X10A3, 0X10A3, 0X1082,
-  0X1883, 0X18C4, 0X18C4, 0X18A3, 0X1883, 0X20E4, 0X18E5, 0X18E5,
-  0X2105, 0X18C5, 0X18A5, 0X20E6, 0X2127, 0X2126, 0X2127, 0X2148,
-  0X29EA, 0X324C, 0X328D, 0X326C, 0X322B, 0X324C, 0X3A8D, 0X3AEF,
-  0X4350, 0X4330, 0X4330, 0X4351, 0X4B71, 0X4BB2, 0X53F3, 0X5434,
-  0X5454, 0X5CB6, 0X5D18, 0X5D58, 0X65B9, 0X6DDA, 0X6DDA, 0X6DFA,
-  0X75FA, 0X761A, 0X761B, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X7DFB, 0X75FB,
-  0X75DA, 0X75B9, 0X6D78, 0X6D58, 0X6D58, 0X6537, 0X5D17, 0X6537,
-  0X5C95, 0X5434, 0X5413, 0X53F3, 0X4BF3, 0X5414, 0X4C34, 0X4BD2,
-  0X4BF3, 0X4C13, 0X43F3, 0X43F3, 0X43B1, 0X4350, 0X3AEF, 0X328D,
-  0X322B, 0X29EA, 0X320A, 0X29C9, 0X2988, 0X2988, 0X2167, 0X2146,
-  0X2146, 0X2146, 0X1925, 0X1905, 0X2187, 0X21C7, 0X1966, 0X1945,
-  0X1965, 0X19A6, 0X10C3, 0X10A3, 0X10A2, 0X10A2, 0X18A2, 0X18C3,
-  0X2104, 0X3124, 0X49A6, 0X6289, 0X7BAD, 0X9C71, 0XC5B7, 0XEF5D,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE,
-  0XF79E, 0XEF5D, 0XDEFB, 0XD69A, 0XC618, 0XAD75, 0X9CD3, 0X8430,
-  0X6B6D, 0X5ACB, 0X4A49, 0X39C7, 0X2945, 0X2104, 0X10A2, 0X1082,
-  0X0841, 0X0841, 0X0020, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0020, 0X0841,
-  0X0841, 0X1082, 0X10A2, 0X2104, 0X2945, 0X39C7, 0X4A49, 0X5ACB,
-  0X6B6D, 0X8430, 0X9CD3, 0XAD75, 0XC618, 0XD69A, 0XDEFB, 0XEF5D,
-  0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XDEFC, 0XAD14, 0X734C, 0X4A49, 0X426A, 0X426B, 0X322A,
-  0X29C8, 0X2187, 0X1925, 0X1925, 0X1925, 0X10E4, 0X10A3, 0X10A3,
-  0X10A3, 0X18C4, 0X2105, 0X18E5, 0X18C4, 0X2105, 0X1905, 0X18E4,
-  0X2105, 0X1926, 0X18E5, 0X2107, 0X2127, 0X2106, 0X2127, 0X2968,
-  0X29EA, 0X2A2B, 0X2A0A, 0X2A0A, 0X320B, 0X324C, 0X3A8D, 0X3AAE,
-  0X4350, 0X4391, 0X4351, 0X4351, 0X4B92, 0X4BD3, 0X5455, 0X5496,
-  0X54B6, 0X5517, 0X5D38, 0X5D37, 0X6599, 0X6599, 0X6D78, 0X6DDA,
-  0X75FA, 0X75FA, 0X761B, 0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E7C, 0X7E3B, 0X75FA, 0X75FB,
-  0X75DA, 0X6D99, 0X6D58, 0X6517, 0X6538, 0X6537, 0X5D17, 0X5CD6,
-  0X5C95, 0X5434, 0X5413, 0X53F3, 0X4C13, 0X4C13, 0X4C13, 0X4BD2,
-  0X4BF3, 0X4C54, 0X43F3, 0X4350, 0X3B2F, 0X3B2F, 0X3AEE, 0X324C,
-  0X320B, 0X320B, 0X29EA, 0X2988, 0X2168, 0X2988, 0X2987, 0X2146,
-  0X2126, 0X2146, 0X1926, 0X1926, 0X21A7, 0X21E8, 0X1966, 0X1104,
-  0X10C3, 0X1945, 0X1104, 0X0862, 0X1082, 0X1082, 0X1082, 0X1882,
-  0X28E3, 0X3945, 0X49A6, 0X6AAA, 0X83CF, 0XACB3, 0XD67A, 0XF7DF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE,
-  0XEF7D, 0XE71C, 0XD6BA, 0XC638, 0XB5B6, 0XA514, 0X8C51, 0X73AE,
-  0X5AEB, 0X4A49, 0X39C7, 0X2945, 0X18E3, 0X10A2, 0X0861, 0X0841,
-  0X0020, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020,
-  0X0020, 0X0841, 0X0861, 0X10A2, 0X18E3, 0X2945, 0X39C7, 0X4A49,
-  0X5AEB, 0X73AE, 0X8C51, 0XA514, 0XB5B6, 0XC638, 0XD6BA, 0XE71C,
-  0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XE73D, 0XB577, 0X8C10, 0X5ACA, 0X4249, 0X4249, 0X3229,
-  0X29E9, 0X2187, 0X1966, 0X1905, 0X10E4, 0X1105, 0X10E4, 0X1083,
-  0X18C4, 0X18E4, 0X20E5, 0X1905, 0X2125, 0X2167, 0X2126, 0X2106,
-  0X2106, 0X2147, 0X1946, 0X2147, 0X2968, 0X2126, 0X2126, 0X2168,
-  0X29EA, 0X2A0A, 0X320A, 0X320B, 0X320B, 0X324C, 0X3A8D, 0X3A8E,
-  0X3B0F, 0X43B2, 0X4BF3, 0X4BF3, 0X4BF3, 0X4C35, 0X54D7, 0X54D7,
-  0X54F6, 0X5CF7, 0X5CD6, 0X5CD6, 0X6558, 0X6578, 0X6D58, 0X6DB9,
-  0X75FA, 0X75FA, 0X75FA, 0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5C, 0X7E3B, 0X75FA, 0X75FA,
-  0X75DA, 0X6D78, 0X6D58, 0X6517, 0X6517, 0X6558, 0X6518, 0X5CB6,
-  0X5C75, 0X5454, 0X5414, 0X5413, 0X4BF3, 0X5413, 0X4C13, 0X4C13,
-  0X4C34, 0X4C34, 0X43D2, 0X430F, 0X3AEF, 0X3ACE, 0X3A8D, 0X3A6C,
-  0X322B, 0X322B, 0X31EA, 0X2989, 0X2988, 0X29A8, 0X2988, 0X2988,
-  0X2988, 0X2167, 0X2147, 0X2167, 0X2186, 0X1986, 0X1924, 0X10C3,
-  0X0882, 0X10E4, 0X21A6, 0X10A2, 0X1061, 0X1062, 0X1082, 0X1883,
-  0X20A3, 0X3945, 0X5228, 0X732C, 0X8C0F, 0XAD15, 0XDEFC, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E,
-  0XEF5D, 0XDEFB, 0XCE79, 0XBDF7, 0XAD55, 0X9492, 0X7BEF, 0X632C,
-  0X528A, 0X39E7, 0X2965, 0X2104, 0X10A2, 0X0861, 0X0841, 0X0020,
-  0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0020, 0X0020, 0X0841, 0X0861, 0X10A2, 0X2104, 0X2965, 0X39E7,
-  0X528A, 0X632C, 0X7BEF, 0X9492, 0XAD55, 0XBDF7, 0XCE79, 0XDEFB,
-  0XEF5D, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XEF5D, 0XC5F8, 0X9492, 0X62EB, 0X4A49, 0X4AAA, 0X3A6A,
-  0X29C8, 0X29A7, 0X21A7, 0X1925, 0X10C3, 0X1904, 0X1905, 0X10C4,
-  0X18E5, 0X18E4, 0X18C4, 0X2105, 0X1925, 0X2105, 0X2126, 0X2106,
-  0X2105, 0X2105, 0X2146, 0X2167, 0X2968, 0X2968, 0X2147, 0X2147,
-  0X29CA, 0X320A, 0X2A0A, 0X322C, 0X324C, 0X326D, 0X3AAE, 0X3AEF,
-  0X4351, 0X43B2, 0X43F3, 0X4C75, 0X4C95, 0X4C95, 0X5495, 0X5495,
-  0X5495, 0X5C95, 0X5C95, 0X5CD7, 0X6578, 0X6558, 0X6558, 0X6DB9,
-  0X6DFA, 0X75DA, 0X75FA, 0X7E1B, 0X7E1B, 0X7E3B, 0X865C, 0X867C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5C, 0X7E3B, 0X75FA, 0X75FB,
-  0X75DA, 0X6D78, 0X6D58, 0X6538, 0X64F7, 0X6558, 0X6538, 0X5CD6,
-  0X5495, 0X5474, 0X5454, 0X5414, 0X5413, 0X5434, 0X4BF3, 0X4C14,
-  0X4C34, 0X4BF2, 0X4350, 0X3B0F, 0X3ACE, 0X3A8D, 0X3A8C, 0X324B,
-  0X320B, 0X31EA, 0X29A9, 0X2988, 0X2968, 0X2968, 0X2988, 0X29A8,
-  0X29A8, 0X29A8, 0X29A9, 0X2187, 0X1904, 0X10E4, 0X1904, 0X10C3,
-  0X0882, 0X10A2, 0X2165, 0X2144, 0X0841, 0X0862, 0X1082, 0X20A3,
-  0X28C3, 0X3966, 0X5A69, 0X7B4B, 0X8C2F, 0XB556, 0XEF3D, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D,
-  0XE71C, 0XD6BA, 0XC638, 0XB596, 0X9CF3, 0X8430, 0X6B6D, 0X52AA,
-  0X4208, 0X3186, 0X2104, 0X18C3, 0X0861, 0X0841, 0X0020, 0X0020,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0020, 0X0020, 0X0841, 0X0861, 0X18C3, 0X2104, 0X3186,
-  0X4208, 0X52AA, 0X6B6D, 0X8430, 0X9CF3, 0XB596, 0XC638, 0XD6BA,
-  0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XF79E, 0XD67A, 0XAD15, 0X734D, 0X52AA, 0X4AEC, 0X424A,
-  0X3209, 0X3229, 0X2A08, 0X2187, 0X1905, 0X18E5, 0X1926, 0X1906,
-  0X18E5, 0X18E4, 0X18C4, 0X2105, 0X1905, 0X18E4, 0X2146, 0X2167,
-  0X2105, 0X20E5, 0X2126, 0X2968, 0X29C9, 0X29A9, 0X2147, 0X2168,
-  0X29CA, 0X324C, 0X322B, 0X326D, 0X3A8E, 0X32AD, 0X3AEF, 0X4351,
-  0X4392, 0X4BB2, 0X43B2, 0X4BD2, 0X4C74, 0X4C55, 0X5414, 0X5434,
-  0X5434, 0X5C75, 0X5C95, 0X5CD7, 0X6558, 0X6599, 0X6599, 0X6DB9,
-  0X6DD9, 0X75DA, 0X75FA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X867C,
-  0X8EBD, 0X86BD, 0X869C, 0X867C, 0X7E5C, 0X7E3B, 0X75FB, 0X75FB,
-  0X75DA, 0X6D78, 0X6D38, 0X6538, 0X6517, 0X6538, 0X6517, 0X5CB6,
-  0X5475, 0X5454, 0X5454, 0X5434, 0X5434, 0X5434, 0X4C33, 0X4BF3,
-  0X4BF3, 0X4BF3, 0X4330, 0X3AEF, 0X3ACE, 0X3A8D, 0X3A4C, 0X322C,
-  0X324D, 0X3A6D, 0X324C, 0X320B, 0X31CA, 0X2988, 0X2988, 0X2988,
-  0X2988, 0X2167, 0X2167, 0X1967, 0X1125, 0X10E4, 0X10E3, 0X10C3,
-  0X10A2, 0X0882, 0X0841, 0X18E3, 0X10A2, 0X0821, 0X1882, 0X20C3,
-  0X28E3, 0X41A6, 0X6289, 0X736C, 0X8C71, 0XC5F8, 0XF79E, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XF79E, 0XEF5D,
-  0XDEFB, 0XCE79, 0XBDF7, 0XAD55, 0X9492, 0X7BCF, 0X630C, 0X4A49,
-  0X31A6, 0X2124, 0X18C3, 0X1082, 0X0841, 0X0020, 0X0020, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0020, 0X0020, 0X0841, 0X1082, 0X18C3, 0X2124,
-  0X31A6, 0X4A49, 0X630C, 0X7BCF, 0X9492, 0XAD55, 0XBDF7, 0XCE79,
-  0XDEFB, 0XEF5D, 0XF79E, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XDEBB, 0XBD77, 0X8C51, 0X634D, 0X52CC, 0X422A,
-  0X31E9, 0X29C9, 0X21C8, 0X2187, 0X1925, 0X18E4, 0X1905, 0X1905,
-  0X1104, 0X1925, 0X1904, 0X18C3, 0X20E4, 0X18E4, 0X2125, 0X21A8,
-  0X2146, 0X2105, 0X2106, 0X2126, 0X29A8, 0X29A8, 0X2168, 0X2189,
-  0X2A0B, 0X326D, 0X322B, 0X324C, 0X3A8D, 0X328D, 0X3AAE, 0X4371,
-  0X3B50, 0X4330, 0X4371, 0X4BB2, 0X4BF3, 0X4C13, 0X4C13, 0X5413,
-  0X5434, 0X5C75, 0X5C95, 0X5CB6, 0X6538, 0X65B9, 0X6DB9, 0X6DB9,
-  0X6DB9, 0X75DA, 0X75DA, 0X7DFA, 0X7E1B, 0X7E5B, 0X865B, 0X867C,
-  0X8EDD, 0X86BD, 0X869C, 0X867C, 0X7E5C, 0X7E1B, 0X75FA, 0X75FB,
-  0X75DA, 0X6D79, 0X6D38, 0X64F7, 0X64F7, 0X6538, 0X6517, 0X5CB6,
-  0X5475, 0X5434, 0X5434, 0X5454, 0X5434, 0X4C34, 0X4C13, 0X4BB2,
-  0X4BB2, 0X43B2, 0X4350, 0X42CE, 0X3ACE, 0X3AAE, 0X3AAE, 0X3ACF,
-  0X32AD, 0X326C, 0X328D, 0X326C, 0X324B, 0X322B, 0X29C9, 0X2988,
-  0X2167, 0X2125, 0X18C4, 0X18C4, 0X10C4, 0X10C3, 0X10A2, 0X0882,
-  0X1082, 0X0862, 0X0821, 0X1062, 0X1924, 0X1903, 0X1882, 0X20E4,
-  0X3124, 0X49C6, 0X6ACB, 0X83EF, 0X9CF3, 0XD69A, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XE73C,
-  0XDEDB, 0XCE59, 0XB5B6, 0X9CF3, 0X8430, 0X6B6D, 0X52AA, 0X39E7,
-  0X2965, 0X18E3, 0X10A2, 0X0841, 0X0020, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0020, 0X0020, 0X0841, 0X10A2, 0X18E3,
-  0X2965, 0X39E7, 0X52AA, 0X6B6D, 0X8430, 0X9CF3, 0XB5B6, 0XCE59,
-  0XDEDB, 0XE73C, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XDEDC, 0XB597, 0X94B2, 0X634D, 0X528B, 0X4A8B,
-  0X39E9, 0X31A9, 0X2988, 0X2146, 0X18E4, 0X10A3, 0X18E4, 0X1905,
-  0X1905, 0X1925, 0X1905, 0X18C3, 0X20E4, 0X1904, 0X18E4, 0X2167,
-  0X2126, 0X20E5, 0X2146, 0X2126, 0X2126, 0X2167, 0X2988, 0X29A9,
-  0X29EA, 0X324C, 0X2A0A, 0X2A0A, 0X322B, 0X326D, 0X3A8D, 0X3B30,
-  0X3B71, 0X3B30, 0X4391, 0X4BD3, 0X4BD2, 0X4BD2, 0X4BF3, 0X53F3,
-  0X5434, 0X5455, 0X5C95, 0X5CB6, 0X6537, 0X65B9, 0X6DD9, 0X6DB9,
-  0X6DBA, 0X75DA, 0X75DA, 0X7DFA, 0X7E3B, 0X7E3B, 0X865B, 0X867C,
-  0X8EBD, 0X8EBD, 0X869D, 0X867C, 0X7E5C, 0X7E3B, 0X761B, 0X761B,
-  0X6DDA, 0X6D79, 0X6538, 0X64F7, 0X6518, 0X6D79, 0X6538, 0X5CD7,
-  0X5CD6, 0X5475, 0X5454, 0X5454, 0X5434, 0X4BF3, 0X4BB2, 0X4BB2,
-  0X4B92, 0X4350, 0X4330, 0X3AEF, 0X3ACE, 0X3AEF, 0X3ACE, 0X326C,
-  0X31EA, 0X29A9, 0X2988, 0X29A9, 0X2968, 0X2946, 0X2926, 0X2105,
-  0X18E4, 0X20A4, 0X18A3, 0X18A3, 0X1082, 0X1082, 0X1062, 0X0841,
-  0X0841, 0X1061, 0X0882, 0X1082, 0X1925, 0X2186, 0X2145, 0X2985,
-  0X39C6, 0X51C7, 0X72AA, 0X8C10, 0XBDB7, 0XE73C, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C,
-  0XD69A, 0XC618, 0XAD75, 0X94B2, 0X7BEF, 0X630C, 0X4A49, 0X31A6,
-  0X2124, 0X18C3, 0X0861, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841, 0X0861, 0X18C3,
-  0X2124, 0X31A6, 0X4A49, 0X630C, 0X7BEF, 0X94B2, 0XAD75, 0XC618,
-  0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XE73D, 0XBDF8, 0X9CB3, 0X6B0B, 0X526A, 0X4A6A,
-  0X39E9, 0X3188, 0X2967, 0X2126, 0X18E4, 0X18A3, 0X1083, 0X10C3,
-  0X1904, 0X1966, 0X21A7, 0X2126, 0X2125, 0X2166, 0X1905, 0X1925,
-  0X2146, 0X18E5, 0X2126, 0X2947, 0X2947, 0X2947, 0X2948, 0X2948,
-  0X29C9, 0X326C, 0X2A0A, 0X29EA, 0X322C, 0X326D, 0X328D, 0X3AAE,
-  0X4351, 0X43B2, 0X43B2, 0X4B91, 0X4B91, 0X4BB2, 0X4BD3, 0X5414,
-  0X5434, 0X5C75, 0X5C95, 0X5CB6, 0X6538, 0X65D9, 0X6DB9, 0X6DB9,
-  0X6DDA, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865C, 0X867C,
-  0X8EBD, 0X86BD, 0X86BD, 0X867C, 0X7E5B, 0X7E3B, 0X7E1B, 0X761B,
-  0X6DDA, 0X6D99, 0X6538, 0X6538, 0X6D79, 0X6D58, 0X5CF7, 0X5C96,
-  0X54B6, 0X5CD6, 0X5475, 0X4C13, 0X4C13, 0X4BD3, 0X4BD2, 0X4BB2,
-  0X4371, 0X4330, 0X432F, 0X4350, 0X3AEF, 0X3AAD, 0X324C, 0X322B,
-  0X320B, 0X29C9, 0X29A9, 0X29A9, 0X2988, 0X2126, 0X28E5, 0X20E5,
-  0X18C4, 0X18A3, 0X1883, 0X1062, 0X1062, 0X1041, 0X1041, 0X1041,
-  0X0841, 0X0821, 0X0862, 0X10A2, 0X18E3, 0X2104, 0X2945, 0X3186,
-  0X39E7, 0X5248, 0X72CB, 0X9C51, 0XC618, 0XEF3D, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF79E, 0XEF5D, 0XDEFB,
-  0XCE79, 0XBDD7, 0XA534, 0X8C71, 0X738E, 0X5ACB, 0X4208, 0X2965,
-  0X18E3, 0X1082, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841, 0X1082,
-  0X18E3, 0X2965, 0X4208, 0X5ACB, 0X738E, 0X8C71, 0XA534, 0XBDD7,
-  0XCE79, 0XDEFB, 0XEF5D, 0XF79E, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XEF5E, 0XC5D8, 0X9CB3, 0X734C, 0X5289, 0X4A29,
-  0X39C8, 0X2946, 0X2125, 0X2146, 0X20E5, 0X18E4, 0X18C3, 0X10C3,
-  0X1904, 0X1925, 0X1966, 0X21A7, 0X2186, 0X2166, 0X2167, 0X2167,
-  0X2187, 0X1926, 0X2126, 0X2947, 0X2147, 0X2127, 0X2127, 0X2927,
-  0X2968, 0X322B, 0X2A4B, 0X2A0A, 0X326C, 0X326D, 0X328D, 0X3ACE,
-  0X4371, 0X4BF3, 0X4371, 0X4B71, 0X4BB2, 0X4BB2, 0X4BF3, 0X5414,
-  0X5434, 0X5C75, 0X5C75, 0X5CB6, 0X6578, 0X65D9, 0X6598, 0X6DD9,
-  0X6DBA, 0X7599, 0X75BA, 0X7DFA, 0X7E3B, 0X7E3B, 0X867C, 0X869C,
-  0X8EBD, 0X86BD, 0X86BD, 0X867C, 0X7E3B, 0X7E3B, 0X7E1B, 0X761B,
-  0X761B, 0X6DDA, 0X6DBA, 0X6D99, 0X6558, 0X64F7, 0X5CB6, 0X5C75,
-  0X5475, 0X5CB6, 0X54B5, 0X4C74, 0X5454, 0X4C13, 0X4BF3, 0X4392,
-  0X4391, 0X4350, 0X432F, 0X4350, 0X3AEE, 0X3A6C, 0X326C, 0X324C,
-  0X320B, 0X29C9, 0X2167, 0X2146, 0X2947, 0X2126, 0X20E5, 0X20C4,
-  0X20A3, 0X1883, 0X1862, 0X1042, 0X1041, 0X1041, 0X1041, 0X1041,
-  0X1062, 0X1062, 0X1082, 0X10A2, 0X18A2, 0X20E4, 0X2945, 0X3986,
-  0X41C7, 0X5248, 0X6B0B, 0XA492, 0XCE19, 0XEF5D, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XE73C, 0XDEDB,
-  0XCE59, 0XB5B6, 0X9CF3, 0X8430, 0X6B4D, 0X528A, 0X39C7, 0X2945,
-  0X18C3, 0X0861, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841, 0X0861,
-  0X18C3, 0X2945, 0X39C7, 0X528A, 0X6B4D, 0X8430, 0X9CF3, 0XB5B6,
-  0XCE59, 0XDEDB, 0XE73C, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XF79E, 0XC5F9, 0XACF5, 0X838D, 0X5A69, 0X4208,
-  0X39A7, 0X2945, 0X2104, 0X2125, 0X2125, 0X20E4, 0X20E4, 0X18E4,
-  0X1945, 0X1966, 0X18E4, 0X1966, 0X1946, 0X1925, 0X2146, 0X2166,
-  0X21A8, 0X21A8, 0X21A9, 0X2968, 0X2146, 0X2126, 0X2126, 0X2947,
-  0X2968, 0X29EA, 0X326C, 0X328C, 0X3ACE, 0X3AAE, 0X3B10, 0X3B51,
-  0X43B2, 0X43B2, 0X4370, 0X4351, 0X4B92, 0X4BB2, 0X4BD3, 0X53F3,
-  0X5434, 0X5C55, 0X5C75, 0X5CF7, 0X6599, 0X65D9, 0X65B9, 0X6DD9,
-  0X6DB9, 0X7599, 0X75DA, 0X7E3B, 0X7E5C, 0X7E5B, 0X865C, 0X867C,
-  0X8EBD, 0X869C, 0X86BD, 0X869C, 0X7E3B, 0X7E3B, 0X761B, 0X761B,
-  0X763B, 0X761B, 0X761B, 0X6DBA, 0X6538, 0X5CD6, 0X5CB6, 0X5455,
-  0X5434, 0X5474, 0X5495, 0X5475, 0X5474, 0X4C13, 0X4BB2, 0X4350,
-  0X4391, 0X43B2, 0X4350, 0X4350, 0X3ACE, 0X328D, 0X3AAE, 0X326C,
-  0X31EA, 0X29C9, 0X2967, 0X2126, 0X20E5, 0X20E5, 0X20E5, 0X20C4,
-  0X20A3, 0X1862, 0X1042, 0X1041, 0X1041, 0X1021, 0X1021, 0X1041,
-  0X1041, 0X1882, 0X18A3, 0X18C3, 0X18A3, 0X2104, 0X2986, 0X3186,
-  0X4A08, 0X62EA, 0X7B6D, 0XA4F4, 0XD67A, 0XF79E, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XE73C, 0XD6BA,
-  0XC638, 0XB596, 0X9CD3, 0X7BEF, 0X632C, 0X4A49, 0X31A6, 0X2124,
-  0X10A2, 0X0861, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0861,
-  0X10A2, 0X2124, 0X31A6, 0X4A49, 0X632C, 0X7BEF, 0X9CD3, 0XB596,
-  0XC638, 0XD6BA, 0XE73C, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFBF, 0XD67B, 0XB577, 0X9430, 0X62AA, 0X41E8,
-  0X3987, 0X2945, 0X2925, 0X2125, 0X2146, 0X2106, 0X2105, 0X18E4,
-  0X1905, 0X19A7, 0X1966, 0X2146, 0X2167, 0X1905, 0X1925, 0X1905,
-  0X1905, 0X2167, 0X29EA, 0X29EA, 0X29C9, 0X2988, 0X2147, 0X2147,
-  0X2988, 0X29CA, 0X328D, 0X3ACD, 0X3B0F, 0X3BB2, 0X43F3, 0X43B2,
-  0X4371, 0X4350, 0X4350, 0X4350, 0X4B71, 0X4BB2, 0X4BD2, 0X53F3,
-  0X5434, 0X5434, 0X5C95, 0X5D58, 0X6599, 0X65B9, 0X65B9, 0X6DB9,
-  0X6D99, 0X75B9, 0X75FA, 0X7E1B, 0X7E1B, 0X7E3B, 0X865B, 0X867C,
-  0X8EBD, 0X86BD, 0X869D, 0X869C, 0X7E5B, 0X7E3B, 0X761B, 0X75FA,
-  0X761B, 0X7E3C, 0X761B, 0X6D9A, 0X64F7, 0X5CD6, 0X5CB6, 0X5475,
-  0X5434, 0X5434, 0X5454, 0X5C75, 0X4C14, 0X4C13, 0X4BB2, 0X4371,
-  0X4371, 0X4370, 0X4330, 0X4350, 0X3AEE, 0X3A8D, 0X324C, 0X320A,
-  0X29C9, 0X29A9, 0X29A9, 0X2167, 0X2105, 0X18C4, 0X18A3, 0X18A3,
-  0X2083, 0X2063, 0X1842, 0X1041, 0X1021, 0X1021, 0X1021, 0X1041,
-  0X1041, 0X1040, 0X1862, 0X18A3, 0X20C3, 0X2125, 0X31A7, 0X39C7,
-  0X41C7, 0X5A89, 0X83AF, 0XB536, 0XD65A, 0XF79E, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD6BA,
-  0XC618, 0XAD75, 0X9492, 0X7BCF, 0X5AEB, 0X4228, 0X3186, 0X2104,
-  0X1082, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841,
-  0X1082, 0X2104, 0X3186, 0X4228, 0X5AEB, 0X7BCF, 0X9492, 0XAD75,
-  0XC618, 0XD6BA, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XE6FC, 0XC5D8, 0X9C72, 0X62AA, 0X4A08,
-  0X39A7, 0X2945, 0X2926, 0X2905, 0X20E5, 0X2105, 0X2126, 0X20E4,
-  0X18E4, 0X1987, 0X21A8, 0X1926, 0X1967, 0X1946, 0X1925, 0X1905,
-  0X1905, 0X1905, 0X2147, 0X2987, 0X29C9, 0X29C9, 0X29CA, 0X29EA,
-  0X29AA, 0X31EB, 0X32AD, 0X328D, 0X3ACE, 0X330F, 0X3BB1, 0X4391,
-  0X430F, 0X430F, 0X4330, 0X4351, 0X4371, 0X4B92, 0X4BD2, 0X5413,
-  0X5414, 0X5454, 0X5D17, 0X5D58, 0X6558, 0X6599, 0X6599, 0X6DB9,
-  0X6DDA, 0X75DA, 0X75DA, 0X75FA, 0X7E1A, 0X7E3B, 0X865B, 0X867C,
-  0X8EBD, 0X86BC, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X761B, 0X75DA,
-  0X6DDA, 0X761B, 0X6DDA, 0X6599, 0X64F7, 0X5CB6, 0X5CB6, 0X5C75,
-  0X5434, 0X5413, 0X4BF3, 0X5434, 0X4C13, 0X4BF3, 0X4BF3, 0X4BD2,
-  0X4371, 0X4330, 0X432F, 0X42EE, 0X3AAE, 0X3A4C, 0X320B, 0X320A,
-  0X29C9, 0X2988, 0X2168, 0X2167, 0X2126, 0X20E5, 0X18A4, 0X1883,
-  0X1882, 0X2062, 0X1842, 0X1041, 0X1041, 0X1020, 0X1020, 0X1041,
-  0X1862, 0X1041, 0X1061, 0X1883, 0X18A3, 0X20E4, 0X3186, 0X39C7,
-  0X49E7, 0X626A, 0X9410, 0XBD77, 0XD67A, 0XF79E, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD69A,
-  0XBDF7, 0XAD55, 0X8C71, 0X73AE, 0X5ACB, 0X4208, 0X2965, 0X18E3,
-  0X1082, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841,
-  0X1082, 0X18E3, 0X2965, 0X4208, 0X5ACB, 0X73AE, 0X8C71, 0XAD55,
-  0XBDF7, 0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XEF3D, 0XCDF8, 0X9431, 0X62AA, 0X4A28,
-  0X41A6, 0X3145, 0X2925, 0X20E4, 0X2105, 0X2926, 0X2105, 0X20C4,
-  0X18C4, 0X1926, 0X1946, 0X1905, 0X1946, 0X1987, 0X1904, 0X18E5,
-  0X1926, 0X2146, 0X2947, 0X2947, 0X2126, 0X2147, 0X29EA, 0X2A0B,
-  0X2A4C, 0X32AD, 0X326C, 0X328D, 0X3AAE, 0X326C, 0X3B2F, 0X4330,
-  0X42EF, 0X4310, 0X4330, 0X4371, 0X4371, 0X4BB2, 0X4BD2, 0X53F3,
-  0X5434, 0X54D6, 0X5D37, 0X5CF6, 0X6558, 0X6599, 0X6599, 0X6DDA,
-  0X6DBA, 0X75B9, 0X75B9, 0X7DFA, 0X7E1A, 0X7E3B, 0X865B, 0X867C,
-  0X8EBD, 0X86BC, 0X869C, 0X867C, 0X869D, 0X7E5C, 0X761B, 0X75DA,
-  0X6D99, 0X75FA, 0X6DB9, 0X6558, 0X6518, 0X5CB6, 0X5CB6, 0X5475,
-  0X5435, 0X5414, 0X4BD3, 0X4BD3, 0X4BF3, 0X4C13, 0X4C54, 0X4BB2,
-  0X4391, 0X4371, 0X432F, 0X42CE, 0X3A8D, 0X3A4C, 0X320B, 0X31CA,
-  0X29A9, 0X2147, 0X1905, 0X18E5, 0X20E5, 0X20E5, 0X20C4, 0X18A3,
-  0X1882, 0X1842, 0X1841, 0X1821, 0X1021, 0X1020, 0X1020, 0X1041,
-  0X1062, 0X1862, 0X1862, 0X1883, 0X20C4, 0X28E4, 0X3146, 0X39C7,
-  0X4A08, 0X6A8A, 0X9C50, 0XBDF8, 0XDEDC, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD69A,
-  0XBDF7, 0XA534, 0X8C71, 0X738E, 0X52AA, 0X39E7, 0X2945, 0X18C3,
-  0X0861, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841,
-  0X0861, 0X18C3, 0X2945, 0X39E7, 0X52AA, 0X738E, 0X8C71, 0XA534,
-  0XBDF7, 0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XEF5D, 0XCDD8, 0X9C50, 0X730C, 0X51E8,
-  0X3966, 0X3146, 0X2925, 0X28C4, 0X20E4, 0X2105, 0X20C4, 0X20A4,
-  0X1883, 0X18C4, 0X10E4, 0X10E4, 0X1926, 0X1967, 0X1946, 0X1906,
-  0X1946, 0X2187, 0X2167, 0X2126, 0X2126, 0X2147, 0X2167, 0X2188,
-  0X2A0A, 0X32CE, 0X32AD, 0X32AE, 0X32AE, 0X3AAE, 0X430F, 0X430F,
-  0X3B0F, 0X4310, 0X4330, 0X4371, 0X4B91, 0X4BB2, 0X4BD3, 0X5413,
-  0X5475, 0X54D6, 0X5CB5, 0X5CD6, 0X6517, 0X6558, 0X6599, 0X6D99,
-  0X6D79, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X865B, 0X867C,
-  0X8EBD, 0X86BC, 0X869C, 0X7E5C, 0X7E7C, 0X7E7C, 0X761B, 0X75DA,
-  0X6D99, 0X75DA, 0X6DDA, 0X6538, 0X5CF7, 0X5CD7, 0X5CD7, 0X5C95,
-  0X5435, 0X5414, 0X4BD3, 0X4BD3, 0X4C13, 0X5474, 0X4C34, 0X43D3,
-  0X43F3, 0X43B1, 0X430F, 0X3ACD, 0X3A8C, 0X3A4C, 0X322B, 0X320B,
-  0X31EA, 0X2147, 0X18E5, 0X18C4, 0X1883, 0X1883, 0X1883, 0X1862,
-  0X1862, 0X1842, 0X1841, 0X1841, 0X1821, 0X1020, 0X1020, 0X1021,
-  0X1041, 0X1862, 0X1882, 0X1882, 0X20A3, 0X28E4, 0X3146, 0X39A7,
-  0X5208, 0X6A8A, 0X9451, 0XD659, 0XEF1C, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD69A,
-  0XBDF7, 0XA534, 0X8C51, 0X6B6D, 0X52AA, 0X39E7, 0X2945, 0X18C3,
-  0X0861, 0X0841, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0841,
-  0X0861, 0X18C3, 0X2945, 0X39E7, 0X52AA, 0X6B6D, 0X8C51, 0XA534,
-  0XBDF7, 0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XF77E, 0XD639, 0X9431, 0X72CB, 0X5208,
-  0X39A7, 0X3166, 0X2905, 0X20C4, 0X20A3, 0X20C3, 0X20A3, 0X1883,
-  0X1862, 0X1883, 0X10C4, 0X10A3, 0X10C4, 0X1967, 0X21E9, 0X1988,
-  0X1967, 0X2167, 0X2188, 0X2188, 0X2147, 0X2147, 0X2147, 0X2968,
-  0X29A9, 0X328D, 0X32EE, 0X328C, 0X328D, 0X3ACE, 0X430F, 0X3ACE,
-  0X3AEE, 0X430F, 0X4330, 0X4351, 0X4B92, 0X4BB2, 0X4BD2, 0X5434,
-  0X5495, 0X5475, 0X5C75, 0X5CD6, 0X6517, 0X6517, 0X6578, 0X6D79,
-  0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E3B, 0X865B, 0X869C,
-  0X8EBD, 0X86BC, 0X869C, 0X7E5B, 0X7E5C, 0X7E5C, 0X761B, 0X75DA,
-  0X6D99, 0X6D9A, 0X75FA, 0X6558, 0X5CD6, 0X5CD7, 0X64F8, 0X5CD7,
-  0X5455, 0X5434, 0X53D3, 0X4BD3, 0X4C14, 0X4C33, 0X4C34, 0X4C14,
-  0X43D2, 0X43B2, 0X430F, 0X42AD, 0X3A8D, 0X3A6C, 0X320A, 0X31EA,
-  0X31C9, 0X2188, 0X2106, 0X18A4, 0X1083, 0X1083, 0X1062, 0X1842,
-  0X1842, 0X1041, 0X1821, 0X1861, 0X1841, 0X1001, 0X1801, 0X1842,
-  0X1862, 0X1862, 0X1883, 0X2083, 0X20A3, 0X28E4, 0X3145, 0X3987,
-  0X51E8, 0X732C, 0X9C92, 0XCDF9, 0XE6FC, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD69A,
-  0XBDF7, 0XA534, 0X8C51, 0X6B6D, 0X52AA, 0X39E7, 0X2945, 0X18C3,
-  0X0861, 0X0841, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0841,
-  0X0861, 0X18C3, 0X2945, 0X39E7, 0X52AA, 0X6B6D, 0X8C51, 0XA534,
-  0XBDF7, 0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XEF7E, 0XC638, 0X8BEF, 0X6269, 0X4A29,
-  0X41E8, 0X3966, 0X2925, 0X2905, 0X20C4, 0X20C4, 0X20C3, 0X1882,
-  0X1061, 0X18C4, 0X1906, 0X0862, 0X1083, 0X1947, 0X2209, 0X21E9,
-  0X21A9, 0X2168, 0X2188, 0X21C8, 0X2167, 0X2126, 0X2147, 0X2988,
-  0X29C9, 0X32AD, 0X3AEE, 0X322B, 0X324B, 0X3ACE, 0X3AEE, 0X3AAD,
-  0X3ACE, 0X42EF, 0X4330, 0X4371, 0X4BB2, 0X4BB2, 0X4BF3, 0X5475,
-  0X5454, 0X5434, 0X5C75, 0X5CD6, 0X6517, 0X6517, 0X6538, 0X6D78,
-  0X6D79, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E3B, 0X865C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X7E5B, 0X7E3B, 0X7E5C, 0X761A, 0X75DA,
-  0X6D99, 0X6D99, 0X6DDA, 0X6579, 0X5CD6, 0X5CD6, 0X5CF7, 0X5CD7,
-  0X5C95, 0X5414, 0X53F3, 0X53F3, 0X4BD3, 0X4BD3, 0X4BD3, 0X4BD2,
-  0X4392, 0X4392, 0X4351, 0X42CF, 0X3ACE, 0X3AAC, 0X320A, 0X2988,
-  0X2947, 0X2126, 0X18E5, 0X10A4, 0X1083, 0X1083, 0X1062, 0X1042,
-  0X1842, 0X1041, 0X1821, 0X1821, 0X1821, 0X1821, 0X1041, 0X1042,
-  0X1862, 0X1883, 0X18C4, 0X18A3, 0X20C3, 0X2904, 0X3145, 0X4186,
-  0X4A28, 0X6AEB, 0X9C91, 0XC5F8, 0XE6DC, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD69A,
-  0XBDF7, 0XA534, 0X8C71, 0X738E, 0X52AA, 0X39E7, 0X2945, 0X18C3,
-  0X0861, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841,
-  0X0861, 0X18C3, 0X2945, 0X39E7, 0X52AA, 0X738E, 0X8C71, 0XA534,
-  0XBDF7, 0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XE73D, 0XBDB7, 0X9410, 0X628A, 0X4A08,
-  0X39E8, 0X3166, 0X2904, 0X2105, 0X20E4, 0X18A3, 0X18A3, 0X20C4,
-  0X1882, 0X18C3, 0X1968, 0X10C5, 0X1083, 0X1925, 0X1967, 0X1988,
-  0X21EA, 0X21E9, 0X21A8, 0X2188, 0X2167, 0X2147, 0X2147, 0X29A9,
-  0X29EA, 0X322B, 0X3ACE, 0X328D, 0X326C, 0X3AEE, 0X3ACE, 0X3A8D,
-  0X3ACE, 0X42EF, 0X430F, 0X4371, 0X4BB2, 0X4BD3, 0X5434, 0X5454,
-  0X5414, 0X5434, 0X5C75, 0X5CD6, 0X64F7, 0X6517, 0X6537, 0X6D58,
-  0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E3B, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X7E5B, 0X7E3B, 0X7E3C, 0X761B, 0X75DA,
-  0X6DBA, 0X6D79, 0X6DBA, 0X6D99, 0X5CF7, 0X5CB6, 0X64F7, 0X5CD6,
-  0X5C96, 0X53F4, 0X53D3, 0X4BD2, 0X4BD3, 0X4BB3, 0X4B72, 0X4351,
-  0X4351, 0X4393, 0X43B3, 0X4391, 0X3B0E, 0X3A4C, 0X31E9, 0X2968,
-  0X2947, 0X2106, 0X20C5, 0X18A4, 0X1083, 0X1063, 0X1062, 0X1042,
-  0X1042, 0X1042, 0X1021, 0X1001, 0X1000, 0X1821, 0X1862, 0X1042,
-  0X18A3, 0X18C4, 0X18A3, 0X18A3, 0X20C4, 0X2904, 0X2945, 0X41C7,
-  0X4A28, 0X6AAB, 0XA493, 0XCDF8, 0XDEBB, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD69A,
-  0XBDF7, 0XAD55, 0X8C71, 0X73AE, 0X5ACB, 0X4208, 0X2965, 0X18E3,
-  0X1082, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841,
-  0X1082, 0X18E3, 0X2965, 0X4208, 0X5ACB, 0X73AE, 0X8C71, 0XAD55,
-  0XBDF7, 0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XEF1D, 0XBD77, 0X83AF, 0X5A6A, 0X4A08,
-  0X4229, 0X31C8, 0X2946, 0X2105, 0X20E4, 0X20A3, 0X18A3, 0X18A3,
-  0X1883, 0X18A2, 0X1946, 0X2167, 0X10A3, 0X1905, 0X1967, 0X21A9,
-  0X21CA, 0X21E9, 0X2188, 0X2167, 0X2167, 0X2188, 0X2168, 0X29A9,
-  0X29C9, 0X29C9, 0X328C, 0X3AEE, 0X3A8D, 0X42EE, 0X3AEE, 0X3A8D,
-  0X42CF, 0X42EF, 0X4330, 0X4371, 0X4BB2, 0X5434, 0X5414, 0X53F3,
-  0X5414, 0X5454, 0X5C95, 0X5CF7, 0X5D17, 0X6517, 0X6517, 0X6D58,
-  0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7E3B, 0X869C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X7E5C, 0X7E3B, 0X7E3B, 0X761B, 0X75DA,
-  0X6DBA, 0X6D99, 0X6D9A, 0X6DBA, 0X6538, 0X5CB6, 0X6518, 0X5CB6,
-  0X5475, 0X5455, 0X4BD3, 0X4BB2, 0X4BB2, 0X4BB3, 0X4372, 0X4331,
-  0X4310, 0X4330, 0X43D3, 0X4391, 0X3ACE, 0X320B, 0X31C9, 0X2968,
-  0X2967, 0X2927, 0X20C5, 0X2084, 0X1883, 0X1862, 0X1062, 0X1042,
-  0X1842, 0X1042, 0X1041, 0X1820, 0X1020, 0X1021, 0X1842, 0X1042,
-  0X1883, 0X18A3, 0X10A4, 0X18C4, 0X18C4, 0X20E4, 0X2925, 0X3987,
-  0X4A08, 0X6AEB, 0X9C92, 0XBD98, 0XD65A, 0XF79E, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C, 0XD6BA,
-  0XC618, 0XAD75, 0X9492, 0X7BCF, 0X5AEB, 0X4228, 0X3186, 0X2104,
-  0X1082, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841,
-  0X1082, 0X2104, 0X3186, 0X4228, 0X5AEB, 0X7BCF, 0X9492, 0XAD75,
-  0XC618, 0XD6BA, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XE71C, 0XAD15, 0X83AE, 0X630B, 0X4A29,
-  0X39E8, 0X31C8, 0X2966, 0X2945, 0X2947, 0X2105, 0X20C3, 0X1883,
-  0X18C4, 0X10A3, 0X18E4, 0X1926, 0X10C4, 0X1905, 0X2187, 0X21C8,
-  0X21A8, 0X21A8, 0X2188, 0X2167, 0X2167, 0X2988, 0X2988, 0X2988,
-  0X29A9, 0X29CA, 0X326B, 0X3ACE, 0X32AD, 0X3ACE, 0X430F, 0X3AAE,
-  0X42EF, 0X430F, 0X4350, 0X4392, 0X4C13, 0X4C34, 0X4BF3, 0X53F3,
-  0X5414, 0X5454, 0X5C96, 0X5D17, 0X5D17, 0X64F7, 0X6537, 0X6D58,
-  0X6D78, 0X7599, 0X75B9, 0X7DDA, 0X7E1A, 0X7E7C, 0X869C, 0X867C,
-  0X8EBD, 0X869C, 0X869C, 0X7E7C, 0X7E3B, 0X7E1B, 0X761B, 0X75FA,
-  0X6DDA, 0X6D99, 0X6D79, 0X6D99, 0X6578, 0X5CF7, 0X6518, 0X5CB6,
-  0X5454, 0X5475, 0X4C13, 0X4BB3, 0X4BD3, 0X4BF4, 0X4392, 0X4311,
-  0X4310, 0X4310, 0X4351, 0X3B10, 0X3A8D, 0X322C, 0X31CA, 0X2988,
-  0X2967, 0X2948, 0X2148, 0X20C5, 0X1883, 0X1862, 0X1862, 0X1042,
-  0X1842, 0X1062, 0X1041, 0X1841, 0X1842, 0X1862, 0X1883, 0X18A3,
-  0X18A3, 0X1082, 0X1083, 0X18C3, 0X18A3, 0X18C4, 0X2925, 0X3987,
-  0X4A08, 0X62AA, 0X9410, 0XB536, 0XBDB9, 0XEF5E, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XE73C, 0XD6BA,
-  0XC638, 0XB596, 0X9CD3, 0X7BEF, 0X632C, 0X4A49, 0X31A6, 0X2124,
-  0X10A2, 0X0861, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0861,
-  0X10A2, 0X2124, 0X31A6, 0X4A49, 0X632C, 0X7BEF, 0X9CD3, 0XB596,
-  0XC638, 0XD6BA, 0XE73C, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XE6FC, 0XA4D3, 0X736C, 0X5AAA, 0X4A09,
-  0X39A7, 0X3186, 0X2966, 0X2145, 0X2187, 0X1947, 0X2105, 0X18E4,
-  0X1946, 0X1905, 0X10A3, 0X1905, 0X1906, 0X2105, 0X2146, 0X2168,
-  0X21A8, 0X21E9, 0X21A8, 0X2147, 0X2146, 0X2988, 0X29C9, 0X29A8,
-  0X29C9, 0X31EA, 0X322B, 0X3AEE, 0X3AEE, 0X3AAD, 0X430F, 0X3AEE,
-  0X430F, 0X4350, 0X4391, 0X4BF3, 0X4BF3, 0X4BD2, 0X53F3, 0X53F3,
-  0X5414, 0X5C54, 0X5CB6, 0X5D38, 0X64F7, 0X64F7, 0X6558, 0X6D58,
-  0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7E5B, 0X7E7C, 0X865B, 0X867C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X7E1B, 0X763B, 0X75FB,
-  0X6DBA, 0X6D79, 0X6D59, 0X6579, 0X6558, 0X5D38, 0X6538, 0X5CD7,
-  0X5455, 0X5475, 0X5434, 0X4BB3, 0X4BF3, 0X4BF3, 0X4392, 0X4351,
-  0X4310, 0X4310, 0X42CF, 0X42EF, 0X3AEF, 0X3A8D, 0X322B, 0X29C9,
-  0X29A9, 0X29A9, 0X2948, 0X2106, 0X1883, 0X1863, 0X1862, 0X1042,
-  0X1042, 0X1042, 0X1042, 0X1862, 0X1862, 0X1883, 0X18A3, 0X18A3,
-  0X18C3, 0X10A2, 0X1061, 0X1082, 0X18A3, 0X18C3, 0X2125, 0X39A8,
-  0X4A29, 0X5A89, 0X7BAE, 0XA4D5, 0XBD78, 0XE71D, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XE73C, 0XDEDB,
-  0XCE59, 0XB5B6, 0X9CF3, 0X8430, 0X6B4D, 0X528A, 0X39C7, 0X2945,
-  0X18C3, 0X0861, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841, 0X0861,
-  0X18C3, 0X2945, 0X39C7, 0X528A, 0X6B4D, 0X8430, 0X9CF3, 0XB5B6,
-  0XCE59, 0XDEDB, 0XE73C, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XDEBB, 0XA471, 0X732C, 0X5A8A, 0X41C7,
-  0X3166, 0X3105, 0X2966, 0X21C7, 0X21A6, 0X1905, 0X18A4, 0X2126,
-  0X2188, 0X1926, 0X10C4, 0X1905, 0X2147, 0X2126, 0X1926, 0X2168,
-  0X2188, 0X21A8, 0X21A8, 0X2167, 0X2147, 0X2168, 0X29C9, 0X31E9,
-  0X29E9, 0X320B, 0X324C, 0X3B0F, 0X432F, 0X328D, 0X430F, 0X4330,
-  0X432F, 0X4B71, 0X4BB2, 0X4BF3, 0X4BB1, 0X4BB2, 0X53D3, 0X53F3,
-  0X5434, 0X5C54, 0X5CD6, 0X5D17, 0X64D6, 0X64F7, 0X6D38, 0X6D58,
-  0X6D78, 0X7599, 0X75B9, 0X7E1A, 0X7E5C, 0X7E3B, 0X865B, 0X867C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X7E1B, 0X7E1B, 0X75FB,
-  0X75BA, 0X6D79, 0X6559, 0X6D99, 0X6578, 0X5D39, 0X6558, 0X5CD7,
-  0X5476, 0X5455, 0X5414, 0X53F3, 0X4B92, 0X4B51, 0X4351, 0X4351,
-  0X4310, 0X42CF, 0X3ACF, 0X42CF, 0X3AAE, 0X3AAE, 0X328D, 0X324C,
-  0X2A0B, 0X29EA, 0X2126, 0X20E5, 0X20E5, 0X20A4, 0X1883, 0X1883,
-  0X1883, 0X1883, 0X1062, 0X1062, 0X1862, 0X1061, 0X1041, 0X1062,
-  0X1083, 0X1082, 0X1082, 0X1082, 0X10A3, 0X18C4, 0X2126, 0X31A8,
-  0X4A4A, 0X528A, 0X736C, 0XA4F4, 0XBDB8, 0XE6FC, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF79E, 0XEF5D, 0XDEFB,
-  0XCE79, 0XBDD7, 0XA534, 0X8C71, 0X738E, 0X5ACB, 0X4208, 0X2965,
-  0X18E3, 0X1082, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841, 0X1082,
-  0X18E3, 0X2965, 0X4208, 0X5ACB, 0X738E, 0X8C71, 0XA534, 0XBDD7,
-  0XCE79, 0XDEFB, 0XEF5D, 0XF79E, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XD67A, 0X9410, 0X7ACB, 0X5A49, 0X41E7,
-  0X3145, 0X28E4, 0X2186, 0X2A4A, 0X19A8, 0X1967, 0X2126, 0X1925,
-  0X1946, 0X1925, 0X10C3, 0X1904, 0X2126, 0X2126, 0X2126, 0X2167,
-  0X2167, 0X1946, 0X2187, 0X2188, 0X2167, 0X2188, 0X29C9, 0X320A,
-  0X320A, 0X3A8C, 0X3AAE, 0X3AEE, 0X3B2F, 0X3ACD, 0X42EE, 0X4371,
-  0X4350, 0X4B91, 0X4BD2, 0X4B91, 0X4B91, 0X4BB2, 0X53F3, 0X5413,
-  0X5434, 0X5C55, 0X5CF7, 0X5CF7, 0X64D6, 0X64F7, 0X6D38, 0X6D58,
-  0X6D78, 0X7599, 0X75DA, 0X7E3B, 0X7E5C, 0X7E5B, 0X865C, 0X867C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X7E1B, 0X7DFB, 0X75FB,
-  0X75DA, 0X6D99, 0X6559, 0X6D79, 0X6599, 0X6DBA, 0X6579, 0X5C96,
-  0X5456, 0X5414, 0X53F4, 0X53F4, 0X4B71, 0X4B30, 0X4330, 0X42EF,
-  0X42EF, 0X3ACF, 0X3ACF, 0X42D0, 0X3A6D, 0X322C, 0X322B, 0X320B,
-  0X29EA, 0X31CA, 0X2988, 0X2126, 0X2126, 0X20E5, 0X18A4, 0X1883,
-  0X18A3, 0X20C4, 0X18C4, 0X1083, 0X1063, 0X1083, 0X10A3, 0X10A3,
-  0X10A3, 0X0862, 0X1062, 0X1082, 0X10A3, 0X18E5, 0X2126, 0X31E8,
-  0X4A8B, 0X526A, 0X6B4D, 0X9CF4, 0XB598, 0XDEBC, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE71C,
-  0XD69A, 0XC618, 0XAD75, 0X94B2, 0X7BEF, 0X630C, 0X4A49, 0X31A6,
-  0X2124, 0X18C3, 0X0861, 0X0841, 0X0020, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0841, 0X0861, 0X18C3,
-  0X2124, 0X31A6, 0X4A49, 0X630C, 0X7BEF, 0X94B2, 0XAD75, 0XC618,
-  0XD69A, 0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XF7BE, 0XBDB7, 0X8430, 0X7B0C, 0X59E8, 0X4186,
-  0X3146, 0X2125, 0X2145, 0X2167, 0X1926, 0X2146, 0X2146, 0X18E3,
-  0X1104, 0X1105, 0X10C3, 0X10E4, 0X1925, 0X2126, 0X2146, 0X2147,
-  0X2146, 0X1946, 0X2188, 0X21A8, 0X2188, 0X29A9, 0X29E9, 0X322A,
-  0X324B, 0X326C, 0X3A8C, 0X328C, 0X3B0E, 0X3B0F, 0X42EF, 0X4391,
-  0X4350, 0X4BF2, 0X4BD2, 0X4371, 0X4BB1, 0X4BD2, 0X53F3, 0X5413,
-  0X5434, 0X5C75, 0X5CF7, 0X5CD6, 0X64D6, 0X6517, 0X6D38, 0X6D58,
-  0X6D78, 0X7599, 0X75FA, 0X7E5C, 0X7E5C, 0X7E5B, 0X867C, 0X867C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5C, 0X7E1B, 0X75FA, 0X75FB,
-  0X75DA, 0X6D9A, 0X6D79, 0X6559, 0X65BA, 0X6E1B, 0X65BA, 0X54B6,
-  0X5455, 0X5415, 0X5414, 0X53F3, 0X4B92, 0X4330, 0X4310, 0X42AE,
-  0X42AE, 0X3AAE, 0X3AAF, 0X42F0, 0X3AEF, 0X326D, 0X320B, 0X31A9,
-  0X2988, 0X2989, 0X2968, 0X2147, 0X2167, 0X2146, 0X18C4, 0X18C4,
-  0X18E4, 0X1883, 0X1884, 0X18C4, 0X18E5, 0X18A4, 0X1083, 0X1082,
-  0X10A3, 0X10A3, 0X0882, 0X1082, 0X10C3, 0X18E4, 0X2126, 0X29A8,
-  0X424A, 0X52CB, 0X6BAE, 0X9CD3, 0XBD97, 0XD69B, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XE73C,
-  0XDEDB, 0XCE59, 0XB5B6, 0X9CF3, 0X8430, 0X6B6D, 0X52AA, 0X39E7,
-  0X2965, 0X18E3, 0X10A2, 0X0841, 0X0020, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0020, 0X0020, 0X0841, 0X10A2, 0X18E3,
-  0X2965, 0X39E7, 0X52AA, 0X6B6D, 0X8430, 0X9CF3, 0XB5B6, 0XCE59,
-  0XDEDB, 0XE73C, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XE71C, 0X9CF3, 0X7BAE, 0X6AEB, 0X49E7, 0X3165,
-  0X2946, 0X2946, 0X2146, 0X2105, 0X1905, 0X2146, 0X1925, 0X10E4,
-  0X10E4, 0X1104, 0X10E4, 0X10C3, 0X1905, 0X1946, 0X2187, 0X2187,
-  0X1967, 0X2188, 0X21E9, 0X29E9, 0X29C9, 0X29C9, 0X31C9, 0X322B,
-  0X3A8D, 0X326C, 0X328C, 0X3A6C, 0X42CE, 0X4391, 0X43D2, 0X4370,
-  0X4B91, 0X4C13, 0X4BB2, 0X4B91, 0X4BB2, 0X53D3, 0X53F3, 0X5413,
-  0X5434, 0X5C95, 0X5CF7, 0X5CB6, 0X64D6, 0X6517, 0X6D38, 0X6D58,
-  0X6D78, 0X75DA, 0X761B, 0X7E1B, 0X7E3B, 0X7E5B, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5C, 0X7E1B, 0X75FA, 0X75FB,
-  0X75DB, 0X6D9A, 0X6D79, 0X6538, 0X6599, 0X761B, 0X6DFB, 0X5D38,
-  0X5475, 0X4C15, 0X5435, 0X4BD3, 0X4B92, 0X4B51, 0X4310, 0X42AE,
-  0X428D, 0X3A8E, 0X3A6D, 0X3AAF, 0X4311, 0X3AF0, 0X3A6D, 0X31EA,
-  0X2989, 0X2969, 0X2147, 0X2126, 0X2126, 0X2127, 0X2126, 0X1905,
-  0X2126, 0X1905, 0X1083, 0X1883, 0X18A4, 0X18C4, 0X10E4, 0X10A4,
-  0X1083, 0X10A3, 0X10A3, 0X10A4, 0X10E4, 0X1125, 0X1946, 0X2967,
-  0X3A09, 0X4ACB, 0X62EB, 0X8C31, 0XBD97, 0XD67A, 0XF7BE, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XF79E, 0XEF5D,
-  0XDEFB, 0XCE79, 0XBDF7, 0XAD55, 0X9492, 0X7BCF, 0X630C, 0X4A49,
-  0X31A6, 0X2124, 0X18C3, 0X1082, 0X0841, 0X0020, 0X0020, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0020, 0X0020, 0X0841, 0X1082, 0X18C3, 0X2124,
-  0X31A6, 0X4A49, 0X630C, 0X7BCF, 0X9492, 0XAD55, 0XBDF7, 0XCE79,
-  0XDEFB, 0XEF5D, 0XF79E, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XDEBB, 0X9492, 0X7B6D, 0X62EC, 0X41E8, 0X39A8,
-  0X31C8, 0X2987, 0X29C8, 0X2145, 0X1905, 0X21A7, 0X1987, 0X1104,
-  0X1104, 0X10E3, 0X10C3, 0X10C4, 0X1105, 0X1966, 0X2187, 0X21A8,
-  0X2188, 0X21A9, 0X21E9, 0X2A0A, 0X29E9, 0X31E9, 0X31E9, 0X322A,
-  0X3AAD, 0X32AC, 0X3A8C, 0X3A6D, 0X3AAD, 0X43B1, 0X4433, 0X43B1,
-  0X4C13, 0X4BB2, 0X4B91, 0X4BB2, 0X4BB2, 0X53F3, 0X5413, 0X5434,
-  0X5454, 0X5CB6, 0X5CF7, 0X5CB6, 0X64D6, 0X6517, 0X6D38, 0X6D58,
-  0X6DB9, 0X761A, 0X761A, 0X7DFA, 0X7E1B, 0X7E5B, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5C, 0X7E1B, 0X75FB, 0X75FA,
-  0X75FB, 0X6DBA, 0X6D99, 0X6579, 0X6DBA, 0X6DBA, 0X6D9A, 0X5D18,
-  0X5497, 0X4C35, 0X5455, 0X53F3, 0X4B92, 0X4B72, 0X4330, 0X42CF,
-  0X428E, 0X3A8E, 0X3A4C, 0X3A4D, 0X42AF, 0X3ACF, 0X3AAF, 0X3AAE,
-  0X324D, 0X29CA, 0X2189, 0X2147, 0X2106, 0X20E6, 0X2127, 0X2106,
-  0X18C5, 0X18E5, 0X18C4, 0X10A4, 0X1084, 0X10C4, 0X10C4, 0X10C4,
-  0X10C5, 0X10A4, 0X10C4, 0X10E4, 0X10E4, 0X1925, 0X1945, 0X2166,
-  0X3A29, 0X4AAA, 0X4A69, 0X6B4D, 0XA514, 0XC639, 0XEF5D, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XEF7D,
-  0XE71C, 0XD6BA, 0XC638, 0XB596, 0X9CF3, 0X8430, 0X6B6D, 0X52AA,
-  0X4208, 0X3186, 0X2104, 0X18C3, 0X0861, 0X0841, 0X0020, 0X0020,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0020, 0X0020, 0X0841, 0X0861, 0X18C3, 0X2104, 0X3186,
-  0X4208, 0X52AA, 0X6B6D, 0X8430, 0X9CF3, 0XB596, 0XC638, 0XD6BA,
-  0XE71C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XD65A, 0X9C92, 0X7BCF, 0X5B0E, 0X422B, 0X31E9,
-  0X29C8, 0X2166, 0X2186, 0X21A7, 0X1926, 0X2166, 0X1966, 0X1104,
-  0X10E4, 0X10E3, 0X08A3, 0X10A3, 0X1905, 0X1967, 0X1987, 0X21C9,
-  0X21A8, 0X29E9, 0X2A2B, 0X2A2A, 0X2A0A, 0X322A, 0X320A, 0X324B,
-  0X3AAD, 0X328D, 0X32AD, 0X32CD, 0X32AD, 0X4370, 0X4C33, 0X4C34,
-  0X43D2, 0X4B71, 0X4B91, 0X4BB1, 0X4BB2, 0X53F3, 0X5413, 0X5434,
-  0X5C75, 0X5D17, 0X5CD7, 0X5CB6, 0X64D6, 0X6537, 0X6D38, 0X6D79,
-  0X75FA, 0X75FA, 0X75DA, 0X7DFA, 0X7E1B, 0X867C, 0X869C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5B, 0X7E3B, 0X761B, 0X75FA,
-  0X75FA, 0X6DFB, 0X6DBA, 0X6DDA, 0X6DBA, 0X6579, 0X6558, 0X5CD7,
-  0X5CB6, 0X5496, 0X5456, 0X4BF4, 0X4B72, 0X4B72, 0X4B51, 0X42EF,
-  0X42AE, 0X42AE, 0X3A4C, 0X322C, 0X3A4C, 0X3A6D, 0X3A8E, 0X3AAE,
-  0X3ACF, 0X32AE, 0X322B, 0X2168, 0X20E6, 0X18C5, 0X18C5, 0X18C5,
-  0X18A4, 0X10A4, 0X10C4, 0X10A3, 0X1083, 0X1083, 0X10A4, 0X10E5,
-  0X10E5, 0X10E4, 0X10C3, 0X1082, 0X10C3, 0X10C3, 0X10E4, 0X1925,
-  0X29C7, 0X4229, 0X4228, 0X630C, 0X9492, 0XBDD8, 0XE73D, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E,
-  0XEF5D, 0XDEFB, 0XCE79, 0XBDF7, 0XAD55, 0X9492, 0X7BEF, 0X632C,
-  0X528A, 0X39E7, 0X2965, 0X2104, 0X10A2, 0X0861, 0X0841, 0X0020,
-  0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0020, 0X0020, 0X0841, 0X0861, 0X10A2, 0X2104, 0X2965, 0X39E7,
-  0X528A, 0X632C, 0X7BEF, 0X9492, 0XAD55, 0XBDF7, 0XCE79, 0XDEFB,
-  0XEF5D, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XF7BF, 0XC5B8, 0X8C30, 0X73AF, 0X5AEE, 0X424B, 0X39E8,
-  0X31E9, 0X2146, 0X1925, 0X21A8, 0X2167, 0X2145, 0X2166, 0X1925,
-  0X1904, 0X10E4, 0X10E3, 0X10C3, 0X10E4, 0X1925, 0X1946, 0X21E9,
-  0X21C8, 0X21E9, 0X32CD, 0X324B, 0X31E9, 0X326B, 0X3A6C, 0X3AAD,
-  0X3AEE, 0X3ACE, 0X3ACE, 0X3ACE, 0X3AEE, 0X4413, 0X4CB5, 0X4C13,
-  0X4B71, 0X4B71, 0X4B91, 0X4B91, 0X4BB2, 0X53F3, 0X5413, 0X5413,
-  0X5CB6, 0X5D17, 0X5CB6, 0X64B6, 0X64D6, 0X6537, 0X6D99, 0X6DDA,
-  0X6DDA, 0X75DA, 0X75DA, 0X7DFA, 0X7E3B, 0X867C, 0X867C, 0X869C,
-  0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5B, 0X7E3B, 0X761B, 0X75FB,
-  0X75FA, 0X6DFB, 0X6DFB, 0X6DBA, 0X6599, 0X6579, 0X6579, 0X54F7,
-  0X5475, 0X5C76, 0X54B7, 0X5414, 0X4B71, 0X4B51, 0X4B72, 0X4310,
-  0X42AD, 0X3A8D, 0X3A6D, 0X3A2C, 0X320B, 0X322B, 0X322B, 0X324C,
-  0X324C, 0X3A6D, 0X32AC, 0X2A0A, 0X2107, 0X20E5, 0X18E5, 0X18A5,
-  0X18A5, 0X20C5, 0X18C4, 0X1883, 0X1863, 0X1063, 0X10A3, 0X1062,
-  0X1082, 0X08C3, 0X10C3, 0X10A3, 0X10A3, 0X10C4, 0X10E4, 0X1925,
-  0X2186, 0X3A08, 0X4229, 0X52A9, 0X8BF0, 0XB596, 0XE71C, 0XFFDF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE,
-  0XEF7D, 0XE71C, 0XD6BA, 0XC638, 0XB5B6, 0XA514, 0X8C51, 0X73AE,
-  0X5AEB, 0X4A49, 0X39C7, 0X2945, 0X18E3, 0X10A2, 0X0861, 0X0841,
-  0X0020, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020,
-  0X0020, 0X0841, 0X0861, 0X10A2, 0X18E3, 0X2945, 0X39C7, 0X4A49,
-  0X5AEB, 0X73AE, 0X8C51, 0XA514, 0XB5B6, 0XC638, 0XD6BA, 0XE71C,
-  0XEF7D, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XEF3D, 0XBD56, 0X8C31, 0X636E, 0X52AC, 0X3A09, 0X3166,
-  0X31A8, 0X21A7, 0X1925, 0X2146, 0X21A8, 0X21A7, 0X29C8, 0X2166,
-  0X1925, 0X1125, 0X1104, 0X10C4, 0X10E4, 0X1905, 0X1905, 0X2187,
-  0X224B, 0X2AED, 0X336E, 0X2ACC, 0X322B, 0X324B, 0X3AAD, 0X328C,
-  0X3A8C, 0X3B2F, 0X332F, 0X32AD, 0X3B2F, 0X4474, 0X4474, 0X4370,
-  0X4350, 0X4B91, 0X4B91, 0X4B91, 0X4BB2, 0X53F3, 0X53F3, 0X5434,
-  0X5CF7, 0X5CD6, 0X5C95, 0X64B6, 0X64F7, 0X6558, 0X6DDA, 0X6DFA,
-  0X6DDA, 0X75DA, 0X75FA, 0X7E1B, 0X7E5C, 0X867C, 0X867C, 0X869C,
-  0X8EDD, 0X869C, 0X869C, 0X867C, 0X7E5B, 0X7E5B, 0X7E3B, 0X761B,
-  0X75FB, 0X75FB, 0X761B, 0X65BA, 0X6599, 0X6579, 0X6579, 0X5D17,
-  0X5475, 0X5C76, 0X5CB7, 0X5476, 0X4B92, 0X4B51, 0X4B72, 0X4331,
-  0X42CE, 0X3A8D, 0X3A6C, 0X3A0B, 0X31EB, 0X320C, 0X31EB, 0X29EB,
-  0X29C9, 0X29A8, 0X29EA, 0X2A4C, 0X29EA, 0X2167, 0X1906, 0X1927,
-  0X2126, 0X18A4, 0X1862, 0X1883, 0X20A5, 0X1884, 0X1041, 0X0820,
-  0X1041, 0X10A3, 0X10E4, 0X10E4, 0X08C3, 0X08A3, 0X10C4, 0X1104,
-  0X2187, 0X3209, 0X3A49, 0X4208, 0X734C, 0XACF4, 0XDE9B, 0XF79E,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE,
-  0XF79E, 0XEF5D, 0XDEFB, 0XD69A, 0XC618, 0XAD75, 0X9CD3, 0X8430,
-  0X6B6D, 0X5ACB, 0X4A49, 0X39C7, 0X2945, 0X2104, 0X10A2, 0X1082,
-  0X0841, 0X0841, 0X0020, 0X0020, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0020, 0X0020, 0X0841,
-  0X0841, 0X1082, 0X10A2, 0X2104, 0X2945, 0X39C7, 0X4A49, 0X5ACB,
-  0X6B6D, 0X8430, 0X9CD3, 0XAD75, 0XC618, 0XD69A, 0XDEFB, 0XEF5D,
-  0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XDE7B, 0XA4B2, 0X83EF, 0X632E, 0X4A4A, 0X3A09, 0X2967,
-  0X2147, 0X29A7, 0X2166, 0X1945, 0X2187, 0X29C8, 0X2A29, 0X29C7,
-  0X1945, 0X1925, 0X1104, 0X10E4, 0X10E4, 0X1905, 0X1946, 0X2167,
-  0X2A4B, 0X32AC, 0X336F, 0X3431, 0X336F, 0X324B, 0X3AEE, 0X3B50,
-  0X32AD, 0X3B90, 0X3BD1, 0X3BD1, 0X3B91, 0X3BB1, 0X43D1, 0X4330,
-  0X4350, 0X4B91, 0X4B91, 0X4B92, 0X4BD2, 0X53F3, 0X53F3, 0X5C95,
-  0X5D17, 0X5C95, 0X6495, 0X64D6, 0X6537, 0X6DB9, 0X6DFA, 0X6DDA,
-  0X75DA, 0X75FA, 0X761B, 0X7E3B, 0X7E7C, 0X867C, 0X867C, 0X869C,
-  0X8EDD, 0X86BD, 0X869C, 0X869C, 0X7E7C, 0X7E5B, 0X7E5C, 0X7E3C,
-  0X761B, 0X763B, 0X761B, 0X6DDA, 0X659A, 0X6579, 0X5D18, 0X6538,
-  0X5CB6, 0X5496, 0X54B7, 0X54B7, 0X4C14, 0X4B72, 0X4B72, 0X4351,
-  0X4310, 0X3AAE, 0X3A6D, 0X3A2C, 0X322B, 0X322C, 0X320B, 0X29AA,
-  0X2168, 0X2167, 0X2968, 0X29EB, 0X2A6C, 0X2A2B, 0X2A2B, 0X2A0B,
-  0X324A, 0X18E4, 0X1863, 0X1883, 0X1863, 0X1043, 0X1021, 0X0820,
-  0X1041, 0X1062, 0X0883, 0X08C3, 0X08E4, 0X08A3, 0X08C3, 0X1104,
-  0X1925, 0X29A7, 0X3A6A, 0X4269, 0X62EB, 0X9451, 0XBDD8, 0XE73D,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XF7BE, 0XEF7D, 0XE73C, 0XDEDB, 0XCE59, 0XBDD7, 0XAD55, 0X94B2,
-  0X8410, 0X6B6D, 0X5ACB, 0X4A49, 0X39C7, 0X2965, 0X2104, 0X18C3,
-  0X1082, 0X0861, 0X0841, 0X0841, 0X0020, 0X0020, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0000, 0X0020, 0X0020, 0X0841, 0X0841, 0X0861,
-  0X1082, 0X18C3, 0X2104, 0X2965, 0X39C7, 0X4A49, 0X5ACB, 0X6B6D,
-  0X8410, 0X94B2, 0XAD55, 0XBDD7, 0XCE59, 0XDEDB, 0XE73C, 0XEF7D,
-  0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XF77E, 0XC5B7, 0X9451, 0X736D, 0X630C, 0X42AB, 0X31E9, 0X29C8,
-  0X2987, 0X2187, 0X21A8, 0X21A7, 0X2146, 0X2986, 0X2A08, 0X2A28,
-  0X2186, 0X1925, 0X1145, 0X1125, 0X1105, 0X1105, 0X1946, 0X21C8,
-  0X2A2A, 0X2A0A, 0X32CC, 0X334F, 0X330D, 0X330E, 0X332E, 0X3C12,
-  0X3BB1, 0X32ED, 0X32CD, 0X3B4F, 0X3B4F, 0X4370, 0X43B1, 0X432F,
-  0X4B71, 0X53F3, 0X4BB2, 0X4B91, 0X4BD2, 0X53F3, 0X5434, 0X5D17,
-  0X6558, 0X5CB6, 0X5CD6, 0X6558, 0X6DDA, 0X6DFA, 0X6DFA, 0X6DBA,
-  0X75DA, 0X75FA, 0X761B, 0X7E3B, 0X7E7C, 0X867C, 0X869C, 0X86BC,
-  0X8EDD, 0X8EBD, 0X869D, 0X869C, 0X869C, 0X7E7C, 0X7E7C, 0X7E5C,
-  0X7E3C, 0X761B, 0X761B, 0X6DDA, 0X6579, 0X6558, 0X5CF7, 0X5CF7,
-  0X5CF7, 0X5CD7, 0X54B6, 0X5476, 0X5C77, 0X4BD4, 0X4B93, 0X4331,
-  0X4310, 0X42EF, 0X3A8D, 0X324C, 0X320B, 0X31EB, 0X29EA, 0X29A9,
-  0X2169, 0X2147, 0X2106, 0X2147, 0X2989, 0X21C9, 0X29E9, 0X3A8C,
-  0X3AEE, 0X2147, 0X20E6, 0X29A9, 0X10A3, 0X0800, 0X1001, 0X1021,
-  0X1042, 0X1082, 0X1083, 0X08A3, 0X10C4, 0X10C3, 0X10C4, 0X1104,
-  0X1905, 0X29C8, 0X3A6A, 0X4229, 0X5AAB, 0X73AE, 0X94D4, 0XD6BB,
-  0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XF7BE, 0XF79E, 0XEF5D, 0XE71C, 0XD6BA, 0XCE59, 0XBDD7, 0XA534,
-  0X9492, 0X8410, 0X6B6D, 0X5ACB, 0X4A49, 0X39E7, 0X2965, 0X2124,
-  0X18E3, 0X10A2, 0X1082, 0X0861, 0X0841, 0X0841, 0X0020, 0X0020,
-  0X0020, 0X0020, 0X0020, 0X0020, 0X0000, 0X0020, 0X0020, 0X0020,
-  0X0020, 0X0020, 0X0020, 0X0841, 0X0841, 0X0861, 0X1082, 0X10A2,
-  0X18E3, 0X2124, 0X2965, 0X39E7, 0X4A49, 0X5ACB, 0X6B6D, 0X8410,
-  0X9492, 0XA534, 0XBDD7, 0XCE59, 0XD6BA, 0XE71C, 0XEF5D, 0XF79E,
-  0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XDEFC, 0XA514, 0X8C31, 0X6B4D, 0X4AAA, 0X428B, 0X3166, 0X3166,
-  0X2966, 0X2166, 0X21A7, 0X2209, 0X29C8, 0X29A7, 0X29E8, 0X2A29,
-  0X21E8, 0X1965, 0X1966, 0X1125, 0X1105, 0X1125, 0X1946, 0X21A8,
-  0X2A09, 0X2A0A, 0X32CC, 0X2B0E, 0X326C, 0X3B90, 0X332F, 0X328C,
-  0X32ED, 0X326C, 0X326C, 0X326C, 0X3AEE, 0X4391, 0X4391, 0X432F,
-  0X4B71, 0X53F2, 0X4BF3, 0X4BD2, 0X53F3, 0X5434, 0X54D6, 0X6599,
-  0X5D58, 0X5D17, 0X6578, 0X6DFB, 0X6DFA, 0X6DDA, 0X6DFA, 0X6DDA,
-  0X75FA, 0X761B, 0X7E3B, 0X7E5B, 0X7E7C, 0X867C, 0X869C, 0X869C,
-  0X8EDD, 0X8EDD, 0X86BD, 0X869C, 0X869C, 0X7E7C, 0X7E5C, 0X7E3B,
-  0X761B, 0X75FB, 0X6DDB, 0X6DBA, 0X6558, 0X6518, 0X5CF7, 0X54B6,
-  0X5CD7, 0X5CB6, 0X5434, 0X5434, 0X5477, 0X5477, 0X4C14, 0X4351,
-  0X42F0, 0X42EF, 0X3AAE, 0X3A6C, 0X320B, 0X31CA, 0X29CA, 0X2989,
-  0X2969, 0X2168, 0X2127, 0X20E6, 0X2948, 0X2126, 0X10C4, 0X2167,
-  0X322A, 0X2167, 0X1926, 0X2A2A, 0X2187, 0X1063, 0X1042, 0X1062,
-  0X10A3, 0X08A3, 0X10A3, 0X10A3, 0X0883, 0X0882, 0X08A3, 0X10C3,
-  0X10C4, 0X1946, 0X3208, 0X3A09, 0X52AB, 0X634C, 0X8C51, 0XC619,
-  0XEF9E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XF7BE, 0XF79E, 0XEF5D, 0XDEFB, 0XD69A, 0XC638, 0XB5B6,
-  0XA534, 0X9492, 0X8410, 0X6B6D, 0X5AEB, 0X4A69, 0X4208, 0X31A6,
-  0X2965, 0X2124, 0X18E3, 0X18C3, 0X1082, 0X1082, 0X0861, 0X0841,
-  0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841, 0X0841,
-  0X0841, 0X0841, 0X0861, 0X1082, 0X1082, 0X18C3, 0X18E3, 0X2124,
-  0X2965, 0X31A6, 0X4208, 0X4A69, 0X5AEB, 0X6B6D, 0X8410, 0X9492,
-  0XA534, 0XB5B6, 0XC638, 0XD69A, 0XDEFB, 0XEF5D, 0XF79E, 0XF7BE,
-  0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XC618, 0X9472, 0X7BD0, 0X62EC, 0X4A4A, 0X39C8, 0X3146, 0X2945,
-  0X1925, 0X2145, 0X2166, 0X2186, 0X29E8, 0X29C8, 0X31C8, 0X2A29,
-  0X2208, 0X1965, 0X1945, 0X1946, 0X1105, 0X1905, 0X1946, 0X21A7,
-  0X21A8, 0X29C8, 0X2A4A, 0X2AED, 0X2ACD, 0X332E, 0X32ED, 0X2A2B,
-  0X2A4B, 0X326C, 0X326C, 0X326C, 0X3AAE, 0X43B1, 0X4390, 0X432F,
-  0X4B71, 0X4BD2, 0X4C74, 0X5495, 0X5495, 0X54D6, 0X5D58, 0X5DB9,
-  0X65B9, 0X65B9, 0X65DA, 0X65D9, 0X6599, 0X6DB9, 0X6D99, 0X6DB9,
-  0X75DA, 0X75FA, 0X7DFA, 0X7E3B, 0X7E7C, 0X867C, 0X869C, 0X86BD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X7E5C, 0X7E3B, 0X761B,
-  0X75FB, 0X75FB, 0X6DBA, 0X6D9A, 0X6558, 0X64F7, 0X5CD7, 0X5CB6,
-  0X5CB6, 0X5475, 0X53F4, 0X53D3, 0X4C34, 0X5496, 0X4C35, 0X4352,
-  0X4310, 0X42EF, 0X3AAE, 0X3A6D, 0X322C, 0X31EA, 0X31AA, 0X29AA,
-  0X2989, 0X2989, 0X2148, 0X2127, 0X2169, 0X1927, 0X18C4, 0X18C5,
-  0X1906, 0X2167, 0X2188, 0X1946, 0X29A8, 0X2146, 0X1083, 0X10A3,
-  0X10A4, 0X08C4, 0X10A3, 0X0883, 0X0882, 0X0883, 0X0882, 0X0882,
-  0X10C3, 0X10E4, 0X2987, 0X3A08, 0X4A4A, 0X5ACC, 0X7BCF, 0XAD35,
-  0XDEDC, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE73C, 0XDEFB, 0XD69A, 0XC638,
-  0XB5B6, 0XA534, 0X94B2, 0X8430, 0X73AE, 0X632C, 0X52AA, 0X4A49,
-  0X39E7, 0X31A6, 0X2965, 0X2124, 0X18E3, 0X18C3, 0X18C3, 0X10A2,
-  0X1082, 0X1082, 0X1082, 0X0861, 0X0861, 0X0861, 0X1082, 0X1082,
-  0X1082, 0X10A2, 0X18C3, 0X18C3, 0X18E3, 0X2124, 0X2965, 0X31A6,
-  0X39E7, 0X4A49, 0X52AA, 0X632C, 0X73AE, 0X8430, 0X94B2, 0XA534,
-  0XB5B6, 0XC638, 0XD69A, 0XDEFB, 0XE73C, 0XEF7D, 0XF7BE, 0XFFDF,
-  0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XE6FC,
-  0XA4F3, 0X8410, 0X738E, 0X4A4A, 0X41E8, 0X3186, 0X2965, 0X2125,
-  0X2125, 0X2145, 0X2145, 0X2165, 0X29E8, 0X2A08, 0X29E8, 0X2A08,
-  0X21E7, 0X1945, 0X1925, 0X1966, 0X1105, 0X10E5, 0X1946, 0X21A7,
-  0X21A8, 0X29C8, 0X29E9, 0X328C, 0X2A8C, 0X2A6B, 0X2A8C, 0X2A8C,
-  0X2AAD, 0X328C, 0X326C, 0X324C, 0X3AEE, 0X4413, 0X4413, 0X43D2,
-  0X4BF3, 0X5475, 0X54F6, 0X54F7, 0X5D38, 0X5D58, 0X65B9, 0X65DA,
-  0X65DA, 0X6578, 0X5D17, 0X6558, 0X6578, 0X6D99, 0X6D79, 0X7599,
-  0X75DA, 0X75DA, 0X7DFA, 0X7E3B, 0X7E5C, 0X865C, 0X869C, 0X86BD,
-  0X8EDD, 0X8EDD, 0X86BD, 0X869C, 0X867C, 0X7E5C, 0X7E1B, 0X75FB,
-  0X75FA, 0X6DDA, 0X6D9A, 0X6D79, 0X6558, 0X64F7, 0X64B6, 0X5C96,
-  0X5C96, 0X5455, 0X5414, 0X53D3, 0X4BB3, 0X4C14, 0X4C35, 0X4B72,
-  0X4331, 0X42F0, 0X3AAE, 0X3A6D, 0X3A4D, 0X3A2C, 0X31EB, 0X31CB,
-  0X31AA, 0X298A, 0X2989, 0X21AA, 0X21CA, 0X2189, 0X1906, 0X10C5,
-  0X18E6, 0X2148, 0X2188, 0X18E6, 0X18E5, 0X1905, 0X10C4, 0X10A4,
-  0X10A4, 0X10C4, 0X08C4, 0X08A3, 0X10A3, 0X0882, 0X0862, 0X0862,
-  0X10A3, 0X18E5, 0X2167, 0X31E8, 0X4229, 0X4A6A, 0X5AEB, 0X842F,
-  0XBDB8, 0XEF7E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XFFDF, 0XF7BE, 0XEF7D, 0XE73C, 0XDEFB, 0XD69A,
-  0XC638, 0XBDD7, 0XAD55, 0X9CD3, 0X8C51, 0X7BCF, 0X6B4D, 0X5AEB,
-  0X528A, 0X4228, 0X39E7, 0X31A6, 0X2965, 0X2945, 0X2124, 0X2104,
-  0X18E3, 0X18E3, 0X18E3, 0X18C3, 0X18C3, 0X18C3, 0X18E3, 0X18E3,
-  0X18E3, 0X2104, 0X2124, 0X2945, 0X2965, 0X31A6, 0X39E7, 0X4228,
-  0X528A, 0X5AEB, 0X6B4D, 0X7BCF, 0X8C51, 0X9CD3, 0XAD55, 0XBDD7,
-  0XC638, 0XD69A, 0XDEFB, 0XE73C, 0XEF7D, 0XF7BE, 0XFFDF, 0XFFDF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF79E, 0XC5B7,
-  0X9451, 0X7BEF, 0X636D, 0X4A6A, 0X3186, 0X3186, 0X2966, 0X2125,
-  0X2165, 0X2165, 0X2145, 0X2986, 0X29E7, 0X29E7, 0X29E7, 0X2A08,
-  0X21E7, 0X2166, 0X1925, 0X1166, 0X1125, 0X10E5, 0X1946, 0X21C8,
-  0X21C9, 0X29C8, 0X2A09, 0X326B, 0X328C, 0X2A2A, 0X2A4B, 0X2A8C,
-  0X32CE, 0X32EE, 0X32EE, 0X3B0F, 0X43D3, 0X4C75, 0X4C75, 0X4C75,
-  0X4C75, 0X5495, 0X54D6, 0X4C95, 0X54B5, 0X6578, 0X65D9, 0X6598,
-  0X6537, 0X5CD6, 0X64F6, 0X6578, 0X6D99, 0X6DB9, 0X6D99, 0X75B9,
-  0X75DA, 0X7DDA, 0X7E1B, 0X7E5C, 0X865B, 0X867C, 0X869C, 0X86BD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X7E5C, 0X7E1B, 0X7DFB,
-  0X75DA, 0X6DBA, 0X6D99, 0X6D59, 0X6538, 0X64F7, 0X64B6, 0X5C96,
-  0X5C76, 0X5455, 0X5435, 0X5414, 0X4BF4, 0X4BF4, 0X4C14, 0X4BB3,
-  0X4B31, 0X4310, 0X42CF, 0X3A8E, 0X3A8D, 0X3A6D, 0X322C, 0X31EB,
-  0X29CB, 0X29AA, 0X29EB, 0X21A9, 0X2168, 0X2169, 0X2168, 0X1927,
-  0X1906, 0X2106, 0X2127, 0X1927, 0X10E6, 0X18E6, 0X18E6, 0X10A5,
-  0X10A4, 0X10A4, 0X08A3, 0X10C4, 0X10E4, 0X08A3, 0X0882, 0X0862,
-  0X1083, 0X10E5, 0X2187, 0X2A08, 0X3A6A, 0X4229, 0X4A28, 0X6B4D,
-  0X9CB2, 0XD69A, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XEF7D, 0XE73C, 0XDEFB,
-  0XD69A, 0XCE59, 0XBDD7, 0XAD75, 0X9CF3, 0X9492, 0X8410, 0X73AE,
-  0X6B4D, 0X5AEB, 0X52AA, 0X4A69, 0X4228, 0X39E7, 0X39C7, 0X31A6,
-  0X3186, 0X2965, 0X2965, 0X2945, 0X2945, 0X2945, 0X2965, 0X2965,
-  0X3186, 0X31A6, 0X39C7, 0X39E7, 0X4228, 0X4A69, 0X52AA, 0X5AEB,
-  0X6B4D, 0X73AE, 0X8410, 0X9492, 0X9CF3, 0XAD75, 0XBDD7, 0XCE59,
-  0XD69A, 0XDEFB, 0XE73C, 0XEF7D, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XDEBB, 0XA4B3,
-  0X8C30, 0X6B4D, 0X5B2D, 0X52EC, 0X3187, 0X2925, 0X2125, 0X2145,
-  0X1945, 0X2145, 0X2166, 0X21A6, 0X29E8, 0X21E7, 0X2186, 0X21C7,
-  0X2A28, 0X21A7, 0X2145, 0X1946, 0X1146, 0X1105, 0X1946, 0X21C8,
-  0X21E9, 0X29E9, 0X2A09, 0X2A2A, 0X328C, 0X2A6C, 0X2A4B, 0X2A4B,
-  0X2A8C, 0X32CD, 0X3B0F, 0X3BB2, 0X4433, 0X43F2, 0X4C34, 0X4C54,
-  0X4C33, 0X4C13, 0X5454, 0X5454, 0X54B5, 0X65B9, 0X6599, 0X5CF6,
-  0X5CF6, 0X64F7, 0X64F7, 0X6558, 0X6D99, 0X6D99, 0X6D79, 0X75B9,
-  0X75DA, 0X7DFA, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X761A,
-  0X75DA, 0X6DBA, 0X6D99, 0X6D58, 0X6538, 0X64F7, 0X64B7, 0X5C96,
-  0X5C75, 0X5C55, 0X5435, 0X5415, 0X4C14, 0X4C34, 0X4C34, 0X43B3,
-  0X4B72, 0X4351, 0X4310, 0X3ACF, 0X3A8E, 0X3A6E, 0X324D, 0X322D,
-  0X2A2C, 0X2A0C, 0X29CA, 0X2988, 0X2169, 0X2168, 0X2168, 0X2106,
-  0X18E6, 0X18E6, 0X2107, 0X2106, 0X1928, 0X1928, 0X1127, 0X1127,
-  0X1106, 0X10E5, 0X10C4, 0X10C4, 0X10E5, 0X10E4, 0X10C4, 0X10A3,
-  0X10C4, 0X1905, 0X2166, 0X29C8, 0X326A, 0X42AB, 0X42AA, 0X5AEC,
-  0X83EF, 0XAD33, 0XEF3D, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF79E, 0XEF7D, 0XE73C,
-  0XDEFB, 0XD6BA, 0XCE59, 0XC618, 0XB596, 0XA534, 0X9CD3, 0X8C71,
-  0X8410, 0X73AE, 0X6B6D, 0X632C, 0X5ACB, 0X52AA, 0X4A69, 0X4A49,
-  0X4228, 0X4208, 0X4208, 0X39E7, 0X39E7, 0X39E7, 0X4208, 0X4208,
-  0X4228, 0X4A49, 0X4A69, 0X52AA, 0X5ACB, 0X632C, 0X6B6D, 0X73AE,
-  0X8410, 0X8C71, 0X9CD3, 0XA534, 0XB596, 0XC618, 0XCE59, 0XD6BA,
-  0XDEFB, 0XE73C, 0XEF7D, 0XF79E, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF77E, 0XB576, 0X8C31,
-  0X738E, 0X62AA, 0X4A49, 0X426A, 0X3A4A, 0X2186, 0X18E4, 0X2125,
-  0X2145, 0X2145, 0X2186, 0X21E8, 0X2228, 0X21A7, 0X1966, 0X21A6,
-  0X2208, 0X2208, 0X21A7, 0X1986, 0X1966, 0X1926, 0X1967, 0X21E9,
-  0X2209, 0X21E9, 0X2A2A, 0X322A, 0X2A6B, 0X32AD, 0X2A8C, 0X2A2B,
-  0X328C, 0X32AD, 0X32CE, 0X43B2, 0X43D1, 0X43B1, 0X4C75, 0X4C75,
-  0X4BF2, 0X53B2, 0X5434, 0X5475, 0X5D37, 0X65DA, 0X5D37, 0X5CD6,
-  0X5CF6, 0X64F7, 0X6538, 0X6578, 0X6D99, 0X6D99, 0X7579, 0X75B9,
-  0X75DA, 0X7E1A, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X867C, 0X7E3B, 0X761B,
-  0X75FA, 0X6DBA, 0X6D99, 0X6D59, 0X6538, 0X64F7, 0X64D7, 0X5CB6,
-  0X5C76, 0X5C55, 0X5455, 0X5435, 0X4C35, 0X5476, 0X4C55, 0X43F3,
-  0X43B3, 0X4392, 0X4351, 0X4310, 0X3AEF, 0X3ACF, 0X328E, 0X326D,
-  0X2A2C, 0X29EA, 0X29AA, 0X2989, 0X2169, 0X2189, 0X2169, 0X2148,
-  0X2127, 0X2107, 0X2107, 0X1906, 0X1906, 0X1906, 0X10C5, 0X10C5,
-  0X10C5, 0X10A4, 0X10C4, 0X10C5, 0X10E5, 0X10E5, 0X10E4, 0X10C4,
-  0X10C4, 0X18E5, 0X2125, 0X29A8, 0X3229, 0X3AAA, 0X42CB, 0X4A8A,
-  0X630C, 0X83EE, 0XBDD7, 0XF7BF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XF7BE, 0XF7BE, 0XEF7D,
-  0XEF5D, 0XE71C, 0XDEDB, 0XD69A, 0XC638, 0XBDD7, 0XAD75, 0XA534,
-  0X9CD3, 0X9492, 0X8430, 0X7BEF, 0X73AE, 0X6B6D, 0X6B4D, 0X630C,
-  0X5AEB, 0X5AEB, 0X5ACB, 0X5ACB, 0X5ACB, 0X5ACB, 0X5ACB, 0X5AEB,
-  0X5AEB, 0X630C, 0X6B4D, 0X6B6D, 0X73AE, 0X7BEF, 0X8430, 0X9492,
-  0X9CD3, 0XA534, 0XAD75, 0XBDD7, 0XC638, 0XD69A, 0XDEDB, 0XE71C,
-  0XEF5D, 0XEF7D, 0XF7BE, 0XF7BE, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XCE5A, 0X94B3, 0X7C10,
-  0X632C, 0X5249, 0X41C7, 0X31C7, 0X29C7, 0X2207, 0X1945, 0X1904,
-  0X2145, 0X29E7, 0X2A49, 0X2208, 0X19A7, 0X1986, 0X1966, 0X19A6,
-  0X2208, 0X2229, 0X21C7, 0X21E8, 0X21A8, 0X1946, 0X19A8, 0X220A,
-  0X2A4A, 0X2A2A, 0X2A2B, 0X326B, 0X328C, 0X32AC, 0X2A8D, 0X328D,
-  0X328D, 0X32AD, 0X3ACE, 0X43D2, 0X43D2, 0X4BD2, 0X4C54, 0X5496,
-  0X4C34, 0X4BB2, 0X5454, 0X5517, 0X6578, 0X6578, 0X5CD6, 0X5CB6,
-  0X5CD6, 0X6517, 0X6D78, 0X6579, 0X6DB9, 0X6D99, 0X7599, 0X75B9,
-  0X75DA, 0X7E1B, 0X7E3B, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X867C, 0X7E5C, 0X7E1B,
-  0X75FB, 0X75DA, 0X6DBA, 0X6D99, 0X6579, 0X6538, 0X64F7, 0X5CF7,
-  0X5CB7, 0X5496, 0X5496, 0X5476, 0X54B7, 0X54B6, 0X4C55, 0X4C75,
-  0X4C55, 0X43F3, 0X43D3, 0X4392, 0X4330, 0X3AEF, 0X328E, 0X322C,
-  0X29EB, 0X29AA, 0X29AA, 0X29CA, 0X29A9, 0X2989, 0X2169, 0X2148,
-  0X2127, 0X2127, 0X2127, 0X2126, 0X18E6, 0X18C6, 0X18C5, 0X18A5,
-  0X1084, 0X1083, 0X10A4, 0X10C4, 0X10A4, 0X10A4, 0X10C4, 0X10A3,
-  0X10A4, 0X10E5, 0X1925, 0X2186, 0X31E8, 0X3A49, 0X428A, 0X4A48,
-  0X52CA, 0X6BAE, 0X8C70, 0XCE59, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XF7BE,
-  0XF79E, 0XEF5D, 0XE73C, 0XDEFB, 0XD6BA, 0XCE79, 0XC618, 0XBDD7,
-  0XB596, 0XA534, 0X9CF3, 0X94B2, 0X8C71, 0X8C51, 0X8410, 0X7BEF,
-  0X7BCF, 0X73AE, 0X73AE, 0X738E, 0X738E, 0X738E, 0X73AE, 0X73AE,
-  0X7BCF, 0X7BEF, 0X8410, 0X8C51, 0X8C71, 0X94B2, 0X9CF3, 0XA534,
-  0XB596, 0XBDD7, 0XC618, 0XCE79, 0XD6BA, 0XDEFB, 0XE73C, 0XEF5D,
-  0XF79E, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XDEFC, 0XA535, 0X8C51, 0X7BAE,
-  0X52CA, 0X4207, 0X39A6, 0X3186, 0X2145, 0X2104, 0X2186, 0X1965,
-  0X2186, 0X2A08, 0X2249, 0X19C7, 0X1966, 0X1986, 0X1986, 0X1986,
-  0X19A7, 0X2208, 0X21E8, 0X19A7, 0X19E9, 0X19C8, 0X21C9, 0X21E9,
-  0X2A4B, 0X2AAC, 0X2A4B, 0X2A8C, 0X32AC, 0X328C, 0X2A6B, 0X32CD,
-  0X32AD, 0X32AD, 0X3B2F, 0X43B2, 0X4371, 0X4BD2, 0X4C75, 0X54D6,
-  0X5495, 0X4C33, 0X54D6, 0X6599, 0X6598, 0X5D17, 0X5CB6, 0X5CB6,
-  0X64D6, 0X6537, 0X6D78, 0X6D79, 0X6DB9, 0X6DB9, 0X75B9, 0X75DA,
-  0X7DFA, 0X7E3B, 0X7E3B, 0X863B, 0X865C, 0X869C, 0X869C, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X867C, 0X7E5C, 0X7E1B,
-  0X75FA, 0X75DA, 0X6DBA, 0X6D99, 0X6579, 0X6538, 0X6518, 0X5CF7,
-  0X5CD7, 0X5C96, 0X5476, 0X5476, 0X54B6, 0X4C75, 0X4C55, 0X54B6,
-  0X4C75, 0X43F4, 0X4BD3, 0X4372, 0X3AEF, 0X3AAE, 0X326D, 0X322C,
-  0X320B, 0X29EB, 0X29CA, 0X29CA, 0X298A, 0X2989, 0X2989, 0X2168,
-  0X2968, 0X2127, 0X2106, 0X2106, 0X2106, 0X18E6, 0X1906, 0X18E6,
-  0X18C5, 0X18A4, 0X18A4, 0X18A4, 0X1083, 0X1083, 0X10C4, 0X10E5,
-  0X10E4, 0X1925, 0X1904, 0X1925, 0X29A7, 0X3209, 0X426A, 0X3A29,
-  0X4A69, 0X636D, 0X73CD, 0X94B2, 0XE71C, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF,
-  0XF7BE, 0XF79E, 0XEF7D, 0XE73C, 0XE71C, 0XDEDB, 0XD6BA, 0XCE79,
-  0XC638, 0XBDF7, 0XB5B6, 0XAD75, 0XAD55, 0XA514, 0X9CF3, 0X9CD3,
-  0X94B2, 0X9492, 0X8C71, 0X8C71, 0X8C71, 0X8C71, 0X8C71, 0X9492,
-  0X94B2, 0X9CD3, 0X9CF3, 0XA514, 0XAD55, 0XAD75, 0XB5B6, 0XBDF7,
-  0XC638, 0XCE79, 0XD6BA, 0XDEDB, 0XE71C, 0XE73C, 0XEF7D, 0XF79E,
-  0XF7BE, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XEF7E, 0XB5B7, 0X9471, 0X83AF, 0X62CB,
-  0X4A28, 0X39A6, 0X2965, 0X2945, 0X2165, 0X1924, 0X1945, 0X21A6,
-  0X21C6, 0X2186, 0X2186, 0X19A6, 0X1986, 0X1986, 0X1986, 0X1946,
-  0X1965, 0X21C7, 0X21E8, 0X1986, 0X21A7, 0X21E9, 0X222A, 0X220A,
-  0X2A0A, 0X2A8B, 0X2A4B, 0X2A2B, 0X2A4B, 0X2A8C, 0X328C, 0X32AD,
-  0X3ACE, 0X3B0E, 0X4391, 0X43B1, 0X430F, 0X4B91, 0X4C95, 0X4CF6,
-  0X5495, 0X5474, 0X5D17, 0X5D37, 0X5D57, 0X5D16, 0X5CB6, 0X5CB6,
-  0X64D6, 0X6537, 0X6D78, 0X6D79, 0X6D99, 0X75BA, 0X75DA, 0X75FA,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8E9D, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869D, 0X869C, 0X7E5C, 0X7E1B,
-  0X75FA, 0X75DA, 0X6D99, 0X6D79, 0X6D79, 0X6538, 0X64F7, 0X5CF7,
-  0X5CB7, 0X5C96, 0X5455, 0X5434, 0X4C34, 0X4C35, 0X4C55, 0X4C34,
-  0X4BF4, 0X43D3, 0X4392, 0X4330, 0X3AEF, 0X32AE, 0X326D, 0X322C,
-  0X320B, 0X29EB, 0X29CA, 0X29CA, 0X2189, 0X2169, 0X2169, 0X2168,
-  0X2168, 0X2147, 0X2127, 0X2106, 0X20E5, 0X18A4, 0X18C4, 0X18E6,
-  0X18E5, 0X18A4, 0X1884, 0X18C4, 0X18A4, 0X18A3, 0X18C4, 0X18E4,
-  0X1904, 0X1904, 0X1925, 0X1925, 0X2125, 0X29A7, 0X3249, 0X3A49,
-  0X4A6A, 0X52CA, 0X630B, 0X7B8D, 0XAD55, 0XEF5D, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XFFDF, 0XF7BE, 0XF7BE, 0XF79E, 0XEF7D, 0XE73C, 0XE71C, 0XDEFB,
-  0XD6BA, 0XD69A, 0XCE59, 0XC618, 0XBDF7, 0XBDD7, 0XB5B6, 0XB596,
-  0XAD75, 0XAD55, 0XAD55, 0XA534, 0XA534, 0XA534, 0XAD55, 0XAD55,
-  0XAD75, 0XB596, 0XB5B6, 0XBDD7, 0XBDF7, 0XC618, 0XCE59, 0XD69A,
-  0XD6BA, 0XDEFB, 0XE71C, 0XE73C, 0XEF7D, 0XF79E, 0XF7BE, 0XF7BE,
-  0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XF7BF, 0XC619, 0X9492, 0X8C31, 0X6B4C, 0X4A48,
-  0X4207, 0X3165, 0X2945, 0X2965, 0X2165, 0X2144, 0X1903, 0X1944,
-  0X21C6, 0X2165, 0X1945, 0X1986, 0X19A6, 0X2186, 0X2186, 0X1945,
-  0X1945, 0X1946, 0X1986, 0X1967, 0X1987, 0X19C8, 0X21E9, 0X2A0A,
-  0X2A0A, 0X2A2A, 0X2A2A, 0X2A2A, 0X2A2B, 0X2A6C, 0X32CE, 0X3AEE,
-  0X3B0E, 0X3B2F, 0X4BF3, 0X43D2, 0X4391, 0X4391, 0X4C13, 0X4CD6,
-  0X4C54, 0X5495, 0X54F6, 0X5495, 0X5D17, 0X5D37, 0X5CB5, 0X5CB6,
-  0X64F7, 0X6558, 0X6D78, 0X6D79, 0X6D99, 0X75DA, 0X75FA, 0X75FA,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X86BD, 0X869C, 0X867C, 0X7E3B,
-  0X7DFB, 0X75DA, 0X75BA, 0X6D9A, 0X6D79, 0X6538, 0X6518, 0X64F7,
-  0X5CB6, 0X5C96, 0X5455, 0X5434, 0X5414, 0X5435, 0X4C34, 0X4BD3,
-  0X4BB2, 0X4B92, 0X4351, 0X4330, 0X3AF0, 0X3AAF, 0X326D, 0X322C,
-  0X320B, 0X29EB, 0X29CA, 0X29AA, 0X2189, 0X2189, 0X2169, 0X2189,
-  0X2168, 0X2148, 0X2147, 0X2126, 0X20C5, 0X18A4, 0X18A4, 0X18E5,
-  0X18C5, 0X1084, 0X1884, 0X18A4, 0X18A3, 0X18C3, 0X18C3, 0X18A2,
-  0X10A3, 0X10E3, 0X1904, 0X2125, 0X1924, 0X2186, 0X31A7, 0X31C7,
-  0X3A49, 0X4248, 0X5A89, 0X62CB, 0X83CF, 0XC618, 0XF7BE, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XFFDF, 0XF7BE, 0XF79E, 0XF79E, 0XEF7D, 0XE73C,
-  0XE71C, 0XDEFB, 0XDEDB, 0XD6BA, 0XD69A, 0XCE79, 0XCE59, 0XC638,
-  0XC618, 0XC618, 0XC618, 0XBDF7, 0XBDF7, 0XBDF7, 0XC618, 0XC618,
-  0XC618, 0XC638, 0XCE59, 0XCE79, 0XD69A, 0XD6BA, 0XDEDB, 0XDEFB,
-  0XE71C, 0XE73C, 0XEF7D, 0XF79E, 0XF79E, 0XF7BE, 0XFFDF, 0XFFDF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XD67A, 0X9CD3, 0X8C51, 0X738E, 0X5AAA, 0X4206,
-  0X39C6, 0X39E8, 0X31E7, 0X29A6, 0X2985, 0X2144, 0X1903, 0X1985,
-  0X2208, 0X21C7, 0X1986, 0X19A7, 0X21A6, 0X29A6, 0X21A7, 0X1966,
-  0X1945, 0X1905, 0X1105, 0X1925, 0X1946, 0X19A8, 0X21A8, 0X21C9,
-  0X29EA, 0X2A0A, 0X2A0A, 0X2A2B, 0X2A4B, 0X326C, 0X3B0F, 0X3B0E,
-  0X3B0E, 0X43D2, 0X4C33, 0X43B2, 0X43D2, 0X4413, 0X4C95, 0X54B6,
-  0X4C54, 0X54D6, 0X54B5, 0X5474, 0X5CF6, 0X5D17, 0X5CB6, 0X5CD6,
-  0X6517, 0X6D79, 0X6D79, 0X6D79, 0X75B9, 0X75FA, 0X75FA, 0X75FA,
-  0X7E1B, 0X7E3B, 0X7E5B, 0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869D, 0X869C, 0X867C, 0X7E3B,
-  0X7DFB, 0X75DA, 0X75BA, 0X6D99, 0X6D58, 0X6538, 0X6518, 0X64F7,
-  0X5CB6, 0X5C75, 0X5455, 0X5434, 0X5414, 0X5414, 0X4BF3, 0X4BB3,
-  0X4B92, 0X4371, 0X4351, 0X4310, 0X3ACF, 0X3AAE, 0X3A6D, 0X324C,
-  0X2A0B, 0X2A0B, 0X29EA, 0X29CA, 0X2989, 0X29AA, 0X21CA, 0X29AA,
-  0X2989, 0X2968, 0X2127, 0X2106, 0X20E5, 0X18A4, 0X18C5, 0X2106,
-  0X18E5, 0X18A4, 0X1883, 0X1883, 0X18A3, 0X10A3, 0X10A2, 0X18A3,
-  0X18C3, 0X18E4, 0X1904, 0X2125, 0X2125, 0X2146, 0X31A7, 0X3208,
-  0X3A28, 0X4208, 0X4A28, 0X5A8A, 0X6B6D, 0X840F, 0XBDF7, 0XF7BE,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XFFDF, 0XF7BE, 0XF79E, 0XF79E,
-  0XEF7D, 0XEF5D, 0XE73C, 0XE71C, 0XE71C, 0XDEFB, 0XDEDB, 0XD6BA,
-  0XD6BA, 0XD6BA, 0XD69A, 0XD69A, 0XD69A, 0XD69A, 0XD69A, 0XD6BA,
-  0XD6BA, 0XD6BA, 0XDEDB, 0XDEFB, 0XE71C, 0XE71C, 0XE73C, 0XEF5D,
-  0XEF7D, 0XF79E, 0XF79E, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFDF, 0XDEDC, 0XA534, 0X8450, 0X7BCF, 0X630B, 0X4A48, 0X39C6,
-  0X31A6, 0X3ACB, 0X32AA, 0X29C7, 0X29A6, 0X2186, 0X21A6, 0X19C6,
-  0X19A6, 0X21E7, 0X21E7, 0X1986, 0X2186, 0X29C7, 0X21A7, 0X1966,
-  0X1946, 0X1946, 0X1105, 0X10E4, 0X1925, 0X1967, 0X2187, 0X21A8,
-  0X29E9, 0X2A2A, 0X2A0A, 0X2A2B, 0X32AD, 0X3AEE, 0X3B2F, 0X3B4F,
-  0X3B2F, 0X4433, 0X43F2, 0X4350, 0X4371, 0X43D2, 0X4CB6, 0X54D6,
-  0X54B5, 0X54F7, 0X4C74, 0X54B5, 0X5D16, 0X6517, 0X5CF6, 0X6517,
-  0X6558, 0X6D99, 0X6D99, 0X6D99, 0X6DB9, 0X75DA, 0X75DA, 0X75FA,
-  0X7E3B, 0X7E5B, 0X865B, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X869C, 0X7E5B,
-  0X7E1B, 0X75FA, 0X75BA, 0X7599, 0X6D59, 0X6D58, 0X6518, 0X64D7,
-  0X5CB6, 0X5C75, 0X5C55, 0X5434, 0X5414, 0X53F4, 0X4BD3, 0X4BB2,
-  0X4B92, 0X4371, 0X4351, 0X4330, 0X3AEF, 0X3AAE, 0X3A8D, 0X324C,
-  0X322C, 0X320B, 0X320B, 0X29CA, 0X29AA, 0X29EB, 0X2A2C, 0X2A2B,
-  0X29A9, 0X29CA, 0X2A4C, 0X2167, 0X20E6, 0X18C5, 0X18C5, 0X1905,
-  0X18E5, 0X1884, 0X1884, 0X1883, 0X18A3, 0X10A3, 0X18A3, 0X18C3,
-  0X18E4, 0X18E4, 0X18E4, 0X1925, 0X29A7, 0X21E8, 0X21E7, 0X29C7,
-  0X31A6, 0X39E7, 0X4208, 0X528A, 0X5AEB, 0X632C, 0X8C30, 0XCE38,
-  0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XFFDF, 0XF7BE,
-  0XF7BE, 0XF79E, 0XF79E, 0XEF7D, 0XEF7D, 0XEF5D, 0XE73C, 0XE73C,
-  0XE73C, 0XE71C, 0XE71C, 0XE71C, 0XE71C, 0XE71C, 0XE71C, 0XE71C,
-  0XE73C, 0XE73C, 0XE73C, 0XEF5D, 0XEF7D, 0XEF7D, 0XF79E, 0XF79E,
-  0XF7BE, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XDEDB, 0XAD35, 0X8C72, 0X8430, 0X632B, 0X5AAA, 0X4A29, 0X3186,
-  0X3185, 0X3227, 0X3227, 0X2986, 0X2165, 0X2185, 0X2A48, 0X2A89,
-  0X1924, 0X1965, 0X21A6, 0X1966, 0X21A7, 0X21A7, 0X2166, 0X1945,
-  0X1946, 0X1967, 0X1946, 0X1105, 0X1105, 0X1926, 0X2167, 0X21C9,
-  0X2A2A, 0X2A2A, 0X2A4B, 0X2A6C, 0X32CD, 0X3B2F, 0X3B4F, 0X43D2,
-  0X43D2, 0X4C53, 0X43F2, 0X4370, 0X4391, 0X4BB2, 0X4C34, 0X4CB5,
-  0X54D6, 0X5517, 0X5494, 0X5CF6, 0X5D37, 0X6537, 0X6537, 0X6558,
-  0X6D78, 0X6D78, 0X6D79, 0X6D99, 0X75B9, 0X75DA, 0X75DA, 0X7E1B,
-  0X7E5B, 0X865C, 0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C, 0X7E5C,
-  0X7E1B, 0X7DFB, 0X75DA, 0X7599, 0X6D79, 0X6D58, 0X6518, 0X64F7,
-  0X64B6, 0X5C96, 0X5C75, 0X5435, 0X5414, 0X53F3, 0X4BD3, 0X4BB2,
-  0X4B92, 0X4B72, 0X4350, 0X4330, 0X4310, 0X3ACE, 0X3A8E, 0X326D,
-  0X322C, 0X320B, 0X320B, 0X31EB, 0X320B, 0X320B, 0X29EA, 0X2A4C,
-  0X21A9, 0X2A0B, 0X32AE, 0X29EA, 0X2127, 0X20E6, 0X18C4, 0X18E5,
-  0X1906, 0X1084, 0X1883, 0X10A3, 0X10A3, 0X18A4, 0X20C4, 0X18E4,
-  0X18E4, 0X1904, 0X18E3, 0X18E3, 0X2986, 0X29C7, 0X2166, 0X2986,
-  0X2986, 0X31A6, 0X4249, 0X4A69, 0X4A6A, 0X5B2C, 0X736D, 0X9430,
-  0XCE18, 0XFFBE, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XF7BE, 0XF7BE, 0XF7BE, 0XF79E, 0XF79E, 0XF79E,
-  0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D, 0XEF7D,
-  0XEF7D, 0XF79E, 0XF79E, 0XF79E, 0XF7BE, 0XF7BE, 0XF7BE, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFBF, 0XD6BB,
-  0XA515, 0X8C51, 0X7BEF, 0X6B2C, 0X5289, 0X4208, 0X39E7, 0X31A6,
-  0X2985, 0X2964, 0X2944, 0X2124, 0X2124, 0X2104, 0X21C6, 0X2ACA,
-  0X2A69, 0X21A6, 0X1965, 0X2186, 0X21C6, 0X2165, 0X1945, 0X2166,
-  0X1945, 0X1966, 0X1966, 0X1926, 0X1926, 0X1946, 0X1947, 0X21C9,
-  0X2A4B, 0X2A4B, 0X2A6C, 0X32AD, 0X3AEE, 0X3B2F, 0X3B70, 0X43F2,
-  0X4C74, 0X4C95, 0X4BF2, 0X43B1, 0X4BB2, 0X4BD2, 0X4C54, 0X4C95,
-  0X54F6, 0X54F6, 0X5CF6, 0X6557, 0X6537, 0X6558, 0X6599, 0X6D99,
-  0X6D78, 0X6D78, 0X6D99, 0X6D99, 0X75B9, 0X75DA, 0X75FA, 0X7E1B,
-  0X865B, 0X867C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C, 0X867C,
-  0X7E3B, 0X7E1B, 0X75FA, 0X75B9, 0X6D79, 0X6D58, 0X6D38, 0X6517,
-  0X64D7, 0X5C96, 0X5C76, 0X5C55, 0X5414, 0X53F3, 0X53D3, 0X4BB2,
-  0X4BB2, 0X4B92, 0X4371, 0X4330, 0X4310, 0X3ACF, 0X3AAE, 0X328D,
-  0X324D, 0X322C, 0X322C, 0X320C, 0X320D, 0X29EB, 0X29CA, 0X2A6C,
-  0X2A6D, 0X2A8D, 0X2A6D, 0X29EB, 0X2147, 0X18E6, 0X18E6, 0X1907,
-  0X1906, 0X1083, 0X1063, 0X1084, 0X1884, 0X2105, 0X2125, 0X18E4,
-  0X18E4, 0X18E4, 0X18E4, 0X18C3, 0X2124, 0X2146, 0X2105, 0X2A08,
-  0X29A7, 0X2987, 0X3A49, 0X3A29, 0X4249, 0X5B0C, 0X6B6C, 0X736D,
-  0X8C30, 0XBDB6, 0XF79E, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XF7BE, 0XF7BE,
-  0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE, 0XF7BE,
-  0XF7BE, 0XF7BE, 0XF7BE, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XD6BB, 0XB576,
-  0X8C51, 0X7BCF, 0X6B6D, 0X5B2C, 0X426A, 0X31E7, 0X31A6, 0X2985,
-  0X2986, 0X2965, 0X2123, 0X1903, 0X18E3, 0X18C3, 0X2124, 0X21C5,
-  0X2A69, 0X2229, 0X1965, 0X21A6, 0X21C7, 0X21C6, 0X21A6, 0X21C7,
-  0X2187, 0X1946, 0X1946, 0X1926, 0X1946, 0X1967, 0X1967, 0X21A8,
-  0X220A, 0X2A8C, 0X2AAD, 0X32ED, 0X3B2F, 0X3B70, 0X4390, 0X4390,
-  0X43B1, 0X43F2, 0X43D2, 0X4BD2, 0X4BF3, 0X4C54, 0X5495, 0X5474,
-  0X5D17, 0X5D17, 0X5D37, 0X6557, 0X6537, 0X6578, 0X6DB9, 0X6DB9,
-  0X6D99, 0X6D99, 0X6D99, 0X6DB9, 0X75B9, 0X75BA, 0X7DFA, 0X7E3B,
-  0X865C, 0X867C, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C,
-  0X7E5B, 0X7E1B, 0X761B, 0X75DA, 0X6D99, 0X6D59, 0X6D38, 0X6518,
-  0X64D7, 0X64B6, 0X5C96, 0X5C76, 0X5435, 0X5414, 0X53F3, 0X4BD3,
-  0X4BB3, 0X4B92, 0X4372, 0X4350, 0X4310, 0X3ACF, 0X3AAE, 0X3A8E,
-  0X326D, 0X324D, 0X322C, 0X322C, 0X322D, 0X29EB, 0X29CB, 0X2A4C,
-  0X2AAE, 0X2A2C, 0X2A0B, 0X2A0B, 0X2148, 0X2148, 0X2147, 0X18E6,
-  0X18E5, 0X10A4, 0X1884, 0X18A4, 0X18C4, 0X18E5, 0X1905, 0X18C4,
-  0X18C4, 0X18C4, 0X2125, 0X1905, 0X1904, 0X1925, 0X2145, 0X2A08,
-  0X29C7, 0X29A7, 0X31C7, 0X31C7, 0X41E8, 0X4A49, 0X528A, 0X630C,
-  0X6B8E, 0X8430, 0XBDB6, 0XEF5D, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF, 0XFFDF,
-  0XFFDF, 0XFFDF, 0XFFDF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7BF, 0XD6BB, 0XAD76, 0X94B3,
-  0X83EF, 0X632C, 0X5B0B, 0X5B8D, 0X42AA, 0X31A6, 0X2944, 0X1903,
-  0X1903, 0X2145, 0X1923, 0X18E3, 0X10C2, 0X10C2, 0X18E3, 0X1903,
-  0X2185, 0X2228, 0X2208, 0X1985, 0X21C6, 0X2A28, 0X29E7, 0X29E8,
-  0X21C8, 0X1966, 0X1926, 0X1126, 0X1926, 0X1947, 0X1988, 0X21A8,
-  0X21C9, 0X2A2B, 0X2AAD, 0X32CD, 0X32CD, 0X3B0E, 0X3B2F, 0X3B2F,
-  0X434F, 0X4370, 0X43B1, 0X4C13, 0X4C34, 0X5494, 0X5494, 0X5495,
-  0X5D37, 0X6598, 0X5D57, 0X5CF6, 0X5D17, 0X6558, 0X6578, 0X6598,
-  0X6D99, 0X6D99, 0X6DB9, 0X75B9, 0X75B9, 0X75DA, 0X7DFA, 0X7E3B,
-  0X865C, 0X867C, 0X867C, 0X869C, 0X8EBC, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X869C,
-  0X7E5C, 0X7E3B, 0X7E3B, 0X75FB, 0X75BA, 0X6D79, 0X6D58, 0X6538,
-  0X64F7, 0X64D6, 0X5C96, 0X5C76, 0X5C55, 0X5435, 0X5414, 0X53F4,
-  0X4BD3, 0X4B92, 0X4372, 0X4351, 0X4330, 0X42F0, 0X3ACF, 0X3AAE,
-  0X328E, 0X326D, 0X322D, 0X322D, 0X322C, 0X29CB, 0X29AA, 0X29EB,
-  0X29EB, 0X2189, 0X2169, 0X2A0B, 0X2A0B, 0X2168, 0X2106, 0X2106,
-  0X2126, 0X18C5, 0X1884, 0X10A4, 0X18C4, 0X18A4, 0X18A4, 0X18C4,
-  0X18E4, 0X18C4, 0X1905, 0X2145, 0X18E4, 0X1925, 0X21C7, 0X2165,
-  0X2145, 0X2186, 0X29C7, 0X31E7, 0X31C7, 0X39E8, 0X4208, 0X528A,
-  0X634C, 0X73CE, 0X8BF0, 0XAD34, 0XDEFB, 0XFFDF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XEF7E, 0XC639, 0XA556, 0X9CD3, 0X842F,
-  0X6BAD, 0X52EA, 0X4A48, 0X4228, 0X3A69, 0X3208, 0X2164, 0X18A1,
-  0X10A1, 0X18E2, 0X1904, 0X18E3, 0X1903, 0X1903, 0X1924, 0X1944,
-  0X1964, 0X19A5, 0X2ACB, 0X22AA, 0X21E6, 0X2A27, 0X2A49, 0X2A49,
-  0X21E8, 0X2187, 0X1946, 0X1926, 0X1106, 0X1947, 0X1988, 0X21A8,
-  0X21E9, 0X2A2A, 0X32AD, 0X32EE, 0X3ACE, 0X3B0F, 0X4351, 0X4350,
-  0X4350, 0X4350, 0X4B70, 0X43D2, 0X4C34, 0X5494, 0X5494, 0X54B5,
-  0X5D17, 0X6598, 0X6578, 0X6517, 0X6517, 0X6558, 0X6558, 0X6D78,
-  0X6D99, 0X6DB9, 0X75DA, 0X75DA, 0X75DA, 0X75DA, 0X7DFA, 0X7E3B,
-  0X865C, 0X867C, 0X867C, 0X869C, 0X8EBC, 0X8EDD, 0X8EDD, 0X96FD,
-  0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X869C,
-  0X867C, 0X7E5B, 0X7E3B, 0X761B, 0X75DA, 0X6D99, 0X6D58, 0X6558,
-  0X6518, 0X64D7, 0X64B6, 0X5C76, 0X5C55, 0X5435, 0X5415, 0X5435,
-  0X53F3, 0X4BB2, 0X4B92, 0X4372, 0X4350, 0X4310, 0X42F0, 0X3ACF,
-  0X3ACF, 0X328E, 0X326D, 0X324E, 0X322C, 0X29EB, 0X29CB, 0X29CB,
-  0X29AA, 0X2189, 0X2189, 0X2989, 0X29A9, 0X2147, 0X2106, 0X2106,
-  0X18E6, 0X20C6, 0X1884, 0X1884, 0X18C4, 0X18A4, 0X18A4, 0X18C4,
-  0X18C4, 0X1905, 0X1925, 0X1904, 0X1904, 0X1945, 0X2186, 0X2104,
-  0X2125, 0X21A7, 0X21C7, 0X2165, 0X2965, 0X31A6, 0X39E7, 0X4A49,
-  0X5AAB, 0X632C, 0X6B2C, 0X7BEE, 0X9CD2, 0XCE39, 0XF79E, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XE71C, 0XC618, 0X9D14, 0X8C72, 0X840F, 0X636C,
-  0X530B, 0X4228, 0X39C6, 0X3207, 0X3249, 0X2A69, 0X2A48, 0X2185,
-  0X18E2, 0X1081, 0X18E3, 0X1966, 0X1964, 0X1903, 0X1924, 0X1964,
-  0X2184, 0X2185, 0X2207, 0X332C, 0X2AEB, 0X21E6, 0X2A07, 0X328A,
-  0X2A49, 0X21A7, 0X1946, 0X1946, 0X1926, 0X1926, 0X1968, 0X21A8,
-  0X21EA, 0X2A2B, 0X328C, 0X3AEE, 0X3B50, 0X4370, 0X4391, 0X43B2,
-  0X4391, 0X4371, 0X4B71, 0X4B91, 0X4C13, 0X5495, 0X54B5, 0X5CB5,
-  0X5CD6, 0X6517, 0X6D78, 0X6D98, 0X6DB9, 0X6D99, 0X6578, 0X6558,
-  0X6D78, 0X6D99, 0X75B9, 0X75DA, 0X75FA, 0X7DFA, 0X7E1A, 0X7E3B,
-  0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869D, 0X869C,
-  0X867C, 0X7E5C, 0X7E3C, 0X7E3B, 0X75DA, 0X6D99, 0X6D79, 0X6D79,
-  0X6538, 0X64F8, 0X64D7, 0X5C96, 0X5C75, 0X5435, 0X5414, 0X5435,
-  0X5415, 0X4BB3, 0X4B92, 0X4372, 0X4371, 0X4330, 0X3B10, 0X3B10,
-  0X3ACF, 0X3AAF, 0X3A8E, 0X326E, 0X322D, 0X2A0C, 0X2A0C, 0X29EB,
-  0X29AA, 0X2189, 0X2189, 0X2988, 0X2947, 0X2127, 0X18E6, 0X18E6,
-  0X18C6, 0X18C5, 0X18A5, 0X18A4, 0X18A4, 0X18A4, 0X18A4, 0X18C4,
-  0X18C4, 0X18E4, 0X1925, 0X1904, 0X1904, 0X1966, 0X1986, 0X2145,
-  0X2124, 0X21A7, 0X21C6, 0X18E3, 0X2104, 0X2165, 0X31A6, 0X39E7,
-  0X4208, 0X528A, 0X5AEA, 0X6B6D, 0X7BAE, 0X9472, 0XB5D6, 0XDEFB,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XF79E, 0XD69B, 0XB597, 0X94F3, 0X8C70, 0X73CE, 0X632C, 0X5AAA,
-  0X4228, 0X31E7, 0X31E8, 0X3249, 0X2A07, 0X29C6, 0X29E7, 0X21A5,
-  0X1923, 0X1903, 0X1964, 0X21C6, 0X1945, 0X18C2, 0X18E3, 0X18E3,
-  0X2104, 0X2124, 0X2164, 0X21E6, 0X330D, 0X2AEC, 0X1965, 0X21C7,
-  0X2A4A, 0X21C8, 0X1987, 0X2167, 0X2187, 0X1947, 0X2188, 0X21A9,
-  0X29EA, 0X2A2B, 0X326C, 0X3ACD, 0X3B4F, 0X4370, 0X4350, 0X4391,
-  0X43D2, 0X43B2, 0X4BD2, 0X4BD2, 0X5413, 0X5454, 0X5CD6, 0X5CF6,
-  0X5CF6, 0X6517, 0X6537, 0X6D78, 0X75B9, 0X75FA, 0X6DB9, 0X6D78,
-  0X6D78, 0X6D78, 0X7599, 0X75DA, 0X75FA, 0X7DFA, 0X7E1B, 0X7E3B,
-  0X867C, 0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C,
-  0X869C, 0X7E5C, 0X7E5B, 0X7E3B, 0X75FB, 0X75BA, 0X6D99, 0X6D79,
-  0X6D79, 0X6539, 0X6518, 0X64D7, 0X5C96, 0X5C75, 0X5434, 0X5414,
-  0X5414, 0X4BD3, 0X4B92, 0X4371, 0X4351, 0X4330, 0X3B10, 0X3B10,
-  0X3AF0, 0X3AD0, 0X3AAF, 0X328E, 0X328E, 0X322D, 0X2A0C, 0X29EC,
-  0X29CB, 0X29AA, 0X2189, 0X2168, 0X2168, 0X2127, 0X2106, 0X18E6,
-  0X1907, 0X1906, 0X18C5, 0X18C5, 0X18A4, 0X18A4, 0X18A4, 0X18C5,
-  0X18E5, 0X18E4, 0X18E4, 0X18E4, 0X1945, 0X1966, 0X2165, 0X1945,
-  0X1945, 0X21A5, 0X2165, 0X2165, 0X2145, 0X2986, 0X29C6, 0X2966,
-  0X3185, 0X4207, 0X4A48, 0X5ACB, 0X738E, 0X7BEF, 0X8451, 0X9CF4,
-  0XD679, 0XEF7D, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7BF, 0XDEFC,
-  0XBE19, 0XA576, 0X9CD3, 0X8430, 0X6B8D, 0X5B0B, 0X4A68, 0X4206,
-  0X3A07, 0X3208, 0X3208, 0X3208, 0X2985, 0X2103, 0X18E3, 0X1903,
-  0X2144, 0X21A5, 0X21A4, 0X1923, 0X1924, 0X2145, 0X1903, 0X1903,
-  0X1924, 0X2145, 0X2186, 0X2185, 0X21E7, 0X2AED, 0X2ACD, 0X19C7,
-  0X1987, 0X2209, 0X2209, 0X21C9, 0X21A8, 0X2188, 0X21A8, 0X29C9,
-  0X2A0A, 0X2A4B, 0X324C, 0X3AAD, 0X3AEE, 0X432F, 0X4350, 0X4371,
-  0X4391, 0X43D2, 0X4C13, 0X5434, 0X5413, 0X5433, 0X5CB5, 0X64F6,
-  0X6517, 0X6537, 0X6D38, 0X6D58, 0X6D78, 0X75DA, 0X75FA, 0X75DA,
-  0X6D99, 0X6D99, 0X75B9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C,
-  0X869C, 0X867C, 0X7E5C, 0X7E5C, 0X761B, 0X75DA, 0X6D9A, 0X6D79,
-  0X6D79, 0X6D59, 0X6559, 0X6518, 0X5CD6, 0X5C96, 0X5C55, 0X5434,
-  0X5435, 0X53F3, 0X4BD2, 0X4392, 0X4351, 0X4330, 0X4310, 0X42F0,
-  0X3B10, 0X3B11, 0X3AF0, 0X3ACF, 0X328E, 0X324D, 0X326E, 0X2A4D,
-  0X21EB, 0X21A9, 0X2189, 0X2189, 0X2168, 0X2147, 0X2147, 0X2127,
-  0X2127, 0X2167, 0X1926, 0X18E5, 0X18C5, 0X18C5, 0X18E5, 0X1905,
-  0X1905, 0X1905, 0X18E4, 0X18E4, 0X1945, 0X1904, 0X18E4, 0X1945,
-  0X1985, 0X1944, 0X1924, 0X21A6, 0X21C7, 0X2185, 0X29A6, 0X31E7,
-  0X2965, 0X3186, 0X4208, 0X52AA, 0X5B0B, 0X5AEB, 0X6B6E, 0X8C30,
-  0X9490, 0XAD54, 0XCE59, 0XEF7D, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XF7BF, 0XDEFD, 0XC63A, 0XB597,
-  0X9CF5, 0X8C92, 0X8410, 0X6B6D, 0X5AEB, 0X5248, 0X39C6, 0X3164,
-  0X31A6, 0X29C6, 0X2144, 0X2123, 0X2124, 0X2104, 0X18E3, 0X18E3,
-  0X2144, 0X2185, 0X1924, 0X1903, 0X1903, 0X2186, 0X1945, 0X18E3,
-  0X18E3, 0X1924, 0X2186, 0X21A6, 0X2186, 0X2187, 0X2A8C, 0X2B2F,
-  0X19E9, 0X21C8, 0X220A, 0X2A0A, 0X220A, 0X21A8, 0X21C9, 0X29EA,
-  0X2A0B, 0X324C, 0X326C, 0X3AAD, 0X3AEE, 0X430F, 0X4330, 0X4371,
-  0X4B91, 0X4BB2, 0X4C13, 0X5434, 0X5413, 0X5434, 0X5C95, 0X5CD6,
-  0X64F7, 0X6537, 0X6D58, 0X6D58, 0X6D79, 0X75B9, 0X75B9, 0X75DA,
-  0X75DA, 0X75DA, 0X75D9, 0X75DA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B,
-  0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD,
-  0X869C, 0X867C, 0X7E5C, 0X7E5C, 0X7E3B, 0X75FA, 0X75BA, 0X6D99,
-  0X6D79, 0X6D59, 0X6D59, 0X6518, 0X5CD7, 0X5CB7, 0X5C96, 0X5C96,
-  0X5455, 0X53F3, 0X53D3, 0X4BB2, 0X4B71, 0X4331, 0X4330, 0X4310,
-  0X4310, 0X4331, 0X3B52, 0X3AF0, 0X32AE, 0X32AF, 0X328E, 0X324D,
-  0X2A2C, 0X21CB, 0X21AA, 0X21AA, 0X2989, 0X2189, 0X2148, 0X2127,
-  0X2148, 0X2189, 0X1948, 0X1907, 0X18E5, 0X20E5, 0X2106, 0X1905,
-  0X18E4, 0X18E5, 0X18C4, 0X1904, 0X1925, 0X10E3, 0X18E4, 0X1104,
-  0X1945, 0X1924, 0X1904, 0X1945, 0X21E7, 0X21C6, 0X2125, 0X29C7,
-  0X29C6, 0X31C7, 0X4269, 0X4207, 0X41E6, 0X4227, 0X5ACA, 0X7BAE,
-  0X7BEF, 0X7BEE, 0X9491, 0XAD55, 0XCE7A, 0XDEFC, 0XF79E, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XF7DF, 0XEF7E, 0XD6DC, 0XBE19, 0XAD97, 0X9D35, 0X94B3,
-  0X8451, 0X738E, 0X632C, 0X52CA, 0X4248, 0X39A6, 0X3185, 0X2944,
-  0X2123, 0X2165, 0X1922, 0X18C1, 0X18E3, 0X2124, 0X18C3, 0X10A2,
-  0X2144, 0X2165, 0X18E3, 0X1903, 0X1924, 0X1944, 0X2166, 0X1904,
-  0X18C3, 0X18E4, 0X2165, 0X2186, 0X2187, 0X2166, 0X1966, 0X2A6B,
-  0X2AEE, 0X228B, 0X2A8C, 0X2A8C, 0X2A4B, 0X2A2A, 0X2A0A, 0X2A0A,
-  0X2A2B, 0X324C, 0X328C, 0X3AAD, 0X3AEF, 0X430F, 0X4350, 0X4BB1,
-  0X4BB2, 0X4BD2, 0X4BF3, 0X4C13, 0X5413, 0X5413, 0X5C95, 0X6517,
-  0X6517, 0X6538, 0X6D58, 0X6D78, 0X6D78, 0X7599, 0X75B9, 0X75B9,
-  0X75B9, 0X75FA, 0X761B, 0X75FA, 0X7DFA, 0X7E3B, 0X7E5B, 0X865B,
-  0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X869C, 0X867C, 0X867C, 0X867C, 0X7E3B, 0X75FB, 0X75DA, 0X6D99,
-  0X6D79, 0X6D79, 0X6D59, 0X6518, 0X64D7, 0X5CB7, 0X5CD7, 0X5CD7,
-  0X5495, 0X5414, 0X53D3, 0X53B2, 0X4B92, 0X4351, 0X4330, 0X4330,
-  0X4331, 0X4352, 0X3B51, 0X3B11, 0X3B32, 0X3310, 0X326D, 0X2A2D,
-  0X2A4D, 0X2A2D, 0X21CB, 0X2989, 0X29AA, 0X298A, 0X2189, 0X2169,
-  0X2189, 0X21A9, 0X2168, 0X1927, 0X18E6, 0X1927, 0X2167, 0X18E5,
-  0X18C5, 0X1905, 0X18E4, 0X18C4, 0X1925, 0X1904, 0X18E4, 0X10E3,
-  0X18E3, 0X1904, 0X1904, 0X1924, 0X1904, 0X2165, 0X1945, 0X1945,
-  0X2A08, 0X31C7, 0X31A6, 0X2985, 0X31A5, 0X3985, 0X4A07, 0X630C,
-  0X6BAE, 0X6BAD, 0X73AD, 0X8430, 0X94F4, 0X9D35, 0XBDF8, 0XD6BB,
-  0XE75D, 0XF7DF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFDF, 0XEF9F,
-  0XDF3E, 0XCEBC, 0XBE1A, 0XA577, 0X9D14, 0X94F4, 0X8491, 0X7BEF,
-  0X6B6D, 0X52EB, 0X4A8A, 0X4248, 0X31C6, 0X2985, 0X2964, 0X2123,
-  0X10A2, 0X1923, 0X2144, 0X18C2, 0X18C2, 0X1903, 0X1904, 0X10A2,
-  0X1924, 0X1904, 0X18E3, 0X18E3, 0X2124, 0X2124, 0X2125, 0X2167,
-  0X1946, 0X1925, 0X1945, 0X1945, 0X2166, 0X2187, 0X2166, 0X2146,
-  0X2A6B, 0X3391, 0X332F, 0X2AAC, 0X2A6C, 0X326C, 0X328C, 0X326C,
-  0X326C, 0X328C, 0X328C, 0X328D, 0X3ACE, 0X4330, 0X4371, 0X4BB1,
-  0X4BB2, 0X4BD2, 0X53F3, 0X5413, 0X5434, 0X5434, 0X5C54, 0X64F7,
-  0X6D58, 0X6558, 0X6558, 0X6D78, 0X6D99, 0X75B9, 0X75B9, 0X75B9,
-  0X75B9, 0X75DA, 0X75FA, 0X7E3B, 0X7E3B, 0X7E3B, 0X865B, 0X867C,
-  0X867C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EBD,
-  0X86BD, 0X869C, 0X867C, 0X867C, 0X7E3B, 0X7E1B, 0X75DA, 0X75BA,
-  0X6D9A, 0X6D9A, 0X6D79, 0X6518, 0X64F7, 0X5CD7, 0X5CD7, 0X5CD7,
-  0X5495, 0X5C55, 0X53F3, 0X53D3, 0X4B92, 0X4B71, 0X4B30, 0X4310,
-  0X4352, 0X4372, 0X3B52, 0X3B52, 0X3B31, 0X32CF, 0X328E, 0X326E,
-  0X2A2D, 0X2A2D, 0X29EB, 0X298A, 0X218A, 0X218A, 0X29A9, 0X2189,
-  0X2168, 0X2189, 0X21EB, 0X218A, 0X1948, 0X1948, 0X1927, 0X1906,
-  0X1906, 0X1926, 0X18E4, 0X18E5, 0X1925, 0X1924, 0X10E4, 0X10C3,
-  0X1082, 0X1904, 0X1924, 0X10E3, 0X10C3, 0X18C3, 0X1925, 0X2249,
-  0X2228, 0X2965, 0X2144, 0X2123, 0X2964, 0X3985, 0X4186, 0X4A28,
-  0X52CB, 0X52AA, 0X632C, 0X73AE, 0X7C30, 0X7C71, 0X8471, 0X9CD3,
-  0XAD75, 0XBE17, 0XCE7A, 0XDEFC, 0XEF7E, 0XF7BE, 0XFFDF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFDF, 0XF7BF, 0XEF7E, 0XE73D, 0XD6FC, 0XCEBB, 0XBE5A,
-  0XB5D8, 0XA576, 0X94F4, 0X8CB2, 0X8451, 0X73EF, 0X6B6C, 0X5B0B,
-  0X52CA, 0X4228, 0X39E6, 0X31E7, 0X29C6, 0X2984, 0X2103, 0X18A2,
-  0X18A2, 0X2124, 0X21A6, 0X1903, 0X18C2, 0X1082, 0X18E3, 0X18C3,
-  0X1903, 0X18C2, 0X10A2, 0X18C2, 0X18C3, 0X18E4, 0X18E4, 0X1925,
-  0X1987, 0X1966, 0X1905, 0X18E5, 0X2126, 0X21A7, 0X21A7, 0X2187,
-  0X21A7, 0X2ACD, 0X3B91, 0X2AAD, 0X2A8C, 0X326C, 0X328C, 0X32AD,
-  0X32AD, 0X32CD, 0X32AD, 0X3AAE, 0X3AEE, 0X4330, 0X4371, 0X4B71,
-  0X4B91, 0X4BD2, 0X53F3, 0X5434, 0X5454, 0X5CB6, 0X5CB6, 0X64F7,
-  0X6558, 0X6558, 0X6D78, 0X6D99, 0X75BA, 0X75DA, 0X75D9, 0X75DA,
-  0X75DA, 0X75B9, 0X75DA, 0X7E1B, 0X7E5C, 0X867C, 0X865C, 0X867C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X869D, 0X867C, 0X867C, 0X7E5C, 0X7E1B, 0X7DFB, 0X75DA,
-  0X6DBA, 0X6DBA, 0X6D9A, 0X6D59, 0X64F7, 0X5CD7, 0X6518, 0X5CF7,
-  0X5CB6, 0X5C96, 0X5454, 0X5414, 0X5414, 0X4BB2, 0X4B52, 0X4352,
-  0X43B4, 0X43D4, 0X4393, 0X3B31, 0X32AE, 0X328E, 0X328E, 0X326E,
-  0X322D, 0X324E, 0X2A0C, 0X29CA, 0X21CA, 0X21AA, 0X2989, 0X2189,
-  0X2169, 0X2189, 0X21EB, 0X29EB, 0X2189, 0X1926, 0X18E5, 0X1905,
-  0X1927, 0X1927, 0X1926, 0X1967, 0X1925, 0X18E4, 0X1104, 0X10E3,
-  0X1125, 0X1145, 0X1903, 0X18E3, 0X10C2, 0X10E4, 0X1966, 0X2249,
-  0X19A6, 0X2104, 0X2124, 0X2124, 0X2924, 0X3165, 0X3165, 0X39A6,
-  0X4228, 0X4248, 0X4AAA, 0X5289, 0X632C, 0X73AF, 0X73AE, 0X73AE,
-  0X7BEF, 0X8410, 0X8C92, 0X94F4, 0XAD96, 0XB5D7, 0XBDF8, 0XC659,
-  0XCE7A, 0XD6BB, 0XDEFC, 0XDF3C, 0XDF1C, 0XDEFC, 0XDEFC, 0XD6DB,
-  0XCEBB, 0XC67A, 0XBE19, 0XB5F9, 0XADB7, 0XA556, 0X9534, 0X8D13,
-  0X8C92, 0X8430, 0X7BEE, 0X6B8D, 0X632B, 0X5AEB, 0X4A69, 0X4248,
-  0X4228, 0X31C6, 0X2985, 0X31A6, 0X2985, 0X2123, 0X18C2, 0X18C2,
-  0X18C2, 0X18E3, 0X21A6, 0X2185, 0X1903, 0X18E3, 0X18A2, 0X1903,
-  0X2145, 0X10A2, 0X1082, 0X10A3, 0X10A3, 0X18C3, 0X1904, 0X18E4,
-  0X1926, 0X1987, 0X1925, 0X18E5, 0X1906, 0X2167, 0X21A8, 0X29C9,
-  0X29C8, 0X21C8, 0X3350, 0X33B3, 0X2A6C, 0X324B, 0X326C, 0X32AD,
-  0X32CE, 0X3ACE, 0X3ACE, 0X3AEF, 0X3B0F, 0X4330, 0X4371, 0X4371,
-  0X4B91, 0X4BD2, 0X5413, 0X5454, 0X5434, 0X5C95, 0X5CD6, 0X6517,
-  0X6517, 0X6517, 0X6D78, 0X7599, 0X75B9, 0X75DA, 0X75FA, 0X75FA,
-  0X75FA, 0X75FA, 0X7DFA, 0X7DFA, 0X7E3B, 0X867C, 0X869C, 0X869C,
-  0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X86BD, 0X869C, 0X869C, 0X7E7C, 0X7E3B, 0X7DFB, 0X75FB,
-  0X75DA, 0X6DDA, 0X6DBA, 0X6D79, 0X6538, 0X6518, 0X6518, 0X64F8,
-  0X5CB7, 0X5CB7, 0X5CB6, 0X5495, 0X5496, 0X5455, 0X4C35, 0X4C35,
-  0X4C35, 0X43D3, 0X4331, 0X3ACF, 0X32AF, 0X328E, 0X3A8E, 0X3A6D,
-  0X320C, 0X324D, 0X322D, 0X29EB, 0X29EB, 0X29CB, 0X29AA, 0X2169,
-  0X2989, 0X2189, 0X2189, 0X21A9, 0X2147, 0X1946, 0X1906, 0X1906,
-  0X1947, 0X1927, 0X2106, 0X2166, 0X1946, 0X1925, 0X1986, 0X1965,
-  0X1945, 0X1924, 0X1903, 0X1903, 0X1104, 0X1986, 0X1965, 0X10E3,
-  0X1945, 0X1945, 0X2144, 0X2145, 0X2124, 0X2944, 0X2965, 0X2944,
-  0X31C7, 0X4249, 0X39C6, 0X39C6, 0X4208, 0X528A, 0X5ACB, 0X5AAA,
-  0X5ACA, 0X5B0B, 0X632C, 0X6B8D, 0X73CF, 0X7BD0, 0X7C10, 0X7C51,
-  0X8452, 0X8C92, 0X94D3, 0X94F4, 0X9D14, 0X9D35, 0X9D14, 0X94D3,
-  0X8CB3, 0X8C92, 0X8471, 0X7C71, 0X8451, 0X7C0F, 0X73EF, 0X73EF,
-  0X638D, 0X5AEB, 0X5289, 0X4A28, 0X41E7, 0X39E6, 0X31A6, 0X2985,
-  0X2985, 0X2985, 0X3206, 0X2A06, 0X2144, 0X2123, 0X18E3, 0X18A2,
-  0X18A2, 0X1081, 0X1904, 0X2146, 0X1923, 0X1923, 0X1903, 0X2165,
-  0X2166, 0X10C3, 0X1082, 0X10C3, 0X10C3, 0X10C3, 0X18E4, 0X1905,
-  0X1905, 0X1966, 0X1967, 0X1925, 0X1926, 0X2147, 0X21A8, 0X29E9,
-  0X29E9, 0X21C9, 0X2A8C, 0X3BD3, 0X3350, 0X2A2B, 0X324C, 0X3AAD,
-  0X3AEF, 0X3ACE, 0X3AEE, 0X3B0F, 0X432F, 0X4330, 0X4350, 0X4391,
-  0X4BB2, 0X4BD2, 0X53F3, 0X5434, 0X5434, 0X5454, 0X5CB6, 0X64F7,
-  0X6517, 0X6517, 0X6D58, 0X6D58, 0X6D78, 0X75B9, 0X7DFA, 0X7E1B,
-  0X7E1A, 0X7E1A, 0X7E1B, 0X7E1B, 0X7E3B, 0X865B, 0X869C, 0X86BD,
-  0X8EBC, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X86BD, 0X869D, 0X867C, 0X7E5C, 0X7E3B, 0X761B,
-  0X75FA, 0X75FB, 0X6DDA, 0X6DBA, 0X6D59, 0X6538, 0X6559, 0X6518,
-  0X5CF8, 0X6518, 0X5D18, 0X5D18, 0X5D18, 0X6538, 0X5D18, 0X5475,
-  0X4B92, 0X4351, 0X3AEF, 0X3AAF, 0X3AAF, 0X328E, 0X326E, 0X3A6D,
-  0X322B, 0X322D, 0X3A8F, 0X322D, 0X2A0C, 0X2A0C, 0X29EC, 0X29CA,
-  0X29CA, 0X29A9, 0X2189, 0X21A9, 0X2188, 0X1947, 0X1926, 0X1968,
-  0X1967, 0X18E4, 0X2105, 0X21C8, 0X21E8, 0X21A7, 0X1966, 0X1926,
-  0X18E4, 0X18C4, 0X1905, 0X1986, 0X1965, 0X1904, 0X10C3, 0X10E3,
-  0X1904, 0X2165, 0X2165, 0X2124, 0X2124, 0X2144, 0X2986, 0X2965,
-  0X29E6, 0X31E6, 0X2965, 0X3185, 0X39C7, 0X39E7, 0X3A07, 0X39C6,
-  0X39A6, 0X39C6, 0X41E7, 0X4228, 0X4A8A, 0X52AA, 0X52CB, 0X5AEC,
-  0X632C, 0X632D, 0X6B6E, 0X6B6E, 0X6B8E, 0X7BEF, 0X7C10, 0X73EF,
-  0X632C, 0X632C, 0X5B4D, 0X5B0C, 0X5A8A, 0X52AA, 0X52EB, 0X4AAA,
-  0X4AAA, 0X3A48, 0X3144, 0X20E3, 0X20A2, 0X18A2, 0X18A2, 0X18C2,
-  0X18E3, 0X1903, 0X21E6, 0X2AC8, 0X2184, 0X20E3, 0X18C2, 0X1081,
-  0X1081, 0X10A1, 0X18C3, 0X2146, 0X1904, 0X18E3, 0X1904, 0X2165,
-  0X2145, 0X1924, 0X10E3, 0X10C3, 0X10A3, 0X10C3, 0X1904, 0X1946,
-  0X1946, 0X1905, 0X2187, 0X2187, 0X1926, 0X1947, 0X21A9, 0X2A0A,
-  0X2A0A, 0X21E9, 0X2A4B, 0X32EE, 0X3BB1, 0X330F, 0X2A4C, 0X328D,
-  0X3ACE, 0X3AEF, 0X3AEF, 0X3B0F, 0X4350, 0X4371, 0X4371, 0X4391,
-  0X4BD2, 0X53D2, 0X53F3, 0X5413, 0X5454, 0X5C95, 0X5CD6, 0X6517,
-  0X64F7, 0X6517, 0X6D38, 0X6D58, 0X6D78, 0X7599, 0X7DDA, 0X7E1A,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X86BD, 0X869D, 0X869D, 0X867C, 0X7E3C, 0X7E1B,
-  0X75FB, 0X75FB, 0X75FB, 0X6DBA, 0X6D79, 0X6538, 0X6D7A, 0X6D7A,
-  0X6D7A, 0X659A, 0X65BA, 0X6DDB, 0X65BA, 0X6578, 0X5CD6, 0X4BF3,
-  0X4B71, 0X4350, 0X430F, 0X3ACF, 0X3AAF, 0X32AE, 0X328E, 0X326E,
-  0X328E, 0X326E, 0X326E, 0X324D, 0X322D, 0X2A2C, 0X2A0C, 0X2A0B,
-  0X2A0B, 0X29EB, 0X29AA, 0X29C9, 0X21C9, 0X2147, 0X1947, 0X1968,
-  0X1926, 0X2147, 0X21C9, 0X21E9, 0X2167, 0X2126, 0X1905, 0X1966,
-  0X1966, 0X1146, 0X19A7, 0X19E7, 0X1104, 0X10A2, 0X10C3, 0X18E3,
-  0X1903, 0X1904, 0X2165, 0X2986, 0X2986, 0X2986, 0X3208, 0X29E7,
-  0X2984, 0X2144, 0X2144, 0X2965, 0X2965, 0X2965, 0X31A6, 0X2985,
-  0X20E3, 0X20E2, 0X20E3, 0X2904, 0X3145, 0X3165, 0X39A6, 0X39C7,
-  0X41C7, 0X41E7, 0X3A07, 0X4A89, 0X52EB, 0X5AEB, 0X5B2B, 0X52AA,
-  0X4208, 0X4248, 0X4269, 0X4249, 0X31C7, 0X31E7, 0X3185, 0X2103,
-  0X2144, 0X29C7, 0X2123, 0X1000, 0X0800, 0X1020, 0X1081, 0X1081,
-  0X10A2, 0X18C2, 0X1143, 0X2AEA, 0X2A27, 0X2124, 0X18C2, 0X1060,
-  0X1861, 0X18A2, 0X18A2, 0X2145, 0X1924, 0X18A2, 0X18C3, 0X2124,
-  0X2125, 0X18E4, 0X18C4, 0X10C3, 0X10E4, 0X10E4, 0X1905, 0X1946,
-  0X2146, 0X1947, 0X1967, 0X21E9, 0X1988, 0X1947, 0X2168, 0X2A0A,
-  0X2A2A, 0X29EA, 0X2A4B, 0X32CD, 0X330E, 0X3BD2, 0X330F, 0X328D,
-  0X3ACE, 0X3B0F, 0X3B30, 0X4350, 0X4371, 0X4391, 0X4BB2, 0X4BB2,
-  0X4BD3, 0X53F3, 0X5413, 0X5413, 0X5454, 0X5CD6, 0X6537, 0X6537,
-  0X64F7, 0X6517, 0X6D38, 0X6D79, 0X75B9, 0X75B9, 0X75DA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X865B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X86DD, 0X86BD, 0X869D, 0X869D, 0X7E5C, 0X7E3B,
-  0X761B, 0X761B, 0X75FB, 0X6DBA, 0X6D99, 0X6D7A, 0X6DBB, 0X6DDB,
-  0X6DBA, 0X6DBA, 0X6DFB, 0X6DFB, 0X65BA, 0X5D58, 0X54B5, 0X4BF3,
-  0X4B92, 0X4350, 0X430F, 0X3AAF, 0X3AAF, 0X32AF, 0X32AE, 0X328E,
-  0X3AAE, 0X32AE, 0X324D, 0X324E, 0X2A4D, 0X324D, 0X320C, 0X31EA,
-  0X29AA, 0X29CA, 0X29EB, 0X29C9, 0X2989, 0X2168, 0X2188, 0X2188,
-  0X2168, 0X21CA, 0X21E9, 0X2166, 0X2146, 0X2146, 0X2187, 0X19E8,
-  0X21A7, 0X21A7, 0X21C7, 0X1985, 0X1924, 0X1904, 0X1904, 0X1924,
-  0X2124, 0X2104, 0X2124, 0X29C6, 0X2985, 0X2924, 0X29A5, 0X29C5,
-  0X2123, 0X18E3, 0X1903, 0X2165, 0X2144, 0X2103, 0X2104, 0X2165,
-  0X21A6, 0X2145, 0X18E3, 0X18E3, 0X18E3, 0X2104, 0X2124, 0X20E3,
-  0X2125, 0X2986, 0X2165, 0X31E7, 0X3A28, 0X3208, 0X31C7, 0X2944,
-  0X2124, 0X2944, 0X2124, 0X2145, 0X29A6, 0X29C6, 0X18C2, 0X1020,
-  0X1041, 0X10E3, 0X2164, 0X18C2, 0X0840, 0X0861, 0X10A2, 0X1082,
-  0X10A2, 0X10A1, 0X10E2, 0X2AEA, 0X2289, 0X1144, 0X18C3, 0X1061,
-  0X1861, 0X18A2, 0X10A2, 0X18E4, 0X2145, 0X10C3, 0X18C3, 0X2125,
-  0X2166, 0X1905, 0X10E4, 0X10A3, 0X18E5, 0X1925, 0X1905, 0X1905,
-  0X1926, 0X2167, 0X2188, 0X21C8, 0X220B, 0X21EA, 0X2168, 0X21A9,
-  0X2A2B, 0X2A2B, 0X2A6C, 0X32EE, 0X2AAD, 0X330F, 0X3BD3, 0X3B0F,
-  0X3ACE, 0X3AEE, 0X432F, 0X4371, 0X43B2, 0X43B1, 0X4BD2, 0X4BF3,
-  0X53F3, 0X53F3, 0X5413, 0X5434, 0X5C54, 0X5CB5, 0X6557, 0X6558,
-  0X6537, 0X6D58, 0X6D78, 0X6DB9, 0X75DA, 0X75DA, 0X75DA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X867C, 0X867C, 0X869C, 0X8E9D, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X86DD, 0X86BD, 0X869D, 0X7E7C, 0X7E5C,
-  0X7E3B, 0X761B, 0X75FB, 0X6DFB, 0X6DDA, 0X6DDA, 0X6DFB, 0X6DFB,
-  0X6DDB, 0X6DDA, 0X6DDA, 0X6DFB, 0X6599, 0X5D38, 0X6537, 0X5474,
-  0X4BD2, 0X4B71, 0X4330, 0X3ACF, 0X3ACF, 0X3AAF, 0X3AAF, 0X3A8E,
-  0X328D, 0X326E, 0X326E, 0X32AE, 0X326E, 0X322C, 0X320B, 0X31EB,
-  0X29CA, 0X29A9, 0X29C9, 0X29A9, 0X2968, 0X2168, 0X2168, 0X2147,
-  0X2167, 0X2167, 0X2188, 0X21E8, 0X21E9, 0X2209, 0X2229, 0X2209,
-  0X21A7, 0X21A6, 0X2165, 0X2165, 0X2145, 0X2165, 0X2165, 0X2165,
-  0X2145, 0X1904, 0X2145, 0X2144, 0X2103, 0X20E3, 0X18E3, 0X2165,
-  0X29A6, 0X1903, 0X18C3, 0X2144, 0X2145, 0X2165, 0X29C6, 0X1923,
-  0X1923, 0X2144, 0X1923, 0X1944, 0X1903, 0X18E3, 0X2124, 0X2186,
-  0X2186, 0X1924, 0X18C2, 0X20E4, 0X2124, 0X2104, 0X18E3, 0X18C3,
-  0X18A2, 0X1081, 0X1061, 0X1081, 0X1061, 0X18A2, 0X18E3, 0X0840,
-  0X0800, 0X0840, 0X18E3, 0X21A6, 0X21A6, 0X2164, 0X2145, 0X2165,
-  0X1944, 0X08C1, 0X1103, 0X336C, 0X2ACA, 0X1924, 0X18E3, 0X18A2,
-  0X1061, 0X1061, 0X10A2, 0X10A2, 0X1904, 0X10E3, 0X18C3, 0X2166,
-  0X1986, 0X1925, 0X1905, 0X18E4, 0X18E5, 0X1905, 0X1925, 0X1926,
-  0X1947, 0X1947, 0X1967, 0X2188, 0X21EA, 0X2A6D, 0X220B, 0X21EA,
-  0X2A2C, 0X2A4C, 0X32AD, 0X330E, 0X2AAD, 0X2A4C, 0X3B30, 0X3BB2,
-  0X3310, 0X3B0F, 0X3B30, 0X4371, 0X43B2, 0X4392, 0X4391, 0X4BF3,
-  0X5455, 0X5414, 0X5413, 0X5434, 0X5C75, 0X64D6, 0X6517, 0X6558,
-  0X6D78, 0X6D78, 0X6D99, 0X75B9, 0X75DA, 0X75DA, 0X75FA, 0X7E1B,
-  0X7E1B, 0X865B, 0X867C, 0X869C, 0X86BC, 0X8EBD, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X86BD, 0X869D, 0X869C, 0X7E7C,
-  0X7E3B, 0X75FB, 0X75FB, 0X761B, 0X6DFB, 0X6DDA, 0X6DFB, 0X763C,
-  0X763C, 0X6599, 0X65BA, 0X6DFB, 0X6538, 0X5CF7, 0X6559, 0X5CB6,
-  0X4BF3, 0X4B71, 0X4330, 0X3AEF, 0X3AEF, 0X3ACF, 0X3AAF, 0X328E,
-  0X326D, 0X3A6D, 0X324D, 0X2A4D, 0X324D, 0X2A2B, 0X2A0A, 0X320B,
-  0X31EB, 0X31CA, 0X29A9, 0X2988, 0X2948, 0X2168, 0X2147, 0X2126,
-  0X2126, 0X1947, 0X2168, 0X21C9, 0X220A, 0X21E8, 0X21C8, 0X21C8,
-  0X21C7, 0X2986, 0X2166, 0X2186, 0X2986, 0X2986, 0X29A7, 0X21A6,
-  0X2186, 0X2145, 0X2145, 0X18E3, 0X20C2, 0X20E3, 0X20E2, 0X2103,
-  0X29E7, 0X2185, 0X18A2, 0X18E3, 0X2145, 0X2164, 0X3248, 0X2185,
-  0X0820, 0X1020, 0X1040, 0X18A3, 0X10C2, 0X1060, 0X18A2, 0X18E3,
-  0X18C2, 0X1061, 0X1041, 0X0821, 0X1041, 0X0861, 0X0841, 0X1041,
-  0X1041, 0X0841, 0X0881, 0X10A2, 0X1061, 0X0820, 0X10C3, 0X10E3,
-  0X0040, 0X1061, 0X18E3, 0X2164, 0X1923, 0X1903, 0X18E3, 0X2124,
-  0X1903, 0X10E2, 0X19E6, 0X3C2F, 0X2A89, 0X2104, 0X2124, 0X1966,
-  0X2165, 0X1924, 0X1104, 0X1924, 0X2186, 0X1925, 0X10E4, 0X1966,
-  0X1966, 0X1904, 0X1925, 0X1925, 0X18E5, 0X18E5, 0X1905, 0X1946,
-  0X1947, 0X1967, 0X2168, 0X21A8, 0X21E9, 0X2A4B, 0X2A6C, 0X2A6D,
-  0X2A8D, 0X224B, 0X32CE, 0X32EE, 0X32AD, 0X328D, 0X328D, 0X4372,
-  0X43B3, 0X3B50, 0X4371, 0X43B2, 0X4BD2, 0X4BD3, 0X4BD2, 0X4BF3,
-  0X5434, 0X5454, 0X5C54, 0X5C54, 0X5C95, 0X64F7, 0X6537, 0X6538,
-  0X6D58, 0X6D99, 0X6D99, 0X75BA, 0X75DA, 0X75FA, 0X7E1A, 0X7E3B,
-  0X7E3B, 0X865C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X86BD, 0X869D, 0X869C, 0X7E7C,
-  0X7E3B, 0X761B, 0X761B, 0X761B, 0X75FB, 0X6DFA, 0X6DFB, 0X761B,
-  0X6E3B, 0X65BA, 0X6DBA, 0X6DDB, 0X5CF7, 0X54D6, 0X6559, 0X64F6,
-  0X5434, 0X4BB2, 0X4371, 0X4310, 0X42F0, 0X3AEF, 0X32AF, 0X32AF,
-  0X3A8E, 0X3A8E, 0X324D, 0X2A0C, 0X2A2C, 0X2A4C, 0X2A2C, 0X2A0B,
-  0X31EA, 0X31EA, 0X29CA, 0X29A9, 0X2988, 0X29A9, 0X2988, 0X2167,
-  0X2168, 0X1968, 0X2168, 0X21EA, 0X21EA, 0X2167, 0X2186, 0X2167,
-  0X2167, 0X2986, 0X2166, 0X2986, 0X29A7, 0X2987, 0X29A6, 0X2185,
-  0X1924, 0X2145, 0X2166, 0X1903, 0X18C3, 0X2103, 0X1903, 0X18E3,
-  0X21A6, 0X29E6, 0X10E3, 0X18E4, 0X1903, 0X18A2, 0X2A49, 0X21C6,
-  0X0840, 0X1020, 0X1000, 0X1082, 0X1104, 0X0861, 0X0800, 0X0820,
-  0X0800, 0X0800, 0X0841, 0X0820, 0X0800, 0X0820, 0X0000, 0X0000,
-  0X0000, 0X0020, 0X0820, 0X10C3, 0X10E3, 0X1061, 0X10A2, 0X1945,
-  0X10C2, 0X0020, 0X10A2, 0X1923, 0X10A1, 0X1080, 0X1081, 0X10A2,
-  0X10A2, 0X1080, 0X2A89, 0X342F, 0X2268, 0X21A6, 0X2208, 0X2228,
-  0X2A07, 0X21A6, 0X21C7, 0X19C7, 0X21C8, 0X2A08, 0X21A6, 0X19A7,
-  0X19A7, 0X1925, 0X1905, 0X1905, 0X18E5, 0X1905, 0X1906, 0X1906,
-  0X1926, 0X1927, 0X2168, 0X21C9, 0X222A, 0X2A4B, 0X2A4B, 0X222B,
-  0X2AAC, 0X2AAD, 0X32EE, 0X32CE, 0X32AE, 0X32CE, 0X3AAE, 0X3AEF,
-  0X43D3, 0X43F3, 0X4391, 0X4391, 0X4BD2, 0X4C13, 0X4BF3, 0X4BF3,
-  0X53F3, 0X5414, 0X5C54, 0X5C95, 0X5CD6, 0X5CF7, 0X6537, 0X6D58,
-  0X6558, 0X6D78, 0X6D99, 0X75DA, 0X75FA, 0X75FA, 0X7E1B, 0X7E5B,
-  0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD,
-  0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EDD, 0X8EDD, 0X8EDD, 0X86BD, 0X869C, 0X867C, 0X7E5C,
-  0X7E5B, 0X7E3B, 0X763B, 0X761B, 0X75FA, 0X6DBA, 0X6DDA, 0X6DFA,
-  0X6DDA, 0X6DDA, 0X6DDA, 0X6DDA, 0X5D17, 0X54B6, 0X6518, 0X6517,
-  0X54B6, 0X4C55, 0X4371, 0X4351, 0X4330, 0X4310, 0X3AF0, 0X3ACF,
-  0X3A8E, 0X328E, 0X326E, 0X322D, 0X2A2D, 0X2A4D, 0X2A4D, 0X322C,
-  0X2A0A, 0X29EA, 0X2A0C, 0X29CA, 0X29A9, 0X29A9, 0X29A9, 0X29CA,
-  0X2A0B, 0X21EA, 0X1968, 0X21EB, 0X21EA, 0X2187, 0X2187, 0X2146,
-  0X2146, 0X2146, 0X2966, 0X2966, 0X2966, 0X2966, 0X2104, 0X20E3,
-  0X18C3, 0X2104, 0X2166, 0X2124, 0X2104, 0X2104, 0X18C3, 0X18A3,
-  0X2105, 0X29A6, 0X21C8, 0X1965, 0X1924, 0X2A09, 0X2AEA, 0X1102,
-  0X0840, 0X1040, 0X1041, 0X1082, 0X10C3, 0X10C3, 0X0000, 0X0800,
-  0X0820, 0X0820, 0X0000, 0X0820, 0X0861, 0X0821, 0X0000, 0X0000,
-  0X0000, 0X0000, 0X0821, 0X10A3, 0X10A2, 0X10C2, 0X10C2, 0X10A2,
-  0X18E3, 0X10C3, 0X10C3, 0X1103, 0X0841, 0X0820, 0X0840, 0X0861,
-  0X10C2, 0X10C2, 0X22CB, 0X232B, 0X1985, 0X21A6, 0X21A6, 0X1924,
-  0X1903, 0X18E4, 0X1924, 0X2145, 0X1905, 0X2146, 0X2187, 0X2187,
-  0X19C8, 0X1987, 0X1125, 0X1905, 0X1105, 0X1905, 0X1926, 0X1926,
-  0X1926, 0X1947, 0X2147, 0X21C9, 0X220A, 0X2A2B, 0X2A6C, 0X222B,
-  0X2A0B, 0X32EF, 0X3330, 0X32CE, 0X32AE, 0X3AAE, 0X3AEE, 0X3B0F,
-  0X3B71, 0X4C34, 0X4C54, 0X43F3, 0X4BB2, 0X4BF3, 0X5414, 0X53F3,
-  0X5413, 0X5434, 0X5C54, 0X5C75, 0X5CD6, 0X6517, 0X6558, 0X6D99,
-  0X6D78, 0X6D78, 0X75B9, 0X75DA, 0X75FA, 0X7E1B, 0X7E5C, 0X867C,
-  0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X7E5C,
-  0X7E5B, 0X7E3B, 0X7E3B, 0X761B, 0X75FA, 0X6D99, 0X6DDA, 0X6DDA,
-  0X6579, 0X6DDA, 0X6E1B, 0X6599, 0X5CF7, 0X5CB7, 0X5CB7, 0X6538,
-  0X5D38, 0X5D38, 0X4C13, 0X4371, 0X4351, 0X4330, 0X4331, 0X3AF0,
-  0X3AAE, 0X32AE, 0X328E, 0X2A2D, 0X2A2D, 0X326E, 0X2AAF, 0X32AF,
-  0X322C, 0X322B, 0X3AD0, 0X3B10, 0X29EA, 0X29CA, 0X322C, 0X29EB,
-  0X32AE, 0X2B0F, 0X21E9, 0X21C9, 0X2168, 0X2167, 0X2147, 0X2167,
-  0X2146, 0X2146, 0X2166, 0X2145, 0X2926, 0X2967, 0X2125, 0X18C3,
-  0X20E4, 0X2166, 0X2125, 0X18E3, 0X18E3, 0X1904, 0X18C3, 0X18C3,
-  0X18C3, 0X18E4, 0X2187, 0X1A49, 0X2269, 0X2268, 0X1902, 0X1040,
-  0X1041, 0X1041, 0X0841, 0X0841, 0X0800, 0X1062, 0X10C3, 0X0821,
-  0X0800, 0X0841, 0X1041, 0X0820, 0X0841, 0X0820, 0X0000, 0X0000,
-  0X0841, 0X0862, 0X0883, 0X10C4, 0X10E3, 0X10C2, 0X10A1, 0X0861,
-  0X0820, 0X18C3, 0X2186, 0X10E3, 0X0820, 0X0820, 0X1000, 0X0820,
-  0X1082, 0X10C3, 0X22EA, 0X22C9, 0X10E3, 0X1904, 0X1924, 0X18E3,
-  0X10C3, 0X1904, 0X1904, 0X18C3, 0X1905, 0X2126, 0X1926, 0X10C3,
-  0X1906, 0X19A8, 0X19C8, 0X1967, 0X1906, 0X1947, 0X1947, 0X1947,
-  0X2168, 0X2188, 0X2188, 0X21C9, 0X2A2B, 0X222A, 0X2A8D, 0X2A8E,
-  0X220B, 0X32CE, 0X3B92, 0X3B30, 0X32CE, 0X3AAE, 0X3ACE, 0X3B0F,
-  0X4350, 0X4371, 0X4C14, 0X4CB6, 0X4C75, 0X4C13, 0X4C14, 0X5455,
-  0X5434, 0X5434, 0X5C75, 0X5C95, 0X5CB6, 0X6517, 0X6D99, 0X6DDA,
-  0X6DB9, 0X6D99, 0X75B9, 0X75FA, 0X7E1A, 0X7E5C, 0X867C, 0X869C,
-  0X869C, 0X86BD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X869D, 0X867C, 0X865C,
-  0X7E5B, 0X7E3B, 0X7E1B, 0X761B, 0X75FA, 0X6DDA, 0X6DFA, 0X6DD9,
-  0X6558, 0X6D99, 0X6E3B, 0X6599, 0X5CD7, 0X5CD7, 0X5496, 0X5D38,
-  0X6579, 0X6538, 0X5CB6, 0X4BB2, 0X4B71, 0X4B51, 0X4B52, 0X4330,
-  0X3AEF, 0X32CF, 0X32AF, 0X326E, 0X324D, 0X328F, 0X3352, 0X33D4,
-  0X3331, 0X322B, 0X3B51, 0X44B7, 0X32EF, 0X322B, 0X324C, 0X29EA,
-  0X32CF, 0X3BB1, 0X226B, 0X2188, 0X2126, 0X2147, 0X2147, 0X2146,
-  0X2126, 0X2126, 0X2146, 0X1905, 0X2125, 0X2946, 0X2946, 0X2104,
-  0X20E4, 0X2166, 0X2144, 0X2104, 0X18E4, 0X2104, 0X1904, 0X10C3,
-  0X10A3, 0X18E4, 0X1925, 0X226A, 0X234C, 0X08E2, 0X0800, 0X0861,
-  0X0841, 0X0841, 0X0820, 0X0841, 0X0820, 0X0000, 0X1905, 0X10C4,
-  0X0800, 0X0800, 0X0841, 0X0842, 0X0821, 0X0000, 0X0000, 0X0821,
-  0X0842, 0X0882, 0X08E4, 0X1104, 0X10E3, 0X0000, 0X0000, 0X1061,
-  0X1040, 0X0821, 0X1925, 0X10E3, 0X0840, 0X1040, 0X0841, 0X0841,
-  0X0861, 0X1082, 0X1A27, 0X232A, 0X1945, 0X2104, 0X10C3, 0X10C3,
-  0X18E3, 0X18E4, 0X1925, 0X18E4, 0X18E4, 0X1925, 0X2167, 0X10E4,
-  0X10E5, 0X2147, 0X21E9, 0X2209, 0X1947, 0X2147, 0X2167, 0X1967,
-  0X21A9, 0X21A9, 0X21A9, 0X29C9, 0X2A2B, 0X222B, 0X2A2B, 0X32CE,
-  0X330F, 0X330F, 0X3B50, 0X3B50, 0X3AEE, 0X3AAE, 0X3AEF, 0X3B0F,
-  0X4330, 0X4371, 0X4B92, 0X4C34, 0X5517, 0X5517, 0X5495, 0X5474,
-  0X5475, 0X5455, 0X5C96, 0X5CD6, 0X64F7, 0X6558, 0X6D99, 0X75DA,
-  0X75DA, 0X75DA, 0X75FA, 0X7E1B, 0X7E5B, 0X867C, 0X867C, 0X869C,
-  0X869C, 0X869C, 0X8EBC, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X86BD, 0X869C, 0X867C,
-  0X7E5C, 0X7E3B, 0X7E3B, 0X761B, 0X75FA, 0X75DA, 0X75FA, 0X6DDA,
-  0X6578, 0X6558, 0X6DFA, 0X6599, 0X5CF7, 0X5CD7, 0X5C96, 0X54B6,
-  0X54D7, 0X54D7, 0X5D17, 0X5413, 0X4B92, 0X4B92, 0X4B92, 0X4351,
-  0X3B10, 0X3B10, 0X32CF, 0X328E, 0X326E, 0X32D0, 0X33F5, 0X3C76,
-  0X3C55, 0X328D, 0X3B30, 0X44B7, 0X33F4, 0X2A6C, 0X29EA, 0X2A2B,
-  0X2AAE, 0X3B50, 0X2A6B, 0X1968, 0X2147, 0X2167, 0X2167, 0X2146,
-  0X2126, 0X2126, 0X1925, 0X1905, 0X2105, 0X2125, 0X2966, 0X2966,
-  0X2967, 0X2146, 0X2145, 0X20E4, 0X18A3, 0X18E4, 0X18E4, 0X10C3,
-  0X10A3, 0X18A3, 0X1904, 0X1945, 0X22AA, 0X2289, 0X0881, 0X0861,
-  0X0841, 0X0820, 0X0820, 0X0841, 0X0841, 0X0821, 0X10C3, 0X10E4,
-  0X10A3, 0X0020, 0X0000, 0X0000, 0X0882, 0X0821, 0X0000, 0X0821,
-  0X0000, 0X0001, 0X0883, 0X0862, 0X0821, 0X0800, 0X0000, 0X0000,
-  0X1082, 0X10E4, 0X1125, 0X1986, 0X1082, 0X0800, 0X0841, 0X0882,
-  0X1082, 0X0841, 0X1145, 0X2B2C, 0X19C6, 0X18E3, 0X18A3, 0X1883,
-  0X18A3, 0X10C3, 0X18E4, 0X18E5, 0X18E4, 0X18E5, 0X21A8, 0X2188,
-  0X1926, 0X1947, 0X1946, 0X21A7, 0X21E9, 0X2168, 0X2188, 0X2188,
-  0X2189, 0X21C9, 0X21A9, 0X21A9, 0X29EA, 0X2A2B, 0X2A2B, 0X2A8D,
-  0X3BB2, 0X3370, 0X32EF, 0X3310, 0X3AEF, 0X3AEF, 0X3B10, 0X4330,
-  0X4351, 0X4392, 0X4BB2, 0X4BB2, 0X4C34, 0X5D37, 0X5D78, 0X54B5,
-  0X5495, 0X5CB6, 0X5CB6, 0X64F7, 0X6538, 0X6578, 0X6D99, 0X75BA,
-  0X75DA, 0X75FA, 0X7E3B, 0X7E5C, 0X7E5C, 0X867C, 0X867C, 0X867C,
-  0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EBD, 0X869D, 0X869C,
-  0X867C, 0X7E5B, 0X7E3B, 0X7E1B, 0X75FA, 0X75DA, 0X6DDA, 0X6DB9,
-  0X6D79, 0X6538, 0X6579, 0X6599, 0X6517, 0X5CD7, 0X5CB6, 0X5C75,
-  0X5496, 0X5496, 0X5CF7, 0X5495, 0X4BB3, 0X4BB2, 0X4BB2, 0X4371,
-  0X4351, 0X4372, 0X3B31, 0X32AF, 0X2A8E, 0X3352, 0X3C35, 0X3392,
-  0X4497, 0X3351, 0X3AEF, 0X3C35, 0X3434, 0X32CE, 0X2A0B, 0X3310,
-  0X3351, 0X3330, 0X2A4C, 0X21A8, 0X2167, 0X2167, 0X2167, 0X2167,
-  0X1926, 0X1926, 0X1926, 0X1926, 0X2146, 0X2167, 0X2105, 0X20E5,
-  0X2146, 0X2126, 0X18E4, 0X18A3, 0X18A3, 0X18A3, 0X10A3, 0X18A3,
-  0X1061, 0X1062, 0X10C4, 0X18E4, 0X10C3, 0X2AAB, 0X1A89, 0X08A2,
-  0X0820, 0X0820, 0X0800, 0X1063, 0X1083, 0X1062, 0X0862, 0X0882,
-  0X10E4, 0X10A2, 0X0000, 0X0000, 0X0842, 0X0882, 0X0021, 0X0000,
-  0X0000, 0X0822, 0X0862, 0X0821, 0X0000, 0X0000, 0X0000, 0X0821,
-  0X1082, 0X10C3, 0X10E3, 0X1905, 0X1924, 0X0861, 0X0800, 0X0841,
-  0X1082, 0X1061, 0X1165, 0X232C, 0X11C7, 0X10E3, 0X10C3, 0X1083,
-  0X10A3, 0X10A3, 0X10A3, 0X10A3, 0X18E5, 0X1906, 0X2188, 0X21CA,
-  0X1946, 0X1105, 0X18E5, 0X1905, 0X21A8, 0X2A2A, 0X21E9, 0X2188,
-  0X2189, 0X21A9, 0X29CA, 0X21A9, 0X29EA, 0X2A2B, 0X2A6C, 0X2A6C,
-  0X3B51, 0X3391, 0X3310, 0X3B10, 0X3AEF, 0X3B10, 0X4351, 0X4372,
-  0X4392, 0X4BD3, 0X4BD3, 0X4BD3, 0X53F3, 0X4C54, 0X5D58, 0X6DBA,
-  0X5D17, 0X5CD6, 0X5CD6, 0X64F7, 0X6517, 0X6558, 0X6DDA, 0X75FA,
-  0X75FA, 0X7E3B, 0X7E5C, 0X7E3B, 0X7E5B, 0X867C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X86BD, 0X869C,
-  0X867C, 0X7E7C, 0X7E3B, 0X7E1B, 0X761B, 0X75FA, 0X75FA, 0X6DB9,
-  0X6D58, 0X6D38, 0X6538, 0X6558, 0X6517, 0X64D7, 0X5CD7, 0X5CB6,
-  0X5C96, 0X5475, 0X5476, 0X5D17, 0X4C54, 0X53D3, 0X4BB2, 0X4B71,
-  0X43B3, 0X4455, 0X4455, 0X3B93, 0X328E, 0X3B93, 0X3BF3, 0X32EF,
-  0X4455, 0X3C13, 0X3310, 0X3C14, 0X3C76, 0X332F, 0X2A6D, 0X3B72,
-  0X3B51, 0X330F, 0X2A6C, 0X29CA, 0X2167, 0X2167, 0X2167, 0X2147,
-  0X1926, 0X1926, 0X1926, 0X1926, 0X1926, 0X2147, 0X18E5, 0X18C5,
-  0X18E5, 0X18C4, 0X1883, 0X18A4, 0X18C4, 0X1083, 0X1083, 0X18A3,
-  0X1082, 0X10A3, 0X1904, 0X10C3, 0X1041, 0X10A3, 0X226A, 0X228A,
-  0X10E3, 0X0020, 0X0801, 0X10A4, 0X1104, 0X10A3, 0X0000, 0X0821,
-  0X0842, 0X1062, 0X1882, 0X0000, 0X0000, 0X0842, 0X0883, 0X0000,
-  0X0000, 0X0021, 0X0842, 0X1082, 0X0000, 0X0000, 0X0842, 0X0841,
-  0X0800, 0X0800, 0X1062, 0X1082, 0X1904, 0X1924, 0X0841, 0X0861,
-  0X1082, 0X0861, 0X11A6, 0X2B8E, 0X1A08, 0X10E3, 0X10A3, 0X1083,
-  0X10A3, 0X18C4, 0X10A4, 0X1083, 0X10C4, 0X1906, 0X1906, 0X21C9,
-  0X1988, 0X10E5, 0X1926, 0X1906, 0X1926, 0X2A0A, 0X2A4B, 0X21A9,
-  0X2188, 0X21A9, 0X29EA, 0X2A0B, 0X2A0B, 0X2A2B, 0X326C, 0X32AD,
-  0X32EF, 0X3B92, 0X3B51, 0X3B30, 0X3B0F, 0X3B10, 0X4350, 0X4392,
-  0X4BB2, 0X4BD3, 0X4BF3, 0X5413, 0X5413, 0X5413, 0X5495, 0X65BA,
-  0X6DFA, 0X6578, 0X6558, 0X6558, 0X6558, 0X6DDA, 0X7E5C, 0X765C,
-  0X7E5B, 0X7E5C, 0X7E3B, 0X7E3B, 0X7E5C, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X86BD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X86BD,
-  0X869C, 0X867C, 0X7E5B, 0X7E3B, 0X7E1B, 0X75FA, 0X75FA, 0X75B9,
-  0X6D79, 0X6D58, 0X6D38, 0X6D18, 0X6517, 0X64F7, 0X64D7, 0X64D7,
-  0X5CD6, 0X5C96, 0X5455, 0X5D38, 0X5CF7, 0X4BF3, 0X53F3, 0X4BB2,
-  0X43F4, 0X44B6, 0X4496, 0X4455, 0X3351, 0X3B72, 0X3BD4, 0X32AE,
-  0X43F5, 0X3C76, 0X33D3, 0X3C75, 0X4475, 0X3B70, 0X2A6D, 0X3330,
-  0X32AD, 0X2AAD, 0X2A2C, 0X29A9, 0X2188, 0X2167, 0X1947, 0X1946,
-  0X1926, 0X1906, 0X1926, 0X1905, 0X18E5, 0X18E5, 0X18E6, 0X20C5,
-  0X18C5, 0X18A4, 0X1083, 0X18A4, 0X18C4, 0X1083, 0X18A4, 0X18A4,
-  0X10A4, 0X10C4, 0X18C4, 0X1082, 0X1041, 0X1042, 0X1083, 0X19C7,
-  0X1A69, 0X0964, 0X0842, 0X10E6, 0X08C4, 0X0862, 0X0821, 0X0000,
-  0X0842, 0X0842, 0X10C4, 0X0882, 0X0000, 0X0000, 0X0883, 0X0841,
-  0X0000, 0X0001, 0X0001, 0X0882, 0X0882, 0X0841, 0X0841, 0X0000,
-  0X0800, 0X0000, 0X0800, 0X1083, 0X1062, 0X1925, 0X1104, 0X10A3,
-  0X0882, 0X0041, 0X224A, 0X2B8E, 0X11A7, 0X1105, 0X10C3, 0X10A4,
-  0X18A4, 0X10C4, 0X18C4, 0X10A4, 0X10A4, 0X10C5, 0X18E5, 0X1947,
-  0X21C9, 0X1967, 0X2168, 0X21A8, 0X1988, 0X21C9, 0X2A6C, 0X2A4B,
-  0X2189, 0X2189, 0X29CA, 0X2A2B, 0X2A4C, 0X2A4C, 0X328D, 0X32CE,
-  0X32CE, 0X3B72, 0X43B3, 0X3B50, 0X3B50, 0X4330, 0X4330, 0X4371,
-  0X4BB2, 0X4BD2, 0X4BF3, 0X5414, 0X5434, 0X5475, 0X54D6, 0X6599,
-  0X6E1B, 0X763B, 0X6E1B, 0X761B, 0X763B, 0X765C, 0X7E7C, 0X7E7C,
-  0X7E7C, 0X7E7C, 0X7E5C, 0X7E5B, 0X7E7C, 0X869C, 0X869C, 0X86BD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X869C, 0X869C, 0X867C, 0X7E3B, 0X7E1B, 0X7DFA, 0X75FA, 0X75BA,
-  0X7599, 0X6D79, 0X6D58, 0X6D38, 0X6518, 0X64F7, 0X64F7, 0X6518,
-  0X64F7, 0X5CB6, 0X5455, 0X5CF7, 0X659A, 0X5495, 0X4C14, 0X4BF4,
-  0X43F4, 0X4496, 0X3BD3, 0X43F3, 0X4434, 0X3B93, 0X4414, 0X330F,
-  0X3B73, 0X4498, 0X3CD7, 0X3C54, 0X3BB2, 0X43F3, 0X2AF0, 0X3350,
-  0X32CD, 0X2A4C, 0X21EB, 0X29A9, 0X2188, 0X1947, 0X1947, 0X1947,
-  0X1947, 0X1926, 0X1906, 0X18E5, 0X18E5, 0X20E6, 0X18C5, 0X18A4,
-  0X18C5, 0X18C5, 0X18C4, 0X18E5, 0X10A4, 0X1084, 0X18C5, 0X18C5,
-  0X10C4, 0X1083, 0X1083, 0X10A3, 0X1062, 0X1062, 0X1083, 0X1105,
-  0X22CC, 0X1A69, 0X0925, 0X1104, 0X0862, 0X0001, 0X0821, 0X0821,
-  0X0841, 0X0821, 0X0041, 0X08C3, 0X0000, 0X0000, 0X0862, 0X08C3,
-  0X0041, 0X0842, 0X0000, 0X0000, 0X10A3, 0X10A2, 0X0000, 0X0021,
-  0X0863, 0X0843, 0X1063, 0X10C4, 0X10E4, 0X10E4, 0X1146, 0X1104,
-  0X0862, 0X08C4, 0X2B4D, 0X1AAA, 0X0904, 0X1105, 0X10E5, 0X10A3,
-  0X1083, 0X1063, 0X10A4, 0X18E5, 0X18E5, 0X18C5, 0X1906, 0X1927,
-  0X21C9, 0X21C9, 0X19A9, 0X21E9, 0X21A9, 0X21A8, 0X21EA, 0X2A8C,
-  0X2A4B, 0X21C9, 0X29CA, 0X2A0B, 0X2A4C, 0X328D, 0X32AD, 0X32CE,
-  0X330F, 0X3B92, 0X43D3, 0X3B71, 0X4350, 0X4371, 0X4391, 0X4392,
-  0X4BD2, 0X4BD3, 0X53F3, 0X5434, 0X54D6, 0X5D38, 0X6579, 0X6DDA,
-  0X6D99, 0X6578, 0X6D99, 0X6DDA, 0X761B, 0X761B, 0X761A, 0X7E1B,
-  0X7E1B, 0X7E3B, 0X867C, 0X867C, 0X869C, 0X869C, 0X869D, 0X86BD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X86BD, 0X869C, 0X867C, 0X7E5C, 0X7E3B, 0X7E1B, 0X75FA, 0X75DA,
-  0X75B9, 0X6D99, 0X6D58, 0X6D38, 0X6D38, 0X6517, 0X64F7, 0X6518,
-  0X64F7, 0X5CB6, 0X5C75, 0X5CB7, 0X6DBA, 0X6579, 0X4C96, 0X4C35,
-  0X4BF4, 0X4C96, 0X43F3, 0X4352, 0X4C75, 0X3C34, 0X4454, 0X3B92,
-  0X3B31, 0X4457, 0X3CB7, 0X3BB2, 0X330F, 0X43D3, 0X4435, 0X3B92,
-  0X2ACF, 0X2A2C, 0X21CA, 0X21A9, 0X2188, 0X2168, 0X1947, 0X1947,
-  0X1947, 0X1926, 0X1906, 0X1906, 0X1906, 0X18E5, 0X1885, 0X18A5,
-  0X18E5, 0X18E6, 0X1906, 0X1926, 0X10A4, 0X10A3, 0X10C4, 0X18E5,
-  0X18C4, 0X1083, 0X18C4, 0X18E5, 0X1083, 0X1082, 0X1062, 0X1989,
-  0X2B6F, 0X0986, 0X0925, 0X08E3, 0X0821, 0X0000, 0X0800, 0X0821,
-  0X0842, 0X0021, 0X0000, 0X0863, 0X0883, 0X0000, 0X0062, 0X08E4,
-  0X08A3, 0X0842, 0X0001, 0X0000, 0X0842, 0X0883, 0X10A4, 0X10C4,
-  0X0883, 0X1084, 0X1083, 0X10A4, 0X1105, 0X10C3, 0X1125, 0X1146,
-  0X0883, 0X19A8, 0X2B8E, 0X19C7, 0X10C4, 0X10E5, 0X1906, 0X1905,
-  0X10A4, 0X1083, 0X1064, 0X18C5, 0X2106, 0X2127, 0X1967, 0X1968,
-  0X1989, 0X21EA, 0X19C9, 0X21CA, 0X21A9, 0X2189, 0X21A9, 0X21EB,
-  0X32AD, 0X2A6C, 0X29EA, 0X2A0B, 0X2A4C, 0X326C, 0X32AD, 0X32CE,
-  0X3B50, 0X3B91, 0X3BB2, 0X4392, 0X4330, 0X4351, 0X4392, 0X4BB2,
-  0X4BD3, 0X53F3, 0X5434, 0X5CD6, 0X5D17, 0X5D17, 0X5D17, 0X6579,
-  0X6558, 0X6517, 0X6537, 0X6558, 0X6DDA, 0X75FA, 0X75FA, 0X75FA,
-  0X75FA, 0X7E1A, 0X7E3B, 0X867C, 0X869C, 0X869C, 0X869C, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EFD, 0X8EDD,
-  0X8EBD, 0X869D, 0X867C, 0X867C, 0X7E5C, 0X7E1B, 0X7DFA, 0X75DA,
-  0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6D38, 0X6D18, 0X6517, 0X64F7,
-  0X64F7, 0X64D6, 0X5CB6, 0X5CB7, 0X5D18, 0X6DDA, 0X5D9A, 0X54D7,
-  0X4C14, 0X4CB6, 0X4C95, 0X4331, 0X4BF4, 0X44D6, 0X44B6, 0X3B92,
-  0X3B10, 0X3BD4, 0X3C35, 0X3B71, 0X3AEF, 0X3331, 0X3BD3, 0X3B92,
-  0X2A8E, 0X2A0B, 0X29EA, 0X21A9, 0X2189, 0X2188, 0X2168, 0X2168,
-  0X1947, 0X1926, 0X1926, 0X1906, 0X1926, 0X18C5, 0X18C5, 0X18E6,
-  0X18A5, 0X18C5, 0X18E5, 0X1906, 0X10A4, 0X1083, 0X10A4, 0X1907,
-  0X18E6, 0X1063, 0X18C5, 0X18E5, 0X10A4, 0X1083, 0X1063, 0X10A5,
-  0X226B, 0X234D, 0X11A6, 0X0862, 0X0042, 0X0821, 0X0801, 0X0000,
-  0X0862, 0X0862, 0X0822, 0X0822, 0X08A3, 0X08C4, 0X0042, 0X0882,
-  0X0883, 0X1083, 0X0042, 0X0001, 0X0022, 0X0863, 0X10A3, 0X0842,
-  0X0000, 0X0021, 0X0821, 0X0821, 0X10A4, 0X10C4, 0X10C4, 0X1987,
-  0X10E4, 0X1988, 0X33B0, 0X11E8, 0X10A4, 0X10C5, 0X10E4, 0X1926,
-  0X1926, 0X10C5, 0X1085, 0X1085, 0X18C6, 0X2147, 0X21A9, 0X21C9,
-  0X1988, 0X220B, 0X222C, 0X21AA, 0X21EA, 0X29EA, 0X21CA, 0X21CA,
-  0X2A4C, 0X32CE, 0X324D, 0X320C, 0X324C, 0X326C, 0X328D, 0X32CE,
-  0X3B50, 0X43B2, 0X4391, 0X43B2, 0X4392, 0X4371, 0X4391, 0X4BB2,
-  0X4BD3, 0X5454, 0X5CF7, 0X5CF6, 0X5CD6, 0X5CB6, 0X5CB6, 0X6517,
-  0X6579, 0X6558, 0X6D58, 0X6D99, 0X75DA, 0X75FA, 0X75FA, 0X761B,
-  0X7E1B, 0X7E1B, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X86BD, 0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E1B, 0X7DFA,
-  0X75DA, 0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6D38, 0X6D18, 0X64F7,
-  0X64F7, 0X64F7, 0X64D7, 0X5CB6, 0X5CB6, 0X6539, 0X6DFC, 0X65BB,
-  0X4C96, 0X4CB6, 0X54F7, 0X4392, 0X4372, 0X4CB6, 0X4CD6, 0X3B71,
-  0X3AF0, 0X3B72, 0X3BB3, 0X3310, 0X32AE, 0X32CF, 0X32F0, 0X32EF,
-  0X2A6C, 0X2A0B, 0X2A0B, 0X29EA, 0X21C9, 0X2189, 0X2188, 0X2188,
-  0X2168, 0X1947, 0X1926, 0X1906, 0X1907, 0X1906, 0X1906, 0X18C5,
-  0X1885, 0X18C5, 0X1906, 0X1906, 0X10C5, 0X18E7, 0X1948, 0X1948,
-  0X1126, 0X10E5, 0X1906, 0X18E5, 0X10A4, 0X10C5, 0X0863, 0X0842,
-  0X10E5, 0X2B0D, 0X2AEB, 0X08A3, 0X0842, 0X0822, 0X0801, 0X0001,
-  0X1083, 0X1063, 0X0822, 0X0021, 0X0000, 0X1083, 0X08A4, 0X08A3,
-  0X0862, 0X0863, 0X0862, 0X0822, 0X0884, 0X0883, 0X0822, 0X0021,
-  0X0821, 0X0821, 0X0841, 0X0021, 0X1083, 0X10A4, 0X10A4, 0X1967,
-  0X1987, 0X10E4, 0X2B6F, 0X23B0, 0X1125, 0X08C4, 0X0905, 0X10E5,
-  0X1906, 0X1947, 0X1927, 0X18E6, 0X1927, 0X2188, 0X2189, 0X2188,
-  0X21EA, 0X222C, 0X2A2C, 0X2A0C, 0X21EB, 0X220B, 0X220B, 0X29EA,
-  0X2A2B, 0X2A8D, 0X32EF, 0X328D, 0X326D, 0X328D, 0X32AE, 0X3AEF,
-  0X3B71, 0X43F3, 0X4392, 0X4371, 0X4BD3, 0X4BD3, 0X4BB2, 0X4BD3,
-  0X5413, 0X54D6, 0X5CF7, 0X5495, 0X5C95, 0X5CB6, 0X64B6, 0X64D6,
-  0X6D79, 0X6D99, 0X6D78, 0X6D99, 0X75DA, 0X75FA, 0X75FA, 0X7E1B,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD,
-  0X8EDD, 0X8EFD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EFD,
-  0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X7E5B, 0X7E3B, 0X7E1B,
-  0X7DFA, 0X75DA, 0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6D38, 0X6D18,
-  0X6518, 0X64F7, 0X64D7, 0X64B6, 0X5C96, 0X5CB7, 0X6539, 0X5D9A,
-  0X5D79, 0X5D79, 0X5D58, 0X43F4, 0X4B93, 0X4BF4, 0X43F4, 0X4372,
-  0X3B51, 0X3B31, 0X3B51, 0X330F, 0X32AE, 0X328E, 0X32AE, 0X328D,
-  0X2A4C, 0X2A2B, 0X2A0B, 0X2A0B, 0X29CA, 0X29AA, 0X29A9, 0X21A9,
-  0X21A9, 0X1988, 0X1947, 0X1948, 0X2168, 0X2148, 0X1906, 0X18E5,
-  0X18C5, 0X20E6, 0X1947, 0X1947, 0X1948, 0X1989, 0X1147, 0X1106,
-  0X1988, 0X1968, 0X1927, 0X18E5, 0X10A4, 0X10A4, 0X1043, 0X1023,
-  0X0863, 0X1925, 0X2A49, 0X1165, 0X0883, 0X0863, 0X08C5, 0X1106,
-  0X0883, 0X0021, 0X0021, 0X0000, 0X0000, 0X0822, 0X1105, 0X08C4,
-  0X0863, 0X0863, 0X0863, 0X0022, 0X0864, 0X1084, 0X0863, 0X0022,
-  0X0842, 0X0842, 0X0842, 0X0863, 0X10A5, 0X1084, 0X10A4, 0X1106,
-  0X19A8, 0X1125, 0X1967, 0X2B4F, 0X238F, 0X234E, 0X234E, 0X226C,
-  0X1947, 0X1967, 0X2188, 0X1948, 0X2168, 0X2189, 0X2168, 0X2168,
-  0X29EB, 0X2A0C, 0X21EB, 0X222C, 0X2A4C, 0X2A6C, 0X2A4C, 0X2A0B,
-  0X2A2C, 0X2A6D, 0X32EE, 0X3B2F, 0X32CE, 0X328E, 0X3ACE, 0X3B0F,
-  0X4391, 0X43F3, 0X43B2, 0X4371, 0X4BB3, 0X4BF4, 0X4BF3, 0X53F3,
-  0X5495, 0X5D17, 0X5C95, 0X5C75, 0X5CB6, 0X64D6, 0X64D6, 0X64F7,
-  0X6D58, 0X6DBA, 0X6DB9, 0X75DA, 0X75FA, 0X75FA, 0X75FA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X865C, 0X867C, 0X867C, 0X869C, 0X8EBD, 0X8EBD,
-  0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E1B,
-  0X7DFB, 0X75DA, 0X75DA, 0X75B9, 0X7579, 0X6D79, 0X6D58, 0X6D38,
-  0X6D38, 0X6538, 0X64F7, 0X64B6, 0X5C96, 0X5C96, 0X5CD7, 0X54D8,
-  0X5D38, 0X65FB, 0X5D59, 0X4C35, 0X4BD3, 0X4392, 0X4392, 0X4372,
-  0X3B51, 0X3B11, 0X3B30, 0X3B30, 0X32CE, 0X32AE, 0X32AE, 0X326D,
-  0X324C, 0X2A2C, 0X2A0C, 0X2A0C, 0X2A0B, 0X29EA, 0X29EA, 0X29EA,
-  0X21C9, 0X21A9, 0X21A9, 0X21A9, 0X2168, 0X2127, 0X2107, 0X1906,
-  0X18E6, 0X18E6, 0X1907, 0X2189, 0X21A9, 0X1946, 0X1126, 0X1927,
-  0X2148, 0X1927, 0X1906, 0X10C5, 0X1084, 0X1063, 0X1083, 0X1043,
-  0X1023, 0X1043, 0X1946, 0X19A6, 0X1125, 0X08C5, 0X08C4, 0X1127,
-  0X1126, 0X0062, 0X0001, 0X0843, 0X0885, 0X0884, 0X1188, 0X1188,
-  0X08C4, 0X0884, 0X0863, 0X0822, 0X0823, 0X1064, 0X10A4, 0X08A4,
-  0X0863, 0X0843, 0X0863, 0X10A5, 0X10A4, 0X1064, 0X1084, 0X10A4,
-  0X2188, 0X21A8, 0X10C4, 0X1946, 0X22AC, 0X22ED, 0X22CC, 0X2B8F,
-  0X22ED, 0X19A9, 0X2148, 0X2168, 0X2168, 0X2189, 0X21A9, 0X21CA,
-  0X2A2C, 0X29EB, 0X21CA, 0X21EB, 0X2A4C, 0X2A8D, 0X32AE, 0X32AE,
-  0X2A8D, 0X328D, 0X328D, 0X3B0F, 0X3B30, 0X32CE, 0X3ACE, 0X3B30,
-  0X43B2, 0X43F3, 0X4BD2, 0X4B92, 0X4BB2, 0X4C14, 0X5414, 0X5454,
-  0X5CF7, 0X5CD6, 0X5C75, 0X5C95, 0X5CB6, 0X64D7, 0X64F7, 0X6517,
-  0X6D58, 0X75DA, 0X6DDA, 0X75FA, 0X75FA, 0X7DFA, 0X7E1A, 0X7E1B,
-  0X7E3B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X8EFD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X865C, 0X7E3B,
-  0X7E1B, 0X7DFA, 0X75DA, 0X75BA, 0X7599, 0X6D79, 0X6D58, 0X6D38,
-  0X6D38, 0X6538, 0X6517, 0X64D7, 0X64B6, 0X5CB6, 0X5CD7, 0X5CB7,
-  0X54D7, 0X5D38, 0X54F8, 0X4C35, 0X4BD3, 0X4BB2, 0X4392, 0X4351,
-  0X3B51, 0X4331, 0X3B10, 0X3B10, 0X3ACF, 0X32AE, 0X3ACE, 0X328D,
-  0X326D, 0X324C, 0X322D, 0X324C, 0X322C, 0X322B, 0X322B, 0X2A0A,
-  0X29EA, 0X29EA, 0X29EB, 0X21C9, 0X1927, 0X1907, 0X1907, 0X18E6,
-  0X18C6, 0X18C5, 0X2148, 0X220B, 0X1988, 0X1106, 0X1907, 0X2168,
-  0X1927, 0X18E5, 0X1906, 0X10E5, 0X1084, 0X1064, 0X1064, 0X1084,
-  0X1064, 0X1084, 0X18E5, 0X2187, 0X19E7, 0X1125, 0X0822, 0X08A4,
-  0X1167, 0X0905, 0X1107, 0X1107, 0X10A4, 0X0883, 0X1106, 0X1A0A,
-  0X1167, 0X08C5, 0X10A5, 0X0864, 0X0863, 0X1084, 0X10E6, 0X1967,
-  0X10C5, 0X0843, 0X0864, 0X10A4, 0X1084, 0X1064, 0X1084, 0X10A5,
-  0X1906, 0X21E9, 0X1947, 0X1906, 0X1127, 0X1126, 0X1106, 0X222A,
-  0X33B0, 0X1A4B, 0X1948, 0X2168, 0X2189, 0X2189, 0X21EA, 0X21EA,
-  0X21EB, 0X2A0B, 0X29EB, 0X2A0B, 0X2A2B, 0X2A4C, 0X2A8D, 0X32AE,
-  0X32CF, 0X32CE, 0X32AE, 0X32CE, 0X4371, 0X4351, 0X3B0F, 0X4350,
-  0X43F3, 0X4C13, 0X4BF3, 0X4BD2, 0X4BB2, 0X4BF3, 0X5496, 0X5D17,
-  0X5CD6, 0X5C75, 0X5C95, 0X5CB6, 0X64D6, 0X64F7, 0X6518, 0X6538,
-  0X6D99, 0X75FA, 0X75FA, 0X75DA, 0X75FA, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X7E3B, 0X865C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD,
-  0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X863B,
-  0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75B9, 0X7599, 0X6D79, 0X6D58,
-  0X6D38, 0X6D38, 0X6518, 0X64F7, 0X64D7, 0X64F8, 0X64F8, 0X5CB7,
-  0X5CD7, 0X5CF7, 0X54D7, 0X5434, 0X53D3, 0X4BD3, 0X4BB2, 0X4372,
-  0X4351, 0X4330, 0X4310, 0X3B30, 0X3AF0, 0X3ACF, 0X3ACE, 0X3AAE,
-  0X328D, 0X326D, 0X326D, 0X326D, 0X326C, 0X324C, 0X2A2C, 0X2A0B,
-  0X29EB, 0X29EA, 0X29EB, 0X21A9, 0X1927, 0X1927, 0X1907, 0X2107,
-  0X18E6, 0X18E6, 0X1969, 0X21CA, 0X1968, 0X1927, 0X2128, 0X1928,
-  0X1927, 0X18E6, 0X1906, 0X10E5, 0X10A4, 0X1084, 0X18A5, 0X18E5,
-  0X10C5, 0X10C5, 0X10C5, 0X1126, 0X2AAA, 0X19C7, 0X0863, 0X08C5,
-  0X08C4, 0X10A4, 0X19A8, 0X1167, 0X10A4, 0X1083, 0X0884, 0X1188,
-  0X11C9, 0X1127, 0X08C5, 0X10C5, 0X10A5, 0X10E6, 0X1106, 0X1167,
-  0X1947, 0X1085, 0X1084, 0X10A5, 0X1906, 0X10E6, 0X0884, 0X10A5,
-  0X18E6, 0X21C9, 0X21C9, 0X1906, 0X1947, 0X1947, 0X1926, 0X19EA,
-  0X33B1, 0X22ED, 0X19A9, 0X1948, 0X2169, 0X21A9, 0X21CA, 0X29CA,
-  0X29EB, 0X2A0B, 0X2A0B, 0X2A2C, 0X2A4C, 0X2A4C, 0X326D, 0X328D,
-  0X32AE, 0X3B10, 0X3B0F, 0X3AEE, 0X3B50, 0X43D2, 0X4371, 0X4371,
-  0X4C13, 0X4C54, 0X4C13, 0X4BD3, 0X4BF3, 0X54B6, 0X5D99, 0X5517,
-  0X5475, 0X5C75, 0X5CB6, 0X64D6, 0X64F7, 0X6538, 0X6D38, 0X6D78,
-  0X6DBA, 0X75FA, 0X761B, 0X75FA, 0X75FA, 0X7E1B, 0X7E3B, 0X7E5B,
-  0X865C, 0X867C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EFD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X865C,
-  0X863B, 0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75B9, 0X7599, 0X6D78,
-  0X6D58, 0X6D58, 0X6D38, 0X6517, 0X6517, 0X6539, 0X6539, 0X5CF7,
-  0X5CB6, 0X5CB7, 0X5496, 0X5434, 0X5414, 0X53F3, 0X4BB2, 0X4B92,
-  0X4371, 0X4351, 0X4330, 0X4330, 0X3B10, 0X3AEF, 0X3ACF, 0X3AAE,
-  0X328E, 0X3A8E, 0X328D, 0X328E, 0X328D, 0X326D, 0X2A2C, 0X2A0B,
-  0X29CA, 0X29CA, 0X21CA, 0X21AA, 0X2169, 0X2168, 0X2148, 0X2128,
-  0X18E7, 0X1907, 0X21AB, 0X2189, 0X1948, 0X2148, 0X2168, 0X1948,
-  0X1928, 0X1927, 0X1927, 0X18E6, 0X10A4, 0X1084, 0X18C5, 0X1906,
-  0X10A4, 0X10A4, 0X10C5, 0X10E6, 0X2AAC, 0X22EA, 0X0925, 0X1106,
-  0X10E5, 0X08A5, 0X1106, 0X1926, 0X1906, 0X1105, 0X10E6, 0X1988,
-  0X11C9, 0X11A9, 0X1106, 0X1085, 0X1085, 0X1106, 0X10E6, 0X10A5,
-  0X1906, 0X1927, 0X18E6, 0X10E6, 0X1106, 0X1906, 0X1907, 0X1907,
-  0X1948, 0X21CA, 0X220A, 0X1947, 0X1926, 0X1947, 0X1927, 0X226C,
-  0X33F2, 0X22CD, 0X220B, 0X21CA, 0X2189, 0X21AA, 0X29CA, 0X29EB,
-  0X2A0B, 0X2A2C, 0X2A2C, 0X2A2C, 0X326D, 0X328D, 0X32AE, 0X3ACE,
-  0X3AEF, 0X3B30, 0X3B71, 0X4351, 0X3B30, 0X43B1, 0X4BF3, 0X43F3,
-  0X4C95, 0X54F6, 0X54D6, 0X54B5, 0X54F7, 0X5D17, 0X5CF7, 0X54D6,
-  0X5C96, 0X64B6, 0X64D6, 0X64F7, 0X6517, 0X6538, 0X6D58, 0X6D99,
-  0X75DA, 0X75DA, 0X761B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E5B,
-  0X867C, 0X869C, 0X86BD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X867C,
-  0X865C, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DFA, 0X75DA, 0X75B9, 0X7599,
-  0X6D78, 0X6D59, 0X6D58, 0X6D38, 0X6D38, 0X6559, 0X6518, 0X64D7,
-  0X5CB6, 0X5C96, 0X5C96, 0X5C55, 0X5414, 0X53F4, 0X53D3, 0X4BB2,
-  0X4B91, 0X4371, 0X4351, 0X4331, 0X4310, 0X3B0F, 0X3AEF, 0X3AAE,
-  0X32AE, 0X3ACE, 0X3AAE, 0X3AAE, 0X32AE, 0X326D, 0X2A4D, 0X2A0C,
-  0X21CA, 0X21CA, 0X21CB, 0X21CB, 0X21CA, 0X2189, 0X2169, 0X2169,
-  0X1928, 0X2149, 0X21EC, 0X21AA, 0X2189, 0X1948, 0X1928, 0X218A,
-  0X21CA, 0X1967, 0X1947, 0X1906, 0X18C5, 0X1084, 0X10A5, 0X18E6,
-  0X18C5, 0X18A5, 0X10E5, 0X1948, 0X222C, 0X22EB, 0X1A08, 0X1967,
-  0X1926, 0X1126, 0X1147, 0X1106, 0X10C5, 0X18E5, 0X10E5, 0X1988,
-  0X1968, 0X1988, 0X1968, 0X08A5, 0X0884, 0X18E6, 0X10E6, 0X10A5,
-  0X10A5, 0X1907, 0X2189, 0X1968, 0X10E6, 0X1107, 0X2189, 0X21CA,
-  0X1989, 0X21CA, 0X2A4C, 0X21A9, 0X1926, 0X2148, 0X1968, 0X2ACE,
-  0X33F2, 0X226C, 0X222B, 0X220B, 0X29EA, 0X29EB, 0X2A0B, 0X2A2C,
-  0X2A2C, 0X2A4D, 0X2A4D, 0X326D, 0X328E, 0X328E, 0X32AE, 0X3B0F,
-  0X3B0F, 0X3B0F, 0X3B51, 0X4392, 0X4391, 0X43B2, 0X4C13, 0X4C74,
-  0X4C95, 0X5516, 0X54F6, 0X54D6, 0X54B5, 0X5454, 0X5455, 0X5CB6,
-  0X5CB6, 0X64B6, 0X64F7, 0X6517, 0X6538, 0X6D79, 0X6DB9, 0X75DA,
-  0X75DA, 0X75DA, 0X75FA, 0X7E3B, 0X7E5C, 0X7E3B, 0X7E3B, 0X865B,
-  0X867C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C,
-  0X867C, 0X865C, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DDA, 0X75BA, 0X75B9,
-  0X7599, 0X7579, 0X6D79, 0X6D59, 0X6D59, 0X6538, 0X6518, 0X64D7,
-  0X64D7, 0X5CB6, 0X5C96, 0X5C75, 0X5C35, 0X5414, 0X53F3, 0X4BD3,
-  0X4BB2, 0X4B91, 0X4371, 0X4351, 0X4330, 0X4330, 0X3B0F, 0X3AEF,
-  0X3ACF, 0X3AEF, 0X3AEF, 0X3ACF, 0X32AE, 0X326E, 0X2A2D, 0X2A0C,
-  0X29EB, 0X21CB, 0X29EB, 0X21EB, 0X21EB, 0X21A9, 0X2169, 0X2189,
-  0X218A, 0X21EC, 0X21AA, 0X2189, 0X21CA, 0X2189, 0X2148, 0X1969,
-  0X19A9, 0X21A9, 0X1947, 0X1907, 0X1907, 0X18E6, 0X1906, 0X2147,
-  0X1927, 0X1927, 0X1928, 0X21A9, 0X224C, 0X22CD, 0X1A4A, 0X21A8,
-  0X1927, 0X1926, 0X1968, 0X1968, 0X10E5, 0X10A5, 0X10A4, 0X1106,
-  0X1968, 0X19A9, 0X19C9, 0X1926, 0X10E5, 0X1906, 0X1947, 0X1106,
-  0X18E6, 0X1927, 0X1948, 0X21A9, 0X1968, 0X1948, 0X21A9, 0X21A9,
-  0X21A9, 0X19C9, 0X222B, 0X2A2B, 0X1968, 0X1968, 0X21CA, 0X33B2,
-  0X33B1, 0X224B, 0X2A0B, 0X29EA, 0X29EB, 0X2A2C, 0X2A6D, 0X326D,
-  0X326D, 0X326D, 0X2A8E, 0X32CE, 0X3AEF, 0X32CF, 0X32EF, 0X3B30,
-  0X3B30, 0X3B0F, 0X4330, 0X4371, 0X4391, 0X4BD2, 0X4C34, 0X4C13,
-  0X4C13, 0X54B5, 0X54B5, 0X5475, 0X5475, 0X5475, 0X5C75, 0X5CB6,
-  0X64D6, 0X64D6, 0X64F7, 0X6517, 0X6D58, 0X6DB9, 0X75DA, 0X75DA,
-  0X75DA, 0X75FA, 0X75FA, 0X7E1B, 0X7E5C, 0X867C, 0X867C, 0X867C,
-  0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C,
-  0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E1B, 0X7DFA, 0X75FA, 0X75DA,
-  0X7599, 0X7599, 0X6DBA, 0X6D99, 0X6D38, 0X6D38, 0X6D18, 0X64F7,
-  0X64D7, 0X64B6, 0X64B6, 0X5C96, 0X5C75, 0X5435, 0X5414, 0X53F3,
-  0X4BD3, 0X4BB2, 0X4B92, 0X4371, 0X4351, 0X4330, 0X4330, 0X3B30,
-  0X3B10, 0X3B10, 0X3B10, 0X3B10, 0X3ACF, 0X328E, 0X2A4D, 0X2A2C,
-  0X2A2C, 0X29EB, 0X2A0C, 0X2A0C, 0X220B, 0X29CA, 0X218A, 0X2169,
-  0X29EC, 0X2A2D, 0X2189, 0X2189, 0X21CA, 0X2189, 0X2148, 0X218A,
-  0X1969, 0X21A9, 0X2188, 0X1927, 0X1947, 0X1947, 0X2127, 0X2148,
-  0X2168, 0X2189, 0X2189, 0X21CA, 0X2AEE, 0X2BB0, 0X1A6A, 0X19C9,
-  0X1927, 0X1927, 0X1947, 0X1988, 0X1967, 0X1906, 0X10E6, 0X10E6,
-  0X1988, 0X19CA, 0X220B, 0X1989, 0X1907, 0X2148, 0X2168, 0X1927,
-  0X1927, 0X1969, 0X1989, 0X21A9, 0X21A9, 0X1948, 0X1968, 0X2168,
-  0X2188, 0X2188, 0X21A9, 0X2A6C, 0X220A, 0X19A9, 0X330F, 0X3C54,
-  0X2B2F, 0X226C, 0X2A2C, 0X29EB, 0X29EB, 0X2A2C, 0X326D, 0X32AE,
-  0X328D, 0X326D, 0X32CF, 0X32CF, 0X3AEF, 0X3B30, 0X3B30, 0X3B30,
-  0X3B30, 0X4330, 0X4371, 0X4391, 0X4392, 0X4BD2, 0X4C54, 0X4C13,
-  0X5413, 0X5495, 0X54B5, 0X5475, 0X5C95, 0X5C96, 0X5C96, 0X64D6,
-  0X64F7, 0X6518, 0X6558, 0X6D78, 0X6D99, 0X6DB9, 0X6DB9, 0X75DA,
-  0X75FA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E3B, 0X867C, 0X869C, 0X869D,
-  0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X869C, 0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DFA,
-  0X75DA, 0X75BA, 0X75DA, 0X7599, 0X6D58, 0X6D58, 0X6D38, 0X6CF7,
-  0X64F7, 0X64D7, 0X64B6, 0X64B6, 0X5C96, 0X5C75, 0X5434, 0X5414,
-  0X53F4, 0X4BD3, 0X4BB2, 0X4392, 0X4371, 0X4351, 0X4351, 0X4351,
-  0X4351, 0X4331, 0X4331, 0X3B30, 0X3B10, 0X32CF, 0X328E, 0X326E,
-  0X2A4D, 0X2A2C, 0X2A2D, 0X2A2D, 0X2A2C, 0X29EB, 0X29CA, 0X29AA,
-  0X2A2C, 0X21EB, 0X21AA, 0X21CA, 0X21CA, 0X2189, 0X1948, 0X218A,
-  0X19AA, 0X21CA, 0X19A9, 0X2168, 0X2148, 0X2128, 0X2127, 0X1927,
-  0X2148, 0X21A9, 0X21CA, 0X2A2C, 0X2A6C, 0X336F, 0X2B2D, 0X222A,
-  0X1988, 0X1948, 0X1968, 0X1947, 0X1968, 0X1968, 0X1988, 0X1148,
-  0X19AA, 0X220B, 0X1A0B, 0X220A, 0X2189, 0X2168, 0X1948, 0X1927,
-  0X1106, 0X1948, 0X1989, 0X21CA, 0X21CA, 0X1988, 0X2168, 0X2168,
-  0X2189, 0X21A9, 0X21A9, 0X2A8C, 0X226C, 0X224C, 0X3BF2, 0X3B90,
-  0X2A8C, 0X2A8D, 0X2A8D, 0X2A2C, 0X2A2C, 0X2A6D, 0X328D, 0X32AE,
-  0X3B10, 0X32EF, 0X32AE, 0X3B10, 0X3B10, 0X3B30, 0X3B10, 0X3AF0,
-  0X4310, 0X4350, 0X4391, 0X43B2, 0X4BD3, 0X4C14, 0X5454, 0X4C14,
-  0X5454, 0X54B6, 0X5495, 0X5C75, 0X5C96, 0X5CD6, 0X64F7, 0X64F7,
-  0X64F7, 0X6558, 0X6D79, 0X6D78, 0X6D99, 0X75B9, 0X75DA, 0X75FA,
-  0X7DFA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X869C, 0X86BD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X869D, 0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E1B, 0X7E1B,
-  0X7DFB, 0X75FA, 0X75FA, 0X75BA, 0X7579, 0X6D58, 0X6D59, 0X6D38,
-  0X6D17, 0X64F7, 0X64D7, 0X64D6, 0X64B6, 0X5C95, 0X5C55, 0X5434,
-  0X5434, 0X53F3, 0X4BD3, 0X4BB2, 0X4BB2, 0X4392, 0X4392, 0X4371,
-  0X4351, 0X4371, 0X4351, 0X4331, 0X3B10, 0X32CF, 0X32AF, 0X328E,
-  0X326E, 0X2A6E, 0X328E, 0X32AF, 0X2A6D, 0X2A0C, 0X29EB, 0X2A2D,
-  0X2A2D, 0X29EA, 0X21CB, 0X2A0C, 0X29EB, 0X21AA, 0X2189, 0X218A,
-  0X220C, 0X2A4C, 0X21AA, 0X2169, 0X2169, 0X2169, 0X2169, 0X2169,
-  0X2168, 0X2148, 0X218A, 0X2A4C, 0X21CA, 0X2A0B, 0X336F, 0X2B4E,
-  0X222A, 0X21A9, 0X2168, 0X1947, 0X1948, 0X1948, 0X2189, 0X21C9,
-  0X21EB, 0X228D, 0X224C, 0X220B, 0X220A, 0X1988, 0X1948, 0X1968,
-  0X1968, 0X1968, 0X1948, 0X21A9, 0X21CA, 0X2189, 0X2169, 0X2189,
-  0X21A9, 0X21AA, 0X21CA, 0X2AAD, 0X2AAD, 0X2AEE, 0X3432, 0X2AEE,
-  0X2A4C, 0X328D, 0X328D, 0X2A6D, 0X326D, 0X328E, 0X328E, 0X32AF,
-  0X3B30, 0X3B30, 0X3B10, 0X3B51, 0X3B51, 0X4330, 0X4310, 0X4310,
-  0X4330, 0X4351, 0X4B92, 0X4BD2, 0X4BD3, 0X5434, 0X5475, 0X5434,
-  0X5475, 0X5CD6, 0X5CB6, 0X5C95, 0X5CB6, 0X64D6, 0X64F7, 0X6558,
-  0X6579, 0X6D78, 0X6D58, 0X6D78, 0X7599, 0X75BA, 0X75FA, 0X7DFA,
-  0X7DFA, 0X7E1B, 0X7E1B, 0X863B, 0X865C, 0X867C, 0X869C, 0X8EBC,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EBD, 0X8EBD, 0X869D, 0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X75FB, 0X75DA, 0X75BA, 0X7579, 0X6D79, 0X6D58,
-  0X6D38, 0X6D17, 0X64F7, 0X64D7, 0X64D6, 0X64B6, 0X5C96, 0X5C75,
-  0X5C54, 0X5434, 0X5413, 0X4BD3, 0X4BD3, 0X4BB3, 0X4BB2, 0X4B92,
-  0X4B92, 0X4392, 0X4371, 0X4352, 0X3B51, 0X3B11, 0X3AF0, 0X32AF,
-  0X328E, 0X2A6E, 0X328E, 0X32CF, 0X32AE, 0X2A2C, 0X2A4D, 0X2A8F,
-  0X2A6E, 0X29EB, 0X29EB, 0X2A0C, 0X2A0C, 0X29CB, 0X21CB, 0X29CB,
-  0X2A2C, 0X2A4C, 0X29CA, 0X21AA, 0X2189, 0X2189, 0X21AA, 0X2189,
-  0X2168, 0X2169, 0X21EB, 0X2A6D, 0X29EA, 0X220B, 0X3391, 0X3411,
-  0X228B, 0X21A9, 0X2189, 0X2168, 0X1948, 0X2148, 0X2189, 0X2189,
-  0X1969, 0X2A4C, 0X2A8D, 0X19CA, 0X19EA, 0X21C9, 0X1988, 0X2169,
-  0X2189, 0X21AA, 0X1989, 0X21A9, 0X21EB, 0X21CB, 0X21CA, 0X21CA,
-  0X29CA, 0X29EB, 0X2A2C, 0X2A8D, 0X2AEE, 0X2B2F, 0X3C33, 0X2B2F,
-  0X2A6D, 0X326D, 0X32AE, 0X32CE, 0X32AE, 0X32AE, 0X32AE, 0X3ACE,
-  0X32CE, 0X3AEF, 0X4330, 0X4351, 0X3B92, 0X3B71, 0X4351, 0X4351,
-  0X4371, 0X4392, 0X4BD3, 0X4BD3, 0X4BD3, 0X5434, 0X5495, 0X5475,
-  0X5C75, 0X5CD6, 0X5CF7, 0X5CB6, 0X64D6, 0X64F7, 0X6558, 0X6D99,
-  0X6D79, 0X6D58, 0X6D79, 0X7599, 0X75B9, 0X75DA, 0X7DFA, 0X7DFA,
-  0X7E1B, 0X7E1B, 0X863B, 0X865C, 0X867C, 0X869C, 0X8E9C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X865C, 0X7E3B,
-  0X7E3B, 0X7E3B, 0X7E1B, 0X75FA, 0X75DA, 0X75BA, 0X7599, 0X6D79,
-  0X6D58, 0X6D38, 0X6D18, 0X64F7, 0X64D7, 0X64D7, 0X64F7, 0X5CB6,
-  0X5C75, 0X5C55, 0X5434, 0X5413, 0X53F3, 0X53F4, 0X4BD3, 0X4BD3,
-  0X4BB3, 0X4BB3, 0X43B2, 0X4372, 0X4371, 0X3B51, 0X3B31, 0X3B10,
-  0X3AF0, 0X32CF, 0X32AF, 0X32CF, 0X32CF, 0X32CF, 0X2AAE, 0X32AE,
-  0X2A6E, 0X2A4D, 0X2A2C, 0X2A2C, 0X2A2C, 0X2A0B, 0X29EB, 0X29EB,
-  0X2A2C, 0X2A2C, 0X29CA, 0X29CA, 0X21AA, 0X21AA, 0X29CA, 0X21AA,
-  0X2189, 0X21CA, 0X2A2C, 0X328E, 0X2AEF, 0X3BF2, 0X3C12, 0X332E,
-  0X2A6B, 0X21EA, 0X21A9, 0X21A9, 0X21AA, 0X21AA, 0X218A, 0X218A,
-  0X2189, 0X21AA, 0X2A8D, 0X224C, 0X21EB, 0X220B, 0X220A, 0X21A9,
-  0X1989, 0X19AA, 0X21EB, 0X220B, 0X2A4C, 0X2A4C, 0X2A0B, 0X29EA,
-  0X2A0B, 0X2A6D, 0X2A8D, 0X2A4C, 0X330F, 0X3350, 0X3C74, 0X3BF1,
-  0X32AD, 0X2A8D, 0X328D, 0X32AE, 0X32EE, 0X32EF, 0X3ACF, 0X3AEF,
-  0X3AEF, 0X3AEF, 0X3B30, 0X4371, 0X43D3, 0X43B2, 0X4371, 0X4392,
-  0X4BB2, 0X4BD3, 0X4BF3, 0X53F3, 0X5413, 0X5434, 0X5495, 0X5475,
-  0X5C95, 0X5CB6, 0X64F7, 0X64F7, 0X6517, 0X6558, 0X6579, 0X6D79,
-  0X6D78, 0X6D79, 0X7599, 0X75BA, 0X75DA, 0X7DDA, 0X7DFA, 0X7E1B,
-  0X7E3B, 0X863B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X865C,
-  0X7E5C, 0X7E5C, 0X7E3B, 0X7DFB, 0X75FA, 0X75DA, 0X75BA, 0X7599,
-  0X6D79, 0X6D58, 0X6D38, 0X6D17, 0X64F7, 0X64F7, 0X6518, 0X64F7,
-  0X5CB6, 0X5C75, 0X5C55, 0X5434, 0X5434, 0X5434, 0X5414, 0X53F3,
-  0X4BF3, 0X4BF3, 0X43D3, 0X4372, 0X4331, 0X3B31, 0X3B11, 0X3B10,
-  0X3B10, 0X3B10, 0X3AF0, 0X3AF0, 0X3B10, 0X3330, 0X2ACE, 0X32AF,
-  0X328E, 0X326D, 0X2A4D, 0X2A4D, 0X2A6D, 0X2A6D, 0X2A2C, 0X2A0B,
-  0X2A6D, 0X2A4C, 0X29EB, 0X29EB, 0X29EB, 0X29EB, 0X29EB, 0X29EB,
-  0X2A0B, 0X29EB, 0X324C, 0X32AE, 0X3BD2, 0X33F0, 0X2A8C, 0X2A2B,
-  0X2A6C, 0X2A2B, 0X21CA, 0X29EA, 0X2A0B, 0X21CA, 0X21EB, 0X21EB,
-  0X21CB, 0X21CB, 0X2A4C, 0X2AAD, 0X224C, 0X222B, 0X2AAD, 0X222B,
-  0X19A9, 0X21CA, 0X220B, 0X2A0B, 0X2A4C, 0X2A8D, 0X2A2C, 0X2A0B,
-  0X2A2C, 0X328E, 0X32AE, 0X2A6C, 0X32EF, 0X3B71, 0X4433, 0X44B5,
-  0X3350, 0X332F, 0X3350, 0X3370, 0X3BD2, 0X3BF3, 0X3BB2, 0X3B51,
-  0X4330, 0X4330, 0X4351, 0X4392, 0X4BB2, 0X4BB2, 0X4BB2, 0X4BB2,
-  0X4BD3, 0X4BF3, 0X5413, 0X5413, 0X5434, 0X5475, 0X5CB6, 0X5C95,
-  0X5C96, 0X5CB6, 0X6517, 0X6558, 0X6558, 0X6D78, 0X6D58, 0X6D58,
-  0X7579, 0X75B9, 0X75BA, 0X75DA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E3B,
-  0X865B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X865C,
-  0X865C, 0X867C, 0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75DA, 0X75BA,
-  0X7599, 0X6D79, 0X6D58, 0X6D38, 0X6D18, 0X6D17, 0X6517, 0X6538,
-  0X64F7, 0X5CB6, 0X5C96, 0X5C75, 0X5475, 0X5455, 0X5434, 0X5414,
-  0X5414, 0X4C14, 0X4BD3, 0X4393, 0X4372, 0X4352, 0X4331, 0X3B10,
-  0X3B10, 0X330F, 0X32CF, 0X3AAF, 0X3B10, 0X3350, 0X3310, 0X32CF,
-  0X328E, 0X326E, 0X326D, 0X324D, 0X324E, 0X328E, 0X32AE, 0X2AAE,
-  0X32AE, 0X2A4C, 0X2A0C, 0X2A0B, 0X2A0B, 0X2A0B, 0X29EB, 0X2A2C,
-  0X324C, 0X2A0C, 0X324D, 0X32AE, 0X3BB1, 0X338F, 0X2A6B, 0X2A4B,
-  0X328C, 0X328D, 0X2A4C, 0X2A4C, 0X2A4B, 0X2A0B, 0X2A2B, 0X2A2B,
-  0X2A2B, 0X2A4C, 0X2A4D, 0X2AAE, 0X2B0F, 0X228D, 0X2AAD, 0X2A8D,
-  0X21EA, 0X2A0B, 0X2A2C, 0X2A0B, 0X2A2C, 0X2A8D, 0X2A8D, 0X2A2C,
-  0X2A4C, 0X328D, 0X32CE, 0X32AE, 0X32EF, 0X3BB2, 0X3BB2, 0X4495,
-  0X44D6, 0X4495, 0X44B5, 0X44B5, 0X44B5, 0X44B5, 0X4495, 0X43F3,
-  0X43B2, 0X4391, 0X4371, 0X4392, 0X4BD2, 0X4BD2, 0X4BD3, 0X4BD3,
-  0X4BD3, 0X5413, 0X5414, 0X5414, 0X5454, 0X5C95, 0X5CD6, 0X5CD6,
-  0X5CD6, 0X64D7, 0X6538, 0X6598, 0X6D78, 0X6D58, 0X6D78, 0X6D79,
-  0X7599, 0X75BA, 0X75DA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E1B, 0X863B,
-  0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X867C,
-  0X867C, 0X867C, 0X7E5C, 0X7E1B, 0X7DFB, 0X7DFB, 0X75FA, 0X75DA,
-  0X75DA, 0X7599, 0X7579, 0X6D79, 0X6D38, 0X6D38, 0X6537, 0X6538,
-  0X6538, 0X64F7, 0X64D6, 0X5CB6, 0X5C96, 0X5475, 0X5475, 0X5475,
-  0X5455, 0X4C14, 0X4BD3, 0X4BB3, 0X4BB3, 0X4392, 0X4372, 0X4351,
-  0X3B31, 0X3B30, 0X3B10, 0X3AF0, 0X3B32, 0X3B72, 0X3B72, 0X3B31,
-  0X32CF, 0X32CF, 0X32AF, 0X32AF, 0X326E, 0X326E, 0X32AE, 0X330F,
-  0X32CF, 0X2A4C, 0X324C, 0X322C, 0X322C, 0X2A0C, 0X2A0C, 0X2A2C,
-  0X324C, 0X324C, 0X326D, 0X32AE, 0X3B70, 0X3BF2, 0X2ACD, 0X2A4C,
-  0X32AD, 0X32AD, 0X326C, 0X324C, 0X2A2B, 0X2A0B, 0X29EB, 0X29EB,
-  0X2A0B, 0X2A2B, 0X2A8D, 0X2A6D, 0X32AD, 0X330F, 0X3310, 0X3350,
-  0X3350, 0X2AAD, 0X2A2C, 0X2A2C, 0X2A2C, 0X328D, 0X32CE, 0X328D,
-  0X326D, 0X328D, 0X3AEF, 0X3B30, 0X3B30, 0X43D2, 0X3B71, 0X3B91,
-  0X4454, 0X4454, 0X4413, 0X4433, 0X43F2, 0X4433, 0X4D16, 0X4C95,
-  0X43F3, 0X4BF3, 0X43B2, 0X4B92, 0X4BD3, 0X4BF3, 0X4BF3, 0X53F3,
-  0X5413, 0X5434, 0X5434, 0X5434, 0X5475, 0X5CB6, 0X5CF7, 0X64F7,
-  0X64F7, 0X6538, 0X6578, 0X6D58, 0X6D58, 0X6D79, 0X6D79, 0X7599,
-  0X75B9, 0X75DA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E3B, 0X863B, 0X865B,
-  0X867C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C,
-  0X869C, 0X869C, 0X865C, 0X863B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7DFA,
-  0X75FA, 0X75BA, 0X7599, 0X7579, 0X6D79, 0X6D58, 0X6D38, 0X6D38,
-  0X6558, 0X6517, 0X64F7, 0X64D7, 0X5CB6, 0X5C96, 0X5C96, 0X54B7,
-  0X5475, 0X5414, 0X4BF4, 0X4BD3, 0X4BB3, 0X4392, 0X4372, 0X4372,
-  0X4372, 0X4352, 0X4352, 0X3B72, 0X4373, 0X43D4, 0X4434, 0X3BB3,
-  0X3B51, 0X3AF0, 0X3ACF, 0X32AE, 0X32AF, 0X328E, 0X32AE, 0X3AEF,
-  0X32EF, 0X326D, 0X326D, 0X326D, 0X326E, 0X326D, 0X324D, 0X326D,
-  0X326C, 0X328D, 0X32CE, 0X32AE, 0X32CE, 0X3BF2, 0X3BD2, 0X32EE,
-  0X32CD, 0X3ACE, 0X326C, 0X324C, 0X322C, 0X2A0B, 0X2A0B, 0X2A0B,
-  0X2A0B, 0X2A0B, 0X324C, 0X324C, 0X2A0B, 0X328E, 0X3B91, 0X3C33,
-  0X3BF2, 0X3350, 0X32AE, 0X2A4C, 0X2A6D, 0X328D, 0X3AEF, 0X3AEF,
-  0X32CE, 0X32EF, 0X3B10, 0X3B30, 0X3B30, 0X43D3, 0X43B2, 0X3B30,
-  0X4371, 0X3B91, 0X43B2, 0X43D2, 0X3BB2, 0X4454, 0X5557, 0X4CB5,
-  0X43F3, 0X4BF3, 0X4BF3, 0X4BF3, 0X4BD3, 0X5414, 0X5414, 0X5414,
-  0X5455, 0X5475, 0X5475, 0X5C75, 0X5C95, 0X5CF6, 0X6517, 0X6517,
-  0X6517, 0X6578, 0X6D78, 0X6D58, 0X6D79, 0X7599, 0X7599, 0X75B9,
-  0X75DA, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E3B, 0X865B, 0X865C, 0X867C,
-  0X869C, 0X8E9C, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD,
-  0X869D, 0X869D, 0X867C, 0X865C, 0X863B, 0X7E3B, 0X7E1B, 0X7E1B,
-  0X7DFA, 0X75DA, 0X75BA, 0X7599, 0X7579, 0X6D99, 0X6D59, 0X6D38,
-  0X6538, 0X6517, 0X6517, 0X64F7, 0X64B6, 0X5CB6, 0X5CB7, 0X5C96,
-  0X5475, 0X5455, 0X5414, 0X4BF4, 0X4BD3, 0X4BB3, 0X4392, 0X4392,
-  0X4B93, 0X43B3, 0X4392, 0X4392, 0X4372, 0X43B3, 0X4414, 0X4392,
-  0X3B51, 0X3B10, 0X3AEF, 0X3ACF, 0X3ACF, 0X3AD0, 0X3AF0, 0X3B10,
-  0X3B30, 0X32CE, 0X328E, 0X32AE, 0X3ACF, 0X32AE, 0X328E, 0X326D,
-  0X326D, 0X32AE, 0X3B10, 0X32CE, 0X328D, 0X3B10, 0X4434, 0X4473,
-  0X3BB0, 0X3B4F, 0X3AAD, 0X326D, 0X326D, 0X324C, 0X326D, 0X32AE,
-  0X328D, 0X326D, 0X328D, 0X326D, 0X326D, 0X3A8D, 0X3AAE, 0X3B50,
-  0X3B91, 0X3350, 0X3350, 0X32CF, 0X32AE, 0X32EF, 0X3B70, 0X3B70,
-  0X3B50, 0X3B30, 0X3B30, 0X3B30, 0X3B71, 0X43F3, 0X43F2, 0X4351,
-  0X4392, 0X43F3, 0X43D2, 0X4391, 0X43D2, 0X5516, 0X5577, 0X4C74,
-  0X4BD3, 0X4BD3, 0X53F3, 0X5434, 0X5434, 0X5434, 0X5454, 0X5454,
-  0X5475, 0X5CB6, 0X5C95, 0X5CB6, 0X64D6, 0X6517, 0X6537, 0X6517,
-  0X6D58, 0X6DB9, 0X6D99, 0X6D78, 0X7599, 0X75B9, 0X75DA, 0X7DDA,
-  0X7DFB, 0X7E1B, 0X7E1B, 0X7E3B, 0X865B, 0X865C, 0X867C, 0X869C,
-  0X8E9C, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X86BD, 0X869C, 0X867C, 0X865C, 0X863B, 0X7E3B, 0X7E3B,
-  0X7E1B, 0X7DFA, 0X75FA, 0X75DA, 0X75BA, 0X7599, 0X6D79, 0X6D58,
-  0X6D38, 0X6538, 0X6517, 0X6517, 0X64D7, 0X5CF7, 0X5CF8, 0X5C96,
-  0X5C96, 0X5C96, 0X5435, 0X5414, 0X53F4, 0X4BD3, 0X4BD3, 0X4BD3,
-  0X4BB3, 0X4BD3, 0X4392, 0X43B3, 0X43D4, 0X43B3, 0X43B3, 0X43D2,
-  0X43B2, 0X3B71, 0X3B10, 0X3AF0, 0X3AEF, 0X3ACF, 0X3B10, 0X3B31,
-  0X3B52, 0X3B51, 0X3AEF, 0X3ACF, 0X3ACF, 0X32AE, 0X3A8E, 0X32AE,
-  0X328E, 0X32CF, 0X3B51, 0X3B0F, 0X32AE, 0X3AEF, 0X3B50, 0X43F2,
-  0X4495, 0X4453, 0X3B70, 0X32AE, 0X328E, 0X3ACE, 0X3ACF, 0X3B0F,
-  0X3B0F, 0X3AEF, 0X3AEF, 0X3AEF, 0X32AE, 0X32AE, 0X3AAE, 0X3AAE,
-  0X3B30, 0X3B91, 0X3B91, 0X3B91, 0X3B91, 0X43D2, 0X3B91, 0X43D2,
-  0X43B2, 0X3B50, 0X4351, 0X3B30, 0X4371, 0X4413, 0X4413, 0X43B2,
-  0X43D2, 0X43D2, 0X43F3, 0X4433, 0X4CD6, 0X5DB9, 0X5537, 0X4C54,
-  0X53F4, 0X53F3, 0X5414, 0X5434, 0X5455, 0X5475, 0X5C95, 0X5C95,
-  0X5CB6, 0X5CB6, 0X5CD6, 0X64F7, 0X64F7, 0X6538, 0X6D58, 0X6D58,
-  0X6DB9, 0X6DB9, 0X6D99, 0X7599, 0X75BA, 0X75DA, 0X75DA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X865B, 0X865C, 0X867C, 0X869C, 0X8E9C,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X86BC, 0X869C, 0X867C, 0X867C, 0X865C, 0X7E5B,
-  0X7E3B, 0X7E1B, 0X7DFA, 0X75FA, 0X75DA, 0X75BA, 0X7599, 0X6D79,
-  0X6D58, 0X6D38, 0X6D38, 0X6518, 0X64F7, 0X6518, 0X6518, 0X5CB6,
-  0X5CB6, 0X5C96, 0X5475, 0X5455, 0X5434, 0X5414, 0X5414, 0X4BF4,
-  0X4BD3, 0X4BB3, 0X4BB3, 0X4C15, 0X43D3, 0X43B3, 0X43B3, 0X43B2,
-  0X4BF3, 0X43B2, 0X4351, 0X4310, 0X3B10, 0X3B10, 0X3B10, 0X3B10,
-  0X3B51, 0X3BB3, 0X3B71, 0X3B0F, 0X3AEF, 0X3ACF, 0X3ACF, 0X3ACF,
-  0X3ACF, 0X3AF0, 0X3B51, 0X3B51, 0X330F, 0X3B30, 0X432F, 0X4330,
-  0X43F3, 0X4CD5, 0X4433, 0X3B0F, 0X3B0F, 0X3B30, 0X3AEE, 0X3ACE,
-  0X3AEF, 0X3AEF, 0X3ACF, 0X3B0F, 0X4330, 0X3B0F, 0X3AEF, 0X3AEF,
-  0X3B0F, 0X43B2, 0X4413, 0X4413, 0X4C74, 0X43F2, 0X3B50, 0X43B2,
-  0X43D2, 0X4391, 0X4371, 0X3B50, 0X4371, 0X4BF3, 0X4C54, 0X4413,
-  0X4433, 0X4CB5, 0X5557, 0X5D98, 0X65D9, 0X5D98, 0X54F7, 0X4C54,
-  0X5414, 0X5414, 0X5434, 0X5454, 0X5455, 0X5C95, 0X5C95, 0X5CB6,
-  0X5CD6, 0X64D6, 0X64F7, 0X64F7, 0X6558, 0X6599, 0X6D78, 0X6D78,
-  0X6DDA, 0X6DBA, 0X75B9, 0X75DA, 0X75DA, 0X75FA, 0X7DFA, 0X7E1B,
-  0X7E1B, 0X7E5C, 0X865C, 0X867C, 0X867C, 0X869C, 0X8E9C, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X867C, 0X865C,
-  0X865C, 0X7E3B, 0X7E1B, 0X7E1B, 0X75FA, 0X75DA, 0X75BA, 0X7599,
-  0X6D79, 0X6D79, 0X6D58, 0X6D38, 0X6518, 0X6538, 0X6538, 0X64D7,
-  0X5CB7, 0X5CB6, 0X5CB6, 0X5475, 0X5455, 0X5455, 0X5435, 0X5434,
-  0X4BF4, 0X4BD3, 0X4BF5, 0X4C35, 0X4BF3, 0X4BF4, 0X4BD3, 0X43B2,
-  0X4BF3, 0X4BD3, 0X43B2, 0X4371, 0X4351, 0X4351, 0X4331, 0X4330,
-  0X3B51, 0X4392, 0X43D3, 0X3B71, 0X3B10, 0X3AF0, 0X3B0F, 0X3B10,
-  0X3B0F, 0X4310, 0X4351, 0X3B71, 0X3B51, 0X4330, 0X4351, 0X4392,
-  0X43D2, 0X4C95, 0X4CD5, 0X43B1, 0X4391, 0X4391, 0X4350, 0X3B2F,
-  0X3B10, 0X4330, 0X3AEF, 0X3AEF, 0X4350, 0X4B71, 0X4350, 0X3B50,
-  0X4372, 0X43B2, 0X43B2, 0X4BF3, 0X4C54, 0X4C33, 0X43D2, 0X43D2,
-  0X43B2, 0X43B2, 0X43B2, 0X43B2, 0X43B2, 0X43D2, 0X4C54, 0X4C94,
-  0X5536, 0X5598, 0X5D77, 0X5D58, 0X5517, 0X54F6, 0X54D6, 0X5475,
-  0X5455, 0X5455, 0X5455, 0X5C75, 0X5C75, 0X5C95, 0X5CB6, 0X64B6,
-  0X64F7, 0X6517, 0X6517, 0X6538, 0X6D78, 0X6DB9, 0X6D99, 0X6D79,
-  0X75DA, 0X761B, 0X75FA, 0X75FA, 0X7DFA, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X863B, 0X865C, 0X867C, 0X869C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C, 0X867C,
-  0X867C, 0X865C, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X75FB, 0X75DA,
-  0X7599, 0X7599, 0X6D79, 0X6D59, 0X6D58, 0X6D79, 0X6538, 0X64F7,
-  0X64F7, 0X64D7, 0X5CB6, 0X5C96, 0X5C76, 0X5C76, 0X5C75, 0X5435,
-  0X5414, 0X5414, 0X5435, 0X5435, 0X4C14, 0X4C14, 0X4BF3, 0X4BD3,
-  0X4BD4, 0X4BF4, 0X4BF3, 0X43D2, 0X4372, 0X4372, 0X4351, 0X4372,
-  0X4372, 0X4372, 0X43F3, 0X43F3, 0X4371, 0X4351, 0X4330, 0X4310,
-  0X4310, 0X4331, 0X4371, 0X4372, 0X4392, 0X4371, 0X4371, 0X43D2,
-  0X43F3, 0X4C95, 0X54F6, 0X4C53, 0X43D2, 0X43B1, 0X4371, 0X4370,
-  0X4350, 0X4330, 0X4330, 0X4330, 0X4350, 0X4350, 0X4350, 0X4371,
-  0X4BD3, 0X43D3, 0X4371, 0X4371, 0X4392, 0X4BF3, 0X5495, 0X54B5,
-  0X4C33, 0X4C33, 0X4C74, 0X4C95, 0X4C94, 0X4C74, 0X4C95, 0X5536,
-  0X5DB8, 0X5536, 0X54F7, 0X4CD6, 0X4C95, 0X54B5, 0X54B6, 0X5C96,
-  0X5C96, 0X5475, 0X5C95, 0X5C96, 0X5CB6, 0X64D6, 0X64D6, 0X64F7,
-  0X6517, 0X6538, 0X6D58, 0X6D78, 0X6D99, 0X6DB9, 0X6DB9, 0X75B9,
-  0X75DA, 0X75FA, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X865B,
-  0X865C, 0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869D, 0X869C,
-  0X869C, 0X867C, 0X865C, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E1B, 0X75FB,
-  0X75DA, 0X75B9, 0X7599, 0X6D79, 0X6D79, 0X6D99, 0X6D58, 0X6517,
-  0X6517, 0X6518, 0X64F7, 0X64D7, 0X5CB6, 0X5C96, 0X5C96, 0X5C75,
-  0X5435, 0X5455, 0X5476, 0X5455, 0X5455, 0X5434, 0X4BF4, 0X4BF4,
-  0X4BF4, 0X4C14, 0X4C34, 0X4C13, 0X43D3, 0X4392, 0X4392, 0X4392,
-  0X4392, 0X4392, 0X4BD3, 0X4C13, 0X43B2, 0X4B92, 0X4371, 0X4351,
-  0X4351, 0X4392, 0X4392, 0X43B2, 0X4BB2, 0X4BB2, 0X43D3, 0X4413,
-  0X4454, 0X54D5, 0X5CD5, 0X4C33, 0X43B1, 0X4371, 0X4371, 0X4371,
-  0X4371, 0X4371, 0X4371, 0X4371, 0X4371, 0X4351, 0X4351, 0X4351,
-  0X4B71, 0X4BF3, 0X4BD3, 0X4B92, 0X4BB3, 0X4BB3, 0X4C34, 0X54F6,
-  0X5537, 0X54F6, 0X4CB4, 0X4C74, 0X4C74, 0X54B5, 0X5D57, 0X65B9,
-  0X65D9, 0X5537, 0X54F7, 0X54F7, 0X54D6, 0X54B6, 0X5CB6, 0X5C96,
-  0X5CB6, 0X5CB6, 0X5CB6, 0X64D6, 0X64D6, 0X64F7, 0X6517, 0X6517,
-  0X6538, 0X6D58, 0X6D58, 0X6D78, 0X6D99, 0X75FA, 0X75DA, 0X75DA,
-  0X75FA, 0X75FA, 0X7E1B, 0X7E5B, 0X7E5B, 0X7E5B, 0X865C, 0X865C,
-  0X867C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FD, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C,
-  0X869C, 0X869C, 0X867C, 0X865C, 0X7E5C, 0X7E3B, 0X7E1B, 0X7E1B,
-  0X75FB, 0X75DA, 0X75DA, 0X75BA, 0X7599, 0X6DDA, 0X6D79, 0X6D38,
-  0X6D38, 0X6538, 0X6517, 0X64F7, 0X64D7, 0X5CB6, 0X5CB6, 0X5CB6,
-  0X5C75, 0X5C76, 0X5C97, 0X5496, 0X5476, 0X5455, 0X5414, 0X5414,
-  0X5414, 0X5434, 0X5455, 0X4C34, 0X4C34, 0X4BF3, 0X4BD3, 0X4BD2,
-  0X4BB2, 0X4BB2, 0X43D3, 0X4C14, 0X4BF3, 0X4B92, 0X4B92, 0X4392,
-  0X4BB3, 0X4BF4, 0X43D3, 0X4BD2, 0X4BD2, 0X4BB2, 0X4C13, 0X4C95,
-  0X54F6, 0X5D16, 0X54F5, 0X4C33, 0X43B2, 0X4B91, 0X4BB2, 0X4B92,
-  0X4B71, 0X4B92, 0X4BB2, 0X4BD3, 0X4B92, 0X4B92, 0X4B92, 0X4B91,
-  0X4B91, 0X4BD3, 0X4C34, 0X4C14, 0X4BD3, 0X4BB2, 0X4BD3, 0X5413,
-  0X5CF6, 0X5D57, 0X5516, 0X54B5, 0X54D6, 0X5D37, 0X6598, 0X6DF9,
-  0X6DFA, 0X6598, 0X54F7, 0X5D17, 0X5CF7, 0X5CD6, 0X5CB6, 0X5CB6,
-  0X64D6, 0X64D7, 0X64F7, 0X64F7, 0X64F7, 0X6517, 0X6537, 0X6D38,
-  0X6D58, 0X6D58, 0X6D78, 0X6D99, 0X75DA, 0X761B, 0X761A, 0X75FA,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X7E5B, 0X7E5B, 0X867C, 0X867C, 0X869C,
-  0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X869D, 0X869C, 0X869C, 0X869C, 0X869C, 0X867C, 0X7E3B, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X761B, 0X75FA, 0X75FA, 0X75FB, 0X6DBA, 0X6D79,
-  0X6D79, 0X6D58, 0X6D38, 0X6517, 0X64F7, 0X64F7, 0X64D7, 0X64D7,
-  0X5CB6, 0X5C96, 0X5CB6, 0X5CB7, 0X5CB6, 0X5475, 0X5455, 0X5455,
-  0X5435, 0X5434, 0X5455, 0X5496, 0X5455, 0X5434, 0X4C14, 0X4BF3,
-  0X4BF3, 0X4BF3, 0X4BF3, 0X4C34, 0X4C34, 0X4BD3, 0X4BD3, 0X4BD3,
-  0X4BF3, 0X4C34, 0X4C13, 0X4BD2, 0X4BD2, 0X4BF3, 0X4C34, 0X54B5,
-  0X6578, 0X5D57, 0X54F5, 0X5494, 0X4BF3, 0X4BD2, 0X4BD2, 0X4BB2,
-  0X4BB2, 0X4BB2, 0X4BB2, 0X4BD3, 0X4BD3, 0X4BB2, 0X4BB2, 0X4BD2,
-  0X4BD2, 0X53F3, 0X5496, 0X5475, 0X5413, 0X53F3, 0X5414, 0X5414,
-  0X5495, 0X5CF6, 0X5CD6, 0X5D16, 0X5D37, 0X6578, 0X65B9, 0X6DD9,
-  0X6E1A, 0X6DF9, 0X5D57, 0X5D17, 0X5D38, 0X5D17, 0X64F7, 0X64D6,
-  0X64D7, 0X64F7, 0X6517, 0X6D38, 0X6D38, 0X6D38, 0X6D58, 0X6D58,
-  0X6D78, 0X6D79, 0X7599, 0X75BA, 0X75FA, 0X761B, 0X7E1B, 0X7E3B,
-  0X7E5B, 0X7E7C, 0X7E5B, 0X865B, 0X867C, 0X867C, 0X869C, 0X86BD,
-  0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X8EBD, 0X86BD, 0X86BD, 0X869C, 0X867C, 0X865C, 0X7E5B,
-  0X7E3B, 0X7E1B, 0X7E1B, 0X7DFB, 0X761B, 0X761B, 0X75DA, 0X75B9,
-  0X6D99, 0X6D79, 0X6D58, 0X6D58, 0X6D38, 0X6518, 0X6517, 0X64F7,
-  0X64F7, 0X5CB6, 0X5CD7, 0X5CF8, 0X5CB6, 0X5C96, 0X5C96, 0X5C75,
-  0X5475, 0X5455, 0X5496, 0X54D6, 0X54F6, 0X54B6, 0X5455, 0X5434,
-  0X5414, 0X5414, 0X4C14, 0X5434, 0X5475, 0X4C34, 0X5414, 0X53F3,
-  0X4BF3, 0X4C14, 0X4C13, 0X4BF3, 0X53F3, 0X5434, 0X5475, 0X5D17,
-  0X65B9, 0X5D37, 0X54F6, 0X54F6, 0X5454, 0X53F3, 0X53F3, 0X53F3,
-  0X53D3, 0X53D3, 0X4BD2, 0X53F3, 0X5413, 0X53F3, 0X53F3, 0X53F3,
-  0X53F3, 0X5455, 0X54B6, 0X5434, 0X5414, 0X5434, 0X5434, 0X5C54,
-  0X5CF7, 0X5D37, 0X5CB6, 0X54B6, 0X5CD6, 0X64F7, 0X6DB9, 0X6DFA,
-  0X6DF9, 0X6E1A, 0X6E1A, 0X6599, 0X6558, 0X6558, 0X6537, 0X64F7,
-  0X6517, 0X6517, 0X6D38, 0X6D58, 0X6D58, 0X6D58, 0X6D78, 0X6D79,
-  0X7599, 0X7599, 0X75BA, 0X75FA, 0X7E1A, 0X7E3B, 0X7E3B, 0X7E5B,
-  0X7E7C, 0X867C, 0X865B, 0X867C, 0X867C, 0X869C, 0X86BD, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X867C, 0X867C, 0X867C,
-  0X7E5B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X75DA, 0X75DA,
-  0X75BA, 0X7599, 0X6D99, 0X6D79, 0X6D78, 0X6D58, 0X6D38, 0X6538,
-  0X6518, 0X6538, 0X6579, 0X6579, 0X64F7, 0X5CB6, 0X5CB6, 0X5CB6,
-  0X5C96, 0X5C96, 0X5CB6, 0X5CD6, 0X5D78, 0X5D79, 0X54B6, 0X5475,
-  0X5475, 0X5455, 0X5434, 0X5434, 0X5495, 0X5495, 0X5434, 0X5414,
-  0X5414, 0X5435, 0X5414, 0X5414, 0X5414, 0X5434, 0X54D6, 0X5D78,
-  0X6598, 0X5516, 0X54D6, 0X54D6, 0X5475, 0X5454, 0X5434, 0X5434,
-  0X5413, 0X53F3, 0X53F3, 0X5413, 0X5414, 0X5434, 0X5434, 0X5414,
-  0X5414, 0X5CB6, 0X5D17, 0X5475, 0X5434, 0X5C54, 0X5C55, 0X5C95,
-  0X5D17, 0X6558, 0X5CF6, 0X5CD6, 0X5CF7, 0X5CF6, 0X6D99, 0X6DFA,
-  0X6DD9, 0X6DD9, 0X6E1A, 0X6E1A, 0X6D99, 0X6599, 0X6579, 0X6538,
-  0X6D38, 0X6D38, 0X6D58, 0X6D79, 0X6D79, 0X6D78, 0X7599, 0X75B9,
-  0X75BA, 0X75DA, 0X75DA, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E5B, 0X867C,
-  0X869C, 0X867C, 0X867C, 0X869C, 0X869C, 0X8E9C, 0X8EBD, 0X8EDD,
-  0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X86BD, 0X869C, 0X869C, 0X867C,
-  0X867C, 0X865B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7DFA, 0X7DFA,
-  0X75DA, 0X75DA, 0X75B9, 0X7599, 0X6D79, 0X6D79, 0X6D58, 0X6D58,
-  0X6D79, 0X6D9A, 0X6D99, 0X6558, 0X6538, 0X64F7, 0X64D7, 0X64D7,
-  0X5CB6, 0X5CD6, 0X5CD6, 0X5CD6, 0X5D37, 0X5D58, 0X5CF6, 0X5CD6,
-  0X5CB6, 0X5CB6, 0X5496, 0X5496, 0X54D6, 0X54B6, 0X5475, 0X5434,
-  0X5455, 0X5476, 0X5455, 0X5434, 0X5414, 0X5475, 0X5D17, 0X6578,
-  0X6599, 0X5D37, 0X54D6, 0X5CD6, 0X5475, 0X5454, 0X5434, 0X5455,
-  0X5455, 0X5434, 0X5434, 0X5434, 0X5C34, 0X5C55, 0X5C75, 0X5C55,
-  0X5455, 0X5CD7, 0X6559, 0X5CD6, 0X5C75, 0X5C95, 0X5C96, 0X5CD6,
-  0X6538, 0X6517, 0X5CD6, 0X64F7, 0X6538, 0X6517, 0X6578, 0X6DFA,
-  0X6DD9, 0X6DB9, 0X6DDA, 0X763B, 0X761A, 0X6DB9, 0X6DB9, 0X6D99,
-  0X6D58, 0X6D78, 0X6D79, 0X7599, 0X75B9, 0X75B9, 0X75BA, 0X75DA,
-  0X75DA, 0X7DFA, 0X7DFA, 0X7E3B, 0X7E5B, 0X7E5B, 0X867C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C,
-  0X867C, 0X867C, 0X865C, 0X865C, 0X7E5C, 0X7E3B, 0X7E1B, 0X7DFB,
-  0X7DFB, 0X75FA, 0X75DA, 0X75BA, 0X75B9, 0X7599, 0X6D79, 0X6D79,
-  0X6DBA, 0X6DDA, 0X6D99, 0X6558, 0X6538, 0X6559, 0X6538, 0X6518,
-  0X64F7, 0X6517, 0X6538, 0X6558, 0X6538, 0X5CF7, 0X5CD7, 0X5CF7,
-  0X5CD6, 0X5CD6, 0X5CF7, 0X54F7, 0X5D38, 0X5D17, 0X5495, 0X5C95,
-  0X54B6, 0X5CB6, 0X5475, 0X5455, 0X5C55, 0X5CB6, 0X5D17, 0X6578,
-  0X5D98, 0X5D78, 0X5D17, 0X5CF7, 0X5C95, 0X5C75, 0X5C75, 0X5C95,
-  0X5C95, 0X5C75, 0X5C75, 0X5C75, 0X5C95, 0X5C75, 0X5C95, 0X5C96,
-  0X5C95, 0X5CD6, 0X6558, 0X6538, 0X5CF7, 0X5CF7, 0X5CB6, 0X64F7,
-  0X6558, 0X6517, 0X64D6, 0X6517, 0X6538, 0X6537, 0X6D78, 0X761B,
-  0X75FA, 0X6DD9, 0X75DA, 0X761B, 0X7E5B, 0X761B, 0X6DFA, 0X6DDA,
-  0X6DBA, 0X75B9, 0X75B9, 0X75BA, 0X75DA, 0X75FA, 0X761B, 0X7DFA,
-  0X7DFA, 0X7E1B, 0X7E1B, 0X7E5B, 0X7E5B, 0X865C, 0X867C, 0X86BD,
-  0X86BC, 0X869C, 0X86BC, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C,
-  0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X865C, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X7E1B, 0X7DFA, 0X75DA, 0X75DA, 0X75BA, 0X7599, 0X75BA,
-  0X75FB, 0X75DA, 0X6D99, 0X6D79, 0X6D58, 0X6D59, 0X6D79, 0X6559,
-  0X6579, 0X6579, 0X6579, 0X6599, 0X6559, 0X64F7, 0X64D7, 0X64D7,
-  0X64F7, 0X5D17, 0X5D38, 0X5CF7, 0X5D38, 0X6599, 0X5CF7, 0X5CB6,
-  0X5CF7, 0X5CD6, 0X5C96, 0X5C96, 0X5C96, 0X5CD7, 0X5D37, 0X6598,
-  0X6599, 0X6599, 0X6558, 0X5D17, 0X5CB6, 0X5C95, 0X5CB6, 0X5CD6,
-  0X5CB6, 0X5C95, 0X5C95, 0X5C96, 0X5C96, 0X5C96, 0X5CB6, 0X5CD6,
-  0X5CB6, 0X64F7, 0X6558, 0X6538, 0X6558, 0X6558, 0X6537, 0X6538,
-  0X6558, 0X6537, 0X64F7, 0X6517, 0X6538, 0X6D58, 0X6D79, 0X75FA,
-  0X7E3B, 0X75FA, 0X75FA, 0X75FA, 0X7E5B, 0X7E7B, 0X761B, 0X75FA,
-  0X75DA, 0X75DA, 0X75FA, 0X75FB, 0X75FA, 0X7DFA, 0X7E1B, 0X7E1B,
-  0X7E1B, 0X7E3B, 0X865B, 0X867C, 0X867C, 0X867C, 0X869C, 0X86BD,
-  0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X8EBD, 0X869C, 0X869C, 0X869C, 0X869C, 0X867C, 0X867C, 0X865C,
-  0X7E5B, 0X7E3B, 0X7E1B, 0X7DFB, 0X7DFA, 0X75DA, 0X75DA, 0X75FB,
-  0X75FB, 0X75B9, 0X7599, 0X6D79, 0X6D79, 0X6D78, 0X6D58, 0X6D9A,
-  0X6DDA, 0X6DB9, 0X6D99, 0X6D99, 0X6559, 0X6538, 0X6517, 0X64F7,
-  0X64F7, 0X6518, 0X6578, 0X6558, 0X6578, 0X65B9, 0X6558, 0X5D38,
-  0X5D58, 0X5CF7, 0X64D6, 0X64D6, 0X5CD6, 0X5D17, 0X5D38, 0X6558,
-  0X6DD9, 0X6DB9, 0X6579, 0X6537, 0X5CD6, 0X5CB6, 0X5CF7, 0X5D17,
-  0X64D6, 0X64B6, 0X5CB6, 0X64B6, 0X64B6, 0X64D6, 0X64D7, 0X64F7,
-  0X6517, 0X6558, 0X6538, 0X6537, 0X6D78, 0X6D99, 0X6D78, 0X6D58,
-  0X6558, 0X6558, 0X6D17, 0X6D38, 0X6D58, 0X6D58, 0X6D99, 0X75DA,
-  0X7E3B, 0X761B, 0X75FA, 0X761B, 0X7E5B, 0X7E7B, 0X7E3B, 0X761B,
-  0X75FA, 0X75FA, 0X7DFA, 0X7E3B, 0X7E3B, 0X7E1B, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X865B, 0X867C, 0X869C, 0X869C, 0X86BC, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X96FD, 0X96FD, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X8E9D, 0X8EBD, 0X869D, 0X869C, 0X869C, 0X867C,
-  0X867C, 0X7E5C, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X75FA, 0X75DA, 0X75BA, 0X75B9, 0X7599, 0X7599, 0X6D79, 0X6D99,
-  0X6DDA, 0X6D99, 0X6D79, 0X6D58, 0X6D58, 0X6559, 0X6558, 0X6538,
-  0X6517, 0X6517, 0X6558, 0X65B9, 0X65B9, 0X6558, 0X6578, 0X6599,
-  0X6599, 0X6538, 0X64F7, 0X64F7, 0X64F7, 0X6517, 0X5D17, 0X6538,
-  0X6DDA, 0X6DD9, 0X65B9, 0X6578, 0X64F7, 0X64F7, 0X6517, 0X5D37,
-  0X6517, 0X64D7, 0X64D6, 0X64F7, 0X64F7, 0X64D7, 0X64F7, 0X6517,
-  0X6558, 0X6D99, 0X6558, 0X6D78, 0X6D78, 0X6D78, 0X6D99, 0X6D78,
-  0X6D78, 0X6D78, 0X6D58, 0X6D58, 0X6D79, 0X6D99, 0X75B9, 0X75FA,
-  0X7E3B, 0X7E3B, 0X7E1B, 0X7E3B, 0X7E5B, 0X7E7C, 0X7E5B, 0X7E3B,
-  0X7E3B, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E5B, 0X7E5B, 0X867C, 0X867C,
-  0X867C, 0X867C, 0X869C, 0X869C, 0X86BD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X867C, 0X865C, 0X865C, 0X7E3B, 0X7E3B, 0X7E7C, 0X7E3B,
-  0X7DFA, 0X7DFA, 0X75DA, 0X75DA, 0X75BA, 0X75BA, 0X75B9, 0X75B9,
-  0X75DA, 0X6DDA, 0X6D99, 0X6D79, 0X6D58, 0X6D58, 0X6D79, 0X6D59,
-  0X6D58, 0X6D38, 0X6D58, 0X6D99, 0X6D99, 0X6558, 0X6579, 0X6DBA,
-  0X6DDA, 0X6598, 0X6558, 0X6538, 0X6517, 0X6517, 0X6537, 0X6558,
-  0X6DBA, 0X6DFA, 0X6DD9, 0X6DB9, 0X6537, 0X6517, 0X6537, 0X6538,
-  0X6538, 0X6538, 0X6538, 0X6D58, 0X6558, 0X6517, 0X6517, 0X6538,
-  0X6D99, 0X6DB9, 0X6D79, 0X6D79, 0X6D58, 0X6D58, 0X6D79, 0X7599,
-  0X7599, 0X7599, 0X6D99, 0X7599, 0X75B9, 0X75DA, 0X75DA, 0X75FA,
-  0X7E3B, 0X7E5C, 0X7E5B, 0X7E5B, 0X7E7C, 0X869C, 0X7E7C, 0X7E5C,
-  0X7E5B, 0X7E3B, 0X7E3B, 0X7E5B, 0X865B, 0X865B, 0X867C, 0X869C,
-  0X869C, 0X869C, 0X86BD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8E9D,
-  0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X867C, 0X7E5C, 0X7E3B,
-  0X7E1B, 0X7E1B, 0X7DFB, 0X7DFA, 0X7DFA, 0X75DA, 0X75DA, 0X75DA,
-  0X75FA, 0X75FA, 0X75B9, 0X7599, 0X6D99, 0X6D99, 0X6D79, 0X6D79,
-  0X6D79, 0X6D99, 0X6DBA, 0X6D99, 0X6D99, 0X6D99, 0X6D79, 0X6DB9,
-  0X6DFA, 0X6DD9, 0X6598, 0X6558, 0X6558, 0X6578, 0X6599, 0X6599,
-  0X6DBA, 0X6DFA, 0X6DD9, 0X6DD9, 0X6D78, 0X6538, 0X6D58, 0X6D78,
-  0X6D38, 0X6D78, 0X6D99, 0X6D78, 0X6D58, 0X6D99, 0X6D79, 0X6D78,
-  0X6DB9, 0X6DDA, 0X6D99, 0X6D99, 0X6D79, 0X6D79, 0X6D99, 0X7599,
-  0X75BA, 0X75DA, 0X75B9, 0X75DA, 0X75DA, 0X75DA, 0X75FA, 0X75FA,
-  0X7E3B, 0X7E7C, 0X7E7C, 0X7E7C, 0X867C, 0X869C, 0X867C, 0X867C,
-  0X867C, 0X865C, 0X865B, 0X867C, 0X867C, 0X867C, 0X869C, 0X869C,
-  0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EFD, 0X8EFD, 0X8EFD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X86BD, 0X86BD, 0X869D, 0X867C, 0X865C, 0X865B,
-  0X7E3B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7DFB, 0X7DFA, 0X7DFA,
-  0X75FA, 0X75FA, 0X75FA, 0X75DA, 0X75B9, 0X75B9, 0X75B9, 0X7599,
-  0X7599, 0X6DB9, 0X6DBA, 0X6D9A, 0X6DDA, 0X6DBA, 0X6D99, 0X6DBA,
-  0X6DDA, 0X6DDA, 0X6DD9, 0X6DB9, 0X6D79, 0X6D99, 0X6DB9, 0X6DB9,
-  0X6DDA, 0X761A, 0X6DDA, 0X75FA, 0X6DB9, 0X6D78, 0X6D79, 0X6D99,
-  0X6D99, 0X6D99, 0X6D79, 0X6D78, 0X6D58, 0X6D99, 0X6DB9, 0X6D79,
-  0X6DB9, 0X761B, 0X75FA, 0X75B9, 0X7599, 0X7599, 0X75B9, 0X75B9,
-  0X75DA, 0X75FA, 0X75DA, 0X75DA, 0X7DFA, 0X7DFA, 0X7DFA, 0X7E1B,
-  0X7E5B, 0X869C, 0X869C, 0X869C, 0X869C, 0X86BC, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X867C, 0X869C, 0X869C, 0X869C, 0X869C, 0X86BC,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X96FD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X869C, 0X869C, 0X867C, 0X867C,
-  0X865C, 0X865C, 0X865B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B,
-  0X7E1B, 0X7E1B, 0X7E1B, 0X75FA, 0X75DA, 0X75DA, 0X75DA, 0X75DA,
-  0X75DA, 0X75B9, 0X7599, 0X75B9, 0X75DA, 0X75FA, 0X75DA, 0X75DA,
-  0X6DBA, 0X6DB9, 0X6DB9, 0X6DDA, 0X6DDA, 0X6D99, 0X6DB9, 0X6DDA,
-  0X75FA, 0X763B, 0X75FA, 0X75FA, 0X75FA, 0X6D99, 0X6DB9, 0X6DBA,
-  0X6DBA, 0X6DB9, 0X6D99, 0X7599, 0X75B9, 0X75B9, 0X75DA, 0X6DBA,
-  0X75FB, 0X761B, 0X75FA, 0X75DA, 0X75B9, 0X75B9, 0X75BA, 0X75DA,
-  0X75FA, 0X7E1B, 0X7E1A, 0X7DFA, 0X7DFA, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X867C, 0X869C, 0X869C, 0X869C, 0X869C, 0X86BC, 0X86BD, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X86BC, 0X8EBC, 0X8EBD, 0X8EBD,
-  0X8EDD, 0X8EDD, 0X8EFD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X869D, 0X869C, 0X869C,
-  0X867C, 0X867C, 0X865C, 0X865C, 0X865B, 0X863B, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7DFA, 0X7DFA, 0X7DFA,
-  0X75FA, 0X75DA, 0X75DA, 0X75DA, 0X75DA, 0X75FA, 0X75FA, 0X75FA,
-  0X75FA, 0X75DA, 0X75FA, 0X75DA, 0X75FA, 0X75FA, 0X75DA, 0X75DA,
-  0X75FA, 0X7E3B, 0X761A, 0X75FA, 0X761B, 0X761B, 0X75FA, 0X75DA,
-  0X75B9, 0X75B9, 0X75DA, 0X75BA, 0X75FA, 0X7E1B, 0X7E3B, 0X761B,
-  0X7E1B, 0X7DFB, 0X75FA, 0X75FA, 0X75DA, 0X7DDA, 0X7DDA, 0X7DFA,
-  0X7E1B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B, 0X865B,
-  0X867C, 0X869C, 0X869C, 0X86BD, 0X86BD, 0X8EBD, 0X8EDD, 0X8EBD,
-  0X86BD, 0X86BD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EFD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8E9C,
-  0X869C, 0X869C, 0X869C, 0X867C, 0X867C, 0X865C, 0X865C, 0X865C,
-  0X865C, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B,
-  0X7DFB, 0X7DFB, 0X7DFA, 0X7DFA, 0X75FA, 0X761B, 0X761B, 0X7E1B,
-  0X761A, 0X75FA, 0X75FA, 0X75FA, 0X75FA, 0X75FA, 0X761A, 0X75FA,
-  0X75FA, 0X7E3B, 0X7E5B, 0X761A, 0X761B, 0X7E5C, 0X7E3B, 0X761B,
-  0X75FA, 0X761B, 0X761B, 0X7E3B, 0X7E5C, 0X7E5C, 0X7E3B, 0X7E3B,
-  0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7DFA, 0X7DFA, 0X7E1A, 0X7E1B,
-  0X7E3B, 0X7E3B, 0X7E5B, 0X7E3B, 0X7E3B, 0X865B, 0X865C, 0X867C,
-  0X867C, 0X869C, 0X86BD, 0X86BD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X8EFD,
-  0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X8E9C, 0X869C, 0X869C, 0X869C, 0X867C, 0X869C,
-  0X869C, 0X867C, 0X865C, 0X865B, 0X865B, 0X7E3B, 0X7E3B, 0X7E3B,
-  0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X7E5B, 0X7E5B, 0X7E3B, 0X7E3B, 0X7E5C, 0X7E7C, 0X7E7C,
-  0X7E5C, 0X7E5C, 0X7E5C, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E1B, 0X7E3B,
-  0X7E5B, 0X7E5B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7E1B, 0X7E3B, 0X7E3B,
-  0X7E3B, 0X865C, 0X867C, 0X867C, 0X865B, 0X867C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X8EFD, 0X96FD, 0X96FD, 0X96FD,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X8EFD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8E9D, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X865C, 0X865C, 0X865B,
-  0X865B, 0X863B, 0X863B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E5B, 0X7E5B,
-  0X7E5B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E5B, 0X7E5B,
-  0X7E5B, 0X7E5C, 0X7E7C, 0X7E7C, 0X7E5C, 0X7E7C, 0X7E9C, 0X7E5C,
-  0X7E5B, 0X7E3B, 0X7E3B, 0X7E1B, 0X7E3B, 0X7E3B, 0X7E3B, 0X7E5B,
-  0X865C, 0X867C, 0X7E5B, 0X865B, 0X7E5B, 0X7E5B, 0X865B, 0X865C,
-  0X865C, 0X867C, 0X869C, 0X869C, 0X869C, 0X867C, 0X869C, 0X86BD,
-  0X86BC, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EFD, 0X8EFD, 0X8EFD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X96FD,
-  0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X86BD, 0X869C, 0X869C, 0X869C, 0X867C, 0X867C, 0X867C,
-  0X867C, 0X867C, 0X865C, 0X865C, 0X865C, 0X865C, 0X867C, 0X867C,
-  0X7E7C, 0X7E5B, 0X7E5B, 0X7E5B, 0X7E5B, 0X7E5B, 0X7E5B, 0X7E7C,
-  0X867C, 0X7E7C, 0X869C, 0X869C, 0X867C, 0X869C, 0X869D, 0X869C,
-  0X7E7C, 0X7E5C, 0X7E5B, 0X7E5B, 0X7E5C, 0X7E5C, 0X865C, 0X865C,
-  0X867C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C,
-  0X869C, 0X869C, 0X869C, 0X86BD, 0X869C, 0X869C, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X8EFD,
-  0X96FD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FD, 0X96FD, 0X8EFD, 0X8EFD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EBD, 0X8EBD, 0X8EBD, 0X8EBC, 0X8E9C, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X867C, 0X867C, 0X867C, 0X869C,
-  0X869C, 0X867C, 0X867C, 0X867C, 0X865C, 0X865C, 0X867C, 0X867C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C,
-  0X867C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C, 0X867C,
-  0X869C, 0X869C, 0X867C, 0X867C, 0X869C, 0X869C, 0X869C, 0X869C,
-  0X86BD, 0X86BD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EFD, 0X8EFD, 0X8EFD, 0X96FD, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FD, 0X96FD, 0X96FD, 0X8EFD, 0X8EDD,
-  0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EBD, 0X8EBD, 0X8EBD, 0X8EBD,
-  0X8E9C, 0X8E9C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X86BD,
-  0X869D, 0X869C, 0X867C, 0X867C, 0X867C, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X86BC, 0X869C, 0X869C, 0X869D,
-  0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C, 0X869C,
-  0X869C, 0X869C, 0X869C, 0X86BD, 0X86BD, 0X86BD, 0X8EBD, 0X8EBD,
-  0X8EBD, 0X8EBD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD, 0X8EDD,
-  0X8EDD, 0X8EFD, 0X96FD, 0X96FD, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE,
-  0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE, 0X96FE };
+extern const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] asm("newtEye_sclera");
 
 #define IRIS_MAP_WIDTH  256
 #define IRIS_MAP_HEIGHT 64
 
-const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] PROGMEM= {
-  0X0841, 0X0841, 0X0841, 0X0841, 0X0021, 0X0842, 0X1042, 0X0861,
-  0X10C3, 0X18C3, 0X18E3, 0X1061, 0X0840, 0X0840, 0X1020, 0X0800,
-  0X1000, 0X3081, 0X3944, 0X3903, 0X1800, 0X1000, 0X69C5, 0XBC0E,
-  0X9B49, 0X48C0, 0X1800, 0X2860, 0XCD71, 0XF738, 0X8347, 0X50E0,
-  0X6983, 0X50C2, 0X1800, 0X3881, 0XAC0F, 0XA3CE, 0X59A6, 0X4123,
-  0X40E3, 0X40C3, 0X30A2, 0X30A2, 0X38C2, 0X3041, 0X3020, 0X3861,
-  0X3000, 0X2800, 0X7963, 0XAAC6, 0X68A0, 0X3800, 0X3800, 0X9324,
-  0XF774, 0XFFF8, 0XEDF0, 0XE5B0, 0XFF36, 0XF632, 0XE50E, 0XFE76,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFF56, 0XBBEA, 0X71C2, 0X8264, 0XBC8C,
-  0XE5D1, 0XE573, 0XB2A7, 0X6800, 0X8100, 0XD48B, 0XFDD0, 0XFCED,
-  0XF54D, 0XFEB2, 0XFFD7, 0XFF56, 0XFDAD, 0XF487, 0XF4A8, 0XF5CD,
-  0XFF75, 0XFFF7, 0XFF91, 0XEBA5, 0XA800, 0X8825, 0X78A6, 0X6002,
-  0X6002, 0X7084, 0X6883, 0X5000, 0X5800, 0X6040, 0X6122, 0X5942,
-  0X7A66, 0XC42D, 0XC44D, 0X61A4, 0X4000, 0X3000, 0X2801, 0X3002,
-  0X3823, 0X3801, 0X3000, 0X3800, 0X58C2, 0X81E5, 0X9A88, 0X7A25,
-  0X51A2, 0X5941, 0X5962, 0X5941, 0X68E1, 0X68C2, 0X68C2, 0X68C2,
-  0X60C3, 0X60E3, 0X6103, 0X6963, 0X6943, 0X60C2, 0X48C0, 0X7B88,
-  0XB610, 0XBE10, 0X952C, 0X9CEB, 0X9B88, 0X71C4, 0X5060, 0X5020,
-  0X5881, 0X4861, 0X4861, 0X4040, 0X4060, 0X4061, 0X40A2, 0X40C2,
-  0X40C2, 0X40C3, 0X5124, 0X5944, 0X4103, 0X2861, 0X2800, 0X3062,
-  0X3042, 0X3082, 0X3062, 0X30A2, 0X30A2, 0X38C2, 0X4102, 0X38E2,
-  0X3902, 0X3923, 0X38E2, 0X2881, 0X2041, 0X2861, 0X2861, 0X2020,
-  0X1820, 0X1020, 0X1800, 0X1821, 0X2042, 0X2041, 0X3041, 0X3882,
-  0X38C2, 0X3902, 0X49A3, 0X6265, 0X6286, 0X5204, 0X41A3, 0X2902,
-  0X2061, 0X2082, 0X2862, 0X2041, 0X2060, 0X2061, 0X2841, 0X30A3,
-  0X3081, 0X2020, 0X4940, 0X9BEA, 0XD5D2, 0XB50F, 0X8B49, 0X69E5,
-  0X48C1, 0X4921, 0X8B28, 0XC50F, 0XCD30, 0X9B8A, 0X6205, 0X5164,
-  0X4903, 0X38A3, 0X28C3, 0X28C3, 0X18A3, 0X1882, 0X10A2, 0X1082,
-  0X1082, 0X10A2, 0X18A2, 0X1882, 0X1082, 0X1061, 0X1041, 0X1061,
-  0X0861, 0X1061, 0X0861, 0X0841, 0X1041, 0X0821, 0X0841, 0X0800,
-  0X1000, 0X1041, 0X18E3, 0X2164, 0X29A5, 0X3A06, 0X4207, 0X39C5,
-  0X39E6, 0X4248, 0X3A07, 0X2124, 0X2103, 0X2904, 0X20E4, 0X20C3,
-  0X0841, 0X0841, 0X0841, 0X0841, 0X0021, 0X0841, 0X1882, 0X18A2,
-  0X18C2, 0X1903, 0X1903, 0X10C2, 0X0881, 0X1041, 0X2002, 0X48C3,
-  0X9AC7, 0XB369, 0X9AA7, 0XA2C8, 0X81E5, 0X4000, 0X9A48, 0XDC2D,
-  0XE4AC, 0XFE2F, 0XF5EF, 0XFE91, 0XFFD5, 0XFFF8, 0XE6D2, 0XB54D,
-  0XBD6E, 0XA42A, 0X6223, 0X40E1, 0X40E2, 0X40C2, 0X3881, 0X38A1,
-  0X3882, 0X3082, 0X2861, 0X2860, 0X2861, 0X2841, 0X2841, 0X3861,
-  0X0800, 0X59C6, 0XFFFD, 0XFF77, 0X9202, 0X79A1, 0XDEB4, 0XFFFF,
-  0XFFFE, 0XFED2, 0XD4EB, 0XFE71, 0XFED3, 0XE52C, 0XD428, 0XDC48,
-  0XDC69, 0XDBC8, 0XBAC3, 0X8980, 0X68E0, 0X9A84, 0XF572, 0XFF57,
-  0XFFFD, 0XFFFF, 0XFFFF, 0XFE76, 0XFCEE, 0XF4EC, 0XF44A, 0XF3A8,
-  0XF42A, 0XFCCC, 0XFDF0, 0XF611, 0XECEF, 0XECAD, 0XEDCE, 0XF6F3,
-  0XFFF7, 0XFFF8, 0XFFF4, 0XFE4C, 0XFB85, 0XEA07, 0XC988, 0XA105,
-  0X8001, 0X6800, 0X6861, 0X8A26, 0XA247, 0X88C2, 0X7101, 0X6122,
-  0X8A87, 0XD4CF, 0XD4CE, 0X7A25, 0X6081, 0X5800, 0X4000, 0X4000,
-  0X4003, 0X3802, 0X3000, 0X4001, 0X5882, 0X7965, 0X91E8, 0X7965,
-  0X5923, 0X61C5, 0X7A06, 0X7A26, 0X7205, 0X6984, 0X6924, 0X60E2,
-  0X50C1, 0X50A2, 0X5062, 0X4861, 0X48A1, 0X6124, 0X58E2, 0X4060,
-  0X2880, 0X28E0, 0X3980, 0X49C1, 0X5940, 0X58C0, 0X4820, 0X5000,
-  0X5040, 0X4840, 0X5060, 0X58A1, 0X5040, 0X4000, 0X4000, 0X4000,
-  0X4000, 0X4020, 0X3800, 0X2000, 0X3020, 0X4061, 0X2800, 0X3021,
-  0X3042, 0X2840, 0X2840, 0X3061, 0X3082, 0X38C2, 0X4103, 0X4103,
-  0X4124, 0X3924, 0X30A2, 0X2040, 0X2000, 0X2000, 0X2000, 0X1800,
-  0X2000, 0X2882, 0X4104, 0X38C3, 0X3882, 0X3020, 0X2000, 0X2800,
-  0X3061, 0X38C1, 0X38C1, 0X30C0, 0X3901, 0X51C3, 0X51E5, 0X30E3,
-  0X1841, 0X2021, 0X2042, 0X2042, 0X2020, 0X2020, 0X2040, 0X3103,
-  0X4965, 0X5983, 0X59A2, 0X7244, 0X8B28, 0X8307, 0X7266, 0X7A86,
-  0X82A7, 0X7265, 0X59E3, 0X4121, 0X38C1, 0X38C1, 0X2840, 0X2000,
-  0X2842, 0X3083, 0X30C3, 0X20A2, 0X1841, 0X1861, 0X1882, 0X1882,
-  0X18A2, 0X18C2, 0X20E3, 0X20E3, 0X18C3, 0X1081, 0X0820, 0X1041,
-  0X1061, 0X1061, 0X1061, 0X1061, 0X1061, 0X1061, 0X1041, 0X0841,
-  0X1001, 0X1021, 0X1842, 0X1061, 0X18A2, 0X20E3, 0X2944, 0X31A5,
-  0X31C6, 0X3A26, 0X3A27, 0X31C6, 0X2984, 0X31A5, 0X2965, 0X2124,
-  0X0841, 0X0021, 0X0842, 0X0861, 0X0821, 0X1062, 0X1082, 0X1082,
-  0X1062, 0X1061, 0X1061, 0X1040, 0X1000, 0X1800, 0X2862, 0X5122,
-  0X50A0, 0X3000, 0X8160, 0XFD2E, 0XC2E6, 0X7060, 0X7880, 0X8880,
-  0X6880, 0X7280, 0XF569, 0XFE2C, 0XCCA4, 0XAC23, 0XC54A, 0XCDAD,
-  0XB52D, 0XBD6E, 0XC56F, 0X8329, 0X38A1, 0X3060, 0X3880, 0X3061,
-  0X3020, 0X3040, 0X2860, 0X2840, 0X3041, 0X3082, 0X40C3, 0X50E3,
-  0X1800, 0X69A5, 0XDD51, 0XED4F, 0XFE93, 0XFFFC, 0XFFFF, 0XFFFA,
-  0XCD8D, 0XCD08, 0XDC68, 0XBB85, 0X9A82, 0XC3C7, 0XFD6C, 0XF4E9,
-  0XD3A5, 0XC324, 0X9A41, 0X89A0, 0XA243, 0XDCCE, 0XFDF4, 0XED31,
-  0XEDF3, 0XFFFD, 0XFFFB, 0XFDB1, 0XE48E, 0XE5F2, 0XF735, 0XF6B2,
-  0XED8E, 0XF50D, 0XED4D, 0XED6F, 0XFE14, 0XFF78, 0XFFFB, 0XFFFA,
-  0XFFF9, 0XFFF7, 0XFF94, 0XFE8F, 0XFD2B, 0XFC2A, 0XF2C8, 0XD185,
-  0XA000, 0X9000, 0XDB4B, 0XFF37, 0XFEF5, 0XC3EB, 0X9265, 0X71C3,
-  0X9329, 0XC50F, 0X9B28, 0X5040, 0X70A1, 0XAAA9, 0XA1E6, 0X6800,
-  0X6000, 0X5803, 0X4802, 0X5002, 0X5802, 0X6043, 0X5883, 0X5882,
-  0X6965, 0X7207, 0X7A47, 0X7A68, 0X7247, 0X7226, 0X6964, 0X58C2,
-  0X48C1, 0X5061, 0X4841, 0X4061, 0X4041, 0X4861, 0X50E2, 0X4881,
-  0X3800, 0X4020, 0X4060, 0X4060, 0X4860, 0X5840, 0X6060, 0X6081,
-  0X5861, 0X60A1, 0X7943, 0X91E5, 0X7984, 0X6101, 0X5060, 0X4000,
-  0X5020, 0X6861, 0X5800, 0X4102, 0X7BEA, 0X72A7, 0X1800, 0X4080,
-  0X3881, 0X2000, 0X2000, 0X3061, 0X3881, 0X38A2, 0X4903, 0X48E3,
-  0X40C3, 0X40C3, 0X3042, 0X2800, 0X2000, 0X2000, 0X2000, 0X2800,
-  0X3082, 0X4924, 0X5965, 0X5103, 0X48A0, 0X4060, 0X48A1, 0X5143,
-  0X5163, 0X4122, 0X3901, 0X4142, 0X59E4, 0X72C7, 0X72E9, 0X51E6,
-  0X30E2, 0X2882, 0X1861, 0X2041, 0X2041, 0X2041, 0X2021, 0X2882,
-  0X3904, 0X5164, 0X61A4, 0X7204, 0X8AE8, 0XA3AB, 0X9B69, 0X82A7,
-  0X69E5, 0X61C4, 0X59C3, 0X4122, 0X2880, 0X1841, 0X1820, 0X2040,
-  0X2882, 0X28A3, 0X1840, 0X1000, 0X1020, 0X1061, 0X1842, 0X1862,
-  0X18A2, 0X18A2, 0X18A2, 0X18A2, 0X18A2, 0X1081, 0X0841, 0X1041,
-  0X1061, 0X1061, 0X1061, 0X1061, 0X1061, 0X1061, 0X1041, 0X0841,
-  0X0800, 0X0800, 0X1020, 0X1021, 0X10A2, 0X18A3, 0X18C2, 0X18C3,
-  0X2104, 0X3185, 0X3164, 0X2903, 0X2103, 0X2144, 0X3185, 0X31A6,
-  0X0062, 0X0841, 0X0841, 0X0842, 0X0821, 0X0842, 0X1041, 0X1041,
-  0X1061, 0X1000, 0X1800, 0X2841, 0X3882, 0X4105, 0X5123, 0X5120,
-  0X2000, 0X7200, 0XFFFF, 0XFFFF, 0XFE10, 0X90E0, 0X9920, 0X7000,
-  0X1000, 0X3322, 0XCE94, 0XDD6B, 0X68E0, 0X48E0, 0X9C25, 0XC56C,
-  0XC5AF, 0XCE10, 0XD611, 0XAC6D, 0X59A3, 0X38C0, 0X40E0, 0X40E3,
-  0X40A2, 0X38A2, 0X3081, 0X3061, 0X3061, 0X38A3, 0X4905, 0X6986,
-  0X5081, 0X58A1, 0X89E5, 0XCC0C, 0XFF76, 0XFFFD, 0XFFFB, 0XB52C,
-  0XB4C8, 0XFE4D, 0XF4E9, 0XC322, 0XBC4C, 0XF7FF, 0XFFFF, 0XFF14,
-  0XE487, 0XEC28, 0XFD91, 0XFDB5, 0XED75, 0XF615, 0XE571, 0XC40B,
-  0XB40A, 0XCD8E, 0XCDCE, 0XCC6B, 0XDC2D, 0XFE94, 0XFFFA, 0XF7D8,
-  0XEF35, 0XFF35, 0XFF55, 0XFF96, 0XFFD8, 0XF7FA, 0XF7FA, 0XFFFA,
-  0XFFD9, 0XFFF9, 0XFFF8, 0XFF74, 0XF650, 0XF5EF, 0XFD6D, 0XF44B,
-  0XC984, 0XC985, 0XFCB0, 0XFF58, 0XFFF9, 0XFF76, 0XFE71, 0XF5F1,
-  0XFFFA, 0XFFFF, 0XDD10, 0X6860, 0XC32A, 0XFFFF, 0XFF9A, 0XB082,
-  0X8800, 0X9001, 0X9084, 0X8022, 0X7001, 0X5801, 0X5001, 0X6883,
-  0X7124, 0X6124, 0X40E3, 0X48E3, 0X40E3, 0X38A2, 0X4041, 0X4041,
-  0X4882, 0X4841, 0X4040, 0X4860, 0X4862, 0X50A2, 0X6144, 0X6143,
-  0X58E1, 0X5080, 0X4860, 0X5060, 0X5840, 0X68E2, 0X7943, 0X7923,
-  0X7123, 0X8184, 0X9225, 0X9AC7, 0X7A04, 0X8245, 0X79E4, 0X3800,
-  0X3800, 0X5000, 0X2800, 0X93AC, 0XFFFF, 0XFFFC, 0X93EC, 0X72A7,
-  0X5101, 0X3840, 0X38A1, 0X38A2, 0X3881, 0X40A1, 0X48C2, 0X4881,
-  0X4020, 0X3800, 0X3801, 0X3000, 0X3000, 0X3021, 0X3841, 0X4061,
-  0X4882, 0X50E3, 0X50A2, 0X5061, 0X58A0, 0X6080, 0X7943, 0X9A26,
-  0X9A46, 0XA36A, 0XD591, 0XBD30, 0X72C7, 0X51C4, 0X51C4, 0X4162,
-  0X3902, 0X2882, 0X2042, 0X1821, 0X1821, 0X1822, 0X1800, 0X1800,
-  0X2861, 0X38A2, 0X40C2, 0X4902, 0X69C5, 0X8AC8, 0XA36A, 0X8AE9,
-  0X61A5, 0X4922, 0X5143, 0X4943, 0X30C3, 0X1882, 0X1861, 0X1841,
-  0X1841, 0X1821, 0X1800, 0X1840, 0X1041, 0X1061, 0X1081, 0X1861,
-  0X1881, 0X18A2, 0X1081, 0X1861, 0X1082, 0X1041, 0X1041, 0X1041,
-  0X1041, 0X1041, 0X1041, 0X0841, 0X1061, 0X1041, 0X0841, 0X0841,
-  0X0821, 0X0820, 0X0800, 0X0801, 0X1041, 0X1062, 0X1082, 0X1882,
-  0X18A3, 0X1882, 0X1041, 0X1041, 0X1061, 0X1882, 0X2103, 0X2944,
-  0X0862, 0X0861, 0X0021, 0X0041, 0X0821, 0X0801, 0X0820, 0X0800,
-  0X1020, 0X1000, 0X1800, 0X2800, 0X4061, 0X6165, 0X69C5, 0X71E4,
-  0X8A83, 0XEDAE, 0XFFFD, 0XFFF5, 0XC3E7, 0XA181, 0XC9E2, 0X4000,
-  0X4100, 0XFFFF, 0XFFFF, 0XFFFF, 0XBD28, 0X8B20, 0XFF31, 0XFFFD,
-  0XFFB7, 0X8C08, 0X9429, 0XC4EE, 0X82A7, 0X48C0, 0X5101, 0X5123,
-  0X5924, 0X4903, 0X3881, 0X3061, 0X3881, 0X38A2, 0X3862, 0X4061,
-  0X3000, 0X3800, 0X4860, 0X5060, 0X6140, 0XA3A7, 0XFF13, 0XFFF8,
-  0XFFB4, 0XF5EC, 0XDC26, 0XEBE5, 0XFDCD, 0XFFFD, 0XFFFF, 0XFF35,
-  0XFD8B, 0XEC24, 0XFC66, 0XEC49, 0XE4CF, 0XFEFB, 0XFF9B, 0XEDF2,
-  0XD590, 0XEF15, 0XFF96, 0XF712, 0XF733, 0XFFF8, 0XFFF8, 0XFF97,
-  0XFFD8, 0XFFF8, 0XFFF8, 0XFFF9, 0XFFF8, 0XFFF8, 0XFFF9, 0XFFF9,
-  0XFFFA, 0XFFF9, 0XFFFA, 0XFFF9, 0XFFB6, 0XFF55, 0XFFB5, 0XFFF6,
-  0XFDB0, 0XECEF, 0XFE96, 0XFF79, 0XFFBA, 0XFFB8, 0XFEB2, 0XFE90,
-  0XFF74, 0XFF97, 0XF571, 0X9A26, 0XE4F1, 0XFFFF, 0XFFFF, 0XB9C5,
-  0X9800, 0X9000, 0X8800, 0X8800, 0X8000, 0X7000, 0X7801, 0XA166,
-  0XA1A7, 0X7146, 0X68E5, 0X8085, 0X7843, 0X5800, 0X5800, 0X5000,
-  0X5001, 0X4800, 0X4000, 0X4841, 0X5883, 0X6924, 0X79A5, 0X71A4,
-  0X6162, 0X58E1, 0X58C2, 0X58E2, 0X68C3, 0X7923, 0X8183, 0X8183,
-  0X81A3, 0X89E5, 0X81E5, 0X7A04, 0X7204, 0XB46C, 0XDD70, 0X82A6,
-  0X5121, 0X5060, 0X4800, 0X82C7, 0XBD50, 0XA50E, 0X6B27, 0X6A44,
-  0X69C3, 0X6982, 0X69A3, 0X5944, 0X5124, 0X50E2, 0X50A1, 0X4840,
-  0X4000, 0X4080, 0X5104, 0X61A5, 0X5964, 0X3000, 0X3800, 0X4840,
-  0X5081, 0X58C2, 0X5041, 0X5840, 0X8122, 0XA225, 0XA225, 0XA205,
-  0XA1E5, 0XA205, 0XAAA8, 0X8AC7, 0X6A45, 0X6245, 0X5A25, 0X51E4,
-  0X5163, 0X40C2, 0X38A2, 0X2881, 0X2020, 0X2020, 0X1800, 0X1000,
-  0X1800, 0X2842, 0X3082, 0X38A1, 0X4102, 0X48E3, 0X5184, 0X59C6,
-  0X4924, 0X38C2, 0X30A2, 0X30C2, 0X28A1, 0X1840, 0X1820, 0X1820,
-  0X1820, 0X1041, 0X1021, 0X1021, 0X1841, 0X1021, 0X1041, 0X1041,
-  0X1021, 0X1062, 0X1041, 0X1061, 0X1061, 0X0841, 0X1040, 0X0821,
-  0X0841, 0X0821, 0X0821, 0X0841, 0X0841, 0X0841, 0X0821, 0X0820,
-  0X0821, 0X0821, 0X0821, 0X0800, 0X1001, 0X1021, 0X1041, 0X1041,
-  0X1882, 0X20C2, 0X20A2, 0X1862, 0X0841, 0X1020, 0X20A2, 0X2944,
-  0X0001, 0X0001, 0X0021, 0X0021, 0X0000, 0X0000, 0X0000, 0X2923,
-  0X51E6, 0X3903, 0X4103, 0X38A1, 0X2000, 0X4060, 0X69C2, 0X8AC6,
-  0XA368, 0XA387, 0X7A64, 0X4960, 0X5960, 0XA204, 0XC245, 0X6800,
-  0XB165, 0XFFFF, 0XFFFF, 0XFFF9, 0XFFF6, 0XF68C, 0XEE6C, 0XFFF6,
-  0XE692, 0X49C0, 0X6A43, 0X92E7, 0X71E3, 0X6162, 0X6163, 0X6163,
-  0X69C4, 0X61A5, 0X48E3, 0X3881, 0X40A1, 0X40C2, 0X3001, 0X1800,
-  0X2800, 0X8AA8, 0XCC8F, 0XAB6B, 0X8A45, 0X6160, 0X9B25, 0X9BE7,
-  0X6200, 0X6160, 0XB3A2, 0XFD08, 0XFDEC, 0XFE0D, 0XE58C, 0XEDAD,
-  0XFDCC, 0XE465, 0XDB01, 0XD180, 0XC0C0, 0XC9E0, 0XE4AE, 0XF696,
-  0XFFD9, 0XFFFC, 0XFFFB, 0XFFF8, 0XFFF9, 0XFFFA, 0XFFF7, 0XFF76,
-  0XFF76, 0XFF55, 0XF776, 0XFFB5, 0XFF93, 0XFF93, 0XFFF5, 0XFFF7,
-  0XFFD6, 0XFFD5, 0XFFB7, 0XFFF9, 0XFFF9, 0XFFD7, 0XFFD7, 0XFFFA,
-  0XFF55, 0XF6D3, 0XFFD9, 0XFFD9, 0XF695, 0XEE12, 0XED2F, 0XDC6A,
-  0XE54D, 0XEDF0, 0XDC49, 0X9140, 0X8120, 0XBB08, 0XF530, 0XED10,
-  0XC308, 0X8941, 0X68E0, 0X9102, 0XDB0B, 0XF42F, 0XC229, 0X9042,
-  0X9041, 0X98E3, 0XA964, 0X9060, 0X7800, 0X8800, 0X6800, 0X6000,
-  0X7000, 0X7861, 0X78A1, 0X68C1, 0X5061, 0X58A2, 0X60E3, 0X58C2,
-  0X60E2, 0X6902, 0X58E2, 0X58C1, 0X60C1, 0X7102, 0X7142, 0X7142,
-  0X7122, 0X7123, 0X6922, 0X60C1, 0X79A4, 0XBC8C, 0XEE73, 0XD5B0,
-  0X9BA9, 0X7A45, 0X71C3, 0X69C4, 0X6205, 0X51A3, 0X38A0, 0X50C0,
-  0X6121, 0X71A3, 0X79E4, 0X71A3, 0X6963, 0X6944, 0X60A1, 0X58C0,
-  0X92C5, 0XAC6C, 0XACAE, 0XCD92, 0XBCEF, 0X51A3, 0X3840, 0X4000,
-  0X5020, 0X60E3, 0X6081, 0X68A1, 0XBAA8, 0XFC8F, 0XEC4E, 0XCB8A,
-  0XBAE8, 0X99E5, 0X8963, 0X8163, 0X79A4, 0X69E4, 0X6A25, 0X6A46,
-  0X69E5, 0X5163, 0X40E3, 0X3082, 0X2862, 0X2841, 0X2001, 0X1800,
-  0X1800, 0X1800, 0X2841, 0X38A2, 0X40A3, 0X3082, 0X2841, 0X2841,
-  0X2041, 0X2881, 0X2061, 0X1840, 0X1820, 0X1820, 0X2041, 0X1841,
-  0X1841, 0X1861, 0X1021, 0X1041, 0X1041, 0X1841, 0X1841, 0X1041,
-  0X1041, 0X1041, 0X1041, 0X0841, 0X1040, 0X1020, 0X0820, 0X0841,
-  0X0821, 0X0821, 0X1021, 0X0821, 0X0041, 0X0041, 0X0821, 0X0821,
-  0X0821, 0X0820, 0X0821, 0X0000, 0X0800, 0X0820, 0X1041, 0X0821,
-  0X0841, 0X1081, 0X1062, 0X1021, 0X0820, 0X0821, 0X0841, 0X1061,
-  0X1023, 0X1042, 0X1842, 0X1001, 0X0800, 0X1800, 0X2040, 0X4164,
-  0X5226, 0X4984, 0X4984, 0X5A06, 0X59A5, 0X61C4, 0X7A04, 0X71C3,
-  0X50E0, 0X38A0, 0X4101, 0X4900, 0X3040, 0X3800, 0X4000, 0X4800,
-  0XA0C0, 0XFC2C, 0XB221, 0X4000, 0X0800, 0X2000, 0X61A0, 0X5160,
-  0X2000, 0X2000, 0X5080, 0X6121, 0X5941, 0X6182, 0X6183, 0X5983,
-  0X6183, 0X7205, 0X61C5, 0X4903, 0X4903, 0X48E3, 0X3861, 0X1800,
-  0X2800, 0XAB6C, 0XFE54, 0XFE32, 0XFE32, 0XC409, 0X9262, 0X71A0,
-  0X69C1, 0X9325, 0XC56A, 0XEEAF, 0XFE8E, 0XED6A, 0XED6A, 0XFF95,
-  0XFFFA, 0XF771, 0XED49, 0XEC27, 0XD448, 0XC50C, 0XD653, 0XFFB9,
-  0XFFFA, 0XFF36, 0XEE53, 0XF6F4, 0XFFF9, 0XFFFB, 0XFFF9, 0XFF96,
-  0XF714, 0XEED3, 0XF734, 0XFF94, 0XF70F, 0XF6CD, 0XFF10, 0XFEF2,
-  0XF6AF, 0XF6AF, 0XF6F2, 0XFF76, 0XFFF8, 0XFFF8, 0XFFFA, 0XFFFD,
-  0XFFF9, 0XFE72, 0XFE92, 0XFF98, 0XFFD9, 0XFFFC, 0XFFFB, 0XFED5,
-  0XFF97, 0XFFFD, 0XFFF8, 0XFE72, 0XDD6E, 0XEE11, 0XFF76, 0XFFFB,
-  0XFFFB, 0XF7D9, 0XEFFD, 0XE759, 0XFE95, 0XFED8, 0XFEB9, 0XECD3,
-  0XB166, 0X98C1, 0XB9A4, 0XC163, 0XDAA6, 0XFC8E, 0XC225, 0X8840,
-  0X9861, 0XB944, 0XA984, 0X8122, 0X60C0, 0X5060, 0X6102, 0X7184,
-  0X7184, 0X6142, 0X5902, 0X58C1, 0X60E2, 0X7102, 0X60A1, 0X5860,
-  0X6080, 0X68C1, 0X7902, 0X78C1, 0X8921, 0X71A1, 0X8B46, 0XDD91,
-  0XCD2F, 0XA3A9, 0X7A44, 0X5922, 0X5102, 0X48E1, 0X4020, 0X5080,
-  0X6942, 0X71A4, 0X6122, 0X5080, 0X4860, 0X4000, 0X4040, 0X93CA,
-  0XFFFB, 0XEF35, 0XBD6F, 0XFF78, 0XFFB9, 0XB570, 0X72E7, 0X48C2,
-  0X4881, 0X7185, 0X6924, 0X68A1, 0X99C6, 0XC32A, 0XC38B, 0XBB49,
-  0XAAC7, 0XA286, 0XA286, 0XA266, 0X9226, 0X8206, 0X71E5, 0X6A06,
-  0X6205, 0X5164, 0X40E2, 0X38A2, 0X3082, 0X3061, 0X2862, 0X30A3,
-  0X38C3, 0X30A2, 0X3082, 0X3082, 0X3082, 0X2841, 0X2020, 0X1800,
-  0X1821, 0X1820, 0X1820, 0X1820, 0X1800, 0X1800, 0X1840, 0X1841,
-  0X1841, 0X1861, 0X1841, 0X1041, 0X1041, 0X1041, 0X1041, 0X1041,
-  0X1041, 0X1061, 0X0841, 0X0840, 0X1041, 0X1041, 0X1040, 0X1041,
-  0X0841, 0X0841, 0X1041, 0X0841, 0X0841, 0X0821, 0X0821, 0X0820,
-  0X0840, 0X0820, 0X0820, 0X0821, 0X0820, 0X0820, 0X0820, 0X0800,
-  0X0000, 0X0800, 0X0841, 0X0820, 0X0800, 0X0820, 0X0841, 0X0861,
-  0X2063, 0X1822, 0X1000, 0X1000, 0X2000, 0X3040, 0X2840, 0X3081,
-  0X4103, 0X3102, 0X28A1, 0X4144, 0X6228, 0X61E6, 0X5142, 0X5162,
-  0X38C0, 0X61C4, 0X9B4A, 0X61E5, 0X5A64, 0XB50D, 0XA3CA, 0X5040,
-  0X4000, 0X7840, 0XA9E4, 0X7900, 0X70C0, 0X7920, 0X8A61, 0XBBE9,
-  0XD44C, 0X8A85, 0X5940, 0X5100, 0X5942, 0X6162, 0X5963, 0X5143,
-  0X5163, 0X6A26, 0X6A05, 0X5143, 0X4904, 0X48E4, 0X40A2, 0X3020,
-  0X3800, 0X4882, 0X3060, 0X4960, 0XB469, 0XAB25, 0X70C0, 0X8940,
-  0XDC4B, 0XFFB7, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFA, 0XFF73, 0XFF72,
-  0XFFF6, 0XFFF6, 0XFFF4, 0XFFF8, 0XFFFC, 0XF7FD, 0XFFFC, 0XFFFB,
-  0XFFF8, 0XF6D3, 0XEE11, 0XEE72, 0XF734, 0XFFD7, 0XFFF7, 0XFF76,
-  0XF755, 0XF795, 0XFFD6, 0XFFF5, 0XFF31, 0XF64D, 0XF66E, 0XF6D0,
-  0XF6B0, 0XEE6F, 0XF733, 0XFFF9, 0XFFF9, 0XFF55, 0XFFB6, 0XFFF9,
-  0XFFF7, 0XF692, 0XEE50, 0XF6B4, 0XFF98, 0XFFFF, 0XFFFC, 0XFF36,
-  0XFFD8, 0XFFFE, 0XFFFD, 0XFFFB, 0XFFD7, 0XFF55, 0XF735, 0XFFB7,
-  0XFFF8, 0XFFFB, 0XFFFF, 0XFFFF, 0XFFFD, 0XFFFA, 0XFFBC, 0XFF1C,
-  0XD2AB, 0XB984, 0XDA67, 0XF30A, 0XFDD2, 0XFFFD, 0XFF35, 0XD4AD,
-  0XC36A, 0XC2E9, 0XC2C8, 0XB2C8, 0X9225, 0X7983, 0X7183, 0X79C4,
-  0X79E5, 0X71C4, 0X6162, 0X5922, 0X5902, 0X6122, 0X6081, 0X5840,
-  0X6081, 0X70E2, 0X7901, 0X78A0, 0X78C0, 0X5840, 0X6140, 0XC42B,
-  0XD4EE, 0XA3A9, 0X61C2, 0X48A0, 0X50C1, 0X58E2, 0X4860, 0X4880,
-  0X6121, 0X6942, 0X7983, 0XA266, 0X9A44, 0X8100, 0X9A21, 0XFFF9,
-  0XFFFF, 0XE6D3, 0XC56E, 0XF735, 0XE673, 0XCDB1, 0XB4EF, 0X6AC8,
-  0X6A05, 0X82C8, 0X71E6, 0X5881, 0X5861, 0X68E2, 0X7123, 0X60C1,
-  0X58C0, 0X81E4, 0XB329, 0XB329, 0XAAE8, 0X9AC8, 0X8246, 0X61A4,
-  0X5143, 0X4123, 0X3902, 0X38E2, 0X38A2, 0X3082, 0X38E3, 0X4944,
-  0X4965, 0X4965, 0X4123, 0X30C3, 0X2863, 0X2041, 0X1820, 0X1820,
-  0X1820, 0X1800, 0X1800, 0X1820, 0X1820, 0X1820, 0X1020, 0X1820,
-  0X1820, 0X1021, 0X1021, 0X1020, 0X1020, 0X1020, 0X1020, 0X1040,
-  0X1021, 0X1040, 0X1041, 0X1041, 0X1041, 0X0841, 0X0841, 0X1041,
-  0X0841, 0X0820, 0X0840, 0X0840, 0X0821, 0X0821, 0X0821, 0X0820,
-  0X0840, 0X0840, 0X0820, 0X0800, 0X0820, 0X0821, 0X0801, 0X0801,
-  0X0801, 0X0800, 0X0821, 0X0000, 0X0000, 0X0821, 0X0841, 0X0841,
-  0X2000, 0X1000, 0X0800, 0X2800, 0X3820, 0X3800, 0X50C2, 0X92A8,
-  0X82A8, 0X5164, 0X2860, 0X28A1, 0X3903, 0X38A2, 0X38C2, 0X3041,
-  0X2000, 0X3040, 0X40A1, 0X3060, 0X5A85, 0XEF77, 0XFFFD, 0XD734,
-  0X9429, 0X79C3, 0X68E1, 0X6963, 0X6162, 0X3000, 0X4040, 0X8266,
-  0XA369, 0X8266, 0X6A05, 0X5984, 0X5944, 0X5983, 0X4942, 0X5163,
-  0X6A46, 0X72A8, 0X59A5, 0X40E2, 0X38A3, 0X3882, 0X4882, 0X48A2,
-  0X58A2, 0X2000, 0X0000, 0X9CED, 0XFFFF, 0XF779, 0X71C0, 0X5800,
-  0XBA24, 0XFD91, 0XFFF8, 0XFFFD, 0XFFFF, 0XFFFB, 0XFFD3, 0XFF0E,
-  0XFEAE, 0XFE4D, 0XFE6D, 0XFFB3, 0XFFFA, 0XFFFC, 0XFFFA, 0XFFF7,
-  0XFF95, 0XFF55, 0XFF76, 0XF735, 0XF6F3, 0XF714, 0XFF55, 0XF734,
-  0XFF95, 0XFFF9, 0XFFF7, 0XFFD4, 0XF6AF, 0XEE2D, 0XF6F2, 0XFFF9,
-  0XFFFA, 0XFEF4, 0XF651, 0XFEF4, 0XFEF4, 0XF5F1, 0XF5B0, 0XFE32,
-  0XFE73, 0XF672, 0XE5F0, 0XEDF0, 0XFF76, 0XFFFF, 0XFFFE, 0XF733,
-  0XE6D0, 0XFFF6, 0XFFFB, 0XFFFC, 0XFFF9, 0XFFB6, 0XF754, 0XF735,
-  0XFF34, 0XFEF3, 0XFF98, 0XFFFD, 0XFFFC, 0XFFF7, 0XFED4, 0XFDB4,
-  0XD28A, 0XD227, 0XEAC8, 0XF36B, 0XFE95, 0XFFFF, 0XFFFF, 0XFFFD,
-  0XFF76, 0XCD2F, 0XBC0C, 0XC42C, 0XBBCB, 0X9B08, 0X8A45, 0X8204,
-  0X7A04, 0X79E5, 0X7A25, 0X71E4, 0X61A3, 0X6163, 0X60E2, 0X68A2,
-  0X78E3, 0X8984, 0XA205, 0XCB68, 0XDBCA, 0XA2C6, 0X81E3, 0X9265,
-  0XA328, 0X9AC7, 0X6941, 0X5040, 0X5041, 0X5041, 0X4840, 0X4840,
-  0X58E1, 0X6941, 0X9246, 0XD3EB, 0XCBA8, 0XA1A1, 0XC305, 0XFFFA,
-  0XFFF9, 0XAC28, 0X62E3, 0X7365, 0X8BA7, 0X7B06, 0X59A2, 0X51A3,
-  0X7AC8, 0X93AB, 0X72A7, 0X5143, 0X5102, 0X6943, 0X58E2, 0X4000,
-  0X4000, 0X7143, 0X9267, 0X9266, 0X8A46, 0X8246, 0X6182, 0X40C0,
-  0X38C0, 0X4142, 0X4163, 0X3901, 0X2881, 0X2861, 0X38C2, 0X4103,
-  0X4123, 0X4103, 0X4123, 0X30E2, 0X28A2, 0X2041, 0X1800, 0X1000,
-  0X1000, 0X1820, 0X1820, 0X1820, 0X1020, 0X1820, 0X1800, 0X1000,
-  0X1000, 0X1000, 0X1021, 0X1021, 0X1021, 0X1041, 0X1040, 0X1040,
-  0X1040, 0X1041, 0X1041, 0X1041, 0X0841, 0X0841, 0X0841, 0X0841,
-  0X0820, 0X0820, 0X0820, 0X0820, 0X0821, 0X0820, 0X0820, 0X0820,
-  0X0000, 0X0820, 0X0821, 0X0821, 0X0821, 0X0821, 0X0821, 0X0820,
-  0X0820, 0X0801, 0X0800, 0X0800, 0X0800, 0X0801, 0X0000, 0X0000,
-  0X38C1, 0X3880, 0X7247, 0XABAD, 0X71A5, 0X68E1, 0XCB6B, 0XCBED,
-  0X92C8, 0X5922, 0X3061, 0X2841, 0X2820, 0X4081, 0X48E2, 0X4081,
-  0X3861, 0X2820, 0X2000, 0X2000, 0X38E0, 0X7308, 0X83CB, 0X7348,
-  0X6AA5, 0X8AE7, 0XABAA, 0XA3AA, 0X9B49, 0X7A46, 0X61A3, 0X5982,
-  0X4100, 0X5101, 0X5163, 0X4903, 0X40E3, 0X4903, 0X48E2, 0X48E2,
-  0X6163, 0X5944, 0X50A1, 0X3820, 0X3020, 0X3020, 0X3820, 0X50C2,
-  0X7124, 0X4000, 0X1800, 0X93A7, 0XFFFF, 0XFFFF, 0XF7B5, 0X9344,
-  0X68E0, 0X81A2, 0XE550, 0XFFF9, 0XF7D4, 0XA568, 0X7BE1, 0X8B62,
-  0XA305, 0XB2E7, 0XD387, 0XFD0B, 0XFE6F, 0XFEAF, 0XFECE, 0XF70F,
-  0XF752, 0XFFF8, 0XFFFB, 0XFFFA, 0XFFF8, 0XFF95, 0XFF54, 0XFF12,
-  0XF712, 0XFF74, 0XFF95, 0XFED1, 0XEDAD, 0XEE30, 0XFFF9, 0XFFFB,
-  0XFFF8, 0XFF14, 0XF5F0, 0XED6E, 0XF5B0, 0XF5F1, 0XFDF1, 0XFE73,
-  0XFEB4, 0XFDB0, 0XECEE, 0XECAD, 0XDD4F, 0XE6F7, 0XFFFA, 0XFF53,
-  0XD62C, 0XDE4D, 0XEF33, 0XF7F5, 0XF7D5, 0XFFF6, 0XFFF8, 0XFFF9,
-  0XFFF8, 0XFED1, 0XEDAE, 0XEE2F, 0XEEF0, 0XF78F, 0XEDCA, 0XB2C2,
-  0XA142, 0XCA48, 0XC9C6, 0XB163, 0XCB29, 0XF633, 0XFFFD, 0XFFFF,
-  0XFFFB, 0XCE12, 0XA42B, 0XA3EA, 0XABEB, 0X9B48, 0X8A86, 0X8204,
-  0X6982, 0X69C3, 0X8246, 0X7A46, 0X6A05, 0X61E4, 0X6983, 0X7943,
-  0X8184, 0X9A05, 0XBAA7, 0XEC6D, 0XFD8F, 0XFDF1, 0XFE52, 0XFDD0,
-  0XD4AC, 0XA307, 0X60C0, 0X5000, 0X5821, 0X6082, 0X68A2, 0X6061,
-  0X60A1, 0X7162, 0X9A87, 0XC3AA, 0XC368, 0XA203, 0XC346, 0XFF13,
-  0XF5CE, 0XA305, 0X8AC4, 0X8AE5, 0X7A64, 0X5100, 0X40A0, 0X38C0,
-  0X59E4, 0X936A, 0X8B6A, 0X6A87, 0X5A05, 0X7AC7, 0X8B29, 0X8B0A,
-  0X8288, 0X7A05, 0X71C4, 0X6983, 0X6962, 0X6162, 0X5120, 0X5160,
-  0X6A43, 0X72C6, 0X6286, 0X5A05, 0X5184, 0X4123, 0X38E2, 0X38E2,
-  0X38E3, 0X4104, 0X4103, 0X30C2, 0X28A2, 0X1820, 0X1800, 0X1000,
-  0X1020, 0X1021, 0X1820, 0X1820, 0X1820, 0X1820, 0X1020, 0X1020,
-  0X1040, 0X1840, 0X1021, 0X1021, 0X1020, 0X1020, 0X0821, 0X1021,
-  0X1020, 0X1041, 0X1041, 0X1041, 0X0841, 0X1041, 0X0841, 0X0841,
-  0X0840, 0X0840, 0X0820, 0X0820, 0X0820, 0X0820, 0X0020, 0X0041,
-  0X0021, 0X0841, 0X0841, 0X0841, 0X0861, 0X0841, 0X0841, 0X1021,
-  0X0821, 0X0821, 0X0821, 0X0801, 0X0801, 0X0820, 0X0820, 0X0800,
-  0X61C6, 0X7A89, 0XFF5B, 0XFFFD, 0XAC2B, 0X9B08, 0XE4CF, 0XAAE7,
-  0X7983, 0X71C4, 0X71E6, 0X5103, 0X3020, 0X4061, 0X50E3, 0X58E3,
-  0X71A5, 0X69C5, 0X58E2, 0X50A1, 0X4943, 0X5A24, 0X61E5, 0X4901,
-  0X4920, 0X61E3, 0X6A04, 0X69E3, 0X61A2, 0X61A2, 0X6A23, 0X7244,
-  0X6A23, 0X6204, 0X61E5, 0X40C1, 0X3000, 0X3860, 0X4041, 0X4020,
-  0X4800, 0X5020, 0X6860, 0X70C2, 0X60C2, 0X4840, 0X4000, 0X5881,
-  0X7944, 0X78C2, 0X5000, 0X5060, 0XBDEC, 0XFFFF, 0XFFFF, 0XFFF4,
-  0X9BE6, 0X7A42, 0XB3CA, 0XD4EF, 0X9BA8, 0X5A42, 0X51A0, 0X6161,
-  0X7966, 0X91A8, 0XA247, 0XCB49, 0XF40A, 0XFC08, 0XFC89, 0XF5EC,
-  0XFF72, 0XFFF9, 0XFFFD, 0XFFFC, 0XFFF8, 0XFF95, 0XFF13, 0XFF52,
-  0XFFD3, 0XFF72, 0XFE91, 0XFE90, 0XFEF1, 0XFFF6, 0XFFFC, 0XFFFB,
-  0XFFF8, 0XFFF9, 0XFF33, 0XF58E, 0XFE53, 0XFF37, 0XFED5, 0XFEF6,
-  0XFE53, 0XE48D, 0XEC2C, 0XFC2D, 0XD38A, 0XBB4A, 0XE4CF, 0XFE74,
-  0XE5CF, 0XCCCA, 0XC50B, 0XC56C, 0XCE0D, 0XFFB3, 0XFFF8, 0XFFF8,
-  0XFFF6, 0XE66F, 0XE5CD, 0XD52A, 0XBC88, 0XBCA8, 0XB3E2, 0X8240,
-  0X9B44, 0XF50F, 0XFC8E, 0XA9C4, 0X6000, 0X4800, 0X6902, 0X6A64,
-  0X6305, 0X5243, 0X30A0, 0X2000, 0X48C0, 0X5942, 0X6982, 0X6161,
-  0X48E0, 0X48C0, 0X5962, 0X61C3, 0X69C3, 0X69C3, 0X69C3, 0X79E4,
-  0X8A05, 0X9A26, 0XBAE8, 0XD3CA, 0XEC8C, 0XFDB0, 0XFED4, 0XFEB3,
-  0XED2E, 0XB308, 0X9901, 0X8040, 0X7863, 0X7025, 0X6842, 0X6821,
-  0X6040, 0X6102, 0X9245, 0XAAA6, 0XA286, 0XA2A6, 0XD44B, 0XFDF0,
-  0XD46A, 0XAB26, 0XB327, 0X9264, 0X6941, 0X5060, 0X5060, 0X4840,
-  0X50E2, 0X7AC8, 0XA40C, 0X9BCB, 0X72C6, 0X8349, 0XC50F, 0XE634,
-  0XC510, 0X8308, 0X61E5, 0X5163, 0X5142, 0X61C2, 0X7A65, 0X9B89,
-  0XBC8C, 0X9C0A, 0X72A6, 0X6246, 0X5A25, 0X49A4, 0X3923, 0X3902,
-  0X4104, 0X4964, 0X4965, 0X4144, 0X30E3, 0X1841, 0X1820, 0X1021,
-  0X1020, 0X1020, 0X1000, 0X1020, 0X1020, 0X1000, 0X1020, 0X1020,
-  0X1020, 0X1021, 0X1020, 0X1020, 0X1020, 0X1000, 0X1000, 0X1000,
-  0X1020, 0X1020, 0X1020, 0X0820, 0X0820, 0X0821, 0X0821, 0X0821,
-  0X0820, 0X0820, 0X0820, 0X0820, 0X0820, 0X0820, 0X0820, 0X0820,
-  0X0820, 0X0820, 0X0820, 0X1020, 0X0820, 0X0800, 0X0820, 0X0820,
-  0X1020, 0X1041, 0X1021, 0X1021, 0X1021, 0X0801, 0X0841, 0X0821,
-  0X40E3, 0X6228, 0XDE16, 0XBD30, 0XB4AC, 0XFFF9, 0XFFFA, 0XE530,
-  0X8A87, 0X69A4, 0X6164, 0X50C2, 0X3861, 0X4061, 0X48A2, 0X5903,
-  0X7186, 0X7165, 0X6924, 0X6185, 0X59A5, 0X5963, 0X38A0, 0X40A1,
-  0X5922, 0X5921, 0X5121, 0X5941, 0X6161, 0X6140, 0X7160, 0X81E3,
-  0X8204, 0X79E3, 0X71C3, 0X6163, 0X60C1, 0X4840, 0X4000, 0X5000,
-  0X6000, 0X80A0, 0X9942, 0XC2A7, 0XD3AC, 0XB32A, 0X8184, 0X5020,
-  0X6080, 0X70E2, 0X6000, 0X5800, 0XABA6, 0XFFF8, 0XFFF8, 0XDF4F,
-  0XAD29, 0X8B65, 0X7263, 0X71E4, 0X6164, 0X5945, 0X6166, 0X7146,
-  0X8147, 0X8988, 0X99E8, 0X9A28, 0XB227, 0XCA68, 0XF3CC, 0XFDD0,
-  0XFEB3, 0XFF76, 0XFFF7, 0XFFF6, 0XF732, 0XEEB0, 0XF691, 0XFE73,
-  0XFDB2, 0XFC2D, 0XFBAA, 0XEBEA, 0XE42B, 0XEDAE, 0XFF13, 0XFF13,
-  0XFF13, 0XF7B4, 0XEE70, 0XED4D, 0XFEF4, 0XFFDA, 0XFF38, 0XFE75,
-  0XE4CE, 0XBB69, 0XCBEB, 0XFD10, 0XFCB0, 0XD249, 0XC9E8, 0XE2EB,
-  0XFB6C, 0XFBEE, 0XFC8E, 0XEC8E, 0XD4ED, 0XE6B1, 0XFFF6, 0XF7F4,
-  0XCECF, 0XE710, 0XFFFA, 0XFFFF, 0XFFFE, 0XFFFB, 0XFFB6, 0XE6D1,
-  0XE6D2, 0XFFB7, 0XFFD9, 0XFDB1, 0XA266, 0X68C1, 0X4800, 0X4000,
-  0X6162, 0X71E4, 0X5922, 0X50A0, 0X50A0, 0X50C0, 0X5900, 0X50C0,
-  0X5080, 0X58E0, 0X5100, 0X48E0, 0X4080, 0X48A0, 0X6141, 0X8225,
-  0X9247, 0X9A06, 0XA267, 0XAA86, 0XB265, 0XC328, 0XDC6C, 0XED0D,
-  0XC3C9, 0XA9C4, 0XB040, 0XB040, 0X9820, 0X7800, 0X6001, 0X80E4,
-  0X9965, 0XA287, 0XB348, 0XBB29, 0XB2E7, 0XCBEA, 0XFE12, 0XFD90,
-  0XBBE9, 0XC3C9, 0XBB27, 0X79A1, 0X6100, 0X81C4, 0X81E5, 0X5880,
-  0X3800, 0X50C1, 0X61C4, 0X5A05, 0X6204, 0X9369, 0XBC8D, 0XCD0F,
-  0XBC8E, 0X8B29, 0X59E4, 0X4122, 0X6225, 0X9BAA, 0XAC2B, 0XC4CD,
-  0XD54F, 0X9BCA, 0X61E4, 0X4142, 0X4163, 0X4163, 0X3923, 0X3903,
-  0X3103, 0X4144, 0X49C6, 0X49A5, 0X3944, 0X20C3, 0X1861, 0X1041,
-  0X1021, 0X1021, 0X1000, 0X1020, 0X1020, 0X1020, 0X1020, 0X1020,
-  0X1020, 0X1000, 0X0820, 0X0820, 0X1040, 0X1000, 0X1020, 0X1020,
-  0X1020, 0X1021, 0X0820, 0X0820, 0X0840, 0X0821, 0X0821, 0X0820,
-  0X0801, 0X0820, 0X0821, 0X0820, 0X0820, 0X0820, 0X0820, 0X0820,
-  0X0020, 0X0040, 0X0840, 0X1020, 0X0841, 0X0841, 0X1061, 0X1061,
-  0X1041, 0X1021, 0X1021, 0X1021, 0X1021, 0X1061, 0X1082, 0X1882,
-  0X2821, 0X4925, 0X6208, 0X4123, 0X7288, 0XC550, 0XAC8B, 0X7284,
-  0X4941, 0X48C2, 0X4062, 0X4021, 0X4861, 0X4882, 0X4862, 0X4882,
-  0X50C3, 0X5082, 0X50A2, 0X50E4, 0X50C3, 0X3020, 0X2800, 0X50A1,
-  0X7144, 0X6943, 0X6143, 0X6943, 0X7981, 0X99E3, 0X9941, 0X8040,
-  0X6080, 0X8142, 0X8983, 0X8162, 0X8142, 0X68A1, 0X6000, 0X7800,
-  0X88A0, 0X90E1, 0XA9A3, 0XD327, 0XFD70, 0XFE55, 0XD3CC, 0X68C1,
-  0X5020, 0X5880, 0X5800, 0X6000, 0X9103, 0XABCA, 0X73C5, 0X5362,
-  0X5B23, 0X5A41, 0X4960, 0X5123, 0X5904, 0X50C3, 0X5083, 0X5884,
-  0X60E5, 0X7125, 0X7926, 0X7104, 0X7903, 0X8123, 0XA206, 0XCB8A,
-  0XDBCB, 0XCB09, 0XB285, 0XBAE4, 0XC366, 0XCC09, 0XF4AC, 0XFC4D,
-  0XE329, 0XC247, 0XC227, 0XC248, 0XC268, 0XC2C9, 0XCB8A, 0XC3AA,
-  0XB3C9, 0XBC6A, 0XBC29, 0XD44A, 0XFE11, 0XFEB6, 0XFE55, 0XE46F,
-  0XAAE8, 0X9265, 0X9AE7, 0XC3EA, 0XE3CD, 0XD2AB, 0XB187, 0XB166,
-  0XCA08, 0XEAAC, 0XFB6E, 0XF36D, 0XCACA, 0XBB2A, 0XED30, 0XEDD0,
-  0XC48A, 0XCD2A, 0XE710, 0XD773, 0XF7FA, 0XFFFF, 0XFFFF, 0XFFF7,
-  0XEF74, 0XFFF8, 0XFFFA, 0XFEB3, 0XBBEB, 0X9AC8, 0X7984, 0X60C1,
-  0X6922, 0X7163, 0X6123, 0X58C2, 0X48A0, 0X50E1, 0X71A4, 0XA307,
-  0XC40A, 0XBBE9, 0XB3A8, 0XCCAB, 0XD4CC, 0X8A63, 0X50E0, 0X71C2,
-  0X9286, 0X91E4, 0X8964, 0X91A4, 0X9102, 0X8060, 0X8900, 0X9242,
-  0X8A62, 0X91C1, 0XB8C0, 0XD8A0, 0XD860, 0XC8E0, 0XCA45, 0XDB08,
-  0XA9C4, 0XA205, 0XCB49, 0XD38A, 0XD3AA, 0XE44D, 0XFD90, 0XCBEA,
-  0XB367, 0XCC0A, 0XA2C5, 0X6120, 0X6122, 0XB329, 0XC3CB, 0X9226,
-  0X58A1, 0X5060, 0X50A0, 0X38C0, 0X2840, 0X2880, 0X3900, 0X51C3,
-  0X7266, 0X7246, 0X5143, 0X4922, 0X936A, 0XCD10, 0XD550, 0XD58F,
-  0XD54F, 0XABCA, 0X7204, 0X40E1, 0X30C1, 0X3903, 0X3923, 0X3102,
-  0X28C2, 0X3124, 0X49C6, 0X49A5, 0X3123, 0X20A2, 0X1881, 0X1861,
-  0X1021, 0X1021, 0X1020, 0X1000, 0X1000, 0X1000, 0X1000, 0X1000,
-  0X0800, 0X0800, 0X0800, 0X0801, 0X1001, 0X0800, 0X0800, 0X1020,
-  0X1020, 0X0821, 0X0841, 0X0821, 0X0841, 0X0821, 0X0821, 0X0820,
-  0X0820, 0X1020, 0X0820, 0X0821, 0X0841, 0X0841, 0X0840, 0X0820,
-  0X0840, 0X0840, 0X0841, 0X0840, 0X0820, 0X1020, 0X1020, 0X1041,
-  0X1042, 0X1882, 0X1061, 0X1041, 0X1042, 0X1841, 0X1881, 0X18A2,
-  0X3062, 0X5986, 0X5124, 0X3082, 0X51A7, 0X6228, 0X3922, 0X30A0,
-  0X40C1, 0X40C1, 0X2840, 0X48E4, 0X79E6, 0X58A3, 0X3800, 0X3000,
-  0X3021, 0X4862, 0X4063, 0X3042, 0X4082, 0X4020, 0X4861, 0X5902,
-  0X6123, 0X6944, 0X6103, 0X5861, 0X6060, 0X88E0, 0X7800, 0X6800,
-  0XCC6B, 0XFFFD, 0XFDF4, 0X89A2, 0X5820, 0X78C3, 0X88C3, 0X90A2,
-  0XA102, 0XA162, 0XB1C4, 0XCA65, 0XEC09, 0XFD4E, 0XD40B, 0XB2A7,
-  0X8163, 0X60C0, 0X5880, 0X6040, 0X7021, 0X6061, 0X2860, 0X2120,
-  0X3181, 0X3941, 0X4903, 0X5104, 0X50C4, 0X4021, 0X3000, 0X4001,
-  0X5043, 0X5843, 0X5001, 0X5802, 0X89A7, 0X99E7, 0X7123, 0X6921,
-  0X81C3, 0XA265, 0XCB49, 0XE3A9, 0XE347, 0XE327, 0XF3CA, 0XEBA9,
-  0XC286, 0XAA05, 0XA1E7, 0XA1C8, 0XA9E9, 0XA9A8, 0XA167, 0X9146,
-  0X78C1, 0X9164, 0XB2C9, 0XBB6C, 0XBBCB, 0XCBEC, 0XBBCB, 0X9288,
-  0X9246, 0XD40D, 0XFE55, 0XFED6, 0XD3AD, 0XB248, 0XA1A6, 0XA186,
-  0XA9A6, 0XB1C8, 0XC22A, 0XCA2A, 0XB1A8, 0XA9A8, 0XCACC, 0XD32B,
-  0XC2A8, 0XCB88, 0XB407, 0X8BC4, 0XAD8D, 0XF7F9, 0XFFF9, 0XDF52,
-  0XCE2E, 0XEF52, 0XFF94, 0XE5CF, 0XC46C, 0XC42D, 0XBBAC, 0X9A88,
-  0X7984, 0X6102, 0X60E2, 0X58C2, 0X50E2, 0X5923, 0X71C5, 0X92C7,
-  0XB3A8, 0XB3C8, 0XB409, 0XD52C, 0XF60F, 0XC4CA, 0X93C7, 0XA48A,
-  0XB4CC, 0XAB89, 0X9A25, 0XA1A4, 0XAA06, 0X9942, 0X6800, 0X6900,
-  0X8BE8, 0XA54C, 0XCC05, 0XF280, 0XFA40, 0XFB04, 0XFC8A, 0XFCAC,
-  0XE2E6, 0XCA04, 0XC285, 0XBA65, 0XB265, 0XC328, 0XC36A, 0X9224,
-  0X91C3, 0XAAC6, 0X8A24, 0X5901, 0X5943, 0X92C8, 0XBBAB, 0XAAE9,
-  0X7183, 0X6121, 0X79E3, 0X7AA4, 0X7284, 0X7B07, 0X7B48, 0X51C3,
-  0X3000, 0X5000, 0X6082, 0X5882, 0X79E6, 0XA3AB, 0XD530, 0XF673,
-  0XEE12, 0XCC8D, 0X9AE7, 0X6183, 0X40E2, 0X38C3, 0X4124, 0X3943,
-  0X28C2, 0X28E2, 0X3964, 0X3964, 0X28A2, 0X1861, 0X1861, 0X1861,
-  0X1841, 0X1841, 0X1021, 0X1000, 0X1000, 0X1000, 0X1800, 0X1820,
-  0X1800, 0X1000, 0X0800, 0X0800, 0X0800, 0X0820, 0X0820, 0X0820,
-  0X0800, 0X0800, 0X0800, 0X0820, 0X0840, 0X0800, 0X0800, 0X0820,
-  0X0820, 0X0800, 0X0800, 0X0820, 0X1041, 0X1040, 0X0840, 0X1040,
-  0X1040, 0X1020, 0X0821, 0X1000, 0X1020, 0X1020, 0X1841, 0X1061,
-  0X1062, 0X0840, 0X0820, 0X1000, 0X1021, 0X1021, 0X1041, 0X1861,
-  0X2040, 0X7ACA, 0X3902, 0X1000, 0X2000, 0X0000, 0X0800, 0X2800,
-  0X2800, 0X2881, 0X38A2, 0X4081, 0X6144, 0X92C9, 0X81A5, 0X8124,
-  0X8126, 0X68C5, 0X4802, 0X4002, 0X3801, 0X3000, 0X2800, 0X3800,
-  0X4880, 0X48A1, 0X4061, 0X3800, 0X4020, 0X6040, 0XA100, 0XFE74,
-  0XFFFF, 0XFFFF, 0XFFFA, 0X9327, 0X5961, 0X79A4, 0X8944, 0X8082,
-  0X9080, 0X98C0, 0XB183, 0XC9E4, 0XC203, 0XAA82, 0XBB26, 0XE42B,
-  0XBB07, 0X68E0, 0X5040, 0X6902, 0X7943, 0X6882, 0X4820, 0X4082,
-  0X40E3, 0X40C3, 0X48A4, 0X4884, 0X4863, 0X4042, 0X3801, 0X3800,
-  0X4800, 0X5801, 0X6000, 0X7800, 0XA9A6, 0XC2AA, 0XB268, 0XAAC8,
-  0XC3AA, 0XC3CB, 0XCBEA, 0XDBEB, 0XE3AA, 0XF3CA, 0XFCAD, 0XF40B,
-  0XB285, 0XA1E4, 0X99A6, 0X99A8, 0XA1E9, 0X99A8, 0X9168, 0X8987,
-  0X7925, 0X8947, 0XA1EA, 0X9A4A, 0X9248, 0X9AAA, 0X92C9, 0X6102,
-  0X7164, 0XDC6F, 0XFF18, 0XFF17, 0XBB6A, 0X81A4, 0X7943, 0X91A5,
-  0XA248, 0XAA69, 0XAA08, 0XA187, 0X90E6, 0X9926, 0XB1A8, 0XB188,
-  0XB988, 0XD269, 0XBA46, 0X7940, 0X82A3, 0XBD4B, 0XBE0D, 0XA58A,
-  0XA4E8, 0XBD09, 0XC4C9, 0XBC68, 0XC48B, 0XD4F0, 0XDCD0, 0XC3CC,
-  0X89E6, 0X60E2, 0X58C3, 0X60E3, 0X6103, 0X6144, 0X5925, 0X5962,
-  0X69E0, 0X8AC3, 0XA3C7, 0XBCAA, 0XD58D, 0XCD8C, 0XC58C, 0XE6B1,
-  0XEEF2, 0XC52D, 0X92A5, 0X9163, 0XB1A5, 0XB9A4, 0XB982, 0XDCEC,
-  0XE7FF, 0XFFFF, 0XFFFF, 0XFF71, 0XFDED, 0XFD4C, 0XFD4C, 0XFDEE,
-  0XFD2D, 0XF3C9, 0XE2E6, 0XC264, 0XB244, 0XBA86, 0X9A04, 0X7961,
-  0X6900, 0X7962, 0X6963, 0X48E3, 0X4081, 0X3880, 0X6183, 0X71C4,
-  0X6962, 0X92A6, 0XBC2A, 0XBC4A, 0X9345, 0XC52E, 0XFFFB, 0XFF57,
-  0X7A25, 0X4000, 0X5000, 0X60C3, 0X5841, 0X4800, 0X5040, 0X8A46,
-  0XA349, 0X9AE7, 0X79C4, 0X5901, 0X4081, 0X4082, 0X4125, 0X3925,
-  0X30C2, 0X20A2, 0X28C2, 0X28C3, 0X20A2, 0X1882, 0X1862, 0X1862,
-  0X2062, 0X2061, 0X1861, 0X1820, 0X2061, 0X28C3, 0X3924, 0X4125,
-  0X40E3, 0X30A2, 0X2061, 0X2081, 0X1841, 0X1820, 0X1840, 0X1041,
-  0X1821, 0X1020, 0X0800, 0X0820, 0X0821, 0X0800, 0X0820, 0X1020,
-  0X1020, 0X1020, 0X1020, 0X0840, 0X1040, 0X1040, 0X1041, 0X1041,
-  0X1060, 0X1060, 0X1060, 0X1040, 0X1881, 0X20A2, 0X2903, 0X2923,
-  0X1862, 0X1000, 0X1000, 0X1021, 0X1042, 0X1021, 0X1041, 0X1041,
-  0X5125, 0X2040, 0X3141, 0XE6D6, 0XFFBB, 0X932B, 0X4081, 0X0800,
-  0X2800, 0X8A68, 0X71E5, 0X49A4, 0XD6D8, 0XFFFF, 0XDD6F, 0X89E0,
-  0X7000, 0X7800, 0XA144, 0XA125, 0X6021, 0X4883, 0X58A3, 0X5021,
-  0X4000, 0X3800, 0X3800, 0X4000, 0X6143, 0X92C7, 0XDBAB, 0XFCF0,
-  0XFD2F, 0X9222, 0X3800, 0X3080, 0X49A1, 0X5A02, 0X6162, 0X68E1,
-  0X8081, 0X8820, 0XA942, 0XD225, 0XC1E4, 0XB223, 0XC366, 0XFD0E,
-  0XEC8C, 0X9224, 0X6901, 0X89C4, 0X9206, 0X81A4, 0X68C2, 0X5001,
-  0X4001, 0X3801, 0X3821, 0X4002, 0X3822, 0X3820, 0X3800, 0X4800,
-  0X7000, 0X98E5, 0XB185, 0XB1A2, 0XB141, 0XB162, 0XC266, 0XD38A,
-  0XED0F, 0XFE94, 0XFEB5, 0XFD92, 0XFC6E, 0XFCAE, 0XFD70, 0XFCEE,
-  0XCB07, 0X99E3, 0X8944, 0X9126, 0X8966, 0X8105, 0X6063, 0X6043,
-  0X6883, 0X70A3, 0X7905, 0X8166, 0X8186, 0X81C7, 0X8207, 0X7144,
-  0X7965, 0XB30A, 0XDCAF, 0XD44C, 0X8A24, 0X71A2, 0X8204, 0X9A66,
-  0XB329, 0XC3AC, 0XBB8B, 0XA288, 0X78A3, 0X7843, 0X9126, 0XA9C8,
-  0XB229, 0XB207, 0XBA26, 0XB1C5, 0XA9E4, 0XB307, 0XCD2D, 0XFFB4,
-  0XEF11, 0XAC27, 0X92C2, 0XAB64, 0XC429, 0XB3CB, 0XA34A, 0X9309,
-  0X79C4, 0X58C1, 0X60C3, 0X6904, 0X58E3, 0X40C2, 0X3881, 0X38A1,
-  0X5961, 0X7AA4, 0XA3E7, 0XBCCA, 0XC50B, 0XBCEA, 0XCD6D, 0XFF34,
-  0XFFF7, 0XEEB2, 0X9BA8, 0X8101, 0XA122, 0XC205, 0XE245, 0XFC09,
-  0XFF98, 0XFFFF, 0XFFFF, 0XFFF9, 0XFFF7, 0XFF12, 0XF64D, 0XF792,
-  0XFFF7, 0XFE73, 0XFC6B, 0XE2E6, 0XC2A5, 0XBAA6, 0X91A3, 0X7902,
-  0X6102, 0X5902, 0X50E3, 0X48A2, 0X4041, 0X3840, 0X3000, 0X3800,
-  0X6921, 0XBBC9, 0XED6F, 0XDD2D, 0XABA7, 0XD50D, 0XFF36, 0XF653,
-  0X8AA7, 0X58A1, 0X5841, 0X6903, 0X6903, 0X5881, 0X5800, 0X5860,
-  0X4840, 0X3000, 0X3820, 0X48A0, 0X4060, 0X3840, 0X40C4, 0X38E4,
-  0X28A3, 0X2061, 0X2882, 0X28A2, 0X28A3, 0X2062, 0X1862, 0X1842,
-  0X1841, 0X1841, 0X1841, 0X1840, 0X2042, 0X38E3, 0X51C6, 0X7269,
-  0X6A69, 0X59C7, 0X4144, 0X30E2, 0X28C2, 0X2082, 0X1861, 0X1841,
-  0X1841, 0X1041, 0X1020, 0X1020, 0X1020, 0X1020, 0X1020, 0X1040,
-  0X1041, 0X1841, 0X1841, 0X1040, 0X1041, 0X1020, 0X1841, 0X1861,
-  0X1040, 0X1820, 0X1820, 0X1881, 0X20A2, 0X28E3, 0X2904, 0X2924,
-  0X28C3, 0X20A3, 0X1862, 0X18A2, 0X1882, 0X1041, 0X1021, 0X1021,
-  0X7228, 0X4903, 0XA42D, 0XFFFF, 0XFFFF, 0XF5D4, 0XB40D, 0X5123,
-  0X6165, 0X930A, 0XD4CF, 0XFFFF, 0XFFFF, 0XFFFF, 0XB448, 0X73A0,
-  0X7B20, 0XA2E3, 0XBB66, 0X9182, 0X8020, 0X7001, 0X5801, 0X4800,
-  0X4020, 0X4881, 0X4841, 0X4021, 0X4041, 0X69A4, 0XA349, 0XABC9,
-  0X7A84, 0X4100, 0X4100, 0X61C2, 0X6A24, 0X4981, 0X38C0, 0X48A0,
-  0X7060, 0X8000, 0XA943, 0XD286, 0XD286, 0XC2A6, 0XC367, 0XF4CD,
-  0XFD4F, 0XDC2B, 0XAAC7, 0XA246, 0X9A06, 0X89C5, 0X7142, 0X58A1,
-  0X4841, 0X3800, 0X3800, 0X3000, 0X3821, 0X4061, 0X5020, 0X6800,
-  0X8062, 0XA9E6, 0XEB0B, 0XFB6B, 0XF2E8, 0XFA87, 0XFB08, 0XFBCA,
-  0XF4CD, 0XFE53, 0XFF17, 0XFDF3, 0XFC6E, 0XF42C, 0XFCAE, 0XFD2F,
-  0XF44D, 0XB2A7, 0X89A4, 0X8985, 0X89A6, 0X9186, 0X8165, 0X7925,
-  0X78E5, 0X70E4, 0X7104, 0X7925, 0X7105, 0X7144, 0X7165, 0X7965,
-  0X7944, 0X9165, 0X91A4, 0X70E0, 0X58E0, 0X9285, 0XDC6C, 0XDCCE,
-  0XBBCB, 0XB3AA, 0XCC8E, 0XD4CE, 0X9B09, 0X60C3, 0X6002, 0X7883,
-  0X80E4, 0X78C2, 0X8101, 0XB266, 0XCB28, 0XB265, 0XAAA6, 0XED90,
-  0XFFF9, 0XF611, 0XAAA5, 0X81A1, 0X79E2, 0X8245, 0X8A46, 0X8266,
-  0X79C4, 0X68E2, 0X5881, 0X5020, 0X5081, 0X48E1, 0X4901, 0X7267,
-  0X93CB, 0X9389, 0XAC4A, 0XEE11, 0XF690, 0XBCEA, 0XAC8A, 0XE631,
-  0XFFB7, 0XFF75, 0XACEC, 0X8264, 0XAA04, 0XCAA7, 0XEAE7, 0XFB68,
-  0XFD2D, 0XFE33, 0XF672, 0XF772, 0XFFF3, 0XFF50, 0XF7F5, 0XFFFE,
-  0XFFFF, 0XFFF7, 0XFD8F, 0XFB28, 0XDAE7, 0XCAE7, 0XA1A4, 0X8103,
-  0X6903, 0X50E2, 0X48E2, 0X4882, 0X3821, 0X4021, 0X4020, 0X4820,
-  0X7121, 0XA307, 0XCC8B, 0XE4ED, 0XCC2A, 0XBBE9, 0XCC8C, 0XBC2B,
-  0X7A04, 0X60A1, 0X6060, 0X7903, 0X7944, 0X7123, 0X68E2, 0X5880,
-  0X3800, 0X6963, 0XF5F2, 0XF613, 0X9308, 0X5122, 0X4081, 0X3882,
-  0X2862, 0X2021, 0X2841, 0X2862, 0X2882, 0X2062, 0X1841, 0X1821,
-  0X1821, 0X1800, 0X1800, 0X1800, 0X1820, 0X2061, 0X3903, 0X49A5,
-  0X4985, 0X38C3, 0X3082, 0X3061, 0X2861, 0X2061, 0X1840, 0X1820,
-  0X1840, 0X1820, 0X1040, 0X1020, 0X1840, 0X1041, 0X1020, 0X1040,
-  0X1041, 0X1841, 0X1841, 0X1040, 0X1040, 0X1020, 0X1020, 0X1040,
-  0X1020, 0X1020, 0X1041, 0X1841, 0X1861, 0X1840, 0X1061, 0X1881,
-  0X18A2, 0X18A3, 0X20C3, 0X18A3, 0X1882, 0X1862, 0X1041, 0X1041,
-  0X5165, 0X5924, 0X9A89, 0X9288, 0X3040, 0X2000, 0X40E2, 0X5944,
-  0X69C7, 0X8229, 0XAB4A, 0XC44B, 0XA388, 0X8326, 0XAC6B, 0XFFFB,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFA, 0XFFF6, 0XEED5, 0X61C3, 0X3000,
-  0X58A2, 0X6124, 0X4881, 0X50A2, 0X50A2, 0X5103, 0X5923, 0X5142,
-  0X4121, 0X2860, 0X4962, 0X6A65, 0X6A25, 0X5141, 0X40C0, 0X4060,
-  0X5880, 0X8081, 0X9923, 0XB1E5, 0XAA05, 0X99C4, 0X99E4, 0XAAC6,
-  0XC349, 0XBB29, 0XAA86, 0X89C4, 0X81A4, 0X7163, 0X7143, 0X6963,
-  0X6143, 0X50E3, 0X4061, 0X3800, 0X3821, 0X4062, 0X60C3, 0X8903,
-  0X9923, 0X9964, 0XC207, 0XFC6F, 0XFF38, 0XFFBA, 0XFD31, 0XE266,
-  0XC265, 0XE40B, 0XFD0F, 0XEC2B, 0XCB07, 0XC266, 0XC2A7, 0XDBCB,
-  0XEC6E, 0XB2C9, 0X8144, 0X70E4, 0X7925, 0X8185, 0X81A6, 0X8186,
-  0X78E5, 0X68A4, 0X6904, 0X8186, 0X7966, 0X7144, 0X60E2, 0X6082,
-  0X6041, 0X90C3, 0XB944, 0XB944, 0XC2C6, 0XCBE9, 0XE4ED, 0XFD90,
-  0XED0F, 0XDC6D, 0XDC8E, 0XDCAE, 0XB38B, 0X79C5, 0X60A3, 0X70C3,
-  0X70A2, 0X6860, 0X8102, 0XBAC8, 0XEC4D, 0XDBAA, 0XAA46, 0XB328,
-  0XDCEF, 0XCC4D, 0XA2A6, 0X9224, 0X8A04, 0X8A45, 0X8245, 0X8225,
-  0X81E4, 0X7163, 0X60C1, 0X60A0, 0X7123, 0X6963, 0X69E5, 0XBCAF,
-  0XEE96, 0XBD0F, 0X8B68, 0X82C6, 0X7AC4, 0X8B05, 0XA3C8, 0XA409,
-  0X8B88, 0X8387, 0X94EC, 0XDE32, 0XF50F, 0XDB68, 0XE327, 0XFB68,
-  0XFBC8, 0XFC07, 0XF4AA, 0XFE2E, 0XFE8D, 0XFE6C, 0XFF6F, 0XFFB1,
-  0XFF0F, 0XFDEC, 0XFC49, 0XFB48, 0XFB49, 0XE2E7, 0XB205, 0X8925,
-  0X68E4, 0X50A2, 0X4882, 0X4061, 0X4041, 0X4021, 0X2000, 0X2000,
-  0X6000, 0X7941, 0X89C3, 0XAB07, 0XAB27, 0XA2C6, 0XC3EA, 0XE4EE,
-  0XB368, 0X7102, 0X68C2, 0X8165, 0X8185, 0X6903, 0X60A2, 0X5882,
-  0X4841, 0X71A5, 0X9BCA, 0X9BCA, 0XAC2C, 0X9B8A, 0X59C3, 0X4101,
-  0X38E2, 0X30A2, 0X3082, 0X2862, 0X2861, 0X2081, 0X2061, 0X2000,
-  0X1000, 0X1000, 0X1000, 0X1820, 0X2040, 0X2041, 0X2040, 0X2020,
-  0X2000, 0X1820, 0X2020, 0X2020, 0X2000, 0X2000, 0X2020, 0X1820,
-  0X1840, 0X1841, 0X1841, 0X1841, 0X2061, 0X1861, 0X1840, 0X1041,
-  0X1040, 0X1040, 0X1020, 0X1020, 0X1020, 0X1020, 0X1020, 0X1020,
-  0X1020, 0X1000, 0X1020, 0X1040, 0X1040, 0X1020, 0X1020, 0X1000,
-  0X1021, 0X1862, 0X20C2, 0X20C3, 0X20C3, 0X1882, 0X1041, 0X1021,
-  0X48E5, 0X48A4, 0X4042, 0X2000, 0X2000, 0X48E3, 0X5946, 0X5945,
-  0X5966, 0X6146, 0X6040, 0X4800, 0XA346, 0XFFFB, 0XFFFF, 0XFFFF,
-  0XFFFB, 0XFFF3, 0XFF71, 0XF773, 0XFFFD, 0XFFFF, 0XDEF3, 0X840A,
-  0X836A, 0X48E1, 0X48A1, 0X5923, 0X6184, 0X5943, 0X4081, 0X40A0,
-  0X38A1, 0X30A1, 0X5A45, 0X7329, 0X6205, 0X48E1, 0X48C1, 0X48C0,
-  0X5080, 0X68A0, 0X78E2, 0X80E2, 0X7902, 0X68E1, 0X60A0, 0X5880,
-  0X60C0, 0X68E1, 0X68C1, 0X7121, 0X7102, 0X60C1, 0X7983, 0X9AC8,
-  0XA309, 0X8A68, 0X69C6, 0X48E3, 0X4081, 0X50E4, 0X6145, 0X7944,
-  0X8924, 0X88E3, 0X8081, 0XAA47, 0XFF58, 0XFFFF, 0XFFFF, 0XCAC7,
-  0X9840, 0XB9E5, 0XD2E8, 0XCAA6, 0XCA86, 0XC225, 0XA142, 0X9163,
-  0X8164, 0X6062, 0X5862, 0X60A3, 0X60A3, 0X6103, 0X6905, 0X6925,
-  0X68C5, 0X5023, 0X60A4, 0X81C7, 0X9249, 0X89C7, 0X7104, 0X7062,
-  0X7022, 0X9103, 0XA924, 0XB945, 0XE36A, 0XE48D, 0XE4EE, 0XFDD1,
-  0XFE12, 0XFD2F, 0XD42C, 0XB38A, 0X9AC8, 0X81E5, 0X6903, 0X68C3,
-  0X6862, 0X6040, 0X78E2, 0XB2A8, 0XE44D, 0XE42C, 0XAAA6, 0X81C4,
-  0X7983, 0X81C4, 0X9266, 0XAB08, 0XB308, 0X9AC7, 0X8A45, 0X79E4,
-  0X79C4, 0X7183, 0X6122, 0X6902, 0X81A4, 0X79A5, 0X71E6, 0XA3CC,
-  0XC531, 0XA44D, 0X7B07, 0X69E3, 0X5920, 0X69C2, 0X8A85, 0X8AA5,
-  0X7A24, 0X69C2, 0X7AA5, 0XC4EE, 0XF590, 0XEBC9, 0XE2C3, 0XF306,
-  0XFB68, 0XFBE9, 0XFD0C, 0XFD8C, 0XFD2A, 0XFD09, 0XFD49, 0XFC06,
-  0XF384, 0XF384, 0XF385, 0XEAE4, 0XD9E1, 0XC1A0, 0XB162, 0X88E4,
-  0X60A3, 0X5042, 0X4801, 0X4041, 0X4021, 0X2800, 0X0000, 0X4205,
-  0X93E8, 0X2000, 0X3000, 0X78E2, 0X79C2, 0X6981, 0XBBA9, 0XFE95,
-  0XE4EF, 0X79A3, 0X7943, 0X7964, 0X7103, 0X60E2, 0X7144, 0X79A5,
-  0X7164, 0X7A47, 0X8309, 0X82E7, 0X8307, 0X72C6, 0X6224, 0X59C3,
-  0X4962, 0X4142, 0X4122, 0X38C2, 0X28A1, 0X2881, 0X2061, 0X2020,
-  0X1800, 0X2081, 0X28C2, 0X28C3, 0X2882, 0X2861, 0X2020, 0X2020,
-  0X2020, 0X2840, 0X2020, 0X2000, 0X1800, 0X2000, 0X2021, 0X2020,
-  0X2021, 0X2061, 0X2041, 0X2021, 0X2042, 0X1861, 0X1841, 0X1861,
-  0X1841, 0X1840, 0X1061, 0X1041, 0X1061, 0X1061, 0X1060, 0X1040,
-  0X1040, 0X1041, 0X1841, 0X1020, 0X1040, 0X1020, 0X1820, 0X1840,
-  0X1861, 0X18A2, 0X1862, 0X1821, 0X1041, 0X1041, 0X1021, 0X1842,
-  0X3002, 0X2803, 0X4045, 0X48A4, 0X5925, 0X61A6, 0X61A6, 0X8A89,
-  0XA32D, 0X8A69, 0X3000, 0X0000, 0X6940, 0XDCEC, 0XFF56, 0XFFFA,
-  0XFE72, 0XCCC8, 0XED8A, 0XFF53, 0XFFF6, 0XC62E, 0X83C8, 0XA4EE,
-  0XB52F, 0X6AA6, 0X59C4, 0X82C9, 0XABEC, 0X7A47, 0X48C2, 0X48C2,
-  0X4080, 0X3061, 0X59C5, 0X7287, 0X59A4, 0X4880, 0X50C1, 0X5942,
-  0X6101, 0X6921, 0X7942, 0X7902, 0X7922, 0X79A3, 0X6962, 0X6122,
-  0X6142, 0X6942, 0X8183, 0X9A25, 0X9A05, 0X81A4, 0X9266, 0XBBAB,
-  0XC44E, 0XAB8C, 0X7A07, 0X5124, 0X40C2, 0X48C3, 0X5104, 0X5904,
-  0X68C2, 0X6840, 0X4800, 0X5000, 0XC42D, 0XFFFF, 0XFFFF, 0XDCEE,
-  0X9901, 0X90C1, 0X9101, 0XB1C4, 0XC226, 0XBA05, 0XA9C4, 0X9963,
-  0X68A2, 0X4800, 0X4822, 0X5083, 0X5062, 0X5062, 0X5063, 0X50A3,
-  0X5084, 0X4001, 0X4042, 0X58A4, 0X58E5, 0X60E5, 0X5862, 0X6020,
-  0X7841, 0X9904, 0XC207, 0XE30B, 0XFCF0, 0XFDB2, 0XFD4F, 0XECCE,
-  0XECAD, 0XDC4B, 0XBB69, 0X9A66, 0X81A5, 0X7143, 0X60C2, 0X60A2,
-  0X6082, 0X6042, 0X68C2, 0X91C5, 0XB2A8, 0XA267, 0X81A3, 0X7182,
-  0X6962, 0X89E5, 0XAB09, 0XB329, 0X9AC7, 0X8225, 0X6983, 0X6122,
-  0X58E1, 0X58E1, 0X58E1, 0X6101, 0X79A4, 0X79E5, 0X6943, 0X5143,
-  0X51C4, 0X7287, 0X82E8, 0X7204, 0X58E1, 0X6101, 0X71A3, 0X81C4,
-  0X7163, 0X60E1, 0X6942, 0X9287, 0XB309, 0XB267, 0XB1E3, 0XBA22,
-  0XE2C4, 0XFBE9, 0XFCAC, 0XFC8B, 0XFBEA, 0XFB88, 0XFAE6, 0XF1E2,
-  0XEA01, 0XEB24, 0XFCEB, 0XFD6E, 0XEBA8, 0XC9C1, 0XA0C0, 0X7881,
-  0X6042, 0X5023, 0X5021, 0X5021, 0X3800, 0X0000, 0X0000, 0XDFFC,
-  0XFFFF, 0XCE33, 0X2800, 0X4800, 0X91C5, 0X7162, 0X8A04, 0XC3AA,
-  0X9AA6, 0X79A3, 0X81A4, 0X7985, 0X6923, 0X6923, 0X81E7, 0X9ACA,
-  0X92CA, 0X8AA9, 0X82A9, 0X7287, 0X6205, 0X59E4, 0X59E3, 0X59E3,
-  0X5A23, 0X6244, 0X6245, 0X51C4, 0X3902, 0X28A1, 0X1840, 0X2881,
-  0X4165, 0X6A69, 0X6A88, 0X49A5, 0X30C2, 0X2881, 0X2861, 0X3040,
-  0X3881, 0X3081, 0X3061, 0X2840, 0X2821, 0X2800, 0X2000, 0X2000,
-  0X2820, 0X2841, 0X2841, 0X2821, 0X2841, 0X2041, 0X1840, 0X1841,
-  0X1841, 0X1020, 0X1820, 0X1021, 0X1021, 0X1821, 0X1041, 0X1061,
-  0X1061, 0X1061, 0X1861, 0X1841, 0X1861, 0X1841, 0X1881, 0X20A1,
-  0X28E3, 0X2904, 0X20C3, 0X1882, 0X18A2, 0X1061, 0X1020, 0X1041,
-  0X2043, 0X3064, 0X3886, 0X48C5, 0X5966, 0X5945, 0X50E4, 0X79E7,
-  0X6985, 0X60A3, 0X70E3, 0XDD72, 0XFFFF, 0XFF98, 0XA346, 0X79E2,
-  0X6942, 0X7162, 0X9264, 0XAB47, 0XB3AA, 0X7A84, 0X59C2, 0X6225,
-  0X6A66, 0X6226, 0X61E5, 0X6A67, 0X7AE9, 0X6A26, 0X5124, 0X58E3,
-  0X5861, 0X5000, 0X5000, 0X4840, 0X4000, 0X5060, 0X6122, 0X7142,
-  0X7183, 0X81C4, 0X99E5, 0X8984, 0X8162, 0X81C3, 0X79C3, 0X6983,
-  0X6963, 0X6142, 0X69A3, 0X8A06, 0X9226, 0X81C5, 0X7985, 0X7184,
-  0X71A4, 0X5942, 0X48C1, 0X38A1, 0X38C2, 0X38C2, 0X40C2, 0X38A2,
-  0X48E2, 0X6163, 0X58A0, 0X3800, 0X7983, 0XFDB1, 0XFE12, 0XA307,
-  0X81A4, 0X8944, 0X8902, 0X9122, 0X88E2, 0X88C1, 0X9101, 0X8921,
-  0X6081, 0X4000, 0X4821, 0X4862, 0X4842, 0X4821, 0X4062, 0X3862,
-  0X3041, 0X3021, 0X3021, 0X3842, 0X3802, 0X4062, 0X5061, 0X68E2,
-  0X7061, 0X90E3, 0XBA26, 0XDB0A, 0XF44E, 0XFD0F, 0XEC4C, 0XBB07,
-  0X9A24, 0X91C3, 0X89C4, 0X89A3, 0X7963, 0X68C2, 0X5841, 0X5842,
-  0X6904, 0X6925, 0X60C3, 0X58C3, 0X6904, 0X68E2, 0X68E0, 0X6942,
-  0X6963, 0X9266, 0XBBAB, 0XB36A, 0X9267, 0X71C4, 0X6963, 0X6162,
-  0X5902, 0X48A1, 0X58C1, 0X6943, 0X8A46, 0X92C8, 0X7A06, 0X5942,
-  0X4943, 0X7267, 0X8AE9, 0X7A26, 0X6123, 0X58E3, 0X6123, 0X6943,
-  0X6102, 0X5881, 0X60A1, 0X68E3, 0X7924, 0X8144, 0X8942, 0XA1A3,
-  0XD307, 0XFC09, 0XFBC8, 0XFAE6, 0XEA03, 0XD942, 0XE1C4, 0XFAA7,
-  0XF2A6, 0XF367, 0XFDAF, 0XFF15, 0XFE12, 0XFC4C, 0XDAA6, 0X9942,
-  0X7040, 0X6841, 0X6082, 0X6842, 0X3000, 0X0000, 0X11A2, 0XFFFF,
-  0XFFFF, 0XFFFC, 0X4181, 0X4800, 0X68A0, 0X7141, 0XB2C7, 0XC349,
-  0X8A04, 0X7982, 0X89E5, 0X9247, 0X81E6, 0X79A4, 0X81E7, 0X8A69,
-  0X7A06, 0X6164, 0X6165, 0X6165, 0X5944, 0X5964, 0X59A4, 0X59A3,
-  0X59C3, 0X7A65, 0X82E7, 0X6A66, 0X51C4, 0X38E2, 0X2040, 0X1820,
-  0X30E2, 0X51E5, 0X6A67, 0X6246, 0X4984, 0X30C1, 0X2840, 0X2820,
-  0X3881, 0X40C2, 0X48E3, 0X5124, 0X5123, 0X40C2, 0X3020, 0X2800,
-  0X2840, 0X3081, 0X3082, 0X3081, 0X2881, 0X2881, 0X2041, 0X1861,
-  0X1840, 0X1040, 0X1840, 0X1861, 0X1040, 0X1041, 0X1021, 0X1041,
-  0X1021, 0X1021, 0X1841, 0X1861, 0X1862, 0X2082, 0X28C2, 0X30C3,
-  0X3103, 0X3923, 0X3103, 0X20A2, 0X1040, 0X1020, 0X1041, 0X1020,
-  0X2064, 0X2863, 0X3084, 0X48E5, 0X50C5, 0X4842, 0X4861, 0X5924,
-  0X60C2, 0X7103, 0XA30B, 0XFFFB, 0XFFFF, 0XFF17, 0XB48C, 0X8B67,
-  0X59E6, 0X4945, 0X50E5, 0X4883, 0X6105, 0X6944, 0X48C2, 0X3861,
-  0X4082, 0X48C2, 0X5103, 0X5985, 0X4123, 0X2880, 0X4080, 0X7103,
-  0X80E2, 0X7020, 0X6800, 0X5800, 0X6881, 0X60A1, 0X5820, 0X70C2,
-  0X7943, 0X81A4, 0X89E5, 0X7142, 0X6060, 0X68A0, 0X58C0, 0X4060,
-  0X4860, 0X4880, 0X4880, 0X4060, 0X2800, 0X1000, 0X2800, 0X5000,
-  0X60A1, 0X58C1, 0X48A1, 0X40A2, 0X40A2, 0X4104, 0X38C3, 0X2020,
-  0X38E2, 0X832B, 0XAC0D, 0X7A67, 0X58E2, 0X60E1, 0X60E0, 0X6101,
-  0X7143, 0X7122, 0X60A0, 0X5000, 0X4800, 0X6000, 0X7020, 0X78A0,
-  0X6081, 0X4000, 0X4000, 0X4841, 0X4022, 0X4042, 0X3861, 0X3841,
-  0X3000, 0X2800, 0X3021, 0X3001, 0X2802, 0X2821, 0X4861, 0X68E3,
-  0X70A2, 0X80C3, 0XA1A4, 0XA1A3, 0XA184, 0X99A3, 0X8121, 0X68C0,
-  0X6900, 0X7141, 0X6902, 0X60A1, 0X60C2, 0X5861, 0X5042, 0X5062,
-  0X50A3, 0X50A3, 0X4842, 0X4042, 0X4882, 0X5081, 0X5081, 0X58E2,
-  0X5902, 0X79C4, 0X92A7, 0X8A46, 0X6983, 0X6142, 0X6182, 0X6983,
-  0X5943, 0X50E2, 0X58C2, 0X6123, 0X79C5, 0X71C5, 0X5902, 0X5942,
-  0X7A46, 0X8AC8, 0X7A67, 0X69C4, 0X6143, 0X6123, 0X6103, 0X58E2,
-  0X50A2, 0X5061, 0X5061, 0X5861, 0X5861, 0X6060, 0X6881, 0X8923,
-  0XCB0A, 0XE3CB, 0XD2E6, 0XD265, 0XF245, 0XE204, 0XE245, 0XEAA6,
-  0XE224, 0XE9E4, 0XFBAA, 0XFE52, 0XFED5, 0XFD50, 0XE328, 0XA142,
-  0X7060, 0X6060, 0X5861, 0X6882, 0X6822, 0X3000, 0X1800, 0X8C2B,
-  0XC6F6, 0X956E, 0X5AA4, 0X69A2, 0X5040, 0X4000, 0X8A24, 0XE4CD,
-  0XCB69, 0X7921, 0X91C4, 0XA2A7, 0X9246, 0X79E4, 0X6984, 0X6165,
-  0X5903, 0X4882, 0X48A2, 0X50E3, 0X50E3, 0X5904, 0X6144, 0X5903,
-  0X5902, 0X8226, 0X9B69, 0X72A6, 0X51A3, 0X4923, 0X40A2, 0X3820,
-  0X2800, 0X3060, 0X51E4, 0X72E7, 0X6A47, 0X4923, 0X2840, 0X2040,
-  0X3081, 0X4903, 0X5964, 0X5944, 0X5944, 0X5944, 0X40C2, 0X3041,
-  0X3041, 0X3061, 0X3062, 0X3082, 0X30A2, 0X28A2, 0X2882, 0X2082,
-  0X1861, 0X1860, 0X1861, 0X1861, 0X1061, 0X1061, 0X1861, 0X1061,
-  0X1040, 0X1020, 0X1841, 0X1860, 0X1841, 0X2061, 0X28C2, 0X30C2,
-  0X28C2, 0X30C3, 0X38C3, 0X2882, 0X2021, 0X1800, 0X1000, 0X1000,
-  0X2864, 0X2064, 0X2864, 0X38A4, 0X4043, 0X4022, 0X58A3, 0X6903,
-  0X6924, 0X89E7, 0XC40E, 0XF654, 0XEE74, 0XA46D, 0X8B68, 0X7B49,
-  0X6288, 0X61A7, 0X50E5, 0X4043, 0X5084, 0X4864, 0X3801, 0X4042,
-  0X4862, 0X4040, 0X58A1, 0X58E2, 0X3840, 0X3840, 0X6902, 0X91A5,
-  0X9163, 0X9143, 0XC328, 0XFE54, 0XFE74, 0X9A26, 0X4800, 0X5840,
-  0X68E1, 0X6902, 0X58A1, 0X4800, 0X5040, 0X7963, 0X71C3, 0X5140,
-  0X61A2, 0X7A04, 0X6963, 0X40A0, 0X40E0, 0X5A64, 0X6B48, 0X4962,
-  0X2800, 0X3800, 0X50A2, 0X50E3, 0X5124, 0X5986, 0X4924, 0X2020,
-  0X30A2, 0X8B4B, 0XD5B4, 0XBCF0, 0X7A87, 0X6983, 0X6162, 0X50C0,
-  0X4860, 0X5040, 0X4020, 0X4020, 0X6162, 0X8182, 0X78C1, 0X6880,
-  0X68A1, 0X5040, 0X4020, 0X4020, 0X3800, 0X3021, 0X3001, 0X3041,
-  0X3000, 0X2801, 0X2801, 0X3001, 0X2802, 0X2802, 0X4020, 0X5841,
-  0X6883, 0X78E3, 0X8102, 0X78C1, 0X78C1, 0X8922, 0X7902, 0X6902,
-  0X7122, 0X7122, 0X68E2, 0X60E3, 0X60E3, 0X58A2, 0X50A2, 0X4862,
-  0X4862, 0X4061, 0X4021, 0X4021, 0X4041, 0X4061, 0X4862, 0X50A2,
-  0X50C1, 0X6122, 0X6984, 0X6142, 0X5921, 0X5942, 0X6183, 0X6163,
-  0X5122, 0X48C2, 0X50A2, 0X58C2, 0X6123, 0X6103, 0X50C1, 0X5943,
-  0X7A26, 0X8287, 0X7205, 0X69A4, 0X6984, 0X6924, 0X58C2, 0X4840,
-  0X4020, 0X4820, 0X4020, 0X4840, 0X5020, 0X5800, 0X5000, 0X70C2,
-  0XB289, 0XBAC9, 0X9A25, 0XB225, 0XE2A7, 0XF308, 0XFB28, 0XF307,
-  0XE265, 0XDA04, 0XF2C7, 0XFC0A, 0XFC2B, 0XDAE6, 0XB1C3, 0X9121,
-  0X7880, 0X6860, 0X5840, 0X5882, 0X68A3, 0X6022, 0X4000, 0X1800,
-  0X0000, 0X1860, 0X7285, 0X82A6, 0X60E0, 0X58E0, 0XCD4E, 0XFFFB,
-  0XEE10, 0X8A84, 0XA224, 0XAA65, 0X8A04, 0X7182, 0X5922, 0X5924,
-  0X58C3, 0X4862, 0X4041, 0X4041, 0X4041, 0X4021, 0X4041, 0X4841,
-  0X6103, 0XA2C9, 0XC3CC, 0XAB29, 0X71A3, 0X5901, 0X50A0, 0X4840,
-  0X4800, 0X4000, 0X5020, 0X69C4, 0X8B09, 0X7A67, 0X50E2, 0X3040,
-  0X3061, 0X40C2, 0X48E2, 0X40C2, 0X4903, 0X5965, 0X5945, 0X5104,
-  0X48C3, 0X3881, 0X2840, 0X2820, 0X2820, 0X2861, 0X2062, 0X2061,
-  0X2061, 0X1881, 0X1881, 0X1861, 0X1841, 0X1060, 0X1060, 0X1040,
-  0X0800, 0X0800, 0X1000, 0X1820, 0X1861, 0X1800, 0X2041, 0X2860,
-  0X2000, 0X2000, 0X2800, 0X2800, 0X2821, 0X2000, 0X1800, 0X1801,
-  0X3064, 0X38A5, 0X3865, 0X2802, 0X3002, 0X50A3, 0X7986, 0XA2AA,
-  0X8A48, 0X48A2, 0X6A47, 0XB490, 0X938C, 0X59C5, 0X40E3, 0X5165,
-  0X5145, 0X48C4, 0X4043, 0X3801, 0X4022, 0X4023, 0X4003, 0X4843,
-  0X4863, 0X4883, 0X6124, 0X7164, 0X8205, 0X8A06, 0X91E5, 0X9A05,
-  0XAA46, 0XBA87, 0XE3CB, 0XFF18, 0XFE55, 0X91E4, 0X58A0, 0X6902,
-  0X6902, 0X58C2, 0X58A2, 0X6922, 0X8A65, 0XA3CA, 0XBCCD, 0XE5F1,
-  0XFE73, 0XCCED, 0X61E3, 0X3020, 0X7284, 0XFFFD, 0XFFFF, 0XFFFF,
-  0X736A, 0X3080, 0X4081, 0X48E3, 0X4944, 0X59A6, 0X5966, 0X38A3,
-  0X2820, 0X38A1, 0X4122, 0X30A0, 0X1800, 0X1800, 0X2800, 0X4040,
-  0X6102, 0X6962, 0X6162, 0X7286, 0XD5D0, 0XFF14, 0XCC0B, 0X8943,
-  0X78C1, 0X7103, 0X60E3, 0X50A2, 0X4842, 0X3821, 0X3000, 0X2820,
-  0X2820, 0X2821, 0X2801, 0X2801, 0X3002, 0X3001, 0X3800, 0X4000,
-  0X5000, 0X5821, 0X70C2, 0X8143, 0X8123, 0X8922, 0X7902, 0X7123,
-  0X6944, 0X58E2, 0X50A1, 0X58C2, 0X50C3, 0X48A3, 0X4882, 0X4882,
-  0X4061, 0X4021, 0X3821, 0X4021, 0X4041, 0X4041, 0X4862, 0X4862,
-  0X4881, 0X48A1, 0X50C2, 0X5101, 0X5121, 0X5963, 0X5983, 0X5102,
-  0X48C1, 0X4882, 0X4061, 0X4882, 0X48A2, 0X48A1, 0X50C2, 0X5922,
-  0X6184, 0X71C5, 0X69A4, 0X6163, 0X6123, 0X58E2, 0X5061, 0X4040,
-  0X4020, 0X4040, 0X4020, 0X4041, 0X4841, 0X5020, 0X5020, 0X6881,
-  0X78E2, 0X7902, 0X7943, 0X9A05, 0XC2C7, 0XEB8A, 0XFC0B, 0XFBEA,
-  0XEAE6, 0XCA04, 0XD204, 0XDAC6, 0XCA64, 0XA940, 0X90C0, 0X9101,
-  0X88C3, 0X78A2, 0X6061, 0X5861, 0X5861, 0X6083, 0X6063, 0X4061,
-  0X4102, 0X7267, 0X82C9, 0X7246, 0X8223, 0XAB88, 0XFF76, 0XFFFE,
-  0XFFFB, 0XE755, 0XD4EC, 0XA243, 0X7100, 0X60E0, 0X6102, 0X50A2,
-  0X4882, 0X4021, 0X3800, 0X3000, 0X3000, 0X3800, 0X4841, 0X5082,
-  0X5081, 0X6943, 0XA2A8, 0XBB8B, 0X9A87, 0X6101, 0X4000, 0X4000,
-  0X4000, 0X4000, 0X5000, 0X68A0, 0X8244, 0X61C1, 0X40C0, 0X40A0,
-  0X3800, 0X2000, 0X2800, 0X3061, 0X38A1, 0X48C2, 0X48E3, 0X40E3,
-  0X40A2, 0X4061, 0X3860, 0X3040, 0X2800, 0X2020, 0X2040, 0X2061,
-  0X2061, 0X1881, 0X18A2, 0X1861, 0X1840, 0X1040, 0X1060, 0X1000,
-  0X1000, 0X1000, 0X2000, 0X38E2, 0X4944, 0X2820, 0X1800, 0X2000,
-  0X2000, 0X2000, 0X0000, 0X1800, 0X48C0, 0X5962, 0X2840, 0X0000,
-  0X30A4, 0X3083, 0X2843, 0X2802, 0X3822, 0X4863, 0X50C4, 0X79C7,
-  0X6966, 0X5965, 0X59E6, 0X7249, 0X59A6, 0X3061, 0X1800, 0X3041,
-  0X50E4, 0X48A4, 0X3000, 0X3801, 0X3801, 0X2800, 0X3800, 0X3800,
-  0X5001, 0X81E7, 0X81A5, 0X89C6, 0X9A89, 0X9226, 0X7964, 0X91A4,
-  0XAAC8, 0XBB6A, 0XC34A, 0XAAE9, 0X81C4, 0X5060, 0X4860, 0X68E2,
-  0X7143, 0X7985, 0X8227, 0X9B4A, 0X9BC9, 0X7AC5, 0X7285, 0X82E7,
-  0X8328, 0X6AA5, 0X6244, 0X5961, 0X5941, 0X9C4C, 0XEFBA, 0XE779,
-  0X8C8D, 0X5226, 0X4123, 0X38C2, 0X3903, 0X4103, 0X40C3, 0X3082,
-  0X3041, 0X3020, 0X3000, 0X38C1, 0X7A67, 0XA38B, 0X8287, 0X5942,
-  0X69C4, 0X8AA6, 0X9308, 0XBCAD, 0XFFFA, 0XFFFF, 0XFFF7, 0X9388,
-  0X5900, 0X50C1, 0X50C2, 0X50A2, 0X50A2, 0X4041, 0X3000, 0X2800,
-  0X3040, 0X3021, 0X3040, 0X2840, 0X2001, 0X2842, 0X4040, 0X7860,
-  0X9820, 0X9040, 0X88A0, 0X9941, 0X9942, 0X9122, 0X8101, 0X78E1,
-  0X60E3, 0X48C3, 0X3861, 0X4040, 0X4041, 0X3841, 0X4041, 0X3841,
-  0X3821, 0X3821, 0X3841, 0X3861, 0X3820, 0X3820, 0X3800, 0X3800,
-  0X3000, 0X3000, 0X3020, 0X3020, 0X3880, 0X48E1, 0X4921, 0X38A0,
-  0X40A1, 0X4061, 0X3841, 0X3842, 0X3862, 0X4062, 0X4082, 0X40A2,
-  0X50E1, 0X5922, 0X5901, 0X58E1, 0X50A0, 0X4880, 0X4860, 0X4860,
-  0X4841, 0X4061, 0X4041, 0X4061, 0X4861, 0X4840, 0X5040, 0X5861,
-  0X6881, 0X70C1, 0X8143, 0XA1E5, 0XB286, 0XCB69, 0XFC8C, 0XFCCD,
-  0XF3C9, 0XD2A5, 0XCA65, 0XBA04, 0XA1A2, 0X9981, 0X9180, 0X8941,
-  0X9123, 0X9144, 0X78E3, 0X6040, 0X5000, 0X5061, 0X5862, 0X5041,
-  0X5102, 0X61E5, 0X59E5, 0X7245, 0XAB68, 0XD4AC, 0XDDB0, 0XEF14,
-  0XFFFC, 0XFFFF, 0XFFF7, 0XDCAA, 0XB307, 0XA267, 0X81E6, 0X6123,
-  0X50A2, 0X4061, 0X3000, 0X2820, 0X2820, 0X3821, 0X5082, 0X5882,
-  0X5881, 0X58A1, 0X6963, 0X79A4, 0X6942, 0X5900, 0X79C2, 0X9265,
-  0X6921, 0X3000, 0X3000, 0X6941, 0X82A4, 0X7AA3, 0XC4AB, 0XFFB8,
-  0XF551, 0X58C1, 0X1800, 0X2800, 0X3881, 0X38A1, 0X3881, 0X3861,
-  0X3061, 0X3881, 0X40A2, 0X3882, 0X3081, 0X2840, 0X2000, 0X2020,
-  0X2041, 0X2082, 0X18A2, 0X1881, 0X1861, 0X1020, 0X1000, 0X1000,
-  0X1800, 0X3000, 0X48C0, 0X71C4, 0X8266, 0X71E5, 0X5942, 0X50C0,
-  0X6142, 0X8AC5, 0X93A8, 0XAC09, 0XFEB2, 0XFF36, 0XB42C, 0X59E4,
-  0X5147, 0X3084, 0X1801, 0X2801, 0X4883, 0X4863, 0X2800, 0X2800,
-  0X3821, 0X5925, 0X7269, 0X7A29, 0X61C6, 0X5166, 0X40C4, 0X5125,
-  0X5925, 0X50A3, 0X48A3, 0X5946, 0X79E8, 0X8AAA, 0X9AEA, 0X7124,
-  0X5822, 0X7125, 0X7925, 0X7945, 0X79A6, 0X8186, 0X7964, 0X7983,
-  0X81A5, 0X8206, 0X7984, 0X6942, 0X58A1, 0X5061, 0X50C2, 0X6103,
-  0X7164, 0X71A4, 0X7A46, 0X9389, 0XA42B, 0X8B49, 0X72A5, 0X6A64,
-  0X5A03, 0X59E4, 0X6A65, 0X6A25, 0X59A2, 0X5203, 0X5A86, 0X5266,
-  0X4225, 0X4A05, 0X49C4, 0X3923, 0X30A2, 0X3063, 0X3063, 0X3042,
-  0X3021, 0X3840, 0X3860, 0X48E2, 0X82C9, 0XC48F, 0XBC2D, 0X7A46,
-  0X61A3, 0X71E5, 0X6984, 0X4901, 0X4981, 0X9BE9, 0XBD4E, 0X944A,
-  0X5A23, 0X48C0, 0X4880, 0X5081, 0X5081, 0X4061, 0X3840, 0X4020,
-  0X4860, 0X5880, 0X5800, 0X5000, 0X5800, 0X7800, 0X9040, 0XA840,
-  0XB020, 0XA020, 0XA0A0, 0XB120, 0XA920, 0XA121, 0X9100, 0X8060,
-  0X6821, 0X5083, 0X3061, 0X2800, 0X3000, 0X3800, 0X3801, 0X3800,
-  0X3820, 0X3840, 0X3820, 0X3801, 0X3821, 0X3800, 0X3800, 0X3000,
-  0X3000, 0X3820, 0X3860, 0X4101, 0X6A05, 0X82A8, 0X61A4, 0X3060,
-  0X3060, 0X3040, 0X3020, 0X3841, 0X3821, 0X3001, 0X3842, 0X50E3,
-  0X6164, 0X5943, 0X48E0, 0X48A0, 0X4880, 0X4080, 0X50A1, 0X50A2,
-  0X5082, 0X4882, 0X4882, 0X4862, 0X4861, 0X4860, 0X4860, 0X5860,
-  0X6081, 0X7923, 0X9A06, 0XB288, 0XB287, 0XBAA6, 0XDBA9, 0XFCAC,
-  0XFC4B, 0XF3A9, 0XD2C6, 0XBA45, 0XD36A, 0XEC0C, 0XD349, 0XAA45,
-  0XAA05, 0XBAA7, 0XA206, 0X78C2, 0X5000, 0X4840, 0X4820, 0X4800,
-  0X4840, 0X4861, 0X5080, 0X6141, 0X9245, 0XB2A6, 0X9A64, 0X8B04,
-  0XDE90, 0XFFFA, 0XFF93, 0XBBE6, 0XA2C5, 0XA2C7, 0X9A87, 0X6984,
-  0X58E3, 0X48A3, 0X3882, 0X3041, 0X3040, 0X3821, 0X4862, 0X50A2,
-  0X60C2, 0X60E2, 0X60E2, 0X60E1, 0X6101, 0X6961, 0XB368, 0XFE94,
-  0XFF98, 0XD50D, 0X7223, 0X82A4, 0XAC2A, 0XDDCE, 0XFFD4, 0XFFF9,
-  0XFFB6, 0XBCAD, 0X61C4, 0X2800, 0X2000, 0X2840, 0X3040, 0X3041,
-  0X3881, 0X38A2, 0X40A2, 0X48C3, 0X4903, 0X38A2, 0X2860, 0X2020,
-  0X2020, 0X2040, 0X1820, 0X2020, 0X2020, 0X1000, 0X0000, 0X0000,
-  0X2000, 0X3800, 0X5102, 0X71E5, 0X8A87, 0X8287, 0X6984, 0X5040,
-  0X9A26, 0XFFFC, 0XFFFF, 0XFFFF, 0XFFFB, 0XFF55, 0XCD0F, 0X9BAC,
-  0X5164, 0X3861, 0X38A2, 0X5146, 0X8ACB, 0X8ACB, 0X3000, 0X3820,
-  0X48A3, 0X48A3, 0X48E4, 0X5146, 0X5146, 0X61A7, 0X61A7, 0X6167,
-  0X6146, 0X5905, 0X5925, 0X69A6, 0X8289, 0XC4B1, 0XDD52, 0XA38C,
-  0X6964, 0X5021, 0X5883, 0X6103, 0X7165, 0X7185, 0X7144, 0X7124,
-  0X6924, 0X60E3, 0X4842, 0X4862, 0X50C3, 0X50E4, 0X5103, 0X50E2,
-  0X4041, 0X48E2, 0X4942, 0X4921, 0X5982, 0X51A3, 0X4141, 0X4961,
-  0X51C3, 0X59E4, 0X59E5, 0X4984, 0X4143, 0X4143, 0X30E2, 0X1060,
-  0X1060, 0X2081, 0X2060, 0X2040, 0X2020, 0X2000, 0X2020, 0X2800,
-  0X2000, 0X3020, 0X48E2, 0X61A5, 0X7226, 0X7AA8, 0X7AA7, 0X61E5,
-  0X5122, 0X3880, 0X3020, 0X4080, 0X48E1, 0X5162, 0X51C3, 0X49E3,
-  0X51E2, 0X5982, 0X48A0, 0X4860, 0X4020, 0X4020, 0X5020, 0X7020,
-  0X8840, 0X9880, 0X9040, 0X9040, 0XA0A0, 0XB0A0, 0XC0C0, 0XC8A0,
-  0XC8C0, 0XB941, 0XC181, 0XD1A1, 0XC920, 0XB900, 0XB8E0, 0X9840,
-  0X8000, 0X7021, 0X4842, 0X3841, 0X3861, 0X4061, 0X3800, 0X3800,
-  0X4061, 0X4041, 0X3000, 0X3000, 0X3020, 0X3841, 0X4021, 0X3800,
-  0X3800, 0X4060, 0X48E1, 0X61A3, 0XA3AB, 0XC46E, 0X7A66, 0X40C1,
-  0X38C2, 0X3061, 0X2800, 0X3841, 0X3821, 0X3001, 0X3021, 0X40C3,
-  0X61A5, 0X6164, 0X48C1, 0X48C1, 0X50E1, 0X50E2, 0X58C3, 0X50C3,
-  0X50A2, 0X50A2, 0X48C2, 0X48A2, 0X4862, 0X4861, 0X4080, 0X5040,
-  0X6061, 0X7103, 0X91A5, 0X99C5, 0X99A4, 0XA1C4, 0XAA04, 0XC2A6,
-  0XEB69, 0XEB89, 0XC264, 0XC2E7, 0XFCEF, 0XFCCF, 0XDB6A, 0XB246,
-  0XAA04, 0XAA05, 0XA205, 0X8984, 0X70C3, 0X6083, 0X5060, 0X4000,
-  0X4800, 0X4800, 0X5040, 0X60C0, 0X89E4, 0XA225, 0XAA24, 0X9A62,
-  0XA3A6, 0XC4EB, 0X9B65, 0X7980, 0X7161, 0X79A2, 0X6941, 0X48A0,
-  0X3861, 0X3062, 0X3042, 0X3061, 0X3061, 0X3861, 0X4882, 0X5083,
-  0X58A1, 0X68E1, 0X6922, 0X6922, 0X6962, 0X79C3, 0X8A85, 0XB3CA,
-  0XCCCD, 0XA3A9, 0X61E2, 0X6202, 0XCD4F, 0XFF77, 0XE651, 0XAC67,
-  0X7B02, 0X62A4, 0X5A25, 0X4122, 0X30A1, 0X3880, 0X3860, 0X3861,
-  0X3881, 0X3882, 0X3882, 0X40E2, 0X4903, 0X48E3, 0X38E3, 0X3081,
-  0X2020, 0X2020, 0X2000, 0X2820, 0X1800, 0X0800, 0X28A2, 0X61E6,
-  0X6963, 0X58E0, 0X71C4, 0X8246, 0X7A05, 0X69C4, 0X5102, 0X2800,
-  0X3000, 0XA329, 0XC4EE, 0X93C9, 0X49A1, 0X49C0, 0X5222, 0X49E3,
-  0X51A3, 0X5185, 0X6A68, 0X93CC, 0XCD11, 0XB490, 0X6AA8, 0X7A68,
-  0X7249, 0X7228, 0X71E7, 0X5965, 0X5125, 0X5146, 0X48E5, 0X48C4,
-  0X48C4, 0X50C4, 0X50C4, 0X5104, 0X6A07, 0X8B0A, 0X8309, 0X7287,
-  0X7248, 0X6985, 0X50E3, 0X69A6, 0X7207, 0X6985, 0X6104, 0X6104,
-  0X58E3, 0X3820, 0X3021, 0X40A2, 0X4103, 0X4924, 0X5124, 0X4903,
-  0X38C1, 0X38C1, 0X40C1, 0X40C2, 0X4122, 0X4122, 0X4101, 0X5183,
-  0X6205, 0X6247, 0X5A06, 0X3923, 0X2860, 0X2861, 0X2040, 0X1800,
-  0X1800, 0X2000, 0X2000, 0X2000, 0X2000, 0X2020, 0X2820, 0X2800,
-  0X2800, 0X3020, 0X48E2, 0X69E5, 0X7226, 0X5163, 0X38C1, 0X3080,
-  0X3880, 0X40A0, 0X3860, 0X3881, 0X40A1, 0X40A1, 0X2000, 0X1800,
-  0X38E0, 0X6223, 0X5122, 0X4060, 0X3020, 0X4000, 0X6800, 0X9080,
-  0XA0A0, 0XA080, 0XB0E0, 0XD1C2, 0XF2A5, 0XEA85, 0XD9C4, 0XE182,
-  0XF2A6, 0XFC4D, 0XFD30, 0XFD0F, 0XFD4E, 0XFCED, 0XFB47, 0XD161,
-  0XA840, 0X8800, 0X7842, 0X6062, 0X4862, 0X4840, 0X4020, 0X4041,
-  0X4882, 0X4041, 0X3000, 0X2800, 0X3800, 0X4021, 0X4841, 0X5020,
-  0X5040, 0X50A1, 0X5122, 0X7225, 0XC46E, 0XDD51, 0X9B48, 0X61C4,
-  0X5144, 0X3060, 0X2800, 0X3041, 0X3041, 0X3021, 0X3021, 0X38A2,
-  0X4903, 0X48E2, 0X40C0, 0X48A0, 0X40A0, 0X50E1, 0X58E2, 0X50A2,
-  0X4882, 0X48A2, 0X48A2, 0X4062, 0X4021, 0X3841, 0X3821, 0X4021,
-  0X5041, 0X60A2, 0X68A2, 0X68C1, 0X78E2, 0X8922, 0X9141, 0XA9C3,
-  0XC266, 0XCAA7, 0XB224, 0XA1C3, 0X99A2, 0XA1C3, 0XAA25, 0XAA45,
-  0XAA04, 0XA1E4, 0XA1E5, 0X91A4, 0X8143, 0X7103, 0X60E3, 0X5081,
-  0X58A1, 0X68C1, 0X68A1, 0X5860, 0X68E1, 0X8163, 0X91C4, 0X9A04,
-  0X91C3, 0X8182, 0X6920, 0X58A0, 0X58A0, 0X50A0, 0X5080, 0X4060,
-  0X3040, 0X2000, 0X2800, 0X3061, 0X3862, 0X38A2, 0X4083, 0X4861,
-  0X5081, 0X6922, 0X81C3, 0X79C3, 0X7183, 0X79E4, 0X8285, 0X9327,
-  0X9348, 0X7A44, 0X4100, 0X1820, 0X59C3, 0XB4AE, 0XCD70, 0XAC8B,
-  0X72E6, 0X49C3, 0X4942, 0X4921, 0X38C2, 0X3081, 0X3861, 0X3861,
-  0X3861, 0X3861, 0X38A2, 0X40C2, 0X48E3, 0X40C3, 0X38C2, 0X30A1,
-  0X2840, 0X2061, 0X2841, 0X3061, 0X2800, 0X2000, 0XABAC, 0XFF57,
-  0XFF57, 0XDD0E, 0X9B48, 0X8286, 0X59A2, 0X4921, 0X4901, 0X38A0,
-  0X3020, 0X3040, 0X3040, 0X0800, 0X1800, 0X2861, 0X2061, 0X1842,
-  0X8A48, 0X79A6, 0X7A46, 0XB48E, 0XDD94, 0XC4D2, 0X8B4B, 0X6206,
-  0X6A28, 0X6A28, 0X61E7, 0X6186, 0X4904, 0X40C3, 0X3862, 0X4083,
-  0X5105, 0X5925, 0X4883, 0X40A2, 0X5144, 0X61A5, 0X61E6, 0X69E6,
-  0X69E6, 0X6A07, 0X6A07, 0X71E8, 0X61A6, 0X69A6, 0X71A6, 0X7166,
-  0X5062, 0X3800, 0X69A6, 0X6227, 0X30E3, 0X2021, 0X3081, 0X40E2,
-  0X38A2, 0X38A3, 0X40C2, 0X4923, 0X4984, 0X4123, 0X4943, 0X59A5,
-  0X5A06, 0X6247, 0X59E6, 0X38C2, 0X2000, 0X2000, 0X2000, 0X2000,
-  0X2000, 0X2000, 0X2800, 0X2800, 0X3020, 0X3021, 0X3021, 0X3000,
-  0X3820, 0X4081, 0X48E2, 0X5943, 0X61A5, 0X59A4, 0X5122, 0X40C1,
-  0X3881, 0X3860, 0X3840, 0X3040, 0X3840, 0X3860, 0X2820, 0X2820,
-  0X38A0, 0X4140, 0X40C1, 0X4842, 0X4821, 0X6000, 0X8840, 0XA0C0,
-  0X98A0, 0XA140, 0XCA66, 0XFBA9, 0XFCEC, 0XFCED, 0XF348, 0XEAA6,
-  0XFB8A, 0XFBCB, 0XFB08, 0XFB67, 0XFD8E, 0XFF35, 0XFEF4, 0XFCCC,
-  0XE283, 0XB8E0, 0XA0A1, 0X88C4, 0X6862, 0X5040, 0X4840, 0X58A2,
-  0X58C3, 0X4861, 0X3800, 0X3000, 0X4800, 0X5020, 0X6800, 0X7820,
-  0X8060, 0X7901, 0X6141, 0X61C3, 0X8AC7, 0X9B28, 0X9B28, 0X9B08,
-  0X71E4, 0X3880, 0X2841, 0X3061, 0X2800, 0X2800, 0X3061, 0X3061,
-  0X2800, 0X3060, 0X5122, 0X5942, 0X48E1, 0X48A1, 0X50C1, 0X4882,
-  0X4061, 0X4061, 0X3882, 0X3841, 0X3820, 0X3020, 0X2820, 0X2020,
-  0X2820, 0X3040, 0X3840, 0X4060, 0X58C1, 0X78E1, 0X80E1, 0X9142,
-  0XA1C3, 0XAA25, 0XAA25, 0X99C3, 0X9161, 0X9162, 0XAA45, 0XB2A6,
-  0XAA65, 0X9A05, 0X99A4, 0X9163, 0X8922, 0X80E2, 0X78C2, 0X70E3,
-  0X79A4, 0X89E5, 0X7964, 0X5881, 0X5840, 0X68C2, 0X7943, 0X8163,
-  0X70E2, 0X5000, 0X4860, 0X6121, 0X68E2, 0X58C1, 0X50E3, 0X5144,
-  0X4143, 0X28A0, 0X2020, 0X2861, 0X38C2, 0X3881, 0X3020, 0X3821,
-  0X50A2, 0X7184, 0X8A05, 0X81E5, 0X79E5, 0X7A45, 0X82E7, 0X8B28,
-  0X7286, 0X51A2, 0X3920, 0X2840, 0X2880, 0X51A2, 0X6224, 0X51E3,
-  0X4162, 0X38C1, 0X3081, 0X38C2, 0X3061, 0X2800, 0X2820, 0X3020,
-  0X2820, 0X2800, 0X2840, 0X3861, 0X3041, 0X2800, 0X2820, 0X2820,
-  0X2861, 0X2881, 0X28A1, 0X28A1, 0X3060, 0X1800, 0X3880, 0X8287,
-  0XB42B, 0XAC09, 0X82E6, 0X61E3, 0X38C0, 0X3060, 0X3860, 0X3840,
-  0X3040, 0X3041, 0X3042, 0X2041, 0X1840, 0X1841, 0X1841, 0X2060,
-  0XB289, 0X99E6, 0X9207, 0X92E9, 0X8B0A, 0X82C9, 0X6A46, 0X59A6,
-  0X5166, 0X4105, 0X4105, 0X4926, 0X38E5, 0X38A5, 0X40E5, 0X40E6,
-  0X4947, 0X5147, 0X48E5, 0X40E5, 0X4965, 0X5145, 0X4104, 0X40E3,
-  0X4924, 0X5164, 0X4944, 0X48C3, 0X4882, 0X50E4, 0X60C4, 0X58C3,
-  0X6105, 0X8A09, 0XD513, 0XEE16, 0X8B8D, 0X3904, 0X30C3, 0X38C4,
-  0X4104, 0X40E4, 0X4104, 0X4104, 0X3904, 0X3103, 0X4164, 0X51A5,
-  0X4143, 0X38E2, 0X38C2, 0X3061, 0X3000, 0X2800, 0X2820, 0X3820,
-  0X4041, 0X5062, 0X5082, 0X4041, 0X4041, 0X4061, 0X4061, 0X3800,
-  0X3841, 0X48C2, 0X48E2, 0X48E2, 0X4081, 0X4080, 0X40C1, 0X40C2,
-  0X3861, 0X3840, 0X3000, 0X3020, 0X3040, 0X3020, 0X3020, 0X3061,
-  0X4861, 0X5800, 0X5800, 0X6800, 0X7820, 0X8860, 0XA0A0, 0XA0A0,
-  0X9020, 0XBA86, 0XFD94, 0XFD94, 0XFCCE, 0XFC2B, 0XE326, 0XE2E6,
-  0XFC2C, 0XFC2C, 0XFAA6, 0XFA64, 0XFCEB, 0XFFB5, 0XFFF9, 0XFF75,
-  0XFD0C, 0XF2C3, 0XC9C2, 0XB146, 0X88C4, 0X6061, 0X5860, 0X68A1,
-  0X7123, 0X70C3, 0X5861, 0X5840, 0X70C0, 0X8920, 0X88E0, 0X88C0,
-  0X9100, 0XA9A0, 0X9A62, 0X8AA4, 0X7A86, 0X7A26, 0X8A46, 0X8A66,
-  0X6984, 0X50C3, 0X40A3, 0X2821, 0X2800, 0X2820, 0X2801, 0X1800,
-  0X2000, 0X59A5, 0X9BEC, 0XA42B, 0X72A5, 0X40E0, 0X38A1, 0X3881,
-  0X3841, 0X3820, 0X3021, 0X3021, 0X3020, 0X2820, 0X2820, 0X2040,
-  0X2020, 0X2000, 0X2000, 0X2840, 0X40C2, 0X50E2, 0X60A1, 0X70C1,
-  0X7922, 0X8183, 0X89A3, 0X7942, 0X78E1, 0X7101, 0X8183, 0X9A46,
-  0XAA66, 0X99C4, 0X8923, 0X80E1, 0X80E1, 0X80A0, 0X80A1, 0X88E2,
-  0X99E6, 0XAAC9, 0XA248, 0X7985, 0X5881, 0X5882, 0X60C2, 0X68C3,
-  0X60A2, 0X4800, 0X58E0, 0X6963, 0X5901, 0X50E1, 0X5144, 0X6A47,
-  0X6AC8, 0X5A46, 0X4164, 0X3923, 0X30C1, 0X3080, 0X3860, 0X40A2,
-  0X50A2, 0X6123, 0X7185, 0X79C6, 0X7A06, 0X7A67, 0X7A87, 0X7266,
-  0X51A4, 0X38E0, 0X4121, 0X72E7, 0X9BEB, 0X6A85, 0X28A0, 0X1820,
-  0X2840, 0X3840, 0X3860, 0X3840, 0X3020, 0X3862, 0X40C2, 0X38A1,
-  0X3841, 0X4020, 0X4040, 0X3000, 0X2800, 0X3000, 0X4020, 0X3000,
-  0X2000, 0X1841, 0X2081, 0X28E2, 0X30E2, 0X38C1, 0X30A1, 0X40C1,
-  0X40A1, 0X3080, 0X4140, 0X4A01, 0X49C1, 0X28E0, 0X28A0, 0X38A1,
-  0X2800, 0X1800, 0X2021, 0X2882, 0X2061, 0X1840, 0X1820, 0X2020,
-  0X4800, 0X6820, 0X8964, 0XA2E9, 0XB3CC, 0X9B2A, 0X7A67, 0X6A28,
-  0X61C8, 0X4106, 0X38C5, 0X40E6, 0X30A5, 0X30A5, 0X2864, 0X2864,
-  0X2083, 0X1862, 0X2063, 0X30E3, 0X3924, 0X59C6, 0X59A7, 0X61E7,
-  0X82CA, 0X8BAD, 0X730C, 0X51C7, 0X4145, 0X4125, 0X48C3, 0X58E4,
-  0X6985, 0X6185, 0X59C6, 0X7268, 0X6A48, 0X4165, 0X3945, 0X3966,
-  0X3126, 0X3925, 0X38C3, 0X2860, 0X2820, 0X3081, 0X5185, 0X61A5,
-  0X48A1, 0X3000, 0X3000, 0X3800, 0X4041, 0X4881, 0X5061, 0X4820,
-  0X4861, 0X58C2, 0X6103, 0X6103, 0X50C2, 0X50C1, 0X48A2, 0X4061,
-  0X4061, 0X48A1, 0X48A2, 0X4081, 0X4081, 0X3860, 0X4081, 0X4082,
-  0X4061, 0X3840, 0X3840, 0X3840, 0X4041, 0X3800, 0X3000, 0X4020,
-  0X6020, 0X8840, 0X9040, 0X98A0, 0XB121, 0XC142, 0XB122, 0XA060,
-  0X9800, 0XD3AA, 0XFFDB, 0XFEFA, 0XFCF1, 0XFC0B, 0XD2E6, 0XD2A5,
-  0XF369, 0XFB89, 0XF2A6, 0XFA65, 0XFC4A, 0XFEB1, 0XFF74, 0XFED3,
-  0XFE32, 0XFCCC, 0XF306, 0XC206, 0X9125, 0X70A2, 0X6041, 0X6061,
-  0X70E3, 0X7103, 0X68A2, 0X7081, 0X80C0, 0X9960, 0XC244, 0XDB06,
-  0XDB05, 0XC262, 0XAA40, 0XAB04, 0X9B28, 0X7A67, 0X71C4, 0X6183,
-  0X50E2, 0X4882, 0X3861, 0X2821, 0X2800, 0X2820, 0X2020, 0X1000,
-  0X1000, 0X5185, 0XA42D, 0XAC6C, 0X72E7, 0X4162, 0X30A1, 0X3082,
-  0X3862, 0X3041, 0X3040, 0X2840, 0X2820, 0X2840, 0X2840, 0X2840,
-  0X2000, 0X2000, 0X2820, 0X3062, 0X3081, 0X3061, 0X3062, 0X4061,
-  0X5080, 0X58C1, 0X60E1, 0X60C1, 0X68C1, 0X68C1, 0X7101, 0X7902,
-  0X7942, 0X7901, 0X7080, 0X7060, 0X80A0, 0X80A0, 0X88A1, 0X90C1,
-  0X9963, 0XA1A5, 0X9103, 0X70C2, 0X5881, 0X5861, 0X6021, 0X6062,
-  0X5861, 0X4820, 0X48A0, 0X5102, 0X4081, 0X3000, 0X3061, 0X59C6,
-  0X6AC8, 0X6AC9, 0X5206, 0X3943, 0X20E1, 0X2080, 0X3061, 0X48A2,
-  0X48A2, 0X50C2, 0X5923, 0X6984, 0X69A5, 0X6185, 0X5985, 0X5164,
-  0X40C2, 0X2800, 0X2000, 0X72C8, 0XD614, 0XD633, 0X7B69, 0X30C0,
-  0X2000, 0X3000, 0X3820, 0X3000, 0X3820, 0X50A1, 0X6143, 0X5943,
-  0X50A2, 0X4821, 0X3800, 0X5800, 0X7820, 0X7060, 0X8060, 0X6000,
-  0X3800, 0X2800, 0X3082, 0X3103, 0X3923, 0X3903, 0X3923, 0X38C3,
-  0X2801, 0X1800, 0X3080, 0X93CC, 0XEEF6, 0XFFB9, 0XD5F4, 0X7B29,
-  0X4163, 0X28A1, 0X2861, 0X2882, 0X28A2, 0X2881, 0X2861, 0X2861,
-  0XCD71, 0XF717, 0XFE94, 0XE550, 0X936A, 0X5142, 0X4902, 0X4985,
-  0X4125, 0X38A4, 0X30A4, 0X3084, 0X2063, 0X2864, 0X2043, 0X2064,
-  0X1843, 0X1862, 0X1862, 0X2082, 0X30C3, 0X4945, 0X51C7, 0X72AA,
-  0X8B2C, 0X7ACA, 0X49C7, 0X3944, 0X3985, 0X3145, 0X3944, 0X4945,
-  0X5146, 0X4965, 0X38A3, 0X2862, 0X28C4, 0X3106, 0X40C5, 0X48A4,
-  0X5062, 0X5881, 0X5881, 0X5040, 0X5840, 0X68E3, 0X7944, 0X7924,
-  0X70E2, 0X6881, 0X6040, 0X5861, 0X6062, 0X60C2, 0X6923, 0X6103,
-  0X58E2, 0X6963, 0X79C4, 0X79C5, 0X7184, 0X6143, 0X5902, 0X50A1,
-  0X4040, 0X4040, 0X4020, 0X4060, 0X4040, 0X3840, 0X4040, 0X4861,
-  0X4041, 0X4040, 0X4040, 0X4840, 0X4861, 0X5000, 0X5020, 0X5040,
-  0X7860, 0XA901, 0XB900, 0XD1C2, 0XEAC6, 0XEAE6, 0XDA86, 0XD225,
-  0XD9E4, 0XEAA7, 0XF3EC, 0XEC0C, 0XE38A, 0XDAE7, 0XBA45, 0XB9E4,
-  0XCA04, 0XD224, 0XDA45, 0XFAC7, 0XFBCA, 0XFCAB, 0XFC07, 0XE304,
-  0XDAE4, 0XCA63, 0XB9E3, 0XA9C5, 0X9144, 0X7902, 0X6061, 0X5861,
-  0X68C2, 0X70E3, 0X70E3, 0X78C3, 0X7860, 0X9100, 0XCAA5, 0XFCAC,
-  0XFCED, 0XDB66, 0XA220, 0XC2E3, 0XC3A8, 0X9AE7, 0X69A3, 0X48E0,
-  0X4060, 0X4040, 0X3820, 0X2820, 0X2820, 0X3021, 0X2800, 0X1800,
-  0X1000, 0X3903, 0X7287, 0X72C6, 0X51C4, 0X3100, 0X2880, 0X2820,
-  0X2820, 0X2821, 0X2820, 0X2060, 0X2041, 0X2041, 0X2020, 0X2800,
-  0X2000, 0X2820, 0X3061, 0X38A2, 0X3881, 0X2861, 0X3041, 0X4041,
-  0X4881, 0X50E2, 0X50A1, 0X5860, 0X60A1, 0X68C1, 0X68A0, 0X70C1,
-  0X70E2, 0X78C1, 0X7060, 0X7861, 0X90C1, 0X9922, 0X90E1, 0X88A0,
-  0X90E1, 0X9902, 0X98E1, 0X8880, 0X7840, 0X6800, 0X6000, 0X6840,
-  0X6020, 0X5800, 0X5880, 0X60E2, 0X4881, 0X3821, 0X3002, 0X2000,
-  0X20C0, 0X3963, 0X3102, 0X28A1, 0X2080, 0X2060, 0X2840, 0X3020,
-  0X3820, 0X4020, 0X5081, 0X60E3, 0X60E3, 0X58E2, 0X48C2, 0X40A2,
-  0X3861, 0X2800, 0X2000, 0X3881, 0X7308, 0X9CAE, 0X83CA, 0X49E4,
-  0X3962, 0X4141, 0X3040, 0X3000, 0X3820, 0X4040, 0X4081, 0X3861,
-  0X4061, 0X7060, 0X9840, 0XE1E0, 0XFBE6, 0XFCED, 0XFCF0, 0XC9C4,
-  0X7000, 0X5000, 0X68C2, 0X5903, 0X3840, 0X3060, 0X2841, 0X3041,
-  0X3041, 0X2000, 0X1000, 0X40C1, 0X6A66, 0X7B28, 0X62C7, 0X5245,
-  0X49A3, 0X30A1, 0X2860, 0X2040, 0X2040, 0X2061, 0X2040, 0X2041,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XAC8E, 0X28C0, 0X30E2,
-  0X38C5, 0X38E5, 0X30C4, 0X2885, 0X2065, 0X1843, 0X1843, 0X1843,
-  0X1862, 0X1863, 0X1842, 0X1842, 0X28C4, 0X3104, 0X3945, 0X3104,
-  0X28A2, 0X1842, 0X0802, 0X1801, 0X2083, 0X30C3, 0X28A2, 0X28A3,
-  0X2883, 0X1861, 0X1083, 0X1064, 0X3024, 0X5802, 0X7000, 0X6800,
-  0X8000, 0X7800, 0X90C1, 0X9923, 0XC287, 0XF40E, 0XCAA9, 0X88E2,
-  0X8902, 0X9964, 0X8943, 0X78E2, 0X7081, 0X6040, 0X5820, 0X58A1,
-  0X7144, 0X8206, 0X8A47, 0X8247, 0X79E6, 0X71E5, 0X7A46, 0X7A46,
-  0X6184, 0X5102, 0X48A2, 0X48A1, 0X5081, 0X4861, 0X4860, 0X4860,
-  0X4860, 0X4880, 0X58C1, 0X68C1, 0X60A1, 0X6881, 0X70A1, 0X6880,
-  0X70A1, 0XA963, 0XD204, 0XE265, 0XF306, 0XFB27, 0XFB28, 0XF309,
-  0XF2EA, 0XEAA8, 0XE246, 0XD226, 0XCA45, 0XB9E4, 0XA943, 0X9901,
-  0X98C0, 0XA0C1, 0XB963, 0XC183, 0XC1A2, 0XA981, 0X90E0, 0X88A0,
-  0X80C0, 0X78C0, 0X78C0, 0X8103, 0X7903, 0X70E2, 0X6062, 0X5841,
-  0X60A2, 0X68C2, 0X70E3, 0X70A3, 0X7020, 0X8020, 0XA980, 0XFBC9,
-  0XFD6E, 0XF48A, 0XBB04, 0XBA62, 0XBA62, 0XB244, 0X89E4, 0X58E1,
-  0X4020, 0X4020, 0X4020, 0X3000, 0X2800, 0X2800, 0X3021, 0X2040,
-  0X2841, 0X3082, 0X30A0, 0X30C0, 0X30C1, 0X28C0, 0X2880, 0X2040,
-  0X2861, 0X2881, 0X2861, 0X2041, 0X2021, 0X2041, 0X2041, 0X2041,
-  0X2861, 0X2861, 0X2861, 0X3082, 0X30A1, 0X3060, 0X3020, 0X3820,
-  0X4860, 0X4860, 0X5040, 0X5020, 0X5040, 0X6061, 0X68A1, 0X70E2,
-  0X70E2, 0X78A2, 0X7061, 0X7881, 0X9923, 0XA163, 0X90E1, 0X88A0,
-  0X90C1, 0XA962, 0XB1A3, 0XB121, 0X9880, 0XA060, 0XC121, 0XC981,
-  0X9860, 0X8000, 0X8040, 0X8061, 0X6020, 0X5860, 0X4842, 0X3000,
-  0X2800, 0X2000, 0X1800, 0X2000, 0X2820, 0X3021, 0X4020, 0X5020,
-  0X58A1, 0X60A1, 0X6101, 0X68E1, 0X68A1, 0X68A1, 0X58A0, 0X4040,
-  0X3841, 0X3800, 0X3000, 0X2800, 0X40E2, 0X72E8, 0X6B09, 0X4A05,
-  0X5265, 0X5AA6, 0X4162, 0X2020, 0X2000, 0X2820, 0X2840, 0X3040,
-  0X4041, 0X8860, 0XC8A0, 0XF980, 0XFBA2, 0XFF72, 0XFFFF, 0XFE95,
-  0XC1C2, 0X8020, 0XAA05, 0XAA89, 0X68C1, 0X4000, 0X3000, 0X3000,
-  0X2800, 0X4082, 0X5944, 0X6164, 0X6144, 0X5922, 0X30C0, 0X2860,
-  0X38A0, 0X3081, 0X2881, 0X2880, 0X2880, 0X2860, 0X2061, 0X2860,
-  0XDD71, 0XC42C, 0X9349, 0XC5D2, 0XFFFF, 0XFFFB, 0X6AEA, 0X49C7,
-  0X30C5, 0X3083, 0X20A3, 0X1862, 0X2063, 0X1864, 0X1863, 0X1863,
-  0X1842, 0X1883, 0X1883, 0X2083, 0X20A4, 0X28A4, 0X2063, 0X2042,
-  0X2043, 0X2083, 0X20E2, 0X28C3, 0X20E4, 0X20E4, 0X18E4, 0X08A4,
-  0X0884, 0X1885, 0X2064, 0X4004, 0X6002, 0X7800, 0X8000, 0X9040,
-  0XB162, 0XC1E4, 0XC1A3, 0XB163, 0XE32A, 0XFD51, 0XFC2E, 0XBA47,
-  0XA9C5, 0X9964, 0X88E2, 0X78E2, 0X78E2, 0X70A2, 0X6060, 0X60A1,
-  0X7964, 0X8A06, 0X8A47, 0X79E6, 0X69A5, 0X6184, 0X69A4, 0X7226,
-  0X8AC8, 0X8267, 0X6144, 0X50E2, 0X5903, 0X6103, 0X6103, 0X6102,
-  0X6123, 0X79A5, 0X8A06, 0X8A05, 0X7123, 0X70E1, 0X8123, 0X78E2,
-  0X6840, 0X8923, 0XD2A9, 0XEAE9, 0XEAA7, 0XEAA6, 0XF307, 0XF329,
-  0XEAE9, 0XDA88, 0XD246, 0XD266, 0XD268, 0XC1E5, 0XB183, 0XA962,
-  0XA142, 0XA122, 0XA142, 0XA121, 0X90E0, 0X78C0, 0X6040, 0X5820,
-  0X5840, 0X4800, 0X4800, 0X5861, 0X5881, 0X5882, 0X5842, 0X5021,
-  0X5060, 0X6081, 0X6061, 0X6862, 0X8082, 0XA923, 0XC1E4, 0XCA03,
-  0XB9A2, 0XB242, 0XBB26, 0XD367, 0XCAE6, 0XBA44, 0XA9C4, 0X80E0,
-  0X6800, 0X6000, 0X5820, 0X4000, 0X3000, 0X3000, 0X3821, 0X2800,
-  0X3862, 0X3862, 0X2820, 0X2840, 0X3082, 0X30A2, 0X2882, 0X28A2,
-  0X30E2, 0X28C2, 0X2081, 0X1841, 0X2021, 0X2041, 0X2040, 0X1840,
-  0X1841, 0X1021, 0X1800, 0X1820, 0X2020, 0X2820, 0X3000, 0X4020,
-  0X4820, 0X4820, 0X4800, 0X4800, 0X5040, 0X6081, 0X7922, 0X7122,
-  0X68C1, 0X70A2, 0X6861, 0X7041, 0X80E2, 0X9123, 0X88A1, 0X7860,
-  0X90E1, 0XB9E4, 0XD245, 0XC9C3, 0XC142, 0XD9E4, 0XFAE7, 0XFAC6,
-  0XC921, 0XB880, 0XB0A0, 0XA860, 0X9020, 0X8080, 0X6060, 0X4801,
-  0X3843, 0X3000, 0X2000, 0X2000, 0X3001, 0X4801, 0X6000, 0X6820,
-  0X7060, 0X7081, 0X70E1, 0X7902, 0X68C1, 0X6060, 0X5840, 0X4820,
-  0X4020, 0X3821, 0X3000, 0X3000, 0X4862, 0X6185, 0X51A4, 0X3963,
-  0X4A45, 0X738A, 0X6B29, 0X41A3, 0X28A1, 0X2060, 0X2060, 0X2840,
-  0X4820, 0X9020, 0XD0A0, 0XF060, 0XF960, 0XFDAC, 0XFFFF, 0XFFFA,
-  0XFC8A, 0XC242, 0XD368, 0XDBEC, 0X9A25, 0X68A0, 0X6080, 0X4820,
-  0X2800, 0X3820, 0X6145, 0X6985, 0X6184, 0X5102, 0X5103, 0X4903,
-  0X38A0, 0X3060, 0X3060, 0X2860, 0X2860, 0X2881, 0X2861, 0X2860,
-  0X7226, 0X61E4, 0X4120, 0X51E3, 0X62A7, 0X4183, 0X3925, 0X49A7,
-  0X28C4, 0X1802, 0X1844, 0X1884, 0X1043, 0X1864, 0X1864, 0X1864,
-  0X1024, 0X1023, 0X1063, 0X0822, 0X0841, 0X0822, 0X1002, 0X1022,
-  0X1043, 0X1883, 0X2904, 0X2124, 0X1144, 0X18E4, 0X2843, 0X3801,
-  0X3800, 0X4800, 0X5800, 0X6800, 0X8000, 0X9860, 0XC1A4, 0XE2E7,
-  0XFBEB, 0XFC6C, 0XEB08, 0XCA66, 0XE349, 0XE329, 0XCAA7, 0XEB8B,
-  0XF3ED, 0XCA68, 0X9925, 0X8944, 0X7902, 0X68C1, 0X60A1, 0X60C1,
-  0X7143, 0X8185, 0X79A5, 0X7163, 0X6923, 0X6103, 0X58E2, 0X6184,
-  0X8AE9, 0X932A, 0X69E6, 0X5144, 0X6144, 0X6985, 0X6965, 0X6123,
-  0X6143, 0X8207, 0X9A88, 0X9AE9, 0X9288, 0X81A5, 0X7943, 0X8102,
-  0X70A1, 0X70C1, 0X9184, 0XB1C6, 0XC1A5, 0XC1C4, 0XCA04, 0XDA87,
-  0XD267, 0XCA27, 0XCA67, 0XE309, 0XDB0A, 0XCA27, 0XB185, 0XA143,
-  0X9923, 0X9123, 0X8923, 0X80E2, 0X68A0, 0X58E1, 0X50E4, 0X50E4,
-  0X50E4, 0X50C4, 0X4082, 0X4862, 0X4881, 0X4862, 0X4841, 0X4021,
-  0X4821, 0X5862, 0X6061, 0X6861, 0X8082, 0XA925, 0XC1E6, 0XC204,
-  0XB141, 0XA161, 0XAA64, 0XD389, 0XD348, 0XBA65, 0XC225, 0XA9E3,
-  0X88E1, 0X7820, 0X5800, 0X3800, 0X4880, 0X6102, 0X3000, 0X1800,
-  0X3842, 0X4062, 0X2860, 0X2860, 0X2840, 0X2841, 0X28A2, 0X3924,
-  0X4124, 0X28E4, 0X20A2, 0X1841, 0X2041, 0X2041, 0X1800, 0X1800,
-  0X1800, 0X2800, 0X4000, 0X4800, 0X4000, 0X3800, 0X4000, 0X5000,
-  0X5820, 0X6080, 0X68E1, 0X7942, 0X7963, 0X89C4, 0X9225, 0X81A4,
-  0X68E2, 0X68C1, 0X6860, 0X6020, 0X6861, 0X78C1, 0X7861, 0X7881,
-  0X88E1, 0XA982, 0XC1C4, 0XC9C4, 0XD1E4, 0XF2C7, 0XFBCA, 0XFB48,
-  0XE224, 0XEA65, 0XEA65, 0XDA26, 0XC143, 0XA080, 0X8040, 0X5820,
-  0X4841, 0X3801, 0X3000, 0X3800, 0X4000, 0X5800, 0X7820, 0X9060,
-  0X9902, 0XA9A5, 0XBA27, 0XB247, 0XA1E6, 0X8942, 0X70A0, 0X6080,
-  0X5840, 0X4841, 0X3000, 0X3000, 0X3841, 0X4041, 0X3861, 0X2860,
-  0X30E2, 0X49E5, 0X5246, 0X41E5, 0X3123, 0X30C2, 0X2081, 0X2081,
-  0X4840, 0X9840, 0XD8A1, 0XF0C1, 0XF9A1, 0XFC8A, 0XFFF8, 0XFFD7,
-  0XFDCF, 0XFC69, 0XDBA8, 0XC327, 0XAA86, 0X9204, 0X8162, 0X8162,
-  0X7141, 0X58E2, 0X50A2, 0X50A2, 0X48C2, 0X4123, 0X40E2, 0X38A1,
-  0X3080, 0X2860, 0X2840, 0X2841, 0X2840, 0X2841, 0X2041, 0X2840,
-  0X5984, 0X58E3, 0X48E3, 0X5945, 0X4902, 0X2081, 0X30C4, 0X1863,
-  0X2863, 0X30A5, 0X2045, 0X1825, 0X1824, 0X1045, 0X1045, 0X0825,
-  0X0826, 0X1025, 0X1803, 0X2002, 0X2801, 0X2000, 0X3000, 0X3001,
-  0X3023, 0X3024, 0X2023, 0X2044, 0X2023, 0X4000, 0X7000, 0X7800,
-  0X9000, 0X9800, 0X9820, 0X9840, 0XC9C5, 0XFBAB, 0XFC2E, 0XFCAF,
-  0XFD50, 0XFD0F, 0XFB89, 0XEB8A, 0XFC8F, 0XEB8B, 0XC266, 0XD308,
-  0XD2C8, 0XB1C6, 0X9965, 0X9144, 0X8123, 0X6902, 0X60C2, 0X60E2,
-  0X6902, 0X6943, 0X6903, 0X60C2, 0X60E2, 0X60E3, 0X58A3, 0X58C2,
-  0X71C6, 0X8267, 0X69E6, 0X61E6, 0X6185, 0X6164, 0X6104, 0X58A2,
-  0X58C2, 0X7185, 0X8A48, 0X92A8, 0XA38B, 0X9B2A, 0X79A4, 0X68C2,
-  0X70C1, 0X70E2, 0X7903, 0X8104, 0X9103, 0X98A1, 0X98E1, 0XA943,
-  0XC206, 0XCA47, 0XC226, 0XBA07, 0XB207, 0XA9A7, 0X9945, 0X90E3,
-  0X80A3, 0X78C4, 0X70E4, 0X60A3, 0X50A2, 0X4123, 0X4985, 0X5185,
-  0X4903, 0X40A2, 0X40A2, 0X4082, 0X4862, 0X4081, 0X4041, 0X4021,
-  0X4842, 0X5062, 0X5040, 0X6061, 0X7062, 0X98C4, 0XB146, 0XB1A4,
-  0XB162, 0XA962, 0XA9E4, 0XD349, 0XD369, 0XBA65, 0XBA45, 0XC286,
-  0XA183, 0X8040, 0X5800, 0X4040, 0X7A66, 0XCC0C, 0X6923, 0X2800,
-  0X2800, 0X3020, 0X2820, 0X2820, 0X2820, 0X2820, 0X2061, 0X28A2,
-  0X30A2, 0X2062, 0X2060, 0X1860, 0X1840, 0X1801, 0X1801, 0X2000,
-  0X3800, 0X5000, 0X6840, 0X78A1, 0X8081, 0X7840, 0X7840, 0X7840,
-  0X7820, 0X9183, 0XB2E7, 0XBB89, 0XBB49, 0XAAE7, 0X9245, 0X7963,
-  0X60E1, 0X5880, 0X5860, 0X6060, 0X5840, 0X6840, 0X7061, 0X7882,
-  0X88A1, 0X90A0, 0XA0E1, 0XB961, 0XD1A2, 0XEA65, 0XFB69, 0XFAE7,
-  0XD9E3, 0XEA44, 0XFBCA, 0XFCCF, 0XFB29, 0XB8E2, 0X9820, 0X7020,
-  0X6020, 0X5800, 0X5800, 0X6000, 0X6840, 0X8880, 0XA0C0, 0XB942,
-  0XD265, 0XE308, 0XEB49, 0XDB49, 0XD2E9, 0XB267, 0X89A4, 0X70E1,
-  0X6060, 0X4860, 0X3840, 0X3860, 0X3881, 0X3881, 0X3061, 0X2820,
-  0X2020, 0X2040, 0X28A1, 0X28E1, 0X30E2, 0X30C2, 0X20A1, 0X2081,
-  0X4080, 0X90A0, 0XC862, 0XF146, 0XFAA9, 0XFBAB, 0XFCEE, 0XFD6D,
-  0XFD4B, 0XFCCB, 0XE368, 0XA204, 0X99A3, 0X9183, 0X8961, 0X91E3,
-  0X9A65, 0X81C5, 0X58E2, 0X5060, 0X40A1, 0X38C2, 0X3082, 0X2861,
-  0X2040, 0X2841, 0X3081, 0X2862, 0X2861, 0X2861, 0X2840, 0X2820,
-  0X60E3, 0X6904, 0X5882, 0X5862, 0X6083, 0X5042, 0X3822, 0X2821,
-  0X3800, 0X4002, 0X3003, 0X2804, 0X2824, 0X3002, 0X4022, 0X4021,
-  0X3800, 0X3000, 0X2800, 0X3800, 0X4000, 0X4000, 0X5020, 0X6061,
-  0X5801, 0X4000, 0X2800, 0X3000, 0X4800, 0X5000, 0X7000, 0XA8E2,
-  0XF369, 0XFC2C, 0XFBAA, 0XFB2A, 0XFB2A, 0XFB4B, 0XFB8D, 0XFBEE,
-  0XFC6E, 0XFC0C, 0XEB28, 0XE328, 0XFBED, 0XFBCD, 0XDAEA, 0XC288,
-  0XA9A5, 0X9123, 0X9123, 0X8984, 0X81A4, 0X7164, 0X6103, 0X6103,
-  0X5903, 0X5903, 0X58E3, 0X58C2, 0X58A2, 0X60A3, 0X58A3, 0X5862,
-  0X5882, 0X50C3, 0X6164, 0X8268, 0X71E7, 0X58E3, 0X50A2, 0X50A2,
-  0X50A2, 0X58C2, 0X6964, 0X6164, 0X69E5, 0X6A06, 0X5984, 0X5923,
-  0X5902, 0X60C2, 0X60C2, 0X68E3, 0X70C2, 0X7860, 0X7840, 0X88C2,
-  0XA165, 0XB206, 0XB1E5, 0X9943, 0X88E2, 0X8924, 0X9125, 0X8083,
-  0X7042, 0X6883, 0X5862, 0X5061, 0X4861, 0X48C2, 0X4944, 0X4924,
-  0X38A2, 0X3862, 0X3882, 0X40A3, 0X4082, 0X4082, 0X4061, 0X4021,
-  0X4001, 0X4020, 0X3800, 0X4800, 0X5800, 0X7822, 0X88A4, 0X88A3,
-  0X98E2, 0XB9C5, 0XBA47, 0XCB08, 0XC2E7, 0XAA05, 0XA9C4, 0XAA04,
-  0X9943, 0X8080, 0X6040, 0X6962, 0XCCAE, 0XFF78, 0XBBEC, 0X40E0,
-  0X2000, 0X2000, 0X2820, 0X3000, 0X2820, 0X2000, 0X2040, 0X2061,
-  0X2861, 0X2020, 0X2020, 0X2000, 0X2000, 0X3000, 0X4000, 0X4800,
-  0X6820, 0X80C1, 0X9122, 0XA984, 0XB1A4, 0XB184, 0XA963, 0X9902,
-  0X90C1, 0XB1E5, 0XE3EB, 0XFD4F, 0XE50E, 0XB389, 0X8204, 0X6142,
-  0X58E1, 0X58C1, 0X58A0, 0X58A0, 0X6081, 0X6861, 0X7062, 0X7882,
-  0X80A1, 0X8881, 0X90C2, 0XA901, 0XB120, 0XC162, 0XEA45, 0XEA45,
-  0XD1C2, 0XE244, 0XFB49, 0XFC2C, 0XFB29, 0XC9A4, 0XA0C1, 0X8860,
-  0X8060, 0X8060, 0X8040, 0X8040, 0X8860, 0XA080, 0XB900, 0XD9C3,
-  0XF2E6, 0XF347, 0XF367, 0XF327, 0XE2E7, 0XC246, 0XA185, 0X88E3,
-  0X7040, 0X5000, 0X4020, 0X4041, 0X40A2, 0X40C3, 0X40A2, 0X3081,
-  0X2881, 0X1820, 0X1800, 0X2060, 0X2060, 0X2840, 0X2820, 0X2820,
-  0X3040, 0X5880, 0X8881, 0XB945, 0XEA68, 0XFA27, 0XE964, 0XC9A1,
-  0XB201, 0XA1C3, 0X9142, 0X78C0, 0X7060, 0X6860, 0X78C0, 0X8162,
-  0X9A65, 0X9A87, 0X7144, 0X6903, 0X4903, 0X30A1, 0X2881, 0X2881,
-  0X2860, 0X2060, 0X2060, 0X2041, 0X2861, 0X2861, 0X2840, 0X2841,
-  0X6964, 0X7984, 0X7985, 0X68A3, 0X60A2, 0X70E4, 0X68C3, 0X50A3,
-  0X68C4, 0X7103, 0X6881, 0X6000, 0X6000, 0X6000, 0X7000, 0X7800,
-  0X8880, 0X88A1, 0X88A2, 0X9103, 0X88E4, 0X80A2, 0X9143, 0XBA68,
-  0XBA27, 0X88A2, 0X6800, 0X5800, 0X6800, 0X7001, 0X9905, 0XEB6C,
-  0XFD93, 0XFE57, 0XFD92, 0XFC4D, 0XE267, 0XC1C5, 0XC1C6, 0XC1E6,
-  0XCA27, 0XCA26, 0XD2A7, 0XDAC8, 0XCAA9, 0XC268, 0XB1E7, 0XC268,
-  0XB207, 0X9964, 0X8103, 0X8944, 0X81C7, 0X71A6, 0X5904, 0X48C3,
-  0X50E4, 0X5924, 0X5104, 0X5104, 0X5904, 0X60E4, 0X58C3, 0X5882,
-  0X5841, 0X5021, 0X5082, 0X6124, 0X6145, 0X50C3, 0X4882, 0X48A2,
-  0X58C3, 0X50A3, 0X4041, 0X48C2, 0X4902, 0X5103, 0X5124, 0X5144,
-  0X48E2, 0X4882, 0X5082, 0X50C2, 0X50C2, 0X60C3, 0X6082, 0X68A3,
-  0X80E2, 0X9123, 0XA143, 0X9901, 0X8900, 0X8964, 0X8945, 0X8083,
-  0X7042, 0X6883, 0X6063, 0X5863, 0X5862, 0X4862, 0X4082, 0X3883,
-  0X3062, 0X3843, 0X4062, 0X3862, 0X3882, 0X4082, 0X4082, 0X3801,
-  0X2000, 0X1000, 0X1000, 0X2800, 0X3800, 0X3800, 0X5800, 0X7042,
-  0X7842, 0X9944, 0XB1E6, 0XA205, 0X91A4, 0X8923, 0X8901, 0X70C0,
-  0X80A0, 0X8923, 0X7943, 0X7143, 0X92A7, 0XC48C, 0XB3EB, 0X7203,
-  0X4900, 0X38A0, 0X3021, 0X3041, 0X2841, 0X2000, 0X2040, 0X2820,
-  0X2020, 0X2820, 0X3021, 0X3800, 0X4020, 0X5040, 0X6060, 0X70E2,
-  0X99E5, 0XBB08, 0XC2E8, 0XCAC8, 0XD309, 0XD2C8, 0XCA67, 0XB226,
-  0XA9C4, 0XB225, 0XAA46, 0X9AC6, 0X9B27, 0X8AA6, 0X7204, 0X5942,
-  0X50E1, 0X5902, 0X5902, 0X50C1, 0X5880, 0X5861, 0X6042, 0X7062,
-  0X78A2, 0X80C3, 0X88A3, 0X98E1, 0XA8E0, 0XC140, 0XD1E4, 0XDA05,
-  0XDA03, 0XE264, 0XF2A6, 0XF2A7, 0XE225, 0XC9C3, 0XB164, 0XA122,
-  0X98E1, 0X98C1, 0X9081, 0X90A0, 0X90E0, 0XA0C0, 0XB921, 0XD9E3,
-  0XE264, 0XEAE5, 0XFB26, 0XEAC5, 0XDA43, 0XC9C2, 0XB141, 0X98C0,
-  0X8060, 0X7000, 0X6000, 0X5000, 0X4841, 0X4882, 0X48A2, 0X40C2,
-  0X3882, 0X2820, 0X2000, 0X2000, 0X2800, 0X3000, 0X3800, 0X3800,
-  0X4020, 0X5060, 0X5880, 0X68E1, 0X8942, 0X90E3, 0X7840, 0X6800,
-  0X5000, 0X5000, 0X6800, 0X6840, 0X7040, 0X7040, 0X78C0, 0X80E1,
-  0X8963, 0X89C4, 0X68E1, 0X5860, 0X50C2, 0X30A3, 0X2061, 0X2881,
-  0X20A2, 0X2082, 0X2061, 0X2041, 0X2061, 0X2061, 0X2040, 0X2061,
-  0XBB8A, 0XF4F1, 0XDBEE, 0X8185, 0X7124, 0X81E7, 0X8145, 0X70E4,
-  0X7965, 0X8965, 0X9923, 0XB9A3, 0XE2E7, 0XFC2D, 0XF2E8, 0XF36B,
-  0XDB4B, 0XB247, 0XA1C6, 0XB1E5, 0XCA89, 0XC268, 0XB1E6, 0XC206,
-  0XBA06, 0X9944, 0X90C2, 0X8062, 0X88E3, 0XB248, 0XCAAA, 0XA9E7,
-  0XA9E6, 0XEBAD, 0XF40D, 0XE32B, 0XB1C6, 0X90E3, 0X90E3, 0X88C3,
-  0X88E4, 0X88C3, 0X9125, 0X9125, 0X8061, 0X7000, 0X8082, 0XA9A5,
-  0XBA07, 0XA186, 0X8904, 0X8125, 0X7946, 0X6966, 0X50E4, 0X48E4,
-  0X5105, 0X5125, 0X5125, 0X5965, 0X5985, 0X6165, 0X5903, 0X4861,
-  0X4000, 0X5021, 0X58C3, 0X4862, 0X4882, 0X48C2, 0X48C3, 0X50A3,
-  0X48C3, 0X48A3, 0X50A3, 0X5104, 0X5124, 0X48E3, 0X48E3, 0X4923,
-  0X3882, 0X3842, 0X3842, 0X3862, 0X4081, 0X4883, 0X5063, 0X5822,
-  0X6021, 0X7080, 0X90A0, 0XA940, 0XC325, 0XD4EB, 0XAB69, 0X78E2,
-  0X7021, 0X6801, 0X5822, 0X5843, 0X5842, 0X4821, 0X4001, 0X3801,
-  0X3802, 0X4863, 0X4043, 0X3801, 0X3801, 0X4801, 0X3800, 0X1000,
-  0X1800, 0X71E5, 0XB36B, 0X92A8, 0X58E3, 0X4000, 0X5021, 0X6863,
-  0X6842, 0X70C2, 0X8944, 0X78E3, 0X68A1, 0X68A2, 0X6880, 0X6040,
-  0X68A0, 0X7944, 0X81A5, 0X81A4, 0X79E5, 0X8246, 0X7205, 0X5941,
-  0X4901, 0X48E2, 0X4081, 0X3860, 0X3021, 0X2800, 0X2800, 0X2000,
-  0X2800, 0X3842, 0X4882, 0X5041, 0X5880, 0X68E1, 0X70E1, 0X7922,
-  0X9A26, 0XD38B, 0XDBED, 0XDC0D, 0XDBAB, 0XD2E9, 0XCAC8, 0XC2E9,
-  0XB266, 0XAA05, 0X9184, 0X7162, 0X5181, 0X72A4, 0X9B69, 0X6983,
-  0X48A1, 0X5923, 0X5923, 0X50A1, 0X4860, 0X5040, 0X6061, 0X6081,
-  0X6882, 0X78C3, 0X80A2, 0X88A2, 0X98C1, 0XA902, 0XB122, 0XB902,
-  0XC182, 0XDA23, 0XD204, 0XC962, 0XC162, 0XB962, 0XA942, 0X98E1,
-  0X98E1, 0X9902, 0X90A1, 0X88A1, 0X90A0, 0XA0A0, 0XD183, 0XFA66,
-  0XFAE7, 0XFB27, 0XFB27, 0XEAA5, 0XD202, 0XC180, 0XB941, 0XB941,
-  0XB142, 0XB163, 0XA922, 0X90E0, 0X7880, 0X6040, 0X5860, 0X5881,
-  0X5021, 0X4000, 0X4000, 0X4020, 0X4020, 0X4820, 0X4820, 0X4820,
-  0X4840, 0X5061, 0X58A1, 0X5080, 0X5080, 0X5040, 0X4800, 0X5020,
-  0X5860, 0X6881, 0X7922, 0X8963, 0X8102, 0X7880, 0X7860, 0X8080,
-  0X8902, 0X91A4, 0X89A5, 0X6902, 0X4861, 0X40A3, 0X30C3, 0X28C2,
-  0X28A2, 0X2882, 0X3082, 0X2861, 0X2861, 0X2041, 0X2841, 0X2841,
-  0X9246, 0XC38B, 0XCBED, 0XAAC9, 0X9248, 0X9228, 0X8186, 0X7104,
-  0X6924, 0X7904, 0X9924, 0XC267, 0XF38B, 0XF3EC, 0XF3AC, 0XE34A,
-  0XDAE8, 0XC2A8, 0XAA06, 0XA1E6, 0XB1E6, 0XB1A5, 0XA184, 0XA984,
-  0XA985, 0XB206, 0XDB0A, 0XCAAA, 0XBA07, 0XC269, 0XC249, 0X9125,
-  0X7882, 0X9164, 0X9985, 0X9165, 0X8103, 0X78C2, 0X7903, 0X7124,
-  0X7125, 0X8125, 0X78C5, 0X6822, 0X7041, 0X9985, 0XA9E6, 0XA226,
-  0XA267, 0XA1E7, 0X8905, 0X78E4, 0X70E5, 0X5884, 0X4885, 0X48A5,
-  0X48E6, 0X5106, 0X5126, 0X5966, 0X61A7, 0X5985, 0X4102, 0X3080,
-  0X4902, 0X69A5, 0X79A6, 0X58C4, 0X4822, 0X48C2, 0X50E3, 0X50A4,
-  0X50C3, 0X5945, 0X5945, 0X5986, 0X59A6, 0X5145, 0X40C3, 0X38A3,
-  0X3062, 0X3042, 0X3843, 0X4042, 0X3842, 0X4063, 0X4842, 0X4802,
-  0X5000, 0X6000, 0X7820, 0XA1A0, 0XBC47, 0XCDED, 0XC50C, 0XC44C,
-  0XCC0C, 0X99C5, 0X6821, 0X6042, 0X5841, 0X5020, 0X4000, 0X3800,
-  0X3800, 0X4800, 0X4822, 0X5082, 0X60C2, 0X6040, 0X3000, 0X2000,
-  0X9AA7, 0XFD92, 0XFD72, 0XC42D, 0X8248, 0X58A3, 0X5042, 0X5863,
-  0X6063, 0X60A3, 0X68E3, 0X5062, 0X4821, 0X5061, 0X5041, 0X5840,
-  0X6081, 0X6924, 0X7165, 0X7184, 0X7183, 0X5902, 0X50E2, 0X48A0,
-  0X48C1, 0X48E2, 0X48C2, 0X4081, 0X3841, 0X3041, 0X3041, 0X3040,
-  0X3021, 0X4063, 0X58E3, 0X60E1, 0X68E1, 0X7943, 0X8123, 0X7902,
-  0X89A5, 0XAA88, 0XAAC9, 0XAAC9, 0XAAC8, 0X9A46, 0X99C5, 0X91E5,
-  0X89C5, 0X8164, 0X8164, 0X68E2, 0X5161, 0XAC4C, 0XFEB6, 0XBC4D,
-  0X69C5, 0X6104, 0X58C4, 0X5061, 0X5040, 0X5020, 0X6041, 0X5820,
-  0X5801, 0X6041, 0X6841, 0X7061, 0X8082, 0X90A2, 0X98C1, 0XA8E2,
-  0XB102, 0XB141, 0XA8E0, 0XA080, 0XA0E0, 0XA101, 0X98E1, 0X88A1,
-  0X8081, 0X88A1, 0X8060, 0X7860, 0X8060, 0X98A1, 0XD1C4, 0XF245,
-  0XE224, 0XF285, 0XFB07, 0XFB07, 0XE265, 0XDA03, 0XD204, 0XD204,
-  0XDA45, 0XE287, 0XCA06, 0XA142, 0X80A0, 0X7860, 0X8060, 0X7840,
-  0X7040, 0X6860, 0X6881, 0X6881, 0X6061, 0X6060, 0X60C2, 0X7164,
-  0X7163, 0X50A1, 0X4840, 0X4840, 0X4020, 0X3800, 0X4000, 0X4840,
-  0X5860, 0X6080, 0X6880, 0X70A1, 0X70A1, 0X7880, 0X7080, 0X7881,
-  0X80E2, 0X9184, 0X91A5, 0X7944, 0X48A2, 0X3042, 0X3062, 0X3082,
-  0X30A2, 0X2881, 0X2861, 0X2861, 0X2862, 0X2061, 0X2041, 0X2841,
-  0X7986, 0X7966, 0X7165, 0X7186, 0X81E7, 0X81E6, 0X7186, 0X60C4,
-  0X60C3, 0X68A3, 0X70C3, 0X9965, 0XBA07, 0XC226, 0XBA26, 0XB226,
-  0XAA05, 0XA1E5, 0XA1E6, 0X9984, 0X9123, 0X9103, 0X8903, 0X9103,
-  0XA164, 0XBA27, 0XDAEB, 0XCAAA, 0XA9C6, 0X9125, 0X8924, 0X78E3,
-  0X70C3, 0X68E3, 0X60C2, 0X58A2, 0X50A2, 0X60C3, 0X7165, 0X7186,
-  0X7145, 0X8165, 0X8165, 0X7903, 0X78C1, 0X89C3, 0XAAE7, 0XA308,
-  0X9B8A, 0X9AE9, 0X8124, 0X7822, 0X80A4, 0X70E5, 0X5844, 0X4824,
-  0X4044, 0X4864, 0X48A5, 0X5106, 0X5987, 0X61E8, 0X6249, 0X8BAD,
-  0XBD32, 0XB4D0, 0X932B, 0X6165, 0X50C4, 0X5904, 0X5904, 0X6145,
-  0X69C7, 0X61E7, 0X6207, 0X5A07, 0X5A27, 0X59C7, 0X40C4, 0X30A3,
-  0X30A3, 0X3062, 0X3062, 0X3842, 0X3823, 0X4063, 0X4862, 0X5841,
-  0X6020, 0X6820, 0X8020, 0XA100, 0XCC8A, 0XEFF6, 0XFFF9, 0XFFF8,
-  0XFFF7, 0XE44B, 0X9100, 0X80A1, 0X7082, 0X7082, 0X5800, 0X3800,
-  0X3000, 0X3000, 0X2000, 0X3000, 0X5800, 0X6020, 0X4000, 0X6943,
-  0XFEF7, 0XFFFA, 0XFD31, 0XB3AB, 0X92C9, 0X6945, 0X4864, 0X5864,
-  0X5885, 0X58A5, 0X50C4, 0X4863, 0X4042, 0X4062, 0X4061, 0X4842,
-  0X5083, 0X5883, 0X58A3, 0X58C3, 0X58C2, 0X4881, 0X4861, 0X4040,
-  0X4881, 0X48C2, 0X48C3, 0X48A2, 0X3840, 0X3841, 0X3861, 0X3821,
-  0X3021, 0X3022, 0X4881, 0X60E2, 0X60C0, 0X68E1, 0X8103, 0X78E2,
-  0X68C2, 0X68E2, 0X7123, 0X7984, 0X81A5, 0X7164, 0X60E2, 0X5881,
-  0X58A2, 0X5062, 0X60E4, 0X7144, 0X71E5, 0XAC2B, 0XD50F, 0X7A45,
-  0X4880, 0X5861, 0X6022, 0X6001, 0X6021, 0X6061, 0X5821, 0X5820,
-  0X6041, 0X6841, 0X6020, 0X6020, 0X6840, 0X7861, 0X88C2, 0X9103,
-  0X90C2, 0X8861, 0X8840, 0X8860, 0X8881, 0X88C1, 0X80C1, 0X7061,
-  0X6861, 0X7061, 0X68A1, 0X7060, 0X7840, 0X88A1, 0XB984, 0XD184,
-  0XC141, 0XC960, 0XD9E3, 0XEAA6, 0XFB28, 0XFB89, 0XFB28, 0XDA86,
-  0XEB08, 0XFB49, 0XDA87, 0XB9E5, 0XA9A4, 0XA983, 0X90E2, 0X88A2,
-  0X8902, 0X8902, 0X80E3, 0X78A2, 0X6881, 0X6060, 0X7923, 0X9A27,
-  0X79C6, 0X50E2, 0X3840, 0X3800, 0X3821, 0X3820, 0X3820, 0X4040,
-  0X4860, 0X5861, 0X6081, 0X6881, 0X68A1, 0X68A1, 0X70A1, 0X7081,
-  0X70C2, 0X78E3, 0X70A1, 0X68A2, 0X4881, 0X3041, 0X2840, 0X2841,
-  0X2862, 0X2061, 0X2862, 0X2062, 0X2041, 0X2041, 0X2061, 0X2861,
-  0X6104, 0X58C4, 0X4863, 0X5083, 0X58C5, 0X50C4, 0X50C4, 0X4883,
-  0X4843, 0X4802, 0X5063, 0X68E5, 0X68C3, 0X6881, 0X78C2, 0X8123,
-  0X7903, 0X91E6, 0XA2C9, 0X89E7, 0X81C6, 0X89C7, 0X8125, 0X78A3,
-  0X80E4, 0X8904, 0X8103, 0X78E3, 0X7143, 0X70E4, 0X6083, 0X5863,
-  0X5883, 0X5063, 0X58A3, 0X50C3, 0X5904, 0X6986, 0X7186, 0X6924,
-  0X68E4, 0X7145, 0X7986, 0X70A3, 0X7060, 0X9A64, 0XC4ED, 0XCD90,
-  0XCE13, 0XCDF4, 0X9B8B, 0X5000, 0X5800, 0X8001, 0X80C4, 0X5001,
-  0X3000, 0X3000, 0X4002, 0X4823, 0X58C5, 0X61A7, 0X6228, 0X8BCE,
-  0XF71A, 0XFFFE, 0XCDF4, 0X5AA7, 0X4964, 0X59A6, 0X7228, 0X7228,
-  0X6A08, 0X6A27, 0X6248, 0X5247, 0X5247, 0X5227, 0X4145, 0X3083,
-  0X2862, 0X2861, 0X3062, 0X3043, 0X3823, 0X4043, 0X6081, 0X8880,
-  0X9860, 0XA922, 0XC244, 0XCAA5, 0XDC09, 0XFF75, 0XFFFE, 0XFFFE,
-  0XFFF9, 0XE58C, 0X9A80, 0XA2C1, 0XDBEA, 0XE42F, 0XCC90, 0XD553,
-  0XAB2A, 0X5800, 0X4800, 0X6122, 0X7A46, 0X8205, 0X81C3, 0XE5F2,
-  0XFFFF, 0XFFD9, 0XAAE8, 0X70E2, 0X60E2, 0X5082, 0X4842, 0X4843,
-  0X4822, 0X4022, 0X3842, 0X3022, 0X3822, 0X4041, 0X3841, 0X4083,
-  0X48C3, 0X4883, 0X4862, 0X5082, 0X4882, 0X4861, 0X4881, 0X4861,
-  0X4861, 0X4881, 0X4882, 0X4061, 0X3820, 0X3861, 0X3861, 0X3821,
-  0X3021, 0X3021, 0X3840, 0X50A1, 0X5081, 0X5882, 0X68A2, 0X7102,
-  0X60A1, 0X6061, 0X60A2, 0X5881, 0X58C2, 0X58C2, 0X5062, 0X5882,
-  0X5883, 0X60E3, 0X89E7, 0X9A69, 0X79A5, 0X6982, 0X69A2, 0X5920,
-  0X60E1, 0X88A3, 0X7000, 0X6800, 0X8000, 0X7861, 0X6800, 0X6861,
-  0X6882, 0X6041, 0X6041, 0X6041, 0X6021, 0X6861, 0X70C2, 0X78C2,
-  0X7082, 0X7062, 0X7082, 0X78C3, 0X78E4, 0X70C2, 0X6081, 0X5821,
-  0X6061, 0X6861, 0X68A2, 0X7880, 0X7860, 0X8081, 0X9903, 0XA8E3,
-  0XA0C1, 0XA8C0, 0XB941, 0XDA46, 0XFBED, 0XFCAF, 0XFB6A, 0XD246,
-  0XDAA7, 0XE2E7, 0XD266, 0XCA66, 0XE329, 0XE34A, 0XC288, 0XA9C5,
-  0X9964, 0X8903, 0X78E2, 0X6881, 0X5840, 0X5840, 0X70E2, 0X7964,
-  0X58E2, 0X48A2, 0X3881, 0X3060, 0X3842, 0X4042, 0X3842, 0X4081,
-  0X4882, 0X6903, 0X8164, 0X8163, 0X7902, 0X6901, 0X68C1, 0X6881,
-  0X6041, 0X6041, 0X6081, 0X5880, 0X5060, 0X3820, 0X2800, 0X2001,
-  0X2001, 0X2020, 0X2021, 0X2021, 0X2060, 0X2081, 0X2021, 0X1801,
-  0X48A2, 0X40A3, 0X48A4, 0X4884, 0X40A4, 0X4884, 0X4083, 0X40C4,
-  0X4863, 0X3842, 0X3022, 0X4844, 0X5884, 0X6023, 0X6863, 0X7123,
-  0X7924, 0X89C7, 0XA34A, 0X9B4B, 0X8A89, 0X7A07, 0X8205, 0X8184,
-  0X7945, 0X7945, 0X7905, 0X70E4, 0X6105, 0X58C4, 0X5843, 0X5064,
-  0X58A3, 0X50C4, 0X6104, 0X6125, 0X71C7, 0X8269, 0X8228, 0X7186,
-  0X60E4, 0X6883, 0X7904, 0X9146, 0XAA68, 0XD54F, 0XF7D8, 0XFFDD,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XEFFE, 0XB4AF, 0XA185, 0X98A1, 0X7000,
-  0X4800, 0X5842, 0X6083, 0X3800, 0X2000, 0X3000, 0X4104, 0X6ACA,
-  0XD637, 0XFFFF, 0XFFFF, 0XCE96, 0X940E, 0X6A69, 0X6248, 0X6A49,
-  0X6208, 0X6228, 0X49C6, 0X51E7, 0X5A48, 0X6268, 0X51E6, 0X3104,
-  0X2062, 0X2041, 0X2862, 0X3043, 0X3002, 0X3800, 0X4000, 0X6000,
-  0X8800, 0XB8C2, 0XE307, 0XEC2A, 0XEBC9, 0XF3C9, 0XFCEB, 0XE4A7,
-  0XBBA3, 0X7A80, 0X5A60, 0X9444, 0XD58D, 0XBC0C, 0XCCD1, 0XFFBC,
-  0XFEB8, 0XA1E7, 0X99E6, 0XEED5, 0XFFFF, 0XF7FF, 0XF7DA, 0XFFFF,
-  0XFFFD, 0XEDF2, 0XE50E, 0XCBEB, 0X8184, 0X6082, 0X5883, 0X5043,
-  0X4023, 0X4023, 0X3842, 0X3002, 0X3022, 0X3862, 0X4061, 0X4082,
-  0X4062, 0X4041, 0X4841, 0X4842, 0X4042, 0X4062, 0X4881, 0X4882,
-  0X4882, 0X5082, 0X4862, 0X4041, 0X3800, 0X3041, 0X3041, 0X3841,
-  0X3842, 0X3021, 0X3020, 0X3840, 0X4881, 0X5082, 0X5862, 0X5881,
-  0X6082, 0X78E4, 0X7104, 0X5881, 0X5882, 0X5883, 0X6063, 0X68A4,
-  0X60C3, 0X7924, 0X9A07, 0X89C6, 0X68C1, 0X5880, 0X69A1, 0X9347,
-  0XC3CA, 0XC34A, 0X7163, 0X58C0, 0X78E1, 0X7800, 0X8800, 0X80A3,
-  0X70A3, 0X6863, 0X6862, 0X6861, 0X6062, 0X68A2, 0X60C2, 0X5881,
-  0X5882, 0X5883, 0X60E3, 0X68E3, 0X6083, 0X5881, 0X5081, 0X5042,
-  0X5882, 0X58A2, 0X58C2, 0X60C2, 0X78E2, 0X80C2, 0X7882, 0X80A3,
-  0X88A3, 0X90C2, 0X9922, 0XC1E4, 0XEAE8, 0XF329, 0XC9E5, 0XB163,
-  0XB983, 0XC204, 0XB9E4, 0XB9C3, 0XB9E4, 0XA183, 0X80E1, 0X78A0,
-  0X70A0, 0X60A0, 0X5040, 0X5040, 0X5040, 0X5040, 0X5881, 0X50A0,
-  0X48A0, 0X40A1, 0X3881, 0X2860, 0X3061, 0X3061, 0X3041, 0X3861,
-  0X4882, 0X6903, 0X7964, 0X7964, 0X7103, 0X68E1, 0X68C1, 0X6881,
-  0X6060, 0X6060, 0X5881, 0X58A1, 0X58A1, 0X4880, 0X4040, 0X3000,
-  0X2000, 0X2000, 0X2000, 0X1800, 0X2020, 0X2821, 0X2820, 0X1800,
-  0X38A4, 0X30C4, 0X38A4, 0X38A4, 0X3063, 0X2843, 0X2822, 0X2843,
-  0X3043, 0X3042, 0X2841, 0X3022, 0X3822, 0X4803, 0X5863, 0X58C4,
-  0X58C4, 0X6104, 0X6985, 0X69C5, 0X69C5, 0X6165, 0X6144, 0X6164,
-  0X71A4, 0X71A5, 0X7144, 0X7186, 0X6987, 0X6146, 0X58A4, 0X58C4,
-  0X69A7, 0X69C8, 0X7229, 0X7208, 0X7229, 0X7A69, 0X8228, 0X81E7,
-  0X7185, 0X68E3, 0X6081, 0X9125, 0XEC0F, 0XFF59, 0XFFDF, 0XFFDF,
-  0XFFDF, 0XFFB7, 0XFFF9, 0XFFFF, 0XFFFF, 0XF6B6, 0XB9E3, 0X98C0,
-  0XC3AC, 0XFFFF, 0XFFFF, 0XDD54, 0X6965, 0X69E7, 0X8B4D, 0X8B8D,
-  0X9470, 0XAD12, 0X8BED, 0X62C8, 0X5A48, 0X5A48, 0X49E7, 0X6A6A,
-  0X832C, 0X7ACB, 0X3103, 0X3904, 0X51A6, 0X51A6, 0X4985, 0X4144,
-  0X2882, 0X2041, 0X2843, 0X3023, 0X3801, 0X4800, 0X6080, 0X8164,
-  0XA206, 0XBA66, 0XD349, 0XE44B, 0XECAE, 0XF3ED, 0XD2E7, 0XC241,
-  0XBA60, 0XA364, 0XADAD, 0XD7B5, 0XE795, 0X8BE8, 0X8329, 0XB4B1,
-  0XDDD5, 0XCBEE, 0XAA27, 0XD570, 0XFFFD, 0XFFFF, 0XFFFE, 0XFFFF,
-  0XFFFE, 0XFF57, 0XF612, 0XDC4C, 0XB267, 0X8946, 0X70E5, 0X5044,
-  0X4004, 0X3824, 0X3822, 0X2802, 0X2803, 0X3043, 0X4041, 0X4841,
-  0X4000, 0X4840, 0X5881, 0X5842, 0X4822, 0X4021, 0X4842, 0X5083,
-  0X50A3, 0X50C3, 0X50C3, 0X4882, 0X3841, 0X3841, 0X3861, 0X3842,
-  0X3862, 0X3022, 0X3001, 0X3821, 0X4881, 0X4882, 0X4841, 0X5081,
-  0X7144, 0X9186, 0X9126, 0X8105, 0X9188, 0X8967, 0X68A4, 0X6062,
-  0X6841, 0X7081, 0X7060, 0X6000, 0X6880, 0X7A43, 0XBD0D, 0XFFFA,
-  0XFFFB, 0XEE71, 0X7C08, 0XA531, 0XEF18, 0XD52E, 0X8120, 0X6000,
-  0X6862, 0X70C3, 0X68A2, 0X70C3, 0X68A3, 0X60C2, 0X5902, 0X50C1,
-  0X4881, 0X48C2, 0X58E3, 0X58C3, 0X5082, 0X5081, 0X50C2, 0X58C3,
-  0X58C3, 0X58E3, 0X50C2, 0X58C3, 0X58E4, 0X58A3, 0X6863, 0X6883,
-  0X78A4, 0X78C3, 0X78A2, 0X80E0, 0X8940, 0X9920, 0X90A0, 0X88A0,
-  0X9902, 0XA163, 0XA162, 0X9101, 0X88C2, 0X7881, 0X6020, 0X4800,
-  0X4000, 0X4040, 0X4020, 0X4840, 0X4861, 0X5060, 0X4861, 0X50A1,
-  0X5102, 0X4902, 0X38A1, 0X3060, 0X3060, 0X2861, 0X2840, 0X3040,
-  0X3861, 0X4882, 0X50C2, 0X50A2, 0X5061, 0X5060, 0X5880, 0X5861,
-  0X5861, 0X5860, 0X5860, 0X58A1, 0X5902, 0X6122, 0X5902, 0X50C1,
-  0X4061, 0X3041, 0X3061, 0X2861, 0X3083, 0X3082, 0X5122, 0X7A25,
-  0X2884, 0X3084, 0X30C3, 0X3083, 0X2883, 0X2883, 0X2883, 0X3083,
-  0X2863, 0X2863, 0X2862, 0X3082, 0X38A3, 0X3883, 0X5084, 0X60A5,
-  0X50A3, 0X48A3, 0X50A3, 0X5082, 0X4881, 0X4882, 0X48C3, 0X5165,
-  0X6A06, 0X7226, 0X69A5, 0X69A6, 0X69C7, 0X69A7, 0X6125, 0X58E5,
-  0X6166, 0X69E8, 0X720A, 0X6A08, 0X61A7, 0X5986, 0X5165, 0X5103,
-  0X6104, 0X5863, 0X5842, 0X78E4, 0XCACB, 0XFD74, 0XFF18, 0XFFD8,
-  0XFFD6, 0XFF31, 0XFED0, 0XFF34, 0XFFFB, 0XFFFA, 0XE44A, 0XC2A5,
-  0XFFBC, 0XFFFF, 0XFFFF, 0XFE55, 0XA3AC, 0XAC0F, 0XF638, 0XDDF7,
-  0X838D, 0X6268, 0X5A88, 0X634A, 0X6B0B, 0X5A68, 0X3945, 0X6A8A,
-  0XD617, 0XDE18, 0X62A9, 0X38E2, 0X4903, 0X4924, 0X40E4, 0X40A3,
-  0X2820, 0X1800, 0X2000, 0X3801, 0X4822, 0X4800, 0X5800, 0X9A47,
-  0XDDD1, 0XDF55, 0XCE13, 0XDCF0, 0XF5D3, 0XFED7, 0XF634, 0XDC2C,
-  0XC263, 0XC305, 0XFF57, 0XFFFF, 0XFFFF, 0XCE72, 0XA56F, 0XCE56,
-  0XEE97, 0XE553, 0XD42F, 0XD4D0, 0XEEF6, 0XFFFC, 0XFFFE, 0XFFFD,
-  0XFFFE, 0XFFFC, 0XFF36, 0XD40C, 0XCAC9, 0XBA4A, 0X91A9, 0X60A6,
-  0X4825, 0X3803, 0X3002, 0X2803, 0X2004, 0X3804, 0X4800, 0X4800,
-  0X4000, 0X78A2, 0X9104, 0X78A2, 0X6062, 0X4801, 0X5022, 0X5883,
-  0X50A3, 0X50C3, 0X50E4, 0X50C4, 0X4082, 0X3862, 0X3842, 0X3862,
-  0X3842, 0X3022, 0X3822, 0X4063, 0X4863, 0X3800, 0X3040, 0X7224,
-  0XA369, 0XC36B, 0XBA68, 0XA185, 0XA966, 0XA0E5, 0X7000, 0X4800,
-  0X4000, 0X3800, 0X4000, 0X6880, 0X9A86, 0XBC6C, 0XFF57, 0XFFFF,
-  0XFFF7, 0XBD8B, 0XB630, 0XFFFF, 0XFFFF, 0XFFFE, 0XD58E, 0X9244,
-  0X70A2, 0X6882, 0X68C3, 0X7124, 0X6904, 0X58E4, 0X5903, 0X5103,
-  0X48E2, 0X48C2, 0X50E3, 0X58E4, 0X58C3, 0X58C3, 0X58E3, 0X58E3,
-  0X58E4, 0X58E3, 0X58E2, 0X58E3, 0X50C3, 0X48A2, 0X50C3, 0X58A3,
-  0X60A3, 0X6083, 0X6882, 0X68C3, 0X7104, 0X7965, 0X7104, 0X6882,
-  0X70A2, 0X8104, 0X7902, 0X70C2, 0X6862, 0X6041, 0X5041, 0X4861,
-  0X4061, 0X3840, 0X4020, 0X4840, 0X4881, 0X4881, 0X4881, 0X50E2,
-  0X61A4, 0X59C4, 0X4943, 0X38A2, 0X2820, 0X2840, 0X2840, 0X3040,
-  0X3041, 0X3061, 0X4081, 0X48A2, 0X4862, 0X4861, 0X5061, 0X5861,
-  0X6081, 0X6081, 0X60A2, 0X68E2, 0X6943, 0X6963, 0X6964, 0X6144,
-  0X5923, 0X50E1, 0X4080, 0X40A2, 0X48C2, 0X48E2, 0X5983, 0X7224,
-  0X2882, 0X3083, 0X30A3, 0X3083, 0X2863, 0X2862, 0X2862, 0X2882,
-  0X3083, 0X3082, 0X2841, 0X2822, 0X38E5, 0X51A7, 0X5985, 0X4943,
-  0X40E3, 0X4903, 0X5944, 0X5905, 0X50C4, 0X50E3, 0X5103, 0X61C7,
-  0X7A4A, 0X930C, 0X82AA, 0X7A27, 0X71E7, 0X69C7, 0X7187, 0X6966,
-  0X6187, 0X6A08, 0X7A6A, 0X726A, 0X6A29, 0X7208, 0X82EA, 0XB4B0,
-  0X934C, 0X5083, 0X5022, 0X6883, 0X7906, 0XA1C8, 0XAA07, 0XB2C6,
-  0XC448, 0XE5AB, 0XF62D, 0XE509, 0XD467, 0XED8E, 0XF58F, 0XD3C8,
-  0XECCE, 0XFFFE, 0XFFFF, 0XFE75, 0XB48E, 0XAC70, 0XCD34, 0XBCF3,
-  0X7B4C, 0X49C6, 0X49A6, 0X83EE, 0XA4D1, 0X734C, 0X3123, 0X30C2,
-  0X832D, 0XC576, 0XA44F, 0X61A3, 0X50C0, 0X6102, 0X58E5, 0X4843,
-  0X3801, 0X4001, 0X4842, 0X5042, 0X5862, 0X5000, 0X4000, 0X6020,
-  0XC4AD, 0XFFFC, 0XFFFF, 0XFFFF, 0XFFFC, 0XFF79, 0XFF78, 0XFEB7,
-  0XE3ED, 0XC1A3, 0XE3CA, 0XFF13, 0XFFD7, 0XF7F9, 0XFFFD, 0XFFFF,
-  0XFFFD, 0XF6F7, 0XE5B3, 0XE593, 0XEE74, 0XFFB8, 0XFFFC, 0XFFFA,
-  0XFFFB, 0XFFFD, 0XFFFA, 0XC46C, 0XBA47, 0XCA6A, 0XC2AC, 0X91EA,
-  0X7149, 0X5065, 0X4003, 0X3804, 0X3805, 0X4823, 0X5000, 0X5000,
-  0X6000, 0XC228, 0XE2AB, 0XB9A7, 0XA185, 0X78C3, 0X6023, 0X5863,
-  0X5082, 0X48A3, 0X50E4, 0X50C4, 0X48C4, 0X3862, 0X3022, 0X3063,
-  0X3063, 0X3062, 0X3843, 0X4063, 0X4822, 0X3800, 0X8286, 0XFF35,
-  0XFFF7, 0XFF33, 0XD4AB, 0XCB88, 0XCB27, 0XA942, 0X7800, 0XA225,
-  0XF5D2, 0XF779, 0XE778, 0XFF57, 0XF675, 0XF655, 0XFFFC, 0XFFFC,
-  0XEE10, 0XA3E6, 0XB5AC, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFF9, 0XCD0D,
-  0XAAA7, 0X91C6, 0X79A6, 0X7166, 0X6125, 0X50E4, 0X4904, 0X48C3,
-  0X48A3, 0X48E3, 0X5124, 0X6124, 0X58E4, 0X50A2, 0X4842, 0X58A3,
-  0X60E4, 0X58E3, 0X6103, 0X58C3, 0X4061, 0X3861, 0X4042, 0X4062,
-  0X4062, 0X5062, 0X58A3, 0X60E4, 0X6905, 0X6905, 0X60C4, 0X60C4,
-  0X7126, 0X6905, 0X60A3, 0X5882, 0X5882, 0X5881, 0X5081, 0X4881,
-  0X4061, 0X3860, 0X40A1, 0X48A1, 0X48C2, 0X48C2, 0X48A1, 0X5984,
-  0X82E8, 0X7AC8, 0X59A5, 0X38E2, 0X2820, 0X2020, 0X2841, 0X3041,
-  0X3041, 0X3862, 0X3882, 0X48A2, 0X50A2, 0X5081, 0X5061, 0X5040,
-  0X5060, 0X5860, 0X5861, 0X5882, 0X6102, 0X69A4, 0X71C5, 0X6984,
-  0X6164, 0X5943, 0X4922, 0X5183, 0X7A47, 0X7A67, 0X7A67, 0X7A86,
-  0X38C3, 0X3082, 0X38A3, 0X38A4, 0X3063, 0X2863, 0X3063, 0X3063,
-  0X3042, 0X2862, 0X2023, 0X1824, 0X3823, 0X6143, 0X7207, 0X71E7,
-  0X79C7, 0X8228, 0X8228, 0X8249, 0X79C8, 0X7145, 0X4060, 0X40E2,
-  0X69C4, 0X936A, 0X9B8B, 0X9B2B, 0X92AA, 0X8289, 0X7A28, 0X79E7,
-  0X7A28, 0X8289, 0X8B0B, 0X8B4C, 0X832A, 0X82EA, 0XBC91, 0XFFDD,
-  0XF6F9, 0X8B2B, 0X50E4, 0X6084, 0X68C6, 0X7948, 0X7882, 0X7800,
-  0X9201, 0XC56D, 0XEF35, 0XE5EE, 0XCC05, 0XDC89, 0XFE74, 0XE50F,
-  0XB284, 0XC329, 0XDC90, 0XCC6F, 0XA3EC, 0X7B0A, 0X6269, 0X6269,
-  0X5A07, 0X4986, 0X5146, 0X832D, 0XACB2, 0X9C10, 0X72CB, 0X38E3,
-  0X3063, 0X6208, 0X7AA8, 0X8A44, 0X8180, 0X7120, 0X68C0, 0X58A1,
-  0X60C2, 0X7145, 0X89C7, 0X7946, 0X60A3, 0X5842, 0X5000, 0X6800,
-  0X9A26, 0XCDB0, 0XFFFB, 0XFFFF, 0XFFFC, 0XF674, 0XDDF1, 0XEEF6,
-  0XFF5A, 0XFD13, 0XFC0C, 0XFD4D, 0XFE91, 0XFFF7, 0XFFFE, 0XFFFF,
-  0XFFFD, 0XFFD9, 0XEE96, 0XFED6, 0XFF57, 0XFF57, 0XF7D9, 0XEF76,
-  0XF777, 0XFFFD, 0XFFFF, 0XD735, 0X9C0A, 0X9A47, 0XAA28, 0X9A4B,
-  0X798A, 0X5886, 0X4004, 0X4005, 0X5045, 0X6062, 0X6000, 0X5000,
-  0X60C0, 0XA388, 0XCBCB, 0XCA68, 0XC1E7, 0XC229, 0X99A8, 0X70C5,
-  0X5863, 0X50A3, 0X4083, 0X4063, 0X40A2, 0X3062, 0X3042, 0X3063,
-  0X3083, 0X3064, 0X3864, 0X4843, 0X5001, 0X4800, 0X92C8, 0XEEB4,
-  0XEED3, 0XD5EF, 0XC64E, 0XF7F5, 0XFF30, 0XAAC3, 0X99E2, 0XFE93,
-  0XFFFE, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFA, 0XFF58, 0XFF99, 0XF652,
-  0XBB67, 0X9A02, 0XAB26, 0XCDD1, 0XFFF9, 0XFFFF, 0XFFFB, 0XCDEF,
-  0XAB28, 0X81A6, 0X6924, 0X50C4, 0X4863, 0X48A4, 0X48C4, 0X48A3,
-  0X48C4, 0X48C4, 0X5104, 0X58C3, 0X5062, 0X4841, 0X5041, 0X4800,
-  0X5000, 0X60E3, 0X5903, 0X4882, 0X4062, 0X3821, 0X3842, 0X3863,
-  0X3802, 0X3801, 0X4822, 0X58A3, 0X68E4, 0X60E4, 0X58C3, 0X6103,
-  0X6945, 0X5904, 0X4882, 0X5082, 0X58A2, 0X50A2, 0X48A2, 0X3862,
-  0X3841, 0X3861, 0X40C2, 0X6165, 0X69C6, 0X6184, 0X4901, 0X5A25,
-  0XA40C, 0XA3ED, 0X6205, 0X40E1, 0X3881, 0X2840, 0X2841, 0X3041,
-  0X3862, 0X3862, 0X3861, 0X3841, 0X4861, 0X4881, 0X50A2, 0X58A1,
-  0X5881, 0X58A2, 0X58C2, 0X58A2, 0X50A2, 0X58E2, 0X6123, 0X6143,
-  0X71A5, 0X6984, 0X48E1, 0X40C0, 0X4922, 0X59A3, 0X6A04, 0X7A85,
-  0X4924, 0X40C2, 0X40A2, 0X40A2, 0X40C2, 0X40A3, 0X40C4, 0X40C4,
-  0X3082, 0X2842, 0X3042, 0X4800, 0X7000, 0XA0A2, 0XC1A4, 0XDB8A,
-  0XFD94, 0XFE77, 0XFD32, 0XC38B, 0XA309, 0X9B2B, 0X8227, 0X9287,
-  0XC44C, 0XD50E, 0XBC4C, 0XC40E, 0XBBCF, 0XB38D, 0XA36B, 0X9AEA,
-  0XA30A, 0X9B4B, 0X8B0B, 0X8B2B, 0X8B0A, 0X82E9, 0X93AD, 0XC534,
-  0XD5F5, 0XA490, 0X7268, 0X6146, 0X6906, 0X68E6, 0X68E5, 0X80E1,
-  0XA201, 0XD58F, 0XFFDD, 0XFFDB, 0XF6F3, 0XE6B3, 0XF737, 0XF635,
-  0XC369, 0XA1E4, 0X9165, 0X80E4, 0X7965, 0X61E7, 0X51E8, 0X51C8,
-  0X59C7, 0X51A6, 0X5146, 0X5946, 0X5187, 0X51C7, 0X59E7, 0X6A49,
-  0X61E9, 0X5965, 0X4840, 0X7980, 0XBB47, 0XD40B, 0XDC2B, 0XBAE7,
-  0X89A2, 0X81E5, 0XAB4B, 0XA2AA, 0X60E3, 0X6923, 0XB32B, 0XC3AD,
-  0X9226, 0X8AA5, 0XD5F0, 0XFFF9, 0XFF56, 0XD50F, 0X9B69, 0XACAD,
-  0XDDB1, 0XFCD0, 0XF36A, 0XF3CA, 0XFD90, 0XFF15, 0XFFF9, 0XFFF9,
-  0XFFF9, 0XFFF8, 0XEF56, 0XEE93, 0XFF36, 0XFF37, 0XFF35, 0XF754,
-  0XFFF8, 0XFFFE, 0XFFFF, 0XFFFB, 0XDE93, 0XC3CC, 0XC2EC, 0XBB0E,
-  0X922B, 0X60E7, 0X5066, 0X5066, 0X68A5, 0X8903, 0X9900, 0X98E0,
-  0XAC49, 0XCF16, 0XE6F9, 0XDD72, 0XCBEB, 0XCAC8, 0XB988, 0XA128,
-  0X8927, 0X70C5, 0X5084, 0X3844, 0X3844, 0X2863, 0X2843, 0X3063,
-  0X3064, 0X3045, 0X3804, 0X5042, 0X6040, 0X5800, 0X9A88, 0XE674,
-  0XFF56, 0XFF77, 0XFFFC, 0XFFFF, 0XFFFD, 0XE64E, 0XDE0E, 0XFFFC,
-  0XFFFC, 0XFFDA, 0XFFDA, 0XFF97, 0XFF15, 0XEE53, 0XC4AD, 0XB308,
-  0X9963, 0X9922, 0XBA27, 0XB2C9, 0XA3CA, 0XCE50, 0XB5EE, 0XA44A,
-  0X92A8, 0X7986, 0X58C4, 0X4883, 0X4843, 0X4063, 0X4083, 0X48A3,
-  0X48A3, 0X50A2, 0X58C2, 0X4860, 0X4000, 0X81E5, 0X92E7, 0X4040,
-  0X2800, 0X4000, 0X5000, 0X60A3, 0X60A3, 0X5022, 0X5022, 0X5843,
-  0X5843, 0X5063, 0X5083, 0X68E4, 0X7125, 0X6904, 0X58E3, 0X50E3,
-  0X58E3, 0X48C3, 0X48C3, 0X48C3, 0X50C3, 0X48C3, 0X40A3, 0X38A3,
-  0X3882, 0X4083, 0X40C3, 0X5143, 0X69E6, 0X71E5, 0X5101, 0X40E0,
-  0X7AA7, 0X8B28, 0X59A3, 0X48E0, 0X48A0, 0X4061, 0X4882, 0X48A2,
-  0X4882, 0X4882, 0X4082, 0X3861, 0X4040, 0X50A2, 0X6124, 0X6104,
-  0X60E3, 0X5903, 0X58C2, 0X5881, 0X58A1, 0X58A2, 0X48C2, 0X50E2,
-  0X5944, 0X6164, 0X58E2, 0X48C2, 0X5943, 0X5184, 0X59C4, 0X61E5,
-  0X40E2, 0X5164, 0X61C6, 0X6A07, 0X69A5, 0X5104, 0X5124, 0X5986,
-  0X4986, 0X38C3, 0X58A2, 0XA144, 0XC9C5, 0XC1C4, 0XB1A3, 0XF42B,
-  0XFE75, 0XFE15, 0XEC4F, 0XBB4B, 0X9AA8, 0X8A68, 0X9AA8, 0XD3CC,
-  0XF4EF, 0XDCEE, 0XC48C, 0XD4EF, 0XE510, 0XE510, 0XCC8E, 0XB3EC,
-  0XB38B, 0XAB8C, 0X932B, 0X8AE9, 0X8B09, 0X8B4B, 0X830C, 0X7AEB,
-  0X832B, 0X834B, 0X7AAA, 0X7208, 0X69A8, 0X6967, 0X9229, 0XBBAC,
-  0XDCED, 0XFEB4, 0XFFDD, 0XFFFF, 0XFFFE, 0XFFFF, 0XFFFF, 0XFFFC,
-  0XF613, 0XD48E, 0XBB2C, 0X80A4, 0X6000, 0X78A5, 0X6968, 0X5948,
-  0X5167, 0X5186, 0X4126, 0X48C5, 0X48C5, 0X48E5, 0X40E4, 0X51A6,
-  0X830D, 0XA3AE, 0X8205, 0X81A1, 0XD388, 0XFE53, 0XFFFA, 0XFF36,
-  0XBB68, 0X8A23, 0XA3E9, 0X9349, 0X4880, 0X58E1, 0XD4F1, 0XFF19,
-  0XD46F, 0X79C3, 0X9BC9, 0XFFD7, 0XFFFC, 0XFEB4, 0XC4CD, 0XBC6C,
-  0XD46E, 0XDBCC, 0XD2E8, 0XEB49, 0XFCD0, 0XFDF2, 0XFF93, 0XE7F3,
-  0XFFF7, 0XFFFC, 0XFFF9, 0XE6B4, 0XF735, 0XFF56, 0XE611, 0XDE0F,
-  0XFFF8, 0XFFFE, 0XFFFC, 0XF7F6, 0XDEB2, 0XCC2E, 0XCB0D, 0XC36F,
-  0X9AAC, 0X6947, 0X6108, 0X60C7, 0X7907, 0XA9C6, 0XDA85, 0XFC08,
-  0XFFF6, 0XFFFF, 0XFFFF, 0XFFFF, 0XDED5, 0XBBE9, 0XB9A6, 0XB107,
-  0X98E6, 0X8884, 0X7085, 0X5024, 0X4004, 0X3825, 0X4065, 0X40A5,
-  0X3865, 0X3024, 0X3803, 0X5062, 0X6861, 0X6000, 0XA269, 0XE6B5,
-  0XFF98, 0XFFB9, 0XFFFD, 0XFFFF, 0XFFFE, 0XE714, 0XEF54, 0XFF77,
-  0XDE32, 0XDDCF, 0XD5AE, 0XE652, 0XFED4, 0XCDB0, 0XACEC, 0XD551,
-  0XB2AC, 0XA1C7, 0XCA6B, 0X9946, 0X8985, 0XB3CC, 0X938B, 0X9B0A,
-  0X9A8A, 0X7166, 0X58A4, 0X5063, 0X4023, 0X4043, 0X4064, 0X4063,
-  0X4861, 0X58A1, 0X7123, 0X6081, 0XBB4B, 0XFFFB, 0XE734, 0X8449,
-  0X9C2D, 0X50E2, 0X0000, 0X2000, 0X6800, 0X7021, 0X7002, 0X7802,
-  0X6800, 0X6800, 0X8844, 0XA147, 0X9986, 0X8965, 0X6966, 0X5104,
-  0X4082, 0X5103, 0X61C7, 0X5986, 0X4904, 0X38C3, 0X40A3, 0X4082,
-  0X3862, 0X3021, 0X1820, 0X2840, 0X5144, 0X6185, 0X50C1, 0X4820,
-  0X6162, 0X7285, 0X6A85, 0X69C3, 0X5902, 0X6103, 0X6904, 0X5882,
-  0X6063, 0X5862, 0X50A3, 0X48C3, 0X4882, 0X50C3, 0X5904, 0X58E3,
-  0X50C3, 0X50C3, 0X50A2, 0X58A2, 0X50A2, 0X4881, 0X50E3, 0X8289,
-  0X8AAA, 0X6185, 0X4081, 0X3881, 0X5923, 0X934A, 0X93AD, 0X8B6A,
-  0X5943, 0X69A5, 0X82C9, 0X8BAD, 0X8B8C, 0X7206, 0X5963, 0X6227,
-  0X59C6, 0X3840, 0X5860, 0XB269, 0XDC2E, 0XEC91, 0XC42F, 0XDC4C,
-  0XFCCE, 0XEC4F, 0XCB6B, 0XA288, 0X9247, 0X91C6, 0X9165, 0XA9C5,
-  0XDB69, 0XF4AF, 0XF570, 0XFE92, 0XEE51, 0XF612, 0XEDD4, 0XD531,
-  0XBC0D, 0XB40D, 0XABCC, 0X8AA9, 0X7AA8, 0X938C, 0X8B6D, 0X7B0A,
-  0X6A87, 0X6206, 0X5966, 0X6187, 0X7A6C, 0X7A2B, 0X6946, 0X7A26,
-  0XCD30, 0XFF57, 0XFFB7, 0XFF56, 0XFFB9, 0XFFFE, 0XFFFF, 0XFFFC,
-  0XFF55, 0XFEF5, 0XFFFD, 0XFF5D, 0XC36F, 0X9107, 0X6886, 0X5908,
-  0X40E7, 0X38A4, 0X40E6, 0X61A9, 0X6128, 0X58E7, 0X4063, 0X3882,
-  0X51A6, 0X830A, 0X8264, 0X71A0, 0XAAE5, 0XF58F, 0XFFF9, 0XFFFC,
-  0XE611, 0XCC4B, 0XFEB5, 0XFFFC, 0XD531, 0X69C4, 0X9B6B, 0XFF3A,
-  0XFF5A, 0XC3CC, 0X8264, 0XBD4E, 0XFFD8, 0XEE93, 0X9BE9, 0XB369,
-  0XDBCD, 0XBACA, 0XB267, 0XE34A, 0XFC2E, 0XFBCC, 0XFD0E, 0XFEB1,
-  0XEFF5, 0XFFF8, 0XFFF7, 0XF797, 0XFFB8, 0XFFF9, 0XDE52, 0XCD6E,
-  0XF736, 0XFFFA, 0XDEB2, 0XB54A, 0X93A8, 0X81C5, 0X8946, 0X920A,
-  0X81EA, 0X6108, 0X6928, 0X60C6, 0X6086, 0X9106, 0XC9C5, 0XFC28,
-  0XFF10, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XAF11, 0X8B63, 0X90E0,
-  0X9000, 0X9821, 0X9084, 0X7823, 0X5002, 0X4804, 0X4846, 0X4865,
-  0X4004, 0X3803, 0X4003, 0X4802, 0X5843, 0X80E5, 0XBBAE, 0XD675,
-  0XD6B5, 0XE6D5, 0XEF37, 0XF799, 0XDEB6, 0XDE93, 0XFFB6, 0XFFFB,
-  0XFFFC, 0XFFD6, 0XC5AD, 0XDE31, 0XFEF5, 0XD611, 0XCDF1, 0XF636,
-  0XE431, 0XD38F, 0XBA8B, 0X7022, 0X7022, 0X91C7, 0X81E7, 0X8A28,
-  0X89C8, 0X6925, 0X60C4, 0X60C5, 0X6107, 0X5906, 0X4022, 0X3000,
-  0X4000, 0X6922, 0X8184, 0X7861, 0X88A1, 0X82A4, 0X8DAD, 0XFFFF,
-  0XFFFF, 0XDF39, 0X82A5, 0X6000, 0X5000, 0X78A2, 0XB1E8, 0XA105,
-  0X9986, 0XD32C, 0XB146, 0X8801, 0XB8A5, 0XB146, 0X89E9, 0X69C9,
-  0X5125, 0X5986, 0X61C7, 0X5966, 0X48E5, 0X40A3, 0X4083, 0X4062,
-  0X3842, 0X2800, 0X30A1, 0X9BAD, 0XB450, 0X7207, 0X3860, 0X3040,
-  0X7963, 0XFE95, 0XFFFF, 0XEED6, 0X938A, 0X7AA8, 0X8AE9, 0X6944,
-  0X5040, 0X5820, 0X60E3, 0X6105, 0X58E4, 0X50C3, 0X50C3, 0X50A3,
-  0X50A3, 0X4862, 0X4861, 0X5061, 0X5861, 0X5881, 0X6103, 0X8A8A,
-  0X8249, 0X5945, 0X48A2, 0X3041, 0X3041, 0X61C6, 0X7B2C, 0X72E9,
-  0X71A4, 0X7184, 0X8A88, 0X9C0E, 0X9C50, 0X936B, 0X8288, 0X9C0E,
-  0XACB2, 0X9AEA, 0X7102, 0X9227, 0XF594, 0XFF5A, 0XE594, 0XCC0D,
-  0XE46E, 0XEC8E, 0XC38B, 0X9A26, 0X9A06, 0XB267, 0X8924, 0X9984,
-  0XDB29, 0XFC4E, 0XFC8E, 0XFDB1, 0XFE31, 0XF692, 0XFEB5, 0XF674,
-  0XDD71, 0XCD10, 0XBCB0, 0X932B, 0X7AC9, 0X93CC, 0X9C0E, 0X832A,
-  0X6A87, 0X61C7, 0X5125, 0X4884, 0X5107, 0X7A2B, 0X8AAB, 0X8B0A,
-  0XBD10, 0XFF17, 0XFEB5, 0XEE12, 0XF737, 0XFFFE, 0XFFFF, 0XFFFC,
-  0XFF53, 0XEDAC, 0XEDCF, 0XFF38, 0XFDD6, 0XBAEC, 0X7907, 0X6909,
-  0X48E8, 0X38E6, 0X7A8C, 0X9B2F, 0X71AA, 0X6108, 0X5884, 0X5082,
-  0X7AAB, 0XCD97, 0XFED7, 0XB44A, 0XA386, 0XD56E, 0XD58E, 0XBB67,
-  0XBAC5, 0XDC4B, 0XFE33, 0XFF78, 0XF675, 0X9B69, 0X6183, 0X92C8,
-  0XED73, 0XF553, 0X9B29, 0X9C2A, 0XFFF8, 0XFFF8, 0X8BA8, 0X9A25,
-  0XD36D, 0XBACC, 0X91A7, 0XA206, 0XAAA8, 0XD32C, 0XFC6E, 0XFD6E,
-  0XFE8F, 0XEFD3, 0XFFF6, 0XFFF9, 0XFFFA, 0XFFFD, 0XF7D9, 0XDE73,
-  0XDDB1, 0XAC2A, 0X8305, 0XAC2A, 0XA3CA, 0X81C6, 0X78E5, 0X7106,
-  0X60E6, 0X5085, 0X58A6, 0X60A6, 0X6886, 0X80C6, 0XB146, 0XEBA8,
-  0XF60B, 0XEF51, 0XEFB6, 0XFFFB, 0XFFFC, 0XC711, 0XB66C, 0XB509,
-  0XB325, 0XA9C3, 0XB103, 0XA0A3, 0X7800, 0X6003, 0X6025, 0X5004,
-  0X4803, 0X4003, 0X4803, 0X5023, 0X70E5, 0XA209, 0XBB8E, 0XE5D4,
-  0XFFFA, 0XFFFD, 0XEED5, 0XBD4E, 0XB4EC, 0XDE73, 0XFFFA, 0XFFFA,
-  0XFFFA, 0XFF76, 0XB52C, 0XC56D, 0XEED4, 0XE653, 0XDD72, 0XDCB1,
-  0XB2CB, 0X8987, 0X4800, 0X1000, 0X5000, 0X8166, 0X89C7, 0XAAAA,
-  0XB28B, 0X8987, 0X7126, 0X7947, 0X89C9, 0X7146, 0X2800, 0X1000,
-  0X4121, 0X7AE9, 0X92E9, 0X8983, 0X5800, 0X4000, 0XC52C, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XCCC8, 0X92E1, 0XA508, 0XEFF7, 0XFFFD, 0XCCCF,
-  0XCD31, 0XFFFB, 0XF6D7, 0X9A26, 0X6800, 0X8000, 0X91A7, 0X8A2A,
-  0X71C8, 0X5947, 0X5946, 0X5126, 0X48E5, 0X40A4, 0X3842, 0X3821,
-  0X4842, 0X5041, 0X5904, 0X9B6E, 0X9B4D, 0X71E7, 0X5903, 0X30A1,
-  0X5124, 0XC490, 0XFFFE, 0XF798, 0XBD6F, 0XA42E, 0X9BCD, 0X93AC,
-  0X8308, 0X61C2, 0X7122, 0X7985, 0X7965, 0X60A3, 0X4862, 0X50A3,
-  0X5083, 0X4820, 0X3840, 0X4040, 0X7163, 0X7942, 0X5860, 0X6924,
-  0X7185, 0X6103, 0X4882, 0X3861, 0X4062, 0X4882, 0X40A2, 0X38A1,
-  0X8A87, 0X7A05, 0X8AC8, 0X8B08, 0X8204, 0X81A4, 0X92C9, 0XB42E,
-  0XBCF0, 0XC42E, 0X8A26, 0X68E1, 0X89C5, 0XCBCD, 0XDBED, 0XB2E8,
-  0XAB09, 0XD46F, 0XCC6D, 0X9A86, 0XB268, 0XD30C, 0X99C7, 0XA1C5,
-  0XD309, 0XD36B, 0XE38C, 0XFC8E, 0XFD0E, 0XF5AE, 0XEEB1, 0XEE93,
-  0XE613, 0XE635, 0XD5B5, 0XB4B1, 0X9BCC, 0X938C, 0X7AC8, 0X6A06,
-  0X6A48, 0X6A08, 0X5947, 0X4044, 0X3024, 0X6948, 0XA32C, 0XC511,
-  0XE6B7, 0XF79C, 0XFFBB, 0XFF37, 0XFF77, 0XFFFD, 0XFFFF, 0XFFFF,
-  0XFFF7, 0XFF32, 0XFE70, 0XFE51, 0XFD91, 0XCB8D, 0X8A0A, 0X798B,
-  0X50E9, 0X38E6, 0X61C9, 0X720A, 0X6169, 0X5907, 0X60E6, 0X5001,
-  0X4000, 0X832D, 0XFFFF, 0XFEF7, 0XB469, 0XE6F3, 0XFFFF, 0XFF96,
-  0XCBA8, 0XB2A5, 0XB347, 0XB3A9, 0XABC9, 0XBC2B, 0XC48D, 0XAB8B,
-  0X8247, 0X8A68, 0X8A47, 0X9B29, 0XF716, 0XFFFD, 0XA4ED, 0X8A06,
-  0XA9C8, 0X99C9, 0X7946, 0X7945, 0XAACB, 0XFD96, 0XFE17, 0XFD0F,
-  0XFCCB, 0XEE4F, 0XFFF4, 0XFFFA, 0XFFF9, 0XFFFB, 0XFFFD, 0XFFFA,
-  0XE591, 0XBBEC, 0XDD52, 0XFED8, 0XED52, 0XA28A, 0X8966, 0X8987,
-  0X7946, 0X5885, 0X5844, 0X6045, 0X6846, 0X7865, 0X8864, 0XAA66,
-  0XE5CE, 0XF7B4, 0XEFD5, 0XF7B6, 0XFFB7, 0XEF74, 0XEFF5, 0XF7F7,
-  0XFFF9, 0XFFFC, 0XFFFC, 0XFFFC, 0XFDF5, 0XD38D, 0X99E8, 0X6083,
-  0X6042, 0X5864, 0X5003, 0X5823, 0X8987, 0XB26A, 0XAA4A, 0XB34C,
-  0XDDB2, 0XF758, 0XE6F7, 0XC591, 0XC5F0, 0XF7B9, 0XFFFC, 0XEF77,
-  0XFFFB, 0XFFFB, 0XF777, 0XD6D3, 0XBDB0, 0XCC6E, 0XBAEB, 0XA249,
-  0X60A2, 0X2800, 0X2000, 0X7B8A, 0XD634, 0XBCD0, 0XAB4B, 0XBB8D,
-  0XC38D, 0X91E7, 0X7061, 0X7862, 0X99A8, 0X79A6, 0X6984, 0XB4B0,
-  0XFFFF, 0XFFFF, 0XF777, 0XB40A, 0X7901, 0X9940, 0XEC0A, 0XC42A,
-  0X6200, 0X9240, 0XA280, 0XCD4B, 0XFFFE, 0XFFFF, 0XFFFF, 0XC612,
-  0XD756, 0XFFFF, 0XFFFF, 0XF7DB, 0XBD91, 0X7A82, 0X8941, 0X9A68,
-  0X9229, 0X60C5, 0X4063, 0X48E5, 0X48C5, 0X3001, 0X1800, 0X2800,
-  0X69A3, 0X7963, 0X5020, 0X6926, 0X71C7, 0X6124, 0X6104, 0X6103,
-  0X6945, 0X81E7, 0X7A67, 0X6A45, 0X7AE7, 0X93CD, 0X940E, 0XA46F,
-  0XACB1, 0XBD31, 0XBD2E, 0XB3EB, 0XAAC9, 0X8124, 0X5842, 0X6064,
-  0X6023, 0X4020, 0X2020, 0X5A02, 0XB4EE, 0XB44E, 0X8205, 0X6943,
-  0X7165, 0X6945, 0X50C3, 0X4082, 0X40C3, 0X4904, 0X48C3, 0X40C2,
-  0XBC4D, 0X92E7, 0XAC2C, 0XBCF4, 0XBCCE, 0X9A65, 0X91E3, 0X9245,
-  0X9286, 0X92A6, 0XAB08, 0XB36A, 0X9A87, 0X81A5, 0X9207, 0X91E6,
-  0X9206, 0XBBCD, 0XBC30, 0X9B09, 0XA248, 0XB228, 0XA1C8, 0XA207,
-  0XAA68, 0XC2EB, 0XF4B2, 0XF512, 0XF44D, 0XEC2A, 0XDD0C, 0XD60F,
-  0XD5F3, 0XDE14, 0XD5D5, 0XBD54, 0XB4F1, 0XA38C, 0X82AA, 0X8AEC,
-  0X8B4D, 0X7A6A, 0X71A9, 0X6107, 0X3844, 0X3822, 0X6945, 0XA42D,
-  0XDE55, 0XF759, 0XFF99, 0XFF57, 0XFF57, 0XFFF9, 0XFFFC, 0XFFFB,
-  0XFFF8, 0XFFB4, 0XFE30, 0XFD4D, 0XEC8C, 0XB30A, 0X6946, 0X4066,
-  0X4887, 0X40A6, 0X40A6, 0X3885, 0X40E6, 0X5107, 0X5906, 0X5863,
-  0X4000, 0X4081, 0XCE37, 0XFF9B, 0XAC0A, 0X9384, 0XD5EE, 0XE5EF,
-  0XC42A, 0XAB67, 0X9AC5, 0X6900, 0X5860, 0XB3C9, 0XFFD8, 0XFF17,
-  0XA309, 0X6903, 0X7124, 0X89E6, 0XCC6F, 0XF6B6, 0XA46D, 0X61A4,
-  0X6904, 0X7106, 0X7106, 0X7105, 0XA28A, 0XFE7B, 0XFEDB, 0XFCF0,
-  0XF388, 0XFCCC, 0XFF53, 0XFFF8, 0XFFD7, 0XFFF8, 0XFFFB, 0XFFFC,
-  0XE653, 0XBBCC, 0XDC50, 0XFDB5, 0XF4D1, 0XAAAA, 0X91E7, 0X99E8,
-  0X99A7, 0X78C5, 0X6044, 0X6025, 0X7086, 0X8086, 0X6801, 0X7142,
-  0XC56F, 0XFFF9, 0XFFF9, 0XFFF8, 0XFFF8, 0XFFF8, 0XFFF9, 0XFFFB,
-  0XFFFF, 0XFFFF, 0XFFFC, 0XFFFA, 0XFE97, 0XFD75, 0XE3F1, 0X920B,
-  0X68E7, 0X5803, 0X3800, 0X4800, 0X99E8, 0XBACB, 0X99A7, 0X99A6,
-  0XC40D, 0XE676, 0XFFFB, 0XFFFC, 0XFFFC, 0XFFFC, 0XE717, 0XE6F6,
-  0XFFFD, 0XFFFE, 0XFFFC, 0XEFF9, 0XD695, 0XAB8B, 0X80C3, 0X8904,
-  0X4000, 0X2000, 0X840B, 0XFFFF, 0XFFFF, 0XF7FF, 0XC654, 0XC551,
-  0XCD72, 0XA3EB, 0X82A6, 0X9329, 0X9B69, 0X9B89, 0XC50F, 0XFEF7,
-  0XFF7A, 0XFFDB, 0XFFDA, 0XE633, 0XCC4C, 0XE3EB, 0XDB49, 0X8942,
-  0X6800, 0X5800, 0X9080, 0XE58E, 0XFFFF, 0XFFFF, 0XFFFC, 0XEEB3,
-  0XFF95, 0XFFFD, 0XFFFE, 0XFFFD, 0XFFFE, 0XFFFB, 0XF795, 0XDDB0,
-  0XC3CC, 0X7944, 0X4802, 0X5825, 0X5803, 0X2800, 0X0000, 0X4A62,
-  0XBE32, 0XC531, 0X8247, 0X6944, 0X7966, 0X6926, 0X58E5, 0X5903,
-  0X71E8, 0X82AB, 0X8227, 0X8267, 0X938B, 0X9BCA, 0X9BA9, 0XA40B,
-  0XACCE, 0XBD71, 0XCDD2, 0XD612, 0XDD4F, 0XAAC8, 0X78A3, 0X8043,
-  0X8841, 0X9020, 0XB2E5, 0XEEB7, 0XF6DA, 0XF6DA, 0XE654, 0XBC8A,
-  0XA329, 0XA2EC, 0XA30C, 0X7A28, 0X5985, 0X5145, 0X4944, 0X5164,
-  0XCCF1, 0XA308, 0X92C5, 0XBC4B, 0XCC8C, 0XBB89, 0XB327, 0X9A64,
-  0X70E0, 0X70A0, 0XC3EA, 0XFF16, 0XFE13, 0XB2C8, 0X8123, 0X8124,
-  0X8985, 0XA2C9, 0XBBCD, 0X9B09, 0X79C6, 0X7965, 0X8145, 0X8186,
-  0X8165, 0X9A29, 0XE4F4, 0XE575, 0XEC0E, 0XE308, 0XE40A, 0XDDEF,
-  0XDE73, 0XCDF2, 0XC5B1, 0XC5B3, 0XBD54, 0XA42E, 0X828A, 0X8A8B,
-  0X8AAC, 0X71E9, 0X6127, 0X50A6, 0X5065, 0X5843, 0X60A2, 0X6A45,
-  0X8C2B, 0XB4CE, 0XCD50, 0XE5D1, 0XFE74, 0XFEF5, 0XF6D3, 0XEE70,
-  0XF6F0, 0XFF31, 0XFE90, 0XFDCF, 0XED0D, 0XB30A, 0X79A9, 0X698B,
-  0X594A, 0X3886, 0X2003, 0X3044, 0X6A0A, 0X8AED, 0X7A2A, 0X50A4,
-  0X4000, 0X3800, 0X5163, 0XACB0, 0XBCCF, 0X8AE4, 0X9B25, 0XB409,
-  0XC48B, 0XDE12, 0XEF37, 0XC52F, 0X8263, 0X9B26, 0XDD4F, 0XE52E,
-  0XB2C7, 0X7902, 0X68A2, 0X6082, 0X6041, 0X5041, 0X50A2, 0X8A48,
-  0X8A28, 0X6905, 0X70E5, 0X7926, 0X91E7, 0XD370, 0XAA8C, 0X91A7,
-  0XA143, 0XE288, 0XFD91, 0XFFB6, 0XFF55, 0XFF34, 0XFFF8, 0XFFFA,
-  0XDE73, 0XC3EB, 0XBB0B, 0XDB4E, 0XD2EC, 0XA208, 0X91A7, 0XAA28,
-  0XC249, 0X9947, 0X78A4, 0X78C6, 0XA1EB, 0XA9EB, 0X7863, 0X6902,
-  0X9C6B, 0XDF97, 0XFFFC, 0XFFFC, 0XFFFD, 0XFFFB, 0XFFF9, 0XFFF9,
-  0XFFFA, 0XFFF8, 0XFF73, 0XFE50, 0XFCEF, 0XFC0E, 0XCAAB, 0X9988,
-  0X8106, 0X7064, 0X6001, 0X7103, 0XDCF0, 0XFE96, 0XCC0E, 0XB248,
-  0XCB8D, 0XE593, 0XFFDB, 0XFFFE, 0XFFFC, 0XFFFB, 0XEFB9, 0XF7B8,
-  0XFFFB, 0XFFFB, 0XF7B8, 0XEFFA, 0XFFFD, 0XE675, 0XAB2A, 0XC2AA,
-  0X7AE7, 0X9D6F, 0XFFFD, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XEFFA, 0XCED4, 0XBDD1, 0XD6B5, 0XDF57, 0XDF97, 0XDF16, 0XCD70,
-  0XBC6D, 0XC4AF, 0XB42D, 0X8AE8, 0XA30A, 0XBB4B, 0X9A07, 0X70A2,
-  0X7863, 0X7000, 0X6000, 0XA349, 0XFFFF, 0XFFFF, 0XEE52, 0XF691,
-  0XFFF7, 0XFF93, 0XFEB0, 0XFF33, 0XFFF8, 0XFFFA, 0XFFFA, 0XFFF9,
-  0XFED3, 0XAB49, 0X7083, 0X7803, 0X8801, 0X9000, 0XBB45, 0XFFFB,
-  0XFFDF, 0XFFBE, 0XEF37, 0XBCEC, 0X9B29, 0XAACD, 0XB34E, 0X8289,
-  0X7AC9, 0X7AEB, 0X82E9, 0X8B28, 0X9348, 0X9308, 0X9B69, 0X9BC9,
-  0XA40A, 0XB46B, 0XC4ED, 0XE651, 0XE652, 0XB3C9, 0X8121, 0X6840,
-  0X6840, 0XB120, 0XF449, 0XF714, 0XF73A, 0XF719, 0XF6F9, 0XF6F4,
-  0XBCAA, 0X9267, 0X81C7, 0X7A08, 0X6A08, 0X61E7, 0X6226, 0X59E5,
-  0XA38C, 0XAB8B, 0X9265, 0X9284, 0XB388, 0XCC4B, 0XDD90, 0XF674,
-  0XC4AD, 0X8A43, 0XAB06, 0XE4EE, 0XECEE, 0XC328, 0X99A4, 0X8123,
-  0X78E3, 0X7082, 0X60A2, 0X6904, 0X81C7, 0X79A7, 0X68E4, 0X68E5,
-  0X7125, 0X8186, 0XB2AC, 0XA22A, 0X8966, 0X9923, 0XD268, 0XECCF,
-  0XDE52, 0XDE31, 0XE652, 0XDE95, 0XC5B3, 0X9C2D, 0X8289, 0X79C8,
-  0X81C9, 0X6948, 0X58C6, 0X4864, 0X58C5, 0X9208, 0XB34B, 0X9BCB,
-  0X9CEE, 0XBDD2, 0XBD2F, 0XB40B, 0XD48D, 0XFD71, 0XFD70, 0XFD8F,
-  0XFDCF, 0XF5CC, 0XE5AB, 0XFE91, 0XFED6, 0XB38A, 0X79C7, 0X8A8D,
-  0X930F, 0X5969, 0X2003, 0X2003, 0X724B, 0XBC32, 0XB3F1, 0X79E9,
-  0X50C3, 0X60E2, 0X8184, 0XCBCD, 0XDCD1, 0XBBCB, 0XA2E6, 0XAB05,
-  0XD4AB, 0XFFF9, 0XFFFF, 0XFF99, 0XD54F, 0XC48C, 0XC46B, 0XAB27,
-  0XA203, 0X8900, 0X8983, 0XAA68, 0X91C6, 0X3800, 0X2000, 0X9A8A,
-  0XC3CE, 0X89E8, 0X7906, 0X8987, 0X8A08, 0X91E9, 0X7906, 0X70E4,
-  0X9104, 0XC9C6, 0XF3CC, 0XFED4, 0XFF34, 0XF6D3, 0XFF76, 0XFFD8,
-  0XDE73, 0XD48C, 0XC2E9, 0XCA8C, 0XCA4B, 0XA0C5, 0X9001, 0XDBAD,
-  0XFFFE, 0XF617, 0X7001, 0X4800, 0X9946, 0XC28C, 0XB2CB, 0XC3ED,
-  0XEDB3, 0XFED6, 0XEF97, 0XFFF9, 0XFFFC, 0XFFFE, 0XFFFC, 0XFFFA,
-  0XFFF7, 0XFFD3, 0XE66E, 0XDD0A, 0XC327, 0XA162, 0X90C2, 0X9081,
-  0X9041, 0XB145, 0XBA48, 0X92C7, 0XD695, 0XFFFF, 0XFFFD, 0XE592,
-  0XD48F, 0XDD51, 0XF6D7, 0XFFBB, 0XFF9A, 0XFFFC, 0XFFFD, 0XF7B8,
-  0XF796, 0XD673, 0XAD6E, 0XEFB8, 0XFFFF, 0XF758, 0XBCEF, 0XCCEF,
-  0XE6B4, 0XFFFD, 0XFFFF, 0XFFB9, 0XF7B9, 0XFFFB, 0XF7D9, 0XFFFC,
-  0XFFFF, 0XFFFD, 0XDF56, 0XCF16, 0XE798, 0XFFFE, 0XFFFF, 0XF757,
-  0XAC6D, 0X82C8, 0X69C4, 0X6943, 0X70E4, 0X6043, 0X6062, 0X70C4,
-  0X8947, 0X80C4, 0X5820, 0X82A7, 0XFFFC, 0XFFFF, 0XFFB7, 0XFECE,
-  0XEDEC, 0XD50B, 0XDD6C, 0XEE2F, 0XF64F, 0XEE30, 0XE671, 0XFFD6,
-  0XFFB6, 0XBC4B, 0X8101, 0X5800, 0X6000, 0XB120, 0XFCCA, 0XFFF7,
-  0XFFDD, 0XFFBC, 0XF79C, 0XF775, 0XBD0A, 0X92A8, 0X8208, 0X8AAA,
-  0X8B4C, 0X8B8D, 0X942D, 0X9389, 0X9307, 0X9B69, 0XC44C, 0XBC6B,
-  0XA3E9, 0X9B66, 0XAC0A, 0XBD0D, 0XAC69, 0X8AE4, 0X48C0, 0X3060,
-  0X8307, 0XED71, 0XF5B0, 0XEDCE, 0XE62E, 0XF6B1, 0XF739, 0XF71A,
-  0XE690, 0X9BA8, 0X58E2, 0X4061, 0X50C3, 0X6185, 0X59C6, 0X4943,
-  0XAAEA, 0XBB8C, 0XBB4A, 0XBB07, 0XBB68, 0XDCCC, 0XFF57, 0XFF7D,
-  0XFF57, 0XDD4F, 0XCCAC, 0XCCAC, 0XBBA8, 0XB2C6, 0XA9C4, 0XA1C5,
-  0XAA07, 0X8944, 0X5021, 0X4042, 0X81C7, 0X9A6A, 0X7966, 0X68E5,
-  0X7126, 0X79A7, 0X8188, 0X70E5, 0X70C4, 0X8904, 0XC1A6, 0XE38B,
-  0XF653, 0XFF15, 0XF6F5, 0XFF98, 0XDE95, 0XA46D, 0X92E9, 0X81C8,
-  0X7988, 0X6927, 0X58C5, 0X60E6, 0X8A4A, 0XB40E, 0XCC0E, 0X9A47,
-  0XAC6E, 0XF77C, 0XFFBE, 0XCDD3, 0XB3A9, 0XCB8A, 0XEC6E, 0XFCF0,
-  0XFCEF, 0XE48A, 0XC407, 0XBC4B, 0XCD12, 0XBC0F, 0X92CA, 0X8AAB,
-  0X9B4E, 0X8B0D, 0X59A8, 0X48A6, 0X5927, 0X8A8B, 0X9B2E, 0X828C,
-  0X8229, 0XA2EA, 0XBB6A, 0XAAC8, 0X9A87, 0XB2C8, 0XC348, 0XC327,
-  0XBB47, 0XD50E, 0XFF16, 0XFF58, 0XF6B4, 0XEE52, 0XE632, 0XD5D0,
-  0XFE12, 0XFDB1, 0XFDF1, 0XFFD9, 0XFFFC, 0XB4B0, 0X6943, 0X9248,
-  0XDC0F, 0XBB2D, 0X89A7, 0X89A7, 0X91E9, 0X91A9, 0X7083, 0X7882,
-  0X9924, 0XA944, 0XC246, 0XE56F, 0XF714, 0XF6F3, 0XF735, 0XFFFB,
-  0XFFFD, 0XEE72, 0XB345, 0XB308, 0XD573, 0XDDD3, 0XD34B, 0XE3AC,
-  0XFFD9, 0XFFFA, 0XC32A, 0X8820, 0XA104, 0XCB4D, 0XDD32, 0XDD53,
-  0XE4D1, 0XED31, 0XEDF2, 0XDE52, 0XE715, 0XF7B8, 0XFFF8, 0XFFF8,
-  0XFFFA, 0XFFF7, 0XFFB3, 0XF68F, 0XB449, 0X8A45, 0X91E4, 0X9020,
-  0X9800, 0XDA87, 0XF4EE, 0XC52E, 0XEFFA, 0XFFFF, 0XFFFE, 0XFF17,
-  0XE5D4, 0XE5D4, 0XF6D7, 0XFF39, 0XFF39, 0XFFFC, 0XFFFF, 0XFFFA,
-  0XCE11, 0XA4ED, 0XC5B0, 0XFFBA, 0XF758, 0XCE13, 0XDED6, 0XF7B9,
-  0XFFFC, 0XFFFD, 0XFFFC, 0XFFD9, 0XF797, 0XDE72, 0XCDF0, 0XF755,
-  0XFFFA, 0XEF95, 0X9D0D, 0XAD70, 0XF7FC, 0XFFFF, 0XEFBA, 0XC632,
-  0XAD70, 0X8BAB, 0X72A7, 0X7A67, 0X7165, 0X6002, 0X6003, 0X8967,
-  0XB2EC, 0XC3AD, 0X79C4, 0XB4CE, 0XFFFF, 0XFFFF, 0XFFFA, 0XE56B,
-  0XCC89, 0XD4EB, 0XFE0F, 0XF62F, 0XDD6D, 0XB469, 0XBCAB, 0XC58E,
-  0XACA9, 0X82E3, 0X38C0, 0X2840, 0X8348, 0XF5D2, 0XFE11, 0XEE2F,
-  0XEE8F, 0XFEF2, 0XF79B, 0XF77C, 0XE732, 0XAC2A, 0X6123, 0X48A2,
-  0X6945, 0X8AA9, 0X8329, 0X6A25, 0X6A05, 0X82A7, 0X7A45, 0X8286,
-  0X9307, 0X9347, 0XE654, 0XF75A, 0XC52E, 0X5980, 0X30E0, 0X7C09,
-  0XEF9C, 0XFF9E, 0XFF57, 0XFF15, 0XFF97, 0XFF99, 0XF77C, 0XF75C,
-  0XF73A, 0XEEB2, 0X9B08, 0X6924, 0X60C3, 0X5882, 0X4061, 0X3061,
-  0X89E5, 0X81E5, 0XA287, 0XBB08, 0XCB07, 0XC347, 0XDCEE, 0XFED6,
-  0XFF58, 0XFED5, 0XEE72, 0XE611, 0XDD90, 0XFDD1, 0XFD2F, 0XF50E,
-  0XE5D3, 0XD573, 0X9B4B, 0X6103, 0X7986, 0X9A8B, 0X8A4A, 0X7167,
-  0X7167, 0X81A8, 0X8168, 0X7084, 0X78A2, 0X9124, 0XA144, 0XC226,
-  0XDD0E, 0XEE93, 0XEEB3, 0XFF36, 0XEF39, 0XCDF6, 0XAC4D, 0X7A05,
-  0X71A7, 0X6A49, 0X6A6A, 0X92AB, 0XBBCF, 0XD532, 0XDD92, 0XC3AC,
-  0XAB4A, 0XEED7, 0XFFBE, 0XFFDF, 0XEEF5, 0XCC0C, 0XCB6B, 0XD38B,
-  0XCB6C, 0XC32A, 0XC34A, 0XAB2A, 0X79E7, 0X69A7, 0X71E8, 0X71E8,
-  0X61C7, 0X6A49, 0X59E8, 0X6188, 0X50C5, 0X58A4, 0X60E5, 0X50C4,
-  0X58C3, 0X79E5, 0XC3AA, 0XBB49, 0X9A66, 0XA245, 0XC328, 0XDBEA,
-  0XDC4B, 0XCC8C, 0XCDD2, 0XE6D7, 0XEED6, 0XF6F4, 0XFFF9, 0XFFFF,
-  0XFFFC, 0XF672, 0XEDF0, 0XFFFA, 0XFFFF, 0XFFFF, 0XF635, 0X9246,
-  0X7081, 0X78E3, 0X89A6, 0XAA29, 0X8105, 0X4000, 0X6020, 0X70C0,
-  0X8942, 0X9A06, 0XA266, 0XBBA8, 0XD56D, 0XEE50, 0XF754, 0XFFF9,
-  0XFFFA, 0XEE94, 0XCD0C, 0XD54D, 0XF778, 0XFFFE, 0XF718, 0XD551,
-  0XD674, 0XF7D8, 0XE54F, 0XA9C3, 0XA1A4, 0XD46F, 0XF696, 0XF635,
-  0XDCAF, 0XDC6E, 0XE510, 0XCD4F, 0XCDB0, 0XD651, 0XDE91, 0XE6F2,
-  0XF795, 0XFF74, 0XE66E, 0XBCC9, 0X9388, 0XAD71, 0XEFF9, 0XCCCC,
-  0X9920, 0XCC09, 0XEEB2, 0XEF14, 0XFFFA, 0XFFFC, 0XFFB8, 0XEED5,
-  0XEE94, 0XEE53, 0XDDF3, 0XEED7, 0XFFBA, 0XFFFA, 0XFFFC, 0XF739,
-  0XCD92, 0XDDF3, 0XFFFC, 0XFFFD, 0XCD91, 0XBD50, 0XFFFC, 0XFFFE,
-  0XFFFD, 0XFFFE, 0XFFFF, 0XFFFE, 0XF7B8, 0XC5CF, 0XC54D, 0XEE51,
-  0XEEB3, 0XBD2D, 0X8C4B, 0XD695, 0XFFFF, 0XF7DA, 0XCE53, 0XFFFC,
-  0XFFFF, 0XF7FA, 0XB590, 0X9CAE, 0X93AC, 0X6965, 0X5041, 0X9A69,
-  0XDCD1, 0XDD32, 0X8AA9, 0X8AC9, 0XB46E, 0XC571, 0XBD0F, 0XA368,
-  0XA327, 0XA326, 0X8A84, 0X9B88, 0XB40A, 0XAC08, 0XF737, 0XFFFD,
-  0XC56E, 0X5160, 0X28C0, 0X744A, 0XEFFE, 0XFFFF, 0XFFB8, 0XFF76,
-  0XFFD7, 0XFFDA, 0XF79D, 0XF77D, 0XF77B, 0XF713, 0X9B49, 0X6945,
-  0X7104, 0X70C3, 0X60C3, 0X5103, 0XA3AB, 0XD571, 0XABCC, 0X71C5,
-  0X69A3, 0X9348, 0XEF3C, 0XF75D, 0XEE73, 0XC469, 0XF671, 0XFFBE,
-  0XFFBE, 0XFFBE, 0XFF56, 0XDD90, 0XE653, 0XFFB9, 0XF797, 0XF732,
-  0XEF12, 0XE62E, 0X9B07, 0X8185, 0X78E3, 0X68A2, 0X5061, 0X68E3,
-  0X8226, 0X8226, 0X9AE8, 0XB329, 0XD369, 0XDC0A, 0XCC6B, 0XD5B2,
-  0XE6B7, 0XEED6, 0XF6D4, 0XFFB8, 0XFF9D, 0XFF39, 0XF58F, 0XE4EE,
-  0XE613, 0XD5B6, 0XCD96, 0XBC2E, 0X71A5, 0X5862, 0X68C3, 0X7145,
-  0X89A7, 0X70E5, 0X4021, 0X5821, 0X70A0, 0X8122, 0X99E5, 0XA245,
-  0XB388, 0XCD0D, 0XDDCF, 0XE672, 0XDEB5, 0XCE14, 0XB48E, 0X8B29,
-  0X82C9, 0X7B4C, 0X6B0C, 0X8B6D, 0XB450, 0XBCB0, 0XB46E, 0XBC4D,
-  0XBBCB, 0XCCCF, 0XF717, 0XFFFA, 0XFFFA, 0XFF37, 0XD44E, 0XB2CA,
-  0X9A49, 0X9208, 0X9A29, 0X924A, 0X7186, 0X5906, 0X5947, 0X69C8,
-  0X5126, 0X61C8, 0XAC92, 0XBD13, 0X7A89, 0X58C3, 0X5822, 0X4800,
-  0X3000, 0X4800, 0X89C4, 0XCBCB, 0XDCB0, 0XF5D4, 0XFF9A, 0XFFFA,
-  0XFF14, 0XDDCF, 0XD633, 0XE71B, 0XDEDA, 0XD675, 0XF754, 0XFFF7,
-  0XFFF9, 0XE6F4, 0XDE31, 0XF6D5, 0XFFB9, 0XFFF9, 0XF777, 0XCCF0,
-  0X89C7, 0X70A2, 0XC34C, 0XF40F, 0X88A4, 0X2800, 0X7227, 0X8285,
-  0X7222, 0XBD30, 0XF7FD, 0XEF98, 0XE6D5, 0XF716, 0XFFB8, 0XFFB8,
-  0XF797, 0XF736, 0XEF16, 0XE692, 0XF797, 0XFFFF, 0XFFFF, 0XE778,
-  0XD716, 0XEFF9, 0XF736, 0XC46B, 0XBBEA, 0XEE53, 0XFF99, 0XFEF6,
-  0XDD50, 0XD4CF, 0XEDB2, 0XDE33, 0XDE74, 0XDEB5, 0XDEB2, 0XE713,
-  0XF7B6, 0XFF95, 0XE650, 0XBCCB, 0XB4CE, 0XE779, 0XFFFF, 0XFFFD,
-  0XFF98, 0XFFFB, 0XFFFD, 0XFF99, 0XF736, 0XF736, 0XEEF5, 0XEEF5,
-  0XFF98, 0XF756, 0XDEB4, 0XFFFB, 0XFFFE, 0XFFB9, 0XDE54, 0XCD93,
-  0XEDF4, 0XFF59, 0XFFFE, 0XFFDA, 0XEE75, 0XEEF6, 0XFFFA, 0XFFFA,
-  0XFF78, 0XFFFB, 0XFFFD, 0XFFFC, 0XFFFA, 0XFF36, 0XF5B0, 0XED50,
-  0XBC0C, 0X9328, 0XBCEF, 0XFFB9, 0XFFFA, 0XC5D0, 0XBD8F, 0XFFDA,
-  0XFFFF, 0XFFFA, 0XD653, 0XBE12, 0XCE34, 0X9C4E, 0X6A27, 0X7A68,
-  0XABCE, 0XA38D, 0X6A28, 0X61C7, 0X71A7, 0X7165, 0X89E6, 0X8206,
-  0XA30A, 0XBBEB, 0XAB2A, 0X9267, 0X8A24, 0XA3E9, 0XFFFF, 0XFFFF,
-  0XF6D4, 0XC4A9, 0XF6B2, 0XFFFF, 0XFFFF, 0XFFFF, 0XFF77, 0XDDB0,
-  0XEE73, 0XFFDA, 0XF7B8, 0XF753, 0XEF33, 0XDE4F, 0X9327, 0X7985,
-  0X7904, 0X70C3, 0X60A3, 0X8144, 0XBC70, 0XC4D3, 0XBC71, 0X9288,
-  0X4820, 0X6A23, 0XF75B, 0XF79E, 0XFFBE, 0XFF98, 0XE4ED, 0XE50D,
-  0XFFD7, 0XFFDC, 0XFF57, 0XD52F, 0XA3EA, 0X7285, 0X7221, 0XABE4,
-  0XAC24, 0X7A61, 0X5900, 0X6881, 0X6041, 0X5061, 0X4840, 0X68E2,
-  0X8A67, 0XB38C, 0XDD53, 0XE6F8, 0XEF38, 0XF693, 0XDD8F, 0XD613,
-  0XE6FA, 0XDEDA, 0XD654, 0XF6F3, 0XF755, 0XEEF5, 0XD590, 0XC4CE,
-  0XCCF0, 0XCD52, 0XC551, 0XBD10, 0X9B8C, 0X7186, 0X60A2, 0X9A48,
-  0XC30C, 0X78A4, 0X3000, 0X6A06, 0X7A45, 0X7222, 0XBD30, 0XF7FD,
-  0XEF78, 0XDE94, 0XE694, 0XE6B5, 0XD633, 0XBDB1, 0XA4CF, 0X942D,
-  0X8B8C, 0X836C, 0X7B0D, 0X7AED, 0X832C, 0X7B0B, 0X938C, 0XB46E,
-  0XBC4E, 0XB40C, 0XAC0B, 0X9BE9, 0XAC6B, 0XB4AD, 0X9AE9, 0X91E8,
-  0X8A09, 0X7968, 0X58A6, 0X58C7, 0X5947, 0X5927, 0X6987, 0X8A8A,
-  0X826B, 0X5967, 0X830D, 0XDE17, 0XBD31, 0X9B8B, 0X8AA8, 0X6923,
-  0X5820, 0X70C2, 0XAAE9, 0XE470, 0XFEB8, 0XFFFE, 0XFFFF, 0XFFFF,
-  0XFFFC, 0XE6D4, 0XE694, 0XFFFE, 0XFFFF, 0XFFFF, 0XF77A, 0XEF54,
-  0XF796, 0XF7D8, 0XEF98, 0XF737, 0XF6D5, 0XFEF6, 0XE695, 0XC550,
-  0X8A68, 0X7964, 0XECB0, 0XFDF5, 0XB228, 0X8B08, 0XFFFF, 0XFFFE,
-  0XF650, 0XFFB8, 0XFFFF, 0XFFFF, 0XFFFC, 0XFFFC, 0XFFFF, 0XFFFE,
-  0XFFFA, 0XFFF9, 0XFFFC, 0XEF98, 0XEF96, 0XFFFB, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XFFFB, 0XFFF8, 0XFFFB, 0XFFFC, 0XFFF9,
-  0XEE73, 0XEE12, 0XFF17, 0XFFFB, 0XFFFE, 0XFFFF, 0XFFFF, 0XFFFE,
-  0XFFFD, 0XFFF9, 0XF714, 0XE6D4, 0XF7B8, 0XFFFF, 0XFFFF, 0XFFFB,
-  0XF756, 0XFFD9, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFB, 0XFFFB,
-  0XFFFC, 0XF7D8, 0XEF15, 0XFFF9, 0XFFFC, 0XFFFB, 0XFF79, 0XEEB7,
-  0XFEF8, 0XFFFD, 0XFFFE, 0XFEF8, 0XE613, 0XF6D6, 0XFF99, 0XFF16,
-  0XE590, 0XEE54, 0XFF17, 0XF6B4, 0XDD2F, 0XCC0B, 0XDC0D, 0XC36B,
-  0X8A06, 0X932A, 0XCD93, 0XD5D4, 0XC572, 0XACCE, 0XBD0E, 0XEE33,
-  0XFEB4, 0XC52E, 0X942A, 0XCE53, 0XFFFC, 0XC5F4, 0X732B, 0X6268,
-  0X59E7, 0X4905, 0X38E4, 0X4905, 0X6126, 0X7167, 0X7187, 0X6965,
-  0X928A, 0XAB4D, 0XAB2D, 0X89C6, 0X4800, 0X7264, 0XFFFE, 0XFFFF,
-  0XFFFF, 0XFFB9, 0XE4ED, 0XE50D, 0XFFF8, 0XFFFD, 0XFF77, 0XD52F,
-  0XA3EA, 0X7285, 0X7221, 0XABE4, 0XAC24, 0X7261, 0X5100, 0X5861,
-  0X5000, 0X4000, 0X3800, 0X58C2, 0X81C7, 0X926B, 0X9AEB, 0X81A5,
-  0X50E2, 0X8224, 0XE6B7, 0XFFFF, 0XFFFF, 0XEE13, 0XB347, 0XC367,
-  0XF631, 0XFFD9, 0XFFD8, 0XFF36, 0XEE54, 0XC510, 0X8B28, 0X5100,
-  0X4880, 0X7266, 0X940D, 0X8AA7, 0X6903, 0X58A2, 0X50A2, 0X6144,
-  0X9ACB, 0XBCB1, 0XD658, 0XDEDB, 0XE73D, 0XF79A, 0XE693, 0XE694,
-  0XFFFE, 0XFFFF, 0XFFDF, 0XEF38, 0XE6B3, 0XE693, 0XDE74, 0XCDF3,
-  0XC551, 0XBCAF, 0XBCAF, 0XAC8F, 0X9BEC, 0X7227, 0X6103, 0XAB4B,
-  0XDCF2, 0XB249, 0X8287, 0XE73C, 0XF79D, 0XF62F, 0XFFB8, 0XFFFF,
-  0XFFFF, 0XFFBB, 0XF77A, 0XEF1B, 0XDE98, 0XDE74, 0XFF37, 0XFF39,
-  0XCD93, 0X93AD, 0X830C, 0X82ED, 0X726B, 0X6A09, 0X726A, 0X8B0C,
-  0X9B8D, 0XA3CC, 0XA3CC, 0XA3EC, 0X938A, 0X8B09, 0X71E6, 0X60E5,
-  0X6927, 0X60E7, 0X5886, 0X50A6, 0X48A6, 0X50A6, 0X6107, 0X79A9,
-  0X822B, 0X6949, 0X5107, 0XA3F0, 0XD574, 0XD614, 0XDE75, 0XDDF3,
-  0XD550, 0XDD51, 0XFEB8, 0XFEB9, 0XFE38, 0XFE77, 0XFF17, 0XFFDA,
-  0XFFFB, 0XEF56, 0XD651, 0XF7B6, 0XFFFE, 0XFFFF, 0XFFFD, 0XF7B5,
-  0XFFD5, 0XFFFB, 0XFFFE, 0XFFFE, 0XFFFA, 0XDE93, 0XDE54, 0XEE96,
-  0XE5D4, 0XCC90, 0XFDB4, 0XFEF9, 0XF635, 0XFED7, 0XFFFD, 0XFF9C,
-  0XE5D1, 0XE5AF, 0XFEB5, 0XFEF4, 0XFF11, 0XF7D3, 0XFFFB, 0XFFFF,
-  0XFFFF, 0XFFFD, 0XFFFC, 0XFFFD, 0XFFFA, 0XFFFA, 0XFFFD, 0XFFFD,
-  0XFFFA, 0XFFF6, 0XFF74, 0XFFB7, 0XFFFC, 0XFFFD, 0XFFFA, 0XFF96,
-  0XFF14, 0XF611, 0XD52E, 0XC50D, 0XD630, 0XFFFA, 0XFFFF, 0XFFFF,
-  0XFFFE, 0XFFF9, 0XFFF7, 0XFFFB, 0XFFFE, 0XFFFD, 0XFFFB, 0XFFFA,
-  0XFF77, 0XFFF8, 0XFFFD, 0XFFFD, 0XFFFE, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFE, 0XFFD9, 0XF756, 0XEEF5, 0XE673, 0XEED4, 0XFFF9, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFF, 0XF759, 0XEE94, 0XFF78, 0XFFFB, 0XFF35,
-  0XDD2E, 0XDD2F, 0XFF17, 0XFF16, 0XED0F, 0XCBEB, 0X9246, 0X7123,
-  0X8247, 0XD573, 0XE697, 0XBD53, 0X9C2E, 0XA44E, 0XBC8F, 0XCC8F,
-  0XBBAC, 0X8265, 0X7B68, 0XF7B9, 0XFFFF, 0XC5D4, 0X6B0A, 0X51C6,
-  0X5187, 0X38C4, 0X2022, 0X2842, 0X3002, 0X3001, 0X1800, 0X2000,
-  0X48C4, 0X6948, 0X79A8, 0X6862, 0X4000, 0X79C3, 0XE6D8, 0XFFFF,
-  0XFFFF, 0XEE33, 0XB347, 0XC367, 0XF651, 0XFFD9, 0XFFF8, 0XFF36,
-  0XEE74, 0XC510, 0X8B28, 0X5100, 0X4060, 0X6A46, 0X8BCC, 0X7A67,
-  0X58C2, 0X4021, 0X3821, 0X5965, 0X69A7, 0X58C5, 0X5084, 0X5864,
-  0X70A3, 0X7860, 0X8A05, 0XBCAE, 0XB4CE, 0X936A, 0X8AA8, 0X8184,
-  0X9204, 0XDCCD, 0XFE74, 0XFEB5, 0XEE33, 0XC4F0, 0X9309, 0X7163,
-  0XBC0D, 0XDEBA, 0XCE38, 0XCD11, 0XA32A, 0X8A89, 0X7A07, 0X7A89,
-  0XA430, 0XB430, 0XCCD2, 0XDDD4, 0XE6D7, 0XF779, 0XEEF5, 0XD631,
-  0XF795, 0XFFDE, 0XFFBE, 0XFF9B, 0XEEF3, 0XEEB3, 0XE675, 0XD5F6,
-  0XCD96, 0XC552, 0XA44D, 0XA44E, 0XAC6F, 0XAC0D, 0X9B2A, 0XE512,
-  0XFF3A, 0XF635, 0XE614, 0XF77A, 0XFF9C, 0XE5D2, 0XE5AF, 0XFEB5,
-  0XFEF4, 0XFEF1, 0XF793, 0XF759, 0XE6BA, 0XE659, 0XFF3A, 0XFFFD,
-  0XFF5B, 0XC512, 0X8B4C, 0X82CC, 0X7A8B, 0X724A, 0X7A49, 0X7A49,
-  0X7A48, 0X828B, 0X8AEC, 0X8B2C, 0X8B2B, 0X82A9, 0X71E7, 0X6145,
-  0X6926, 0X7187, 0X7188, 0X6949, 0X58E8, 0X4845, 0X3844, 0X4065,
-  0X50A7, 0X7127, 0X68E3, 0X6925, 0X8227, 0XAC6D, 0XF799, 0XFFFF,
-  0XFFFE, 0XFFFC, 0XFFFB, 0XDDF4, 0XA3CD, 0XA42D, 0XC572, 0XF6B5,
-  0XFF57, 0XFF36, 0XFF36, 0XFFF8, 0XFFF9, 0XFFD7, 0XE735, 0XEF53,
-  0XFFF6, 0XFFF7, 0XFFF7, 0XFFFB, 0XFFFC, 0XE716, 0XCE11, 0XDDB2,
-  0XFE76, 0XFDF5, 0XED52, 0XFEF8, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XD635, 0XA46C, 0XB3A9, 0XE3A9, 0XEC08, 0XC444, 0XC66B, 0XFFFA,
-  0XFFFF, 0XFFFB, 0XFFF8, 0XFFFA, 0XFFFB, 0XFFF5, 0XE710, 0XDEEF,
-  0XD62C, 0XCCA8, 0X9AA3, 0X9AE5, 0XEE10, 0XFFF9, 0XFFF6, 0XDDCE,
-  0XBC69, 0XB3A8, 0XBB29, 0XC2E8, 0XB2C5, 0XBC8A, 0XDF33, 0XE7F6,
-  0XFFF5, 0XFFF3, 0XFFB3, 0XFF14, 0XEE13, 0XEDD2, 0XEE73, 0XF673,
-  0XF5F1, 0XFE52, 0XFED4, 0XEE73, 0XDE71, 0XDED0, 0XEFD2, 0XFFF9,
-  0XFFFD, 0XFFFD, 0XFFFC, 0XFFBA, 0XFFB7, 0XF755, 0XE652, 0XDE52,
-  0XFFF8, 0XFFFF, 0XFFFF, 0XF758, 0XE653, 0XEE74, 0XFF78, 0XFFF9,
-  0XEDF1, 0XEE33, 0XFFFF, 0XFFFD, 0XFE13, 0XBBEB, 0X7184, 0X8247,
-  0XEE56, 0XFFDB, 0XCDF5, 0X9C8F, 0XB551, 0XB4AF, 0XB3ED, 0XB32B,
-  0X89A6, 0X58A1, 0X93CB, 0XFFFF, 0XFFFE, 0X946F, 0X5227, 0X3924,
-  0X30A3, 0X2821, 0X1800, 0X0800, 0X1800, 0X3062, 0X2062, 0X59E8,
-  0X59C8, 0X4065, 0X5065, 0X6044, 0X7862, 0X7820, 0X81C4, 0XBC8E,
-  0XB4AD, 0X9369, 0X8AA8, 0X8184, 0X9204, 0XDCCD, 0XFE94, 0XFED5,
-  0XEE33, 0XC4F0, 0X9309, 0X7163, 0XBC0C, 0XD69A, 0XC618, 0XBCD0,
-  0X932B, 0X82CA, 0X6A08, 0X82EB, 0X6A29, 0X40E4, 0X3023, 0X4045,
-  0X6085, 0X78E4, 0X8944, 0X81C5, 0X7246, 0XB4AF, 0XFF7C, 0XEDB6,
-  0X9249, 0XAAA9, 0XCBEC, 0XC3CC, 0X92C7, 0X50E0, 0X7A04, 0XBBEB,
-  0XC40B, 0XC40C, 0XCC4D, 0XBC0D, 0XA3AC, 0XA36C, 0X92EA, 0X7227,
-  0X83AC, 0X7288, 0X730A, 0X9C4E, 0XD5B2, 0XEE94, 0XF6B4, 0XF6F5,
-  0XFFB7, 0XFFD8, 0XFF76, 0XDEB3, 0XDE91, 0XEED3, 0XDE52, 0XDE12,
-  0XCD94, 0XBD33, 0XA48F, 0X93EC, 0XA3CD, 0XB46F, 0XB40E, 0XE532,
-  0XFF3A, 0XFFDE, 0XF75C, 0XF77C, 0XFFFF, 0XDE56, 0XA48C, 0XB3E9,
-  0XE3EA, 0XEC4A, 0XC4A7, 0XD6AD, 0XFF38, 0XE638, 0XE635, 0XFED6,
-  0XFF59, 0XEE36, 0XB48F, 0X8B0A, 0X7227, 0X69A6, 0X6966, 0X6145,
-  0X71C7, 0X7A49, 0X61E8, 0X6A48, 0X7248, 0X7208, 0X69A7, 0X5924,
-  0X6125, 0X5084, 0X3801, 0X4884, 0X6907, 0X6086, 0X5006, 0X4805,
-  0X6909, 0X71A7, 0X7960, 0X6060, 0X5000, 0X7942, 0XBC8E, 0XE738,
-  0XF7FB, 0XE758, 0XC613, 0XBDB2, 0XBD92, 0XBDB3, 0XDEB8, 0XF77C,
-  0XFF79, 0XEE73, 0XEE51, 0XFFB7, 0XFFF7, 0XFF12, 0XE62E, 0XE691,
-  0XFF94, 0XFFF6, 0XE7B3, 0XD6D1, 0XCEB0, 0XB5EE, 0XA50C, 0XA3CB,
-  0XC3AD, 0XAB0A, 0X8206, 0XAB0A, 0XFE16, 0XFFFF, 0XFFFD, 0XF739,
-  0XCDF4, 0X840B, 0X6A66, 0X89C6, 0XC289, 0XA1C3, 0X8281, 0X9D28,
-  0XBECD, 0XC6CC, 0XC6CA, 0XC6EB, 0XB68A, 0X7CA3, 0X4AC0, 0X7B22,
-  0XD44B, 0XDB8C, 0X9185, 0X70E3, 0XAA69, 0XCB6C, 0X9267, 0X58E1,
-  0X5102, 0X7186, 0X9A4B, 0XAA8B, 0XA9C6, 0XA9C4, 0XCB28, 0XDC08,
-  0XDB46, 0XCA62, 0XB243, 0X9A86, 0X89E7, 0X7945, 0X8206, 0X9A88,
-  0XB2EA, 0XBB2B, 0XB32B, 0XBB6C, 0XBBAC, 0XAB47, 0X9B44, 0XAD49,
-  0XEFD3, 0XFFFD, 0XFFFF, 0XFFFF, 0XFFFB, 0XF6D5, 0XF52F, 0XFD0F,
-  0XFD30, 0XF5F1, 0XDD2F, 0XCC8E, 0XB46D, 0XB42C, 0XE532, 0XED92,
-  0X9BAB, 0XDE54, 0XFFFF, 0XFF59, 0XC4EF, 0XA34A, 0XB3EE, 0XFFFF,
-  0XFFFF, 0XFFFE, 0XACF0, 0X8C2D, 0X848D, 0X7BAA, 0X9309, 0X9228,
-  0X6062, 0X6081, 0XABCC, 0XCDB3, 0X7B4B, 0X49C6, 0X3924, 0X30A3,
-  0X28A2, 0X2062, 0X1821, 0X28A3, 0X6A6A, 0X834D, 0X6AAB, 0X9C31,
-  0X72AB, 0X38C5, 0X3024, 0X4066, 0X6086, 0X78C4, 0X8944, 0X81C5,
-  0X7246, 0XB4AF, 0XFF7C, 0XEDB6, 0X9249, 0XAAA9, 0XCBEC, 0XC3CC,
-  0X92C7, 0X50E0, 0X7A04, 0XBBEB, 0XC3EB, 0XC3EC, 0XCC4D, 0XB40D,
-  0XA3CD, 0X9BAD, 0X8B2B, 0X6228, 0X38E3, 0X2862, 0X1843, 0X2044,
-  0X3845, 0X5044, 0X6925, 0X71E6, 0X7268, 0XD615, 0XFFFF, 0XE6B8,
-  0X934B, 0XA2CA, 0X9A28, 0X7102, 0X3000, 0X4020, 0XC4CE, 0XE716,
-  0XDDF3, 0XDD10, 0XB3AB, 0X71C4, 0X5963, 0X7A47, 0X7A27, 0X5123,
-  0XD698, 0XD677, 0XD634, 0XC593, 0XD617, 0XDE76, 0XDDB1, 0XDDD0,
-  0XF735, 0XF776, 0XF671, 0XD56D, 0XD5AF, 0XE651, 0XDE52, 0XBDAE,
-  0XAC8C, 0X944B, 0X83CA, 0X7B49, 0X82A9, 0X8A8A, 0X8248, 0X8268,
-  0XAB6C, 0XDD53, 0XEF1B, 0XF77B, 0XF739, 0XCE14, 0X8C4C, 0X72E7,
-  0X9A68, 0XCB0A, 0XB2A6, 0X9BA6, 0XB58C, 0XBD8C, 0XB54B, 0XC56B,
-  0XCDAD, 0XC52D, 0X9BEA, 0X82C9, 0X7A27, 0X79E8, 0X6946, 0X4883,
-  0X5905, 0XABCF, 0XCD14, 0X9B8D, 0X61E6, 0X5945, 0X69C6, 0X92AA,
-  0X9A8A, 0X4000, 0X2000, 0X5A26, 0X7248, 0X5062, 0X5802, 0X8067,
-  0X8108, 0X6185, 0X4A40, 0X5A80, 0X72A2, 0XCCAC, 0XBC4A, 0XB4AD,
-  0XCE34, 0XD675, 0XCE12, 0XF798, 0XFFFF, 0XFFFF, 0XFFFF, 0XFFFF,
-  0XFFFF, 0XFFFF, 0XFFFB, 0XFFF8, 0XFEF5, 0XFDD0, 0XFD2D, 0XFD4E,
-  0XF4CC, 0XC3C9, 0X9BA8, 0X93A9, 0X8349, 0X6B48, 0X6AC7, 0X6A08,
-  0X69C8, 0X7A08, 0X71E6, 0X6985, 0X7943, 0X7123, 0X5923, 0X6226,
-  0X7309, 0X62C8, 0X51E6, 0X4906, 0X69A9, 0X81AA, 0X794A, 0X58C5,
-  0X50E2, 0X8225, 0XAB67, 0X9B40, 0X7240, 0X5920, 0X5063, 0X6906,
-  0X89E8, 0X81C7, 0X60E5, 0X58C6, 0X7968, 0X8189, 0X60E6, 0X4004,
-  0X4005, 0X58A9, 0X692C, 0X692A, 0X5864, 0X6021, 0X9986, 0XD34C,
-  0XD30B, 0X9985, 0X80E3, 0X7105, 0X58A7, 0X5087, 0X60C7, 0X7129,
-  0X716A, 0X68E8, 0X68C8, 0X89CB, 0XA26D, 0X91C9, 0X8186, 0X9AE8,
-  0XBD8F, 0XE7F7, 0XDFF7, 0X9DEF, 0XA46D, 0XD40D, 0XDBAD, 0XD34C,
-  0XC2CB, 0XB269, 0XAA09, 0X9A4A, 0X79E9, 0X7168, 0X8A0C, 0X9A2C,
-  0X6128, 0X934F, 0XAC53, 0X7ACC, 0X7207, 0X6124, 0X71E6, 0XE6B8,
-  0XFFFF, 0XFFFD, 0XB571, 0XA530, 0XADD2, 0XA5B2, 0X83AB, 0X6985,
-  0X58C2, 0X6144, 0X6A06, 0X3061, 0X0800, 0X2021, 0X3082, 0X30A3,
-  0X30C3, 0X3925, 0X6249, 0X836E, 0X9C10, 0X834D, 0X6229, 0X4966,
-  0X2062, 0X2042, 0X1843, 0X2065, 0X4045, 0X5024, 0X6925, 0X71E6,
-  0X7268, 0XD615, 0XFFFF, 0XE6B8, 0X934C, 0XA2CA, 0X9A28, 0X7102,
-  0X3000, 0X4020, 0XC4CE, 0XE716, 0XDDF3, 0XD4F0, 0XB38B, 0X69C4,
-  0X5163, 0X6227, 0X5A07, 0X3103, 0X2061, 0X2062, 0X1863, 0X2083,
-  0X2084, 0X2844, 0X3065, 0X30C4, 0X20C3, 0X8C51, 0XFFFE, 0X8CD1,
-  0X4246, 0X4903, 0X4000, 0X4882, 0X9288, 0XD44C, 0XE4CD, 0XDC6C,
-  0XFE54, 0XFFFB, 0XFDD3, 0X8A25, 0X5902, 0X6964, 0X6964, 0X6983,
-  0XDDF2, 0XFFDC, 0XFFFF, 0XFFFF, 0XFFFE, 0XF73C, 0XEEDB, 0XEF18,
-  0XF736, 0XEE33, 0XED0E, 0XE46C, 0XE48C, 0XDC0B, 0XB348, 0X92E7,
-  0X8288, 0X7228, 0X6227, 0X59E6, 0X5966, 0X5946, 0X61A7, 0X69C7,
-  0X6145, 0X58E2, 0X60E2, 0X5944, 0X6206, 0X6AA8, 0X6287, 0X5A26,
-  0X61E8, 0X82AC, 0X92AC, 0X8A6B, 0X71E7, 0X71A5, 0X9267, 0XAB48,
-  0X9B04, 0X7A24, 0X6144, 0X5906, 0X7168, 0X81E9, 0X71A7, 0X58C5,
-  0X4863, 0X6147, 0X8AEC, 0X934C, 0X82C8, 0X7266, 0X82C7, 0XAC4D,
-  0X8AA8, 0X4820, 0X8B08, 0XFFFF, 0XFFFF, 0XC5D4, 0X4080, 0X78C4,
-  0X78C5, 0X38C1, 0X7D4E, 0XFFFF, 0XFFFF, 0XFFFF, 0XDE52, 0X9BA6,
-  0XD5F2, 0XFFDC, 0XD635, 0XCDB0, 0XF736, 0XFF9A, 0XEF58, 0XE758,
-  0XDF38, 0XCED6, 0XB5F2, 0XACEE, 0XBC2C, 0XCB4C, 0XD2EB, 0XCAAA,
-  0XB186, 0X90A4, 0X8126, 0X7189, 0X60E9, 0X40A6, 0X3085, 0X3066,
-  0X3086, 0X30C7, 0X40C8, 0X48C7, 0X4885, 0X2801, 0X2001, 0X1802,
-  0X2044, 0X30A5, 0X30C6, 0X2885, 0X3085, 0X30A5, 0X40A6, 0X4046,
-  0X4026, 0X590A, 0X718C, 0X714B, 0X58E7, 0X4866, 0X4046, 0X50A8,
-  0X6128, 0X50C6, 0X4044, 0X3024, 0X3025, 0X3866, 0X3066, 0X2846,
-  0X2805, 0X2826, 0X3047, 0X3827, 0X3006, 0X4005, 0X68E6, 0X8189,
-  0X7948, 0X68E7, 0X60C6, 0X4044, 0X3845, 0X48A7, 0X48C8, 0X40A8,
-  0X38A7, 0X3047, 0X3027, 0X40A9, 0X510A, 0X48CA, 0X48AA, 0X50EA,
-  0X8169, 0XC34F, 0X9ACC, 0X58C4, 0X6064, 0X7907, 0X7148, 0X68E9,
-  0X60EA, 0X58C9, 0X50CA, 0X48A9, 0X4027, 0X3807, 0X4889, 0X5088,
-  0X3804, 0X3824, 0X3024, 0X3865, 0X48A5, 0X3802, 0X2800, 0X3042,
-  0X4187, 0X5A69, 0X5A88, 0X6B09, 0X83CD, 0XA510, 0XAD70, 0X7B8A,
-  0X51C5, 0X59C5, 0X59E5, 0X2881, 0X1800, 0X2883, 0X30C3, 0X28A3,
-  0X2082, 0X28C3, 0X30E4, 0X3124, 0X2904, 0X28E3, 0X1882, 0X0800,
-  0X1001, 0X1883, 0X1883, 0X2063, 0X2064, 0X2824, 0X3065, 0X30C4,
-  0X20C3, 0X8C51, 0XFFFE, 0X8CD1, 0X4246, 0X4903, 0X4000, 0X4882,
-  0X9288, 0XD44C, 0XE4CD, 0XDC6C, 0XFE54, 0XFFFC, 0XFDD3, 0X8225,
-  0X48E2, 0X5964, 0X5144, 0X40E2, 0X30A1, 0X38A1, 0X61C7, 0X82AA,
-  0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD,
-  0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD, 0X9BCD,
-  0X9BCD, 0X9BCD, 0XC984, 0XEA05, 0XEA05, 0XE1C4, 0XE204, 0XE264 };
+extern const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] asm("newtEye_iris");
 
 #define SCREEN_WIDTH  128
 #define SCREEN_HEIGHT 128
 
 #ifdef SYMMETRICAL_EYELID
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X02, 0X02, 0X02, 0X03,
-  0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X02, 0X02, 0X02,
-  0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X02, 0X03,
-  0X03, 0X04, 0X04, 0X04, 0X05, 0X05, 0X05, 0X05, 0X05, 0X06, 0X06, 0X06,
-  0X06, 0X06, 0X06, 0X05, 0X05, 0X05, 0X05, 0X05, 0X04, 0X04, 0X04, 0X03,
-  0X03, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X02, 0X02, 0X03, 0X04, 0X04, 0X05, 0X05, 0X06, 0X06, 0X07, 0X07,
-  0X07, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
-  0X08, 0X08, 0X08, 0X07, 0X07, 0X07, 0X06, 0X06, 0X05, 0X05, 0X04, 0X04,
-  0X03, 0X02, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X03, 0X04, 0X04, 0X05, 0X06,
-  0X07, 0X07, 0X08, 0X08, 0X09, 0X09, 0X0A, 0X0A, 0X0A, 0X0A, 0X0B, 0X0B,
-  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0A, 0X0A,
-  0X0A, 0X0A, 0X09, 0X09, 0X08, 0X08, 0X07, 0X07, 0X06, 0X05, 0X04, 0X04,
-  0X03, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02,
-  0X03, 0X04, 0X05, 0X06, 0X07, 0X07, 0X08, 0X09, 0X09, 0X0A, 0X0B, 0X0B,
-  0X0C, 0X0C, 0X0C, 0X0D, 0X0D, 0X0D, 0X0D, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
-  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0D, 0X0D, 0X0D, 0X0D, 0X0C, 0X0C, 0X0C,
-  0X0B, 0X0B, 0X0A, 0X09, 0X09, 0X08, 0X07, 0X07, 0X06, 0X05, 0X04, 0X03,
-  0X02, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X05, 0X06, 0X07, 0X08, 0X09,
-  0X09, 0X0A, 0X0B, 0X0C, 0X0C, 0X0D, 0X0D, 0X0E, 0X0E, 0X0F, 0X0F, 0X0F,
-  0X10, 0X10, 0X10, 0X10, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11,
-  0X10, 0X10, 0X10, 0X10, 0X0F, 0X0F, 0X0F, 0X0E, 0X0E, 0X0D, 0X0D, 0X0C,
-  0X0C, 0X0B, 0X0A, 0X09, 0X09, 0X08, 0X07, 0X06, 0X05, 0X04, 0X02, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X05, 0X07, 0X08, 0X09, 0X0A, 0X0B, 0X0C, 0X0C, 0X0D, 0X0E, 0X0F,
-  0X0F, 0X10, 0X10, 0X11, 0X11, 0X12, 0X12, 0X12, 0X13, 0X13, 0X13, 0X13,
-  0X13, 0X13, 0X13, 0X14, 0X14, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
-  0X12, 0X12, 0X12, 0X11, 0X11, 0X10, 0X10, 0X0F, 0X0F, 0X0E, 0X0D, 0X0C,
-  0X0C, 0X0B, 0X0A, 0X09, 0X08, 0X07, 0X05, 0X04, 0X03, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X04, 0X06, 0X07, 0X08, 0X0A, 0X0B,
-  0X0C, 0X0D, 0X0E, 0X0E, 0X0F, 0X10, 0X11, 0X11, 0X12, 0X13, 0X13, 0X14,
-  0X14, 0X14, 0X15, 0X15, 0X15, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
-  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X15, 0X15, 0X15, 0X14, 0X14,
-  0X14, 0X13, 0X13, 0X12, 0X11, 0X11, 0X10, 0X0F, 0X0E, 0X0E, 0X0D, 0X0C,
-  0X0B, 0X0A, 0X08, 0X07, 0X06, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03,
-  0X04, 0X06, 0X07, 0X09, 0X0A, 0X0B, 0X0D, 0X0E, 0X0F, 0X10, 0X11, 0X11,
-  0X12, 0X13, 0X14, 0X14, 0X15, 0X15, 0X16, 0X16, 0X17, 0X17, 0X18, 0X18,
-  0X18, 0X18, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19, 0X19,
-  0X19, 0X19, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X16, 0X16, 0X15, 0X15,
-  0X14, 0X14, 0X13, 0X12, 0X11, 0X11, 0X10, 0X0F, 0X0E, 0X0D, 0X0B, 0X0A,
-  0X09, 0X07, 0X06, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X04, 0X06, 0X08, 0X09, 0X0B, 0X0C,
-  0X0D, 0X0E, 0X10, 0X11, 0X12, 0X13, 0X13, 0X14, 0X15, 0X16, 0X16, 0X17,
-  0X18, 0X18, 0X19, 0X19, 0X1A, 0X1A, 0X1A, 0X1B, 0X1B, 0X1B, 0X1B, 0X1C,
-  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1B, 0X1B, 0X1B,
-  0X1B, 0X1A, 0X1A, 0X1A, 0X19, 0X19, 0X18, 0X18, 0X17, 0X16, 0X16, 0X15,
-  0X14, 0X13, 0X13, 0X12, 0X11, 0X10, 0X0E, 0X0D, 0X0C, 0X0B, 0X09, 0X08,
-  0X06, 0X04, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X04, 0X06, 0X07, 0X09, 0X0B, 0X0C, 0X0E, 0X0F, 0X10, 0X11, 0X13, 0X14,
-  0X15, 0X16, 0X16, 0X17, 0X18, 0X19, 0X19, 0X1A, 0X1B, 0X1B, 0X1C, 0X1C,
-  0X1C, 0X1D, 0X1D, 0X1D, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1F, 0X1F,
-  0X1F, 0X1F, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1D, 0X1D, 0X1D, 0X1C,
-  0X1C, 0X1C, 0X1B, 0X1B, 0X1A, 0X19, 0X19, 0X18, 0X17, 0X16, 0X16, 0X15,
-  0X14, 0X13, 0X11, 0X10, 0X0F, 0X0E, 0X0C, 0X0B, 0X09, 0X07, 0X06, 0X04,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X05, 0X07, 0X09, 0X0B, 0X0C,
-  0X0E, 0X0F, 0X11, 0X12, 0X13, 0X14, 0X16, 0X17, 0X18, 0X19, 0X19, 0X1A,
-  0X1B, 0X1C, 0X1C, 0X1D, 0X1D, 0X1E, 0X1E, 0X1F, 0X1F, 0X20, 0X20, 0X20,
-  0X20, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
-  0X21, 0X21, 0X21, 0X20, 0X20, 0X20, 0X20, 0X1F, 0X1F, 0X1E, 0X1E, 0X1D,
-  0X1D, 0X1C, 0X1C, 0X1B, 0X1A, 0X19, 0X19, 0X18, 0X17, 0X16, 0X14, 0X13,
-  0X12, 0X11, 0X0F, 0X0E, 0X0C, 0X0B, 0X09, 0X07, 0X05, 0X03, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X04, 0X06, 0X08, 0X0A, 0X0C, 0X0E, 0X0F, 0X11, 0X13, 0X14, 0X15,
-  0X16, 0X17, 0X19, 0X1A, 0X1B, 0X1B, 0X1C, 0X1D, 0X1E, 0X1E, 0X1F, 0X20,
-  0X20, 0X21, 0X21, 0X22, 0X22, 0X22, 0X23, 0X23, 0X23, 0X24, 0X24, 0X24,
-  0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X24, 0X23,
-  0X23, 0X23, 0X22, 0X22, 0X22, 0X21, 0X21, 0X20, 0X20, 0X1F, 0X1E, 0X1E,
-  0X1D, 0X1C, 0X1B, 0X1B, 0X1A, 0X19, 0X17, 0X16, 0X15, 0X14, 0X13, 0X11,
-  0X0F, 0X0E, 0X0C, 0X0A, 0X08, 0X06, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X07, 0X09, 0X0C,
-  0X0E, 0X0F, 0X11, 0X13, 0X14, 0X16, 0X17, 0X18, 0X19, 0X1B, 0X1C, 0X1D,
-  0X1D, 0X1E, 0X1F, 0X20, 0X21, 0X21, 0X22, 0X23, 0X23, 0X24, 0X24, 0X24,
-  0X25, 0X25, 0X26, 0X26, 0X26, 0X26, 0X26, 0X27, 0X27, 0X27, 0X27, 0X27,
-  0X27, 0X27, 0X27, 0X27, 0X27, 0X26, 0X26, 0X26, 0X26, 0X26, 0X25, 0X25,
-  0X24, 0X24, 0X24, 0X23, 0X23, 0X22, 0X21, 0X21, 0X20, 0X1F, 0X1E, 0X1D,
-  0X1D, 0X1C, 0X1B, 0X19, 0X18, 0X17, 0X16, 0X14, 0X13, 0X11, 0X0F, 0X0E,
-  0X0C, 0X09, 0X07, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X06, 0X08, 0X0B, 0X0D, 0X0F, 0X11, 0X13, 0X14, 0X16,
-  0X17, 0X19, 0X1A, 0X1B, 0X1C, 0X1E, 0X1F, 0X20, 0X20, 0X21, 0X22, 0X23,
-  0X24, 0X24, 0X25, 0X25, 0X26, 0X26, 0X27, 0X27, 0X28, 0X28, 0X28, 0X29,
-  0X29, 0X29, 0X29, 0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2A, 0X2A, 0X2A, 0X29,
-  0X29, 0X29, 0X29, 0X29, 0X29, 0X28, 0X28, 0X28, 0X27, 0X27, 0X26, 0X26,
-  0X25, 0X25, 0X24, 0X24, 0X23, 0X22, 0X21, 0X20, 0X20, 0X1F, 0X1E, 0X1C,
-  0X1B, 0X1A, 0X19, 0X17, 0X16, 0X14, 0X13, 0X11, 0X0F, 0X0D, 0X0B, 0X08,
-  0X06, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X07, 0X09,
-  0X0C, 0X0E, 0X10, 0X12, 0X14, 0X16, 0X18, 0X19, 0X1B, 0X1C, 0X1D, 0X1E,
-  0X20, 0X21, 0X22, 0X23, 0X23, 0X24, 0X25, 0X26, 0X26, 0X27, 0X28, 0X28,
-  0X29, 0X29, 0X2A, 0X2A, 0X2A, 0X2B, 0X2B, 0X2B, 0X2C, 0X2C, 0X2C, 0X2C,
-  0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C,
-  0X2B, 0X2B, 0X2B, 0X2A, 0X2A, 0X2A, 0X29, 0X29, 0X28, 0X28, 0X27, 0X26,
-  0X26, 0X25, 0X24, 0X23, 0X23, 0X22, 0X21, 0X20, 0X1E, 0X1D, 0X1C, 0X1B,
-  0X19, 0X18, 0X16, 0X14, 0X12, 0X10, 0X0E, 0X0C, 0X09, 0X07, 0X04, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X05, 0X08, 0X0A, 0X0D, 0X0F, 0X12, 0X14, 0X16,
-  0X17, 0X19, 0X1B, 0X1C, 0X1E, 0X1F, 0X20, 0X21, 0X23, 0X24, 0X25, 0X26,
-  0X26, 0X27, 0X28, 0X29, 0X29, 0X2A, 0X2B, 0X2B, 0X2C, 0X2C, 0X2D, 0X2D,
-  0X2D, 0X2E, 0X2E, 0X2E, 0X2E, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F,
-  0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2F, 0X2E, 0X2E, 0X2E, 0X2E, 0X2D,
-  0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2B, 0X2A, 0X29, 0X29, 0X28, 0X27, 0X26,
-  0X26, 0X25, 0X24, 0X23, 0X21, 0X20, 0X1F, 0X1E, 0X1C, 0X1B, 0X19, 0X17,
-  0X16, 0X14, 0X12, 0X0F, 0X0D, 0X0A, 0X08, 0X05, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05,
-  0X08, 0X0B, 0X0E, 0X10, 0X13, 0X15, 0X17, 0X19, 0X1B, 0X1C, 0X1E, 0X1F,
-  0X21, 0X22, 0X23, 0X25, 0X26, 0X27, 0X28, 0X29, 0X29, 0X2A, 0X2B, 0X2C,
-  0X2C, 0X2D, 0X2D, 0X2E, 0X2E, 0X2F, 0X2F, 0X30, 0X30, 0X30, 0X31, 0X31,
-  0X31, 0X31, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32,
-  0X32, 0X32, 0X31, 0X31, 0X31, 0X31, 0X30, 0X30, 0X30, 0X2F, 0X2F, 0X2E,
-  0X2E, 0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X29, 0X28, 0X27, 0X26,
-  0X25, 0X23, 0X22, 0X21, 0X1F, 0X1E, 0X1C, 0X1B, 0X19, 0X17, 0X15, 0X13,
-  0X10, 0X0E, 0X0B, 0X08, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X05, 0X09, 0X0C, 0X0F, 0X12, 0X14,
-  0X16, 0X18, 0X1A, 0X1C, 0X1E, 0X20, 0X21, 0X23, 0X24, 0X25, 0X26, 0X28,
-  0X29, 0X2A, 0X2B, 0X2B, 0X2C, 0X2D, 0X2E, 0X2F, 0X2F, 0X30, 0X30, 0X31,
-  0X31, 0X32, 0X32, 0X33, 0X33, 0X33, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34,
-  0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X35, 0X34, 0X34, 0X34, 0X34,
-  0X34, 0X34, 0X33, 0X33, 0X33, 0X32, 0X32, 0X31, 0X31, 0X30, 0X30, 0X2F,
-  0X2F, 0X2E, 0X2D, 0X2C, 0X2B, 0X2B, 0X2A, 0X29, 0X28, 0X26, 0X25, 0X24,
-  0X23, 0X21, 0X20, 0X1E, 0X1C, 0X1A, 0X18, 0X16, 0X14, 0X12, 0X0F, 0X0C,
-  0X09, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X02, 0X06, 0X09, 0X0D, 0X10, 0X13, 0X15, 0X18, 0X1A, 0X1C, 0X1E, 0X20,
-  0X21, 0X23, 0X24, 0X26, 0X27, 0X28, 0X2A, 0X2B, 0X2C, 0X2D, 0X2E, 0X2E,
-  0X2F, 0X30, 0X31, 0X31, 0X32, 0X33, 0X33, 0X34, 0X34, 0X35, 0X35, 0X35,
-  0X36, 0X36, 0X36, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37,
-  0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X37, 0X36, 0X36, 0X36,
-  0X35, 0X35, 0X35, 0X34, 0X34, 0X33, 0X33, 0X32, 0X31, 0X31, 0X30, 0X2F,
-  0X2E, 0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X28, 0X27, 0X26, 0X24, 0X23, 0X21,
-  0X20, 0X1E, 0X1C, 0X1A, 0X18, 0X15, 0X13, 0X10, 0X0D, 0X09, 0X06, 0X02,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X06, 0X0A, 0X0D, 0X10,
-  0X13, 0X16, 0X19, 0X1B, 0X1D, 0X1F, 0X21, 0X23, 0X25, 0X26, 0X28, 0X29,
-  0X2A, 0X2C, 0X2D, 0X2E, 0X2F, 0X30, 0X31, 0X31, 0X32, 0X33, 0X34, 0X34,
-  0X35, 0X36, 0X36, 0X37, 0X37, 0X37, 0X38, 0X38, 0X39, 0X39, 0X39, 0X39,
-  0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A, 0X3A,
-  0X3A, 0X3A, 0X3A, 0X3A, 0X39, 0X39, 0X39, 0X39, 0X38, 0X38, 0X37, 0X37,
-  0X37, 0X36, 0X36, 0X35, 0X34, 0X34, 0X33, 0X32, 0X31, 0X31, 0X30, 0X2F,
-  0X2E, 0X2D, 0X2C, 0X2A, 0X29, 0X28, 0X26, 0X25, 0X23, 0X21, 0X1F, 0X1D,
-  0X1B, 0X19, 0X16, 0X13, 0X10, 0X0D, 0X0A, 0X06, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X05, 0X0A, 0X0E, 0X11, 0X14, 0X17, 0X1A, 0X1C, 0X1F,
-  0X21, 0X23, 0X25, 0X26, 0X28, 0X29, 0X2B, 0X2C, 0X2D, 0X2F, 0X30, 0X31,
-  0X32, 0X33, 0X34, 0X34, 0X35, 0X36, 0X37, 0X37, 0X38, 0X38, 0X39, 0X39,
-  0X3A, 0X3A, 0X3B, 0X3B, 0X3B, 0X3C, 0X3C, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3C,
-  0X3C, 0X3C, 0X3C, 0X3B, 0X3B, 0X3B, 0X3A, 0X3A, 0X39, 0X39, 0X38, 0X38,
-  0X37, 0X37, 0X36, 0X35, 0X34, 0X34, 0X33, 0X32, 0X31, 0X30, 0X2F, 0X2D,
-  0X2C, 0X2B, 0X29, 0X28, 0X26, 0X25, 0X23, 0X21, 0X1F, 0X1C, 0X1A, 0X17,
-  0X14, 0X11, 0X0E, 0X0A, 0X05, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0A,
-  0X0E, 0X12, 0X15, 0X18, 0X1B, 0X1D, 0X20, 0X22, 0X24, 0X26, 0X28, 0X2A,
-  0X2B, 0X2D, 0X2E, 0X2F, 0X31, 0X32, 0X33, 0X34, 0X35, 0X36, 0X37, 0X37,
-  0X38, 0X39, 0X3A, 0X3A, 0X3B, 0X3B, 0X3C, 0X3C, 0X3D, 0X3D, 0X3E, 0X3E,
-  0X3E, 0X3E, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X40, 0X40, 0X40, 0X40, 0X40,
-  0X40, 0X40, 0X40, 0X40, 0X40, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3E, 0X3E,
-  0X3E, 0X3E, 0X3D, 0X3D, 0X3C, 0X3C, 0X3B, 0X3B, 0X3A, 0X3A, 0X39, 0X38,
-  0X37, 0X37, 0X36, 0X35, 0X34, 0X33, 0X32, 0X31, 0X2F, 0X2E, 0X2D, 0X2B,
-  0X2A, 0X28, 0X26, 0X24, 0X22, 0X20, 0X1D, 0X1B, 0X18, 0X15, 0X12, 0X0E,
-  0X0A, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0E, 0X12, 0X16, 0X19, 0X1C,
-  0X1F, 0X21, 0X24, 0X26, 0X28, 0X2A, 0X2B, 0X2D, 0X2F, 0X30, 0X31, 0X33,
-  0X34, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A, 0X3A, 0X3B, 0X3C, 0X3C, 0X3D,
-  0X3E, 0X3E, 0X3F, 0X3F, 0X40, 0X40, 0X40, 0X41, 0X41, 0X41, 0X42, 0X42,
-  0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X43, 0X43, 0X42, 0X42, 0X42,
-  0X42, 0X42, 0X42, 0X42, 0X42, 0X42, 0X41, 0X41, 0X41, 0X40, 0X40, 0X40,
-  0X3F, 0X3F, 0X3E, 0X3E, 0X3D, 0X3C, 0X3C, 0X3B, 0X3A, 0X3A, 0X39, 0X38,
-  0X37, 0X36, 0X35, 0X34, 0X33, 0X31, 0X30, 0X2F, 0X2D, 0X2B, 0X2A, 0X28,
-  0X26, 0X24, 0X21, 0X1F, 0X1C, 0X19, 0X16, 0X12, 0X0E, 0X09, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X04, 0X09, 0X0E, 0X12, 0X16, 0X1A, 0X1D, 0X20, 0X22, 0X25, 0X27, 0X29,
-  0X2B, 0X2D, 0X2F, 0X30, 0X32, 0X33, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A,
-  0X3B, 0X3C, 0X3D, 0X3D, 0X3E, 0X3F, 0X3F, 0X40, 0X41, 0X41, 0X42, 0X42,
-  0X42, 0X43, 0X43, 0X43, 0X44, 0X44, 0X44, 0X44, 0X45, 0X45, 0X45, 0X45,
-  0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45, 0X45,
-  0X44, 0X44, 0X44, 0X44, 0X43, 0X43, 0X43, 0X42, 0X42, 0X42, 0X41, 0X41,
-  0X40, 0X3F, 0X3F, 0X3E, 0X3D, 0X3D, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37,
-  0X36, 0X35, 0X33, 0X32, 0X30, 0X2F, 0X2D, 0X2B, 0X29, 0X27, 0X25, 0X22,
-  0X20, 0X1D, 0X1A, 0X16, 0X12, 0X0E, 0X09, 0X04, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X08, 0X0D, 0X12, 0X16,
-  0X1A, 0X1D, 0X21, 0X23, 0X26, 0X28, 0X2B, 0X2D, 0X2F, 0X30, 0X32, 0X34,
-  0X35, 0X37, 0X38, 0X39, 0X3A, 0X3B, 0X3C, 0X3D, 0X3E, 0X3F, 0X40, 0X40,
-  0X41, 0X42, 0X42, 0X43, 0X43, 0X44, 0X44, 0X45, 0X45, 0X46, 0X46, 0X46,
-  0X47, 0X47, 0X47, 0X47, 0X47, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48,
-  0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X48, 0X47, 0X47, 0X47, 0X47, 0X47,
-  0X46, 0X46, 0X46, 0X45, 0X45, 0X44, 0X44, 0X43, 0X43, 0X42, 0X42, 0X41,
-  0X40, 0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X35,
-  0X34, 0X32, 0X30, 0X2F, 0X2D, 0X2B, 0X28, 0X26, 0X23, 0X21, 0X1D, 0X1A,
-  0X16, 0X12, 0X0D, 0X08, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X07, 0X0D, 0X12, 0X16, 0X1A, 0X1E, 0X21, 0X25, 0X27,
-  0X2A, 0X2C, 0X2E, 0X30, 0X32, 0X34, 0X36, 0X37, 0X38, 0X3A, 0X3B, 0X3C,
-  0X3D, 0X3E, 0X3F, 0X40, 0X41, 0X42, 0X43, 0X43, 0X44, 0X45, 0X45, 0X46,
-  0X46, 0X47, 0X47, 0X48, 0X48, 0X48, 0X49, 0X49, 0X49, 0X4A, 0X4A, 0X4A,
-  0X4A, 0X4A, 0X4A, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B, 0X4B,
-  0X4B, 0X4A, 0X4A, 0X4A, 0X4A, 0X4A, 0X4A, 0X49, 0X49, 0X49, 0X48, 0X48,
-  0X48, 0X47, 0X47, 0X46, 0X46, 0X45, 0X45, 0X44, 0X43, 0X43, 0X42, 0X41,
-  0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B, 0X3A, 0X38, 0X37, 0X36, 0X34, 0X32,
-  0X30, 0X2E, 0X2C, 0X2A, 0X27, 0X25, 0X21, 0X1E, 0X1A, 0X16, 0X12, 0X0D,
-  0X07, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0C,
-  0X11, 0X16, 0X1B, 0X1F, 0X22, 0X25, 0X28, 0X2B, 0X2E, 0X30, 0X32, 0X34,
-  0X36, 0X37, 0X39, 0X3A, 0X3C, 0X3D, 0X3E, 0X3F, 0X40, 0X41, 0X42, 0X43,
-  0X44, 0X45, 0X46, 0X46, 0X47, 0X48, 0X48, 0X49, 0X49, 0X4A, 0X4A, 0X4A,
-  0X4B, 0X4B, 0X4C, 0X4C, 0X4C, 0X4C, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D,
-  0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D,
-  0X4D, 0X4D, 0X4C, 0X4C, 0X4C, 0X4C, 0X4B, 0X4B, 0X4A, 0X4A, 0X4A, 0X49,
-  0X49, 0X48, 0X48, 0X47, 0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40,
-  0X3F, 0X3E, 0X3D, 0X3C, 0X3A, 0X39, 0X37, 0X36, 0X34, 0X32, 0X30, 0X2E,
-  0X2B, 0X28, 0X25, 0X22, 0X1F, 0X1B, 0X16, 0X11, 0X0C, 0X05, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0A, 0X10, 0X16, 0X1B, 0X1F, 0X23,
-  0X26, 0X29, 0X2C, 0X2F, 0X31, 0X33, 0X36, 0X37, 0X39, 0X3B, 0X3C, 0X3E,
-  0X3F, 0X40, 0X42, 0X43, 0X44, 0X45, 0X46, 0X46, 0X47, 0X48, 0X49, 0X49,
-  0X4A, 0X4A, 0X4B, 0X4C, 0X4C, 0X4D, 0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4F,
-  0X4F, 0X4F, 0X4F, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50,
-  0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X4F, 0X4F, 0X4F,
-  0X4F, 0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A, 0X4A,
-  0X49, 0X49, 0X48, 0X47, 0X46, 0X46, 0X45, 0X44, 0X43, 0X42, 0X40, 0X3F,
-  0X3E, 0X3C, 0X3B, 0X39, 0X37, 0X36, 0X33, 0X31, 0X2F, 0X2C, 0X29, 0X26,
-  0X23, 0X1F, 0X1B, 0X16, 0X10, 0X0A, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X08, 0X0F, 0X15, 0X1A, 0X1F, 0X23, 0X27, 0X2A, 0X2D, 0X30, 0X33,
-  0X35, 0X37, 0X39, 0X3B, 0X3D, 0X3E, 0X40, 0X41, 0X42, 0X44, 0X45, 0X46,
-  0X47, 0X48, 0X49, 0X49, 0X4A, 0X4B, 0X4C, 0X4C, 0X4D, 0X4D, 0X4E, 0X4F,
-  0X4F, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X51, 0X52, 0X52, 0X52, 0X52, 0X52,
-  0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53, 0X53,
-  0X53, 0X53, 0X53, 0X53, 0X52, 0X52, 0X52, 0X52, 0X52, 0X51, 0X51, 0X51,
-  0X50, 0X50, 0X4F, 0X4F, 0X4F, 0X4E, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A,
-  0X49, 0X49, 0X48, 0X47, 0X46, 0X45, 0X44, 0X42, 0X41, 0X40, 0X3E, 0X3D,
-  0X3B, 0X39, 0X37, 0X35, 0X33, 0X30, 0X2D, 0X2A, 0X27, 0X23, 0X1F, 0X1A,
-  0X15, 0X0F, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0D, 0X14, 0X1A,
-  0X1F, 0X24, 0X28, 0X2B, 0X2E, 0X31, 0X34, 0X36, 0X39, 0X3B, 0X3D, 0X3E,
-  0X40, 0X42, 0X43, 0X44, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4B, 0X4C, 0X4C,
-  0X4D, 0X4E, 0X4F, 0X4F, 0X50, 0X50, 0X51, 0X51, 0X52, 0X52, 0X53, 0X53,
-  0X53, 0X54, 0X54, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55, 0X56, 0X56, 0X56,
-  0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X55,
-  0X55, 0X55, 0X55, 0X55, 0X54, 0X54, 0X54, 0X53, 0X53, 0X53, 0X52, 0X52,
-  0X51, 0X51, 0X50, 0X50, 0X4F, 0X4F, 0X4E, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A,
-  0X49, 0X48, 0X47, 0X46, 0X44, 0X43, 0X42, 0X40, 0X3E, 0X3D, 0X3B, 0X39,
-  0X36, 0X34, 0X31, 0X2E, 0X2B, 0X28, 0X24, 0X1F, 0X1A, 0X14, 0X0D, 0X05,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X0B, 0X13, 0X19, 0X1F, 0X24, 0X28, 0X2C, 0X2F,
-  0X33, 0X35, 0X38, 0X3A, 0X3C, 0X3E, 0X40, 0X42, 0X44, 0X45, 0X46, 0X48,
-  0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F, 0X50, 0X50, 0X51, 0X52, 0X52,
-  0X53, 0X53, 0X54, 0X54, 0X55, 0X55, 0X56, 0X56, 0X56, 0X57, 0X57, 0X57,
-  0X57, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X59, 0X59, 0X59,
-  0X59, 0X59, 0X59, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X58, 0X57,
-  0X57, 0X57, 0X57, 0X56, 0X56, 0X56, 0X55, 0X55, 0X54, 0X54, 0X53, 0X53,
-  0X52, 0X52, 0X51, 0X50, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49,
-  0X48, 0X46, 0X45, 0X44, 0X42, 0X40, 0X3E, 0X3C, 0X3A, 0X38, 0X35, 0X33,
-  0X2F, 0X2C, 0X28, 0X24, 0X1F, 0X19, 0X13, 0X0B, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08,
-  0X10, 0X18, 0X1E, 0X23, 0X28, 0X2C, 0X30, 0X34, 0X37, 0X39, 0X3C, 0X3E,
-  0X40, 0X42, 0X44, 0X46, 0X47, 0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F,
-  0X50, 0X51, 0X52, 0X53, 0X53, 0X54, 0X55, 0X55, 0X56, 0X56, 0X57, 0X57,
-  0X58, 0X58, 0X58, 0X59, 0X59, 0X59, 0X5A, 0X5A, 0X5A, 0X5A, 0X5B, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X59, 0X59,
-  0X59, 0X58, 0X58, 0X58, 0X57, 0X57, 0X56, 0X56, 0X55, 0X55, 0X54, 0X53,
-  0X53, 0X52, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49, 0X47,
-  0X46, 0X44, 0X42, 0X40, 0X3E, 0X3C, 0X39, 0X37, 0X34, 0X30, 0X2C, 0X28,
-  0X23, 0X1E, 0X18, 0X10, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0D, 0X16, 0X1D, 0X23, 0X28,
-  0X2D, 0X31, 0X35, 0X38, 0X3B, 0X3D, 0X40, 0X42, 0X44, 0X46, 0X48, 0X49,
-  0X4B, 0X4C, 0X4D, 0X4E, 0X50, 0X51, 0X52, 0X52, 0X53, 0X54, 0X55, 0X56,
-  0X56, 0X57, 0X58, 0X58, 0X59, 0X59, 0X5A, 0X5A, 0X5B, 0X5B, 0X5B, 0X5C,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C, 0X5C, 0X5B, 0X5B, 0X5B,
-  0X5A, 0X5A, 0X59, 0X59, 0X58, 0X58, 0X57, 0X56, 0X56, 0X55, 0X54, 0X53,
-  0X52, 0X52, 0X51, 0X50, 0X4E, 0X4D, 0X4C, 0X4B, 0X49, 0X48, 0X46, 0X44,
-  0X42, 0X40, 0X3D, 0X3B, 0X38, 0X35, 0X31, 0X2D, 0X28, 0X23, 0X1D, 0X16,
-  0X0D, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X09, 0X13, 0X1B, 0X22, 0X28, 0X2D, 0X31, 0X35, 0X39, 0X3C,
-  0X3F, 0X41, 0X44, 0X46, 0X48, 0X49, 0X4B, 0X4D, 0X4E, 0X4F, 0X51, 0X52,
-  0X53, 0X54, 0X55, 0X56, 0X57, 0X57, 0X58, 0X59, 0X59, 0X5A, 0X5B, 0X5B,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5F, 0X5F, 0X5F, 0X5F, 0X60,
-  0X60, 0X60, 0X60, 0X60, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61,
-  0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X60,
-  0X60, 0X5F, 0X5F, 0X5F, 0X5F, 0X5E, 0X5E, 0X5E, 0X5D, 0X5D, 0X5C, 0X5C,
-  0X5B, 0X5B, 0X5A, 0X59, 0X59, 0X58, 0X57, 0X57, 0X56, 0X55, 0X54, 0X53,
-  0X52, 0X51, 0X4F, 0X4E, 0X4D, 0X4B, 0X49, 0X48, 0X46, 0X44, 0X41, 0X3F,
-  0X3C, 0X39, 0X35, 0X31, 0X2D, 0X28, 0X22, 0X1B, 0X13, 0X09, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0F, 0X19,
-  0X21, 0X27, 0X2D, 0X32, 0X36, 0X3A, 0X3D, 0X40, 0X43, 0X45, 0X47, 0X49,
-  0X4B, 0X4D, 0X4F, 0X50, 0X51, 0X53, 0X54, 0X55, 0X56, 0X57, 0X58, 0X59,
-  0X5A, 0X5B, 0X5B, 0X5C, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F, 0X5F, 0X60, 0X60,
-  0X60, 0X61, 0X61, 0X61, 0X62, 0X62, 0X62, 0X62, 0X63, 0X63, 0X63, 0X63,
-  0X63, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64,
-  0X64, 0X63, 0X63, 0X63, 0X63, 0X63, 0X63, 0X63, 0X62, 0X62, 0X62, 0X62,
-  0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X5F, 0X5F, 0X5E, 0X5E, 0X5D, 0X5C,
-  0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58, 0X57, 0X56, 0X55, 0X54, 0X53, 0X51,
-  0X50, 0X4F, 0X4D, 0X4B, 0X49, 0X47, 0X45, 0X43, 0X40, 0X3D, 0X3A, 0X36,
-  0X32, 0X2D, 0X27, 0X21, 0X19, 0X0F, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X15, 0X1F, 0X26, 0X2C, 0X32, 0X36,
-  0X3B, 0X3E, 0X41, 0X44, 0X47, 0X49, 0X4B, 0X4D, 0X4F, 0X51, 0X52, 0X54,
-  0X55, 0X56, 0X57, 0X59, 0X59, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F,
-  0X60, 0X60, 0X61, 0X61, 0X62, 0X62, 0X63, 0X63, 0X63, 0X64, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66,
-  0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66, 0X66,
-  0X66, 0X66, 0X66, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64, 0X64, 0X63,
-  0X63, 0X63, 0X62, 0X62, 0X61, 0X61, 0X60, 0X60, 0X5F, 0X5E, 0X5E, 0X5D,
-  0X5C, 0X5B, 0X5A, 0X59, 0X59, 0X57, 0X56, 0X55, 0X54, 0X52, 0X51, 0X4F,
-  0X4D, 0X4B, 0X49, 0X47, 0X44, 0X41, 0X3E, 0X3B, 0X36, 0X32, 0X2C, 0X26,
-  0X1F, 0X15, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X10, 0X1B, 0X24, 0X2C, 0X32, 0X37, 0X3B, 0X3F, 0X43, 0X46, 0X48,
-  0X4B, 0X4D, 0X4F, 0X51, 0X53, 0X54, 0X56, 0X57, 0X58, 0X5A, 0X5B, 0X5C,
-  0X5D, 0X5E, 0X5E, 0X5F, 0X60, 0X61, 0X61, 0X62, 0X63, 0X63, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X66, 0X66, 0X67, 0X67, 0X67, 0X67, 0X68, 0X68, 0X68,
-  0X68, 0X68, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69,
-  0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X68, 0X68,
-  0X68, 0X68, 0X68, 0X67, 0X67, 0X67, 0X67, 0X66, 0X66, 0X65, 0X65, 0X65,
-  0X64, 0X64, 0X63, 0X63, 0X62, 0X61, 0X61, 0X60, 0X5F, 0X5E, 0X5E, 0X5D,
-  0X5C, 0X5B, 0X5A, 0X58, 0X57, 0X56, 0X54, 0X53, 0X51, 0X4F, 0X4D, 0X4B,
-  0X48, 0X46, 0X43, 0X3F, 0X3B, 0X37, 0X32, 0X2C, 0X24, 0X1B, 0X10, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X08, 0X17, 0X21, 0X2A,
-  0X31, 0X37, 0X3C, 0X40, 0X44, 0X47, 0X4A, 0X4D, 0X4F, 0X51, 0X53, 0X55,
-  0X57, 0X58, 0X59, 0X5B, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X62,
-  0X63, 0X64, 0X65, 0X65, 0X66, 0X66, 0X67, 0X67, 0X68, 0X68, 0X68, 0X69,
-  0X69, 0X69, 0X6A, 0X6A, 0X6A, 0X6A, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C,
-  0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A,
-  0X6A, 0X6A, 0X69, 0X69, 0X69, 0X68, 0X68, 0X68, 0X67, 0X67, 0X66, 0X66,
-  0X65, 0X65, 0X64, 0X63, 0X62, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5C,
-  0X5B, 0X59, 0X58, 0X57, 0X55, 0X53, 0X51, 0X4F, 0X4D, 0X4A, 0X47, 0X44,
-  0X40, 0X3C, 0X37, 0X31, 0X2A, 0X21, 0X17, 0X08, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X10, 0X1D, 0X28, 0X30, 0X36, 0X3C, 0X41, 0X45,
-  0X48, 0X4B, 0X4E, 0X51, 0X53, 0X55, 0X57, 0X59, 0X5A, 0X5C, 0X5D, 0X5E,
-  0X5F, 0X60, 0X62, 0X63, 0X63, 0X64, 0X65, 0X66, 0X66, 0X67, 0X68, 0X68,
-  0X69, 0X69, 0X6A, 0X6A, 0X6B, 0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6D, 0X6D,
-  0X6D, 0X6D, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F,
-  0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6F, 0X6E,
-  0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X69, 0X68, 0X68, 0X67, 0X66,
-  0X66, 0X65, 0X64, 0X63, 0X63, 0X62, 0X60, 0X5F, 0X5E, 0X5D, 0X5C, 0X5A,
-  0X59, 0X57, 0X55, 0X53, 0X51, 0X4E, 0X4B, 0X48, 0X45, 0X41, 0X3C, 0X36,
-  0X30, 0X28, 0X1D, 0X10, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05,
-  0X17, 0X24, 0X2E, 0X36, 0X3C, 0X41, 0X46, 0X49, 0X4D, 0X50, 0X53, 0X55,
-  0X57, 0X59, 0X5B, 0X5C, 0X5E, 0X5F, 0X61, 0X62, 0X63, 0X64, 0X65, 0X66,
-  0X67, 0X67, 0X68, 0X69, 0X6A, 0X6A, 0X6B, 0X6B, 0X6C, 0X6C, 0X6D, 0X6D,
-  0X6E, 0X6E, 0X6E, 0X6F, 0X6F, 0X6F, 0X6F, 0X70, 0X70, 0X70, 0X70, 0X71,
-  0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X72, 0X72,
-  0X72, 0X72, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71, 0X71,
-  0X71, 0X70, 0X70, 0X70, 0X70, 0X6F, 0X6F, 0X6F, 0X6F, 0X6E, 0X6E, 0X6E,
-  0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X68, 0X67, 0X67,
-  0X66, 0X65, 0X64, 0X63, 0X62, 0X61, 0X5F, 0X5E, 0X5C, 0X5B, 0X59, 0X57,
-  0X55, 0X53, 0X50, 0X4D, 0X49, 0X46, 0X41, 0X3C, 0X36, 0X2E, 0X24, 0X17,
-  0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0D, 0X1E, 0X2B, 0X34, 0X3B,
-  0X41, 0X46, 0X4B, 0X4E, 0X51, 0X54, 0X57, 0X59, 0X5B, 0X5D, 0X5F, 0X60,
-  0X62, 0X63, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A, 0X6B, 0X6B, 0X6C,
-  0X6D, 0X6D, 0X6E, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X71, 0X71, 0X71, 0X72,
-  0X72, 0X72, 0X72, 0X73, 0X73, 0X73, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74,
-  0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74,
-  0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X73, 0X73,
-  0X73, 0X72, 0X72, 0X72, 0X72, 0X71, 0X71, 0X71, 0X70, 0X70, 0X6F, 0X6F,
-  0X6E, 0X6E, 0X6D, 0X6D, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X66,
-  0X65, 0X64, 0X63, 0X62, 0X60, 0X5F, 0X5D, 0X5B, 0X59, 0X57, 0X54, 0X51,
-  0X4E, 0X4B, 0X46, 0X41, 0X3B, 0X34, 0X2B, 0X1E, 0X0D, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X15, 0X26, 0X31, 0X3A, 0X41, 0X47, 0X4B, 0X4F, 0X53,
-  0X56, 0X59, 0X5B, 0X5D, 0X5F, 0X61, 0X63, 0X64, 0X65, 0X67, 0X68, 0X69,
-  0X6A, 0X6B, 0X6C, 0X6D, 0X6D, 0X6E, 0X6F, 0X6F, 0X70, 0X70, 0X71, 0X71,
-  0X72, 0X72, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X75, 0X75,
-  0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X77, 0X76, 0X76, 0X76, 0X76, 0X76, 0X76, 0X75, 0X75, 0X75, 0X75,
-  0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X72, 0X72, 0X71, 0X71, 0X70, 0X70,
-  0X6F, 0X6F, 0X6E, 0X6D, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X65,
-  0X64, 0X63, 0X61, 0X5F, 0X5D, 0X5B, 0X59, 0X56, 0X53, 0X4F, 0X4B, 0X47,
-  0X41, 0X3A, 0X31, 0X26, 0X15, 0X01, 0X00, 0X00, 0X00, 0X00, 0X05, 0X1D,
-  0X2D, 0X38, 0X40, 0X47, 0X4C, 0X51, 0X54, 0X58, 0X5B, 0X5D, 0X5F, 0X61,
-  0X63, 0X65, 0X67, 0X68, 0X69, 0X6A, 0X6B, 0X6C, 0X6D, 0X6E, 0X6F, 0X70,
-  0X71, 0X71, 0X72, 0X72, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X76, 0X76,
-  0X76, 0X77, 0X77, 0X77, 0X78, 0X78, 0X78, 0X78, 0X78, 0X79, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X79, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A,
-  0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X78, 0X78, 0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X76,
-  0X76, 0X76, 0X75, 0X75, 0X74, 0X74, 0X74, 0X73, 0X72, 0X72, 0X71, 0X71,
-  0X70, 0X6F, 0X6E, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X65, 0X63,
-  0X61, 0X5F, 0X5D, 0X5B, 0X58, 0X54, 0X51, 0X4C, 0X47, 0X40, 0X38, 0X2D,
-  0X1D, 0X05, 0X00, 0X00, 0X00, 0X00, 0X0F, 0X26, 0X34, 0X3E, 0X46, 0X4C,
-  0X51, 0X56, 0X59, 0X5C, 0X5F, 0X62, 0X64, 0X66, 0X67, 0X69, 0X6A, 0X6C,
-  0X6D, 0X6E, 0X6F, 0X70, 0X71, 0X72, 0X72, 0X73, 0X74, 0X75, 0X75, 0X76,
-  0X76, 0X77, 0X77, 0X78, 0X78, 0X78, 0X79, 0X79, 0X79, 0X7A, 0X7A, 0X7A,
-  0X7B, 0X7B, 0X7B, 0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D,
-  0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7C, 0X7B,
-  0X7B, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X78, 0X78,
-  0X78, 0X77, 0X77, 0X76, 0X76, 0X75, 0X75, 0X74, 0X73, 0X72, 0X72, 0X71,
-  0X70, 0X6F, 0X6E, 0X6D, 0X6C, 0X6A, 0X69, 0X67, 0X66, 0X64, 0X62, 0X5F,
-  0X5C, 0X59, 0X56, 0X51, 0X4C, 0X46, 0X3E, 0X34, 0X26, 0X0F, 0X00, 0X00,
-  0X00, 0X01, 0X19, 0X2E, 0X3B, 0X45, 0X4C, 0X52, 0X57, 0X5B, 0X5E, 0X61,
-  0X64, 0X66, 0X68, 0X6A, 0X6B, 0X6D, 0X6E, 0X6F, 0X71, 0X72, 0X73, 0X74,
-  0X74, 0X75, 0X76, 0X77, 0X77, 0X78, 0X78, 0X79, 0X79, 0X7A, 0X7A, 0X7B,
-  0X7B, 0X7B, 0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7E, 0X7E, 0X7E,
-  0X7E, 0X7E, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F,
-  0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7E, 0X7E, 0X7D,
-  0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X79,
-  0X79, 0X78, 0X78, 0X77, 0X77, 0X76, 0X75, 0X74, 0X74, 0X73, 0X72, 0X71,
-  0X6F, 0X6E, 0X6D, 0X6B, 0X6A, 0X68, 0X66, 0X64, 0X61, 0X5E, 0X5B, 0X57,
-  0X52, 0X4C, 0X45, 0X3B, 0X2E, 0X19, 0X01, 0X00, 0X00, 0X02, 0X22, 0X36,
-  0X43, 0X4C, 0X52, 0X58, 0X5C, 0X60, 0X63, 0X66, 0X68, 0X6A, 0X6C, 0X6E,
-  0X6F, 0X71, 0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X79, 0X7A,
-  0X7B, 0X7B, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7E, 0X7E, 0X7E, 0X7F, 0X7F,
-  0X7F, 0X80, 0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X82,
-  0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X80, 0X80, 0X80, 0X80, 0X7F,
-  0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7B, 0X7B,
-  0X7A, 0X79, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X73, 0X72, 0X71, 0X6F,
-  0X6E, 0X6C, 0X6A, 0X68, 0X66, 0X63, 0X60, 0X5C, 0X58, 0X52, 0X4C, 0X43,
-  0X36, 0X22, 0X02, 0X00, 0X00, 0X09, 0X2C, 0X3E, 0X4A, 0X52, 0X59, 0X5E,
-  0X62, 0X65, 0X68, 0X6A, 0X6D, 0X6F, 0X71, 0X72, 0X74, 0X75, 0X76, 0X77,
-  0X78, 0X79, 0X7A, 0X7B, 0X7B, 0X7C, 0X7D, 0X7D, 0X7E, 0X7E, 0X7F, 0X7F,
-  0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X83,
-  0X83, 0X83, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84,
-  0X84, 0X84, 0X83, 0X83, 0X83, 0X83, 0X83, 0X82, 0X82, 0X82, 0X81, 0X81,
-  0X81, 0X80, 0X80, 0X80, 0X7F, 0X7F, 0X7E, 0X7E, 0X7D, 0X7D, 0X7C, 0X7B,
-  0X7B, 0X7A, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X72, 0X71, 0X6F, 0X6D,
-  0X6A, 0X68, 0X65, 0X62, 0X5E, 0X59, 0X52, 0X4A, 0X3E, 0X2C, 0X09, 0X00,
-  0X00, 0X16, 0X35, 0X46, 0X51, 0X59, 0X5F, 0X63, 0X67, 0X6A, 0X6D, 0X6F,
-  0X71, 0X73, 0X75, 0X76, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7D, 0X7D, 0X7E,
-  0X7F, 0X7F, 0X80, 0X81, 0X81, 0X82, 0X82, 0X82, 0X83, 0X83, 0X84, 0X84,
-  0X84, 0X85, 0X85, 0X85, 0X85, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X87,
-  0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86,
-  0X86, 0X86, 0X86, 0X85, 0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X83, 0X83,
-  0X82, 0X82, 0X82, 0X81, 0X81, 0X80, 0X7F, 0X7F, 0X7E, 0X7D, 0X7D, 0X7C,
-  0X7B, 0X7A, 0X79, 0X78, 0X76, 0X75, 0X73, 0X71, 0X6F, 0X6D, 0X6A, 0X67,
-  0X63, 0X5F, 0X59, 0X51, 0X46, 0X35, 0X16, 0X00, 0X00, 0X22, 0X3F, 0X4E,
-  0X58, 0X5F, 0X65, 0X69, 0X6D, 0X6F, 0X72, 0X74, 0X76, 0X78, 0X79, 0X7A,
-  0X7C, 0X7D, 0X7E, 0X7F, 0X80, 0X80, 0X81, 0X82, 0X82, 0X83, 0X83, 0X84,
-  0X84, 0X85, 0X85, 0X86, 0X86, 0X86, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86, 0X85, 0X85, 0X84,
-  0X84, 0X83, 0X83, 0X82, 0X82, 0X81, 0X80, 0X80, 0X7F, 0X7E, 0X7D, 0X7C,
-  0X7A, 0X79, 0X78, 0X76, 0X74, 0X72, 0X6F, 0X6D, 0X69, 0X65, 0X5F, 0X58,
-  0X4E, 0X3F, 0X22, 0X00, 0X01, 0X2E, 0X49, 0X57, 0X60, 0X66, 0X6B, 0X6F,
-  0X72, 0X74, 0X77, 0X79, 0X7A, 0X7C, 0X7D, 0X7F, 0X80, 0X81, 0X82, 0X83,
-  0X83, 0X84, 0X85, 0X85, 0X86, 0X86, 0X87, 0X87, 0X88, 0X88, 0X88, 0X89,
-  0X89, 0X8A, 0X8A, 0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X88, 0X88, 0X88, 0X87, 0X87, 0X86, 0X86,
-  0X85, 0X85, 0X84, 0X83, 0X83, 0X82, 0X81, 0X80, 0X7F, 0X7D, 0X7C, 0X7A,
-  0X79, 0X77, 0X74, 0X72, 0X6F, 0X6B, 0X66, 0X60, 0X57, 0X49, 0X2E, 0X01,
-  0X02, 0X3A, 0X52, 0X5F, 0X67, 0X6C, 0X71, 0X74, 0X77, 0X7A, 0X7C, 0X7D,
-  0X7F, 0X80, 0X82, 0X83, 0X84, 0X85, 0X86, 0X86, 0X87, 0X88, 0X88, 0X89,
-  0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F,
-  0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F,
-  0X8F, 0X8F, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8D, 0X8D, 0X8D, 0X8D, 0X8C,
-  0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X89, 0X88, 0X88, 0X87,
-  0X86, 0X86, 0X85, 0X84, 0X83, 0X82, 0X80, 0X7F, 0X7D, 0X7C, 0X7A, 0X77,
-  0X74, 0X71, 0X6C, 0X67, 0X5F, 0X52, 0X3A, 0X02, 0X05, 0X47, 0X5C, 0X67,
-  0X6E, 0X73, 0X77, 0X7A, 0X7D, 0X7F, 0X81, 0X82, 0X84, 0X85, 0X86, 0X87,
-  0X88, 0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8D, 0X8D, 0X8E, 0X8E,
-  0X8E, 0X8F, 0X8F, 0X8F, 0X90, 0X90, 0X90, 0X90, 0X90, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X90, 0X90, 0X90, 0X90, 0X90, 0X8F, 0X8F, 0X8F, 0X8E,
-  0X8E, 0X8E, 0X8D, 0X8D, 0X8C, 0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X88,
-  0X87, 0X86, 0X85, 0X84, 0X82, 0X81, 0X7F, 0X7D, 0X7A, 0X77, 0X73, 0X6E,
-  0X67, 0X5C, 0X47, 0X05, 0X16, 0X53, 0X65, 0X6F, 0X75, 0X7A, 0X7D, 0X80,
-  0X82, 0X84, 0X86, 0X87, 0X88, 0X89, 0X8A, 0X8B, 0X8C, 0X8D, 0X8D, 0X8E,
-  0X8E, 0X8F, 0X8F, 0X90, 0X90, 0X91, 0X91, 0X91, 0X92, 0X92, 0X92, 0X92,
-  0X93, 0X93, 0X93, 0X93, 0X93, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94,
-  0X94, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95,
-  0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93,
-  0X93, 0X93, 0X93, 0X93, 0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X90,
-  0X90, 0X8F, 0X8F, 0X8E, 0X8E, 0X8D, 0X8D, 0X8C, 0X8B, 0X8A, 0X89, 0X88,
-  0X87, 0X86, 0X84, 0X82, 0X80, 0X7D, 0X7A, 0X75, 0X6F, 0X65, 0X53, 0X17,
-  0X2B, 0X5F, 0X6F, 0X77, 0X7C, 0X80, 0X83, 0X85, 0X87, 0X89, 0X8A, 0X8C,
-  0X8D, 0X8E, 0X8F, 0X8F, 0X90, 0X91, 0X91, 0X92, 0X92, 0X93, 0X93, 0X93,
-  0X94, 0X94, 0X94, 0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X97, 0X97,
-  0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X96, 0X95, 0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X93, 0X93, 0X93, 0X92,
-  0X92, 0X91, 0X91, 0X90, 0X8F, 0X8F, 0X8E, 0X8D, 0X8C, 0X8A, 0X89, 0X87,
-  0X85, 0X83, 0X80, 0X7C, 0X77, 0X6F, 0X5F, 0X2B, 0X40, 0X6B, 0X78, 0X7F,
-  0X83, 0X86, 0X89, 0X8B, 0X8D, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X93, 0X94,
-  0X94, 0X95, 0X95, 0X96, 0X96, 0X96, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98,
-  0X98, 0X98, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99, 0X98, 0X98,
-  0X98, 0X98, 0X97, 0X97, 0X97, 0X97, 0X96, 0X96, 0X96, 0X95, 0X95, 0X94,
-  0X94, 0X93, 0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8B, 0X89, 0X86, 0X83,
-  0X7F, 0X78, 0X6B, 0X40, 0X55, 0X77, 0X81, 0X86, 0X8A, 0X8D, 0X8F, 0X91,
-  0X92, 0X93, 0X94, 0X95, 0X96, 0X97, 0X97, 0X98, 0X98, 0X99, 0X99, 0X99,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9B, 0X9B, 0X9B, 0X9B,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X98, 0X98, 0X97, 0X97, 0X96,
-  0X95, 0X94, 0X93, 0X92, 0X91, 0X8F, 0X8D, 0X8A, 0X86, 0X81, 0X77, 0X55,
-  0X69, 0X82, 0X8A, 0X8E, 0X91, 0X93, 0X95, 0X96, 0X97, 0X98, 0X99, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E,
-  0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA1, 0XA1, 0XA1,
-  0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9C, 0X9C, 0X9B, 0X9B, 0X9A, 0X9A, 0X99, 0X98, 0X97,
-  0X96, 0X95, 0X93, 0X91, 0X8E, 0X8A, 0X82, 0X69, 0X7D, 0X8E, 0X93, 0X96,
-  0X98, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0XA0, 0XA0,
-  0XA0, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA0,
-  0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9D, 0X9C, 0X9B, 0X9A, 0X98,
-  0X96, 0X93, 0X8E, 0X7D, 0X90, 0X99, 0X9C, 0X9E, 0XA0, 0XA0, 0XA1, 0XA2,
-  0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6, 0XA6,
-  0XA6, 0XA6, 0XA6, 0XA6, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA4, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA1, 0XA0, 0XA0, 0X9E, 0X9C, 0X99, 0X90,
-  0XA1, 0XA4, 0XA5, 0XA6, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA8, 0XA7,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA6, 0XA5, 0XA4, 0XA1, 0XB1, 0XAF, 0XAF, 0XAE,
-  0XAE, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAE,
-  0XAE, 0XAF, 0XAF, 0XB1, 0XC0, 0XBA, 0XB8, 0XB6, 0XB5, 0XB4, 0XB4, 0XB3,
-  0XB3, 0XB2, 0XB2, 0XB2, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB2, 0XB2, 0XB2, 0XB3, 0XB3, 0XB4, 0XB4, 0XB5, 0XB6, 0XB8, 0XBA, 0XC0,
-  0XCD, 0XC5, 0XC0, 0XBE, 0XBC, 0XBB, 0XB9, 0XB9, 0XB8, 0XB7, 0XB7, 0XB6,
-  0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB3,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2, 0XB2,
-  0XB2, 0XB2, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB7, 0XB7, 0XB8,
-  0XB9, 0XB9, 0XBB, 0XBC, 0XBE, 0XC0, 0XC5, 0XCD, 0XDB, 0XCF, 0XC9, 0XC6,
-  0XC3, 0XC1, 0XBF, 0XBE, 0XBD, 0XBC, 0XBC, 0XBB, 0XBB, 0XBA, 0XBA, 0XB9,
-  0XB9, 0XB8, 0XB8, 0XB8, 0XB8, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB9,
-  0XB9, 0XBA, 0XBA, 0XBB, 0XBB, 0XBC, 0XBC, 0XBD, 0XBE, 0XBF, 0XC1, 0XC3,
-  0XC6, 0XC9, 0XCF, 0XDB, 0XE8, 0XDA, 0XD2, 0XCE, 0XCA, 0XC8, 0XC6, 0XC4,
-  0XC3, 0XC2, 0XC0, 0XC0, 0XBF, 0XBE, 0XBE, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBA, 0XBA, 0XBA, 0XBA, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XB9, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8, 0XB8,
-  0XB8, 0XB8, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE, 0XBE, 0XBF,
-  0XC0, 0XC0, 0XC2, 0XC3, 0XC4, 0XC6, 0XC8, 0XCA, 0XCE, 0XD2, 0XDA, 0XE8,
-  0XF6, 0XE4, 0XDB, 0XD5, 0XD1, 0XCE, 0XCC, 0XCA, 0XC8, 0XC7, 0XC5, 0XC4,
-  0XC4, 0XC3, 0XC2, 0XC1, 0XC1, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE,
-  0XBE, 0XBD, 0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBB,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF,
-  0XBF, 0XC0, 0XC0, 0XC1, 0XC1, 0XC2, 0XC3, 0XC4, 0XC4, 0XC5, 0XC7, 0XC8,
-  0XCA, 0XCC, 0XCE, 0XD1, 0XD5, 0XDB, 0XE4, 0XF6, 0XFF, 0XEE, 0XE4, 0XDD,
-  0XD8, 0XD4, 0XD2, 0XCF, 0XCD, 0XCC, 0XCA, 0XC9, 0XC8, 0XC7, 0XC6, 0XC6,
-  0XC5, 0XC4, 0XC4, 0XC3, 0XC3, 0XC2, 0XC2, 0XC1, 0XC1, 0XC1, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3, 0XC4, 0XC4, 0XC5,
-  0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XCC, 0XCD, 0XCF, 0XD2, 0XD4, 0XD8,
-  0XDD, 0XE4, 0XEE, 0XFF, 0XFF, 0XF9, 0XEC, 0XE5, 0XDF, 0XDB, 0XD8, 0XD5,
-  0XD3, 0XD1, 0XCF, 0XCE, 0XCD, 0XCC, 0XCB, 0XCA, 0XC9, 0XC8, 0XC8, 0XC7,
-  0XC7, 0XC6, 0XC5, 0XC5, 0XC5, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1, 0XC1,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC5,
-  0XC5, 0XC5, 0XC6, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCD,
-  0XCE, 0XCF, 0XD1, 0XD3, 0XD5, 0XD8, 0XDB, 0XDF, 0XE5, 0XEC, 0XF9, 0XFF,
-  0XFF, 0XFF, 0XF5, 0XEC, 0XE6, 0XE1, 0XDE, 0XDB, 0XD8, 0XD6, 0XD4, 0XD3,
-  0XD1, 0XD0, 0XCF, 0XCE, 0XCD, 0XCC, 0XCB, 0XCB, 0XCA, 0XCA, 0XC9, 0XC9,
-  0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3,
-  0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC6, 0XC6, 0XC6, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9, 0XC9, 0XCA, 0XCA,
-  0XCB, 0XCB, 0XCC, 0XCD, 0XCE, 0XCF, 0XD0, 0XD1, 0XD3, 0XD4, 0XD6, 0XD8,
-  0XDB, 0XDE, 0XE1, 0XE6, 0XEC, 0XF5, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XF4,
-  0XED, 0XE8, 0XE4, 0XE0, 0XDE, 0XDB, 0XD9, 0XD7, 0XD6, 0XD4, 0XD3, 0XD2,
-  0XD1, 0XD0, 0XCF, 0XCF, 0XCE, 0XCD, 0XCD, 0XCC, 0XCC, 0XCB, 0XCB, 0XCA,
-  0XCA, 0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC9, 0XC9, 0XC9, 0XCA,
-  0XCA, 0XCB, 0XCB, 0XCC, 0XCC, 0XCD, 0XCD, 0XCE, 0XCF, 0XCF, 0XD0, 0XD1,
-  0XD2, 0XD3, 0XD4, 0XD6, 0XD7, 0XD9, 0XDB, 0XDE, 0XE0, 0XE4, 0XE8, 0XED,
-  0XF4, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF4, 0XEE, 0XEA, 0XE6,
-  0XE3, 0XE0, 0XDE, 0XDC, 0XDA, 0XD9, 0XD7, 0XD6, 0XD5, 0XD4, 0XD3, 0XD2,
-  0XD2, 0XD1, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCE, 0XCD, 0XCD, 0XCC, 0XCC,
-  0XCC, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XC9, 0XC9, 0XC9,
-  0XC9, 0XC9, 0XC9, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC8, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCE, 0XCE, 0XCF, 0XCF,
-  0XD0, 0XD0, 0XD1, 0XD2, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD7, 0XD9, 0XDA,
-  0XDC, 0XDE, 0XE0, 0XE3, 0XE6, 0XEA, 0XEE, 0XF4, 0XFC, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XF4, 0XF0, 0XEB, 0XE8, 0XE5, 0XE3, 0XE1,
-  0XDF, 0XDD, 0XDC, 0XDB, 0XD9, 0XD8, 0XD7, 0XD6, 0XD5, 0XD5, 0XD4, 0XD3,
-  0XD3, 0XD2, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCD, 0XCD, 0XCD, 0XCD, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC,
-  0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCD, 0XCD, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF,
-  0XCF, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD2, 0XD3, 0XD3, 0XD4, 0XD5, 0XD5,
-  0XD6, 0XD7, 0XD8, 0XD9, 0XDB, 0XDC, 0XDD, 0XDF, 0XE1, 0XE3, 0XE5, 0XE8,
-  0XEB, 0XF0, 0XF4, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFB, 0XF5, 0XF1, 0XED, 0XEA, 0XE8, 0XE6, 0XE4, 0XE2, 0XE0, 0XDF,
-  0XDD, 0XDC, 0XDB, 0XDA, 0XD9, 0XD8, 0XD7, 0XD7, 0XD6, 0XD5, 0XD5, 0XD4,
-  0XD4, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF,
-  0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD5, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD9, 0XDA, 0XDB, 0XDC, 0XDD,
-  0XDF, 0XE0, 0XE2, 0XE4, 0XE6, 0XE8, 0XEA, 0XED, 0XF1, 0XF5, 0XFB, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XF7,
-  0XF3, 0XF0, 0XED, 0XEA, 0XE8, 0XE6, 0XE4, 0XE3, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDD, 0XDC, 0XDB, 0XDA, 0XDA, 0XD9, 0XD8, 0XD8, 0XD7, 0XD7, 0XD6, 0XD6,
-  0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD2,
-  0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0,
-  0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD4, 0XD5, 0XD5, 0XD6, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XDA,
-  0XDA, 0XDB, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1, 0XE3, 0XE4, 0XE6, 0XE8,
-  0XEA, 0XED, 0XF0, 0XF3, 0XF7, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XF8, 0XF5, 0XF2, 0XEF,
-  0XED, 0XEA, 0XE9, 0XE7, 0XE6, 0XE4, 0XE3, 0XE2, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDD, 0XDC, 0XDC, 0XDB, 0XDA, 0XDA, 0XD9, 0XD9, 0XD8, 0XD8, 0XD7, 0XD7,
-  0XD7, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8,
-  0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1,
-  0XE2, 0XE3, 0XE4, 0XE6, 0XE7, 0XE9, 0XEA, 0XED, 0XEF, 0XF2, 0XF5, 0XF8,
-  0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFA, 0XF6, 0XF4, 0XF1, 0XEF, 0XED, 0XEB,
-  0XEA, 0XE8, 0XE7, 0XE5, 0XE4, 0XE3, 0XE2, 0XE1, 0XE1, 0XE0, 0XDF, 0XDE,
-  0XDE, 0XDD, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD9, 0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDD, 0XDE,
-  0XDE, 0XDF, 0XE0, 0XE1, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE7, 0XE8, 0XEA,
-  0XEB, 0XED, 0XEF, 0XF1, 0XF4, 0XF6, 0XFA, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFB, 0XF8, 0XF6, 0XF3, 0XF1, 0XEF, 0XEE, 0XEC, 0XEB, 0XE9,
-  0XE8, 0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF,
-  0XDF, 0XDE, 0XDE, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDA,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDD,
-  0XDD, 0XDE, 0XDE, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1, 0XE2, 0XE2, 0XE3, 0XE4,
-  0XE5, 0XE6, 0XE7, 0XE8, 0XE9, 0XEB, 0XEC, 0XEE, 0XEF, 0XF1, 0XF3, 0XF6,
-  0XF8, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD,
-  0XFA, 0XF8, 0XF5, 0XF4, 0XF2, 0XF0, 0XEE, 0XED, 0XEC, 0XEB, 0XE9, 0XE8,
-  0XE7, 0XE7, 0XE6, 0XE5, 0XE4, 0XE4, 0XE3, 0XE2, 0XE2, 0XE1, 0XE1, 0XE0,
-  0XE0, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD, 0XDD, 0XDD, 0XDC,
-  0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDD, 0XDD, 0XDD,
-  0XDD, 0XDE, 0XDE, 0XDE, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1, 0XE1, 0XE2,
-  0XE2, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE7, 0XE7, 0XE8, 0XE9, 0XEB, 0XEC,
-  0XED, 0XEE, 0XF0, 0XF2, 0XF4, 0XF5, 0XF8, 0XFA, 0XFD, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8,
-  0XF6, 0XF4, 0XF2, 0XF1, 0XF0, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE8,
-  0XE8, 0XE7, 0XE6, 0XE6, 0XE5, 0XE4, 0XE4, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2,
-  0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE0, 0XE0, 0XE1, 0XE1, 0XE1,
-  0XE2, 0XE2, 0XE2, 0XE3, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE6, 0XE7, 0XE8,
-  0XE8, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XEE, 0XF0, 0XF1, 0XF2, 0XF4, 0XF6,
-  0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF6, 0XF5,
-  0XF3, 0XF2, 0XF1, 0XEF, 0XEE, 0XED, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE9,
-  0XE8, 0XE7, 0XE7, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3,
-  0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1,
-  0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE2, 0XE2, 0XE2,
-  0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE6,
-  0XE6, 0XE7, 0XE7, 0XE8, 0XE9, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XED, 0XEE,
-  0XEF, 0XF1, 0XF2, 0XF3, 0XF5, 0XF6, 0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF7, 0XF6, 0XF4, 0XF3,
-  0XF2, 0XF1, 0XF0, 0XEF, 0XEE, 0XED, 0XED, 0XEC, 0XEB, 0XEB, 0XEA, 0XEA,
-  0XE9, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5,
-  0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE5, 0XE6, 0XE6,
-  0XE6, 0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEB, 0XEB,
-  0XEC, 0XED, 0XED, 0XEE, 0XEF, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF6, 0XF7,
-  0XF8, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFC, 0XFB, 0XF9, 0XF8, 0XF7, 0XF5, 0XF4, 0XF3, 0XF2,
-  0XF1, 0XF1, 0XF0, 0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC, 0XEB, 0XEB,
-  0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE8, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA,
-  0XEB, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XF0, 0XF1, 0XF1,
-  0XF2, 0XF3, 0XF4, 0XF5, 0XF7, 0XF8, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFD, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF5, 0XF4, 0XF3, 0XF2,
-  0XF2, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC,
-  0XEC, 0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9,
-  0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9,
-  0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA, 0XEA, 0XEA, 0XEB,
-  0XEB, 0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XEF,
-  0XF0, 0XF0, 0XF1, 0XF2, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF8, 0XF9,
-  0XFA, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFC, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF6, 0XF5, 0XF4, 0XF3, 0XF3,
-  0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XED, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC,
-  0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEB, 0XEC, 0XEC, 0XEC, 0XEC,
-  0XEC, 0XEC, 0XEC, 0XEC, 0XED, 0XED, 0XED, 0XED, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3, 0XF4, 0XF5,
-  0XF6, 0XF6, 0XF7, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD, 0XFC,
-  0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF4,
-  0XF3, 0XF3, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XF0, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE,
-  0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEF, 0XF0, 0XF0, 0XF0, 0XF0, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF3,
-  0XF4, 0XF4, 0XF5, 0XF5, 0XF6, 0XF6, 0XF7, 0XF8, 0XF9, 0XFA, 0XFA, 0XFB,
-  0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC,
-  0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5,
-  0XF4, 0XF4, 0XF4, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF3, 0XF3,
-  0XF3, 0XF4, 0XF4, 0XF4, 0XF5, 0XF5, 0XF6, 0XF6, 0XF7, 0XF7, 0XF8, 0XF8,
-  0XF9, 0XFA, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD, 0XFD, 0XFC,
-  0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF6,
-  0XF6, 0XF6, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF6, 0XF6, 0XF6, 0XF7, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFD, 0XFD, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC,
-  0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8,
-  0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6,
-  0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF8, 0XF8,
-  0XF8, 0XF8, 0XF8, 0XF9, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFC,
-  0XFC, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD,
-  0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XFA,
-  0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9, 0XF9,
-  0XF9, 0XF9, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB, 0XFC,
-  0XFC, 0XFC, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC,
-  0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFC, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF8, 0XC7, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XC7, 0X91, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0X91,
-  0X5C, 0XF4, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF4, 0X5C, 0X27, 0XD3, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XD3, 0X27, 0X04, 0XB2, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF2, 0XB2, 0X04,
-  0X02, 0X91, 0XD7, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XD7, 0X91, 0X02, 0X01, 0X70, 0XBD, 0XE8,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XE8, 0XBD, 0X71, 0X01, 0X00, 0X4F, 0XA3, 0XD1, 0XEF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XEF, 0XD1, 0XA3, 0X4F, 0X00,
-  0X00, 0X2E, 0X89, 0XBA, 0XDA, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XF2, 0XDA, 0XBA, 0X89, 0X2E, 0X00, 0X00, 0X0D, 0X6E, 0XA3,
-  0XC6, 0XDF, 0XF2, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF2, 0XDF, 0XC6,
-  0XA3, 0X6E, 0X0D, 0X00, 0X00, 0X01, 0X54, 0X8D, 0XB2, 0XCD, 0XE1, 0XF2,
-  0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XF2, 0XE1, 0XCD, 0XB2, 0X8D, 0X54, 0X01, 0X00,
-  0X00, 0X01, 0X3A, 0X76, 0X9E, 0XBA, 0XD0, 0XE2, 0XEF, 0XFB, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XEF,
-  0XE2, 0XD0, 0XBA, 0X9E, 0X76, 0X3A, 0X01, 0X00, 0X00, 0X00, 0X1F, 0X60,
-  0X8A, 0XA8, 0XBF, 0XD1, 0XE0, 0XED, 0XF8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF8, 0XED, 0XE0, 0XD1, 0XBF, 0XA8, 0X8A,
-  0X60, 0X1F, 0X00, 0X00, 0X00, 0X00, 0X06, 0X49, 0X75, 0X95, 0XAE, 0XC1,
-  0XD1, 0XDE, 0XEA, 0XF3, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC,
-  0XF3, 0XEA, 0XDE, 0XD1, 0XC1, 0XAE, 0X95, 0X75, 0X49, 0X06, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X32, 0X61, 0X83, 0X9D, 0XB1, 0XC2, 0XD0, 0XDC, 0XE6,
-  0XEF, 0XF7, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF7, 0XEF, 0XE6, 0XDC, 0XD0, 0XC2,
-  0XB1, 0X9D, 0X83, 0X61, 0X32, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X1C,
-  0X4D, 0X70, 0X8B, 0XA1, 0XB2, 0XC1, 0XCE, 0XD9, 0XE2, 0XEB, 0XF2, 0XF9,
-  0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XF9, 0XF2, 0XEB, 0XE2, 0XD9, 0XCE, 0XC1, 0XB2, 0XA1, 0X8B, 0X70, 0X4D,
-  0X1C, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X39, 0X5E, 0X7A, 0X91,
-  0XA3, 0XB3, 0XC0, 0XCB, 0XD5, 0XDE, 0XE6, 0XED, 0XF3, 0XF9, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF9, 0XF3, 0XED, 0XE6, 0XDE, 0XD5,
-  0XCB, 0XC0, 0XB3, 0XA3, 0X91, 0X7A, 0X5E, 0X39, 0X05, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X24, 0X4B, 0X69, 0X81, 0X94, 0XA4, 0XB2, 0XBE,
-  0XC8, 0XD2, 0XDA, 0XE1, 0XE8, 0XEE, 0XF4, 0XF9, 0XFD, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD,
-  0XF9, 0XF4, 0XEE, 0XE8, 0XE1, 0XDA, 0XD2, 0XC8, 0XBE, 0XB2, 0XA4, 0X94,
-  0X81, 0X69, 0X4B, 0X24, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X10, 0X39, 0X58, 0X71, 0X85, 0X96, 0XA4, 0XB0, 0XBB, 0XC5, 0XCE, 0XD5,
-  0XDC, 0XE3, 0XE9, 0XEE, 0XF3, 0XF7, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFB, 0XF7, 0XF3, 0XEE, 0XE9, 0XE3, 0XDC,
-  0XD5, 0XCE, 0XC5, 0XBB, 0XB0, 0XA4, 0X96, 0X84, 0X71, 0X58, 0X39, 0X10,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X26, 0X47, 0X61,
-  0X75, 0X87, 0X96, 0XA3, 0XAF, 0XB8, 0XC2, 0XCA, 0XD1, 0XD7, 0XDD, 0XE3,
-  0XE8, 0XED, 0XF1, 0XF5, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XF9,
-  0XF5, 0XF1, 0XED, 0XE8, 0XE3, 0XDD, 0XD7, 0XD1, 0XCA, 0XC2, 0XB8, 0XAF,
-  0XA3, 0X96, 0X87, 0X75, 0X61, 0X47, 0X26, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X35, 0X50, 0X66, 0X78, 0X88, 0X96,
-  0XA2, 0XAC, 0XB5, 0XBE, 0XC5, 0XCC, 0XD3, 0XD8, 0XDD, 0XE2, 0XE7, 0XEB,
-  0XEF, 0XF2, 0XF6, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFC, 0XF9, 0XF6, 0XF2, 0XEF, 0XEB, 0XE7, 0XE2, 0XDD,
-  0XD8, 0XD3, 0XCC, 0XC5, 0XBE, 0XB5, 0XAC, 0XA2, 0X96, 0X88, 0X78, 0X66,
-  0X50, 0X35, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X24, 0X40, 0X57, 0X6A, 0X7A, 0X88, 0X95, 0X9F, 0XA9, 0XB2,
-  0XBA, 0XC1, 0XC8, 0XCD, 0XD3, 0XD8, 0XDD, 0XE1, 0XE5, 0XE9, 0XEC, 0XF0,
-  0XF3, 0XF5, 0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFB, 0XF8, 0XF5, 0XF3,
-  0XF0, 0XEC, 0XE9, 0XE5, 0XE1, 0XDD, 0XD8, 0XD3, 0XCD, 0XC8, 0XC1, 0XBA,
-  0XB2, 0XA9, 0X9F, 0X95, 0X88, 0X7A, 0X6A, 0X57, 0X40, 0X24, 0X03, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X13, 0X30,
-  0X47, 0X5B, 0X6C, 0X7B, 0X88, 0X93, 0X9D, 0XA6, 0XAE, 0XB6, 0XBD, 0XC3,
-  0XC8, 0XCE, 0XD2, 0XD7, 0XDB, 0XDF, 0XE3, 0XE6, 0XE9, 0XEC, 0XEF, 0XF1,
-  0XF4, 0XF7, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC,
-  0XFB, 0XF9, 0XF7, 0XF4, 0XF1, 0XEF, 0XEC, 0XE9, 0XE6, 0XE3, 0XDF, 0XDB,
-  0XD7, 0XD2, 0XCE, 0XC8, 0XC3, 0XBD, 0XB6, 0XAE, 0XA6, 0X9D, 0X93, 0X88,
-  0X7B, 0X6C, 0X5B, 0X47, 0X30, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X20, 0X38, 0X4D, 0X5E, 0X6D,
-  0X7B, 0X86, 0X91, 0X9A, 0XA3, 0XAA, 0XB2, 0XB8, 0XBE, 0XC3, 0XC8, 0XCD,
-  0XD1, 0XD5, 0XD9, 0XDD, 0XE0, 0XE3, 0XE6, 0XE8, 0XEB, 0XEE, 0XF0, 0XF2,
-  0XF4, 0XF6, 0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFD, 0XFC, 0XFB, 0XF9, 0XF8, 0XF6, 0XF4, 0XF2, 0XF0, 0XEE, 0XEB,
-  0XE8, 0XE6, 0XE3, 0XE0, 0XDD, 0XD9, 0XD5, 0XD1, 0XCD, 0XC8, 0XC3, 0XBE,
-  0XB8, 0XB2, 0XAA, 0XA3, 0X9A, 0X91, 0X86, 0X7B, 0X6D, 0X5E, 0X4D, 0X38,
-  0X20, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X10, 0X29, 0X3E, 0X50, 0X60, 0X6E, 0X7A, 0X85, 0X8E,
-  0X97, 0X9F, 0XA7, 0XAD, 0XB3, 0XB9, 0XBE, 0XC3, 0XC7, 0XCC, 0XCF, 0XD3,
-  0XD6, 0XDA, 0XDC, 0XDF, 0XE2, 0XE5, 0XE7, 0XE9, 0XEB, 0XED, 0XEF, 0XF1,
-  0XF2, 0XF4, 0XF5, 0XF7, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFD, 0XFC, 0XFB, 0XFA, 0XF9, 0XF8, 0XF7, 0XF5, 0XF4, 0XF2,
-  0XF1, 0XEF, 0XED, 0XEB, 0XE9, 0XE7, 0XE5, 0XE2, 0XDF, 0XDC, 0XDA, 0XD6,
-  0XD3, 0XCF, 0XCC, 0XC7, 0XC3, 0XBE, 0XB9, 0XB3, 0XAD, 0XA7, 0X9F, 0X97,
-  0X8E, 0X85, 0X7A, 0X6E, 0X60, 0X50, 0X3E, 0X29, 0X10, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02,
-  0X19, 0X2F, 0X42, 0X52, 0X61, 0X6D, 0X79, 0X82, 0X8C, 0X94, 0X9B, 0XA2,
-  0XA9, 0XAE, 0XB4, 0XB9, 0XBD, 0XC2, 0XC6, 0XCA, 0XCD, 0XD0, 0XD4, 0XD6,
-  0XD9, 0XDC, 0XDE, 0XE0, 0XE2, 0XE4, 0XE7, 0XE8, 0XEA, 0XEB, 0XED, 0XEE,
-  0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF7, 0XF8, 0XF8, 0XF9,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF5, 0XF4,
-  0XF3, 0XF2, 0XF1, 0XF0, 0XEE, 0XED, 0XEB, 0XEA, 0XE8, 0XE7, 0XE4, 0XE2,
-  0XE0, 0XDE, 0XDC, 0XD9, 0XD6, 0XD4, 0XD0, 0XCD, 0XCA, 0XC6, 0XC2, 0XBD,
-  0XB9, 0XB4, 0XAE, 0XA9, 0XA2, 0X9B, 0X94, 0X8C, 0X82, 0X79, 0X6D, 0X61,
-  0X52, 0X42, 0X2F, 0X19, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X21, 0X34, 0X45,
-  0X54, 0X61, 0X6C, 0X77, 0X80, 0X89, 0X90, 0X97, 0X9E, 0XA4, 0XAA, 0XAF,
-  0XB3, 0XB8, 0XBC, 0XC0, 0XC4, 0XC7, 0XCA, 0XCD, 0XD0, 0XD3, 0XD5, 0XD7,
-  0XDA, 0XDC, 0XDE, 0XE0, 0XE1, 0XE3, 0XE5, 0XE6, 0XE8, 0XE9, 0XEA, 0XEB,
-  0XEC, 0XED, 0XEE, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2,
-  0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEE, 0XED, 0XEC, 0XEB, 0XEA, 0XE9, 0XE8,
-  0XE6, 0XE5, 0XE3, 0XE1, 0XE0, 0XDE, 0XDC, 0XDA, 0XD7, 0XD5, 0XD3, 0XD0,
-  0XCD, 0XCA, 0XC7, 0XC4, 0XC0, 0XBC, 0XB8, 0XB3, 0XAF, 0XAA, 0XA4, 0X9E,
-  0X97, 0X90, 0X89, 0X80, 0X77, 0X6C, 0X61, 0X54, 0X45, 0X34, 0X21, 0X0A,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X12, 0X26, 0X37, 0X47, 0X54, 0X60, 0X6B,
-  0X75, 0X7D, 0X85, 0X8D, 0X93, 0X9A, 0X9F, 0XA5, 0XAA, 0XAE, 0XB3, 0XB7,
-  0XBA, 0XBE, 0XC1, 0XC4, 0XC7, 0XCA, 0XCC, 0XCF, 0XD1, 0XD3, 0XD5, 0XD7,
-  0XD9, 0XDB, 0XDC, 0XDE, 0XDF, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE6, 0XE7,
-  0XE7, 0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEA, 0XEA, 0XEB, 0XEB, 0XEB, 0XEB,
-  0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE8, 0XE8, 0XE7,
-  0XE7, 0XE6, 0XE5, 0XE4, 0XE3, 0XE2, 0XE1, 0XDF, 0XDE, 0XDC, 0XDB, 0XD9,
-  0XD7, 0XD5, 0XD3, 0XD1, 0XCF, 0XCC, 0XCA, 0XC7, 0XC4, 0XC1, 0XBE, 0XBA,
-  0XB7, 0XB3, 0XAE, 0XAA, 0XA5, 0X9F, 0X9A, 0X93, 0X8D, 0X85, 0X7D, 0X75,
-  0X6B, 0X60, 0X54, 0X47, 0X38, 0X26, 0X12, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X04, 0X18, 0X2A, 0X3A, 0X47, 0X54, 0X5F, 0X69, 0X72, 0X7A, 0X82,
-  0X89, 0X8F, 0X95, 0X9B, 0XA0, 0XA5, 0XA9, 0XAD, 0XB1, 0XB5, 0XB8, 0XBB,
-  0XBE, 0XC1, 0XC4, 0XC6, 0XC9, 0XCB, 0XCD, 0XCF, 0XD0, 0XD2, 0XD4, 0XD5,
-  0XD7, 0XD8, 0XD9, 0XDA, 0XDC, 0XDD, 0XDE, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1,
-  0XE2, 0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE2, 0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF, 0XDF, 0XDE, 0XDD, 0XDC,
-  0XDA, 0XD9, 0XD8, 0XD7, 0XD5, 0XD4, 0XD2, 0XD0, 0XCF, 0XCD, 0XCB, 0XC9,
-  0XC6, 0XC4, 0XC1, 0XBE, 0XBB, 0XB8, 0XB5, 0XB1, 0XAD, 0XA9, 0XA5, 0XA0,
-  0X9B, 0X95, 0X8F, 0X89, 0X82, 0X7A, 0X72, 0X69, 0X5F, 0X54, 0X47, 0X3A,
-  0X2A, 0X18, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0A, 0X1D,
-  0X2D, 0X3B, 0X48, 0X53, 0X5E, 0X67, 0X6F, 0X77, 0X7E, 0X85, 0X8B, 0X91,
-  0X96, 0X9B, 0X9F, 0XA4, 0XA7, 0XAB, 0XAF, 0XB2, 0XB5, 0XB8, 0XBB, 0XBD,
-  0XC0, 0XC2, 0XC4, 0XC6, 0XC8, 0XCA, 0XCB, 0XCD, 0XCF, 0XD0, 0XD1, 0XD2,
-  0XD3, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD8, 0XD9, 0XDA, 0XDA, 0XDA, 0XDB,
-  0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDA, 0XDA, 0XDA,
-  0XD9, 0XD8, 0XD8, 0XD7, 0XD7, 0XD6, 0XD5, 0XD3, 0XD2, 0XD1, 0XD0, 0XCF,
-  0XCD, 0XCB, 0XCA, 0XC8, 0XC6, 0XC4, 0XC2, 0XC0, 0XBD, 0XBB, 0XB8, 0XB5,
-  0XB2, 0XAF, 0XAB, 0XA7, 0XA4, 0X9F, 0X9B, 0X96, 0X91, 0X8B, 0X85, 0X7E,
-  0X77, 0X6F, 0X67, 0X5E, 0X53, 0X48, 0X3B, 0X2D, 0X1D, 0X0A, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0F, 0X20, 0X2E, 0X3C, 0X47,
-  0X52, 0X5B, 0X64, 0X6C, 0X74, 0X7A, 0X81, 0X87, 0X8C, 0X91, 0X96, 0X9A,
-  0X9E, 0XA2, 0XA6, 0XA9, 0XAC, 0XAF, 0XB2, 0XB5, 0XB7, 0XBA, 0XBC, 0XBE,
-  0XC0, 0XC2, 0XC3, 0XC5, 0XC7, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC, 0XCE, 0XCE,
-  0XCF, 0XD0, 0XD0, 0XD1, 0XD2, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD3, 0XD4,
-  0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD1, 0XD0, 0XD0, 0XCF,
-  0XCE, 0XCE, 0XCC, 0XCB, 0XCA, 0XC9, 0XC8, 0XC7, 0XC5, 0XC3, 0XC2, 0XC0,
-  0XBE, 0XBC, 0XBA, 0XB7, 0XB5, 0XB2, 0XAF, 0XAC, 0XA9, 0XA6, 0XA2, 0X9E,
-  0X9A, 0X96, 0X91, 0X8C, 0X87, 0X81, 0X7A, 0X74, 0X6C, 0X64, 0X5B, 0X52,
-  0X47, 0X3C, 0X2E, 0X20, 0X0F, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X13, 0X22, 0X2F, 0X3B, 0X46, 0X50, 0X59, 0X61,
-  0X69, 0X70, 0X77, 0X7C, 0X82, 0X87, 0X8C, 0X91, 0X95, 0X99, 0X9C, 0XA0,
-  0XA3, 0XA6, 0XA9, 0XAC, 0XAE, 0XB1, 0XB3, 0XB5, 0XB7, 0XB9, 0XBB, 0XBD,
-  0XBE, 0XC0, 0XC1, 0XC2, 0XC3, 0XC5, 0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XC9,
-  0XCA, 0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCA, 0XCA, 0XC9, 0XC9, 0XC8, 0XC7, 0XC6, 0XC6, 0XC5, 0XC3,
-  0XC2, 0XC1, 0XC0, 0XBE, 0XBD, 0XBB, 0XB9, 0XB7, 0XB5, 0XB3, 0XB1, 0XAE,
-  0XAC, 0XA9, 0XA6, 0XA3, 0XA0, 0X9C, 0X99, 0X95, 0X91, 0X8C, 0X87, 0X82,
-  0X7C, 0X77, 0X70, 0X69, 0X61, 0X59, 0X50, 0X46, 0X3B, 0X2F, 0X22, 0X13,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X06, 0X15, 0X23, 0X2F, 0X3B, 0X45, 0X4E, 0X56, 0X5E, 0X66, 0X6C, 0X72,
-  0X78, 0X7D, 0X82, 0X87, 0X8B, 0X8F, 0X93, 0X97, 0X9A, 0X9D, 0XA0, 0XA3,
-  0XA6, 0XA8, 0XAB, 0XAD, 0XAF, 0XB1, 0XB3, 0XB4, 0XB6, 0XB7, 0XB9, 0XBA,
-  0XBB, 0XBC, 0XBE, 0XBE, 0XBF, 0XC0, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC3,
-  0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3, 0XC3, 0XC3, 0XC2, 0XC2,
-  0XC1, 0XC1, 0XC0, 0XBF, 0XBE, 0XBE, 0XBC, 0XBB, 0XBA, 0XB9, 0XB7, 0XB6,
-  0XB4, 0XB3, 0XB1, 0XAF, 0XAD, 0XAB, 0XA8, 0XA6, 0XA3, 0XA0, 0X9D, 0X9A,
-  0X97, 0X93, 0X8F, 0X8B, 0X87, 0X82, 0X7D, 0X78, 0X72, 0X6C, 0X66, 0X5E,
-  0X56, 0X4E, 0X45, 0X3B, 0X2F, 0X23, 0X15, 0X06, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X17, 0X23,
-  0X2F, 0X3A, 0X43, 0X4C, 0X54, 0X5B, 0X62, 0X68, 0X6E, 0X74, 0X79, 0X7D,
-  0X82, 0X86, 0X8A, 0X8E, 0X91, 0X94, 0X97, 0X9A, 0X9D, 0XA0, 0XA2, 0XA4,
-  0XA6, 0XA8, 0XAA, 0XAC, 0XAE, 0XAF, 0XB1, 0XB2, 0XB3, 0XB4, 0XB5, 0XB6,
-  0XB7, 0XB8, 0XB9, 0XB9, 0XBA, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBB, 0XBB, 0XBB, 0XBA, 0XB9, 0XB9, 0XB8, 0XB7,
-  0XB6, 0XB5, 0XB4, 0XB3, 0XB2, 0XB1, 0XAF, 0XAE, 0XAC, 0XAA, 0XA8, 0XA6,
-  0XA4, 0XA2, 0XA0, 0X9D, 0X9A, 0X97, 0X94, 0X91, 0X8E, 0X8A, 0X86, 0X82,
-  0X7D, 0X79, 0X74, 0X6E, 0X68, 0X62, 0X5B, 0X54, 0X4C, 0X43, 0X3A, 0X2F,
-  0X23, 0X17, 0X09, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X0B, 0X18, 0X24, 0X2E, 0X38, 0X41,
-  0X49, 0X51, 0X58, 0X5E, 0X64, 0X6A, 0X6F, 0X74, 0X79, 0X7D, 0X81, 0X85,
-  0X88, 0X8C, 0X8F, 0X92, 0X94, 0X97, 0X9A, 0X9C, 0X9E, 0XA0, 0XA2, 0XA4,
-  0XA5, 0XA7, 0XA8, 0XAA, 0XAB, 0XAC, 0XAD, 0XAE, 0XAF, 0XB0, 0XB1, 0XB1,
-  0XB2, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4, 0XB4,
-  0XB3, 0XB3, 0XB3, 0XB2, 0XB1, 0XB1, 0XB0, 0XAF, 0XAE, 0XAD, 0XAC, 0XAB,
-  0XAA, 0XA8, 0XA7, 0XA5, 0XA4, 0XA2, 0XA0, 0X9E, 0X9C, 0X9A, 0X97, 0X94,
-  0X92, 0X8F, 0X8C, 0X88, 0X85, 0X81, 0X7D, 0X79, 0X74, 0X6F, 0X6A, 0X64,
-  0X5E, 0X58, 0X51, 0X49, 0X41, 0X38, 0X2E, 0X24, 0X18, 0X0B, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X0C, 0X18, 0X23, 0X2D, 0X36, 0X3F, 0X46, 0X4E, 0X54,
-  0X5A, 0X60, 0X65, 0X6A, 0X6F, 0X74, 0X78, 0X7B, 0X7F, 0X83, 0X86, 0X89,
-  0X8C, 0X8E, 0X91, 0X93, 0X95, 0X98, 0X9A, 0X9B, 0X9D, 0X9F, 0XA0, 0XA2,
-  0XA3, 0XA4, 0XA5, 0XA6, 0XA7, 0XA8, 0XA9, 0XAA, 0XAA, 0XAB, 0XAB, 0XAB,
-  0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAC, 0XAB, 0XAB, 0XAB, 0XAA,
-  0XAA, 0XA9, 0XA8, 0XA7, 0XA6, 0XA5, 0XA4, 0XA3, 0XA2, 0XA0, 0X9F, 0X9D,
-  0X9B, 0X9A, 0X98, 0X95, 0X93, 0X91, 0X8E, 0X8C, 0X89, 0X86, 0X83, 0X7F,
-  0X7B, 0X78, 0X74, 0X6F, 0X6A, 0X65, 0X60, 0X5A, 0X54, 0X4E, 0X46, 0X3F,
-  0X36, 0X2D, 0X23, 0X18, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0C, 0X18, 0X22, 0X2B, 0X34, 0X3C, 0X43, 0X4A, 0X50, 0X56, 0X5C, 0X61,
-  0X66, 0X6A, 0X6F, 0X72, 0X76, 0X7A, 0X7D, 0X80, 0X83, 0X86, 0X88, 0X8B,
-  0X8D, 0X8F, 0X91, 0X93, 0X95, 0X97, 0X98, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E,
-  0X9F, 0XA0, 0XA1, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA4, 0XA4, 0XA4, 0XA4,
-  0XA4, 0XA4, 0XA4, 0XA4, 0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA1, 0XA0, 0X9F,
-  0X9E, 0X9D, 0X9C, 0X9B, 0X9A, 0X98, 0X97, 0X95, 0X93, 0X91, 0X8F, 0X8D,
-  0X8B, 0X88, 0X86, 0X83, 0X80, 0X7D, 0X7A, 0X76, 0X72, 0X6F, 0X6A, 0X66,
-  0X61, 0X5C, 0X56, 0X50, 0X4A, 0X43, 0X3C, 0X34, 0X2B, 0X22, 0X18, 0X0C,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X17, 0X20,
-  0X29, 0X31, 0X39, 0X40, 0X47, 0X4D, 0X52, 0X58, 0X5C, 0X61, 0X65, 0X69,
-  0X6D, 0X71, 0X74, 0X77, 0X7A, 0X7D, 0X80, 0X82, 0X85, 0X87, 0X89, 0X8B,
-  0X8D, 0X8E, 0X90, 0X91, 0X93, 0X94, 0X95, 0X96, 0X97, 0X98, 0X99, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C,
-  0X9C, 0X9B, 0X9B, 0X9A, 0X9A, 0X99, 0X98, 0X97, 0X96, 0X95, 0X94, 0X93,
-  0X91, 0X90, 0X8E, 0X8D, 0X8B, 0X89, 0X87, 0X85, 0X82, 0X80, 0X7D, 0X7A,
-  0X77, 0X74, 0X71, 0X6D, 0X69, 0X65, 0X61, 0X5C, 0X58, 0X52, 0X4D, 0X47,
-  0X40, 0X39, 0X31, 0X29, 0X20, 0X17, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0C, 0X16, 0X1F, 0X27, 0X2F, 0X36,
-  0X3D, 0X43, 0X49, 0X4E, 0X53, 0X58, 0X5C, 0X60, 0X64, 0X68, 0X6B, 0X6F,
-  0X72, 0X74, 0X77, 0X7A, 0X7C, 0X7E, 0X80, 0X82, 0X84, 0X86, 0X88, 0X89,
-  0X8B, 0X8C, 0X8D, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X92, 0X93, 0X93, 0X94,
-  0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93, 0X93, 0X92,
-  0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8C, 0X8B, 0X89, 0X88, 0X86, 0X84,
-  0X82, 0X80, 0X7E, 0X7C, 0X7A, 0X77, 0X74, 0X72, 0X6F, 0X6B, 0X68, 0X64,
-  0X60, 0X5C, 0X58, 0X53, 0X4E, 0X49, 0X43, 0X3D, 0X36, 0X2F, 0X27, 0X1F,
-  0X16, 0X0C, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X0B, 0X14, 0X1D, 0X25, 0X2C, 0X33, 0X39, 0X3F, 0X44,
-  0X49, 0X4E, 0X53, 0X57, 0X5B, 0X5F, 0X62, 0X66, 0X69, 0X6C, 0X6F, 0X71,
-  0X74, 0X76, 0X78, 0X7A, 0X7C, 0X7E, 0X7F, 0X81, 0X82, 0X84, 0X85, 0X86,
-  0X87, 0X88, 0X89, 0X8A, 0X8A, 0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C,
-  0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89, 0X88, 0X87,
-  0X86, 0X85, 0X84, 0X82, 0X81, 0X7F, 0X7E, 0X7C, 0X7A, 0X78, 0X76, 0X74,
-  0X71, 0X6F, 0X6C, 0X69, 0X66, 0X62, 0X5F, 0X5B, 0X57, 0X53, 0X4E, 0X49,
-  0X44, 0X3F, 0X39, 0X33, 0X2C, 0X25, 0X1D, 0X14, 0X0B, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0A, 0X12, 0X1A, 0X22, 0X29, 0X2F, 0X35, 0X3B, 0X40, 0X45, 0X4A, 0X4E,
-  0X52, 0X56, 0X5A, 0X5D, 0X60, 0X63, 0X66, 0X69, 0X6B, 0X6E, 0X70, 0X72,
-  0X74, 0X76, 0X77, 0X79, 0X7A, 0X7C, 0X7D, 0X7E, 0X7F, 0X80, 0X81, 0X82,
-  0X82, 0X83, 0X83, 0X84, 0X84, 0X84, 0X84, 0X85, 0X85, 0X84, 0X84, 0X84,
-  0X84, 0X83, 0X83, 0X82, 0X82, 0X81, 0X80, 0X7F, 0X7E, 0X7D, 0X7C, 0X7A,
-  0X79, 0X77, 0X76, 0X74, 0X72, 0X70, 0X6E, 0X6B, 0X69, 0X66, 0X63, 0X60,
-  0X5D, 0X5A, 0X56, 0X52, 0X4E, 0X4A, 0X45, 0X40, 0X3B, 0X35, 0X2F, 0X29,
-  0X22, 0X1A, 0X12, 0X0A, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X08, 0X10, 0X18,
-  0X1F, 0X26, 0X2C, 0X31, 0X37, 0X3C, 0X41, 0X45, 0X49, 0X4D, 0X51, 0X54,
-  0X58, 0X5B, 0X5E, 0X60, 0X63, 0X65, 0X67, 0X69, 0X6C, 0X6D, 0X6F, 0X71,
-  0X72, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X7A, 0X7B, 0X7B, 0X7C,
-  0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7A,
-  0X7A, 0X79, 0X78, 0X77, 0X76, 0X75, 0X74, 0X72, 0X71, 0X6F, 0X6D, 0X6C,
-  0X69, 0X67, 0X65, 0X63, 0X60, 0X5E, 0X5B, 0X58, 0X54, 0X51, 0X4D, 0X49,
-  0X45, 0X41, 0X3C, 0X37, 0X31, 0X2C, 0X26, 0X1F, 0X18, 0X10, 0X08, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0E, 0X15, 0X1C, 0X22, 0X28,
-  0X2D, 0X32, 0X37, 0X3C, 0X40, 0X44, 0X48, 0X4B, 0X4F, 0X52, 0X55, 0X58,
-  0X5A, 0X5D, 0X5F, 0X61, 0X63, 0X65, 0X67, 0X69, 0X6A, 0X6B, 0X6D, 0X6E,
-  0X6F, 0X70, 0X71, 0X72, 0X72, 0X73, 0X74, 0X74, 0X74, 0X74, 0X75, 0X75,
-  0X75, 0X75, 0X74, 0X74, 0X74, 0X74, 0X73, 0X72, 0X72, 0X71, 0X70, 0X6F,
-  0X6E, 0X6D, 0X6B, 0X6A, 0X69, 0X67, 0X65, 0X63, 0X61, 0X5F, 0X5D, 0X5A,
-  0X58, 0X55, 0X52, 0X4F, 0X4B, 0X48, 0X44, 0X40, 0X3C, 0X37, 0X32, 0X2D,
-  0X28, 0X22, 0X1C, 0X15, 0X0E, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X04, 0X0B, 0X12, 0X18, 0X1E, 0X24, 0X29, 0X2E, 0X33,
-  0X37, 0X3B, 0X3F, 0X43, 0X46, 0X49, 0X4C, 0X4F, 0X52, 0X54, 0X57, 0X59,
-  0X5B, 0X5D, 0X5F, 0X60, 0X62, 0X63, 0X65, 0X66, 0X67, 0X68, 0X69, 0X6A,
-  0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6D, 0X6C,
-  0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X68, 0X67, 0X66, 0X65, 0X63, 0X62,
-  0X60, 0X5F, 0X5D, 0X5B, 0X59, 0X57, 0X54, 0X52, 0X4F, 0X4C, 0X49, 0X46,
-  0X43, 0X3F, 0X3B, 0X37, 0X33, 0X2E, 0X29, 0X24, 0X1E, 0X18, 0X12, 0X0B,
-  0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X08, 0X0F, 0X15, 0X1B, 0X20, 0X25, 0X2A, 0X2E, 0X32, 0X36, 0X3A,
-  0X3D, 0X41, 0X44, 0X47, 0X49, 0X4C, 0X4E, 0X51, 0X53, 0X55, 0X56, 0X58,
-  0X5A, 0X5B, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63, 0X63, 0X64, 0X64,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64, 0X63, 0X63,
-  0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5B, 0X5A, 0X58, 0X56, 0X55, 0X53,
-  0X51, 0X4E, 0X4C, 0X49, 0X47, 0X44, 0X41, 0X3D, 0X3A, 0X36, 0X32, 0X2E,
-  0X2A, 0X25, 0X20, 0X1B, 0X15, 0X0F, 0X08, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X05, 0X0B,
-  0X11, 0X17, 0X1C, 0X20, 0X25, 0X29, 0X2D, 0X31, 0X35, 0X38, 0X3B, 0X3E,
-  0X41, 0X44, 0X46, 0X48, 0X4A, 0X4C, 0X4E, 0X50, 0X52, 0X53, 0X55, 0X56,
-  0X57, 0X58, 0X59, 0X5A, 0X5B, 0X5B, 0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D,
-  0X5D, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X58, 0X57,
-  0X56, 0X55, 0X53, 0X52, 0X50, 0X4E, 0X4C, 0X4A, 0X48, 0X46, 0X44, 0X41,
-  0X3E, 0X3B, 0X38, 0X35, 0X31, 0X2D, 0X29, 0X25, 0X20, 0X1C, 0X17, 0X11,
-  0X0B, 0X05, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X08, 0X0D, 0X13, 0X17,
-  0X1C, 0X21, 0X25, 0X28, 0X2C, 0X2F, 0X33, 0X36, 0X38, 0X3B, 0X3E, 0X40,
-  0X42, 0X44, 0X46, 0X48, 0X4A, 0X4B, 0X4D, 0X4E, 0X4F, 0X50, 0X51, 0X52,
-  0X53, 0X53, 0X54, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55,
-  0X54, 0X54, 0X53, 0X53, 0X52, 0X51, 0X50, 0X4F, 0X4E, 0X4D, 0X4B, 0X4A,
-  0X48, 0X46, 0X44, 0X42, 0X40, 0X3E, 0X3B, 0X38, 0X36, 0X33, 0X2F, 0X2C,
-  0X28, 0X25, 0X21, 0X1C, 0X17, 0X13, 0X0D, 0X08, 0X02, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X09, 0X0E, 0X13, 0X18, 0X1C, 0X20,
-  0X23, 0X27, 0X2A, 0X2D, 0X30, 0X33, 0X35, 0X38, 0X3A, 0X3C, 0X3E, 0X40,
-  0X41, 0X43, 0X44, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X4B, 0X4B, 0X4C, 0X4C,
-  0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4B,
-  0X4A, 0X49, 0X48, 0X47, 0X46, 0X44, 0X43, 0X41, 0X40, 0X3E, 0X3C, 0X3A,
-  0X38, 0X35, 0X33, 0X30, 0X2D, 0X2A, 0X27, 0X23, 0X20, 0X1C, 0X18, 0X13,
-  0X0E, 0X09, 0X04, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X05, 0X0A, 0X0F, 0X13, 0X17, 0X1B, 0X1E, 0X22, 0X25,
-  0X28, 0X2A, 0X2D, 0X2F, 0X32, 0X34, 0X36, 0X38, 0X39, 0X3B, 0X3C, 0X3E,
-  0X3F, 0X40, 0X41, 0X42, 0X43, 0X44, 0X44, 0X45, 0X45, 0X45, 0X45, 0X45,
-  0X45, 0X45, 0X45, 0X45, 0X45, 0X44, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3F,
-  0X3E, 0X3C, 0X3B, 0X39, 0X38, 0X36, 0X34, 0X32, 0X2F, 0X2D, 0X2A, 0X28,
-  0X25, 0X22, 0X1E, 0X1B, 0X17, 0X13, 0X0F, 0X0A, 0X05, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X06, 0X0A, 0X0E, 0X12, 0X15, 0X19, 0X1C, 0X1F, 0X22, 0X25, 0X27,
-  0X29, 0X2B, 0X2E, 0X2F, 0X31, 0X33, 0X34, 0X36, 0X37, 0X38, 0X39, 0X3A,
-  0X3B, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3C, 0X3C, 0X3B, 0X3A, 0X39, 0X38, 0X37, 0X36, 0X34, 0X33, 0X31,
-  0X2F, 0X2E, 0X2B, 0X29, 0X27, 0X25, 0X22, 0X1F, 0X1C, 0X19, 0X15, 0X12,
-  0X0E, 0X0A, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05,
-  0X09, 0X0D, 0X10, 0X14, 0X17, 0X1A, 0X1C, 0X1F, 0X21, 0X23, 0X25, 0X27,
-  0X29, 0X2B, 0X2C, 0X2E, 0X2F, 0X30, 0X31, 0X32, 0X33, 0X34, 0X34, 0X35,
-  0X35, 0X35, 0X35, 0X36, 0X36, 0X35, 0X35, 0X35, 0X35, 0X34, 0X34, 0X33,
-  0X32, 0X31, 0X30, 0X2F, 0X2E, 0X2C, 0X2B, 0X29, 0X27, 0X25, 0X23, 0X21,
-  0X1F, 0X1C, 0X1A, 0X17, 0X14, 0X10, 0X0D, 0X09, 0X05, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X04, 0X08, 0X0B,
-  0X0E, 0X11, 0X14, 0X16, 0X19, 0X1B, 0X1D, 0X1F, 0X21, 0X23, 0X24, 0X26,
-  0X27, 0X28, 0X29, 0X2A, 0X2B, 0X2C, 0X2C, 0X2D, 0X2D, 0X2D, 0X2E, 0X2E,
-  0X2E, 0X2E, 0X2D, 0X2D, 0X2D, 0X2C, 0X2C, 0X2B, 0X2A, 0X29, 0X28, 0X27,
-  0X26, 0X24, 0X23, 0X21, 0X1F, 0X1D, 0X1B, 0X19, 0X16, 0X14, 0X11, 0X0E,
-  0X0B, 0X08, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X06, 0X09, 0X0B, 0X0E,
-  0X11, 0X13, 0X15, 0X17, 0X19, 0X1A, 0X1C, 0X1E, 0X1F, 0X20, 0X21, 0X22,
-  0X23, 0X24, 0X24, 0X25, 0X25, 0X25, 0X26, 0X26, 0X26, 0X26, 0X25, 0X25,
-  0X25, 0X24, 0X24, 0X23, 0X22, 0X21, 0X20, 0X1F, 0X1E, 0X1C, 0X1A, 0X19,
-  0X17, 0X15, 0X13, 0X11, 0X0E, 0X0B, 0X09, 0X06, 0X03, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X06, 0X08, 0X0B, 0X0D, 0X0F,
-  0X11, 0X12, 0X14, 0X16, 0X17, 0X18, 0X19, 0X1A, 0X1B, 0X1C, 0X1C, 0X1D,
-  0X1D, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1D, 0X1D, 0X1C, 0X1C, 0X1B,
-  0X1A, 0X19, 0X18, 0X17, 0X16, 0X14, 0X12, 0X11, 0X0F, 0X0D, 0X0B, 0X08,
-  0X06, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X05, 0X07, 0X09, 0X0A, 0X0C, 0X0D,
-  0X0F, 0X10, 0X11, 0X12, 0X13, 0X14, 0X14, 0X15, 0X15, 0X16, 0X16, 0X16,
-  0X16, 0X16, 0X16, 0X15, 0X15, 0X14, 0X14, 0X13, 0X12, 0X11, 0X10, 0X0F,
-  0X0D, 0X0C, 0X0A, 0X09, 0X07, 0X05, 0X02, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X05, 0X07, 0X08, 0X09, 0X0A,
-  0X0B, 0X0C, 0X0D, 0X0D, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
-  0X0D, 0X0D, 0X0C, 0X0B, 0X0A, 0X09, 0X08, 0X07, 0X05, 0X04, 0X02, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X03, 0X04, 0X05, 0X05,
-  0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X06, 0X05, 0X05, 0X04, 0X03,
-  0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00 };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("newtEye_upper_sym");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("newtEye_lower_sym");
 #else
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01, 0X01,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X01, 0X01, 0X01, 0X02, 0X02, 0X02, 0X03, 0X03, 0X03, 0X03,
-  0X04, 0X04, 0X04, 0X04, 0X04, 0X03, 0X03, 0X03, 0X03, 0X03, 0X02, 0X02,
-  0X01, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X03, 0X03,
-  0X04, 0X05, 0X05, 0X06, 0X06, 0X06, 0X06, 0X07, 0X07, 0X07, 0X07, 0X07,
-  0X07, 0X07, 0X07, 0X06, 0X06, 0X06, 0X06, 0X05, 0X04, 0X04, 0X03, 0X02,
-  0X02, 0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X02, 0X02, 0X03, 0X04, 0X06, 0X06, 0X07, 0X09, 0X09, 0X0A, 0X0B,
-  0X0B, 0X0B, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C,
-  0X0B, 0X0B, 0X0A, 0X0A, 0X09, 0X07, 0X06, 0X06, 0X05, 0X04, 0X03, 0X02,
-  0X01, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X01, 0X02, 0X03, 0X05, 0X06, 0X07,
-  0X09, 0X0A, 0X0B, 0X0C, 0X0D, 0X0E, 0X0E, 0X10, 0X10, 0X11, 0X11, 0X11,
-  0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X11, 0X10, 0X10, 0X10, 0X0E,
-  0X0D, 0X0D, 0X0C, 0X0B, 0X0A, 0X09, 0X07, 0X06, 0X05, 0X03, 0X03, 0X01,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X02, 0X03, 0X05, 0X06, 0X07, 0X09, 0X0B, 0X0C, 0X0D, 0X0E, 0X10, 0X11,
-  0X12, 0X13, 0X13, 0X14, 0X14, 0X16, 0X16, 0X17, 0X17, 0X17, 0X17, 0X17,
-  0X17, 0X17, 0X16, 0X16, 0X16, 0X14, 0X14, 0X13, 0X13, 0X12, 0X11, 0X10,
-  0X0E, 0X0D, 0X0C, 0X0B, 0X0A, 0X07, 0X06, 0X05, 0X03, 0X02, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X03, 0X05, 0X06, 0X09, 0X0B,
-  0X0C, 0X0E, 0X10, 0X11, 0X13, 0X14, 0X14, 0X16, 0X17, 0X18, 0X18, 0X19,
-  0X19, 0X1A, 0X1A, 0X1A, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1A, 0X1A,
-  0X1A, 0X19, 0X19, 0X18, 0X18, 0X17, 0X16, 0X16, 0X14, 0X13, 0X12, 0X10,
-  0X0E, 0X0D, 0X0B, 0X0A, 0X07, 0X06, 0X05, 0X03, 0X01, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X02, 0X04, 0X06, 0X07, 0X0A, 0X0C, 0X0E, 0X10, 0X12, 0X13, 0X16, 0X17,
-  0X18, 0X19, 0X1A, 0X1A, 0X1B, 0X1C, 0X1E, 0X1E, 0X1E, 0X1F, 0X1F, 0X1F,
-  0X20, 0X20, 0X20, 0X20, 0X20, 0X20, 0X1F, 0X1F, 0X1F, 0X1E, 0X1E, 0X1E,
-  0X1C, 0X1C, 0X1B, 0X1A, 0X19, 0X18, 0X17, 0X16, 0X14, 0X13, 0X12, 0X10,
-  0X0D, 0X0C, 0X0A, 0X06, 0X05, 0X03, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X04, 0X06, 0X09, 0X0B, 0X0D,
-  0X10, 0X11, 0X13, 0X16, 0X17, 0X18, 0X1A, 0X1B, 0X1C, 0X1E, 0X1E, 0X1F,
-  0X20, 0X21, 0X22, 0X22, 0X23, 0X23, 0X23, 0X24, 0X24, 0X24, 0X24, 0X24,
-  0X24, 0X24, 0X24, 0X23, 0X23, 0X23, 0X22, 0X22, 0X21, 0X21, 0X20, 0X1F,
-  0X1E, 0X1C, 0X1B, 0X1A, 0X19, 0X18, 0X17, 0X14, 0X13, 0X11, 0X10, 0X0D,
-  0X0B, 0X07, 0X06, 0X03, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X03, 0X05, 0X07, 0X0A, 0X0D, 0X10, 0X12, 0X14, 0X16, 0X18, 0X1A,
-  0X1B, 0X1C, 0X1E, 0X1F, 0X21, 0X22, 0X22, 0X23, 0X24, 0X24, 0X26, 0X26,
-  0X27, 0X27, 0X27, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X27,
-  0X27, 0X27, 0X27, 0X26, 0X26, 0X24, 0X24, 0X23, 0X22, 0X21, 0X20, 0X1F,
-  0X1E, 0X1C, 0X1B, 0X1A, 0X18, 0X16, 0X14, 0X12, 0X10, 0X0D, 0X0B, 0X09,
-  0X06, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X02, 0X05, 0X07, 0X0A, 0X0D,
-  0X10, 0X13, 0X16, 0X17, 0X19, 0X1B, 0X1E, 0X1F, 0X20, 0X22, 0X23, 0X24,
-  0X26, 0X27, 0X27, 0X28, 0X28, 0X29, 0X2A, 0X2A, 0X2B, 0X2B, 0X2C, 0X2C,
-  0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2B, 0X2B, 0X2B, 0X2A,
-  0X29, 0X29, 0X28, 0X28, 0X27, 0X26, 0X26, 0X24, 0X23, 0X22, 0X20, 0X1F,
-  0X1E, 0X1B, 0X1A, 0X18, 0X16, 0X13, 0X11, 0X0E, 0X0C, 0X09, 0X06, 0X03,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X04, 0X06, 0X0A, 0X0D, 0X10, 0X13, 0X16, 0X18, 0X1A, 0X1C,
-  0X1E, 0X20, 0X22, 0X23, 0X24, 0X26, 0X27, 0X28, 0X29, 0X2A, 0X2B, 0X2C,
-  0X2D, 0X2D, 0X2E, 0X2E, 0X30, 0X30, 0X30, 0X30, 0X30, 0X31, 0X31, 0X31,
-  0X31, 0X31, 0X30, 0X30, 0X30, 0X30, 0X2E, 0X2E, 0X2E, 0X2D, 0X2D, 0X2C,
-  0X2B, 0X2A, 0X29, 0X28, 0X27, 0X26, 0X26, 0X23, 0X22, 0X21, 0X1F, 0X1E,
-  0X1B, 0X19, 0X17, 0X14, 0X12, 0X10, 0X0C, 0X09, 0X06, 0X03, 0X01, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X06, 0X09, 0X0C,
-  0X10, 0X12, 0X16, 0X18, 0X1A, 0X1E, 0X20, 0X21, 0X23, 0X26, 0X27, 0X28,
-  0X29, 0X2B, 0X2C, 0X2D, 0X2E, 0X2E, 0X30, 0X31, 0X31, 0X32, 0X32, 0X33,
-  0X33, 0X33, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34, 0X34,
-  0X34, 0X33, 0X33, 0X33, 0X32, 0X32, 0X31, 0X31, 0X30, 0X30, 0X2E, 0X2D,
-  0X2C, 0X2B, 0X2A, 0X29, 0X28, 0X26, 0X24, 0X23, 0X21, 0X1F, 0X1E, 0X1A,
-  0X18, 0X16, 0X13, 0X10, 0X0C, 0X09, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X05, 0X07, 0X0B, 0X0E, 0X12, 0X16, 0X18, 0X1B, 0X1E,
-  0X20, 0X22, 0X24, 0X26, 0X28, 0X29, 0X2B, 0X2C, 0X2D, 0X2E, 0X30, 0X31,
-  0X32, 0X33, 0X33, 0X34, 0X35, 0X36, 0X36, 0X37, 0X37, 0X38, 0X38, 0X38,
-  0X38, 0X38, 0X38, 0X38, 0X38, 0X38, 0X38, 0X38, 0X38, 0X38, 0X37, 0X37,
-  0X36, 0X36, 0X35, 0X34, 0X33, 0X33, 0X32, 0X31, 0X31, 0X30, 0X2E, 0X2D,
-  0X2C, 0X2B, 0X29, 0X28, 0X26, 0X24, 0X23, 0X20, 0X1F, 0X1C, 0X19, 0X17,
-  0X13, 0X10, 0X0C, 0X07, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X06, 0X0A,
-  0X0D, 0X11, 0X14, 0X18, 0X1A, 0X1E, 0X20, 0X23, 0X26, 0X27, 0X29, 0X2A,
-  0X2C, 0X2E, 0X30, 0X31, 0X32, 0X33, 0X34, 0X35, 0X36, 0X37, 0X38, 0X39,
-  0X39, 0X3B, 0X3B, 0X3C, 0X3C, 0X3C, 0X3C, 0X3D, 0X3D, 0X3D, 0X3D, 0X3D,
-  0X3D, 0X3D, 0X3D, 0X3D, 0X3C, 0X3C, 0X3C, 0X3C, 0X3B, 0X3B, 0X39, 0X39,
-  0X38, 0X37, 0X37, 0X36, 0X35, 0X34, 0X33, 0X32, 0X31, 0X30, 0X2E, 0X2C,
-  0X2B, 0X29, 0X28, 0X26, 0X24, 0X22, 0X20, 0X1C, 0X1A, 0X17, 0X13, 0X10,
-  0X0B, 0X06, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X05, 0X09, 0X0C, 0X11, 0X14, 0X17, 0X1A, 0X1E,
-  0X20, 0X23, 0X26, 0X27, 0X29, 0X2C, 0X2D, 0X2E, 0X31, 0X32, 0X33, 0X35,
-  0X36, 0X37, 0X38, 0X39, 0X3B, 0X3C, 0X3C, 0X3D, 0X3D, 0X3E, 0X3E, 0X3F,
-  0X3F, 0X3F, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40, 0X40,
-  0X40, 0X3F, 0X3F, 0X3F, 0X3E, 0X3E, 0X3E, 0X3D, 0X3D, 0X3C, 0X3B, 0X3B,
-  0X39, 0X38, 0X37, 0X36, 0X35, 0X34, 0X33, 0X31, 0X30, 0X2E, 0X2D, 0X2B,
-  0X29, 0X28, 0X26, 0X23, 0X21, 0X1E, 0X1A, 0X17, 0X12, 0X0D, 0X09, 0X04,
-  0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X06,
-  0X0A, 0X0E, 0X13, 0X17, 0X19, 0X1E, 0X20, 0X23, 0X26, 0X28, 0X2A, 0X2C,
-  0X2E, 0X31, 0X32, 0X33, 0X35, 0X37, 0X38, 0X39, 0X3B, 0X3C, 0X3D, 0X3E,
-  0X3F, 0X3F, 0X40, 0X41, 0X41, 0X42, 0X42, 0X42, 0X43, 0X43, 0X43, 0X43,
-  0X44, 0X44, 0X44, 0X44, 0X44, 0X44, 0X44, 0X43, 0X43, 0X43, 0X43, 0X43,
-  0X42, 0X42, 0X41, 0X41, 0X40, 0X40, 0X3F, 0X3F, 0X3E, 0X3D, 0X3C, 0X3C,
-  0X3B, 0X39, 0X37, 0X36, 0X35, 0X33, 0X32, 0X31, 0X30, 0X2D, 0X2B, 0X29,
-  0X27, 0X24, 0X21, 0X1E, 0X1A, 0X16, 0X11, 0X0C, 0X06, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X07, 0X0C, 0X11, 0X16, 0X19, 0X1C,
-  0X20, 0X23, 0X26, 0X28, 0X2A, 0X2D, 0X2E, 0X31, 0X33, 0X35, 0X37, 0X38,
-  0X39, 0X3B, 0X3D, 0X3E, 0X3F, 0X40, 0X40, 0X41, 0X42, 0X43, 0X43, 0X44,
-  0X44, 0X45, 0X45, 0X46, 0X46, 0X47, 0X47, 0X47, 0X47, 0X49, 0X49, 0X49,
-  0X49, 0X49, 0X47, 0X47, 0X47, 0X47, 0X47, 0X46, 0X46, 0X45, 0X45, 0X44,
-  0X44, 0X43, 0X42, 0X42, 0X41, 0X40, 0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B,
-  0X39, 0X38, 0X37, 0X35, 0X34, 0X32, 0X31, 0X2E, 0X2C, 0X2A, 0X28, 0X24,
-  0X21, 0X1E, 0X19, 0X14, 0X10, 0X0A, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X04, 0X09, 0X0D, 0X12, 0X17, 0X1B, 0X1F, 0X22, 0X26, 0X28, 0X2A, 0X2D,
-  0X30, 0X32, 0X34, 0X36, 0X37, 0X39, 0X3C, 0X3D, 0X3E, 0X3F, 0X41, 0X42,
-  0X43, 0X43, 0X44, 0X45, 0X46, 0X47, 0X49, 0X49, 0X4A, 0X4A, 0X4B, 0X4B,
-  0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4C, 0X4D, 0X4D, 0X4D, 0X4C, 0X4C, 0X4C,
-  0X4C, 0X4C, 0X4C, 0X4B, 0X4B, 0X4B, 0X4A, 0X4A, 0X49, 0X47, 0X47, 0X46,
-  0X45, 0X44, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X3B,
-  0X39, 0X38, 0X36, 0X34, 0X32, 0X31, 0X2D, 0X2B, 0X28, 0X24, 0X21, 0X1C,
-  0X19, 0X13, 0X0C, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X0A, 0X10, 0X14, 0X19,
-  0X1E, 0X21, 0X24, 0X28, 0X2A, 0X2D, 0X30, 0X32, 0X34, 0X36, 0X38, 0X3B,
-  0X3C, 0X3E, 0X3F, 0X40, 0X42, 0X43, 0X44, 0X45, 0X46, 0X47, 0X49, 0X4A,
-  0X4B, 0X4C, 0X4C, 0X4D, 0X4D, 0X4E, 0X4E, 0X4E, 0X4F, 0X4F, 0X4F, 0X4F,
-  0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X50, 0X4F, 0X4F, 0X4F, 0X4F, 0X4F,
-  0X4E, 0X4E, 0X4E, 0X4D, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A, 0X4A, 0X49, 0X47,
-  0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3F, 0X3E, 0X3D, 0X3C, 0X39,
-  0X38, 0X36, 0X34, 0X31, 0X2E, 0X2B, 0X28, 0X24, 0X20, 0X1B, 0X16, 0X0E,
-  0X07, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X05, 0X0B, 0X11, 0X16, 0X1A, 0X1F, 0X23, 0X26, 0X29, 0X2C,
-  0X2E, 0X32, 0X34, 0X36, 0X38, 0X3B, 0X3D, 0X3E, 0X40, 0X41, 0X43, 0X44,
-  0X45, 0X47, 0X49, 0X4A, 0X4B, 0X4C, 0X4D, 0X4D, 0X4E, 0X4F, 0X4F, 0X50,
-  0X50, 0X51, 0X51, 0X52, 0X52, 0X52, 0X52, 0X53, 0X53, 0X53, 0X53, 0X53,
-  0X53, 0X53, 0X53, 0X53, 0X52, 0X52, 0X52, 0X52, 0X51, 0X51, 0X51, 0X50,
-  0X50, 0X4F, 0X4F, 0X4E, 0X4E, 0X4D, 0X4C, 0X4C, 0X4B, 0X4A, 0X49, 0X47,
-  0X46, 0X45, 0X44, 0X43, 0X42, 0X41, 0X40, 0X3E, 0X3D, 0X3C, 0X39, 0X37,
-  0X34, 0X32, 0X2E, 0X2B, 0X28, 0X23, 0X1E, 0X18, 0X11, 0X09, 0X02, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X0B, 0X12,
-  0X17, 0X1C, 0X21, 0X24, 0X29, 0X2B, 0X2E, 0X32, 0X34, 0X36, 0X39, 0X3C,
-  0X3E, 0X3F, 0X41, 0X43, 0X44, 0X46, 0X47, 0X4A, 0X4B, 0X4C, 0X4D, 0X4E,
-  0X4F, 0X50, 0X51, 0X51, 0X52, 0X52, 0X53, 0X54, 0X54, 0X55, 0X55, 0X55,
-  0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56, 0X56,
-  0X56, 0X56, 0X56, 0X55, 0X55, 0X55, 0X54, 0X54, 0X54, 0X53, 0X53, 0X52,
-  0X52, 0X51, 0X50, 0X50, 0X4F, 0X4E, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49,
-  0X46, 0X45, 0X44, 0X43, 0X42, 0X40, 0X3F, 0X3D, 0X3B, 0X37, 0X35, 0X32,
-  0X2E, 0X2B, 0X27, 0X21, 0X1A, 0X13, 0X0B, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X06, 0X0C, 0X13, 0X19, 0X1E, 0X23, 0X27, 0X2A,
-  0X2E, 0X31, 0X34, 0X37, 0X39, 0X3C, 0X3E, 0X40, 0X41, 0X43, 0X45, 0X47,
-  0X49, 0X4B, 0X4C, 0X4D, 0X4E, 0X4F, 0X50, 0X51, 0X52, 0X53, 0X54, 0X55,
-  0X55, 0X56, 0X56, 0X57, 0X57, 0X59, 0X59, 0X59, 0X5A, 0X5A, 0X5A, 0X5A,
-  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X5A,
-  0X59, 0X59, 0X59, 0X57, 0X57, 0X57, 0X56, 0X55, 0X55, 0X54, 0X54, 0X53,
-  0X52, 0X52, 0X51, 0X50, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4B, 0X4A, 0X49,
-  0X46, 0X45, 0X43, 0X42, 0X40, 0X3E, 0X3C, 0X39, 0X35, 0X32, 0X2E, 0X29,
-  0X23, 0X1E, 0X16, 0X0C, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X0D, 0X13, 0X1A, 0X1F, 0X24, 0X28, 0X2C, 0X31, 0X34, 0X36, 0X39, 0X3C,
-  0X3E, 0X40, 0X42, 0X44, 0X46, 0X49, 0X4B, 0X4C, 0X4E, 0X4F, 0X50, 0X51,
-  0X52, 0X53, 0X54, 0X55, 0X56, 0X57, 0X59, 0X59, 0X5A, 0X5B, 0X5B, 0X5C,
-  0X5C, 0X5C, 0X5D, 0X5D, 0X5D, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E,
-  0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5E, 0X5D, 0X5D, 0X5D, 0X5C, 0X5C,
-  0X5C, 0X5B, 0X5B, 0X5A, 0X5A, 0X59, 0X59, 0X57, 0X57, 0X56, 0X55, 0X54,
-  0X54, 0X53, 0X52, 0X51, 0X50, 0X50, 0X4F, 0X4E, 0X4D, 0X4C, 0X4A, 0X47,
-  0X45, 0X43, 0X41, 0X3F, 0X3C, 0X39, 0X35, 0X32, 0X2C, 0X27, 0X20, 0X18,
-  0X0E, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X04, 0X0C, 0X14, 0X1A, 0X21, 0X26,
-  0X2A, 0X2E, 0X32, 0X36, 0X39, 0X3C, 0X3E, 0X41, 0X42, 0X45, 0X47, 0X4A,
-  0X4B, 0X4D, 0X4E, 0X50, 0X51, 0X53, 0X54, 0X55, 0X56, 0X57, 0X59, 0X5A,
-  0X5B, 0X5B, 0X5C, 0X5D, 0X5D, 0X5E, 0X5E, 0X5F, 0X5F, 0X60, 0X60, 0X60,
-  0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61,
-  0X61, 0X61, 0X61, 0X61, 0X60, 0X60, 0X60, 0X5F, 0X5F, 0X5F, 0X5E, 0X5E,
-  0X5D, 0X5D, 0X5C, 0X5B, 0X5B, 0X5A, 0X5A, 0X59, 0X57, 0X56, 0X56, 0X55,
-  0X54, 0X54, 0X53, 0X52, 0X51, 0X50, 0X4F, 0X4D, 0X4C, 0X4A, 0X47, 0X45,
-  0X42, 0X40, 0X3D, 0X38, 0X34, 0X30, 0X29, 0X22, 0X1A, 0X0E, 0X04, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X03, 0X0C, 0X14, 0X1B, 0X22, 0X27, 0X2C, 0X31, 0X34, 0X38, 0X3C,
-  0X3F, 0X41, 0X43, 0X45, 0X47, 0X4B, 0X4C, 0X4E, 0X50, 0X51, 0X53, 0X54,
-  0X55, 0X57, 0X59, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E, 0X5E, 0X5F, 0X60, 0X60,
-  0X61, 0X62, 0X62, 0X63, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X65, 0X65,
-  0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X65, 0X64, 0X64,
-  0X64, 0X64, 0X63, 0X63, 0X63, 0X62, 0X62, 0X61, 0X61, 0X61, 0X60, 0X5F,
-  0X5F, 0X5E, 0X5E, 0X5D, 0X5C, 0X5C, 0X5B, 0X5A, 0X59, 0X59, 0X57, 0X56,
-  0X55, 0X55, 0X53, 0X52, 0X51, 0X4F, 0X4D, 0X4C, 0X49, 0X46, 0X43, 0X40,
-  0X3D, 0X37, 0X33, 0X2C, 0X24, 0X1B, 0X11, 0X03, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X0B, 0X14, 0X1C,
-  0X23, 0X28, 0X2D, 0X32, 0X36, 0X3B, 0X3E, 0X40, 0X43, 0X45, 0X49, 0X4B,
-  0X4D, 0X4F, 0X50, 0X52, 0X54, 0X55, 0X56, 0X59, 0X5A, 0X5B, 0X5C, 0X5D,
-  0X5E, 0X5F, 0X60, 0X61, 0X62, 0X62, 0X63, 0X64, 0X64, 0X65, 0X65, 0X66,
-  0X66, 0X67, 0X67, 0X67, 0X67, 0X68, 0X68, 0X68, 0X68, 0X68, 0X68, 0X68,
-  0X68, 0X68, 0X68, 0X68, 0X68, 0X68, 0X68, 0X67, 0X67, 0X67, 0X67, 0X66,
-  0X66, 0X66, 0X65, 0X65, 0X64, 0X64, 0X63, 0X63, 0X62, 0X62, 0X61, 0X61,
-  0X60, 0X5F, 0X5F, 0X5E, 0X5D, 0X5D, 0X5C, 0X5B, 0X5B, 0X5A, 0X59, 0X57,
-  0X56, 0X54, 0X53, 0X51, 0X4F, 0X4D, 0X4B, 0X46, 0X43, 0X3F, 0X3B, 0X35,
-  0X2E, 0X27, 0X1E, 0X10, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X09, 0X13, 0X1C, 0X23, 0X2A, 0X2E, 0X34, 0X38,
-  0X3D, 0X40, 0X43, 0X45, 0X49, 0X4C, 0X4E, 0X50, 0X51, 0X53, 0X55, 0X56,
-  0X59, 0X5A, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63, 0X64, 0X65,
-  0X66, 0X66, 0X67, 0X68, 0X68, 0X69, 0X69, 0X6A, 0X6A, 0X6A, 0X6B, 0X6B,
-  0X6B, 0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6A, 0X6A, 0X6A, 0X69, 0X69, 0X69,
-  0X68, 0X68, 0X67, 0X67, 0X66, 0X66, 0X65, 0X65, 0X64, 0X63, 0X63, 0X62,
-  0X62, 0X61, 0X60, 0X60, 0X5F, 0X5E, 0X5E, 0X5D, 0X5B, 0X5A, 0X59, 0X56,
-  0X54, 0X52, 0X50, 0X4E, 0X4B, 0X46, 0X42, 0X3E, 0X38, 0X31, 0X29, 0X1E,
-  0X0E, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X11, 0X1B, 0X24, 0X2A, 0X31, 0X35, 0X3B, 0X3E, 0X42, 0X44, 0X49, 0X4C,
-  0X4E, 0X50, 0X52, 0X54, 0X56, 0X57, 0X5A, 0X5B, 0X5D, 0X5E, 0X5F, 0X61,
-  0X62, 0X63, 0X64, 0X65, 0X66, 0X67, 0X68, 0X68, 0X69, 0X6A, 0X6A, 0X6B,
-  0X6B, 0X6C, 0X6C, 0X6D, 0X6D, 0X6E, 0X6E, 0X6E, 0X6E, 0X70, 0X70, 0X70,
-  0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X6E, 0X6E,
-  0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B, 0X6B, 0X6A,
-  0X6A, 0X69, 0X69, 0X68, 0X68, 0X67, 0X67, 0X66, 0X65, 0X65, 0X64, 0X64,
-  0X63, 0X63, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5D, 0X5B, 0X59, 0X56, 0X54,
-  0X52, 0X4E, 0X4B, 0X46, 0X41, 0X3B, 0X34, 0X2A, 0X1E, 0X0C, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X10, 0X1A, 0X23, 0X2B, 0X31,
-  0X37, 0X3C, 0X40, 0X43, 0X47, 0X4B, 0X4E, 0X50, 0X53, 0X55, 0X57, 0X5A,
-  0X5B, 0X5D, 0X5E, 0X60, 0X61, 0X62, 0X64, 0X65, 0X66, 0X67, 0X68, 0X69,
-  0X6A, 0X6B, 0X6C, 0X6C, 0X6D, 0X6E, 0X6E, 0X70, 0X70, 0X71, 0X71, 0X71,
-  0X72, 0X72, 0X72, 0X73, 0X73, 0X73, 0X73, 0X73, 0X73, 0X74, 0X74, 0X74,
-  0X74, 0X74, 0X74, 0X73, 0X73, 0X73, 0X73, 0X73, 0X73, 0X72, 0X72, 0X72,
-  0X72, 0X71, 0X71, 0X71, 0X70, 0X70, 0X70, 0X6E, 0X6E, 0X6D, 0X6D, 0X6C,
-  0X6C, 0X6B, 0X6B, 0X6A, 0X6A, 0X69, 0X69, 0X68, 0X68, 0X67, 0X66, 0X66,
-  0X65, 0X64, 0X63, 0X61, 0X60, 0X5E, 0X5D, 0X5B, 0X57, 0X55, 0X52, 0X4E,
-  0X4A, 0X44, 0X3E, 0X35, 0X2B, 0X1C, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X0C, 0X18, 0X22, 0X2B, 0X32, 0X38, 0X3E, 0X41, 0X45, 0X4A,
-  0X4D, 0X50, 0X53, 0X55, 0X57, 0X5A, 0X5C, 0X5E, 0X5F, 0X61, 0X62, 0X64,
-  0X65, 0X66, 0X67, 0X69, 0X6A, 0X6B, 0X6C, 0X6C, 0X6D, 0X6E, 0X70, 0X71,
-  0X71, 0X72, 0X72, 0X73, 0X74, 0X74, 0X74, 0X75, 0X75, 0X75, 0X76, 0X76,
-  0X76, 0X76, 0X76, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77, 0X77,
-  0X77, 0X76, 0X76, 0X76, 0X76, 0X76, 0X75, 0X75, 0X75, 0X75, 0X74, 0X74,
-  0X74, 0X73, 0X73, 0X72, 0X72, 0X72, 0X71, 0X71, 0X70, 0X70, 0X6E, 0X6E,
-  0X6D, 0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6B, 0X6A, 0X69, 0X69, 0X68, 0X67,
-  0X66, 0X64, 0X63, 0X61, 0X5F, 0X5C, 0X5A, 0X55, 0X51, 0X4D, 0X46, 0X40,
-  0X37, 0X2A, 0X19, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X16, 0X20,
-  0X29, 0X32, 0X38, 0X3E, 0X42, 0X46, 0X4C, 0X4F, 0X52, 0X54, 0X57, 0X5A,
-  0X5C, 0X5E, 0X60, 0X62, 0X63, 0X65, 0X66, 0X67, 0X69, 0X6A, 0X6B, 0X6C,
-  0X6D, 0X6E, 0X70, 0X71, 0X72, 0X72, 0X73, 0X74, 0X75, 0X75, 0X76, 0X76,
-  0X77, 0X77, 0X78, 0X78, 0X78, 0X79, 0X79, 0X79, 0X79, 0X79, 0X7A, 0X7A,
-  0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X7A, 0X79, 0X79,
-  0X79, 0X79, 0X79, 0X78, 0X78, 0X78, 0X77, 0X77, 0X77, 0X76, 0X76, 0X76,
-  0X75, 0X75, 0X75, 0X74, 0X74, 0X73, 0X73, 0X72, 0X72, 0X72, 0X71, 0X71,
-  0X71, 0X70, 0X70, 0X6E, 0X6E, 0X6D, 0X6C, 0X6B, 0X6A, 0X69, 0X68, 0X66,
-  0X64, 0X62, 0X5F, 0X5C, 0X59, 0X54, 0X50, 0X4A, 0X41, 0X36, 0X28, 0X11,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X04, 0X12, 0X1F, 0X29, 0X31, 0X38, 0X3F, 0X44,
-  0X49, 0X4D, 0X51, 0X54, 0X57, 0X5A, 0X5D, 0X5F, 0X61, 0X63, 0X65, 0X66,
-  0X68, 0X69, 0X6A, 0X6C, 0X6D, 0X6E, 0X70, 0X71, 0X72, 0X73, 0X74, 0X75,
-  0X76, 0X76, 0X77, 0X78, 0X79, 0X79, 0X7A, 0X7A, 0X7B, 0X7B, 0X7B, 0X7C,
-  0X7C, 0X7C, 0X7C, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D,
-  0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C,
-  0X7C, 0X7B, 0X7B, 0X7B, 0X7B, 0X7A, 0X7A, 0X7A, 0X79, 0X79, 0X79, 0X78,
-  0X78, 0X77, 0X77, 0X77, 0X76, 0X76, 0X75, 0X75, 0X75, 0X75, 0X74, 0X74,
-  0X73, 0X73, 0X72, 0X71, 0X70, 0X6E, 0X6D, 0X6B, 0X6A, 0X68, 0X66, 0X63,
-  0X60, 0X5D, 0X59, 0X53, 0X4C, 0X42, 0X36, 0X23, 0X06, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01,
-  0X0D, 0X1B, 0X27, 0X31, 0X38, 0X40, 0X45, 0X4B, 0X4F, 0X53, 0X56, 0X5A,
-  0X5D, 0X5F, 0X61, 0X64, 0X66, 0X67, 0X69, 0X6A, 0X6C, 0X6D, 0X6E, 0X71,
-  0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X78, 0X79, 0X7A, 0X7B, 0X7B,
-  0X7C, 0X7C, 0X7D, 0X7D, 0X7E, 0X7E, 0X7F, 0X7F, 0X7F, 0X80, 0X80, 0X80,
-  0X80, 0X80, 0X80, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81,
-  0X80, 0X80, 0X80, 0X80, 0X80, 0X80, 0X7F, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E,
-  0X7E, 0X7E, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7C, 0X7B, 0X7B, 0X7B, 0X7A,
-  0X7A, 0X7A, 0X79, 0X79, 0X79, 0X79, 0X78, 0X78, 0X78, 0X77, 0X77, 0X76,
-  0X75, 0X74, 0X73, 0X72, 0X71, 0X6E, 0X6C, 0X6A, 0X67, 0X64, 0X60, 0X5C,
-  0X55, 0X4E, 0X43, 0X34, 0X1B, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X18, 0X24, 0X30, 0X38,
-  0X40, 0X46, 0X4C, 0X50, 0X54, 0X59, 0X5C, 0X5F, 0X62, 0X64, 0X66, 0X68,
-  0X6A, 0X6C, 0X6E, 0X70, 0X71, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79,
-  0X7A, 0X7B, 0X7C, 0X7D, 0X7D, 0X7E, 0X7F, 0X7F, 0X80, 0X80, 0X81, 0X81,
-  0X82, 0X82, 0X82, 0X82, 0X83, 0X83, 0X83, 0X83, 0X83, 0X83, 0X83, 0X84,
-  0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X83, 0X83, 0X83, 0X83, 0X83,
-  0X83, 0X83, 0X83, 0X83, 0X82, 0X82, 0X82, 0X82, 0X82, 0X81, 0X81, 0X81,
-  0X81, 0X80, 0X80, 0X80, 0X7F, 0X7F, 0X7F, 0X7E, 0X7E, 0X7E, 0X7E, 0X7D,
-  0X7D, 0X7D, 0X7D, 0X7D, 0X7C, 0X7C, 0X7B, 0X7B, 0X7A, 0X79, 0X78, 0X77,
-  0X76, 0X75, 0X73, 0X71, 0X6E, 0X6B, 0X68, 0X64, 0X5F, 0X59, 0X50, 0X42,
-  0X2E, 0X0A, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X05, 0X14, 0X22, 0X2D, 0X37, 0X3F, 0X46, 0X4E, 0X52, 0X56,
-  0X5B, 0X5E, 0X62, 0X64, 0X67, 0X69, 0X6B, 0X6D, 0X70, 0X71, 0X73, 0X74,
-  0X75, 0X77, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7D, 0X7E, 0X7F, 0X7F, 0X80,
-  0X81, 0X81, 0X82, 0X82, 0X83, 0X83, 0X83, 0X84, 0X84, 0X84, 0X85, 0X85,
-  0X85, 0X85, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86,
-  0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X86, 0X85, 0X85,
-  0X85, 0X85, 0X84, 0X84, 0X84, 0X84, 0X84, 0X83, 0X83, 0X83, 0X83, 0X83,
-  0X82, 0X82, 0X82, 0X82, 0X82, 0X82, 0X81, 0X81, 0X81, 0X81, 0X81, 0X81,
-  0X81, 0X80, 0X80, 0X80, 0X7F, 0X7E, 0X7E, 0X7D, 0X7C, 0X7B, 0X79, 0X78,
-  0X75, 0X73, 0X70, 0X6C, 0X68, 0X62, 0X5B, 0X50, 0X40, 0X22, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X10, 0X1F,
-  0X2B, 0X36, 0X3F, 0X46, 0X4E, 0X53, 0X59, 0X5D, 0X60, 0X63, 0X66, 0X69,
-  0X6B, 0X6E, 0X71, 0X73, 0X74, 0X76, 0X78, 0X79, 0X7A, 0X7B, 0X7C, 0X7D,
-  0X7E, 0X7F, 0X80, 0X81, 0X82, 0X83, 0X83, 0X83, 0X84, 0X84, 0X85, 0X86,
-  0X86, 0X87, 0X87, 0X87, 0X88, 0X88, 0X88, 0X89, 0X89, 0X89, 0X89, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X87, 0X87, 0X87, 0X87, 0X86, 0X86, 0X86, 0X86, 0X85, 0X85,
-  0X85, 0X85, 0X85, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84, 0X84,
-  0X83, 0X83, 0X83, 0X82, 0X81, 0X80, 0X7F, 0X7E, 0X7C, 0X7A, 0X78, 0X75,
-  0X71, 0X6C, 0X65, 0X5D, 0X4F, 0X38, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X0D, 0X1B, 0X29, 0X34, 0X3E, 0X46, 0X4E,
-  0X54, 0X5A, 0X5F, 0X63, 0X66, 0X69, 0X6C, 0X6E, 0X72, 0X74, 0X76, 0X77,
-  0X79, 0X7A, 0X7C, 0X7D, 0X7E, 0X7F, 0X80, 0X82, 0X82, 0X83, 0X83, 0X84,
-  0X85, 0X86, 0X86, 0X87, 0X87, 0X88, 0X89, 0X89, 0X8A, 0X8A, 0X8A, 0X8B,
-  0X8B, 0X8B, 0X8C, 0X8C, 0X8C, 0X8C, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8C, 0X8C, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8B, 0X8B, 0X8B, 0X8A,
-  0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X89, 0X89, 0X89, 0X89, 0X88, 0X88, 0X88,
-  0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X88, 0X87, 0X87, 0X86,
-  0X86, 0X85, 0X84, 0X83, 0X82, 0X81, 0X7F, 0X7D, 0X7A, 0X76, 0X70, 0X68,
-  0X5D, 0X4B, 0X23, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X09, 0X19, 0X27, 0X32, 0X3D, 0X46, 0X4F, 0X55, 0X5B, 0X60, 0X64, 0X68,
-  0X6B, 0X6E, 0X72, 0X74, 0X76, 0X78, 0X7A, 0X7C, 0X7E, 0X7F, 0X81, 0X81,
-  0X82, 0X83, 0X84, 0X85, 0X86, 0X87, 0X87, 0X88, 0X89, 0X8A, 0X8A, 0X8B,
-  0X8C, 0X8C, 0X8D, 0X8D, 0X8E, 0X8E, 0X8E, 0X8F, 0X8F, 0X8F, 0X8F, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X91, 0X91, 0X91, 0X91, 0X91, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X91, 0X91, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90, 0X90,
-  0X90, 0X8F, 0X8F, 0X8F, 0X8F, 0X8F, 0X8E, 0X8E, 0X8E, 0X8E, 0X8E, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D, 0X8D,
-  0X8D, 0X8D, 0X8D, 0X8D, 0X8C, 0X8C, 0X8C, 0X8B, 0X8B, 0X8A, 0X8A, 0X89,
-  0X88, 0X87, 0X85, 0X84, 0X81, 0X7E, 0X7A, 0X74, 0X6A, 0X5C, 0X3E, 0X03,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X16, 0X24, 0X30, 0X3C,
-  0X45, 0X4E, 0X55, 0X5D, 0X62, 0X66, 0X6A, 0X6E, 0X72, 0X75, 0X77, 0X79,
-  0X7C, 0X7D, 0X7F, 0X81, 0X82, 0X83, 0X84, 0X85, 0X86, 0X87, 0X88, 0X89,
-  0X8A, 0X8B, 0X8B, 0X8C, 0X8D, 0X8D, 0X8E, 0X8E, 0X8F, 0X90, 0X90, 0X90,
-  0X91, 0X91, 0X92, 0X92, 0X92, 0X93, 0X93, 0X93, 0X93, 0X93, 0X94, 0X94,
-  0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94,
-  0X94, 0X94, 0X94, 0X94, 0X93, 0X93, 0X93, 0X93, 0X93, 0X93, 0X92, 0X92,
-  0X92, 0X92, 0X92, 0X92, 0X91, 0X91, 0X91, 0X91, 0X91, 0X91, 0X90, 0X90,
-  0X90, 0X90, 0X90, 0X90, 0X90, 0X91, 0X91, 0X91, 0X91, 0X91, 0X91, 0X91,
-  0X91, 0X91, 0X91, 0X91, 0X91, 0X90, 0X90, 0X8F, 0X8E, 0X8D, 0X8C, 0X8A,
-  0X88, 0X86, 0X83, 0X7F, 0X77, 0X6B, 0X54, 0X14, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X03, 0X13, 0X22, 0X2E, 0X39, 0X44, 0X4E, 0X55, 0X5D, 0X63,
-  0X68, 0X6C, 0X71, 0X74, 0X77, 0X7A, 0X7C, 0X7E, 0X80, 0X82, 0X84, 0X85,
-  0X86, 0X87, 0X89, 0X8A, 0X8A, 0X8C, 0X8C, 0X8D, 0X8E, 0X8F, 0X8F, 0X90,
-  0X91, 0X91, 0X92, 0X93, 0X93, 0X94, 0X94, 0X94, 0X95, 0X95, 0X96, 0X96,
-  0X96, 0X96, 0X96, 0X96, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97,
-  0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97,
-  0X97, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X94, 0X94, 0X94, 0X94, 0X95,
-  0X95, 0X95, 0X95, 0X95, 0X95, 0X95, 0X96, 0X96, 0X96, 0X96, 0X96, 0X96,
-  0X95, 0X95, 0X95, 0X94, 0X94, 0X93, 0X93, 0X92, 0X90, 0X8E, 0X8B, 0X87,
-  0X82, 0X7A, 0X68, 0X32, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X10, 0X20,
-  0X2D, 0X39, 0X43, 0X4D, 0X55, 0X5D, 0X63, 0X69, 0X6E, 0X73, 0X77, 0X7A,
-  0X7D, 0X7F, 0X82, 0X83, 0X85, 0X86, 0X88, 0X89, 0X8B, 0X8C, 0X8D, 0X8E,
-  0X8F, 0X90, 0X90, 0X91, 0X92, 0X93, 0X93, 0X94, 0X95, 0X95, 0X96, 0X96,
-  0X96, 0X97, 0X97, 0X97, 0X98, 0X98, 0X98, 0X98, 0X98, 0X99, 0X99, 0X99,
-  0X99, 0X99, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X99, 0X99, 0X99, 0X99, 0X99, 0X99,
-  0X99, 0X99, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X97, 0X98, 0X98, 0X98, 0X98, 0X98,
-  0X99, 0X99, 0X99, 0X99, 0X99, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X99, 0X99, 0X98, 0X98, 0X97, 0X96, 0X94, 0X91, 0X8D, 0X86, 0X7A, 0X53,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X0D, 0X1C, 0X2A, 0X36, 0X42, 0X4C, 0X54,
-  0X5D, 0X63, 0X6A, 0X70, 0X75, 0X79, 0X7C, 0X7F, 0X82, 0X83, 0X85, 0X87,
-  0X89, 0X8B, 0X8C, 0X8D, 0X8F, 0X90, 0X91, 0X92, 0X93, 0X94, 0X94, 0X95,
-  0X96, 0X96, 0X97, 0X97, 0X97, 0X98, 0X98, 0X99, 0X99, 0X9A, 0X9A, 0X9A,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9D, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9C, 0X9B,
-  0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9A, 0X9A, 0X9A, 0X9A,
-  0X9A, 0X9B, 0X9B, 0X9B, 0X9B, 0X9B, 0X9C, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D,
-  0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9E,
-  0X9D, 0X9C, 0X9B, 0X99, 0X96, 0X92, 0X89, 0X6E, 0X00, 0X00, 0X00, 0X01,
-  0X0C, 0X1B, 0X29, 0X35, 0X41, 0X4C, 0X54, 0X5D, 0X64, 0X6B, 0X71, 0X76,
-  0X7B, 0X7E, 0X81, 0X84, 0X86, 0X88, 0X8A, 0X8C, 0X8E, 0X8F, 0X91, 0X92,
-  0X94, 0X95, 0X95, 0X96, 0X97, 0X97, 0X98, 0X99, 0X99, 0X9A, 0X9A, 0X9B,
-  0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9E, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0X9F,
-  0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA1, 0XA1, 0XA1, 0XA1,
-  0XA1, 0XA1, 0XA1, 0XA1, 0XA1, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0, 0XA0,
-  0XA0, 0XA0, 0XA0, 0XA0, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F, 0X9F,
-  0X9F, 0X9F, 0X9F, 0X9E, 0X9E, 0X9E, 0X9E, 0X9E, 0X9F, 0X9F, 0X9F, 0X9F,
-  0X9F, 0XA0, 0XA0, 0XA0, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA3, 0XA3, 0XA2,
-  0XA0, 0X9D, 0X97, 0X87, 0X00, 0X00, 0X00, 0X0B, 0X1A, 0X28, 0X34, 0X40,
-  0X4B, 0X54, 0X5D, 0X64, 0X6B, 0X73, 0X78, 0X7D, 0X81, 0X84, 0X87, 0X8A,
-  0X8C, 0X8E, 0X90, 0X92, 0X93, 0X95, 0X96, 0X96, 0X97, 0X98, 0X99, 0X9A,
-  0X9B, 0X9B, 0X9C, 0X9D, 0X9D, 0X9E, 0X9E, 0X9F, 0X9F, 0XA0, 0XA0, 0XA0,
-  0XA1, 0XA1, 0XA1, 0XA2, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3, 0XA3,
-  0XA3, 0XA3, 0XA3, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2,
-  0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA3, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA7, 0XA7, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9, 0XAA,
-  0XAA, 0XAA, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAA, 0XA9, 0XA5, 0X9C,
-  0X00, 0X00, 0X07, 0X1A, 0X28, 0X34, 0X40, 0X4B, 0X54, 0X5D, 0X65, 0X6C,
-  0X74, 0X7A, 0X7F, 0X83, 0X86, 0X8A, 0X8C, 0X8F, 0X91, 0X93, 0X95, 0X96,
-  0X98, 0X99, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E, 0X9E, 0X9F, 0XA0, 0XA0, 0XA1,
-  0XA2, 0XA2, 0XA2, 0XA3, 0XA3, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7,
-  0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA7, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA7, 0XA7, 0XA7, 0XA7, 0XA8, 0XA8, 0XA9, 0XA9, 0XAA, 0XAA, 0XAB,
-  0XAB, 0XAC, 0XAC, 0XAD, 0XAD, 0XAE, 0XAE, 0XAF, 0XAF, 0XB0, 0XB0, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB3, 0XB3, 0XB3, 0XB3, 0XB0, 0X00, 0X02, 0X18, 0X28,
-  0X34, 0X40, 0X4B, 0X54, 0X5E, 0X66, 0X6D, 0X75, 0X7B, 0X81, 0X85, 0X89,
-  0X8C, 0X90, 0X92, 0X95, 0X96, 0X98, 0X9A, 0X9B, 0X9C, 0X9D, 0X9F, 0XA0,
-  0XA1, 0XA1, 0XA2, 0XA3, 0XA3, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA7, 0XA7,
-  0XA7, 0XA8, 0XA8, 0XA8, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XAA, 0XAA, 0XAA,
-  0XAA, 0XAA, 0XAA, 0XAA, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB,
-  0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAB, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA,
-  0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XAA, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9,
-  0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XA9, 0XAA, 0XAA, 0XAA, 0XAA, 0XAB,
-  0XAB, 0XAB, 0XAC, 0XAD, 0XAD, 0XAE, 0XAE, 0XAF, 0XB0, 0XB0, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB3, 0XB3, 0XB3, 0XB4, 0XB5, 0XB6, 0XB6, 0XB7, 0XB8, 0XB9,
-  0XBA, 0XBC, 0XBD, 0XBF, 0X00, 0X10, 0X27, 0X35, 0X40, 0X4B, 0X54, 0X5E,
-  0X67, 0X6E, 0X76, 0X7C, 0X82, 0X87, 0X8B, 0X8F, 0X92, 0X95, 0X98, 0X99,
-  0X9B, 0X9D, 0X9E, 0XA0, 0XA1, 0XA2, 0XA3, 0XA5, 0XA5, 0XA5, 0XA7, 0XA8,
-  0XA8, 0XA9, 0XA9, 0XAA, 0XAA, 0XAA, 0XAB, 0XAB, 0XAB, 0XAC, 0XAC, 0XAC,
-  0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE,
-  0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE,
-  0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAE, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD, 0XAD,
-  0XAD, 0XAD, 0XAD, 0XAE, 0XAE, 0XAE, 0XAE, 0XAF, 0XAF, 0XB0, 0XB0, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB5, 0XB6, 0XB7, 0XB7,
-  0XB8, 0XB9, 0XBA, 0XBB, 0XBC, 0XBE, 0XBF, 0XC1, 0XC3, 0XC5, 0XC8, 0XCE,
-  0X02, 0X20, 0X34, 0X41, 0X4C, 0X55, 0X5F, 0X67, 0X70, 0X78, 0X7E, 0X83,
-  0X88, 0X8D, 0X92, 0X95, 0X98, 0X9B, 0X9D, 0X9F, 0XA1, 0XA3, 0XA5, 0XA5,
-  0XA7, 0XA7, 0XA8, 0XA9, 0XAA, 0XAB, 0XAB, 0XAC, 0XAC, 0XAD, 0XAD, 0XAE,
-  0XAE, 0XAE, 0XAF, 0XAF, 0XAF, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB0, 0XB0, 0XB0, 0XB0,
-  0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1,
-  0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB5, 0XB5,
-  0XB6, 0XB7, 0XB8, 0XB9, 0XBA, 0XBB, 0XBB, 0XBC, 0XBD, 0XBE, 0XBF, 0XC1,
-  0XC2, 0XC4, 0XC5, 0XC8, 0XCA, 0XCE, 0XD2, 0XDB, 0X0E, 0X2E, 0X41, 0X4E,
-  0X57, 0X60, 0X69, 0X71, 0X79, 0X80, 0X85, 0X8B, 0X90, 0X94, 0X98, 0X9B,
-  0X9E, 0XA0, 0XA3, 0XA5, 0XA7, 0XA8, 0XA9, 0XAA, 0XAB, 0XAC, 0XAD, 0XAE,
-  0XAF, 0XAF, 0XB0, 0XB0, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1, 0XB1,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3,
-  0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB3, 0XB4, 0XB4, 0XB4,
-  0XB5, 0XB6, 0XB6, 0XB7, 0XB8, 0XB8, 0XB9, 0XBA, 0XBB, 0XBB, 0XBC, 0XBD,
-  0XBE, 0XBE, 0XC0, 0XC1, 0XC2, 0XC3, 0XC5, 0XC6, 0XC8, 0XCA, 0XCC, 0XCE,
-  0XD2, 0XD6, 0XDC, 0XE7, 0X20, 0X3D, 0X4D, 0X59, 0X62, 0X6A, 0X73, 0X7A,
-  0X81, 0X87, 0X8D, 0X92, 0X97, 0X9A, 0X9E, 0XA1, 0XA5, 0XA7, 0XA9, 0XAB,
-  0XAC, 0XAD, 0XAF, 0XB0, 0XB1, 0XB1, 0XB1, 0XB1, 0XB3, 0XB3, 0XB3, 0XB3,
-  0XB3, 0XB4, 0XB4, 0XB4, 0XB4, 0XB5, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB7, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB6, 0XB5, 0XB5,
-  0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB5, 0XB6, 0XB6,
-  0XB6, 0XB6, 0XB6, 0XB6, 0XB7, 0XB7, 0XB8, 0XB8, 0XB9, 0XB9, 0XBA, 0XBB,
-  0XBB, 0XBC, 0XBC, 0XBD, 0XBE, 0XBF, 0XC0, 0XC1, 0XC2, 0XC3, 0XC5, 0XC5,
-  0XC7, 0XC8, 0XCA, 0XCC, 0XCD, 0XCF, 0XD2, 0XD5, 0XD8, 0XDE, 0XE5, 0XF1,
-  0X31, 0X4A, 0X5A, 0X64, 0X6C, 0X75, 0X7C, 0X83, 0X89, 0X8F, 0X94, 0X99,
-  0X9D, 0XA1, 0XA5, 0XA8, 0XAA, 0XAD, 0XAE, 0XB0, 0XB1, 0XB1, 0XB3, 0XB3,
-  0XB3, 0XB4, 0XB5, 0XB6, 0XB6, 0XB7, 0XB7, 0XB7, 0XB8, 0XB8, 0XB8, 0XB9,
-  0XB9, 0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBB, 0XBB, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA, 0XBA,
-  0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9,
-  0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XB9, 0XBA, 0XBA, 0XBA, 0XBA, 0XBB,
-  0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBD, 0XBD, 0XBE, 0XBF, 0XC0, 0XC0, 0XC1,
-  0XC2, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC8, 0XCA, 0XCB, 0XCD, 0XCF, 0XD1,
-  0XD2, 0XD5, 0XD7, 0XDB, 0XDF, 0XE5, 0XED, 0XFA, 0X40, 0X56, 0X65, 0X6E,
-  0X77, 0X7F, 0X85, 0X8B, 0X92, 0X97, 0X9C, 0XA0, 0XA5, 0XA8, 0XAB, 0XAE,
-  0XB1, 0XB1, 0XB3, 0XB4, 0XB5, 0XB6, 0XB7, 0XB8, 0XB9, 0XB9, 0XBA, 0XBA,
-  0XBB, 0XBB, 0XBB, 0XBB, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD, 0XBD,
-  0XBD, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBC,
-  0XBC, 0XBC, 0XBC, 0XBC, 0XBC, 0XBD, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBF,
-  0XBF, 0XC0, 0XC1, 0XC2, 0XC2, 0XC3, 0XC4, 0XC5, 0XC6, 0XC7, 0XC8, 0XC9,
-  0XCA, 0XCC, 0XCD, 0XCE, 0XD0, 0XD1, 0XD3, 0XD6, 0XD7, 0XDA, 0XDE, 0XE1,
-  0XE6, 0XEC, 0XF4, 0XFE, 0X4D, 0X62, 0X70, 0X79, 0X80, 0X87, 0X8D, 0X94,
-  0X99, 0X9E, 0XA2, 0XA7, 0XAB, 0XAF, 0XB1, 0XB3, 0XB4, 0XB6, 0XB8, 0XB9,
-  0XBA, 0XBB, 0XBB, 0XBC, 0XBD, 0XBD, 0XBD, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF, 0XBE, 0XBE, 0XBE, 0XBE,
-  0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBE, 0XBF, 0XBF, 0XBF, 0XBF, 0XBF,
-  0XBF, 0XC0, 0XC0, 0XC0, 0XC1, 0XC1, 0XC2, 0XC2, 0XC3, 0XC4, 0XC4, 0XC5,
-  0XC6, 0XC6, 0XC7, 0XC8, 0XC9, 0XCA, 0XCC, 0XCD, 0XCE, 0XCF, 0XD1, 0XD2,
-  0XD4, 0XD6, 0XD7, 0XDA, 0XDC, 0XDF, 0XE2, 0XE7, 0XEB, 0XF1, 0XFB, 0XFF,
-  0X5B, 0X6E, 0X7B, 0X83, 0X8A, 0X90, 0X96, 0X9C, 0XA2, 0XA7, 0XAB, 0XAF,
-  0XB1, 0XB4, 0XB6, 0XB9, 0XBA, 0XBC, 0XBD, 0XBE, 0XBE, 0XBF, 0XC0, 0XC1,
-  0XC1, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4,
-  0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4,
-  0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC4, 0XC3,
-  0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC3, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC2,
-  0XC2, 0XC2, 0XC2, 0XC2, 0XC2, 0XC3, 0XC3, 0XC3, 0XC3, 0XC4, 0XC4, 0XC4,
-  0XC5, 0XC5, 0XC5, 0XC6, 0XC6, 0XC7, 0XC7, 0XC8, 0XC9, 0XCA, 0XCB, 0XCC,
-  0XCE, 0XCE, 0XCF, 0XD0, 0XD2, 0XD3, 0XD5, 0XD7, 0XD8, 0XDA, 0XDC, 0XDF,
-  0XE1, 0XE4, 0XE8, 0XEC, 0XF0, 0XF8, 0XFF, 0XFF, 0X68, 0X7B, 0X85, 0X8D,
-  0X94, 0X99, 0X9F, 0XA5, 0XAA, 0XAE, 0XB1, 0XB4, 0XB8, 0XBB, 0XBC, 0XBE,
-  0XC0, 0XC1, 0XC2, 0XC4, 0XC4, 0XC5, 0XC5, 0XC5, 0XC6, 0XC6, 0XC6, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7, 0XC7,
-  0XC7, 0XC7, 0XC7, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6,
-  0XC6, 0XC6, 0XC6, 0XC6, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5, 0XC5,
-  0XC5, 0XC6, 0XC6, 0XC6, 0XC6, 0XC6, 0XC7, 0XC7, 0XC7, 0XC8, 0XC8, 0XC9,
-  0XC9, 0XCA, 0XCB, 0XCC, 0XCD, 0XCE, 0XCF, 0XD0, 0XD1, 0XD2, 0XD3, 0XD5,
-  0XD6, 0XD7, 0XD9, 0XDB, 0XDD, 0XDF, 0XE0, 0XE3, 0XE6, 0XE9, 0XED, 0XF1,
-  0XF7, 0XFD, 0XFF, 0XFF, 0X76, 0X86, 0X90, 0X97, 0X9E, 0XA3, 0XA9, 0XAE,
-  0XB1, 0XB5, 0XB8, 0XBC, 0XBE, 0XC1, 0XC3, 0XC4, 0XC6, 0XC7, 0XC8, 0XC8,
-  0XC9, 0XC9, 0XCA, 0XCA, 0XCA, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCC, 0XCC,
-  0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCA, 0XCA, 0XCA, 0XCA, 0XCA,
-  0XCA, 0XCA, 0XCA, 0XCA, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9,
-  0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8,
-  0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC8, 0XC9, 0XC9, 0XC9,
-  0XC9, 0XCA, 0XCA, 0XCB, 0XCB, 0XCC, 0XCC, 0XCD, 0XCE, 0XCE, 0XCF, 0XD0,
-  0XD0, 0XD1, 0XD2, 0XD4, 0XD5, 0XD6, 0XD7, 0XD8, 0XDA, 0XDC, 0XDD, 0XDF,
-  0XE1, 0XE3, 0XE5, 0XE8, 0XEA, 0XEE, 0XF1, 0XF6, 0XFC, 0XFF, 0XFF, 0XFF,
-  0X83, 0X92, 0X9B, 0XA2, 0XA8, 0XAD, 0XB1, 0XB5, 0XB9, 0XBC, 0XBF, 0XC2,
-  0XC5, 0XC7, 0XC8, 0XCA, 0XCB, 0XCC, 0XCD, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD, 0XCD,
-  0XCD, 0XCD, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB, 0XCB,
-  0XCB, 0XCB, 0XCB, 0XCC, 0XCC, 0XCC, 0XCC, 0XCC, 0XCD, 0XCD, 0XCE, 0XCE,
-  0XCE, 0XCF, 0XCF, 0XD0, 0XD0, 0XD1, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD7,
-  0XD8, 0XD9, 0XDB, 0XDC, 0XDE, 0XDF, 0XE1, 0XE3, 0XE5, 0XE7, 0XE9, 0XED,
-  0XEF, 0XF2, 0XF6, 0XFB, 0XFF, 0XFF, 0XFF, 0XFF, 0X90, 0X9D, 0XA5, 0XAC,
-  0XB1, 0XB5, 0XB9, 0XBD, 0XC1, 0XC4, 0XC7, 0XC9, 0XCC, 0XCD, 0XCF, 0XD0,
-  0XD1, 0XD1, 0XD2, 0XD2, 0XD3, 0XD3, 0XD3, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3,
-  0XD3, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XD0, 0XCF, 0XCF,
-  0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCF, 0XCE, 0XCE, 0XCE,
-  0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCE, 0XCF, 0XCF, 0XCF,
-  0XCF, 0XCF, 0XCF, 0XD0, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1, 0XD2, 0XD3, 0XD3,
-  0XD4, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD9, 0XDB, 0XDC, 0XDD, 0XDF, 0XE0,
-  0XE2, 0XE3, 0XE5, 0XE7, 0XE9, 0XEC, 0XEE, 0XF0, 0XF3, 0XF7, 0XFB, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0X9C, 0XA9, 0XB1, 0XB5, 0XBA, 0XBE, 0XC2, 0XC5,
-  0XC9, 0XCC, 0XCE, 0XD0, 0XD2, 0XD3, 0XD5, 0XD6, 0XD6, 0XD7, 0XD7, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD8,
-  0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4,
-  0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD3, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2, 0XD2,
-  0XD2, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1,
-  0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD1, 0XD2, 0XD2, 0XD2, 0XD2, 0XD3,
-  0XD3, 0XD3, 0XD4, 0XD4, 0XD5, 0XD5, 0XD6, 0XD7, 0XD7, 0XD8, 0XD9, 0XDA,
-  0XDB, 0XDC, 0XDD, 0XDE, 0XE0, 0XE1, 0XE2, 0XE4, 0XE6, 0XE7, 0XE9, 0XEB,
-  0XED, 0XEF, 0XF1, 0XF4, 0XF7, 0XFB, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XAA, 0XB3, 0XBA, 0XBF, 0XC3, 0XC7, 0XCA, 0XCE, 0XD1, 0XD3, 0XD5, 0XD7,
-  0XD8, 0XDA, 0XDB, 0XDC, 0XDC, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD,
-  0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB,
-  0XDB, 0XDB, 0XDA, 0XDA, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD6, 0XD6,
-  0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD6, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD5, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD4, 0XD5, 0XD5,
-  0XD5, 0XD5, 0XD5, 0XD5, 0XD6, 0XD6, 0XD6, 0XD6, 0XD7, 0XD7, 0XD7, 0XD8,
-  0XD8, 0XD9, 0XD9, 0XDA, 0XDB, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0, 0XE1, 0XE2,
-  0XE3, 0XE5, 0XE6, 0XE7, 0XE9, 0XEB, 0XED, 0XEF, 0XF0, 0XF3, 0XF5, 0XF8,
-  0XFC, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XB6, 0XBF, 0XC4, 0XC9,
-  0XCC, 0XD0, 0XD3, 0XD5, 0XD8, 0XDA, 0XDC, 0XDE, 0XDF, 0XE0, 0XE1, 0XE1,
-  0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1,
-  0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE,
-  0XDE, 0XDE, 0XDD, 0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XD9, 0XD9, 0XD9, 0XD9, 0XD9, 0XD8, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD8, 0XD8, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7,
-  0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD7, 0XD8, 0XD8,
-  0XD8, 0XD8, 0XD8, 0XD9, 0XD9, 0XDA, 0XDA, 0XDB, 0XDB, 0XDC, 0XDD, 0XDD,
-  0XDE, 0XDF, 0XE0, 0XE1, 0XE1, 0XE3, 0XE4, 0XE5, 0XE7, 0XE8, 0XE9, 0XEB,
-  0XED, 0XEF, 0XF0, 0XF2, 0XF4, 0XF7, 0XF9, 0XFC, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XC2, 0XC9, 0XCE, 0XD1, 0XD5, 0XD8, 0XDA, 0XDD,
-  0XDF, 0XE1, 0XE2, 0XE4, 0XE5, 0XE5, 0XE6, 0XE6, 0XE6, 0XE7, 0XE7, 0XE6,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4,
-  0XE3, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDD, 0XDD, 0XDD,
-  0XDD, 0XDD, 0XDC, 0XDC, 0XDC, 0XDC, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB, 0XDB,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDB, 0XDB, 0XDB, 0XDB, 0XDC, 0XDC,
-  0XDC, 0XDD, 0XDD, 0XDE, 0XDE, 0XDF, 0XE0, 0XE0, 0XE1, 0XE2, 0XE3, 0XE4,
-  0XE5, 0XE6, 0XE7, 0XE8, 0XEA, 0XEB, 0XED, 0XEF, 0XEF, 0XF1, 0XF3, 0XF5,
-  0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XCF, 0XD4, 0XD8, 0XDB, 0XDE, 0XE1, 0XE3, 0XE5, 0XE7, 0XE8, 0XE9, 0XEA,
-  0XEB, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEB, 0XEA,
-  0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE9, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE7,
-  0XE6, 0XE6, 0XE6, 0XE5, 0XE5, 0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE2,
-  0XE2, 0XE2, 0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0,
-  0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDF, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE, 0XDE,
-  0XDE, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDD, 0XDE, 0XDE,
-  0XDE, 0XDE, 0XDE, 0XDE, 0XDF, 0XDF, 0XDF, 0XDF, 0XE0, 0XE0, 0XE1, 0XE1,
-  0XE1, 0XE2, 0XE3, 0XE4, 0XE5, 0XE6, 0XE6, 0XE7, 0XE8, 0XEA, 0XEB, 0XEC,
-  0XEE, 0XEF, 0XEF, 0XF1, 0XF3, 0XF5, 0XF7, 0XF9, 0XFC, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XDB, 0XDF, 0XE2, 0XE5,
-  0XE7, 0XE9, 0XEB, 0XED, 0XEE, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF1,
-  0XF1, 0XF0, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE,
-  0XEE, 0XED, 0XED, 0XEC, 0XEC, 0XEB, 0XEB, 0XEA, 0XEA, 0XE9, 0XE9, 0XE8,
-  0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5,
-  0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE2, 0XE1, 0XE1,
-  0XE1, 0XE1, 0XE1, 0XE1, 0XE1, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0,
-  0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE0, 0XE1, 0XE1,
-  0XE1, 0XE1, 0XE2, 0XE2, 0XE3, 0XE3, 0XE4, 0XE4, 0XE5, 0XE6, 0XE6, 0XE7,
-  0XE7, 0XE8, 0XE9, 0XEB, 0XEC, 0XED, 0XEE, 0XEF, 0XF0, 0XF1, 0XF3, 0XF5,
-  0XF6, 0XF8, 0XFB, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XE9, 0XEA, 0XED, 0XEE, 0XEF, 0XF1, 0XF3, 0XF4,
-  0XF5, 0XF6, 0XF6, 0XF7, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF6, 0XF5,
-  0XF5, 0XF4, 0XF4, 0XF3, 0XF3, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XEC, 0XEC, 0XEB, 0XEB,
-  0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE8, 0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7,
-  0XE7, 0XE6, 0XE6, 0XE6, 0XE6, 0XE5, 0XE5, 0XE5, 0XE5, 0XE5, 0XE4, 0XE4,
-  0XE4, 0XE4, 0XE4, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE3, 0XE4, 0XE4, 0XE4, 0XE4, 0XE4, 0XE5, 0XE5, 0XE5, 0XE6,
-  0XE6, 0XE7, 0XE7, 0XE7, 0XE8, 0XE9, 0XE9, 0XEA, 0XEB, 0XEC, 0XED, 0XEE,
-  0XEF, 0XEF, 0XF1, 0XF2, 0XF4, 0XF5, 0XF7, 0XF8, 0XFA, 0XFC, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF5, 0XF5, 0XF5, 0XF7, 0XF8, 0XF9, 0XFB, 0XFB, 0XFC, 0XFC, 0XFD, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8,
-  0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4, 0XF4, 0XF3, 0XF3, 0XF2, 0XF2, 0XF1,
-  0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XED, 0XED,
-  0XEC, 0XEC, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE8,
-  0XE8, 0XE8, 0XE8, 0XE7, 0XE7, 0XE7, 0XE7, 0XE7, 0XE7, 0XE7, 0XE6, 0XE6,
-  0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6, 0XE6,
-  0XE7, 0XE7, 0XE7, 0XE7, 0XE7, 0XE8, 0XE8, 0XE8, 0XE9, 0XE9, 0XEA, 0XEA,
-  0XEB, 0XEC, 0XED, 0XEE, 0XEE, 0XEF, 0XEF, 0XF0, 0XF1, 0XF3, 0XF4, 0XF5,
-  0XF7, 0XF8, 0XFA, 0XFC, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFC, 0XFB, 0XFA, 0XFA,
-  0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF3,
-  0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEE, 0XEE, 0XEE, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEB,
-  0XEB, 0XEA, 0XEA, 0XEA, 0XEA, 0XEA, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9,
-  0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XE9, 0XEA, 0XEA, 0XEA, 0XEA,
-  0XEB, 0XEB, 0XEC, 0XEC, 0XED, 0XED, 0XEE, 0XEE, 0XEF, 0XEF, 0XEF, 0XF0,
-  0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF9, 0XFB, 0XFC, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFD, 0XFC, 0XFC, 0XFB,
-  0XFB, 0XFA, 0XF9, 0XF9, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6, 0XF5, 0XF5, 0XF4,
-  0XF4, 0XF4, 0XF3, 0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEE, 0XEE, 0XEE, 0XEE, 0XEE, 0XED, 0XED,
-  0XED, 0XED, 0XED, 0XED, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC, 0XEC,
-  0XEC, 0XEC, 0XED, 0XED, 0XED, 0XED, 0XED, 0XEE, 0XEE, 0XEE, 0XEE, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7,
-  0XF8, 0XFA, 0XFB, 0XFC, 0XFD, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD,
-  0XFC, 0XFC, 0XFB, 0XFA, 0XFA, 0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF6, 0XF6,
-  0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF1,
-  0XF1, 0XF1, 0XF0, 0XF0, 0XF0, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF, 0XEF,
-  0XEF, 0XEF, 0XEF, 0XEF, 0XF0, 0XF0, 0XF1, 0XF1, 0XF2, 0XF2, 0XF3, 0XF4,
-  0XF4, 0XF5, 0XF5, 0XF6, 0XF7, 0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE,
-  0XFD, 0XFC, 0XFC, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF8, 0XF7,
-  0XF6, 0XF6, 0XF6, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF3, 0XF3,
-  0XF3, 0XF3, 0XF2, 0XF2, 0XF2, 0XF2, 0XF2, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1,
-  0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF1, 0XF2, 0XF2, 0XF2, 0XF2, 0XF3,
-  0XF3, 0XF3, 0XF4, 0XF4, 0XF5, 0XF5, 0XF5, 0XF6, 0XF7, 0XF7, 0XF8, 0XF9,
-  0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFE, 0XFE, 0XFD, 0XFD, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9,
-  0XF9, 0XF8, 0XF8, 0XF7, 0XF7, 0XF7, 0XF6, 0XF6, 0XF6, 0XF6, 0XF5, 0XF5,
-  0XF5, 0XF5, 0XF5, 0XF5, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4, 0XF4,
-  0XF4, 0XF4, 0XF5, 0XF5, 0XF5, 0XF5, 0XF5, 0XF6, 0XF6, 0XF6, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF9, 0XFA, 0XFA, 0XFB, 0XFC, 0XFD, 0XFD, 0XFE, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC, 0XFB, 0XFB, 0XFB,
-  0XFA, 0XFA, 0XF9, 0XF9, 0XF9, 0XF9, 0XF8, 0XF8, 0XF8, 0XF8, 0XF7, 0XF7,
-  0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7, 0XF7,
-  0XF8, 0XF8, 0XF8, 0XF8, 0XF9, 0XF9, 0XFA, 0XFA, 0XFB, 0XFB, 0XFC, 0XFC,
-  0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFD, 0XFD, 0XFD, 0XFC, 0XFC, 0XFC,
-  0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA,
-  0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFB,
-  0XFC, 0XFC, 0XFC, 0XFD, 0XFD, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFE, 0XFE, 0XFE,
-  0XFE, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFD,
-  0XFD, 0XFD, 0XFD, 0XFD, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFA, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XF0, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XE0,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XCC, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XEF, 0XB8, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFB, 0XDF, 0XA5,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF0, 0XCD, 0X91, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XF9, 0XE1, 0XBC, 0X7D, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFC, 0XEC, 0XD1, 0XAB, 0X68,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XF2, 0XDD, 0XC1, 0X98, 0X52, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF5, 0XE5,
-  0XCF, 0XB1, 0X87, 0X3B, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XF7, 0XE9, 0XD7, 0XBF, 0XA1, 0X75, 0X26,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE,
-  0XF7, 0XEB, 0XDB, 0XC8, 0XB1, 0X90, 0X62, 0X13, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XF6, 0XEB, 0XDE, 0XCE, 0XBA,
-  0XA1, 0X80, 0X4E, 0X05, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFD, 0XF5, 0XEC, 0XE0, 0XD2, 0XC1, 0XAE, 0X93, 0X71, 0X3C, 0X01,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XFA, 0XF8, 0XF7,
-  0XF6, 0XF6, 0XF7, 0XF8, 0XFA, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFB, 0XF2, 0XEB, 0XE0,
-  0XD3, 0XC5, 0XB4, 0X9E, 0X83, 0X5F, 0X26, 0X00, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XF9, 0XF4, 0XEF, 0XEA, 0XE7, 0XE5, 0XE5, 0XE5, 0XE6, 0XE8, 0XEB,
-  0XED, 0XEF, 0XF2, 0XF6, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFD, 0XF7, 0XEF, 0XE7, 0XDF, 0XD4, 0XC6, 0XB8, 0XA7, 0X8F,
-  0X74, 0X4D, 0X10, 0X00, 0XFF, 0XFD, 0XF8, 0XF0, 0XE8, 0XE1, 0XDB, 0XD6,
-  0XD3, 0XD1, 0XD1, 0XD2, 0XD4, 0XD6, 0XD9, 0XDC, 0XE0, 0XE4, 0XE7, 0XEB,
-  0XEE, 0XF0, 0XF4, 0XF7, 0XFA, 0XFC, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFA, 0XF3, 0XED,
-  0XE5, 0XDC, 0XD3, 0XC7, 0XBA, 0XAB, 0X98, 0X81, 0X64, 0X39, 0X02, 0X00,
-  0XF1, 0XE6, 0XDB, 0XD2, 0XCB, 0XC5, 0XC0, 0XBC, 0XBB, 0XBB, 0XBC, 0XBF,
-  0XC2, 0XC6, 0XCA, 0XCF, 0XD3, 0XD7, 0XDB, 0XDF, 0XE3, 0XE6, 0XEA, 0XED,
-  0XEF, 0XF2, 0XF5, 0XF8, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFE, 0XFB, 0XF5, 0XEF, 0XE9, 0XE1, 0XD9, 0XD0, 0XC6, 0XBA,
-  0XAD, 0X9D, 0X89, 0X72, 0X53, 0X26, 0X00, 0X00, 0XCC, 0XC3, 0XBB, 0XB4,
-  0XAF, 0XAA, 0XA7, 0XA5, 0XA5, 0XA7, 0XAA, 0XAE, 0XB3, 0XB7, 0XBC, 0XC1,
-  0XC6, 0XCB, 0XCF, 0XD4, 0XD8, 0XDB, 0XDF, 0XE3, 0XE6, 0XE9, 0XED, 0XEF,
-  0XF1, 0XF4, 0XF7, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFD, 0XFA, 0XF6, 0XF0,
-  0XEB, 0XE5, 0XDE, 0XD6, 0XCE, 0XC4, 0XBA, 0XAF, 0XA0, 0X8F, 0X7C, 0X62,
-  0X41, 0X10, 0X00, 0X00, 0XA2, 0X9E, 0X99, 0X94, 0X90, 0X8C, 0X8B, 0X8B,
-  0X8E, 0X92, 0X96, 0X9C, 0XA1, 0XA8, 0XAE, 0XB3, 0XB8, 0XBE, 0XC3, 0XC8,
-  0XCC, 0XD0, 0XD4, 0XD8, 0XDC, 0XDF, 0XE3, 0XE5, 0XE9, 0XEC, 0XEE, 0XF0,
-  0XF2, 0XF5, 0XF7, 0XF9, 0XFB, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFC, 0XF9, 0XF4, 0XF0, 0XEC, 0XE6, 0XE0, 0XD9, 0XD2, 0XCA,
-  0XC1, 0XB7, 0XAE, 0XA1, 0X92, 0X81, 0X6C, 0X52, 0X2E, 0X02, 0X00, 0X00,
-  0X75, 0X77, 0X76, 0X74, 0X71, 0X70, 0X70, 0X73, 0X78, 0X7D, 0X83, 0X8A,
-  0X91, 0X98, 0X9F, 0XA7, 0XAD, 0XB3, 0XB7, 0XBC, 0XC1, 0XC5, 0XCA, 0XCE,
-  0XD2, 0XD5, 0XD8, 0XDC, 0XDF, 0XE2, 0XE5, 0XE8, 0XEA, 0XED, 0XEF, 0XF1,
-  0XF2, 0XF5, 0XF7, 0XF9, 0XFB, 0XFC, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFC, 0XF9, 0XF6, 0XF2, 0XEF,
-  0XEB, 0XE6, 0XE1, 0XDB, 0XD5, 0XCE, 0XC7, 0XBE, 0XB5, 0XAC, 0XA1, 0X94,
-  0X85, 0X74, 0X5E, 0X41, 0X1A, 0X00, 0X00, 0X00, 0X3D, 0X4A, 0X4E, 0X50,
-  0X50, 0X50, 0X53, 0X59, 0X60, 0X68, 0X71, 0X79, 0X81, 0X89, 0X91, 0X98,
-  0X9F, 0XA5, 0XAC, 0XB1, 0XB6, 0XBA, 0XBF, 0XC3, 0XC7, 0XCB, 0XCE, 0XD2,
-  0XD5, 0XD8, 0XDC, 0XDE, 0XE1, 0XE4, 0XE6, 0XE8, 0XEB, 0XED, 0XEF, 0XF0,
-  0XF2, 0XF4, 0XF6, 0XF8, 0XF9, 0XFB, 0XFC, 0XFD, 0XFE, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFE, 0XFD,
-  0XFB, 0XF9, 0XF6, 0XF3, 0XEF, 0XEC, 0XE8, 0XE4, 0XE0, 0XDA, 0XD5, 0XD0,
-  0XC9, 0XC2, 0XBB, 0XB3, 0XAA, 0X9F, 0X94, 0X87, 0X78, 0X65, 0X4E, 0X30,
-  0X06, 0X00, 0X00, 0X00, 0X02, 0X13, 0X21, 0X28, 0X2B, 0X30, 0X36, 0X3F,
-  0X4A, 0X53, 0X5E, 0X67, 0X72, 0X7B, 0X83, 0X8B, 0X92, 0X99, 0X9F, 0XA5,
-  0XAB, 0XB0, 0XB4, 0XB9, 0XBD, 0XC1, 0XC5, 0XC8, 0XCC, 0XCF, 0XD2, 0XD5,
-  0XD7, 0XDA, 0XDD, 0XDF, 0XE2, 0XE4, 0XE6, 0XE8, 0XEB, 0XEC, 0XEE, 0XEF,
-  0XF1, 0XF2, 0XF4, 0XF6, 0XF7, 0XF9, 0XFA, 0XFB, 0XFC, 0XFD, 0XFE, 0XFE,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFE, 0XFE, 0XFD, 0XFB, 0XF9, 0XF7, 0XF4, 0XF2, 0XEF, 0XEC, 0XE9,
-  0XE5, 0XE1, 0XDD, 0XD9, 0XD5, 0XD0, 0XCA, 0XC4, 0XBE, 0XB7, 0XB0, 0XA8,
-  0X9D, 0X93, 0X87, 0X7A, 0X69, 0X56, 0X3D, 0X1C, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X03, 0X0A, 0X16, 0X23, 0X32, 0X3F, 0X4B, 0X56,
-  0X61, 0X6B, 0X75, 0X7E, 0X85, 0X8C, 0X93, 0X99, 0X9F, 0XA5, 0XAA, 0XAF,
-  0XB3, 0XB6, 0XBA, 0XBE, 0XC2, 0XC5, 0XC8, 0XCC, 0XCE, 0XD1, 0XD4, 0XD6,
-  0XD8, 0XDB, 0XDD, 0XE0, 0XE1, 0XE4, 0XE5, 0XE7, 0XE9, 0XEB, 0XED, 0XEE,
-  0XEF, 0XF0, 0XF2, 0XF3, 0XF4, 0XF6, 0XF6, 0XF8, 0XF9, 0XFA, 0XFB, 0XFC,
-  0XFC, 0XFD, 0XFE, 0XFE, 0XFE, 0XFE, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF, 0XFF,
-  0XFE, 0XFE, 0XFE, 0XFE, 0XFD, 0XFC, 0XFB, 0XFA, 0XF9, 0XF7, 0XF5, 0XF3,
-  0XF1, 0XEF, 0XED, 0XEB, 0XE8, 0XE5, 0XE2, 0XDE, 0XDB, 0XD7, 0XD2, 0XCE,
-  0XC9, 0XC4, 0XBF, 0XB9, 0XB3, 0XAC, 0XA3, 0X9A, 0X91, 0X86, 0X7B, 0X6C,
-  0X5C, 0X46, 0X2C, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X07, 0X1A, 0X2B, 0X38, 0X46, 0X53, 0X5E, 0X68, 0X72,
-  0X7A, 0X82, 0X88, 0X8F, 0X95, 0X9A, 0X9F, 0XA5, 0XAA, 0XAE, 0XB1, 0XB5,
-  0XB9, 0XBC, 0XBF, 0XC3, 0XC5, 0XC8, 0XCB, 0XCE, 0XD0, 0XD3, 0XD5, 0XD7,
-  0XD9, 0XDC, 0XDE, 0XE0, 0XE1, 0XE3, 0XE5, 0XE7, 0XE8, 0XEA, 0XEB, 0XEC,
-  0XEE, 0XEF, 0XEF, 0XF0, 0XF1, 0XF2, 0XF3, 0XF4, 0XF5, 0XF6, 0XF7, 0XF7,
-  0XF8, 0XF9, 0XF9, 0XFA, 0XFA, 0XFA, 0XFB, 0XFB, 0XFB, 0XFC, 0XFC, 0XFC,
-  0XFC, 0XFB, 0XFB, 0XFB, 0XFB, 0XFA, 0XFA, 0XF9, 0XF9, 0XF8, 0XF7, 0XF6,
-  0XF5, 0XF4, 0XF3, 0XF1, 0XF0, 0XEF, 0XED, 0XEB, 0XE9, 0XE7, 0XE5, 0XE2,
-  0XDF, 0XDC, 0XD8, 0XD5, 0XD1, 0XCD, 0XC8, 0XC4, 0XBF, 0XBA, 0XB5, 0XB0,
-  0XA9, 0XA0, 0X98, 0X8F, 0X85, 0X7A, 0X6E, 0X5F, 0X4E, 0X37, 0X1A, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X03, 0X14, 0X24, 0X34, 0X42, 0X4F, 0X5A, 0X63, 0X6C, 0X75, 0X7D, 0X83,
-  0X89, 0X8F, 0X94, 0X99, 0X9E, 0XA3, 0XA8, 0XAC, 0XB0, 0XB3, 0XB6, 0XB9,
-  0XBC, 0XBF, 0XC2, 0XC5, 0XC7, 0XCA, 0XCC, 0XCF, 0XD1, 0XD3, 0XD5, 0XD7,
-  0XD9, 0XDB, 0XDC, 0XDE, 0XE0, 0XE1, 0XE3, 0XE4, 0XE6, 0XE7, 0XE8, 0XE9,
-  0XEA, 0XEB, 0XEC, 0XED, 0XEE, 0XEF, 0XEF, 0XEF, 0XF0, 0XF1, 0XF1, 0XF1,
-  0XF2, 0XF2, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF3, 0XF2,
-  0XF2, 0XF2, 0XF1, 0XF1, 0XF0, 0XEF, 0XEF, 0XEE, 0XED, 0XEC, 0XEB, 0XE9,
-  0XE7, 0XE6, 0XE4, 0XE1, 0XDF, 0XDD, 0XDA, 0XD7, 0XD4, 0XD1, 0XCE, 0XCA,
-  0XC6, 0XC2, 0XBD, 0XB9, 0XB4, 0XB0, 0XAA, 0XA3, 0X9C, 0X95, 0X8C, 0X83,
-  0X79, 0X6D, 0X61, 0X51, 0X3E, 0X26, 0X06, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X10, 0X22,
-  0X32, 0X3F, 0X4B, 0X55, 0X5F, 0X67, 0X70, 0X77, 0X7E, 0X83, 0X89, 0X8E,
-  0X93, 0X98, 0X9D, 0XA1, 0XA5, 0XA9, 0XAD, 0XB0, 0XB3, 0XB5, 0XB8, 0XBB,
-  0XBE, 0XC1, 0XC3, 0XC5, 0XC7, 0XCA, 0XCC, 0XCE, 0XD0, 0XD2, 0XD4, 0XD5,
-  0XD7, 0XD8, 0XDA, 0XDB, 0XDD, 0XDE, 0XDF, 0XE1, 0XE2, 0XE3, 0XE4, 0XE5,
-  0XE5, 0XE6, 0XE7, 0XE8, 0XE8, 0XE9, 0XEA, 0XEA, 0XEA, 0XEB, 0XEB, 0XEB,
-  0XEB, 0XEC, 0XEC, 0XEC, 0XEB, 0XEB, 0XEB, 0XEB, 0XEA, 0XEA, 0XE9, 0XE8,
-  0XE8, 0XE7, 0XE6, 0XE5, 0XE4, 0XE2, 0XE1, 0XDF, 0XDE, 0XDC, 0XDA, 0XD7,
-  0XD5, 0XD3, 0XD0, 0XCD, 0XCA, 0XC6, 0XC3, 0XBF, 0XBB, 0XB6, 0XB3, 0XAE,
-  0XAA, 0XA3, 0X9D, 0X97, 0X90, 0X88, 0X80, 0X77, 0X6B, 0X5F, 0X52, 0X41,
-  0X2D, 0X13, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X0D, 0X20, 0X2E, 0X3C, 0X47,
-  0X51, 0X5B, 0X63, 0X6A, 0X72, 0X78, 0X7E, 0X83, 0X89, 0X8D, 0X92, 0X96,
-  0X9A, 0X9E, 0XA2, 0XA5, 0XA9, 0XAD, 0XB0, 0XB3, 0XB4, 0XB7, 0XBA, 0XBC,
-  0XBF, 0XC1, 0XC3, 0XC5, 0XC7, 0XC9, 0XCB, 0XCD, 0XCE, 0XD0, 0XD2, 0XD3,
-  0XD4, 0XD6, 0XD7, 0XD8, 0XD9, 0XDB, 0XDB, 0XDC, 0XDD, 0XDE, 0XDF, 0XE0,
-  0XE0, 0XE1, 0XE1, 0XE2, 0XE2, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3, 0XE3,
-  0XE3, 0XE3, 0XE2, 0XE2, 0XE2, 0XE1, 0XE0, 0XE0, 0XDF, 0XDE, 0XDD, 0XDC,
-  0XDB, 0XD9, 0XD7, 0XD6, 0XD4, 0XD2, 0XD0, 0XCE, 0XCB, 0XC9, 0XC5, 0XC2,
-  0XBF, 0XBB, 0XB8, 0XB4, 0XB1, 0XAC, 0XA8, 0XA2, 0X9D, 0X98, 0X92, 0X8B,
-  0X84, 0X7D, 0X74, 0X69, 0X5E, 0X51, 0X43, 0X32, 0X1B, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X0C, 0X1E, 0X2B, 0X38, 0X43, 0X4D, 0X55, 0X5E,
-  0X65, 0X6B, 0X73, 0X78, 0X7E, 0X82, 0X87, 0X8C, 0X90, 0X94, 0X98, 0X9B,
-  0X9F, 0XA2, 0XA5, 0XA9, 0XAC, 0XAF, 0XB1, 0XB3, 0XB5, 0XB8, 0XBA, 0XBC,
-  0XBE, 0XC0, 0XC2, 0XC4, 0XC6, 0XC7, 0XC9, 0XCA, 0XCC, 0XCD, 0XCE, 0XD0,
-  0XD1, 0XD2, 0XD3, 0XD4, 0XD5, 0XD6, 0XD6, 0XD7, 0XD8, 0XD8, 0XD9, 0XD9,
-  0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XDA, 0XD9, 0XD9,
-  0XD8, 0XD8, 0XD7, 0XD6, 0XD5, 0XD5, 0XD4, 0XD2, 0XD1, 0XCF, 0XCD, 0XCC,
-  0XCA, 0XC8, 0XC6, 0XC3, 0XC1, 0XBE, 0XBB, 0XB8, 0XB4, 0XB1, 0XAE, 0XAA,
-  0XA5, 0XA0, 0X9B, 0X97, 0X92, 0X8C, 0X85, 0X7F, 0X78, 0X70, 0X66, 0X5C,
-  0X50, 0X42, 0X34, 0X21, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X0B, 0X1A, 0X29, 0X34, 0X3F, 0X49, 0X51, 0X59, 0X5F, 0X66, 0X6C,
-  0X73, 0X78, 0X7D, 0X81, 0X85, 0X8A, 0X8E, 0X92, 0X95, 0X98, 0X9B, 0X9F,
-  0XA2, 0XA5, 0XA8, 0XAB, 0XAD, 0XB0, 0XB1, 0XB3, 0XB5, 0XB7, 0XB9, 0XBB,
-  0XBD, 0XBF, 0XC0, 0XC2, 0XC3, 0XC5, 0XC6, 0XC7, 0XC8, 0XCA, 0XCA, 0XCB,
-  0XCC, 0XCD, 0XCE, 0XCF, 0XCF, 0XD0, 0XD0, 0XD1, 0XD1, 0XD1, 0XD2, 0XD2,
-  0XD2, 0XD2, 0XD2, 0XD2, 0XD1, 0XD1, 0XD1, 0XD0, 0XD0, 0XCF, 0XCE, 0XCE,
-  0XCC, 0XCB, 0XCA, 0XC9, 0XC7, 0XC5, 0XC4, 0XC2, 0XC0, 0XBE, 0XBB, 0XB9,
-  0XB6, 0XB3, 0XB1, 0XAE, 0XAA, 0XA7, 0XA2, 0X9D, 0X99, 0X95, 0X90, 0X8B,
-  0X85, 0X80, 0X7A, 0X73, 0X6B, 0X63, 0X5A, 0X4E, 0X42, 0X33, 0X23, 0X0D,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X09, 0X18,
-  0X26, 0X31, 0X3B, 0X43, 0X4C, 0X53, 0X5A, 0X60, 0X67, 0X6C, 0X72, 0X77,
-  0X7B, 0X80, 0X83, 0X87, 0X8B, 0X8E, 0X92, 0X95, 0X98, 0X9B, 0X9D, 0XA1,
-  0XA3, 0XA5, 0XA9, 0XAB, 0XAD, 0XAF, 0XB1, 0XB3, 0XB4, 0XB6, 0XB8, 0XB9,
-  0XBB, 0XBC, 0XBD, 0XBE, 0XBF, 0XC1, 0XC2, 0XC3, 0XC4, 0XC5, 0XC5, 0XC6,
-  0XC7, 0XC7, 0XC8, 0XC8, 0XC8, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9, 0XC9,
-  0XC8, 0XC8, 0XC8, 0XC7, 0XC6, 0XC6, 0XC5, 0XC4, 0XC3, 0XC2, 0XC1, 0XBF,
-  0XBD, 0XBC, 0XBA, 0XB8, 0XB6, 0XB3, 0XB1, 0XB0, 0XAD, 0XAA, 0XA5, 0XA2,
-  0X9E, 0X9A, 0X96, 0X92, 0X8E, 0X88, 0X83, 0X7F, 0X7A, 0X74, 0X6C, 0X66,
-  0X5E, 0X55, 0X4C, 0X40, 0X33, 0X22, 0X11, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X14, 0X21, 0X2C, 0X36,
-  0X3F, 0X45, 0X4E, 0X54, 0X5B, 0X60, 0X66, 0X6B, 0X71, 0X75, 0X79, 0X7D,
-  0X81, 0X84, 0X87, 0X8B, 0X8E, 0X91, 0X94, 0X97, 0X99, 0X9C, 0X9E, 0XA1,
-  0XA3, 0XA5, 0XA8, 0XAA, 0XAC, 0XAE, 0XB0, 0XB1, 0XB3, 0XB3, 0XB4, 0XB6,
-  0XB7, 0XB8, 0XB9, 0XBA, 0XBB, 0XBC, 0XBD, 0XBD, 0XBE, 0XBE, 0XBF, 0XBF,
-  0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XC0, 0XBF, 0XBF, 0XBE,
-  0XBD, 0XBD, 0XBB, 0XBB, 0XB9, 0XB8, 0XB7, 0XB5, 0XB4, 0XB3, 0XB1, 0XAF,
-  0XAD, 0XAA, 0XA8, 0XA5, 0XA1, 0X9E, 0X9B, 0X97, 0X93, 0X8F, 0X8B, 0X86,
-  0X82, 0X7D, 0X78, 0X73, 0X6D, 0X67, 0X60, 0X59, 0X51, 0X47, 0X3D, 0X31,
-  0X22, 0X11, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X03, 0X10, 0X1C, 0X27, 0X31, 0X38, 0X40, 0X47,
-  0X4F, 0X54, 0X5B, 0X60, 0X65, 0X69, 0X6D, 0X73, 0X76, 0X7A, 0X7E, 0X81,
-  0X84, 0X87, 0X8A, 0X8D, 0X90, 0X93, 0X95, 0X97, 0X9A, 0X9C, 0X9E, 0XA0,
-  0XA2, 0XA5, 0XA7, 0XA8, 0XAA, 0XAB, 0XAD, 0XAE, 0XAF, 0XB0, 0XB1, 0XB1,
-  0XB3, 0XB3, 0XB4, 0XB4, 0XB5, 0XB5, 0XB6, 0XB6, 0XB7, 0XB7, 0XB7, 0XB7,
-  0XB7, 0XB7, 0XB7, 0XB7, 0XB6, 0XB6, 0XB5, 0XB5, 0XB4, 0XB3, 0XB3, 0XB1,
-  0XB1, 0XB0, 0XAF, 0XAD, 0XAB, 0XA9, 0XA7, 0XA3, 0XA2, 0X9F, 0X9C, 0X99,
-  0X96, 0X93, 0X90, 0X8C, 0X88, 0X84, 0X80, 0X7B, 0X76, 0X71, 0X6B, 0X66,
-  0X60, 0X5A, 0X53, 0X4B, 0X42, 0X38, 0X2D, 0X20, 0X11, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X0B, 0X17, 0X22, 0X2A, 0X33, 0X3B, 0X41, 0X47, 0X4F, 0X54,
-  0X5A, 0X5E, 0X63, 0X67, 0X6B, 0X70, 0X73, 0X77, 0X7A, 0X7E, 0X81, 0X84,
-  0X86, 0X89, 0X8B, 0X8E, 0X91, 0X93, 0X95, 0X97, 0X99, 0X9B, 0X9D, 0X9E,
-  0XA0, 0XA1, 0XA3, 0XA5, 0XA5, 0XA8, 0XA9, 0XAA, 0XAA, 0XAB, 0XAC, 0XAD,
-  0XAE, 0XAE, 0XAE, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF, 0XAF,
-  0XAE, 0XAE, 0XAD, 0XAD, 0XAC, 0XAB, 0XAA, 0XA9, 0XA7, 0XA5, 0XA5, 0XA2,
-  0XA0, 0X9E, 0X9C, 0X99, 0X97, 0X95, 0X92, 0X8F, 0X8C, 0X88, 0X84, 0X81,
-  0X7D, 0X79, 0X74, 0X6E, 0X69, 0X64, 0X5F, 0X59, 0X53, 0X4D, 0X45, 0X3D,
-  0X34, 0X29, 0X1E, 0X0E, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06,
-  0X11, 0X1B, 0X24, 0X2C, 0X34, 0X3C, 0X42, 0X46, 0X4E, 0X52, 0X57, 0X5C,
-  0X60, 0X64, 0X68, 0X6B, 0X70, 0X73, 0X76, 0X7A, 0X7D, 0X80, 0X82, 0X84,
-  0X87, 0X89, 0X8B, 0X8E, 0X90, 0X92, 0X94, 0X95, 0X97, 0X98, 0X9A, 0X9B,
-  0X9C, 0X9E, 0X9F, 0XA0, 0XA1, 0XA2, 0XA2, 0XA3, 0XA5, 0XA5, 0XA5, 0XA5,
-  0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA5, 0XA3, 0XA2,
-  0XA2, 0XA1, 0X9F, 0X9E, 0X9C, 0X9B, 0X9A, 0X98, 0X96, 0X94, 0X92, 0X8F,
-  0X8D, 0X8A, 0X86, 0X83, 0X80, 0X7D, 0X79, 0X75, 0X71, 0X6C, 0X67, 0X62,
-  0X5D, 0X57, 0X51, 0X4C, 0X45, 0X3E, 0X37, 0X2E, 0X24, 0X18, 0X0B, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03, 0X0B, 0X16, 0X1F,
-  0X28, 0X2E, 0X36, 0X3C, 0X42, 0X46, 0X4D, 0X51, 0X55, 0X5A, 0X5E, 0X62,
-  0X65, 0X69, 0X6C, 0X70, 0X73, 0X77, 0X79, 0X7C, 0X7E, 0X81, 0X83, 0X85,
-  0X87, 0X89, 0X8B, 0X8D, 0X8F, 0X90, 0X92, 0X93, 0X94, 0X96, 0X97, 0X98,
-  0X98, 0X99, 0X9A, 0X9B, 0X9B, 0X9C, 0X9C, 0X9D, 0X9D, 0X9D, 0X9D, 0X9D,
-  0X9D, 0X9D, 0X9C, 0X9C, 0X9C, 0X9B, 0X9A, 0X9A, 0X98, 0X98, 0X96, 0X95,
-  0X94, 0X92, 0X91, 0X8F, 0X8D, 0X8A, 0X88, 0X85, 0X83, 0X80, 0X7D, 0X7A,
-  0X77, 0X73, 0X6E, 0X6A, 0X65, 0X61, 0X5C, 0X56, 0X51, 0X4C, 0X44, 0X3F,
-  0X38, 0X31, 0X29, 0X20, 0X14, 0X07, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X06, 0X0E, 0X18, 0X20, 0X28, 0X2E,
-  0X35, 0X3B, 0X40, 0X45, 0X4A, 0X4F, 0X53, 0X56, 0X5B, 0X5F, 0X62, 0X65,
-  0X68, 0X6B, 0X6E, 0X72, 0X75, 0X77, 0X7A, 0X7C, 0X7E, 0X80, 0X82, 0X84,
-  0X85, 0X87, 0X88, 0X8A, 0X8B, 0X8C, 0X8E, 0X8F, 0X90, 0X91, 0X91, 0X92,
-  0X93, 0X93, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X94, 0X93,
-  0X93, 0X92, 0X91, 0X90, 0X8F, 0X8E, 0X8D, 0X8B, 0X8A, 0X88, 0X86, 0X84,
-  0X82, 0X80, 0X7E, 0X7B, 0X78, 0X75, 0X72, 0X6E, 0X6A, 0X67, 0X62, 0X5E,
-  0X5A, 0X54, 0X4F, 0X4A, 0X43, 0X3E, 0X36, 0X31, 0X29, 0X21, 0X19, 0X0E,
-  0X03, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X01, 0X07, 0X11, 0X19, 0X20, 0X28, 0X2D, 0X33, 0X38,
-  0X3E, 0X42, 0X46, 0X4C, 0X4F, 0X53, 0X56, 0X5B, 0X5E, 0X61, 0X64, 0X67,
-  0X6A, 0X6C, 0X70, 0X72, 0X74, 0X76, 0X79, 0X7A, 0X7C, 0X7E, 0X7F, 0X81,
-  0X82, 0X83, 0X84, 0X85, 0X86, 0X87, 0X88, 0X89, 0X89, 0X8A, 0X8A, 0X8A,
-  0X8B, 0X8B, 0X8B, 0X8B, 0X8A, 0X8A, 0X8A, 0X89, 0X89, 0X88, 0X87, 0X86,
-  0X85, 0X84, 0X83, 0X81, 0X80, 0X7E, 0X7D, 0X7A, 0X78, 0X76, 0X73, 0X70,
-  0X6C, 0X69, 0X66, 0X62, 0X5F, 0X5B, 0X56, 0X51, 0X4D, 0X47, 0X41, 0X3C,
-  0X35, 0X2E, 0X28, 0X21, 0X19, 0X10, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X02, 0X09, 0X11, 0X19, 0X1F, 0X26, 0X2B, 0X31, 0X36, 0X3B, 0X3F,
-  0X43, 0X47, 0X4C, 0X50, 0X53, 0X56, 0X5A, 0X5D, 0X60, 0X62, 0X65, 0X67,
-  0X6A, 0X6C, 0X6E, 0X71, 0X73, 0X74, 0X76, 0X78, 0X79, 0X7A, 0X7B, 0X7D,
-  0X7E, 0X7F, 0X7F, 0X80, 0X80, 0X81, 0X81, 0X81, 0X82, 0X82, 0X82, 0X81,
-  0X81, 0X81, 0X81, 0X80, 0X7F, 0X7F, 0X7E, 0X7D, 0X7C, 0X7B, 0X79, 0X78,
-  0X76, 0X74, 0X72, 0X70, 0X6C, 0X6A, 0X67, 0X64, 0X61, 0X5E, 0X5A, 0X56,
-  0X52, 0X4E, 0X49, 0X44, 0X3F, 0X39, 0X33, 0X2D, 0X26, 0X1F, 0X17, 0X10,
-  0X06, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X03,
-  0X09, 0X10, 0X17, 0X1E, 0X23, 0X29, 0X2D, 0X33, 0X37, 0X3C, 0X40, 0X43,
-  0X47, 0X4C, 0X4F, 0X51, 0X54, 0X57, 0X5B, 0X5D, 0X60, 0X62, 0X64, 0X66,
-  0X68, 0X6A, 0X6B, 0X6D, 0X6E, 0X71, 0X72, 0X73, 0X74, 0X75, 0X76, 0X76,
-  0X77, 0X77, 0X78, 0X78, 0X78, 0X78, 0X78, 0X78, 0X78, 0X77, 0X77, 0X76,
-  0X76, 0X75, 0X74, 0X73, 0X72, 0X70, 0X6E, 0X6C, 0X6A, 0X69, 0X66, 0X64,
-  0X62, 0X5F, 0X5C, 0X59, 0X55, 0X51, 0X4E, 0X4A, 0X45, 0X40, 0X3C, 0X36,
-  0X31, 0X2B, 0X24, 0X1C, 0X16, 0X0D, 0X06, 0X01, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X07, 0X0E,
-  0X14, 0X1A, 0X20, 0X26, 0X2A, 0X30, 0X34, 0X38, 0X3C, 0X40, 0X43, 0X46,
-  0X4A, 0X4D, 0X50, 0X52, 0X55, 0X57, 0X5A, 0X5C, 0X5F, 0X60, 0X62, 0X63,
-  0X65, 0X66, 0X67, 0X69, 0X6A, 0X6B, 0X6B, 0X6C, 0X6D, 0X6D, 0X6D, 0X6E,
-  0X6E, 0X6E, 0X6E, 0X6D, 0X6D, 0X6D, 0X6C, 0X6C, 0X6B, 0X6A, 0X69, 0X68,
-  0X67, 0X65, 0X64, 0X62, 0X60, 0X5E, 0X5C, 0X59, 0X56, 0X53, 0X50, 0X4D,
-  0X49, 0X44, 0X41, 0X3D, 0X37, 0X33, 0X2D, 0X28, 0X21, 0X1A, 0X13, 0X0C,
-  0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X0B, 0X11, 0X18,
-  0X1C, 0X22, 0X27, 0X2B, 0X30, 0X34, 0X37, 0X3B, 0X3E, 0X41, 0X44, 0X47,
-  0X4B, 0X4D, 0X4F, 0X52, 0X54, 0X55, 0X57, 0X5A, 0X5B, 0X5D, 0X5E, 0X5F,
-  0X60, 0X61, 0X62, 0X62, 0X63, 0X63, 0X64, 0X64, 0X64, 0X64, 0X64, 0X64,
-  0X64, 0X63, 0X62, 0X62, 0X61, 0X60, 0X5F, 0X5E, 0X5C, 0X5B, 0X59, 0X56,
-  0X54, 0X52, 0X50, 0X4D, 0X4B, 0X46, 0X43, 0X40, 0X3C, 0X37, 0X33, 0X2D,
-  0X2A, 0X23, 0X1E, 0X18, 0X11, 0X0A, 0X03, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X01, 0X03, 0X07, 0X0D, 0X13, 0X19, 0X1E,
-  0X22, 0X27, 0X2B, 0X2E, 0X32, 0X36, 0X39, 0X3D, 0X3F, 0X42, 0X44, 0X46,
-  0X4A, 0X4C, 0X4D, 0X4F, 0X51, 0X52, 0X53, 0X55, 0X56, 0X56, 0X57, 0X59,
-  0X59, 0X5A, 0X5A, 0X5A, 0X5B, 0X5A, 0X5A, 0X5A, 0X5A, 0X59, 0X59, 0X57,
-  0X56, 0X55, 0X54, 0X53, 0X51, 0X50, 0X4E, 0X4C, 0X49, 0X46, 0X43, 0X41,
-  0X3E, 0X3B, 0X36, 0X33, 0X2E, 0X2A, 0X24, 0X20, 0X1A, 0X14, 0X0D, 0X06,
-  0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X01, 0X05, 0X0A, 0X0E, 0X14, 0X19, 0X1E, 0X21,
-  0X26, 0X29, 0X2C, 0X31, 0X33, 0X36, 0X39, 0X3C, 0X3E, 0X40, 0X42, 0X44,
-  0X45, 0X47, 0X49, 0X4B, 0X4C, 0X4D, 0X4E, 0X4E, 0X4F, 0X4F, 0X4F, 0X50,
-  0X50, 0X50, 0X50, 0X4F, 0X4F, 0X4E, 0X4E, 0X4D, 0X4C, 0X4B, 0X49, 0X47,
-  0X45, 0X43, 0X41, 0X3F, 0X3D, 0X3B, 0X37, 0X34, 0X31, 0X2C, 0X29, 0X24,
-  0X20, 0X1A, 0X16, 0X0E, 0X0A, 0X04, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X02, 0X06, 0X0A, 0X0E, 0X13, 0X18, 0X1C, 0X20, 0X23,
-  0X28, 0X2A, 0X2D, 0X30, 0X33, 0X35, 0X37, 0X39, 0X3B, 0X3D, 0X3E, 0X3F,
-  0X40, 0X41, 0X42, 0X43, 0X44, 0X44, 0X44, 0X45, 0X45, 0X45, 0X44, 0X44,
-  0X43, 0X43, 0X42, 0X41, 0X40, 0X3F, 0X3D, 0X3C, 0X39, 0X38, 0X35, 0X33,
-  0X30, 0X2D, 0X2A, 0X27, 0X23, 0X1F, 0X1A, 0X16, 0X10, 0X0A, 0X05, 0X01,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X02, 0X05, 0X09, 0X0D, 0X12, 0X16, 0X1A, 0X1E, 0X21, 0X23,
-  0X27, 0X29, 0X2B, 0X2D, 0X30, 0X31, 0X33, 0X34, 0X35, 0X36, 0X37, 0X38,
-  0X38, 0X39, 0X39, 0X39, 0X39, 0X39, 0X39, 0X38, 0X38, 0X37, 0X36, 0X35,
-  0X34, 0X33, 0X31, 0X30, 0X2D, 0X2B, 0X28, 0X26, 0X22, 0X20, 0X1B, 0X18,
-  0X13, 0X0E, 0X0A, 0X05, 0X02, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X02, 0X05, 0X09, 0X0D, 0X11, 0X14, 0X18, 0X1A, 0X1E, 0X20, 0X22,
-  0X24, 0X27, 0X28, 0X2A, 0X2A, 0X2C, 0X2C, 0X2D, 0X2E, 0X2E, 0X2E, 0X2E,
-  0X2E, 0X2E, 0X2E, 0X2E, 0X2D, 0X2C, 0X2B, 0X2A, 0X29, 0X28, 0X26, 0X23,
-  0X21, 0X1F, 0X1B, 0X19, 0X16, 0X12, 0X0E, 0X0A, 0X06, 0X02, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X03, 0X06, 0X0A, 0X0D, 0X10, 0X12, 0X16, 0X18, 0X19, 0X1B, 0X1C,
-  0X1F, 0X20, 0X21, 0X21, 0X22, 0X22, 0X23, 0X23, 0X23, 0X22, 0X22, 0X22,
-  0X21, 0X20, 0X1F, 0X1E, 0X1B, 0X1A, 0X18, 0X16, 0X12, 0X10, 0X0C, 0X0A,
-  0X06, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X01, 0X03, 0X05, 0X07, 0X09, 0X0B, 0X0D, 0X10, 0X11, 0X12, 0X13, 0X14,
-  0X14, 0X16, 0X16, 0X16, 0X16, 0X16, 0X14, 0X14, 0X13, 0X12, 0X11, 0X10,
-  0X0D, 0X0B, 0X09, 0X06, 0X04, 0X03, 0X01, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X01, 0X02, 0X03, 0X04, 0X05, 0X06, 0X06, 0X07, 0X07, 0X07, 0X07,
-  0X07, 0X07, 0X06, 0X06, 0X05, 0X04, 0X03, 0X02, 0X01, 0X01, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
-  0X00, 0X00, 0X00, 0X00 };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("newtEye_upper");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("newtEye_lower");
 #endif // SYMMETRICAL_EYELID
 
 #define IRIS_WIDTH  80
 #define IRIS_HEIGHT 80
 
-const uint16_t polar[80 * 80] PROGMEM= {
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X3A00, 0X3B00, 0X3C01, 0X3D01, 0X3E01, 0X3F01,
-  0X4081, 0X4181, 0X4281, 0X4381, 0X4480, 0X4580, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X3500, 0X3601, 0X3701,
-  0X3802, 0X3903, 0X3A03, 0X3B03, 0X3C04, 0X3D04, 0X3E04, 0X3F04,
-  0X4084, 0X4184, 0X4284, 0X4384, 0X4483, 0X4583, 0X4683, 0X4782,
-  0X4881, 0X4981, 0X4A80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X3180, 0X3281, 0X3382, 0X3483, 0X3584, 0X3684,
-  0X3785, 0X3906, 0X3A06, 0X3B07, 0X3C07, 0X3D07, 0X3E07, 0X3F07,
-  0X4087, 0X4187, 0X4287, 0X4387, 0X4487, 0X4586, 0X4686, 0X4805,
-  0X4904, 0X4A04, 0X4B03, 0X4C02, 0X4D01, 0X4E00, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X2F81, 0X3082, 0X3183, 0X3284, 0X3385, 0X3486, 0X3587, 0X3688,
-  0X3788, 0X3889, 0X3989, 0X3B0A, 0X3C0A, 0X3D0A, 0X3E0B, 0X3F0B,
-  0X408B, 0X418B, 0X428A, 0X438A, 0X448A, 0X4609, 0X4709, 0X4808,
-  0X4908, 0X4A07, 0X4B06, 0X4C05, 0X4D04, 0X4E03, 0X4F02, 0X5001,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2D01, 0X2E02,
-  0X2F04, 0X3005, 0X3106, 0X3207, 0X3308, 0X3409, 0X350A, 0X360B,
-  0X378B, 0X388C, 0X398D, 0X3A8D, 0X3B8D, 0X3D0E, 0X3E0E, 0X3F0E,
-  0X408E, 0X418E, 0X428E, 0X440D, 0X450D, 0X460D, 0X470C, 0X480B,
-  0X498B, 0X4A8A, 0X4B89, 0X4C88, 0X4D87, 0X4E86, 0X4F85, 0X5084,
-  0X5182, 0X5281, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X2B01, 0X2B82, 0X2C84, 0X2D85,
-  0X2E86, 0X2F88, 0X3089, 0X318A, 0X328B, 0X338C, 0X350D, 0X360E,
-  0X370F, 0X380F, 0X3990, 0X3A90, 0X3B91, 0X3D11, 0X3E11, 0X3F11,
-  0X4091, 0X4191, 0X4291, 0X4411, 0X4510, 0X4610, 0X478F, 0X488F,
-  0X498E, 0X4A8D, 0X4C0C, 0X4D0B, 0X4E0A, 0X4F09, 0X5008, 0X5106,
-  0X5205, 0X5304, 0X5402, 0X5481, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X2880, 0X2982, 0X2A83, 0X2B05, 0X2C07, 0X2D08,
-  0X2E09, 0X2F0B, 0X300C, 0X310D, 0X328E, 0X338F, 0X3490, 0X3591,
-  0X3712, 0X3812, 0X3913, 0X3A93, 0X3B94, 0X3C94, 0X3E14, 0X3F14,
-  0X4094, 0X4194, 0X4314, 0X4414, 0X4513, 0X4693, 0X4792, 0X4892,
-  0X4A11, 0X4B10, 0X4C0F, 0X4D0E, 0X4E8D, 0X4F8C, 0X508B, 0X5189,
-  0X5288, 0X5387, 0X5485, 0X5503, 0X5602, 0X5700, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X2701, 0X2803, 0X2905, 0X2986, 0X2A88, 0X2B89, 0X2C8B,
-  0X2D8C, 0X2E8E, 0X2F8F, 0X3110, 0X3211, 0X3312, 0X3413, 0X3594,
-  0X3695, 0X3795, 0X3916, 0X3A17, 0X3B97, 0X3C97, 0X3E17, 0X3F17,
-  0X4097, 0X4197, 0X4317, 0X4417, 0X4597, 0X4696, 0X4815, 0X4915,
-  0X4A14, 0X4B93, 0X4C92, 0X4D91, 0X4E90, 0X500F, 0X510E, 0X520C,
-  0X530B, 0X5409, 0X5508, 0X5606, 0X5685, 0X5783, 0X5881, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2500,
-  0X2582, 0X2684, 0X2785, 0X2807, 0X2909, 0X2A0B, 0X2B0C, 0X2C0E,
-  0X2D0F, 0X2E11, 0X2F92, 0X3093, 0X3194, 0X3295, 0X3416, 0X3517,
-  0X3618, 0X3799, 0X3899, 0X3A1A, 0X3B1A, 0X3C9A, 0X3E1B, 0X3F1B,
-  0X409B, 0X419B, 0X431A, 0X449A, 0X459A, 0X4719, 0X4819, 0X4998,
-  0X4A97, 0X4B96, 0X4D15, 0X4E14, 0X4F13, 0X5012, 0X5191, 0X528F,
-  0X538E, 0X548C, 0X558B, 0X5689, 0X5787, 0X5805, 0X5904, 0X5A02,
-  0X5A80, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2380, 0X2402,
-  0X2504, 0X2606, 0X2688, 0X278A, 0X288C, 0X298D, 0X2A8F, 0X2B91,
-  0X2C92, 0X2D93, 0X2F15, 0X3016, 0X3117, 0X3218, 0X3399, 0X349A,
-  0X361B, 0X371C, 0X389C, 0X3A1D, 0X3B1D, 0X3C9E, 0X3D9E, 0X3F1E,
-  0X409E, 0X421E, 0X431E, 0X449D, 0X459D, 0X471C, 0X489C, 0X499B,
-  0X4B1A, 0X4C19, 0X4D98, 0X4E97, 0X4F96, 0X5095, 0X5213, 0X5312,
-  0X5411, 0X550F, 0X560D, 0X570C, 0X580A, 0X5908, 0X5986, 0X5A84,
-  0X5B82, 0X5C00, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X2201, 0X2283, 0X2385,
-  0X2487, 0X2509, 0X260B, 0X270D, 0X280E, 0X2910, 0X2A12, 0X2B13,
-  0X2C15, 0X2D16, 0X2E98, 0X2F99, 0X309A, 0X321B, 0X331C, 0X349D,
-  0X359E, 0X371F, 0X381F, 0X39A0, 0X3B20, 0X3CA1, 0X3DA1, 0X3F21,
-  0X40A1, 0X4221, 0X4321, 0X44A0, 0X4620, 0X479F, 0X489F, 0X4A1E,
-  0X4B1D, 0X4C9C, 0X4D9B, 0X4F1A, 0X5019, 0X5118, 0X5296, 0X5395,
-  0X5493, 0X5592, 0X5690, 0X578E, 0X588D, 0X598B, 0X5A89, 0X5B07,
-  0X5C05, 0X5D03, 0X5D81, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X2081, 0X2103, 0X2205, 0X2307,
-  0X2389, 0X248B, 0X258D, 0X268F, 0X2791, 0X2893, 0X2994, 0X2A96,
-  0X2B98, 0X2C99, 0X2D9B, 0X2F1C, 0X301D, 0X319E, 0X329F, 0X3420,
-  0X35A1, 0X36A2, 0X3823, 0X39A3, 0X3B24, 0X3C24, 0X3DA4, 0X3F24,
-  0X40A4, 0X4224, 0X43A4, 0X44A4, 0X4623, 0X47A3, 0X4922, 0X4A21,
-  0X4BA0, 0X4D1F, 0X4E1E, 0X4F9D, 0X509C, 0X521B, 0X5319, 0X5418,
-  0X5516, 0X5614, 0X5713, 0X5811, 0X590F, 0X5A0D, 0X5B0B, 0X5C09,
-  0X5C87, 0X5D85, 0X5E83, 0X5F01, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X1F01, 0X2003, 0X2085, 0X2187, 0X220A,
-  0X230C, 0X240E, 0X2490, 0X2592, 0X2694, 0X2795, 0X2897, 0X2999,
-  0X2B1A, 0X2C1C, 0X2D1D, 0X2E9F, 0X2FA0, 0X3121, 0X3222, 0X33A3,
-  0X3524, 0X36A5, 0X37A6, 0X3926, 0X3AA7, 0X3C27, 0X3DA7, 0X3F27,
-  0X40A7, 0X4227, 0X43A7, 0X4527, 0X46A6, 0X4826, 0X4925, 0X4AA4,
-  0X4C23, 0X4DA2, 0X4EA1, 0X5020, 0X511F, 0X529D, 0X539C, 0X549A,
-  0X5619, 0X5717, 0X5815, 0X5914, 0X5A12, 0X5B10, 0X5B8E, 0X5C8C,
-  0X5D8A, 0X5E07, 0X5F05, 0X6003, 0X6081, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X1D81, 0X1E83, 0X1F05, 0X2008, 0X208A, 0X218C,
-  0X220E, 0X2310, 0X2412, 0X2514, 0X2616, 0X2718, 0X281A, 0X291C,
-  0X2A1D, 0X2B9F, 0X2CA0, 0X2E22, 0X2F23, 0X30A4, 0X31A5, 0X3326,
-  0X34A7, 0X3628, 0X37A9, 0X3929, 0X3AAA, 0X3C2A, 0X3DAB, 0X3F2B,
-  0X40AB, 0X422B, 0X43AA, 0X452A, 0X46A9, 0X4829, 0X49A8, 0X4B27,
-  0X4CA6, 0X4E25, 0X4F24, 0X50A3, 0X51A2, 0X5320, 0X541F, 0X559D,
-  0X569C, 0X579A, 0X5898, 0X5996, 0X5A94, 0X5B92, 0X5C90, 0X5D8E,
-  0X5E0C, 0X5F0A, 0X6008, 0X6085, 0X6103, 0X6201, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X1C00, 0X1D03, 0X1D85, 0X1E07, 0X1F0A, 0X200C, 0X208E,
-  0X2191, 0X2293, 0X2315, 0X2417, 0X2519, 0X261B, 0X271D, 0X289E,
-  0X29A0, 0X2AA2, 0X2C23, 0X2D25, 0X2EA6, 0X3027, 0X3128, 0X32A9,
-  0X342A, 0X35AB, 0X372C, 0X38AD, 0X3A2D, 0X3C2E, 0X3DAE, 0X3F2E,
-  0X40AE, 0X422E, 0X43AE, 0X45AD, 0X472D, 0X48AC, 0X4A2B, 0X4BAA,
-  0X4D29, 0X4EA8, 0X4FA7, 0X5126, 0X52A5, 0X53A3, 0X5522, 0X5620,
-  0X571E, 0X589D, 0X599B, 0X5A99, 0X5B97, 0X5C95, 0X5D13, 0X5E11,
-  0X5F0E, 0X600C, 0X608A, 0X6187, 0X6205, 0X6283, 0X6380, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X1A80, 0X1B82, 0X1C05, 0X1C87, 0X1D8A, 0X1E0C, 0X1F0E, 0X2011,
-  0X2093, 0X2195, 0X2297, 0X2399, 0X249B, 0X259D, 0X269F, 0X27A1,
-  0X2923, 0X2A24, 0X2B26, 0X2CA7, 0X2E29, 0X2FAA, 0X30AB, 0X322D,
-  0X33AE, 0X352E, 0X372F, 0X38B0, 0X3A30, 0X3BB1, 0X3DB1, 0X3F31,
-  0X40B1, 0X4231, 0X4431, 0X45B0, 0X4730, 0X48AF, 0X4AAE, 0X4C2E,
-  0X4DAD, 0X4F2B, 0X502A, 0X51A9, 0X5327, 0X54A6, 0X55A4, 0X56A3,
-  0X5821, 0X591F, 0X5A1D, 0X5B1B, 0X5C19, 0X5D17, 0X5E15, 0X5F13,
-  0X6011, 0X608E, 0X618C, 0X620A, 0X6307, 0X6385, 0X6402, 0X6500,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X1A02, 0X1A84, 0X1B07, 0X1C09, 0X1C8C, 0X1D8E, 0X1E11, 0X1F13,
-  0X2015, 0X2097, 0X219A, 0X229C, 0X239E, 0X24A0, 0X25A2, 0X2724,
-  0X2825, 0X2927, 0X2AA9, 0X2C2A, 0X2D2C, 0X2EAD, 0X302E, 0X31B0,
-  0X3331, 0X3531, 0X36B2, 0X3833, 0X39B3, 0X3BB4, 0X3D34, 0X3F34,
-  0X40B4, 0X42B4, 0X4434, 0X4633, 0X47B3, 0X4932, 0X4AB1, 0X4CB1,
-  0X4E30, 0X4FAE, 0X512D, 0X52AC, 0X53AA, 0X5529, 0X56A7, 0X57A5,
-  0X58A4, 0X5A22, 0X5B20, 0X5C1E, 0X5D1C, 0X5E1A, 0X5F17, 0X6015,
-  0X6093, 0X6191, 0X620E, 0X630C, 0X6389, 0X6487, 0X6504, 0X6582,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1881,
-  0X1904, 0X1986, 0X1A89, 0X1B0B, 0X1B8E, 0X1C90, 0X1D13, 0X1E15,
-  0X1F17, 0X201A, 0X209C, 0X219E, 0X22A0, 0X23A2, 0X2524, 0X2626,
-  0X2728, 0X28AA, 0X29AC, 0X2B2D, 0X2CAF, 0X2E30, 0X2FB1, 0X3133,
-  0X32B4, 0X34B5, 0X3635, 0X37B6, 0X39B7, 0X3B37, 0X3D37, 0X3F37,
-  0X40B7, 0X42B7, 0X44B7, 0X4637, 0X4836, 0X49B5, 0X4B35, 0X4D34,
-  0X4EB3, 0X5031, 0X51B0, 0X532F, 0X54AD, 0X562C, 0X572A, 0X58A8,
-  0X59A6, 0X5AA4, 0X5C22, 0X5D20, 0X5E1E, 0X5F1C, 0X601A, 0X6097,
-  0X6195, 0X6293, 0X6310, 0X640E, 0X648B, 0X6509, 0X6606, 0X6684,
-  0X6701, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1700, 0X1783,
-  0X1805, 0X1908, 0X198B, 0X1A0D, 0X1B10, 0X1B92, 0X1C95, 0X1D17,
-  0X1E1A, 0X1F1C, 0X201E, 0X20A0, 0X21A3, 0X2325, 0X2427, 0X2529,
-  0X26AB, 0X27AD, 0X292E, 0X2AB0, 0X2BB1, 0X2D33, 0X2F34, 0X30B6,
-  0X3237, 0X3438, 0X35B8, 0X37B9, 0X393A, 0X3B3A, 0X3D3B, 0X3F3B,
-  0X40BB, 0X42BB, 0X44BA, 0X46BA, 0X4839, 0X4A38, 0X4BB8, 0X4DB7,
-  0X4F36, 0X50B4, 0X52B3, 0X5431, 0X5530, 0X56AE, 0X582D, 0X592B,
-  0X5AA9, 0X5BA7, 0X5CA5, 0X5E23, 0X5F20, 0X601E, 0X609C, 0X619A,
-  0X6297, 0X6315, 0X6412, 0X6490, 0X658D, 0X660B, 0X6688, 0X6785,
-  0X6803, 0X6880, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1602, 0X1685,
-  0X1787, 0X180A, 0X188D, 0X190F, 0X1A12, 0X1A94, 0X1B97, 0X1C19,
-  0X1D1C, 0X1E1E, 0X1F20, 0X2023, 0X2125, 0X2227, 0X2329, 0X242B,
-  0X25AD, 0X26AF, 0X2831, 0X29B3, 0X2B34, 0X2CB6, 0X2E37, 0X2FB8,
-  0X31BA, 0X333B, 0X353C, 0X373C, 0X393D, 0X3B3D, 0X3D3E, 0X3F3E,
-  0X40BE, 0X42BE, 0X44BD, 0X46BD, 0X48BC, 0X4ABC, 0X4CBB, 0X4E3A,
-  0X5038, 0X51B7, 0X5336, 0X54B4, 0X5633, 0X57B1, 0X592F, 0X5A2D,
-  0X5BAB, 0X5CA9, 0X5DA7, 0X5EA5, 0X6023, 0X60A0, 0X619E, 0X629C,
-  0X6399, 0X6417, 0X6514, 0X6592, 0X668F, 0X670D, 0X678A, 0X6807,
-  0X6905, 0X6982, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1481, 0X1503, 0X1606,
-  0X1689, 0X170C, 0X178E, 0X1811, 0X1914, 0X1996, 0X1A99, 0X1B1B,
-  0X1C1E, 0X1D20, 0X1E23, 0X1EA5, 0X2027, 0X2129, 0X222C, 0X232E,
-  0X24B0, 0X25B2, 0X2734, 0X28B5, 0X2A37, 0X2BB9, 0X2DBA, 0X2F3B,
-  0X313D, 0X32BE, 0X34BF, 0X36BF, 0X38C0, 0X3AC1, 0X3CC1, 0X3EC1,
-  0X4141, 0X4341, 0X4541, 0X4740, 0X493F, 0X4B3F, 0X4D3E, 0X4EBD,
-  0X50BB, 0X523A, 0X5439, 0X55B7, 0X5735, 0X58B4, 0X5A32, 0X5B30,
-  0X5CAE, 0X5DAC, 0X5EA9, 0X6027, 0X6125, 0X61A3, 0X62A0, 0X639E,
-  0X649B, 0X6519, 0X6616, 0X6694, 0X6791, 0X680E, 0X688C, 0X6909,
-  0X6986, 0X6A83, 0X6B01, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X1402, 0X1485, 0X1508,
-  0X158B, 0X160D, 0X1690, 0X1713, 0X1815, 0X1898, 0X199B, 0X1A1D,
-  0X1B20, 0X1C22, 0X1CA5, 0X1DA7, 0X1EA9, 0X202C, 0X212E, 0X2230,
-  0X23B2, 0X24B4, 0X2636, 0X27B8, 0X293A, 0X2ABB, 0X2CBD, 0X2E3E,
-  0X3040, 0X3241, 0X3442, 0X3643, 0X3843, 0X3AC4, 0X3CC4, 0X3EC4,
-  0X4144, 0X4344, 0X4544, 0X47C3, 0X49C3, 0X4BC2, 0X4DC1, 0X4FC0,
-  0X51BE, 0X533D, 0X553B, 0X56BA, 0X5838, 0X59B6, 0X5B34, 0X5C32,
-  0X5DB0, 0X5EAE, 0X602C, 0X6129, 0X6227, 0X6325, 0X63A2, 0X64A0,
-  0X659D, 0X661B, 0X6718, 0X6795, 0X6893, 0X6910, 0X698D, 0X6A0B,
-  0X6A88, 0X6B05, 0X6B82, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X1281, 0X1304, 0X1387, 0X1409,
-  0X148C, 0X150F, 0X1592, 0X1614, 0X1717, 0X179A, 0X189D, 0X191F,
-  0X1A22, 0X1AA4, 0X1BA7, 0X1CA9, 0X1DAC, 0X1EAE, 0X2030, 0X2133,
-  0X2235, 0X23B7, 0X2539, 0X26BB, 0X283C, 0X29BE, 0X2BC0, 0X2DC1,
-  0X2FC3, 0X31C4, 0X33C5, 0X35C6, 0X37C6, 0X3A47, 0X3CC7, 0X3EC7,
-  0X4147, 0X4347, 0X45C7, 0X4846, 0X4A46, 0X4C45, 0X4E44, 0X5043,
-  0X5241, 0X5440, 0X563E, 0X57BC, 0X593B, 0X5AB9, 0X5C37, 0X5DB5,
-  0X5EB3, 0X6030, 0X612E, 0X622C, 0X6329, 0X6427, 0X6524, 0X65A2,
-  0X669F, 0X671D, 0X681A, 0X6897, 0X6994, 0X6A12, 0X6A8F, 0X6B0C,
-  0X6B89, 0X6C07, 0X6C84, 0X6D01, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X1182, 0X1205, 0X1288, 0X130B,
-  0X138E, 0X1411, 0X1493, 0X1516, 0X1619, 0X169C, 0X171E, 0X1821,
-  0X18A4, 0X19A6, 0X1AA9, 0X1BAB, 0X1CAE, 0X1DB0, 0X1EB3, 0X2035,
-  0X2137, 0X22B9, 0X243B, 0X25BD, 0X273F, 0X28C1, 0X2AC3, 0X2CC4,
-  0X2EC6, 0X30C7, 0X32C8, 0X3549, 0X374A, 0X39CA, 0X3C4A, 0X3ECB,
-  0X414B, 0X43CA, 0X464A, 0X48CA, 0X4AC9, 0X4D48, 0X4F47, 0X5146,
-  0X5344, 0X5543, 0X5741, 0X58BF, 0X5A3D, 0X5BBB, 0X5D39, 0X5EB7,
-  0X6035, 0X6133, 0X6230, 0X632E, 0X642B, 0X6529, 0X6626, 0X6724,
-  0X67A1, 0X689E, 0X691C, 0X6999, 0X6A96, 0X6B13, 0X6B91, 0X6C0E,
-  0X6C8B, 0X6D08, 0X6D85, 0X6E02, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X1001, 0X1084, 0X1106, 0X1189, 0X120C,
-  0X128F, 0X1312, 0X1395, 0X1418, 0X149A, 0X159D, 0X1620, 0X16A3,
-  0X17A5, 0X18A8, 0X192B, 0X1A2D, 0X1B30, 0X1C32, 0X1DB5, 0X1EB7,
-  0X2039, 0X213C, 0X22BE, 0X2440, 0X25C2, 0X27C4, 0X29C5, 0X2BC7,
-  0X2DC8, 0X2FCA, 0X324B, 0X344C, 0X36CD, 0X394D, 0X3C4E, 0X3ECE,
-  0X414E, 0X43CE, 0X46CD, 0X494D, 0X4BCC, 0X4DCB, 0X504A, 0X5248,
-  0X5447, 0X5645, 0X5844, 0X5A42, 0X5BC0, 0X5D3E, 0X5EBC, 0X6039,
-  0X6137, 0X6235, 0X63B2, 0X64B0, 0X65AD, 0X66AB, 0X6728, 0X6825,
-  0X6923, 0X69A0, 0X6A1D, 0X6B1A, 0X6B98, 0X6C15, 0X6C92, 0X6D0F,
-  0X6D8C, 0X6E09, 0X6E86, 0X6F04, 0X6F81, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X0F02, 0X0F85, 0X1008, 0X108B, 0X110E,
-  0X1191, 0X1213, 0X1296, 0X1319, 0X139C, 0X141F, 0X1522, 0X15A4,
-  0X16A7, 0X172A, 0X182D, 0X192F, 0X1A32, 0X1B34, 0X1C37, 0X1D39,
-  0X1EBC, 0X203E, 0X2140, 0X2342, 0X24C4, 0X2646, 0X2848, 0X2A4A,
-  0X2CCB, 0X2ECD, 0X314E, 0X33CF, 0X3650, 0X3950, 0X3BD1, 0X3ED1,
-  0X4151, 0X4451, 0X46D0, 0X49D0, 0X4C4F, 0X4ECE, 0X514D, 0X534B,
-  0X55CA, 0X57C8, 0X59C6, 0X5B44, 0X5CC2, 0X5EC0, 0X603E, 0X613C,
-  0X62B9, 0X63B7, 0X64B4, 0X65B2, 0X66AF, 0X67AD, 0X68AA, 0X6927,
-  0X6A24, 0X6AA2, 0X6B9F, 0X6C1C, 0X6C99, 0X6D16, 0X6D93, 0X6E11,
-  0X6E8E, 0X6F0B, 0X6F88, 0X7005, 0X7082, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0E00, 0X0E03, 0X0E86, 0X0F09, 0X0F8C, 0X100F,
-  0X1012, 0X1095, 0X1118, 0X121B, 0X129D, 0X1320, 0X13A3, 0X14A6,
-  0X1529, 0X162C, 0X16AE, 0X17B1, 0X18B4, 0X19B6, 0X1AB9, 0X1BBB,
-  0X1D3E, 0X1EC0, 0X2042, 0X21C5, 0X2347, 0X2549, 0X274B, 0X294C,
-  0X2B4E, 0X2DD0, 0X3051, 0X32D2, 0X35D3, 0X38D4, 0X3B54, 0X3E54,
-  0X41D4, 0X44D4, 0X4754, 0X4A53, 0X4D52, 0X4FD1, 0X5250, 0X54CE,
-  0X56CC, 0X58CB, 0X5AC9, 0X5CC7, 0X5E45, 0X6042, 0X6140, 0X62BE,
-  0X643B, 0X6539, 0X6636, 0X6734, 0X6831, 0X692E, 0X69AC, 0X6AA9,
-  0X6B26, 0X6C23, 0X6CA0, 0X6D1D, 0X6D9B, 0X6E98, 0X6F15, 0X6F92,
-  0X6F8F, 0X700C, 0X7089, 0X7106, 0X7183, 0X7180, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0D01, 0X0D04, 0X0D87, 0X0E0A, 0X0E8D, 0X0E90,
-  0X0F13, 0X0F96, 0X1019, 0X109C, 0X111F, 0X11A2, 0X12A5, 0X1327,
-  0X13AA, 0X14AD, 0X1530, 0X1633, 0X1735, 0X1838, 0X193B, 0X1A3D,
-  0X1BC0, 0X1CC2, 0X1E45, 0X2047, 0X21C9, 0X23CB, 0X25CD, 0X27CF,
-  0X29D1, 0X2C52, 0X2F54, 0X31D5, 0X34D6, 0X37D7, 0X3B57, 0X3E57,
-  0X41D7, 0X44D7, 0X4857, 0X4B56, 0X4E55, 0X50D4, 0X53D2, 0X5651,
-  0X584F, 0X5A4D, 0X5C4B, 0X5E49, 0X6047, 0X61C5, 0X6342, 0X6440,
-  0X65BD, 0X66BB, 0X67B8, 0X68B5, 0X69B3, 0X6AB0, 0X6B2D, 0X6C2A,
-  0X6CA7, 0X6D25, 0X6E22, 0X6E9F, 0X6F1C, 0X6F99, 0X7016, 0X7093,
-  0X7110, 0X710D, 0X718A, 0X7207, 0X7284, 0X7281, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X0C02, 0X0C05, 0X0C88, 0X0D0B, 0X0D0E, 0X0D91,
-  0X0E14, 0X0E97, 0X0F1A, 0X0F9D, 0X1020, 0X10A3, 0X1126, 0X11A9,
-  0X12AC, 0X132F, 0X1431, 0X14B4, 0X15B7, 0X16BA, 0X17BC, 0X18BF,
-  0X1A42, 0X1B44, 0X1CC7, 0X1E49, 0X204B, 0X21CE, 0X23D0, 0X2652,
-  0X2854, 0X2B55, 0X2DD7, 0X30D8, 0X33D9, 0X375A, 0X3ADA, 0X3E5B,
-  0X41DB, 0X455A, 0X48DA, 0X4C59, 0X4F58, 0X5257, 0X54D5, 0X57D4,
-  0X59D2, 0X5C50, 0X5E4E, 0X604B, 0X61C9, 0X6347, 0X64C4, 0X65C2,
-  0X673F, 0X683C, 0X693A, 0X6A37, 0X6B34, 0X6BB1, 0X6CAF, 0X6D2C,
-  0X6E29, 0X6EA6, 0X6F23, 0X6FA0, 0X701D, 0X709A, 0X7117, 0X7194,
-  0X7211, 0X728E, 0X728B, 0X7308, 0X7385, 0X7382, 0X007F, 0X007F,
-  0X007F, 0X0A80, 0X0B03, 0X0B06, 0X0B89, 0X0C0C, 0X0C0F, 0X0C92,
-  0X0D15, 0X0D98, 0X0D9B, 0X0E1E, 0X0EA1, 0X0F24, 0X0FA7, 0X102A,
-  0X112D, 0X11B0, 0X12B3, 0X1336, 0X1439, 0X153B, 0X163E, 0X1741,
-  0X1844, 0X19C6, 0X1AC9, 0X1C4B, 0X1E4E, 0X2050, 0X2252, 0X2454,
-  0X26D6, 0X2958, 0X2C5A, 0X2FDB, 0X32DC, 0X365D, 0X3A5E, 0X3E5E,
-  0X41DE, 0X45DE, 0X49DD, 0X4D5C, 0X505B, 0X53DA, 0X56D8, 0X5956,
-  0X5BD4, 0X5DD2, 0X6050, 0X61CE, 0X63CB, 0X6549, 0X6646, 0X67C4,
-  0X68C1, 0X69BE, 0X6ABB, 0X6BB9, 0X6CB6, 0X6D33, 0X6E30, 0X6EAD,
-  0X6FAA, 0X7027, 0X70A4, 0X7121, 0X719E, 0X721B, 0X7218, 0X7295,
-  0X7312, 0X738F, 0X738C, 0X7409, 0X7486, 0X7483, 0X7500, 0X007F,
-  0X007F, 0X0981, 0X0A04, 0X0A07, 0X0A8A, 0X0A8D, 0X0B10, 0X0B93,
-  0X0B96, 0X0C19, 0X0C9C, 0X0D1F, 0X0DA2, 0X0E25, 0X0EA8, 0X0F2B,
-  0X0FAE, 0X1031, 0X10B4, 0X11B7, 0X123A, 0X133D, 0X1440, 0X1543,
-  0X1645, 0X17C8, 0X18CB, 0X1A4D, 0X1C50, 0X1DD2, 0X2055, 0X2257,
-  0X24D9, 0X27DB, 0X2ADC, 0X2DDE, 0X31DF, 0X35E0, 0X39E1, 0X3DE1,
-  0X4261, 0X4661, 0X4A60, 0X4E5F, 0X525E, 0X555C, 0X585B, 0X5B59,
-  0X5DD7, 0X6055, 0X6252, 0X63D0, 0X65CD, 0X674B, 0X6848, 0X69C5,
-  0X6AC3, 0X6BC0, 0X6CBD, 0X6DBA, 0X6E37, 0X6F34, 0X6FB1, 0X702E,
-  0X70AB, 0X7128, 0X71A5, 0X7222, 0X729F, 0X731C, 0X7399, 0X7416,
-  0X7413, 0X7490, 0X750D, 0X750A, 0X7587, 0X7584, 0X7601, 0X007F,
-  0X007F, 0X0881, 0X0904, 0X0908, 0X098B, 0X098E, 0X0A11, 0X0A14,
-  0X0A97, 0X0B1A, 0X0B1D, 0X0BA0, 0X0C23, 0X0CA6, 0X0D29, 0X0DAD,
-  0X0E30, 0X0EB3, 0X0F36, 0X1038, 0X10BB, 0X11BE, 0X1241, 0X1344,
-  0X1447, 0X15CA, 0X16CC, 0X184F, 0X19D2, 0X1BD4, 0X1DD7, 0X2059,
-  0X22DB, 0X255D, 0X28DF, 0X2C61, 0X3062, 0X3463, 0X38E4, 0X3DE4,
-  0X4264, 0X4764, 0X4BE3, 0X4FE2, 0X53E1, 0X575F, 0X5ADD, 0X5D5B,
-  0X6059, 0X6257, 0X6454, 0X6652, 0X67CF, 0X694C, 0X6A4A, 0X6BC7,
-  0X6CC4, 0X6DC1, 0X6E3E, 0X6F3B, 0X6FB8, 0X70B6, 0X7133, 0X71B0,
-  0X722D, 0X72A9, 0X7326, 0X73A3, 0X7420, 0X749D, 0X749A, 0X7517,
-  0X7594, 0X7591, 0X760E, 0X760B, 0X7688, 0X7684, 0X7701, 0X007F,
-  0X007F, 0X0782, 0X0805, 0X0808, 0X080B, 0X088F, 0X0892, 0X0915,
-  0X0998, 0X099B, 0X0A1E, 0X0A21, 0X0AA4, 0X0B27, 0X0BAA, 0X0C2E,
-  0X0CB1, 0X0D34, 0X0DB7, 0X0E3A, 0X0EBD, 0X0FC0, 0X1043, 0X1146,
-  0X1248, 0X134B, 0X14CE, 0X1651, 0X17D4, 0X1956, 0X1B59, 0X1D5B,
-  0X205E, 0X22E0, 0X2662, 0X29E4, 0X2E65, 0X32E6, 0X37E7, 0X3D67,
-  0X42E7, 0X4867, 0X4D66, 0X51E5, 0X5664, 0X59E2, 0X5D60, 0X605E,
-  0X62DB, 0X64D9, 0X66D6, 0X6854, 0X69D1, 0X6B4E, 0X6CCB, 0X6DC8,
-  0X6EC6, 0X6FC3, 0X7040, 0X713D, 0X71BA, 0X7237, 0X72B4, 0X7331,
-  0X73AE, 0X742A, 0X74A7, 0X7524, 0X75A1, 0X759E, 0X761B, 0X7618,
-  0X7695, 0X7712, 0X770F, 0X778B, 0X7788, 0X7785, 0X7802, 0X007F,
-  0X007F, 0X0683, 0X0686, 0X0709, 0X070C, 0X078F, 0X0792, 0X0815,
-  0X0819, 0X089C, 0X089F, 0X0922, 0X0925, 0X09A8, 0X0A2B, 0X0AAE,
-  0X0AB1, 0X0B35, 0X0BB8, 0X0CBB, 0X0D3E, 0X0DC1, 0X0E44, 0X0F47,
-  0X104A, 0X114D, 0X1250, 0X13D2, 0X14D5, 0X16D8, 0X185B, 0X1ADD,
-  0X1D60, 0X2062, 0X2364, 0X2766, 0X2BE8, 0X3169, 0X36EA, 0X3CEB,
-  0X436B, 0X496A, 0X4EE9, 0X5468, 0X58E6, 0X5CE4, 0X6062, 0X62E0,
-  0X655D, 0X67DB, 0X6958, 0X6B55, 0X6C52, 0X6DD0, 0X6ECD, 0X6FCA,
-  0X70C7, 0X71C4, 0X7241, 0X72BE, 0X733B, 0X7438, 0X74B5, 0X7531,
-  0X752E, 0X75AB, 0X7628, 0X76A5, 0X76A2, 0X771F, 0X771C, 0X7799,
-  0X7795, 0X7812, 0X780F, 0X788C, 0X7889, 0X7906, 0X7903, 0X007F,
-  0X0580, 0X0583, 0X0586, 0X0609, 0X060D, 0X0610, 0X0693, 0X0696,
-  0X0719, 0X071C, 0X079F, 0X07A3, 0X0826, 0X0829, 0X08AC, 0X08AF,
-  0X0932, 0X09B5, 0X0A38, 0X0ABC, 0X0B3F, 0X0BC2, 0X0C45, 0X0D48,
-  0X0DCB, 0X0ECE, 0X0FD1, 0X10D4, 0X1257, 0X13DA, 0X155C, 0X175F,
-  0X19E2, 0X1CE4, 0X2067, 0X2469, 0X28EB, 0X2EEC, 0X356D, 0X3C6E,
-  0X43EE, 0X4AED, 0X516C, 0X576B, 0X5BE9, 0X6067, 0X6364, 0X6662,
-  0X68DF, 0X6ADC, 0X6C5A, 0X6DD7, 0X6F54, 0X7051, 0X714E, 0X724B,
-  0X72C8, 0X73C5, 0X7442, 0X74BF, 0X753C, 0X75B8, 0X7635, 0X76B2,
-  0X772F, 0X772C, 0X77A9, 0X77A6, 0X7823, 0X781F, 0X789C, 0X7899,
-  0X7916, 0X7913, 0X7990, 0X798D, 0X7989, 0X7A06, 0X7A03, 0X7A00,
-  0X0480, 0X0483, 0X0487, 0X048A, 0X050D, 0X0510, 0X0513, 0X0597,
-  0X059A, 0X059D, 0X0620, 0X0623, 0X06A6, 0X06A9, 0X072D, 0X0730,
-  0X07B3, 0X0836, 0X0839, 0X08BC, 0X093F, 0X09C3, 0X0A46, 0X0AC9,
-  0X0BCC, 0X0C4F, 0X0D52, 0X0E55, 0X0F58, 0X105B, 0X125E, 0X13E1,
-  0X1664, 0X18E6, 0X1BE9, 0X206B, 0X256D, 0X2B6F, 0X32F0, 0X3B71,
-  0X44F1, 0X4D70, 0X54EF, 0X5AED, 0X606B, 0X6469, 0X6766, 0X69E4,
-  0X6C61, 0X6DDE, 0X6FDB, 0X70D8, 0X71D5, 0X72D2, 0X73CF, 0X744C,
-  0X7549, 0X75C6, 0X7643, 0X76BF, 0X773C, 0X77B9, 0X77B6, 0X7833,
-  0X78B0, 0X78AD, 0X7929, 0X7926, 0X79A3, 0X79A0, 0X7A1D, 0X7A1A,
-  0X7A17, 0X7A93, 0X7A90, 0X7A8D, 0X7B0A, 0X7B07, 0X7B03, 0X7B00,
-  0X0381, 0X0384, 0X0387, 0X038A, 0X040D, 0X0411, 0X0414, 0X0417,
-  0X049A, 0X049D, 0X04A0, 0X04A4, 0X0527, 0X052A, 0X05AD, 0X05B0,
-  0X0633, 0X0637, 0X06BA, 0X06BD, 0X0740, 0X07C3, 0X0846, 0X08CA,
-  0X094D, 0X09D0, 0X0A53, 0X0B56, 0X0C59, 0X0D5C, 0X0E5F, 0X0FE2,
-  0X11E5, 0X1468, 0X176B, 0X1AED, 0X2070, 0X26F2, 0X2FF3, 0X3A74,
-  0X45F4, 0X5073, 0X5972, 0X6070, 0X656D, 0X68EB, 0X6BE8, 0X6E65,
-  0X7062, 0X71DF, 0X72DC, 0X73D9, 0X74D6, 0X75D3, 0X7650, 0X76CD,
-  0X774A, 0X77C6, 0X7843, 0X78C0, 0X793D, 0X793A, 0X79B7, 0X79B3,
-  0X7A30, 0X7A2D, 0X7AAA, 0X7AA7, 0X7B24, 0X7B20, 0X7B1D, 0X7B1A,
-  0X7B97, 0X7B94, 0X7B91, 0X7B8D, 0X7C0A, 0X7C07, 0X7C04, 0X7C01,
-  0X0281, 0X0284, 0X0287, 0X028A, 0X028E, 0X0291, 0X0314, 0X0317,
-  0X031A, 0X031E, 0X0321, 0X03A4, 0X03A7, 0X03AA, 0X03AE, 0X0431,
-  0X0434, 0X04B7, 0X04BA, 0X04BD, 0X0541, 0X0544, 0X05C7, 0X064A,
-  0X06CD, 0X06D0, 0X0754, 0X0857, 0X08DA, 0X09DD, 0X0A60, 0X0BE3,
-  0X0D66, 0X0EE9, 0X116C, 0X14EF, 0X1972, 0X2074, 0X29F6, 0X37F7,
-  0X4877, 0X5676, 0X6074, 0X66F2, 0X6B6F, 0X6EEC, 0X7169, 0X72E6,
-  0X7463, 0X75E0, 0X765D, 0X775A, 0X77D7, 0X78D4, 0X7950, 0X794D,
-  0X79CA, 0X7A47, 0X7AC4, 0X7AC1, 0X7B3D, 0X7B3A, 0X7B37, 0X7BB4,
-  0X7BB1, 0X7C2E, 0X7C2A, 0X7C27, 0X7C24, 0X7CA1, 0X7C9E, 0X7C9A,
-  0X7C97, 0X7C94, 0X7D11, 0X7D0E, 0X7D0A, 0X7D07, 0X7D04, 0X7D01,
-  0X0181, 0X0184, 0X0187, 0X018B, 0X018E, 0X0191, 0X0194, 0X0197,
-  0X019B, 0X021E, 0X0221, 0X0224, 0X0227, 0X022B, 0X022E, 0X0231,
-  0X02B4, 0X02B7, 0X02BB, 0X02BE, 0X0341, 0X0344, 0X0347, 0X03CA,
-  0X03CE, 0X0451, 0X04D4, 0X04D7, 0X055A, 0X05DE, 0X0661, 0X0764,
-  0X0867, 0X096A, 0X0AED, 0X0D70, 0X1073, 0X1676, 0X2079, 0X32FA,
-  0X4D7A, 0X6079, 0X69F6, 0X6FF3, 0X72F0, 0X756D, 0X76EA, 0X77E7,
-  0X78E4, 0X79E1, 0X7A5E, 0X7ADA, 0X7B57, 0X7B54, 0X7BD1, 0X7C4E,
-  0X7C4A, 0X7CC7, 0X7CC4, 0X7CC1, 0X7D3E, 0X7D3B, 0X7D37, 0X7D34,
-  0X7DB1, 0X7DAE, 0X7DAB, 0X7DA7, 0X7DA4, 0X7DA1, 0X7D9E, 0X7E1B,
-  0X7E17, 0X7E14, 0X7E11, 0X7E0E, 0X7E0B, 0X7E07, 0X7E04, 0X7E01,
-  0X0081, 0X0084, 0X0087, 0X008B, 0X008E, 0X0091, 0X0094, 0X0097,
-  0X009B, 0X009E, 0X00A1, 0X00A4, 0X00A7, 0X00AB, 0X00AE, 0X00B1,
-  0X00B4, 0X00B7, 0X00BB, 0X00BE, 0X0141, 0X0144, 0X0147, 0X014B,
-  0X014E, 0X0151, 0X01D4, 0X01D7, 0X01DB, 0X01DE, 0X0261, 0X0264,
-  0X02E7, 0X036B, 0X03EE, 0X04F1, 0X05F4, 0X0877, 0X0D7A, 0X207D,
-  0X607D, 0X72FA, 0X77F7, 0X7A74, 0X7B71, 0X7C6E, 0X7CEB, 0X7D67,
-  0X7DE4, 0X7DE1, 0X7E5E, 0X7E5B, 0X7E57, 0X7E54, 0X7ED1, 0X7ECE,
-  0X7ECB, 0X7EC7, 0X7EC4, 0X7EC1, 0X7F3E, 0X7F3B, 0X7F37, 0X7F34,
-  0X7F31, 0X7F2E, 0X7F2B, 0X7F27, 0X7F24, 0X7F21, 0X7F1E, 0X7F1B,
-  0X7F17, 0X7F14, 0X7F11, 0X7F0E, 0X7F0B, 0X7F07, 0X7F04, 0X7F01,
-  0XFF01, 0XFF04, 0XFF07, 0XFF0B, 0XFF0E, 0XFF11, 0XFF14, 0XFF17,
-  0XFF1B, 0XFF1E, 0XFF21, 0XFF24, 0XFF27, 0XFF2B, 0XFF2E, 0XFF31,
-  0XFF34, 0XFF37, 0XFF3B, 0XFF3E, 0XFEC1, 0XFEC4, 0XFEC7, 0XFECB,
-  0XFECE, 0XFED1, 0XFE54, 0XFE57, 0XFE5B, 0XFE5E, 0XFDE1, 0XFDE4,
-  0XFD67, 0XFCEB, 0XFC6E, 0XFB71, 0XFA74, 0XF7F7, 0XF2FA, 0XE07D,
-  0XA07D, 0X8D7A, 0X8877, 0X85F4, 0X84F1, 0X83EE, 0X836B, 0X82E7,
-  0X8264, 0X8261, 0X81DE, 0X81DB, 0X81D7, 0X81D4, 0X8151, 0X814E,
-  0X814B, 0X8147, 0X8144, 0X8141, 0X80BE, 0X80BB, 0X80B7, 0X80B4,
-  0X80B1, 0X80AE, 0X80AB, 0X80A7, 0X80A4, 0X80A1, 0X809E, 0X809B,
-  0X8097, 0X8094, 0X8091, 0X808E, 0X808B, 0X8087, 0X8084, 0X8081,
-  0XFE01, 0XFE04, 0XFE07, 0XFE0B, 0XFE0E, 0XFE11, 0XFE14, 0XFE17,
-  0XFE1B, 0XFD9E, 0XFDA1, 0XFDA4, 0XFDA7, 0XFDAB, 0XFDAE, 0XFDB1,
-  0XFD34, 0XFD37, 0XFD3B, 0XFD3E, 0XFCC1, 0XFCC4, 0XFCC7, 0XFC4A,
-  0XFC4E, 0XFBD1, 0XFB54, 0XFB57, 0XFADA, 0XFA5E, 0XF9E1, 0XF8E4,
-  0XF7E7, 0XF6EA, 0XF56D, 0XF2F0, 0XEFF3, 0XE9F6, 0XE079, 0XCD7A,
-  0XB2FA, 0XA079, 0X9676, 0X9073, 0X8D70, 0X8AED, 0X896A, 0X8867,
-  0X8764, 0X8661, 0X85DE, 0X855A, 0X84D7, 0X84D4, 0X8451, 0X83CE,
-  0X83CA, 0X8347, 0X8344, 0X8341, 0X82BE, 0X82BB, 0X82B7, 0X82B4,
-  0X8231, 0X822E, 0X822B, 0X8227, 0X8224, 0X8221, 0X821E, 0X819B,
-  0X8197, 0X8194, 0X8191, 0X818E, 0X818B, 0X8187, 0X8184, 0X8181,
-  0XFD01, 0XFD04, 0XFD07, 0XFD0A, 0XFD0E, 0XFD11, 0XFC94, 0XFC97,
-  0XFC9A, 0XFC9E, 0XFCA1, 0XFC24, 0XFC27, 0XFC2A, 0XFC2E, 0XFBB1,
-  0XFBB4, 0XFB37, 0XFB3A, 0XFB3D, 0XFAC1, 0XFAC4, 0XFA47, 0XF9CA,
-  0XF94D, 0XF950, 0XF8D4, 0XF7D7, 0XF75A, 0XF65D, 0XF5E0, 0XF463,
-  0XF2E6, 0XF169, 0XEEEC, 0XEB6F, 0XE6F2, 0XE074, 0XD676, 0XC877,
-  0XB7F7, 0XA9F6, 0XA074, 0X9972, 0X94EF, 0X916C, 0X8EE9, 0X8D66,
-  0X8BE3, 0X8A60, 0X89DD, 0X88DA, 0X8857, 0X8754, 0X86D0, 0X86CD,
-  0X864A, 0X85C7, 0X8544, 0X8541, 0X84BD, 0X84BA, 0X84B7, 0X8434,
-  0X8431, 0X83AE, 0X83AA, 0X83A7, 0X83A4, 0X8321, 0X831E, 0X831A,
-  0X8317, 0X8314, 0X8291, 0X828E, 0X828A, 0X8287, 0X8284, 0X8281,
-  0XFC01, 0XFC04, 0XFC07, 0XFC0A, 0XFB8D, 0XFB91, 0XFB94, 0XFB97,
-  0XFB1A, 0XFB1D, 0XFB20, 0XFB24, 0XFAA7, 0XFAAA, 0XFA2D, 0XFA30,
-  0XF9B3, 0XF9B7, 0XF93A, 0XF93D, 0XF8C0, 0XF843, 0XF7C6, 0XF74A,
-  0XF6CD, 0XF650, 0XF5D3, 0XF4D6, 0XF3D9, 0XF2DC, 0XF1DF, 0XF062,
-  0XEE65, 0XEBE8, 0XE8EB, 0XE56D, 0XE070, 0XD972, 0XD073, 0XC5F4,
-  0XBA74, 0XAFF3, 0XA6F2, 0XA070, 0X9AED, 0X976B, 0X9468, 0X91E5,
-  0X8FE2, 0X8E5F, 0X8D5C, 0X8C59, 0X8B56, 0X8A53, 0X89D0, 0X894D,
-  0X88CA, 0X8846, 0X87C3, 0X8740, 0X86BD, 0X86BA, 0X8637, 0X8633,
-  0X85B0, 0X85AD, 0X852A, 0X8527, 0X84A4, 0X84A0, 0X849D, 0X849A,
-  0X8417, 0X8414, 0X8411, 0X840D, 0X838A, 0X8387, 0X8384, 0X8381,
-  0XFB00, 0XFB03, 0XFB07, 0XFB0A, 0XFA8D, 0XFA90, 0XFA93, 0XFA17,
-  0XFA1A, 0XFA1D, 0XF9A0, 0XF9A3, 0XF926, 0XF929, 0XF8AD, 0XF8B0,
-  0XF833, 0XF7B6, 0XF7B9, 0XF73C, 0XF6BF, 0XF643, 0XF5C6, 0XF549,
-  0XF44C, 0XF3CF, 0XF2D2, 0XF1D5, 0XF0D8, 0XEFDB, 0XEDDE, 0XEC61,
-  0XE9E4, 0XE766, 0XE469, 0XE06B, 0XDAED, 0XD4EF, 0XCD70, 0XC4F1,
-  0XBB71, 0XB2F0, 0XAB6F, 0XA56D, 0XA06B, 0X9BE9, 0X98E6, 0X9664,
-  0X93E1, 0X925E, 0X905B, 0X8F58, 0X8E55, 0X8D52, 0X8C4F, 0X8BCC,
-  0X8AC9, 0X8A46, 0X89C3, 0X893F, 0X88BC, 0X8839, 0X8836, 0X87B3,
-  0X8730, 0X872D, 0X86A9, 0X86A6, 0X8623, 0X8620, 0X859D, 0X859A,
-  0X8597, 0X8513, 0X8510, 0X850D, 0X848A, 0X8487, 0X8483, 0X8480,
-  0XFA00, 0XFA03, 0XFA06, 0XF989, 0XF98D, 0XF990, 0XF913, 0XF916,
-  0XF899, 0XF89C, 0XF81F, 0XF823, 0XF7A6, 0XF7A9, 0XF72C, 0XF72F,
-  0XF6B2, 0XF635, 0XF5B8, 0XF53C, 0XF4BF, 0XF442, 0XF3C5, 0XF2C8,
-  0XF24B, 0XF14E, 0XF051, 0XEF54, 0XEDD7, 0XEC5A, 0XEADC, 0XE8DF,
-  0XE662, 0XE364, 0XE067, 0XDBE9, 0XD76B, 0XD16C, 0XCAED, 0XC3EE,
-  0XBC6E, 0XB56D, 0XAEEC, 0XA8EB, 0XA469, 0XA067, 0X9CE4, 0X99E2,
-  0X975F, 0X955C, 0X93DA, 0X9257, 0X90D4, 0X8FD1, 0X8ECE, 0X8DCB,
-  0X8D48, 0X8C45, 0X8BC2, 0X8B3F, 0X8ABC, 0X8A38, 0X89B5, 0X8932,
-  0X88AF, 0X88AC, 0X8829, 0X8826, 0X87A3, 0X879F, 0X871C, 0X8719,
-  0X8696, 0X8693, 0X8610, 0X860D, 0X8609, 0X8586, 0X8583, 0X8580,
-  0X007F, 0XF903, 0XF906, 0XF889, 0XF88C, 0XF80F, 0XF812, 0XF795,
-  0XF799, 0XF71C, 0XF71F, 0XF6A2, 0XF6A5, 0XF628, 0XF5AB, 0XF52E,
-  0XF531, 0XF4B5, 0XF438, 0XF33B, 0XF2BE, 0XF241, 0XF1C4, 0XF0C7,
-  0XEFCA, 0XEECD, 0XEDD0, 0XEC52, 0XEB55, 0XE958, 0XE7DB, 0XE55D,
-  0XE2E0, 0XE062, 0XDCE4, 0XD8E6, 0XD468, 0XCEE9, 0XC96A, 0XC36B,
-  0XBCEB, 0XB6EA, 0XB169, 0XABE8, 0XA766, 0XA364, 0XA062, 0X9D60,
-  0X9ADD, 0X985B, 0X96D8, 0X94D5, 0X93D2, 0X9250, 0X914D, 0X904A,
-  0X8F47, 0X8E44, 0X8DC1, 0X8D3E, 0X8CBB, 0X8BB8, 0X8B35, 0X8AB1,
-  0X8AAE, 0X8A2B, 0X89A8, 0X8925, 0X8922, 0X889F, 0X889C, 0X8819,
-  0X8815, 0X8792, 0X878F, 0X870C, 0X8709, 0X8686, 0X8683, 0X007F,
-  0X007F, 0XF802, 0XF785, 0XF788, 0XF78B, 0XF70F, 0XF712, 0XF695,
-  0XF618, 0XF61B, 0XF59E, 0XF5A1, 0XF524, 0XF4A7, 0XF42A, 0XF3AE,
-  0XF331, 0XF2B4, 0XF237, 0XF1BA, 0XF13D, 0XF040, 0XEFC3, 0XEEC6,
-  0XEDC8, 0XECCB, 0XEB4E, 0XE9D1, 0XE854, 0XE6D6, 0XE4D9, 0XE2DB,
-  0XE05E, 0XDD60, 0XD9E2, 0XD664, 0XD1E5, 0XCD66, 0XC867, 0XC2E7,
-  0XBD67, 0XB7E7, 0XB2E6, 0XAE65, 0XA9E4, 0XA662, 0XA2E0, 0XA05E,
-  0X9D5B, 0X9B59, 0X9956, 0X97D4, 0X9651, 0X94CE, 0X934B, 0X9248,
-  0X9146, 0X9043, 0X8FC0, 0X8EBD, 0X8E3A, 0X8DB7, 0X8D34, 0X8CB1,
-  0X8C2E, 0X8BAA, 0X8B27, 0X8AA4, 0X8A21, 0X8A1E, 0X899B, 0X8998,
-  0X8915, 0X8892, 0X888F, 0X880B, 0X8808, 0X8805, 0X8782, 0X007F,
-  0X007F, 0XF701, 0XF684, 0XF688, 0XF60B, 0XF60E, 0XF591, 0XF594,
-  0XF517, 0XF49A, 0XF49D, 0XF420, 0XF3A3, 0XF326, 0XF2A9, 0XF22D,
-  0XF1B0, 0XF133, 0XF0B6, 0XEFB8, 0XEF3B, 0XEE3E, 0XEDC1, 0XECC4,
-  0XEBC7, 0XEA4A, 0XE94C, 0XE7CF, 0XE652, 0XE454, 0XE257, 0XE059,
-  0XDD5B, 0XDADD, 0XD75F, 0XD3E1, 0XCFE2, 0XCBE3, 0XC764, 0XC264,
-  0XBDE4, 0XB8E4, 0XB463, 0XB062, 0XAC61, 0XA8DF, 0XA55D, 0XA2DB,
-  0XA059, 0X9DD7, 0X9BD4, 0X99D2, 0X984F, 0X96CC, 0X95CA, 0X9447,
-  0X9344, 0X9241, 0X91BE, 0X90BB, 0X9038, 0X8F36, 0X8EB3, 0X8E30,
-  0X8DAD, 0X8D29, 0X8CA6, 0X8C23, 0X8BA0, 0X8B1D, 0X8B1A, 0X8A97,
-  0X8A14, 0X8A11, 0X898E, 0X898B, 0X8908, 0X8904, 0X8881, 0X007F,
-  0X007F, 0XF601, 0XF584, 0XF587, 0XF50A, 0XF50D, 0XF490, 0XF413,
-  0XF416, 0XF399, 0XF31C, 0XF29F, 0XF222, 0XF1A5, 0XF128, 0XF0AB,
-  0XF02E, 0XEFB1, 0XEF34, 0XEE37, 0XEDBA, 0XECBD, 0XEBC0, 0XEAC3,
-  0XE9C5, 0XE848, 0XE74B, 0XE5CD, 0XE3D0, 0XE252, 0XE055, 0XDDD7,
-  0XDB59, 0XD85B, 0XD55C, 0XD25E, 0XCE5F, 0XCA60, 0XC661, 0XC261,
-  0XBDE1, 0XB9E1, 0XB5E0, 0XB1DF, 0XADDE, 0XAADC, 0XA7DB, 0XA4D9,
-  0XA257, 0XA055, 0X9DD2, 0X9C50, 0X9A4D, 0X98CB, 0X97C8, 0X9645,
-  0X9543, 0X9440, 0X933D, 0X923A, 0X91B7, 0X90B4, 0X9031, 0X8FAE,
-  0X8F2B, 0X8EA8, 0X8E25, 0X8DA2, 0X8D1F, 0X8C9C, 0X8C19, 0X8B96,
-  0X8B93, 0X8B10, 0X8A8D, 0X8A8A, 0X8A07, 0X8A04, 0X8981, 0X007F,
-  0X007F, 0XF500, 0XF483, 0XF486, 0XF409, 0XF38C, 0XF38F, 0XF312,
-  0XF295, 0XF218, 0XF21B, 0XF19E, 0XF121, 0XF0A4, 0XF027, 0XEFAA,
-  0XEEAD, 0XEE30, 0XED33, 0XECB6, 0XEBB9, 0XEABB, 0XE9BE, 0XE8C1,
-  0XE7C4, 0XE646, 0XE549, 0XE3CB, 0XE1CE, 0XE050, 0XDDD2, 0XDBD4,
-  0XD956, 0XD6D8, 0XD3DA, 0XD05B, 0XCD5C, 0XC9DD, 0XC5DE, 0XC1DE,
-  0XBE5E, 0XBA5E, 0XB65D, 0XB2DC, 0XAFDB, 0XAC5A, 0XA958, 0XA6D6,
-  0XA454, 0XA252, 0XA050, 0X9E4E, 0X9C4B, 0X9AC9, 0X99C6, 0X9844,
-  0X9741, 0X963E, 0X953B, 0X9439, 0X9336, 0X92B3, 0X91B0, 0X912D,
-  0X902A, 0X8FA7, 0X8F24, 0X8EA1, 0X8E1E, 0X8D9B, 0X8D98, 0X8D15,
-  0X8C92, 0X8C0F, 0X8C0C, 0X8B89, 0X8B06, 0X8B03, 0X8A80, 0X007F,
-  0X007F, 0X007F, 0XF382, 0XF385, 0XF308, 0XF28B, 0XF28E, 0XF211,
-  0XF194, 0XF117, 0XF09A, 0XF01D, 0XEFA0, 0XEF23, 0XEEA6, 0XEE29,
-  0XED2C, 0XECAF, 0XEBB1, 0XEB34, 0XEA37, 0XE93A, 0XE83C, 0XE73F,
-  0XE5C2, 0XE4C4, 0XE347, 0XE1C9, 0XE04B, 0XDE4E, 0XDC50, 0XD9D2,
-  0XD7D4, 0XD4D5, 0XD257, 0XCF58, 0XCC59, 0XC8DA, 0XC55A, 0XC1DB,
-  0XBE5B, 0XBADA, 0XB75A, 0XB3D9, 0XB0D8, 0XADD7, 0XAB55, 0XA854,
-  0XA652, 0XA3D0, 0XA1CE, 0XA04B, 0X9E49, 0X9CC7, 0X9B44, 0X9A42,
-  0X98BF, 0X97BC, 0X96BA, 0X95B7, 0X94B4, 0X9431, 0X932F, 0X92AC,
-  0X91A9, 0X9126, 0X90A3, 0X9020, 0X8F9D, 0X8F1A, 0X8E97, 0X8E14,
-  0X8D91, 0X8D0E, 0X8D0B, 0X8C88, 0X8C05, 0X8C02, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XF281, 0XF284, 0XF207, 0XF18A, 0XF10D, 0XF110,
-  0XF093, 0XF016, 0XEF99, 0XEF1C, 0XEE9F, 0XEE22, 0XED25, 0XECA7,
-  0XEC2A, 0XEB2D, 0XEAB0, 0XE9B3, 0XE8B5, 0XE7B8, 0XE6BB, 0XE5BD,
-  0XE440, 0XE342, 0XE1C5, 0XE047, 0XDE49, 0XDC4B, 0XDA4D, 0XD84F,
-  0XD651, 0XD3D2, 0XD0D4, 0XCE55, 0XCB56, 0XC857, 0XC4D7, 0XC1D7,
-  0XBE57, 0XBB57, 0XB7D7, 0XB4D6, 0XB1D5, 0XAF54, 0XAC52, 0XA9D1,
-  0XA7CF, 0XA5CD, 0XA3CB, 0XA1C9, 0XA047, 0X9E45, 0X9CC2, 0X9BC0,
-  0X9A3D, 0X993B, 0X9838, 0X9735, 0X9633, 0X9530, 0X94AD, 0X93AA,
-  0X9327, 0X92A5, 0X91A2, 0X911F, 0X909C, 0X9019, 0X8F96, 0X8F13,
-  0X8E90, 0X8E8D, 0X8E0A, 0X8D87, 0X8D04, 0X8D01, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XF180, 0XF183, 0XF106, 0XF089, 0XF00C, 0XEF8F,
-  0XEF92, 0XEF15, 0XEE98, 0XED9B, 0XED1D, 0XECA0, 0XEC23, 0XEB26,
-  0XEAA9, 0XE9AC, 0XE92E, 0XE831, 0XE734, 0XE636, 0XE539, 0XE43B,
-  0XE2BE, 0XE140, 0XE042, 0XDE45, 0XDCC7, 0XDAC9, 0XD8CB, 0XD6CC,
-  0XD4CE, 0XD250, 0XCFD1, 0XCD52, 0XCA53, 0XC754, 0XC4D4, 0XC1D4,
-  0XBE54, 0XBB54, 0XB8D4, 0XB5D3, 0XB2D2, 0XB051, 0XADD0, 0XAB4E,
-  0XA94C, 0XA74B, 0XA549, 0XA347, 0XA1C5, 0XA042, 0X9EC0, 0X9D3E,
-  0X9BBB, 0X9AB9, 0X99B6, 0X98B4, 0X97B1, 0X96AE, 0X962C, 0X9529,
-  0X94A6, 0X93A3, 0X9320, 0X929D, 0X921B, 0X9118, 0X9095, 0X9012,
-  0X900F, 0X8F8C, 0X8F09, 0X8E86, 0X8E03, 0X8E00, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XF082, 0XF005, 0XEF88, 0XEF0B, 0XEE8E,
-  0XEE11, 0XED93, 0XED16, 0XEC99, 0XEC1C, 0XEB9F, 0XEAA2, 0XEA24,
-  0XE927, 0XE8AA, 0XE7AD, 0XE6AF, 0XE5B2, 0XE4B4, 0XE3B7, 0XE2B9,
-  0XE13C, 0XE03E, 0XDEC0, 0XDCC2, 0XDB44, 0XD9C6, 0XD7C8, 0XD5CA,
-  0XD34B, 0XD14D, 0XCECE, 0XCC4F, 0XC9D0, 0XC6D0, 0XC451, 0XC151,
-  0XBED1, 0XBBD1, 0XB950, 0XB650, 0XB3CF, 0XB14E, 0XAECD, 0XACCB,
-  0XAA4A, 0XA848, 0XA646, 0XA4C4, 0XA342, 0XA140, 0XA03E, 0X9EBC,
-  0X9D39, 0X9C37, 0X9B34, 0X9A32, 0X992F, 0X982D, 0X972A, 0X96A7,
-  0X95A4, 0X9522, 0X941F, 0X939C, 0X9319, 0X9296, 0X9213, 0X9191,
-  0X910E, 0X908B, 0X9008, 0X8F85, 0X8F02, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XEF81, 0XEF04, 0XEE86, 0XEE09, 0XED8C,
-  0XED0F, 0XEC92, 0XEC15, 0XEB98, 0XEB1A, 0XEA1D, 0XE9A0, 0XE923,
-  0XE825, 0XE728, 0XE6AB, 0XE5AD, 0XE4B0, 0XE3B2, 0XE235, 0XE137,
-  0XE039, 0XDEBC, 0XDD3E, 0XDBC0, 0XDA42, 0XD844, 0XD645, 0XD447,
-  0XD248, 0XD04A, 0XCDCB, 0XCBCC, 0XC94D, 0XC6CD, 0XC3CE, 0XC14E,
-  0XBECE, 0XBC4E, 0XB94D, 0XB6CD, 0XB44C, 0XB24B, 0XAFCA, 0XADC8,
-  0XABC7, 0XA9C5, 0XA7C4, 0XA5C2, 0XA440, 0XA2BE, 0XA13C, 0XA039,
-  0X9EB7, 0X9DB5, 0X9C32, 0X9B30, 0X9A2D, 0X992B, 0X98A8, 0X97A5,
-  0X96A3, 0X9620, 0X959D, 0X949A, 0X9418, 0X9395, 0X9312, 0X928F,
-  0X920C, 0X9189, 0X9106, 0X9084, 0X9001, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XEE02, 0XED85, 0XED08, 0XEC8B,
-  0XEC0E, 0XEB91, 0XEB13, 0XEA96, 0XE999, 0XE91C, 0XE89E, 0XE7A1,
-  0XE724, 0XE626, 0XE529, 0XE42B, 0XE32E, 0XE230, 0XE133, 0XE035,
-  0XDEB7, 0XDD39, 0XDBBB, 0XDA3D, 0XD8BF, 0XD741, 0XD543, 0XD344,
-  0XD146, 0XCF47, 0XCD48, 0XCAC9, 0XC8CA, 0XC64A, 0XC3CA, 0XC14B,
-  0XBECB, 0XBC4A, 0XB9CA, 0XB74A, 0XB549, 0XB2C8, 0XB0C7, 0XAEC6,
-  0XACC4, 0XAAC3, 0XA8C1, 0XA73F, 0XA5BD, 0XA43B, 0XA2B9, 0XA137,
-  0XA035, 0X9EB3, 0X9DB0, 0X9CAE, 0X9BAB, 0X9AA9, 0X99A6, 0X98A4,
-  0X9821, 0X971E, 0X969C, 0X9619, 0X9516, 0X9493, 0X9411, 0X938E,
-  0X930B, 0X9288, 0X9205, 0X9182, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XED01, 0XEC84, 0XEC07, 0XEB89,
-  0XEB0C, 0XEA8F, 0XEA12, 0XE994, 0XE897, 0XE81A, 0XE71D, 0XE69F,
-  0XE5A2, 0XE524, 0XE427, 0XE329, 0XE22C, 0XE12E, 0XE030, 0XDEB3,
-  0XDDB5, 0XDC37, 0XDAB9, 0XD93B, 0XD7BC, 0XD63E, 0XD440, 0XD241,
-  0XD043, 0XCE44, 0XCC45, 0XCA46, 0XC846, 0XC5C7, 0XC347, 0XC147,
-  0XBEC7, 0XBCC7, 0XBA47, 0XB7C6, 0XB5C6, 0XB3C5, 0XB1C4, 0XAFC3,
-  0XADC1, 0XABC0, 0XA9BE, 0XA83C, 0XA6BB, 0XA539, 0XA3B7, 0XA235,
-  0XA133, 0XA030, 0X9EAE, 0X9DAC, 0X9CA9, 0X9BA7, 0X9AA4, 0X9A22,
-  0X991F, 0X989D, 0X979A, 0X9717, 0X9614, 0X9592, 0X950F, 0X948C,
-  0X9409, 0X9387, 0X9304, 0X9281, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEB82, 0XEB05, 0XEA88,
-  0XEA0B, 0XE98D, 0XE910, 0XE893, 0XE795, 0XE718, 0XE61B, 0XE59D,
-  0XE4A0, 0XE3A2, 0XE325, 0XE227, 0XE129, 0XE02C, 0XDEAE, 0XDDB0,
-  0XDC32, 0XDB34, 0XD9B6, 0XD838, 0XD6BA, 0XD53B, 0XD33D, 0XD1BE,
-  0XCFC0, 0XCDC1, 0XCBC2, 0XC9C3, 0XC7C3, 0XC544, 0XC344, 0XC144,
-  0XBEC4, 0XBCC4, 0XBAC4, 0XB843, 0XB643, 0XB442, 0XB241, 0XB040,
-  0XAE3E, 0XACBD, 0XAABB, 0XA93A, 0XA7B8, 0XA636, 0XA4B4, 0XA3B2,
-  0XA230, 0XA12E, 0XA02C, 0X9EA9, 0X9DA7, 0X9CA5, 0X9C22, 0X9B20,
-  0X9A1D, 0X999B, 0X9898, 0X9815, 0X9713, 0X9690, 0X960D, 0X958B,
-  0X9508, 0X9485, 0X9402, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XEB01, 0XEA83, 0XE986,
-  0XE909, 0XE88C, 0XE80E, 0XE791, 0XE694, 0XE616, 0XE519, 0XE49B,
-  0XE39E, 0XE2A0, 0XE1A3, 0XE125, 0XE027, 0XDEA9, 0XDDAC, 0XDCAE,
-  0XDB30, 0XDA32, 0XD8B4, 0XD735, 0XD5B7, 0XD439, 0XD23A, 0XD0BB,
-  0XCEBD, 0XCD3E, 0XCB3F, 0XC93F, 0XC740, 0XC541, 0XC341, 0XC141,
-  0XBEC1, 0XBCC1, 0XBAC1, 0XB8C0, 0XB6BF, 0XB4BF, 0XB2BE, 0XB13D,
-  0XAF3B, 0XADBA, 0XABB9, 0XAA37, 0XA8B5, 0XA734, 0XA5B2, 0XA4B0,
-  0XA32E, 0XA22C, 0XA129, 0XA027, 0X9EA5, 0X9E23, 0X9D20, 0X9C1E,
-  0X9B1B, 0X9A99, 0X9996, 0X9914, 0X9811, 0X978E, 0X970C, 0X9689,
-  0X9606, 0X9503, 0X9481, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE982, 0XE905,
-  0XE807, 0XE78A, 0XE70D, 0XE68F, 0XE592, 0XE514, 0XE417, 0XE399,
-  0XE29C, 0XE19E, 0XE0A0, 0XE023, 0XDEA5, 0XDDA7, 0XDCA9, 0XDBAB,
-  0XDA2D, 0XD92F, 0XD7B1, 0XD633, 0XD4B4, 0XD336, 0XD1B7, 0XD038,
-  0XCE3A, 0XCCBB, 0XCABC, 0XC8BC, 0XC6BD, 0XC4BD, 0XC2BE, 0XC0BE,
-  0XBF3E, 0XBD3E, 0XBB3D, 0XB93D, 0XB73C, 0XB53C, 0XB33B, 0XB1BA,
-  0XAFB8, 0XAE37, 0XACB6, 0XAB34, 0XA9B3, 0XA831, 0XA6AF, 0XA5AD,
-  0XA42B, 0XA329, 0XA227, 0XA125, 0XA023, 0X9F20, 0X9E1E, 0X9D1C,
-  0X9C19, 0X9B97, 0X9A94, 0X9A12, 0X990F, 0X988D, 0X980A, 0X9787,
-  0X9685, 0X9602, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE880, 0XE803,
-  0XE785, 0XE688, 0XE60B, 0XE58D, 0XE490, 0XE412, 0XE315, 0XE297,
-  0XE19A, 0XE09C, 0XE01E, 0XDF20, 0XDE23, 0XDCA5, 0XDBA7, 0XDAA9,
-  0XD92B, 0XD82D, 0XD6AE, 0XD530, 0XD431, 0XD2B3, 0XD0B4, 0XCF36,
-  0XCDB7, 0XCBB8, 0XCA38, 0XC839, 0XC6BA, 0XC4BA, 0XC2BB, 0XC0BB,
-  0XBF3B, 0XBD3B, 0XBB3A, 0XB93A, 0XB7B9, 0XB5B8, 0XB438, 0XB237,
-  0XB0B6, 0XAF34, 0XAD33, 0XABB1, 0XAAB0, 0XA92E, 0XA7AD, 0XA6AB,
-  0XA529, 0XA427, 0XA325, 0XA1A3, 0XA0A0, 0XA01E, 0X9F1C, 0X9E1A,
-  0X9D17, 0X9C95, 0X9B92, 0X9B10, 0X9A0D, 0X998B, 0X9908, 0X9805,
-  0X9783, 0X9700, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XE701,
-  0XE684, 0XE606, 0XE509, 0XE48B, 0XE40E, 0XE310, 0XE293, 0XE195,
-  0XE097, 0XE01A, 0XDF1C, 0XDE1E, 0XDD20, 0XDC22, 0XDAA4, 0XD9A6,
-  0XD8A8, 0XD72A, 0XD62C, 0XD4AD, 0XD32F, 0XD1B0, 0XD031, 0XCEB3,
-  0XCD34, 0XCB35, 0XC9B5, 0XC836, 0XC637, 0XC4B7, 0XC2B7, 0XC0B7,
-  0XBF37, 0XBD37, 0XBB37, 0XB9B7, 0XB7B6, 0XB635, 0XB4B5, 0XB2B4,
-  0XB133, 0XAFB1, 0XAE30, 0XACAF, 0XAB2D, 0XA9AC, 0XA8AA, 0XA728,
-  0XA626, 0XA524, 0XA3A2, 0XA2A0, 0XA19E, 0XA09C, 0XA01A, 0X9F17,
-  0X9E15, 0X9D13, 0X9C90, 0X9B8E, 0X9B0B, 0X9A89, 0X9986, 0X9904,
-  0X9881, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XE582, 0XE504, 0XE487, 0XE389, 0XE30C, 0XE20E, 0XE191, 0XE093,
-  0XE015, 0XDF17, 0XDE1A, 0XDD1C, 0XDC1E, 0XDB20, 0XDA22, 0XD8A4,
-  0XD7A5, 0XD6A7, 0XD529, 0XD3AA, 0XD2AC, 0XD12D, 0XCFAE, 0XCE30,
-  0XCCB1, 0XCAB1, 0XC932, 0XC7B3, 0XC633, 0XC434, 0XC2B4, 0XC0B4,
-  0XBF34, 0XBD34, 0XBBB4, 0XB9B3, 0XB833, 0XB6B2, 0XB531, 0XB331,
-  0XB1B0, 0XB02E, 0XAEAD, 0XAD2C, 0XAC2A, 0XAAA9, 0XA927, 0XA825,
-  0XA724, 0XA5A2, 0XA4A0, 0XA39E, 0XA29C, 0XA19A, 0XA097, 0XA015,
-  0X9F13, 0X9E11, 0X9D8E, 0X9C8C, 0X9C09, 0X9B07, 0X9A84, 0X9A02,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XE500, 0XE402, 0XE385, 0XE307, 0XE20A, 0XE18C, 0XE08E, 0XE011,
-  0XDF13, 0XDE15, 0XDD17, 0XDC19, 0XDB1B, 0XDA1D, 0XD91F, 0XD821,
-  0XD6A3, 0XD5A4, 0XD4A6, 0XD327, 0XD1A9, 0XD02A, 0XCF2B, 0XCDAD,
-  0XCC2E, 0XCAAE, 0XC8AF, 0XC730, 0XC5B0, 0XC431, 0XC231, 0XC0B1,
-  0XBF31, 0XBDB1, 0XBBB1, 0XBA30, 0XB8B0, 0XB72F, 0XB52E, 0XB3AE,
-  0XB22D, 0XB0AB, 0XAFAA, 0XAE29, 0XACA7, 0XAB26, 0XAA24, 0XA923,
-  0XA7A1, 0XA69F, 0XA59D, 0XA49B, 0XA399, 0XA297, 0XA195, 0XA093,
-  0XA011, 0X9F0E, 0X9E0C, 0X9D8A, 0X9C87, 0X9C05, 0X9B82, 0X9A80,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XE380, 0XE283, 0XE205, 0XE187, 0XE08A, 0XE00C, 0XDF0E,
-  0XDE11, 0XDD13, 0XDC95, 0XDB97, 0XDA99, 0XD99B, 0XD89D, 0XD71E,
-  0XD620, 0XD522, 0XD3A3, 0XD2A5, 0XD126, 0XCFA7, 0XCEA8, 0XCD29,
-  0XCBAA, 0XCA2B, 0XC8AC, 0XC72D, 0XC5AD, 0XC3AE, 0XC22E, 0XC0AE,
-  0XBF2E, 0XBDAE, 0XBC2E, 0XBA2D, 0XB8AD, 0XB72C, 0XB5AB, 0XB42A,
-  0XB2A9, 0XB128, 0XB027, 0XAEA6, 0XAD25, 0XAC23, 0XAAA2, 0XA9A0,
-  0XA89E, 0XA71D, 0XA61B, 0XA519, 0XA417, 0XA315, 0XA293, 0XA191,
-  0XA08E, 0XA00C, 0X9F0A, 0X9E07, 0X9D85, 0X9D03, 0X9C00, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XE201, 0XE103, 0XE085, 0XE008, 0XDF0A, 0XDE0C,
-  0XDD8E, 0XDC90, 0XDB92, 0XDA94, 0XD996, 0XD898, 0XD79A, 0XD69C,
-  0XD59D, 0XD41F, 0XD320, 0XD1A2, 0XD0A3, 0XCF24, 0XCE25, 0XCCA6,
-  0XCB27, 0XC9A8, 0XC829, 0XC6A9, 0XC52A, 0XC3AA, 0XC22B, 0XC0AB,
-  0XBF2B, 0XBDAB, 0XBC2A, 0XBAAA, 0XB929, 0XB7A9, 0XB628, 0XB4A7,
-  0XB326, 0XB1A5, 0XB0A4, 0XAF23, 0XAE22, 0XACA0, 0XAB9F, 0XAA1D,
-  0XA91C, 0XA81A, 0XA718, 0XA616, 0XA514, 0XA412, 0XA310, 0XA20E,
-  0XA18C, 0XA08A, 0XA008, 0X9F05, 0X9E83, 0X9D81, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0XE081, 0XE003, 0XDF05, 0XDE07, 0XDD8A,
-  0XDC8C, 0XDB8E, 0XDB10, 0XDA12, 0XD914, 0XD815, 0XD717, 0XD619,
-  0XD49A, 0XD39C, 0XD29D, 0XD11F, 0XD020, 0XCEA1, 0XCDA2, 0XCC23,
-  0XCAA4, 0XC925, 0XC826, 0XC6A6, 0XC527, 0XC3A7, 0XC227, 0XC0A7,
-  0XBF27, 0XBDA7, 0XBC27, 0XBAA7, 0XB926, 0XB7A6, 0XB6A5, 0XB524,
-  0XB3A3, 0XB222, 0XB121, 0XAFA0, 0XAE9F, 0XAD1D, 0XAC1C, 0XAB1A,
-  0XA999, 0XA897, 0XA795, 0XA694, 0XA592, 0XA490, 0XA40E, 0XA30C,
-  0XA20A, 0XA187, 0XA085, 0XA003, 0X9F01, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XDF01, 0XDE83, 0XDD85, 0XDC87,
-  0XDC09, 0XDB0B, 0XDA0D, 0XD90F, 0XD811, 0XD713, 0XD614, 0XD516,
-  0XD418, 0XD319, 0XD21B, 0XD09C, 0XCF9D, 0XCE1E, 0XCD1F, 0XCBA0,
-  0XCA21, 0XC922, 0XC7A3, 0XC623, 0XC4A4, 0XC3A4, 0XC224, 0XC0A4,
-  0XBF24, 0XBDA4, 0XBC24, 0XBB24, 0XB9A3, 0XB823, 0XB6A2, 0XB5A1,
-  0XB420, 0XB29F, 0XB19E, 0XB01D, 0XAF1C, 0XAD9B, 0XAC99, 0XAB98,
-  0XAA96, 0XA994, 0XA893, 0XA791, 0XA68F, 0XA58D, 0XA48B, 0XA389,
-  0XA307, 0XA205, 0XA103, 0XA081, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDD81, 0XDD03, 0XDC05,
-  0XDB07, 0XDA89, 0XD98B, 0XD88D, 0XD78E, 0XD690, 0XD592, 0XD493,
-  0XD395, 0XD296, 0XD118, 0XD019, 0XCF1A, 0XCD9B, 0XCC9C, 0XCB1D,
-  0XCA1E, 0XC89F, 0XC79F, 0XC620, 0XC4A0, 0XC321, 0XC221, 0XC0A1,
-  0XBF21, 0XBDA1, 0XBCA1, 0XBB20, 0XB9A0, 0XB81F, 0XB71F, 0XB59E,
-  0XB49D, 0XB31C, 0XB21B, 0XB09A, 0XAF99, 0XAE98, 0XAD16, 0XAC15,
-  0XAB13, 0XAA12, 0XA910, 0XA80E, 0XA70D, 0XA60B, 0XA509, 0XA487,
-  0XA385, 0XA283, 0XA201, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDC00, 0XDB82,
-  0XDA84, 0XD986, 0XD908, 0XD80A, 0XD70C, 0XD60D, 0XD50F, 0XD411,
-  0XD312, 0XD213, 0XD095, 0XCF96, 0XCE97, 0XCD98, 0XCC19, 0XCB1A,
-  0XC99B, 0XC89C, 0XC71C, 0XC59D, 0XC49D, 0XC31E, 0XC21E, 0XC09E,
-  0XBF1E, 0XBD9E, 0XBC9E, 0XBB1D, 0XBA1D, 0XB89C, 0XB71C, 0XB61B,
-  0XB49A, 0XB399, 0XB218, 0XB117, 0XB016, 0XAF15, 0XAD93, 0XAC92,
-  0XAB91, 0XAA8F, 0XA98D, 0XA88C, 0XA78A, 0XA688, 0XA606, 0XA504,
-  0XA402, 0XA380, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XDA80,
-  0XDA02, 0XD904, 0XD805, 0XD787, 0XD689, 0XD58B, 0XD48C, 0XD38E,
-  0XD28F, 0XD191, 0XD012, 0XCF13, 0XCE14, 0XCD15, 0XCB96, 0XCA97,
-  0XC998, 0XC819, 0XC719, 0XC59A, 0XC49A, 0XC31A, 0XC19B, 0XC09B,
-  0XBF1B, 0XBE1B, 0XBC9A, 0XBB1A, 0XBA1A, 0XB899, 0XB799, 0XB618,
-  0XB517, 0XB416, 0XB295, 0XB194, 0XB093, 0XAF92, 0XAE11, 0XAD0F,
-  0XAC0E, 0XAB0C, 0XAA0B, 0XA909, 0XA807, 0XA785, 0XA684, 0XA582,
-  0XA500, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0XD881, 0XD783, 0XD685, 0XD606, 0XD508, 0XD409, 0XD30B,
-  0XD20C, 0XD10E, 0XD00F, 0XCE90, 0XCD91, 0XCC92, 0XCB93, 0XCA14,
-  0XC915, 0XC815, 0XC696, 0XC597, 0XC417, 0XC317, 0XC197, 0XC097,
-  0XBF17, 0XBE17, 0XBC97, 0XBB97, 0XBA17, 0XB916, 0XB795, 0XB695,
-  0XB594, 0XB413, 0XB312, 0XB211, 0XB110, 0XAF8F, 0XAE8E, 0XAD8C,
-  0XAC8B, 0XAB89, 0XAA88, 0XA986, 0XA905, 0XA803, 0XA701, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XD700, 0XD602, 0XD503, 0XD485, 0XD387, 0XD288,
-  0XD189, 0XD08B, 0XCF8C, 0XCE8D, 0XCD0E, 0XCC0F, 0XCB10, 0XCA11,
-  0XC892, 0XC792, 0XC693, 0XC513, 0XC414, 0XC314, 0XC194, 0XC094,
-  0XBF14, 0XBE14, 0XBC94, 0XBB94, 0XBA93, 0XB913, 0XB812, 0XB712,
-  0XB591, 0XB490, 0XB38F, 0XB28E, 0XB10D, 0XB00C, 0XAF0B, 0XAE09,
-  0XAD08, 0XAC07, 0XAB05, 0XAA83, 0XA982, 0XA880, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0XD481, 0XD402, 0XD304, 0XD205,
-  0XD106, 0XD008, 0XCF09, 0XCE0A, 0XCD0B, 0XCC0C, 0XCA8D, 0XC98E,
-  0XC88F, 0XC78F, 0XC610, 0XC510, 0XC411, 0XC291, 0XC191, 0XC091,
-  0XBF11, 0XBE11, 0XBD11, 0XBB91, 0XBA90, 0XB990, 0XB80F, 0XB70F,
-  0XB60E, 0XB50D, 0XB38C, 0XB28B, 0XB18A, 0XB089, 0XAF88, 0XAE86,
-  0XAD85, 0XAC84, 0XAB82, 0XAB01, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XD281, 0XD182,
-  0XD084, 0XCF85, 0XCE86, 0XCD87, 0XCC88, 0XCB89, 0XCA8A, 0XC98B,
-  0XC80B, 0XC70C, 0XC60D, 0XC50D, 0XC40D, 0XC28E, 0XC18E, 0XC08E,
-  0XBF0E, 0XBE0E, 0XBD0E, 0XBB8D, 0XBA8D, 0XB98D, 0XB88C, 0XB78B,
-  0XB60B, 0XB50A, 0XB409, 0XB308, 0XB207, 0XB106, 0XB005, 0XAF04,
-  0XAE02, 0XAD01, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0XD001, 0XCF02, 0XCE03, 0XCD04, 0XCC05, 0XCB06, 0XCA07, 0XC908,
-  0XC808, 0XC709, 0XC609, 0XC48A, 0XC38A, 0XC28A, 0XC18B, 0XC08B,
-  0XBF0B, 0XBE0B, 0XBD0A, 0XBC0A, 0XBB0A, 0XB989, 0XB889, 0XB788,
-  0XB688, 0XB587, 0XB486, 0XB385, 0XB284, 0XB183, 0XB082, 0XAF81,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XCE00, 0XCD01, 0XCC02, 0XCB03, 0XCA04, 0XC904,
-  0XC805, 0XC686, 0XC586, 0XC487, 0XC387, 0XC287, 0XC187, 0XC087,
-  0XBF07, 0XBE07, 0XBD07, 0XBC07, 0XBB07, 0XBA06, 0XB906, 0XB785,
-  0XB684, 0XB584, 0XB483, 0XB382, 0XB281, 0XB180, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0XCA80, 0XC981, 0XC881,
-  0XC782, 0XC683, 0XC583, 0XC483, 0XC384, 0XC284, 0XC184, 0XC084,
-  0XBF04, 0XBE04, 0XBD04, 0XBC04, 0XBB03, 0XBA03, 0XB903, 0XB802,
-  0XB701, 0XB601, 0XB500, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0XC580, 0XC480, 0XC381, 0XC281, 0XC181, 0XC081,
-  0XBF01, 0XBE01, 0XBD01, 0XBC01, 0XBB00, 0XBA00, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F,
-  0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F, 0X007F };
+extern const uint16_t polar[IRIS_WIDTH * IRIS_HEIGHT] asm("newtEye_polar");
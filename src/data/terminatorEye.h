@@ -1,13346 +1,30 @@
+// Generated by tools/assetc -- the tables are linked in from terminatorEye/*.bin by terminatorEye.S
+
 #define IRIS_MIN 65
 #define IRIS_MAX 500
 
 #define SCLERA_WIDTH  200
 #define SCLERA_HEIGHT 200
 
-const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] PROGMEM= {
-  0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x18C3,
-  0x2104, 0x2945, 0x3186, 0x31A6, 0x39C7, 0x4208, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4228, 0x4208, 0x39E7, 0x39C7, 0x3186, 0x2965, 0x2124,
-  0x18C3, 0x1082, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x10A2, 0x18E3, 0x2945, 0x3186, 0x31A6, 0x4228, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x4A49, 0x31A6, 0x31A6, 0x2965, 0x2104, 0x10A2,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x18C3, 0x2124, 0x31A6, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x3186, 0x3186, 0x4228, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x4A49, 0x3186, 0x3186, 0x528A, 0x528A, 0x528A,
-  0x4A69, 0x39E7, 0x2965, 0x18C3, 0x0861, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x10A2, 0x2124, 0x39C7, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x31A6, 0x3186, 0x4208, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x4228, 0x3186, 0x31A6, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x4208, 0x2965, 0x18C3,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x18C3, 0x2965, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x39C7, 0x3186, 0x39E7, 0x528A, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x39E7, 0x3186, 0x39E7, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x4A69, 0x31A6, 0x18E3, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x18E3, 0x2965, 0x4208, 0x4228, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x4208, 0x3186, 0x39C7, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x39C7, 0x3186, 0x4228, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x528A, 0x39C7, 0x2104, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x10A2,
-  0x2945, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x4A49, 0x3186, 0x3186, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x5AEB, 0x3186, 0x3186, 0x4A69, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x4A69, 0x3186,
-  0x10A2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x18E3, 0x31A6, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x4A69, 0x3186, 0x3186, 0x52AA, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x5ACB, 0x3186, 0x3186, 0x5ACB, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x52AA, 0x4208, 0x2124, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x2124, 0x39E7, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x3186, 0x3186, 0x4A69, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x52AA, 0x3186, 0x3186, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x4A69, 0x2965, 0x1082, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69,
-  0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x2945, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x31A6, 0x3186, 0x4A49, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x4A69, 0x3186, 0x39C7, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x31A6, 0x10A2,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4A69,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x2945,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x39E7, 0x3186, 0x4208, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x4228, 0x3186, 0x4208, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x31A6, 0x10A2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x2945, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x4A49, 0x3186, 0x39E7, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x39E7, 0x3186, 0x4A69, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x31A6, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x2124, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x528A, 0x3186, 0x31A6, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x738E, 0x31A6, 0x3186, 0x5ACB, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x630C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x3186, 0x0861, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x18E3, 0x39C7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x5AEB, 0x3186, 0x3186, 0x632C,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x6B4D, 0x3186, 0x3186, 0x632C, 0x73AE, 0x738E, 0x738E, 0x738E,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4A69, 0x2124, 0x0841,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x10A2,
-  0x3186, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x3186, 0x3186, 0x5AEB,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x630C, 0x3186, 0x3186, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C,
-  0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4228,
-  0x18C3, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x2124, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x31A6, 0x3186, 0x52AA,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x5ACB, 0x3186, 0x39C7, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C,
-  0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x52AA, 0x3186, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x10A2, 0x31A6, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x4208, 0x3186, 0x4A49,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x4A69, 0x3186, 0x4228, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x4A49, 0x18E3, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x2124, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x4A69, 0x3186, 0x4208,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x4208, 0x3186, 0x528A, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x738E,
-  0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x31A6, 0x0861, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x10A2, 0x3186, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x5ACB, 0x3186, 0x31A6,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x31A6, 0x3186, 0x5AEB, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x738E, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C,
-  0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x4A49, 0x10A2, 0x0841,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x18E3, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x632C, 0x3186, 0x3186,
-  0x73AE, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x7BEF,
-  0x3186, 0x3186, 0x738E, 0x8430, 0x8430, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x2945,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x2945,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x73AE, 0x3186, 0x3186,
-  0x6B4D, 0x8410, 0x8410, 0x7BCF, 0x738E, 0x6B4D, 0x632C, 0x630C,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x6B4D, 0x6B6D, 0x73AE, 0x7BEF, 0x8430, 0x8C51, 0x738E,
-  0x3186, 0x3186, 0x7BEF, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x39E7, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x1082, 0x3186, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x6B6D, 0x31A6, 0x3186,
-  0x39E7, 0x39E7, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x39E7, 0x39E7,
-  0x3186, 0x31A6, 0x73AE, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51,
-  0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE,
-  0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D,
-  0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x4A49, 0x10A2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x18C3, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x738E, 0x630C, 0x4A69, 0x39E7, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x39C7, 0x39E7, 0x4228, 0x4A49,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A,
-  0x4A69, 0x4228, 0x4208, 0x39E7, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x39E7, 0x528A, 0x6B4D, 0x7BEF,
-  0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x52AA, 0x2104, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x2104, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x73AE, 0x632C, 0x4A69, 0x39C7,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x39C7, 0x39C7, 0x3186,
-  0x39E7, 0x630C, 0x6B6D, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7BCF, 0x6B6D, 0x39E7,
-  0x3186, 0x39C7, 0x39C7, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x39C7, 0x52AA, 0x6B6D, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51,
-  0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x2965, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x2124, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x73AE, 0x5AEB, 0x4228, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x39E7, 0x4A69, 0x5ACB, 0x6B4D, 0x738E, 0x52AA, 0x3186,
-  0x31A6, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x39C7,
-  0x3186, 0x630C, 0x8430, 0x8410, 0x6B6D, 0x5ACB, 0x4228, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x4A69, 0x6B4D, 0x8430, 0x8C71,
-  0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x31A6, 0x0861, 0x0841,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x2945, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x632C,
-  0x4A49, 0x3186, 0x3186, 0x3186, 0x3186, 0x39C7, 0x4A49, 0x5ACB,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x630C, 0x3186,
-  0x3186, 0x738E, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8410, 0x3186,
-  0x3186, 0x6B6D, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8430,
-  0x6B6D, 0x52AA, 0x39E7, 0x3186, 0x3186, 0x3186, 0x3186, 0x4A69,
-  0x738E, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51,
-  0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x738E,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C,
-  0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x4208, 0x0861,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x2965, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x6B6D, 0x52AA, 0x39C7, 0x3186,
-  0x3186, 0x3186, 0x39C7, 0x4A49, 0x5AEB, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x6B6D, 0x3186,
-  0x3186, 0x6B4D, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51,
-  0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x73AE, 0x3186,
-  0x3186, 0x8410, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71,
-  0x8C51, 0x8C51, 0x8C51, 0x7BEF, 0x5AEB, 0x39E7, 0x3186, 0x3186,
-  0x3186, 0x39C7, 0x5AEB, 0x8430, 0x8C71, 0x8C71, 0x8C51, 0x8C51,
-  0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x4228,
-  0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x2965,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x738E, 0x73AE, 0x6B4D, 0x4A49, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x4228, 0x5ACB, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x31A6,
-  0x3186, 0x630C, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C71,
-  0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x6B4D, 0x3186,
-  0x31A6, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8C71, 0x8C71,
-  0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x7BCF, 0x52AA,
-  0x39C7, 0x3186, 0x3186, 0x3186, 0x528A, 0x7BEF, 0x8C71, 0x8C71,
-  0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x4A49, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x0861, 0x0861, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x1082, 0x2965, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x632C, 0x4228, 0x3186, 0x3186, 0x3186, 0x39C7, 0x4A69, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x4208,
-  0x3186, 0x52AA, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x9492, 0x9492,
-  0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x5ACB, 0x3186,
-  0x4228, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492,
-  0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C71,
-  0x8C51, 0x6B4D, 0x4228, 0x3186, 0x3186, 0x3186, 0x4A49, 0x7BCF,
-  0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430,
-  0x8430, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x4A69, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x1082,
-  0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x10A2,
-  0x0000, 0x0841, 0x0020, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x1082, 0x3186, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x632C, 0x4228,
-  0x3186, 0x3186, 0x3186, 0x39E7, 0x52AA, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x528A,
-  0x3186, 0x4A49, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71,
-  0x8C71, 0x8C71, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492,
-  0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x4A69, 0x3186,
-  0x52AA, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2,
-  0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x9492, 0x9492,
-  0x9492, 0x8C71, 0x8C71, 0x7BCF, 0x4A69, 0x3186, 0x3186, 0x3186,
-  0x4A69, 0x7BEF, 0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51,
-  0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D,
-  0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x4A69, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x0861, 0x0841, 0x18E3, 0x0020,
-  0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x0841,
-  0x2104, 0x39C7, 0x18E3, 0x0000, 0x0841, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x2965, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x6B4D, 0x4A49, 0x3186, 0x3186,
-  0x3186, 0x39E7, 0x52AA, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x5AEB,
-  0x3186, 0x39C7, 0x8C51, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x9492,
-  0x9492, 0x9492, 0x9492, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2,
-  0x94B2, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x39E7, 0x3186,
-  0x6B4D, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3,
-  0x9CD3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2,
-  0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8410, 0x528A, 0x3186,
-  0x3186, 0x3186, 0x528A, 0x8430, 0x8C71, 0x8C71, 0x8C51, 0x8C51,
-  0x8C51, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x7BEF,
-  0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x4A69, 0x1082, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x0861, 0x0020, 0x630C, 0xB596, 0x630C,
-  0x0861, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x1082, 0x0841,
-  0x39C7, 0x39C7, 0x31A6, 0x2965, 0x0861, 0x0000, 0x0841, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x2965, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x6B6D, 0x528A, 0x31A6, 0x3186, 0x3186, 0x39E7,
-  0x528A, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x6B6D,
-  0x3186, 0x3186, 0x8C51, 0x8C71, 0x9492, 0x9492, 0x9492, 0x9492,
-  0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3,
-  0x9CD3, 0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3, 0x94B2, 0x3186, 0x3186,
-  0x7BCF, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3,
-  0x9CF3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x94B2,
-  0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x9492, 0x8410,
-  0x528A, 0x3186, 0x3186, 0x31A6, 0x630C, 0x8C51, 0x8C71, 0x8C71,
-  0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410,
-  0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x4A49, 0x0861, 0x0841, 0x0861,
-  0x0861, 0x0841, 0x0020, 0x31A6, 0x9CD3, 0xAD75, 0xB596, 0xB596,
-  0x18C3, 0x1082, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18C3, 0x0000, 0x2965,
-  0x39C7, 0x31A6, 0x3186, 0x2965, 0x2945, 0x18E3, 0x0020, 0x0020,
-  0x0841, 0x0861, 0x2945, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x630C, 0x39C7, 0x3186, 0x3186, 0x39C7, 0x4A69, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x7BEF,
-  0x3186, 0x3186, 0x7BCF, 0x9492, 0x9492, 0x94B2, 0x94B2, 0x94B2,
-  0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3, 0x9CF3,
-  0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x8C51, 0x3186, 0x3186,
-  0x8C71, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3,
-  0x9CD3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x94B2, 0x9492, 0x9492,
-  0x9492, 0x7BCF, 0x4228, 0x3186, 0x3186, 0x39E7, 0x73AE, 0x8C71,
-  0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x4228, 0x0861, 0x0841,
-  0x0841, 0x1082, 0x738E, 0xA514, 0xA534, 0xAD55, 0xB596, 0xB5B6,
-  0x8C51, 0x0020, 0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x0841, 0x1082, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x2965, 0x2945, 0x2124, 0x18E3, 0x10A2,
-  0x0000, 0x1082, 0x3186, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x4A49, 0x3186, 0x3186, 0x31A6, 0x4228, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410,
-  0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C71,
-  0x31A6, 0x3186, 0x6B6D, 0x94B2, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3,
-  0x9CD3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0xA514, 0xA514,
-  0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0x7BCF, 0x3186, 0x31A6,
-  0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514,
-  0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CF3,
-  0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2,
-  0x94B2, 0x9492, 0x9492, 0x6B6D, 0x39C7, 0x3186, 0x3186, 0x52AA,
-  0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430,
-  0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x52AA, 0x18E3, 0x0020,
-  0x4A49, 0x8C71, 0x9CD3, 0x9CF3, 0xA514, 0xAD55, 0xAD75, 0xB596,
-  0xB5B6, 0x31A6, 0x0861, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x0861, 0x0000, 0x10A2,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2104, 0x2104, 0x31A6,
-  0x4208, 0x18C3, 0x0020, 0x2124, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x5AEB, 0x31A6,
-  0x3186, 0x3186, 0x39C7, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C71, 0x9492, 0x9492,
-  0x4208, 0x3186, 0x5AEB, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CF3,
-  0x9CF3, 0x9CF3, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514,
-  0xA534, 0xA534, 0xA534, 0xA534, 0xA534, 0x632C, 0x3186, 0x4228,
-  0xA534, 0xA534, 0xA534, 0xA534, 0xA534, 0xA534, 0xA534, 0xA534,
-  0xA534, 0xA534, 0xA534, 0xA514, 0xA514, 0xA514, 0xA514, 0xA514,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x9CD3,
-  0x94B2, 0x94B2, 0x94B2, 0x9492, 0x8C51, 0x52AA, 0x3186, 0x3186,
-  0x39C7, 0x73AE, 0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430,
-  0x8430, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x39E7, 0x0841, 0x2124, 0x738E,
-  0x8C51, 0x8C71, 0x94B2, 0x9CD3, 0xA514, 0xA534, 0xAD55, 0xA534,
-  0x4A49, 0x0020, 0x0861, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x0841,
-  0x0020, 0x18E3, 0x2945, 0x2124, 0x2104, 0x18E3, 0x2965, 0x4208,
-  0x52AA, 0x6B4D, 0x5ACB, 0x0861, 0x10A2, 0x31A6, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x4A69, 0x3186, 0x3186,
-  0x31A6, 0x4208, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x9492, 0x94B2, 0x94B2,
-  0x528A, 0x3186, 0x528A, 0x9CD3, 0x9CF3, 0x9CF3, 0x9CF3, 0xA514,
-  0xA514, 0xA514, 0xA514, 0xA514, 0xA534, 0xA534, 0xA534, 0xA534,
-  0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD55, 0x52AA, 0x3186, 0x5ACB,
-  0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55,
-  0xAD55, 0xAD55, 0xA534, 0xA534, 0xA534, 0xA534, 0xA534, 0xA534,
-  0xA514, 0xA514, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CD3,
-  0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x94B2, 0x9492, 0x7BCF, 0x39E7,
-  0x3186, 0x3186, 0x5ACB, 0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x8C51,
-  0x8C51, 0x8430, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x632C, 0x52AA, 0x18C3, 0x0861, 0x528A, 0x7BCF, 0x8410,
-  0x8430, 0x8C71, 0x9492, 0x94B2, 0x9CF3, 0xA514, 0x6B4D, 0x0841,
-  0x0861, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x0861, 0x0000, 0x0841, 0x18E3, 0x2104, 0x2124, 0x39C7, 0x4A69,
-  0x630C, 0x7BCF, 0x8C71, 0x9CD3, 0x52AA, 0x0020, 0x2104, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B6D, 0x632C, 0x39E7, 0x3186, 0x3186, 0x31A6,
-  0x4228, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51,
-  0x8C71, 0x8C71, 0x9492, 0x9492, 0x9492, 0x94B2, 0x94B2, 0x9CD3,
-  0x632C, 0x3186, 0x4208, 0x9CF3, 0x9CF3, 0xA514, 0xA514, 0xA514,
-  0xA534, 0xA534, 0xA534, 0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD55,
-  0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD75, 0x4208, 0x3186, 0x6B6D,
-  0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD55,
-  0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xA534,
-  0xA534, 0xA534, 0xA534, 0xA514, 0xA514, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CF3, 0x9CD3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x94B2, 0x8C71,
-  0x52AA, 0x3186, 0x3186, 0x4208, 0x8410, 0x8C71, 0x8C71, 0x8C51,
-  0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D,
-  0x632C, 0x3186, 0x0020, 0x3186, 0x632C, 0x738E, 0x73AE, 0x7BEF,
-  0x8410, 0x8C51, 0x8C71, 0x94B2, 0x8410, 0x2124, 0x0841, 0x0861,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x0841, 0x0000, 0x0861, 0x3186, 0x4228, 0x5ACB,
-  0x6B6D, 0x8430, 0x9CD3, 0xAD75, 0xC618, 0x9CF3, 0x2945, 0x0861,
-  0x3186, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B6D, 0x5AEB, 0x31A6, 0x3186, 0x3186, 0x31A6, 0x4228,
-  0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x9492, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CD3,
-  0x7BCF, 0x3186, 0x3186, 0x9CF3, 0xA514, 0xA514, 0xA534, 0xA534,
-  0xA534, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD75, 0xAD75,
-  0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD55, 0x3186, 0x3186, 0x8430,
-  0xAD75, 0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75,
-  0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xAD55,
-  0xAD55, 0xAD55, 0xA534, 0xA534, 0xA534, 0xA534, 0xA514, 0xA514,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2,
-  0x9492, 0x738E, 0x39C7, 0x3186, 0x39C7, 0x73AE, 0x8C71, 0x8C71,
-  0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x8410, 0x7BEF,
-  0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x4A69,
-  0x0841, 0x10A2, 0x4A69, 0x630C, 0x632C, 0x6B6D, 0x738E, 0x7BCF,
-  0x7BEF, 0x8430, 0x8430, 0x4208, 0x0000, 0x0841, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x39C7, 0x632C,
-  0x7BEF, 0x9492, 0xA534, 0xBDD7, 0xC618, 0xB5B6, 0xA534, 0x630C,
-  0x0841, 0x18C3, 0x4208, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x4A69, 0x3186, 0x3186, 0x3186, 0x31A6, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9492,
-  0x9492, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3,
-  0x8C51, 0x3186, 0x3186, 0x8C71, 0xA534, 0xA534, 0xA534, 0xAD55,
-  0xAD55, 0xAD55, 0xAD55, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75,
-  0xB596, 0xB596, 0xB596, 0xB596, 0x9CD3, 0x3186, 0x3186, 0x9CD3,
-  0xB596, 0xB596, 0xB596, 0xB596, 0xB596, 0xB596, 0xB596, 0xB596,
-  0xB596, 0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75,
-  0xAD75, 0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA534,
-  0xA514, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x9CD3,
-  0x94B2, 0x94B2, 0x8430, 0x4228, 0x3186, 0x3186, 0x630C, 0x8C71,
-  0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x8410,
-  0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x632C, 0x18E3, 0x0020,
-  0x2124, 0x4A49, 0x52AA, 0x5AEB, 0x630C, 0x6B4D, 0x738E, 0x73AE,
-  0x7BEF, 0x5ACB, 0x0861, 0x0841, 0x0020, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x0861,
-  0x0841, 0x0000, 0x0841, 0x18E3, 0x2124, 0x10A2, 0x0020, 0x18E3,
-  0x73AE, 0x9CF3, 0xB596, 0xCE59, 0xBDD7, 0xAD55, 0x9CF3, 0x8C71,
-  0x7BCF, 0x3186, 0x0020, 0x2945, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x4228, 0x3186, 0x3186, 0x2965, 0x31A6, 0x4208, 0x4A69, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x9492,
-  0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3, 0xA514,
-  0x9CF3, 0x3186, 0x3186, 0x7BEF, 0xAD55, 0xAD55, 0xAD55, 0xAD55,
-  0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xB596, 0xB596, 0xB596, 0xB596,
-  0xB596, 0xB596, 0xB5B6, 0xB5B6, 0x8430, 0x3186, 0x3186, 0xB596,
-  0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6,
-  0xB5B6, 0xB596, 0xB596, 0xB596, 0xB596, 0xB596, 0xB596, 0xAD75,
-  0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xAD55, 0xA534,
-  0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CF3, 0x9CD3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x52AA, 0x3186, 0x3186, 0x52AA,
-  0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x39E7, 0x0020, 0x0861, 0x2104,
-  0x3186, 0x4208, 0x528A, 0x5ACB, 0x630C, 0x632C, 0x6B6D, 0x630C,
-  0x2104, 0x0020, 0x10A2, 0x2945, 0x2104, 0x0861, 0x0000, 0x0841,
-  0x0841, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0861,
-  0x4208, 0x6B6D, 0x8430, 0x9492, 0x9CD3, 0xA514, 0x9CF3, 0x4228,
-  0x0020, 0x52AA, 0xBDD7, 0xBDF7, 0xB596, 0xA514, 0x94B2, 0x8430,
-  0x73AE, 0x6B4D, 0x4A49, 0x1082, 0x0841, 0x39E7, 0x52AA, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x632C, 0x4208,
-  0x3186, 0x3186, 0x2965, 0x3186, 0x39E7, 0x4A49, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x9492, 0x94B2,
-  0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3, 0xA514, 0xA514, 0xA514,
-  0xA534, 0x4208, 0x3186, 0x6B4D, 0xAD55, 0xAD75, 0xAD75, 0xAD75,
-  0xAD75, 0xB596, 0xB596, 0xB596, 0xB596, 0xB5B6, 0xB5B6, 0xB5B6,
-  0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0x738E, 0x3186, 0x4228, 0xBDD7,
-  0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB596, 0xB596,
-  0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD55, 0xAD55,
-  0xAD55, 0xA534, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x6B4D, 0x3186, 0x3186,
-  0x4A49, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430,
-  0x8410, 0x8410, 0x5AEB, 0x0861, 0x0861, 0x2104, 0x2124, 0x18E3,
-  0x2945, 0x39C7, 0x4A49, 0x52AA, 0x5AEB, 0x5AEB, 0x31A6, 0x0020,
-  0x3186, 0x8410, 0x9492, 0x9CF3, 0xA514, 0xAD55, 0x9CD3, 0x632C,
-  0x18C3, 0x0841, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0841, 0x0000, 0x39C7, 0x6B4D,
-  0x7BCF, 0x8C51, 0x94B2, 0xA514, 0xAD55, 0xB596, 0xBDD7, 0xBDD7,
-  0x9CD3, 0x2945, 0x18C3, 0x8430, 0xAD55, 0x9CD3, 0x8C51, 0x7BEF,
-  0x6B6D, 0x630C, 0x528A, 0x4208, 0x18E3, 0x0020, 0x18E3, 0x528A,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x39C7, 0x3186,
-  0x3186, 0x2945, 0x3186, 0x39C7, 0x4228, 0x528A, 0x52AA, 0x5ACB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x9492, 0x94B2, 0x9CD3,
-  0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3, 0xA514, 0xA514, 0xA534, 0xA534,
-  0xA534, 0x52AA, 0x3186, 0x5ACB, 0xAD75, 0xAD75, 0xB596, 0xB596,
-  0xB596, 0xB596, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xBDD7,
-  0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0x5AEB, 0x3186, 0x5AEB, 0xBDD7,
-  0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7,
-  0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6,
-  0xB5B6, 0xB596, 0xB596, 0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD75,
-  0xAD55, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0xA514,
-  0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x73AE, 0x31A6,
-  0x3186, 0x4208, 0x8430, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430,
-  0x73AE, 0x2945, 0x0020, 0x2104, 0x3186, 0x2965, 0x2124, 0x2104,
-  0x2104, 0x3186, 0x39E7, 0x4A69, 0x4208, 0x0861, 0x10A2, 0x632C,
-  0x8C51, 0x94B2, 0xA514, 0xAD55, 0xB596, 0xBDD7, 0xBDD7, 0xBDF7,
-  0xBDD7, 0x73AE, 0x0841, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x10A2, 0x0841, 0x0020, 0x4208, 0x630C, 0x73AE,
-  0x8430, 0x94B2, 0xA514, 0xAD75, 0xBDD7, 0xC618, 0xC638, 0xCE59,
-  0xCE59, 0xCE59, 0x7BCF, 0x0861, 0x3186, 0x8410, 0x8410, 0x73AE,
-  0x632C, 0x52AA, 0x4A49, 0x39C7, 0x2945, 0x18E3, 0x1082, 0x0020,
-  0x31A6, 0x630C, 0x632C, 0x632C, 0x630C, 0x39C7, 0x3186, 0x3186,
-  0x2124, 0x2965, 0x31A6, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3,
-  0x9CF3, 0x9CF3, 0xA514, 0xA514, 0xA514, 0xA534, 0xA534, 0xAD55,
-  0xAD55, 0x6B4D, 0x3186, 0x4228, 0xB596, 0xB596, 0xB596, 0xB596,
-  0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7,
-  0xBDD7, 0xBDF7, 0xBDF7, 0xBDF7, 0x4228, 0x3186, 0x73AE, 0xBDF7,
-  0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7,
-  0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7,
-  0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xB596, 0xB596, 0xB596, 0xAD75,
-  0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA534, 0xA514,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x7BEF,
-  0x39C7, 0x3186, 0x39E7, 0x8430, 0x8C71, 0x8C71, 0x8C51, 0x4A49,
-  0x0020, 0x18E3, 0x39C7, 0x39C7, 0x31A6, 0x2965, 0x2945, 0x2124,
-  0x2104, 0x2124, 0x3186, 0x10A2, 0x0020, 0x39E7, 0x73AE, 0x8430,
-  0x94B2, 0xA514, 0xAD75, 0xBDD7, 0xC618, 0xC638, 0xCE59, 0xCE59,
-  0xCE59, 0xC638, 0xAD75, 0x2104, 0x0861, 0x1082, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x10A2, 0x0841, 0x0841, 0x2965, 0x5ACB, 0x6B6D, 0x7BEF,
-  0x9492, 0x9CF3, 0xAD75, 0xBDD7, 0xC638, 0xCE79, 0xD69A, 0xD6BA,
-  0xDEDB, 0xD6BA, 0xD69A, 0xBDF7, 0x4A49, 0x0020, 0x4208, 0x6B4D,
-  0x5AEB, 0x4A69, 0x39E7, 0x3186, 0x2104, 0x2124, 0x2945, 0x2945,
-  0x0861, 0x1082, 0x4A69, 0x630C, 0x39C7, 0x3186, 0x3186, 0x2104,
-  0x2945, 0x3186, 0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C51, 0x8C51,
-  0x8C71, 0x9492, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3,
-  0x9CF3, 0xA514, 0xA514, 0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD55,
-  0xAD75, 0x8410, 0x3186, 0x3186, 0xAD75, 0xB5B6, 0xB5B6, 0xB5B6,
-  0xB5B6, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDF7, 0xBDF7, 0xBDF7,
-  0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0x31A6, 0x3186, 0x8C71, 0xC618,
-  0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618,
-  0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7,
-  0xBDD7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB5B6, 0xB596, 0xB596,
-  0xB596, 0xAD75, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA534,
-  0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2,
-  0x8430, 0x39E7, 0x3186, 0x39E7, 0x8410, 0x6B6D, 0x10A2, 0x1082,
-  0x39C7, 0x4228, 0x4208, 0x39E7, 0x39C7, 0x3186, 0x2965, 0x2945,
-  0x2104, 0x1082, 0x0000, 0x10A2, 0x52AA, 0x6B6D, 0x8410, 0x9492,
-  0xA514, 0xAD75, 0xBDD7, 0xC638, 0xCE79, 0xD6BA, 0xDEDB, 0xDEDB,
-  0xD6BA, 0xD69A, 0xCE79, 0xBDD7, 0x2104, 0x0861, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3,
-  0x10A2, 0x0861, 0x0020, 0x18E3, 0x4208, 0x630C, 0x73AE, 0x8430,
-  0x9CD3, 0xAD55, 0xB5B6, 0xC618, 0xCE79, 0xDEDB, 0xDEFB, 0xE71C,
-  0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 0xCE79, 0x9492, 0x0841, 0x1082,
-  0x4208, 0x4228, 0x31A6, 0x2945, 0x2104, 0x2945, 0x3186, 0x39C7,
-  0x39E7, 0x2104, 0x0000, 0x3186, 0x3186, 0x3186, 0x2104, 0x2104,
-  0x2965, 0x39C7, 0x4228, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x9492, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3,
-  0xA514, 0xA514, 0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD75, 0xAD75,
-  0xAD75, 0x9CD3, 0x3186, 0x3186, 0x9CF3, 0xB5B6, 0xBDD7, 0xBDD7,
-  0xBDD7, 0xBDD7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xC618,
-  0xC618, 0xC618, 0xC618, 0xAD55, 0x3186, 0x3186, 0xA534, 0xC618,
-  0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618,
-  0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDF7,
-  0xBDF7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB5B6,
-  0xB596, 0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534,
-  0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2,
-  0x94B2, 0x8430, 0x39E7, 0x3186, 0x31A6, 0x0000, 0x2945, 0x528A,
-  0x4A69, 0x4A49, 0x4228, 0x4208, 0x39C7, 0x31A6, 0x3186, 0x2104,
-  0x0841, 0x0000, 0x18C3, 0x4A49, 0x630C, 0x73AE, 0x8C51, 0x9CD3,
-  0xAD55, 0xBDD7, 0xC638, 0xD69A, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C,
-  0xE71C, 0xDEFB, 0xD6BA, 0xCE79, 0xB596, 0x0861, 0x0861, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x0020, 0x2104, 0x18E3, 0x4A69, 0x632C, 0x7BCF, 0x8C71,
-  0x9CF3, 0xAD75, 0xBDF7, 0xCE59, 0xD6BA, 0xE71C, 0xEF5D, 0xEF7D,
-  0xEF7D, 0xEF7D, 0xEF5D, 0xE71C, 0xD6BA, 0xCE79, 0x94B2, 0x0020,
-  0x0020, 0x10A2, 0x2945, 0x18E3, 0x2124, 0x2965, 0x31A6, 0x39E7,
-  0x4228, 0x10A2, 0x18E3, 0x3186, 0x3186, 0x2104, 0x18E3, 0x2945,
-  0x31A6, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x9492,
-  0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3, 0xA514,
-  0xA514, 0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD75, 0xAD75, 0xB596,
-  0xB596, 0xAD75, 0x3186, 0x3186, 0x8C51, 0xBDD7, 0xBDD7, 0xBDD7,
-  0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xC618, 0xC618, 0xC618, 0xC618,
-  0xC618, 0xC638, 0xC638, 0x94B2, 0x3186, 0x3186, 0xBDF7, 0xC638,
-  0xC638, 0xC638, 0xC638, 0xC638, 0xC638, 0xC638, 0xC638, 0xC638,
-  0xC638, 0xC638, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618, 0xC618,
-  0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB5B6, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD75, 0xAD55,
-  0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3,
-  0x94B2, 0x94B2, 0x8C51, 0x39E7, 0x3186, 0x18E3, 0x18C3, 0x52AA,
-  0x528A, 0x4A69, 0x4A49, 0x4208, 0x39E7, 0x31A6, 0x10A2, 0x0020,
-  0x0000, 0x2104, 0x2124, 0x52AA, 0x6B4D, 0x7BEF, 0x9492, 0xA514,
-  0xB596, 0xC618, 0xCE79, 0xDEDB, 0xE71C, 0xEF5D, 0xEF7D, 0xEF7D,
-  0xEF7D, 0xEF5D, 0xE71C, 0xD6BA, 0xCE59, 0x7BEF, 0x0020, 0x1082,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2,
-  0x0861, 0x0861, 0x2965, 0x2124, 0x52AA, 0x6B4D, 0x7BEF, 0x9492,
-  0xA514, 0xB5B6, 0xC618, 0xD69A, 0xDEFB, 0xE73C, 0xEF7D, 0xF7BE,
-  0xF7BE, 0xF7BE, 0xF79E, 0xE73C, 0xDEFB, 0xD69A, 0xC618, 0x39C7,
-  0x2124, 0x18C3, 0x0020, 0x10A2, 0x2945, 0x3186, 0x39C7, 0x4208,
-  0x2965, 0x0841, 0x3186, 0x3186, 0x2104, 0x18E3, 0x2124, 0x3186,
-  0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9492,
-  0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0xA514, 0xA514, 0xA534,
-  0xA534, 0xAD55, 0xAD55, 0xAD75, 0xAD75, 0xAD75, 0xB596, 0xB596,
-  0xB5B6, 0xB5B6, 0x4208, 0x3186, 0x73AE, 0xBDD7, 0xBDF7, 0xBDF7,
-  0xBDF7, 0xC618, 0xC618, 0xC618, 0xC618, 0xC638, 0xC638, 0xC638,
-  0xC638, 0xC638, 0xC638, 0x7BEF, 0x3186, 0x4228, 0xCE59, 0xCE59,
-  0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xC638,
-  0xC638, 0xC638, 0xC638, 0xC638, 0xC638, 0xC638, 0xC618, 0xC618,
-  0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7,
-  0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xB596, 0xB596, 0xAD75, 0xAD75,
-  0xAD55, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x8430, 0x39E7, 0x3186, 0x0841, 0x39C7,
-  0x52AA, 0x528A, 0x4A49, 0x4228, 0x2124, 0x0020, 0x2945, 0x3186,
-  0x10A2, 0x2945, 0x2965, 0x5ACB, 0x6B6D, 0x8410, 0x94B2, 0xA534,
-  0xB5B6, 0xC638, 0xD69A, 0xDEFB, 0xEF5D, 0xF79E, 0xF7BE, 0xF7BE,
-  0xF7BE, 0xEF7D, 0xE73C, 0xDEFB, 0xCE79, 0xC618, 0x2104, 0x0841,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x0020, 0x2124, 0x2945, 0x2945, 0x5ACB, 0x6B6D, 0x8410, 0x94B2,
-  0xA534, 0xB5B6, 0xC638, 0xD6BA, 0xE71C, 0xEF5D, 0xF7BE, 0xFFDF,
-  0xFFFF, 0xFFDF, 0xF7BE, 0xEF5D, 0xE71C, 0xD6BA, 0xC638, 0x8C71,
-  0x0841, 0x52AA, 0x4208, 0x0861, 0x0841, 0x2965, 0x39E7, 0x4208,
-  0x0020, 0x2104, 0x3186, 0x2124, 0x2104, 0x2104, 0x2965, 0x39C7,
-  0x4228, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x94B2,
-  0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0xA514, 0xA514, 0xA534, 0xA534,
-  0xAD55, 0xAD55, 0xAD75, 0xAD75, 0xB596, 0xB596, 0xB596, 0xB5B6,
-  0xB5B6, 0xBDD7, 0x5ACB, 0x3186, 0x630C, 0xBDF7, 0xBDF7, 0xC618,
-  0xC618, 0xC618, 0xC618, 0xC638, 0xC638, 0xC638, 0xC638, 0xCE59,
-  0xCE59, 0xCE59, 0xCE59, 0x632C, 0x3186, 0x5AEB, 0xCE59, 0xCE59,
-  0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59,
-  0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC638, 0xC638,
-  0xC638, 0xC618, 0xC618, 0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDF7,
-  0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB5B6, 0xB596, 0xB596, 0xAD75,
-  0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x8430, 0x39C7, 0x2104, 0x0841,
-  0x528A, 0x528A, 0x39E7, 0x1082, 0x1082, 0x630C, 0x8410, 0x0841,
-  0x2965, 0x2945, 0x3186, 0x5ACB, 0x738E, 0x8430, 0x94B2, 0xAD55,
-  0xBDD7, 0xCE59, 0xD6BA, 0xE71C, 0xEF7D, 0xF7BE, 0xFFDF, 0xFFFF,
-  0xFFDF, 0xF79E, 0xEF5D, 0xDEFB, 0xD69A, 0xC638, 0x73AE, 0x0841,
-  0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x1082,
-  0x0000, 0x39C7, 0x2945, 0x2945, 0x5ACB, 0x6B6D, 0x8410, 0x94B2,
-  0xA534, 0xB5B6, 0xC638, 0xD6BA, 0xE71C, 0xEF7D, 0xF7BE, 0xFFDF,
-  0xFFFF, 0xFFDF, 0xF7BE, 0xEF7D, 0xE71C, 0xD6BA, 0xC638, 0xB5B6,
-  0x0861, 0x4228, 0x5ACB, 0x5ACB, 0x3186, 0x0020, 0x18E3, 0x18E3,
-  0x1082, 0x3186, 0x2124, 0x2104, 0x18E3, 0x2124, 0x31A6, 0x4208,
-  0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x94B2, 0x94B2,
-  0x9CD3, 0x9CD3, 0x9CF3, 0xA514, 0xA514, 0xA534, 0xA534, 0xAD55,
-  0xAD55, 0xAD75, 0xAD75, 0xB596, 0xB596, 0xB5B6, 0xB5B6, 0xB5B6,
-  0xBDD7, 0xBDD7, 0x6B6D, 0x3186, 0x4A49, 0xC618, 0xBDF7, 0xBDF7,
-  0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDF7, 0xBDF7, 0xC618,
-  0xC638, 0xCE59, 0xCE79, 0x4A69, 0x3186, 0x73AE, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xC638,
-  0xC638, 0xC638, 0xC638, 0xC618, 0xC618, 0xC618, 0xBDF7, 0xBDF7,
-  0xBDF7, 0xBDD7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xB596,
-  0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514,
-  0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x7BEF, 0x31A6, 0x1082,
-  0x2104, 0x2124, 0x0020, 0x4228, 0x8430, 0x8430, 0x6B4D, 0x0841,
-  0x39C7, 0x2945, 0x3186, 0x5ACB, 0x738E, 0x8430, 0x94B2, 0xAD55,
-  0xBDD7, 0xCE59, 0xD6BA, 0xE71C, 0xEF7D, 0xF7BE, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xF7BE, 0xEF5D, 0xE71C, 0xD69A, 0xC638, 0xAD75, 0x0000,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x0861,
-  0x0861, 0x39E7, 0x2965, 0x2945, 0x52AA, 0x6B6D, 0x8410, 0x9492,
-  0xA534, 0xB5B6, 0xC638, 0xD69A, 0xDEFB, 0xEF5D, 0xF79E, 0xF7BE,
-  0xFFDF, 0xFFDF, 0xF79E, 0xEF5D, 0xDEFB, 0xD69A, 0xC638, 0xB5B6,
-  0x3186, 0x31A6, 0x5ACB, 0x5AEB, 0x630C, 0x52AA, 0x10A2, 0x0000,
-  0x2965, 0x2945, 0x2104, 0x2104, 0x2104, 0x2965, 0x39C7, 0x4228,
-  0x528A, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x8C51, 0x8C51, 0x8C71, 0x9492, 0x9492, 0x94B2, 0x9CD3,
-  0x9CD3, 0x9CF3, 0xA514, 0xA514, 0xA534, 0xA534, 0xAD55, 0xAD55,
-  0xAD75, 0xAD75, 0xB596, 0xB596, 0xB5B6, 0xB5B6, 0xBDD7, 0xBDD7,
-  0xBDD7, 0xAD75, 0x7BCF, 0x3186, 0x31A6, 0x9CD3, 0x9CD3, 0x9CF3,
-  0xA514, 0xA514, 0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD75, 0xAD75,
-  0xB596, 0xB596, 0xB596, 0x31A6, 0x3186, 0x8C51, 0xCE59, 0xCE79,
-  0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xCE59,
-  0xCE59, 0xCE59, 0xC638, 0xC638, 0xC638, 0xC618, 0xC618, 0xC618,
-  0xBDF7, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA514,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x73AE, 0x2965,
-  0x0000, 0x18E3, 0x7BEF, 0x8C71, 0x8C51, 0x8C51, 0x4A69, 0x18C3,
-  0x39C7, 0x2945, 0x2965, 0x5ACB, 0x6B6D, 0x8410, 0x94B2, 0xA534,
-  0xB5B6, 0xC638, 0xD6BA, 0xE71C, 0xEF5D, 0xF79E, 0xFFDF, 0xFFDF,
-  0xF7BE, 0xF79E, 0xEF5D, 0xDEFB, 0xD69A, 0xC618, 0xB5B6, 0x18C3,
-  0x0861, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0841,
-  0x18C3, 0x39E7, 0x2965, 0x2104, 0x528A, 0x6B4D, 0x7BEF, 0x8C71,
-  0xA514, 0xB596, 0xC618, 0xCE79, 0xDEDB, 0xE71C, 0xEF5D, 0xF79E,
-  0xF79E, 0xF79E, 0xEF5D, 0xE73C, 0xDEDB, 0xCE79, 0xC618, 0xB596,
-  0x4A49, 0x2945, 0x5AEB, 0x5AEB, 0x630C, 0x52AA, 0x3186, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x18E3, 0x2945, 0x31A6, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x9492, 0x9492, 0x94B2, 0x9CD3, 0x9CD3,
-  0x9CF3, 0x9CF3, 0xA514, 0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD75,
-  0xAD75, 0xB596, 0xB596, 0xB5B6, 0xB5B6, 0xAD55, 0x9CF3, 0x9492,
-  0x8C71, 0x9492, 0x7BCF, 0x3186, 0x3186, 0x5AEB, 0x52AA, 0x4A69,
-  0x4228, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x4228,
-  0x528A, 0x5AEB, 0x632C, 0x3186, 0x3186, 0x94B2, 0xBDD7, 0xBDD7,
-  0xC618, 0xC638, 0xCE79, 0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xD69A,
-  0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC638, 0xC618,
-  0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6,
-  0xB596, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA534,
-  0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x6B4D,
-  0x2945, 0x3186, 0x73AE, 0x8C71, 0x8C71, 0x8C51, 0x39E7, 0x2124,
-  0x39E7, 0x2965, 0x2124, 0x52AA, 0x6B4D, 0x7BEF, 0x9492, 0xA514,
-  0xB596, 0xC618, 0xCE79, 0xDEDB, 0xE73C, 0xEF7D, 0xF79E, 0xF79E,
-  0xF79E, 0xEF5D, 0xE71C, 0xDEDB, 0xCE79, 0xBDF7, 0xB596, 0x3186,
-  0x0841, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0841,
-  0x18E3, 0x4208, 0x3186, 0x2104, 0x4228, 0x630C, 0x73AE, 0x8C51,
-  0x9CD3, 0xAD55, 0xBDD7, 0xC638, 0xD69A, 0xDEDB, 0xE71C, 0xE73C,
-  0xEF5D, 0xE73C, 0xE71C, 0xDEFB, 0xD69A, 0xC638, 0xBDD7, 0xAD55,
-  0x4A69, 0x2945, 0x5AEB, 0x630C, 0x5AEB, 0x31A6, 0x3186, 0x2965,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x2965, 0x39C7, 0x4228, 0x528A,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8430,
-  0x8C51, 0x8C71, 0x8C71, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CF3,
-  0x9CF3, 0xA514, 0xA534, 0xA534, 0xAD55, 0xAD55, 0xAD75, 0xAD75,
-  0xB596, 0xB596, 0xA534, 0x9492, 0x8430, 0x8430, 0x8410, 0x6B4D,
-  0x52AA, 0x4208, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x4228, 0x632C,
-  0x8C51, 0xAD75, 0xC618, 0xC618, 0xCE59, 0xCE79, 0xD6BA, 0xD6BA,
-  0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xC638, 0xC638,
-  0xC618, 0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xBDD7,
-  0xB5B6, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534,
-  0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x9492,
-  0x52AA, 0x3186, 0x39C7, 0x8410, 0x8C71, 0x8C51, 0x39C7, 0x2945,
-  0x4208, 0x2965, 0x18E3, 0x4A69, 0x632C, 0x7BCF, 0x8C71, 0x9CF3,
-  0xAD75, 0xBDD7, 0xCE59, 0xD69A, 0xDEFB, 0xE71C, 0xEF5D, 0xEF5D,
-  0xE73C, 0xE71C, 0xDEDB, 0xD69A, 0xC638, 0xBDD7, 0xAD55, 0x31A6,
-  0x0841, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x0841,
-  0x18E3, 0x4228, 0x31A6, 0x2124, 0x39C7, 0x5AEB, 0x738E, 0x8410,
-  0x9492, 0xA514, 0xB596, 0xBDF7, 0xCE59, 0xD69A, 0xDEDB, 0xDEFB,
-  0xDEFB, 0xDEFB, 0xDEDB, 0xD69A, 0xCE59, 0xBDF7, 0xB596, 0xA514,
-  0x4A49, 0x2945, 0x5AEB, 0x630C, 0x39C7, 0x3186, 0x3186, 0x2124,
-  0x2124, 0x2104, 0x18E3, 0x2124, 0x31A6, 0x4208, 0x4A69, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C51,
-  0x8C71, 0x8C71, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CF3, 0x9CF3,
-  0xA514, 0xA514, 0xA534, 0xAD55, 0xAD55, 0xAD75, 0xAD75, 0xAD55,
-  0x9492, 0x8410, 0x7BEF, 0x73AE, 0x5ACB, 0x4208, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x39C7, 0x4208, 0x4A49, 0x52AA, 0x5AEB,
-  0x630C, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x630C, 0x5ACB, 0x528A, 0x4A49, 0x39C7, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x4A49, 0x7BCF, 0xAD55, 0xC638, 0xC638, 0xCE79,
-  0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xD69A, 0xD69A,
-  0xD69A, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xCE59, 0xC638,
-  0xC638, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDD7,
-  0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55,
-  0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2,
-  0x8C71, 0x4228, 0x3186, 0x4208, 0x8C71, 0x8C71, 0x39E7, 0x2945,
-  0x4228, 0x31A6, 0x2104, 0x39E7, 0x5AEB, 0x738E, 0x8430, 0x94B2,
-  0xA534, 0xB596, 0xBDF7, 0xCE59, 0xD69A, 0xDEDB, 0xDEFB, 0xDEFB,
-  0xDEFB, 0xD6BA, 0xD69A, 0xC638, 0xBDF7, 0xB596, 0xA514, 0x3186,
-  0x0841, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18E3, 0x0841, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841,
-  0x1082, 0x4A49, 0x39C7, 0x2945, 0x2124, 0x528A, 0x632C, 0x7BCF,
-  0x8C51, 0x9CD3, 0xA534, 0xB596, 0xBDF7, 0xC638, 0xCE59, 0xCE79,
-  0xD69A, 0xCE79, 0xCE59, 0xC638, 0xBDF7, 0xB596, 0xA534, 0x9CD3,
-  0x3186, 0x31A6, 0x630C, 0x4228, 0x3186, 0x3186, 0x2945, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x2965, 0x39C7, 0x4228, 0x528A, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430, 0x8C51, 0x8C51,
-  0x8C71, 0x9492, 0x9492, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0xA514,
-  0xA514, 0xA534, 0xAD55, 0xAD55, 0xAD75, 0xA514, 0x8C51, 0x7BCF,
-  0x73AE, 0x5AEB, 0x4208, 0x3186, 0x3186, 0x3186, 0x3186, 0x39E7,
-  0x4A49, 0x5ACB, 0x632C, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7BCF, 0x6B4D, 0x52AA,
-  0x4208, 0x3186, 0x3186, 0x3186, 0x3186, 0x4A69, 0x8C51, 0xBDF7,
-  0xCE59, 0xCE79, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A,
-  0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xCE59,
-  0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xC618, 0xBDF7, 0xBDF7,
-  0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55,
-  0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2,
-  0x94B2, 0x8430, 0x39C7, 0x3186, 0x5ACB, 0x8C71, 0x4A69, 0x2104,
-  0x4A49, 0x39C7, 0x2945, 0x2945, 0x52AA, 0x6B4D, 0x7BCF, 0x8C51,
-  0x9CD3, 0xAD55, 0xB5B6, 0xBDF7, 0xC638, 0xCE79, 0xCE79, 0xD69A,
-  0xCE79, 0xCE59, 0xC638, 0xBDF7, 0xB596, 0xA534, 0x94B2, 0x18C3,
-  0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0841, 0x18C3,
-  0x1082, 0x0841, 0x0861, 0x0020, 0x0861, 0x1082, 0x1082, 0x0861,
-  0x0000, 0x528A, 0x4208, 0x3186, 0x2104, 0x39E7, 0x5AEB, 0x6B6D,
-  0x7BEF, 0x8C71, 0x9CD3, 0xA534, 0xB596, 0xB5B6, 0xBDF7, 0xC618,
-  0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xB596, 0xA534, 0x9CD3, 0x8C71,
-  0x1082, 0x4228, 0x52AA, 0x3186, 0x3186, 0x2965, 0x2124, 0x2124,
-  0x2104, 0x18E3, 0x2124, 0x3186, 0x4208, 0x4A69, 0x52AA, 0x5ACB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71,
-  0x9492, 0x9492, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0xA514, 0xA514,
-  0xA534, 0xA534, 0xAD55, 0xA514, 0x8410, 0x738E, 0x6B6D, 0x528A,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x39E7, 0x528A, 0x630C, 0x632C,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8430, 0x8410, 0x8430, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x7BEF, 0x632C, 0x4A49, 0x31A6, 0x3186, 0x3186, 0x39C7,
-  0x738E, 0xB5B6, 0xCE59, 0xCE79, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA,
-  0xD6BA, 0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE79, 0xCE59,
-  0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xC618, 0xBDF7,
-  0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75,
-  0xAD55, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3,
-  0x94B2, 0x9492, 0x738E, 0x3186, 0x3186, 0x73AE, 0x632C, 0x1082,
-  0x4A69, 0x4208, 0x3186, 0x2104, 0x4208, 0x5AEB, 0x738E, 0x8410,
-  0x8C71, 0x9CF3, 0xA534, 0xB596, 0xBDD7, 0xBDF7, 0xC618, 0xC618,
-  0xC618, 0xBDF7, 0xB5B6, 0xAD75, 0xA534, 0x9CD3, 0x8C51, 0x0020,
-  0x0861, 0x0861, 0x1082, 0x0861, 0x0841, 0x2124, 0x10A2, 0x1082,
-  0x0000, 0x2965, 0x39C7, 0x2104, 0x0000, 0x0020, 0x0861, 0x1082,
-  0x0020, 0x4208, 0x4A49, 0x39C7, 0x2945, 0x2104, 0x4A49, 0x630C,
-  0x738E, 0x7BEF, 0x8C71, 0x94B2, 0xA514, 0xAD55, 0xAD75, 0xB596,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA514, 0x9CD3, 0x8C71, 0x6B6D,
-  0x0000, 0x5ACB, 0x31A6, 0x3186, 0x2965, 0x2945, 0x2124, 0x2104,
-  0x2104, 0x18E3, 0x2965, 0x39C7, 0x4228, 0x528A, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CF3, 0x9CF3, 0xA514, 0xA534,
-  0xA534, 0xA514, 0x8410, 0x6B6D, 0x632C, 0x4A49, 0x3186, 0x3186,
-  0x3186, 0x39C7, 0x4A49, 0x5ACB, 0x630C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x73AE, 0x8410, 0x8C71, 0x9CD3, 0xA514, 0xAD55,
-  0xB596, 0xBDD7, 0xBDF7, 0xC618, 0xC618, 0xC638, 0xC638, 0xC638,
-  0xC618, 0xBDD7, 0xB5B6, 0xAD55, 0x9CF3, 0x8C71, 0x8C51, 0x8C51,
-  0x8C51, 0x8C51, 0x8C51, 0x8430, 0x7BEF, 0x630C, 0x39E7, 0x3186,
-  0x3186, 0x31A6, 0x6B6D, 0xB5B6, 0xCE79, 0xD69A, 0xD6BA, 0xD6BA,
-  0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79,
-  0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xC618,
-  0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75,
-  0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3,
-  0x9CD3, 0x94B2, 0x9492, 0x52AA, 0x3186, 0x39C7, 0x8410, 0x0020,
-  0x4A49, 0x4228, 0x39C7, 0x2945, 0x2124, 0x4A69, 0x630C, 0x738E,
-  0x8410, 0x8C71, 0x9CD3, 0xA514, 0xAD55, 0xAD75, 0xB596, 0xB596,
-  0xB596, 0xAD75, 0xAD55, 0xA514, 0x94B2, 0x8C51, 0x5AEB, 0x0020,
-  0x0861, 0x0861, 0x0841, 0x0841, 0x6B4D, 0xB5B6, 0x8C51, 0x0020,
-  0x10A2, 0x39C7, 0x31A6, 0x31A6, 0x2965, 0x1082, 0x0000, 0x0841,
-  0x0841, 0x18E3, 0x528A, 0x4208, 0x31A6, 0x2124, 0x2965, 0x528A,
-  0x630C, 0x738E, 0x7BEF, 0x8C51, 0x9492, 0x9CD3, 0x9CF3, 0xA514,
-  0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9492, 0x8C51, 0x7BEF, 0x31A6,
-  0x2104, 0x4208, 0x3186, 0x3186, 0x2945, 0x2945, 0x2124, 0x2104,
-  0x18E3, 0x2124, 0x3186, 0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x9492,
-  0x9492, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3, 0xA514, 0xA514, 0xA534,
-  0x8C71, 0x6B4D, 0x632C, 0x4A69, 0x3186, 0x3186, 0x3186, 0x39C7,
-  0x4A69, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x7BEF,
-  0x8C71, 0x9CD3, 0xA534, 0xAD55, 0xAD75, 0xB596, 0xB596, 0xB5B6,
-  0xBDD7, 0xBDF7, 0xBDF7, 0xC618, 0xC638, 0xC638, 0xCE59, 0xCE79,
-  0xCE79, 0xD69A, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEDB, 0xCE79, 0xBDF7,
-  0xA534, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51, 0x6B6D,
-  0x4A49, 0x3186, 0x3186, 0x31A6, 0x7BCF, 0xC638, 0xCE79, 0xD6BA,
-  0xDEDB, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79,
-  0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC638, 0xC618,
-  0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xB596,
-  0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x8C71, 0x39E7, 0x3186, 0x52AA, 0x2965,
-  0x2965, 0x528A, 0x4208, 0x3186, 0x2124, 0x3186, 0x52AA, 0x632C,
-  0x738E, 0x7BEF, 0x8C51, 0x9492, 0x9CD3, 0x9CF3, 0xA514, 0xA514,
-  0xA514, 0x9CF3, 0x94B2, 0x9492, 0x8430, 0x7BEF, 0x2124, 0x0020,
-  0x0841, 0x0020, 0x39E7, 0x9CD3, 0xAD75, 0xB596, 0xB5B6, 0x39E7,
-  0x31A6, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2945, 0x18E3, 0x0020,
-  0x0000, 0x0000, 0x4A49, 0x4A69, 0x39E7, 0x3186, 0x2124, 0x2965,
-  0x528A, 0x630C, 0x6B6D, 0x73AE, 0x7BEF, 0x8430, 0x8C51, 0x8C71,
-  0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x73AE, 0x630C, 0x0020,
-  0x4208, 0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x18E3, 0x2945, 0x31A6, 0x4208, 0x528A, 0x52AA, 0x5ACB, 0x5AEB,
-  0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF,
-  0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9492,
-  0x94B2, 0x94B2, 0x9CD3, 0x9CF3, 0xA514, 0xA514, 0x9CF3, 0x738E,
-  0x630C, 0x52AA, 0x31A6, 0x3186, 0x3186, 0x39C7, 0x4A69, 0x5ACB,
-  0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x73AE, 0x8C51, 0x94B2, 0x9CF3,
-  0xA514, 0xA534, 0xA534, 0xAD55, 0xAD75, 0xB596, 0xB5B6, 0xB5B6,
-  0xBDD7, 0xBDF7, 0xC618, 0xC618, 0xC638, 0xCE59, 0xCE59, 0xCE79,
-  0xD69A, 0xD69A, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C,
-  0xE71C, 0xE71C, 0xCE59, 0xAD55, 0x9492, 0x8C71, 0x8C71, 0x8C51,
-  0x8C51, 0x73AE, 0x4228, 0x3186, 0x3186, 0x39E7, 0x94B2, 0xCE79,
-  0xD69A, 0xDEDB, 0xDEDB, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A,
-  0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618,
-  0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596,
-  0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x9CD3, 0x94B2, 0x9492, 0x7BCF, 0x3186, 0x3186, 0x5AEB,
-  0x0020, 0x528A, 0x4A49, 0x39E7, 0x3186, 0x2104, 0x3186, 0x52AA,
-  0x630C, 0x6B6D, 0x7BCF, 0x8410, 0x8430, 0x8C71, 0x8C71, 0x8C71,
-  0x8C71, 0x8C51, 0x8430, 0x7BEF, 0x73AE, 0x5ACB, 0x0000, 0x0841,
-  0x10A2, 0x7BCF, 0xA514, 0xA534, 0xAD55, 0xAD75, 0xB5B6, 0xA534,
-  0x39C7, 0x31A6, 0x3186, 0x2965, 0x2945, 0x2124, 0x2104, 0x18E3,
-  0x18C3, 0x0000, 0x0841, 0x4A69, 0x4A49, 0x39E7, 0x3186, 0x2124,
-  0x2945, 0x4228, 0x5ACB, 0x632C, 0x6B6D, 0x738E, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BCF, 0x7BCF, 0x738E, 0x6B6D, 0x632C, 0x18E3, 0x2104,
-  0x39C7, 0x3186, 0x3186, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x2965, 0x39C7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x9492, 0x9492,
-  0x94B2, 0x9CD3, 0x9CF3, 0x9CF3, 0xA514, 0x8C51, 0x630C, 0x5AEB,
-  0x4208, 0x3186, 0x3186, 0x31A6, 0x4228, 0x52AA, 0x5ACB, 0x5AEB,
-  0x630C, 0x6B4D, 0x7BCF, 0x8C71, 0x9492, 0x94B2, 0x9CD3, 0x9CF3,
-  0xA514, 0xA534, 0xAD55, 0xAD55, 0xAD75, 0xB596, 0xB5B6, 0xBDD7,
-  0xBDD7, 0xAD75, 0xAD55, 0xA534, 0xAD55, 0xB596, 0xBDD7, 0xCE79,
-  0xD69A, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C,
-  0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xE71C, 0xC618, 0x9CD3, 0x9492,
-  0x8C71, 0x8C71, 0x8C51, 0x6B6D, 0x39E7, 0x3186, 0x3186, 0x5AEB,
-  0xBDF7, 0xCE79, 0xD6BA, 0xDEDB, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A,
-  0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638,
-  0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0xA514,
-  0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x52AA, 0x3186, 0x39E7,
-  0x2965, 0x2104, 0x52AA, 0x4A49, 0x39C7, 0x2965, 0x2124, 0x2965,
-  0x4A49, 0x5ACB, 0x632C, 0x6B6D, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x738E, 0x6B6D, 0x5ACB, 0x0841, 0x0020, 0x4A69,
-  0x9492, 0x94B2, 0x9CF3, 0xA514, 0xA534, 0xAD75, 0xB596, 0xB5B6,
-  0x10A2, 0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2104, 0x2124,
-  0x39C7, 0x4228, 0x2104, 0x0020, 0x31A6, 0x4A49, 0x39E7, 0x3186,
-  0x2945, 0x18E3, 0x31A6, 0x4A69, 0x5ACB, 0x5AEB, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x5AEB, 0x5ACB, 0x2945, 0x0841, 0x4208,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3,
-  0x2124, 0x3186, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x94B2,
-  0x9CD3, 0x9CD3, 0x9CF3, 0x9CF3, 0x73AE, 0x5ACB, 0x4A69, 0x31A6,
-  0x3186, 0x3186, 0x39C7, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x632C,
-  0x7BCF, 0x8430, 0x8C71, 0x9492, 0x94B2, 0x94B2, 0x9CD3, 0x9CF3,
-  0xA514, 0xA534, 0x9CF3, 0x7BCF, 0x5ACB, 0x39E7, 0x2124, 0x0861,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0x2945, 0x4A49, 0x738E, 0x9CF3, 0xD69A, 0xE71C, 0xE71C,
-  0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xCE79,
-  0xA514, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x5AEB, 0x31A6, 0x3186,
-  0x39E7, 0x9CD3, 0xCE79, 0xD6BA, 0xDEDB, 0xDEDB, 0xD6BA, 0xD6BA,
-  0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638,
-  0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514,
-  0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x9492, 0x8C51, 0x39C7, 0x3186,
-  0x5ACB, 0x0861, 0x31A6, 0x528A, 0x4228, 0x39E7, 0x3186, 0x2124,
-  0x2104, 0x39C7, 0x4A69, 0x5ACB, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x630C, 0x5AEB, 0x31A6, 0x0020, 0x2945, 0x73AE, 0x8C51,
-  0x8C71, 0x94B2, 0x9CD3, 0x9CF3, 0xA534, 0xAD55, 0xA514, 0x4208,
-  0x0841, 0x0000, 0x18C3, 0x2945, 0x2124, 0x2104, 0x2104, 0x3186,
-  0x4228, 0x5ACB, 0x738E, 0x630C, 0x10A2, 0x10A2, 0x39E7, 0x4208,
-  0x31A6, 0x2965, 0x2124, 0x18E3, 0x2965, 0x39E7, 0x4228, 0x4A69,
-  0x4A69, 0x4A69, 0x4228, 0x39E7, 0x18C3, 0x0020, 0x4A49, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3,
-  0x2945, 0x39C7, 0x4228, 0x528A, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x9492, 0x9492, 0x94B2,
-  0x9CD3, 0x9CF3, 0x9CD3, 0x630C, 0x52AA, 0x4228, 0x3186, 0x3186,
-  0x3186, 0x39E7, 0x4A69, 0x52AA, 0x5ACB, 0x630C, 0x738E, 0x8410,
-  0x8430, 0x8C51, 0x8C71, 0x9492, 0x94B2, 0x9CD3, 0x9CD3, 0x7BCF,
-  0x4A49, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x6B4D,
-  0xAD75, 0xE73C, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79E, 0xF79E,
-  0xF79E, 0xCE79, 0x9CF3, 0x9492, 0x8C71, 0x8C71, 0x7BCF, 0x4208,
-  0x3186, 0x3186, 0x73AE, 0xCE79, 0xD69A, 0xDEDB, 0xDEDB, 0xD6BA,
-  0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59,
-  0xC638, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6,
-  0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514,
-  0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x6B6D, 0x3186,
-  0x31A6, 0x6B4D, 0x0020, 0x31A6, 0x52AA, 0x4A49, 0x39E7, 0x31A6,
-  0x2965, 0x2124, 0x2104, 0x3186, 0x39E7, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x39C7, 0x0861, 0x0861, 0x52AA, 0x7BCF, 0x7BEF, 0x8430,
-  0x8C51, 0x9492, 0x94B2, 0x9CD3, 0x9CF3, 0x630C, 0x0841, 0x0861,
-  0x10A2, 0x0861, 0x0020, 0x0841, 0x18E3, 0x18E3, 0x2945, 0x39E7,
-  0x528A, 0x632C, 0x7BEF, 0x9492, 0xA514, 0x630C, 0x0020, 0x2124,
-  0x4208, 0x39E7, 0x31A6, 0x2965, 0x2945, 0x2124, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x0861, 0x0841, 0x4A49, 0x4208, 0x3186,
-  0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x2965, 0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9492, 0x94B2, 0x9CD3,
-  0x9CD3, 0x9492, 0x52AA, 0x528A, 0x39C7, 0x3186, 0x3186, 0x3186,
-  0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x6B4D, 0x7BCF, 0x7BEF, 0x8410,
-  0x8430, 0x8C51, 0x8C71, 0x9492, 0x7BEF, 0x4228, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x4000, 0x6800, 0x8800,
-  0xA800, 0xB800, 0xC800, 0xC800, 0xC800, 0xC800, 0xB800, 0xA800,
-  0x8800, 0x6800, 0x4000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18C3, 0x6B6D, 0xCE59, 0xEF7D, 0xF79E, 0xF79E, 0xF79E,
-  0xF7BE, 0xF7BE, 0xF79E, 0xC618, 0x94B2, 0x9492, 0x8C71, 0x8C51,
-  0x5ACB, 0x3186, 0x3186, 0x52AA, 0xC618, 0xD69A, 0xDEDB, 0xDEDB,
-  0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7,
-  0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA534,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x9492, 0x9492, 0x4228,
-  0x3186, 0x528A, 0x738E, 0x0861, 0x2104, 0x528A, 0x4A69, 0x4208,
-  0x39C7, 0x31A6, 0x2965, 0x2945, 0x2124, 0x2104, 0x18E3, 0x18E3,
-  0x0861, 0x0000, 0x3186, 0x632C, 0x738E, 0x73AE, 0x7BEF, 0x8410,
-  0x8430, 0x8C71, 0x9492, 0x7BCF, 0x18E3, 0x0841, 0x0861, 0x1082,
-  0x10A2, 0x10A2, 0x1082, 0x0841, 0x0000, 0x0861, 0x31A6, 0x4A49,
-  0x5AEB, 0x73AE, 0x8C51, 0x9CF3, 0xB596, 0xCE59, 0xA514, 0x3186,
-  0x0841, 0x3186, 0x4228, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x3186,
-  0x2945, 0x18C3, 0x0020, 0x18C3, 0x528A, 0x52AA, 0x3186, 0x3186,
-  0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2124,
-  0x3186, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x9492, 0x9492, 0x94B2, 0x9CD3,
-  0x8C51, 0x4A49, 0x4A49, 0x31A6, 0x3186, 0x3186, 0x3186, 0x39E7,
-  0x4A49, 0x528A, 0x5AEB, 0x6B6D, 0x73AE, 0x7BCF, 0x7BEF, 0x8410,
-  0x8430, 0x8C51, 0x632C, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1000, 0x5800, 0xA000, 0xD800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xD800, 0xA000, 0x5800, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xAD75, 0xF79E, 0xF79E,
-  0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xE73C, 0xA534, 0x9492, 0x8C71,
-  0x8C71, 0x6B6D, 0x31A6, 0x3186, 0x4228, 0xBDD7, 0xD69A, 0xDEDB,
-  0xDEDB, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79,
-  0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7,
-  0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534,
-  0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x7BCF,
-  0x3186, 0x3186, 0x7BEF, 0x8410, 0x2945, 0x0020, 0x2965, 0x4A49,
-  0x4A49, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x18E3, 0x0020,
-  0x10A2, 0x4A69, 0x630C, 0x632C, 0x6B6D, 0x738E, 0x7BCF, 0x7BEF,
-  0x8430, 0x8410, 0x39C7, 0x0020, 0x0841, 0x0861, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0020, 0x0020, 0x39C7,
-  0x6B6D, 0x8410, 0x94B2, 0xAD55, 0xC618, 0xBDF7, 0xB596, 0xA514,
-  0x632C, 0x0861, 0x0861, 0x2124, 0x2965, 0x2124, 0x18E3, 0x0861,
-  0x0000, 0x0861, 0x2124, 0x39E7, 0x528A, 0x39E7, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945,
-  0x39C7, 0x4228, 0x528A, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410,
-  0x8430, 0x8C51, 0x8C51, 0x8C71, 0x9492, 0x94B2, 0x9CD3, 0x8430,
-  0x39E7, 0x4208, 0x31A6, 0x3186, 0x3186, 0x2965, 0x39C7, 0x4228,
-  0x528A, 0x630C, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410,
-  0x630C, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0800, 0x6000, 0xB800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xB800, 0x6000, 0x0800, 0x0000, 0x0000, 0x0000, 0x31A6, 0xB596,
-  0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xC618, 0x9492,
-  0x9492, 0x8C71, 0x7BCF, 0x39E7, 0x3186, 0x39E7, 0xB596, 0xD69A,
-  0xD6BA, 0xDEDB, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79,
-  0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDF7,
-  0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534,
-  0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x9492, 0x8C71,
-  0x528A, 0x3186, 0x4A69, 0x73AE, 0x4A49, 0x2124, 0x1082, 0x0000,
-  0x1082, 0x2124, 0x2945, 0x2965, 0x2104, 0x0020, 0x0020, 0x2945,
-  0x4A49, 0x52AA, 0x5AEB, 0x630C, 0x6B4D, 0x6B6D, 0x73AE, 0x7BCF,
-  0x528A, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x0020,
-  0x18E3, 0x73AE, 0xA514, 0xB5B6, 0xC638, 0xB5B6, 0xAD55, 0x9CD3,
-  0x8C51, 0x73AE, 0x31A6, 0x0000, 0x0861, 0x18C3, 0x2124, 0x31A6,
-  0x39E7, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x2965,
-  0x39C7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x8C51, 0x8C71, 0x9492, 0x9492, 0x94B2, 0x8430, 0x39C7,
-  0x39C7, 0x3186, 0x3186, 0x2965, 0x2945, 0x31A6, 0x4208, 0x4A69,
-  0x630C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x6B6D, 0x2124,
-  0x0000, 0x0000, 0x0000, 0x2000, 0x9000, 0xF000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF000, 0x9000, 0x2000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0xD69A, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xDEFB,
-  0x9CD3, 0x9492, 0x8C71, 0x8410, 0x4208, 0x3186, 0x39C7, 0xAD75,
-  0xCE79, 0xDEDB, 0xDEDB, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79,
-  0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xBDF7,
-  0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55,
-  0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492,
-  0x7BEF, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x39C7, 0x5ACB,
-  0x52AA, 0x39E7, 0x2945, 0x1082, 0x0000, 0x1082, 0x2104, 0x3186,
-  0x39E7, 0x4A69, 0x5ACB, 0x5AEB, 0x632C, 0x6B4D, 0x5AEB, 0x18E3,
-  0x0861, 0x2104, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x2124, 0x2945,
-  0x10A2, 0x0020, 0x528A, 0xBDF7, 0xBDF7, 0xAD75, 0x9CF3, 0x9492,
-  0x8410, 0x73AE, 0x632C, 0x4A49, 0x1082, 0x0841, 0x31A6, 0x528A,
-  0x528A, 0x528A, 0x4A49, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x2124, 0x3186,
-  0x39E7, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8C51, 0x8C71, 0x9492, 0x94B2, 0x8430, 0x3186, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2124, 0x3186, 0x39E7, 0x4A69, 0x630C,
-  0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x4208, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x9800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x9800, 0x2000, 0x0000,
-  0x0000, 0x0020, 0x8410, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xEF7D, 0xA514, 0x9492, 0x8C71, 0x8430, 0x4228, 0x3186, 0x39C7,
-  0xAD75, 0xCE79, 0xDEDB, 0xDEDB, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A,
-  0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7,
-  0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55,
-  0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x9492,
-  0x8C71, 0x528A, 0x3186, 0x3186, 0x39E7, 0x632C, 0x8430, 0x8430,
-  0x8410, 0x52AA, 0x0861, 0x0861, 0x2104, 0x2124, 0x2104, 0x2124,
-  0x31A6, 0x4228, 0x528A, 0x5ACB, 0x5AEB, 0x3186, 0x0020, 0x2945,
-  0x528A, 0x4A69, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x2945, 0x2945,
-  0x2965, 0x2945, 0x1082, 0x1082, 0x7BCF, 0xA534, 0x94B2, 0x8C51,
-  0x7BCF, 0x6B4D, 0x5AEB, 0x4A69, 0x39E7, 0x2104, 0x0020, 0x10A2,
-  0x4A49, 0x52AA, 0x52AA, 0x528A, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x31A6,
-  0x4208, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D,
-  0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8430,
-  0x8C51, 0x8C71, 0x8C71, 0x9492, 0x8C71, 0x3186, 0x2965, 0x3186,
-  0x3186, 0x2965, 0x2104, 0x2965, 0x39C7, 0x4A49, 0x5AEB, 0x630C,
-  0x632C, 0x6B4D, 0x6B6D, 0x630C, 0x18C3, 0x0000, 0x0000, 0x0800,
-  0x8800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x8800,
-  0x0800, 0x0000, 0x0000, 0x31A6, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF7BE, 0xAD55, 0x9492, 0x8C71, 0x8430, 0x4228, 0x3186,
-  0x39E7, 0xB5B6, 0xCE79, 0xDEDB, 0xDEDB, 0xD6BA, 0xD6BA, 0xD69A,
-  0xD69A, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618, 0xC618,
-  0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55,
-  0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x9492,
-  0x9492, 0x7BEF, 0x3186, 0x3186, 0x7BCF, 0x8C51, 0x8C51, 0x73AE,
-  0x2104, 0x0020, 0x2124, 0x3186, 0x2965, 0x2945, 0x2104, 0x18E3,
-  0x2965, 0x39E7, 0x4A49, 0x39C7, 0x0841, 0x18C3, 0x4A69, 0x5ACB,
-  0x52AA, 0x52AA, 0x18E3, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x18E3, 0x2945, 0x2945,
-  0x2965, 0x3186, 0x3186, 0x2104, 0x0841, 0x2945, 0x7BCF, 0x7BEF,
-  0x738E, 0x630C, 0x528A, 0x4228, 0x31A6, 0x2945, 0x18E3, 0x1082,
-  0x0000, 0x2945, 0x52AA, 0x4208, 0x3186, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7,
-  0x4228, 0x528A, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8C51, 0x8C71, 0x9492, 0x9492, 0x39E7, 0x2124, 0x3186, 0x3186,
-  0x2965, 0x2104, 0x2124, 0x31A6, 0x4228, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x6B4D, 0x4A49, 0x0020, 0x0000, 0x0000, 0x4800, 0xE000,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xE000, 0x4800, 0x0000, 0x0000, 0x0861, 0xAD55, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xAD75, 0x9492, 0x8C71, 0x8430, 0x4208,
-  0x3186, 0x4228, 0xC618, 0xD69A, 0xDEDB, 0xD6BA, 0xD6BA, 0xD69A,
-  0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC618, 0xC618,
-  0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75,
-  0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2,
-  0x9492, 0x8C71, 0x4A69, 0x3186, 0x528A, 0x8430, 0x4228, 0x0020,
-  0x18E3, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x2945, 0x2124, 0x2104,
-  0x2104, 0x2945, 0x10A2, 0x0841, 0x4208, 0x630C, 0x5AEB, 0x5ACB,
-  0x52AA, 0x52AA, 0x31A6, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x2124, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x18E3, 0x0020, 0x39E7,
-  0x632C, 0x5ACB, 0x4A49, 0x39E7, 0x2965, 0x18E3, 0x2124, 0x2965,
-  0x2945, 0x0861, 0x0861, 0x2124, 0x3186, 0x31A6, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x2965, 0x39E7,
-  0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8430,
-  0x8C51, 0x8C71, 0x9492, 0x528A, 0x18E3, 0x2965, 0x3186, 0x3186,
-  0x2104, 0x2104, 0x2965, 0x39E7, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x31A6, 0x0000, 0x0000, 0x0800, 0x9800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF820, 0xF820,
-  0xF840, 0xF840, 0xF840, 0xF840, 0xF840, 0xF840, 0xF840, 0xF840,
-  0xF840, 0xF820, 0xF820, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x9800, 0x0800, 0x0000, 0x0000, 0x7BEF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xAD75, 0x9492, 0x8C71, 0x8410,
-  0x39E7, 0x3186, 0x52AA, 0xCE59, 0xD69A, 0xDEDB, 0xD6BA, 0xD6BA,
-  0xD69A, 0xD69A, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618,
-  0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75,
-  0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2,
-  0x9492, 0x8C71, 0x73AE, 0x3186, 0x2124, 0x1082, 0x10A2, 0x39E7,
-  0x4A49, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x2965, 0x2945, 0x2104,
-  0x1082, 0x0000, 0x2965, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x4A69, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x2124, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x3186, 0x1082,
-  0x0861, 0x39C7, 0x4208, 0x3186, 0x2124, 0x2104, 0x2945, 0x3186,
-  0x39C7, 0x4208, 0x18E3, 0x0020, 0x3186, 0x31A6, 0x3186, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x3186, 0x39E7,
-  0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x6B6D, 0x2104, 0x2945, 0x3186, 0x3186, 0x2124,
-  0x18E3, 0x2124, 0x31A6, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x2124, 0x0000, 0x0000, 0x2000, 0xD000, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF820, 0xF840, 0xF840, 0xF840, 0xF860, 0xF860,
-  0xF860, 0xF860, 0xF860, 0xF860, 0xF880, 0xF860, 0xF860, 0xF860,
-  0xF860, 0xF860, 0xF860, 0xF840, 0xF840, 0xF840, 0xF820, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xD000, 0x2000, 0x0000, 0x0000, 0x5AEB,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xAD55, 0x9492, 0x8C71,
-  0x7BCF, 0x31A6, 0x3186, 0x73AE, 0xCE79, 0xD6BA, 0xD6BA, 0xD6BA,
-  0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC618,
-  0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75,
-  0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2,
-  0x9492, 0x9492, 0x8C71, 0x4208, 0x0020, 0x2104, 0x52AA, 0x528A,
-  0x4A49, 0x4228, 0x4208, 0x39E7, 0x31A6, 0x3186, 0x2104, 0x0841,
-  0x10A2, 0x5ACB, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x528A, 0x18E3, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x18C3, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208,
-  0x2945, 0x0020, 0x1082, 0x2124, 0x18E3, 0x2124, 0x2965, 0x31A6,
-  0x39E7, 0x4208, 0x0020, 0x2104, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2104, 0x18E3, 0x2124, 0x31A6, 0x4208,
-  0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D,
-  0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8C51,
-  0x8C71, 0x8430, 0x2965, 0x2124, 0x3186, 0x3186, 0x2945, 0x2104,
-  0x2104, 0x2965, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x18E3,
-  0x0000, 0x0000, 0x4000, 0xE800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF840, 0xF840, 0xF860, 0xF860, 0xF860, 0xF880, 0xF880, 0xF880,
-  0xF8A0, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1,
-  0xF8A0, 0xF880, 0xF880, 0xF880, 0xF860, 0xF860, 0xF860, 0xF840,
-  0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xE800, 0x4000, 0x0000, 0x0000,
-  0x4A69, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xA514, 0x8C71,
-  0x8C51, 0x6B4D, 0x3186, 0x3186, 0x9CD3, 0xCE59, 0xD6BA, 0xD6BA,
-  0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638,
-  0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75,
-  0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x94B2,
-  0x94B2, 0x9492, 0x8C71, 0x6B4D, 0x2104, 0x0020, 0x528A, 0x528A,
-  0x4A69, 0x4A49, 0x4228, 0x39E7, 0x31A6, 0x1082, 0x0020, 0x4228,
-  0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x52AA, 0x52AA, 0x31A6, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x2104, 0x2945, 0x2945, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x18C3, 0x0000, 0x10A2, 0x2945, 0x3186, 0x39C7,
-  0x4208, 0x18E3, 0x1082, 0x3186, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x31A6, 0x4228,
-  0x528A, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D,
-  0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C51,
-  0x8C71, 0x4208, 0x2124, 0x3186, 0x3186, 0x2965, 0x2124, 0x2104,
-  0x2124, 0x39C7, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x18E3, 0x0000,
-  0x0000, 0x5800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF840,
-  0xF860, 0xF860, 0xF880, 0xF880, 0xF8A1, 0xF8A1, 0xF8C1, 0xF8C1,
-  0xF8C1, 0xF8C1, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8C1,
-  0xF8C1, 0xF8C1, 0xF8C1, 0xF8A1, 0xF8A1, 0xF880, 0xF880, 0xF860,
-  0xF860, 0xF840, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x5800, 0x0000,
-  0x0000, 0x4A69, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xEF5D, 0x94B2,
-  0x8C71, 0x8C51, 0x52AA, 0x3186, 0x39E7, 0xBDD7, 0xCE79, 0xD6BA,
-  0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638,
-  0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596,
-  0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3,
-  0x94B2, 0x9492, 0x8C71, 0x8C51, 0x31A6, 0x1082, 0x2124, 0x52AA,
-  0x528A, 0x4A69, 0x4228, 0x2124, 0x0020, 0x2965, 0x6B6D, 0x738E,
-  0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5ACB, 0x52AA, 0x52AA, 0x4A49, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x1082, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x39C7, 0x0861, 0x0841, 0x2945, 0x4208,
-  0x39C7, 0x0000, 0x2965, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7, 0x4228,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x6B4D, 0x2945, 0x2965, 0x3186, 0x3186, 0x2124, 0x2104, 0x18E3,
-  0x2965, 0x39C7, 0x4208, 0x4A69, 0x52AA, 0x2104, 0x0000, 0x0000,
-  0x5800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF840, 0xF860, 0xF880,
-  0xF880, 0xF8A1, 0xF8A1, 0xF8C1, 0xF8C1, 0xF8E1, 0xF8E1, 0xF8E1,
-  0xF901, 0xF901, 0xF901, 0xF901, 0xF901, 0xF901, 0xF901, 0xF901,
-  0xF901, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8C1, 0xF8C1, 0xF8A1, 0xF8A1,
-  0xF880, 0xF880, 0xF860, 0xF840, 0xF840, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x5800,
-  0x0000, 0x0000, 0x5AEB, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xD6BA,
-  0x9492, 0x8C71, 0x8430, 0x4208, 0x3186, 0x5AEB, 0xCE59, 0xD69A,
-  0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE59, 0xCE59, 0xC638,
-  0xC618, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB596, 0xB596,
-  0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3,
-  0x94B2, 0x9492, 0x8C71, 0x8C71, 0x52AA, 0x2965, 0x0020, 0x4A49,
-  0x52AA, 0x39E7, 0x0861, 0x10A2, 0x630C, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x10A2, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x10A2, 0x2124, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x2965, 0x0020, 0x18C3,
-  0x1082, 0x18C3, 0x3186, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8C51, 0x8430,
-  0x3186, 0x2965, 0x3186, 0x3186, 0x2945, 0x2124, 0x2104, 0x2104,
-  0x2965, 0x31A6, 0x4208, 0x4A49, 0x2945, 0x0000, 0x0000, 0x5800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF820, 0xF840, 0xF860, 0xF880, 0xF880, 0xF8A1,
-  0xF8C1, 0xF8C1, 0xF8E1, 0xF8E1, 0xF901, 0xF901, 0xF921, 0xF921,
-  0xF921, 0xF921, 0xF941, 0xF941, 0xF941, 0xF941, 0xF941, 0xF921,
-  0xF921, 0xF921, 0xF921, 0xF901, 0xF901, 0xF8E1, 0xF8E1, 0xF8C1,
-  0xF8C1, 0xF8A1, 0xF880, 0xF880, 0xF860, 0xF840, 0xF820, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0x5800, 0x0000, 0x0000, 0x7BCF, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE,
-  0xBDF7, 0x8C71, 0x8C51, 0x73AE, 0x31A6, 0x3186, 0x9492, 0xC638,
-  0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xC638,
-  0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596,
-  0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3,
-  0x94B2, 0x9492, 0x9492, 0x8C71, 0x7BCF, 0x3186, 0x18C3, 0x10A2,
-  0x2104, 0x0020, 0x4A49, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x2945, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x18E3, 0x2124, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x4A49, 0x18E3,
-  0x0841, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x3186, 0x39E7, 0x4A49,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8C51, 0x52AA,
-  0x2965, 0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x18E3, 0x2104,
-  0x2965, 0x31A6, 0x4208, 0x3186, 0x0000, 0x0000, 0x4000, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF840, 0xF860, 0xF860, 0xF880, 0xF8A1, 0xF8C1, 0xF8E1,
-  0xF8E1, 0xF901, 0xF901, 0xF921, 0xF921, 0xF941, 0xF941, 0xF962,
-  0xF962, 0xF962, 0xF962, 0xF962, 0xF962, 0xF962, 0xF962, 0xF9E4,
-  0xFA04, 0xF962, 0xF941, 0xF941, 0xF921, 0xF921, 0xF901, 0xF901,
-  0xF8E1, 0xF8E1, 0xF8C1, 0xF8A1, 0xF880, 0xF860, 0xF860, 0xF840,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0x4000, 0x0000, 0x0000, 0xAD55, 0xFFDF, 0xF7BE, 0xF7BE,
-  0xF79E, 0xA514, 0x8C71, 0x8430, 0x5ACB, 0x3186, 0x39E7, 0xBDF7,
-  0xCE79, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59,
-  0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596,
-  0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3,
-  0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x39E7, 0x3186, 0x1082,
-  0x2965, 0x7BCF, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x52AA, 0x528A, 0x39E7, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x39C7, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x3186, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x7BCF, 0x3186,
-  0x2965, 0x3186, 0x3186, 0x2965, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x2945, 0x31A6, 0x31A6, 0x0000, 0x0000, 0x2000, 0xE800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF840, 0xF860, 0xF880, 0xF8A0, 0xF8C1, 0xF8C1, 0xF8E1, 0xF901,
-  0xF921, 0xF921, 0xF941, 0xF942, 0xF962, 0xF962, 0xF982, 0xF982,
-  0xF982, 0xF9A2, 0xF9A2, 0xF9A2, 0xF9A2, 0xF9A2, 0xF9A2, 0xFC8F,
-  0xFFFF, 0xFF7D, 0xFDB5, 0xFBED, 0xF9C4, 0xF942, 0xF941, 0xF921,
-  0xF921, 0xF901, 0xF8E1, 0xF8C1, 0xF8C1, 0xF8A0, 0xF880, 0xF860,
-  0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xE800, 0x2000, 0x0000, 0x0861, 0xD6BA, 0xF7BE, 0xF7BE,
-  0xF7BE, 0xDEFB, 0x8C71, 0x8C51, 0x8410, 0x39E7, 0x3186, 0x73AE,
-  0xC638, 0xD69A, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE59, 0xCE59,
-  0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596,
-  0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CD3,
-  0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x5ACB, 0x3186, 0x4228,
-  0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x4A69, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x3186, 0x3186, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x18E3, 0x2124, 0x3186, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430, 0x4A69, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x2945, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x2945, 0x3186, 0x0861, 0x0000, 0x0800, 0xD000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840,
-  0xF860, 0xF880, 0xF8A1, 0xF8C1, 0xF8E1, 0xF901, 0xF901, 0xF921,
-  0xF941, 0xF962, 0xF962, 0xF982, 0xF982, 0xF9A2, 0xF9A2, 0xF9C2,
-  0xF9C2, 0xF9C2, 0xF9C2, 0xF9E2, 0xF9E2, 0xF9E2, 0xF9C2, 0xFD94,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFDF6, 0xFB09, 0xF962,
-  0xF941, 0xF921, 0xF901, 0xF901, 0xF8E1, 0xF8C1, 0xF8A1, 0xF880,
-  0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xD000, 0x0800, 0x0000, 0x3186, 0xEF7D, 0xF79E,
-  0xF79E, 0xF79E, 0xBDD7, 0x8C51, 0x8430, 0x6B4D, 0x3186, 0x31A6,
-  0xB596, 0xCE59, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE59, 0xCE59,
-  0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB596,
-  0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CD3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x7BCF, 0x3186, 0x3186,
-  0x8430, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x18C3, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x10A2, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x4A49,
-  0x3186, 0x3186, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x18E3, 0x2124, 0x31A6, 0x4208, 0x528A,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x7BCF, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3,
-  0x2945, 0x18C3, 0x0000, 0x0000, 0x9800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860,
-  0xF880, 0xF8A1, 0xF8C1, 0xF8E1, 0xF901, 0xF921, 0xF941, 0xF962,
-  0xF962, 0xF982, 0xF9A2, 0xF9A2, 0xF9C2, 0xF9E2, 0xF9E2, 0xF9E2,
-  0xFA02, 0xFA03, 0xFA03, 0xFA03, 0xFA03, 0xFA03, 0xFA03, 0xFE78,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE99,
-  0xFB09, 0xF962, 0xF941, 0xF921, 0xF901, 0xF8E1, 0xF8C1, 0xF8A1,
-  0xF880, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0x9800, 0x0000, 0x0000, 0x7BEF, 0xF79E,
-  0xF79E, 0xF79E, 0xEF5D, 0x94B2, 0x8C51, 0x8410, 0x4228, 0x3186,
-  0x6B4D, 0xC618, 0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59,
-  0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6,
-  0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8C51, 0x39E7, 0x3186,
-  0x6B6D, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x2945, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x18E3, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x4208,
-  0x3186, 0x31A6, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x31A6, 0x4228, 0x528A,
-  0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x528A, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3,
-  0x2104, 0x0000, 0x0000, 0x4800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF880,
-  0xF8A1, 0xF8E1, 0xF901, 0xF901, 0xF921, 0xF942, 0xF962, 0xF982,
-  0xF9A2, 0xF9C2, 0xF9C2, 0xF9E2, 0xFA02, 0xFA03, 0xFA23, 0xFA23,
-  0xFA23, 0xFA23, 0xFA43, 0xFA43, 0xFA43, 0xFA43, 0xFA43, 0xFF5C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFDB5, 0xF9E4, 0xF942, 0xF921, 0xF901, 0xF901, 0xF8E1,
-  0xF8A1, 0xF880, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0x4800, 0x0000, 0x0020, 0xCE79,
-  0xF79E, 0xEF7D, 0xEF7D, 0xC638, 0x8C51, 0x8430, 0x6B6D, 0x3186,
-  0x31A6, 0xAD75, 0xC638, 0xD6BA, 0xD69A, 0xCE79, 0xCE79, 0xCE59,
-  0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x52AA, 0x3186,
-  0x528A, 0x8C51, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x39C7, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x31A6,
-  0x3186, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7, 0x4228, 0x528A,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x7BCF, 0x39C7, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x18E3,
-  0x0841, 0x0000, 0x0800, 0xE000, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF880, 0xF8C1,
-  0xF8E1, 0xF901, 0xF921, 0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9A2,
-  0xF9C2, 0xF9E2, 0xFA02, 0xFA03, 0xFA23, 0xFA43, 0xFA43, 0xFA43,
-  0xFA63, 0xFA63, 0xFA63, 0xFA63, 0xFA63, 0xFA63, 0xFAA4, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF7D, 0xFB2A, 0xF962, 0xF941, 0xF921, 0xF901,
-  0xF8E1, 0xF8C1, 0xF880, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xE000, 0x0800, 0x0000, 0x4228,
-  0xEF7D, 0xEF7D, 0xEF7D, 0xEF5D, 0x9CD3, 0x8430, 0x8410, 0x4228,
-  0x3186, 0x6B6D, 0xBDF7, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x6B6D, 0x3186,
-  0x39C7, 0x8C51, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x4A49, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x4A69, 0x3186,
-  0x3186, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7, 0x4228, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x5AEB, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2104, 0x10A2,
-  0x0000, 0x0000, 0x8800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF880, 0xF8A1, 0xF8E1,
-  0xF901, 0xF921, 0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9C2, 0xF9E2,
-  0xFA02, 0xFA03, 0xFA23, 0xFA43, 0xFA63, 0xFA63, 0xFA83, 0xFA83,
-  0xFA83, 0xFAA3, 0xFAA3, 0xFAA3, 0xFAA3, 0xFAA3, 0xFBA9, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC6F, 0xF962, 0xF941, 0xF921,
-  0xF901, 0xF8E1, 0xF8A1, 0xF880, 0xF860, 0xF840, 0xF820, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x8800, 0x0000, 0x0000,
-  0xAD75, 0xEF5D, 0xEF5D, 0xEF5D, 0xC638, 0x8C51, 0x8410, 0x6B4D,
-  0x3186, 0x39C7, 0xB5B6, 0xC638, 0xD69A, 0xD69A, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8410, 0x31A6,
-  0x3186, 0x7BCF, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x1082, 0x0841,
-  0x0861, 0x1082, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x4228, 0x3186,
-  0x31A6, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7, 0x4228, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x8410, 0x4208, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x2965, 0x2945, 0x2965, 0x2945, 0x2124, 0x2124, 0x0020,
-  0x0000, 0x2000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF840, 0xF860, 0xF880, 0xF8A1, 0xF8E1, 0xF901,
-  0xF921, 0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9C2, 0xF9E2, 0xFA03,
-  0xFA23, 0xFA43, 0xFA63, 0xFA63, 0xFA83, 0xFAA3, 0xFAA3, 0xFAC4,
-  0xFAC4, 0xFAC4, 0xFAE4, 0xFAE4, 0xFAE4, 0xFAE4, 0xFC8D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD33, 0xF962, 0xF941,
-  0xF921, 0xF901, 0xF8E1, 0xF8A1, 0xF880, 0xF860, 0xF840, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x2000, 0x0000,
-  0x3186, 0xEF5D, 0xEF5D, 0xE73C, 0xE73C, 0x9492, 0x8430, 0x7BEF,
-  0x39E7, 0x3186, 0x8410, 0xBDF7, 0xD69A, 0xD69A, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x4228,
-  0x3186, 0x632C, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x18E3, 0x0841,
-  0x0861, 0x10A2, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x39E7, 0x3186,
-  0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x6B6D, 0x39C7, 0x3186, 0x3186, 0x31A6,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x18C3, 0x0000,
-  0x0000, 0x9800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF860, 0xF880, 0xF8A1, 0xF8C1, 0xF901, 0xF921,
-  0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9C2, 0xF9E2, 0xFA23, 0xFA23,
-  0xFA43, 0xFA63, 0xFA83, 0xFAA3, 0xFAC4, 0xFAC4, 0xFAE4, 0xFAE4,
-  0xFB04, 0xFB04, 0xFB04, 0xFB04, 0xFB04, 0xFB04, 0xFD71, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD12, 0xF962,
-  0xF941, 0xF921, 0xF901, 0xF8C1, 0xF8A1, 0xF880, 0xF860, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x9800, 0x0000,
-  0x0000, 0xAD55, 0xE73C, 0xE73C, 0xE73C, 0xBDD7, 0x8430, 0x8410,
-  0x5ACB, 0x3186, 0x4A49, 0xBDD7, 0xCE59, 0xD69A, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x5ACB,
-  0x3186, 0x528A, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x2945, 0x0841,
-  0x0861, 0x18C3, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x31A6, 0x3186,
-  0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x52AA, 0x39C7, 0x3186, 0x3186, 0x31A6,
-  0x3186, 0x2965, 0x3186, 0x2965, 0x2965, 0x2945, 0x0841, 0x0000,
-  0x2000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF840, 0xF860, 0xF8A0, 0xF8C1, 0xF8E1, 0xF901, 0xF941,
-  0xF962, 0xF982, 0xF9A2, 0xF9E2, 0xFA02, 0xFA23, 0xFA43, 0xFA63,
-  0xFA83, 0xFAA3, 0xFAC4, 0xFAC4, 0xFAE4, 0xFB04, 0xFB04, 0xFB24,
-  0xFB24, 0xFB44, 0xFB44, 0xFB44, 0xFB44, 0xFB44, 0xFE35, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC6F,
-  0xF962, 0xF941, 0xF901, 0xF8E1, 0xF8C1, 0xF8A0, 0xF860, 0xF840,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x2000,
-  0x0000, 0x39E7, 0xE73C, 0xE73C, 0xE71C, 0xDEDB, 0x8C51, 0x8410,
-  0x73AE, 0x31A6, 0x3186, 0xA514, 0xC618, 0xD69A, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x6B4D,
-  0x3186, 0x39E7, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x31A6, 0x0841,
-  0x0861, 0x18E3, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x3186, 0x3186,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x7BCF, 0x7BEF, 0x4208, 0x31A6, 0x3186, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2104, 0x0000, 0x0000,
-  0x9000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF840, 0xF860, 0xF880, 0xF8C1, 0xF8E1, 0xF901, 0xF921, 0xF962,
-  0xF982, 0xF9A2, 0xF9C2, 0xFA02, 0xFA23, 0xFA43, 0xFA63, 0xFA83,
-  0xFAA3, 0xFAC4, 0xFAE4, 0xFB04, 0xFB24, 0xFB24, 0xFB44, 0xFB44,
-  0xFB65, 0xFB65, 0xFB65, 0xFB85, 0xFB85, 0xFB85, 0xFEF9, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFB4A, 0xF962, 0xF921, 0xF901, 0xF8E1, 0xF8C1, 0xF880, 0xF860,
-  0xF840, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x9000,
-  0x0000, 0x0000, 0xC618, 0xE71C, 0xE71C, 0xDEFB, 0xA514, 0x8410,
-  0x7BEF, 0x4228, 0x3186, 0x73AE, 0xB5B6, 0xCE79, 0xCE79, 0xCE79,
-  0xCE59, 0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x7BEF,
-  0x3186, 0x3186, 0x8410, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4208, 0x0841,
-  0x0861, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x4A49, 0x3186, 0x31A6,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x7BCF, 0x6B6D, 0x4208, 0x31A6, 0x3186, 0x31A6, 0x31A6,
-  0x3186, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x1082, 0x0000, 0x0800,
-  0xF000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF840, 0xF880, 0xF8A1, 0xF8C1, 0xF901, 0xF921, 0xF942, 0xF982,
-  0xF9A2, 0xF9C2, 0xF9E2, 0xFA23, 0xFA43, 0xFA63, 0xFA83, 0xFAA4,
-  0xFAC4, 0xFAE4, 0xFB04, 0xFB24, 0xFB44, 0xFB64, 0xFB65, 0xFB85,
-  0xFB85, 0xFBA5, 0xFBA5, 0xFBA5, 0xFBA5, 0xFBA5, 0xFE96, 0xFFBD,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF5D, 0xFA04, 0xF942, 0xF921, 0xF901, 0xF8C1, 0xF8A1, 0xF880,
-  0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF000,
-  0x0800, 0x0000, 0x6B4D, 0xE71C, 0xDEFB, 0xDEFB, 0xBDF7, 0x8410,
-  0x7BEF, 0x5AEB, 0x3186, 0x4A49, 0xB5B6, 0xCE59, 0xCE79, 0xCE79,
-  0xCE59, 0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x39C7, 0x3186, 0x738E, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x0841,
-  0x0861, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x4228, 0x3186, 0x31A6,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x7BCF, 0x5AEB, 0x39E7, 0x3186, 0x3186, 0x39C7, 0x31A6,
-  0x3186, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x0020, 0x0000, 0x6000,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF840,
-  0xF860, 0xF880, 0xF8C1, 0xF8E1, 0xF901, 0xF941, 0xF962, 0xF9A2,
-  0xF9C2, 0xF9E2, 0xFA23, 0xFA43, 0xFA63, 0xFA83, 0xFAA4, 0xFAE4,
-  0xFB04, 0xFB24, 0xFB44, 0xFB64, 0xFB65, 0xFB85, 0xFBA5, 0xFBC5,
-  0xFBC5, 0xFBC5, 0xFBE5, 0xFBE5, 0xFBE5, 0xFBE5, 0xFBE5, 0xFBE5,
-  0xFCAB, 0xFE35, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFDB5, 0xF962, 0xF941, 0xF901, 0xF8E1, 0xF8C1, 0xF880,
-  0xF860, 0xF840, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0x6000, 0x0000, 0x10A2, 0xDEFB, 0xDEFB, 0xDEDB, 0xD6BA, 0x8430,
-  0x7BEF, 0x738E, 0x3186, 0x3186, 0xA534, 0xBDF7, 0xCE79, 0xCE79,
-  0xCE59, 0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x4A49, 0x3186, 0x632C, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x1082,
-  0x1082, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x39E7, 0x3186, 0x39C7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x7BCF, 0x4A69, 0x39C7, 0x3186, 0x31A6, 0x39C7, 0x31A6,
-  0x31A6, 0x39C7, 0x31A6, 0x3186, 0x2124, 0x0000, 0x0000, 0xB800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840,
-  0xF880, 0xF8A1, 0xF8E1, 0xF901, 0xF921, 0xF962, 0xF982, 0xF9A2,
-  0xF9E2, 0xFA03, 0xFA23, 0xFA63, 0xFA83, 0xFAA4, 0xFAE4, 0xFB04,
-  0xFB24, 0xFB44, 0xFB65, 0xFB85, 0xFBA5, 0xFBC5, 0xFBC5, 0xFBE5,
-  0xFC05, 0xFC05, 0xFC06, 0xFC26, 0xFC26, 0xFC26, 0xFC06, 0xFC05,
-  0xFC05, 0xFBE5, 0xFC27, 0xFE55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFB09, 0xF962, 0xF921, 0xF901, 0xF8E1, 0xF8A1,
-  0xF880, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xB800, 0x0000, 0x0000, 0xA534, 0xDEDB, 0xDEDB, 0xD6BA, 0x9CD3,
-  0x7BEF, 0x7BCF, 0x4208, 0x3186, 0x8410, 0xB5B6, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x52AA, 0x3186, 0x52AA, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x18C3,
-  0x1082, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x39C7, 0x3186, 0x39C7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x4228, 0x39C7, 0x3186, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x39C7, 0x31A6, 0x31A6, 0x10A2, 0x0000, 0x1000, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860,
-  0xF880, 0xF8C1, 0xF8E1, 0xF921, 0xF941, 0xF962, 0xF9A2, 0xF9C2,
-  0xFA02, 0xFA23, 0xFA43, 0xFA83, 0xFAA3, 0xFAC4, 0xFB04, 0xFB24,
-  0xFB44, 0xFB65, 0xFB85, 0xFBA5, 0xFBC5, 0xFBE5, 0xFC05, 0xFC26,
-  0xFC26, 0xFC46, 0xFC46, 0xFC46, 0xFC46, 0xFC46, 0xFC46, 0xFC46,
-  0xFC26, 0xFC26, 0xFC05, 0xFBE5, 0xFCEC, 0xFFBD, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFE78, 0xF962, 0xF941, 0xF921, 0xF8E1, 0xF8C1,
-  0xF880, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0x1000, 0x0000, 0x632C, 0xDEDB, 0xD6BA, 0xD6BA, 0xB596,
-  0x7BEF, 0x7BCF, 0x528A, 0x3186, 0x630C, 0xAD75, 0xCE79, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x630C, 0x3186, 0x4A49, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x2104,
-  0x10A2, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x31A6, 0x3186, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7, 0x4228, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x73AE, 0x6B6D, 0x4228, 0x31A6, 0x3186, 0x39C7, 0x39C7, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x0841, 0x0000, 0x5800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860,
-  0xF8A1, 0xF8C1, 0xF901, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xF9E2,
-  0xFA03, 0xFA43, 0xFA63, 0xFAA3, 0xFAC4, 0xFAE4, 0xFB24, 0xFB44,
-  0xFB65, 0xFB85, 0xFBC5, 0xFBE5, 0xFC05, 0xFC26, 0xFC26, 0xFC46,
-  0xFC66, 0xFC66, 0xFC86, 0xFC86, 0xFC86, 0xFC86, 0xFC86, 0xFC66,
-  0xFC66, 0xFC46, 0xFC26, 0xFC26, 0xFC05, 0xFC69, 0xFF9D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFB09, 0xF962, 0xF921, 0xF901, 0xF8C1,
-  0xF8A1, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0x5800, 0x0000, 0x2945, 0xD6BA, 0xD6BA, 0xD69A, 0xC618,
-  0x7BEF, 0x7BCF, 0x630C, 0x3186, 0x4228, 0xAD75, 0xC638, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x6B6D, 0x3186, 0x39E7, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x2945,
-  0x10A2, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x3186, 0x3186, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7, 0x4228, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x630C, 0x4228, 0x3186, 0x3186, 0x39E7, 0x39C7, 0x31A6,
-  0x39E7, 0x39E7, 0x39C7, 0x3186, 0x0000, 0x0000, 0xA000, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF860, 0xF880,
-  0xF8A1, 0xF8E1, 0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9C2, 0xFA02,
-  0xFA23, 0xFA63, 0xFA83, 0xFAC4, 0xFAE4, 0xFB04, 0xFB44, 0xFB65,
-  0xFB85, 0xFBC5, 0xFBE5, 0xFC05, 0xFC26, 0xFC46, 0xFC66, 0xFC86,
-  0xFC86, 0xFCA6, 0xFCA6, 0xFCC6, 0xFCC6, 0xFCC6, 0xFCA6, 0xFCA6,
-  0xFC86, 0xFC86, 0xFC66, 0xFC46, 0xFC26, 0xFC05, 0xFC89, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFDF6, 0xF962, 0xF941, 0xF901, 0xF8E1,
-  0xF8A1, 0xF880, 0xF860, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xA000, 0x0000, 0x0000, 0xC638, 0xD69A, 0xD69A, 0xCE79,
-  0x8410, 0x7BCF, 0x738E, 0x3186, 0x3186, 0xA534, 0xBDF7, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x73AE, 0x3186, 0x3186, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x3186,
-  0x18C3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x3186, 0x3186, 0x4208,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7, 0x4228, 0x528A,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x5ACB, 0x4208, 0x3186, 0x31A6, 0x39E7, 0x39C7, 0x39C7,
-  0x4208, 0x39E7, 0x39C7, 0x2124, 0x0000, 0x0000, 0xD800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF880,
-  0xF8C1, 0xF8E1, 0xF921, 0xF942, 0xF982, 0xF9A2, 0xF9E2, 0xFA03,
-  0xFA43, 0xFA63, 0xFAA3, 0xFAC4, 0xFB04, 0xFB24, 0xFB64, 0xFB85,
-  0xFBA5, 0xFBE5, 0xFC05, 0xFC26, 0xFC46, 0xFC66, 0xFC86, 0xFCA6,
-  0xFCC7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7,
-  0xFCC7, 0xFCA6, 0xFC86, 0xFC66, 0xFC46, 0xFC26, 0xFC05, 0xFD0C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA04, 0xF942, 0xF921, 0xF8E1,
-  0xF8C1, 0xF880, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xD800, 0x0000, 0x0000, 0x94B2, 0xD69A, 0xCE79, 0xCE79,
-  0x9492, 0x7BCF, 0x738E, 0x39C7, 0x3186, 0x8C71, 0xB5B6, 0xCE59,
-  0xCE59, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x7BEF, 0x31A6, 0x3186, 0x7BCF, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x31A6,
-  0x18C3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x4A49, 0x3186, 0x31A6, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x31A6, 0x4228, 0x528A,
-  0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x528A, 0x39E7, 0x3186, 0x31A6, 0x39E7, 0x39C7, 0x39E7,
-  0x4208, 0x39E7, 0x39C7, 0x18E3, 0x0000, 0x1000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF8A1,
-  0xF8C1, 0xF901, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xFA02, 0xFA23,
-  0xFA63, 0xFA83, 0xFAC4, 0xFAE4, 0xFB24, 0xFB44, 0xFB65, 0xFBA5,
-  0xFBC5, 0xFC05, 0xFC26, 0xFC46, 0xFC66, 0xFCA6, 0xFCC6, 0xFCE7,
-  0xFCE7, 0xFD07, 0xFD27, 0xFD27, 0xFD27, 0xFD27, 0xFD27, 0xFD07,
-  0xFCE7, 0xFCE7, 0xFCC6, 0xFCA6, 0xFC66, 0xFC46, 0xFC26, 0xFC05,
-  0xFE75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC0D, 0xF962, 0xF921, 0xF901,
-  0xF8C1, 0xF8A1, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x1000, 0x0000, 0x6B4D, 0xCE79, 0xCE79, 0xCE59,
-  0x9CF3, 0x7BCF, 0x738E, 0x4228, 0x3186, 0x7BCF, 0xAD75, 0xCE59,
-  0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8410,
-  0x7BEF, 0x39C7, 0x3186, 0x738E, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x39C7,
-  0x18C3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x4228, 0x3186, 0x31A6, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x18E3, 0x2124, 0x31A6, 0x4208, 0x528A,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x73AE, 0x4A69, 0x39E7, 0x3186, 0x39C7, 0x39E7, 0x39C7, 0x39E7,
-  0x4208, 0x39E7, 0x39E7, 0x10A2, 0x0000, 0x4000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF880, 0xF8A1,
-  0xF8E1, 0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9E2, 0xFA03, 0xFA43,
-  0xFA63, 0xFAA3, 0xFAC4, 0xFB04, 0xFB24, 0xFB64, 0xFB85, 0xFBC5,
-  0xFBE5, 0xFC26, 0xFC46, 0xFC66, 0xFCA6, 0xFCC7, 0xFCE7, 0xFD07,
-  0xFD27, 0xFD47, 0xFD47, 0xFD67, 0xFD67, 0xFD67, 0xFD47, 0xFD47,
-  0xFD27, 0xFD07, 0xFCE7, 0xFCC7, 0xFCA6, 0xFC66, 0xFC46, 0xFC26,
-  0xFC68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD5, 0xF962, 0xF941, 0xF901,
-  0xF8E1, 0xF8A1, 0xF880, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x4000, 0x0000, 0x4228, 0xCE59, 0xCE59, 0xCE59,
-  0xA534, 0x7BCF, 0x738E, 0x4A69, 0x3186, 0x6B4D, 0xA534, 0xCE59,
-  0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6,
-  0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8410,
-  0x7BEF, 0x4208, 0x3186, 0x6B6D, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x39E7,
-  0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x4228, 0x3186, 0x31A6, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x18E3, 0x2124, 0x3186, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x738E, 0x4A69, 0x39C7, 0x3186, 0x39E7, 0x39E7, 0x39C7, 0x4208,
-  0x4228, 0x4208, 0x39E7, 0x0861, 0x0000, 0x6800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF860, 0xF880, 0xF8C1,
-  0xF8E1, 0xF921, 0xF941, 0xF982, 0xF9A2, 0xF9E2, 0xFA23, 0xFA43,
-  0xFA83, 0xFAA3, 0xFAE4, 0xFB04, 0xFB44, 0xFB65, 0xFBA5, 0xFBC5,
-  0xFC05, 0xFC26, 0xFC66, 0xFC86, 0xFCC6, 0xFCE7, 0xFD07, 0xFD27,
-  0xFD47, 0xFD67, 0xFD88, 0xFD88, 0xFD88, 0xFD88, 0xFD88, 0xFD67,
-  0xFD47, 0xFD27, 0xFD07, 0xFCE7, 0xFCC6, 0xFC86, 0xFC66, 0xFC26,
-  0xFC05, 0xFE76, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFA, 0xF982, 0xF941, 0xF921,
-  0xF8E1, 0xF8C1, 0xF880, 0xF860, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x6800, 0x0000, 0x2945, 0xCE59, 0xC638, 0xC638,
-  0xAD75, 0x73AE, 0x738E, 0x528A, 0x3186, 0x5ACB, 0xA514, 0xC638,
-  0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB596,
-  0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CD3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410,
-  0x7BEF, 0x4228, 0x3186, 0x632C, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4228,
-  0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4208, 0x3186, 0x39C7, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x3186, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x6B6D, 0x4A69, 0x39C7, 0x3186, 0x39E7, 0x4208, 0x39C7, 0x4228,
-  0x4228, 0x4208, 0x39E7, 0x0020, 0x0000, 0x8800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF860, 0xF880, 0xF8C1,
-  0xF8E1, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xF9E2, 0xFA23, 0xFA43,
-  0xFA83, 0xFAC4, 0xFAE4, 0xFB24, 0xFB44, 0xFB85, 0xFBC5, 0xFBE5,
-  0xFC26, 0xFC46, 0xFC86, 0xFCA6, 0xFCE7, 0xFD07, 0xFD27, 0xFD67,
-  0xFD88, 0xFDA8, 0xFDA8, 0xFDC8, 0xFDC8, 0xFDC8, 0xFDA8, 0xFDA8,
-  0xFD88, 0xFD67, 0xFD27, 0xFD07, 0xFCE7, 0xFCA6, 0xFC86, 0xFC46,
-  0xFC26, 0xFCEC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE,
-  0xFEB8, 0xFD72, 0xFC0C, 0xFAA6, 0xF9C2, 0xF982, 0xF962, 0xF921,
-  0xF8E1, 0xF8C1, 0xF880, 0xF860, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x8800, 0x0000, 0x1082, 0xC638, 0xC638, 0xC618,
-  0xB5B6, 0x73AE, 0x738E, 0x5ACB, 0x3186, 0x4A69, 0xA514, 0xC618,
-  0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596,
-  0xB596, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CD3,
-  0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x8410,
-  0x7BEF, 0x4A49, 0x3186, 0x630C, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49,
-  0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4208, 0x3186, 0x39C7, 0x4208,
-  0x4208, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x3186, 0x39E7, 0x4A49,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x738E,
-  0x6B6D, 0x4A69, 0x31A6, 0x3186, 0x4208, 0x4208, 0x39E7, 0x4228,
-  0x4228, 0x4208, 0x39E7, 0x0000, 0x0000, 0xA800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF8A0, 0xF8C1,
-  0xF901, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xFA02, 0xFA23, 0xFA63,
-  0xFA83, 0xFAC4, 0xFB04, 0xFB24, 0xFB65, 0xFB85, 0xFBC5, 0xFC05,
-  0xFC26, 0xFC66, 0xFC86, 0xFCC7, 0xFCE7, 0xFD27, 0xFD47, 0xFD88,
-  0xFDA8, 0xFDC8, 0xFDE8, 0xFE08, 0xFE08, 0xFE08, 0xFDE8, 0xFDC8,
-  0xFDA8, 0xFD88, 0xFD47, 0xFD27, 0xFCE7, 0xFCC7, 0xFC86, 0xFC66,
-  0xFC26, 0xFC06, 0xFFBE, 0xFF1A, 0xFE14, 0xFD0F, 0xFBC9, 0xFAE4,
-  0xFA83, 0xFA63, 0xFA23, 0xFA02, 0xF9C2, 0xF982, 0xF962, 0xF921,
-  0xF901, 0xF8C1, 0xF8A0, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xA800, 0x0000, 0x0000, 0xC618, 0xC618, 0xC618,
-  0xB5B6, 0x73AE, 0x738E, 0x5AEB, 0x3186, 0x4228, 0x9CF3, 0xBDF7,
-  0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596,
-  0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3,
-  0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x7BEF,
-  0x7BEF, 0x528A, 0x3186, 0x5ACB, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49,
-  0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4208, 0x3186, 0x39C7, 0x4208,
-  0x4208, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2965, 0x39C7, 0x4A49,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x4A69, 0x31A6, 0x3186, 0x4208, 0x4208, 0x39E7, 0x4A49,
-  0x4228, 0x4228, 0x39C7, 0x0000, 0x0000, 0xB800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF8A1, 0xF8C1,
-  0xF901, 0xF921, 0xF962, 0xF9A2, 0xF9C2, 0xFA03, 0xFA23, 0xFA63,
-  0xFAA3, 0xFAC4, 0xFB04, 0xFB44, 0xFB65, 0xFBA5, 0xFBC5, 0xFC05,
-  0xFC46, 0xFC66, 0xFCA6, 0xFCE7, 0xFD07, 0xFD47, 0xFD67, 0xFDA8,
-  0xFDC8, 0xFDE8, 0xFE08, 0xFE29, 0xFE49, 0xFE29, 0xFE08, 0xFDE8,
-  0xFDC8, 0xFDA8, 0xFD67, 0xFD47, 0xFD07, 0xFCE7, 0xFCA6, 0xFC66,
-  0xFC46, 0xFC05, 0xFBE5, 0xFBA5, 0xFB65, 0xFB44, 0xFB04, 0xFAC4,
-  0xFAA3, 0xFA63, 0xFA23, 0xFA03, 0xF9C2, 0xF9A2, 0xF962, 0xF921,
-  0xF901, 0xF8C1, 0xF8A1, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xB800, 0x0000, 0x0000, 0xAD75, 0xBDF7, 0xBDF7,
-  0xBDD7, 0x73AE, 0x6B6D, 0x5AEB, 0x3186, 0x39E7, 0x9CF3, 0xBDD7,
-  0xC638, 0xC618, 0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596,
-  0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3,
-  0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x7BEF,
-  0x7BCF, 0x528A, 0x3186, 0x5ACB, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49,
-  0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4208, 0x3186, 0x39C7, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x2965, 0x39C7, 0x4208,
-  0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x5AEB, 0x4A49, 0x31A6, 0x3186, 0x4208, 0x4208, 0x39E7, 0x4A69,
-  0x4A49, 0x4228, 0x39C7, 0x0000, 0x0000, 0xC800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF8A1, 0xF8E1,
-  0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9C2, 0xFA03, 0xFA43, 0xFA63,
-  0xFAA3, 0xFAE4, 0xFB04, 0xFB44, 0xFB65, 0xFBA5, 0xFBE5, 0xFC06,
-  0xFC46, 0xFC86, 0xFCA6, 0xFCE7, 0xFD27, 0xFD47, 0xFD88, 0xFDA8,
-  0xFDE8, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE08,
-  0xFDE8, 0xFDA8, 0xFD88, 0xFD47, 0xFD27, 0xFCE7, 0xFCA6, 0xFC86,
-  0xFC46, 0xFC06, 0xFBE5, 0xFBA5, 0xFB65, 0xFB44, 0xFB04, 0xFAE4,
-  0xFAA3, 0xFA63, 0xFA43, 0xFA03, 0xF9C2, 0xF9A2, 0xF962, 0xF941,
-  0xF901, 0xF8E1, 0xF8A1, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xC800, 0x0000, 0x0000, 0xA534, 0xBDF7, 0xBDD7,
-  0xBDD7, 0x738E, 0x6B6D, 0x630C, 0x3186, 0x31A6, 0x8430, 0x9CF3,
-  0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3,
-  0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430,
-  0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x738E, 0x738E,
-  0x6B6D, 0x4A69, 0x3186, 0x52AA, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x39E7, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x4228, 0x4208, 0x39E7, 0x4A69,
-  0x4A49, 0x4228, 0x39C7, 0x0000, 0x0000, 0xC800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF8A1, 0xF8E1,
-  0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9E2, 0xFA03, 0xFA43, 0xFA63,
-  0xFAA3, 0xFAE4, 0xFB04, 0xFB44, 0xFB85, 0xFBA5, 0xFBE5, 0xFC26,
-  0xFC46, 0xFC86, 0xFCC6, 0xFCE7, 0xFD27, 0xFD67, 0xFD88, 0xFDC8,
-  0xFE08, 0xFE29, 0xFE69, 0xFE89, 0xFEA9, 0xFE89, 0xFE69, 0xFE29,
-  0xFE08, 0xFDC8, 0xFD88, 0xFD67, 0xFD27, 0xFCE7, 0xFCC6, 0xFC86,
-  0xFC46, 0xFC26, 0xFBE5, 0xFBA5, 0xFB85, 0xFB44, 0xFB04, 0xFAE4,
-  0xFAA3, 0xFA63, 0xFA43, 0xFA03, 0xF9E2, 0xF9A2, 0xF962, 0xF941,
-  0xF901, 0xF8E1, 0xF8A1, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xC800, 0x0000, 0x0000, 0x9CF3, 0xBDD7, 0xB5B6,
-  0xB5B6, 0x73AE, 0x6B6D, 0x630C, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x52AA, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x39E7, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x4228, 0x4208, 0x39E7, 0x4A69,
-  0x4A69, 0x4A49, 0x39C7, 0x0000, 0x0000, 0xC800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF880, 0xF8A1, 0xF8E1,
-  0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9E2, 0xFA03, 0xFA43, 0xFA63,
-  0xFAA3, 0xFAE4, 0xFB04, 0xFB44, 0xFB85, 0xFBA5, 0xFBE5, 0xFC26,
-  0xFC46, 0xFC86, 0xFCC6, 0xFCE7, 0xFD27, 0xFD67, 0xFD88, 0xFDC8,
-  0xFE08, 0xFE49, 0xFE69, 0xFEA9, 0xFEEA, 0xFEA9, 0xFE69, 0xFE49,
-  0xFE08, 0xFDC8, 0xFD88, 0xFD67, 0xFD27, 0xFCE7, 0xFCC6, 0xFC86,
-  0xFC46, 0xFC26, 0xFBE5, 0xFBA5, 0xFB85, 0xFB44, 0xFB04, 0xFAE4,
-  0xFAA3, 0xFA63, 0xFA43, 0xFA03, 0xF9E2, 0xF9A2, 0xF962, 0xF941,
-  0xF901, 0xF8E1, 0xF8A1, 0xF880, 0xF840, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xC800, 0x0000, 0x0000, 0x9CF3, 0xB5B6, 0xB5B6,
-  0xB596, 0x738E, 0x6B4D, 0x5AEB, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x52AA, 0x8410, 0x7BEF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x39E7, 0x3186, 0x39C7, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x2124, 0x3186, 0x39E7,
-  0x4228, 0x4A69, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C,
-  0x5AEB, 0x4A69, 0x31A6, 0x3186, 0x4228, 0x4228, 0x4208, 0x528A,
-  0x4A69, 0x4A49, 0x39E7, 0x0000, 0x0000, 0xC800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF8A1, 0xF8E1,
-  0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9E2, 0xFA03, 0xFA43, 0xFA63,
-  0xFAA3, 0xFAE4, 0xFB04, 0xFB44, 0xFB85, 0xFBA5, 0xFBE5, 0xFC26,
-  0xFC46, 0xFC86, 0xFCC6, 0xFCE7, 0xFD27, 0xFD67, 0xFD88, 0xFDC8,
-  0xFE08, 0xFE29, 0xFE69, 0xFE89, 0xFEA9, 0xFE89, 0xFE69, 0xFE29,
-  0xFE08, 0xFDC8, 0xFD88, 0xFD67, 0xFD27, 0xFCE7, 0xFCC6, 0xFC86,
-  0xFC46, 0xFC26, 0xFBE5, 0xFBA5, 0xFB85, 0xFB44, 0xFB04, 0xFAE4,
-  0xFAA3, 0xFA63, 0xFA43, 0xFA03, 0xF9E2, 0xF9A2, 0xF962, 0xF941,
-  0xF901, 0xF8E1, 0xF8A1, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xC800, 0x0000, 0x0000, 0x9CF3, 0xB596, 0xB596,
-  0xB596, 0x6B6D, 0x6B4D, 0x5AEB, 0x3186, 0x31A6, 0x8410, 0x9CD3,
-  0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2,
-  0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8410,
-  0x8410, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D,
-  0x6B4D, 0x4A49, 0x3186, 0x52AA, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4208, 0x3186, 0x39E7, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x2965, 0x39E7,
-  0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x52AA, 0x31A6, 0x3186, 0x4228, 0x4228, 0x4208, 0x528A,
-  0x4A69, 0x4A49, 0x4208, 0x0000, 0x0000, 0xB800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF8A1, 0xF8E1,
-  0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9C2, 0xFA03, 0xFA43, 0xFA63,
-  0xFAA3, 0xFAE4, 0xFB04, 0xFB44, 0xFB65, 0xFBA5, 0xFBE5, 0xFC06,
-  0xFC46, 0xFC86, 0xFCA6, 0xFCE7, 0xFD27, 0xFD47, 0xFD88, 0xFDA8,
-  0xFDE8, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE08,
-  0xFDE8, 0xFDA8, 0xFD88, 0xFD47, 0xFD27, 0xFCE7, 0xFCA6, 0xFC86,
-  0xFC46, 0xFC06, 0xFBE5, 0xFBA5, 0xFB65, 0xFB44, 0xFB04, 0xFAE4,
-  0xFAA3, 0xFA63, 0xFA43, 0xFA03, 0xF9C2, 0xF9A2, 0xF962, 0xF941,
-  0xF901, 0xF8E1, 0xF8A1, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xB800, 0x0000, 0x0000, 0xA514, 0xB596, 0xAD75,
-  0xAD55, 0x6B6D, 0x6B4D, 0x5ACB, 0x3186, 0x39C7, 0x9492, 0xB596,
-  0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75,
-  0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2,
-  0x9492, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8410, 0x7BEF, 0x7BCF,
-  0x73AE, 0x4A69, 0x3186, 0x5ACB, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4208, 0x3186, 0x39E7, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x39C7,
-  0x4228, 0x528A, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x6B4D, 0x52AA, 0x31A6, 0x3186, 0x4228, 0x4228, 0x4208, 0x528A,
-  0x528A, 0x4A69, 0x4A49, 0x0000, 0x0000, 0xA800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF8A1, 0xF8C1,
-  0xF901, 0xF921, 0xF962, 0xF9A2, 0xF9C2, 0xFA03, 0xFA23, 0xFA63,
-  0xFAA3, 0xFAC4, 0xFB04, 0xFB44, 0xFB65, 0xFBA5, 0xFBC5, 0xFC05,
-  0xFC46, 0xFC66, 0xFCA6, 0xFCE7, 0xFD07, 0xFD47, 0xFD67, 0xFDA8,
-  0xFDC8, 0xFDE8, 0xFE08, 0xFE29, 0xFE49, 0xFE29, 0xFE08, 0xFDE8,
-  0xFDC8, 0xFDA8, 0xFD67, 0xFD47, 0xFD07, 0xFCE7, 0xFCA6, 0xFC66,
-  0xFC46, 0xFC05, 0xFBC5, 0xFBA5, 0xFB65, 0xFB44, 0xFB04, 0xFAC4,
-  0xFAA3, 0xFA63, 0xFA23, 0xFA03, 0xF9C2, 0xF9A2, 0xF962, 0xF921,
-  0xF901, 0xF8C1, 0xF8A1, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xA800, 0x0000, 0x0000, 0xAD75, 0xAD75, 0xAD55,
-  0xA534, 0x6B4D, 0x632C, 0x52AA, 0x3186, 0x4208, 0x8C71, 0xB5B6,
-  0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75,
-  0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2,
-  0x9492, 0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BCF,
-  0x73AE, 0x4A69, 0x3186, 0x5ACB, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4228,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4208, 0x3186, 0x39C7, 0x4228,
-  0x4228, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x31A6,
-  0x4208, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D,
-  0x6B4D, 0x5ACB, 0x39C7, 0x3186, 0x4208, 0x4A49, 0x4208, 0x528A,
-  0x528A, 0x4A69, 0x4A49, 0x0020, 0x0000, 0x8800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF8A0, 0xF8C1,
-  0xF901, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xFA02, 0xFA23, 0xFA63,
-  0xFA83, 0xFAC4, 0xFB04, 0xFB24, 0xFB65, 0xFB85, 0xFBC5, 0xFC05,
-  0xFC26, 0xFC66, 0xFC86, 0xFCC7, 0xFCE7, 0xFD27, 0xFD47, 0xFD88,
-  0xFDA8, 0xFDC8, 0xFDE8, 0xFE08, 0xFE08, 0xFE08, 0xFDE8, 0xFDC8,
-  0xFDA8, 0xFD88, 0xFD47, 0xFD27, 0xFCE7, 0xFCC7, 0xFC86, 0xFC66,
-  0xFC26, 0xFC05, 0xFBC5, 0xFB85, 0xFB65, 0xFB24, 0xFB04, 0xFAC4,
-  0xFA83, 0xFA63, 0xFA23, 0xFA02, 0xF9C2, 0xF982, 0xF962, 0xF921,
-  0xF901, 0xF8C1, 0xF8A0, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x8800, 0x0000, 0x0861, 0xAD55, 0xAD55, 0xAD55,
-  0x9CF3, 0x6B4D, 0x632C, 0x528A, 0x3186, 0x4A49, 0x8C71, 0xB5B6,
-  0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55,
-  0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x9492,
-  0x9492, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF,
-  0x73AE, 0x4A49, 0x3186, 0x5AEB, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4228,
-  0x18E3, 0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4208, 0x3186, 0x39C7, 0x4228,
-  0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x2124, 0x3186,
-  0x39E7, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B4D,
-  0x6B4D, 0x5ACB, 0x39E7, 0x3186, 0x4208, 0x4A49, 0x4228, 0x4A69,
-  0x528A, 0x528A, 0x4A69, 0x0861, 0x0000, 0x6800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF860, 0xF880, 0xF8C1,
-  0xF8E1, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xF9E2, 0xFA23, 0xFA43,
-  0xFA83, 0xFAC4, 0xFAE4, 0xFB24, 0xFB44, 0xFB85, 0xFBC5, 0xFBE5,
-  0xFC26, 0xFC46, 0xFC86, 0xFCA6, 0xFCE7, 0xFD07, 0xFD27, 0xFD67,
-  0xFD88, 0xFDA8, 0xFDA8, 0xFDC8, 0xFDC8, 0xFDC8, 0xFDA8, 0xFDA8,
-  0xFD88, 0xFD67, 0xFD27, 0xFD07, 0xFCE7, 0xFCA6, 0xFC86, 0xFC46,
-  0xFC26, 0xFBE5, 0xFBC5, 0xFB85, 0xFB44, 0xFB24, 0xFAE4, 0xFAC4,
-  0xFA83, 0xFA43, 0xFA23, 0xF9E2, 0xF9C2, 0xF982, 0xF962, 0xF921,
-  0xF8E1, 0xF8C1, 0xF880, 0xF860, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x6800, 0x0000, 0x2104, 0xA534, 0xA534, 0xA534,
-  0x9492, 0x632C, 0x630C, 0x4A49, 0x3186, 0x528A, 0x8C51, 0xBDD7,
-  0xBDF7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55,
-  0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x9492,
-  0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x4228, 0x3186, 0x632C, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4208,
-  0x18E3, 0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4228, 0x3186, 0x31A6, 0x4A49,
-  0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x2965,
-  0x39C7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x5AEB, 0x4208, 0x3186, 0x39E7, 0x4A49, 0x4228, 0x4A69,
-  0x52AA, 0x528A, 0x4A69, 0x18C3, 0x0000, 0x4000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF860, 0xF880, 0xF8C1,
-  0xF8E1, 0xF921, 0xF941, 0xF982, 0xF9A2, 0xF9E2, 0xFA23, 0xFA43,
-  0xFA83, 0xFB46, 0xFC6C, 0xFD30, 0xFB44, 0xFB65, 0xFBA5, 0xFBC5,
-  0xFC05, 0xFC26, 0xFC66, 0xFC86, 0xFCC6, 0xFCE7, 0xFD07, 0xFD27,
-  0xFD47, 0xFD67, 0xFD88, 0xFD88, 0xFD88, 0xFD88, 0xFD88, 0xFD67,
-  0xFD47, 0xFD27, 0xFD07, 0xFCE7, 0xFCC6, 0xFC86, 0xFC66, 0xFC26,
-  0xFC05, 0xFBC5, 0xFBA5, 0xFB65, 0xFB44, 0xFB04, 0xFAE4, 0xFAA3,
-  0xFA83, 0xFA43, 0xFA23, 0xF9E2, 0xF9A2, 0xF982, 0xF941, 0xF921,
-  0xF8E1, 0xF8C1, 0xF880, 0xF860, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x4000, 0x0000, 0x39C7, 0xA534, 0xA514, 0xA514,
-  0x8C51, 0x632C, 0x5AEB, 0x4208, 0x3186, 0x5ACB, 0x8C51, 0xBDF7,
-  0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55,
-  0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492,
-  0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x73AE,
-  0x738E, 0x39E7, 0x3186, 0x6B4D, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x39E7,
-  0x18C3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4228, 0x3186, 0x31A6, 0x4A49,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2945,
-  0x39C7, 0x4228, 0x528A, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x6B4D, 0x5AEB, 0x4A49, 0x3186, 0x39C7, 0x4A69, 0x4228, 0x4A69,
-  0x52AA, 0x528A, 0x528A, 0x2945, 0x0000, 0x1000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF880, 0xF8A1,
-  0xF8E1, 0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9E2, 0xFA85, 0xFE36,
-  0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC4A, 0xFB64, 0xFB85, 0xFBC5,
-  0xFBE5, 0xFC26, 0xFC46, 0xFC66, 0xFCA6, 0xFCC7, 0xFCE7, 0xFD07,
-  0xFD27, 0xFD47, 0xFD47, 0xFD67, 0xFD67, 0xFD67, 0xFD47, 0xFD47,
-  0xFD27, 0xFD07, 0xFCE7, 0xFCC7, 0xFCA6, 0xFC66, 0xFC46, 0xFC26,
-  0xFBE5, 0xFBC5, 0xFB85, 0xFB64, 0xFB24, 0xFB04, 0xFAC4, 0xFAA3,
-  0xFA63, 0xFA43, 0xFA03, 0xF9E2, 0xF9A2, 0xF962, 0xF941, 0xF901,
-  0xF8E1, 0xF8A1, 0xF880, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x1000, 0x0000, 0x52AA, 0xA514, 0xA514, 0x9CF3,
-  0x7BEF, 0x630C, 0x5AEB, 0x39E7, 0x3186, 0x632C, 0x8C71, 0xBDF7,
-  0xBDD7, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534,
-  0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x9492, 0x8C71,
-  0x8C71, 0x8C51, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE,
-  0x738E, 0x39C7, 0x3186, 0x6B6D, 0x7BEF, 0x7BCF, 0x73AE, 0x738E,
-  0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49, 0x31A6,
-  0x18C3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x3186, 0x3186, 0x4A49,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2124,
-  0x3186, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x6B4D, 0x630C, 0x528A, 0x3186, 0x31A6, 0x4A69, 0x4A49, 0x4A49,
-  0x5ACB, 0x52AA, 0x528A, 0x39C7, 0x0000, 0x0000, 0xD800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF8A1,
-  0xF8C1, 0xF901, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xFA02, 0xFEFA,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFED9, 0xFB44, 0xFB65, 0xFBA5,
-  0xFBC5, 0xFC05, 0xFC26, 0xFC46, 0xFC66, 0xFCA6, 0xFCC6, 0xFCE7,
-  0xFCE7, 0xFD07, 0xFD27, 0xFD27, 0xFD27, 0xFD27, 0xFD27, 0xFD07,
-  0xFCE7, 0xFCE7, 0xFCC6, 0xFCA6, 0xFC66, 0xFC46, 0xFC26, 0xFC05,
-  0xFBC5, 0xFBA5, 0xFB65, 0xFB44, 0xFB24, 0xFAE4, 0xFAC4, 0xFA83,
-  0xFA63, 0xFA23, 0xFA02, 0xF9C2, 0xF982, 0xF962, 0xF921, 0xF901,
-  0xF8C1, 0xF8A1, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xD800, 0x0000, 0x0000, 0x738E, 0x9CF3, 0x9CF3, 0x9CD3,
-  0x738E, 0x630C, 0x5ACB, 0x31A6, 0x3186, 0x738E, 0x94B2, 0xBDD7,
-  0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534,
-  0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71,
-  0x8C51, 0x8C51, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x738E, 0x3186, 0x3186, 0x73AE, 0x7BCF, 0x7BCF, 0x73AE, 0x738E,
-  0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x3186,
-  0x18C3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x3186, 0x3186, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x2965, 0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x5ACB, 0x3186, 0x3186, 0x4A69, 0x4A49, 0x4228,
-  0x5ACB, 0x52AA, 0x52AA, 0x4A69, 0x0000, 0x0000, 0xA000, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860, 0xF880,
-  0xF8C1, 0xF8E1, 0xF921, 0xF942, 0xF982, 0xF9A2, 0xF9E2, 0xFC4E,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCCE, 0xFB64, 0xFB85,
-  0xFBA5, 0xFBE5, 0xFC05, 0xFC26, 0xFC46, 0xFC66, 0xFC86, 0xFCA6,
-  0xFCC7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7, 0xFCE7,
-  0xFCC7, 0xFCA6, 0xFC86, 0xFC66, 0xFC46, 0xFC26, 0xFC05, 0xFBE5,
-  0xFBA5, 0xFB85, 0xFB64, 0xFB24, 0xFB04, 0xFAC4, 0xFAA3, 0xFA63,
-  0xFA43, 0xFA03, 0xF9E2, 0xF9A2, 0xF982, 0xF942, 0xF921, 0xF8E1,
-  0xF8C1, 0xF880, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xA000, 0x0000, 0x0000, 0x9492, 0x9CD3, 0x9CD3, 0x94B2,
-  0x632C, 0x5AEB, 0x52AA, 0x3186, 0x3186, 0x7BEF, 0x9CF3, 0xBDD7,
-  0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA534,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71,
-  0x8C51, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x73AE, 0x738E,
-  0x6B4D, 0x3186, 0x3186, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x2965,
-  0x10A2, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x31A6, 0x3186, 0x4228,
-  0x4A49, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3,
-  0x2945, 0x39C7, 0x4228, 0x528A, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x5AEB, 0x39C7, 0x3186, 0x4A49, 0x4A69, 0x4A49,
-  0x52AA, 0x5ACB, 0x52AA, 0x528A, 0x0861, 0x0000, 0x5800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF860, 0xF880,
-  0xF8A1, 0xF8E1, 0xF901, 0xF941, 0xF962, 0xF9A2, 0xF9C2, 0xFA23,
-  0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFBE8, 0xFB65,
-  0xFB85, 0xFBC5, 0xFBE5, 0xFC05, 0xFC26, 0xFC46, 0xFC66, 0xFC86,
-  0xFC86, 0xFCA6, 0xFCA6, 0xFCC6, 0xFCC6, 0xFCC6, 0xFCA6, 0xFCA6,
-  0xFC86, 0xFC86, 0xFC66, 0xFC46, 0xFC26, 0xFC05, 0xFBE5, 0xFBC5,
-  0xFB85, 0xFB65, 0xFB44, 0xFB04, 0xFAE4, 0xFAC4, 0xFA83, 0xFA63,
-  0xFA23, 0xFA02, 0xF9C2, 0xF9A2, 0xF962, 0xF941, 0xF901, 0xF8E1,
-  0xF8A1, 0xF880, 0xF860, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0x5800, 0x0000, 0x18E3, 0x94B2, 0x94B2, 0x94B2, 0x8C51,
-  0x5AEB, 0x5ACB, 0x4A49, 0x3186, 0x39E7, 0x7BEF, 0xAD55, 0xB5B6,
-  0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514,
-  0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51,
-  0x8C51, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x738E,
-  0x630C, 0x3186, 0x39E7, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x2124,
-  0x10A2, 0x2104, 0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x39C7, 0x3186, 0x4208,
-  0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3,
-  0x2124, 0x3186, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x6B4D, 0x5AEB, 0x4208, 0x3186, 0x4208, 0x4A69, 0x4A49,
-  0x528A, 0x5ACB, 0x52AA, 0x52AA, 0x2124, 0x0000, 0x1000, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860,
-  0xF8A1, 0xF8C1, 0xF901, 0xF921, 0xF962, 0xF982, 0xF9C2, 0xF9E2,
-  0xFBEC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1A, 0xFB86,
-  0xFB65, 0xFB85, 0xFBC5, 0xFBE5, 0xFC05, 0xFC26, 0xFC26, 0xFC46,
-  0xFC66, 0xFC66, 0xFC86, 0xFC86, 0xFC86, 0xFC86, 0xFC86, 0xFC66,
-  0xFC66, 0xFC46, 0xFC26, 0xFC26, 0xFC05, 0xFBE5, 0xFBC5, 0xFB85,
-  0xFB65, 0xFB44, 0xFB24, 0xFAE4, 0xFAC4, 0xFAA3, 0xFA63, 0xFA43,
-  0xFA03, 0xF9E2, 0xF9C2, 0xF982, 0xF962, 0xF921, 0xF901, 0xF8C1,
-  0xF8A1, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0x1000, 0x0000, 0x4228, 0x94B2, 0x9492, 0x9492, 0x7BEF,
-  0x5AEB, 0x52AA, 0x39E7, 0x3186, 0x4A69, 0x7BEF, 0xB5B6, 0xB5B6,
-  0xB596, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514,
-  0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51,
-  0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x73AE, 0x738E, 0x738E,
-  0x52AA, 0x3186, 0x4228, 0x7BCF, 0x7BCF, 0x73AE, 0x738E, 0x738E,
-  0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB,
-  0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49, 0x4A49, 0x18E3,
-  0x1082, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x39E7, 0x3186, 0x39E7,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x2965, 0x39C7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x630C, 0x4A69, 0x3186, 0x39C7, 0x528A, 0x4A49,
-  0x4A69, 0x5AEB, 0x5ACB, 0x52AA, 0x39E7, 0x0000, 0x0000, 0xB800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF840, 0xF860,
-  0xF880, 0xF8C1, 0xF8E1, 0xF921, 0xF941, 0xF962, 0xF9A2, 0xF9C2,
-  0xFA02, 0xFE57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFED9,
-  0xFB86, 0xFB65, 0xFB85, 0xFBA5, 0xFBC5, 0xFBE5, 0xFC05, 0xFC26,
-  0xFC26, 0xFC46, 0xFC46, 0xFC46, 0xFC46, 0xFC46, 0xFC46, 0xFC46,
-  0xFC26, 0xFC26, 0xFC05, 0xFBE5, 0xFBC5, 0xFBA5, 0xFB85, 0xFB65,
-  0xFB44, 0xFB24, 0xFB04, 0xFAC4, 0xFAA3, 0xFA83, 0xFA43, 0xFA23,
-  0xFA02, 0xF9C2, 0xF9A2, 0xF962, 0xF941, 0xF921, 0xF8E1, 0xF8C1,
-  0xF880, 0xF860, 0xF840, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xB800, 0x0000, 0x0000, 0x6B6D, 0x9492, 0x8C71, 0x8C71, 0x6B4D,
-  0x5ACB, 0x528A, 0x31A6, 0x3186, 0x5AEB, 0x8410, 0xB5B6, 0xB5B6,
-  0xB596, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0xA514,
-  0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8C51,
-  0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x738E, 0x6B6D,
-  0x4A69, 0x3186, 0x528A, 0x7BCF, 0x7BCF, 0x73AE, 0x738E, 0x738E,
-  0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x10A2,
-  0x0861, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4208, 0x3186, 0x39C7,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x2965, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x18E3, 0x2945, 0x31A6, 0x4208, 0x528A, 0x52AA, 0x5ACB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x5ACB, 0x3186, 0x3186, 0x528A, 0x4A69,
-  0x4A49, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x0841, 0x0000, 0x6000,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840,
-  0xF880, 0xF8A1, 0xF8E1, 0xF901, 0xF921, 0xF962, 0xF982, 0xF9A2,
-  0xF9E2, 0xFA85, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF1A, 0xFBC8, 0xFB65, 0xFB85, 0xFBA5, 0xFBC5, 0xFBC5, 0xFBE5,
-  0xFC05, 0xFC05, 0xFC06, 0xFC26, 0xFC26, 0xFC26, 0xFC06, 0xFC05,
-  0xFC05, 0xFBE5, 0xFBC5, 0xFBC5, 0xFBA5, 0xFB85, 0xFB65, 0xFB44,
-  0xFB24, 0xFB04, 0xFAE4, 0xFAA4, 0xFA83, 0xFA63, 0xFA23, 0xFA03,
-  0xF9E2, 0xF9A2, 0xF982, 0xF962, 0xF921, 0xF901, 0xF8E1, 0xF8A1,
-  0xF880, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0x6000, 0x0000, 0x0861, 0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x5AEB,
-  0x52AA, 0x4A49, 0x3186, 0x3186, 0x738E, 0x9492, 0xB5B6, 0xB596,
-  0xB596, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CD3, 0x9CD3, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430,
-  0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D,
-  0x4208, 0x3186, 0x5AEB, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D,
-  0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x0861,
-  0x0861, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4228, 0x3186, 0x31A6,
-  0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104,
-  0x18E3, 0x2124, 0x3186, 0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x630C, 0x39C7, 0x3186, 0x4A49, 0x4A69,
-  0x4A49, 0x52AA, 0x5AEB, 0x5ACB, 0x52AA, 0x2124, 0x0000, 0x0800,
-  0xF000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF840,
-  0xF860, 0xF880, 0xF8C1, 0xF8E1, 0xF901, 0xF941, 0xF962, 0xF9A2,
-  0xF9C2, 0xF9E2, 0xFB69, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFBE, 0xFCEE, 0xFB64, 0xFB65, 0xFB85, 0xFBA5, 0xFBC5,
-  0xFBC5, 0xFBC5, 0xFBE5, 0xFBE5, 0xFBE5, 0xFBE5, 0xFBE5, 0xFBC5,
-  0xFBC5, 0xFBC5, 0xFBA5, 0xFB85, 0xFB65, 0xFB64, 0xFB44, 0xFB24,
-  0xFB04, 0xFAE4, 0xFAA4, 0xFA83, 0xFA63, 0xFA43, 0xFA23, 0xF9E2,
-  0xF9C2, 0xF9A2, 0xF962, 0xF941, 0xF901, 0xF8E1, 0xF8C1, 0xF880,
-  0xF860, 0xF840, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF000,
-  0x0800, 0x0000, 0x4208, 0x8C51, 0x8C51, 0x8C51, 0x7BCF, 0x52AA,
-  0x528A, 0x39E7, 0x3186, 0x39E7, 0x73AE, 0xA514, 0xB596, 0xB596,
-  0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8C51, 0x8430,
-  0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x738E, 0x6B6D, 0x6B6D,
-  0x39C7, 0x3186, 0x6B4D, 0x7BCF, 0x73AE, 0x738E, 0x738E, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x52AA,
-  0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4228, 0x0841,
-  0x0861, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x3186, 0x3186,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104,
-  0x2104, 0x18E3, 0x2965, 0x39C7, 0x4228, 0x528A, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x630C, 0x632C, 0x630C, 0x4A49, 0x3186, 0x39E7, 0x528A,
-  0x4A69, 0x528A, 0x5AEB, 0x5AEB, 0x5ACB, 0x4A49, 0x0000, 0x0000,
-  0x9000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF840, 0xF880, 0xF8A1, 0xF8C1, 0xF901, 0xF921, 0xF942, 0xF982,
-  0xF9A2, 0xF9C2, 0xF9E2, 0xFBEB, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFEB8, 0xFC4A, 0xFB64, 0xFB65, 0xFB85,
-  0xFB85, 0xFBA5, 0xFBA5, 0xFBA5, 0xFBA5, 0xFBA5, 0xFBA5, 0xFBA5,
-  0xFB85, 0xFB85, 0xFB65, 0xFB64, 0xFB44, 0xFB24, 0xFB04, 0xFAE4,
-  0xFAC4, 0xFAA4, 0xFA83, 0xFA63, 0xFA43, 0xFA23, 0xF9E2, 0xF9C2,
-  0xF9A2, 0xF982, 0xF942, 0xF921, 0xF901, 0xF8C1, 0xF8A1, 0xF880,
-  0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x9000,
-  0x0000, 0x0000, 0x738E, 0x8430, 0x8430, 0x8430, 0x632C, 0x528A,
-  0x4A49, 0x31A6, 0x3186, 0x528A, 0x73AE, 0xB596, 0xB596, 0xAD75,
-  0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3,
-  0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8430,
-  0x8410, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x632C,
-  0x3186, 0x3186, 0x73AE, 0x7BCF, 0x73AE, 0x738E, 0x738E, 0x6B6D,
-  0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x52AA,
-  0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49, 0x4A49, 0x39E7, 0x0841,
-  0x0861, 0x18C3, 0x2104, 0x18E3, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x31A6, 0x3186,
-  0x4228, 0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x18E3, 0x2124, 0x3186, 0x4208, 0x4A69, 0x52AA, 0x5ACB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x5ACB, 0x3186, 0x3186, 0x528A,
-  0x4A69, 0x4A49, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x10A2, 0x0000,
-  0x2000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF840, 0xF860, 0xF880, 0xF8C1, 0xF8E1, 0xF901, 0xF921, 0xF962,
-  0xF982, 0xF9A2, 0xF9C2, 0xFA02, 0xFBEB, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEF9, 0xFC8B, 0xFB44,
-  0xFB65, 0xFB65, 0xFB65, 0xFB85, 0xFB85, 0xFB85, 0xFB65, 0xFB65,
-  0xFB65, 0xFB44, 0xFB44, 0xFB24, 0xFB24, 0xFB04, 0xFAE4, 0xFAC4,
-  0xFAA3, 0xFA83, 0xFA63, 0xFA43, 0xFA23, 0xFA02, 0xF9C2, 0xF9A2,
-  0xF982, 0xF962, 0xF921, 0xF901, 0xF8E1, 0xF8C1, 0xF880, 0xF860,
-  0xF840, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x2000,
-  0x0000, 0x2124, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x52AA, 0x4A49,
-  0x39E7, 0x3186, 0x3186, 0x632C, 0x8430, 0xB596, 0xAD75, 0xAD75,
-  0xAD55, 0xAD55, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3,
-  0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8410,
-  0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x5ACB,
-  0x3186, 0x39E7, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x3186, 0x0841,
-  0x0861, 0x10A2, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x39C7, 0x3186,
-  0x39E7, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x2965, 0x39C7, 0x4228, 0x528A, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x630C, 0x39C7, 0x3186, 0x4228,
-  0x528A, 0x4A69, 0x52AA, 0x630C, 0x5AEB, 0x5ACB, 0x39E7, 0x0000,
-  0x0000, 0x9800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF840, 0xF860, 0xF8A0, 0xF8C1, 0xF8E1, 0xF901, 0xF941,
-  0xF962, 0xF982, 0xF9A2, 0xF9E2, 0xFA02, 0xFB69, 0xFF7D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD50, 0xFB24,
-  0xFB24, 0xFB44, 0xFB44, 0xFB44, 0xFB44, 0xFB44, 0xFB44, 0xFB44,
-  0xFB24, 0xFB24, 0xFB04, 0xFB04, 0xFAE4, 0xFAC4, 0xFAC4, 0xFAA3,
-  0xFA83, 0xFA63, 0xFA43, 0xFA23, 0xFA02, 0xF9E2, 0xF9A2, 0xF982,
-  0xF962, 0xF941, 0xF901, 0xF8E1, 0xF8C1, 0xF8A0, 0xF860, 0xF840,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x9800, 0x0000,
-  0x0000, 0x5AEB, 0x7BEF, 0x7BEF, 0x7BEF, 0x6B4D, 0x4A69, 0x4208,
-  0x31A6, 0x3186, 0x39E7, 0x6B6D, 0x9CF3, 0xAD75, 0xAD75, 0xAD55,
-  0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2,
-  0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x8410,
-  0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x4A49,
-  0x3186, 0x4A69, 0x7BCF, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x2124, 0x0841,
-  0x0861, 0x1082, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4208, 0x3186,
-  0x39C7, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945, 0x2124,
-  0x2124, 0x2104, 0x18E3, 0x2124, 0x31A6, 0x4208, 0x4A69, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x4A69, 0x3186, 0x39C7,
-  0x52AA, 0x528A, 0x4A69, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x1082,
-  0x0000, 0x2000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF860, 0xF880, 0xF8A1, 0xF8C1, 0xF901, 0xF921,
-  0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9C2, 0xF9E2, 0xFAA5, 0xFE57,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC6C, 0xFAE4,
-  0xFB04, 0xFB04, 0xFB04, 0xFB04, 0xFB04, 0xFB04, 0xFB04, 0xFB04,
-  0xFB04, 0xFAE4, 0xFAE4, 0xFAC4, 0xFAC4, 0xFAA3, 0xFA83, 0xFA63,
-  0xFA43, 0xFA23, 0xFA23, 0xF9E2, 0xF9C2, 0xF9A2, 0xF982, 0xF962,
-  0xF941, 0xF921, 0xF901, 0xF8C1, 0xF8A1, 0xF880, 0xF860, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x2000, 0x0000,
-  0x18C3, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x528A, 0x4228, 0x39C7,
-  0x3186, 0x3186, 0x528A, 0x738E, 0xAD75, 0xAD75, 0xAD55, 0xAD55,
-  0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2,
-  0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x39E7,
-  0x3186, 0x5AEB, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x632C, 0x632C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA,
-  0x528A, 0x528A, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x18C3, 0x0841,
-  0x0861, 0x0861, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x3186,
-  0x3186, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x2965, 0x39C7, 0x4228, 0x528A,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x630C, 0x31A6, 0x3186,
-  0x4A69, 0x528A, 0x4A69, 0x5ACB, 0x630C, 0x5AEB, 0x5AEB, 0x4208,
-  0x0000, 0x0000, 0x8800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF840, 0xF860, 0xF880, 0xF8A1, 0xF8E1, 0xF901,
-  0xF921, 0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9C2, 0xF9E2, 0xFA03,
-  0xFC2C, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB68, 0xFAC4,
-  0xFAC4, 0xFAC4, 0xFAE4, 0xFAE4, 0xFAE4, 0xFAE4, 0xFAE4, 0xFAC4,
-  0xFAC4, 0xFAC4, 0xFAA3, 0xFAA3, 0xFA83, 0xFA63, 0xFA63, 0xFA43,
-  0xFA23, 0xFA03, 0xF9E2, 0xF9C2, 0xF9A2, 0xF982, 0xF962, 0xF941,
-  0xF921, 0xF901, 0xF8E1, 0xF8A1, 0xF880, 0xF860, 0xF840, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x8800, 0x0000, 0x0000,
-  0x5ACB, 0x7BCF, 0x73AE, 0x73AE, 0x6B4D, 0x4228, 0x39E7, 0x3186,
-  0x3186, 0x31A6, 0x632C, 0x8C51, 0xAD75, 0xAD55, 0xAD55, 0xA534,
-  0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x9492,
-  0x9492, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8410, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x3186,
-  0x3186, 0x6B6D, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x1082, 0x0841,
-  0x0861, 0x0861, 0x2104, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x31A6,
-  0x3186, 0x4228, 0x4A69, 0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2945, 0x31A6, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x4228, 0x3186,
-  0x39E7, 0x52AA, 0x528A, 0x4A69, 0x630C, 0x630C, 0x5AEB, 0x5ACB,
-  0x18C3, 0x0000, 0x0800, 0xE000, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF880, 0xF8A1, 0xF8E1,
-  0xF901, 0xF921, 0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9C2, 0xF9E2,
-  0xFA02, 0xFA23, 0xFC6E, 0xFF1B, 0xFFFF, 0xFFFF, 0xFA84, 0xFA83,
-  0xFA83, 0xFAA3, 0xFAA3, 0xFAA3, 0xFAA3, 0xFAA3, 0xFAA3, 0xFAA3,
-  0xFA83, 0xFA83, 0xFA83, 0xFA63, 0xFA63, 0xFA43, 0xFA23, 0xFA03,
-  0xFA02, 0xF9E2, 0xF9C2, 0xF9A2, 0xF982, 0xF962, 0xF941, 0xF921,
-  0xF901, 0xF8E1, 0xF8A1, 0xF880, 0xF860, 0xF840, 0xF820, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xE000, 0x0800, 0x0000, 0x2104,
-  0x73AE, 0x73AE, 0x738E, 0x738E, 0x4A69, 0x39E7, 0x3186, 0x2965,
-  0x3186, 0x4A49, 0x632C, 0xA534, 0xAD55, 0xAD55, 0xA534, 0xA534,
-  0xA514, 0xA514, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x9492,
-  0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x52AA, 0x3186,
-  0x39C7, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4208, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x39C7,
-  0x3186, 0x39E7, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x2965, 0x39C7, 0x4228,
-  0x528A, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x5AEB, 0x3186,
-  0x3186, 0x4A69, 0x528A, 0x4A69, 0x5ACB, 0x630C, 0x630C, 0x5AEB,
-  0x4A69, 0x0000, 0x0000, 0x4800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF880, 0xF8C1,
-  0xF8E1, 0xF901, 0xF921, 0xF941, 0xF962, 0xF982, 0xF9A2, 0xF9A2,
-  0xF9C2, 0xF9E2, 0xFA02, 0xFA03, 0xFB28, 0xFCF0, 0xFA43, 0xFA43,
-  0xFA63, 0xFA63, 0xFA63, 0xFA63, 0xFA63, 0xFA63, 0xFA63, 0xFA63,
-  0xFA63, 0xFA43, 0xFA43, 0xFA43, 0xFA23, 0xFA03, 0xFA02, 0xF9E2,
-  0xF9C2, 0xF9A2, 0xF9A2, 0xF982, 0xF962, 0xF941, 0xF921, 0xF901,
-  0xF8E1, 0xF8C1, 0xF880, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0x4800, 0x0000, 0x0000, 0x630C,
-  0x738E, 0x738E, 0x6B6D, 0x5AEB, 0x39E7, 0x3186, 0x2945, 0x3186,
-  0x3186, 0x5AEB, 0x7BCF, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA514,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71,
-  0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x4228, 0x3186,
-  0x4A69, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C,
-  0x632C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A,
-  0x528A, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x3186, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x10A2, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4208,
-  0x3186, 0x31A6, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2124, 0x31A6, 0x4208,
-  0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x4228,
-  0x3186, 0x39E7, 0x52AA, 0x528A, 0x528A, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x2965, 0x0000, 0x0000, 0x9800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860, 0xF880,
-  0xF8A1, 0xF8E1, 0xF901, 0xF901, 0xF921, 0xF942, 0xF962, 0xF982,
-  0xF9A2, 0xF9C2, 0xF9C2, 0xF9E2, 0xFA02, 0xFA03, 0xFA23, 0xFA23,
-  0xFA23, 0xFA23, 0xFA43, 0xFA43, 0xFA43, 0xFA43, 0xFA43, 0xFA23,
-  0xFA23, 0xFA23, 0xFA23, 0xFA03, 0xFA02, 0xF9E2, 0xF9C2, 0xF9C2,
-  0xF9A2, 0xF982, 0xF962, 0xF942, 0xF921, 0xF901, 0xF901, 0xF8E1,
-  0xF8A1, 0xF880, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0x9800, 0x0000, 0x0000, 0x39C7, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x4208, 0x3186, 0x2945, 0x2965, 0x3186,
-  0x4228, 0x5AEB, 0x9CF3, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514,
-  0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x8C71,
-  0x8C51, 0x8C51, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x39C7, 0x3186,
-  0x630C, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C,
-  0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x2124, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x1082, 0x2104, 0x2104, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x3186, 0x3186, 0x4A49, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x2104, 0x2965, 0x39C7,
-  0x4228, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x5AEB,
-  0x3186, 0x3186, 0x4A69, 0x52AA, 0x528A, 0x52AA, 0x632C, 0x630C,
-  0x5AEB, 0x5ACB, 0x1082, 0x0000, 0x0800, 0xD000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF860,
-  0xF880, 0xF8A1, 0xF8C1, 0xF8E1, 0xF901, 0xF921, 0xF941, 0xF962,
-  0xF962, 0xF982, 0xF9A2, 0xF9A2, 0xF9C2, 0xF9E2, 0xF9E2, 0xF9E2,
-  0xFA02, 0xFA03, 0xFA03, 0xFA03, 0xFA03, 0xFA03, 0xFA03, 0xFA03,
-  0xFA02, 0xF9E2, 0xF9E2, 0xF9E2, 0xF9C2, 0xF9A2, 0xF9A2, 0xF982,
-  0xF962, 0xF962, 0xF941, 0xF921, 0xF901, 0xF8E1, 0xF8C1, 0xF8A1,
-  0xF880, 0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xD000, 0x0800, 0x0000, 0x10A2, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x4A69, 0x3186, 0x2945, 0x2124, 0x3186, 0x3186,
-  0x52AA, 0x738E, 0xAD55, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3,
-  0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51,
-  0x8C51, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x5ACB, 0x3186, 0x3186,
-  0x738E, 0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C,
-  0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x10A2, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x2104, 0x2104, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x31A6, 0x3186, 0x4208, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2124, 0x3186,
-  0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C,
-  0x4A49, 0x3186, 0x39C7, 0x52AA, 0x528A, 0x4A69, 0x5AEB, 0x632C,
-  0x630C, 0x5AEB, 0x4A69, 0x0020, 0x0000, 0x2000, 0xE800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840,
-  0xF860, 0xF880, 0xF8A1, 0xF8C1, 0xF8E1, 0xF901, 0xF901, 0xF921,
-  0xF941, 0xF962, 0xF962, 0xF982, 0xF982, 0xF9A2, 0xF9A2, 0xF9C2,
-  0xF9C2, 0xF9C2, 0xF9C2, 0xF9E2, 0xF9E2, 0xF9E2, 0xF9C2, 0xF9C2,
-  0xF9C2, 0xF9C2, 0xF9A2, 0xF9A2, 0xF982, 0xF982, 0xF962, 0xF962,
-  0xF941, 0xF921, 0xF901, 0xF901, 0xF8E1, 0xF8C1, 0xF8A1, 0xF880,
-  0xF860, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xE800, 0x2000, 0x0000, 0x0020, 0x52AA, 0x632C, 0x632C,
-  0x632C, 0x5ACB, 0x3186, 0x2945, 0x2104, 0x3186, 0x3186, 0x4228,
-  0x5ACB, 0x9CD3, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8C51,
-  0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x4A49, 0x3186, 0x4208,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x39E7, 0x18E3,
-  0x0861, 0x3186, 0x31A6, 0x4A69, 0x4A69, 0x4A49, 0x4228, 0x4228,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2945,
-  0x31A6, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x630C, 0x31A6, 0x3186, 0x4228, 0x52AA, 0x528A, 0x528A, 0x630C,
-  0x630C, 0x630C, 0x5AEB, 0x39E7, 0x0000, 0x0000, 0x4000, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF840, 0xF860, 0xF880, 0xF8A0, 0xF8C1, 0xF8C1, 0xF8E1, 0xF901,
-  0xF921, 0xF921, 0xF941, 0xF942, 0xF962, 0xF962, 0xF982, 0xF982,
-  0xF982, 0xF9A2, 0xF9A2, 0xF9A2, 0xF9A2, 0xF9A2, 0xF9A2, 0xF9A2,
-  0xF982, 0xF982, 0xF982, 0xF962, 0xF962, 0xF942, 0xF941, 0xF921,
-  0xF921, 0xF901, 0xF8E1, 0xF8C1, 0xF8C1, 0xF8A0, 0xF880, 0xF860,
-  0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0x4000, 0x0000, 0x0000, 0x4208, 0x630C, 0x630C, 0x630C,
-  0x5AEB, 0x39C7, 0x2124, 0x18E3, 0x2945, 0x3186, 0x31A6, 0x52AA,
-  0x73AE, 0xA534, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3,
-  0x94B2, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C51, 0x8C51, 0x8430,
-  0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x738E, 0x738E,
-  0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x39C7, 0x3186, 0x0861,
-  0x2124, 0x632C, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x31A6, 0x0841, 0x0841, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x10A2, 0x2104, 0x2104, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x2124, 0x0020, 0x4228,
-  0x2104, 0x18E3, 0x3186, 0x4A49, 0x4A69, 0x4A49, 0x4A49, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2104,
-  0x2965, 0x39C7, 0x4228, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x528A, 0x3186, 0x3186, 0x528A, 0x52AA, 0x528A, 0x52AA,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x2965, 0x0000, 0x0000, 0x5800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF840, 0xF860, 0xF860, 0xF880, 0xF8A1, 0xF8C1, 0xF8E1,
-  0xF8E1, 0xF901, 0xF901, 0xF921, 0xF921, 0xF941, 0xF941, 0xF962,
-  0xF962, 0xF962, 0xF962, 0xF962, 0xF962, 0xF962, 0xF962, 0xF962,
-  0xF962, 0xF962, 0xF941, 0xF941, 0xF921, 0xF921, 0xF901, 0xF901,
-  0xF8E1, 0xF8E1, 0xF8C1, 0xF8A1, 0xF880, 0xF860, 0xF860, 0xF840,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0x5800, 0x0000, 0x0000, 0x2965, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x4208, 0x2124, 0x18E3, 0x2124, 0x3186, 0x3186, 0x4A49, 0x52AA,
-  0x9CF3, 0xA534, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2,
-  0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8430,
-  0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x52AA, 0x3186, 0x18C3, 0x1082,
-  0x18E3, 0x0020, 0x39E7, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x2124, 0x0841, 0x0841, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x1082, 0x2104, 0x2104, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x2965, 0x1082, 0x18C3, 0x8430, 0xB5B6,
-  0x94B2, 0x0020, 0x2965, 0x39E7, 0x4A69, 0x4A69, 0x4A49, 0x4228,
-  0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x2945, 0x3186, 0x39E7, 0x4A49, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x4208, 0x3186, 0x39C7, 0x52AA, 0x52AA, 0x528A,
-  0x5AEB, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x2104, 0x0000, 0x0000,
-  0x5800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF820, 0xF840, 0xF860, 0xF880, 0xF880, 0xF8A1,
-  0xF8C1, 0xF8C1, 0xF8E1, 0xF8E1, 0xF901, 0xF901, 0xF921, 0xF921,
-  0xF921, 0xF921, 0xF941, 0xF941, 0xF941, 0xF941, 0xF941, 0xF921,
-  0xF921, 0xF921, 0xF921, 0xF901, 0xF901, 0xF8E1, 0xF8E1, 0xF8C1,
-  0xF8C1, 0xF8A1, 0xF880, 0xF880, 0xF860, 0xF840, 0xF820, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x5800,
-  0x0000, 0x0000, 0x2104, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x4A49,
-  0x2104, 0x18E3, 0x2104, 0x3186, 0x3186, 0x39C7, 0x4A49, 0x8410,
-  0xA514, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2,
-  0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410,
-  0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x632C, 0x630C, 0x630C, 0x4228, 0x2965, 0x0020, 0x4208,
-  0x4A69, 0x31A6, 0x0861, 0x1082, 0x528A, 0x632C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x1082, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x31A6, 0x3186, 0x18C3, 0x0020, 0x5ACB, 0xA534, 0xAD75, 0xB596,
-  0xB5B6, 0x4A69, 0x10A2, 0x31A6, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x2965, 0x31A6, 0x4208, 0x4A69, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x5AEB, 0x31A6, 0x3186, 0x4228, 0x5ACB, 0x52AA,
-  0x528A, 0x630C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x18E3, 0x0000,
-  0x0000, 0x5800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF840, 0xF860, 0xF880,
-  0xF880, 0xF8A1, 0xF8A1, 0xF8C1, 0xF8C1, 0xF8E1, 0xF8E1, 0xF8E1,
-  0xF901, 0xF901, 0xF901, 0xF901, 0xF901, 0xF901, 0xF901, 0xF901,
-  0xF901, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8C1, 0xF8C1, 0xF8A1, 0xF8A1,
-  0xF880, 0xF880, 0xF860, 0xF840, 0xF840, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x5800, 0x0000,
-  0x0000, 0x18C3, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x4A69, 0x2104,
-  0x2104, 0x2104, 0x2965, 0x3186, 0x31A6, 0x4228, 0x5ACB, 0xA514,
-  0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x9492,
-  0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF,
-  0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x31A6, 0x1082, 0x2104, 0x4A69,
-  0x4A49, 0x4208, 0x31A6, 0x18C3, 0x0000, 0x2124, 0x5ACB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x39E7, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x18C3, 0x2104, 0x2104, 0x18E3,
-  0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x18E3, 0x0020, 0x3186, 0x8C51, 0x9CF3, 0xA534, 0xAD55, 0xAD75,
-  0xB596, 0xAD55, 0x0861, 0x2104, 0x4228, 0x4A69, 0x4A69, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x18E3, 0x2124, 0x3186, 0x39C7, 0x4228, 0x528A, 0x52AA, 0x5ACB,
-  0x5AEB, 0x630C, 0x632C, 0x528A, 0x3186, 0x3186, 0x4A69, 0x52AA,
-  0x52AA, 0x528A, 0x630C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x18E3,
-  0x0000, 0x0000, 0x4000, 0xE800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF840, 0xF840,
-  0xF860, 0xF860, 0xF880, 0xF880, 0xF8A1, 0xF8A1, 0xF8C1, 0xF8C1,
-  0xF8C1, 0xF8C1, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8E1, 0xF8C1,
-  0xF8C1, 0xF8C1, 0xF8C1, 0xF8A1, 0xF8A1, 0xF880, 0xF880, 0xF860,
-  0xF860, 0xF840, 0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xE800, 0x4000, 0x0000, 0x0000,
-  0x10A2, 0x4A49, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x2124, 0x2104,
-  0x2124, 0x2945, 0x3186, 0x3186, 0x39E7, 0x4208, 0x94B2, 0xA514,
-  0x9CF3, 0x9CF3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x9492,
-  0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C,
-  0x632C, 0x630C, 0x5AEB, 0x4A69, 0x2104, 0x0020, 0x4A49, 0x4A49,
-  0x4208, 0x39C7, 0x3186, 0x2965, 0x2104, 0x0861, 0x0020, 0x39C7,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x2945, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x2104, 0x2104, 0x18E3,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2124, 0x0861,
-  0x1082, 0x632C, 0x9492, 0x94B2, 0x9CF3, 0xA514, 0xA534, 0xAD55,
-  0xAD75, 0xB596, 0x4228, 0x0841, 0x39C7, 0x528A, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104,
-  0x2104, 0x18E3, 0x2124, 0x3186, 0x39E7, 0x4A49, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x4228, 0x3186, 0x31A6, 0x528A,
-  0x52AA, 0x528A, 0x52AA, 0x630C, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x2104, 0x0000, 0x0000, 0x2000, 0xD000, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF840, 0xF840, 0xF860, 0xF860, 0xF860, 0xF880, 0xF880, 0xF880,
-  0xF8A0, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1, 0xF8A1,
-  0xF8A0, 0xF880, 0xF880, 0xF880, 0xF860, 0xF860, 0xF860, 0xF840,
-  0xF840, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xD000, 0x2000, 0x0000, 0x0000, 0x18C3,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x2124, 0x2104, 0x2124,
-  0x2945, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x7BCF, 0x9CF3, 0x9CF3,
-  0x9CD3, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x8C71, 0x8C71,
-  0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x7BCF, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x632C,
-  0x630C, 0x5AEB, 0x5AEB, 0x39C7, 0x0020, 0x18E3, 0x4A69, 0x4228,
-  0x39E7, 0x31A6, 0x2965, 0x2124, 0x18E3, 0x2945, 0x2945, 0x0841,
-  0x1082, 0x4228, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x18C3, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x10A2, 0x0020, 0x4208,
-  0x8410, 0x8C51, 0x8C71, 0x9492, 0x9CD3, 0x9CF3, 0xA514, 0xA534,
-  0x8C51, 0x2104, 0x0861, 0x2124, 0x3186, 0x4A49, 0x4A69, 0x4A69,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x18E3, 0x2945, 0x31A6, 0x4208, 0x4A69, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x39E7, 0x3186, 0x31A6,
-  0x52AA, 0x52AA, 0x528A, 0x52AA, 0x630C, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x2965, 0x0000, 0x0000, 0x0800, 0x9800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF820, 0xF840, 0xF840, 0xF840, 0xF860, 0xF860,
-  0xF860, 0xF860, 0xF860, 0xF860, 0xF880, 0xF860, 0xF860, 0xF860,
-  0xF860, 0xF860, 0xF860, 0xF840, 0xF840, 0xF840, 0xF820, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0x9800, 0x0800, 0x0000, 0x0000, 0x18C3, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x5AEB, 0x9CF3, 0x9CF3, 0x9CD3,
-  0x9CD3, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C51,
-  0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C,
-  0x5AEB, 0x5AEB, 0x528A, 0x3186, 0x2124, 0x0861, 0x1082, 0x31A6,
-  0x39C7, 0x3186, 0x2945, 0x2104, 0x2124, 0x3186, 0x4208, 0x4A69,
-  0x3186, 0x0020, 0x2124, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x39E7, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x18C3, 0x2104, 0x2104,
-  0x18E3, 0x2104, 0x2104, 0x10A2, 0x0020, 0x18E3, 0x632C, 0x7BCF,
-  0x8410, 0x8430, 0x8C51, 0x8C71, 0x94B2, 0x9CD3, 0x94B2, 0x4228,
-  0x0020, 0x2124, 0x4228, 0x39C7, 0x3186, 0x39E7, 0x528A, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x2965, 0x39C7, 0x4208, 0x4A69,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x632C, 0x630C, 0x39C7, 0x3186,
-  0x39C7, 0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x630C, 0x632C, 0x632C,
-  0x630C, 0x5AEB, 0x39E7, 0x0020, 0x0000, 0x0000, 0x4800, 0xE000,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF820, 0xF820,
-  0xF840, 0xF840, 0xF840, 0xF840, 0xF840, 0xF840, 0xF840, 0xF840,
-  0xF840, 0xF820, 0xF820, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xE000, 0x4800, 0x0000, 0x0000, 0x0000, 0x18E3, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2124, 0x2124, 0x2945, 0x2945, 0x3186,
-  0x3186, 0x3186, 0x2945, 0x4208, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3,
-  0x94B2, 0x94B2, 0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8C51,
-  0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5ACB, 0x39E7, 0x3186, 0x4A49, 0x6B6D, 0x39C7, 0x0020,
-  0x10A2, 0x2945, 0x2124, 0x18E3, 0x2965, 0x39E7, 0x4A49, 0x5ACB,
-  0x6B4D, 0x632C, 0x2124, 0x0841, 0x3186, 0x4A49, 0x4A49, 0x4228,
-  0x4228, 0x4208, 0x2945, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x2124, 0x2104,
-  0x18E3, 0x18C3, 0x0841, 0x0841, 0x4228, 0x6B6D, 0x738E, 0x73AE,
-  0x7BCF, 0x8410, 0x8430, 0x8C51, 0x9492, 0x630C, 0x0861, 0x10A2,
-  0x39C7, 0x4208, 0x4228, 0x4208, 0x3186, 0x3186, 0x4A69, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x18E3, 0x2124, 0x3186, 0x39C7, 0x4228,
-  0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x632C, 0x5AEB, 0x31A6,
-  0x3186, 0x39C7, 0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x630C, 0x632C,
-  0x632C, 0x630C, 0x5AEB, 0x528A, 0x1082, 0x0000, 0x0000, 0x0800,
-  0x8800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x8800,
-  0x0800, 0x0000, 0x0000, 0x0020, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x2124, 0x3186, 0x9492, 0x9CD3, 0x9CD3, 0x94B2, 0x94B2,
-  0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8430,
-  0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x738E,
-  0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5ACB, 0x528A, 0x3186, 0x3186, 0x632C, 0x6B6D, 0x6B6D, 0x5AEB,
-  0x18E3, 0x0020, 0x10A2, 0x2945, 0x31A6, 0x4228, 0x528A, 0x630C,
-  0x738E, 0x7BEF, 0x8C71, 0x6B4D, 0x1082, 0x18C3, 0x39E7, 0x4228,
-  0x4228, 0x4208, 0x18C3, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082,
-  0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x2104, 0x2104,
-  0x1082, 0x0000, 0x2945, 0x5ACB, 0x630C, 0x632C, 0x6B6D, 0x738E,
-  0x73AE, 0x7BEF, 0x8410, 0x738E, 0x2104, 0x0841, 0x2945, 0x39E7,
-  0x39E7, 0x4208, 0x39E7, 0x31A6, 0x3186, 0x3186, 0x39E7, 0x528A,
-  0x4A69, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2124, 0x3186, 0x39E7,
-  0x4228, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x5ACB,
-  0x31A6, 0x3186, 0x39C7, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x630C,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x3186, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x9800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x9800, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x2104, 0x2945, 0x8C51, 0x9CD3, 0x94B2, 0x94B2, 0x94B2, 0x9492,
-  0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E,
-  0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x39E7, 0x3186, 0x3186, 0x39C7, 0x52AA, 0x6B4D, 0x6B4D,
-  0x632C, 0x4228, 0x0841, 0x0861, 0x31A6, 0x4A69, 0x5AEB, 0x6B4D,
-  0x7BCF, 0x8C51, 0x94B2, 0xA534, 0xAD55, 0x5ACB, 0x0020, 0x2104,
-  0x4208, 0x39E7, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x1082, 0x0020,
-  0x0861, 0x31A6, 0x4A69, 0x52AA, 0x5AEB, 0x630C, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x39C7, 0x0020, 0x0861, 0x18C3, 0x18E3, 0x2945,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x4A69,
-  0x528A, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2945, 0x3186,
-  0x39E7, 0x4A49, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C,
-  0x5ACB, 0x31A6, 0x3186, 0x39C7, 0x52AA, 0x5ACB, 0x52AA, 0x528A,
-  0x5AEB, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x4A69, 0x18C3,
-  0x0000, 0x0000, 0x0000, 0x2000, 0x9000, 0xF000, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF000, 0x9000, 0x2000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x18E3, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2124,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x2124,
-  0x2945, 0x8430, 0x94B2, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x8C71,
-  0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x8410,
-  0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x4A69, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x39C7, 0x4A49,
-  0x4208, 0x2965, 0x2124, 0x0861, 0x0000, 0x2945, 0x630C, 0x73AE,
-  0x8410, 0x9492, 0x9CF3, 0xAD75, 0xBDF7, 0xC638, 0x9492, 0x2124,
-  0x0841, 0x18C3, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0020, 0x0000, 0x10A2,
-  0x2945, 0x31A6, 0x4208, 0x528A, 0x5ACB, 0x5AEB, 0x630C, 0x6B4D,
-  0x4A69, 0x0841, 0x1082, 0x39E7, 0x52AA, 0x528A, 0x4208, 0x18E3,
-  0x0000, 0x10A2, 0x2124, 0x31A6, 0x4208, 0x39C7, 0x3186, 0x39E7,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2945,
-  0x31A6, 0x39E7, 0x4A49, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x632C, 0x5ACB, 0x31A6, 0x3186, 0x31A6, 0x52AA, 0x5ACB, 0x52AA,
-  0x528A, 0x5ACB, 0x630C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB,
-  0x4208, 0x1082, 0x0000, 0x0000, 0x0000, 0x0800, 0x6000, 0xB800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xB800, 0x6000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0841, 0x18E3,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2124, 0x2945,
-  0x7BEF, 0x94B2, 0x94B2, 0x9492, 0x9492, 0x9492, 0x8C71, 0x8C71,
-  0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x39C7, 0x3186, 0x4228, 0x630C, 0x4208, 0x2124, 0x1082, 0x0000,
-  0x10A2, 0x31A6, 0x4A49, 0x52AA, 0x4228, 0x1082, 0x0841, 0x52AA,
-  0x8C51, 0x9CD3, 0xAD55, 0xB5B6, 0xC638, 0xB5B6, 0xA514, 0x8C71,
-  0x4A69, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x1082, 0x0841, 0x0000, 0x1082, 0x2124, 0x2104,
-  0x18E3, 0x2945, 0x39C7, 0x4228, 0x528A, 0x5ACB, 0x528A, 0x18E3,
-  0x0841, 0x528A, 0x8C51, 0x94B2, 0x9CF3, 0xA534, 0xAD75, 0xB596,
-  0xA514, 0x5ACB, 0x0841, 0x18C3, 0x39E7, 0x4208, 0x3186, 0x3186,
-  0x4A49, 0x528A, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x2945, 0x31A6, 0x4208, 0x4A49, 0x528A, 0x52AA, 0x5ACB, 0x5AEB,
-  0x630C, 0x632C, 0x5AEB, 0x39C7, 0x3186, 0x31A6, 0x4A69, 0x5ACB,
-  0x52AA, 0x52AA, 0x52AA, 0x5AEB, 0x632C, 0x632C, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x4208, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1000, 0x5800, 0xA000, 0xD800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xD800, 0xA000, 0x5800, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2104, 0x2965, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2945, 0x3186, 0x8410,
-  0x94B2, 0x9492, 0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8C51,
-  0x8C51, 0x8430, 0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x4228,
-  0x3186, 0x3186, 0x630C, 0x632C, 0x2104, 0x0020, 0x3186, 0x632C,
-  0x8410, 0x8C71, 0x94B2, 0xA514, 0xAD55, 0xAD75, 0x738E, 0x0861,
-  0x2945, 0x8C71, 0xB596, 0xBDF7, 0xC618, 0xAD55, 0x94B2, 0x8410,
-  0x6B6D, 0x528A, 0x18C3, 0x0000, 0x0841, 0x0861, 0x1082, 0x1082,
-  0x10A2, 0x0861, 0x0020, 0x0841, 0x2945, 0x2965, 0x2945, 0x2124,
-  0x2104, 0x18E3, 0x2965, 0x39C7, 0x4228, 0x2945, 0x0020, 0x2965,
-  0x73AE, 0x8C71, 0x9CD3, 0xA534, 0xAD75, 0xB5B6, 0xBDF7, 0xBDF7,
-  0xC618, 0xBDF7, 0xAD75, 0x39E7, 0x0841, 0x39C7, 0x39C7, 0x3186,
-  0x39C7, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x18E3,
-  0x2104, 0x2965, 0x31A6, 0x4208, 0x4A49, 0x528A, 0x52AA, 0x5ACB,
-  0x5AEB, 0x630C, 0x632C, 0x630C, 0x39E7, 0x3186, 0x3186, 0x4228,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x5ACB, 0x630C, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x4A49, 0x2945, 0x0841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x4000, 0x6800, 0x8800,
-  0xA800, 0xB800, 0xC800, 0xC800, 0xC800, 0xC800, 0xB800, 0xA800,
-  0x8800, 0x6800, 0x4000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x10A2, 0x2945, 0x3186, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x2945, 0x39C7, 0x8430, 0x9492,
-  0x9492, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51, 0x8430,
-  0x8430, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C,
-  0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x4A69, 0x31A6,
-  0x3186, 0x4228, 0x5ACB, 0x0841, 0x10A2, 0x52AA, 0x6B6D, 0x7BEF,
-  0x8C71, 0x9CD3, 0xA534, 0xAD75, 0xB5B6, 0xBDF7, 0xC618, 0xB5B6,
-  0x528A, 0x0841, 0x630C, 0xC618, 0xB596, 0x9CF3, 0x8C51, 0x73AE,
-  0x5AEB, 0x4A49, 0x31A6, 0x18E3, 0x0020, 0x0000, 0x0861, 0x1082,
-  0x0841, 0x0020, 0x2124, 0x39E7, 0x39C7, 0x3186, 0x2965, 0x2945,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x0841, 0x1082, 0x528A, 0x7BCF,
-  0x8C51, 0x9CD3, 0xA534, 0xB596, 0xBDF7, 0xC638, 0xCE59, 0xCE79,
-  0xCE79, 0xCE79, 0xCE59, 0xC638, 0x6B4D, 0x0020, 0x39C7, 0x3186,
-  0x3186, 0x4228, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x18E3, 0x2104, 0x2965, 0x31A6, 0x4208, 0x4A49, 0x528A, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x4228, 0x3186, 0x3186,
-  0x39C7, 0x52AA, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x5ACB, 0x632C,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x4208,
-  0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18C3,
-  0x2945, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x4228, 0x8C51, 0x9492, 0x8C71,
-  0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x4A69, 0x39E7, 0x3186,
-  0x31A6, 0x52AA, 0x0020, 0x10A2, 0x52AA, 0x6B4D, 0x7BCF, 0x8C51,
-  0x9CD3, 0xA534, 0xB596, 0xBDF7, 0xC638, 0xCE59, 0xCE79, 0xCE79,
-  0xCE79, 0xA514, 0x2945, 0x18C3, 0x7BCF, 0x9492, 0x7BEF, 0x632C,
-  0x528A, 0x39E7, 0x2945, 0x18E3, 0x2124, 0x18C3, 0x0000, 0x0841,
-  0x18E3, 0x4208, 0x4228, 0x4208, 0x39C7, 0x31A6, 0x3186, 0x2965,
-  0x2945, 0x2104, 0x0841, 0x0000, 0x2104, 0x5ACB, 0x6B6D, 0x8410,
-  0x9492, 0xA514, 0xB596, 0xBDF7, 0xC638, 0xD69A, 0xD6BA, 0xDEDB,
-  0xDEFB, 0xDEDB, 0xD6BA, 0xD69A, 0xCE59, 0x632C, 0x0861, 0x39C7,
-  0x3186, 0x31A6, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2104,
-  0x2104, 0x18E3, 0x2104, 0x2965, 0x31A6, 0x4208, 0x4A49, 0x528A,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x528A, 0x31A6,
-  0x3186, 0x3186, 0x4A49, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A,
-  0x5AEB, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x528A, 0x39C7, 0x2945, 0x18E3, 0x1082, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0861, 0x10A2, 0x2104, 0x2965, 0x39C7, 0x39E7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x5ACB, 0x8C71, 0x8C71, 0x8C71, 0x8C71,
-  0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410,
-  0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x4A69, 0x4208, 0x3186, 0x3186,
-  0x4A49, 0x0841, 0x10A2, 0x39E7, 0x5AEB, 0x738E, 0x8410, 0x94B2,
-  0xA534, 0xB596, 0xBDF7, 0xCE59, 0xD69A, 0xD6BA, 0xDEDB, 0xDEFB,
-  0xDEDB, 0xD6BA, 0xCE79, 0x73AE, 0x0020, 0x2945, 0x632C, 0x5ACB,
-  0x4228, 0x3186, 0x2104, 0x2104, 0x2124, 0x2945, 0x2945, 0x1082,
-  0x528A, 0x4A69, 0x4A49, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x3186,
-  0x18C3, 0x0000, 0x0020, 0x18E3, 0x4228, 0x630C, 0x73AE, 0x8C51,
-  0x9CD3, 0xAD55, 0xBDD7, 0xC638, 0xD69A, 0xDEDB, 0xE71C, 0xE73C,
-  0xEF5D, 0xE73C, 0xE71C, 0xDEDB, 0xD69A, 0xC638, 0x39E7, 0x18E3,
-  0x31A6, 0x3186, 0x39E7, 0x528A, 0x528A, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x18E3, 0x2104, 0x2965, 0x31A6, 0x39E7, 0x4A49,
-  0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x5AEB,
-  0x4208, 0x3186, 0x3186, 0x39C7, 0x4A69, 0x5ACB, 0x52AA, 0x52AA,
-  0x528A, 0x528A, 0x5ACB, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A,
-  0x4A69, 0x4228, 0x4208, 0x4208, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x39C7, 0x6B6D, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x8C51,
-  0x8C51, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D,
-  0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x52AA, 0x52AA, 0x4A49, 0x4208, 0x31A6, 0x3186, 0x39C7,
-  0x2124, 0x1082, 0x18E3, 0x4A69, 0x632C, 0x7BCF, 0x8C51, 0x9CF3,
-  0xAD75, 0xBDD7, 0xC638, 0xD69A, 0xDEDB, 0xE71C, 0xE73C, 0xEF5D,
-  0xE73C, 0xE71C, 0xDEDB, 0xD69A, 0xB596, 0x1082, 0x0020, 0x2965,
-  0x39C7, 0x2124, 0x2104, 0x2124, 0x2945, 0x2965, 0x3186, 0x31A6,
-  0x4A69, 0x528A, 0x4A69, 0x4228, 0x4208, 0x39E7, 0x2965, 0x0841,
-  0x0020, 0x0000, 0x2124, 0x2104, 0x528A, 0x6B4D, 0x7BEF, 0x8C71,
-  0xA514, 0xB596, 0xC618, 0xCE79, 0xDEDB, 0xE71C, 0xEF5D, 0xF79E,
-  0xF79E, 0xF79E, 0xEF5D, 0xE71C, 0xDEDB, 0xCE79, 0xAD75, 0x0841,
-  0x31A6, 0x3186, 0x3186, 0x4A49, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x2104, 0x2945, 0x31A6, 0x39E7,
-  0x4228, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x528A, 0x31A6, 0x3186, 0x3186, 0x39E7, 0x528A, 0x5ACB,
-  0x52AA, 0x52AA, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x4A69, 0x8410, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430,
-  0x8430, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF,
-  0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x52AA, 0x528A, 0x4A49, 0x4208, 0x31A6, 0x3186, 0x3186, 0x4A49,
-  0x0020, 0x2945, 0x2124, 0x52AA, 0x6B4D, 0x7BEF, 0x9492, 0xA514,
-  0xB596, 0xC618, 0xCE79, 0xDEDB, 0xE73C, 0xEF5D, 0xF79E, 0xF79E,
-  0xEF7D, 0xEF5D, 0xE71C, 0xDEDB, 0xCE79, 0x9CF3, 0x0000, 0x0020,
-  0x0841, 0x18C3, 0x2104, 0x2124, 0x2945, 0x2965, 0x3186, 0x3186,
-  0x18E3, 0x52AA, 0x4A69, 0x4A49, 0x4208, 0x18C3, 0x0000, 0x0841,
-  0x0841, 0x10A2, 0x2965, 0x2945, 0x52AA, 0x6B6D, 0x8410, 0x9492,
-  0xA534, 0xB5B6, 0xC638, 0xD69A, 0xDEFB, 0xEF5D, 0xF79E, 0xF7BE,
-  0xFFDF, 0xF7BE, 0xF79E, 0xEF5D, 0xDEFB, 0xD69A, 0xC638, 0x528A,
-  0x18E3, 0x39C7, 0x3186, 0x31A6, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2104, 0x2945, 0x31A6,
-  0x39E7, 0x4228, 0x4A69, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x630C, 0x4A49, 0x3186, 0x3186, 0x3186, 0x39E7,
-  0x4A69, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x39E7,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39E7, 0x6B4D,
-  0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8430, 0x8430, 0x8430, 0x8410,
-  0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x73AE,
-  0x73AE, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D,
-  0x632C, 0x632C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x528A, 0x4A49, 0x4208, 0x31A6, 0x3186, 0x3186, 0x4A49, 0x2124,
-  0x18E3, 0x2945, 0x2965, 0x5ACB, 0x6B6D, 0x8410, 0x94B2, 0xA534,
-  0xB5B6, 0xC638, 0xD69A, 0xDEFB, 0xEF5D, 0xF79E, 0xF7BE, 0xFFDF,
-  0xF7BE, 0xF79E, 0xEF5D, 0xDEFB, 0xD69A, 0xC618, 0x39C7, 0x0841,
-  0x0020, 0x0000, 0x0861, 0x2124, 0x2965, 0x3186, 0x31A6, 0x1082,
-  0x0020, 0x4208, 0x528A, 0x3186, 0x0020, 0x0841, 0x0861, 0x0861,
-  0x0020, 0x2965, 0x2945, 0x2945, 0x5ACB, 0x6B6D, 0x8410, 0x94B2,
-  0xA534, 0xB5B6, 0xC638, 0xD6BA, 0xE71C, 0xEF7D, 0xF7BE, 0xFFDF,
-  0xFFFF, 0xFFDF, 0xF7BE, 0xEF7D, 0xE71C, 0xD6BA, 0xC638, 0x9CF3,
-  0x0020, 0x4208, 0x31A6, 0x3186, 0x39E7, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2945,
-  0x3186, 0x39C7, 0x4228, 0x4A69, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x5AEB, 0x4228, 0x3186, 0x3186,
-  0x3186, 0x39C7, 0x4A49, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x31A6, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39E7, 0x5ACB, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8410, 0x8410, 0x8410, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE,
-  0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x4A69,
-  0x4228, 0x39E7, 0x31A6, 0x3186, 0x3186, 0x31A6, 0x630C, 0x0000,
-  0x3186, 0x2945, 0x3186, 0x5ACB, 0x738E, 0x8430, 0x94B2, 0xAD55,
-  0xBDD7, 0xCE59, 0xD6BA, 0xE71C, 0xEF7D, 0xF7BE, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xF7BE, 0xEF5D, 0xE71C, 0xD69A, 0xC638, 0x8430, 0x0841,
-  0x0861, 0x0861, 0x0020, 0x0000, 0x18E3, 0x31A6, 0x2945, 0x0000,
-  0x1082, 0x0841, 0x1082, 0x0020, 0x0861, 0x1082, 0x1082, 0x0861,
-  0x0000, 0x39C7, 0x2945, 0x2945, 0x5ACB, 0x6B6D, 0x8410, 0x94B2,
-  0xA534, 0xB5B6, 0xC638, 0xD6BA, 0xE71C, 0xEF5D, 0xF7BE, 0xFFDF,
-  0xFFFF, 0xFFDF, 0xF7BE, 0xEF7D, 0xE71C, 0xD6BA, 0xC638, 0xB5B6,
-  0x10A2, 0x3186, 0x4208, 0x3186, 0x3186, 0x4A49, 0x528A, 0x528A,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x2124, 0x3186, 0x39C7, 0x4208, 0x4A49, 0x528A, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x5AEB, 0x4228,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x39E7, 0x4A49, 0x52AA, 0x52AA,
-  0x52AA, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x39E7, 0x39C7, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x39E7, 0x39E7, 0x52AA, 0x7BCF, 0x8430, 0x8430, 0x8430,
-  0x8410, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x4A69, 0x4228,
-  0x39C7, 0x3186, 0x2965, 0x3186, 0x3186, 0x5ACB, 0x4A69, 0x0861,
-  0x39C7, 0x2945, 0x3186, 0x5ACB, 0x738E, 0x8430, 0x94B2, 0xAD55,
-  0xBDD7, 0xCE59, 0xD6BA, 0xE71C, 0xEF7D, 0xF7BE, 0xFFDF, 0xFFFF,
-  0xFFDF, 0xF79E, 0xEF5D, 0xDEFB, 0xD69A, 0xC638, 0xB596, 0x0020,
-  0x0841, 0x0861, 0x1082, 0x0861, 0x0020, 0x0841, 0x0020, 0x0861,
-  0x18E3, 0x0841, 0x0861, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0841,
-  0x1082, 0x39E7, 0x2965, 0x2124, 0x52AA, 0x6B4D, 0x7BEF, 0x9492,
-  0xA534, 0xB5B6, 0xC618, 0xD69A, 0xDEFB, 0xEF5D, 0xF79E, 0xF7BE,
-  0xFFDF, 0xF7BE, 0xF79E, 0xEF5D, 0xDEFB, 0xD69A, 0xC638, 0xB5B6,
-  0x39C7, 0x2124, 0x4228, 0x39C7, 0x3186, 0x31A6, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x18E3, 0x2124, 0x2965, 0x31A6, 0x39E7, 0x4228, 0x4A69, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x630C, 0x4A69, 0x39C7, 0x3186, 0x3186, 0x3186, 0x3186, 0x39C7,
-  0x4228, 0x4A69, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4208, 0x39E7,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x4208,
-  0x4208, 0x5ACB, 0x73AE, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410,
-  0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x4A49, 0x4208, 0x39C7,
-  0x3186, 0x2945, 0x3186, 0x3186, 0x4A49, 0x6B4D, 0x39C7, 0x18E3,
-  0x39C7, 0x2945, 0x2965, 0x5ACB, 0x6B6D, 0x8410, 0x94B2, 0xA534,
-  0xB5B6, 0xC638, 0xD69A, 0xDEFB, 0xEF5D, 0xF79E, 0xF7BE, 0xFFDF,
-  0xF7BE, 0xEF7D, 0xE73C, 0xDEFB, 0xD69A, 0xC618, 0xB596, 0x2104,
-  0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x0841, 0x0020, 0x18C3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x0841,
-  0x18C3, 0x39E7, 0x2965, 0x18E3, 0x528A, 0x632C, 0x7BCF, 0x8C71,
-  0x9CF3, 0xB596, 0xBDF7, 0xCE79, 0xDEDB, 0xE71C, 0xEF5D, 0xEF7D,
-  0xF79E, 0xEF7D, 0xEF5D, 0xE71C, 0xDEDB, 0xCE79, 0xBDF7, 0xB596,
-  0x4A69, 0x18E3, 0x4208, 0x4228, 0x31A6, 0x3186, 0x39C7, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x18E3, 0x2104, 0x2945, 0x3186, 0x39C7, 0x4208, 0x4A49,
-  0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x5ACB, 0x4A49, 0x39C7, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x39E7, 0x4208, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x39E7, 0x4208, 0x4228, 0x4A49, 0x630C,
-  0x7BCF, 0x8410, 0x8410, 0x8410, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x52AA, 0x4A69, 0x4228, 0x39E7, 0x31A6, 0x2965,
-  0x2124, 0x2965, 0x3186, 0x39E7, 0x632C, 0x632C, 0x2965, 0x2124,
-  0x39E7, 0x2965, 0x2124, 0x52AA, 0x6B4D, 0x7BEF, 0x9492, 0xA514,
-  0xB596, 0xC618, 0xCE79, 0xDEDB, 0xE71C, 0xEF5D, 0xEF7D, 0xF79E,
-  0xEF7D, 0xEF5D, 0xE71C, 0xD6BA, 0xCE59, 0xBDF7, 0xAD75, 0x31A6,
-  0x0841, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x0841,
-  0x18E3, 0x4208, 0x3186, 0x2104, 0x4208, 0x630C, 0x73AE, 0x8C51,
-  0x9CD3, 0xAD55, 0xB5B6, 0xC638, 0xCE79, 0xDEDB, 0xE71C, 0xE73C,
-  0xE73C, 0xE73C, 0xE71C, 0xDEDB, 0xD69A, 0xC638, 0xBDD7, 0xAD55,
-  0x4A69, 0x18E3, 0x4208, 0x4208, 0x4208, 0x3186, 0x3186, 0x39E7,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x2945, 0x3186, 0x39C7, 0x4208,
-  0x4A49, 0x4A69, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x632C, 0x5AEB, 0x4A69,
-  0x4208, 0x39C7, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7,
-  0x4208, 0x4228, 0x4A49, 0x4A69, 0x5AEB, 0x6B6D, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E,
-  0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x52AA, 0x528A, 0x4A49, 0x4208, 0x39C7, 0x3186, 0x2945, 0x2104,
-  0x2945, 0x3186, 0x31A6, 0x630C, 0x632C, 0x632C, 0x2945, 0x2945,
-  0x4208, 0x3186, 0x2104, 0x4A49, 0x632C, 0x7BCF, 0x8C51, 0x9CD3,
-  0xAD55, 0xBDD7, 0xC638, 0xD69A, 0xDEDB, 0xE71C, 0xE73C, 0xE73C,
-  0xE73C, 0xDEFB, 0xDEDB, 0xCE79, 0xC618, 0xB5B6, 0xA534, 0x31A6,
-  0x0841, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0841,
-  0x18E3, 0x4228, 0x31A6, 0x2124, 0x3186, 0x5ACB, 0x6B6D, 0x8410,
-  0x9492, 0xA514, 0xAD75, 0xBDD7, 0xC638, 0xCE79, 0xD6BA, 0xDEDB,
-  0xDEDB, 0xDEDB, 0xD6BA, 0xCE79, 0xC638, 0xBDD7, 0xAD75, 0xA514,
-  0x4208, 0x18E3, 0x4208, 0x4208, 0x4208, 0x39E7, 0x3186, 0x2945,
-  0x4228, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2124, 0x2965, 0x31A6,
-  0x39E7, 0x4208, 0x4A49, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x630C, 0x52AA, 0x3186, 0x3186, 0x4208, 0x4208, 0x39E7,
-  0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39E7, 0x39E7, 0x3186, 0x3186, 0x4228, 0x4A69, 0x4A69,
-  0x52AA, 0x630C, 0x6B6D, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x73AE, 0x738E, 0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C, 0x630C,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA,
-  0x4A69, 0x4228, 0x39E7, 0x31A6, 0x2965, 0x2124, 0x18E3, 0x2945,
-  0x2945, 0x3186, 0x5ACB, 0x632C, 0x632C, 0x630C, 0x2965, 0x2945,
-  0x4228, 0x31A6, 0x2124, 0x39C7, 0x5AEB, 0x738E, 0x8410, 0x9492,
-  0xA514, 0xB596, 0xBDF7, 0xC638, 0xCE79, 0xD6BA, 0xDEDB, 0xDEDB,
-  0xDEDB, 0xD6BA, 0xCE79, 0xC638, 0xBDD7, 0xAD75, 0x9CF3, 0x2965,
-  0x0841, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0861,
-  0x0861, 0x4A69, 0x39E7, 0x2965, 0x18E3, 0x4A69, 0x632C, 0x73AE,
-  0x8430, 0x94B2, 0xA514, 0xAD75, 0xBDD7, 0xC618, 0xCE59, 0xCE59,
-  0xCE79, 0xCE59, 0xCE59, 0xC618, 0xBDD7, 0xAD75, 0xA514, 0x94B2,
-  0x2945, 0x2124, 0x39E7, 0x4208, 0x4208, 0x39C7, 0x10A2, 0x0000,
-  0x2965, 0x4A49, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x2104, 0x2945,
-  0x3186, 0x39C7, 0x39E7, 0x4228, 0x4A69, 0x528A, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x528A, 0x3186, 0x3186, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x3186, 0x3186, 0x528A, 0x6B6D, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E,
-  0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x4A69, 0x4A49,
-  0x4208, 0x39C7, 0x3186, 0x2945, 0x2104, 0x18E3, 0x2124, 0x2965,
-  0x0000, 0x10A2, 0x5ACB, 0x632C, 0x630C, 0x630C, 0x39C7, 0x18E3,
-  0x4A49, 0x39C7, 0x2945, 0x2124, 0x528A, 0x632C, 0x7BCF, 0x8C51,
-  0x94B2, 0xA534, 0xB596, 0xBDD7, 0xC618, 0xCE59, 0xCE79, 0xCE79,
-  0xCE59, 0xC638, 0xC618, 0xBDD7, 0xAD75, 0xA514, 0x94B2, 0x10A2,
-  0x0841, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x1082,
-  0x0000, 0x4A69, 0x4228, 0x31A6, 0x2124, 0x31A6, 0x5ACB, 0x6B4D,
-  0x7BCF, 0x8C51, 0x94B2, 0xA514, 0xAD75, 0xB596, 0xBDD7, 0xBDF7,
-  0xBDF7, 0xBDF7, 0xBDD7, 0xB5B6, 0xAD75, 0xA514, 0x94B2, 0x8C51,
-  0x0841, 0x2965, 0x39E7, 0x39E7, 0x2104, 0x0020, 0x4A69, 0x4228,
-  0x10A2, 0x3186, 0x4A69, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x2124, 0x2945, 0x3186, 0x39C7, 0x4208, 0x4A49, 0x4A69, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x4A49, 0x3186, 0x39E7, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x39E7, 0x3186, 0x4A69, 0x73AE, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x738E, 0x738E,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A49, 0x4208, 0x39E7,
-  0x31A6, 0x2965, 0x2124, 0x18E3, 0x18E3, 0x2124, 0x3186, 0x1082,
-  0x18E3, 0x2104, 0x0020, 0x3186, 0x5AEB, 0x5AEB, 0x4A49, 0x0841,
-  0x528A, 0x4208, 0x3186, 0x2104, 0x39C7, 0x5ACB, 0x6B6D, 0x7BEF,
-  0x8C51, 0x9CD3, 0xA514, 0xAD75, 0xB5B6, 0xBDD7, 0xBDF7, 0xBDF7,
-  0xBDF7, 0xBDD7, 0xB596, 0xAD55, 0xA514, 0x94B2, 0x8410, 0x0000,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x0841, 0x39C7, 0x4A49, 0x39E7, 0x2965, 0x2104, 0x4208, 0x5AEB,
-  0x6B6D, 0x7BCF, 0x8C51, 0x9492, 0x9CF3, 0xA534, 0xAD55, 0xAD75,
-  0xAD75, 0xAD75, 0xAD55, 0xA534, 0x9CF3, 0x9492, 0x8C51, 0x5AEB,
-  0x0020, 0x39C7, 0x2945, 0x0861, 0x2104, 0x8C71, 0xB596, 0xAD75,
-  0x0861, 0x2104, 0x31A6, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x2124, 0x2965, 0x31A6, 0x39C7, 0x4208, 0x4A49,
-  0x4A69, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x4208, 0x3186, 0x4208, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x4228, 0x3186, 0x4228, 0x738E, 0x738E,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x738E, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x632C, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x52AA, 0x52AA, 0x528A, 0x4A49, 0x4228, 0x39E7, 0x31A6, 0x3186,
-  0x2945, 0x2104, 0x18E3, 0x2104, 0x2124, 0x3186, 0x2104, 0x0020,
-  0x4A49, 0x4A49, 0x31A6, 0x0861, 0x0861, 0x4228, 0x5ACB, 0x0841,
-  0x4228, 0x4A49, 0x39C7, 0x2965, 0x18E3, 0x4228, 0x5AEB, 0x6B6D,
-  0x7BEF, 0x8C51, 0x94B2, 0x9CF3, 0xA534, 0xAD55, 0xAD75, 0xAD75,
-  0xAD75, 0xAD55, 0xA514, 0x9CF3, 0x9492, 0x8430, 0x4A69, 0x0841,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x0861, 0x1082, 0x52AA, 0x4228, 0x39C7, 0x2945, 0x2104, 0x4A49,
-  0x5AEB, 0x6B6D, 0x7BCF, 0x8410, 0x8C71, 0x9492, 0x9CD3, 0x9CD3,
-  0x9CF3, 0x9CD3, 0x9CD3, 0x9492, 0x8C71, 0x8410, 0x7BCF, 0x2124,
-  0x10A2, 0x10A2, 0x0841, 0x630C, 0xA534, 0xAD55, 0xB596, 0xB5B6,
-  0x73AE, 0x0861, 0x3186, 0x31A6, 0x4A69, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x2104, 0x2945, 0x2965, 0x31A6, 0x39E7,
-  0x4208, 0x4A49, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x31A6, 0x3186, 0x4A49, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x4A69, 0x3186, 0x39C7, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA,
-  0x4A69, 0x4A49, 0x4228, 0x39E7, 0x39C7, 0x3186, 0x2945, 0x2104,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x3186, 0x3186, 0x0841, 0x3186,
-  0x4A69, 0x4228, 0x39E7, 0x31A6, 0x18E3, 0x0020, 0x18E3, 0x2124,
-  0x2104, 0x528A, 0x4228, 0x31A6, 0x2945, 0x2124, 0x4A69, 0x630C,
-  0x6B6D, 0x7BCF, 0x8430, 0x8C71, 0x94B2, 0x9CD3, 0x9CD3, 0x9CF3,
-  0x9CD3, 0x9CD3, 0x9492, 0x8C51, 0x8410, 0x73AE, 0x10A2, 0x0841,
-  0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2,
-  0x10A2, 0x0020, 0x39E7, 0x4A69, 0x4208, 0x31A6, 0x2945, 0x2124,
-  0x4228, 0x5ACB, 0x632C, 0x738E, 0x7BCF, 0x8410, 0x8430, 0x8C51,
-  0x8C51, 0x8C51, 0x8430, 0x8410, 0x7BCF, 0x738E, 0x528A, 0x0000,
-  0x0020, 0x31A6, 0x8C71, 0x9CF3, 0xA514, 0xA534, 0xAD75, 0xB596,
-  0xB5B6, 0x2945, 0x18E3, 0x3186, 0x31A6, 0x528A, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x2104, 0x2945, 0x2965,
-  0x31A6, 0x39C7, 0x4208, 0x4228, 0x4A69, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x52AA, 0x3186, 0x3186, 0x4A69, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x6B4D, 0x52AA, 0x3186, 0x3186, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A49,
-  0x4208, 0x39E7, 0x31A6, 0x3186, 0x2945, 0x2124, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2124, 0x3186, 0x3186, 0x18E3, 0x10A2, 0x528A,
-  0x4A49, 0x4208, 0x39C7, 0x3186, 0x2945, 0x18E3, 0x0861, 0x0020,
-  0x0000, 0x4228, 0x4A69, 0x4208, 0x3186, 0x2124, 0x2945, 0x4A49,
-  0x5AEB, 0x6B4D, 0x738E, 0x7BCF, 0x8410, 0x8430, 0x8C51, 0x8C51,
-  0x8C51, 0x8430, 0x8410, 0x7BCF, 0x738E, 0x4228, 0x0020, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x0861, 0x0020, 0x528A, 0x4A69, 0x4208, 0x31A6, 0x2945,
-  0x18E3, 0x39C7, 0x52AA, 0x5AEB, 0x632C, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x738E, 0x6B6D, 0x632C, 0x4228, 0x0841, 0x10A2,
-  0x6B4D, 0x9492, 0x94B2, 0x9CD3, 0x9CF3, 0xA534, 0xAD55, 0xAD75,
-  0xAD75, 0x528A, 0x0000, 0x2965, 0x3186, 0x31A6, 0x528A, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x2104,
-  0x2945, 0x2965, 0x31A6, 0x39C7, 0x4208, 0x4228, 0x4A49, 0x4A69,
-  0x528A, 0x4A69, 0x3186, 0x3186, 0x528A, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x630C, 0x632C, 0x5AEB, 0x3186, 0x3186, 0x5ACB, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x52AA, 0x52AA, 0x52AA, 0x528A, 0x4A49, 0x4228, 0x4208, 0x39E7,
-  0x31A6, 0x3186, 0x2945, 0x2124, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x3186, 0x3186, 0x3186, 0x0000, 0x2124, 0x4A49,
-  0x4228, 0x39E7, 0x31A6, 0x2965, 0x2124, 0x18E3, 0x2965, 0x2965,
-  0x0861, 0x0020, 0x4208, 0x4A49, 0x39E7, 0x3186, 0x2124, 0x2104,
-  0x39E7, 0x52AA, 0x630C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x738E, 0x6B6D, 0x632C, 0x52AA, 0x0020, 0x0861, 0x1082,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3,
-  0x10A2, 0x10A2, 0x0841, 0x1082, 0x52AA, 0x4A69, 0x4208, 0x31A6,
-  0x2965, 0x2104, 0x2945, 0x39E7, 0x528A, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x5AEB, 0x528A, 0x2104, 0x0020, 0x4228, 0x8410,
-  0x8C51, 0x8C71, 0x9492, 0x94B2, 0x9CD3, 0xA514, 0xA534, 0x8410,
-  0x18E3, 0x1082, 0x3186, 0x4208, 0x31A6, 0x3186, 0x31A6, 0x528A,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x2104, 0x2124, 0x2965, 0x3186, 0x39C7, 0x39E7, 0x4208,
-  0x4228, 0x4208, 0x3186, 0x3186, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x5AEB, 0x3186, 0x3186, 0x528A, 0x630C,
-  0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA,
-  0x528A, 0x4A69, 0x4A49, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x2965,
-  0x2945, 0x2124, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2945, 0x3186, 0x3186, 0x31A6, 0x5AEB, 0x4A49, 0x1082, 0x0861,
-  0x3186, 0x39C7, 0x3186, 0x2945, 0x2104, 0x2945, 0x31A6, 0x4228,
-  0x528A, 0x31A6, 0x0020, 0x2104, 0x4228, 0x39E7, 0x31A6, 0x2945,
-  0x2104, 0x2965, 0x4208, 0x528A, 0x5ACB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x5AEB, 0x5ACB, 0x4A49, 0x0841, 0x0020, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x0841, 0x1082, 0x528A, 0x4A69, 0x4228,
-  0x39C7, 0x3186, 0x2945, 0x2104, 0x2104, 0x2965, 0x39C7, 0x39E7,
-  0x4208, 0x39E7, 0x2104, 0x0020, 0x2104, 0x6B4D, 0x7BCF, 0x7BEF,
-  0x8430, 0x8C51, 0x8C71, 0x9492, 0x94B2, 0x9492, 0x39E7, 0x0020,
-  0x2104, 0x39E7, 0x4208, 0x4208, 0x4208, 0x31A6, 0x3186, 0x31A6,
-  0x4A69, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x2104, 0x2124, 0x2945, 0x3186, 0x31A6,
-  0x39C7, 0x39C7, 0x3186, 0x31A6, 0x4A49, 0x4A69, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x39C7, 0x3186, 0x4228, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4228, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x2965, 0x2124, 0x2104,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x3186, 0x3186, 0x39C7, 0x5AEB, 0x630C, 0x5AEB, 0x5AEB, 0x3186,
-  0x0020, 0x10A2, 0x2945, 0x2124, 0x2104, 0x3186, 0x39E7, 0x4A69,
-  0x5AEB, 0x6B4D, 0x6B6D, 0x2945, 0x0841, 0x2965, 0x4208, 0x39C7,
-  0x3186, 0x2945, 0x2104, 0x2104, 0x3186, 0x39C7, 0x39E7, 0x4208,
-  0x39E7, 0x39C7, 0x2945, 0x0020, 0x0020, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0841, 0x0020, 0x39C7, 0x528A,
-  0x4A49, 0x4208, 0x39C7, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124,
-  0x18E3, 0x0841, 0x0841, 0x4A49, 0x6B4D, 0x738E, 0x73AE, 0x7BCF,
-  0x7BEF, 0x8430, 0x8C51, 0x8C71, 0x5ACB, 0x0841, 0x10A2, 0x31A6,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x31A6, 0x3186,
-  0x3186, 0x4A49, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2124,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x39E7, 0x4208, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x39E7, 0x3186, 0x39E7, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4228, 0x4208, 0x39E7, 0x39C7,
-  0x31A6, 0x3186, 0x2965, 0x2945, 0x2124, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x3186,
-  0x3186, 0x39C7, 0x5AEB, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x4A69, 0x18C3, 0x0020, 0x1082, 0x2945, 0x39C7, 0x4A49, 0x52AA,
-  0x632C, 0x73AE, 0x8410, 0x9492, 0x73AE, 0x10A2, 0x10A2, 0x39C7,
-  0x39E7, 0x39C7, 0x3186, 0x2965, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2124, 0x18C3, 0x0000, 0x0020, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0861,
-  0x3186, 0x4A49, 0x4A49, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x10A2,
-  0x0000, 0x2945, 0x5ACB, 0x630C, 0x632C, 0x6B4D, 0x738E, 0x73AE,
-  0x7BCF, 0x8410, 0x6B4D, 0x18E3, 0x0841, 0x2124, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x31A6,
-  0x3186, 0x3186, 0x4228, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x3186, 0x3186, 0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x4208, 0x3186, 0x31A6, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4228,
-  0x4228, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x2965,
-  0x2945, 0x2124, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2965, 0x3186, 0x3186,
-  0x39E7, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x52AA, 0x52AA, 0x39E7, 0x0841, 0x0861, 0x31A6, 0x528A, 0x630C,
-  0x6B6D, 0x7BEF, 0x8C51, 0x9CD3, 0xAD55, 0xB596, 0x632C, 0x0020,
-  0x2104, 0x4228, 0x4208, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x18E3,
-  0x0841, 0x0000, 0x0841, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841,
-  0x0841, 0x0000, 0x0841, 0x1082, 0x10A2, 0x0861, 0x0000, 0x0861,
-  0x31A6, 0x4A49, 0x52AA, 0x5ACB, 0x630C, 0x632C, 0x6B6D, 0x738E,
-  0x738E, 0x31A6, 0x0020, 0x18C3, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x39C7, 0x3186, 0x3186, 0x39E7, 0x528A, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x3186, 0x3186, 0x2124, 0x2104, 0x2124, 0x2945, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4208, 0x3186, 0x3186, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x2965, 0x2945, 0x2124, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186, 0x3186, 0x4208,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA,
-  0x528A, 0x528A, 0x528A, 0x4A69, 0x2945, 0x0020, 0x2124, 0x630C,
-  0x73AE, 0x8430, 0x94B2, 0xA514, 0xB596, 0xBDF7, 0xBDF7, 0x9492,
-  0x2945, 0x0020, 0x0861, 0x10A2, 0x1082, 0x0020, 0x0000, 0x0020,
-  0x0841, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0841, 0x0020, 0x0000, 0x0020, 0x10A2, 0x2124,
-  0x3186, 0x4208, 0x4A69, 0x52AA, 0x5AEB, 0x630C, 0x632C, 0x4228,
-  0x0841, 0x0861, 0x2124, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x39C7, 0x3186, 0x3186, 0x39C7, 0x528A, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x3186, 0x3186, 0x2124, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2124, 0x2945, 0x2945, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x3186, 0x3186, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x3186, 0x3186, 0x3186, 0x4A49, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x528A,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4208, 0x10A2, 0x0841,
-  0x528A, 0x8C71, 0x9CF3, 0xAD55, 0xBDD7, 0xCE59, 0xB596, 0x9CF3,
-  0x8C51, 0x4A69, 0x0841, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x0861, 0x0841, 0x0000, 0x10A2, 0x2124, 0x2124, 0x18E3,
-  0x2124, 0x31A6, 0x4208, 0x4A69, 0x5ACB, 0x4A69, 0x10A2, 0x0020,
-  0x18C3, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x3186, 0x3186, 0x31A6, 0x4A49, 0x528A,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2124,
-  0x2945, 0x3186, 0x3186, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x528A, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x3186,
-  0x0841, 0x2124, 0x8C51, 0xB5B6, 0xC618, 0xBDD7, 0xA534, 0x9492,
-  0x7BEF, 0x632C, 0x4A69, 0x18E3, 0x0000, 0x0020, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x0861, 0x0020, 0x0861, 0x2965, 0x3186, 0x2965, 0x2945, 0x2104,
-  0x18E3, 0x2945, 0x31A6, 0x4208, 0x2124, 0x0000, 0x1082, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x31A6, 0x3186, 0x3186, 0x39E7,
-  0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2965, 0x3186, 0x3186, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x3186, 0x3186, 0x2945,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x39C7, 0x5ACB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228,
-  0x39E7, 0x2104, 0x0020, 0x5ACB, 0xBDD7, 0xAD75, 0x9CD3, 0x8430,
-  0x6B6D, 0x5ACB, 0x4228, 0x3186, 0x18C3, 0x0841, 0x0000, 0x0841,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x0841,
-  0x0020, 0x2945, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x2945, 0x2124,
-  0x2104, 0x18E3, 0x18E3, 0x0020, 0x0841, 0x18C3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x39C7, 0x3186, 0x3186,
-  0x31A6, 0x4A49, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2965, 0x3186, 0x2965,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x4228, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x39E7, 0x3186, 0x10A2, 0x1082, 0x738E, 0x8C71, 0x7BCF,
-  0x630C, 0x4A69, 0x39C7, 0x2124, 0x2104, 0x2124, 0x18C3, 0x0000,
-  0x0020, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x0861, 0x0000, 0x2104,
-  0x4228, 0x4228, 0x4208, 0x39E7, 0x39C7, 0x3186, 0x2965, 0x2945,
-  0x2104, 0x0841, 0x0000, 0x10A2, 0x2104, 0x2104, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4208, 0x31A6,
-  0x3186, 0x3186, 0x39E7, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2965, 0x3186, 0x2965,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x528A, 0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x2124, 0x0841, 0x2124, 0x5AEB,
-  0x52AA, 0x4208, 0x2965, 0x18E3, 0x2104, 0x2124, 0x2945, 0x2965,
-  0x10A2, 0x0000, 0x0861, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x0861, 0x18C3, 0x528A,
-  0x4A69, 0x4A49, 0x4228, 0x4208, 0x39E7, 0x31A6, 0x3186, 0x18C3,
-  0x0000, 0x0861, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x39C7, 0x3186, 0x3186, 0x31A6, 0x4228, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x3186, 0x3186,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x4208,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x528A,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x3186, 0x1082, 0x0000,
-  0x2124, 0x31A6, 0x2104, 0x2104, 0x2124, 0x2945, 0x2965, 0x3186,
-  0x31A6, 0x1082, 0x0841, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x0020, 0x39E7,
-  0x528A, 0x4A69, 0x4A49, 0x4228, 0x39E7, 0x2945, 0x0020, 0x0020,
-  0x0841, 0x0861, 0x2104, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4208, 0x31A6, 0x3186, 0x3186, 0x39C7, 0x4A49, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x3186, 0x3186,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x528A, 0x5ACB,
-  0x5ACB, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x2945, 0x0841, 0x0841,
-  0x0020, 0x0020, 0x10A2, 0x2124, 0x2945, 0x2965, 0x3186, 0x31A6,
-  0x2945, 0x0000, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x1082, 0x0861,
-  0x528A, 0x528A, 0x4A69, 0x4208, 0x10A2, 0x0000, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x3186, 0x3186, 0x3186, 0x39E7,
-  0x4A69, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x4228, 0x52AA, 0x5ACB, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x2945, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x0841, 0x0000, 0x0861, 0x2124, 0x2965, 0x3186, 0x31A6,
-  0x0841, 0x0861, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x0841,
-  0x2965, 0x528A, 0x2965, 0x0000, 0x0841, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4208, 0x39C7, 0x3186, 0x3186,
-  0x3186, 0x39E7, 0x4A69, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x31A6,
-  0x3186, 0x3186, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x4208, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x528A, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x2945, 0x0861, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0020, 0x0000, 0x18C3, 0x3186, 0x18E3,
-  0x0020, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x39C7, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x10A2,
-  0x0000, 0x0861, 0x0020, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4208, 0x39C7,
-  0x3186, 0x3186, 0x3186, 0x39E7, 0x4A49, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x31A6,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x39E7, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x31A6, 0x3186, 0x2945, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x1082, 0x0861, 0x0020, 0x0841, 0x0000,
-  0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x0861, 0x0861, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4208, 0x39C7, 0x3186, 0x3186, 0x3186, 0x39C7, 0x4228, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x31A6,
-  0x3186, 0x31A6, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x39E7, 0x4A69,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x2945, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x0861, 0x0861,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4208, 0x39C7, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x4208, 0x4A49, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x3186,
-  0x3186, 0x39C7, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x39E7, 0x4A69, 0x52AA, 0x52AA,
-  0x52AA, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2945, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x39E7, 0x31A6, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x4208, 0x4A49, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x3186,
-  0x3186, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x3186,
-  0x3186, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x4208, 0x528A, 0x52AA, 0x52AA, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2945,
-  0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x2104, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x39C7, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39E7, 0x4228,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4208, 0x3186,
-  0x3186, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x3186,
-  0x3186, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x39E7,
-  0x4A49, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2124, 0x0841,
-  0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0841, 0x18E3, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x39E7, 0x39C7, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x39C7, 0x4208, 0x4228, 0x4A49, 0x4A69, 0x4208, 0x3186,
-  0x31A6, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x3186,
-  0x3186, 0x39C7, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x31A6, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x39C7, 0x4228, 0x528A, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x18E3, 0x0841, 0x0841,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0841, 0x18C3, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x39C7, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x3186,
-  0x31A6, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x31A6,
-  0x3186, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x39E7, 0x4228, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x18C3, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x10A2, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x39E7, 0x39C7, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39E7, 0x4228, 0x4A69,
-  0x528A, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x10A2, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2945, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x18E3,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x3186, 0x3186,
-  0x4208, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4228,
-  0x3186, 0x3186, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2104, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4A49, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,
-  0x18C3, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x3186, 0x3186,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x3186, 0x3186, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x18C3,
-  0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x2104, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x39C7, 0x3186, 0x3186,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x3186, 0x3186, 0x39E7, 0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2124, 0x0861, 0x0841,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x18C3, 0x2945, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x31A6, 0x3186, 0x31A6,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x31A6, 0x3186, 0x39C7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x18E3, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0841, 0x1082, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x31A6, 0x3186, 0x31A6,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x39C7, 0x3186, 0x31A6, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2124, 0x1082, 0x0841, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x18C3, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x3186, 0x3186, 0x31A6,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x39C7, 0x3186, 0x3186, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x18C3, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x1082,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x3186, 0x3186, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x3186, 0x3186, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2104,
-  0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0841, 0x10A2, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39E7, 0x3186, 0x3186, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x10A2, 0x0841,
-  0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228,
-  0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x18C3, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x18C3, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945,
-  0x2945, 0x2945, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x18E3, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39C7, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x18C3, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x18E3,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2124,
-  0x18C3, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4A69,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,
-  0x0861, 0x18C3, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x18C3, 0x0861,
-  0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69,
-  0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0841, 0x0861, 0x18C3, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x3186, 0x3186, 0x2965, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2104, 0x10A2, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x4A69,
-  0x4A69, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x10A2, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x3186, 0x3186, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x18E3, 0x1082, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A,
-  0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4208, 0x4208,
-  0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861,
-  0x18C3, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2945, 0x3186, 0x3186, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x10A2,
-  0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A,
-  0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228,
-  0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6,
-  0x31A6, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0841, 0x0841, 0x1082, 0x18E3, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2945, 0x3186, 0x2965, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x3186, 0x3186, 0x2965, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2104, 0x18C3, 0x1082, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA,
-  0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 0x4228,
-  0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7,
-  0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x2965, 0x2965, 0x2965,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x1082, 0x18E3, 0x2104,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18E3, 0x2965, 0x3186, 0x2965, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2965, 0x3186, 0x2965, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18C3, 0x1082, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB,
-  0x52AA, 0x52AA, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49,
-  0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7,
-  0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965, 0x2965,
-  0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x18C3, 0x18E3, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x3186, 0x3186, 0x2945, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x3186, 0x3186, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18C3, 0x10A2, 0x0861,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB,
-  0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49,
-  0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7,
-  0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124,
-  0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0841, 0x0841, 0x0861, 0x1082, 0x10A2, 0x18E3, 0x2104,
-  0x2124, 0x2104, 0x2104, 0x3186, 0x3186, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x3186, 0x3186, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18C3, 0x10A2, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB,
-  0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69, 0x4A69,
-  0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x39E7,
-  0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186,
-  0x3186, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2124,
-  0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x1082, 0x18C3, 0x2945, 0x2965, 0x2124, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2965, 0x2945, 0x10A2, 0x0861, 0x0861,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB,
-  0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x52AA, 0x528A, 0x528A, 0x4A69,
-  0x4A69, 0x4A49, 0x4A49, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208,
-  0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6,
-  0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x1082,
-  0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082,
-  0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,
-  0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C };
+extern const uint16_t sclera[SCLERA_HEIGHT * SCLERA_WIDTH] asm("terminatorEye_sclera");
 
 #define IRIS_MAP_WIDTH  256
 #define IRIS_MAP_HEIGHT 64
 
-const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] PROGMEM= {
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x52AA, 0x4228, 0x0861, 0x1082,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A69, 0x5ACB,
-  0x31A6, 0x0841, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4A49, 0x4A69, 0x52AA, 0x2104, 0x0841, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4228, 0x4228, 0x528A, 0x4208, 0x0861, 0x1082,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x5ACB,
-  0x31A6, 0x0841, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x5ACB, 0x2124, 0x0841, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x5AEB, 0x2945, 0x0841,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x52AA,
-  0x4A69, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x5AEB, 0x39E7, 0x0841, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x528A, 0x5AEB, 0x2124, 0x0841,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x52AA,
-  0x528A, 0x10A2, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x5AEB, 0x4208, 0x0841, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x5AEB, 0x4A69, 0x0861,
-  0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x630C, 0x2965, 0x0020, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x52AA, 0x52AA, 0x18C3, 0x0861, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x5AEB, 0x4A49, 0x0861,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x630C, 0x3186, 0x0020, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x52AA, 0x5ACB, 0x18E3, 0x0861, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x52AA, 0x630C, 0x2124,
-  0x0841, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x5AEB, 0x4A69, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x632C, 0x31A6, 0x0020, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x528A, 0x52AA, 0x5AEB, 0x2104,
-  0x0841, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x5AEB, 0x528A, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x632C, 0x39C7, 0x0020, 0x10A2, 0x10A2,
-  0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x52AA, 0x632C, 0x4228,
-  0x0841, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x6B4D, 0x2965, 0x0841, 0x18C3, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x528A, 0x528A, 0x5AEB, 0x52AA, 0x10A2, 0x1082, 0x10A2,
-  0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x52AA, 0x632C, 0x4208,
-  0x0841, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x6B4D, 0x3186, 0x0841, 0x18C3, 0x10A2, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x528A, 0x528A, 0x5AEB, 0x5ACB, 0x18C3, 0x1082, 0x10A2,
-  0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x5AEB, 0x5AEB,
-  0x18E3, 0x0861, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x632C, 0x4A49, 0x0861, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x528A, 0x52AA, 0x52AA, 0x6B4D, 0x31A6, 0x0841, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x5AEB, 0x5AEB,
-  0x18C3, 0x0861, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x632C, 0x4A69, 0x0861, 0x10A2, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x528A, 0x52AA, 0x52AA, 0x6B4D, 0x39E7, 0x0841, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x6B4D,
-  0x4208, 0x0841, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x5AEB, 0x632C, 0x2124, 0x0861, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x52AA, 0x52AA, 0x632C, 0x52AA, 0x1082, 0x10A2,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x6B4D,
-  0x39E7, 0x0841, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x5ACB, 0x6B4D, 0x2945, 0x0841, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x52AA, 0x52AA, 0x630C, 0x5ACB, 0x10A2, 0x1082,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x630C,
-  0x632C, 0x18E3, 0x1082, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x6B6D, 0x4228, 0x0841, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x6B4D, 0x2965, 0x0841,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x630C,
-  0x630C, 0x18E3, 0x1082, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x6B6D, 0x4A49, 0x0861, 0x18C3, 0x18C3, 0x18C3,
-  0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x6B6D, 0x31A6, 0x0841,
-  0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB,
-  0x738E, 0x39E7, 0x0841, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA,
-  0x5ACB, 0x5ACB, 0x630C, 0x6B4D, 0x2124, 0x0861, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x6B6D, 0x4A69, 0x0861,
-  0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB,
-  0x738E, 0x39C7, 0x0841, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA,
-  0x5ACB, 0x5ACB, 0x630C, 0x6B6D, 0x2945, 0x0861, 0x18C3, 0x18C3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x6B4D, 0x52AA, 0x1082,
-  0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x6B4D, 0x5AEB, 0x18C3, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x738E, 0x4A49, 0x0861, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x6B6D, 0x2945,
-  0x0861, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x6B4D, 0x5AEB, 0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x738E, 0x4A69, 0x0861, 0x18E3, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x738E, 0x3186,
-  0x0861, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x73AE, 0x39C7, 0x0861, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x6B4D, 0x632C, 0x2104, 0x10A2, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x738E, 0x528A,
-  0x1082, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x630C, 0x738E, 0x31A6, 0x0861, 0x18E3, 0x18E3, 0x18E3, 0x18E3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x632C, 0x6B4D, 0x2124, 0x1082, 0x18E3,
-  0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x738E, 0x5ACB,
-  0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x6B6D, 0x630C, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x73AE, 0x4208, 0x0861, 0x2104,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x738E,
-  0x2945, 0x1082, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x738E, 0x630C, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x7BCF, 0x4228, 0x0861, 0x18E3,
-  0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x73AE,
-  0x3186, 0x1082, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x7BCF, 0x39E7, 0x0861, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B6D, 0x632C, 0x18E3, 0x18C3,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x7BCF,
-  0x4A69, 0x0861, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x7BCF, 0x39C7, 0x0861, 0x2104, 0x2104, 0x2104,
-  0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x6B6D, 0x6B6D, 0x2104, 0x10A2,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x73AE,
-  0x52AA, 0x1082, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x73AE, 0x630C, 0x18C3, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x7BEF, 0x4228, 0x0861,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x6B6D,
-  0x738E, 0x2124, 0x10A2, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x73AE, 0x5AEB, 0x10A2, 0x18E3, 0x2104, 0x2104,
-  0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x7BEF, 0x4A69, 0x1082,
-  0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x6B4D,
-  0x73AE, 0x2965, 0x10A2, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x7BEF, 0x31A6, 0x1082, 0x2124, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x738E, 0x6B4D, 0x2104,
-  0x18E3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x7BEF, 0x52AA, 0x1082, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x7BCF, 0x31A6, 0x1082, 0x2124, 0x2104,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x6B4D, 0x738E, 0x738E, 0x2124,
-  0x18C3, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x7BCF, 0x5AEB, 0x10A2, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x7BCF, 0x630C, 0x18C3, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x8410, 0x4228,
-  0x1082, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x738E, 0x73AE, 0x2965, 0x18C3, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x7BCF, 0x5AEB, 0x18C3, 0x2104, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x8410, 0x4A49,
-  0x1082, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x6B6D, 0x7BCF, 0x3186, 0x10A2, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x8410, 0x4208, 0x10A2, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x7BCF, 0x6B4D,
-  0x18E3, 0x2104, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B6D, 0x8410, 0x528A, 0x10A2, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x8410, 0x39E7, 0x10A2, 0x2124,
-  0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x73AE, 0x738E,
-  0x2124, 0x18E3, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B6D, 0x8410, 0x5ACB, 0x10A2, 0x2124, 0x2124, 0x2124, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x7BEF, 0x6B4D, 0x18E3, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x8410,
-  0x4A49, 0x10A2, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B6D, 0x73AE, 0x7BCF, 0x2945, 0x18E3, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x7BEF, 0x632C, 0x18E3, 0x2124,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x8410,
-  0x528A, 0x10A2, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B6D, 0x738E, 0x7BEF, 0x3186, 0x18C3, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x8430, 0x4208, 0x10A2,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x7BEF,
-  0x73AE, 0x2124, 0x2104, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x738E, 0x8430, 0x5ACB, 0x18C3, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x8410, 0x39E7, 0x18C3,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x7BCF,
-  0x7BCF, 0x2965, 0x18E3, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x738E, 0x8410, 0x630C, 0x18E3, 0x2124, 0x2945, 0x2945,
-  0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x8410, 0x6B4D, 0x2104,
-  0x2124, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x8C51, 0x4A69, 0x18C3, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x738E, 0x7BCF, 0x8410, 0x31A6, 0x18E3, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x8410, 0x6B4D, 0x18E3,
-  0x2124, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x8430, 0x52AA, 0x18C3, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x738E, 0x73AE, 0x8430, 0x39E7, 0x18C3, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x8C51, 0x4A69,
-  0x18C3, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x7BEF, 0x7BCF, 0x2945, 0x2124, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x8C51, 0x630C, 0x18E3, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x8C51, 0x4A49,
-  0x18C3, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E,
-  0x7BEF, 0x7BEF, 0x3186, 0x2104, 0x2965, 0x2965, 0x2965, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x8430, 0x6B4D, 0x18E3, 0x2945, 0x2965,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x8410, 0x7BCF,
-  0x2945, 0x2124, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x8C51, 0x5ACB, 0x18E3, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x8430, 0x39C7, 0x2104, 0x3186,
-  0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x8410, 0x73AE,
-  0x2945, 0x2945, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x8C51, 0x632C, 0x18E3, 0x2965, 0x2965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x8C51, 0x4208, 0x18E3, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x8C71,
-  0x528A, 0x18E3, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x7BEF, 0x8430, 0x31A6, 0x2124, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x8C51, 0x6B4D, 0x2104, 0x2965,
-  0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x8C71,
-  0x528A, 0x18E3, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x7BEF, 0x8C51, 0x39E7, 0x2104, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x8430, 0x738E, 0x2945, 0x2945,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x8410,
-  0x8410, 0x31A6, 0x2945, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x8C71, 0x632C, 0x2104, 0x3186, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x8C71, 0x4A49, 0x2104,
-  0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x8430,
-  0x7BEF, 0x3186, 0x2945, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x8C71, 0x6B6D, 0x2104, 0x2965, 0x3186, 0x31A6,
-  0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x9492, 0x52AA, 0x18E3,
-  0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x9492, 0x6B4D, 0x2104, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x8410, 0x8C51, 0x4208, 0x2124, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x8C51, 0x7BCF, 0x2965,
-  0x2965, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x9492, 0x632C, 0x2104, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BEF, 0x8C71, 0x4A49, 0x2104, 0x31A6, 0x31A6,
-  0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x8430, 0x8410, 0x3186,
-  0x2965, 0x39C7, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x8410, 0x8C71, 0x4228, 0x2124, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x8C71, 0x7BCF, 0x2965, 0x3186, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x9492, 0x52AA,
-  0x2104, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x8410, 0x8C71, 0x4208, 0x2124, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8C51, 0x8410, 0x3186, 0x2965, 0x31A6,
-  0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x9492, 0x630C,
-  0x4228, 0x2965, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x9492, 0x73AE, 0x2945, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x94B2, 0x5ACB, 0x2124, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8C51, 0x8430,
-  0x39C7, 0x2965, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x9492, 0x738E, 0x2945, 0x31A6, 0x39C7, 0x39C7, 0x39C7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x94B2, 0x630C, 0x2124, 0x39C7,
-  0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8430,
-  0x7BCF, 0x2965, 0x31A6, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x94B2, 0x5ACB, 0x2945, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8C51, 0x8C51, 0x39C7, 0x2965,
-  0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x94B2,
-  0x738E, 0x2945, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x94B2, 0x52AA, 0x2945, 0x39C7, 0x39C7, 0x39E7,
-  0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8430, 0x8C71, 0x39E7, 0x2965,
-  0x39E7, 0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8430,
-  0x94B2, 0x5ACB, 0x2945, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8C71, 0x8C71, 0x39E7, 0x3186, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x94B2, 0x6B6D, 0x2965,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8430,
-  0x94B2, 0x528A, 0x2945, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8C71, 0x8C71, 0x39E7, 0x3186, 0x39E7, 0x39E7,
-  0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x9492, 0x73AE, 0x3186,
-  0x39C7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410,
-  0x8C71, 0x8C71, 0x4208, 0x3186, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x94B2, 0x738E, 0x2965, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x9CD3, 0x52AA,
-  0x2965, 0x4208, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x9492, 0x8430, 0x39C7, 0x31A6, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x94B2, 0x738E, 0x2965, 0x39E7, 0x39E7,
-  0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x9CD3, 0x630C,
-  0x2945, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8410, 0x9CD3, 0x7BEF, 0x31A6, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8430, 0x8C51, 0x94B2, 0x5ACB, 0x2965, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x9492, 0x8C51,
-  0x39C7, 0x31A6, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x9CD3, 0x738E, 0x3186, 0x39E7, 0x4208, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8430, 0x8C51, 0x94B2, 0x52AA, 0x2965, 0x4208,
-  0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8C71, 0x9492,
-  0x4208, 0x3186, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x9CD3, 0x630C, 0x2965, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8430, 0x8430, 0x9492, 0x9492, 0x4228, 0x31A6,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x9CD3,
-  0x738E, 0x3186, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x8C51, 0x9CD3, 0x52AA, 0x3186, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8430, 0x8430, 0x9492, 0x9492, 0x4228, 0x31A7,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x9CD3,
-  0x7BEF, 0x31A6, 0x39E7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x9492, 0x94B2, 0x4A69, 0x31C7, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x9CD3, 0x7BEF, 0x31A6,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x9CF3, 0x62EC, 0x3186, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x94B2, 0x8C71, 0x4208, 0x39C7, 0x4228, 0x4228,
-  0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8430, 0x8430, 0x8430, 0x9CD3, 0x7BEF, 0x31A6,
-  0x4208, 0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x9CF3, 0x6B4D, 0x31A6, 0x4228, 0x4228, 0x4228, 0x4A49, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x9CD3, 0x8C50, 0x4208, 0x3A08, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x9CD3, 0x6B2C,
-  0x31C7, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69,
-  0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x9492, 0x9492, 0x4A49, 0x39C7, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x9CD3, 0x83EF, 0x39E7, 0x4208, 0x4A49,
-  0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x9CD3, 0x6B2C,
-  0x31C7, 0x4228, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x9492, 0x9CB2, 0x528A, 0x31C7, 0x4A49, 0x4A49, 0x4A49, 0x4A49,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0xA4D2, 0x7B8E, 0x31C7, 0x4228,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x9492, 0xA4B2,
-  0x5ACA, 0x39E7, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x9CD2, 0x8BEF, 0x3A08, 0x4208, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0xA4D3, 0x734C, 0x31C7, 0x4A49,
-  0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x9492, 0xA4B2,
-  0x5AAA, 0x39E7, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x9CB2, 0x9450, 0x4A28, 0x3A08, 0x4A49, 0x4A49, 0x4A69,
-  0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x9471, 0xA491, 0x6B0B, 0x39E8,
-  0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x9C91,
-  0x9C50, 0x4A49, 0x3A08, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C71, 0x8C71, 0xA4B2, 0x838D, 0x3A08, 0x4A49, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x9471, 0xA491, 0x62CA, 0x39E8,
-  0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x9C92,
-  0x9C30, 0x4A49, 0x3A08, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C71, 0x8C51, 0xA4B2, 0x93EE, 0x4208, 0x4229, 0x4A69, 0x4A69,
-  0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C51, 0x9451, 0xAC70, 0x62CA,
-  0x3A08, 0x4A69, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51,
-  0xA491, 0x93CE, 0x4249, 0x4249, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x9451, 0xAC91, 0x732B, 0x3A08, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C51, 0x9C71, 0xA450, 0x5A8A,
-  0x3A28, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51,
-  0xA491, 0x93CE, 0x4249, 0x4249, 0x528A, 0x528A, 0x528A, 0x528A,
-  0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x9450, 0xAC91, 0x836C, 0x3A08, 0x4A69, 0x528A,
-  0x528A, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x9450, 0xA450, 0xAC0E,
-  0x5A8A, 0x3A49, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51,
-  0x9430, 0xAC70, 0x938D, 0x4249, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9C50, 0xAC2F, 0x6AEA, 0x3A29, 0x528A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x9450, 0xA450, 0xA3EE,
-  0x4A69, 0x4249, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51,
-  0x9430, 0xAC70, 0x938D, 0x4249, 0x4A69, 0x528A, 0x528A, 0x52AA,
-  0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9430, 0xAC4F, 0x7B2B, 0x3A29, 0x4A8A,
-  0x528A, 0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9450, 0x942F, 0xAC2F,
-  0xABCD, 0x5A8A, 0x426A, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71,
-  0x9450, 0x9C0F, 0xB42F, 0x8B4C, 0x4249, 0x4A8A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9430, 0xA42F, 0xB40E, 0x62CA, 0x3A49,
-  0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C71, 0x9450, 0x942F, 0xAC2F,
-  0xA3AD, 0x4A69, 0x426A, 0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x5ACB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71,
-  0x9450, 0x9C0F, 0xB42F, 0x8B4C, 0x4249, 0x4A8A, 0x52AA, 0x52AA,
-  0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C2F, 0xBC2E, 0x7B0B, 0x3A49,
-  0x528A, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C0F,
-  0xB40E, 0xABAC, 0x5A8A, 0x428A, 0x5AAA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C71,
-  0x9450, 0x942F, 0x9C0F, 0xBC0E, 0x932B, 0x426A, 0x4AAA, 0x5AAA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9450, 0x940F, 0xAC0E, 0xB3CD, 0x6ACA,
-  0x426A, 0x52AA, 0x5AAA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C0F,
-  0xB40E, 0xA38C, 0x4A8A, 0x428A, 0x5AAA, 0x5ACB, 0x5ACB, 0x5ACB,
-  0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C71, 0x8C71,
-  0x9450, 0x942F, 0x9C0F, 0xBC0D, 0x932B, 0x426A, 0x4AAA, 0x5AAA,
-  0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C0F, 0xA40E, 0xBBED, 0x7AEA,
-  0x426A, 0x52AA, 0x5AAA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C0F,
-  0x9BEE, 0xBBED, 0xB36B, 0x62AA, 0x42AB, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x9451, 0x9430, 0x9C0F, 0xA3EE, 0xC3CC, 0x932A, 0x428A, 0x4AAB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x9450, 0x9C2F, 0x9BEE, 0xB3ED, 0xBBAC,
-  0x6ACA, 0x428B, 0x52CB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C0F,
-  0x9BEE, 0xBBED, 0xAB4B, 0x52AA, 0x4AAB, 0x5ACB, 0x5ACB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x9451, 0x9430, 0x9C0F, 0xA3EE, 0xC3CC, 0x932B, 0x428A, 0x4AAB,
-  0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x9450, 0x942F, 0x9BEE, 0xABED, 0xC3AC,
-  0x82EA, 0x428A, 0x52CB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB,
-  0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450, 0x942F,
-  0x9BEE, 0xA3CD, 0xBBAC, 0xBB6A, 0x6ACA, 0x42CB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x8C51, 0x9430, 0x9C0F, 0xA3EE, 0xABCD, 0xC3AB, 0xA32A, 0x4AAB,
-  0x4ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x9450, 0x9430, 0x9C0F, 0xA3CE, 0xB3CD,
-  0xC38B, 0x72CA, 0x42AB, 0x52CB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450, 0x942F,
-  0x9BEE, 0xA3CD, 0xC3CC, 0xB34A, 0x5AAA, 0x42CB, 0x5AEB, 0x5AEB,
-  0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x8C51, 0x9430, 0x9C0F, 0x9BEE, 0xABCD, 0xC3AB, 0xA32A, 0x4AAB,
-  0x4ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x9450, 0x9430, 0x9C0F, 0xA3CE, 0xB3AD,
-  0xC38B, 0x8AEA, 0x4AAB, 0x52CB, 0x5AEB, 0x5AEB, 0x5AEB, 0x630C,
-  0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9450, 0x9430,
-  0x9C0F, 0xA3CE, 0xA3AD, 0xC38B, 0xC349, 0x7ACA, 0x42EC, 0x52EC,
-  0x62EB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C51, 0x9450, 0x942F, 0x9BEE, 0xA3CD, 0xABAC, 0xCB8B, 0xAB09,
-  0x5ACB, 0x4AEC, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9430, 0x9C0F, 0xA3EE, 0xA3AD,
-  0xBBAC, 0xCB6A, 0x8AEA, 0x42CC, 0x52EC, 0x62EB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9450, 0x9430,
-  0x9C0F, 0xA3CE, 0xABAD, 0xC38B, 0xBB2A, 0x6ACA, 0x42EC, 0x5AEC,
-  0x62EB, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C51, 0x9430, 0x942F, 0x9BEE, 0xA3CD, 0xABAC, 0xCB8B, 0xAB09,
-  0x5ACB, 0x4AEC, 0x5AEB, 0x630C, 0x630C, 0x630C, 0x630C, 0x632C,
-  0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C0F, 0xA3EE, 0xA3CD,
-  0xB38C, 0xCB6A, 0x9B09, 0x4ACB, 0x4AEC, 0x62EB, 0x630C, 0x630C,
-  0x630C, 0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451, 0x9430,
-  0x9C0F, 0xA3EE, 0xA3CD, 0xAB8C, 0xC36A, 0xD329, 0x92E9, 0x4AEC,
-  0x530C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x9450, 0x9430, 0x9C0F, 0xA3EE, 0xABAD, 0xAB8C, 0xCB4A,
-  0xC308, 0x6AEA, 0x430D, 0x5B0C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9430, 0x9C2F, 0x9BEE, 0xA3CD,
-  0xABAC, 0xBB8B, 0xD349, 0x9AE9, 0x52EC, 0x4B0C, 0x630C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451, 0x9430,
-  0x9C0F, 0xA3EE, 0xA3CD, 0xAB8C, 0xC36A, 0xCB29, 0x82EA, 0x4AEC,
-  0x530C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x9450, 0x9430, 0x9C0F, 0xA3EE, 0xABAD, 0xAB8C, 0xCB6A,
-  0xC308, 0x72EA, 0x430D, 0x5B0C, 0x630C, 0x630C, 0x632C, 0x632C,
-  0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9430, 0x942F, 0x9BEE, 0xA3CD,
-  0xABAC, 0xB36B, 0xD349, 0xB2E8, 0x62EB, 0x4B0D, 0x5B0C, 0x630C,
-  0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450,
-  0x9C2F, 0x9BEE, 0xA3CD, 0xABAC, 0xB36B, 0xBB4A, 0xDB08, 0xB2C8,
-  0x62EB, 0x4B2D, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x9451, 0x9430, 0x9C0F, 0x9BEE, 0xA3CD, 0xAB8C, 0xB36B,
-  0xCB49, 0xD2E8, 0x8AE9, 0x530C, 0x532D, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8C51,
-  0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0xA3EE,
-  0xABAD, 0xAB8C, 0xBB6B, 0xD328, 0xBAE8, 0x6AEB, 0x4B2D, 0x5B2C,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450,
-  0x9C2F, 0x9BEE, 0xA3CD, 0xABAC, 0xAB6B, 0xC34A, 0xD308, 0xA2E9,
-  0x5B0C, 0x4B2D, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x9451, 0x9430, 0x9C0F, 0x9BEE, 0xA3CD, 0xABAC, 0xB36B,
-  0xCB49, 0xD308, 0x92E9, 0x530C, 0x532D, 0x632C, 0x632C, 0x632C,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0xA3EE,
-  0xA3CD, 0xAB8C, 0xB36B, 0xD329, 0xCAE7, 0x82EA, 0x4B2D, 0x5B2D,
-  0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D,
-  0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450,
-  0x9430, 0x9C0F, 0xA3EE, 0xA3CD, 0xAB8C, 0xB36B, 0xBB4A, 0xDB07,
-  0xD2C7, 0x8AEA, 0x532D, 0x534E, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x8C51, 0x9450, 0x942F, 0x9C0F, 0xA3CE, 0xABAD, 0xB38C,
-  0xB36B, 0xC329, 0xE2E7, 0xB2C8, 0x6B0C, 0x4B4E, 0x634D, 0x6B4C,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451, 0x9430, 0x9C0F, 0x9BEE,
-  0xA3CD, 0xABAC, 0xB36B, 0xBB4A, 0xD308, 0xD2C7, 0x92E9, 0x532D,
-  0x534E, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450,
-  0x9430, 0x9C0F, 0xA3EE, 0xA3CD, 0xAB8C, 0xB36B, 0xBB4A, 0xDB07,
-  0xC2C7, 0x7AEB, 0x4B4D, 0x5B4D, 0x6B2C, 0x6B4D, 0x6B4D, 0x6B4D,
-  0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x8C51, 0x9430, 0x942F, 0x9C0F, 0xA3CE, 0xABAD, 0xAB8C,
-  0xB36B, 0xC329, 0xE2E7, 0xB2C8, 0x6B0B, 0x4B4E, 0x634D, 0x6B4C,
-  0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E,
-  0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451, 0x9430, 0x9C0F, 0x9BEE,
-  0xA3CD, 0xABAC, 0xB38B, 0xB34A, 0xCB28, 0xDAC6, 0xAAC8, 0x632C,
-  0x4B4E, 0x634D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451,
-  0x9430, 0x9C0F, 0x9BEE, 0xA3CE, 0xABAD, 0xB38C, 0xB36A, 0xBB2A,
-  0xD308, 0xE2A5, 0xBAA7, 0x730B, 0x536E, 0x5B6E, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0x9BEE, 0xA3CD, 0xABAC,
-  0xB36B, 0xBB4A, 0xC329, 0xDAE7, 0xD2A6, 0x9AC9, 0x5B4D, 0x536E,
-  0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9430, 0x942F, 0x9C0F,
-  0xA3EE, 0xA3CD, 0xAB8C, 0xB36B, 0xBB4A, 0xCB08, 0xE2C6, 0xBAA7,
-  0x7B0B, 0x536E, 0x5B6E, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451,
-  0x9430, 0x9C0F, 0x9BEE, 0xA3CE, 0xABAD, 0xB38C, 0xB36B, 0xBB2A,
-  0xD2E7, 0xDAA6, 0xA2C8, 0x632C, 0x536E, 0x636D, 0x6B4D, 0x6B6D,
-  0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0x9BEE, 0xA3CD, 0xABAC,
-  0xB38B, 0xBB4A, 0xC329, 0xDAE7, 0xDAA6, 0x9AC9, 0x5B4D, 0x536E,
-  0x636D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9430, 0x942F, 0x9C0F,
-  0xA3EE, 0xA3CD, 0xAB8C, 0xB36B, 0xBB4A, 0xC308, 0xE2C6, 0xD2A6,
-  0x8AE9, 0x534E, 0x536E, 0x6B4D, 0x6B4D, 0x6B6D, 0x6B6D, 0x6B6D,
-  0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51,
-  0x9450, 0x9430, 0x9C0F, 0xA3EE, 0xA3CD, 0xABAC, 0xB36B, 0xBB4A,
-  0xBB29, 0xC308, 0xE2A6, 0xE285, 0xA2C8, 0x6B4D, 0x538F, 0x638E,
-  0x6B6D, 0x736D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C71, 0x8C71, 0x9451, 0x9430, 0x9C0F, 0x9C0F, 0xA3EE, 0xA3AD,
-  0xAB8C, 0xB36B, 0xBB4A, 0xBB29, 0xD2E7, 0xEA85, 0xC286, 0x8B0A,
-  0x5B6E, 0x538F, 0x6B6E, 0x736D, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F,
-  0x9BEE, 0xA3CD, 0xABAD, 0xB38C, 0xB36B, 0xBB2A, 0xC309, 0xE2C6,
-  0xE285, 0xAAC8, 0x6B2C, 0x538F, 0x638E, 0x6B6D, 0x736D, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51,
-  0x9450, 0x9430, 0x9C0F, 0xA3EE, 0xA3CD, 0xABAC, 0xB36B, 0xBB4A,
-  0xBB29, 0xCB08, 0xE2A5, 0xD285, 0x92E9, 0x636E, 0x538F, 0x638E,
-  0x736D, 0x736D, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE,
-  0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C71, 0x8C71, 0x9451, 0x9430, 0x940F, 0x9C0F, 0xA3EE, 0xA3AD,
-  0xAB8C, 0xB36B, 0xBB4A, 0xBB29, 0xD2E7, 0xEA85, 0xCA86, 0x8B0A,
-  0x5B6E, 0x538F, 0x6B6E, 0x736D, 0x738E, 0x738E, 0x738E, 0x738E,
-  0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F,
-  0x9BEE, 0xA3CE, 0xABAD, 0xB38C, 0xB36B, 0xBB2A, 0xC309, 0xDAC6,
-  0xEA84, 0xBAA6, 0x830B, 0x5B8E, 0x5B8F, 0x6B6E, 0x736D, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51,
-  0x9450, 0x9430, 0x9C0F, 0x9BEF, 0xA3EE, 0xA3CD, 0xAB8C, 0xB36B,
-  0xBB4A, 0xBB29, 0xC308, 0xD2C6, 0xEA64, 0xDA64, 0xAAC8, 0x734D,
-  0x53B0, 0x63AF, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C71, 0x8C71, 0x8C51, 0x9430, 0x9430, 0x9C0F, 0x9BEE, 0xA3CD,
-  0xABAD, 0xAB8C, 0xB36B, 0xBB4A, 0xC309, 0xCAE8, 0xE2A5, 0xEA64,
-  0xC286, 0x8B0A, 0x5B8F, 0x5BD0, 0x6BAE, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451, 0x9430, 0x942F,
-  0x9C0F, 0xA3EE, 0xA3CD, 0xABAC, 0xB38B, 0xB34A, 0xBB29, 0xC309,
-  0xD2E7, 0xEA84, 0xDA64, 0xAAC8, 0x734D, 0x5BAF, 0x63AF, 0x738E,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51,
-  0x9450, 0x9430, 0x9C0F, 0x9BEF, 0xA3EE, 0xA3CD, 0xAB8C, 0xB36B,
-  0xBB4A, 0xBB29, 0xC308, 0xDAC6, 0xEA64, 0xCA85, 0x9AE9, 0x636E,
-  0x53D0, 0x63AF, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0x9BEE, 0xA3CD,
-  0xABAD, 0xAB8C, 0xB36B, 0xBB4A, 0xC309, 0xC2E8, 0xE2A5, 0xEA64,
-  0xC286, 0x8B0A, 0x638E, 0x53D0, 0x6BAF, 0x738E, 0x738E, 0x73AE,
-  0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451, 0x9430, 0x942F,
-  0x9C0F, 0xA3EE, 0xA3CD, 0xABAC, 0xB38B, 0xB36A, 0xBB29, 0xC309,
-  0xCAE7, 0xE285, 0xEA44, 0xBAA6, 0x830B, 0x5BAF, 0x5BD0, 0x6BAE,
-  0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71,
-  0x8C51, 0x9430, 0x9430, 0x9C0F, 0x9BEE, 0xA3CE, 0xABAD, 0xAB8C,
-  0xB36B, 0xBB4A, 0xBB29, 0xC308, 0xCAE7, 0xDAA5, 0xF243, 0xE244,
-  0xB2A7, 0x834C, 0x63CF, 0x5BF0, 0x6BCF, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x942F, 0x9C0F, 0xA3EE,
-  0xA3CD, 0xABAC, 0xB38C, 0xB36B, 0xBB4A, 0xC309, 0xC2E8, 0xD2C7,
-  0xEA64, 0xEA43, 0xC286, 0x930A, 0x6B8E, 0x5BF0, 0x63D0, 0x73AF,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430,
-  0x9C0F, 0x9BEE, 0xA3EE, 0xA3CD, 0xABAC, 0xB38B, 0xB34A, 0xBB29,
-  0xC309, 0xCAE8, 0xDAA6, 0xF243, 0xE244, 0xB2C8, 0x834C, 0x63AF,
-  0x5BF0, 0x6BCF, 0x73AE, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71,
-  0x8C51, 0x9430, 0x9430, 0x9C0F, 0x9BEE, 0xA3CE, 0xABAD, 0xAB8C,
-  0xB36B, 0xBB4A, 0xBB29, 0xC308, 0xCAE7, 0xE285, 0xF243, 0xD265,
-  0xA2E9, 0x736D, 0x5BD0, 0x63F0, 0x73AF, 0x73AE, 0x73AE, 0x7BCF,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-  0x8C51, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C2F, 0x9C0F, 0xA3EE,
-  0xA3CD, 0xABAC, 0xAB8C, 0xB36B, 0xBB4A, 0xC309, 0xC2E8, 0xCAC7,
-  0xEA64, 0xF243, 0xCA85, 0x9AEA, 0x738E, 0x5BF0, 0x63D0, 0x73AF,
-  0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430,
-  0x9C0F, 0x9C0E, 0xA3EE, 0xA3CD, 0xABAC, 0xB38B, 0xB34A, 0xBB29,
-  0xC309, 0xCAE8, 0xD2C6, 0xEA64, 0xEA23, 0xC286, 0x930A, 0x6B8E,
-  0x5BF0, 0x63F0, 0x73AF, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71,
-  0x8C51, 0x9450, 0x9430, 0x942F, 0x9C0F, 0x9BEE, 0xA3CD, 0xABAD,
-  0xAB8C, 0xB36B, 0xBB4A, 0xBB29, 0xC308, 0xCAE8, 0xCAC7, 0xE285,
-  0xF222, 0xEA22, 0xCA65, 0x9B0A, 0x7B8E, 0x63F0, 0x6411, 0x6BF0,
-  0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0x9BEF,
-  0xA3EE, 0xA3CD, 0xABAC, 0xB38C, 0xB36B, 0xBB4A, 0xC329, 0xC308,
-  0xCAC7, 0xD2A6, 0xEA44, 0xF222, 0xDA44, 0xB2C8, 0x8B4C, 0x6BD0,
-  0x5C11, 0x6C10, 0x73CF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x9451, 0x9430,
-  0x9430, 0x9C0F, 0x9BEE, 0xA3CE, 0xA3AD, 0xABAC, 0xB38B, 0xB36A,
-  0xBB2A, 0xC309, 0xC2E8, 0xCAC7, 0xDA85, 0xF243, 0xEA23, 0xCA86,
-  0x9B0A, 0x738E, 0x63F0, 0x6411, 0x6BF0, 0x7BCF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71,
-  0x8C51, 0x9450, 0x9430, 0x942F, 0x9C0F, 0x9BEE, 0xA3CD, 0xABAD,
-  0xAB8C, 0xB36B, 0xBB4A, 0xBB29, 0xC308, 0xCAE8, 0xD2C7, 0xE264,
-  0xF222, 0xE243, 0xBAA7, 0x932B, 0x6BAF, 0x5C11, 0x6411, 0x73EF,
-  0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0x9BEF,
-  0xA3EE, 0xA3CD, 0xABAC, 0xAB8C, 0xB36B, 0xBB4A, 0xC329, 0xC308,
-  0xCAE7, 0xD2A6, 0xEA64, 0xF222, 0xDA44, 0xB2A7, 0x8B4C, 0x6BCF,
-  0x5C11, 0x6411, 0x73EF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF,
-  0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x9451, 0x9430,
-  0x9430, 0x9C0F, 0x9BEE, 0xA3CE, 0xA3CD, 0xABAC, 0xB38B, 0xB36A,
-  0xBB4A, 0xC309, 0xCAE8, 0xCAC7, 0xD2A6, 0xEA43, 0xF202, 0xDA44,
-  0xB2C8, 0x8B4C, 0x6BD0, 0x5C11, 0x6C10, 0x73EF, 0x7BCF, 0x7BCF,
-  0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0x9C0F, 0xA3EE, 0xA3CD,
-  0xABAD, 0xAB8C, 0xB36B, 0xBB4A, 0xBB2A, 0xC309, 0xC2E8, 0xCAC7,
-  0xD2A6, 0xDA85, 0xF222, 0xF9E1, 0xE223, 0xC2A6, 0xA30A, 0x838D,
-  0x6C10, 0x6432, 0x6C31, 0x7410, 0x7BF0, 0x7BEF, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9451, 0x9430, 0x9430, 0x9C0F,
-  0x9BEE, 0xA3EE, 0xA3CD, 0xABAC, 0xAB8C, 0xB36B, 0xBB4A, 0xBB29,
-  0xC308, 0xCAE8, 0xCAC7, 0xD2A6, 0xE264, 0xFA01, 0xEA02, 0xD265,
-  0xAAE8, 0x8B6C, 0x73CF, 0x6431, 0x6431, 0x7411, 0x7BF0, 0x7BEF,
-  0x83EF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450,
-  0x9430, 0x942F, 0x9C0F, 0x9BEE, 0xA3CE, 0xA3CD, 0xABAC, 0xB38B,
-  0xB36B, 0xBB4A, 0xC329, 0xC308, 0xCAE7, 0xCAC7, 0xDA85, 0xF243,
-  0xFA01, 0xE223, 0xBAA7, 0x9B2A, 0x7BAE, 0x6C10, 0x6432, 0x6C31,
-  0x7410, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x8C51, 0x9450, 0x9430, 0x9C0F, 0x9C0F, 0xA3EE, 0xA3CD,
-  0xABAD, 0xAB8C, 0xB36B, 0xBB4A, 0xBB2A, 0xC309, 0xC2E8, 0xCAC7,
-  0xD2A6, 0xE264, 0xF222, 0xF202, 0xDA44, 0xB2C8, 0x934B, 0x7BCF,
-  0x6411, 0x6431, 0x6C11, 0x7C10, 0x7BEF, 0x7BEF, 0x8410, 0x8410,
-  0x8410, 0x8410, 0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51,
-  0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9451, 0x9430, 0x9430, 0x9C0F,
-  0x9BEE, 0xA3EE, 0xA3CD, 0xABAC, 0xAB8C, 0xB36B, 0xBB4A, 0xBB29,
-  0xC309, 0xCAE8, 0xCAC7, 0xD2A6, 0xE264, 0xFA02, 0xF202, 0xD244,
-  0xB2C8, 0x934C, 0x73CF, 0x6431, 0x6432, 0x7431, 0x7C10, 0x7BEF,
-  0x83EF, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450,
-  0x9430, 0x942F, 0x9C0F, 0x9BEE, 0xA3CE, 0xA3CD, 0xABAC, 0xB38B,
-  0xB36B, 0xBB4A, 0xC329, 0xC308, 0xCAE7, 0xCAC7, 0xD2A6, 0xEA43,
-  0xFA01, 0xF202, 0xD265, 0xAAE8, 0x8B6C, 0x73CF, 0x6431, 0x6452,
-  0x7431, 0x7C10, 0x7BEF, 0x840F, 0x8410, 0x8410, 0x8410, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x8C51, 0x9451, 0x9430, 0x9430, 0x9C0F, 0x9C0F, 0x9BEE,
-  0xA3CD, 0xABAD, 0xABAC, 0xB38B, 0xB36B, 0xBB4A, 0xBB29, 0xC308,
-  0xCAE8, 0xCAC7, 0xD2A6, 0xDA85, 0xE243, 0xF9E1, 0xF9C0, 0xEA02,
-  0xD265, 0xB2E8, 0x936C, 0x83CF, 0x7431, 0x6C72, 0x6C72, 0x7452,
-  0x7C51, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x942F,
-  0x9C0F, 0x9BEE, 0xA3EE, 0xA3CD, 0xABAD, 0xAB8C, 0xB36B, 0xB34A,
-  0xBB2A, 0xC329, 0xC308, 0xCAE7, 0xCAC7, 0xD2A6, 0xDA65, 0xF222,
-  0xF9E1, 0xF1E1, 0xDA44, 0xBAA7, 0xA32A, 0x8BAE, 0x7410, 0x6C52,
-  0x6C72, 0x7452, 0x7C51, 0x7C30, 0x8430, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x8C51,
-  0x9450, 0x9430, 0x940F, 0x9C0F, 0x9BEE, 0xA3CE, 0xA3CD, 0xABAC,
-  0xAB8C, 0xB36B, 0xBB4A, 0xBB29, 0xC309, 0xC2E8, 0xCAC7, 0xD2C6,
-  0xD2A6, 0xE264, 0xFA01, 0xF9E1, 0xE202, 0xCA65, 0xAAE9, 0x936C,
-  0x7BEF, 0x6C31, 0x6C52, 0x6C72, 0x7451, 0x7C31, 0x8430, 0x8430,
-  0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C71,
-  0x8C71, 0x8C51, 0x9451, 0x9430, 0x9430, 0x9C0F, 0x9C0F, 0x9BEE,
-  0xA3CD, 0xABAD, 0xABAC, 0xB38B, 0xB36B, 0xBB4A, 0xBB29, 0xC308,
-  0xCAE8, 0xCAC7, 0xD2A6, 0xDA85, 0xEA43, 0xF9E1, 0xF1E1, 0xE223,
-  0xC286, 0xAB0A, 0x8B8D, 0x7BF0, 0x6C52, 0x6C72, 0x6C52, 0x7451,
-  0x7C31, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51,
-  0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9430,
-  0x9C0F, 0x9BEE, 0xA3EE, 0xA3CD, 0xABAD, 0xAB8C, 0xB36B, 0xB34A,
-  0xBB2A, 0xC329, 0xC308, 0xCAE7, 0xCAC7, 0xD2A6, 0xDA85, 0xF222,
-  0xF9E1, 0xF1E1, 0xDA23, 0xC2A6, 0xA32A, 0x8B8D, 0x7410, 0x6C52,
-  0x6C72, 0x6C52, 0x7451, 0x7C31, 0x8430, 0x8430, 0x8430, 0x8430,
-  0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C51, 0x8C51,
-  0x9450, 0x9430, 0x9C2F, 0x9C0F, 0x9BEE, 0xA3CE, 0xA3CD, 0xABAC,
-  0xAB8C, 0xB36B, 0xBB4A, 0xBB29, 0xC309, 0xC308, 0xCAE7, 0xD2C6,
-  0xD2A6, 0xDA64, 0xF222, 0xF9E0, 0xF1E1, 0xDA23, 0xC2A7, 0xA32A,
-  0x8BAD, 0x7410, 0x6C52, 0x6C72, 0x6C72, 0x7C51, 0x7C31, 0x8430,
-  0x7CF3, 0x84F3, 0x84D3, 0x84B2, 0x8492, 0x8C92, 0x8C71, 0x8C71,
-  0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9430, 0x9C0F, 0x9C0F,
-  0x9BEE, 0xA3CE, 0xA3CD, 0xABAC, 0xAB8C, 0xB36B, 0xB34A, 0xBB4A,
-  0xC329, 0xC308, 0xCAE8, 0xCAC7, 0xD2A6, 0xD2A6, 0xDA85, 0xEA43,
-  0xF9E1, 0xF9C0, 0xF9C0, 0xEA22, 0xD285, 0xC2E8, 0xAB6B, 0x9BED,
-  0x9450, 0x84B2, 0x84D3, 0x7CF3, 0x84F3, 0x84D3, 0x84B2, 0x8492,
-  0x8C92, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430,
-  0x942F, 0x9C0F, 0x9BEE, 0xA3EE, 0xA3CD, 0xABAD, 0xABAC, 0xB38C,
-  0xB36B, 0xBB4A, 0xBB29, 0xC309, 0xC308, 0xCAE7, 0xCAC7, 0xD2A6,
-  0xD285, 0xE264, 0xF222, 0xF9C0, 0xF9C0, 0xEA02, 0xDA44, 0xC2C7,
-  0xB329, 0xA3AC, 0x942F, 0x8C91, 0x84D2, 0x7CF3, 0x7CF3, 0x84D3,
-  0x84B2, 0x8492, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C51,
-  0x9451, 0x9450, 0x9430, 0x9C0F, 0x9C0F, 0x9BEE, 0xA3EE, 0xA3CD,
-  0xABAD, 0xAB8C, 0xB36B, 0xB36B, 0xBB4A, 0xBB29, 0xC309, 0xC2E8,
-  0xCAC7, 0xD2C7, 0xD2A6, 0xDA85, 0xE243, 0xF201, 0xF9C0, 0xF1E1,
-  0xE223, 0xCA86, 0xBAE8, 0xA36B, 0x93EE, 0x8C50, 0x84B2, 0x7CF3,
-  0x7CF3, 0x84D3, 0x84B2, 0x8492, 0x8471, 0x8C71, 0x8C71, 0x8C71,
-  0x8C71, 0x8C71, 0x8C51, 0x9450, 0x9430, 0x9430, 0x9C0F, 0x9C0F,
-  0x9BEE, 0xA3CE, 0xA3CD, 0xABAC, 0xAB8C, 0xB36B, 0xB34A, 0xBB4A,
-  0xC329, 0xC308, 0xCAE8, 0xCAC7, 0xD2A6, 0xD2A6, 0xDA65, 0xEA23,
-  0xF9E1, 0xF9C0, 0xF1E1, 0xDA44, 0xCAA6, 0xB309, 0xA38C, 0x93EE,
-  0x8C71, 0x84B2, 0x7CF3, 0x7CF3, 0x84D3, 0x84B2, 0x8492, 0x8492,
-  0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C51, 0x8C51, 0x9450, 0x9430,
-  0x942F, 0x9C0F, 0x9BEE, 0xA3EE, 0xA3CD, 0xA3AD, 0xAB8C, 0xB38C,
-  0xB36B, 0xBB4A, 0xBB29, 0xC329, 0xC308, 0xCAE7, 0xCAC7, 0xD2A6,
-  0xD285, 0xDA64, 0xEA22, 0xF9E0, 0xF9C0, 0xF1E1, 0xDA44, 0xCAA6,
-  0xB309, 0xA38C, 0x940E, 0x8C71, 0x84D2, 0x7CF3, 0x7CF3, 0x84D3,
-  0x84B2, 0x8492, 0x8492, 0x8C71, 0x8C71, 0x8C71, 0x8C71, 0x8C51,
-  0x8C51, 0x9450, 0x9430, 0x940F, 0x9C0F, 0x9BEE, 0xA3EE, 0xA3CD,
-  0xABAD, 0xAB8C, 0xB36B, 0xB36B, 0xBB4A, 0xBB29, 0xC309, 0xC308,
-  0xCAE7, 0xD2C7, 0xD2A6, 0xDA85, 0xE264, 0xF202, 0xF9C0, 0xF9C0,
-  0xF1E1, 0xDA44, 0xCAA6, 0xBB29, 0xA3AC, 0x942F, 0x8C71, 0x84D2,
-  0x91C7, 0x8A8A, 0x8B0C, 0x8B8E, 0x8C10, 0x8451, 0x84B2, 0x84D3,
-  0x8514, 0x8534, 0x8534, 0x8D14, 0x8D13, 0x8CF3, 0x94D2, 0x94B2,
-  0x9491, 0x9C70, 0x9C50, 0xA44F, 0xA42E, 0xAC0E, 0xABED, 0xB3ED,
-  0xB3CC, 0xBBAB, 0xBBAB, 0xC38A, 0xC38A, 0xCB69, 0xD348, 0xD348,
-  0xDB27, 0xDB06, 0xE2C5, 0xEA63, 0xFA01, 0xF9A0, 0xF980, 0xE960,
-  0xD162, 0xB163, 0x91A6, 0x8A28, 0x8ACB, 0x8B4D, 0x8BCF, 0x8430,
-  0x8471, 0x84D3, 0x84F3, 0x8514, 0x8534, 0x8534, 0x8D14, 0x8CF3,
-  0x8CF3, 0x94D2, 0x94B1, 0x9C91, 0x9C70, 0x9C4F, 0xA42F, 0xA40E,
-  0xAC0D, 0xABED, 0xB3CC, 0xB3CC, 0xBBAB, 0xC3AB, 0xC38A, 0xCB69,
-  0xCB69, 0xD348, 0xD328, 0xDB27, 0xE2E6, 0xEAA4, 0xF242, 0xF9E0,
-  0xF9A0, 0xF180, 0xD981, 0xC1A3, 0xA1A5, 0x8A08, 0x8AAA, 0x8B2C,
-  0x8BAE, 0x8410, 0x8471, 0x84B2, 0x84F3, 0x8514, 0x8534, 0x8534,
-  0x8D14, 0x8D13, 0x8CF3, 0x94D2, 0x94B1, 0x9491, 0x9C70, 0x9C4F,
-  0xA42F, 0xA40E, 0xAC0E, 0xABED, 0xB3CC, 0xB3CC, 0xBBAB, 0xBB8B,
-  0xC38A, 0xC36A, 0xCB69, 0xCB48, 0xD348, 0xDB27, 0xDB07, 0xE2E5,
-  0xF283, 0xFA21, 0xF9E0, 0xF9C0, 0xE9A1, 0xD1C2, 0xB9C4, 0x99E7,
-  0x8A49, 0x8B0C, 0x8B8E, 0x8410, 0x8451, 0x8492, 0x84D3, 0x8514,
-  0x8534, 0x8534, 0x8514, 0x8D14, 0x8CF3, 0x8CD2, 0x94B2, 0x9491,
-  0x9C70, 0x9C50, 0x9C4F, 0xA42E, 0xA40E, 0xABED, 0xABCD, 0xB3CC,
-  0xB3AC, 0xBB8B, 0xBB8A, 0xC38A, 0xC369, 0xCB69, 0xD348, 0xD328,
-  0xDB27, 0xDB06, 0xEAC5, 0xF263, 0xFA21, 0xF9E0, 0xF9C0, 0xE1C1,
-  0xD1C3, 0xB1E5, 0x9207, 0x8A8A, 0x8B2C, 0x8BAE, 0x8410, 0x8471,
-  0x84B2, 0x84F3, 0x8514, 0x8534, 0x8534, 0x8514, 0x8D14, 0x8CF3,
-  0x8CD2, 0x94B2, 0x9491, 0x9C70, 0x9C50, 0xA42F, 0xA40E, 0xA40E,
-  0xABED, 0xABCD, 0xB3CC, 0xBBAB, 0xBB8B, 0xBB8A, 0xC36A, 0xCB69,
-  0xCB49, 0xD348, 0xD327, 0xDB27, 0xE306, 0xEAA4, 0xF262, 0xFA01,
-  0xF9C0, 0xF1A0, 0xE1A1, 0xC9A3, 0xA9A5, 0x91E7, 0x8A6A, 0x8B0C,
-  0x8B8E, 0x8C10, 0x8451, 0x8492, 0x84D3, 0x8514, 0x8534, 0x8534,
-  0x8534, 0x8D13, 0x8CF3, 0x8CD2, 0x94B2, 0x9491, 0x9C70, 0x9C50,
-  0xA44F, 0xA42E, 0xAC0E, 0xABED, 0xB3ED, 0xB3CC, 0xBBAB, 0xBBAB,
-  0xC38A, 0xC38A, 0xCB69, 0xCB49, 0xD348, 0xDB27, 0xDB07, 0xE2E6,
-  0xEAA4, 0xF242, 0xF9C0, 0xF980, 0xF160, 0xD961, 0xC162, 0xA185,
-  0xA800, 0xA800, 0xA800, 0xA800, 0xA820, 0xA082, 0xA0E3, 0xA124,
-  0xA186, 0x99E7, 0x9A29, 0x9A69, 0x9AAA, 0x9AEB, 0x9B0B, 0x9B2C,
-  0x9B2C, 0x9B4C, 0x9B4C, 0xA34C, 0xA32B, 0xA32B, 0xAB2B, 0xAB0A,
-  0xAAE9, 0xB2C9, 0xB2A8, 0xB267, 0xB247, 0xBA06, 0xB9C5, 0xB9A4,
-  0xB963, 0xB923, 0xB8E2, 0xB0A1, 0xB061, 0xA840, 0xA800, 0xA800,
-  0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA861,
-  0xA0A2, 0xA104, 0xA165, 0x99C7, 0x9A28, 0x9A69, 0x9AAA, 0x9AEB,
-  0x9B0B, 0x9B2C, 0x9B4C, 0x9B4C, 0x9B4C, 0x9B4C, 0xA34C, 0xA34C,
-  0xA32B, 0xAB2B, 0xAB0A, 0xAAE9, 0xB2C9, 0xB2A8, 0xB267, 0xBA47,
-  0xBA06, 0xB9C5, 0xB9A4, 0xB963, 0xB923, 0xB8E2, 0xB0A1, 0xB061,
-  0xA840, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800, 0xA800,
-  0xA800, 0xA841, 0xA0A2, 0xA104, 0xA165, 0x99C7, 0x9A28, 0x9A69,
-  0x9AAA, 0x92EB, 0x932C, 0x934C, 0x9B6D, 0x9B6D, 0x9B8D, 0x9B8D,
-  0x9B8D, 0xA38C, 0xA36C, 0xA36C, 0xAB4B, 0xAB2B, 0xAB0A, 0xB2E9,
-  0xB2A8, 0xB288, 0xBA67, 0xBA26, 0xB9E5, 0xB9A4, 0xB963, 0xB923,
-  0xB8E2, 0xB0C1, 0xB081, 0xB040, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xA800, 0xA800, 0xA800, 0xA820, 0xA082, 0xA0E3, 0xA145, 0x99A6,
-  0x9A08, 0x9A69, 0x9AAA, 0x92EB, 0x932C, 0x934D, 0x936D, 0x938D,
-  0x9B8D, 0x9BAD, 0x9BAD, 0x9BAD, 0xA38D, 0xA38C, 0xA36C, 0xAB4B,
-  0xAB4B, 0xB30A, 0xB2E9, 0xB2C8, 0xBA88, 0xBA67, 0xBA26, 0xB9E5,
-  0xB9A4, 0xB963, 0xB923, 0xB8E2, 0xB0A1, 0xB081, 0xB020, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xA800, 0xA800, 0xA800, 0xA841, 0xA0A2,
-  0xA0E3, 0xA165, 0x99C7, 0x9A08, 0x9A69, 0x9AAA, 0x92EB, 0x932C,
-  0x934D, 0x936D, 0x9B8D, 0x9B8D, 0x9B8D, 0x9B8D, 0xA38D, 0xA38C,
-  0xA36C, 0xAB4B, 0xAB4B, 0xAB2A, 0xB309, 0xB2C9, 0xB2A8, 0xBA67,
-  0xBA46, 0xBA06, 0xB9C5, 0xB984, 0xB943, 0xB902, 0xB8C2, 0xB081,
-  0xB060, 0xA820, 0xA800, 0xA800, 0xB000, 0xA800, 0xA800, 0xA800,
-  0xA800, 0xA820, 0xA082, 0xA0E3, 0xA145, 0x99A6, 0x99E7, 0x9A49,
-  0x9A8A, 0x9ACB, 0x9AEB, 0x9B2C, 0x9B4C, 0x9B4C, 0x9B6C, 0x9B6C,
-  0x9B6C, 0xA36C, 0xA34C, 0xA34B, 0xAB2B, 0xAB0A, 0xAAE9, 0xB2C9,
-  0xB2A8, 0xB267, 0xBA46, 0xBA06, 0xB9C5, 0xB984, 0xB943, 0xB902,
-  0xB8C2, 0xB0A1, 0xB061, 0xA820, 0xA800, 0xA800, 0xA800, 0xA800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xA800, 0xB000, 0xB000, 0xB000, 0xB000, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB000,
-  0xB000, 0xB000, 0xB020, 0xB020, 0xB020, 0xB020, 0xB020, 0xB020,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xA800, 0xA800, 0xA800, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB000, 0xB000, 0xB000, 0xB000, 0xB020, 0xB020,
-  0xB020, 0xB020, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800,
-  0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB800, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000,
-  0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB000, 0xB800, 0xB800,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000, 0xC000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000, 0xD000,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800, 0xD800,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000, 0xE000,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800, 0xE800,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000, 0xF000,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800 };
+extern const uint16_t iris[IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH] asm("terminatorEye_iris");
 
 #define SCREEN_WIDTH  128
 #define SCREEN_HEIGHT 128
 
 #ifdef SYMMETRICAL_EYELID
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00 };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("terminatorEye_upper_sym");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("terminatorEye_lower_sym");
 #else
-
-const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00 };
-
-const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] PROGMEM= {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF };
-
+extern const uint8_t upper[SCREEN_HEIGHT * SCREEN_WIDTH] asm("terminatorEye_upper");
+extern const uint8_t lower[SCREEN_HEIGHT * SCREEN_WIDTH] asm("terminatorEye_lower");
 #endif // SYMMETRICAL_EYELID
 
 #define IRIS_WIDTH  80
 #define IRIS_HEIGHT 80
 
-const uint16_t polar[80 * 80] PROGMEM= {
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x3A00, 0x3B00, 0x3C01, 0x3D01, 0x3E01, 0x3F01,
-  0x4081, 0x4181, 0x4281, 0x4381, 0x4480, 0x4580, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x3500, 0x3601, 0x3701,
-  0x3802, 0x3903, 0x3A03, 0x3B03, 0x3C04, 0x3D04, 0x3E04, 0x3F04,
-  0x4084, 0x4184, 0x4284, 0x4384, 0x4483, 0x4583, 0x4683, 0x4782,
-  0x4881, 0x4981, 0x4A80, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x3180, 0x3281, 0x3382, 0x3483, 0x3584, 0x3684,
-  0x3785, 0x3906, 0x3A06, 0x3B07, 0x3C07, 0x3D07, 0x3E07, 0x3F07,
-  0x4087, 0x4187, 0x4287, 0x4387, 0x4487, 0x4586, 0x4686, 0x4805,
-  0x4904, 0x4A04, 0x4B03, 0x4C02, 0x4D01, 0x4E00, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x2F81, 0x3082, 0x3183, 0x3284, 0x3385, 0x3486, 0x3587, 0x3688,
-  0x3788, 0x3889, 0x3989, 0x3B0A, 0x3C0A, 0x3D0A, 0x3E0B, 0x3F0B,
-  0x408B, 0x418B, 0x428A, 0x438A, 0x448A, 0x4609, 0x4709, 0x4808,
-  0x4908, 0x4A07, 0x4B06, 0x4C05, 0x4D04, 0x4E03, 0x4F02, 0x5001,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x2D01, 0x2E02,
-  0x2F04, 0x3005, 0x3106, 0x3207, 0x3308, 0x3409, 0x350A, 0x360B,
-  0x378B, 0x388C, 0x398D, 0x3A8D, 0x3B8D, 0x3D0E, 0x3E0E, 0x3F0E,
-  0x408E, 0x418E, 0x428E, 0x440D, 0x450D, 0x460D, 0x470C, 0x480B,
-  0x498B, 0x4A8A, 0x4B89, 0x4C88, 0x4D87, 0x4E86, 0x4F85, 0x5084,
-  0x5182, 0x5281, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x2B01, 0x2B82, 0x2C84, 0x2D85,
-  0x2E86, 0x2F88, 0x3089, 0x318A, 0x328B, 0x338C, 0x350D, 0x360E,
-  0x370F, 0x380F, 0x3990, 0x3A90, 0x3B91, 0x3D11, 0x3E11, 0x3F11,
-  0x4091, 0x4191, 0x4291, 0x4411, 0x4510, 0x4610, 0x478F, 0x488F,
-  0x498E, 0x4A8D, 0x4C0C, 0x4D0B, 0x4E0A, 0x4F09, 0x5008, 0x5106,
-  0x5205, 0x5304, 0x5402, 0x5481, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x2880, 0x2982, 0x2A83, 0x2B05, 0x2C07, 0x2D08,
-  0x2E09, 0x2F0B, 0x300C, 0x310D, 0x328E, 0x338F, 0x3490, 0x3591,
-  0x3712, 0x3812, 0x3913, 0x3A93, 0x3B94, 0x3C94, 0x3E14, 0x3F14,
-  0x4094, 0x4194, 0x4314, 0x4414, 0x4513, 0x4693, 0x4792, 0x4892,
-  0x4A11, 0x4B10, 0x4C0F, 0x4D0E, 0x4E8D, 0x4F8C, 0x508B, 0x5189,
-  0x5288, 0x5387, 0x5485, 0x5503, 0x5602, 0x5700, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x2701, 0x2803, 0x2905, 0x2986, 0x2A88, 0x2B89, 0x2C8B,
-  0x2D8C, 0x2E8E, 0x2F8F, 0x3110, 0x3211, 0x3312, 0x3413, 0x3594,
-  0x3695, 0x3795, 0x3916, 0x3A17, 0x3B97, 0x3C97, 0x3E17, 0x3F17,
-  0x4097, 0x4197, 0x4317, 0x4417, 0x4597, 0x4696, 0x4815, 0x4915,
-  0x4A14, 0x4B93, 0x4C92, 0x4D91, 0x4E90, 0x500F, 0x510E, 0x520C,
-  0x530B, 0x5409, 0x5508, 0x5606, 0x5685, 0x5783, 0x5881, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x2500,
-  0x2582, 0x2684, 0x2785, 0x2807, 0x2909, 0x2A0B, 0x2B0C, 0x2C0E,
-  0x2D0F, 0x2E11, 0x2F92, 0x3093, 0x3194, 0x3295, 0x3416, 0x3517,
-  0x3618, 0x3799, 0x3899, 0x3A1A, 0x3B1A, 0x3C9A, 0x3E1B, 0x3F1B,
-  0x409B, 0x419B, 0x431A, 0x449A, 0x459A, 0x4719, 0x4819, 0x4998,
-  0x4A97, 0x4B96, 0x4D15, 0x4E14, 0x4F13, 0x5012, 0x5191, 0x528F,
-  0x538E, 0x548C, 0x558B, 0x5689, 0x5787, 0x5805, 0x5904, 0x5A02,
-  0x5A80, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x2380, 0x2402,
-  0x2504, 0x2606, 0x2688, 0x278A, 0x288C, 0x298D, 0x2A8F, 0x2B91,
-  0x2C92, 0x2D93, 0x2F15, 0x3016, 0x3117, 0x3218, 0x3399, 0x349A,
-  0x361B, 0x371C, 0x389C, 0x3A1D, 0x3B1D, 0x3C9E, 0x3D9E, 0x3F1E,
-  0x409E, 0x421E, 0x431E, 0x449D, 0x459D, 0x471C, 0x489C, 0x499B,
-  0x4B1A, 0x4C19, 0x4D98, 0x4E97, 0x4F96, 0x5095, 0x5213, 0x5312,
-  0x5411, 0x550F, 0x560D, 0x570C, 0x580A, 0x5908, 0x5986, 0x5A84,
-  0x5B82, 0x5C00, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x2201, 0x2283, 0x2385,
-  0x2487, 0x2509, 0x260B, 0x270D, 0x280E, 0x2910, 0x2A12, 0x2B13,
-  0x2C15, 0x2D16, 0x2E98, 0x2F99, 0x309A, 0x321B, 0x331C, 0x349D,
-  0x359E, 0x371F, 0x381F, 0x39A0, 0x3B20, 0x3CA1, 0x3DA1, 0x3F21,
-  0x40A1, 0x4221, 0x4321, 0x44A0, 0x4620, 0x479F, 0x489F, 0x4A1E,
-  0x4B1D, 0x4C9C, 0x4D9B, 0x4F1A, 0x5019, 0x5118, 0x5296, 0x5395,
-  0x5493, 0x5592, 0x5690, 0x578E, 0x588D, 0x598B, 0x5A89, 0x5B07,
-  0x5C05, 0x5D03, 0x5D81, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x2081, 0x2103, 0x2205, 0x2307,
-  0x2389, 0x248B, 0x258D, 0x268F, 0x2791, 0x2893, 0x2994, 0x2A96,
-  0x2B98, 0x2C99, 0x2D9B, 0x2F1C, 0x301D, 0x319E, 0x329F, 0x3420,
-  0x35A1, 0x36A2, 0x3823, 0x39A3, 0x3B24, 0x3C24, 0x3DA4, 0x3F24,
-  0x40A4, 0x4224, 0x43A4, 0x44A4, 0x4623, 0x47A3, 0x4922, 0x4A21,
-  0x4BA0, 0x4D1F, 0x4E1E, 0x4F9D, 0x509C, 0x521B, 0x5319, 0x5418,
-  0x5516, 0x5614, 0x5713, 0x5811, 0x590F, 0x5A0D, 0x5B0B, 0x5C09,
-  0x5C87, 0x5D85, 0x5E83, 0x5F01, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x1F01, 0x2003, 0x2085, 0x2187, 0x220A,
-  0x230C, 0x240E, 0x2490, 0x2592, 0x2694, 0x2795, 0x2897, 0x2999,
-  0x2B1A, 0x2C1C, 0x2D1D, 0x2E9F, 0x2FA0, 0x3121, 0x3222, 0x33A3,
-  0x3524, 0x36A5, 0x37A6, 0x3926, 0x3AA7, 0x3C27, 0x3DA7, 0x3F27,
-  0x40A7, 0x4227, 0x43A7, 0x4527, 0x46A6, 0x4826, 0x4925, 0x4AA4,
-  0x4C23, 0x4DA2, 0x4EA1, 0x5020, 0x511F, 0x529D, 0x539C, 0x549A,
-  0x5619, 0x5717, 0x5815, 0x5914, 0x5A12, 0x5B10, 0x5B8E, 0x5C8C,
-  0x5D8A, 0x5E07, 0x5F05, 0x6003, 0x6081, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x1D81, 0x1E83, 0x1F05, 0x2008, 0x208A, 0x218C,
-  0x220E, 0x2310, 0x2412, 0x2514, 0x2616, 0x2718, 0x281A, 0x291C,
-  0x2A1D, 0x2B9F, 0x2CA0, 0x2E22, 0x2F23, 0x30A4, 0x31A5, 0x3326,
-  0x34A7, 0x3628, 0x37A9, 0x3929, 0x3AAA, 0x3C2A, 0x3DAB, 0x3F2B,
-  0x40AB, 0x422B, 0x43AA, 0x452A, 0x46A9, 0x4829, 0x49A8, 0x4B27,
-  0x4CA6, 0x4E25, 0x4F24, 0x50A3, 0x51A2, 0x5320, 0x541F, 0x559D,
-  0x569C, 0x579A, 0x5898, 0x5996, 0x5A94, 0x5B92, 0x5C90, 0x5D8E,
-  0x5E0C, 0x5F0A, 0x6008, 0x6085, 0x6103, 0x6201, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x1C00, 0x1D03, 0x1D85, 0x1E07, 0x1F0A, 0x200C, 0x208E,
-  0x2191, 0x2293, 0x2315, 0x2417, 0x2519, 0x261B, 0x271D, 0x289E,
-  0x29A0, 0x2AA2, 0x2C23, 0x2D25, 0x2EA6, 0x3027, 0x3128, 0x32A9,
-  0x342A, 0x35AB, 0x372C, 0x38AD, 0x3A2D, 0x3C2E, 0x3DAE, 0x3F2E,
-  0x40AE, 0x422E, 0x43AE, 0x45AD, 0x472D, 0x48AC, 0x4A2B, 0x4BAA,
-  0x4D29, 0x4EA8, 0x4FA7, 0x5126, 0x52A5, 0x53A3, 0x5522, 0x5620,
-  0x571E, 0x589D, 0x599B, 0x5A99, 0x5B97, 0x5C95, 0x5D13, 0x5E11,
-  0x5F0E, 0x600C, 0x608A, 0x6187, 0x6205, 0x6283, 0x6380, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x1A80, 0x1B82, 0x1C05, 0x1C87, 0x1D8A, 0x1E0C, 0x1F0E, 0x2011,
-  0x2093, 0x2195, 0x2297, 0x2399, 0x249B, 0x259D, 0x269F, 0x27A1,
-  0x2923, 0x2A24, 0x2B26, 0x2CA7, 0x2E29, 0x2FAA, 0x30AB, 0x322D,
-  0x33AE, 0x352E, 0x372F, 0x38B0, 0x3A30, 0x3BB1, 0x3DB1, 0x3F31,
-  0x40B1, 0x4231, 0x4431, 0x45B0, 0x4730, 0x48AF, 0x4AAE, 0x4C2E,
-  0x4DAD, 0x4F2B, 0x502A, 0x51A9, 0x5327, 0x54A6, 0x55A4, 0x56A3,
-  0x5821, 0x591F, 0x5A1D, 0x5B1B, 0x5C19, 0x5D17, 0x5E15, 0x5F13,
-  0x6011, 0x608E, 0x618C, 0x620A, 0x6307, 0x6385, 0x6402, 0x6500,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x1A02, 0x1A84, 0x1B07, 0x1C09, 0x1C8C, 0x1D8E, 0x1E11, 0x1F13,
-  0x2015, 0x2097, 0x219A, 0x229C, 0x239E, 0x24A0, 0x25A2, 0x2724,
-  0x2825, 0x2927, 0x2AA9, 0x2C2A, 0x2D2C, 0x2EAD, 0x302E, 0x31B0,
-  0x3331, 0x3531, 0x36B2, 0x3833, 0x39B3, 0x3BB4, 0x3D34, 0x3F34,
-  0x40B4, 0x42B4, 0x4434, 0x4633, 0x47B3, 0x4932, 0x4AB1, 0x4CB1,
-  0x4E30, 0x4FAE, 0x512D, 0x52AC, 0x53AA, 0x5529, 0x56A7, 0x57A5,
-  0x58A4, 0x5A22, 0x5B20, 0x5C1E, 0x5D1C, 0x5E1A, 0x5F17, 0x6015,
-  0x6093, 0x6191, 0x620E, 0x630C, 0x6389, 0x6487, 0x6504, 0x6582,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x1881,
-  0x1904, 0x1986, 0x1A89, 0x1B0B, 0x1B8E, 0x1C90, 0x1D13, 0x1E15,
-  0x1F17, 0x201A, 0x209C, 0x219E, 0x22A0, 0x23A2, 0x2524, 0x2626,
-  0x2728, 0x28AA, 0x29AC, 0x2B2D, 0x2CAF, 0x2E30, 0x2FB1, 0x3133,
-  0x32B4, 0x34B5, 0x3635, 0x37B6, 0x39B7, 0x3B37, 0x3D37, 0x3F37,
-  0x40B7, 0x42B7, 0x44B7, 0x4637, 0x4836, 0x49B5, 0x4B35, 0x4D34,
-  0x4EB3, 0x5031, 0x51B0, 0x532F, 0x54AD, 0x562C, 0x572A, 0x58A8,
-  0x59A6, 0x5AA4, 0x5C22, 0x5D20, 0x5E1E, 0x5F1C, 0x601A, 0x6097,
-  0x6195, 0x6293, 0x6310, 0x640E, 0x648B, 0x6509, 0x6606, 0x6684,
-  0x6701, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x1700, 0x1783,
-  0x1805, 0x1908, 0x198B, 0x1A0D, 0x1B10, 0x1B92, 0x1C95, 0x1D17,
-  0x1E1A, 0x1F1C, 0x201E, 0x20A0, 0x21A3, 0x2325, 0x2427, 0x2529,
-  0x26AB, 0x27AD, 0x292E, 0x2AB0, 0x2BB1, 0x2D33, 0x2F34, 0x30B6,
-  0x3237, 0x3438, 0x35B8, 0x37B9, 0x393A, 0x3B3A, 0x3D3B, 0x3F3B,
-  0x40BB, 0x42BB, 0x44BA, 0x46BA, 0x4839, 0x4A38, 0x4BB8, 0x4DB7,
-  0x4F36, 0x50B4, 0x52B3, 0x5431, 0x5530, 0x56AE, 0x582D, 0x592B,
-  0x5AA9, 0x5BA7, 0x5CA5, 0x5E23, 0x5F20, 0x601E, 0x609C, 0x619A,
-  0x6297, 0x6315, 0x6412, 0x6490, 0x658D, 0x660B, 0x6688, 0x6785,
-  0x6803, 0x6880, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x1602, 0x1685,
-  0x1787, 0x180A, 0x188D, 0x190F, 0x1A12, 0x1A94, 0x1B97, 0x1C19,
-  0x1D1C, 0x1E1E, 0x1F20, 0x2023, 0x2125, 0x2227, 0x2329, 0x242B,
-  0x25AD, 0x26AF, 0x2831, 0x29B3, 0x2B34, 0x2CB6, 0x2E37, 0x2FB8,
-  0x31BA, 0x333B, 0x353C, 0x373C, 0x393D, 0x3B3D, 0x3D3E, 0x3F3E,
-  0x40BE, 0x42BE, 0x44BD, 0x46BD, 0x48BC, 0x4ABC, 0x4CBB, 0x4E3A,
-  0x5038, 0x51B7, 0x5336, 0x54B4, 0x5633, 0x57B1, 0x592F, 0x5A2D,
-  0x5BAB, 0x5CA9, 0x5DA7, 0x5EA5, 0x6023, 0x60A0, 0x619E, 0x629C,
-  0x6399, 0x6417, 0x6514, 0x6592, 0x668F, 0x670D, 0x678A, 0x6807,
-  0x6905, 0x6982, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x1481, 0x1503, 0x1606,
-  0x1689, 0x170C, 0x178E, 0x1811, 0x1914, 0x1996, 0x1A99, 0x1B1B,
-  0x1C1E, 0x1D20, 0x1E23, 0x1EA5, 0x2027, 0x2129, 0x222C, 0x232E,
-  0x24B0, 0x25B2, 0x2734, 0x28B5, 0x2A37, 0x2BB9, 0x2DBA, 0x2F3B,
-  0x313D, 0x32BE, 0x34BF, 0x36BF, 0x38C0, 0x3AC1, 0x3CC1, 0x3EC1,
-  0x4141, 0x4341, 0x4541, 0x4740, 0x493F, 0x4B3F, 0x4D3E, 0x4EBD,
-  0x50BB, 0x523A, 0x5439, 0x55B7, 0x5735, 0x58B4, 0x5A32, 0x5B30,
-  0x5CAE, 0x5DAC, 0x5EA9, 0x6027, 0x6125, 0x61A3, 0x62A0, 0x639E,
-  0x649B, 0x6519, 0x6616, 0x6694, 0x6791, 0x680E, 0x688C, 0x6909,
-  0x6986, 0x6A83, 0x6B01, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x1402, 0x1485, 0x1508,
-  0x158B, 0x160D, 0x1690, 0x1713, 0x1815, 0x1898, 0x199B, 0x1A1D,
-  0x1B20, 0x1C22, 0x1CA5, 0x1DA7, 0x1EA9, 0x202C, 0x212E, 0x2230,
-  0x23B2, 0x24B4, 0x2636, 0x27B8, 0x293A, 0x2ABB, 0x2CBD, 0x2E3E,
-  0x3040, 0x3241, 0x3442, 0x3643, 0x3843, 0x3AC4, 0x3CC4, 0x3EC4,
-  0x4144, 0x4344, 0x4544, 0x47C3, 0x49C3, 0x4BC2, 0x4DC1, 0x4FC0,
-  0x51BE, 0x533D, 0x553B, 0x56BA, 0x5838, 0x59B6, 0x5B34, 0x5C32,
-  0x5DB0, 0x5EAE, 0x602C, 0x6129, 0x6227, 0x6325, 0x63A2, 0x64A0,
-  0x659D, 0x661B, 0x6718, 0x6795, 0x6893, 0x6910, 0x698D, 0x6A0B,
-  0x6A88, 0x6B05, 0x6B82, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x1281, 0x1304, 0x1387, 0x1409,
-  0x148C, 0x150F, 0x1592, 0x1614, 0x1717, 0x179A, 0x189D, 0x191F,
-  0x1A22, 0x1AA4, 0x1BA7, 0x1CA9, 0x1DAC, 0x1EAE, 0x2030, 0x2133,
-  0x2235, 0x23B7, 0x2539, 0x26BB, 0x283C, 0x29BE, 0x2BC0, 0x2DC1,
-  0x2FC3, 0x31C4, 0x33C5, 0x35C6, 0x37C6, 0x3A47, 0x3CC7, 0x3EC7,
-  0x4147, 0x4347, 0x45C7, 0x4846, 0x4A46, 0x4C45, 0x4E44, 0x5043,
-  0x5241, 0x5440, 0x563E, 0x57BC, 0x593B, 0x5AB9, 0x5C37, 0x5DB5,
-  0x5EB3, 0x6030, 0x612E, 0x622C, 0x6329, 0x6427, 0x6524, 0x65A2,
-  0x669F, 0x671D, 0x681A, 0x6897, 0x6994, 0x6A12, 0x6A8F, 0x6B0C,
-  0x6B89, 0x6C07, 0x6C84, 0x6D01, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x1182, 0x1205, 0x1288, 0x130B,
-  0x138E, 0x1411, 0x1493, 0x1516, 0x1619, 0x169C, 0x171E, 0x1821,
-  0x18A4, 0x19A6, 0x1AA9, 0x1BAB, 0x1CAE, 0x1DB0, 0x1EB3, 0x2035,
-  0x2137, 0x22B9, 0x243B, 0x25BD, 0x273F, 0x28C1, 0x2AC3, 0x2CC4,
-  0x2EC6, 0x30C7, 0x32C8, 0x3549, 0x374A, 0x39CA, 0x3C4A, 0x3ECB,
-  0x414B, 0x43CA, 0x464A, 0x48CA, 0x4AC9, 0x4D48, 0x4F47, 0x5146,
-  0x5344, 0x5543, 0x5741, 0x58BF, 0x5A3D, 0x5BBB, 0x5D39, 0x5EB7,
-  0x6035, 0x6133, 0x6230, 0x632E, 0x642B, 0x6529, 0x6626, 0x6724,
-  0x67A1, 0x689E, 0x691C, 0x6999, 0x6A96, 0x6B13, 0x6B91, 0x6C0E,
-  0x6C8B, 0x6D08, 0x6D85, 0x6E02, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x1001, 0x1084, 0x1106, 0x1189, 0x120C,
-  0x128F, 0x1312, 0x1395, 0x1418, 0x149A, 0x159D, 0x1620, 0x16A3,
-  0x17A5, 0x18A8, 0x192B, 0x1A2D, 0x1B30, 0x1C32, 0x1DB5, 0x1EB7,
-  0x2039, 0x213C, 0x22BE, 0x2440, 0x25C2, 0x27C4, 0x29C5, 0x2BC7,
-  0x2DC8, 0x2FCA, 0x324B, 0x344C, 0x36CD, 0x394D, 0x3C4E, 0x3ECE,
-  0x414E, 0x43CE, 0x46CD, 0x494D, 0x4BCC, 0x4DCB, 0x504A, 0x5248,
-  0x5447, 0x5645, 0x5844, 0x5A42, 0x5BC0, 0x5D3E, 0x5EBC, 0x6039,
-  0x6137, 0x6235, 0x63B2, 0x64B0, 0x65AD, 0x66AB, 0x6728, 0x6825,
-  0x6923, 0x69A0, 0x6A1D, 0x6B1A, 0x6B98, 0x6C15, 0x6C92, 0x6D0F,
-  0x6D8C, 0x6E09, 0x6E86, 0x6F04, 0x6F81, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x0F02, 0x0F85, 0x1008, 0x108B, 0x110E,
-  0x1191, 0x1213, 0x1296, 0x1319, 0x139C, 0x141F, 0x1522, 0x15A4,
-  0x16A7, 0x172A, 0x182D, 0x192F, 0x1A32, 0x1B34, 0x1C37, 0x1D39,
-  0x1EBC, 0x203E, 0x2140, 0x2342, 0x24C4, 0x2646, 0x2848, 0x2A4A,
-  0x2CCB, 0x2ECD, 0x314E, 0x33CF, 0x3650, 0x3950, 0x3BD1, 0x3ED1,
-  0x4151, 0x4451, 0x46D0, 0x49D0, 0x4C4F, 0x4ECE, 0x514D, 0x534B,
-  0x55CA, 0x57C8, 0x59C6, 0x5B44, 0x5CC2, 0x5EC0, 0x603E, 0x613C,
-  0x62B9, 0x63B7, 0x64B4, 0x65B2, 0x66AF, 0x67AD, 0x68AA, 0x6927,
-  0x6A24, 0x6AA2, 0x6B9F, 0x6C1C, 0x6C99, 0x6D16, 0x6D93, 0x6E11,
-  0x6E8E, 0x6F0B, 0x6F88, 0x7005, 0x7082, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x0E00, 0x0E03, 0x0E86, 0x0F09, 0x0F8C, 0x100F,
-  0x1012, 0x1095, 0x1118, 0x121B, 0x129D, 0x1320, 0x13A3, 0x14A6,
-  0x1529, 0x162C, 0x16AE, 0x17B1, 0x18B4, 0x19B6, 0x1AB9, 0x1BBB,
-  0x1D3E, 0x1EC0, 0x2042, 0x21C5, 0x2347, 0x2549, 0x274B, 0x294C,
-  0x2B4E, 0x2DD0, 0x3051, 0x32D2, 0x35D3, 0x38D4, 0x3B54, 0x3E54,
-  0x41D4, 0x44D4, 0x4754, 0x4A53, 0x4D52, 0x4FD1, 0x5250, 0x54CE,
-  0x56CC, 0x58CB, 0x5AC9, 0x5CC7, 0x5E45, 0x6042, 0x6140, 0x62BE,
-  0x643B, 0x6539, 0x6636, 0x6734, 0x6831, 0x692E, 0x69AC, 0x6AA9,
-  0x6B26, 0x6C23, 0x6CA0, 0x6D1D, 0x6D9B, 0x6E98, 0x6F15, 0x6F92,
-  0x6F8F, 0x700C, 0x7089, 0x7106, 0x7183, 0x7180, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x0D01, 0x0D04, 0x0D87, 0x0E0A, 0x0E8D, 0x0E90,
-  0x0F13, 0x0F96, 0x1019, 0x109C, 0x111F, 0x11A2, 0x12A5, 0x1327,
-  0x13AA, 0x14AD, 0x1530, 0x1633, 0x1735, 0x1838, 0x193B, 0x1A3D,
-  0x1BC0, 0x1CC2, 0x1E45, 0x2047, 0x21C9, 0x23CB, 0x25CD, 0x27CF,
-  0x29D1, 0x2C52, 0x2F54, 0x31D5, 0x34D6, 0x37D7, 0x3B57, 0x3E57,
-  0x41D7, 0x44D7, 0x4857, 0x4B56, 0x4E55, 0x50D4, 0x53D2, 0x5651,
-  0x584F, 0x5A4D, 0x5C4B, 0x5E49, 0x6047, 0x61C5, 0x6342, 0x6440,
-  0x65BD, 0x66BB, 0x67B8, 0x68B5, 0x69B3, 0x6AB0, 0x6B2D, 0x6C2A,
-  0x6CA7, 0x6D25, 0x6E22, 0x6E9F, 0x6F1C, 0x6F99, 0x7016, 0x7093,
-  0x7110, 0x710D, 0x718A, 0x7207, 0x7284, 0x7281, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x0C02, 0x0C05, 0x0C88, 0x0D0B, 0x0D0E, 0x0D91,
-  0x0E14, 0x0E97, 0x0F1A, 0x0F9D, 0x1020, 0x10A3, 0x1126, 0x11A9,
-  0x12AC, 0x132F, 0x1431, 0x14B4, 0x15B7, 0x16BA, 0x17BC, 0x18BF,
-  0x1A42, 0x1B44, 0x1CC7, 0x1E49, 0x204B, 0x21CE, 0x23D0, 0x2652,
-  0x2854, 0x2B55, 0x2DD7, 0x30D8, 0x33D9, 0x375A, 0x3ADA, 0x3E5B,
-  0x41DB, 0x455A, 0x48DA, 0x4C59, 0x4F58, 0x5257, 0x54D5, 0x57D4,
-  0x59D2, 0x5C50, 0x5E4E, 0x604B, 0x61C9, 0x6347, 0x64C4, 0x65C2,
-  0x673F, 0x683C, 0x693A, 0x6A37, 0x6B34, 0x6BB1, 0x6CAF, 0x6D2C,
-  0x6E29, 0x6EA6, 0x6F23, 0x6FA0, 0x701D, 0x709A, 0x7117, 0x7194,
-  0x7211, 0x728E, 0x728B, 0x7308, 0x7385, 0x7382, 0x007F, 0x007F,
-  0x007F, 0x0A80, 0x0B03, 0x0B06, 0x0B89, 0x0C0C, 0x0C0F, 0x0C92,
-  0x0D15, 0x0D98, 0x0D9B, 0x0E1E, 0x0EA1, 0x0F24, 0x0FA7, 0x102A,
-  0x112D, 0x11B0, 0x12B3, 0x1336, 0x1439, 0x153B, 0x163E, 0x1741,
-  0x1844, 0x19C6, 0x1AC9, 0x1C4B, 0x1E4E, 0x2050, 0x2252, 0x2454,
-  0x26D6, 0x2958, 0x2C5A, 0x2FDB, 0x32DC, 0x365D, 0x3A5E, 0x3E5E,
-  0x41DE, 0x45DE, 0x49DD, 0x4D5C, 0x505B, 0x53DA, 0x56D8, 0x5956,
-  0x5BD4, 0x5DD2, 0x6050, 0x61CE, 0x63CB, 0x6549, 0x6646, 0x67C4,
-  0x68C1, 0x69BE, 0x6ABB, 0x6BB9, 0x6CB6, 0x6D33, 0x6E30, 0x6EAD,
-  0x6FAA, 0x7027, 0x70A4, 0x7121, 0x719E, 0x721B, 0x7218, 0x7295,
-  0x7312, 0x738F, 0x738C, 0x7409, 0x7486, 0x7483, 0x7500, 0x007F,
-  0x007F, 0x0981, 0x0A04, 0x0A07, 0x0A8A, 0x0A8D, 0x0B10, 0x0B93,
-  0x0B96, 0x0C19, 0x0C9C, 0x0D1F, 0x0DA2, 0x0E25, 0x0EA8, 0x0F2B,
-  0x0FAE, 0x1031, 0x10B4, 0x11B7, 0x123A, 0x133D, 0x1440, 0x1543,
-  0x1645, 0x17C8, 0x18CB, 0x1A4D, 0x1C50, 0x1DD2, 0x2055, 0x2257,
-  0x24D9, 0x27DB, 0x2ADC, 0x2DDE, 0x31DF, 0x35E0, 0x39E1, 0x3DE1,
-  0x4261, 0x4661, 0x4A60, 0x4E5F, 0x525E, 0x555C, 0x585B, 0x5B59,
-  0x5DD7, 0x6055, 0x6252, 0x63D0, 0x65CD, 0x674B, 0x6848, 0x69C5,
-  0x6AC3, 0x6BC0, 0x6CBD, 0x6DBA, 0x6E37, 0x6F34, 0x6FB1, 0x702E,
-  0x70AB, 0x7128, 0x71A5, 0x7222, 0x729F, 0x731C, 0x7399, 0x7416,
-  0x7413, 0x7490, 0x750D, 0x750A, 0x7587, 0x7584, 0x7601, 0x007F,
-  0x007F, 0x0881, 0x0904, 0x0908, 0x098B, 0x098E, 0x0A11, 0x0A14,
-  0x0A97, 0x0B1A, 0x0B1D, 0x0BA0, 0x0C23, 0x0CA6, 0x0D29, 0x0DAD,
-  0x0E30, 0x0EB3, 0x0F36, 0x1038, 0x10BB, 0x11BE, 0x1241, 0x1344,
-  0x1447, 0x15CA, 0x16CC, 0x184F, 0x19D2, 0x1BD4, 0x1DD7, 0x2059,
-  0x22DB, 0x255D, 0x28DF, 0x2C61, 0x3062, 0x3463, 0x38E4, 0x3DE4,
-  0x4264, 0x4764, 0x4BE3, 0x4FE2, 0x53E1, 0x575F, 0x5ADD, 0x5D5B,
-  0x6059, 0x6257, 0x6454, 0x6652, 0x67CF, 0x694C, 0x6A4A, 0x6BC7,
-  0x6CC4, 0x6DC1, 0x6E3E, 0x6F3B, 0x6FB8, 0x70B6, 0x7133, 0x71B0,
-  0x722D, 0x72A9, 0x7326, 0x73A3, 0x7420, 0x749D, 0x749A, 0x7517,
-  0x7594, 0x7591, 0x760E, 0x760B, 0x7688, 0x7684, 0x7701, 0x007F,
-  0x007F, 0x0782, 0x0805, 0x0808, 0x080B, 0x088F, 0x0892, 0x0915,
-  0x0998, 0x099B, 0x0A1E, 0x0A21, 0x0AA4, 0x0B27, 0x0BAA, 0x0C2E,
-  0x0CB1, 0x0D34, 0x0DB7, 0x0E3A, 0x0EBD, 0x0FC0, 0x1043, 0x1146,
-  0x1248, 0x134B, 0x14CE, 0x1651, 0x17D4, 0x1956, 0x1B59, 0x1D5B,
-  0x205E, 0x22E0, 0x2662, 0x29E4, 0x2E65, 0x32E6, 0x37E7, 0x3D67,
-  0x42E7, 0x4867, 0x4D66, 0x51E5, 0x5664, 0x59E2, 0x5D60, 0x605E,
-  0x62DB, 0x64D9, 0x66D6, 0x6854, 0x69D1, 0x6B4E, 0x6CCB, 0x6DC8,
-  0x6EC6, 0x6FC3, 0x7040, 0x713D, 0x71BA, 0x7237, 0x72B4, 0x7331,
-  0x73AE, 0x742A, 0x74A7, 0x7524, 0x75A1, 0x759E, 0x761B, 0x7618,
-  0x7695, 0x7712, 0x770F, 0x778B, 0x7788, 0x7785, 0x7802, 0x007F,
-  0x007F, 0x0683, 0x0686, 0x0709, 0x070C, 0x078F, 0x0792, 0x0815,
-  0x0819, 0x089C, 0x089F, 0x0922, 0x0925, 0x09A8, 0x0A2B, 0x0AAE,
-  0x0AB1, 0x0B35, 0x0BB8, 0x0CBB, 0x0D3E, 0x0DC1, 0x0E44, 0x0F47,
-  0x104A, 0x114D, 0x1250, 0x13D2, 0x14D5, 0x16D8, 0x185B, 0x1ADD,
-  0x1D60, 0x2062, 0x2364, 0x2766, 0x2BE8, 0x3169, 0x36EA, 0x3CEB,
-  0x436B, 0x496A, 0x4EE9, 0x5468, 0x58E6, 0x5CE4, 0x6062, 0x62E0,
-  0x655D, 0x67DB, 0x6958, 0x6B55, 0x6C52, 0x6DD0, 0x6ECD, 0x6FCA,
-  0x70C7, 0x71C4, 0x7241, 0x72BE, 0x733B, 0x7438, 0x74B5, 0x7531,
-  0x752E, 0x75AB, 0x7628, 0x76A5, 0x76A2, 0x771F, 0x771C, 0x7799,
-  0x7795, 0x7812, 0x780F, 0x788C, 0x7889, 0x7906, 0x7903, 0x007F,
-  0x0580, 0x0583, 0x0586, 0x0609, 0x060D, 0x0610, 0x0693, 0x0696,
-  0x0719, 0x071C, 0x079F, 0x07A3, 0x0826, 0x0829, 0x08AC, 0x08AF,
-  0x0932, 0x09B5, 0x0A38, 0x0ABC, 0x0B3F, 0x0BC2, 0x0C45, 0x0D48,
-  0x0DCB, 0x0ECE, 0x0FD1, 0x10D4, 0x1257, 0x13DA, 0x155C, 0x175F,
-  0x19E2, 0x1CE4, 0x2067, 0x2469, 0x28EB, 0x2EEC, 0x356D, 0x3C6E,
-  0x43EE, 0x4AED, 0x516C, 0x576B, 0x5BE9, 0x6067, 0x6364, 0x6662,
-  0x68DF, 0x6ADC, 0x6C5A, 0x6DD7, 0x6F54, 0x7051, 0x714E, 0x724B,
-  0x72C8, 0x73C5, 0x7442, 0x74BF, 0x753C, 0x75B8, 0x7635, 0x76B2,
-  0x772F, 0x772C, 0x77A9, 0x77A6, 0x7823, 0x781F, 0x789C, 0x7899,
-  0x7916, 0x7913, 0x7990, 0x798D, 0x7989, 0x7A06, 0x7A03, 0x7A00,
-  0x0480, 0x0483, 0x0487, 0x048A, 0x050D, 0x0510, 0x0513, 0x0597,
-  0x059A, 0x059D, 0x0620, 0x0623, 0x06A6, 0x06A9, 0x072D, 0x0730,
-  0x07B3, 0x0836, 0x0839, 0x08BC, 0x093F, 0x09C3, 0x0A46, 0x0AC9,
-  0x0BCC, 0x0C4F, 0x0D52, 0x0E55, 0x0F58, 0x105B, 0x125E, 0x13E1,
-  0x1664, 0x18E6, 0x1BE9, 0x206B, 0x256D, 0x2B6F, 0x32F0, 0x3B71,
-  0x44F1, 0x4D70, 0x54EF, 0x5AED, 0x606B, 0x6469, 0x6766, 0x69E4,
-  0x6C61, 0x6DDE, 0x6FDB, 0x70D8, 0x71D5, 0x72D2, 0x73CF, 0x744C,
-  0x7549, 0x75C6, 0x7643, 0x76BF, 0x773C, 0x77B9, 0x77B6, 0x7833,
-  0x78B0, 0x78AD, 0x7929, 0x7926, 0x79A3, 0x79A0, 0x7A1D, 0x7A1A,
-  0x7A17, 0x7A93, 0x7A90, 0x7A8D, 0x7B0A, 0x7B07, 0x7B03, 0x7B00,
-  0x0381, 0x0384, 0x0387, 0x038A, 0x040D, 0x0411, 0x0414, 0x0417,
-  0x049A, 0x049D, 0x04A0, 0x04A4, 0x0527, 0x052A, 0x05AD, 0x05B0,
-  0x0633, 0x0637, 0x06BA, 0x06BD, 0x0740, 0x07C3, 0x0846, 0x08CA,
-  0x094D, 0x09D0, 0x0A53, 0x0B56, 0x0C59, 0x0D5C, 0x0E5F, 0x0FE2,
-  0x11E5, 0x1468, 0x176B, 0x1AED, 0x2070, 0x26F2, 0x2FF3, 0x3A74,
-  0x45F4, 0x5073, 0x5972, 0x6070, 0x656D, 0x68EB, 0x6BE8, 0x6E65,
-  0x7062, 0x71DF, 0x72DC, 0x73D9, 0x74D6, 0x75D3, 0x7650, 0x76CD,
-  0x774A, 0x77C6, 0x7843, 0x78C0, 0x793D, 0x793A, 0x79B7, 0x79B3,
-  0x7A30, 0x7A2D, 0x7AAA, 0x7AA7, 0x7B24, 0x7B20, 0x7B1D, 0x7B1A,
-  0x7B97, 0x7B94, 0x7B91, 0x7B8D, 0x7C0A, 0x7C07, 0x7C04, 0x7C01,
-  0x0281, 0x0284, 0x0287, 0x028A, 0x028E, 0x0291, 0x0314, 0x0317,
-  0x031A, 0x031E, 0x0321, 0x03A4, 0x03A7, 0x03AA, 0x03AE, 0x0431,
-  0x0434, 0x04B7, 0x04BA, 0x04BD, 0x0541, 0x0544, 0x05C7, 0x064A,
-  0x06CD, 0x06D0, 0x0754, 0x0857, 0x08DA, 0x09DD, 0x0A60, 0x0BE3,
-  0x0D66, 0x0EE9, 0x116C, 0x14EF, 0x1972, 0x2074, 0x29F6, 0x37F7,
-  0x4877, 0x5676, 0x6074, 0x66F2, 0x6B6F, 0x6EEC, 0x7169, 0x72E6,
-  0x7463, 0x75E0, 0x765D, 0x775A, 0x77D7, 0x78D4, 0x7950, 0x794D,
-  0x79CA, 0x7A47, 0x7AC4, 0x7AC1, 0x7B3D, 0x7B3A, 0x7B37, 0x7BB4,
-  0x7BB1, 0x7C2E, 0x7C2A, 0x7C27, 0x7C24, 0x7CA1, 0x7C9E, 0x7C9A,
-  0x7C97, 0x7C94, 0x7D11, 0x7D0E, 0x7D0A, 0x7D07, 0x7D04, 0x7D01,
-  0x0181, 0x0184, 0x0187, 0x018B, 0x018E, 0x0191, 0x0194, 0x0197,
-  0x019B, 0x021E, 0x0221, 0x0224, 0x0227, 0x022B, 0x022E, 0x0231,
-  0x02B4, 0x02B7, 0x02BB, 0x02BE, 0x0341, 0x0344, 0x0347, 0x03CA,
-  0x03CE, 0x0451, 0x04D4, 0x04D7, 0x055A, 0x05DE, 0x0661, 0x0764,
-  0x0867, 0x096A, 0x0AED, 0x0D70, 0x1073, 0x1676, 0x2079, 0x32FA,
-  0x4D7A, 0x6079, 0x69F6, 0x6FF3, 0x72F0, 0x756D, 0x76EA, 0x77E7,
-  0x78E4, 0x79E1, 0x7A5E, 0x7ADA, 0x7B57, 0x7B54, 0x7BD1, 0x7C4E,
-  0x7C4A, 0x7CC7, 0x7CC4, 0x7CC1, 0x7D3E, 0x7D3B, 0x7D37, 0x7D34,
-  0x7DB1, 0x7DAE, 0x7DAB, 0x7DA7, 0x7DA4, 0x7DA1, 0x7D9E, 0x7E1B,
-  0x7E17, 0x7E14, 0x7E11, 0x7E0E, 0x7E0B, 0x7E07, 0x7E04, 0x7E01,
-  0x0081, 0x0084, 0x0087, 0x008B, 0x008E, 0x0091, 0x0094, 0x0097,
-  0x009B, 0x009E, 0x00A1, 0x00A4, 0x00A7, 0x00AB, 0x00AE, 0x00B1,
-  0x00B4, 0x00B7, 0x00BB, 0x00BE, 0x0141, 0x0144, 0x0147, 0x014B,
-  0x014E, 0x0151, 0x01D4, 0x01D7, 0x01DB, 0x01DE, 0x0261, 0x0264,
-  0x02E7, 0x036B, 0x03EE, 0x04F1, 0x05F4, 0x0877, 0x0D7A, 0x207D,
-  0x607D, 0x72FA, 0x77F7, 0x7A74, 0x7B71, 0x7C6E, 0x7CEB, 0x7D67,
-  0x7DE4, 0x7DE1, 0x7E5E, 0x7E5B, 0x7E57, 0x7E54, 0x7ED1, 0x7ECE,
-  0x7ECB, 0x7EC7, 0x7EC4, 0x7EC1, 0x7F3E, 0x7F3B, 0x7F37, 0x7F34,
-  0x7F31, 0x7F2E, 0x7F2B, 0x7F27, 0x7F24, 0x7F21, 0x7F1E, 0x7F1B,
-  0x7F17, 0x7F14, 0x7F11, 0x7F0E, 0x7F0B, 0x7F07, 0x7F04, 0x7F01,
-  0xFF01, 0xFF04, 0xFF07, 0xFF0B, 0xFF0E, 0xFF11, 0xFF14, 0xFF17,
-  0xFF1B, 0xFF1E, 0xFF21, 0xFF24, 0xFF27, 0xFF2B, 0xFF2E, 0xFF31,
-  0xFF34, 0xFF37, 0xFF3B, 0xFF3E, 0xFEC1, 0xFEC4, 0xFEC7, 0xFECB,
-  0xFECE, 0xFED1, 0xFE54, 0xFE57, 0xFE5B, 0xFE5E, 0xFDE1, 0xFDE4,
-  0xFD67, 0xFCEB, 0xFC6E, 0xFB71, 0xFA74, 0xF7F7, 0xF2FA, 0xE07D,
-  0xA07D, 0x8D7A, 0x8877, 0x85F4, 0x84F1, 0x83EE, 0x836B, 0x82E7,
-  0x8264, 0x8261, 0x81DE, 0x81DB, 0x81D7, 0x81D4, 0x8151, 0x814E,
-  0x814B, 0x8147, 0x8144, 0x8141, 0x80BE, 0x80BB, 0x80B7, 0x80B4,
-  0x80B1, 0x80AE, 0x80AB, 0x80A7, 0x80A4, 0x80A1, 0x809E, 0x809B,
-  0x8097, 0x8094, 0x8091, 0x808E, 0x808B, 0x8087, 0x8084, 0x8081,
-  0xFE01, 0xFE04, 0xFE07, 0xFE0B, 0xFE0E, 0xFE11, 0xFE14, 0xFE17,
-  0xFE1B, 0xFD9E, 0xFDA1, 0xFDA4, 0xFDA7, 0xFDAB, 0xFDAE, 0xFDB1,
-  0xFD34, 0xFD37, 0xFD3B, 0xFD3E, 0xFCC1, 0xFCC4, 0xFCC7, 0xFC4A,
-  0xFC4E, 0xFBD1, 0xFB54, 0xFB57, 0xFADA, 0xFA5E, 0xF9E1, 0xF8E4,
-  0xF7E7, 0xF6EA, 0xF56D, 0xF2F0, 0xEFF3, 0xE9F6, 0xE079, 0xCD7A,
-  0xB2FA, 0xA079, 0x9676, 0x9073, 0x8D70, 0x8AED, 0x896A, 0x8867,
-  0x8764, 0x8661, 0x85DE, 0x855A, 0x84D7, 0x84D4, 0x8451, 0x83CE,
-  0x83CA, 0x8347, 0x8344, 0x8341, 0x82BE, 0x82BB, 0x82B7, 0x82B4,
-  0x8231, 0x822E, 0x822B, 0x8227, 0x8224, 0x8221, 0x821E, 0x819B,
-  0x8197, 0x8194, 0x8191, 0x818E, 0x818B, 0x8187, 0x8184, 0x8181,
-  0xFD01, 0xFD04, 0xFD07, 0xFD0A, 0xFD0E, 0xFD11, 0xFC94, 0xFC97,
-  0xFC9A, 0xFC9E, 0xFCA1, 0xFC24, 0xFC27, 0xFC2A, 0xFC2E, 0xFBB1,
-  0xFBB4, 0xFB37, 0xFB3A, 0xFB3D, 0xFAC1, 0xFAC4, 0xFA47, 0xF9CA,
-  0xF94D, 0xF950, 0xF8D4, 0xF7D7, 0xF75A, 0xF65D, 0xF5E0, 0xF463,
-  0xF2E6, 0xF169, 0xEEEC, 0xEB6F, 0xE6F2, 0xE074, 0xD676, 0xC877,
-  0xB7F7, 0xA9F6, 0xA074, 0x9972, 0x94EF, 0x916C, 0x8EE9, 0x8D66,
-  0x8BE3, 0x8A60, 0x89DD, 0x88DA, 0x8857, 0x8754, 0x86D0, 0x86CD,
-  0x864A, 0x85C7, 0x8544, 0x8541, 0x84BD, 0x84BA, 0x84B7, 0x8434,
-  0x8431, 0x83AE, 0x83AA, 0x83A7, 0x83A4, 0x8321, 0x831E, 0x831A,
-  0x8317, 0x8314, 0x8291, 0x828E, 0x828A, 0x8287, 0x8284, 0x8281,
-  0xFC01, 0xFC04, 0xFC07, 0xFC0A, 0xFB8D, 0xFB91, 0xFB94, 0xFB97,
-  0xFB1A, 0xFB1D, 0xFB20, 0xFB24, 0xFAA7, 0xFAAA, 0xFA2D, 0xFA30,
-  0xF9B3, 0xF9B7, 0xF93A, 0xF93D, 0xF8C0, 0xF843, 0xF7C6, 0xF74A,
-  0xF6CD, 0xF650, 0xF5D3, 0xF4D6, 0xF3D9, 0xF2DC, 0xF1DF, 0xF062,
-  0xEE65, 0xEBE8, 0xE8EB, 0xE56D, 0xE070, 0xD972, 0xD073, 0xC5F4,
-  0xBA74, 0xAFF3, 0xA6F2, 0xA070, 0x9AED, 0x976B, 0x9468, 0x91E5,
-  0x8FE2, 0x8E5F, 0x8D5C, 0x8C59, 0x8B56, 0x8A53, 0x89D0, 0x894D,
-  0x88CA, 0x8846, 0x87C3, 0x8740, 0x86BD, 0x86BA, 0x8637, 0x8633,
-  0x85B0, 0x85AD, 0x852A, 0x8527, 0x84A4, 0x84A0, 0x849D, 0x849A,
-  0x8417, 0x8414, 0x8411, 0x840D, 0x838A, 0x8387, 0x8384, 0x8381,
-  0xFB00, 0xFB03, 0xFB07, 0xFB0A, 0xFA8D, 0xFA90, 0xFA93, 0xFA17,
-  0xFA1A, 0xFA1D, 0xF9A0, 0xF9A3, 0xF926, 0xF929, 0xF8AD, 0xF8B0,
-  0xF833, 0xF7B6, 0xF7B9, 0xF73C, 0xF6BF, 0xF643, 0xF5C6, 0xF549,
-  0xF44C, 0xF3CF, 0xF2D2, 0xF1D5, 0xF0D8, 0xEFDB, 0xEDDE, 0xEC61,
-  0xE9E4, 0xE766, 0xE469, 0xE06B, 0xDAED, 0xD4EF, 0xCD70, 0xC4F1,
-  0xBB71, 0xB2F0, 0xAB6F, 0xA56D, 0xA06B, 0x9BE9, 0x98E6, 0x9664,
-  0x93E1, 0x925E, 0x905B, 0x8F58, 0x8E55, 0x8D52, 0x8C4F, 0x8BCC,
-  0x8AC9, 0x8A46, 0x89C3, 0x893F, 0x88BC, 0x8839, 0x8836, 0x87B3,
-  0x8730, 0x872D, 0x86A9, 0x86A6, 0x8623, 0x8620, 0x859D, 0x859A,
-  0x8597, 0x8513, 0x8510, 0x850D, 0x848A, 0x8487, 0x8483, 0x8480,
-  0xFA00, 0xFA03, 0xFA06, 0xF989, 0xF98D, 0xF990, 0xF913, 0xF916,
-  0xF899, 0xF89C, 0xF81F, 0xF823, 0xF7A6, 0xF7A9, 0xF72C, 0xF72F,
-  0xF6B2, 0xF635, 0xF5B8, 0xF53C, 0xF4BF, 0xF442, 0xF3C5, 0xF2C8,
-  0xF24B, 0xF14E, 0xF051, 0xEF54, 0xEDD7, 0xEC5A, 0xEADC, 0xE8DF,
-  0xE662, 0xE364, 0xE067, 0xDBE9, 0xD76B, 0xD16C, 0xCAED, 0xC3EE,
-  0xBC6E, 0xB56D, 0xAEEC, 0xA8EB, 0xA469, 0xA067, 0x9CE4, 0x99E2,
-  0x975F, 0x955C, 0x93DA, 0x9257, 0x90D4, 0x8FD1, 0x8ECE, 0x8DCB,
-  0x8D48, 0x8C45, 0x8BC2, 0x8B3F, 0x8ABC, 0x8A38, 0x89B5, 0x8932,
-  0x88AF, 0x88AC, 0x8829, 0x8826, 0x87A3, 0x879F, 0x871C, 0x8719,
-  0x8696, 0x8693, 0x8610, 0x860D, 0x8609, 0x8586, 0x8583, 0x8580,
-  0x007F, 0xF903, 0xF906, 0xF889, 0xF88C, 0xF80F, 0xF812, 0xF795,
-  0xF799, 0xF71C, 0xF71F, 0xF6A2, 0xF6A5, 0xF628, 0xF5AB, 0xF52E,
-  0xF531, 0xF4B5, 0xF438, 0xF33B, 0xF2BE, 0xF241, 0xF1C4, 0xF0C7,
-  0xEFCA, 0xEECD, 0xEDD0, 0xEC52, 0xEB55, 0xE958, 0xE7DB, 0xE55D,
-  0xE2E0, 0xE062, 0xDCE4, 0xD8E6, 0xD468, 0xCEE9, 0xC96A, 0xC36B,
-  0xBCEB, 0xB6EA, 0xB169, 0xABE8, 0xA766, 0xA364, 0xA062, 0x9D60,
-  0x9ADD, 0x985B, 0x96D8, 0x94D5, 0x93D2, 0x9250, 0x914D, 0x904A,
-  0x8F47, 0x8E44, 0x8DC1, 0x8D3E, 0x8CBB, 0x8BB8, 0x8B35, 0x8AB1,
-  0x8AAE, 0x8A2B, 0x89A8, 0x8925, 0x8922, 0x889F, 0x889C, 0x8819,
-  0x8815, 0x8792, 0x878F, 0x870C, 0x8709, 0x8686, 0x8683, 0x007F,
-  0x007F, 0xF802, 0xF785, 0xF788, 0xF78B, 0xF70F, 0xF712, 0xF695,
-  0xF618, 0xF61B, 0xF59E, 0xF5A1, 0xF524, 0xF4A7, 0xF42A, 0xF3AE,
-  0xF331, 0xF2B4, 0xF237, 0xF1BA, 0xF13D, 0xF040, 0xEFC3, 0xEEC6,
-  0xEDC8, 0xECCB, 0xEB4E, 0xE9D1, 0xE854, 0xE6D6, 0xE4D9, 0xE2DB,
-  0xE05E, 0xDD60, 0xD9E2, 0xD664, 0xD1E5, 0xCD66, 0xC867, 0xC2E7,
-  0xBD67, 0xB7E7, 0xB2E6, 0xAE65, 0xA9E4, 0xA662, 0xA2E0, 0xA05E,
-  0x9D5B, 0x9B59, 0x9956, 0x97D4, 0x9651, 0x94CE, 0x934B, 0x9248,
-  0x9146, 0x9043, 0x8FC0, 0x8EBD, 0x8E3A, 0x8DB7, 0x8D34, 0x8CB1,
-  0x8C2E, 0x8BAA, 0x8B27, 0x8AA4, 0x8A21, 0x8A1E, 0x899B, 0x8998,
-  0x8915, 0x8892, 0x888F, 0x880B, 0x8808, 0x8805, 0x8782, 0x007F,
-  0x007F, 0xF701, 0xF684, 0xF688, 0xF60B, 0xF60E, 0xF591, 0xF594,
-  0xF517, 0xF49A, 0xF49D, 0xF420, 0xF3A3, 0xF326, 0xF2A9, 0xF22D,
-  0xF1B0, 0xF133, 0xF0B6, 0xEFB8, 0xEF3B, 0xEE3E, 0xEDC1, 0xECC4,
-  0xEBC7, 0xEA4A, 0xE94C, 0xE7CF, 0xE652, 0xE454, 0xE257, 0xE059,
-  0xDD5B, 0xDADD, 0xD75F, 0xD3E1, 0xCFE2, 0xCBE3, 0xC764, 0xC264,
-  0xBDE4, 0xB8E4, 0xB463, 0xB062, 0xAC61, 0xA8DF, 0xA55D, 0xA2DB,
-  0xA059, 0x9DD7, 0x9BD4, 0x99D2, 0x984F, 0x96CC, 0x95CA, 0x9447,
-  0x9344, 0x9241, 0x91BE, 0x90BB, 0x9038, 0x8F36, 0x8EB3, 0x8E30,
-  0x8DAD, 0x8D29, 0x8CA6, 0x8C23, 0x8BA0, 0x8B1D, 0x8B1A, 0x8A97,
-  0x8A14, 0x8A11, 0x898E, 0x898B, 0x8908, 0x8904, 0x8881, 0x007F,
-  0x007F, 0xF601, 0xF584, 0xF587, 0xF50A, 0xF50D, 0xF490, 0xF413,
-  0xF416, 0xF399, 0xF31C, 0xF29F, 0xF222, 0xF1A5, 0xF128, 0xF0AB,
-  0xF02E, 0xEFB1, 0xEF34, 0xEE37, 0xEDBA, 0xECBD, 0xEBC0, 0xEAC3,
-  0xE9C5, 0xE848, 0xE74B, 0xE5CD, 0xE3D0, 0xE252, 0xE055, 0xDDD7,
-  0xDB59, 0xD85B, 0xD55C, 0xD25E, 0xCE5F, 0xCA60, 0xC661, 0xC261,
-  0xBDE1, 0xB9E1, 0xB5E0, 0xB1DF, 0xADDE, 0xAADC, 0xA7DB, 0xA4D9,
-  0xA257, 0xA055, 0x9DD2, 0x9C50, 0x9A4D, 0x98CB, 0x97C8, 0x9645,
-  0x9543, 0x9440, 0x933D, 0x923A, 0x91B7, 0x90B4, 0x9031, 0x8FAE,
-  0x8F2B, 0x8EA8, 0x8E25, 0x8DA2, 0x8D1F, 0x8C9C, 0x8C19, 0x8B96,
-  0x8B93, 0x8B10, 0x8A8D, 0x8A8A, 0x8A07, 0x8A04, 0x8981, 0x007F,
-  0x007F, 0xF500, 0xF483, 0xF486, 0xF409, 0xF38C, 0xF38F, 0xF312,
-  0xF295, 0xF218, 0xF21B, 0xF19E, 0xF121, 0xF0A4, 0xF027, 0xEFAA,
-  0xEEAD, 0xEE30, 0xED33, 0xECB6, 0xEBB9, 0xEABB, 0xE9BE, 0xE8C1,
-  0xE7C4, 0xE646, 0xE549, 0xE3CB, 0xE1CE, 0xE050, 0xDDD2, 0xDBD4,
-  0xD956, 0xD6D8, 0xD3DA, 0xD05B, 0xCD5C, 0xC9DD, 0xC5DE, 0xC1DE,
-  0xBE5E, 0xBA5E, 0xB65D, 0xB2DC, 0xAFDB, 0xAC5A, 0xA958, 0xA6D6,
-  0xA454, 0xA252, 0xA050, 0x9E4E, 0x9C4B, 0x9AC9, 0x99C6, 0x9844,
-  0x9741, 0x963E, 0x953B, 0x9439, 0x9336, 0x92B3, 0x91B0, 0x912D,
-  0x902A, 0x8FA7, 0x8F24, 0x8EA1, 0x8E1E, 0x8D9B, 0x8D98, 0x8D15,
-  0x8C92, 0x8C0F, 0x8C0C, 0x8B89, 0x8B06, 0x8B03, 0x8A80, 0x007F,
-  0x007F, 0x007F, 0xF382, 0xF385, 0xF308, 0xF28B, 0xF28E, 0xF211,
-  0xF194, 0xF117, 0xF09A, 0xF01D, 0xEFA0, 0xEF23, 0xEEA6, 0xEE29,
-  0xED2C, 0xECAF, 0xEBB1, 0xEB34, 0xEA37, 0xE93A, 0xE83C, 0xE73F,
-  0xE5C2, 0xE4C4, 0xE347, 0xE1C9, 0xE04B, 0xDE4E, 0xDC50, 0xD9D2,
-  0xD7D4, 0xD4D5, 0xD257, 0xCF58, 0xCC59, 0xC8DA, 0xC55A, 0xC1DB,
-  0xBE5B, 0xBADA, 0xB75A, 0xB3D9, 0xB0D8, 0xADD7, 0xAB55, 0xA854,
-  0xA652, 0xA3D0, 0xA1CE, 0xA04B, 0x9E49, 0x9CC7, 0x9B44, 0x9A42,
-  0x98BF, 0x97BC, 0x96BA, 0x95B7, 0x94B4, 0x9431, 0x932F, 0x92AC,
-  0x91A9, 0x9126, 0x90A3, 0x9020, 0x8F9D, 0x8F1A, 0x8E97, 0x8E14,
-  0x8D91, 0x8D0E, 0x8D0B, 0x8C88, 0x8C05, 0x8C02, 0x007F, 0x007F,
-  0x007F, 0x007F, 0xF281, 0xF284, 0xF207, 0xF18A, 0xF10D, 0xF110,
-  0xF093, 0xF016, 0xEF99, 0xEF1C, 0xEE9F, 0xEE22, 0xED25, 0xECA7,
-  0xEC2A, 0xEB2D, 0xEAB0, 0xE9B3, 0xE8B5, 0xE7B8, 0xE6BB, 0xE5BD,
-  0xE440, 0xE342, 0xE1C5, 0xE047, 0xDE49, 0xDC4B, 0xDA4D, 0xD84F,
-  0xD651, 0xD3D2, 0xD0D4, 0xCE55, 0xCB56, 0xC857, 0xC4D7, 0xC1D7,
-  0xBE57, 0xBB57, 0xB7D7, 0xB4D6, 0xB1D5, 0xAF54, 0xAC52, 0xA9D1,
-  0xA7CF, 0xA5CD, 0xA3CB, 0xA1C9, 0xA047, 0x9E45, 0x9CC2, 0x9BC0,
-  0x9A3D, 0x993B, 0x9838, 0x9735, 0x9633, 0x9530, 0x94AD, 0x93AA,
-  0x9327, 0x92A5, 0x91A2, 0x911F, 0x909C, 0x9019, 0x8F96, 0x8F13,
-  0x8E90, 0x8E8D, 0x8E0A, 0x8D87, 0x8D04, 0x8D01, 0x007F, 0x007F,
-  0x007F, 0x007F, 0xF180, 0xF183, 0xF106, 0xF089, 0xF00C, 0xEF8F,
-  0xEF92, 0xEF15, 0xEE98, 0xED9B, 0xED1D, 0xECA0, 0xEC23, 0xEB26,
-  0xEAA9, 0xE9AC, 0xE92E, 0xE831, 0xE734, 0xE636, 0xE539, 0xE43B,
-  0xE2BE, 0xE140, 0xE042, 0xDE45, 0xDCC7, 0xDAC9, 0xD8CB, 0xD6CC,
-  0xD4CE, 0xD250, 0xCFD1, 0xCD52, 0xCA53, 0xC754, 0xC4D4, 0xC1D4,
-  0xBE54, 0xBB54, 0xB8D4, 0xB5D3, 0xB2D2, 0xB051, 0xADD0, 0xAB4E,
-  0xA94C, 0xA74B, 0xA549, 0xA347, 0xA1C5, 0xA042, 0x9EC0, 0x9D3E,
-  0x9BBB, 0x9AB9, 0x99B6, 0x98B4, 0x97B1, 0x96AE, 0x962C, 0x9529,
-  0x94A6, 0x93A3, 0x9320, 0x929D, 0x921B, 0x9118, 0x9095, 0x9012,
-  0x900F, 0x8F8C, 0x8F09, 0x8E86, 0x8E03, 0x8E00, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0xF082, 0xF005, 0xEF88, 0xEF0B, 0xEE8E,
-  0xEE11, 0xED93, 0xED16, 0xEC99, 0xEC1C, 0xEB9F, 0xEAA2, 0xEA24,
-  0xE927, 0xE8AA, 0xE7AD, 0xE6AF, 0xE5B2, 0xE4B4, 0xE3B7, 0xE2B9,
-  0xE13C, 0xE03E, 0xDEC0, 0xDCC2, 0xDB44, 0xD9C6, 0xD7C8, 0xD5CA,
-  0xD34B, 0xD14D, 0xCECE, 0xCC4F, 0xC9D0, 0xC6D0, 0xC451, 0xC151,
-  0xBED1, 0xBBD1, 0xB950, 0xB650, 0xB3CF, 0xB14E, 0xAECD, 0xACCB,
-  0xAA4A, 0xA848, 0xA646, 0xA4C4, 0xA342, 0xA140, 0xA03E, 0x9EBC,
-  0x9D39, 0x9C37, 0x9B34, 0x9A32, 0x992F, 0x982D, 0x972A, 0x96A7,
-  0x95A4, 0x9522, 0x941F, 0x939C, 0x9319, 0x9296, 0x9213, 0x9191,
-  0x910E, 0x908B, 0x9008, 0x8F85, 0x8F02, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0xEF81, 0xEF04, 0xEE86, 0xEE09, 0xED8C,
-  0xED0F, 0xEC92, 0xEC15, 0xEB98, 0xEB1A, 0xEA1D, 0xE9A0, 0xE923,
-  0xE825, 0xE728, 0xE6AB, 0xE5AD, 0xE4B0, 0xE3B2, 0xE235, 0xE137,
-  0xE039, 0xDEBC, 0xDD3E, 0xDBC0, 0xDA42, 0xD844, 0xD645, 0xD447,
-  0xD248, 0xD04A, 0xCDCB, 0xCBCC, 0xC94D, 0xC6CD, 0xC3CE, 0xC14E,
-  0xBECE, 0xBC4E, 0xB94D, 0xB6CD, 0xB44C, 0xB24B, 0xAFCA, 0xADC8,
-  0xABC7, 0xA9C5, 0xA7C4, 0xA5C2, 0xA440, 0xA2BE, 0xA13C, 0xA039,
-  0x9EB7, 0x9DB5, 0x9C32, 0x9B30, 0x9A2D, 0x992B, 0x98A8, 0x97A5,
-  0x96A3, 0x9620, 0x959D, 0x949A, 0x9418, 0x9395, 0x9312, 0x928F,
-  0x920C, 0x9189, 0x9106, 0x9084, 0x9001, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0xEE02, 0xED85, 0xED08, 0xEC8B,
-  0xEC0E, 0xEB91, 0xEB13, 0xEA96, 0xE999, 0xE91C, 0xE89E, 0xE7A1,
-  0xE724, 0xE626, 0xE529, 0xE42B, 0xE32E, 0xE230, 0xE133, 0xE035,
-  0xDEB7, 0xDD39, 0xDBBB, 0xDA3D, 0xD8BF, 0xD741, 0xD543, 0xD344,
-  0xD146, 0xCF47, 0xCD48, 0xCAC9, 0xC8CA, 0xC64A, 0xC3CA, 0xC14B,
-  0xBECB, 0xBC4A, 0xB9CA, 0xB74A, 0xB549, 0xB2C8, 0xB0C7, 0xAEC6,
-  0xACC4, 0xAAC3, 0xA8C1, 0xA73F, 0xA5BD, 0xA43B, 0xA2B9, 0xA137,
-  0xA035, 0x9EB3, 0x9DB0, 0x9CAE, 0x9BAB, 0x9AA9, 0x99A6, 0x98A4,
-  0x9821, 0x971E, 0x969C, 0x9619, 0x9516, 0x9493, 0x9411, 0x938E,
-  0x930B, 0x9288, 0x9205, 0x9182, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0xED01, 0xEC84, 0xEC07, 0xEB89,
-  0xEB0C, 0xEA8F, 0xEA12, 0xE994, 0xE897, 0xE81A, 0xE71D, 0xE69F,
-  0xE5A2, 0xE524, 0xE427, 0xE329, 0xE22C, 0xE12E, 0xE030, 0xDEB3,
-  0xDDB5, 0xDC37, 0xDAB9, 0xD93B, 0xD7BC, 0xD63E, 0xD440, 0xD241,
-  0xD043, 0xCE44, 0xCC45, 0xCA46, 0xC846, 0xC5C7, 0xC347, 0xC147,
-  0xBEC7, 0xBCC7, 0xBA47, 0xB7C6, 0xB5C6, 0xB3C5, 0xB1C4, 0xAFC3,
-  0xADC1, 0xABC0, 0xA9BE, 0xA83C, 0xA6BB, 0xA539, 0xA3B7, 0xA235,
-  0xA133, 0xA030, 0x9EAE, 0x9DAC, 0x9CA9, 0x9BA7, 0x9AA4, 0x9A22,
-  0x991F, 0x989D, 0x979A, 0x9717, 0x9614, 0x9592, 0x950F, 0x948C,
-  0x9409, 0x9387, 0x9304, 0x9281, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xEB82, 0xEB05, 0xEA88,
-  0xEA0B, 0xE98D, 0xE910, 0xE893, 0xE795, 0xE718, 0xE61B, 0xE59D,
-  0xE4A0, 0xE3A2, 0xE325, 0xE227, 0xE129, 0xE02C, 0xDEAE, 0xDDB0,
-  0xDC32, 0xDB34, 0xD9B6, 0xD838, 0xD6BA, 0xD53B, 0xD33D, 0xD1BE,
-  0xCFC0, 0xCDC1, 0xCBC2, 0xC9C3, 0xC7C3, 0xC544, 0xC344, 0xC144,
-  0xBEC4, 0xBCC4, 0xBAC4, 0xB843, 0xB643, 0xB442, 0xB241, 0xB040,
-  0xAE3E, 0xACBD, 0xAABB, 0xA93A, 0xA7B8, 0xA636, 0xA4B4, 0xA3B2,
-  0xA230, 0xA12E, 0xA02C, 0x9EA9, 0x9DA7, 0x9CA5, 0x9C22, 0x9B20,
-  0x9A1D, 0x999B, 0x9898, 0x9815, 0x9713, 0x9690, 0x960D, 0x958B,
-  0x9508, 0x9485, 0x9402, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xEB01, 0xEA83, 0xE986,
-  0xE909, 0xE88C, 0xE80E, 0xE791, 0xE694, 0xE616, 0xE519, 0xE49B,
-  0xE39E, 0xE2A0, 0xE1A3, 0xE125, 0xE027, 0xDEA9, 0xDDAC, 0xDCAE,
-  0xDB30, 0xDA32, 0xD8B4, 0xD735, 0xD5B7, 0xD439, 0xD23A, 0xD0BB,
-  0xCEBD, 0xCD3E, 0xCB3F, 0xC93F, 0xC740, 0xC541, 0xC341, 0xC141,
-  0xBEC1, 0xBCC1, 0xBAC1, 0xB8C0, 0xB6BF, 0xB4BF, 0xB2BE, 0xB13D,
-  0xAF3B, 0xADBA, 0xABB9, 0xAA37, 0xA8B5, 0xA734, 0xA5B2, 0xA4B0,
-  0xA32E, 0xA22C, 0xA129, 0xA027, 0x9EA5, 0x9E23, 0x9D20, 0x9C1E,
-  0x9B1B, 0x9A99, 0x9996, 0x9914, 0x9811, 0x978E, 0x970C, 0x9689,
-  0x9606, 0x9503, 0x9481, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xE982, 0xE905,
-  0xE807, 0xE78A, 0xE70D, 0xE68F, 0xE592, 0xE514, 0xE417, 0xE399,
-  0xE29C, 0xE19E, 0xE0A0, 0xE023, 0xDEA5, 0xDDA7, 0xDCA9, 0xDBAB,
-  0xDA2D, 0xD92F, 0xD7B1, 0xD633, 0xD4B4, 0xD336, 0xD1B7, 0xD038,
-  0xCE3A, 0xCCBB, 0xCABC, 0xC8BC, 0xC6BD, 0xC4BD, 0xC2BE, 0xC0BE,
-  0xBF3E, 0xBD3E, 0xBB3D, 0xB93D, 0xB73C, 0xB53C, 0xB33B, 0xB1BA,
-  0xAFB8, 0xAE37, 0xACB6, 0xAB34, 0xA9B3, 0xA831, 0xA6AF, 0xA5AD,
-  0xA42B, 0xA329, 0xA227, 0xA125, 0xA023, 0x9F20, 0x9E1E, 0x9D1C,
-  0x9C19, 0x9B97, 0x9A94, 0x9A12, 0x990F, 0x988D, 0x980A, 0x9787,
-  0x9685, 0x9602, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xE880, 0xE803,
-  0xE785, 0xE688, 0xE60B, 0xE58D, 0xE490, 0xE412, 0xE315, 0xE297,
-  0xE19A, 0xE09C, 0xE01E, 0xDF20, 0xDE23, 0xDCA5, 0xDBA7, 0xDAA9,
-  0xD92B, 0xD82D, 0xD6AE, 0xD530, 0xD431, 0xD2B3, 0xD0B4, 0xCF36,
-  0xCDB7, 0xCBB8, 0xCA38, 0xC839, 0xC6BA, 0xC4BA, 0xC2BB, 0xC0BB,
-  0xBF3B, 0xBD3B, 0xBB3A, 0xB93A, 0xB7B9, 0xB5B8, 0xB438, 0xB237,
-  0xB0B6, 0xAF34, 0xAD33, 0xABB1, 0xAAB0, 0xA92E, 0xA7AD, 0xA6AB,
-  0xA529, 0xA427, 0xA325, 0xA1A3, 0xA0A0, 0xA01E, 0x9F1C, 0x9E1A,
-  0x9D17, 0x9C95, 0x9B92, 0x9B10, 0x9A0D, 0x998B, 0x9908, 0x9805,
-  0x9783, 0x9700, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xE701,
-  0xE684, 0xE606, 0xE509, 0xE48B, 0xE40E, 0xE310, 0xE293, 0xE195,
-  0xE097, 0xE01A, 0xDF1C, 0xDE1E, 0xDD20, 0xDC22, 0xDAA4, 0xD9A6,
-  0xD8A8, 0xD72A, 0xD62C, 0xD4AD, 0xD32F, 0xD1B0, 0xD031, 0xCEB3,
-  0xCD34, 0xCB35, 0xC9B5, 0xC836, 0xC637, 0xC4B7, 0xC2B7, 0xC0B7,
-  0xBF37, 0xBD37, 0xBB37, 0xB9B7, 0xB7B6, 0xB635, 0xB4B5, 0xB2B4,
-  0xB133, 0xAFB1, 0xAE30, 0xACAF, 0xAB2D, 0xA9AC, 0xA8AA, 0xA728,
-  0xA626, 0xA524, 0xA3A2, 0xA2A0, 0xA19E, 0xA09C, 0xA01A, 0x9F17,
-  0x9E15, 0x9D13, 0x9C90, 0x9B8E, 0x9B0B, 0x9A89, 0x9986, 0x9904,
-  0x9881, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0xE582, 0xE504, 0xE487, 0xE389, 0xE30C, 0xE20E, 0xE191, 0xE093,
-  0xE015, 0xDF17, 0xDE1A, 0xDD1C, 0xDC1E, 0xDB20, 0xDA22, 0xD8A4,
-  0xD7A5, 0xD6A7, 0xD529, 0xD3AA, 0xD2AC, 0xD12D, 0xCFAE, 0xCE30,
-  0xCCB1, 0xCAB1, 0xC932, 0xC7B3, 0xC633, 0xC434, 0xC2B4, 0xC0B4,
-  0xBF34, 0xBD34, 0xBBB4, 0xB9B3, 0xB833, 0xB6B2, 0xB531, 0xB331,
-  0xB1B0, 0xB02E, 0xAEAD, 0xAD2C, 0xAC2A, 0xAAA9, 0xA927, 0xA825,
-  0xA724, 0xA5A2, 0xA4A0, 0xA39E, 0xA29C, 0xA19A, 0xA097, 0xA015,
-  0x9F13, 0x9E11, 0x9D8E, 0x9C8C, 0x9C09, 0x9B07, 0x9A84, 0x9A02,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0xE500, 0xE402, 0xE385, 0xE307, 0xE20A, 0xE18C, 0xE08E, 0xE011,
-  0xDF13, 0xDE15, 0xDD17, 0xDC19, 0xDB1B, 0xDA1D, 0xD91F, 0xD821,
-  0xD6A3, 0xD5A4, 0xD4A6, 0xD327, 0xD1A9, 0xD02A, 0xCF2B, 0xCDAD,
-  0xCC2E, 0xCAAE, 0xC8AF, 0xC730, 0xC5B0, 0xC431, 0xC231, 0xC0B1,
-  0xBF31, 0xBDB1, 0xBBB1, 0xBA30, 0xB8B0, 0xB72F, 0xB52E, 0xB3AE,
-  0xB22D, 0xB0AB, 0xAFAA, 0xAE29, 0xACA7, 0xAB26, 0xAA24, 0xA923,
-  0xA7A1, 0xA69F, 0xA59D, 0xA49B, 0xA399, 0xA297, 0xA195, 0xA093,
-  0xA011, 0x9F0E, 0x9E0C, 0x9D8A, 0x9C87, 0x9C05, 0x9B82, 0x9A80,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0xE380, 0xE283, 0xE205, 0xE187, 0xE08A, 0xE00C, 0xDF0E,
-  0xDE11, 0xDD13, 0xDC95, 0xDB97, 0xDA99, 0xD99B, 0xD89D, 0xD71E,
-  0xD620, 0xD522, 0xD3A3, 0xD2A5, 0xD126, 0xCFA7, 0xCEA8, 0xCD29,
-  0xCBAA, 0xCA2B, 0xC8AC, 0xC72D, 0xC5AD, 0xC3AE, 0xC22E, 0xC0AE,
-  0xBF2E, 0xBDAE, 0xBC2E, 0xBA2D, 0xB8AD, 0xB72C, 0xB5AB, 0xB42A,
-  0xB2A9, 0xB128, 0xB027, 0xAEA6, 0xAD25, 0xAC23, 0xAAA2, 0xA9A0,
-  0xA89E, 0xA71D, 0xA61B, 0xA519, 0xA417, 0xA315, 0xA293, 0xA191,
-  0xA08E, 0xA00C, 0x9F0A, 0x9E07, 0x9D85, 0x9D03, 0x9C00, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0xE201, 0xE103, 0xE085, 0xE008, 0xDF0A, 0xDE0C,
-  0xDD8E, 0xDC90, 0xDB92, 0xDA94, 0xD996, 0xD898, 0xD79A, 0xD69C,
-  0xD59D, 0xD41F, 0xD320, 0xD1A2, 0xD0A3, 0xCF24, 0xCE25, 0xCCA6,
-  0xCB27, 0xC9A8, 0xC829, 0xC6A9, 0xC52A, 0xC3AA, 0xC22B, 0xC0AB,
-  0xBF2B, 0xBDAB, 0xBC2A, 0xBAAA, 0xB929, 0xB7A9, 0xB628, 0xB4A7,
-  0xB326, 0xB1A5, 0xB0A4, 0xAF23, 0xAE22, 0xACA0, 0xAB9F, 0xAA1D,
-  0xA91C, 0xA81A, 0xA718, 0xA616, 0xA514, 0xA412, 0xA310, 0xA20E,
-  0xA18C, 0xA08A, 0xA008, 0x9F05, 0x9E83, 0x9D81, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0xE081, 0xE003, 0xDF05, 0xDE07, 0xDD8A,
-  0xDC8C, 0xDB8E, 0xDB10, 0xDA12, 0xD914, 0xD815, 0xD717, 0xD619,
-  0xD49A, 0xD39C, 0xD29D, 0xD11F, 0xD020, 0xCEA1, 0xCDA2, 0xCC23,
-  0xCAA4, 0xC925, 0xC826, 0xC6A6, 0xC527, 0xC3A7, 0xC227, 0xC0A7,
-  0xBF27, 0xBDA7, 0xBC27, 0xBAA7, 0xB926, 0xB7A6, 0xB6A5, 0xB524,
-  0xB3A3, 0xB222, 0xB121, 0xAFA0, 0xAE9F, 0xAD1D, 0xAC1C, 0xAB1A,
-  0xA999, 0xA897, 0xA795, 0xA694, 0xA592, 0xA490, 0xA40E, 0xA30C,
-  0xA20A, 0xA187, 0xA085, 0xA003, 0x9F01, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0xDF01, 0xDE83, 0xDD85, 0xDC87,
-  0xDC09, 0xDB0B, 0xDA0D, 0xD90F, 0xD811, 0xD713, 0xD614, 0xD516,
-  0xD418, 0xD319, 0xD21B, 0xD09C, 0xCF9D, 0xCE1E, 0xCD1F, 0xCBA0,
-  0xCA21, 0xC922, 0xC7A3, 0xC623, 0xC4A4, 0xC3A4, 0xC224, 0xC0A4,
-  0xBF24, 0xBDA4, 0xBC24, 0xBB24, 0xB9A3, 0xB823, 0xB6A2, 0xB5A1,
-  0xB420, 0xB29F, 0xB19E, 0xB01D, 0xAF1C, 0xAD9B, 0xAC99, 0xAB98,
-  0xAA96, 0xA994, 0xA893, 0xA791, 0xA68F, 0xA58D, 0xA48B, 0xA389,
-  0xA307, 0xA205, 0xA103, 0xA081, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xDD81, 0xDD03, 0xDC05,
-  0xDB07, 0xDA89, 0xD98B, 0xD88D, 0xD78E, 0xD690, 0xD592, 0xD493,
-  0xD395, 0xD296, 0xD118, 0xD019, 0xCF1A, 0xCD9B, 0xCC9C, 0xCB1D,
-  0xCA1E, 0xC89F, 0xC79F, 0xC620, 0xC4A0, 0xC321, 0xC221, 0xC0A1,
-  0xBF21, 0xBDA1, 0xBCA1, 0xBB20, 0xB9A0, 0xB81F, 0xB71F, 0xB59E,
-  0xB49D, 0xB31C, 0xB21B, 0xB09A, 0xAF99, 0xAE98, 0xAD16, 0xAC15,
-  0xAB13, 0xAA12, 0xA910, 0xA80E, 0xA70D, 0xA60B, 0xA509, 0xA487,
-  0xA385, 0xA283, 0xA201, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xDC00, 0xDB82,
-  0xDA84, 0xD986, 0xD908, 0xD80A, 0xD70C, 0xD60D, 0xD50F, 0xD411,
-  0xD312, 0xD213, 0xD095, 0xCF96, 0xCE97, 0xCD98, 0xCC19, 0xCB1A,
-  0xC99B, 0xC89C, 0xC71C, 0xC59D, 0xC49D, 0xC31E, 0xC21E, 0xC09E,
-  0xBF1E, 0xBD9E, 0xBC9E, 0xBB1D, 0xBA1D, 0xB89C, 0xB71C, 0xB61B,
-  0xB49A, 0xB399, 0xB218, 0xB117, 0xB016, 0xAF15, 0xAD93, 0xAC92,
-  0xAB91, 0xAA8F, 0xA98D, 0xA88C, 0xA78A, 0xA688, 0xA606, 0xA504,
-  0xA402, 0xA380, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xDA80,
-  0xDA02, 0xD904, 0xD805, 0xD787, 0xD689, 0xD58B, 0xD48C, 0xD38E,
-  0xD28F, 0xD191, 0xD012, 0xCF13, 0xCE14, 0xCD15, 0xCB96, 0xCA97,
-  0xC998, 0xC819, 0xC719, 0xC59A, 0xC49A, 0xC31A, 0xC19B, 0xC09B,
-  0xBF1B, 0xBE1B, 0xBC9A, 0xBB1A, 0xBA1A, 0xB899, 0xB799, 0xB618,
-  0xB517, 0xB416, 0xB295, 0xB194, 0xB093, 0xAF92, 0xAE11, 0xAD0F,
-  0xAC0E, 0xAB0C, 0xAA0B, 0xA909, 0xA807, 0xA785, 0xA684, 0xA582,
-  0xA500, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0xD881, 0xD783, 0xD685, 0xD606, 0xD508, 0xD409, 0xD30B,
-  0xD20C, 0xD10E, 0xD00F, 0xCE90, 0xCD91, 0xCC92, 0xCB93, 0xCA14,
-  0xC915, 0xC815, 0xC696, 0xC597, 0xC417, 0xC317, 0xC197, 0xC097,
-  0xBF17, 0xBE17, 0xBC97, 0xBB97, 0xBA17, 0xB916, 0xB795, 0xB695,
-  0xB594, 0xB413, 0xB312, 0xB211, 0xB110, 0xAF8F, 0xAE8E, 0xAD8C,
-  0xAC8B, 0xAB89, 0xAA88, 0xA986, 0xA905, 0xA803, 0xA701, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0xD700, 0xD602, 0xD503, 0xD485, 0xD387, 0xD288,
-  0xD189, 0xD08B, 0xCF8C, 0xCE8D, 0xCD0E, 0xCC0F, 0xCB10, 0xCA11,
-  0xC892, 0xC792, 0xC693, 0xC513, 0xC414, 0xC314, 0xC194, 0xC094,
-  0xBF14, 0xBE14, 0xBC94, 0xBB94, 0xBA93, 0xB913, 0xB812, 0xB712,
-  0xB591, 0xB490, 0xB38F, 0xB28E, 0xB10D, 0xB00C, 0xAF0B, 0xAE09,
-  0xAD08, 0xAC07, 0xAB05, 0xAA83, 0xA982, 0xA880, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0xD481, 0xD402, 0xD304, 0xD205,
-  0xD106, 0xD008, 0xCF09, 0xCE0A, 0xCD0B, 0xCC0C, 0xCA8D, 0xC98E,
-  0xC88F, 0xC78F, 0xC610, 0xC510, 0xC411, 0xC291, 0xC191, 0xC091,
-  0xBF11, 0xBE11, 0xBD11, 0xBB91, 0xBA90, 0xB990, 0xB80F, 0xB70F,
-  0xB60E, 0xB50D, 0xB38C, 0xB28B, 0xB18A, 0xB089, 0xAF88, 0xAE86,
-  0xAD85, 0xAC84, 0xAB82, 0xAB01, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xD281, 0xD182,
-  0xD084, 0xCF85, 0xCE86, 0xCD87, 0xCC88, 0xCB89, 0xCA8A, 0xC98B,
-  0xC80B, 0xC70C, 0xC60D, 0xC50D, 0xC40D, 0xC28E, 0xC18E, 0xC08E,
-  0xBF0E, 0xBE0E, 0xBD0E, 0xBB8D, 0xBA8D, 0xB98D, 0xB88C, 0xB78B,
-  0xB60B, 0xB50A, 0xB409, 0xB308, 0xB207, 0xB106, 0xB005, 0xAF04,
-  0xAE02, 0xAD01, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0xD001, 0xCF02, 0xCE03, 0xCD04, 0xCC05, 0xCB06, 0xCA07, 0xC908,
-  0xC808, 0xC709, 0xC609, 0xC48A, 0xC38A, 0xC28A, 0xC18B, 0xC08B,
-  0xBF0B, 0xBE0B, 0xBD0A, 0xBC0A, 0xBB0A, 0xB989, 0xB889, 0xB788,
-  0xB688, 0xB587, 0xB486, 0xB385, 0xB284, 0xB183, 0xB082, 0xAF81,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0xCE00, 0xCD01, 0xCC02, 0xCB03, 0xCA04, 0xC904,
-  0xC805, 0xC686, 0xC586, 0xC487, 0xC387, 0xC287, 0xC187, 0xC087,
-  0xBF07, 0xBE07, 0xBD07, 0xBC07, 0xBB07, 0xBA06, 0xB906, 0xB785,
-  0xB684, 0xB584, 0xB483, 0xB382, 0xB281, 0xB180, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0xCA80, 0xC981, 0xC881,
-  0xC782, 0xC683, 0xC583, 0xC483, 0xC384, 0xC284, 0xC184, 0xC084,
-  0xBF04, 0xBE04, 0xBD04, 0xBC04, 0xBB03, 0xBA03, 0xB903, 0xB802,
-  0xB701, 0xB601, 0xB500, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0xC580, 0xC480, 0xC381, 0xC281, 0xC181, 0xC081,
-  0xBF01, 0xBE01, 0xBD01, 0xBC01, 0xBB00, 0xBA00, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
-  0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F };
+extern const uint16_t polar[IRIS_WIDTH * IRIS_HEIGHT] asm("terminatorEye_polar");
@@ -0,0 +1,94 @@
+// Frame deadline controller, enabled with #define DEADLINE in config.h.
+//
+// Render cost varies a lot between frames: rows the eyelids cover are
+// cleared without touching any table, iris rows cost more than sclera
+// rows, and large assets (512-wide iris maps) make the difference worse.
+// Before each eye frame, dlWork() counts the open and iris rows for the
+// current gaze and lid thresholds, and dlChoose() predicts the cost in
+// every render mode from a per-eye, per-mode rate learned from the last
+// frames (dlRecord()).  A frame predicted to miss the deadline of
+// 1/(DEADLINE * NUM_EYES) s is degraded instead of stalling the other eye:
+//  - to the highest reduced resolution that fits (RENDER_HALF_X, then
+//    RENDER_HALF: every other column, then also every other row computed),
+//  - or, if even RENDER_HALF won't fit, by skipping that eye's update for
+//    one frame (the panel keeps the last image).  Never twice in a row.
+// A mode that hasn't been timed yet is tried when the one above it
+// overruns, so the model learns it.
+//
+// dlReport() (serial 'd') prints how often each degradation kicked in.
+//
+// Include after eyeRender.h.
+
+#pragma once
+
+#include <stdint.h>
+
+#define DL_SKIP      (RENDER_HALF + 1) // dlChoose(): don't render this frame
+#define DL_OPEN_W    4 // Cost units of an open row (a covered row is 1)
+#define DL_IRIS_W    4 // Extra units of an open row through the iris
+#define DL_MARGIN    5 // % of the deadline kept as margin for frame logic
+
+typedef struct {
+  uint32_t rate[NUM_EYES][RENDER_HALF + 1]; // us per 256 units, 0 = untimed
+  uint32_t count[NUM_EYES][DL_SKIP + 1];    // Frames rendered per mode, skipped
+  uint32_t degraded[NUM_EYES];              // Frames below the requested mode
+  uint32_t overruns[NUM_EYES];              // Frames over the deadline anyway
+  uint8_t  skipped[NUM_EYES];               // Last frame was skipped
+} deadline_t;
+
+static deadline_t dl;
+
+static inline uint32_t dlBudget(void) {
+  return 1000000UL * (100 - DL_MARGIN) / (100UL * DEADLINE * NUM_EYES);
+}
+
+// Cost units of a frame at sclera row scleraY with lid thresholds uT/lT
+static uint32_t dlWork(uint32_t scleraY, uint32_t uT, uint32_t lT) {
+  uint32_t units = EYE_HEIGHT;
+  for (uint32_t y = 0; y < EYE_HEIGHT; y++) {
+    const uint32_t rowMax = lidRowMax[y];
+    if (((rowMax & 0xFF) <= lT) || ((rowMax >> 8) <= uT)) continue; // Covered
+    units += DL_OPEN_W;
+    if ((uint32_t)(scleraY + ((y * EYE_STEP_Y) >> 16) - IRIS_Y0) < IRIS_HEIGHT)
+      units += DL_IRIS_W;
+  }
+  return units;
+}
+
+static inline uint32_t dlPredict(uint8_t e, uint8_t mode, uint32_t units) {
+  return (dl.rate[e][mode] * units) >> 8;
+}
+
+// Render mode for eye e's next frame (mode is the one requested, units
+// from dlWork()), or DL_SKIP
+static uint8_t dlChoose(uint8_t e, uint8_t mode, uint32_t units) {
+  const uint32_t budget = dlBudget();
+  uint8_t        m      = mode;
+  while ((m < RENDER_HALF) && dl.rate[e][m] && (dlPredict(e, m, units) > budget)) m++;
+  if (dl.rate[e][m] && (dlPredict(e, m, units) > budget) && !dl.skipped[e]) m = DL_SKIP;
+  dl.skipped[e] = (m == DL_SKIP);
+  dl.count[e][m]++;
+  if (m != mode) dl.degraded[e]++;
+  return m;
+}
+
+// Measured cost of a frame rendered by eye e in mode, for units of work
+static void dlRecord(uint8_t e, uint8_t mode, uint32_t units, uint32_t us) {
+  uint32_t r = (us << 8) / units;
+  if (!dl.rate[e][mode]) dl.rate[e][mode] = r;              // First timing
+  else dl.rate[e][mode] += ((int32_t)(r - dl.rate[e][mode])) / 8; // EWMA 1/8
+  if (us > dlBudget() * 100 / (100 - DL_MARGIN)) dl.overruns[e]++;
+}
+
+static void dlReport(void) {
+  static const char *names[DL_SKIP + 1] = { "full", "halfX", "half", "skip" };
+  for (uint8_t e = 0; e < NUM_EYES; e++) {
+    Serial.printf("Deadline eye %u (%lu us):", e, (unsigned long)dlBudget());
+    for (uint8_t m = 0; m <= DL_SKIP; m++)
+      Serial.printf(" %s %lu", names[m], (unsigned long)dl.count[e][m]);
+    Serial.printf(", %lu degraded, %lu overran\n", (unsigned long)dl.degraded[e],
+                  (unsigned long)dl.overruns[e]);
+    memset(dl.count[e], 0, sizeof dl.count[e]);
+    dl.degraded[e] = dl.overruns[e] = 0;
+  }
+}
@@ -0,0 +1,162 @@
+// Eye rendering kernel, shared by drawEye() and host-side tools.
+//
+// The eye tables in data/ are drawn for a 128x128 (SCREEN_WIDTH x
+// SCREEN_HEIGHT) view; tools/assetc can regenerate them for other sizes.
+// The kernel renders that view at EYE_WIDTH x EYE_HEIGHT output pixels,
+// stepping through the sclera, iris and eyelid tables in 16.16 fixed
+// point, so a 160x160 eye fills the whole panel with the same artwork
+// magnified 1.25x.
+//
+// To keep the larger eye at least as fast as the old 128x128 loop, the
+// per-pixel work is trimmed:
+//  - Both eyelid maps are resampled once at startup into one RAM table at
+//    output resolution (lower in the low byte, upper in the high byte), so
+//    each pixel does a single RAM load instead of two flash reads and the
+//    lid tables no longer compete with sclera/iris for the flash cache.
+//  - Rows that one eyelid covers completely are detected from per-row
+//    maxima and cleared without touching any pixel tables.
+//  - The iris distance scaling (a multiply and divide per iris pixel) is
+//    folded into a 128-entry lookup, kept in an eyeIrisCache_t and only
+//    rebuilt when the iris scale changes, so all eyes drawn at the same
+//    scale share one.
+//
+// Include after config.h (the eye data header must already be included).
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef pgm_read_byte
+  #define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#endif
+#ifndef pgm_read_word
+  #define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#endif
+
+// Eyelid map reads.  Tables generated with "assetc --lids merged"
+// (EYE_ASSET_LIDS) hold both maps in one u16 table, lower | upper << 8.
+#ifdef EYE_ASSET_LIDS
+  #define LID_UPPER(i) (pgm_read_word(lids + (i)) >> 8)
+  #define LID_LOWER(i) (pgm_read_word(lids + (i)) & 0xFF)
+#else
+  #define LID_UPPER(i) pgm_read_byte(upper + (i))
+  #define LID_LOWER(i) pgm_read_byte(lower + (i))
+#endif
+
+#if !defined(EYE_WIDTH)
+  #define EYE_WIDTH  SCREEN_WIDTH // Output size, defaults to native table size
+#endif
+#if !defined(EYE_HEIGHT)
+  #define EYE_HEIGHT SCREEN_HEIGHT
+#endif
+
+// Table pixels per output pixel, 16.16 fixed point
+#define EYE_STEP_X (((uint32_t)SCREEN_WIDTH  << 16) / EYE_WIDTH)
+#define EYE_STEP_Y (((uint32_t)SCREEN_HEIGHT << 16) / EYE_HEIGHT)
+
+#define IRIS_X0 ((SCLERA_WIDTH  - IRIS_WIDTH)  / 2) // Iris position in sclera
+#define IRIS_Y0 ((SCLERA_HEIGHT - IRIS_HEIGHT) / 2)
+#define NO_IRIS 0xFFFF // irisLut[] entry for distances outside the iris map
+
+static uint16_t lidMap[EYE_HEIGHT * EYE_WIDTH]; // lower | upper << 8
+static uint16_t lidRowMax[EYE_HEIGHT];          // Per-row maxima, same layout
+
+typedef struct {        // Everything drawEye() needs for one eye, one frame
+  uint32_t scleraX;     // First pixel X offset into sclera image
+  uint32_t scleraY;     // First pixel Y offset into sclera image
+  uint32_t uT;          // Upper eyelid threshold value
+  uint32_t lT;          // Lower eyelid threshold value
+  bool     mirror;      // Read eyelid maps right-to-left
+  const uint16_t *irisLut; // Polar distance -> iris map row offset
+} eyeFrame_t;
+
+typedef struct {        // irisLut for the last iris scale asked for
+  uint32_t iScale;      // 0 = empty
+  uint16_t lut[128];
+} eyeIrisCache_t;
+
+// Resample the eyelid maps to output resolution.  Call once at startup.
+static void initEyeTables(void) {
+  for (uint32_t y = 0; y < EYE_HEIGHT; y++) {
+    const uint32_t ly = ((y * EYE_STEP_Y) >> 16) * SCREEN_WIDTH;
+    uint32_t rowMax = 0;
+    for (uint32_t x = 0; x < EYE_WIDTH; x++) {
+      const uint32_t lx = (x * EYE_STEP_X) >> 16;
+      const uint32_t lo = LID_LOWER(ly + lx);
+      const uint32_t up = LID_UPPER(ly + lx);
+      lidMap[y * EYE_WIDTH + x] = lo | up << 8;
+      if (lo > (rowMax & 0xFF)) rowMax = (rowMax & 0xFF00) | lo;
+      if (up > (rowMax >> 8))   rowMax = (rowMax & 0x00FF) | up << 8;
+    }
+    lidRowMax[y] = rowMax;
+  }
+}
+
+// Per-eye, per-frame setup ahead of renderEyeRow().  f uses the cache's
+// lookup table, which must stay unchanged until the frame is rendered.
+static void eyeFrameSetup(eyeFrame_t *f, eyeIrisCache_t *cache, bool mirror,
+                          uint32_t iScale, uint32_t scleraX, uint32_t scleraY,
+                          uint32_t uT, uint32_t lT) {
+  f->scleraX = scleraX;
+  f->scleraY = scleraY;
+  f->uT      = uT;
+  f->lT      = lT;
+  f->mirror  = mirror;
+  f->irisLut = cache->lut;
+  if (cache->iScale == iScale) return;
+  cache->iScale = iScale;
+  for (uint32_t p = 0; p < 128; p++) {
+    uint32_t d = (iScale * p) / 128;                       // Distance (Y)
+    cache->lut[p] = (d < IRIS_MAP_HEIGHT) ? d * IRIS_MAP_WIDTH : NO_IRIS;
+  }
+}
+
+// Render output row y.  STEP 1 computes every pixel; STEP 2 computes every
+// other pixel and doubles it, sampling the same positions as STEP 1 so the
+// reduced-resolution image doesn't shift.  dst receives EYE_WIDTH pixels,
+// stored with PIXEL_OUT() (defined in pixelFormat.h).
+template <uint32_t STEP>
+static inline void renderEyeRow(uint16_t *dst, const eyeFrame_t *f, uint32_t y) {
+  const uint32_t lT = f->lT, uT = f->uT;
+  const uint32_t rowMax = lidRowMax[y];
+  if (((rowMax & 0xFF) <= lT) || ((rowMax >> 8) <= uT)) { // Lid covers row
+    memset(dst, 0, EYE_WIDTH * sizeof(uint16_t));
+    return;
+  }
+
+  const uint32_t  scleraY = f->scleraY + ((y * EYE_STEP_Y) >> 16);
+  const int32_t   irisY   = scleraY - IRIS_Y0;
+  const uint16_t *scleraRow = sclera + scleraY * SCLERA_WIDTH;
+  const bool      inIrisRow = (uint32_t)irisY < IRIS_HEIGHT;
+  const uint16_t *polarRow  = inIrisRow ? polar + irisY * IRIS_WIDTH : polar;
+  const uint16_t *lid  = lidMap + y * EYE_WIDTH;
+  int32_t         lidX = f->mirror ? EYE_WIDTH - 1 : 0;
+  const int32_t   dlidX = (f->mirror ? -1 : 1) * (int32_t)STEP;
+  uint32_t        sxf  = f->scleraX << 16;  // Sclera X, 16.16
+  uint32_t        sx, ix, l, p;
+
+  for (uint32_t x = 0; x < EYE_WIDTH; x += STEP, lidX += dlidX,
+       sxf += STEP * EYE_STEP_X) {
+    l = lid[lidX];
+    if (((l & 0xFF) <= lT) || ((l >> 8) <= uT)) { // Covered by eyelid
+      p = 0;
+    } else {
+      sx = sxf >> 16;
+      ix = sx - IRIS_X0;
+      if (inIrisRow && (ix < IRIS_WIDTH)) {        // Maybe iris...
+        p = pgm_read_word(polarRow + ix);          // Polar angle/dist
+        uint32_t d = f->irisLut[p & 0x7F];
+        if (d != NO_IRIS) {                        // Within iris area
+          p = pgm_read_word(iris + d + (IRIS_MAP_WIDTH * (p >> 7)) / 512);
+        } else {                                   // Not in iris
+          p = pgm_read_word(scleraRow + sx);
+        }
+      } else {                                     // In sclera
+        p = pgm_read_word(scleraRow + sx);
+      }
+    }
+    *dst++ = PIXEL_OUT(p);
+    if (STEP == 2) *dst++ = PIXEL_OUT(p);
+  }
+}
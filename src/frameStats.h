@@ -0,0 +1,69 @@
+// Frame-time histograms, enabled with #define FRAME_STATS in config.h.
+//
+// Averages hide the stutters (blinks, saccade starts), so each eye keeps two
+// log-bucketed histograms in static RAM: the time frame() spent on it and
+// the interval between its successive frames.  Buckets cover an octave in
+// four steps (about 19% resolution) from 4 us up to ~1 s, so recording is a
+// count-leading-zeros, a shift and an increment.
+//
+// Serial commands (see debugCommand() in main.cpp):
+//   'h'  one line per eye and histogram:
+//        F<eye> <ft|if> n=<count> p50=<us> p99=<us> max=<us> <bucket>:<count>...
+//        where bucket is the index passed to statsBucketUs() below
+//   'r'  clear all histograms
+//
+// Include after config.h (histogram count depends on NUM_EYES).
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define STATS_BUCKETS 80 // 4 per octave up to 2^20 us, last one open-ended
+
+typedef struct {
+  uint32_t count[STATS_BUCKETS];
+  uint32_t total;       // Samples recorded
+  uint32_t max;         // Largest sample, micros
+} statsHist_t;
+
+static statsHist_t frameTimeHist[NUM_EYES]; // Start of frame() to end of render
+static statsHist_t intervalHist[NUM_EYES];  // Start to start, same eye
+
+// Bucket index for a sample: exact below 4 us, then the top three bits
+static inline uint32_t statsBucket(uint32_t us) {
+  if (us < 4) return us;
+  uint32_t msb = 31 - __builtin_clz(us);
+  uint32_t b   = (msb - 1) * 4 + ((us >> (msb - 2)) & 3);
+  return (b < STATS_BUCKETS) ? b : STATS_BUCKETS - 1;
+}
+
+// Upper bound (micros) of the samples in bucket b
+static inline uint32_t statsBucketUs(uint32_t b) {
+  if (b < 4) return b;
+  uint32_t msb = b / 4 + 1;
+  return ((4 + (b & 3) + 1) << (msb - 2)) - 1;
+}
+
+static inline void statsRecord(statsHist_t *h, uint32_t us) {
+  h->count[statsBucket(us)]++;
+  h->total++;
+  if (us > h->max) h->max = us;
+}
+
+// Upper bound of the bucket holding the given percentile (0-100)
+static uint32_t statsPercentile(const statsHist_t *h, uint32_t pct) {
+  uint32_t want = (uint32_t)(((uint64_t)h->total * pct + 99) / 100), seen = 0;
+  for (uint32_t b = 0; b < STATS_BUCKETS; b++) {
+    if ((seen += h->count[b]) >= want && seen) {
+      uint32_t us = statsBucketUs(b);
+      return (us < h->max) ? us : h->max;
+    }
+  }
+  return h->max;
+}
+
+static inline void statsReset(void) {
+  memset(frameTimeHist, 0, sizeof frameTimeHist);
+  memset(intervalHist,  0, sizeof intervalHist);
+}
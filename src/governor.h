@@ -0,0 +1,200 @@
+// Power-aware frame governor, enabled with #define GOVERNOR in config.h.
+//
+// Without it the eyes render flat out and the CPU never rests, even while
+// the eye holds perfectly still between saccades.  The governor paces
+// frame() to GOV_FPS_MAX frames/s per eye while anything on screen is
+// changing, and to GOV_FPS_MIN once nothing has for GOV_HOLD ms.  The
+// rest of each frame interval is spent waiting: delay() hands it to the
+// idle task, which halts the core until the next interrupt, and while slow
+// the CPU clock also drops to GOV_SLOW_MHZ (the APB clock, and with it the
+// SPI clock, stays at 80 MHz).  With #define GOV_LIGHT_SLEEP in config.h,
+// waits of GOV_SLEEP_MIN or more use light sleep instead: USB CDC drops
+// out while asleep, and only button pins registered with govWakePin()
+// wake the chip early.  GPIO wakeup needs a level interrupt type on the
+// pin, which would make the CHANGE interrupt of a held button fire
+// continuously, so the pins are switched to low-level wakeup (with their
+// interrupt masked) only around esp_light_sleep_start() and back to any
+// edge straight after; frame() then resyncs the buttons.  A button already
+// held down doesn't wake the chip, its release is seen after the timer.
+//
+// govActivity() marks a change: gaze, lid or iris moving by more than
+// GOV_STILL between frames of an eye, a blink, a button or a serial
+// command.  The frame being drawn then goes out at full
+// rate and clock, and a wait in progress ends early when the wake test
+// passed to govWait() sees pending input.  Changes known in advance (the
+// next saccade or blink already queued) are passed to govDue(): no wait
+// runs past that time, and the frame drawn then counts as activity, so a
+// 72 ms saccade isn't half over before the first slow-rate frame sees it.
+//
+// govReport() (serial 'g') prints active, idle and sleep time since the
+// last report, the share of frames at full rate and a current estimate
+// from GOV_UA_* -- rough CPU-only figures for a C3 module, displays and
+// backlight not included; replace them with measured ones.
+//
+// Include after config.h.
+
+#pragma once
+
+#include <stdint.h>
+#ifdef GOV_LIGHT_SLEEP
+  #include <esp_sleep.h>
+  #include <driver/gpio.h>
+#endif
+
+#ifndef GOV_FPS_MAX
+  #define GOV_FPS_MAX   60  // Frames/s per eye while anything changes
+#endif
+#ifndef GOV_FPS_MIN
+  #define GOV_FPS_MIN   10  // Frames/s per eye while still
+#endif
+#define GOV_HOLD        300  // ms without activity before slowing down
+#define GOV_STILL       1    // Largest gaze/lid/iris step that isn't activity
+#define GOV_SLOW_MHZ    80   // CPU clock while slow
+#define GOV_SLICE       2    // ms per wait step, wake test in between
+#define GOV_SLEEP_MIN   5000 // us, shortest wait spent in light sleep
+#define GOV_UA_ACTIVE   24000 // uA, running at full clock
+#define GOV_UA_IDLE     9000  // uA, halted in the idle task
+#define GOV_UA_SLEEP    200   // uA, light sleep
+
+typedef struct {
+  uint32_t lastActivity; // micros() of the last change
+  uint32_t next;         // Earliest start of the next frame
+  uint32_t mark;         // End of the last accounted period
+  uint32_t fastMhz;      // CPU clock at full rate
+  uint32_t due;          // Next change known in advance
+  uint8_t  slow;
+  uint8_t  hasDue;
+  uint64_t activeUs, idleUs, sleepUs;
+  uint32_t frames, fastFrames, sleeps;
+#ifdef GOV_LIGHT_SLEEP
+  int8_t   wakePin[NUM_EYES + 1]; // Wink buttons and the blink button
+  uint8_t  wakePins;
+#endif
+} governor_t;
+
+static governor_t gov;
+
+static void govInit(void) {
+  gov.fastMhz      = getCpuFrequencyMhz();
+  gov.mark         = gov.next = micros();
+  gov.lastActivity = gov.mark;
+}
+
+// Something on screen changed or input arrived (any task)
+static inline void govActivity(uint32_t t) {
+  __atomic_store_n(&gov.lastActivity, t, __ATOMIC_RELAXED);
+}
+
+// A change is scheduled for time t (render task, before govFrame())
+static inline void govDue(uint32_t t) {
+  if (!gov.hasDue || ((int32_t)(t - gov.due) < 0)) gov.due = t;
+  gov.hasDue = 1;
+}
+
+// Before rendering a frame that started at t: pick the rate, and the full
+// clock again at once if anything happened
+static void govFrame(uint32_t t) {
+  if (gov.hasDue && ((int32_t)(t + 1000 - gov.due) >= 0)) { // Scheduled change starts
+    govActivity(t);
+    gov.hasDue = 0;
+  }
+  uint8_t slow = (t - __atomic_load_n(&gov.lastActivity, __ATOMIC_RELAXED)) >= GOV_HOLD * 1000UL;
+  if (slow != gov.slow) {
+    setCpuFrequencyMhz(slow ? GOV_SLOW_MHZ : gov.fastMhz);
+    gov.slow = slow;
+  }
+  gov.frames++;
+  if (!slow) gov.fastFrames++;
+}
+
+#ifdef GOV_LIGHT_SLEEP
+static void govWakePin(int8_t pin) {
+  if ((pin < 0) || (gov.wakePins >= sizeof gov.wakePin)) return;
+  gov.wakePin[gov.wakePins++] = pin;
+  esp_sleep_enable_gpio_wakeup();
+}
+
+// Light sleep until wakeUs micros from now or a button press
+static void govLightSleep(uint32_t wakeUs) {
+  uint16_t armed = 0;
+  for (uint8_t i = 0; i < gov.wakePins; i++) {
+    gpio_num_t pin = (gpio_num_t)gov.wakePin[i];
+    if (digitalRead(pin) == LOW) continue; // Held: would wake at once
+    gpio_intr_disable(pin);
+    gpio_wakeup_enable(pin, GPIO_INTR_LOW_LEVEL); // Buttons pull low
+    armed |= 1 << i;
+  }
+  esp_sleep_enable_timer_wakeup(wakeUs);
+  esp_light_sleep_start();
+  for (uint8_t i = 0; i < gov.wakePins; i++) {
+    if (!(armed & (1 << i))) continue;
+    gpio_num_t pin = (gpio_num_t)gov.wakePin[i];
+    gpio_wakeup_disable(pin);
+    gpio_set_intr_type(pin, GPIO_INTR_ANYEDGE); // As attachInterrupt(CHANGE) left it
+    gpio_intr_enable(pin);
+  }
+}
+#endif
+
+// After a frame: wait out the rest of its interval, ending early when
+// wake() returns true.  Returns true if it light-slept.
+static bool govWait(bool (*wake)(void)) {
+  uint32_t now = micros(), interval, start = now;
+  bool     slept = false;
+  gov.activeUs += now - gov.mark;
+  interval      = 1000000UL / ((gov.slow ? GOV_FPS_MIN : GOV_FPS_MAX) * NUM_EYES);
+  gov.next     += interval;
+  if ((int32_t)(gov.next - now) < 0) gov.next = now; // Behind, don't catch up
+  if (gov.hasDue && ((int32_t)(gov.next - gov.due) > 0)) // Not past a known change
+    gov.next = ((int32_t)(gov.due - now) > 0) ? gov.due : now;
+#ifdef GOV_LIGHT_SLEEP
+  if (gov.slow && (gov.next - now >= GOV_SLEEP_MIN) && !wake()) {
+    govLightSleep(gov.next - now);
+    gov.sleeps++;
+    slept         = true;
+    now           = micros();
+    gov.sleepUs  += now - start;
+    start         = now;
+    if ((int32_t)(gov.next - now) >= 1000) gov.next = now; // A button woke it
+  }
+#endif
+  while ((int32_t)(gov.next - now) >= 1000) { // Last fraction of a ms is left
+    if (wake() || (gov.slow && ((now - gov.lastActivity) < GOV_HOLD * 1000UL))) {
+      gov.next = now; // Woken early, the next frame starts now
+      break;
+    }
+    uint32_t ms = (gov.next - now) / 1000;
+    delay((ms < GOV_SLICE) ? ms : GOV_SLICE);
+    now = micros();
+  }
+  gov.idleUs += now - start;
+  gov.mark    = now;
+  return slept;
+}
+
+// Share of time running, in %, and estimated average current in uA since
+// the last report
+static void govAverages(uint32_t *activePct, uint32_t *uA) {
+  uint64_t total = gov.activeUs + gov.idleUs + gov.sleepUs;
+  if (!total) total = 1;
+  *activePct = gov.activeUs * 100 / total;
+  *uA        = (gov.activeUs * GOV_UA_ACTIVE + gov.idleUs * GOV_UA_IDLE +
+                gov.sleepUs * GOV_UA_SLEEP) / total;
+}
+
+static void govReset(void) {
+  gov.activeUs = gov.idleUs = gov.sleepUs = 0;
+  gov.frames = gov.fastFrames = gov.sleeps = 0;
+}
+
+static void govReport(void) {
+  uint32_t pct, uA;
+  govAverages(&pct, &uA);
+  Serial.printf("Governor: active %lu ms, idle %lu ms, asleep %lu ms (%lu sleeps)\n",
+                (unsigned long)(gov.activeUs / 1000), (unsigned long)(gov.idleUs / 1000),
+                (unsigned long)(gov.sleepUs / 1000), (unsigned long)gov.sleeps);
+  Serial.printf("  %lu%% active, %lu of %lu frames at full rate, ~%lu.%lu mA\n",
+                (unsigned long)pct, (unsigned long)gov.fastFrames, (unsigned long)gov.frames,
+                (unsigned long)(uA / 1000), (unsigned long)(uA % 1000 / 100));
+  govReset();
+}
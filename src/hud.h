@@ -0,0 +1,57 @@
+// On-panel performance HUD, enabled with #define HUD in config.h.
+//
+// Three short lines of 3x5 pixel digits drawn into the unused columns left
+// of the eye (x = 0 to EYE_1_XPOSITION - 1), for tuning without a serial
+// console:
+//   F nn   frames per second for this eye
+//   P n.n  frame-time p99 in ms (from frameStats.h, since the last reset)
+//   S nn   SPI bus utilization in percent, all eyes
+// Values are refreshed every HUD_INTERVAL ms and a line is only sent when
+// its text changes, as a HUD_CHARS * 4 x 5 pixel window.
+
+#pragma once
+
+#include <stdint.h>
+
+#define HUD_CHARS    5   // Characters per line, 4 pixels each
+#define HUD_W        (HUD_CHARS * 4)
+#define HUD_H        5
+#define HUD_LINES    3
+#define HUD_X        0
+#define HUD_Y        2   // Top line; lines are 8 pixels apart
+#define HUD_INTERVAL 500 // ms between value updates
+#define HUD_COLOR    0x07E0 // RGB565 green
+
+// 3x5 glyphs, rows top to bottom, 3 bits per row with the leftmost pixel
+// in the highest bit
+static const uint16_t hudDigits[10] = {
+  075557, 026227, 071747, 071717, 055711, 074717, 074757, 071111, 075757, 075717
+};
+
+static uint16_t hudGlyph(char c) {
+  if ((c >= '0') && (c <= '9')) return hudDigits[c - '0'];
+  switch (c) {
+    case 'F': return 074644;
+    case 'P': return 075744;
+    case 'S': return 034216;
+    case '.': return 000002;
+    case '-': return 000700;
+    default:  return 0;
+  }
+}
+
+// 1-bpp blit of up to HUD_CHARS characters into a HUD_W x HUD_H buffer,
+// fg for set pixels and 0 for the rest (including the 1-pixel gaps)
+static void hudRender(uint16_t *dst, const char *s, uint16_t fg) {
+  uint16_t glyph[HUD_CHARS];
+  for (uint32_t i = 0; i < HUD_CHARS; i++) glyph[i] = *s ? hudGlyph(*s++) : 0;
+  for (uint32_t y = 0; y < HUD_H; y++) {
+    for (uint32_t i = 0; i < HUD_CHARS; i++) {
+      uint32_t bits = glyph[i] >> (3 * (HUD_H - 1 - y));
+      *dst++ = (bits & 4) ? fg : 0;
+      *dst++ = (bits & 2) ? fg : 0;
+      *dst++ = (bits & 1) ? fg : 0;
+      *dst++ = 0;
+    }
+  }
+}
@@ -0,0 +1,66 @@
+// Autonomous iris trajectory, planned ahead instead of busy-waited.
+//
+// The iris wanders from one random scale to the next over 10 seconds along
+// a randomised midpoint subdivision: the path is split in half, the
+// midpoint moved by a random amount within half the range, and each half
+// split again the same way until the range is under 8.  irisPlanMake()
+// computes that path up front as evenly spaced keyframes (at most
+// 2^IRIS_PLAN_DEPTH segments), so irisPlanAt() returns the scale for any
+// time in O(1) and updateEye() can draw one frame and return.  A new plan
+// can be made at any moment, starting from whatever scale is showing.
+//
+// Include after config.h.
+
+#pragma once
+
+#include <stdint.h>
+
+#define IRIS_PLAN_DEPTH 6 // Subdivision levels kept, 2^6 = 64 segments max
+#define IRIS_PLAN_KEYS  ((1 << IRIS_PLAN_DEPTH) + 1)
+
+typedef struct {
+  uint32_t start; // micros() at key[0]
+  uint32_t step;  // micros from one key to the next
+  uint16_t n;     // Segments, key[n] is the end value
+  int16_t  key[IRIS_PLAN_KEYS];
+} irisPlan_t;
+
+// Fill the keys between i0 and i1 (values already set)
+static void irisPlanSplit(irisPlan_t *p, uint16_t i0, uint16_t i1, int16_t range) {
+  if (i1 - i0 < 2) return;
+  uint16_t mid = (i0 + i1) / 2;
+  range       /= 2; // Pick random center point within half the range
+  p->key[mid]  = (p->key[i0] + p->key[i1] - range) / 2 + random(range);
+  irisPlanSplit(p, i0, mid, range);
+  irisPlanSplit(p, mid, i1, range);
+}
+
+// Plan from startValue at startTime to endValue duration micros later,
+// midpoints varying by up to range
+static void irisPlanMake(irisPlan_t *p, int16_t startValue, int16_t endValue,
+                         uint32_t startTime, uint32_t duration, int16_t range) {
+  uint8_t depth = 0;
+  for (int16_t r = range; (r >= 8) && (depth < IRIS_PLAN_DEPTH); r /= 2) depth++;
+  p->n      = 1 << depth;
+  p->start  = startTime;
+  p->step   = duration >> depth;
+  p->key[0] = startValue;
+  p->key[p->n] = endValue;
+  irisPlanSplit(p, 0, p->n, range);
+}
+
+static inline bool irisPlanDone(const irisPlan_t *p, uint32_t t) {
+  return (t - p->start) >= p->step * p->n;
+}
+
+// Iris scale at time t, held at the end value once the plan is done
+static int16_t irisPlanAt(const irisPlan_t *p, uint32_t t) {
+  uint32_t dt = t - p->start;
+  if (irisPlanDone(p, t) || !p->step) return p->key[p->n];
+  uint32_t i = dt / p->step;
+  int16_t  v = p->key[i] + ((p->key[i + 1] - p->key[i]) * (int32_t)(dt - i * p->step)) /
+                           (int32_t)p->step;
+  if (v < IRIS_MIN)      v = IRIS_MIN; // Clip just in case
+  else if (v > IRIS_MAX) v = IRIS_MAX;
+  return v;
+}
@@ -0,0 +1,69 @@
+// Input-to-photon latency, enabled with #define LATENCY in config.h.
+//
+// An input event (blink or wink button press, joystick moved by more than
+// LATENCY_JOY_STEP) is timestamped for every eye it affects; a joystick
+// move with the time its samples were taken (sensorMoved() in sensors.h),
+// so the ADC buffering and filter lag count too.  The next frame drawn for
+// that eye carries the tag, and when its last pixel has left the SPI bus
+// the difference goes into a per-eye histogram (the frameStats.h format,
+// so p50/p99 come from statsPercentile()).  Only the first event is kept
+// while one is pending, so the figure is the latency of the oldest
+// unserved input.  Serial 'l' prints the histograms.
+//
+// Times are passed in by the caller, so host code can inject events with
+// made-up timestamps and get the same numbers.  With RENDER_TASK, inputs
+// come from the input task (serial commands) as well as the render task,
+// so the pending times are claimed and taken with atomic operations.
+//
+// Include after frameStats.h.
+
+#pragma once
+
+#include <stdint.h>
+
+#define LATENCY_JOY_STEP 32 // Joystick change (0-1023 units) counted as input
+
+static statsHist_t latencyHist[NUM_EYES];
+static uint32_t    latencyPending[NUM_EYES];  // Input time, 0 = none
+static uint32_t    latencyInFlight[NUM_EYES]; // Tag carried by current frame
+
+// Input event at time t affecting the eyes in mask (bit per eye)
+static inline void latencyInput(uint32_t mask, uint32_t t) {
+  if (!t) t = 1; // 0 means nothing pending
+  for (uint8_t e = 0; e < NUM_EYES; e++) {
+    uint32_t none = 0; // Only if nothing is pending
+    if (mask & (1 << e))
+      __atomic_compare_exchange_n(&latencyPending[e], &none, t, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+  }
+}
+
+// Frame for eye e starts rendering; returns true if it carries an input
+static inline bool latencyRender(uint8_t e) {
+  latencyInFlight[e] = __atomic_exchange_n(&latencyPending[e], 0, __ATOMIC_RELAXED);
+  return latencyInFlight[e] != 0;
+}
+
+// Last pixel of eye e's frame left the bus at time t
+static inline void latencyPhoton(uint8_t e, uint32_t t) {
+  if (!latencyInFlight[e]) return;
+  statsRecord(&latencyHist[e], t - latencyInFlight[e]);
+  latencyInFlight[e] = 0;
+}
+
+// Joystick input: an event whenever the position moves far enough from
+// the last position reported as one
+static inline void latencyJoystick(int16_t x, int16_t y, uint32_t t) {
+  static int16_t lastX = -1, lastY = -1;
+  if (lastX < 0) {      // First reading is the starting point, not an event
+    lastX = x;
+    lastY = y;
+    return;
+  }
+  int16_t dx = x - lastX, dy = y - lastY;
+  if ((dx > LATENCY_JOY_STEP) || (dx < -LATENCY_JOY_STEP) ||
+      (dy > LATENCY_JOY_STEP) || (dy < -LATENCY_JOY_STEP)) {
+    lastX = x;
+    lastY = y;
+    latencyInput((1 << NUM_EYES) - 1, t);
+  }
+}
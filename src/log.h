@@ -0,0 +1,152 @@
+// Non-blocking binary logging.
+//
+// LOG_ERROR() / LOG_INFO() / LOG_DEBUG() store a 16-byte record (message
+// id, micros() timestamp, two int32 arguments) in a lock-free ring buffer
+// and return; nothing is formatted or written to the serial port there.
+// logDrain(), called between frames, sends queued records only while the
+// port has room for them, so a host that stops reading (USB CDC with no
+// terminal attached) just causes dropped records, counted and reported
+// with LOG_DROPPED once there is room again.
+//
+// Levels above LOG_LEVEL (config.h) compile to nothing.  Any number of
+// producers (with RENDER_TASK: the render, input and log tasks, at
+// different priorities) and one consumer (logDrain()) may run
+// concurrently.  A producer claims a slot by compare-and-swap on logHead
+// and marks it filled in logSeq[] when done, so a writer preempted halfway
+// neither loses its slot to another one nor lets logDrain() send a half
+// written record.
+//
+// Records are framed with a sync byte and a checksum so they can share the
+// port with plain text; tools/logdecode turns a capture back into text.
+
+#pragma once
+
+#include <stdint.h>
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_DEBUG 3
+
+#if !defined(LOG_LEVEL)
+  #define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING 64   // Records buffered, power of 2
+#define LOG_SYNC 0xA5 // First byte of every record on the wire
+
+enum {
+#define LOG_MESSAGE(id, format) id,
+#include "logMessages.h"
+#undef LOG_MESSAGE
+  LOG_MESSAGES
+};
+
+typedef struct {
+  uint8_t  sync;   // LOG_SYNC
+  uint8_t  id;     // Message id from logMessages.h
+  uint16_t check;  // Sum of the 16-bit words that follow
+  uint32_t time;   // micros() when logged
+  int32_t  arg[2];
+} logRecord_t;     // 16 bytes, sent as-is (little endian)
+
+static inline uint16_t logCheck(const logRecord_t *r) {
+  const uint16_t *w = (const uint16_t *)&r->time;
+  uint16_t        s = 0;
+  for (uint32_t i = 0; i < 6; i++) s += w[i];
+  return s;
+}
+
+#if LOG_LEVEL > LOG_LEVEL_NONE
+
+#ifdef ARDUINO
+  #define LOG_TIME()        micros()
+  #define LOG_SPACE()       Serial.availableForWrite()
+  #define LOG_OUT(buf, n)   Serial.write(buf, n)
+#else
+  #include <stdio.h>
+  #include <time.h>
+  static inline uint32_t logTime(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+  }
+  #define LOG_TIME()        logTime()
+  #define LOG_SPACE()       ((int)sizeof(logRecord_t))
+  #define LOG_OUT(buf, n)   fwrite(buf, 1, n, stdout)
+#endif
+
+static logRecord_t logRing[LOG_RING];
+static uint32_t    logHead, logTail; // Next slot to claim / to send
+static uint32_t    logDropped;       // Producer side count
+
+// Per slot, the position it is ready for minus its index (so all zeros is
+// the empty ring): pos when free to write at pos, pos + 1 once the record
+// for pos is written, pos + LOG_RING once it is sent.
+static uint32_t    logSeq[LOG_RING];
+
+static void logWrite(uint8_t id, int32_t a, int32_t b) {
+  uint32_t pos = __atomic_load_n(&logHead, __ATOMIC_RELAXED), i;
+  for (;;) {
+    i = pos & (LOG_RING - 1);
+    int32_t d = (int32_t)(__atomic_load_n(&logSeq[i], __ATOMIC_ACQUIRE) + i - pos);
+    if (d < 0) {            // Not sent yet: full
+      __atomic_fetch_add(&logDropped, 1, __ATOMIC_RELAXED);
+      return;
+    }
+    if (!d && __atomic_compare_exchange_n(&logHead, &pos, pos + 1, false,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+    if (d) pos = __atomic_load_n(&logHead, __ATOMIC_RELAXED); // Taken, retry
+  }
+  logRecord_t *r = &logRing[i];
+  r->id     = id;
+  r->time   = LOG_TIME();
+  r->arg[0] = a;
+  r->arg[1] = b;
+  __atomic_store_n(&logSeq[i], pos + 1 - i, __ATOMIC_RELEASE);
+}
+
+static void logSend(logRecord_t *r) {
+  r->sync  = LOG_SYNC;
+  r->check = logCheck(r);
+  LOG_OUT((const uint8_t *)r, sizeof *r);
+}
+
+// Send as many queued records as the port can take without blocking
+static void logDrain(void) {
+  static uint32_t reported; // logDropped value last reported
+  uint32_t tail = logTail;
+  while (LOG_SPACE() >= (int)sizeof(logRecord_t)) {
+    uint32_t i = tail & (LOG_RING - 1);
+    if (__atomic_load_n(&logSeq[i], __ATOMIC_ACQUIRE) + i != tail + 1) break; // Not written yet
+    logSend(&logRing[i]);
+    __atomic_store_n(&logSeq[i], tail + LOG_RING - i, __ATOMIC_RELEASE);
+    logTail = ++tail;
+  }
+  uint32_t dropped = __atomic_load_n(&logDropped, __ATOMIC_RELAXED);
+  if ((dropped != reported) && (LOG_SPACE() >= (int)sizeof(logRecord_t))) {
+    logRecord_t r = { 0, LOG_DROPPED, 0, LOG_TIME(), { (int32_t)(dropped - reported), 0 } };
+    logSend(&r);
+    reported = dropped;
+  }
+}
+
+#else
+  static inline void logDrain(void) { }
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+  #define LOG_ERROR(id, a, b) logWrite(id, a, b)
+#else
+  #define LOG_ERROR(id, a, b)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+  #define LOG_INFO(id, a, b)  logWrite(id, a, b)
+#else
+  #define LOG_INFO(id, a, b)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+  #define LOG_DEBUG(id, a, b) logWrite(id, a, b)
+#else
+  #define LOG_DEBUG(id, a, b)
+#endif
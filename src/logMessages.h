@@ -0,0 +1,14 @@
+// Log message table: one LOG_MESSAGE(id, format) per message.  Records
+// carry only the id and two int32 arguments; the format strings are only
+// used by the host decoder (tools/logdecode), which includes this file.
+// Append new messages at the end so old captures still decode.
+
+LOG_MESSAGE(LOG_DROPPED,     "log: %ld records dropped")
+LOG_MESSAGE(LOG_FPS,         "%ld fps")
+LOG_MESSAGE(LOG_RENDER_COST, "render mode %ld: %ld us/eye")
+LOG_MESSAGE(LOG_COMMAND,     "command %ld (cmd | seq << 8), host time %ld")
+LOG_MESSAGE(LOG_HEADROOM,    "idle headroom %ld%%, render task waiting on DMA %ld%%")
+LOG_MESSAGE(LOG_GOVERNOR,    "governor: %ld%% active, ~%ld uA")
+LOG_MESSAGE(LOG_DEADLINE,    "deadline: %ld (eye | degraded frames << 8), %ld skipped")
+LOG_MESSAGE(LOG_EYE_FPS,     "eye %ld: %ld fps")
+LOG_MESSAGE(LOG_XFADE,       "cross-fade: %ld frames in %ld ms")
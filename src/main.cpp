@@ -33,15 +33,30 @@
 // is SPI, uncomment the next line:
 //#define USE_DMA
 
+// With DMA on ESP32, rendering can run in its own FreeRTOS task that sleeps
+// while each buffer goes out, with serial commands, analog inputs and the
+// log in lower-priority tasks (see TASKS below), uncomment the next line:
+//#define RENDER_TASK
+
+// On ESP32, eye and sprite pixels can bypass TFT_eSPI and go out through a
+// thin ESP-IDF SPI master driver with a hardware chip select per panel,
+// queuing the transfers for both eyes back to back (panel.h).  TFT_eSPI
+// still initialises the panels.  Implies USE_DMA, uncomment the next line:
+//#define PANEL_IDF
+#if defined(PANEL_IDF) && !defined(USE_DMA)
+  #define USE_DMA
+#endif
+
 // Load TFT driver library
 #include <SPI.h>
 #include <TFT_eSPI.h>
-#include "EYEA.h"
-#include "EYEB.h"
+#include "data/EYEA.h" // Sprite sets for Demo_2() / Demo_3()
+#include "data/EYEB.h"
 TFT_eSPI tft;           // A single instance is used for 1 or 2 displays
 
-// A pixel buffer is used during eye rendering
-#define BUFFER_SIZE 1024 // 128 to 1024 seems optimum
+// A pixel buffer is used during eye rendering, allocated at startup so
+// AUTOTUNE (config.h) can pick its size
+#define BUFFER_SIZE 1024 // 128 to 1024 seems optimum, default size
 #define IRIS_MIN 90
 #define IRIS_MAX 130
 
@@ -56,25 +71,8 @@ TFT_eSPI tft;           // A single instance is used for 1 or 2 displays
 #define BL1 1
 #define BL2 3
 
-const uint8_t ease[] = { // Ease in/out curve for eye movements 3*t^2-2*t^3
-  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  2,  2,  2,  3,   // T
-  3,  3,  4,  4,  4,  5,  5,  6,  6,  7,  7,  8,  9,  9, 10, 10,   // h
-  11, 12, 12, 13, 14, 15, 15, 16, 17, 18, 18, 19, 20, 21, 22, 23,   // x
-  24, 25, 26, 27, 27, 28, 29, 30, 31, 33, 34, 35, 36, 37, 38, 39,   // 2
-  40, 41, 42, 44, 45, 46, 47, 48, 50, 51, 52, 53, 54, 56, 57, 58,   // A
-  60, 61, 62, 63, 65, 66, 67, 69, 70, 72, 73, 74, 76, 77, 78, 80,   // l
-  81, 83, 84, 85, 87, 88, 90, 91, 93, 94, 96, 97, 98, 100, 101, 103, // e
-  104, 106, 107, 109, 110, 112, 113, 115, 116, 118, 119, 121, 122, 124, 125, 127, // c
-  128, 130, 131, 133, 134, 136, 137, 139, 140, 142, 143, 145, 146, 148, 149, 151, // J
-  152, 154, 155, 157, 158, 159, 161, 162, 164, 165, 167, 168, 170, 171, 172, 174, // a
-  175, 177, 178, 179, 181, 182, 183, 185, 186, 188, 189, 190, 192, 193, 194, 195, // c
-  197, 198, 199, 201, 202, 203, 204, 205, 207, 208, 209, 210, 211, 213, 214, 215, // o
-  216, 217, 218, 219, 220, 221, 222, 224, 225, 226, 227, 228, 228, 229, 230, 231, // b
-  232, 233, 234, 235, 236, 237, 237, 238, 239, 240, 240, 241, 242, 243, 243, 244, // s
-  245, 245, 246, 246, 247, 248, 248, 249, 249, 250, 250, 251, 251, 251, 252, 252, // o
-  252, 253, 253, 253, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255
-}; // n
-uint16_t pbuffer[BUFFERS][BUFFER_SIZE]; // Pixel rendering buffer
+uint16_t *pbuffer[BUFFERS];             // Pixel rendering buffers,
+uint32_t  bufferSize;                   // bufferSize pixels each
 bool     dmaBuf   = 0;                  // DMA buffer selection
 uint16_t oldIris = (IRIS_MIN + IRIS_MAX) / 2, newIris;
 uint32_t timeOfLastBlink = 0L, timeToNextBlink = 0L;
@@ -86,16 +84,113 @@ typedef struct {        // Struct is defined before including config.h --
   int8_t  wink;         // and wink button (or -1 if none) specified there,
   uint8_t rotation;     // also display rotation and the x offset
   int16_t xposition;    // position of eye on the screen
+  bool    mirror;       // Eyelid maps drawn right-to-left (left eye)
+  int8_t  converge;     // Gaze X offset, pixels, so the eyes look crossed
 } eyeInfo_t;
 
+// Eye render modes.  The reduced modes compute every other column (and row)
+// and duplicate them on the way out, for 2x (or 4x) less per-pixel work.
+#define RENDER_FULL   0 // e.g. 128x128, every pixel computed
+#define RENDER_HALF_X 1 // 64x128 computed, columns doubled
+#define RENDER_HALF   2 // 64x64 computed, columns and rows doubled
+
 #include "config.h"     // ****** CONFIGURATION IS DONE IN HERE ******
+#include "pixelFormat.h"
+#ifdef PANEL_IDF
+  #include "panel.h"
+#endif
+#include "spiFifo.h"
+#include "eyeRender.h"
+#include "profiler.h"
+#include "frameStats.h"
+#include "hud.h"
+#include "latency.h"
+#include "log.h"
+#include "command.h"
+#include "tripleBuffer.h"
+#include "buttons.h"
+#include "sensors.h"
+#include "timeline.h"
+#include "sched.h"
+#if !defined(LIGHT_PIN) || (LIGHT_PIN < 0)
+  #include "irisPlan.h" // Autonomous iris
+#endif
+#ifdef GOVERNOR
+  #include "governor.h"
+#endif
+#ifdef DEADLINE
+  #include "deadline.h"
+#endif
+#ifdef CROSSFADE
+  #include "crossfade.h"
+#endif
+#ifdef AUTOTUNE
+  #include "tuner.h"
+  #define BUFFER_MAX (TUNE_ROWS_MAX * EYE_WIDTH)
+#else
+  #define BUFFER_MAX BUFFER_SIZE
+#endif
+
+#if !defined(RENDER_MODE)
+  #define RENDER_MODE RENDER_FULL
+#endif
+
+#if (BUFFER_SIZE < EYE_WIDTH)
+  #error "BUFFER_SIZE must hold at least one row of pixels"
+#endif
+
+#if (NUM_EYES < 1) || (NUM_EYES > 8)
+  #error "NUM_EYES must be 1 to 8 (eye masks are 8 bits)"
+#endif
+#if defined(PANEL_IDF) && (NUM_EYES > 6)
+  #error "PANEL_IDF drives at most 6 panels, one per SPI2 hardware chip select"
+#endif
+static_assert(sizeof eyeInfo / sizeof eyeInfo[0] == NUM_EYES, "eyeInfo[] needs one line per eye");
+
+#if defined(RENDER_TASK) && !defined(USE_DMA)
+  #error "RENDER_TASK needs USE_DMA, the render task only blocks on DMA"
+#endif
+
+#if defined(HUD) && (!defined(FRAME_STATS) || (EYE_1_XPOSITION < HUD_W) || \
+                     (NUM_EYES > 1 && EYE_2_XPOSITION < HUD_W))
+  #error "HUD needs FRAME_STATS and a HUD_W pixel border left of the eye"
+#endif
+
+#if defined(COLOR_12BIT) && ((BUFFER_SIZE % 4) || (EYE_WIDTH % 4))
+  #error "COLOR_12BIT needs pixel pushes in multiples of 4 pixels"
+#endif
 
 extern void user_setup(void); // Functions in the user*.cpp files
 extern void user_loop(void);
 void initEyes(void);
 void updateEye (void);
+void setRenderMode(uint8_t mode);
+void serialPoll(void);
+void debugCommand(uint8_t c);
+void cmdApply(const cmdPacket_t *p);
+void clearPanels(void);
+void clearRect(uint8_t e, int32_t x, int32_t y, int32_t w, int32_t h);
+bool bufferAlloc(uint32_t pixels);
+void drawEye(uint8_t e, uint32_t iScale, uint32_t scleraX, uint32_t scleraY,
+             uint32_t uT, uint32_t lT, uint8_t mode);
+#ifdef AUTOTUNE
+uint32_t tuneMeasure(uint16_t rows, uint32_t hz);
+#endif
+void show(void);
+void inputPoll(void);
+void statePublish(void);
+bool govWake(void);
+#ifdef RENDER_TASK
+void startTasks(void);
+#endif
+void hudUpdate(uint8_t e);
+void pushSprite(int8_t cs, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
 void Demo_2();
 void Demo_3();
+#ifdef CROSSFADE
+bool xfadeStep(uint8_t from, uint8_t to);
+void xfadeBench(void);
+#endif
 
 
 // A simple state machine is used to control eye blinks/winks:
@@ -114,8 +209,50 @@ struct {                // One-per-eye structure
   int16_t   xposition;  // x position of eye image
 } eye[NUM_EYES];
 
+timeline_t tl;          // Gaze, iris and lid keyframes for all eyes
+
 uint32_t startTime;  // For FPS indicator
 
+uint8_t  renderMode = RENDER_MODE;  // RENDER_FULL/RENDER_HALF_X/RENDER_HALF
+uint32_t renderTime[3], renderCount[3]; // Per-mode drawEye() cost, micros
+#ifdef CROSSFADE
+xfade_t         xfade;                 // CMD_SELECT transition in progress
+const uint16_t *spriteShown[NUM_EYES]; // Last gImage_* sprite on each panel
+#endif
+
+// Everything the input side (serial commands, analog inputs) hands to the
+// renderer.  The input side edits its own copy and publishes it whole
+// through a triple buffer; frame() picks up the newest at its start.
+typedef struct {
+  int16_t  gazeX, gazeY;            // CMD_GAZE position, -1 = autonomous
+  uint16_t iris;                    // CMD_IRIS scale, 0 = autonomous
+  int16_t  joyX, joyY, light;       // Latest analog readings, inputPoll()
+  uint32_t joyTime;                 // micros() the joystick reading was sampled
+  uint8_t  animation;               // CMD_SELECT: what show() runs
+  uint8_t  blinks[NUM_EYES];        // CMD_BLINK requests so far (wraps)
+  uint32_t blinkTime[NUM_EYES];     // micros() of the latest request
+  uint32_t blinkDuration[NUM_EYES]; // Its closing time, micros
+  uint8_t  exprs;                   // CMD_EXPR requests so far (wraps)
+  uint8_t  expr;                    // The latest one's expression number
+} eyeState_t;
+
+eyeState_t               input = { -1, -1, 0, 0, 0, 0, ANIM_EYES }; // Input side only
+tripleBuffer<eyeState_t> stateChannel;
+const eyeState_t        *state = &input; // Render side: snapshot for this frame
+uint16_t ctlSeq;                         // Last accepted command sequence number
+bool     ctlSynced = false;              // Any command accepted yet
+
+#ifdef RENDER_TASK
+// Time the render task spends blocked on DMA, and the time the other tasks
+// spend working, in CPU cycles.  Their difference is idle headroom.
+uint32_t renderWait, taskBusy[2];
+#define WAIT_BEGIN() uint32_t waitStart = ESP.getCycleCount()
+#define WAIT_END()   renderWait += ESP.getCycleCount() - waitStart
+#else
+#define WAIT_BEGIN()
+#define WAIT_END()
+#endif
+
 // INITIALIZATION -- runs once at startup ----------------------------------
 void setup(void) {
   Serial.begin(115200);
@@ -150,27 +287,69 @@ digitalWrite (device_B_CS, LOW);
   Serial.println("Initialising displays");
   tft.init();
 
-#ifdef USE_DMA
+#if defined(USE_DMA) && !defined(PANEL_IDF)
   tft.initDMA();
 #endif
 
     // Raise chip select(s) so that displays can be individually configured
-  digitalWrite(eye[0].tft_cs, HIGH);
-  if (NUM_EYES > 1) digitalWrite(eye[1].tft_cs, HIGH);
+  for (uint8_t e = 0; e < NUM_EYES; e++) digitalWrite(eye[e].tft_cs, HIGH);
 
   for (uint8_t e = 0; e < NUM_EYES; e++) {
     digitalWrite(eye[e].tft_cs, LOW);
     tft.setRotation(eyeInfo[e].rotation);
     tft.fillScreen(TFT_BLACK);
+#ifdef COLOR_12BIT
+    // Switch to RGB444 only after clearing, black is all zeros either way
+    tft.writecommand(COLMOD_CMD);
+    tft.writedata(COLMOD_12BIT);
+#endif
     digitalWrite(eye[e].tft_cs, HIGH);
   }
 
+#ifdef PANEL_IDF
+  // Hand the bus over to panel.h, chip selects are driven by SPI2 from now on
+  tft.getSPIinstance().end();
+  int8_t cs[NUM_EYES];
+  for (uint8_t e = 0; e < NUM_EYES; e++) cs[e] = eye[e].tft_cs;
+  if (!panelBegin(cs, NUM_EYES, PIXEL_BYTES(BUFFER_MAX))) Serial.println("SPI master setup failed");
+#endif
+
+  if (!bufferAlloc(BUFFER_SIZE)) for (;;) delay(1000); // Nothing to draw with
+#ifdef AUTOTUNE
+  tune_t tune = tuneBoot(tuneMeasure, TUNE_ROWS_MAX);
+  if (!tune.rows) { // Nothing could be measured: untuned defaults
+    tune.rows = BUFFER_SIZE / EYE_WIDTH;
+    tune.hz   = SPI_FREQUENCY;
+  }
+  bufferAlloc(tune.rows * EYE_WIDTH); // If that fails, the last size tried stays
+#ifdef PANEL_IDF
+  panelClock(tune.hz);
+#endif
+  Serial.printf("Push chunk %lu pixels, SPI %lu Hz\n", (unsigned long)bufferSize,
+                (unsigned long)tune.hz);
+#endif
+#ifdef CROSSFADE
+  xfadeBench();
+#endif
+
 #if defined(DISPLAY_BACKLIGHT) && (DISPLAY_BACKLIGHT >= 0)
   Serial.println("Backlight now on!");
   analogWrite(DISPLAY_BACKLIGHT, BACKLIGHT_MAX);
 #endif
 
+  sensorBegin();
+  tbInit(&stateChannel, input);
+  state = tbRead(&stateChannel);
+
   startTime = millis(); // For frame-rate calculation
+  tlInit(&tl, micros());
+  PROF_INIT();
+#ifdef GOVERNOR
+  govInit();
+#endif
+#ifdef RENDER_TASK
+  startTasks();
+#endif
 }
 
 // MAIN LOOP -- runs continuously after setup() ----------------------------
@@ -180,11 +359,191 @@ void loop() {
 //  delay(1000);
 //  digitalWrite(8, LOW);
 //  delay(1000);
-  Serial.println("light up");
-  updateEye();
-//  Demo_3();
+#ifdef RENDER_TASK
+  vTaskDelete(NULL); // Everything runs in the tasks started by setup()
+#else
+  show();
+  serialPoll();
+  logDrain();
+#endif
+}
+
+// Run the current animation for a while (an iris cycle, or one pass of a
+// sprite demo)
+void show(void) {
+  static uint8_t shown = ANIM_EYES;
+  uint8_t        animation = (state = tbRead(&stateChannel))->animation;
+  if (animation != shown) { // Sprites cover the whole panel, eyes don't
+#ifdef CROSSFADE
+    if (xfadeStep(shown, animation)) return; // One frame of the transition
+#else
+    if (animation == ANIM_EYES) clearPanels();
+#endif
+    shown = animation;
+  }
+  if (animation == ANIM_DEMO_2)      Demo_2();
+  else if (animation == ANIM_DEMO_3) Demo_3();
+  else                               updateEye();
 }
 
+#ifdef RENDER_TASK
+// TASKS -- loop() hands over to these, all on the Arduino core.  Rendering
+// has the highest priority and gives up the CPU only while it waits for
+// SPI DMA (the driver blocks on the transfer's completion rather than
+// polling), so the other tasks run in those gaps and the idle task gets
+// whatever is left.
+#define RENDER_PRIORITY  3
+#define INPUT_PRIORITY   2
+#define LOG_PRIORITY     1
+#define INPUT_PERIOD     5    // ms between analog input samples
+#define LOG_PERIOD       10   // ms between log drains
+#define HEADROOM_PERIOD  2000 // ms between idle headroom log records
+
+void renderTask(void *arg) {
+  for (;;) show();
+}
+
+// The single producer for stateChannel: serial commands every tick,
+// analog inputs every INPUT_PERIOD ms
+void inputTask(void *arg) {
+  for (uint32_t tick = 0; ; tick++) {
+    uint32_t t = ESP.getCycleCount();
+    serialPoll();
+    if (!(tick % pdMS_TO_TICKS(INPUT_PERIOD))) inputPoll();
+    taskBusy[0] += ESP.getCycleCount() - t;
+    vTaskDelay(1);
+  }
+}
+
+// Drains the log and reports idle headroom: the share of time the render
+// task was blocked on DMA that the other tasks didn't use either
+void logTask(void *arg) {
+  uint32_t last = ESP.getCycleCount(), lastWait = 0, lastBusy = 0, next = millis();
+  for (;;) {
+    uint32_t t = ESP.getCycleCount();
+    logDrain();
+    if ((int32_t)(millis() - next) >= 0) {
+      uint32_t busy = taskBusy[0] + taskBusy[1];
+      uint32_t wait = renderWait - lastWait, used = busy - lastBusy, wall = t - last;
+      LOG_INFO(LOG_HEADROOM, (wait > used) ? (uint64_t)(wait - used) * 100 / wall : 0,
+               (uint64_t)wait * 100 / wall);
+      last     = t;
+      lastWait = renderWait;
+      lastBusy = busy;
+      next    += HEADROOM_PERIOD;
+    }
+    taskBusy[1] += ESP.getCycleCount() - t;
+    vTaskDelay(pdMS_TO_TICKS(LOG_PERIOD));
+  }
+}
+
+void startTasks(void) {
+  xTaskCreatePinnedToCore(renderTask,  "render",  8192, NULL, RENDER_PRIORITY,  NULL, ARDUINO_RUNNING_CORE);
+  xTaskCreatePinnedToCore(inputTask,   "input",   4096, NULL, INPUT_PRIORITY,   NULL, ARDUINO_RUNNING_CORE);
+  xTaskCreatePinnedToCore(logTask,     "log",     2048, NULL, LOG_PRIORITY,     NULL, ARDUINO_RUNNING_CORE);
+}
+#endif // RENDER_TASK
+
+// Pick up the filtered analog inputs (sensors.h): from the input task
+// with RENDER_TASK, else once per frame
+void inputPoll(void) {
+  sensorPoll();
+#if defined(JOYSTICK_X_PIN) && (JOYSTICK_X_PIN >= 0) && \
+    defined(JOYSTICK_Y_PIN) && (JOYSTICK_Y_PIN >= 0)
+  input.joyX = sensorRead(SENSOR_JOY_X);
+  input.joyY = sensorRead(SENSOR_JOY_Y);
+#ifdef LATENCY
+  uint32_t x = sensorMoved(SENSOR_JOY_X), y = sensorMoved(SENSOR_JOY_Y);
+  input.joyTime = ((int32_t)(x - y) < 0) ? x : y; // The axis that moved first
+#endif
+#endif
+#if defined(LIGHT_PIN) && (LIGHT_PIN >= 0)
+  input.light = sensorRead(SENSOR_LIGHT);
+#endif
+  statePublish();
+}
+
+// Hand the input side's state to the renderer
+void statePublish(void) {
+  *tbWrite(&stateChannel) = input;
+  tbPublish(&stateChannel);
+}
+
+void clearPanels(void) {
+  for (uint8_t e = 0; e < NUM_EYES; e++) clearRect(e, 0, 0, tft.width(), tft.height());
+}
+
+// Fill a rectangle of display e with black (w * h even in 12-bit mode)
+void clearRect(uint8_t e, int32_t x, int32_t y, int32_t w, int32_t h) {
+  if ((w <= 0) || (h <= 0)) return;
+#ifdef PANEL_IDF
+  panelWait(); // pbuffer may still be in flight
+  memset(pbuffer[0], 0, bufferSize * 2); // Black is all zeros in 12-bit mode as well
+  panelWindow(e, x, y, w, h);
+  for (uint32_t n = w * h, chunk; n; n -= chunk) {
+    chunk = (n < bufferSize) ? n : bufferSize;
+    panelPixels(e, pbuffer[0], PIXEL_BYTES(chunk));
+  }
+  panelWait();
+#else
+#ifdef USE_DMA
+  tft.dmaWait();
+#endif
+  digitalWrite(eye[e].tft_cs, LOW);
+  tft.fillRect(x, y, w, h, TFT_BLACK); // Black is all zeros in 12-bit mode as well
+  digitalWrite(eye[e].tft_cs, HIGH);
+#endif
+}
+
+// (Re)allocate the pixel buffers, nothing may be in flight from them.
+// Whole eye rows are pushed, so any size from one row up works.  The new
+// buffers are only swapped in once all of them could be allocated, so on
+// failure the old ones and bufferSize are still valid.
+bool bufferAlloc(uint32_t pixels) {
+#if defined(PANEL_IDF)
+  panelWait();
+#elif defined(USE_DMA)
+  tft.dmaWait();
+#endif
+  uint16_t *fresh[BUFFERS];
+  for (uint8_t b = 0; b < BUFFERS; b++) {
+    // Internal RAM, which is DMA capable and 4-byte aligned
+    if (!(fresh[b] = (uint16_t *)malloc(pixels * sizeof(uint16_t)))) {
+      while (b) free(fresh[--b]);
+      Serial.println("Out of memory for pixel buffers");
+      return false; // The old buffers stay as they were
+    }
+  }
+  for (uint8_t b = 0; b < BUFFERS; b++) {
+    free(pbuffer[b]);
+    pbuffer[b] = fresh[b];
+  }
+  bufferSize = pixels;
+  dmaBuf     = 0;
+  return true;
+}
+
+#ifdef AUTOTUNE
+// Time TUNE_FRAMES eye frames, eyes wide open and looking ahead, with
+// chunks of the given number of rows at SPI clock hz, for tuneBoot()
+uint32_t tuneMeasure(uint16_t rows, uint32_t hz) {
+  uint32_t t = 0;
+  if (!bufferAlloc(rows * EYE_WIDTH)) return 0xFFFFFFFF;
+#ifdef PANEL_IDF
+  if (!panelClock(hz)) return 0xFFFFFFFF;
+#endif
+  for (uint32_t i = 0; i < TUNE_FRAMES + 2; i++) { // 2 to warm up
+    if (i == 2) t = micros();
+    drawEye(i % NUM_EYES, (IRIS_MIN + IRIS_MAX) / 2, (SCLERA_WIDTH - SCREEN_WIDTH) / 2,
+            (SCLERA_HEIGHT - SCREEN_HEIGHT) / 2, 0, 0, renderMode);
+  }
+#ifdef PANEL_IDF
+  panelWait(); // Last pixels of the last frame
+#endif
+  return micros() - t;
+}
+#endif
+
 void initEyes(void)
 {
   Serial.println("Initialise eye objects");
@@ -201,12 +560,48 @@ void initEyes(void)
     digitalWrite(eye[e].tft_cs, LOW);
 
     // Also set up an individual eye-wink pin if defined:
-    if (eyeInfo[e].wink >= 0) pinMode(eyeInfo[e].wink, INPUT_PULLUP);
+    buttonAttach(e, eyeInfo[e].wink);
+#ifdef GOV_LIGHT_SLEEP
+    govWakePin(eyeInfo[e].wink);
+#endif
   }
 
 #if defined(BLINK_PIN) && (BLINK_PIN >= 0)
-  pinMode(BLINK_PIN, INPUT_PULLUP); // Ditto for all-eyes blink pin
+  buttonAttach(BUTTON_BLINK, BLINK_PIN); // Ditto for all-eyes blink pin
+#ifdef GOV_LIGHT_SLEEP
+  govWakePin(BLINK_PIN);
+#endif
+#else
+  buttonAttach(BUTTON_BLINK, -1);
+#endif
+
+  initEyeTables(); // Eyelid maps to RAM at output resolution
+}
+
+// Send one buffer of rendered eye pixels to display e (selected already
+// with TFT_eSPI), packing it down to RGB444 in place first when in 12-bit
+// mode.
+void pushBuffer(uint8_t e, uint16_t *buf, uint32_t pixels) {
+#if defined(COLOR_12BIT) && defined(EYE_ASSET_SWAPPED)
+  pack444Swapped((uint8_t *)buf, buf, pixels);
+#elif defined(COLOR_12BIT)
+  pack444((uint8_t *)buf, buf, pixels);
+#endif
+  PROF_BEGIN(PROF_SPI);
+#if defined(PANEL_IDF)
+  WAIT_BEGIN(); // Blocks until the previous buffer is out
+  panelPixels(e, buf, PIXEL_BYTES(pixels));
+  WAIT_END();
+#elif defined(USE_DMA)
+  WAIT_BEGIN(); // Blocks until the previous buffer is out
+  tft.pushPixelsDMA(buf, PIXEL_BYTES(pixels) >> 1);
+  WAIT_END();
+#elif defined(SPI_FIFO)
+  spiFifoPush(buf, PIXEL_BYTES(pixels));
+#else
+  tft.pushPixels(buf, PIXEL_BYTES(pixels) >> 1);
 #endif
+  PROF_END();
 }
 
 void drawEye( // Renders one eye.  Inputs must be pre-clipped & valid.
@@ -216,91 +611,336 @@ void drawEye( // Renders one eye.  Inputs must be pre-clipped & valid.
   uint32_t  scleraX, // First pixel X offset into sclera image
   uint32_t  scleraY, // First pixel Y offset into sclera image
   uint32_t  uT,      // Upper eyelid threshold value
-  uint32_t  lT) {    // Lower eyelid threshold value
+  uint32_t  lT,      // Lower eyelid threshold value
+  uint8_t   mode) {  // RENDER_FULL/RENDER_HALF_X/RENDER_HALF, for this frame
 
-  uint32_t  screenX, screenY, scleraXsave;
-  int32_t  irisX, irisY;
-  uint32_t p, a;
-  uint32_t d;
+  static uint16_t lineBuf[EYE_WIDTH]; // Last computed row in RENDER_HALF
+  static eyeIrisCache_t irisCache;    // Shared by all eyes
+  uint32_t   screenY;
+  uint16_t  *row;
+  eyeFrame_t f;
 
   uint32_t pixels = 0;
 
+  PROF_BEGIN(PROF_RENDER + e);
+
   // Set up raw pixel dump to entire screen.  Although such writes can wrap
   // around automatically from end of rect back to beginning, the region is
   // reset on each  here in case of an SPI glitch.
+#ifdef PANEL_IDF
+  panelWindow(e, eye[e].xposition, 0, EYE_WIDTH, EYE_HEIGHT);
+#else
   digitalWrite(eye[e].tft_cs, LOW);
   // tft.startWrite();
-  tft.setAddrWindow(eye[e].xposition, 0, 128, 128);
+  tft.setAddrWindow(eye[e].xposition, 0, EYE_WIDTH, EYE_HEIGHT);
+#endif
   // Now just issue raw 16-bit values for every pixel...
 
-  scleraXsave = scleraX; // Save initial X value to reset on each line
-  irisY       = scleraY - (SCLERA_HEIGHT - IRIS_HEIGHT) / 2;
-
   // Eyelid image is left<>right swapped for two displays
-  uint16_t lidX = 0;
-  uint16_t dlidX = -1;
-  if (e) dlidX = 1;
-  for (screenY = 0; screenY < SCREEN_HEIGHT; screenY++, scleraY++, irisY++) {
-    scleraX = scleraXsave;
-    irisX   = scleraXsave - (SCLERA_WIDTH - IRIS_WIDTH) / 2;
-    if (e) lidX = 0; else lidX = SCREEN_WIDTH - 1;
-    for (screenX = 0; screenX < SCREEN_WIDTH; screenX++, scleraX++, irisX++, lidX += dlidX) {
-      if ((pgm_read_byte(lower + screenY * SCREEN_WIDTH + lidX) <= lT) ||
-          (pgm_read_byte(upper + screenY * SCREEN_WIDTH + lidX) <= uT)) {              // Covered by eyelid
-        p = 0;
-      } else if ((irisY < 0) || (irisY >= IRIS_HEIGHT) ||
-                 (irisX < 0) || (irisX >= IRIS_WIDTH)) { // In sclera
-        p = pgm_read_word(sclera + scleraY * SCLERA_WIDTH + scleraX);
-      } else {                                          // Maybe iris...
-        p = pgm_read_word(polar + irisY * IRIS_WIDTH + irisX);                        // Polar angle/dist
-        d = (iScale * (p & 0x7F)) / 128;                // Distance (Y)
-        if (d < IRIS_MAP_HEIGHT) {                      // Within iris area
-          a = (IRIS_MAP_WIDTH * (p >> 7)) / 512;        // Angle (X)
-          p = pgm_read_word(iris + d * IRIS_MAP_WIDTH + a);                           // Pixel = iris
-        } else {                                        // Not in iris
-          p = pgm_read_word(sclera + scleraY * SCLERA_WIDTH + scleraX);               // Pixel = sclera
-        }
-      }
-      *(&pbuffer[dmaBuf][0] + pixels++) = p >> 8 | p << 8;
+  eyeFrameSetup(&f, &irisCache, eyeInfo[e].mirror, iScale, scleraX, scleraY, uT, lT);
+  for (screenY = 0; screenY < EYE_HEIGHT; screenY++) {
+    row = &pbuffer[dmaBuf][pixels];
+    if (mode == RENDER_FULL) {
+      renderEyeRow<1>(row, &f, screenY);
+    } else if ((mode == RENDER_HALF) && (screenY & 1)) {
+      memcpy(row, lineBuf, sizeof lineBuf); // Repeat the even row above
+    } else {
+      renderEyeRow<2>(row, &f, screenY);
+      if (mode == RENDER_HALF) memcpy(lineBuf, row, sizeof lineBuf);
+    }
+#ifdef CROSSFADE
+    if (xfade.eyeAlpha && xfade.eyeSprite[e]) // Fading to or from a sprite
+      xfade565<false>(row, row, xfade.eyeSprite[e] + screenY * XF_SPRITE + eye[e].xposition,
+                      EYE_WIDTH, xfade.eyeAlpha);
+#endif
+    pixels += EYE_WIDTH;
 
-      if (pixels >= BUFFER_SIZE) {
-        yield();
+    if (pixels + EYE_WIDTH > bufferSize) { // No room for another row
+#ifndef RENDER_TASK // Tasks get the CPU during DMA waits instead
+      PROF_NEXT(PROF_IDLE);
+      yield();
+      PROF_NEXT(PROF_RENDER + e);
+#endif
+      pushBuffer(e, &pbuffer[dmaBuf][0], pixels);
 #ifdef USE_DMA
-        tft.pushPixelsDMA(&pbuffer[dmaBuf][0], pixels);
-        dmaBuf  = !dmaBuf;
-#else
-        tft.pushPixels(pbuffer, pixels);
+      dmaBuf  = !dmaBuf;
 #endif
-        pixels = 0;
-      }
+      pixels = 0;
     }
   }
 
+#ifdef PANEL_IDF
+  // No chip select to raise, the last buffer finishes while the next eye
+  // is computed
   if (pixels) {
+    pushBuffer(e, &pbuffer[dmaBuf][0], pixels);
+    dmaBuf = !dmaBuf;
+  }
+#else
+  if (pixels) pushBuffer(e, &pbuffer[dmaBuf][0], pixels);
+  PROF_NEXT(PROF_SPI);
 #ifdef USE_DMA
-    tft.pushPixelsDMA(&pbuffer[dmaBuf][0], pixels);
+  WAIT_BEGIN();
+  tft.dmaWait(); // Last buffer out before chip select goes high
+  WAIT_END();
 #else
-    tft.pushPixels(pbuffer, pixels);
+  spiFifoWait();
 #endif
-  }
   tft.endWrite();
   digitalWrite(eye[e].tft_cs, HIGH);
+#endif
+  PROF_END();
+}
+
+// Select full or reduced resolution rendering, from the next frame on
+// (CMD_MODE or serial 'm', any task)
+void setRenderMode(uint8_t mode) {
+  if (mode <= RENDER_HALF) __atomic_store_n(&renderMode, mode, __ATOMIC_RELAXED);
+}
+
+#if defined(FRAME_STATS) || defined(LATENCY)
+// Print one frame-time histogram line, see frameStats.h for the format
+void statsPrint(uint8_t e, const char *name, const statsHist_t *h) {
+  Serial.print('F'); Serial.print(e); Serial.print(' '); Serial.print(name);
+  Serial.print(" n=");   Serial.print(h->total);
+  Serial.print(" p50="); Serial.print(statsPercentile(h, 50));
+  Serial.print(" p99="); Serial.print(statsPercentile(h, 99));
+  Serial.print(" max="); Serial.print(h->max);
+  for (uint32_t b = 0; b < STATS_BUCKETS; b++) {
+    if (!h->count[b]) continue;
+    Serial.print(' '); Serial.print(b); Serial.print(':'); Serial.print(h->count[b]);
+  }
+  Serial.println();
+}
+#endif
+
+#ifdef HUD
+#ifndef SPI_FREQUENCY
+  #define SPI_FREQUENCY 40000000 // Normally set in the TFT_eSPI user setup
+#endif
+// Native HUD colour as pushBuffer() expects it
+#ifdef EYE_ASSET_SWAPPED
+  #define HUD_PIXEL PIXEL_OUT((uint16_t)(HUD_COLOR >> 8 | HUD_COLOR << 8))
+#else
+  #define HUD_PIXEL PIXEL_OUT(HUD_COLOR)
+#endif
+
+// Refresh the HUD text for eye e every HUD_INTERVAL ms and send the lines
+// that changed.  Call after drawEye() for that eye.
+void hudUpdate(uint8_t e) {
+  static uint16_t hudBuf[HUD_W * HUD_H] __attribute__((aligned(4)));
+  static char     text[NUM_EYES][HUD_LINES][HUD_CHARS + 1];
+  static uint32_t frames[NUM_EYES], fps[NUM_EYES], lastTime[NUM_EYES];
+  uint32_t        now = millis(), elapsed = now - lastTime[e];
+  char            line[HUD_LINES][HUD_CHARS + 1];
+
+  frames[e]++;
+  if (elapsed < HUD_INTERVAL) return;
+  fps[e]      = frames[e] * 1000 / elapsed;
+  frames[e]   = 0;
+  lastTime[e] = now;
+
+  uint32_t busFps = 0, p99 = statsPercentile(&frameTimeHist[e], 99) / 100;
+  for (uint8_t i = 0; i < NUM_EYES; i++) busFps += fps[i];
+  uint32_t spi = (uint64_t)busFps * PIXEL_BYTES(EYE_WIDTH * EYE_HEIGHT) * 800 / SPI_FREQUENCY;
+  snprintf(line[0], sizeof line[0], "F%3lu", (unsigned long)fps[e]);
+  if (p99 < 100) snprintf(line[1], sizeof line[1], "P%2lu.%lu", (unsigned long)p99 / 10, (unsigned long)p99 % 10);
+  else           snprintf(line[1], sizeof line[1], "P%3lu", (unsigned long)((p99 < 9990) ? p99 / 10 : 999));
+  snprintf(line[2], sizeof line[2], "S%3lu", (unsigned long)spi);
+
+  for (uint8_t i = 0; i < HUD_LINES; i++) {
+    if (!strcmp(line[i], text[e][i])) continue; // Unchanged
+    strcpy(text[e][i], line[i]);
+#if defined(PANEL_IDF)
+    panelWait(); // hudBuf may still be in flight
+#elif defined(USE_DMA)
+    tft.dmaWait();
+#endif
+    hudRender(hudBuf, line[i], HUD_PIXEL);
+#ifdef PANEL_IDF
+    panelWindow(e, HUD_X, HUD_Y + i * 8, HUD_W, HUD_H);
+    pushBuffer(e, hudBuf, HUD_W * HUD_H);
+#else
+    digitalWrite(eye[e].tft_cs, LOW);
+    tft.setAddrWindow(HUD_X, HUD_Y + i * 8, HUD_W, HUD_H);
+    pushBuffer(e, hudBuf, HUD_W * HUD_H);
+#ifdef USE_DMA
+    WAIT_BEGIN();
+    tft.dmaWait(); // HUD line out before chip select goes high
+    WAIT_END();
+#else
+    spiFifoWait();
+#endif
+    tft.endWrite();
+    digitalWrite(eye[e].tft_cs, HIGH);
+#endif
+  }
+}
+#endif
+
+// Handle serial input between frames: control packets and single-character
+// debug commands.  At most 64 bytes per call, so a flood can't stall the
+// animation; a packet is applied as soon as its last byte is in.
+void serialPoll(void) {
+  static cmdParser_t parser;
+  for (uint8_t n = 0; (n < 64) && Serial.available(); n++) {
+    uint8_t c = Serial.read();
+    switch (cmdParse(&parser, c)) {
+      case CMD_READY: cmdApply(&parser.pkt); break;
+      case CMD_OTHER: debugCommand(c);       break;
+    }
+  }
+}
+
+// Act on a control packet.  Packets not newer than the last one accepted
+// are ignored; sequence number 0 is always accepted (sender restarted).
+void cmdApply(const cmdPacket_t *p) {
+  uint32_t t = micros();
+  if (ctlSynced && p->seq && ((int16_t)(p->seq - ctlSeq) <= 0)) return;
+#ifdef GOVERNOR
+  govActivity(t);
+#endif
+  ctlSynced = true;
+  ctlSeq    = p->seq;
+  LOG_DEBUG(LOG_COMMAND, p->cmd | p->seq << 8, p->hostTime);
+
+  switch (p->cmd) {
+    case CMD_GAZE:
+      if (p->len < 4) break;
+      input.gazeX = cmdI16(p, 0);
+      input.gazeY = cmdI16(p, 2);
+      if (input.gazeX < 0 || input.gazeY < 0) {
+        input.gazeX = input.gazeY = -1;
+      } else {
+        input.gazeX = constrain(input.gazeX, 0, 1023);
+        input.gazeY = constrain(input.gazeY, 0, 1023);
+      }
+#ifdef LATENCY
+      latencyInput((1 << NUM_EYES) - 1, t);
+#endif
+      break;
+    case CMD_IRIS:
+      if (p->len < 2) break;
+      input.iris = cmdI16(p, 0);
+      if (input.iris) input.iris = constrain(input.iris, IRIS_MIN, IRIS_MAX);
+      break;
+    case CMD_BLINK: {
+      if (p->len < 3) break;
+      uint32_t duration = (uint16_t)cmdI16(p, 1) * 1000UL;
+      if (!duration) duration = random(36000, 72000);
+      for (uint8_t e = 0; e < NUM_EYES; e++) {
+        if (p->payload[0] & (1 << e)) { // frame() starts it if eye is open
+          input.blinks[e]++;
+          input.blinkTime[e]     = t;
+          input.blinkDuration[e] = duration;
+        }
+      }
+#ifdef LATENCY
+      latencyInput(p->payload[0], t);
+#endif
+      break;
+    }
+    case CMD_SELECT:
+      if ((p->len >= 1) && (p->payload[0] <= ANIM_DEMO_3)) input.animation = p->payload[0];
+      break;
+    case CMD_EXPR: // frame() starts it
+      if ((p->len < 1) || (p->payload[0] >= TL_EXPRESSIONS)) break;
+      input.expr = p->payload[0];
+      input.exprs++;
+      break;
+    case CMD_MODE:
+      if (p->len >= 1) setRenderMode(p->payload[0]);
+      break;
+  }
+  statePublish();
+}
+
+// Single-character debug commands from the serial console
+void debugCommand(uint8_t c) {
+  switch (c) {
+    case 'f': schedReport(); break;        // Frames/s and time share per eye
+    case 'm':                              // Next render mode, full after half
+      setRenderMode((renderMode + 1) % (RENDER_HALF + 1));
+      Serial.printf("Render mode %u\n", renderMode);
+      break;
+#ifdef PROFILE
+    case 'p': profDump(); break;           // Per-stage cycle counts
+#endif
+#ifdef FRAME_STATS
+    case 'h':                              // Frame-time histograms
+      for (uint8_t e = 0; e < NUM_EYES; e++) {
+        statsPrint(e, "ft", &frameTimeHist[e]);
+        statsPrint(e, "if", &intervalHist[e]);
+      }
+      break;
+    case 'r': statsReset(); break;
+#endif
+#ifdef AUTOTUNE
+    case 'T': tuneForget(); break;         // Tune again at the next boot
+#endif
+#ifdef GOVERNOR
+    case 'g': govReport(); break;          // Active/idle time, current estimate
+#endif
+#ifdef DEADLINE
+    case 'd': dlReport(); break;           // Degraded/skipped frames per eye
+#endif
+#ifdef LATENCY
+    case 'l':                              // Input-to-photon latency
+      for (uint8_t e = 0; e < NUM_EYES; e++) statsPrint(e, "lat", &latencyHist[e]);
+      break;
+#endif
+  }
 }
 
 // Process motion for a single  of left or right eye
 void frame(uint16_t iScale) // Iris scale (0-1023)
 {
   static uint32_t frames   = 0; // Used in frame rate calculation
-  static uint8_t  eyeIndex = 0; // eye[] array counter
+  uint8_t         eyeIndex;     // eye[] array counter
   int16_t         eyeX, eyeY;
   uint32_t        t = micros(); // Time at start of function
 
+#ifndef RENDER_TASK
+  inputPoll();
+#endif
+  state = tbRead(&stateChannel); // Newest input snapshot
+  tlUpdate(&tl, t);              // Keyframed channels at time t
+
+  // Expressions requested over serial start now, from where the eye is
+  static uint8_t exprsSeen;
+  if (state->exprs != exprsSeen) {
+    exprsSeen = state->exprs;
+    if (!tl.value[TL_IRIS]) tl.value[TL_IRIS] = iScale;
+    tlPlay(&tl, &tlExpressions[state->expr], t);
+  }
+
+  if (state->iris) iScale = state->iris;            // Iris set over serial
+  else if (tl.value[TL_IRIS]) iScale = tl.value[TL_IRIS]; // or scripted
+  PROF_BEGIN(PROF_LOGIC);
+  PROF_FRAME();
+
   if (!(++frames & 255)) { // Every 256 frames...
-    float elapsed = (millis() - startTime) / 1000.0;
-    if (elapsed) Serial.println((uint16_t)(frames / elapsed)); // Print FPS
+    uint32_t elapsed = millis() - startTime;
+    if (elapsed) LOG_INFO(LOG_FPS, (uint64_t)frames * 1000 / elapsed, 0); // Log FPS
+    for (uint8_t e = 0; elapsed && (e < NUM_EYES); e++) // and per eye
+      LOG_INFO(LOG_EYE_FPS, e, (uint64_t)sched.total[e] * 1000 / elapsed);
+#ifdef GOVERNOR
+    uint32_t activePct, uA; // Running share and current estimate so far
+    govAverages(&activePct, &uA);
+    LOG_INFO(LOG_GOVERNOR, activePct, uA);
+#endif
+#ifdef DEADLINE
+    for (uint8_t e = 0; e < NUM_EYES; e++) // Since the last 'd'
+      LOG_INFO(LOG_DEADLINE, e | dl.degraded[e] << 8, dl.count[e][DL_SKIP]);
+#endif
+    for (uint8_t m = 0; m <= RENDER_HALF; m++) { // and render cost per mode
+      if (!renderCount[m]) continue;
+      LOG_INFO(LOG_RENDER_COST, m, renderTime[m] / renderCount[m]);
+      renderTime[m] = renderCount[m] = 0;
+    }
   }
 
-  if (++eyeIndex >= NUM_EYES) eyeIndex = 0; // Cycle through eyes, 1 per call
+  eyeIndex = schedNext(); // Eye with the least time so far, 1 per call
 
   // X/Y movement
 
@@ -308,64 +948,47 @@ void frame(uint16_t iScale) // Iris scale (0-1023)
     defined(JOYSTICK_Y_PIN) && (JOYSTICK_Y_PIN >= 0)
 
   // Read X/Y from joystick, constrain to circle
-  int16_t dx, dy;
-  int32_t d;
-  eyeX = analogRead(JOYSTICK_X_PIN); // Raw (unclipped) X/Y reading
-  eyeY = analogRead(JOYSTICK_Y_PIN);
+  eyeX = state->joyX; // Raw (unclipped) X/Y reading
+  eyeY = state->joyY;
 #ifdef JOYSTICK_X_FLIP
   eyeX = 1023 - eyeX;
 #endif
 #ifdef JOYSTICK_Y_FLIP
   eyeY = 1023 - eyeY;
 #endif
-  dx = (eyeX * 2) - 1023; // A/D exact center is at 511.5.  Scale coords
-  dy = (eyeY * 2) - 1023; // X2 so range is -1023 to +1023 w/center at 0.
-  if ((d = (dx * dx + dy * dy)) > (1023 * 1023)) { // Outside circle
-    d    = (int32_t)sqrt((float)d);               // Distance from center
-    eyeX = ((dx * 1023 / d) + 1023) / 2;          // Clip to circle edge,
-    eyeY = ((dy * 1023 / d) + 1023) / 2;          // scale back to 0-1023
+  sensorCircle(&eyeX, &eyeY);
+#ifdef LATENCY
+  latencyJoystick(eyeX, eyeY, state->joyTime); // Sampled, not this frame's start
+#endif
+  if (tlIdle(&tl.track[TL_GAZE_X]) && tlIdle(&tl.track[TL_GAZE_Y])) {
+    tlSet(&tl.track[TL_GAZE_X], t, eyeX); // Expressions start from here
+    tlSet(&tl.track[TL_GAZE_Y], t, eyeY);
   }
 
 #else // Autonomous X/Y eye motion
   // Periodically initiates motion to a new random point, random speed,
-  // holds there for random period until next motion.
-
-  static bool  eyeInMotion      = false;
-  static int16_t  eyeOldX = 512, eyeOldY = 512, eyeNewX = 512, eyeNewY = 512;
-  static uint32_t eyeMoveStartTime = 0L;
-  static int32_t  eyeMoveDuration  = 0L;
-
-  int32_t dt = t - eyeMoveStartTime;      // uS elapsed since last eye event
-  if (eyeInMotion) {                      // Currently moving?
-    if (dt >= eyeMoveDuration) {          // Time up?  Destination reached.
-      eyeInMotion      = false;           // Stop moving
-      eyeMoveDuration  = random(3000000); // 0-3 sec stop
-      eyeMoveStartTime = t;               // Save initial time of stop
-      eyeX = eyeOldX = eyeNewX;           // Save position
-      eyeY = eyeOldY = eyeNewY;
-    } else { // Move time's not yet fully elapsed -- interpolate position
-      int16_t e = ease[255 * dt / eyeMoveDuration] + 1;   // Ease curve
-      eyeX = eyeOldX + (((eyeNewX - eyeOldX) * e) / 256); // Interp X
-      eyeY = eyeOldY + (((eyeNewY - eyeOldY) * e) / 256); // and Y
-    }
-  } else {                                // Eye stopped
-    eyeX = eyeOldX;
-    eyeY = eyeOldY;
-    if (dt > eyeMoveDuration) {           // Time up?  Begin new move.
-      int16_t  dx, dy;
-      uint32_t d;
-      do {                                // Pick new dest in circle
-        eyeNewX = random(1024);
-        eyeNewY = random(1024);
-        dx      = (eyeNewX * 2) - 1023;
-        dy      = (eyeNewY * 2) - 1023;
-      } while ((d = (dx * dx + dy * dy)) > (1023 * 1023)); // Keep trying
-      eyeMoveDuration  = random(72000, 144000); // ~1/14 - ~1/7 sec
-      eyeMoveStartTime = t;               // Save initial time of move
-      eyeInMotion      = true;            // Start move on next frame
-    }
+  // holds there for random period until next motion.  Queued on the
+  // timeline's gaze channels whenever an expression isn't using them.
+  if (tlIdle(&tl.track[TL_GAZE_X]) && tlIdle(&tl.track[TL_GAZE_Y])) {
+    int16_t  eyeNewX, eyeNewY, dx, dy;
+    do {                                  // Pick new dest in circle
+      eyeNewX = random(1024);
+      eyeNewY = random(1024);
+      dx      = (eyeNewX * 2) - 1023;
+      dy      = (eyeNewY * 2) - 1023;
+    } while ((dx * dx + dy * dy) > (1023 * 1023)); // Keep trying
+    uint32_t hold = t + random(3000000);  // 0-3 sec stop, then
+    uint32_t move = hold + random(72000, 144000); // ~1/14 - ~1/7 sec move
+    tlTo(&tl.track[TL_GAZE_X], hold, tl.value[TL_GAZE_X], TL_STEP);
+    tlTo(&tl.track[TL_GAZE_X], move, eyeNewX, TL_SMOOTH);
+    tlTo(&tl.track[TL_GAZE_Y], hold, tl.value[TL_GAZE_Y], TL_STEP);
+    tlTo(&tl.track[TL_GAZE_Y], move, eyeNewY, TL_SMOOTH);
   }
 #endif // JOYSTICK_X_PIN etc.
+  if (!tlIdle(&tl.track[TL_GAZE_X]) || !tlIdle(&tl.track[TL_GAZE_Y])) {
+    eyeX = tl.value[TL_GAZE_X]; // Moving on the timeline: saccade or
+    eyeY = tl.value[TL_GAZE_Y]; // expression
+  }
 
   // Blinking
 #ifdef AUTOBLINK
@@ -386,16 +1009,51 @@ void frame(uint16_t iScale) // Iris scale (0-1023)
   }
 #endif
 
+  // Blinks requested over serial start from when the command arrived
+  static uint8_t blinksSeen[NUM_EYES];
+  for (uint8_t e = 0; e < NUM_EYES; e++) {
+    if (state->blinks[e] == blinksSeen[e]) continue;
+    blinksSeen[e] = state->blinks[e];
+    if (eye[e].blink.state == NOBLINK) {
+      eye[e].blink.state     = ENBLINK;
+      eye[e].blink.startTime = state->blinkTime[e];
+      eye[e].blink.duration  = state->blinkDuration[e];
+    }
+  }
+
+  // Button presses, queued by interrupt with their time (buttons.h).
+  // Manual blinks have random durations like auto-blink, and start from
+  // the moment the button went down.
+  static uint8_t buttonDown[BUTTONS];
+  buttonEvent_t  ev;
+  buttonResync(); // Edges the lockout turned away, if any, so no release is lost
+  while (buttonNext(&ev)) {
+    buttonDown[ev.button] = ev.pressed;
+#ifdef GOVERNOR
+    govActivity(t);
+#endif
+    if (!ev.pressed) continue;
+    if ((int32_t)(ev.time - t) > 0) ev.time = t; // Edge after t was taken
+    uint8_t  mask = (ev.button == BUTTON_BLINK) ? (1 << NUM_EYES) - 1 : 1 << ev.button;
+    uint32_t blinkDuration = (ev.button == BUTTON_BLINK) ? random(36000, 72000) : random(45000, 90000);
+#ifdef LATENCY
+    latencyInput(mask, ev.time);
+#endif
+    for (uint8_t e = 0; e < NUM_EYES; e++) {
+      if ((mask & (1 << e)) && (eye[e].blink.state == NOBLINK)) {
+        eye[e].blink.state     = ENBLINK;
+        eye[e].blink.startTime = ev.time;
+        eye[e].blink.duration  = blinkDuration;
+      }
+    }
+  }
+
   if (eye[eyeIndex].blink.state) { // Eye currently blinking?
     // Check if current blink state time has elapsed
     if ((t - eye[eyeIndex].blink.startTime) >= eye[eyeIndex].blink.duration) {
       // Yes -- increment blink state, unless...
-      if ((eye[eyeIndex].blink.state == ENBLINK) && ( // Enblinking and...
-#if defined(BLINK_PIN) && (BLINK_PIN >= 0)
-            (digitalRead(BLINK_PIN) == LOW) ||           // blink or wink held...
-#endif
-            ((eyeInfo[eyeIndex].wink >= 0) &&
-             digitalRead(eyeInfo[eyeIndex].wink) == LOW) )) {
+      if ((eye[eyeIndex].blink.state == ENBLINK) && // Enblinking and...
+          (buttonDown[BUTTON_BLINK] || buttonDown[eyeIndex])) { // blink or wink held...
         // Don't advance state yet -- eye is held closed instead
       } else { // No buttons, or other state...
         if (++eye[eyeIndex].blink.state > DEBLINK) { // Deblinking finished?
@@ -406,49 +1064,32 @@ void frame(uint16_t iScale) // Iris scale (0-1023)
         }
       }
     }
-  } else { // Not currently blinking...check buttons!
-#if defined(BLINK_PIN) && (BLINK_PIN >= 0)
-    if (digitalRead(BLINK_PIN) == LOW) {
-      // Manually-initiated blinks have random durations like auto-blink
-      uint32_t blinkDuration = random(36000, 72000);
-      for (uint8_t e = 0; e < NUM_EYES; e++) {
-        if (eye[e].blink.state == NOBLINK) {
-          eye[e].blink.state     = ENBLINK;
-          eye[e].blink.startTime = t;
-          eye[e].blink.duration  = blinkDuration;
-        }
-      }
-    } else
-#endif
-      if ((eyeInfo[eyeIndex].wink >= 0) &&
-          (digitalRead(eyeInfo[eyeIndex].wink) == LOW)) { // Wink!
-        eye[eyeIndex].blink.state     = ENBLINK;
-        eye[eyeIndex].blink.startTime = t;
-        eye[eyeIndex].blink.duration  = random(45000, 90000);
-      }
+  }
+
+  if (state->gazeX >= 0) { // Gaze set over serial overrides joystick/autonomous
+    eyeX = state->gazeX;
+    eyeY = state->gazeY;
   }
 
   // Process motion, blinking and iris scale into renderable values
 
   // Scale eye X/Y positions (0-1023) to pixel units used by drawEye()
-  eyeX = map(eyeX, 0, 1023, 0, SCLERA_WIDTH  - 128);
-  eyeY = map(eyeY, 0, 1023, 0, SCLERA_HEIGHT - 128);
+  eyeX = map(eyeX, 0, 1023, 0, SCLERA_WIDTH  - SCREEN_WIDTH);
+  eyeY = map(eyeY, 0, 1023, 0, SCLERA_HEIGHT - SCREEN_HEIGHT);
 
   // Horizontal position is offset so that eyes are very slightly crossed
   // to appear fixated (converged) at a conversational distance.  Number
   // here was extracted from my posterior and not mathematically based.
   // I suppose one could get all clever with a range sensor, but for now...
-  if (NUM_EYES > 1) {
-    if (eyeIndex == 1) eyeX += 4;
-    else eyeX -= 4;
-  }
-  if (eyeX > (SCLERA_WIDTH - 128)) eyeX = (SCLERA_WIDTH - 128);
+  // (per eye in eyeInfo[], config.h)
+  eyeX = constrain(eyeX + eyeInfo[eyeIndex].converge, 0, SCLERA_WIDTH - SCREEN_WIDTH);
 
   // Eyelids are rendered using a brightness threshold image.  This same
   // map can be used to simplify another problem: making the upper eyelid
   // track the pupil (eyes tend to open only as much as needed -- e.g. look
   // down and the upper eyelid drops).  Just sample a point in the upper
   // lid map slightly above the pupil to determine the rendering threshold.
+  PROF_NEXT(PROF_TRACKING);
   static uint8_t uThreshold = 128;
   uint8_t        lThreshold, n;
 #ifdef TRACKING
@@ -456,8 +1097,8 @@ void frame(uint16_t iScale) // Iris scale (0-1023)
           sampleY = SCLERA_HEIGHT / 2 - (eyeY + IRIS_HEIGHT / 4);
   // Eyelid is slightly asymmetrical, so two readings are taken, averaged
   if (sampleY < 0) n = 0;
-  else            n = (pgm_read_byte(upper + sampleY * SCREEN_WIDTH + sampleX) +
-                         pgm_read_byte(upper + sampleY * SCREEN_WIDTH + (SCREEN_WIDTH - 1 - sampleX))) / 2;
+  else            n = (LID_UPPER(sampleY * SCREEN_WIDTH + sampleX) +
+                         LID_UPPER(sampleY * SCREEN_WIDTH + (SCREEN_WIDTH - 1 - sampleX))) / 2;
   uThreshold = (uThreshold * 3 + n) / 4; // Filter/soften motion
   // Lower eyelid doesn't track the same way, but seems to be pulled upward
   // by tension from the upper lid.
@@ -479,57 +1120,122 @@ void frame(uint16_t iScale) // Iris scale (0-1023)
     n          = uThreshold;
   }
 
+  // Scripted lids (timeline.h) close further from there: both for
+  // TL_CLOSE, mostly the lower one for TL_SQUINT
+  if (tl.value[TL_CLOSE] || tl.value[TL_SQUINT]) {
+    uint32_t c = constrain(tl.value[TL_CLOSE], 0, 255), q = constrain(tl.value[TL_SQUINT], 0, 255);
+    uint32_t u = c + ((255 - c) * q) / (4 * 255), l = c + ((255 - c) * q) / 255;
+    n          = (n * (255 - u) + 254 * u) / 255;
+    lThreshold = (lThreshold * (255 - l) + 254 * l) / 255;
+  }
+
+#ifdef GOVERNOR
+  // Full frame rate while anything on this eye changes (governor.h)
+  static int16_t lastX[NUM_EYES], lastY[NUM_EYES], lastIris[NUM_EYES];
+  static uint8_t lastLid[NUM_EYES];
+  if ((abs(eyeX - lastX[eyeIndex]) > GOV_STILL) || (abs(eyeY - lastY[eyeIndex]) > GOV_STILL) ||
+      (abs(n - lastLid[eyeIndex]) > GOV_STILL) || (abs(iScale - lastIris[eyeIndex]) > GOV_STILL) ||
+      eye[eyeIndex].blink.state) govActivity(t);
+  lastX[eyeIndex]    = eyeX;
+  lastY[eyeIndex]    = eyeY;
+  lastLid[eyeIndex]  = n;
+  lastIris[eyeIndex] = iScale;
+  // Saccades and scripted blinks are queued ahead: be at full rate when
+  // they start rather than a slow frame interval later
+  uint32_t due;
+  if (tlNext(&tl.track[TL_GAZE_X], &due)) govDue(due);
+  if (tlNext(&tl.track[TL_GAZE_Y], &due)) govDue(due);
+  if (tlNext(&tl.track[TL_CLOSE], &due))  govDue(due);
+#ifdef AUTOBLINK
+  govDue(timeOfLastBlink + timeToNextBlink);
+#endif
+  govFrame(t);
+#endif
+
   // Pass all the derived values to the eye-rendering function:
-  drawEye(eyeIndex, iScale, eyeX, eyeY, n, lThreshold);
+  uint8_t  mode = __atomic_load_n(&renderMode, __ATOMIC_RELAXED);
+#ifdef DEADLINE
+  uint32_t units = dlWork(eyeY, n, lThreshold);
+  mode = dlChoose(eyeIndex, mode, units); // Degraded or DL_SKIP if it won't fit
+#endif
+  if (mode <= RENDER_HALF) { // Not skipped
+    uint32_t r = micros();
+#ifdef LATENCY
+    bool tagged = latencyRender(eyeIndex);
+#endif
+    drawEye(eyeIndex, iScale, eyeX, eyeY, n, lThreshold, mode);
+    r = micros() - r; // Render cost, without the latency wait below
+#ifdef DEADLINE
+    dlRecord(eyeIndex, mode, units, r);
+#endif
+#ifdef LATENCY
+    if (tagged) {
+#if defined(PANEL_IDF)
+      panelWait(); // Wait for the last pixel only on tagged frames
+#elif defined(USE_DMA)
+      tft.dmaWait();
+#endif
+      latencyPhoton(eyeIndex, micros());
+    }
+#endif
+    renderTime[mode] += r;
+    renderCount[mode]++;
+  }
+  uint32_t used = micros() - t;
+#ifdef DEADLINE
+  // A skipped frame is charged what it would have cost, so the scheduler
+  // hands that time to the other eyes instead of picking this one again
+  if (mode > RENDER_HALF) used += dlPredict(eyeIndex, RENDER_HALF, units);
+#endif
+  schedCharge(eyeIndex, used);
+  PROF_NEXT(PROF_LOGIC);
+
+#ifdef FRAME_STATS
+  static uint32_t lastStart[NUM_EYES];
+  statsRecord(&frameTimeHist[eyeIndex], micros() - t);
+  if (lastStart[eyeIndex]) statsRecord(&intervalHist[eyeIndex], t - lastStart[eyeIndex]);
+  lastStart[eyeIndex] = t;
+#endif
+#ifdef HUD
+  hudUpdate(eyeIndex);
+#endif
 
   if (eyeIndex == (NUM_EYES - 1)) {
 //    user_loop(); // Call user code after rendering last eye
   }
+#ifdef GOVERNOR
+  PROF_NEXT(PROF_IDLE);
+#if defined(GOV_LIGHT_SLEEP) && defined(PANEL_IDF)
+  panelWait(); // Light sleep stops SPI2 too
+#elif defined(GOV_LIGHT_SLEEP) && defined(USE_DMA)
+  tft.dmaWait();
+#endif
+  if (govWait(govWake)) buttonRecheck(); // Rest of the frame interval
+#endif
+  PROF_END();
 }
 
-void split( // Subdivides motion path into two sub-paths w/randimization
-  int16_t  startValue, // Iris scale value (IRIS_MIN to IRIS_MAX) at start
-  int16_t  endValue,   // Iris scale value at end
-  uint32_t startTime,  // micros() at start
-  int32_t  duration,   // Start-to-end time, in microseconds
-  int16_t  range) {    // Allowable scale value variance when subdividing
-  if (range >= 8) {    // Limit subdvision count, because recursion
-    range    /= 2;     // Split range & time in half for subdivision,
-    duration /= 2;     // then pick random center point within range:
-    int16_t  midValue = (startValue + endValue - range) / 2 + random(range);
-    uint32_t midTime  = startTime + duration;
-    split(startValue, midValue, startTime, duration, range); // First half
-    split(midValue  , endValue, midTime  , duration, range); // Second half
-  } else {             // No more subdivisons, do iris motion...
-    int32_t dt;        // Time (micros) since start of motion
-    int16_t v;         // Interim value
-    while ((dt = (micros() - startTime)) < duration) {
-      v = startValue + (((endValue - startValue) * dt) / duration);
-      if (v < IRIS_MIN)      v = IRIS_MIN; // Clip just in case
-      else if (v > IRIS_MAX) v = IRIS_MAX;
-      frame(v);        // Draw frame w/interim iris scale value
-    }
-  }
+#ifdef GOVERNOR
+// Cuts a governor wait short: a button event, or serial input that
+// serialPoll() would otherwise only see after the wait
+bool govWake(void) {
+#ifndef RENDER_TASK
+  if (Serial.available()) return true;
+#endif
+  return buttonPending();
 }
+#endif
 
 // UPDATE EYE --------------------------------------------------------------
 void updateEye (void)
 {
 #if defined(LIGHT_PIN) && (LIGHT_PIN >= 0) // Interactive iris
-  int16_t v = analogRead(LIGHT_PIN);       // Raw dial/photocell reading
-#ifdef LIGHT_PIN_FLIP
-  v = 1023 - v;                            // Reverse reading from sensor
-#endif
-
-  if (v < LIGHT_MIN)      v = LIGHT_MIN; // Clamp light sensor range
-  else if (v > LIGHT_MAX) v = LIGHT_MAX;
-  v -= LIGHT_MIN;  // 0 to (LIGHT_MAX - LIGHT_MIN)
-#ifdef LIGHT_CURVE  // Apply gamma curve to sensor input?
-  v = (int16_t)(pow((double)v / (double)(LIGHT_MAX - LIGHT_MIN),
-                    LIGHT_CURVE) * (double)(LIGHT_MAX - LIGHT_MIN));
+#ifndef RENDER_TASK
+  inputPoll();
 #endif
-  // And scale to iris range (IRIS_MAX is size at LIGHT_MIN)
-  v = map(v, 0, (LIGHT_MAX - LIGHT_MIN), IRIS_MAX, IRIS_MIN);
+  // Filtered dial/photocell reading, flipped, clamped, gamma-corrected
+  // and scaled to iris range by table
+  int16_t v = sensorIris((state = tbRead(&stateChannel))->light);
 #ifdef IRIS_SMOOTH // Filter input (gradual motion)
   static int16_t irisValue = (IRIS_MIN + IRIS_MAX) / 2;
   irisValue = ((irisValue * 15) + v) / 16;
@@ -539,25 +1245,183 @@ void updateEye (void)
   frame(v);
 #endif // IRIS_SMOOTH
 
-#else  // Autonomous iris scaling -- invoke recursive function
-
-  newIris = random(IRIS_MIN, IRIS_MAX);
-  split(oldIris, newIris, micros(), 10000000L, IRIS_MAX - IRIS_MIN);
-  oldIris = newIris;
+#else  // Autonomous iris scaling -- one frame along the planned path
+
+  static irisPlan_t plan;
+  static int16_t    held = 0; // Iris scale last set over serial or scripted
+  uint32_t          t = micros();
+  if ((state = tbRead(&stateChannel))->iris || tl.value[TL_IRIS]) {
+    held = state->iris ? state->iris : tl.value[TL_IRIS]; // frame() shows it
+  } else if (held || !plan.n || irisPlanDone(&plan, t)) {
+    if (held) oldIris = held;  // Carry on from where it was left
+    held    = 0;
+    newIris = random(IRIS_MIN, IRIS_MAX);
+    irisPlanMake(&plan, oldIris, newIris, t, 10000000L, IRIS_MAX - IRIS_MIN);
+    oldIris = newIris;
+  }
+  frame(irisPlanAt(&plan, t));
 #endif // LIGHT_PIN
 }
 
+// Draw a full-screen gImage_* sprite on the panel with chip select cs, in
+// its current pixel format.  The sprite tables are RGB565 in wire byte
+// order; in 12-bit mode they are packed through pbuffer a chunk at a time.
+// With PANEL_IDF they always go through pbuffer, DMA can't read flash.
+void pushSprite(int8_t cs, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+#ifdef CROSSFADE
+  for (uint8_t e = 0; e < NUM_EYES; e++) { // Where a transition starts from
+    if (eye[e].tft_cs == cs) spriteShown[e] = ((w == XF_SPRITE) && (h == XF_SPRITE)) ? data : nullptr;
+  }
+#endif
+#if defined(PANEL_IDF)
+  uint8_t  p = 0;
+  uint32_t n = w * h, chunk;
+  while ((p < NUM_EYES) && (eye[p].tft_cs != cs)) p++;
+  if (p == NUM_EYES) return; // No panel on that pin
+  panelWindow(p, x, y, w, h);
+  while (n) {
+    chunk = (n < bufferSize) ? n : bufferSize;
+#ifdef COLOR_12BIT
+    pack444Swapped((uint8_t *)&pbuffer[dmaBuf][0], data, chunk);
+#else
+    memcpy(&pbuffer[dmaBuf][0], data, chunk * 2);
+#endif
+    panelPixels(p, &pbuffer[dmaBuf][0], PIXEL_BYTES(chunk));
+    dmaBuf = !dmaBuf;
+    data  += chunk;
+    n     -= chunk;
+  }
+#elif defined(COLOR_12BIT)
+  digitalWrite(cs, LOW);
+  uint32_t n = w * h, chunk;
+#ifdef USE_DMA
+  tft.dmaWait(); // pbuffer may still be in flight from drawEye()
+#endif
+  tft.setAddrWindow(x, y, w, h);
+  while (n) {
+    chunk = (n < bufferSize) ? n : bufferSize;
+    pack444Swapped((uint8_t *)&pbuffer[0][0], data, chunk);
+    tft.pushPixels(&pbuffer[0][0], PIXEL_BYTES(chunk) >> 1);
+    data += chunk;
+    n    -= chunk;
+  }
+  tft.endWrite();
+  digitalWrite(cs, HIGH);
+#else
+  digitalWrite(cs, LOW);
+  tft.pushImage(x, y, w, h, data);
+  digitalWrite(cs, HIGH);
+#endif
+}
+
+#ifdef CROSSFADE
+// First sprite animation shows on display e, nullptr for the eyes or a
+// panel the sprite demos don't use
+const uint16_t *demoSprite(uint8_t animation, uint8_t e) {
+  if (animation == ANIM_EYES) return nullptr;
+  if (eye[e].tft_cs == device_A_CS) return gImage_A1;
+  if (eye[e].tft_cs == device_B_CS) return (animation == ANIM_DEMO_3) ? gImage_B1 : gImage_A1;
+  return nullptr;
+}
+
+// Draw sprites a and b on display e, cross-faded by alpha (crossfade.h)
+void drawFade(uint8_t e, const uint16_t *a, const uint16_t *b, uint32_t alpha) {
+  uint32_t n = XF_SPRITE * XF_SPRITE, chunk;
+#ifdef PANEL_IDF
+  panelWindow(e, 0, 0, XF_SPRITE, XF_SPRITE);
+#else
+  digitalWrite(eye[e].tft_cs, LOW);
+  tft.setAddrWindow(0, 0, XF_SPRITE, XF_SPRITE);
+#endif
+  for (; n; n -= chunk, a += chunk, b += chunk) {
+    chunk = (n < bufferSize) ? n : bufferSize;
+    xfade565<true>(&pbuffer[dmaBuf][0], a, b, chunk, alpha);
+    pushBuffer(e, &pbuffer[dmaBuf][0], chunk);
+#ifdef USE_DMA
+    dmaBuf = !dmaBuf;
+#endif
+  }
+#ifndef PANEL_IDF
+#ifdef USE_DMA
+  WAIT_BEGIN();
+  tft.dmaWait(); // Last buffer out before chip select goes high
+  WAIT_END();
+#else
+  spiFifoWait();
+#endif
+  tft.endWrite();
+  digitalWrite(eye[e].tft_cs, HIGH);
+#endif
+}
+
+// One frame of the transition from animation from to animation to, false
+// once it is over.  A rendered eye side keeps animating: drawEye() blends
+// each row with the sprite's pixels under the eye.  Sprite to sprite, whole
+// panels are blended.
+bool xfadeStep(uint8_t from, uint8_t to) {
+  uint32_t t = micros();
+  if (!xfade.active || (xfade.next != to)) { // Start
+    xfade.active = true;
+    xfade.next   = to;
+    xfade.start  = t;
+    xfade.frames = 0;
+    for (uint8_t e = 0; e < NUM_EYES; e++) {
+      int32_t x = eye[e].xposition;
+      xfade.from[e] = (from == ANIM_EYES) ? nullptr : spriteShown[e];
+      xfade.to[e]   = demoSprite(to, e);
+      xfade.eyeSprite[e] = (from == ANIM_EYES) ? xfade.to[e] : xfade.from[e];
+      if ((x & 1) || (x + EYE_WIDTH > XF_SPRITE) || (EYE_HEIGHT > XF_SPRITE))
+        xfade.eyeSprite[e] = nullptr; // Eye not inside the sprite: cut
+      if ((to == ANIM_EYES) && xfade.from[e]) { // Sprite around the eye goes now
+        clearRect(e, 0, 0, x, tft.height());
+        clearRect(e, x + EYE_WIDTH, 0, tft.width() - x - EYE_WIDTH, tft.height());
+        clearRect(e, x, EYE_HEIGHT, EYE_WIDTH, tft.height() - EYE_HEIGHT);
+      }
+    }
+  }
+
+  uint32_t alpha = xfadeAlpha(&xfade, t, CROSSFADE * 1000UL);
+  if (alpha >= XF_ONE) { // Done, the new animation takes over
+    xfade.active   = false;
+    xfade.eyeAlpha = 0;
+    LOG_INFO(LOG_XFADE, xfade.frames, (t - xfade.start) / 1000);
+    return false;
+  }
+  if ((from == ANIM_EYES) || (to == ANIM_EYES)) {
+    xfade.eyeAlpha = (from == ANIM_EYES) ? alpha : XF_ONE - alpha; // Sprite weight
+    updateEye();
+    xfade.eyeAlpha = 0;
+  } else {
+    for (uint8_t e = 0; e < NUM_EYES; e++) {
+      if (xfade.from[e] && xfade.to[e]) drawFade(e, xfade.from[e], xfade.to[e], alpha);
+    }
+  }
+  xfade.frames++;
+  return true;
+}
+
+// Time one XF_SPRITE x XF_SPRITE blend from flash into pbuffer, the worst
+// case a transition adds to a frame
+void xfadeBench(void) {
+  uint32_t t = micros();
+  for (uint32_t n = XF_SPRITE * XF_SPRITE, i = 0, chunk; n; n -= chunk, i += chunk) {
+    chunk = (n < bufferSize) ? n : bufferSize;
+    xfade565<true>(&pbuffer[0][0], gImage_A1 + i, gImage_B1 + i, chunk, XF_ONE / 2);
+  }
+  t = micros() - t;
+  Serial.printf("Cross-fade %ux%u: %lu us per frame, %lu us per eye\n", XF_SPRITE, XF_SPRITE,
+                (unsigned long)t, (unsigned long)(t * EYE_WIDTH * EYE_HEIGHT / (XF_SPRITE * XF_SPRITE)));
+}
+#endif
+
 void Demo_2()
 {
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160,160,gImage_A1);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160,160,gImage_A1);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160,160,gImage_A1);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160,160,gImage_A1);
 
 
    delay (frameTime);
@@ -565,51 +1429,35 @@ void Demo_2()
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A2);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A2);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A2);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A2);
 
    delay (frameTime);
 
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A3);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A3);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A3);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A3);
 
    delay (frameTime);
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A4);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A4);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A4);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A4);
 
 
    delay (frameTime);
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A5);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A5);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A5);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A5);
 
 
    delay (frameTime);
@@ -617,83 +1465,55 @@ void Demo_2()
 
 // ============================================================================
 // // ============================================================================
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A6);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A6);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A6);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A6);
    delay (frameTime);
 
 
 // // ============================================================================
 
-  digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A7);
-   digitalWrite (device_A_CS, HIGH);
+  pushSprite (device_A_CS, 0, 0,160, 160,gImage_A7);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A7);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A7);
 
    delay (frameTime);
 
 
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A8);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A8);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A8);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A8);
    delay (frameTime);
 
 
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A9);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A9);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A9);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A9);
 
    delay (frameTime);
 
 
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A10);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A10);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A10);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A10);
    delay (frameTime);
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A11);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A11);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A11);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A11);
    delay (frameTime);
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A12);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A12);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A12);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_A12);
    delay (frameTime);
 // // ============================================================================
 }
@@ -702,13 +1522,9 @@ void Demo_3()
 {
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160,160,gImage_A1);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160,160,gImage_A1);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160,160,gImage_B1);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160,160,gImage_B1);
 
 
    delay (frameTime);
@@ -716,51 +1532,35 @@ void Demo_3()
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A2);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A2);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B2);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B2);
 
    delay (frameTime);
 
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A3);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A3);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B3);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B3);
 
    delay (frameTime);
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A4);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A4);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B4);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B4);
 
 
    delay (frameTime);
 
 // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A5);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A5);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B5);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B5);
 
 
    delay (frameTime);
@@ -768,83 +1568,55 @@ void Demo_3()
 
 // ============================================================================
 // // ============================================================================
-  digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A6);
-   digitalWrite (device_A_CS, HIGH);
+  pushSprite (device_A_CS, 0, 0,160, 160,gImage_A6);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B6);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B6);
    delay (frameTime);
 
 
 // // ============================================================================
 
-  digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A7);
-   digitalWrite (device_A_CS, HIGH);
+  pushSprite (device_A_CS, 0, 0,160, 160,gImage_A7);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B7);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B7);
 
    delay (frameTime);
 
 
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A8);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A8);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B8);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B8);
    delay (frameTime);
 
 
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A9);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A9);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B9);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B9);
 
    delay (frameTime);
 
 
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A10);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A10);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B10);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B10);
    delay (frameTime);
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A11);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A11);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B11);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B11);
    delay (frameTime);
 // // ============================================================================
 
-   digitalWrite (device_A_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_A12);
-   digitalWrite (device_A_CS, HIGH);
+   pushSprite (device_A_CS, 0, 0,160, 160,gImage_A12);
 
-   digitalWrite (device_B_CS, LOW);
-   tft.pushImage (0, 0,160, 160,gImage_B12);
-   digitalWrite (device_B_CS, HIGH);
+   pushSprite (device_B_CS, 0, 0,160, 160,gImage_B12);
    delay (frameTime);
 // // ============================================================================
 }
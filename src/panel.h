@@ -0,0 +1,224 @@
+// Thin GC9D01 pixel driver on the ESP-IDF SPI master, used with
+// #define PANEL_IDF in main.cpp.
+//
+// Each panel is its own SPI device on SPI2 with its chip select driven by
+// the controller (the C3 has several CS lines), so nothing toggles CS in
+// software and the transfers for both eyes can be queued back to back:
+// while eye 0's last buffers are still going out, eye 1's address window
+// and first pixels are already waiting behind them.  D/C is set from each
+// transaction's user field in the pre-transfer callback.
+//
+// Transactions come from one pool of PANEL_QUEUE slots, retired oldest
+// first.  panelPixels() keeps one pixel transfer in flight, which is the
+// contract of TFT_eSPI's pushPixelsDMA() that the double-buffered render
+// loop relies on.  Buffers must be in internal RAM (DMA can't read flash).
+//
+// TFT_eSPI still does the power-up sequence, rotation and pixel format;
+// panelBegin() takes the bus over afterwards (SPI.end() first).
+//
+// Without ARDUINO a host mock stands in for the SPI master: transactions
+// are logged to panelMockLog[] and complete in queue order, so the queue
+// logic can be exercised on a PC.
+//
+// Include after config.h and pixelFormat.h.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define PANEL_QUEUE   16   // Transactions in flight, all panels
+#define PANEL_CASET   0x2A // Column address set
+#define PANEL_RASET   0x2B // Row address set
+#define PANEL_RAMWR   0x2C // Memory write
+
+#ifndef PANEL_X_OFFSET
+  #define PANEL_X_OFFSET 0 // Controller RAM position of the panel's origin
+#endif
+#ifndef PANEL_Y_OFFSET
+  #define PANEL_Y_OFFSET 0
+#endif
+
+#ifdef ARDUINO
+#include <driver/gpio.h>
+#include <driver/spi_master.h>
+#else
+// Host mock: the parts of driver/spi_master.h used below
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+#define PANEL_MOCK_LOG       256
+
+typedef int esp_err_t;
+typedef struct {
+  uint32_t flags;
+  size_t   length; // Bits
+  void    *user;   // D/C level
+  union {
+    const void *tx_buffer;
+    uint8_t     tx_data[4];
+  };
+} spi_transaction_t;
+typedef uint8_t spi_device_handle_t; // Panel index
+
+typedef struct {
+  uint8_t     panel;
+  uint8_t     dc;
+  uint32_t    bytes;
+  uint8_t     data[4]; // Inline data (commands, window coordinates)
+  const void *buffer;  // Pixel data
+} panelMockEntry_t;
+
+static panelMockEntry_t   panelMockLog[PANEL_MOCK_LOG];
+static uint32_t           panelMockCount;           // Entries logged (wraps)
+static spi_transaction_t *panelMockFifo[NUM_EYES][PANEL_QUEUE];
+static uint8_t            panelMockHead[NUM_EYES], panelMockTail[NUM_EYES];
+
+static inline esp_err_t spi_device_queue_trans(spi_device_handle_t d, spi_transaction_t *t, uint32_t) {
+  panelMockEntry_t *m = &panelMockLog[panelMockCount++ % PANEL_MOCK_LOG];
+  m->panel  = d;
+  m->dc     = (uint8_t)(uintptr_t)t->user;
+  m->bytes  = t->length / 8;
+  m->buffer = (t->flags & SPI_TRANS_USE_TXDATA) ? NULL : t->tx_buffer;
+  if (t->flags & SPI_TRANS_USE_TXDATA) memcpy(m->data, t->tx_data, 4);
+  panelMockFifo[d][panelMockHead[d]++ % PANEL_QUEUE] = t;
+  return 0;
+}
+
+static inline esp_err_t spi_device_get_trans_result(spi_device_handle_t d, spi_transaction_t **t, uint32_t) {
+  *t = panelMockFifo[d][panelMockTail[d]++ % PANEL_QUEUE];
+  return 0;
+}
+#define portMAX_DELAY 0xFFFFFFFF
+#endif // ARDUINO
+
+typedef struct {
+  spi_transaction_t t;
+  uint8_t           panel;
+  uint8_t           pixels; // Counts towards panelPixelsInFlight
+} panelSlot_t;
+
+static spi_device_handle_t panelDev[NUM_EYES];
+static int8_t              panelCs[NUM_EYES];
+static uint8_t             panelCount;
+static panelSlot_t         panelSlot[PANEL_QUEUE];
+static uint32_t            panelHead, panelTail; // Queued / retired slots
+static uint8_t             panelPixelsInFlight;
+
+// Wait for the oldest transaction and free its slot
+static void panelRetire(void) {
+  panelSlot_t       *s = &panelSlot[panelTail % PANEL_QUEUE];
+  spi_transaction_t *done;
+  spi_device_get_trans_result(panelDev[s->panel], &done, portMAX_DELAY);
+  panelPixelsInFlight -= s->pixels;
+  panelTail++;
+}
+
+static spi_transaction_t *panelNext(uint8_t p, uint8_t pixels) {
+  if (panelHead - panelTail >= PANEL_QUEUE) panelRetire();
+  panelSlot_t *s = &panelSlot[panelHead % PANEL_QUEUE];
+  memset(&s->t, 0, sizeof s->t);
+  s->panel  = p;
+  s->pixels = pixels;
+  return &s->t;
+}
+
+static void panelQueue(uint8_t p, spi_transaction_t *t) {
+  panelPixelsInFlight += panelSlot[panelHead % PANEL_QUEUE].pixels;
+  panelHead++;
+  spi_device_queue_trans(panelDev[p], t, portMAX_DELAY);
+}
+
+// Up to 4 bytes of command (dc 0) or parameters (dc 1), sent inline
+static void panelInline(uint8_t p, uint8_t dc, const uint8_t *data, uint8_t n) {
+  spi_transaction_t *t = panelNext(p, 0);
+  t->flags  = SPI_TRANS_USE_TXDATA;
+  t->length = n * 8;
+  t->user   = (void *)(uintptr_t)dc;
+  memcpy(t->tx_data, data, n);
+  panelQueue(p, t);
+}
+
+// Address window for the pixels that follow, like TFT_eSPI setAddrWindow()
+static void panelWindow(uint8_t p, int32_t x, int32_t y, int32_t w, int32_t h) {
+  uint16_t x1 = x + PANEL_X_OFFSET, x2 = x1 + w - 1;
+  uint16_t y1 = y + PANEL_Y_OFFSET, y2 = y1 + h - 1;
+  uint8_t  cmd, xd[4] = { (uint8_t)(x1 >> 8), (uint8_t)x1, (uint8_t)(x2 >> 8), (uint8_t)x2 };
+  uint8_t  yd[4]      = { (uint8_t)(y1 >> 8), (uint8_t)y1, (uint8_t)(y2 >> 8), (uint8_t)y2 };
+  cmd = PANEL_CASET; panelInline(p, 0, &cmd, 1); panelInline(p, 1, xd, 4);
+  cmd = PANEL_RASET; panelInline(p, 0, &cmd, 1); panelInline(p, 1, yd, 4);
+  cmd = PANEL_RAMWR; panelInline(p, 0, &cmd, 1);
+}
+
+// Queue bytes of pixel data for panel p.  Returns once every earlier pixel
+// transfer is done, so the previous buffer can be refilled.
+static void panelPixels(uint8_t p, const void *buf, uint32_t bytes) {
+  spi_transaction_t *t = panelNext(p, 1);
+  t->length    = bytes * 8;
+  t->user      = (void *)1;
+  t->tx_buffer = buf;
+  panelQueue(p, t);
+  while (panelPixelsInFlight > 1) panelRetire();
+}
+
+// Wait until everything queued has gone out
+static void panelWait(void) {
+  while (panelTail != panelHead) panelRetire();
+}
+
+#ifdef ARDUINO
+static void IRAM_ATTR panelPreTransfer(spi_transaction_t *t) {
+  gpio_set_level((gpio_num_t)TFT_DC, (int)(uintptr_t)t->user);
+}
+
+static bool panelAdd(uint8_t p, uint32_t hz) {
+  spi_device_interface_config_t dev = {};
+  dev.clock_speed_hz = hz;
+  dev.mode           = 0;
+  dev.spics_io_num   = panelCs[p];
+  dev.queue_size     = PANEL_QUEUE;
+  dev.pre_cb         = panelPreTransfer;
+  return spi_bus_add_device(SPI2_HOST, &dev, &panelDev[p]) == ESP_OK;
+}
+
+// Claim SPI2 and add a device for each of the n panels.  maxBytes is the
+// largest single pixel transfer.
+static bool panelBegin(const int8_t *cs, uint8_t n, uint32_t maxBytes) {
+  spi_bus_config_t bus = {};
+  bus.mosi_io_num      = TFT_MOSI;
+  bus.miso_io_num      = -1;
+  bus.sclk_io_num      = TFT_SCLK;
+  bus.quadwp_io_num    = -1;
+  bus.quadhd_io_num    = -1;
+  bus.max_transfer_sz  = maxBytes;
+  if (spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) return false;
+  pinMode(TFT_DC, OUTPUT);
+  panelCount = n;
+  for (uint8_t p = 0; p < n; p++) {
+    panelCs[p] = cs[p];
+    if (!panelAdd(p, SPI_FREQUENCY)) return false;
+  }
+  return true;
+}
+
+// Change the SPI clock of all panels (after everything queued is out)
+static bool panelClock(uint32_t hz) {
+  panelWait();
+  for (uint8_t p = 0; p < panelCount; p++) {
+    if ((spi_bus_remove_device(panelDev[p]) != ESP_OK) || !panelAdd(p, hz)) return false;
+  }
+  return true;
+}
+#else
+static inline bool panelBegin(const int8_t *cs, uint8_t n, uint32_t) {
+  panelCount = n;
+  for (uint8_t p = 0; p < n; p++) {
+    panelDev[p] = p;
+    panelCs[p]  = cs[p];
+  }
+  return true;
+}
+
+static inline bool panelClock(uint32_t) {
+  panelWait();
+  return true;
+}
+#endif // ARDUINO
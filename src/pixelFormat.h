@@ -0,0 +1,61 @@
+// Pixel format helpers for the eye renderer.
+//
+// The GC9D01 panels power up in 16-bit RGB565 mode (COLMOD 0x05), but also
+// accept a 12-bit RGB444 interface format (COLMOD 0x03) in which two pixels
+// are packed into three bytes:
+//
+//   byte 0: R0 G0   byte 1: B0 R1   byte 2: G1 B1   (4 bits each, MSB first)
+//
+// That is 25% fewer bytes on the SPI bus per frame.  The eye tables stay in
+// RGB565 and are packed on the fly just before each buffer is pushed, which
+// only costs a few shifts per pixel.
+
+#pragma once
+
+#include <stdint.h>
+
+#define COLMOD_CMD    0x3A // Interface pixel format command
+#define COLMOD_12BIT  0x03 // RGB444, 2 pixels per 3 bytes
+#define COLMOD_16BIT  0x05 // RGB565, 1 pixel per 2 bytes
+
+// Bytes sent on the bus for n pixels (n must be even in 12-bit mode)
+#ifdef COLOR_12BIT
+  #define PIXEL_BYTES(n) (((n) * 3) >> 1)
+#else
+  #define PIXEL_BYTES(n) ((n) << 1)
+#endif
+
+// Value stored in the push buffer for an eye table pixel: byte-swapped for
+// the wire in 16-bit mode, left as-is for pack444() in 12-bit mode.  Tables
+// generated with "assetc --swap" (EYE_ASSET_SWAPPED) are already in wire
+// order and skip the swap.
+#if defined(COLOR_12BIT) || defined(EYE_ASSET_SWAPPED)
+  #define PIXEL_OUT(p) ((uint16_t)(p))
+#else
+  #define PIXEL_OUT(p) ((uint16_t)((p) >> 8 | (p) << 8))
+#endif
+
+// Pack n native RGB565 pixels into RGB444 byte triplets.  n must be even.
+// dst may be the same buffer as src: each pair is read in full before its
+// three bytes are written, and writes never overtake the read position.
+static inline void pack444(uint8_t *dst, const uint16_t *src, uint32_t n) {
+  for (n >>= 1; n; n--, src += 2, dst += 3) {
+    uint32_t p0 = src[0], p1 = src[1];
+    dst[0] = ((p0 >> 8) & 0xF0) | ((p0 >> 7) & 0x0F); // R0 G0
+    dst[1] = ((p0 << 3) & 0xF0) | (p1 >> 12);        // B0 R1
+    dst[2] = ((p1 >> 3) & 0xF0) | ((p1 >> 1) & 0x0F); // G1 B1
+  }
+}
+
+// As pack444(), for byte-swapped (wire order) RGB565 source data such as
+// the gImage_* sprite tables, which TFT_eSPI pushes straight from memory.
+static inline void pack444Swapped(uint8_t *dst, const uint16_t *src, uint32_t n) {
+  for (n >>= 1; n; n--, src += 2, dst += 3) {
+    uint32_t p0 = src[0], p1 = src[1];
+    p0 = ((p0 >> 8) | (p0 << 8)) & 0xFFFF;
+    p1 = ((p1 >> 8) | (p1 << 8)) & 0xFFFF;
+    dst[0] = ((p0 >> 8) & 0xF0) | ((p0 >> 7) & 0x0F);
+    dst[1] = ((p0 << 3) & 0xF0) | (p1 >> 12);
+    dst[2] = ((p1 >> 3) & 0xF0) | ((p1 >> 1) & 0x0F);
+  }
+}
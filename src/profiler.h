@@ -0,0 +1,114 @@
+// Per-stage frame profiler, enabled with #define PROFILE in config.h.
+//
+// Time is charged from the CPU cycle counter to whichever stage is current,
+// so each stage transition costs one counter read and one 64-bit add, and
+// nested stages (e.g. SPI waits inside an eye render) are never counted
+// twice.  Anything outside a marked stage counts as idle.  Send 'p' over
+// serial for a per-frame breakdown; the counters are cleared after each
+// dump.  Without PROFILE the macros below compile to nothing.
+//
+// Off the device (no ARDUINO), CLOCK_MONOTONIC nanoseconds stand in for
+// cycles and the dump goes to stdout.
+//
+// Include after config.h (stage count depends on NUM_EYES).
+
+#pragma once
+
+#include <stdint.h>
+
+#define PROF_LOGIC    0 // Gaze, blink and iris animation logic
+#define PROF_TRACKING 1 // Eyelid tracking and blink thresholds
+#define PROF_SPI      2 // Pushing pixels, including waits for DMA
+#define PROF_IDLE     3 // yield() and everything between frames
+#define PROF_RENDER   4 // + eye index: pixel rendering for that eye
+#define PROF_STAGES   (PROF_RENDER + NUM_EYES)
+
+#ifdef PROFILE
+
+#ifdef ARDUINO
+  #define PROF_CLOCK() ((uint32_t)ESP.getCycleCount())
+  #define PROF_MHZ     ESP.getCpuFreqMHz()
+#else
+  #include <stdio.h>
+  #include <time.h>
+  static inline uint32_t profClock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+  }
+  #define PROF_CLOCK() profClock()
+  #define PROF_MHZ     1000
+#endif
+
+static struct {
+  uint64_t cycles[PROF_STAGES]; // Accumulated per stage since last dump
+  uint32_t frames;              // frame() calls since last dump
+  uint32_t last;                // Counter value at last stage change
+  uint8_t  stage;               // Stage being charged now
+} prof = { {0}, 0, 0, PROF_IDLE };
+
+// Charge elapsed cycles to the current stage and switch to a new one.
+// Returns the previous stage so it can be restored.
+static inline uint8_t profEnter(uint8_t stage) {
+  uint32_t now = PROF_CLOCK();
+  uint8_t  prev = prof.stage;
+  prof.cycles[prev] += now - prof.last; // Wraps safely, deltas are < 2^32
+  prof.last  = now;
+  prof.stage = stage;
+  return prev;
+}
+
+static void profPrint(const char *s) {
+#ifdef ARDUINO
+  Serial.print(s);
+#else
+  fputs(s, stdout);
+#endif
+}
+
+// Print microseconds per frame and share of total for each stage, then
+// start a new measurement period.
+static void profDump(void) {
+  static const char *names[] = { "logic", "tracking", "spi", "idle" };
+  char     line[48];
+  uint64_t total = 0;
+  uint32_t frames = prof.frames ? prof.frames : 1;
+
+  profEnter(prof.stage); // Bring the current stage up to date
+  for (uint8_t s = 0; s < PROF_STAGES; s++) total += prof.cycles[s];
+  if (!total) total = 1;
+  snprintf(line, sizeof line, "prof: %lu frames\n", (unsigned long)prof.frames);
+  profPrint(line);
+  for (uint8_t s = 0; s < PROF_STAGES; s++) {
+    uint32_t us = prof.cycles[s] / PROF_MHZ / frames;
+    if (s < PROF_RENDER) {
+      snprintf(line, sizeof line, "  %-9s %6lu us/frame %3u%%\n", names[s],
+               (unsigned long)us, (unsigned)(prof.cycles[s] * 100 / total));
+    } else {
+      snprintf(line, sizeof line, "  render%-3u %6lu us/frame %3u%%\n", s - PROF_RENDER,
+               (unsigned long)us, (unsigned)(prof.cycles[s] * 100 / total));
+    }
+    profPrint(line);
+    prof.cycles[s] = 0;
+  }
+  prof.frames = 0;
+  prof.last   = PROF_CLOCK(); // Don't charge the dump itself
+}
+
+  // One PROF_BEGIN()/PROF_END() pair per scope; PROF_NEXT() switches stage
+  // within it.
+  #define PROF_BEGIN(s) uint8_t profPrev = profEnter(s)
+  #define PROF_NEXT(s)  profEnter(s)
+  #define PROF_END()    profEnter(profPrev)
+  #define PROF_FRAME()  prof.frames++
+  #define PROF_INIT()   prof.last = PROF_CLOCK() // Start of first period
+
+#else
+
+  #define PROF_BEGIN(s)
+  #define PROF_NEXT(s)
+  #define PROF_END()
+  #define PROF_FRAME()
+  #define PROF_INIT()
+
+#endif // PROFILE
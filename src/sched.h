@@ -0,0 +1,79 @@
+// Eye scheduler: which eye frame() renders next.
+//
+// Plain round robin gives every eye the same number of frames, not the
+// same share of the bus and CPU: with more than two panels on one bus,
+// eyes whose frames cost more (open lids, iris rows, full resolution
+// while the deadline controller degrades another eye) crowd the others
+// out.  schedNext() picks the eye that has used the least time so far
+// (ties go to the next eye after the last one, so equal costs still
+// alternate in order), and schedCharge() adds what its frame took, start
+// of frame() to the last pixel queued; a frame deadline.h skips is charged
+// its predicted cost, so the skip really gives that time to the other
+// eyes.  An eye can't bank time: usage is kept relative to the
+// least-served eye and capped at SCHED_CREDIT.
+//
+// schedReport() (serial 'f') prints frames per second per eye and each
+// eye's share of the time since the last report.
+//
+// Include after config.h.
+
+#pragma once
+
+#include <stdint.h>
+
+#define SCHED_CREDIT 100000 // us an eye can fall behind the others at most
+
+typedef struct {
+  uint32_t used[NUM_EYES];   // us, relative to the least-served eye
+  uint32_t total[NUM_EYES];  // Frames since boot
+  uint32_t frames[NUM_EYES]; // Since the last report
+  uint64_t busy[NUM_EYES];   // us, since the last report
+  uint32_t since;            // millis() of the last report
+  uint8_t  last;
+} sched_t;
+
+static sched_t sched;
+
+static uint8_t schedNext(void) {
+  uint8_t best = (sched.last + 1) % NUM_EYES;
+  for (uint8_t i = 2; i <= NUM_EYES; i++) {
+    uint8_t e = (sched.last + i) % NUM_EYES;
+    if (sched.used[e] < sched.used[best]) best = e;
+  }
+  return sched.last = best;
+}
+
+// Eye e's frame took us
+static void schedCharge(uint8_t e, uint32_t us) {
+  uint32_t least = 0xFFFFFFFF, most = 0;
+  sched.used[e]  += us;
+  sched.busy[e]  += us;
+  sched.frames[e]++;
+  sched.total[e]++;
+  for (uint8_t i = 0; i < NUM_EYES; i++) {
+    if (sched.used[i] < least) least = sched.used[i];
+    if (sched.used[i] > most) most = sched.used[i];
+  }
+  if (most - least > SCHED_CREDIT) least = most - SCHED_CREDIT;
+  for (uint8_t i = 0; i < NUM_EYES; i++) {
+    sched.used[i] = (sched.used[i] > least) ? sched.used[i] - least : 0;
+  }
+}
+
+// Frames/s of eye e since the last report, in tenths
+static uint32_t schedFps10(uint8_t e, uint32_t now) {
+  uint32_t elapsed = now - sched.since;
+  return elapsed ? (uint64_t)sched.frames[e] * 10000 / elapsed : 0;
+}
+
+static void schedReport(void) {
+  uint32_t now = millis(), elapsed = now - sched.since;
+  for (uint8_t e = 0; e < NUM_EYES; e++) {
+    uint32_t fps = schedFps10(e, now);
+    Serial.printf("Eye %u: %lu.%lu fps, %lu%% of the time\n", e, (unsigned long)fps / 10,
+                  (unsigned long)fps % 10,
+                  elapsed ? (unsigned long)(sched.busy[e] / 10 / elapsed) : 0UL);
+    sched.frames[e] = sched.busy[e] = 0;
+  }
+  sched.since = now;
+}
@@ -0,0 +1,217 @@
+// Analog inputs (joystick X/Y, light sensor) sampled in the background.
+//
+// On the ESP32-C3 the ADC runs in continuous (DMA) mode, cycling through
+// the configured pins at SENSOR_RATE; analogRead() is no longer called.
+// sensorPoll() takes whatever conversions have arrived since the last call
+// without waiting and runs them through a fixed-point filter per input:
+// SENSOR_OVERSAMPLE 12-bit samples are summed (16-bit result), then a
+// first-order IIR moves the output 1/2^SENSOR_SMOOTH of the way towards
+// each new sum.  The latest filtered value, 0-1023 like the old readings,
+// is just an array load.
+//
+// For latency measurement each input also remembers when what its output
+// shows was sampled: the first filter step whose raw block is more than
+// SENSOR_MOVE away from the filtered value opens a move, which ends once
+// the filter has caught up.  sensorMoved() gives the time of the first
+// conversion of that step, or of the latest step outside a move, so a
+// change seen on the filtered output is timed from the samples, including
+// the DMA buffering and (for a move) the filter's lag.  Conversion
+// times are counted back from the poll at SENSOR_RATE, the newest taken
+// as half a DMA frame (SENSOR_FRAME conversions) before it.
+//
+// The per-frame math that used to follow the readings is table driven:
+//  - sensorIris() maps a light reading to an iris scale (LIGHT_PIN_FLIP,
+//    LIGHT_MIN/MAX clamp, LIGHT_CURVE gamma and IRIS_MIN/MAX range) through
+//    one 1024-entry table built at startup, instead of a double pow().
+//  - sensorCircle() clips a joystick position to the unit circle with a
+//    reciprocal square root table indexed by the squared distance, instead
+//    of a float sqrt() and two divides.
+//
+// Without ARDUINO (host builds) nothing is sampled; tools/sensorplay feeds
+// recorded streams straight into sensorSample().
+//
+// Include after config.h.
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#define SENSOR_JOY_X 0
+#define SENSOR_JOY_Y 1
+#define SENSOR_LIGHT 2
+#define SENSORS      3
+
+#define SENSOR_RATE            6000 // Conversions/s, all inputs together
+#define SENSOR_OVERSAMPLE_BITS 4    // 16 samples per filter step
+#define SENSOR_OVERSAMPLE      (1 << SENSOR_OVERSAMPLE_BITS)
+#define SENSOR_SMOOTH          2    // IIR weight of a new step: 1/4
+#define SENSOR_FRAME           64   // Conversions per DMA interrupt
+#define SENSOR_MOVE            8    // Raw step this far from the output starts a move
+
+// Circle clamp table: 1023 / sqrt(d) (Q15) for squared distances d from
+// 1023^2 up to 2 * 1023^2, one entry per 2^SENSOR_CIRCLE_SHIFT
+#define SENSOR_CIRCLE_R2    (1023L * 1023L)
+#define SENSOR_CIRCLE_SHIFT 10
+#define SENSOR_CIRCLE_SIZE  ((SENSOR_CIRCLE_R2 >> SENSOR_CIRCLE_SHIFT) + 2)
+
+typedef struct {
+  uint32_t sum;    // Samples in the current oversampling block
+  uint8_t  n;
+  uint8_t  primed; // acc holds a value
+  uint32_t acc;    // Filtered 16-bit block sum << SENSOR_SMOOTH
+  uint32_t first;  // Conversion number of the block's first sample
+  uint8_t  moving; // The output is catching up with a move
+  uint32_t moved;  // Conversion number the output is timed from
+} sensorFilter_t;
+
+static sensorFilter_t sensorFilter[SENSORS];
+static uint16_t       sensorValue[SENSORS];  // Latest filtered, 0-1023
+static uint32_t       sensorConversions;     // Taken so far, all inputs
+static uint32_t       sensorPollTime;        // micros() of the last sensorPoll()
+static int16_t        sensorIrisLut[1024];
+static uint16_t       sensorCircleLut[SENSOR_CIRCLE_SIZE];
+
+// One raw 12-bit conversion for input s
+static inline void sensorSample(uint8_t s, uint16_t raw) {
+  sensorFilter_t *f = &sensorFilter[s];
+  if (!f->n) f->first = sensorConversions;
+  sensorConversions++;
+  f->sum += raw & 0xFFF;
+  if (++f->n < SENSOR_OVERSAMPLE) return;
+  if (!f->primed) { // First block sets the starting point, no ramp from 0
+    f->acc    = f->sum << SENSOR_SMOOTH;
+    f->primed = 1;
+  } else {
+    // Distance of this block from the output, in 10-bit units
+    int32_t d = ((int32_t)f->sum - (int32_t)(f->acc >> SENSOR_SMOOTH)) >> (SENSOR_OVERSAMPLE_BITS + 2);
+    uint8_t moving = (d > SENSOR_MOVE) || (d < -SENSOR_MOVE);
+    if (!moving || !f->moving) f->moved = f->first; // Kept while a move lasts
+    f->moving = moving;
+    f->acc += f->sum - (f->acc >> SENSOR_SMOOTH);
+  }
+  f->sum = f->n = 0;
+  // 12 + SENSOR_OVERSAMPLE_BITS bits down to 10
+  sensorValue[s] = f->acc >> (SENSOR_SMOOTH + SENSOR_OVERSAMPLE_BITS + 2);
+}
+
+static inline uint16_t sensorRead(uint8_t s) {
+  return __atomic_load_n(&sensorValue[s], __ATOMIC_RELAXED);
+}
+
+// micros() when the samples behind input s's output were taken (see above)
+static inline uint32_t sensorMoved(uint8_t s) {
+  uint32_t back = sensorConversions - sensorFilter[s].moved + SENSOR_FRAME / 2;
+  return sensorPollTime - (uint32_t)((uint64_t)back * 1000000 / SENSOR_RATE);
+}
+
+// Light reading (0-1023) to iris scale
+static inline int16_t sensorIris(uint16_t light) {
+  return sensorIrisLut[light & 1023];
+}
+
+// Clip a 0-1023 X/Y position to the circle around the center
+static inline void sensorCircle(int16_t *x, int16_t *y) {
+  int32_t dx = (*x * 2) - 1023; // A/D exact center is at 511.5.  Scale coords
+  int32_t dy = (*y * 2) - 1023; // X2 so range is -1023 to +1023 w/center at 0.
+  int32_t d  = dx * dx + dy * dy;
+  if (d <= SENSOR_CIRCLE_R2) return;
+  int32_t s = sensorCircleLut[(d - SENSOR_CIRCLE_R2) >> SENSOR_CIRCLE_SHIFT];
+  *x = (((dx * s) >> 15) + 1023) / 2; // Clip to circle edge,
+  *y = (((dy * s) >> 15) + 1023) / 2; // scale back to 0-1023
+}
+
+static void sensorTables(void) {
+  for (int16_t i = 0; i < 1024; i++) {
+    int32_t v = i;
+#ifdef LIGHT_PIN_FLIP
+    v = 1023 - v;                          // Reverse reading from sensor
+#endif
+    if (v < LIGHT_MIN)      v = LIGHT_MIN; // Clamp light sensor range
+    else if (v > LIGHT_MAX) v = LIGHT_MAX;
+    v -= LIGHT_MIN;                        // 0 to (LIGHT_MAX - LIGHT_MIN)
+#ifdef LIGHT_CURVE
+    v = (int32_t)(pow((double)v / (double)(LIGHT_MAX - LIGHT_MIN),
+                      LIGHT_CURVE) * (double)(LIGHT_MAX - LIGHT_MIN));
+#endif
+    // And scale to iris range (IRIS_MAX is size at LIGHT_MIN)
+    sensorIrisLut[i] = IRIS_MAX + v * (IRIS_MIN - IRIS_MAX) / (LIGHT_MAX - LIGHT_MIN);
+  }
+  for (int32_t i = 0; i < SENSOR_CIRCLE_SIZE; i++) { // Middle of each step
+    double d = (double)SENSOR_CIRCLE_R2 + ((i << SENSOR_CIRCLE_SHIFT) | (1 << (SENSOR_CIRCLE_SHIFT - 1)));
+    sensorCircleLut[i] = (uint16_t)(1023.0 / sqrt(d) * 32768.0 + 0.5);
+  }
+}
+
+#ifdef ARDUINO
+#include <driver/adc.h>
+
+static uint8_t sensorOfChannel[8]; // ADC1 channel to input + 1, 0 = unused
+
+static void sensorAdd(adc_digi_pattern_config_t *pattern, uint32_t *n, uint32_t *mask,
+                      int8_t pin, uint8_t s) {
+  if (pin < 0) return;
+  int8_t ch = digitalPinToAnalogChannel(pin);
+  if ((ch < 0) || (ch > 7)) return; // ADC2 is not usable in continuous mode
+  pattern[*n].atten     = ADC_ATTEN_DB_11;
+  pattern[*n].channel   = ch;
+  pattern[*n].unit      = 0; // ADC1
+  pattern[*n].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+  (*n)++;
+  *mask |= 1 << ch;
+  sensorOfChannel[ch] = s + 1;
+}
+
+// Build the tables and start the ADC on whichever inputs are configured
+static void sensorBegin(void) {
+  adc_digi_pattern_config_t pattern[SENSORS];
+  uint32_t                  n = 0, mask = 0;
+
+  sensorTables();
+#if defined(JOYSTICK_X_PIN) && (JOYSTICK_X_PIN >= 0) && \
+    defined(JOYSTICK_Y_PIN) && (JOYSTICK_Y_PIN >= 0)
+  sensorAdd(pattern, &n, &mask, JOYSTICK_X_PIN, SENSOR_JOY_X);
+  sensorAdd(pattern, &n, &mask, JOYSTICK_Y_PIN, SENSOR_JOY_Y);
+#endif
+#if defined(LIGHT_PIN) && (LIGHT_PIN >= 0)
+  sensorAdd(pattern, &n, &mask, LIGHT_PIN, SENSOR_LIGHT);
+#endif
+  if (!n) return;
+
+  adc_digi_init_config_t init = {};
+  init.max_store_buf_size     = 2048; // ~80 ms of conversions
+  init.conv_num_each_intr     = SENSOR_FRAME * sizeof(adc_digi_output_data_t);
+  init.adc1_chan_mask         = mask;
+  adc_digi_configuration_t config = {};
+  config.pattern_num    = n;
+  config.adc_pattern    = pattern;
+  config.sample_freq_hz = SENSOR_RATE;
+  config.conv_mode      = ADC_CONV_SINGLE_UNIT_1;
+  config.format         = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+  if ((adc_digi_initialize(&init) != ESP_OK) ||
+      (adc_digi_controller_configure(&config) != ESP_OK) ||
+      (adc_digi_start() != ESP_OK)) {
+    Serial.println("Sensor ADC failed to start");
+  }
+}
+
+// Filter everything converted since the last call, never waits
+static void sensorPoll(void) {
+  uint8_t  buf[256];
+  uint32_t len;
+  esp_err_t err;
+  // ESP_ERR_INVALID_STATE only reports an earlier overflow, data is valid
+  while ((((err = adc_digi_read_bytes(buf, sizeof buf, &len, 0)) == ESP_OK) ||
+          (err == ESP_ERR_INVALID_STATE)) && len) {
+    for (uint32_t i = 0; i + sizeof(adc_digi_output_data_t) <= len; i += sizeof(adc_digi_output_data_t)) {
+      const adc_digi_output_data_t *r = (const adc_digi_output_data_t *)&buf[i];
+      uint8_t s = sensorOfChannel[r->type2.channel & 7];
+      if (s && !r->type2.unit) sensorSample(s - 1, r->type2.data);
+    }
+  }
+  sensorPollTime = micros();
+}
+#else
+static inline void sensorBegin(void) { sensorTables(); }
+static inline void sensorPoll(void) {}
+#endif // ARDUINO
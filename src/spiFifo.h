@@ -0,0 +1,57 @@
+// Register-level pixel push for builds without USE_DMA on the ESP32-C3.
+//
+// tft.pushPixels() goes through TFT_eSPI's generic write path on every
+// call.  spiFifoPush() instead feeds the SPI2 data buffer (W0-W15, 64
+// bytes) directly: each burst is loaded from the push buffer into
+// registers while the previous one is still shifting out, so the bus only
+// idles for the 16 stores and the start handshake between bursts.  It
+// returns with the last burst still on the wire, which overlaps it with
+// the start of the next chunk's rendering; spiFifoWait() before anything
+// else touches the bus (tft.endWrite() also waits).
+//
+// Buffers must be 4-byte aligned.  The bus must already be set up for
+// writing (tft.setAddrWindow()), as for tft.pushPixels().
+//
+// Other targets, and DMA builds, keep tft.pushPixels() and spiFifoWait()
+// does nothing.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(USE_DMA) && defined(CONFIG_IDF_TARGET_ESP32C3)
+#define SPI_FIFO
+
+#include <soc/spi_struct.h>
+
+#define SPI_FIFO_BYTES 64 // W0-W15
+
+static inline void spiFifoWait(void) {
+  while (GPSPI2.cmd.usr);
+}
+
+// Send bytes from buf, returns while the last burst is going out
+static void IRAM_ATTR spiFifoPush(const void *buf, uint32_t bytes) {
+  const uint32_t *src = (const uint32_t *)buf;
+  uint32_t        w[SPI_FIFO_BYTES / 4];
+  while (bytes) {
+    uint32_t n = (bytes < SPI_FIFO_BYTES) ? bytes : SPI_FIFO_BYTES;
+    if (n == SPI_FIFO_BYTES) { // Next burst, while the last one shifts out
+      for (uint8_t i = 0; i < SPI_FIFO_BYTES / 4; i++) w[i] = src[i];
+    } else {
+      memcpy(w, src, n);       // Don't read past the end of the buffer
+    }
+    spiFifoWait();
+    for (uint8_t i = 0; i < (n + 3) / 4; i++) GPSPI2.data_buf[i] = w[i];
+    GPSPI2.ms_dlen.ms_data_bitlen = n * 8 - 1;
+    GPSPI2.cmd.update = 1;     // Sync the length to the SPI clock domain
+    while (GPSPI2.cmd.update);
+    GPSPI2.cmd.usr = 1;
+    src   += SPI_FIFO_BYTES / 4;
+    bytes -= n;
+  }
+}
+#else
+static inline void spiFifoWait(void) {}
+#endif
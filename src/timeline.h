@@ -0,0 +1,199 @@
+// Keyframe timeline for gaze, iris and eyelid channels.
+//
+// Each channel has a small ring of keyframes (absolute micros() time,
+// value, easing of the segment that ends at that key).  tlUpdate()
+// evaluates every channel once per frame: move past keys whose time has
+// come, then interpolate the current segment through a 256-entry easing
+// table.  That is constant time per channel with no allocation.  A
+// channel holding its last key is idle.
+//
+// The easing tables are generated at compile time.  TL_SMOOTH is 3t^2-2t^3,
+// the same curve as the old hand-typed ease[] table, and is used for
+// saccades.
+//
+// Channels:
+//   TL_GAZE_X, TL_GAZE_Y  0-1023, like joystick or CMD_GAZE positions
+//   TL_IRIS               iris scale, 0 = not overriding
+//   TL_CLOSE              both lids, 0 = as rendered .. 255 = shut
+//   TL_SQUINT             lower lid mostly, 0 = none .. 255 = full
+//
+// Scripted expressions are tables of steps (time from the start in ms,
+// channel, value, easing).  tlPlay() cuts each channel it uses at its
+// current value and queues the steps, so an expression starts smoothly
+// from wherever the eye is.  The built-in ones are in tlExpressions[], and
+// CMD_EXPR selects one over serial.
+//
+// Plain C++, no Arduino dependencies, so tools/tlplay can run it on a PC.
+// Include after config.h.
+
+#pragma once
+
+#include <stdint.h>
+
+#define TL_GAZE_X   0
+#define TL_GAZE_Y   1
+#define TL_IRIS     2
+#define TL_CLOSE    3
+#define TL_SQUINT   4
+#define TL_CHANNELS 5
+
+#define TL_LINEAR   0 // Easing of a segment
+#define TL_SMOOTH   1 // 3t^2-2t^3, in and out
+#define TL_IN       2 // t^2, starts slow
+#define TL_OUT      3 // 1-(1-t)^2, ends slow
+#define TL_STEP     4 // Holds the start value, jumps at the key
+
+#define TL_KEYS     16 // Keys per channel, power of 2
+
+// Easing tables, built by the compiler: 0-255 for t = i / 255
+constexpr uint8_t tlEaseIn(uint32_t i)  { return (i * i + 127) / 255; }
+constexpr uint8_t tlEaseOut(uint32_t i) { return 255 - tlEaseIn(255 - i); }
+constexpr uint8_t tlSmooth(uint32_t i)  { return (i * i * (765 - 2 * i) + 32512) / 65025; }
+
+template <uint32_t... I> struct tlSeq {};
+template <uint32_t N, uint32_t... I> struct tlMakeSeq : tlMakeSeq<N - 1, N - 1, I...> {};
+template <uint32_t... I> struct tlMakeSeq<0, I...> { typedef tlSeq<I...> type; };
+
+template <typename S> struct tlEaseTables;
+template <uint32_t... I> struct tlEaseTables<tlSeq<I...> > {
+  static const uint8_t table[3][256]; // TL_SMOOTH, TL_IN, TL_OUT
+};
+template <uint32_t... I> const uint8_t tlEaseTables<tlSeq<I...> >::table[3][256] = {
+  { tlSmooth(I)... }, { tlEaseIn(I)... }, { tlEaseOut(I)... }
+};
+#define TL_EASE(e, i) (tlEaseTables<tlMakeSeq<256>::type>::table[(e) - TL_SMOOTH][i])
+
+typedef struct {
+  uint32_t time;  // micros()
+  int16_t  value;
+  uint8_t  ease;  // Of the segment ending here
+} tlKey_t;
+
+typedef struct {
+  tlKey_t key[TL_KEYS];
+  uint8_t head, tail; // key[tail] starts the current segment, head is free
+} tlTrack_t;
+
+typedef struct {
+  tlTrack_t track[TL_CHANNELS];
+  int16_t   value[TL_CHANNELS]; // As of the last tlUpdate()
+} timeline_t;
+
+typedef struct {
+  uint16_t at;      // ms from the start of the expression
+  uint8_t  channel;
+  uint8_t  ease;
+  int16_t  value;
+} tlStep_t;
+
+typedef struct {
+  const tlStep_t *step;
+  uint8_t         steps;
+} tlExpr_t;
+
+#define TL_KEY(tr, i) ((tr)->key[(uint8_t)(i) & (TL_KEYS - 1)])
+
+// Drop all keys, hold v from time t
+static inline void tlSet(tlTrack_t *tr, uint32_t t, int16_t v) {
+  tr->tail = 0;
+  tr->head = 1;
+  tr->key[0].time  = t;
+  tr->key[0].value = v;
+  tr->key[0].ease  = TL_LINEAR;
+}
+
+// Queue a key at time t (not before the last one).  False if full.
+static inline bool tlTo(tlTrack_t *tr, uint32_t t, int16_t v, uint8_t ease) {
+  if ((uint8_t)(tr->head - tr->tail) >= TL_KEYS) return false;
+  tlKey_t *k = &TL_KEY(tr, tr->head++);
+  k->time  = t;
+  k->value = v;
+  k->ease  = ease;
+  return true;
+}
+
+// Value at time t; t must not go backwards between calls
+static int16_t tlEval(tlTrack_t *tr, uint32_t t) {
+  while (((uint8_t)(tr->head - tr->tail) >= 2) && ((int32_t)(t - TL_KEY(tr, tr->tail + 1).time) >= 0))
+    tr->tail++;
+  const tlKey_t *a = &TL_KEY(tr, tr->tail);
+  if ((uint8_t)(tr->head - tr->tail) < 2) return a->value; // Holding
+  const tlKey_t *b    = &TL_KEY(tr, tr->tail + 1);
+  uint32_t       span = b->time - a->time, dt = t - a->time;
+  if (b->ease == TL_STEP) return a->value;
+  uint32_t       f = (span < (1UL << 24)) ? 255 * dt / span : dt / (span / 255); // 0-254
+  if (b->ease == TL_LINEAR) return a->value + (b->value - a->value) * (int32_t)f / 255;
+  return a->value + ((b->value - a->value) * (TL_EASE(b->ease, f) + 1)) / 256;
+}
+
+// No keys left ahead of time t (call after tlEval() for t)
+static inline bool tlIdle(const tlTrack_t *tr) {
+  return (uint8_t)(tr->head - tr->tail) < 2;
+}
+
+// Time of the next key ahead (call after tlEval()); false if idle
+static inline bool tlNext(const tlTrack_t *tr, uint32_t *t) {
+  if (tlIdle(tr)) return false;
+  *t = TL_KEY(tr, tr->tail + 1).time;
+  return true;
+}
+
+// Time and value of the last key queued
+static inline const tlKey_t *tlLast(const tlTrack_t *tr) {
+  return &TL_KEY(tr, tr->head - 1);
+}
+
+static void tlInit(timeline_t *tl, uint32_t t) {
+  for (uint8_t c = 0; c < TL_CHANNELS; c++) {
+    tl->value[c] = (c <= TL_GAZE_Y) ? 512 : 0;
+    tlSet(&tl->track[c], t, tl->value[c]);
+  }
+}
+
+// Evaluate every channel for time t into tl->value[]
+static void tlUpdate(timeline_t *tl, uint32_t t) {
+  for (uint8_t c = 0; c < TL_CHANNELS; c++) tl->value[c] = tlEval(&tl->track[c], t);
+}
+
+// Start an expression at time t (after tlUpdate() for t).  Keys already
+// queued on the channels it uses are dropped.
+static void tlPlay(timeline_t *tl, const tlExpr_t *x, uint32_t t) {
+  uint8_t cut = 0;
+  for (uint8_t i = 0; i < x->steps; i++) {
+    const tlStep_t *s = &x->step[i];
+    if (!(cut & (1 << s->channel))) {
+      tlSet(&tl->track[s->channel], t, tl->value[s->channel]);
+      cut |= 1 << s->channel;
+    }
+    tlTo(&tl->track[s->channel], t + s->at * 1000UL, s->value, s->ease);
+  }
+}
+
+// Built-in expressions, numbered for CMD_EXPR.  Steps of one channel must
+// be in time order.
+static const tlStep_t tlLookAndBlink[] = { // Glance aside, blink, look back
+  { 150,  TL_GAZE_X, TL_SMOOTH, 120 }, { 150, TL_GAZE_Y, TL_SMOOTH, 512 },
+  { 650,  TL_CLOSE,  TL_STEP,   0   }, { 710, TL_CLOSE,  TL_IN,     255 },
+  { 830,  TL_CLOSE,  TL_OUT,    0   },
+  { 1000, TL_GAZE_X, TL_STEP,   120 }, { 1150, TL_GAZE_X, TL_SMOOTH, 512 },
+};
+static const tlStep_t tlSquint[] = {       // Narrow the eyes for a while
+  { 250,  TL_SQUINT, TL_SMOOTH, 170 }, { 1800, TL_SQUINT, TL_STEP, 170 },
+  { 2100, TL_SQUINT, TL_SMOOTH, 0   },
+};
+static const tlStep_t tlDrowsy[] = {       // Lids droop, then snap open
+  { 1500, TL_CLOSE,  TL_SMOOTH, 200 }, { 2500, TL_CLOSE,  TL_STEP,   200 },
+  { 2600, TL_CLOSE,  TL_OUT,    0   }, { 1500, TL_GAZE_Y, TL_SMOOTH, 700 },
+  { 2600, TL_GAZE_Y, TL_OUT,    512 },
+};
+static const tlStep_t tlSurprise[] = {     // Iris jumps wide, eyes stay open
+  { 120,  TL_IRIS,   TL_OUT,    IRIS_MAX }, { 1200, TL_IRIS, TL_STEP, IRIS_MAX },
+  { 1201, TL_IRIS,   TL_STEP,   0        }, // Hand back at IRIS_MAX
+  { 60,   TL_CLOSE,  TL_OUT,    0        },
+};
+
+#define TL_EXPR(s) { s, sizeof s / sizeof s[0] }
+static const tlExpr_t tlExpressions[] = {
+  TL_EXPR(tlLookAndBlink), TL_EXPR(tlSquint), TL_EXPR(tlDrowsy), TL_EXPR(tlSurprise)
+};
+#define TL_EXPRESSIONS (sizeof tlExpressions / sizeof tlExpressions[0])
@@ -0,0 +1,55 @@
+// Wait-free triple buffer: one producer publishes complete snapshots of T,
+// one consumer always reads the newest published one.
+//
+// Three slots rotate between the roles "being written" (producer only),
+// "being read" (consumer only) and "latest published".  Publishing and
+// picking up are a single atomic exchange of the shared slot index, so
+// neither side ever waits for the other and a snapshot can't be torn.  A
+// snapshot the consumer never picked up is simply replaced by a newer one.
+//
+//   tripleBuffer<state_t> chan;
+//   Producer:  *tbWrite(&chan) = working; tbPublish(&chan);
+//   Consumer:  const state_t *s = tbRead(&chan);  // valid until next tbRead()
+
+#pragma once
+
+#include <stdint.h>
+
+#define TB_NEW 4 // Flag in tripleBuffer::shared: slot not yet read
+
+template <typename T>
+struct tripleBuffer {
+  T       slot[3];
+  uint8_t back;   // Producer's slot
+  uint8_t shared; // Latest published slot | TB_NEW, exchanged atomically
+  uint8_t front;  // Consumer's slot
+};
+
+template <typename T>
+static inline void tbInit(tripleBuffer<T> *tb, const T &initial) {
+  tb->slot[0] = tb->slot[1] = tb->slot[2] = initial;
+  tb->back   = 0;
+  tb->shared = 1;
+  tb->front  = 2;
+}
+
+// Slot to fill before tbPublish()
+template <typename T>
+static inline T *tbWrite(tripleBuffer<T> *tb) {
+  return &tb->slot[tb->back];
+}
+
+template <typename T>
+static inline void tbPublish(tripleBuffer<T> *tb) {
+  tb->back = __atomic_exchange_n(&tb->shared, (uint8_t)(tb->back | TB_NEW),
+                                 __ATOMIC_ACQ_REL) & 3;
+}
+
+// Newest published snapshot (or the previous one again if nothing new)
+template <typename T>
+static inline const T *tbRead(tripleBuffer<T> *tb) {
+  if (__atomic_load_n(&tb->shared, __ATOMIC_RELAXED) & TB_NEW) {
+    tb->front = __atomic_exchange_n(&tb->shared, tb->front, __ATOMIC_ACQ_REL) & 3;
+  }
+  return &tb->slot[tb->front];
+}
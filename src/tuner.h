@@ -0,0 +1,136 @@
+// Boot-time tuner for the pixel push chunk size and SPI clock, enabled with
+// #define AUTOTUNE in config.h.
+//
+// The best chunk size depends on the eye asset (flash cache behaviour of
+// its tables), the render mode and the bus, and differs between board
+// revisions.  tuneBoot() times TUNE_FRAMES real eye frames for every
+// combination of chunk size (1 to TUNE_ROWS_MAX rows, powers of 2) and SPI
+// clock (the C3's 80 MHz / n steps between TUNE_SPI_MIN and TUNE_SPI_MAX,
+// only with PANEL_IDF, which can change it at run time), through a
+// function supplied by the sketch.  It keeps the fastest combination,
+// except that a smaller chunk or lower clock within TUNE_MARGIN percent of
+// it wins: less RAM, more timing margin on the bus.
+//
+// The winner is kept in NVS (Preferences namespace "eyes") with a
+// signature of the build settings and eye tables it was measured with, so
+// later boots skip the sweep until something relevant changes.  Serial 'T'
+// forgets it, the next boot tunes again.
+//
+// Include after config.h and pixelFormat.h.
+
+#pragma once
+
+#include <Preferences.h>
+#include <stdint.h>
+
+#define TUNE_FRAMES   24 // Eye frames timed per combination
+#define TUNE_ROWS_MAX 16 // Largest chunk, in eye rows
+#define TUNE_ROW_STEPS 5 // 1, 2, 4 .. TUNE_ROWS_MAX rows
+#define TUNE_MARGIN   2  // % slower than the best that still counts as a tie
+
+#ifndef TUNE_SPI_MIN
+  #define TUNE_SPI_MIN 20000000      // Slowest clock tried
+#endif
+#ifndef TUNE_SPI_MAX
+  #define TUNE_SPI_MAX SPI_FREQUENCY // Fastest clock tried, raise only as
+#endif                               // far as the panels are known to work
+static_assert(TUNE_SPI_MIN <= TUNE_SPI_MAX, "TUNE_SPI_MIN above TUNE_SPI_MAX leaves nothing to tune");
+
+typedef struct {
+  uint16_t rows; // Chunk size in eye rows, 0 = not tuned
+  uint32_t hz;   // SPI clock
+} tune_t;
+
+// Applies a combination and returns the time of TUNE_FRAMES eye frames in
+// micros (0xFFFFFFFF if it can't be used)
+typedef uint32_t (*tuneMeasure_t)(uint16_t rows, uint32_t hz);
+
+static const uint32_t tuneClocks[] = { 20000000, 26666667, 40000000, 80000000 };
+
+// FNV-1a over the settings and the start of the eye tables
+static uint32_t tuneSignature(void) {
+  uint32_t h = 2166136261u;
+  uint32_t v[] = { EYE_WIDTH, EYE_HEIGHT, SCLERA_WIDTH, SCLERA_HEIGHT, IRIS_WIDTH,
+                   NUM_EYES, RENDER_MODE, PIXEL_BYTES(4), TUNE_SPI_MIN, TUNE_SPI_MAX,
+#ifdef PANEL_IDF
+                   1,
+#endif
+#ifdef USE_DMA
+                   2,
+#endif
+                   TUNE_FRAMES };
+  for (uint32_t i = 0; i < sizeof v / sizeof v[0]; i++) h = (h ^ v[i]) * 16777619u;
+  for (uint32_t i = 0; i < 64; i++) {
+    h = (h ^ pgm_read_word(&sclera[i * 97])) * 16777619u;
+    h = (h ^ pgm_read_word(&iris[i * 31])) * 16777619u;
+  }
+  return h;
+}
+
+static tune_t tuneSweep(tuneMeasure_t measure, uint16_t maxRows) {
+  uint32_t time[TUNE_ROW_STEPS][sizeof tuneClocks / sizeof tuneClocks[0]];
+  uint32_t best = 0xFFFFFFFF;
+  tune_t   r    = { 0, SPI_FREQUENCY };
+
+  for (uint8_t i = 0; (1 << i) <= maxRows; i++) {
+    for (uint8_t c = 0; c < sizeof tuneClocks / sizeof tuneClocks[0]; c++) {
+      time[i][c] = 0xFFFFFFFF;
+#ifdef PANEL_IDF
+      uint32_t hz = tuneClocks[c];
+      if ((hz < TUNE_SPI_MIN) || (hz > TUNE_SPI_MAX)) continue;
+#else
+      uint32_t hz = SPI_FREQUENCY; // Fixed by the TFT_eSPI setup
+      if (c) continue;
+#endif
+      time[i][c] = measure(1 << i, hz);
+      if (time[i][c] < best) best = time[i][c];
+      Serial.printf("Tune %2u rows %8lu Hz: %lu us/frame\n", 1 << i,
+                    (unsigned long)hz, (unsigned long)time[i][c] / TUNE_FRAMES);
+    }
+  }
+  // Smallest chunk, then lowest clock, within the margin of the best
+  for (uint8_t i = 0; !r.rows && ((1 << i) <= maxRows); i++) {
+    for (uint8_t c = 0; c < sizeof tuneClocks / sizeof tuneClocks[0]; c++) {
+      if ((time[i][c] != 0xFFFFFFFF) &&
+          ((uint64_t)time[i][c] * 100 <= (uint64_t)best * (100 + TUNE_MARGIN))) {
+        r.rows = 1 << i;
+#ifdef PANEL_IDF
+        r.hz   = tuneClocks[c];
+#endif
+        break;
+      }
+    }
+  }
+  return r;
+}
+
+// Stored result, or a new sweep if there is none for this build
+static tune_t tuneBoot(tuneMeasure_t measure, uint16_t maxRows) {
+  Preferences prefs;
+  tune_t      r = { 0, SPI_FREQUENCY };
+  uint32_t    sig = tuneSignature();
+
+  prefs.begin("eyes", false);
+  if (prefs.getUInt("tuneSig", 0) == sig) {
+    r.rows = prefs.getUShort("tuneRows", 0);
+    r.hz   = prefs.getUInt("tuneHz", SPI_FREQUENCY);
+  }
+  if (!r.rows || (r.rows > maxRows)) {
+    r = tuneSweep(measure, maxRows);
+    if (r.rows) {
+      prefs.putUInt("tuneSig", sig);
+      prefs.putUShort("tuneRows", r.rows);
+      prefs.putUInt("tuneHz", r.hz);
+    }
+  }
+  prefs.end();
+  return r;
+}
+
+// Drop the stored result, the next boot tunes again
+static void tuneForget(void) {
+  Preferences prefs;
+  prefs.begin("eyes", false);
+  prefs.remove("tuneSig");
+  prefs.end();
+}
@@ -0,0 +1,842 @@
+// assetc -- host-side eye asset compiler.
+//
+// Builds the sclera / iris / eyelid / polar tables used by the eye renderer,
+// either from source images or from an existing src/data/*Eye.h header, and
+// writes them out as a header, a single binary pack, or one raw binary file
+// per table plus the .h/.S pair that embeds them with .incbin (the form the
+// sketch uses, see src/data).
+//
+// Build:  g++ -O2 -std=c++17 -o assetc assetc.cpp
+//
+// Examples:
+//   Round-trip an existing header (tables are compared after re-reading):
+//     assetc --from-header ../../src/data/defaultEye.h -o defaultEye.h --verify
+//   160x160 assets for EYE_SIZE 160, RGB565 pre-swapped to wire byte order:
+//     assetc --from-raw ../../src/data/defaultEye --screen 160 --swap
+//            --format raw -o ../../src/data/eye160
+//   Sprite sets (any header of hex arrays) to .bin + .h/.S:
+//     assetc --blobs EYEA.h -o ../../src/data/EYEA
+//   From images:
+//     assetc --sclera sclera.png --iris iris.png --upper upper.png
+//            --lower lower.png --polar 80 --iris-min 90 --iris-max 130 -o myEye.h
+//
+// Options:
+//   --from-header FILE  Read all tables (and IRIS_MIN/MAX) from a header
+//   --from-raw PATH     Read tables from PATH.h and PATH/*.bin (--format raw)
+//   --blobs FILE        Convert every array in FILE as-is (no eye options)
+//   --sclera/--iris/--upper/--lower FILE.png   Source images; sclera and iris
+//                       are RGB, eyelid maps are grayscale thresholds
+//   --upper-sym/--lower-sym FILE.png  Optional SYMMETRICAL_EYELID variants
+//   --polar N           Polar table size (IRIS_WIDTH = IRIS_HEIGHT = N); the
+//                       polar table is regenerated analytically
+//   --screen N          Eyelid map (view) size; all tables are resampled by
+//                       N / current view size
+//   --swap              Store RGB565 tables byte-swapped (wire order)
+//   --lids merged       Emit one u16 lid table (lower | upper << 8) instead
+//                       of separate upper/lower u8 tables
+//   --rle               Run-length encode tables (pack format only)
+//   --iris-min/--iris-max N  Iris scale limits written to the header
+//   --format header|pack|raw  Output type (default: header)
+//   -o PATH             Output file (header, pack), or for raw and --blobs
+//                       PATH.h, PATH.S and the directory PATH/
+//   --verify            Re-read the output and compare every table
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+[[noreturn]] static void fail(const string &msg) {
+  fprintf(stderr, "assetc: %s\n", msg.c_str());
+  exit(1);
+}
+
+static vector<uint8_t> readFile(const string &path) {
+  ifstream f(path, ios::binary);
+  if (!f) fail("can't open " + path);
+  return vector<uint8_t>((istreambuf_iterator<char>(f)), istreambuf_iterator<char>());
+}
+
+static void writeFile(const string &path, const void *data, size_t len) {
+  ofstream f(path, ios::binary);
+  if (!f) fail("can't write " + path);
+  f.write((const char *)data, len);
+}
+
+// TABLES ------------------------------------------------------------------
+
+struct Table {
+  string           name;  // sclera, iris, upper, lower, polar, lids...
+  int              bits;  // 8 or 16
+  int              w, h;
+  vector<uint16_t> v;     // Row-major values
+};
+
+struct Eye {
+  map<string, Table> t;        // Keyed by name; *_sym for symmetrical lids
+  map<string, long>  defs;     // Numeric #defines from the source header
+  int  irisMin = -1, irisMax = -1;
+  bool swapped = false;
+  bool merged  = false;
+};
+
+// MINIMAL PNG DECODER -----------------------------------------------------
+// 8-bit grayscale, gray+alpha, RGB, RGBA and 8-bit palette images, no
+// interlace.  Enough for artwork exported from any paint program.
+
+struct Bits {
+  const uint8_t *p, *end;
+  uint32_t       buf = 0, n = 0;
+  uint32_t get(int k) {
+    while (n < (uint32_t)k) {
+      if (p >= end) fail("truncated deflate stream");
+      buf |= (uint32_t)*p++ << n;
+      n   += 8;
+    }
+    uint32_t r = buf & ((1u << k) - 1);
+    buf >>= k;
+    n    -= k;
+    return r;
+  }
+};
+
+struct Huff {
+  uint16_t count[16], sym[288];
+  void build(const uint8_t *len, int n) {
+    uint16_t offs[16];
+    memset(count, 0, sizeof count);
+    for (int i = 0; i < n; i++) count[len[i]]++;
+    count[0] = 0;
+    offs[1]  = 0;
+    for (int i = 1; i < 15; i++) offs[i + 1] = offs[i] + count[i];
+    for (int i = 0; i < n; i++) if (len[i]) sym[offs[len[i]]++] = i;
+  }
+  int decode(Bits &b) const {
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len < 16; len++) {
+      code |= b.get(1);
+      int c = count[len];
+      if (code - c < first) return sym[index + (code - first)];
+      index += c;
+      first += c;
+      first <<= 1;
+      code  <<= 1;
+    }
+    fail("bad huffman code");
+  }
+};
+
+static vector<uint8_t> inflate(const vector<uint8_t> &z) {
+  static const uint16_t lbase[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17,
+    19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+  static const uint8_t  lextra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+    2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+  static const uint16_t dbase[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49,
+    65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577 };
+  static const uint8_t  dextra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+    6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+  static const uint8_t  clOrder[] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4,
+    12, 3, 13, 2, 14, 1, 15 };
+
+  if (z.size() < 2) fail("empty zlib stream");
+  Bits b { z.data() + 2, z.data() + z.size() };
+  vector<uint8_t> out;
+  uint32_t last;
+  do {
+    last = b.get(1);
+    uint32_t type = b.get(2);
+    if (type == 0) {                       // Stored block
+      b.buf = b.n = 0;
+      if (b.end - b.p < 4) fail("truncated stored block");
+      uint32_t len = b.p[0] | b.p[1] << 8;
+      b.p += 4;
+      if ((uint32_t)(b.end - b.p) < len) fail("truncated stored block");
+      out.insert(out.end(), b.p, b.p + len);
+      b.p += len;
+      continue;
+    }
+    Huff lit, dist;
+    uint8_t len[320];
+    if (type == 1) {                       // Fixed Huffman codes
+      for (int i = 0; i < 144; i++) len[i] = 8;
+      for (int i = 144; i < 256; i++) len[i] = 9;
+      for (int i = 256; i < 280; i++) len[i] = 7;
+      for (int i = 280; i < 288; i++) len[i] = 8;
+      lit.build(len, 288);
+      for (int i = 0; i < 30; i++) len[i] = 5;
+      dist.build(len, 30);
+    } else if (type == 2) {                // Dynamic Huffman codes
+      int nlen = b.get(5) + 257, ndist = b.get(5) + 1, ncode = b.get(4) + 4;
+      uint8_t cl[19] = { 0 };
+      for (int i = 0; i < ncode; i++) cl[clOrder[i]] = b.get(3);
+      Huff clh;
+      clh.build(cl, 19);
+      for (int i = 0; i < nlen + ndist;) {
+        int s = clh.decode(b), rep = 0, val = 0;
+        if (s < 16)       { len[i++] = s; continue; }
+        else if (s == 16) { if (!i) fail("bad length repeat"); val = len[i - 1]; rep = 3 + b.get(2); }
+        else if (s == 17) rep = 3 + b.get(3);
+        else              rep = 11 + b.get(7);
+        if (i + rep > nlen + ndist) fail("bad length repeat");
+        while (rep--) len[i++] = val;
+      }
+      lit.build(len, nlen);
+      dist.build(len + nlen, ndist);
+    } else {
+      fail("bad deflate block type");
+    }
+    for (;;) {
+      int s = lit.decode(b);
+      if (s < 256) { out.push_back(s); continue; }
+      if (s == 256) break;
+      s -= 257;
+      if (s >= 29) fail("bad length symbol");
+      uint32_t n = lbase[s] + b.get(lextra[s]);
+      int d = dist.decode(b);
+      if (d >= 30) fail("bad distance symbol");
+      uint32_t back = dbase[d] + b.get(dextra[d]);
+      if (back > out.size()) fail("distance too far back");
+      size_t from = out.size() - back;
+      while (n--) out.push_back(out[from++]);
+    }
+  } while (!last);
+  return out;
+}
+
+struct Image {
+  int w = 0, h = 0;
+  vector<uint8_t> rgb; // 3 bytes per pixel
+};
+
+static uint32_t be32(const uint8_t *p) {
+  return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static Image loadPNG(const string &path) {
+  vector<uint8_t> f = readFile(path);
+  static const uint8_t sig[8] = { 137, 'P', 'N', 'G', 13, 10, 26, 10 };
+  if (f.size() < 8 || memcmp(f.data(), sig, 8)) fail(path + ": not a PNG file");
+  Image img;
+  int depth = 0, ctype = 0;
+  vector<uint8_t> idat, pal;
+  for (size_t i = 8; i + 8 <= f.size();) {
+    uint32_t len = be32(&f[i]);
+    string   type((const char *)&f[i + 4], 4);
+    if (i + 12 + len > f.size()) fail(path + ": truncated chunk");
+    const uint8_t *d = &f[i + 8];
+    if (type == "IHDR") {
+      img.w = be32(d);
+      img.h = be32(d + 4);
+      depth = d[8];
+      ctype = d[9];
+      if (d[12]) fail(path + ": interlaced PNGs are not supported");
+    } else if (type == "PLTE") {
+      pal.assign(d, d + len);
+    } else if (type == "IDAT") {
+      idat.insert(idat.end(), d, d + len);
+    } else if (type == "IEND") {
+      break;
+    }
+    i += 12 + len;
+  }
+  if (depth != 8) fail(path + ": only 8-bit PNGs are supported");
+  int bpp;
+  switch (ctype) {
+    case 0: bpp = 1; break; // Gray
+    case 2: bpp = 3; break; // RGB
+    case 3: bpp = 1; break; // Palette
+    case 4: bpp = 2; break; // Gray + alpha
+    case 6: bpp = 4; break; // RGBA
+    default: fail(path + ": unsupported PNG color type");
+  }
+  vector<uint8_t> raw = inflate(idat);
+  size_t stride = (size_t)img.w * bpp;
+  if (raw.size() < (stride + 1) * img.h) fail(path + ": short image data");
+  vector<uint8_t> prev(stride, 0), cur(stride);
+  img.rgb.resize((size_t)img.w * img.h * 3);
+  for (int y = 0; y < img.h; y++) {
+    const uint8_t *r = &raw[y * (stride + 1)];
+    int filter = *r++;
+    for (size_t x = 0; x < stride; x++) {
+      int a = (x >= (size_t)bpp) ? cur[x - bpp] : 0, b = prev[x];
+      int c = (x >= (size_t)bpp) ? prev[x - bpp] : 0, v = r[x];
+      switch (filter) {
+        case 1: v += a; break;
+        case 2: v += b; break;
+        case 3: v += (a + b) / 2; break;
+        case 4: {
+          int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+          v += (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+          break;
+        }
+      }
+      cur[x] = v;
+    }
+    for (int x = 0; x < img.w; x++) {
+      uint8_t *o = &img.rgb[(y * img.w + x) * 3];
+      const uint8_t *s = &cur[x * bpp];
+      if (ctype == 3) {
+        if ((size_t)s[0] * 3 + 2 >= pal.size()) fail(path + ": bad palette index");
+        memcpy(o, &pal[s[0] * 3], 3);
+      } else if (ctype == 0 || ctype == 4) {
+        o[0] = o[1] = o[2] = s[0];
+      } else {
+        memcpy(o, s, 3);
+      }
+    }
+    swap(prev, cur);
+  }
+  return img;
+}
+
+static Table rgbTable(const string &name, const Image &img) {
+  Table t { name, 16, img.w, img.h, {} };
+  for (size_t i = 0; i < (size_t)img.w * img.h; i++) {
+    const uint8_t *p = &img.rgb[i * 3];
+    t.v.push_back((p[0] & 0xF8) << 8 | (p[1] & 0xFC) << 3 | p[2] >> 3);
+  }
+  return t;
+}
+
+static Table grayTable(const string &name, const Image &img) {
+  Table t { name, 8, img.w, img.h, {} };
+  for (size_t i = 0; i < (size_t)img.w * img.h; i++) {
+    const uint8_t *p = &img.rgb[i * 3];
+    t.v.push_back((p[0] * 299 + p[1] * 587 + p[2] * 114 + 500) / 1000);
+  }
+  return t;
+}
+
+// Polar table: low 7 bits are 127 - distance (0-127 across the radius, 127
+// outside), upper 9 bits the angle (0-511).  Same as the original tablegen.
+static Table polarTable(int size) {
+  Table t { "polar", 16, size, size, {} };
+  double radius = size / 2.0;
+  for (int y = 0; y < size; y++) {
+    double dy = y - radius + 0.5;
+    for (int x = 0; x < size; x++) {
+      double dx = x - radius + 0.5, dist = sqrt(dx * dx + dy * dy);
+      if (dist >= radius) {
+        t.v.push_back(0x7F);
+        continue;
+      }
+      double angle = (atan2(dy, dx) + M_PI) / (M_PI * 2.0);
+      dist = dist / radius * 128.0;
+      if (dist > 127) dist = 127;
+      t.v.push_back((int)(angle * 512.0) * 128 + (127 - (int)dist));
+    }
+  }
+  return t;
+}
+
+// Bilinear resample; RGB565 tables are filtered per channel
+static Table resample(const Table &s, int w, int h) {
+  Table t { s.name, s.bits, w, h, vector<uint16_t>((size_t)w * h) };
+  for (int y = 0; y < h; y++) {
+    double fy = (y + 0.5) * s.h / h - 0.5;
+    int    y0 = max(0, (int)floor(fy)), y1 = min(s.h - 1, y0 + 1);
+    double ay = min(1.0, max(0.0, fy - y0));
+    for (int x = 0; x < w; x++) {
+      double fx = (x + 0.5) * s.w / w - 0.5;
+      int    x0 = max(0, (int)floor(fx)), x1 = min(s.w - 1, x0 + 1);
+      double ax = min(1.0, max(0.0, fx - x0));
+      uint16_t q[4] = { s.v[y0 * s.w + x0], s.v[y0 * s.w + x1],
+                        s.v[y1 * s.w + x0], s.v[y1 * s.w + x1] };
+      auto mix = [&](int shift, int mask) {
+        double a = (q[0] >> shift & mask) * (1 - ax) + (q[1] >> shift & mask) * ax;
+        double b = (q[2] >> shift & mask) * (1 - ax) + (q[3] >> shift & mask) * ax;
+        return (int)lround(a * (1 - ay) + b * ay);
+      };
+      t.v[y * w + x] = (s.bits == 8) ? mix(0, 0xFF)
+                     : mix(11, 0x1F) << 11 | mix(5, 0x3F) << 5 | mix(0, 0x1F);
+    }
+  }
+  return t;
+}
+
+// HEADER READER -----------------------------------------------------------
+// Understands the layout of the src/data/*Eye.h headers and of our own
+// output: #defines, hex array literals, and one #ifdef SYMMETRICAL_EYELID
+// block holding the symmetrical eyelid variants.
+
+// Reads every #define and every hex array in the file; arrays inside the
+// #ifdef SYMMETRICAL_EYELID branch get a _sym suffix.  Array sizes are left
+// for the caller to fill in.
+static Eye readArrays(const string &path) {
+  vector<uint8_t> raw = readFile(path);
+  istringstream   in(string(raw.begin(), raw.end()));
+  Eye    eye;
+  Table *cur = nullptr;
+  bool   symBlock = false;
+  string line;
+  while (getline(in, line)) {
+    size_t s = line.find_first_not_of(" \t");
+    if (s == string::npos) continue;
+    line = line.substr(s);
+    if (line.compare(0, 2, "//") == 0) continue;
+    if (cur) {
+      const char *p = line.c_str();
+      while (*p) {
+        if (*p == '}') { cur = nullptr; break; }
+        if (p[0] == '/' && p[1] == '/') break;
+        if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+          char *e;
+          cur->v.push_back((uint16_t)strtoul(p, &e, 16));
+          p = e;
+        } else {
+          p++;
+        }
+      }
+      continue;
+    }
+    if (line.compare(0, 8, "#define ") == 0) {
+      istringstream d(line.substr(8));
+      string name;
+      long   value;
+      if (d >> name >> value) eye.defs[name] = value;
+    } else if (line.compare(0, 6, "#ifdef") == 0 && line.find("SYMMETRICAL_EYELID") != string::npos) {
+      symBlock = true;
+    } else if (line.compare(0, 5, "#else") == 0 || line.compare(0, 6, "#endif") == 0) {
+      symBlock = false;
+    } else if (line.compare(0, 6, "const ") == 0 && line.find('[') != string::npos) {
+      istringstream d(line.substr(6));
+      string type, decl;
+      d >> type >> decl;
+      string name = decl.substr(0, decl.find('['));
+      string key  = (symBlock && (name == "upper" || name == "lower" || name == "lids")) ? name + "_sym" : name;
+      Table &t = eye.t[key];
+      t.name = name;
+      t.bits = (type == "uint8_t") ? 8 : 16;
+      cur    = &t;
+      if (line.find('}') != string::npos) fail(path + ": single-line arrays not supported");
+    }
+  }
+  if (cur) fail(path + ": unterminated array " + cur->name);
+  return eye;
+}
+
+// Table dimensions from the header's #defines
+static void eyeDims(Eye &eye, const string &path) {
+  auto dim = [&](const char *name) {
+    if (!eye.defs.count(name)) fail(path + ": missing #define " + name);
+    return (int)eye.defs[name];
+  };
+  for (auto &kv : eye.t) {
+    Table &t = kv.second;
+    if (t.name == "sclera")     { t.w = dim("SCLERA_WIDTH");   t.h = dim("SCLERA_HEIGHT"); }
+    else if (t.name == "iris")  { t.w = dim("IRIS_MAP_WIDTH"); t.h = dim("IRIS_MAP_HEIGHT"); }
+    else if (t.name == "polar") { t.w = dim("IRIS_WIDTH");     t.h = dim("IRIS_HEIGHT"); }
+    else                        { t.w = dim("SCREEN_WIDTH");   t.h = dim("SCREEN_HEIGHT"); }
+    if (t.v.size() != (size_t)t.w * t.h)
+      fail(path + ": " + kv.first + " has " + to_string(t.v.size()) + " values, expected " +
+           to_string(t.w * t.h));
+  }
+  if (eye.defs.count("IRIS_MIN")) eye.irisMin = eye.defs["IRIS_MIN"];
+  if (eye.defs.count("IRIS_MAX")) eye.irisMax = eye.defs["IRIS_MAX"];
+  eye.swapped = eye.defs.count("EYE_ASSET_SWAPPED") && eye.defs["EYE_ASSET_SWAPPED"];
+  eye.merged  = eye.t.count("lids") > 0;
+}
+
+static Eye readHeader(const string &path) {
+  Eye eye = readArrays(path);
+  eyeDims(eye, path);
+  return eye;
+}
+
+// Reads the output of --format raw: the #defines from DIR.h and the tables
+// from DIR/*.bin
+static Eye readRaw(const string &dir) {
+  Eye eye = readArrays(dir + ".h");
+  for (const char *n : { "sclera", "iris", "upper", "lower", "lids",
+                         "upper_sym", "lower_sym", "lids_sym", "polar" }) {
+    string path = dir + "/" + n + ".bin";
+    if (!filesystem::exists(path)) continue;
+    vector<uint8_t> data = readFile(path);
+    Table &t = eye.t[n];
+    t.name = string(n).substr(0, string(n).find('_'));
+    t.bits = (t.name == "upper" || t.name == "lower") ? 8 : 16;
+    for (size_t i = 0; i + t.bits / 8 <= data.size(); i += t.bits / 8)
+      t.v.push_back((t.bits == 8) ? data[i] : data[i] | data[i + 1] << 8);
+  }
+  eyeDims(eye, dir + ".h");
+  return eye;
+}
+
+// HEADER WRITER -----------------------------------------------------------
+
+static void writeArray(ostream &o, const Table &t, const string &dims) {
+  const bool w16 = (t.bits == 16);
+  const int  perLine = w16 ? 8 : 12;
+  o << "const " << (w16 ? "uint16_t " : "uint8_t ") << t.name << "[" << dims << "] PROGMEM= {";
+  char buf[16];
+  for (size_t i = 0; i < t.v.size(); i++) {
+    if (!(i % perLine)) o << "\n  ";
+    snprintf(buf, sizeof buf, w16 ? "0X%04X" : "0X%02X", t.v[i]);
+    o << buf << ((i + 1 < t.v.size()) ? ((i + 1) % perLine ? ", " : ",") : " };\n");
+  }
+}
+
+static void writeLids(ostream &o, const Eye &eye, const string &suffix) {
+  if (eye.merged) {
+    writeArray(o, eye.t.at("lids" + suffix), "SCREEN_HEIGHT * SCREEN_WIDTH");
+  } else {
+    writeArray(o, eye.t.at("upper" + suffix), "SCREEN_HEIGHT * SCREEN_WIDTH");
+    o << "\n";
+    writeArray(o, eye.t.at("lower" + suffix), "SCREEN_HEIGHT * SCREEN_WIDTH");
+  }
+}
+
+static string headerText(const Eye &eye) {
+  ostringstream o;
+  const Table &sc = eye.t.at("sclera"), &ir = eye.t.at("iris"), &po = eye.t.at("polar");
+  const Table &lid = eye.t.at(eye.merged ? "lids" : "upper");
+  o << "// Generated by tools/assetc -- edit the source images, not this file\n\n";
+  if (eye.irisMin >= 0) o << "#define IRIS_MIN " << eye.irisMin << "\n";
+  if (eye.irisMax >= 0) o << "#define IRIS_MAX " << eye.irisMax << "\n";
+  if (eye.swapped) o << "#define EYE_ASSET_SWAPPED 1 // RGB565 tables are in wire byte order\n";
+  if (eye.merged)  o << "#define EYE_ASSET_LIDS    1 // lids[] = lower | upper << 8\n";
+  o << "\n#define SCLERA_WIDTH  " << sc.w << "\n#define SCLERA_HEIGHT " << sc.h << "\n\n";
+  writeArray(o, sc, "SCLERA_HEIGHT * SCLERA_WIDTH");
+  o << "\n#define IRIS_MAP_WIDTH  " << ir.w << "\n#define IRIS_MAP_HEIGHT " << ir.h << "\n\n";
+  writeArray(o, ir, "IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH");
+  o << "\n#define SCREEN_WIDTH  " << lid.w << "\n#define SCREEN_HEIGHT " << lid.h << "\n\n";
+  if (eye.t.count(eye.merged ? "lids_sym" : "upper_sym")) {
+    o << "#ifdef SYMMETRICAL_EYELID\n\n";
+    writeLids(o, eye, "_sym");
+    o << "\n#else\n\n";
+    writeLids(o, eye, "");
+    o << "\n#endif // SYMMETRICAL_EYELID\n";
+  } else {
+    writeLids(o, eye, "");
+  }
+  o << "\n#define IRIS_WIDTH  " << po.w << "\n#define IRIS_HEIGHT " << po.h << "\n\n";
+  writeArray(o, po, to_string(po.w) + " * " + to_string(po.h));
+  return o.str();
+}
+
+// BINARY WRITERS ----------------------------------------------------------
+// Pack: "EYEP" magic, u16 version, u16 table count, then one 32-byte
+// directory entry per table (name[12], u8 bits, u8 flags, u16 w, u16 h,
+// u16 reserved, u32 offset, u32 size, u32 count), then the 4-byte aligned
+// table data.  All little-endian.  Flags: 1 = RLE, 2 = byte-swapped RGB565.
+// RLE data is a sequence of (u16 run length, value) pairs.
+
+static vector<uint8_t> encode(const Table &t, bool rle) {
+  vector<uint8_t> out;
+  auto put = [&](uint16_t v, int bits) {
+    out.push_back(v & 0xFF);
+    if (bits == 16) out.push_back(v >> 8);
+  };
+  if (!rle) {
+    for (uint16_t v : t.v) put(v, t.bits);
+    return out;
+  }
+  for (size_t i = 0; i < t.v.size();) {
+    size_t j = i;
+    while (j < t.v.size() && t.v[j] == t.v[i] && j - i < 0xFFFF) j++;
+    put(j - i, 16);
+    put(t.v[i], t.bits);
+    i = j;
+  }
+  return out;
+}
+
+static vector<string> tableOrder(const Eye &eye) {
+  vector<string> names;
+  for (const char *n : { "sclera", "iris", "upper", "lower", "lids",
+                         "upper_sym", "lower_sym", "lids_sym", "polar" })
+    if (eye.t.count(n)) names.push_back(n);
+  return names;
+}
+
+static void writePack(const string &path, const Eye &eye, bool rle) {
+  vector<string>  names = tableOrder(eye);
+  vector<uint8_t> out(8 + 32 * names.size(), 0);
+  memcpy(&out[0], "EYEP", 4);
+  out[4] = 1;
+  out[6] = names.size();
+  for (size_t i = 0; i < names.size(); i++) {
+    const Table &t = eye.t.at(names[i]);
+    while (out.size() & 3) out.push_back(0);
+    vector<uint8_t> data = encode(t, false), packed;
+    bool useRle = rle && (packed = encode(t, true)).size() < data.size();
+    if (useRle) data.swap(packed);        // RLE only where it pays off
+    uint8_t *d = &out[8 + 32 * i];
+    strncpy((char *)d, names[i].c_str(), 12);
+    d[12] = t.bits;
+    d[13] = (useRle ? 1 : 0) | ((eye.swapped && t.bits == 16 && t.name != "polar") ? 2 : 0);
+    uint32_t f[] = { (uint32_t)(t.w | t.h << 16), 0, (uint32_t)out.size(),
+                     (uint32_t)data.size(), (uint32_t)t.v.size() };
+    memcpy(d + 14, &f[0], 4);   // w, h
+    memcpy(d + 18, &f[1], 2);   // reserved
+    memcpy(d + 20, &f[2], 12);  // offset, size, count
+    out.insert(out.end(), data.begin(), data.end());
+  }
+  writeFile(path, out.data(), out.size());
+}
+
+// Raw: one little-endian .bin per table in directory OUT, plus OUT.h with
+// the #defines and extern declarations and OUT.S, which pulls each table in
+// with .incbin under a unique symbol (e.g. defaultEye_sclera).  The header
+// binds the usual names (sclera, iris, ...) to those symbols with asm labels,
+// so every eye's .S can be assembled and only the one included is linked.
+// .incbin paths are relative to the src directory, see platformio.ini.
+
+static string incbinRoot(const filesystem::path &out) {
+  for (filesystem::path p = filesystem::absolute(out).parent_path(); !p.empty(); p = p.parent_path()) {
+    if (p.filename() == "src") return p.string();
+    if (p == p.parent_path()) break;
+  }
+  return filesystem::absolute(out).parent_path().string();
+}
+
+static void writeAsm(const string &out, const string &prefix, const vector<string> &names,
+                     const string &what) {
+  ostringstream a;
+  string dir = filesystem::relative(filesystem::absolute(out), incbinRoot(out)).generic_string();
+  a << "// Generated by tools/assetc -- " << what << "\n\n";
+  for (const string &n : names) {
+    string sym = prefix + "_" + n;
+    a << "  .section .rodata." << sym << ", \"a\"\n"
+      << "  .balign 4\n"
+      << "  .global " << sym << "\n"
+      << "  .type   " << sym << ", @object\n"
+      << sym << ":\n"
+      << "  .incbin \"" << dir << "/" << n << ".bin\"\n"
+      << "  .size   " << sym << ", . - " << sym << "\n\n";
+  }
+  a << "  .section .note.GNU-stack, \"\", @progbits // No executable stack (host builds)\n";
+  string s = a.str();
+  writeFile(out + ".S", s.data(), s.size());
+}
+
+static void writeRaw(const string &out, const Eye &eye) {
+  const string prefix = filesystem::path(out).filename().string();
+  const Table &sc = eye.t.at("sclera"), &ir = eye.t.at("iris"), &po = eye.t.at("polar");
+  const Table &lid = eye.t.at(eye.merged ? "lids" : "upper");
+  filesystem::create_directories(out);
+
+  ostringstream h;
+  auto decl = [&](const string &key, const string &dims) {
+    const Table &t = eye.t.at(key);
+    h << "extern const " << (t.bits == 16 ? "uint16_t " : "uint8_t ") << t.name
+      << "[" << dims << "] asm(\"" << prefix << "_" << key << "\");\n";
+  };
+  auto lids = [&](const string &suffix) {
+    for (const char *n : { "upper", "lower", "lids" })
+      if (eye.t.count(n + suffix)) decl(n + suffix, "SCREEN_HEIGHT * SCREEN_WIDTH");
+  };
+  h << "// Generated by tools/assetc -- the tables are linked in from " << prefix
+    << "/*.bin by " << prefix << ".S\n";
+  if (eye.irisMin >= 0 || eye.irisMax >= 0 || eye.swapped || eye.merged) h << "\n";
+  if (eye.irisMin >= 0) h << "#define IRIS_MIN " << eye.irisMin << "\n";
+  if (eye.irisMax >= 0) h << "#define IRIS_MAX " << eye.irisMax << "\n";
+  if (eye.swapped) h << "#define EYE_ASSET_SWAPPED 1 // RGB565 tables are in wire byte order\n";
+  if (eye.merged)  h << "#define EYE_ASSET_LIDS    1 // lids[] = lower | upper << 8\n";
+  h << "\n#define SCLERA_WIDTH  " << sc.w << "\n#define SCLERA_HEIGHT " << sc.h << "\n\n";
+  decl("sclera", "SCLERA_HEIGHT * SCLERA_WIDTH");
+  h << "\n#define IRIS_MAP_WIDTH  " << ir.w << "\n#define IRIS_MAP_HEIGHT " << ir.h << "\n\n";
+  decl("iris", "IRIS_MAP_HEIGHT * IRIS_MAP_WIDTH");
+  h << "\n#define SCREEN_WIDTH  " << lid.w << "\n#define SCREEN_HEIGHT " << lid.h << "\n\n";
+  if (eye.t.count(eye.merged ? "lids_sym" : "upper_sym")) {
+    h << "#ifdef SYMMETRICAL_EYELID\n";
+    lids("_sym");
+    h << "#else\n";
+    lids("");
+    h << "#endif // SYMMETRICAL_EYELID\n";
+  } else {
+    lids("");
+  }
+  h << "\n#define IRIS_WIDTH  " << po.w << "\n#define IRIS_HEIGHT " << po.h << "\n\n";
+  decl("polar", "IRIS_WIDTH * IRIS_HEIGHT");
+  string s = h.str();
+  writeFile(out + ".h", s.data(), s.size());
+
+  vector<string> names = tableOrder(eye);
+  for (const string &n : names) {
+    vector<uint8_t> data = encode(eye.t.at(n), false);
+    writeFile(out + "/" + n + ".bin", data.data(), data.size());
+  }
+  writeAsm(out, prefix, names, "eye tables declared in " + prefix + ".h");
+}
+
+// Blobs: every array of any header (e.g. the gImage_* sprite sets) as raw
+// .bin files, with the same OUT.h / OUT.S arrangement as --format raw.
+static void writeBlobs(const string &out, const string &header) {
+  const string prefix = filesystem::path(out).filename().string();
+  Eye src = readArrays(header);
+  vector<string> names;
+  ostringstream  h;
+  filesystem::create_directories(out);
+  h << "// Generated by tools/assetc -- the arrays are linked in from " << prefix
+    << "/*.bin by " << prefix << ".S\n\n#pragma once\n\n";
+  // Keep the source order (A1, A2, ... A10) rather than map order
+  vector<uint8_t> text = readFile(header);
+  string body(text.begin(), text.end());
+  vector<pair<size_t, string>> order;
+  for (auto &kv : src.t) order.push_back({ body.find(" " + kv.first + " "), kv.first });
+  sort(order.begin(), order.end());
+  for (auto &o : order) {
+    const Table &t = src.t[o.second];
+    vector<uint8_t> data = encode(t, false);
+    writeFile(out + "/" + o.second + ".bin", data.data(), data.size());
+    h << "extern const " << (t.bits == 16 ? "uint16_t " : "uint8_t ") << o.second << "["
+      << t.v.size() << "] asm(\"" << prefix << "_" << o.second << "\");\n";
+    names.push_back(o.second);
+  }
+  string s = h.str();
+  writeFile(out + ".h", s.data(), s.size());
+  writeAsm(out, prefix, names, "arrays declared in " + prefix + ".h");
+}
+
+// Byte order and eyelid layout conversions, applied in place
+static void swapBytes(Eye &eye) {
+  for (auto &kv : eye.t)
+    if (kv.second.bits == 16 && kv.second.name != "polar" && kv.second.name != "lids")
+      for (uint16_t &v : kv.second.v) v = v >> 8 | v << 8;
+  eye.swapped = !eye.swapped;
+}
+
+static void splitLids(Eye &eye) {
+  for (const string suffix : { "", "_sym" }) {
+    if (!eye.t.count("lids" + suffix)) continue;
+    Table l = eye.t["lids" + suffix], up = l, lo = l;
+    up.name = "upper";
+    lo.name = "lower";
+    up.bits = lo.bits = 8;
+    for (size_t i = 0; i < l.v.size(); i++) {
+      lo.v[i] = l.v[i] & 0xFF;
+      up.v[i] = l.v[i] >> 8;
+    }
+    eye.t.erase("lids" + suffix);
+    eye.t["upper" + suffix] = up;
+    eye.t["lower" + suffix] = lo;
+  }
+  eye.merged = false;
+}
+
+static void mergeLids(Eye &eye) {
+  for (const string suffix : { "", "_sym" }) {
+    if (!eye.t.count("upper" + suffix)) continue;
+    const Table &up = eye.t["upper" + suffix], &lo = eye.t["lower" + suffix];
+    Table l { "lids", 16, up.w, up.h, vector<uint16_t>(up.v.size()) };
+    for (size_t i = 0; i < l.v.size(); i++) l.v[i] = lo.v[i] | up.v[i] << 8;
+    eye.t.erase("upper" + suffix);
+    eye.t.erase("lower" + suffix);
+    eye.t["lids" + suffix] = l;
+  }
+  eye.merged = true;
+}
+
+// MAIN --------------------------------------------------------------------
+
+int main(int argc, char **argv) {
+  map<string, string> opt;
+  bool verify = false, swapOut = false, rle = false;
+  for (int i = 1; i < argc; i++) {
+    string a = argv[i];
+    if (a == "--verify") verify = true;
+    else if (a == "--swap") swapOut = true;
+    else if (a == "--rle") rle = true;
+    else if ((a.compare(0, 2, "--") == 0 || a == "-o") && i + 1 < argc) opt[a] = argv[++i];
+    else fail("unknown or incomplete option " + a + " (see comments in assetc.cpp)");
+  }
+  string format = opt.count("--format") ? opt["--format"] : "header";
+  if (!opt.count("-o")) fail("no output given (-o)");
+  if (rle && format != "pack") fail("--rle needs --format pack");
+  if (opt.count("--blobs")) {
+    writeBlobs(opt["-o"], opt["--blobs"]);
+    return 0;
+  }
+
+  Eye eye;
+  if (opt.count("--from-header") || opt.count("--from-raw")) {
+    eye = opt.count("--from-raw") ? readRaw(opt["--from-raw"]) : readHeader(opt["--from-header"]);
+    if (eye.swapped) swapBytes(eye); // Work in native order, separate lids
+    if (eye.merged) splitLids(eye);
+  } else {
+    for (const char *n : { "--sclera", "--iris", "--upper", "--lower" })
+      if (!opt.count(n)) fail(string("missing ") + n + " (or use --from-header)");
+    eye.t["sclera"] = rgbTable("sclera", loadPNG(opt["--sclera"]));
+    eye.t["iris"]   = rgbTable("iris",   loadPNG(opt["--iris"]));
+    eye.t["upper"]  = grayTable("upper", loadPNG(opt["--upper"]));
+    eye.t["lower"]  = grayTable("lower", loadPNG(opt["--lower"]));
+    if (opt.count("--upper-sym") != opt.count("--lower-sym"))
+      fail("--upper-sym and --lower-sym go together");
+    if (opt.count("--upper-sym")) {
+      eye.t["upper_sym"] = grayTable("upper", loadPNG(opt["--upper-sym"]));
+      eye.t["lower_sym"] = grayTable("lower", loadPNG(opt["--lower-sym"]));
+    }
+    if (!opt.count("--polar")) fail("--polar N is needed when building from images");
+    for (const char *n : { "lower", "upper_sym", "lower_sym" })
+      if (eye.t.count(n) && (eye.t[n].w != eye.t["upper"].w || eye.t[n].h != eye.t["upper"].h))
+        fail("eyelid maps must all be the same size");
+  }
+  if (opt.count("--iris-min")) eye.irisMin = atoi(opt["--iris-min"].c_str());
+  if (opt.count("--iris-max")) eye.irisMax = atoi(opt["--iris-max"].c_str());
+
+  // Resolution: scale the whole eye so the eyelid (view) maps are N x N
+  if (opt.count("--screen")) {
+    int    n = atoi(opt["--screen"].c_str());
+    double k = (double)n / eye.t["upper"].w;
+    if (n < 16 || n > 1024) fail("bad --screen size");
+    for (auto &kv : eye.t) {
+      Table &t = kv.second;
+      if (t.name == "upper" || t.name == "lower") t = resample(t, n, n);
+      else if (t.name == "sclera") t = resample(t, lround(t.w * k), lround(t.h * k));
+    }
+    if (!opt.count("--polar")) opt["--polar"] = to_string(lround(eye.t["polar"].w * k));
+  }
+  if (opt.count("--polar")) eye.t["polar"] = polarTable(atoi(opt["--polar"].c_str()));
+
+  // Reference copy in native order for --verify
+  Eye ref = eye;
+
+  // Output options: byte order and lid layout
+  if (swapOut) swapBytes(eye);
+  if (opt.count("--lids")) {
+    if (opt["--lids"] != "merged") fail("--lids takes 'merged'");
+    mergeLids(eye);
+  }
+
+  const string &out = opt["-o"];
+  if (format == "header") {
+    string s = headerText(eye);
+    writeFile(out, s.data(), s.size());
+  } else if (format == "pack") {
+    writePack(out, eye, rle);
+  } else if (format == "raw") {
+    writeRaw(out, eye);
+  } else {
+    fail("unknown --format " + format);
+  }
+
+  if (verify) {
+    if (format == "pack") fail("--verify re-reads header and raw output only");
+    Eye back = (format == "raw") ? readRaw(out) : readHeader(out);
+    if (back.swapped) swapBytes(back);
+    if (back.merged) splitLids(back);
+    for (auto &kv : ref.t) {
+      const Table &a = kv.second;
+      if (!back.t.count(kv.first)) fail("verify: " + kv.first + " missing from output");
+      const Table &b = back.t[kv.first];
+      if (a.w != b.w || a.h != b.h || a.bits != b.bits || a.v != b.v)
+        fail("verify: " + kv.first + " differs after round trip");
+    }
+    if (back.t.size() != ref.t.size() || back.irisMin != ref.irisMin || back.irisMax != ref.irisMax)
+      fail("verify: table set or iris limits differ after round trip");
+    printf("verify: %zu tables round-trip losslessly\n", ref.t.size());
+  }
+  return 0;
+}
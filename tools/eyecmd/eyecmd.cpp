@@ -0,0 +1,125 @@
+// eyecmd -- sends control packets (src/command.h) to the sketch.
+//
+// Works with the board's USB CDC port or any tty, e.g. one end of a pty
+// pair made with socat, or tools/eyepty, for testing without hardware.
+//
+// Build:  g++ -O2 -std=c++17 -o eyecmd eyecmd.cpp
+//
+// Usage:
+//   eyecmd PORT gaze X Y          X, Y 0-1023, or -1 -1 for autonomous
+//   eyecmd PORT iris N            IRIS_MIN-IRIS_MAX, or 0 for autonomous
+//   eyecmd PORT blink MASK [MS]   MASK 1 = eye 0, 2 = eye 1, 3 = both
+//   eyecmd PORT select N          0 eyes, 1 Demo_2, 2 Demo_3
+//   eyecmd PORT expr N            Scripted expression, see CMD_EXPR
+//   eyecmd PORT mode N            0 full, 1 half width, 2 half resolution
+//   eyecmd PORT -                 Read commands (as above, without PORT)
+//                                 from stdin, one per line, e.g. from a
+//                                 face tracker
+// One-shot commands use sequence number 0, which the sketch always accepts;
+// stdin mode numbers packets from 1.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+#include <string>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../src/command.h"
+
+using namespace std;
+
+static uint32_t hostMicros(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+static void put16(vector<uint8_t> &p, long v) {
+  p.push_back(v & 0xFF);
+  p.push_back((v >> 8) & 0xFF);
+}
+
+// Encode one command line; returns 0 bytes on a syntax error
+static vector<uint8_t> encodeLine(const vector<string> &a, uint16_t seq) {
+  vector<uint8_t> payload;
+  uint8_t         cmd;
+  auto arg = [&](size_t i, long def) { return (i < a.size()) ? strtol(a[i].c_str(), nullptr, 0) : def; };
+  if (a.empty()) return {};
+  if (a[0] == "gaze" && a.size() == 3) {
+    cmd = CMD_GAZE;
+    put16(payload, arg(1, -1));
+    put16(payload, arg(2, -1));
+  } else if (a[0] == "iris" && a.size() == 2) {
+    cmd = CMD_IRIS;
+    put16(payload, arg(1, 0));
+  } else if (a[0] == "blink" && (a.size() == 2 || a.size() == 3)) {
+    cmd = CMD_BLINK;
+    payload.push_back(arg(1, 3));
+    put16(payload, arg(2, 0));
+  } else if (a[0] == "select" && a.size() == 2) {
+    cmd = CMD_SELECT;
+    payload.push_back(arg(1, 0));
+  } else if (a[0] == "expr" && a.size() == 2) {
+    cmd = CMD_EXPR;
+    payload.push_back(arg(1, 0));
+  } else if (a[0] == "mode" && a.size() == 2) {
+    cmd = CMD_MODE;
+    payload.push_back(arg(1, 0));
+  } else {
+    return {};
+  }
+  vector<uint8_t> out(CMD_HEADER + CMD_PAYLOAD + 2);
+  out.resize(cmdEncode(out.data(), cmd, seq, hostMicros(), payload.data(), payload.size()));
+  return out;
+}
+
+static bool send(int fd, const vector<uint8_t> &p) {
+  return write(fd, p.data(), p.size()) == (ssize_t)p.size();
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: eyecmd PORT gaze X Y | iris N | blink MASK [MS] | select N | expr N | mode N | -\n");
+    return 1;
+  }
+  int fd = open(argv[1], O_WRONLY | O_NOCTTY);
+  if (fd < 0) {
+    perror(argv[1]);
+    return 1;
+  }
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) { // Raw bytes if it's a tty
+    cfmakeraw(&tio);
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+
+  if (strcmp(argv[2], "-")) {
+    vector<uint8_t> p = encodeLine(vector<string>(argv + 2, argv + argc), 0);
+    if (p.empty()) {
+      fprintf(stderr, "eyecmd: bad command\n");
+      return 1;
+    }
+    return send(fd, p) ? 0 : 1;
+  }
+
+  char     line[256];
+  uint16_t seq = 0;
+  while (fgets(line, sizeof line, stdin)) {
+    istringstream  in(line);
+    vector<string> a;
+    string         w;
+    while (in >> w) a.push_back(w);
+    if (a.empty()) continue;
+    if (!++seq) seq = 1; // 0 is reserved for one-shot commands
+    vector<uint8_t> p = encodeLine(a, seq);
+    if (p.empty()) fprintf(stderr, "eyecmd: bad command: %s", line);
+    else if (!send(fd, p)) return 1;
+  }
+  return 0;
+}
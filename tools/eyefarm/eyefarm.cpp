@@ -0,0 +1,531 @@
+// eyefarm -- renders many virtual eye units on the host, in parallel, with
+// the sketch's own eye kernel (src/eyeRender.h) and eye tables.
+//
+// Each unit is one board running the autonomous animation of src/main.cpp:
+// frame() calls alternating between its eyes, timeline saccades and
+// expressions (src/timeline.h), the planned iris path (src/irisPlan.h),
+// auto-blink and eyelid tracking.  The animation is cheap and inherently
+// sequential, so it is stepped first, one unit after another, into the
+// per-frame inputs of drawEye().  Rendering those frames is the expensive
+// part, and every (unit, frame) job is independent: the jobs are dealt out
+// in blocks to one deque per worker thread, a worker takes jobs from the
+// back of its own deque and, once that is empty, steals from the front of
+// the others'.
+//
+// Frames are rendered with renderEyeRow<1>() exactly as drawEye() does at
+// RENDER_FULL, from the same tables (the .S file of the eye is assembled
+// into the program), so they are the device's pixels in table byte order;
+// the device only byte-swaps them for the wire.  The random numbers come
+// from a per-unit generator seeded with -s, not from the chip, so the
+// animation is repeatable but not the one a board would show.  On x86
+// built with -mavx2, --simd renders the same rows 8 pixels at a time with
+// AVX2 gathers, and --verify renders every frame both ways and compares.
+//
+// With -o, every frame is written as DIR/uUUU_eE_FFFFF.ppm, which ffmpeg
+// reads as an image sequence per eye (-i DIR/u000_e0_%05d.ppm).  The
+// checksum printed at the end covers every pixel of every frame in order,
+// so it is the same for any number of threads.  --bench renders the jobs
+// with 1, 2, 4 ... threads up to -j and prints the frame rate and speedup
+// of each.
+//
+// Build:  g++ -O2 -std=c++17 -pthread -o eyefarm eyefarm.cpp ../../src/data/defaultEye.S -Wa,-I../../src
+// Add -mavx2 for --simd.  For another eye, add
+// -DEYE_DATA='"../../src/data/catEye.h"' and assemble its .S file instead;
+// -DEYE_SIZE=160 renders at 160x160 like config.h's EYE_SIZE.
+//
+// Usage:  eyefarm [-u UNITS] [-e EYES] [-n FRAMES] [-r FPS] [-j THREADS]
+//                 [-s SEED] [-x EXPR]... [-o DIR] [--no-tracking] [--simd]
+//                 [--verify] [--bench]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __AVX2__
+  #include <immintrin.h>
+#endif
+
+#ifndef EYE_DATA
+  #define EYE_DATA "../../src/data/defaultEye.h"
+#endif
+#include EYE_DATA
+
+#ifndef IRIS_MIN
+  #define IRIS_MIN 90
+#endif
+#ifndef IRIS_MAX
+  #define IRIS_MAX 130
+#endif
+#ifdef EYE_SIZE
+  #define EYE_WIDTH  EYE_SIZE
+  #define EYE_HEIGHT EYE_SIZE
+#endif
+#define PIXEL_OUT(p) ((uint16_t)(p)) // Table order, no wire byte swap
+
+// Arduino random(), one generator per unit (xorshift64*)
+static uint64_t rng;
+static long random(long howbig) {
+  if (howbig <= 0) return 0;
+  rng ^= rng >> 12;
+  rng ^= rng << 25;
+  rng ^= rng >> 27;
+  return (long)((rng * 0x2545F4914F6CDD1DULL) >> 33) % howbig;
+}
+static long random(long howsmall, long howbig) {
+  return (howsmall >= howbig) ? howsmall : howsmall + random(howbig - howsmall);
+}
+static long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+#include "../../src/eyeRender.h"
+#include "../../src/irisPlan.h"
+#include "../../src/timeline.h"
+
+#define NOBLINK 0 // As in main.cpp
+#define ENBLINK 1
+#define DEBLINK 2
+
+// drawEye() inputs for one frame
+typedef struct {
+  uint16_t iScale;
+  uint16_t scleraX, scleraY;
+  uint8_t  uT, lT;
+  uint8_t  eye;
+  uint32_t index; // Frame number of this eye
+} job_t;
+
+typedef struct {
+  uint8_t  state;
+  uint32_t duration, startTime;
+} blink_t;
+
+typedef struct {
+  timeline_t tl;
+  irisPlan_t plan;
+  int16_t    held, oldIris, newIris;
+  uint8_t    uThreshold;
+  uint32_t   timeOfLastBlink, timeToNextBlink;
+  blink_t    blink[2];
+  size_t     nextExpr;
+} unit_t;
+
+static const bool   mirror[2][2]   = { { true, false }, { true, false } };
+static const int8_t converge[2][2] = { { 0, 0 }, { -4, 4 } };
+
+static bool allIdle(const timeline_t *tl) {
+  for (uint8_t c = 0; c < TL_CHANNELS; c++) {
+    if (!tlIdle(&tl->track[c])) return false;
+  }
+  return true;
+}
+
+// One frame() call of unit u at time t, updateEye()'s autonomous iris
+// first.  Expressions from -x start one after another whenever every
+// channel is idle, i.e. between saccades.
+static job_t step(unit_t *u, uint8_t eyes, uint8_t e, uint32_t t, bool tracking,
+                  const std::vector<uint8_t> &exprs) {
+  timeline_t *tl = &u->tl;
+  if (tl->value[TL_IRIS]) {
+    u->held = tl->value[TL_IRIS];
+  } else if (u->held || !u->plan.n || irisPlanDone(&u->plan, t)) {
+    if (u->held) u->oldIris = u->held;
+    u->held    = 0;
+    u->newIris = random(IRIS_MIN, IRIS_MAX);
+    irisPlanMake(&u->plan, u->oldIris, u->newIris, t, 10000000L, IRIS_MAX - IRIS_MIN);
+    u->oldIris = u->newIris;
+  }
+  int16_t iScale = irisPlanAt(&u->plan, t);
+
+  tlUpdate(tl, t);
+  if ((u->nextExpr < exprs.size()) && allIdle(tl)) {
+    if (!tl->value[TL_IRIS]) tl->value[TL_IRIS] = iScale;
+    tlPlay(tl, &tlExpressions[exprs[u->nextExpr++]], t);
+  }
+  if (tl->value[TL_IRIS]) iScale = tl->value[TL_IRIS];
+
+  if (tlIdle(&tl->track[TL_GAZE_X]) && tlIdle(&tl->track[TL_GAZE_Y])) {
+    int16_t eyeNewX, eyeNewY, dx, dy;
+    do {
+      eyeNewX = random(1024);
+      eyeNewY = random(1024);
+      dx      = (eyeNewX * 2) - 1023;
+      dy      = (eyeNewY * 2) - 1023;
+    } while ((dx * dx + dy * dy) > (1023 * 1023));
+    uint32_t hold = t + random(3000000);
+    uint32_t move = hold + random(72000, 144000);
+    tlTo(&tl->track[TL_GAZE_X], hold, tl->value[TL_GAZE_X], TL_STEP);
+    tlTo(&tl->track[TL_GAZE_X], move, eyeNewX, TL_SMOOTH);
+    tlTo(&tl->track[TL_GAZE_Y], hold, tl->value[TL_GAZE_Y], TL_STEP);
+    tlTo(&tl->track[TL_GAZE_Y], move, eyeNewY, TL_SMOOTH);
+  }
+  int16_t eyeX = tl->value[TL_GAZE_X], eyeY = tl->value[TL_GAZE_Y];
+
+  if ((t - u->timeOfLastBlink) >= u->timeToNextBlink) {
+    u->timeOfLastBlink = t;
+    uint32_t blinkDuration = random(36000, 72000);
+    for (uint8_t i = 0; i < eyes; i++) {
+      if (u->blink[i].state == NOBLINK) {
+        u->blink[i].state     = ENBLINK;
+        u->blink[i].startTime = t;
+        u->blink[i].duration  = blinkDuration;
+      }
+    }
+    u->timeToNextBlink = blinkDuration * 3 + random(4000000);
+  }
+  blink_t *b = &u->blink[e];
+  if (b->state && ((t - b->startTime) >= b->duration)) {
+    if (++b->state > DEBLINK) {
+      b->state = NOBLINK;
+    } else {
+      b->duration *= 2;
+      b->startTime = t;
+    }
+  }
+
+  eyeX = map(eyeX, 0, 1023, 0, SCLERA_WIDTH  - SCREEN_WIDTH);
+  eyeY = map(eyeY, 0, 1023, 0, SCLERA_HEIGHT - SCREEN_HEIGHT);
+  eyeX = std::min(std::max(eyeX + converge[eyes - 1][e], 0), SCLERA_WIDTH - SCREEN_WIDTH);
+
+  uint8_t lThreshold, n;
+  if (tracking) {
+    int16_t sampleX = SCLERA_WIDTH  / 2 - (eyeX / 2),
+            sampleY = SCLERA_HEIGHT / 2 - (eyeY + IRIS_HEIGHT / 4);
+    if (sampleY < 0) n = 0;
+    else            n = (LID_UPPER(sampleY * SCREEN_WIDTH + sampleX) +
+                         LID_UPPER(sampleY * SCREEN_WIDTH + (SCREEN_WIDTH - 1 - sampleX))) / 2;
+    u->uThreshold = (u->uThreshold * 3 + n) / 4;
+    lThreshold    = 254 - u->uThreshold;
+  } else {
+    u->uThreshold = lThreshold = 0;
+  }
+  if (b->state) {
+    uint32_t s = (t - b->startTime);
+    if (s >= b->duration) s = 255;
+    else s = 255 * s / b->duration;
+    s          = (b->state == DEBLINK) ? 1 + s : 256 - s;
+    n          = (u->uThreshold * s + 254 * (257 - s)) / 256;
+    lThreshold = (lThreshold * s + 254 * (257 - s)) / 256;
+  } else {
+    n          = u->uThreshold;
+  }
+  if (tl->value[TL_CLOSE] || tl->value[TL_SQUINT]) {
+    uint32_t c = std::min(std::max((int)tl->value[TL_CLOSE], 0), 255);
+    uint32_t q = std::min(std::max((int)tl->value[TL_SQUINT], 0), 255);
+    uint32_t up = c + ((255 - c) * q) / (4 * 255), lo = c + ((255 - c) * q) / 255;
+    n          = (n * (255 - up) + 254 * up) / 255;
+    lThreshold = (lThreshold * (255 - lo) + 254 * lo) / 255;
+  }
+
+  job_t j;
+  j.iScale  = iScale;
+  j.scleraX = eyeX;
+  j.scleraY = eyeY;
+  j.uT      = n;
+  j.lT      = lThreshold;
+  j.eye     = e;
+  return j;
+}
+
+#ifdef __AVX2__
+// Tables padded by one entry: the gathers below read 32 bits at 16-bit
+// positions and keep the low half
+static std::vector<uint16_t> padSclera, padIris, padPolar;
+
+static void simdInit(void) {
+  padSclera.assign(sclera, sclera + SCLERA_WIDTH * SCLERA_HEIGHT);
+  padIris.assign(iris, iris + IRIS_MAP_WIDTH * IRIS_MAP_HEIGHT);
+  padPolar.assign(polar, polar + IRIS_WIDTH * IRIS_HEIGHT);
+  padSclera.push_back(0);
+  padIris.push_back(0);
+  padPolar.push_back(0);
+}
+
+static inline __m256i gather16(const uint16_t *base, __m256i index, __m256i mask) {
+  __m256i v = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *)base, index, mask, 2);
+  return _mm256_and_si256(v, _mm256_set1_epi32(0xFFFF));
+}
+
+// renderEyeRow<1>() 8 pixels at a time; lut is f->irisLut widened to 32 bits
+static void renderEyeRowAVX2(uint16_t *dst, const eyeFrame_t *f, const int32_t *lut, uint32_t y) {
+  const uint32_t rowMax = lidRowMax[y];
+  if ((EYE_WIDTH % 8) || ((rowMax & 0xFF) <= f->lT) || ((rowMax >> 8) <= f->uT)) {
+    renderEyeRow<1>(dst, f, y);
+    return;
+  }
+  const uint32_t scleraY = f->scleraY + ((y * EYE_STEP_Y) >> 16);
+  const int32_t  irisY   = scleraY - IRIS_Y0;
+  const bool     inIrisRow = (uint32_t)irisY < IRIS_HEIGHT;
+  const uint16_t *lid = lidMap + y * EYE_WIDTH;
+  const __m256i  lane   = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i  lT     = _mm256_set1_epi32(f->lT), uT = _mm256_set1_epi32(f->uT);
+  const __m256i  ff     = _mm256_set1_epi32(0xFF), zero = _mm256_setzero_si256();
+  const __m256i  rowIn  = inIrisRow ? _mm256_set1_epi32(-1) : zero;
+  const __m256i  rowOff = _mm256_set1_epi32(scleraY * SCLERA_WIDTH);
+  const __m256i  polOff = _mm256_set1_epi32(inIrisRow ? irisY * IRIS_WIDTH : 0);
+  const __m128i  reverse = _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  const __m256i  dsx = _mm256_mullo_epi32(lane, _mm256_set1_epi32(EYE_STEP_X));
+
+  for (uint32_t x = 0; x < EYE_WIDTH; x += 8) {
+    __m128i l16 = f->mirror ?
+      _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(lid + EYE_WIDTH - 8 - x)), reverse) :
+      _mm_loadu_si128((const __m128i *)(lid + x));
+    __m256i l    = _mm256_cvtepu16_epi32(l16);
+    __m256i open = _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_and_si256(l, ff), lT),
+                                    _mm256_cmpgt_epi32(_mm256_srli_epi32(l, 8), uT));
+    __m256i sx   = _mm256_srli_epi32(_mm256_add_epi32(_mm256_set1_epi32((f->scleraX << 16) + x * EYE_STEP_X), dsx), 16);
+    __m256i ix   = _mm256_sub_epi32(sx, _mm256_set1_epi32(IRIS_X0));
+    __m256i inIris = _mm256_and_si256(_mm256_and_si256(open, rowIn),
+                       _mm256_and_si256(_mm256_cmpgt_epi32(ix, _mm256_set1_epi32(-1)),
+                                        _mm256_cmpgt_epi32(_mm256_set1_epi32(IRIS_WIDTH), ix)));
+    __m256i p    = gather16(padPolar.data(), _mm256_add_epi32(polOff, _mm256_and_si256(ix, inIris)), inIris);
+    __m256i d    = _mm256_mask_i32gather_epi32(zero, lut, _mm256_and_si256(p, _mm256_set1_epi32(0x7F)), inIris, 4);
+    __m256i useIris = _mm256_andnot_si256(_mm256_cmpeq_epi32(d, _mm256_set1_epi32(NO_IRIS)), inIris);
+    __m256i ii   = _mm256_add_epi32(d, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(p, 7),
+                                                         _mm256_set1_epi32(IRIS_MAP_WIDTH)), 9));
+    __m256i pi   = gather16(padIris.data(), _mm256_and_si256(ii, useIris), useIris);
+    __m256i useSclera = _mm256_andnot_si256(useIris, open);
+    __m256i ps   = gather16(padSclera.data(), _mm256_and_si256(_mm256_add_epi32(rowOff, sx), useSclera), useSclera);
+    __m256i px   = _mm256_or_si256(pi, ps); // Lanes not gathered are 0
+    __m256i out  = _mm256_permute4x64_epi64(_mm256_packus_epi32(px, px), 0xD8);
+    _mm_storeu_si128((__m128i *)(dst + x), _mm256_castsi256_si128(out));
+  }
+}
+#endif
+
+static bool useSimd = false;
+
+// Render one frame into buf (EYE_WIDTH x EYE_HEIGHT)
+static void render(uint16_t *buf, const job_t *j, uint8_t eyes, eyeIrisCache_t *cache, bool simd) {
+  eyeFrame_t f;
+  eyeFrameSetup(&f, cache, mirror[eyes - 1][j->eye], j->iScale, j->scleraX, j->scleraY, j->uT, j->lT);
+#ifdef __AVX2__
+  if (simd) {
+    int32_t lut[128];
+    for (uint32_t i = 0; i < 128; i++) lut[i] = f.irisLut[i];
+    for (uint32_t y = 0; y < EYE_HEIGHT; y++) renderEyeRowAVX2(buf + y * EYE_WIDTH, &f, lut, y);
+    return;
+  }
+#else
+  (void)simd;
+#endif
+  for (uint32_t y = 0; y < EYE_HEIGHT; y++) renderEyeRow<1>(buf + y * EYE_WIDTH, &f, y);
+}
+
+static uint64_t fnv(const uint16_t *p, size_t n) {
+  uint64_t h = 0xCBF29CE484222325ULL;
+  for (size_t i = 0; i < n; i++) h = (h ^ p[i]) * 0x100000001B3ULL;
+  return h;
+}
+
+static bool writePpm(const std::string &path, const uint16_t *buf) {
+  FILE *fp = fopen(path.c_str(), "wb");
+  if (!fp) return false;
+  std::vector<uint8_t> rgb(EYE_WIDTH * EYE_HEIGHT * 3);
+  for (uint32_t i = 0; i < EYE_WIDTH * EYE_HEIGHT; i++) {
+    uint16_t p = buf[i];
+#ifdef EYE_ASSET_SWAPPED
+    p = p >> 8 | p << 8;
+#endif
+    uint8_t r = p >> 11, g = (p >> 5) & 0x3F, b = p & 0x1F;
+    rgb[i * 3]     = r << 3 | r >> 2;
+    rgb[i * 3 + 1] = g << 2 | g >> 4;
+    rgb[i * 3 + 2] = b << 3 | b >> 2;
+  }
+  fprintf(fp, "P6\n%u %u\n255\n", EYE_WIDTH, EYE_HEIGHT);
+  bool ok = fwrite(rgb.data(), 1, rgb.size(), fp) == rgb.size();
+  return (fclose(fp) == 0) && ok;
+}
+
+typedef struct {
+  std::mutex        lock;
+  std::deque<size_t> jobs;
+} queue_t;
+
+typedef struct {
+  const std::vector<job_t> *jobs;
+  std::vector<uint64_t>    *sums;
+  uint32_t                  frames; // Per unit
+  uint8_t                   eyes;
+  const char               *dir;    // Or nullptr
+  bool                      verify;
+  std::atomic<uint32_t>     mismatches, failures;
+} farm_t;
+
+// Next job for worker w: its own newest, else the oldest of another's
+static bool take(std::vector<queue_t> &q, size_t w, size_t *job) {
+  {
+    std::lock_guard<std::mutex> g(q[w].lock);
+    if (!q[w].jobs.empty()) {
+      *job = q[w].jobs.back();
+      q[w].jobs.pop_back();
+      return true;
+    }
+  }
+  for (size_t i = 1; i < q.size(); i++) { // Nothing spawns jobs: all empty = done
+    queue_t &v = q[(w + i) % q.size()];
+    std::lock_guard<std::mutex> g(v.lock);
+    if (!v.jobs.empty()) {
+      *job = v.jobs.front();
+      v.jobs.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+static void worker(farm_t *farm, std::vector<queue_t> *q, size_t w) {
+  std::vector<uint16_t> buf(EYE_WIDTH * EYE_HEIGHT), check;
+  eyeIrisCache_t        cache = {}, checkCache = {};
+  size_t                n;
+  char                  name[64];
+  if (farm->verify) check.resize(buf.size());
+  while (take(*q, w, &n)) {
+    const job_t *j = &(*farm->jobs)[n];
+    render(buf.data(), j, farm->eyes, &cache, useSimd);
+    (*farm->sums)[n] = fnv(buf.data(), buf.size());
+    if (farm->verify) {
+      render(check.data(), j, farm->eyes, &checkCache, !useSimd);
+      if (check != buf) farm->mismatches++;
+    }
+    if (farm->dir) {
+      snprintf(name, sizeof name, "/u%03u_e%u_%05u.ppm", (unsigned)(n / farm->frames),
+               j->eye, j->index);
+      if (!writePpm(farm->dir + std::string(name), buf.data())) farm->failures++;
+    }
+  }
+}
+
+// Render every job with threads workers, blocks of consecutive jobs each
+static double run(farm_t *farm, unsigned threads) {
+  std::vector<queue_t>     q(threads);
+  std::vector<std::thread> pool;
+  size_t                   total = farm->jobs->size();
+  for (size_t i = 0; i < total; i++) q[i * threads / total].jobs.push_back(i);
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned w = 0; w < threads; w++) pool.emplace_back(worker, farm, &q, w);
+  for (auto &t : pool) t.join();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+  uint32_t             units = 8, frames = 300, fps = 60, seed = 1;
+  uint8_t              eyes = 2;
+  unsigned             threads = std::max(1u, std::thread::hardware_concurrency());
+  const char          *dir = nullptr;
+  bool                 tracking = true, verify = false, bench = false;
+  std::vector<uint8_t> exprs;
+  for (int i = 1; i < argc; i++) {
+    const char *a = argv[i], *v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if      (!strcmp(a, "-u") && v) { units   = strtoul(v, nullptr, 0); i++; }
+    else if (!strcmp(a, "-e") && v) { eyes    = strtoul(v, nullptr, 0); i++; }
+    else if (!strcmp(a, "-n") && v) { frames  = strtoul(v, nullptr, 0); i++; }
+    else if (!strcmp(a, "-r") && v) { fps     = strtoul(v, nullptr, 0); i++; }
+    else if (!strcmp(a, "-j") && v) { threads = strtoul(v, nullptr, 0); i++; }
+    else if (!strcmp(a, "-s") && v) { seed    = strtoul(v, nullptr, 0); i++; }
+    else if (!strcmp(a, "-o") && v) { dir     = v; i++; }
+    else if (!strcmp(a, "-x") && v) {
+      unsigned long x = strtoul(v, nullptr, 0);
+      if (x >= TL_EXPRESSIONS) {
+        fprintf(stderr, "eyefarm: no expression %s (0-%u)\n", v, (unsigned)TL_EXPRESSIONS - 1);
+        return 1;
+      }
+      exprs.push_back(x);
+      i++;
+    }
+    else if (!strcmp(a, "--no-tracking")) tracking = false;
+    else if (!strcmp(a, "--simd"))        useSimd  = true;
+    else if (!strcmp(a, "--verify"))      verify   = true;
+    else if (!strcmp(a, "--bench"))       bench    = true;
+    else {
+      fprintf(stderr, "usage: eyefarm [-u UNITS] [-e EYES] [-n FRAMES] [-r FPS] [-j THREADS]\n"
+                      "               [-s SEED] [-x EXPR]... [-o DIR] [--no-tracking] [--simd]\n"
+                      "               [--verify] [--bench]\n");
+      return 1;
+    }
+  }
+  if (!units || !frames || !fps || !threads || (eyes < 1) || (eyes > 2)) {
+    fprintf(stderr, "eyefarm: -u, -n, -r and -j must be at least 1, -e 1 or 2\n");
+    return 1;
+  }
+#ifdef __AVX2__
+  simdInit();
+#else
+  if (useSimd || verify) {
+    fprintf(stderr, "eyefarm: --simd and --verify need a build with -mavx2\n");
+    return 1;
+  }
+#endif
+  if (dir) {
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+      fprintf(stderr, "eyefarm: %s: %s\n", dir, ec.message().c_str());
+      return 1;
+    }
+  }
+
+  // Animate: frames per eye, frame() calls alternating between the eyes
+  initEyeTables();
+  std::vector<job_t> jobs;
+  jobs.reserve((size_t)units * frames * eyes);
+  uint32_t interval = 1000000 / (fps * eyes);
+  auto     start    = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < units; n++) {
+    unit_t u = {};
+    rng        = 0x9E3779B97F4A7C15ULL * (((uint64_t)seed << 20) + n + 1);
+    u.oldIris  = (IRIS_MIN + IRIS_MAX) / 2;
+    u.uThreshold = 128;
+    tlInit(&u.tl, 0);
+    for (uint32_t k = 0; k < frames * eyes; k++) {
+      job_t j = step(&u, eyes, k % eyes, k * interval, tracking, exprs);
+      j.index = k / eyes;
+      jobs.push_back(j);
+    }
+  }
+  double animate = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<uint64_t> sums(jobs.size());
+  farm_t farm;
+  farm.jobs   = &jobs;
+  farm.sums   = &sums;
+  farm.frames = frames * eyes;
+  farm.eyes   = eyes;
+  farm.dir    = bench ? nullptr : dir;
+  farm.verify = verify;
+  farm.mismatches = farm.failures = 0;
+
+  printf("%u units x %u eyes x %u frames, %ux%u, %s kernel\n", units, eyes, frames,
+         EYE_WIDTH, EYE_HEIGHT, useSimd ? "AVX2" : "scalar");
+  printf("animation: %.1f ns per frame\n", animate * 1e9 / jobs.size());
+  if (bench) {
+    double one = 0;
+    for (unsigned n = 1; ; n = std::min(n * 2, threads)) {
+      double s = run(&farm, n);
+      if (n == 1) one = s;
+      printf("%3u threads: %8.0f frames/s, speedup %.2f (%.0f%% per thread)\n", n,
+             jobs.size() / s, one / s, 100 * one / s / n);
+      if (n == threads) break;
+    }
+  } else {
+    double s = run(&farm, threads);
+    printf("%u threads: %.0f frames/s\n", threads, jobs.size() / s);
+  }
+
+  uint64_t sum = 0xCBF29CE484222325ULL;
+  for (uint64_t h : sums) sum = (sum ^ h) * 0x100000001B3ULL;
+  printf("checksum %016llx\n", (unsigned long long)sum);
+  if (verify) printf("verify: %u of %zu frames differ between kernels\n",
+                     farm.mismatches.load(), jobs.size());
+  if (farm.failures) fprintf(stderr, "eyefarm: %u frames could not be written\n", farm.failures.load());
+  return (farm.mismatches || farm.failures) ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+// eyepty -- stands in for the sketch's serial port on the host, so eyecmd
+// and other senders can be tested without hardware.
+//
+// Opens a pseudo-terminal, prints the name of its device to send to and
+// runs everything written there through the sketch's packet parser
+// (src/command.h), as serialPoll() does.  Each packet is printed with
+// whether cmdApply() would take it (sequence number newer than the last
+// one taken, or 0), and each byte that would reach debugCommand() is
+// printed as a debug command.  With -, bytes are read from stdin instead
+// and totals are printed at the end, e.g. to check that line noise or a
+// damaged packet doesn't come out as debug commands.
+//
+// Build:  g++ -O2 -std=c++17 -o eyepty eyepty.cpp
+//
+// Usage:  eyepty [-]
+//   eyepty                      then, elsewhere: eyecmd /dev/pts/N gaze 512 300
+//   head -c 4096 /dev/urandom | eyepty -
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../../src/command.h"
+
+static cmdParser_t parser;
+static bool        synced;
+static uint16_t    lastSeq;
+static unsigned long packets, taken, debug, bytes;
+
+static void packet(const cmdPacket_t *p) {
+  bool take = !synced || !p->seq || ((int16_t)(p->seq - lastSeq) > 0);
+  packets++;
+  printf("packet seq %u time %lu cmd %u:", p->seq, (unsigned long)p->hostTime, p->cmd);
+  switch (p->cmd) {
+    case CMD_GAZE:   if (p->len >= 4) printf(" gaze %d %d", cmdI16(p, 0), cmdI16(p, 2)); break;
+    case CMD_IRIS:   if (p->len >= 2) printf(" iris %u", (uint16_t)cmdI16(p, 0));        break;
+    case CMD_BLINK:  if (p->len >= 3) printf(" blink mask %u %u ms", p->payload[0],
+                                             (uint16_t)cmdI16(p, 1));                  break;
+    case CMD_SELECT: if (p->len >= 1) printf(" select %u", p->payload[0]);             break;
+    case CMD_EXPR:   if (p->len >= 1) printf(" expr %u", p->payload[0]);               break;
+    case CMD_MODE:   if (p->len >= 1) printf(" mode %u", p->payload[0]);               break;
+  }
+  for (uint8_t i = 0; i < p->len; i++) printf(" %02x", p->payload[i]);
+  printf(take ? "\n" : "  (stale, ignored)\n");
+  if (!take) return;
+  taken++;
+  synced  = true;
+  lastSeq = p->seq;
+}
+
+static void feed(const uint8_t *buf, ssize_t n) {
+  for (ssize_t i = 0; i < n; i++) {
+    bytes++;
+    switch (cmdParse(&parser, buf[i])) {
+      case CMD_READY: packet(&parser.pkt); break;
+      case CMD_OTHER:
+        debug++;
+        printf("debug command '%c'\n", buf[i]);
+        break;
+    }
+  }
+  fflush(stdout);
+}
+
+int main(int argc, char **argv) {
+  uint8_t buf[256];
+  ssize_t n;
+  if ((argc > 1) && !strcmp(argv[1], "-")) {
+    while ((n = read(0, buf, sizeof buf)) > 0) feed(buf, n);
+    printf("%lu bytes, %lu packets (%lu taken), %lu debug commands\n", bytes, packets, taken,
+           debug);
+    return 0;
+  } else if (argc > 1) {
+    fprintf(stderr, "Usage: eyepty [-]\n");
+    return 2;
+  }
+
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if ((master < 0) || grantpt(master) || unlockpt(master)) {
+    perror("eyepty: pty");
+    return 1;
+  }
+  const char *name  = ptsname(master);
+  int         slave = open(name, O_RDWR | O_NOCTTY); // Held open: no EIO between senders
+  struct termios tio;
+  if ((slave < 0) || tcgetattr(slave, &tio)) {
+    perror(name);
+    return 1;
+  }
+  cfmakeraw(&tio); // Bytes as sent, like the CDC port
+  tcsetattr(slave, TCSANOW, &tio);
+  printf("%s\n", name);
+  fflush(stdout);
+  while ((n = read(master, buf, sizeof buf)) > 0) feed(buf, n);
+  perror("eyepty: read");
+  return 1;
+}
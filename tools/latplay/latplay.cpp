@@ -0,0 +1,114 @@
+// latplay -- feeds input, render and photon timestamps through the
+// sketch's latency tracking (src/latency.h) on the host and prints the
+// resulting histograms.
+//
+// Input is text, one event per line, times in micros:
+//   T i MASK    input event for the eyes in MASK (latencyInput)
+//   T j X Y     joystick reading, 0-1023 (latencyJoystick)
+//   T r EYE     frame for EYE starts rendering (latencyRender)
+//   T p EYE     last pixel of EYE's frame left the bus (latencyPhoton)
+// Blank lines and lines starting with '#' are skipped.  With -s COUNT no
+// input is read: eyes are drawn round robin, each frame taking FRAME us
+// (default 8000) from render to photon, and COUNT input events for all
+// eyes arrive at random times.  Either way the output is one line per
+// eye in the format of serial 'l':
+//   F<eye> lat n=<count> p50=<us> p99=<us> max=<us> <bucket>:<count>...
+//
+// Build:  g++ -O2 -std=c++17 -o latplay latplay.cpp
+// Build with e.g. -DNUM_EYES=4 to match another configuration.
+//
+// Usage:  latplay [FILE]
+//         latplay -s COUNT [-f FRAME]
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#ifndef NUM_EYES
+  #define NUM_EYES 2
+#endif
+#include "../../src/frameStats.h"
+#include "../../src/latency.h"
+
+static void print(uint8_t e, const statsHist_t *h) {
+  printf("F%u lat n=%lu p50=%lu p99=%lu max=%lu", e, (unsigned long)h->total,
+         (unsigned long)statsPercentile(h, 50), (unsigned long)statsPercentile(h, 99),
+         (unsigned long)h->max);
+  for (uint32_t b = 0; b < STATS_BUCKETS; b++) {
+    if (h->count[b]) printf(" %lu:%lu", (unsigned long)b, (unsigned long)h->count[b]);
+  }
+  putchar('\n');
+}
+
+// Replay a recorded or hand-written event list
+static int replay(FILE *in) {
+  char line[256];
+  long n = 0;
+  while (fgets(line, sizeof line, in)) {
+    n++;
+    char          ev;
+    unsigned long t;
+    long          a, b;
+    int           got = sscanf(line, "%lu %c %li %li", &t, &ev, &a, &b);
+    if ((got <= 0) || (line[0] == '#')) continue;
+    bool eyeOk = (got >= 3) && (a >= 0) && (a < NUM_EYES);
+    if ((ev == 'i') && (got >= 3)) {
+      latencyInput(a, t);
+    } else if ((ev == 'j') && (got == 4)) {
+      latencyJoystick(a, b, t);
+    } else if ((ev == 'r') && eyeOk) {
+      latencyRender(a);
+    } else if ((ev == 'p') && eyeOk) {
+      latencyPhoton(a, t);
+    } else {
+      fprintf(stderr, "latplay: line %ld not understood: %s", n, line);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Round-robin frames of equal cost with inputs at random times
+static void simulate(uint32_t count, uint32_t frame) {
+  std::mt19937                            rng(1);
+  std::uniform_int_distribution<uint32_t> gap(1, frame * NUM_EYES * 2);
+  uint32_t t = 0, input = gap(rng);
+  for (uint8_t e = 0; count; e = (e + 1) % NUM_EYES) {
+    latencyRender(e);
+    t += frame;
+    latencyPhoton(e, t);
+    while (count && ((int32_t)(input - t) < 0)) { // Arrived during this frame
+      latencyInput((1 << NUM_EYES) - 1, input);
+      input += gap(rng);
+      count--;
+    }
+  }
+  for (uint8_t e = 0; e < NUM_EYES; e++) { // Serve what is still pending
+    latencyRender(e);
+    latencyPhoton(e, t += frame);
+  }
+}
+
+int main(int argc, char **argv) {
+  FILE    *in    = stdin;
+  uint32_t count = 0, frame = 8000;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-s") && (i + 1 < argc)) {
+      count = strtoul(argv[++i], nullptr, 0);
+    } else if (!strcmp(argv[i], "-f") && (i + 1 < argc)) {
+      frame = strtoul(argv[++i], nullptr, 0);
+    } else if (!(in = fopen(argv[i], "r"))) {
+      fprintf(stderr, "latplay: can't open %s\n", argv[i]);
+      return 1;
+    }
+  }
+  if (count) {
+    simulate(count, frame ? frame : 1);
+  } else if (replay(in)) {
+    return 1;
+  }
+  for (uint8_t e = 0; e < NUM_EYES; e++) print(e, &latencyHist[e]);
+  return 0;
+}
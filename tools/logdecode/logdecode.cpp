@@ -0,0 +1,62 @@
+// logdecode -- turns the sketch's serial output back into readable text.
+//
+// Binary log records (see src/log.h) are decoded with the format strings
+// from src/logMessages.h and printed with their timestamp; any other bytes
+// (boot messages, 'p'/'h' dumps) are passed through unchanged.
+//
+// Build:  g++ -O2 -std=c++17 -o logdecode logdecode.cpp
+//
+// Examples:
+//   stty -F /dev/ttyACM0 raw 115200; logdecode < /dev/ttyACM0
+//   logdecode capture.bin
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#define LOG_LEVEL 0 // Table and record layout only
+#include "../../src/log.h"
+
+static const char *formats[] = {
+#define LOG_MESSAGE(id, format) format,
+#include "../../src/logMessages.h"
+#undef LOG_MESSAGE
+};
+
+int main(int argc, char **argv) {
+  FILE *in = stdin;
+  if (argc > 1 && !(in = fopen(argv[1], "rb"))) {
+    fprintf(stderr, "logdecode: can't open %s\n", argv[1]);
+    return 1;
+  }
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+
+  uint8_t buf[sizeof(logRecord_t)];
+  size_t  n = 0;  // Bytes in buf, buf[0] == LOG_SYNC when n > 0
+  int     c;
+  while ((c = fgetc(in)) != EOF) {
+    if (!n && c != LOG_SYNC) {
+      putchar(c);
+      continue;
+    }
+    buf[n++] = c;
+    if (n < sizeof buf) continue;
+
+    logRecord_t r;
+    memcpy(&r, buf, sizeof r);
+    if (r.id < LOG_MESSAGES && r.check == logCheck(&r)) {
+      printf("[%10.6f] ", r.time / 1e6);
+      printf(formats[r.id], (long)r.arg[0], (long)r.arg[1]);
+      putchar('\n');
+      n = 0;
+    } else { // Not a record: emit the sync byte as text, rescan the rest
+      putchar(buf[0]);
+      size_t i = 1;
+      while (i < n && buf[i] != LOG_SYNC) putchar(buf[i++]);
+      memmove(buf, buf + i, n - i);
+      n -= i;
+    }
+  }
+  fwrite(buf, 1, n, stdout);
+  return 0;
+}
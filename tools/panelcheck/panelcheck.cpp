@@ -0,0 +1,223 @@
+// panelcheck -- drives the transaction queue of the sketch's panel driver
+// (src/panel.h) against its host mock and checks what reaches the bus.
+//
+// A random but repeatable mix of address windows and pixel transfers of
+// random sizes is sent to all panels, interleaving the panels between
+// calls, with panelWait() and panelClock() thrown in now and then.  The
+// pixel transfers alternate between two buffers like the render loop.
+// After every call the following are checked:
+//   - per panel, the log reads CASET, x range, RASET, y range, RAMWR,
+//     then pixel data adding up to exactly the window, in that order;
+//   - when panelPixels() returns, every earlier pixel transfer on any
+//     panel has completed, so at most that one is in flight and the
+//     other buffer can be refilled;
+//   - the transactions still pending in the mock are exactly the driver's
+//     queued but unretired slots, oldest first, none of them reused and
+//     never more than PANEL_QUEUE.
+// The first failure is printed with the call that caused it and the exit
+// status is 1; otherwise the number of calls and transactions is printed.
+//
+// Build:  g++ -O2 -std=c++17 -o panelcheck panelcheck.cpp
+// Build with e.g. -DNUM_EYES=4 to check more panels.
+//
+// Usage:  panelcheck [-n CALLS] [-r SEED]
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+
+#ifndef NUM_EYES
+  #define NUM_EYES 2
+#endif
+#include "../../src/panel.h"
+
+#define PIXEL  2   // Bytes per pixel
+#define SCREEN 160 // Panel width and height
+
+enum { EXPECT_CASET, EXPECT_X, EXPECT_RASET, EXPECT_Y, EXPECT_RAMWR, EXPECT_PIXELS };
+
+typedef struct {
+  uint8_t  state;
+  uint16_t x1, x2, y1, y2;       // Window the driver was asked for
+  uint32_t left;                 // Pixel bytes still owed to the window
+  uint32_t pixelSent, pixelDone; // Pixel transfers queued / completed
+} panelCheck_t;
+
+static panelCheck_t      check[NUM_EYES];
+static std::deque<bool>  kinds[NUM_EYES]; // Logged, not completed; true = pixels
+static uint32_t          logged;          // panelMockLog[] entries checked
+static const char       *call = "";       // Call being checked, for messages
+static unsigned long     calls;
+
+static void fail(const char *what, unsigned p) {
+  fprintf(stderr, "panelcheck: call %lu (%s), panel %u: %s\n", calls, call, p, what);
+  exit(1);
+}
+
+static uint16_t be16(const uint8_t *d) {
+  return (d[0] << 8) | d[1];
+}
+
+// Check the newly logged transactions against each panel's window
+static void checkLog(void) {
+  if (panelMockCount - logged > PANEL_MOCK_LOG) fail("mock log overrun", 0);
+  for (; logged != panelMockCount; logged++) {
+    const panelMockEntry_t *m = &panelMockLog[logged % PANEL_MOCK_LOG];
+    panelCheck_t           *c = &check[m->panel];
+    kinds[m->panel].push_back(m->buffer != NULL);
+    bool cmd  = !m->dc && (m->bytes == 1) && !m->buffer;
+    bool data = m->dc && (m->bytes == 4) && !m->buffer;
+    switch (c->state) {
+      case EXPECT_CASET:
+        if (!cmd || (m->data[0] != PANEL_CASET)) fail("expected CASET", m->panel);
+        break;
+      case EXPECT_X:
+        if (!data || (be16(m->data) != c->x1) || (be16(m->data + 2) != c->x2))
+          fail("wrong column range", m->panel);
+        break;
+      case EXPECT_RASET:
+        if (!cmd || (m->data[0] != PANEL_RASET)) fail("expected RASET", m->panel);
+        break;
+      case EXPECT_Y:
+        if (!data || (be16(m->data) != c->y1) || (be16(m->data + 2) != c->y2))
+          fail("wrong row range", m->panel);
+        break;
+      case EXPECT_RAMWR:
+        if (!cmd || (m->data[0] != PANEL_RAMWR)) fail("expected RAMWR", m->panel);
+        break;
+      case EXPECT_PIXELS:
+        if (!m->dc || !m->buffer) fail("expected pixel data", m->panel);
+        if (m->bytes > c->left) fail("more pixel data than the window holds", m->panel);
+        c->left -= m->bytes;
+        break;
+    }
+    if (c->state != EXPECT_PIXELS) {
+      c->state++;
+    } else if (!c->left) {
+      c->state = EXPECT_CASET; // Window complete
+    }
+  }
+}
+
+// The mock's pending transactions must be the driver's unretired slots
+static void checkSlots(void) {
+  uint32_t inFlight = panelHead - panelTail;
+  uint32_t pending  = 0;
+  for (uint8_t p = 0; p < NUM_EYES; p++) {
+    uint8_t n = panelMockHead[p] - panelMockTail[p];
+    if (n > PANEL_QUEUE) fail("mock queue overrun", p);
+    pending += n;
+  }
+  if (inFlight > PANEL_QUEUE) fail("more slots queued than PANEL_QUEUE", 0);
+  if (pending != inFlight) fail("slots retired out of step with the bus", 0);
+  uint8_t next[NUM_EYES]; // Oldest pending transaction per panel
+  for (uint8_t p = 0; p < NUM_EYES; p++) next[p] = panelMockTail[p];
+  for (uint32_t i = panelTail; i != panelHead; i++) {
+    const panelSlot_t *s = &panelSlot[i % PANEL_QUEUE];
+    if (panelMockFifo[s->panel][next[s->panel]++ % PANEL_QUEUE] != &s->t)
+      fail("pending transaction isn't its slot's (slot reused or retired out of order)", s->panel);
+  }
+}
+
+// Completed pixel transfers per panel.  The mock completes each panel's
+// transactions in queue order; which of them carried pixels comes from
+// the log (kinds[]), as the slots behind completed ones may already be
+// reused.
+static void countDone(void) {
+  static uint8_t seen[NUM_EYES];
+  for (uint8_t p = 0; p < NUM_EYES; p++) {
+    for (; seen[p] != panelMockTail[p]; seen[p]++) {
+      if (kinds[p].empty()) fail("completed a transaction that was never queued", p);
+      check[p].pixelDone += kinds[p].front();
+      kinds[p].pop_front();
+    }
+  }
+}
+
+static void after(void) {
+  checkLog();
+  countDone();
+  checkSlots();
+  calls++;
+}
+
+int main(int argc, char **argv) {
+  unsigned long n    = 100000;
+  unsigned long seed = 1;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && (i + 1 < argc)) {
+      n = strtoul(argv[++i], nullptr, 0);
+    } else if (!strcmp(argv[i], "-r") && (i + 1 < argc)) {
+      seed = strtoul(argv[++i], nullptr, 0);
+    } else {
+      fprintf(stderr, "Usage: panelcheck [-n CALLS] [-r SEED]\n");
+      return 2;
+    }
+  }
+
+  static uint8_t buffer[2][SCREEN * 16 * PIXEL];
+  int8_t         cs[NUM_EYES];
+  for (uint8_t p = 0; p < NUM_EYES; p++) cs[p] = p;
+  call = "panelBegin";
+  panelBegin(cs, NUM_EYES, sizeof buffer[0]);
+  after();
+
+  std::mt19937 rng(seed);
+  auto         random = [&](uint32_t lo, uint32_t hi) {
+    return std::uniform_int_distribution<uint32_t>(lo, hi)(rng);
+  };
+  uint8_t  buf        = 0;
+  uint32_t pixelCalls = 0;
+  while (calls < n) {
+    uint8_t       p = random(0, NUM_EYES - 1);
+    panelCheck_t *c = &check[p];
+    uint32_t      r = random(0, 99);
+    if (r < 2) {
+      call = "panelWait";
+      panelWait();
+      after();
+      for (uint8_t q = 0; q < NUM_EYES; q++) {
+        if (check[q].pixelDone != check[q].pixelSent) fail("panelWait() left pixels in flight", q);
+      }
+    } else if (r < 3) {
+      call = "panelClock";
+      panelClock(random(10, 80) * 1000000);
+      after();
+    } else if (c->state == EXPECT_CASET) {
+      uint16_t w = random(1, SCREEN), h = random(1, SCREEN);
+      uint16_t x = random(0, SCREEN - w), y = random(0, SCREEN - h);
+      c->x1   = x + PANEL_X_OFFSET;
+      c->x2   = c->x1 + w - 1;
+      c->y1   = y + PANEL_Y_OFFSET;
+      c->y2   = c->y1 + h - 1;
+      c->left = (uint32_t)w * h * PIXEL;
+      call    = "panelWindow";
+      panelWindow(p, x, y, w, h);
+      after();
+      if (c->state != EXPECT_PIXELS) fail("window incomplete after panelWindow()", p);
+    } else {
+      uint32_t bytes = c->left;
+      if (bytes > sizeof buffer[0]) bytes = random(1, sizeof buffer[0] / PIXEL) * PIXEL;
+      c->pixelSent++;
+      call = "panelPixels";
+      panelPixels(p, buffer[buf], bytes);
+      buf ^= 1;
+      pixelCalls++;
+      after();
+      for (uint8_t q = 0; q < NUM_EYES; q++) {
+        uint32_t owed = (q == p) ? 1 : 0; // Only the transfer just queued
+        if (check[q].pixelSent - check[q].pixelDone > owed)
+          fail("an earlier pixel transfer is still in flight", q);
+      }
+    }
+  }
+  call = "panelWait";
+  panelWait();
+  after();
+  printf("%lu calls, %lu pixel transfers, %lu transactions: all checks passed\n", calls,
+         (unsigned long)pixelCalls, (unsigned long)panelMockCount);
+  return 0;
+}
@@ -0,0 +1,98 @@
+// sensorplay -- runs recorded ADC sample streams through the sketch's
+// sensor filter and lookup tables (src/sensors.h) on the host.
+//
+// Input is text, one line per ADC scan: up to three raw 12-bit samples
+// (0-4095) for joystick X, joystick Y and the light sensor, in that
+// order.  Blank lines and lines starting with '#' are skipped.  Every
+// completed filter step prints the filtered readings (0-1023), the
+// joystick position after the circle clamp and the iris scale from the
+// light table.  With --stats, only the standard deviation of the raw
+// samples and of the filtered output is printed per input, which for a
+// recording of a stationary input is its noise before and after the
+// filter.
+//
+// Build:  g++ -O2 -std=c++17 -o sensorplay sensorplay.cpp
+// The light table uses the config.h defaults; build with e.g.
+// -DLIGHT_CURVE=0.5 -DIRIS_MIN=80 to match another configuration.
+//
+// Usage:  sensorplay [--stats] [FILE]
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef LIGHT_CURVE
+  #define LIGHT_CURVE 0.33
+#endif
+#ifndef LIGHT_MIN
+  #define LIGHT_MIN   0
+#endif
+#ifndef LIGHT_MAX
+  #define LIGHT_MAX   1023
+#endif
+#ifndef IRIS_MIN
+  #define IRIS_MIN    90
+#endif
+#ifndef IRIS_MAX
+  #define IRIS_MAX    130
+#endif
+#include "../../src/sensors.h"
+
+struct moments {
+  double n = 0, sum = 0, sum2 = 0;
+  void   add(double v) { n++, sum += v, sum2 += v * v; }
+  double sd() const { return n > 1 ? sqrt((sum2 - sum * sum / n) / (n - 1)) : 0; }
+};
+
+int main(int argc, char **argv) {
+  FILE *in    = stdin;
+  bool  stats = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--stats")) {
+      stats = true;
+    } else if (!(in = fopen(argv[i], "r"))) {
+      fprintf(stderr, "sensorplay: can't open %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  static const char *names[SENSORS] = { "joy x", "joy y", "light" };
+  moments raw[SENSORS], out[SENSORS];
+  uint8_t used = 0; // Inputs present in the recording, bit per input
+  char    line[256];
+  long    step = 0;
+  sensorBegin();
+  while (fgets(line, sizeof line, in)) {
+    if (line[0] == '#') continue;
+    char   *p = line, *end;
+    uint8_t s = 0, stepped = 0;
+    for (long v; s < SENSORS && (v = strtol(p, &end, 0), end != p); s++, p = end) {
+      uint8_t n = sensorFilter[s].n;
+      sensorSample(s, v);
+      raw[s].add(v / 4.0); // 10-bit units, like the output
+      used    |= 1 << s;
+      stepped |= (sensorFilter[s].n < n) << s;
+    }
+    if (!stepped) continue;
+    for (s = 0; s < SENSORS; s++) {
+      if (stepped & (1 << s)) out[s].add(sensorRead(s));
+    }
+    if (stats) continue;
+    int16_t x = sensorRead(SENSOR_JOY_X), y = sensorRead(SENSOR_JOY_Y);
+    sensorCircle(&x, &y);
+    printf("%6ld  x %4u y %4u light %4u  gaze %4d %4d  iris %4d\n", step++,
+           sensorRead(SENSOR_JOY_X), sensorRead(SENSOR_JOY_Y), sensorRead(SENSOR_LIGHT),
+           x, y, sensorIris(sensorRead(SENSOR_LIGHT)));
+  }
+  if (stats) {
+    for (uint8_t s = 0; s < SENSORS; s++) {
+      if (used & (1 << s)) {
+        printf("%-6s %8.0f samples  sd raw %7.3f  filtered %7.3f\n", names[s], raw[s].n,
+               raw[s].sd(), out[s].sd());
+      }
+    }
+  }
+  return 0;
+}
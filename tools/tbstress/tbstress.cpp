@@ -0,0 +1,111 @@
+// tbstress -- two-thread stress test of the sketch's triple buffer
+// (src/tripleBuffer.h) on the host.
+//
+// A producer thread publishes COUNT snapshots, each numbered and filled
+// with WORDS words derived from its number; a consumer thread reads as
+// fast as it can.  Every snapshot read is checked for tearing (words that
+// don't all belong to the same number) and for ordering (a number older
+// than one already read).  At the end the counts of snapshots published,
+// reads, new snapshots picked up and snapshots replaced before they were
+// read are printed; the exit status is 1 if any check failed.
+//
+// Build:  g++ -O2 -std=c++17 -pthread -o tbstress tbstress.cpp
+// Build with -fsanitize=thread as well to have the exchanges checked too.
+//
+// Usage:  tbstress [-n COUNT] [-w WORDS]
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "../../src/tripleBuffer.h"
+
+#define MAX_WORDS 256
+
+typedef struct {
+  uint32_t seq;
+  uint32_t word[MAX_WORDS];
+} snapshot_t;
+
+static uint32_t words = 64;
+
+// Word i of snapshot seq
+static inline uint32_t fill(uint32_t seq, uint32_t i) {
+  return seq * 2654435761u + i;
+}
+
+static tripleBuffer<snapshot_t> chan;
+static std::atomic<bool>        done(false);
+
+static void producer(uint32_t count) {
+  for (uint32_t seq = 1; seq <= count; seq++) {
+    snapshot_t *s = tbWrite(&chan);
+    s->seq = seq;
+    for (uint32_t i = 0; i < words; i++) s->word[i] = fill(seq, i);
+    tbPublish(&chan);
+    if (!(seq & 1023)) std::this_thread::yield(); // Let a single-core host switch
+  }
+  done.store(true, std::memory_order_release);
+}
+
+int main(int argc, char **argv) {
+  uint32_t count = 10000000;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && (i + 1 < argc)) {
+      count = strtoul(argv[++i], nullptr, 0);
+    } else if (!strcmp(argv[i], "-w") && (i + 1 < argc)) {
+      words = strtoul(argv[++i], nullptr, 0);
+      if (!words || (words > MAX_WORDS)) {
+        fprintf(stderr, "tbstress: WORDS must be 1-%d\n", MAX_WORDS);
+        return 2;
+      }
+    } else {
+      fprintf(stderr, "Usage: tbstress [-n COUNT] [-w WORDS]\n");
+      return 2;
+    }
+  }
+
+  snapshot_t initial;
+  memset(&initial, 0, sizeof initial);
+  for (uint32_t i = 0; i < words; i++) initial.word[i] = fill(0, i);
+  tbInit(&chan, initial);
+
+  std::thread p(producer, count);
+  uint64_t reads = 0, fresh = 0, torn = 0, backwards = 0;
+  uint32_t last = 0;
+  for (;;) {
+    bool              finished = done.load(std::memory_order_acquire);
+    const snapshot_t *s        = tbRead(&chan);
+    reads++;
+    for (uint32_t i = 0; i < words; i++) {
+      if (s->word[i] != fill(s->seq, i)) {
+        if (!torn++) fprintf(stderr, "Torn snapshot %lu, word %lu\n",
+                             (unsigned long)s->seq, (unsigned long)i);
+        break;
+      }
+    }
+    if (s->seq < last) {
+      if (!backwards++) fprintf(stderr, "Snapshot %lu read after %lu\n",
+                                (unsigned long)s->seq, (unsigned long)last);
+    } else if (s->seq > last) {
+      fresh++;
+      last = s->seq;
+    }
+    if (finished) break; // This read came after the last publish
+  }
+  p.join();
+
+  if (last != count) {
+    fprintf(stderr, "Last snapshot read %lu, expected %lu\n",
+            (unsigned long)last, (unsigned long)count);
+  }
+  printf("%lu published, %llu reads, %llu new, %llu replaced unread\n",
+         (unsigned long)count, (unsigned long long)reads, (unsigned long long)fresh,
+         (unsigned long long)(count - fresh));
+  printf("%llu torn, %llu out of order\n", (unsigned long long)torn,
+         (unsigned long long)backwards);
+  return (torn || backwards || (last != count)) ? 1 : 0;
+}
@@ -0,0 +1,98 @@
+// tlplay -- runs the sketch's keyframe timeline (src/timeline.h) on the
+// host and prints the channel values over time.
+//
+// Each EXPR argument is a built-in expression number (tlExpressions[],
+// as sent with CMD_EXPR), played back to back starting at time 0; an
+// expression starts when the one before it has no keys left.  Values are
+// printed every STEP ms (default 20) as
+//   ms gazeX gazeY iris close squint
+// until every channel is idle.  With --bench, nothing is printed except
+// the average cost of one tlUpdate() over a long run of the expressions.
+//
+// Build:  g++ -O2 -std=c++17 -o tlplay tlplay.cpp
+// The iris limits use the config.h defaults; build with e.g.
+// -DIRIS_MIN=80 -DIRIS_MAX=140 to match another configuration.
+//
+// Usage:  tlplay [-s STEP] [--bench] EXPR...
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifndef IRIS_MIN
+  #define IRIS_MIN 90
+#endif
+#ifndef IRIS_MAX
+  #define IRIS_MAX 130
+#endif
+#include "../../src/timeline.h"
+
+// Start expression x at time t.  The sketch starts the iris channel from
+// the iris shown; here that is the middle of the range.
+static void play(timeline_t *tl, uint8_t x, uint32_t t) {
+  if (!tl->value[TL_IRIS]) tl->value[TL_IRIS] = (IRIS_MIN + IRIS_MAX) / 2;
+  tlPlay(tl, &tlExpressions[x], t);
+}
+
+static bool allIdle(const timeline_t *tl) {
+  for (uint8_t c = 0; c < TL_CHANNELS; c++) {
+    if (!tlIdle(&tl->track[c])) return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  std::vector<uint8_t> exprs;
+  uint32_t             step = 20;
+  bool                 bench = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-s") && (i + 1 < argc)) {
+      step = strtoul(argv[++i], nullptr, 0);
+    } else if (!strcmp(argv[i], "--bench")) {
+      bench = true;
+    } else {
+      long x = strtol(argv[i], nullptr, 0);
+      if ((x < 0) || (x >= (long)TL_EXPRESSIONS)) {
+        fprintf(stderr, "tlplay: no expression %s (0-%u)\n", argv[i], (unsigned)TL_EXPRESSIONS - 1);
+        return 1;
+      }
+      exprs.push_back(x);
+    }
+  }
+  if (exprs.empty() || !step) {
+    fprintf(stderr, "usage: tlplay [-s STEP] [--bench] EXPR...\n");
+    return 1;
+  }
+
+  timeline_t tl;
+  tlInit(&tl, 0);
+  if (bench) { // 1 ms frames, expressions repeated for a simulated hour
+    const uint32_t frames = 3600000;
+    size_t         next   = 0;
+    int32_t        sum    = 0; // Keeps the results live
+    auto           start  = std::chrono::steady_clock::now();
+    for (uint32_t f = 0; f < frames; f++) {
+      tlUpdate(&tl, f * 1000);
+      if (allIdle(&tl)) play(&tl, exprs[next++ % exprs.size()], f * 1000);
+      sum += tl.value[TL_GAZE_X] + tl.value[TL_CLOSE];
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("%.1f ns per frame (%u frames, checksum %ld)\n", ns / frames, frames, (long)sum);
+    return 0;
+  }
+
+  size_t next = 0;
+  for (uint32_t ms = 0; ; ms += step) {
+    tlUpdate(&tl, ms * 1000);
+    if (allIdle(&tl)) {
+      if (next == exprs.size()) break;
+      play(&tl, exprs[next++], ms * 1000);
+    }
+    printf("%6u %4d %4d %4d %4d %4d\n", ms, tl.value[TL_GAZE_X], tl.value[TL_GAZE_Y],
+           tl.value[TL_IRIS], tl.value[TL_CLOSE], tl.value[TL_SQUINT]);
+  }
+  return 0;
+}